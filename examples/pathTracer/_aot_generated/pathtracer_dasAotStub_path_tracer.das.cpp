@@ -0,0 +1,917 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require random
+ // require path_tracer
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_4365735003226613802 {
+
+namespace path_tracer { struct Sphere; };
+namespace path_tracer { struct Ray; };
+namespace path_tracer { struct Hit; };
+namespace path_tracer { struct Camera; };
+namespace path_tracer { struct Material; };
+namespace random { struct _lambda_random_112_1; };
+// unused enumeration ConversionResult
+// unused structure _lambda_random_112_1
+namespace path_tracer {
+
+enum class Type : int32_t {
+    Lambert = int32_t(0),
+    Metal = int32_t(1),
+    Dielectric = int32_t(2),
+};
+}
+namespace path_tracer {
+
+struct Sphere {
+    float3 center;
+    float radius;
+    float radius2;
+    float iRadius;
+    float pad1;
+    float pad2;
+};
+}
+namespace path_tracer {
+
+struct Ray {
+    float3 orig;
+    float pad1;
+    float3 dir;
+    float pad2;
+};
+}
+namespace path_tracer {
+
+struct Hit {
+    float3 pos;
+    float pad;
+    float3 normal;
+    float t;
+};
+}
+namespace path_tracer {
+
+struct Camera {
+    float3 origin;
+    float3 lowerLeftCorner;
+    float3 horizontal;
+    float3 vertical;
+    float3 u;
+    float3 v;
+    float3 w;
+    float lensRadius;
+};
+}
+namespace path_tracer {
+
+struct Material {
+    DAS_COMMENT(enum) path_tracer::Type mtype;
+    float3 albedo;
+    float3 emissive;
+    float roughness;
+    float ri;
+};
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline int4 _FuncrandomTickrandom_int4Tick14264036843134477957_ffdc2fe91519deea ( Context * __context__, int4 & __seed_rename_at_53_0 );
+inline int32_t _FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2 ( Context * __context__, int4 & __seed_rename_at_30_1 );
+inline float3 _FuncrandomTickrandom_in_unit_diskTick7298328615566574411_597b6a3f1f3487c6 ( Context * __context__, int4 & __seed_rename_at_97_2 );
+inline float3 _FuncrandomTickrandom_unit_vectorTick10283509794340149997_23912c6d066cf131 ( Context * __context__, int4 & __seed_rename_at_72_6 );
+inline float4 _FuncrandomTickrandom_float4Tick4481839910559189099_e5ca45668bfef954 ( Context * __context__, int4 & __seed_rename_at_66_13 );
+inline float3 _FuncrandomTickrandom_in_unit_sphereTick1529226019628612063_7dae8c455cb4217f ( Context * __context__, int4 & __seed_rename_at_84_14 );
+inline float _FuncrandomTickrandom_floatTick8212455123483466034_5ae2aaa8aa5a899a ( Context * __context__, int4 & __seed_rename_at_60_17 );
+inline int4 _FuncrandomTickrandom_seedTick15287272150245073176_6991510ddb1b5a99 ( Context * __context__, int32_t __seed_rename_at_16_18 );
+inline float schlick_84664ab0038b218a ( Context * __context__, float __cosine_rename_at_29_19, float __ri_rename_at_29_20 );
+inline float3 pointAt_c9382d5b86c7ca5b ( Context * __context__, path_tracer::Ray const  & __ray_rename_at_49_22, float __t_rename_at_49_23 );
+inline path_tracer::Camera Camera_16837ac7f22e0a5d ( Context * __context__, float3 __lookFrom_rename_at_69_24, float3 __lookAt_rename_at_69_25, float3 __vup_rename_at_69_26, float __vfov_rename_at_69_27, float __aspect_rename_at_69_28, float __aperture_rename_at_69_29, float __focusDist_rename_at_69_30 );
+inline path_tracer::Ray getRay_24de5c4530e73005 ( Context * __context__, path_tracer::Camera const  & __that_rename_at_87_35, float __s_rename_at_87_36, float __t_rename_at_87_37 );
+inline void init_path_tracer_7c703c4419d2f88f ( Context * __context__ );
+inline int32_t hitSpheres_ba244bb7803a3fe4 ( Context * __context__, path_tracer::Ray const  & __r_rename_at_137_40, float __tMin_rename_at_137_41, float __tMax_rename_at_137_42, path_tracer::Hit & __outHit_rename_at_137_43 );
+inline bool hitWorld_1ce139fb62bc7860 ( Context * __context__, path_tracer::Ray const  & __r_rename_at_167_54, float __tMin_rename_at_167_55, float __tMax_rename_at_167_56, path_tracer::Hit & __outHit_rename_at_167_57, int32_t & __outID_rename_at_167_58 );
+inline bool scatter_433475002aa1f3c6 ( Context * __context__, path_tracer::Material const  & __mat_rename_at_173_59, path_tracer::Ray const  & __r_in_rename_at_173_60, path_tracer::Hit const  & __rec_rename_at_173_61, float3 & __attenuation_rename_at_173_62, path_tracer::Ray & __scattered_rename_at_173_63, float3 & __outLightE_rename_at_173_64, int32_t & __inoutRayCount_rename_at_173_65 );
+inline float3 trace_120442582fae608e ( Context * __context__, path_tracer::Ray const  & __r_rename_at_238_86, int32_t & __inoutRayCount_rename_at_238_87 );
+inline int32_t trace_a34aff2a1fee6414 ( Context * __context__, int32_t __screenWidth_rename_at_275_101, int32_t __screenHeight_rename_at_275_102, int32_t __frameCount_rename_at_275_103, int32_t __ymin_rename_at_275_104, int32_t __ymax_rename_at_275_105, TArray<float3> & __backbuffer_rename_at_275_106, path_tracer::Camera const  & __cam_rename_at_275_107 );
+inline float3 draw_ray_c4d9198ff88364e4 ( Context * __context__, int32_t __x_rename_at_296_117, int32_t __y_rename_at_296_118, int32_t __screenWidth_rename_at_296_119, int32_t __screenHeight_rename_at_296_120 );
+inline void draw_dbb37f448bd40650 ( Context * __context__, int32_t __frameCount_rename_at_313_127, int32_t __screenWidth_rename_at_313_128, int32_t __screenHeight_rename_at_313_129, int32_t __ymin_rename_at_313_130, int32_t __ymax_rename_at_313_131, TArray<float3> & __backbuffer_rename_at_313_132, int32_t & __outRayCount_rename_at_313_133 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global_solid<int32_t,0>(__context__) = 32;/*DO_SAMPLES_PER_PIXEL*/
+    das_global_solid<int32_t,16>(__context__) = 8;/*LIGHT_SPHERE_ID*/
+    das_global_solid<float,32>(__context__) = 1.000000e-03f;/*kMinT*/
+    das_global_solid<float,48>(__context__) = 1.000000e+07f;/*kMaxT*/
+    das_global_solid<int32_t,64>(__context__) = 10;/*kMaxDepth*/
+    das_global_zero_solid<int4,80>(__context__);/*RAND_SEED*/
+    das_global_solid<int32_t,96>(__context__) = 9;/*TOTAL_SPHERES*/
+    das_global_zero_solid<TDim<path_tracer::Sphere,9>,112>(__context__);/*s_Spheres*/
+    das_global_zero_solid<TDim<path_tracer::Material,9>,400>(__context__);/*s_SphereMats*/
+}
+
+inline int4 _FuncrandomTickrandom_int4Tick14264036843134477957_ffdc2fe91519deea ( Context * __context__, int4 & __seed_rename_at_53_0 )
+{
+    das_copy(__seed_rename_at_53_0,SimPolicy<int4>::Add((SimPolicy<int4>::Mul(int4(214013,214013,214013,214013),__seed_rename_at_53_0,*__context__,nullptr)),int4(2531011,2531011,2531011,2531011),*__context__,nullptr));
+    return das_auto_cast<int4>::cast(SimPolicy<int4>::BinAnd((SimPolicy<int4>::BinShr(__seed_rename_at_53_0,cast<int32_t>::from(16),*__context__,nullptr)),int4(32767,32767,32767,32767),*__context__,nullptr));
+}
+
+inline int32_t _FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2 ( Context * __context__, int4 & __seed_rename_at_30_1 )
+{
+    das_copy(das_swizzle_ref<int32_t,int4,0>::swizzle(__seed_rename_at_30_1) /*x*/,(v_extract_xi(v_cast_vec4i(__seed_rename_at_30_1)) /*x*/ * 214013) + 2531011);
+    return das_auto_cast<int32_t>::cast((SimPolicy<int32_t>::BinShr(v_extract_xi(v_cast_vec4i(__seed_rename_at_30_1)) /*x*/,16,*__context__,nullptr)) & 32767);
+}
+
+inline float3 _FuncrandomTickrandom_in_unit_diskTick7298328615566574411_597b6a3f1f3487c6 ( Context * __context__, int4 & __seed_rename_at_97_2 )
+{
+    while ( true )
+    {
+        float2 __R_rename_at_100_3 = ((float2)das_swizzle_seq<float2,float4,0>::swizzle(_FuncrandomTickrandom_float4Tick4481839910559189099_e5ca45668bfef954(__context__,__seed_rename_at_97_2)) /*xy*/);
+        float3 __r_rename_at_101_4 = ((float3)float3(v_extract_x(__R_rename_at_100_3) /*x*/,v_extract_y(__R_rename_at_100_3) /*y*/,0.000000e+00f));
+        float3 __p_rename_at_102_5 = ((float3)(SimPolicy<float3>::Sub((SimPolicy<float3>::Mul(v_splats(2.000000e+00f),__r_rename_at_101_4,*__context__,nullptr)),v_make_vec4f(1.000000e+00f,1.000000e+00f,0.000000e+00f,0.f),*__context__,nullptr)));
+        if ( lengthSq3(__p_rename_at_102_5) <= 1.000000e+00f )
+        {
+            return das_auto_cast<float3>::cast(__p_rename_at_102_5);
+        };
+    };
+    return das_auto_cast<float3>::cast(v_zero());
+}
+
+inline float3 _FuncrandomTickrandom_unit_vectorTick10283509794340149997_23912c6d066cf131 ( Context * __context__, int4 & __seed_rename_at_72_6 )
+{
+    float4 __zz_rename_at_74_7 = ((float4)_FuncrandomTickrandom_float4Tick4481839910559189099_e5ca45668bfef954(__context__,__seed_rename_at_72_6));
+    float __z_rename_at_75_8 = ((float)((v_extract_x(__zz_rename_at_74_7) /*x*/ * 2.000000e+00f) - 1.000000e+00f));
+    float __a_rename_at_76_9 = ((float)(v_extract_y(__zz_rename_at_74_7) /*y*/ * 6.283185e+00f));
+    float __r_rename_at_77_10 = ((float)SimPolicy<float>::Sqrt(1.000000e+00f - (__z_rename_at_75_8 * __z_rename_at_75_8),*__context__,nullptr));
+    float __x_rename_at_78_11 = 0; float __y_rename_at_78_12 = 0;
+    sincosF(__a_rename_at_76_9,__x_rename_at_78_11,__y_rename_at_78_12);
+    return das_auto_cast<float3>::cast(float3(__r_rename_at_77_10 * __x_rename_at_78_11,__r_rename_at_77_10 * __y_rename_at_78_12,__z_rename_at_75_8));
+}
+
+inline float4 _FuncrandomTickrandom_float4Tick4481839910559189099_e5ca45668bfef954 ( Context * __context__, int4 & __seed_rename_at_66_13 )
+{
+    return das_auto_cast<float4>::cast(SimPolicy<float4>::Mul(cvt_ifloat4(_FuncrandomTickrandom_int4Tick14264036843134477957_ffdc2fe91519deea(__context__,__seed_rename_at_66_13)),v_splats(3.051851e-05f),*__context__,nullptr));
+}
+
+inline float3 _FuncrandomTickrandom_in_unit_sphereTick1529226019628612063_7dae8c455cb4217f ( Context * __context__, int4 & __seed_rename_at_84_14 )
+{
+    while ( true )
+    {
+        float3 __r_rename_at_87_15 = ((float3)das_swizzle_seq<float3,float4,0>::swizzle(_FuncrandomTickrandom_float4Tick4481839910559189099_e5ca45668bfef954(__context__,__seed_rename_at_84_14)) /*xyz*/);
+        float3 __p_rename_at_88_16 = ((float3)(SimPolicy<float3>::Sub((SimPolicy<float3>::Mul(v_splats(2.000000e+00f),__r_rename_at_87_15,*__context__,nullptr)),v_splats(1.000000e+00f),*__context__,nullptr)));
+        if ( lengthSq3(__p_rename_at_88_16) <= 1.000000e+00f )
+        {
+            return das_auto_cast<float3>::cast(__p_rename_at_88_16);
+        };
+    };
+    return das_auto_cast<float3>::cast(v_zero());
+}
+
+inline float _FuncrandomTickrandom_floatTick8212455123483466034_5ae2aaa8aa5a899a ( Context * __context__, int4 & __seed_rename_at_60_17 )
+{
+    return das_auto_cast<float>::cast(float(_FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2(__context__,__seed_rename_at_60_17)) * 3.051851e-05f);
+}
+
+inline int4 _FuncrandomTickrandom_seedTick15287272150245073176_6991510ddb1b5a99 ( Context * __context__, int32_t __seed_rename_at_16_18 )
+{
+    return das_auto_cast<int4>::cast(int4(__seed_rename_at_16_18,__seed_rename_at_16_18 + 1,__seed_rename_at_16_18 + 2,__seed_rename_at_16_18 + 3));
+}
+
+inline float schlick_84664ab0038b218a ( Context * __context__, float __cosine_rename_at_29_19, float __ri_rename_at_29_20 )
+{
+    float __r0_rename_at_30_21 = (SimPolicy<float>::Div((1.000000e+00f - __ri_rename_at_29_20),(__ri_rename_at_29_20 + 1.000000e+00f),*__context__,nullptr));
+    return das_auto_cast<float>::cast(SimPolicy<float>::Lerp(__r0_rename_at_30_21 * __r0_rename_at_30_21,1.000000e+00f,SimPolicy<float>::Pow(1.000000e+00f - __cosine_rename_at_29_19,5.000000e+00f,*__context__,nullptr),*__context__,nullptr));
+}
+
+inline float3 pointAt_c9382d5b86c7ca5b ( Context * __context__, path_tracer::Ray const  &  __ray_rename_at_49_22, float __t_rename_at_49_23 )
+{
+    return das_auto_cast<float3>::cast(SimPolicy<float3>::Add(__ray_rename_at_49_22.orig,(SimPolicy<float3>::MulVecScal(__ray_rename_at_49_22.dir,cast<float>::from(__t_rename_at_49_23),*__context__,nullptr)),*__context__,nullptr));
+}
+
+inline path_tracer::Camera Camera_16837ac7f22e0a5d ( Context * __context__, float3 __lookFrom_rename_at_69_24, float3 __lookAt_rename_at_69_25, float3 __vup_rename_at_69_26, float __vfov_rename_at_69_27, float __aspect_rename_at_69_28, float __aperture_rename_at_69_29, float __focusDist_rename_at_69_30 )
+{
+    path_tracer::Camera __that_rename_at_70_31;das_zero(__that_rename_at_70_31);
+    float __theta_rename_at_71_32 = ((float)(SimPolicy<float>::Div((__vfov_rename_at_69_27 * 3.141593e+00f),1.800000e+02f,*__context__,nullptr)));
+    float __halfHeight_rename_at_72_33 = ((float)SimPolicy<float>::Tan(SimPolicy<float>::Div(__theta_rename_at_71_32,2.000000e+00f,*__context__,nullptr),*__context__,nullptr));
+    float __halfWidth_rename_at_73_34 = ((float)(__aspect_rename_at_69_28 * __halfHeight_rename_at_72_33));
+    das_copy(__that_rename_at_70_31.lensRadius,SimPolicy<float>::Div(__aperture_rename_at_69_29,2.000000e+00f,*__context__,nullptr));
+    das_copy(__that_rename_at_70_31.origin,__lookFrom_rename_at_69_24);
+    das_copy(__that_rename_at_70_31.w,normalize3(SimPolicy<float3>::Sub(__lookFrom_rename_at_69_24,__lookAt_rename_at_69_25,*__context__,nullptr)));
+    das_copy(__that_rename_at_70_31.u,normalize3(cross3(__vup_rename_at_69_26,__that_rename_at_70_31.w)));
+    das_copy(__that_rename_at_70_31.v,cross3(__that_rename_at_70_31.w,__that_rename_at_70_31.u));
+    das_copy(__that_rename_at_70_31.lowerLeftCorner,SimPolicy<float3>::Sub((SimPolicy<float3>::Sub((SimPolicy<float3>::Sub(__that_rename_at_70_31.origin,(SimPolicy<float3>::MulScalVec(cast<float>::from((__halfWidth_rename_at_73_34 * __focusDist_rename_at_69_30)),__that_rename_at_70_31.u,*__context__,nullptr)),*__context__,nullptr)),(SimPolicy<float3>::MulScalVec(cast<float>::from((__halfHeight_rename_at_72_33 * __focusDist_rename_at_69_30)),__that_rename_at_70_31.v,*__context__,nullptr)),*__context__,nullptr)),(SimPolicy<float3>::MulScalVec(cast<float>::from(__focusDist_rename_at_69_30),__that_rename_at_70_31.w,*__context__,nullptr)),*__context__,nullptr));
+    das_copy(__that_rename_at_70_31.horizontal,SimPolicy<float3>::MulScalVec(cast<float>::from(((__halfWidth_rename_at_73_34 * 2.000000e+00f) * __focusDist_rename_at_69_30)),__that_rename_at_70_31.u,*__context__,nullptr));
+    das_copy(__that_rename_at_70_31.vertical,SimPolicy<float3>::MulScalVec(cast<float>::from(((__halfHeight_rename_at_72_33 * 2.000000e+00f) * __focusDist_rename_at_69_30)),__that_rename_at_70_31.v,*__context__,nullptr));
+    return das_auto_cast_ref<path_tracer::Camera>::cast(__that_rename_at_70_31);
+}
+
+inline path_tracer::Ray getRay_24de5c4530e73005 ( Context * __context__, path_tracer::Camera const  &  __that_rename_at_87_35, float __s_rename_at_87_36, float __t_rename_at_87_37 )
+{
+    float3 __rd_rename_at_89_38 = ((float3)(SimPolicy<float3>::MulScalVec(cast<float>::from(__that_rename_at_87_35.lensRadius),_FuncrandomTickrandom_in_unit_diskTick7298328615566574411_597b6a3f1f3487c6(__context__,das_global<int4,0xea7c638ab792363c>(__context__) /*RAND_SEED*/),*__context__,nullptr)));
+    float3 __offset_rename_at_90_39 = ((float3)SimPolicy<float3>::MadS(__that_rename_at_87_35.u,cast<float>::from(v_extract_x(__rd_rename_at_89_38) /*x*/),SimPolicy<float3>::MulVecScal(__that_rename_at_87_35.v,cast<float>::from(v_extract_y(__rd_rename_at_89_38) /*y*/),*__context__,nullptr),*__context__,nullptr));
+    return das_auto_cast_ref<path_tracer::Ray>::cast((([&]() -> path_tracer::Ray {
+        path_tracer::Ray __mks_91;
+        das_zero(__mks_91);
+        das_copy((__mks_91.orig),((SimPolicy<float3>::Add(__that_rename_at_87_35.origin,__offset_rename_at_90_39,*__context__,nullptr))));
+        das_copy((__mks_91.dir),(normalize3(SimPolicy<float3>::Sub((SimPolicy<float3>::Sub(SimPolicy<float3>::MadS(__that_rename_at_87_35.vertical,cast<float>::from(__t_rename_at_87_37),SimPolicy<float3>::MadS(__that_rename_at_87_35.horizontal,cast<float>::from(__s_rename_at_87_36),__that_rename_at_87_35.lowerLeftCorner,*__context__,nullptr),*__context__,nullptr),__that_rename_at_87_35.origin,*__context__,nullptr)),__offset_rename_at_90_39,*__context__,nullptr))));
+        return __mks_91;
+    })()));
+}
+
+inline void init_path_tracer_7c703c4419d2f88f ( Context * __context__ )
+{
+    das_copy(das_global<TDim<path_tracer::Sphere,9>,0xb4af5841f46d3c78>(__context__) /*s_Spheres*/(0,__context__),(([&]() -> path_tracer::Sphere {
+        path_tracer::Sphere __mks_116;
+        das_zero(__mks_116);
+        das_copy((__mks_116.center),(v_make_vec4f(0.000000e+00f,-1.005000e+02f,-1.000000e+00f,0.f)));
+        das_copy((__mks_116.radius),(1.000000e+02f));
+        das_copy((__mks_116.radius2),(1.000000e+04f));
+        das_copy((__mks_116.iRadius),(1.000000e-02f));
+        return __mks_116;
+    })()));
+    das_copy(das_global<TDim<path_tracer::Sphere,9>,0xb4af5841f46d3c78>(__context__) /*s_Spheres*/(1,__context__),(([&]() -> path_tracer::Sphere {
+        path_tracer::Sphere __mks_117;
+        das_zero(__mks_117);
+        das_copy((__mks_117.center),(v_make_vec4f(2.000000e+00f,0.000000e+00f,-1.000000e+00f,0.f)));
+        das_copy((__mks_117.radius),(5.000000e-01f));
+        das_copy((__mks_117.radius2),(2.500000e-01f));
+        das_copy((__mks_117.iRadius),(2.000000e+00f));
+        return __mks_117;
+    })()));
+    das_copy(das_global<TDim<path_tracer::Sphere,9>,0xb4af5841f46d3c78>(__context__) /*s_Spheres*/(2,__context__),(([&]() -> path_tracer::Sphere {
+        path_tracer::Sphere __mks_118;
+        das_zero(__mks_118);
+        das_copy((__mks_118.center),(v_make_vec4f(0.000000e+00f,0.000000e+00f,-1.000000e+00f,0.f)));
+        das_copy((__mks_118.radius),(5.000000e-01f));
+        das_copy((__mks_118.radius2),(2.500000e-01f));
+        das_copy((__mks_118.iRadius),(2.000000e+00f));
+        return __mks_118;
+    })()));
+    das_copy(das_global<TDim<path_tracer::Sphere,9>,0xb4af5841f46d3c78>(__context__) /*s_Spheres*/(3,__context__),(([&]() -> path_tracer::Sphere {
+        path_tracer::Sphere __mks_119;
+        das_zero(__mks_119);
+        das_copy((__mks_119.center),(v_make_vec4f(-2.000000e+00f,0.000000e+00f,-1.000000e+00f,0.f)));
+        das_copy((__mks_119.radius),(5.000000e-01f));
+        das_copy((__mks_119.radius2),(2.500000e-01f));
+        das_copy((__mks_119.iRadius),(2.000000e+00f));
+        return __mks_119;
+    })()));
+    das_copy(das_global<TDim<path_tracer::Sphere,9>,0xb4af5841f46d3c78>(__context__) /*s_Spheres*/(4,__context__),(([&]() -> path_tracer::Sphere {
+        path_tracer::Sphere __mks_120;
+        das_zero(__mks_120);
+        das_copy((__mks_120.center),(v_make_vec4f(2.000000e+00f,0.000000e+00f,1.000000e+00f,0.f)));
+        das_copy((__mks_120.radius),(5.000000e-01f));
+        das_copy((__mks_120.radius2),(2.500000e-01f));
+        das_copy((__mks_120.iRadius),(2.000000e+00f));
+        return __mks_120;
+    })()));
+    das_copy(das_global<TDim<path_tracer::Sphere,9>,0xb4af5841f46d3c78>(__context__) /*s_Spheres*/(5,__context__),(([&]() -> path_tracer::Sphere {
+        path_tracer::Sphere __mks_121;
+        das_zero(__mks_121);
+        das_copy((__mks_121.center),(v_make_vec4f(0.000000e+00f,0.000000e+00f,1.000000e+00f,0.f)));
+        das_copy((__mks_121.radius),(5.000000e-01f));
+        das_copy((__mks_121.radius2),(2.500000e-01f));
+        das_copy((__mks_121.iRadius),(2.000000e+00f));
+        return __mks_121;
+    })()));
+    das_copy(das_global<TDim<path_tracer::Sphere,9>,0xb4af5841f46d3c78>(__context__) /*s_Spheres*/(6,__context__),(([&]() -> path_tracer::Sphere {
+        path_tracer::Sphere __mks_122;
+        das_zero(__mks_122);
+        das_copy((__mks_122.center),(v_make_vec4f(-2.000000e+00f,0.000000e+00f,1.000000e+00f,0.f)));
+        das_copy((__mks_122.radius),(5.000000e-01f));
+        das_copy((__mks_122.radius2),(2.500000e-01f));
+        das_copy((__mks_122.iRadius),(2.000000e+00f));
+        return __mks_122;
+    })()));
+    das_copy(das_global<TDim<path_tracer::Sphere,9>,0xb4af5841f46d3c78>(__context__) /*s_Spheres*/(7,__context__),(([&]() -> path_tracer::Sphere {
+        path_tracer::Sphere __mks_123;
+        das_zero(__mks_123);
+        das_copy((__mks_123.center),(v_make_vec4f(5.000000e-01f,1.000000e+00f,5.000000e-01f,0.f)));
+        das_copy((__mks_123.radius),(5.000000e-01f));
+        das_copy((__mks_123.radius2),(2.500000e-01f));
+        das_copy((__mks_123.iRadius),(2.000000e+00f));
+        return __mks_123;
+    })()));
+    das_copy(das_global<TDim<path_tracer::Sphere,9>,0xb4af5841f46d3c78>(__context__) /*s_Spheres*/(8,__context__),(([&]() -> path_tracer::Sphere {
+        path_tracer::Sphere __mks_124;
+        das_zero(__mks_124);
+        das_copy((__mks_124.center),(v_make_vec4f(-1.500000e+00f,1.500000e+00f,0.000000e+00f,0.f)));
+        das_copy((__mks_124.radius),(3.000000e-01f));
+        das_copy((__mks_124.radius2),(9.000000e-02f));
+        das_copy((__mks_124.iRadius),(3.333333e+00f));
+        return __mks_124;
+    })()));
+    das_copy(das_global<TDim<path_tracer::Material,9>,0xf7018aaea0ad9019>(__context__) /*s_SphereMats*/(0,__context__),(([&]() -> path_tracer::Material {
+        path_tracer::Material __mks_125;
+        das_copy((__mks_125.mtype),(DAS_COMMENT(enum) path_tracer::Type::Lambert));
+        das_copy((__mks_125.albedo),(v_splats(8.000000e-01f)));
+        das_copy((__mks_125.emissive),(v_zero()));
+        das_copy((__mks_125.roughness),(0.000000e+00f));
+        das_copy((__mks_125.ri),(0.000000e+00f));
+        return __mks_125;
+    })()));
+    das_copy(das_global<TDim<path_tracer::Material,9>,0xf7018aaea0ad9019>(__context__) /*s_SphereMats*/(1,__context__),(([&]() -> path_tracer::Material {
+        path_tracer::Material __mks_126;
+        das_copy((__mks_126.mtype),(DAS_COMMENT(enum) path_tracer::Type::Lambert));
+        das_copy((__mks_126.albedo),(v_make_vec4f(8.000000e-01f,4.000000e-01f,4.000000e-01f,0.f)));
+        das_copy((__mks_126.emissive),(v_zero()));
+        das_copy((__mks_126.roughness),(0.000000e+00f));
+        das_copy((__mks_126.ri),(0.000000e+00f));
+        return __mks_126;
+    })()));
+    das_copy(das_global<TDim<path_tracer::Material,9>,0xf7018aaea0ad9019>(__context__) /*s_SphereMats*/(2,__context__),(([&]() -> path_tracer::Material {
+        path_tracer::Material __mks_127;
+        das_copy((__mks_127.mtype),(DAS_COMMENT(enum) path_tracer::Type::Lambert));
+        das_copy((__mks_127.albedo),(v_make_vec4f(4.000000e-01f,8.000000e-01f,4.000000e-01f,0.f)));
+        das_copy((__mks_127.emissive),(v_zero()));
+        das_copy((__mks_127.roughness),(0.000000e+00f));
+        das_copy((__mks_127.ri),(0.000000e+00f));
+        return __mks_127;
+    })()));
+    das_copy(das_global<TDim<path_tracer::Material,9>,0xf7018aaea0ad9019>(__context__) /*s_SphereMats*/(3,__context__),(([&]() -> path_tracer::Material {
+        path_tracer::Material __mks_128;
+        das_copy((__mks_128.mtype),(DAS_COMMENT(enum) path_tracer::Type::Metal));
+        das_copy((__mks_128.albedo),(v_make_vec4f(4.000000e-01f,4.000000e-01f,8.000000e-01f,0.f)));
+        das_copy((__mks_128.emissive),(v_zero()));
+        das_copy((__mks_128.roughness),(0.000000e+00f));
+        das_copy((__mks_128.ri),(0.000000e+00f));
+        return __mks_128;
+    })()));
+    das_copy(das_global<TDim<path_tracer::Material,9>,0xf7018aaea0ad9019>(__context__) /*s_SphereMats*/(4,__context__),(([&]() -> path_tracer::Material {
+        path_tracer::Material __mks_129;
+        das_copy((__mks_129.mtype),(DAS_COMMENT(enum) path_tracer::Type::Metal));
+        das_copy((__mks_129.albedo),(v_make_vec4f(4.000000e-01f,8.000000e-01f,4.000000e-01f,0.f)));
+        das_copy((__mks_129.emissive),(v_zero()));
+        das_copy((__mks_129.roughness),(0.000000e+00f));
+        das_copy((__mks_129.ri),(0.000000e+00f));
+        return __mks_129;
+    })()));
+    das_copy(das_global<TDim<path_tracer::Material,9>,0xf7018aaea0ad9019>(__context__) /*s_SphereMats*/(5,__context__),(([&]() -> path_tracer::Material {
+        path_tracer::Material __mks_130;
+        das_copy((__mks_130.mtype),(DAS_COMMENT(enum) path_tracer::Type::Metal));
+        das_copy((__mks_130.albedo),(v_make_vec4f(4.000000e-01f,8.000000e-01f,4.000000e-01f,0.f)));
+        das_copy((__mks_130.emissive),(v_zero()));
+        das_copy((__mks_130.roughness),(2.000000e-01f));
+        das_copy((__mks_130.ri),(0.000000e+00f));
+        return __mks_130;
+    })()));
+    das_copy(das_global<TDim<path_tracer::Material,9>,0xf7018aaea0ad9019>(__context__) /*s_SphereMats*/(6,__context__),(([&]() -> path_tracer::Material {
+        path_tracer::Material __mks_131;
+        das_copy((__mks_131.mtype),(DAS_COMMENT(enum) path_tracer::Type::Metal));
+        das_copy((__mks_131.albedo),(v_make_vec4f(4.000000e-01f,8.000000e-01f,4.000000e-01f,0.f)));
+        das_copy((__mks_131.emissive),(v_zero()));
+        das_copy((__mks_131.roughness),(6.000000e-01f));
+        das_copy((__mks_131.ri),(0.000000e+00f));
+        return __mks_131;
+    })()));
+    das_copy(das_global<TDim<path_tracer::Material,9>,0xf7018aaea0ad9019>(__context__) /*s_SphereMats*/(7,__context__),(([&]() -> path_tracer::Material {
+        path_tracer::Material __mks_132;
+        das_copy((__mks_132.mtype),(DAS_COMMENT(enum) path_tracer::Type::Dielectric));
+        das_copy((__mks_132.albedo),(v_splats(4.000000e-01f)));
+        das_copy((__mks_132.emissive),(v_zero()));
+        das_copy((__mks_132.roughness),(0.000000e+00f));
+        das_copy((__mks_132.ri),(1.500000e+00f));
+        return __mks_132;
+    })()));
+    das_copy(das_global<TDim<path_tracer::Material,9>,0xf7018aaea0ad9019>(__context__) /*s_SphereMats*/(8,__context__),(([&]() -> path_tracer::Material {
+        path_tracer::Material __mks_133;
+        das_copy((__mks_133.mtype),(DAS_COMMENT(enum) path_tracer::Type::Lambert));
+        das_copy((__mks_133.albedo),(v_make_vec4f(8.000000e-01f,6.000000e-01f,2.000000e-01f,0.f)));
+        das_copy((__mks_133.emissive),(v_make_vec4f(3.000000e+01f,2.500000e+01f,1.500000e+01f,0.f)));
+        das_copy((__mks_133.roughness),(0.000000e+00f));
+        das_copy((__mks_133.ri),(0.000000e+00f));
+        return __mks_133;
+    })()));
+}
+
+inline int32_t hitSpheres_ba244bb7803a3fe4 ( Context * __context__, path_tracer::Ray const  &  __r_rename_at_137_40, float __tMin_rename_at_137_41, float __tMax_rename_at_137_42, path_tracer::Hit &  __outHit_rename_at_137_43 )
+{
+    float __hitT_rename_at_138_44 = __tMax_rename_at_137_42;
+    int32_t __id_rename_at_139_45 = -1;
+    int32_t __i_rename_at_140_46 = 0;
+    {
+        bool __need_loop_141 = true;
+        // sph: path_tracer::Sphere& -const
+        das_iterator<TDim<path_tracer::Sphere,9>> __sph_iterator(das_global<TDim<path_tracer::Sphere,9>,0xb4af5841f46d3c78>(__context__) /*s_Spheres*/);
+        path_tracer::Sphere * __sph_rename_at_141_47;
+        __need_loop_141 = __sph_iterator.first(__context__,(__sph_rename_at_141_47)) && __need_loop_141;
+        for ( ; __need_loop_141 ; __need_loop_141 = __sph_iterator.next(__context__,(__sph_rename_at_141_47)) )
+        {
+            float3 __co_rename_at_142_48 = ((float3)(SimPolicy<float3>::Sub((*__sph_rename_at_141_47).center,__r_rename_at_137_40.orig,*__context__,nullptr)));
+            float __nb_rename_at_143_49 = ((float)dot3(__co_rename_at_142_48,__r_rename_at_137_40.dir));
+            float __discr_rename_at_144_50 = ((float)SimPolicy<float>::Mad(__nb_rename_at_143_49,__nb_rename_at_143_49,(*__sph_rename_at_141_47).radius2 - lengthSq3(__co_rename_at_142_48),*__context__,nullptr));
+            if ( __discr_rename_at_144_50 > 0.000000e+00f )
+            {
+                float __discrSq_rename_at_146_51 = ((float)SimPolicy<float>::Sqrt(__discr_rename_at_144_50,*__context__,nullptr));
+                float __t_rename_at_147_52 = (__nb_rename_at_143_49 - __discrSq_rename_at_146_51);
+                if ( __t_rename_at_147_52 <= __tMin_rename_at_137_41 )
+                {
+                    das_copy(__t_rename_at_147_52,__nb_rename_at_143_49 + __discrSq_rename_at_146_51);
+                };
+                if ( (__t_rename_at_147_52 > __tMin_rename_at_137_41) && (__t_rename_at_147_52 < __hitT_rename_at_138_44) )
+                {
+                    das_copy(__id_rename_at_139_45,__i_rename_at_140_46);
+                    das_copy(__hitT_rename_at_138_44,__t_rename_at_147_52);
+                };
+            };
+            ++__i_rename_at_140_46;
+        }
+        __sph_iterator.close(__context__,(__sph_rename_at_141_47));
+    };
+    if ( __id_rename_at_139_45 != -1 )
+    {
+        float3 __atPos_rename_at_159_53 = ((float3)pointAt_c9382d5b86c7ca5b(__context__,__r_rename_at_137_40,__hitT_rename_at_138_44));
+        das_copy(__outHit_rename_at_137_43,(([&]() -> path_tracer::Hit {
+            path_tracer::Hit __mks_160;
+            das_zero(__mks_160);
+            das_copy((__mks_160.pos),(__atPos_rename_at_159_53));
+            das_copy((__mks_160.normal),((SimPolicy<float3>::MulVecScal((SimPolicy<float3>::Sub(__atPos_rename_at_159_53,das_global<TDim<path_tracer::Sphere,9>,0xb4af5841f46d3c78>(__context__) /*s_Spheres*/(__id_rename_at_139_45,__context__).center,*__context__,nullptr)),cast<float>::from(das_global<TDim<path_tracer::Sphere,9>,0xb4af5841f46d3c78>(__context__) /*s_Spheres*/(__id_rename_at_139_45,__context__).iRadius),*__context__,nullptr))));
+            das_copy((__mks_160.t),(__hitT_rename_at_138_44));
+            return __mks_160;
+        })()));
+    };
+    return das_auto_cast<int32_t>::cast(__id_rename_at_139_45);
+}
+
+inline bool hitWorld_1ce139fb62bc7860 ( Context * __context__, path_tracer::Ray const  &  __r_rename_at_167_54, float __tMin_rename_at_167_55, float __tMax_rename_at_167_56, path_tracer::Hit &  __outHit_rename_at_167_57, int32_t & __outID_rename_at_167_58 )
+{
+    das_copy(__outID_rename_at_167_58,hitSpheres_ba244bb7803a3fe4(__context__,__r_rename_at_167_54,__tMin_rename_at_167_55,__tMax_rename_at_167_56,das_arg<path_tracer::Hit>::pass(__outHit_rename_at_167_57)));
+    return das_auto_cast<bool>::cast(__outID_rename_at_167_58 != -1);
+}
+
+inline bool scatter_433475002aa1f3c6 ( Context * __context__, path_tracer::Material const  &  __mat_rename_at_173_59, path_tracer::Ray const  &  __r_in_rename_at_173_60, path_tracer::Hit const  &  __rec_rename_at_173_61, float3 & __attenuation_rename_at_173_62, path_tracer::Ray &  __scattered_rename_at_173_63, float3 & __outLightE_rename_at_173_64, int32_t & __inoutRayCount_rename_at_173_65 )
+{
+    das_copy(__outLightE_rename_at_173_64,v_zero());
+    if ( __mat_rename_at_173_59.mtype == DAS_COMMENT(enum) path_tracer::Type::Lambert )
+    {
+        float3 __target_rename_at_176_66 = ((float3)(SimPolicy<float3>::Add((SimPolicy<float3>::Add(__rec_rename_at_173_61.pos,__rec_rename_at_173_61.normal,*__context__,nullptr)),_FuncrandomTickrandom_unit_vectorTick10283509794340149997_23912c6d066cf131(__context__,das_global<int4,0xea7c638ab792363c>(__context__) /*RAND_SEED*/),*__context__,nullptr)));
+        das_copy(__scattered_rename_at_173_63,(([&]() -> path_tracer::Ray {
+            path_tracer::Ray __mks_177;
+            das_zero(__mks_177);
+            das_copy((__mks_177.orig),(__rec_rename_at_173_61.pos));
+            das_copy((__mks_177.dir),(normalize3(SimPolicy<float3>::Sub(__target_rename_at_176_66,__rec_rename_at_173_61.pos,*__context__,nullptr))));
+            return __mks_177;
+        })()));
+        das_copy(__attenuation_rename_at_173_62,__mat_rename_at_173_59.albedo);
+        float3 __sc_rename_at_179_67 = ((float3)das_global<TDim<path_tracer::Sphere,9>,0xb4af5841f46d3c78>(__context__) /*s_Spheres*/(8,__context__).center);
+        float3 __sw_rename_at_180_68 = ((float3)normalize3(SimPolicy<float3>::Sub(__sc_rename_at_179_67,__rec_rename_at_173_61.pos,*__context__,nullptr)));
+        float3 __su_rename_at_181_69 = ((float3)normalize3(cross3((SimPolicy<float>::Abs(v_extract_x(__sw_rename_at_180_68) /*x*/,*__context__,nullptr) > 1.000000e-02f) ? (vec4f)das_auto_cast<float3>::cast(v_make_vec4f(0.000000e+00f,1.000000e+00f,0.000000e+00f,0.f)) : (vec4f)das_auto_cast<float3>::cast(v_make_vec4f(1.000000e+00f,0.000000e+00f,0.000000e+00f,0.f)),__sw_rename_at_180_68)));
+        float3 __sv_rename_at_182_70 = ((float3)cross3(__sw_rename_at_180_68,__su_rename_at_181_69));
+        float __sr_rename_at_183_71 = ((float)das_global<TDim<path_tracer::Sphere,9>,0xb4af5841f46d3c78>(__context__) /*s_Spheres*/(8,__context__).radius);
+        float __cosAMax_rename_at_184_72 = ((float)SimPolicy<float>::Sqrt(SimPolicy<float>::Sat(1.000000e+00f - ((__sr_rename_at_183_71 * __sr_rename_at_183_71) * invdistanceSq3(__rec_rename_at_173_61.pos,__sc_rename_at_179_67)),*__context__,nullptr),*__context__,nullptr));
+        float4 __eps_rename_at_185_73 = ((float4)_FuncrandomTickrandom_float4Tick4481839910559189099_e5ca45668bfef954(__context__,das_global<int4,0xea7c638ab792363c>(__context__) /*RAND_SEED*/));
+        float __cosA_rename_at_186_74 = ((float)(SimPolicy<float>::Mad(v_extract_x(__eps_rename_at_185_73) /*x*/,__cosAMax_rename_at_184_72,1.000000e+00f,*__context__,nullptr) - v_extract_x(__eps_rename_at_185_73) /*x*/));
+        float __sinA_rename_at_187_75 = ((float)SimPolicy<float>::Sqrt(1.000000e+00f - (__cosA_rename_at_186_74 * __cosA_rename_at_186_74),*__context__,nullptr));
+        float __sinPhi_rename_at_188_76 = 0; float __cosPhi_rename_at_188_77 = 0;
+        sincosF(v_extract_y(__eps_rename_at_185_73) /*y*/ * 6.283185e+00f,__sinPhi_rename_at_188_76,__cosPhi_rename_at_188_77);
+        float3 __l_rename_at_190_78 = ((float3)(SimPolicy<float3>::Add((SimPolicy<float3>::Add((SimPolicy<float3>::MulVecScal(__su_rename_at_181_69,cast<float>::from((__cosPhi_rename_at_188_77 * __sinA_rename_at_187_75)),*__context__,nullptr)),(SimPolicy<float3>::MulVecScal(__sv_rename_at_182_70,cast<float>::from((__sinPhi_rename_at_188_76 * __sinA_rename_at_187_75)),*__context__,nullptr)),*__context__,nullptr)),(SimPolicy<float3>::MulVecScal(__sw_rename_at_180_68,cast<float>::from(__cosA_rename_at_186_74),*__context__,nullptr)),*__context__,nullptr)));
+        path_tracer::Hit __lightHit_rename_at_191_79;das_zero(__lightHit_rename_at_191_79);
+        int32_t __hitID_rename_at_192_80 = 0;
+        ++__inoutRayCount_rename_at_173_65;
+        path_tracer::Ray __ray_rename_at_194_81_ConstRef = ((path_tracer::Ray)(([&]() -> path_tracer::Ray {
+            path_tracer::Ray __mks_194;
+            das_zero(__mks_194);
+            das_copy((__mks_194.orig),(__rec_rename_at_173_61.pos));
+            das_copy((__mks_194.dir),(__l_rename_at_190_78));
+            return __mks_194;
+        })()));
+        path_tracer::Ray const  & __ray_rename_at_194_81 = __ray_rename_at_194_81_ConstRef;
+;
+        if ( hitWorld_1ce139fb62bc7860(__context__,__ray_rename_at_194_81,1.000000e-03f,1.000000e+07f,das_arg<path_tracer::Hit>::pass(__lightHit_rename_at_191_79),__hitID_rename_at_192_80) && (__hitID_rename_at_192_80 == 8) )
+        {
+            float3 __nl_rename_at_196_82 = ((float3)((dot3(__rec_rename_at_173_61.normal,__r_in_rename_at_173_60.dir) < 0.000000e+00f) ? (vec4f)das_auto_cast<float3>::cast(__rec_rename_at_173_61.normal) : (vec4f)das_auto_cast<float3>::cast(SimPolicy<float3>::Unm(__rec_rename_at_173_61.normal,*__context__,nullptr))));
+            SimPolicy<float3>::SetAdd((char *)&(__outLightE_rename_at_173_64),(SimPolicy<float3>::MulVecScal((SimPolicy<float3>::Mul(__mat_rename_at_173_59.albedo,das_global<TDim<path_tracer::Material,9>,0xf7018aaea0ad9019>(__context__) /*s_SphereMats*/(8,__context__).emissive,*__context__,nullptr)),cast<float>::from((SimPolicy<float>::Sat(dot3(__l_rename_at_190_78,__nl_rename_at_196_82),*__context__,nullptr) * SimPolicy<float>::Mad(-2.000000e+00f,__cosAMax_rename_at_184_72,2.000000e+00f,*__context__,nullptr))),*__context__,nullptr)),*__context__,nullptr);
+        };
+        return das_auto_cast<bool>::cast(true);
+    } else if ( __mat_rename_at_173_59.mtype == DAS_COMMENT(enum) path_tracer::Type::Metal )
+    {
+        float3 __refl_rename_at_201_83 = ((float3)reflect(__r_in_rename_at_173_60.dir,__rec_rename_at_173_61.normal));
+        das_copy(__scattered_rename_at_173_63,(([&]() -> path_tracer::Ray {
+            path_tracer::Ray __mks_202;
+            das_zero(__mks_202);
+            das_copy((__mks_202.orig),(__rec_rename_at_173_61.pos));
+            das_copy((__mks_202.dir),(normalize3(SimPolicy<float3>::MadS(_FuncrandomTickrandom_in_unit_sphereTick1529226019628612063_7dae8c455cb4217f(__context__,das_global<int4,0xea7c638ab792363c>(__context__) /*RAND_SEED*/),cast<float>::from(__mat_rename_at_173_59.roughness),__refl_rename_at_201_83,*__context__,nullptr))));
+            return __mks_202;
+        })()));
+        das_copy(__attenuation_rename_at_173_62,__mat_rename_at_173_59.albedo);
+        return das_auto_cast<bool>::cast(dot3(__scattered_rename_at_173_63.dir,__rec_rename_at_173_61.normal) > 0.000000e+00f);
+    } else if ( __mat_rename_at_173_59.mtype == DAS_COMMENT(enum) path_tracer::Type::Dielectric )
+    {
+        das_copy(__attenuation_rename_at_173_62,v_splats(1.000000e+00f));
+        float3 __refr_rename_at_207_84 = v_zero();
+        float __reflProb_rename_at_208_85 = 0;
+        if ( dot3(__r_in_rename_at_173_60.dir,__rec_rename_at_173_61.normal) > 0.000000e+00f )
+        {
+            das_copy(__refr_rename_at_207_84,refract(__r_in_rename_at_173_60.dir,SimPolicy<float3>::Unm(__rec_rename_at_173_61.normal,*__context__,nullptr),__mat_rename_at_173_59.ri));
+            if ( lengthSq3(__refr_rename_at_207_84) > 0.000000e+00f )
+            {
+                das_copy(__reflProb_rename_at_208_85,schlick_84664ab0038b218a(__context__,__mat_rename_at_173_59.ri * dot3(__r_in_rename_at_173_60.dir,__rec_rename_at_173_61.normal),__mat_rename_at_173_59.ri));
+            } else {
+                das_copy(__reflProb_rename_at_208_85,1.000000e+00f);
+            };
+        } else {
+            das_copy(__refr_rename_at_207_84,refract(__r_in_rename_at_173_60.dir,__rec_rename_at_173_61.normal,SimPolicy<float>::Div(1.000000e+00f,__mat_rename_at_173_59.ri,*__context__,nullptr)));
+            if ( lengthSq3(__refr_rename_at_207_84) > 0.000000e+00f )
+            {
+                das_copy(__reflProb_rename_at_208_85,schlick_84664ab0038b218a(__context__,-dot3(__r_in_rename_at_173_60.dir,__rec_rename_at_173_61.normal),__mat_rename_at_173_59.ri));
+            } else {
+                das_copy(__reflProb_rename_at_208_85,1.000000e+00f);
+            };
+        };
+        if ( _FuncrandomTickrandom_floatTick8212455123483466034_5ae2aaa8aa5a899a(__context__,das_global<int4,0xea7c638ab792363c>(__context__) /*RAND_SEED*/) < __reflProb_rename_at_208_85 )
+        {
+            das_copy(__scattered_rename_at_173_63,(([&]() -> path_tracer::Ray {
+                path_tracer::Ray __mks_225;
+                das_zero(__mks_225);
+                das_copy((__mks_225.orig),(__rec_rename_at_173_61.pos));
+                das_copy((__mks_225.dir),(normalize3(reflect(__r_in_rename_at_173_60.dir,__rec_rename_at_173_61.normal))));
+                return __mks_225;
+            })()));
+        } else {
+            das_copy(__scattered_rename_at_173_63,(([&]() -> path_tracer::Ray {
+                path_tracer::Ray __mks_227;
+                das_zero(__mks_227);
+                das_copy((__mks_227.orig),(__rec_rename_at_173_61.pos));
+                das_copy((__mks_227.dir),(normalize3(__refr_rename_at_207_84)));
+                return __mks_227;
+            })()));
+        };
+    } else {
+        das_copy(__attenuation_rename_at_173_62,v_make_vec4f(1.000000e+00f,0.000000e+00f,1.000000e+00f,0.f));
+        das_copy(__scattered_rename_at_173_63,(([&]() -> path_tracer::Ray {
+            path_tracer::Ray __mks_231;
+            das_zero(__mks_231);
+            das_copy((__mks_231.orig),(v_zero()));
+            das_copy((__mks_231.dir),(v_zero()));
+            return __mks_231;
+        })()));
+        return das_auto_cast<bool>::cast(false);
+    };
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline float3 trace_120442582fae608e ( Context * __context__, path_tracer::Ray const  &  __r_rename_at_238_86, int32_t & __inoutRayCount_rename_at_238_87 )
+{
+    path_tracer::Ray __ray_rename_at_239_88 = __r_rename_at_238_86;
+    float3 __col_rename_at_240_89 = v_zero();
+    float3 __curAtten_rename_at_241_90 = v_splats(1.000000e+00f);
+    bool __doMaterialE_rename_at_242_91 = true;
+    {
+        bool __need_loop_243 = true;
+        // depth: int const
+        das_iterator<range> __depth_iterator(range(0,10));
+        int32_t __depth_rename_at_243_92;
+        __need_loop_243 = __depth_iterator.first(__context__,(__depth_rename_at_243_92)) && __need_loop_243;
+        for ( ; __need_loop_243 ; __need_loop_243 = __depth_iterator.next(__context__,(__depth_rename_at_243_92)) )
+        {
+            path_tracer::Hit __rec_rename_at_244_93;das_zero(__rec_rename_at_244_93);
+            int32_t __id_rename_at_245_94 = 0;
+            ++__inoutRayCount_rename_at_238_87;
+            if ( hitWorld_1ce139fb62bc7860(__context__,das_arg<path_tracer::Ray>::pass(__ray_rename_at_239_88),1.000000e-03f,1.000000e+07f,das_arg<path_tracer::Hit>::pass(__rec_rename_at_244_93),__id_rename_at_245_94) )
+            {
+                path_tracer::Ray __scattered_rename_at_248_95;das_zero(__scattered_rename_at_248_95);
+                float3 __attenuation_rename_at_249_96 = v_zero();
+                float3 __lightE_rename_at_250_97 = v_zero();
+                float3 __matE_rename_at_251_98 = das_global<TDim<path_tracer::Material,9>,0xf7018aaea0ad9019>(__context__) /*s_SphereMats*/(__id_rename_at_245_94,__context__).emissive;
+                if ( scatter_433475002aa1f3c6(__context__,das_arg<path_tracer::Material>::pass(das_global<TDim<path_tracer::Material,9>,0xf7018aaea0ad9019>(__context__) /*s_SphereMats*/(__id_rename_at_245_94,__context__)),das_arg<path_tracer::Ray>::pass(__ray_rename_at_239_88),das_arg<path_tracer::Hit>::pass(__rec_rename_at_244_93),__attenuation_rename_at_249_96,das_arg<path_tracer::Ray>::pass(__scattered_rename_at_248_95),__lightE_rename_at_250_97,__inoutRayCount_rename_at_238_87) )
+                {
+                    if ( !__doMaterialE_rename_at_242_91 )
+                    {
+                        das_copy(__matE_rename_at_251_98,v_zero());
+                    };
+                    das_copy(__doMaterialE_rename_at_242_91,das_global<TDim<path_tracer::Material,9>,0xf7018aaea0ad9019>(__context__) /*s_SphereMats*/(__id_rename_at_245_94,__context__).mtype != DAS_COMMENT(enum) path_tracer::Type::Lambert);
+                    SimPolicy<float3>::SetAdd((char *)&(__col_rename_at_240_89),(SimPolicy<float3>::Mul(__curAtten_rename_at_241_90,(SimPolicy<float3>::Add(__matE_rename_at_251_98,__lightE_rename_at_250_97,*__context__,nullptr)),*__context__,nullptr)),*__context__,nullptr);
+                    SimPolicy<float3>::SetMul((char *)&(__curAtten_rename_at_241_90),__attenuation_rename_at_249_96,*__context__,nullptr);
+                    das_copy(__ray_rename_at_239_88,__scattered_rename_at_248_95);
+                } else {
+                    SimPolicy<float3>::SetAdd((char *)&(__col_rename_at_240_89),(SimPolicy<float3>::Mul(__curAtten_rename_at_241_90,__matE_rename_at_251_98,*__context__,nullptr)),*__context__,nullptr);
+                    break;
+                };
+            } else {
+                float3 __t_rename_at_265_99 = ((float3)SimPolicy<float3>::MadS(__ray_rename_at_239_88.dir,cast<float>::from(5.000000e-01f),v_splats(1.000000e+00f),*__context__,nullptr));
+                float3 __skyCol_rename_at_266_100 = ((float3)SimPolicy<float3>::Lerp(v_splats(3.000000e-01f),v_make_vec4f(1.500000e-01f,2.100000e-01f,3.000000e-01f,0.f),__t_rename_at_265_99,*__context__,nullptr));
+                SimPolicy<float3>::SetAdd((char *)&(__col_rename_at_240_89),(SimPolicy<float3>::Mul(__curAtten_rename_at_241_90,__skyCol_rename_at_266_100,*__context__,nullptr)),*__context__,nullptr);
+                break;
+            };
+        }
+        __depth_iterator.close(__context__,(__depth_rename_at_243_92));
+    };
+    return das_auto_cast<float3>::cast(__col_rename_at_240_89);
+}
+
+inline int32_t trace_a34aff2a1fee6414 ( Context * __context__, int32_t __screenWidth_rename_at_275_101, int32_t __screenHeight_rename_at_275_102, int32_t __frameCount_rename_at_275_103, int32_t __ymin_rename_at_275_104, int32_t __ymax_rename_at_275_105, TArray<float3> &  __backbuffer_rename_at_275_106, path_tracer::Camera const  &  __cam_rename_at_275_107 )
+{
+    float2 __invWH_rename_at_276_108 = ((float2)(SimPolicy<float2>::DivScalVec(cast<float>::from(1.000000e+00f),float2(__screenWidth_rename_at_275_101,__screenHeight_rename_at_275_102),*__context__,nullptr)));
+    float3 __lerpFac_rename_at_277_109 = ((float3)v_splats(SimPolicy<float>::Div(float(__frameCount_rename_at_275_103),float(__frameCount_rename_at_275_103 + 1),*__context__,nullptr)));
+    int32_t __rayCount_rename_at_278_110 = 0;
+    int32_t __backbufferIdx_rename_at_279_111 = (__ymin_rename_at_275_104 * __screenWidth_rename_at_275_101);
+    {
+        bool __need_loop_280 = true;
+        // y: int const
+        das_iterator<range> __y_iterator(range(__ymin_rename_at_275_104,__ymax_rename_at_275_105));
+        int32_t __y_rename_at_280_112;
+        __need_loop_280 = __y_iterator.first(__context__,(__y_rename_at_280_112)) && __need_loop_280;
+        for ( ; __need_loop_280 ; __need_loop_280 = __y_iterator.next(__context__,(__y_rename_at_280_112)) )
+        {
+            das_copy(das_global<int4,0xea7c638ab792363c>(__context__) /*RAND_SEED*/,_FuncrandomTickrandom_seedTick15287272150245073176_6991510ddb1b5a99(__context__,(__y_rename_at_280_112 * 117) + (__frameCount_rename_at_275_103 * 13)));
+            {
+                bool __need_loop_282 = true;
+                // x: int const
+                das_iterator<range> __x_iterator(mk_range(__screenWidth_rename_at_275_101));
+                int32_t __x_rename_at_282_113;
+                __need_loop_282 = __x_iterator.first(__context__,(__x_rename_at_282_113)) && __need_loop_282;
+                for ( ; __need_loop_282 ; __need_loop_282 = __x_iterator.next(__context__,(__x_rename_at_282_113)) )
+                {
+                    float3 __col_rename_at_283_114 = v_zero();
+                    {
+                        bool __need_loop_284 = true;
+                        // s: int const
+                        das_iterator<range> __s_iterator(range(0,32));
+                        int32_t __s_rename_at_284_115;
+                        __need_loop_284 = __s_iterator.first(__context__,(__s_rename_at_284_115)) && __need_loop_284;
+                        for ( ; __need_loop_284 ; __need_loop_284 = __s_iterator.next(__context__,(__s_rename_at_284_115)) )
+                        {
+                            path_tracer::Ray _temp_make_local_286_30_0; _temp_make_local_286_30_0;
+                            float2 __uv_rename_at_285_116 = ((float2)(SimPolicy<float2>::Mul((SimPolicy<float2>::Add(float2(__x_rename_at_282_113,__y_rename_at_280_112),das_swizzle_seq<float2,float4,0>::swizzle(_FuncrandomTickrandom_float4Tick4481839910559189099_e5ca45668bfef954(__context__,das_global<int4,0xea7c638ab792363c>(__context__) /*RAND_SEED*/)) /*xy*/,*__context__,nullptr)),__invWH_rename_at_276_108,*__context__,nullptr)));
+                            SimPolicy<float3>::SetAdd((char *)&(__col_rename_at_283_114),trace_120442582fae608e(__context__,das_arg<path_tracer::Ray>::pass((_temp_make_local_286_30_0 = (getRay_24de5c4530e73005(__context__,__cam_rename_at_275_107,v_extract_x(__uv_rename_at_285_116) /*x*/,v_extract_y(__uv_rename_at_285_116) /*y*/)))),__rayCount_rename_at_278_110),*__context__,nullptr);
+                        }
+                        __s_iterator.close(__context__,(__s_rename_at_284_115));
+                    };
+                    SimPolicy<float3>::SetMulScal((char *)&(__col_rename_at_283_114),cast<float>::from(3.125000e-02f),*__context__,nullptr);
+                    das_copy(__backbuffer_rename_at_275_106(__backbufferIdx_rename_at_279_111,__context__),SimPolicy<float3>::Lerp(__col_rename_at_283_114,__backbuffer_rename_at_275_106(__backbufferIdx_rename_at_279_111,__context__),__lerpFac_rename_at_277_109,*__context__,nullptr));
+                    ++__backbufferIdx_rename_at_279_111;
+                }
+                __x_iterator.close(__context__,(__x_rename_at_282_113));
+            };
+        }
+        __y_iterator.close(__context__,(__y_rename_at_280_112));
+    };
+    return das_auto_cast<int32_t>::cast(__rayCount_rename_at_278_110);
+}
+
+inline float3 draw_ray_c4d9198ff88364e4 ( Context * __context__, int32_t __x_rename_at_296_117, int32_t __y_rename_at_296_118, int32_t __screenWidth_rename_at_296_119, int32_t __screenHeight_rename_at_296_120 )
+{
+    int32_t __rayCount_rename_at_297_121 = 0;
+    path_tracer::Camera __cam_rename_at_302_122_ConstRef = ((path_tracer::Camera)Camera_16837ac7f22e0a5d(__context__,v_make_vec4f(0.000000e+00f,2.000000e+00f,3.000000e+00f,0.f),v_zero(),v_make_vec4f(0.000000e+00f,1.000000e+00f,0.000000e+00f,0.f),6.000000e+01f,SimPolicy<float>::Div(float(__screenWidth_rename_at_296_119),float(__screenHeight_rename_at_296_120),*__context__,nullptr),1.000000e-01f,3.000000e+00f));
+    path_tracer::Camera const  & __cam_rename_at_302_122 = __cam_rename_at_302_122_ConstRef;
+;
+    float2 __invWH_rename_at_303_123 = ((float2)(SimPolicy<float2>::DivScalVec(cast<float>::from(1.000000e+00f),float2(__screenWidth_rename_at_296_119,__screenHeight_rename_at_296_120),*__context__,nullptr)));
+    float3 __col_rename_at_304_124 = v_zero();
+    {
+        bool __need_loop_305 = true;
+        // s: int const
+        das_iterator<range> __s_iterator(range(0,32));
+        int32_t __s_rename_at_305_125;
+        __need_loop_305 = __s_iterator.first(__context__,(__s_rename_at_305_125)) && __need_loop_305;
+        for ( ; __need_loop_305 ; __need_loop_305 = __s_iterator.next(__context__,(__s_rename_at_305_125)) )
+        {
+            path_tracer::Ray _temp_make_local_307_22_1; _temp_make_local_307_22_1;
+            float2 __uv_rename_at_306_126 = ((float2)(SimPolicy<float2>::Mul((SimPolicy<float2>::Add(float2(__x_rename_at_296_117,__y_rename_at_296_118),das_swizzle_seq<float2,float4,0>::swizzle(_FuncrandomTickrandom_float4Tick4481839910559189099_e5ca45668bfef954(__context__,das_global<int4,0xea7c638ab792363c>(__context__) /*RAND_SEED*/)) /*xy*/,*__context__,nullptr)),__invWH_rename_at_303_123,*__context__,nullptr)));
+            SimPolicy<float3>::SetAdd((char *)&(__col_rename_at_304_124),trace_120442582fae608e(__context__,das_arg<path_tracer::Ray>::pass((_temp_make_local_307_22_1 = (getRay_24de5c4530e73005(__context__,__cam_rename_at_302_122,v_extract_x(__uv_rename_at_306_126) /*x*/,v_extract_y(__uv_rename_at_306_126) /*y*/)))),__rayCount_rename_at_297_121),*__context__,nullptr);
+        }
+        __s_iterator.close(__context__,(__s_rename_at_305_125));
+    };
+    SimPolicy<float3>::SetMulScal((char *)&(__col_rename_at_304_124),cast<float>::from(3.125000e-02f),*__context__,nullptr);
+    return das_auto_cast<float3>::cast(__col_rename_at_304_124);
+}
+
+inline void draw_dbb37f448bd40650 ( Context * __context__, int32_t __frameCount_rename_at_313_127, int32_t __screenWidth_rename_at_313_128, int32_t __screenHeight_rename_at_313_129, int32_t __ymin_rename_at_313_130, int32_t __ymax_rename_at_313_131, TArray<float3> &  __backbuffer_rename_at_313_132, int32_t & __outRayCount_rename_at_313_133 )
+{
+    int32_t __rayCount_rename_at_314_134 = 0;
+    path_tracer::Camera __cam_rename_at_319_135_ConstRef = ((path_tracer::Camera)Camera_16837ac7f22e0a5d(__context__,v_make_vec4f(0.000000e+00f,2.000000e+00f,3.000000e+00f,0.f),v_zero(),v_make_vec4f(0.000000e+00f,1.000000e+00f,0.000000e+00f,0.f),6.000000e+01f,SimPolicy<float>::Div(float(__screenWidth_rename_at_313_128),float(__screenHeight_rename_at_313_129),*__context__,nullptr),1.000000e-01f,3.000000e+00f));
+    path_tracer::Camera const  & __cam_rename_at_319_135 = __cam_rename_at_319_135_ConstRef;
+;
+    __rayCount_rename_at_314_134 += trace_a34aff2a1fee6414(__context__,__screenWidth_rename_at_313_128,__screenHeight_rename_at_313_129,__frameCount_rename_at_313_127,__ymin_rename_at_313_130,__ymax_rename_at_313_131,das_arg<TArray<float3>>::pass(__backbuffer_rename_at_313_132),__cam_rename_at_319_135);
+    das_copy(__outRayCount_rename_at_313_133,__rayCount_rename_at_314_134);
+}
+static vec4f __wrap__FuncrandomTickrandom_int4Tick14264036843134477957_ffdc2fe91519deea ( Context * __context__ ) {
+    int4 & arg_seed = cast_aot_arg<int4 &>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int4>::from(_FuncrandomTickrandom_int4Tick14264036843134477957_ffdc2fe91519deea(__context__, arg_seed));
+}
+static vec4f __wrap__FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2 ( Context * __context__ ) {
+    int4 & arg_seed = cast_aot_arg<int4 &>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(_FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2(__context__, arg_seed));
+}
+static vec4f __wrap__FuncrandomTickrandom_in_unit_diskTick7298328615566574411_597b6a3f1f3487c6 ( Context * __context__ ) {
+    int4 & arg_seed = cast_aot_arg<int4 &>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<float3>::from(_FuncrandomTickrandom_in_unit_diskTick7298328615566574411_597b6a3f1f3487c6(__context__, arg_seed));
+}
+static vec4f __wrap__FuncrandomTickrandom_unit_vectorTick10283509794340149997_23912c6d066cf131 ( Context * __context__ ) {
+    int4 & arg_seed = cast_aot_arg<int4 &>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<float3>::from(_FuncrandomTickrandom_unit_vectorTick10283509794340149997_23912c6d066cf131(__context__, arg_seed));
+}
+static vec4f __wrap__FuncrandomTickrandom_float4Tick4481839910559189099_e5ca45668bfef954 ( Context * __context__ ) {
+    int4 & arg_seed = cast_aot_arg<int4 &>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<float4>::from(_FuncrandomTickrandom_float4Tick4481839910559189099_e5ca45668bfef954(__context__, arg_seed));
+}
+static vec4f __wrap__FuncrandomTickrandom_in_unit_sphereTick1529226019628612063_7dae8c455cb4217f ( Context * __context__ ) {
+    int4 & arg_seed = cast_aot_arg<int4 &>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<float3>::from(_FuncrandomTickrandom_in_unit_sphereTick1529226019628612063_7dae8c455cb4217f(__context__, arg_seed));
+}
+static vec4f __wrap__FuncrandomTickrandom_floatTick8212455123483466034_5ae2aaa8aa5a899a ( Context * __context__ ) {
+    int4 & arg_seed = cast_aot_arg<int4 &>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<float>::from(_FuncrandomTickrandom_floatTick8212455123483466034_5ae2aaa8aa5a899a(__context__, arg_seed));
+}
+static vec4f __wrap__FuncrandomTickrandom_seedTick15287272150245073176_6991510ddb1b5a99 ( Context * __context__ ) {
+    int32_t arg_seed = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int4>::from(_FuncrandomTickrandom_seedTick15287272150245073176_6991510ddb1b5a99(__context__, arg_seed));
+}
+static vec4f __wrap_schlick_84664ab0038b218a ( Context * __context__ ) {
+    float arg_cosine = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[0]);
+    float arg_ri = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<float>::from(schlick_84664ab0038b218a(__context__, arg_cosine, arg_ri));
+}
+static vec4f __wrap_pointAt_c9382d5b86c7ca5b ( Context * __context__ ) {
+    path_tracer::Ray const  &  arg_ray = cast_aot_arg<path_tracer::Ray const  & >::to(*__context__,__context__->abiArguments()[0]);
+    float arg_t = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<float3>::from(pointAt_c9382d5b86c7ca5b(__context__, arg_ray, arg_t));
+}
+static vec4f __wrap_Camera_16837ac7f22e0a5d ( Context * __context__ ) {
+    float3 arg_lookFrom = cast_aot_arg<float3>::to(*__context__,__context__->abiArguments()[0]);
+    float3 arg_lookAt = cast_aot_arg<float3>::to(*__context__,__context__->abiArguments()[1]);
+    float3 arg_vup = cast_aot_arg<float3>::to(*__context__,__context__->abiArguments()[2]);
+    float arg_vfov = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[3]);
+    float arg_aspect = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[4]);
+    float arg_aperture = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[5]);
+    float arg_focusDist = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[6]);
+    *((path_tracer::Camera *) __context__->abiCMRES) = Camera_16837ac7f22e0a5d(__context__, arg_lookFrom, arg_lookAt, arg_vup, arg_vfov, arg_aspect, arg_aperture, arg_focusDist);
+    return v_zero();
+}
+static vec4f __wrap_getRay_24de5c4530e73005 ( Context * __context__ ) {
+    path_tracer::Camera const  &  arg_that = cast_aot_arg<path_tracer::Camera const  & >::to(*__context__,__context__->abiArguments()[0]);
+    float arg_s = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[1]);
+    float arg_t = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[2]);
+    *((path_tracer::Ray *) __context__->abiCMRES) = getRay_24de5c4530e73005(__context__, arg_that, arg_s, arg_t);
+    return v_zero();
+}
+static vec4f __wrap_init_path_tracer_7c703c4419d2f88f ( Context * __context__ ) {
+    init_path_tracer_7c703c4419d2f88f(__context__);
+    return v_zero();
+}
+static vec4f __wrap_hitSpheres_ba244bb7803a3fe4 ( Context * __context__ ) {
+    path_tracer::Ray const  &  arg_r = cast_aot_arg<path_tracer::Ray const  & >::to(*__context__,__context__->abiArguments()[0]);
+    float arg_tMin = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[1]);
+    float arg_tMax = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[2]);
+    path_tracer::Hit &  arg_outHit = cast_aot_arg<path_tracer::Hit & >::to(*__context__,__context__->abiArguments()[3]);
+    return cast<int32_t>::from(hitSpheres_ba244bb7803a3fe4(__context__, arg_r, arg_tMin, arg_tMax, arg_outHit));
+}
+static vec4f __wrap_hitWorld_1ce139fb62bc7860 ( Context * __context__ ) {
+    path_tracer::Ray const  &  arg_r = cast_aot_arg<path_tracer::Ray const  & >::to(*__context__,__context__->abiArguments()[0]);
+    float arg_tMin = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[1]);
+    float arg_tMax = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[2]);
+    path_tracer::Hit &  arg_outHit = cast_aot_arg<path_tracer::Hit & >::to(*__context__,__context__->abiArguments()[3]);
+    int32_t & arg_outID = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[4]);
+    return cast<bool>::from(hitWorld_1ce139fb62bc7860(__context__, arg_r, arg_tMin, arg_tMax, arg_outHit, arg_outID));
+}
+static vec4f __wrap_scatter_433475002aa1f3c6 ( Context * __context__ ) {
+    path_tracer::Material const  &  arg_mat = cast_aot_arg<path_tracer::Material const  & >::to(*__context__,__context__->abiArguments()[0]);
+    path_tracer::Ray const  &  arg_r_in = cast_aot_arg<path_tracer::Ray const  & >::to(*__context__,__context__->abiArguments()[1]);
+    path_tracer::Hit const  &  arg_rec = cast_aot_arg<path_tracer::Hit const  & >::to(*__context__,__context__->abiArguments()[2]);
+    float3 & arg_attenuation = cast_aot_arg<float3 &>::to(*__context__,__context__->abiArguments()[3]);
+    path_tracer::Ray &  arg_scattered = cast_aot_arg<path_tracer::Ray & >::to(*__context__,__context__->abiArguments()[4]);
+    float3 & arg_outLightE = cast_aot_arg<float3 &>::to(*__context__,__context__->abiArguments()[5]);
+    int32_t & arg_inoutRayCount = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[6]);
+    return cast<bool>::from(scatter_433475002aa1f3c6(__context__, arg_mat, arg_r_in, arg_rec, arg_attenuation, arg_scattered, arg_outLightE, arg_inoutRayCount));
+}
+static vec4f __wrap_trace_120442582fae608e ( Context * __context__ ) {
+    path_tracer::Ray const  &  arg_r = cast_aot_arg<path_tracer::Ray const  & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg_inoutRayCount = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<float3>::from(trace_120442582fae608e(__context__, arg_r, arg_inoutRayCount));
+}
+static vec4f __wrap_trace_a34aff2a1fee6414 ( Context * __context__ ) {
+    int32_t arg_screenWidth = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_screenHeight = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_frameCount = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    int32_t arg_ymin = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[3]);
+    int32_t arg_ymax = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[4]);
+    TArray<float3> &  arg_backbuffer = cast_aot_arg<TArray<float3> & >::to(*__context__,__context__->abiArguments()[5]);
+    path_tracer::Camera const  &  arg_cam = cast_aot_arg<path_tracer::Camera const  & >::to(*__context__,__context__->abiArguments()[6]);
+    return cast<int32_t>::from(trace_a34aff2a1fee6414(__context__, arg_screenWidth, arg_screenHeight, arg_frameCount, arg_ymin, arg_ymax, arg_backbuffer, arg_cam));
+}
+static vec4f __wrap_draw_ray_c4d9198ff88364e4 ( Context * __context__ ) {
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_y = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_screenWidth = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    int32_t arg_screenHeight = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[3]);
+    return cast<float3>::from(draw_ray_c4d9198ff88364e4(__context__, arg_x, arg_y, arg_screenWidth, arg_screenHeight));
+}
+static vec4f __wrap_draw_dbb37f448bd40650 ( Context * __context__ ) {
+    int32_t arg_frameCount = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_screenWidth = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_screenHeight = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    int32_t arg_ymin = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[3]);
+    int32_t arg_ymax = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[4]);
+    TArray<float3> &  arg_backbuffer = cast_aot_arg<TArray<float3> & >::to(*__context__,__context__->abiArguments()[5]);
+    int32_t & arg_outRayCount = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[6]);
+    draw_dbb37f448bd40650(__context__, arg_frameCount, arg_screenWidth, arg_screenHeight, arg_ymin, arg_ymax, arg_backbuffer, arg_outRayCount);
+    return v_zero();
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x5f7f6ad00f9774c4, false, (void*)&_FuncrandomTickrandom_int4Tick14264036843134477957_ffdc2fe91519deea, &__wrap__FuncrandomTickrandom_int4Tick14264036843134477957_ffdc2fe91519deea },
+    { 0xadb43fc11a384c17, false, (void*)&_FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2, &__wrap__FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2 },
+    { 0x12e7be3309cdcca1, false, (void*)&_FuncrandomTickrandom_in_unit_diskTick7298328615566574411_597b6a3f1f3487c6, &__wrap__FuncrandomTickrandom_in_unit_diskTick7298328615566574411_597b6a3f1f3487c6 },
+    { 0xc2794ea1a6b5befc, false, (void*)&_FuncrandomTickrandom_unit_vectorTick10283509794340149997_23912c6d066cf131, &__wrap__FuncrandomTickrandom_unit_vectorTick10283509794340149997_23912c6d066cf131 },
+    { 0xc78ea0caaeb9f8b8, false, (void*)&_FuncrandomTickrandom_float4Tick4481839910559189099_e5ca45668bfef954, &__wrap__FuncrandomTickrandom_float4Tick4481839910559189099_e5ca45668bfef954 },
+    { 0xdcaa9002bc5009ed, false, (void*)&_FuncrandomTickrandom_in_unit_sphereTick1529226019628612063_7dae8c455cb4217f, &__wrap__FuncrandomTickrandom_in_unit_sphereTick1529226019628612063_7dae8c455cb4217f },
+    { 0x1815596f12c46375, false, (void*)&_FuncrandomTickrandom_floatTick8212455123483466034_5ae2aaa8aa5a899a, &__wrap__FuncrandomTickrandom_floatTick8212455123483466034_5ae2aaa8aa5a899a },
+    { 0xfd37050dd7eb860a, false, (void*)&_FuncrandomTickrandom_seedTick15287272150245073176_6991510ddb1b5a99, &__wrap__FuncrandomTickrandom_seedTick15287272150245073176_6991510ddb1b5a99 },
+    { 0x5519509e094e153d, false, (void*)&schlick_84664ab0038b218a, &__wrap_schlick_84664ab0038b218a },
+    { 0xbb871bce469a84d8, false, (void*)&pointAt_c9382d5b86c7ca5b, &__wrap_pointAt_c9382d5b86c7ca5b },
+    { 0xce76b72baf5a2ca7, true, (void*)&Camera_16837ac7f22e0a5d, &__wrap_Camera_16837ac7f22e0a5d },
+    { 0x2b3f2fafb06fdaad, true, (void*)&getRay_24de5c4530e73005, &__wrap_getRay_24de5c4530e73005 },
+    { 0xfa0a0295254b5b0f, false, (void*)&init_path_tracer_7c703c4419d2f88f, &__wrap_init_path_tracer_7c703c4419d2f88f },
+    { 0xff70a361a0577052, false, (void*)&hitSpheres_ba244bb7803a3fe4, &__wrap_hitSpheres_ba244bb7803a3fe4 },
+    { 0x3a9ceae7fd4f1ad8, false, (void*)&hitWorld_1ce139fb62bc7860, &__wrap_hitWorld_1ce139fb62bc7860 },
+    { 0xbb9a5882ccf034d0, false, (void*)&scatter_433475002aa1f3c6, &__wrap_scatter_433475002aa1f3c6 },
+    { 0xf16c42daa6418d40, false, (void*)&trace_120442582fae608e, &__wrap_trace_120442582fae608e },
+    { 0x2837ed07fe331833, false, (void*)&trace_a34aff2a1fee6414, &__wrap_trace_a34aff2a1fee6414 },
+    { 0x99b10086649bb172, false, (void*)&draw_ray_c4d9198ff88364e4, &__wrap_draw_ray_c4d9198ff88364e4 },
+    { 0x32f6b507139f7ac1, false, (void*)&draw_dbb37f448bd40650, &__wrap_draw_dbb37f448bd40650 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x4fadad37aec93f97, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_4365735003226613802
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
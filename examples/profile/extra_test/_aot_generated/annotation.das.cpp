@@ -0,0 +1,390 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require testProfile
+#include "test_profile.h"
+ // require annotation
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_18235249711103788167 {
+
+extern TypeInfo __type_info__af63eb4c86020609;
+
+FuncInfo __func_info__955909f57bd61177 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x955909f57bd61177), 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+template<typename BT>
+inline uint32_t __query_es_pos1212_r_vel1212_r ( uint64_t /*annotationData*/, const BT & block, Context * __context, LineInfoArg * __at )
+{
+	for ( uint32_t i=0; i != g_total; ++i ) {
+		block((*g_pos)[i],(*g_vel)[i]);
+	}
+	return g_total;
+}
+
+template<typename BT>
+inline uint32_t __query_es_pos1212_r_vel1212 ( uint64_t /*annotationData*/, const BT & block, Context * __context, LineInfoArg * __at )
+{
+	for ( uint32_t i=0; i != g_total; ++i ) {
+		block((*g_pos)[i],(*g_vel)[i]);
+	}
+	return g_total;
+}
+
+template<typename BT>
+inline uint32_t __query_es_pos1212_r_vel1212_r_dt_null4 ( uint64_t /*annotationData*/, const BT & block, Context * __context, LineInfoArg * __at )
+{
+	for ( uint32_t i=0; i != g_total; ++i ) {
+		block((*g_pos)[i],(*g_vel)[i],1.000000e+00f);
+	}
+	return g_total;
+}
+
+template<typename BT>
+inline uint32_t __query_es_some_name_null8 ( uint64_t /*annotationData*/, const BT & block, Context * __context, LineInfoArg * __at )
+{
+	for ( uint32_t i=0; i != g_total; ++i ) {
+		block("no_name");
+	}
+	return g_total;
+}
+
+template<typename BT>
+inline uint32_t __query_es_pos1212_r_vel1212_defT_null4 ( uint64_t /*annotationData*/, const BT & block, Context * __context, LineInfoArg * __at )
+{
+	for ( uint32_t i=0; i != g_total; ++i ) {
+		block((*g_pos)[i],(*g_vel)[i],5.000000e-01f);
+	}
+	return g_total;
+}
+
+template<typename BT>
+inline uint32_t __query_es_pos1212_r ( uint64_t /*annotationData*/, const BT & block, Context * __context, LineInfoArg * __at )
+{
+	for ( uint32_t i=0; i != g_total; ++i ) {
+		block((*g_pos)[i]);
+	}
+	return g_total;
+}
+
+
+inline void update_d2539d6bab21938d ( Context * __context__ );
+inline void update2_c3068a6b791fea83 ( Context * __context__ );
+inline void update3_1b27413f8ed9ac70 ( Context * __context__ );
+inline void update4_55d4449630a57a72 ( Context * __context__ );
+inline void queryOne_9fc65c1ec3449304 ( Context * __context__, float __dt_rename_at_31_8 );
+inline void queryTwo_3c9a48ac497b22a9 ( Context * __context__, float __dt_rename_at_37_11 );
+inline void queryThree_b15cf70dc7115636 ( Context * __context__ );
+inline void main_ea90f02317bde14d ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void update_d2539d6bab21938d ( Context * __context__ )
+{
+    __query_es_pos1212_r_vel1212_r(__context__->adBySid(1097923473743465675u),[&](float3 & __pos_rename_at_11_0, float3 const  & __vel_rename_at_11_1) DAS_AOT_INLINE_LAMBDA -> void{
+        SimPolicy<float3>::SetAdd((char *)&(__pos_rename_at_11_0),__vel_rename_at_11_1,*__context__,nullptr);
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void update2_c3068a6b791fea83 ( Context * __context__ )
+{
+    __query_es_pos1212_r_vel1212(__context__->adBySid(14592854995283255610u),[&](float3 & __pos_rename_at_17_2, float3 __vel_rename_at_17_3) DAS_AOT_INLINE_LAMBDA -> void{
+
+#if 0
+v_make_vec4f(1.000000e+00f,2.000000e+00f,3.000000e+00f,0.f)
+#endif
+        SimPolicy<float3>::SetAdd((char *)&(__pos_rename_at_17_2),__vel_rename_at_17_3,*__context__,nullptr);
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void update3_1b27413f8ed9ac70 ( Context * __context__ )
+{
+    __query_es_pos1212_r_vel1212_r_dt_null4(__context__->adBySid(8399029398500854791u),[&](float3 & __pos_rename_at_22_4, float3 const  & __vel_rename_at_22_5, float const  __dt_rename_at_22_6) DAS_AOT_INLINE_LAMBDA -> void{
+
+#if 0
+1.000000e+00f
+#endif
+        SimPolicy<float3>::SetAdd((char *)&(__pos_rename_at_22_4),(SimPolicy<float3>::MulVecScal(__vel_rename_at_22_5,cast<float>::from(__dt_rename_at_22_6),*__context__,nullptr)),*__context__,nullptr);
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void update4_55d4449630a57a72 ( Context * __context__ )
+{
+    __query_es_some_name_null8(__context__->adBySid(7438811159537566656u),[&](char * const  __some_name_rename_at_27_7) DAS_AOT_INLINE_LAMBDA -> void{
+
+#if 0
+((char *) "no_name")
+#endif
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__some_name_rename_at_27_7),cast<char *>::from(((char *) "no_name")),*__context__,nullptr)));
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void queryOne_9fc65c1ec3449304 ( Context * __context__, float __dt_rename_at_31_8 )
+{
+    __query_es_pos1212_r_vel1212(__context__->adBySid(4434544752271362657u),[&](float3 & __pos_rename_at_32_9, float3 __vel_rename_at_32_10) DAS_AOT_INLINE_LAMBDA -> void{
+        SimPolicy<float3>::SetAdd((char *)&(__pos_rename_at_32_9),(SimPolicy<float3>::MulVecScal(__vel_rename_at_32_10,cast<float>::from(__dt_rename_at_31_8),*__context__,nullptr)),*__context__,nullptr);
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void queryTwo_3c9a48ac497b22a9 ( Context * __context__, float __dt_rename_at_37_11 )
+{
+    __query_es_pos1212_r_vel1212_defT_null4(__context__->adBySid(6354997640935647895u),[&](float3 & __pos_rename_at_38_12, float3 __vel_rename_at_38_13, float const  __defT_rename_at_38_14) DAS_AOT_INLINE_LAMBDA -> void{
+
+#if 0
+5.000000e-01f
+#endif
+        SimPolicy<float3>::SetAdd((char *)&(__pos_rename_at_38_12),(SimPolicy<float3>::MulVecScal(__vel_rename_at_38_13,cast<float>::from((__defT_rename_at_38_14 + __dt_rename_at_37_11)),*__context__,nullptr)),*__context__,nullptr);
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void queryThree_b15cf70dc7115636 ( Context * __context__ )
+{
+    int32_t __count_rename_at_44_15 = 0;
+    das_try_recover(__context__, [&]()
+    {
+        __query_es_pos1212_r(__context__->adBySid(7884067792649401522u),[&](float3 const  & __pos_rename_at_46_16) DAS_AOT_INLINE_LAMBDA -> void{
+            __query_es_pos1212_r(__context__->adBySid(7884067792649401522u),[&](float3 const  & __pos_rename_at_47_17) DAS_AOT_INLINE_LAMBDA -> void{
+                if ( SimPolicy<float3>::Equ(__pos_rename_at_46_16,__pos_rename_at_47_17,*__context__,nullptr) )
+                {
+                    ++__count_rename_at_44_15;
+                    if ( __count_rename_at_44_15 == 100 )
+                    {
+                        builtin_throw(((char *) "enough"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+                    };
+                };
+            },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    }, [&]()
+    {
+        DAS_ASSERT((__count_rename_at_44_15 == 100));
+    });
+}
+
+inline void main_ea90f02317bde14d ( Context * __context__ ) { das_stack_prologue __prologue(__context__,96,"main " DAS_FILE_LINE);
+{
+    initEsComponents();
+    testEsUpdate(((char *) "ks"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    verifyEsComponents(__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    initEsComponents();
+    testEsUpdate(((char *) "ks2"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    verifyEsComponents(__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    initEsComponents();
+    testEsUpdate(((char *) "ks3"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    verifyEsComponents(__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    initEsComponents();
+    queryOne_9fc65c1ec3449304(__context__,1.000000e+00f);
+    verifyEsComponents(__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    initEsComponents();
+    queryTwo_3c9a48ac497b22a9(__context__,5.000000e-01f);
+    verifyEsComponents(__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    initEsComponents();
+    builtin_profile(20,((char *) "es-update"),das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        {
+            bool __need_loop_80 = true;
+            // i: int const
+            das_iterator<range> __i_iterator(range(0,100));
+            int32_t __i_rename_at_80_18;
+            __need_loop_80 = __i_iterator.first(__context__,(__i_rename_at_80_18)) && __need_loop_80;
+            for ( ; __need_loop_80 ; __need_loop_80 = __i_iterator.next(__context__,(__i_rename_at_80_18)) )
+            {
+                testEsUpdate(((char *) "ks"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+            }
+            __i_iterator.close(__context__,(__i_rename_at_80_18));
+        };
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    builtin_profile(20,((char *) "es-update-ref"),das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        {
+            bool __need_loop_85 = true;
+            // i: int const
+            das_iterator<range> __i_iterator(range(0,100));
+            int32_t __i_rename_at_85_19;
+            __need_loop_85 = __i_iterator.first(__context__,(__i_rename_at_85_19)) && __need_loop_85;
+            for ( ; __need_loop_85 ; __need_loop_85 = __i_iterator.next(__context__,(__i_rename_at_85_19)) )
+            {
+                testEsUpdate(((char *) "ks2"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+            }
+            __i_iterator.close(__context__,(__i_rename_at_85_19));
+        };
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    builtin_profile(20,((char *) "es-update-ref-const"),das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        {
+            bool __need_loop_90 = true;
+            // i: int const
+            das_iterator<range> __i_iterator(range(0,100));
+            int32_t __i_rename_at_90_20;
+            __need_loop_90 = __i_iterator.first(__context__,(__i_rename_at_90_20)) && __need_loop_90;
+            for ( ; __need_loop_90 ; __need_loop_90 = __i_iterator.next(__context__,(__i_rename_at_90_20)) )
+            {
+                testEsUpdate(((char *) "ks3"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+            }
+            __i_iterator.close(__context__,(__i_rename_at_90_20));
+        };
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    builtin_profile(20,((char *) "es-update-def-string"),das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        {
+            bool __need_loop_95 = true;
+            // i: int const
+            das_iterator<range> __i_iterator(range(0,100));
+            int32_t __i_rename_at_95_21;
+            __need_loop_95 = __i_iterator.first(__context__,(__i_rename_at_95_21)) && __need_loop_95;
+            for ( ; __need_loop_95 ; __need_loop_95 = __i_iterator.next(__context__,(__i_rename_at_95_21)) )
+            {
+                testEsUpdate(((char *) "ks4"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+            }
+            __i_iterator.close(__context__,(__i_rename_at_95_21));
+        };
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    builtin_profile(20,((char *) "es-query-1"),das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        {
+            bool __need_loop_100 = true;
+            // i: int const
+            das_iterator<range> __i_iterator(range(0,100));
+            int32_t __i_rename_at_100_22;
+            __need_loop_100 = __i_iterator.first(__context__,(__i_rename_at_100_22)) && __need_loop_100;
+            for ( ; __need_loop_100 ; __need_loop_100 = __i_iterator.next(__context__,(__i_rename_at_100_22)) )
+            {
+                queryOne_9fc65c1ec3449304(__context__,1.000000e+00f);
+            }
+            __i_iterator.close(__context__,(__i_rename_at_100_22));
+        };
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    builtin_profile(20,((char *) "es-query-2"),das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        {
+            bool __need_loop_105 = true;
+            // i: int const
+            das_iterator<range> __i_iterator(range(0,100));
+            int32_t __i_rename_at_105_23;
+            __need_loop_105 = __i_iterator.first(__context__,(__i_rename_at_105_23)) && __need_loop_105;
+            for ( ; __need_loop_105 ; __need_loop_105 = __i_iterator.next(__context__,(__i_rename_at_105_23)) )
+            {
+                queryTwo_3c9a48ac497b22a9(__context__,5.000000e-01f);
+            }
+            __i_iterator.close(__context__,(__i_rename_at_105_23));
+        };
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    builtin_profile(20,((char *) "es-query-3"),das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        queryThree_b15cf70dc7115636(__context__);
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    releaseEsComponents();
+}}
+static vec4f __wrap_update_d2539d6bab21938d ( Context * __context__ ) {
+    update_d2539d6bab21938d(__context__);
+    return v_zero();
+}
+static vec4f __wrap_update2_c3068a6b791fea83 ( Context * __context__ ) {
+    update2_c3068a6b791fea83(__context__);
+    return v_zero();
+}
+static vec4f __wrap_update3_1b27413f8ed9ac70 ( Context * __context__ ) {
+    update3_1b27413f8ed9ac70(__context__);
+    return v_zero();
+}
+static vec4f __wrap_update4_55d4449630a57a72 ( Context * __context__ ) {
+    update4_55d4449630a57a72(__context__);
+    return v_zero();
+}
+static vec4f __wrap_queryOne_9fc65c1ec3449304 ( Context * __context__ ) {
+    float arg_dt = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[0]);
+    queryOne_9fc65c1ec3449304(__context__, arg_dt);
+    return v_zero();
+}
+static vec4f __wrap_queryTwo_3c9a48ac497b22a9 ( Context * __context__ ) {
+    float arg_dt = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[0]);
+    queryTwo_3c9a48ac497b22a9(__context__, arg_dt);
+    return v_zero();
+}
+static vec4f __wrap_queryThree_b15cf70dc7115636 ( Context * __context__ ) {
+    queryThree_b15cf70dc7115636(__context__);
+    return v_zero();
+}
+static vec4f __wrap_main_ea90f02317bde14d ( Context * __context__ ) {
+    main_ea90f02317bde14d(__context__);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xae112fde30353b29, false, (void*)&update_d2539d6bab21938d, &__wrap_update_d2539d6bab21938d },
+    { 0x59694c5509c96db9, false, (void*)&update2_c3068a6b791fea83, &__wrap_update2_c3068a6b791fea83 },
+    { 0xc83698fd132a128, false, (void*)&update3_1b27413f8ed9ac70, &__wrap_update3_1b27413f8ed9ac70 },
+    { 0x707553a0a3cd8335, false, (void*)&update4_55d4449630a57a72, &__wrap_update4_55d4449630a57a72 },
+    { 0x66538b95eb5a442e, false, (void*)&queryOne_9fc65c1ec3449304, &__wrap_queryOne_9fc65c1ec3449304 },
+    { 0x3f8cf1b38fd4f028, false, (void*)&queryTwo_3c9a48ac497b22a9, &__wrap_queryTwo_3c9a48ac497b22a9 },
+    { 0xf842fcc7139e8b72, false, (void*)&queryThree_b15cf70dc7115636, &__wrap_queryThree_b15cf70dc7115636 },
+    { 0x9ed339a3d0abd824, false, (void*)&main_ea90f02317bde14d, &__wrap_main_ea90f02317bde14d },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_18235249711103788167
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
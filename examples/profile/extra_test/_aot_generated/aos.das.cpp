@@ -0,0 +1,564 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_7517188437568416371 {
+
+namespace  { struct NObject; };
+namespace  {
+
+struct NObject {
+    float3 position;
+    float3 velocity;
+};
+static_assert(sizeof(NObject)==24,"structure size mismatch with DAS");
+static_assert(offsetof(NObject,position)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(NObject,velocity)==12,"structure field offset mismatch with DAS");
+}
+extern TypeInfo __type_info__af85fe4c863bec52;
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __func_info__f977874d9d78ec4d_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~$::dasvector`int"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 24, UINT64_C(0x56c635c53436c134), "arr", 0, 0 };
+VarInfo * __func_info__f977874d9d78ec4d_fields[1] =  { &__func_info__f977874d9d78ec4d_field_0 };
+FuncInfo __func_info__f977874d9d78ec4d = {"invoke block<(arr:$::dasvector`int const):void> const", "", __func_info__f977874d9d78ec4d_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xf977874d9d78ec4d), 0x0 };
+FuncInfo __func_info__955909f57bd61177 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x955909f57bd61177), 0x0 };
+TypeInfo __type_info__af85fe4c863bec52 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf85fe4c863bec52) };
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[3] = { &__type_info__af90fe4c864e9d52, &__type_info__af85fe4c863bec52, &__type_info__af90fe4c864e9d52 };
+
+inline bool perks_disabler_unset_es_411b6ceef1a08d57 ( Context * __context__, ObjectArray & __game_effect_dot_allowedMods_rename_at_7_0, ObjectArray & __allowedMods_rename_at_7_1 );
+inline void update_f62040b42e73921f ( Context * __context__, NObject & __a_rename_at_26_4 );
+inline void testSim_493787f195cd494a ( Context * __context__, TDim<NObject,10000> & __objects_rename_at_30_5 );
+inline void testSimI_de4d2cf76582deb9 ( Context * __context__, TDim<NObject,10000> & __objects_rename_at_36_7 );
+inline void ks_update_a6dc79d0ee278169 ( Context * __context__, float3 & __pos_rename_at_43_9, float3 __vel_rename_at_43_10 );
+inline void update_80c3983bfd8e6565 ( Context * __context__, Object & __a_rename_at_48_11 );
+inline void testSim_db4a14236b347c9e ( Context * __context__, ObjectArray & __objects_rename_at_52_12 );
+inline void testSimI_7e5acc33c54774a9 ( Context * __context__, ObjectArray & __objects_rename_at_58_14 );
+inline void testInterop_6ac6f92c709a6e3a ( Context * __context__, ObjectArray & __objects_rename_at_64_16 );
+inline void initObj_e7f91526ed80644f ( Context * __context__, int32_t __i_rename_at_70_18, Object & __a_rename_at_70_19 );
+inline void initObj_7b07be48e960decd ( Context * __context__, int32_t __i_rename_at_75_20, NObject & __a_rename_at_75_21 );
+inline void init_49a93c1a4c9ce180 ( Context * __context__, ObjectArray & __objects_rename_at_80_22 );
+inline void init_ec2261d0a6ed9b88 ( Context * __context__, TDim<NObject,10000> & __objects_rename_at_88_25 );
+inline void verifyManagedInt_655f9df9a66c1076 ( Context * __context__ );
+inline void main_be2b405fca1e1319 ( Context * __context__ );
+inline void test_8257e0285184f0ba ( Context * __context__, ObjectArray & __objects_rename_at_138_35 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global_zero<TDim<NObject,10000>,0x41e1f349c480a079>(__context__);/*nobjects*/
+}
+
+inline bool perks_disabler_unset_es_411b6ceef1a08d57 ( Context * __context__, ObjectArray &  __game_effect_dot_allowedMods_rename_at_7_0, ObjectArray &  __allowedMods_rename_at_7_1 )
+{
+    {
+        bool __need_loop_8 = true;
+        // perk: testProfile::Object&
+        das_iterator<ObjectArray> __perk_iterator(__game_effect_dot_allowedMods_rename_at_7_0);
+        Object * __perk_rename_at_8_2;
+        __need_loop_8 = __perk_iterator.first(__context__,(__perk_rename_at_8_2)) && __need_loop_8;
+        for ( ; __need_loop_8 ; __need_loop_8 = __perk_iterator.next(__context__,(__perk_rename_at_8_2)) )
+        {
+            {
+                bool __need_loop_9 = true;
+                // i: int const
+                das_iterator<range> __i_iterator(mk_range(das_vector_length(das_arg<ObjectArray>::pass(__allowedMods_rename_at_7_1))));
+                int32_t __i_rename_at_9_3;
+                __need_loop_9 = __i_iterator.first(__context__,(__i_rename_at_9_3)) && __need_loop_9;
+                for ( ; __need_loop_9 ; __need_loop_9 = __i_iterator.next(__context__,(__i_rename_at_9_3)) )
+                {
+                    if ( objEqu(das_arg<Object>::pass(das_index<ObjectArray>::at(__allowedMods_rename_at_7_1,__i_rename_at_9_3,__context__)),das_arg<Object>::pass((*__perk_rename_at_8_2))) )
+                    {
+                        return das_auto_cast<bool>::cast(true);
+                    };
+                }
+                __i_iterator.close(__context__,(__i_rename_at_9_3));
+            };
+        }
+        __perk_iterator.close(__context__,(__perk_rename_at_8_2));
+    };
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void update_f62040b42e73921f ( Context * __context__, NObject &  __a_rename_at_26_4 )
+{
+    SimPolicy<float3>::SetAdd((char *)&(__a_rename_at_26_4.position),__a_rename_at_26_4.velocity,*__context__,nullptr);
+}
+
+inline void testSim_493787f195cd494a ( Context * __context__, TDim<NObject,10000> &  __objects_rename_at_30_5 )
+{
+    {
+        bool __need_loop_31 = true;
+        // obj: NObject& -const
+        das_iterator<TDim<NObject,10000>> __obj_iterator(__objects_rename_at_30_5);
+        NObject * __obj_rename_at_31_6;
+        __need_loop_31 = __obj_iterator.first(__context__,(__obj_rename_at_31_6)) && __need_loop_31;
+        for ( ; __need_loop_31 ; __need_loop_31 = __obj_iterator.next(__context__,(__obj_rename_at_31_6)) )
+        {
+            update_f62040b42e73921f(__context__,das_arg<NObject>::pass((*__obj_rename_at_31_6)));
+        }
+        __obj_iterator.close(__context__,(__obj_rename_at_31_6));
+    };
+}
+
+inline void testSimI_de4d2cf76582deb9 ( Context * __context__, TDim<NObject,10000> &  __objects_rename_at_36_7 )
+{
+    {
+        bool __need_loop_37 = true;
+        // obj: NObject& -const
+        das_iterator<TDim<NObject,10000>> __obj_iterator(__objects_rename_at_36_7);
+        NObject * __obj_rename_at_37_8;
+        __need_loop_37 = __obj_iterator.first(__context__,(__obj_rename_at_37_8)) && __need_loop_37;
+        for ( ; __need_loop_37 ; __need_loop_37 = __obj_iterator.next(__context__,(__obj_rename_at_37_8)) )
+        {
+            SimPolicy<float3>::SetAdd((char *)&((*__obj_rename_at_37_8).position),(*__obj_rename_at_37_8).velocity,*__context__,nullptr);
+        }
+        __obj_iterator.close(__context__,(__obj_rename_at_37_8));
+    };
+}
+
+inline void ks_update_a6dc79d0ee278169 ( Context * __context__, float3 & __pos_rename_at_43_9, float3 __vel_rename_at_43_10 )
+{
+    SimPolicy<float3>::SetAdd((char *)&(__pos_rename_at_43_9),__vel_rename_at_43_10,*__context__,nullptr);
+}
+
+inline void update_80c3983bfd8e6565 ( Context * __context__, Object &  __a_rename_at_48_11 )
+{
+    SimPolicy<float3>::SetAdd((char *)&(__a_rename_at_48_11.pos /*position*/),__a_rename_at_48_11.vel /*velocity*/,*__context__,nullptr);
+}
+
+inline void testSim_db4a14236b347c9e ( Context * __context__, ObjectArray &  __objects_rename_at_52_12 )
+{
+    {
+        bool __need_loop_53 = true;
+        // obj: testProfile::Object&
+        das_iterator<ObjectArray> __obj_iterator(__objects_rename_at_52_12);
+        Object * __obj_rename_at_53_13;
+        __need_loop_53 = __obj_iterator.first(__context__,(__obj_rename_at_53_13)) && __need_loop_53;
+        for ( ; __need_loop_53 ; __need_loop_53 = __obj_iterator.next(__context__,(__obj_rename_at_53_13)) )
+        {
+            update_80c3983bfd8e6565(__context__,das_arg<Object>::pass((*__obj_rename_at_53_13)));
+        }
+        __obj_iterator.close(__context__,(__obj_rename_at_53_13));
+    };
+}
+
+inline void testSimI_7e5acc33c54774a9 ( Context * __context__, ObjectArray &  __objects_rename_at_58_14 )
+{
+    {
+        bool __need_loop_59 = true;
+        // obj: testProfile::Object&
+        das_iterator<ObjectArray> __obj_iterator(__objects_rename_at_58_14);
+        Object * __obj_rename_at_59_15;
+        __need_loop_59 = __obj_iterator.first(__context__,(__obj_rename_at_59_15)) && __need_loop_59;
+        for ( ; __need_loop_59 ; __need_loop_59 = __obj_iterator.next(__context__,(__obj_rename_at_59_15)) )
+        {
+            SimPolicy<float3>::SetAdd((char *)&((*__obj_rename_at_59_15).pos /*position*/),(*__obj_rename_at_59_15).vel /*velocity*/,*__context__,nullptr);
+        }
+        __obj_iterator.close(__context__,(__obj_rename_at_59_15));
+    };
+}
+
+inline void testInterop_6ac6f92c709a6e3a ( Context * __context__, ObjectArray &  __objects_rename_at_64_16 )
+{
+    {
+        bool __need_loop_65 = true;
+        // obj: testProfile::Object&
+        das_iterator<ObjectArray> __obj_iterator(__objects_rename_at_64_16);
+        Object * __obj_rename_at_65_17;
+        __need_loop_65 = __obj_iterator.first(__context__,(__obj_rename_at_65_17)) && __need_loop_65;
+        for ( ; __need_loop_65 ; __need_loop_65 = __obj_iterator.next(__context__,(__obj_rename_at_65_17)) )
+        {
+            updateObject(das_arg<Object>::pass((*__obj_rename_at_65_17)));
+        }
+        __obj_iterator.close(__context__,(__obj_rename_at_65_17));
+    };
+}
+
+inline void initObj_e7f91526ed80644f ( Context * __context__, int32_t __i_rename_at_70_18, Object &  __a_rename_at_70_19 )
+{
+    das_copy(__a_rename_at_70_19.pos /*position*/,float3(__i_rename_at_70_18++,__i_rename_at_70_18 + 1,__i_rename_at_70_18 + 2));
+    das_copy(__a_rename_at_70_19.vel /*velocity*/,v_make_vec4f(1.000000e+00f,2.000000e+00f,3.000000e+00f,0.f));
+}
+
+inline void initObj_7b07be48e960decd ( Context * __context__, int32_t __i_rename_at_75_20, NObject &  __a_rename_at_75_21 )
+{
+    das_copy(__a_rename_at_75_21.position,float3(__i_rename_at_75_20++,__i_rename_at_75_20 + 1,__i_rename_at_75_20 + 2));
+    das_copy(__a_rename_at_75_21.velocity,v_make_vec4f(1.000000e+00f,2.000000e+00f,3.000000e+00f,0.f));
+}
+
+inline void init_49a93c1a4c9ce180 ( Context * __context__, ObjectArray &  __objects_rename_at_80_22 )
+{
+    int32_t __index_rename_at_81_23 = 0;
+    {
+        bool __need_loop_82 = true;
+        // obj: testProfile::Object&
+        das_iterator<ObjectArray> __obj_iterator(__objects_rename_at_80_22);
+        Object * __obj_rename_at_82_24;
+        __need_loop_82 = __obj_iterator.first(__context__,(__obj_rename_at_82_24)) && __need_loop_82;
+        for ( ; __need_loop_82 ; __need_loop_82 = __obj_iterator.next(__context__,(__obj_rename_at_82_24)) )
+        {
+            initObj_e7f91526ed80644f(__context__,__index_rename_at_81_23++,das_arg<Object>::pass((*__obj_rename_at_82_24)));
+        }
+        __obj_iterator.close(__context__,(__obj_rename_at_82_24));
+    };
+    DAS_ASSERT((__index_rename_at_81_23 == das_vector_length(das_arg<ObjectArray>::pass(__objects_rename_at_80_22))));
+}
+
+inline void init_ec2261d0a6ed9b88 ( Context * __context__, TDim<NObject,10000> &  __objects_rename_at_88_25 )
+{
+    int32_t __index_rename_at_89_26 = 0;
+    {
+        bool __need_loop_90 = true;
+        // obj: NObject& -const
+        das_iterator<TDim<NObject,10000>> __obj_iterator(__objects_rename_at_88_25);
+        NObject * __obj_rename_at_90_27;
+        __need_loop_90 = __obj_iterator.first(__context__,(__obj_rename_at_90_27)) && __need_loop_90;
+        for ( ; __need_loop_90 ; __need_loop_90 = __obj_iterator.next(__context__,(__obj_rename_at_90_27)) )
+        {
+            initObj_7b07be48e960decd(__context__,__index_rename_at_89_26++,das_arg<NObject>::pass((*__obj_rename_at_90_27)));
+        }
+        __obj_iterator.close(__context__,(__obj_rename_at_90_27));
+    };
+    DAS_ASSERT((__index_rename_at_89_26 == 10000));
+}
+
+inline void verifyManagedInt_655f9df9a66c1076 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,144,"verifyManagedInt " DAS_FILE_LINE);
+{
+    testManagedInt(das_make_block<void,das::vector<int32_t> const  &>(__context__,80,0,&__func_info__f977874d9d78ec4d,[&](das::vector<int32_t> const  & __arr_rename_at_119_28) -> void{
+        DAS_ASSERT((das_vector_length(__arr_rename_at_119_28) == 10));
+        {
+            bool __need_loop_121 = true;
+            // x: int const
+            das_iterator<range> __x_iterator(range(0,10));
+            int32_t __x_rename_at_121_29;
+            __need_loop_121 = __x_iterator.first(__context__,(__x_rename_at_121_29)) && __need_loop_121;
+            for ( ; __need_loop_121 ; __need_loop_121 = __x_iterator.next(__context__,(__x_rename_at_121_29)) )
+            {
+                DAS_ASSERT((das_index<das::vector<int32_t> const >::at(__arr_rename_at_119_28,__x_rename_at_121_29,__context__) == __x_rename_at_121_29));
+            }
+            __x_iterator.close(__context__,(__x_rename_at_121_29));
+        };
+        {
+            bool __need_loop_124 = true;
+            // x: int const
+            das_iterator<range> __x_iterator(range(0,10));
+            int32_t __x_rename_at_124_32;
+            __need_loop_124 = __x_iterator.first(__context__,(__x_rename_at_124_32)) && __need_loop_124;
+            // y: int const&
+            das_iterator<das::vector<int32_t> const > __y_iterator(__arr_rename_at_119_28);
+            int32_t const  * __y_rename_at_124_33;
+            __need_loop_124 = __y_iterator.first(__context__,(__y_rename_at_124_33)) && __need_loop_124;
+            for ( ; __need_loop_124 ; __need_loop_124 = __x_iterator.next(__context__,(__x_rename_at_124_32)) && __y_iterator.next(__context__,(__y_rename_at_124_33)) )
+            {
+                DAS_ASSERT((__x_rename_at_124_32 == (*__y_rename_at_124_33)));
+            }
+            __y_iterator.close(__context__,(__y_rename_at_124_33));
+            __x_iterator.close(__context__,(__x_rename_at_124_32));
+        };
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}}
+
+inline void main_be2b405fca1e1319 ( Context * __context__ )
+{
+    das_using<ObjectArray>::use([&](ObjectArray & __objects_rename_at_132_34) DAS_AOT_INLINE_LAMBDA -> void{
+        das_vector_resize(das_arg<ObjectArray>::pass(__objects_rename_at_132_34),10000);
+        test_8257e0285184f0ba(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_132_34));
+    });
+}
+
+inline void test_8257e0285184f0ba ( Context * __context__, ObjectArray &  __objects_rename_at_138_35 ) { das_stack_prologue __prologue(__context__,192,"test " DAS_FILE_LINE);
+{
+    verifyManagedInt_655f9df9a66c1076(__context__);
+    perks_disabler_unset_es_411b6ceef1a08d57(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_138_35),das_arg<ObjectArray>::pass(__objects_rename_at_138_35));
+    init_ec2261d0a6ed9b88(__context__,das_arg<TDim<NObject,10000>>::pass(das_global<TDim<NObject,10000>,0x41e1f349c480a079>(__context__) /*nobjects*/));
+    testSim_493787f195cd494a(__context__,das_arg<TDim<NObject,10000>>::pass(das_global<TDim<NObject,10000>,0x41e1f349c480a079>(__context__) /*nobjects*/));
+    init_ec2261d0a6ed9b88(__context__,das_arg<TDim<NObject,10000>>::pass(das_global<TDim<NObject,10000>,0x41e1f349c480a079>(__context__) /*nobjects*/));
+    testSimI_de4d2cf76582deb9(__context__,das_arg<TDim<NObject,10000>>::pass(das_global<TDim<NObject,10000>,0x41e1f349c480a079>(__context__) /*nobjects*/));
+    init_49a93c1a4c9ce180(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_138_35));
+    testSim_db4a14236b347c9e(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_138_35));
+    init_49a93c1a4c9ce180(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_138_35));
+    testSimI_7e5acc33c54774a9(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_138_35));
+    init_49a93c1a4c9ce180(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_138_35));
+    updateTest(das_arg<ObjectArray>::pass(__objects_rename_at_138_35));
+    init_49a93c1a4c9ce180(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_138_35));
+    testInterop_6ac6f92c709a6e3a(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_138_35));
+    init_49a93c1a4c9ce180(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_138_35));
+    update10000(das_arg<ObjectArray>::pass(__objects_rename_at_138_35),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    init_49a93c1a4c9ce180(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_138_35));
+    update10000ks(das_arg<ObjectArray>::pass(__objects_rename_at_138_35),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    float __simT_rename_at_168_36 = ((float)builtin_profile(20,((char *) "aos, basic version"),das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        {
+            bool __need_loop_169 = true;
+            // i: int const
+            das_iterator<range> __i_iterator(range(0,1000));
+            int32_t __i_rename_at_169_37;
+            __need_loop_169 = __i_iterator.first(__context__,(__i_rename_at_169_37)) && __need_loop_169;
+            for ( ; __need_loop_169 ; __need_loop_169 = __i_iterator.next(__context__,(__i_rename_at_169_37)) )
+            {
+                testSim_db4a14236b347c9e(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_138_35));
+            }
+            __i_iterator.close(__context__,(__i_rename_at_169_37));
+        };
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+    float __simT_I_rename_at_173_38 = ((float)builtin_profile(20,((char *) "aos, basic version, inline"),das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        {
+            bool __need_loop_174 = true;
+            // i: int const
+            das_iterator<range> __i_iterator(range(0,1000));
+            int32_t __i_rename_at_174_39;
+            __need_loop_174 = __i_iterator.first(__context__,(__i_rename_at_174_39)) && __need_loop_174;
+            for ( ; __need_loop_174 ; __need_loop_174 = __i_iterator.next(__context__,(__i_rename_at_174_39)) )
+            {
+                testSimI_7e5acc33c54774a9(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_138_35));
+            }
+            __i_iterator.close(__context__,(__i_rename_at_174_39));
+        };
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+    float __cT_rename_at_178_40 = ((float)builtin_profile(20,((char *) "aos, c++ version"),das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        {
+            bool __need_loop_179 = true;
+            // i: int const
+            das_iterator<range> __i_iterator(range(0,1000));
+            int32_t __i_rename_at_179_41;
+            __need_loop_179 = __i_iterator.first(__context__,(__i_rename_at_179_41)) && __need_loop_179;
+            for ( ; __need_loop_179 ; __need_loop_179 = __i_iterator.next(__context__,(__i_rename_at_179_41)) )
+            {
+                updateTest(das_arg<ObjectArray>::pass(__objects_rename_at_138_35));
+            }
+            __i_iterator.close(__context__,(__i_rename_at_179_41));
+        };
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+    float __intT_rename_at_183_42 = ((float)builtin_profile(20,((char *) "aos, interop version"),das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        {
+            bool __need_loop_184 = true;
+            // i: int const
+            das_iterator<range> __i_iterator(range(0,1000));
+            int32_t __i_rename_at_184_43;
+            __need_loop_184 = __i_iterator.first(__context__,(__i_rename_at_184_43)) && __need_loop_184;
+            for ( ; __need_loop_184 ; __need_loop_184 = __i_iterator.next(__context__,(__i_rename_at_184_43)) )
+            {
+                testInterop_6ac6f92c709a6e3a(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_138_35));
+            }
+            __i_iterator.close(__context__,(__i_rename_at_184_43));
+        };
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+    float __manyT_rename_at_188_44 = ((float)builtin_profile(20,((char *) "aos, interop 10000 version"),das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        {
+            bool __need_loop_189 = true;
+            // i: int const
+            das_iterator<range> __i_iterator(range(0,1000));
+            int32_t __i_rename_at_189_45;
+            __need_loop_189 = __i_iterator.first(__context__,(__i_rename_at_189_45)) && __need_loop_189;
+            for ( ; __need_loop_189 ; __need_loop_189 = __i_iterator.next(__context__,(__i_rename_at_189_45)) )
+            {
+                update10000(das_arg<ObjectArray>::pass(__objects_rename_at_138_35),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+            }
+            __i_iterator.close(__context__,(__i_rename_at_189_45));
+        };
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+    float __manyKsT_rename_at_193_46 = ((float)builtin_profile(20,((char *) "aos, interop 10000-ks version"),das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        {
+            bool __need_loop_194 = true;
+            // i: int const
+            das_iterator<range> __i_iterator(range(0,1000));
+            int32_t __i_rename_at_194_47;
+            __need_loop_194 = __i_iterator.first(__context__,(__i_rename_at_194_47)) && __need_loop_194;
+            for ( ; __need_loop_194 ; __need_loop_194 = __i_iterator.next(__context__,(__i_rename_at_194_47)) )
+            {
+                update10000ks(das_arg<ObjectArray>::pass(__objects_rename_at_138_35),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+            }
+            __i_iterator.close(__context__,(__i_rename_at_194_47));
+        };
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<3>(__tinfo_0, cast<char * const >::from(((char *) "ratio sim/c++: ")), cast<float>::from((SimPolicy<float>::Div(__simT_rename_at_168_36,__cT_rename_at_178_40,*__context__,nullptr))), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<3>(__tinfo_0, cast<char * const >::from(((char *) "ratio sim,inline/c++: ")), cast<float>::from((SimPolicy<float>::Div(__simT_I_rename_at_173_38,__cT_rename_at_178_40,*__context__,nullptr))), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<3>(__tinfo_0, cast<char * const >::from(((char *) "ratio interop/c++: ")), cast<float>::from((SimPolicy<float>::Div(__intT_rename_at_183_42,__cT_rename_at_178_40,*__context__,nullptr))), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<3>(__tinfo_0, cast<char * const >::from(((char *) "ratio interop-10000/c++: ")), cast<float>::from((SimPolicy<float>::Div(__manyT_rename_at_188_44,__cT_rename_at_178_40,*__context__,nullptr))), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<3>(__tinfo_0, cast<char * const >::from(((char *) "ratio interop-10000-ks/c++: ")), cast<float>::from((SimPolicy<float>::Div(__manyKsT_rename_at_193_46,__cT_rename_at_178_40,*__context__,nullptr))), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}}
+static vec4f __wrap_perks_disabler_unset_es_411b6ceef1a08d57 ( Context * __context__ ) {
+    ObjectArray &  arg_game_effect_dot_allowedMods = cast_aot_arg<ObjectArray & >::to(*__context__,__context__->abiArguments()[0]);
+    ObjectArray &  arg_allowedMods = cast_aot_arg<ObjectArray & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(perks_disabler_unset_es_411b6ceef1a08d57(__context__, arg_game_effect_dot_allowedMods, arg_allowedMods));
+}
+static vec4f __wrap_update_f62040b42e73921f ( Context * __context__ ) {
+    NObject &  arg_a = cast_aot_arg<NObject & >::to(*__context__,__context__->abiArguments()[0]);
+    update_f62040b42e73921f(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap_testSim_493787f195cd494a ( Context * __context__ ) {
+    TDim<NObject,10000> &  arg_objects = cast_aot_arg<TDim<NObject,10000> & >::to(*__context__,__context__->abiArguments()[0]);
+    testSim_493787f195cd494a(__context__, arg_objects);
+    return v_zero();
+}
+static vec4f __wrap_testSimI_de4d2cf76582deb9 ( Context * __context__ ) {
+    TDim<NObject,10000> &  arg_objects = cast_aot_arg<TDim<NObject,10000> & >::to(*__context__,__context__->abiArguments()[0]);
+    testSimI_de4d2cf76582deb9(__context__, arg_objects);
+    return v_zero();
+}
+static vec4f __wrap_ks_update_a6dc79d0ee278169 ( Context * __context__ ) {
+    float3 & arg_pos = cast_aot_arg<float3 &>::to(*__context__,__context__->abiArguments()[0]);
+    float3 arg_vel = cast_aot_arg<float3>::to(*__context__,__context__->abiArguments()[1]);
+    ks_update_a6dc79d0ee278169(__context__, arg_pos, arg_vel);
+    return v_zero();
+}
+static vec4f __wrap_update_80c3983bfd8e6565 ( Context * __context__ ) {
+    Object &  arg_a = cast_aot_arg<Object & >::to(*__context__,__context__->abiArguments()[0]);
+    update_80c3983bfd8e6565(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap_testSim_db4a14236b347c9e ( Context * __context__ ) {
+    ObjectArray &  arg_objects = cast_aot_arg<ObjectArray & >::to(*__context__,__context__->abiArguments()[0]);
+    testSim_db4a14236b347c9e(__context__, arg_objects);
+    return v_zero();
+}
+static vec4f __wrap_testSimI_7e5acc33c54774a9 ( Context * __context__ ) {
+    ObjectArray &  arg_objects = cast_aot_arg<ObjectArray & >::to(*__context__,__context__->abiArguments()[0]);
+    testSimI_7e5acc33c54774a9(__context__, arg_objects);
+    return v_zero();
+}
+static vec4f __wrap_testInterop_6ac6f92c709a6e3a ( Context * __context__ ) {
+    ObjectArray &  arg_objects = cast_aot_arg<ObjectArray & >::to(*__context__,__context__->abiArguments()[0]);
+    testInterop_6ac6f92c709a6e3a(__context__, arg_objects);
+    return v_zero();
+}
+static vec4f __wrap_initObj_e7f91526ed80644f ( Context * __context__ ) {
+    int32_t arg_i = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    Object &  arg_a = cast_aot_arg<Object & >::to(*__context__,__context__->abiArguments()[1]);
+    initObj_e7f91526ed80644f(__context__, arg_i, arg_a);
+    return v_zero();
+}
+static vec4f __wrap_initObj_7b07be48e960decd ( Context * __context__ ) {
+    int32_t arg_i = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    NObject &  arg_a = cast_aot_arg<NObject & >::to(*__context__,__context__->abiArguments()[1]);
+    initObj_7b07be48e960decd(__context__, arg_i, arg_a);
+    return v_zero();
+}
+static vec4f __wrap_init_49a93c1a4c9ce180 ( Context * __context__ ) {
+    ObjectArray &  arg_objects = cast_aot_arg<ObjectArray & >::to(*__context__,__context__->abiArguments()[0]);
+    init_49a93c1a4c9ce180(__context__, arg_objects);
+    return v_zero();
+}
+static vec4f __wrap_init_ec2261d0a6ed9b88 ( Context * __context__ ) {
+    TDim<NObject,10000> &  arg_objects = cast_aot_arg<TDim<NObject,10000> & >::to(*__context__,__context__->abiArguments()[0]);
+    init_ec2261d0a6ed9b88(__context__, arg_objects);
+    return v_zero();
+}
+static vec4f __wrap_verifyManagedInt_655f9df9a66c1076 ( Context * __context__ ) {
+    verifyManagedInt_655f9df9a66c1076(__context__);
+    return v_zero();
+}
+static vec4f __wrap_main_be2b405fca1e1319 ( Context * __context__ ) {
+    main_be2b405fca1e1319(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_8257e0285184f0ba ( Context * __context__ ) {
+    ObjectArray &  arg_objects = cast_aot_arg<ObjectArray & >::to(*__context__,__context__->abiArguments()[0]);
+    test_8257e0285184f0ba(__context__, arg_objects);
+    return v_zero();
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x481a8cabe3de8bd4, false, (void*)&perks_disabler_unset_es_411b6ceef1a08d57, &__wrap_perks_disabler_unset_es_411b6ceef1a08d57 },
+    { 0xe99d3f5c4821e18e, false, (void*)&update_f62040b42e73921f, &__wrap_update_f62040b42e73921f },
+    { 0x95db670f73cb48be, false, (void*)&testSim_493787f195cd494a, &__wrap_testSim_493787f195cd494a },
+    { 0x369b5914a5dcdccc, false, (void*)&testSimI_de4d2cf76582deb9, &__wrap_testSimI_de4d2cf76582deb9 },
+    { 0x1b998b7a2ab41c0e, false, (void*)&ks_update_a6dc79d0ee278169, &__wrap_ks_update_a6dc79d0ee278169 },
+    { 0xeebfde6cb34ff4f3, false, (void*)&update_80c3983bfd8e6565, &__wrap_update_80c3983bfd8e6565 },
+    { 0xf939c245cb7ea8a7, false, (void*)&testSim_db4a14236b347c9e, &__wrap_testSim_db4a14236b347c9e },
+    { 0xbde1d3c7ab807d, false, (void*)&testSimI_7e5acc33c54774a9, &__wrap_testSimI_7e5acc33c54774a9 },
+    { 0x909d44272c525833, false, (void*)&testInterop_6ac6f92c709a6e3a, &__wrap_testInterop_6ac6f92c709a6e3a },
+    { 0xc3ba7e9c76c29c6d, false, (void*)&initObj_e7f91526ed80644f, &__wrap_initObj_e7f91526ed80644f },
+    { 0x74c6d2306b433aff, false, (void*)&initObj_7b07be48e960decd, &__wrap_initObj_7b07be48e960decd },
+    { 0x2cb1376f0db575e3, false, (void*)&init_49a93c1a4c9ce180, &__wrap_init_49a93c1a4c9ce180 },
+    { 0xa71db56a553e1fb9, false, (void*)&init_ec2261d0a6ed9b88, &__wrap_init_ec2261d0a6ed9b88 },
+    { 0xeb15d1b85c11f2ad, false, (void*)&verifyManagedInt_655f9df9a66c1076, &__wrap_verifyManagedInt_655f9df9a66c1076 },
+    { 0x5564e23d48c2ecb6, false, (void*)&main_be2b405fca1e1319, &__wrap_main_be2b405fca1e1319 },
+    { 0x6db8689d987e9083, false, (void*)&test_8257e0285184f0ba, &__wrap_test_8257e0285184f0ba },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0xb2a415b642d94831, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_7517188437568416371
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,965 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require functional
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_2503596952094661452 {
+
+namespace  { struct _lambda_thismodule_36_1; };
+namespace  { struct _lambda_thismodule_12_2; };
+namespace  { struct _lambda_thismodule_37_3; };
+namespace  { struct _lambda_thismodule_46_4; };
+// unused enumeration ConversionResult
+namespace  {
+
+struct _lambda_thismodule_36_1 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_36_1,int32_t)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_36_1 *)) __finalize;
+    int32_t mod;
+};
+static_assert(sizeof(_lambda_thismodule_36_1)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_36_1,mod)==16,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_12_2 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_12_2,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_12_2 *)) __finalize;
+    int32_t __yield;
+    Lambda DAS_COMMENT((bool,int32_t)) blk;
+    Sequence DAS_COMMENT((int32_t)) src;
+    bool _loop_at_13_12;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_13_12;
+    int32_t __w_rename_at_13_17;
+    void * _pvar_0_at_13_12;
+};
+static_assert(sizeof(_lambda_thismodule_12_2)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_2,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_2,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_2,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_2,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_2,_loop_at_13_12)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_2,_source_0_at_13_12)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_2,__w_rename_at_13_17)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_2,_pvar_0_at_13_12)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_37_3 {
+    Func DAS_COMMENT((char * const ,_lambda_thismodule_37_3,int32_t)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_37_3 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_37_3)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_37_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_37_3,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_46_4 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_46_4,char * &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_46_4 *)) __finalize;
+    int32_t __yield;
+    Lambda DAS_COMMENT((char * const ,int32_t)) blk;
+    Sequence DAS_COMMENT((int32_t)) src;
+    bool _loop_at_47_12;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_47_12;
+    int32_t __w_rename_at_47_17;
+    void * _pvar_0_at_47_12;
+};
+static_assert(sizeof(_lambda_thismodule_46_4)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_4,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_4,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_4,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_4,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_4,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_4,_loop_at_47_12)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_4,_source_0_at_47_12)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_4,__w_rename_at_47_17)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_4,_pvar_0_at_47_12)==64,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__cc3c07a63869b677;
+extern StructInfo __struct_info__ef00709b19724186;
+extern StructInfo __struct_info__eefcee9b196f2ec9;
+extern StructInfo __struct_info__a029759757f5f505;
+extern TypeInfo __type_info__af8a9b4c8643c319;
+extern TypeInfo __type_info__af909b4c864df519;
+extern TypeInfo __type_info__5fb7f4ef26198f1b;
+extern TypeInfo __type_info__e36b5f6127fd5538;
+extern TypeInfo __type_info__e806b8612e657f45;
+extern TypeInfo __type_info__59ea37a8069bb8d1;
+extern TypeInfo __type_info__fa593d0882a72913;
+extern TypeInfo __type_info__9dd4a35d0e386b76;
+extern TypeInfo __type_info__faddbd75a1c6e729;
+extern TypeInfo __type_info__af81fe4c86352052;
+extern TypeInfo __type_info__af8afe4c86446b52;
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__37d36026a6078a42;
+extern TypeInfo __type_info__4e6a8ec42ce70830;
+extern TypeInfo __type_info__711719b90dc70505;
+extern TypeInfo __type_info__71169fb90dc3528e;
+extern TypeInfo __type_info__a4b814dcbadf4f86;
+extern TypeInfo __type_info__86e65058575787a;
+extern TypeInfo __type_info__888650585a1a67a;
+extern TypeInfo __type_info__a3f0477a4765213e;
+extern TypeInfo __type_info__b8d4477a5991973e;
+extern TypeInfo __type_info__af63df4c8601f1a5;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af63ee4c86020b22;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+TypeInfo * __type_info__6b272705b3de8490_arg_types_var_14716646092832355959[2] = { &__type_info__4e6a8ec42ce70830, &__type_info__af8a9b4c8643c319 };
+const char * __type_info__6b272705b3de8490_arg_names_var_14716646092832355959[2] = { "__this", "_yield_12" };
+VarInfo __struct_info__cc3c07a63869b677_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__6b272705b3de8490_arg_types_var_14716646092832355959, __type_info__6b272705b3de8490_arg_names_var_14716646092832355959, 2, 0, nullptr, 12, 8, UINT64_C(0x6b272705b3de8490), "__lambda", 0, 0 };
+TypeInfo * __type_info__eadf813bfc40391_arg_types_var_14716646092832355959[1] = { &__type_info__5fb7f4ef26198f1b };
+const char * __type_info__eadf813bfc40391_arg_names_var_14716646092832355959[1] = { "__this" };
+VarInfo __struct_info__cc3c07a63869b677_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__eadf813bfc40391_arg_types_var_14716646092832355959, __type_info__eadf813bfc40391_arg_names_var_14716646092832355959, 1, 0, nullptr, 12, 8, UINT64_C(0xeadf813bfc40391), "__finalize", 8, 0 };
+VarInfo __struct_info__cc3c07a63869b677_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x218f242ed3122b8b), "__yield", 16, 0 };
+TypeInfo * __type_info__744426bcbda98011_arg_types_var_14716646092832355959[1] = { &__type_info__faddbd75a1c6e729 };
+const char * __type_info__744426bcbda98011_arg_names_var_14716646092832355959[1] = { "what" };
+VarInfo __struct_info__cc3c07a63869b677_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__744426bcbda98011_arg_types_var_14716646092832355959, __type_info__744426bcbda98011_arg_names_var_14716646092832355959, 1, 0, nullptr, 24576, 8, UINT64_C(0x744426bcbda98011), "blk", 24, 4 };
+VarInfo __struct_info__cc3c07a63869b677_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__86e65058575787a, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x1c221ebc72c8c0c0), "src", 32, 6 };
+VarInfo __struct_info__cc3c07a63869b677_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xc339012dda501f54), "_loop_at_13_12", 40, 0 };
+VarInfo __struct_info__cc3c07a63869b677_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__86e65058575787a, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x83b0727332e9f6eb), "_source_0_at_13_12", 48, 8 };
+VarInfo __struct_info__cc3c07a63869b677_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x833a4635cb38562d), "__w_rename_at_13_17", 56, 0 };
+VarInfo __struct_info__cc3c07a63869b677_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xfcefab56396ec7e9), "_pvar_0_at_13_12", 64, 9 };
+VarInfo * __struct_info__cc3c07a63869b677_fields[9] =  { &__struct_info__cc3c07a63869b677_field_0, &__struct_info__cc3c07a63869b677_field_1, &__struct_info__cc3c07a63869b677_field_2, &__struct_info__cc3c07a63869b677_field_3, &__struct_info__cc3c07a63869b677_field_4, &__struct_info__cc3c07a63869b677_field_5, &__struct_info__cc3c07a63869b677_field_6, &__struct_info__cc3c07a63869b677_field_7, &__struct_info__cc3c07a63869b677_field_8 };
+StructInfo __struct_info__cc3c07a63869b677 = {"_lambda_thismodule_12_2", "", 14, __struct_info__cc3c07a63869b677_fields, 9, 72, UINT64_C(0x0), nullptr, UINT64_C(0xcc3c07a63869b677), 3 };
+TypeInfo * __type_info__97277f80d9063c9b_arg_types_var_17221888786513936774[2] = { &__type_info__711719b90dc70505, &__type_info__af8afe4c86446b52 };
+const char * __type_info__97277f80d9063c9b_arg_names_var_17221888786513936774[2] = { "__this", "x" };
+VarInfo __struct_info__ef00709b19724186_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__97277f80d9063c9b_arg_types_var_17221888786513936774, __type_info__97277f80d9063c9b_arg_names_var_17221888786513936774, 2, 0, nullptr, 12, 8, UINT64_C(0x97277f80d9063c9b), "__lambda", 0, 0 };
+TypeInfo * __type_info__637d7592d2e39b94_arg_types_var_17221888786513936774[1] = { &__type_info__e36b5f6127fd5538 };
+VarInfo __struct_info__ef00709b19724186_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__637d7592d2e39b94_arg_types_var_17221888786513936774, __type_info__eadf813bfc40391_arg_names_var_14716646092832355959, 1, 0, nullptr, 12, 8, UINT64_C(0x637d7592d2e39b94), "__finalize", 8, 0 };
+VarInfo __struct_info__ef00709b19724186_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xac9984a6af8ac0c0), "mod", 16, 0 };
+VarInfo * __struct_info__ef00709b19724186_fields[3] =  { &__struct_info__ef00709b19724186_field_0, &__struct_info__ef00709b19724186_field_1, &__struct_info__ef00709b19724186_field_2 };
+StructInfo __struct_info__ef00709b19724186 = {"_lambda_thismodule_36_1", "", 14, __struct_info__ef00709b19724186_fields, 3, 24, UINT64_C(0x0), nullptr, UINT64_C(0xef00709b19724186), 3 };
+TypeInfo * __type_info__561ed60d1135097e_arg_types_var_17220901425071992521[2] = { &__type_info__71169fb90dc3528e, &__type_info__af8afe4c86446b52 };
+VarInfo __struct_info__eefcee9b196f2ec9_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af90fe4c864e9d52, nullptr, (TypeInfo **)__type_info__561ed60d1135097e_arg_types_var_17220901425071992521, __type_info__97277f80d9063c9b_arg_names_var_17221888786513936774, 2, 0, nullptr, 12, 8, UINT64_C(0x561ed60d1135097e), "__lambda", 0, 0 };
+TypeInfo * __type_info__5d602eb1eab41507_arg_types_var_17220901425071992521[1] = { &__type_info__e806b8612e657f45 };
+VarInfo __struct_info__eefcee9b196f2ec9_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__5d602eb1eab41507_arg_types_var_17220901425071992521, __type_info__eadf813bfc40391_arg_names_var_14716646092832355959, 1, 0, nullptr, 12, 8, UINT64_C(0x5d602eb1eab41507), "__finalize", 8, 0 };
+VarInfo * __struct_info__eefcee9b196f2ec9_fields[2] =  { &__struct_info__eefcee9b196f2ec9_field_0, &__struct_info__eefcee9b196f2ec9_field_1 };
+StructInfo __struct_info__eefcee9b196f2ec9 = {"_lambda_thismodule_37_3", "", 14, __struct_info__eefcee9b196f2ec9_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0xeefcee9b196f2ec9), 2 };
+TypeInfo * __type_info__23764f610c046a6a_arg_types_var_11540884812989854981[2] = { &__type_info__a4b814dcbadf4f86, &__type_info__af909b4c864df519 };
+const char * __type_info__23764f610c046a6a_arg_names_var_11540884812989854981[2] = { "__this", "_yield_46" };
+VarInfo __struct_info__a029759757f5f505_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__23764f610c046a6a_arg_types_var_11540884812989854981, __type_info__23764f610c046a6a_arg_names_var_11540884812989854981, 2, 0, nullptr, 12, 8, UINT64_C(0x23764f610c046a6a), "__lambda", 0, 0 };
+TypeInfo * __type_info__f86e8896597d74bb_arg_types_var_11540884812989854981[1] = { &__type_info__59ea37a8069bb8d1 };
+VarInfo __struct_info__a029759757f5f505_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__f86e8896597d74bb_arg_types_var_11540884812989854981, __type_info__eadf813bfc40391_arg_names_var_14716646092832355959, 1, 0, nullptr, 12, 8, UINT64_C(0xf86e8896597d74bb), "__finalize", 8, 0 };
+VarInfo __struct_info__a029759757f5f505_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x3a413c3a3fa57c7d), "__yield", 16, 0 };
+const char * __type_info__ad9f244aecd44007_arg_names_var_11540884812989854981[1] = { "x" };
+VarInfo __struct_info__a029759757f5f505_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__9dd4a35d0e386b76, nullptr, (TypeInfo **)__type_info__744426bcbda98011_arg_types_var_14716646092832355959, __type_info__ad9f244aecd44007_arg_names_var_11540884812989854981, 1, 0, nullptr, 24576, 8, UINT64_C(0xad9f244aecd44007), "blk", 24, 4 };
+VarInfo __struct_info__a029759757f5f505_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__86e65058575787a, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x7040244ab8b0046e), "src", 32, 6 };
+VarInfo __struct_info__a029759757f5f505_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xed812f7d08173d1a), "_loop_at_47_12", 40, 0 };
+VarInfo __struct_info__a029759757f5f505_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__86e65058575787a, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x3b9d66b06899600d), "_source_0_at_47_12", 48, 8 };
+VarInfo __struct_info__a029759757f5f505_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xabd1a28d6be68830), "__w_rename_at_47_17", 56, 0 };
+VarInfo __struct_info__a029759757f5f505_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x61981f7a2eb0fe87), "_pvar_0_at_47_12", 64, 9 };
+VarInfo * __struct_info__a029759757f5f505_fields[9] =  { &__struct_info__a029759757f5f505_field_0, &__struct_info__a029759757f5f505_field_1, &__struct_info__a029759757f5f505_field_2, &__struct_info__a029759757f5f505_field_3, &__struct_info__a029759757f5f505_field_4, &__struct_info__a029759757f5f505_field_5, &__struct_info__a029759757f5f505_field_6, &__struct_info__a029759757f5f505_field_7, &__struct_info__a029759757f5f505_field_8 };
+StructInfo __struct_info__a029759757f5f505 = {"_lambda_thismodule_46_4", "", 14, __struct_info__a029759757f5f505_fields, 9, 72, UINT64_C(0x0), nullptr, UINT64_C(0xa029759757f5f505), 3 };
+VarInfo __func_info__a722371d52e594ca_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x9c581507596aad8c), "x", 0, 0 };
+VarInfo * __func_info__a722371d52e594ca_fields[1] =  { &__func_info__a722371d52e594ca_field_0 };
+FuncInfo __func_info__a722371d52e594ca = {"invoke block<(x:int const):bool> const", "", __func_info__a722371d52e594ca_fields, 1, 32, &__type_info__af63df4c8601f1a5, nullptr,0,UINT64_C(0xa722371d52e594ca), 0x0 };
+VarInfo __func_info__bc7827c239b16a42_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x9c581507596aad8c), "x", 0, 0 };
+VarInfo * __func_info__bc7827c239b16a42_fields[1] =  { &__func_info__bc7827c239b16a42_field_0 };
+FuncInfo __func_info__bc7827c239b16a42 = {"invoke block<(x:int const):string const> const", "", __func_info__bc7827c239b16a42_fields, 1, 32, &__type_info__af90fe4c864e9d52, nullptr,0,UINT64_C(0xbc7827c239b16a42), 0x0 };
+FuncInfo __func_info__955909f57bd61177 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x955909f57bd61177), 0x0 };
+TypeInfo __type_info__af8a9b4c8643c319 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 4, UINT64_C(0xaf8a9b4c8643c319) };
+TypeInfo __type_info__af909b4c864df519 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16645, 8, UINT64_C(0xaf909b4c864df519) };
+TypeInfo __type_info__5fb7f4ef26198f1b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4e6a8ec42ce70830, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x5fb7f4ef26198f1b) };
+TypeInfo __type_info__e36b5f6127fd5538 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__711719b90dc70505, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xe36b5f6127fd5538) };
+TypeInfo __type_info__e806b8612e657f45 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__71169fb90dc3528e, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xe806b8612e657f45) };
+TypeInfo __type_info__59ea37a8069bb8d1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a4b814dcbadf4f86, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x59ea37a8069bb8d1) };
+TypeInfo __type_info__fa593d0882a72913 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16548, 8, UINT64_C(0xfa593d0882a72913) };
+TypeInfo __type_info__9dd4a35d0e386b76 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0x9dd4a35d0e386b76) };
+TypeInfo __type_info__faddbd75a1c6e729 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xfaddbd75a1c6e729) };
+TypeInfo __type_info__af81fe4c86352052 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 1, UINT64_C(0xaf81fe4c86352052) };
+TypeInfo __type_info__af8afe4c86446b52 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf8afe4c86446b52) };
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__37d36026a6078a42 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 288, UINT64_C(0x37d36026a6078a42) };
+TypeInfo __type_info__4e6a8ec42ce70830 = { Type::tStructure, &__struct_info__cc3c07a63869b677, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24578, 72, UINT64_C(0x4e6a8ec42ce70830) };
+TypeInfo __type_info__711719b90dc70505 = { Type::tStructure, &__struct_info__ef00709b19724186, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 24, UINT64_C(0x711719b90dc70505) };
+TypeInfo __type_info__71169fb90dc3528e = { Type::tStructure, &__struct_info__eefcee9b196f2ec9, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 16, UINT64_C(0x71169fb90dc3528e) };
+TypeInfo __type_info__a4b814dcbadf4f86 = { Type::tStructure, &__struct_info__a029759757f5f505, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24578, 72, UINT64_C(0xa4b814dcbadf4f86) };
+TypeInfo __type_info__86e65058575787a = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x86e65058575787a) };
+TypeInfo __type_info__888650585a1a67a = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0x888650585a1a67a) };
+TypeInfo __type_info__a3f0477a4765213e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xa3f0477a4765213e) };
+TypeInfo __type_info__b8d4477a5991973e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63ee4c86020b22, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 24, UINT64_C(0xb8d4477a5991973e) };
+TypeInfo __type_info__af63df4c8601f1a5 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xaf63df4c8601f1a5) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__af63ee4c86020b22 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0xaf63ee4c86020b22) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {__type_info__37d36026a6078a42, };
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__37d36026a6078a42, &__type_info__fa593d0882a72913 };
+TypeInfo * __tinfo_1[2] = { &__type_info__37d36026a6078a42, &__type_info__888650585a1a67a };
+TypeInfo * __tinfo_2[1] = { &__type_info__af8afe4c86446b52 };
+TypeInfo * __tinfo_3[2] = { &__type_info__b8d4477a5991973e, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_5[2] = { &__type_info__37d36026a6078a42, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_6[2] = { &__type_info__a3f0477a4765213e, &__type_info__af90fe4c864e9d52 };
+
+inline char * _Funcstrings_boostTickjoinTick17792841289284275598_9eb525d02bb20b0a ( Context * __context__, Sequence DAS_COMMENT((char *)) & __it_rename_at_48_0, char * const  __separator_rename_at_48_1 );
+inline void finalize_69aa3a09e58af584 ( Context * __context__, _lambda_thismodule_46_4 & ____this_rename_at_46_6 );
+inline Sequence DAS_COMMENT((char *)) _FuncbuiltinTickeachTick9663565701927713696_ea44c1aecdd0f1da ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const  __lam_rename_at_1443_7 );
+inline bool _Func_lambda_thismodule_46_4Tickfunction_c95a5e730aa40d62 ( Context * __context__, _lambda_thismodule_46_4 & ____this_rename_at_46_9, char * & ___yield_46_rename_at_46_10 );
+inline void _Func_lambda_thismodule_46_4Tickfinalizer_ebcd6d6e9a09a235 ( Context * __context__, _lambda_thismodule_46_4 * ____this_rename_at_46_11 );
+inline void finalize_41e6b8419a5110a2 ( Context * __context__, _lambda_thismodule_37_3 & ____this_rename_at_37_12 );
+inline char * _Func_lambda_thismodule_37_3Tickfunction_583b2b666d793cf7 ( Context * __context__, _lambda_thismodule_37_3 & ____this_rename_at_37_13, int32_t __x_rename_at_37_14 );
+inline void _Func_lambda_thismodule_37_3Tickfinalizer_ad7732bd3d3ce91d ( Context * __context__, _lambda_thismodule_37_3 * ____this_rename_at_37_15 );
+inline Sequence DAS_COMMENT((char *)) _FuncfunctionalTickmap_anyTick4479995923280306007_5f49aaba923b52cc ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_43_16, Lambda DAS_COMMENT((char * const ,int32_t)) __blk_rename_at_43_17 );
+inline Sequence DAS_COMMENT((char *)) _FuncfunctionalTickmapTick3767370688684665805_2b43678bf41fa6ab ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_76_18, Lambda DAS_COMMENT((char * const ,int32_t)) const  __blk_rename_at_76_19 );
+inline void finalize_22fd9f64238d0802 ( Context * __context__, _lambda_thismodule_12_2 & ____this_rename_at_12_20 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickeachTick9663565701927713696_95fc75174fdfbb63 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_1443_21 );
+inline bool _Func_lambda_thismodule_12_2Tickfunction_d4ece7bc4f0cf6f0 ( Context * __context__, _lambda_thismodule_12_2 & ____this_rename_at_12_23, int32_t & ___yield_12_rename_at_12_24 );
+inline void _Func_lambda_thismodule_12_2Tickfinalizer_978d8b4685edb984 ( Context * __context__, _lambda_thismodule_12_2 * ____this_rename_at_12_25 );
+inline void finalize_f6ba8f280706e2f1 ( Context * __context__, _lambda_thismodule_36_1 & ____this_rename_at_36_26 );
+inline TArray<char *> & _FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a5393f36ccdac4a8 ( Context * __context__, TArray<char *> & __a_rename_at_50_27 );
+inline bool _Func_lambda_thismodule_36_1Tickfunction_94ba09db636eeeb0 ( Context * __context__, _lambda_thismodule_36_1 & ____this_rename_at_36_28, int32_t __x_rename_at_36_29 );
+inline void _Func_lambda_thismodule_36_1Tickfinalizer_973e5f0c5881503e ( Context * __context__, _lambda_thismodule_36_1 * ____this_rename_at_36_30 );
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_c48630585afa1450 ( Context * __context__, TArray<char *> & __a_rename_at_1336_31 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickfilter_anyTick8436123068441528563_cde984da2e211a80 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_9_32, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_9_33 );
+inline void _FuncbuiltinTickreserveTick3994685146752941225_9b1d42232444f681 ( Context * __context__, TArray<char *> & __Arr_rename_at_137_34, int32_t __newSize_rename_at_137_35 );
+inline void _FuncbuiltinTickpushTick14133213201864676143_a73bd8f330e36d49 ( Context * __context__, TArray<char *> & __Arr_rename_at_177_36, char * const  __value_rename_at_177_37 );
+inline char * _Funcstrings_boostTickjoinTick16475640899284277631_2d62f8289a864db9 ( Context * __context__, TArray<char *> const  & __it_rename_at_23_38, char * const  __separator_rename_at_23_39 );
+inline void _FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_137_44, int32_t __newSize_rename_at_137_45 );
+inline TArray<int32_t> & _FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 ( Context * __context__, TArray<int32_t> & __a_rename_at_50_46 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickfilterTick17052258911568430960_c5b51d79366e68ab ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_32_47, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_32_48 );
+inline TArray<char *> _FuncTickmap_aTick10570152363785132454_c30eab3e39a946d0 ( Context * __context__, TArray<int32_t> const  & __src_rename_at_14_49, Block DAS_COMMENT((char * const ,int32_t)) const  & __blk_rename_at_14_50 );
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd ( Context * __context__, TArray<int32_t> & __a_rename_at_1336_53 );
+inline void _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_177_54, int32_t __value_rename_at_177_55 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 ( Context * __context__, range __rng_rename_at_1398_56 );
+inline TArray<int32_t> _FuncTickfilter_aTick5010215866972275650_5b1d8a1fe5871669 ( Context * __context__, TArray<int32_t> const  & __src_rename_at_23_58, Block DAS_COMMENT((bool,int32_t)) const  & __blk_rename_at_23_59 );
+inline TArray<int32_t> each_a_d00c2f2e2d6e2fec ( Context * __context__, range __r_rename_at_5_62 );
+inline char * testGen_bb615616a4fcfc12 ( Context * __context__, int32_t __total_rename_at_33_65, int32_t __mod_rename_at_33_66 );
+inline char * testArr_94380748fea53281 ( Context * __context__, int32_t __total_rename_at_42_67, int32_t __mod_rename_at_42_68 );
+inline char * testLoop_3620c0f3147780e6 ( Context * __context__, int32_t __total_rename_at_53_74, int32_t __mod_rename_at_53_75 );
+inline void main_9357d4abf7575f64 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline char * _Funcstrings_boostTickjoinTick17792841289284275598_9eb525d02bb20b0a ( Context * __context__, Sequence DAS_COMMENT((char *)) &  __it_rename_at_48_0, char * const  __separator_rename_at_48_1 )
+{
+    char * __st_rename_at_50_2 = ((char *)(char *)(((char * const )(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_50_3) DAS_AOT_INLINE_LAMBDA -> void{
+        bool __skip_first_rename_at_51_4 = true;
+        {
+            bool __need_loop_52 = true;
+            // elem: string aka TT
+            das_iterator<Sequence DAS_COMMENT((char *))> __elem_iterator(__it_rename_at_48_0);
+            char * __elem_rename_at_52_5;
+            __need_loop_52 = __elem_iterator.first(__context__,(__elem_rename_at_52_5)) && __need_loop_52;
+            for ( ; __need_loop_52 ; __need_loop_52 = __elem_iterator.next(__context__,(__elem_rename_at_52_5)) )
+            {
+                if ( __skip_first_rename_at_51_4 )
+                {
+                    das_copy(__skip_first_rename_at_51_4,false);
+                } else {
+                    das_call_interop<StringBuilderWriter &>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<StringBuilderWriter &>::from(__writer_rename_at_50_3),cast<char * const >::from(__separator_rename_at_48_1)));
+                };
+                das_call_interop<StringBuilderWriter &>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<StringBuilderWriter &>::from(__writer_rename_at_50_3),cast<char *>::from(__elem_rename_at_52_5)));
+            }
+            __elem_iterator.close(__context__,(__elem_rename_at_52_5));
+        };
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+    return das_auto_cast<char *>::cast(__st_rename_at_50_2);
+}
+
+inline void finalize_69aa3a09e58af584 ( Context * __context__, _lambda_thismodule_46_4 &  ____this_rename_at_46_6 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_46_6._source_0_at_47_12),__context__);
+    memset((void*)&(____this_rename_at_46_6), 0, 72);
+}
+
+inline Sequence DAS_COMMENT((char *)) _FuncbuiltinTickeachTick9663565701927713696_ea44c1aecdd0f1da ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const  __lam_rename_at_1443_7 )
+{
+    Sequence DAS_COMMENT((char *)) __it_rename_at_1445_8;das_zero(__it_rename_at_1445_8);
+    builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((char *))>::pass(__it_rename_at_1445_8),__lam_rename_at_1443_7,8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char *))>::cast(__it_rename_at_1445_8);
+}
+
+inline bool _Func_lambda_thismodule_46_4Tickfunction_c95a5e730aa40d62 ( Context * __context__, _lambda_thismodule_46_4 &  ____this_rename_at_46_9, char * & ___yield_46_rename_at_46_10 )
+{
+    switch (____this_rename_at_46_9.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_46_9._loop_at_47_12,true);
+    das_move(____this_rename_at_46_9._source_0_at_47_12,____this_rename_at_46_9.src);
+    memset((void*)&(____this_rename_at_46_9.__w_rename_at_47_17), 0, 4);
+    das_copy(____this_rename_at_46_9._pvar_0_at_47_12,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_46_9.__w_rename_at_47_17)));
+    DAS_SETBOOLAND((____this_rename_at_46_9._loop_at_47_12),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_46_9._source_0_at_47_12),____this_rename_at_46_9._pvar_0_at_47_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_46_9._loop_at_47_12 )
+    {
+        goto label_4;
+    };
+    das_copy(___yield_46_rename_at_46_10,das_invoke_lambda<char *>::invoke<int32_t>(__context__,nullptr,____this_rename_at_46_9.blk,____this_rename_at_46_9.__w_rename_at_47_17));
+    das_copy(____this_rename_at_46_9.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_46_9._loop_at_47_12),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_46_9._source_0_at_47_12),____this_rename_at_46_9._pvar_0_at_47_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_46_9._source_0_at_47_12),____this_rename_at_46_9._pvar_0_at_47_12,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_46_4Tickfinalizer_ebcd6d6e9a09a235 ( Context * __context__, _lambda_thismodule_46_4 * ____this_rename_at_46_11 )
+{
+    finalize_69aa3a09e58af584(__context__,das_arg<_lambda_thismodule_46_4>::pass(das_deref(__context__,____this_rename_at_46_11,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_46_4 *>::clear(__context__,____this_rename_at_46_11);
+}
+
+inline void finalize_41e6b8419a5110a2 ( Context * __context__, _lambda_thismodule_37_3 &  ____this_rename_at_37_12 )
+{
+    memset((void*)&(____this_rename_at_37_12), 0, 16);
+}
+
+inline char * _Func_lambda_thismodule_37_3Tickfunction_583b2b666d793cf7 ( Context * __context__, _lambda_thismodule_37_3 &  ____this_rename_at_37_13, int32_t __x_rename_at_37_14 )
+{
+    return das_auto_cast<char *>::cast(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_2, cast<int32_t>::from(__x_rename_at_37_14))));
+}
+
+inline void _Func_lambda_thismodule_37_3Tickfinalizer_ad7732bd3d3ce91d ( Context * __context__, _lambda_thismodule_37_3 * ____this_rename_at_37_15 )
+{
+    finalize_41e6b8419a5110a2(__context__,das_arg<_lambda_thismodule_37_3>::pass(das_deref(__context__,____this_rename_at_37_15,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_37_3 *>::clear(__context__,____this_rename_at_37_15);
+}
+
+inline Sequence DAS_COMMENT((char *)) _FuncfunctionalTickmap_anyTick4479995923280306007_5f49aaba923b52cc ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_43_16, Lambda DAS_COMMENT((char * const ,int32_t)) __blk_rename_at_43_17 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char *))>::cast(_FuncbuiltinTickeachTick9663565701927713696_ea44c1aecdd0f1da(__context__,das_ascend<bool,_lambda_thismodule_46_4>::make(__context__,&__type_info__a4b814dcbadf4f86,(([&]() -> _lambda_thismodule_46_4 {
+        _lambda_thismodule_46_4 __mks_46;
+        das_zero(__mks_46);
+        das_copy((__mks_46.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_46_4`function XS<_lambda_thismodule_46_4> &s*/ 0xd013d4740026fec))));
+        das_copy((__mks_46.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_46_4`finalizer X1<S<_lambda_thismodule_46_4>>?*/ 0x616d4d4f6b43c143))));
+        das_move((__mks_46.blk),(__blk_rename_at_43_17));
+        das_move((__mks_46.src),(__src_rename_at_43_16));
+        return __mks_46;
+    })()))));
+}
+
+inline Sequence DAS_COMMENT((char *)) _FuncfunctionalTickmapTick3767370688684665805_2b43678bf41fa6ab ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_76_18, Lambda DAS_COMMENT((char * const ,int32_t)) const  __blk_rename_at_76_19 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char *))>::cast(_FuncfunctionalTickmap_anyTick4479995923280306007_5f49aaba923b52cc(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_76_18),__blk_rename_at_76_19));
+}
+
+inline void finalize_22fd9f64238d0802 ( Context * __context__, _lambda_thismodule_12_2 &  ____this_rename_at_12_20 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_12_20._source_0_at_13_12),__context__);
+    memset((void*)&(____this_rename_at_12_20), 0, 72);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickeachTick9663565701927713696_95fc75174fdfbb63 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_1443_21 )
+{
+    Sequence DAS_COMMENT((int32_t)) __it_rename_at_1445_22;das_zero(__it_rename_at_1445_22);
+    builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_1445_22),__lam_rename_at_1443_21,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_1445_22);
+}
+
+inline bool _Func_lambda_thismodule_12_2Tickfunction_d4ece7bc4f0cf6f0 ( Context * __context__, _lambda_thismodule_12_2 &  ____this_rename_at_12_23, int32_t & ___yield_12_rename_at_12_24 )
+{
+    switch (____this_rename_at_12_23.__yield) {
+    case 0: goto label_0;
+    case 3: goto label_3;
+    case 1: goto label_1;
+    case 2: goto label_2;
+    case 4: goto label_4;
+    case 5: goto label_5;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_12_23._loop_at_13_12,true);
+    das_move(____this_rename_at_12_23._source_0_at_13_12,____this_rename_at_12_23.src);
+    memset((void*)&(____this_rename_at_12_23.__w_rename_at_13_17), 0, 4);
+    das_copy(____this_rename_at_12_23._pvar_0_at_13_12,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_12_23.__w_rename_at_13_17)));
+    DAS_SETBOOLAND((____this_rename_at_12_23._loop_at_13_12),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_12_23._source_0_at_13_12),____this_rename_at_12_23._pvar_0_at_13_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_3:;;
+    if ( !____this_rename_at_12_23._loop_at_13_12 )
+    {
+        goto label_5;
+    };
+    if ( !das_invoke_lambda<bool>::invoke<int32_t>(__context__,nullptr,____this_rename_at_12_23.blk,____this_rename_at_12_23.__w_rename_at_13_17) )
+    {
+        goto label_2;
+    };
+    das_copy(___yield_12_rename_at_12_24,____this_rename_at_12_23.__w_rename_at_13_17);
+    das_copy(____this_rename_at_12_23.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_2:;;
+    label_4:;;
+    DAS_SETBOOLAND((____this_rename_at_12_23._loop_at_13_12),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_12_23._source_0_at_13_12),____this_rename_at_12_23._pvar_0_at_13_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_3;
+    label_5:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_12_23._source_0_at_13_12),____this_rename_at_12_23._pvar_0_at_13_12,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_12_2Tickfinalizer_978d8b4685edb984 ( Context * __context__, _lambda_thismodule_12_2 * ____this_rename_at_12_25 )
+{
+    finalize_22fd9f64238d0802(__context__,das_arg<_lambda_thismodule_12_2>::pass(das_deref(__context__,____this_rename_at_12_25,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_12_2 *>::clear(__context__,____this_rename_at_12_25);
+}
+
+inline void finalize_f6ba8f280706e2f1 ( Context * __context__, _lambda_thismodule_36_1 &  ____this_rename_at_36_26 )
+{
+    memset((void*)&(____this_rename_at_36_26), 0, 24);
+}
+
+inline TArray<char *> & _FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a5393f36ccdac4a8 ( Context * __context__, TArray<char *> &  __a_rename_at_50_27 )
+{
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_3,cast<TArray<char *> &>::from(__a_rename_at_50_27),cast<char * const >::from(((char *) "object can't be returned because it is locked"))));
+    return das_auto_cast_ref<TArray<char *> &>::cast(__a_rename_at_50_27);
+}
+
+inline bool _Func_lambda_thismodule_36_1Tickfunction_94ba09db636eeeb0 ( Context * __context__, _lambda_thismodule_36_1 &  ____this_rename_at_36_28, int32_t __x_rename_at_36_29 )
+{
+    return das_auto_cast<bool>::cast((SimPolicy<int32_t>::Mod(__x_rename_at_36_29,____this_rename_at_36_28.mod,*__context__,nullptr)) == 0);
+}
+
+inline void _Func_lambda_thismodule_36_1Tickfinalizer_973e5f0c5881503e ( Context * __context__, _lambda_thismodule_36_1 * ____this_rename_at_36_30 )
+{
+    finalize_f6ba8f280706e2f1(__context__,das_arg<_lambda_thismodule_36_1>::pass(das_deref(__context__,____this_rename_at_36_30,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_36_1 *>::clear(__context__,____this_rename_at_36_30);
+}
+
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_c48630585afa1450 ( Context * __context__, TArray<char *> &  __a_rename_at_1336_31 )
+{
+    builtin_array_free(das_arg<TArray<char *>>::pass(__a_rename_at_1336_31),8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickfilter_anyTick8436123068441528563_cde984da2e211a80 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_9_32, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_9_33 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_FuncbuiltinTickeachTick9663565701927713696_95fc75174fdfbb63(__context__,das_ascend<bool,_lambda_thismodule_12_2>::make(__context__,&__type_info__4e6a8ec42ce70830,(([&]() -> _lambda_thismodule_12_2 {
+        _lambda_thismodule_12_2 __mks_12;
+        das_zero(__mks_12);
+        das_copy((__mks_12.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_12_2`function XS<_lambda_thismodule_12_2> &i*/ 0x8ca60a548fdfb472))));
+        das_copy((__mks_12.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_12_2`finalizer X1<S<_lambda_thismodule_12_2>>?*/ 0x3bc43e3cb1b319f4))));
+        das_move((__mks_12.blk),(__blk_rename_at_9_33));
+        das_move((__mks_12.src),(__src_rename_at_9_32));
+        return __mks_12;
+    })()))));
+}
+
+inline void _FuncbuiltinTickreserveTick3994685146752941225_9b1d42232444f681 ( Context * __context__, TArray<char *> &  __Arr_rename_at_137_34, int32_t __newSize_rename_at_137_35 )
+{
+    builtin_array_reserve(das_arg<TArray<char *>>::pass(__Arr_rename_at_137_34),__newSize_rename_at_137_35,8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickpushTick14133213201864676143_a73bd8f330e36d49 ( Context * __context__, TArray<char *> &  __Arr_rename_at_177_36, char * const  __value_rename_at_177_37 )
+{
+    das_copy(__Arr_rename_at_177_36(builtin_array_push_back(das_arg<TArray<char *>>::pass(__Arr_rename_at_177_36),8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_177_37);
+}
+
+inline char * _Funcstrings_boostTickjoinTick16475640899284277631_2d62f8289a864db9 ( Context * __context__, TArray<char *> const  &  __it_rename_at_23_38, char * const  __separator_rename_at_23_39 )
+{
+    char * __st_rename_at_29_40 = ((char *)(char *)(((char * const )(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_29_41) DAS_AOT_INLINE_LAMBDA -> void{
+        bool __skip_first_rename_at_30_42 = true;
+        {
+            bool __need_loop_31 = true;
+            // elem: string const&
+            das_iterator<TArray<char *> const > __elem_iterator(__it_rename_at_23_38);
+            char * const  * __elem_rename_at_31_43;
+            __need_loop_31 = __elem_iterator.first(__context__,(__elem_rename_at_31_43)) && __need_loop_31;
+            for ( ; __need_loop_31 ; __need_loop_31 = __elem_iterator.next(__context__,(__elem_rename_at_31_43)) )
+            {
+                if ( __skip_first_rename_at_30_42 )
+                {
+                    das_copy(__skip_first_rename_at_30_42,false);
+                } else {
+                    das_call_interop<StringBuilderWriter &>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<StringBuilderWriter &>::from(__writer_rename_at_29_41),cast<char * const >::from(__separator_rename_at_23_39)));
+                };
+                das_call_interop<StringBuilderWriter &>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_5,cast<StringBuilderWriter &>::from(__writer_rename_at_29_41),cast<char * const >::from((*__elem_rename_at_31_43))));
+            }
+            __elem_iterator.close(__context__,(__elem_rename_at_31_43));
+        };
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+    return das_auto_cast<char *>::cast(__st_rename_at_29_40);
+}
+
+inline void _FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_137_44, int32_t __newSize_rename_at_137_45 )
+{
+    builtin_array_reserve(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_137_44),__newSize_rename_at_137_45,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline TArray<int32_t> & _FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 ( Context * __context__, TArray<int32_t> &  __a_rename_at_50_46 )
+{
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_6,cast<TArray<int32_t> &>::from(__a_rename_at_50_46),cast<char * const >::from(((char *) "object can't be returned because it is locked"))));
+    return das_auto_cast_ref<TArray<int32_t> &>::cast(__a_rename_at_50_46);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickfilterTick17052258911568430960_c5b51d79366e68ab ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_32_47, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_32_48 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_FuncfunctionalTickfilter_anyTick8436123068441528563_cde984da2e211a80(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_32_47),__blk_rename_at_32_48));
+}
+
+inline TArray<char *> _FuncTickmap_aTick10570152363785132454_c30eab3e39a946d0 ( Context * __context__, TArray<int32_t> const  &  __src_rename_at_14_49, Block DAS_COMMENT((char * const ,int32_t)) const  &  __blk_rename_at_14_50 )
+{
+    TArray<char *> __a_rename_at_15_51;das_zero(__a_rename_at_15_51);
+    _FuncbuiltinTickreserveTick3994685146752941225_9b1d42232444f681(__context__,das_arg<TArray<char *>>::pass(__a_rename_at_15_51),builtin_array_size(__src_rename_at_14_49));
+    {
+        bool __need_loop_17 = true;
+        // x: int aka TT const&
+        das_iterator<TArray<int32_t> const > __x_iterator(__src_rename_at_14_49);
+        int32_t const  * __x_rename_at_17_52;
+        __need_loop_17 = __x_iterator.first(__context__,(__x_rename_at_17_52)) && __need_loop_17;
+        for ( ; __need_loop_17 ; __need_loop_17 = __x_iterator.next(__context__,(__x_rename_at_17_52)) )
+        {
+            _FuncbuiltinTickpushTick14133213201864676143_a73bd8f330e36d49(__context__,das_arg<TArray<char *>>::pass(__a_rename_at_15_51),das_invoke<char *>::invoke<int32_t>(__context__,nullptr,__blk_rename_at_14_50,(*__x_rename_at_17_52)));
+        }
+        __x_iterator.close(__context__,(__x_rename_at_17_52));
+    };
+    return /* <- */ das_auto_cast_move<TArray<char *>>::cast(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a5393f36ccdac4a8(__context__,das_arg<TArray<char *>>::pass(__a_rename_at_15_51)));
+}
+
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd ( Context * __context__, TArray<int32_t> &  __a_rename_at_1336_53 )
+{
+    builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_1336_53),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_177_54, int32_t __value_rename_at_177_55 )
+{
+    das_copy(__Arr_rename_at_177_54(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_177_54),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_177_55);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 ( Context * __context__, range __rng_rename_at_1398_56 )
+{
+    Sequence DAS_COMMENT((int32_t)) __it_rename_at_1399_57;das_zero(__it_rename_at_1399_57);
+    builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_1399_57),__rng_rename_at_1398_56,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_1399_57);
+}
+
+inline TArray<int32_t> _FuncTickfilter_aTick5010215866972275650_5b1d8a1fe5871669 ( Context * __context__, TArray<int32_t> const  &  __src_rename_at_23_58, Block DAS_COMMENT((bool,int32_t)) const  &  __blk_rename_at_23_59 )
+{
+    TArray<int32_t> __a_rename_at_24_60;das_zero(__a_rename_at_24_60);
+    {
+        bool __need_loop_25 = true;
+        // x: int aka TT const&
+        das_iterator<TArray<int32_t> const > __x_iterator(__src_rename_at_23_58);
+        int32_t const  * __x_rename_at_25_61;
+        __need_loop_25 = __x_iterator.first(__context__,(__x_rename_at_25_61)) && __need_loop_25;
+        for ( ; __need_loop_25 ; __need_loop_25 = __x_iterator.next(__context__,(__x_rename_at_25_61)) )
+        {
+            if ( das_invoke<bool>::invoke<int32_t>(__context__,nullptr,__blk_rename_at_23_59,(*__x_rename_at_25_61)) )
+            {
+                _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_24_60),(*__x_rename_at_25_61));
+            };
+        }
+        __x_iterator.close(__context__,(__x_rename_at_25_61));
+    };
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_24_60)));
+}
+
+inline TArray<int32_t> each_a_d00c2f2e2d6e2fec ( Context * __context__, range __r_rename_at_5_62 )
+{
+    TArray<int32_t> __a_rename_at_6_63;das_zero(__a_rename_at_6_63);
+    _FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_6_63),v_extract_yi(v_cast_vec4i(__r_rename_at_5_62)) /*y*/ - v_extract_xi(v_cast_vec4i(__r_rename_at_5_62)) /*x*/);
+    {
+        bool __need_loop_8 = true;
+        // x: int const
+        das_iterator<range> __x_iterator(__r_rename_at_5_62);
+        int32_t __x_rename_at_8_64;
+        __need_loop_8 = __x_iterator.first(__context__,(__x_rename_at_8_64)) && __need_loop_8;
+        for ( ; __need_loop_8 ; __need_loop_8 = __x_iterator.next(__context__,(__x_rename_at_8_64)) )
+        {
+            _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_6_63),__x_rename_at_8_64);
+        }
+        __x_iterator.close(__context__,(__x_rename_at_8_64));
+    };
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_6_63)));
+}
+
+inline char * testGen_bb615616a4fcfc12 ( Context * __context__, int32_t __total_rename_at_33_65, int32_t __mod_rename_at_33_66 )
+{
+    Sequence DAS_COMMENT((char *)) _temp_make_local_37_11_0; _temp_make_local_37_11_0;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_36_11_1; _temp_make_local_36_11_1;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_35_8_2; _temp_make_local_35_8_2;
+    return das_auto_cast<char *>::cast(_Funcstrings_boostTickjoinTick17792841289284275598_9eb525d02bb20b0a(__context__,das_arg<Sequence DAS_COMMENT((char *))>::pass((_temp_make_local_37_11_0 = (_FuncfunctionalTickmapTick3767370688684665805_2b43678bf41fa6ab(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_36_11_1 = (_FuncfunctionalTickfilterTick17052258911568430960_c5b51d79366e68ab(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_35_8_2 = (_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,mk_range(__total_rename_at_33_65))))),das_ascend<bool,_lambda_thismodule_36_1>::make(__context__,&__type_info__711719b90dc70505,(([&]() -> _lambda_thismodule_36_1 {
+        _lambda_thismodule_36_1 __mks_36;
+        das_copy((__mks_36.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_36_1`function XS<_lambda_thismodule_36_1> Ci*/ 0xa6c71b2098842b2))));
+        das_copy((__mks_36.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_36_1`finalizer X1<S<_lambda_thismodule_36_1>>?*/ 0xc1814d336a680f1d))));
+        das_copy((__mks_36.mod),(__mod_rename_at_33_66));
+        return __mks_36;
+    })())))))),das_ascend<char *,_lambda_thismodule_37_3>::make(__context__,&__type_info__71169fb90dc3528e,(([&]() -> _lambda_thismodule_37_3 {
+        _lambda_thismodule_37_3 __mks_37;
+        das_copy((__mks_37.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_37_3`function XS<_lambda_thismodule_37_3> Ci*/ 0x9aa1580df6ac8cfa))));
+        das_copy((__mks_37.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_37_3`finalizer X1<S<_lambda_thismodule_37_3>>?*/ 0x5e353bd3098fa6b0))));
+        return __mks_37;
+    })())))))),((char *) ",")));
+}
+
+inline char * testArr_94380748fea53281 ( Context * __context__, int32_t __total_rename_at_42_67, int32_t __mod_rename_at_42_68 ) { das_stack_prologue __prologue(__context__,192,"testArr " DAS_FILE_LINE);
+{
+    TArray<int32_t> __a1_rename_at_43_69; memset((void*)&__a1_rename_at_43_69,0,sizeof(__a1_rename_at_43_69));
+    TArray<int32_t> __a2_rename_at_44_70; memset((void*)&__a2_rename_at_44_70,0,sizeof(__a2_rename_at_44_70));
+    TArray<char *> __a3_rename_at_45_72; memset((void*)&__a3_rename_at_45_72,0,sizeof(__a3_rename_at_45_72));
+    /* finally */ auto __finally_42= das_finally([&](){
+    _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd(__context__,das_arg<TArray<int32_t>>::pass(__a1_rename_at_43_69));
+    _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd(__context__,das_arg<TArray<int32_t>>::pass(__a2_rename_at_44_70));
+    _FuncbuiltinTickfinalizeTick13836114024949725080_c48630585afa1450(__context__,das_arg<TArray<char *>>::pass(__a3_rename_at_45_72));
+    /* end finally */ });
+    __a1_rename_at_43_69; das_zero(__a1_rename_at_43_69); das_move(__a1_rename_at_43_69, each_a_d00c2f2e2d6e2fec(__context__,mk_range(__total_rename_at_42_67)));
+    __a2_rename_at_44_70; das_zero(__a2_rename_at_44_70); das_move(__a2_rename_at_44_70, _FuncTickfilter_aTick5010215866972275650_5b1d8a1fe5871669(__context__,das_arg<TArray<int32_t>>::pass(__a1_rename_at_43_69),das_make_block<bool,int32_t>(__context__,144,0,&__func_info__a722371d52e594ca,[&](int32_t const  __x_rename_at_44_71) -> bool{
+        return das_auto_cast<bool>::cast((SimPolicy<int32_t>::Mod(__x_rename_at_44_71,__mod_rename_at_42_68,*__context__,nullptr)) == 0);
+    })));
+    __a3_rename_at_45_72; das_zero(__a3_rename_at_45_72); das_move(__a3_rename_at_45_72, _FuncTickmap_aTick10570152363785132454_c30eab3e39a946d0(__context__,das_arg<TArray<int32_t>>::pass(__a2_rename_at_44_70),das_make_block<char *,int32_t>(__context__,176,0,&__func_info__bc7827c239b16a42,[&](int32_t const  __x_rename_at_45_73) -> char *{
+        return das_auto_cast<char *>::cast(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_2, cast<int32_t>::from(__x_rename_at_45_73))));
+    })));
+    return das_auto_cast<char *>::cast(_Funcstrings_boostTickjoinTick16475640899284277631_2d62f8289a864db9(__context__,das_arg<TArray<char *>>::pass(__a3_rename_at_45_72),((char *) ",")));
+}}
+
+inline char * testLoop_3620c0f3147780e6 ( Context * __context__, int32_t __total_rename_at_53_74, int32_t __mod_rename_at_53_75 )
+{
+    char * __st_rename_at_54_76 = ((char *)(char *)(((char * const )(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_54_77) DAS_AOT_INLINE_LAMBDA -> void{
+        bool __skip_first_rename_at_55_78 = true;
+        {
+            bool __need_loop_56 = true;
+            // t: int const
+            das_iterator<range> __t_iterator(mk_range(__total_rename_at_53_74));
+            int32_t __t_rename_at_56_79;
+            __need_loop_56 = __t_iterator.first(__context__,(__t_rename_at_56_79)) && __need_loop_56;
+            for ( ; __need_loop_56 ; __need_loop_56 = __t_iterator.next(__context__,(__t_rename_at_56_79)) )
+            {
+                if ( (SimPolicy<int32_t>::Mod(__t_rename_at_56_79,__mod_rename_at_53_75,*__context__,nullptr)) == 0 )
+                {
+                    if ( __skip_first_rename_at_55_78 )
+                    {
+                        das_copy(__skip_first_rename_at_55_78,false);
+                    } else {
+                        das_call_interop<StringBuilderWriter &>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_5,cast<StringBuilderWriter &>::from(__writer_rename_at_54_77),cast<char * const >::from(((char *) ","))));
+                    };
+                    das_call_interop<StringBuilderWriter &>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_5,cast<StringBuilderWriter &>::from(__writer_rename_at_54_77),cast<char * const >::from(((char * const )(das_lexical_cast_int_i32(__t_rename_at_56_79,false,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))))))));
+                };
+            }
+            __t_iterator.close(__context__,(__t_rename_at_56_79));
+        };
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+    return das_auto_cast<char *>::cast(__st_rename_at_54_76);
+}
+
+inline void main_9357d4abf7575f64 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,128,"main " DAS_FILE_LINE);
+{
+    char * __s1_rename_at_72_80 = 0; char * __s2_rename_at_72_81 = 0; char * __s3_rename_at_72_82 = 0;
+    builtin_profile(40,((char *) "testLoop"),das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        das_copy(__s1_rename_at_72_80,testLoop_3620c0f3147780e6(__context__,1000000,99961));
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    builtin_profile(40,((char *) "testGen"),das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        das_copy(__s2_rename_at_72_81,testGen_bb615616a4fcfc12(__context__,1000000,99961));
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    builtin_profile(40,((char *) "testArr"),das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        das_copy(__s3_rename_at_72_82,testArr_94380748fea53281(__context__,1000000,99961));
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    DAS_ASSERT((((SimPolicy<char *>::Equ(cast<char *>::from(__s1_rename_at_72_80),cast<char *>::from(__s2_rename_at_72_81),*__context__,nullptr)) && (SimPolicy<char *>::Equ(cast<char *>::from(__s1_rename_at_72_80),cast<char *>::from(__s3_rename_at_72_82),*__context__,nullptr))) && (SimPolicy<char *>::Equ(cast<char *>::from(__s2_rename_at_72_81),cast<char *>::from(__s3_rename_at_72_82),*__context__,nullptr))));
+}}
+static vec4f __wrap__Funcstrings_boostTickjoinTick17792841289284275598_9eb525d02bb20b0a ( Context * __context__ ) {
+    Sequence DAS_COMMENT((char *)) &  arg_it = cast_aot_arg<Sequence DAS_COMMENT((char *)) & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_separator = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<char *>::from(_Funcstrings_boostTickjoinTick17792841289284275598_9eb525d02bb20b0a(__context__, arg_it, arg_separator));
+}
+static vec4f __wrap_finalize_69aa3a09e58af584 ( Context * __context__ ) {
+    _lambda_thismodule_46_4 &  arg___this = cast_aot_arg<_lambda_thismodule_46_4 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_69aa3a09e58af584(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeachTick9663565701927713696_ea44c1aecdd0f1da ( Context * __context__ ) {
+    Lambda DAS_COMMENT((bool,char * &)) const  arg_lam = cast_aot_arg<Lambda DAS_COMMENT((bool,char * &)) const >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((char *)) *) __context__->abiCMRES) = _FuncbuiltinTickeachTick9663565701927713696_ea44c1aecdd0f1da(__context__, arg_lam);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_46_4Tickfunction_c95a5e730aa40d62 ( Context * __context__ ) {
+    _lambda_thismodule_46_4 &  arg___this = cast_aot_arg<_lambda_thismodule_46_4 & >::to(*__context__,__context__->abiArguments()[0]);
+    char * & arg__yield_46 = cast_aot_arg<char * &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_46_4Tickfunction_c95a5e730aa40d62(__context__, arg___this, arg__yield_46));
+}
+static vec4f __wrap__Func_lambda_thismodule_46_4Tickfinalizer_ebcd6d6e9a09a235 ( Context * __context__ ) {
+    _lambda_thismodule_46_4 * arg___this = cast_aot_arg<_lambda_thismodule_46_4 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_46_4Tickfinalizer_ebcd6d6e9a09a235(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_41e6b8419a5110a2 ( Context * __context__ ) {
+    _lambda_thismodule_37_3 &  arg___this = cast_aot_arg<_lambda_thismodule_37_3 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_41e6b8419a5110a2(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_37_3Tickfunction_583b2b666d793cf7 ( Context * __context__ ) {
+    _lambda_thismodule_37_3 &  arg___this = cast_aot_arg<_lambda_thismodule_37_3 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<char *>::from(_Func_lambda_thismodule_37_3Tickfunction_583b2b666d793cf7(__context__, arg___this, arg_x));
+}
+static vec4f __wrap__Func_lambda_thismodule_37_3Tickfinalizer_ad7732bd3d3ce91d ( Context * __context__ ) {
+    _lambda_thismodule_37_3 * arg___this = cast_aot_arg<_lambda_thismodule_37_3 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_37_3Tickfinalizer_ad7732bd3d3ce91d(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickmap_anyTick4479995923280306007_5f49aaba923b52cc ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Lambda DAS_COMMENT((char * const ,int32_t)) arg_blk = cast_aot_arg<Lambda DAS_COMMENT((char * const ,int32_t))>::to(*__context__,__context__->abiArguments()[1]);
+    *((Sequence DAS_COMMENT((char *)) *) __context__->abiCMRES) = _FuncfunctionalTickmap_anyTick4479995923280306007_5f49aaba923b52cc(__context__, arg_src, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickmapTick3767370688684665805_2b43678bf41fa6ab ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Lambda DAS_COMMENT((char * const ,int32_t)) const  arg_blk = cast_aot_arg<Lambda DAS_COMMENT((char * const ,int32_t)) const >::to(*__context__,__context__->abiArguments()[1]);
+    *((Sequence DAS_COMMENT((char *)) *) __context__->abiCMRES) = _FuncfunctionalTickmapTick3767370688684665805_2b43678bf41fa6ab(__context__, arg_src, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap_finalize_22fd9f64238d0802 ( Context * __context__ ) {
+    _lambda_thismodule_12_2 &  arg___this = cast_aot_arg<_lambda_thismodule_12_2 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_22fd9f64238d0802(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeachTick9663565701927713696_95fc75174fdfbb63 ( Context * __context__ ) {
+    Lambda DAS_COMMENT((bool,int32_t &)) const  arg_lam = cast_aot_arg<Lambda DAS_COMMENT((bool,int32_t &)) const >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncbuiltinTickeachTick9663565701927713696_95fc75174fdfbb63(__context__, arg_lam);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_12_2Tickfunction_d4ece7bc4f0cf6f0 ( Context * __context__ ) {
+    _lambda_thismodule_12_2 &  arg___this = cast_aot_arg<_lambda_thismodule_12_2 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg__yield_12 = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_12_2Tickfunction_d4ece7bc4f0cf6f0(__context__, arg___this, arg__yield_12));
+}
+static vec4f __wrap__Func_lambda_thismodule_12_2Tickfinalizer_978d8b4685edb984 ( Context * __context__ ) {
+    _lambda_thismodule_12_2 * arg___this = cast_aot_arg<_lambda_thismodule_12_2 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_12_2Tickfinalizer_978d8b4685edb984(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_f6ba8f280706e2f1 ( Context * __context__ ) {
+    _lambda_thismodule_36_1 &  arg___this = cast_aot_arg<_lambda_thismodule_36_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_f6ba8f280706e2f1(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a5393f36ccdac4a8 ( Context * __context__ ) {
+    TArray<char *> &  arg_a = cast_aot_arg<TArray<char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<TArray<char *> &>::from(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a5393f36ccdac4a8(__context__, arg_a));
+}
+static vec4f __wrap__Func_lambda_thismodule_36_1Tickfunction_94ba09db636eeeb0 ( Context * __context__ ) {
+    _lambda_thismodule_36_1 &  arg___this = cast_aot_arg<_lambda_thismodule_36_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_36_1Tickfunction_94ba09db636eeeb0(__context__, arg___this, arg_x));
+}
+static vec4f __wrap__Func_lambda_thismodule_36_1Tickfinalizer_973e5f0c5881503e ( Context * __context__ ) {
+    _lambda_thismodule_36_1 * arg___this = cast_aot_arg<_lambda_thismodule_36_1 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_36_1Tickfinalizer_973e5f0c5881503e(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickfinalizeTick13836114024949725080_c48630585afa1450 ( Context * __context__ ) {
+    TArray<char *> &  arg_a = cast_aot_arg<TArray<char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickfinalizeTick13836114024949725080_c48630585afa1450(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickfilter_anyTick8436123068441528563_cde984da2e211a80 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Lambda DAS_COMMENT((bool,int32_t)) arg_blk = cast_aot_arg<Lambda DAS_COMMENT((bool,int32_t))>::to(*__context__,__context__->abiArguments()[1]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncfunctionalTickfilter_anyTick8436123068441528563_cde984da2e211a80(__context__, arg_src, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickreserveTick3994685146752941225_9b1d42232444f681 ( Context * __context__ ) {
+    TArray<char *> &  arg_Arr = cast_aot_arg<TArray<char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickreserveTick3994685146752941225_9b1d42232444f681(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpushTick14133213201864676143_a73bd8f330e36d49 ( Context * __context__ ) {
+    TArray<char *> &  arg_Arr = cast_aot_arg<TArray<char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_value = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick14133213201864676143_a73bd8f330e36d49(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__Funcstrings_boostTickjoinTick16475640899284277631_2d62f8289a864db9 ( Context * __context__ ) {
+    TArray<char *> const  &  arg_it = cast_aot_arg<TArray<char *> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_separator = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<char *>::from(_Funcstrings_boostTickjoinTick16475640899284277631_2d62f8289a864db9(__context__, arg_it, arg_separator));
+}
+static vec4f __wrap__FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<TArray<int32_t> &>::from(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14(__context__, arg_a));
+}
+static vec4f __wrap__FuncfunctionalTickfilterTick17052258911568430960_c5b51d79366e68ab ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Lambda DAS_COMMENT((bool,int32_t)) const  arg_blk = cast_aot_arg<Lambda DAS_COMMENT((bool,int32_t)) const >::to(*__context__,__context__->abiArguments()[1]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncfunctionalTickfilterTick17052258911568430960_c5b51d79366e68ab(__context__, arg_src, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickmap_aTick10570152363785132454_c30eab3e39a946d0 ( Context * __context__ ) {
+    TArray<int32_t> const  &  arg_src = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((char * const ,int32_t)) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((char * const ,int32_t)) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    *((TArray<char *> *) __context__->abiCMRES) = _FuncTickmap_aTick10570152363785132454_c30eab3e39a946d0(__context__, arg_src, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_value = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 ( Context * __context__ ) {
+    range arg_rng = cast_aot_arg<range>::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__, arg_rng);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickfilter_aTick5010215866972275650_5b1d8a1fe5871669 ( Context * __context__ ) {
+    TArray<int32_t> const  &  arg_src = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((bool,int32_t)) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((bool,int32_t)) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncTickfilter_aTick5010215866972275650_5b1d8a1fe5871669(__context__, arg_src, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap_each_a_d00c2f2e2d6e2fec ( Context * __context__ ) {
+    range arg_r = cast_aot_arg<range>::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = each_a_d00c2f2e2d6e2fec(__context__, arg_r);
+    return v_zero();
+}
+static vec4f __wrap_testGen_bb615616a4fcfc12 ( Context * __context__ ) {
+    int32_t arg_total = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_mod = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<char *>::from(testGen_bb615616a4fcfc12(__context__, arg_total, arg_mod));
+}
+static vec4f __wrap_testArr_94380748fea53281 ( Context * __context__ ) {
+    int32_t arg_total = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_mod = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<char *>::from(testArr_94380748fea53281(__context__, arg_total, arg_mod));
+}
+static vec4f __wrap_testLoop_3620c0f3147780e6 ( Context * __context__ ) {
+    int32_t arg_total = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_mod = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<char *>::from(testLoop_3620c0f3147780e6(__context__, arg_total, arg_mod));
+}
+static vec4f __wrap_main_9357d4abf7575f64 ( Context * __context__ ) {
+    main_9357d4abf7575f64(__context__);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x34148dbf930887dc, false, (void*)&_Funcstrings_boostTickjoinTick17792841289284275598_9eb525d02bb20b0a, &__wrap__Funcstrings_boostTickjoinTick17792841289284275598_9eb525d02bb20b0a },
+    { 0x21d6fa602a9748ca, false, (void*)&finalize_69aa3a09e58af584, &__wrap_finalize_69aa3a09e58af584 },
+    { 0x4e2325917b18ea92, true, (void*)&_FuncbuiltinTickeachTick9663565701927713696_ea44c1aecdd0f1da, &__wrap__FuncbuiltinTickeachTick9663565701927713696_ea44c1aecdd0f1da },
+    { 0x1ea497eb34df63b1, false, (void*)&_Func_lambda_thismodule_46_4Tickfunction_c95a5e730aa40d62, &__wrap__Func_lambda_thismodule_46_4Tickfunction_c95a5e730aa40d62 },
+    { 0x58b94cbae25080f4, false, (void*)&_Func_lambda_thismodule_46_4Tickfinalizer_ebcd6d6e9a09a235, &__wrap__Func_lambda_thismodule_46_4Tickfinalizer_ebcd6d6e9a09a235 },
+    { 0x2c3b506528371a3e, false, (void*)&finalize_41e6b8419a5110a2, &__wrap_finalize_41e6b8419a5110a2 },
+    { 0x61917a04be9ce75d, false, (void*)&_Func_lambda_thismodule_37_3Tickfunction_583b2b666d793cf7, &__wrap__Func_lambda_thismodule_37_3Tickfunction_583b2b666d793cf7 },
+    { 0x711d1416f2ff439e, false, (void*)&_Func_lambda_thismodule_37_3Tickfinalizer_ad7732bd3d3ce91d, &__wrap__Func_lambda_thismodule_37_3Tickfinalizer_ad7732bd3d3ce91d },
+    { 0xebd8c513c82d0fa5, true, (void*)&_FuncfunctionalTickmap_anyTick4479995923280306007_5f49aaba923b52cc, &__wrap__FuncfunctionalTickmap_anyTick4479995923280306007_5f49aaba923b52cc },
+    { 0xf0cb55d6e7a287dd, true, (void*)&_FuncfunctionalTickmapTick3767370688684665805_2b43678bf41fa6ab, &__wrap__FuncfunctionalTickmapTick3767370688684665805_2b43678bf41fa6ab },
+    { 0xe9880fa5176a0197, false, (void*)&finalize_22fd9f64238d0802, &__wrap_finalize_22fd9f64238d0802 },
+    { 0x9b406130b212b1c1, true, (void*)&_FuncbuiltinTickeachTick9663565701927713696_95fc75174fdfbb63, &__wrap__FuncbuiltinTickeachTick9663565701927713696_95fc75174fdfbb63 },
+    { 0x8094762e7ba6ec1f, false, (void*)&_Func_lambda_thismodule_12_2Tickfunction_d4ece7bc4f0cf6f0, &__wrap__Func_lambda_thismodule_12_2Tickfunction_d4ece7bc4f0cf6f0 },
+    { 0xdd36c1a25b9468ef, false, (void*)&_Func_lambda_thismodule_12_2Tickfinalizer_978d8b4685edb984, &__wrap__Func_lambda_thismodule_12_2Tickfinalizer_978d8b4685edb984 },
+    { 0xb2e4d79ad804599f, false, (void*)&finalize_f6ba8f280706e2f1, &__wrap_finalize_f6ba8f280706e2f1 },
+    { 0xb2aa7c99cd110c66, false, (void*)&_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a5393f36ccdac4a8, &__wrap__FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a5393f36ccdac4a8 },
+    { 0x19993fd21d11a469, false, (void*)&_Func_lambda_thismodule_36_1Tickfunction_94ba09db636eeeb0, &__wrap__Func_lambda_thismodule_36_1Tickfunction_94ba09db636eeeb0 },
+    { 0x45e0bedf72697891, false, (void*)&_Func_lambda_thismodule_36_1Tickfinalizer_973e5f0c5881503e, &__wrap__Func_lambda_thismodule_36_1Tickfinalizer_973e5f0c5881503e },
+    { 0x41c609d917127ba6, false, (void*)&_FuncbuiltinTickfinalizeTick13836114024949725080_c48630585afa1450, &__wrap__FuncbuiltinTickfinalizeTick13836114024949725080_c48630585afa1450 },
+    { 0xe98681dd10c44def, true, (void*)&_FuncfunctionalTickfilter_anyTick8436123068441528563_cde984da2e211a80, &__wrap__FuncfunctionalTickfilter_anyTick8436123068441528563_cde984da2e211a80 },
+    { 0x8557e752b52d3379, false, (void*)&_FuncbuiltinTickreserveTick3994685146752941225_9b1d42232444f681, &__wrap__FuncbuiltinTickreserveTick3994685146752941225_9b1d42232444f681 },
+    { 0x4a9a547cf73d3b9c, false, (void*)&_FuncbuiltinTickpushTick14133213201864676143_a73bd8f330e36d49, &__wrap__FuncbuiltinTickpushTick14133213201864676143_a73bd8f330e36d49 },
+    { 0x61c57fcc3ac50491, false, (void*)&_Funcstrings_boostTickjoinTick16475640899284277631_2d62f8289a864db9, &__wrap__Funcstrings_boostTickjoinTick16475640899284277631_2d62f8289a864db9 },
+    { 0x78ccaa663d73fb1b, false, (void*)&_FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76, &__wrap__FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76 },
+    { 0x17892cd516a9a747, false, (void*)&_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14, &__wrap__FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 },
+    { 0x22eafb176392a8fb, true, (void*)&_FuncfunctionalTickfilterTick17052258911568430960_c5b51d79366e68ab, &__wrap__FuncfunctionalTickfilterTick17052258911568430960_c5b51d79366e68ab },
+    { 0x7f3b5a006edda539, true, (void*)&_FuncTickmap_aTick10570152363785132454_c30eab3e39a946d0, &__wrap__FuncTickmap_aTick10570152363785132454_c30eab3e39a946d0 },
+    { 0x84908fa671ce3a30, false, (void*)&_FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd, &__wrap__FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd },
+    { 0xbf77bb210b0552bc, false, (void*)&_FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39, &__wrap__FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 },
+    { 0xf426d9532c77b0a4, true, (void*)&_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015, &__wrap__FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 },
+    { 0xee94f70ad33ed17e, true, (void*)&_FuncTickfilter_aTick5010215866972275650_5b1d8a1fe5871669, &__wrap__FuncTickfilter_aTick5010215866972275650_5b1d8a1fe5871669 },
+    { 0x215fa34851766394, true, (void*)&each_a_d00c2f2e2d6e2fec, &__wrap_each_a_d00c2f2e2d6e2fec },
+    { 0x68373a0c1f5b8ba5, false, (void*)&testGen_bb615616a4fcfc12, &__wrap_testGen_bb615616a4fcfc12 },
+    { 0x6b481bd872f74b69, false, (void*)&testArr_94380748fea53281, &__wrap_testArr_94380748fea53281 },
+    { 0x77402a969e5deae4, false, (void*)&testLoop_3620c0f3147780e6, &__wrap_testLoop_3620c0f3147780e6 },
+    { 0x6b10b34bc22c1617, false, (void*)&main_9357d4abf7575f64, &__wrap_main_9357d4abf7575f64 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_2503596952094661452
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,138 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_12288889999065679170 {
+
+extern TypeInfo __type_info__af63eb4c86020609;
+
+FuncInfo __func_info__955909f57bd61177 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x955909f57bd61177), 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline int32_t _FuncTickfibRTick13868665842688650599_82e8a55b375d413a ( Context * __context__, int32_t __n_rename_at_7_0 );
+inline int32_t _FuncTickfibRHTick7980353361109652760_c7ba9b8a868db0ca ( Context * __context__, int32_t __n_rename_at_15_1 );
+inline void main_e74be60058084c55 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t _FuncTickfibRTick13868665842688650599_82e8a55b375d413a ( Context * __context__, int32_t __n_rename_at_7_0 )
+{
+    return das_auto_cast<int32_t>::cast((__n_rename_at_7_0 < 2) ? das_auto_cast<int32_t>::cast(__n_rename_at_7_0) : das_auto_cast<int32_t>::cast((_FuncTickfibRTick13868665842688650599_82e8a55b375d413a(__context__,__n_rename_at_7_0 - 1) + _FuncTickfibRTick13868665842688650599_82e8a55b375d413a(__context__,__n_rename_at_7_0 - 2))));
+}
+
+inline int32_t _FuncTickfibRHTick7980353361109652760_c7ba9b8a868db0ca ( Context * __context__, int32_t __n_rename_at_15_1 )
+{
+    return das_auto_cast<int32_t>::cast((__n_rename_at_15_1 < 2) ? das_auto_cast<int32_t>::cast(__n_rename_at_15_1) : das_auto_cast<int32_t>::cast((das_invoke_function<int32_t>::invoke<int32_t>(__context__,nullptr,Func(__context__->fnByMangledName(/*`fibRH`7980353361109652760 CXi*/ 0xeece4a5efcf5d6e)),__n_rename_at_15_1 - 1) + das_invoke_function<int32_t>::invoke<int32_t>(__context__,nullptr,Func(__context__->fnByMangledName(/*`fibRH`7980353361109652760 CXi*/ 0xeece4a5efcf5d6e)),__n_rename_at_15_1 - 2))));
+}
+
+inline void main_e74be60058084c55 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,112,"main " DAS_FILE_LINE);
+{
+    int32_t __f1_rename_at_24_2 = 0;
+    builtin_profile(20,((char *) "fibonacci recursive"),das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        das_copy(__f1_rename_at_24_2,_FuncTickfibRTick13868665842688650599_82e8a55b375d413a(__context__,31));
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    DAS_ASSERT((__f1_rename_at_24_2 == 1346269));
+    int32_t __f3_rename_at_29_3 = 0;
+    builtin_profile(20,((char *) "fibonacci recursive, hybrid"),das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        das_copy(__f3_rename_at_29_3,das_invoke_function<int32_t>::invoke<int32_t>(__context__,nullptr,Func(__context__->fnByMangledName(/*`fibRH`7980353361109652760 CXi*/ 0xeece4a5efcf5d6e)),31));
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    DAS_ASSERT((__f3_rename_at_29_3 == 1346269));
+}}
+static vec4f __wrap__FuncTickfibRTick13868665842688650599_82e8a55b375d413a ( Context * __context__ ) {
+    int32_t arg_n = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(_FuncTickfibRTick13868665842688650599_82e8a55b375d413a(__context__, arg_n));
+}
+static vec4f __wrap__FuncTickfibRHTick7980353361109652760_c7ba9b8a868db0ca ( Context * __context__ ) {
+    int32_t arg_n = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(_FuncTickfibRHTick7980353361109652760_c7ba9b8a868db0ca(__context__, arg_n));
+}
+static vec4f __wrap_main_e74be60058084c55 ( Context * __context__ ) {
+    main_e74be60058084c55(__context__);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xd71e6f3a1b8cf53e, false, (void*)&_FuncTickfibRTick13868665842688650599_82e8a55b375d413a, &__wrap__FuncTickfibRTick13868665842688650599_82e8a55b375d413a },
+    { 0x2ac0f6bfc34c3c01, false, (void*)&_FuncTickfibRHTick7980353361109652760_c7ba9b8a868db0ca, &__wrap__FuncTickfibRHTick7980353361109652760_c7ba9b8a868db0ca },
+    { 0x4095a40f4aac43a6, false, (void*)&main_e74be60058084c55, &__wrap_main_e74be60058084c55 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_12288889999065679170
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,211 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_10078601710371312353 {
+
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+    int32_t x;
+    int32_t y;
+    int32_t z;
+    int32_t w;
+};
+static_assert(sizeof(Foo)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,z)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,w)==12,"structure field offset mismatch with DAS");
+}
+extern TypeInfo __type_info__af63eb4c86020609;
+
+FuncInfo __func_info__955909f57bd61177 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x955909f57bd61177), 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline Foo make_1_d05c580b837a2f2 ( Context * __context__ );
+inline Foo make_2_e433d1a26e8354ba ( Context * __context__ );
+inline int32_t test_1_315016b6f6ebdde1 ( Context * __context__ );
+inline int32_t test_2_5e35596f27264e13 ( Context * __context__ );
+inline void main_c974103ab02085f5 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Foo make_1_d05c580b837a2f2 ( Context * __context__ )
+{
+    Foo __t_rename_at_8_0;das_zero(__t_rename_at_8_0);
+    das_copy(__t_rename_at_8_0.x,1);
+    das_copy(__t_rename_at_8_0.y,2);
+    das_copy(__t_rename_at_8_0.z,3);
+    das_copy(__t_rename_at_8_0.w,4);
+    return das_auto_cast_ref<Foo>::cast(__t_rename_at_8_0);
+}
+
+inline Foo make_2_e433d1a26e8354ba ( Context * __context__ )
+{
+    return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+        Foo __mks_18;
+        das_copy((__mks_18.x),(1));
+        das_copy((__mks_18.y),(2));
+        das_copy((__mks_18.z),(3));
+        das_copy((__mks_18.w),(4));
+        return __mks_18;
+    })()));
+}
+
+inline int32_t test_1_315016b6f6ebdde1 ( Context * __context__ )
+{
+    int32_t __q_rename_at_23_1 = 0;
+    {
+        bool __need_loop_24 = true;
+        // x: int const
+        das_iterator<range> __x_iterator(range(0,1000000));
+        int32_t __x_rename_at_24_2;
+        __need_loop_24 = __x_iterator.first(__context__,(__x_rename_at_24_2)) && __need_loop_24;
+        for ( ; __need_loop_24 ; __need_loop_24 = __x_iterator.next(__context__,(__x_rename_at_24_2)) )
+        {
+            Foo _temp_make_local_25_13_0; _temp_make_local_25_13_0;
+            __q_rename_at_23_1 += (_temp_make_local_25_13_0 = (make_1_d05c580b837a2f2(__context__))).x;
+        }
+        __x_iterator.close(__context__,(__x_rename_at_24_2));
+    };
+    return das_auto_cast<int32_t>::cast(__q_rename_at_23_1);
+}
+
+inline int32_t test_2_5e35596f27264e13 ( Context * __context__ )
+{
+    int32_t __q_rename_at_32_3 = 0;
+    {
+        bool __need_loop_33 = true;
+        // x: int const
+        das_iterator<range> __x_iterator(range(0,1000000));
+        int32_t __x_rename_at_33_4;
+        __need_loop_33 = __x_iterator.first(__context__,(__x_rename_at_33_4)) && __need_loop_33;
+        for ( ; __need_loop_33 ; __need_loop_33 = __x_iterator.next(__context__,(__x_rename_at_33_4)) )
+        {
+            Foo _temp_make_local_34_13_1; _temp_make_local_34_13_1;
+            __q_rename_at_32_3 += (_temp_make_local_34_13_1 = (make_2_e433d1a26e8354ba(__context__))).x;
+        }
+        __x_iterator.close(__context__,(__x_rename_at_33_4));
+    };
+    return das_auto_cast<int32_t>::cast(__q_rename_at_32_3);
+}
+
+inline void main_c974103ab02085f5 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,112,"main " DAS_FILE_LINE);
+{
+    int32_t __q1_rename_at_41_5 = 0;
+    builtin_profile(20,((char *) "make t.x=1;..."),das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        das_copy(__q1_rename_at_41_5,test_1_315016b6f6ebdde1(__context__));
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    DAS_ASSERT((__q1_rename_at_41_5 == 1000000));
+    int32_t __q2_rename_at_46_6 = 0;
+    builtin_profile(20,((char *) "make [[Foo x=1;...]]"),das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        das_copy(__q2_rename_at_46_6,test_2_5e35596f27264e13(__context__));
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    DAS_ASSERT((__q2_rename_at_46_6 == 1000000));
+}}
+static vec4f __wrap_make_1_d05c580b837a2f2 ( Context * __context__ ) {
+    *((Foo *) __context__->abiCMRES) = make_1_d05c580b837a2f2(__context__);
+    return v_zero();
+}
+static vec4f __wrap_make_2_e433d1a26e8354ba ( Context * __context__ ) {
+    *((Foo *) __context__->abiCMRES) = make_2_e433d1a26e8354ba(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_1_315016b6f6ebdde1 ( Context * __context__ ) {
+    return cast<int32_t>::from(test_1_315016b6f6ebdde1(__context__));
+}
+static vec4f __wrap_test_2_5e35596f27264e13 ( Context * __context__ ) {
+    return cast<int32_t>::from(test_2_5e35596f27264e13(__context__));
+}
+static vec4f __wrap_main_c974103ab02085f5 ( Context * __context__ ) {
+    main_c974103ab02085f5(__context__);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x4e718b8445f61bbd, true, (void*)&make_1_d05c580b837a2f2, &__wrap_make_1_d05c580b837a2f2 },
+    { 0x37d2a217346c11cc, true, (void*)&make_2_e433d1a26e8354ba, &__wrap_make_2_e433d1a26e8354ba },
+    { 0x277c9d6f76d8d2da, false, (void*)&test_1_315016b6f6ebdde1, &__wrap_test_1_315016b6f6ebdde1 },
+    { 0x13e9da7211017bab, false, (void*)&test_2_5e35596f27264e13, &__wrap_test_2_5e35596f27264e13 },
+    { 0xe386886f3d73fd1, false, (void*)&main_c974103ab02085f5, &__wrap_main_c974103ab02085f5 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_10078601710371312353
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,283 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_3528176666897533358 {
+
+namespace  { struct body; };
+namespace  {
+
+struct body {
+    double x;
+    double y;
+    double z;
+    double vx;
+    double vy;
+    double vz;
+    double mass;
+};
+static_assert(sizeof(body)==56,"structure size mismatch with DAS");
+static_assert(offsetof(body,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,y)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,z)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,vx)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,vy)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,vz)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,mass)==48,"structure field offset mismatch with DAS");
+}
+extern TypeInfo __type_info__af63eb4c86020609;
+
+FuncInfo __func_info__955909f57bd61177 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x955909f57bd61177), 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncTickadvanceTick12642410686408744208_e4926211b3985117 ( Context * __context__, double __dt_rename_at_31_0, TDim<body,5> & __bodies_rename_at_31_1 );
+inline void offset_momentum_68e76ed247bb4a31 ( Context * __context__, TDim<body,5> & __bodies_rename_at_19_11 );
+inline void main_b4f47b6ecc409649 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global<TDim<body,5>,0x56be5dfda63435ab>(__context__) = (([&]() -> TDim<body,5> {
+        TDim<body,5> __mka_71;
+        das_zero(__mka_71);
+        __mka_71(0,__context__) = (([&]() -> body {
+            body __mks_71;
+            das_zero(__mks_71);
+            das_copy((__mks_71.mass),(3.947842e+01));
+            return __mks_71;
+        })());
+        __mka_71(1,__context__) = (([&]() -> body {
+            body __mks_73;
+            das_copy((__mks_73.x),(4.841431e+00));
+            das_copy((__mks_73.y),(-1.160320e+00));
+            das_copy((__mks_73.z),(-1.036220e-01));
+            das_copy((__mks_73.vx),(6.063264e-01));
+            das_copy((__mks_73.vy),(2.811987e+00));
+            das_copy((__mks_73.vz),(-2.521836e-02));
+            das_copy((__mks_73.mass),(3.769367e-02));
+            return __mks_73;
+        })());
+        __mka_71(2,__context__) = (([&]() -> body {
+            body __mks_77;
+            das_copy((__mks_77.x),(8.343367e+00));
+            das_copy((__mks_77.y),(4.124799e+00));
+            das_copy((__mks_77.z),(-4.035234e-01));
+            das_copy((__mks_77.vx),(-1.010774e+00));
+            das_copy((__mks_77.vy),(1.825662e+00));
+            das_copy((__mks_77.vz),(8.415761e-03));
+            das_copy((__mks_77.mass),(1.128633e-02));
+            return __mks_77;
+        })());
+        __mka_71(3,__context__) = (([&]() -> body {
+            body __mks_81;
+            das_copy((__mks_81.x),(1.289437e+01));
+            das_copy((__mks_81.y),(-1.511115e+01));
+            das_copy((__mks_81.z),(-2.233076e-01));
+            das_copy((__mks_81.vx),(1.082791e+00));
+            das_copy((__mks_81.vy),(8.687130e-01));
+            das_copy((__mks_81.vz),(-1.083264e-02));
+            das_copy((__mks_81.mass),(1.723724e-03));
+            return __mks_81;
+        })());
+        __mka_71(4,__context__) = (([&]() -> body {
+            body __mks_85;
+            das_copy((__mks_85.x),(1.537970e+01));
+            das_copy((__mks_85.y),(-2.591931e+01));
+            das_copy((__mks_85.z),(1.792588e-01));
+            das_copy((__mks_85.vx),(9.790907e-01));
+            das_copy((__mks_85.vy),(5.946990e-01));
+            das_copy((__mks_85.vz),(-3.475596e-02));
+            das_copy((__mks_85.mass),(2.033687e-03));
+            return __mks_85;
+        })());
+        return __mka_71;
+    })());/*g_bodies*/
+}
+
+inline void _FuncTickadvanceTick12642410686408744208_e4926211b3985117 ( Context * __context__, double __dt_rename_at_31_0, TDim<body,5> &  __bodies_rename_at_31_1 )
+{
+    int32_t __i_rename_at_32_2 = 0;
+    {
+        bool __need_loop_33 = true;
+        // b: body& -const
+        das_iterator<TDim<body,5>> __b_iterator(__bodies_rename_at_31_1);
+        body * __b_rename_at_33_3;
+        __need_loop_33 = __b_iterator.first(__context__,(__b_rename_at_33_3)) && __need_loop_33;
+        for ( ; __need_loop_33 ; __need_loop_33 = __b_iterator.next(__context__,(__b_rename_at_33_3)) )
+        {
+            ++__i_rename_at_32_2;
+            {
+                bool __need_loop_35 = true;
+                // j: int const
+                das_iterator<range> __j_iterator(range(__i_rename_at_32_2,5));
+                int32_t __j_rename_at_35_4;
+                __need_loop_35 = __j_iterator.first(__context__,(__j_rename_at_35_4)) && __need_loop_35;
+                for ( ; __need_loop_35 ; __need_loop_35 = __j_iterator.next(__context__,(__j_rename_at_35_4)) )
+                {
+                    body * __b2_rename_at_36_5 = &(__bodies_rename_at_31_1(__j_rename_at_35_4,__context__));
+                    double __dx_rename_at_37_6 = ((double)((*__b_rename_at_33_3).x - (*__b2_rename_at_36_5).x));
+                    double __dy_rename_at_38_7 = ((double)((*__b_rename_at_33_3).y - (*__b2_rename_at_36_5).y));
+                    double __dz_rename_at_39_8 = ((double)((*__b_rename_at_33_3).z - (*__b2_rename_at_36_5).z));
+                    double __dsq_rename_at_40_9 = ((double)(((__dx_rename_at_37_6 * __dx_rename_at_37_6) + (__dy_rename_at_38_7 * __dy_rename_at_38_7)) + (__dz_rename_at_39_8 * __dz_rename_at_39_8)));
+                    double __mag_rename_at_41_10 = ((double)(SimPolicy<double>::Div(__dt_rename_at_31_0,(__dsq_rename_at_40_9 * dsqrt(__dsq_rename_at_40_9)),*__context__,nullptr)));
+                    (*__b_rename_at_33_3).vx -= (__dx_rename_at_37_6 * ((*__b2_rename_at_36_5).mass * __mag_rename_at_41_10));
+                    (*__b_rename_at_33_3).vy -= (__dy_rename_at_38_7 * ((*__b2_rename_at_36_5).mass * __mag_rename_at_41_10));
+                    (*__b_rename_at_33_3).vz -= (__dz_rename_at_39_8 * ((*__b2_rename_at_36_5).mass * __mag_rename_at_41_10));
+                    (*__b2_rename_at_36_5).vx += (__dx_rename_at_37_6 * ((*__b_rename_at_33_3).mass * __mag_rename_at_41_10));
+                    (*__b2_rename_at_36_5).vy += (__dy_rename_at_38_7 * ((*__b_rename_at_33_3).mass * __mag_rename_at_41_10));
+                    (*__b2_rename_at_36_5).vz += (__dz_rename_at_39_8 * ((*__b_rename_at_33_3).mass * __mag_rename_at_41_10));
+                }
+                __j_iterator.close(__context__,(__j_rename_at_35_4));
+            };
+            (*__b_rename_at_33_3).x += (__dt_rename_at_31_0 * (*__b_rename_at_33_3).vx);
+            (*__b_rename_at_33_3).y += (__dt_rename_at_31_0 * (*__b_rename_at_33_3).vy);
+            (*__b_rename_at_33_3).z += (__dt_rename_at_31_0 * (*__b_rename_at_33_3).vz);
+        }
+        __b_iterator.close(__context__,(__b_rename_at_33_3));
+    };
+}
+
+inline void offset_momentum_68e76ed247bb4a31 ( Context * __context__, TDim<body,5> &  __bodies_rename_at_19_11 )
+{
+    double __px_rename_at_20_12 = 0; double __py_rename_at_20_13 = 0; double __pz_rename_at_20_14 = 0;
+    {
+        bool __need_loop_21 = true;
+        // b: body& -const
+        das_iterator<TDim<body,5>> __b_iterator(__bodies_rename_at_19_11);
+        body * __b_rename_at_21_15;
+        __need_loop_21 = __b_iterator.first(__context__,(__b_rename_at_21_15)) && __need_loop_21;
+        for ( ; __need_loop_21 ; __need_loop_21 = __b_iterator.next(__context__,(__b_rename_at_21_15)) )
+        {
+            __px_rename_at_20_12 -= ((*__b_rename_at_21_15).vx * (*__b_rename_at_21_15).mass);
+            __py_rename_at_20_13 -= ((*__b_rename_at_21_15).vy * (*__b_rename_at_21_15).mass);
+            __pz_rename_at_20_14 -= ((*__b_rename_at_21_15).vz * (*__b_rename_at_21_15).mass);
+        }
+        __b_iterator.close(__context__,(__b_rename_at_21_15));
+    };
+    das_copy(__bodies_rename_at_19_11(0,__context__).vx,SimPolicy<double>::Div(__px_rename_at_20_12,3.947842e+01,*__context__,nullptr));
+    das_copy(__bodies_rename_at_19_11(0,__context__).vy,SimPolicy<double>::Div(__py_rename_at_20_13,3.947842e+01,*__context__,nullptr));
+    das_copy(__bodies_rename_at_19_11(0,__context__).vz,SimPolicy<double>::Div(__pz_rename_at_20_14,3.947842e+01,*__context__,nullptr));
+}
+
+inline void main_b4f47b6ecc409649 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,96,"main " DAS_FILE_LINE);
+{
+    offset_momentum_68e76ed247bb4a31(__context__,das_arg<TDim<body,5>>::pass(das_global<TDim<body,5>,0x56be5dfda63435ab>(__context__) /*g_bodies*/));
+    builtin_profile(10,((char *) "n-bodies, naive (double)"),das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        {
+            bool __need_loop_97 = true;
+            // i: int const
+            das_iterator<range> __i_iterator(range(0,500000));
+            int32_t __i_rename_at_97_16;
+            __need_loop_97 = __i_iterator.first(__context__,(__i_rename_at_97_16)) && __need_loop_97;
+            for ( ; __need_loop_97 ; __need_loop_97 = __i_iterator.next(__context__,(__i_rename_at_97_16)) )
+            {
+                _FuncTickadvanceTick12642410686408744208_e4926211b3985117(__context__,1.000000e-02,das_arg<TDim<body,5>>::pass(das_global<TDim<body,5>,0x56be5dfda63435ab>(__context__) /*g_bodies*/));
+            }
+            __i_iterator.close(__context__,(__i_rename_at_97_16));
+        };
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}}
+static vec4f __wrap__FuncTickadvanceTick12642410686408744208_e4926211b3985117 ( Context * __context__ ) {
+    double arg_dt = cast_aot_arg<double>::to(*__context__,__context__->abiArguments()[0]);
+    TDim<body,5> &  arg_bodies = cast_aot_arg<TDim<body,5> & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTickadvanceTick12642410686408744208_e4926211b3985117(__context__, arg_dt, arg_bodies);
+    return v_zero();
+}
+static vec4f __wrap_offset_momentum_68e76ed247bb4a31 ( Context * __context__ ) {
+    TDim<body,5> &  arg_bodies = cast_aot_arg<TDim<body,5> & >::to(*__context__,__context__->abiArguments()[0]);
+    offset_momentum_68e76ed247bb4a31(__context__, arg_bodies);
+    return v_zero();
+}
+static vec4f __wrap_main_b4f47b6ecc409649 ( Context * __context__ ) {
+    main_b4f47b6ecc409649(__context__);
+    return v_zero();
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xb0a714946c790038, false, (void*)&_FuncTickadvanceTick12642410686408744208_e4926211b3985117, &__wrap__FuncTickadvanceTick12642410686408744208_e4926211b3985117 },
+    { 0xc45e4d2af2003e1c, false, (void*)&offset_momentum_68e76ed247bb4a31, &__wrap_offset_momentum_68e76ed247bb4a31 },
+    { 0x3b6250f9632f99da, false, (void*)&main_b4f47b6ecc409649, &__wrap_main_b4f47b6ecc409649 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x453b14f9caa48993, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_3528176666897533358
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,325 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_12896034592212907945 {
+
+namespace  { struct body; };
+namespace  {
+
+struct body {
+    float x;
+    float y;
+    float z;
+    float vx;
+    float vy;
+    float vz;
+    float mass;
+};
+static_assert(sizeof(body)==28,"structure size mismatch with DAS");
+static_assert(offsetof(body,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,z)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,vx)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,vy)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,vz)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,mass)==24,"structure field offset mismatch with DAS");
+}
+extern TypeInfo __type_info__af63eb4c86020609;
+
+FuncInfo __func_info__955909f57bd61177 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x955909f57bd61177), 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncTickscale_bodiesTick12496512915527025107_998cb092e63d64ed ( Context * __context__, float __scale_rename_at_90_0 );
+inline void _FuncTicknbodiesTick18010465477941779671_3bf52af36ae685b8 ( Context * __context__, int32_t __n_rename_at_99_2 );
+inline void offset_momentum_82852fb8e2aa4ffc ( Context * __context__ );
+inline void advance_e9258b9849f610c2 ( Context * __context__ );
+inline void main_d485aa39dfe0aa15 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global_solid<TDim<body,5>,0>(__context__) = (([&]() -> TDim<body,5> {
+        TDim<body,5> __mka_23;
+        __mka_23(0,__context__) = (([&]() -> body {
+            body __mks_23;
+            das_copy((__mks_23.x),(0.000000e+00f));
+            das_copy((__mks_23.y),(0.000000e+00f));
+            das_copy((__mks_23.z),(0.000000e+00f));
+            das_copy((__mks_23.vx),(0.000000e+00f));
+            das_copy((__mks_23.vy),(0.000000e+00f));
+            das_copy((__mks_23.vz),(0.000000e+00f));
+            das_copy((__mks_23.mass),(3.947842e+01f));
+            return __mks_23;
+        })());
+        __mka_23(1,__context__) = (([&]() -> body {
+            body __mks_25;
+            das_copy((__mks_25.x),(4.841432e+00f));
+            das_copy((__mks_25.y),(-1.160320e+00f));
+            das_copy((__mks_25.z),(-1.036220e-01f));
+            das_copy((__mks_25.vx),(6.063264e-01f));
+            das_copy((__mks_25.vy),(2.811987e+00f));
+            das_copy((__mks_25.vz),(-2.521836e-02f));
+            das_copy((__mks_25.mass),(3.769368e-02f));
+            return __mks_25;
+        })());
+        __mka_23(2,__context__) = (([&]() -> body {
+            body __mks_29;
+            das_copy((__mks_29.x),(8.343367e+00f));
+            das_copy((__mks_29.y),(4.124799e+00f));
+            das_copy((__mks_29.z),(-4.035234e-01f));
+            das_copy((__mks_29.vx),(-1.010774e+00f));
+            das_copy((__mks_29.vy),(1.825662e+00f));
+            das_copy((__mks_29.vz),(8.415761e-03f));
+            das_copy((__mks_29.mass),(1.128633e-02f));
+            return __mks_29;
+        })());
+        __mka_23(3,__context__) = (([&]() -> body {
+            body __mks_33;
+            das_copy((__mks_33.x),(1.289437e+01f));
+            das_copy((__mks_33.y),(-1.511115e+01f));
+            das_copy((__mks_33.z),(-2.233076e-01f));
+            das_copy((__mks_33.vx),(1.082791e+00f));
+            das_copy((__mks_33.vy),(8.687130e-01f));
+            das_copy((__mks_33.vz),(-1.083264e-02f));
+            das_copy((__mks_33.mass),(1.723724e-03f));
+            return __mks_33;
+        })());
+        __mka_23(4,__context__) = (([&]() -> body {
+            body __mks_37;
+            das_copy((__mks_37.x),(1.537970e+01f));
+            das_copy((__mks_37.y),(-2.591932e+01f));
+            das_copy((__mks_37.z),(1.792588e-01f));
+            das_copy((__mks_37.vx),(9.790907e-01f));
+            das_copy((__mks_37.vy),(5.946990e-01f));
+            das_copy((__mks_37.vz),(-3.475595e-02f));
+            das_copy((__mks_37.mass),(2.033687e-03f));
+            return __mks_37;
+        })());
+        return __mka_23;
+    })());/*bodies*/
+}
+
+inline void _FuncTickscale_bodiesTick12496512915527025107_998cb092e63d64ed ( Context * __context__, float __scale_rename_at_90_0 )
+{
+    {
+        bool __need_loop_91 = true;
+        // b: body&
+        das_iterator<TDim<body,5>> __b_iterator(das_global<TDim<body,5>,0x4a6a45d42a0ad482>(__context__) /*bodies*/);
+        body * __b_rename_at_91_1;
+        __need_loop_91 = __b_iterator.first(__context__,(__b_rename_at_91_1)) && __need_loop_91;
+        for ( ; __need_loop_91 ; __need_loop_91 = __b_iterator.next(__context__,(__b_rename_at_91_1)) )
+        {
+            (*__b_rename_at_91_1).mass *= (__scale_rename_at_90_0 * __scale_rename_at_90_0);
+            das_copy((*__b_rename_at_91_1).vx,(*__b_rename_at_91_1).vx * __scale_rename_at_90_0);
+            das_copy((*__b_rename_at_91_1).vy,(*__b_rename_at_91_1).vy * __scale_rename_at_90_0);
+            das_copy((*__b_rename_at_91_1).vz,(*__b_rename_at_91_1).vz * __scale_rename_at_90_0);
+        }
+        __b_iterator.close(__context__,(__b_rename_at_91_1));
+    };
+}
+
+inline void _FuncTicknbodiesTick18010465477941779671_3bf52af36ae685b8 ( Context * __context__, int32_t __n_rename_at_99_2 )
+{
+    _FuncTickscale_bodiesTick12496512915527025107_998cb092e63d64ed(__context__,1.000000e-02f);
+    {
+        bool __need_loop_101 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(mk_range(__n_rename_at_99_2));
+        int32_t __i_rename_at_101_3;
+        __need_loop_101 = __i_iterator.first(__context__,(__i_rename_at_101_3)) && __need_loop_101;
+        for ( ; __need_loop_101 ; __need_loop_101 = __i_iterator.next(__context__,(__i_rename_at_101_3)) )
+        {
+            advance_e9258b9849f610c2(__context__);
+        }
+        __i_iterator.close(__context__,(__i_rename_at_101_3));
+    };
+    _FuncTickscale_bodiesTick12496512915527025107_998cb092e63d64ed(__context__,1.000000e+02f);
+}
+
+inline void offset_momentum_82852fb8e2aa4ffc ( Context * __context__ )
+{
+    float __px_rename_at_49_4 = 0; float __py_rename_at_49_5 = 0; float __pz_rename_at_49_6 = 0;
+    {
+        bool __need_loop_50 = true;
+        // b: body&
+        das_iterator<TDim<body,5>> __b_iterator(das_global<TDim<body,5>,0x4a6a45d42a0ad482>(__context__) /*bodies*/);
+        body * __b_rename_at_50_7;
+        __need_loop_50 = __b_iterator.first(__context__,(__b_rename_at_50_7)) && __need_loop_50;
+        for ( ; __need_loop_50 ; __need_loop_50 = __b_iterator.next(__context__,(__b_rename_at_50_7)) )
+        {
+            __px_rename_at_49_4 -= ((*__b_rename_at_50_7).vx * (*__b_rename_at_50_7).mass);
+            __py_rename_at_49_5 -= ((*__b_rename_at_50_7).vy * (*__b_rename_at_50_7).mass);
+            __pz_rename_at_49_6 -= ((*__b_rename_at_50_7).vz * (*__b_rename_at_50_7).mass);
+        }
+        __b_iterator.close(__context__,(__b_rename_at_50_7));
+    };
+    das_copy(das_global<TDim<body,5>,0x4a6a45d42a0ad482>(__context__) /*bodies*/(0,__context__).vx,SimPolicy<float>::Div(__px_rename_at_49_4,3.947842e+01f,*__context__,nullptr));
+    das_copy(das_global<TDim<body,5>,0x4a6a45d42a0ad482>(__context__) /*bodies*/(0,__context__).vy,SimPolicy<float>::Div(__py_rename_at_49_5,3.947842e+01f,*__context__,nullptr));
+    das_copy(das_global<TDim<body,5>,0x4a6a45d42a0ad482>(__context__) /*bodies*/(0,__context__).vz,SimPolicy<float>::Div(__pz_rename_at_49_6,3.947842e+01f,*__context__,nullptr));
+}
+
+inline void advance_e9258b9849f610c2 ( Context * __context__ )
+{
+    {
+        bool __need_loop_62 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(0,5));
+        int32_t __i_rename_at_62_8;
+        __need_loop_62 = __i_iterator.first(__context__,(__i_rename_at_62_8)) && __need_loop_62;
+        for ( ; __need_loop_62 ; __need_loop_62 = __i_iterator.next(__context__,(__i_rename_at_62_8)) )
+        {
+            body * __b_rename_at_63_9 = &(das_global<TDim<body,5>,0x4a6a45d42a0ad482>(__context__) /*bodies*/(__i_rename_at_62_8,__context__));
+            {
+                bool __need_loop_64 = true;
+                // j: int const
+                das_iterator<range> __j_iterator(range(__i_rename_at_62_8 + 1,5));
+                int32_t __j_rename_at_64_10;
+                __need_loop_64 = __j_iterator.first(__context__,(__j_rename_at_64_10)) && __need_loop_64;
+                for ( ; __need_loop_64 ; __need_loop_64 = __j_iterator.next(__context__,(__j_rename_at_64_10)) )
+                {
+                    body * __b2_rename_at_65_11 = &(das_global<TDim<body,5>,0x4a6a45d42a0ad482>(__context__) /*bodies*/(__j_rename_at_64_10,__context__));
+                    float __dx_rename_at_66_12 = ((float)((*__b_rename_at_63_9).x - (*__b2_rename_at_65_11).x));
+                    float __dy_rename_at_67_13 = ((float)((*__b_rename_at_63_9).y - (*__b2_rename_at_65_11).y));
+                    float __dz_rename_at_68_14 = ((float)((*__b_rename_at_63_9).z - (*__b2_rename_at_65_11).z));
+                    float __inv_distance_rename_at_69_15 = ((float)(SimPolicy<float>::Div(1.000000e+00f,SimPolicy<float>::Sqrt(((__dx_rename_at_66_12 * __dx_rename_at_66_12) + (__dy_rename_at_67_13 * __dy_rename_at_67_13)) + (__dz_rename_at_68_14 * __dz_rename_at_68_14),*__context__,nullptr),*__context__,nullptr)));
+                    float __mag_rename_at_70_16 = ((float)((__inv_distance_rename_at_69_15 * __inv_distance_rename_at_69_15) * __inv_distance_rename_at_69_15));
+                    das_copy((*__b_rename_at_63_9).vx,(*__b_rename_at_63_9).vx - (__dx_rename_at_66_12 * ((*__b2_rename_at_65_11).mass * __mag_rename_at_70_16)));
+                    das_copy((*__b_rename_at_63_9).vy,(*__b_rename_at_63_9).vy - (__dy_rename_at_67_13 * ((*__b2_rename_at_65_11).mass * __mag_rename_at_70_16)));
+                    das_copy((*__b_rename_at_63_9).vz,(*__b_rename_at_63_9).vz - (__dz_rename_at_68_14 * ((*__b2_rename_at_65_11).mass * __mag_rename_at_70_16)));
+                    das_copy((*__b2_rename_at_65_11).vx,(*__b2_rename_at_65_11).vx + (__dx_rename_at_66_12 * ((*__b_rename_at_63_9).mass * __mag_rename_at_70_16)));
+                    das_copy((*__b2_rename_at_65_11).vy,(*__b2_rename_at_65_11).vy + (__dy_rename_at_67_13 * ((*__b_rename_at_63_9).mass * __mag_rename_at_70_16)));
+                    das_copy((*__b2_rename_at_65_11).vz,(*__b2_rename_at_65_11).vz + (__dz_rename_at_68_14 * ((*__b_rename_at_63_9).mass * __mag_rename_at_70_16)));
+                }
+                __j_iterator.close(__context__,(__j_rename_at_64_10));
+            };
+            (*__b_rename_at_63_9).x += (*__b_rename_at_63_9).vx;
+            (*__b_rename_at_63_9).y += (*__b_rename_at_63_9).vy;
+            (*__b_rename_at_63_9).z += (*__b_rename_at_63_9).vz;
+        }
+        __i_iterator.close(__context__,(__i_rename_at_62_8));
+    };
+}
+
+inline void main_d485aa39dfe0aa15 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,80,"main " DAS_FILE_LINE);
+{
+    offset_momentum_82852fb8e2aa4ffc(__context__);
+    builtin_profile(10,((char *) "n-bodies, scalar"),das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        _FuncTicknbodiesTick18010465477941779671_3bf52af36ae685b8(__context__,500000);
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}}
+static vec4f __wrap__FuncTickscale_bodiesTick12496512915527025107_998cb092e63d64ed ( Context * __context__ ) {
+    float arg_scale = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickscale_bodiesTick12496512915527025107_998cb092e63d64ed(__context__, arg_scale);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicknbodiesTick18010465477941779671_3bf52af36ae685b8 ( Context * __context__ ) {
+    int32_t arg_n = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicknbodiesTick18010465477941779671_3bf52af36ae685b8(__context__, arg_n);
+    return v_zero();
+}
+static vec4f __wrap_offset_momentum_82852fb8e2aa4ffc ( Context * __context__ ) {
+    offset_momentum_82852fb8e2aa4ffc(__context__);
+    return v_zero();
+}
+static vec4f __wrap_advance_e9258b9849f610c2 ( Context * __context__ ) {
+    advance_e9258b9849f610c2(__context__);
+    return v_zero();
+}
+static vec4f __wrap_main_d485aa39dfe0aa15 ( Context * __context__ ) {
+    main_d485aa39dfe0aa15(__context__);
+    return v_zero();
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x88f9baeb8a8d4d13, false, (void*)&_FuncTickscale_bodiesTick12496512915527025107_998cb092e63d64ed, &__wrap__FuncTickscale_bodiesTick12496512915527025107_998cb092e63d64ed },
+    { 0x4b70269ca29ff754, false, (void*)&_FuncTicknbodiesTick18010465477941779671_3bf52af36ae685b8, &__wrap__FuncTicknbodiesTick18010465477941779671_3bf52af36ae685b8 },
+    { 0x224b168c20a2384d, false, (void*)&offset_momentum_82852fb8e2aa4ffc, &__wrap_offset_momentum_82852fb8e2aa4ffc },
+    { 0x9651e391622be699, false, (void*)&advance_e9258b9849f610c2, &__wrap_advance_e9258b9849f610c2 },
+    { 0x616fb9b8a9156f39, false, (void*)&main_d485aa39dfe0aa15, &__wrap_main_d485aa39dfe0aa15 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0xcee92107ed206bc9, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_12896034592212907945
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
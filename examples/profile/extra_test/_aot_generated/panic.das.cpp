@@ -0,0 +1,157 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_4734217966864447040 {
+
+extern TypeInfo __type_info__af63eb4c86020609;
+
+FuncInfo __func_info__955909f57bd61177 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x955909f57bd61177), 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void tryCatch_4f4b8307084da972 ( Context * __context__ );
+inline void main_6b44c8ce3ca4af28 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void tryCatch_4f4b8307084da972 ( Context * __context__ )
+{
+    TDim<int32_t,1000> __arr_rename_at_6_0_ConstRef;das_zero(__arr_rename_at_6_0_ConstRef);
+    TDim<int32_t,1000> const  & __arr_rename_at_6_0 = __arr_rename_at_6_0_ConstRef;
+;
+    int32_t __cnt_rename_at_7_1 = 0;
+    {
+        bool __need_loop_8 = true;
+        // j: int const
+        das_iterator<range> __j_iterator(range(0,100));
+        int32_t __j_rename_at_8_2;
+        __need_loop_8 = __j_iterator.first(__context__,(__j_rename_at_8_2)) && __need_loop_8;
+        for ( ; __need_loop_8 ; __need_loop_8 = __j_iterator.next(__context__,(__j_rename_at_8_2)) )
+        {
+            int32_t __fail_rename_at_9_3 = 0;
+            {
+                bool __need_loop_10 = true;
+                // i: int const
+                das_iterator<range> __i_iterator(range(0,2000));
+                int32_t __i_rename_at_10_4;
+                __need_loop_10 = __i_iterator.first(__context__,(__i_rename_at_10_4)) && __need_loop_10;
+                for ( ; __need_loop_10 ; __need_loop_10 = __i_iterator.next(__context__,(__i_rename_at_10_4)) )
+                {
+                    das_try_recover(__context__, [&]()
+                    {
+                        __cnt_rename_at_7_1 += __arr_rename_at_6_0(__i_rename_at_10_4,__context__);
+                    }, [&]()
+                    {
+                        ++__fail_rename_at_9_3;
+                    });
+                }
+                __i_iterator.close(__context__,(__i_rename_at_10_4));
+            };
+            DAS_ASSERT((__fail_rename_at_9_3 == 1000));
+        }
+        __j_iterator.close(__context__,(__j_rename_at_8_2));
+    };
+}
+
+inline void main_6b44c8ce3ca4af28 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,80,"main " DAS_FILE_LINE);
+{
+    builtin_profile(20,((char *) "try-recover"),das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        tryCatch_4f4b8307084da972(__context__);
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    builtin_profile(20,((char *) "try-recover c++"),das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        testTryCatch(__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}}
+static vec4f __wrap_tryCatch_4f4b8307084da972 ( Context * __context__ ) {
+    tryCatch_4f4b8307084da972(__context__);
+    return v_zero();
+}
+static vec4f __wrap_main_6b44c8ce3ca4af28 ( Context * __context__ ) {
+    main_6b44c8ce3ca4af28(__context__);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x6714cd1945f7f08a, false, (void*)&tryCatch_4f4b8307084da972, &__wrap_tryCatch_4f4b8307084da972 },
+    { 0x42ca3775fd291bdf, false, (void*)&main_6b44c8ce3ca4af28, &__wrap_main_6b44c8ce3ca4af28 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_4734217966864447040
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
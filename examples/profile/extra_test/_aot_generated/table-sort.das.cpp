@@ -0,0 +1,175 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_3869975517000405539 {
+
+extern TypeInfo __type_info__af63eb4c86020609;
+
+FuncInfo __func_info__955909f57bd61177 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x955909f57bd61177), 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline void _FuncbuiltinTicksortTick14088969635007481283_fd6ac0e411144b9 ( Context * __context__, TArray<int32_t> & __a_rename_at_1677_2 );
+inline void makeRandomSequence_b953c9af530f2c08 ( Context * __context__, TArray<int32_t> & __src_rename_at_7_3 );
+inline void main_c04e83ffebd5a7c6 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTicksortTick14088969635007481283_fd6ac0e411144b9 ( Context * __context__, TArray<int32_t> &  __a_rename_at_1677_2 )
+{
+    if ( builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_1677_2)) <= 1 )
+    {
+        return ;
+    } else {
+        builtin_array_lock(das_arg<TArray<int32_t>>::pass(__a_rename_at_1677_2),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        builtin_sort<int32_t>(das_ref(__context__,__a_rename_at_1677_2(0,__context__)),builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_1677_2)));
+        builtin_array_unlock(das_arg<TArray<int32_t>>::pass(__a_rename_at_1677_2),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    };
+}
+
+inline void makeRandomSequence_b953c9af530f2c08 ( Context * __context__, TArray<int32_t> &  __src_rename_at_7_3 )
+{
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__src_rename_at_7_3),2000000);
+    {
+        bool __need_loop_11 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(0,2000000));
+        int32_t __i_rename_at_11_4;
+        __need_loop_11 = __i_iterator.first(__context__,(__i_rename_at_11_4)) && __need_loop_11;
+        for ( ; __need_loop_11 ; __need_loop_11 = __i_iterator.next(__context__,(__i_rename_at_11_4)) )
+        {
+            das_copy(__src_rename_at_7_3(__i_rename_at_11_4,__context__),int32_t(uint_noise1D(__i_rename_at_11_4,0x1u)));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_11_4));
+    };
+}
+
+inline void main_c04e83ffebd5a7c6 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,176,"main " DAS_FILE_LINE);
+{
+    TArray<int32_t> __tab_rename_at_18_5;das_zero(__tab_rename_at_18_5);
+    makeRandomSequence_b953c9af530f2c08(__context__,das_arg<TArray<int32_t>>::pass(__tab_rename_at_18_5));
+    builtin_profile(1,((char *) "table-sort"),das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        _FuncbuiltinTicksortTick14088969635007481283_fd6ac0e411144b9(__context__,das_arg<TArray<int32_t>>::pass(__tab_rename_at_18_5));
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    makeRandomSequence_b953c9af530f2c08(__context__,das_arg<TArray<int32_t>>::pass(__tab_rename_at_18_5));
+    builtin_profile(1,((char *) "table-sort-cmp"),das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        builtin_sort_array_any_ref_cblock_T(das_arg<TArray<int32_t>>::pass(__tab_rename_at_18_5),4,0,[&](int32_t const  __a_rename_at_25_6, int32_t const  __b_rename_at_25_7) DAS_AOT_INLINE_LAMBDA -> bool{
+            return das_auto_cast<bool>::cast(!(__a_rename_at_25_6 < __b_rename_at_25_7));
+        },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTicksortTick14088969635007481283_fd6ac0e411144b9 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTicksortTick14088969635007481283_fd6ac0e411144b9(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap_makeRandomSequence_b953c9af530f2c08 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_src = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    makeRandomSequence_b953c9af530f2c08(__context__, arg_src);
+    return v_zero();
+}
+static vec4f __wrap_main_c04e83ffebd5a7c6 ( Context * __context__ ) {
+    main_c04e83ffebd5a7c6(__context__);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xa51a880d594e91fd, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c },
+    { 0xa007c0ac9becf6f2, false, (void*)&_FuncbuiltinTicksortTick14088969635007481283_fd6ac0e411144b9, &__wrap__FuncbuiltinTicksortTick14088969635007481283_fd6ac0e411144b9 },
+    { 0x14c2c1f7180a7d5c, false, (void*)&makeRandomSequence_b953c9af530f2c08, &__wrap_makeRandomSequence_b953c9af530f2c08 },
+    { 0xa19aeba2f6b8a81b, false, (void*)&main_c04e83ffebd5a7c6, &__wrap_main_c04e83ffebd5a7c6 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_3869975517000405539
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,378 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+#include "daScript/ast/ast_generate.h"
+ // require jit
+#include "daScript/simulate/aot_builtin_jit.h"
+#include "daScript/misc/sysos.h"
+ // require random
+ // require _framework
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_16796391157570949316 {
+
+namespace ast { struct AstFunctionAnnotation; };
+namespace ast { struct AstBlockAnnotation; };
+namespace ast { struct AstStructureAnnotation; };
+namespace ast { struct AstPassMacro; };
+namespace ast { struct AstVariantMacro; };
+namespace ast { struct AstForLoopMacro; };
+namespace ast { struct AstCaptureMacro; };
+namespace ast { struct AstTypeMacro; };
+namespace ast { struct AstSimulateMacro; };
+namespace ast { struct AstReaderMacro; };
+namespace ast { struct AstCommentReader; };
+namespace ast { struct AstCallMacro; };
+namespace ast { struct AstTypeInfoMacro; };
+namespace ast { struct AstEnumerationAnnotation; };
+namespace ast { struct AstVisitor; };
+namespace random { struct _lambda_random_112_1; };
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+// unused enumeration ConversionResult
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstFunctionAnnotation
+// unused structure AstBlockAnnotation
+// unused structure AstStructureAnnotation
+// unused structure AstPassMacro
+// unused structure AstVariantMacro
+// unused structure AstForLoopMacro
+// unused structure AstCaptureMacro
+// unused structure AstTypeMacro
+// unused structure AstSimulateMacro
+// unused structure AstReaderMacro
+// unused structure AstCommentReader
+// unused structure AstCallMacro
+// unused structure AstTypeInfoMacro
+// unused structure AstEnumerationAnnotation
+// unused structure AstVisitor
+// unused structure _lambda_random_112_1
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__a3f0477a4765213e;
+extern TypeInfo __type_info__af63e44c8601fa24;
+
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__a3f0477a4765213e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xa3f0477a4765213e) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__a3f0477a4765213e, &__type_info__af90fe4c864e9d52 };
+
+inline bool _FuncbuiltinTickkey_existsTick16808803843923989214_268daca8bf1e4baf ( Context * __context__, TTable<int32_t,void> const  & __Tab_rename_at_1040_0, int32_t __at_rename_at_1040_1 );
+inline void _FuncbuiltinTickinsertTick10959621454228962049_51719e0c1c9dcb16 ( Context * __context__, TTable<int32_t,void> & __Tab_rename_at_811_2, int32_t __at_rename_at_811_3 );
+inline void _FuncbuiltinTickpushTick10769833213962245646_b2287abd57a15f1f ( Context * __context__, TArray<int32_t> & __Arr_rename_at_193_4, int32_t __value_rename_at_193_5 );
+inline int32_t _FuncrandomTickrandom_big_intTick6064554311639177623_79b896eb5784a6a7 ( Context * __context__, int4 & __seed_rename_at_37_6 );
+inline TArray<int32_t> & _FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 ( Context * __context__, TArray<int32_t> & __a_rename_at_50_8 );
+inline void _FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_137_9, int32_t __newSize_rename_at_137_10 );
+inline int4 _FuncrandomTickrandom_seedTick15287272150245073176_6991510ddb1b5a99 ( Context * __context__, int32_t __seed_rename_at_16_11 );
+inline int32_t _FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2 ( Context * __context__, int4 & __seed_rename_at_30_12 );
+inline TArray<int32_t> generate_unique_positive_random_numbers_5d288f26afee8b1d ( Context * __context__, int32_t __kNumberOfItems_rename_at_26_13 );
+inline TArray<int32_t> get_random_numbers_with_intersections_6edf25563691a997 ( Context * __context__, int32_t __factor_rename_at_42_19 );
+inline TArray<int32_t> get_random_numbers_with_intersections_10_5d36d979dd8b461a ( Context * __context__ );
+inline TArray<int32_t> get_random_numbers_with_intersections_50_a54aa15e9e8498a2 ( Context * __context__ );
+inline void shuffle_30aa833b427e2d66 ( Context * __context__, TArray<int32_t> & __data_rename_at_65_25, int4 & __seed_rename_at_65_26 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global<int32_t,0x227cf711cdf116e1>(__context__) = 1;/*TEST_REPEAT_COUNT*/
+    das_global<int32_t,0x7280b5806dc22aa>(__context__) = 1000000;/*TOTAL_RANDOM_NUMBERS*/
+}
+
+inline bool _FuncbuiltinTickkey_existsTick16808803843923989214_268daca8bf1e4baf ( Context * __context__, TTable<int32_t,void> const  &  __Tab_rename_at_1040_0, int32_t __at_rename_at_1040_1 )
+{
+    return das_auto_cast<bool>::cast(__builtin_table_key_exists(__context__,__Tab_rename_at_1040_0,__at_rename_at_1040_1));
+}
+
+inline void _FuncbuiltinTickinsertTick10959621454228962049_51719e0c1c9dcb16 ( Context * __context__, TTable<int32_t,void> &  __Tab_rename_at_811_2, int32_t __at_rename_at_811_3 )
+{
+    __builtin_table_set_insert(__context__,__Tab_rename_at_811_2,__at_rename_at_811_3);
+}
+
+inline void _FuncbuiltinTickpushTick10769833213962245646_b2287abd57a15f1f ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_193_4, int32_t __value_rename_at_193_5 )
+{
+    das_copy(__Arr_rename_at_193_4(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_193_4),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_193_5);
+}
+
+inline int32_t _FuncrandomTickrandom_big_intTick6064554311639177623_79b896eb5784a6a7 ( Context * __context__, int4 & __seed_rename_at_37_6 )
+{
+    das_copy(__seed_rename_at_37_6,SimPolicy<int4>::Add((SimPolicy<int4>::Mul(int4(214013,214013,214013,214013),__seed_rename_at_37_6,*__context__,nullptr)),int4(2531011,2531011,2531011,2531011),*__context__,nullptr));
+    int2 __i12_rename_at_40_7 = ((int2)(SimPolicy<int2>::BinAnd((SimPolicy<int2>::BinShr(das_swizzle_seq<int2,int4,0>::swizzle(__seed_rename_at_37_6) /*xy*/,cast<int32_t>::from(16),*__context__,nullptr)),int2(32767,32767),*__context__,nullptr)));
+    return das_auto_cast<int32_t>::cast(v_extract_xi(v_cast_vec4i(__i12_rename_at_40_7)) /*x*/ + (SimPolicy<int32_t>::BinShl(v_extract_yi(v_cast_vec4i(__i12_rename_at_40_7)) /*y*/,15,*__context__,nullptr)));
+}
+
+inline TArray<int32_t> & _FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 ( Context * __context__, TArray<int32_t> &  __a_rename_at_50_8 )
+{
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<TArray<int32_t> &>::from(__a_rename_at_50_8),cast<char * const >::from(((char *) "object can't be returned because it is locked"))));
+    return das_auto_cast_ref<TArray<int32_t> &>::cast(__a_rename_at_50_8);
+}
+
+inline void _FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_137_9, int32_t __newSize_rename_at_137_10 )
+{
+    builtin_array_reserve(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_137_9),__newSize_rename_at_137_10,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline int4 _FuncrandomTickrandom_seedTick15287272150245073176_6991510ddb1b5a99 ( Context * __context__, int32_t __seed_rename_at_16_11 )
+{
+    return das_auto_cast<int4>::cast(int4(__seed_rename_at_16_11,__seed_rename_at_16_11 + 1,__seed_rename_at_16_11 + 2,__seed_rename_at_16_11 + 3));
+}
+
+inline int32_t _FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2 ( Context * __context__, int4 & __seed_rename_at_30_12 )
+{
+    das_copy(das_swizzle_ref<int32_t,int4,0>::swizzle(__seed_rename_at_30_12) /*x*/,(v_extract_xi(v_cast_vec4i(__seed_rename_at_30_12)) /*x*/ * 214013) + 2531011);
+    return das_auto_cast<int32_t>::cast((SimPolicy<int32_t>::BinShr(v_extract_xi(v_cast_vec4i(__seed_rename_at_30_12)) /*x*/,16,*__context__,nullptr)) & 32767);
+}
+
+inline TArray<int32_t> generate_unique_positive_random_numbers_5d288f26afee8b1d ( Context * __context__, int32_t __kNumberOfItems_rename_at_26_13 )
+{
+    TArray<int32_t> __data_rename_at_27_14;das_zero(__data_rename_at_27_14);
+    _FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76(__context__,das_arg<TArray<int32_t>>::pass(__data_rename_at_27_14),__kNumberOfItems_rename_at_26_13);
+    int4 __seed_rename_at_29_15 = int4(13,14,15,16);
+    TTable<int32_t,void> __set_rename_at_30_16;das_zero(__set_rename_at_30_16);
+    {
+        bool __need_loop_31 = true;
+        // r: int const
+        das_iterator<range> __r_iterator(mk_range(__kNumberOfItems_rename_at_26_13));
+        int32_t __r_rename_at_31_17;
+        __need_loop_31 = __r_iterator.first(__context__,(__r_rename_at_31_17)) && __need_loop_31;
+        for ( ; __need_loop_31 ; __need_loop_31 = __r_iterator.next(__context__,(__r_rename_at_31_17)) )
+        {
+            int32_t __n_rename_at_32_18 = _FuncrandomTickrandom_big_intTick6064554311639177623_79b896eb5784a6a7(__context__,__seed_rename_at_29_15);
+            while ( _FuncbuiltinTickkey_existsTick16808803843923989214_268daca8bf1e4baf(__context__,das_arg<TTable<int32_t,void>>::pass(__set_rename_at_30_16),__n_rename_at_32_18) )
+            {
+                das_copy(__n_rename_at_32_18,_FuncrandomTickrandom_big_intTick6064554311639177623_79b896eb5784a6a7(__context__,__seed_rename_at_29_15));
+            };
+            _FuncbuiltinTickinsertTick10959621454228962049_51719e0c1c9dcb16(__context__,das_arg<TTable<int32_t,void>>::pass(__set_rename_at_30_16),__n_rename_at_32_18);
+            _FuncbuiltinTickpushTick10769833213962245646_b2287abd57a15f1f(__context__,das_arg<TArray<int32_t>>::pass(__data_rename_at_27_14),__n_rename_at_32_18);
+        }
+        __r_iterator.close(__context__,(__r_rename_at_31_17));
+    };
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14(__context__,das_arg<TArray<int32_t>>::pass(__data_rename_at_27_14)));
+}
+
+inline TArray<int32_t> get_random_numbers_with_intersections_6edf25563691a997 ( Context * __context__, int32_t __factor_rename_at_42_19 )
+{
+    TArray<int32_t> __data_rename_at_43_20; das_zero(__data_rename_at_43_20); das_move(__data_rename_at_43_20, generate_unique_positive_random_numbers_5d288f26afee8b1d(__context__,1000000));
+    int32_t __cutoff_rename_at_44_21 = ((int32_t)(SimPolicy<int32_t>::Div(builtin_array_size(das_arg<TArray<int32_t>>::pass(__data_rename_at_43_20)),__factor_rename_at_42_19,*__context__,nullptr)));
+    int32_t __j_rename_at_45_22 = int32_t(__cutoff_rename_at_44_21);
+    {
+        bool __need_loop_46 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(mk_range(__cutoff_rename_at_44_21));
+        int32_t __i_rename_at_46_23;
+        __need_loop_46 = __i_iterator.first(__context__,(__i_rename_at_46_23)) && __need_loop_46;
+        for ( ; __need_loop_46 ; __need_loop_46 = __i_iterator.next(__context__,(__i_rename_at_46_23)) )
+        {
+            das_move(__data_rename_at_43_20(__i_rename_at_46_23,__context__),__data_rename_at_43_20(__j_rename_at_45_22,__context__));
+            ++__j_rename_at_45_22;
+        }
+        __i_iterator.close(__context__,(__i_rename_at_46_23));
+    };
+    int4 __seed_rename_at_50_24 = int4(13,14,15,16);
+    shuffle_30aa833b427e2d66(__context__,das_arg<TArray<int32_t>>::pass(__data_rename_at_43_20),__seed_rename_at_50_24);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14(__context__,das_arg<TArray<int32_t>>::pass(__data_rename_at_43_20)));
+}
+
+inline TArray<int32_t> get_random_numbers_with_intersections_10_5d36d979dd8b461a ( Context * __context__ )
+{
+    TArray<int32_t> _temp_make_local_57_14_0; _temp_make_local_57_14_0;
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14(__context__,das_arg<TArray<int32_t>>::pass((_temp_make_local_57_14_0 = (get_random_numbers_with_intersections_6edf25563691a997(__context__,10))))));
+}
+
+inline TArray<int32_t> get_random_numbers_with_intersections_50_a54aa15e9e8498a2 ( Context * __context__ )
+{
+    TArray<int32_t> _temp_make_local_62_14_1; _temp_make_local_62_14_1;
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14(__context__,das_arg<TArray<int32_t>>::pass((_temp_make_local_62_14_1 = (get_random_numbers_with_intersections_6edf25563691a997(__context__,2))))));
+}
+
+inline void shuffle_30aa833b427e2d66 ( Context * __context__, TArray<int32_t> &  __data_rename_at_65_25, int4 & __seed_rename_at_65_26 )
+{
+    int32_t __len_rename_at_66_27 = ((int32_t)builtin_array_size(das_arg<TArray<int32_t>>::pass(__data_rename_at_65_25)));
+    {
+        bool __need_loop_67 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(mk_range(__len_rename_at_66_27));
+        int32_t __i_rename_at_67_28;
+        __need_loop_67 = __i_iterator.first(__context__,(__i_rename_at_67_28)) && __need_loop_67;
+        for ( ; __need_loop_67 ; __need_loop_67 = __i_iterator.next(__context__,(__i_rename_at_67_28)) )
+        {
+            int32_t __j_rename_at_68_29 = ((int32_t)SimPolicy<int32_t>::Abs(SimPolicy<int32_t>::Mod(_FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2(__context__,__seed_rename_at_65_26),__len_rename_at_66_27,*__context__,nullptr),*__context__,nullptr));
+            int32_t __temp_rename_at_69_30; das_zero(__temp_rename_at_69_30); das_move(__temp_rename_at_69_30, __data_rename_at_65_25(__i_rename_at_67_28,__context__));
+            das_move(__data_rename_at_65_25(__i_rename_at_67_28,__context__),__data_rename_at_65_25(__j_rename_at_68_29,__context__));
+            das_move(__data_rename_at_65_25(__j_rename_at_68_29,__context__),__temp_rename_at_69_30);
+        }
+        __i_iterator.close(__context__,(__i_rename_at_67_28));
+    };
+}
+static vec4f __wrap__FuncbuiltinTickkey_existsTick16808803843923989214_268daca8bf1e4baf ( Context * __context__ ) {
+    TTable<int32_t,void> const  &  arg_Tab = cast_aot_arg<TTable<int32_t,void> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_at = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_FuncbuiltinTickkey_existsTick16808803843923989214_268daca8bf1e4baf(__context__, arg_Tab, arg_at));
+}
+static vec4f __wrap__FuncbuiltinTickinsertTick10959621454228962049_51719e0c1c9dcb16 ( Context * __context__ ) {
+    TTable<int32_t,void> &  arg_Tab = cast_aot_arg<TTable<int32_t,void> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_at = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickinsertTick10959621454228962049_51719e0c1c9dcb16(__context__, arg_Tab, arg_at);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpushTick10769833213962245646_b2287abd57a15f1f ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_value = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick10769833213962245646_b2287abd57a15f1f(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__FuncrandomTickrandom_big_intTick6064554311639177623_79b896eb5784a6a7 ( Context * __context__ ) {
+    int4 & arg_seed = cast_aot_arg<int4 &>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(_FuncrandomTickrandom_big_intTick6064554311639177623_79b896eb5784a6a7(__context__, arg_seed));
+}
+static vec4f __wrap__FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<TArray<int32_t> &>::from(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14(__context__, arg_a));
+}
+static vec4f __wrap__FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncrandomTickrandom_seedTick15287272150245073176_6991510ddb1b5a99 ( Context * __context__ ) {
+    int32_t arg_seed = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int4>::from(_FuncrandomTickrandom_seedTick15287272150245073176_6991510ddb1b5a99(__context__, arg_seed));
+}
+static vec4f __wrap__FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2 ( Context * __context__ ) {
+    int4 & arg_seed = cast_aot_arg<int4 &>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(_FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2(__context__, arg_seed));
+}
+static vec4f __wrap_generate_unique_positive_random_numbers_5d288f26afee8b1d ( Context * __context__ ) {
+    int32_t arg_kNumberOfItems = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = generate_unique_positive_random_numbers_5d288f26afee8b1d(__context__, arg_kNumberOfItems);
+    return v_zero();
+}
+static vec4f __wrap_get_random_numbers_with_intersections_6edf25563691a997 ( Context * __context__ ) {
+    int32_t arg_factor = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = get_random_numbers_with_intersections_6edf25563691a997(__context__, arg_factor);
+    return v_zero();
+}
+static vec4f __wrap_get_random_numbers_with_intersections_10_5d36d979dd8b461a ( Context * __context__ ) {
+    *((TArray<int32_t> *) __context__->abiCMRES) = get_random_numbers_with_intersections_10_5d36d979dd8b461a(__context__);
+    return v_zero();
+}
+static vec4f __wrap_get_random_numbers_with_intersections_50_a54aa15e9e8498a2 ( Context * __context__ ) {
+    *((TArray<int32_t> *) __context__->abiCMRES) = get_random_numbers_with_intersections_50_a54aa15e9e8498a2(__context__);
+    return v_zero();
+}
+static vec4f __wrap_shuffle_30aa833b427e2d66 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_data = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int4 & arg_seed = cast_aot_arg<int4 &>::to(*__context__,__context__->abiArguments()[1]);
+    shuffle_30aa833b427e2d66(__context__, arg_data, arg_seed);
+    return v_zero();
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x7dfb42718b878190, false, (void*)&_FuncbuiltinTickkey_existsTick16808803843923989214_268daca8bf1e4baf, &__wrap__FuncbuiltinTickkey_existsTick16808803843923989214_268daca8bf1e4baf },
+    { 0x942d021d77d413f7, false, (void*)&_FuncbuiltinTickinsertTick10959621454228962049_51719e0c1c9dcb16, &__wrap__FuncbuiltinTickinsertTick10959621454228962049_51719e0c1c9dcb16 },
+    { 0xc457d81f8e94b71b, false, (void*)&_FuncbuiltinTickpushTick10769833213962245646_b2287abd57a15f1f, &__wrap__FuncbuiltinTickpushTick10769833213962245646_b2287abd57a15f1f },
+    { 0x4f51a1adec6b9043, false, (void*)&_FuncrandomTickrandom_big_intTick6064554311639177623_79b896eb5784a6a7, &__wrap__FuncrandomTickrandom_big_intTick6064554311639177623_79b896eb5784a6a7 },
+    { 0x17892cd516a9a747, false, (void*)&_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14, &__wrap__FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 },
+    { 0x78ccaa663d73fb1b, false, (void*)&_FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76, &__wrap__FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76 },
+    { 0xfd37050dd7eb860a, false, (void*)&_FuncrandomTickrandom_seedTick15287272150245073176_6991510ddb1b5a99, &__wrap__FuncrandomTickrandom_seedTick15287272150245073176_6991510ddb1b5a99 },
+    { 0xadb43fc11a384c17, false, (void*)&_FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2, &__wrap__FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2 },
+    { 0xcf83d979aacafc9d, true, (void*)&generate_unique_positive_random_numbers_5d288f26afee8b1d, &__wrap_generate_unique_positive_random_numbers_5d288f26afee8b1d },
+    { 0xf4f2261763b49276, true, (void*)&get_random_numbers_with_intersections_6edf25563691a997, &__wrap_get_random_numbers_with_intersections_6edf25563691a997 },
+    { 0x2a5ed127d194f8de, true, (void*)&get_random_numbers_with_intersections_10_5d36d979dd8b461a, &__wrap_get_random_numbers_with_intersections_10_5d36d979dd8b461a },
+    { 0x92b1ca67d0def2de, true, (void*)&get_random_numbers_with_intersections_50_a54aa15e9e8498a2, &__wrap_get_random_numbers_with_intersections_50_a54aa15e9e8498a2 },
+    { 0x32175f3e92c8a9e7, false, (void*)&shuffle_30aa833b427e2d66, &__wrap_shuffle_30aa833b427e2d66 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x98a0af0113bb301e, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_16796391157570949316
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
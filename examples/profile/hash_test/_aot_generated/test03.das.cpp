@@ -0,0 +1,8110 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+#include "daScript/ast/ast_generate.h"
+ // require jit
+#include "daScript/simulate/aot_builtin_jit.h"
+#include "daScript/misc/sysos.h"
+ // require fio
+#include "daScript/misc/performance_time.h"
+#include "daScript/simulate/aot_builtin_fio.h"
+ // require random
+ // require _framework
+ // require strings_boost
+ // require ast_boost
+ // require templates
+ // require contracts
+ // require array_boost
+ // require algorithm
+ // require templates_boost
+ // require macro_boost
+ // require defer
+ // require helpers
+ // require colors
+ // require match
+ // require utf8_utils
+ // require meta_ast
+ // require parser_generator
+ // require parse_macro
+ // require peg
+ // require spoof
+ // require hash_map
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_5392580973269650176 {
+
+namespace  { struct KHV_CuckooHashMap_test; };
+namespace  { struct CuckooHashMap_test; };
+namespace  { struct FlatHashMap_test; };
+namespace  { struct _lambda_thismodule_572_1; };
+namespace  { struct _lambda_thismodule_587_2; };
+namespace  { struct _lambda_thismodule_602_3; };
+namespace  { struct _lambda_thismodule_232_4; };
+namespace  { struct _lambda_thismodule_247_5; };
+namespace  { struct _lambda_thismodule_262_6; };
+namespace ast { struct AstFunctionAnnotation; };
+namespace ast { struct AstBlockAnnotation; };
+namespace ast { struct AstStructureAnnotation; };
+namespace ast { struct AstPassMacro; };
+namespace ast { struct AstVariantMacro; };
+namespace ast { struct AstForLoopMacro; };
+namespace ast { struct AstCaptureMacro; };
+namespace ast { struct AstTypeMacro; };
+namespace ast { struct AstSimulateMacro; };
+namespace ast { struct AstReaderMacro; };
+namespace ast { struct AstCommentReader; };
+namespace ast { struct AstCallMacro; };
+namespace ast { struct AstTypeInfoMacro; };
+namespace ast { struct AstEnumerationAnnotation; };
+namespace ast { struct AstVisitor; };
+namespace fio { struct df_header; };
+namespace random { struct _lambda_random_112_1; };
+namespace ast_boost { struct MacroMacro; };
+namespace ast_boost { struct TagFunctionAnnotation; };
+namespace ast_boost { struct TagStructureAnnotation; };
+namespace ast_boost { struct SetupAnyAnnotation; };
+namespace ast_boost { struct SetupFunctionAnnotation; };
+namespace ast_boost { struct SetupBlockAnnotation; };
+namespace ast_boost { struct SetupStructureAnnotation; };
+namespace ast_boost { struct SetupEnumerationAnnotation; };
+namespace ast_boost { struct SetupContractAnnotation; };
+namespace ast_boost { struct SetupReaderMacro; };
+namespace ast_boost { struct SetupCommentReader; };
+namespace ast_boost { struct SetupVariantMacro; };
+namespace ast_boost { struct SetupForLoopMacro; };
+namespace ast_boost { struct SetupCaptureMacro; };
+namespace ast_boost { struct SetupTypeMacro; };
+namespace ast_boost { struct SetupSimulateMacro; };
+namespace ast_boost { struct SetupCallMacro; };
+namespace ast_boost { struct SetupTypeInfoMacro; };
+namespace ast_boost { struct SetupInferMacro; };
+namespace ast_boost { struct SetupDirtyInferMacro; };
+namespace ast_boost { struct SetupLintMacro; };
+namespace ast_boost { struct SetupGlobalLintMacro; };
+namespace ast_boost { struct SetupOptimizationMacro; };
+namespace ast_boost { struct TagFunctionMacro; };
+namespace ast_boost { struct BetterRttiVisitor; };
+namespace templates { struct DecltypeMacro; };
+namespace templates { struct DecltypeNoRefMacro; };
+namespace templates { struct TemplateMacro; };
+namespace contracts { struct IsAnyType; };
+namespace contracts { struct IsAnyArrayMacro; };
+namespace contracts { struct IsAnyEnumMacro; };
+namespace contracts { struct IsAnyBitfieldMacro; };
+namespace contracts { struct IsAnyVectorType; };
+namespace contracts { struct IsAnyStructMacro; };
+namespace contracts { struct IsAnyNumericMacro; };
+namespace contracts { struct IsAnyWorkhorse; };
+namespace contracts { struct IsAnyWorkhorseNonPtrMacro; };
+namespace contracts { struct IsAnyTupleNonPtrMacro; };
+namespace contracts { struct IsAnyVariantNonPtrMacro; };
+namespace contracts { struct IsAnyFunctionNonPtrMacro; };
+namespace contracts { struct IsAnyLambdaMacro; };
+namespace contracts { struct IsRefMacro; };
+namespace contracts { struct IsPointer; };
+namespace contracts { struct IsClass; };
+namespace contracts { struct IsValueHandle; };
+namespace templates_boost { struct Template; };
+namespace templates_boost { struct TemplateVisitor; };
+namespace templates_boost { struct RemoveDerefVisitor; };
+namespace templates_boost { struct QRulesVisitor; };
+namespace templates_boost { struct AstQCallMacro; };
+namespace templates_boost { struct QMacro; };
+namespace templates_boost { struct QBlockMacro; };
+namespace templates_boost { struct QBlockToArrayMacro; };
+namespace templates_boost { struct QBlockExprMacro; };
+namespace templates_boost { struct QTypeMacro; };
+namespace templates_boost { struct AstQNamedMacro; };
+namespace templates_boost { struct AstQFunctionMacro; };
+namespace templates_boost { struct AstQVariableMacro; };
+namespace templates_boost { struct AstQNamedClassMacro; };
+namespace templates_boost { struct AstQMethodMacro; };
+namespace templates_boost { struct AstQNamedTemplateFunctionMacro; };
+namespace templates_boost { struct AstQNamedTemplateClassMacro; };
+namespace macro_boost { struct MacroVerifyMacro; };
+namespace macro_boost { struct CaptureBlock; };
+namespace macro_boost { struct CapturedVariable; };
+namespace macro_boost { struct ColletFinally; };
+namespace macro_boost { struct ColletLabels; };
+namespace macro_boost { struct ReturnSkipLockcheck; };
+namespace defer { struct DeferMacro; };
+namespace defer { struct DeferDeleteMacro; };
+namespace helpers { struct _lambda_helpers_26_1; };
+namespace match { struct MatchError; };
+namespace match { struct MatchTo; };
+namespace match { struct MatchMacro; };
+namespace match { struct StaticMatchMacro; };
+namespace match { struct MultiMatchMacro; };
+namespace match { struct StaticMultiMatchMacro; };
+namespace match { struct MatchAsIs; };
+namespace match { struct MatchCopy; };
+namespace meta_ast { struct Alternative; };
+namespace meta_ast { struct Rule_; };
+namespace meta_ast { struct Definition; };
+namespace parser_generator { struct ParserGenerator; };
+namespace parse_macro { struct MacroRule; };
+namespace parse_macro { struct ParseMacro; };
+namespace peg { struct ParsingError; };
+namespace spoof { struct SpoofTemplateReader; };
+namespace spoof { struct SpoofInvocation; };
+namespace spoof { struct SpoofInstanceReader; };
+namespace spoof { struct invocationParserTickid_0x0; };
+namespace spoof { struct invocationParserTickid_0x1; };
+// unused enumeration CompilationError
+#if 0 // external enum
+namespace rtti {
+
+enum class ConstMatters : int32_t {
+    no = int32_t(INT64_C(0)),
+    yes = int32_t(INT64_C(1)),
+};
+}
+#endif // external enum
+#if 0 // external enum
+namespace rtti {
+
+enum class RefMatters : int32_t {
+    no = int32_t(INT64_C(0)),
+    yes = int32_t(INT64_C(1)),
+};
+}
+#endif // external enum
+#if 0 // external enum
+namespace rtti {
+
+enum class TemporaryMatters : int32_t {
+    no = int32_t(INT64_C(0)),
+    yes = int32_t(INT64_C(1)),
+};
+}
+#endif // external enum
+#if 0 // external enum
+namespace rtti {
+
+enum class Type : int32_t {
+    none = int32_t(INT64_C(0)),
+    autoinfer = int32_t(INT64_C(1)),
+    alias = int32_t(INT64_C(2)),
+    option = int32_t(INT64_C(3)),
+    typeDecl = int32_t(INT64_C(4)),
+    typeMacro = int32_t(INT64_C(5)),
+    fakeContext = int32_t(INT64_C(6)),
+    fakeLineInfo = int32_t(INT64_C(7)),
+    anyArgument = int32_t(INT64_C(8)),
+    tVoid = int32_t(INT64_C(9)),
+    tBool = int32_t(INT64_C(10)),
+    tInt8 = int32_t(INT64_C(11)),
+    tUInt8 = int32_t(INT64_C(12)),
+    tInt16 = int32_t(INT64_C(13)),
+    tUInt16 = int32_t(INT64_C(14)),
+    tInt64 = int32_t(INT64_C(15)),
+    tUInt64 = int32_t(INT64_C(16)),
+    tInt = int32_t(INT64_C(17)),
+    tInt2 = int32_t(INT64_C(18)),
+    tInt3 = int32_t(INT64_C(19)),
+    tInt4 = int32_t(INT64_C(20)),
+    tUInt = int32_t(INT64_C(21)),
+    tUInt2 = int32_t(INT64_C(22)),
+    tUInt3 = int32_t(INT64_C(23)),
+    tUInt4 = int32_t(INT64_C(24)),
+    tFloat = int32_t(INT64_C(25)),
+    tFloat2 = int32_t(INT64_C(26)),
+    tFloat3 = int32_t(INT64_C(27)),
+    tFloat4 = int32_t(INT64_C(28)),
+    tDouble = int32_t(INT64_C(29)),
+    tRange = int32_t(INT64_C(30)),
+    tURange = int32_t(INT64_C(31)),
+    tRange64 = int32_t(INT64_C(32)),
+    tURange64 = int32_t(INT64_C(33)),
+    tString = int32_t(INT64_C(34)),
+    tStructure = int32_t(INT64_C(35)),
+    tHandle = int32_t(INT64_C(36)),
+    tEnumeration = int32_t(INT64_C(37)),
+    tEnumeration8 = int32_t(INT64_C(38)),
+    tEnumeration16 = int32_t(INT64_C(39)),
+    tEnumeration64 = int32_t(INT64_C(40)),
+    tBitfield = int32_t(INT64_C(41)),
+    tBitfield8 = int32_t(INT64_C(42)),
+    tBitfield16 = int32_t(INT64_C(43)),
+    tBitfield64 = int32_t(INT64_C(44)),
+    tPointer = int32_t(INT64_C(45)),
+    tFunction = int32_t(INT64_C(46)),
+    tLambda = int32_t(INT64_C(47)),
+    tIterator = int32_t(INT64_C(48)),
+    tArray = int32_t(INT64_C(49)),
+    tTable = int32_t(INT64_C(50)),
+    tBlock = int32_t(INT64_C(51)),
+    tTuple = int32_t(INT64_C(52)),
+    tVariant = int32_t(INT64_C(53)),
+};
+}
+#endif // external enum
+// unused enumeration ConversionResult
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+namespace ast {
+
+struct AstFunctionAnnotation {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(AstFunctionAnnotation)==112,"structure size mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+// unused structure AstBlockAnnotation
+namespace ast {
+
+struct AstStructureAnnotation {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+};
+static_assert(sizeof(AstStructureAnnotation)==72,"structure size mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,aotSuffix)==64,"structure field offset mismatch with DAS");
+}
+// unused structure AstPassMacro
+namespace ast {
+
+struct AstVariantMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstVariantMacro)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+};
+static_assert(sizeof(AstVariantMacro)==40,"structure size mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,visitExprIsVariant)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,visitExprAsVariant)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,visitExprSafeAsVariant)==32,"structure field offset mismatch with DAS");
+}
+// unused structure AstForLoopMacro
+// unused structure AstCaptureMacro
+// unused structure AstTypeMacro
+// unused structure AstSimulateMacro
+namespace ast {
+
+struct AstReaderMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstReaderMacro)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,ExprReader * const ,int32_t,LineInfo const )) accept;
+    Func DAS_COMMENT((char *,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,ExprReader * const ,LineInfo const ,int32_t &,FileInfo * &)) suffix;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprReader> const )) visit;
+};
+static_assert(sizeof(AstReaderMacro)==40,"structure size mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,accept)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,suffix)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,visit)==32,"structure field offset mismatch with DAS");
+}
+// unused structure AstCommentReader
+namespace ast {
+
+struct AstCallMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstCallMacro)) __finalize;
+    Func DAS_COMMENT((void,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) preVisit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) visit;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const ,int32_t)) canVisitArgument;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const )) canFoldReturnResult;
+};
+static_assert(sizeof(AstCallMacro)==48,"structure size mismatch with DAS");
+static_assert(offsetof(AstCallMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstCallMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstCallMacro,preVisit)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstCallMacro,visit)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstCallMacro,canVisitArgument)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstCallMacro,canFoldReturnResult)==40,"structure field offset mismatch with DAS");
+}
+// unused structure AstTypeInfoMacro
+// unused structure AstEnumerationAnnotation
+namespace ast {
+
+struct AstVisitor {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstVisitor)) __finalize;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgram;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitProgram;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const ,Module * const )) preVisitProgramBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,Module * const )) preVisitModule;
+    Func DAS_COMMENT((void,ast::AstVisitor,Module * const )) visitModule;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTypeDecl> const )) preVisitExprTypeDecl;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTypeDecl> const )) visitExprTypeDecl;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) preVisitTypeDecl;
+    Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) visitTypeDecl;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) preVisitAlias;
+    Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) visitAlias;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Enumeration * const )) canVisitEnumeration;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) preVisitEnumeration;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) preVisitEnumerationValue;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) visitEnumerationValue;
+    Func DAS_COMMENT((smart_ptr_raw<Enumeration>,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) visitEnumeration;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Structure * const )) canVisitStructure;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const )) preVisitStructure;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) preVisitStructureField;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<Structure> const )) canVisitStructureFieldInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) visitStructureField;
+    Func DAS_COMMENT((smart_ptr_raw<Structure>,ast::AstVisitor,smart_ptr_raw<Structure> const )) visitStructure;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Function * const )) canVisitFunction;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Function * const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) canVisitFunctionArgumentInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunction;
+    Func DAS_COMMENT((smart_ptr_raw<Function>,ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunction;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) preVisitFunctionArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) visitFunctionArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitFunctionArgumentInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitFunctionArgumentInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Expression> const )) preVisitFunctionBody;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Expression> const )) visitFunctionBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Expression> const )) preVisitExpression;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Expression> const )) visitExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlock;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprBlockArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) visitExprBlockArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockArgumentInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprBlockArgumentInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockExpression;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlockFinal;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlockFinal;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockFinalExpression;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockFinalExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) preVisitExprLet;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) visitExprLet;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprLetVariable;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) visitExprLetVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprLetVariableInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprLetVariableInit;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Variable * const )) canVisitGlobalVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitGlobalLet;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitGlobalLet;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) preVisitGlobalLetVariable;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) visitGlobalLetVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitGlobalLetVariableInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitGlobalLetVariableInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) preVisitExprStringBuilder;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) visitExprStringBuilder;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprStringBuilderElement;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) visitExprStringBuilderElement;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) preVisitExprNew;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) visitExprNew;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprNewArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) visitExprNewArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) preVisitExprNamedCall;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) visitExprNamedCall;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprNamedCallArgument;
+    Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprNamedCallArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) preVisitExprLooksLikeCall;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) visitExprLooksLikeCall;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) canVisitExprLooksLikeCallArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprLooksLikeCallArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprLooksLikeCallArgument;
+    Func DAS_COMMENT((bool,ast::AstVisitor,ExprCall * const )) canVisitCall;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) preVisitExprCall;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) visitExprCall;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprCallArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprCallArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) preVisitExprNullCoalescing;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) visitExprNullCoalescing;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const ,smart_ptr_raw<Expression> const )) preVisitExprNullCoalescingDefault;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) preVisitExprAt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) visitExprAt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprAtIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) preVisitExprSafeAt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) visitExprSafeAt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const ,smart_ptr_raw<Expression> const )) preVisitExprSafeAtIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) preVisitExprIs;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) visitExprIs;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIs> const ,smart_ptr_raw<TypeDecl> const )) preVisitExprIsType;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) preVisitExprOp2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) visitExprOp2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const ,smart_ptr_raw<Expression> const )) preVisitExprOp2Right;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) preVisitExprOp3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) visitExprOp3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Left;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Right;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) isRightFirstExprCopy;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) preVisitExprCopy;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) visitExprCopy;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const ,smart_ptr_raw<Expression> const )) preVisitExprCopyRight;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) isRightFirstExprMove;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) preVisitExprMove;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) visitExprMove;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const ,smart_ptr_raw<Expression> const )) preVisitExprMoveRight;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) isRightFirstExprClone;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) preVisitExprClone;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) visitExprClone;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const ,smart_ptr_raw<Expression> const )) preVisitExprCloneRight;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprAssume> const )) canVisitWithAliasSubexpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAssume> const )) preVisitExprAssume;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAssume> const )) visitExprAssume;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) preVisitExprWith;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) visitExprWith;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const ,smart_ptr_raw<Expression> const )) preVisitExprWithBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) preVisitExprWhile;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) visitExprWhile;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const ,smart_ptr_raw<Expression> const )) preVisitExprWhileBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) preVisitExprTryCatch;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) visitExprTryCatch;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const ,smart_ptr_raw<Expression> const )) preVisitExprTryCatchCatch;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) preVisitExprIfThenElse;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) visitExprIfThenElse;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseIfBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseElseBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprFor;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) visitExprFor;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprForVariable;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) visitExprForVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprForSource;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) visitExprForSource;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForStack;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) preVisitExprMakeVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) visitExprMakeVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeVariantField;
+    Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeVariantField;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) canVisitExprMakeStructBody;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,smart_ptr_raw<Expression> const )) canVisitExprMakeStructBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) preVisitExprMakeStruct;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) visitExprMakeStruct;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,das::string const ,smart_ptr_raw<TypeDecl> const )) preVisitStructureAlias;
+    Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<Structure> const ,das::string const ,smart_ptr_raw<TypeDecl> const )) visitStructureAlias;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) preVisitExprMakeStructIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) visitExprMakeStructIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeStructField;
+    Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeStructField;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,smart_ptr_raw<Expression> const )) preVisitMakeStructureBlock;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,smart_ptr_raw<Expression> const )) visitMakeStructureBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) preVisitExprMakeArray;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) visitExprMakeArray;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeArrayIndex;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeArrayIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) preVisitExprMakeTuple;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) visitExprMakeTuple;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeTupleIndex;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeTupleIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) preVisitExprArrayComprehension;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) visitExprArrayComprehension;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionSubexpr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionWhere;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const ,smart_ptr_raw<Expression> const )) canVisitExprTypeInfo;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) preVisitExprTypeInfo;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) visitExprTypeInfo;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) preVisitExprPtr2Ref;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) visitExprPtr2Ref;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) preVisitExprLabel;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) visitExprLabel;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) preVisitExprGoto;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) visitExprGoto;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) preVisitExprRef2Value;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) visitExprRef2Value;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) preVisitExprRef2Ptr;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) visitExprRef2Ptr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) preVisitExprAddr;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) visitExprAddr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) preVisitExprAssert;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) visitExprAssert;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) preVisitExprStaticAssert;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) visitExprStaticAssert;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) preVisitExprQuote;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) visitExprQuote;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) preVisitExprDebug;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) visitExprDebug;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) preVisitExprInvoke;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) visitExprInvoke;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) preVisitExprErase;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) visitExprErase;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSetInsert> const )) preVisitExprSetInsert;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSetInsert> const )) visitExprSetInsert;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) preVisitExprFind;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) visitExprFind;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) preVisitExprKeyExists;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) visitExprKeyExists;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) preVisitExprAscend;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) visitExprAscend;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) preVisitExprCast;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) visitExprCast;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDelete> const ,smart_ptr_raw<Expression> const )) preVisitExprDeleteSizeExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) preVisitExprDelete;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) visitExprDelete;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) preVisitExprVar;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) visitExprVar;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTag> const )) preVisitExprTag;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTag> const ,smart_ptr_raw<Expression> const )) preVisitExprTagValue;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTag> const )) visitExprTag;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprField> const )) preVisitExprField;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprField> const )) visitExprField;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) preVisitExprSafeField;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) visitExprSafeField;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) preVisitExprSwizzle;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) visitExprSwizzle;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) preVisitExprIsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) preVisitExprAsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) preVisitExprSafeAsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) preVisitExprOp1;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) visitExprOp1;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) preVisitExprReturn;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) visitExprReturn;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) preVisitExprYield;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) visitExprYield;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) preVisitExprBreak;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) visitExprBreak;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) preVisitExprContinue;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) visitExprContinue;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) canVisitMakeBlockBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) preVisitExprMakeBlock;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) visitExprMakeBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) preVisitExprMakeGenerator;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) visitExprMakeGenerator;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) preVisitExprMemZero;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) visitExprMemZero;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) preVisitExprConst;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) visitExprConst;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) preVisitExprConstPtr;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) visitExprConstPtr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) preVisitExprConstEnumeration;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) visitExprConstEnumeration;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) preVisitExprConstBitfield;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) visitExprConstBitfield;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) preVisitExprConstInt8;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) visitExprConstInt8;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) preVisitExprConstInt16;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) visitExprConstInt16;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) preVisitExprConstInt64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) visitExprConstInt64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) preVisitExprConstInt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) visitExprConstInt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) preVisitExprConstInt2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) visitExprConstInt2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) preVisitExprConstInt3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) visitExprConstInt3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) preVisitExprConstInt4;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) visitExprConstInt4;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) preVisitExprConstUInt8;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) visitExprConstUInt8;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) preVisitExprConstUInt16;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) visitExprConstUInt16;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) preVisitExprConstUInt64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) visitExprConstUInt64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) preVisitExprConstUInt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) visitExprConstUInt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) preVisitExprConstUInt2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) visitExprConstUInt2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) preVisitExprConstUInt3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) visitExprConstUInt3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) preVisitExprConstUInt4;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) visitExprConstUInt4;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) preVisitExprConstRange;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) visitExprConstRange;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) preVisitExprConstURange;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) visitExprConstURange;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstRange64> const )) preVisitExprConstRange64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstRange64> const )) visitExprConstRange64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstURange64> const )) preVisitExprConstURange64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstURange64> const )) visitExprConstURange64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) preVisitExprConstBool;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) visitExprConstBool;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) preVisitExprConstFloat;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) visitExprConstFloat;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) preVisitExprConstFloat2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) visitExprConstFloat2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) preVisitExprConstFloat3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) visitExprConstFloat3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) preVisitExprConstFloat4;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) visitExprConstFloat4;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) preVisitExprConstString;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) visitExprConstString;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) preVisitExprConstDouble;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) visitExprConstDouble;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) preVisitExprFakeContext;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) visitExprFakeContext;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) preVisitExprFakeLineInfo;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) visitExprFakeLineInfo;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) preVisitExprReader;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) visitExprReader;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) preVisitExprUnsafe;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) visitExprUnsafe;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) preVisitExprCallMacro;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) visitExprCallMacro;
+};
+static_assert(sizeof(AstVisitor)==2464,"structure size mismatch with DAS");
+static_assert(offsetof(AstVisitor,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitProgram)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitProgram)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitProgramBody)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitModule)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitModule)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprTypeDecl)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprTypeDecl)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitTypeDecl)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitTypeDecl)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitAlias)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitAlias)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,canVisitEnumeration)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitEnumeration)==112,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitEnumerationValue)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitEnumerationValue)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitEnumeration)==136,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,canVisitStructure)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitStructure)==152,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitStructureField)==160,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,canVisitStructureFieldInit)==168,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitStructureField)==176,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitStructure)==184,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,canVisitFunction)==192,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,canVisitFunctionArgumentInit)==200,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitFunction)==208,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitFunction)==216,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitFunctionArgument)==224,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitFunctionArgument)==232,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitFunctionArgumentInit)==240,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitFunctionArgumentInit)==248,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitFunctionBody)==256,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitFunctionBody)==264,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExpression)==272,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExpression)==280,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlock)==288,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlock)==296,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockArgument)==304,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockArgument)==312,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockArgumentInit)==320,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockArgumentInit)==328,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockExpression)==336,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockExpression)==344,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockFinal)==352,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockFinal)==360,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockFinalExpression)==368,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockFinalExpression)==376,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLet)==384,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLet)==392,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLetVariable)==400,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLetVariable)==408,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLetVariableInit)==416,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLetVariableInit)==424,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,canVisitGlobalVariable)==432,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitGlobalLet)==440,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitGlobalLet)==448,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitGlobalLetVariable)==456,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitGlobalLetVariable)==464,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitGlobalLetVariableInit)==472,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitGlobalLetVariableInit)==480,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprStringBuilder)==488,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprStringBuilder)==496,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprStringBuilderElement)==504,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprStringBuilderElement)==512,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNew)==520,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNew)==528,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNewArgument)==536,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNewArgument)==544,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNamedCall)==552,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNamedCall)==560,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNamedCallArgument)==568,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNamedCallArgument)==576,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLooksLikeCall)==584,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLooksLikeCall)==592,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,canVisitExprLooksLikeCallArgument)==600,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLooksLikeCallArgument)==608,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLooksLikeCallArgument)==616,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,canVisitCall)==624,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCall)==632,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCall)==640,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCallArgument)==648,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCallArgument)==656,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNullCoalescing)==664,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNullCoalescing)==672,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNullCoalescingDefault)==680,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAt)==688,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAt)==696,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAtIndex)==704,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSafeAt)==712,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprSafeAt)==720,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSafeAtIndex)==728,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIs)==736,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprIs)==744,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIsType)==752,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp2)==760,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprOp2)==768,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp2Right)==776,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp3)==784,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprOp3)==792,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp3Left)==800,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp3Right)==808,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,isRightFirstExprCopy)==816,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCopy)==824,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCopy)==832,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCopyRight)==840,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,isRightFirstExprMove)==848,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMove)==856,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMove)==864,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMoveRight)==872,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,isRightFirstExprClone)==880,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprClone)==888,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprClone)==896,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCloneRight)==904,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,canVisitWithAliasSubexpression)==912,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAssume)==920,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAssume)==928,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprWith)==936,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprWith)==944,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprWithBody)==952,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprWhile)==960,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprWhile)==968,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprWhileBody)==976,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprTryCatch)==984,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprTryCatch)==992,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprTryCatchCatch)==1000,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIfThenElse)==1008,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprIfThenElse)==1016,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIfThenElseIfBlock)==1024,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIfThenElseElseBlock)==1032,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprFor)==1040,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprFor)==1048,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprForVariable)==1056,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprForVariable)==1064,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprForSource)==1072,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprForSource)==1080,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprForStack)==1088,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprForBody)==1096,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeVariant)==1104,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeVariant)==1112,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeVariantField)==1120,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeVariantField)==1128,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,canVisitExprMakeStructBody)==1136,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,canVisitExprMakeStructBlock)==1144,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeStruct)==1152,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeStruct)==1160,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitStructureAlias)==1168,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitStructureAlias)==1176,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeStructIndex)==1184,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeStructIndex)==1192,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeStructField)==1200,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeStructField)==1208,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitMakeStructureBlock)==1216,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitMakeStructureBlock)==1224,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeArray)==1232,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeArray)==1240,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeArrayIndex)==1248,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeArrayIndex)==1256,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeTuple)==1264,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeTuple)==1272,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeTupleIndex)==1280,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeTupleIndex)==1288,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprArrayComprehension)==1296,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprArrayComprehension)==1304,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprArrayComprehensionSubexpr)==1312,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprArrayComprehensionWhere)==1320,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,canVisitExprTypeInfo)==1328,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprTypeInfo)==1336,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprTypeInfo)==1344,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprPtr2Ref)==1352,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprPtr2Ref)==1360,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLabel)==1368,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLabel)==1376,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprGoto)==1384,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprGoto)==1392,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprRef2Value)==1400,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprRef2Value)==1408,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprRef2Ptr)==1416,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprRef2Ptr)==1424,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAddr)==1432,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAddr)==1440,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAssert)==1448,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAssert)==1456,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprStaticAssert)==1464,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprStaticAssert)==1472,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprQuote)==1480,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprQuote)==1488,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprDebug)==1496,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprDebug)==1504,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprInvoke)==1512,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprInvoke)==1520,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprErase)==1528,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprErase)==1536,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSetInsert)==1544,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprSetInsert)==1552,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprFind)==1560,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprFind)==1568,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprKeyExists)==1576,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprKeyExists)==1584,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAscend)==1592,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAscend)==1600,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCast)==1608,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCast)==1616,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprDeleteSizeExpression)==1624,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprDelete)==1632,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprDelete)==1640,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprVar)==1648,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprVar)==1656,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprTag)==1664,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprTagValue)==1672,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprTag)==1680,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprField)==1688,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprField)==1696,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSafeField)==1704,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprSafeField)==1712,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSwizzle)==1720,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprSwizzle)==1728,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIsVariant)==1736,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprIsVariant)==1744,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAsVariant)==1752,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAsVariant)==1760,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSafeAsVariant)==1768,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprSafeAsVariant)==1776,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp1)==1784,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprOp1)==1792,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprReturn)==1800,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprReturn)==1808,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprYield)==1816,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprYield)==1824,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBreak)==1832,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBreak)==1840,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprContinue)==1848,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprContinue)==1856,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,canVisitMakeBlockBody)==1864,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeBlock)==1872,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeBlock)==1880,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeGenerator)==1888,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeGenerator)==1896,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMemZero)==1904,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMemZero)==1912,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConst)==1920,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConst)==1928,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstPtr)==1936,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstPtr)==1944,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstEnumeration)==1952,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstEnumeration)==1960,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstBitfield)==1968,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstBitfield)==1976,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt8)==1984,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt8)==1992,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt16)==2000,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt16)==2008,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt64)==2016,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt64)==2024,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt)==2032,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt)==2040,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt2)==2048,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt2)==2056,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt3)==2064,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt3)==2072,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt4)==2080,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt4)==2088,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt8)==2096,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt8)==2104,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt16)==2112,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt16)==2120,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt64)==2128,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt64)==2136,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt)==2144,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt)==2152,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt2)==2160,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt2)==2168,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt3)==2176,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt3)==2184,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt4)==2192,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt4)==2200,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstRange)==2208,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstRange)==2216,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstURange)==2224,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstURange)==2232,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstRange64)==2240,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstRange64)==2248,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstURange64)==2256,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstURange64)==2264,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstBool)==2272,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstBool)==2280,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstFloat)==2288,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstFloat)==2296,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstFloat2)==2304,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstFloat2)==2312,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstFloat3)==2320,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstFloat3)==2328,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstFloat4)==2336,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstFloat4)==2344,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstString)==2352,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstString)==2360,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstDouble)==2368,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstDouble)==2376,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprFakeContext)==2384,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprFakeContext)==2392,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprFakeLineInfo)==2400,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprFakeLineInfo)==2408,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprReader)==2416,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprReader)==2424,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprUnsafe)==2432,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprUnsafe)==2440,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCallMacro)==2448,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCallMacro)==2456,"structure field offset mismatch with DAS");
+}
+// unused structure df_header
+// unused structure _lambda_random_112_1
+namespace ast_boost {
+
+struct MacroMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(MacroMacro)==112,"structure size mismatch with DAS");
+static_assert(offsetof(MacroMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct TagFunctionAnnotation {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(TagFunctionAnnotation)==112,"structure size mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct TagStructureAnnotation {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+};
+static_assert(sizeof(TagStructureAnnotation)==72,"structure size mismatch with DAS");
+static_assert(offsetof(TagStructureAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagStructureAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagStructureAnnotation,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagStructureAnnotation,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagStructureAnnotation,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagStructureAnnotation,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagStructureAnnotation,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagStructureAnnotation,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagStructureAnnotation,aotSuffix)==64,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupAnyAnnotation {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupAnyAnnotation)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupFunctionAnnotation {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupFunctionAnnotation)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotation,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotation,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotation,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotation,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotation,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotation,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotation,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotation,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotation,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotation,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupBlockAnnotation {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupBlockAnnotation)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupBlockAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupBlockAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupBlockAnnotation,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupBlockAnnotation,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupBlockAnnotation,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupBlockAnnotation,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupBlockAnnotation,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupBlockAnnotation,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupBlockAnnotation,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupBlockAnnotation,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupBlockAnnotation,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupBlockAnnotation,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupStructureAnnotation {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupStructureAnnotation)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupStructureAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureAnnotation,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureAnnotation,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureAnnotation,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureAnnotation,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureAnnotation,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureAnnotation,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureAnnotation,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureAnnotation,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureAnnotation,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureAnnotation,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupEnumerationAnnotation {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupEnumerationAnnotation)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupEnumerationAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupEnumerationAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupEnumerationAnnotation,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupEnumerationAnnotation,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupEnumerationAnnotation,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupEnumerationAnnotation,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupEnumerationAnnotation,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupEnumerationAnnotation,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupEnumerationAnnotation,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupEnumerationAnnotation,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupEnumerationAnnotation,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupEnumerationAnnotation,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupContractAnnotation {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupContractAnnotation)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupContractAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupContractAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupContractAnnotation,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupContractAnnotation,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupContractAnnotation,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupContractAnnotation,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupContractAnnotation,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupContractAnnotation,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupContractAnnotation,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupContractAnnotation,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupContractAnnotation,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupContractAnnotation,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupReaderMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupReaderMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupCommentReader {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupCommentReader)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupCommentReader,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCommentReader,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCommentReader,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCommentReader,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCommentReader,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCommentReader,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCommentReader,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCommentReader,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCommentReader,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCommentReader,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCommentReader,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCommentReader,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupVariantMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupVariantMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupForLoopMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupForLoopMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupForLoopMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupForLoopMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupForLoopMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupForLoopMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupForLoopMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupForLoopMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupForLoopMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupForLoopMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupForLoopMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupForLoopMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupForLoopMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupForLoopMacro,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupCaptureMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupCaptureMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupCaptureMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCaptureMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCaptureMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCaptureMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCaptureMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCaptureMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCaptureMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCaptureMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCaptureMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCaptureMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCaptureMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCaptureMacro,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupTypeMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupTypeMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupTypeMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeMacro,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupSimulateMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupSimulateMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupSimulateMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupSimulateMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupSimulateMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupSimulateMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupSimulateMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupSimulateMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupSimulateMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupSimulateMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupSimulateMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupSimulateMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupSimulateMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupSimulateMacro,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupCallMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupCallMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupTypeInfoMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupTypeInfoMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupTypeInfoMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeInfoMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeInfoMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeInfoMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeInfoMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeInfoMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeInfoMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeInfoMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeInfoMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeInfoMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeInfoMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeInfoMacro,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupInferMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupInferMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupDirtyInferMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupDirtyInferMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupDirtyInferMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupDirtyInferMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupDirtyInferMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupDirtyInferMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupDirtyInferMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupDirtyInferMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupDirtyInferMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupDirtyInferMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupDirtyInferMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupDirtyInferMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupDirtyInferMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupDirtyInferMacro,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupLintMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupLintMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupLintMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupLintMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupLintMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupLintMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupLintMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupLintMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupLintMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupLintMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupLintMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupLintMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupLintMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupLintMacro,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupGlobalLintMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupGlobalLintMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupGlobalLintMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupGlobalLintMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupGlobalLintMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupGlobalLintMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupGlobalLintMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupGlobalLintMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupGlobalLintMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupGlobalLintMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupGlobalLintMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupGlobalLintMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupGlobalLintMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupGlobalLintMacro,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupOptimizationMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupOptimizationMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupOptimizationMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupOptimizationMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupOptimizationMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupOptimizationMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupOptimizationMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupOptimizationMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupOptimizationMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupOptimizationMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupOptimizationMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupOptimizationMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupOptimizationMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupOptimizationMacro,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct TagFunctionMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+    char * tag;
+};
+static_assert(sizeof(TagFunctionMacro)==104,"structure size mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,setup_call)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,tag)==96,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct BetterRttiVisitor {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstVariantMacro)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+};
+static_assert(sizeof(BetterRttiVisitor)==40,"structure size mismatch with DAS");
+static_assert(offsetof(BetterRttiVisitor,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(BetterRttiVisitor,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(BetterRttiVisitor,visitExprIsVariant)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(BetterRttiVisitor,visitExprAsVariant)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(BetterRttiVisitor,visitExprSafeAsVariant)==32,"structure field offset mismatch with DAS");
+}
+namespace templates {
+
+struct DecltypeMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstCallMacro)) __finalize;
+    Func DAS_COMMENT((void,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) preVisit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) visit;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const ,int32_t)) canVisitArgument;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const )) canFoldReturnResult;
+    bool remove_ref;
+};
+static_assert(sizeof(DecltypeMacro)==56,"structure size mismatch with DAS");
+static_assert(offsetof(DecltypeMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(DecltypeMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(DecltypeMacro,preVisit)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(DecltypeMacro,visit)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(DecltypeMacro,canVisitArgument)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(DecltypeMacro,canFoldReturnResult)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(DecltypeMacro,remove_ref)==48,"structure field offset mismatch with DAS");
+}
+namespace templates {
+
+struct DecltypeNoRefMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstCallMacro)) __finalize;
+    Func DAS_COMMENT((void,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) preVisit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) visit;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const ,int32_t)) canVisitArgument;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const )) canFoldReturnResult;
+    bool remove_ref;
+};
+static_assert(sizeof(DecltypeNoRefMacro)==56,"structure size mismatch with DAS");
+static_assert(offsetof(DecltypeNoRefMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(DecltypeNoRefMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(DecltypeNoRefMacro,preVisit)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(DecltypeNoRefMacro,visit)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(DecltypeNoRefMacro,canVisitArgument)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(DecltypeNoRefMacro,canFoldReturnResult)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(DecltypeNoRefMacro,remove_ref)==48,"structure field offset mismatch with DAS");
+}
+namespace templates {
+
+struct TemplateMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(TemplateMacro)==112,"structure size mismatch with DAS");
+static_assert(offsetof(TemplateMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateMacro,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateMacro,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateMacro,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateMacro,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateMacro,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateMacro,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateMacro,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateMacro,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateMacro,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateMacro,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateMacro,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateMacro,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+namespace contracts {
+
+struct IsAnyType {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(IsAnyType)==112,"structure size mismatch with DAS");
+static_assert(offsetof(IsAnyType,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyType,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyType,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyType,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyType,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyType,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyType,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyType,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyType,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyType,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyType,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyType,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyType,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyType,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+namespace contracts {
+
+struct IsAnyArrayMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(IsAnyArrayMacro)==112,"structure size mismatch with DAS");
+static_assert(offsetof(IsAnyArrayMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyArrayMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyArrayMacro,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyArrayMacro,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyArrayMacro,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyArrayMacro,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyArrayMacro,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyArrayMacro,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyArrayMacro,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyArrayMacro,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyArrayMacro,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyArrayMacro,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyArrayMacro,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyArrayMacro,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+namespace contracts {
+
+struct IsAnyEnumMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(IsAnyEnumMacro)==112,"structure size mismatch with DAS");
+static_assert(offsetof(IsAnyEnumMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyEnumMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyEnumMacro,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyEnumMacro,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyEnumMacro,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyEnumMacro,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyEnumMacro,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyEnumMacro,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyEnumMacro,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyEnumMacro,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyEnumMacro,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyEnumMacro,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyEnumMacro,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyEnumMacro,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+namespace contracts {
+
+struct IsAnyBitfieldMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(IsAnyBitfieldMacro)==112,"structure size mismatch with DAS");
+static_assert(offsetof(IsAnyBitfieldMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyBitfieldMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyBitfieldMacro,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyBitfieldMacro,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyBitfieldMacro,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyBitfieldMacro,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyBitfieldMacro,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyBitfieldMacro,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyBitfieldMacro,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyBitfieldMacro,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyBitfieldMacro,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyBitfieldMacro,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyBitfieldMacro,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyBitfieldMacro,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+namespace contracts {
+
+struct IsAnyVectorType {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(IsAnyVectorType)==112,"structure size mismatch with DAS");
+static_assert(offsetof(IsAnyVectorType,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyVectorType,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyVectorType,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyVectorType,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyVectorType,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyVectorType,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyVectorType,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyVectorType,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyVectorType,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyVectorType,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyVectorType,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyVectorType,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyVectorType,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyVectorType,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+namespace contracts {
+
+struct IsAnyStructMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(IsAnyStructMacro)==112,"structure size mismatch with DAS");
+static_assert(offsetof(IsAnyStructMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyStructMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyStructMacro,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyStructMacro,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyStructMacro,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyStructMacro,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyStructMacro,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyStructMacro,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyStructMacro,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyStructMacro,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyStructMacro,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyStructMacro,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyStructMacro,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyStructMacro,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+namespace contracts {
+
+struct IsAnyNumericMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(IsAnyNumericMacro)==112,"structure size mismatch with DAS");
+static_assert(offsetof(IsAnyNumericMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyNumericMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyNumericMacro,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyNumericMacro,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyNumericMacro,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyNumericMacro,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyNumericMacro,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyNumericMacro,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyNumericMacro,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyNumericMacro,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyNumericMacro,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyNumericMacro,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyNumericMacro,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyNumericMacro,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+namespace contracts {
+
+struct IsAnyWorkhorse {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(IsAnyWorkhorse)==112,"structure size mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorse,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorse,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorse,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorse,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorse,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorse,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorse,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorse,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorse,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorse,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorse,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorse,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorse,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorse,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+namespace contracts {
+
+struct IsAnyWorkhorseNonPtrMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(IsAnyWorkhorseNonPtrMacro)==112,"structure size mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorseNonPtrMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorseNonPtrMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorseNonPtrMacro,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorseNonPtrMacro,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorseNonPtrMacro,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorseNonPtrMacro,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorseNonPtrMacro,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorseNonPtrMacro,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorseNonPtrMacro,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorseNonPtrMacro,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorseNonPtrMacro,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorseNonPtrMacro,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorseNonPtrMacro,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyWorkhorseNonPtrMacro,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+namespace contracts {
+
+struct IsAnyTupleNonPtrMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(IsAnyTupleNonPtrMacro)==112,"structure size mismatch with DAS");
+static_assert(offsetof(IsAnyTupleNonPtrMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyTupleNonPtrMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyTupleNonPtrMacro,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyTupleNonPtrMacro,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyTupleNonPtrMacro,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyTupleNonPtrMacro,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyTupleNonPtrMacro,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyTupleNonPtrMacro,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyTupleNonPtrMacro,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyTupleNonPtrMacro,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyTupleNonPtrMacro,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyTupleNonPtrMacro,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyTupleNonPtrMacro,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyTupleNonPtrMacro,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+namespace contracts {
+
+struct IsAnyVariantNonPtrMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(IsAnyVariantNonPtrMacro)==112,"structure size mismatch with DAS");
+static_assert(offsetof(IsAnyVariantNonPtrMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyVariantNonPtrMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyVariantNonPtrMacro,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyVariantNonPtrMacro,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyVariantNonPtrMacro,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyVariantNonPtrMacro,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyVariantNonPtrMacro,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyVariantNonPtrMacro,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyVariantNonPtrMacro,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyVariantNonPtrMacro,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyVariantNonPtrMacro,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyVariantNonPtrMacro,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyVariantNonPtrMacro,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyVariantNonPtrMacro,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+namespace contracts {
+
+struct IsAnyFunctionNonPtrMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(IsAnyFunctionNonPtrMacro)==112,"structure size mismatch with DAS");
+static_assert(offsetof(IsAnyFunctionNonPtrMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyFunctionNonPtrMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyFunctionNonPtrMacro,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyFunctionNonPtrMacro,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyFunctionNonPtrMacro,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyFunctionNonPtrMacro,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyFunctionNonPtrMacro,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyFunctionNonPtrMacro,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyFunctionNonPtrMacro,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyFunctionNonPtrMacro,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyFunctionNonPtrMacro,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyFunctionNonPtrMacro,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyFunctionNonPtrMacro,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyFunctionNonPtrMacro,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+namespace contracts {
+
+struct IsAnyLambdaMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(IsAnyLambdaMacro)==112,"structure size mismatch with DAS");
+static_assert(offsetof(IsAnyLambdaMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyLambdaMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyLambdaMacro,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyLambdaMacro,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyLambdaMacro,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyLambdaMacro,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyLambdaMacro,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyLambdaMacro,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyLambdaMacro,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyLambdaMacro,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyLambdaMacro,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyLambdaMacro,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyLambdaMacro,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsAnyLambdaMacro,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+namespace contracts {
+
+struct IsRefMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(IsRefMacro)==112,"structure size mismatch with DAS");
+static_assert(offsetof(IsRefMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsRefMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsRefMacro,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsRefMacro,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsRefMacro,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsRefMacro,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsRefMacro,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsRefMacro,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsRefMacro,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsRefMacro,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsRefMacro,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsRefMacro,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsRefMacro,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsRefMacro,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+namespace contracts {
+
+struct IsPointer {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(IsPointer)==112,"structure size mismatch with DAS");
+static_assert(offsetof(IsPointer,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsPointer,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsPointer,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsPointer,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsPointer,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsPointer,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsPointer,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsPointer,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsPointer,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsPointer,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsPointer,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsPointer,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsPointer,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsPointer,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+namespace contracts {
+
+struct IsClass {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(IsClass)==112,"structure size mismatch with DAS");
+static_assert(offsetof(IsClass,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsClass,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsClass,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsClass,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsClass,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsClass,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsClass,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsClass,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsClass,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsClass,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsClass,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsClass,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsClass,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsClass,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+namespace contracts {
+
+struct IsValueHandle {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(IsValueHandle)==112,"structure size mismatch with DAS");
+static_assert(offsetof(IsValueHandle,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsValueHandle,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsValueHandle,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsValueHandle,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsValueHandle,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsValueHandle,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsValueHandle,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsValueHandle,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsValueHandle,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsValueHandle,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsValueHandle,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsValueHandle,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsValueHandle,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(IsValueHandle,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+namespace templates_boost {
+
+struct Template {
+    TTable<char *,TTuple<16,char *,char *>> kaboomVar;
+    TTable<char *,char *> call2name;
+    TTable<char *,char *> field2name;
+    TTable<char *,char *> var2name;
+    TTable<char *,smart_ptr_raw<Expression>> var2expr;
+    TTable<char *,TArray<smart_ptr_raw<Expression>>> var2exprList;
+    TTable<char *,char *> type2type;
+    TTable<char *,smart_ptr_raw<TypeDecl>> type2etype;
+    TTable<Structure *,smart_ptr_raw<TypeDecl>> struct2etype;
+    TTable<char *,char *> blockArgName;
+    TTable<char *,Lambda DAS_COMMENT((void,AnnotationDeclaration))> annArg;
+    TTable<char *,TArray<smart_ptr_raw<Variable>>> blkArg;
+    TTable<char *,smart_ptr_raw<Expression>> tag2expr;
+};
+static_assert(sizeof(Template)==624,"structure size mismatch with DAS");
+static_assert(offsetof(Template,kaboomVar)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Template,call2name)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(Template,field2name)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(Template,var2name)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(Template,var2expr)==192,"structure field offset mismatch with DAS");
+static_assert(offsetof(Template,var2exprList)==240,"structure field offset mismatch with DAS");
+static_assert(offsetof(Template,type2type)==288,"structure field offset mismatch with DAS");
+static_assert(offsetof(Template,type2etype)==336,"structure field offset mismatch with DAS");
+static_assert(offsetof(Template,struct2etype)==384,"structure field offset mismatch with DAS");
+static_assert(offsetof(Template,blockArgName)==432,"structure field offset mismatch with DAS");
+static_assert(offsetof(Template,annArg)==480,"structure field offset mismatch with DAS");
+static_assert(offsetof(Template,blkArg)==528,"structure field offset mismatch with DAS");
+static_assert(offsetof(Template,tag2expr)==576,"structure field offset mismatch with DAS");
+}
+namespace templates_boost {
+
+struct TemplateVisitor {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstVisitor)) __finalize;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgram;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitProgram;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const ,Module * const )) preVisitProgramBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,Module * const )) preVisitModule;
+    Func DAS_COMMENT((void,ast::AstVisitor,Module * const )) visitModule;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTypeDecl> const )) preVisitExprTypeDecl;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTypeDecl> const )) visitExprTypeDecl;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) preVisitTypeDecl;
+    Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) visitTypeDecl;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) preVisitAlias;
+    Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) visitAlias;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Enumeration * const )) canVisitEnumeration;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) preVisitEnumeration;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) preVisitEnumerationValue;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) visitEnumerationValue;
+    Func DAS_COMMENT((smart_ptr_raw<Enumeration>,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) visitEnumeration;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Structure * const )) canVisitStructure;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const )) preVisitStructure;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) preVisitStructureField;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<Structure> const )) canVisitStructureFieldInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) visitStructureField;
+    Func DAS_COMMENT((smart_ptr_raw<Structure>,ast::AstVisitor,smart_ptr_raw<Structure> const )) visitStructure;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Function * const )) canVisitFunction;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Function * const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) canVisitFunctionArgumentInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunction;
+    Func DAS_COMMENT((smart_ptr_raw<Function>,ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunction;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) preVisitFunctionArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) visitFunctionArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitFunctionArgumentInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitFunctionArgumentInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Expression> const )) preVisitFunctionBody;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Expression> const )) visitFunctionBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Expression> const )) preVisitExpression;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Expression> const )) visitExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlock;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprBlockArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) visitExprBlockArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockArgumentInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprBlockArgumentInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockExpression;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlockFinal;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlockFinal;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockFinalExpression;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockFinalExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) preVisitExprLet;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) visitExprLet;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprLetVariable;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) visitExprLetVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprLetVariableInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprLetVariableInit;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Variable * const )) canVisitGlobalVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitGlobalLet;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitGlobalLet;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) preVisitGlobalLetVariable;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) visitGlobalLetVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitGlobalLetVariableInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitGlobalLetVariableInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) preVisitExprStringBuilder;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) visitExprStringBuilder;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprStringBuilderElement;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) visitExprStringBuilderElement;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) preVisitExprNew;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) visitExprNew;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprNewArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) visitExprNewArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) preVisitExprNamedCall;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) visitExprNamedCall;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprNamedCallArgument;
+    Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprNamedCallArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) preVisitExprLooksLikeCall;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) visitExprLooksLikeCall;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) canVisitExprLooksLikeCallArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprLooksLikeCallArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprLooksLikeCallArgument;
+    Func DAS_COMMENT((bool,ast::AstVisitor,ExprCall * const )) canVisitCall;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) preVisitExprCall;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) visitExprCall;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprCallArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprCallArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) preVisitExprNullCoalescing;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) visitExprNullCoalescing;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const ,smart_ptr_raw<Expression> const )) preVisitExprNullCoalescingDefault;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) preVisitExprAt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) visitExprAt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprAtIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) preVisitExprSafeAt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) visitExprSafeAt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const ,smart_ptr_raw<Expression> const )) preVisitExprSafeAtIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) preVisitExprIs;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) visitExprIs;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIs> const ,smart_ptr_raw<TypeDecl> const )) preVisitExprIsType;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) preVisitExprOp2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) visitExprOp2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const ,smart_ptr_raw<Expression> const )) preVisitExprOp2Right;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) preVisitExprOp3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) visitExprOp3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Left;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Right;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) isRightFirstExprCopy;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) preVisitExprCopy;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) visitExprCopy;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const ,smart_ptr_raw<Expression> const )) preVisitExprCopyRight;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) isRightFirstExprMove;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) preVisitExprMove;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) visitExprMove;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const ,smart_ptr_raw<Expression> const )) preVisitExprMoveRight;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) isRightFirstExprClone;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) preVisitExprClone;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) visitExprClone;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const ,smart_ptr_raw<Expression> const )) preVisitExprCloneRight;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprAssume> const )) canVisitWithAliasSubexpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAssume> const )) preVisitExprAssume;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAssume> const )) visitExprAssume;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) preVisitExprWith;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) visitExprWith;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const ,smart_ptr_raw<Expression> const )) preVisitExprWithBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) preVisitExprWhile;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) visitExprWhile;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const ,smart_ptr_raw<Expression> const )) preVisitExprWhileBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) preVisitExprTryCatch;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) visitExprTryCatch;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const ,smart_ptr_raw<Expression> const )) preVisitExprTryCatchCatch;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) preVisitExprIfThenElse;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) visitExprIfThenElse;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseIfBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseElseBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprFor;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) visitExprFor;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprForVariable;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) visitExprForVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprForSource;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) visitExprForSource;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForStack;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) preVisitExprMakeVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) visitExprMakeVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeVariantField;
+    Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeVariantField;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) canVisitExprMakeStructBody;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,smart_ptr_raw<Expression> const )) canVisitExprMakeStructBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) preVisitExprMakeStruct;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) visitExprMakeStruct;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,das::string const ,smart_ptr_raw<TypeDecl> const )) preVisitStructureAlias;
+    Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<Structure> const ,das::string const ,smart_ptr_raw<TypeDecl> const )) visitStructureAlias;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) preVisitExprMakeStructIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) visitExprMakeStructIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeStructField;
+    Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeStructField;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,smart_ptr_raw<Expression> const )) preVisitMakeStructureBlock;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,smart_ptr_raw<Expression> const )) visitMakeStructureBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) preVisitExprMakeArray;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) visitExprMakeArray;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeArrayIndex;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeArrayIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) preVisitExprMakeTuple;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) visitExprMakeTuple;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeTupleIndex;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeTupleIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) preVisitExprArrayComprehension;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) visitExprArrayComprehension;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionSubexpr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionWhere;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const ,smart_ptr_raw<Expression> const )) canVisitExprTypeInfo;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) preVisitExprTypeInfo;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) visitExprTypeInfo;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) preVisitExprPtr2Ref;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) visitExprPtr2Ref;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) preVisitExprLabel;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) visitExprLabel;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) preVisitExprGoto;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) visitExprGoto;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) preVisitExprRef2Value;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) visitExprRef2Value;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) preVisitExprRef2Ptr;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) visitExprRef2Ptr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) preVisitExprAddr;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) visitExprAddr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) preVisitExprAssert;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) visitExprAssert;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) preVisitExprStaticAssert;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) visitExprStaticAssert;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) preVisitExprQuote;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) visitExprQuote;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) preVisitExprDebug;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) visitExprDebug;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) preVisitExprInvoke;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) visitExprInvoke;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) preVisitExprErase;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) visitExprErase;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSetInsert> const )) preVisitExprSetInsert;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSetInsert> const )) visitExprSetInsert;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) preVisitExprFind;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) visitExprFind;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) preVisitExprKeyExists;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) visitExprKeyExists;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) preVisitExprAscend;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) visitExprAscend;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) preVisitExprCast;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) visitExprCast;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDelete> const ,smart_ptr_raw<Expression> const )) preVisitExprDeleteSizeExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) preVisitExprDelete;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) visitExprDelete;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) preVisitExprVar;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) visitExprVar;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTag> const )) preVisitExprTag;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTag> const ,smart_ptr_raw<Expression> const )) preVisitExprTagValue;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTag> const )) visitExprTag;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprField> const )) preVisitExprField;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprField> const )) visitExprField;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) preVisitExprSafeField;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) visitExprSafeField;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) preVisitExprSwizzle;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) visitExprSwizzle;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) preVisitExprIsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) preVisitExprAsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) preVisitExprSafeAsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) preVisitExprOp1;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) visitExprOp1;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) preVisitExprReturn;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) visitExprReturn;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) preVisitExprYield;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) visitExprYield;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) preVisitExprBreak;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) visitExprBreak;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) preVisitExprContinue;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) visitExprContinue;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) canVisitMakeBlockBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) preVisitExprMakeBlock;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) visitExprMakeBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) preVisitExprMakeGenerator;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) visitExprMakeGenerator;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) preVisitExprMemZero;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) visitExprMemZero;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) preVisitExprConst;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) visitExprConst;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) preVisitExprConstPtr;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) visitExprConstPtr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) preVisitExprConstEnumeration;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) visitExprConstEnumeration;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) preVisitExprConstBitfield;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) visitExprConstBitfield;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) preVisitExprConstInt8;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) visitExprConstInt8;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) preVisitExprConstInt16;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) visitExprConstInt16;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) preVisitExprConstInt64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) visitExprConstInt64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) preVisitExprConstInt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) visitExprConstInt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) preVisitExprConstInt2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) visitExprConstInt2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) preVisitExprConstInt3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) visitExprConstInt3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) preVisitExprConstInt4;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) visitExprConstInt4;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) preVisitExprConstUInt8;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) visitExprConstUInt8;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) preVisitExprConstUInt16;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) visitExprConstUInt16;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) preVisitExprConstUInt64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) visitExprConstUInt64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) preVisitExprConstUInt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) visitExprConstUInt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) preVisitExprConstUInt2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) visitExprConstUInt2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) preVisitExprConstUInt3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) visitExprConstUInt3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) preVisitExprConstUInt4;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) visitExprConstUInt4;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) preVisitExprConstRange;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) visitExprConstRange;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) preVisitExprConstURange;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) visitExprConstURange;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstRange64> const )) preVisitExprConstRange64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstRange64> const )) visitExprConstRange64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstURange64> const )) preVisitExprConstURange64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstURange64> const )) visitExprConstURange64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) preVisitExprConstBool;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) visitExprConstBool;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) preVisitExprConstFloat;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) visitExprConstFloat;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) preVisitExprConstFloat2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) visitExprConstFloat2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) preVisitExprConstFloat3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) visitExprConstFloat3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) preVisitExprConstFloat4;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) visitExprConstFloat4;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) preVisitExprConstString;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) visitExprConstString;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) preVisitExprConstDouble;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) visitExprConstDouble;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) preVisitExprFakeContext;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) visitExprFakeContext;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) preVisitExprFakeLineInfo;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) visitExprFakeLineInfo;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) preVisitExprReader;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) visitExprReader;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) preVisitExprUnsafe;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) visitExprUnsafe;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) preVisitExprCallMacro;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) visitExprCallMacro;
+    templates_boost::Template * rules;
+    Func DAS_COMMENT((void,templates_boost::TemplateVisitor,smart_ptr_raw<TypeDecl> &)) replaceAlias;
+    Func DAS_COMMENT((void,templates_boost::TemplateVisitor,das::vector<smart_ptr<Expression>>)) preVisitAnythingCall;
+};
+static_assert(sizeof(TemplateVisitor)==2488,"structure size mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitProgram)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitProgram)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitProgramBody)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitModule)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitModule)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprTypeDecl)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprTypeDecl)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitTypeDecl)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitTypeDecl)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitAlias)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitAlias)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,canVisitEnumeration)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitEnumeration)==112,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitEnumerationValue)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitEnumerationValue)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitEnumeration)==136,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,canVisitStructure)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitStructure)==152,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitStructureField)==160,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,canVisitStructureFieldInit)==168,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitStructureField)==176,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitStructure)==184,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,canVisitFunction)==192,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,canVisitFunctionArgumentInit)==200,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitFunction)==208,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitFunction)==216,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitFunctionArgument)==224,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitFunctionArgument)==232,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitFunctionArgumentInit)==240,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitFunctionArgumentInit)==248,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitFunctionBody)==256,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitFunctionBody)==264,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExpression)==272,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExpression)==280,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprBlock)==288,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprBlock)==296,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprBlockArgument)==304,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprBlockArgument)==312,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprBlockArgumentInit)==320,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprBlockArgumentInit)==328,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprBlockExpression)==336,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprBlockExpression)==344,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprBlockFinal)==352,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprBlockFinal)==360,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprBlockFinalExpression)==368,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprBlockFinalExpression)==376,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprLet)==384,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprLet)==392,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprLetVariable)==400,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprLetVariable)==408,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprLetVariableInit)==416,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprLetVariableInit)==424,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,canVisitGlobalVariable)==432,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitGlobalLet)==440,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitGlobalLet)==448,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitGlobalLetVariable)==456,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitGlobalLetVariable)==464,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitGlobalLetVariableInit)==472,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitGlobalLetVariableInit)==480,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprStringBuilder)==488,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprStringBuilder)==496,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprStringBuilderElement)==504,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprStringBuilderElement)==512,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprNew)==520,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprNew)==528,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprNewArgument)==536,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprNewArgument)==544,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprNamedCall)==552,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprNamedCall)==560,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprNamedCallArgument)==568,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprNamedCallArgument)==576,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprLooksLikeCall)==584,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprLooksLikeCall)==592,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,canVisitExprLooksLikeCallArgument)==600,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprLooksLikeCallArgument)==608,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprLooksLikeCallArgument)==616,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,canVisitCall)==624,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprCall)==632,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprCall)==640,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprCallArgument)==648,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprCallArgument)==656,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprNullCoalescing)==664,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprNullCoalescing)==672,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprNullCoalescingDefault)==680,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprAt)==688,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprAt)==696,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprAtIndex)==704,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprSafeAt)==712,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprSafeAt)==720,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprSafeAtIndex)==728,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprIs)==736,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprIs)==744,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprIsType)==752,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprOp2)==760,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprOp2)==768,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprOp2Right)==776,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprOp3)==784,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprOp3)==792,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprOp3Left)==800,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprOp3Right)==808,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,isRightFirstExprCopy)==816,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprCopy)==824,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprCopy)==832,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprCopyRight)==840,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,isRightFirstExprMove)==848,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMove)==856,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprMove)==864,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMoveRight)==872,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,isRightFirstExprClone)==880,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprClone)==888,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprClone)==896,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprCloneRight)==904,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,canVisitWithAliasSubexpression)==912,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprAssume)==920,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprAssume)==928,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprWith)==936,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprWith)==944,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprWithBody)==952,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprWhile)==960,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprWhile)==968,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprWhileBody)==976,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprTryCatch)==984,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprTryCatch)==992,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprTryCatchCatch)==1000,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprIfThenElse)==1008,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprIfThenElse)==1016,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprIfThenElseIfBlock)==1024,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprIfThenElseElseBlock)==1032,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprFor)==1040,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprFor)==1048,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprForVariable)==1056,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprForVariable)==1064,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprForSource)==1072,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprForSource)==1080,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprForStack)==1088,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprForBody)==1096,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMakeVariant)==1104,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprMakeVariant)==1112,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMakeVariantField)==1120,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprMakeVariantField)==1128,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,canVisitExprMakeStructBody)==1136,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,canVisitExprMakeStructBlock)==1144,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMakeStruct)==1152,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprMakeStruct)==1160,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitStructureAlias)==1168,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitStructureAlias)==1176,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMakeStructIndex)==1184,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprMakeStructIndex)==1192,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMakeStructField)==1200,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprMakeStructField)==1208,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitMakeStructureBlock)==1216,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitMakeStructureBlock)==1224,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMakeArray)==1232,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprMakeArray)==1240,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMakeArrayIndex)==1248,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprMakeArrayIndex)==1256,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMakeTuple)==1264,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprMakeTuple)==1272,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMakeTupleIndex)==1280,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprMakeTupleIndex)==1288,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprArrayComprehension)==1296,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprArrayComprehension)==1304,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprArrayComprehensionSubexpr)==1312,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprArrayComprehensionWhere)==1320,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,canVisitExprTypeInfo)==1328,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprTypeInfo)==1336,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprTypeInfo)==1344,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprPtr2Ref)==1352,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprPtr2Ref)==1360,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprLabel)==1368,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprLabel)==1376,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprGoto)==1384,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprGoto)==1392,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprRef2Value)==1400,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprRef2Value)==1408,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprRef2Ptr)==1416,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprRef2Ptr)==1424,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprAddr)==1432,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprAddr)==1440,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprAssert)==1448,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprAssert)==1456,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprStaticAssert)==1464,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprStaticAssert)==1472,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprQuote)==1480,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprQuote)==1488,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprDebug)==1496,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprDebug)==1504,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprInvoke)==1512,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprInvoke)==1520,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprErase)==1528,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprErase)==1536,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprSetInsert)==1544,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprSetInsert)==1552,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprFind)==1560,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprFind)==1568,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprKeyExists)==1576,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprKeyExists)==1584,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprAscend)==1592,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprAscend)==1600,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprCast)==1608,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprCast)==1616,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprDeleteSizeExpression)==1624,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprDelete)==1632,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprDelete)==1640,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprVar)==1648,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprVar)==1656,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprTag)==1664,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprTagValue)==1672,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprTag)==1680,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprField)==1688,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprField)==1696,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprSafeField)==1704,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprSafeField)==1712,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprSwizzle)==1720,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprSwizzle)==1728,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprIsVariant)==1736,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprIsVariant)==1744,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprAsVariant)==1752,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprAsVariant)==1760,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprSafeAsVariant)==1768,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprSafeAsVariant)==1776,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprOp1)==1784,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprOp1)==1792,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprReturn)==1800,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprReturn)==1808,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprYield)==1816,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprYield)==1824,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprBreak)==1832,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprBreak)==1840,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprContinue)==1848,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprContinue)==1856,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,canVisitMakeBlockBody)==1864,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMakeBlock)==1872,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprMakeBlock)==1880,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMakeGenerator)==1888,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprMakeGenerator)==1896,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMemZero)==1904,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprMemZero)==1912,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConst)==1920,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConst)==1928,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstPtr)==1936,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstPtr)==1944,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstEnumeration)==1952,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstEnumeration)==1960,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstBitfield)==1968,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstBitfield)==1976,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstInt8)==1984,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstInt8)==1992,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstInt16)==2000,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstInt16)==2008,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstInt64)==2016,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstInt64)==2024,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstInt)==2032,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstInt)==2040,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstInt2)==2048,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstInt2)==2056,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstInt3)==2064,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstInt3)==2072,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstInt4)==2080,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstInt4)==2088,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstUInt8)==2096,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstUInt8)==2104,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstUInt16)==2112,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstUInt16)==2120,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstUInt64)==2128,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstUInt64)==2136,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstUInt)==2144,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstUInt)==2152,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstUInt2)==2160,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstUInt2)==2168,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstUInt3)==2176,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstUInt3)==2184,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstUInt4)==2192,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstUInt4)==2200,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstRange)==2208,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstRange)==2216,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstURange)==2224,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstURange)==2232,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstRange64)==2240,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstRange64)==2248,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstURange64)==2256,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstURange64)==2264,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstBool)==2272,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstBool)==2280,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstFloat)==2288,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstFloat)==2296,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstFloat2)==2304,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstFloat2)==2312,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstFloat3)==2320,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstFloat3)==2328,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstFloat4)==2336,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstFloat4)==2344,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstString)==2352,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstString)==2360,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstDouble)==2368,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstDouble)==2376,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprFakeContext)==2384,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprFakeContext)==2392,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprFakeLineInfo)==2400,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprFakeLineInfo)==2408,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprReader)==2416,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprReader)==2424,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprUnsafe)==2432,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprUnsafe)==2440,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprCallMacro)==2448,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprCallMacro)==2456,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,rules)==2464,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,replaceAlias)==2472,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitAnythingCall)==2480,"structure field offset mismatch with DAS");
+}
+namespace templates_boost {
+
+struct RemoveDerefVisitor {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstVisitor)) __finalize;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgram;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitProgram;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const ,Module * const )) preVisitProgramBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,Module * const )) preVisitModule;
+    Func DAS_COMMENT((void,ast::AstVisitor,Module * const )) visitModule;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTypeDecl> const )) preVisitExprTypeDecl;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTypeDecl> const )) visitExprTypeDecl;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) preVisitTypeDecl;
+    Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) visitTypeDecl;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) preVisitAlias;
+    Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) visitAlias;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Enumeration * const )) canVisitEnumeration;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) preVisitEnumeration;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) preVisitEnumerationValue;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) visitEnumerationValue;
+    Func DAS_COMMENT((smart_ptr_raw<Enumeration>,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) visitEnumeration;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Structure * const )) canVisitStructure;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const )) preVisitStructure;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) preVisitStructureField;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<Structure> const )) canVisitStructureFieldInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) visitStructureField;
+    Func DAS_COMMENT((smart_ptr_raw<Structure>,ast::AstVisitor,smart_ptr_raw<Structure> const )) visitStructure;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Function * const )) canVisitFunction;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Function * const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) canVisitFunctionArgumentInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunction;
+    Func DAS_COMMENT((smart_ptr_raw<Function>,ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunction;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) preVisitFunctionArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) visitFunctionArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitFunctionArgumentInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitFunctionArgumentInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Expression> const )) preVisitFunctionBody;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Expression> const )) visitFunctionBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Expression> const )) preVisitExpression;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Expression> const )) visitExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlock;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprBlockArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) visitExprBlockArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockArgumentInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprBlockArgumentInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockExpression;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlockFinal;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlockFinal;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockFinalExpression;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockFinalExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) preVisitExprLet;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) visitExprLet;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprLetVariable;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) visitExprLetVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprLetVariableInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprLetVariableInit;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Variable * const )) canVisitGlobalVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitGlobalLet;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitGlobalLet;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) preVisitGlobalLetVariable;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) visitGlobalLetVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitGlobalLetVariableInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitGlobalLetVariableInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) preVisitExprStringBuilder;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) visitExprStringBuilder;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprStringBuilderElement;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) visitExprStringBuilderElement;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) preVisitExprNew;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) visitExprNew;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprNewArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) visitExprNewArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) preVisitExprNamedCall;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) visitExprNamedCall;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprNamedCallArgument;
+    Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprNamedCallArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) preVisitExprLooksLikeCall;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) visitExprLooksLikeCall;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) canVisitExprLooksLikeCallArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprLooksLikeCallArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprLooksLikeCallArgument;
+    Func DAS_COMMENT((bool,ast::AstVisitor,ExprCall * const )) canVisitCall;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) preVisitExprCall;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) visitExprCall;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprCallArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprCallArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) preVisitExprNullCoalescing;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) visitExprNullCoalescing;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const ,smart_ptr_raw<Expression> const )) preVisitExprNullCoalescingDefault;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) preVisitExprAt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) visitExprAt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprAtIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) preVisitExprSafeAt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) visitExprSafeAt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const ,smart_ptr_raw<Expression> const )) preVisitExprSafeAtIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) preVisitExprIs;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) visitExprIs;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIs> const ,smart_ptr_raw<TypeDecl> const )) preVisitExprIsType;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) preVisitExprOp2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) visitExprOp2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const ,smart_ptr_raw<Expression> const )) preVisitExprOp2Right;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) preVisitExprOp3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) visitExprOp3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Left;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Right;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) isRightFirstExprCopy;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) preVisitExprCopy;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) visitExprCopy;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const ,smart_ptr_raw<Expression> const )) preVisitExprCopyRight;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) isRightFirstExprMove;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) preVisitExprMove;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) visitExprMove;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const ,smart_ptr_raw<Expression> const )) preVisitExprMoveRight;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) isRightFirstExprClone;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) preVisitExprClone;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) visitExprClone;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const ,smart_ptr_raw<Expression> const )) preVisitExprCloneRight;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprAssume> const )) canVisitWithAliasSubexpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAssume> const )) preVisitExprAssume;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAssume> const )) visitExprAssume;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) preVisitExprWith;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) visitExprWith;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const ,smart_ptr_raw<Expression> const )) preVisitExprWithBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) preVisitExprWhile;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) visitExprWhile;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const ,smart_ptr_raw<Expression> const )) preVisitExprWhileBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) preVisitExprTryCatch;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) visitExprTryCatch;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const ,smart_ptr_raw<Expression> const )) preVisitExprTryCatchCatch;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) preVisitExprIfThenElse;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) visitExprIfThenElse;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseIfBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseElseBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprFor;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) visitExprFor;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprForVariable;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) visitExprForVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprForSource;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) visitExprForSource;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForStack;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) preVisitExprMakeVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) visitExprMakeVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeVariantField;
+    Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeVariantField;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) canVisitExprMakeStructBody;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,smart_ptr_raw<Expression> const )) canVisitExprMakeStructBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) preVisitExprMakeStruct;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) visitExprMakeStruct;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,das::string const ,smart_ptr_raw<TypeDecl> const )) preVisitStructureAlias;
+    Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<Structure> const ,das::string const ,smart_ptr_raw<TypeDecl> const )) visitStructureAlias;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) preVisitExprMakeStructIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) visitExprMakeStructIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeStructField;
+    Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeStructField;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,smart_ptr_raw<Expression> const )) preVisitMakeStructureBlock;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,smart_ptr_raw<Expression> const )) visitMakeStructureBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) preVisitExprMakeArray;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) visitExprMakeArray;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeArrayIndex;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeArrayIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) preVisitExprMakeTuple;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) visitExprMakeTuple;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeTupleIndex;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeTupleIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) preVisitExprArrayComprehension;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) visitExprArrayComprehension;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionSubexpr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionWhere;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const ,smart_ptr_raw<Expression> const )) canVisitExprTypeInfo;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) preVisitExprTypeInfo;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) visitExprTypeInfo;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) preVisitExprPtr2Ref;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) visitExprPtr2Ref;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) preVisitExprLabel;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) visitExprLabel;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) preVisitExprGoto;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) visitExprGoto;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) preVisitExprRef2Value;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) visitExprRef2Value;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) preVisitExprRef2Ptr;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) visitExprRef2Ptr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) preVisitExprAddr;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) visitExprAddr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) preVisitExprAssert;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) visitExprAssert;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) preVisitExprStaticAssert;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) visitExprStaticAssert;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) preVisitExprQuote;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) visitExprQuote;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) preVisitExprDebug;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) visitExprDebug;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) preVisitExprInvoke;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) visitExprInvoke;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) preVisitExprErase;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) visitExprErase;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSetInsert> const )) preVisitExprSetInsert;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSetInsert> const )) visitExprSetInsert;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) preVisitExprFind;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) visitExprFind;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) preVisitExprKeyExists;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) visitExprKeyExists;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) preVisitExprAscend;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) visitExprAscend;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) preVisitExprCast;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) visitExprCast;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDelete> const ,smart_ptr_raw<Expression> const )) preVisitExprDeleteSizeExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) preVisitExprDelete;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) visitExprDelete;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) preVisitExprVar;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) visitExprVar;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTag> const )) preVisitExprTag;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTag> const ,smart_ptr_raw<Expression> const )) preVisitExprTagValue;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTag> const )) visitExprTag;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprField> const )) preVisitExprField;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprField> const )) visitExprField;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) preVisitExprSafeField;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) visitExprSafeField;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) preVisitExprSwizzle;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) visitExprSwizzle;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) preVisitExprIsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) preVisitExprAsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) preVisitExprSafeAsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) preVisitExprOp1;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) visitExprOp1;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) preVisitExprReturn;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) visitExprReturn;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) preVisitExprYield;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) visitExprYield;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) preVisitExprBreak;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) visitExprBreak;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) preVisitExprContinue;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) visitExprContinue;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) canVisitMakeBlockBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) preVisitExprMakeBlock;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) visitExprMakeBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) preVisitExprMakeGenerator;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) visitExprMakeGenerator;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) preVisitExprMemZero;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) visitExprMemZero;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) preVisitExprConst;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) visitExprConst;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) preVisitExprConstPtr;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) visitExprConstPtr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) preVisitExprConstEnumeration;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) visitExprConstEnumeration;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) preVisitExprConstBitfield;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) visitExprConstBitfield;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) preVisitExprConstInt8;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) visitExprConstInt8;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) preVisitExprConstInt16;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) visitExprConstInt16;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) preVisitExprConstInt64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) visitExprConstInt64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) preVisitExprConstInt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) visitExprConstInt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) preVisitExprConstInt2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) visitExprConstInt2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) preVisitExprConstInt3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) visitExprConstInt3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) preVisitExprConstInt4;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) visitExprConstInt4;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) preVisitExprConstUInt8;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) visitExprConstUInt8;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) preVisitExprConstUInt16;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) visitExprConstUInt16;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) preVisitExprConstUInt64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) visitExprConstUInt64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) preVisitExprConstUInt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) visitExprConstUInt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) preVisitExprConstUInt2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) visitExprConstUInt2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) preVisitExprConstUInt3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) visitExprConstUInt3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) preVisitExprConstUInt4;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) visitExprConstUInt4;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) preVisitExprConstRange;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) visitExprConstRange;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) preVisitExprConstURange;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) visitExprConstURange;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstRange64> const )) preVisitExprConstRange64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstRange64> const )) visitExprConstRange64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstURange64> const )) preVisitExprConstURange64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstURange64> const )) visitExprConstURange64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) preVisitExprConstBool;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) visitExprConstBool;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) preVisitExprConstFloat;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) visitExprConstFloat;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) preVisitExprConstFloat2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) visitExprConstFloat2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) preVisitExprConstFloat3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) visitExprConstFloat3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) preVisitExprConstFloat4;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) visitExprConstFloat4;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) preVisitExprConstString;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) visitExprConstString;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) preVisitExprConstDouble;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) visitExprConstDouble;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) preVisitExprFakeContext;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) visitExprFakeContext;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) preVisitExprFakeLineInfo;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) visitExprFakeLineInfo;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) preVisitExprReader;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) visitExprReader;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) preVisitExprUnsafe;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) visitExprUnsafe;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) preVisitExprCallMacro;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) visitExprCallMacro;
+    char * vname;
+};
+static_assert(sizeof(RemoveDerefVisitor)==2472,"structure size mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitProgram)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitProgram)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitProgramBody)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitModule)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitModule)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprTypeDecl)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprTypeDecl)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitTypeDecl)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitTypeDecl)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitAlias)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitAlias)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,canVisitEnumeration)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitEnumeration)==112,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitEnumerationValue)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitEnumerationValue)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitEnumeration)==136,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,canVisitStructure)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitStructure)==152,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitStructureField)==160,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,canVisitStructureFieldInit)==168,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitStructureField)==176,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitStructure)==184,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,canVisitFunction)==192,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,canVisitFunctionArgumentInit)==200,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitFunction)==208,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitFunction)==216,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitFunctionArgument)==224,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitFunctionArgument)==232,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitFunctionArgumentInit)==240,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitFunctionArgumentInit)==248,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitFunctionBody)==256,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitFunctionBody)==264,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExpression)==272,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExpression)==280,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprBlock)==288,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprBlock)==296,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprBlockArgument)==304,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprBlockArgument)==312,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprBlockArgumentInit)==320,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprBlockArgumentInit)==328,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprBlockExpression)==336,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprBlockExpression)==344,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprBlockFinal)==352,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprBlockFinal)==360,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprBlockFinalExpression)==368,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprBlockFinalExpression)==376,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprLet)==384,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprLet)==392,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprLetVariable)==400,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprLetVariable)==408,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprLetVariableInit)==416,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprLetVariableInit)==424,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,canVisitGlobalVariable)==432,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitGlobalLet)==440,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitGlobalLet)==448,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitGlobalLetVariable)==456,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitGlobalLetVariable)==464,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitGlobalLetVariableInit)==472,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitGlobalLetVariableInit)==480,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprStringBuilder)==488,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprStringBuilder)==496,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprStringBuilderElement)==504,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprStringBuilderElement)==512,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprNew)==520,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprNew)==528,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprNewArgument)==536,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprNewArgument)==544,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprNamedCall)==552,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprNamedCall)==560,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprNamedCallArgument)==568,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprNamedCallArgument)==576,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprLooksLikeCall)==584,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprLooksLikeCall)==592,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,canVisitExprLooksLikeCallArgument)==600,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprLooksLikeCallArgument)==608,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprLooksLikeCallArgument)==616,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,canVisitCall)==624,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprCall)==632,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprCall)==640,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprCallArgument)==648,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprCallArgument)==656,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprNullCoalescing)==664,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprNullCoalescing)==672,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprNullCoalescingDefault)==680,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprAt)==688,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprAt)==696,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprAtIndex)==704,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprSafeAt)==712,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprSafeAt)==720,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprSafeAtIndex)==728,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprIs)==736,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprIs)==744,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprIsType)==752,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprOp2)==760,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprOp2)==768,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprOp2Right)==776,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprOp3)==784,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprOp3)==792,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprOp3Left)==800,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprOp3Right)==808,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,isRightFirstExprCopy)==816,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprCopy)==824,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprCopy)==832,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprCopyRight)==840,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,isRightFirstExprMove)==848,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprMove)==856,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprMove)==864,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprMoveRight)==872,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,isRightFirstExprClone)==880,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprClone)==888,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprClone)==896,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprCloneRight)==904,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,canVisitWithAliasSubexpression)==912,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprAssume)==920,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprAssume)==928,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprWith)==936,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprWith)==944,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprWithBody)==952,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprWhile)==960,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprWhile)==968,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprWhileBody)==976,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprTryCatch)==984,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprTryCatch)==992,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprTryCatchCatch)==1000,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprIfThenElse)==1008,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprIfThenElse)==1016,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprIfThenElseIfBlock)==1024,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprIfThenElseElseBlock)==1032,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprFor)==1040,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprFor)==1048,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprForVariable)==1056,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprForVariable)==1064,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprForSource)==1072,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprForSource)==1080,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprForStack)==1088,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprForBody)==1096,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprMakeVariant)==1104,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprMakeVariant)==1112,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprMakeVariantField)==1120,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprMakeVariantField)==1128,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,canVisitExprMakeStructBody)==1136,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,canVisitExprMakeStructBlock)==1144,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprMakeStruct)==1152,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprMakeStruct)==1160,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitStructureAlias)==1168,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitStructureAlias)==1176,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprMakeStructIndex)==1184,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprMakeStructIndex)==1192,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprMakeStructField)==1200,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprMakeStructField)==1208,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitMakeStructureBlock)==1216,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitMakeStructureBlock)==1224,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprMakeArray)==1232,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprMakeArray)==1240,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprMakeArrayIndex)==1248,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprMakeArrayIndex)==1256,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprMakeTuple)==1264,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprMakeTuple)==1272,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprMakeTupleIndex)==1280,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprMakeTupleIndex)==1288,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprArrayComprehension)==1296,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprArrayComprehension)==1304,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprArrayComprehensionSubexpr)==1312,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprArrayComprehensionWhere)==1320,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,canVisitExprTypeInfo)==1328,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprTypeInfo)==1336,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprTypeInfo)==1344,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprPtr2Ref)==1352,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprPtr2Ref)==1360,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprLabel)==1368,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprLabel)==1376,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprGoto)==1384,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprGoto)==1392,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprRef2Value)==1400,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprRef2Value)==1408,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprRef2Ptr)==1416,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprRef2Ptr)==1424,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprAddr)==1432,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprAddr)==1440,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprAssert)==1448,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprAssert)==1456,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprStaticAssert)==1464,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprStaticAssert)==1472,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprQuote)==1480,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprQuote)==1488,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprDebug)==1496,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprDebug)==1504,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprInvoke)==1512,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprInvoke)==1520,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprErase)==1528,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprErase)==1536,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprSetInsert)==1544,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprSetInsert)==1552,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprFind)==1560,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprFind)==1568,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprKeyExists)==1576,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprKeyExists)==1584,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprAscend)==1592,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprAscend)==1600,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprCast)==1608,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprCast)==1616,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprDeleteSizeExpression)==1624,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprDelete)==1632,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprDelete)==1640,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprVar)==1648,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprVar)==1656,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprTag)==1664,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprTagValue)==1672,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprTag)==1680,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprField)==1688,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprField)==1696,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprSafeField)==1704,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprSafeField)==1712,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprSwizzle)==1720,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprSwizzle)==1728,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprIsVariant)==1736,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprIsVariant)==1744,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprAsVariant)==1752,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprAsVariant)==1760,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprSafeAsVariant)==1768,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprSafeAsVariant)==1776,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprOp1)==1784,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprOp1)==1792,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprReturn)==1800,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprReturn)==1808,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprYield)==1816,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprYield)==1824,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprBreak)==1832,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprBreak)==1840,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprContinue)==1848,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprContinue)==1856,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,canVisitMakeBlockBody)==1864,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprMakeBlock)==1872,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprMakeBlock)==1880,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprMakeGenerator)==1888,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprMakeGenerator)==1896,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprMemZero)==1904,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprMemZero)==1912,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConst)==1920,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConst)==1928,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstPtr)==1936,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstPtr)==1944,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstEnumeration)==1952,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstEnumeration)==1960,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstBitfield)==1968,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstBitfield)==1976,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstInt8)==1984,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstInt8)==1992,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstInt16)==2000,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstInt16)==2008,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstInt64)==2016,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstInt64)==2024,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstInt)==2032,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstInt)==2040,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstInt2)==2048,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstInt2)==2056,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstInt3)==2064,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstInt3)==2072,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstInt4)==2080,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstInt4)==2088,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstUInt8)==2096,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstUInt8)==2104,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstUInt16)==2112,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstUInt16)==2120,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstUInt64)==2128,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstUInt64)==2136,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstUInt)==2144,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstUInt)==2152,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstUInt2)==2160,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstUInt2)==2168,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstUInt3)==2176,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstUInt3)==2184,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstUInt4)==2192,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstUInt4)==2200,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstRange)==2208,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstRange)==2216,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstURange)==2224,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstURange)==2232,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstRange64)==2240,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstRange64)==2248,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstURange64)==2256,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstURange64)==2264,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstBool)==2272,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstBool)==2280,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstFloat)==2288,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstFloat)==2296,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstFloat2)==2304,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstFloat2)==2312,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstFloat3)==2320,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstFloat3)==2328,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstFloat4)==2336,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstFloat4)==2344,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstString)==2352,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstString)==2360,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprConstDouble)==2368,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprConstDouble)==2376,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprFakeContext)==2384,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprFakeContext)==2392,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprFakeLineInfo)==2400,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprFakeLineInfo)==2408,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprReader)==2416,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprReader)==2424,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprUnsafe)==2432,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprUnsafe)==2440,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,preVisitExprCallMacro)==2448,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,visitExprCallMacro)==2456,"structure field offset mismatch with DAS");
+static_assert(offsetof(RemoveDerefVisitor,vname)==2464,"structure field offset mismatch with DAS");
+}
+namespace templates_boost {
+
+struct QRulesVisitor {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstVisitor)) __finalize;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgram;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitProgram;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const ,Module * const )) preVisitProgramBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,Module * const )) preVisitModule;
+    Func DAS_COMMENT((void,ast::AstVisitor,Module * const )) visitModule;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTypeDecl> const )) preVisitExprTypeDecl;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTypeDecl> const )) visitExprTypeDecl;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) preVisitTypeDecl;
+    Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) visitTypeDecl;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) preVisitAlias;
+    Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) visitAlias;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Enumeration * const )) canVisitEnumeration;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) preVisitEnumeration;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) preVisitEnumerationValue;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) visitEnumerationValue;
+    Func DAS_COMMENT((smart_ptr_raw<Enumeration>,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) visitEnumeration;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Structure * const )) canVisitStructure;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const )) preVisitStructure;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) preVisitStructureField;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<Structure> const )) canVisitStructureFieldInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) visitStructureField;
+    Func DAS_COMMENT((smart_ptr_raw<Structure>,ast::AstVisitor,smart_ptr_raw<Structure> const )) visitStructure;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Function * const )) canVisitFunction;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Function * const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) canVisitFunctionArgumentInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunction;
+    Func DAS_COMMENT((smart_ptr_raw<Function>,ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunction;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) preVisitFunctionArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) visitFunctionArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitFunctionArgumentInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitFunctionArgumentInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Expression> const )) preVisitFunctionBody;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Expression> const )) visitFunctionBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Expression> const )) preVisitExpression;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Expression> const )) visitExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlock;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprBlockArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) visitExprBlockArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockArgumentInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprBlockArgumentInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockExpression;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlockFinal;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlockFinal;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockFinalExpression;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockFinalExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) preVisitExprLet;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) visitExprLet;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprLetVariable;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) visitExprLetVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprLetVariableInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprLetVariableInit;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Variable * const )) canVisitGlobalVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitGlobalLet;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitGlobalLet;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) preVisitGlobalLetVariable;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) visitGlobalLetVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitGlobalLetVariableInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitGlobalLetVariableInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) preVisitExprStringBuilder;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) visitExprStringBuilder;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprStringBuilderElement;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) visitExprStringBuilderElement;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) preVisitExprNew;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) visitExprNew;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprNewArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) visitExprNewArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) preVisitExprNamedCall;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) visitExprNamedCall;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprNamedCallArgument;
+    Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprNamedCallArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) preVisitExprLooksLikeCall;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) visitExprLooksLikeCall;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) canVisitExprLooksLikeCallArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprLooksLikeCallArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprLooksLikeCallArgument;
+    Func DAS_COMMENT((bool,ast::AstVisitor,ExprCall * const )) canVisitCall;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) preVisitExprCall;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) visitExprCall;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprCallArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprCallArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) preVisitExprNullCoalescing;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) visitExprNullCoalescing;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const ,smart_ptr_raw<Expression> const )) preVisitExprNullCoalescingDefault;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) preVisitExprAt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) visitExprAt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprAtIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) preVisitExprSafeAt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) visitExprSafeAt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const ,smart_ptr_raw<Expression> const )) preVisitExprSafeAtIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) preVisitExprIs;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) visitExprIs;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIs> const ,smart_ptr_raw<TypeDecl> const )) preVisitExprIsType;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) preVisitExprOp2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) visitExprOp2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const ,smart_ptr_raw<Expression> const )) preVisitExprOp2Right;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) preVisitExprOp3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) visitExprOp3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Left;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Right;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) isRightFirstExprCopy;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) preVisitExprCopy;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) visitExprCopy;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const ,smart_ptr_raw<Expression> const )) preVisitExprCopyRight;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) isRightFirstExprMove;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) preVisitExprMove;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) visitExprMove;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const ,smart_ptr_raw<Expression> const )) preVisitExprMoveRight;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) isRightFirstExprClone;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) preVisitExprClone;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) visitExprClone;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const ,smart_ptr_raw<Expression> const )) preVisitExprCloneRight;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprAssume> const )) canVisitWithAliasSubexpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAssume> const )) preVisitExprAssume;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAssume> const )) visitExprAssume;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) preVisitExprWith;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) visitExprWith;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const ,smart_ptr_raw<Expression> const )) preVisitExprWithBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) preVisitExprWhile;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) visitExprWhile;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const ,smart_ptr_raw<Expression> const )) preVisitExprWhileBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) preVisitExprTryCatch;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) visitExprTryCatch;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const ,smart_ptr_raw<Expression> const )) preVisitExprTryCatchCatch;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) preVisitExprIfThenElse;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) visitExprIfThenElse;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseIfBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseElseBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprFor;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) visitExprFor;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprForVariable;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) visitExprForVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprForSource;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) visitExprForSource;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForStack;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) preVisitExprMakeVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) visitExprMakeVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeVariantField;
+    Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeVariantField;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) canVisitExprMakeStructBody;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,smart_ptr_raw<Expression> const )) canVisitExprMakeStructBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) preVisitExprMakeStruct;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) visitExprMakeStruct;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,das::string const ,smart_ptr_raw<TypeDecl> const )) preVisitStructureAlias;
+    Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<Structure> const ,das::string const ,smart_ptr_raw<TypeDecl> const )) visitStructureAlias;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) preVisitExprMakeStructIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) visitExprMakeStructIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeStructField;
+    Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeStructField;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,smart_ptr_raw<Expression> const )) preVisitMakeStructureBlock;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,smart_ptr_raw<Expression> const )) visitMakeStructureBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) preVisitExprMakeArray;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) visitExprMakeArray;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeArrayIndex;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeArrayIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) preVisitExprMakeTuple;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) visitExprMakeTuple;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeTupleIndex;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeTupleIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) preVisitExprArrayComprehension;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) visitExprArrayComprehension;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionSubexpr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionWhere;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const ,smart_ptr_raw<Expression> const )) canVisitExprTypeInfo;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) preVisitExprTypeInfo;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) visitExprTypeInfo;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) preVisitExprPtr2Ref;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) visitExprPtr2Ref;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) preVisitExprLabel;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) visitExprLabel;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) preVisitExprGoto;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) visitExprGoto;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) preVisitExprRef2Value;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) visitExprRef2Value;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) preVisitExprRef2Ptr;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) visitExprRef2Ptr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) preVisitExprAddr;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) visitExprAddr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) preVisitExprAssert;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) visitExprAssert;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) preVisitExprStaticAssert;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) visitExprStaticAssert;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) preVisitExprQuote;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) visitExprQuote;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) preVisitExprDebug;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) visitExprDebug;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) preVisitExprInvoke;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) visitExprInvoke;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) preVisitExprErase;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) visitExprErase;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSetInsert> const )) preVisitExprSetInsert;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSetInsert> const )) visitExprSetInsert;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) preVisitExprFind;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) visitExprFind;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) preVisitExprKeyExists;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) visitExprKeyExists;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) preVisitExprAscend;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) visitExprAscend;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) preVisitExprCast;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) visitExprCast;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDelete> const ,smart_ptr_raw<Expression> const )) preVisitExprDeleteSizeExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) preVisitExprDelete;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) visitExprDelete;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) preVisitExprVar;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) visitExprVar;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTag> const )) preVisitExprTag;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTag> const ,smart_ptr_raw<Expression> const )) preVisitExprTagValue;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTag> const )) visitExprTag;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprField> const )) preVisitExprField;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprField> const )) visitExprField;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) preVisitExprSafeField;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) visitExprSafeField;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) preVisitExprSwizzle;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) visitExprSwizzle;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) preVisitExprIsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) preVisitExprAsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) preVisitExprSafeAsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) preVisitExprOp1;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) visitExprOp1;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) preVisitExprReturn;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) visitExprReturn;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) preVisitExprYield;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) visitExprYield;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) preVisitExprBreak;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) visitExprBreak;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) preVisitExprContinue;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) visitExprContinue;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) canVisitMakeBlockBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) preVisitExprMakeBlock;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) visitExprMakeBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) preVisitExprMakeGenerator;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) visitExprMakeGenerator;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) preVisitExprMemZero;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) visitExprMemZero;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) preVisitExprConst;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) visitExprConst;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) preVisitExprConstPtr;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) visitExprConstPtr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) preVisitExprConstEnumeration;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) visitExprConstEnumeration;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) preVisitExprConstBitfield;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) visitExprConstBitfield;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) preVisitExprConstInt8;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) visitExprConstInt8;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) preVisitExprConstInt16;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) visitExprConstInt16;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) preVisitExprConstInt64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) visitExprConstInt64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) preVisitExprConstInt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) visitExprConstInt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) preVisitExprConstInt2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) visitExprConstInt2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) preVisitExprConstInt3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) visitExprConstInt3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) preVisitExprConstInt4;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) visitExprConstInt4;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) preVisitExprConstUInt8;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) visitExprConstUInt8;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) preVisitExprConstUInt16;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) visitExprConstUInt16;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) preVisitExprConstUInt64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) visitExprConstUInt64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) preVisitExprConstUInt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) visitExprConstUInt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) preVisitExprConstUInt2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) visitExprConstUInt2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) preVisitExprConstUInt3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) visitExprConstUInt3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) preVisitExprConstUInt4;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) visitExprConstUInt4;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) preVisitExprConstRange;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) visitExprConstRange;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) preVisitExprConstURange;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) visitExprConstURange;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstRange64> const )) preVisitExprConstRange64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstRange64> const )) visitExprConstRange64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstURange64> const )) preVisitExprConstURange64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstURange64> const )) visitExprConstURange64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) preVisitExprConstBool;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) visitExprConstBool;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) preVisitExprConstFloat;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) visitExprConstFloat;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) preVisitExprConstFloat2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) visitExprConstFloat2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) preVisitExprConstFloat3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) visitExprConstFloat3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) preVisitExprConstFloat4;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) visitExprConstFloat4;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) preVisitExprConstString;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) visitExprConstString;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) preVisitExprConstDouble;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) visitExprConstDouble;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) preVisitExprFakeContext;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) visitExprFakeContext;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) preVisitExprFakeLineInfo;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) visitExprFakeLineInfo;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) preVisitExprReader;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) visitExprReader;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) preVisitExprUnsafe;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) visitExprUnsafe;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) preVisitExprCallMacro;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) visitExprCallMacro;
+    int32_t tag_index;
+    bool failed;
+    ExprBlock * rblock;
+    Func DAS_COMMENT((void,templates_boost::QRulesVisitor,smart_ptr_raw<TypeDecl> &)) visitTD;
+};
+static_assert(sizeof(QRulesVisitor)==2488,"structure size mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitProgram)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitProgram)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitProgramBody)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitModule)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitModule)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprTypeDecl)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprTypeDecl)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitTypeDecl)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitTypeDecl)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitAlias)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitAlias)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,canVisitEnumeration)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitEnumeration)==112,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitEnumerationValue)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitEnumerationValue)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitEnumeration)==136,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,canVisitStructure)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitStructure)==152,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitStructureField)==160,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,canVisitStructureFieldInit)==168,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitStructureField)==176,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitStructure)==184,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,canVisitFunction)==192,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,canVisitFunctionArgumentInit)==200,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitFunction)==208,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitFunction)==216,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitFunctionArgument)==224,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitFunctionArgument)==232,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitFunctionArgumentInit)==240,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitFunctionArgumentInit)==248,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitFunctionBody)==256,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitFunctionBody)==264,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExpression)==272,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExpression)==280,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprBlock)==288,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprBlock)==296,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprBlockArgument)==304,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprBlockArgument)==312,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprBlockArgumentInit)==320,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprBlockArgumentInit)==328,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprBlockExpression)==336,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprBlockExpression)==344,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprBlockFinal)==352,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprBlockFinal)==360,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprBlockFinalExpression)==368,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprBlockFinalExpression)==376,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprLet)==384,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprLet)==392,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprLetVariable)==400,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprLetVariable)==408,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprLetVariableInit)==416,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprLetVariableInit)==424,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,canVisitGlobalVariable)==432,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitGlobalLet)==440,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitGlobalLet)==448,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitGlobalLetVariable)==456,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitGlobalLetVariable)==464,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitGlobalLetVariableInit)==472,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitGlobalLetVariableInit)==480,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprStringBuilder)==488,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprStringBuilder)==496,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprStringBuilderElement)==504,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprStringBuilderElement)==512,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprNew)==520,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprNew)==528,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprNewArgument)==536,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprNewArgument)==544,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprNamedCall)==552,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprNamedCall)==560,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprNamedCallArgument)==568,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprNamedCallArgument)==576,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprLooksLikeCall)==584,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprLooksLikeCall)==592,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,canVisitExprLooksLikeCallArgument)==600,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprLooksLikeCallArgument)==608,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprLooksLikeCallArgument)==616,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,canVisitCall)==624,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprCall)==632,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprCall)==640,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprCallArgument)==648,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprCallArgument)==656,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprNullCoalescing)==664,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprNullCoalescing)==672,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprNullCoalescingDefault)==680,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprAt)==688,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprAt)==696,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprAtIndex)==704,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprSafeAt)==712,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprSafeAt)==720,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprSafeAtIndex)==728,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprIs)==736,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprIs)==744,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprIsType)==752,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprOp2)==760,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprOp2)==768,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprOp2Right)==776,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprOp3)==784,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprOp3)==792,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprOp3Left)==800,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprOp3Right)==808,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,isRightFirstExprCopy)==816,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprCopy)==824,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprCopy)==832,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprCopyRight)==840,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,isRightFirstExprMove)==848,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprMove)==856,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprMove)==864,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprMoveRight)==872,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,isRightFirstExprClone)==880,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprClone)==888,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprClone)==896,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprCloneRight)==904,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,canVisitWithAliasSubexpression)==912,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprAssume)==920,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprAssume)==928,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprWith)==936,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprWith)==944,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprWithBody)==952,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprWhile)==960,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprWhile)==968,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprWhileBody)==976,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprTryCatch)==984,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprTryCatch)==992,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprTryCatchCatch)==1000,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprIfThenElse)==1008,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprIfThenElse)==1016,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprIfThenElseIfBlock)==1024,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprIfThenElseElseBlock)==1032,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprFor)==1040,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprFor)==1048,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprForVariable)==1056,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprForVariable)==1064,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprForSource)==1072,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprForSource)==1080,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprForStack)==1088,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprForBody)==1096,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprMakeVariant)==1104,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprMakeVariant)==1112,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprMakeVariantField)==1120,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprMakeVariantField)==1128,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,canVisitExprMakeStructBody)==1136,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,canVisitExprMakeStructBlock)==1144,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprMakeStruct)==1152,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprMakeStruct)==1160,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitStructureAlias)==1168,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitStructureAlias)==1176,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprMakeStructIndex)==1184,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprMakeStructIndex)==1192,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprMakeStructField)==1200,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprMakeStructField)==1208,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitMakeStructureBlock)==1216,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitMakeStructureBlock)==1224,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprMakeArray)==1232,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprMakeArray)==1240,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprMakeArrayIndex)==1248,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprMakeArrayIndex)==1256,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprMakeTuple)==1264,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprMakeTuple)==1272,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprMakeTupleIndex)==1280,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprMakeTupleIndex)==1288,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprArrayComprehension)==1296,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprArrayComprehension)==1304,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprArrayComprehensionSubexpr)==1312,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprArrayComprehensionWhere)==1320,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,canVisitExprTypeInfo)==1328,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprTypeInfo)==1336,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprTypeInfo)==1344,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprPtr2Ref)==1352,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprPtr2Ref)==1360,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprLabel)==1368,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprLabel)==1376,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprGoto)==1384,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprGoto)==1392,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprRef2Value)==1400,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprRef2Value)==1408,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprRef2Ptr)==1416,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprRef2Ptr)==1424,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprAddr)==1432,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprAddr)==1440,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprAssert)==1448,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprAssert)==1456,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprStaticAssert)==1464,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprStaticAssert)==1472,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprQuote)==1480,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprQuote)==1488,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprDebug)==1496,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprDebug)==1504,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprInvoke)==1512,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprInvoke)==1520,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprErase)==1528,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprErase)==1536,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprSetInsert)==1544,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprSetInsert)==1552,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprFind)==1560,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprFind)==1568,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprKeyExists)==1576,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprKeyExists)==1584,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprAscend)==1592,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprAscend)==1600,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprCast)==1608,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprCast)==1616,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprDeleteSizeExpression)==1624,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprDelete)==1632,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprDelete)==1640,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprVar)==1648,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprVar)==1656,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprTag)==1664,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprTagValue)==1672,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprTag)==1680,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprField)==1688,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprField)==1696,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprSafeField)==1704,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprSafeField)==1712,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprSwizzle)==1720,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprSwizzle)==1728,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprIsVariant)==1736,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprIsVariant)==1744,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprAsVariant)==1752,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprAsVariant)==1760,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprSafeAsVariant)==1768,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprSafeAsVariant)==1776,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprOp1)==1784,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprOp1)==1792,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprReturn)==1800,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprReturn)==1808,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprYield)==1816,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprYield)==1824,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprBreak)==1832,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprBreak)==1840,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprContinue)==1848,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprContinue)==1856,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,canVisitMakeBlockBody)==1864,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprMakeBlock)==1872,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprMakeBlock)==1880,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprMakeGenerator)==1888,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprMakeGenerator)==1896,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprMemZero)==1904,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprMemZero)==1912,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConst)==1920,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConst)==1928,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstPtr)==1936,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstPtr)==1944,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstEnumeration)==1952,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstEnumeration)==1960,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstBitfield)==1968,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstBitfield)==1976,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstInt8)==1984,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstInt8)==1992,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstInt16)==2000,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstInt16)==2008,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstInt64)==2016,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstInt64)==2024,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstInt)==2032,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstInt)==2040,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstInt2)==2048,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstInt2)==2056,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstInt3)==2064,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstInt3)==2072,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstInt4)==2080,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstInt4)==2088,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstUInt8)==2096,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstUInt8)==2104,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstUInt16)==2112,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstUInt16)==2120,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstUInt64)==2128,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstUInt64)==2136,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstUInt)==2144,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstUInt)==2152,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstUInt2)==2160,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstUInt2)==2168,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstUInt3)==2176,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstUInt3)==2184,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstUInt4)==2192,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstUInt4)==2200,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstRange)==2208,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstRange)==2216,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstURange)==2224,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstURange)==2232,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstRange64)==2240,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstRange64)==2248,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstURange64)==2256,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstURange64)==2264,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstBool)==2272,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstBool)==2280,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstFloat)==2288,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstFloat)==2296,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstFloat2)==2304,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstFloat2)==2312,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstFloat3)==2320,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstFloat3)==2328,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstFloat4)==2336,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstFloat4)==2344,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstString)==2352,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstString)==2360,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprConstDouble)==2368,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprConstDouble)==2376,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprFakeContext)==2384,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprFakeContext)==2392,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprFakeLineInfo)==2400,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprFakeLineInfo)==2408,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprReader)==2416,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprReader)==2424,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprUnsafe)==2432,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprUnsafe)==2440,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,preVisitExprCallMacro)==2448,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitExprCallMacro)==2456,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,tag_index)==2464,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,failed)==2468,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,rblock)==2472,"structure field offset mismatch with DAS");
+static_assert(offsetof(QRulesVisitor,visitTD)==2480,"structure field offset mismatch with DAS");
+}
+namespace templates_boost {
+
+struct AstQCallMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstCallMacro)) __finalize;
+    Func DAS_COMMENT((void,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) preVisit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) visit;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const ,int32_t)) canVisitArgument;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const )) canFoldReturnResult;
+    char * apply_call;
+    char * macro_call;
+};
+static_assert(sizeof(AstQCallMacro)==64,"structure size mismatch with DAS");
+static_assert(offsetof(AstQCallMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQCallMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQCallMacro,preVisit)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQCallMacro,visit)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQCallMacro,canVisitArgument)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQCallMacro,canFoldReturnResult)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQCallMacro,apply_call)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQCallMacro,macro_call)==56,"structure field offset mismatch with DAS");
+}
+namespace templates_boost {
+
+struct QMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstCallMacro)) __finalize;
+    Func DAS_COMMENT((void,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) preVisit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) visit;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const ,int32_t)) canVisitArgument;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const )) canFoldReturnResult;
+    char * apply_call;
+    char * macro_call;
+};
+static_assert(sizeof(QMacro)==64,"structure size mismatch with DAS");
+static_assert(offsetof(QMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(QMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(QMacro,preVisit)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(QMacro,visit)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(QMacro,canVisitArgument)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(QMacro,canFoldReturnResult)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(QMacro,apply_call)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(QMacro,macro_call)==56,"structure field offset mismatch with DAS");
+}
+namespace templates_boost {
+
+struct QBlockMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstCallMacro)) __finalize;
+    Func DAS_COMMENT((void,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) preVisit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) visit;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const ,int32_t)) canVisitArgument;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const )) canFoldReturnResult;
+    char * apply_call;
+    char * macro_call;
+};
+static_assert(sizeof(QBlockMacro)==64,"structure size mismatch with DAS");
+static_assert(offsetof(QBlockMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(QBlockMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(QBlockMacro,preVisit)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(QBlockMacro,visit)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(QBlockMacro,canVisitArgument)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(QBlockMacro,canFoldReturnResult)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(QBlockMacro,apply_call)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(QBlockMacro,macro_call)==56,"structure field offset mismatch with DAS");
+}
+namespace templates_boost {
+
+struct QBlockToArrayMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstCallMacro)) __finalize;
+    Func DAS_COMMENT((void,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) preVisit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) visit;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const ,int32_t)) canVisitArgument;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const )) canFoldReturnResult;
+    char * apply_call;
+    char * macro_call;
+};
+static_assert(sizeof(QBlockToArrayMacro)==64,"structure size mismatch with DAS");
+static_assert(offsetof(QBlockToArrayMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(QBlockToArrayMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(QBlockToArrayMacro,preVisit)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(QBlockToArrayMacro,visit)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(QBlockToArrayMacro,canVisitArgument)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(QBlockToArrayMacro,canFoldReturnResult)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(QBlockToArrayMacro,apply_call)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(QBlockToArrayMacro,macro_call)==56,"structure field offset mismatch with DAS");
+}
+namespace templates_boost {
+
+struct QBlockExprMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstCallMacro)) __finalize;
+    Func DAS_COMMENT((void,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) preVisit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) visit;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const ,int32_t)) canVisitArgument;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const )) canFoldReturnResult;
+    char * apply_call;
+    char * macro_call;
+};
+static_assert(sizeof(QBlockExprMacro)==64,"structure size mismatch with DAS");
+static_assert(offsetof(QBlockExprMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(QBlockExprMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(QBlockExprMacro,preVisit)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(QBlockExprMacro,visit)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(QBlockExprMacro,canVisitArgument)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(QBlockExprMacro,canFoldReturnResult)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(QBlockExprMacro,apply_call)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(QBlockExprMacro,macro_call)==56,"structure field offset mismatch with DAS");
+}
+namespace templates_boost {
+
+struct QTypeMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstCallMacro)) __finalize;
+    Func DAS_COMMENT((void,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) preVisit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) visit;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const ,int32_t)) canVisitArgument;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const )) canFoldReturnResult;
+    char * apply_call;
+    char * macro_call;
+};
+static_assert(sizeof(QTypeMacro)==64,"structure size mismatch with DAS");
+static_assert(offsetof(QTypeMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(QTypeMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(QTypeMacro,preVisit)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(QTypeMacro,visit)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(QTypeMacro,canVisitArgument)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(QTypeMacro,canFoldReturnResult)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(QTypeMacro,apply_call)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(QTypeMacro,macro_call)==56,"structure field offset mismatch with DAS");
+}
+namespace templates_boost {
+
+struct AstQNamedMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstCallMacro)) __finalize;
+    Func DAS_COMMENT((void,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) preVisit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) visit;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const ,int32_t)) canVisitArgument;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const )) canFoldReturnResult;
+    char * apply_call;
+    char * macro_call;
+};
+static_assert(sizeof(AstQNamedMacro)==64,"structure size mismatch with DAS");
+static_assert(offsetof(AstQNamedMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedMacro,preVisit)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedMacro,visit)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedMacro,canVisitArgument)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedMacro,canFoldReturnResult)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedMacro,apply_call)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedMacro,macro_call)==56,"structure field offset mismatch with DAS");
+}
+namespace templates_boost {
+
+struct AstQFunctionMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstCallMacro)) __finalize;
+    Func DAS_COMMENT((void,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) preVisit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) visit;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const ,int32_t)) canVisitArgument;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const )) canFoldReturnResult;
+    char * apply_call;
+    char * macro_call;
+};
+static_assert(sizeof(AstQFunctionMacro)==64,"structure size mismatch with DAS");
+static_assert(offsetof(AstQFunctionMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQFunctionMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQFunctionMacro,preVisit)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQFunctionMacro,visit)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQFunctionMacro,canVisitArgument)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQFunctionMacro,canFoldReturnResult)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQFunctionMacro,apply_call)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQFunctionMacro,macro_call)==56,"structure field offset mismatch with DAS");
+}
+namespace templates_boost {
+
+struct AstQVariableMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstCallMacro)) __finalize;
+    Func DAS_COMMENT((void,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) preVisit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) visit;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const ,int32_t)) canVisitArgument;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const )) canFoldReturnResult;
+    char * apply_call;
+    char * macro_call;
+};
+static_assert(sizeof(AstQVariableMacro)==64,"structure size mismatch with DAS");
+static_assert(offsetof(AstQVariableMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQVariableMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQVariableMacro,preVisit)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQVariableMacro,visit)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQVariableMacro,canVisitArgument)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQVariableMacro,canFoldReturnResult)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQVariableMacro,apply_call)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQVariableMacro,macro_call)==56,"structure field offset mismatch with DAS");
+}
+namespace templates_boost {
+
+struct AstQNamedClassMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstCallMacro)) __finalize;
+    Func DAS_COMMENT((void,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) preVisit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) visit;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const ,int32_t)) canVisitArgument;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const )) canFoldReturnResult;
+    char * apply_call;
+    char * macro_call;
+};
+static_assert(sizeof(AstQNamedClassMacro)==64,"structure size mismatch with DAS");
+static_assert(offsetof(AstQNamedClassMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedClassMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedClassMacro,preVisit)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedClassMacro,visit)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedClassMacro,canVisitArgument)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedClassMacro,canFoldReturnResult)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedClassMacro,apply_call)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedClassMacro,macro_call)==56,"structure field offset mismatch with DAS");
+}
+namespace templates_boost {
+
+struct AstQMethodMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstCallMacro)) __finalize;
+    Func DAS_COMMENT((void,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) preVisit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) visit;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const ,int32_t)) canVisitArgument;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const )) canFoldReturnResult;
+    char * apply_call;
+    char * macro_call;
+};
+static_assert(sizeof(AstQMethodMacro)==64,"structure size mismatch with DAS");
+static_assert(offsetof(AstQMethodMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQMethodMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQMethodMacro,preVisit)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQMethodMacro,visit)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQMethodMacro,canVisitArgument)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQMethodMacro,canFoldReturnResult)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQMethodMacro,apply_call)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQMethodMacro,macro_call)==56,"structure field offset mismatch with DAS");
+}
+namespace templates_boost {
+
+struct AstQNamedTemplateFunctionMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstCallMacro)) __finalize;
+    Func DAS_COMMENT((void,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) preVisit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) visit;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const ,int32_t)) canVisitArgument;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const )) canFoldReturnResult;
+    char * apply_call;
+    char * macro_call;
+};
+static_assert(sizeof(AstQNamedTemplateFunctionMacro)==64,"structure size mismatch with DAS");
+static_assert(offsetof(AstQNamedTemplateFunctionMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedTemplateFunctionMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedTemplateFunctionMacro,preVisit)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedTemplateFunctionMacro,visit)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedTemplateFunctionMacro,canVisitArgument)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedTemplateFunctionMacro,canFoldReturnResult)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedTemplateFunctionMacro,apply_call)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedTemplateFunctionMacro,macro_call)==56,"structure field offset mismatch with DAS");
+}
+namespace templates_boost {
+
+struct AstQNamedTemplateClassMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstCallMacro)) __finalize;
+    Func DAS_COMMENT((void,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) preVisit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) visit;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const ,int32_t)) canVisitArgument;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const )) canFoldReturnResult;
+    char * apply_call;
+    char * macro_call;
+};
+static_assert(sizeof(AstQNamedTemplateClassMacro)==64,"structure size mismatch with DAS");
+static_assert(offsetof(AstQNamedTemplateClassMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedTemplateClassMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedTemplateClassMacro,preVisit)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedTemplateClassMacro,visit)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedTemplateClassMacro,canVisitArgument)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedTemplateClassMacro,canFoldReturnResult)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedTemplateClassMacro,apply_call)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstQNamedTemplateClassMacro,macro_call)==56,"structure field offset mismatch with DAS");
+}
+namespace macro_boost {
+
+struct MacroVerifyMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(MacroVerifyMacro)==112,"structure size mismatch with DAS");
+static_assert(offsetof(MacroVerifyMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroVerifyMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroVerifyMacro,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroVerifyMacro,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroVerifyMacro,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroVerifyMacro,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroVerifyMacro,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroVerifyMacro,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroVerifyMacro,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroVerifyMacro,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroVerifyMacro,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroVerifyMacro,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroVerifyMacro,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroVerifyMacro,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+namespace macro_boost {
+
+struct CaptureBlock {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstVisitor)) __finalize;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgram;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitProgram;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const ,Module * const )) preVisitProgramBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,Module * const )) preVisitModule;
+    Func DAS_COMMENT((void,ast::AstVisitor,Module * const )) visitModule;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTypeDecl> const )) preVisitExprTypeDecl;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTypeDecl> const )) visitExprTypeDecl;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) preVisitTypeDecl;
+    Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) visitTypeDecl;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) preVisitAlias;
+    Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) visitAlias;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Enumeration * const )) canVisitEnumeration;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) preVisitEnumeration;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) preVisitEnumerationValue;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) visitEnumerationValue;
+    Func DAS_COMMENT((smart_ptr_raw<Enumeration>,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) visitEnumeration;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Structure * const )) canVisitStructure;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const )) preVisitStructure;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) preVisitStructureField;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<Structure> const )) canVisitStructureFieldInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) visitStructureField;
+    Func DAS_COMMENT((smart_ptr_raw<Structure>,ast::AstVisitor,smart_ptr_raw<Structure> const )) visitStructure;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Function * const )) canVisitFunction;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Function * const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) canVisitFunctionArgumentInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunction;
+    Func DAS_COMMENT((smart_ptr_raw<Function>,ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunction;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) preVisitFunctionArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) visitFunctionArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitFunctionArgumentInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitFunctionArgumentInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Expression> const )) preVisitFunctionBody;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Expression> const )) visitFunctionBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Expression> const )) preVisitExpression;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Expression> const )) visitExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlock;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprBlockArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) visitExprBlockArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockArgumentInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprBlockArgumentInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockExpression;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlockFinal;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlockFinal;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockFinalExpression;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockFinalExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) preVisitExprLet;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) visitExprLet;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprLetVariable;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) visitExprLetVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprLetVariableInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprLetVariableInit;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Variable * const )) canVisitGlobalVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitGlobalLet;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitGlobalLet;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) preVisitGlobalLetVariable;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) visitGlobalLetVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitGlobalLetVariableInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitGlobalLetVariableInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) preVisitExprStringBuilder;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) visitExprStringBuilder;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprStringBuilderElement;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) visitExprStringBuilderElement;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) preVisitExprNew;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) visitExprNew;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprNewArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) visitExprNewArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) preVisitExprNamedCall;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) visitExprNamedCall;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprNamedCallArgument;
+    Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprNamedCallArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) preVisitExprLooksLikeCall;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) visitExprLooksLikeCall;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) canVisitExprLooksLikeCallArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprLooksLikeCallArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprLooksLikeCallArgument;
+    Func DAS_COMMENT((bool,ast::AstVisitor,ExprCall * const )) canVisitCall;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) preVisitExprCall;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) visitExprCall;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprCallArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprCallArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) preVisitExprNullCoalescing;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) visitExprNullCoalescing;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const ,smart_ptr_raw<Expression> const )) preVisitExprNullCoalescingDefault;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) preVisitExprAt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) visitExprAt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprAtIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) preVisitExprSafeAt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) visitExprSafeAt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const ,smart_ptr_raw<Expression> const )) preVisitExprSafeAtIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) preVisitExprIs;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) visitExprIs;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIs> const ,smart_ptr_raw<TypeDecl> const )) preVisitExprIsType;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) preVisitExprOp2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) visitExprOp2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const ,smart_ptr_raw<Expression> const )) preVisitExprOp2Right;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) preVisitExprOp3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) visitExprOp3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Left;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Right;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) isRightFirstExprCopy;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) preVisitExprCopy;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) visitExprCopy;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const ,smart_ptr_raw<Expression> const )) preVisitExprCopyRight;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) isRightFirstExprMove;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) preVisitExprMove;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) visitExprMove;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const ,smart_ptr_raw<Expression> const )) preVisitExprMoveRight;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) isRightFirstExprClone;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) preVisitExprClone;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) visitExprClone;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const ,smart_ptr_raw<Expression> const )) preVisitExprCloneRight;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprAssume> const )) canVisitWithAliasSubexpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAssume> const )) preVisitExprAssume;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAssume> const )) visitExprAssume;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) preVisitExprWith;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) visitExprWith;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const ,smart_ptr_raw<Expression> const )) preVisitExprWithBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) preVisitExprWhile;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) visitExprWhile;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const ,smart_ptr_raw<Expression> const )) preVisitExprWhileBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) preVisitExprTryCatch;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) visitExprTryCatch;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const ,smart_ptr_raw<Expression> const )) preVisitExprTryCatchCatch;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) preVisitExprIfThenElse;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) visitExprIfThenElse;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseIfBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseElseBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprFor;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) visitExprFor;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprForVariable;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) visitExprForVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprForSource;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) visitExprForSource;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForStack;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) preVisitExprMakeVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) visitExprMakeVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeVariantField;
+    Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeVariantField;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) canVisitExprMakeStructBody;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,smart_ptr_raw<Expression> const )) canVisitExprMakeStructBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) preVisitExprMakeStruct;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) visitExprMakeStruct;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,das::string const ,smart_ptr_raw<TypeDecl> const )) preVisitStructureAlias;
+    Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<Structure> const ,das::string const ,smart_ptr_raw<TypeDecl> const )) visitStructureAlias;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) preVisitExprMakeStructIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) visitExprMakeStructIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeStructField;
+    Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeStructField;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,smart_ptr_raw<Expression> const )) preVisitMakeStructureBlock;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,smart_ptr_raw<Expression> const )) visitMakeStructureBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) preVisitExprMakeArray;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) visitExprMakeArray;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeArrayIndex;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeArrayIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) preVisitExprMakeTuple;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) visitExprMakeTuple;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeTupleIndex;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeTupleIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) preVisitExprArrayComprehension;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) visitExprArrayComprehension;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionSubexpr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionWhere;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const ,smart_ptr_raw<Expression> const )) canVisitExprTypeInfo;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) preVisitExprTypeInfo;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) visitExprTypeInfo;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) preVisitExprPtr2Ref;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) visitExprPtr2Ref;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) preVisitExprLabel;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) visitExprLabel;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) preVisitExprGoto;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) visitExprGoto;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) preVisitExprRef2Value;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) visitExprRef2Value;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) preVisitExprRef2Ptr;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) visitExprRef2Ptr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) preVisitExprAddr;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) visitExprAddr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) preVisitExprAssert;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) visitExprAssert;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) preVisitExprStaticAssert;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) visitExprStaticAssert;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) preVisitExprQuote;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) visitExprQuote;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) preVisitExprDebug;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) visitExprDebug;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) preVisitExprInvoke;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) visitExprInvoke;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) preVisitExprErase;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) visitExprErase;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSetInsert> const )) preVisitExprSetInsert;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSetInsert> const )) visitExprSetInsert;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) preVisitExprFind;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) visitExprFind;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) preVisitExprKeyExists;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) visitExprKeyExists;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) preVisitExprAscend;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) visitExprAscend;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) preVisitExprCast;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) visitExprCast;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDelete> const ,smart_ptr_raw<Expression> const )) preVisitExprDeleteSizeExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) preVisitExprDelete;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) visitExprDelete;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) preVisitExprVar;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) visitExprVar;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTag> const )) preVisitExprTag;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTag> const ,smart_ptr_raw<Expression> const )) preVisitExprTagValue;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTag> const )) visitExprTag;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprField> const )) preVisitExprField;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprField> const )) visitExprField;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) preVisitExprSafeField;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) visitExprSafeField;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) preVisitExprSwizzle;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) visitExprSwizzle;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) preVisitExprIsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) preVisitExprAsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) preVisitExprSafeAsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) preVisitExprOp1;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) visitExprOp1;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) preVisitExprReturn;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) visitExprReturn;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) preVisitExprYield;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) visitExprYield;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) preVisitExprBreak;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) visitExprBreak;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) preVisitExprContinue;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) visitExprContinue;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) canVisitMakeBlockBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) preVisitExprMakeBlock;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) visitExprMakeBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) preVisitExprMakeGenerator;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) visitExprMakeGenerator;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) preVisitExprMemZero;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) visitExprMemZero;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) preVisitExprConst;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) visitExprConst;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) preVisitExprConstPtr;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) visitExprConstPtr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) preVisitExprConstEnumeration;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) visitExprConstEnumeration;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) preVisitExprConstBitfield;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) visitExprConstBitfield;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) preVisitExprConstInt8;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) visitExprConstInt8;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) preVisitExprConstInt16;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) visitExprConstInt16;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) preVisitExprConstInt64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) visitExprConstInt64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) preVisitExprConstInt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) visitExprConstInt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) preVisitExprConstInt2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) visitExprConstInt2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) preVisitExprConstInt3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) visitExprConstInt3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) preVisitExprConstInt4;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) visitExprConstInt4;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) preVisitExprConstUInt8;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) visitExprConstUInt8;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) preVisitExprConstUInt16;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) visitExprConstUInt16;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) preVisitExprConstUInt64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) visitExprConstUInt64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) preVisitExprConstUInt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) visitExprConstUInt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) preVisitExprConstUInt2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) visitExprConstUInt2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) preVisitExprConstUInt3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) visitExprConstUInt3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) preVisitExprConstUInt4;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) visitExprConstUInt4;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) preVisitExprConstRange;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) visitExprConstRange;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) preVisitExprConstURange;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) visitExprConstURange;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstRange64> const )) preVisitExprConstRange64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstRange64> const )) visitExprConstRange64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstURange64> const )) preVisitExprConstURange64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstURange64> const )) visitExprConstURange64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) preVisitExprConstBool;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) visitExprConstBool;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) preVisitExprConstFloat;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) visitExprConstFloat;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) preVisitExprConstFloat2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) visitExprConstFloat2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) preVisitExprConstFloat3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) visitExprConstFloat3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) preVisitExprConstFloat4;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) visitExprConstFloat4;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) preVisitExprConstString;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) visitExprConstString;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) preVisitExprConstDouble;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) visitExprConstDouble;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) preVisitExprFakeContext;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) visitExprFakeContext;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) preVisitExprFakeLineInfo;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) visitExprFakeLineInfo;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) preVisitExprReader;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) visitExprReader;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) preVisitExprUnsafe;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) visitExprUnsafe;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) preVisitExprCallMacro;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) visitExprCallMacro;
+    TTable<Variable *,void> scope;
+    TTable<Variable *,ExprVar *> captured;
+};
+static_assert(sizeof(CaptureBlock)==2560,"structure size mismatch with DAS");
+static_assert(offsetof(CaptureBlock,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitProgram)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitProgram)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitProgramBody)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitModule)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitModule)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprTypeDecl)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprTypeDecl)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitTypeDecl)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitTypeDecl)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitAlias)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitAlias)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,canVisitEnumeration)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitEnumeration)==112,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitEnumerationValue)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitEnumerationValue)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitEnumeration)==136,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,canVisitStructure)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitStructure)==152,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitStructureField)==160,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,canVisitStructureFieldInit)==168,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitStructureField)==176,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitStructure)==184,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,canVisitFunction)==192,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,canVisitFunctionArgumentInit)==200,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitFunction)==208,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitFunction)==216,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitFunctionArgument)==224,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitFunctionArgument)==232,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitFunctionArgumentInit)==240,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitFunctionArgumentInit)==248,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitFunctionBody)==256,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitFunctionBody)==264,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExpression)==272,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExpression)==280,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprBlock)==288,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprBlock)==296,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprBlockArgument)==304,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprBlockArgument)==312,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprBlockArgumentInit)==320,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprBlockArgumentInit)==328,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprBlockExpression)==336,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprBlockExpression)==344,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprBlockFinal)==352,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprBlockFinal)==360,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprBlockFinalExpression)==368,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprBlockFinalExpression)==376,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprLet)==384,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprLet)==392,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprLetVariable)==400,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprLetVariable)==408,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprLetVariableInit)==416,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprLetVariableInit)==424,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,canVisitGlobalVariable)==432,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitGlobalLet)==440,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitGlobalLet)==448,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitGlobalLetVariable)==456,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitGlobalLetVariable)==464,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitGlobalLetVariableInit)==472,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitGlobalLetVariableInit)==480,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprStringBuilder)==488,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprStringBuilder)==496,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprStringBuilderElement)==504,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprStringBuilderElement)==512,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprNew)==520,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprNew)==528,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprNewArgument)==536,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprNewArgument)==544,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprNamedCall)==552,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprNamedCall)==560,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprNamedCallArgument)==568,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprNamedCallArgument)==576,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprLooksLikeCall)==584,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprLooksLikeCall)==592,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,canVisitExprLooksLikeCallArgument)==600,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprLooksLikeCallArgument)==608,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprLooksLikeCallArgument)==616,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,canVisitCall)==624,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprCall)==632,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprCall)==640,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprCallArgument)==648,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprCallArgument)==656,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprNullCoalescing)==664,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprNullCoalescing)==672,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprNullCoalescingDefault)==680,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprAt)==688,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprAt)==696,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprAtIndex)==704,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprSafeAt)==712,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprSafeAt)==720,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprSafeAtIndex)==728,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprIs)==736,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprIs)==744,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprIsType)==752,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprOp2)==760,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprOp2)==768,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprOp2Right)==776,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprOp3)==784,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprOp3)==792,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprOp3Left)==800,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprOp3Right)==808,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,isRightFirstExprCopy)==816,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprCopy)==824,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprCopy)==832,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprCopyRight)==840,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,isRightFirstExprMove)==848,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprMove)==856,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprMove)==864,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprMoveRight)==872,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,isRightFirstExprClone)==880,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprClone)==888,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprClone)==896,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprCloneRight)==904,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,canVisitWithAliasSubexpression)==912,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprAssume)==920,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprAssume)==928,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprWith)==936,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprWith)==944,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprWithBody)==952,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprWhile)==960,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprWhile)==968,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprWhileBody)==976,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprTryCatch)==984,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprTryCatch)==992,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprTryCatchCatch)==1000,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprIfThenElse)==1008,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprIfThenElse)==1016,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprIfThenElseIfBlock)==1024,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprIfThenElseElseBlock)==1032,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprFor)==1040,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprFor)==1048,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprForVariable)==1056,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprForVariable)==1064,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprForSource)==1072,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprForSource)==1080,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprForStack)==1088,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprForBody)==1096,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprMakeVariant)==1104,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprMakeVariant)==1112,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprMakeVariantField)==1120,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprMakeVariantField)==1128,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,canVisitExprMakeStructBody)==1136,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,canVisitExprMakeStructBlock)==1144,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprMakeStruct)==1152,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprMakeStruct)==1160,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitStructureAlias)==1168,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitStructureAlias)==1176,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprMakeStructIndex)==1184,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprMakeStructIndex)==1192,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprMakeStructField)==1200,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprMakeStructField)==1208,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitMakeStructureBlock)==1216,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitMakeStructureBlock)==1224,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprMakeArray)==1232,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprMakeArray)==1240,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprMakeArrayIndex)==1248,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprMakeArrayIndex)==1256,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprMakeTuple)==1264,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprMakeTuple)==1272,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprMakeTupleIndex)==1280,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprMakeTupleIndex)==1288,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprArrayComprehension)==1296,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprArrayComprehension)==1304,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprArrayComprehensionSubexpr)==1312,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprArrayComprehensionWhere)==1320,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,canVisitExprTypeInfo)==1328,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprTypeInfo)==1336,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprTypeInfo)==1344,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprPtr2Ref)==1352,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprPtr2Ref)==1360,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprLabel)==1368,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprLabel)==1376,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprGoto)==1384,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprGoto)==1392,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprRef2Value)==1400,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprRef2Value)==1408,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprRef2Ptr)==1416,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprRef2Ptr)==1424,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprAddr)==1432,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprAddr)==1440,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprAssert)==1448,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprAssert)==1456,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprStaticAssert)==1464,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprStaticAssert)==1472,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprQuote)==1480,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprQuote)==1488,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprDebug)==1496,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprDebug)==1504,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprInvoke)==1512,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprInvoke)==1520,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprErase)==1528,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprErase)==1536,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprSetInsert)==1544,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprSetInsert)==1552,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprFind)==1560,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprFind)==1568,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprKeyExists)==1576,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprKeyExists)==1584,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprAscend)==1592,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprAscend)==1600,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprCast)==1608,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprCast)==1616,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprDeleteSizeExpression)==1624,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprDelete)==1632,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprDelete)==1640,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprVar)==1648,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprVar)==1656,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprTag)==1664,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprTagValue)==1672,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprTag)==1680,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprField)==1688,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprField)==1696,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprSafeField)==1704,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprSafeField)==1712,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprSwizzle)==1720,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprSwizzle)==1728,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprIsVariant)==1736,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprIsVariant)==1744,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprAsVariant)==1752,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprAsVariant)==1760,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprSafeAsVariant)==1768,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprSafeAsVariant)==1776,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprOp1)==1784,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprOp1)==1792,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprReturn)==1800,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprReturn)==1808,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprYield)==1816,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprYield)==1824,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprBreak)==1832,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprBreak)==1840,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprContinue)==1848,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprContinue)==1856,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,canVisitMakeBlockBody)==1864,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprMakeBlock)==1872,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprMakeBlock)==1880,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprMakeGenerator)==1888,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprMakeGenerator)==1896,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprMemZero)==1904,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprMemZero)==1912,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConst)==1920,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConst)==1928,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstPtr)==1936,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstPtr)==1944,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstEnumeration)==1952,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstEnumeration)==1960,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstBitfield)==1968,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstBitfield)==1976,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstInt8)==1984,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstInt8)==1992,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstInt16)==2000,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstInt16)==2008,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstInt64)==2016,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstInt64)==2024,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstInt)==2032,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstInt)==2040,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstInt2)==2048,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstInt2)==2056,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstInt3)==2064,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstInt3)==2072,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstInt4)==2080,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstInt4)==2088,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstUInt8)==2096,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstUInt8)==2104,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstUInt16)==2112,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstUInt16)==2120,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstUInt64)==2128,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstUInt64)==2136,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstUInt)==2144,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstUInt)==2152,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstUInt2)==2160,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstUInt2)==2168,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstUInt3)==2176,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstUInt3)==2184,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstUInt4)==2192,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstUInt4)==2200,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstRange)==2208,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstRange)==2216,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstURange)==2224,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstURange)==2232,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstRange64)==2240,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstRange64)==2248,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstURange64)==2256,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstURange64)==2264,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstBool)==2272,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstBool)==2280,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstFloat)==2288,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstFloat)==2296,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstFloat2)==2304,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstFloat2)==2312,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstFloat3)==2320,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstFloat3)==2328,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstFloat4)==2336,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstFloat4)==2344,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstString)==2352,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstString)==2360,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprConstDouble)==2368,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprConstDouble)==2376,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprFakeContext)==2384,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprFakeContext)==2392,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprFakeLineInfo)==2400,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprFakeLineInfo)==2408,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprReader)==2416,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprReader)==2424,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprUnsafe)==2432,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprUnsafe)==2440,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,preVisitExprCallMacro)==2448,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,visitExprCallMacro)==2456,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,scope)==2464,"structure field offset mismatch with DAS");
+static_assert(offsetof(CaptureBlock,captured)==2512,"structure field offset mismatch with DAS");
+}
+// unused structure CapturedVariable
+namespace macro_boost {
+
+struct ColletFinally {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstVisitor)) __finalize;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgram;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitProgram;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const ,Module * const )) preVisitProgramBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,Module * const )) preVisitModule;
+    Func DAS_COMMENT((void,ast::AstVisitor,Module * const )) visitModule;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTypeDecl> const )) preVisitExprTypeDecl;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTypeDecl> const )) visitExprTypeDecl;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) preVisitTypeDecl;
+    Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) visitTypeDecl;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) preVisitAlias;
+    Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) visitAlias;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Enumeration * const )) canVisitEnumeration;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) preVisitEnumeration;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) preVisitEnumerationValue;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) visitEnumerationValue;
+    Func DAS_COMMENT((smart_ptr_raw<Enumeration>,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) visitEnumeration;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Structure * const )) canVisitStructure;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const )) preVisitStructure;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) preVisitStructureField;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<Structure> const )) canVisitStructureFieldInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) visitStructureField;
+    Func DAS_COMMENT((smart_ptr_raw<Structure>,ast::AstVisitor,smart_ptr_raw<Structure> const )) visitStructure;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Function * const )) canVisitFunction;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Function * const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) canVisitFunctionArgumentInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunction;
+    Func DAS_COMMENT((smart_ptr_raw<Function>,ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunction;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) preVisitFunctionArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) visitFunctionArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitFunctionArgumentInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitFunctionArgumentInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Expression> const )) preVisitFunctionBody;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Expression> const )) visitFunctionBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Expression> const )) preVisitExpression;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Expression> const )) visitExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlock;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprBlockArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) visitExprBlockArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockArgumentInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprBlockArgumentInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockExpression;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlockFinal;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlockFinal;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockFinalExpression;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockFinalExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) preVisitExprLet;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) visitExprLet;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprLetVariable;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) visitExprLetVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprLetVariableInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprLetVariableInit;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Variable * const )) canVisitGlobalVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitGlobalLet;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitGlobalLet;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) preVisitGlobalLetVariable;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) visitGlobalLetVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitGlobalLetVariableInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitGlobalLetVariableInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) preVisitExprStringBuilder;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) visitExprStringBuilder;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprStringBuilderElement;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) visitExprStringBuilderElement;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) preVisitExprNew;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) visitExprNew;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprNewArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) visitExprNewArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) preVisitExprNamedCall;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) visitExprNamedCall;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprNamedCallArgument;
+    Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprNamedCallArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) preVisitExprLooksLikeCall;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) visitExprLooksLikeCall;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) canVisitExprLooksLikeCallArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprLooksLikeCallArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprLooksLikeCallArgument;
+    Func DAS_COMMENT((bool,ast::AstVisitor,ExprCall * const )) canVisitCall;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) preVisitExprCall;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) visitExprCall;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprCallArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprCallArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) preVisitExprNullCoalescing;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) visitExprNullCoalescing;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const ,smart_ptr_raw<Expression> const )) preVisitExprNullCoalescingDefault;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) preVisitExprAt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) visitExprAt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprAtIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) preVisitExprSafeAt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) visitExprSafeAt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const ,smart_ptr_raw<Expression> const )) preVisitExprSafeAtIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) preVisitExprIs;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) visitExprIs;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIs> const ,smart_ptr_raw<TypeDecl> const )) preVisitExprIsType;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) preVisitExprOp2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) visitExprOp2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const ,smart_ptr_raw<Expression> const )) preVisitExprOp2Right;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) preVisitExprOp3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) visitExprOp3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Left;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Right;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) isRightFirstExprCopy;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) preVisitExprCopy;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) visitExprCopy;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const ,smart_ptr_raw<Expression> const )) preVisitExprCopyRight;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) isRightFirstExprMove;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) preVisitExprMove;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) visitExprMove;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const ,smart_ptr_raw<Expression> const )) preVisitExprMoveRight;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) isRightFirstExprClone;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) preVisitExprClone;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) visitExprClone;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const ,smart_ptr_raw<Expression> const )) preVisitExprCloneRight;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprAssume> const )) canVisitWithAliasSubexpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAssume> const )) preVisitExprAssume;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAssume> const )) visitExprAssume;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) preVisitExprWith;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) visitExprWith;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const ,smart_ptr_raw<Expression> const )) preVisitExprWithBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) preVisitExprWhile;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) visitExprWhile;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const ,smart_ptr_raw<Expression> const )) preVisitExprWhileBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) preVisitExprTryCatch;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) visitExprTryCatch;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const ,smart_ptr_raw<Expression> const )) preVisitExprTryCatchCatch;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) preVisitExprIfThenElse;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) visitExprIfThenElse;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseIfBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseElseBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprFor;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) visitExprFor;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprForVariable;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) visitExprForVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprForSource;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) visitExprForSource;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForStack;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) preVisitExprMakeVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) visitExprMakeVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeVariantField;
+    Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeVariantField;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) canVisitExprMakeStructBody;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,smart_ptr_raw<Expression> const )) canVisitExprMakeStructBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) preVisitExprMakeStruct;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) visitExprMakeStruct;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,das::string const ,smart_ptr_raw<TypeDecl> const )) preVisitStructureAlias;
+    Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<Structure> const ,das::string const ,smart_ptr_raw<TypeDecl> const )) visitStructureAlias;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) preVisitExprMakeStructIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) visitExprMakeStructIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeStructField;
+    Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeStructField;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,smart_ptr_raw<Expression> const )) preVisitMakeStructureBlock;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,smart_ptr_raw<Expression> const )) visitMakeStructureBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) preVisitExprMakeArray;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) visitExprMakeArray;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeArrayIndex;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeArrayIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) preVisitExprMakeTuple;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) visitExprMakeTuple;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeTupleIndex;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeTupleIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) preVisitExprArrayComprehension;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) visitExprArrayComprehension;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionSubexpr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionWhere;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const ,smart_ptr_raw<Expression> const )) canVisitExprTypeInfo;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) preVisitExprTypeInfo;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) visitExprTypeInfo;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) preVisitExprPtr2Ref;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) visitExprPtr2Ref;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) preVisitExprLabel;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) visitExprLabel;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) preVisitExprGoto;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) visitExprGoto;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) preVisitExprRef2Value;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) visitExprRef2Value;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) preVisitExprRef2Ptr;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) visitExprRef2Ptr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) preVisitExprAddr;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) visitExprAddr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) preVisitExprAssert;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) visitExprAssert;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) preVisitExprStaticAssert;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) visitExprStaticAssert;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) preVisitExprQuote;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) visitExprQuote;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) preVisitExprDebug;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) visitExprDebug;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) preVisitExprInvoke;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) visitExprInvoke;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) preVisitExprErase;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) visitExprErase;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSetInsert> const )) preVisitExprSetInsert;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSetInsert> const )) visitExprSetInsert;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) preVisitExprFind;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) visitExprFind;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) preVisitExprKeyExists;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) visitExprKeyExists;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) preVisitExprAscend;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) visitExprAscend;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) preVisitExprCast;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) visitExprCast;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDelete> const ,smart_ptr_raw<Expression> const )) preVisitExprDeleteSizeExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) preVisitExprDelete;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) visitExprDelete;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) preVisitExprVar;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) visitExprVar;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTag> const )) preVisitExprTag;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTag> const ,smart_ptr_raw<Expression> const )) preVisitExprTagValue;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTag> const )) visitExprTag;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprField> const )) preVisitExprField;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprField> const )) visitExprField;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) preVisitExprSafeField;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) visitExprSafeField;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) preVisitExprSwizzle;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) visitExprSwizzle;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) preVisitExprIsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) preVisitExprAsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) preVisitExprSafeAsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) preVisitExprOp1;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) visitExprOp1;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) preVisitExprReturn;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) visitExprReturn;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) preVisitExprYield;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) visitExprYield;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) preVisitExprBreak;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) visitExprBreak;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) preVisitExprContinue;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) visitExprContinue;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) canVisitMakeBlockBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) preVisitExprMakeBlock;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) visitExprMakeBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) preVisitExprMakeGenerator;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) visitExprMakeGenerator;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) preVisitExprMemZero;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) visitExprMemZero;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) preVisitExprConst;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) visitExprConst;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) preVisitExprConstPtr;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) visitExprConstPtr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) preVisitExprConstEnumeration;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) visitExprConstEnumeration;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) preVisitExprConstBitfield;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) visitExprConstBitfield;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) preVisitExprConstInt8;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) visitExprConstInt8;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) preVisitExprConstInt16;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) visitExprConstInt16;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) preVisitExprConstInt64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) visitExprConstInt64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) preVisitExprConstInt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) visitExprConstInt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) preVisitExprConstInt2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) visitExprConstInt2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) preVisitExprConstInt3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) visitExprConstInt3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) preVisitExprConstInt4;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) visitExprConstInt4;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) preVisitExprConstUInt8;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) visitExprConstUInt8;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) preVisitExprConstUInt16;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) visitExprConstUInt16;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) preVisitExprConstUInt64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) visitExprConstUInt64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) preVisitExprConstUInt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) visitExprConstUInt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) preVisitExprConstUInt2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) visitExprConstUInt2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) preVisitExprConstUInt3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) visitExprConstUInt3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) preVisitExprConstUInt4;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) visitExprConstUInt4;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) preVisitExprConstRange;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) visitExprConstRange;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) preVisitExprConstURange;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) visitExprConstURange;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstRange64> const )) preVisitExprConstRange64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstRange64> const )) visitExprConstRange64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstURange64> const )) preVisitExprConstURange64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstURange64> const )) visitExprConstURange64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) preVisitExprConstBool;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) visitExprConstBool;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) preVisitExprConstFloat;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) visitExprConstFloat;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) preVisitExprConstFloat2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) visitExprConstFloat2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) preVisitExprConstFloat3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) visitExprConstFloat3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) preVisitExprConstFloat4;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) visitExprConstFloat4;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) preVisitExprConstString;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) visitExprConstString;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) preVisitExprConstDouble;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) visitExprConstDouble;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) preVisitExprFakeContext;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) visitExprFakeContext;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) preVisitExprFakeLineInfo;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) visitExprFakeLineInfo;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) preVisitExprReader;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) visitExprReader;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) preVisitExprUnsafe;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) visitExprUnsafe;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) preVisitExprCallMacro;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) visitExprCallMacro;
+    TTable<ExprBlock *,void> blocks;
+    bool alwaysFor;
+};
+static_assert(sizeof(ColletFinally)==2520,"structure size mismatch with DAS");
+static_assert(offsetof(ColletFinally,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitProgram)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitProgram)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitProgramBody)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitModule)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitModule)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprTypeDecl)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprTypeDecl)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitTypeDecl)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitTypeDecl)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitAlias)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitAlias)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,canVisitEnumeration)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitEnumeration)==112,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitEnumerationValue)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitEnumerationValue)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitEnumeration)==136,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,canVisitStructure)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitStructure)==152,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitStructureField)==160,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,canVisitStructureFieldInit)==168,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitStructureField)==176,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitStructure)==184,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,canVisitFunction)==192,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,canVisitFunctionArgumentInit)==200,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitFunction)==208,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitFunction)==216,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitFunctionArgument)==224,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitFunctionArgument)==232,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitFunctionArgumentInit)==240,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitFunctionArgumentInit)==248,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitFunctionBody)==256,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitFunctionBody)==264,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExpression)==272,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExpression)==280,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprBlock)==288,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprBlock)==296,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprBlockArgument)==304,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprBlockArgument)==312,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprBlockArgumentInit)==320,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprBlockArgumentInit)==328,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprBlockExpression)==336,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprBlockExpression)==344,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprBlockFinal)==352,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprBlockFinal)==360,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprBlockFinalExpression)==368,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprBlockFinalExpression)==376,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprLet)==384,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprLet)==392,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprLetVariable)==400,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprLetVariable)==408,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprLetVariableInit)==416,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprLetVariableInit)==424,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,canVisitGlobalVariable)==432,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitGlobalLet)==440,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitGlobalLet)==448,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitGlobalLetVariable)==456,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitGlobalLetVariable)==464,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitGlobalLetVariableInit)==472,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitGlobalLetVariableInit)==480,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprStringBuilder)==488,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprStringBuilder)==496,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprStringBuilderElement)==504,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprStringBuilderElement)==512,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprNew)==520,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprNew)==528,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprNewArgument)==536,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprNewArgument)==544,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprNamedCall)==552,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprNamedCall)==560,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprNamedCallArgument)==568,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprNamedCallArgument)==576,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprLooksLikeCall)==584,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprLooksLikeCall)==592,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,canVisitExprLooksLikeCallArgument)==600,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprLooksLikeCallArgument)==608,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprLooksLikeCallArgument)==616,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,canVisitCall)==624,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprCall)==632,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprCall)==640,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprCallArgument)==648,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprCallArgument)==656,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprNullCoalescing)==664,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprNullCoalescing)==672,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprNullCoalescingDefault)==680,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprAt)==688,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprAt)==696,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprAtIndex)==704,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprSafeAt)==712,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprSafeAt)==720,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprSafeAtIndex)==728,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprIs)==736,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprIs)==744,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprIsType)==752,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprOp2)==760,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprOp2)==768,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprOp2Right)==776,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprOp3)==784,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprOp3)==792,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprOp3Left)==800,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprOp3Right)==808,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,isRightFirstExprCopy)==816,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprCopy)==824,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprCopy)==832,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprCopyRight)==840,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,isRightFirstExprMove)==848,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprMove)==856,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprMove)==864,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprMoveRight)==872,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,isRightFirstExprClone)==880,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprClone)==888,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprClone)==896,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprCloneRight)==904,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,canVisitWithAliasSubexpression)==912,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprAssume)==920,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprAssume)==928,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprWith)==936,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprWith)==944,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprWithBody)==952,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprWhile)==960,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprWhile)==968,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprWhileBody)==976,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprTryCatch)==984,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprTryCatch)==992,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprTryCatchCatch)==1000,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprIfThenElse)==1008,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprIfThenElse)==1016,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprIfThenElseIfBlock)==1024,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprIfThenElseElseBlock)==1032,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprFor)==1040,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprFor)==1048,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprForVariable)==1056,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprForVariable)==1064,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprForSource)==1072,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprForSource)==1080,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprForStack)==1088,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprForBody)==1096,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprMakeVariant)==1104,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprMakeVariant)==1112,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprMakeVariantField)==1120,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprMakeVariantField)==1128,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,canVisitExprMakeStructBody)==1136,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,canVisitExprMakeStructBlock)==1144,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprMakeStruct)==1152,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprMakeStruct)==1160,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitStructureAlias)==1168,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitStructureAlias)==1176,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprMakeStructIndex)==1184,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprMakeStructIndex)==1192,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprMakeStructField)==1200,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprMakeStructField)==1208,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitMakeStructureBlock)==1216,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitMakeStructureBlock)==1224,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprMakeArray)==1232,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprMakeArray)==1240,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprMakeArrayIndex)==1248,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprMakeArrayIndex)==1256,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprMakeTuple)==1264,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprMakeTuple)==1272,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprMakeTupleIndex)==1280,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprMakeTupleIndex)==1288,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprArrayComprehension)==1296,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprArrayComprehension)==1304,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprArrayComprehensionSubexpr)==1312,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprArrayComprehensionWhere)==1320,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,canVisitExprTypeInfo)==1328,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprTypeInfo)==1336,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprTypeInfo)==1344,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprPtr2Ref)==1352,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprPtr2Ref)==1360,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprLabel)==1368,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprLabel)==1376,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprGoto)==1384,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprGoto)==1392,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprRef2Value)==1400,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprRef2Value)==1408,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprRef2Ptr)==1416,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprRef2Ptr)==1424,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprAddr)==1432,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprAddr)==1440,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprAssert)==1448,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprAssert)==1456,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprStaticAssert)==1464,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprStaticAssert)==1472,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprQuote)==1480,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprQuote)==1488,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprDebug)==1496,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprDebug)==1504,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprInvoke)==1512,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprInvoke)==1520,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprErase)==1528,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprErase)==1536,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprSetInsert)==1544,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprSetInsert)==1552,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprFind)==1560,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprFind)==1568,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprKeyExists)==1576,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprKeyExists)==1584,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprAscend)==1592,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprAscend)==1600,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprCast)==1608,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprCast)==1616,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprDeleteSizeExpression)==1624,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprDelete)==1632,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprDelete)==1640,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprVar)==1648,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprVar)==1656,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprTag)==1664,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprTagValue)==1672,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprTag)==1680,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprField)==1688,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprField)==1696,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprSafeField)==1704,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprSafeField)==1712,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprSwizzle)==1720,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprSwizzle)==1728,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprIsVariant)==1736,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprIsVariant)==1744,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprAsVariant)==1752,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprAsVariant)==1760,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprSafeAsVariant)==1768,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprSafeAsVariant)==1776,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprOp1)==1784,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprOp1)==1792,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprReturn)==1800,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprReturn)==1808,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprYield)==1816,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprYield)==1824,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprBreak)==1832,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprBreak)==1840,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprContinue)==1848,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprContinue)==1856,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,canVisitMakeBlockBody)==1864,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprMakeBlock)==1872,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprMakeBlock)==1880,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprMakeGenerator)==1888,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprMakeGenerator)==1896,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprMemZero)==1904,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprMemZero)==1912,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConst)==1920,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConst)==1928,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstPtr)==1936,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstPtr)==1944,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstEnumeration)==1952,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstEnumeration)==1960,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstBitfield)==1968,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstBitfield)==1976,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstInt8)==1984,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstInt8)==1992,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstInt16)==2000,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstInt16)==2008,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstInt64)==2016,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstInt64)==2024,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstInt)==2032,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstInt)==2040,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstInt2)==2048,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstInt2)==2056,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstInt3)==2064,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstInt3)==2072,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstInt4)==2080,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstInt4)==2088,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstUInt8)==2096,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstUInt8)==2104,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstUInt16)==2112,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstUInt16)==2120,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstUInt64)==2128,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstUInt64)==2136,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstUInt)==2144,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstUInt)==2152,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstUInt2)==2160,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstUInt2)==2168,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstUInt3)==2176,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstUInt3)==2184,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstUInt4)==2192,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstUInt4)==2200,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstRange)==2208,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstRange)==2216,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstURange)==2224,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstURange)==2232,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstRange64)==2240,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstRange64)==2248,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstURange64)==2256,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstURange64)==2264,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstBool)==2272,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstBool)==2280,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstFloat)==2288,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstFloat)==2296,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstFloat2)==2304,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstFloat2)==2312,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstFloat3)==2320,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstFloat3)==2328,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstFloat4)==2336,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstFloat4)==2344,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstString)==2352,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstString)==2360,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprConstDouble)==2368,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprConstDouble)==2376,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprFakeContext)==2384,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprFakeContext)==2392,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprFakeLineInfo)==2400,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprFakeLineInfo)==2408,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprReader)==2416,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprReader)==2424,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprUnsafe)==2432,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprUnsafe)==2440,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,preVisitExprCallMacro)==2448,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,visitExprCallMacro)==2456,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,blocks)==2464,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletFinally,alwaysFor)==2512,"structure field offset mismatch with DAS");
+}
+namespace macro_boost {
+
+struct ColletLabels {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstVisitor)) __finalize;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgram;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitProgram;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const ,Module * const )) preVisitProgramBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,Module * const )) preVisitModule;
+    Func DAS_COMMENT((void,ast::AstVisitor,Module * const )) visitModule;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTypeDecl> const )) preVisitExprTypeDecl;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTypeDecl> const )) visitExprTypeDecl;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) preVisitTypeDecl;
+    Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) visitTypeDecl;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) preVisitAlias;
+    Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) visitAlias;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Enumeration * const )) canVisitEnumeration;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) preVisitEnumeration;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) preVisitEnumerationValue;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) visitEnumerationValue;
+    Func DAS_COMMENT((smart_ptr_raw<Enumeration>,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) visitEnumeration;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Structure * const )) canVisitStructure;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const )) preVisitStructure;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) preVisitStructureField;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<Structure> const )) canVisitStructureFieldInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) visitStructureField;
+    Func DAS_COMMENT((smart_ptr_raw<Structure>,ast::AstVisitor,smart_ptr_raw<Structure> const )) visitStructure;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Function * const )) canVisitFunction;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Function * const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) canVisitFunctionArgumentInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunction;
+    Func DAS_COMMENT((smart_ptr_raw<Function>,ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunction;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) preVisitFunctionArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) visitFunctionArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitFunctionArgumentInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitFunctionArgumentInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Expression> const )) preVisitFunctionBody;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Expression> const )) visitFunctionBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Expression> const )) preVisitExpression;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Expression> const )) visitExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlock;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprBlockArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) visitExprBlockArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockArgumentInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprBlockArgumentInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockExpression;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlockFinal;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlockFinal;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockFinalExpression;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockFinalExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) preVisitExprLet;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) visitExprLet;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprLetVariable;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) visitExprLetVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprLetVariableInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprLetVariableInit;
+    Func DAS_COMMENT((bool,ast::AstVisitor,Variable * const )) canVisitGlobalVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitGlobalLet;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitGlobalLet;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) preVisitGlobalLetVariable;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) visitGlobalLetVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitGlobalLetVariableInit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitGlobalLetVariableInit;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) preVisitExprStringBuilder;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) visitExprStringBuilder;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprStringBuilderElement;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) visitExprStringBuilderElement;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) preVisitExprNew;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) visitExprNew;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprNewArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) visitExprNewArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) preVisitExprNamedCall;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) visitExprNamedCall;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprNamedCallArgument;
+    Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprNamedCallArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) preVisitExprLooksLikeCall;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) visitExprLooksLikeCall;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) canVisitExprLooksLikeCallArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprLooksLikeCallArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprLooksLikeCallArgument;
+    Func DAS_COMMENT((bool,ast::AstVisitor,ExprCall * const )) canVisitCall;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) preVisitExprCall;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) visitExprCall;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprCallArgument;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprCallArgument;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) preVisitExprNullCoalescing;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) visitExprNullCoalescing;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const ,smart_ptr_raw<Expression> const )) preVisitExprNullCoalescingDefault;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) preVisitExprAt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) visitExprAt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprAtIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) preVisitExprSafeAt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) visitExprSafeAt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const ,smart_ptr_raw<Expression> const )) preVisitExprSafeAtIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) preVisitExprIs;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) visitExprIs;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIs> const ,smart_ptr_raw<TypeDecl> const )) preVisitExprIsType;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) preVisitExprOp2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) visitExprOp2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const ,smart_ptr_raw<Expression> const )) preVisitExprOp2Right;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) preVisitExprOp3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) visitExprOp3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Left;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Right;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) isRightFirstExprCopy;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) preVisitExprCopy;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) visitExprCopy;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const ,smart_ptr_raw<Expression> const )) preVisitExprCopyRight;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) isRightFirstExprMove;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) preVisitExprMove;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) visitExprMove;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const ,smart_ptr_raw<Expression> const )) preVisitExprMoveRight;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) isRightFirstExprClone;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) preVisitExprClone;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) visitExprClone;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const ,smart_ptr_raw<Expression> const )) preVisitExprCloneRight;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprAssume> const )) canVisitWithAliasSubexpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAssume> const )) preVisitExprAssume;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAssume> const )) visitExprAssume;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) preVisitExprWith;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) visitExprWith;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const ,smart_ptr_raw<Expression> const )) preVisitExprWithBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) preVisitExprWhile;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) visitExprWhile;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const ,smart_ptr_raw<Expression> const )) preVisitExprWhileBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) preVisitExprTryCatch;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) visitExprTryCatch;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const ,smart_ptr_raw<Expression> const )) preVisitExprTryCatchCatch;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) preVisitExprIfThenElse;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) visitExprIfThenElse;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseIfBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseElseBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprFor;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) visitExprFor;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprForVariable;
+    Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) visitExprForVariable;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprForSource;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) visitExprForSource;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForStack;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) preVisitExprMakeVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) visitExprMakeVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeVariantField;
+    Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeVariantField;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) canVisitExprMakeStructBody;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,smart_ptr_raw<Expression> const )) canVisitExprMakeStructBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) preVisitExprMakeStruct;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) visitExprMakeStruct;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,das::string const ,smart_ptr_raw<TypeDecl> const )) preVisitStructureAlias;
+    Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<Structure> const ,das::string const ,smart_ptr_raw<TypeDecl> const )) visitStructureAlias;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) preVisitExprMakeStructIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) visitExprMakeStructIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeStructField;
+    Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeStructField;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,smart_ptr_raw<Expression> const )) preVisitMakeStructureBlock;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,smart_ptr_raw<Expression> const )) visitMakeStructureBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) preVisitExprMakeArray;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) visitExprMakeArray;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeArrayIndex;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeArrayIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) preVisitExprMakeTuple;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) visitExprMakeTuple;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeTupleIndex;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeTupleIndex;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) preVisitExprArrayComprehension;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) visitExprArrayComprehension;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionSubexpr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionWhere;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const ,smart_ptr_raw<Expression> const )) canVisitExprTypeInfo;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) preVisitExprTypeInfo;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) visitExprTypeInfo;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) preVisitExprPtr2Ref;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) visitExprPtr2Ref;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) preVisitExprLabel;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) visitExprLabel;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) preVisitExprGoto;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) visitExprGoto;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) preVisitExprRef2Value;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) visitExprRef2Value;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) preVisitExprRef2Ptr;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) visitExprRef2Ptr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) preVisitExprAddr;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) visitExprAddr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) preVisitExprAssert;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) visitExprAssert;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) preVisitExprStaticAssert;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) visitExprStaticAssert;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) preVisitExprQuote;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) visitExprQuote;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) preVisitExprDebug;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) visitExprDebug;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) preVisitExprInvoke;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) visitExprInvoke;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) preVisitExprErase;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) visitExprErase;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSetInsert> const )) preVisitExprSetInsert;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSetInsert> const )) visitExprSetInsert;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) preVisitExprFind;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) visitExprFind;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) preVisitExprKeyExists;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) visitExprKeyExists;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) preVisitExprAscend;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) visitExprAscend;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) preVisitExprCast;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) visitExprCast;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDelete> const ,smart_ptr_raw<Expression> const )) preVisitExprDeleteSizeExpression;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) preVisitExprDelete;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) visitExprDelete;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) preVisitExprVar;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) visitExprVar;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTag> const )) preVisitExprTag;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTag> const ,smart_ptr_raw<Expression> const )) preVisitExprTagValue;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTag> const )) visitExprTag;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprField> const )) preVisitExprField;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprField> const )) visitExprField;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) preVisitExprSafeField;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) visitExprSafeField;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) preVisitExprSwizzle;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) visitExprSwizzle;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) preVisitExprIsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) preVisitExprAsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) preVisitExprSafeAsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) preVisitExprOp1;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) visitExprOp1;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) preVisitExprReturn;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) visitExprReturn;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) preVisitExprYield;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) visitExprYield;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) preVisitExprBreak;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) visitExprBreak;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) preVisitExprContinue;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) visitExprContinue;
+    Func DAS_COMMENT((bool,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) canVisitMakeBlockBody;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) preVisitExprMakeBlock;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) visitExprMakeBlock;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) preVisitExprMakeGenerator;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) visitExprMakeGenerator;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) preVisitExprMemZero;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) visitExprMemZero;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) preVisitExprConst;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) visitExprConst;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) preVisitExprConstPtr;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) visitExprConstPtr;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) preVisitExprConstEnumeration;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) visitExprConstEnumeration;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) preVisitExprConstBitfield;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) visitExprConstBitfield;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) preVisitExprConstInt8;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) visitExprConstInt8;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) preVisitExprConstInt16;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) visitExprConstInt16;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) preVisitExprConstInt64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) visitExprConstInt64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) preVisitExprConstInt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) visitExprConstInt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) preVisitExprConstInt2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) visitExprConstInt2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) preVisitExprConstInt3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) visitExprConstInt3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) preVisitExprConstInt4;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) visitExprConstInt4;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) preVisitExprConstUInt8;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) visitExprConstUInt8;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) preVisitExprConstUInt16;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) visitExprConstUInt16;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) preVisitExprConstUInt64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) visitExprConstUInt64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) preVisitExprConstUInt;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) visitExprConstUInt;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) preVisitExprConstUInt2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) visitExprConstUInt2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) preVisitExprConstUInt3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) visitExprConstUInt3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) preVisitExprConstUInt4;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) visitExprConstUInt4;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) preVisitExprConstRange;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) visitExprConstRange;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) preVisitExprConstURange;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) visitExprConstURange;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstRange64> const )) preVisitExprConstRange64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstRange64> const )) visitExprConstRange64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstURange64> const )) preVisitExprConstURange64;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstURange64> const )) visitExprConstURange64;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) preVisitExprConstBool;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) visitExprConstBool;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) preVisitExprConstFloat;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) visitExprConstFloat;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) preVisitExprConstFloat2;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) visitExprConstFloat2;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) preVisitExprConstFloat3;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) visitExprConstFloat3;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) preVisitExprConstFloat4;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) visitExprConstFloat4;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) preVisitExprConstString;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) visitExprConstString;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) preVisitExprConstDouble;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) visitExprConstDouble;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) preVisitExprFakeContext;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) visitExprFakeContext;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) preVisitExprFakeLineInfo;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) visitExprFakeLineInfo;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) preVisitExprReader;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) visitExprReader;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) preVisitExprUnsafe;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) visitExprUnsafe;
+    Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) preVisitExprCallMacro;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) visitExprCallMacro;
+    TTable<int32_t,void> labels;
+};
+static_assert(sizeof(ColletLabels)==2512,"structure size mismatch with DAS");
+static_assert(offsetof(ColletLabels,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitProgram)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitProgram)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitProgramBody)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitModule)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitModule)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprTypeDecl)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprTypeDecl)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitTypeDecl)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitTypeDecl)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitAlias)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitAlias)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,canVisitEnumeration)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitEnumeration)==112,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitEnumerationValue)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitEnumerationValue)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitEnumeration)==136,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,canVisitStructure)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitStructure)==152,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitStructureField)==160,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,canVisitStructureFieldInit)==168,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitStructureField)==176,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitStructure)==184,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,canVisitFunction)==192,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,canVisitFunctionArgumentInit)==200,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitFunction)==208,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitFunction)==216,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitFunctionArgument)==224,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitFunctionArgument)==232,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitFunctionArgumentInit)==240,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitFunctionArgumentInit)==248,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitFunctionBody)==256,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitFunctionBody)==264,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExpression)==272,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExpression)==280,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprBlock)==288,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprBlock)==296,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprBlockArgument)==304,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprBlockArgument)==312,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprBlockArgumentInit)==320,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprBlockArgumentInit)==328,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprBlockExpression)==336,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprBlockExpression)==344,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprBlockFinal)==352,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprBlockFinal)==360,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprBlockFinalExpression)==368,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprBlockFinalExpression)==376,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprLet)==384,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprLet)==392,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprLetVariable)==400,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprLetVariable)==408,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprLetVariableInit)==416,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprLetVariableInit)==424,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,canVisitGlobalVariable)==432,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitGlobalLet)==440,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitGlobalLet)==448,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitGlobalLetVariable)==456,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitGlobalLetVariable)==464,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitGlobalLetVariableInit)==472,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitGlobalLetVariableInit)==480,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprStringBuilder)==488,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprStringBuilder)==496,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprStringBuilderElement)==504,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprStringBuilderElement)==512,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprNew)==520,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprNew)==528,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprNewArgument)==536,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprNewArgument)==544,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprNamedCall)==552,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprNamedCall)==560,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprNamedCallArgument)==568,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprNamedCallArgument)==576,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprLooksLikeCall)==584,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprLooksLikeCall)==592,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,canVisitExprLooksLikeCallArgument)==600,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprLooksLikeCallArgument)==608,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprLooksLikeCallArgument)==616,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,canVisitCall)==624,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprCall)==632,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprCall)==640,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprCallArgument)==648,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprCallArgument)==656,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprNullCoalescing)==664,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprNullCoalescing)==672,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprNullCoalescingDefault)==680,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprAt)==688,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprAt)==696,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprAtIndex)==704,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprSafeAt)==712,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprSafeAt)==720,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprSafeAtIndex)==728,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprIs)==736,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprIs)==744,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprIsType)==752,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprOp2)==760,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprOp2)==768,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprOp2Right)==776,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprOp3)==784,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprOp3)==792,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprOp3Left)==800,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprOp3Right)==808,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,isRightFirstExprCopy)==816,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprCopy)==824,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprCopy)==832,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprCopyRight)==840,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,isRightFirstExprMove)==848,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprMove)==856,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprMove)==864,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprMoveRight)==872,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,isRightFirstExprClone)==880,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprClone)==888,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprClone)==896,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprCloneRight)==904,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,canVisitWithAliasSubexpression)==912,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprAssume)==920,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprAssume)==928,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprWith)==936,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprWith)==944,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprWithBody)==952,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprWhile)==960,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprWhile)==968,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprWhileBody)==976,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprTryCatch)==984,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprTryCatch)==992,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprTryCatchCatch)==1000,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprIfThenElse)==1008,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprIfThenElse)==1016,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprIfThenElseIfBlock)==1024,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprIfThenElseElseBlock)==1032,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprFor)==1040,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprFor)==1048,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprForVariable)==1056,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprForVariable)==1064,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprForSource)==1072,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprForSource)==1080,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprForStack)==1088,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprForBody)==1096,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprMakeVariant)==1104,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprMakeVariant)==1112,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprMakeVariantField)==1120,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprMakeVariantField)==1128,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,canVisitExprMakeStructBody)==1136,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,canVisitExprMakeStructBlock)==1144,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprMakeStruct)==1152,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprMakeStruct)==1160,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitStructureAlias)==1168,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitStructureAlias)==1176,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprMakeStructIndex)==1184,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprMakeStructIndex)==1192,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprMakeStructField)==1200,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprMakeStructField)==1208,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitMakeStructureBlock)==1216,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitMakeStructureBlock)==1224,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprMakeArray)==1232,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprMakeArray)==1240,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprMakeArrayIndex)==1248,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprMakeArrayIndex)==1256,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprMakeTuple)==1264,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprMakeTuple)==1272,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprMakeTupleIndex)==1280,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprMakeTupleIndex)==1288,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprArrayComprehension)==1296,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprArrayComprehension)==1304,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprArrayComprehensionSubexpr)==1312,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprArrayComprehensionWhere)==1320,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,canVisitExprTypeInfo)==1328,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprTypeInfo)==1336,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprTypeInfo)==1344,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprPtr2Ref)==1352,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprPtr2Ref)==1360,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprLabel)==1368,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprLabel)==1376,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprGoto)==1384,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprGoto)==1392,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprRef2Value)==1400,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprRef2Value)==1408,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprRef2Ptr)==1416,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprRef2Ptr)==1424,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprAddr)==1432,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprAddr)==1440,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprAssert)==1448,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprAssert)==1456,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprStaticAssert)==1464,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprStaticAssert)==1472,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprQuote)==1480,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprQuote)==1488,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprDebug)==1496,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprDebug)==1504,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprInvoke)==1512,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprInvoke)==1520,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprErase)==1528,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprErase)==1536,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprSetInsert)==1544,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprSetInsert)==1552,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprFind)==1560,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprFind)==1568,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprKeyExists)==1576,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprKeyExists)==1584,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprAscend)==1592,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprAscend)==1600,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprCast)==1608,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprCast)==1616,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprDeleteSizeExpression)==1624,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprDelete)==1632,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprDelete)==1640,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprVar)==1648,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprVar)==1656,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprTag)==1664,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprTagValue)==1672,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprTag)==1680,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprField)==1688,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprField)==1696,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprSafeField)==1704,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprSafeField)==1712,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprSwizzle)==1720,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprSwizzle)==1728,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprIsVariant)==1736,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprIsVariant)==1744,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprAsVariant)==1752,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprAsVariant)==1760,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprSafeAsVariant)==1768,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprSafeAsVariant)==1776,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprOp1)==1784,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprOp1)==1792,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprReturn)==1800,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprReturn)==1808,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprYield)==1816,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprYield)==1824,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprBreak)==1832,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprBreak)==1840,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprContinue)==1848,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprContinue)==1856,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,canVisitMakeBlockBody)==1864,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprMakeBlock)==1872,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprMakeBlock)==1880,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprMakeGenerator)==1888,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprMakeGenerator)==1896,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprMemZero)==1904,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprMemZero)==1912,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConst)==1920,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConst)==1928,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstPtr)==1936,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstPtr)==1944,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstEnumeration)==1952,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstEnumeration)==1960,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstBitfield)==1968,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstBitfield)==1976,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstInt8)==1984,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstInt8)==1992,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstInt16)==2000,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstInt16)==2008,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstInt64)==2016,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstInt64)==2024,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstInt)==2032,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstInt)==2040,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstInt2)==2048,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstInt2)==2056,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstInt3)==2064,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstInt3)==2072,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstInt4)==2080,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstInt4)==2088,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstUInt8)==2096,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstUInt8)==2104,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstUInt16)==2112,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstUInt16)==2120,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstUInt64)==2128,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstUInt64)==2136,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstUInt)==2144,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstUInt)==2152,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstUInt2)==2160,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstUInt2)==2168,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstUInt3)==2176,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstUInt3)==2184,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstUInt4)==2192,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstUInt4)==2200,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstRange)==2208,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstRange)==2216,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstURange)==2224,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstURange)==2232,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstRange64)==2240,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstRange64)==2248,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstURange64)==2256,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstURange64)==2264,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstBool)==2272,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstBool)==2280,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstFloat)==2288,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstFloat)==2296,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstFloat2)==2304,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstFloat2)==2312,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstFloat3)==2320,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstFloat3)==2328,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstFloat4)==2336,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstFloat4)==2344,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstString)==2352,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstString)==2360,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprConstDouble)==2368,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprConstDouble)==2376,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprFakeContext)==2384,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprFakeContext)==2392,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprFakeLineInfo)==2400,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprFakeLineInfo)==2408,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprReader)==2416,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprReader)==2424,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprUnsafe)==2432,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprUnsafe)==2440,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,preVisitExprCallMacro)==2448,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,visitExprCallMacro)==2456,"structure field offset mismatch with DAS");
+static_assert(offsetof(ColletLabels,labels)==2464,"structure field offset mismatch with DAS");
+}
+namespace macro_boost {
+
+struct ReturnSkipLockcheck {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstCallMacro)) __finalize;
+    Func DAS_COMMENT((void,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) preVisit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) visit;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const ,int32_t)) canVisitArgument;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const )) canFoldReturnResult;
+};
+static_assert(sizeof(ReturnSkipLockcheck)==48,"structure size mismatch with DAS");
+static_assert(offsetof(ReturnSkipLockcheck,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReturnSkipLockcheck,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReturnSkipLockcheck,preVisit)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReturnSkipLockcheck,visit)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReturnSkipLockcheck,canVisitArgument)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReturnSkipLockcheck,canFoldReturnResult)==40,"structure field offset mismatch with DAS");
+}
+namespace defer {
+
+struct DeferMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(DeferMacro)==112,"structure size mismatch with DAS");
+static_assert(offsetof(DeferMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(DeferMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(DeferMacro,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(DeferMacro,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(DeferMacro,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(DeferMacro,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(DeferMacro,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(DeferMacro,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(DeferMacro,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(DeferMacro,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(DeferMacro,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(DeferMacro,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(DeferMacro,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(DeferMacro,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+namespace defer {
+
+struct DeferDeleteMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstCallMacro)) __finalize;
+    Func DAS_COMMENT((void,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) preVisit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) visit;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const ,int32_t)) canVisitArgument;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const )) canFoldReturnResult;
+};
+static_assert(sizeof(DeferDeleteMacro)==48,"structure size mismatch with DAS");
+static_assert(offsetof(DeferDeleteMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(DeferDeleteMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(DeferDeleteMacro,preVisit)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(DeferDeleteMacro,visit)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(DeferDeleteMacro,canVisitArgument)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(DeferDeleteMacro,canFoldReturnResult)==40,"structure field offset mismatch with DAS");
+}
+namespace helpers {
+
+struct _lambda_helpers_26_1 {
+    Func DAS_COMMENT((bool,helpers::_lambda_helpers_26_1,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,helpers::_lambda_helpers_26_1 *)) __finalize;
+    int32_t __yield;
+    int32_t i;
+};
+static_assert(sizeof(_lambda_helpers_26_1)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_helpers_26_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_helpers_26_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_helpers_26_1,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_helpers_26_1,i)==20,"structure field offset mismatch with DAS");
+}
+namespace match {
+
+enum class MatchType : int32_t {
+    none = int32_t(0),
+    as_is = int32_t(1),
+    copy = int32_t(2),
+};
+}
+namespace match {
+
+struct MatchError {
+    char * msg;
+    LineInfo const  * at;
+};
+static_assert(sizeof(MatchError)==16,"structure size mismatch with DAS");
+static_assert(offsetof(MatchError,msg)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchError,at)==8,"structure field offset mismatch with DAS");
+}
+namespace match {
+
+struct MatchTo {
+    TArray<smart_ptr_raw<Expression>> conditions;
+    TTable<char *,smart_ptr_raw<Expression>> declarations;
+    TArray<smart_ptr_raw<Expression>> prefix;
+    TArray<match::MatchError> errors;
+    bool failed;
+};
+static_assert(sizeof(MatchTo)==128,"structure size mismatch with DAS");
+static_assert(offsetof(MatchTo,conditions)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchTo,declarations)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchTo,prefix)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchTo,errors)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchTo,failed)==120,"structure field offset mismatch with DAS");
+}
+namespace match {
+
+struct MatchMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstCallMacro)) __finalize;
+    Func DAS_COMMENT((void,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) preVisit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) visit;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const ,int32_t)) canVisitArgument;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const )) canFoldReturnResult;
+    bool report_match_errors;
+    bool multi_match;
+};
+static_assert(sizeof(MatchMacro)==56,"structure size mismatch with DAS");
+static_assert(offsetof(MatchMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchMacro,preVisit)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchMacro,visit)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchMacro,canVisitArgument)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchMacro,canFoldReturnResult)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchMacro,report_match_errors)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchMacro,multi_match)==49,"structure field offset mismatch with DAS");
+}
+namespace match {
+
+struct StaticMatchMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstCallMacro)) __finalize;
+    Func DAS_COMMENT((void,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) preVisit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) visit;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const ,int32_t)) canVisitArgument;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const )) canFoldReturnResult;
+    bool report_match_errors;
+    bool multi_match;
+};
+static_assert(sizeof(StaticMatchMacro)==56,"structure size mismatch with DAS");
+static_assert(offsetof(StaticMatchMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(StaticMatchMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(StaticMatchMacro,preVisit)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(StaticMatchMacro,visit)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(StaticMatchMacro,canVisitArgument)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(StaticMatchMacro,canFoldReturnResult)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(StaticMatchMacro,report_match_errors)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(StaticMatchMacro,multi_match)==49,"structure field offset mismatch with DAS");
+}
+namespace match {
+
+struct MultiMatchMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstCallMacro)) __finalize;
+    Func DAS_COMMENT((void,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) preVisit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) visit;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const ,int32_t)) canVisitArgument;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const )) canFoldReturnResult;
+    bool report_match_errors;
+    bool multi_match;
+};
+static_assert(sizeof(MultiMatchMacro)==56,"structure size mismatch with DAS");
+static_assert(offsetof(MultiMatchMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiMatchMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiMatchMacro,preVisit)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiMatchMacro,visit)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiMatchMacro,canVisitArgument)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiMatchMacro,canFoldReturnResult)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiMatchMacro,report_match_errors)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiMatchMacro,multi_match)==49,"structure field offset mismatch with DAS");
+}
+namespace match {
+
+struct StaticMultiMatchMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstCallMacro)) __finalize;
+    Func DAS_COMMENT((void,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) preVisit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) visit;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const ,int32_t)) canVisitArgument;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const )) canFoldReturnResult;
+    bool report_match_errors;
+    bool multi_match;
+};
+static_assert(sizeof(StaticMultiMatchMacro)==56,"structure size mismatch with DAS");
+static_assert(offsetof(StaticMultiMatchMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(StaticMultiMatchMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(StaticMultiMatchMacro,preVisit)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(StaticMultiMatchMacro,visit)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(StaticMultiMatchMacro,canVisitArgument)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(StaticMultiMatchMacro,canFoldReturnResult)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(StaticMultiMatchMacro,report_match_errors)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(StaticMultiMatchMacro,multi_match)==49,"structure field offset mismatch with DAS");
+}
+namespace match {
+
+struct MatchAsIs {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+};
+static_assert(sizeof(MatchAsIs)==72,"structure size mismatch with DAS");
+static_assert(offsetof(MatchAsIs,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchAsIs,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchAsIs,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchAsIs,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchAsIs,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchAsIs,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchAsIs,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchAsIs,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchAsIs,aotSuffix)==64,"structure field offset mismatch with DAS");
+}
+namespace match {
+
+struct MatchCopy {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+};
+static_assert(sizeof(MatchCopy)==72,"structure size mismatch with DAS");
+static_assert(offsetof(MatchCopy,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchCopy,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchCopy,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchCopy,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchCopy,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchCopy,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchCopy,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchCopy,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(MatchCopy,aotSuffix)==64,"structure field offset mismatch with DAS");
+}
+namespace meta_ast {
+
+struct Alternative {
+    meta_ast::Rule_ * rule;
+    smart_ptr_raw<Expression> action;
+};
+static_assert(sizeof(Alternative)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Alternative,rule)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Alternative,action)==8,"structure field offset mismatch with DAS");
+}
+namespace meta_ast {
+
+struct Rule_ {
+    char * name;
+    TVariant<296,8,TArray<meta_ast::Rule_ *>,TArray<meta_ast::Alternative>,meta_ast::Rule_ *,meta_ast::Rule_ *,meta_ast::Rule_ *,meta_ast::Rule_ *,TVariant<288,8,char *,TTuple<280,TDim<bool,256>,TArray<TTuple<8,int32_t,int32_t>>>,smart_ptr_raw<Expression>,char *,void *,void *,void *,void *,void *,void *,char *,char *>,char *,TTuple<16,char *,char *>,meta_ast::Rule_ *,meta_ast::Rule_ *,meta_ast::Rule_ *> rule;
+};
+static_assert(sizeof(Rule_)==304,"structure size mismatch with DAS");
+static_assert(offsetof(Rule_,name)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Rule_,rule)==8,"structure field offset mismatch with DAS");
+}
+namespace meta_ast {
+
+struct Definition {
+    char * name;
+    smart_ptr_raw<TypeDecl> type_;
+    TVariant<296,8,TArray<meta_ast::Rule_ *>,TArray<meta_ast::Alternative>,meta_ast::Rule_ *,meta_ast::Rule_ *,meta_ast::Rule_ *,meta_ast::Rule_ *,TVariant<288,8,char *,TTuple<280,TDim<bool,256>,TArray<TTuple<8,int32_t,int32_t>>>,smart_ptr_raw<Expression>,char *,void *,void *,void *,void *,void *,void *,char *,char *>,char *,TTuple<16,char *,char *>,meta_ast::Rule_ *,meta_ast::Rule_ *,meta_ast::Rule_ *> rule;
+};
+static_assert(sizeof(Definition)==312,"structure size mismatch with DAS");
+static_assert(offsetof(Definition,name)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Definition,type_)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Definition,rule)==16,"structure field offset mismatch with DAS");
+}
+namespace parser_generator {
+
+struct ParserGenerator {
+    TTable<char *,int32_t> rule_counter;
+    TTable<char *,smart_ptr_raw<TypeDecl>> rule_types;
+    TTable<char *,smart_ptr_raw<TypeDecl>> return_types;
+    char * current_context;
+    char * parser_name;
+    smart_ptr_raw<TypeDecl> parser_type;
+    bool debug;
+    bool tracing;
+    bool color_output;
+    bool cut_operator;
+    bool print_generated;
+    uint64_t id;
+};
+static_assert(sizeof(ParserGenerator)==184,"structure size mismatch with DAS");
+static_assert(offsetof(ParserGenerator,rule_counter)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(ParserGenerator,rule_types)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(ParserGenerator,return_types)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(ParserGenerator,current_context)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(ParserGenerator,parser_name)==152,"structure field offset mismatch with DAS");
+static_assert(offsetof(ParserGenerator,parser_type)==160,"structure field offset mismatch with DAS");
+static_assert(offsetof(ParserGenerator,debug)==168,"structure field offset mismatch with DAS");
+static_assert(offsetof(ParserGenerator,tracing)==169,"structure field offset mismatch with DAS");
+static_assert(offsetof(ParserGenerator,color_output)==170,"structure field offset mismatch with DAS");
+static_assert(offsetof(ParserGenerator,cut_operator)==171,"structure field offset mismatch with DAS");
+static_assert(offsetof(ParserGenerator,print_generated)==172,"structure field offset mismatch with DAS");
+static_assert(offsetof(ParserGenerator,id)==176,"structure field offset mismatch with DAS");
+}
+namespace parse_macro {
+
+struct MacroRule {
+    ExprLet * rule;
+    TArray<char *> options_;
+    TArray<ExprCall *> alternatives;
+};
+static_assert(sizeof(MacroRule)==56,"structure size mismatch with DAS");
+static_assert(offsetof(MacroRule,rule)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroRule,options_)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroRule,alternatives)==32,"structure field offset mismatch with DAS");
+}
+namespace parse_macro {
+
+struct ParseMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstCallMacro)) __finalize;
+    Func DAS_COMMENT((void,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) preVisit;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstCallMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprCallMacro> const )) visit;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const ,int32_t)) canVisitArgument;
+    Func DAS_COMMENT((bool,ast::AstCallMacro,smart_ptr_raw<ExprCallMacro> const )) canFoldReturnResult;
+};
+static_assert(sizeof(ParseMacro)==48,"structure size mismatch with DAS");
+static_assert(offsetof(ParseMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(ParseMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(ParseMacro,preVisit)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(ParseMacro,visit)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(ParseMacro,canVisitArgument)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(ParseMacro,canFoldReturnResult)==40,"structure field offset mismatch with DAS");
+}
+namespace peg {
+
+struct ParsingError {
+    char * text;
+    int32_t index;
+};
+static_assert(sizeof(ParsingError)==16,"structure size mismatch with DAS");
+static_assert(offsetof(ParsingError,text)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(ParsingError,index)==8,"structure field offset mismatch with DAS");
+}
+namespace spoof {
+
+struct SpoofTemplateReader {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstReaderMacro)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,ExprReader * const ,int32_t,LineInfo const )) accept;
+    Func DAS_COMMENT((char *,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,ExprReader * const ,LineInfo const ,int32_t &,FileInfo * &)) suffix;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprReader> const )) visit;
+};
+static_assert(sizeof(SpoofTemplateReader)==40,"structure size mismatch with DAS");
+static_assert(offsetof(SpoofTemplateReader,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SpoofTemplateReader,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SpoofTemplateReader,accept)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SpoofTemplateReader,suffix)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SpoofTemplateReader,visit)==32,"structure field offset mismatch with DAS");
+}
+namespace spoof {
+
+struct SpoofInvocation {
+    char * varName;
+    TArray<char *> args;
+};
+static_assert(sizeof(SpoofInvocation)==32,"structure size mismatch with DAS");
+static_assert(offsetof(SpoofInvocation,varName)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SpoofInvocation,args)==8,"structure field offset mismatch with DAS");
+}
+namespace spoof {
+
+struct SpoofInstanceReader {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstReaderMacro)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,ExprReader * const ,int32_t,LineInfo const )) accept;
+    Func DAS_COMMENT((char *,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,ExprReader * const ,LineInfo const ,int32_t &,FileInfo * &)) suffix;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprReader> const )) visit;
+};
+static_assert(sizeof(SpoofInstanceReader)==40,"structure size mismatch with DAS");
+static_assert(offsetof(SpoofInstanceReader,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SpoofInstanceReader,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SpoofInstanceReader,accept)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SpoofInstanceReader,suffix)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SpoofInstanceReader,visit)==32,"structure field offset mismatch with DAS");
+}
+namespace spoof {
+
+struct invocationParserTickid_0x0 {
+    TTable<int32_t,TTuple<32,bool,TTuple<16,char *,char *>,int32_t>> comma_separated_elements_cache;
+    TTable<int32_t,TTuple<24,bool,char *,int32_t>> sub_element_cache;
+    TTable<int32_t,TTuple<24,bool,char *,int32_t>> element_value_cache;
+    TTable<int32_t,TTuple<24,bool,char *,int32_t>> ident__cache;
+    TTable<int32_t,TTuple<32,bool,TTuple<16,char *,char *>,int32_t>> element_cache;
+    TTable<int32_t,TTuple<40,bool,TArray<TTuple<16,char *,char *>>,int32_t>> element_list_cache;
+    TArray<uint8_t> input;
+    int32_t index;
+    int32_t tabs;
+    bool color_output;
+    bool error_reporting;
+    int32_t longest_prefix;
+    TArray<bool> suppress_errors;
+    TArray<peg::ParsingError> errors;
+};
+static_assert(sizeof(invocationParserTickid_0x0)==376,"structure size mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x0,comma_separated_elements_cache)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x0,sub_element_cache)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x0,element_value_cache)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x0,ident__cache)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x0,element_cache)==192,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x0,element_list_cache)==240,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x0,input)==288,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x0,index)==312,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x0,tabs)==316,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x0,color_output)==320,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x0,error_reporting)==321,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x0,longest_prefix)==324,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x0,suppress_errors)==328,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x0,errors)==352,"structure field offset mismatch with DAS");
+}
+namespace spoof {
+
+struct invocationParserTickid_0x1 {
+    TTable<int32_t,TTuple<40,bool,TArray<char *>,int32_t>> element_list_cache;
+    TTable<int32_t,TTuple<24,bool,char *,int32_t>> comma_separated_elements_cache;
+    TTable<int32_t,TTuple<24,bool,char *,int32_t>> sub_element_cache;
+    TTable<int32_t,TTuple<24,bool,char *,int32_t>> class_name_cache;
+    TTable<int32_t,TTuple<24,bool,char *,int32_t>> ident__cache;
+    TTable<int32_t,TTuple<24,bool,char *,int32_t>> element_cache;
+    TTable<int32_t,TTuple<48,bool,spoof::SpoofInvocation,int32_t>> macro_invocation_cache;
+    TArray<uint8_t> input;
+    int32_t index;
+    int32_t tabs;
+    bool color_output;
+    bool error_reporting;
+    int32_t longest_prefix;
+    TArray<bool> suppress_errors;
+    TArray<peg::ParsingError> errors;
+};
+static_assert(sizeof(invocationParserTickid_0x1)==424,"structure size mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x1,element_list_cache)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x1,comma_separated_elements_cache)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x1,sub_element_cache)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x1,class_name_cache)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x1,ident__cache)==192,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x1,element_cache)==240,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x1,macro_invocation_cache)==288,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x1,input)==336,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x1,index)==360,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x1,tabs)==364,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x1,color_output)==368,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x1,error_reporting)==369,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x1,longest_prefix)==372,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x1,suppress_errors)==376,"structure field offset mismatch with DAS");
+static_assert(offsetof(invocationParserTickid_0x1,errors)==400,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct KHV_CuckooHashMap_test {
+    int32_t key;
+    uint64_t hash;
+    int32_t value;
+};
+static_assert(sizeof(KHV_CuckooHashMap_test)==24,"structure size mismatch with DAS");
+static_assert(offsetof(KHV_CuckooHashMap_test,key)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(KHV_CuckooHashMap_test,hash)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(KHV_CuckooHashMap_test,value)==16,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct CuckooHashMap_test {
+    TArray<KHV_CuckooHashMap_test> khv;
+    int32_t mask;
+    int32_t length;
+    int4 seed;
+};
+static_assert(sizeof(CuckooHashMap_test)==48,"structure size mismatch with DAS");
+static_assert(offsetof(CuckooHashMap_test,khv)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(CuckooHashMap_test,mask)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(CuckooHashMap_test,length)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(CuckooHashMap_test,seed)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct FlatHashMap_test {
+    TArray<int32_t> keys;
+    TArray<uint64_t> hashes;
+    TArray<int32_t> values;
+    int32_t mask;
+    int32_t length;
+    int32_t capacity;
+    int32_t tombstones;
+};
+static_assert(sizeof(FlatHashMap_test)==88,"structure size mismatch with DAS");
+static_assert(offsetof(FlatHashMap_test,keys)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(FlatHashMap_test,hashes)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(FlatHashMap_test,values)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(FlatHashMap_test,mask)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(FlatHashMap_test,length)==76,"structure field offset mismatch with DAS");
+static_assert(offsetof(FlatHashMap_test,capacity)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(FlatHashMap_test,tombstones)==84,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_572_1 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_572_1,int32_t * &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_572_1 *)) __finalize;
+    int32_t __yield;
+    CuckooHashMap_test * pself;
+    bool _loop_at_573_8;
+    KHV_CuckooHashMap_test * __t_rename_at_573_13;
+    void * _pvar_0_at_573_8;
+    Sequence DAS_COMMENT((KHV_CuckooHashMap_test &)) _source_0_at_573_8;
+};
+static_assert(sizeof(_lambda_thismodule_572_1)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_572_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_572_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_572_1,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_572_1,pself)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_572_1,_loop_at_573_8)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_572_1,__t_rename_at_573_13)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_572_1,_pvar_0_at_573_8)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_572_1,_source_0_at_573_8)==56,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_587_2 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_587_2,int32_t * &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_587_2 *)) __finalize;
+    int32_t __yield;
+    CuckooHashMap_test * pself;
+    bool _loop_at_588_8;
+    KHV_CuckooHashMap_test * __t_rename_at_588_13;
+    void * _pvar_0_at_588_8;
+    Sequence DAS_COMMENT((KHV_CuckooHashMap_test &)) _source_0_at_588_8;
+};
+static_assert(sizeof(_lambda_thismodule_587_2)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_587_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_587_2,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_587_2,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_587_2,pself)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_587_2,_loop_at_588_8)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_587_2,__t_rename_at_588_13)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_587_2,_pvar_0_at_588_8)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_587_2,_source_0_at_588_8)==56,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_602_3 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_602_3,int32_t const  * &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_602_3 *)) __finalize;
+    int32_t __yield;
+    CuckooHashMap_test const  * pself;
+    bool _loop_at_603_8;
+    KHV_CuckooHashMap_test const  * __t_rename_at_603_13;
+    void * _pvar_0_at_603_8;
+    Sequence DAS_COMMENT((KHV_CuckooHashMap_test &)) _source_0_at_603_8;
+};
+static_assert(sizeof(_lambda_thismodule_602_3)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_602_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_602_3,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_602_3,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_602_3,pself)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_602_3,_loop_at_603_8)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_602_3,__t_rename_at_603_13)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_602_3,_pvar_0_at_603_8)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_602_3,_source_0_at_603_8)==56,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_232_4 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_232_4,int32_t * &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_232_4 *)) __finalize;
+    int32_t __yield;
+    FlatHashMap_test * pself;
+    bool _loop_at_233_8;
+    uint64_t * __h_rename_at_233_13;
+    void * _pvar_0_at_233_8;
+    int32_t * __k_rename_at_233_15;
+    void * _pvar_1_at_233_8;
+    Sequence DAS_COMMENT((uint64_t &)) _source_0_at_233_8;
+    Sequence DAS_COMMENT((int32_t &)) _source_1_at_233_8;
+};
+static_assert(sizeof(_lambda_thismodule_232_4)==88,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_4,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_4,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_4,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_4,pself)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_4,_loop_at_233_8)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_4,__h_rename_at_233_13)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_4,_pvar_0_at_233_8)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_4,__k_rename_at_233_15)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_4,_pvar_1_at_233_8)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_4,_source_0_at_233_8)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_4,_source_1_at_233_8)==80,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_247_5 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_247_5,int32_t * &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_247_5 *)) __finalize;
+    int32_t __yield;
+    FlatHashMap_test * pself;
+    bool _loop_at_248_8;
+    uint64_t * __h_rename_at_248_13;
+    void * _pvar_0_at_248_8;
+    int32_t * __v_rename_at_248_15;
+    void * _pvar_1_at_248_8;
+    Sequence DAS_COMMENT((uint64_t &)) _source_0_at_248_8;
+    Sequence DAS_COMMENT((int32_t &)) _source_1_at_248_8;
+};
+static_assert(sizeof(_lambda_thismodule_247_5)==88,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_247_5,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_247_5,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_247_5,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_247_5,pself)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_247_5,_loop_at_248_8)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_247_5,__h_rename_at_248_13)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_247_5,_pvar_0_at_248_8)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_247_5,__v_rename_at_248_15)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_247_5,_pvar_1_at_248_8)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_247_5,_source_0_at_248_8)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_247_5,_source_1_at_248_8)==80,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_262_6 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_262_6,int32_t const  * &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_262_6 *)) __finalize;
+    int32_t __yield;
+    FlatHashMap_test const  * pself;
+    bool _loop_at_263_8;
+    uint64_t const  * __h_rename_at_263_13;
+    void * _pvar_0_at_263_8;
+    int32_t const  * __v_rename_at_263_15;
+    void * _pvar_1_at_263_8;
+    Sequence DAS_COMMENT((uint64_t &)) _source_0_at_263_8;
+    Sequence DAS_COMMENT((int32_t &)) _source_1_at_263_8;
+};
+static_assert(sizeof(_lambda_thismodule_262_6)==88,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_262_6,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_262_6,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_262_6,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_262_6,pself)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_262_6,_loop_at_263_8)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_262_6,__h_rename_at_263_13)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_262_6,_pvar_0_at_263_8)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_262_6,__v_rename_at_263_15)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_262_6,_pvar_1_at_263_8)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_262_6,_source_0_at_263_8)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_262_6,_source_1_at_263_8)==80,"structure field offset mismatch with DAS");
+}
+extern TypeInfo __type_info__af63eb4c86020609;
+
+FuncInfo __func_info__955909f57bd61177 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x955909f57bd61177), 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void finalize_e07eef0e281155e5 ( Context * __context__, KHV_CuckooHashMap_test & ____this_rename_at_382_0 );
+inline void finalize_c9b8a52bb6dcec7d ( Context * __context__, CuckooHashMap_test & ____this_rename_at_389_1 );
+inline void finalize_15601d7edf896b06 ( Context * __context__, FlatHashMap_test & ____this_rename_at_16_2 );
+inline void _FuncbuiltinTickfinalizeTick5454204887383796109_95380cba065ea7d3 ( Context * __context__, TTable<int32_t,int32_t> & __a_rename_at_1347_3 );
+inline void _FuncbuiltinTickclearTick13739625760977891612_243ead22ad1f8cc7 ( Context * __context__, TTable<int32_t,int32_t> & __t_rename_at_2083_4 );
+inline void _FuncTicktestTick959357854471906370_a315dcd8d21daa51 ( Context * __context__, CuckooHashMap_test const  & __hmap_rename_at_14_5, TArray<int32_t> const  & __randomNumbers_rename_at_14_6 );
+inline void _FuncTicktestTick959357854471906370_d236172328a423c4 ( Context * __context__, FlatHashMap_test const  & __hmap_rename_at_14_11, TArray<int32_t> const  & __randomNumbers_rename_at_14_12 );
+inline void _FuncTicktestTick959357854471906370_895c700f9ab84c84 ( Context * __context__, TTable<int32_t,int32_t> const  & __hmap_rename_at_14_17, TArray<int32_t> const  & __randomNumbers_rename_at_14_18 );
+inline void _FuncbuiltinTickswapTick6899974565646937647_be90ed3cf37d2304 ( Context * __context__, TArray<KHV_CuckooHashMap_test> & __a_rename_at_1972_23, TArray<KHV_CuckooHashMap_test> & __b_rename_at_1972_24 );
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_18bd418575e6a58b ( Context * __context__, TArray<KHV_CuckooHashMap_test> & __a_rename_at_1336_26 );
+inline int32_t _FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2 ( Context * __context__, int4 & __seed_rename_at_30_28 );
+inline void _FuncbuiltinTickswapTick6899974565646937647_49f11ecb3b5f1f0c ( Context * __context__, int32_t & __a_rename_at_1972_29, int32_t & __b_rename_at_1972_30 );
+inline void _FuncbuiltinTickswapTick6899974565646937647_30e37cee9b54428 ( Context * __context__, TArray<int32_t> & __a_rename_at_1972_32, TArray<int32_t> & __b_rename_at_1972_33 );
+inline void _FuncbuiltinTickswapTick6899974565646937647_9900bd8ba4ca7bc4 ( Context * __context__, TArray<uint64_t> & __a_rename_at_1972_35, TArray<uint64_t> & __b_rename_at_1972_36 );
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd ( Context * __context__, TArray<int32_t> & __a_rename_at_1336_38 );
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_d4173cb732201230 ( Context * __context__, TArray<uint64_t> & __a_rename_at_1336_39 );
+inline void _Func_frameworkTickprofile_testTick5073203596428633135_23a5bebf31de52f6 ( Context * __context__, char * const  __name_rename_at_16_40, CuckooHashMap_test & __hashMap_rename_at_16_41, TArray<int32_t> const  & __randomData_rename_at_16_42 );
+inline void _Func_frameworkTickprofile_testTick5073203596428633135_bc99f09fb9433113 ( Context * __context__, char * const  __name_rename_at_16_43, FlatHashMap_test & __hashMap_rename_at_16_44, TArray<int32_t> const  & __randomData_rename_at_16_45 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_43427581878bd25b ( Context * __context__, TArray<KHV_CuckooHashMap_test> & __Arr_rename_at_68_46, int32_t __newSize_rename_at_68_47 );
+inline uint64_t _Funchash_mapTickhash0Tick16751248001345967464_a990528c5ef0c1ef ( Context * __context__, int32_t __k_rename_at_360_48 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_68_50, int32_t __newSize_rename_at_68_51 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_5e7dacd12cf28329 ( Context * __context__, TArray<uint64_t> & __Arr_rename_at_68_52, int32_t __newSize_rename_at_68_53 );
+inline void _Func_frameworkTickprofile_testTick5073203596428633135_bdffbce04fd06cbe ( Context * __context__, char * const  __name_rename_at_16_54, TTable<int32_t,int32_t> & __hashMap_rename_at_16_55, TArray<int32_t> const  & __randomData_rename_at_16_56 );
+inline CuckooHashMap_test CuckooHashMap_test_cfa458a3ef36ab9a ( Context * __context__, int32_t __initialSize_rename_at_428_57 );
+inline void clear_d8da6b44af7728e9 ( Context * __context__, CuckooHashMap_test & __self_rename_at_447_59 );
+inline void grow_12af180565f61046 ( Context * __context__, CuckooHashMap_test & __self_rename_at_456_61 );
+inline void reserve_85a18fd1f1b9d0c2 ( Context * __context__, CuckooHashMap_test & __self_rename_at_464_63, int32_t __newSize_rename_at_464_64 );
+inline int32_t key_index_86093f7c0c6e917e ( Context * __context__, CuckooHashMap_test const  & __self_rename_at_483_67, int32_t __key_rename_at_483_68 );
+inline void insert_751bae88bc2bd961 ( Context * __context__, CuckooHashMap_test & __self_rename_at_615_72, int32_t ___key_rename_at_615_73, int32_t ___value_rename_at_615_74 );
+inline int32_t & _FuncSqblSqbr_4d1f3255ca764598 ( Context * __context__, CuckooHashMap_test & __self_rename_at_674_82, int32_t __key_rename_at_674_83 );
+inline FlatHashMap_test FlatHashMap_test_4120484e76bd54f5 ( Context * __context__, int32_t __initialSize_rename_at_62_89 );
+inline void clear_367a56d37590b5c2 ( Context * __context__, FlatHashMap_test & __self_rename_at_83_91 );
+inline void grow_a727608138e89b7e ( Context * __context__, FlatHashMap_test & __self_rename_at_93_93 );
+inline void rehash_97c44f23a92b4b1b ( Context * __context__, FlatHashMap_test & __self_rename_at_100_95 );
+inline void reserve_a47dd681d55c37 ( Context * __context__, FlatHashMap_test & __self_rename_at_107_96, int32_t __newSize_rename_at_107_97 );
+inline int32_t & _FuncSqblSqbr_9b28e6df96a01a19 ( Context * __context__, FlatHashMap_test & __self_rename_at_275_110, int32_t __key_rename_at_275_111 );
+inline void main_afe1773b7ff02b64 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void finalize_e07eef0e281155e5 ( Context * __context__, KHV_CuckooHashMap_test &  ____this_rename_at_382_0 )
+{
+    memset((void*)&(____this_rename_at_382_0), 0, 24);
+}
+
+inline void finalize_c9b8a52bb6dcec7d ( Context * __context__, CuckooHashMap_test &  ____this_rename_at_389_1 )
+{
+    _FuncbuiltinTickfinalizeTick13836114024949725080_18bd418575e6a58b(__context__,das_arg<TArray<KHV_CuckooHashMap_test>>::pass(____this_rename_at_389_1.khv));
+    memset((void*)&(____this_rename_at_389_1), 0, 48);
+}
+
+inline void finalize_15601d7edf896b06 ( Context * __context__, FlatHashMap_test &  ____this_rename_at_16_2 )
+{
+    _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_16_2.keys));
+    _FuncbuiltinTickfinalizeTick13836114024949725080_d4173cb732201230(__context__,das_arg<TArray<uint64_t>>::pass(____this_rename_at_16_2.hashes));
+    _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_16_2.values));
+    memset((void*)&(____this_rename_at_16_2), 0, 88);
+}
+
+inline void _FuncbuiltinTickfinalizeTick5454204887383796109_95380cba065ea7d3 ( Context * __context__, TTable<int32_t,int32_t> &  __a_rename_at_1347_3 )
+{
+    builtin_table_free(das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_1347_3),4,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickclearTick13739625760977891612_243ead22ad1f8cc7 ( Context * __context__, TTable<int32_t,int32_t> &  __t_rename_at_2083_4 )
+{
+    builtin_table_clear(das_arg<TTable<int32_t,int32_t>>::pass(__t_rename_at_2083_4),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncTicktestTick959357854471906370_a315dcd8d21daa51 ( Context * __context__, CuckooHashMap_test const  &  __hmap_rename_at_14_5, TArray<int32_t> const  &  __randomNumbers_rename_at_14_6 )
+{
+    {
+        bool __need_loop_15 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(0,10));
+        int32_t __i_rename_at_15_7;
+        __need_loop_15 = __i_iterator.first(__context__,(__i_rename_at_15_7)) && __need_loop_15;
+        for ( ; __need_loop_15 ; __need_loop_15 = __i_iterator.next(__context__,(__i_rename_at_15_7)) )
+        {
+            CuckooHashMap_test __hashMap_rename_at_16_8;das_zero(__hashMap_rename_at_16_8);
+            das_move(__hashMap_rename_at_16_8,CuckooHashMap_test_cfa458a3ef36ab9a(__context__,64));
+            {
+                bool __need_loop_20 = true;
+                // num: int const&
+                das_iterator<TArray<int32_t> const > __num_iterator(__randomNumbers_rename_at_14_6);
+                int32_t const  * __num_rename_at_20_9;
+                __need_loop_20 = __num_iterator.first(__context__,(__num_rename_at_20_9)) && __need_loop_20;
+                for ( ; __need_loop_20 ; __need_loop_20 = __num_iterator.next(__context__,(__num_rename_at_20_9)) )
+                {
+                    das_copy(_FuncSqblSqbr_4d1f3255ca764598(__context__,das_arg<CuckooHashMap_test>::pass(__hashMap_rename_at_16_8),(*__num_rename_at_20_9)),-(*__num_rename_at_20_9));
+                }
+                __num_iterator.close(__context__,(__num_rename_at_20_9));
+            };
+            clear_d8da6b44af7728e9(__context__,das_arg<CuckooHashMap_test>::pass(__hashMap_rename_at_16_8));
+            {
+                bool __need_loop_24 = true;
+                // num: int const&
+                das_iterator<TArray<int32_t> const > __num_iterator(__randomNumbers_rename_at_14_6);
+                int32_t const  * __num_rename_at_24_10;
+                __need_loop_24 = __num_iterator.first(__context__,(__num_rename_at_24_10)) && __need_loop_24;
+                for ( ; __need_loop_24 ; __need_loop_24 = __num_iterator.next(__context__,(__num_rename_at_24_10)) )
+                {
+                    das_copy(_FuncSqblSqbr_4d1f3255ca764598(__context__,das_arg<CuckooHashMap_test>::pass(__hashMap_rename_at_16_8),(*__num_rename_at_24_10)),-(*__num_rename_at_24_10));
+                }
+                __num_iterator.close(__context__,(__num_rename_at_24_10));
+            };
+            finalize_c9b8a52bb6dcec7d(__context__,das_arg<CuckooHashMap_test>::pass(__hashMap_rename_at_16_8));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_15_7));
+    };
+}
+
+inline void _FuncTicktestTick959357854471906370_d236172328a423c4 ( Context * __context__, FlatHashMap_test const  &  __hmap_rename_at_14_11, TArray<int32_t> const  &  __randomNumbers_rename_at_14_12 )
+{
+    {
+        bool __need_loop_15 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(0,10));
+        int32_t __i_rename_at_15_13;
+        __need_loop_15 = __i_iterator.first(__context__,(__i_rename_at_15_13)) && __need_loop_15;
+        for ( ; __need_loop_15 ; __need_loop_15 = __i_iterator.next(__context__,(__i_rename_at_15_13)) )
+        {
+            FlatHashMap_test __hashMap_rename_at_16_14;das_zero(__hashMap_rename_at_16_14);
+            das_move(__hashMap_rename_at_16_14,FlatHashMap_test_4120484e76bd54f5(__context__,8));
+            {
+                bool __need_loop_20 = true;
+                // num: int const&
+                das_iterator<TArray<int32_t> const > __num_iterator(__randomNumbers_rename_at_14_12);
+                int32_t const  * __num_rename_at_20_15;
+                __need_loop_20 = __num_iterator.first(__context__,(__num_rename_at_20_15)) && __need_loop_20;
+                for ( ; __need_loop_20 ; __need_loop_20 = __num_iterator.next(__context__,(__num_rename_at_20_15)) )
+                {
+                    das_copy(_FuncSqblSqbr_9b28e6df96a01a19(__context__,das_arg<FlatHashMap_test>::pass(__hashMap_rename_at_16_14),(*__num_rename_at_20_15)),-(*__num_rename_at_20_15));
+                }
+                __num_iterator.close(__context__,(__num_rename_at_20_15));
+            };
+            clear_367a56d37590b5c2(__context__,das_arg<FlatHashMap_test>::pass(__hashMap_rename_at_16_14));
+            {
+                bool __need_loop_24 = true;
+                // num: int const&
+                das_iterator<TArray<int32_t> const > __num_iterator(__randomNumbers_rename_at_14_12);
+                int32_t const  * __num_rename_at_24_16;
+                __need_loop_24 = __num_iterator.first(__context__,(__num_rename_at_24_16)) && __need_loop_24;
+                for ( ; __need_loop_24 ; __need_loop_24 = __num_iterator.next(__context__,(__num_rename_at_24_16)) )
+                {
+                    das_copy(_FuncSqblSqbr_9b28e6df96a01a19(__context__,das_arg<FlatHashMap_test>::pass(__hashMap_rename_at_16_14),(*__num_rename_at_24_16)),-(*__num_rename_at_24_16));
+                }
+                __num_iterator.close(__context__,(__num_rename_at_24_16));
+            };
+            finalize_15601d7edf896b06(__context__,das_arg<FlatHashMap_test>::pass(__hashMap_rename_at_16_14));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_15_13));
+    };
+}
+
+inline void _FuncTicktestTick959357854471906370_895c700f9ab84c84 ( Context * __context__, TTable<int32_t,int32_t> const  &  __hmap_rename_at_14_17, TArray<int32_t> const  &  __randomNumbers_rename_at_14_18 )
+{
+    {
+        bool __need_loop_15 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(0,10));
+        int32_t __i_rename_at_15_19;
+        __need_loop_15 = __i_iterator.first(__context__,(__i_rename_at_15_19)) && __need_loop_15;
+        for ( ; __need_loop_15 ; __need_loop_15 = __i_iterator.next(__context__,(__i_rename_at_15_19)) )
+        {
+            TTable<int32_t,int32_t> __hashMap_rename_at_16_20;das_zero(__hashMap_rename_at_16_20);
+            {
+                bool __need_loop_20 = true;
+                // num: int const&
+                das_iterator<TArray<int32_t> const > __num_iterator(__randomNumbers_rename_at_14_18);
+                int32_t const  * __num_rename_at_20_21;
+                __need_loop_20 = __num_iterator.first(__context__,(__num_rename_at_20_21)) && __need_loop_20;
+                for ( ; __need_loop_20 ; __need_loop_20 = __num_iterator.next(__context__,(__num_rename_at_20_21)) )
+                {
+                    das_copy(__hashMap_rename_at_16_20((*__num_rename_at_20_21),__context__),-(*__num_rename_at_20_21));
+                }
+                __num_iterator.close(__context__,(__num_rename_at_20_21));
+            };
+            _FuncbuiltinTickclearTick13739625760977891612_243ead22ad1f8cc7(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__hashMap_rename_at_16_20));
+            {
+                bool __need_loop_24 = true;
+                // num: int const&
+                das_iterator<TArray<int32_t> const > __num_iterator(__randomNumbers_rename_at_14_18);
+                int32_t const  * __num_rename_at_24_22;
+                __need_loop_24 = __num_iterator.first(__context__,(__num_rename_at_24_22)) && __need_loop_24;
+                for ( ; __need_loop_24 ; __need_loop_24 = __num_iterator.next(__context__,(__num_rename_at_24_22)) )
+                {
+                    das_copy(__hashMap_rename_at_16_20((*__num_rename_at_24_22),__context__),-(*__num_rename_at_24_22));
+                }
+                __num_iterator.close(__context__,(__num_rename_at_24_22));
+            };
+            _FuncbuiltinTickfinalizeTick5454204887383796109_95380cba065ea7d3(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__hashMap_rename_at_16_20));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_15_19));
+    };
+}
+
+inline void _FuncbuiltinTickswapTick6899974565646937647_be90ed3cf37d2304 ( Context * __context__, TArray<KHV_CuckooHashMap_test> &  __a_rename_at_1972_23, TArray<KHV_CuckooHashMap_test> &  __b_rename_at_1972_24 )
+{
+    TArray<KHV_CuckooHashMap_test> __t_rename_at_1974_25; das_zero(__t_rename_at_1974_25); das_move(__t_rename_at_1974_25, __a_rename_at_1972_23);
+    das_move(__a_rename_at_1972_23,__b_rename_at_1972_24);
+    das_move(__b_rename_at_1972_24,__t_rename_at_1974_25);
+}
+
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_18bd418575e6a58b ( Context * __context__, TArray<KHV_CuckooHashMap_test> &  __a_rename_at_1336_26 )
+{
+    {
+        bool __need_loop_1338 = true;
+        // aV: KHV_CuckooHashMap_test aka TT&
+        das_iterator<TArray<KHV_CuckooHashMap_test>> __aV_iterator(__a_rename_at_1336_26);
+        KHV_CuckooHashMap_test * __aV_rename_at_1338_27;
+        __need_loop_1338 = __aV_iterator.first(__context__,(__aV_rename_at_1338_27)) && __need_loop_1338;
+        for ( ; __need_loop_1338 ; __need_loop_1338 = __aV_iterator.next(__context__,(__aV_rename_at_1338_27)) )
+        {
+            finalize_e07eef0e281155e5(__context__,das_arg<KHV_CuckooHashMap_test>::pass((*__aV_rename_at_1338_27)));
+        }
+        __aV_iterator.close(__context__,(__aV_rename_at_1338_27));
+    };
+    builtin_array_free(das_arg<TArray<KHV_CuckooHashMap_test>>::pass(__a_rename_at_1336_26),24,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline int32_t _FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2 ( Context * __context__, int4 & __seed_rename_at_30_28 )
+{
+    das_copy(das_swizzle_ref<int32_t,int4,0>::swizzle(__seed_rename_at_30_28) /*x*/,(v_extract_xi(v_cast_vec4i(__seed_rename_at_30_28)) /*x*/ * 214013) + 2531011);
+    return das_auto_cast<int32_t>::cast((SimPolicy<int32_t>::BinShr(v_extract_xi(v_cast_vec4i(__seed_rename_at_30_28)) /*x*/,16,*__context__,nullptr)) & 32767);
+}
+
+inline void _FuncbuiltinTickswapTick6899974565646937647_49f11ecb3b5f1f0c ( Context * __context__, int32_t & __a_rename_at_1972_29, int32_t & __b_rename_at_1972_30 )
+{
+    int32_t __t_rename_at_1974_31; das_zero(__t_rename_at_1974_31); das_move(__t_rename_at_1974_31, __a_rename_at_1972_29);
+    das_move(__a_rename_at_1972_29,__b_rename_at_1972_30);
+    das_move(__b_rename_at_1972_30,__t_rename_at_1974_31);
+}
+
+inline void _FuncbuiltinTickswapTick6899974565646937647_30e37cee9b54428 ( Context * __context__, TArray<int32_t> &  __a_rename_at_1972_32, TArray<int32_t> &  __b_rename_at_1972_33 )
+{
+    TArray<int32_t> __t_rename_at_1974_34; das_zero(__t_rename_at_1974_34); das_move(__t_rename_at_1974_34, __a_rename_at_1972_32);
+    das_move(__a_rename_at_1972_32,__b_rename_at_1972_33);
+    das_move(__b_rename_at_1972_33,__t_rename_at_1974_34);
+}
+
+inline void _FuncbuiltinTickswapTick6899974565646937647_9900bd8ba4ca7bc4 ( Context * __context__, TArray<uint64_t> &  __a_rename_at_1972_35, TArray<uint64_t> &  __b_rename_at_1972_36 )
+{
+    TArray<uint64_t> __t_rename_at_1974_37; das_zero(__t_rename_at_1974_37); das_move(__t_rename_at_1974_37, __a_rename_at_1972_35);
+    das_move(__a_rename_at_1972_35,__b_rename_at_1972_36);
+    das_move(__b_rename_at_1972_36,__t_rename_at_1974_37);
+}
+
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd ( Context * __context__, TArray<int32_t> &  __a_rename_at_1336_38 )
+{
+    builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_1336_38),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_d4173cb732201230 ( Context * __context__, TArray<uint64_t> &  __a_rename_at_1336_39 )
+{
+    builtin_array_free(das_arg<TArray<uint64_t>>::pass(__a_rename_at_1336_39),8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Func_frameworkTickprofile_testTick5073203596428633135_23a5bebf31de52f6 ( Context * __context__, char * const  __name_rename_at_16_40, CuckooHashMap_test &  __hashMap_rename_at_16_41, TArray<int32_t> const  &  __randomData_rename_at_16_42 ) { das_stack_prologue __prologue(__context__,80,"_framework`profile_test`5073203596428633135 " DAS_FILE_LINE);
+{
+    builtin_profile(1,__name_rename_at_16_40,das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        _FuncTicktestTick959357854471906370_a315dcd8d21daa51(__context__,das_arg<CuckooHashMap_test>::pass(__hashMap_rename_at_16_41),__randomData_rename_at_16_42);
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}}
+
+inline void _Func_frameworkTickprofile_testTick5073203596428633135_bc99f09fb9433113 ( Context * __context__, char * const  __name_rename_at_16_43, FlatHashMap_test &  __hashMap_rename_at_16_44, TArray<int32_t> const  &  __randomData_rename_at_16_45 ) { das_stack_prologue __prologue(__context__,80,"_framework`profile_test`5073203596428633135 " DAS_FILE_LINE);
+{
+    builtin_profile(1,__name_rename_at_16_43,das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        _FuncTicktestTick959357854471906370_d236172328a423c4(__context__,das_arg<FlatHashMap_test>::pass(__hashMap_rename_at_16_44),__randomData_rename_at_16_45);
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_43427581878bd25b ( Context * __context__, TArray<KHV_CuckooHashMap_test> &  __Arr_rename_at_68_46, int32_t __newSize_rename_at_68_47 )
+{
+    builtin_array_resize(das_arg<TArray<KHV_CuckooHashMap_test>>::pass(__Arr_rename_at_68_46),__newSize_rename_at_68_47,24,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline uint64_t _Funchash_mapTickhash0Tick16751248001345967464_a990528c5ef0c1ef ( Context * __context__, int32_t __k_rename_at_360_48 )
+{
+    uint64_t __k64_rename_at_362_49 = ((uint64_t)uint64_t(__k_rename_at_360_48));
+    return das_auto_cast<uint64_t>::cast((__k64_rename_at_362_49 <= UINT64_C(0x2)) ? das_auto_cast<uint64_t>::cast(UINT64_C(0x9e3779b97f4a7c15)) : das_auto_cast<uint64_t>::cast(__k64_rename_at_362_49));
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_68_50, int32_t __newSize_rename_at_68_51 )
+{
+    builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_68_50),__newSize_rename_at_68_51,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_5e7dacd12cf28329 ( Context * __context__, TArray<uint64_t> &  __Arr_rename_at_68_52, int32_t __newSize_rename_at_68_53 )
+{
+    builtin_array_resize(das_arg<TArray<uint64_t>>::pass(__Arr_rename_at_68_52),__newSize_rename_at_68_53,8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Func_frameworkTickprofile_testTick5073203596428633135_bdffbce04fd06cbe ( Context * __context__, char * const  __name_rename_at_16_54, TTable<int32_t,int32_t> &  __hashMap_rename_at_16_55, TArray<int32_t> const  &  __randomData_rename_at_16_56 ) { das_stack_prologue __prologue(__context__,80,"_framework`profile_test`5073203596428633135 " DAS_FILE_LINE);
+{
+    builtin_profile(1,__name_rename_at_16_54,das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        _FuncTicktestTick959357854471906370_895c700f9ab84c84(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__hashMap_rename_at_16_55),__randomData_rename_at_16_56);
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}}
+
+inline CuckooHashMap_test CuckooHashMap_test_cfa458a3ef36ab9a ( Context * __context__, int32_t __initialSize_rename_at_428_57 )
+{
+    DAS_ASSERTF(((__initialSize_rename_at_428_57 & (__initialSize_rename_at_428_57 - 1)) == 0),(((char *) "size must be a power of 2")));
+    CuckooHashMap_test __self_rename_at_430_58;das_zero(__self_rename_at_430_58);
+    das_copy(__self_rename_at_430_58.seed,int4(13,14,15,16));
+    _FuncbuiltinTickresizeTick4811697762258667383_43427581878bd25b(__context__,das_arg<TArray<KHV_CuckooHashMap_test>>::pass(__self_rename_at_430_58.khv),__initialSize_rename_at_428_57);
+    das_copy(__self_rename_at_430_58.mask,__initialSize_rename_at_428_57 - 1);
+    return /* <- */ das_auto_cast_move<CuckooHashMap_test>::cast(__self_rename_at_430_58);
+}
+
+inline void clear_d8da6b44af7728e9 ( Context * __context__, CuckooHashMap_test &  __self_rename_at_447_59 )
+{
+    {
+        bool __need_loop_449 = true;
+        // t: KHV_CuckooHashMap_test&
+        das_iterator<TArray<KHV_CuckooHashMap_test>> __t_iterator(__self_rename_at_447_59.khv);
+        KHV_CuckooHashMap_test * __t_rename_at_449_60;
+        __need_loop_449 = __t_iterator.first(__context__,(__t_rename_at_449_60)) && __need_loop_449;
+        for ( ; __need_loop_449 ; __need_loop_449 = __t_iterator.next(__context__,(__t_rename_at_449_60)) )
+        {
+            das_copy((*__t_rename_at_449_60).hash,UINT64_C(0x0));
+        }
+        __t_iterator.close(__context__,(__t_rename_at_449_60));
+    };
+    das_copy(__self_rename_at_447_59.length,0);
+}
+
+inline void grow_12af180565f61046 ( Context * __context__, CuckooHashMap_test &  __self_rename_at_456_61 )
+{
+    int32_t __newSize_rename_at_458_62 = ((int32_t)(builtin_array_size(das_arg<TArray<KHV_CuckooHashMap_test>>::pass(__self_rename_at_456_61.khv)) * 2));
+    reserve_85a18fd1f1b9d0c2(__context__,das_arg<CuckooHashMap_test>::pass(__self_rename_at_456_61),__newSize_rename_at_458_62);
+}
+
+inline void reserve_85a18fd1f1b9d0c2 ( Context * __context__, CuckooHashMap_test &  __self_rename_at_464_63, int32_t __newSize_rename_at_464_64 )
+{
+    DAS_ASSERTF(((__newSize_rename_at_464_64 & (__newSize_rename_at_464_64 - 1)) == 0),(((char *) "size must be a power of 2")));
+    TArray<KHV_CuckooHashMap_test> __newKHV_rename_at_467_65;das_zero(__newKHV_rename_at_467_65);
+    _FuncbuiltinTickresizeTick4811697762258667383_43427581878bd25b(__context__,das_arg<TArray<KHV_CuckooHashMap_test>>::pass(__newKHV_rename_at_467_65),__newSize_rename_at_464_64);
+    das_copy(__self_rename_at_464_63.mask,__newSize_rename_at_464_64 - 1);
+    _FuncbuiltinTickswapTick6899974565646937647_be90ed3cf37d2304(__context__,das_arg<TArray<KHV_CuckooHashMap_test>>::pass(__newKHV_rename_at_467_65),das_arg<TArray<KHV_CuckooHashMap_test>>::pass(__self_rename_at_464_63.khv));
+    das_copy(__self_rename_at_464_63.length,0);
+    {
+        bool __need_loop_472 = true;
+        // t: KHV_CuckooHashMap_test&
+        das_iterator<TArray<KHV_CuckooHashMap_test>> __t_iterator(__newKHV_rename_at_467_65);
+        KHV_CuckooHashMap_test * __t_rename_at_472_66;
+        __need_loop_472 = __t_iterator.first(__context__,(__t_rename_at_472_66)) && __need_loop_472;
+        for ( ; __need_loop_472 ; __need_loop_472 = __t_iterator.next(__context__,(__t_rename_at_472_66)) )
+        {
+            if ( (*__t_rename_at_472_66).hash != UINT64_C(0x0) )
+            {
+                das_move(_FuncSqblSqbr_4d1f3255ca764598(__context__,das_arg<CuckooHashMap_test>::pass(__self_rename_at_464_63),(*__t_rename_at_472_66).key),(*__t_rename_at_472_66).value);
+            };
+        }
+        __t_iterator.close(__context__,(__t_rename_at_472_66));
+    };
+    _FuncbuiltinTickresizeTick4811697762258667383_43427581878bd25b(__context__,das_arg<TArray<KHV_CuckooHashMap_test>>::pass(__newKHV_rename_at_467_65),0);
+    _FuncbuiltinTickfinalizeTick13836114024949725080_18bd418575e6a58b(__context__,das_arg<TArray<KHV_CuckooHashMap_test>>::pass(__newKHV_rename_at_467_65));
+}
+
+inline int32_t key_index_86093f7c0c6e917e ( Context * __context__, CuckooHashMap_test const  &  __self_rename_at_483_67, int32_t __key_rename_at_483_68 )
+{
+    uint64_t __firstHash_rename_at_485_69 = ((uint64_t)_Funchash_mapTickhash0Tick16751248001345967464_a990528c5ef0c1ef(__context__,__key_rename_at_483_68));
+    int32_t __index_rename_at_486_70 = (int32_t(__firstHash_rename_at_485_69) & __self_rename_at_483_67.mask);
+    if ( (__self_rename_at_483_67.khv(__index_rename_at_486_70,__context__).hash == __firstHash_rename_at_485_69) && (__self_rename_at_483_67.khv(__index_rename_at_486_70,__context__).key == __key_rename_at_483_68) )
+    {
+        return das_auto_cast<int32_t>::cast(__index_rename_at_486_70);
+    } else {
+        uint64_t __secondHash_rename_at_490_71 = _builtin_hash_int32(__key_rename_at_483_68);
+        das_copy(__index_rename_at_486_70,int32_t(__secondHash_rename_at_490_71) & __self_rename_at_483_67.mask);
+        return das_auto_cast<int32_t>::cast(((__self_rename_at_483_67.khv(__index_rename_at_486_70,__context__).hash == __secondHash_rename_at_490_71) && (__self_rename_at_483_67.khv(__index_rename_at_486_70,__context__).key == __key_rename_at_483_68)) ? das_auto_cast<int32_t>::cast(__index_rename_at_486_70) : das_auto_cast<int32_t>::cast(-1));
+    };
+}
+
+inline void insert_751bae88bc2bd961 ( Context * __context__, CuckooHashMap_test &  __self_rename_at_615_72, int32_t ___key_rename_at_615_73, int32_t ___value_rename_at_615_74 )
+{
+    int32_t __key_rename_at_618_75 = ___key_rename_at_615_73;
+    int32_t __value_rename_at_619_76 = ___value_rename_at_615_74;
+    while ( true )
+    {
+        {
+            bool __need_loop_621 = true;
+            // i: int const
+            das_iterator<range> __i_iterator(mk_range(SimPolicy<int32_t>::Div(builtin_array_size(das_arg<TArray<KHV_CuckooHashMap_test>>::pass(__self_rename_at_615_72.khv)),2,*__context__,nullptr)));
+            int32_t __i_rename_at_621_77;
+            __need_loop_621 = __i_iterator.first(__context__,(__i_rename_at_621_77)) && __need_loop_621;
+            for ( ; __need_loop_621 ; __need_loop_621 = __i_iterator.next(__context__,(__i_rename_at_621_77)) )
+            {
+                uint64_t __firstHash_rename_at_622_78 = _Funchash_mapTickhash0Tick16751248001345967464_a990528c5ef0c1ef(__context__,__key_rename_at_618_75);
+                int32_t __firstIndex_rename_at_623_79 = (int32_t(__firstHash_rename_at_622_78) & __self_rename_at_615_72.mask);
+                if ( __self_rename_at_615_72.khv(__firstIndex_rename_at_623_79,__context__).hash == UINT64_C(0x0) )
+                {
+                    das_copy(__self_rename_at_615_72.khv(__firstIndex_rename_at_623_79,__context__).hash,__firstHash_rename_at_622_78);
+                    das_move(__self_rename_at_615_72.khv(__firstIndex_rename_at_623_79,__context__).key,__key_rename_at_618_75);
+                    das_move(__self_rename_at_615_72.khv(__firstIndex_rename_at_623_79,__context__).value,__value_rename_at_619_76);
+                    ++__self_rename_at_615_72.length;
+                    return ;
+                } else {
+                    uint64_t __secondHash_rename_at_631_80 = _builtin_hash_int32(__key_rename_at_618_75);
+                    int32_t __secondIndex_rename_at_632_81 = (int32_t(__secondHash_rename_at_631_80) & __self_rename_at_615_72.mask);
+                    if ( __self_rename_at_615_72.khv(__secondIndex_rename_at_632_81,__context__).hash == UINT64_C(0x0) )
+                    {
+                        das_copy(__self_rename_at_615_72.khv(__secondIndex_rename_at_632_81,__context__).hash,__secondHash_rename_at_631_80);
+                        das_move(__self_rename_at_615_72.khv(__secondIndex_rename_at_632_81,__context__).key,__key_rename_at_618_75);
+                        das_move(__self_rename_at_615_72.khv(__secondIndex_rename_at_632_81,__context__).value,__value_rename_at_619_76);
+                        ++__self_rename_at_615_72.length;
+                        return ;
+                    } else {
+                        if ( (_FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2(__context__,__self_rename_at_615_72.seed) & 1) == 0 )
+                        {
+                            _FuncbuiltinTickswapTick6899974565646937647_49f11ecb3b5f1f0c(__context__,__key_rename_at_618_75,__self_rename_at_615_72.khv(__firstIndex_rename_at_623_79,__context__).key);
+                            _FuncbuiltinTickswapTick6899974565646937647_49f11ecb3b5f1f0c(__context__,__value_rename_at_619_76,__self_rename_at_615_72.khv(__firstIndex_rename_at_623_79,__context__).value);
+                            das_copy(__self_rename_at_615_72.khv(__firstIndex_rename_at_623_79,__context__).hash,__firstHash_rename_at_622_78);
+                        } else {
+                            _FuncbuiltinTickswapTick6899974565646937647_49f11ecb3b5f1f0c(__context__,__key_rename_at_618_75,__self_rename_at_615_72.khv(__secondIndex_rename_at_632_81,__context__).key);
+                            _FuncbuiltinTickswapTick6899974565646937647_49f11ecb3b5f1f0c(__context__,__value_rename_at_619_76,__self_rename_at_615_72.khv(__secondIndex_rename_at_632_81,__context__).value);
+                            das_copy(__self_rename_at_615_72.khv(__secondIndex_rename_at_632_81,__context__).hash,__secondHash_rename_at_631_80);
+                        };
+                    };
+                };
+            }
+            __i_iterator.close(__context__,(__i_rename_at_621_77));
+        };
+        grow_12af180565f61046(__context__,das_arg<CuckooHashMap_test>::pass(__self_rename_at_615_72));
+    };
+}
+
+inline int32_t & _FuncSqblSqbr_4d1f3255ca764598 ( Context * __context__, CuckooHashMap_test &  __self_rename_at_674_82, int32_t __key_rename_at_674_83 )
+{
+    if ( __self_rename_at_674_82.length > (SimPolicy<int32_t>::BinShr((__self_rename_at_674_82.mask + 1),1,*__context__,nullptr)) )
+    {
+        grow_12af180565f61046(__context__,das_arg<CuckooHashMap_test>::pass(__self_rename_at_674_82));
+    };
+    uint64_t __firstHash_rename_at_680_84 = _Funchash_mapTickhash0Tick16751248001345967464_a990528c5ef0c1ef(__context__,__key_rename_at_674_83);
+    int32_t __firstIndex_rename_at_681_85 = (int32_t(__firstHash_rename_at_680_84) & __self_rename_at_674_82.mask);
+    if ( (__self_rename_at_674_82.khv(__firstIndex_rename_at_681_85,__context__).hash == __firstHash_rename_at_680_84) && (__self_rename_at_674_82.khv(__firstIndex_rename_at_681_85,__context__).key == __key_rename_at_674_83) )
+    {
+        return das_auto_cast_ref<int32_t &>::cast(__self_rename_at_674_82.khv(__firstIndex_rename_at_681_85,__context__).value);
+    } else {
+        uint64_t __secondHash_rename_at_687_86 = _builtin_hash_int32(__key_rename_at_674_83);
+        int32_t __secondIndex_rename_at_688_87 = (int32_t(__secondHash_rename_at_687_86) & __self_rename_at_674_82.mask);
+        if ( (__self_rename_at_674_82.khv(__secondIndex_rename_at_688_87,__context__).hash == __secondHash_rename_at_687_86) && (__self_rename_at_674_82.khv(__secondIndex_rename_at_688_87,__context__).key == __key_rename_at_674_83) )
+        {
+            return das_auto_cast_ref<int32_t &>::cast(__self_rename_at_674_82.khv(__secondIndex_rename_at_688_87,__context__).value);
+        } else {
+            if ( __self_rename_at_674_82.khv(__firstIndex_rename_at_681_85,__context__).hash == UINT64_C(0x0) )
+            {
+                das_copy(__self_rename_at_674_82.khv(__firstIndex_rename_at_681_85,__context__).hash,__firstHash_rename_at_680_84);
+                das_copy(__self_rename_at_674_82.khv(__firstIndex_rename_at_681_85,__context__).key,__key_rename_at_674_83);
+                ++__self_rename_at_674_82.length;
+                return das_auto_cast_ref<int32_t &>::cast(__self_rename_at_674_82.khv(__firstIndex_rename_at_681_85,__context__).value);
+            } else {
+                if ( __self_rename_at_674_82.khv(__secondIndex_rename_at_688_87,__context__).hash == UINT64_C(0x0) )
+                {
+                    das_copy(__self_rename_at_674_82.khv(__secondIndex_rename_at_688_87,__context__).hash,__secondHash_rename_at_687_86);
+                    das_copy(__self_rename_at_674_82.khv(__secondIndex_rename_at_688_87,__context__).key,__key_rename_at_674_83);
+                    ++__self_rename_at_674_82.length;
+                    return das_auto_cast_ref<int32_t &>::cast(__self_rename_at_674_82.khv(__secondIndex_rename_at_688_87,__context__).value);
+                } else {
+                    insert_751bae88bc2bd961(__context__,das_arg<CuckooHashMap_test>::pass(__self_rename_at_674_82),__key_rename_at_674_83,0);
+                    int32_t __index_rename_at_713_88 = ((int32_t)key_index_86093f7c0c6e917e(__context__,das_arg<CuckooHashMap_test>::pass(__self_rename_at_674_82),__key_rename_at_674_83));
+                    return das_auto_cast_ref<int32_t &>::cast(__self_rename_at_674_82.khv(__index_rename_at_713_88,__context__).value);
+                };
+            };
+        };
+    };
+}
+
+inline FlatHashMap_test FlatHashMap_test_4120484e76bd54f5 ( Context * __context__, int32_t __initialSize_rename_at_62_89 )
+{
+    DAS_ASSERTF(((__initialSize_rename_at_62_89 & (__initialSize_rename_at_62_89 - 1)) == 0),(((char *) "size must be a power of 2")));
+    FlatHashMap_test __self_rename_at_64_90;das_zero(__self_rename_at_64_90);
+    das_copy(__self_rename_at_64_90.capacity,__initialSize_rename_at_62_89);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__self_rename_at_64_90.keys),__initialSize_rename_at_62_89);
+    _FuncbuiltinTickresizeTick4811697762258667383_5e7dacd12cf28329(__context__,das_arg<TArray<uint64_t>>::pass(__self_rename_at_64_90.hashes),__initialSize_rename_at_62_89);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__self_rename_at_64_90.values),__initialSize_rename_at_62_89);
+    das_copy(__self_rename_at_64_90.mask,__initialSize_rename_at_62_89 - 1);
+    return /* <- */ das_auto_cast_move<FlatHashMap_test>::cast(__self_rename_at_64_90);
+}
+
+inline void clear_367a56d37590b5c2 ( Context * __context__, FlatHashMap_test &  __self_rename_at_83_91 )
+{
+    {
+        bool __need_loop_85 = true;
+        // h: uint64&
+        das_iterator<TArray<uint64_t>> __h_iterator(__self_rename_at_83_91.hashes);
+        uint64_t * __h_rename_at_85_92;
+        __need_loop_85 = __h_iterator.first(__context__,(__h_rename_at_85_92)) && __need_loop_85;
+        for ( ; __need_loop_85 ; __need_loop_85 = __h_iterator.next(__context__,(__h_rename_at_85_92)) )
+        {
+            das_copy((*__h_rename_at_85_92),UINT64_C(0x0));
+        }
+        __h_iterator.close(__context__,(__h_rename_at_85_92));
+    };
+    das_copy(__self_rename_at_83_91.length,0);
+    das_copy(__self_rename_at_83_91.tombstones,0);
+}
+
+inline void grow_a727608138e89b7e ( Context * __context__, FlatHashMap_test &  __self_rename_at_93_93 )
+{
+    int32_t __newSize_rename_at_95_94 = ((int32_t)(__self_rename_at_93_93.capacity * 2));
+    reserve_a47dd681d55c37(__context__,das_arg<FlatHashMap_test>::pass(__self_rename_at_93_93),__newSize_rename_at_95_94);
+}
+
+inline void rehash_97c44f23a92b4b1b ( Context * __context__, FlatHashMap_test &  __self_rename_at_100_95 )
+{
+    reserve_a47dd681d55c37(__context__,das_arg<FlatHashMap_test>::pass(__self_rename_at_100_95),__self_rename_at_100_95.capacity);
+}
+
+inline void reserve_a47dd681d55c37 ( Context * __context__, FlatHashMap_test &  __self_rename_at_107_96, int32_t __newSize_rename_at_107_97 )
+{
+    DAS_ASSERTF(((__newSize_rename_at_107_97 & (__newSize_rename_at_107_97 - 1)) == 0),(((char *) "size must be a power of 2")));
+    TArray<int32_t> __newKeys_rename_at_110_98;das_zero(__newKeys_rename_at_110_98);
+    TArray<uint64_t> __newHashes_rename_at_111_99;das_zero(__newHashes_rename_at_111_99);
+    TArray<int32_t> __newValues_rename_at_112_100;das_zero(__newValues_rename_at_112_100);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__newKeys_rename_at_110_98),__newSize_rename_at_107_97);
+    _FuncbuiltinTickresizeTick4811697762258667383_5e7dacd12cf28329(__context__,das_arg<TArray<uint64_t>>::pass(__newHashes_rename_at_111_99),__newSize_rename_at_107_97);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__newValues_rename_at_112_100),__newSize_rename_at_107_97);
+    das_copy(__self_rename_at_107_96.mask,__newSize_rename_at_107_97 - 1);
+    _FuncbuiltinTickswapTick6899974565646937647_30e37cee9b54428(__context__,das_arg<TArray<int32_t>>::pass(__newKeys_rename_at_110_98),das_arg<TArray<int32_t>>::pass(__self_rename_at_107_96.keys));
+    _FuncbuiltinTickswapTick6899974565646937647_9900bd8ba4ca7bc4(__context__,das_arg<TArray<uint64_t>>::pass(__newHashes_rename_at_111_99),das_arg<TArray<uint64_t>>::pass(__self_rename_at_107_96.hashes));
+    _FuncbuiltinTickswapTick6899974565646937647_30e37cee9b54428(__context__,das_arg<TArray<int32_t>>::pass(__newValues_rename_at_112_100),das_arg<TArray<int32_t>>::pass(__self_rename_at_107_96.values));
+    das_copy(__self_rename_at_107_96.length,0);
+    das_copy(__self_rename_at_107_96.tombstones,0);
+    das_copy(__self_rename_at_107_96.capacity,__newSize_rename_at_107_97);
+    {
+        bool __need_loop_123 = true;
+        // k: int&
+        das_iterator<TArray<int32_t>> __k_iterator(__newKeys_rename_at_110_98);
+        int32_t * __k_rename_at_123_107;
+        __need_loop_123 = __k_iterator.first(__context__,(__k_rename_at_123_107)) && __need_loop_123;
+        // v: int&
+        das_iterator<TArray<int32_t>> __v_iterator(__newValues_rename_at_112_100);
+        int32_t * __v_rename_at_123_108;
+        __need_loop_123 = __v_iterator.first(__context__,(__v_rename_at_123_108)) && __need_loop_123;
+        // h: uint64&
+        das_iterator<TArray<uint64_t>> __h_iterator(__newHashes_rename_at_111_99);
+        uint64_t * __h_rename_at_123_109;
+        __need_loop_123 = __h_iterator.first(__context__,(__h_rename_at_123_109)) && __need_loop_123;
+        for ( ; __need_loop_123 ; __need_loop_123 = __k_iterator.next(__context__,(__k_rename_at_123_107)) && __v_iterator.next(__context__,(__v_rename_at_123_108)) && __h_iterator.next(__context__,(__h_rename_at_123_109)) )
+        {
+            if ( (*__h_rename_at_123_109) > UINT64_C(0x1) )
+            {
+                das_move(_FuncSqblSqbr_9b28e6df96a01a19(__context__,das_arg<FlatHashMap_test>::pass(__self_rename_at_107_96),(*__k_rename_at_123_107)),(*__v_rename_at_123_108));
+            };
+        }
+        __h_iterator.close(__context__,(__h_rename_at_123_109));
+        __v_iterator.close(__context__,(__v_rename_at_123_108));
+        __k_iterator.close(__context__,(__k_rename_at_123_107));
+    };
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__newKeys_rename_at_110_98),0);
+    _FuncbuiltinTickresizeTick4811697762258667383_5e7dacd12cf28329(__context__,das_arg<TArray<uint64_t>>::pass(__newHashes_rename_at_111_99),0);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__newValues_rename_at_112_100),0);
+    _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd(__context__,das_arg<TArray<int32_t>>::pass(__newKeys_rename_at_110_98));
+    _FuncbuiltinTickfinalizeTick13836114024949725080_d4173cb732201230(__context__,das_arg<TArray<uint64_t>>::pass(__newHashes_rename_at_111_99));
+    _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd(__context__,das_arg<TArray<int32_t>>::pass(__newValues_rename_at_112_100));
+}
+
+inline int32_t & _FuncSqblSqbr_9b28e6df96a01a19 ( Context * __context__, FlatHashMap_test &  __self_rename_at_275_110, int32_t __key_rename_at_275_111 )
+{
+    if ( __self_rename_at_275_110.length > (SimPolicy<int32_t>::BinShr(__self_rename_at_275_110.capacity,1,*__context__,nullptr)) )
+    {
+        grow_a727608138e89b7e(__context__,das_arg<FlatHashMap_test>::pass(__self_rename_at_275_110));
+    } else if ( (SimPolicy<int32_t>::BinShr((__self_rename_at_275_110.capacity - __self_rename_at_275_110.length),1,*__context__,nullptr)) < __self_rename_at_275_110.tombstones )
+    {
+        rehash_97c44f23a92b4b1b(__context__,das_arg<FlatHashMap_test>::pass(__self_rename_at_275_110));
+    };
+    uint64_t __hash_rename_at_282_112 = ((uint64_t)_builtin_hash_int32(__key_rename_at_275_111));
+    int32_t __index_rename_at_283_113 = (int32_t(__hash_rename_at_282_112) & __self_rename_at_275_110.mask);
+    int32_t __lastTombstone_rename_at_284_114 = -1;
+    while ( true )
+    {
+        uint64_t __h_rename_at_286_115 = ((uint64_t)__self_rename_at_275_110.hashes(__index_rename_at_283_113,__context__));
+        if ( __h_rename_at_286_115 == __hash_rename_at_282_112 )
+        {
+            if ( __self_rename_at_275_110.keys(__index_rename_at_283_113,__context__) == __key_rename_at_275_111 )
+            {
+                return das_auto_cast_ref<int32_t &>::cast(__self_rename_at_275_110.values(__index_rename_at_283_113,__context__));
+            };
+        } else if ( __h_rename_at_286_115 == UINT64_C(0x1) )
+        {
+            if ( __lastTombstone_rename_at_284_114 == -1 )
+            {
+                das_copy(__lastTombstone_rename_at_284_114,__index_rename_at_283_113);
+            };
+        } else if ( __h_rename_at_286_115 == UINT64_C(0x0) )
+        {
+            if ( __lastTombstone_rename_at_284_114 != -1 )
+            {
+                das_copy(__index_rename_at_283_113,__lastTombstone_rename_at_284_114);
+                --__self_rename_at_275_110.tombstones;
+            };
+            das_copy(__self_rename_at_275_110.keys(__index_rename_at_283_113,__context__),__key_rename_at_275_111);
+            das_copy(__self_rename_at_275_110.hashes(__index_rename_at_283_113,__context__),__hash_rename_at_282_112);
+            ++__self_rename_at_275_110.length;
+            return das_auto_cast_ref<int32_t &>::cast(__self_rename_at_275_110.values(__index_rename_at_283_113,__context__));
+        };
+        das_copy(__index_rename_at_283_113,(__index_rename_at_283_113 + 1) & __self_rename_at_275_110.mask);
+    };
+    builtin_throw(((char *) "unreachable"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return das_auto_cast_ref<int32_t &>::cast(__self_rename_at_275_110.values(0,__context__));
+}
+
+inline void main_afe1773b7ff02b64 ( Context * __context__ )
+{
+    TTable<int32_t,int32_t> _temp_make_local_36_35_0; _temp_make_local_36_35_0;
+    CuckooHashMap_test _temp_make_local_37_44_1; _temp_make_local_37_44_1;
+    FlatHashMap_test _temp_make_local_38_42_2; _temp_make_local_38_42_2;
+    builtin_print(((char *) "test03 - insert 1000000 unique random numbers, clear, insert again\n"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    TArray<int32_t> __randomNumbers_rename_at_35_116; das_zero(__randomNumbers_rename_at_35_116); das_move(__randomNumbers_rename_at_35_116, das_invoke_function<TArray<int32_t>>::invoke_cmres<int32_t>(__context__,nullptr,Func(__context__->fnByMangledName(/*@_framework::generate_unique_positive_random_numbers Ci*/ 0x3a0105cd9f77f533)),1000000));
+    _Func_frameworkTickprofile_testTick5073203596428633135_bdffbce04fd06cbe(__context__,((char *) "table<int;int>"),das_arg<TTable<int32_t,int32_t>>::pass((([&]() -> TTable<int32_t,int32_t>& {
+        das_zero(_temp_make_local_36_35_0);
+        return _temp_make_local_36_35_0;
+    })())),das_arg<TArray<int32_t>>::pass(__randomNumbers_rename_at_35_116));
+    _Func_frameworkTickprofile_testTick5073203596428633135_23a5bebf31de52f6(__context__,((char *) "TCuckooHashMap<int,int>"),das_arg<CuckooHashMap_test>::pass((_temp_make_local_37_44_1 = (CuckooHashMap_test_cfa458a3ef36ab9a(__context__,64)))),das_arg<TArray<int32_t>>::pass(__randomNumbers_rename_at_35_116));
+    _Func_frameworkTickprofile_testTick5073203596428633135_bc99f09fb9433113(__context__,((char *) "TFlatHashMap<int,int>"),das_arg<FlatHashMap_test>::pass((_temp_make_local_38_42_2 = (FlatHashMap_test_4120484e76bd54f5(__context__,8)))),das_arg<TArray<int32_t>>::pass(__randomNumbers_rename_at_35_116));
+}
+static vec4f __wrap_finalize_e07eef0e281155e5 ( Context * __context__ ) {
+    KHV_CuckooHashMap_test &  arg___this = cast_aot_arg<KHV_CuckooHashMap_test & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_e07eef0e281155e5(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_c9b8a52bb6dcec7d ( Context * __context__ ) {
+    CuckooHashMap_test &  arg___this = cast_aot_arg<CuckooHashMap_test & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_c9b8a52bb6dcec7d(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_15601d7edf896b06 ( Context * __context__ ) {
+    FlatHashMap_test &  arg___this = cast_aot_arg<FlatHashMap_test & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_15601d7edf896b06(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickfinalizeTick5454204887383796109_95380cba065ea7d3 ( Context * __context__ ) {
+    TTable<int32_t,int32_t> &  arg_a = cast_aot_arg<TTable<int32_t,int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickfinalizeTick5454204887383796109_95380cba065ea7d3(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickclearTick13739625760977891612_243ead22ad1f8cc7 ( Context * __context__ ) {
+    TTable<int32_t,int32_t> &  arg_t = cast_aot_arg<TTable<int32_t,int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickclearTick13739625760977891612_243ead22ad1f8cc7(__context__, arg_t);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktestTick959357854471906370_a315dcd8d21daa51 ( Context * __context__ ) {
+    CuckooHashMap_test const  &  arg_hmap = cast_aot_arg<CuckooHashMap_test const  & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> const  &  arg_randomNumbers = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTicktestTick959357854471906370_a315dcd8d21daa51(__context__, arg_hmap, arg_randomNumbers);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktestTick959357854471906370_d236172328a423c4 ( Context * __context__ ) {
+    FlatHashMap_test const  &  arg_hmap = cast_aot_arg<FlatHashMap_test const  & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> const  &  arg_randomNumbers = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTicktestTick959357854471906370_d236172328a423c4(__context__, arg_hmap, arg_randomNumbers);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktestTick959357854471906370_895c700f9ab84c84 ( Context * __context__ ) {
+    TTable<int32_t,int32_t> const  &  arg_hmap = cast_aot_arg<TTable<int32_t,int32_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> const  &  arg_randomNumbers = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTicktestTick959357854471906370_895c700f9ab84c84(__context__, arg_hmap, arg_randomNumbers);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickswapTick6899974565646937647_be90ed3cf37d2304 ( Context * __context__ ) {
+    TArray<KHV_CuckooHashMap_test> &  arg_a = cast_aot_arg<TArray<KHV_CuckooHashMap_test> & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<KHV_CuckooHashMap_test> &  arg_b = cast_aot_arg<TArray<KHV_CuckooHashMap_test> & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickswapTick6899974565646937647_be90ed3cf37d2304(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickfinalizeTick13836114024949725080_18bd418575e6a58b ( Context * __context__ ) {
+    TArray<KHV_CuckooHashMap_test> &  arg_a = cast_aot_arg<TArray<KHV_CuckooHashMap_test> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickfinalizeTick13836114024949725080_18bd418575e6a58b(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2 ( Context * __context__ ) {
+    int4 & arg_seed = cast_aot_arg<int4 &>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(_FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2(__context__, arg_seed));
+}
+static vec4f __wrap__FuncbuiltinTickswapTick6899974565646937647_49f11ecb3b5f1f0c ( Context * __context__ ) {
+    int32_t & arg_a = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg_b = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickswapTick6899974565646937647_49f11ecb3b5f1f0c(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickswapTick6899974565646937647_30e37cee9b54428 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> &  arg_b = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickswapTick6899974565646937647_30e37cee9b54428(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickswapTick6899974565646937647_9900bd8ba4ca7bc4 ( Context * __context__ ) {
+    TArray<uint64_t> &  arg_a = cast_aot_arg<TArray<uint64_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<uint64_t> &  arg_b = cast_aot_arg<TArray<uint64_t> & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickswapTick6899974565646937647_9900bd8ba4ca7bc4(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickfinalizeTick13836114024949725080_d4173cb732201230 ( Context * __context__ ) {
+    TArray<uint64_t> &  arg_a = cast_aot_arg<TArray<uint64_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickfinalizeTick13836114024949725080_d4173cb732201230(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__Func_frameworkTickprofile_testTick5073203596428633135_23a5bebf31de52f6 ( Context * __context__ ) {
+    char * const  arg_name = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    CuckooHashMap_test &  arg_hashMap = cast_aot_arg<CuckooHashMap_test & >::to(*__context__,__context__->abiArguments()[1]);
+    TArray<int32_t> const  &  arg_randomData = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[2]);
+    _Func_frameworkTickprofile_testTick5073203596428633135_23a5bebf31de52f6(__context__, arg_name, arg_hashMap, arg_randomData);
+    return v_zero();
+}
+static vec4f __wrap__Func_frameworkTickprofile_testTick5073203596428633135_bc99f09fb9433113 ( Context * __context__ ) {
+    char * const  arg_name = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    FlatHashMap_test &  arg_hashMap = cast_aot_arg<FlatHashMap_test & >::to(*__context__,__context__->abiArguments()[1]);
+    TArray<int32_t> const  &  arg_randomData = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[2]);
+    _Func_frameworkTickprofile_testTick5073203596428633135_bc99f09fb9433113(__context__, arg_name, arg_hashMap, arg_randomData);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_43427581878bd25b ( Context * __context__ ) {
+    TArray<KHV_CuckooHashMap_test> &  arg_Arr = cast_aot_arg<TArray<KHV_CuckooHashMap_test> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_43427581878bd25b(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__Funchash_mapTickhash0Tick16751248001345967464_a990528c5ef0c1ef ( Context * __context__ ) {
+    int32_t arg_k = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<uint64_t>::from(_Funchash_mapTickhash0Tick16751248001345967464_a990528c5ef0c1ef(__context__, arg_k));
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_5e7dacd12cf28329 ( Context * __context__ ) {
+    TArray<uint64_t> &  arg_Arr = cast_aot_arg<TArray<uint64_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_5e7dacd12cf28329(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__Func_frameworkTickprofile_testTick5073203596428633135_bdffbce04fd06cbe ( Context * __context__ ) {
+    char * const  arg_name = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    TTable<int32_t,int32_t> &  arg_hashMap = cast_aot_arg<TTable<int32_t,int32_t> & >::to(*__context__,__context__->abiArguments()[1]);
+    TArray<int32_t> const  &  arg_randomData = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[2]);
+    _Func_frameworkTickprofile_testTick5073203596428633135_bdffbce04fd06cbe(__context__, arg_name, arg_hashMap, arg_randomData);
+    return v_zero();
+}
+static vec4f __wrap_CuckooHashMap_test_cfa458a3ef36ab9a ( Context * __context__ ) {
+    int32_t arg_initialSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    *((CuckooHashMap_test *) __context__->abiCMRES) = CuckooHashMap_test_cfa458a3ef36ab9a(__context__, arg_initialSize);
+    return v_zero();
+}
+static vec4f __wrap_clear_d8da6b44af7728e9 ( Context * __context__ ) {
+    CuckooHashMap_test &  arg_self = cast_aot_arg<CuckooHashMap_test & >::to(*__context__,__context__->abiArguments()[0]);
+    clear_d8da6b44af7728e9(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap_grow_12af180565f61046 ( Context * __context__ ) {
+    CuckooHashMap_test &  arg_self = cast_aot_arg<CuckooHashMap_test & >::to(*__context__,__context__->abiArguments()[0]);
+    grow_12af180565f61046(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap_reserve_85a18fd1f1b9d0c2 ( Context * __context__ ) {
+    CuckooHashMap_test &  arg_self = cast_aot_arg<CuckooHashMap_test & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    reserve_85a18fd1f1b9d0c2(__context__, arg_self, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap_key_index_86093f7c0c6e917e ( Context * __context__ ) {
+    CuckooHashMap_test const  &  arg_self = cast_aot_arg<CuckooHashMap_test const  & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_key = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t>::from(key_index_86093f7c0c6e917e(__context__, arg_self, arg_key));
+}
+static vec4f __wrap_insert_751bae88bc2bd961 ( Context * __context__ ) {
+    CuckooHashMap_test &  arg_self = cast_aot_arg<CuckooHashMap_test & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg__key = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg__value = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    insert_751bae88bc2bd961(__context__, arg_self, arg__key, arg__value);
+    return v_zero();
+}
+static vec4f __wrap__FuncSqblSqbr_4d1f3255ca764598 ( Context * __context__ ) {
+    CuckooHashMap_test &  arg_self = cast_aot_arg<CuckooHashMap_test & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_key = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t &>::from(_FuncSqblSqbr_4d1f3255ca764598(__context__, arg_self, arg_key));
+}
+static vec4f __wrap_FlatHashMap_test_4120484e76bd54f5 ( Context * __context__ ) {
+    int32_t arg_initialSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    *((FlatHashMap_test *) __context__->abiCMRES) = FlatHashMap_test_4120484e76bd54f5(__context__, arg_initialSize);
+    return v_zero();
+}
+static vec4f __wrap_clear_367a56d37590b5c2 ( Context * __context__ ) {
+    FlatHashMap_test &  arg_self = cast_aot_arg<FlatHashMap_test & >::to(*__context__,__context__->abiArguments()[0]);
+    clear_367a56d37590b5c2(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap_grow_a727608138e89b7e ( Context * __context__ ) {
+    FlatHashMap_test &  arg_self = cast_aot_arg<FlatHashMap_test & >::to(*__context__,__context__->abiArguments()[0]);
+    grow_a727608138e89b7e(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap_rehash_97c44f23a92b4b1b ( Context * __context__ ) {
+    FlatHashMap_test &  arg_self = cast_aot_arg<FlatHashMap_test & >::to(*__context__,__context__->abiArguments()[0]);
+    rehash_97c44f23a92b4b1b(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap_reserve_a47dd681d55c37 ( Context * __context__ ) {
+    FlatHashMap_test &  arg_self = cast_aot_arg<FlatHashMap_test & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    reserve_a47dd681d55c37(__context__, arg_self, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncSqblSqbr_9b28e6df96a01a19 ( Context * __context__ ) {
+    FlatHashMap_test &  arg_self = cast_aot_arg<FlatHashMap_test & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_key = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t &>::from(_FuncSqblSqbr_9b28e6df96a01a19(__context__, arg_self, arg_key));
+}
+static vec4f __wrap_main_afe1773b7ff02b64 ( Context * __context__ ) {
+    main_afe1773b7ff02b64(__context__);
+    return v_zero();
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x4fff2f6cb6d47924, false, (void*)&finalize_e07eef0e281155e5, &__wrap_finalize_e07eef0e281155e5 },
+    { 0xdb86d5bd37da05a5, false, (void*)&finalize_c9b8a52bb6dcec7d, &__wrap_finalize_c9b8a52bb6dcec7d },
+    { 0x5529b94c7dbf7426, false, (void*)&finalize_15601d7edf896b06, &__wrap_finalize_15601d7edf896b06 },
+    { 0xf4fe2d8abea19ced, false, (void*)&_FuncbuiltinTickfinalizeTick5454204887383796109_95380cba065ea7d3, &__wrap__FuncbuiltinTickfinalizeTick5454204887383796109_95380cba065ea7d3 },
+    { 0xe2d393f70356a563, false, (void*)&_FuncbuiltinTickclearTick13739625760977891612_243ead22ad1f8cc7, &__wrap__FuncbuiltinTickclearTick13739625760977891612_243ead22ad1f8cc7 },
+    { 0x763bbf94e3deee10, false, (void*)&_FuncTicktestTick959357854471906370_a315dcd8d21daa51, &__wrap__FuncTicktestTick959357854471906370_a315dcd8d21daa51 },
+    { 0xc72a564cb7a83f5, false, (void*)&_FuncTicktestTick959357854471906370_d236172328a423c4, &__wrap__FuncTicktestTick959357854471906370_d236172328a423c4 },
+    { 0xd0da088e8d17b192, false, (void*)&_FuncTicktestTick959357854471906370_895c700f9ab84c84, &__wrap__FuncTicktestTick959357854471906370_895c700f9ab84c84 },
+    { 0xf8926f7866c14829, false, (void*)&_FuncbuiltinTickswapTick6899974565646937647_be90ed3cf37d2304, &__wrap__FuncbuiltinTickswapTick6899974565646937647_be90ed3cf37d2304 },
+    { 0xc222aeb42cfe11f8, false, (void*)&_FuncbuiltinTickfinalizeTick13836114024949725080_18bd418575e6a58b, &__wrap__FuncbuiltinTickfinalizeTick13836114024949725080_18bd418575e6a58b },
+    { 0xadb43fc11a384c17, false, (void*)&_FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2, &__wrap__FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2 },
+    { 0x26575e32d5c23260, false, (void*)&_FuncbuiltinTickswapTick6899974565646937647_49f11ecb3b5f1f0c, &__wrap__FuncbuiltinTickswapTick6899974565646937647_49f11ecb3b5f1f0c },
+    { 0xeb56ea4904494c06, false, (void*)&_FuncbuiltinTickswapTick6899974565646937647_30e37cee9b54428, &__wrap__FuncbuiltinTickswapTick6899974565646937647_30e37cee9b54428 },
+    { 0xeac0d45c7f615258, false, (void*)&_FuncbuiltinTickswapTick6899974565646937647_9900bd8ba4ca7bc4, &__wrap__FuncbuiltinTickswapTick6899974565646937647_9900bd8ba4ca7bc4 },
+    { 0x84908fa671ce3a30, false, (void*)&_FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd, &__wrap__FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd },
+    { 0xbe41af37454b960, false, (void*)&_FuncbuiltinTickfinalizeTick13836114024949725080_d4173cb732201230, &__wrap__FuncbuiltinTickfinalizeTick13836114024949725080_d4173cb732201230 },
+    { 0x3af0193ea21c9dc8, false, (void*)&_Func_frameworkTickprofile_testTick5073203596428633135_23a5bebf31de52f6, &__wrap__Func_frameworkTickprofile_testTick5073203596428633135_23a5bebf31de52f6 },
+    { 0x549caf8e5aba79c8, false, (void*)&_Func_frameworkTickprofile_testTick5073203596428633135_bc99f09fb9433113, &__wrap__Func_frameworkTickprofile_testTick5073203596428633135_bc99f09fb9433113 },
+    { 0xa4ebb0c25beefb09, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_43427581878bd25b, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_43427581878bd25b },
+    { 0xc8bdf63b6d9d363b, false, (void*)&_Funchash_mapTickhash0Tick16751248001345967464_a990528c5ef0c1ef, &__wrap__Funchash_mapTickhash0Tick16751248001345967464_a990528c5ef0c1ef },
+    { 0xa51a880d594e91fd, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c },
+    { 0x3ab8b3298f60fa49, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_5e7dacd12cf28329, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_5e7dacd12cf28329 },
+    { 0x3eefbced91d05922, false, (void*)&_Func_frameworkTickprofile_testTick5073203596428633135_bdffbce04fd06cbe, &__wrap__Func_frameworkTickprofile_testTick5073203596428633135_bdffbce04fd06cbe },
+    { 0xec7a40e56963bafd, true, (void*)&CuckooHashMap_test_cfa458a3ef36ab9a, &__wrap_CuckooHashMap_test_cfa458a3ef36ab9a },
+    { 0x6a41501aac18ed0b, false, (void*)&clear_d8da6b44af7728e9, &__wrap_clear_d8da6b44af7728e9 },
+    { 0x75097451863bee4c, false, (void*)&grow_12af180565f61046, &__wrap_grow_12af180565f61046 },
+    { 0x250c036ee7191305, false, (void*)&reserve_85a18fd1f1b9d0c2, &__wrap_reserve_85a18fd1f1b9d0c2 },
+    { 0x37ca2154a03fa414, false, (void*)&key_index_86093f7c0c6e917e, &__wrap_key_index_86093f7c0c6e917e },
+    { 0x82da73f6d74bc451, false, (void*)&insert_751bae88bc2bd961, &__wrap_insert_751bae88bc2bd961 },
+    { 0x1ee31ddae7235210, false, (void*)&_FuncSqblSqbr_4d1f3255ca764598, &__wrap__FuncSqblSqbr_4d1f3255ca764598 },
+    { 0xeddbe403f1302348, true, (void*)&FlatHashMap_test_4120484e76bd54f5, &__wrap_FlatHashMap_test_4120484e76bd54f5 },
+    { 0x3cf95296b6d7b4e9, false, (void*)&clear_367a56d37590b5c2, &__wrap_clear_367a56d37590b5c2 },
+    { 0x6b7d260af983d4c1, false, (void*)&grow_a727608138e89b7e, &__wrap_grow_a727608138e89b7e },
+    { 0xb098fb6b78655a53, false, (void*)&rehash_97c44f23a92b4b1b, &__wrap_rehash_97c44f23a92b4b1b },
+    { 0xbf06c3fd3375d42c, false, (void*)&reserve_a47dd681d55c37, &__wrap_reserve_a47dd681d55c37 },
+    { 0xf3601944b6be1a4e, false, (void*)&_FuncSqblSqbr_9b28e6df96a01a19, &__wrap__FuncSqblSqbr_9b28e6df96a01a19 },
+    { 0x3ab148e94b2eff95, false, (void*)&main_afe1773b7ff02b64, &__wrap_main_afe1773b7ff02b64 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x247ca0eeb7738af1, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_5392580973269650176
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -18,7 +18,7 @@ int main(int argc, char * argv[]) {
     vector<const char *> newArgv;
     newArgv.push_back(argv[0]);
     newArgv.push_back(dasRoot.c_str());
-    bool noJIT = false;
+    bool noJIT = true;
     for ( int i=1; i<argc; ++i ) {
         if ( strcmp(argv[i],"-html")==0 ) {
             noJIT = true;
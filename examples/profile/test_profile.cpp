@@ -4,6 +4,7 @@
 
 #include "daScript/daScript.h"
 #include "daScript/ast/ast_policy_types.h"
+#include "daScript/misc/job_que.h"
 
 #if defined(_MSC_VER) && defined(__clang__)
 #include <stdexcept>
@@ -934,6 +935,21 @@ void testTableSort ( TArray<int32_t> & tab ) {
     sort(begin, end, [&](int32_t a, int32_t b) { return a > b; });
 }
 
+// fine-grained parallel_for, each chunk does very little work so queue overhead dominates
+int64_t testJobQueParallelFor ( int32_t total, int32_t chunkCount ) {
+    static unique_ptr<JobQue> jq;
+    if ( !jq ) jq = make_unique<JobQue>();
+    vector<int64_t> partial(total);
+    jq->parallel_for(0, total, [&](int i0, int i1) {
+        for ( int i=i0; i<i1; ++i ) {
+            partial[i] = int64_t(i) * int64_t(i) % 7;
+        }
+    }, 0, JobPriority::Default, chunkCount);
+    int64_t sum = 0;
+    for ( auto p : partial ) sum += p;
+    return sum;
+}
+
 #define QUEEN_N 8
 
 bool isplaceok(int * a, int n, int c) {
@@ -1148,6 +1164,7 @@ public:
         addExtern<DAS_BIND_FUN(testTree)>(*this, lib, "testTree",SideEffects::modifyExternal,"testTree");
         addExtern<DAS_BIND_FUN(testMaxFrom1s)>(*this, lib, "testMaxFrom1s",SideEffects::modifyExternal,"testMaxFrom1s");
         addExtern<DAS_BIND_FUN(testTableSort)>(*this, lib, "testTableSort",SideEffects::modifyExternal,"testTableSort");
+        addExtern<DAS_BIND_FUN(testJobQueParallelFor)>(*this, lib, "testJobQueParallelFor",SideEffects::modifyExternal,"testJobQueParallelFor");
         addExtern<DAS_BIND_FUN(testQueens)>(*this, lib, "testQueens",SideEffects::modifyExternal,"testQueens");
         addExtern<DAS_BIND_FUN(testSnorm)>(*this, lib, "testSnorm",SideEffects::modifyExternal,"testSnorm");
         addExtern<DAS_BIND_FUN(testMandelbrot)>(*this, lib, "testMandelbrot",SideEffects::modifyExternal,"testMandelbrot");
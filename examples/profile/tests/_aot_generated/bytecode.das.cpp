@@ -0,0 +1,192 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require testProfile
+#include "test_profile.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require fio
+#include "daScript/misc/performance_time.h"
+#include "daScript/simulate/aot_builtin_fio.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_4807508020600451669 {
+
+namespace  { struct TestFile; };
+namespace fio { struct df_header; };
+// unused enumeration ConversionResult
+// unused structure df_header
+namespace  {
+
+struct TestFile {
+    char * luaFile;
+    char * luaJitFile;
+    char * luauFile;
+    char * nutFile;
+    char * nutModifiedFile;
+    char * asFile;
+    char * jsFile;
+    char * monoFile;
+    char * dotNetFile;
+};
+static_assert(sizeof(TestFile)==72,"structure size mismatch with DAS");
+static_assert(offsetof(TestFile,luaFile)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,luaJitFile)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,luauFile)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,nutFile)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,nutModifiedFile)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,asFile)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,jsFile)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,monoFile)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,dotNetFile)==64,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline int32_t _FuncTickfibITick8216366350413109863_bac5881d01a791a9 ( Context * __context__, int32_t __n_rename_at_12_0 );
+inline int32_t _FuncTickfibRTick13868665842688650599_82e8a55b375d413a ( Context * __context__, int32_t __n_rename_at_24_5 );
+inline float leibniz_9490bccdd208c9d1 ( Context * __context__, int32_t __n_rename_at_32_6 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t _FuncTickfibITick8216366350413109863_bac5881d01a791a9 ( Context * __context__, int32_t __n_rename_at_12_0 )
+{
+    int32_t __last_rename_at_13_1 = 1;
+    int32_t __cur_rename_at_14_2 = 0;
+    {
+        bool __need_loop_15 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(mk_range(__n_rename_at_12_0));
+        int32_t __i_rename_at_15_3;
+        __need_loop_15 = __i_iterator.first(__context__,(__i_rename_at_15_3)) && __need_loop_15;
+        for ( ; __need_loop_15 ; __need_loop_15 = __i_iterator.next(__context__,(__i_rename_at_15_3)) )
+        {
+            int32_t __tmp_rename_at_16_4 = ((int32_t)__cur_rename_at_14_2);
+            __cur_rename_at_14_2 += __last_rename_at_13_1;
+            das_copy(__last_rename_at_13_1,__tmp_rename_at_16_4);
+        }
+        __i_iterator.close(__context__,(__i_rename_at_15_3));
+    };
+    return das_auto_cast<int32_t>::cast(__cur_rename_at_14_2);
+}
+
+inline int32_t _FuncTickfibRTick13868665842688650599_82e8a55b375d413a ( Context * __context__, int32_t __n_rename_at_24_5 )
+{
+    return das_auto_cast<int32_t>::cast((__n_rename_at_24_5 < 2) ? das_auto_cast<int32_t>::cast(__n_rename_at_24_5) : das_auto_cast<int32_t>::cast((_FuncTickfibRTick13868665842688650599_82e8a55b375d413a(__context__,__n_rename_at_24_5 - 1) + _FuncTickfibRTick13868665842688650599_82e8a55b375d413a(__context__,__n_rename_at_24_5 - 2))));
+}
+
+inline float leibniz_9490bccdd208c9d1 ( Context * __context__, int32_t __n_rename_at_32_6 )
+{
+    float __s_rename_at_33_7 = 0.000000e+00f;
+    float __sign_rename_at_34_8 = 1.000000e+00f;
+    {
+        bool __need_loop_35 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(mk_range(__n_rename_at_32_6));
+        int32_t __i_rename_at_35_9;
+        __need_loop_35 = __i_iterator.first(__context__,(__i_rename_at_35_9)) && __need_loop_35;
+        for ( ; __need_loop_35 ; __need_loop_35 = __i_iterator.next(__context__,(__i_rename_at_35_9)) )
+        {
+            __s_rename_at_33_7 += (SimPolicy<float>::Div(__sign_rename_at_34_8,float((__i_rename_at_35_9 * 2) + 1),*__context__,nullptr));
+            das_copy(__sign_rename_at_34_8,-__sign_rename_at_34_8);
+        }
+        __i_iterator.close(__context__,(__i_rename_at_35_9));
+    };
+    return das_auto_cast<float>::cast(__s_rename_at_33_7 * 4.000000e+00f);
+}
+static vec4f __wrap__FuncTickfibITick8216366350413109863_bac5881d01a791a9 ( Context * __context__ ) {
+    int32_t arg_n = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(_FuncTickfibITick8216366350413109863_bac5881d01a791a9(__context__, arg_n));
+}
+static vec4f __wrap__FuncTickfibRTick13868665842688650599_82e8a55b375d413a ( Context * __context__ ) {
+    int32_t arg_n = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(_FuncTickfibRTick13868665842688650599_82e8a55b375d413a(__context__, arg_n));
+}
+static vec4f __wrap_leibniz_9490bccdd208c9d1 ( Context * __context__ ) {
+    int32_t arg_n = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<float>::from(leibniz_9490bccdd208c9d1(__context__, arg_n));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xac31e4d75f5d8bc7, false, (void*)&_FuncTickfibITick8216366350413109863_bac5881d01a791a9, &__wrap__FuncTickfibITick8216366350413109863_bac5881d01a791a9 },
+    { 0xd71e6f3a1b8cf53e, false, (void*)&_FuncTickfibRTick13868665842688650599_82e8a55b375d413a, &__wrap__FuncTickfibRTick13868665842688650599_82e8a55b375d413a },
+    { 0xe0640c183e9ab4d0, false, (void*)&leibniz_9490bccdd208c9d1, &__wrap_leibniz_9490bccdd208c9d1 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_4807508020600451669
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
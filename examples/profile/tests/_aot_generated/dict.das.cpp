@@ -0,0 +1,303 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require testProfile
+#include "test_profile.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require fio
+#include "daScript/misc/performance_time.h"
+#include "daScript/simulate/aot_builtin_fio.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_16799402674584108402 {
+
+namespace  { struct TestFile; };
+namespace fio { struct df_header; };
+// unused enumeration ConversionResult
+// unused structure df_header
+namespace  {
+
+struct TestFile {
+    char * luaFile;
+    char * luaJitFile;
+    char * luauFile;
+    char * nutFile;
+    char * nutModifiedFile;
+    char * asFile;
+    char * jsFile;
+    char * monoFile;
+    char * dotNetFile;
+};
+static_assert(sizeof(TestFile)==72,"structure size mismatch with DAS");
+static_assert(offsetof(TestFile,luaFile)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,luaJitFile)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,luauFile)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,nutFile)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,nutModifiedFile)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,asFile)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,jsFile)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,monoFile)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,dotNetFile)==64,"structure field offset mismatch with DAS");
+}
+extern TypeInfo __type_info__af96fe4c8658cf52;
+
+TypeInfo __type_info__af96fe4c8658cf52 = { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf96fe4c8658cf52) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__af96fe4c8658cf52 };
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__, TArray<uint8_t> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009 ( Context * __context__, TArray<char *> & __Arr_rename_at_68_2, int32_t __newSize_rename_at_68_3 );
+inline void _FuncbuiltinTickclearTick13739625760977891612_4485c3c006df174e ( Context * __context__, TTable<char *,int32_t> & __t_rename_at_2083_4 );
+inline bool _FuncbuiltinTickkey_existsTick16808803843923989214_8d6aa4fe1fff2b7e ( Context * __context__, TTable<char *,int32_t> const  & __Tab_rename_at_1040_5, char * const  __at_rename_at_1040_6 );
+inline void _FuncbuiltinTickinsertTick12964066441666329206_2882a6217bcc1a60 ( Context * __context__, TTable<char *,int32_t> & __Tab_rename_at_869_7, char * const  __at_rename_at_869_8, int32_t __val_rename_at_869_9 );
+inline void makeRandomSequence_a4e917956bab5d86 ( Context * __context__, TArray<char *> & __src_rename_at_12_44 );
+inline int32_t dict_48175429229c661e ( Context * __context__, TTable<char *,int32_t> & __tab_rename_at_22_47, TArray<char *> const  & __src_rename_at_22_48 );
+inline int32_t lookup_946a70755dda2e44 ( Context * __context__, TTable<char *,int32_t> const  & __tab_rename_at_31_51, TArray<char *> const  & __src_rename_at_31_52 );
+inline TArray<uint8_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__, TDim<uint8_t,3> & __a_rename_at_1502_63 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    TArray<uint8_t> _temp_make_local_35_22_0;
+    TDim<uint8_t,3> _temp_make_local_35_22_1;
+    das_global<char *,0x371f085ff8ea14fe>(__context__) = ((char * const )(builtin_string_from_array(das_arg<TArray<uint8_t>>::pass((_temp_make_local_35_22_0 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4(__context__,das_arg<TDim<uint8_t,3>>::pass((([&]() -> TDim<uint8_t,3>& {
+        _temp_make_local_35_22_1(0,__context__) = 0xef;
+        _temp_make_local_35_22_1(1,__context__) = 0xbb;
+        _temp_make_local_35_22_1(2,__context__) = 0xbf;
+        return _temp_make_local_35_22_1;
+    })())))))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));/*ENCODING*/
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__, TArray<uint8_t> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<uint8_t>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,1,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009 ( Context * __context__, TArray<char *> &  __Arr_rename_at_68_2, int32_t __newSize_rename_at_68_3 )
+{
+    builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_68_2),__newSize_rename_at_68_3,8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickclearTick13739625760977891612_4485c3c006df174e ( Context * __context__, TTable<char *,int32_t> &  __t_rename_at_2083_4 )
+{
+    builtin_table_clear(das_arg<TTable<char *,int32_t>>::pass(__t_rename_at_2083_4),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline bool _FuncbuiltinTickkey_existsTick16808803843923989214_8d6aa4fe1fff2b7e ( Context * __context__, TTable<char *,int32_t> const  &  __Tab_rename_at_1040_5, char * const  __at_rename_at_1040_6 )
+{
+    return das_auto_cast<bool>::cast(__builtin_table_key_exists(__context__,__Tab_rename_at_1040_5,__at_rename_at_1040_6));
+}
+
+inline void _FuncbuiltinTickinsertTick12964066441666329206_2882a6217bcc1a60 ( Context * __context__, TTable<char *,int32_t> &  __Tab_rename_at_869_7, char * const  __at_rename_at_869_8, int32_t __val_rename_at_869_9 )
+{
+    das_copy(__Tab_rename_at_869_7(__at_rename_at_869_8,__context__),__val_rename_at_869_9);
+}
+
+inline void makeRandomSequence_a4e917956bab5d86 ( Context * __context__, TArray<char *> &  __src_rename_at_12_44 )
+{
+    _FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009(__context__,das_arg<TArray<char *>>::pass(__src_rename_at_12_44),500000);
+    {
+        bool __need_loop_16 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(0,500000));
+        int32_t __i_rename_at_16_45;
+        __need_loop_16 = __i_iterator.first(__context__,(__i_rename_at_16_45)) && __need_loop_16;
+        for ( ; __need_loop_16 ; __need_loop_16 = __i_iterator.next(__context__,(__i_rename_at_16_45)) )
+        {
+            uint32_t __num_rename_at_17_46 = ((uint32_t)(SimPolicy<uint32_t>::Mod((0x1033c4d7u ^ uint32_t(__i_rename_at_16_45 * 119)),0x7a120u,*__context__,nullptr)));
+            das_copy(__src_rename_at_12_44(__i_rename_at_16_45,__context__),das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<uint32_t>::from(__num_rename_at_17_46))));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_16_45));
+    };
+}
+
+inline int32_t dict_48175429229c661e ( Context * __context__, TTable<char *,int32_t> &  __tab_rename_at_22_47, TArray<char *> const  &  __src_rename_at_22_48 )
+{
+    _FuncbuiltinTickclearTick13739625760977891612_4485c3c006df174e(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_22_47));
+    int32_t __maxOcc_rename_at_24_49 = 0;
+    {
+        bool __need_loop_25 = true;
+        // s: string const&
+        das_iterator<TArray<char *> const > __s_iterator(__src_rename_at_22_48);
+        char * const  * __s_rename_at_25_50;
+        __need_loop_25 = __s_iterator.first(__context__,(__s_rename_at_25_50)) && __need_loop_25;
+        for ( ; __need_loop_25 ; __need_loop_25 = __s_iterator.next(__context__,(__s_rename_at_25_50)) )
+        {
+            das_copy(__maxOcc_rename_at_24_49,SimPolicy<int32_t>::Max(++__tab_rename_at_22_47((*__s_rename_at_25_50),__context__),__maxOcc_rename_at_24_49,*__context__,nullptr));
+        }
+        __s_iterator.close(__context__,(__s_rename_at_25_50));
+    };
+    return das_auto_cast<int32_t>::cast(__maxOcc_rename_at_24_49);
+}
+
+inline int32_t lookup_946a70755dda2e44 ( Context * __context__, TTable<char *,int32_t> const  &  __tab_rename_at_31_51, TArray<char *> const  &  __src_rename_at_31_52 )
+{
+    int32_t __found_rename_at_32_53 = 0;
+    {
+        bool __need_loop_33 = true;
+        // s: string const&
+        das_iterator<TArray<char *> const > __s_iterator(__src_rename_at_31_52);
+        char * const  * __s_rename_at_33_54;
+        __need_loop_33 = __s_iterator.first(__context__,(__s_rename_at_33_54)) && __need_loop_33;
+        for ( ; __need_loop_33 ; __need_loop_33 = __s_iterator.next(__context__,(__s_rename_at_33_54)) )
+        {
+            if ( _FuncbuiltinTickkey_existsTick16808803843923989214_8d6aa4fe1fff2b7e(__context__,__tab_rename_at_31_51,(*__s_rename_at_33_54)) )
+            {
+                ++__found_rename_at_32_53;
+            };
+        }
+        __s_iterator.close(__context__,(__s_rename_at_33_54));
+    };
+    return das_auto_cast<int32_t>::cast(__found_rename_at_32_53);
+}
+
+inline TArray<uint8_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__, TDim<uint8_t,3> &  __a_rename_at_1502_63 )
+{
+    TArray<uint8_t> __arr_rename_at_1504_64;das_zero(__arr_rename_at_1504_64);
+    _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111(__context__,das_arg<TArray<uint8_t>>::pass(__arr_rename_at_1504_64),3);
+    das_copy(das_cast<TDim<uint8_t,3>>::cast(das_ref(__context__,__arr_rename_at_1504_64(0,__context__))),__a_rename_at_1502_63);
+    return /* <- */ das_auto_cast_move<TArray<uint8_t>>::cast(__arr_rename_at_1504_64);
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__ ) {
+    TArray<uint8_t> &  arg_Arr = cast_aot_arg<TArray<uint8_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009 ( Context * __context__ ) {
+    TArray<char *> &  arg_Arr = cast_aot_arg<TArray<char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickclearTick13739625760977891612_4485c3c006df174e ( Context * __context__ ) {
+    TTable<char *,int32_t> &  arg_t = cast_aot_arg<TTable<char *,int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickclearTick13739625760977891612_4485c3c006df174e(__context__, arg_t);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickkey_existsTick16808803843923989214_8d6aa4fe1fff2b7e ( Context * __context__ ) {
+    TTable<char *,int32_t> const  &  arg_Tab = cast_aot_arg<TTable<char *,int32_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_at = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_FuncbuiltinTickkey_existsTick16808803843923989214_8d6aa4fe1fff2b7e(__context__, arg_Tab, arg_at));
+}
+static vec4f __wrap__FuncbuiltinTickinsertTick12964066441666329206_2882a6217bcc1a60 ( Context * __context__ ) {
+    TTable<char *,int32_t> &  arg_Tab = cast_aot_arg<TTable<char *,int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_at = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_val = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    _FuncbuiltinTickinsertTick12964066441666329206_2882a6217bcc1a60(__context__, arg_Tab, arg_at, arg_val);
+    return v_zero();
+}
+static vec4f __wrap_makeRandomSequence_a4e917956bab5d86 ( Context * __context__ ) {
+    TArray<char *> &  arg_src = cast_aot_arg<TArray<char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    makeRandomSequence_a4e917956bab5d86(__context__, arg_src);
+    return v_zero();
+}
+static vec4f __wrap_dict_48175429229c661e ( Context * __context__ ) {
+    TTable<char *,int32_t> &  arg_tab = cast_aot_arg<TTable<char *,int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<char *> const  &  arg_src = cast_aot_arg<TArray<char *> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t>::from(dict_48175429229c661e(__context__, arg_tab, arg_src));
+}
+static vec4f __wrap_lookup_946a70755dda2e44 ( Context * __context__ ) {
+    TTable<char *,int32_t> const  &  arg_tab = cast_aot_arg<TTable<char *,int32_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<char *> const  &  arg_src = cast_aot_arg<TArray<char *> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t>::from(lookup_946a70755dda2e44(__context__, arg_tab, arg_src));
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__ ) {
+    TDim<uint8_t,3> &  arg_a = cast_aot_arg<TDim<uint8_t,3> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<uint8_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x43319db4719733d6, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 },
+    { 0xedd3c4f89cba620e, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009 },
+    { 0x5206590b7bfea7a0, false, (void*)&_FuncbuiltinTickclearTick13739625760977891612_4485c3c006df174e, &__wrap__FuncbuiltinTickclearTick13739625760977891612_4485c3c006df174e },
+    { 0x4341c462e0e8bbda, false, (void*)&_FuncbuiltinTickkey_existsTick16808803843923989214_8d6aa4fe1fff2b7e, &__wrap__FuncbuiltinTickkey_existsTick16808803843923989214_8d6aa4fe1fff2b7e },
+    { 0xfd925afa569cfe89, false, (void*)&_FuncbuiltinTickinsertTick12964066441666329206_2882a6217bcc1a60, &__wrap__FuncbuiltinTickinsertTick12964066441666329206_2882a6217bcc1a60 },
+    { 0xb2ec375071bbd320, false, (void*)&makeRandomSequence_a4e917956bab5d86, &__wrap_makeRandomSequence_a4e917956bab5d86 },
+    { 0x1ab2afded8492707, false, (void*)&dict_48175429229c661e, &__wrap_dict_48175429229c661e },
+    { 0xc1177855f341b963, false, (void*)&lookup_946a70755dda2e44, &__wrap_lookup_946a70755dda2e44 },
+    { 0x60b407c06982729e, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x75681567dc465460, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_16799402674584108402
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,195 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require testProfile
+#include "test_profile.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require fio
+#include "daScript/misc/performance_time.h"
+#include "daScript/simulate/aot_builtin_fio.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_11224492196837083980 {
+
+namespace  { struct TestFile; };
+namespace fio { struct df_header; };
+// unused enumeration ConversionResult
+// unused structure df_header
+namespace  {
+
+struct TestFile {
+    char * luaFile;
+    char * luaJitFile;
+    char * luauFile;
+    char * nutFile;
+    char * nutModifiedFile;
+    char * asFile;
+    char * jsFile;
+    char * monoFile;
+    char * dotNetFile;
+};
+static_assert(sizeof(TestFile)==72,"structure size mismatch with DAS");
+static_assert(offsetof(TestFile,luaFile)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,luaJitFile)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,luauFile)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,nutFile)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,nutModifiedFile)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,asFile)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,jsFile)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,monoFile)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,dotNetFile)==64,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__, TArray<uint8_t> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline int32_t _FuncTickfibITick8216366350413109863_5defaf38fbe3c7d4 ( Context * __context__, int32_t __n_rename_at_9_2 );
+inline TArray<uint8_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__, TDim<uint8_t,3> & __a_rename_at_1502_43 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    TArray<uint8_t> _temp_make_local_35_22_0;
+    TDim<uint8_t,3> _temp_make_local_35_22_1;
+    das_global<char *,0x371f085ff8ea14fe>(__context__) = ((char * const )(builtin_string_from_array(das_arg<TArray<uint8_t>>::pass((_temp_make_local_35_22_0 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4(__context__,das_arg<TDim<uint8_t,3>>::pass((([&]() -> TDim<uint8_t,3>& {
+        _temp_make_local_35_22_1(0,__context__) = 0xef;
+        _temp_make_local_35_22_1(1,__context__) = 0xbb;
+        _temp_make_local_35_22_1(2,__context__) = 0xbf;
+        return _temp_make_local_35_22_1;
+    })())))))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));/*ENCODING*/
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__, TArray<uint8_t> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<uint8_t>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,1,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline int32_t _FuncTickfibITick8216366350413109863_5defaf38fbe3c7d4 ( Context * __context__, int32_t __n_rename_at_9_2 )
+{
+    int32_t __last_rename_at_10_3 = 1;
+    int32_t __cur_rename_at_11_4 = 0;
+    {
+        bool __need_loop_12 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(mk_range(__n_rename_at_9_2));
+        int32_t __i_rename_at_12_5;
+        __need_loop_12 = __i_iterator.first(__context__,(__i_rename_at_12_5)) && __need_loop_12;
+        for ( ; __need_loop_12 ; __need_loop_12 = __i_iterator.next(__context__,(__i_rename_at_12_5)) )
+        {
+            int32_t __tmp_rename_at_13_6 = ((int32_t)__cur_rename_at_11_4);
+            __cur_rename_at_11_4 += __last_rename_at_10_3;
+            das_copy(__last_rename_at_10_3,__tmp_rename_at_13_6);
+        }
+        __i_iterator.close(__context__,(__i_rename_at_12_5));
+    };
+    return das_auto_cast<int32_t>::cast(__cur_rename_at_11_4);
+}
+
+inline TArray<uint8_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__, TDim<uint8_t,3> &  __a_rename_at_1502_43 )
+{
+    TArray<uint8_t> __arr_rename_at_1504_44;das_zero(__arr_rename_at_1504_44);
+    _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111(__context__,das_arg<TArray<uint8_t>>::pass(__arr_rename_at_1504_44),3);
+    das_copy(das_cast<TDim<uint8_t,3>>::cast(das_ref(__context__,__arr_rename_at_1504_44(0,__context__))),__a_rename_at_1502_43);
+    return /* <- */ das_auto_cast_move<TArray<uint8_t>>::cast(__arr_rename_at_1504_44);
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__ ) {
+    TArray<uint8_t> &  arg_Arr = cast_aot_arg<TArray<uint8_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickfibITick8216366350413109863_5defaf38fbe3c7d4 ( Context * __context__ ) {
+    int32_t arg_n = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(_FuncTickfibITick8216366350413109863_5defaf38fbe3c7d4(__context__, arg_n));
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__ ) {
+    TDim<uint8_t,3> &  arg_a = cast_aot_arg<TDim<uint8_t,3> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<uint8_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x43319db4719733d6, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 },
+    { 0x2c6af500dc8351, false, (void*)&_FuncTickfibITick8216366350413109863_5defaf38fbe3c7d4, &__wrap__FuncTickfibITick8216366350413109863_5defaf38fbe3c7d4 },
+    { 0x60b407c06982729e, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x75681567dc465460, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_11224492196837083980
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,177 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require testProfile
+#include "test_profile.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require fio
+#include "daScript/misc/performance_time.h"
+#include "daScript/simulate/aot_builtin_fio.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_2022044727706755787 {
+
+namespace  { struct TestFile; };
+namespace  { struct Particle; };
+namespace fio { struct df_header; };
+// unused enumeration ConversionResult
+// unused structure df_header
+namespace  {
+
+struct TestFile {
+    char * luaFile;
+    char * luaJitFile;
+    char * luauFile;
+    char * nutFile;
+    char * nutModifiedFile;
+    char * asFile;
+    char * jsFile;
+    char * monoFile;
+    char * dotNetFile;
+};
+static_assert(sizeof(TestFile)==72,"structure size mismatch with DAS");
+static_assert(offsetof(TestFile,luaFile)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,luaJitFile)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,luauFile)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,nutFile)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,nutModifiedFile)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,asFile)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,jsFile)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,monoFile)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,dotNetFile)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Particle {
+    float3 pos;
+    float3 vel;
+    float mass;
+};
+static_assert(sizeof(Particle)==28,"structure size mismatch with DAS");
+static_assert(offsetof(Particle,pos)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Particle,vel)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(Particle,mass)==24,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline float lerp1_c15e2bc497f23315 ( Context * __context__, float __a_rename_at_19_0, float __b_rename_at_19_1, float __t_rename_at_19_2 );
+inline float energy_a83be30c2d3cb53e ( Context * __context__, Particle const  & __p_rename_at_23_3 );
+inline float dist_sq_b84fececccfe1ee2 ( Context * __context__, float3 __a_rename_at_27_4, float3 __b_rename_at_27_5 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline float lerp1_c15e2bc497f23315 ( Context * __context__, float __a_rename_at_19_0, float __b_rename_at_19_1, float __t_rename_at_19_2 )
+{
+    return das_auto_cast<float>::cast(__a_rename_at_19_0 + ((__b_rename_at_19_1 - __a_rename_at_19_0) * __t_rename_at_19_2));
+}
+
+inline float energy_a83be30c2d3cb53e ( Context * __context__, Particle const  &  __p_rename_at_23_3 )
+{
+    return das_auto_cast<float>::cast((__p_rename_at_23_3.mass * 5.000000e-01f) * dot3(__p_rename_at_23_3.vel,__p_rename_at_23_3.vel));
+}
+
+inline float dist_sq_b84fececccfe1ee2 ( Context * __context__, float3 __a_rename_at_27_4, float3 __b_rename_at_27_5 )
+{
+    return das_auto_cast<float>::cast(dot3(SimPolicy<float3>::Sub(__a_rename_at_27_4,__b_rename_at_27_5,*__context__,nullptr),SimPolicy<float3>::Sub(__a_rename_at_27_4,__b_rename_at_27_5,*__context__,nullptr)));
+}
+static vec4f __wrap_lerp1_c15e2bc497f23315 ( Context * __context__ ) {
+    float arg_a = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[0]);
+    float arg_b = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[1]);
+    float arg_t = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[2]);
+    return cast<float>::from(lerp1_c15e2bc497f23315(__context__, arg_a, arg_b, arg_t));
+}
+static vec4f __wrap_energy_a83be30c2d3cb53e ( Context * __context__ ) {
+    Particle const  &  arg_p = cast_aot_arg<Particle const  & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<float>::from(energy_a83be30c2d3cb53e(__context__, arg_p));
+}
+static vec4f __wrap_dist_sq_b84fececccfe1ee2 ( Context * __context__ ) {
+    float3 arg_a = cast_aot_arg<float3>::to(*__context__,__context__->abiArguments()[0]);
+    float3 arg_b = cast_aot_arg<float3>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<float>::from(dist_sq_b84fececccfe1ee2(__context__, arg_a, arg_b));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x3fd36fb57f638c08, false, (void*)&lerp1_c15e2bc497f23315, &__wrap_lerp1_c15e2bc497f23315 },
+    { 0x883ec07d6d168fae, false, (void*)&energy_a83be30c2d3cb53e, &__wrap_energy_a83be30c2d3cb53e },
+    { 0xbba01713fc53e99f, false, (void*)&dist_sq_b84fececccfe1ee2, &__wrap_dist_sq_b84fececccfe1ee2 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_2022044727706755787
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,169 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require testProfile
+#include "test_profile.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require fio
+#include "daScript/misc/performance_time.h"
+#include "daScript/simulate/aot_builtin_fio.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_7491176454284517774 {
+
+namespace  { struct TestFile; };
+namespace fio { struct df_header; };
+// unused enumeration ConversionResult
+// unused structure df_header
+namespace  {
+
+struct TestFile {
+    char * luaFile;
+    char * luaJitFile;
+    char * luauFile;
+    char * nutFile;
+    char * nutModifiedFile;
+    char * asFile;
+    char * jsFile;
+    char * monoFile;
+    char * dotNetFile;
+};
+static_assert(sizeof(TestFile)==72,"structure size mismatch with DAS");
+static_assert(offsetof(TestFile,luaFile)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,luaJitFile)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,luauFile)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,nutFile)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,nutModifiedFile)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,asFile)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,jsFile)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,monoFile)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,dotNetFile)==64,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void on_event_a_a8a9c9eb1899b155 ( Context * __context__, int32_t __x_rename_at_14_0 );
+inline void on_event_b_a4feecd6919c293c ( Context * __context__, int32_t __x_rename_at_19_1 );
+inline void dispatch_e41ede7ebc3d3850 ( Context * __context__, char * const  __name_rename_at_23_2 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global<int32_t,0x3a129c39e73e48a6>(__context__) = 0;/*counter*/
+}
+
+inline void on_event_a_a8a9c9eb1899b155 ( Context * __context__, int32_t __x_rename_at_14_0 )
+{
+    das_global<int32_t,0x3a129c39e73e48a6>(__context__) /*counter*/ += __x_rename_at_14_0;
+}
+
+inline void on_event_b_a4feecd6919c293c ( Context * __context__, int32_t __x_rename_at_19_1 )
+{
+    das_global<int32_t,0x3a129c39e73e48a6>(__context__) /*counter*/ -= __x_rename_at_19_1;
+}
+
+inline void dispatch_e41ede7ebc3d3850 ( Context * __context__, char * const  __name_rename_at_23_2 )
+{
+    das_invoke_function_by_name<void>::invoke<int32_t>(__context__,nullptr,__name_rename_at_23_2,1);
+}
+static vec4f __wrap_on_event_a_a8a9c9eb1899b155 ( Context * __context__ ) {
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    on_event_a_a8a9c9eb1899b155(__context__, arg_x);
+    return v_zero();
+}
+static vec4f __wrap_on_event_b_a4feecd6919c293c ( Context * __context__ ) {
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    on_event_b_a4feecd6919c293c(__context__, arg_x);
+    return v_zero();
+}
+static vec4f __wrap_dispatch_e41ede7ebc3d3850 ( Context * __context__ ) {
+    char * const  arg_name = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    dispatch_e41ede7ebc3d3850(__context__, arg_name);
+    return v_zero();
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xa96448c9f68bfb10, false, (void*)&on_event_a_a8a9c9eb1899b155, &__wrap_on_event_a_a8a9c9eb1899b155 },
+    { 0x54a34429892febc3, false, (void*)&on_event_b_a4feecd6919c293c, &__wrap_on_event_b_a4feecd6919c293c },
+    { 0xe11ff4080e465d51, false, (void*)&dispatch_e41ede7ebc3d3850, &__wrap_dispatch_e41ede7ebc3d3850 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x58f101d00d10103, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_7491176454284517774
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,227 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require testProfile
+#include "test_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require fio
+#include "daScript/misc/performance_time.h"
+#include "daScript/simulate/aot_builtin_fio.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_4657231949312272786 {
+
+namespace  { struct TestFile; };
+namespace fio { struct df_header; };
+// unused enumeration ConversionResult
+// unused structure df_header
+namespace  {
+
+struct TestFile {
+    char * luaFile;
+    char * luaJitFile;
+    char * luauFile;
+    char * nutFile;
+    char * nutModifiedFile;
+    char * asFile;
+    char * jsFile;
+    char * monoFile;
+    char * dotNetFile;
+};
+static_assert(sizeof(TestFile)==72,"structure size mismatch with DAS");
+static_assert(offsetof(TestFile,luaFile)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,luaJitFile)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,luauFile)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,nutFile)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,nutModifiedFile)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,asFile)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,jsFile)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,monoFile)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,dotNetFile)==64,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__, TArray<uint8_t> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline int32_t level_d546958fb18dc851 ( Context * __context__, float2 __c_rename_at_10_36 );
+inline int32_t test_322d115668b98ffb ( Context * __context__ );
+inline TArray<uint8_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__, TDim<uint8_t,3> & __a_rename_at_1502_44 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    TArray<uint8_t> _temp_make_local_35_22_0;
+    TDim<uint8_t,3> _temp_make_local_35_22_1;
+    das_global<char *,0x371f085ff8ea14fe>(__context__) = ((char * const )(builtin_string_from_array(das_arg<TArray<uint8_t>>::pass((_temp_make_local_35_22_0 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4(__context__,das_arg<TDim<uint8_t,3>>::pass((([&]() -> TDim<uint8_t,3>& {
+        _temp_make_local_35_22_1(0,__context__) = 0xef;
+        _temp_make_local_35_22_1(1,__context__) = 0xbb;
+        _temp_make_local_35_22_1(2,__context__) = 0xbf;
+        return _temp_make_local_35_22_1;
+    })())))))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));/*ENCODING*/
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__, TArray<uint8_t> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<uint8_t>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,1,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline int32_t level_d546958fb18dc851 ( Context * __context__, float2 __c_rename_at_10_36 )
+{
+    int32_t __l_rename_at_11_37 = 0;
+    float2 __z_rename_at_12_38 = __c_rename_at_10_36;
+    while ( (length2(__z_rename_at_12_38) < 2.000000e+00f) && (__l_rename_at_11_37 < 255) )
+    {
+        das_copy(__z_rename_at_12_38,SimPolicy<float2>::Add(float2((v_extract_x(__z_rename_at_12_38) /*x*/ * v_extract_x(__z_rename_at_12_38) /*x*/) - (v_extract_y(__z_rename_at_12_38) /*y*/ * v_extract_y(__z_rename_at_12_38) /*y*/),(v_extract_x(__z_rename_at_12_38) /*x*/ * v_extract_y(__z_rename_at_12_38) /*y*/) + (v_extract_y(__z_rename_at_12_38) /*y*/ * v_extract_x(__z_rename_at_12_38) /*x*/)),__c_rename_at_10_36,*__context__,nullptr));
+        ++__l_rename_at_11_37;
+    };
+    return das_auto_cast<int32_t>::cast(__l_rename_at_11_37 - 1);
+}
+
+inline int32_t test_322d115668b98ffb ( Context * __context__ )
+{
+    float __ymin_rename_at_24_39 = ((float)-2.000000e+00f);
+    int32_t __S_rename_at_29_40 = 0;
+    float2 __xy_rename_at_30_41 = v_splats(-2.000000e+00f);
+    {
+        bool __need_loop_31 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(0,64));
+        int32_t __i_rename_at_31_42;
+        __need_loop_31 = __i_iterator.first(__context__,(__i_rename_at_31_42)) && __need_loop_31;
+        for ( ; __need_loop_31 ; __need_loop_31 = __i_iterator.next(__context__,(__i_rename_at_31_42)) )
+        {
+            das_copy(das_swizzle_ref<float,float2,1>::swizzle(__xy_rename_at_30_41) /*y*/,__ymin_rename_at_24_39);
+            {
+                bool __need_loop_33 = true;
+                // j: int const
+                das_iterator<range> __j_iterator(range(0,64));
+                int32_t __j_rename_at_33_43;
+                __need_loop_33 = __j_iterator.first(__context__,(__j_rename_at_33_43)) && __need_loop_33;
+                for ( ; __need_loop_33 ; __need_loop_33 = __j_iterator.next(__context__,(__j_rename_at_33_43)) )
+                {
+                    __S_rename_at_29_40 += level_d546958fb18dc851(__context__,__xy_rename_at_30_41);
+                    das_swizzle_ref<float,float2,1>::swizzle(__xy_rename_at_30_41) /*y*/ += 6.250000e-02f;
+                }
+                __j_iterator.close(__context__,(__j_rename_at_33_43));
+            };
+            das_swizzle_ref<float,float2,0>::swizzle(__xy_rename_at_30_41) /*x*/ += 6.250000e-02f;
+        }
+        __i_iterator.close(__context__,(__i_rename_at_31_42));
+    };
+    return das_auto_cast<int32_t>::cast(__S_rename_at_29_40);
+}
+
+inline TArray<uint8_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__, TDim<uint8_t,3> &  __a_rename_at_1502_44 )
+{
+    TArray<uint8_t> __arr_rename_at_1504_45;das_zero(__arr_rename_at_1504_45);
+    _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111(__context__,das_arg<TArray<uint8_t>>::pass(__arr_rename_at_1504_45),3);
+    das_copy(das_cast<TDim<uint8_t,3>>::cast(das_ref(__context__,__arr_rename_at_1504_45(0,__context__))),__a_rename_at_1502_44);
+    return /* <- */ das_auto_cast_move<TArray<uint8_t>>::cast(__arr_rename_at_1504_45);
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__ ) {
+    TArray<uint8_t> &  arg_Arr = cast_aot_arg<TArray<uint8_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap_level_d546958fb18dc851 ( Context * __context__ ) {
+    float2 arg_c = cast_aot_arg<float2>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(level_d546958fb18dc851(__context__, arg_c));
+}
+static vec4f __wrap_test_322d115668b98ffb ( Context * __context__ ) {
+    return cast<int32_t>::from(test_322d115668b98ffb(__context__));
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__ ) {
+    TDim<uint8_t,3> &  arg_a = cast_aot_arg<TDim<uint8_t,3> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<uint8_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x43319db4719733d6, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 },
+    { 0xc91ee7af2cde5aa, false, (void*)&level_d546958fb18dc851, &__wrap_level_d546958fb18dc851 },
+    { 0xd6c245687078858, false, (void*)&test_322d115668b98ffb, &__wrap_test_322d115668b98ffb },
+    { 0x60b407c06982729e, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x75681567dc465460, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_4657231949312272786
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,569 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require testProfile
+#include "test_profile.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require network
+#include "daScript/simulate/aot_builtin_network.h"
+ // require fio
+#include "daScript/misc/performance_time.h"
+#include "daScript/simulate/aot_builtin_fio.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_7304086533296166780 {
+
+namespace  { struct TestFile; };
+namespace  { struct EchoServer; };
+namespace network { struct Server; };
+namespace network { struct MultiServer; };
+namespace fio { struct df_header; };
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+// unused enumeration ConversionResult
+// unused structure Server
+namespace network {
+
+struct MultiServer {
+    void * __rtti;
+    Func DAS_COMMENT((void,network::MultiServer)) __finalize;
+    smart_ptr_raw<MultiServer> _server;
+    Func DAS_COMMENT((void,network::MultiServer)) make_server_adapter;
+    Func DAS_COMMENT((bool,network::MultiServer,int32_t)) init;
+    Func DAS_COMMENT((int32_t,network::MultiServer,char * const ,int32_t)) connect;
+    Func DAS_COMMENT((void,network::MultiServer,smart_ptr_raw<MultiServer> &)) restore;
+    Func DAS_COMMENT((void,network::MultiServer,smart_ptr_raw<MultiServer> &)) save;
+    Func DAS_COMMENT((bool,network::MultiServer)) has_session;
+    Func DAS_COMMENT((bool,network::MultiServer)) is_open;
+    Func DAS_COMMENT((int32_t,network::MultiServer)) port;
+    Func DAS_COMMENT((int32_t,network::MultiServer)) connections;
+    Func DAS_COMMENT((bool,network::MultiServer,int32_t)) is_connected;
+    Func DAS_COMMENT((int32_t,network::MultiServer,int32_t)) tick;
+    Func DAS_COMMENT((bool,network::MultiServer,int32_t,uint8_t * const ,int32_t)) send;
+    Func DAS_COMMENT((bool,network::MultiServer,int32_t,char * const )) send_text;
+    Func DAS_COMMENT((bool,network::MultiServer,int32_t,TArray<char *> const )) send_parts;
+    Func DAS_COMMENT((uint64_t,network::MultiServer,int32_t)) pending;
+    Func DAS_COMMENT((void,network::MultiServer,int32_t)) close;
+    Func DAS_COMMENT((void,network::MultiServer,int32_t)) onConnect;
+    Func DAS_COMMENT((void,network::MultiServer,int32_t)) onDisconnect;
+    Func DAS_COMMENT((void,network::MultiServer,int32_t,uint8_t * const ,int32_t)) onData;
+    Func DAS_COMMENT((void,network::MultiServer,char * const ,int32_t)) onError;
+    Func DAS_COMMENT((void,network::MultiServer,char * const )) onLog;
+};
+static_assert(sizeof(MultiServer)==192,"structure size mismatch with DAS");
+static_assert(offsetof(MultiServer,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiServer,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiServer,_server)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiServer,make_server_adapter)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiServer,init)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiServer,connect)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiServer,restore)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiServer,save)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiServer,has_session)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiServer,is_open)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiServer,port)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiServer,connections)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiServer,is_connected)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiServer,tick)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiServer,send)==112,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiServer,send_text)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiServer,send_parts)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiServer,pending)==136,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiServer,close)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiServer,onConnect)==152,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiServer,onDisconnect)==160,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiServer,onData)==168,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiServer,onError)==176,"structure field offset mismatch with DAS");
+static_assert(offsetof(MultiServer,onLog)==184,"structure field offset mismatch with DAS");
+}
+// unused structure df_header
+namespace  {
+
+struct TestFile {
+    char * luaFile;
+    char * luaJitFile;
+    char * luauFile;
+    char * nutFile;
+    char * nutModifiedFile;
+    char * asFile;
+    char * jsFile;
+    char * monoFile;
+    char * dotNetFile;
+};
+static_assert(sizeof(TestFile)==72,"structure size mismatch with DAS");
+static_assert(offsetof(TestFile,luaFile)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,luaJitFile)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,luauFile)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,nutFile)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,nutModifiedFile)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,asFile)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,jsFile)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,monoFile)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,dotNetFile)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct EchoServer {
+    void * __rtti;
+    Func DAS_COMMENT((void,network::MultiServer)) __finalize;
+    smart_ptr_raw<MultiServer> _server;
+    Func DAS_COMMENT((void,network::MultiServer)) make_server_adapter;
+    Func DAS_COMMENT((bool,network::MultiServer,int32_t)) init;
+    Func DAS_COMMENT((int32_t,network::MultiServer,char * const ,int32_t)) connect;
+    Func DAS_COMMENT((void,network::MultiServer,smart_ptr_raw<MultiServer> &)) restore;
+    Func DAS_COMMENT((void,network::MultiServer,smart_ptr_raw<MultiServer> &)) save;
+    Func DAS_COMMENT((bool,network::MultiServer)) has_session;
+    Func DAS_COMMENT((bool,network::MultiServer)) is_open;
+    Func DAS_COMMENT((int32_t,network::MultiServer)) port;
+    Func DAS_COMMENT((int32_t,network::MultiServer)) connections;
+    Func DAS_COMMENT((bool,network::MultiServer,int32_t)) is_connected;
+    Func DAS_COMMENT((int32_t,network::MultiServer,int32_t)) tick;
+    Func DAS_COMMENT((bool,network::MultiServer,int32_t,uint8_t * const ,int32_t)) send;
+    Func DAS_COMMENT((bool,network::MultiServer,int32_t,char * const )) send_text;
+    Func DAS_COMMENT((bool,network::MultiServer,int32_t,TArray<char *> const )) send_parts;
+    Func DAS_COMMENT((uint64_t,network::MultiServer,int32_t)) pending;
+    Func DAS_COMMENT((void,network::MultiServer,int32_t)) close;
+    Func DAS_COMMENT((void,network::MultiServer,int32_t)) onConnect;
+    Func DAS_COMMENT((void,network::MultiServer,int32_t)) onDisconnect;
+    Func DAS_COMMENT((void,network::MultiServer,int32_t,uint8_t * const ,int32_t)) onData;
+    Func DAS_COMMENT((void,network::MultiServer,char * const ,int32_t)) onError;
+    Func DAS_COMMENT((void,network::MultiServer,char * const )) onLog;
+    TTable<int32_t,bool> outgoing;
+    int64_t received;
+    int32_t connected;
+};
+static_assert(sizeof(EchoServer)==256,"structure size mismatch with DAS");
+static_assert(offsetof(EchoServer,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(EchoServer,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(EchoServer,_server)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(EchoServer,make_server_adapter)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(EchoServer,init)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(EchoServer,connect)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(EchoServer,restore)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(EchoServer,save)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(EchoServer,has_session)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(EchoServer,is_open)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(EchoServer,port)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(EchoServer,connections)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(EchoServer,is_connected)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(EchoServer,tick)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(EchoServer,send)==112,"structure field offset mismatch with DAS");
+static_assert(offsetof(EchoServer,send_text)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(EchoServer,send_parts)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(EchoServer,pending)==136,"structure field offset mismatch with DAS");
+static_assert(offsetof(EchoServer,close)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(EchoServer,onConnect)==152,"structure field offset mismatch with DAS");
+static_assert(offsetof(EchoServer,onDisconnect)==160,"structure field offset mismatch with DAS");
+static_assert(offsetof(EchoServer,onData)==168,"structure field offset mismatch with DAS");
+static_assert(offsetof(EchoServer,onError)==176,"structure field offset mismatch with DAS");
+static_assert(offsetof(EchoServer,onLog)==184,"structure field offset mismatch with DAS");
+static_assert(offsetof(EchoServer,outgoing)==192,"structure field offset mismatch with DAS");
+static_assert(offsetof(EchoServer,received)==240,"structure field offset mismatch with DAS");
+static_assert(offsetof(EchoServer,connected)==248,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__2550dee806a7d7bc;
+extern StructInfo __struct_info__f7d6e61bdc84fb4;
+extern TypeInfo __type_info__3fa0d5f0114dfe7;
+extern TypeInfo __type_info__8ab85ec60c17193c;
+extern TypeInfo __type_info__d83b8da409a209eb;
+extern TypeInfo __type_info__af81fe4c86352052;
+extern TypeInfo __type_info__af8afe4c86446b52;
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__b68d800849332aec;
+extern TypeInfo __type_info__351396ad982294d4;
+extern TypeInfo __type_info__723020edbfd926a9;
+extern TypeInfo __type_info__6ba2939f192b0bf7;
+extern TypeInfo __type_info__af63df4c8601f1a5;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af63ee4c86020b22;
+extern TypeInfo __type_info__af5be84c85f468f0;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __struct_info__2550dee806a7d7bc_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x1e95cce8e09bf7eb), "__rtti", 0, 2 };
+TypeInfo * __type_info__dd31029f54c9edec_arg_types_var_2688894065665628092[1] = { &__type_info__6ba2939f192b0bf7 };
+const char * __type_info__dd31029f54c9edec_arg_names_var_2688894065665628092[1] = { "self" };
+VarInfo __struct_info__2550dee806a7d7bc_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__dd31029f54c9edec_arg_types_var_2688894065665628092, __type_info__dd31029f54c9edec_arg_names_var_2688894065665628092, 1, 0, nullptr, 12, 8, UINT64_C(0xdd31029f54c9edec), "__finalize", 8, 0 };
+VarInfo __struct_info__2550dee806a7d7bc_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__351396ad982294d4, nullptr, nullptr, nullptr, 0, 0, nullptr, 9216, 8, UINT64_C(0x45f2c15a14e9d9d9), "_server", 16, 24 };
+VarInfo __struct_info__2550dee806a7d7bc_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__dd31029f54c9edec_arg_types_var_2688894065665628092, __type_info__dd31029f54c9edec_arg_names_var_2688894065665628092, 1, 0, nullptr, 12, 8, UINT64_C(0xb684412c2e1f540f), "make_server_adapter", 24, 0 };
+TypeInfo * __type_info__dc2d297d90805f39_arg_types_var_2688894065665628092[2] = { &__type_info__6ba2939f192b0bf7, &__type_info__af8afe4c86446b52 };
+const char * __type_info__dc2d297d90805f39_arg_names_var_2688894065665628092[2] = { "self", "port" };
+VarInfo __struct_info__2550dee806a7d7bc_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__dc2d297d90805f39_arg_types_var_2688894065665628092, __type_info__dc2d297d90805f39_arg_names_var_2688894065665628092, 2, 0, nullptr, 12, 8, UINT64_C(0xdc2d297d90805f39), "init", 32, 0 };
+TypeInfo * __type_info__d88b65daf3e1e7c7_arg_types_var_2688894065665628092[3] = { &__type_info__6ba2939f192b0bf7, &__type_info__af90fe4c864e9d52, &__type_info__af8afe4c86446b52 };
+const char * __type_info__d88b65daf3e1e7c7_arg_names_var_2688894065665628092[3] = { "self", "host", "port" };
+VarInfo __struct_info__2550dee806a7d7bc_field_5 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af8afe4c86446b52, nullptr, (TypeInfo **)__type_info__d88b65daf3e1e7c7_arg_types_var_2688894065665628092, __type_info__d88b65daf3e1e7c7_arg_names_var_2688894065665628092, 3, 0, nullptr, 12, 8, UINT64_C(0xd88b65daf3e1e7c7), "connect", 40, 0 };
+TypeInfo * __type_info__eb83ca1750484380_arg_types_var_2688894065665628092[2] = { &__type_info__6ba2939f192b0bf7, &__type_info__3fa0d5f0114dfe7 };
+const char * __type_info__eb83ca1750484380_arg_names_var_2688894065665628092[2] = { "self", "shared_orphan" };
+VarInfo __struct_info__2550dee806a7d7bc_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__eb83ca1750484380_arg_types_var_2688894065665628092, __type_info__eb83ca1750484380_arg_names_var_2688894065665628092, 2, 0, nullptr, 12, 8, UINT64_C(0xeb83ca1750484380), "restore", 48, 0 };
+VarInfo __struct_info__2550dee806a7d7bc_field_7 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__eb83ca1750484380_arg_types_var_2688894065665628092, __type_info__eb83ca1750484380_arg_names_var_2688894065665628092, 2, 0, nullptr, 12, 8, UINT64_C(0x892f17fc356b9e19), "save", 56, 0 };
+VarInfo __struct_info__2550dee806a7d7bc_field_8 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__dd31029f54c9edec_arg_types_var_2688894065665628092, __type_info__dd31029f54c9edec_arg_names_var_2688894065665628092, 1, 0, nullptr, 12, 8, UINT64_C(0xa7b50b3613fb588c), "has_session", 64, 0 };
+VarInfo __struct_info__2550dee806a7d7bc_field_9 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__dd31029f54c9edec_arg_types_var_2688894065665628092, __type_info__dd31029f54c9edec_arg_names_var_2688894065665628092, 1, 0, nullptr, 12, 8, UINT64_C(0x3ed6383f2f857e98), "is_open", 72, 0 };
+VarInfo __struct_info__2550dee806a7d7bc_field_10 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af8afe4c86446b52, nullptr, (TypeInfo **)__type_info__dd31029f54c9edec_arg_types_var_2688894065665628092, __type_info__dd31029f54c9edec_arg_names_var_2688894065665628092, 1, 0, nullptr, 12, 8, UINT64_C(0x8c9a230d7fd51c30), "port", 80, 0 };
+VarInfo __struct_info__2550dee806a7d7bc_field_11 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af8afe4c86446b52, nullptr, (TypeInfo **)__type_info__dd31029f54c9edec_arg_types_var_2688894065665628092, __type_info__dd31029f54c9edec_arg_names_var_2688894065665628092, 1, 0, nullptr, 12, 8, UINT64_C(0x8be6cc151cc3710c), "connections", 88, 0 };
+const char * __type_info__43b40f3d1d234308_arg_names_var_2688894065665628092[2] = { "self", "conn" };
+VarInfo __struct_info__2550dee806a7d7bc_field_12 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__dc2d297d90805f39_arg_types_var_2688894065665628092, __type_info__43b40f3d1d234308_arg_names_var_2688894065665628092, 2, 0, nullptr, 12, 8, UINT64_C(0x43b40f3d1d234308), "is_connected", 96, 0 };
+const char * __type_info__45b9421f7d1fa52f_arg_names_var_2688894065665628092[2] = { "self", "timeout" };
+VarInfo __struct_info__2550dee806a7d7bc_field_13 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af8afe4c86446b52, nullptr, (TypeInfo **)__type_info__dc2d297d90805f39_arg_types_var_2688894065665628092, __type_info__45b9421f7d1fa52f_arg_names_var_2688894065665628092, 2, 0, nullptr, 12, 8, UINT64_C(0x45b9421f7d1fa52f), "tick", 104, 0 };
+TypeInfo * __type_info__dacd36fc7ac3e822_arg_types_var_2688894065665628092[4] = { &__type_info__6ba2939f192b0bf7, &__type_info__af8afe4c86446b52, &__type_info__d83b8da409a209eb, &__type_info__af8afe4c86446b52 };
+const char * __type_info__dacd36fc7ac3e822_arg_names_var_2688894065665628092[4] = { "self", "conn", "data", "size" };
+VarInfo __struct_info__2550dee806a7d7bc_field_14 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__dacd36fc7ac3e822_arg_types_var_2688894065665628092, __type_info__dacd36fc7ac3e822_arg_names_var_2688894065665628092, 4, 0, nullptr, 12, 8, UINT64_C(0xdacd36fc7ac3e822), "send", 112, 0 };
+TypeInfo * __type_info__1041f810e8fbeee_arg_types_var_2688894065665628092[3] = { &__type_info__6ba2939f192b0bf7, &__type_info__af8afe4c86446b52, &__type_info__af90fe4c864e9d52 };
+const char * __type_info__1041f810e8fbeee_arg_names_var_2688894065665628092[3] = { "self", "conn", "text" };
+VarInfo __struct_info__2550dee806a7d7bc_field_15 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__1041f810e8fbeee_arg_types_var_2688894065665628092, __type_info__1041f810e8fbeee_arg_names_var_2688894065665628092, 3, 0, nullptr, 12, 8, UINT64_C(0x1041f810e8fbeee), "send_text", 120, 0 };
+TypeInfo * __type_info__54b681370b5ef76d_arg_types_var_2688894065665628092[3] = { &__type_info__6ba2939f192b0bf7, &__type_info__af8afe4c86446b52, &__type_info__8ab85ec60c17193c };
+const char * __type_info__54b681370b5ef76d_arg_names_var_2688894065665628092[3] = { "self", "conn", "parts" };
+VarInfo __struct_info__2550dee806a7d7bc_field_16 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__54b681370b5ef76d_arg_types_var_2688894065665628092, __type_info__54b681370b5ef76d_arg_names_var_2688894065665628092, 3, 0, nullptr, 12, 8, UINT64_C(0x54b681370b5ef76d), "send_parts", 128, 0 };
+VarInfo __struct_info__2550dee806a7d7bc_field_17 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__b68d800849332aec, nullptr, (TypeInfo **)__type_info__dc2d297d90805f39_arg_types_var_2688894065665628092, __type_info__43b40f3d1d234308_arg_names_var_2688894065665628092, 2, 0, nullptr, 12, 8, UINT64_C(0x7775d7664421cc24), "pending", 136, 0 };
+VarInfo __struct_info__2550dee806a7d7bc_field_18 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__dc2d297d90805f39_arg_types_var_2688894065665628092, __type_info__43b40f3d1d234308_arg_names_var_2688894065665628092, 2, 0, nullptr, 12, 8, UINT64_C(0x291e3a4c6f708aca), "close", 144, 0 };
+VarInfo __struct_info__2550dee806a7d7bc_field_19 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__dc2d297d90805f39_arg_types_var_2688894065665628092, __type_info__43b40f3d1d234308_arg_names_var_2688894065665628092, 2, 0, nullptr, 12, 8, UINT64_C(0x4e720a852e57cd23), "onConnect", 152, 0 };
+VarInfo __struct_info__2550dee806a7d7bc_field_20 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__dc2d297d90805f39_arg_types_var_2688894065665628092, __type_info__43b40f3d1d234308_arg_names_var_2688894065665628092, 2, 0, nullptr, 12, 8, UINT64_C(0xa979813b9cbd265e), "onDisconnect", 160, 0 };
+const char * __type_info__2766bd8e03d2cdb9_arg_names_var_2688894065665628092[4] = { "self", "conn", "buf", "size" };
+VarInfo __struct_info__2550dee806a7d7bc_field_21 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__dacd36fc7ac3e822_arg_types_var_2688894065665628092, __type_info__2766bd8e03d2cdb9_arg_names_var_2688894065665628092, 4, 0, nullptr, 12, 8, UINT64_C(0x2766bd8e03d2cdb9), "onData", 168, 0 };
+const char * __type_info__7611e791c535bbd0_arg_names_var_2688894065665628092[3] = { "self", "msg", "code" };
+VarInfo __struct_info__2550dee806a7d7bc_field_22 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__d88b65daf3e1e7c7_arg_types_var_2688894065665628092, __type_info__7611e791c535bbd0_arg_names_var_2688894065665628092, 3, 0, nullptr, 12, 8, UINT64_C(0x7611e791c535bbd0), "onError", 176, 0 };
+TypeInfo * __type_info__701c3e879808e8e8_arg_types_var_2688894065665628092[2] = { &__type_info__6ba2939f192b0bf7, &__type_info__af90fe4c864e9d52 };
+const char * __type_info__701c3e879808e8e8_arg_names_var_2688894065665628092[2] = { "self", "msg" };
+VarInfo __struct_info__2550dee806a7d7bc_field_23 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__701c3e879808e8e8_arg_types_var_2688894065665628092, __type_info__701c3e879808e8e8_arg_names_var_2688894065665628092, 2, 0, nullptr, 12, 8, UINT64_C(0x701c3e879808e8e8), "onLog", 184, 0 };
+VarInfo __struct_info__2550dee806a7d7bc_field_24 =  { Type::tTable, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, &__type_info__af63df4c8601f1a5, nullptr, nullptr, 0, 0, nullptr, 40962, 48, UINT64_C(0x8e7140152b046d7f), "outgoing", 192, 27 };
+VarInfo __struct_info__2550dee806a7d7bc_field_25 =  { Type::tInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0xda87b05628b741c7), "received", 240, 0 };
+VarInfo __struct_info__2550dee806a7d7bc_field_26 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xd661b50c6832ac46), "connected", 248, 0 };
+VarInfo * __struct_info__2550dee806a7d7bc_fields[27] =  { &__struct_info__2550dee806a7d7bc_field_0, &__struct_info__2550dee806a7d7bc_field_1, &__struct_info__2550dee806a7d7bc_field_2, &__struct_info__2550dee806a7d7bc_field_3, &__struct_info__2550dee806a7d7bc_field_4, &__struct_info__2550dee806a7d7bc_field_5, &__struct_info__2550dee806a7d7bc_field_6, &__struct_info__2550dee806a7d7bc_field_7, &__struct_info__2550dee806a7d7bc_field_8, &__struct_info__2550dee806a7d7bc_field_9, &__struct_info__2550dee806a7d7bc_field_10, &__struct_info__2550dee806a7d7bc_field_11, &__struct_info__2550dee806a7d7bc_field_12, &__struct_info__2550dee806a7d7bc_field_13, &__struct_info__2550dee806a7d7bc_field_14, &__struct_info__2550dee806a7d7bc_field_15, &__struct_info__2550dee806a7d7bc_field_16, &__struct_info__2550dee806a7d7bc_field_17, &__struct_info__2550dee806a7d7bc_field_18, &__struct_info__2550dee806a7d7bc_field_19, &__struct_info__2550dee806a7d7bc_field_20, &__struct_info__2550dee806a7d7bc_field_21, &__struct_info__2550dee806a7d7bc_field_22, &__struct_info__2550dee806a7d7bc_field_23, &__struct_info__2550dee806a7d7bc_field_24, &__struct_info__2550dee806a7d7bc_field_25, &__struct_info__2550dee806a7d7bc_field_26 };
+StructInfo __struct_info__2550dee806a7d7bc = {"EchoServer", "", 29, __struct_info__2550dee806a7d7bc_fields, 27, 256, UINT64_C(0xcc6962984ee6df4), nullptr, UINT64_C(0x2550dee806a7d7bc), 0 };
+VarInfo __struct_info__f7d6e61bdc84fb4_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xf5672b2bf7422e33), "__rtti", 0, 2 };
+VarInfo __struct_info__f7d6e61bdc84fb4_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__dd31029f54c9edec_arg_types_var_2688894065665628092, __type_info__dd31029f54c9edec_arg_names_var_2688894065665628092, 1, 0, nullptr, 12, 8, UINT64_C(0x94edfecfb7fe3e4), "__finalize", 8, 0 };
+VarInfo __struct_info__f7d6e61bdc84fb4_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__351396ad982294d4, nullptr, nullptr, nullptr, 0, 0, nullptr, 9216, 8, UINT64_C(0xf2dc1f8233490121), "_server", 16, 24 };
+VarInfo __struct_info__f7d6e61bdc84fb4_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__dd31029f54c9edec_arg_types_var_2688894065665628092, __type_info__dd31029f54c9edec_arg_names_var_2688894065665628092, 1, 0, nullptr, 12, 8, UINT64_C(0xd84c2a9ec82c4127), "make_server_adapter", 24, 0 };
+VarInfo __struct_info__f7d6e61bdc84fb4_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__dc2d297d90805f39_arg_types_var_2688894065665628092, __type_info__dc2d297d90805f39_arg_names_var_2688894065665628092, 2, 0, nullptr, 12, 8, UINT64_C(0x6359d66f7d5e8641), "init", 32, 0 };
+VarInfo __struct_info__f7d6e61bdc84fb4_field_5 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af8afe4c86446b52, nullptr, (TypeInfo **)__type_info__d88b65daf3e1e7c7_arg_types_var_2688894065665628092, __type_info__d88b65daf3e1e7c7_arg_names_var_2688894065665628092, 3, 0, nullptr, 12, 8, UINT64_C(0xea2f2d1009a3ff6f), "connect", 40, 0 };
+VarInfo __struct_info__f7d6e61bdc84fb4_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__eb83ca1750484380_arg_types_var_2688894065665628092, __type_info__eb83ca1750484380_arg_names_var_2688894065665628092, 2, 0, nullptr, 12, 8, UINT64_C(0x98684056ae9b8cc8), "restore", 48, 0 };
+VarInfo __struct_info__f7d6e61bdc84fb4_field_7 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__eb83ca1750484380_arg_types_var_2688894065665628092, __type_info__eb83ca1750484380_arg_names_var_2688894065665628092, 2, 0, nullptr, 12, 8, UINT64_C(0xee96c4ee05996d91), "save", 56, 0 };
+VarInfo __struct_info__f7d6e61bdc84fb4_field_8 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__dd31029f54c9edec_arg_types_var_2688894065665628092, __type_info__dd31029f54c9edec_arg_names_var_2688894065665628092, 1, 0, nullptr, 12, 8, UINT64_C(0xf7c3d6d0fea2c394), "has_session", 64, 0 };
+VarInfo __struct_info__f7d6e61bdc84fb4_field_9 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__dd31029f54c9edec_arg_types_var_2688894065665628092, __type_info__dd31029f54c9edec_arg_names_var_2688894065665628092, 1, 0, nullptr, 12, 8, UINT64_C(0x5bab8d90ff0a5c10), "is_open", 72, 0 };
+VarInfo __struct_info__f7d6e61bdc84fb4_field_10 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af8afe4c86446b52, nullptr, (TypeInfo **)__type_info__dd31029f54c9edec_arg_types_var_2688894065665628092, __type_info__dd31029f54c9edec_arg_names_var_2688894065665628092, 1, 0, nullptr, 12, 8, UINT64_C(0x7773cffee7e39838), "port", 80, 0 };
+VarInfo __struct_info__f7d6e61bdc84fb4_field_11 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af8afe4c86446b52, nullptr, (TypeInfo **)__type_info__dd31029f54c9edec_arg_types_var_2688894065665628092, __type_info__dd31029f54c9edec_arg_names_var_2688894065665628092, 1, 0, nullptr, 12, 8, UINT64_C(0x8c271164b40d2754), "connections", 88, 0 };
+VarInfo __struct_info__f7d6e61bdc84fb4_field_12 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__dc2d297d90805f39_arg_types_var_2688894065665628092, __type_info__43b40f3d1d234308_arg_names_var_2688894065665628092, 2, 0, nullptr, 12, 8, UINT64_C(0xa465d5c49a30c70), "is_connected", 96, 0 };
+VarInfo __struct_info__f7d6e61bdc84fb4_field_13 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af8afe4c86446b52, nullptr, (TypeInfo **)__type_info__dc2d297d90805f39_arg_types_var_2688894065665628092, __type_info__45b9421f7d1fa52f_arg_names_var_2688894065665628092, 2, 0, nullptr, 12, 8, UINT64_C(0x375edf10eaf45807), "tick", 104, 0 };
+VarInfo __struct_info__f7d6e61bdc84fb4_field_14 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__dacd36fc7ac3e822_arg_types_var_2688894065665628092, __type_info__dacd36fc7ac3e822_arg_names_var_2688894065665628092, 4, 0, nullptr, 12, 8, UINT64_C(0x9d14e3edc05a079a), "send", 112, 0 };
+VarInfo __struct_info__f7d6e61bdc84fb4_field_15 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__1041f810e8fbeee_arg_types_var_2688894065665628092, __type_info__1041f810e8fbeee_arg_names_var_2688894065665628092, 3, 0, nullptr, 12, 8, UINT64_C(0x85f14e66e6cc2796), "send_text", 120, 0 };
+VarInfo __struct_info__f7d6e61bdc84fb4_field_16 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__54b681370b5ef76d_arg_types_var_2688894065665628092, __type_info__54b681370b5ef76d_arg_names_var_2688894065665628092, 3, 0, nullptr, 12, 8, UINT64_C(0x37aa79ec498d8535), "send_parts", 128, 0 };
+VarInfo __struct_info__f7d6e61bdc84fb4_field_17 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__b68d800849332aec, nullptr, (TypeInfo **)__type_info__dc2d297d90805f39_arg_types_var_2688894065665628092, __type_info__43b40f3d1d234308_arg_names_var_2688894065665628092, 2, 0, nullptr, 12, 8, UINT64_C(0x13be5de8578d989c), "pending", 136, 0 };
+VarInfo __struct_info__f7d6e61bdc84fb4_field_18 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__dc2d297d90805f39_arg_types_var_2688894065665628092, __type_info__43b40f3d1d234308_arg_names_var_2688894065665628092, 2, 0, nullptr, 12, 8, UINT64_C(0xbda9c73e677a4472), "close", 144, 0 };
+VarInfo __struct_info__f7d6e61bdc84fb4_field_19 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__dc2d297d90805f39_arg_types_var_2688894065665628092, __type_info__43b40f3d1d234308_arg_names_var_2688894065665628092, 2, 0, nullptr, 12, 8, UINT64_C(0xea46ebc19195532b), "onConnect", 152, 0 };
+VarInfo __struct_info__f7d6e61bdc84fb4_field_20 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__dc2d297d90805f39_arg_types_var_2688894065665628092, __type_info__43b40f3d1d234308_arg_names_var_2688894065665628092, 2, 0, nullptr, 12, 8, UINT64_C(0x72bbc847813cc446), "onDisconnect", 160, 0 };
+VarInfo __struct_info__f7d6e61bdc84fb4_field_21 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__dacd36fc7ac3e822_arg_types_var_2688894065665628092, __type_info__2766bd8e03d2cdb9_arg_names_var_2688894065665628092, 4, 0, nullptr, 12, 8, UINT64_C(0xe080a3c0a4e6ec71), "onData", 168, 0 };
+VarInfo __struct_info__f7d6e61bdc84fb4_field_22 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__d88b65daf3e1e7c7_arg_types_var_2688894065665628092, __type_info__7611e791c535bbd0_arg_names_var_2688894065665628092, 3, 0, nullptr, 12, 8, UINT64_C(0x920e9dbce3eadcd8), "onError", 176, 0 };
+VarInfo __struct_info__f7d6e61bdc84fb4_field_23 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__701c3e879808e8e8_arg_types_var_2688894065665628092, __type_info__701c3e879808e8e8_arg_names_var_2688894065665628092, 2, 0, nullptr, 12, 8, UINT64_C(0x9086bb792ce9e660), "onLog", 184, 0 };
+VarInfo * __struct_info__f7d6e61bdc84fb4_fields[24] =  { &__struct_info__f7d6e61bdc84fb4_field_0, &__struct_info__f7d6e61bdc84fb4_field_1, &__struct_info__f7d6e61bdc84fb4_field_2, &__struct_info__f7d6e61bdc84fb4_field_3, &__struct_info__f7d6e61bdc84fb4_field_4, &__struct_info__f7d6e61bdc84fb4_field_5, &__struct_info__f7d6e61bdc84fb4_field_6, &__struct_info__f7d6e61bdc84fb4_field_7, &__struct_info__f7d6e61bdc84fb4_field_8, &__struct_info__f7d6e61bdc84fb4_field_9, &__struct_info__f7d6e61bdc84fb4_field_10, &__struct_info__f7d6e61bdc84fb4_field_11, &__struct_info__f7d6e61bdc84fb4_field_12, &__struct_info__f7d6e61bdc84fb4_field_13, &__struct_info__f7d6e61bdc84fb4_field_14, &__struct_info__f7d6e61bdc84fb4_field_15, &__struct_info__f7d6e61bdc84fb4_field_16, &__struct_info__f7d6e61bdc84fb4_field_17, &__struct_info__f7d6e61bdc84fb4_field_18, &__struct_info__f7d6e61bdc84fb4_field_19, &__struct_info__f7d6e61bdc84fb4_field_20, &__struct_info__f7d6e61bdc84fb4_field_21, &__struct_info__f7d6e61bdc84fb4_field_22, &__struct_info__f7d6e61bdc84fb4_field_23 };
+StructInfo __struct_info__f7d6e61bdc84fb4 = {"MultiServer", "network", 13, __struct_info__f7d6e61bdc84fb4_fields, 24, 192, UINT64_C(0x0), nullptr, UINT64_C(0xf7d6e61bdc84fb4), 0 };
+TypeInfo __type_info__3fa0d5f0114dfe7 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__351396ad982294d4, nullptr, nullptr, nullptr, 0, 0, nullptr, 9473, 8, UINT64_C(0x3fa0d5f0114dfe7) };
+TypeInfo __type_info__8ab85ec60c17193c = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63ee4c86020b22, nullptr, nullptr, nullptr, 0, 0, nullptr, 57378, 24, UINT64_C(0x8ab85ec60c17193c) };
+TypeInfo __type_info__d83b8da409a209eb = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af5be84c85f468f0, nullptr, nullptr, nullptr, 0, 0, nullptr, 8236, 8, UINT64_C(0xd83b8da409a209eb) };
+TypeInfo __type_info__af81fe4c86352052 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 1, UINT64_C(0xaf81fe4c86352052) };
+TypeInfo __type_info__af8afe4c86446b52 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf8afe4c86446b52) };
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__b68d800849332aec = { Type::tUInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 8, UINT64_C(0xb68d800849332aec) };
+TypeInfo __type_info__351396ad982294d4 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~network::NetworkMultiServer"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 136, UINT64_C(0x351396ad982294d4) };
+TypeInfo __type_info__723020edbfd926a9 = { Type::tStructure, &__struct_info__2550dee806a7d7bc, nullptr, nullptr, &__type_info__6ba2939f192b0bf7, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 256, UINT64_C(0x723020edbfd926a9) };
+TypeInfo __type_info__6ba2939f192b0bf7 = { Type::tStructure, &__struct_info__f7d6e61bdc84fb4, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24578, 192, UINT64_C(0x6ba2939f192b0bf7) };
+TypeInfo __type_info__af63df4c8601f1a5 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xaf63df4c8601f1a5) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__af63ee4c86020b22 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0xaf63ee4c86020b22) };
+TypeInfo __type_info__af5be84c85f468f0 = { Type::tUInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xaf5be84c85f468f0) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {__type_info__351396ad982294d4, };
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[5] = { &__type_info__af90fe4c864e9d52, &__type_info__af8afe4c86446b52, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52 };
+
+inline void _FuncbuiltinTickfinalizeTick5454204887383796109_751d215aad660abe ( Context * __context__, TTable<int32_t,bool> & __a_rename_at_1347_0 );
+inline bool _FuncbuiltinTickkey_existsTick16808803843923989214_f3ed75643ec4b498 ( Context * __context__, TTable<int32_t,bool> const  & __Tab_rename_at_1040_1, int32_t __at_rename_at_1040_2 );
+inline void _FuncbuiltinTickinsertTick12964066441666329206_cdb1865a358a95b7 ( Context * __context__, TTable<int32_t,bool> & __Tab_rename_at_869_3, int32_t __at_rename_at_869_4, bool __val_rename_at_869_5 );
+inline void finalize_9cf275eacc918731 ( Context * __context__, EchoServer & ____this_rename_at_15_6 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickkeysTick17388619793938508994_38c7b37a37484bd9 ( Context * __context__, TTable<int32_t,bool> & __a_rename_at_1282_7 );
+inline void finalize_552ac29c424d5883 ( Context * __context__, EchoServer * & ____this_rename_at_71_9 );
+inline EchoServer EchoServer_d4b764de2f3d281 ( Context * __context__ );
+inline void _FuncEchoServerTickonConnect_3407dfd32a82f8bf ( Context * __context__, EchoServer & __self_rename_at_22_12, int32_t __conn_rename_at_22_13 );
+inline void _FuncEchoServerTickonDisconnect_ab3807d037f5f8bb ( Context * __context__, EchoServer & __self_rename_at_25_14, int32_t __conn_rename_at_25_15 );
+inline void _FuncEchoServerTickonData_6999d1d9383aaaeb ( Context * __context__, EchoServer & __self_rename_at_28_16, int32_t __conn_rename_at_28_17, uint8_t * const  __buf_rename_at_28_18, int32_t __size_rename_at_28_19 );
+inline void _FuncEchoServerTickonError_94c23910fcaac45b ( Context * __context__, EchoServer & __self_rename_at_35_20, char * const  __msg_rename_at_35_21, int32_t __code_rename_at_35_22 );
+inline void _FuncEchoServerTickonLog_95f3d6abaafe59b3 ( Context * __context__, EchoServer & __self_rename_at_38_23, char * const  __msg_rename_at_38_24 );
+inline void _FuncEchoServer_0x27___finalize_63296b59b369fe8 ( Context * __context__, EchoServer & __self_rename_at_15_25 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickfinalizeTick5454204887383796109_751d215aad660abe ( Context * __context__, TTable<int32_t,bool> &  __a_rename_at_1347_0 )
+{
+    builtin_table_free(das_arg<TTable<int32_t,bool>>::pass(__a_rename_at_1347_0),4,1,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline bool _FuncbuiltinTickkey_existsTick16808803843923989214_f3ed75643ec4b498 ( Context * __context__, TTable<int32_t,bool> const  &  __Tab_rename_at_1040_1, int32_t __at_rename_at_1040_2 )
+{
+    return das_auto_cast<bool>::cast(__builtin_table_key_exists(__context__,__Tab_rename_at_1040_1,__at_rename_at_1040_2));
+}
+
+inline void _FuncbuiltinTickinsertTick12964066441666329206_cdb1865a358a95b7 ( Context * __context__, TTable<int32_t,bool> &  __Tab_rename_at_869_3, int32_t __at_rename_at_869_4, bool __val_rename_at_869_5 )
+{
+    das_copy(__Tab_rename_at_869_3(__at_rename_at_869_4,__context__),__val_rename_at_869_5);
+}
+
+inline void finalize_9cf275eacc918731 ( Context * __context__, EchoServer &  ____this_rename_at_15_6 )
+{
+    das_delete_handle<smart_ptr_raw<MultiServer>>::clear(__context__,____this_rename_at_15_6._server);
+    _FuncbuiltinTickfinalizeTick5454204887383796109_751d215aad660abe(__context__,das_arg<TTable<int32_t,bool>>::pass(____this_rename_at_15_6.outgoing));
+    memset((void*)&(____this_rename_at_15_6), 0, 256);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickkeysTick17388619793938508994_38c7b37a37484bd9 ( Context * __context__, TTable<int32_t,bool> &  __a_rename_at_1282_7 )
+{
+    Sequence DAS_COMMENT((int32_t)) __it_rename_at_1283_8;das_zero(__it_rename_at_1283_8);
+    builtin_table_keys(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_1283_8),das_arg<TTable<int32_t,bool>>::pass(__a_rename_at_1282_7),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_1283_8);
+}
+
+inline void finalize_552ac29c424d5883 ( Context * __context__, EchoServer * & ____this_rename_at_71_9 )
+{
+    if ( ____this_rename_at_71_9 != nullptr )
+    {
+        int32_t ____size_rename_at_71_10 = ((int32_t)class_rtti_size(das_auto_cast<void * const >::cast(____this_rename_at_71_9)));
+        das_invoke_function<void>::invoke<network::MultiServer &>(__context__,nullptr,____this_rename_at_71_9->__finalize,das_arg<network::MultiServer>::pass(das_cast<network::MultiServer>::cast(das_deref(__context__,____this_rename_at_71_9,__FILE__,__LINE__))));
+        das_delete<EchoServer *>::clear(__context__,____this_rename_at_71_9,____size_rename_at_71_10);
+        das_copy(____this_rename_at_71_9,nullptr);
+    };
+}
+
+inline EchoServer EchoServer_d4b764de2f3d281 ( Context * __context__ )
+{
+    EchoServer __self_rename_at_19_11; das_zero(__self_rename_at_19_11); das_move(__self_rename_at_19_11, (([&]() -> EchoServer {
+        EchoServer __mks_19;
+        das_zero(__mks_19);
+        das_copy((__mks_19.__rtti),(((void *)(&__type_info__723020edbfd926a9))));
+        das_copy((__mks_19.__finalize),(das_cast<Func DAS_COMMENT((void,network::MultiServer))>::cast(Func(__context__->fnByMangledName(/*EchoServer'__finalize S<EchoServer>*/ 0x2d31a5527e2010c8)))));
+        das_copy((__mks_19.make_server_adapter),(Func(__context__->fnByMangledName(/*@network::MultiServer`make_server_adapter S<network::MultiServer>*/ 0x43fa4e89d8f2f6de))));
+        das_copy((__mks_19.init),(Func(__context__->fnByMangledName(/*@network::MultiServer`init S<network::MultiServer> Ci*/ 0x9b6fd7aa02fee66))));
+        das_copy((__mks_19.connect),(Func(__context__->fnByMangledName(/*@network::MultiServer`connect S<network::MultiServer> Cs Ci*/ 0x536da63c4f85b028))));
+        das_copy((__mks_19.restore),(Func(__context__->fnByMangledName(/*@network::MultiServer`restore S<network::MultiServer> &1<H<network::NetworkMultiServer>>?M*/ 0xe61825f9bea29f07))));
+        das_copy((__mks_19.save),(Func(__context__->fnByMangledName(/*@network::MultiServer`save S<network::MultiServer> &1<H<network::NetworkMultiServer>>?M*/ 0x44ac91d5681da58d))));
+        das_copy((__mks_19.has_session),(Func(__context__->fnByMangledName(/*@network::MultiServer`has_session S<network::MultiServer>*/ 0x8dd67f352e70b6c2))));
+        das_copy((__mks_19.is_open),(Func(__context__->fnByMangledName(/*@network::MultiServer`is_open S<network::MultiServer>*/ 0x7feac8fa9bbeacd4))));
+        das_copy((__mks_19.port),(Func(__context__->fnByMangledName(/*@network::MultiServer`port S<network::MultiServer>*/ 0x1db89c57c7bfd879))));
+        das_copy((__mks_19.connections),(Func(__context__->fnByMangledName(/*@network::MultiServer`connections S<network::MultiServer>*/ 0xe120c43ce49c64a4))));
+        das_copy((__mks_19.is_connected),(Func(__context__->fnByMangledName(/*@network::MultiServer`is_connected S<network::MultiServer> Ci*/ 0x444028eb13a35f41))));
+        das_copy((__mks_19.tick),(Func(__context__->fnByMangledName(/*@network::MultiServer`tick S<network::MultiServer> Ci*/ 0xa8c073795d7a9cb1))));
+        das_copy((__mks_19.send),(Func(__context__->fnByMangledName(/*@network::MultiServer`send S<network::MultiServer> Ci C1<u8>? Ci*/ 0xac8c229ce86da934))));
+        das_copy((__mks_19.send_text),(Func(__context__->fnByMangledName(/*@network::MultiServer`send_text S<network::MultiServer> Ci Cs*/ 0x14455932f5dafcc7))));
+        das_copy((__mks_19.send_parts),(Func(__context__->fnByMangledName(/*@network::MultiServer`send_parts S<network::MultiServer> Ci C1<s>A*/ 0x643d77839fa4144e))));
+        das_copy((__mks_19.pending),(Func(__context__->fnByMangledName(/*@network::MultiServer`pending S<network::MultiServer> Ci*/ 0xe79d1f8ed1fab8e1))));
+        das_copy((__mks_19.close),(Func(__context__->fnByMangledName(/*@network::MultiServer`close S<network::MultiServer> Ci*/ 0xa5e066c8c17b9108))));
+        das_copy((__mks_19.onConnect),(das_cast<Func DAS_COMMENT((void,network::MultiServer,int32_t))>::cast(Func(__context__->fnByMangledName(/*EchoServer`onConnect S<EchoServer> Ci*/ 0x31bc227f63365e5e)))));
+        das_copy((__mks_19.onDisconnect),(das_cast<Func DAS_COMMENT((void,network::MultiServer,int32_t))>::cast(Func(__context__->fnByMangledName(/*EchoServer`onDisconnect S<EchoServer> Ci*/ 0x192ac83ad6586826)))));
+        das_copy((__mks_19.onData),(das_cast<Func DAS_COMMENT((void,network::MultiServer,int32_t,uint8_t * const ,int32_t))>::cast(Func(__context__->fnByMangledName(/*EchoServer`onData S<EchoServer> Ci C1<u8>? Ci*/ 0x9cb07b1951c8eba4)))));
+        das_copy((__mks_19.onError),(das_cast<Func DAS_COMMENT((void,network::MultiServer,char * const ,int32_t))>::cast(Func(__context__->fnByMangledName(/*EchoServer`onError S<EchoServer> Cs Ci*/ 0x10ea7413a27a10d0)))));
+        das_copy((__mks_19.onLog),(das_cast<Func DAS_COMMENT((void,network::MultiServer,char * const ))>::cast(Func(__context__->fnByMangledName(/*EchoServer`onLog S<EchoServer> Cs*/ 0xfcc433c961ea5de5)))));
+        return __mks_19;
+    })()));
+    return /* <- */ das_auto_cast_move<EchoServer>::cast(__self_rename_at_19_11);
+}
+
+inline void _FuncEchoServerTickonConnect_3407dfd32a82f8bf ( Context * __context__, EchoServer &  __self_rename_at_22_12, int32_t __conn_rename_at_22_13 )
+{
+    ++__self_rename_at_22_12.connected;
+}
+
+inline void _FuncEchoServerTickonDisconnect_ab3807d037f5f8bb ( Context * __context__, EchoServer &  __self_rename_at_25_14, int32_t __conn_rename_at_25_15 )
+{
+}
+
+inline void _FuncEchoServerTickonData_6999d1d9383aaaeb ( Context * __context__, EchoServer &  __self_rename_at_28_16, int32_t __conn_rename_at_28_17, uint8_t * const  __buf_rename_at_28_18, int32_t __size_rename_at_28_19 )
+{
+    if ( _FuncbuiltinTickkey_existsTick16808803843923989214_f3ed75643ec4b498(__context__,das_arg<TTable<int32_t,bool>>::pass(__self_rename_at_28_16.outgoing),__conn_rename_at_28_17) )
+    {
+        __self_rename_at_28_16.received += int64_t(__size_rename_at_28_19);
+    } else {
+        das_invoke_method<bool,112/*send*/>::invoke<network::MultiServer &,int32_t,uint8_t * const ,int32_t>(__context__,nullptr,das_arg<network::MultiServer>::pass(das_cast<network::MultiServer>::cast(__self_rename_at_28_16)),__conn_rename_at_28_17,__buf_rename_at_28_18,__size_rename_at_28_19);
+    };
+}
+
+inline void _FuncEchoServerTickonError_94c23910fcaac45b ( Context * __context__, EchoServer &  __self_rename_at_35_20, char * const  __msg_rename_at_35_21, int32_t __code_rename_at_35_22 )
+{
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<5>(__tinfo_0, cast<char * const >::from(((char *) "network error ")), cast<int32_t>::from(__code_rename_at_35_22), cast<char * const >::from(((char *) ": ")), cast<char * const >::from(__msg_rename_at_35_21), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncEchoServerTickonLog_95f3d6abaafe59b3 ( Context * __context__, EchoServer &  __self_rename_at_38_23, char * const  __msg_rename_at_38_24 )
+{
+}
+
+inline void _FuncEchoServer_0x27___finalize_63296b59b369fe8 ( Context * __context__, EchoServer &  __self_rename_at_15_25 )
+{
+    finalize_9cf275eacc918731(__context__,das_arg<EchoServer>::pass(__self_rename_at_15_25));
+}
+static vec4f __wrap__FuncbuiltinTickfinalizeTick5454204887383796109_751d215aad660abe ( Context * __context__ ) {
+    TTable<int32_t,bool> &  arg_a = cast_aot_arg<TTable<int32_t,bool> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickfinalizeTick5454204887383796109_751d215aad660abe(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickkey_existsTick16808803843923989214_f3ed75643ec4b498 ( Context * __context__ ) {
+    TTable<int32_t,bool> const  &  arg_Tab = cast_aot_arg<TTable<int32_t,bool> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_at = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_FuncbuiltinTickkey_existsTick16808803843923989214_f3ed75643ec4b498(__context__, arg_Tab, arg_at));
+}
+static vec4f __wrap__FuncbuiltinTickinsertTick12964066441666329206_cdb1865a358a95b7 ( Context * __context__ ) {
+    TTable<int32_t,bool> &  arg_Tab = cast_aot_arg<TTable<int32_t,bool> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_at = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    bool arg_val = cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[2]);
+    _FuncbuiltinTickinsertTick12964066441666329206_cdb1865a358a95b7(__context__, arg_Tab, arg_at, arg_val);
+    return v_zero();
+}
+static vec4f __wrap_finalize_9cf275eacc918731 ( Context * __context__ ) {
+    EchoServer &  arg___this = cast_aot_arg<EchoServer & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_9cf275eacc918731(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickkeysTick17388619793938508994_38c7b37a37484bd9 ( Context * __context__ ) {
+    TTable<int32_t,bool> &  arg_a = cast_aot_arg<TTable<int32_t,bool> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncbuiltinTickkeysTick17388619793938508994_38c7b37a37484bd9(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap_finalize_552ac29c424d5883 ( Context * __context__ ) {
+    EchoServer * & arg___this = cast_aot_arg<EchoServer * &>::to(*__context__,__context__->abiArguments()[0]);
+    finalize_552ac29c424d5883(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_EchoServer_d4b764de2f3d281 ( Context * __context__ ) {
+    *((EchoServer *) __context__->abiCMRES) = EchoServer_d4b764de2f3d281(__context__);
+    return v_zero();
+}
+static vec4f __wrap__FuncEchoServerTickonConnect_3407dfd32a82f8bf ( Context * __context__ ) {
+    EchoServer &  arg_self = cast_aot_arg<EchoServer & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_conn = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncEchoServerTickonConnect_3407dfd32a82f8bf(__context__, arg_self, arg_conn);
+    return v_zero();
+}
+static vec4f __wrap__FuncEchoServerTickonDisconnect_ab3807d037f5f8bb ( Context * __context__ ) {
+    EchoServer &  arg_self = cast_aot_arg<EchoServer & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_conn = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncEchoServerTickonDisconnect_ab3807d037f5f8bb(__context__, arg_self, arg_conn);
+    return v_zero();
+}
+static vec4f __wrap__FuncEchoServerTickonData_6999d1d9383aaaeb ( Context * __context__ ) {
+    EchoServer &  arg_self = cast_aot_arg<EchoServer & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_conn = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    uint8_t * const  arg_buf = cast_aot_arg<uint8_t * const >::to(*__context__,__context__->abiArguments()[2]);
+    int32_t arg_size = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[3]);
+    _FuncEchoServerTickonData_6999d1d9383aaaeb(__context__, arg_self, arg_conn, arg_buf, arg_size);
+    return v_zero();
+}
+static vec4f __wrap__FuncEchoServerTickonError_94c23910fcaac45b ( Context * __context__ ) {
+    EchoServer &  arg_self = cast_aot_arg<EchoServer & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_msg = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_code = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    _FuncEchoServerTickonError_94c23910fcaac45b(__context__, arg_self, arg_msg, arg_code);
+    return v_zero();
+}
+static vec4f __wrap__FuncEchoServerTickonLog_95f3d6abaafe59b3 ( Context * __context__ ) {
+    EchoServer &  arg_self = cast_aot_arg<EchoServer & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_msg = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncEchoServerTickonLog_95f3d6abaafe59b3(__context__, arg_self, arg_msg);
+    return v_zero();
+}
+static vec4f __wrap__FuncEchoServer_0x27___finalize_63296b59b369fe8 ( Context * __context__ ) {
+    EchoServer &  arg_self = cast_aot_arg<EchoServer & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncEchoServer_0x27___finalize_63296b59b369fe8(__context__, arg_self);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x9286be385e3a1013, false, (void*)&_FuncbuiltinTickfinalizeTick5454204887383796109_751d215aad660abe, &__wrap__FuncbuiltinTickfinalizeTick5454204887383796109_751d215aad660abe },
+    { 0x743c69ff715cc664, false, (void*)&_FuncbuiltinTickkey_existsTick16808803843923989214_f3ed75643ec4b498, &__wrap__FuncbuiltinTickkey_existsTick16808803843923989214_f3ed75643ec4b498 },
+    { 0x25ffdf5101afd344, false, (void*)&_FuncbuiltinTickinsertTick12964066441666329206_cdb1865a358a95b7, &__wrap__FuncbuiltinTickinsertTick12964066441666329206_cdb1865a358a95b7 },
+    { 0x4eba33bdb98dbf1f, false, (void*)&finalize_9cf275eacc918731, &__wrap_finalize_9cf275eacc918731 },
+    { 0xb0f76e1d8fa98a82, true, (void*)&_FuncbuiltinTickkeysTick17388619793938508994_38c7b37a37484bd9, &__wrap__FuncbuiltinTickkeysTick17388619793938508994_38c7b37a37484bd9 },
+    { 0x7d9ac08abb89d700, false, (void*)&finalize_552ac29c424d5883, &__wrap_finalize_552ac29c424d5883 },
+    { 0x9e586ed335c3bd13, true, (void*)&EchoServer_d4b764de2f3d281, &__wrap_EchoServer_d4b764de2f3d281 },
+    { 0x62bc17afe48a22ee, false, (void*)&_FuncEchoServerTickonConnect_3407dfd32a82f8bf, &__wrap__FuncEchoServerTickonConnect_3407dfd32a82f8bf },
+    { 0xcf4658d3377714b, false, (void*)&_FuncEchoServerTickonDisconnect_ab3807d037f5f8bb, &__wrap__FuncEchoServerTickonDisconnect_ab3807d037f5f8bb },
+    { 0xb25acb39cf68840b, false, (void*)&_FuncEchoServerTickonData_6999d1d9383aaaeb, &__wrap__FuncEchoServerTickonData_6999d1d9383aaaeb },
+    { 0x8d4f188aef7999eb, false, (void*)&_FuncEchoServerTickonError_94c23910fcaac45b, &__wrap__FuncEchoServerTickonError_94c23910fcaac45b },
+    { 0x54a04ca2ded88c4, false, (void*)&_FuncEchoServerTickonLog_95f3d6abaafe59b3, &__wrap__FuncEchoServerTickonLog_95f3d6abaafe59b3 },
+    { 0xe6d9ff59c68c414e, false, (void*)&_FuncEchoServer_0x27___finalize_63296b59b369fe8, &__wrap__FuncEchoServer_0x27___finalize_63296b59b369fe8 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_7304086533296166780
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,266 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require testProfile
+#include "test_profile.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require fio
+#include "daScript/misc/performance_time.h"
+#include "daScript/simulate/aot_builtin_fio.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_5871040895089553262 {
+
+namespace  { struct TestFile; };
+namespace  { struct NObject; };
+namespace fio { struct df_header; };
+// unused enumeration ConversionResult
+// unused structure df_header
+namespace  {
+
+struct TestFile {
+    char * luaFile;
+    char * luaJitFile;
+    char * luauFile;
+    char * nutFile;
+    char * nutModifiedFile;
+    char * asFile;
+    char * jsFile;
+    char * monoFile;
+    char * dotNetFile;
+};
+static_assert(sizeof(TestFile)==72,"structure size mismatch with DAS");
+static_assert(offsetof(TestFile,luaFile)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,luaJitFile)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,luauFile)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,nutFile)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,nutModifiedFile)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,asFile)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,jsFile)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,monoFile)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,dotNetFile)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct NObject {
+    float3 position;
+    float3 velocity;
+};
+static_assert(sizeof(NObject)==24,"structure size mismatch with DAS");
+static_assert(offsetof(NObject,position)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(NObject,velocity)==12,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__, TArray<uint8_t> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_be9ac1f65adf6f4e ( Context * __context__, TArray<NObject> & __Arr_rename_at_68_2, int32_t __newSize_rename_at_68_3 );
+inline void testSimI_a7c7c4fdb7323015 ( Context * __context__, TArray<NObject> & __objects_rename_at_16_38 );
+inline void testSim2I_79ed6fcb95b4db98 ( Context * __context__, TArray<NObject> & __objects_rename_at_23_40, int32_t __count_rename_at_23_41 );
+inline void init_16c8838c363cf3d5 ( Context * __context__, TArray<NObject> & __objects_rename_at_29_43 );
+inline TArray<uint8_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__, TDim<uint8_t,3> & __a_rename_at_1502_47 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    TArray<uint8_t> _temp_make_local_35_22_0;
+    TDim<uint8_t,3> _temp_make_local_35_22_1;
+    das_global<char *,0x371f085ff8ea14fe>(__context__) = ((char * const )(builtin_string_from_array(das_arg<TArray<uint8_t>>::pass((_temp_make_local_35_22_0 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4(__context__,das_arg<TDim<uint8_t,3>>::pass((([&]() -> TDim<uint8_t,3>& {
+        _temp_make_local_35_22_1(0,__context__) = 0xef;
+        _temp_make_local_35_22_1(1,__context__) = 0xbb;
+        _temp_make_local_35_22_1(2,__context__) = 0xbf;
+        return _temp_make_local_35_22_1;
+    })())))))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));/*ENCODING*/
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__, TArray<uint8_t> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<uint8_t>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,1,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_be9ac1f65adf6f4e ( Context * __context__, TArray<NObject> &  __Arr_rename_at_68_2, int32_t __newSize_rename_at_68_3 )
+{
+    builtin_array_resize(das_arg<TArray<NObject>>::pass(__Arr_rename_at_68_2),__newSize_rename_at_68_3,24,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void testSimI_a7c7c4fdb7323015 ( Context * __context__, TArray<NObject> &  __objects_rename_at_16_38 )
+{
+    {
+        bool __need_loop_17 = true;
+        // obj: NObject&
+        das_iterator<TArray<NObject>> __obj_iterator(__objects_rename_at_16_38);
+        NObject * __obj_rename_at_17_39;
+        __need_loop_17 = __obj_iterator.first(__context__,(__obj_rename_at_17_39)) && __need_loop_17;
+        for ( ; __need_loop_17 ; __need_loop_17 = __obj_iterator.next(__context__,(__obj_rename_at_17_39)) )
+        {
+            SimPolicy<float3>::SetAdd((char *)&((*__obj_rename_at_17_39).position),(*__obj_rename_at_17_39).velocity,*__context__,nullptr);
+        }
+        __obj_iterator.close(__context__,(__obj_rename_at_17_39));
+    };
+}
+
+inline void testSim2I_79ed6fcb95b4db98 ( Context * __context__, TArray<NObject> &  __objects_rename_at_23_40, int32_t __count_rename_at_23_41 )
+{
+    {
+        bool __need_loop_24 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(mk_range(__count_rename_at_23_41));
+        int32_t __i_rename_at_24_42;
+        __need_loop_24 = __i_iterator.first(__context__,(__i_rename_at_24_42)) && __need_loop_24;
+        for ( ; __need_loop_24 ; __need_loop_24 = __i_iterator.next(__context__,(__i_rename_at_24_42)) )
+        {
+            testSimI_a7c7c4fdb7323015(__context__,das_arg<TArray<NObject>>::pass(__objects_rename_at_23_40));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_24_42));
+    };
+}
+
+inline void init_16c8838c363cf3d5 ( Context * __context__, TArray<NObject> &  __objects_rename_at_29_43 )
+{
+    _FuncbuiltinTickresizeTick4811697762258667383_be9ac1f65adf6f4e(__context__,das_arg<TArray<NObject>>::pass(__objects_rename_at_29_43),50000);
+    int32_t __i_rename_at_31_44 = 0;
+    {
+        bool __need_loop_32 = true;
+        // obj: NObject&
+        das_iterator<TArray<NObject>> __obj_iterator(__objects_rename_at_29_43);
+        NObject * __obj_rename_at_32_45;
+        __need_loop_32 = __obj_iterator.first(__context__,(__obj_rename_at_32_45)) && __need_loop_32;
+        for ( ; __need_loop_32 ; __need_loop_32 = __obj_iterator.next(__context__,(__obj_rename_at_32_45)) )
+        {
+            das_copy((*__obj_rename_at_32_45).position,float3(__i_rename_at_31_44++,__i_rename_at_31_44 + 1,__i_rename_at_31_44 + 2));
+            das_copy((*__obj_rename_at_32_45).velocity,v_make_vec4f(1.000000e+00f,2.000000e+00f,3.000000e+00f,0.f));
+        }
+        __obj_iterator.close(__context__,(__obj_rename_at_32_45));
+    };
+    DAS_ASSERT((__i_rename_at_31_44 == builtin_array_size(das_arg<TArray<NObject>>::pass(__objects_rename_at_29_43))));
+}
+
+inline TArray<uint8_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__, TDim<uint8_t,3> &  __a_rename_at_1502_47 )
+{
+    TArray<uint8_t> __arr_rename_at_1504_48;das_zero(__arr_rename_at_1504_48);
+    _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111(__context__,das_arg<TArray<uint8_t>>::pass(__arr_rename_at_1504_48),3);
+    das_copy(das_cast<TDim<uint8_t,3>>::cast(das_ref(__context__,__arr_rename_at_1504_48(0,__context__))),__a_rename_at_1502_47);
+    return /* <- */ das_auto_cast_move<TArray<uint8_t>>::cast(__arr_rename_at_1504_48);
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__ ) {
+    TArray<uint8_t> &  arg_Arr = cast_aot_arg<TArray<uint8_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_be9ac1f65adf6f4e ( Context * __context__ ) {
+    TArray<NObject> &  arg_Arr = cast_aot_arg<TArray<NObject> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_be9ac1f65adf6f4e(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap_testSimI_a7c7c4fdb7323015 ( Context * __context__ ) {
+    TArray<NObject> &  arg_objects = cast_aot_arg<TArray<NObject> & >::to(*__context__,__context__->abiArguments()[0]);
+    testSimI_a7c7c4fdb7323015(__context__, arg_objects);
+    return v_zero();
+}
+static vec4f __wrap_testSim2I_79ed6fcb95b4db98 ( Context * __context__ ) {
+    TArray<NObject> &  arg_objects = cast_aot_arg<TArray<NObject> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_count = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    testSim2I_79ed6fcb95b4db98(__context__, arg_objects, arg_count);
+    return v_zero();
+}
+static vec4f __wrap_init_16c8838c363cf3d5 ( Context * __context__ ) {
+    TArray<NObject> &  arg_objects = cast_aot_arg<TArray<NObject> & >::to(*__context__,__context__->abiArguments()[0]);
+    init_16c8838c363cf3d5(__context__, arg_objects);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__ ) {
+    TDim<uint8_t,3> &  arg_a = cast_aot_arg<TDim<uint8_t,3> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<uint8_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x43319db4719733d6, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 },
+    { 0xf4d07fb24baac2e7, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_be9ac1f65adf6f4e, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_be9ac1f65adf6f4e },
+    { 0x341f1131c8a5895a, false, (void*)&testSimI_a7c7c4fdb7323015, &__wrap_testSimI_a7c7c4fdb7323015 },
+    { 0xff1ca661ae393deb, false, (void*)&testSim2I_79ed6fcb95b4db98, &__wrap_testSim2I_79ed6fcb95b4db98 },
+    { 0xb7f560f57c75ea2c, false, (void*)&init_16c8838c363cf3d5, &__wrap_init_16c8838c363cf3d5 },
+    { 0x60b407c06982729e, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x75681567dc465460, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_5871040895089553262
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,247 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require testProfile
+#include "test_profile.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require fio
+#include "daScript/misc/performance_time.h"
+#include "daScript/simulate/aot_builtin_fio.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_12892529406447683061 {
+
+namespace  { struct TestFile; };
+namespace fio { struct df_header; };
+// unused enumeration ConversionResult
+// unused structure df_header
+namespace  {
+
+struct TestFile {
+    char * luaFile;
+    char * luaJitFile;
+    char * luauFile;
+    char * nutFile;
+    char * nutModifiedFile;
+    char * asFile;
+    char * jsFile;
+    char * monoFile;
+    char * dotNetFile;
+};
+static_assert(sizeof(TestFile)==72,"structure size mismatch with DAS");
+static_assert(offsetof(TestFile,luaFile)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,luaJitFile)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,luauFile)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,nutFile)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,nutModifiedFile)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,asFile)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,jsFile)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,monoFile)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,dotNetFile)==64,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__, TArray<uint8_t> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline bool isplaceok_d34b29d01b1aafa6 ( Context * __context__, TDim<int32_t,8> const  & __a_rename_at_10_36, int32_t __n_rename_at_10_37, int32_t __c_rename_at_10_38, int32_t __cmn_rename_at_10_39, int32_t __cpn_rename_at_10_40 );
+inline void addqueen_98363a3aeb83efac ( Context * __context__, TDim<int32_t,8> & __a_rename_at_22_43, int32_t __n_rename_at_22_44 );
+inline void test_459093ea6c06ee6 ( Context * __context__ );
+inline TArray<uint8_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__, TDim<uint8_t,3> & __a_rename_at_1502_48 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    TArray<uint8_t> _temp_make_local_35_22_0;
+    TDim<uint8_t,3> _temp_make_local_35_22_1;
+    das_global_solid<char *,0>(__context__) = ((char * const )(builtin_string_from_array(das_arg<TArray<uint8_t>>::pass((_temp_make_local_35_22_0 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4(__context__,das_arg<TDim<uint8_t,3>>::pass((([&]() -> TDim<uint8_t,3>& {
+        _temp_make_local_35_22_1(0,__context__) = 0xef;
+        _temp_make_local_35_22_1(1,__context__) = 0xbb;
+        _temp_make_local_35_22_1(2,__context__) = 0xbf;
+        return _temp_make_local_35_22_1;
+    })())))))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));/*ENCODING*/
+    das_global_zero_solid<int32_t,16>(__context__);/*solutions*/
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__, TArray<uint8_t> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<uint8_t>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,1,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline bool isplaceok_d34b29d01b1aafa6 ( Context * __context__, TDim<int32_t,8> const  &  __a_rename_at_10_36, int32_t __n_rename_at_10_37, int32_t __c_rename_at_10_38, int32_t __cmn_rename_at_10_39, int32_t __cpn_rename_at_10_40 )
+{
+    {
+        bool __need_loop_11 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(mk_range(__n_rename_at_10_37));
+        int32_t __i_rename_at_11_41;
+        __need_loop_11 = __i_iterator.first(__context__,(__i_rename_at_11_41)) && __need_loop_11;
+        for ( ; __need_loop_11 ; __need_loop_11 = __i_iterator.next(__context__,(__i_rename_at_11_41)) )
+        {
+            int32_t __ai_rename_at_12_42 = ((int32_t)__a_rename_at_10_36(__i_rename_at_11_41,__context__));
+            if ( ((__ai_rename_at_12_42 == __c_rename_at_10_38) || (__ai_rename_at_12_42 == (__cmn_rename_at_10_39 + __i_rename_at_11_41))) || (__ai_rename_at_12_42 == (__cpn_rename_at_10_40 - __i_rename_at_11_41)) )
+            {
+                return das_auto_cast<bool>::cast(false);
+            };
+        }
+        __i_iterator.close(__context__,(__i_rename_at_11_41));
+    };
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline void addqueen_98363a3aeb83efac ( Context * __context__, TDim<int32_t,8> &  __a_rename_at_22_43, int32_t __n_rename_at_22_44 )
+{
+    {
+        bool __need_loop_23 = true;
+        // c: int const
+        das_iterator<range> __c_iterator(range(0,8));
+        int32_t __c_rename_at_23_45;
+        __need_loop_23 = __c_iterator.first(__context__,(__c_rename_at_23_45)) && __need_loop_23;
+        for ( ; __need_loop_23 ; __need_loop_23 = __c_iterator.next(__context__,(__c_rename_at_23_45)) )
+        {
+            if ( isplaceok_d34b29d01b1aafa6(__context__,das_arg<TDim<int32_t,8>>::pass(__a_rename_at_22_43),__n_rename_at_22_44,__c_rename_at_23_45,__c_rename_at_23_45 - __n_rename_at_22_44,__c_rename_at_23_45 + __n_rename_at_22_44) )
+            {
+                das_copy(__a_rename_at_22_43(__n_rename_at_22_44,__context__),__c_rename_at_23_45);
+                if ( __n_rename_at_22_44 == 7 )
+                {
+                    ++das_global<int32_t,0xadf12889d093dbf>(__context__) /*solutions*/;
+                } else {
+                    addqueen_98363a3aeb83efac(__context__,das_arg<TDim<int32_t,8>>::pass(__a_rename_at_22_43),__n_rename_at_22_44 + 1);
+                };
+            };
+        }
+        __c_iterator.close(__context__,(__c_rename_at_23_45));
+    };
+}
+
+inline void test_459093ea6c06ee6 ( Context * __context__ )
+{
+    das_copy(das_global<int32_t,0xadf12889d093dbf>(__context__) /*solutions*/,0);
+    TDim<int32_t,8> __a_rename_at_37_46;das_zero(__a_rename_at_37_46);
+    addqueen_98363a3aeb83efac(__context__,das_arg<TDim<int32_t,8>>::pass(__a_rename_at_37_46),0);
+    DAS_ASSERT((das_global<int32_t,0xadf12889d093dbf>(__context__) /*solutions*/ == 92));
+}
+
+inline TArray<uint8_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__, TDim<uint8_t,3> &  __a_rename_at_1502_48 )
+{
+    TArray<uint8_t> __arr_rename_at_1504_49;das_zero(__arr_rename_at_1504_49);
+    _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111(__context__,das_arg<TArray<uint8_t>>::pass(__arr_rename_at_1504_49),3);
+    das_copy(das_cast<TDim<uint8_t,3>>::cast(das_ref(__context__,__arr_rename_at_1504_49(0,__context__))),__a_rename_at_1502_48);
+    return /* <- */ das_auto_cast_move<TArray<uint8_t>>::cast(__arr_rename_at_1504_49);
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__ ) {
+    TArray<uint8_t> &  arg_Arr = cast_aot_arg<TArray<uint8_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap_isplaceok_d34b29d01b1aafa6 ( Context * __context__ ) {
+    TDim<int32_t,8> const  &  arg_a = cast_aot_arg<TDim<int32_t,8> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_n = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_c = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    int32_t arg_cmn = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[3]);
+    int32_t arg_cpn = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[4]);
+    return cast<bool>::from(isplaceok_d34b29d01b1aafa6(__context__, arg_a, arg_n, arg_c, arg_cmn, arg_cpn));
+}
+static vec4f __wrap_addqueen_98363a3aeb83efac ( Context * __context__ ) {
+    TDim<int32_t,8> &  arg_a = cast_aot_arg<TDim<int32_t,8> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_n = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    addqueen_98363a3aeb83efac(__context__, arg_a, arg_n);
+    return v_zero();
+}
+static vec4f __wrap_test_459093ea6c06ee6 ( Context * __context__ ) {
+    test_459093ea6c06ee6(__context__);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__ ) {
+    TDim<uint8_t,3> &  arg_a = cast_aot_arg<TDim<uint8_t,3> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<uint8_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x43319db4719733d6, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 },
+    { 0xe7d0a8dada4abbdd, false, (void*)&isplaceok_d34b29d01b1aafa6, &__wrap_isplaceok_d34b29d01b1aafa6 },
+    { 0xe7eb3e30b2489b36, false, (void*)&addqueen_98363a3aeb83efac, &__wrap_addqueen_98363a3aeb83efac },
+    { 0xe6d81671ee9683ae, false, (void*)&test_459093ea6c06ee6, &__wrap_test_459093ea6c06ee6 },
+    { 0x60b407c06982729e, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0xf4e6d230ef5d49f9, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_12892529406447683061
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,392 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require fio
+#include "daScript/misc/performance_time.h"
+#include "daScript/simulate/aot_builtin_fio.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_1868540203243856035 {
+
+namespace  { struct TestFile; };
+namespace fio { struct df_header; };
+// unused enumeration ConversionResult
+// unused structure df_header
+namespace  {
+
+struct TestFile {
+    char * luaFile;
+    char * luaJitFile;
+    char * luauFile;
+    char * nutFile;
+    char * nutModifiedFile;
+    char * asFile;
+    char * jsFile;
+    char * monoFile;
+    char * dotNetFile;
+};
+static_assert(sizeof(TestFile)==72,"structure size mismatch with DAS");
+static_assert(offsetof(TestFile,luaFile)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,luaJitFile)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,luauFile)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,nutFile)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,nutModifiedFile)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,asFile)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,jsFile)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,monoFile)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,dotNetFile)==64,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__, TArray<uint8_t> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline void _FuncbuiltinTickpushTick14133213201864676143_a295abf396ef30f8 ( Context * __context__, TArray<uint8_t> & __Arr_rename_at_177_2, uint8_t __value_rename_at_177_3 );
+inline char * toHex_17b10b8aec7ede98 ( Context * __context__, TDim<uint32_t,8> const  & __hash_rename_at_32_38 );
+inline void digestBlock_4c67c6959228fb17 ( Context * __context__, uint32_t * const  __data_rename_at_42_42, TDim<uint32_t,8> & __hash_rename_at_42_43 );
+inline char * sha256_b6914af1eba4f1d7 ( Context * __context__, TArray<uint8_t> const  & __msg_rename_at_91_66 );
+inline TArray<uint8_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__, TDim<uint8_t,3> & __a_rename_at_1502_75 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    TArray<uint8_t> _temp_make_local_35_22_0;
+    TDim<uint8_t,3> _temp_make_local_35_22_1;
+    das_global_solid<char *,0>(__context__) = ((char * const )(builtin_string_from_array(das_arg<TArray<uint8_t>>::pass((_temp_make_local_35_22_0 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4(__context__,das_arg<TDim<uint8_t,3>>::pass((([&]() -> TDim<uint8_t,3>& {
+        _temp_make_local_35_22_1(0,__context__) = 0xef;
+        _temp_make_local_35_22_1(1,__context__) = 0xbb;
+        _temp_make_local_35_22_1(2,__context__) = 0xbf;
+        return _temp_make_local_35_22_1;
+    })())))))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));/*ENCODING*/
+    das_global_solid<TDim<uint32_t,64>,16>(__context__) = (([&]() -> TDim<uint32_t,64> {
+        TDim<uint32_t,64> __mka_12;
+        __mka_12(0,__context__) = 0x428a2f98u;
+        __mka_12(1,__context__) = 0x71374491u;
+        __mka_12(2,__context__) = 0xb5c0fbcfu;
+        __mka_12(3,__context__) = 0xe9b5dba5u;
+        __mka_12(4,__context__) = 0x3956c25bu;
+        __mka_12(5,__context__) = 0x59f111f1u;
+        __mka_12(6,__context__) = 0x923f82a4u;
+        __mka_12(7,__context__) = 0xab1c5ed5u;
+        __mka_12(8,__context__) = 0xd807aa98u;
+        __mka_12(9,__context__) = 0x12835b01u;
+        __mka_12(10,__context__) = 0x243185beu;
+        __mka_12(11,__context__) = 0x550c7dc3u;
+        __mka_12(12,__context__) = 0x72be5d74u;
+        __mka_12(13,__context__) = 0x80deb1feu;
+        __mka_12(14,__context__) = 0x9bdc06a7u;
+        __mka_12(15,__context__) = 0xc19bf174u;
+        __mka_12(16,__context__) = 0xe49b69c1u;
+        __mka_12(17,__context__) = 0xefbe4786u;
+        __mka_12(18,__context__) = 0xfc19dc6u;
+        __mka_12(19,__context__) = 0x240ca1ccu;
+        __mka_12(20,__context__) = 0x2de92c6fu;
+        __mka_12(21,__context__) = 0x4a7484aau;
+        __mka_12(22,__context__) = 0x5cb0a9dcu;
+        __mka_12(23,__context__) = 0x76f988dau;
+        __mka_12(24,__context__) = 0x983e5152u;
+        __mka_12(25,__context__) = 0xa831c66du;
+        __mka_12(26,__context__) = 0xb00327c8u;
+        __mka_12(27,__context__) = 0xbf597fc7u;
+        __mka_12(28,__context__) = 0xc6e00bf3u;
+        __mka_12(29,__context__) = 0xd5a79147u;
+        __mka_12(30,__context__) = 0x6ca6351u;
+        __mka_12(31,__context__) = 0x14292967u;
+        __mka_12(32,__context__) = 0x27b70a85u;
+        __mka_12(33,__context__) = 0x2e1b2138u;
+        __mka_12(34,__context__) = 0x4d2c6dfcu;
+        __mka_12(35,__context__) = 0x53380d13u;
+        __mka_12(36,__context__) = 0x650a7354u;
+        __mka_12(37,__context__) = 0x766a0abbu;
+        __mka_12(38,__context__) = 0x81c2c92eu;
+        __mka_12(39,__context__) = 0x92722c85u;
+        __mka_12(40,__context__) = 0xa2bfe8a1u;
+        __mka_12(41,__context__) = 0xa81a664bu;
+        __mka_12(42,__context__) = 0xc24b8b70u;
+        __mka_12(43,__context__) = 0xc76c51a3u;
+        __mka_12(44,__context__) = 0xd192e819u;
+        __mka_12(45,__context__) = 0xd6990624u;
+        __mka_12(46,__context__) = 0xf40e3585u;
+        __mka_12(47,__context__) = 0x106aa070u;
+        __mka_12(48,__context__) = 0x19a4c116u;
+        __mka_12(49,__context__) = 0x1e376c08u;
+        __mka_12(50,__context__) = 0x2748774cu;
+        __mka_12(51,__context__) = 0x34b0bcb5u;
+        __mka_12(52,__context__) = 0x391c0cb3u;
+        __mka_12(53,__context__) = 0x4ed8aa4au;
+        __mka_12(54,__context__) = 0x5b9cca4fu;
+        __mka_12(55,__context__) = 0x682e6ff3u;
+        __mka_12(56,__context__) = 0x748f82eeu;
+        __mka_12(57,__context__) = 0x78a5636fu;
+        __mka_12(58,__context__) = 0x84c87814u;
+        __mka_12(59,__context__) = 0x8cc70208u;
+        __mka_12(60,__context__) = 0x90befffau;
+        __mka_12(61,__context__) = 0xa4506cebu;
+        __mka_12(62,__context__) = 0xbef9a3f7u;
+        __mka_12(63,__context__) = 0xc67178f2u;
+        return __mka_12;
+    })());/*primes*/
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__, TArray<uint8_t> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<uint8_t>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,1,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickpushTick14133213201864676143_a295abf396ef30f8 ( Context * __context__, TArray<uint8_t> &  __Arr_rename_at_177_2, uint8_t __value_rename_at_177_3 )
+{
+    das_copy(__Arr_rename_at_177_2(builtin_array_push_back(das_arg<TArray<uint8_t>>::pass(__Arr_rename_at_177_2),1,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_177_3);
+}
+
+inline char * toHex_17b10b8aec7ede98 ( Context * __context__, TDim<uint32_t,8> const  &  __hash_rename_at_32_38 )
+{
+    char * __st_rename_at_33_39 = ((char *)(char *)(((char * const )(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_33_40) DAS_AOT_INLINE_LAMBDA -> void{
+        {
+            bool __need_loop_34 = true;
+            // i: uint const&
+            das_iterator<TDim<uint32_t,8> const > __i_iterator(__hash_rename_at_32_38);
+            uint32_t const  * __i_rename_at_34_41;
+            __need_loop_34 = __i_iterator.first(__context__,(__i_rename_at_34_41)) && __need_loop_34;
+            for ( ; __need_loop_34 ; __need_loop_34 = __i_iterator.next(__context__,(__i_rename_at_34_41)) )
+            {
+                format_and_write<uint32_t>(das_arg<StringBuilderWriter>::pass(__writer_rename_at_33_40),((char *) "%08x"),(*__i_rename_at_34_41));
+            }
+            __i_iterator.close(__context__,(__i_rename_at_34_41));
+        };
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+    return das_auto_cast<char *>::cast(__st_rename_at_33_39);
+}
+
+inline void digestBlock_4c67c6959228fb17 ( Context * __context__, uint32_t * const  __data_rename_at_42_42, TDim<uint32_t,8> &  __hash_rename_at_42_43 )
+{
+    TDim<uint32_t,64> __digest_rename_at_43_44;das_zero(__digest_rename_at_43_44);
+    {
+        bool __need_loop_44 = true;
+        // j: int const
+        das_iterator<range> __j_iterator(range(0,16));
+        int32_t __j_rename_at_44_45;
+        __need_loop_44 = __j_iterator.first(__context__,(__j_rename_at_44_45)) && __need_loop_44;
+        for ( ; __need_loop_44 ; __need_loop_44 = __j_iterator.next(__context__,(__j_rename_at_44_45)) )
+        {
+            das_copy(__digest_rename_at_43_44(__j_rename_at_44_45,__context__),das_index<uint32_t * const >::at(__data_rename_at_42_42,__j_rename_at_44_45,__context__));
+        }
+        __j_iterator.close(__context__,(__j_rename_at_44_45));
+    };
+    {
+        bool __need_loop_49 = true;
+        // j: int const
+        das_iterator<range> __j_iterator(range(16,64));
+        int32_t __j_rename_at_49_46;
+        __need_loop_49 = __j_iterator.first(__context__,(__j_rename_at_49_46)) && __need_loop_49;
+        for ( ; __need_loop_49 ; __need_loop_49 = __j_iterator.next(__context__,(__j_rename_at_49_46)) )
+        {
+            uint32_t __v0_rename_at_50_47 = ((uint32_t)__digest_rename_at_43_44((__j_rename_at_49_46 - 15),__context__));
+            uint32_t __s0_rename_at_51_48 = ((uint32_t)(((SimPolicy<uint32_t>::BinRotr(__v0_rename_at_50_47,0x7u,*__context__,nullptr)) ^ (SimPolicy<uint32_t>::BinRotr(__v0_rename_at_50_47,0x12u,*__context__,nullptr))) ^ (SimPolicy<uint32_t>::BinShr(__v0_rename_at_50_47,0x3u,*__context__,nullptr))));
+            uint32_t __v1_rename_at_52_49 = ((uint32_t)__digest_rename_at_43_44((__j_rename_at_49_46 - 2),__context__));
+            uint32_t __s1_rename_at_53_50 = ((uint32_t)(((SimPolicy<uint32_t>::BinRotr(__v1_rename_at_52_49,0x11u,*__context__,nullptr)) ^ (SimPolicy<uint32_t>::BinRotr(__v1_rename_at_52_49,0x13u,*__context__,nullptr))) ^ (SimPolicy<uint32_t>::BinShr(__v1_rename_at_52_49,0xau,*__context__,nullptr))));
+            das_copy(__digest_rename_at_43_44(__j_rename_at_49_46,__context__),((__digest_rename_at_43_44((__j_rename_at_49_46 - 16),__context__) + __s0_rename_at_51_48) + __digest_rename_at_43_44((__j_rename_at_49_46 - 7),__context__)) + __s1_rename_at_53_50);
+        }
+        __j_iterator.close(__context__,(__j_rename_at_49_46));
+    };
+    uint32_t __a_rename_at_56_51 = __hash_rename_at_42_43(0,__context__);
+    uint32_t __b_rename_at_57_52 = __hash_rename_at_42_43(1,__context__);
+    uint32_t __c_rename_at_58_53 = __hash_rename_at_42_43(2,__context__);
+    uint32_t __d_rename_at_59_54 = __hash_rename_at_42_43(3,__context__);
+    uint32_t __e_rename_at_60_55 = __hash_rename_at_42_43(4,__context__);
+    uint32_t __f_rename_at_61_56 = __hash_rename_at_42_43(5,__context__);
+    uint32_t __g_rename_at_62_57 = __hash_rename_at_42_43(6,__context__);
+    uint32_t __h_rename_at_63_58 = __hash_rename_at_42_43(7,__context__);
+    {
+        bool __need_loop_64 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(0,64));
+        int32_t __i_rename_at_64_59;
+        __need_loop_64 = __i_iterator.first(__context__,(__i_rename_at_64_59)) && __need_loop_64;
+        for ( ; __need_loop_64 ; __need_loop_64 = __i_iterator.next(__context__,(__i_rename_at_64_59)) )
+        {
+            uint32_t __s0_rename_at_65_60 = ((uint32_t)(((SimPolicy<uint32_t>::BinRotr(__a_rename_at_56_51,0x2u,*__context__,nullptr)) ^ (SimPolicy<uint32_t>::BinRotr(__a_rename_at_56_51,0xdu,*__context__,nullptr))) ^ (SimPolicy<uint32_t>::BinRotr(__a_rename_at_56_51,0x16u,*__context__,nullptr))));
+            uint32_t __maj_rename_at_66_61 = ((uint32_t)(((__a_rename_at_56_51 & __b_rename_at_57_52) ^ (__a_rename_at_56_51 & __c_rename_at_58_53)) ^ (__b_rename_at_57_52 & __c_rename_at_58_53)));
+            uint32_t __t2_rename_at_67_62 = ((uint32_t)(__s0_rename_at_65_60 + __maj_rename_at_66_61));
+            uint32_t __s1_rename_at_68_63 = ((uint32_t)(((SimPolicy<uint32_t>::BinRotr(__e_rename_at_60_55,0x6u,*__context__,nullptr)) ^ (SimPolicy<uint32_t>::BinRotr(__e_rename_at_60_55,0xbu,*__context__,nullptr))) ^ (SimPolicy<uint32_t>::BinRotr(__e_rename_at_60_55,0x19u,*__context__,nullptr))));
+            uint32_t __ch_rename_at_69_64 = ((uint32_t)((__e_rename_at_60_55 & __f_rename_at_61_56) ^ (~__e_rename_at_60_55 & __g_rename_at_62_57)));
+            uint32_t __t1_rename_at_70_65 = ((uint32_t)((((__h_rename_at_63_58 + __s1_rename_at_68_63) + __ch_rename_at_69_64) + das_global<TDim<uint32_t,64>,0xd48b96b7f6f13a6f>(__context__) /*primes*/(__i_rename_at_64_59,__context__)) + __digest_rename_at_43_44(__i_rename_at_64_59,__context__)));
+            das_copy(__h_rename_at_63_58,__g_rename_at_62_57);
+            das_copy(__g_rename_at_62_57,__f_rename_at_61_56);
+            das_copy(__f_rename_at_61_56,__e_rename_at_60_55);
+            das_copy(__e_rename_at_60_55,__d_rename_at_59_54 + __t1_rename_at_70_65);
+            das_copy(__d_rename_at_59_54,__c_rename_at_58_53);
+            das_copy(__c_rename_at_58_53,__b_rename_at_57_52);
+            das_copy(__b_rename_at_57_52,__a_rename_at_56_51);
+            das_copy(__a_rename_at_56_51,__t1_rename_at_70_65 + __t2_rename_at_67_62);
+        }
+        __i_iterator.close(__context__,(__i_rename_at_64_59));
+    };
+    __hash_rename_at_42_43(0,__context__) += __a_rename_at_56_51;
+    __hash_rename_at_42_43(1,__context__) += __b_rename_at_57_52;
+    __hash_rename_at_42_43(2,__context__) += __c_rename_at_58_53;
+    __hash_rename_at_42_43(3,__context__) += __d_rename_at_59_54;
+    __hash_rename_at_42_43(4,__context__) += __e_rename_at_60_55;
+    __hash_rename_at_42_43(5,__context__) += __f_rename_at_61_56;
+    __hash_rename_at_42_43(6,__context__) += __g_rename_at_62_57;
+    __hash_rename_at_42_43(7,__context__) += __h_rename_at_63_58;
+}
+
+inline char * sha256_b6914af1eba4f1d7 ( Context * __context__, TArray<uint8_t> const  &  __msg_rename_at_91_66 )
+{
+    TDim<uint32_t,8> __hash_rename_at_92_67 = (([&]() -> TDim<uint32_t,8> {
+        TDim<uint32_t,8> __mka_92;
+        __mka_92(0,__context__) = 0x6a09e667u;
+        __mka_92(1,__context__) = 0xbb67ae85u;
+        __mka_92(2,__context__) = 0x3c6ef372u;
+        __mka_92(3,__context__) = 0xa54ff53au;
+        __mka_92(4,__context__) = 0x510e527fu;
+        __mka_92(5,__context__) = 0x9b05688cu;
+        __mka_92(6,__context__) = 0x1f83d9abu;
+        __mka_92(7,__context__) = 0x5be0cd19u;
+        return __mka_92;
+    })());
+    int32_t __len_rename_at_102_68 = ((int32_t)(SimPolicy<int32_t>::Div(builtin_array_size(__msg_rename_at_91_66),64,*__context__,nullptr)));
+    {
+        bool __need_loop_103 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(mk_range(__len_rename_at_102_68));
+        int32_t __i_rename_at_103_69;
+        __need_loop_103 = __i_iterator.first(__context__,(__i_rename_at_103_69)) && __need_loop_103;
+        for ( ; __need_loop_103 ; __need_loop_103 = __i_iterator.next(__context__,(__i_rename_at_103_69)) )
+        {
+            digestBlock_4c67c6959228fb17(__context__,das_cast<uint32_t *>::cast(das_ref(__context__,__msg_rename_at_91_66((__i_rename_at_103_69 * 64),__context__))),das_arg<TDim<uint32_t,8>>::pass(__hash_rename_at_92_67));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_103_69));
+    };
+    return das_auto_cast<char *>::cast(toHex_17b10b8aec7ede98(__context__,das_arg<TDim<uint32_t,8>>::pass(__hash_rename_at_92_67)));
+}
+
+inline TArray<uint8_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__, TDim<uint8_t,3> &  __a_rename_at_1502_75 )
+{
+    TArray<uint8_t> __arr_rename_at_1504_76;das_zero(__arr_rename_at_1504_76);
+    _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111(__context__,das_arg<TArray<uint8_t>>::pass(__arr_rename_at_1504_76),3);
+    das_copy(das_cast<TDim<uint8_t,3>>::cast(das_ref(__context__,__arr_rename_at_1504_76(0,__context__))),__a_rename_at_1502_75);
+    return /* <- */ das_auto_cast_move<TArray<uint8_t>>::cast(__arr_rename_at_1504_76);
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__ ) {
+    TArray<uint8_t> &  arg_Arr = cast_aot_arg<TArray<uint8_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpushTick14133213201864676143_a295abf396ef30f8 ( Context * __context__ ) {
+    TArray<uint8_t> &  arg_Arr = cast_aot_arg<TArray<uint8_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    uint8_t arg_value = cast_aot_arg<uint8_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick14133213201864676143_a295abf396ef30f8(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap_toHex_17b10b8aec7ede98 ( Context * __context__ ) {
+    TDim<uint32_t,8> const  &  arg_hash = cast_aot_arg<TDim<uint32_t,8> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<char *>::from(toHex_17b10b8aec7ede98(__context__, arg_hash));
+}
+static vec4f __wrap_digestBlock_4c67c6959228fb17 ( Context * __context__ ) {
+    uint32_t * const  arg_data = cast_aot_arg<uint32_t * const >::to(*__context__,__context__->abiArguments()[0]);
+    TDim<uint32_t,8> &  arg_hash = cast_aot_arg<TDim<uint32_t,8> & >::to(*__context__,__context__->abiArguments()[1]);
+    digestBlock_4c67c6959228fb17(__context__, arg_data, arg_hash);
+    return v_zero();
+}
+static vec4f __wrap_sha256_b6914af1eba4f1d7 ( Context * __context__ ) {
+    TArray<uint8_t> const  &  arg_msg = cast_aot_arg<TArray<uint8_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<char *>::from(sha256_b6914af1eba4f1d7(__context__, arg_msg));
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__ ) {
+    TDim<uint8_t,3> &  arg_a = cast_aot_arg<TDim<uint8_t,3> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<uint8_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x43319db4719733d6, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 },
+    { 0x89792d67359db3ab, false, (void*)&_FuncbuiltinTickpushTick14133213201864676143_a295abf396ef30f8, &__wrap__FuncbuiltinTickpushTick14133213201864676143_a295abf396ef30f8 },
+    { 0xf492ef7ae25cb525, false, (void*)&toHex_17b10b8aec7ede98, &__wrap_toHex_17b10b8aec7ede98 },
+    { 0x531a869665daf108, false, (void*)&digestBlock_4c67c6959228fb17, &__wrap_digestBlock_4c67c6959228fb17 },
+    { 0x76aa37e97fe7374c, false, (void*)&sha256_b6914af1eba4f1d7, &__wrap_sha256_b6914af1eba4f1d7 },
+    { 0x60b407c06982729e, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0xb7cc57830e927111, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_1868540203243856035
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
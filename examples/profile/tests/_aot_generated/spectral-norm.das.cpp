@@ -0,0 +1,339 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require testProfile
+#include "test_profile.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require fio
+#include "daScript/misc/performance_time.h"
+#include "daScript/simulate/aot_builtin_fio.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_1580935561784984716 {
+
+namespace  { struct TestFile; };
+namespace fio { struct df_header; };
+// unused enumeration ConversionResult
+// unused structure df_header
+namespace  {
+
+struct TestFile {
+    char * luaFile;
+    char * luaJitFile;
+    char * luauFile;
+    char * nutFile;
+    char * nutModifiedFile;
+    char * asFile;
+    char * jsFile;
+    char * monoFile;
+    char * dotNetFile;
+};
+static_assert(sizeof(TestFile)==72,"structure size mismatch with DAS");
+static_assert(offsetof(TestFile,luaFile)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,luaJitFile)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,luauFile)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,nutFile)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,nutModifiedFile)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,asFile)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,jsFile)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,monoFile)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,dotNetFile)==64,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__, TArray<uint8_t> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline double A_49fa5bf8c4546fb6 ( Context * __context__, int32_t __i_rename_at_15_36, int32_t __j_rename_at_15_37 );
+inline double dot_4d0013f523b283ad ( Context * __context__, TDim<double,500> const  & __v_rename_at_19_38, TDim<double,500> const  & __u_rename_at_19_39 );
+inline void mult_Av_233ca2368951331a ( Context * __context__, TDim<double,500> const  & __v_rename_at_27_45, TDim<double,500> & __out_rename_at_27_46 );
+inline void mult_Atv_b1addcc069fe71da ( Context * __context__, TDim<double,500> const  & __v_rename_at_37_50, TDim<double,500> & __out_rename_at_37_51 );
+inline void mult_AtAv_261cef8ccdfac424 ( Context * __context__, TDim<double,500> const  & __v_rename_at_48_55, TDim<double,500> & __out_rename_at_48_56 );
+inline double test_df83f97e52ebe576 ( Context * __context__ );
+inline TArray<uint8_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__, TDim<uint8_t,3> & __a_rename_at_1502_64 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    TArray<uint8_t> _temp_make_local_35_22_0;
+    TDim<uint8_t,3> _temp_make_local_35_22_1;
+    das_global_solid<char *,0>(__context__) = ((char * const )(builtin_string_from_array(das_arg<TArray<uint8_t>>::pass((_temp_make_local_35_22_0 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4(__context__,das_arg<TDim<uint8_t,3>>::pass((([&]() -> TDim<uint8_t,3>& {
+        _temp_make_local_35_22_1(0,__context__) = 0xef;
+        _temp_make_local_35_22_1(1,__context__) = 0xbb;
+        _temp_make_local_35_22_1(2,__context__) = 0xbf;
+        return _temp_make_local_35_22_1;
+    })())))))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));/*ENCODING*/
+    das_global_zero_solid<TDim<double,500>,16>(__context__);/*tmp*/
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__, TArray<uint8_t> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<uint8_t>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,1,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline double A_49fa5bf8c4546fb6 ( Context * __context__, int32_t __i_rename_at_15_36, int32_t __j_rename_at_15_37 )
+{
+    return das_auto_cast<double>::cast(double(((SimPolicy<int32_t>::BinShr(((__i_rename_at_15_36 + __j_rename_at_15_37) * ((__i_rename_at_15_36 + __j_rename_at_15_37) + 1)),1,*__context__,nullptr)) + __i_rename_at_15_36) + 1));
+}
+
+inline double dot_4d0013f523b283ad ( Context * __context__, TDim<double,500> const  &  __v_rename_at_19_38, TDim<double,500> const  &  __u_rename_at_19_39 )
+{
+    double __sum_rename_at_20_40 = 0.000000e+00;
+    {
+        bool __need_loop_21 = true;
+        // V: double const&
+        das_iterator<TDim<double,500> const > __V_iterator(__v_rename_at_19_38);
+        double const  * __V_rename_at_21_43;
+        __need_loop_21 = __V_iterator.first(__context__,(__V_rename_at_21_43)) && __need_loop_21;
+        // U: double const&
+        das_iterator<TDim<double,500> const > __U_iterator(__u_rename_at_19_39);
+        double const  * __U_rename_at_21_44;
+        __need_loop_21 = __U_iterator.first(__context__,(__U_rename_at_21_44)) && __need_loop_21;
+        for ( ; __need_loop_21 ; __need_loop_21 = __V_iterator.next(__context__,(__V_rename_at_21_43)) && __U_iterator.next(__context__,(__U_rename_at_21_44)) )
+        {
+            __sum_rename_at_20_40 += ((*__V_rename_at_21_43) * (*__U_rename_at_21_44));
+        }
+        __U_iterator.close(__context__,(__U_rename_at_21_44));
+        __V_iterator.close(__context__,(__V_rename_at_21_43));
+    };
+    return das_auto_cast<double>::cast(__sum_rename_at_20_40);
+}
+
+inline void mult_Av_233ca2368951331a ( Context * __context__, TDim<double,500> const  &  __v_rename_at_27_45, TDim<double,500> &  __out_rename_at_27_46 )
+{
+    {
+        bool __need_loop_28 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(0,500));
+        int32_t __i_rename_at_28_47;
+        __need_loop_28 = __i_iterator.first(__context__,(__i_rename_at_28_47)) && __need_loop_28;
+        for ( ; __need_loop_28 ; __need_loop_28 = __i_iterator.next(__context__,(__i_rename_at_28_47)) )
+        {
+            double __sum_rename_at_29_48 = 0.000000e+00;
+            {
+                bool __need_loop_30 = true;
+                // j: int const
+                das_iterator<range> __j_iterator(range(0,500));
+                int32_t __j_rename_at_30_49;
+                __need_loop_30 = __j_iterator.first(__context__,(__j_rename_at_30_49)) && __need_loop_30;
+                for ( ; __need_loop_30 ; __need_loop_30 = __j_iterator.next(__context__,(__j_rename_at_30_49)) )
+                {
+                    __sum_rename_at_29_48 += (SimPolicy<double>::Div(__v_rename_at_27_45(__j_rename_at_30_49,__context__),A_49fa5bf8c4546fb6(__context__,__i_rename_at_28_47,__j_rename_at_30_49),*__context__,nullptr));
+                }
+                __j_iterator.close(__context__,(__j_rename_at_30_49));
+            };
+            das_copy(__out_rename_at_27_46(__i_rename_at_28_47,__context__),__sum_rename_at_29_48);
+        }
+        __i_iterator.close(__context__,(__i_rename_at_28_47));
+    };
+}
+
+inline void mult_Atv_b1addcc069fe71da ( Context * __context__, TDim<double,500> const  &  __v_rename_at_37_50, TDim<double,500> &  __out_rename_at_37_51 )
+{
+    {
+        bool __need_loop_38 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(0,500));
+        int32_t __i_rename_at_38_52;
+        __need_loop_38 = __i_iterator.first(__context__,(__i_rename_at_38_52)) && __need_loop_38;
+        for ( ; __need_loop_38 ; __need_loop_38 = __i_iterator.next(__context__,(__i_rename_at_38_52)) )
+        {
+            double __sum_rename_at_39_53 = 0.000000e+00;
+            {
+                bool __need_loop_40 = true;
+                // j: int const
+                das_iterator<range> __j_iterator(range(0,500));
+                int32_t __j_rename_at_40_54;
+                __need_loop_40 = __j_iterator.first(__context__,(__j_rename_at_40_54)) && __need_loop_40;
+                for ( ; __need_loop_40 ; __need_loop_40 = __j_iterator.next(__context__,(__j_rename_at_40_54)) )
+                {
+                    __sum_rename_at_39_53 += (SimPolicy<double>::Div(__v_rename_at_37_50(__j_rename_at_40_54,__context__),A_49fa5bf8c4546fb6(__context__,__j_rename_at_40_54,__i_rename_at_38_52),*__context__,nullptr));
+                }
+                __j_iterator.close(__context__,(__j_rename_at_40_54));
+            };
+            das_copy(__out_rename_at_37_51(__i_rename_at_38_52,__context__),__sum_rename_at_39_53);
+        }
+        __i_iterator.close(__context__,(__i_rename_at_38_52));
+    };
+}
+
+inline void mult_AtAv_261cef8ccdfac424 ( Context * __context__, TDim<double,500> const  &  __v_rename_at_48_55, TDim<double,500> &  __out_rename_at_48_56 )
+{
+    mult_Av_233ca2368951331a(__context__,__v_rename_at_48_55,das_arg<TDim<double,500>>::pass(das_global<TDim<double,500>,0x275bb4c8ce345a75>(__context__) /*tmp*/));
+    mult_Atv_b1addcc069fe71da(__context__,das_arg<TDim<double,500>>::pass(das_global<TDim<double,500>,0x275bb4c8ce345a75>(__context__) /*tmp*/),das_arg<TDim<double,500>>::pass(__out_rename_at_48_56));
+}
+
+inline double test_df83f97e52ebe576 ( Context * __context__ )
+{
+    TDim<double,500> __u_rename_at_55_57;das_zero(__u_rename_at_55_57); TDim<double,500> __v_rename_at_55_58;das_zero(__v_rename_at_55_58);
+    {
+        bool __need_loop_56 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(0,500));
+        int32_t __i_rename_at_56_59;
+        __need_loop_56 = __i_iterator.first(__context__,(__i_rename_at_56_59)) && __need_loop_56;
+        for ( ; __need_loop_56 ; __need_loop_56 = __i_iterator.next(__context__,(__i_rename_at_56_59)) )
+        {
+            das_copy(__u_rename_at_55_57(__i_rename_at_56_59,__context__),1.000000e+00);
+        }
+        __i_iterator.close(__context__,(__i_rename_at_56_59));
+    };
+    {
+        bool __need_loop_59 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(0,10));
+        int32_t __i_rename_at_59_60;
+        __need_loop_59 = __i_iterator.first(__context__,(__i_rename_at_59_60)) && __need_loop_59;
+        for ( ; __need_loop_59 ; __need_loop_59 = __i_iterator.next(__context__,(__i_rename_at_59_60)) )
+        {
+            mult_AtAv_261cef8ccdfac424(__context__,das_arg<TDim<double,500>>::pass(__u_rename_at_55_57),das_arg<TDim<double,500>>::pass(__v_rename_at_55_58));
+            mult_AtAv_261cef8ccdfac424(__context__,das_arg<TDim<double,500>>::pass(__v_rename_at_55_58),das_arg<TDim<double,500>>::pass(__u_rename_at_55_57));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_59_60));
+    };
+    double __vBv_rename_at_63_61 = dot_4d0013f523b283ad(__context__,das_arg<TDim<double,500>>::pass(__u_rename_at_55_57),das_arg<TDim<double,500>>::pass(__v_rename_at_55_58));
+    double __vv_rename_at_64_62 = dot_4d0013f523b283ad(__context__,das_arg<TDim<double,500>>::pass(__v_rename_at_55_58),das_arg<TDim<double,500>>::pass(__v_rename_at_55_58));
+    return das_auto_cast<double>::cast(dsqrt(SimPolicy<double>::Div(__vBv_rename_at_63_61,__vv_rename_at_64_62,*__context__,nullptr)));
+}
+
+inline TArray<uint8_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__, TDim<uint8_t,3> &  __a_rename_at_1502_64 )
+{
+    TArray<uint8_t> __arr_rename_at_1504_65;das_zero(__arr_rename_at_1504_65);
+    _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111(__context__,das_arg<TArray<uint8_t>>::pass(__arr_rename_at_1504_65),3);
+    das_copy(das_cast<TDim<uint8_t,3>>::cast(das_ref(__context__,__arr_rename_at_1504_65(0,__context__))),__a_rename_at_1502_64);
+    return /* <- */ das_auto_cast_move<TArray<uint8_t>>::cast(__arr_rename_at_1504_65);
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__ ) {
+    TArray<uint8_t> &  arg_Arr = cast_aot_arg<TArray<uint8_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap_A_49fa5bf8c4546fb6 ( Context * __context__ ) {
+    int32_t arg_i = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_j = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<double>::from(A_49fa5bf8c4546fb6(__context__, arg_i, arg_j));
+}
+static vec4f __wrap_dot_4d0013f523b283ad ( Context * __context__ ) {
+    TDim<double,500> const  &  arg_v = cast_aot_arg<TDim<double,500> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    TDim<double,500> const  &  arg_u = cast_aot_arg<TDim<double,500> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<double>::from(dot_4d0013f523b283ad(__context__, arg_v, arg_u));
+}
+static vec4f __wrap_mult_Av_233ca2368951331a ( Context * __context__ ) {
+    TDim<double,500> const  &  arg_v = cast_aot_arg<TDim<double,500> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    TDim<double,500> &  arg_out = cast_aot_arg<TDim<double,500> & >::to(*__context__,__context__->abiArguments()[1]);
+    mult_Av_233ca2368951331a(__context__, arg_v, arg_out);
+    return v_zero();
+}
+static vec4f __wrap_mult_Atv_b1addcc069fe71da ( Context * __context__ ) {
+    TDim<double,500> const  &  arg_v = cast_aot_arg<TDim<double,500> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    TDim<double,500> &  arg_out = cast_aot_arg<TDim<double,500> & >::to(*__context__,__context__->abiArguments()[1]);
+    mult_Atv_b1addcc069fe71da(__context__, arg_v, arg_out);
+    return v_zero();
+}
+static vec4f __wrap_mult_AtAv_261cef8ccdfac424 ( Context * __context__ ) {
+    TDim<double,500> const  &  arg_v = cast_aot_arg<TDim<double,500> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    TDim<double,500> &  arg_out = cast_aot_arg<TDim<double,500> & >::to(*__context__,__context__->abiArguments()[1]);
+    mult_AtAv_261cef8ccdfac424(__context__, arg_v, arg_out);
+    return v_zero();
+}
+static vec4f __wrap_test_df83f97e52ebe576 ( Context * __context__ ) {
+    return cast<double>::from(test_df83f97e52ebe576(__context__));
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__ ) {
+    TDim<uint8_t,3> &  arg_a = cast_aot_arg<TDim<uint8_t,3> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<uint8_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x43319db4719733d6, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 },
+    { 0x57c51d00dfbc2b8c, false, (void*)&A_49fa5bf8c4546fb6, &__wrap_A_49fa5bf8c4546fb6 },
+    { 0x8b8a8a967d85dcb5, false, (void*)&dot_4d0013f523b283ad, &__wrap_dot_4d0013f523b283ad },
+    { 0x1a6aad0b83a99d43, false, (void*)&mult_Av_233ca2368951331a, &__wrap_mult_Av_233ca2368951331a },
+    { 0x89cbdcfdbb29dbb6, false, (void*)&mult_Atv_b1addcc069fe71da, &__wrap_mult_Atv_b1addcc069fe71da },
+    { 0x8a58521e634808d0, false, (void*)&mult_AtAv_261cef8ccdfac424, &__wrap_mult_AtAv_261cef8ccdfac424 },
+    { 0xb2c3e98fcfd164e8, false, (void*)&test_df83f97e52ebe576, &__wrap_test_df83f97e52ebe576 },
+    { 0x60b407c06982729e, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x9a13fc8854efab2d, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_1580935561784984716
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
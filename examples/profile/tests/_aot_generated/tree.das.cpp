@@ -0,0 +1,385 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require fio
+#include "daScript/misc/performance_time.h"
+#include "daScript/simulate/aot_builtin_fio.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require testProfile
+#include "test_profile.h"
+ // require random
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_15448518933396845906 {
+
+namespace  { struct TestFile; };
+namespace  { struct Node; };
+namespace fio { struct df_header; };
+namespace random { struct _lambda_random_112_1; };
+// unused enumeration ConversionResult
+// unused structure df_header
+// unused structure _lambda_random_112_1
+namespace  {
+
+struct TestFile {
+    char * luaFile;
+    char * luaJitFile;
+    char * luauFile;
+    char * nutFile;
+    char * nutModifiedFile;
+    char * asFile;
+    char * jsFile;
+    char * monoFile;
+    char * dotNetFile;
+};
+static_assert(sizeof(TestFile)==72,"structure size mismatch with DAS");
+static_assert(offsetof(TestFile,luaFile)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,luaJitFile)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,luauFile)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,nutFile)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,nutModifiedFile)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,asFile)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,jsFile)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,monoFile)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFile,dotNetFile)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Node {
+    int32_t x;
+    int32_t y;
+    Node * left;
+    Node * right;
+};
+static_assert(sizeof(Node)==24,"structure size mismatch with DAS");
+static_assert(offsetof(Node,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Node,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Node,left)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Node,right)==16,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__, TArray<uint8_t> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline void finalize_c08794e1a87c127a ( Context * __context__, Node & ____this_rename_at_18_2 );
+inline int32_t _FuncrandomTickrandom_big_intTick6064554311639177623_79b896eb5784a6a7 ( Context * __context__, int4 & __seed_rename_at_37_3 );
+inline void finalize_8a4cfc8d597c0715 ( Context * __context__, Node * & ____this_rename_at_106_5 );
+inline Node * merge_bbba0c7c1756706 ( Context * __context__, Node * __lower_rename_at_28_40, Node * __greater_rename_at_28_41 );
+inline void split_36eaa8f2358d134d ( Context * __context__, Node * __orig_rename_at_43_42, Node * & __lower_rename_at_43_43, Node * & __greaterOrEqual_rename_at_43_44, int32_t __value_rename_at_43_45 );
+inline bool hasValue_3b883372f4081f5 ( Context * __context__, Node * & __orig_rename_at_57_46, int32_t __x_rename_at_57_47 );
+inline void insert_f535778f1bd95a6b ( Context * __context__, Node * & __orig_rename_at_68_53, int32_t __x_rename_at_68_54 );
+inline void erase_raw_9e6649ab56f019a7 ( Context * __context__, Node * & __orig_rename_at_80_59, int32_t __x_rename_at_80_60 );
+inline int32_t mainTreeNode_609da42b13f1ec02 ( Context * __context__ );
+inline TArray<uint8_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__, TDim<uint8_t,3> & __a_rename_at_1502_70 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    TArray<uint8_t> _temp_make_local_35_22_0;
+    TDim<uint8_t,3> _temp_make_local_35_22_1;
+    das_global_solid<char *,0>(__context__) = ((char * const )(builtin_string_from_array(das_arg<TArray<uint8_t>>::pass((_temp_make_local_35_22_0 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4(__context__,das_arg<TDim<uint8_t,3>>::pass((([&]() -> TDim<uint8_t,3>& {
+        _temp_make_local_35_22_1(0,__context__) = 0xef;
+        _temp_make_local_35_22_1(1,__context__) = 0xbb;
+        _temp_make_local_35_22_1(2,__context__) = 0xbf;
+        return _temp_make_local_35_22_1;
+    })())))))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));/*ENCODING*/
+    das_global_solid<int4,16>(__context__) = int4(1,1,1,1);/*seed*/
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__, TArray<uint8_t> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<uint8_t>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,1,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void finalize_c08794e1a87c127a ( Context * __context__, Node &  ____this_rename_at_18_2 )
+{
+    finalize_8a4cfc8d597c0715(__context__,____this_rename_at_18_2.left);
+    finalize_8a4cfc8d597c0715(__context__,____this_rename_at_18_2.right);
+    memset((void*)&(____this_rename_at_18_2), 0, 24);
+}
+
+inline int32_t _FuncrandomTickrandom_big_intTick6064554311639177623_79b896eb5784a6a7 ( Context * __context__, int4 & __seed_rename_at_37_3 )
+{
+    das_copy(__seed_rename_at_37_3,SimPolicy<int4>::Add((SimPolicy<int4>::Mul(int4(214013,214013,214013,214013),__seed_rename_at_37_3,*__context__,nullptr)),int4(2531011,2531011,2531011,2531011),*__context__,nullptr));
+    int2 __i12_rename_at_40_4 = ((int2)(SimPolicy<int2>::BinAnd((SimPolicy<int2>::BinShr(das_swizzle_seq<int2,int4,0>::swizzle(__seed_rename_at_37_3) /*xy*/,cast<int32_t>::from(16),*__context__,nullptr)),int2(32767,32767),*__context__,nullptr)));
+    return das_auto_cast<int32_t>::cast(v_extract_xi(v_cast_vec4i(__i12_rename_at_40_4)) /*x*/ + (SimPolicy<int32_t>::BinShl(v_extract_yi(v_cast_vec4i(__i12_rename_at_40_4)) /*y*/,15,*__context__,nullptr)));
+}
+
+inline void finalize_8a4cfc8d597c0715 ( Context * __context__, Node * & ____this_rename_at_106_5 )
+{
+    if ( ____this_rename_at_106_5 != nullptr )
+    {
+        finalize_c08794e1a87c127a(__context__,das_arg<Node>::pass(das_deref(__context__,____this_rename_at_106_5,__FILE__,__LINE__)));
+        das_delete<Node *>::clear(__context__,____this_rename_at_106_5);
+        das_copy(____this_rename_at_106_5,nullptr);
+    };
+}
+
+inline Node * merge_bbba0c7c1756706 ( Context * __context__, Node * __lower_rename_at_28_40, Node * __greater_rename_at_28_41 )
+{
+    if ( __lower_rename_at_28_40 == nullptr )
+    {
+        return das_auto_cast<Node *>::cast(__greater_rename_at_28_41);
+    } else if ( __greater_rename_at_28_41 == nullptr )
+    {
+        return das_auto_cast<Node *>::cast(__lower_rename_at_28_40);
+    } else if ( __lower_rename_at_28_40->y < __greater_rename_at_28_41->y )
+    {
+        das_copy(__lower_rename_at_28_40->right,merge_bbba0c7c1756706(__context__,__lower_rename_at_28_40->right,__greater_rename_at_28_41));
+        return das_auto_cast<Node *>::cast(__lower_rename_at_28_40);
+    } else {
+        das_copy(__greater_rename_at_28_41->left,merge_bbba0c7c1756706(__context__,__lower_rename_at_28_40,__greater_rename_at_28_41->left));
+        return das_auto_cast<Node *>::cast(__greater_rename_at_28_41);
+    };
+}
+
+inline void split_36eaa8f2358d134d ( Context * __context__, Node * __orig_rename_at_43_42, Node * & __lower_rename_at_43_43, Node * & __greaterOrEqual_rename_at_43_44, int32_t __value_rename_at_43_45 )
+{
+    if ( __orig_rename_at_43_42 == nullptr )
+    {
+        das_copy(__lower_rename_at_43_43,nullptr);
+        das_copy(__greaterOrEqual_rename_at_43_44,nullptr);
+    } else if ( __orig_rename_at_43_42->x < __value_rename_at_43_45 )
+    {
+        das_copy(__lower_rename_at_43_43,__orig_rename_at_43_42);
+        split_36eaa8f2358d134d(__context__,__lower_rename_at_43_43->right,__lower_rename_at_43_43->right,__greaterOrEqual_rename_at_43_44,__value_rename_at_43_45);
+    } else {
+        das_copy(__greaterOrEqual_rename_at_43_44,__orig_rename_at_43_42);
+        split_36eaa8f2358d134d(__context__,__greaterOrEqual_rename_at_43_44->left,__lower_rename_at_43_43,__greaterOrEqual_rename_at_43_44->left,__value_rename_at_43_45);
+    };
+}
+
+inline bool hasValue_3b883372f4081f5 ( Context * __context__, Node * & __orig_rename_at_57_46, int32_t __x_rename_at_57_47 )
+{
+    Node * __lower_rename_at_58_48 = 0; Node * __equal_rename_at_58_49 = 0; Node * __greater_rename_at_58_50 = 0;
+    Node * __equalOrGreater_rename_at_59_51 = 0;
+    split_36eaa8f2358d134d(__context__,__orig_rename_at_57_46,__lower_rename_at_58_48,__equalOrGreater_rename_at_59_51,__x_rename_at_57_47);
+    split_36eaa8f2358d134d(__context__,__equalOrGreater_rename_at_59_51,__equal_rename_at_58_49,__greater_rename_at_58_50,__x_rename_at_57_47 + 1);
+    bool __res_rename_at_62_52 = ((bool)(__equal_rename_at_58_49 != nullptr));
+    das_copy(__orig_rename_at_57_46,merge_bbba0c7c1756706(__context__,merge_bbba0c7c1756706(__context__,__lower_rename_at_58_48,__equal_rename_at_58_49),__greater_rename_at_58_50));
+    return das_auto_cast<bool>::cast(__res_rename_at_62_52);
+}
+
+inline void insert_f535778f1bd95a6b ( Context * __context__, Node * & __orig_rename_at_68_53, int32_t __x_rename_at_68_54 )
+{
+    Node * __lower_rename_at_69_55 = 0; Node * __equal_rename_at_69_56 = 0; Node * __greater_rename_at_69_57 = 0;
+    Node * __equalOrGreater_rename_at_70_58 = 0;
+    split_36eaa8f2358d134d(__context__,__orig_rename_at_68_53,__lower_rename_at_69_55,__equalOrGreater_rename_at_70_58,__x_rename_at_68_54);
+    split_36eaa8f2358d134d(__context__,__equalOrGreater_rename_at_70_58,__equal_rename_at_69_56,__greater_rename_at_69_57,__x_rename_at_68_54 + 1);
+    if ( __equal_rename_at_69_56 == nullptr )
+    {
+        das_copy(__equal_rename_at_69_56,das_ascend<Node,Node>::make(__context__,nullptr,(([&]() -> Node {
+            Node __mks_74;
+            das_zero(__mks_74);
+            das_copy((__mks_74.x),(__x_rename_at_68_54));
+            das_copy((__mks_74.y),(_FuncrandomTickrandom_big_intTick6064554311639177623_79b896eb5784a6a7(__context__,das_global<int4,0xf15f362fa38922b9>(__context__) /*seed*/)));
+            return __mks_74;
+        })())));
+    };
+    das_copy(__orig_rename_at_68_53,merge_bbba0c7c1756706(__context__,merge_bbba0c7c1756706(__context__,__lower_rename_at_69_55,__equal_rename_at_69_56),__greater_rename_at_69_57));
+}
+
+inline void erase_raw_9e6649ab56f019a7 ( Context * __context__, Node * & __orig_rename_at_80_59, int32_t __x_rename_at_80_60 )
+{
+    Node * __lower_rename_at_81_61 = 0; Node * __equal_rename_at_81_62 = 0; Node * __greater_rename_at_81_63 = 0;
+    Node * __equalOrGreater_rename_at_82_64 = 0;
+    split_36eaa8f2358d134d(__context__,__orig_rename_at_80_59,__lower_rename_at_81_61,__equalOrGreater_rename_at_82_64,__x_rename_at_80_60);
+    split_36eaa8f2358d134d(__context__,__equalOrGreater_rename_at_82_64,__equal_rename_at_81_62,__greater_rename_at_81_63,__x_rename_at_80_60 + 1);
+    das_copy(__orig_rename_at_80_59,merge_bbba0c7c1756706(__context__,__lower_rename_at_81_61,__greater_rename_at_81_63));
+}
+
+inline int32_t mainTreeNode_609da42b13f1ec02 ( Context * __context__ )
+{
+    Node * __tree_rename_at_89_65 = 0;
+    int32_t __cur_rename_at_90_66 = 5;
+    int32_t __res_rename_at_91_67 = 0;
+    {
+        bool __need_loop_92 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,1000000));
+        int32_t __i_rename_at_92_68;
+        __need_loop_92 = __i_iterator.first(__context__,(__i_rename_at_92_68)) && __need_loop_92;
+        for ( ; __need_loop_92 ; __need_loop_92 = __i_iterator.next(__context__,(__i_rename_at_92_68)) )
+        {
+            int32_t __a_rename_at_93_69 = ((int32_t)(SimPolicy<int32_t>::Mod(__i_rename_at_92_68,3,*__context__,nullptr)));
+            das_copy(__cur_rename_at_90_66,SimPolicy<int32_t>::Mod(((__cur_rename_at_90_66 * 57) + 43),10007,*__context__,nullptr));
+            if ( __a_rename_at_93_69 == 0 )
+            {
+                insert_f535778f1bd95a6b(__context__,__tree_rename_at_89_65,__cur_rename_at_90_66);
+            } else if ( __a_rename_at_93_69 == 1 )
+            {
+                erase_raw_9e6649ab56f019a7(__context__,__tree_rename_at_89_65,__cur_rename_at_90_66);
+            } else {
+                if ( hasValue_3b883372f4081f5(__context__,__tree_rename_at_89_65,__cur_rename_at_90_66) )
+                {
+                    ++__res_rename_at_91_67;
+                };
+            };
+        }
+        __i_iterator.close(__context__,(__i_rename_at_92_68));
+    };
+    finalize_8a4cfc8d597c0715(__context__,__tree_rename_at_89_65);
+    return das_auto_cast<int32_t>::cast(__res_rename_at_91_67);
+}
+
+inline TArray<uint8_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__, TDim<uint8_t,3> &  __a_rename_at_1502_70 )
+{
+    TArray<uint8_t> __arr_rename_at_1504_71;das_zero(__arr_rename_at_1504_71);
+    _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111(__context__,das_arg<TArray<uint8_t>>::pass(__arr_rename_at_1504_71),3);
+    das_copy(das_cast<TDim<uint8_t,3>>::cast(das_ref(__context__,__arr_rename_at_1504_71(0,__context__))),__a_rename_at_1502_70);
+    return /* <- */ das_auto_cast_move<TArray<uint8_t>>::cast(__arr_rename_at_1504_71);
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__ ) {
+    TArray<uint8_t> &  arg_Arr = cast_aot_arg<TArray<uint8_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap_finalize_c08794e1a87c127a ( Context * __context__ ) {
+    Node &  arg___this = cast_aot_arg<Node & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_c08794e1a87c127a(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncrandomTickrandom_big_intTick6064554311639177623_79b896eb5784a6a7 ( Context * __context__ ) {
+    int4 & arg_seed = cast_aot_arg<int4 &>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(_FuncrandomTickrandom_big_intTick6064554311639177623_79b896eb5784a6a7(__context__, arg_seed));
+}
+static vec4f __wrap_finalize_8a4cfc8d597c0715 ( Context * __context__ ) {
+    Node * & arg___this = cast_aot_arg<Node * &>::to(*__context__,__context__->abiArguments()[0]);
+    finalize_8a4cfc8d597c0715(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_merge_bbba0c7c1756706 ( Context * __context__ ) {
+    Node * arg_lower = cast_aot_arg<Node *>::to(*__context__,__context__->abiArguments()[0]);
+    Node * arg_greater = cast_aot_arg<Node *>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<Node *>::from(merge_bbba0c7c1756706(__context__, arg_lower, arg_greater));
+}
+static vec4f __wrap_split_36eaa8f2358d134d ( Context * __context__ ) {
+    Node * arg_orig = cast_aot_arg<Node *>::to(*__context__,__context__->abiArguments()[0]);
+    Node * & arg_lower = cast_aot_arg<Node * &>::to(*__context__,__context__->abiArguments()[1]);
+    Node * & arg_greaterOrEqual = cast_aot_arg<Node * &>::to(*__context__,__context__->abiArguments()[2]);
+    int32_t arg_value = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[3]);
+    split_36eaa8f2358d134d(__context__, arg_orig, arg_lower, arg_greaterOrEqual, arg_value);
+    return v_zero();
+}
+static vec4f __wrap_hasValue_3b883372f4081f5 ( Context * __context__ ) {
+    Node * & arg_orig = cast_aot_arg<Node * &>::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(hasValue_3b883372f4081f5(__context__, arg_orig, arg_x));
+}
+static vec4f __wrap_insert_f535778f1bd95a6b ( Context * __context__ ) {
+    Node * & arg_orig = cast_aot_arg<Node * &>::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    insert_f535778f1bd95a6b(__context__, arg_orig, arg_x);
+    return v_zero();
+}
+static vec4f __wrap_erase_raw_9e6649ab56f019a7 ( Context * __context__ ) {
+    Node * & arg_orig = cast_aot_arg<Node * &>::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    erase_raw_9e6649ab56f019a7(__context__, arg_orig, arg_x);
+    return v_zero();
+}
+static vec4f __wrap_mainTreeNode_609da42b13f1ec02 ( Context * __context__ ) {
+    return cast<int32_t>::from(mainTreeNode_609da42b13f1ec02(__context__));
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__ ) {
+    TDim<uint8_t,3> &  arg_a = cast_aot_arg<TDim<uint8_t,3> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<uint8_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x43319db4719733d6, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 },
+    { 0x8e5d26770da6f8ac, false, (void*)&finalize_c08794e1a87c127a, &__wrap_finalize_c08794e1a87c127a },
+    { 0x4f51a1adec6b9043, false, (void*)&_FuncrandomTickrandom_big_intTick6064554311639177623_79b896eb5784a6a7, &__wrap__FuncrandomTickrandom_big_intTick6064554311639177623_79b896eb5784a6a7 },
+    { 0xcf3b756732a4d35, false, (void*)&finalize_8a4cfc8d597c0715, &__wrap_finalize_8a4cfc8d597c0715 },
+    { 0xf10011b855df04ac, false, (void*)&merge_bbba0c7c1756706, &__wrap_merge_bbba0c7c1756706 },
+    { 0x3b3201a9500ac29b, false, (void*)&split_36eaa8f2358d134d, &__wrap_split_36eaa8f2358d134d },
+    { 0x9e92ed730f5ecf66, false, (void*)&hasValue_3b883372f4081f5, &__wrap_hasValue_3b883372f4081f5 },
+    { 0xea7a1befdd0d0e92, false, (void*)&insert_f535778f1bd95a6b, &__wrap_insert_f535778f1bd95a6b },
+    { 0xbda1f8c853de2e1f, false, (void*)&erase_raw_9e6649ab56f019a7, &__wrap_erase_raw_9e6649ab56f019a7 },
+    { 0x17c02e02893004c6, false, (void*)&mainTreeNode_609da42b13f1ec02, &__wrap_mainTreeNode_609da42b13f1ec02 },
+    { 0x60b407c06982729e, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0xf13422708a02728d, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_15448518933396845906
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,324 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+#include "daScript/ast/ast_generate.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings_boost
+ // require ast_boost
+ // require _apply_macro
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_3893705629252022343 {
+
+namespace _apply_macro { struct AppendCondAnnotation; };
+namespace ast { struct AstFunctionAnnotation; };
+namespace ast { struct AstBlockAnnotation; };
+namespace ast { struct AstStructureAnnotation; };
+namespace ast { struct AstPassMacro; };
+namespace ast { struct AstVariantMacro; };
+namespace ast { struct AstForLoopMacro; };
+namespace ast { struct AstCaptureMacro; };
+namespace ast { struct AstTypeMacro; };
+namespace ast { struct AstSimulateMacro; };
+namespace ast { struct AstReaderMacro; };
+namespace ast { struct AstCommentReader; };
+namespace ast { struct AstCallMacro; };
+namespace ast { struct AstTypeInfoMacro; };
+namespace ast { struct AstEnumerationAnnotation; };
+namespace ast { struct AstVisitor; };
+namespace ast_boost { struct MacroMacro; };
+namespace ast_boost { struct TagFunctionAnnotation; };
+namespace ast_boost { struct TagStructureAnnotation; };
+namespace ast_boost { struct SetupAnyAnnotation; };
+namespace ast_boost { struct SetupFunctionAnnotation; };
+namespace ast_boost { struct SetupBlockAnnotation; };
+namespace ast_boost { struct SetupStructureAnnotation; };
+namespace ast_boost { struct SetupEnumerationAnnotation; };
+namespace ast_boost { struct SetupContractAnnotation; };
+namespace ast_boost { struct SetupReaderMacro; };
+namespace ast_boost { struct SetupCommentReader; };
+namespace ast_boost { struct SetupVariantMacro; };
+namespace ast_boost { struct SetupForLoopMacro; };
+namespace ast_boost { struct SetupCaptureMacro; };
+namespace ast_boost { struct SetupTypeMacro; };
+namespace ast_boost { struct SetupSimulateMacro; };
+namespace ast_boost { struct SetupCallMacro; };
+namespace ast_boost { struct SetupTypeInfoMacro; };
+namespace ast_boost { struct SetupInferMacro; };
+namespace ast_boost { struct SetupDirtyInferMacro; };
+namespace ast_boost { struct SetupLintMacro; };
+namespace ast_boost { struct SetupGlobalLintMacro; };
+namespace ast_boost { struct SetupOptimizationMacro; };
+namespace ast_boost { struct TagFunctionMacro; };
+namespace ast_boost { struct BetterRttiVisitor; };
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+// unused enumeration ConversionResult
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+namespace ast {
+
+struct AstFunctionAnnotation {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(AstFunctionAnnotation)==112,"structure size mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+// unused structure AstBlockAnnotation
+// unused structure AstStructureAnnotation
+// unused structure AstPassMacro
+// unused structure AstVariantMacro
+// unused structure AstForLoopMacro
+// unused structure AstCaptureMacro
+// unused structure AstTypeMacro
+// unused structure AstSimulateMacro
+// unused structure AstReaderMacro
+// unused structure AstCommentReader
+// unused structure AstCallMacro
+// unused structure AstTypeInfoMacro
+// unused structure AstEnumerationAnnotation
+// unused structure AstVisitor
+// unused structure MacroMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagStructureAnnotation
+// unused structure SetupAnyAnnotation
+// unused structure SetupFunctionAnnotation
+// unused structure SetupBlockAnnotation
+// unused structure SetupStructureAnnotation
+// unused structure SetupEnumerationAnnotation
+// unused structure SetupContractAnnotation
+// unused structure SetupReaderMacro
+// unused structure SetupCommentReader
+// unused structure SetupVariantMacro
+// unused structure SetupForLoopMacro
+// unused structure SetupCaptureMacro
+// unused structure SetupTypeMacro
+// unused structure SetupSimulateMacro
+// unused structure SetupCallMacro
+// unused structure SetupTypeInfoMacro
+// unused structure SetupInferMacro
+// unused structure SetupDirtyInferMacro
+// unused structure SetupLintMacro
+// unused structure SetupGlobalLintMacro
+// unused structure SetupOptimizationMacro
+// unused structure TagFunctionMacro
+// unused structure BetterRttiVisitor
+namespace _apply_macro {
+
+struct AppendCondAnnotation {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(AppendCondAnnotation)==112,"structure size mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendCondAnnotation,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickpushTick10769833213962245646_16ebab98cd6e0741 ( Context * __context__, TArray<ast::AstFunctionAnnotation *> & __Arr_rename_at_193_0, ast::AstFunctionAnnotation * __value_rename_at_193_1 );
+inline StructInfo const  * _FuncrttiTickclass_infoTick15801393167907430156_4dd8f39772daac9d ( Context * __context__, _apply_macro::AppendCondAnnotation const  & __cl_rename_at_116_2 );
+inline void prepend_cond_3136baf194ef30ab ( Context * __context__, smart_ptr_raw<Function> __fn_rename_at_7_3, char * const  __cond_rename_at_7_4 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickpushTick10769833213962245646_16ebab98cd6e0741 ( Context * __context__, TArray<ast::AstFunctionAnnotation *> &  __Arr_rename_at_193_0, ast::AstFunctionAnnotation * __value_rename_at_193_1 )
+{
+    das_copy(__Arr_rename_at_193_0(builtin_array_push_back(das_arg<TArray<ast::AstFunctionAnnotation *>>::pass(__Arr_rename_at_193_0),8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_193_1);
+}
+
+inline StructInfo const  * _FuncrttiTickclass_infoTick15801393167907430156_4dd8f39772daac9d ( Context * __context__, _apply_macro::AppendCondAnnotation const  &  __cl_rename_at_116_2 )
+{
+    return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(((das_deref(__context__,das_cast<TypeInfo const  *>::cast(__cl_rename_at_116_2.__rtti),__FILE__,__LINE__)).getStructType())));
+}
+
+inline void prepend_cond_3136baf194ef30ab ( Context * __context__, smart_ptr_raw<Function> __fn_rename_at_7_3, char * const  __cond_rename_at_7_4 ) { das_stack_prologue __prologue(__context__,160,"prepend_cond " DAS_FILE_LINE);
+{
+    smart_ptr_raw<Expression> __iblk_rename_at_8_5; memset((void*)&__iblk_rename_at_8_5,0,sizeof(__iblk_rename_at_8_5));
+    smart_ptr_raw<ExprBlock> __blk_rename_at_9_6; memset((void*)&__blk_rename_at_9_6,0,sizeof(__blk_rename_at_9_6));
+    smart_ptr_raw<ExprCall> __ifm_rename_at_10_7; memset((void*)&__ifm_rename_at_10_7,0,sizeof(__ifm_rename_at_10_7));
+    smart_ptr_raw<ExprIfThenElse> __ife_rename_at_11_9; memset((void*)&__ife_rename_at_11_9,0,sizeof(__ife_rename_at_11_9));
+    /* finally */ auto __finally_7= das_finally([&](){
+    das_delete_handle<smart_ptr_raw<ExprIfThenElse>>::clear(__context__,__ife_rename_at_11_9);
+    das_delete_handle<smart_ptr_raw<ExprCall>>::clear(__context__,__ifm_rename_at_10_7);
+    das_delete_handle<smart_ptr_raw<ExprBlock>>::clear(__context__,__blk_rename_at_9_6);
+    das_delete_handle<smart_ptr_raw<Expression>>::clear(__context__,__iblk_rename_at_8_5);
+    /* end finally */ });
+    __iblk_rename_at_8_5; das_zero(__iblk_rename_at_8_5); das_move(__iblk_rename_at_8_5, __fn_rename_at_7_3->body /*body*/);
+    __blk_rename_at_9_6; das_zero(__blk_rename_at_9_6); das_move(__blk_rename_at_9_6, das_ascend_handle<true,smart_ptr_raw<ExprBlock>>::make(__context__,nullptr,(([&](ExprBlock & __mks_9) {
+        das_copy((__mks_9.at /*at*/),(__fn_rename_at_7_3->at /*at*/));
+    }))));
+    __ifm_rename_at_10_7; das_zero(__ifm_rename_at_10_7); das_move(__ifm_rename_at_10_7, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_10) {
+        das_copy((__mks_10.at /*at*/),(__fn_rename_at_7_3->at /*at*/));
+        {
+            set_das_string(das_arg<das::string>::pass(__mks_10.name /*name*/),__cond_rename_at_7_4);
+        }    }))));
+    __ife_rename_at_11_9; das_zero(__ife_rename_at_11_9); das_move(__ife_rename_at_11_9, das_ascend_handle<true,smart_ptr_raw<ExprIfThenElse>>::make(__context__,nullptr,(([&](ExprIfThenElse & __mks_11) {
+        das_copy((__mks_11.at /*at*/),(__fn_rename_at_7_3->at /*at*/));
+        das_move((__mks_11.cond /*cond*/),(__ifm_rename_at_10_7));
+        das_move((__mks_11.if_true /*if_true*/),(__iblk_rename_at_8_5));
+    }))));
+    das_vector_emplace_back(das_arg<das::vector<smart_ptr<Expression>>>::pass(__blk_rename_at_9_6->list /*list*/),das_reinterpret<smart_ptr_raw<Expression>>::pass(__ife_rename_at_11_9));
+    builtin_smart_ptr_move(das_auto_cast<smart_ptr_raw<void> &>::cast(__fn_rename_at_7_3->body /*body*/),das_auto_cast<smart_ptr_raw<void> &>::cast(__blk_rename_at_9_6),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}}
+static vec4f __wrap__FuncbuiltinTickpushTick10769833213962245646_16ebab98cd6e0741 ( Context * __context__ ) {
+    TArray<ast::AstFunctionAnnotation *> &  arg_Arr = cast_aot_arg<TArray<ast::AstFunctionAnnotation *> & >::to(*__context__,__context__->abiArguments()[0]);
+    ast::AstFunctionAnnotation * arg_value = cast_aot_arg<ast::AstFunctionAnnotation *>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick10769833213962245646_16ebab98cd6e0741(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__FuncrttiTickclass_infoTick15801393167907430156_4dd8f39772daac9d ( Context * __context__ ) {
+    _apply_macro::AppendCondAnnotation const  &  arg_cl = cast_aot_arg<_apply_macro::AppendCondAnnotation const  & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<StructInfo const  *>::from(_FuncrttiTickclass_infoTick15801393167907430156_4dd8f39772daac9d(__context__, arg_cl));
+}
+static vec4f __wrap_prepend_cond_3136baf194ef30ab ( Context * __context__ ) {
+    smart_ptr_raw<Function> arg_fn = cast_aot_arg<smart_ptr_raw<Function>>::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_cond = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    prepend_cond_3136baf194ef30ab(__context__, arg_fn, arg_cond);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x816bf6b50e84940e, false, (void*)&_FuncbuiltinTickpushTick10769833213962245646_16ebab98cd6e0741, &__wrap__FuncbuiltinTickpushTick10769833213962245646_16ebab98cd6e0741 },
+    { 0x6c50617495ce1547, false, (void*)&_FuncrttiTickclass_infoTick15801393167907430156_4dd8f39772daac9d, &__wrap__FuncrttiTickclass_infoTick15801393167907430156_4dd8f39772daac9d },
+    { 0x44084ae483bb70bc, false, (void*)&prepend_cond_3136baf194ef30ab, &__wrap_prepend_cond_3136baf194ef30ab },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_3893705629252022343
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,242 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+#include "daScript/ast/ast_generate.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings_boost
+ // require ast_boost
+ // require _enum_total
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14918966569062689643 {
+
+namespace _enum_total { struct EnumTotalAnnotation; };
+namespace ast { struct AstFunctionAnnotation; };
+namespace ast { struct AstBlockAnnotation; };
+namespace ast { struct AstStructureAnnotation; };
+namespace ast { struct AstPassMacro; };
+namespace ast { struct AstVariantMacro; };
+namespace ast { struct AstForLoopMacro; };
+namespace ast { struct AstCaptureMacro; };
+namespace ast { struct AstTypeMacro; };
+namespace ast { struct AstSimulateMacro; };
+namespace ast { struct AstReaderMacro; };
+namespace ast { struct AstCommentReader; };
+namespace ast { struct AstCallMacro; };
+namespace ast { struct AstTypeInfoMacro; };
+namespace ast { struct AstEnumerationAnnotation; };
+namespace ast { struct AstVisitor; };
+namespace ast_boost { struct MacroMacro; };
+namespace ast_boost { struct TagFunctionAnnotation; };
+namespace ast_boost { struct TagStructureAnnotation; };
+namespace ast_boost { struct SetupAnyAnnotation; };
+namespace ast_boost { struct SetupFunctionAnnotation; };
+namespace ast_boost { struct SetupBlockAnnotation; };
+namespace ast_boost { struct SetupStructureAnnotation; };
+namespace ast_boost { struct SetupEnumerationAnnotation; };
+namespace ast_boost { struct SetupContractAnnotation; };
+namespace ast_boost { struct SetupReaderMacro; };
+namespace ast_boost { struct SetupCommentReader; };
+namespace ast_boost { struct SetupVariantMacro; };
+namespace ast_boost { struct SetupForLoopMacro; };
+namespace ast_boost { struct SetupCaptureMacro; };
+namespace ast_boost { struct SetupTypeMacro; };
+namespace ast_boost { struct SetupSimulateMacro; };
+namespace ast_boost { struct SetupCallMacro; };
+namespace ast_boost { struct SetupTypeInfoMacro; };
+namespace ast_boost { struct SetupInferMacro; };
+namespace ast_boost { struct SetupDirtyInferMacro; };
+namespace ast_boost { struct SetupLintMacro; };
+namespace ast_boost { struct SetupGlobalLintMacro; };
+namespace ast_boost { struct SetupOptimizationMacro; };
+namespace ast_boost { struct TagFunctionMacro; };
+namespace ast_boost { struct BetterRttiVisitor; };
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+// unused enumeration ConversionResult
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstFunctionAnnotation
+// unused structure AstBlockAnnotation
+// unused structure AstStructureAnnotation
+// unused structure AstPassMacro
+// unused structure AstVariantMacro
+// unused structure AstForLoopMacro
+// unused structure AstCaptureMacro
+// unused structure AstTypeMacro
+// unused structure AstSimulateMacro
+// unused structure AstReaderMacro
+// unused structure AstCommentReader
+// unused structure AstCallMacro
+// unused structure AstTypeInfoMacro
+namespace ast {
+
+struct AstEnumerationAnnotation {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstEnumerationAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstEnumerationAnnotation,smart_ptr_raw<Enumeration>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+};
+static_assert(sizeof(AstEnumerationAnnotation)==24,"structure size mismatch with DAS");
+static_assert(offsetof(AstEnumerationAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstEnumerationAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstEnumerationAnnotation,apply)==16,"structure field offset mismatch with DAS");
+}
+// unused structure AstVisitor
+// unused structure MacroMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagStructureAnnotation
+// unused structure SetupAnyAnnotation
+// unused structure SetupFunctionAnnotation
+// unused structure SetupBlockAnnotation
+// unused structure SetupStructureAnnotation
+// unused structure SetupEnumerationAnnotation
+// unused structure SetupContractAnnotation
+// unused structure SetupReaderMacro
+// unused structure SetupCommentReader
+// unused structure SetupVariantMacro
+// unused structure SetupForLoopMacro
+// unused structure SetupCaptureMacro
+// unused structure SetupTypeMacro
+// unused structure SetupSimulateMacro
+// unused structure SetupCallMacro
+// unused structure SetupTypeInfoMacro
+// unused structure SetupInferMacro
+// unused structure SetupDirtyInferMacro
+// unused structure SetupLintMacro
+// unused structure SetupGlobalLintMacro
+// unused structure SetupOptimizationMacro
+// unused structure TagFunctionMacro
+// unused structure BetterRttiVisitor
+namespace _enum_total {
+
+struct EnumTotalAnnotation {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstEnumerationAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstEnumerationAnnotation,smart_ptr_raw<Enumeration>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+};
+static_assert(sizeof(EnumTotalAnnotation)==24,"structure size mismatch with DAS");
+static_assert(offsetof(EnumTotalAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(EnumTotalAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(EnumTotalAnnotation,apply)==16,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickpushTick10769833213962245646_e62a51f22b4f03e6 ( Context * __context__, TArray<ast::AstEnumerationAnnotation *> & __Arr_rename_at_193_0, ast::AstEnumerationAnnotation * __value_rename_at_193_1 );
+inline StructInfo const  * _FuncrttiTickclass_infoTick15801393167907430156_e3f50fb0cc7018b8 ( Context * __context__, _enum_total::EnumTotalAnnotation const  & __cl_rename_at_116_2 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickpushTick10769833213962245646_e62a51f22b4f03e6 ( Context * __context__, TArray<ast::AstEnumerationAnnotation *> &  __Arr_rename_at_193_0, ast::AstEnumerationAnnotation * __value_rename_at_193_1 )
+{
+    das_copy(__Arr_rename_at_193_0(builtin_array_push_back(das_arg<TArray<ast::AstEnumerationAnnotation *>>::pass(__Arr_rename_at_193_0),8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_193_1);
+}
+
+inline StructInfo const  * _FuncrttiTickclass_infoTick15801393167907430156_e3f50fb0cc7018b8 ( Context * __context__, _enum_total::EnumTotalAnnotation const  &  __cl_rename_at_116_2 )
+{
+    return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(((das_deref(__context__,das_cast<TypeInfo const  *>::cast(__cl_rename_at_116_2.__rtti),__FILE__,__LINE__)).getStructType())));
+}
+static vec4f __wrap__FuncbuiltinTickpushTick10769833213962245646_e62a51f22b4f03e6 ( Context * __context__ ) {
+    TArray<ast::AstEnumerationAnnotation *> &  arg_Arr = cast_aot_arg<TArray<ast::AstEnumerationAnnotation *> & >::to(*__context__,__context__->abiArguments()[0]);
+    ast::AstEnumerationAnnotation * arg_value = cast_aot_arg<ast::AstEnumerationAnnotation *>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick10769833213962245646_e62a51f22b4f03e6(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__FuncrttiTickclass_infoTick15801393167907430156_e3f50fb0cc7018b8 ( Context * __context__ ) {
+    _enum_total::EnumTotalAnnotation const  &  arg_cl = cast_aot_arg<_enum_total::EnumTotalAnnotation const  & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<StructInfo const  *>::from(_FuncrttiTickclass_infoTick15801393167907430156_e3f50fb0cc7018b8(__context__, arg_cl));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x2eaaccb97404f570, false, (void*)&_FuncbuiltinTickpushTick10769833213962245646_e62a51f22b4f03e6, &__wrap__FuncbuiltinTickpushTick10769833213962245646_e62a51f22b4f03e6 },
+    { 0x20cbc12b7a0460ec, false, (void*)&_FuncrttiTickclass_infoTick15801393167907430156_e3f50fb0cc7018b8, &__wrap__FuncrttiTickclass_infoTick15801393167907430156_e3f50fb0cc7018b8 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_14918966569062689643
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
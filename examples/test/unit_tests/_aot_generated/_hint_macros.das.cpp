@@ -0,0 +1,390 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+#include "daScript/ast/ast_generate.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings_boost
+ // require ast_boost
+ // require _hint_macros
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_12833343900308138323 {
+
+namespace _hint_macros { struct HintLookup; };
+namespace _hint_macros { struct GetHintFnMacro; };
+namespace ast { struct AstFunctionAnnotation; };
+namespace ast { struct AstBlockAnnotation; };
+namespace ast { struct AstStructureAnnotation; };
+namespace ast { struct AstPassMacro; };
+namespace ast { struct AstVariantMacro; };
+namespace ast { struct AstForLoopMacro; };
+namespace ast { struct AstCaptureMacro; };
+namespace ast { struct AstTypeMacro; };
+namespace ast { struct AstSimulateMacro; };
+namespace ast { struct AstReaderMacro; };
+namespace ast { struct AstCommentReader; };
+namespace ast { struct AstCallMacro; };
+namespace ast { struct AstTypeInfoMacro; };
+namespace ast { struct AstEnumerationAnnotation; };
+namespace ast { struct AstVisitor; };
+namespace ast_boost { struct MacroMacro; };
+namespace ast_boost { struct TagFunctionAnnotation; };
+namespace ast_boost { struct TagStructureAnnotation; };
+namespace ast_boost { struct SetupAnyAnnotation; };
+namespace ast_boost { struct SetupFunctionAnnotation; };
+namespace ast_boost { struct SetupBlockAnnotation; };
+namespace ast_boost { struct SetupStructureAnnotation; };
+namespace ast_boost { struct SetupEnumerationAnnotation; };
+namespace ast_boost { struct SetupContractAnnotation; };
+namespace ast_boost { struct SetupReaderMacro; };
+namespace ast_boost { struct SetupCommentReader; };
+namespace ast_boost { struct SetupVariantMacro; };
+namespace ast_boost { struct SetupForLoopMacro; };
+namespace ast_boost { struct SetupCaptureMacro; };
+namespace ast_boost { struct SetupTypeMacro; };
+namespace ast_boost { struct SetupSimulateMacro; };
+namespace ast_boost { struct SetupCallMacro; };
+namespace ast_boost { struct SetupTypeInfoMacro; };
+namespace ast_boost { struct SetupInferMacro; };
+namespace ast_boost { struct SetupDirtyInferMacro; };
+namespace ast_boost { struct SetupLintMacro; };
+namespace ast_boost { struct SetupGlobalLintMacro; };
+namespace ast_boost { struct SetupOptimizationMacro; };
+namespace ast_boost { struct TagFunctionMacro; };
+namespace ast_boost { struct BetterRttiVisitor; };
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+// unused enumeration ConversionResult
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+namespace ast {
+
+struct AstFunctionAnnotation {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(AstFunctionAnnotation)==112,"structure size mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+// unused structure AstBlockAnnotation
+// unused structure AstStructureAnnotation
+// unused structure AstPassMacro
+// unused structure AstVariantMacro
+// unused structure AstForLoopMacro
+// unused structure AstCaptureMacro
+// unused structure AstTypeMacro
+// unused structure AstSimulateMacro
+// unused structure AstReaderMacro
+// unused structure AstCommentReader
+// unused structure AstCallMacro
+// unused structure AstTypeInfoMacro
+// unused structure AstEnumerationAnnotation
+// unused structure AstVisitor
+// unused structure MacroMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagStructureAnnotation
+// unused structure SetupAnyAnnotation
+// unused structure SetupFunctionAnnotation
+// unused structure SetupBlockAnnotation
+// unused structure SetupStructureAnnotation
+// unused structure SetupEnumerationAnnotation
+// unused structure SetupContractAnnotation
+// unused structure SetupReaderMacro
+// unused structure SetupCommentReader
+// unused structure SetupVariantMacro
+// unused structure SetupForLoopMacro
+// unused structure SetupCaptureMacro
+// unused structure SetupTypeMacro
+// unused structure SetupSimulateMacro
+// unused structure SetupCallMacro
+// unused structure SetupTypeInfoMacro
+// unused structure SetupInferMacro
+// unused structure SetupDirtyInferMacro
+// unused structure SetupLintMacro
+// unused structure SetupGlobalLintMacro
+// unused structure SetupOptimizationMacro
+// unused structure TagFunctionMacro
+// unused structure BetterRttiVisitor
+namespace _hint_macros {
+
+struct HintLookup {
+    TTable<uint64_t,char *> tab;
+};
+static_assert(sizeof(HintLookup)==48,"structure size mismatch with DAS");
+static_assert(offsetof(HintLookup,tab)==0,"structure field offset mismatch with DAS");
+}
+namespace _hint_macros {
+
+struct GetHintFnMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(GetHintFnMacro)==112,"structure size mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickpushTick10769833213962245646_16ebab98cd6e0741 ( Context * __context__, TArray<ast::AstFunctionAnnotation *> & __Arr_rename_at_193_0, ast::AstFunctionAnnotation * __value_rename_at_193_1 );
+inline StructInfo const  * _FuncrttiTickclass_infoTick15801393167907430156_8ddd1a6e6de44230 ( Context * __context__, _hint_macros::GetHintFnMacro const  & __cl_rename_at_116_2 );
+inline void clone_44b884da8cfd61f6 ( Context * __context__, smart_ptr_raw<ExprCallFunc> & __dest_rename_at_1121_3, smart_ptr_raw<ExprCallFunc> const  __src_rename_at_1121_4 );
+inline smart_ptr_raw<ExprCallFunc> _FuncbuiltinTickclone_to_moveTick17180087396728260876_c0f293398969f4d5 ( Context * __context__, smart_ptr_raw<ExprCallFunc> __clone_src_rename_at_1118_5 );
+inline smart_ptr_raw<FunctionAnnotation> _FuncastTickmake_function_annotationTick3074191368936885601_6cbf350372137434 ( Context * __context__, char * const  __name_rename_at_633_7, _hint_macros::GetHintFnMacro * __someClassPtr_rename_at_633_8 );
+inline void _Funcast_boostTicksetup_tag_annotationTick4095297895764883997_ac640caa0c5c20c4 ( Context * __context__, char * const  __name_rename_at_240_10, char * const  __tag_rename_at_240_11, _hint_macros::GetHintFnMacro * __classPtr_rename_at_240_12 );
+inline char * get_hint_99679cf45fac16d ( Context * __context__, _hint_macros::HintLookup const  & __lookup_rename_at_16_14, char * const  __id_rename_at_16_15, char * const  __defv_rename_at_16_16, uint64_t __hint_rename_at_16_17 );
+inline char * get_hint_6be43dc38b60755f ( Context * __context__, _hint_macros::HintLookup const  & __lookup_rename_at_21_18, char * const  __id_rename_at_21_19, char * const  __defv_rename_at_21_20 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global<int32_t,0xa0a5fb62b74426d5>(__context__) = 0;/*g_non_hints*/
+}
+
+inline void _FuncbuiltinTickpushTick10769833213962245646_16ebab98cd6e0741 ( Context * __context__, TArray<ast::AstFunctionAnnotation *> &  __Arr_rename_at_193_0, ast::AstFunctionAnnotation * __value_rename_at_193_1 )
+{
+    das_copy(__Arr_rename_at_193_0(builtin_array_push_back(das_arg<TArray<ast::AstFunctionAnnotation *>>::pass(__Arr_rename_at_193_0),8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_193_1);
+}
+
+inline StructInfo const  * _FuncrttiTickclass_infoTick15801393167907430156_8ddd1a6e6de44230 ( Context * __context__, _hint_macros::GetHintFnMacro const  &  __cl_rename_at_116_2 )
+{
+    return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(((das_deref(__context__,das_cast<TypeInfo const  *>::cast(__cl_rename_at_116_2.__rtti),__FILE__,__LINE__)).getStructType())));
+}
+
+inline void clone_44b884da8cfd61f6 ( Context * __context__, smart_ptr_raw<ExprCallFunc> & __dest_rename_at_1121_3, smart_ptr_raw<ExprCallFunc> const  __src_rename_at_1121_4 )
+{
+    builtin_smart_ptr_clone(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_1121_3),das_auto_cast<smart_ptr_raw<void> const >::cast(__src_rename_at_1121_4),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline smart_ptr_raw<ExprCallFunc> _FuncbuiltinTickclone_to_moveTick17180087396728260876_c0f293398969f4d5 ( Context * __context__, smart_ptr_raw<ExprCallFunc> __clone_src_rename_at_1118_5 )
+{
+    smart_ptr_raw<ExprCallFunc> __clone_dest_rename_at_1120_6;das_zero(__clone_dest_rename_at_1120_6);
+    clone_44b884da8cfd61f6(__context__,__clone_dest_rename_at_1120_6,__clone_src_rename_at_1118_5);
+    return /* <- */ das_auto_cast_move<smart_ptr_raw<ExprCallFunc>>::cast(__clone_dest_rename_at_1120_6);
+}
+
+inline smart_ptr_raw<FunctionAnnotation> _FuncastTickmake_function_annotationTick3074191368936885601_6cbf350372137434 ( Context * __context__, char * const  __name_rename_at_633_7, _hint_macros::GetHintFnMacro * __someClassPtr_rename_at_633_8 )
+{
+    _FuncbuiltinTickpushTick10769833213962245646_16ebab98cd6e0741(__context__,das_arg<TArray<ast::AstFunctionAnnotation *>>::pass(das_global<TArray<ast::AstFunctionAnnotation *>,0x70a17c19e372bb43>(__context__) /*gc_root_AstFunctionAnnotation*/),das_reinterpret<ast::AstFunctionAnnotation *>::pass(__someClassPtr_rename_at_633_8));
+    StructInfo const  * __classInfo_rename_at_636_9 = ((StructInfo const  *)_FuncrttiTickclass_infoTick15801393167907430156_8ddd1a6e6de44230(__context__,das_arg<_hint_macros::GetHintFnMacro>::pass(das_deref(__context__,__someClassPtr_rename_at_633_8,__FILE__,__LINE__))));
+    return /* <- */ das_auto_cast_move<smart_ptr_raw<FunctionAnnotation>>::cast(makeFunctionAnnotation(__name_rename_at_633_7,das_auto_cast<void * const >::cast(__someClassPtr_rename_at_633_8),__classInfo_rename_at_636_9,__context__));
+}
+
+inline void _Funcast_boostTicksetup_tag_annotationTick4095297895764883997_ac640caa0c5c20c4 ( Context * __context__, char * const  __name_rename_at_240_10, char * const  __tag_rename_at_240_11, _hint_macros::GetHintFnMacro * __classPtr_rename_at_240_12 )
+{
+    smart_ptr_raw<FunctionAnnotation> __ann_rename_at_241_13; memset((void*)&__ann_rename_at_241_13,0,sizeof(__ann_rename_at_241_13));
+    /* finally */ auto __finally_240= das_finally([&](){
+    das_delete_handle<smart_ptr_raw<FunctionAnnotation>>::clear(__context__,__ann_rename_at_241_13);
+    /* end finally */ });
+    __ann_rename_at_241_13; das_zero(__ann_rename_at_241_13); das_move(__ann_rename_at_241_13, _FuncastTickmake_function_annotationTick3074191368936885601_6cbf350372137434(__context__,__name_rename_at_240_10,__classPtr_rename_at_240_12));
+    das_invoke_function<void>::invoke<char * const ,smart_ptr_raw<FunctionAnnotation>>(__context__,nullptr,Func(__context__->fnByMangledName(/*@ast_boost::apply_tag_annotation Cs Y<FunctionAnnotationPtr>1<H<ast::FunctionAnnotation>>?M*/ 0x7678364e276db9c2)),__tag_rename_at_240_11,__ann_rename_at_241_13);
+    addModuleFunctionAnnotation(thisModule(__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__ann_rename_at_241_13,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline char * get_hint_99679cf45fac16d ( Context * __context__, _hint_macros::HintLookup const  &  __lookup_rename_at_16_14, char * const  __id_rename_at_16_15, char * const  __defv_rename_at_16_16, uint64_t __hint_rename_at_16_17 )
+{
+    return das_auto_cast<char *>::cast(das_null_coalescing<char * const >::get(TTable<uint64_t,char *>::safe_index(&(__lookup_rename_at_16_14.tab),__hint_rename_at_16_17,__context__),__defv_rename_at_16_16));
+}
+
+inline char * get_hint_6be43dc38b60755f ( Context * __context__, _hint_macros::HintLookup const  &  __lookup_rename_at_21_18, char * const  __id_rename_at_21_19, char * const  __defv_rename_at_21_20 )
+{
+    ++das_global<int32_t,0xa0a5fb62b74426d5>(__context__) /*g_non_hints*/;
+    return das_auto_cast<char *>::cast(get_hint_99679cf45fac16d(__context__,__lookup_rename_at_21_18,__id_rename_at_21_19,__defv_rename_at_21_20,hash64z(__id_rename_at_21_19)));
+}
+static vec4f __wrap__FuncbuiltinTickpushTick10769833213962245646_16ebab98cd6e0741 ( Context * __context__ ) {
+    TArray<ast::AstFunctionAnnotation *> &  arg_Arr = cast_aot_arg<TArray<ast::AstFunctionAnnotation *> & >::to(*__context__,__context__->abiArguments()[0]);
+    ast::AstFunctionAnnotation * arg_value = cast_aot_arg<ast::AstFunctionAnnotation *>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick10769833213962245646_16ebab98cd6e0741(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__FuncrttiTickclass_infoTick15801393167907430156_8ddd1a6e6de44230 ( Context * __context__ ) {
+    _hint_macros::GetHintFnMacro const  &  arg_cl = cast_aot_arg<_hint_macros::GetHintFnMacro const  & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<StructInfo const  *>::from(_FuncrttiTickclass_infoTick15801393167907430156_8ddd1a6e6de44230(__context__, arg_cl));
+}
+static vec4f __wrap_clone_44b884da8cfd61f6 ( Context * __context__ ) {
+    smart_ptr_raw<ExprCallFunc> & arg_dest = cast_aot_arg<smart_ptr_raw<ExprCallFunc> &>::to(*__context__,__context__->abiArguments()[0]);
+    smart_ptr_raw<ExprCallFunc> const  arg_src = cast_aot_arg<smart_ptr_raw<ExprCallFunc> const >::to(*__context__,__context__->abiArguments()[1]);
+    clone_44b884da8cfd61f6(__context__, arg_dest, arg_src);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickclone_to_moveTick17180087396728260876_c0f293398969f4d5 ( Context * __context__ ) {
+    smart_ptr_raw<ExprCallFunc> arg_clone_src = cast_aot_arg<smart_ptr_raw<ExprCallFunc>>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<smart_ptr_raw<ExprCallFunc>>::from(_FuncbuiltinTickclone_to_moveTick17180087396728260876_c0f293398969f4d5(__context__, arg_clone_src));
+}
+static vec4f __wrap__FuncastTickmake_function_annotationTick3074191368936885601_6cbf350372137434 ( Context * __context__ ) {
+    char * const  arg_name = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    _hint_macros::GetHintFnMacro * arg_someClassPtr = cast_aot_arg<_hint_macros::GetHintFnMacro *>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<smart_ptr_raw<FunctionAnnotation>>::from(_FuncastTickmake_function_annotationTick3074191368936885601_6cbf350372137434(__context__, arg_name, arg_someClassPtr));
+}
+static vec4f __wrap__Funcast_boostTicksetup_tag_annotationTick4095297895764883997_ac640caa0c5c20c4 ( Context * __context__ ) {
+    char * const  arg_name = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_tag = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    _hint_macros::GetHintFnMacro * arg_classPtr = cast_aot_arg<_hint_macros::GetHintFnMacro *>::to(*__context__,__context__->abiArguments()[2]);
+    _Funcast_boostTicksetup_tag_annotationTick4095297895764883997_ac640caa0c5c20c4(__context__, arg_name, arg_tag, arg_classPtr);
+    return v_zero();
+}
+static vec4f __wrap_get_hint_99679cf45fac16d ( Context * __context__ ) {
+    _hint_macros::HintLookup const  &  arg_lookup = cast_aot_arg<_hint_macros::HintLookup const  & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_id = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    char * const  arg_defv = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[2]);
+    uint64_t arg_hint = cast_aot_arg<uint64_t>::to(*__context__,__context__->abiArguments()[3]);
+    return cast<char *>::from(get_hint_99679cf45fac16d(__context__, arg_lookup, arg_id, arg_defv, arg_hint));
+}
+static vec4f __wrap_get_hint_6be43dc38b60755f ( Context * __context__ ) {
+    _hint_macros::HintLookup const  &  arg_lookup = cast_aot_arg<_hint_macros::HintLookup const  & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_id = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    char * const  arg_defv = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[2]);
+    return cast<char *>::from(get_hint_6be43dc38b60755f(__context__, arg_lookup, arg_id, arg_defv));
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x816bf6b50e84940e, false, (void*)&_FuncbuiltinTickpushTick10769833213962245646_16ebab98cd6e0741, &__wrap__FuncbuiltinTickpushTick10769833213962245646_16ebab98cd6e0741 },
+    { 0x87112cc9cf37d8af, false, (void*)&_FuncrttiTickclass_infoTick15801393167907430156_8ddd1a6e6de44230, &__wrap__FuncrttiTickclass_infoTick15801393167907430156_8ddd1a6e6de44230 },
+    { 0x95f35d953d96c711, false, (void*)&clone_44b884da8cfd61f6, &__wrap_clone_44b884da8cfd61f6 },
+    { 0x2f7e4710cec23314, false, (void*)&_FuncbuiltinTickclone_to_moveTick17180087396728260876_c0f293398969f4d5, &__wrap__FuncbuiltinTickclone_to_moveTick17180087396728260876_c0f293398969f4d5 },
+    { 0xc2e99b312fb507bc, false, (void*)&_FuncastTickmake_function_annotationTick3074191368936885601_6cbf350372137434, &__wrap__FuncastTickmake_function_annotationTick3074191368936885601_6cbf350372137434 },
+    { 0xcbd4e0164c18e863, false, (void*)&_Funcast_boostTicksetup_tag_annotationTick4095297895764883997_ac640caa0c5c20c4, &__wrap__Funcast_boostTicksetup_tag_annotationTick4095297895764883997_ac640caa0c5c20c4 },
+    { 0x24c050c317fb8bbe, false, (void*)&get_hint_99679cf45fac16d, &__wrap_get_hint_99679cf45fac16d },
+    { 0x56f32fa2f688e4c3, false, (void*)&get_hint_6be43dc38b60755f, &__wrap_get_hint_6be43dc38b60755f },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x36f3d4b297b6d50c, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_12833343900308138323
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
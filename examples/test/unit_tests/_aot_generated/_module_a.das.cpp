@@ -0,0 +1,151 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require _module_a
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_11213152622569363246 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline char * fun_1_fabee0d34e2177ca ( Context * __context__ );
+inline char * fun_2_fabee0d34e2177ca ( Context * __context__ );
+inline char * fun_3_fabee0d34e2177ca ( Context * __context__ );
+inline char * from_a_get_fun_3_fabee0d34e2177ca ( Context * __context__ );
+inline bool test_b67965a0274f7c37 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global<char *,0x74d05de2bfaa515c>(__context__) = ((char *) "from a");/*global_1*/
+    das_global<char *,0x74d365e2bfac94cb>(__context__) = ((char *) "from a");/*global_2*/
+    das_global<char *,0x74d76de2bfb08b3a>(__context__) = ((char *) "from_a");/*global_3*/
+}
+
+inline char * fun_1_fabee0d34e2177ca ( Context * __context__ )
+{
+    return das_auto_cast<char *>::cast(((char *) "from_a"));
+}
+
+inline char * fun_2_fabee0d34e2177ca ( Context * __context__ )
+{
+    return das_auto_cast<char *>::cast(((char *) "from_a"));
+}
+
+inline char * fun_3_fabee0d34e2177ca ( Context * __context__ )
+{
+    return das_auto_cast<char *>::cast(((char *) "from_a"));
+}
+
+inline char * from_a_get_fun_3_fabee0d34e2177ca ( Context * __context__ )
+{
+    return das_auto_cast<char *>::cast(((char *) "from_a"));
+}
+
+inline bool test_b67965a0274f7c37 ( Context * __context__ )
+{
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_fun_1_fabee0d34e2177ca ( Context * __context__ ) {
+    return cast<char *>::from(fun_1_fabee0d34e2177ca(__context__));
+}
+static vec4f __wrap_fun_2_fabee0d34e2177ca ( Context * __context__ ) {
+    return cast<char *>::from(fun_2_fabee0d34e2177ca(__context__));
+}
+static vec4f __wrap_fun_3_fabee0d34e2177ca ( Context * __context__ ) {
+    return cast<char *>::from(fun_3_fabee0d34e2177ca(__context__));
+}
+static vec4f __wrap_from_a_get_fun_3_fabee0d34e2177ca ( Context * __context__ ) {
+    return cast<char *>::from(from_a_get_fun_3_fabee0d34e2177ca(__context__));
+}
+static vec4f __wrap_test_b67965a0274f7c37 ( Context * __context__ ) {
+    return cast<bool>::from(test_b67965a0274f7c37(__context__));
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xb0506d78cd1003c6, false, (void*)&fun_1_fabee0d34e2177ca, &__wrap_fun_1_fabee0d34e2177ca },
+    { 0xb0506d78cd1003c6, false, (void*)&fun_2_fabee0d34e2177ca, &__wrap_fun_2_fabee0d34e2177ca },
+    { 0xb0506d78cd1003c6, false, (void*)&fun_3_fabee0d34e2177ca, &__wrap_fun_3_fabee0d34e2177ca },
+    { 0xb0506d78cd1003c6, false, (void*)&from_a_get_fun_3_fabee0d34e2177ca, &__wrap_from_a_get_fun_3_fabee0d34e2177ca },
+    { 0xa2406473ca14fc41, false, (void*)&test_b67965a0274f7c37, &__wrap_test_b67965a0274f7c37 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x6ce2a79c82ae222d, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_11213152622569363246
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
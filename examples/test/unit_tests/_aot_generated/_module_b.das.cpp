@@ -0,0 +1,141 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require _module_a
+ // require _module_b
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_10499613571468508206 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline char * fun_1_317472f85605214f ( Context * __context__ );
+inline char * fun_5_317472f85605214f ( Context * __context__ );
+inline char * from_b_get_fun_3_fabee0d34e2177ca ( Context * __context__ );
+inline bool test_b67965a0274f7c37 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global<char *,0x787ad63992156825>(__context__) = ((char *) "from_b");/*global_1*/
+    das_global<char *,0x7870de39920d2138>(__context__) = ((char *) "from_b");/*global_4*/
+}
+
+inline char * fun_1_317472f85605214f ( Context * __context__ )
+{
+    return das_auto_cast<char *>::cast(((char *) "from_b"));
+}
+
+inline char * fun_5_317472f85605214f ( Context * __context__ )
+{
+    return das_auto_cast<char *>::cast(((char *) "from_b"));
+}
+
+inline char * from_b_get_fun_3_fabee0d34e2177ca ( Context * __context__ )
+{
+    return das_auto_cast<char *>::cast(((char *) "from_a"));
+}
+
+inline bool test_b67965a0274f7c37 ( Context * __context__ )
+{
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_fun_1_317472f85605214f ( Context * __context__ ) {
+    return cast<char *>::from(fun_1_317472f85605214f(__context__));
+}
+static vec4f __wrap_fun_5_317472f85605214f ( Context * __context__ ) {
+    return cast<char *>::from(fun_5_317472f85605214f(__context__));
+}
+static vec4f __wrap_from_b_get_fun_3_fabee0d34e2177ca ( Context * __context__ ) {
+    return cast<char *>::from(from_b_get_fun_3_fabee0d34e2177ca(__context__));
+}
+static vec4f __wrap_test_b67965a0274f7c37 ( Context * __context__ ) {
+    return cast<bool>::from(test_b67965a0274f7c37(__context__));
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xd7c8c2bb9fbedb86, false, (void*)&fun_1_317472f85605214f, &__wrap_fun_1_317472f85605214f },
+    { 0xd7c8c2bb9fbedb86, false, (void*)&fun_5_317472f85605214f, &__wrap_fun_5_317472f85605214f },
+    { 0xb0506d78cd1003c6, false, (void*)&from_b_get_fun_3_fabee0d34e2177ca, &__wrap_from_b_get_fun_3_fabee0d34e2177ca },
+    { 0xa2406473ca14fc41, false, (void*)&test_b67965a0274f7c37, &__wrap_test_b67965a0274f7c37 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x1adf7b7c19502349, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_10499613571468508206
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
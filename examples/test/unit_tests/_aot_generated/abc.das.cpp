@@ -0,0 +1,139 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require _c
+ // require _b
+ // require _a
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_6760375598456831058 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline bool _Func_cTickc_funcTick6311709617827569980_23adf5adb5056c3 ( Context * __context__, int32_t __arg_rename_at_5_0 );
+inline bool _Func_bTickb_funcTick16379990349903796477_194a9b164516b970 ( Context * __context__, int32_t __arg_rename_at_7_1 );
+inline bool _Func_aTicka_funcTick364755192145429558_61d5be5a96a46e24 ( Context * __context__, int32_t __arg_rename_at_7_2 );
+inline bool test_8e2efdad19284555 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool _Func_cTickc_funcTick6311709617827569980_23adf5adb5056c3 ( Context * __context__, int32_t __arg_rename_at_5_0 )
+{
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline bool _Func_bTickb_funcTick16379990349903796477_194a9b164516b970 ( Context * __context__, int32_t __arg_rename_at_7_1 )
+{
+    _Func_cTickc_funcTick6311709617827569980_23adf5adb5056c3(__context__,__arg_rename_at_7_1);
+    return das_auto_cast<bool>::cast(_Func_cTickc_funcTick6311709617827569980_23adf5adb5056c3(__context__,__arg_rename_at_7_1));
+}
+
+inline bool _Func_aTicka_funcTick364755192145429558_61d5be5a96a46e24 ( Context * __context__, int32_t __arg_rename_at_7_2 )
+{
+    return das_auto_cast<bool>::cast(_Func_bTickb_funcTick16379990349903796477_194a9b164516b970(__context__,__arg_rename_at_7_2));
+}
+
+inline bool test_8e2efdad19284555 ( Context * __context__ )
+{
+    DAS_VERIFY((_Func_aTicka_funcTick364755192145429558_61d5be5a96a46e24(__context__,13)));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__Func_cTickc_funcTick6311709617827569980_23adf5adb5056c3 ( Context * __context__ ) {
+    int32_t arg_arg = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<bool>::from(_Func_cTickc_funcTick6311709617827569980_23adf5adb5056c3(__context__, arg_arg));
+}
+static vec4f __wrap__Func_bTickb_funcTick16379990349903796477_194a9b164516b970 ( Context * __context__ ) {
+    int32_t arg_arg = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<bool>::from(_Func_bTickb_funcTick16379990349903796477_194a9b164516b970(__context__, arg_arg));
+}
+static vec4f __wrap__Func_aTicka_funcTick364755192145429558_61d5be5a96a46e24 ( Context * __context__ ) {
+    int32_t arg_arg = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<bool>::from(_Func_aTicka_funcTick364755192145429558_61d5be5a96a46e24(__context__, arg_arg));
+}
+static vec4f __wrap_test_8e2efdad19284555 ( Context * __context__ ) {
+    return cast<bool>::from(test_8e2efdad19284555(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x7ea86bc954e3218f, false, (void*)&_Func_cTickc_funcTick6311709617827569980_23adf5adb5056c3, &__wrap__Func_cTickc_funcTick6311709617827569980_23adf5adb5056c3 },
+    { 0x90efd510bc6903b1, false, (void*)&_Func_bTickb_funcTick16379990349903796477_194a9b164516b970, &__wrap__Func_bTickb_funcTick16379990349903796477_194a9b164516b970 },
+    { 0x2d4bbb3f0caf3a21, false, (void*)&_Func_aTicka_funcTick364755192145429558_61d5be5a96a46e24, &__wrap__Func_aTicka_funcTick364755192145429558_61d5be5a96a46e24 },
+    { 0x9896c0ed375982d6, false, (void*)&test_8e2efdad19284555, &__wrap_test_8e2efdad19284555 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_6760375598456831058
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
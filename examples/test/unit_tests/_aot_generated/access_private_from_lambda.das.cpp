@@ -0,0 +1,278 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_1736212498389854842 {
+
+namespace  { struct A; };
+namespace  { struct _lambda_thismodule_9_1; };
+namespace  {
+
+struct A {
+    void * __rtti;
+    Func DAS_COMMENT((void,A)) __finalize;
+    Lambda DAS_COMMENT((void)) onLog;
+    int32_t y;
+    Func DAS_COMMENT((void,A)) install;
+    Func DAS_COMMENT((void,A)) bang;
+};
+static_assert(sizeof(A)==48,"structure size mismatch with DAS");
+static_assert(offsetof(A,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(A,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(A,onLog)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(A,y)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(A,install)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(A,bang)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_9_1 {
+    Func DAS_COMMENT((void,_lambda_thismodule_9_1)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_9_1 *)) __finalize;
+    A * self;
+};
+static_assert(sizeof(_lambda_thismodule_9_1)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_1,self)==16,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__e622630797faee04;
+extern StructInfo __struct_info__d0dbba7439e24618;
+extern TypeInfo __type_info__5c470b849cf304c7;
+extern TypeInfo __type_info__fb840f07aa01bc59;
+extern TypeInfo __type_info__418d1ceb21802ecd;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __struct_info__e622630797faee04_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xdb1e26ce5ebaa78e), "__rtti", 0, 2 };
+TypeInfo * __type_info__fccae31e985a652e_arg_types_var_16582925662197313028[1] = { &__type_info__fb840f07aa01bc59 };
+const char * __type_info__fccae31e985a652e_arg_names_var_16582925662197313028[1] = { "self" };
+VarInfo __struct_info__e622630797faee04_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__fccae31e985a652e_arg_types_var_16582925662197313028, __type_info__fccae31e985a652e_arg_names_var_16582925662197313028, 1, 0, nullptr, 12, 8, UINT64_C(0xfccae31e985a652e), "__finalize", 8, 0 };
+VarInfo __struct_info__e622630797faee04_field_2 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 90112, 8, UINT64_C(0xf05ec4e97e0b5001), "onLog", 16, 6 };
+VarInfo __struct_info__e622630797faee04_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 65564, 4, UINT64_C(0x35b3cddb2fe2da9a), "y", 24, 0 };
+VarInfo __struct_info__e622630797faee04_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__fccae31e985a652e_arg_types_var_16582925662197313028, __type_info__fccae31e985a652e_arg_names_var_16582925662197313028, 1, 0, nullptr, 12, 8, UINT64_C(0xdfcc77006c5b2926), "install", 32, 0 };
+VarInfo __struct_info__e622630797faee04_field_5 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__fccae31e985a652e_arg_types_var_16582925662197313028, __type_info__fccae31e985a652e_arg_names_var_16582925662197313028, 1, 0, nullptr, 12, 8, UINT64_C(0x8c43c172b7784e03), "bang", 40, 0 };
+VarInfo * __struct_info__e622630797faee04_fields[6] =  { &__struct_info__e622630797faee04_field_0, &__struct_info__e622630797faee04_field_1, &__struct_info__e622630797faee04_field_2, &__struct_info__e622630797faee04_field_3, &__struct_info__e622630797faee04_field_4, &__struct_info__e622630797faee04_field_5 };
+StructInfo __struct_info__e622630797faee04 = {"A", "", 13, __struct_info__e622630797faee04_fields, 6, 48, UINT64_C(0xaf63fc4c860222ec), nullptr, UINT64_C(0xe622630797faee04), 0 };
+TypeInfo * __type_info__8148f815a3c1f00e_arg_types_var_15049827588138747416[1] = { &__type_info__418d1ceb21802ecd };
+const char * __type_info__8148f815a3c1f00e_arg_names_var_15049827588138747416[1] = { "__this" };
+VarInfo __struct_info__d0dbba7439e24618_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__8148f815a3c1f00e_arg_types_var_15049827588138747416, __type_info__8148f815a3c1f00e_arg_names_var_15049827588138747416, 1, 0, nullptr, 12, 8, UINT64_C(0x8148f815a3c1f00e), "__lambda", 0, 0 };
+TypeInfo * __type_info__87ab4d30068249a8_arg_types_var_15049827588138747416[1] = { &__type_info__5c470b849cf304c7 };
+VarInfo __struct_info__d0dbba7439e24618_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__87ab4d30068249a8_arg_types_var_15049827588138747416, __type_info__8148f815a3c1f00e_arg_names_var_15049827588138747416, 1, 0, nullptr, 12, 8, UINT64_C(0x87ab4d30068249a8), "__finalize", 8, 0 };
+VarInfo __struct_info__d0dbba7439e24618_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__fb840f07aa01bc59, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xb42a6fedd70808f0), "self", 16, 3 };
+VarInfo * __struct_info__d0dbba7439e24618_fields[3] =  { &__struct_info__d0dbba7439e24618_field_0, &__struct_info__d0dbba7439e24618_field_1, &__struct_info__d0dbba7439e24618_field_2 };
+StructInfo __struct_info__d0dbba7439e24618 = {"_lambda_thismodule_9_1", "", 14, __struct_info__d0dbba7439e24618_fields, 3, 24, UINT64_C(0x0), nullptr, UINT64_C(0xd0dbba7439e24618), 2 };
+TypeInfo __type_info__5c470b849cf304c7 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__418d1ceb21802ecd, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x5c470b849cf304c7) };
+TypeInfo __type_info__fb840f07aa01bc59 = { Type::tStructure, &__struct_info__e622630797faee04, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24578, 48, UINT64_C(0xfb840f07aa01bc59) };
+TypeInfo __type_info__418d1ceb21802ecd = { Type::tStructure, &__struct_info__d0dbba7439e24618, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 24, UINT64_C(0x418d1ceb21802ecd) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void finalize_3ecbbdbe14ff57f0 ( Context * __context__, _lambda_thismodule_9_1 & ____this_rename_at_9_0 );
+inline void _Func_lambda_thismodule_9_1Tickfunction_d4294266db987004 ( Context * __context__, _lambda_thismodule_9_1 & ____this_rename_at_9_1 );
+inline void _Func_lambda_thismodule_9_1Tickfinalizer_dd6c73024d342783 ( Context * __context__, _lambda_thismodule_9_1 * ____this_rename_at_9_2 );
+inline A A_e09aa7901e9a17d9 ( Context * __context__ );
+inline void _FuncATickinstall_3097613a621a62e1 ( Context * __context__, A & __self_rename_at_8_4 );
+inline void _FuncATickbang_d68b0b638c74c4e3 ( Context * __context__, A & __self_rename_at_13_5 );
+inline void finalize_6d2263c94bbaee68 ( Context * __context__, A & __self_rename_at_18_6 );
+inline void _FuncA_0x27___finalize_1eb5e43661eaeeab ( Context * __context__, A & __self_rename_at_2_7 );
+inline bool test_ffa74871ed578b7d ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void finalize_3ecbbdbe14ff57f0 ( Context * __context__, _lambda_thismodule_9_1 &  ____this_rename_at_9_0 )
+{
+    memset((void*)&(____this_rename_at_9_0), 0, 24);
+}
+
+inline void _Func_lambda_thismodule_9_1Tickfunction_d4294266db987004 ( Context * __context__, _lambda_thismodule_9_1 &  ____this_rename_at_9_1 )
+{
+    --das_deref(__context__,____this_rename_at_9_1.self,__FILE__,__LINE__).y;
+}
+
+inline void _Func_lambda_thismodule_9_1Tickfinalizer_dd6c73024d342783 ( Context * __context__, _lambda_thismodule_9_1 * ____this_rename_at_9_2 )
+{
+    finalize_3ecbbdbe14ff57f0(__context__,das_arg<_lambda_thismodule_9_1>::pass(das_deref(__context__,____this_rename_at_9_2,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_9_1 *>::clear(__context__,____this_rename_at_9_2);
+}
+
+inline A A_e09aa7901e9a17d9 ( Context * __context__ )
+{
+    A __self_rename_at_5_3; das_zero(__self_rename_at_5_3); das_move(__self_rename_at_5_3, (([&]() -> A {
+        A __mks_5;
+        das_zero(__mks_5);
+        das_copy((__mks_5.__rtti),(((void *)(&__type_info__fb840f07aa01bc59))));
+        das_copy((__mks_5.__finalize),(Func(__context__->fnByMangledName(/*A'__finalize S<A>*/ 0x637fa5d74f647d67))));
+        das_copy((__mks_5.install),(Func(__context__->fnByMangledName(/*A`install S<A>*/ 0xef79b9f49605431d))));
+        das_copy((__mks_5.bang),(Func(__context__->fnByMangledName(/*A`bang S<A>*/ 0x93dc54a8e2599c42))));
+        return __mks_5;
+    })()));
+    return /* <- */ das_auto_cast_move<A>::cast(__self_rename_at_5_3);
+}
+
+inline void _FuncATickinstall_3097613a621a62e1 ( Context * __context__, A &  __self_rename_at_8_4 )
+{
+    das_move(__self_rename_at_8_4.onLog,das_ascend<void,_lambda_thismodule_9_1>::make(__context__,&__type_info__418d1ceb21802ecd,(([&]() -> _lambda_thismodule_9_1 {
+        _lambda_thismodule_9_1 __mks_9;
+        das_copy((__mks_9.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_9_1`function XS<_lambda_thismodule_9_1>*/ 0xb0a792697039055d))));
+        das_copy((__mks_9.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_9_1`finalizer X1<S<_lambda_thismodule_9_1>>?*/ 0x6ff236f85213e250))));
+        das_copy((__mks_9.self),(das_ref(__context__,__self_rename_at_8_4)));
+        return __mks_9;
+    })())));
+}
+
+inline void _FuncATickbang_d68b0b638c74c4e3 ( Context * __context__, A &  __self_rename_at_13_5 )
+{
+    if ( __self_rename_at_13_5.onLog != nullptr )
+    {
+        das_invoke_lambda<void>::invoke(__context__,nullptr,__self_rename_at_13_5.onLog);
+    };
+}
+
+inline void finalize_6d2263c94bbaee68 ( Context * __context__, A &  __self_rename_at_18_6 )
+{
+    ++__self_rename_at_18_6.y;
+}
+
+inline void _FuncA_0x27___finalize_1eb5e43661eaeeab ( Context * __context__, A &  __self_rename_at_2_7 )
+{
+    finalize_6d2263c94bbaee68(__context__,das_arg<A>::pass(__self_rename_at_2_7));
+}
+
+inline bool test_ffa74871ed578b7d ( Context * __context__ )
+{
+    A * __a_rename_at_25_8 = das_new<A>::make_and_init(__context__,[&]() { return A_e09aa7901e9a17d9(__context__); });
+    das_invoke_method<void,32/*install*/>::invoke<A &>(__context__,nullptr,das_arg<A>::pass(das_cast<A>::cast(das_deref(__context__,__a_rename_at_25_8,__FILE__,__LINE__))));
+    das_invoke_method<void,40/*bang*/>::invoke<A &>(__context__,nullptr,das_arg<A>::pass(das_cast<A>::cast(das_deref(__context__,__a_rename_at_25_8,__FILE__,__LINE__))));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_finalize_3ecbbdbe14ff57f0 ( Context * __context__ ) {
+    _lambda_thismodule_9_1 &  arg___this = cast_aot_arg<_lambda_thismodule_9_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_3ecbbdbe14ff57f0(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_9_1Tickfunction_d4294266db987004 ( Context * __context__ ) {
+    _lambda_thismodule_9_1 &  arg___this = cast_aot_arg<_lambda_thismodule_9_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_9_1Tickfunction_d4294266db987004(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_9_1Tickfinalizer_dd6c73024d342783 ( Context * __context__ ) {
+    _lambda_thismodule_9_1 * arg___this = cast_aot_arg<_lambda_thismodule_9_1 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_9_1Tickfinalizer_dd6c73024d342783(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_A_e09aa7901e9a17d9 ( Context * __context__ ) {
+    *((A *) __context__->abiCMRES) = A_e09aa7901e9a17d9(__context__);
+    return v_zero();
+}
+static vec4f __wrap__FuncATickinstall_3097613a621a62e1 ( Context * __context__ ) {
+    A &  arg_self = cast_aot_arg<A & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncATickinstall_3097613a621a62e1(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap__FuncATickbang_d68b0b638c74c4e3 ( Context * __context__ ) {
+    A &  arg_self = cast_aot_arg<A & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncATickbang_d68b0b638c74c4e3(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap_finalize_6d2263c94bbaee68 ( Context * __context__ ) {
+    A &  arg_self = cast_aot_arg<A & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_6d2263c94bbaee68(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap__FuncA_0x27___finalize_1eb5e43661eaeeab ( Context * __context__ ) {
+    A &  arg_self = cast_aot_arg<A & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncA_0x27___finalize_1eb5e43661eaeeab(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap_test_ffa74871ed578b7d ( Context * __context__ ) {
+    return cast<bool>::from(test_ffa74871ed578b7d(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x9cb80166f3e88ad5, false, (void*)&finalize_3ecbbdbe14ff57f0, &__wrap_finalize_3ecbbdbe14ff57f0 },
+    { 0x2fa373081e730f31, false, (void*)&_Func_lambda_thismodule_9_1Tickfunction_d4294266db987004, &__wrap__Func_lambda_thismodule_9_1Tickfunction_d4294266db987004 },
+    { 0x57fa33b2e10dc075, false, (void*)&_Func_lambda_thismodule_9_1Tickfinalizer_dd6c73024d342783, &__wrap__Func_lambda_thismodule_9_1Tickfinalizer_dd6c73024d342783 },
+    { 0x11a64b41e123466a, true, (void*)&A_e09aa7901e9a17d9, &__wrap_A_e09aa7901e9a17d9 },
+    { 0x5977d29f7a161b8c, false, (void*)&_FuncATickinstall_3097613a621a62e1, &__wrap__FuncATickinstall_3097613a621a62e1 },
+    { 0x179299cb128f8423, false, (void*)&_FuncATickbang_d68b0b638c74c4e3, &__wrap__FuncATickbang_d68b0b638c74c4e3 },
+    { 0xe6a99d13770b7378, false, (void*)&finalize_6d2263c94bbaee68, &__wrap_finalize_6d2263c94bbaee68 },
+    { 0x5ec875986711a864, false, (void*)&_FuncA_0x27___finalize_1eb5e43661eaeeab, &__wrap__FuncA_0x27___finalize_1eb5e43661eaeeab },
+    { 0xb66f395db8a6940c, false, (void*)&test_ffa74871ed578b7d, &__wrap_test_ffa74871ed578b7d },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_1736212498389854842
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,131 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_3610805565225602066 {
+
+// unused enumeration GooEnum
+// unused enumeration OpCode
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void takeFoo_269a28367dde6e41 ( Context * __context__, TestObjectFoo & __foo_rename_at_5_0, TestObjectFoo const  & __fooRO_rename_at_5_1 );
+inline bool test_dfc318d5a6cff860 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void takeFoo_269a28367dde6e41 ( Context * __context__, TestObjectFoo &  __foo_rename_at_5_0, TestObjectFoo const  &  __fooRO_rename_at_5_1 )
+{
+    DAS_VERIFY((!((__foo_rename_at_5_0).isReadOnly())));
+    DAS_ASSERT((((__fooRO_rename_at_5_1).isReadOnly())));
+}
+
+inline bool test_dfc318d5a6cff860 ( Context * __context__ )
+{
+    TestObjectFoo __foo_rename_at_12_2;das_zero(__foo_rename_at_12_2);
+    TestObjectFoo __fooRO_rename_at_13_3_ConstRef;das_zero(__fooRO_rename_at_13_3_ConstRef);
+    TestObjectFoo const  & __fooRO_rename_at_13_3 = __fooRO_rename_at_13_3_ConstRef;
+;
+    DAS_VERIFY((!((__foo_rename_at_12_2).isReadOnly())));
+    DAS_ASSERT((((__fooRO_rename_at_13_3).isReadOnly())));
+    takeFoo_269a28367dde6e41(__context__,das_arg<TestObjectFoo>::pass(__foo_rename_at_12_2),__fooRO_rename_at_13_3);
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_takeFoo_269a28367dde6e41 ( Context * __context__ ) {
+    TestObjectFoo &  arg_foo = cast_aot_arg<TestObjectFoo & >::to(*__context__,__context__->abiArguments()[0]);
+    TestObjectFoo const  &  arg_fooRO = cast_aot_arg<TestObjectFoo const  & >::to(*__context__,__context__->abiArguments()[1]);
+    takeFoo_269a28367dde6e41(__context__, arg_foo, arg_fooRO);
+    return v_zero();
+}
+static vec4f __wrap_test_dfc318d5a6cff860 ( Context * __context__ ) {
+    return cast<bool>::from(test_dfc318d5a6cff860(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xcdb5b77e3fdea086, false, (void*)&takeFoo_269a28367dde6e41, &__wrap_takeFoo_269a28367dde6e41 },
+    { 0x2354592d2dc7ccfa, false, (void*)&test_dfc318d5a6cff860, &__wrap_test_dfc318d5a6cff860 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_3610805565225602066
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
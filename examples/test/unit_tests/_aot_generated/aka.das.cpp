@@ -0,0 +1,153 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_12663775526387887289 {
+
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __func_info__32187064387df852_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x9c581507596aad8c), "x", 0, 0 };
+VarInfo * __func_info__32187064387df852_fields[1] =  { &__func_info__32187064387df852_field_0 };
+FuncInfo __func_info__32187064387df852 = {"invoke block<(x:int const):void> const", "", __func_info__32187064387df852_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x32187064387df852), 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void call_block_6ec12597d3d6ebfa ( Context * __context__, Block DAS_COMMENT((void,int32_t)) const  & __blk_rename_at_14_0 );
+inline bool test_2a7fd16647a92d56 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void call_block_6ec12597d3d6ebfa ( Context * __context__, Block DAS_COMMENT((void,int32_t)) const  &  __blk_rename_at_14_0 )
+{
+    das_invoke<void>::invoke<int32_t>(__context__,nullptr,__blk_rename_at_14_0,5);
+}
+
+inline bool test_2a7fd16647a92d56 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,112,"test " DAS_FILE_LINE);
+{
+    call_block_6ec12597d3d6ebfa(__context__,das_make_block<void,int32_t>(__context__,80,0,&__func_info__32187064387df852,[&](int32_t const  __x_rename_at_22_1) -> void{
+        int32_t __tx_rename_at_23_2 = ((int32_t)__x_rename_at_22_1);
+        DAS_ASSERT((__tx_rename_at_23_2 == __x_rename_at_22_1));
+    }));
+    int32_t __tot_rename_at_26_3 = 0;
+    int32_t __same_rename_at_27_4 = 0;
+    {
+        bool __need_loop_28 = true;
+        // x: int const
+        das_iterator<range> __x_iterator(range(0,10));
+        int32_t __x_rename_at_28_5;
+        __need_loop_28 = __x_iterator.first(__context__,(__x_rename_at_28_5)) && __need_loop_28;
+        for ( ; __need_loop_28 ; __need_loop_28 = __x_iterator.next(__context__,(__x_rename_at_28_5)) )
+        {
+            {
+                bool __need_loop_29 = true;
+                // xx: int const
+                das_iterator<range> __xx_iterator(range(0,10));
+                int32_t __xx_rename_at_29_6;
+                __need_loop_29 = __xx_iterator.first(__context__,(__xx_rename_at_29_6)) && __need_loop_29;
+                for ( ; __need_loop_29 ; __need_loop_29 = __xx_iterator.next(__context__,(__xx_rename_at_29_6)) )
+                {
+                    ++__tot_rename_at_26_3;
+                    if ( __xx_rename_at_29_6 == __x_rename_at_28_5 )
+                    {
+                        ++__same_rename_at_27_4;
+                    };
+                }
+                __xx_iterator.close(__context__,(__xx_rename_at_29_6));
+            };
+        }
+        __x_iterator.close(__context__,(__x_rename_at_28_5));
+    };
+    DAS_ASSERT((__tot_rename_at_26_3 == 100));
+    DAS_ASSERT((__same_rename_at_27_4 == 10));
+    return das_auto_cast<bool>::cast(true);
+}}
+static vec4f __wrap_call_block_6ec12597d3d6ebfa ( Context * __context__ ) {
+    Block DAS_COMMENT((void,int32_t)) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((void,int32_t)) const  & >::to(*__context__,__context__->abiArguments()[0]);
+    call_block_6ec12597d3d6ebfa(__context__, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap_test_2a7fd16647a92d56 ( Context * __context__ ) {
+    return cast<bool>::from(test_2a7fd16647a92d56(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x44ce1bc7513c5569, false, (void*)&call_block_6ec12597d3d6ebfa, &__wrap_call_block_6ec12597d3d6ebfa },
+    { 0x668a1f1b483d762e, false, (void*)&test_2a7fd16647a92d56, &__wrap_test_2a7fd16647a92d56 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_12663775526387887289
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,140 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_12169754699562876622 {
+
+namespace  { struct GunLoc; };
+// unused enumeration GooEnum
+// unused enumeration OpCode
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+namespace  {
+
+struct GunLoc {
+    float3 * gunPos;
+};
+static_assert(sizeof(GunLoc)==8,"structure size mismatch with DAS");
+static_assert(offsetof(GunLoc,gunPos)==0,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void pgp_e98e2a9237598670 ( Context * __context__, GunLoc const  & __gloc_rename_at_9_0 );
+inline bool test_c6aea371b9177aa7 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void pgp_e98e2a9237598670 ( Context * __context__, GunLoc const  &  __gloc_rename_at_9_0 )
+{
+    float3 __gunPos_rename_at_10_1 = ((float3)das_alias<Point3>::from(das_deref(__context__,__gloc_rename_at_9_0.gunPos,__FILE__,__LINE__)));
+    DAS_ASSERT((SimPolicy<float3>::Equ(__gunPos_rename_at_10_1,v_make_vec4f(1.000000e+00f,2.000000e+00f,3.000000e+00f,0.f),*__context__,nullptr)));
+}
+
+inline bool test_c6aea371b9177aa7 ( Context * __context__ )
+{
+    float3 __gpos_rename_at_16_2 = v_make_vec4f(1.000000e+00f,2.000000e+00f,3.000000e+00f,0.f);
+    float3 * __ppos_rename_at_17_3 = das_ref(__context__,__gpos_rename_at_16_2);
+    GunLoc __gun_rename_at_18_4 = (([&]() -> GunLoc {
+        GunLoc __mks_18;
+        das_copy((__mks_18.gunPos),(das_cast<float3 *>::cast(__ppos_rename_at_17_3)));
+        return __mks_18;
+    })());
+    pgp_e98e2a9237598670(__context__,das_arg<GunLoc>::pass(__gun_rename_at_18_4));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_pgp_e98e2a9237598670 ( Context * __context__ ) {
+    GunLoc const  &  arg_gloc = cast_aot_arg<GunLoc const  & >::to(*__context__,__context__->abiArguments()[0]);
+    pgp_e98e2a9237598670(__context__, arg_gloc);
+    return v_zero();
+}
+static vec4f __wrap_test_c6aea371b9177aa7 ( Context * __context__ ) {
+    return cast<bool>::from(test_c6aea371b9177aa7(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x64bd4a80af8d3005, false, (void*)&pgp_e98e2a9237598670, &__wrap_pgp_e98e2a9237598670 },
+    { 0xe5980647a3d139aa, false, (void*)&test_c6aea371b9177aa7, &__wrap_test_c6aea371b9177aa7 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_12169754699562876622
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
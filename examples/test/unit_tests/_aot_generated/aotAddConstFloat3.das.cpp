@@ -0,0 +1,130 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_5901945542155273421 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline float3 add_a4d8d8ead16e5cb7 ( Context * __context__, float3 const  & __a_rename_at_4_0, float3 const  & __b_rename_at_4_1 );
+inline float3 test_add_54e71aaeee99326 ( Context * __context__, float3x4 const  & __m_rename_at_8_2 );
+inline bool test_1feff86f37a698e7 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline float3 add_a4d8d8ead16e5cb7 ( Context * __context__, float3 const  & __a_rename_at_4_0, float3 const  & __b_rename_at_4_1 )
+{
+    return das_auto_cast<float3>::cast(SimPolicy<float3>::Add(__a_rename_at_4_0,__b_rename_at_4_1,*__context__,nullptr));
+}
+
+inline float3 test_add_54e71aaeee99326 ( Context * __context__, float3x4 const  &  __m_rename_at_8_2 )
+{
+    return das_auto_cast<float3>::cast(add_a4d8d8ead16e5cb7(__context__,das_index<float3x4 const >::at(__m_rename_at_8_2,3,__context__),das_index<float3x4 const >::at(__m_rename_at_8_2,3,__context__)));
+}
+
+inline bool test_1feff86f37a698e7 ( Context * __context__ )
+{
+    float3x4 __m_rename_at_14_3_ConstRef;das_zero(__m_rename_at_14_3_ConstRef);
+    float3x4 const  & __m_rename_at_14_3 = __m_rename_at_14_3_ConstRef;
+;
+    DAS_ASSERT((SimPolicy<float3>::Equ(test_add_54e71aaeee99326(__context__,__m_rename_at_14_3),v_zero(),*__context__,nullptr)));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_add_a4d8d8ead16e5cb7 ( Context * __context__ ) {
+    float3 const  & arg_a = cast_aot_arg<float3 const  &>::to(*__context__,__context__->abiArguments()[0]);
+    float3 const  & arg_b = cast_aot_arg<float3 const  &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<float3>::from(add_a4d8d8ead16e5cb7(__context__, arg_a, arg_b));
+}
+static vec4f __wrap_test_add_54e71aaeee99326 ( Context * __context__ ) {
+    float3x4 const  &  arg_m = cast_aot_arg<float3x4 const  & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<float3>::from(test_add_54e71aaeee99326(__context__, arg_m));
+}
+static vec4f __wrap_test_1feff86f37a698e7 ( Context * __context__ ) {
+    return cast<bool>::from(test_1feff86f37a698e7(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xf859c0fe18e644ea, false, (void*)&add_a4d8d8ead16e5cb7, &__wrap_add_a4d8d8ead16e5cb7 },
+    { 0x8d5c72f080e8a98, false, (void*)&test_add_54e71aaeee99326, &__wrap_test_add_54e71aaeee99326 },
+    { 0xc74574d3db4f26d5, false, (void*)&test_1feff86f37a698e7, &__wrap_test_1feff86f37a698e7 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_5901945542155273421
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
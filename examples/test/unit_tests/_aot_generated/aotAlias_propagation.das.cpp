@@ -0,0 +1,211 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_11041069336856302062 {
+
+namespace  { struct MyStruct; };
+namespace  { struct _lambda_thismodule_16_1; };
+namespace  {
+
+struct MyStruct {
+    int32_t value;
+};
+static_assert(sizeof(MyStruct)==4,"structure size mismatch with DAS");
+static_assert(offsetof(MyStruct,value)==0,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_16_1 {
+    Func DAS_COMMENT((void,_lambda_thismodule_16_1,MyStruct * const )) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_16_1 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_16_1)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_1,__finalize)==8,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__38a04e372a071366;
+extern StructInfo __struct_info__cc2e70a6385e2b86;
+extern TypeInfo __type_info__65ab4eef34cd3738;
+extern TypeInfo __type_info__9878e377c77bce70;
+extern TypeInfo __type_info__e91f8181d456575d;
+extern TypeInfo __type_info__4e6919c42cf01b05;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __struct_info__38a04e372a071366_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x656e08e6b31af0cb), "value", 0, 0 };
+VarInfo * __struct_info__38a04e372a071366_fields[1] =  { &__struct_info__38a04e372a071366_field_0 };
+StructInfo __struct_info__38a04e372a071366 = {"MyStruct", "", 0, __struct_info__38a04e372a071366_fields, 1, 4, UINT64_C(0x0), nullptr, UINT64_C(0x38a04e372a071366), 1 };
+TypeInfo * __type_info__4f2198655890129b_arg_types_var_14712820891878566790[2] = { &__type_info__4e6919c42cf01b05, &__type_info__9878e377c77bce70 };
+const char * __type_info__4f2198655890129b_arg_names_var_14712820891878566790[2] = { "__this", "arg" };
+VarInfo __struct_info__cc2e70a6385e2b86_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__4f2198655890129b_arg_types_var_14712820891878566790, __type_info__4f2198655890129b_arg_names_var_14712820891878566790, 2, 0, nullptr, 12, 8, UINT64_C(0x4f2198655890129b), "__lambda", 0, 0 };
+TypeInfo * __type_info__be373dc285e75994_arg_types_var_14712820891878566790[1] = { &__type_info__65ab4eef34cd3738 };
+const char * __type_info__be373dc285e75994_arg_names_var_14712820891878566790[1] = { "__this" };
+VarInfo __struct_info__cc2e70a6385e2b86_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__be373dc285e75994_arg_types_var_14712820891878566790, __type_info__be373dc285e75994_arg_names_var_14712820891878566790, 1, 0, nullptr, 12, 8, UINT64_C(0xbe373dc285e75994), "__finalize", 8, 0 };
+VarInfo * __struct_info__cc2e70a6385e2b86_fields[2] =  { &__struct_info__cc2e70a6385e2b86_field_0, &__struct_info__cc2e70a6385e2b86_field_1 };
+StructInfo __struct_info__cc2e70a6385e2b86 = {"_lambda_thismodule_16_1", "", 14, __struct_info__cc2e70a6385e2b86_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0xcc2e70a6385e2b86), 2 };
+TypeInfo __type_info__65ab4eef34cd3738 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4e6919c42cf01b05, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x65ab4eef34cd3738) };
+TypeInfo __type_info__9878e377c77bce70 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e91f8181d456575d, nullptr, nullptr, nullptr, 0, 0, nullptr, 8236, 8, UINT64_C(0x9878e377c77bce70) };
+TypeInfo __type_info__e91f8181d456575d = { Type::tStructure, &__struct_info__38a04e372a071366, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 4, UINT64_C(0xe91f8181d456575d) };
+TypeInfo __type_info__4e6919c42cf01b05 = { Type::tStructure, &__struct_info__cc2e70a6385e2b86, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 16, UINT64_C(0x4e6919c42cf01b05) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void finalize_3ac798199d187c8f ( Context * __context__, _lambda_thismodule_16_1 & ____this_rename_at_16_0 );
+inline void _FuncTickmy_funcTick3557616767446518487_e7af49e86af21f84 ( Context * __context__, MyStruct const  & __t_rename_at_10_1, Lambda DAS_COMMENT((void,MyStruct * const )) const  __func_rename_at_10_2 );
+inline void _Func_lambda_thismodule_16_1Tickfunction_cf1d425fd8003e98 ( Context * __context__, _lambda_thismodule_16_1 & ____this_rename_at_16_3, MyStruct * const  __arg_rename_at_16_4 );
+inline void _Func_lambda_thismodule_16_1Tickfinalizer_2e88a870360da96b ( Context * __context__, _lambda_thismodule_16_1 * ____this_rename_at_16_5 );
+inline bool test_e87fda7b5e33d2c9 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global<int32_t,0x9a2fb2e6e2a13157>(__context__) = 1;/*a*/
+}
+
+inline void finalize_3ac798199d187c8f ( Context * __context__, _lambda_thismodule_16_1 &  ____this_rename_at_16_0 )
+{
+    memset((void*)&(____this_rename_at_16_0), 0, 16);
+}
+
+inline void _FuncTickmy_funcTick3557616767446518487_e7af49e86af21f84 ( Context * __context__, MyStruct const  &  __t_rename_at_10_1, Lambda DAS_COMMENT((void,MyStruct * const )) const  __func_rename_at_10_2 )
+{
+    das_invoke_lambda<void>::invoke<void *>(__context__,nullptr,__func_rename_at_10_2,nullptr);
+}
+
+inline void _Func_lambda_thismodule_16_1Tickfunction_cf1d425fd8003e98 ( Context * __context__, _lambda_thismodule_16_1 &  ____this_rename_at_16_3, MyStruct * const  __arg_rename_at_16_4 )
+{
+    DAS_ASSERT((__arg_rename_at_16_4 == nullptr));
+    DAS_ASSERT((das_global<int32_t,0x9a2fb2e6e2a13157>(__context__) /*a*/ == 1));
+    ++das_global<int32_t,0x9a2fb2e6e2a13157>(__context__) /*a*/;
+}
+
+inline void _Func_lambda_thismodule_16_1Tickfinalizer_2e88a870360da96b ( Context * __context__, _lambda_thismodule_16_1 * ____this_rename_at_16_5 )
+{
+    finalize_3ac798199d187c8f(__context__,das_arg<_lambda_thismodule_16_1>::pass(das_deref(__context__,____this_rename_at_16_5,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_16_1 *>::clear(__context__,____this_rename_at_16_5);
+}
+
+inline bool test_e87fda7b5e33d2c9 ( Context * __context__ )
+{
+    _FuncTickmy_funcTick3557616767446518487_e7af49e86af21f84(__context__,das_arg<MyStruct>::pass(das_typedecl_value<MyStruct>()()),das_ascend<void,_lambda_thismodule_16_1>::make(__context__,&__type_info__4e6919c42cf01b05,(([&]() -> _lambda_thismodule_16_1 {
+        _lambda_thismodule_16_1 __mks_16;
+        das_copy((__mks_16.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_16_1`function XS<_lambda_thismodule_16_1> C1<S<MyStruct>>?*/ 0x15f7fd9704c6c50f))));
+        das_copy((__mks_16.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_16_1`finalizer X1<S<_lambda_thismodule_16_1>>?*/ 0x1cc13378db307ebf))));
+        return __mks_16;
+    })())));
+    DAS_ASSERT((das_global<int32_t,0x9a2fb2e6e2a13157>(__context__) /*a*/ == 2));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_finalize_3ac798199d187c8f ( Context * __context__ ) {
+    _lambda_thismodule_16_1 &  arg___this = cast_aot_arg<_lambda_thismodule_16_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_3ac798199d187c8f(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickmy_funcTick3557616767446518487_e7af49e86af21f84 ( Context * __context__ ) {
+    MyStruct const  &  arg_t = cast_aot_arg<MyStruct const  & >::to(*__context__,__context__->abiArguments()[0]);
+    Lambda DAS_COMMENT((void,MyStruct * const )) const  arg_func = cast_aot_arg<Lambda DAS_COMMENT((void,MyStruct * const )) const >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTickmy_funcTick3557616767446518487_e7af49e86af21f84(__context__, arg_t, arg_func);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_16_1Tickfunction_cf1d425fd8003e98 ( Context * __context__ ) {
+    _lambda_thismodule_16_1 &  arg___this = cast_aot_arg<_lambda_thismodule_16_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    MyStruct * const  arg_arg = cast_aot_arg<MyStruct * const >::to(*__context__,__context__->abiArguments()[1]);
+    _Func_lambda_thismodule_16_1Tickfunction_cf1d425fd8003e98(__context__, arg___this, arg_arg);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_16_1Tickfinalizer_2e88a870360da96b ( Context * __context__ ) {
+    _lambda_thismodule_16_1 * arg___this = cast_aot_arg<_lambda_thismodule_16_1 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_16_1Tickfinalizer_2e88a870360da96b(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_test_e87fda7b5e33d2c9 ( Context * __context__ ) {
+    return cast<bool>::from(test_e87fda7b5e33d2c9(__context__));
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xfe0eadc353ccbb3b, false, (void*)&finalize_3ac798199d187c8f, &__wrap_finalize_3ac798199d187c8f },
+    { 0x40313f844e2d0d64, false, (void*)&_FuncTickmy_funcTick3557616767446518487_e7af49e86af21f84, &__wrap__FuncTickmy_funcTick3557616767446518487_e7af49e86af21f84 },
+    { 0x44071cdfdcbe8ec8, false, (void*)&_Func_lambda_thismodule_16_1Tickfunction_cf1d425fd8003e98, &__wrap__Func_lambda_thismodule_16_1Tickfunction_cf1d425fd8003e98 },
+    { 0xe78f628cbe602463, false, (void*)&_Func_lambda_thismodule_16_1Tickfinalizer_2e88a870360da96b, &__wrap__Func_lambda_thismodule_16_1Tickfinalizer_2e88a870360da96b },
+    { 0x32fc1724eb618763, false, (void*)&test_e87fda7b5e33d2c9, &__wrap_test_e87fda7b5e33d2c9 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0xdd68728ebc891800, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_11041069336856302062
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,150 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_6303211675075746281 {
+
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+    int32_t a;
+    int32_t b;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==4,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline das::string * _FuncTickget_ecs_stringTick9498483273703617874_97c0a4f3fb42d8d0 ( Context * __context__, Foo const  & __obj_rename_at_11_0, char * const  __name_rename_at_11_1 );
+inline char * _FuncTickget_stringTick3205539809133061543_bc70d73b2d2ba48c ( Context * __context__, Foo const  & __obj_rename_at_15_2, char * const  __name_rename_at_15_3, char * const  __defaultValue_rename_at_15_4 );
+inline bool test_96047799f93e5007 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global_zero<das::string *,0xbc834b1e7e8b56d6>(__context__);/*ds*/
+}
+
+inline das::string * _FuncTickget_ecs_stringTick9498483273703617874_97c0a4f3fb42d8d0 ( Context * __context__, Foo const  &  __obj_rename_at_11_0, char * const  __name_rename_at_11_1 )
+{
+    return das_auto_cast<das::string *>::cast(das_global<das::string *,0xbc834b1e7e8b56d6>(__context__) /*ds*/);
+}
+
+inline char * _FuncTickget_stringTick3205539809133061543_bc70d73b2d2ba48c ( Context * __context__, Foo const  &  __obj_rename_at_15_2, char * const  __name_rename_at_15_3, char * const  __defaultValue_rename_at_15_4 )
+{
+    das::string * __str_rename_at_16_5 = ((das::string *)_FuncTickget_ecs_stringTick9498483273703617874_97c0a4f3fb42d8d0(__context__,__obj_rename_at_15_2,__name_rename_at_15_3));
+    return das_auto_cast<char *>::cast((__str_rename_at_16_5 != nullptr) ? das_auto_cast<char * const >::cast(((char * const )(to_das_string(das_deref(__context__,__str_rename_at_16_5,__FILE__,__LINE__),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))) : das_auto_cast<char * const >::cast(__defaultValue_rename_at_15_4));
+}
+
+inline bool test_96047799f93e5007 ( Context * __context__ )
+{
+    Foo __abilityObj_rename_at_22_6_ConstRef;das_zero(__abilityObj_rename_at_22_6_ConstRef);
+    Foo const  & __abilityObj_rename_at_22_6 = __abilityObj_rename_at_22_6_ConstRef;
+;
+    char * __name_rename_at_23_7 = (char *)(_FuncTickget_stringTick3205539809133061543_bc70d73b2d2ba48c(__context__,__abilityObj_rename_at_22_6,((char *) "name"),nullptr));
+    das_copy(__name_rename_at_23_7,_FuncTickget_stringTick3205539809133061543_bc70d73b2d2ba48c(__context__,__abilityObj_rename_at_22_6,((char *) "name"),nullptr));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncTickget_ecs_stringTick9498483273703617874_97c0a4f3fb42d8d0 ( Context * __context__ ) {
+    Foo const  &  arg_obj = cast_aot_arg<Foo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_name = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<das::string *>::from(_FuncTickget_ecs_stringTick9498483273703617874_97c0a4f3fb42d8d0(__context__, arg_obj, arg_name));
+}
+static vec4f __wrap__FuncTickget_stringTick3205539809133061543_bc70d73b2d2ba48c ( Context * __context__ ) {
+    Foo const  &  arg_obj = cast_aot_arg<Foo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_name = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    char * const  arg_defaultValue = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[2]);
+    return cast<char *>::from(_FuncTickget_stringTick3205539809133061543_bc70d73b2d2ba48c(__context__, arg_obj, arg_name, arg_defaultValue));
+}
+static vec4f __wrap_test_96047799f93e5007 ( Context * __context__ ) {
+    return cast<bool>::from(test_96047799f93e5007(__context__));
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x7d58908b4e58d5d, false, (void*)&_FuncTickget_ecs_stringTick9498483273703617874_97c0a4f3fb42d8d0, &__wrap__FuncTickget_ecs_stringTick9498483273703617874_97c0a4f3fb42d8d0 },
+    { 0x2d3c7e9d73a43045, false, (void*)&_FuncTickget_stringTick3205539809133061543_bc70d73b2d2ba48c, &__wrap__FuncTickget_stringTick3205539809133061543_bc70d73b2d2ba48c },
+    { 0xa2f07921f4d1f43f, false, (void*)&test_96047799f93e5007, &__wrap_test_96047799f93e5007 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x307e8678832ded18, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_6303211675075746281
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,788 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14940951252859693979 {
+
+namespace  { struct Foo; };
+// unused enumeration GooEnum
+// unused enumeration OpCode
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+namespace  {
+
+struct Foo {
+    int32_t bar;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,bar)==0,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__411ed0e77075265a;
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__bc69a005531fe739;
+extern TypeInfo __type_info__118e16a7356ca310;
+extern TypeInfo __type_info__bcb97beea857e3e;
+extern TypeInfo __type_info__653db65361a3c610;
+extern TypeInfo __type_info__c4e7914a3746eb3e;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af63ee4c86020b22;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __struct_info__411ed0e77075265a_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x384ed16514488015), "bar", 0, 0 };
+VarInfo * __struct_info__411ed0e77075265a_fields[1] =  { &__struct_info__411ed0e77075265a_field_0 };
+StructInfo __struct_info__411ed0e77075265a = {"Foo", "", 0, __struct_info__411ed0e77075265a_fields, 1, 4, UINT64_C(0x0), nullptr, UINT64_C(0x411ed0e77075265a), 1 };
+VarInfo __func_info__d23ecd373e379628_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63ee4c86020b22, nullptr, nullptr, nullptr, 0, 0, nullptr, 57442, 24, UINT64_C(0x335dc116793f6a22), "arr", 0, 0 };
+VarInfo * __func_info__d23ecd373e379628_fields[1] =  { &__func_info__d23ecd373e379628_field_0 };
+FuncInfo __func_info__d23ecd373e379628 = {"invoke block<(arr:array<string> const#):void> const", "", __func_info__d23ecd373e379628_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xd23ecd373e379628), 0x0 };
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__bc69a005531fe739 = { Type::tStructure, &__struct_info__411ed0e77075265a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 4, UINT64_C(0xbc69a005531fe739) };
+TypeInfo __type_info__118e16a7356ca310 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__bc69a005531fe739, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x118e16a7356ca310) };
+TypeInfo __type_info__bcb97beea857e3e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xbcb97beea857e3e) };
+TypeInfo __type_info__653db65361a3c610 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__bc69a005531fe739, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x653db65361a3c610) };
+TypeInfo __type_info__c4e7914a3746eb3e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xc4e7914a3746eb3e) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__af63ee4c86020b22 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0xaf63ee4c86020b22) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__118e16a7356ca310, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_1[2] = { &__type_info__653db65361a3c610, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_2[2] = { &__type_info__bcb97beea857e3e, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_3[2] = { &__type_info__c4e7914a3746eb3e, &__type_info__af90fe4c864e9d52 };
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009 ( Context * __context__, TArray<char *> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_564a581d393af548 ( Context * __context__, TArray<Foo> & __Arr_rename_at_68_2, int32_t __newSize_rename_at_68_3 );
+inline void _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_17958f88da70242d ( Context * __context__, TArray<Foo> & __a_rename_at_32_4, TArray<Foo> & __b_rename_at_32_5 );
+inline void _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5 ( Context * __context__, TArray<int32_t> & __a_rename_at_32_6, TArray<int32_t> & __b_rename_at_32_7 );
+inline TArray<char *> _FuncbuiltinTickto_array_moveTick3185538323411982277_7bcf9746c1f1b7c6 ( Context * __context__, TDim<char *,1> & __a_rename_at_1502_8 );
+inline TArray<Foo> _FuncbuiltinTickto_array_moveTick3185538323411982277_71dc3bb75ba701a3 ( Context * __context__, TDim<Foo,2> & __a_rename_at_1502_10 );
+inline void _FuncbuiltinTickpushTick14948358808039962334_d37151c73c14e736 ( Context * __context__, TArray<Foo> & __Arr_rename_at_237_12, TDim<Foo,1> const  & __varr_rename_at_237_13 );
+inline void _FuncbuiltinTickpush_cloneTick14318757644960593747_4e2307346f07cfa7 ( Context * __context__, TArray<Foo> & __Arr_rename_at_423_15, TDim<Foo,1> & __varr_rename_at_423_16 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_68_18, int32_t __newSize_rename_at_68_19 );
+inline void _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_177_20, int32_t __value_rename_at_177_21 );
+inline void _FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_137_22, int32_t __newSize_rename_at_137_23 );
+inline void _FuncbuiltinTickpushTick14934788096129379580_9c3c2abdcd3c6241 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_149_24, int32_t __value_rename_at_149_25, int32_t __at_rename_at_149_26 );
+inline void _FuncbuiltinTickeraseTick16646986352019611268_7aa29df899f2f2e8 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_552_27, int32_t __at_rename_at_552_28 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_28d604f96e80b263 ( Context * __context__, TArray<Foo const > & __Arr_rename_at_68_29, int32_t __newSize_rename_at_68_30 );
+inline void _FuncbuiltinTickpushTick16590575971159035031_fb91b0d640782be8 ( Context * __context__, TArray<Foo> & __Arr_rename_at_223_31, TArray<Foo> & __varr_rename_at_223_32 );
+inline void make_test_array_941ac340def55f59 ( Context * __context__, TArray<int32_t> & __a_rename_at_10_34, int32_t __extra_rename_at_10_35 );
+inline void verify_test_array_5c52993fba559c7b ( Context * __context__, TArray<int32_t> const  & __a_rename_at_19_38, int32_t __extra_rename_at_19_39 );
+inline void pass_array_ff501e424c345c ( Context * __context__, TArray<int32_t> & __arr_rename_at_28_42 );
+inline void verifyIntArray_128242fb5aca6a29 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_33_43, int32_t __s_rename_at_33_44, int32_t __c_rename_at_33_45, int32_t __tail_rename_at_33_46 );
+inline void testIntArray_8519de60b6cd03f5 ( Context * __context__ );
+inline void testInterop_7303003f020545d0 ( Context * __context__ );
+inline bool test_19e35adf0fcaf31 ( Context * __context__ );
+inline bool testAccept_770f2bf690ce3aaf ( Context * __context__, TArray<Foo const > const  & __t_rename_at_173_75, TDim<Foo,10> const  & __e_rename_at_173_76 );
+inline void testConstInArray_d92ad5cc074c0732 ( Context * __context__ );
+inline void testMultiPush_ea9b9ea0ea1985dd ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009 ( Context * __context__, TArray<char *> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_564a581d393af548 ( Context * __context__, TArray<Foo> &  __Arr_rename_at_68_2, int32_t __newSize_rename_at_68_3 )
+{
+    builtin_array_resize(das_arg<TArray<Foo>>::pass(__Arr_rename_at_68_2),__newSize_rename_at_68_3,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_17958f88da70242d ( Context * __context__, TArray<Foo> &  __a_rename_at_32_4, TArray<Foo> &  __b_rename_at_32_5 )
+{
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<TArray<Foo> &>::from(__a_rename_at_32_4),cast<char * const >::from(((char *) "object can't be moved to because it is locked"))));
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<TArray<Foo> &>::from(__b_rename_at_32_5),cast<char * const >::from(((char *) "object can't be moved from because it is locked"))));
+    das_move(__a_rename_at_32_4,__b_rename_at_32_5);
+}
+
+inline void _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5 ( Context * __context__, TArray<int32_t> &  __a_rename_at_32_6, TArray<int32_t> &  __b_rename_at_32_7 )
+{
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_2,cast<TArray<int32_t> &>::from(__a_rename_at_32_6),cast<char * const >::from(((char *) "object can't be moved to because it is locked"))));
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_3,cast<TArray<int32_t> &>::from(__b_rename_at_32_7),cast<char * const >::from(((char *) "object can't be moved from because it is locked"))));
+    das_move(__a_rename_at_32_6,__b_rename_at_32_7);
+}
+
+inline TArray<char *> _FuncbuiltinTickto_array_moveTick3185538323411982277_7bcf9746c1f1b7c6 ( Context * __context__, TDim<char *,1> &  __a_rename_at_1502_8 )
+{
+    TArray<char *> __arr_rename_at_1504_9;das_zero(__arr_rename_at_1504_9);
+    _FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_1504_9),1);
+    das_copy(das_cast<TDim<char *,1>>::cast(das_ref(__context__,__arr_rename_at_1504_9(0,__context__))),__a_rename_at_1502_8);
+    return /* <- */ das_auto_cast_move<TArray<char *>>::cast(__arr_rename_at_1504_9);
+}
+
+inline TArray<Foo> _FuncbuiltinTickto_array_moveTick3185538323411982277_71dc3bb75ba701a3 ( Context * __context__, TDim<Foo,2> &  __a_rename_at_1502_10 )
+{
+    TArray<Foo> __arr_rename_at_1504_11;das_zero(__arr_rename_at_1504_11);
+    _FuncbuiltinTickresizeTick4811697762258667383_564a581d393af548(__context__,das_arg<TArray<Foo>>::pass(__arr_rename_at_1504_11),2);
+    das_copy(das_cast<TDim<Foo,2>>::cast(das_ref(__context__,__arr_rename_at_1504_11(0,__context__))),__a_rename_at_1502_10);
+    return /* <- */ das_auto_cast_move<TArray<Foo>>::cast(__arr_rename_at_1504_11);
+}
+
+inline void _FuncbuiltinTickpushTick14948358808039962334_d37151c73c14e736 ( Context * __context__, TArray<Foo> &  __Arr_rename_at_237_12, TDim<Foo,1> const  &  __varr_rename_at_237_13 )
+{
+    {
+        bool __need_loop_242 = true;
+        // t: Foo aka numT const&
+        das_iterator<TDim<Foo,1> const > __t_iterator(__varr_rename_at_237_13);
+        Foo const  * __t_rename_at_242_14;
+        __need_loop_242 = __t_iterator.first(__context__,(__t_rename_at_242_14)) && __need_loop_242;
+        for ( ; __need_loop_242 ; __need_loop_242 = __t_iterator.next(__context__,(__t_rename_at_242_14)) )
+        {
+            das_copy(__Arr_rename_at_237_12(builtin_array_push_back(das_arg<TArray<Foo>>::pass(__Arr_rename_at_237_12),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),(*__t_rename_at_242_14));
+        }
+        __t_iterator.close(__context__,(__t_rename_at_242_14));
+    };
+}
+
+inline void _FuncbuiltinTickpush_cloneTick14318757644960593747_4e2307346f07cfa7 ( Context * __context__, TArray<Foo> &  __Arr_rename_at_423_15, TDim<Foo,1> &  __varr_rename_at_423_16 )
+{
+    {
+        bool __need_loop_428 = true;
+        // t: Foo aka numT&
+        das_iterator<TDim<Foo,1>> __t_iterator(__varr_rename_at_423_16);
+        Foo * __t_rename_at_428_17;
+        __need_loop_428 = __t_iterator.first(__context__,(__t_rename_at_428_17)) && __need_loop_428;
+        for ( ; __need_loop_428 ; __need_loop_428 = __t_iterator.next(__context__,(__t_rename_at_428_17)) )
+        {
+            das_copy(__Arr_rename_at_423_15(builtin_array_push_back(das_arg<TArray<Foo>>::pass(__Arr_rename_at_423_15),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),(*__t_rename_at_428_17));
+        }
+        __t_iterator.close(__context__,(__t_rename_at_428_17));
+    };
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_68_18, int32_t __newSize_rename_at_68_19 )
+{
+    builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_68_18),__newSize_rename_at_68_19,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_177_20, int32_t __value_rename_at_177_21 )
+{
+    das_copy(__Arr_rename_at_177_20(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_177_20),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_177_21);
+}
+
+inline void _FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_137_22, int32_t __newSize_rename_at_137_23 )
+{
+    builtin_array_reserve(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_137_22),__newSize_rename_at_137_23,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickpushTick14934788096129379580_9c3c2abdcd3c6241 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_149_24, int32_t __value_rename_at_149_25, int32_t __at_rename_at_149_26 )
+{
+    das_copy(__Arr_rename_at_149_24(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_149_24),__at_rename_at_149_26,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_149_25);
+}
+
+inline void _FuncbuiltinTickeraseTick16646986352019611268_7aa29df899f2f2e8 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_552_27, int32_t __at_rename_at_552_28 )
+{
+    builtin_array_erase(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_552_27),__at_rename_at_552_28,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_28d604f96e80b263 ( Context * __context__, TArray<Foo const > &  __Arr_rename_at_68_29, int32_t __newSize_rename_at_68_30 )
+{
+    builtin_array_resize(das_arg<TArray<Foo const >>::pass(__Arr_rename_at_68_29),__newSize_rename_at_68_30,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickpushTick16590575971159035031_fb91b0d640782be8 ( Context * __context__, TArray<Foo> &  __Arr_rename_at_223_31, TArray<Foo> &  __varr_rename_at_223_32 )
+{
+    {
+        bool __need_loop_228 = true;
+        // t: Foo aka numT&
+        das_iterator<TArray<Foo>> __t_iterator(__varr_rename_at_223_32);
+        Foo * __t_rename_at_228_33;
+        __need_loop_228 = __t_iterator.first(__context__,(__t_rename_at_228_33)) && __need_loop_228;
+        for ( ; __need_loop_228 ; __need_loop_228 = __t_iterator.next(__context__,(__t_rename_at_228_33)) )
+        {
+            das_copy(__Arr_rename_at_223_31(builtin_array_push_back(das_arg<TArray<Foo>>::pass(__Arr_rename_at_223_31),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),(*__t_rename_at_228_33));
+        }
+        __t_iterator.close(__context__,(__t_rename_at_228_33));
+    };
+}
+
+inline void make_test_array_941ac340def55f59 ( Context * __context__, TArray<int32_t> &  __a_rename_at_10_34, int32_t __extra_rename_at_10_35 )
+{
+    int32_t __i_rename_at_11_36 = 0;
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_10_34),10);
+    {
+        bool __need_loop_13 = true;
+        // x: int&
+        das_iterator<TArray<int32_t>> __x_iterator(__a_rename_at_10_34);
+        int32_t * __x_rename_at_13_37;
+        __need_loop_13 = __x_iterator.first(__context__,(__x_rename_at_13_37)) && __need_loop_13;
+        for ( ; __need_loop_13 ; __need_loop_13 = __x_iterator.next(__context__,(__x_rename_at_13_37)) )
+        {
+            das_copy((*__x_rename_at_13_37),__i_rename_at_11_36++ + __extra_rename_at_10_35);
+        }
+        __x_iterator.close(__context__,(__x_rename_at_13_37));
+    };
+}
+
+inline void verify_test_array_5c52993fba559c7b ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_19_38, int32_t __extra_rename_at_19_39 )
+{
+    DAS_ASSERT((builtin_array_size(__a_rename_at_19_38) == 10));
+    int32_t __i_rename_at_21_40 = 0;
+    {
+        bool __need_loop_22 = true;
+        // x: int const&
+        das_iterator<TArray<int32_t> const > __x_iterator(__a_rename_at_19_38);
+        int32_t const  * __x_rename_at_22_41;
+        __need_loop_22 = __x_iterator.first(__context__,(__x_rename_at_22_41)) && __need_loop_22;
+        for ( ; __need_loop_22 ; __need_loop_22 = __x_iterator.next(__context__,(__x_rename_at_22_41)) )
+        {
+            DAS_VERIFY(((*__x_rename_at_22_41) == (__extra_rename_at_19_39 + __i_rename_at_21_40++)));
+        }
+        __x_iterator.close(__context__,(__x_rename_at_22_41));
+    };
+}
+
+inline void pass_array_ff501e424c345c ( Context * __context__, TArray<int32_t> &  __arr_rename_at_28_42 )
+{
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_28_42),4);
+}
+
+inline void verifyIntArray_128242fb5aca6a29 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_33_43, int32_t __s_rename_at_33_44, int32_t __c_rename_at_33_45, int32_t __tail_rename_at_33_46 )
+{
+    {
+        bool __need_loop_34 = true;
+        // t: int const
+        das_iterator<range> __t_iterator(mk_range(__c_rename_at_33_45));
+        int32_t __t_rename_at_34_47;
+        __need_loop_34 = __t_iterator.first(__context__,(__t_rename_at_34_47)) && __need_loop_34;
+        for ( ; __need_loop_34 ; __need_loop_34 = __t_iterator.next(__context__,(__t_rename_at_34_47)) )
+        {
+            DAS_VERIFY((__a_rename_at_33_43(__t_rename_at_34_47,__context__) == __s_rename_at_33_44++));
+        }
+        __t_iterator.close(__context__,(__t_rename_at_34_47));
+    };
+    {
+        bool __need_loop_37 = true;
+        // t: int const
+        das_iterator<range> __t_iterator(range(__c_rename_at_33_45,__c_rename_at_33_45 + __tail_rename_at_33_46));
+        int32_t __t_rename_at_37_48;
+        __need_loop_37 = __t_iterator.first(__context__,(__t_rename_at_37_48)) && __need_loop_37;
+        for ( ; __need_loop_37 ; __need_loop_37 = __t_iterator.next(__context__,(__t_rename_at_37_48)) )
+        {
+            DAS_ASSERT((__a_rename_at_33_43(__t_rename_at_37_48,__context__) == 0));
+        }
+        __t_iterator.close(__context__,(__t_rename_at_37_48));
+    };
+}
+
+inline void testIntArray_8519de60b6cd03f5 ( Context * __context__ )
+{
+    TArray<int32_t> __arr_rename_at_44_49;das_zero(__arr_rename_at_44_49); TArray<int32_t> __arr2_rename_at_44_50;das_zero(__arr2_rename_at_44_50);
+    DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49)) == 0),(((char *) "array starts at 0 length")));
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),1);
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),2);
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),3);
+    DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49)) == 3),(((char *) "array length is 3")));
+    DAS_ASSERTF((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49)) == 16),(((char *) "its 2x, but no less than 16")));
+    verifyIntArray_128242fb5aca6a29(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),1,3,0);
+    pass_array_ff501e424c345c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49));
+    DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49)) == 4),(((char *) "array length is 4")));
+    verifyIntArray_128242fb5aca6a29(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),1,4,0);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),6);
+    DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49)) == 6),(((char *) "array length is now 6")));
+    verifyIntArray_128242fb5aca6a29(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),1,4,2);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),17);
+    verifyIntArray_128242fb5aca6a29(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),1,4,13);
+    DAS_ASSERTF((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49)) == 32),(((char *) "now bigger")));
+    _FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),33);
+    verifyIntArray_128242fb5aca6a29(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),1,4,13);
+    DAS_ASSERTF((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49)) == 33),(((char *) "now even bigger")));
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),4);
+    DAS_ASSERTF((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49)) == 33),(((char *) "did not grow smaller")));
+    DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49)) == 4),(((char *) "resized properly")));
+    _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5(__context__,das_arg<TArray<int32_t>>::pass(__arr2_rename_at_44_50),das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49));
+    DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49)) == 0));
+    DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr2_rename_at_44_50)) == 4));
+    int32_t __index_rename_at_71_51 = 0;
+    while ( __index_rename_at_71_51 < 4 )
+    {
+        ++__arr2_rename_at_44_50(__index_rename_at_71_51++,__context__);
+    };
+    verifyIntArray_128242fb5aca6a29(__context__,das_arg<TArray<int32_t>>::pass(__arr2_rename_at_44_50),2,4,0);
+    _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),das_arg<TArray<int32_t>>::pass(__arr2_rename_at_44_50));
+    verifyIntArray_128242fb5aca6a29(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),2,4,0);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),3);
+    verifyIntArray_128242fb5aca6a29(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),2,3,0);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),4);
+    DAS_ASSERTF((__arr_rename_at_44_49(3,__context__) == 0),(((char *) "new element after resize is 0")));
+    verifyIntArray_128242fb5aca6a29(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),2,3,1);
+    _FuncbuiltinTickpushTick14934788096129379580_9c3c2abdcd3c6241(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),1,0);
+    verifyIntArray_128242fb5aca6a29(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),1,4,1);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),4);
+    _FuncbuiltinTickpushTick14934788096129379580_9c3c2abdcd3c6241(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),5,4);
+    verifyIntArray_128242fb5aca6a29(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),1,5,0);
+    _FuncbuiltinTickpushTick14934788096129379580_9c3c2abdcd3c6241(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),7,2);
+    _FuncbuiltinTickeraseTick16646986352019611268_7aa29df899f2f2e8(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),2);
+    verifyIntArray_128242fb5aca6a29(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),1,5,0);
+    _FuncbuiltinTickeraseTick16646986352019611268_7aa29df899f2f2e8(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),0);
+    _FuncbuiltinTickeraseTick16646986352019611268_7aa29df899f2f2e8(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),3);
+    verifyIntArray_128242fb5aca6a29(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_44_49),2,3,0);
+}
+
+inline void testInterop_7303003f020545d0 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,160,"testInterop " DAS_FILE_LINE);
+{
+    TArray<char *> _temp_make_local_97_33_0; _temp_make_local_97_33_0;
+    TDim<char *,1> _temp_make_local_97_33_1; _temp_make_local_97_33_1;
+    bool __res_rename_at_97_52 = ((bool)tempArrayExample(das_arg<TArray<char *>>::pass((_temp_make_local_97_33_0 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_7bcf9746c1f1b7c6(__context__,das_arg<TDim<char *,1>>::pass((([&]() -> TDim<char *,1>& {
+        _temp_make_local_97_33_1(0,__context__) = ((char *) "one");
+        return _temp_make_local_97_33_1;
+    })())))))),das_make_block<void,TArray<char *> const  &>(__context__,144,0,&__func_info__d23ecd373e379628,[&](TArray<char *> const  & __arr_rename_at_97_53) -> void{
+        DAS_ASSERT((builtin_array_size(__arr_rename_at_97_53) == 1));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__arr_rename_at_97_53(0,__context__)),cast<char *>::from(((char *) "one")),*__context__,nullptr)));
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+    DAS_ASSERT((__res_rename_at_97_52));
+}}
+
+inline bool test_19e35adf0fcaf31 ( Context * __context__ )
+{
+    TArray<int32_t> __a_rename_at_107_54;das_zero(__a_rename_at_107_54);
+    make_test_array_941ac340def55f59(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_107_54),0);
+    verify_test_array_5c52993fba559c7b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_107_54),0);
+    make_test_array_941ac340def55f59(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_107_54),13);
+    verify_test_array_5c52993fba559c7b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_107_54),13);
+    make_test_array_941ac340def55f59(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_107_54),0);
+    verify_test_array_5c52993fba559c7b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_107_54),0);
+    TArray<int32_t> __b_rename_at_115_55; das_zero(__b_rename_at_115_55); das_move(__b_rename_at_115_55, __a_rename_at_107_54);
+    DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_107_54)) == 0));
+    verify_test_array_5c52993fba559c7b(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_115_55),0);
+    _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_107_54),das_arg<TArray<int32_t>>::pass(__b_rename_at_115_55));
+    verify_test_array_5c52993fba559c7b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_107_54),0);
+    TArray<int32_t> __a_rename_at_123_56;das_zero(__a_rename_at_123_56); TArray<int32_t> __b_rename_at_123_57;das_zero(__b_rename_at_123_57);
+    int32_t __i_rename_at_124_58 = 0;
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_123_56),10);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_123_57),10);
+    {
+        bool __need_loop_127 = true;
+        // l: int&
+        das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_123_56);
+        int32_t * __l_rename_at_127_61;
+        __need_loop_127 = __l_iterator.first(__context__,(__l_rename_at_127_61)) && __need_loop_127;
+        // r: int&
+        das_iterator<TArray<int32_t>> __r_iterator(__b_rename_at_123_57);
+        int32_t * __r_rename_at_127_62;
+        __need_loop_127 = __r_iterator.first(__context__,(__r_rename_at_127_62)) && __need_loop_127;
+        for ( ; __need_loop_127 ; __need_loop_127 = __l_iterator.next(__context__,(__l_rename_at_127_61)) && __r_iterator.next(__context__,(__r_rename_at_127_62)) )
+        {
+            das_copy((*__l_rename_at_127_61),__i_rename_at_124_58);
+            das_copy((*__r_rename_at_127_62),(__i_rename_at_124_58 * 2) - 5);
+            ++__i_rename_at_124_58;
+        }
+        __r_iterator.close(__context__,(__r_rename_at_127_62));
+        __l_iterator.close(__context__,(__l_rename_at_127_61));
+    };
+    verify_test_array_5c52993fba559c7b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_123_56),0);
+    das_copy(__i_rename_at_124_58,0);
+    {
+        bool __need_loop_134 = true;
+        // l: int&
+        das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_123_56);
+        int32_t * __l_rename_at_134_65;
+        __need_loop_134 = __l_iterator.first(__context__,(__l_rename_at_134_65)) && __need_loop_134;
+        // r: int&
+        das_iterator<TArray<int32_t>> __r_iterator(__b_rename_at_123_57);
+        int32_t * __r_rename_at_134_66;
+        __need_loop_134 = __r_iterator.first(__context__,(__r_rename_at_134_66)) && __need_loop_134;
+        for ( ; __need_loop_134 ; __need_loop_134 = __l_iterator.next(__context__,(__l_rename_at_134_65)) && __r_iterator.next(__context__,(__r_rename_at_134_66)) )
+        {
+            DAS_ASSERT(((*__l_rename_at_134_65) == __i_rename_at_124_58));
+            DAS_ASSERT(((*__r_rename_at_134_66) == ((__i_rename_at_124_58 * 2) - 5)));
+            ++__i_rename_at_124_58;
+        }
+        __r_iterator.close(__context__,(__r_rename_at_134_66));
+        __l_iterator.close(__context__,(__l_rename_at_134_65));
+    };
+    das_copy(__i_rename_at_124_58,0);
+    {
+        bool __need_loop_140 = true;
+        // l: int&
+        das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_123_56);
+        int32_t * __l_rename_at_140_69;
+        __need_loop_140 = __l_iterator.first(__context__,(__l_rename_at_140_69)) && __need_loop_140;
+        // r: int&
+        das_iterator<TArray<int32_t>> __r_iterator(__b_rename_at_123_57);
+        int32_t * __r_rename_at_140_70;
+        __need_loop_140 = __r_iterator.first(__context__,(__r_rename_at_140_70)) && __need_loop_140;
+        for ( ; __need_loop_140 ; __need_loop_140 = __l_iterator.next(__context__,(__l_rename_at_140_69)) && __r_iterator.next(__context__,(__r_rename_at_140_70)) )
+        {
+            if ( (*__l_rename_at_140_69) > (*__r_rename_at_140_70) )
+            {
+                DAS_ASSERT(((*__l_rename_at_140_69) > (*__r_rename_at_140_70)));
+                ++__i_rename_at_124_58;
+            };
+        }
+        __r_iterator.close(__context__,(__r_rename_at_140_70));
+        __l_iterator.close(__context__,(__l_rename_at_140_69));
+    };
+    DAS_ASSERT((__i_rename_at_124_58 == 5));
+    TDim<TArray<int32_t>,10> __a_rename_at_149_71;das_zero(__a_rename_at_149_71);
+    int32_t __i_rename_at_150_72 = 0;
+    {
+        bool __need_loop_151 = true;
+        // b: array<int>& -const
+        das_iterator<TDim<TArray<int32_t>,10>> __b_iterator(__a_rename_at_149_71);
+        TArray<int32_t> * __b_rename_at_151_73;
+        __need_loop_151 = __b_iterator.first(__context__,(__b_rename_at_151_73)) && __need_loop_151;
+        for ( ; __need_loop_151 ; __need_loop_151 = __b_iterator.next(__context__,(__b_rename_at_151_73)) )
+        {
+            make_test_array_941ac340def55f59(__context__,das_arg<TArray<int32_t>>::pass((*__b_rename_at_151_73)),__i_rename_at_150_72++);
+        }
+        __b_iterator.close(__context__,(__b_rename_at_151_73));
+    };
+    das_copy(__i_rename_at_150_72,0);
+    {
+        bool __need_loop_155 = true;
+        // b: array<int>& -const
+        das_iterator<TDim<TArray<int32_t>,10>> __b_iterator(__a_rename_at_149_71);
+        TArray<int32_t> * __b_rename_at_155_74;
+        __need_loop_155 = __b_iterator.first(__context__,(__b_rename_at_155_74)) && __need_loop_155;
+        for ( ; __need_loop_155 ; __need_loop_155 = __b_iterator.next(__context__,(__b_rename_at_155_74)) )
+        {
+            verify_test_array_5c52993fba559c7b(__context__,das_arg<TArray<int32_t>>::pass((*__b_rename_at_155_74)),__i_rename_at_150_72++);
+        }
+        __b_iterator.close(__context__,(__b_rename_at_155_74));
+    };
+    testIntArray_8519de60b6cd03f5(__context__);
+    testConstInArray_d92ad5cc074c0732(__context__);
+    testInterop_7303003f020545d0(__context__);
+    testMultiPush_ea9b9ea0ea1985dd(__context__);
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline bool testAccept_770f2bf690ce3aaf ( Context * __context__, TArray<Foo const > const  &  __t_rename_at_173_75, TDim<Foo,10> const  &  __e_rename_at_173_76 )
+{
+    {
+        bool __need_loop_174 = true;
+        // i: Foo const&
+        das_iterator<TArray<Foo const > const > __i_iterator(__t_rename_at_173_75);
+        Foo const  * __i_rename_at_174_77;
+        __need_loop_174 = __i_iterator.first(__context__,(__i_rename_at_174_77)) && __need_loop_174;
+        for ( ; __need_loop_174 ; __need_loop_174 = __i_iterator.next(__context__,(__i_rename_at_174_77)) )
+        {
+            if ( (*__i_rename_at_174_77).bar == 13 )
+            {
+                return das_auto_cast<bool>::cast(true);
+            };
+        }
+        __i_iterator.close(__context__,(__i_rename_at_174_77));
+    };
+    {
+        bool __need_loop_179 = true;
+        // j: Foo const&
+        das_iterator<TDim<Foo,10> const > __j_iterator(__e_rename_at_173_76);
+        Foo const  * __j_rename_at_179_78;
+        __need_loop_179 = __j_iterator.first(__context__,(__j_rename_at_179_78)) && __need_loop_179;
+        for ( ; __need_loop_179 ; __need_loop_179 = __j_iterator.next(__context__,(__j_rename_at_179_78)) )
+        {
+            if ( (*__j_rename_at_179_78).bar == 13 )
+            {
+                return das_auto_cast<bool>::cast(false);
+            };
+        }
+        __j_iterator.close(__context__,(__j_rename_at_179_78));
+    };
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void testConstInArray_d92ad5cc074c0732 ( Context * __context__ )
+{
+    TArray<Foo const > __a_rename_at_189_79;das_zero(__a_rename_at_189_79);
+    _FuncbuiltinTickresizeTick4811697762258667383_28d604f96e80b263(__context__,das_arg<TArray<Foo const >>::pass(__a_rename_at_189_79),20);
+    TDim<Foo,10> __b_rename_at_191_80_ConstRef;das_zero(__b_rename_at_191_80_ConstRef);
+    TDim<Foo,10> const  & __b_rename_at_191_80 = __b_rename_at_191_80_ConstRef;
+;
+    testAccept_770f2bf690ce3aaf(__context__,das_arg<TArray<Foo const >>::pass(__a_rename_at_189_79),__b_rename_at_191_80);
+}
+
+inline void testMultiPush_ea9b9ea0ea1985dd ( Context * __context__ )
+{
+    TArray<Foo> _temp_make_local_203_9_2; _temp_make_local_203_9_2;
+    TDim<Foo,2> _temp_make_local_203_9_3; _temp_make_local_203_9_3;
+    TArray<Foo> __a_rename_at_197_81;das_zero(__a_rename_at_197_81);
+    TArray<Foo> __b_rename_at_198_82;das_zero(__b_rename_at_198_82);
+    _FuncbuiltinTickpushTick16590575971159035031_fb91b0d640782be8(__context__,das_arg<TArray<Foo>>::pass(__b_rename_at_198_82),das_arg<TArray<Foo>>::pass(__a_rename_at_197_81));
+    DAS_VERIFY((builtin_array_size(das_arg<TArray<Foo>>::pass(__a_rename_at_197_81)) == 0));
+    DAS_VERIFY((builtin_array_size(das_arg<TArray<Foo>>::pass(__b_rename_at_198_82)) == 0));
+    _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_17958f88da70242d(__context__,das_arg<TArray<Foo>>::pass(__a_rename_at_197_81),das_arg<TArray<Foo>>::pass((_temp_make_local_203_9_2 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_71dc3bb75ba701a3(__context__,das_arg<TDim<Foo,2>>::pass((([&]() -> TDim<Foo,2>& {
+        _temp_make_local_203_9_3(0,__context__) = (([&]() -> Foo {
+            Foo __mks_203;
+            das_copy((__mks_203.bar),(1));
+            return __mks_203;
+        })());
+        _temp_make_local_203_9_3(1,__context__) = (([&]() -> Foo {
+            Foo __mks_203;
+            das_copy((__mks_203.bar),(2));
+            return __mks_203;
+        })());
+        return _temp_make_local_203_9_3;
+    })())))))));
+    _FuncbuiltinTickpushTick16590575971159035031_fb91b0d640782be8(__context__,das_arg<TArray<Foo>>::pass(__b_rename_at_198_82),das_arg<TArray<Foo>>::pass(__a_rename_at_197_81));
+    DAS_VERIFY((builtin_array_size(das_arg<TArray<Foo>>::pass(__a_rename_at_197_81)) == 2));
+    DAS_VERIFY((builtin_array_size(das_arg<TArray<Foo>>::pass(__b_rename_at_198_82)) == 2));
+    DAS_VERIFY((__a_rename_at_197_81(0,__context__).bar == 1));
+    DAS_VERIFY((__a_rename_at_197_81(1,__context__).bar == 2));
+    DAS_VERIFY((__b_rename_at_198_82(0,__context__).bar == 1));
+    DAS_VERIFY((__b_rename_at_198_82(1,__context__).bar == 2));
+    TDim<Foo,1> __c_rename_at_212_83 = (([&]() -> TDim<Foo,1> {
+        TDim<Foo,1> __mka_212;
+        __mka_212(0,__context__) = (([&]() -> Foo {
+            Foo __mks_212;
+            das_copy((__mks_212.bar),(3));
+            return __mks_212;
+        })());
+        return __mka_212;
+    })());
+    _FuncbuiltinTickpushTick14948358808039962334_d37151c73c14e736(__context__,das_arg<TArray<Foo>>::pass(__b_rename_at_198_82),das_arg<TDim<Foo,1>>::pass(__c_rename_at_212_83));
+    DAS_VERIFY((builtin_array_size(das_arg<TArray<Foo>>::pass(__b_rename_at_198_82)) == 3));
+    DAS_VERIFY((__b_rename_at_198_82(2,__context__).bar == 3));
+    DAS_VERIFY((__c_rename_at_212_83(0,__context__).bar == 3));
+    _FuncbuiltinTickpush_cloneTick14318757644960593747_4e2307346f07cfa7(__context__,das_arg<TArray<Foo>>::pass(__b_rename_at_198_82),das_arg<TDim<Foo,1>>::pass(__c_rename_at_212_83));
+    DAS_VERIFY((builtin_array_size(das_arg<TArray<Foo>>::pass(__b_rename_at_198_82)) == 4));
+    DAS_VERIFY((__b_rename_at_198_82(3,__context__).bar == 3));
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009 ( Context * __context__ ) {
+    TArray<char *> &  arg_Arr = cast_aot_arg<TArray<char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_564a581d393af548 ( Context * __context__ ) {
+    TArray<Foo> &  arg_Arr = cast_aot_arg<TArray<Foo> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_564a581d393af548(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_17958f88da70242d ( Context * __context__ ) {
+    TArray<Foo> &  arg_a = cast_aot_arg<TArray<Foo> & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<Foo> &  arg_b = cast_aot_arg<TArray<Foo> & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_17958f88da70242d(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> &  arg_b = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_7bcf9746c1f1b7c6 ( Context * __context__ ) {
+    TDim<char *,1> &  arg_a = cast_aot_arg<TDim<char *,1> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<char *> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_7bcf9746c1f1b7c6(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_71dc3bb75ba701a3 ( Context * __context__ ) {
+    TDim<Foo,2> &  arg_a = cast_aot_arg<TDim<Foo,2> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<Foo> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_71dc3bb75ba701a3(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpushTick14948358808039962334_d37151c73c14e736 ( Context * __context__ ) {
+    TArray<Foo> &  arg_Arr = cast_aot_arg<TArray<Foo> & >::to(*__context__,__context__->abiArguments()[0]);
+    TDim<Foo,1> const  &  arg_varr = cast_aot_arg<TDim<Foo,1> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick14948358808039962334_d37151c73c14e736(__context__, arg_Arr, arg_varr);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpush_cloneTick14318757644960593747_4e2307346f07cfa7 ( Context * __context__ ) {
+    TArray<Foo> &  arg_Arr = cast_aot_arg<TArray<Foo> & >::to(*__context__,__context__->abiArguments()[0]);
+    TDim<Foo,1> &  arg_varr = cast_aot_arg<TDim<Foo,1> & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpush_cloneTick14318757644960593747_4e2307346f07cfa7(__context__, arg_Arr, arg_varr);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_value = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpushTick14934788096129379580_9c3c2abdcd3c6241 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_value = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_at = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    _FuncbuiltinTickpushTick14934788096129379580_9c3c2abdcd3c6241(__context__, arg_Arr, arg_value, arg_at);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeraseTick16646986352019611268_7aa29df899f2f2e8 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_at = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickeraseTick16646986352019611268_7aa29df899f2f2e8(__context__, arg_Arr, arg_at);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_28d604f96e80b263 ( Context * __context__ ) {
+    TArray<Foo const > &  arg_Arr = cast_aot_arg<TArray<Foo const > & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_28d604f96e80b263(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpushTick16590575971159035031_fb91b0d640782be8 ( Context * __context__ ) {
+    TArray<Foo> &  arg_Arr = cast_aot_arg<TArray<Foo> & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<Foo> &  arg_varr = cast_aot_arg<TArray<Foo> & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick16590575971159035031_fb91b0d640782be8(__context__, arg_Arr, arg_varr);
+    return v_zero();
+}
+static vec4f __wrap_make_test_array_941ac340def55f59 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_extra = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    make_test_array_941ac340def55f59(__context__, arg_a, arg_extra);
+    return v_zero();
+}
+static vec4f __wrap_verify_test_array_5c52993fba559c7b ( Context * __context__ ) {
+    TArray<int32_t> const  &  arg_a = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_extra = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    verify_test_array_5c52993fba559c7b(__context__, arg_a, arg_extra);
+    return v_zero();
+}
+static vec4f __wrap_pass_array_ff501e424c345c ( Context * __context__ ) {
+    TArray<int32_t> &  arg_arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    pass_array_ff501e424c345c(__context__, arg_arr);
+    return v_zero();
+}
+static vec4f __wrap_verifyIntArray_128242fb5aca6a29 ( Context * __context__ ) {
+    TArray<int32_t> const  &  arg_a = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_s = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_c = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    int32_t arg_tail = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[3]);
+    verifyIntArray_128242fb5aca6a29(__context__, arg_a, arg_s, arg_c, arg_tail);
+    return v_zero();
+}
+static vec4f __wrap_testIntArray_8519de60b6cd03f5 ( Context * __context__ ) {
+    testIntArray_8519de60b6cd03f5(__context__);
+    return v_zero();
+}
+static vec4f __wrap_testInterop_7303003f020545d0 ( Context * __context__ ) {
+    testInterop_7303003f020545d0(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_19e35adf0fcaf31 ( Context * __context__ ) {
+    return cast<bool>::from(test_19e35adf0fcaf31(__context__));
+}
+static vec4f __wrap_testAccept_770f2bf690ce3aaf ( Context * __context__ ) {
+    TArray<Foo const > const  &  arg_t = cast_aot_arg<TArray<Foo const > const  & >::to(*__context__,__context__->abiArguments()[0]);
+    TDim<Foo,10> const  &  arg_e = cast_aot_arg<TDim<Foo,10> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(testAccept_770f2bf690ce3aaf(__context__, arg_t, arg_e));
+}
+static vec4f __wrap_testConstInArray_d92ad5cc074c0732 ( Context * __context__ ) {
+    testConstInArray_d92ad5cc074c0732(__context__);
+    return v_zero();
+}
+static vec4f __wrap_testMultiPush_ea9b9ea0ea1985dd ( Context * __context__ ) {
+    testMultiPush_ea9b9ea0ea1985dd(__context__);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xedd3c4f89cba620e, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009 },
+    { 0x926f97e931f18475, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_564a581d393af548, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_564a581d393af548 },
+    { 0x195d268ed0b90179, false, (void*)&_FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_17958f88da70242d, &__wrap__FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_17958f88da70242d },
+    { 0x5e8700914eff1e69, false, (void*)&_FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5, &__wrap__FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5 },
+    { 0x28015747a7cfc085, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_7bcf9746c1f1b7c6, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_7bcf9746c1f1b7c6 },
+    { 0x7b488c068536dd0a, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_71dc3bb75ba701a3, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_71dc3bb75ba701a3 },
+    { 0x6431e3f31de91dfa, false, (void*)&_FuncbuiltinTickpushTick14948358808039962334_d37151c73c14e736, &__wrap__FuncbuiltinTickpushTick14948358808039962334_d37151c73c14e736 },
+    { 0x6737abb0a539f341, false, (void*)&_FuncbuiltinTickpush_cloneTick14318757644960593747_4e2307346f07cfa7, &__wrap__FuncbuiltinTickpush_cloneTick14318757644960593747_4e2307346f07cfa7 },
+    { 0xa51a880d594e91fd, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c },
+    { 0xbf77bb210b0552bc, false, (void*)&_FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39, &__wrap__FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 },
+    { 0x78ccaa663d73fb1b, false, (void*)&_FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76, &__wrap__FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76 },
+    { 0xdd16a56ebb633df, false, (void*)&_FuncbuiltinTickpushTick14934788096129379580_9c3c2abdcd3c6241, &__wrap__FuncbuiltinTickpushTick14934788096129379580_9c3c2abdcd3c6241 },
+    { 0x1d0e1084132403d5, false, (void*)&_FuncbuiltinTickeraseTick16646986352019611268_7aa29df899f2f2e8, &__wrap__FuncbuiltinTickeraseTick16646986352019611268_7aa29df899f2f2e8 },
+    { 0x37e75b09adb2ee8c, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_28d604f96e80b263, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_28d604f96e80b263 },
+    { 0x739ebe4bd7969ebe, false, (void*)&_FuncbuiltinTickpushTick16590575971159035031_fb91b0d640782be8, &__wrap__FuncbuiltinTickpushTick16590575971159035031_fb91b0d640782be8 },
+    { 0x58a0e35feea7cd0a, false, (void*)&make_test_array_941ac340def55f59, &__wrap_make_test_array_941ac340def55f59 },
+    { 0xce27b558c80d3d53, false, (void*)&verify_test_array_5c52993fba559c7b, &__wrap_verify_test_array_5c52993fba559c7b },
+    { 0x520b5fbc9df9ce76, false, (void*)&pass_array_ff501e424c345c, &__wrap_pass_array_ff501e424c345c },
+    { 0x353772b557da9780, false, (void*)&verifyIntArray_128242fb5aca6a29, &__wrap_verifyIntArray_128242fb5aca6a29 },
+    { 0x5af9cccde431bbb6, false, (void*)&testIntArray_8519de60b6cd03f5, &__wrap_testIntArray_8519de60b6cd03f5 },
+    { 0x7de885e4bb881308, false, (void*)&testInterop_7303003f020545d0, &__wrap_testInterop_7303003f020545d0 },
+    { 0x1145fa5e85baba79, false, (void*)&test_19e35adf0fcaf31, &__wrap_test_19e35adf0fcaf31 },
+    { 0x1f352fd7364bfffc, false, (void*)&testAccept_770f2bf690ce3aaf, &__wrap_testAccept_770f2bf690ce3aaf },
+    { 0x52dac823e311d920, false, (void*)&testConstInArray_d92ad5cc074c0732, &__wrap_testConstInArray_d92ad5cc074c0732 },
+    { 0x9074abbefc2bb982, false, (void*)&testMultiPush_ea9b9ea0ea1985dd, &__wrap_testMultiPush_ea9b9ea0ea1985dd },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_14940951252859693979
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
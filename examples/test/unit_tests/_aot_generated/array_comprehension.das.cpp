@@ -0,0 +1,190 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_9158367562503809997 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_177_0, int32_t __value_rename_at_177_1 );
+inline bool test_ee83862efc4fa4e3 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_177_0, int32_t __value_rename_at_177_1 )
+{
+    das_copy(__Arr_rename_at_177_0(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_177_0),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_177_1);
+}
+
+inline bool test_ee83862efc4fa4e3 ( Context * __context__ )
+{
+    TArray<int32_t> __q_rename_at_4_2_ConstRef; das_zero(__q_rename_at_4_2_ConstRef); das_move(__q_rename_at_4_2_ConstRef, ((TArray<int32_t>)das_invoke<TArray<int32_t>>::invoke_cmres(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> TArray<int32_t>{
+        TArray<int32_t> ____acomp_4_15_rename_at_4_3;das_zero(____acomp_4_15_rename_at_4_3);
+        builtin_set_verify_array_locks(das_arg<TArray<int32_t>>::pass(____acomp_4_15_rename_at_4_3),false);
+        {
+            bool __need_loop_4 = true;
+            // x: int const
+            das_iterator<range> __x_iterator(range(0,10));
+            int32_t __x_rename_at_4_4;
+            __need_loop_4 = __x_iterator.first(__context__,(__x_rename_at_4_4)) && __need_loop_4;
+            for ( ; __need_loop_4 ; __need_loop_4 = __x_iterator.next(__context__,(__x_rename_at_4_4)) )
+            {
+                _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(____acomp_4_15_rename_at_4_3),__x_rename_at_4_4 * __x_rename_at_4_4);
+            }
+            __x_iterator.close(__context__,(__x_rename_at_4_4));
+        };
+        builtin_set_verify_array_locks(das_arg<TArray<int32_t>>::pass(____acomp_4_15_rename_at_4_3),true);
+        return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(____acomp_4_15_rename_at_4_3);
+    })));
+    TArray<int32_t> const  & __q_rename_at_4_2 = __q_rename_at_4_2_ConstRef;
+;
+    {
+        bool __need_loop_5 = true;
+        // y: int const
+        das_iterator<range> __y_iterator(range(0,10));
+        int32_t __y_rename_at_5_7;
+        __need_loop_5 = __y_iterator.first(__context__,(__y_rename_at_5_7)) && __need_loop_5;
+        // qV: int const&
+        das_iterator<TArray<int32_t> const > __qV_iterator(__q_rename_at_4_2);
+        int32_t const  * __qV_rename_at_5_8;
+        __need_loop_5 = __qV_iterator.first(__context__,(__qV_rename_at_5_8)) && __need_loop_5;
+        for ( ; __need_loop_5 ; __need_loop_5 = __y_iterator.next(__context__,(__y_rename_at_5_7)) && __qV_iterator.next(__context__,(__qV_rename_at_5_8)) )
+        {
+            DAS_VERIFY(((__y_rename_at_5_7 * __y_rename_at_5_7) == (*__qV_rename_at_5_8)));
+        }
+        __qV_iterator.close(__context__,(__qV_rename_at_5_8));
+        __y_iterator.close(__context__,(__y_rename_at_5_7));
+    };
+    TArray<int32_t> __t_rename_at_8_9_ConstRef; das_zero(__t_rename_at_8_9_ConstRef); das_move(__t_rename_at_8_9_ConstRef, ((TArray<int32_t>)das_invoke<TArray<int32_t>>::invoke_cmres(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> TArray<int32_t>{
+        TArray<int32_t> ____acomp_8_15_rename_at_8_10;das_zero(____acomp_8_15_rename_at_8_10);
+        builtin_set_verify_array_locks(das_arg<TArray<int32_t>>::pass(____acomp_8_15_rename_at_8_10),false);
+        {
+            bool __need_loop_8 = true;
+            // x: int const
+            das_iterator<range> __x_iterator(range(0,10));
+            int32_t __x_rename_at_8_11;
+            __need_loop_8 = __x_iterator.first(__context__,(__x_rename_at_8_11)) && __need_loop_8;
+            for ( ; __need_loop_8 ; __need_loop_8 = __x_iterator.next(__context__,(__x_rename_at_8_11)) )
+            {
+                if ( (__x_rename_at_8_11 & 1) == 0 )
+                {
+                    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(____acomp_8_15_rename_at_8_10),__x_rename_at_8_11 * __x_rename_at_8_11);
+                };
+            }
+            __x_iterator.close(__context__,(__x_rename_at_8_11));
+        };
+        builtin_set_verify_array_locks(das_arg<TArray<int32_t>>::pass(____acomp_8_15_rename_at_8_10),true);
+        return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(____acomp_8_15_rename_at_8_10);
+    })));
+    TArray<int32_t> const  & __t_rename_at_8_9 = __t_rename_at_8_9_ConstRef;
+;
+    int32_t __count_rename_at_9_12 = 0;
+    {
+        bool __need_loop_10 = true;
+        // z: int const
+        das_iterator<range> __z_iterator(range(0,10));
+        int32_t __z_rename_at_10_13;
+        __need_loop_10 = __z_iterator.first(__context__,(__z_rename_at_10_13)) && __need_loop_10;
+        for ( ; __need_loop_10 ; __need_loop_10 = __z_iterator.next(__context__,(__z_rename_at_10_13)) )
+        {
+            if ( (__z_rename_at_10_13 & 1) == 0 )
+            {
+                DAS_VERIFY((__t_rename_at_8_9(__count_rename_at_9_12++,__context__) == (__z_rename_at_10_13 * __z_rename_at_10_13)));
+            };
+        }
+        __z_iterator.close(__context__,(__z_rename_at_10_13));
+    };
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_value = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap_test_ee83862efc4fa4e3 ( Context * __context__ ) {
+    return cast<bool>::from(test_ee83862efc4fa4e3(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xbf77bb210b0552bc, false, (void*)&_FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39, &__wrap__FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 },
+    { 0x79a9da13df1c38b4, false, (void*)&test_ee83862efc4fa4e3, &__wrap_test_ee83862efc4fa4e3 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_9158367562503809997
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
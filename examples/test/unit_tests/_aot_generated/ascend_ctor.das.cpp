@@ -0,0 +1,202 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_5348552109295623402 {
+
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+    void * __rtti;
+    Func DAS_COMMENT((void,Foo)) __finalize;
+    int32_t a;
+    int32_t b;
+};
+static_assert(sizeof(Foo)==24,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,a)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==20,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__411ed0e77075265a;
+extern TypeInfo __type_info__bc69a005531fe739;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __struct_info__411ed0e77075265a_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x65bf5856bcd0f340), "__rtti", 0, 4 };
+TypeInfo * __type_info__55b35704030b0750_arg_types_var_4692417554209384026[1] = { &__type_info__bc69a005531fe739 };
+const char * __type_info__55b35704030b0750_arg_names_var_4692417554209384026[1] = { "self" };
+VarInfo __struct_info__411ed0e77075265a_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__55b35704030b0750_arg_types_var_4692417554209384026, __type_info__55b35704030b0750_arg_names_var_4692417554209384026, 1, 0, nullptr, 12, 8, UINT64_C(0x55b35704030b0750), "__finalize", 8, 0 };
+VarInfo __struct_info__411ed0e77075265a_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xbcd691bb60c7d14c), "a", 16, 0 };
+VarInfo __struct_info__411ed0e77075265a_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xbcd694bb60c7d665), "b", 20, 0 };
+VarInfo * __struct_info__411ed0e77075265a_fields[4] =  { &__struct_info__411ed0e77075265a_field_0, &__struct_info__411ed0e77075265a_field_1, &__struct_info__411ed0e77075265a_field_2, &__struct_info__411ed0e77075265a_field_3 };
+StructInfo __struct_info__411ed0e77075265a = {"Foo", "", 13, __struct_info__411ed0e77075265a_fields, 4, 24, UINT64_C(0x945b59082c003622), nullptr, UINT64_C(0x411ed0e77075265a), 0 };
+TypeInfo __type_info__bc69a005531fe739 = { Type::tStructure, &__struct_info__411ed0e77075265a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 24, UINT64_C(0xbc69a005531fe739) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void finalize_67199ad633b64e0a ( Context * __context__, Foo & ____this_rename_at_2_0 );
+inline Foo Foo_8372e4fd6c14b4ca ( Context * __context__ );
+inline void _FuncFooTickFoo_cb26b9e932af300b ( Context * __context__, Foo & __self_rename_at_5_2 );
+inline void _FuncFoo_0x27___finalize_90998c11fe5d1c7b ( Context * __context__, Foo & __self_rename_at_2_3 );
+inline void test_ascend_ctor_22d4fa3d6927a439 ( Context * __context__ );
+inline bool test_f708158c2991a82b ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void finalize_67199ad633b64e0a ( Context * __context__, Foo &  ____this_rename_at_2_0 )
+{
+    memset((void*)&(____this_rename_at_2_0), 0, 24);
+}
+
+inline Foo Foo_8372e4fd6c14b4ca ( Context * __context__ )
+{
+    Foo __self_rename_at_5_1; das_zero(__self_rename_at_5_1); das_move(__self_rename_at_5_1, (([&]() -> Foo {
+        Foo __mks_5;
+        das_zero(__mks_5);
+        das_copy((__mks_5.__rtti),(((void *)(&__type_info__bc69a005531fe739))));
+        das_copy((__mks_5.__finalize),(Func(__context__->fnByMangledName(/*Foo'__finalize S<Foo>*/ 0xa576fb7af95b22e8))));
+        return __mks_5;
+    })()));
+    _FuncFooTickFoo_cb26b9e932af300b(__context__,das_arg<Foo>::pass(__self_rename_at_5_1));
+    return /* <- */ das_auto_cast_move<Foo>::cast(__self_rename_at_5_1);
+}
+
+inline void _FuncFooTickFoo_cb26b9e932af300b ( Context * __context__, Foo &  __self_rename_at_5_2 )
+{
+    das_copy(__self_rename_at_5_2.a,13);
+}
+
+inline void _FuncFoo_0x27___finalize_90998c11fe5d1c7b ( Context * __context__, Foo &  __self_rename_at_2_3 )
+{
+    finalize_67199ad633b64e0a(__context__,das_arg<Foo>::pass(__self_rename_at_2_3));
+}
+
+inline void test_ascend_ctor_22d4fa3d6927a439 ( Context * __context__ )
+{
+    Foo * __foo_rename_at_12_4 = das_ascend<Foo,Foo>::make(__context__,nullptr,(([&]() -> Foo {
+        Foo __mks_12 = Foo_8372e4fd6c14b4ca(__context__);
+        das_copy((__mks_12.b),(42));
+        return __mks_12;
+    })()));
+    DAS_ASSERT((__foo_rename_at_12_4->a == 13));
+    DAS_ASSERT((__foo_rename_at_12_4->b == 42));
+}
+
+inline bool test_f708158c2991a82b ( Context * __context__ )
+{
+    test_ascend_ctor_22d4fa3d6927a439(__context__);
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_finalize_67199ad633b64e0a ( Context * __context__ ) {
+    Foo &  arg___this = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_67199ad633b64e0a(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_Foo_8372e4fd6c14b4ca ( Context * __context__ ) {
+    *((Foo *) __context__->abiCMRES) = Foo_8372e4fd6c14b4ca(__context__);
+    return v_zero();
+}
+static vec4f __wrap__FuncFooTickFoo_cb26b9e932af300b ( Context * __context__ ) {
+    Foo &  arg_self = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncFooTickFoo_cb26b9e932af300b(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap__FuncFoo_0x27___finalize_90998c11fe5d1c7b ( Context * __context__ ) {
+    Foo &  arg_self = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncFoo_0x27___finalize_90998c11fe5d1c7b(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap_test_ascend_ctor_22d4fa3d6927a439 ( Context * __context__ ) {
+    test_ascend_ctor_22d4fa3d6927a439(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_f708158c2991a82b ( Context * __context__ ) {
+    return cast<bool>::from(test_f708158c2991a82b(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x8244ee639611b179, false, (void*)&finalize_67199ad633b64e0a, &__wrap_finalize_67199ad633b64e0a },
+    { 0xbcf967ec1cbb82d1, true, (void*)&Foo_8372e4fd6c14b4ca, &__wrap_Foo_8372e4fd6c14b4ca },
+    { 0x581a6aec621e1ff3, false, (void*)&_FuncFooTickFoo_cb26b9e932af300b, &__wrap__FuncFooTickFoo_cb26b9e932af300b },
+    { 0x34688893f84fd15d, false, (void*)&_FuncFoo_0x27___finalize_90998c11fe5d1c7b, &__wrap__FuncFoo_0x27___finalize_90998c11fe5d1c7b },
+    { 0x807baad5f6bef9a7, false, (void*)&test_ascend_ctor_22d4fa3d6927a439, &__wrap_test_ascend_ctor_22d4fa3d6927a439 },
+    { 0x8bda6bb1d3eff325, false, (void*)&test_f708158c2991a82b, &__wrap_test_f708158c2991a82b },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_5348552109295623402
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
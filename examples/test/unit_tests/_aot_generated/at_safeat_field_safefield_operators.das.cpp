@@ -0,0 +1,183 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14919346897557646927 {
+
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+    char * a;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+}
+extern TypeInfo __type_info__af90fe4c864e9d52;
+
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[3] = { &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52 };
+
+inline char * _FuncSqblSqbr_5ca13abc87799f7f ( Context * __context__, Foo const  & __t_rename_at_6_0, char * const  __cmp_rename_at_6_1 );
+inline char * const  * _FuncQmarkSqblSqbr_9f06e68c45c02f79 ( Context * __context__, Foo const  & __t_rename_at_10_2, char * const  __cmp_rename_at_10_3 );
+inline Foo _FuncDot_13d4c100f2d796c4 ( Context * __context__, Foo const  & __t_rename_at_22_4, char * const  __name_rename_at_22_5 );
+inline char * const  * _FuncQmarkDot_9acd20ef04b3ee3e ( Context * __context__, Foo const  & __t_rename_at_26_6, char * const  __name_rename_at_26_7 );
+inline bool test_354fb50429e72417 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline char * _FuncSqblSqbr_5ca13abc87799f7f ( Context * __context__, Foo const  &  __t_rename_at_6_0, char * const  __cmp_rename_at_6_1 )
+{
+    return das_auto_cast<char *>::cast(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_0, cast<char * const >::from(__t_rename_at_6_0.a), cast<char * const >::from(((char *) "-")), cast<char * const >::from(__cmp_rename_at_6_1))));
+}
+
+inline char * const  * _FuncQmarkSqblSqbr_9f06e68c45c02f79 ( Context * __context__, Foo const  &  __t_rename_at_10_2, char * const  __cmp_rename_at_10_3 )
+{
+    return das_auto_cast<char * const  *>::cast((SimPolicy<char *>::Equ(cast<char *>::from(__cmp_rename_at_10_3),cast<char *>::from(__t_rename_at_10_2.a),*__context__,nullptr)) ? das_auto_cast<char * const  *>::cast(das_cast<char * const  *>::cast(das_ref(__context__,__t_rename_at_10_2.a))) : das_auto_cast<char * const  *>::cast(das_cast<char * const  *>::cast(nullptr)));
+}
+
+inline Foo _FuncDot_13d4c100f2d796c4 ( Context * __context__, Foo const  &  __t_rename_at_22_4, char * const  __name_rename_at_22_5 )
+{
+    return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+        Foo __mks_23;
+        das_copy((__mks_23.a),(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_0, cast<char * const >::from(__t_rename_at_22_4.a), cast<char * const >::from(((char *) ".")), cast<char * const >::from(__name_rename_at_22_5)))));
+        return __mks_23;
+    })()));
+}
+
+inline char * const  * _FuncQmarkDot_9acd20ef04b3ee3e ( Context * __context__, Foo const  &  __t_rename_at_26_6, char * const  __name_rename_at_26_7 )
+{
+    return das_auto_cast<char * const  *>::cast((SimPolicy<char *>::Equ(cast<char *>::from(__name_rename_at_26_7),cast<char *>::from(((char *) "yes")),*__context__,nullptr)) ? das_auto_cast<char * const  *>::cast(das_cast<char * const  *>::cast(das_ref(__context__,__t_rename_at_26_6.a))) : das_auto_cast<char * const  *>::cast(das_cast<char * const  *>::cast(nullptr)));
+}
+
+inline bool test_354fb50429e72417 ( Context * __context__ )
+{
+    Foo __t_rename_at_39_8 = (([&]() -> Foo {
+        Foo __mks_39;
+        das_copy((__mks_39.a),(((char *) "hello")));
+        return __mks_39;
+    })());
+    char * __z_rename_at_40_9 = (char *)(_FuncSqblSqbr_5ca13abc87799f7f(__context__,das_arg<Foo>::pass(__t_rename_at_39_8),((char *) "blah")));
+    char * __w_rename_at_41_10 = (char *)(das_null_coalescing<char * const >::get(_FuncQmarkSqblSqbr_9f06e68c45c02f79(__context__,das_arg<Foo>::pass(__t_rename_at_39_8),((char *) "blah")),((char *) "not_blah")));
+    char * __W_rename_at_42_11 = (char *)(das_null_coalescing<char * const >::get(_FuncQmarkSqblSqbr_9f06e68c45c02f79(__context__,das_arg<Foo>::pass(__t_rename_at_39_8),((char *) "hello")),((char *) "this???")));
+    Foo __EZ_rename_at_43_12 = _FuncDot_13d4c100f2d796c4(__context__,das_arg<Foo>::pass(__t_rename_at_39_8),((char *) "fooBar"));
+    char * __HARD_YES_rename_at_44_13 = (char *)(das_null_coalescing<char * const >::get(_FuncQmarkDot_9acd20ef04b3ee3e(__context__,das_arg<Foo>::pass(__t_rename_at_39_8),((char *) "yes")),((char *) "how??")));
+    char * __HARD_NO_rename_at_45_14 = (char *)(das_null_coalescing<char * const >::get(_FuncQmarkDot_9acd20ef04b3ee3e(__context__,das_arg<Foo>::pass(__t_rename_at_39_8),((char *) "no")),((char *) "hard no")));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__z_rename_at_40_9),cast<char *>::from(((char *) "hello-blah")),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__w_rename_at_41_10),cast<char *>::from(((char *) "not_blah")),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__W_rename_at_42_11),cast<char *>::from(((char *) "hello")),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__EZ_rename_at_43_12.a),cast<char *>::from(((char *) "hello.fooBar")),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__HARD_YES_rename_at_44_13),cast<char *>::from(((char *) "hello")),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__HARD_NO_rename_at_45_14),cast<char *>::from(((char *) "hard no")),*__context__,nullptr)));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncSqblSqbr_5ca13abc87799f7f ( Context * __context__ ) {
+    Foo const  &  arg_t = cast_aot_arg<Foo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_cmp = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<char *>::from(_FuncSqblSqbr_5ca13abc87799f7f(__context__, arg_t, arg_cmp));
+}
+static vec4f __wrap__FuncQmarkSqblSqbr_9f06e68c45c02f79 ( Context * __context__ ) {
+    Foo const  &  arg_t = cast_aot_arg<Foo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_cmp = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<char * const  *>::from(_FuncQmarkSqblSqbr_9f06e68c45c02f79(__context__, arg_t, arg_cmp));
+}
+static vec4f __wrap__FuncDot_13d4c100f2d796c4 ( Context * __context__ ) {
+    Foo const  &  arg_t = cast_aot_arg<Foo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_name = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    *((Foo *) __context__->abiCMRES) = _FuncDot_13d4c100f2d796c4(__context__, arg_t, arg_name);
+    return v_zero();
+}
+static vec4f __wrap__FuncQmarkDot_9acd20ef04b3ee3e ( Context * __context__ ) {
+    Foo const  &  arg_t = cast_aot_arg<Foo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_name = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<char * const  *>::from(_FuncQmarkDot_9acd20ef04b3ee3e(__context__, arg_t, arg_name));
+}
+static vec4f __wrap_test_354fb50429e72417 ( Context * __context__ ) {
+    return cast<bool>::from(test_354fb50429e72417(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x60c5057f7f633a9a, false, (void*)&_FuncSqblSqbr_5ca13abc87799f7f, &__wrap__FuncSqblSqbr_5ca13abc87799f7f },
+    { 0xe462f661c092ee58, false, (void*)&_FuncQmarkSqblSqbr_9f06e68c45c02f79, &__wrap__FuncQmarkSqblSqbr_9f06e68c45c02f79 },
+    { 0x278bd6a926018697, true, (void*)&_FuncDot_13d4c100f2d796c4, &__wrap__FuncDot_13d4c100f2d796c4 },
+    { 0xf13f6ebcf74e823b, false, (void*)&_FuncQmarkDot_9acd20ef04b3ee3e, &__wrap__FuncQmarkDot_9acd20ef04b3ee3e },
+    { 0x89e73aa85d29d3b4, false, (void*)&test_354fb50429e72417, &__wrap_test_354fb50429e72417 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_14919346897557646927
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
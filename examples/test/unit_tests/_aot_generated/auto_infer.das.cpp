@@ -0,0 +1,269 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_3801503872811643555 {
+
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+    int32_t bar;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,bar)==0,"structure field offset mismatch with DAS");
+}
+extern TypeInfo __type_info__af81fe4c86352052;
+extern TypeInfo __type_info__af8afe4c86446b52;
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__af63e44c8601fa24;
+
+VarInfo __func_info__5bac23ff9f9cbc8c_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x3f50c2c9251648a4), "XX", 0, 0 };
+VarInfo __func_info__5bac23ff9f9cbc8c_field_1 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x46f7bec5af89882e), "YY", 0, 0 };
+VarInfo * __func_info__5bac23ff9f9cbc8c_fields[2] =  { &__func_info__5bac23ff9f9cbc8c_field_0, &__func_info__5bac23ff9f9cbc8c_field_1 };
+FuncInfo __func_info__5bac23ff9f9cbc8c = {"invoke block<(XX:int const;YY:float const):bool const> const", "", __func_info__5bac23ff9f9cbc8c_fields, 2, 32, &__type_info__af81fe4c86352052, nullptr,0,UINT64_C(0x5bac23ff9f9cbc8c), 0x0 };
+VarInfo __func_info__e1f1a3fa23519564_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xc7d692fb11364696), "arg", 0, 0 };
+VarInfo * __func_info__e1f1a3fa23519564_fields[1] =  { &__func_info__e1f1a3fa23519564_field_0 };
+FuncInfo __func_info__e1f1a3fa23519564 = {"invoke block<(arg:int const):int const> const", "", __func_info__e1f1a3fa23519564_fields, 1, 32, &__type_info__af8afe4c86446b52, nullptr,0,UINT64_C(0xe1f1a3fa23519564), 0x0 };
+VarInfo __func_info__d9a0cf308efe874e_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xc7d692fb11364696), "arg", 0, 0 };
+VarInfo * __func_info__d9a0cf308efe874e_fields[1] =  { &__func_info__d9a0cf308efe874e_field_0 };
+FuncInfo __func_info__d9a0cf308efe874e = {"invoke block<(arg:int const):int> const", "", __func_info__d9a0cf308efe874e_fields, 1, 32, &__type_info__af63e44c8601fa24, nullptr,0,UINT64_C(0xd9a0cf308efe874e), 0x0 };
+VarInfo __func_info__cfc6b0e0cd37f1f1_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x7fe4e8b1f301ce5f), "ia", 0, 0 };
+VarInfo __func_info__cfc6b0e0cd37f1f1_field_1 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xeab29eab7f535867), "fb", 0, 0 };
+VarInfo * __func_info__cfc6b0e0cd37f1f1_fields[2] =  { &__func_info__cfc6b0e0cd37f1f1_field_0, &__func_info__cfc6b0e0cd37f1f1_field_1 };
+FuncInfo __func_info__cfc6b0e0cd37f1f1 = {"invoke block<(ia:int const;fb:float const):string const> const", "", __func_info__cfc6b0e0cd37f1f1_fields, 2, 32, &__type_info__af90fe4c864e9d52, nullptr,0,UINT64_C(0xcfc6b0e0cd37f1f1), 0x0 };
+TypeInfo __type_info__af81fe4c86352052 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 1, UINT64_C(0xaf81fe4c86352052) };
+TypeInfo __type_info__af8afe4c86446b52 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf8afe4c86446b52) };
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009 ( Context * __context__, TArray<char *> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline int32_t _FuncTicktake_arrTick10677481571956749722_f70c1526b2f4c4d0 ( Context * __context__, TDim<int32_t,4> const  & __a_rename_at_36_2 );
+inline void _FuncTickqqTick11340475950205270788_408fc159ead67ae4 ( Context * __context__, int32_t __a_rename_at_63_5, Block DAS_COMMENT((bool,int32_t,float)) const  & __b_rename_at_63_6, float __c_rename_at_63_7 );
+inline int32_t foo_1bf66d727db03f03 ( Context * __context__, Block DAS_COMMENT((int32_t,int32_t)) const  & __b_rename_at_24_8 );
+inline char * foobar_5ce97fef3d6c1d46 ( Context * __context__, Block DAS_COMMENT((char *,int32_t,float)) const  & __b_rename_at_28_9 );
+inline bool test_d618f86191fc1555 ( Context * __context__ );
+inline TArray<char *> _FuncbuiltinTickto_array_moveTick3185538323411982277_7bcf9746c1f1b7c6 ( Context * __context__, TDim<char *,1> & __a_rename_at_1502_23 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    TDim<char *,1> _temp_make_local_21_15_0;
+    das_global<TArray<char *>,0x4c1129efed350805>(__context__) = _FuncbuiltinTickto_array_moveTick3185538323411982277_7bcf9746c1f1b7c6(__context__,das_arg<TDim<char *,1>>::pass((([&]() -> TDim<char *,1>& {
+        _temp_make_local_21_15_0(0,__context__) = ((char *) "test");
+        return _temp_make_local_21_15_0;
+    })())));/*some_b*/
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009 ( Context * __context__, TArray<char *> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline int32_t _FuncTicktake_arrTick10677481571956749722_f70c1526b2f4c4d0 ( Context * __context__, TDim<int32_t,4> const  &  __a_rename_at_36_2 )
+{
+    int32_t __summ_rename_at_37_3 = 0;
+    {
+        bool __need_loop_38 = true;
+        // x: int const&
+        das_iterator<TDim<int32_t,4> const > __x_iterator(__a_rename_at_36_2);
+        int32_t const  * __x_rename_at_38_4;
+        __need_loop_38 = __x_iterator.first(__context__,(__x_rename_at_38_4)) && __need_loop_38;
+        for ( ; __need_loop_38 ; __need_loop_38 = __x_iterator.next(__context__,(__x_rename_at_38_4)) )
+        {
+            __summ_rename_at_37_3 += (*__x_rename_at_38_4);
+        }
+        __x_iterator.close(__context__,(__x_rename_at_38_4));
+    };
+    return das_auto_cast<int32_t>::cast(__summ_rename_at_37_3);
+}
+
+inline void _FuncTickqqTick11340475950205270788_408fc159ead67ae4 ( Context * __context__, int32_t __a_rename_at_63_5, Block DAS_COMMENT((bool,int32_t,float)) const  &  __b_rename_at_63_6, float __c_rename_at_63_7 )
+{
+}
+
+inline int32_t foo_1bf66d727db03f03 ( Context * __context__, Block DAS_COMMENT((int32_t,int32_t)) const  &  __b_rename_at_24_8 )
+{
+    return das_auto_cast<int32_t>::cast(das_invoke<int32_t>::invoke<int32_t>(__context__,nullptr,__b_rename_at_24_8,3));
+}
+
+inline char * foobar_5ce97fef3d6c1d46 ( Context * __context__, Block DAS_COMMENT((char *,int32_t,float)) const  &  __b_rename_at_28_9 )
+{
+    return das_auto_cast<char *>::cast(cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(das_invoke<char *>::invoke<int32_t,float>(__context__,nullptr,__b_rename_at_28_9,1,2.000000e+00f)),cast<char *>::from(((char *) "bar")),*__context__,nullptr)));
+}
+
+inline bool test_d618f86191fc1555 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,192,"test " DAS_FILE_LINE);
+{
+    TDim<int32_t,4> _temp_make_local_76_20_1; _temp_make_local_76_20_1;
+    DAS_ASSERT((builtin_array_size(das_global<TArray<char *>,0x4c1129efed350805>(__context__) /*some_b*/) == 1));
+    DAS_VERIFY((_FuncTicktake_arrTick10677481571956749722_f70c1526b2f4c4d0(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+        _temp_make_local_76_20_1(0,__context__) = 1;
+        _temp_make_local_76_20_1(1,__context__) = 2;
+        _temp_make_local_76_20_1(2,__context__) = 3;
+        _temp_make_local_76_20_1(3,__context__) = 4;
+        return _temp_make_local_76_20_1;
+    })()))) == 10));
+    Foo * __pFoo_rename_at_80_10 = das_new<Foo>::make(__context__);
+    Foo * __pFooI_rename_at_81_11 = __pFoo_rename_at_80_10;
+    das_copy(__pFooI_rename_at_81_11->bar,1);
+    das_copy(__pFoo_rename_at_80_10,__pFooI_rename_at_81_11);
+    DAS_ASSERT((__pFoo_rename_at_80_10->bar == 1));
+    int32_t __f1_rename_at_94_12 = ((int32_t)foo_1bf66d727db03f03(__context__,das_make_block<int32_t,int32_t>(__context__,128,0,&__func_info__e1f1a3fa23519564,[&](int32_t const  __arg_rename_at_94_13) -> int32_t{
+        return das_auto_cast<int32_t>::cast(__arg_rename_at_94_13 + 1);
+    })));
+    DAS_ASSERT((__f1_rename_at_94_12 == 4));
+    int32_t __f2_rename_at_99_14 = ((int32_t)foo_1bf66d727db03f03(__context__,das_make_block<int32_t,int32_t>(__context__,144,0,&__func_info__e1f1a3fa23519564,[&](int32_t const  __arg_rename_at_99_15) -> int32_t{
+
+#if 0
+5
+#endif
+        return das_auto_cast<int32_t>::cast(__arg_rename_at_99_15 + 2);
+    })));
+    DAS_ASSERT((__f2_rename_at_99_14 == 5));
+    int32_t __f3_rename_at_104_16 = ((int32_t)foo_1bf66d727db03f03(__context__,das_make_block<int32_t,int32_t>(__context__,160,0,&__func_info__d9a0cf308efe874e,[&](int32_t const  __arg_rename_at_104_17) -> int32_t{
+        return das_auto_cast<int32_t>::cast(__arg_rename_at_104_17 + 3);
+    })));
+    DAS_ASSERT((__f3_rename_at_104_16 == 6));
+    char * __blah_rename_at_109_18 = ((char *)(char *)(foobar_5ce97fef3d6c1d46(__context__,das_make_block<char *,int32_t,float>(__context__,176,0,&__func_info__cfc6b0e0cd37f1f1,[&](int32_t const  __ia_rename_at_109_19, float const  __fb_rename_at_109_20) -> char *{
+        DAS_ASSERT((__ia_rename_at_109_19 == 1));
+        DAS_ASSERT((__fb_rename_at_109_20 == 2.000000e+00f));
+        return das_auto_cast<char *>::cast(((char *) "foo"));
+    }))));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__blah_rename_at_109_18),cast<char *>::from(((char *) "foobar")),*__context__,nullptr)));
+    _FuncTickqqTick11340475950205270788_408fc159ead67ae4(__context__,1,das_make_block<bool,int32_t,float>(__context__,176,0,&__func_info__5bac23ff9f9cbc8c,[&](int32_t const  __XX_rename_at_130_21, float const  __YY_rename_at_130_22) -> bool{
+        return das_auto_cast<bool>::cast(true);
+    }),2.000000e+00f);
+    return das_auto_cast<bool>::cast(true);
+}}
+
+inline TArray<char *> _FuncbuiltinTickto_array_moveTick3185538323411982277_7bcf9746c1f1b7c6 ( Context * __context__, TDim<char *,1> &  __a_rename_at_1502_23 )
+{
+    TArray<char *> __arr_rename_at_1504_24;das_zero(__arr_rename_at_1504_24);
+    _FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_1504_24),1);
+    das_copy(das_cast<TDim<char *,1>>::cast(das_ref(__context__,__arr_rename_at_1504_24(0,__context__))),__a_rename_at_1502_23);
+    return /* <- */ das_auto_cast_move<TArray<char *>>::cast(__arr_rename_at_1504_24);
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009 ( Context * __context__ ) {
+    TArray<char *> &  arg_Arr = cast_aot_arg<TArray<char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktake_arrTick10677481571956749722_f70c1526b2f4c4d0 ( Context * __context__ ) {
+    TDim<int32_t,4> const  &  arg_a = cast_aot_arg<TDim<int32_t,4> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(_FuncTicktake_arrTick10677481571956749722_f70c1526b2f4c4d0(__context__, arg_a));
+}
+static vec4f __wrap__FuncTickqqTick11340475950205270788_408fc159ead67ae4 ( Context * __context__ ) {
+    int32_t arg_a = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((bool,int32_t,float)) const  &  arg_b = cast_aot_arg<Block DAS_COMMENT((bool,int32_t,float)) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    float arg_c = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[2]);
+    _FuncTickqqTick11340475950205270788_408fc159ead67ae4(__context__, arg_a, arg_b, arg_c);
+    return v_zero();
+}
+static vec4f __wrap_foo_1bf66d727db03f03 ( Context * __context__ ) {
+    Block DAS_COMMENT((int32_t,int32_t)) const  &  arg_b = cast_aot_arg<Block DAS_COMMENT((int32_t,int32_t)) const  & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(foo_1bf66d727db03f03(__context__, arg_b));
+}
+static vec4f __wrap_foobar_5ce97fef3d6c1d46 ( Context * __context__ ) {
+    Block DAS_COMMENT((char *,int32_t,float)) const  &  arg_b = cast_aot_arg<Block DAS_COMMENT((char *,int32_t,float)) const  & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<char *>::from(foobar_5ce97fef3d6c1d46(__context__, arg_b));
+}
+static vec4f __wrap_test_d618f86191fc1555 ( Context * __context__ ) {
+    return cast<bool>::from(test_d618f86191fc1555(__context__));
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_7bcf9746c1f1b7c6 ( Context * __context__ ) {
+    TDim<char *,1> &  arg_a = cast_aot_arg<TDim<char *,1> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<char *> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_7bcf9746c1f1b7c6(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xedd3c4f89cba620e, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009 },
+    { 0x449261f880f7f17a, false, (void*)&_FuncTicktake_arrTick10677481571956749722_f70c1526b2f4c4d0, &__wrap__FuncTicktake_arrTick10677481571956749722_f70c1526b2f4c4d0 },
+    { 0x73d6f499b1d9cf87, false, (void*)&_FuncTickqqTick11340475950205270788_408fc159ead67ae4, &__wrap__FuncTickqqTick11340475950205270788_408fc159ead67ae4 },
+    { 0x9a16a3d4f290870d, false, (void*)&foo_1bf66d727db03f03, &__wrap_foo_1bf66d727db03f03 },
+    { 0xf8d5d43eb9f1822d, false, (void*)&foobar_5ce97fef3d6c1d46, &__wrap_foobar_5ce97fef3d6c1d46 },
+    { 0x90eb1bcc04e34f7a, false, (void*)&test_d618f86191fc1555, &__wrap_test_d618f86191fc1555 },
+    { 0x28015747a7cfc085, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_7bcf9746c1f1b7c6, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_7bcf9746c1f1b7c6 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0xca22d6e6181351f8, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_3801503872811643555
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
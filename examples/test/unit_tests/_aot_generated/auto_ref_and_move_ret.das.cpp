@@ -0,0 +1,202 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_6422774311639861804 {
+
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__a3f0477a4765213e;
+extern TypeInfo __type_info__af63e44c8601fa24;
+
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__a3f0477a4765213e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xa3f0477a4765213e) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__a3f0477a4765213e, &__type_info__af90fe4c864e9d52 };
+
+inline TArray<int32_t> & _FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 ( Context * __context__, TArray<int32_t> & __a_rename_at_50_0 );
+inline void _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_177_1, int32_t __value_rename_at_177_2 );
+inline int32_t abs_dbc771232c416b57 ( Context * __context__, int32_t __i_rename_at_2_3 );
+inline TArray<int32_t> foo_3d6a07c0835832bd ( Context * __context__, TArray<int32_t> & __bar_rename_at_6_4 );
+inline bool test_2b20de90ade746ba ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline TArray<int32_t> & _FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 ( Context * __context__, TArray<int32_t> &  __a_rename_at_50_0 )
+{
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<TArray<int32_t> &>::from(__a_rename_at_50_0),cast<char * const >::from(((char *) "object can't be returned because it is locked"))));
+    return das_auto_cast_ref<TArray<int32_t> &>::cast(__a_rename_at_50_0);
+}
+
+inline void _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_177_1, int32_t __value_rename_at_177_2 )
+{
+    das_copy(__Arr_rename_at_177_1(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_177_1),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_177_2);
+}
+
+inline int32_t abs_dbc771232c416b57 ( Context * __context__, int32_t __i_rename_at_2_3 )
+{
+    return das_auto_cast<int32_t>::cast((__i_rename_at_2_3 < 0) ? das_auto_cast<int32_t>::cast(-__i_rename_at_2_3) : das_auto_cast<int32_t>::cast(__i_rename_at_2_3));
+}
+
+inline TArray<int32_t> foo_3d6a07c0835832bd ( Context * __context__, TArray<int32_t> &  __bar_rename_at_6_4 )
+{
+    TArray<int32_t> * __b_rename_at_7_5 = &(__bar_rename_at_6_4);
+    {
+        bool __need_loop_8 = true;
+        // x: int const
+        das_iterator<range> __x_iterator(range(0,10));
+        int32_t __x_rename_at_8_6;
+        __need_loop_8 = __x_iterator.first(__context__,(__x_rename_at_8_6)) && __need_loop_8;
+        for ( ; __need_loop_8 ; __need_loop_8 = __x_iterator.next(__context__,(__x_rename_at_8_6)) )
+        {
+            _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass((*__b_rename_at_7_5)),__x_rename_at_8_6);
+        }
+        __x_iterator.close(__context__,(__x_rename_at_8_6));
+    };
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14(__context__,das_arg<TArray<int32_t>>::pass((*__b_rename_at_7_5))));
+}
+
+inline bool test_2b20de90ade746ba ( Context * __context__ )
+{
+    TArray<int32_t> __a_rename_at_16_7;das_zero(__a_rename_at_16_7);
+    {
+        bool __need_loop_17 = true;
+        // x: int const
+        das_iterator<range> __x_iterator(range(0,10));
+        int32_t __x_rename_at_17_8;
+        __need_loop_17 = __x_iterator.first(__context__,(__x_rename_at_17_8)) && __need_loop_17;
+        for ( ; __need_loop_17 ; __need_loop_17 = __x_iterator.next(__context__,(__x_rename_at_17_8)) )
+        {
+            _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_16_7),10 - __x_rename_at_17_8);
+        }
+        __x_iterator.close(__context__,(__x_rename_at_17_8));
+    };
+    TArray<int32_t> __t_rename_at_20_9; das_zero(__t_rename_at_20_9); das_move(__t_rename_at_20_9, foo_3d6a07c0835832bd(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_16_7)));
+    DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_16_7)) == 0));
+    DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__t_rename_at_20_9)) == 20));
+    {
+        bool __need_loop_23 = true;
+        // x: int const
+        das_iterator<range> __x_iterator(range(-10,10));
+        int32_t __x_rename_at_23_12;
+        __need_loop_23 = __x_iterator.first(__context__,(__x_rename_at_23_12)) && __need_loop_23;
+        // y: int&
+        das_iterator<TArray<int32_t>> __y_iterator(__t_rename_at_20_9);
+        int32_t * __y_rename_at_23_13;
+        __need_loop_23 = __y_iterator.first(__context__,(__y_rename_at_23_13)) && __need_loop_23;
+        for ( ; __need_loop_23 ; __need_loop_23 = __x_iterator.next(__context__,(__x_rename_at_23_12)) && __y_iterator.next(__context__,(__y_rename_at_23_13)) )
+        {
+            DAS_ASSERT((abs_dbc771232c416b57(__context__,__x_rename_at_23_12) == (*__y_rename_at_23_13)));
+        }
+        __y_iterator.close(__context__,(__y_rename_at_23_13));
+        __x_iterator.close(__context__,(__x_rename_at_23_12));
+    };
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<TArray<int32_t> &>::from(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14(__context__, arg_a));
+}
+static vec4f __wrap__FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_value = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap_abs_dbc771232c416b57 ( Context * __context__ ) {
+    int32_t arg_i = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(abs_dbc771232c416b57(__context__, arg_i));
+}
+static vec4f __wrap_foo_3d6a07c0835832bd ( Context * __context__ ) {
+    TArray<int32_t> &  arg_bar = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = foo_3d6a07c0835832bd(__context__, arg_bar);
+    return v_zero();
+}
+static vec4f __wrap_test_2b20de90ade746ba ( Context * __context__ ) {
+    return cast<bool>::from(test_2b20de90ade746ba(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x17892cd516a9a747, false, (void*)&_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14, &__wrap__FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 },
+    { 0xbf77bb210b0552bc, false, (void*)&_FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39, &__wrap__FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 },
+    { 0x76beaedfe6d4be1f, false, (void*)&abs_dbc771232c416b57, &__wrap_abs_dbc771232c416b57 },
+    { 0x327b3e53afd1f007, true, (void*)&foo_3d6a07c0835832bd, &__wrap_foo_3d6a07c0835832bd },
+    { 0x9c7fbc3126a5e4e5, false, (void*)&test_2b20de90ade746ba, &__wrap_test_2b20de90ade746ba },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_6422774311639861804
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,318 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14195538868879819206 {
+
+namespace  { struct Bar; };
+namespace  { struct Foo; };
+namespace  {
+
+struct Bar {
+    char * t;
+    TArray<float> ta;
+};
+static_assert(sizeof(Bar)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Bar,t)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Bar,ta)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Foo {
+    bool data_bool;
+    int32_t data_int;
+    float data_float;
+    Bar data_bar;
+    TDim<uint32_t,3> data_uint_3;
+};
+static_assert(sizeof(Foo)==64,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,data_bool)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,data_int)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,data_float)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,data_bar)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,data_uint_3)==48,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__70c0cde798ed9c9d;
+extern StructInfo __struct_info__411ed0e77075265a;
+extern TypeInfo __type_info__3884b34b905bfd2e;
+extern TypeInfo __type_info__4198285eb3aaff2e;
+extern TypeInfo __type_info__89e3af2326da29b5;
+extern TypeInfo __type_info__32fb9d473a58cef3;
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__bc69a005531fe739;
+extern TypeInfo __type_info__7844477a22b8f23e;
+extern TypeInfo __type_info__af63db4c8601ead9;
+extern TypeInfo __type_info__af5be84c85f468f0;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __struct_info__70c0cde798ed9c9d_field_0 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0xcd534bc8e274ea04), "t", 0, 1 };
+VarInfo __struct_info__70c0cde798ed9c9d_field_1 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63db4c8601ead9, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xcd324bc8e23cd704), "ta", 8, 2 };
+VarInfo * __struct_info__70c0cde798ed9c9d_fields[2] =  { &__struct_info__70c0cde798ed9c9d_field_0, &__struct_info__70c0cde798ed9c9d_field_1 };
+StructInfo __struct_info__70c0cde798ed9c9d = {"Bar", "", 28, __struct_info__70c0cde798ed9c9d_fields, 2, 32, UINT64_C(0x726d46080f2cb935), nullptr, UINT64_C(0x70c0cde798ed9c9d), 0 };
+VarInfo __struct_info__411ed0e77075265a_field_0 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xb05c90959be07d4d), "data_bool", 0, 0 };
+VarInfo __struct_info__411ed0e77075265a_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x6b8e6f26ad6c94e0), "data_int", 4, 0 };
+VarInfo __struct_info__411ed0e77075265a_field_2 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xbe6f6ba7e14d8445), "data_float", 8, 0 };
+VarInfo __struct_info__411ed0e77075265a_field_3 =  { Type::tStructure, &__struct_info__70c0cde798ed9c9d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 32, UINT64_C(0x539e7e2698f5fd5d), "data_bar", 16, 5 };
+uint32_t __type_info__38d8a674234a0cd0_dim_var_4692417554209384026[1] = { 3 };
+VarInfo __struct_info__411ed0e77075265a_field_4 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 1, __type_info__38d8a674234a0cd0_dim_var_4692417554209384026, 30, 12, UINT64_C(0x38d8a674234a0cd0), "data_uint_3", 48, 0 };
+VarInfo * __struct_info__411ed0e77075265a_fields[5] =  { &__struct_info__411ed0e77075265a_field_0, &__struct_info__411ed0e77075265a_field_1, &__struct_info__411ed0e77075265a_field_2, &__struct_info__411ed0e77075265a_field_3, &__struct_info__411ed0e77075265a_field_4 };
+StructInfo __struct_info__411ed0e77075265a = {"Foo", "", 28, __struct_info__411ed0e77075265a_fields, 5, 64, UINT64_C(0x945b59082c003622), nullptr, UINT64_C(0x411ed0e77075265a), 3 };
+VarInfo __func_info__b0a4bcf6787cce7b_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af5be84c85f468f0, nullptr, nullptr, nullptr, 0, 0, nullptr, 41058, 24, UINT64_C(0x157d4243c6e6ccb3), "data", 0, 0 };
+VarInfo * __func_info__b0a4bcf6787cce7b_fields[1] =  { &__func_info__b0a4bcf6787cce7b_field_0 };
+FuncInfo __func_info__b0a4bcf6787cce7b = {"invoke block<(data:array<uint8> const#):void> const", "", __func_info__b0a4bcf6787cce7b_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xb0a4bcf6787cce7b), 0x0 };
+TypeInfo __type_info__3884b34b905bfd2e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af5be84c85f468f0, nullptr, nullptr, nullptr, 0, 0, nullptr, 41058, 24, UINT64_C(0x3884b34b905bfd2e) };
+TypeInfo __type_info__4198285eb3aaff2e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af5be84c85f468f0, nullptr, nullptr, nullptr, 0, 0, nullptr, 41122, 24, UINT64_C(0x4198285eb3aaff2e) };
+TypeInfo * __type_info__89e3af2326da29b5_arg_types[1] = { &__type_info__3884b34b905bfd2e };
+const char * __type_info__89e3af2326da29b5_arg_names[1] = { "data" };
+TypeInfo __type_info__89e3af2326da29b5 = { Type::tBlock, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__89e3af2326da29b5_arg_types, __type_info__89e3af2326da29b5_arg_names, 1, 0, nullptr, 34, 48, UINT64_C(0x89e3af2326da29b5) };
+TypeInfo __type_info__32fb9d473a58cef3 = { Type::tStructure, &__struct_info__411ed0e77075265a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57378, 64, UINT64_C(0x32fb9d473a58cef3) };
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__bc69a005531fe739 = { Type::tStructure, &__struct_info__411ed0e77075265a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 64, UINT64_C(0xbc69a005531fe739) };
+TypeInfo __type_info__7844477a22b8f23e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63db4c8601ead9, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x7844477a22b8f23e) };
+TypeInfo __type_info__af63db4c8601ead9 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63db4c8601ead9) };
+TypeInfo __type_info__af5be84c85f468f0 = { Type::tUInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xaf5be84c85f468f0) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__bc69a005531fe739, &__type_info__4198285eb3aaff2e };
+TypeInfo * __tinfo_1[2] = { &__type_info__7844477a22b8f23e, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_2[2] = { &__type_info__32fb9d473a58cef3, &__type_info__89e3af2326da29b5 };
+
+inline void _FuncbuiltinTickbinary_loadTick7105023756628579436_1e63dcce8c37e83f ( Context * __context__, Foo & __obj_rename_at_1049_0, TArray<uint8_t> const  & __data_rename_at_1049_1 );
+inline TArray<float> & _FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_66d665d7a154433 ( Context * __context__, TArray<float> & __a_rename_at_50_2 );
+inline void _FuncbuiltinTickbinary_saveTick14251134779876373816_d023bacf4002d291 ( Context * __context__, Foo const  & __obj_rename_at_1044_3, Block DAS_COMMENT((void,TArray<uint8_t> const )) const  & __subexpr_rename_at_1044_4 );
+inline void _FuncbuiltinTickpushTick14133213201864676143_88db00d1f28d5dff ( Context * __context__, TArray<float> & __Arr_rename_at_177_5, float __value_rename_at_177_6 );
+inline TArray<float> make_10_d640f59b91c8eabc ( Context * __context__ );
+inline bool test_81705492a5498e4c ( Context * __context__ );
+inline Bar Bar_2347ddefe7d3dfe9 ( Context * __context__ );
+inline Foo Foo_71d55475cc8cb43c ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickbinary_loadTick7105023756628579436_1e63dcce8c37e83f ( Context * __context__, Foo &  __obj_rename_at_1049_0, TArray<uint8_t> const  &  __data_rename_at_1049_1 )
+{
+    das_call_interop<void>::call(&_builtin_binary_load,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<Foo &>::from(__obj_rename_at_1049_0),cast<TArray<uint8_t> const  &>::from(__data_rename_at_1049_1)));
+}
+
+inline TArray<float> & _FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_66d665d7a154433 ( Context * __context__, TArray<float> &  __a_rename_at_50_2 )
+{
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<TArray<float> &>::from(__a_rename_at_50_2),cast<char * const >::from(((char *) "object can't be returned because it is locked"))));
+    return das_auto_cast_ref<TArray<float> &>::cast(__a_rename_at_50_2);
+}
+
+inline void _FuncbuiltinTickbinary_saveTick14251134779876373816_d023bacf4002d291 ( Context * __context__, Foo const  &  __obj_rename_at_1044_3, Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &  __subexpr_rename_at_1044_4 )
+{
+    das_call_interop<void>::call(&_builtin_binary_save,__context__,SimNode_AotInterop<2>(__tinfo_2,cast<Foo const  &>::from(__obj_rename_at_1044_3),cast<Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &>::from(__subexpr_rename_at_1044_4)));
+}
+
+inline void _FuncbuiltinTickpushTick14133213201864676143_88db00d1f28d5dff ( Context * __context__, TArray<float> &  __Arr_rename_at_177_5, float __value_rename_at_177_6 )
+{
+    das_copy(__Arr_rename_at_177_5(builtin_array_push_back(das_arg<TArray<float>>::pass(__Arr_rename_at_177_5),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_177_6);
+}
+
+inline TArray<float> make_10_d640f59b91c8eabc ( Context * __context__ )
+{
+    TArray<float> __a_rename_at_5_7;das_zero(__a_rename_at_5_7);
+    {
+        bool __need_loop_6 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(0,10));
+        int32_t __i_rename_at_6_8;
+        __need_loop_6 = __i_iterator.first(__context__,(__i_rename_at_6_8)) && __need_loop_6;
+        for ( ; __need_loop_6 ; __need_loop_6 = __i_iterator.next(__context__,(__i_rename_at_6_8)) )
+        {
+            _FuncbuiltinTickpushTick14133213201864676143_88db00d1f28d5dff(__context__,das_arg<TArray<float>>::pass(__a_rename_at_5_7),float(__i_rename_at_6_8));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_6_8));
+    };
+    return /* <- */ das_auto_cast_move<TArray<float>>::cast(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_66d665d7a154433(__context__,das_arg<TArray<float>>::pass(__a_rename_at_5_7)));
+}
+
+inline bool test_81705492a5498e4c ( Context * __context__ ) { das_stack_prologue __prologue(__context__,240,"test " DAS_FILE_LINE);
+{
+    Foo __f0_rename_at_28_9_ConstRef; das_zero(__f0_rename_at_28_9_ConstRef); das_move(__f0_rename_at_28_9_ConstRef, ((Foo)(([&]() -> Foo {
+        Foo __mks_28 = Foo_71d55475cc8cb43c(__context__);
+        return __mks_28;
+    })())));
+    Foo const  & __f0_rename_at_28_9 = __f0_rename_at_28_9_ConstRef;
+;
+    Foo __f1_rename_at_29_10;das_zero(__f1_rename_at_29_10);
+    _FuncbuiltinTickbinary_saveTick14251134779876373816_d023bacf4002d291(__context__,__f0_rename_at_28_9,das_make_block<void,TArray<uint8_t> const  &>(__context__,208,0,&__func_info__b0a4bcf6787cce7b,[&](TArray<uint8_t> const  & __data_rename_at_30_11) -> void{
+        _FuncbuiltinTickbinary_loadTick7105023756628579436_1e63dcce8c37e83f(__context__,das_arg<Foo>::pass(__f1_rename_at_29_10),__data_rename_at_30_11);
+        DAS_ASSERT((__f1_rename_at_29_10.data_bool == true));
+        DAS_ASSERT((__f1_rename_at_29_10.data_int == 1));
+        DAS_ASSERT((__f1_rename_at_29_10.data_float == 3.140000e+00f));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__f1_rename_at_29_10.data_bar.t),cast<char *>::from(((char *) "blah")),*__context__,nullptr)));
+        DAS_ASSERT((((__f1_rename_at_29_10.data_uint_3(0,__context__) == 0x1u) && (__f1_rename_at_29_10.data_uint_3(1,__context__) == 0x2u)) && (__f1_rename_at_29_10.data_uint_3(2,__context__) == 0x3u)));
+        {
+            bool __need_loop_37 = true;
+            // i: int const
+            das_iterator<range> __i_iterator(range(0,10));
+            int32_t __i_rename_at_37_12;
+            __need_loop_37 = __i_iterator.first(__context__,(__i_rename_at_37_12)) && __need_loop_37;
+            for ( ; __need_loop_37 ; __need_loop_37 = __i_iterator.next(__context__,(__i_rename_at_37_12)) )
+            {
+                DAS_ASSERT((__f1_rename_at_29_10.data_bar.ta(__i_rename_at_37_12,__context__) == float(__i_rename_at_37_12)));
+            }
+            __i_iterator.close(__context__,(__i_rename_at_37_12));
+        };
+    }));
+    return das_auto_cast<bool>::cast(true);
+}}
+
+inline Bar Bar_2347ddefe7d3dfe9 ( Context * __context__ )
+{
+    return /* <- */ das_auto_cast_move<Bar>::cast((([&]() -> Bar {
+        Bar __mks_12;
+        das_copy((__mks_12.t),(((char *) "blah")));
+        das_move((__mks_12.ta),(make_10_d640f59b91c8eabc(__context__)));
+        return __mks_12;
+    })()));
+}
+
+inline Foo Foo_71d55475cc8cb43c ( Context * __context__ )
+{
+    return /* <- */ das_auto_cast_move<Foo>::cast((([&]() -> Foo {
+        Foo __mks_18;
+        das_zero(__mks_18);
+        das_copy((__mks_18.data_bool),(true));
+        das_copy((__mks_18.data_int),(1));
+        das_copy((__mks_18.data_float),(3.140000e+00f));
+        das_move((__mks_18.data_bar),((([&]() -> Bar {
+            Bar __mks_22 = Bar_2347ddefe7d3dfe9(__context__);
+            return __mks_22;
+        })())));
+        das_copy((__mks_18.data_uint_3),((([&]() -> TDim<uint32_t,3> {
+            TDim<uint32_t,3> __mka_23;
+            __mka_23(0,__context__) = 0x1u;
+            __mka_23(1,__context__) = 0x2u;
+            __mka_23(2,__context__) = 0x3u;
+            return __mka_23;
+        })())));
+        return __mks_18;
+    })()));
+}
+static vec4f __wrap__FuncbuiltinTickbinary_loadTick7105023756628579436_1e63dcce8c37e83f ( Context * __context__ ) {
+    Foo &  arg_obj = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<uint8_t> const  &  arg_data = cast_aot_arg<TArray<uint8_t> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickbinary_loadTick7105023756628579436_1e63dcce8c37e83f(__context__, arg_obj, arg_data);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_66d665d7a154433 ( Context * __context__ ) {
+    TArray<float> &  arg_a = cast_aot_arg<TArray<float> & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<TArray<float> &>::from(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_66d665d7a154433(__context__, arg_a));
+}
+static vec4f __wrap__FuncbuiltinTickbinary_saveTick14251134779876373816_d023bacf4002d291 ( Context * __context__ ) {
+    Foo const  &  arg_obj = cast_aot_arg<Foo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &  arg_subexpr = cast_aot_arg<Block DAS_COMMENT((void,TArray<uint8_t> const )) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickbinary_saveTick14251134779876373816_d023bacf4002d291(__context__, arg_obj, arg_subexpr);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpushTick14133213201864676143_88db00d1f28d5dff ( Context * __context__ ) {
+    TArray<float> &  arg_Arr = cast_aot_arg<TArray<float> & >::to(*__context__,__context__->abiArguments()[0]);
+    float arg_value = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick14133213201864676143_88db00d1f28d5dff(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap_make_10_d640f59b91c8eabc ( Context * __context__ ) {
+    *((TArray<float> *) __context__->abiCMRES) = make_10_d640f59b91c8eabc(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_81705492a5498e4c ( Context * __context__ ) {
+    return cast<bool>::from(test_81705492a5498e4c(__context__));
+}
+static vec4f __wrap_Bar_2347ddefe7d3dfe9 ( Context * __context__ ) {
+    *((Bar *) __context__->abiCMRES) = Bar_2347ddefe7d3dfe9(__context__);
+    return v_zero();
+}
+static vec4f __wrap_Foo_71d55475cc8cb43c ( Context * __context__ ) {
+    *((Foo *) __context__->abiCMRES) = Foo_71d55475cc8cb43c(__context__);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x82b6b93a1c27f127, false, (void*)&_FuncbuiltinTickbinary_loadTick7105023756628579436_1e63dcce8c37e83f, &__wrap__FuncbuiltinTickbinary_loadTick7105023756628579436_1e63dcce8c37e83f },
+    { 0xd51f1d5a662ba5cc, false, (void*)&_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_66d665d7a154433, &__wrap__FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_66d665d7a154433 },
+    { 0x53866c6488b54629, false, (void*)&_FuncbuiltinTickbinary_saveTick14251134779876373816_d023bacf4002d291, &__wrap__FuncbuiltinTickbinary_saveTick14251134779876373816_d023bacf4002d291 },
+    { 0x26f608b1e86fe7c7, false, (void*)&_FuncbuiltinTickpushTick14133213201864676143_88db00d1f28d5dff, &__wrap__FuncbuiltinTickpushTick14133213201864676143_88db00d1f28d5dff },
+    { 0x21a9dcdc9f0dd63f, true, (void*)&make_10_d640f59b91c8eabc, &__wrap_make_10_d640f59b91c8eabc },
+    { 0x11c65dd879bd19f8, false, (void*)&test_81705492a5498e4c, &__wrap_test_81705492a5498e4c },
+    { 0xd057c8f75bd4fe5f, true, (void*)&Bar_2347ddefe7d3dfe9, &__wrap_Bar_2347ddefe7d3dfe9 },
+    { 0xbd3ac6510794077f, true, (void*)&Foo_71d55475cc8cb43c, &__wrap_Foo_71d55475cc8cb43c },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_14195538868879819206
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,138 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14805203619323865644 {
+
+extern TypeInfo __type_info__1459da8d4e25b2ef;
+
+const char * __type_info__1459da8d4e25b2ef_arg_names[3] = { "one", "two", "three" };
+TypeInfo __type_info__1459da8d4e25b2ef = { Type::tBitfield, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, __type_info__1459da8d4e25b2ef_arg_names, 3, 0, nullptr, 28, 4, UINT64_C(0x1459da8d4e25b2ef) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__1459da8d4e25b2ef };
+
+inline Bitfield bit_bb7ee30bcd8ad27d ( Context * __context__, int32_t __b_rename_at_27_0 );
+inline bool test_3833ddc473922eb ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global<Bitfield,0x44b2258754da0939>(__context__) = (0x2u | bit_bb7ee30bcd8ad27d(__context__,2));/*t*/
+    das_global<Bitfield8,0xb57bc17c8084e9a3>(__context__) = 0x1u;/*bf_8*/
+    das_global<Bitfield16,0xf3b4f632ffb0eecd>(__context__) = 0x2u;/*bf_16*/
+    das_global<Bitfield,0x3906d4c52cb84181>(__context__) = 0x4u;/*bf*/
+    das_global<Bitfield64,0xf172e629e3c691eb>(__context__) = 0x1u;/*bf_64*/
+}
+
+inline Bitfield bit_bb7ee30bcd8ad27d ( Context * __context__, int32_t __b_rename_at_27_0 )
+{
+    return das_auto_cast<Bitfield>::cast(Bitfield(SimPolicy<int32_t>::BinShl(1,__b_rename_at_27_0,*__context__,nullptr)));
+}
+
+inline bool test_3833ddc473922eb ( Context * __context__ )
+{
+    DAS_ASSERT(((!(das_get_bitfield(das_global<Bitfield,0x44b2258754da0939>(__context__) /*t*/,1u << 0)) && das_get_bitfield(das_global<Bitfield,0x44b2258754da0939>(__context__) /*t*/,1u << 1)) && das_get_bitfield(das_global<Bitfield,0x44b2258754da0939>(__context__) /*t*/,1u << 2)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<Bitfield>::from(das_global<Bitfield,0x44b2258754da0939>(__context__) /*t*/)))),cast<char *>::from(((char *) "(two|three)")),*__context__,nullptr)));
+    das_global<Bitfield,0x44b2258754da0939>(__context__) /*t*/ ^= 0x2u;
+    DAS_ASSERT(((!(das_get_bitfield(das_global<Bitfield,0x44b2258754da0939>(__context__) /*t*/,1u << 0)) && !(das_get_bitfield(das_global<Bitfield,0x44b2258754da0939>(__context__) /*t*/,1u << 1))) && das_get_bitfield(das_global<Bitfield,0x44b2258754da0939>(__context__) /*t*/,1u << 2)));
+    DAS_ASSERT((das_global<Bitfield,0x44b2258754da0939>(__context__) /*t*/ == 0x4u));
+    das_global<Bitfield,0x44b2258754da0939>(__context__) /*t*/ |= 0x1u;
+    DAS_ASSERT(((das_get_bitfield(das_global<Bitfield,0x44b2258754da0939>(__context__) /*t*/,1u << 0) && !(das_get_bitfield(das_global<Bitfield,0x44b2258754da0939>(__context__) /*t*/,1u << 1))) && das_get_bitfield(das_global<Bitfield,0x44b2258754da0939>(__context__) /*t*/,1u << 2)));
+    DAS_ASSERT((das_get_bitfield(das_global<Bitfield8,0xb57bc17c8084e9a3>(__context__) /*bf_8*/,1u << 0) && !(das_get_bitfield(das_global<Bitfield8,0xb57bc17c8084e9a3>(__context__) /*bf_8*/,1u << 1))));
+    DAS_ASSERT((das_get_bitfield(das_global<Bitfield16,0xf3b4f632ffb0eecd>(__context__) /*bf_16*/,1u << 1) && !(das_get_bitfield(das_global<Bitfield8,0xb57bc17c8084e9a3>(__context__) /*bf_8*/,1u << 2))));
+    DAS_ASSERT((das_get_bitfield(das_global<Bitfield,0x3906d4c52cb84181>(__context__) /*bf*/,1u << 2) && !(das_get_bitfield(das_global<Bitfield,0x3906d4c52cb84181>(__context__) /*bf*/,1u << 0))));
+    DAS_ASSERT((das_get_bitfield(das_global<Bitfield64,0xf172e629e3c691eb>(__context__) /*bf_64*/,1u << 0) && !(das_get_bitfield(das_global<Bitfield64,0xf172e629e3c691eb>(__context__) /*bf_64*/,1u << 1))));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_bit_bb7ee30bcd8ad27d ( Context * __context__ ) {
+    int32_t arg_b = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<Bitfield>::from(bit_bb7ee30bcd8ad27d(__context__, arg_b));
+}
+static vec4f __wrap_test_3833ddc473922eb ( Context * __context__ ) {
+    return cast<bool>::from(test_3833ddc473922eb(__context__));
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x2b048fafddb1badc, false, (void*)&bit_bb7ee30bcd8ad27d, &__wrap_bit_bb7ee30bcd8ad27d },
+    { 0x39f23da90fea652a, false, (void*)&test_3833ddc473922eb, &__wrap_test_3833ddc473922eb },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0xdc27d34e9415db5a, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_14805203619323865644
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,197 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_2241890480087242245 {
+
+namespace  { struct _lambda_thismodule_11_1; };
+namespace  {
+
+struct _lambda_thismodule_11_1 {
+    Func DAS_COMMENT((int32_t,_lambda_thismodule_11_1,int32_t)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_11_1 *)) __finalize;
+    int32_t CNT;
+};
+static_assert(sizeof(_lambda_thismodule_11_1)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_11_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_11_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_11_1,CNT)==16,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__cc3f70a6386c9eb9;
+extern TypeInfo __type_info__5a999def1f1afe75;
+extern TypeInfo __type_info__af8afe4c86446b52;
+extern TypeInfo __type_info__4e6b29c42ceaf2ba;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+TypeInfo * __type_info__68e637e4566ab8ee_arg_types_var_14717605966483594937[2] = { &__type_info__4e6b29c42ceaf2ba, &__type_info__af8afe4c86446b52 };
+const char * __type_info__68e637e4566ab8ee_arg_names_var_14717605966483594937[2] = { "__this", "extra" };
+VarInfo __struct_info__cc3f70a6386c9eb9_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, (TypeInfo **)__type_info__68e637e4566ab8ee_arg_types_var_14717605966483594937, __type_info__68e637e4566ab8ee_arg_names_var_14717605966483594937, 2, 0, nullptr, 12, 8, UINT64_C(0x68e637e4566ab8ee), "__lambda", 0, 0 };
+TypeInfo * __type_info__38aac874f58455b7_arg_types_var_14717605966483594937[1] = { &__type_info__5a999def1f1afe75 };
+const char * __type_info__38aac874f58455b7_arg_names_var_14717605966483594937[1] = { "__this" };
+VarInfo __struct_info__cc3f70a6386c9eb9_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__38aac874f58455b7_arg_types_var_14717605966483594937, __type_info__38aac874f58455b7_arg_names_var_14717605966483594937, 1, 0, nullptr, 12, 8, UINT64_C(0x38aac874f58455b7), "__finalize", 8, 0 };
+VarInfo __struct_info__cc3f70a6386c9eb9_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x73af081bbfd0b353), "CNT", 16, 0 };
+VarInfo * __struct_info__cc3f70a6386c9eb9_fields[3] =  { &__struct_info__cc3f70a6386c9eb9_field_0, &__struct_info__cc3f70a6386c9eb9_field_1, &__struct_info__cc3f70a6386c9eb9_field_2 };
+StructInfo __struct_info__cc3f70a6386c9eb9 = {"_lambda_thismodule_11_1", "", 14, __struct_info__cc3f70a6386c9eb9_fields, 3, 24, UINT64_C(0x0), nullptr, UINT64_C(0xcc3f70a6386c9eb9), 3 };
+VarInfo __func_info__f37b31c0f01cb6f6_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xd7f25056955fe311), "extraBlock", 0, 0 };
+VarInfo * __func_info__f37b31c0f01cb6f6_fields[1] =  { &__func_info__f37b31c0f01cb6f6_field_0 };
+FuncInfo __func_info__f37b31c0f01cb6f6 = {"invoke block<(extraBlock:int const):int> const", "", __func_info__f37b31c0f01cb6f6_fields, 1, 32, &__type_info__af63e44c8601fa24, nullptr,0,UINT64_C(0xf37b31c0f01cb6f6), 0x0 };
+TypeInfo __type_info__5a999def1f1afe75 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4e6b29c42ceaf2ba, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x5a999def1f1afe75) };
+TypeInfo __type_info__af8afe4c86446b52 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf8afe4c86446b52) };
+TypeInfo __type_info__4e6b29c42ceaf2ba = { Type::tStructure, &__struct_info__cc3f70a6386c9eb9, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 24, UINT64_C(0x4e6b29c42ceaf2ba) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void finalize_e120e7a5a6f3b19c ( Context * __context__, _lambda_thismodule_11_1 & ____this_rename_at_11_0 );
+inline int32_t _Func_lambda_thismodule_11_1Tickfunction_a6fb2fed5331cd90 ( Context * __context__, _lambda_thismodule_11_1 & ____this_rename_at_11_1, int32_t __extra_rename_at_11_2 );
+inline void _Func_lambda_thismodule_11_1Tickfinalizer_3588fbea1ffad93e ( Context * __context__, _lambda_thismodule_11_1 * ____this_rename_at_11_5 );
+inline int32_t _FuncTickaddValueTick4609698181453116361_203a3493a8d76e47 ( Context * __context__, int32_t __a_rename_at_4_6, Block DAS_COMMENT((int32_t,int32_t)) const  & __blk_rename_at_4_7 );
+inline bool test_3cadc28d9a16a5d9 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void finalize_e120e7a5a6f3b19c ( Context * __context__, _lambda_thismodule_11_1 &  ____this_rename_at_11_0 )
+{
+    memset((void*)&(____this_rename_at_11_0), 0, 24);
+}
+
+inline int32_t _Func_lambda_thismodule_11_1Tickfunction_a6fb2fed5331cd90 ( Context * __context__, _lambda_thismodule_11_1 &  ____this_rename_at_11_1, int32_t __extra_rename_at_11_2 ) { das_stack_prologue __prologue(__context__,112,"_lambda_thismodule_11_1`function " DAS_FILE_LINE);
+{
+    int32_t __e1_rename_at_12_3 = ((int32_t)_FuncTickaddValueTick4609698181453116361_203a3493a8d76e47(__context__,1,das_make_block<int32_t,int32_t>(__context__,96,0,&__func_info__f37b31c0f01cb6f6,[&](int32_t const  __extraBlock_rename_at_12_4) -> int32_t{
+        return das_auto_cast<int32_t>::cast(__extraBlock_rename_at_12_4 + ____this_rename_at_11_1.CNT);
+    })));
+    return das_auto_cast<int32_t>::cast((____this_rename_at_11_1.CNT++) + __e1_rename_at_12_3);
+}}
+
+inline void _Func_lambda_thismodule_11_1Tickfinalizer_3588fbea1ffad93e ( Context * __context__, _lambda_thismodule_11_1 * ____this_rename_at_11_5 )
+{
+    finalize_e120e7a5a6f3b19c(__context__,das_arg<_lambda_thismodule_11_1>::pass(das_deref(__context__,____this_rename_at_11_5,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_11_1 *>::clear(__context__,____this_rename_at_11_5);
+}
+
+inline int32_t _FuncTickaddValueTick4609698181453116361_203a3493a8d76e47 ( Context * __context__, int32_t __a_rename_at_4_6, Block DAS_COMMENT((int32_t,int32_t)) const  &  __blk_rename_at_4_7 )
+{
+    return das_auto_cast<int32_t>::cast(das_invoke<int32_t>::invoke<int32_t>(__context__,nullptr,__blk_rename_at_4_7,__a_rename_at_4_6));
+}
+
+inline bool test_3cadc28d9a16a5d9 ( Context * __context__ )
+{
+    Lambda DAS_COMMENT((int32_t,int32_t)) __counter_rename_at_11_8; das_zero(__counter_rename_at_11_8); das_move(__counter_rename_at_11_8, ((Lambda DAS_COMMENT((int32_t,int32_t)))das_ascend<int32_t,_lambda_thismodule_11_1>::make(__context__,&__type_info__4e6b29c42ceaf2ba,(([&]() -> _lambda_thismodule_11_1 {
+        _lambda_thismodule_11_1 __mks_11;
+        das_copy((__mks_11.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_11_1`function XS<_lambda_thismodule_11_1> Ci*/ 0x1a28db565628afa2))));
+        das_copy((__mks_11.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_11_1`finalizer X1<S<_lambda_thismodule_11_1>>?*/ 0xa84292258509bb62))));
+        das_copy((__mks_11.CNT),(0));
+        return __mks_11;
+    })()))));
+    DAS_VERIFY((das_invoke_lambda<int32_t>::invoke<int32_t>(__context__,nullptr,__counter_rename_at_11_8,0) == 1));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_finalize_e120e7a5a6f3b19c ( Context * __context__ ) {
+    _lambda_thismodule_11_1 &  arg___this = cast_aot_arg<_lambda_thismodule_11_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_e120e7a5a6f3b19c(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_11_1Tickfunction_a6fb2fed5331cd90 ( Context * __context__ ) {
+    _lambda_thismodule_11_1 &  arg___this = cast_aot_arg<_lambda_thismodule_11_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_extra = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t>::from(_Func_lambda_thismodule_11_1Tickfunction_a6fb2fed5331cd90(__context__, arg___this, arg_extra));
+}
+static vec4f __wrap__Func_lambda_thismodule_11_1Tickfinalizer_3588fbea1ffad93e ( Context * __context__ ) {
+    _lambda_thismodule_11_1 * arg___this = cast_aot_arg<_lambda_thismodule_11_1 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_11_1Tickfinalizer_3588fbea1ffad93e(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickaddValueTick4609698181453116361_203a3493a8d76e47 ( Context * __context__ ) {
+    int32_t arg_a = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((int32_t,int32_t)) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((int32_t,int32_t)) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t>::from(_FuncTickaddValueTick4609698181453116361_203a3493a8d76e47(__context__, arg_a, arg_blk));
+}
+static vec4f __wrap_test_3cadc28d9a16a5d9 ( Context * __context__ ) {
+    return cast<bool>::from(test_3cadc28d9a16a5d9(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x495f8315a2aff674, false, (void*)&finalize_e120e7a5a6f3b19c, &__wrap_finalize_e120e7a5a6f3b19c },
+    { 0x62d43c05ae24da5e, false, (void*)&_Func_lambda_thismodule_11_1Tickfunction_a6fb2fed5331cd90, &__wrap__Func_lambda_thismodule_11_1Tickfunction_a6fb2fed5331cd90 },
+    { 0x2dc7becb1bb8ca7d, false, (void*)&_Func_lambda_thismodule_11_1Tickfinalizer_3588fbea1ffad93e, &__wrap__Func_lambda_thismodule_11_1Tickfinalizer_3588fbea1ffad93e },
+    { 0x8e37283e7b0b1e3d, false, (void*)&_FuncTickaddValueTick4609698181453116361_203a3493a8d76e47, &__wrap__FuncTickaddValueTick4609698181453116361_203a3493a8d76e47 },
+    { 0xee7f39bec532aff2, false, (void*)&test_3cadc28d9a16a5d9, &__wrap_test_3cadc28d9a16a5d9 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_2241890480087242245
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,257 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_947146584153613507 {
+
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+    int32_t v;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,v)==0,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__411ed0e77075265a;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __struct_info__411ed0e77075265a_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xbcd6a0bb60c7eac9), "v", 0, 0 };
+VarInfo * __struct_info__411ed0e77075265a_fields[1] =  { &__struct_info__411ed0e77075265a_field_0 };
+StructInfo __struct_info__411ed0e77075265a = {"Foo", "", 0, __struct_info__411ed0e77075265a_fields, 1, 4, UINT64_C(0x0), nullptr, UINT64_C(0x411ed0e77075265a), 1 };
+VarInfo __func_info__e3815103698392d0_field_0 =  { Type::tStructure, &__struct_info__411ed0e77075265a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 62, 4, UINT64_C(0x8610d3310610ee1e), "a", 0, 0 };
+VarInfo * __func_info__e3815103698392d0_fields[1] =  { &__func_info__e3815103698392d0_field_0 };
+FuncInfo __func_info__e3815103698392d0 = {"invoke block<(a:Foo const):void> const", "", __func_info__e3815103698392d0_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xe3815103698392d0), 0x0 };
+VarInfo __func_info__7bf349e73f0b00e0_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 317, 4, UINT64_C(0x1d4abf7c5bb20f3c), "a", 0, 0 };
+VarInfo * __func_info__7bf349e73f0b00e0_fields[1] =  { &__func_info__7bf349e73f0b00e0_field_0 };
+FuncInfo __func_info__7bf349e73f0b00e0 = {"invoke block<(a:int const&):void> const", "", __func_info__7bf349e73f0b00e0_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x7bf349e73f0b00e0), 0x0 };
+VarInfo __func_info__4f5768e842ce0b4b_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x9c35250759777ebd), "a", 0, 0 };
+VarInfo * __func_info__4f5768e842ce0b4b_fields[1] =  { &__func_info__4f5768e842ce0b4b_field_0 };
+FuncInfo __func_info__4f5768e842ce0b4b = {"invoke block<(a:int const):void> const", "", __func_info__4f5768e842ce0b4b_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x4f5768e842ce0b4b), 0x0 };
+VarInfo __func_info__12683b382886dcea_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 8236, 8, UINT64_C(0x6fbe64ae355f3b17), "a", 0, 0 };
+VarInfo * __func_info__12683b382886dcea_fields[1] =  { &__func_info__12683b382886dcea_field_0 };
+FuncInfo __func_info__12683b382886dcea = {"invoke block<(a:int? const):void> const", "", __func_info__12683b382886dcea_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x12683b382886dcea), 0x0 };
+VarInfo __func_info__b4f4f18f5bb5bb8b_field_0 =  { Type::tStructure, &__struct_info__411ed0e77075265a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 62, 4, UINT64_C(0xe0426ba33d396b73), "b", 0, 0 };
+VarInfo * __func_info__b4f4f18f5bb5bb8b_fields[1] =  { &__func_info__b4f4f18f5bb5bb8b_field_0 };
+FuncInfo __func_info__b4f4f18f5bb5bb8b = {"invoke block<(b:Foo const):void> const", "", __func_info__b4f4f18f5bb5bb8b_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xb4f4f18f5bb5bb8b), 0x0 };
+VarInfo __func_info__4330e5b22c9a5c75_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 317, 4, UINT64_C(0x5270367c817d3ec1), "b", 0, 0 };
+VarInfo * __func_info__4330e5b22c9a5c75_fields[1] =  { &__func_info__4330e5b22c9a5c75_field_0 };
+FuncInfo __func_info__4330e5b22c9a5c75 = {"invoke block<(b:int const&):void> const", "", __func_info__4330e5b22c9a5c75_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x4330e5b22c9a5c75), 0x0 };
+VarInfo __func_info__7161933376d70ebc_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x9c4d55075997eed2), "b", 0, 0 };
+VarInfo * __func_info__7161933376d70ebc_fields[1] =  { &__func_info__7161933376d70ebc_field_0 };
+FuncInfo __func_info__7161933376d70ebc = {"invoke block<(b:int const):void> const", "", __func_info__7161933376d70ebc_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x7161933376d70ebc), 0x0 };
+VarInfo __func_info__27002f27dd8f669_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 8236, 8, UINT64_C(0x30fe921e3581b8bc), "b", 0, 0 };
+VarInfo * __func_info__27002f27dd8f669_fields[1] =  { &__func_info__27002f27dd8f669_field_0 };
+FuncInfo __func_info__27002f27dd8f669 = {"invoke block<(b:int? const):void> const", "", __func_info__27002f27dd8f669_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x27002f27dd8f669), 0x0 };
+VarInfo __func_info__7f22cbbbbf6c0936_field_0 =  { Type::tStructure, &__struct_info__411ed0e77075265a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 62, 4, UINT64_C(0x5c1a01d2b1172c68), "c", 0, 0 };
+VarInfo * __func_info__7f22cbbbbf6c0936_fields[1] =  { &__func_info__7f22cbbbbf6c0936_field_0 };
+FuncInfo __func_info__7f22cbbbbf6c0936 = {"invoke block<(c:Foo const):void> const", "", __func_info__7f22cbbbbf6c0936_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x7f22cbbbbf6c0936), 0x0 };
+VarInfo __func_info__15de908ddc27b67a_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 317, 4, UINT64_C(0x1f44ed7c5877f5de), "c", 0, 0 };
+VarInfo * __func_info__15de908ddc27b67a_fields[1] =  { &__func_info__15de908ddc27b67a_field_0 };
+FuncInfo __func_info__15de908ddc27b67a = {"invoke block<(c:int const&):void> const", "", __func_info__15de908ddc27b67a_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x15de908ddc27b67a), 0x0 };
+VarInfo __func_info__8e0f9d7778857d95_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x9c396d075978fec3), "c", 0, 0 };
+VarInfo * __func_info__8e0f9d7778857d95_fields[1] =  { &__func_info__8e0f9d7778857d95_field_0 };
+FuncInfo __func_info__8e0f9d7778857d95 = {"invoke block<(c:int const):void> const", "", __func_info__8e0f9d7778857d95_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x8e0f9d7778857d95), 0x0 };
+VarInfo __func_info__3a05ed7b3343fd84_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 8236, 8, UINT64_C(0xe7466cb28c17c669), "c", 0, 0 };
+VarInfo * __func_info__3a05ed7b3343fd84_fields[1] =  { &__func_info__3a05ed7b3343fd84_field_0 };
+FuncInfo __func_info__3a05ed7b3343fd84 = {"invoke block<(c:int? const):void> const", "", __func_info__3a05ed7b3343fd84_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x3a05ed7b3343fd84), 0x0 };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void passthrough_35602bc0fa0c744d ( Context * __context__, int32_t __a_rename_at_2_0, Block DAS_COMMENT((void,int32_t)) const  & __blk_rename_at_2_1 );
+inline void passthroughref_f8bc90264357600a ( Context * __context__, int32_t const  & __a_rename_at_6_2, Block DAS_COMMENT((void,int32_t const  &)) const  & __blk_rename_at_6_3 );
+inline void passthroughptr_6fdf328e52a1ebe5 ( Context * __context__, int32_t * const  __a_rename_at_10_4, Block DAS_COMMENT((void,int32_t * const )) const  & __blk_rename_at_10_5 );
+inline void passthroughFoo_6b1cddabfdef43e1 ( Context * __context__, Foo const  & __a_rename_at_18_6, Block DAS_COMMENT((void,Foo const )) const  & __blk_rename_at_18_7 );
+inline bool test_8f4a9b99911240f4 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void passthrough_35602bc0fa0c744d ( Context * __context__, int32_t __a_rename_at_2_0, Block DAS_COMMENT((void,int32_t)) const  &  __blk_rename_at_2_1 )
+{
+    das_invoke<void>::invoke<int32_t>(__context__,nullptr,__blk_rename_at_2_1,__a_rename_at_2_0);
+}
+
+inline void passthroughref_f8bc90264357600a ( Context * __context__, int32_t const  & __a_rename_at_6_2, Block DAS_COMMENT((void,int32_t const  &)) const  &  __blk_rename_at_6_3 )
+{
+    das_invoke<void>::invoke<int32_t const  &>(__context__,nullptr,__blk_rename_at_6_3,__a_rename_at_6_2);
+}
+
+inline void passthroughptr_6fdf328e52a1ebe5 ( Context * __context__, int32_t * const  __a_rename_at_10_4, Block DAS_COMMENT((void,int32_t * const )) const  &  __blk_rename_at_10_5 )
+{
+    das_invoke<void>::invoke<int32_t * const >(__context__,nullptr,__blk_rename_at_10_5,__a_rename_at_10_4);
+}
+
+inline void passthroughFoo_6b1cddabfdef43e1 ( Context * __context__, Foo const  &  __a_rename_at_18_6, Block DAS_COMMENT((void,Foo const )) const  &  __blk_rename_at_18_7 )
+{
+    das_invoke<void>::invoke<Foo const  &>(__context__,nullptr,__blk_rename_at_18_7,__a_rename_at_18_6);
+}
+
+inline bool test_8f4a9b99911240f4 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,320,"test " DAS_FILE_LINE);
+{
+    Foo _temp_make_local_59_19_0; _temp_make_local_59_19_0;
+    passthrough_35602bc0fa0c744d(__context__,1,das_make_block<void,int32_t>(__context__,80,0,&__func_info__4f5768e842ce0b4b,[&](int32_t const  __a_rename_at_24_8) -> void{
+        DAS_ASSERT((__a_rename_at_24_8 == 1));
+        passthrough_35602bc0fa0c744d(__context__,2,das_make_block<void,int32_t>(__context__,144,0,&__func_info__7161933376d70ebc,[&](int32_t const  __b_rename_at_26_9) -> void{
+            DAS_ASSERT(((__a_rename_at_24_8 == 1) && (__b_rename_at_26_9 == 2)));
+            passthrough_35602bc0fa0c744d(__context__,3,das_make_block<void,int32_t>(__context__,208,0,&__func_info__8e0f9d7778857d95,[&](int32_t const  __c_rename_at_28_10) -> void{
+                DAS_ASSERT((((__a_rename_at_24_8 == 1) && (__b_rename_at_26_9 == 2)) && (__c_rename_at_28_10 == 3)));
+            }));
+        }));
+    }));
+    int32_t __A_rename_at_34_11 = 1;
+    int32_t __B_rename_at_35_12 = 2;
+    int32_t __C_rename_at_36_13 = 3;
+    passthroughref_f8bc90264357600a(__context__,__A_rename_at_34_11,das_make_block<void,int32_t const  &>(__context__,128,0,&__func_info__7bf349e73f0b00e0,[&](int32_t const  & __a_rename_at_37_14) -> void{
+        DAS_ASSERT((__a_rename_at_37_14 == 1));
+        passthroughref_f8bc90264357600a(__context__,__B_rename_at_35_12,das_make_block<void,int32_t const  &>(__context__,192,0,&__func_info__4330e5b22c9a5c75,[&](int32_t const  & __b_rename_at_39_15) -> void{
+            DAS_ASSERT(((__a_rename_at_37_14 == 1) && (__b_rename_at_39_15 == 2)));
+            passthroughref_f8bc90264357600a(__context__,__C_rename_at_36_13,das_make_block<void,int32_t const  &>(__context__,256,0,&__func_info__15de908ddc27b67a,[&](int32_t const  & __c_rename_at_41_16) -> void{
+                DAS_ASSERT((((__a_rename_at_37_14 == 1) && (__b_rename_at_39_15 == 2)) && (__c_rename_at_41_16 == 3)));
+            }));
+        }));
+    }));
+    passthroughptr_6fdf328e52a1ebe5(__context__,das_ref(__context__,__A_rename_at_34_11),das_make_block<void,int32_t * const >(__context__,128,0,&__func_info__12683b382886dcea,[&](int32_t * const  __a_rename_at_48_17) -> void{
+        DAS_ASSERT((das_deref(__context__,__a_rename_at_48_17,__FILE__,__LINE__) == 1));
+        passthroughptr_6fdf328e52a1ebe5(__context__,das_ref(__context__,__B_rename_at_35_12),das_make_block<void,int32_t * const >(__context__,192,0,&__func_info__27002f27dd8f669,[&](int32_t * const  __b_rename_at_50_18) -> void{
+            DAS_ASSERT(((das_deref(__context__,__a_rename_at_48_17,__FILE__,__LINE__) == 1) && (das_deref(__context__,__b_rename_at_50_18,__FILE__,__LINE__) == 2)));
+            passthroughptr_6fdf328e52a1ebe5(__context__,das_ref(__context__,__C_rename_at_36_13),das_make_block<void,int32_t * const >(__context__,256,0,&__func_info__3a05ed7b3343fd84,[&](int32_t * const  __c_rename_at_52_19) -> void{
+                DAS_ASSERT((((das_deref(__context__,__a_rename_at_48_17,__FILE__,__LINE__) == 1) && (das_deref(__context__,__b_rename_at_50_18,__FILE__,__LINE__) == 2)) && (das_deref(__context__,__c_rename_at_52_19,__FILE__,__LINE__) == 3)));
+            }));
+        }));
+    }));
+    passthroughFoo_6b1cddabfdef43e1(__context__,das_arg<Foo>::pass((([&]() -> Foo& {
+        das_copy((_temp_make_local_59_19_0.v),(1));
+        return _temp_make_local_59_19_0;
+    })())),das_make_block<void,Foo const  &>(__context__,144,0,&__func_info__e3815103698392d0,[&](Foo const  & __a_rename_at_59_20) -> void{
+        Foo _temp_make_local_61_23_1; _temp_make_local_61_23_1;
+        DAS_ASSERT((__a_rename_at_59_20.v == 1));
+        passthroughFoo_6b1cddabfdef43e1(__context__,das_arg<Foo>::pass((([&]() -> Foo& {
+            das_copy((_temp_make_local_61_23_1.v),(2));
+            return _temp_make_local_61_23_1;
+        })())),das_make_block<void,Foo const  &>(__context__,224,0,&__func_info__b4f4f18f5bb5bb8b,[&](Foo const  & __b_rename_at_61_21) -> void{
+            Foo _temp_make_local_63_27_2; _temp_make_local_63_27_2;
+            DAS_ASSERT(((__a_rename_at_59_20.v == 1) && (__b_rename_at_61_21.v == 2)));
+            passthroughFoo_6b1cddabfdef43e1(__context__,das_arg<Foo>::pass((([&]() -> Foo& {
+                das_copy((_temp_make_local_63_27_2.v),(3));
+                return _temp_make_local_63_27_2;
+            })())),das_make_block<void,Foo const  &>(__context__,304,0,&__func_info__7f22cbbbbf6c0936,[&](Foo const  & __c_rename_at_63_22) -> void{
+                DAS_ASSERT((((__a_rename_at_59_20.v == 1) && (__b_rename_at_61_21.v == 2)) && (__c_rename_at_63_22.v == 3)));
+            }));
+        }));
+    }));
+    return das_auto_cast<bool>::cast(true);
+}}
+static vec4f __wrap_passthrough_35602bc0fa0c744d ( Context * __context__ ) {
+    int32_t arg_a = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((void,int32_t)) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((void,int32_t)) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    passthrough_35602bc0fa0c744d(__context__, arg_a, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap_passthroughref_f8bc90264357600a ( Context * __context__ ) {
+    int32_t const  & arg_a = cast_aot_arg<int32_t const  &>::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((void,int32_t const  &)) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((void,int32_t const  &)) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    passthroughref_f8bc90264357600a(__context__, arg_a, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap_passthroughptr_6fdf328e52a1ebe5 ( Context * __context__ ) {
+    int32_t * const  arg_a = cast_aot_arg<int32_t * const >::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((void,int32_t * const )) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((void,int32_t * const )) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    passthroughptr_6fdf328e52a1ebe5(__context__, arg_a, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap_passthroughFoo_6b1cddabfdef43e1 ( Context * __context__ ) {
+    Foo const  &  arg_a = cast_aot_arg<Foo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((void,Foo const )) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((void,Foo const )) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    passthroughFoo_6b1cddabfdef43e1(__context__, arg_a, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap_test_8f4a9b99911240f4 ( Context * __context__ ) {
+    return cast<bool>::from(test_8f4a9b99911240f4(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xe2c06b9b160c30c3, false, (void*)&passthrough_35602bc0fa0c744d, &__wrap_passthrough_35602bc0fa0c744d },
+    { 0xfd829955806da152, false, (void*)&passthroughref_f8bc90264357600a, &__wrap_passthroughref_f8bc90264357600a },
+    { 0xc4feb78f8a53cbfa, false, (void*)&passthroughptr_6fdf328e52a1ebe5, &__wrap_passthroughptr_6fdf328e52a1ebe5 },
+    { 0x1d09f5a0f3360ed5, false, (void*)&passthroughFoo_6b1cddabfdef43e1, &__wrap_passthroughFoo_6b1cddabfdef43e1 },
+    { 0xd17d441eed1e6c0b, false, (void*)&test_8f4a9b99911240f4, &__wrap_test_8f4a9b99911240f4 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_947146584153613507
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
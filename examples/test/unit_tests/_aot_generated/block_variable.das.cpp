@@ -0,0 +1,216 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_4817246011858976385 {
+
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+    int32_t a;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__411ed0e77075265a;
+extern TypeInfo __type_info__32fb9d473a58cef3;
+extern TypeInfo __type_info__af8afe4c86446b52;
+extern TypeInfo __type_info__bc69a005531fe739;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __struct_info__411ed0e77075265a_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xbcd691bb60c7d14c), "a", 0, 0 };
+VarInfo * __struct_info__411ed0e77075265a_fields[1] =  { &__struct_info__411ed0e77075265a_field_0 };
+StructInfo __struct_info__411ed0e77075265a = {"Foo", "", 0, __struct_info__411ed0e77075265a_fields, 1, 4, UINT64_C(0x0), nullptr, UINT64_C(0x411ed0e77075265a), 1 };
+VarInfo __func_info__1766085957d3021b_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x9c581507596aad8c), "x", 0, 0 };
+VarInfo * __func_info__1766085957d3021b_fields[1] =  { &__func_info__1766085957d3021b_field_0 };
+FuncInfo __func_info__1766085957d3021b = {"invoke block<(x:int const):Foo> const", "", __func_info__1766085957d3021b_fields, 1, 32, &__type_info__bc69a005531fe739, nullptr,0,UINT64_C(0x1766085957d3021b), 0x0 };
+VarInfo __func_info__b2ab30ecd5dcd22_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x9c581507596aad8c), "x", 0, 0 };
+VarInfo * __func_info__b2ab30ecd5dcd22_fields[1] =  { &__func_info__b2ab30ecd5dcd22_field_0 };
+FuncInfo __func_info__b2ab30ecd5dcd22 = {"invoke block<(x:int const):int> const", "", __func_info__b2ab30ecd5dcd22_fields, 1, 32, &__type_info__af63e44c8601fa24, nullptr,0,UINT64_C(0xb2ab30ecd5dcd22), 0x0 };
+VarInfo __func_info__32187064387df852_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x9c581507596aad8c), "x", 0, 0 };
+VarInfo * __func_info__32187064387df852_fields[1] =  { &__func_info__32187064387df852_field_0 };
+FuncInfo __func_info__32187064387df852 = {"invoke block<(x:int const):void> const", "", __func_info__32187064387df852_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x32187064387df852), 0x0 };
+FuncInfo __func_info__43ad68a5355c0a3c = {"invoke block<Foo const> const", "", nullptr, 0, 32, &__type_info__32fb9d473a58cef3, nullptr,0,UINT64_C(0x43ad68a5355c0a3c), 0x0 };
+FuncInfo __func_info__d427bf00e15116d5 = {"invoke block<int const> const", "", nullptr, 0, 32, &__type_info__af8afe4c86446b52, nullptr,0,UINT64_C(0xd427bf00e15116d5), 0x0 };
+FuncInfo __func_info__955909f57bd61177 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x955909f57bd61177), 0x0 };
+TypeInfo __type_info__32fb9d473a58cef3 = { Type::tStructure, &__struct_info__411ed0e77075265a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 62, 4, UINT64_C(0x32fb9d473a58cef3) };
+TypeInfo __type_info__af8afe4c86446b52 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf8afe4c86446b52) };
+TypeInfo __type_info__bc69a005531fe739 = { Type::tStructure, &__struct_info__411ed0e77075265a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 4, UINT64_C(0xbc69a005531fe739) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline bool test_fd35d891b2e4425f ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global<int32_t,0x9a28d6e6e29b4fd5>(__context__) = 0;/*g*/
+}
+
+inline bool test_fd35d891b2e4425f ( Context * __context__ ) { das_stack_prologue __prologue(__context__,768,"test " DAS_FILE_LINE);
+{
+    Foo __localVar_rename_at_11_0_ConstRef = ((Foo)(([&]() -> Foo {
+        Foo __mks_11;
+        das_copy((__mks_11.a),(34));
+        return __mks_11;
+    })()));
+    Foo const  & __localVar_rename_at_11_0 = __localVar_rename_at_11_0_ConstRef;
+;
+    auto __localVoidNoArgBlock_rename_at_12_1_TempFunctor = [&]() DAS_AOT_INLINE_LAMBDA -> void{
+        das_copy(das_global<int32_t,0x9a28d6e6e29b4fd5>(__context__) /*g*/,__localVar_rename_at_11_0.a);
+    };
+    auto __localVoidNoArgBlock_rename_at_12_1 = das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,__localVoidNoArgBlock_rename_at_12_1_TempFunctor);
+    das_copy(das_global<int32_t,0x9a28d6e6e29b4fd5>(__context__) /*g*/,0);
+    das_invoke<void>::invoke(__context__,nullptr,__localVoidNoArgBlock_rename_at_12_1);
+    DAS_ASSERT((das_global<int32_t,0x9a28d6e6e29b4fd5>(__context__) /*g*/ == __localVar_rename_at_11_0.a));
+    auto __localVoidArgBlock_rename_at_19_2_TempFunctor = [&](int32_t const  __x_rename_at_19_3) DAS_AOT_INLINE_LAMBDA -> void{
+        das_copy(das_global<int32_t,0x9a28d6e6e29b4fd5>(__context__) /*g*/,__localVar_rename_at_11_0.a + __x_rename_at_19_3);
+    };
+    auto __localVoidArgBlock_rename_at_19_2 = das_make_block<void,int32_t>(__context__,240,0,&__func_info__32187064387df852,__localVoidArgBlock_rename_at_19_2_TempFunctor);
+    das_copy(das_global<int32_t,0x9a28d6e6e29b4fd5>(__context__) /*g*/,0);
+    das_invoke<void>::invoke<int32_t>(__context__,nullptr,__localVoidArgBlock_rename_at_19_2,1);
+    DAS_ASSERT((das_global<int32_t,0x9a28d6e6e29b4fd5>(__context__) /*g*/ == (__localVar_rename_at_11_0.a + 1)));
+    auto __localResultNoArgBlock_rename_at_26_4_TempFunctor = [&]() DAS_AOT_INLINE_LAMBDA -> int32_t{
+        das_copy(das_global<int32_t,0x9a28d6e6e29b4fd5>(__context__) /*g*/,__localVar_rename_at_11_0.a);
+        return das_auto_cast<int32_t>::cast(__localVar_rename_at_11_0.a);
+    };
+    auto __localResultNoArgBlock_rename_at_26_4_ConstRef = (das_make_block<int32_t>(__context__,0,0,&__func_info__d427bf00e15116d5,__localResultNoArgBlock_rename_at_26_4_TempFunctor));
+    Block DAS_COMMENT((int32_t)) const  & __localResultNoArgBlock_rename_at_26_4 = __localResultNoArgBlock_rename_at_26_4_ConstRef;
+;
+    das_copy(das_global<int32_t,0x9a28d6e6e29b4fd5>(__context__) /*g*/,0);
+    int32_t __res1_rename_at_31_5 = ((int32_t)das_invoke<int32_t>::invoke(__context__,nullptr,__localResultNoArgBlock_rename_at_26_4));
+    DAS_ASSERT((das_global<int32_t,0x9a28d6e6e29b4fd5>(__context__) /*g*/ == __localVar_rename_at_11_0.a));
+    DAS_ASSERT((__res1_rename_at_31_5 == __localVar_rename_at_11_0.a));
+    auto __localResultArgBlock_rename_at_35_6_TempFunctor = [&](int32_t const  __x_rename_at_35_7) DAS_AOT_INLINE_LAMBDA -> int32_t{
+        das_copy(das_global<int32_t,0x9a28d6e6e29b4fd5>(__context__) /*g*/,__localVar_rename_at_11_0.a + __x_rename_at_35_7);
+        return das_auto_cast<int32_t>::cast(__localVar_rename_at_11_0.a + __x_rename_at_35_7);
+    };
+    auto __localResultArgBlock_rename_at_35_6_ConstRef = (das_make_block<int32_t,int32_t>(__context__,464,0,&__func_info__b2ab30ecd5dcd22,__localResultArgBlock_rename_at_35_6_TempFunctor));
+    Block DAS_COMMENT((int32_t,int32_t)) const  & __localResultArgBlock_rename_at_35_6 = __localResultArgBlock_rename_at_35_6_ConstRef;
+;
+    das_copy(das_global<int32_t,0x9a28d6e6e29b4fd5>(__context__) /*g*/,0);
+    int32_t __res2_rename_at_40_8 = ((int32_t)das_invoke<int32_t>::invoke<int32_t>(__context__,nullptr,__localResultArgBlock_rename_at_35_6,3));
+    DAS_ASSERT((das_global<int32_t,0x9a28d6e6e29b4fd5>(__context__) /*g*/ == (__localVar_rename_at_11_0.a + 3)));
+    DAS_ASSERT((__res2_rename_at_40_8 == (__localVar_rename_at_11_0.a + 3)));
+    auto __localCmresResultNoArgBlock_rename_at_44_9_TempFunctor = [&]() DAS_AOT_INLINE_LAMBDA -> Foo{
+        das_copy(das_global<int32_t,0x9a28d6e6e29b4fd5>(__context__) /*g*/,__localVar_rename_at_11_0.a);
+        return das_auto_cast_ref<Foo>::cast(__localVar_rename_at_11_0);
+    };
+    auto __localCmresResultNoArgBlock_rename_at_44_9_ConstRef = (das_make_block_cmres<Foo>(__context__,592,0,&__func_info__43ad68a5355c0a3c,__localCmresResultNoArgBlock_rename_at_44_9_TempFunctor));
+    Block DAS_COMMENT((Foo const )) const  & __localCmresResultNoArgBlock_rename_at_44_9 = __localCmresResultNoArgBlock_rename_at_44_9_ConstRef;
+;
+    das_copy(das_global<int32_t,0x9a28d6e6e29b4fd5>(__context__) /*g*/,0);
+    Foo __res3_rename_at_49_10_ConstRef = ((Foo)das_invoke<Foo>::invoke_cmres(__context__,nullptr,__localCmresResultNoArgBlock_rename_at_44_9));
+    Foo const  & __res3_rename_at_49_10 = __res3_rename_at_49_10_ConstRef;
+;
+    DAS_ASSERT((das_global<int32_t,0x9a28d6e6e29b4fd5>(__context__) /*g*/ == __localVar_rename_at_11_0.a));
+    DAS_ASSERT((__res3_rename_at_49_10.a == __localVar_rename_at_11_0.a));
+    auto __localCmresResultArgBlock_rename_at_53_11_TempFunctor = [&](int32_t const  __x_rename_at_53_12) DAS_AOT_INLINE_LAMBDA -> Foo{
+        das_copy(das_global<int32_t,0x9a28d6e6e29b4fd5>(__context__) /*g*/,__localVar_rename_at_11_0.a + __x_rename_at_53_12);
+        return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+            Foo __mks_55;
+            das_copy((__mks_55.a),((__localVar_rename_at_11_0.a + __x_rename_at_53_12)));
+            return __mks_55;
+        })()));
+    };
+    auto __localCmresResultArgBlock_rename_at_53_11_ConstRef = (das_make_block_cmres<Foo,int32_t>(__context__,720,0,&__func_info__1766085957d3021b,__localCmresResultArgBlock_rename_at_53_11_TempFunctor));
+    Block DAS_COMMENT((Foo,int32_t)) const  & __localCmresResultArgBlock_rename_at_53_11 = __localCmresResultArgBlock_rename_at_53_11_ConstRef;
+;
+    das_copy(das_global<int32_t,0x9a28d6e6e29b4fd5>(__context__) /*g*/,0);
+    Foo __res4_rename_at_58_13_ConstRef = ((Foo)das_invoke<Foo>::invoke_cmres<int32_t>(__context__,nullptr,__localCmresResultArgBlock_rename_at_53_11,3));
+    Foo const  & __res4_rename_at_58_13 = __res4_rename_at_58_13_ConstRef;
+;
+    DAS_ASSERT((das_global<int32_t,0x9a28d6e6e29b4fd5>(__context__) /*g*/ == (__localVar_rename_at_11_0.a + 3)));
+    DAS_ASSERT((__res4_rename_at_58_13.a == (__localVar_rename_at_11_0.a + 3)));
+    return das_auto_cast<bool>::cast(true);
+}}
+static vec4f __wrap_test_fd35d891b2e4425f ( Context * __context__ ) {
+    return cast<bool>::from(test_fd35d891b2e4425f(__context__));
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xf76fd7475b5679af, false, (void*)&test_fd35d891b2e4425f, &__wrap_test_fd35d891b2e4425f },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x261616ac5a36c187, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_4817246011858976385
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
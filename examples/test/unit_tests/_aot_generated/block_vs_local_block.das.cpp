@@ -0,0 +1,165 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_5119238690757034452 {
+
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+    int32_t a;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+}
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __func_info__a98b36f62ad0ad7e_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xc7d692fb11364696), "arg", 0, 0 };
+VarInfo * __func_info__a98b36f62ad0ad7e_fields[1] =  { &__func_info__a98b36f62ad0ad7e_field_0 };
+FuncInfo __func_info__a98b36f62ad0ad7e = {"invoke block<(arg:int const):void> const", "", __func_info__a98b36f62ad0ad7e_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xa98b36f62ad0ad7e), 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncTickraddTick1341458396870917698_8e996f7e4a126153 ( Context * __context__, int32_t __ext_rename_at_8_0, Block DAS_COMMENT((void,int32_t)) const  & __b_rename_at_8_1 );
+inline void testLocalBlockVar_3c67ee9af8f50e4f ( Context * __context__ );
+inline bool test_ef57a60a9f1cb30b ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global<int32_t,0x9a28d6e6e29b4fd5>(__context__) = 0;/*g*/
+}
+
+inline void _FuncTickraddTick1341458396870917698_8e996f7e4a126153 ( Context * __context__, int32_t __ext_rename_at_8_0, Block DAS_COMMENT((void,int32_t)) const  &  __b_rename_at_8_1 )
+{
+    das_invoke<void>::invoke<int32_t>(__context__,nullptr,__b_rename_at_8_1,__ext_rename_at_8_0);
+}
+
+inline void testLocalBlockVar_3c67ee9af8f50e4f ( Context * __context__ ) { das_stack_prologue __prologue(__context__,224,"testLocalBlockVar " DAS_FILE_LINE);
+{
+    Foo __localVar_rename_at_13_2_ConstRef = ((Foo)(([&]() -> Foo {
+        Foo __mks_13;
+        das_copy((__mks_13.a),(34));
+        return __mks_13;
+    })()));
+    Foo const  & __localVar_rename_at_13_2 = __localVar_rename_at_13_2_ConstRef;
+;
+    auto __localBlock_rename_at_14_3_TempFunctor = [&](int32_t const  __arg_rename_at_14_4) DAS_AOT_INLINE_LAMBDA -> void{
+        das_copy(das_global<int32_t,0x9a28d6e6e29b4fd5>(__context__) /*g*/,__localVar_rename_at_13_2.a + __arg_rename_at_14_4);
+    };
+    auto __localBlock_rename_at_14_3 = das_make_block<void,int32_t>(__context__,144,0,&__func_info__a98b36f62ad0ad7e,__localBlock_rename_at_14_3_TempFunctor);
+    das_copy(das_global<int32_t,0x9a28d6e6e29b4fd5>(__context__) /*g*/,0);
+    _FuncTickraddTick1341458396870917698_8e996f7e4a126153(__context__,100,das_make_block<void,int32_t>(__context__,208,0,&__func_info__a98b36f62ad0ad7e,[&](int32_t const  __arg_rename_at_18_5) -> void{
+        das_copy(das_global<int32_t,0x9a28d6e6e29b4fd5>(__context__) /*g*/,__localVar_rename_at_13_2.a + __arg_rename_at_18_5);
+    }));
+    DAS_ASSERT((das_global<int32_t,0x9a28d6e6e29b4fd5>(__context__) /*g*/ == 134));
+    das_copy(das_global<int32_t,0x9a28d6e6e29b4fd5>(__context__) /*g*/,0);
+    das_invoke<void>::invoke<int32_t>(__context__,nullptr,__localBlock_rename_at_14_3,100);
+    DAS_ASSERT((das_global<int32_t,0x9a28d6e6e29b4fd5>(__context__) /*g*/ == 134));
+}}
+
+inline bool test_ef57a60a9f1cb30b ( Context * __context__ )
+{
+    testLocalBlockVar_3c67ee9af8f50e4f(__context__);
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncTickraddTick1341458396870917698_8e996f7e4a126153 ( Context * __context__ ) {
+    int32_t arg_ext = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((void,int32_t)) const  &  arg_b = cast_aot_arg<Block DAS_COMMENT((void,int32_t)) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTickraddTick1341458396870917698_8e996f7e4a126153(__context__, arg_ext, arg_b);
+    return v_zero();
+}
+static vec4f __wrap_testLocalBlockVar_3c67ee9af8f50e4f ( Context * __context__ ) {
+    testLocalBlockVar_3c67ee9af8f50e4f(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_ef57a60a9f1cb30b ( Context * __context__ ) {
+    return cast<bool>::from(test_ef57a60a9f1cb30b(__context__));
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x4b6f6db7f23277df, false, (void*)&_FuncTickraddTick1341458396870917698_8e996f7e4a126153, &__wrap__FuncTickraddTick1341458396870917698_8e996f7e4a126153 },
+    { 0x17f549c114d09e45, false, (void*)&testLocalBlockVar_3c67ee9af8f50e4f, &__wrap_testLocalBlockVar_3c67ee9af8f50e4f },
+    { 0x43782500b6656fb, false, (void*)&test_ef57a60a9f1cb30b, &__wrap_test_ef57a60a9f1cb30b },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x261616ac5a36c187, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_5119238690757034452
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
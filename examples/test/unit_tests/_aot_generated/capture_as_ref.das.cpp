@@ -0,0 +1,290 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14308665435772037023 {
+
+namespace  { struct Foo; };
+namespace  { struct _lambda_thismodule_9_1; };
+namespace  {
+
+struct Foo {
+    void * __rtti;
+    Func DAS_COMMENT((void,Foo)) __finalize;
+    int32_t i;
+    TArray<int32_t> k;
+    Func DAS_COMMENT((Lambda DAS_COMMENT((int32_t)),Foo)) kaboom;
+};
+static_assert(sizeof(Foo)==56,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,i)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,k)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,kaboom)==48,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_9_1 {
+    Func DAS_COMMENT((int32_t,_lambda_thismodule_9_1)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_9_1 *)) __finalize;
+    Foo * self;
+};
+static_assert(sizeof(_lambda_thismodule_9_1)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_9_1,self)==16,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__411ed0e77075265a;
+extern StructInfo __struct_info__d0dbba7439e24618;
+extern TypeInfo __type_info__5c470b849cf304c7;
+extern TypeInfo __type_info__124e1d04d9af139d;
+extern TypeInfo __type_info__af8afe4c86446b52;
+extern TypeInfo __type_info__bc69a005531fe739;
+extern TypeInfo __type_info__418d1ceb21802ecd;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __struct_info__411ed0e77075265a_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x65bf5856bcd0f340), "__rtti", 0, 3 };
+TypeInfo * __type_info__55b35704030b0750_arg_types_var_4692417554209384026[1] = { &__type_info__bc69a005531fe739 };
+const char * __type_info__55b35704030b0750_arg_names_var_4692417554209384026[1] = { "self" };
+VarInfo __struct_info__411ed0e77075265a_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__55b35704030b0750_arg_types_var_4692417554209384026, __type_info__55b35704030b0750_arg_names_var_4692417554209384026, 1, 0, nullptr, 12, 8, UINT64_C(0x55b35704030b0750), "__finalize", 8, 0 };
+VarInfo __struct_info__411ed0e77075265a_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xbcd699bb60c7dee4), "i", 16, 0 };
+VarInfo __struct_info__411ed0e77075265a_field_3 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xbcd69bbb60c7e24a), "k", 24, 5 };
+VarInfo __struct_info__411ed0e77075265a_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__124e1d04d9af139d, nullptr, (TypeInfo **)__type_info__55b35704030b0750_arg_types_var_4692417554209384026, __type_info__55b35704030b0750_arg_names_var_4692417554209384026, 1, 0, nullptr, 12, 8, UINT64_C(0x941667c1129c8a95), "kaboom", 48, 0 };
+VarInfo * __struct_info__411ed0e77075265a_fields[5] =  { &__struct_info__411ed0e77075265a_field_0, &__struct_info__411ed0e77075265a_field_1, &__struct_info__411ed0e77075265a_field_2, &__struct_info__411ed0e77075265a_field_3, &__struct_info__411ed0e77075265a_field_4 };
+StructInfo __struct_info__411ed0e77075265a = {"Foo", "", 29, __struct_info__411ed0e77075265a_fields, 5, 56, UINT64_C(0x945b59082c003622), nullptr, UINT64_C(0x411ed0e77075265a), 0 };
+TypeInfo * __type_info__8148f815a3c1f00e_arg_types_var_15049827588138747416[1] = { &__type_info__418d1ceb21802ecd };
+const char * __type_info__8148f815a3c1f00e_arg_names_var_15049827588138747416[1] = { "__this" };
+VarInfo __struct_info__d0dbba7439e24618_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af8afe4c86446b52, nullptr, (TypeInfo **)__type_info__8148f815a3c1f00e_arg_types_var_15049827588138747416, __type_info__8148f815a3c1f00e_arg_names_var_15049827588138747416, 1, 0, nullptr, 12, 8, UINT64_C(0x8148f815a3c1f00e), "__lambda", 0, 0 };
+TypeInfo * __type_info__87ab4d30068249a8_arg_types_var_15049827588138747416[1] = { &__type_info__5c470b849cf304c7 };
+VarInfo __struct_info__d0dbba7439e24618_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__87ab4d30068249a8_arg_types_var_15049827588138747416, __type_info__8148f815a3c1f00e_arg_names_var_15049827588138747416, 1, 0, nullptr, 12, 8, UINT64_C(0x87ab4d30068249a8), "__finalize", 8, 0 };
+VarInfo __struct_info__d0dbba7439e24618_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bc69a005531fe739, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xb42a6fedd70808f0), "self", 16, 3 };
+VarInfo * __struct_info__d0dbba7439e24618_fields[3] =  { &__struct_info__d0dbba7439e24618_field_0, &__struct_info__d0dbba7439e24618_field_1, &__struct_info__d0dbba7439e24618_field_2 };
+StructInfo __struct_info__d0dbba7439e24618 = {"_lambda_thismodule_9_1", "", 14, __struct_info__d0dbba7439e24618_fields, 3, 24, UINT64_C(0x0), nullptr, UINT64_C(0xd0dbba7439e24618), 2 };
+TypeInfo __type_info__5c470b849cf304c7 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__418d1ceb21802ecd, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x5c470b849cf304c7) };
+TypeInfo __type_info__124e1d04d9af139d = { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24576, 8, UINT64_C(0x124e1d04d9af139d) };
+TypeInfo __type_info__af8afe4c86446b52 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf8afe4c86446b52) };
+TypeInfo __type_info__bc69a005531fe739 = { Type::tStructure, &__struct_info__411ed0e77075265a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 56, UINT64_C(0xbc69a005531fe739) };
+TypeInfo __type_info__418d1ceb21802ecd = { Type::tStructure, &__struct_info__d0dbba7439e24618, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 24, UINT64_C(0x418d1ceb21802ecd) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void finalize_3f63443e83eb7005 ( Context * __context__, _lambda_thismodule_9_1 & ____this_rename_at_9_0 );
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd ( Context * __context__, TArray<int32_t> & __a_rename_at_1336_1 );
+inline int32_t _Func_lambda_thismodule_9_1Tickfunction_ef87b09c78adb598 ( Context * __context__, _lambda_thismodule_9_1 & ____this_rename_at_9_2 );
+inline void _Func_lambda_thismodule_9_1Tickfinalizer_abf94d6b01984e00 ( Context * __context__, _lambda_thismodule_9_1 * ____this_rename_at_9_3 );
+inline void finalize_649258defe898065 ( Context * __context__, Foo & ____this_rename_at_2_4 );
+inline Foo Foo_b55f3ef8d1820ec4 ( Context * __context__ );
+inline void _FuncFooTickFoo_20b50a2f9644cc0b ( Context * __context__, Foo & __self_rename_at_5_6 );
+inline Lambda DAS_COMMENT((int32_t)) _FuncFooTickkaboom_bc4d8ccbabc0a0e3 ( Context * __context__, Foo & __self_rename_at_8_7 );
+inline void _FuncFoo_0x27___finalize_2a0f8fdc466db1d5 ( Context * __context__, Foo & __self_rename_at_2_9 );
+inline bool test_519ce2e7c81aa225 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void finalize_3f63443e83eb7005 ( Context * __context__, _lambda_thismodule_9_1 &  ____this_rename_at_9_0 )
+{
+    memset((void*)&(____this_rename_at_9_0), 0, 24);
+}
+
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd ( Context * __context__, TArray<int32_t> &  __a_rename_at_1336_1 )
+{
+    builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_1336_1),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline int32_t _Func_lambda_thismodule_9_1Tickfunction_ef87b09c78adb598 ( Context * __context__, _lambda_thismodule_9_1 &  ____this_rename_at_9_2 )
+{
+    return das_auto_cast<int32_t>::cast(das_deref(__context__,____this_rename_at_9_2.self,__FILE__,__LINE__).i++);
+}
+
+inline void _Func_lambda_thismodule_9_1Tickfinalizer_abf94d6b01984e00 ( Context * __context__, _lambda_thismodule_9_1 * ____this_rename_at_9_3 )
+{
+    finalize_3f63443e83eb7005(__context__,das_arg<_lambda_thismodule_9_1>::pass(das_deref(__context__,____this_rename_at_9_3,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_9_1 *>::clear(__context__,____this_rename_at_9_3);
+}
+
+inline void finalize_649258defe898065 ( Context * __context__, Foo &  ____this_rename_at_2_4 )
+{
+    _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_2_4.k));
+    memset((void*)&(____this_rename_at_2_4), 0, 56);
+}
+
+inline Foo Foo_b55f3ef8d1820ec4 ( Context * __context__ )
+{
+    Foo __self_rename_at_5_5; das_zero(__self_rename_at_5_5); das_move(__self_rename_at_5_5, (([&]() -> Foo {
+        Foo __mks_5;
+        das_zero(__mks_5);
+        das_copy((__mks_5.__rtti),(((void *)(&__type_info__bc69a005531fe739))));
+        das_copy((__mks_5.__finalize),(Func(__context__->fnByMangledName(/*Foo'__finalize S<Foo>*/ 0xa576fb7af95b22e8))));
+        das_copy((__mks_5.kaboom),(Func(__context__->fnByMangledName(/*Foo`kaboom S<Foo>*/ 0x9d4a3f5af47a1c61))));
+        return __mks_5;
+    })()));
+    _FuncFooTickFoo_20b50a2f9644cc0b(__context__,das_arg<Foo>::pass(__self_rename_at_5_5));
+    return /* <- */ das_auto_cast_move<Foo>::cast(__self_rename_at_5_5);
+}
+
+inline void _FuncFooTickFoo_20b50a2f9644cc0b ( Context * __context__, Foo &  __self_rename_at_5_6 )
+{
+    das_copy(__self_rename_at_5_6.i,5);
+}
+
+inline Lambda DAS_COMMENT((int32_t)) _FuncFooTickkaboom_bc4d8ccbabc0a0e3 ( Context * __context__, Foo &  __self_rename_at_8_7 )
+{
+    Lambda DAS_COMMENT((int32_t)) __counter_rename_at_9_8; das_zero(__counter_rename_at_9_8); das_move(__counter_rename_at_9_8, das_ascend<int32_t,_lambda_thismodule_9_1>::make(__context__,&__type_info__418d1ceb21802ecd,(([&]() -> _lambda_thismodule_9_1 {
+        _lambda_thismodule_9_1 __mks_9;
+        das_copy((__mks_9.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_9_1`function XS<_lambda_thismodule_9_1>*/ 0xb0a792697039055d))));
+        das_copy((__mks_9.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_9_1`finalizer X1<S<_lambda_thismodule_9_1>>?*/ 0x6ff236f85213e250))));
+        das_copy((__mks_9.self),(das_ref(__context__,__self_rename_at_8_7)));
+        return __mks_9;
+    })())));
+    return /* <- */ das_auto_cast_move<Lambda DAS_COMMENT((int32_t))>::cast(__counter_rename_at_9_8);
+}
+
+inline void _FuncFoo_0x27___finalize_2a0f8fdc466db1d5 ( Context * __context__, Foo &  __self_rename_at_2_9 )
+{
+    finalize_649258defe898065(__context__,das_arg<Foo>::pass(__self_rename_at_2_9));
+}
+
+inline bool test_519ce2e7c81aa225 ( Context * __context__ )
+{
+    Foo * __x_rename_at_18_10 = das_new<Foo>::make_and_init(__context__,[&]() { return Foo_b55f3ef8d1820ec4(__context__); });
+    Lambda DAS_COMMENT((int32_t)) __boom_rename_at_19_11; das_zero(__boom_rename_at_19_11); das_move(__boom_rename_at_19_11, ((Lambda DAS_COMMENT((int32_t)))das_invoke_method<Lambda DAS_COMMENT((int32_t)),48/*kaboom*/>::invoke<Foo &>(__context__,nullptr,das_arg<Foo>::pass(das_cast<Foo>::cast(das_deref(__context__,__x_rename_at_18_10,__FILE__,__LINE__))))));
+    DAS_ASSERT((__x_rename_at_18_10->i == 5));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_finalize_3f63443e83eb7005 ( Context * __context__ ) {
+    _lambda_thismodule_9_1 &  arg___this = cast_aot_arg<_lambda_thismodule_9_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_3f63443e83eb7005(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_9_1Tickfunction_ef87b09c78adb598 ( Context * __context__ ) {
+    _lambda_thismodule_9_1 &  arg___this = cast_aot_arg<_lambda_thismodule_9_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(_Func_lambda_thismodule_9_1Tickfunction_ef87b09c78adb598(__context__, arg___this));
+}
+static vec4f __wrap__Func_lambda_thismodule_9_1Tickfinalizer_abf94d6b01984e00 ( Context * __context__ ) {
+    _lambda_thismodule_9_1 * arg___this = cast_aot_arg<_lambda_thismodule_9_1 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_9_1Tickfinalizer_abf94d6b01984e00(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_649258defe898065 ( Context * __context__ ) {
+    Foo &  arg___this = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_649258defe898065(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_Foo_b55f3ef8d1820ec4 ( Context * __context__ ) {
+    *((Foo *) __context__->abiCMRES) = Foo_b55f3ef8d1820ec4(__context__);
+    return v_zero();
+}
+static vec4f __wrap__FuncFooTickFoo_20b50a2f9644cc0b ( Context * __context__ ) {
+    Foo &  arg_self = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncFooTickFoo_20b50a2f9644cc0b(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap__FuncFooTickkaboom_bc4d8ccbabc0a0e3 ( Context * __context__ ) {
+    Foo &  arg_self = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<Lambda DAS_COMMENT((int32_t))>::from(_FuncFooTickkaboom_bc4d8ccbabc0a0e3(__context__, arg_self));
+}
+static vec4f __wrap__FuncFoo_0x27___finalize_2a0f8fdc466db1d5 ( Context * __context__ ) {
+    Foo &  arg_self = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncFoo_0x27___finalize_2a0f8fdc466db1d5(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap_test_519ce2e7c81aa225 ( Context * __context__ ) {
+    return cast<bool>::from(test_519ce2e7c81aa225(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x85eea3d11d1310bb, false, (void*)&finalize_3f63443e83eb7005, &__wrap_finalize_3f63443e83eb7005 },
+    { 0x84908fa671ce3a30, false, (void*)&_FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd, &__wrap__FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd },
+    { 0x73a5daa1df8be246, false, (void*)&_Func_lambda_thismodule_9_1Tickfunction_ef87b09c78adb598, &__wrap__Func_lambda_thismodule_9_1Tickfunction_ef87b09c78adb598 },
+    { 0x4131c1ff684db458, false, (void*)&_Func_lambda_thismodule_9_1Tickfinalizer_abf94d6b01984e00, &__wrap__Func_lambda_thismodule_9_1Tickfinalizer_abf94d6b01984e00 },
+    { 0xc399943e80193a0f, false, (void*)&finalize_649258defe898065, &__wrap_finalize_649258defe898065 },
+    { 0xde9e5bb9bc8d7723, true, (void*)&Foo_b55f3ef8d1820ec4, &__wrap_Foo_b55f3ef8d1820ec4 },
+    { 0xfe862a20cc223572, false, (void*)&_FuncFooTickFoo_20b50a2f9644cc0b, &__wrap__FuncFooTickFoo_20b50a2f9644cc0b },
+    { 0xdbcca32b02832101, false, (void*)&_FuncFooTickkaboom_bc4d8ccbabc0a0e3, &__wrap__FuncFooTickkaboom_bc4d8ccbabc0a0e3 },
+    { 0x3377cd73fa560a31, false, (void*)&_FuncFoo_0x27___finalize_2a0f8fdc466db1d5, &__wrap__FuncFoo_0x27___finalize_2a0f8fdc466db1d5 },
+    { 0xf6b837a9cc39c58a, false, (void*)&test_519ce2e7c81aa225, &__wrap_test_519ce2e7c81aa225 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_14308665435772037023
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,327 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_6416120075185799679 {
+
+namespace  { struct Foo; };
+namespace  { struct Foo3D; };
+namespace  { struct FooVision; };
+namespace  { struct Int2Float; };
+namespace  { struct Float2Int; };
+namespace  {
+
+struct Foo {
+    int32_t x;
+    int32_t y;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,y)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Foo3D {
+    int32_t x;
+    int32_t y;
+    int32_t z;
+};
+static_assert(sizeof(Foo3D)==12,"structure size mismatch with DAS");
+static_assert(offsetof(Foo3D,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,z)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct FooVision {
+    Foo3D f3d;
+    float4 color;
+};
+static_assert(sizeof(FooVision)==28,"structure size mismatch with DAS");
+static_assert(offsetof(FooVision,f3d)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(FooVision,color)==12,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Int2Float {
+    uint32_t iv;
+    float fv;
+};
+static_assert(sizeof(Int2Float)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Int2Float,iv)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Int2Float,fv)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Float2Int {
+    float fv;
+    uint32_t iv;
+};
+static_assert(sizeof(Float2Int)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Float2Int,fv)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Float2Int,iv)==4,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncTicksetFooGenericTick12042514288649396992_f0dfde61e1a06263 ( Context * __context__, Foo & __foo_rename_at_17_0, int32_t __x_rename_at_17_1, int32_t __y_rename_at_17_2 );
+inline void _FuncTicksetFooGenericTick12042514288649396992_49bf70c973f8e996 ( Context * __context__, Foo3D & __foo_rename_at_17_3, int32_t __x_rename_at_17_4, int32_t __y_rename_at_17_5 );
+inline void _FuncTicksetFooGenericTick12042514288649396992_58253a0fb5fbf799 ( Context * __context__, Foo * __foo_rename_at_17_6, int32_t __x_rename_at_17_7, int32_t __y_rename_at_17_8 );
+inline void _FuncTicksetFooGenericTick12042514288649396992_6c9ab7ecd1a7a46f ( Context * __context__, Foo3D * __foo_rename_at_17_9, int32_t __x_rename_at_17_10, int32_t __y_rename_at_17_11 );
+inline void setFoo_93645bb09c4f6ea ( Context * __context__, Foo & __foo_rename_at_22_12, int32_t __x_rename_at_22_13, int32_t __y_rename_at_22_14 );
+inline void setFooPtr_7ba3bd369901515 ( Context * __context__, Foo * __foo_rename_at_27_15, int32_t __x_rename_at_27_16, int32_t __y_rename_at_27_17 );
+inline bool test_struct_98a3185cf9758d68 ( Context * __context__ );
+inline void test_ptr_181b948c3cbc06fd ( Context * __context__ );
+inline bool test_reinterpret_36a5efdb3f1bcaa0 ( Context * __context__ );
+inline bool test_23b3c07f513e6981 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncTicksetFooGenericTick12042514288649396992_f0dfde61e1a06263 ( Context * __context__, Foo &  __foo_rename_at_17_0, int32_t __x_rename_at_17_1, int32_t __y_rename_at_17_2 )
+{
+    das_copy(__foo_rename_at_17_0.x,__x_rename_at_17_1);
+    das_copy(__foo_rename_at_17_0.y,__y_rename_at_17_2);
+}
+
+inline void _FuncTicksetFooGenericTick12042514288649396992_49bf70c973f8e996 ( Context * __context__, Foo3D &  __foo_rename_at_17_3, int32_t __x_rename_at_17_4, int32_t __y_rename_at_17_5 )
+{
+    das_copy(__foo_rename_at_17_3.x,__x_rename_at_17_4);
+    das_copy(__foo_rename_at_17_3.y,__y_rename_at_17_5);
+}
+
+inline void _FuncTicksetFooGenericTick12042514288649396992_58253a0fb5fbf799 ( Context * __context__, Foo * __foo_rename_at_17_6, int32_t __x_rename_at_17_7, int32_t __y_rename_at_17_8 )
+{
+    das_copy(__foo_rename_at_17_6->x,__x_rename_at_17_7);
+    das_copy(__foo_rename_at_17_6->y,__y_rename_at_17_8);
+}
+
+inline void _FuncTicksetFooGenericTick12042514288649396992_6c9ab7ecd1a7a46f ( Context * __context__, Foo3D * __foo_rename_at_17_9, int32_t __x_rename_at_17_10, int32_t __y_rename_at_17_11 )
+{
+    das_copy(__foo_rename_at_17_9->x,__x_rename_at_17_10);
+    das_copy(__foo_rename_at_17_9->y,__y_rename_at_17_11);
+}
+
+inline void setFoo_93645bb09c4f6ea ( Context * __context__, Foo &  __foo_rename_at_22_12, int32_t __x_rename_at_22_13, int32_t __y_rename_at_22_14 )
+{
+    das_copy(__foo_rename_at_22_12.x,__x_rename_at_22_13);
+    das_copy(__foo_rename_at_22_12.y,__y_rename_at_22_14);
+}
+
+inline void setFooPtr_7ba3bd369901515 ( Context * __context__, Foo * __foo_rename_at_27_15, int32_t __x_rename_at_27_16, int32_t __y_rename_at_27_17 )
+{
+    das_copy(__foo_rename_at_27_15->x,__x_rename_at_27_16);
+    das_copy(__foo_rename_at_27_15->y,__y_rename_at_27_17);
+}
+
+inline bool test_struct_98a3185cf9758d68 ( Context * __context__ )
+{
+    Foo __f_rename_at_34_18;das_zero(__f_rename_at_34_18);
+    Foo3D __f3d_rename_at_35_19;das_zero(__f3d_rename_at_35_19);
+    DAS_ASSERT(((__f_rename_at_34_18.x == 0) && (__f_rename_at_34_18.y == 0)));
+    DAS_ASSERT(((__f3d_rename_at_35_19.x == 0) && (__f3d_rename_at_35_19.y == 0)));
+    _FuncTicksetFooGenericTick12042514288649396992_f0dfde61e1a06263(__context__,das_arg<Foo>::pass(__f_rename_at_34_18),1,2);
+    _FuncTicksetFooGenericTick12042514288649396992_49bf70c973f8e996(__context__,das_arg<Foo3D>::pass(__f3d_rename_at_35_19),1,2);
+    DAS_ASSERT(((__f_rename_at_34_18.x == 1) && (__f_rename_at_34_18.y == 2)));
+    DAS_ASSERT(((__f3d_rename_at_35_19.x == 1) && (__f3d_rename_at_35_19.y == 2)));
+    setFoo_93645bb09c4f6ea(__context__,das_arg<Foo>::pass(__f_rename_at_34_18),3,4);
+    setFoo_93645bb09c4f6ea(__context__,das_arg<Foo>::pass(das_cast<Foo>::cast(__f3d_rename_at_35_19)),3,4);
+    DAS_ASSERT(((__f_rename_at_34_18.x == 3) && (__f_rename_at_34_18.y == 4)));
+    DAS_ASSERT(((__f3d_rename_at_35_19.x == 3) && (__f3d_rename_at_35_19.y == 4)));
+    das_copy(das_cast<Foo>::cast(__f3d_rename_at_35_19).y,5);
+    DAS_ASSERT((__f3d_rename_at_35_19.y == 5));
+    FooVision __fv_rename_at_48_20;das_zero(__fv_rename_at_48_20);
+    das_copy(das_cast<Foo>::cast(__fv_rename_at_48_20.f3d).y,13);
+    DAS_ASSERT((das_cast<Foo>::cast(__fv_rename_at_48_20.f3d).y == 13));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline void test_ptr_181b948c3cbc06fd ( Context * __context__ )
+{
+    Foo * __f_rename_at_56_21 = das_new<Foo>::make(__context__);
+    Foo3D * __f3d_rename_at_57_22 = das_new<Foo3D>::make(__context__);
+    DAS_ASSERT(((__f_rename_at_56_21->x == 0) && (__f_rename_at_56_21->y == 0)));
+    DAS_ASSERT(((__f3d_rename_at_57_22->x == 0) && (__f3d_rename_at_57_22->y == 0)));
+    _FuncTicksetFooGenericTick12042514288649396992_58253a0fb5fbf799(__context__,__f_rename_at_56_21,1,2);
+    _FuncTicksetFooGenericTick12042514288649396992_6c9ab7ecd1a7a46f(__context__,__f3d_rename_at_57_22,1,2);
+    DAS_ASSERT(((__f_rename_at_56_21->x == 1) && (__f_rename_at_56_21->y == 2)));
+    DAS_ASSERT(((__f3d_rename_at_57_22->x == 1) && (__f3d_rename_at_57_22->y == 2)));
+    setFooPtr_7ba3bd369901515(__context__,__f_rename_at_56_21,3,4);
+    setFooPtr_7ba3bd369901515(__context__,das_cast<Foo *>::cast(__f3d_rename_at_57_22),3,4);
+    DAS_ASSERT(((__f_rename_at_56_21->x == 3) && (__f_rename_at_56_21->y == 4)));
+    DAS_ASSERT(((__f3d_rename_at_57_22->x == 3) && (__f3d_rename_at_57_22->y == 4)));
+    das_copy(das_cast<Foo *>::cast(__f3d_rename_at_57_22)->y,5);
+    DAS_ASSERT((__f3d_rename_at_57_22->y == 5));
+    FooVision * __fv_rename_at_70_23 = das_new<FooVision>::make(__context__);
+    das_copy(das_cast<Foo>::cast(__fv_rename_at_70_23->f3d).y,13);
+    DAS_ASSERT((das_cast<Foo>::cast(__fv_rename_at_70_23->f3d).y == 13));
+}
+
+inline bool test_reinterpret_36a5efdb3f1bcaa0 ( Context * __context__ )
+{
+    Int2Float __f2i_rename_at_87_24_ConstRef = ((Int2Float)(([&]() -> Int2Float {
+        Int2Float __mks_87;
+        das_copy((__mks_87.iv),(0x3f400000u));
+        das_copy((__mks_87.fv),(1.000000e+00f));
+        return __mks_87;
+    })()));
+    Int2Float const  & __f2i_rename_at_87_24 = __f2i_rename_at_87_24_ConstRef;
+;
+    Float2Int __i2f_rename_at_89_25_ConstRef = ((Float2Int)das_cast<Float2Int>::cast(__f2i_rename_at_87_24));
+    Float2Int const  & __i2f_rename_at_89_25 = __i2f_rename_at_89_25_ConstRef;
+;
+    DAS_ASSERT(((__i2f_rename_at_89_25.fv == 7.500000e-01f) && (__i2f_rename_at_89_25.iv == 0x3f800000u)));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline bool test_23b3c07f513e6981 ( Context * __context__ )
+{
+    test_struct_98a3185cf9758d68(__context__);
+    test_ptr_181b948c3cbc06fd(__context__);
+    test_reinterpret_36a5efdb3f1bcaa0(__context__);
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncTicksetFooGenericTick12042514288649396992_f0dfde61e1a06263 ( Context * __context__ ) {
+    Foo &  arg_foo = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_y = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    _FuncTicksetFooGenericTick12042514288649396992_f0dfde61e1a06263(__context__, arg_foo, arg_x, arg_y);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicksetFooGenericTick12042514288649396992_49bf70c973f8e996 ( Context * __context__ ) {
+    Foo3D &  arg_foo = cast_aot_arg<Foo3D & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_y = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    _FuncTicksetFooGenericTick12042514288649396992_49bf70c973f8e996(__context__, arg_foo, arg_x, arg_y);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicksetFooGenericTick12042514288649396992_58253a0fb5fbf799 ( Context * __context__ ) {
+    Foo * arg_foo = cast_aot_arg<Foo *>::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_y = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    _FuncTicksetFooGenericTick12042514288649396992_58253a0fb5fbf799(__context__, arg_foo, arg_x, arg_y);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicksetFooGenericTick12042514288649396992_6c9ab7ecd1a7a46f ( Context * __context__ ) {
+    Foo3D * arg_foo = cast_aot_arg<Foo3D *>::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_y = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    _FuncTicksetFooGenericTick12042514288649396992_6c9ab7ecd1a7a46f(__context__, arg_foo, arg_x, arg_y);
+    return v_zero();
+}
+static vec4f __wrap_setFoo_93645bb09c4f6ea ( Context * __context__ ) {
+    Foo &  arg_foo = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_y = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    setFoo_93645bb09c4f6ea(__context__, arg_foo, arg_x, arg_y);
+    return v_zero();
+}
+static vec4f __wrap_setFooPtr_7ba3bd369901515 ( Context * __context__ ) {
+    Foo * arg_foo = cast_aot_arg<Foo *>::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_y = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    setFooPtr_7ba3bd369901515(__context__, arg_foo, arg_x, arg_y);
+    return v_zero();
+}
+static vec4f __wrap_test_struct_98a3185cf9758d68 ( Context * __context__ ) {
+    return cast<bool>::from(test_struct_98a3185cf9758d68(__context__));
+}
+static vec4f __wrap_test_ptr_181b948c3cbc06fd ( Context * __context__ ) {
+    test_ptr_181b948c3cbc06fd(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_reinterpret_36a5efdb3f1bcaa0 ( Context * __context__ ) {
+    return cast<bool>::from(test_reinterpret_36a5efdb3f1bcaa0(__context__));
+}
+static vec4f __wrap_test_23b3c07f513e6981 ( Context * __context__ ) {
+    return cast<bool>::from(test_23b3c07f513e6981(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x29a137ff4569b25f, false, (void*)&_FuncTicksetFooGenericTick12042514288649396992_f0dfde61e1a06263, &__wrap__FuncTicksetFooGenericTick12042514288649396992_f0dfde61e1a06263 },
+    { 0x38cec8bfb0fed5bf, false, (void*)&_FuncTicksetFooGenericTick12042514288649396992_49bf70c973f8e996, &__wrap__FuncTicksetFooGenericTick12042514288649396992_49bf70c973f8e996 },
+    { 0x5771349265c05d35, false, (void*)&_FuncTicksetFooGenericTick12042514288649396992_58253a0fb5fbf799, &__wrap__FuncTicksetFooGenericTick12042514288649396992_58253a0fb5fbf799 },
+    { 0x6f967bf6247153b9, false, (void*)&_FuncTicksetFooGenericTick12042514288649396992_6c9ab7ecd1a7a46f, &__wrap__FuncTicksetFooGenericTick12042514288649396992_6c9ab7ecd1a7a46f },
+    { 0x64bba06c0c84c75d, false, (void*)&setFoo_93645bb09c4f6ea, &__wrap_setFoo_93645bb09c4f6ea },
+    { 0xc73153677f7b778e, false, (void*)&setFooPtr_7ba3bd369901515, &__wrap_setFooPtr_7ba3bd369901515 },
+    { 0xbfa8d8cfae335549, false, (void*)&test_struct_98a3185cf9758d68, &__wrap_test_struct_98a3185cf9758d68 },
+    { 0xd616e542dec6ab0e, false, (void*)&test_ptr_181b948c3cbc06fd, &__wrap_test_ptr_181b948c3cbc06fd },
+    { 0xd4f2cfc3108e9260, false, (void*)&test_reinterpret_36a5efdb3f1bcaa0, &__wrap_test_reinterpret_36a5efdb3f1bcaa0 },
+    { 0x3c1a40a378f0cdc1, false, (void*)&test_23b3c07f513e6981, &__wrap_test_23b3c07f513e6981 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_6416120075185799679
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
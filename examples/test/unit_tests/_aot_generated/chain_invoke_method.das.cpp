@@ -0,0 +1,224 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_2719023608469653660 {
+
+namespace  { struct MyString; };
+namespace  {
+
+struct MyString {
+    void * __rtti;
+    Func DAS_COMMENT((void,MyString)) __finalize;
+    Func DAS_COMMENT((MyString *,MyString)) to_upper;
+    Func DAS_COMMENT((MyString *,MyString)) utf8;
+};
+static_assert(sizeof(MyString)==32,"structure size mismatch with DAS");
+static_assert(offsetof(MyString,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(MyString,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(MyString,to_upper)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(MyString,utf8)==24,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__46b35b373664ce7d;
+extern TypeInfo __type_info__632697be1a0d7902;
+extern TypeInfo __type_info__bb5c7ef8c2627fc4;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __struct_info__46b35b373664ce7d_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xd402217a7e19f0ac), "__rtti", 0, 4 };
+TypeInfo * __type_info__fd8969f7e0ef0ad3_arg_types_var_5094515896180067965[1] = { &__type_info__bb5c7ef8c2627fc4 };
+const char * __type_info__fd8969f7e0ef0ad3_arg_names_var_5094515896180067965[1] = { "self" };
+VarInfo __struct_info__46b35b373664ce7d_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__fd8969f7e0ef0ad3_arg_types_var_5094515896180067965, __type_info__fd8969f7e0ef0ad3_arg_names_var_5094515896180067965, 1, 0, nullptr, 12, 8, UINT64_C(0xfd8969f7e0ef0ad3), "__finalize", 8, 0 };
+VarInfo __struct_info__46b35b373664ce7d_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__632697be1a0d7902, nullptr, (TypeInfo **)__type_info__fd8969f7e0ef0ad3_arg_types_var_5094515896180067965, __type_info__fd8969f7e0ef0ad3_arg_names_var_5094515896180067965, 1, 0, nullptr, 12, 8, UINT64_C(0xc42880868cd6bb54), "to_upper", 16, 0 };
+VarInfo __struct_info__46b35b373664ce7d_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__632697be1a0d7902, nullptr, (TypeInfo **)__type_info__fd8969f7e0ef0ad3_arg_types_var_5094515896180067965, __type_info__fd8969f7e0ef0ad3_arg_names_var_5094515896180067965, 1, 0, nullptr, 12, 8, UINT64_C(0x3bcc8ee0b2d6f5da), "utf8", 24, 0 };
+VarInfo * __struct_info__46b35b373664ce7d_fields[4] =  { &__struct_info__46b35b373664ce7d_field_0, &__struct_info__46b35b373664ce7d_field_1, &__struct_info__46b35b373664ce7d_field_2, &__struct_info__46b35b373664ce7d_field_3 };
+StructInfo __struct_info__46b35b373664ce7d = {"MyString", "", 13, __struct_info__46b35b373664ce7d_fields, 4, 32, UINT64_C(0x5e6413a9d4d50715), nullptr, UINT64_C(0x46b35b373664ce7d), 0 };
+TypeInfo __type_info__632697be1a0d7902 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bb5c7ef8c2627fc4, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x632697be1a0d7902) };
+TypeInfo __type_info__bb5c7ef8c2627fc4 = { Type::tStructure, &__struct_info__46b35b373664ce7d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 32, UINT64_C(0xbb5c7ef8c2627fc4) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void finalize_4a1c088a64670512 ( Context * __context__, MyString & ____this_rename_at_6_0 );
+inline MyString MyString_abd2ff560b27faf ( Context * __context__ );
+inline void _FuncMyStringTickMyString_50a4c3a8a54c339f ( Context * __context__, MyString & __self_rename_at_7_2 );
+inline MyString * _FuncMyStringTickto_upper_54a45a2a92e327f8 ( Context * __context__, MyString & __self_rename_at_10_3 );
+inline MyString * _FuncMyStringTickutf8_3fbbc3863a593951 ( Context * __context__, MyString & __self_rename_at_14_4 );
+inline void _FuncMyString_0x27___finalize_1b4dc71a0ee82a4c ( Context * __context__, MyString & __self_rename_at_6_5 );
+inline bool test_995ada17f0a19b45 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global<int32_t,0x96b95f81f42fe34b>(__context__) = 0;/*ctor_count*/
+    das_global<int32_t,0x6f19b8d0d5582067>(__context__) = 0;/*to_upper_count*/
+    das_global<int32_t,0xa518a4821b462f5e>(__context__) = 0;/*utf8_count*/
+}
+
+inline void finalize_4a1c088a64670512 ( Context * __context__, MyString &  ____this_rename_at_6_0 )
+{
+    memset((void*)&(____this_rename_at_6_0), 0, 32);
+}
+
+inline MyString MyString_abd2ff560b27faf ( Context * __context__ )
+{
+    MyString __self_rename_at_7_1; das_zero(__self_rename_at_7_1); das_move(__self_rename_at_7_1, (([&]() -> MyString {
+        MyString __mks_7;
+        das_copy((__mks_7.__rtti),(((void *)(&__type_info__bb5c7ef8c2627fc4))));
+        das_copy((__mks_7.__finalize),(Func(__context__->fnByMangledName(/*MyString'__finalize S<MyString>*/ 0x9d42abeed4fdace6))));
+        das_copy((__mks_7.to_upper),(Func(__context__->fnByMangledName(/*MyString`to_upper S<MyString>*/ 0x47c412c7583aa37c))));
+        das_copy((__mks_7.utf8),(Func(__context__->fnByMangledName(/*MyString`utf8 S<MyString>*/ 0x846733b8f0fae05e))));
+        return __mks_7;
+    })()));
+    _FuncMyStringTickMyString_50a4c3a8a54c339f(__context__,das_arg<MyString>::pass(__self_rename_at_7_1));
+    return /* <- */ das_auto_cast_move<MyString>::cast(__self_rename_at_7_1);
+}
+
+inline void _FuncMyStringTickMyString_50a4c3a8a54c339f ( Context * __context__, MyString &  __self_rename_at_7_2 )
+{
+    ++das_global<int32_t,0x96b95f81f42fe34b>(__context__) /*ctor_count*/;
+}
+
+inline MyString * _FuncMyStringTickto_upper_54a45a2a92e327f8 ( Context * __context__, MyString &  __self_rename_at_10_3 )
+{
+    ++das_global<int32_t,0x6f19b8d0d5582067>(__context__) /*to_upper_count*/;
+    return das_auto_cast<MyString *>::cast(das_ref(__context__,__self_rename_at_10_3));
+}
+
+inline MyString * _FuncMyStringTickutf8_3fbbc3863a593951 ( Context * __context__, MyString &  __self_rename_at_14_4 )
+{
+    ++das_global<int32_t,0xa518a4821b462f5e>(__context__) /*utf8_count*/;
+    return das_auto_cast<MyString *>::cast(das_ref(__context__,__self_rename_at_14_4));
+}
+
+inline void _FuncMyString_0x27___finalize_1b4dc71a0ee82a4c ( Context * __context__, MyString &  __self_rename_at_6_5 )
+{
+    finalize_4a1c088a64670512(__context__,das_arg<MyString>::pass(__self_rename_at_6_5));
+}
+
+inline bool test_995ada17f0a19b45 ( Context * __context__ )
+{
+    MyString * __res_rename_at_22_6 = ((MyString *)das_invoke_method<MyString *,24/*utf8*/>::invoke<MyString &>(__context__,nullptr,das_arg<MyString>::pass(das_cast<MyString>::cast(das_deref(__context__,das_invoke_method<MyString *,16/*to_upper*/>::invoke<MyString &>(__context__,nullptr,das_arg<MyString>::pass(das_cast<MyString>::cast(das_deref(__context__,das_new<MyString>::make_and_init(__context__,[&]() { return MyString_abd2ff560b27faf(__context__); }),__FILE__,__LINE__)))),__FILE__,__LINE__)))));
+    DAS_ASSERT((das_global<int32_t,0x96b95f81f42fe34b>(__context__) /*ctor_count*/ == 1));
+    DAS_ASSERT((das_global<int32_t,0x6f19b8d0d5582067>(__context__) /*to_upper_count*/ == 1));
+    DAS_ASSERT((das_global<int32_t,0xa518a4821b462f5e>(__context__) /*utf8_count*/ == 1));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_finalize_4a1c088a64670512 ( Context * __context__ ) {
+    MyString &  arg___this = cast_aot_arg<MyString & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_4a1c088a64670512(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_MyString_abd2ff560b27faf ( Context * __context__ ) {
+    *((MyString *) __context__->abiCMRES) = MyString_abd2ff560b27faf(__context__);
+    return v_zero();
+}
+static vec4f __wrap__FuncMyStringTickMyString_50a4c3a8a54c339f ( Context * __context__ ) {
+    MyString &  arg_self = cast_aot_arg<MyString & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncMyStringTickMyString_50a4c3a8a54c339f(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap__FuncMyStringTickto_upper_54a45a2a92e327f8 ( Context * __context__ ) {
+    MyString &  arg_self = cast_aot_arg<MyString & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<MyString *>::from(_FuncMyStringTickto_upper_54a45a2a92e327f8(__context__, arg_self));
+}
+static vec4f __wrap__FuncMyStringTickutf8_3fbbc3863a593951 ( Context * __context__ ) {
+    MyString &  arg_self = cast_aot_arg<MyString & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<MyString *>::from(_FuncMyStringTickutf8_3fbbc3863a593951(__context__, arg_self));
+}
+static vec4f __wrap__FuncMyString_0x27___finalize_1b4dc71a0ee82a4c ( Context * __context__ ) {
+    MyString &  arg_self = cast_aot_arg<MyString & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncMyString_0x27___finalize_1b4dc71a0ee82a4c(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap_test_995ada17f0a19b45 ( Context * __context__ ) {
+    return cast<bool>::from(test_995ada17f0a19b45(__context__));
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x37219cde08a93db7, false, (void*)&finalize_4a1c088a64670512, &__wrap_finalize_4a1c088a64670512 },
+    { 0xb3477d3b141b0518, true, (void*)&MyString_abd2ff560b27faf, &__wrap_MyString_abd2ff560b27faf },
+    { 0xaccabe124296dc4, false, (void*)&_FuncMyStringTickMyString_50a4c3a8a54c339f, &__wrap__FuncMyStringTickMyString_50a4c3a8a54c339f },
+    { 0x3921233c875da56f, false, (void*)&_FuncMyStringTickto_upper_54a45a2a92e327f8, &__wrap__FuncMyStringTickto_upper_54a45a2a92e327f8 },
+    { 0x38e32b7c6e787c26, false, (void*)&_FuncMyStringTickutf8_3fbbc3863a593951, &__wrap__FuncMyStringTickutf8_3fbbc3863a593951 },
+    { 0x4583d4f544385a1b, false, (void*)&_FuncMyString_0x27___finalize_1b4dc71a0ee82a4c, &__wrap__FuncMyString_0x27___finalize_1b4dc71a0ee82a4c },
+    { 0xc61457514215d159, false, (void*)&test_995ada17f0a19b45, &__wrap_test_995ada17f0a19b45 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0xc215606811a54077, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_2719023608469653660
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,145 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_16647645113364319227 {
+
+// unused enumeration GooEnum
+// unused enumeration OpCode
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline uint64_t GetGoo_d69c30df09bda5e9 ( Context * __context__, char * const  __arg_rename_at_11_0 );
+inline uint64_t GetGoo2_c2b486ffc8736aa1 ( Context * __context__, char * const  __arg_rename_at_16_1 );
+inline bool test_7ec6aa74a0dfe0cf ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global_zero<TestObjectFoo,0x5239a613f0240979>(__context__);/*foo*/
+}
+
+inline uint64_t GetGoo_d69c30df09bda5e9 ( Context * __context__, char * const  __arg_rename_at_11_0 )
+{
+    return das_auto_cast<uint64_t>::cast(CheckEid(/*arg-0-prefix*/ das_arg<TestObjectFoo>::pass(das_global<TestObjectFoo,0x5239a613f0240979>(__context__) /*foo*/) /*arg-0-suffix*/,/*arg-1-prefix*/ __arg_rename_at_11_0 /*arg-1-suffix*/,/*arg-2-prefix*/ __context__ /*arg-2-suffix*/,/*arg-3-prefix*/ ((LineInfoArg *)(&LineInfo::g_LineInfoNULL)) /*arg-3-suffix*/));
+}
+
+inline uint64_t GetGoo2_c2b486ffc8736aa1 ( Context * __context__, char * const  __arg_rename_at_16_1 )
+{
+    return das_auto_cast<uint64_t>::cast(CheckEid(das_arg<TestObjectFoo>::pass(das_global<TestObjectFoo,0x5239a613f0240979>(__context__) /*foo*/),__arg_rename_at_16_1,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+}
+
+inline bool test_7ec6aa74a0dfe0cf ( Context * __context__ )
+{
+    uint64_t __a_rename_at_22_2 = ((uint64_t)CheckEidHint(das_arg<TestObjectFoo>::pass(das_global<TestObjectFoo,0x5239a613f0240979>(__context__) /*foo*/),((char *) "goo"),UINT64_C(0x93eb39082ba0f80b),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+    uint64_t __b_rename_at_23_3 = ((uint64_t)GetGoo_d69c30df09bda5e9(__context__,((char *) "goo")));
+    DAS_ASSERT((__a_rename_at_22_2 == __b_rename_at_23_3));
+    uint64_t __a2_rename_at_25_4 = ((uint64_t)CheckEid(das_arg<TestObjectFoo>::pass(das_global<TestObjectFoo,0x5239a613f0240979>(__context__) /*foo*/),((char *) "goo"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+    uint64_t __b2_rename_at_26_5 = ((uint64_t)GetGoo2_c2b486ffc8736aa1(__context__,((char *) "goo")));
+    DAS_ASSERT((__a2_rename_at_25_4 == __b2_rename_at_26_5));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_GetGoo_d69c30df09bda5e9 ( Context * __context__ ) {
+    char * const  arg_arg = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<uint64_t>::from(GetGoo_d69c30df09bda5e9(__context__, arg_arg));
+}
+static vec4f __wrap_GetGoo2_c2b486ffc8736aa1 ( Context * __context__ ) {
+    char * const  arg_arg = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<uint64_t>::from(GetGoo2_c2b486ffc8736aa1(__context__, arg_arg));
+}
+static vec4f __wrap_test_7ec6aa74a0dfe0cf ( Context * __context__ ) {
+    return cast<bool>::from(test_7ec6aa74a0dfe0cf(__context__));
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xa8900651eddf58f, false, (void*)&GetGoo_d69c30df09bda5e9, &__wrap_GetGoo_d69c30df09bda5e9 },
+    { 0xe4587728d1a6a8ca, false, (void*)&GetGoo2_c2b486ffc8736aa1, &__wrap_GetGoo2_c2b486ffc8736aa1 },
+    { 0x665db55f5419a64e, false, (void*)&test_7ec6aa74a0dfe0cf, &__wrap_test_7ec6aa74a0dfe0cf },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0xff1f1da09fbf7b7e, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_16647645113364319227
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,728 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_4729996650443536940 {
+
+namespace  { struct Foo; };
+namespace  { struct Bar; };
+// unused enumeration GooEnum
+// unused enumeration OpCode
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+namespace  {
+
+struct Foo {
+    int32_t a;
+    TArray<int32_t> b;
+};
+static_assert(sizeof(Foo)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Bar {
+    TArray<Foo> z;
+};
+static_assert(sizeof(Bar)==24,"structure size mismatch with DAS");
+static_assert(offsetof(Bar,z)==0,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__70c0cde798ed9c9d;
+extern StructInfo __struct_info__411ed0e77075265a;
+extern TypeInfo __type_info__d148b3bd9e8f43c2;
+extern TypeInfo __type_info__ef1197b3cfb2a68;
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__bc69a005531fe739;
+extern TypeInfo __type_info__3bffed6eb15130d0;
+extern TypeInfo __type_info__68a96d839d45c546;
+extern TypeInfo __type_info__af63e44c8601fa24;
+
+VarInfo __struct_info__70c0cde798ed9c9d_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__bc69a005531fe739, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xcd5341c8e274d906), "z", 0, 1 };
+VarInfo * __struct_info__70c0cde798ed9c9d_fields[1] =  { &__struct_info__70c0cde798ed9c9d_field_0 };
+StructInfo __struct_info__70c0cde798ed9c9d = {"Bar", "", 20, __struct_info__70c0cde798ed9c9d_fields, 1, 24, UINT64_C(0x0), nullptr, UINT64_C(0x70c0cde798ed9c9d), 0 };
+VarInfo __struct_info__411ed0e77075265a_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xbcd691bb60c7d14c), "a", 0, 0 };
+VarInfo __struct_info__411ed0e77075265a_field_1 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xbcd694bb60c7d665), "b", 8, 2 };
+VarInfo * __struct_info__411ed0e77075265a_fields[2] =  { &__struct_info__411ed0e77075265a_field_0, &__struct_info__411ed0e77075265a_field_1 };
+StructInfo __struct_info__411ed0e77075265a = {"Foo", "", 20, __struct_info__411ed0e77075265a_fields, 2, 32, UINT64_C(0x0), nullptr, UINT64_C(0x411ed0e77075265a), 1 };
+TypeInfo __type_info__d148b3bd9e8f43c2 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__3bffed6eb15130d0, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xd148b3bd9e8f43c2) };
+TypeInfo __type_info__ef1197b3cfb2a68 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__68a96d839d45c546, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xef1197b3cfb2a68) };
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__bc69a005531fe739 = { Type::tStructure, &__struct_info__411ed0e77075265a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 32, UINT64_C(0xbc69a005531fe739) };
+TypeInfo __type_info__3bffed6eb15130d0 = { Type::tStructure, &__struct_info__70c0cde798ed9c9d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x3bffed6eb15130d0) };
+TypeInfo __type_info__68a96d839d45c546 = { Type::tStructure, &__struct_info__411ed0e77075265a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 32, UINT64_C(0x68a96d839d45c546) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__d148b3bd9e8f43c2, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_1[2] = { &__type_info__ef1197b3cfb2a68, &__type_info__af90fe4c864e9d52 };
+
+inline TestObjectFoo _FuncbuiltinTickclone_to_moveTick11760368545006390975_a3f27bb56e4c191a ( Context * __context__, TestObjectFoo const  & __clone_src_rename_at_1109_0 );
+inline void _FuncbuiltinTickcloneTick3038771811667655495_1437c65ce2ab7be8 ( Context * __context__, TArray<Foo> & __a_rename_at_1142_2, TArray<Foo> const  & __b_rename_at_1142_3 );
+inline void _FuncbuiltinTickclearTick13739625760977891612_5ef20c9833a0830c ( Context * __context__, TTable<int32_t,char *> & __t_rename_at_2083_9 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickkeysTick17388619793938508994_b455c69065c702c8 ( Context * __context__, TTable<int32_t,char *> & __a_rename_at_1282_10 );
+inline Sequence DAS_COMMENT((char * &)) _FuncbuiltinTickvaluesTick1351216622833168869_8ef55e2b02598cf2 ( Context * __context__, TTable<int32_t,char *> & __a_rename_at_1304_12 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_1475f15fd4841506 ( Context * __context__, TArray<Bar> & __Arr_rename_at_68_14, int32_t __newSize_rename_at_68_15 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_bcc9c5893e823cc8 ( Context * __context__, TArray<Foo> & __Arr_rename_at_68_16, int32_t __newSize_rename_at_68_17 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_68_18, int32_t __newSize_rename_at_68_19 );
+inline void _FuncbuiltinTickcloneTick3038771811667655495_eb7ebd39a641308b ( Context * __context__, TArray<Bar> & __a_rename_at_1142_20, TArray<Bar> const  & __b_rename_at_1142_21 );
+inline void _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__, TArray<int32_t> & __a_rename_at_1142_27, TArray<int32_t> const  & __b_rename_at_1142_28 );
+inline void _FuncbuiltinTickinsertTick12964066441666329206_902883a95a7233a5 ( Context * __context__, TTable<int32_t,char *> & __Tab_rename_at_869_30, int32_t __at_rename_at_869_31, char * const  __val_rename_at_869_32 );
+inline void _FuncbuiltinTickcloneTick17583971578645470472_dee48fcd8aad6b95 ( Context * __context__, TTable<int32_t,char *> & __a_rename_at_1181_33, TTable<int32_t,char *> & __b_rename_at_1181_34 );
+inline char * _FuncbuiltinTickget_valueTick6803070933163225147_8f406ded258e5ea4 ( Context * __context__, TTable<int32_t,char *> & __Tab_rename_at_755_39, int32_t __at_rename_at_755_40 );
+inline void _FuncbuiltinTickpush_cloneTick13009461207988247769_8d4918b9a7c36319 ( Context * __context__, das::vector<TestObjectFoo> & __A_rename_at_475_41, TestObjectFoo const  & __b_rename_at_475_42 );
+inline void test_clone_complex_be63932d9cdd577f ( Context * __context__ );
+inline void test_clone_struct_d2258cd44feca13e ( Context * __context__ );
+inline void test_clone_array_3d719a12e033723a ( Context * __context__ );
+inline void test_clone_table_68f466374e71016f ( Context * __context__ );
+inline bool test_c69f0eb002ad1b92 ( Context * __context__ );
+inline void test_if_compiles_cc70a4a582681702 ( Context * __context__, das::vector<TestObjectFoo> & __a_rename_at_108_70, TestObjectFoo const  & __b_rename_at_108_71 );
+inline void clone_5d06d29012e29db ( Context * __context__, Foo & __a_rename_at_5_72, Foo const  & __b_rename_at_5_73 );
+inline void clone_d15ea87c375b08e6 ( Context * __context__, Bar & __a_rename_at_10_74, Bar const  & __b_rename_at_10_75 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline TestObjectFoo _FuncbuiltinTickclone_to_moveTick11760368545006390975_a3f27bb56e4c191a ( Context * __context__, TestObjectFoo const  &  __clone_src_rename_at_1109_0 )
+{
+    TestObjectFoo __clone_dest_rename_at_1111_1;das_zero(__clone_dest_rename_at_1111_1);
+    das_clone<TestObjectFoo,TestObjectFoo>::clone(__clone_dest_rename_at_1111_1,__clone_src_rename_at_1109_0);
+    return /* <- */ das_auto_cast_move<TestObjectFoo>::cast(__clone_dest_rename_at_1111_1);
+}
+
+inline void _FuncbuiltinTickcloneTick3038771811667655495_1437c65ce2ab7be8 ( Context * __context__, TArray<Foo> &  __a_rename_at_1142_2, TArray<Foo> const  &  __b_rename_at_1142_3 )
+{
+    int32_t __ln_rename_at_1143_4 = ((int32_t)builtin_array_size(__b_rename_at_1142_3));
+    _FuncbuiltinTickresizeTick4811697762258667383_bcc9c5893e823cc8(__context__,das_arg<TArray<Foo>>::pass(__a_rename_at_1142_2),__ln_rename_at_1143_4);
+    if ( __ln_rename_at_1143_4 == 0 )
+    {
+        return ;
+    } else {
+        {
+            bool __need_loop_1153 = true;
+            // aV: Foo aka TT&
+            das_iterator<TArray<Foo>> __aV_iterator(__a_rename_at_1142_2);
+            Foo * __aV_rename_at_1153_7;
+            __need_loop_1153 = __aV_iterator.first(__context__,(__aV_rename_at_1153_7)) && __need_loop_1153;
+            // bV: Foo aka TT const&
+            das_iterator<TArray<Foo> const > __bV_iterator(__b_rename_at_1142_3);
+            Foo const  * __bV_rename_at_1153_8;
+            __need_loop_1153 = __bV_iterator.first(__context__,(__bV_rename_at_1153_8)) && __need_loop_1153;
+            for ( ; __need_loop_1153 ; __need_loop_1153 = __aV_iterator.next(__context__,(__aV_rename_at_1153_7)) && __bV_iterator.next(__context__,(__bV_rename_at_1153_8)) )
+            {
+                clone_5d06d29012e29db(__context__,das_arg<Foo>::pass((*__aV_rename_at_1153_7)),(*__bV_rename_at_1153_8));
+            }
+            __bV_iterator.close(__context__,(__bV_rename_at_1153_8));
+            __aV_iterator.close(__context__,(__aV_rename_at_1153_7));
+        };
+    };
+}
+
+inline void _FuncbuiltinTickclearTick13739625760977891612_5ef20c9833a0830c ( Context * __context__, TTable<int32_t,char *> &  __t_rename_at_2083_9 )
+{
+    builtin_table_clear(das_arg<TTable<int32_t,char *>>::pass(__t_rename_at_2083_9),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickkeysTick17388619793938508994_b455c69065c702c8 ( Context * __context__, TTable<int32_t,char *> &  __a_rename_at_1282_10 )
+{
+    Sequence DAS_COMMENT((int32_t)) __it_rename_at_1283_11;das_zero(__it_rename_at_1283_11);
+    builtin_table_keys(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_1283_11),das_arg<TTable<int32_t,char *>>::pass(__a_rename_at_1282_10),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_1283_11);
+}
+
+inline Sequence DAS_COMMENT((char * &)) _FuncbuiltinTickvaluesTick1351216622833168869_8ef55e2b02598cf2 ( Context * __context__, TTable<int32_t,char *> &  __a_rename_at_1304_12 )
+{
+    Sequence DAS_COMMENT((char * *)) __it_rename_at_1305_13;das_zero(__it_rename_at_1305_13);
+    builtin_table_values(das_arg<Sequence DAS_COMMENT((char *))>::pass(__it_rename_at_1305_13),das_arg<TTable<int32_t,char *>>::pass(__a_rename_at_1304_12),8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char * &))>::cast(__it_rename_at_1305_13);
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_1475f15fd4841506 ( Context * __context__, TArray<Bar> &  __Arr_rename_at_68_14, int32_t __newSize_rename_at_68_15 )
+{
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<TArray<Bar> &>::from(__Arr_rename_at_68_14),cast<char * const >::from(((char *) "array can't be resized because it contains locked elements"))));
+    builtin_array_resize(das_arg<TArray<Bar>>::pass(__Arr_rename_at_68_14),__newSize_rename_at_68_15,24,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_bcc9c5893e823cc8 ( Context * __context__, TArray<Foo> &  __Arr_rename_at_68_16, int32_t __newSize_rename_at_68_17 )
+{
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<TArray<Foo> &>::from(__Arr_rename_at_68_16),cast<char * const >::from(((char *) "array can't be resized because it contains locked elements"))));
+    builtin_array_resize(das_arg<TArray<Foo>>::pass(__Arr_rename_at_68_16),__newSize_rename_at_68_17,32,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_68_18, int32_t __newSize_rename_at_68_19 )
+{
+    builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_68_18),__newSize_rename_at_68_19,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickcloneTick3038771811667655495_eb7ebd39a641308b ( Context * __context__, TArray<Bar> &  __a_rename_at_1142_20, TArray<Bar> const  &  __b_rename_at_1142_21 )
+{
+    int32_t __ln_rename_at_1143_22 = ((int32_t)builtin_array_size(__b_rename_at_1142_21));
+    _FuncbuiltinTickresizeTick4811697762258667383_1475f15fd4841506(__context__,das_arg<TArray<Bar>>::pass(__a_rename_at_1142_20),__ln_rename_at_1143_22);
+    if ( __ln_rename_at_1143_22 == 0 )
+    {
+        return ;
+    } else {
+        {
+            bool __need_loop_1153 = true;
+            // aV: Bar aka TT&
+            das_iterator<TArray<Bar>> __aV_iterator(__a_rename_at_1142_20);
+            Bar * __aV_rename_at_1153_25;
+            __need_loop_1153 = __aV_iterator.first(__context__,(__aV_rename_at_1153_25)) && __need_loop_1153;
+            // bV: Bar aka TT const&
+            das_iterator<TArray<Bar> const > __bV_iterator(__b_rename_at_1142_21);
+            Bar const  * __bV_rename_at_1153_26;
+            __need_loop_1153 = __bV_iterator.first(__context__,(__bV_rename_at_1153_26)) && __need_loop_1153;
+            for ( ; __need_loop_1153 ; __need_loop_1153 = __aV_iterator.next(__context__,(__aV_rename_at_1153_25)) && __bV_iterator.next(__context__,(__bV_rename_at_1153_26)) )
+            {
+                clone_d15ea87c375b08e6(__context__,das_arg<Bar>::pass((*__aV_rename_at_1153_25)),(*__bV_rename_at_1153_26));
+            }
+            __bV_iterator.close(__context__,(__bV_rename_at_1153_26));
+            __aV_iterator.close(__context__,(__aV_rename_at_1153_25));
+        };
+    };
+}
+
+inline void _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__, TArray<int32_t> &  __a_rename_at_1142_27, TArray<int32_t> const  &  __b_rename_at_1142_28 )
+{
+    int32_t __ln_rename_at_1143_29 = ((int32_t)builtin_array_size(__b_rename_at_1142_28));
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_1142_27),__ln_rename_at_1143_29);
+    if ( __ln_rename_at_1143_29 == 0 )
+    {
+        return ;
+    } else {
+        das_memcpy(das_auto_cast<void * const >::cast(das_ref(__context__,__a_rename_at_1142_27(0,__context__))),das_auto_cast<void * const >::cast(das_ref(__context__,__b_rename_at_1142_28(0,__context__))),__ln_rename_at_1143_29 * 4);
+    };
+}
+
+inline void _FuncbuiltinTickinsertTick12964066441666329206_902883a95a7233a5 ( Context * __context__, TTable<int32_t,char *> &  __Tab_rename_at_869_30, int32_t __at_rename_at_869_31, char * const  __val_rename_at_869_32 )
+{
+    das_copy(__Tab_rename_at_869_30(__at_rename_at_869_31,__context__),__val_rename_at_869_32);
+}
+
+inline void _FuncbuiltinTickcloneTick17583971578645470472_dee48fcd8aad6b95 ( Context * __context__, TTable<int32_t,char *> &  __a_rename_at_1181_33, TTable<int32_t,char *> &  __b_rename_at_1181_34 )
+{
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_1183_17_0; _temp_make_local_1183_17_0;
+    Sequence DAS_COMMENT((char * *)) _temp_make_local_1183_26_1; _temp_make_local_1183_26_1;
+    _FuncbuiltinTickclearTick13739625760977891612_5ef20c9833a0830c(__context__,das_arg<TTable<int32_t,char *>>::pass(__a_rename_at_1181_33));
+    {
+        bool __need_loop_1183 = true;
+        // k: int
+        das_iterator<Sequence DAS_COMMENT((int32_t))> __k_iterator((_temp_make_local_1183_17_0 = (_FuncbuiltinTickkeysTick17388619793938508994_b455c69065c702c8(__context__,das_arg<TTable<int32_t,char *>>::pass(__b_rename_at_1181_34)))));
+        int32_t __k_rename_at_1183_37;
+        __need_loop_1183 = __k_iterator.first(__context__,(__k_rename_at_1183_37)) && __need_loop_1183;
+        // v: string&
+        das_iterator<Sequence DAS_COMMENT((char *))> __v_iterator((_temp_make_local_1183_26_1 = (_FuncbuiltinTickvaluesTick1351216622833168869_8ef55e2b02598cf2(__context__,das_arg<TTable<int32_t,char *>>::pass(__b_rename_at_1181_34)))));
+        char * * __v_rename_at_1183_38;
+        __need_loop_1183 = __v_iterator.first(__context__,(__v_rename_at_1183_38)) && __need_loop_1183;
+        for ( ; __need_loop_1183 ; __need_loop_1183 = __k_iterator.next(__context__,(__k_rename_at_1183_37)) && __v_iterator.next(__context__,(__v_rename_at_1183_38)) )
+        {
+            das_copy(__a_rename_at_1181_33(__k_rename_at_1183_37,__context__),(*__v_rename_at_1183_38));
+        }
+        __v_iterator.close(__context__,(__v_rename_at_1183_38));
+        __k_iterator.close(__context__,(__k_rename_at_1183_37));
+    };
+}
+
+inline char * _FuncbuiltinTickget_valueTick6803070933163225147_8f406ded258e5ea4 ( Context * __context__, TTable<int32_t,char *> &  __Tab_rename_at_755_39, int32_t __at_rename_at_755_40 )
+{
+    return das_auto_cast<char *>::cast(__Tab_rename_at_755_39(__at_rename_at_755_40,__context__));
+}
+
+inline void _FuncbuiltinTickpush_cloneTick13009461207988247769_8d4918b9a7c36319 ( Context * __context__, das::vector<TestObjectFoo> &  __A_rename_at_475_41, TestObjectFoo const  &  __b_rename_at_475_42 )
+{
+    TestObjectFoo __cb_rename_at_484_43; das_zero(__cb_rename_at_484_43); das_move(__cb_rename_at_484_43, _FuncbuiltinTickclone_to_moveTick11760368545006390975_a3f27bb56e4c191a(__context__,__b_rename_at_475_42));
+    das_vector_emplace_back(das_arg<das::vector<TestObjectFoo>>::pass(__A_rename_at_475_41),das_arg<TestObjectFoo>::pass(__cb_rename_at_484_43));
+}
+
+inline void test_clone_complex_be63932d9cdd577f ( Context * __context__ )
+{
+    TArray<Bar> __x_rename_at_16_44;das_zero(__x_rename_at_16_44); TArray<Bar> __y_rename_at_16_45;das_zero(__y_rename_at_16_45);
+    _FuncbuiltinTickresizeTick4811697762258667383_1475f15fd4841506(__context__,das_arg<TArray<Bar>>::pass(__x_rename_at_16_44),2);
+    {
+        bool __need_loop_18 = true;
+        // xx: Bar&
+        das_iterator<TArray<Bar>> __xx_iterator(__x_rename_at_16_44);
+        Bar * __xx_rename_at_18_46;
+        __need_loop_18 = __xx_iterator.first(__context__,(__xx_rename_at_18_46)) && __need_loop_18;
+        for ( ; __need_loop_18 ; __need_loop_18 = __xx_iterator.next(__context__,(__xx_rename_at_18_46)) )
+        {
+            _FuncbuiltinTickresizeTick4811697762258667383_bcc9c5893e823cc8(__context__,das_arg<TArray<Foo>>::pass((*__xx_rename_at_18_46).z),4);
+            {
+                bool __need_loop_20 = true;
+                // xxx: Foo&
+                das_iterator<TArray<Foo>> __xxx_iterator((*__xx_rename_at_18_46).z);
+                Foo * __xxx_rename_at_20_47;
+                __need_loop_20 = __xxx_iterator.first(__context__,(__xxx_rename_at_20_47)) && __need_loop_20;
+                for ( ; __need_loop_20 ; __need_loop_20 = __xxx_iterator.next(__context__,(__xxx_rename_at_20_47)) )
+                {
+                    das_copy((*__xxx_rename_at_20_47).a,5);
+                    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass((*__xxx_rename_at_20_47).b),3);
+                    {
+                        bool __need_loop_23 = true;
+                        // t: int const
+                        das_iterator<range> __t_iterator(range(0,3));
+                        int32_t __t_rename_at_23_48;
+                        __need_loop_23 = __t_iterator.first(__context__,(__t_rename_at_23_48)) && __need_loop_23;
+                        for ( ; __need_loop_23 ; __need_loop_23 = __t_iterator.next(__context__,(__t_rename_at_23_48)) )
+                        {
+                            das_copy((*__xxx_rename_at_20_47).b(__t_rename_at_23_48,__context__),__t_rename_at_23_48);
+                        }
+                        __t_iterator.close(__context__,(__t_rename_at_23_48));
+                    };
+                }
+                __xxx_iterator.close(__context__,(__xxx_rename_at_20_47));
+            };
+        }
+        __xx_iterator.close(__context__,(__xx_rename_at_18_46));
+    };
+    _FuncbuiltinTickcloneTick3038771811667655495_eb7ebd39a641308b(__context__,das_arg<TArray<Bar>>::pass(__y_rename_at_16_45),das_arg<TArray<Bar>>::pass(__x_rename_at_16_44));
+    {
+        bool __need_loop_29 = true;
+        // xx: Bar&
+        das_iterator<TArray<Bar>> __xx_iterator(__x_rename_at_16_44);
+        Bar * __xx_rename_at_29_49;
+        __need_loop_29 = __xx_iterator.first(__context__,(__xx_rename_at_29_49)) && __need_loop_29;
+        for ( ; __need_loop_29 ; __need_loop_29 = __xx_iterator.next(__context__,(__xx_rename_at_29_49)) )
+        {
+            {
+                bool __need_loop_30 = true;
+                // xxx: Foo&
+                das_iterator<TArray<Foo>> __xxx_iterator((*__xx_rename_at_29_49).z);
+                Foo * __xxx_rename_at_30_50;
+                __need_loop_30 = __xxx_iterator.first(__context__,(__xxx_rename_at_30_50)) && __need_loop_30;
+                for ( ; __need_loop_30 ; __need_loop_30 = __xxx_iterator.next(__context__,(__xxx_rename_at_30_50)) )
+                {
+                    das_copy((*__xxx_rename_at_30_50).a,6);
+                    {
+                        bool __need_loop_32 = true;
+                        // t: int const
+                        das_iterator<range> __t_iterator(range(0,3));
+                        int32_t __t_rename_at_32_51;
+                        __need_loop_32 = __t_iterator.first(__context__,(__t_rename_at_32_51)) && __need_loop_32;
+                        for ( ; __need_loop_32 ; __need_loop_32 = __t_iterator.next(__context__,(__t_rename_at_32_51)) )
+                        {
+                            das_copy((*__xxx_rename_at_30_50).b(__t_rename_at_32_51,__context__),__t_rename_at_32_51 + 1);
+                        }
+                        __t_iterator.close(__context__,(__t_rename_at_32_51));
+                    };
+                }
+                __xxx_iterator.close(__context__,(__xxx_rename_at_30_50));
+            };
+        }
+        __xx_iterator.close(__context__,(__xx_rename_at_29_49));
+    };
+    {
+        bool __need_loop_37 = true;
+        // yy: Bar&
+        das_iterator<TArray<Bar>> __yy_iterator(__y_rename_at_16_45);
+        Bar * __yy_rename_at_37_52;
+        __need_loop_37 = __yy_iterator.first(__context__,(__yy_rename_at_37_52)) && __need_loop_37;
+        for ( ; __need_loop_37 ; __need_loop_37 = __yy_iterator.next(__context__,(__yy_rename_at_37_52)) )
+        {
+            {
+                bool __need_loop_38 = true;
+                // yyy: Foo&
+                das_iterator<TArray<Foo>> __yyy_iterator((*__yy_rename_at_37_52).z);
+                Foo * __yyy_rename_at_38_53;
+                __need_loop_38 = __yyy_iterator.first(__context__,(__yyy_rename_at_38_53)) && __need_loop_38;
+                for ( ; __need_loop_38 ; __need_loop_38 = __yyy_iterator.next(__context__,(__yyy_rename_at_38_53)) )
+                {
+                    DAS_ASSERT(((*__yyy_rename_at_38_53).a == 5));
+                    {
+                        bool __need_loop_40 = true;
+                        // t: int const
+                        das_iterator<range> __t_iterator(range(0,3));
+                        int32_t __t_rename_at_40_54;
+                        __need_loop_40 = __t_iterator.first(__context__,(__t_rename_at_40_54)) && __need_loop_40;
+                        for ( ; __need_loop_40 ; __need_loop_40 = __t_iterator.next(__context__,(__t_rename_at_40_54)) )
+                        {
+                            DAS_ASSERT(((*__yyy_rename_at_38_53).b(__t_rename_at_40_54,__context__) == __t_rename_at_40_54));
+                        }
+                        __t_iterator.close(__context__,(__t_rename_at_40_54));
+                    };
+                }
+                __yyy_iterator.close(__context__,(__yyy_rename_at_38_53));
+            };
+        }
+        __yy_iterator.close(__context__,(__yy_rename_at_37_52));
+    };
+}
+
+inline void test_clone_struct_d2258cd44feca13e ( Context * __context__ )
+{
+    Foo __x_rename_at_49_55;das_zero(__x_rename_at_49_55); Foo __y_rename_at_49_56;das_zero(__y_rename_at_49_56);
+    das_copy(__x_rename_at_49_55.a,5);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__x_rename_at_49_55.b),3);
+    {
+        bool __need_loop_52 = true;
+        // t: int const
+        das_iterator<range> __t_iterator(range(0,3));
+        int32_t __t_rename_at_52_57;
+        __need_loop_52 = __t_iterator.first(__context__,(__t_rename_at_52_57)) && __need_loop_52;
+        for ( ; __need_loop_52 ; __need_loop_52 = __t_iterator.next(__context__,(__t_rename_at_52_57)) )
+        {
+            das_copy(__x_rename_at_49_55.b(__t_rename_at_52_57,__context__),__t_rename_at_52_57);
+        }
+        __t_iterator.close(__context__,(__t_rename_at_52_57));
+    };
+    clone_5d06d29012e29db(__context__,das_arg<Foo>::pass(__y_rename_at_49_56),das_arg<Foo>::pass(__x_rename_at_49_55));
+    das_copy(__x_rename_at_49_55.a,6);
+    {
+        bool __need_loop_57 = true;
+        // t: int const
+        das_iterator<range> __t_iterator(range(0,3));
+        int32_t __t_rename_at_57_58;
+        __need_loop_57 = __t_iterator.first(__context__,(__t_rename_at_57_58)) && __need_loop_57;
+        for ( ; __need_loop_57 ; __need_loop_57 = __t_iterator.next(__context__,(__t_rename_at_57_58)) )
+        {
+            das_copy(__x_rename_at_49_55.b(__t_rename_at_57_58,__context__),__t_rename_at_57_58 + 1);
+        }
+        __t_iterator.close(__context__,(__t_rename_at_57_58));
+    };
+    DAS_ASSERT((__y_rename_at_49_56.a == 5));
+    {
+        bool __need_loop_61 = true;
+        // t: int const
+        das_iterator<range> __t_iterator(range(0,3));
+        int32_t __t_rename_at_61_59;
+        __need_loop_61 = __t_iterator.first(__context__,(__t_rename_at_61_59)) && __need_loop_61;
+        for ( ; __need_loop_61 ; __need_loop_61 = __t_iterator.next(__context__,(__t_rename_at_61_59)) )
+        {
+            DAS_ASSERT((__y_rename_at_49_56.b(__t_rename_at_61_59,__context__) == __t_rename_at_61_59));
+        }
+        __t_iterator.close(__context__,(__t_rename_at_61_59));
+    };
+}
+
+inline void test_clone_array_3d719a12e033723a ( Context * __context__ )
+{
+    TArray<int32_t> __x_rename_at_68_60;das_zero(__x_rename_at_68_60); TArray<int32_t> __y_rename_at_68_61;das_zero(__y_rename_at_68_61);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__x_rename_at_68_60),3);
+    {
+        bool __need_loop_70 = true;
+        // t: int const
+        das_iterator<range> __t_iterator(range(0,3));
+        int32_t __t_rename_at_70_62;
+        __need_loop_70 = __t_iterator.first(__context__,(__t_rename_at_70_62)) && __need_loop_70;
+        for ( ; __need_loop_70 ; __need_loop_70 = __t_iterator.next(__context__,(__t_rename_at_70_62)) )
+        {
+            das_copy(__x_rename_at_68_60(__t_rename_at_70_62,__context__),__t_rename_at_70_62);
+        }
+        __t_iterator.close(__context__,(__t_rename_at_70_62));
+    };
+    _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62(__context__,das_arg<TArray<int32_t>>::pass(__y_rename_at_68_61),das_arg<TArray<int32_t>>::pass(__x_rename_at_68_60));
+    {
+        bool __need_loop_74 = true;
+        // t: int const
+        das_iterator<range> __t_iterator(range(0,3));
+        int32_t __t_rename_at_74_63;
+        __need_loop_74 = __t_iterator.first(__context__,(__t_rename_at_74_63)) && __need_loop_74;
+        for ( ; __need_loop_74 ; __need_loop_74 = __t_iterator.next(__context__,(__t_rename_at_74_63)) )
+        {
+            das_copy(__x_rename_at_68_60(__t_rename_at_74_63,__context__),__t_rename_at_74_63 + 1);
+        }
+        __t_iterator.close(__context__,(__t_rename_at_74_63));
+    };
+    {
+        bool __need_loop_77 = true;
+        // t: int const
+        das_iterator<range> __t_iterator(range(0,3));
+        int32_t __t_rename_at_77_64;
+        __need_loop_77 = __t_iterator.first(__context__,(__t_rename_at_77_64)) && __need_loop_77;
+        for ( ; __need_loop_77 ; __need_loop_77 = __t_iterator.next(__context__,(__t_rename_at_77_64)) )
+        {
+            DAS_VERIFY((__y_rename_at_68_61(__t_rename_at_77_64,__context__) == __t_rename_at_77_64));
+        }
+        __t_iterator.close(__context__,(__t_rename_at_77_64));
+    };
+}
+
+inline void test_clone_table_68f466374e71016f ( Context * __context__ )
+{
+    TTable<int32_t,char *> __x_rename_at_84_65;das_zero(__x_rename_at_84_65); TTable<int32_t,char *> __y_rename_at_84_66;das_zero(__y_rename_at_84_66);
+    {
+        bool __need_loop_85 = true;
+        // t: int const
+        das_iterator<range> __t_iterator(range(0,3));
+        int32_t __t_rename_at_85_67;
+        __need_loop_85 = __t_iterator.first(__context__,(__t_rename_at_85_67)) && __need_loop_85;
+        for ( ; __need_loop_85 ; __need_loop_85 = __t_iterator.next(__context__,(__t_rename_at_85_67)) )
+        {
+            _FuncbuiltinTickinsertTick12964066441666329206_902883a95a7233a5(__context__,das_arg<TTable<int32_t,char *>>::pass(__x_rename_at_84_65),__t_rename_at_85_67,((char * const )(das_lexical_cast_int_i32(__t_rename_at_85_67,false,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))))));
+        }
+        __t_iterator.close(__context__,(__t_rename_at_85_67));
+    };
+    _FuncbuiltinTickcloneTick17583971578645470472_dee48fcd8aad6b95(__context__,das_arg<TTable<int32_t,char *>>::pass(__y_rename_at_84_66),das_arg<TTable<int32_t,char *>>::pass(__x_rename_at_84_65));
+    {
+        bool __need_loop_89 = true;
+        // t: int const
+        das_iterator<range> __t_iterator(range(0,3));
+        int32_t __t_rename_at_89_68;
+        __need_loop_89 = __t_iterator.first(__context__,(__t_rename_at_89_68)) && __need_loop_89;
+        for ( ; __need_loop_89 ; __need_loop_89 = __t_iterator.next(__context__,(__t_rename_at_89_68)) )
+        {
+            _FuncbuiltinTickinsertTick12964066441666329206_902883a95a7233a5(__context__,das_arg<TTable<int32_t,char *>>::pass(__x_rename_at_84_65),__t_rename_at_89_68,((char * const )(das_lexical_cast_int_i32(__t_rename_at_89_68 + 1,false,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))))));
+        }
+        __t_iterator.close(__context__,(__t_rename_at_89_68));
+    };
+    DAS_ASSERT((builtin_table_size(das_arg<TTable<int32_t,char *>>::pass(__y_rename_at_84_66)) == 3));
+    {
+        bool __need_loop_93 = true;
+        // t: int const
+        das_iterator<range> __t_iterator(range(0,3));
+        int32_t __t_rename_at_93_69;
+        __need_loop_93 = __t_iterator.first(__context__,(__t_rename_at_93_69)) && __need_loop_93;
+        for ( ; __need_loop_93 ; __need_loop_93 = __t_iterator.next(__context__,(__t_rename_at_93_69)) )
+        {
+            DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_FuncbuiltinTickget_valueTick6803070933163225147_8f406ded258e5ea4(__context__,das_arg<TTable<int32_t,char *>>::pass(__y_rename_at_84_66),__t_rename_at_93_69)),cast<char *>::from(((char * const )(das_lexical_cast_int_i32(__t_rename_at_93_69,false,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))),*__context__,nullptr)));
+        }
+        __t_iterator.close(__context__,(__t_rename_at_93_69));
+    };
+}
+
+inline bool test_c69f0eb002ad1b92 ( Context * __context__ )
+{
+    test_clone_array_3d719a12e033723a(__context__);
+    test_clone_table_68f466374e71016f(__context__);
+    test_clone_struct_d2258cd44feca13e(__context__);
+    test_clone_complex_be63932d9cdd577f(__context__);
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline void test_if_compiles_cc70a4a582681702 ( Context * __context__, das::vector<TestObjectFoo> &  __a_rename_at_108_70, TestObjectFoo const  &  __b_rename_at_108_71 )
+{
+    _FuncbuiltinTickpush_cloneTick13009461207988247769_8d4918b9a7c36319(__context__,das_arg<das::vector<TestObjectFoo>>::pass(__a_rename_at_108_70),__b_rename_at_108_71);
+}
+
+inline void clone_5d06d29012e29db ( Context * __context__, Foo &  __a_rename_at_5_72, Foo const  &  __b_rename_at_5_73 )
+{
+    das_copy(__a_rename_at_5_72.a,__b_rename_at_5_73.a);
+    _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_5_72.b),__b_rename_at_5_73.b);
+}
+
+inline void clone_d15ea87c375b08e6 ( Context * __context__, Bar &  __a_rename_at_10_74, Bar const  &  __b_rename_at_10_75 )
+{
+    _FuncbuiltinTickcloneTick3038771811667655495_1437c65ce2ab7be8(__context__,das_arg<TArray<Foo>>::pass(__a_rename_at_10_74.z),__b_rename_at_10_75.z);
+}
+static vec4f __wrap__FuncbuiltinTickclone_to_moveTick11760368545006390975_a3f27bb56e4c191a ( Context * __context__ ) {
+    TestObjectFoo const  &  arg_clone_src = cast_aot_arg<TestObjectFoo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TestObjectFoo *) __context__->abiCMRES) = _FuncbuiltinTickclone_to_moveTick11760368545006390975_a3f27bb56e4c191a(__context__, arg_clone_src);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickcloneTick3038771811667655495_1437c65ce2ab7be8 ( Context * __context__ ) {
+    TArray<Foo> &  arg_a = cast_aot_arg<TArray<Foo> & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<Foo> const  &  arg_b = cast_aot_arg<TArray<Foo> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickcloneTick3038771811667655495_1437c65ce2ab7be8(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickclearTick13739625760977891612_5ef20c9833a0830c ( Context * __context__ ) {
+    TTable<int32_t,char *> &  arg_t = cast_aot_arg<TTable<int32_t,char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickclearTick13739625760977891612_5ef20c9833a0830c(__context__, arg_t);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickkeysTick17388619793938508994_b455c69065c702c8 ( Context * __context__ ) {
+    TTable<int32_t,char *> &  arg_a = cast_aot_arg<TTable<int32_t,char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncbuiltinTickkeysTick17388619793938508994_b455c69065c702c8(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickvaluesTick1351216622833168869_8ef55e2b02598cf2 ( Context * __context__ ) {
+    TTable<int32_t,char *> &  arg_a = cast_aot_arg<TTable<int32_t,char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((char * &)) *) __context__->abiCMRES) = _FuncbuiltinTickvaluesTick1351216622833168869_8ef55e2b02598cf2(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_1475f15fd4841506 ( Context * __context__ ) {
+    TArray<Bar> &  arg_Arr = cast_aot_arg<TArray<Bar> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_1475f15fd4841506(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_bcc9c5893e823cc8 ( Context * __context__ ) {
+    TArray<Foo> &  arg_Arr = cast_aot_arg<TArray<Foo> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_bcc9c5893e823cc8(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickcloneTick3038771811667655495_eb7ebd39a641308b ( Context * __context__ ) {
+    TArray<Bar> &  arg_a = cast_aot_arg<TArray<Bar> & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<Bar> const  &  arg_b = cast_aot_arg<TArray<Bar> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickcloneTick3038771811667655495_eb7ebd39a641308b(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> const  &  arg_b = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickinsertTick12964066441666329206_902883a95a7233a5 ( Context * __context__ ) {
+    TTable<int32_t,char *> &  arg_Tab = cast_aot_arg<TTable<int32_t,char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_at = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    char * const  arg_val = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[2]);
+    _FuncbuiltinTickinsertTick12964066441666329206_902883a95a7233a5(__context__, arg_Tab, arg_at, arg_val);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickcloneTick17583971578645470472_dee48fcd8aad6b95 ( Context * __context__ ) {
+    TTable<int32_t,char *> &  arg_a = cast_aot_arg<TTable<int32_t,char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    TTable<int32_t,char *> &  arg_b = cast_aot_arg<TTable<int32_t,char *> & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickcloneTick17583971578645470472_dee48fcd8aad6b95(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickget_valueTick6803070933163225147_8f406ded258e5ea4 ( Context * __context__ ) {
+    TTable<int32_t,char *> &  arg_Tab = cast_aot_arg<TTable<int32_t,char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_at = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<char *>::from(_FuncbuiltinTickget_valueTick6803070933163225147_8f406ded258e5ea4(__context__, arg_Tab, arg_at));
+}
+static vec4f __wrap__FuncbuiltinTickpush_cloneTick13009461207988247769_8d4918b9a7c36319 ( Context * __context__ ) {
+    das::vector<TestObjectFoo> &  arg_A = cast_aot_arg<das::vector<TestObjectFoo> & >::to(*__context__,__context__->abiArguments()[0]);
+    TestObjectFoo const  &  arg_b = cast_aot_arg<TestObjectFoo const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpush_cloneTick13009461207988247769_8d4918b9a7c36319(__context__, arg_A, arg_b);
+    return v_zero();
+}
+static vec4f __wrap_test_clone_complex_be63932d9cdd577f ( Context * __context__ ) {
+    test_clone_complex_be63932d9cdd577f(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_clone_struct_d2258cd44feca13e ( Context * __context__ ) {
+    test_clone_struct_d2258cd44feca13e(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_clone_array_3d719a12e033723a ( Context * __context__ ) {
+    test_clone_array_3d719a12e033723a(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_clone_table_68f466374e71016f ( Context * __context__ ) {
+    test_clone_table_68f466374e71016f(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_c69f0eb002ad1b92 ( Context * __context__ ) {
+    return cast<bool>::from(test_c69f0eb002ad1b92(__context__));
+}
+static vec4f __wrap_test_if_compiles_cc70a4a582681702 ( Context * __context__ ) {
+    das::vector<TestObjectFoo> &  arg_a = cast_aot_arg<das::vector<TestObjectFoo> & >::to(*__context__,__context__->abiArguments()[0]);
+    TestObjectFoo const  &  arg_b = cast_aot_arg<TestObjectFoo const  & >::to(*__context__,__context__->abiArguments()[1]);
+    test_if_compiles_cc70a4a582681702(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap_clone_5d06d29012e29db ( Context * __context__ ) {
+    Foo &  arg_a = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    Foo const  &  arg_b = cast_aot_arg<Foo const  & >::to(*__context__,__context__->abiArguments()[1]);
+    clone_5d06d29012e29db(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap_clone_d15ea87c375b08e6 ( Context * __context__ ) {
+    Bar &  arg_a = cast_aot_arg<Bar & >::to(*__context__,__context__->abiArguments()[0]);
+    Bar const  &  arg_b = cast_aot_arg<Bar const  & >::to(*__context__,__context__->abiArguments()[1]);
+    clone_d15ea87c375b08e6(__context__, arg_a, arg_b);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x2ac229793acd694, true, (void*)&_FuncbuiltinTickclone_to_moveTick11760368545006390975_a3f27bb56e4c191a, &__wrap__FuncbuiltinTickclone_to_moveTick11760368545006390975_a3f27bb56e4c191a },
+    { 0x4fae9550c3e7d78e, false, (void*)&_FuncbuiltinTickcloneTick3038771811667655495_1437c65ce2ab7be8, &__wrap__FuncbuiltinTickcloneTick3038771811667655495_1437c65ce2ab7be8 },
+    { 0x89c529378e69dd1e, false, (void*)&_FuncbuiltinTickclearTick13739625760977891612_5ef20c9833a0830c, &__wrap__FuncbuiltinTickclearTick13739625760977891612_5ef20c9833a0830c },
+    { 0xb2ef179e003efe30, true, (void*)&_FuncbuiltinTickkeysTick17388619793938508994_b455c69065c702c8, &__wrap__FuncbuiltinTickkeysTick17388619793938508994_b455c69065c702c8 },
+    { 0x7a2b10779580a42c, true, (void*)&_FuncbuiltinTickvaluesTick1351216622833168869_8ef55e2b02598cf2, &__wrap__FuncbuiltinTickvaluesTick1351216622833168869_8ef55e2b02598cf2 },
+    { 0x348d086c9995d19, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_1475f15fd4841506, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_1475f15fd4841506 },
+    { 0xaa1f081d4342152b, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_bcc9c5893e823cc8, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_bcc9c5893e823cc8 },
+    { 0xa51a880d594e91fd, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c },
+    { 0x7b3548d030ddba51, false, (void*)&_FuncbuiltinTickcloneTick3038771811667655495_eb7ebd39a641308b, &__wrap__FuncbuiltinTickcloneTick3038771811667655495_eb7ebd39a641308b },
+    { 0xca1141a5df264c9, false, (void*)&_FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62, &__wrap__FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 },
+    { 0xb8b2de76f6341eac, false, (void*)&_FuncbuiltinTickinsertTick12964066441666329206_902883a95a7233a5, &__wrap__FuncbuiltinTickinsertTick12964066441666329206_902883a95a7233a5 },
+    { 0x6f64d13e716102ae, false, (void*)&_FuncbuiltinTickcloneTick17583971578645470472_dee48fcd8aad6b95, &__wrap__FuncbuiltinTickcloneTick17583971578645470472_dee48fcd8aad6b95 },
+    { 0x990c2356a9700b34, false, (void*)&_FuncbuiltinTickget_valueTick6803070933163225147_8f406ded258e5ea4, &__wrap__FuncbuiltinTickget_valueTick6803070933163225147_8f406ded258e5ea4 },
+    { 0xac33dbd6f06bd803, false, (void*)&_FuncbuiltinTickpush_cloneTick13009461207988247769_8d4918b9a7c36319, &__wrap__FuncbuiltinTickpush_cloneTick13009461207988247769_8d4918b9a7c36319 },
+    { 0x9fd0e274ec47ae17, false, (void*)&test_clone_complex_be63932d9cdd577f, &__wrap_test_clone_complex_be63932d9cdd577f },
+    { 0xd80085178bca18d3, false, (void*)&test_clone_struct_d2258cd44feca13e, &__wrap_test_clone_struct_d2258cd44feca13e },
+    { 0x8427e6b424d7aa89, false, (void*)&test_clone_array_3d719a12e033723a, &__wrap_test_clone_array_3d719a12e033723a },
+    { 0x3f23031033242371, false, (void*)&test_clone_table_68f466374e71016f, &__wrap_test_clone_table_68f466374e71016f },
+    { 0xdfddb64a518c66ea, false, (void*)&test_c69f0eb002ad1b92, &__wrap_test_c69f0eb002ad1b92 },
+    { 0xb321f6b498f3aa19, false, (void*)&test_if_compiles_cc70a4a582681702, &__wrap_test_if_compiles_cc70a4a582681702 },
+    { 0x6f182150c3f1aab2, false, (void*)&clone_5d06d29012e29db, &__wrap_clone_5d06d29012e29db },
+    { 0xe4b27a502e001383, false, (void*)&clone_d15ea87c375b08e6, &__wrap_clone_d15ea87c375b08e6 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_4729996650443536940
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,180 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_15353888387344454950 {
+
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+    int32_t a;
+    char * s;
+};
+static_assert(sizeof(Foo)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,s)==8,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline Foo _FuncbuiltinTickclone_to_moveTick11760368545006390975_92ae5ebd320f60e7 ( Context * __context__, Foo const  & __clone_src_rename_at_1109_0 );
+inline Foo test_c_e75f60235a3a4a01 ( Context * __context__ );
+inline bool test_5aad796ce9634e7d ( Context * __context__ );
+inline Foo Foo_d39d98213b56bc1d ( Context * __context__ );
+inline void clone_6180b2a2bc3614d5 ( Context * __context__, Foo & __a_rename_at_2_4, Foo const  & __b_rename_at_2_5 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Foo _FuncbuiltinTickclone_to_moveTick11760368545006390975_92ae5ebd320f60e7 ( Context * __context__, Foo const  &  __clone_src_rename_at_1109_0 )
+{
+    Foo __clone_dest_rename_at_1111_1;das_zero(__clone_dest_rename_at_1111_1);
+    clone_6180b2a2bc3614d5(__context__,das_arg<Foo>::pass(__clone_dest_rename_at_1111_1),__clone_src_rename_at_1109_0);
+    return /* <- */ das_auto_cast_move<Foo>::cast(__clone_dest_rename_at_1111_1);
+}
+
+inline Foo test_c_e75f60235a3a4a01 ( Context * __context__ )
+{
+    return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+        Foo __mks_9;
+        das_zero(__mks_9);
+        das_copy((__mks_9.a),(4));
+        return __mks_9;
+    })()));
+}
+
+inline bool test_5aad796ce9634e7d ( Context * __context__ )
+{
+    Foo __foo_rename_at_15_2_ConstRef = ((Foo)test_c_e75f60235a3a4a01(__context__));
+    Foo const  & __foo_rename_at_15_2 = __foo_rename_at_15_2_ConstRef;
+;
+    Foo __cop_rename_at_16_3_ConstRef; das_zero(__cop_rename_at_16_3_ConstRef); das_move(__cop_rename_at_16_3_ConstRef, ((Foo)_FuncbuiltinTickclone_to_moveTick11760368545006390975_92ae5ebd320f60e7(__context__,__foo_rename_at_15_2)));
+    Foo const  & __cop_rename_at_16_3 = __cop_rename_at_16_3_ConstRef;
+;
+    DAS_ASSERT((__foo_rename_at_15_2.a == 4));
+    DAS_ASSERT((__cop_rename_at_16_3.a == 4));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline Foo Foo_d39d98213b56bc1d ( Context * __context__ )
+{
+    return /* <- */ das_auto_cast_move<Foo>::cast((([&]() -> Foo {
+        Foo __mks_2;
+        das_copy((__mks_2.a),(10));
+        das_copy((__mks_2.s),(((char *) "bar")));
+        return __mks_2;
+    })()));
+}
+
+inline void clone_6180b2a2bc3614d5 ( Context * __context__, Foo &  __a_rename_at_2_4, Foo const  &  __b_rename_at_2_5 )
+{
+    das_copy(__a_rename_at_2_4.a,__b_rename_at_2_5.a);
+    das_copy(__a_rename_at_2_4.s,__b_rename_at_2_5.s);
+}
+static vec4f __wrap__FuncbuiltinTickclone_to_moveTick11760368545006390975_92ae5ebd320f60e7 ( Context * __context__ ) {
+    Foo const  &  arg_clone_src = cast_aot_arg<Foo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Foo *) __context__->abiCMRES) = _FuncbuiltinTickclone_to_moveTick11760368545006390975_92ae5ebd320f60e7(__context__, arg_clone_src);
+    return v_zero();
+}
+static vec4f __wrap_test_c_e75f60235a3a4a01 ( Context * __context__ ) {
+    *((Foo *) __context__->abiCMRES) = test_c_e75f60235a3a4a01(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_5aad796ce9634e7d ( Context * __context__ ) {
+    return cast<bool>::from(test_5aad796ce9634e7d(__context__));
+}
+static vec4f __wrap_Foo_d39d98213b56bc1d ( Context * __context__ ) {
+    *((Foo *) __context__->abiCMRES) = Foo_d39d98213b56bc1d(__context__);
+    return v_zero();
+}
+static vec4f __wrap_clone_6180b2a2bc3614d5 ( Context * __context__ ) {
+    Foo &  arg_a = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    Foo const  &  arg_b = cast_aot_arg<Foo const  & >::to(*__context__,__context__->abiArguments()[1]);
+    clone_6180b2a2bc3614d5(__context__, arg_a, arg_b);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x2528a638a623839a, true, (void*)&_FuncbuiltinTickclone_to_moveTick11760368545006390975_92ae5ebd320f60e7, &__wrap__FuncbuiltinTickclone_to_moveTick11760368545006390975_92ae5ebd320f60e7 },
+    { 0x8ec0c62fed84e1b3, true, (void*)&test_c_e75f60235a3a4a01, &__wrap_test_c_e75f60235a3a4a01 },
+    { 0x46c9571421b16a5b, false, (void*)&test_5aad796ce9634e7d, &__wrap_test_5aad796ce9634e7d },
+    { 0x32edbd0d0370b875, true, (void*)&Foo_d39d98213b56bc1d, &__wrap_Foo_d39d98213b56bc1d },
+    { 0x85018a4b37fe8b50, false, (void*)&clone_6180b2a2bc3614d5, &__wrap_clone_6180b2a2bc3614d5 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_15353888387344454950
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,225 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_9080424785645900617 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline void _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__, TArray<int32_t> & __a_rename_at_1142_2, TArray<int32_t> const  & __b_rename_at_1142_3 );
+inline bool test_10256d7c2b92fdc8 ( Context * __context__ );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b ( Context * __context__, TDim<int32_t,3> & __a_rename_at_1502_15 );
+inline TArray<int32_t> _FuncbuiltinTickclone_to_moveTick11760368545006390975_89b7cb9f24906825 ( Context * __context__, TArray<int32_t> const  & __clone_src_rename_at_1109_17 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    TDim<int32_t,3> _temp_make_local_3_12_0;
+    das_global<TArray<int32_t>,0xe79c0c59d03b4254>(__context__) = _FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b(__context__,das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+        _temp_make_local_3_12_0(0,__context__) = 1;
+        _temp_make_local_3_12_0(1,__context__) = 2;
+        _temp_make_local_3_12_0(2,__context__) = 3;
+        return _temp_make_local_3_12_0;
+    })())));/*g_a*/
+    das_global<TArray<int32_t>,0x9f90de37bfd0d72f>(__context__) = _FuncbuiltinTickclone_to_moveTick11760368545006390975_89b7cb9f24906825(__context__,das_global<TArray<int32_t>,0xe79c0c59d03b4254>(__context__) /*g_a*/);/*g_b*/
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__, TArray<int32_t> &  __a_rename_at_1142_2, TArray<int32_t> const  &  __b_rename_at_1142_3 )
+{
+    int32_t __ln_rename_at_1143_4 = ((int32_t)builtin_array_size(__b_rename_at_1142_3));
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_1142_2),__ln_rename_at_1143_4);
+    if ( __ln_rename_at_1143_4 == 0 )
+    {
+        return ;
+    } else {
+        das_memcpy(das_auto_cast<void * const >::cast(das_ref(__context__,__a_rename_at_1142_2(0,__context__))),das_auto_cast<void * const >::cast(das_ref(__context__,__b_rename_at_1142_3(0,__context__))),__ln_rename_at_1143_4 * 4);
+    };
+}
+
+inline bool test_10256d7c2b92fdc8 ( Context * __context__ )
+{
+    TDim<int32_t,3> _temp_make_local_13_14_1; _temp_make_local_13_14_1;
+    DAS_ASSERT(((builtin_array_size(das_global<TArray<int32_t>,0xe79c0c59d03b4254>(__context__) /*g_a*/) == 3) && (builtin_array_size(das_global<TArray<int32_t>,0x9f90de37bfd0d72f>(__context__) /*g_b*/) == 3)));
+    {
+        bool __need_loop_10 = true;
+        // x: int const&
+        das_iterator<TArray<int32_t> const > __x_iterator(das_global<TArray<int32_t>,0xe79c0c59d03b4254>(__context__) /*g_a*/);
+        int32_t const  * __x_rename_at_10_7;
+        __need_loop_10 = __x_iterator.first(__context__,(__x_rename_at_10_7)) && __need_loop_10;
+        // y: int const&
+        das_iterator<TArray<int32_t> const > __y_iterator(das_global<TArray<int32_t>,0x9f90de37bfd0d72f>(__context__) /*g_b*/);
+        int32_t const  * __y_rename_at_10_8;
+        __need_loop_10 = __y_iterator.first(__context__,(__y_rename_at_10_8)) && __need_loop_10;
+        for ( ; __need_loop_10 ; __need_loop_10 = __x_iterator.next(__context__,(__x_rename_at_10_7)) && __y_iterator.next(__context__,(__y_rename_at_10_8)) )
+        {
+            DAS_ASSERT(((*__x_rename_at_10_7) == (*__y_rename_at_10_8)));
+        }
+        __y_iterator.close(__context__,(__y_rename_at_10_8));
+        __x_iterator.close(__context__,(__x_rename_at_10_7));
+    };
+    TArray<int32_t> __a_rename_at_13_9_ConstRef; das_zero(__a_rename_at_13_9_ConstRef); das_move(__a_rename_at_13_9_ConstRef, ((TArray<int32_t>)_FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b(__context__,das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+        _temp_make_local_13_14_1(0,__context__) = 1;
+        _temp_make_local_13_14_1(1,__context__) = 2;
+        _temp_make_local_13_14_1(2,__context__) = 3;
+        return _temp_make_local_13_14_1;
+    })())))));
+    TArray<int32_t> const  & __a_rename_at_13_9 = __a_rename_at_13_9_ConstRef;
+;
+    TArray<int32_t> __b_rename_at_14_10_ConstRef; das_zero(__b_rename_at_14_10_ConstRef); das_move(__b_rename_at_14_10_ConstRef, ((TArray<int32_t>)_FuncbuiltinTickclone_to_moveTick11760368545006390975_89b7cb9f24906825(__context__,__a_rename_at_13_9)));
+    TArray<int32_t> const  & __b_rename_at_14_10 = __b_rename_at_14_10_ConstRef;
+;
+    DAS_ASSERT(((builtin_array_size(__a_rename_at_13_9) == 3) && (builtin_array_size(__b_rename_at_14_10) == 3)));
+    {
+        bool __need_loop_16 = true;
+        // x: int const&
+        das_iterator<TArray<int32_t> const > __x_iterator(__a_rename_at_13_9);
+        int32_t const  * __x_rename_at_16_13;
+        __need_loop_16 = __x_iterator.first(__context__,(__x_rename_at_16_13)) && __need_loop_16;
+        // y: int const&
+        das_iterator<TArray<int32_t> const > __y_iterator(__b_rename_at_14_10);
+        int32_t const  * __y_rename_at_16_14;
+        __need_loop_16 = __y_iterator.first(__context__,(__y_rename_at_16_14)) && __need_loop_16;
+        for ( ; __need_loop_16 ; __need_loop_16 = __x_iterator.next(__context__,(__x_rename_at_16_13)) && __y_iterator.next(__context__,(__y_rename_at_16_14)) )
+        {
+            DAS_ASSERT(((*__x_rename_at_16_13) == (*__y_rename_at_16_14)));
+        }
+        __y_iterator.close(__context__,(__y_rename_at_16_14));
+        __x_iterator.close(__context__,(__x_rename_at_16_13));
+    };
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b ( Context * __context__, TDim<int32_t,3> &  __a_rename_at_1502_15 )
+{
+    TArray<int32_t> __arr_rename_at_1504_16;das_zero(__arr_rename_at_1504_16);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_16),3);
+    das_copy(das_cast<TDim<int32_t,3>>::cast(das_ref(__context__,__arr_rename_at_1504_16(0,__context__))),__a_rename_at_1502_15);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_16);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickclone_to_moveTick11760368545006390975_89b7cb9f24906825 ( Context * __context__, TArray<int32_t> const  &  __clone_src_rename_at_1109_17 )
+{
+    TArray<int32_t> __clone_dest_rename_at_1111_18;das_zero(__clone_dest_rename_at_1111_18);
+    _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62(__context__,das_arg<TArray<int32_t>>::pass(__clone_dest_rename_at_1111_18),__clone_src_rename_at_1109_17);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__clone_dest_rename_at_1111_18);
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> const  &  arg_b = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap_test_10256d7c2b92fdc8 ( Context * __context__ ) {
+    return cast<bool>::from(test_10256d7c2b92fdc8(__context__));
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b ( Context * __context__ ) {
+    TDim<int32_t,3> &  arg_a = cast_aot_arg<TDim<int32_t,3> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickclone_to_moveTick11760368545006390975_89b7cb9f24906825 ( Context * __context__ ) {
+    TArray<int32_t> const  &  arg_clone_src = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickclone_to_moveTick11760368545006390975_89b7cb9f24906825(__context__, arg_clone_src);
+    return v_zero();
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xa51a880d594e91fd, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c },
+    { 0xca1141a5df264c9, false, (void*)&_FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62, &__wrap__FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 },
+    { 0x51ea2c9692ea2de9, false, (void*)&test_10256d7c2b92fdc8, &__wrap_test_10256d7c2b92fdc8 },
+    { 0x7964cdf0a208493a, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b },
+    { 0x45fac551f17947ba, true, (void*)&_FuncbuiltinTickclone_to_moveTick11760368545006390975_89b7cb9f24906825, &__wrap__FuncbuiltinTickclone_to_moveTick11760368545006390975_89b7cb9f24906825 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0xfb13ef7b92165edb, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_9080424785645900617
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
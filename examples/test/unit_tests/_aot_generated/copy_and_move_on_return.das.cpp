@@ -0,0 +1,351 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_10914517874106878217 {
+
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+    int32_t bar;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,bar)==0,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__411ed0e77075265a;
+extern TypeInfo __type_info__124e1c04d9af11ea;
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__bc69a005531fe739;
+extern TypeInfo __type_info__a3f0477a4765213e;
+extern TypeInfo __type_info__af63e44c8601fa24;
+
+VarInfo __struct_info__411ed0e77075265a_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x384ed16514488015), "bar", 0, 0 };
+VarInfo * __struct_info__411ed0e77075265a_fields[1] =  { &__struct_info__411ed0e77075265a_field_0 };
+StructInfo __struct_info__411ed0e77075265a = {"Foo", "", 0, __struct_info__411ed0e77075265a_fields, 1, 4, UINT64_C(0x0), nullptr, UINT64_C(0x411ed0e77075265a), 1 };
+FuncInfo __func_info__640e07af7ebf39e0 = {"invoke block<Foo> const", "", nullptr, 0, 32, &__type_info__bc69a005531fe739, nullptr,0,UINT64_C(0x640e07af7ebf39e0), 0x0 };
+FuncInfo __func_info__ca9308c17d575aff = {"invoke block<array<int>> const", "", nullptr, 0, 32, &__type_info__124e1c04d9af11ea, nullptr,0,UINT64_C(0xca9308c17d575aff), 0x0 };
+TypeInfo __type_info__124e1c04d9af11ea = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x124e1c04d9af11ea) };
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__bc69a005531fe739 = { Type::tStructure, &__struct_info__411ed0e77075265a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 4, UINT64_C(0xbc69a005531fe739) };
+TypeInfo __type_info__a3f0477a4765213e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xa3f0477a4765213e) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__a3f0477a4765213e, &__type_info__af90fe4c864e9d52 };
+
+inline void _FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_137_0, int32_t __newSize_rename_at_137_1 );
+inline void _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_177_2, int32_t __value_rename_at_177_3 );
+inline TArray<int32_t> & _FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 ( Context * __context__, TArray<int32_t> & __a_rename_at_50_4 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_68_5, int32_t __newSize_rename_at_68_6 );
+inline TArray<int32_t> _FuncTickjoinSequencesTick15303446103814738389_c6b863094f74ff84 ( Context * __context__, TArray<int32_t> const  & __l_rename_at_29_7, TArray<int32_t> const  & __r_rename_at_29_8 );
+inline TArray<int32_t> _FuncTickmakeSequenceBTick13627153528533987098_595abe0caf76eb67 ( Context * __context__, Block DAS_COMMENT((TArray<int32_t>)) const  & __b_rename_at_41_12 );
+inline TArray<int32_t> _FuncTickmakeSequenceTick13855995397324995751_2c145a72ab4bead9 ( Context * __context__, int32_t __base_rename_at_20_13, int32_t __max_rename_at_20_14 );
+inline Foo newFoo_af49afa49dba6823 ( Context * __context__ );
+inline Foo newFooB_1ed7a9cf8eff797d ( Context * __context__, Block DAS_COMMENT((Foo)) const  & __b_rename_at_12_18 );
+inline int32_t addBar_5b176ac8df0e8a58 ( Context * __context__, Foo const  & __a_rename_at_16_19, Foo const  & __b_rename_at_16_20 );
+inline bool test_37f4e9126de77759 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_137_0, int32_t __newSize_rename_at_137_1 )
+{
+    builtin_array_reserve(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_137_0),__newSize_rename_at_137_1,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_177_2, int32_t __value_rename_at_177_3 )
+{
+    das_copy(__Arr_rename_at_177_2(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_177_2),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_177_3);
+}
+
+inline TArray<int32_t> & _FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 ( Context * __context__, TArray<int32_t> &  __a_rename_at_50_4 )
+{
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<TArray<int32_t> &>::from(__a_rename_at_50_4),cast<char * const >::from(((char *) "object can't be returned because it is locked"))));
+    return das_auto_cast_ref<TArray<int32_t> &>::cast(__a_rename_at_50_4);
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_68_5, int32_t __newSize_rename_at_68_6 )
+{
+    builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_68_5),__newSize_rename_at_68_6,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline TArray<int32_t> _FuncTickjoinSequencesTick15303446103814738389_c6b863094f74ff84 ( Context * __context__, TArray<int32_t> const  &  __l_rename_at_29_7, TArray<int32_t> const  &  __r_rename_at_29_8 )
+{
+    TArray<int32_t> __a_rename_at_30_9;das_zero(__a_rename_at_30_9);
+    _FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_30_9),builtin_array_size(__l_rename_at_29_7) + builtin_array_size(__r_rename_at_29_8));
+    {
+        bool __need_loop_32 = true;
+        // t: int aka numT const&
+        das_iterator<TArray<int32_t> const > __t_iterator(__l_rename_at_29_7);
+        int32_t const  * __t_rename_at_32_10;
+        __need_loop_32 = __t_iterator.first(__context__,(__t_rename_at_32_10)) && __need_loop_32;
+        for ( ; __need_loop_32 ; __need_loop_32 = __t_iterator.next(__context__,(__t_rename_at_32_10)) )
+        {
+            _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_30_9),(*__t_rename_at_32_10));
+        }
+        __t_iterator.close(__context__,(__t_rename_at_32_10));
+    };
+    {
+        bool __need_loop_35 = true;
+        // t: int aka numT const&
+        das_iterator<TArray<int32_t> const > __t_iterator(__r_rename_at_29_8);
+        int32_t const  * __t_rename_at_35_11;
+        __need_loop_35 = __t_iterator.first(__context__,(__t_rename_at_35_11)) && __need_loop_35;
+        for ( ; __need_loop_35 ; __need_loop_35 = __t_iterator.next(__context__,(__t_rename_at_35_11)) )
+        {
+            _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_30_9),(*__t_rename_at_35_11));
+        }
+        __t_iterator.close(__context__,(__t_rename_at_35_11));
+    };
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_30_9)));
+}
+
+inline TArray<int32_t> _FuncTickmakeSequenceBTick13627153528533987098_595abe0caf76eb67 ( Context * __context__, Block DAS_COMMENT((TArray<int32_t>)) const  &  __b_rename_at_41_12 )
+{
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14(__context__,das_arg<TArray<int32_t>>::pass(das_invoke<TArray<int32_t>>::invoke_cmres(__context__,nullptr,__b_rename_at_41_12))));
+}
+
+inline TArray<int32_t> _FuncTickmakeSequenceTick13855995397324995751_2c145a72ab4bead9 ( Context * __context__, int32_t __base_rename_at_20_13, int32_t __max_rename_at_20_14 )
+{
+    TArray<int32_t> __a_rename_at_21_15;das_zero(__a_rename_at_21_15);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_21_15),(__max_rename_at_20_14 + 1) - __base_rename_at_20_13);
+    {
+        bool __need_loop_23 = true;
+        // t: int&
+        das_iterator<TArray<int32_t>> __t_iterator(__a_rename_at_21_15);
+        int32_t * __t_rename_at_23_16;
+        __need_loop_23 = __t_iterator.first(__context__,(__t_rename_at_23_16)) && __need_loop_23;
+        for ( ; __need_loop_23 ; __need_loop_23 = __t_iterator.next(__context__,(__t_rename_at_23_16)) )
+        {
+            das_copy((*__t_rename_at_23_16),__base_rename_at_20_13++);
+        }
+        __t_iterator.close(__context__,(__t_rename_at_23_16));
+    };
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_21_15)));
+}
+
+inline Foo newFoo_af49afa49dba6823 ( Context * __context__ )
+{
+    Foo __t_rename_at_7_17;das_zero(__t_rename_at_7_17);
+    das_copy(__t_rename_at_7_17.bar,1);
+    return das_auto_cast_ref<Foo>::cast(__t_rename_at_7_17);
+}
+
+inline Foo newFooB_1ed7a9cf8eff797d ( Context * __context__, Block DAS_COMMENT((Foo)) const  &  __b_rename_at_12_18 )
+{
+    return das_auto_cast_ref<Foo>::cast(das_invoke<Foo>::invoke_cmres(__context__,nullptr,__b_rename_at_12_18));
+}
+
+inline int32_t addBar_5b176ac8df0e8a58 ( Context * __context__, Foo const  &  __a_rename_at_16_19, Foo const  &  __b_rename_at_16_20 )
+{
+    return das_auto_cast<int32_t>::cast(__a_rename_at_16_19.bar + __b_rename_at_16_20.bar);
+}
+
+inline bool test_37f4e9126de77759 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,288,"test " DAS_FILE_LINE);
+{
+    Foo _temp_make_local_48_19_0; _temp_make_local_48_19_0;
+    Foo _temp_make_local_48_29_1; _temp_make_local_48_29_1;
+    Foo _temp_make_local_50_20_2; _temp_make_local_50_20_2;
+    Foo _temp_make_local_51_8_3; _temp_make_local_51_8_3;
+    TArray<int32_t> _temp_make_local_54_27_4; _temp_make_local_54_27_4;
+    TArray<int32_t> _temp_make_local_54_47_5; _temp_make_local_54_47_5;
+    TArray<int32_t> _temp_make_local_60_28_6; _temp_make_local_60_28_6;
+    TArray<int32_t> _temp_make_local_61_8_7; _temp_make_local_61_8_7;
+    int32_t __t_rename_at_48_21 = ((int32_t)addBar_5b176ac8df0e8a58(__context__,das_arg<Foo>::pass((_temp_make_local_48_19_0 = (newFoo_af49afa49dba6823(__context__)))),das_arg<Foo>::pass((_temp_make_local_48_29_1 = (newFoo_af49afa49dba6823(__context__))))));
+    DAS_ASSERT((__t_rename_at_48_21 == 2));
+    int32_t __tt_rename_at_50_22 = ((int32_t)addBar_5b176ac8df0e8a58(__context__,das_arg<Foo>::pass((_temp_make_local_50_20_2 = (newFooB_1ed7a9cf8eff797d(__context__,das_make_block_cmres<Foo>(__context__,128,0,&__func_info__640e07af7ebf39e0,[&]() -> Foo{
+        Foo __T_rename_at_50_23;das_zero(__T_rename_at_50_23);
+        das_copy(__T_rename_at_50_23.bar,1);
+        return das_auto_cast_ref<Foo>::cast(__T_rename_at_50_23);
+    }))))),das_arg<Foo>::pass((_temp_make_local_51_8_3 = (newFooB_1ed7a9cf8eff797d(__context__,das_make_block_cmres<Foo>(__context__,144,0,&__func_info__640e07af7ebf39e0,[&]() -> Foo{
+        Foo __T_rename_at_51_24;das_zero(__T_rename_at_51_24);
+        das_copy(__T_rename_at_51_24.bar,1);
+        return das_auto_cast_ref<Foo>::cast(__T_rename_at_51_24);
+    })))))));
+    DAS_ASSERT((__tt_rename_at_50_22 == 2));
+    TArray<int32_t> __z_rename_at_54_25_ConstRef; das_zero(__z_rename_at_54_25_ConstRef); das_move(__z_rename_at_54_25_ConstRef, ((TArray<int32_t>)_FuncTickjoinSequencesTick15303446103814738389_c6b863094f74ff84(__context__,das_arg<TArray<int32_t>>::pass((_temp_make_local_54_27_4 = (_FuncTickmakeSequenceTick13855995397324995751_2c145a72ab4bead9(__context__,0,4)))),das_arg<TArray<int32_t>>::pass((_temp_make_local_54_47_5 = (_FuncTickmakeSequenceTick13855995397324995751_2c145a72ab4bead9(__context__,5,9)))))));
+    TArray<int32_t> const  & __z_rename_at_54_25 = __z_rename_at_54_25_ConstRef;
+;
+    DAS_ASSERT((builtin_array_size(__z_rename_at_54_25) == 10));
+    {
+        bool __need_loop_56 = true;
+        // ttq: int const
+        das_iterator<range> __ttq_iterator(range(0,9));
+        int32_t __ttq_rename_at_56_26;
+        __need_loop_56 = __ttq_iterator.first(__context__,(__ttq_rename_at_56_26)) && __need_loop_56;
+        for ( ; __need_loop_56 ; __need_loop_56 = __ttq_iterator.next(__context__,(__ttq_rename_at_56_26)) )
+        {
+            DAS_ASSERT((__z_rename_at_54_25(__ttq_rename_at_56_26,__context__) == __ttq_rename_at_56_26));
+        }
+        __ttq_iterator.close(__context__,(__ttq_rename_at_56_26));
+    };
+    TArray<int32_t> __zz_rename_at_60_27_ConstRef; das_zero(__zz_rename_at_60_27_ConstRef); das_move(__zz_rename_at_60_27_ConstRef, ((TArray<int32_t>)_FuncTickjoinSequencesTick15303446103814738389_c6b863094f74ff84(__context__,das_arg<TArray<int32_t>>::pass((_temp_make_local_60_28_6 = (_FuncTickmakeSequenceBTick13627153528533987098_595abe0caf76eb67(__context__,das_make_block_cmres<TArray<int32_t>>(__context__,208,0,&__func_info__ca9308c17d575aff,[&]() -> TArray<int32_t>{
+        TArray<int32_t> _temp_make_local_60_55_8; _temp_make_local_60_55_8;
+        return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14(__context__,das_arg<TArray<int32_t>>::pass((_temp_make_local_60_55_8 = (_FuncTickmakeSequenceTick13855995397324995751_2c145a72ab4bead9(__context__,0,4))))));
+    }))))),das_arg<TArray<int32_t>>::pass((_temp_make_local_61_8_7 = (_FuncTickmakeSequenceBTick13627153528533987098_595abe0caf76eb67(__context__,das_make_block_cmres<TArray<int32_t>>(__context__,240,0,&__func_info__ca9308c17d575aff,[&]() -> TArray<int32_t>{
+        TArray<int32_t> _temp_make_local_61_35_9; _temp_make_local_61_35_9;
+        return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14(__context__,das_arg<TArray<int32_t>>::pass((_temp_make_local_61_35_9 = (_FuncTickmakeSequenceTick13855995397324995751_2c145a72ab4bead9(__context__,5,9))))));
+    }))))))));
+    TArray<int32_t> const  & __zz_rename_at_60_27 = __zz_rename_at_60_27_ConstRef;
+;
+    DAS_ASSERT((builtin_array_size(__zz_rename_at_60_27) == 10));
+    {
+        bool __need_loop_63 = true;
+        // ttt: int const
+        das_iterator<range> __ttt_iterator(range(0,9));
+        int32_t __ttt_rename_at_63_28;
+        __need_loop_63 = __ttt_iterator.first(__context__,(__ttt_rename_at_63_28)) && __need_loop_63;
+        for ( ; __need_loop_63 ; __need_loop_63 = __ttt_iterator.next(__context__,(__ttt_rename_at_63_28)) )
+        {
+            DAS_ASSERT((__zz_rename_at_60_27(__ttt_rename_at_63_28,__context__) == __ttt_rename_at_63_28));
+        }
+        __ttt_iterator.close(__context__,(__ttt_rename_at_63_28));
+    };
+    return das_auto_cast<bool>::cast(true);
+}}
+static vec4f __wrap__FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_value = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<TArray<int32_t> &>::from(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14(__context__, arg_a));
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickjoinSequencesTick15303446103814738389_c6b863094f74ff84 ( Context * __context__ ) {
+    TArray<int32_t> const  &  arg_l = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> const  &  arg_r = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncTickjoinSequencesTick15303446103814738389_c6b863094f74ff84(__context__, arg_l, arg_r);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickmakeSequenceBTick13627153528533987098_595abe0caf76eb67 ( Context * __context__ ) {
+    Block DAS_COMMENT((TArray<int32_t>)) const  &  arg_b = cast_aot_arg<Block DAS_COMMENT((TArray<int32_t>)) const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncTickmakeSequenceBTick13627153528533987098_595abe0caf76eb67(__context__, arg_b);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickmakeSequenceTick13855995397324995751_2c145a72ab4bead9 ( Context * __context__ ) {
+    int32_t arg_base = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_max = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncTickmakeSequenceTick13855995397324995751_2c145a72ab4bead9(__context__, arg_base, arg_max);
+    return v_zero();
+}
+static vec4f __wrap_newFoo_af49afa49dba6823 ( Context * __context__ ) {
+    *((Foo *) __context__->abiCMRES) = newFoo_af49afa49dba6823(__context__);
+    return v_zero();
+}
+static vec4f __wrap_newFooB_1ed7a9cf8eff797d ( Context * __context__ ) {
+    Block DAS_COMMENT((Foo)) const  &  arg_b = cast_aot_arg<Block DAS_COMMENT((Foo)) const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Foo *) __context__->abiCMRES) = newFooB_1ed7a9cf8eff797d(__context__, arg_b);
+    return v_zero();
+}
+static vec4f __wrap_addBar_5b176ac8df0e8a58 ( Context * __context__ ) {
+    Foo const  &  arg_a = cast_aot_arg<Foo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    Foo const  &  arg_b = cast_aot_arg<Foo const  & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t>::from(addBar_5b176ac8df0e8a58(__context__, arg_a, arg_b));
+}
+static vec4f __wrap_test_37f4e9126de77759 ( Context * __context__ ) {
+    return cast<bool>::from(test_37f4e9126de77759(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x78ccaa663d73fb1b, false, (void*)&_FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76, &__wrap__FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76 },
+    { 0xbf77bb210b0552bc, false, (void*)&_FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39, &__wrap__FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 },
+    { 0x17892cd516a9a747, false, (void*)&_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14, &__wrap__FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 },
+    { 0xa51a880d594e91fd, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c },
+    { 0x305f6937b4657671, true, (void*)&_FuncTickjoinSequencesTick15303446103814738389_c6b863094f74ff84, &__wrap__FuncTickjoinSequencesTick15303446103814738389_c6b863094f74ff84 },
+    { 0x23683c419abafea5, true, (void*)&_FuncTickmakeSequenceBTick13627153528533987098_595abe0caf76eb67, &__wrap__FuncTickmakeSequenceBTick13627153528533987098_595abe0caf76eb67 },
+    { 0x82ff379939351926, true, (void*)&_FuncTickmakeSequenceTick13855995397324995751_2c145a72ab4bead9, &__wrap__FuncTickmakeSequenceTick13855995397324995751_2c145a72ab4bead9 },
+    { 0x2bdd832f729db7d1, true, (void*)&newFoo_af49afa49dba6823, &__wrap_newFoo_af49afa49dba6823 },
+    { 0x7bbb4db9e097baa4, true, (void*)&newFooB_1ed7a9cf8eff797d, &__wrap_newFooB_1ed7a9cf8eff797d },
+    { 0x1e08d84772248fa9, false, (void*)&addBar_5b176ac8df0e8a58, &__wrap_addBar_5b176ac8df0e8a58 },
+    { 0xba0ada51753970cd, false, (void*)&test_37f4e9126de77759, &__wrap_test_37f4e9126de77759 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_10914517874106878217
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,159 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_8258179878173371796 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_1383cfa4b34f6947 ( Context * __context__, TDim<int32_t,5> & __a_rename_at_1502_2 );
+inline bool test_bafcac72a590a4 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_1383cfa4b34f6947 ( Context * __context__, TDim<int32_t,5> &  __a_rename_at_1502_2 )
+{
+    TArray<int32_t> __arr_rename_at_1504_3;das_zero(__arr_rename_at_1504_3);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_3),5);
+    das_copy(das_cast<TDim<int32_t,5>>::cast(das_ref(__context__,__arr_rename_at_1504_3(0,__context__))),__a_rename_at_1502_2);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_3);
+}
+
+inline bool test_bafcac72a590a4 ( Context * __context__ )
+{
+    TDim<int32_t,5> _temp_make_local_5_13_0; _temp_make_local_5_13_0;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_7_20_1; _temp_make_local_7_20_1;
+    TArray<int32_t> __A_rename_at_5_4; das_zero(__A_rename_at_5_4); das_move(__A_rename_at_5_4, _FuncbuiltinTickto_array_moveTick3185538323411982277_1383cfa4b34f6947(__context__,das_arg<TDim<int32_t,5>>::pass((([&]() -> TDim<int32_t,5>& {
+        _temp_make_local_5_13_0(0,__context__) = 0;
+        _temp_make_local_5_13_0(1,__context__) = 2;
+        _temp_make_local_5_13_0(2,__context__) = 4;
+        _temp_make_local_5_13_0(3,__context__) = 6;
+        _temp_make_local_5_13_0(4,__context__) = 8;
+        return _temp_make_local_5_13_0;
+    })()))));
+    int32_t __count_rename_at_6_5 = 0;
+    {
+        bool __need_loop_7 = true;
+        // a: int&
+        das_iterator<TArray<int32_t>> __a_iterator(__A_rename_at_5_4);
+        int32_t * __a_rename_at_7_8;
+        __need_loop_7 = __a_iterator.first(__context__,(__a_rename_at_7_8)) && __need_loop_7;
+        // c: int
+        das_iterator_count DAS_COMMENT((_temp_make_local_7_20_1 = (builtin_count(0,2,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))) __c_iterator(0,2);
+        int32_t __c_rename_at_7_9;
+        __need_loop_7 = __c_iterator.first(__context__,(__c_rename_at_7_9)) && __need_loop_7;
+        for ( ; __need_loop_7 ; __need_loop_7 = __a_iterator.next(__context__,(__a_rename_at_7_8)) && __c_iterator.next(__context__,(__c_rename_at_7_9)) )
+        {
+            DAS_ASSERT(((*__a_rename_at_7_8) == __c_rename_at_7_9));
+            __count_rename_at_6_5 += __c_rename_at_7_9;
+        }
+        __c_iterator.close(__context__,(__c_rename_at_7_9));
+        __a_iterator.close(__context__,(__a_rename_at_7_8));
+    };
+    DAS_ASSERT((__count_rename_at_6_5 == 20));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1383cfa4b34f6947 ( Context * __context__ ) {
+    TDim<int32_t,5> &  arg_a = cast_aot_arg<TDim<int32_t,5> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_1383cfa4b34f6947(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap_test_bafcac72a590a4 ( Context * __context__ ) {
+    return cast<bool>::from(test_bafcac72a590a4(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xa51a880d594e91fd, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c },
+    { 0x40817e1f7f7a5c2d, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_1383cfa4b34f6947, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1383cfa4b34f6947 },
+    { 0x2bd1aa90675f2535, false, (void*)&test_bafcac72a590a4, &__wrap_test_bafcac72a590a4 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_8258179878173371796
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
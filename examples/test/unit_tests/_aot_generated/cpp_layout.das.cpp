@@ -0,0 +1,208 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_34430210933036755 {
+
+namespace  { struct S1; };
+namespace  { struct S2; };
+namespace  { struct CppS1; };
+namespace  { struct CppS2; };
+// unused enumeration GooEnum
+// unused enumeration OpCode
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+namespace  {
+
+struct S1 {
+    int64_t a;
+    int64_t b;
+    int32_t c;
+};
+static_assert(sizeof(S1)==24,"structure size mismatch with DAS");
+static_assert(offsetof(S1,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(S1,b)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(S1,c)==16,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct S2 {
+    int64_t a;
+    int64_t b;
+    int32_t c;
+    int32_t d;
+};
+static_assert(sizeof(S2)==24,"structure size mismatch with DAS");
+static_assert(offsetof(S2,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(S2,b)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(S2,c)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(S2,d)==20,"structure field offset mismatch with DAS");
+}
+
+#if 0 // skipping structure CppS1 declaration due to CPP layoutnamespace  {
+
+struct CppS1 {
+    void * vtable;
+    int64_t b;
+    int32_t c;
+};
+static_assert(sizeof(CppS1)==24,"structure size mismatch with DAS");
+static_assert(offsetof(CppS1,vtable)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(CppS1,b)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(CppS1,c)==16,"structure field offset mismatch with DAS");
+}
+#endif // end of skipping structure CppS1 declaration due to CPP layout
+
+#if 0 // skipping structure CppS2 declaration due to CPP layoutnamespace  {
+
+struct CppS2 : CppS1 {
+    /* skipping vtable, from CppS1 */
+    /* skipping b, from CppS1 */
+    /* skipping c, from CppS1 */
+    int32_t d;
+};
+static_assert(sizeof(CppS2)==24,"structure size mismatch with DAS");
+static_assert(offsetof(CppS2,vtable)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(CppS2,b)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(CppS2,c)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(CppS2,d)==20,"structure field offset mismatch with DAS");
+}
+#endif // end of skipping structure CppS2 declaration due to CPP layout
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline bool test_1d2bf958588794ac ( Context * __context__ );
+inline S1 S1_c193d2855326565c ( Context * __context__ );
+inline S2 S2_ffef47d3baf87083 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_1d2bf958588794ac ( Context * __context__ )
+{
+    DAS_VERIFY((CppS1Size() == 24));
+    DAS_VERIFY((CppS2Size() == 24));
+    DAS_VERIFY((CppS2DOffset() == 20));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline S1 S1_c193d2855326565c ( Context * __context__ )
+{
+    return /* <- */ das_auto_cast_move<S1>::cast((([&]() -> S1 {
+        S1 __mks_6;
+        das_copy((__mks_6.a),(INT64_C(1)));
+        das_copy((__mks_6.b),(INT64_C(2)));
+        das_copy((__mks_6.c),(3));
+        return __mks_6;
+    })()));
+}
+
+inline S2 S2_ffef47d3baf87083 ( Context * __context__ )
+{
+    return /* <- */ das_auto_cast_move<S2>::cast((([&]() -> S2 {
+        S2 __mks_12;
+        das_copy((__mks_12.a),(INT64_C(1)));
+        das_copy((__mks_12.b),(INT64_C(2)));
+        das_copy((__mks_12.c),(3));
+        das_copy((__mks_12.d),(4));
+        return __mks_12;
+    })()));
+}
+static vec4f __wrap_test_1d2bf958588794ac ( Context * __context__ ) {
+    return cast<bool>::from(test_1d2bf958588794ac(__context__));
+}
+static vec4f __wrap_S1_c193d2855326565c ( Context * __context__ ) {
+    *((S1 *) __context__->abiCMRES) = S1_c193d2855326565c(__context__);
+    return v_zero();
+}
+static vec4f __wrap_S2_ffef47d3baf87083 ( Context * __context__ ) {
+    *((S2 *) __context__->abiCMRES) = S2_ffef47d3baf87083(__context__);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x28a25f014755b6c9, false, (void*)&test_1d2bf958588794ac, &__wrap_test_1d2bf958588794ac },
+    { 0x68b2a057a394625, true, (void*)&S1_c193d2855326565c, &__wrap_S1_c193d2855326565c },
+    { 0x1243ce83667af45, true, (void*)&S2_ffef47d3baf87083, &__wrap_S2_ffef47d3baf87083 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_34430210933036755
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,167 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_8745754190462246560 {
+
+namespace  { struct Foo; };
+namespace  { struct Bar; };
+namespace  {
+
+struct Foo {
+    int32_t i;
+    float f;
+    char * s;
+    int64_t n;
+};
+static_assert(sizeof(Foo)==24,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,i)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,f)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,s)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,n)==16,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Bar {
+    int32_t i;
+};
+static_assert(sizeof(Bar)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Bar,i)==0,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline Bar Bar_fb60226f7cd830a3 ( Context * __context__ );
+inline bool test_7347a10181d35280 ( Context * __context__ );
+inline Foo Foo_567e574cb1581300 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Bar Bar_fb60226f7cd830a3 ( Context * __context__ )
+{
+    Bar __b_rename_at_16_0;das_zero(__b_rename_at_16_0);
+    das_copy(__b_rename_at_16_0.i,13);
+    return das_auto_cast_ref<Bar>::cast(__b_rename_at_16_0);
+}
+
+inline bool test_7347a10181d35280 ( Context * __context__ )
+{
+    Foo __t_rename_at_23_1_ConstRef = ((Foo)(([&]() -> Foo {
+        Foo __mks_23 = Foo_567e574cb1581300(__context__);
+        return __mks_23;
+    })()));
+    Foo const  & __t_rename_at_23_1 = __t_rename_at_23_1_ConstRef;
+;
+    DAS_ASSERT((__t_rename_at_23_1.i == 5));
+    Bar __b_rename_at_25_2_ConstRef = ((Bar)Bar_fb60226f7cd830a3(__context__));
+    Bar const  & __b_rename_at_25_2 = __b_rename_at_25_2_ConstRef;
+;
+    DAS_ASSERT((__b_rename_at_25_2.i == 13));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline Foo Foo_567e574cb1581300 ( Context * __context__ )
+{
+    return /* <- */ das_auto_cast_move<Foo>::cast((([&]() -> Foo {
+        Foo __mks_4;
+        das_zero(__mks_4);
+        das_copy((__mks_4.i),(5));
+        das_copy((__mks_4.f),(6.000000e+00f));
+        das_copy((__mks_4.s),(((char *) "hello")));
+        return __mks_4;
+    })()));
+}
+static vec4f __wrap_Bar_fb60226f7cd830a3 ( Context * __context__ ) {
+    *((Bar *) __context__->abiCMRES) = Bar_fb60226f7cd830a3(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_7347a10181d35280 ( Context * __context__ ) {
+    return cast<bool>::from(test_7347a10181d35280(__context__));
+}
+static vec4f __wrap_Foo_567e574cb1581300 ( Context * __context__ ) {
+    *((Foo *) __context__->abiCMRES) = Foo_567e574cb1581300(__context__);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x75441fe08577596f, true, (void*)&Bar_fb60226f7cd830a3, &__wrap_Bar_fb60226f7cd830a3 },
+    { 0xcacb0001b362403f, false, (void*)&test_7347a10181d35280, &__wrap_test_7347a10181d35280 },
+    { 0x7885fee139a7b559, true, (void*)&Foo_567e574cb1581300, &__wrap_Foo_567e574cb1581300 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_8745754190462246560
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,147 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_12065897965250376373 {
+
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+    int32_t a;
+    int32_t b;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==4,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void take_ea2f7eac09fc1e81 ( Context * __context__, Foo const  & __t_rename_at_8_0 );
+inline bool test_96a4ec8f6a58ecd7 ( Context * __context__ );
+inline Foo Foo_e7da834a21b2aea1 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void take_ea2f7eac09fc1e81 ( Context * __context__, Foo const  &  __t_rename_at_8_0 )
+{
+    DAS_ASSERT((__t_rename_at_8_0.a == 10));
+    DAS_ASSERT((__t_rename_at_8_0.b == -1));
+}
+
+inline bool test_96a4ec8f6a58ecd7 ( Context * __context__ )
+{
+    Foo _temp_make_local_15_9_0; _temp_make_local_15_9_0;
+    take_ea2f7eac09fc1e81(__context__,das_arg<Foo>::pass((([&]() -> Foo& {
+        _temp_make_local_15_9_0 = Foo_e7da834a21b2aea1(__context__);
+        das_copy((_temp_make_local_15_9_0.a),(10));
+        return _temp_make_local_15_9_0;
+    })())));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline Foo Foo_e7da834a21b2aea1 ( Context * __context__ )
+{
+    return /* <- */ das_auto_cast_move<Foo>::cast((([&]() -> Foo {
+        Foo __mks_2;
+        das_zero(__mks_2);
+        das_copy((__mks_2.b),(-1));
+        return __mks_2;
+    })()));
+}
+static vec4f __wrap_take_ea2f7eac09fc1e81 ( Context * __context__ ) {
+    Foo const  &  arg_t = cast_aot_arg<Foo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    take_ea2f7eac09fc1e81(__context__, arg_t);
+    return v_zero();
+}
+static vec4f __wrap_test_96a4ec8f6a58ecd7 ( Context * __context__ ) {
+    return cast<bool>::from(test_96a4ec8f6a58ecd7(__context__));
+}
+static vec4f __wrap_Foo_e7da834a21b2aea1 ( Context * __context__ ) {
+    *((Foo *) __context__->abiCMRES) = Foo_e7da834a21b2aea1(__context__);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x30dcfafed7f03beb, false, (void*)&take_ea2f7eac09fc1e81, &__wrap_take_ea2f7eac09fc1e81 },
+    { 0x207d39a6f048380b, false, (void*)&test_96a4ec8f6a58ecd7, &__wrap_test_96a4ec8f6a58ecd7 },
+    { 0xd5fa8b534d9533b0, true, (void*)&Foo_e7da834a21b2aea1, &__wrap_Foo_e7da834a21b2aea1 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_12065897965250376373
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
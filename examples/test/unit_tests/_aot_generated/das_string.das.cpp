@@ -0,0 +1,131 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_12989742832921464324 {
+
+// unused enumeration GooEnum
+// unused enumeration OpCode
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+extern TypeInfo __type_info__d67e75090dada73b;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __func_info__8e6bc7e25c6c4776_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 32, UINT64_C(0x683dd9d87a130f00), "s", 0, 0 };
+VarInfo __func_info__8e6bc7e25c6c4776_field_1 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 32, UINT64_C(0x7c6fbc4c199d6c28), "s2", 0, 0 };
+VarInfo * __func_info__8e6bc7e25c6c4776_fields[2] =  { &__func_info__8e6bc7e25c6c4776_field_0, &__func_info__8e6bc7e25c6c4776_field_1 };
+FuncInfo __func_info__8e6bc7e25c6c4776 = {"invoke block<(var s:$::das_string -const;var s2:$::das_string -const):void> const", "", __func_info__8e6bc7e25c6c4776_fields, 2, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x8e6bc7e25c6c4776), 0x0 };
+TypeInfo __type_info__d67e75090dada73b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 32, UINT64_C(0xd67e75090dada73b) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {__type_info__d67e75090dada73b, };
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__d67e75090dada73b };
+
+inline bool test_19504568c4896a7b ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_19504568c4896a7b ( Context * __context__ ) { das_stack_prologue __prologue(__context__,160,"test " DAS_FILE_LINE);
+{
+    test_das_string(das_make_block<void,das::string &,das::string &>(__context__,80,0,&__func_info__8e6bc7e25c6c4776,[&](das::string & __s_rename_at_8_0, das::string & __s2_rename_at_8_1) -> void{
+        set_das_string(das_arg<das::string>::pass(__s2_rename_at_8_1),((char *) "test_das_string"));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<das::string &>::from(__s_rename_at_8_0)))),cast<char *>::from(((char *) "test_das_string")),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(((char * const )(to_das_string(das_arg<das::string>::pass(__s_rename_at_8_0),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))),cast<char *>::from(((char *) "test_das_string")),*__context__,nullptr)));
+        peek_das_string_T(das_arg<das::string>::pass(__s_rename_at_8_0),[&](char * const  __st_rename_at_12_2) DAS_AOT_INLINE_LAMBDA -> void{
+            DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__st_rename_at_12_2),cast<char *>::from(((char *) "test_das_string")),*__context__,nullptr)));
+        },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        DAS_ASSERT((eq_dstr_str(das_arg<das::string>::pass(__s_rename_at_8_0),((char *) "test_das_string"))));
+        set_das_string(das_arg<das::string>::pass(__s_rename_at_8_0),((char *) "out_of_it"));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<das::string &>::from(__s_rename_at_8_0)))),cast<char *>::from(((char *) "out_of_it")),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(((char * const )(to_das_string(das_arg<das::string>::pass(__s_rename_at_8_0),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))),cast<char *>::from(((char *) "out_of_it")),*__context__,nullptr)));
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return das_auto_cast<bool>::cast(true);
+}}
+static vec4f __wrap_test_19504568c4896a7b ( Context * __context__ ) {
+    return cast<bool>::from(test_19504568c4896a7b(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xd8d8c1a824021f25, false, (void*)&test_19504568c4896a7b, &__wrap_test_19504568c4896a7b },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_12989742832921464324
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
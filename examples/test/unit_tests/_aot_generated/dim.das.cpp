@@ -0,0 +1,195 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_1218606762189811747 {
+
+extern TypeInfo __type_info__bd7ee1d9454968b9;
+extern TypeInfo __type_info__298d5db81cde3428;
+
+uint32_t __type_info__bd7ee1d9454968b9_dim[2] = { 2, 3 };
+TypeInfo __type_info__bd7ee1d9454968b9 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 2, __type_info__bd7ee1d9454968b9_dim, 286, 24, UINT64_C(0xbd7ee1d9454968b9) };
+uint32_t __type_info__298d5db81cde3428_dim[1] = { 3 };
+TypeInfo __type_info__298d5db81cde3428 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 1, __type_info__298d5db81cde3428_dim, 286, 12, UINT64_C(0x298d5db81cde3428) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__bd7ee1d9454968b9 };
+TypeInfo * __tinfo_1[1] = { &__type_info__298d5db81cde3428 };
+
+inline bool test_34d8ef95ffe771b ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global_zero<TDim<TDim<float,3>,2>,0x851c9c519b288fcd>(__context__);/*a*/
+}
+
+inline bool test_34d8ef95ffe771b ( Context * __context__ )
+{
+    {
+        bool __need_loop_13 = true;
+        // y: int const
+        das_iterator<range> __y_iterator(range(0,2));
+        int32_t __y_rename_at_13_0;
+        __need_loop_13 = __y_iterator.first(__context__,(__y_rename_at_13_0)) && __need_loop_13;
+        for ( ; __need_loop_13 ; __need_loop_13 = __y_iterator.next(__context__,(__y_rename_at_13_0)) )
+        {
+            {
+                bool __need_loop_14 = true;
+                // x: int const
+                das_iterator<range> __x_iterator(range(0,3));
+                int32_t __x_rename_at_14_1;
+                __need_loop_14 = __x_iterator.first(__context__,(__x_rename_at_14_1)) && __need_loop_14;
+                for ( ; __need_loop_14 ; __need_loop_14 = __x_iterator.next(__context__,(__x_rename_at_14_1)) )
+                {
+                    float __f_rename_at_15_2 = float((__y_rename_at_13_0 * 10) + __x_rename_at_14_1);
+                    das_copy(das_global<TDim<TDim<float,3>,2>,0x851c9c519b288fcd>(__context__) /*a*/(__y_rename_at_13_0,__context__)(__x_rename_at_14_1,__context__),__f_rename_at_15_2);
+                }
+                __x_iterator.close(__context__,(__x_rename_at_14_1));
+            };
+        }
+        __y_iterator.close(__context__,(__y_rename_at_13_0));
+    };
+    {
+        bool __need_loop_20 = true;
+        // y: int const
+        das_iterator<range> __y_iterator(range(0,2));
+        int32_t __y_rename_at_20_3;
+        __need_loop_20 = __y_iterator.first(__context__,(__y_rename_at_20_3)) && __need_loop_20;
+        for ( ; __need_loop_20 ; __need_loop_20 = __y_iterator.next(__context__,(__y_rename_at_20_3)) )
+        {
+            {
+                bool __need_loop_21 = true;
+                // x: int const
+                das_iterator<range> __x_iterator(range(0,3));
+                int32_t __x_rename_at_21_4;
+                __need_loop_21 = __x_iterator.first(__context__,(__x_rename_at_21_4)) && __need_loop_21;
+                for ( ; __need_loop_21 ; __need_loop_21 = __x_iterator.next(__context__,(__x_rename_at_21_4)) )
+                {
+                    float __f_rename_at_22_5 = float((__y_rename_at_20_3 * 10) + __x_rename_at_21_4);
+                    DAS_ASSERT((das_global<TDim<TDim<float,3>,2>,0x851c9c519b288fcd>(__context__) /*a*/(__y_rename_at_20_3,__context__)(__x_rename_at_21_4,__context__) == __f_rename_at_22_5));
+                }
+                __x_iterator.close(__context__,(__x_rename_at_21_4));
+            };
+        }
+        __y_iterator.close(__context__,(__y_rename_at_20_3));
+    };
+    float * __pa_rename_at_28_6 = das_ref(__context__,das_global<TDim<TDim<float,3>,2>,0x851c9c519b288fcd>(__context__) /*a*/(0,__context__)(0,__context__));
+    {
+        bool __need_loop_29 = true;
+        // y: int const
+        das_iterator<range> __y_iterator(range(0,2));
+        int32_t __y_rename_at_29_7;
+        __need_loop_29 = __y_iterator.first(__context__,(__y_rename_at_29_7)) && __need_loop_29;
+        for ( ; __need_loop_29 ; __need_loop_29 = __y_iterator.next(__context__,(__y_rename_at_29_7)) )
+        {
+            {
+                bool __need_loop_30 = true;
+                // x: int const
+                das_iterator<range> __x_iterator(range(0,3));
+                int32_t __x_rename_at_30_8;
+                __need_loop_30 = __x_iterator.first(__context__,(__x_rename_at_30_8)) && __need_loop_30;
+                for ( ; __need_loop_30 ; __need_loop_30 = __x_iterator.next(__context__,(__x_rename_at_30_8)) )
+                {
+                    int32_t __o_rename_at_31_9 = (__x_rename_at_30_8 + (__y_rename_at_29_7 * 3));
+                    float __f_rename_at_32_10 = float((__y_rename_at_29_7 * 10) + __x_rename_at_30_8);
+                    DAS_ASSERT((das_index<float *>::at(__pa_rename_at_28_6,__o_rename_at_31_9,__context__) == __f_rename_at_32_10));
+                }
+                __x_iterator.close(__context__,(__x_rename_at_30_8));
+            };
+        }
+        __y_iterator.close(__context__,(__y_rename_at_29_7));
+    };
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<TDim<TDim<float,3>,2> &>::from(das_global<TDim<TDim<float,3>,2>,0x851c9c519b288fcd>(__context__) /*a*/)))),cast<char *>::from(((char *) "[[ [[ 0; 1; 2]]; [[ 10; 11; 12]]]]")),*__context__,nullptr)));
+    TDim<float,3> __a0_rename_at_40_11 = das_global<TDim<TDim<float,3>,2>,0x851c9c519b288fcd>(__context__) /*a*/(0,__context__);
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_1, cast<TDim<float,3> &>::from(__a0_rename_at_40_11)))),cast<char *>::from(((char *) "[[ 0; 1; 2]]")),*__context__,nullptr)));
+    TDim<float,3> __a1_rename_at_42_12 = das_global<TDim<TDim<float,3>,2>,0x851c9c519b288fcd>(__context__) /*a*/(1,__context__);
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_1, cast<TDim<float,3> &>::from(__a1_rename_at_42_12)))),cast<char *>::from(((char *) "[[ 10; 11; 12]]")),*__context__,nullptr)));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_test_34d8ef95ffe771b ( Context * __context__ ) {
+    return cast<bool>::from(test_34d8ef95ffe771b(__context__));
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x97ae7e6c62fca628, false, (void*)&test_34d8ef95ffe771b, &__wrap_test_34d8ef95ffe771b },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x9cafe29ccec00116, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_1218606762189811747
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,269 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14108525023375507527 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline int32_t _FuncTickdiv_by_zeroTick13045041034762527208_b2f57ca52722eb7a ( Context * __context__, int32_t __num_rename_at_3_0 );
+inline int32_t _FuncTickmod_by_zeroTick13827755104530153577_2f6356a06e34f9fd ( Context * __context__, int32_t __num_rename_at_15_2 );
+inline uint32_t _FuncTickdiv_by_zeroTick13045041034762527208_9daf7f75e020c981 ( Context * __context__, uint32_t __num_rename_at_3_4 );
+inline uint32_t _FuncTickmod_by_zeroTick13827755104530153577_e770afb8e3d741e4 ( Context * __context__, uint32_t __num_rename_at_15_6 );
+inline int64_t _FuncTickdiv_by_zeroTick13045041034762527208_40f15e2f5fd21461 ( Context * __context__, int64_t __num_rename_at_3_8 );
+inline int64_t _FuncTickmod_by_zeroTick13827755104530153577_d75fba5c1207213a ( Context * __context__, int64_t __num_rename_at_15_10 );
+inline uint64_t _FuncTickdiv_by_zeroTick13045041034762527208_a195c8437eee67d7 ( Context * __context__, uint64_t __num_rename_at_3_12 );
+inline uint64_t _FuncTickmod_by_zeroTick13827755104530153577_b019432d249becbe ( Context * __context__, uint64_t __num_rename_at_15_14 );
+inline bool test_16ae574374201fee ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t _FuncTickdiv_by_zeroTick13045041034762527208_b2f57ca52722eb7a ( Context * __context__, int32_t __num_rename_at_3_0 )
+{
+    bool __ex_rename_at_4_1 = false;
+    das_try_recover(__context__, [&]()
+    {
+        return das_auto_cast<int32_t>::cast(SimPolicy<int32_t>::Div(__num_rename_at_3_0,0,*__context__,nullptr));
+    }, [&]()
+    {
+        das_copy(__ex_rename_at_4_1,true);
+    });
+    DAS_ASSERT((__ex_rename_at_4_1));
+    return das_auto_cast<int32_t>::cast(__num_rename_at_3_0);
+}
+
+inline int32_t _FuncTickmod_by_zeroTick13827755104530153577_2f6356a06e34f9fd ( Context * __context__, int32_t __num_rename_at_15_2 )
+{
+    bool __ex_rename_at_16_3 = false;
+    das_try_recover(__context__, [&]()
+    {
+        return das_auto_cast<int32_t>::cast(SimPolicy<int32_t>::Mod(__num_rename_at_15_2,0,*__context__,nullptr));
+    }, [&]()
+    {
+        das_copy(__ex_rename_at_16_3,true);
+    });
+    DAS_ASSERT((__ex_rename_at_16_3));
+    return das_auto_cast<int32_t>::cast(__num_rename_at_15_2);
+}
+
+inline uint32_t _FuncTickdiv_by_zeroTick13045041034762527208_9daf7f75e020c981 ( Context * __context__, uint32_t __num_rename_at_3_4 )
+{
+    bool __ex_rename_at_4_5 = false;
+    das_try_recover(__context__, [&]()
+    {
+        return das_auto_cast<uint32_t>::cast(SimPolicy<uint32_t>::Div(__num_rename_at_3_4,0x0u,*__context__,nullptr));
+    }, [&]()
+    {
+        das_copy(__ex_rename_at_4_5,true);
+    });
+    DAS_ASSERT((__ex_rename_at_4_5));
+    return das_auto_cast<uint32_t>::cast(__num_rename_at_3_4);
+}
+
+inline uint32_t _FuncTickmod_by_zeroTick13827755104530153577_e770afb8e3d741e4 ( Context * __context__, uint32_t __num_rename_at_15_6 )
+{
+    bool __ex_rename_at_16_7 = false;
+    das_try_recover(__context__, [&]()
+    {
+        return das_auto_cast<uint32_t>::cast(SimPolicy<uint32_t>::Mod(__num_rename_at_15_6,0x0u,*__context__,nullptr));
+    }, [&]()
+    {
+        das_copy(__ex_rename_at_16_7,true);
+    });
+    DAS_ASSERT((__ex_rename_at_16_7));
+    return das_auto_cast<uint32_t>::cast(__num_rename_at_15_6);
+}
+
+inline int64_t _FuncTickdiv_by_zeroTick13045041034762527208_40f15e2f5fd21461 ( Context * __context__, int64_t __num_rename_at_3_8 )
+{
+    bool __ex_rename_at_4_9 = false;
+    das_try_recover(__context__, [&]()
+    {
+        return das_auto_cast<int64_t>::cast(SimPolicy<int64_t>::Div(__num_rename_at_3_8,INT64_C(0),*__context__,nullptr));
+    }, [&]()
+    {
+        das_copy(__ex_rename_at_4_9,true);
+    });
+    DAS_ASSERT((__ex_rename_at_4_9));
+    return das_auto_cast<int64_t>::cast(__num_rename_at_3_8);
+}
+
+inline int64_t _FuncTickmod_by_zeroTick13827755104530153577_d75fba5c1207213a ( Context * __context__, int64_t __num_rename_at_15_10 )
+{
+    bool __ex_rename_at_16_11 = false;
+    das_try_recover(__context__, [&]()
+    {
+        return das_auto_cast<int64_t>::cast(SimPolicy<int64_t>::Mod(__num_rename_at_15_10,INT64_C(0),*__context__,nullptr));
+    }, [&]()
+    {
+        das_copy(__ex_rename_at_16_11,true);
+    });
+    DAS_ASSERT((__ex_rename_at_16_11));
+    return das_auto_cast<int64_t>::cast(__num_rename_at_15_10);
+}
+
+inline uint64_t _FuncTickdiv_by_zeroTick13045041034762527208_a195c8437eee67d7 ( Context * __context__, uint64_t __num_rename_at_3_12 )
+{
+    bool __ex_rename_at_4_13 = false;
+    das_try_recover(__context__, [&]()
+    {
+        return das_auto_cast<uint64_t>::cast(SimPolicy<uint64_t>::Div(__num_rename_at_3_12,UINT64_C(0x0),*__context__,nullptr));
+    }, [&]()
+    {
+        das_copy(__ex_rename_at_4_13,true);
+    });
+    DAS_ASSERT((__ex_rename_at_4_13));
+    return das_auto_cast<uint64_t>::cast(__num_rename_at_3_12);
+}
+
+inline uint64_t _FuncTickmod_by_zeroTick13827755104530153577_b019432d249becbe ( Context * __context__, uint64_t __num_rename_at_15_14 )
+{
+    bool __ex_rename_at_16_15 = false;
+    das_try_recover(__context__, [&]()
+    {
+        return das_auto_cast<uint64_t>::cast(SimPolicy<uint64_t>::Mod(__num_rename_at_15_14,UINT64_C(0x0),*__context__,nullptr));
+    }, [&]()
+    {
+        das_copy(__ex_rename_at_16_15,true);
+    });
+    DAS_ASSERT((__ex_rename_at_16_15));
+    return das_auto_cast<uint64_t>::cast(__num_rename_at_15_14);
+}
+
+inline bool test_16ae574374201fee ( Context * __context__ )
+{
+    DAS_VERIFY((_FuncTickdiv_by_zeroTick13045041034762527208_b2f57ca52722eb7a(__context__,1) == 1));
+    DAS_VERIFY((_FuncTickmod_by_zeroTick13827755104530153577_2f6356a06e34f9fd(__context__,1) == 1));
+    DAS_VERIFY((_FuncTickdiv_by_zeroTick13045041034762527208_9daf7f75e020c981(__context__,0x1u) == 0x1u));
+    DAS_VERIFY((_FuncTickmod_by_zeroTick13827755104530153577_e770afb8e3d741e4(__context__,0x1u) == 0x1u));
+    DAS_VERIFY((_FuncTickdiv_by_zeroTick13045041034762527208_40f15e2f5fd21461(__context__,INT64_C(1)) == INT64_C(1)));
+    DAS_VERIFY((_FuncTickmod_by_zeroTick13827755104530153577_d75fba5c1207213a(__context__,INT64_C(1)) == INT64_C(1)));
+    DAS_VERIFY((_FuncTickdiv_by_zeroTick13045041034762527208_a195c8437eee67d7(__context__,UINT64_C(0x1)) == UINT64_C(0x1)));
+    DAS_VERIFY((_FuncTickmod_by_zeroTick13827755104530153577_b019432d249becbe(__context__,UINT64_C(0x1)) == UINT64_C(0x1)));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncTickdiv_by_zeroTick13045041034762527208_b2f57ca52722eb7a ( Context * __context__ ) {
+    int32_t arg_num = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(_FuncTickdiv_by_zeroTick13045041034762527208_b2f57ca52722eb7a(__context__, arg_num));
+}
+static vec4f __wrap__FuncTickmod_by_zeroTick13827755104530153577_2f6356a06e34f9fd ( Context * __context__ ) {
+    int32_t arg_num = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(_FuncTickmod_by_zeroTick13827755104530153577_2f6356a06e34f9fd(__context__, arg_num));
+}
+static vec4f __wrap__FuncTickdiv_by_zeroTick13045041034762527208_9daf7f75e020c981 ( Context * __context__ ) {
+    uint32_t arg_num = cast_aot_arg<uint32_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<uint32_t>::from(_FuncTickdiv_by_zeroTick13045041034762527208_9daf7f75e020c981(__context__, arg_num));
+}
+static vec4f __wrap__FuncTickmod_by_zeroTick13827755104530153577_e770afb8e3d741e4 ( Context * __context__ ) {
+    uint32_t arg_num = cast_aot_arg<uint32_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<uint32_t>::from(_FuncTickmod_by_zeroTick13827755104530153577_e770afb8e3d741e4(__context__, arg_num));
+}
+static vec4f __wrap__FuncTickdiv_by_zeroTick13045041034762527208_40f15e2f5fd21461 ( Context * __context__ ) {
+    int64_t arg_num = cast_aot_arg<int64_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int64_t>::from(_FuncTickdiv_by_zeroTick13045041034762527208_40f15e2f5fd21461(__context__, arg_num));
+}
+static vec4f __wrap__FuncTickmod_by_zeroTick13827755104530153577_d75fba5c1207213a ( Context * __context__ ) {
+    int64_t arg_num = cast_aot_arg<int64_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int64_t>::from(_FuncTickmod_by_zeroTick13827755104530153577_d75fba5c1207213a(__context__, arg_num));
+}
+static vec4f __wrap__FuncTickdiv_by_zeroTick13045041034762527208_a195c8437eee67d7 ( Context * __context__ ) {
+    uint64_t arg_num = cast_aot_arg<uint64_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<uint64_t>::from(_FuncTickdiv_by_zeroTick13045041034762527208_a195c8437eee67d7(__context__, arg_num));
+}
+static vec4f __wrap__FuncTickmod_by_zeroTick13827755104530153577_b019432d249becbe ( Context * __context__ ) {
+    uint64_t arg_num = cast_aot_arg<uint64_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<uint64_t>::from(_FuncTickmod_by_zeroTick13827755104530153577_b019432d249becbe(__context__, arg_num));
+}
+static vec4f __wrap_test_16ae574374201fee ( Context * __context__ ) {
+    return cast<bool>::from(test_16ae574374201fee(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x1379d5c300bd4cea, false, (void*)&_FuncTickdiv_by_zeroTick13045041034762527208_b2f57ca52722eb7a, &__wrap__FuncTickdiv_by_zeroTick13045041034762527208_b2f57ca52722eb7a },
+    { 0x4d140d2b9244a72a, false, (void*)&_FuncTickmod_by_zeroTick13827755104530153577_2f6356a06e34f9fd, &__wrap__FuncTickmod_by_zeroTick13827755104530153577_2f6356a06e34f9fd },
+    { 0xbdae42a0817d968c, false, (void*)&_FuncTickdiv_by_zeroTick13045041034762527208_9daf7f75e020c981, &__wrap__FuncTickdiv_by_zeroTick13045041034762527208_9daf7f75e020c981 },
+    { 0x3018dc3d6800e1af, false, (void*)&_FuncTickmod_by_zeroTick13827755104530153577_e770afb8e3d741e4, &__wrap__FuncTickmod_by_zeroTick13827755104530153577_e770afb8e3d741e4 },
+    { 0x3158d283180bd4f3, false, (void*)&_FuncTickdiv_by_zeroTick13045041034762527208_40f15e2f5fd21461, &__wrap__FuncTickdiv_by_zeroTick13045041034762527208_40f15e2f5fd21461 },
+    { 0x6d01d784ee8bd88a, false, (void*)&_FuncTickmod_by_zeroTick13827755104530153577_d75fba5c1207213a, &__wrap__FuncTickmod_by_zeroTick13827755104530153577_d75fba5c1207213a },
+    { 0x9abb582e5850259a, false, (void*)&_FuncTickdiv_by_zeroTick13045041034762527208_a195c8437eee67d7, &__wrap__FuncTickdiv_by_zeroTick13045041034762527208_a195c8437eee67d7 },
+    { 0x8bb7c40e5895d200, false, (void*)&_FuncTickmod_by_zeroTick13827755104530153577_b019432d249becbe, &__wrap__FuncTickmod_by_zeroTick13827755104530153577_b019432d249becbe },
+    { 0xb4a6d2df23493930, false, (void*)&test_16ae574374201fee, &__wrap_test_16ae574374201fee },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_14108525023375507527
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
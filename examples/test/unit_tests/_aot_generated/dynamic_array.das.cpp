@@ -0,0 +1,287 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14813017452236568865 {
+
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__bcb97beea857e3e;
+extern TypeInfo __type_info__c4e7914a3746eb3e;
+extern TypeInfo __type_info__af63e44c8601fa24;
+
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__bcb97beea857e3e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xbcb97beea857e3e) };
+TypeInfo __type_info__c4e7914a3746eb3e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xc4e7914a3746eb3e) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__bcb97beea857e3e, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_1[2] = { &__type_info__c4e7914a3746eb3e, &__type_info__af90fe4c864e9d52 };
+
+inline void _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5 ( Context * __context__, TArray<int32_t> & __a_rename_at_32_0, TArray<int32_t> & __b_rename_at_32_1 );
+inline void _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_177_2, int32_t __value_rename_at_177_3 );
+inline void _FuncTickpass_arrayTick8449743361169334616_efe36011e9f356f5 ( Context * __context__, TArray<int32_t> & __arr_rename_at_4_4 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_68_5, int32_t __newSize_rename_at_68_6 );
+inline void _FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_137_7, int32_t __newSize_rename_at_137_8 );
+inline void _FuncbuiltinTickpushTick14934788096129379580_9c3c2abdcd3c6241 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_149_9, int32_t __value_rename_at_149_10, int32_t __at_rename_at_149_11 );
+inline void _FuncbuiltinTickeraseTick16646986352019611268_7aa29df899f2f2e8 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_552_12, int32_t __at_rename_at_552_13 );
+inline bool test_a5843e9ed19f5755 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5 ( Context * __context__, TArray<int32_t> &  __a_rename_at_32_0, TArray<int32_t> &  __b_rename_at_32_1 )
+{
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<TArray<int32_t> &>::from(__a_rename_at_32_0),cast<char * const >::from(((char *) "object can't be moved to because it is locked"))));
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<TArray<int32_t> &>::from(__b_rename_at_32_1),cast<char * const >::from(((char *) "object can't be moved from because it is locked"))));
+    das_move(__a_rename_at_32_0,__b_rename_at_32_1);
+}
+
+inline void _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_177_2, int32_t __value_rename_at_177_3 )
+{
+    das_copy(__Arr_rename_at_177_2(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_177_2),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_177_3);
+}
+
+inline void _FuncTickpass_arrayTick8449743361169334616_efe36011e9f356f5 ( Context * __context__, TArray<int32_t> &  __arr_rename_at_4_4 )
+{
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_4_4),4);
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_68_5, int32_t __newSize_rename_at_68_6 )
+{
+    builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_68_5),__newSize_rename_at_68_6,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_137_7, int32_t __newSize_rename_at_137_8 )
+{
+    builtin_array_reserve(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_137_7),__newSize_rename_at_137_8,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickpushTick14934788096129379580_9c3c2abdcd3c6241 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_149_9, int32_t __value_rename_at_149_10, int32_t __at_rename_at_149_11 )
+{
+    das_copy(__Arr_rename_at_149_9(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_149_9),__at_rename_at_149_11,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_149_10);
+}
+
+inline void _FuncbuiltinTickeraseTick16646986352019611268_7aa29df899f2f2e8 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_552_12, int32_t __at_rename_at_552_13 )
+{
+    builtin_array_erase(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_552_12),__at_rename_at_552_13,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline bool test_a5843e9ed19f5755 ( Context * __context__ )
+{
+    TArray<int32_t> __arr_rename_at_11_14;das_zero(__arr_rename_at_11_14); TArray<int32_t> __arr2_rename_at_11_15;das_zero(__arr2_rename_at_11_15);
+    DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14)) == 0),(((char *) "array starts at 0 length")));
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14),1);
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14),2);
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14),3);
+    DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14)) == 3),(((char *) "array length is 3")));
+    DAS_ASSERTF((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14)) == 16),(((char *) "its 2x, but no less than 16")));
+    _FuncTickpass_arrayTick8449743361169334616_efe36011e9f356f5(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14));
+    DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14)) == 4),(((char *) "array length is 4")));
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14),6);
+    DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14)) == 6),(((char *) "array length is now 6")));
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14),17);
+    DAS_ASSERTF((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14)) == 32),(((char *) "now bigger")));
+    _FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14),33);
+    DAS_ASSERTF((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14)) == 33),(((char *) "now even bigger")));
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14),4);
+    DAS_ASSERTF((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14)) == 33),(((char *) "did not grow smaller")));
+    DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14)) == 4),(((char *) "resized properly")));
+    _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5(__context__,das_arg<TArray<int32_t>>::pass(__arr2_rename_at_11_15),das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14));
+    DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14)) == 0));
+    DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr2_rename_at_11_15)) == 4));
+    int32_t __index_rename_at_33_16 = 0;
+    while ( __index_rename_at_33_16 < 4 )
+    {
+        ++__arr2_rename_at_11_15(__index_rename_at_33_16++,__context__);
+    };
+    _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14),das_arg<TArray<int32_t>>::pass(__arr2_rename_at_11_15));
+    DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr2_rename_at_11_15)) == 0));
+    DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14)) == 4));
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14),3);
+    DAS_ASSERT((__arr_rename_at_11_14(2,__context__) == 4));
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14),4);
+    DAS_ASSERTF((__arr_rename_at_11_14(3,__context__) == 0),(((char *) "new element after resize is 0")));
+    _FuncbuiltinTickpushTick14934788096129379580_9c3c2abdcd3c6241(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14),1,0);
+    {
+        bool __need_loop_45 = true;
+        // t: int const
+        das_iterator<range> __t_iterator(range(1,5));
+        int32_t __t_rename_at_45_17;
+        __need_loop_45 = __t_iterator.first(__context__,(__t_rename_at_45_17)) && __need_loop_45;
+        for ( ; __need_loop_45 ; __need_loop_45 = __t_iterator.next(__context__,(__t_rename_at_45_17)) )
+        {
+            DAS_ASSERT((__arr_rename_at_11_14((__t_rename_at_45_17 - 1),__context__) == __t_rename_at_45_17));
+        }
+        __t_iterator.close(__context__,(__t_rename_at_45_17));
+    };
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14),4);
+    _FuncbuiltinTickpushTick14934788096129379580_9c3c2abdcd3c6241(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14),5,4);
+    _FuncbuiltinTickpushTick14934788096129379580_9c3c2abdcd3c6241(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14),7,2);
+    _FuncbuiltinTickeraseTick16646986352019611268_7aa29df899f2f2e8(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14),2);
+    {
+        bool __need_loop_52 = true;
+        // t: int const
+        das_iterator<range> __t_iterator(range(1,5));
+        int32_t __t_rename_at_52_18;
+        __need_loop_52 = __t_iterator.first(__context__,(__t_rename_at_52_18)) && __need_loop_52;
+        for ( ; __need_loop_52 ; __need_loop_52 = __t_iterator.next(__context__,(__t_rename_at_52_18)) )
+        {
+            DAS_ASSERT((__arr_rename_at_11_14((__t_rename_at_52_18 - 1),__context__) == __t_rename_at_52_18));
+        }
+        __t_iterator.close(__context__,(__t_rename_at_52_18));
+    };
+    _FuncbuiltinTickeraseTick16646986352019611268_7aa29df899f2f2e8(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14),0);
+    _FuncbuiltinTickeraseTick16646986352019611268_7aa29df899f2f2e8(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_11_14),3);
+    {
+        bool __need_loop_57 = true;
+        // t: int const
+        das_iterator<range> __t_iterator(range(2,4));
+        int32_t __t_rename_at_57_19;
+        __need_loop_57 = __t_iterator.first(__context__,(__t_rename_at_57_19)) && __need_loop_57;
+        for ( ; __need_loop_57 ; __need_loop_57 = __t_iterator.next(__context__,(__t_rename_at_57_19)) )
+        {
+            DAS_ASSERT((__arr_rename_at_11_14((__t_rename_at_57_19 - 2),__context__) == __t_rename_at_57_19));
+        }
+        __t_iterator.close(__context__,(__t_rename_at_57_19));
+    };
+    TArray<int32_t> __a_rename_at_61_20;das_zero(__a_rename_at_61_20);
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_61_20),1);
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_61_20),2);
+    TArray<int32_t> __b_rename_at_64_21_ConstRef; das_zero(__b_rename_at_64_21_ConstRef); das_move(__b_rename_at_64_21_ConstRef, ((TArray<int32_t>)__a_rename_at_61_20));
+    TArray<int32_t> const  & __b_rename_at_64_21 = __b_rename_at_64_21_ConstRef;
+;
+    DAS_ASSERT(((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_61_20)) == 0) && (builtin_array_size(__b_rename_at_64_21) == 2)));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> &  arg_b = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_value = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickpass_arrayTick8449743361169334616_efe36011e9f356f5 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickpass_arrayTick8449743361169334616_efe36011e9f356f5(__context__, arg_arr);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpushTick14934788096129379580_9c3c2abdcd3c6241 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_value = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_at = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    _FuncbuiltinTickpushTick14934788096129379580_9c3c2abdcd3c6241(__context__, arg_Arr, arg_value, arg_at);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeraseTick16646986352019611268_7aa29df899f2f2e8 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_at = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickeraseTick16646986352019611268_7aa29df899f2f2e8(__context__, arg_Arr, arg_at);
+    return v_zero();
+}
+static vec4f __wrap_test_a5843e9ed19f5755 ( Context * __context__ ) {
+    return cast<bool>::from(test_a5843e9ed19f5755(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x5e8700914eff1e69, false, (void*)&_FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5, &__wrap__FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5 },
+    { 0xbf77bb210b0552bc, false, (void*)&_FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39, &__wrap__FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 },
+    { 0xad0902b7628c9345, false, (void*)&_FuncTickpass_arrayTick8449743361169334616_efe36011e9f356f5, &__wrap__FuncTickpass_arrayTick8449743361169334616_efe36011e9f356f5 },
+    { 0xa51a880d594e91fd, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c },
+    { 0x78ccaa663d73fb1b, false, (void*)&_FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76, &__wrap__FuncbuiltinTickreserveTick3994685146752941225_77ab82cf50861f76 },
+    { 0xdd16a56ebb633df, false, (void*)&_FuncbuiltinTickpushTick14934788096129379580_9c3c2abdcd3c6241, &__wrap__FuncbuiltinTickpushTick14934788096129379580_9c3c2abdcd3c6241 },
+    { 0x1d0e1084132403d5, false, (void*)&_FuncbuiltinTickeraseTick16646986352019611268_7aa29df899f2f2e8, &__wrap__FuncbuiltinTickeraseTick16646986352019611268_7aa29df899f2f2e8 },
+    { 0xe7a19fb0a15cdf0e, false, (void*)&test_a5843e9ed19f5755, &__wrap_test_a5843e9ed19f5755 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_14813017452236568865
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
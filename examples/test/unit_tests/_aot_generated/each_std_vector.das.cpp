@@ -0,0 +1,162 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_13643051443107872378 {
+
+// unused enumeration GooEnum
+// unused enumeration OpCode
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+extern TypeInfo __type_info__af63df4c8601f1a5;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __func_info__fd40c84b9b208855_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~UnitTest::TestObjectFoo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8238, 56, UINT64_C(0xc7ed2a45450171b5), "foo", 0, 0 };
+VarInfo * __func_info__fd40c84b9b208855_fields[1] =  { &__func_info__fd40c84b9b208855_field_0 };
+FuncInfo __func_info__fd40c84b9b208855 = {"invoke block<(foo:UnitTest::TestObjectFoo const):bool> const", "", __func_info__fd40c84b9b208855_fields, 1, 32, &__type_info__af63df4c8601f1a5, nullptr,0,UINT64_C(0xfd40c84b9b208855), 0x0 };
+VarInfo __func_info__b317828cdc5e69ee_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~$::dasvector`TestObjectFoo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8194, 24, UINT64_C(0xd4d354a1daf9f350), "arr", 0, 0 };
+VarInfo * __func_info__b317828cdc5e69ee_fields[1] =  { &__func_info__b317828cdc5e69ee_field_0 };
+FuncInfo __func_info__b317828cdc5e69ee = {"invoke block<(var arr:$::dasvector`TestObjectFoo):void> const", "", __func_info__b317828cdc5e69ee_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xb317828cdc5e69ee), 0x0 };
+TypeInfo __type_info__af63df4c8601f1a5 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xaf63df4c8601f1a5) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline int32_t _FuncbuiltinTickfind_index_ifTick4436313710217261332_b2de2b56af25c8e1 ( Context * __context__, Sequence DAS_COMMENT((TestObjectFoo &)) & __arr_rename_at_1886_0, Block DAS_COMMENT((bool,TestObjectFoo const )) const  & __blk_rename_at_1886_1 );
+inline bool test_c0bfa001606f2773 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t _FuncbuiltinTickfind_index_ifTick4436313710217261332_b2de2b56af25c8e1 ( Context * __context__, Sequence DAS_COMMENT((TestObjectFoo &)) &  __arr_rename_at_1886_0, Block DAS_COMMENT((bool,TestObjectFoo const )) const  &  __blk_rename_at_1886_1 )
+{
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_1887_22_0; _temp_make_local_1887_22_0;
+    {
+        bool __need_loop_1887 = true;
+        // o: UnitTest::TestObjectFoo aka TT&
+        das_iterator<Sequence DAS_COMMENT((TestObjectFoo))> __o_iterator(__arr_rename_at_1886_0);
+        TestObjectFoo * __o_rename_at_1887_4;
+        __need_loop_1887 = __o_iterator.first(__context__,(__o_rename_at_1887_4)) && __need_loop_1887;
+        // i: int
+        das_iterator_count DAS_COMMENT((_temp_make_local_1887_22_0 = (builtin_count(0,1,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))) __i_iterator(0,1);
+        int32_t __i_rename_at_1887_5;
+        __need_loop_1887 = __i_iterator.first(__context__,(__i_rename_at_1887_5)) && __need_loop_1887;
+        for ( ; __need_loop_1887 ; __need_loop_1887 = __o_iterator.next(__context__,(__o_rename_at_1887_4)) && __i_iterator.next(__context__,(__i_rename_at_1887_5)) )
+        {
+            if ( das_invoke<bool>::invoke<TestObjectFoo &>(__context__,nullptr,__blk_rename_at_1886_1,das_arg<TestObjectFoo>::pass((*__o_rename_at_1887_4))) )
+            {
+                return das_auto_cast<int32_t>::cast(__i_rename_at_1887_5);
+            };
+        }
+        __i_iterator.close(__context__,(__i_rename_at_1887_5));
+        __o_iterator.close(__context__,(__o_rename_at_1887_4));
+    };
+    return das_auto_cast<int32_t>::cast(-1);
+}
+
+inline bool test_c0bfa001606f2773 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,192,"test " DAS_FILE_LINE);
+{
+    testFooArray(das_make_block<void,das::vector<TestObjectFoo> &>(__context__,80,0,&__func_info__b317828cdc5e69ee,[&](das::vector<TestObjectFoo> & __arr_rename_at_6_6) -> void{
+        Sequence DAS_COMMENT((TestObjectFoo *)) _temp_make_local_9_34_1; _temp_make_local_9_34_1;
+        DAS_VERIFY((das_vector_length(das_arg<das::vector<TestObjectFoo>>::pass(__arr_rename_at_6_6)) == 10));
+        DAS_VERIFY((das_vector_capacity(das_arg<das::vector<TestObjectFoo>>::pass(__arr_rename_at_6_6)) == 16));
+        int32_t __index_rename_at_9_7 = ((int32_t)_FuncbuiltinTickfind_index_ifTick4436313710217261332_b2de2b56af25c8e1(__context__,das_arg<Sequence DAS_COMMENT((TestObjectFoo))>::pass((_temp_make_local_9_34_1 = (das_vector_each(das_arg<das::vector<TestObjectFoo>>::pass(__arr_rename_at_6_6),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))),das_make_block<bool,TestObjectFoo const  &>(__context__,176,0,&__func_info__fd40c84b9b208855,[&](TestObjectFoo const  & __foo_rename_at_9_8) -> bool{
+            return das_auto_cast<bool>::cast(__foo_rename_at_9_8.fooData /*fooData*/ == 5);
+        })));
+        DAS_ASSERT((__index_rename_at_9_7 == 5));
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return das_auto_cast<bool>::cast(true);
+}}
+static vec4f __wrap__FuncbuiltinTickfind_index_ifTick4436313710217261332_b2de2b56af25c8e1 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((TestObjectFoo &)) &  arg_arr = cast_aot_arg<Sequence DAS_COMMENT((TestObjectFoo &)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((bool,TestObjectFoo const )) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((bool,TestObjectFoo const )) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t>::from(_FuncbuiltinTickfind_index_ifTick4436313710217261332_b2de2b56af25c8e1(__context__, arg_arr, arg_blk));
+}
+static vec4f __wrap_test_c0bfa001606f2773 ( Context * __context__ ) {
+    return cast<bool>::from(test_c0bfa001606f2773(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x1dceeb13b1992c9a, false, (void*)&_FuncbuiltinTickfind_index_ifTick4436313710217261332_b2de2b56af25c8e1, &__wrap__FuncbuiltinTickfind_index_ifTick4436313710217261332_b2de2b56af25c8e1 },
+    { 0xc8b3f5aba05f6e3e, false, (void*)&test_c0bfa001606f2773, &__wrap_test_c0bfa001606f2773 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_13643051443107872378
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,393 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_17980483447583215159 {
+
+namespace  { struct Foo; };
+#if 0 // external enum
+namespace UnitTest {
+
+enum class GooEnum : int32_t {
+    regular = int32_t(INT64_C(0)),
+    hazardous = int32_t(INT64_C(1)),
+};
+}
+#endif // external enum
+// unused enumeration OpCode
+#if 0 // external enum
+namespace UnitTest {
+
+enum class SomeEnum : int32_t {
+    zero = int32_t(INT64_C(0)),
+    one = int32_t(INT64_C(1)),
+    two = int32_t(INT64_C(2)),
+};
+}
+#endif // external enum
+#if 0 // external enum
+namespace UnitTest {
+
+enum class SomeEnum98 : uint32_t {
+    SomeEnum98_zero = uint32_t(INT64_C(0)),
+    SomeEnum98_one = uint32_t(INT64_C(1)),
+    SomeEnum98_two = uint32_t(INT64_C(2)),
+};
+}
+#endif // external enum
+#if 0 // external enum
+namespace UnitTest {
+
+enum class SomeEnum_16 : int16_t {
+    SomeEnum_16_zero = int16_t(INT64_C(0)),
+    SomeEnum_16_one = int16_t(INT64_C(1)),
+    SomeEnum_16_two = int16_t(INT64_C(2)),
+};
+}
+#endif // external enum
+namespace  {
+
+enum class Numbers : int16_t {
+    zero = int16_t(0),
+    one = int16_t(1),
+    two = int16_t(2),
+    ten = int16_t(10),
+    sixteen = int16_t(16),
+    neg_ten = int16_t(-10),
+    neg_one = int16_t(-1),
+    neg_one_i = int16_t(-1),
+};
+}
+namespace  {
+
+enum class Zen : int32_t {
+    zero = int32_t(0),
+    not_zero = int32_t(1),
+};
+}
+namespace  {
+
+enum class QQ : int32_t {
+    size_of_Foo_Padded = int32_t(16),
+};
+}
+namespace  {
+
+enum class BooHoo : int32_t {
+    boo = int32_t(0),
+    hoo = int32_t(1),
+    boo_hoo = int32_t(5),
+};
+}
+namespace  {
+
+enum class BooHoo8 : int8_t {
+    boo = int8_t(1),
+    hoo = int8_t(2),
+    boo_hoo = int8_t(3),
+};
+}
+namespace  {
+
+enum class BooHoo16 : int16_t {
+    boo = int16_t(4),
+    hoo = int16_t(5),
+    boo_hoo = int16_t(6),
+};
+}
+namespace  {
+
+struct Foo {
+    int32_t a;
+    float b;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==4,"structure field offset mismatch with DAS");
+}
+extern TypeInfo __type_info__4592f9882f40924c;
+extern TypeInfo __type_info__876047bf521fe1e5;
+extern TypeInfo __type_info__c7da46c13b199147;
+extern TypeInfo __type_info__7358c7399e1cbee3;
+extern TypeInfo __type_info__917a0706628c34f0;
+extern TypeInfo __type_info__ff64b2ac4aa3aaec;
+
+EnumValueInfo __enum_info__8253d2438a562cbb_value_0 = { "boo", 0 };
+EnumValueInfo __enum_info__8253d2438a562cbb_value_1 = { "hoo", 1 };
+EnumValueInfo __enum_info__8253d2438a562cbb_value_2 = { "boo_hoo", 5 };
+EnumValueInfo * __enum_info__8253d2438a562cbb_values [] = { &__enum_info__8253d2438a562cbb_value_0, &__enum_info__8253d2438a562cbb_value_1, &__enum_info__8253d2438a562cbb_value_2 };
+EnumInfo __enum_info__8253d2438a562cbb = { "BooHoo", "", __enum_info__8253d2438a562cbb_values, 3, UINT64_C(0x8253d2438a562cbb) };
+EnumValueInfo __enum_info__ca88d2c4104f187e_value_0 = { "boo", 4 };
+EnumValueInfo __enum_info__ca88d2c4104f187e_value_1 = { "hoo", 5 };
+EnumValueInfo __enum_info__ca88d2c4104f187e_value_2 = { "boo_hoo", 6 };
+EnumValueInfo * __enum_info__ca88d2c4104f187e_values [] = { &__enum_info__ca88d2c4104f187e_value_0, &__enum_info__ca88d2c4104f187e_value_1, &__enum_info__ca88d2c4104f187e_value_2 };
+EnumInfo __enum_info__ca88d2c4104f187e = { "BooHoo16", "", __enum_info__ca88d2c4104f187e_values, 3, UINT64_C(0xca88d2c4104f187e) };
+EnumValueInfo __enum_info__ca9acbc4106da299_value_0 = { "boo", 1 };
+EnumValueInfo __enum_info__ca9acbc4106da299_value_1 = { "hoo", 2 };
+EnumValueInfo __enum_info__ca9acbc4106da299_value_2 = { "boo_hoo", 3 };
+EnumValueInfo * __enum_info__ca9acbc4106da299_values [] = { &__enum_info__ca9acbc4106da299_value_0, &__enum_info__ca9acbc4106da299_value_1, &__enum_info__ca9acbc4106da299_value_2 };
+EnumInfo __enum_info__ca9acbc4106da299 = { "BooHoo8", "", __enum_info__ca9acbc4106da299_values, 3, UINT64_C(0xca9acbc4106da299) };
+TypeInfo __type_info__4592f9882f40924c = { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__7358c7399e1cbee3, nullptr, nullptr, nullptr, 0, 0, nullptr, 24858, 8, UINT64_C(0x4592f9882f40924c) };
+TypeInfo __type_info__876047bf521fe1e5 = { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__917a0706628c34f0, nullptr, nullptr, nullptr, 0, 0, nullptr, 24858, 8, UINT64_C(0x876047bf521fe1e5) };
+TypeInfo __type_info__c7da46c13b199147 = { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__ff64b2ac4aa3aaec, nullptr, nullptr, nullptr, 0, 0, nullptr, 24858, 8, UINT64_C(0xc7da46c13b199147) };
+TypeInfo __type_info__7358c7399e1cbee3 = { Type::tEnumeration16, nullptr, &__enum_info__ca88d2c4104f187e, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 2, UINT64_C(0x7358c7399e1cbee3) };
+TypeInfo __type_info__917a0706628c34f0 = { Type::tEnumeration8, nullptr, &__enum_info__ca9acbc4106da299, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x917a0706628c34f0) };
+TypeInfo __type_info__ff64b2ac4aa3aaec = { Type::tEnumeration, nullptr, &__enum_info__8253d2438a562cbb, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xff64b2ac4aa3aaec) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__c7da46c13b199147 };
+TypeInfo * __tinfo_1[1] = { &__type_info__876047bf521fe1e5 };
+TypeInfo * __tinfo_2[1] = { &__type_info__4592f9882f40924c };
+
+inline Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo)) _FuncbuiltinTickeach_enumTick17774294387390053460_395bb950fe75d520 ( Context * __context__, DAS_COMMENT(enum) BooHoo __tt_rename_at_1462_0 );
+inline Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo8)) _FuncbuiltinTickeach_enumTick17774294387390053460_58882dad630cd18c ( Context * __context__, DAS_COMMENT(enum) BooHoo8 __tt_rename_at_1462_2 );
+inline Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo16)) _FuncbuiltinTickeach_enumTick17774294387390053460_39ecede187ef5b41 ( Context * __context__, DAS_COMMENT(enum) BooHoo16 __tt_rename_at_1462_4 );
+inline DAS_COMMENT(enum) Zen getZenOne_3c46e2a6b7d39034 ( Context * __context__ );
+inline void testBindEnum_627db03d26832b63 ( Context * __context__, DAS_COMMENT(bound_enum) SomeEnum __arg_rename_at_55_6 );
+inline bool test_2ba4fa0f0d02a1d0 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo)) _FuncbuiltinTickeach_enumTick17774294387390053460_395bb950fe75d520 ( Context * __context__, DAS_COMMENT(enum) BooHoo __tt_rename_at_1462_0 )
+{
+    Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo)) __iter_rename_at_1464_1;das_zero(__iter_rename_at_1464_1);
+    das_call_interop<void>::call(&builtin_make_enum_iterator,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo)) &>::from(__iter_rename_at_1464_1)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo))>::cast(__iter_rename_at_1464_1);
+}
+
+inline Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo8)) _FuncbuiltinTickeach_enumTick17774294387390053460_58882dad630cd18c ( Context * __context__, DAS_COMMENT(enum) BooHoo8 __tt_rename_at_1462_2 )
+{
+    Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo8)) __iter_rename_at_1464_3;das_zero(__iter_rename_at_1464_3);
+    das_call_interop<void>::call(&builtin_make_enum_iterator,__context__,SimNode_AotInterop<1>(__tinfo_1,cast<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo8)) &>::from(__iter_rename_at_1464_3)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo8))>::cast(__iter_rename_at_1464_3);
+}
+
+inline Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo16)) _FuncbuiltinTickeach_enumTick17774294387390053460_39ecede187ef5b41 ( Context * __context__, DAS_COMMENT(enum) BooHoo16 __tt_rename_at_1462_4 )
+{
+    Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo16)) __iter_rename_at_1464_5;das_zero(__iter_rename_at_1464_5);
+    das_call_interop<void>::call(&builtin_make_enum_iterator,__context__,SimNode_AotInterop<1>(__tinfo_2,cast<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo16)) &>::from(__iter_rename_at_1464_5)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo16))>::cast(__iter_rename_at_1464_5);
+}
+
+inline DAS_COMMENT(enum) Zen getZenOne_3c46e2a6b7d39034 ( Context * __context__ )
+{
+    return das_auto_cast<DAS_COMMENT(enum) Zen>::cast(DAS_COMMENT(enum) Zen::not_zero);
+}
+
+inline void testBindEnum_627db03d26832b63 ( Context * __context__, DAS_COMMENT(bound_enum) SomeEnum __arg_rename_at_55_6 )
+{
+    builtin_print(((char *) "hello, world!\n"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline bool test_2ba4fa0f0d02a1d0 ( Context * __context__ )
+{
+    Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo)) _temp_make_local_100_18_0; _temp_make_local_100_18_0;
+    TDim<int32_t,3> _temp_make_local_100_41_1; _temp_make_local_100_41_1;
+    Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo8)) _temp_make_local_103_18_2; _temp_make_local_103_18_2;
+    TDim<int32_t,3> _temp_make_local_103_42_3; _temp_make_local_103_42_3;
+    Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo16)) _temp_make_local_106_18_4; _temp_make_local_106_18_4;
+    TDim<int32_t,3> _temp_make_local_106_43_5; _temp_make_local_106_43_5;
+    DAS_COMMENT(enum) Numbers __q_rename_at_71_7 = DAS_COMMENT(enum) Numbers::one;
+    DAS_ASSERT((int32_t(__q_rename_at_71_7) == 1));
+    DAS_ASSERT((__q_rename_at_71_7 == DAS_COMMENT(enum) Numbers::one));
+    DAS_ASSERT((DAS_COMMENT(enum) Numbers::zero != __q_rename_at_71_7));
+    das_copy(__q_rename_at_71_7,DAS_COMMENT(enum) Numbers::zero);
+    DAS_ASSERT((DAS_COMMENT(enum) Numbers::zero == __q_rename_at_71_7));
+    DAS_VERIFY((getZenOne_3c46e2a6b7d39034(__context__) == DAS_COMMENT(enum) Zen::not_zero));
+    DAS_VERIFY((efn_takeOne_giveTwo(DAS_COMMENT(bound_enum) SomeEnum::one) == DAS_COMMENT(bound_enum) SomeEnum::two));
+    DAS_VERIFY((efn_takeOne_giveTwo_98(DAS_COMMENT(bound_enum) SomeEnum98::SomeEnum98_one) == DAS_COMMENT(bound_enum) SomeEnum98::SomeEnum98_two));
+    DAS_COMMENT(bound_enum) SomeEnum __result_efn_rename_at_88_8 = efn_takeOne_giveTwo(DAS_COMMENT(bound_enum) SomeEnum::one);
+    DAS_ASSERT((__result_efn_rename_at_88_8 == DAS_COMMENT(bound_enum) SomeEnum::two));
+    DAS_COMMENT(bound_enum) Goo::GooEnum __goo_rename_at_91_9;das_zero(__goo_rename_at_91_9);
+    das_copy(__goo_rename_at_91_9,DAS_COMMENT(bound_enum) Goo::GooEnum::regular);
+    DAS_VERIFY((efn_flip(__goo_rename_at_91_9) == DAS_COMMENT(bound_enum) Goo::GooEnum::hazardous));
+    TestObjectFoo __foo16_rename_at_94_10;das_zero(__foo16_rename_at_94_10);
+    DAS_ASSERT((__foo16_rename_at_94_10.e16 /*e16*/ == DAS_COMMENT(bound_enum) SomeEnum_16::SomeEnum_16_zero));
+    das_copy(__foo16_rename_at_94_10.e16 /*e16*/,DAS_COMMENT(bound_enum) SomeEnum_16::SomeEnum_16_one);
+    DAS_ASSERT((__foo16_rename_at_94_10.e16 /*e16*/ == DAS_COMMENT(bound_enum) SomeEnum_16::SomeEnum_16_one));
+    DAS_ASSERT((int32_t(__foo16_rename_at_94_10.e16 /*e16*/) == 1));
+    {
+        bool __need_loop_100 = true;
+        // e: BooHoo
+        das_iterator<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo))> __e_iterator((_temp_make_local_100_18_0 = (_FuncbuiltinTickeach_enumTick17774294387390053460_395bb950fe75d520(__context__,DAS_COMMENT(enum) BooHoo::boo))));
+        DAS_COMMENT(enum) BooHoo __e_rename_at_100_13;
+        __need_loop_100 = __e_iterator.first(__context__,(__e_rename_at_100_13)) && __need_loop_100;
+        // tt: int&
+        das_iterator<TDim<int32_t,3>> __tt_iterator((([&]() -> TDim<int32_t,3>& {
+            _temp_make_local_100_41_1(0,__context__) = 0;
+            _temp_make_local_100_41_1(1,__context__) = 1;
+            _temp_make_local_100_41_1(2,__context__) = 5;
+            return _temp_make_local_100_41_1;
+        })()));
+        int32_t * __tt_rename_at_100_14;
+        __need_loop_100 = __tt_iterator.first(__context__,(__tt_rename_at_100_14)) && __need_loop_100;
+        for ( ; __need_loop_100 ; __need_loop_100 = __e_iterator.next(__context__,(__e_rename_at_100_13)) && __tt_iterator.next(__context__,(__tt_rename_at_100_14)) )
+        {
+            DAS_ASSERT((int32_t(__e_rename_at_100_13) == (*__tt_rename_at_100_14)));
+        }
+        __tt_iterator.close(__context__,(__tt_rename_at_100_14));
+        __e_iterator.close(__context__,(__e_rename_at_100_13));
+    };
+    {
+        bool __need_loop_103 = true;
+        // e: BooHoo8
+        das_iterator<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo8))> __e_iterator((_temp_make_local_103_18_2 = (_FuncbuiltinTickeach_enumTick17774294387390053460_58882dad630cd18c(__context__,DAS_COMMENT(enum) BooHoo8::boo))));
+        DAS_COMMENT(enum) BooHoo8 __e_rename_at_103_17;
+        __need_loop_103 = __e_iterator.first(__context__,(__e_rename_at_103_17)) && __need_loop_103;
+        // tt: int&
+        das_iterator<TDim<int32_t,3>> __tt_iterator((([&]() -> TDim<int32_t,3>& {
+            _temp_make_local_103_42_3(0,__context__) = 1;
+            _temp_make_local_103_42_3(1,__context__) = 2;
+            _temp_make_local_103_42_3(2,__context__) = 3;
+            return _temp_make_local_103_42_3;
+        })()));
+        int32_t * __tt_rename_at_103_18;
+        __need_loop_103 = __tt_iterator.first(__context__,(__tt_rename_at_103_18)) && __need_loop_103;
+        for ( ; __need_loop_103 ; __need_loop_103 = __e_iterator.next(__context__,(__e_rename_at_103_17)) && __tt_iterator.next(__context__,(__tt_rename_at_103_18)) )
+        {
+            DAS_ASSERT((int32_t(__e_rename_at_103_17) == (*__tt_rename_at_103_18)));
+        }
+        __tt_iterator.close(__context__,(__tt_rename_at_103_18));
+        __e_iterator.close(__context__,(__e_rename_at_103_17));
+    };
+    {
+        bool __need_loop_106 = true;
+        // e: BooHoo16
+        das_iterator<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo16))> __e_iterator((_temp_make_local_106_18_4 = (_FuncbuiltinTickeach_enumTick17774294387390053460_39ecede187ef5b41(__context__,DAS_COMMENT(enum) BooHoo16::boo))));
+        DAS_COMMENT(enum) BooHoo16 __e_rename_at_106_21;
+        __need_loop_106 = __e_iterator.first(__context__,(__e_rename_at_106_21)) && __need_loop_106;
+        // tt: int&
+        das_iterator<TDim<int32_t,3>> __tt_iterator((([&]() -> TDim<int32_t,3>& {
+            _temp_make_local_106_43_5(0,__context__) = 4;
+            _temp_make_local_106_43_5(1,__context__) = 5;
+            _temp_make_local_106_43_5(2,__context__) = 6;
+            return _temp_make_local_106_43_5;
+        })()));
+        int32_t * __tt_rename_at_106_22;
+        __need_loop_106 = __tt_iterator.first(__context__,(__tt_rename_at_106_22)) && __need_loop_106;
+        for ( ; __need_loop_106 ; __need_loop_106 = __e_iterator.next(__context__,(__e_rename_at_106_21)) && __tt_iterator.next(__context__,(__tt_rename_at_106_22)) )
+        {
+            DAS_ASSERT((int32_t(__e_rename_at_106_21) == (*__tt_rename_at_106_22)));
+        }
+        __tt_iterator.close(__context__,(__tt_rename_at_106_22));
+        __e_iterator.close(__context__,(__e_rename_at_106_21));
+    };
+    bool __bind_ok_rename_at_110_23 = ((bool)testBindEnumFunction(__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+    DAS_ASSERTF((__bind_ok_rename_at_110_23),(((char *) "testBindEnumFunction failed")));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncbuiltinTickeach_enumTick17774294387390053460_395bb950fe75d520 ( Context * __context__ ) {
+    DAS_COMMENT(enum) BooHoo arg_tt = cast_aot_arg<DAS_COMMENT(enum) BooHoo>::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo)) *) __context__->abiCMRES) = _FuncbuiltinTickeach_enumTick17774294387390053460_395bb950fe75d520(__context__, arg_tt);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeach_enumTick17774294387390053460_58882dad630cd18c ( Context * __context__ ) {
+    DAS_COMMENT(enum) BooHoo8 arg_tt = cast_aot_arg<DAS_COMMENT(enum) BooHoo8>::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo8)) *) __context__->abiCMRES) = _FuncbuiltinTickeach_enumTick17774294387390053460_58882dad630cd18c(__context__, arg_tt);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeach_enumTick17774294387390053460_39ecede187ef5b41 ( Context * __context__ ) {
+    DAS_COMMENT(enum) BooHoo16 arg_tt = cast_aot_arg<DAS_COMMENT(enum) BooHoo16>::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo16)) *) __context__->abiCMRES) = _FuncbuiltinTickeach_enumTick17774294387390053460_39ecede187ef5b41(__context__, arg_tt);
+    return v_zero();
+}
+static vec4f __wrap_getZenOne_3c46e2a6b7d39034 ( Context * __context__ ) {
+    return cast<DAS_COMMENT(enum) Zen>::from(getZenOne_3c46e2a6b7d39034(__context__));
+}
+static vec4f __wrap_testBindEnum_627db03d26832b63 ( Context * __context__ ) {
+    DAS_COMMENT(bound_enum) SomeEnum arg_arg = cast_aot_arg<DAS_COMMENT(bound_enum) SomeEnum>::to(*__context__,__context__->abiArguments()[0]);
+    testBindEnum_627db03d26832b63(__context__, arg_arg);
+    return v_zero();
+}
+static vec4f __wrap_test_2ba4fa0f0d02a1d0 ( Context * __context__ ) {
+    return cast<bool>::from(test_2ba4fa0f0d02a1d0(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xad6010373b256514, true, (void*)&_FuncbuiltinTickeach_enumTick17774294387390053460_395bb950fe75d520, &__wrap__FuncbuiltinTickeach_enumTick17774294387390053460_395bb950fe75d520 },
+    { 0xcb34e06a3293df32, true, (void*)&_FuncbuiltinTickeach_enumTick17774294387390053460_58882dad630cd18c, &__wrap__FuncbuiltinTickeach_enumTick17774294387390053460_58882dad630cd18c },
+    { 0x2076b192ebd2fb5, true, (void*)&_FuncbuiltinTickeach_enumTick17774294387390053460_39ecede187ef5b41, &__wrap__FuncbuiltinTickeach_enumTick17774294387390053460_39ecede187ef5b41 },
+    { 0xcfcdc6df0d50a093, false, (void*)&getZenOne_3c46e2a6b7d39034, &__wrap_getZenOne_3c46e2a6b7d39034 },
+    { 0x52ec3229b5fac307, false, (void*)&testBindEnum_627db03d26832b63, &__wrap_testBindEnum_627db03d26832b63 },
+    { 0xaf82b41f57aef8df, false, (void*)&test_2ba4fa0f0d02a1d0, &__wrap_test_2ba4fa0f0d02a1d0 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_17980483447583215159
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
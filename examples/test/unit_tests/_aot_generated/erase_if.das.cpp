@@ -0,0 +1,612 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_1820733018562302916 {
+
+// unused enumeration GooEnum
+// unused enumeration OpCode
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+extern TypeInfo __type_info__124e1c04d9af11ea;
+extern TypeInfo __type_info__c5513ffa519567c3;
+extern TypeInfo __type_info__af81fe4c86352052;
+extern TypeInfo __type_info__af63e44c8601fa24;
+
+VarInfo __func_info__db15098eef908e4b_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x9c381d0759513abe), "v", 0, 0 };
+VarInfo * __func_info__db15098eef908e4b_fields[1] =  { &__func_info__db15098eef908e4b_field_0 };
+FuncInfo __func_info__db15098eef908e4b = {"invoke block<(v:int const):bool const> const", "", __func_info__db15098eef908e4b_fields, 1, 32, &__type_info__af81fe4c86352052, nullptr,0,UINT64_C(0xdb15098eef908e4b), 0x0 };
+TypeInfo __type_info__124e1c04d9af11ea = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x124e1c04d9af11ea) };
+TypeInfo __type_info__c5513ffa519567c3 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 41250, 24, UINT64_C(0xc5513ffa519567c3) };
+TypeInfo __type_info__af81fe4c86352052 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 1, UINT64_C(0xaf81fe4c86352052) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline void _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__, TArray<int32_t> & __a_rename_at_1142_2, TArray<int32_t> const  & __b_rename_at_1142_3 );
+inline TArray<int32_t> _FuncbuiltinTickclone_to_moveTick17180087396728260876_845ea85675060ffa ( Context * __context__, TArray<int32_t> & __clone_src_rename_at_1118_5 );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25 ( Context * __context__, TDim<int32_t,1> & __a_rename_at_1502_7 );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115 ( Context * __context__, TDim<int32_t,2> & __a_rename_at_1502_9 );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b ( Context * __context__, TDim<int32_t,3> & __a_rename_at_1502_11 );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18 ( Context * __context__, TDim<int32_t,4> & __a_rename_at_1502_13 );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_1383cfa4b34f6947 ( Context * __context__, TDim<int32_t,5> & __a_rename_at_1502_15 );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_4a7fa97b8c5ccfb7 ( Context * __context__, TDim<int32_t,6> & __a_rename_at_1502_17 );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_884a04ef827bd92c ( Context * __context__, TDim<int32_t,7> & __a_rename_at_1502_19 );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_9986cc1a5b5d4fbe ( Context * __context__, TDim<int32_t,8> & __a_rename_at_1502_21 );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_2d94ff787941c5d1 ( Context * __context__, TDim<int32_t,9> & __a_rename_at_1502_23 );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_371cb4eb9d0ec912 ( Context * __context__, TDim<int32_t,24> & __a_rename_at_1502_25 );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_1ab345ffce2a84ed ( Context * __context__, TDim<int32_t,25> & __a_rename_at_1502_27 );
+inline void _FuncbuiltinTickerase_ifTick4694165798967666790_dcac6635e814f222 ( Context * __context__, TArray<int32_t> & __arr_rename_at_567_29, Block DAS_COMMENT((bool,int32_t)) const  & __blk_rename_at_567_30 );
+inline void test_erase_if_e1a9ece977525060 ( Context * __context__, TArray<int32_t> & __arr_rename_at_5_33 );
+inline bool test_2656aaa78de22e14 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__, TArray<int32_t> &  __a_rename_at_1142_2, TArray<int32_t> const  &  __b_rename_at_1142_3 )
+{
+    int32_t __ln_rename_at_1143_4 = ((int32_t)builtin_array_size(__b_rename_at_1142_3));
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_1142_2),__ln_rename_at_1143_4);
+    if ( __ln_rename_at_1143_4 == 0 )
+    {
+        return ;
+    } else {
+        das_memcpy(das_auto_cast<void * const >::cast(das_ref(__context__,__a_rename_at_1142_2(0,__context__))),das_auto_cast<void * const >::cast(das_ref(__context__,__b_rename_at_1142_3(0,__context__))),__ln_rename_at_1143_4 * 4);
+    };
+}
+
+inline TArray<int32_t> _FuncbuiltinTickclone_to_moveTick17180087396728260876_845ea85675060ffa ( Context * __context__, TArray<int32_t> &  __clone_src_rename_at_1118_5 )
+{
+    TArray<int32_t> __clone_dest_rename_at_1120_6;das_zero(__clone_dest_rename_at_1120_6);
+    _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62(__context__,das_arg<TArray<int32_t>>::pass(__clone_dest_rename_at_1120_6),das_arg<TArray<int32_t>>::pass(__clone_src_rename_at_1118_5));
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__clone_dest_rename_at_1120_6);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25 ( Context * __context__, TDim<int32_t,1> &  __a_rename_at_1502_7 )
+{
+    TArray<int32_t> __arr_rename_at_1504_8;das_zero(__arr_rename_at_1504_8);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_8),1);
+    das_copy(das_cast<TDim<int32_t,1>>::cast(das_ref(__context__,__arr_rename_at_1504_8(0,__context__))),__a_rename_at_1502_7);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_8);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115 ( Context * __context__, TDim<int32_t,2> &  __a_rename_at_1502_9 )
+{
+    TArray<int32_t> __arr_rename_at_1504_10;das_zero(__arr_rename_at_1504_10);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_10),2);
+    das_copy(das_cast<TDim<int32_t,2>>::cast(das_ref(__context__,__arr_rename_at_1504_10(0,__context__))),__a_rename_at_1502_9);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_10);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b ( Context * __context__, TDim<int32_t,3> &  __a_rename_at_1502_11 )
+{
+    TArray<int32_t> __arr_rename_at_1504_12;das_zero(__arr_rename_at_1504_12);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_12),3);
+    das_copy(das_cast<TDim<int32_t,3>>::cast(das_ref(__context__,__arr_rename_at_1504_12(0,__context__))),__a_rename_at_1502_11);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_12);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18 ( Context * __context__, TDim<int32_t,4> &  __a_rename_at_1502_13 )
+{
+    TArray<int32_t> __arr_rename_at_1504_14;das_zero(__arr_rename_at_1504_14);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_14),4);
+    das_copy(das_cast<TDim<int32_t,4>>::cast(das_ref(__context__,__arr_rename_at_1504_14(0,__context__))),__a_rename_at_1502_13);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_14);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_1383cfa4b34f6947 ( Context * __context__, TDim<int32_t,5> &  __a_rename_at_1502_15 )
+{
+    TArray<int32_t> __arr_rename_at_1504_16;das_zero(__arr_rename_at_1504_16);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_16),5);
+    das_copy(das_cast<TDim<int32_t,5>>::cast(das_ref(__context__,__arr_rename_at_1504_16(0,__context__))),__a_rename_at_1502_15);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_16);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_4a7fa97b8c5ccfb7 ( Context * __context__, TDim<int32_t,6> &  __a_rename_at_1502_17 )
+{
+    TArray<int32_t> __arr_rename_at_1504_18;das_zero(__arr_rename_at_1504_18);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_18),6);
+    das_copy(das_cast<TDim<int32_t,6>>::cast(das_ref(__context__,__arr_rename_at_1504_18(0,__context__))),__a_rename_at_1502_17);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_18);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_884a04ef827bd92c ( Context * __context__, TDim<int32_t,7> &  __a_rename_at_1502_19 )
+{
+    TArray<int32_t> __arr_rename_at_1504_20;das_zero(__arr_rename_at_1504_20);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_20),7);
+    das_copy(das_cast<TDim<int32_t,7>>::cast(das_ref(__context__,__arr_rename_at_1504_20(0,__context__))),__a_rename_at_1502_19);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_20);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_9986cc1a5b5d4fbe ( Context * __context__, TDim<int32_t,8> &  __a_rename_at_1502_21 )
+{
+    TArray<int32_t> __arr_rename_at_1504_22;das_zero(__arr_rename_at_1504_22);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_22),8);
+    das_copy(das_cast<TDim<int32_t,8>>::cast(das_ref(__context__,__arr_rename_at_1504_22(0,__context__))),__a_rename_at_1502_21);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_22);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_2d94ff787941c5d1 ( Context * __context__, TDim<int32_t,9> &  __a_rename_at_1502_23 )
+{
+    TArray<int32_t> __arr_rename_at_1504_24;das_zero(__arr_rename_at_1504_24);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_24),9);
+    das_copy(das_cast<TDim<int32_t,9>>::cast(das_ref(__context__,__arr_rename_at_1504_24(0,__context__))),__a_rename_at_1502_23);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_24);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_371cb4eb9d0ec912 ( Context * __context__, TDim<int32_t,24> &  __a_rename_at_1502_25 )
+{
+    TArray<int32_t> __arr_rename_at_1504_26;das_zero(__arr_rename_at_1504_26);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_26),24);
+    das_copy(das_cast<TDim<int32_t,24>>::cast(das_ref(__context__,__arr_rename_at_1504_26(0,__context__))),__a_rename_at_1502_25);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_26);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_1ab345ffce2a84ed ( Context * __context__, TDim<int32_t,25> &  __a_rename_at_1502_27 )
+{
+    TArray<int32_t> __arr_rename_at_1504_28;das_zero(__arr_rename_at_1504_28);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_28),25);
+    das_copy(das_cast<TDim<int32_t,25>>::cast(das_ref(__context__,__arr_rename_at_1504_28(0,__context__))),__a_rename_at_1502_27);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_28);
+}
+
+inline void _FuncbuiltinTickerase_ifTick4694165798967666790_dcac6635e814f222 ( Context * __context__, TArray<int32_t> &  __arr_rename_at_567_29, Block DAS_COMMENT((bool,int32_t)) const  &  __blk_rename_at_567_30 )
+{
+    int32_t __i_rename_at_572_31 = builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_567_29));
+    while ( --__i_rename_at_572_31 >= 0 )
+    {
+        if ( das_invoke<bool>::invoke<int32_t>(__context__,nullptr,__blk_rename_at_567_30,__arr_rename_at_567_29(__i_rename_at_572_31,__context__)) )
+        {
+            int32_t __endIndex_rename_at_575_32 = ((int32_t)__i_rename_at_572_31);
+            while ( --__i_rename_at_572_31 >= 0 )
+            {
+                if ( !das_invoke<bool>::invoke<int32_t>(__context__,nullptr,__blk_rename_at_567_30,__arr_rename_at_567_29(__i_rename_at_572_31,__context__)) )
+                {
+                    break;
+                };
+            };
+            builtin_array_erase_range(das_arg<TArray<int32_t>>::pass(__arr_rename_at_567_29),__i_rename_at_572_31 + 1,__endIndex_rename_at_575_32 - __i_rename_at_572_31,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        };
+    };
+}
+
+inline void test_erase_if_e1a9ece977525060 ( Context * __context__, TArray<int32_t> &  __arr_rename_at_5_33 ) { das_stack_prologue __prologue(__context__,144,"test_erase_if " DAS_FILE_LINE);
+{
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_18_17_0; _temp_make_local_18_17_0;
+    TArray<int32_t> __cloned_rename_at_6_34_ConstRef; das_zero(__cloned_rename_at_6_34_ConstRef); das_move(__cloned_rename_at_6_34_ConstRef, ((TArray<int32_t>)_FuncbuiltinTickclone_to_moveTick17180087396728260876_845ea85675060ffa(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_5_33))));
+    TArray<int32_t> const  & __cloned_rename_at_6_34 = __cloned_rename_at_6_34_ConstRef;
+;
+    int32_t __maxVal_rename_at_7_35 = -1;
+    {
+        bool __need_loop_9 = true;
+        // v: int&
+        das_iterator<TArray<int32_t>> __v_iterator(__arr_rename_at_5_33);
+        int32_t * __v_rename_at_9_36;
+        __need_loop_9 = __v_iterator.first(__context__,(__v_rename_at_9_36)) && __need_loop_9;
+        for ( ; __need_loop_9 ; __need_loop_9 = __v_iterator.next(__context__,(__v_rename_at_9_36)) )
+        {
+            das_copy(__maxVal_rename_at_7_35,SimPolicy<int32_t>::Max(__maxVal_rename_at_7_35,(*__v_rename_at_9_36),*__context__,nullptr));
+        }
+        __v_iterator.close(__context__,(__v_rename_at_9_36));
+    };
+    _FuncbuiltinTickerase_ifTick4694165798967666790_dcac6635e814f222(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_5_33),das_make_block<bool,int32_t>(__context__,128,0,&__func_info__db15098eef908e4b,[&](int32_t const  __v_rename_at_13_37) -> bool{
+        return das_auto_cast<bool>::cast(__v_rename_at_13_37 < 0);
+    }));
+    bool __ok_rename_at_17_38 = true;
+    {
+        bool __need_loop_18 = true;
+        // i: int
+        das_iterator_count DAS_COMMENT((_temp_make_local_18_17_0 = (builtin_count(0,1,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))) __i_iterator(0,1);
+        int32_t __i_rename_at_18_41;
+        __need_loop_18 = __i_iterator.first(__context__,(__i_rename_at_18_41)) && __need_loop_18;
+        // v: int&
+        das_iterator<TArray<int32_t>> __v_iterator(__arr_rename_at_5_33);
+        int32_t * __v_rename_at_18_42;
+        __need_loop_18 = __v_iterator.first(__context__,(__v_rename_at_18_42)) && __need_loop_18;
+        for ( ; __need_loop_18 ; __need_loop_18 = __i_iterator.next(__context__,(__i_rename_at_18_41)) && __v_iterator.next(__context__,(__v_rename_at_18_42)) )
+        {
+            if ( (*__v_rename_at_18_42) < 0 )
+            {
+                das_copy(__ok_rename_at_17_38,false);
+            };
+        }
+        __v_iterator.close(__context__,(__v_rename_at_18_42));
+        __i_iterator.close(__context__,(__i_rename_at_18_41));
+    };
+    if ( builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_5_33)) != (__maxVal_rename_at_7_35 + 1) )
+    {
+        das_copy(__ok_rename_at_17_38,false);
+    };
+    if ( !__ok_rename_at_17_38 )
+    {
+        builtin_print(((char *) "erase_if failed, input and output:\n"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        das_debug(__context__,&__type_info__c5513ffa519567c3,__FILE__,__LINE__,cast<TArray<int32_t> const  &>::from(__cloned_rename_at_6_34));
+        das_debug(__context__,&__type_info__124e1c04d9af11ea,__FILE__,__LINE__,cast<TArray<int32_t>&>::from(__arr_rename_at_5_33));
+        DAS_ASSERT((false));
+    };
+}}
+
+inline bool test_2656aaa78de22e14 ( Context * __context__ )
+{
+    TDim<int32_t,1> _temp_make_local_40_14_1; _temp_make_local_40_14_1;
+    TDim<int32_t,2> _temp_make_local_42_14_2; _temp_make_local_42_14_2;
+    TDim<int32_t,1> _temp_make_local_44_14_3; _temp_make_local_44_14_3;
+    TDim<int32_t,2> _temp_make_local_46_14_4; _temp_make_local_46_14_4;
+    TDim<int32_t,3> _temp_make_local_48_14_5; _temp_make_local_48_14_5;
+    TDim<int32_t,3> _temp_make_local_50_14_6; _temp_make_local_50_14_6;
+    TDim<int32_t,3> _temp_make_local_52_14_7; _temp_make_local_52_14_7;
+    TDim<int32_t,3> _temp_make_local_54_14_8; _temp_make_local_54_14_8;
+    TDim<int32_t,4> _temp_make_local_56_14_9; _temp_make_local_56_14_9;
+    TDim<int32_t,5> _temp_make_local_58_14_10; _temp_make_local_58_14_10;
+    TDim<int32_t,6> _temp_make_local_60_15_11; _temp_make_local_60_15_11;
+    TDim<int32_t,7> _temp_make_local_62_15_12; _temp_make_local_62_15_12;
+    TDim<int32_t,8> _temp_make_local_64_15_13; _temp_make_local_64_15_13;
+    TDim<int32_t,9> _temp_make_local_66_15_14; _temp_make_local_66_15_14;
+    TDim<int32_t,24> _temp_make_local_68_15_15; _temp_make_local_68_15_15;
+    TDim<int32_t,25> _temp_make_local_70_15_16; _temp_make_local_70_15_16;
+    TArray<int32_t> __t_rename_at_38_43;das_zero(__t_rename_at_38_43);
+    test_erase_if_e1a9ece977525060(__context__,das_arg<TArray<int32_t>>::pass(__t_rename_at_38_43));
+    TArray<int32_t> __t0_rename_at_40_44; das_zero(__t0_rename_at_40_44); das_move(__t0_rename_at_40_44, _FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25(__context__,das_arg<TDim<int32_t,1>>::pass((([&]() -> TDim<int32_t,1>& {
+        _temp_make_local_40_14_1(0,__context__) = 0;
+        return _temp_make_local_40_14_1;
+    })()))));
+    test_erase_if_e1a9ece977525060(__context__,das_arg<TArray<int32_t>>::pass(__t0_rename_at_40_44));
+    TArray<int32_t> __t1_rename_at_42_45; das_zero(__t1_rename_at_42_45); das_move(__t1_rename_at_42_45, _FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+        _temp_make_local_42_14_2(0,__context__) = 0;
+        _temp_make_local_42_14_2(1,__context__) = 1;
+        return _temp_make_local_42_14_2;
+    })()))));
+    test_erase_if_e1a9ece977525060(__context__,das_arg<TArray<int32_t>>::pass(__t1_rename_at_42_45));
+    TArray<int32_t> __t2_rename_at_44_46; das_zero(__t2_rename_at_44_46); das_move(__t2_rename_at_44_46, _FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25(__context__,das_arg<TDim<int32_t,1>>::pass((([&]() -> TDim<int32_t,1>& {
+        _temp_make_local_44_14_3(0,__context__) = -1;
+        return _temp_make_local_44_14_3;
+    })()))));
+    test_erase_if_e1a9ece977525060(__context__,das_arg<TArray<int32_t>>::pass(__t2_rename_at_44_46));
+    TArray<int32_t> __t3_rename_at_46_47; das_zero(__t3_rename_at_46_47); das_move(__t3_rename_at_46_47, _FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+        _temp_make_local_46_14_4(0,__context__) = -1;
+        _temp_make_local_46_14_4(1,__context__) = -2;
+        return _temp_make_local_46_14_4;
+    })()))));
+    test_erase_if_e1a9ece977525060(__context__,das_arg<TArray<int32_t>>::pass(__t3_rename_at_46_47));
+    TArray<int32_t> __t4_rename_at_48_48; das_zero(__t4_rename_at_48_48); das_move(__t4_rename_at_48_48, _FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b(__context__,das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+        _temp_make_local_48_14_5(0,__context__) = 0;
+        _temp_make_local_48_14_5(1,__context__) = -9;
+        _temp_make_local_48_14_5(2,__context__) = 1;
+        return _temp_make_local_48_14_5;
+    })()))));
+    test_erase_if_e1a9ece977525060(__context__,das_arg<TArray<int32_t>>::pass(__t4_rename_at_48_48));
+    TArray<int32_t> __t5_rename_at_50_49; das_zero(__t5_rename_at_50_49); das_move(__t5_rename_at_50_49, _FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b(__context__,das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+        _temp_make_local_50_14_6(0,__context__) = -9;
+        _temp_make_local_50_14_6(1,__context__) = -9;
+        _temp_make_local_50_14_6(2,__context__) = 0;
+        return _temp_make_local_50_14_6;
+    })()))));
+    test_erase_if_e1a9ece977525060(__context__,das_arg<TArray<int32_t>>::pass(__t5_rename_at_50_49));
+    TArray<int32_t> __t6_rename_at_52_50; das_zero(__t6_rename_at_52_50); das_move(__t6_rename_at_52_50, _FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b(__context__,das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+        _temp_make_local_52_14_7(0,__context__) = -9;
+        _temp_make_local_52_14_7(1,__context__) = 0;
+        _temp_make_local_52_14_7(2,__context__) = -9;
+        return _temp_make_local_52_14_7;
+    })()))));
+    test_erase_if_e1a9ece977525060(__context__,das_arg<TArray<int32_t>>::pass(__t6_rename_at_52_50));
+    TArray<int32_t> __t7_rename_at_54_51; das_zero(__t7_rename_at_54_51); das_move(__t7_rename_at_54_51, _FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b(__context__,das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+        _temp_make_local_54_14_8(0,__context__) = 0;
+        _temp_make_local_54_14_8(1,__context__) = -9;
+        _temp_make_local_54_14_8(2,__context__) = -9;
+        return _temp_make_local_54_14_8;
+    })()))));
+    test_erase_if_e1a9ece977525060(__context__,das_arg<TArray<int32_t>>::pass(__t7_rename_at_54_51));
+    TArray<int32_t> __t8_rename_at_56_52; das_zero(__t8_rename_at_56_52); das_move(__t8_rename_at_56_52, _FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+        _temp_make_local_56_14_9(0,__context__) = 0;
+        _temp_make_local_56_14_9(1,__context__) = -9;
+        _temp_make_local_56_14_9(2,__context__) = 1;
+        _temp_make_local_56_14_9(3,__context__) = -9;
+        return _temp_make_local_56_14_9;
+    })()))));
+    test_erase_if_e1a9ece977525060(__context__,das_arg<TArray<int32_t>>::pass(__t8_rename_at_56_52));
+    TArray<int32_t> __t9_rename_at_58_53; das_zero(__t9_rename_at_58_53); das_move(__t9_rename_at_58_53, _FuncbuiltinTickto_array_moveTick3185538323411982277_1383cfa4b34f6947(__context__,das_arg<TDim<int32_t,5>>::pass((([&]() -> TDim<int32_t,5>& {
+        _temp_make_local_58_14_10(0,__context__) = 0;
+        _temp_make_local_58_14_10(1,__context__) = -9;
+        _temp_make_local_58_14_10(2,__context__) = 1;
+        _temp_make_local_58_14_10(3,__context__) = 2;
+        _temp_make_local_58_14_10(4,__context__) = -9;
+        return _temp_make_local_58_14_10;
+    })()))));
+    test_erase_if_e1a9ece977525060(__context__,das_arg<TArray<int32_t>>::pass(__t9_rename_at_58_53));
+    TArray<int32_t> __t10_rename_at_60_54; das_zero(__t10_rename_at_60_54); das_move(__t10_rename_at_60_54, _FuncbuiltinTickto_array_moveTick3185538323411982277_4a7fa97b8c5ccfb7(__context__,das_arg<TDim<int32_t,6>>::pass((([&]() -> TDim<int32_t,6>& {
+        _temp_make_local_60_15_11(0,__context__) = 0;
+        _temp_make_local_60_15_11(1,__context__) = -9;
+        _temp_make_local_60_15_11(2,__context__) = -5;
+        _temp_make_local_60_15_11(3,__context__) = 1;
+        _temp_make_local_60_15_11(4,__context__) = 2;
+        _temp_make_local_60_15_11(5,__context__) = -9;
+        return _temp_make_local_60_15_11;
+    })()))));
+    test_erase_if_e1a9ece977525060(__context__,das_arg<TArray<int32_t>>::pass(__t10_rename_at_60_54));
+    TArray<int32_t> __t11_rename_at_62_55; das_zero(__t11_rename_at_62_55); das_move(__t11_rename_at_62_55, _FuncbuiltinTickto_array_moveTick3185538323411982277_884a04ef827bd92c(__context__,das_arg<TDim<int32_t,7>>::pass((([&]() -> TDim<int32_t,7>& {
+        _temp_make_local_62_15_12(0,__context__) = 0;
+        _temp_make_local_62_15_12(1,__context__) = -9;
+        _temp_make_local_62_15_12(2,__context__) = -5;
+        _temp_make_local_62_15_12(3,__context__) = 1;
+        _temp_make_local_62_15_12(4,__context__) = 2;
+        _temp_make_local_62_15_12(5,__context__) = -9;
+        _temp_make_local_62_15_12(6,__context__) = -5;
+        return _temp_make_local_62_15_12;
+    })()))));
+    test_erase_if_e1a9ece977525060(__context__,das_arg<TArray<int32_t>>::pass(__t11_rename_at_62_55));
+    TArray<int32_t> __t12_rename_at_64_56; das_zero(__t12_rename_at_64_56); das_move(__t12_rename_at_64_56, _FuncbuiltinTickto_array_moveTick3185538323411982277_9986cc1a5b5d4fbe(__context__,das_arg<TDim<int32_t,8>>::pass((([&]() -> TDim<int32_t,8>& {
+        _temp_make_local_64_15_13(0,__context__) = -5;
+        _temp_make_local_64_15_13(1,__context__) = 0;
+        _temp_make_local_64_15_13(2,__context__) = -9;
+        _temp_make_local_64_15_13(3,__context__) = -5;
+        _temp_make_local_64_15_13(4,__context__) = 1;
+        _temp_make_local_64_15_13(5,__context__) = 2;
+        _temp_make_local_64_15_13(6,__context__) = -9;
+        _temp_make_local_64_15_13(7,__context__) = -5;
+        return _temp_make_local_64_15_13;
+    })()))));
+    test_erase_if_e1a9ece977525060(__context__,das_arg<TArray<int32_t>>::pass(__t12_rename_at_64_56));
+    TArray<int32_t> __t13_rename_at_66_57; das_zero(__t13_rename_at_66_57); das_move(__t13_rename_at_66_57, _FuncbuiltinTickto_array_moveTick3185538323411982277_2d94ff787941c5d1(__context__,das_arg<TDim<int32_t,9>>::pass((([&]() -> TDim<int32_t,9>& {
+        _temp_make_local_66_15_14(0,__context__) = -6;
+        _temp_make_local_66_15_14(1,__context__) = -5;
+        _temp_make_local_66_15_14(2,__context__) = 0;
+        _temp_make_local_66_15_14(3,__context__) = -9;
+        _temp_make_local_66_15_14(4,__context__) = -5;
+        _temp_make_local_66_15_14(5,__context__) = 1;
+        _temp_make_local_66_15_14(6,__context__) = 2;
+        _temp_make_local_66_15_14(7,__context__) = -9;
+        _temp_make_local_66_15_14(8,__context__) = -5;
+        return _temp_make_local_66_15_14;
+    })()))));
+    test_erase_if_e1a9ece977525060(__context__,das_arg<TArray<int32_t>>::pass(__t13_rename_at_66_57));
+    TArray<int32_t> __t14_rename_at_68_58; das_zero(__t14_rename_at_68_58); das_move(__t14_rename_at_68_58, _FuncbuiltinTickto_array_moveTick3185538323411982277_371cb4eb9d0ec912(__context__,das_arg<TDim<int32_t,24>>::pass((([&]() -> TDim<int32_t,24>& {
+        _temp_make_local_68_15_15(0,__context__) = 0;
+        _temp_make_local_68_15_15(1,__context__) = -1;
+        _temp_make_local_68_15_15(2,__context__) = 1;
+        _temp_make_local_68_15_15(3,__context__) = -1;
+        _temp_make_local_68_15_15(4,__context__) = -2;
+        _temp_make_local_68_15_15(5,__context__) = 2;
+        _temp_make_local_68_15_15(6,__context__) = 3;
+        _temp_make_local_68_15_15(7,__context__) = 4;
+        _temp_make_local_68_15_15(8,__context__) = -6;
+        _temp_make_local_68_15_15(9,__context__) = -6;
+        _temp_make_local_68_15_15(10,__context__) = 5;
+        _temp_make_local_68_15_15(11,__context__) = 6;
+        _temp_make_local_68_15_15(12,__context__) = 7;
+        _temp_make_local_68_15_15(13,__context__) = -5;
+        _temp_make_local_68_15_15(14,__context__) = -5;
+        _temp_make_local_68_15_15(15,__context__) = -5;
+        _temp_make_local_68_15_15(16,__context__) = -5;
+        _temp_make_local_68_15_15(17,__context__) = 8;
+        _temp_make_local_68_15_15(18,__context__) = 9;
+        _temp_make_local_68_15_15(19,__context__) = -5;
+        _temp_make_local_68_15_15(20,__context__) = -5;
+        _temp_make_local_68_15_15(21,__context__) = -5;
+        _temp_make_local_68_15_15(22,__context__) = -5;
+        _temp_make_local_68_15_15(23,__context__) = -5;
+        return _temp_make_local_68_15_15;
+    })()))));
+    test_erase_if_e1a9ece977525060(__context__,das_arg<TArray<int32_t>>::pass(__t14_rename_at_68_58));
+    TArray<int32_t> __t15_rename_at_70_59; das_zero(__t15_rename_at_70_59); das_move(__t15_rename_at_70_59, _FuncbuiltinTickto_array_moveTick3185538323411982277_1ab345ffce2a84ed(__context__,das_arg<TDim<int32_t,25>>::pass((([&]() -> TDim<int32_t,25>& {
+        _temp_make_local_70_15_16(0,__context__) = 0;
+        _temp_make_local_70_15_16(1,__context__) = -1;
+        _temp_make_local_70_15_16(2,__context__) = 1;
+        _temp_make_local_70_15_16(3,__context__) = -1;
+        _temp_make_local_70_15_16(4,__context__) = -2;
+        _temp_make_local_70_15_16(5,__context__) = 2;
+        _temp_make_local_70_15_16(6,__context__) = 3;
+        _temp_make_local_70_15_16(7,__context__) = 4;
+        _temp_make_local_70_15_16(8,__context__) = -6;
+        _temp_make_local_70_15_16(9,__context__) = -6;
+        _temp_make_local_70_15_16(10,__context__) = 5;
+        _temp_make_local_70_15_16(11,__context__) = 6;
+        _temp_make_local_70_15_16(12,__context__) = 7;
+        _temp_make_local_70_15_16(13,__context__) = -5;
+        _temp_make_local_70_15_16(14,__context__) = -5;
+        _temp_make_local_70_15_16(15,__context__) = -5;
+        _temp_make_local_70_15_16(16,__context__) = -5;
+        _temp_make_local_70_15_16(17,__context__) = 8;
+        _temp_make_local_70_15_16(18,__context__) = 9;
+        _temp_make_local_70_15_16(19,__context__) = -5;
+        _temp_make_local_70_15_16(20,__context__) = -5;
+        _temp_make_local_70_15_16(21,__context__) = -5;
+        _temp_make_local_70_15_16(22,__context__) = -5;
+        _temp_make_local_70_15_16(23,__context__) = -5;
+        _temp_make_local_70_15_16(24,__context__) = 10;
+        return _temp_make_local_70_15_16;
+    })()))));
+    test_erase_if_e1a9ece977525060(__context__,das_arg<TArray<int32_t>>::pass(__t15_rename_at_70_59));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> const  &  arg_b = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickclone_to_moveTick17180087396728260876_845ea85675060ffa ( Context * __context__ ) {
+    TArray<int32_t> &  arg_clone_src = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickclone_to_moveTick17180087396728260876_845ea85675060ffa(__context__, arg_clone_src);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25 ( Context * __context__ ) {
+    TDim<int32_t,1> &  arg_a = cast_aot_arg<TDim<int32_t,1> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115 ( Context * __context__ ) {
+    TDim<int32_t,2> &  arg_a = cast_aot_arg<TDim<int32_t,2> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b ( Context * __context__ ) {
+    TDim<int32_t,3> &  arg_a = cast_aot_arg<TDim<int32_t,3> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18 ( Context * __context__ ) {
+    TDim<int32_t,4> &  arg_a = cast_aot_arg<TDim<int32_t,4> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1383cfa4b34f6947 ( Context * __context__ ) {
+    TDim<int32_t,5> &  arg_a = cast_aot_arg<TDim<int32_t,5> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_1383cfa4b34f6947(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_4a7fa97b8c5ccfb7 ( Context * __context__ ) {
+    TDim<int32_t,6> &  arg_a = cast_aot_arg<TDim<int32_t,6> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_4a7fa97b8c5ccfb7(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_884a04ef827bd92c ( Context * __context__ ) {
+    TDim<int32_t,7> &  arg_a = cast_aot_arg<TDim<int32_t,7> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_884a04ef827bd92c(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_9986cc1a5b5d4fbe ( Context * __context__ ) {
+    TDim<int32_t,8> &  arg_a = cast_aot_arg<TDim<int32_t,8> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_9986cc1a5b5d4fbe(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_2d94ff787941c5d1 ( Context * __context__ ) {
+    TDim<int32_t,9> &  arg_a = cast_aot_arg<TDim<int32_t,9> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_2d94ff787941c5d1(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_371cb4eb9d0ec912 ( Context * __context__ ) {
+    TDim<int32_t,24> &  arg_a = cast_aot_arg<TDim<int32_t,24> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_371cb4eb9d0ec912(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1ab345ffce2a84ed ( Context * __context__ ) {
+    TDim<int32_t,25> &  arg_a = cast_aot_arg<TDim<int32_t,25> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_1ab345ffce2a84ed(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickerase_ifTick4694165798967666790_dcac6635e814f222 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((bool,int32_t)) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((bool,int32_t)) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickerase_ifTick4694165798967666790_dcac6635e814f222(__context__, arg_arr, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap_test_erase_if_e1a9ece977525060 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    test_erase_if_e1a9ece977525060(__context__, arg_arr);
+    return v_zero();
+}
+static vec4f __wrap_test_2656aaa78de22e14 ( Context * __context__ ) {
+    return cast<bool>::from(test_2656aaa78de22e14(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xa51a880d594e91fd, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c },
+    { 0xca1141a5df264c9, false, (void*)&_FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62, &__wrap__FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 },
+    { 0xf9d06a336bb19150, true, (void*)&_FuncbuiltinTickclone_to_moveTick17180087396728260876_845ea85675060ffa, &__wrap__FuncbuiltinTickclone_to_moveTick17180087396728260876_845ea85675060ffa },
+    { 0x53b0d27e2411836, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25 },
+    { 0x5c51cb37e0913516, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115 },
+    { 0x7964cdf0a208493a, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b },
+    { 0x2832d7ef64a0974f, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18 },
+    { 0x40817e1f7f7a5c2d, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_1383cfa4b34f6947, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1383cfa4b34f6947 },
+    { 0x43062c7ddb244a44, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_4a7fa97b8c5ccfb7, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_4a7fa97b8c5ccfb7 },
+    { 0x146a6ae311659a63, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_884a04ef827bd92c, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_884a04ef827bd92c },
+    { 0x66b1927f818cbe7e, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_9986cc1a5b5d4fbe, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_9986cc1a5b5d4fbe },
+    { 0x7ed6db0e16009c06, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_2d94ff787941c5d1, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_2d94ff787941c5d1 },
+    { 0x6688e318746eb436, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_371cb4eb9d0ec912, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_371cb4eb9d0ec912 },
+    { 0xa36e4cbacae05749, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_1ab345ffce2a84ed, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1ab345ffce2a84ed },
+    { 0x4d41f18ecafabe84, false, (void*)&_FuncbuiltinTickerase_ifTick4694165798967666790_dcac6635e814f222, &__wrap__FuncbuiltinTickerase_ifTick4694165798967666790_dcac6635e814f222 },
+    { 0x24c2b720ac01e037, false, (void*)&test_erase_if_e1a9ece977525060, &__wrap_test_erase_if_e1a9ece977525060 },
+    { 0x4869f2bae91606dd, false, (void*)&test_2656aaa78de22e14, &__wrap_test_2656aaa78de22e14 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_1820733018562302916
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
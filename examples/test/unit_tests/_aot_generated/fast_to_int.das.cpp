@@ -0,0 +1,260 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_4960109901370717398 {
+
+// unused enumeration ConversionResult
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncTickcheckzTick11559719775077631235_3615c996cab64ce2 ( Context * __context__, char * const  __txt_rename_at_5_0, Func DAS_COMMENT((int32_t,char * const )) const  __fn_rename_at_5_1 );
+inline void _FuncTickcheckzTick11559719775077631235_c9848da057449c46 ( Context * __context__, char * const  __txt_rename_at_5_3, Func DAS_COMMENT((uint32_t,char * const )) const  __fn_rename_at_5_4 );
+inline void _FuncTickcheckzTick11559719775077631235_a1c7735e96bc5c23 ( Context * __context__, char * const  __txt_rename_at_5_6, Func DAS_COMMENT((int64_t,char * const )) const  __fn_rename_at_5_7 );
+inline void _FuncTickcheckzTick11559719775077631235_dedae1a2563714c5 ( Context * __context__, char * const  __txt_rename_at_5_9, Func DAS_COMMENT((uint64_t,char * const )) const  __fn_rename_at_5_10 );
+inline void _FuncTickcheckzTick11559719775077631235_a5fd07d5b18200df ( Context * __context__, char * const  __txt_rename_at_5_12, Func DAS_COMMENT((float,char * const )) const  __fn_rename_at_5_13 );
+inline void _FuncTickcheckzTick11559719775077631235_ea270f0de0005c23 ( Context * __context__, char * const  __txt_rename_at_5_15, Func DAS_COMMENT((double,char * const )) const  __fn_rename_at_5_16 );
+inline int32_t _Func_localfunction_thismodule_13_1Tickfunction_93bc845a800066f5 ( Context * __context__, char * const  __x_rename_at_13_18 );
+inline uint32_t _Func_localfunction_thismodule_14_2Tickfunction_abfde82961c14c9e ( Context * __context__, char * const  __x_rename_at_14_19 );
+inline int64_t _Func_localfunction_thismodule_15_3Tickfunction_ca2432d4a92c2aa3 ( Context * __context__, char * const  __x_rename_at_15_20 );
+inline uint64_t _Func_localfunction_thismodule_16_4Tickfunction_11966c9920a7383c ( Context * __context__, char * const  __x_rename_at_16_21 );
+inline float _Func_localfunction_thismodule_17_5Tickfunction_cf5642afe28f053e ( Context * __context__, char * const  __x_rename_at_17_22 );
+inline double _Func_localfunction_thismodule_18_6Tickfunction_3166f41acdd83831 ( Context * __context__, char * const  __x_rename_at_18_23 );
+inline bool test_bc182f484d2cb371 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncTickcheckzTick11559719775077631235_3615c996cab64ce2 ( Context * __context__, char * const  __txt_rename_at_5_0, Func DAS_COMMENT((int32_t,char * const )) const  __fn_rename_at_5_1 )
+{
+    int32_t __t_rename_at_6_2 = ((int32_t)das_invoke_function<int32_t>::invoke<char * const >(__context__,nullptr,__fn_rename_at_5_1,__txt_rename_at_5_0));
+    DAS_ASSERT((__t_rename_at_6_2 == 0));
+}
+
+inline void _FuncTickcheckzTick11559719775077631235_c9848da057449c46 ( Context * __context__, char * const  __txt_rename_at_5_3, Func DAS_COMMENT((uint32_t,char * const )) const  __fn_rename_at_5_4 )
+{
+    uint32_t __t_rename_at_6_5 = ((uint32_t)das_invoke_function<uint32_t>::invoke<char * const >(__context__,nullptr,__fn_rename_at_5_4,__txt_rename_at_5_3));
+    DAS_ASSERT((__t_rename_at_6_5 == 0x0u));
+}
+
+inline void _FuncTickcheckzTick11559719775077631235_a1c7735e96bc5c23 ( Context * __context__, char * const  __txt_rename_at_5_6, Func DAS_COMMENT((int64_t,char * const )) const  __fn_rename_at_5_7 )
+{
+    int64_t __t_rename_at_6_8 = ((int64_t)das_invoke_function<int64_t>::invoke<char * const >(__context__,nullptr,__fn_rename_at_5_7,__txt_rename_at_5_6));
+    DAS_ASSERT((__t_rename_at_6_8 == INT64_C(0)));
+}
+
+inline void _FuncTickcheckzTick11559719775077631235_dedae1a2563714c5 ( Context * __context__, char * const  __txt_rename_at_5_9, Func DAS_COMMENT((uint64_t,char * const )) const  __fn_rename_at_5_10 )
+{
+    uint64_t __t_rename_at_6_11 = ((uint64_t)das_invoke_function<uint64_t>::invoke<char * const >(__context__,nullptr,__fn_rename_at_5_10,__txt_rename_at_5_9));
+    DAS_ASSERT((__t_rename_at_6_11 == UINT64_C(0x0)));
+}
+
+inline void _FuncTickcheckzTick11559719775077631235_a5fd07d5b18200df ( Context * __context__, char * const  __txt_rename_at_5_12, Func DAS_COMMENT((float,char * const )) const  __fn_rename_at_5_13 )
+{
+    float __t_rename_at_6_14 = ((float)das_invoke_function<float>::invoke<char * const >(__context__,nullptr,__fn_rename_at_5_13,__txt_rename_at_5_12));
+    DAS_ASSERT((__t_rename_at_6_14 == 0.000000e+00f));
+}
+
+inline void _FuncTickcheckzTick11559719775077631235_ea270f0de0005c23 ( Context * __context__, char * const  __txt_rename_at_5_15, Func DAS_COMMENT((double,char * const )) const  __fn_rename_at_5_16 )
+{
+    double __t_rename_at_6_17 = ((double)das_invoke_function<double>::invoke<char * const >(__context__,nullptr,__fn_rename_at_5_16,__txt_rename_at_5_15));
+    DAS_ASSERT((__t_rename_at_6_17 == 0.000000e+00));
+}
+
+inline int32_t _Func_localfunction_thismodule_13_1Tickfunction_93bc845a800066f5 ( Context * __context__, char * const  __x_rename_at_13_18 )
+{
+    return das_auto_cast<int32_t>::cast(fast_to_int(__x_rename_at_13_18,false));
+}
+
+inline uint32_t _Func_localfunction_thismodule_14_2Tickfunction_abfde82961c14c9e ( Context * __context__, char * const  __x_rename_at_14_19 )
+{
+    return das_auto_cast<uint32_t>::cast(fast_to_uint(__x_rename_at_14_19,false));
+}
+
+inline int64_t _Func_localfunction_thismodule_15_3Tickfunction_ca2432d4a92c2aa3 ( Context * __context__, char * const  __x_rename_at_15_20 )
+{
+    return das_auto_cast<int64_t>::cast(fast_to_int64(__x_rename_at_15_20,false));
+}
+
+inline uint64_t _Func_localfunction_thismodule_16_4Tickfunction_11966c9920a7383c ( Context * __context__, char * const  __x_rename_at_16_21 )
+{
+    return das_auto_cast<uint64_t>::cast(fast_to_uint64(__x_rename_at_16_21,false));
+}
+
+inline float _Func_localfunction_thismodule_17_5Tickfunction_cf5642afe28f053e ( Context * __context__, char * const  __x_rename_at_17_22 )
+{
+    return das_auto_cast<float>::cast(fast_to_float(__x_rename_at_17_22));
+}
+
+inline double _Func_localfunction_thismodule_18_6Tickfunction_3166f41acdd83831 ( Context * __context__, char * const  __x_rename_at_18_23 )
+{
+    return das_auto_cast<double>::cast(fast_to_double(__x_rename_at_18_23));
+}
+
+inline bool test_bc182f484d2cb371 ( Context * __context__ )
+{
+    _FuncTickcheckzTick11559719775077631235_3615c996cab64ce2(__context__,((char *) "str"),Func(__context__->fnByMangledName(/*_localfunction_thismodule_13_1`function Cs*/ 0x7c58c711ec1d2e54)));
+    _FuncTickcheckzTick11559719775077631235_c9848da057449c46(__context__,((char *) "str"),Func(__context__->fnByMangledName(/*_localfunction_thismodule_14_2`function Cs*/ 0x1cd05f16bcfaa54)));
+    _FuncTickcheckzTick11559719775077631235_a1c7735e96bc5c23(__context__,((char *) "str"),Func(__context__->fnByMangledName(/*_localfunction_thismodule_15_3`function Cs*/ 0xc5d93d6f77709654)));
+    _FuncTickcheckzTick11559719775077631235_dedae1a2563714c5(__context__,((char *) "str"),Func(__context__->fnByMangledName(/*_localfunction_thismodule_16_4`function Cs*/ 0xec6bd14ad95f254)));
+    _FuncTickcheckzTick11559719775077631235_a5fd07d5b18200df(__context__,((char *) "str"),Func(__context__->fnByMangledName(/*_localfunction_thismodule_17_5`function Cs*/ 0xebf46337289cb654)));
+    _FuncTickcheckzTick11559719775077631235_ea270f0de0005c23(__context__,((char *) "str"),Func(__context__->fnByMangledName(/*_localfunction_thismodule_18_6`function Cs*/ 0x981d9a3324eb9a54)));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncTickcheckzTick11559719775077631235_3615c996cab64ce2 ( Context * __context__ ) {
+    char * const  arg_txt = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    Func DAS_COMMENT((int32_t,char * const )) const  arg_fn = cast_aot_arg<Func DAS_COMMENT((int32_t,char * const )) const >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTickcheckzTick11559719775077631235_3615c996cab64ce2(__context__, arg_txt, arg_fn);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickcheckzTick11559719775077631235_c9848da057449c46 ( Context * __context__ ) {
+    char * const  arg_txt = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    Func DAS_COMMENT((uint32_t,char * const )) const  arg_fn = cast_aot_arg<Func DAS_COMMENT((uint32_t,char * const )) const >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTickcheckzTick11559719775077631235_c9848da057449c46(__context__, arg_txt, arg_fn);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickcheckzTick11559719775077631235_a1c7735e96bc5c23 ( Context * __context__ ) {
+    char * const  arg_txt = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    Func DAS_COMMENT((int64_t,char * const )) const  arg_fn = cast_aot_arg<Func DAS_COMMENT((int64_t,char * const )) const >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTickcheckzTick11559719775077631235_a1c7735e96bc5c23(__context__, arg_txt, arg_fn);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickcheckzTick11559719775077631235_dedae1a2563714c5 ( Context * __context__ ) {
+    char * const  arg_txt = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    Func DAS_COMMENT((uint64_t,char * const )) const  arg_fn = cast_aot_arg<Func DAS_COMMENT((uint64_t,char * const )) const >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTickcheckzTick11559719775077631235_dedae1a2563714c5(__context__, arg_txt, arg_fn);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickcheckzTick11559719775077631235_a5fd07d5b18200df ( Context * __context__ ) {
+    char * const  arg_txt = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    Func DAS_COMMENT((float,char * const )) const  arg_fn = cast_aot_arg<Func DAS_COMMENT((float,char * const )) const >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTickcheckzTick11559719775077631235_a5fd07d5b18200df(__context__, arg_txt, arg_fn);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickcheckzTick11559719775077631235_ea270f0de0005c23 ( Context * __context__ ) {
+    char * const  arg_txt = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    Func DAS_COMMENT((double,char * const )) const  arg_fn = cast_aot_arg<Func DAS_COMMENT((double,char * const )) const >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTickcheckzTick11559719775077631235_ea270f0de0005c23(__context__, arg_txt, arg_fn);
+    return v_zero();
+}
+static vec4f __wrap__Func_localfunction_thismodule_13_1Tickfunction_93bc845a800066f5 ( Context * __context__ ) {
+    char * const  arg_x = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(_Func_localfunction_thismodule_13_1Tickfunction_93bc845a800066f5(__context__, arg_x));
+}
+static vec4f __wrap__Func_localfunction_thismodule_14_2Tickfunction_abfde82961c14c9e ( Context * __context__ ) {
+    char * const  arg_x = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<uint32_t>::from(_Func_localfunction_thismodule_14_2Tickfunction_abfde82961c14c9e(__context__, arg_x));
+}
+static vec4f __wrap__Func_localfunction_thismodule_15_3Tickfunction_ca2432d4a92c2aa3 ( Context * __context__ ) {
+    char * const  arg_x = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int64_t>::from(_Func_localfunction_thismodule_15_3Tickfunction_ca2432d4a92c2aa3(__context__, arg_x));
+}
+static vec4f __wrap__Func_localfunction_thismodule_16_4Tickfunction_11966c9920a7383c ( Context * __context__ ) {
+    char * const  arg_x = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<uint64_t>::from(_Func_localfunction_thismodule_16_4Tickfunction_11966c9920a7383c(__context__, arg_x));
+}
+static vec4f __wrap__Func_localfunction_thismodule_17_5Tickfunction_cf5642afe28f053e ( Context * __context__ ) {
+    char * const  arg_x = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<float>::from(_Func_localfunction_thismodule_17_5Tickfunction_cf5642afe28f053e(__context__, arg_x));
+}
+static vec4f __wrap__Func_localfunction_thismodule_18_6Tickfunction_3166f41acdd83831 ( Context * __context__ ) {
+    char * const  arg_x = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<double>::from(_Func_localfunction_thismodule_18_6Tickfunction_3166f41acdd83831(__context__, arg_x));
+}
+static vec4f __wrap_test_bc182f484d2cb371 ( Context * __context__ ) {
+    return cast<bool>::from(test_bc182f484d2cb371(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xe94ca76646a192c8, false, (void*)&_FuncTickcheckzTick11559719775077631235_3615c996cab64ce2, &__wrap__FuncTickcheckzTick11559719775077631235_3615c996cab64ce2 },
+    { 0xf9e7984dd83ad658, false, (void*)&_FuncTickcheckzTick11559719775077631235_c9848da057449c46, &__wrap__FuncTickcheckzTick11559719775077631235_c9848da057449c46 },
+    { 0xb393f34b0807144b, false, (void*)&_FuncTickcheckzTick11559719775077631235_a1c7735e96bc5c23, &__wrap__FuncTickcheckzTick11559719775077631235_a1c7735e96bc5c23 },
+    { 0x65cc5d32296406ba, false, (void*)&_FuncTickcheckzTick11559719775077631235_dedae1a2563714c5, &__wrap__FuncTickcheckzTick11559719775077631235_dedae1a2563714c5 },
+    { 0x4d8e61be28d54ccf, false, (void*)&_FuncTickcheckzTick11559719775077631235_a5fd07d5b18200df, &__wrap__FuncTickcheckzTick11559719775077631235_a5fd07d5b18200df },
+    { 0xdc75774619eee635, false, (void*)&_FuncTickcheckzTick11559719775077631235_ea270f0de0005c23, &__wrap__FuncTickcheckzTick11559719775077631235_ea270f0de0005c23 },
+    { 0x8c57d7e8bd6fee5c, false, (void*)&_Func_localfunction_thismodule_13_1Tickfunction_93bc845a800066f5, &__wrap__Func_localfunction_thismodule_13_1Tickfunction_93bc845a800066f5 },
+    { 0xc2ea889da5722fef, false, (void*)&_Func_localfunction_thismodule_14_2Tickfunction_abfde82961c14c9e, &__wrap__Func_localfunction_thismodule_14_2Tickfunction_abfde82961c14c9e },
+    { 0x836932480bca031f, false, (void*)&_Func_localfunction_thismodule_15_3Tickfunction_ca2432d4a92c2aa3, &__wrap__Func_localfunction_thismodule_15_3Tickfunction_ca2432d4a92c2aa3 },
+    { 0x86449efa9c3ebad3, false, (void*)&_Func_localfunction_thismodule_16_4Tickfunction_11966c9920a7383c, &__wrap__Func_localfunction_thismodule_16_4Tickfunction_11966c9920a7383c },
+    { 0xa8027a36e4dd6e99, false, (void*)&_Func_localfunction_thismodule_17_5Tickfunction_cf5642afe28f053e, &__wrap__Func_localfunction_thismodule_17_5Tickfunction_cf5642afe28f053e },
+    { 0xd6fccba2f03433af, false, (void*)&_Func_localfunction_thismodule_18_6Tickfunction_3166f41acdd83831, &__wrap__Func_localfunction_thismodule_18_6Tickfunction_3166f41acdd83831 },
+    { 0x6884de1e35a22fc2, false, (void*)&test_bc182f484d2cb371, &__wrap_test_bc182f484d2cb371 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_4960109901370717398
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,175 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require haha
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_6898101411386565292 {
+
+namespace haha { struct Foo; };
+namespace haha {
+
+struct Foo {
+    int32_t a;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_57c938a40d00f04d ( Context * __context__, TArray<haha::Foo> & __a_rename_at_1336_0 );
+inline void _FuncbuiltinTickpushTick10769833213962245646_a103528099511075 ( Context * __context__, TArray<haha::Foo> & __Arr_rename_at_193_2, haha::Foo & __value_rename_at_193_3 );
+inline void finalize_c4cb0022205fed01 ( Context * __context__, haha::Foo & __f_rename_at_12_4 );
+inline bool test_74b108b544c1d8b7 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global<bool,0x7095fd97a176762a>(__context__) = false;/*all_good*/
+}
+
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_57c938a40d00f04d ( Context * __context__, TArray<haha::Foo> &  __a_rename_at_1336_0 )
+{
+    {
+        bool __need_loop_1338 = true;
+        // aV: haha::Foo aka TT&
+        das_iterator<TArray<haha::Foo>> __aV_iterator(__a_rename_at_1336_0);
+        haha::Foo * __aV_rename_at_1338_1;
+        __need_loop_1338 = __aV_iterator.first(__context__,(__aV_rename_at_1338_1)) && __need_loop_1338;
+        for ( ; __need_loop_1338 ; __need_loop_1338 = __aV_iterator.next(__context__,(__aV_rename_at_1338_1)) )
+        {
+            finalize_c4cb0022205fed01(__context__,das_arg<haha::Foo>::pass((*__aV_rename_at_1338_1)));
+        }
+        __aV_iterator.close(__context__,(__aV_rename_at_1338_1));
+    };
+    builtin_array_free(das_arg<TArray<haha::Foo>>::pass(__a_rename_at_1336_0),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickpushTick10769833213962245646_a103528099511075 ( Context * __context__, TArray<haha::Foo> &  __Arr_rename_at_193_2, haha::Foo &  __value_rename_at_193_3 )
+{
+    das_copy(__Arr_rename_at_193_2(builtin_array_push_back(das_arg<TArray<haha::Foo>>::pass(__Arr_rename_at_193_2),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_193_3);
+}
+
+inline void finalize_c4cb0022205fed01 ( Context * __context__, haha::Foo &  __f_rename_at_12_4 )
+{
+    das_copy(das_global<bool,0x7095fd97a176762a>(__context__) /*all_good*/,true);
+}
+
+inline bool test_74b108b544c1d8b7 ( Context * __context__ )
+{
+    haha::Foo _temp_make_local_19_14_0; _temp_make_local_19_14_0;
+    TArray<haha::Foo> __arr_rename_at_18_5;das_zero(__arr_rename_at_18_5);
+    _FuncbuiltinTickpushTick10769833213962245646_a103528099511075(__context__,das_arg<TArray<haha::Foo>>::pass(__arr_rename_at_18_5),das_arg<haha::Foo>::pass((([&]() -> haha::Foo& {
+        das_copy((_temp_make_local_19_14_0.a),(1));
+        return _temp_make_local_19_14_0;
+    })())));
+    _FuncbuiltinTickfinalizeTick13836114024949725080_57c938a40d00f04d(__context__,das_arg<TArray<haha::Foo>>::pass(__arr_rename_at_18_5));
+    DAS_ASSERT((das_global<bool,0x7095fd97a176762a>(__context__) /*all_good*/));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncbuiltinTickfinalizeTick13836114024949725080_57c938a40d00f04d ( Context * __context__ ) {
+    TArray<haha::Foo> &  arg_a = cast_aot_arg<TArray<haha::Foo> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickfinalizeTick13836114024949725080_57c938a40d00f04d(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpushTick10769833213962245646_a103528099511075 ( Context * __context__ ) {
+    TArray<haha::Foo> &  arg_Arr = cast_aot_arg<TArray<haha::Foo> & >::to(*__context__,__context__->abiArguments()[0]);
+    haha::Foo &  arg_value = cast_aot_arg<haha::Foo & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick10769833213962245646_a103528099511075(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap_finalize_c4cb0022205fed01 ( Context * __context__ ) {
+    haha::Foo &  arg_f = cast_aot_arg<haha::Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_c4cb0022205fed01(__context__, arg_f);
+    return v_zero();
+}
+static vec4f __wrap_test_74b108b544c1d8b7 ( Context * __context__ ) {
+    return cast<bool>::from(test_74b108b544c1d8b7(__context__));
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x2acb4ed421bafc67, false, (void*)&_FuncbuiltinTickfinalizeTick13836114024949725080_57c938a40d00f04d, &__wrap__FuncbuiltinTickfinalizeTick13836114024949725080_57c938a40d00f04d },
+    { 0x9f168b36339c6d48, false, (void*)&_FuncbuiltinTickpushTick10769833213962245646_a103528099511075, &__wrap__FuncbuiltinTickpushTick10769833213962245646_a103528099511075 },
+    { 0xd3a1e422430e9ac0, false, (void*)&finalize_c4cb0022205fed01, &__wrap_finalize_c4cb0022205fed01 },
+    { 0x3e94e0c747359912, false, (void*)&test_74b108b544c1d8b7, &__wrap_test_74b108b544c1d8b7 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0xaf727f51e9fdabd7, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_6898101411386565292
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
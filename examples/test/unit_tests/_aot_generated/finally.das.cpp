@@ -0,0 +1,273 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_9410646905821642642 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline bool test_if_finally_6dff4e7d96cd13e6 ( Context * __context__ );
+inline bool test_for_finally_d6a5d909baacb64a ( Context * __context__ );
+inline int32_t one_29470708591669d6 ( Context * __context__ );
+inline bool test_while_finally_ff76dd2083e5de23 ( Context * __context__ );
+inline int32_t func_finally_5209b4590172ac17 ( Context * __context__ );
+inline void test_func_finally_5f19e87646662715 ( Context * __context__ );
+inline void test_block_finally_6446ce7ace14d894 ( Context * __context__ );
+inline bool test_ec6d879eb1b52187 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global<int32_t,0x1538b7e630081910>(__context__) = 1;/*ONE*/
+    das_global<int32_t,0x6eff7c528f77a099>(__context__) = 0;/*glob*/
+    das_global<int32_t,0xd2733feeec7de7c7>(__context__) = 0;/*glob_count*/
+}
+
+inline bool test_if_finally_6dff4e7d96cd13e6 ( Context * __context__ )
+{
+    TDim<int32_t,10> __t_rename_at_6_0;das_zero(__t_rename_at_6_0);
+    int32_t __count_rename_at_7_1 = 0;
+    {
+        bool __need_loop_8 = true;
+        // x: int const
+        das_iterator<range> __x_iterator(range(0,10));
+        int32_t __x_rename_at_8_2;
+        __need_loop_8 = __x_iterator.first(__context__,(__x_rename_at_8_2)) && __need_loop_8;
+        for ( ; __need_loop_8 ; __need_loop_8 = __x_iterator.next(__context__,(__x_rename_at_8_2)) )
+        {
+            das_copy(__t_rename_at_6_0(__x_rename_at_8_2,__context__),__x_rename_at_8_2 + 1);
+            if ( __x_rename_at_8_2 == 5 )
+            {
+                /* finally */ auto __finally_10= das_finally([&](){
+                das_copy(__t_rename_at_6_0(9,__context__),13);
+                __count_rename_at_7_1++;
+                /* end finally */ });
+                break;
+            };
+        }
+        __x_iterator.close(__context__,(__x_rename_at_8_2));
+    };
+    DAS_ASSERT(((__count_rename_at_7_1 == 1) && (__t_rename_at_6_0(9,__context__) == 13)));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline bool test_for_finally_d6a5d909baacb64a ( Context * __context__ )
+{
+    int32_t __uno_rename_at_26_6; memset((void*)&__uno_rename_at_26_6,0,sizeof(__uno_rename_at_26_6));
+    TDim<int32_t,10> __t_rename_at_23_3;das_zero(__t_rename_at_23_3);
+    int32_t __count_rename_at_24_4 = 0;
+    {
+        bool __need_loop_25 = true;
+        // x: int const
+        das_iterator<range> __x_iterator(range(0,10));
+        int32_t __x_rename_at_25_5;
+        __need_loop_25 = __x_iterator.first(__context__,(__x_rename_at_25_5)) && __need_loop_25;
+        /* finally */ auto __finally_25= das_finally([&](){
+        das_copy(__t_rename_at_23_3(9,__context__),13);
+        (__count_rename_at_24_4 += __uno_rename_at_26_6);
+        /* end finally */ });
+        for ( ; __need_loop_25 ; __need_loop_25 = __x_iterator.next(__context__,(__x_rename_at_25_5)) )
+        {
+            __uno_rename_at_26_6 = ((int32_t)one_29470708591669d6(__context__));
+            das_copy(__t_rename_at_23_3(__x_rename_at_25_5,__context__),__x_rename_at_25_5 + __uno_rename_at_26_6);
+            if ( __x_rename_at_25_5 == 5 )
+            {
+                break;
+            };
+        }
+        __x_iterator.close(__context__,(__x_rename_at_25_5));
+    };
+    DAS_ASSERT(((__count_rename_at_24_4 == 1) && (__t_rename_at_23_3(9,__context__) == 13)));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline int32_t one_29470708591669d6 ( Context * __context__ )
+{
+    das_copy(das_global<int32_t,0x1538b7e630081910>(__context__) /*ONE*/,1);
+    DAS_ASSERT((das_global<int32_t,0x1538b7e630081910>(__context__) /*ONE*/ == 1));
+    return das_auto_cast<int32_t>::cast(das_global<int32_t,0x1538b7e630081910>(__context__) /*ONE*/);
+}
+
+inline bool test_while_finally_ff76dd2083e5de23 ( Context * __context__ )
+{
+    int32_t __uno_rename_at_56_10; memset((void*)&__uno_rename_at_56_10,0,sizeof(__uno_rename_at_56_10));
+    TDim<int32_t,10> __t_rename_at_52_7;das_zero(__t_rename_at_52_7);
+    int32_t __count_rename_at_53_8 = 0;
+    int32_t __x_rename_at_54_9 = 0;
+    {
+        /* finally */ auto __finally_55= das_finally([&](){
+        das_copy(__t_rename_at_52_7(9,__context__),(__uno_rename_at_56_10 + 12));
+        __count_rename_at_53_8++;
+        /* end finally */ });
+        while ( __x_rename_at_54_9 != 10 )
+        {
+            __uno_rename_at_56_10 = ((int32_t)one_29470708591669d6(__context__));
+            das_copy(__t_rename_at_52_7(__x_rename_at_54_9,__context__),__x_rename_at_54_9 + __uno_rename_at_56_10);
+            if ( __x_rename_at_54_9 == 5 )
+            {
+                break;
+            } else {
+                ++__x_rename_at_54_9;
+            };
+        }
+    };
+    DAS_ASSERT(((__count_rename_at_53_8 == 1) && (__t_rename_at_52_7(9,__context__) == 13)));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline int32_t func_finally_5209b4590172ac17 ( Context * __context__ )
+{
+    /* finally */ auto __finally_75= das_finally([&](){
+    das_copy(das_global<int32_t,0x6eff7c528f77a099>(__context__) /*glob*/,13);
+    das_global<int32_t,0xd2733feeec7de7c7>(__context__) /*glob_count*/++;
+    /* end finally */ });
+    return das_auto_cast<int32_t>::cast(12);
+}
+
+inline void test_func_finally_5f19e87646662715 ( Context * __context__ )
+{
+    das_copy(das_global<int32_t,0x6eff7c528f77a099>(__context__) /*glob*/,0);
+    das_copy(das_global<int32_t,0xd2733feeec7de7c7>(__context__) /*glob_count*/,0);
+    int32_t __t_rename_at_85_11 = ((int32_t)func_finally_5209b4590172ac17(__context__));
+    DAS_ASSERT((((__t_rename_at_85_11 == 12) && (das_global<int32_t,0x6eff7c528f77a099>(__context__) /*glob*/ == 13)) && (das_global<int32_t,0xd2733feeec7de7c7>(__context__) /*glob_count*/ == 1)));
+}
+
+inline void test_block_finally_6446ce7ace14d894 ( Context * __context__ )
+{
+    int32_t __t_rename_at_91_12 = 0;
+    das_invoke<void>::invoke(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> void{
+        /* finally */ auto __finally_92= das_finally([&](){
+        das_copy(__t_rename_at_91_12,2);
+        /* end finally */ });
+        das_copy(__t_rename_at_91_12,1);
+    });
+    DAS_ASSERT((__t_rename_at_91_12 == 2));
+}
+
+inline bool test_ec6d879eb1b52187 ( Context * __context__ )
+{
+    test_block_finally_6446ce7ace14d894(__context__);
+    test_for_finally_d6a5d909baacb64a(__context__);
+    test_if_finally_6dff4e7d96cd13e6(__context__);
+    test_while_finally_ff76dd2083e5de23(__context__);
+    test_func_finally_5f19e87646662715(__context__);
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_test_if_finally_6dff4e7d96cd13e6 ( Context * __context__ ) {
+    return cast<bool>::from(test_if_finally_6dff4e7d96cd13e6(__context__));
+}
+static vec4f __wrap_test_for_finally_d6a5d909baacb64a ( Context * __context__ ) {
+    return cast<bool>::from(test_for_finally_d6a5d909baacb64a(__context__));
+}
+static vec4f __wrap_one_29470708591669d6 ( Context * __context__ ) {
+    return cast<int32_t>::from(one_29470708591669d6(__context__));
+}
+static vec4f __wrap_test_while_finally_ff76dd2083e5de23 ( Context * __context__ ) {
+    return cast<bool>::from(test_while_finally_ff76dd2083e5de23(__context__));
+}
+static vec4f __wrap_func_finally_5209b4590172ac17 ( Context * __context__ ) {
+    return cast<int32_t>::from(func_finally_5209b4590172ac17(__context__));
+}
+static vec4f __wrap_test_func_finally_5f19e87646662715 ( Context * __context__ ) {
+    test_func_finally_5f19e87646662715(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_block_finally_6446ce7ace14d894 ( Context * __context__ ) {
+    test_block_finally_6446ce7ace14d894(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_ec6d879eb1b52187 ( Context * __context__ ) {
+    return cast<bool>::from(test_ec6d879eb1b52187(__context__));
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xa306856989e96ebc, false, (void*)&test_if_finally_6dff4e7d96cd13e6, &__wrap_test_if_finally_6dff4e7d96cd13e6 },
+    { 0x583ed6cd049e5b55, false, (void*)&test_for_finally_d6a5d909baacb64a, &__wrap_test_for_finally_d6a5d909baacb64a },
+    { 0xe3246a06524e630d, false, (void*)&one_29470708591669d6, &__wrap_one_29470708591669d6 },
+    { 0x17abd8cf9ac71c45, false, (void*)&test_while_finally_ff76dd2083e5de23, &__wrap_test_while_finally_ff76dd2083e5de23 },
+    { 0x1dcaec837d7fcd81, false, (void*)&func_finally_5209b4590172ac17, &__wrap_func_finally_5209b4590172ac17 },
+    { 0xc9a03cabb16ca437, false, (void*)&test_func_finally_5f19e87646662715, &__wrap_test_func_finally_5f19e87646662715 },
+    { 0x42e2cd5cfcf73ea2, false, (void*)&test_block_finally_6446ce7ace14d894, &__wrap_test_block_finally_6446ce7ace14d894 },
+    { 0xe228a25e646ef586, false, (void*)&test_ec6d879eb1b52187, &__wrap_test_ec6d879eb1b52187 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0xce308e344444e816, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_9410646905821642642
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,336 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require fio
+#include "daScript/misc/performance_time.h"
+#include "daScript/simulate/aot_builtin_fio.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14495767415548495907 {
+
+namespace  { struct Foo; };
+namespace fio { struct df_header; };
+// unused enumeration ConversionResult
+namespace fio {
+
+struct df_header {
+    uint32_t magic;
+    int32_t size;
+};
+static_assert(sizeof(df_header)==8,"structure size mismatch with DAS");
+static_assert(offsetof(df_header,magic)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(df_header,size)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Foo {
+    int32_t a;
+    float b;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==4,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__411ed0e77075265a;
+extern StructInfo __struct_info__64f61b3f6e7697e0;
+extern TypeInfo __type_info__576b64fcf1f4adde;
+extern TypeInfo __type_info__8ccd99311bbc21cd;
+extern TypeInfo __type_info__3884b34b905bfd2e;
+extern TypeInfo __type_info__92054307506f7145;
+extern TypeInfo __type_info__87b67f2e13f2e9e4;
+extern TypeInfo __type_info__d83b3ba409a17e95;
+extern TypeInfo __type_info__16d0aa3dd6b69257;
+extern TypeInfo __type_info__4198285eb3aaff2e;
+extern TypeInfo __type_info__89e3af2326da29b5;
+extern TypeInfo __type_info__40e59612a8c478e5;
+extern TypeInfo __type_info__32fb9d473a58cef3;
+extern TypeInfo __type_info__52c096950f9c0766;
+extern TypeInfo __type_info__af8afe4c86446b52;
+extern TypeInfo __type_info__bc69a005531fe739;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af5be84c85f468f0;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __struct_info__411ed0e77075265a_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xbcd691bb60c7d14c), "a", 0, 0 };
+VarInfo __struct_info__411ed0e77075265a_field_1 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xbcd694bb60c7d665), "b", 4, 0 };
+VarInfo * __struct_info__411ed0e77075265a_fields[2] =  { &__struct_info__411ed0e77075265a_field_0, &__struct_info__411ed0e77075265a_field_1 };
+StructInfo __struct_info__411ed0e77075265a = {"Foo", "", 0, __struct_info__411ed0e77075265a_fields, 2, 8, UINT64_C(0x945b59082c003622), nullptr, UINT64_C(0x411ed0e77075265a), 2 };
+VarInfo __struct_info__64f61b3f6e7697e0_field_0 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x3966e227d84341c9), "magic", 0, 0 };
+VarInfo __struct_info__64f61b3f6e7697e0_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x852abe946784f6e5), "size", 4, 0 };
+VarInfo * __struct_info__64f61b3f6e7697e0_fields[2] =  { &__struct_info__64f61b3f6e7697e0_field_0, &__struct_info__64f61b3f6e7697e0_field_1 };
+StructInfo __struct_info__64f61b3f6e7697e0 = {"df_header", "fio", 0, __struct_info__64f61b3f6e7697e0_fields, 2, 8, UINT64_C(0x0), nullptr, UINT64_C(0x64f61b3f6e7697e0), 2 };
+VarInfo __func_info__b0a4bcf6787cce7b_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af5be84c85f468f0, nullptr, nullptr, nullptr, 0, 0, nullptr, 41058, 24, UINT64_C(0x157d4243c6e6ccb3), "data", 0, 0 };
+VarInfo * __func_info__b0a4bcf6787cce7b_fields[1] =  { &__func_info__b0a4bcf6787cce7b_field_0 };
+FuncInfo __func_info__b0a4bcf6787cce7b = {"invoke block<(data:array<uint8> const#):void> const", "", __func_info__b0a4bcf6787cce7b_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xb0a4bcf6787cce7b), 0x0 };
+VarInfo __func_info__37b855a73aa341b4_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af5be84c85f468f0, nullptr, nullptr, nullptr, 0, 0, nullptr, 40994, 24, UINT64_C(0xaa5efbd3d5c6eca9), "data", 0, 0 };
+VarInfo * __func_info__37b855a73aa341b4_fields[1] =  { &__func_info__37b855a73aa341b4_field_0 };
+FuncInfo __func_info__37b855a73aa341b4 = {"invoke block<(data:array<uint8> const):void> const", "", __func_info__37b855a73aa341b4_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x37b855a73aa341b4), 0x0 };
+VarInfo __func_info__ddb31f01d5771c19_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__16d0aa3dd6b69257, nullptr, nullptr, nullptr, 0, 0, nullptr, 8236, 8, UINT64_C(0x5db987cad91e921b), "f", 0, 0 };
+VarInfo * __func_info__ddb31f01d5771c19_fields[1] =  { &__func_info__ddb31f01d5771c19_field_0 };
+FuncInfo __func_info__ddb31f01d5771c19 = {"invoke block<(f:fio::FILE const? const):void> const", "", __func_info__ddb31f01d5771c19_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xddb31f01d5771c19), 0x0 };
+TypeInfo __type_info__576b64fcf1f4adde = { Type::tStructure, &__struct_info__64f61b3f6e7697e0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 286, 8, UINT64_C(0x576b64fcf1f4adde) };
+TypeInfo __type_info__8ccd99311bbc21cd = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__92054307506f7145, nullptr, nullptr, nullptr, 0, 0, nullptr, 8300, 8, UINT64_C(0x8ccd99311bbc21cd) };
+TypeInfo __type_info__3884b34b905bfd2e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af5be84c85f468f0, nullptr, nullptr, nullptr, 0, 0, nullptr, 41058, 24, UINT64_C(0x3884b34b905bfd2e) };
+TypeInfo __type_info__92054307506f7145 = { Type::tUInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 124, 1, UINT64_C(0x92054307506f7145) };
+TypeInfo __type_info__87b67f2e13f2e9e4 = { Type::tStructure, &__struct_info__64f61b3f6e7697e0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 318, 8, UINT64_C(0x87b67f2e13f2e9e4) };
+TypeInfo __type_info__d83b3ba409a17e95 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af5be84c85f468f0, nullptr, nullptr, nullptr, 0, 0, nullptr, 40994, 24, UINT64_C(0xd83b3ba409a17e95) };
+TypeInfo __type_info__16d0aa3dd6b69257 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~fio::FILE"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 16, UINT64_C(0x16d0aa3dd6b69257) };
+TypeInfo __type_info__4198285eb3aaff2e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af5be84c85f468f0, nullptr, nullptr, nullptr, 0, 0, nullptr, 41122, 24, UINT64_C(0x4198285eb3aaff2e) };
+TypeInfo * __type_info__89e3af2326da29b5_arg_types[1] = { &__type_info__3884b34b905bfd2e };
+const char * __type_info__89e3af2326da29b5_arg_names[1] = { "data" };
+TypeInfo __type_info__89e3af2326da29b5 = { Type::tBlock, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__89e3af2326da29b5_arg_types, __type_info__89e3af2326da29b5_arg_names, 1, 0, nullptr, 34, 48, UINT64_C(0x89e3af2326da29b5) };
+TypeInfo * __type_info__40e59612a8c478e5_arg_types[1] = { &__type_info__d83b3ba409a17e95 };
+TypeInfo __type_info__40e59612a8c478e5 = { Type::tBlock, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__40e59612a8c478e5_arg_types, __type_info__89e3af2326da29b5_arg_names, 1, 0, nullptr, 34, 48, UINT64_C(0x40e59612a8c478e5) };
+TypeInfo __type_info__32fb9d473a58cef3 = { Type::tStructure, &__struct_info__411ed0e77075265a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 62, 8, UINT64_C(0x32fb9d473a58cef3) };
+TypeInfo __type_info__52c096950f9c0766 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__16d0aa3dd6b69257, nullptr, nullptr, nullptr, 0, 0, nullptr, 8236, 8, UINT64_C(0x52c096950f9c0766) };
+TypeInfo __type_info__af8afe4c86446b52 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf8afe4c86446b52) };
+TypeInfo __type_info__bc69a005531fe739 = { Type::tStructure, &__struct_info__411ed0e77075265a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 8, UINT64_C(0xbc69a005531fe739) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__af5be84c85f468f0 = { Type::tUInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xaf5be84c85f468f0) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {__type_info__16d0aa3dd6b69257, };
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__32fb9d473a58cef3, &__type_info__89e3af2326da29b5 };
+TypeInfo * __tinfo_1[2] = { &__type_info__bc69a005531fe739, &__type_info__4198285eb3aaff2e };
+TypeInfo * __tinfo_2[3] = { &__type_info__52c096950f9c0766, &__type_info__87b67f2e13f2e9e4, &__type_info__af8afe4c86446b52 };
+TypeInfo * __tinfo_3[3] = { &__type_info__52c096950f9c0766, &__type_info__8ccd99311bbc21cd, &__type_info__af8afe4c86446b52 };
+TypeInfo * __tinfo_4[3] = { &__type_info__52c096950f9c0766, &__type_info__576b64fcf1f4adde, &__type_info__af8afe4c86446b52 };
+TypeInfo * __tinfo_5[3] = { &__type_info__52c096950f9c0766, &__type_info__af63e44c8601fa24, &__type_info__40e59612a8c478e5 };
+
+inline void _FuncbuiltinTickbinary_saveTick14251134779876373816_14b232e499c8e78d ( Context * __context__, Foo const  & __obj_rename_at_1044_0, Block DAS_COMMENT((void,TArray<uint8_t> const )) const  & __subexpr_rename_at_1044_1 );
+inline void _FuncbuiltinTickbinary_loadTick7105023756628579436_2b5b58cf43b95cac ( Context * __context__, Foo & __obj_rename_at_1049_2, TArray<uint8_t> const  & __data_rename_at_1049_3 );
+inline int32_t _FuncfioTickfsaveTick496117492527920633_3e2f37219ccf3ebf ( Context * __context__, FILE const  * const  __f_rename_at_83_4, Foo const  & __buf_rename_at_83_5 );
+inline bool _FuncfioTickfloadTick13368020847338245798_4f1773ac43505c2e ( Context * __context__, FILE const  * const  __f_rename_at_64_11, Foo & __buf_rename_at_64_12 );
+inline void _FuncfioTickfopenTick3937565566638487747_e273ce764bbe9407 ( Context * __context__, char * const  __name_rename_at_12_17, char * const  __mode_rename_at_12_18, Block DAS_COMMENT((void,FILE const  * const )) const  & __blk_rename_at_12_19 );
+inline bool test_9fb5ce796a778a59 ( Context * __context__ );
+inline Foo Foo_122ce12ba4e1e18 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickbinary_saveTick14251134779876373816_14b232e499c8e78d ( Context * __context__, Foo const  &  __obj_rename_at_1044_0, Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &  __subexpr_rename_at_1044_1 )
+{
+    das_call_interop<void>::call(&_builtin_binary_save,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<Foo const  &>::from(__obj_rename_at_1044_0),cast<Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &>::from(__subexpr_rename_at_1044_1)));
+}
+
+inline void _FuncbuiltinTickbinary_loadTick7105023756628579436_2b5b58cf43b95cac ( Context * __context__, Foo &  __obj_rename_at_1049_2, TArray<uint8_t> const  &  __data_rename_at_1049_3 )
+{
+    das_call_interop<void>::call(&_builtin_binary_load,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<Foo &>::from(__obj_rename_at_1049_2),cast<TArray<uint8_t> const  &>::from(__data_rename_at_1049_3)));
+}
+
+inline int32_t _FuncfioTickfsaveTick496117492527920633_3e2f37219ccf3ebf ( Context * __context__, FILE const  * const  __f_rename_at_83_4, Foo const  &  __buf_rename_at_83_5 ) { das_stack_prologue __prologue(__context__,160,"fio`fsave`496117492527920633 " DAS_FILE_LINE);
+{
+    int32_t __r1_rename_at_84_6 = 0; int32_t __r2_rename_at_84_7 = 0;
+    _FuncbuiltinTickbinary_saveTick14251134779876373816_14b232e499c8e78d(__context__,__buf_rename_at_83_5,das_make_block<void,TArray<uint8_t> const  &>(__context__,112,0,&__func_info__b0a4bcf6787cce7b,[&](TArray<uint8_t> const  & __data_rename_at_85_8) -> void{
+        int32_t __len_rename_at_86_9 = ((int32_t)builtin_array_size(__data_rename_at_85_8));
+        fio::df_header __dfh_rename_at_87_10_ConstRef = ((fio::df_header)(([&]() -> fio::df_header {
+            fio::df_header __mks_87;
+            das_copy((__mks_87.magic),(0x12345678u));
+            das_copy((__mks_87.size),(__len_rename_at_86_9));
+            return __mks_87;
+        })()));
+        fio::df_header const  & __dfh_rename_at_87_10 = __dfh_rename_at_87_10_ConstRef;
+;
+        das_copy(__r1_rename_at_84_6,das_call_interop<int32_t>::call(&builtin_write,__context__,SimNode_AotInterop<3>(__tinfo_2,cast<FILE const  * const >::from(__f_rename_at_83_4),cast<fio::df_header const  &>::from(__dfh_rename_at_87_10),cast<int32_t>::from(8))));
+        das_copy(__r2_rename_at_84_7,das_call_interop<int32_t>::call(&builtin_write,__context__,SimNode_AotInterop<3>(__tinfo_3,cast<FILE const  * const >::from(__f_rename_at_83_4),cast<uint8_t const  * const >::from(das_ref(__context__,__data_rename_at_85_8(0,__context__))),cast<int32_t>::from(__len_rename_at_86_9))));
+    }));
+    return das_auto_cast<int32_t>::cast((__r1_rename_at_84_6 < 0) ? das_auto_cast<int32_t>::cast(__r1_rename_at_84_6) : das_auto_cast<int32_t>::cast(((__r2_rename_at_84_7 < 0) ? das_auto_cast<int32_t>::cast(__r2_rename_at_84_7) : das_auto_cast<int32_t>::cast((__r1_rename_at_84_6 + __r2_rename_at_84_7)))));
+}}
+
+inline bool _FuncfioTickfloadTick13368020847338245798_4f1773ac43505c2e ( Context * __context__, FILE const  * const  __f_rename_at_64_11, Foo &  __buf_rename_at_64_12 ) { das_stack_prologue __prologue(__context__,144,"fio`fload`13368020847338245798 " DAS_FILE_LINE);
+{
+    fio::df_header __dfh_rename_at_65_13;das_zero(__dfh_rename_at_65_13);
+    int32_t __r1_rename_at_66_14 = ((int32_t)das_call_interop<int32_t>::call(&builtin_read,__context__,SimNode_AotInterop<3>(__tinfo_4,cast<FILE const  * const >::from(__f_rename_at_64_11),cast<fio::df_header &>::from(__dfh_rename_at_65_13),cast<int32_t>::from(8))));
+    if ( __r1_rename_at_66_14 < 0 )
+    {
+        return das_auto_cast<bool>::cast(false);
+    } else {
+        if ( __dfh_rename_at_65_13.magic != 0x12345678u )
+        {
+            return das_auto_cast<bool>::cast(false);
+        } else {
+            bool __loaded_rename_at_73_15 = false;
+            das_call_interop<void>::call(&builtin_load,__context__,SimNode_AotInterop<3>(__tinfo_5,cast<FILE const  * const >::from(__f_rename_at_64_11),cast<int32_t>::from(__dfh_rename_at_65_13.size),cast<Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &>::from(das_make_block<void,TArray<uint8_t> const  &>(__context__,128,0,&__func_info__37b855a73aa341b4,[&](TArray<uint8_t> const  & __data_rename_at_74_16) -> void{
+                if ( builtin_array_size(__data_rename_at_74_16) != 0 )
+                {
+                    _FuncbuiltinTickbinary_loadTick7105023756628579436_2b5b58cf43b95cac(__context__,das_arg<Foo>::pass(__buf_rename_at_64_12),__data_rename_at_74_16);
+                    das_copy(__loaded_rename_at_73_15,true);
+                };
+            }))));
+            return das_auto_cast<bool>::cast(__loaded_rename_at_73_15);
+        };
+    };
+}}
+
+inline void _FuncfioTickfopenTick3937565566638487747_e273ce764bbe9407 ( Context * __context__, char * const  __name_rename_at_12_17, char * const  __mode_rename_at_12_18, Block DAS_COMMENT((void,FILE const  * const )) const  &  __blk_rename_at_12_19 )
+{
+    FILE const  * __f_rename_at_13_20 = ((FILE const  *)builtin_fopen(__name_rename_at_12_17,__mode_rename_at_12_18));
+    das_invoke<void>::invoke<FILE const  * const >(__context__,nullptr,__blk_rename_at_12_19,__f_rename_at_13_20);
+    if ( __f_rename_at_13_20 != nullptr )
+    {
+        builtin_fclose(__f_rename_at_13_20,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    };
+}
+
+inline bool test_9fb5ce796a778a59 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,160,"test " DAS_FILE_LINE);
+{
+    bool __saved_rename_at_12_21 = false;
+    bool __loaded_rename_at_13_22 = false;
+    Foo __foo0_rename_at_14_23_ConstRef = ((Foo)(([&]() -> Foo {
+        Foo __mks_14 = Foo_122ce12ba4e1e18(__context__);
+        return __mks_14;
+    })()));
+    Foo const  & __foo0_rename_at_14_23 = __foo0_rename_at_14_23_ConstRef;
+;
+    _FuncfioTickfopenTick3937565566638487747_e273ce764bbe9407(__context__,((char *) "test.bin"),((char *) "wb"),das_make_block<void,FILE const  * const >(__context__,128,0,&__func_info__ddb31f01d5771c19,[&](FILE const  * const  __f_rename_at_15_24) -> void{
+        if ( __f_rename_at_15_24 != nullptr )
+        {
+            _FuncfioTickfsaveTick496117492527920633_3e2f37219ccf3ebf(__context__,__f_rename_at_15_24,__foo0_rename_at_14_23);
+            das_copy(__saved_rename_at_12_21,true);
+        };
+    }));
+    Foo __foo1_rename_at_21_25;das_zero(__foo1_rename_at_21_25);
+    _FuncfioTickfopenTick3937565566638487747_e273ce764bbe9407(__context__,((char *) "test.bin"),((char *) "rb"),das_make_block<void,FILE const  * const >(__context__,144,0,&__func_info__ddb31f01d5771c19,[&](FILE const  * const  __f_rename_at_22_26) -> void{
+        if ( __f_rename_at_22_26 != nullptr )
+        {
+            _FuncfioTickfloadTick13368020847338245798_4f1773ac43505c2e(__context__,__f_rename_at_22_26,das_arg<Foo>::pass(__foo1_rename_at_21_25));
+            das_copy(__loaded_rename_at_13_22,true);
+        };
+    }));
+    DAS_ASSERT((__saved_rename_at_12_21));
+    DAS_ASSERT((__loaded_rename_at_13_22));
+    DAS_ASSERT(((__foo0_rename_at_14_23.a == __foo1_rename_at_21_25.a) && (__foo0_rename_at_14_23.b == __foo1_rename_at_21_25.b)));
+    return das_auto_cast<bool>::cast(true);
+}}
+
+inline Foo Foo_122ce12ba4e1e18 ( Context * __context__ )
+{
+    return /* <- */ das_auto_cast_move<Foo>::cast((([&]() -> Foo {
+        Foo __mks_5;
+        das_copy((__mks_5.a),(1));
+        das_copy((__mks_5.b),(2.000000e+00f));
+        return __mks_5;
+    })()));
+}
+static vec4f __wrap__FuncbuiltinTickbinary_saveTick14251134779876373816_14b232e499c8e78d ( Context * __context__ ) {
+    Foo const  &  arg_obj = cast_aot_arg<Foo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &  arg_subexpr = cast_aot_arg<Block DAS_COMMENT((void,TArray<uint8_t> const )) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickbinary_saveTick14251134779876373816_14b232e499c8e78d(__context__, arg_obj, arg_subexpr);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickbinary_loadTick7105023756628579436_2b5b58cf43b95cac ( Context * __context__ ) {
+    Foo &  arg_obj = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<uint8_t> const  &  arg_data = cast_aot_arg<TArray<uint8_t> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickbinary_loadTick7105023756628579436_2b5b58cf43b95cac(__context__, arg_obj, arg_data);
+    return v_zero();
+}
+static vec4f __wrap__FuncfioTickfsaveTick496117492527920633_3e2f37219ccf3ebf ( Context * __context__ ) {
+    FILE const  * const  arg_f = cast_aot_arg<FILE const  * const >::to(*__context__,__context__->abiArguments()[0]);
+    Foo const  &  arg_buf = cast_aot_arg<Foo const  & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t>::from(_FuncfioTickfsaveTick496117492527920633_3e2f37219ccf3ebf(__context__, arg_f, arg_buf));
+}
+static vec4f __wrap__FuncfioTickfloadTick13368020847338245798_4f1773ac43505c2e ( Context * __context__ ) {
+    FILE const  * const  arg_f = cast_aot_arg<FILE const  * const >::to(*__context__,__context__->abiArguments()[0]);
+    Foo &  arg_buf = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_FuncfioTickfloadTick13368020847338245798_4f1773ac43505c2e(__context__, arg_f, arg_buf));
+}
+static vec4f __wrap__FuncfioTickfopenTick3937565566638487747_e273ce764bbe9407 ( Context * __context__ ) {
+    char * const  arg_name = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_mode = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    Block DAS_COMMENT((void,FILE const  * const )) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((void,FILE const  * const )) const  & >::to(*__context__,__context__->abiArguments()[2]);
+    _FuncfioTickfopenTick3937565566638487747_e273ce764bbe9407(__context__, arg_name, arg_mode, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap_test_9fb5ce796a778a59 ( Context * __context__ ) {
+    return cast<bool>::from(test_9fb5ce796a778a59(__context__));
+}
+static vec4f __wrap_Foo_122ce12ba4e1e18 ( Context * __context__ ) {
+    *((Foo *) __context__->abiCMRES) = Foo_122ce12ba4e1e18(__context__);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xb7e38007d5cafa6f, false, (void*)&_FuncbuiltinTickbinary_saveTick14251134779876373816_14b232e499c8e78d, &__wrap__FuncbuiltinTickbinary_saveTick14251134779876373816_14b232e499c8e78d },
+    { 0xbf796a5c6f5a2bd3, false, (void*)&_FuncbuiltinTickbinary_loadTick7105023756628579436_2b5b58cf43b95cac, &__wrap__FuncbuiltinTickbinary_loadTick7105023756628579436_2b5b58cf43b95cac },
+    { 0x7c49b35fc34f159d, false, (void*)&_FuncfioTickfsaveTick496117492527920633_3e2f37219ccf3ebf, &__wrap__FuncfioTickfsaveTick496117492527920633_3e2f37219ccf3ebf },
+    { 0x4a32eacc8fec6b32, false, (void*)&_FuncfioTickfloadTick13368020847338245798_4f1773ac43505c2e, &__wrap__FuncfioTickfloadTick13368020847338245798_4f1773ac43505c2e },
+    { 0x74634295cdfdd608, false, (void*)&_FuncfioTickfopenTick3937565566638487747_e273ce764bbe9407, &__wrap__FuncfioTickfopenTick3937565566638487747_e273ce764bbe9407 },
+    { 0x8f62ebc5ff91c41b, false, (void*)&test_9fb5ce796a778a59, &__wrap_test_9fb5ce796a778a59 },
+    { 0x51e8d1aee5dc781a, true, (void*)&Foo_122ce12ba4e1e18, &__wrap_Foo_122ce12ba4e1e18 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_14495767415548495907
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
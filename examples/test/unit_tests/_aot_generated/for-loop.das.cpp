@@ -0,0 +1,622 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_10734064037579541433 {
+
+extern TypeInfo __type_info__af8afe4c86446b52;
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__af96fe4c8658cf52;
+
+TypeInfo __type_info__af8afe4c86446b52 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf8afe4c86446b52) };
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__af96fe4c8658cf52 = { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf96fe4c8658cf52) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[3] = { &__type_info__af90fe4c864e9d52, &__type_info__af8afe4c86446b52, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_1[3] = { &__type_info__af90fe4c864e9d52, &__type_info__af96fe4c8658cf52, &__type_info__af90fe4c864e9d52 };
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 ( Context * __context__, range __rng_rename_at_1398_0 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_68_2, int32_t __newSize_rename_at_68_3 );
+inline void test_from_gte_to_e504be6811dd58fc ( Context * __context__ );
+inline void test_for64_5e0ed013f80f81bc ( Context * __context__ );
+inline bool test_d4424f18f0964f11 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 ( Context * __context__, range __rng_rename_at_1398_0 )
+{
+    Sequence DAS_COMMENT((int32_t)) __it_rename_at_1399_1;das_zero(__it_rename_at_1399_1);
+    builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_1399_1),__rng_rename_at_1398_0,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_1399_1);
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_68_2, int32_t __newSize_rename_at_68_3 )
+{
+    builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_68_2),__newSize_rename_at_68_3,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void test_from_gte_to_e504be6811dd58fc ( Context * __context__ )
+{
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_43_14_0; _temp_make_local_43_14_0;
+    {
+        bool __need_loop_4 = true;
+        // x: int const
+        das_iterator<range> __x_iterator(range(3,2));
+        int32_t __x_rename_at_4_4;
+        __need_loop_4 = __x_iterator.first(__context__,(__x_rename_at_4_4)) && __need_loop_4;
+        for ( ; __need_loop_4 ; __need_loop_4 = __x_iterator.next(__context__,(__x_rename_at_4_4)) )
+        {
+            DAS_ASSERT((false));
+        }
+        __x_iterator.close(__context__,(__x_rename_at_4_4));
+    };
+    {
+        bool __need_loop_7 = true;
+        // x: uint const
+        das_iterator<urange> __x_iterator(urange(3,2));
+        uint32_t __x_rename_at_7_5;
+        __need_loop_7 = __x_iterator.first(__context__,(__x_rename_at_7_5)) && __need_loop_7;
+        for ( ; __need_loop_7 ; __need_loop_7 = __x_iterator.next(__context__,(__x_rename_at_7_5)) )
+        {
+            DAS_ASSERT((false));
+        }
+        __x_iterator.close(__context__,(__x_rename_at_7_5));
+    };
+    {
+        bool __need_loop_11 = true;
+        // x: int const
+        das_iterator<range> __x_iterator(range(3,2));
+        int32_t __x_rename_at_11_6;
+        __need_loop_11 = __x_iterator.first(__context__,(__x_rename_at_11_6)) && __need_loop_11;
+        for ( ; __need_loop_11 ; __need_loop_11 = __x_iterator.next(__context__,(__x_rename_at_11_6)) )
+        {
+            builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<3>(__tinfo_0, cast<char * const >::from(((char *) "x=")), cast<int32_t>::from(__x_rename_at_11_6), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+            DAS_ASSERT((false));
+        }
+        __x_iterator.close(__context__,(__x_rename_at_11_6));
+    };
+    {
+        bool __need_loop_15 = true;
+        // x: uint const
+        das_iterator<urange> __x_iterator(urange(3,2));
+        uint32_t __x_rename_at_15_7;
+        __need_loop_15 = __x_iterator.first(__context__,(__x_rename_at_15_7)) && __need_loop_15;
+        for ( ; __need_loop_15 ; __need_loop_15 = __x_iterator.next(__context__,(__x_rename_at_15_7)) )
+        {
+            builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "x=")), cast<uint32_t>::from(__x_rename_at_15_7), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+            DAS_ASSERT((false));
+        }
+        __x_iterator.close(__context__,(__x_rename_at_15_7));
+    };
+    {
+        bool __need_loop_20 = true;
+        // x: int const
+        das_iterator<range> __x_iterator(range(3,2));
+        int32_t __x_rename_at_20_8;
+        __need_loop_20 = __x_iterator.first(__context__,(__x_rename_at_20_8)) && __need_loop_20;
+        for ( ; __need_loop_20 ; __need_loop_20 = __x_iterator.next(__context__,(__x_rename_at_20_8)) )
+        {
+            break;
+        }
+        __x_iterator.close(__context__,(__x_rename_at_20_8));
+    };
+    {
+        bool __need_loop_23 = true;
+        // x: uint const
+        das_iterator<urange> __x_iterator(urange(3,2));
+        uint32_t __x_rename_at_23_9;
+        __need_loop_23 = __x_iterator.first(__context__,(__x_rename_at_23_9)) && __need_loop_23;
+        for ( ; __need_loop_23 ; __need_loop_23 = __x_iterator.next(__context__,(__x_rename_at_23_9)) )
+        {
+            break;
+        }
+        __x_iterator.close(__context__,(__x_rename_at_23_9));
+    };
+    {
+        bool __need_loop_27 = true;
+        // x: int const
+        das_iterator<range> __x_iterator(range(3,2));
+        int32_t __x_rename_at_27_10;
+        __need_loop_27 = __x_iterator.first(__context__,(__x_rename_at_27_10)) && __need_loop_27;
+        for ( ; __need_loop_27 ; __need_loop_27 = __x_iterator.next(__context__,(__x_rename_at_27_10)) )
+        {
+            DAS_ASSERT((false));
+            break;
+        }
+        __x_iterator.close(__context__,(__x_rename_at_27_10));
+    };
+    {
+        bool __need_loop_31 = true;
+        // x: uint const
+        das_iterator<urange> __x_iterator(urange(3,2));
+        uint32_t __x_rename_at_31_11;
+        __need_loop_31 = __x_iterator.first(__context__,(__x_rename_at_31_11)) && __need_loop_31;
+        for ( ; __need_loop_31 ; __need_loop_31 = __x_iterator.next(__context__,(__x_rename_at_31_11)) )
+        {
+            DAS_ASSERT((false));
+            break;
+        }
+        __x_iterator.close(__context__,(__x_rename_at_31_11));
+    };
+    {
+        bool __need_loop_36 = true;
+        // x: int const
+        das_iterator<range> __x_iterator(range(3,2));
+        int32_t __x_rename_at_36_14;
+        __need_loop_36 = __x_iterator.first(__context__,(__x_rename_at_36_14)) && __need_loop_36;
+        // y: uint const
+        das_iterator<urange> __y_iterator(urange(3,2));
+        uint32_t __y_rename_at_36_15;
+        __need_loop_36 = __y_iterator.first(__context__,(__y_rename_at_36_15)) && __need_loop_36;
+        for ( ; __need_loop_36 ; __need_loop_36 = __x_iterator.next(__context__,(__x_rename_at_36_14)) && __y_iterator.next(__context__,(__y_rename_at_36_15)) )
+        {
+            DAS_ASSERT((false));
+        }
+        __y_iterator.close(__context__,(__y_rename_at_36_15));
+        __x_iterator.close(__context__,(__x_rename_at_36_14));
+    };
+    {
+        bool __need_loop_39 = true;
+        // x: uint const
+        das_iterator<urange> __x_iterator(urange(3,2));
+        uint32_t __x_rename_at_39_18;
+        __need_loop_39 = __x_iterator.first(__context__,(__x_rename_at_39_18)) && __need_loop_39;
+        // y: uint const
+        das_iterator<urange> __y_iterator(urange(3,2));
+        uint32_t __y_rename_at_39_19;
+        __need_loop_39 = __y_iterator.first(__context__,(__y_rename_at_39_19)) && __need_loop_39;
+        for ( ; __need_loop_39 ; __need_loop_39 = __x_iterator.next(__context__,(__x_rename_at_39_18)) && __y_iterator.next(__context__,(__y_rename_at_39_19)) )
+        {
+            DAS_ASSERT((false));
+        }
+        __y_iterator.close(__context__,(__y_rename_at_39_19));
+        __x_iterator.close(__context__,(__x_rename_at_39_18));
+    };
+    {
+        bool __need_loop_43 = true;
+        // x: int
+        das_iterator<Sequence DAS_COMMENT((int32_t))> __x_iterator((_temp_make_local_43_14_0 = (_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(3,2)))));
+        int32_t __x_rename_at_43_20;
+        __need_loop_43 = __x_iterator.first(__context__,(__x_rename_at_43_20)) && __need_loop_43;
+        for ( ; __need_loop_43 ; __need_loop_43 = __x_iterator.next(__context__,(__x_rename_at_43_20)) )
+        {
+            DAS_ASSERT((false));
+        }
+        __x_iterator.close(__context__,(__x_rename_at_43_20));
+    };
+}
+
+inline void test_for64_5e0ed013f80f81bc ( Context * __context__ )
+{
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_51_35_1; _temp_make_local_51_35_1;
+    int64_t __t_rename_at_50_21 = INT64_C(0);
+    {
+        bool __need_loop_51 = true;
+        // x: int64 const
+        das_iterator<range64> __x_iterator(range64(0,100));
+        int64_t __x_rename_at_51_24;
+        __need_loop_51 = __x_iterator.first(__context__,(__x_rename_at_51_24)) && __need_loop_51;
+        // y: int
+        das_iterator_count DAS_COMMENT((_temp_make_local_51_35_1 = (builtin_count(0,1,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))) __y_iterator(0,1);
+        int32_t __y_rename_at_51_25;
+        __need_loop_51 = __y_iterator.first(__context__,(__y_rename_at_51_25)) && __need_loop_51;
+        for ( ; __need_loop_51 ; __need_loop_51 = __x_iterator.next(__context__,(__x_rename_at_51_24)) && __y_iterator.next(__context__,(__y_rename_at_51_25)) )
+        {
+            DAS_ASSERT((__t_rename_at_50_21 == __x_rename_at_51_24));
+            DAS_ASSERT((__t_rename_at_50_21 == int64_t(__y_rename_at_51_25)));
+            ++__t_rename_at_50_21;
+        }
+        __y_iterator.close(__context__,(__y_rename_at_51_25));
+        __x_iterator.close(__context__,(__x_rename_at_51_24));
+    };
+    DAS_ASSERT((__t_rename_at_50_21 == INT64_C(100)));
+    uint64_t __t_rename_at_59_26 = UINT64_C(0x0);
+    {
+        bool __need_loop_60 = true;
+        // x: uint64 const
+        das_iterator<urange64> __x_iterator(urange64(0,100));
+        uint64_t __x_rename_at_60_27;
+        __need_loop_60 = __x_iterator.first(__context__,(__x_rename_at_60_27)) && __need_loop_60;
+        for ( ; __need_loop_60 ; __need_loop_60 = __x_iterator.next(__context__,(__x_rename_at_60_27)) )
+        {
+            DAS_ASSERT((__t_rename_at_59_26 == __x_rename_at_60_27));
+            ++__t_rename_at_59_26;
+        }
+        __x_iterator.close(__context__,(__x_rename_at_60_27));
+    };
+    DAS_ASSERT((__t_rename_at_59_26 == UINT64_C(0x64)));
+}
+
+inline bool test_d4424f18f0964f11 ( Context * __context__ )
+{
+    TDim<int32_t,10> __a_rename_at_72_28;das_zero(__a_rename_at_72_28);
+    int32_t __i_rename_at_73_29 = 0;
+    {
+        bool __need_loop_74 = true;
+        // l: int& -const
+        das_iterator<TDim<int32_t,10>> __l_iterator(__a_rename_at_72_28);
+        int32_t * __l_rename_at_74_30;
+        __need_loop_74 = __l_iterator.first(__context__,(__l_rename_at_74_30)) && __need_loop_74;
+        for ( ; __need_loop_74 ; __need_loop_74 = __l_iterator.next(__context__,(__l_rename_at_74_30)) )
+        {
+            das_copy((*__l_rename_at_74_30),__i_rename_at_73_29);
+            ++__i_rename_at_73_29;
+        }
+        __l_iterator.close(__context__,(__l_rename_at_74_30));
+    };
+    DAS_ASSERT((__i_rename_at_73_29 == 10));
+    das_copy(__i_rename_at_73_29,0);
+    {
+        bool __need_loop_80 = true;
+        // l: int& -const
+        das_iterator<TDim<int32_t,10>> __l_iterator(__a_rename_at_72_28);
+        int32_t * __l_rename_at_80_31;
+        __need_loop_80 = __l_iterator.first(__context__,(__l_rename_at_80_31)) && __need_loop_80;
+        for ( ; __need_loop_80 ; __need_loop_80 = __l_iterator.next(__context__,(__l_rename_at_80_31)) )
+        {
+            DAS_ASSERT(((*__l_rename_at_80_31) == __i_rename_at_73_29));
+            ++__i_rename_at_73_29;
+        }
+        __l_iterator.close(__context__,(__l_rename_at_80_31));
+    };
+    TArray<int32_t> __a_rename_at_87_32;das_zero(__a_rename_at_87_32);
+    int32_t __i_rename_at_88_33 = 0;
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_87_32),13);
+    {
+        bool __need_loop_90 = true;
+        // l: int&
+        das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_87_32);
+        int32_t * __l_rename_at_90_34;
+        __need_loop_90 = __l_iterator.first(__context__,(__l_rename_at_90_34)) && __need_loop_90;
+        for ( ; __need_loop_90 ; __need_loop_90 = __l_iterator.next(__context__,(__l_rename_at_90_34)) )
+        {
+            das_copy((*__l_rename_at_90_34),__i_rename_at_88_33++);
+        }
+        __l_iterator.close(__context__,(__l_rename_at_90_34));
+    };
+    DAS_ASSERT((__i_rename_at_88_33 == 13));
+    das_copy(__i_rename_at_88_33,0);
+    {
+        bool __need_loop_95 = true;
+        // l: int&
+        das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_87_32);
+        int32_t * __l_rename_at_95_35;
+        __need_loop_95 = __l_iterator.first(__context__,(__l_rename_at_95_35)) && __need_loop_95;
+        for ( ; __need_loop_95 ; __need_loop_95 = __l_iterator.next(__context__,(__l_rename_at_95_35)) )
+        {
+            DAS_ASSERT(((*__l_rename_at_95_35) == __i_rename_at_88_33));
+            ++__i_rename_at_88_33;
+        }
+        __l_iterator.close(__context__,(__l_rename_at_95_35));
+    };
+    TDim<int32_t,10> __a_rename_at_102_36;das_zero(__a_rename_at_102_36); TDim<int32_t,10> __b_rename_at_102_37;das_zero(__b_rename_at_102_37);
+    int32_t __i_rename_at_103_38 = 0;
+    {
+        bool __need_loop_104 = true;
+        // l: int& -const
+        das_iterator<TDim<int32_t,10>> __l_iterator(__a_rename_at_102_36);
+        int32_t * __l_rename_at_104_41;
+        __need_loop_104 = __l_iterator.first(__context__,(__l_rename_at_104_41)) && __need_loop_104;
+        // r: int& -const
+        das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_102_37);
+        int32_t * __r_rename_at_104_42;
+        __need_loop_104 = __r_iterator.first(__context__,(__r_rename_at_104_42)) && __need_loop_104;
+        for ( ; __need_loop_104 ; __need_loop_104 = __l_iterator.next(__context__,(__l_rename_at_104_41)) && __r_iterator.next(__context__,(__r_rename_at_104_42)) )
+        {
+            das_copy((*__r_rename_at_104_42),(__i_rename_at_103_38 * 2) - 5);
+            das_copy((*__l_rename_at_104_41),__i_rename_at_103_38++);
+        }
+        __r_iterator.close(__context__,(__r_rename_at_104_42));
+        __l_iterator.close(__context__,(__l_rename_at_104_41));
+    };
+    DAS_ASSERT((__i_rename_at_103_38 == 10));
+    das_copy(__i_rename_at_103_38,0);
+    {
+        bool __need_loop_110 = true;
+        // l: int& -const
+        das_iterator<TDim<int32_t,10>> __l_iterator(__a_rename_at_102_36);
+        int32_t * __l_rename_at_110_45;
+        __need_loop_110 = __l_iterator.first(__context__,(__l_rename_at_110_45)) && __need_loop_110;
+        // r: int& -const
+        das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_102_37);
+        int32_t * __r_rename_at_110_46;
+        __need_loop_110 = __r_iterator.first(__context__,(__r_rename_at_110_46)) && __need_loop_110;
+        for ( ; __need_loop_110 ; __need_loop_110 = __l_iterator.next(__context__,(__l_rename_at_110_45)) && __r_iterator.next(__context__,(__r_rename_at_110_46)) )
+        {
+            DAS_ASSERT(((*__r_rename_at_110_46) == ((__i_rename_at_103_38 * 2) - 5)));
+            DAS_VERIFY(((*__l_rename_at_110_45) == __i_rename_at_103_38++));
+        }
+        __r_iterator.close(__context__,(__r_rename_at_110_46));
+        __l_iterator.close(__context__,(__l_rename_at_110_45));
+    };
+    das_copy(__i_rename_at_103_38,0);
+    {
+        bool __need_loop_115 = true;
+        // l: int& -const
+        das_iterator<TDim<int32_t,10>> __l_iterator(__a_rename_at_102_36);
+        int32_t * __l_rename_at_115_49;
+        __need_loop_115 = __l_iterator.first(__context__,(__l_rename_at_115_49)) && __need_loop_115;
+        // r: int& -const
+        das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_102_37);
+        int32_t * __r_rename_at_115_50;
+        __need_loop_115 = __r_iterator.first(__context__,(__r_rename_at_115_50)) && __need_loop_115;
+        for ( ; __need_loop_115 ; __need_loop_115 = __l_iterator.next(__context__,(__l_rename_at_115_49)) && __r_iterator.next(__context__,(__r_rename_at_115_50)) )
+        {
+            if ( (*__l_rename_at_115_49) > (*__r_rename_at_115_50) )
+            {
+                DAS_ASSERT(((*__l_rename_at_115_49) > (*__r_rename_at_115_50)));
+                ++__i_rename_at_103_38;
+            };
+        }
+        __r_iterator.close(__context__,(__r_rename_at_115_50));
+        __l_iterator.close(__context__,(__l_rename_at_115_49));
+    };
+    DAS_ASSERT((__i_rename_at_103_38 == 5));
+    TArray<int32_t> __a_rename_at_125_51;das_zero(__a_rename_at_125_51);
+    TDim<int32_t,10> __b_rename_at_126_52;das_zero(__b_rename_at_126_52);
+    int32_t __i_rename_at_127_53 = 0;
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_125_51),4);
+    {
+        bool __need_loop_129 = true;
+        // l: int&
+        das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_125_51);
+        int32_t * __l_rename_at_129_56;
+        __need_loop_129 = __l_iterator.first(__context__,(__l_rename_at_129_56)) && __need_loop_129;
+        // r: int& -const
+        das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_126_52);
+        int32_t * __r_rename_at_129_57;
+        __need_loop_129 = __r_iterator.first(__context__,(__r_rename_at_129_57)) && __need_loop_129;
+        for ( ; __need_loop_129 ; __need_loop_129 = __l_iterator.next(__context__,(__l_rename_at_129_56)) && __r_iterator.next(__context__,(__r_rename_at_129_57)) )
+        {
+            DAS_ASSERT((__i_rename_at_127_53 < 4));
+            das_copy((*__r_rename_at_129_57),(__i_rename_at_127_53 * 2) - 5);
+            das_copy((*__l_rename_at_129_56),__i_rename_at_127_53++);
+        }
+        __r_iterator.close(__context__,(__r_rename_at_129_57));
+        __l_iterator.close(__context__,(__l_rename_at_129_56));
+    };
+    DAS_ASSERT((__i_rename_at_127_53 == 4));
+    das_copy(__i_rename_at_127_53,0);
+    {
+        bool __need_loop_136 = true;
+        // l: int&
+        das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_125_51);
+        int32_t * __l_rename_at_136_60;
+        __need_loop_136 = __l_iterator.first(__context__,(__l_rename_at_136_60)) && __need_loop_136;
+        // r: int& -const
+        das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_126_52);
+        int32_t * __r_rename_at_136_61;
+        __need_loop_136 = __r_iterator.first(__context__,(__r_rename_at_136_61)) && __need_loop_136;
+        for ( ; __need_loop_136 ; __need_loop_136 = __l_iterator.next(__context__,(__l_rename_at_136_60)) && __r_iterator.next(__context__,(__r_rename_at_136_61)) )
+        {
+            DAS_ASSERT(((*__r_rename_at_136_61) == ((__i_rename_at_127_53 * 2) - 5)));
+            DAS_VERIFY(((*__l_rename_at_136_60) == __i_rename_at_127_53++));
+        }
+        __r_iterator.close(__context__,(__r_rename_at_136_61));
+        __l_iterator.close(__context__,(__l_rename_at_136_60));
+    };
+    DAS_ASSERT((__i_rename_at_127_53 == 4));
+    das_copy(__i_rename_at_127_53,0);
+    {
+        bool __need_loop_142 = true;
+        // l: int&
+        das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_125_51);
+        int32_t * __l_rename_at_142_64;
+        __need_loop_142 = __l_iterator.first(__context__,(__l_rename_at_142_64)) && __need_loop_142;
+        // r: int& -const
+        das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_126_52);
+        int32_t * __r_rename_at_142_65;
+        __need_loop_142 = __r_iterator.first(__context__,(__r_rename_at_142_65)) && __need_loop_142;
+        for ( ; __need_loop_142 ; __need_loop_142 = __l_iterator.next(__context__,(__l_rename_at_142_64)) && __r_iterator.next(__context__,(__r_rename_at_142_65)) )
+        {
+            if ( (*__l_rename_at_142_64) > (*__r_rename_at_142_65) )
+            {
+                DAS_ASSERT(((*__l_rename_at_142_64) > (*__r_rename_at_142_65)));
+                ++__i_rename_at_127_53;
+            };
+        }
+        __r_iterator.close(__context__,(__r_rename_at_142_65));
+        __l_iterator.close(__context__,(__l_rename_at_142_64));
+    };
+    DAS_ASSERT((__i_rename_at_127_53 == 4));
+    int32_t __i_rename_at_152_66 = 0;
+    {
+        bool __need_loop_153 = true;
+        // a: int const
+        das_iterator<range> __a_iterator(range(0,10));
+        int32_t __a_rename_at_153_67;
+        __need_loop_153 = __a_iterator.first(__context__,(__a_rename_at_153_67)) && __need_loop_153;
+        for ( ; __need_loop_153 ; __need_loop_153 = __a_iterator.next(__context__,(__a_rename_at_153_67)) )
+        {
+            DAS_VERIFY((__a_rename_at_153_67 == __i_rename_at_152_66++));
+        }
+        __a_iterator.close(__context__,(__a_rename_at_153_67));
+    };
+    DAS_ASSERT((__i_rename_at_152_66 == 10));
+    TDim<int32_t,10> __b_rename_at_160_68;das_zero(__b_rename_at_160_68);
+    int32_t __i_rename_at_161_69 = 0;
+    {
+        bool __need_loop_162 = true;
+        // l: int const
+        das_iterator<range> __l_iterator(range(0,10));
+        int32_t __l_rename_at_162_72;
+        __need_loop_162 = __l_iterator.first(__context__,(__l_rename_at_162_72)) && __need_loop_162;
+        // r: int& -const
+        das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_160_68);
+        int32_t * __r_rename_at_162_73;
+        __need_loop_162 = __r_iterator.first(__context__,(__r_rename_at_162_73)) && __need_loop_162;
+        for ( ; __need_loop_162 ; __need_loop_162 = __l_iterator.next(__context__,(__l_rename_at_162_72)) && __r_iterator.next(__context__,(__r_rename_at_162_73)) )
+        {
+            das_copy((*__r_rename_at_162_73),(__i_rename_at_161_69++ * 2) - 5);
+        }
+        __r_iterator.close(__context__,(__r_rename_at_162_73));
+        __l_iterator.close(__context__,(__l_rename_at_162_72));
+    };
+    DAS_ASSERT((__i_rename_at_161_69 == 10));
+    das_copy(__i_rename_at_161_69,0);
+    {
+        bool __need_loop_167 = true;
+        // l: int const
+        das_iterator<range> __l_iterator(range(0,10));
+        int32_t __l_rename_at_167_76;
+        __need_loop_167 = __l_iterator.first(__context__,(__l_rename_at_167_76)) && __need_loop_167;
+        // r: int& -const
+        das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_160_68);
+        int32_t * __r_rename_at_167_77;
+        __need_loop_167 = __r_iterator.first(__context__,(__r_rename_at_167_77)) && __need_loop_167;
+        for ( ; __need_loop_167 ; __need_loop_167 = __l_iterator.next(__context__,(__l_rename_at_167_76)) && __r_iterator.next(__context__,(__r_rename_at_167_77)) )
+        {
+            DAS_ASSERT(((*__r_rename_at_167_77) == ((__i_rename_at_161_69 * 2) - 5)));
+            DAS_VERIFY((__l_rename_at_167_76 == __i_rename_at_161_69++));
+        }
+        __r_iterator.close(__context__,(__r_rename_at_167_77));
+        __l_iterator.close(__context__,(__l_rename_at_167_76));
+    };
+    das_copy(__i_rename_at_161_69,0);
+    {
+        bool __need_loop_172 = true;
+        // l: int const
+        das_iterator<range> __l_iterator(range(0,10));
+        int32_t __l_rename_at_172_80;
+        __need_loop_172 = __l_iterator.first(__context__,(__l_rename_at_172_80)) && __need_loop_172;
+        // r: int& -const
+        das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_160_68);
+        int32_t * __r_rename_at_172_81;
+        __need_loop_172 = __r_iterator.first(__context__,(__r_rename_at_172_81)) && __need_loop_172;
+        for ( ; __need_loop_172 ; __need_loop_172 = __l_iterator.next(__context__,(__l_rename_at_172_80)) && __r_iterator.next(__context__,(__r_rename_at_172_81)) )
+        {
+            if ( __l_rename_at_172_80 > (*__r_rename_at_172_81) )
+            {
+                DAS_ASSERT((__l_rename_at_172_80 > (*__r_rename_at_172_81)));
+                ++__i_rename_at_161_69;
+            };
+        }
+        __r_iterator.close(__context__,(__r_rename_at_172_81));
+        __l_iterator.close(__context__,(__l_rename_at_172_80));
+    };
+    DAS_ASSERT((__i_rename_at_161_69 == 5));
+    uint32_t __u_rename_at_181_82 = 0x0u;
+    {
+        bool __need_loop_182 = true;
+        // t: uint const
+        das_iterator<urange> __t_iterator(urange(0,3));
+        uint32_t __t_rename_at_182_83;
+        __need_loop_182 = __t_iterator.first(__context__,(__t_rename_at_182_83)) && __need_loop_182;
+        for ( ; __need_loop_182 ; __need_loop_182 = __t_iterator.next(__context__,(__t_rename_at_182_83)) )
+        {
+            __u_rename_at_181_82 += __t_rename_at_182_83;
+        }
+        __t_iterator.close(__context__,(__t_rename_at_182_83));
+    };
+    DAS_ASSERT((__u_rename_at_181_82 == 0x3u));
+    test_from_gte_to_e504be6811dd58fc(__context__);
+    test_for64_5e0ed013f80f81bc(__context__);
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 ( Context * __context__ ) {
+    range arg_rng = cast_aot_arg<range>::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__, arg_rng);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap_test_from_gte_to_e504be6811dd58fc ( Context * __context__ ) {
+    test_from_gte_to_e504be6811dd58fc(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_for64_5e0ed013f80f81bc ( Context * __context__ ) {
+    test_for64_5e0ed013f80f81bc(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_d4424f18f0964f11 ( Context * __context__ ) {
+    return cast<bool>::from(test_d4424f18f0964f11(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xf426d9532c77b0a4, true, (void*)&_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015, &__wrap__FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 },
+    { 0xa51a880d594e91fd, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c },
+    { 0x2ea54379c89a9b6a, false, (void*)&test_from_gte_to_e504be6811dd58fc, &__wrap_test_from_gte_to_e504be6811dd58fc },
+    { 0xce8a9d6d0a287a21, false, (void*)&test_for64_5e0ed013f80f81bc, &__wrap_test_for64_5e0ed013f80f81bc },
+    { 0xbea641a086247f4c, false, (void*)&test_d4424f18f0964f11, &__wrap_test_d4424f18f0964f11 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_10734064037579541433
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
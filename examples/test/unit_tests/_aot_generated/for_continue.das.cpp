@@ -0,0 +1,207 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_10713619076170499514 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void test_while_continue_1b30c8b7d1f53ea8 ( Context * __context__ );
+inline void test_for_continue_167ad43f236ea563 ( Context * __context__ );
+inline void test_complex_for_continue_9a9ce4903c70a75a ( Context * __context__ );
+inline bool test_30c7d1143d13f49 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void test_while_continue_1b30c8b7d1f53ea8 ( Context * __context__ )
+{
+    int32_t __x_rename_at_4_0 = 0;
+    int32_t __y_rename_at_5_1 = 0;
+    while ( __x_rename_at_4_0 < 10 )
+    {
+        ++__x_rename_at_4_0;
+        if ( (__x_rename_at_4_0 & 1) == 0 )
+        {
+            continue;
+        } else {
+            __y_rename_at_5_1 += __x_rename_at_4_0;
+        };
+    };
+    DAS_ASSERT((__y_rename_at_5_1 == 25));
+}
+
+inline void test_for_continue_167ad43f236ea563 ( Context * __context__ )
+{
+    int32_t __y_rename_at_18_2 = 0;
+    {
+        bool __need_loop_19 = true;
+        // x: int const
+        das_iterator<range> __x_iterator(range(0,10));
+        int32_t __x_rename_at_19_3;
+        __need_loop_19 = __x_iterator.first(__context__,(__x_rename_at_19_3)) && __need_loop_19;
+        for ( ; __need_loop_19 ; __need_loop_19 = __x_iterator.next(__context__,(__x_rename_at_19_3)) )
+        {
+            if ( (__x_rename_at_19_3 & 1) == 0 )
+            {
+                continue;
+            } else {
+                __y_rename_at_18_2 += __x_rename_at_19_3;
+            };
+        }
+        __x_iterator.close(__context__,(__x_rename_at_19_3));
+    };
+    DAS_ASSERT((__y_rename_at_18_2 == 25));
+}
+
+inline void test_complex_for_continue_9a9ce4903c70a75a ( Context * __context__ )
+{
+    int32_t __y_rename_at_30_4 = 0;
+    TDim<int32_t,10> __arr_rename_at_31_5_ConstRef = ((TDim<int32_t,10>)(([&]() -> TDim<int32_t,10> {
+        TDim<int32_t,10> __mka_31;
+        __mka_31(0,__context__) = 0;
+        __mka_31(1,__context__) = 1;
+        __mka_31(2,__context__) = 2;
+        __mka_31(3,__context__) = 3;
+        __mka_31(4,__context__) = 4;
+        __mka_31(5,__context__) = 5;
+        __mka_31(6,__context__) = 6;
+        __mka_31(7,__context__) = 7;
+        __mka_31(8,__context__) = 8;
+        __mka_31(9,__context__) = 9;
+        return __mka_31;
+    })()));
+    TDim<int32_t,10> const  & __arr_rename_at_31_5 = __arr_rename_at_31_5_ConstRef;
+;
+    {
+        bool __need_loop_32 = true;
+        // x: int const
+        das_iterator<range> __x_iterator(range(0,10));
+        int32_t __x_rename_at_32_8;
+        __need_loop_32 = __x_iterator.first(__context__,(__x_rename_at_32_8)) && __need_loop_32;
+        // s: int const&
+        das_iterator<TDim<int32_t,10> const > __s_iterator(__arr_rename_at_31_5);
+        int32_t const  * __s_rename_at_32_9;
+        __need_loop_32 = __s_iterator.first(__context__,(__s_rename_at_32_9)) && __need_loop_32;
+        for ( ; __need_loop_32 ; __need_loop_32 = __x_iterator.next(__context__,(__x_rename_at_32_8)) && __s_iterator.next(__context__,(__s_rename_at_32_9)) )
+        {
+            DAS_ASSERT((__x_rename_at_32_8 == (*__s_rename_at_32_9)));
+            if ( (__x_rename_at_32_8 & 1) == 0 )
+            {
+                continue;
+            } else {
+                __y_rename_at_30_4 += __x_rename_at_32_8;
+            };
+        }
+        __s_iterator.close(__context__,(__s_rename_at_32_9));
+        __x_iterator.close(__context__,(__x_rename_at_32_8));
+    };
+    DAS_ASSERT((__y_rename_at_30_4 == 25));
+}
+
+inline bool test_30c7d1143d13f49 ( Context * __context__ )
+{
+    test_while_continue_1b30c8b7d1f53ea8(__context__);
+    test_for_continue_167ad43f236ea563(__context__);
+    test_complex_for_continue_9a9ce4903c70a75a(__context__);
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_test_while_continue_1b30c8b7d1f53ea8 ( Context * __context__ ) {
+    test_while_continue_1b30c8b7d1f53ea8(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_for_continue_167ad43f236ea563 ( Context * __context__ ) {
+    test_for_continue_167ad43f236ea563(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_complex_for_continue_9a9ce4903c70a75a ( Context * __context__ ) {
+    test_complex_for_continue_9a9ce4903c70a75a(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_30c7d1143d13f49 ( Context * __context__ ) {
+    return cast<bool>::from(test_30c7d1143d13f49(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x81232498c4496042, false, (void*)&test_while_continue_1b30c8b7d1f53ea8, &__wrap_test_while_continue_1b30c8b7d1f53ea8 },
+    { 0xce3265dabb169e87, false, (void*)&test_for_continue_167ad43f236ea563, &__wrap_test_for_continue_167ad43f236ea563 },
+    { 0xfdc6c8b35dfbbedb, false, (void*)&test_complex_for_continue_9a9ce4903c70a75a, &__wrap_test_complex_for_continue_9a9ce4903c70a75a },
+    { 0xf7fc1735bca21d6a, false, (void*)&test_30c7d1143d13f49, &__wrap_test_30c7d1143d13f49 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_10713619076170499514
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,139 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_8167156188217266485 {
+
+// unused enumeration GooEnum
+// unused enumeration OpCode
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline bool _FuncUnitTestTickstart_effectTick310392895329120375_760da6ce2e866199 ( Context * __context__, char * const  __name_rename_at_8_0, float3x4 const  & __tm_rename_at_8_1 );
+inline bool on_armor_hit_fx_effect_es_663dd1f82491dfc8 ( Context * __context__, char * const  __visual_armor_hit_dot_effectName_rename_at_5_2 );
+inline bool test_9dde7390496dad14 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool _FuncUnitTestTickstart_effectTick310392895329120375_760da6ce2e866199 ( Context * __context__, char * const  __name_rename_at_8_0, float3x4 const  &  __tm_rename_at_8_1 )
+{
+    return das_auto_cast<bool>::cast(start_effect(__name_rename_at_8_0,__tm_rename_at_8_1,1.000000e+00f));
+}
+
+inline bool on_armor_hit_fx_effect_es_663dd1f82491dfc8 ( Context * __context__, char * const  __visual_armor_hit_dot_effectName_rename_at_5_2 )
+{
+    float3x4 __tm_rename_at_6_3;das_zero(__tm_rename_at_6_3);
+    float3x4_identity(das_arg<float3x4>::pass(__tm_rename_at_6_3));
+    return das_auto_cast<bool>::cast(_FuncUnitTestTickstart_effectTick310392895329120375_760da6ce2e866199(__context__,__visual_armor_hit_dot_effectName_rename_at_5_2,das_arg<float3x4>::pass(__tm_rename_at_6_3)));
+}
+
+inline bool test_9dde7390496dad14 ( Context * __context__ )
+{
+    DAS_VERIFY((!on_armor_hit_fx_effect_es_663dd1f82491dfc8(__context__,((char *) "test"))));
+    float3x4 __tm_rename_at_14_4;das_zero(__tm_rename_at_14_4);
+    float3x4_identity(das_arg<float3x4>::pass(__tm_rename_at_14_4));
+    _FuncUnitTestTickstart_effectTick310392895329120375_760da6ce2e866199(__context__,((char *) "test-test"),das_arg<float3x4>::pass(__tm_rename_at_14_4));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncUnitTestTickstart_effectTick310392895329120375_760da6ce2e866199 ( Context * __context__ ) {
+    char * const  arg_name = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    float3x4 const  &  arg_tm = cast_aot_arg<float3x4 const  & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_FuncUnitTestTickstart_effectTick310392895329120375_760da6ce2e866199(__context__, arg_name, arg_tm));
+}
+static vec4f __wrap_on_armor_hit_fx_effect_es_663dd1f82491dfc8 ( Context * __context__ ) {
+    char * const  arg_visual_armor_hit_dot_effectName = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<bool>::from(on_armor_hit_fx_effect_es_663dd1f82491dfc8(__context__, arg_visual_armor_hit_dot_effectName));
+}
+static vec4f __wrap_test_9dde7390496dad14 ( Context * __context__ ) {
+    return cast<bool>::from(test_9dde7390496dad14(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xefb47378ccf6d646, false, (void*)&_FuncUnitTestTickstart_effectTick310392895329120375_760da6ce2e866199, &__wrap__FuncUnitTestTickstart_effectTick310392895329120375_760da6ce2e866199 },
+    { 0x3b3402a8cc5dbb4, false, (void*)&on_armor_hit_fx_effect_es_663dd1f82491dfc8, &__wrap_on_armor_hit_fx_effect_es_663dd1f82491dfc8 },
+    { 0x97d8d6881f8bab63, false, (void*)&test_9dde7390496dad14, &__wrap_test_9dde7390496dad14 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_8167156188217266485
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,5728 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require functional
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_7038883937045263231 {
+
+namespace  { struct _lambda_thismodule_109_1; };
+namespace  { struct _lambda_thismodule_163_2; };
+namespace  { struct _lambda_thismodule_265_3; };
+namespace  { struct _lambda_thismodule_74_4; };
+namespace  { struct _lambda_thismodule_130_5; };
+namespace  { struct _lambda_thismodule_251_6; };
+namespace  { struct _lambda_thismodule_256_7; };
+namespace  { struct _lambda_thismodule_259_8; };
+namespace  { struct _lambda_thismodule_271_9; };
+namespace  { struct _lambda_thismodule_80_10; };
+namespace  { struct _lambda_thismodule_114_11; };
+namespace  { struct _lambda_thismodule_264_12; };
+namespace  { struct _lambda_thismodule_267_13; };
+namespace  { struct _lambda_thismodule_95_14; };
+namespace  { struct _lambda_thismodule_139_15; };
+namespace  { struct _lambda_thismodule_187_16; };
+namespace  { struct _lambda_thismodule_196_17; };
+namespace  { struct _lambda_thismodule_204_18; };
+namespace  { struct _lambda_thismodule_230_19; };
+namespace  { struct _lambda_thismodule_197_20; };
+namespace  { struct _lambda_thismodule_12_21; };
+namespace  { struct _lambda_thismodule_12_22; };
+namespace  { struct _lambda_thismodule_115_23; };
+namespace  { struct _lambda_thismodule_211_24; };
+namespace  { struct _lambda_thismodule_211_25; };
+namespace  { struct _lambda_thismodule_46_26; };
+namespace  { struct _lambda_thismodule_46_27; };
+namespace  { struct _lambda_thismodule_46_28; };
+namespace  { struct _lambda_thismodule_46_29; };
+namespace  { struct _lambda_thismodule_21_30; };
+namespace  { struct _lambda_thismodule_239_31; };
+namespace  { struct _lambda_thismodule_116_32; };
+namespace  { struct _lambda_thismodule_239_33; };
+namespace  { struct _lambda_thismodule_57_34; };
+namespace  { struct _lambda_thismodule_117_35; };
+namespace  { struct _lambda_thismodule_46_36; };
+namespace  {
+
+struct _lambda_thismodule_109_1 {
+    Func DAS_COMMENT((int32_t,_lambda_thismodule_109_1,int32_t)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_109_1 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_109_1)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_109_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_109_1,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_163_2 {
+    Func DAS_COMMENT((TTuple<8,int32_t,float>,_lambda_thismodule_163_2,int32_t)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_163_2 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_163_2)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_2,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_265_3 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_265_3,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_265_3 *)) __finalize;
+    int32_t __yield;
+    int32_t count;
+    int32_t value;
+    bool _loop_at_271_8;
+    int32_t __x_rename_at_271_13;
+    void * _pvar_0_at_271_8;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_271_8;
+};
+static_assert(sizeof(_lambda_thismodule_265_3)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_265_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_265_3,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_265_3,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_265_3,count)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_265_3,value)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_265_3,_loop_at_271_8)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_265_3,__x_rename_at_271_13)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_265_3,_pvar_0_at_271_8)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_265_3,_source_0_at_271_8)==48,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_74_4 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_74_4,int32_t const  * &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_74_4 *)) __finalize;
+    int32_t __yield;
+    bool _loop_at_74_31;
+    int32_t __x_rename_at_74_35;
+    void * _pvar_0_at_74_31;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_74_31;
+};
+static_assert(sizeof(_lambda_thismodule_74_4)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_4,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_4,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_4,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_4,_loop_at_74_31)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_4,__x_rename_at_74_35)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_4,_pvar_0_at_74_31)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_4,_source_0_at_74_31)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_130_5 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_130_5,int32_t const  * &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_130_5 *)) __finalize;
+    int32_t __yield;
+    bool _loop_at_130_22;
+    int32_t __x_rename_at_130_26;
+    void * _pvar_0_at_130_22;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_130_22;
+};
+static_assert(sizeof(_lambda_thismodule_130_5)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_130_5,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_130_5,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_130_5,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_130_5,_loop_at_130_22)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_130_5,__x_rename_at_130_26)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_130_5,_pvar_0_at_130_22)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_130_5,_source_0_at_130_22)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_251_6 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_251_6,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_251_6 *)) __finalize;
+    int32_t __yield;
+    bool _loop_at_251_26;
+    int32_t __x_rename_at_251_30;
+    void * _pvar_0_at_251_26;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_251_26;
+};
+static_assert(sizeof(_lambda_thismodule_251_6)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_251_6,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_251_6,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_251_6,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_251_6,_loop_at_251_26)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_251_6,__x_rename_at_251_30)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_251_6,_pvar_0_at_251_26)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_251_6,_source_0_at_251_26)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_256_7 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_256_7,TTuple<8,int32_t,float>)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_256_7 *)) __finalize;
+    int32_t __yield;
+    bool _loop_at_256_18;
+    int32_t __x_rename_at_256_22;
+    void * _pvar_0_at_256_18;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_256_18;
+};
+static_assert(sizeof(_lambda_thismodule_256_7)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_256_7,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_256_7,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_256_7,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_256_7,_loop_at_256_18)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_256_7,__x_rename_at_256_22)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_256_7,_pvar_0_at_256_18)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_256_7,_source_0_at_256_18)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_259_8 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_259_8,TTuple<8,int32_t,float>)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_259_8 *)) __finalize;
+    int32_t __yield;
+    bool _loop_at_259_26;
+    int32_t __x_rename_at_259_30;
+    void * _pvar_0_at_259_26;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_259_26;
+};
+static_assert(sizeof(_lambda_thismodule_259_8)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_259_8,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_259_8,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_259_8,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_259_8,_loop_at_259_26)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_259_8,__x_rename_at_259_30)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_259_8,_pvar_0_at_259_26)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_259_8,_source_0_at_259_26)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_271_9 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_271_9,int32_t const  * &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_271_9 *)) __finalize;
+    int32_t __yield;
+    bool _loop_at_271_25;
+    int32_t __x_rename_at_271_29;
+    void * _pvar_0_at_271_25;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_271_25;
+};
+static_assert(sizeof(_lambda_thismodule_271_9)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_271_9,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_271_9,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_271_9,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_271_9,_loop_at_271_25)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_271_9,__x_rename_at_271_29)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_271_9,_pvar_0_at_271_25)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_271_9,_source_0_at_271_25)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_80_10 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_80_10,TArray<int32_t>)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_80_10 *)) __finalize;
+    int32_t __yield;
+    bool _loop_at_80_29;
+    int32_t __x_rename_at_80_33;
+    void * _pvar_0_at_80_29;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_80_29;
+};
+static_assert(sizeof(_lambda_thismodule_80_10)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_80_10,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_80_10,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_80_10,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_80_10,_loop_at_80_29)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_80_10,__x_rename_at_80_33)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_80_10,_pvar_0_at_80_29)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_80_10,_source_0_at_80_29)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_114_11 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_114_11,TArray<int32_t>)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_114_11 *)) __finalize;
+    int32_t __yield;
+    bool _loop_at_114_22;
+    int32_t __x_rename_at_114_26;
+    void * _pvar_0_at_114_22;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_114_22;
+};
+static_assert(sizeof(_lambda_thismodule_114_11)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_11,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_11,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_11,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_11,_loop_at_114_22)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_11,__x_rename_at_114_26)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_11,_pvar_0_at_114_22)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_11,_source_0_at_114_22)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_264_12 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_264_12,TArray<int32_t>)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_264_12 *)) __finalize;
+    int32_t __yield;
+    bool _loop_at_264_18;
+    int32_t __x_rename_at_264_22;
+    void * _pvar_0_at_264_18;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_264_18;
+};
+static_assert(sizeof(_lambda_thismodule_264_12)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_264_12,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_264_12,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_264_12,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_264_12,_loop_at_264_18)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_264_12,__x_rename_at_264_22)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_264_12,_pvar_0_at_264_18)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_264_12,_source_0_at_264_18)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_267_13 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_267_13,TArray<int32_t>)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_267_13 *)) __finalize;
+    int32_t __yield;
+    bool _loop_at_267_26;
+    int32_t __x_rename_at_267_30;
+    void * _pvar_0_at_267_26;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_267_26;
+};
+static_assert(sizeof(_lambda_thismodule_267_13)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_267_13,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_267_13,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_267_13,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_267_13,_loop_at_267_26)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_267_13,__x_rename_at_267_30)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_267_13,_pvar_0_at_267_26)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_267_13,_source_0_at_267_26)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_95_14 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_95_14,int32_t)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_95_14 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_95_14)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_95_14,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_95_14,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_139_15 {
+    Func DAS_COMMENT((int32_t,_lambda_thismodule_139_15,int32_t,int32_t)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_139_15 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_139_15)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_15,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_15,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_187_16 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_187_16,int32_t)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_187_16 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_187_16)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_187_16,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_187_16,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_196_17 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_196_17,int32_t)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_196_17 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_196_17)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_196_17,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_196_17,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_204_18 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_204_18,int32_t)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_204_18 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_204_18)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_204_18,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_204_18,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_230_19 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_230_19,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_230_19 *)) __finalize;
+    int32_t __yield;
+    Sequence DAS_COMMENT((int32_t)) src;
+    int32_t start;
+    int32_t stop;
+    bool _loop_at_231_12;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_231_12;
+    int32_t __x_rename_at_231_17;
+    void * _pvar_0_at_231_12;
+    int32_t __i_rename_at_231_20;
+    void * _pvar_1_at_231_12;
+    Sequence DAS_COMMENT((int32_t)) _source_1_at_231_12;
+};
+static_assert(sizeof(_lambda_thismodule_230_19)==96,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_230_19,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_230_19,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_230_19,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_230_19,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_230_19,start)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_230_19,stop)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_230_19,_loop_at_231_12)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_230_19,_source_0_at_231_12)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_230_19,__x_rename_at_231_17)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_230_19,_pvar_0_at_231_12)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_230_19,__i_rename_at_231_20)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_230_19,_pvar_1_at_231_12)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_230_19,_source_1_at_231_12)==88,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_197_20 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_197_20,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_197_20 *)) __finalize;
+    int32_t __yield;
+    Sequence DAS_COMMENT((int32_t)) src;
+    TArray<int32_t> arr;
+    bool ___loop_at_204_16_rename_at_204_16;
+    int32_t * __x_rename_at_204_21;
+    void * ___pvar_0_at_204_16_rename_at_204_16;
+    bool _loop_at_199_12;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_199_12;
+    int32_t __x_rename_at_199_17;
+    void * _pvar_0_at_199_12;
+    Sequence DAS_COMMENT((int32_t &)) ___source_0_at_204_16_rename_at_204_16;
+};
+static_assert(sizeof(_lambda_thismodule_197_20)==120,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_197_20,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_197_20,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_197_20,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_197_20,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_197_20,arr)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_197_20,___loop_at_204_16_rename_at_204_16)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_197_20,__x_rename_at_204_21)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_197_20,___pvar_0_at_204_16_rename_at_204_16)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_197_20,_loop_at_199_12)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_197_20,_source_0_at_199_12)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_197_20,__x_rename_at_199_17)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_197_20,_pvar_0_at_199_12)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_197_20,___source_0_at_204_16_rename_at_204_16)==112,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_12_21 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_12_21,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_12_21 *)) __finalize;
+    int32_t __yield;
+    Func DAS_COMMENT((bool,int32_t)) blk;
+    Sequence DAS_COMMENT((int32_t)) src;
+    bool _loop_at_13_12;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_13_12;
+    int32_t __w_rename_at_13_17;
+    void * _pvar_0_at_13_12;
+};
+static_assert(sizeof(_lambda_thismodule_12_21)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_21,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_21,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_21,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_21,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_21,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_21,_loop_at_13_12)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_21,_source_0_at_13_12)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_21,__w_rename_at_13_17)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_21,_pvar_0_at_13_12)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_12_22 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_12_22,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_12_22 *)) __finalize;
+    int32_t __yield;
+    Lambda DAS_COMMENT((bool,int32_t)) blk;
+    Sequence DAS_COMMENT((int32_t)) src;
+    bool _loop_at_13_12;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_13_12;
+    int32_t __w_rename_at_13_17;
+    void * _pvar_0_at_13_12;
+};
+static_assert(sizeof(_lambda_thismodule_12_22)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_22,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_22,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_22,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_22,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_22,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_22,_loop_at_13_12)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_22,_source_0_at_13_12)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_22,__w_rename_at_13_17)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_22,_pvar_0_at_13_12)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_115_23 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_115_23,TArray<int32_t> const )) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_115_23 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_115_23)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_115_23,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_115_23,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_211_24 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_211_24,TTuple<8,int32_t,float> * &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_211_24 *)) __finalize;
+    int32_t __yield;
+    Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) src;
+    TArray<TTuple<8,int32_t,float>> arr;
+    bool ___loop_at_218_16_rename_at_218_16;
+    TTuple<8,int32_t,float> * __x_rename_at_218_21;
+    void * ___pvar_0_at_218_16_rename_at_218_16;
+    bool _loop_at_213_12;
+    Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _source_0_at_213_12;
+    TTuple<8,int32_t,float> __x_rename_at_213_17;
+    void * _pvar_0_at_213_12;
+    Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) ___source_0_at_218_16_rename_at_218_16;
+};
+static_assert(sizeof(_lambda_thismodule_211_24)==120,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_211_24,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_211_24,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_211_24,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_211_24,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_211_24,arr)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_211_24,___loop_at_218_16_rename_at_218_16)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_211_24,__x_rename_at_218_21)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_211_24,___pvar_0_at_218_16_rename_at_218_16)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_211_24,_loop_at_213_12)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_211_24,_source_0_at_213_12)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_211_24,__x_rename_at_213_17)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_211_24,_pvar_0_at_213_12)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_211_24,___source_0_at_218_16_rename_at_218_16)==112,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_211_25 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_211_25,TArray<int32_t> * &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_211_25 *)) __finalize;
+    int32_t __yield;
+    Sequence DAS_COMMENT((TArray<int32_t>)) src;
+    TArray<TArray<int32_t>> arr;
+    bool ___loop_at_218_16_rename_at_218_16;
+    TArray<int32_t> * __x_rename_at_218_21;
+    void * ___pvar_0_at_218_16_rename_at_218_16;
+    bool _loop_at_213_12;
+    Sequence DAS_COMMENT((TArray<int32_t>)) _source_0_at_213_12;
+    TArray<int32_t> __x_rename_at_213_17;
+    void * _pvar_0_at_213_12;
+    Sequence DAS_COMMENT((TArray<int32_t> &)) ___source_0_at_218_16_rename_at_218_16;
+};
+static_assert(sizeof(_lambda_thismodule_211_25)==136,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_211_25,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_211_25,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_211_25,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_211_25,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_211_25,arr)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_211_25,___loop_at_218_16_rename_at_218_16)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_211_25,__x_rename_at_218_21)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_211_25,___pvar_0_at_218_16_rename_at_218_16)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_211_25,_loop_at_213_12)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_211_25,_source_0_at_213_12)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_211_25,__x_rename_at_213_17)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_211_25,_pvar_0_at_213_12)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_211_25,___source_0_at_218_16_rename_at_218_16)==128,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_46_26 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_46_26,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_46_26 *)) __finalize;
+    int32_t __yield;
+    Func DAS_COMMENT((int32_t,int32_t)) blk;
+    Sequence DAS_COMMENT((int32_t)) src;
+    bool _loop_at_47_12;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_47_12;
+    int32_t __w_rename_at_47_17;
+    void * _pvar_0_at_47_12;
+};
+static_assert(sizeof(_lambda_thismodule_46_26)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_26,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_26,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_26,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_26,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_26,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_26,_loop_at_47_12)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_26,_source_0_at_47_12)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_26,__w_rename_at_47_17)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_26,_pvar_0_at_47_12)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_46_27 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_46_27,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_46_27 *)) __finalize;
+    int32_t __yield;
+    Lambda DAS_COMMENT((int32_t,int32_t)) blk;
+    Sequence DAS_COMMENT((int32_t)) src;
+    bool _loop_at_47_12;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_47_12;
+    int32_t __w_rename_at_47_17;
+    void * _pvar_0_at_47_12;
+};
+static_assert(sizeof(_lambda_thismodule_46_27)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_27,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_27,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_27,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_27,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_27,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_27,_loop_at_47_12)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_27,_source_0_at_47_12)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_27,__w_rename_at_47_17)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_27,_pvar_0_at_47_12)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_46_28 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_46_28,TTuple<8,int32_t,float>)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_46_28 *)) __finalize;
+    int32_t __yield;
+    Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) blk;
+    Sequence DAS_COMMENT((int32_t)) src;
+    bool _loop_at_47_12;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_47_12;
+    int32_t __w_rename_at_47_17;
+    void * _pvar_0_at_47_12;
+};
+static_assert(sizeof(_lambda_thismodule_46_28)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_28,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_28,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_28,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_28,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_28,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_28,_loop_at_47_12)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_28,_source_0_at_47_12)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_28,__w_rename_at_47_17)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_28,_pvar_0_at_47_12)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_46_29 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_46_29,bool &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_46_29 *)) __finalize;
+    int32_t __yield;
+    Lambda DAS_COMMENT((bool,int32_t)) blk;
+    Sequence DAS_COMMENT((int32_t)) src;
+    bool _loop_at_47_12;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_47_12;
+    int32_t __w_rename_at_47_17;
+    void * _pvar_0_at_47_12;
+};
+static_assert(sizeof(_lambda_thismodule_46_29)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_29,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_29,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_29,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_29,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_29,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_29,_loop_at_47_12)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_29,_source_0_at_47_12)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_29,__w_rename_at_47_17)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_29,_pvar_0_at_47_12)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_21_30 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_21_30,TArray<int32_t> * &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_21_30 *)) __finalize;
+    int32_t __yield;
+    Lambda DAS_COMMENT((bool,TArray<int32_t> const )) blk;
+    Sequence DAS_COMMENT((TArray<int32_t>)) src;
+    bool _loop_at_22_12;
+    Sequence DAS_COMMENT((TArray<int32_t>)) _source_0_at_22_12;
+    TArray<int32_t> __w_rename_at_22_17;
+    void * _pvar_0_at_22_12;
+};
+static_assert(sizeof(_lambda_thismodule_21_30)==88,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_21_30,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_21_30,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_21_30,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_21_30,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_21_30,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_21_30,_loop_at_22_12)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_21_30,_source_0_at_22_12)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_21_30,__w_rename_at_22_17)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_21_30,_pvar_0_at_22_12)==80,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_239_31 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_239_31,TTuple<8,int32_t,float> * &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_239_31 *)) __finalize;
+    int32_t __yield;
+    Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) src;
+    int32_t start;
+    int32_t stop;
+    bool _loop_at_240_12;
+    Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _source_0_at_240_12;
+    TTuple<8,int32_t,float> * __x_rename_at_240_17;
+    void * _pvar_0_at_240_12;
+    int32_t __i_rename_at_240_20;
+    void * _pvar_1_at_240_12;
+    Sequence DAS_COMMENT((int32_t)) _source_1_at_240_12;
+};
+static_assert(sizeof(_lambda_thismodule_239_31)==96,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_239_31,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_239_31,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_239_31,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_239_31,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_239_31,start)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_239_31,stop)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_239_31,_loop_at_240_12)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_239_31,_source_0_at_240_12)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_239_31,__x_rename_at_240_17)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_239_31,_pvar_0_at_240_12)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_239_31,__i_rename_at_240_20)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_239_31,_pvar_1_at_240_12)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_239_31,_source_1_at_240_12)==88,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_116_32 {
+    Func DAS_COMMENT((TArray<int32_t>,_lambda_thismodule_116_32,TArray<int32_t> const )) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_116_32 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_116_32)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_116_32,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_116_32,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_239_33 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_239_33,TArray<int32_t> * &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_239_33 *)) __finalize;
+    int32_t __yield;
+    Sequence DAS_COMMENT((TArray<int32_t> &)) src;
+    int32_t start;
+    int32_t stop;
+    bool _loop_at_240_12;
+    Sequence DAS_COMMENT((TArray<int32_t> &)) _source_0_at_240_12;
+    TArray<int32_t> * __x_rename_at_240_17;
+    void * _pvar_0_at_240_12;
+    int32_t __i_rename_at_240_20;
+    void * _pvar_1_at_240_12;
+    Sequence DAS_COMMENT((int32_t)) _source_1_at_240_12;
+};
+static_assert(sizeof(_lambda_thismodule_239_33)==96,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_239_33,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_239_33,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_239_33,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_239_33,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_239_33,start)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_239_33,stop)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_239_33,_loop_at_240_12)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_239_33,_source_0_at_240_12)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_239_33,__x_rename_at_240_17)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_239_33,_pvar_0_at_240_12)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_239_33,__i_rename_at_240_20)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_239_33,_pvar_1_at_240_12)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_239_33,_source_1_at_240_12)==88,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_57_34 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_57_34,TArray<int32_t>)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_57_34 *)) __finalize;
+    int32_t __yield;
+    Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) blk;
+    Sequence DAS_COMMENT((TArray<int32_t> &)) src;
+    bool _loop_at_58_12;
+    Sequence DAS_COMMENT((TArray<int32_t> &)) _source_0_at_58_12;
+    TArray<int32_t> * __w_rename_at_58_17;
+    void * _pvar_0_at_58_12;
+};
+static_assert(sizeof(_lambda_thismodule_57_34)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_57_34,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_57_34,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_57_34,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_57_34,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_57_34,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_57_34,_loop_at_58_12)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_57_34,_source_0_at_58_12)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_57_34,__w_rename_at_58_17)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_57_34,_pvar_0_at_58_12)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_117_35 {
+    Func DAS_COMMENT((int32_t,_lambda_thismodule_117_35,TArray<int32_t> const )) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_117_35 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_117_35)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_117_35,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_117_35,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_46_36 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_46_36,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_46_36 *)) __finalize;
+    int32_t __yield;
+    Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) blk;
+    Sequence DAS_COMMENT((TArray<int32_t>)) src;
+    bool _loop_at_47_12;
+    Sequence DAS_COMMENT((TArray<int32_t>)) _source_0_at_47_12;
+    TArray<int32_t> __w_rename_at_47_17;
+    void * _pvar_0_at_47_12;
+};
+static_assert(sizeof(_lambda_thismodule_46_36)==88,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_36,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_36,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_36,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_36,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_36,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_36,_loop_at_47_12)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_36,_source_0_at_47_12)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_36,__w_rename_at_47_17)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_36,_pvar_0_at_47_12)==80,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__8c9e1aa528b3a46e;
+extern StructInfo __struct_info__e313ecb3f58d8e12;
+extern StructInfo __struct_info__8ff4eab8e06f5eac;
+extern StructInfo __struct_info__f695ebbcb621d45f;
+extern StructInfo __struct_info__f86ce8c1e932a446;
+extern StructInfo __struct_info__cc2d07a638503977;
+extern StructInfo __struct_info__cc2a07a6384b2077;
+extern StructInfo __struct_info__a4995aa53d461ca9;
+extern StructInfo __struct_info__8f38a2a41eb4a614;
+extern StructInfo __struct_info__aea41aa545b58f64;
+extern StructInfo __struct_info__e1d656c1bfeda130;
+extern StructInfo __struct_info__7b8c3ebdecf93828;
+extern StructInfo __struct_info__e22d45c1c2abb80d;
+extern StructInfo __struct_info__9c0893e7a469e622;
+extern StructInfo __struct_info__3e86e0cf12e8fdf9;
+extern StructInfo __struct_info__3e86dfcf12e8fc46;
+extern StructInfo __struct_info__17786e9f93e27653;
+extern StructInfo __struct_info__4dc98dd45648adb0;
+extern StructInfo __struct_info__4ade95a822c81448;
+extern StructInfo __struct_info__4ade97a822c817ae;
+extern StructInfo __struct_info__8afd1a9ff60d013b;
+extern StructInfo __struct_info__a27e1aa009c7153b;
+extern StructInfo __struct_info__6fef1a9fdf2d7f3b;
+extern StructInfo __struct_info__65fd93e785379222;
+extern StructInfo __struct_info__986a1aa001537764;
+extern StructInfo __struct_info__830494eccf61b0d5;
+extern StructInfo __struct_info__8af95a9ff60c684d;
+extern StructInfo __struct_info__a01b6f9757de20d3;
+extern StructInfo __struct_info__a01c6f9757dfd3d3;
+extern StructInfo __struct_info__a0216f9757e852d3;
+extern StructInfo __struct_info__a0226f9757ea05d3;
+extern StructInfo __struct_info__a01b6e9757de1f20;
+extern StructInfo __struct_info__c502ee916c7020c9;
+extern StructInfo __struct_info__c12b018705fe8f97;
+extern StructInfo __struct_info__98f1f4828bdf51dc;
+extern StructInfo __struct_info__49cdf87ec9ee9c75;
+extern TypeInfo __type_info__46c0bf42cd8a4056;
+extern TypeInfo __type_info__8ec3236fc6ca9dc2;
+extern TypeInfo __type_info__14d70770224fa1;
+extern TypeInfo __type_info__dc0fb9d6ab9c1b67;
+extern TypeInfo __type_info__993385c558408d53;
+extern TypeInfo __type_info__9a819d9c36b75a57;
+extern TypeInfo __type_info__b4fe6a6a4374785e;
+extern TypeInfo __type_info__af819b4c86347819;
+extern TypeInfo __type_info__af8a9b4c8643c319;
+extern TypeInfo __type_info__1f1db26455da92b;
+extern TypeInfo __type_info__d34517d485f8c8d;
+extern TypeInfo __type_info__fa69b6a0fca20cd4;
+extern TypeInfo __type_info__5c9badb1bcef5a26;
+extern TypeInfo __type_info__130248089a6af2e3;
+extern TypeInfo __type_info__293a3d0b3874fff8;
+extern TypeInfo __type_info__b9255614114c162c;
+extern TypeInfo __type_info__127656223eb0672c;
+extern TypeInfo __type_info__12b8585db2de972e;
+extern TypeInfo __type_info__104a9062238b16ae;
+extern TypeInfo __type_info__4a4c5f3fe0242733;
+extern TypeInfo __type_info__7a353f43ac58845a;
+extern TypeInfo __type_info__e73645adebba38b2;
+extern TypeInfo __type_info__abb413d11a395f9;
+extern TypeInfo __type_info__3c336a173bb4e2e4;
+extern TypeInfo __type_info__b3df55b8150004b5;
+extern TypeInfo __type_info__b3ddd3b8150057f8;
+extern TypeInfo __type_info__8c0e33c24426da68;
+extern TypeInfo __type_info__e7924b558e7fd51a;
+extern TypeInfo __type_info__927912335dbbe5d2;
+extern TypeInfo __type_info__927792335db39300;
+extern TypeInfo __type_info__48569549463a1610;
+extern TypeInfo __type_info__87b559918d89fa10;
+extern TypeInfo __type_info__57405351ce63bc10;
+extern TypeInfo __type_info__f1932a8b29adc7a4;
+extern TypeInfo __type_info__e54db47e311a4133;
+extern TypeInfo __type_info__7caa38dc7ab7561;
+extern TypeInfo __type_info__6ced550ca0c56572;
+extern TypeInfo __type_info__15378a5b2cc470e8;
+extern TypeInfo __type_info__1a2c8a55ff79ede8;
+extern TypeInfo __type_info__c19d8a8c4843c2e8;
+extern TypeInfo __type_info__c6928a871af93fe8;
+extern TypeInfo __type_info__19c6e15b3318338f;
+extern TypeInfo __type_info__6e9ab4292470434e;
+extern TypeInfo __type_info__32f09144a68a3a3b;
+extern TypeInfo __type_info__fec24b39a85c482b;
+extern TypeInfo __type_info__7d64159ecef14dda;
+extern TypeInfo __type_info__5673b06bfec20c2c;
+extern TypeInfo __type_info__124e1c04d9af11ea;
+extern TypeInfo __type_info__3ffb158eb0ff8a47;
+extern TypeInfo __type_info__76d45ec5fb9da33c;
+extern TypeInfo __type_info__9dd4995d0e385a78;
+extern TypeInfo __type_info__1729724f5b0b8b6b;
+extern TypeInfo __type_info__faddbd75a1c6e729;
+extern TypeInfo __type_info__af81fe4c86352052;
+extern TypeInfo __type_info__af8afe4c86446b52;
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__6e375377a4ff6e65;
+extern TypeInfo __type_info__31756dae030a5593;
+extern TypeInfo __type_info__981e6fb1d8ca64f9;
+extern TypeInfo __type_info__ba36ea37fc51b46;
+extern TypeInfo __type_info__d4e71a8b28b315f;
+extern TypeInfo __type_info__f31ea558214348ca;
+extern TypeInfo __type_info__fd50a55829ecc3ca;
+extern TypeInfo __type_info__a3654c9a72569ec0;
+extern TypeInfo __type_info__8d7a5777b8312c71;
+extern TypeInfo __type_info__bd968195635b17cf;
+extern TypeInfo __type_info__e40293a87e6b0765;
+extern TypeInfo __type_info__df3ccba3465e748d;
+extern TypeInfo __type_info__f8e5c4a88db2f4a8;
+extern TypeInfo __type_info__d3d64492cafa2233;
+extern TypeInfo __type_info__adb467a23ca603ac;
+extern TypeInfo __type_info__adb468a23ca6055f;
+extern TypeInfo __type_info__d8adf10f1316c01e;
+extern TypeInfo __type_info__2c234aa62187a9a5;
+extern TypeInfo __type_info__a84052c932b5643d;
+extern TypeInfo __type_info__a84050c932b560d7;
+extern TypeInfo __type_info__546ccda1211d29fe;
+extern TypeInfo __type_info__fad3cd88907a57fe;
+extern TypeInfo __type_info__8e28cdc92b2fb7fe;
+extern TypeInfo __type_info__c78d7c92c5430d9b;
+extern TypeInfo __type_info__b190788d814895cf;
+extern TypeInfo __type_info__9e147b84c0be84e8;
+extern TypeInfo __type_info__40351fa10b07fb94;
+extern TypeInfo __type_info__df51ab11a09302d6;
+extern TypeInfo __type_info__dbebab119dafd9d6;
+extern TypeInfo __type_info__caedab118f400cd6;
+extern TypeInfo __type_info__c787ab118c5ce3d6;
+extern TypeInfo __type_info__df552d11a0961593;
+extern TypeInfo __type_info__c7ec48c6dd149d10;
+extern TypeInfo __type_info__78bc10cdda8c1b0c;
+extern TypeInfo __type_info__66c99d800e6bf82b;
+extern TypeInfo __type_info__f52118e4a20d2ff8;
+extern TypeInfo __type_info__9c5a3d06af66f104;
+extern TypeInfo __type_info__22c94753154cc4b9;
+extern TypeInfo __type_info__127867058dcc8f13;
+extern TypeInfo __type_info__127167058dc0aa13;
+extern TypeInfo __type_info__c32d69975ef39d8f;
+extern TypeInfo __type_info__2767db6168f4baa4;
+extern TypeInfo __type_info__86e65058575787a;
+extern TypeInfo __type_info__dbbca5962c1c455f;
+extern TypeInfo __type_info__bcb97beea857e3e;
+extern TypeInfo __type_info__c4e7914a3746eb3e;
+extern TypeInfo __type_info__a3f0477a4765213e;
+extern TypeInfo __type_info__af63df4c8601f1a5;
+extern TypeInfo __type_info__af63db4c8601ead9;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+TypeInfo * __type_info__224d825820d515ec_arg_types_var_10132565508284982382[2] = { &__type_info__6e375377a4ff6e65, &__type_info__af8afe4c86446b52 };
+const char * __type_info__224d825820d515ec_arg_names_var_10132565508284982382[2] = { "__this", "x" };
+VarInfo __struct_info__8c9e1aa528b3a46e_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af8afe4c86446b52, nullptr, (TypeInfo **)__type_info__224d825820d515ec_arg_types_var_10132565508284982382, __type_info__224d825820d515ec_arg_names_var_10132565508284982382, 2, 0, nullptr, 12, 8, UINT64_C(0x224d825820d515ec), "__lambda", 0, 0 };
+TypeInfo * __type_info__e4b47a7a7a09db86_arg_types_var_10132565508284982382[1] = { &__type_info__d34517d485f8c8d };
+const char * __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382[1] = { "__this" };
+VarInfo __struct_info__8c9e1aa528b3a46e_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__e4b47a7a7a09db86_arg_types_var_10132565508284982382, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0xe4b47a7a7a09db86), "__finalize", 8, 0 };
+VarInfo * __struct_info__8c9e1aa528b3a46e_fields[2] =  { &__struct_info__8c9e1aa528b3a46e_field_0, &__struct_info__8c9e1aa528b3a46e_field_1 };
+StructInfo __struct_info__8c9e1aa528b3a46e = {"_lambda_thismodule_109_1", "", 14, __struct_info__8c9e1aa528b3a46e_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0x8c9e1aa528b3a46e), 2 };
+TypeInfo * __type_info__88312e75846f03c7_arg_types_var_16362682128830139922[2] = { &__type_info__31756dae030a5593, &__type_info__124e1c04d9af11ea };
+const char * __type_info__88312e75846f03c7_arg_names_var_16362682128830139922[2] = { "__this", "_yield_114" };
+VarInfo __struct_info__e313ecb3f58d8e12_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__88312e75846f03c7_arg_types_var_16362682128830139922, __type_info__88312e75846f03c7_arg_names_var_16362682128830139922, 2, 0, nullptr, 12, 8, UINT64_C(0x88312e75846f03c7), "__lambda", 0, 0 };
+TypeInfo * __type_info__b728c00bd9e5228_arg_types_var_16362682128830139922[1] = { &__type_info__fa69b6a0fca20cd4 };
+VarInfo __struct_info__e313ecb3f58d8e12_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__b728c00bd9e5228_arg_types_var_16362682128830139922, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0xb728c00bd9e5228), "__finalize", 8, 0 };
+VarInfo __struct_info__e313ecb3f58d8e12_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x4713499c67b7c0e4), "__yield", 16, 0 };
+VarInfo __struct_info__e313ecb3f58d8e12_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xa7ace385cd2af369), "_loop_at_114_22", 20, 0 };
+VarInfo __struct_info__e313ecb3f58d8e12_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x154c19c2c8a86f3), "__x_rename_at_114_26", 24, 0 };
+VarInfo __struct_info__e313ecb3f58d8e12_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x691be49cb9fec910), "_pvar_0_at_114_22", 32, 6 };
+VarInfo __struct_info__e313ecb3f58d8e12_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x362813b811f99024), "_source_0_at_114_22", 40, 7 };
+VarInfo * __struct_info__e313ecb3f58d8e12_fields[7] =  { &__struct_info__e313ecb3f58d8e12_field_0, &__struct_info__e313ecb3f58d8e12_field_1, &__struct_info__e313ecb3f58d8e12_field_2, &__struct_info__e313ecb3f58d8e12_field_3, &__struct_info__e313ecb3f58d8e12_field_4, &__struct_info__e313ecb3f58d8e12_field_5, &__struct_info__e313ecb3f58d8e12_field_6 };
+StructInfo __struct_info__e313ecb3f58d8e12 = {"_lambda_thismodule_114_11", "", 14, __struct_info__e313ecb3f58d8e12_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0xe313ecb3f58d8e12), 5 };
+TypeInfo * __type_info__f525c4dff717661d_arg_types_var_10373173921501372076[2] = { &__type_info__981e6fb1d8ca64f9, &__type_info__76d45ec5fb9da33c };
+VarInfo __struct_info__8ff4eab8e06f5eac_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__f525c4dff717661d_arg_types_var_10373173921501372076, __type_info__224d825820d515ec_arg_names_var_10132565508284982382, 2, 0, nullptr, 12, 8, UINT64_C(0xf525c4dff717661d), "__lambda", 0, 0 };
+TypeInfo * __type_info__1c176fe2d129db96_arg_types_var_10373173921501372076[1] = { &__type_info__5c9badb1bcef5a26 };
+VarInfo __struct_info__8ff4eab8e06f5eac_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__1c176fe2d129db96_arg_types_var_10373173921501372076, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0x1c176fe2d129db96), "__finalize", 8, 0 };
+VarInfo * __struct_info__8ff4eab8e06f5eac_fields[2] =  { &__struct_info__8ff4eab8e06f5eac_field_0, &__struct_info__8ff4eab8e06f5eac_field_1 };
+StructInfo __struct_info__8ff4eab8e06f5eac = {"_lambda_thismodule_115_23", "", 14, __struct_info__8ff4eab8e06f5eac_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0x8ff4eab8e06f5eac), 2 };
+TypeInfo * __type_info__c33c1c8bab2f09d8_arg_types_var_17768367100602209375[2] = { &__type_info__ba36ea37fc51b46, &__type_info__76d45ec5fb9da33c };
+VarInfo __struct_info__f695ebbcb621d45f_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__124e1c04d9af11ea, nullptr, (TypeInfo **)__type_info__c33c1c8bab2f09d8_arg_types_var_17768367100602209375, __type_info__224d825820d515ec_arg_names_var_10132565508284982382, 2, 0, nullptr, 12, 8, UINT64_C(0xc33c1c8bab2f09d8), "__lambda", 0, 0 };
+TypeInfo * __type_info__6fec7efce64ebef9_arg_types_var_17768367100602209375[1] = { &__type_info__130248089a6af2e3 };
+VarInfo __struct_info__f695ebbcb621d45f_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__6fec7efce64ebef9_arg_types_var_17768367100602209375, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0x6fec7efce64ebef9), "__finalize", 8, 0 };
+VarInfo * __struct_info__f695ebbcb621d45f_fields[2] =  { &__struct_info__f695ebbcb621d45f_field_0, &__struct_info__f695ebbcb621d45f_field_1 };
+StructInfo __struct_info__f695ebbcb621d45f = {"_lambda_thismodule_116_32", "", 14, __struct_info__f695ebbcb621d45f_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0xf695ebbcb621d45f), 2 };
+TypeInfo * __type_info__5c448183653ce55b_arg_types_var_17900938538429621318[2] = { &__type_info__d4e71a8b28b315f, &__type_info__76d45ec5fb9da33c };
+VarInfo __struct_info__f86ce8c1e932a446_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, (TypeInfo **)__type_info__5c448183653ce55b_arg_types_var_17900938538429621318, __type_info__224d825820d515ec_arg_names_var_10132565508284982382, 2, 0, nullptr, 12, 8, UINT64_C(0x5c448183653ce55b), "__lambda", 0, 0 };
+TypeInfo * __type_info__a6ed1fe02e541854_arg_types_var_17900938538429621318[1] = { &__type_info__293a3d0b3874fff8 };
+VarInfo __struct_info__f86ce8c1e932a446_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__a6ed1fe02e541854_arg_types_var_17900938538429621318, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0xa6ed1fe02e541854), "__finalize", 8, 0 };
+VarInfo * __struct_info__f86ce8c1e932a446_fields[2] =  { &__struct_info__f86ce8c1e932a446_field_0, &__struct_info__f86ce8c1e932a446_field_1 };
+StructInfo __struct_info__f86ce8c1e932a446 = {"_lambda_thismodule_117_35", "", 14, __struct_info__f86ce8c1e932a446_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0xf86ce8c1e932a446), 2 };
+TypeInfo * __type_info__386495eba90a0611_arg_types_var_14712423968180025719[2] = { &__type_info__f31ea558214348ca, &__type_info__af8a9b4c8643c319 };
+const char * __type_info__386495eba90a0611_arg_names_var_14712423968180025719[2] = { "__this", "_yield_12" };
+VarInfo __struct_info__cc2d07a638503977_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__386495eba90a0611_arg_types_var_14712423968180025719, __type_info__386495eba90a0611_arg_names_var_14712423968180025719, 2, 0, nullptr, 12, 8, UINT64_C(0x386495eba90a0611), "__lambda", 0, 0 };
+TypeInfo * __type_info__1c7b3f75a4b5be85_arg_types_var_14712423968180025719[1] = { &__type_info__b9255614114c162c };
+VarInfo __struct_info__cc2d07a638503977_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__1c7b3f75a4b5be85_arg_types_var_14712423968180025719, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0x1c7b3f75a4b5be85), "__finalize", 8, 0 };
+VarInfo __struct_info__cc2d07a638503977_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xefe4ccec83701138), "__yield", 16, 0 };
+TypeInfo * __type_info__3db355bab12f05bc_arg_types_var_14712423968180025719[1] = { &__type_info__faddbd75a1c6e729 };
+const char * __type_info__3db355bab12f05bc_arg_names_var_14712423968180025719[1] = { "what" };
+VarInfo __struct_info__cc2d07a638503977_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__3db355bab12f05bc_arg_types_var_14712423968180025719, __type_info__3db355bab12f05bc_arg_names_var_14712423968180025719, 1, 0, nullptr, 12, 8, UINT64_C(0x3db355bab12f05bc), "blk", 24, 0 };
+VarInfo __struct_info__cc2d07a638503977_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__86e65058575787a, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xab34bba85d55bbe), "src", 32, 6 };
+VarInfo __struct_info__cc2d07a638503977_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xb453aefdbbf01270), "_loop_at_13_12", 40, 0 };
+VarInfo __struct_info__cc2d07a638503977_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__86e65058575787a, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xba2dbb90d4a21049), "_source_0_at_13_12", 48, 8 };
+VarInfo __struct_info__cc2d07a638503977_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x89b8207b90586f1f), "__w_rename_at_13_17", 56, 0 };
+VarInfo __struct_info__cc2d07a638503977_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x77949b98b2050af), "_pvar_0_at_13_12", 64, 9 };
+VarInfo * __struct_info__cc2d07a638503977_fields[9] =  { &__struct_info__cc2d07a638503977_field_0, &__struct_info__cc2d07a638503977_field_1, &__struct_info__cc2d07a638503977_field_2, &__struct_info__cc2d07a638503977_field_3, &__struct_info__cc2d07a638503977_field_4, &__struct_info__cc2d07a638503977_field_5, &__struct_info__cc2d07a638503977_field_6, &__struct_info__cc2d07a638503977_field_7, &__struct_info__cc2d07a638503977_field_8 };
+StructInfo __struct_info__cc2d07a638503977 = {"_lambda_thismodule_12_21", "", 14, __struct_info__cc2d07a638503977_fields, 9, 72, UINT64_C(0x0), nullptr, UINT64_C(0xcc2d07a638503977), 4 };
+TypeInfo * __type_info__abc1b941a9654f11_arg_types_var_14711579543249559671[2] = { &__type_info__fd50a55829ecc3ca, &__type_info__af8a9b4c8643c319 };
+VarInfo __struct_info__cc2a07a6384b2077_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__abc1b941a9654f11_arg_types_var_14711579543249559671, __type_info__386495eba90a0611_arg_names_var_14712423968180025719, 2, 0, nullptr, 12, 8, UINT64_C(0xabc1b941a9654f11), "__lambda", 0, 0 };
+TypeInfo * __type_info__51e6299c44dc3b85_arg_types_var_14711579543249559671[1] = { &__type_info__127656223eb0672c };
+VarInfo __struct_info__cc2a07a6384b2077_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__51e6299c44dc3b85_arg_types_var_14711579543249559671, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0x51e6299c44dc3b85), "__finalize", 8, 0 };
+VarInfo __struct_info__cc2a07a6384b2077_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x9a5c63b85fba7e38), "__yield", 16, 0 };
+VarInfo __struct_info__cc2a07a6384b2077_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__3db355bab12f05bc_arg_types_var_14712423968180025719, __type_info__3db355bab12f05bc_arg_names_var_14712423968180025719, 1, 0, nullptr, 24576, 8, UINT64_C(0xa9469915cc4febc), "blk", 24, 4 };
+VarInfo __struct_info__cc2a07a6384b2077_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__86e65058575787a, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x3d9c5f91882c1ebe), "src", 32, 6 };
+VarInfo __struct_info__cc2a07a6384b2077_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x6050a0aafe7bd70), "_loop_at_13_12", 40, 0 };
+VarInfo __struct_info__cc2a07a6384b2077_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__86e65058575787a, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x8290a09bb0e07549), "_source_0_at_13_12", 48, 8 };
+VarInfo __struct_info__cc2a07a6384b2077_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xf8af6d116d8bc41f), "__w_rename_at_13_17", 56, 0 };
+VarInfo __struct_info__cc2a07a6384b2077_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xddcb7f448c4de3af), "_pvar_0_at_13_12", 64, 9 };
+VarInfo * __struct_info__cc2a07a6384b2077_fields[9] =  { &__struct_info__cc2a07a6384b2077_field_0, &__struct_info__cc2a07a6384b2077_field_1, &__struct_info__cc2a07a6384b2077_field_2, &__struct_info__cc2a07a6384b2077_field_3, &__struct_info__cc2a07a6384b2077_field_4, &__struct_info__cc2a07a6384b2077_field_5, &__struct_info__cc2a07a6384b2077_field_6, &__struct_info__cc2a07a6384b2077_field_7, &__struct_info__cc2a07a6384b2077_field_8 };
+StructInfo __struct_info__cc2a07a6384b2077 = {"_lambda_thismodule_12_22", "", 14, __struct_info__cc2a07a6384b2077_fields, 9, 72, UINT64_C(0x0), nullptr, UINT64_C(0xcc2a07a6384b2077), 3 };
+TypeInfo * __type_info__34c1ebf2e302146b_arg_types_var_11860610759401020585[2] = { &__type_info__a3654c9a72569ec0, &__type_info__dc0fb9d6ab9c1b67 };
+const char * __type_info__34c1ebf2e302146b_arg_names_var_11860610759401020585[2] = { "__this", "_ryield130" };
+VarInfo __struct_info__a4995aa53d461ca9_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__34c1ebf2e302146b_arg_types_var_11860610759401020585, __type_info__34c1ebf2e302146b_arg_names_var_11860610759401020585, 2, 0, nullptr, 12, 8, UINT64_C(0x34c1ebf2e302146b), "__lambda", 0, 0 };
+TypeInfo * __type_info__eb2b014189571bcf_arg_types_var_11860610759401020585[1] = { &__type_info__12b8585db2de972e };
+VarInfo __struct_info__a4995aa53d461ca9_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__eb2b014189571bcf_arg_types_var_11860610759401020585, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0xeb2b014189571bcf), "__finalize", 8, 0 };
+VarInfo __struct_info__a4995aa53d461ca9_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xf82d8a8a901f4d8a), "__yield", 16, 0 };
+VarInfo __struct_info__a4995aa53d461ca9_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x1c5816e2c431d9ad), "_loop_at_130_22", 20, 0 };
+VarInfo __struct_info__a4995aa53d461ca9_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xfbb152ca1f6d2207), "__x_rename_at_130_26", 24, 0 };
+VarInfo __struct_info__a4995aa53d461ca9_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xe2f08da8ea1b879a), "_pvar_0_at_130_22", 32, 6 };
+VarInfo __struct_info__a4995aa53d461ca9_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x6d4754d5aaebb00c), "_source_0_at_130_22", 40, 7 };
+VarInfo * __struct_info__a4995aa53d461ca9_fields[7] =  { &__struct_info__a4995aa53d461ca9_field_0, &__struct_info__a4995aa53d461ca9_field_1, &__struct_info__a4995aa53d461ca9_field_2, &__struct_info__a4995aa53d461ca9_field_3, &__struct_info__a4995aa53d461ca9_field_4, &__struct_info__a4995aa53d461ca9_field_5, &__struct_info__a4995aa53d461ca9_field_6 };
+StructInfo __struct_info__a4995aa53d461ca9 = {"_lambda_thismodule_130_5", "", 14, __struct_info__a4995aa53d461ca9_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0xa4995aa53d461ca9), 5 };
+TypeInfo * __type_info__22a8dee7d3c2f6a5_arg_types_var_10320177371892983316[3] = { &__type_info__8d7a5777b8312c71, &__type_info__af8afe4c86446b52, &__type_info__af8afe4c86446b52 };
+const char * __type_info__22a8dee7d3c2f6a5_arg_names_var_10320177371892983316[3] = { "__this", "x", "y" };
+VarInfo __struct_info__8f38a2a41eb4a614_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af8afe4c86446b52, nullptr, (TypeInfo **)__type_info__22a8dee7d3c2f6a5_arg_types_var_10320177371892983316, __type_info__22a8dee7d3c2f6a5_arg_names_var_10320177371892983316, 3, 0, nullptr, 12, 8, UINT64_C(0x22a8dee7d3c2f6a5), "__lambda", 0, 0 };
+TypeInfo * __type_info__992102838885157e_arg_types_var_10320177371892983316[1] = { &__type_info__104a9062238b16ae };
+VarInfo __struct_info__8f38a2a41eb4a614_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__992102838885157e_arg_types_var_10320177371892983316, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0x992102838885157e), "__finalize", 8, 0 };
+VarInfo * __struct_info__8f38a2a41eb4a614_fields[2] =  { &__struct_info__8f38a2a41eb4a614_field_0, &__struct_info__8f38a2a41eb4a614_field_1 };
+StructInfo __struct_info__8f38a2a41eb4a614 = {"_lambda_thismodule_139_15", "", 14, __struct_info__8f38a2a41eb4a614_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0x8f38a2a41eb4a614), 2 };
+TypeInfo * __type_info__12e9107893f48b1a_arg_types_var_12584212555921461092[2] = { &__type_info__bd968195635b17cf, &__type_info__af8afe4c86446b52 };
+VarInfo __struct_info__aea41aa545b58f64_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__1f1db26455da92b, nullptr, (TypeInfo **)__type_info__12e9107893f48b1a_arg_types_var_12584212555921461092, __type_info__224d825820d515ec_arg_names_var_10132565508284982382, 2, 0, nullptr, 12, 8, UINT64_C(0x12e9107893f48b1a), "__lambda", 0, 0 };
+TypeInfo * __type_info__d7a30122c3a4c294_arg_types_var_12584212555921461092[1] = { &__type_info__4a4c5f3fe0242733 };
+VarInfo __struct_info__aea41aa545b58f64_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__d7a30122c3a4c294_arg_types_var_12584212555921461092, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0xd7a30122c3a4c294), "__finalize", 8, 0 };
+VarInfo * __struct_info__aea41aa545b58f64_fields[2] =  { &__struct_info__aea41aa545b58f64_field_0, &__struct_info__aea41aa545b58f64_field_1 };
+StructInfo __struct_info__aea41aa545b58f64 = {"_lambda_thismodule_163_2", "", 14, __struct_info__aea41aa545b58f64_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0xaea41aa545b58f64), 2 };
+TypeInfo * __type_info__1f303a1db62af171_arg_types_var_16273289693698564400[2] = { &__type_info__e40293a87e6b0765, &__type_info__af8afe4c86446b52 };
+VarInfo __struct_info__e1d656c1bfeda130_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__1f303a1db62af171_arg_types_var_16273289693698564400, __type_info__224d825820d515ec_arg_names_var_10132565508284982382, 2, 0, nullptr, 12, 8, UINT64_C(0x1f303a1db62af171), "__lambda", 0, 0 };
+TypeInfo * __type_info__fc5d1cf7d331ccb2_arg_types_var_16273289693698564400[1] = { &__type_info__7a353f43ac58845a };
+VarInfo __struct_info__e1d656c1bfeda130_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__fc5d1cf7d331ccb2_arg_types_var_16273289693698564400, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0xfc5d1cf7d331ccb2), "__finalize", 8, 0 };
+VarInfo * __struct_info__e1d656c1bfeda130_fields[2] =  { &__struct_info__e1d656c1bfeda130_field_0, &__struct_info__e1d656c1bfeda130_field_1 };
+StructInfo __struct_info__e1d656c1bfeda130 = {"_lambda_thismodule_187_16", "", 14, __struct_info__e1d656c1bfeda130_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0xe1d656c1bfeda130), 2 };
+TypeInfo * __type_info__35c6e51e21828929_arg_types_var_8902559548850124840[2] = { &__type_info__df3ccba3465e748d, &__type_info__af8afe4c86446b52 };
+VarInfo __struct_info__7b8c3ebdecf93828_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__35c6e51e21828929_arg_types_var_8902559548850124840, __type_info__224d825820d515ec_arg_names_var_10132565508284982382, 2, 0, nullptr, 12, 8, UINT64_C(0x35c6e51e21828929), "__lambda", 0, 0 };
+TypeInfo * __type_info__b648360212c6744a_arg_types_var_8902559548850124840[1] = { &__type_info__e73645adebba38b2 };
+VarInfo __struct_info__7b8c3ebdecf93828_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__b648360212c6744a_arg_types_var_8902559548850124840, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0xb648360212c6744a), "__finalize", 8, 0 };
+VarInfo * __struct_info__7b8c3ebdecf93828_fields[2] =  { &__struct_info__7b8c3ebdecf93828_field_0, &__struct_info__7b8c3ebdecf93828_field_1 };
+StructInfo __struct_info__7b8c3ebdecf93828 = {"_lambda_thismodule_196_17", "", 14, __struct_info__7b8c3ebdecf93828_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0x7b8c3ebdecf93828), 2 };
+TypeInfo * __type_info__be42c08c30397272_arg_types_var_16297759325020731405[2] = { &__type_info__f8e5c4a88db2f4a8, &__type_info__af8a9b4c8643c319 };
+const char * __type_info__be42c08c30397272_arg_names_var_16297759325020731405[2] = { "__this", "_yield_197" };
+VarInfo __struct_info__e22d45c1c2abb80d_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__be42c08c30397272_arg_types_var_16297759325020731405, __type_info__be42c08c30397272_arg_names_var_16297759325020731405, 2, 0, nullptr, 12, 8, UINT64_C(0xbe42c08c30397272), "__lambda", 0, 0 };
+TypeInfo * __type_info__f71031c5b285d663_arg_types_var_16297759325020731405[1] = { &__type_info__abb413d11a395f9 };
+VarInfo __struct_info__e22d45c1c2abb80d_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__f71031c5b285d663_arg_types_var_16297759325020731405, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0xf71031c5b285d663), "__finalize", 8, 0 };
+VarInfo __struct_info__e22d45c1c2abb80d_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x929acdb32a70c995), "__yield", 16, 0 };
+VarInfo __struct_info__e22d45c1c2abb80d_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__86e65058575787a, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xcb3bd40f9333d126), "src", 24, 4 };
+VarInfo __struct_info__e22d45c1c2abb80d_field_4 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xcafef50f93005b1b), "arr", 32, 6 };
+VarInfo __struct_info__e22d45c1c2abb80d_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xbf78b0217b6582e3), "___loop_at_204_16_rename_at_204_16", 56, 0 };
+VarInfo __struct_info__e22d45c1c2abb80d_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x4a4bcfda5ad85d0f), "__x_rename_at_204_21", 64, 7 };
+VarInfo __struct_info__e22d45c1c2abb80d_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x719ede2ccd97e1aa), "___pvar_0_at_204_16_rename_at_204_16", 72, 9 };
+VarInfo __struct_info__e22d45c1c2abb80d_field_8 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xe80871695cd30f20), "_loop_at_199_12", 80, 0 };
+VarInfo __struct_info__e22d45c1c2abb80d_field_9 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__86e65058575787a, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x8eb8d6db9764b919), "_source_0_at_199_12", 88, 11 };
+VarInfo __struct_info__e22d45c1c2abb80d_field_10 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x4a19de04dfdb07ee), "__x_rename_at_199_17", 96, 0 };
+VarInfo __struct_info__e22d45c1c2abb80d_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x690239da17b8771b), "_pvar_0_at_199_12", 104, 12 };
+VarInfo __struct_info__e22d45c1c2abb80d_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af8a9b4c8643c319, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x7f3b9c2f18e4672e), "___source_0_at_204_16_rename_at_204_16", 112, 13 };
+VarInfo * __struct_info__e22d45c1c2abb80d_fields[13] =  { &__struct_info__e22d45c1c2abb80d_field_0, &__struct_info__e22d45c1c2abb80d_field_1, &__struct_info__e22d45c1c2abb80d_field_2, &__struct_info__e22d45c1c2abb80d_field_3, &__struct_info__e22d45c1c2abb80d_field_4, &__struct_info__e22d45c1c2abb80d_field_5, &__struct_info__e22d45c1c2abb80d_field_6, &__struct_info__e22d45c1c2abb80d_field_7, &__struct_info__e22d45c1c2abb80d_field_8, &__struct_info__e22d45c1c2abb80d_field_9, &__struct_info__e22d45c1c2abb80d_field_10, &__struct_info__e22d45c1c2abb80d_field_11, &__struct_info__e22d45c1c2abb80d_field_12 };
+StructInfo __struct_info__e22d45c1c2abb80d = {"_lambda_thismodule_197_20", "", 30, __struct_info__e22d45c1c2abb80d_fields, 13, 120, UINT64_C(0x0), nullptr, UINT64_C(0xe22d45c1c2abb80d), 3 };
+TypeInfo * __type_info__5f6dbaf35266257_arg_types_var_11243399092835575330[2] = { &__type_info__d3d64492cafa2233, &__type_info__af8afe4c86446b52 };
+VarInfo __struct_info__9c0893e7a469e622_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__5f6dbaf35266257_arg_types_var_11243399092835575330, __type_info__224d825820d515ec_arg_names_var_10132565508284982382, 2, 0, nullptr, 12, 8, UINT64_C(0x5f6dbaf35266257), "__lambda", 0, 0 };
+TypeInfo * __type_info__474518bd5b8eb6b8_arg_types_var_11243399092835575330[1] = { &__type_info__3c336a173bb4e2e4 };
+VarInfo __struct_info__9c0893e7a469e622_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__474518bd5b8eb6b8_arg_types_var_11243399092835575330, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0x474518bd5b8eb6b8), "__finalize", 8, 0 };
+VarInfo * __struct_info__9c0893e7a469e622_fields[2] =  { &__struct_info__9c0893e7a469e622_field_0, &__struct_info__9c0893e7a469e622_field_1 };
+StructInfo __struct_info__9c0893e7a469e622 = {"_lambda_thismodule_204_18", "", 14, __struct_info__9c0893e7a469e622_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0x9c0893e7a469e622), 2 };
+TypeInfo * __type_info__7cc5a264a223b2e_arg_types_var_4505535657210871289[2] = { &__type_info__adb467a23ca603ac, &__type_info__8ec3236fc6ca9dc2 };
+const char * __type_info__7cc5a264a223b2e_arg_names_var_4505535657210871289[2] = { "__this", "_ryield211" };
+VarInfo __struct_info__3e86e0cf12e8fdf9_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__7cc5a264a223b2e_arg_types_var_4505535657210871289, __type_info__7cc5a264a223b2e_arg_names_var_4505535657210871289, 2, 0, nullptr, 12, 8, UINT64_C(0x7cc5a264a223b2e), "__lambda", 0, 0 };
+TypeInfo * __type_info__7a61be8c964b8ef7_arg_types_var_4505535657210871289[1] = { &__type_info__b3df55b8150004b5 };
+VarInfo __struct_info__3e86e0cf12e8fdf9_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__7a61be8c964b8ef7_arg_types_var_4505535657210871289, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0x7a61be8c964b8ef7), "__finalize", 8, 0 };
+VarInfo __struct_info__3e86e0cf12e8fdf9_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xc192cf4d419c9739), "__yield", 16, 0 };
+VarInfo __struct_info__3e86e0cf12e8fdf9_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__c32d69975ef39d8f, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x598ec0462b91dc32), "src", 24, 4 };
+VarInfo __struct_info__3e86e0cf12e8fdf9_field_4 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__1f1db26455da92b, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x59bee1462bbb3807), "arr", 32, 6 };
+VarInfo __struct_info__3e86e0cf12e8fdf9_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x20e5caf8e40508b0), "___loop_at_218_16_rename_at_218_16", 56, 0 };
+VarInfo __struct_info__3e86e0cf12e8fdf9_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1f1db26455da92b, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xe1d3cfaa4807b377), "__x_rename_at_218_21", 64, 7 };
+VarInfo __struct_info__3e86e0cf12e8fdf9_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x1add4f0b773102a5), "___pvar_0_at_218_16_rename_at_218_16", 72, 9 };
+VarInfo __struct_info__3e86e0cf12e8fdf9_field_8 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xbdc1aa668d28b314), "_loop_at_213_12", 80, 0 };
+VarInfo __struct_info__3e86e0cf12e8fdf9_field_9 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__c32d69975ef39d8f, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xf95952f3050a30d5), "_source_0_at_213_12", 88, 11 };
+TypeInfo * __type_info__e1d248aa47eb1ea1_arg_types_var_4505535657210871289[2] = { &__type_info__af63e44c8601fa24, &__type_info__af63db4c8601ead9 };
+VarInfo __struct_info__3e86e0cf12e8fdf9_field_10 =  { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__e1d248aa47eb1ea1_arg_types_var_4505535657210871289, nullptr, 2, 0, nullptr, 30, 8, UINT64_C(0xe1d248aa47eb1ea1), "__x_rename_at_213_17", 96, 0 };
+VarInfo __struct_info__3e86e0cf12e8fdf9_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xc7ed367dc959a3a7), "_pvar_0_at_213_12", 104, 12 };
+VarInfo __struct_info__3e86e0cf12e8fdf9_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__46c0bf42cd8a4056, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xf4c4776b755872b1), "___source_0_at_218_16_rename_at_218_16", 112, 13 };
+VarInfo * __struct_info__3e86e0cf12e8fdf9_fields[13] =  { &__struct_info__3e86e0cf12e8fdf9_field_0, &__struct_info__3e86e0cf12e8fdf9_field_1, &__struct_info__3e86e0cf12e8fdf9_field_2, &__struct_info__3e86e0cf12e8fdf9_field_3, &__struct_info__3e86e0cf12e8fdf9_field_4, &__struct_info__3e86e0cf12e8fdf9_field_5, &__struct_info__3e86e0cf12e8fdf9_field_6, &__struct_info__3e86e0cf12e8fdf9_field_7, &__struct_info__3e86e0cf12e8fdf9_field_8, &__struct_info__3e86e0cf12e8fdf9_field_9, &__struct_info__3e86e0cf12e8fdf9_field_10, &__struct_info__3e86e0cf12e8fdf9_field_11, &__struct_info__3e86e0cf12e8fdf9_field_12 };
+StructInfo __struct_info__3e86e0cf12e8fdf9 = {"_lambda_thismodule_211_24", "", 30, __struct_info__3e86e0cf12e8fdf9_fields, 13, 120, UINT64_C(0x0), nullptr, UINT64_C(0x3e86e0cf12e8fdf9), 3 };
+TypeInfo * __type_info__74e33cffedf4bd5b_arg_types_var_4505534557699243078[2] = { &__type_info__adb468a23ca6055f, &__type_info__14d70770224fa1 };
+VarInfo __struct_info__3e86dfcf12e8fc46_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__74e33cffedf4bd5b_arg_types_var_4505534557699243078, __type_info__7cc5a264a223b2e_arg_names_var_4505535657210871289, 2, 0, nullptr, 12, 8, UINT64_C(0x74e33cffedf4bd5b), "__lambda", 0, 0 };
+TypeInfo * __type_info__ff9d305183ac4054_arg_types_var_4505534557699243078[1] = { &__type_info__b3ddd3b8150057f8 };
+VarInfo __struct_info__3e86dfcf12e8fc46_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__ff9d305183ac4054_arg_types_var_4505534557699243078, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0xff9d305183ac4054), "__finalize", 8, 0 };
+VarInfo __struct_info__3e86dfcf12e8fc46_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x7e971fd924f7b550), "__yield", 16, 0 };
+VarInfo __struct_info__3e86dfcf12e8fc46_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__2767db6168f4baa4, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x6dfffc142f3692cf), "src", 24, 4 };
+VarInfo __struct_info__3e86dfcf12e8fc46_field_4 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__124e1c04d9af11ea, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x6dc2e3142f02ba36), "arr", 32, 6 };
+VarInfo __struct_info__3e86dfcf12e8fc46_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x12ddbfae7d22460f), "___loop_at_218_16_rename_at_218_16", 56, 0 };
+VarInfo __struct_info__3e86dfcf12e8fc46_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__124e1c04d9af11ea, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xac45b909e526d606), "__x_rename_at_218_21", 64, 7 };
+VarInfo __struct_info__3e86dfcf12e8fc46_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xc5f4235f7ba8e6c4), "___pvar_0_at_218_16_rename_at_218_16", 72, 9 };
+VarInfo __struct_info__3e86dfcf12e8fc46_field_8 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xd94f341352c18f9d), "_loop_at_213_12", 80, 0 };
+VarInfo __struct_info__3e86dfcf12e8fc46_field_9 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__2767db6168f4baa4, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x1e636c0a41e7fc40), "_source_0_at_213_12", 88, 10 };
+VarInfo __struct_info__3e86dfcf12e8fc46_field_10 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xac473809e5099e10), "__x_rename_at_213_17", 96, 11 };
+VarInfo __struct_info__3e86dfcf12e8fc46_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x3830bbf5796c21dc), "_pvar_0_at_213_12", 120, 12 };
+VarInfo __struct_info__3e86dfcf12e8fc46_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__993385c558408d53, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x2ab813f8fa053f96), "___source_0_at_218_16_rename_at_218_16", 128, 13 };
+VarInfo * __struct_info__3e86dfcf12e8fc46_fields[13] =  { &__struct_info__3e86dfcf12e8fc46_field_0, &__struct_info__3e86dfcf12e8fc46_field_1, &__struct_info__3e86dfcf12e8fc46_field_2, &__struct_info__3e86dfcf12e8fc46_field_3, &__struct_info__3e86dfcf12e8fc46_field_4, &__struct_info__3e86dfcf12e8fc46_field_5, &__struct_info__3e86dfcf12e8fc46_field_6, &__struct_info__3e86dfcf12e8fc46_field_7, &__struct_info__3e86dfcf12e8fc46_field_8, &__struct_info__3e86dfcf12e8fc46_field_9, &__struct_info__3e86dfcf12e8fc46_field_10, &__struct_info__3e86dfcf12e8fc46_field_11, &__struct_info__3e86dfcf12e8fc46_field_12 };
+StructInfo __struct_info__3e86dfcf12e8fc46 = {"_lambda_thismodule_211_25", "", 30, __struct_info__3e86dfcf12e8fc46_fields, 13, 136, UINT64_C(0x0), nullptr, UINT64_C(0x3e86dfcf12e8fc46), 3 };
+TypeInfo * __type_info__33221634e702cedd_arg_types_var_1691223291737568851[2] = { &__type_info__d8adf10f1316c01e, &__type_info__14d70770224fa1 };
+const char * __type_info__33221634e702cedd_arg_names_var_1691223291737568851[2] = { "__this", "_ryield21" };
+VarInfo __struct_info__17786e9f93e27653_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__33221634e702cedd_arg_types_var_1691223291737568851, __type_info__33221634e702cedd_arg_names_var_1691223291737568851, 2, 0, nullptr, 12, 8, UINT64_C(0x33221634e702cedd), "__lambda", 0, 0 };
+TypeInfo * __type_info__4f58504a0ca01c51_arg_types_var_1691223291737568851[1] = { &__type_info__8c0e33c24426da68 };
+VarInfo __struct_info__17786e9f93e27653_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__4f58504a0ca01c51_arg_types_var_1691223291737568851, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0x4f58504a0ca01c51), "__finalize", 8, 0 };
+VarInfo __struct_info__17786e9f93e27653_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x6f1d94baafee7a04), "__yield", 16, 0 };
+TypeInfo * __type_info__1b85ab1bc74d8a40_arg_types_var_1691223291737568851[1] = { &__type_info__1729724f5b0b8b6b };
+VarInfo __struct_info__17786e9f93e27653_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__1b85ab1bc74d8a40_arg_types_var_1691223291737568851, __type_info__3db355bab12f05bc_arg_names_var_14712423968180025719, 1, 0, nullptr, 24576, 8, UINT64_C(0x1b85ab1bc74d8a40), "blk", 24, 4 };
+VarInfo __struct_info__17786e9f93e27653_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__2767db6168f4baa4, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x4e7dc91bf299be3a), "src", 32, 6 };
+VarInfo __struct_info__17786e9f93e27653_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xceec5ef5ba117da1), "_loop_at_22_12", 40, 0 };
+VarInfo __struct_info__17786e9f93e27653_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__2767db6168f4baa4, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xe8981343a4b41e30), "_source_0_at_22_12", 48, 7 };
+VarInfo __struct_info__17786e9f93e27653_field_7 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x4ea2c2722c244b26), "__w_rename_at_22_17", 56, 8 };
+VarInfo __struct_info__17786e9f93e27653_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xaa3e787df2f79bfa), "_pvar_0_at_22_12", 80, 9 };
+VarInfo * __struct_info__17786e9f93e27653_fields[9] =  { &__struct_info__17786e9f93e27653_field_0, &__struct_info__17786e9f93e27653_field_1, &__struct_info__17786e9f93e27653_field_2, &__struct_info__17786e9f93e27653_field_3, &__struct_info__17786e9f93e27653_field_4, &__struct_info__17786e9f93e27653_field_5, &__struct_info__17786e9f93e27653_field_6, &__struct_info__17786e9f93e27653_field_7, &__struct_info__17786e9f93e27653_field_8 };
+StructInfo __struct_info__17786e9f93e27653 = {"_lambda_thismodule_21_30", "", 30, __struct_info__17786e9f93e27653_fields, 9, 88, UINT64_C(0x0), nullptr, UINT64_C(0x17786e9f93e27653), 3 };
+TypeInfo * __type_info__e7c8531a43cab2f1_arg_types_var_5605167154359479728[2] = { &__type_info__2c234aa62187a9a5, &__type_info__af8a9b4c8643c319 };
+const char * __type_info__e7c8531a43cab2f1_arg_names_var_5605167154359479728[2] = { "__this", "_yield_230" };
+VarInfo __struct_info__4dc98dd45648adb0_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__e7c8531a43cab2f1_arg_types_var_5605167154359479728, __type_info__e7c8531a43cab2f1_arg_names_var_5605167154359479728, 2, 0, nullptr, 12, 8, UINT64_C(0xe7c8531a43cab2f1), "__lambda", 0, 0 };
+TypeInfo * __type_info__a65d10f7b8785532_arg_types_var_5605167154359479728[1] = { &__type_info__e7924b558e7fd51a };
+VarInfo __struct_info__4dc98dd45648adb0_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__a65d10f7b8785532_arg_types_var_5605167154359479728, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0xa65d10f7b8785532), "__finalize", 8, 0 };
+VarInfo __struct_info__4dc98dd45648adb0_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x67e89e40a3438e26), "__yield", 16, 0 };
+VarInfo __struct_info__4dc98dd45648adb0_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__86e65058575787a, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x77d621f113479539), "src", 24, 7 };
+VarInfo __struct_info__4dc98dd45648adb0_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x1f9fed98b5038ac5), "start", 32, 0 };
+VarInfo __struct_info__4dc98dd45648adb0_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x709a2df10cc3079d), "stop", 36, 0 };
+VarInfo __struct_info__4dc98dd45648adb0_field_6 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x6ffa3d0f2e915bc5), "_loop_at_231_12", 40, 0 };
+VarInfo __struct_info__4dc98dd45648adb0_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__86e65058575787a, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x316246d5610d46e8), "_source_0_at_231_12", 48, 9 };
+VarInfo __struct_info__4dc98dd45648adb0_field_8 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xba456c548eac5014), "__x_rename_at_231_17", 56, 0 };
+VarInfo __struct_info__4dc98dd45648adb0_field_9 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x488b57aaa8b70760), "_pvar_0_at_231_12", 64, 11 };
+VarInfo __struct_info__4dc98dd45648adb0_field_10 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x76e9e433aff2a2ee), "__i_rename_at_231_20", 72, 0 };
+VarInfo __struct_info__4dc98dd45648adb0_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x968317b8a6665101), "_pvar_1_at_231_12", 80, 12 };
+VarInfo __struct_info__4dc98dd45648adb0_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xa15e8c63081ef69), "_source_1_at_231_12", 88, 13 };
+VarInfo * __struct_info__4dc98dd45648adb0_fields[13] =  { &__struct_info__4dc98dd45648adb0_field_0, &__struct_info__4dc98dd45648adb0_field_1, &__struct_info__4dc98dd45648adb0_field_2, &__struct_info__4dc98dd45648adb0_field_3, &__struct_info__4dc98dd45648adb0_field_4, &__struct_info__4dc98dd45648adb0_field_5, &__struct_info__4dc98dd45648adb0_field_6, &__struct_info__4dc98dd45648adb0_field_7, &__struct_info__4dc98dd45648adb0_field_8, &__struct_info__4dc98dd45648adb0_field_9, &__struct_info__4dc98dd45648adb0_field_10, &__struct_info__4dc98dd45648adb0_field_11, &__struct_info__4dc98dd45648adb0_field_12 };
+StructInfo __struct_info__4dc98dd45648adb0 = {"_lambda_thismodule_230_19", "", 14, __struct_info__4dc98dd45648adb0_fields, 13, 96, UINT64_C(0x0), nullptr, UINT64_C(0x4dc98dd45648adb0), 3 };
+TypeInfo * __type_info__21be05f422721589_arg_types_var_5394913953007014984[2] = { &__type_info__a84052c932b5643d, &__type_info__8ec3236fc6ca9dc2 };
+const char * __type_info__21be05f422721589_arg_names_var_5394913953007014984[2] = { "__this", "_ryield239" };
+VarInfo __struct_info__4ade95a822c81448_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__21be05f422721589_arg_types_var_5394913953007014984, __type_info__21be05f422721589_arg_names_var_5394913953007014984, 2, 0, nullptr, 12, 8, UINT64_C(0x21be05f422721589), "__lambda", 0, 0 };
+TypeInfo * __type_info__aace1d653042af2a_arg_types_var_5394913953007014984[1] = { &__type_info__927912335dbbe5d2 };
+VarInfo __struct_info__4ade95a822c81448_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__aace1d653042af2a_arg_types_var_5394913953007014984, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0xaace1d653042af2a), "__finalize", 8, 0 };
+VarInfo __struct_info__4ade95a822c81448_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x399170cf9077a56e), "__yield", 16, 0 };
+VarInfo __struct_info__4ade95a822c81448_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__9a819d9c36b75a57, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x8754ee0fd79f6a41), "src", 24, 7 };
+VarInfo __struct_info__4ade95a822c81448_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xa441ce09c0969f5d), "start", 32, 0 };
+VarInfo __struct_info__4ade95a822c81448_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x9c08ea0fe97a4975), "stop", 36, 0 };
+VarInfo __struct_info__4ade95a822c81448_field_6 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xeb99e5278fa2cc94), "_loop_at_240_12", 40, 0 };
+VarInfo __struct_info__4ade95a822c81448_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__9a819d9c36b75a57, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xf8518c224c8034d1), "_source_0_at_240_12", 48, 8 };
+VarInfo __struct_info__4ade95a822c81448_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c32d69975ef39d8f, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x1576c57e11f77329), "__x_rename_at_240_17", 56, 9 };
+VarInfo __struct_info__4ade95a822c81448_field_9 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x9eb03eeacc76d149), "_pvar_0_at_240_12", 64, 11 };
+VarInfo __struct_info__4ade95a822c81448_field_10 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x1ac6bf186198a623), "__i_rename_at_240_20", 72, 0 };
+VarInfo __struct_info__4ade95a822c81448_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x2e0124a791e6a488), "_pvar_1_at_240_12", 80, 12 };
+VarInfo __struct_info__4ade95a822c81448_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x3d7b8249c0192930), "_source_1_at_240_12", 88, 13 };
+VarInfo * __struct_info__4ade95a822c81448_fields[13] =  { &__struct_info__4ade95a822c81448_field_0, &__struct_info__4ade95a822c81448_field_1, &__struct_info__4ade95a822c81448_field_2, &__struct_info__4ade95a822c81448_field_3, &__struct_info__4ade95a822c81448_field_4, &__struct_info__4ade95a822c81448_field_5, &__struct_info__4ade95a822c81448_field_6, &__struct_info__4ade95a822c81448_field_7, &__struct_info__4ade95a822c81448_field_8, &__struct_info__4ade95a822c81448_field_9, &__struct_info__4ade95a822c81448_field_10, &__struct_info__4ade95a822c81448_field_11, &__struct_info__4ade95a822c81448_field_12 };
+StructInfo __struct_info__4ade95a822c81448 = {"_lambda_thismodule_239_31", "", 14, __struct_info__4ade95a822c81448_fields, 13, 96, UINT64_C(0x0), nullptr, UINT64_C(0x4ade95a822c81448), 3 };
+TypeInfo * __type_info__9a8a54f45c163c3_arg_types_var_5394916152030271406[2] = { &__type_info__a84050c932b560d7, &__type_info__14d70770224fa1 };
+VarInfo __struct_info__4ade97a822c817ae_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__9a8a54f45c163c3_arg_types_var_5394916152030271406, __type_info__21be05f422721589_arg_names_var_5394913953007014984, 2, 0, nullptr, 12, 8, UINT64_C(0x9a8a54f45c163c3), "__lambda", 0, 0 };
+TypeInfo * __type_info__2f52e91ccf9eec9c_arg_types_var_5394916152030271406[1] = { &__type_info__927792335db39300 };
+VarInfo __struct_info__4ade97a822c817ae_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__2f52e91ccf9eec9c_arg_types_var_5394916152030271406, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0x2f52e91ccf9eec9c), "__finalize", 8, 0 };
+VarInfo __struct_info__4ade97a822c817ae_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xb5d8a82906d02dc8), "__yield", 16, 0 };
+VarInfo __struct_info__4ade97a822c817ae_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b4fe6a6a4374785e, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xdb663ef716d5b827), "src", 24, 7 };
+VarInfo __struct_info__4ade97a822c817ae_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x282e5cbd140e241b), "start", 32, 0 };
+VarInfo __struct_info__4ade97a822c817ae_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xc69232f704c45dc3), "stop", 36, 0 };
+VarInfo __struct_info__4ade97a822c817ae_field_6 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xd4b8be11fac6a91e), "_loop_at_240_12", 40, 0 };
+VarInfo __struct_info__4ade97a822c817ae_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b4fe6a6a4374785e, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x78778bac4f064df7), "_source_0_at_240_12", 48, 8 };
+VarInfo __struct_info__4ade97a822c817ae_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2767db6168f4baa4, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x8993a765697a83c3), "__x_rename_at_240_17", 56, 9 };
+VarInfo __struct_info__4ade97a822c817ae_field_9 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x5941e5600dfb3ecb), "_pvar_0_at_240_12", 64, 11 };
+VarInfo __struct_info__4ade97a822c817ae_field_10 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x10c6425ce2337b21), "__i_rename_at_240_20", 72, 0 };
+VarInfo __struct_info__4ade97a822c817ae_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xb9225e480c493c4a), "_pvar_1_at_240_12", 80, 12 };
+VarInfo __struct_info__4ade97a822c817ae_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xbe2202483d075336), "_source_1_at_240_12", 88, 13 };
+VarInfo * __struct_info__4ade97a822c817ae_fields[13] =  { &__struct_info__4ade97a822c817ae_field_0, &__struct_info__4ade97a822c817ae_field_1, &__struct_info__4ade97a822c817ae_field_2, &__struct_info__4ade97a822c817ae_field_3, &__struct_info__4ade97a822c817ae_field_4, &__struct_info__4ade97a822c817ae_field_5, &__struct_info__4ade97a822c817ae_field_6, &__struct_info__4ade97a822c817ae_field_7, &__struct_info__4ade97a822c817ae_field_8, &__struct_info__4ade97a822c817ae_field_9, &__struct_info__4ade97a822c817ae_field_10, &__struct_info__4ade97a822c817ae_field_11, &__struct_info__4ade97a822c817ae_field_12 };
+StructInfo __struct_info__4ade97a822c817ae = {"_lambda_thismodule_239_33", "", 14, __struct_info__4ade97a822c817ae_fields, 13, 96, UINT64_C(0x0), nullptr, UINT64_C(0x4ade97a822c817ae), 3 };
+TypeInfo * __type_info__7f3cc15c63c55a15_arg_types_var_10015190420672020795[2] = { &__type_info__546ccda1211d29fe, &__type_info__af8a9b4c8643c319 };
+const char * __type_info__7f3cc15c63c55a15_arg_names_var_10015190420672020795[2] = { "__this", "_yield_251" };
+VarInfo __struct_info__8afd1a9ff60d013b_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__7f3cc15c63c55a15_arg_types_var_10015190420672020795, __type_info__7f3cc15c63c55a15_arg_names_var_10015190420672020795, 2, 0, nullptr, 12, 8, UINT64_C(0x7f3cc15c63c55a15), "__lambda", 0, 0 };
+TypeInfo * __type_info__b729d5642323c2f9_arg_types_var_10015190420672020795[1] = { &__type_info__48569549463a1610 };
+VarInfo __struct_info__8afd1a9ff60d013b_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__b729d5642323c2f9_arg_types_var_10015190420672020795, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0xb729d5642323c2f9), "__finalize", 8, 0 };
+VarInfo __struct_info__8afd1a9ff60d013b_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xb10d8c6b6e582ecc), "__yield", 16, 0 };
+VarInfo __struct_info__8afd1a9ff60d013b_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xa4e28269390ba877), "_loop_at_251_26", 20, 0 };
+VarInfo __struct_info__8afd1a9ff60d013b_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x4788e864ae641b4d), "__x_rename_at_251_30", 24, 0 };
+VarInfo __struct_info__8afd1a9ff60d013b_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xef3b09126de67f8c), "_pvar_0_at_251_26", 32, 6 };
+VarInfo __struct_info__8afd1a9ff60d013b_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x2cd0046fcf4a5546), "_source_0_at_251_26", 40, 7 };
+VarInfo * __struct_info__8afd1a9ff60d013b_fields[7] =  { &__struct_info__8afd1a9ff60d013b_field_0, &__struct_info__8afd1a9ff60d013b_field_1, &__struct_info__8afd1a9ff60d013b_field_2, &__struct_info__8afd1a9ff60d013b_field_3, &__struct_info__8afd1a9ff60d013b_field_4, &__struct_info__8afd1a9ff60d013b_field_5, &__struct_info__8afd1a9ff60d013b_field_6 };
+StructInfo __struct_info__8afd1a9ff60d013b = {"_lambda_thismodule_251_6", "", 14, __struct_info__8afd1a9ff60d013b_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0x8afd1a9ff60d013b), 5 };
+TypeInfo * __type_info__6007f52e3c7c8615_arg_types_var_11708825355870999867[2] = { &__type_info__fad3cd88907a57fe, &__type_info__1f1db26455da92b };
+const char * __type_info__6007f52e3c7c8615_arg_names_var_11708825355870999867[2] = { "__this", "_yield_256" };
+VarInfo __struct_info__a27e1aa009c7153b_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__6007f52e3c7c8615_arg_types_var_11708825355870999867, __type_info__6007f52e3c7c8615_arg_names_var_11708825355870999867, 2, 0, nullptr, 12, 8, UINT64_C(0x6007f52e3c7c8615), "__lambda", 0, 0 };
+TypeInfo * __type_info__43950e1db7d36f9_arg_types_var_11708825355870999867[1] = { &__type_info__87b559918d89fa10 };
+VarInfo __struct_info__a27e1aa009c7153b_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__43950e1db7d36f9_arg_types_var_11708825355870999867, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0x43950e1db7d36f9), "__finalize", 8, 0 };
+VarInfo __struct_info__a27e1aa009c7153b_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x2ebc00a0b3586acc), "__yield", 16, 0 };
+VarInfo __struct_info__a27e1aa009c7153b_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x3f5cf3c82e7ba875), "_loop_at_256_18", 20, 0 };
+VarInfo __struct_info__a27e1aa009c7153b_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xe2f3b0353ae51fe7), "__x_rename_at_256_22", 24, 0 };
+VarInfo __struct_info__a27e1aa009c7153b_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x78ad85f7847f13da), "_pvar_0_at_256_18", 32, 6 };
+VarInfo __struct_info__a27e1aa009c7153b_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x42eacb4fa5ea638c), "_source_0_at_256_18", 40, 7 };
+VarInfo * __struct_info__a27e1aa009c7153b_fields[7] =  { &__struct_info__a27e1aa009c7153b_field_0, &__struct_info__a27e1aa009c7153b_field_1, &__struct_info__a27e1aa009c7153b_field_2, &__struct_info__a27e1aa009c7153b_field_3, &__struct_info__a27e1aa009c7153b_field_4, &__struct_info__a27e1aa009c7153b_field_5, &__struct_info__a27e1aa009c7153b_field_6 };
+StructInfo __struct_info__a27e1aa009c7153b = {"_lambda_thismodule_256_7", "", 14, __struct_info__a27e1aa009c7153b_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0xa27e1aa009c7153b), 5 };
+TypeInfo * __type_info__6b671f3662c88815_arg_types_var_8065694731590270779[2] = { &__type_info__8e28cdc92b2fb7fe, &__type_info__1f1db26455da92b };
+const char * __type_info__6b671f3662c88815_arg_names_var_8065694731590270779[2] = { "__this", "_yield_259" };
+VarInfo __struct_info__6fef1a9fdf2d7f3b_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__6b671f3662c88815_arg_types_var_8065694731590270779, __type_info__6b671f3662c88815_arg_names_var_8065694731590270779, 2, 0, nullptr, 12, 8, UINT64_C(0x6b671f3662c88815), "__lambda", 0, 0 };
+TypeInfo * __type_info__bd67928c222af8f9_arg_types_var_8065694731590270779[1] = { &__type_info__57405351ce63bc10 };
+VarInfo __struct_info__6fef1a9fdf2d7f3b_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__bd67928c222af8f9_arg_types_var_8065694731590270779, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0xbd67928c222af8f9), "__finalize", 8, 0 };
+VarInfo __struct_info__6fef1a9fdf2d7f3b_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x53b61b17b1320cc), "__yield", 16, 0 };
+VarInfo __struct_info__6fef1a9fdf2d7f3b_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x4a4d719516916eff), "_loop_at_259_26", 20, 0 };
+VarInfo __struct_info__6fef1a9fdf2d7f3b_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xf1cd1f9ba4ff54d), "__x_rename_at_259_30", 24, 0 };
+VarInfo __struct_info__6fef1a9fdf2d7f3b_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x2b6ebc9db23979f4), "_pvar_0_at_259_26", 32, 6 };
+VarInfo __struct_info__6fef1a9fdf2d7f3b_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xa2a4e6302a77f22e), "_source_0_at_259_26", 40, 7 };
+VarInfo * __struct_info__6fef1a9fdf2d7f3b_fields[7] =  { &__struct_info__6fef1a9fdf2d7f3b_field_0, &__struct_info__6fef1a9fdf2d7f3b_field_1, &__struct_info__6fef1a9fdf2d7f3b_field_2, &__struct_info__6fef1a9fdf2d7f3b_field_3, &__struct_info__6fef1a9fdf2d7f3b_field_4, &__struct_info__6fef1a9fdf2d7f3b_field_5, &__struct_info__6fef1a9fdf2d7f3b_field_6 };
+StructInfo __struct_info__6fef1a9fdf2d7f3b = {"_lambda_thismodule_259_8", "", 14, __struct_info__6fef1a9fdf2d7f3b_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0x6fef1a9fdf2d7f3b), 5 };
+TypeInfo * __type_info__69381528c2658657_arg_types_var_7349192789520257570[2] = { &__type_info__c78d7c92c5430d9b, &__type_info__124e1c04d9af11ea };
+const char * __type_info__69381528c2658657_arg_names_var_7349192789520257570[2] = { "__this", "_yield_264" };
+VarInfo __struct_info__65fd93e785379222_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__69381528c2658657_arg_types_var_7349192789520257570, __type_info__69381528c2658657_arg_names_var_7349192789520257570, 2, 0, nullptr, 12, 8, UINT64_C(0x69381528c2658657), "__lambda", 0, 0 };
+TypeInfo * __type_info__d7853bac739a6ab8_arg_types_var_7349192789520257570[1] = { &__type_info__f1932a8b29adc7a4 };
+VarInfo __struct_info__65fd93e785379222_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__d7853bac739a6ab8_arg_types_var_7349192789520257570, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0xd7853bac739a6ab8), "__finalize", 8, 0 };
+VarInfo __struct_info__65fd93e785379222_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xa59b9001c2c6ced4), "__yield", 16, 0 };
+VarInfo __struct_info__65fd93e785379222_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xdc7957345aaed506), "_loop_at_264_18", 20, 0 };
+VarInfo __struct_info__65fd93e785379222_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xda1ef8e6661f8b2e), "__x_rename_at_264_22", 24, 0 };
+VarInfo __struct_info__65fd93e785379222_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xfb2abb7e221743a3), "_pvar_0_at_264_18", 32, 6 };
+VarInfo __struct_info__65fd93e785379222_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x66e820dc7ee133ef), "_source_0_at_264_18", 40, 7 };
+VarInfo * __struct_info__65fd93e785379222_fields[7] =  { &__struct_info__65fd93e785379222_field_0, &__struct_info__65fd93e785379222_field_1, &__struct_info__65fd93e785379222_field_2, &__struct_info__65fd93e785379222_field_3, &__struct_info__65fd93e785379222_field_4, &__struct_info__65fd93e785379222_field_5, &__struct_info__65fd93e785379222_field_6 };
+StructInfo __struct_info__65fd93e785379222 = {"_lambda_thismodule_264_12", "", 14, __struct_info__65fd93e785379222_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0x65fd93e785379222), 5 };
+TypeInfo * __type_info__c1830eeca540431a_arg_types_var_10982619915815712612[2] = { &__type_info__b190788d814895cf, &__type_info__af8a9b4c8643c319 };
+const char * __type_info__c1830eeca540431a_arg_names_var_10982619915815712612[2] = { "__this", "_yield_265" };
+VarInfo __struct_info__986a1aa001537764_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__c1830eeca540431a_arg_types_var_10982619915815712612, __type_info__c1830eeca540431a_arg_names_var_10982619915815712612, 2, 0, nullptr, 12, 8, UINT64_C(0xc1830eeca540431a), "__lambda", 0, 0 };
+TypeInfo * __type_info__3245d03b62993a94_arg_types_var_10982619915815712612[1] = { &__type_info__e54db47e311a4133 };
+VarInfo __struct_info__986a1aa001537764_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__3245d03b62993a94_arg_types_var_10982619915815712612, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0x3245d03b62993a94), "__finalize", 8, 0 };
+VarInfo __struct_info__986a1aa001537764_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x9a3f9521f7f09399), "__yield", 16, 0 };
+VarInfo __struct_info__986a1aa001537764_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x8eb5f8c83c283ae6), "count", 20, 0 };
+VarInfo __struct_info__986a1aa001537764_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x7e23142e71ebefd1), "value", 24, 0 };
+VarInfo __struct_info__986a1aa001537764_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x5cf3e50aab37c93c), "_loop_at_271_8", 28, 0 };
+VarInfo __struct_info__986a1aa001537764_field_6 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xc43d702da1f5f095), "__x_rename_at_271_13", 32, 0 };
+VarInfo __struct_info__986a1aa001537764_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x6f98dd3fa8174fd), "_pvar_0_at_271_8", 40, 8 };
+VarInfo __struct_info__986a1aa001537764_field_8 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xbbebfee35cb975d1), "_source_0_at_271_8", 48, 9 };
+VarInfo * __struct_info__986a1aa001537764_fields[9] =  { &__struct_info__986a1aa001537764_field_0, &__struct_info__986a1aa001537764_field_1, &__struct_info__986a1aa001537764_field_2, &__struct_info__986a1aa001537764_field_3, &__struct_info__986a1aa001537764_field_4, &__struct_info__986a1aa001537764_field_5, &__struct_info__986a1aa001537764_field_6, &__struct_info__986a1aa001537764_field_7, &__struct_info__986a1aa001537764_field_8 };
+StructInfo __struct_info__986a1aa001537764 = {"_lambda_thismodule_265_3", "", 14, __struct_info__986a1aa001537764_fields, 9, 56, UINT64_C(0x0), nullptr, UINT64_C(0x986a1aa001537764), 7 };
+TypeInfo * __type_info__30ec88e41b1b817a_arg_types_var_9440834463687880917[2] = { &__type_info__9e147b84c0be84e8, &__type_info__124e1c04d9af11ea };
+const char * __type_info__30ec88e41b1b817a_arg_names_var_9440834463687880917[2] = { "__this", "_yield_267" };
+VarInfo __struct_info__830494eccf61b0d5_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__30ec88e41b1b817a_arg_types_var_9440834463687880917, __type_info__30ec88e41b1b817a_arg_names_var_9440834463687880917, 2, 0, nullptr, 12, 8, UINT64_C(0x30ec88e41b1b817a), "__lambda", 0, 0 };
+TypeInfo * __type_info__fa19b66971b04bcb_arg_types_var_9440834463687880917[1] = { &__type_info__7caa38dc7ab7561 };
+VarInfo __struct_info__830494eccf61b0d5_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__fa19b66971b04bcb_arg_types_var_9440834463687880917, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0xfa19b66971b04bcb), "__finalize", 8, 0 };
+VarInfo __struct_info__830494eccf61b0d5_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x845f960a5985e4ed), "__yield", 16, 0 };
+VarInfo __struct_info__830494eccf61b0d5_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xaf6391818b495acd), "_loop_at_267_26", 20, 0 };
+VarInfo __struct_info__830494eccf61b0d5_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x139b5841c094c393), "__x_rename_at_267_30", 24, 0 };
+VarInfo __struct_info__830494eccf61b0d5_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x482a37755e7fe3d2), "_pvar_0_at_267_26", 32, 6 };
+VarInfo __struct_info__830494eccf61b0d5_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xcb72f4330301f6b4), "_source_0_at_267_26", 40, 7 };
+VarInfo * __struct_info__830494eccf61b0d5_fields[7] =  { &__struct_info__830494eccf61b0d5_field_0, &__struct_info__830494eccf61b0d5_field_1, &__struct_info__830494eccf61b0d5_field_2, &__struct_info__830494eccf61b0d5_field_3, &__struct_info__830494eccf61b0d5_field_4, &__struct_info__830494eccf61b0d5_field_5, &__struct_info__830494eccf61b0d5_field_6 };
+StructInfo __struct_info__830494eccf61b0d5 = {"_lambda_thismodule_267_13", "", 14, __struct_info__830494eccf61b0d5_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0x830494eccf61b0d5), 5 };
+TypeInfo * __type_info__e115c5548ea59a9f_arg_types_var_10014134889509316685[2] = { &__type_info__40351fa10b07fb94, &__type_info__dc0fb9d6ab9c1b67 };
+const char * __type_info__e115c5548ea59a9f_arg_names_var_10014134889509316685[2] = { "__this", "_ryield271" };
+VarInfo __struct_info__8af95a9ff60c684d_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__e115c5548ea59a9f_arg_types_var_10014134889509316685, __type_info__e115c5548ea59a9f_arg_names_var_10014134889509316685, 2, 0, nullptr, 12, 8, UINT64_C(0xe115c5548ea59a9f), "__lambda", 0, 0 };
+TypeInfo * __type_info__a6104d24e1cd72a3_arg_types_var_10014134889509316685[1] = { &__type_info__6ced550ca0c56572 };
+VarInfo __struct_info__8af95a9ff60c684d_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__a6104d24e1cd72a3_arg_types_var_10014134889509316685, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0xa6104d24e1cd72a3), "__finalize", 8, 0 };
+VarInfo __struct_info__8af95a9ff60c684d_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x3390a01f178d5aae), "__yield", 16, 0 };
+VarInfo __struct_info__8af95a9ff60c684d_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xfa4378e8c3cb4715), "_loop_at_271_25", 20, 0 };
+VarInfo __struct_info__8af95a9ff60c684d_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xb6350aa67502108e), "__x_rename_at_271_29", 24, 0 };
+VarInfo __struct_info__8af95a9ff60c684d_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xa638c4de621bf956), "_pvar_0_at_271_25", 32, 6 };
+VarInfo __struct_info__8af95a9ff60c684d_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xd54e123375ff65ac), "_source_0_at_271_25", 40, 7 };
+VarInfo * __struct_info__8af95a9ff60c684d_fields[7] =  { &__struct_info__8af95a9ff60c684d_field_0, &__struct_info__8af95a9ff60c684d_field_1, &__struct_info__8af95a9ff60c684d_field_2, &__struct_info__8af95a9ff60c684d_field_3, &__struct_info__8af95a9ff60c684d_field_4, &__struct_info__8af95a9ff60c684d_field_5, &__struct_info__8af95a9ff60c684d_field_6 };
+StructInfo __struct_info__8af95a9ff60c684d = {"_lambda_thismodule_271_9", "", 14, __struct_info__8af95a9ff60c684d_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0x8af95a9ff60c684d), 5 };
+TypeInfo * __type_info__657f501a6d16ff5d_arg_types_var_11536937566244577491[2] = { &__type_info__df51ab11a09302d6, &__type_info__af8a9b4c8643c319 };
+const char * __type_info__657f501a6d16ff5d_arg_names_var_11536937566244577491[2] = { "__this", "_yield_46" };
+VarInfo __struct_info__a01b6f9757de20d3_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__657f501a6d16ff5d_arg_types_var_11536937566244577491, __type_info__657f501a6d16ff5d_arg_names_var_11536937566244577491, 2, 0, nullptr, 12, 8, UINT64_C(0x657f501a6d16ff5d), "__lambda", 0, 0 };
+TypeInfo * __type_info__5ee2132b84c595d1_arg_types_var_11536937566244577491[1] = { &__type_info__15378a5b2cc470e8 };
+VarInfo __struct_info__a01b6f9757de20d3_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__5ee2132b84c595d1_arg_types_var_11536937566244577491, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0x5ee2132b84c595d1), "__finalize", 8, 0 };
+VarInfo __struct_info__a01b6f9757de20d3_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xed901daae53c4984), "__yield", 16, 0 };
+const char * __type_info__ec2dc59d7aff95c0_arg_names_var_11536937566244577491[1] = { "x" };
+VarInfo __struct_info__a01b6f9757de20d3_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9dd4995d0e385a78, nullptr, (TypeInfo **)__type_info__3db355bab12f05bc_arg_types_var_14712423968180025719, __type_info__ec2dc59d7aff95c0_arg_names_var_11536937566244577491, 1, 0, nullptr, 12, 8, UINT64_C(0xec2dc59d7aff95c0), "blk", 24, 0 };
+VarInfo __struct_info__a01b6f9757de20d3_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__86e65058575787a, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xb22de39d498781ba), "src", 32, 6 };
+VarInfo __struct_info__a01b6f9757de20d3_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x5aec8a1c1d4eab0b), "_loop_at_47_12", 40, 0 };
+VarInfo __struct_info__a01b6f9757de20d3_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__86e65058575787a, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x44aa91b82fa52ac6), "_source_0_at_47_12", 48, 8 };
+VarInfo __struct_info__a01b6f9757de20d3_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x236ab8beaac8dca7), "__w_rename_at_47_17", 56, 0 };
+VarInfo __struct_info__a01b6f9757de20d3_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xcdf0bb38540c734c), "_pvar_0_at_47_12", 64, 9 };
+VarInfo * __struct_info__a01b6f9757de20d3_fields[9] =  { &__struct_info__a01b6f9757de20d3_field_0, &__struct_info__a01b6f9757de20d3_field_1, &__struct_info__a01b6f9757de20d3_field_2, &__struct_info__a01b6f9757de20d3_field_3, &__struct_info__a01b6f9757de20d3_field_4, &__struct_info__a01b6f9757de20d3_field_5, &__struct_info__a01b6f9757de20d3_field_6, &__struct_info__a01b6f9757de20d3_field_7, &__struct_info__a01b6f9757de20d3_field_8 };
+StructInfo __struct_info__a01b6f9757de20d3 = {"_lambda_thismodule_46_26", "", 14, __struct_info__a01b6f9757de20d3_fields, 9, 72, UINT64_C(0x0), nullptr, UINT64_C(0xa01b6f9757de20d3), 4 };
+TypeInfo * __type_info__e469ceb06eae305d_arg_types_var_11537219041221399507[2] = { &__type_info__dbebab119dafd9d6, &__type_info__af8a9b4c8643c319 };
+VarInfo __struct_info__a01c6f9757dfd3d3_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__e469ceb06eae305d_arg_types_var_11537219041221399507, __type_info__657f501a6d16ff5d_arg_names_var_11536937566244577491, 2, 0, nullptr, 12, 8, UINT64_C(0xe469ceb06eae305d), "__lambda", 0, 0 };
+TypeInfo * __type_info__4203910cf857ad1_arg_types_var_11537219041221399507[1] = { &__type_info__1a2c8a55ff79ede8 };
+VarInfo __struct_info__a01c6f9757dfd3d3_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__4203910cf857ad1_arg_types_var_11537219041221399507, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0x4203910cf857ad1), "__finalize", 8, 0 };
+VarInfo __struct_info__a01c6f9757dfd3d3_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xa943c77cc748de84), "__yield", 16, 0 };
+VarInfo __struct_info__a01c6f9757dfd3d3_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__9dd4995d0e385a78, nullptr, (TypeInfo **)__type_info__3db355bab12f05bc_arg_types_var_14712423968180025719, __type_info__ec2dc59d7aff95c0_arg_names_var_11536937566244577491, 1, 0, nullptr, 24576, 8, UINT64_C(0xf97ec943fe7fc2c0), "blk", 24, 4 };
+VarInfo __struct_info__a01c6f9757dfd3d3_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__86e65058575787a, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xc68ee743d3418cba), "src", 32, 6 };
+VarInfo __struct_info__a01c6f9757dfd3d3_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x202e4a631556ea0b), "_loop_at_47_12", 40, 0 };
+VarInfo __struct_info__a01c6f9757dfd3d3_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__86e65058575787a, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xd0dd334ad60447c6), "_source_0_at_47_12", 48, 8 };
+VarInfo __struct_info__a01c6f9757dfd3d3_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x554859fca2022fa7), "__w_rename_at_47_17", 56, 0 };
+VarInfo __struct_info__a01c6f9757dfd3d3_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x3d6f0871d018a24c), "_pvar_0_at_47_12", 64, 9 };
+VarInfo * __struct_info__a01c6f9757dfd3d3_fields[9] =  { &__struct_info__a01c6f9757dfd3d3_field_0, &__struct_info__a01c6f9757dfd3d3_field_1, &__struct_info__a01c6f9757dfd3d3_field_2, &__struct_info__a01c6f9757dfd3d3_field_3, &__struct_info__a01c6f9757dfd3d3_field_4, &__struct_info__a01c6f9757dfd3d3_field_5, &__struct_info__a01c6f9757dfd3d3_field_6, &__struct_info__a01c6f9757dfd3d3_field_7, &__struct_info__a01c6f9757dfd3d3_field_8 };
+StructInfo __struct_info__a01c6f9757dfd3d3 = {"_lambda_thismodule_46_27", "", 14, __struct_info__a01c6f9757dfd3d3_fields, 9, 72, UINT64_C(0x0), nullptr, UINT64_C(0xa01c6f9757dfd3d3), 3 };
+TypeInfo * __type_info__7b1774864969015d_arg_types_var_11538626416105509587[2] = { &__type_info__caedab118f400cd6, &__type_info__1f1db26455da92b };
+VarInfo __struct_info__a0216f9757e852d3_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__7b1774864969015d_arg_types_var_11538626416105509587, __type_info__657f501a6d16ff5d_arg_names_var_11536937566244577491, 2, 0, nullptr, 12, 8, UINT64_C(0x7b1774864969015d), "__lambda", 0, 0 };
+TypeInfo * __type_info__4e627eb861d57fd1_arg_types_var_11538626416105509587[1] = { &__type_info__c19d8a8c4843c2e8 };
+VarInfo __struct_info__a0216f9757e852d3_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__4e627eb861d57fd1_arg_types_var_11538626416105509587, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0x4e627eb861d57fd1), "__finalize", 8, 0 };
+VarInfo __struct_info__a0216f9757e852d3_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x41dcd8e56686ff84), "__yield", 16, 0 };
+VarInfo __struct_info__a0216f9757e852d3_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__9c5a3d06af66f104, nullptr, (TypeInfo **)__type_info__3db355bab12f05bc_arg_types_var_14712423968180025719, __type_info__ec2dc59d7aff95c0_arg_names_var_11536937566244577491, 1, 0, nullptr, 24576, 8, UINT64_C(0xe09daff17a39bfc0), "blk", 24, 4 };
+VarInfo __struct_info__a0216f9757e852d3_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__86e65058575787a, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xa69dcdf148c1abba), "src", 32, 6 };
+VarInfo __struct_info__a0216f9757e852d3_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xdebe18e92ded1d0b), "_loop_at_47_12", 40, 0 };
+VarInfo __struct_info__a0216f9757e852d3_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__86e65058575787a, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xfe245e0ec451d8c6), "_source_0_at_47_12", 48, 8 };
+VarInfo __struct_info__a0216f9757e852d3_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x8cdaa5b901e82a7), "__w_rename_at_47_17", 56, 0 };
+VarInfo __struct_info__a0216f9757e852d3_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xa05d4591a8f5cd4c), "_pvar_0_at_47_12", 64, 9 };
+VarInfo * __struct_info__a0216f9757e852d3_fields[9] =  { &__struct_info__a0216f9757e852d3_field_0, &__struct_info__a0216f9757e852d3_field_1, &__struct_info__a0216f9757e852d3_field_2, &__struct_info__a0216f9757e852d3_field_3, &__struct_info__a0216f9757e852d3_field_4, &__struct_info__a0216f9757e852d3_field_5, &__struct_info__a0216f9757e852d3_field_6, &__struct_info__a0216f9757e852d3_field_7, &__struct_info__a0216f9757e852d3_field_8 };
+StructInfo __struct_info__a0216f9757e852d3 = {"_lambda_thismodule_46_28", "", 14, __struct_info__a0216f9757e852d3_fields, 9, 72, UINT64_C(0x0), nullptr, UINT64_C(0xa0216f9757e852d3), 3 };
+TypeInfo * __type_info__ded1e2f7e487a25d_arg_types_var_11538907891082331603[2] = { &__type_info__c787ab118c5ce3d6, &__type_info__af819b4c86347819 };
+VarInfo __struct_info__a0226f9757ea05d3_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__ded1e2f7e487a25d_arg_types_var_11538907891082331603, __type_info__657f501a6d16ff5d_arg_names_var_11536937566244577491, 2, 0, nullptr, 12, 8, UINT64_C(0xded1e2f7e487a25d), "__lambda", 0, 0 };
+TypeInfo * __type_info__b59d3f7d01337cd1_arg_types_var_11538907891082331603[1] = { &__type_info__c6928a871af93fe8 };
+VarInfo __struct_info__a0226f9757ea05d3_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__b59d3f7d01337cd1_arg_types_var_11538907891082331603, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0xb59d3f7d01337cd1), "__finalize", 8, 0 };
+VarInfo __struct_info__a0226f9757ea05d3_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xa77bbeadca641c84), "__yield", 16, 0 };
+VarInfo __struct_info__a0226f9757ea05d3_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__127867058dcc8f13, nullptr, (TypeInfo **)__type_info__3db355bab12f05bc_arg_types_var_14712423968180025719, __type_info__ec2dc59d7aff95c0_arg_names_var_11536937566244577491, 1, 0, nullptr, 24576, 8, UINT64_C(0x7592374c7fe51cc0), "blk", 24, 4 };
+VarInfo __struct_info__a0226f9757ea05d3_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__86e65058575787a, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xafa2554cb178c6ba), "src", 32, 6 };
+VarInfo __struct_info__a0226f9757ea05d3_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x8e1d6c25597fac0b), "_loop_at_47_12", 40, 0 };
+VarInfo __struct_info__a0226f9757ea05d3_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__86e65058575787a, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xd12ea11e5495adc6), "_source_0_at_47_12", 48, 8 };
+VarInfo __struct_info__a0226f9757ea05d3_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xbdb532106266a5a7), "__w_rename_at_47_17", 56, 0 };
+VarInfo __struct_info__a0226f9757ea05d3_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x5f2da08a9e27d44c), "_pvar_0_at_47_12", 64, 9 };
+VarInfo * __struct_info__a0226f9757ea05d3_fields[9] =  { &__struct_info__a0226f9757ea05d3_field_0, &__struct_info__a0226f9757ea05d3_field_1, &__struct_info__a0226f9757ea05d3_field_2, &__struct_info__a0226f9757ea05d3_field_3, &__struct_info__a0226f9757ea05d3_field_4, &__struct_info__a0226f9757ea05d3_field_5, &__struct_info__a0226f9757ea05d3_field_6, &__struct_info__a0226f9757ea05d3_field_7, &__struct_info__a0226f9757ea05d3_field_8 };
+StructInfo __struct_info__a0226f9757ea05d3 = {"_lambda_thismodule_46_29", "", 14, __struct_info__a0226f9757ea05d3_fields, 9, 72, UINT64_C(0x0), nullptr, UINT64_C(0xa0226f9757ea05d3), 3 };
+TypeInfo * __type_info__a8ca4371b6296166_arg_types_var_11536936466732949280[2] = { &__type_info__df552d11a0961593, &__type_info__af8a9b4c8643c319 };
+VarInfo __struct_info__a01b6e9757de1f20_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__a8ca4371b6296166_arg_types_var_11536936466732949280, __type_info__657f501a6d16ff5d_arg_names_var_11536937566244577491, 2, 0, nullptr, 12, 8, UINT64_C(0xa8ca4371b6296166), "__lambda", 0, 0 };
+TypeInfo * __type_info__d6356e02fcc27e70_arg_types_var_11536936466732949280[1] = { &__type_info__19c6e15b3318338f };
+VarInfo __struct_info__a01b6e9757de1f20_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__d6356e02fcc27e70_arg_types_var_11536936466732949280, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0xd6356e02fcc27e70), "__finalize", 8, 0 };
+VarInfo __struct_info__a01b6e9757de1f20_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xd295d3ea98434385), "__yield", 16, 0 };
+VarInfo __struct_info__a01b6e9757de1f20_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__127167058dc0aa13, nullptr, (TypeInfo **)__type_info__1b85ab1bc74d8a40_arg_types_var_1691223291737568851, __type_info__ec2dc59d7aff95c0_arg_names_var_11536937566244577491, 1, 0, nullptr, 24576, 8, UINT64_C(0xd0d517b618fc2489), "blk", 24, 4 };
+VarInfo __struct_info__a01b6e9757de1f20_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__2767db6168f4baa4, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x40511b644a74357), "src", 32, 6 };
+VarInfo __struct_info__a01b6e9757de1f20_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x4de4c15fd8275a9e), "_loop_at_47_12", 40, 0 };
+VarInfo __struct_info__a01b6e9757de1f20_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__2767db6168f4baa4, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xa0d9f5996d22a7db), "_source_0_at_47_12", 48, 7 };
+VarInfo __struct_info__a01b6e9757de1f20_field_7 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x27046cf7535558b2), "__w_rename_at_47_17", 56, 8 };
+VarInfo __struct_info__a01b6e9757de1f20_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xcd37b96a9c83e887), "_pvar_0_at_47_12", 80, 9 };
+VarInfo * __struct_info__a01b6e9757de1f20_fields[9] =  { &__struct_info__a01b6e9757de1f20_field_0, &__struct_info__a01b6e9757de1f20_field_1, &__struct_info__a01b6e9757de1f20_field_2, &__struct_info__a01b6e9757de1f20_field_3, &__struct_info__a01b6e9757de1f20_field_4, &__struct_info__a01b6e9757de1f20_field_5, &__struct_info__a01b6e9757de1f20_field_6, &__struct_info__a01b6e9757de1f20_field_7, &__struct_info__a01b6e9757de1f20_field_8 };
+StructInfo __struct_info__a01b6e9757de1f20 = {"_lambda_thismodule_46_36", "", 30, __struct_info__a01b6e9757de1f20_fields, 9, 88, UINT64_C(0x0), nullptr, UINT64_C(0xa01b6e9757de1f20), 3 };
+TypeInfo * __type_info__71f77f165f58a5cb_arg_types_var_14196171283782181065[2] = { &__type_info__c7ec48c6dd149d10, &__type_info__124e1c04d9af11ea };
+const char * __type_info__71f77f165f58a5cb_arg_names_var_14196171283782181065[2] = { "__this", "_yield_57" };
+VarInfo __struct_info__c502ee916c7020c9_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__71f77f165f58a5cb_arg_types_var_14196171283782181065, __type_info__71f77f165f58a5cb_arg_names_var_14196171283782181065, 2, 0, nullptr, 12, 8, UINT64_C(0x71f77f165f58a5cb), "__lambda", 0, 0 };
+TypeInfo * __type_info__a63b8c98f195b8af_arg_types_var_14196171283782181065[1] = { &__type_info__6e9ab4292470434e };
+VarInfo __struct_info__c502ee916c7020c9_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__a63b8c98f195b8af_arg_types_var_14196171283782181065, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0xa63b8c98f195b8af), "__finalize", 8, 0 };
+VarInfo __struct_info__c502ee916c7020c9_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x68e0f429cd26976a), "__yield", 16, 0 };
+VarInfo __struct_info__c502ee916c7020c9_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__22c94753154cc4b9, nullptr, (TypeInfo **)__type_info__1b85ab1bc74d8a40_arg_types_var_1691223291737568851, __type_info__ec2dc59d7aff95c0_arg_names_var_11536937566244577491, 1, 0, nullptr, 24576, 8, UINT64_C(0xcd704ebc76627fa2), "blk", 24, 4 };
+VarInfo __struct_info__c502ee916c7020c9_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b4fe6a6a4374785e, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x77040bca7daaed8), "src", 32, 6 };
+VarInfo __struct_info__c502ee916c7020c9_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x3aafdae48580f912), "_loop_at_58_12", 40, 0 };
+VarInfo __struct_info__c502ee916c7020c9_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b4fe6a6a4374785e, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xf73ec1a991f5b71b), "_source_0_at_58_12", 48, 7 };
+VarInfo __struct_info__c502ee916c7020c9_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2767db6168f4baa4, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x4ad424510610f7be), "__w_rename_at_58_17", 56, 8 };
+VarInfo __struct_info__c502ee916c7020c9_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x8204740b0f1b4605), "_pvar_0_at_58_12", 64, 9 };
+VarInfo * __struct_info__c502ee916c7020c9_fields[9] =  { &__struct_info__c502ee916c7020c9_field_0, &__struct_info__c502ee916c7020c9_field_1, &__struct_info__c502ee916c7020c9_field_2, &__struct_info__c502ee916c7020c9_field_3, &__struct_info__c502ee916c7020c9_field_4, &__struct_info__c502ee916c7020c9_field_5, &__struct_info__c502ee916c7020c9_field_6, &__struct_info__c502ee916c7020c9_field_7, &__struct_info__c502ee916c7020c9_field_8 };
+StructInfo __struct_info__c502ee916c7020c9 = {"_lambda_thismodule_57_34", "", 14, __struct_info__c502ee916c7020c9_fields, 9, 72, UINT64_C(0x0), nullptr, UINT64_C(0xc502ee916c7020c9), 3 };
+TypeInfo * __type_info__abe8b72defcbdc70_arg_types_var_13919220752751431575[2] = { &__type_info__78bc10cdda8c1b0c, &__type_info__dc0fb9d6ab9c1b67 };
+const char * __type_info__abe8b72defcbdc70_arg_names_var_13919220752751431575[2] = { "__this", "_ryield74" };
+VarInfo __struct_info__c12b018705fe8f97_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__abe8b72defcbdc70_arg_types_var_13919220752751431575, __type_info__abe8b72defcbdc70_arg_names_var_13919220752751431575, 2, 0, nullptr, 12, 8, UINT64_C(0xabe8b72defcbdc70), "__lambda", 0, 0 };
+TypeInfo * __type_info__dcb9848835d806f1_arg_types_var_13919220752751431575[1] = { &__type_info__32f09144a68a3a3b };
+VarInfo __struct_info__c12b018705fe8f97_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__dcb9848835d806f1_arg_types_var_13919220752751431575, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0xdcb9848835d806f1), "__finalize", 8, 0 };
+VarInfo __struct_info__c12b018705fe8f97_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xeed8b406fada676b), "__yield", 16, 0 };
+VarInfo __struct_info__c12b018705fe8f97_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xa661a18d70b280e1), "_loop_at_74_31", 20, 0 };
+VarInfo __struct_info__c12b018705fe8f97_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x22ff79faa065b128), "__x_rename_at_74_35", 24, 0 };
+VarInfo __struct_info__c12b018705fe8f97_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x31d80be5ad1fb470), "_pvar_0_at_74_31", 32, 6 };
+VarInfo __struct_info__c12b018705fe8f97_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xd58c9b4cb96ebaea), "_source_0_at_74_31", 40, 7 };
+VarInfo * __struct_info__c12b018705fe8f97_fields[7] =  { &__struct_info__c12b018705fe8f97_field_0, &__struct_info__c12b018705fe8f97_field_1, &__struct_info__c12b018705fe8f97_field_2, &__struct_info__c12b018705fe8f97_field_3, &__struct_info__c12b018705fe8f97_field_4, &__struct_info__c12b018705fe8f97_field_5, &__struct_info__c12b018705fe8f97_field_6 };
+StructInfo __struct_info__c12b018705fe8f97 = {"_lambda_thismodule_74_4", "", 14, __struct_info__c12b018705fe8f97_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0xc12b018705fe8f97), 5 };
+TypeInfo * __type_info__68dfae703df2aba2_arg_types_var_11020858604681908700[2] = { &__type_info__66c99d800e6bf82b, &__type_info__124e1c04d9af11ea };
+const char * __type_info__68dfae703df2aba2_arg_names_var_11020858604681908700[2] = { "__this", "_yield_80" };
+VarInfo __struct_info__98f1f4828bdf51dc_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__68dfae703df2aba2_arg_types_var_11020858604681908700, __type_info__68dfae703df2aba2_arg_names_var_11020858604681908700, 2, 0, nullptr, 12, 8, UINT64_C(0x68dfae703df2aba2), "__lambda", 0, 0 };
+TypeInfo * __type_info__657f9a2b84fd9ecc_arg_types_var_11020858604681908700[1] = { &__type_info__fec24b39a85c482b };
+VarInfo __struct_info__98f1f4828bdf51dc_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__657f9a2b84fd9ecc_arg_types_var_11020858604681908700, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0x657f9a2b84fd9ecc), "__finalize", 8, 0 };
+VarInfo __struct_info__98f1f4828bdf51dc_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x68cb7828faf86e71), "__yield", 16, 0 };
+VarInfo __struct_info__98f1f4828bdf51dc_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x2e09446eb8ef73eb), "_loop_at_80_29", 20, 0 };
+VarInfo __struct_info__98f1f4828bdf51dc_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x4c36d46278f6484b), "__x_rename_at_80_33", 24, 0 };
+VarInfo __struct_info__98f1f4828bdf51dc_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x8d1a1a372674369a), "_pvar_0_at_80_29", 32, 6 };
+VarInfo __struct_info__98f1f4828bdf51dc_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x1402550128cd24a6), "_source_0_at_80_29", 40, 7 };
+VarInfo * __struct_info__98f1f4828bdf51dc_fields[7] =  { &__struct_info__98f1f4828bdf51dc_field_0, &__struct_info__98f1f4828bdf51dc_field_1, &__struct_info__98f1f4828bdf51dc_field_2, &__struct_info__98f1f4828bdf51dc_field_3, &__struct_info__98f1f4828bdf51dc_field_4, &__struct_info__98f1f4828bdf51dc_field_5, &__struct_info__98f1f4828bdf51dc_field_6 };
+StructInfo __struct_info__98f1f4828bdf51dc = {"_lambda_thismodule_80_10", "", 14, __struct_info__98f1f4828bdf51dc_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0x98f1f4828bdf51dc), 5 };
+TypeInfo * __type_info__726d8db50c2f2c97_arg_types_var_5318179958431849589[2] = { &__type_info__f52118e4a20d2ff8, &__type_info__af8afe4c86446b52 };
+VarInfo __struct_info__49cdf87ec9ee9c75_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__726d8db50c2f2c97_arg_types_var_5318179958431849589, __type_info__224d825820d515ec_arg_names_var_10132565508284982382, 2, 0, nullptr, 12, 8, UINT64_C(0x726d8db50c2f2c97), "__lambda", 0, 0 };
+TypeInfo * __type_info__dd158a0e72a3840b_arg_types_var_5318179958431849589[1] = { &__type_info__7d64159ecef14dda };
+VarInfo __struct_info__49cdf87ec9ee9c75_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__dd158a0e72a3840b_arg_types_var_5318179958431849589, __type_info__e4b47a7a7a09db86_arg_names_var_10132565508284982382, 1, 0, nullptr, 12, 8, UINT64_C(0xdd158a0e72a3840b), "__finalize", 8, 0 };
+VarInfo * __struct_info__49cdf87ec9ee9c75_fields[2] =  { &__struct_info__49cdf87ec9ee9c75_field_0, &__struct_info__49cdf87ec9ee9c75_field_1 };
+StructInfo __struct_info__49cdf87ec9ee9c75 = {"_lambda_thismodule_95_14", "", 14, __struct_info__49cdf87ec9ee9c75_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0x49cdf87ec9ee9c75), 2 };
+VarInfo __func_info__be0b8a50a2f41b6e_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x9c581507596aad8c), "x", 0, 0 };
+VarInfo __func_info__be0b8a50a2f41b6e_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x9c5435075966fb15), "y", 0, 0 };
+VarInfo * __func_info__be0b8a50a2f41b6e_fields[2] =  { &__func_info__be0b8a50a2f41b6e_field_0, &__func_info__be0b8a50a2f41b6e_field_1 };
+FuncInfo __func_info__be0b8a50a2f41b6e = {"invoke block<(x:int const;y:int const):int const> const", "", __func_info__be0b8a50a2f41b6e_fields, 2, 32, &__type_info__af8afe4c86446b52, nullptr,0,UINT64_C(0xbe0b8a50a2f41b6e), 0x0 };
+VarInfo __func_info__71d90d02ca1165b2_field_0 =  { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__e1d248aa47eb1ea1_arg_types_var_4505535657210871289, nullptr, 2, 0, nullptr, 62, 8, UINT64_C(0xf8b54a8d4b04abdd), "x", 0, 0 };
+VarInfo __func_info__71d90d02ca1165b2_field_1 =  { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__e1d248aa47eb1ea1_arg_types_var_4505535657210871289, nullptr, 2, 0, nullptr, 62, 8, UINT64_C(0xc162f8f42a0e004a), "y", 0, 0 };
+VarInfo * __func_info__71d90d02ca1165b2_fields[2] =  { &__func_info__71d90d02ca1165b2_field_0, &__func_info__71d90d02ca1165b2_field_1 };
+FuncInfo __func_info__71d90d02ca1165b2 = {"invoke block<(x:tuple<int;float> const;y:tuple<int;float> const):tuple<int;float> const> const", "", __func_info__71d90d02ca1165b2_fields, 2, 32, &__type_info__3ffb158eb0ff8a47, nullptr,0,UINT64_C(0x71d90d02ca1165b2), 0x0 };
+TypeInfo __type_info__46c0bf42cd8a4056 = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__e1d248aa47eb1ea1_arg_types_var_4505535657210871289, nullptr, 2, 0, nullptr, 286, 8, UINT64_C(0x46c0bf42cd8a4056) };
+TypeInfo __type_info__8ec3236fc6ca9dc2 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1f1db26455da92b, nullptr, nullptr, nullptr, 0, 0, nullptr, 8461, 8, UINT64_C(0x8ec3236fc6ca9dc2) };
+TypeInfo __type_info__14d70770224fa1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__124e1c04d9af11ea, nullptr, nullptr, nullptr, 0, 0, nullptr, 8461, 8, UINT64_C(0x14d70770224fa1) };
+TypeInfo __type_info__dc0fb9d6ab9c1b67 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af8afe4c86446b52, nullptr, nullptr, nullptr, 0, 0, nullptr, 8461, 8, UINT64_C(0xdc0fb9d6ab9c1b67) };
+TypeInfo __type_info__993385c558408d53 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 41218, 24, UINT64_C(0x993385c558408d53) };
+TypeInfo __type_info__9a819d9c36b75a57 = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__e1d248aa47eb1ea1_arg_types_var_4505535657210871289, nullptr, 2, 0, nullptr, 286, 8, UINT64_C(0x9a819d9c36b75a57) };
+TypeInfo __type_info__b4fe6a6a4374785e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 41218, 24, UINT64_C(0xb4fe6a6a4374785e) };
+TypeInfo __type_info__af819b4c86347819 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 1, UINT64_C(0xaf819b4c86347819) };
+TypeInfo __type_info__af8a9b4c8643c319 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 4, UINT64_C(0xaf8a9b4c8643c319) };
+TypeInfo __type_info__1f1db26455da92b = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__e1d248aa47eb1ea1_arg_types_var_4505535657210871289, nullptr, 2, 0, nullptr, 30, 8, UINT64_C(0x1f1db26455da92b) };
+TypeInfo __type_info__d34517d485f8c8d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6e375377a4ff6e65, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xd34517d485f8c8d) };
+TypeInfo __type_info__fa69b6a0fca20cd4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__31756dae030a5593, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xfa69b6a0fca20cd4) };
+TypeInfo __type_info__5c9badb1bcef5a26 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__981e6fb1d8ca64f9, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x5c9badb1bcef5a26) };
+TypeInfo __type_info__130248089a6af2e3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ba36ea37fc51b46, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x130248089a6af2e3) };
+TypeInfo __type_info__293a3d0b3874fff8 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d4e71a8b28b315f, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x293a3d0b3874fff8) };
+TypeInfo __type_info__b9255614114c162c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__f31ea558214348ca, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xb9255614114c162c) };
+TypeInfo __type_info__127656223eb0672c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__fd50a55829ecc3ca, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x127656223eb0672c) };
+TypeInfo __type_info__12b8585db2de972e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a3654c9a72569ec0, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x12b8585db2de972e) };
+TypeInfo __type_info__104a9062238b16ae = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8d7a5777b8312c71, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x104a9062238b16ae) };
+TypeInfo __type_info__4a4c5f3fe0242733 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bd968195635b17cf, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x4a4c5f3fe0242733) };
+TypeInfo __type_info__7a353f43ac58845a = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e40293a87e6b0765, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x7a353f43ac58845a) };
+TypeInfo __type_info__e73645adebba38b2 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__df3ccba3465e748d, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xe73645adebba38b2) };
+TypeInfo __type_info__abb413d11a395f9 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__f8e5c4a88db2f4a8, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xabb413d11a395f9) };
+TypeInfo __type_info__3c336a173bb4e2e4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d3d64492cafa2233, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x3c336a173bb4e2e4) };
+TypeInfo __type_info__b3df55b8150004b5 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__adb467a23ca603ac, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xb3df55b8150004b5) };
+TypeInfo __type_info__b3ddd3b8150057f8 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__adb468a23ca6055f, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xb3ddd3b8150057f8) };
+TypeInfo __type_info__8c0e33c24426da68 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d8adf10f1316c01e, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x8c0e33c24426da68) };
+TypeInfo __type_info__e7924b558e7fd51a = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2c234aa62187a9a5, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xe7924b558e7fd51a) };
+TypeInfo __type_info__927912335dbbe5d2 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a84052c932b5643d, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x927912335dbbe5d2) };
+TypeInfo __type_info__927792335db39300 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a84050c932b560d7, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x927792335db39300) };
+TypeInfo __type_info__48569549463a1610 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__546ccda1211d29fe, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x48569549463a1610) };
+TypeInfo __type_info__87b559918d89fa10 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__fad3cd88907a57fe, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x87b559918d89fa10) };
+TypeInfo __type_info__57405351ce63bc10 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8e28cdc92b2fb7fe, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x57405351ce63bc10) };
+TypeInfo __type_info__f1932a8b29adc7a4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c78d7c92c5430d9b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xf1932a8b29adc7a4) };
+TypeInfo __type_info__e54db47e311a4133 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b190788d814895cf, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xe54db47e311a4133) };
+TypeInfo __type_info__7caa38dc7ab7561 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9e147b84c0be84e8, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x7caa38dc7ab7561) };
+TypeInfo __type_info__6ced550ca0c56572 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__40351fa10b07fb94, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x6ced550ca0c56572) };
+TypeInfo __type_info__15378a5b2cc470e8 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__df51ab11a09302d6, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x15378a5b2cc470e8) };
+TypeInfo __type_info__1a2c8a55ff79ede8 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__dbebab119dafd9d6, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x1a2c8a55ff79ede8) };
+TypeInfo __type_info__c19d8a8c4843c2e8 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__caedab118f400cd6, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xc19d8a8c4843c2e8) };
+TypeInfo __type_info__c6928a871af93fe8 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c787ab118c5ce3d6, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xc6928a871af93fe8) };
+TypeInfo __type_info__19c6e15b3318338f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__df552d11a0961593, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x19c6e15b3318338f) };
+TypeInfo __type_info__6e9ab4292470434e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c7ec48c6dd149d10, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x6e9ab4292470434e) };
+TypeInfo __type_info__32f09144a68a3a3b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__78bc10cdda8c1b0c, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x32f09144a68a3a3b) };
+TypeInfo __type_info__fec24b39a85c482b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__66c99d800e6bf82b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xfec24b39a85c482b) };
+TypeInfo __type_info__7d64159ecef14dda = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__f52118e4a20d2ff8, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x7d64159ecef14dda) };
+TypeInfo __type_info__5673b06bfec20c2c = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__dbbca5962c1c455f, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x5673b06bfec20c2c) };
+TypeInfo __type_info__124e1c04d9af11ea = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x124e1c04d9af11ea) };
+TypeInfo __type_info__3ffb158eb0ff8a47 = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__e1d248aa47eb1ea1_arg_types_var_4505535657210871289, nullptr, 2, 0, nullptr, 62, 8, UINT64_C(0x3ffb158eb0ff8a47) };
+TypeInfo __type_info__76d45ec5fb9da33c = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40994, 24, UINT64_C(0x76d45ec5fb9da33c) };
+TypeInfo __type_info__9dd4995d0e385a78 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x9dd4995d0e385a78) };
+TypeInfo __type_info__1729724f5b0b8b6b = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40994, 24, UINT64_C(0x1729724f5b0b8b6b) };
+TypeInfo __type_info__faddbd75a1c6e729 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xfaddbd75a1c6e729) };
+TypeInfo __type_info__af81fe4c86352052 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 1, UINT64_C(0xaf81fe4c86352052) };
+TypeInfo __type_info__af8afe4c86446b52 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf8afe4c86446b52) };
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__6e375377a4ff6e65 = { Type::tStructure, &__struct_info__8c9e1aa528b3a46e, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 16, UINT64_C(0x6e375377a4ff6e65) };
+TypeInfo __type_info__31756dae030a5593 = { Type::tStructure, &__struct_info__e313ecb3f58d8e12, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0x31756dae030a5593) };
+TypeInfo __type_info__981e6fb1d8ca64f9 = { Type::tStructure, &__struct_info__8ff4eab8e06f5eac, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 16, UINT64_C(0x981e6fb1d8ca64f9) };
+TypeInfo __type_info__ba36ea37fc51b46 = { Type::tStructure, &__struct_info__f695ebbcb621d45f, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 16, UINT64_C(0xba36ea37fc51b46) };
+TypeInfo __type_info__d4e71a8b28b315f = { Type::tStructure, &__struct_info__f86ce8c1e932a446, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 16, UINT64_C(0xd4e71a8b28b315f) };
+TypeInfo __type_info__f31ea558214348ca = { Type::tStructure, &__struct_info__cc2d07a638503977, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 72, UINT64_C(0xf31ea558214348ca) };
+TypeInfo __type_info__fd50a55829ecc3ca = { Type::tStructure, &__struct_info__cc2a07a6384b2077, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24578, 72, UINT64_C(0xfd50a55829ecc3ca) };
+TypeInfo __type_info__a3654c9a72569ec0 = { Type::tStructure, &__struct_info__a4995aa53d461ca9, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0xa3654c9a72569ec0) };
+TypeInfo __type_info__8d7a5777b8312c71 = { Type::tStructure, &__struct_info__8f38a2a41eb4a614, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 16, UINT64_C(0x8d7a5777b8312c71) };
+TypeInfo __type_info__bd968195635b17cf = { Type::tStructure, &__struct_info__aea41aa545b58f64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 16, UINT64_C(0xbd968195635b17cf) };
+TypeInfo __type_info__e40293a87e6b0765 = { Type::tStructure, &__struct_info__e1d656c1bfeda130, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 16, UINT64_C(0xe40293a87e6b0765) };
+TypeInfo __type_info__df3ccba3465e748d = { Type::tStructure, &__struct_info__7b8c3ebdecf93828, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 16, UINT64_C(0xdf3ccba3465e748d) };
+TypeInfo __type_info__f8e5c4a88db2f4a8 = { Type::tStructure, &__struct_info__e22d45c1c2abb80d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 120, UINT64_C(0xf8e5c4a88db2f4a8) };
+TypeInfo __type_info__d3d64492cafa2233 = { Type::tStructure, &__struct_info__9c0893e7a469e622, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 16, UINT64_C(0xd3d64492cafa2233) };
+TypeInfo __type_info__adb467a23ca603ac = { Type::tStructure, &__struct_info__3e86e0cf12e8fdf9, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 120, UINT64_C(0xadb467a23ca603ac) };
+TypeInfo __type_info__adb468a23ca6055f = { Type::tStructure, &__struct_info__3e86dfcf12e8fc46, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 136, UINT64_C(0xadb468a23ca6055f) };
+TypeInfo __type_info__d8adf10f1316c01e = { Type::tStructure, &__struct_info__17786e9f93e27653, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 88, UINT64_C(0xd8adf10f1316c01e) };
+TypeInfo __type_info__2c234aa62187a9a5 = { Type::tStructure, &__struct_info__4dc98dd45648adb0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 96, UINT64_C(0x2c234aa62187a9a5) };
+TypeInfo __type_info__a84052c932b5643d = { Type::tStructure, &__struct_info__4ade95a822c81448, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 96, UINT64_C(0xa84052c932b5643d) };
+TypeInfo __type_info__a84050c932b560d7 = { Type::tStructure, &__struct_info__4ade97a822c817ae, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 96, UINT64_C(0xa84050c932b560d7) };
+TypeInfo __type_info__546ccda1211d29fe = { Type::tStructure, &__struct_info__8afd1a9ff60d013b, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0x546ccda1211d29fe) };
+TypeInfo __type_info__fad3cd88907a57fe = { Type::tStructure, &__struct_info__a27e1aa009c7153b, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0xfad3cd88907a57fe) };
+TypeInfo __type_info__8e28cdc92b2fb7fe = { Type::tStructure, &__struct_info__6fef1a9fdf2d7f3b, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0x8e28cdc92b2fb7fe) };
+TypeInfo __type_info__c78d7c92c5430d9b = { Type::tStructure, &__struct_info__65fd93e785379222, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0xc78d7c92c5430d9b) };
+TypeInfo __type_info__b190788d814895cf = { Type::tStructure, &__struct_info__986a1aa001537764, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 56, UINT64_C(0xb190788d814895cf) };
+TypeInfo __type_info__9e147b84c0be84e8 = { Type::tStructure, &__struct_info__830494eccf61b0d5, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0x9e147b84c0be84e8) };
+TypeInfo __type_info__40351fa10b07fb94 = { Type::tStructure, &__struct_info__8af95a9ff60c684d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0x40351fa10b07fb94) };
+TypeInfo __type_info__df51ab11a09302d6 = { Type::tStructure, &__struct_info__a01b6f9757de20d3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 72, UINT64_C(0xdf51ab11a09302d6) };
+TypeInfo __type_info__dbebab119dafd9d6 = { Type::tStructure, &__struct_info__a01c6f9757dfd3d3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24578, 72, UINT64_C(0xdbebab119dafd9d6) };
+TypeInfo __type_info__caedab118f400cd6 = { Type::tStructure, &__struct_info__a0216f9757e852d3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24578, 72, UINT64_C(0xcaedab118f400cd6) };
+TypeInfo __type_info__c787ab118c5ce3d6 = { Type::tStructure, &__struct_info__a0226f9757ea05d3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24578, 72, UINT64_C(0xc787ab118c5ce3d6) };
+TypeInfo __type_info__df552d11a0961593 = { Type::tStructure, &__struct_info__a01b6e9757de1f20, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 88, UINT64_C(0xdf552d11a0961593) };
+TypeInfo __type_info__c7ec48c6dd149d10 = { Type::tStructure, &__struct_info__c502ee916c7020c9, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24578, 72, UINT64_C(0xc7ec48c6dd149d10) };
+TypeInfo __type_info__78bc10cdda8c1b0c = { Type::tStructure, &__struct_info__c12b018705fe8f97, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0x78bc10cdda8c1b0c) };
+TypeInfo __type_info__66c99d800e6bf82b = { Type::tStructure, &__struct_info__98f1f4828bdf51dc, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0x66c99d800e6bf82b) };
+TypeInfo __type_info__f52118e4a20d2ff8 = { Type::tStructure, &__struct_info__49cdf87ec9ee9c75, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 16, UINT64_C(0xf52118e4a20d2ff8) };
+TypeInfo __type_info__9c5a3d06af66f104 = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__e1d248aa47eb1ea1_arg_types_var_4505535657210871289, nullptr, 2, 0, nullptr, 30, 8, UINT64_C(0x9c5a3d06af66f104) };
+TypeInfo __type_info__22c94753154cc4b9 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x22c94753154cc4b9) };
+TypeInfo __type_info__127867058dcc8f13 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x127867058dcc8f13) };
+TypeInfo __type_info__127167058dc0aa13 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x127167058dc0aa13) };
+TypeInfo __type_info__c32d69975ef39d8f = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__e1d248aa47eb1ea1_arg_types_var_4505535657210871289, nullptr, 2, 0, nullptr, 30, 8, UINT64_C(0xc32d69975ef39d8f) };
+TypeInfo __type_info__2767db6168f4baa4 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x2767db6168f4baa4) };
+TypeInfo __type_info__86e65058575787a = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x86e65058575787a) };
+TypeInfo __type_info__dbbca5962c1c455f = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xdbbca5962c1c455f) };
+TypeInfo __type_info__bcb97beea857e3e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xbcb97beea857e3e) };
+TypeInfo __type_info__c4e7914a3746eb3e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xc4e7914a3746eb3e) };
+TypeInfo __type_info__a3f0477a4765213e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xa3f0477a4765213e) };
+TypeInfo __type_info__af63df4c8601f1a5 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xaf63df4c8601f1a5) };
+TypeInfo __type_info__af63db4c8601ead9 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63db4c8601ead9) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__bcb97beea857e3e, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_1[2] = { &__type_info__c4e7914a3746eb3e, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_2[2] = { &__type_info__5673b06bfec20c2c, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_4[2] = { &__type_info__a3f0477a4765213e, &__type_info__af90fe4c864e9d52 };
+
+inline void finalize_5c3fa10faeab6f5b ( Context * __context__, _lambda_thismodule_46_36 & ____this_rename_at_46_0 );
+inline bool _Func_lambda_thismodule_46_36Tickfunction_b499ef7f7ef1a851 ( Context * __context__, _lambda_thismodule_46_36 & ____this_rename_at_46_1, int32_t & ___yield_46_rename_at_46_2 );
+inline void _Func_lambda_thismodule_46_36Tickfinalizer_84a9c3600660c442 ( Context * __context__, _lambda_thismodule_46_36 * ____this_rename_at_46_3 );
+inline void finalize_e3ab08cedd375fa ( Context * __context__, _lambda_thismodule_117_35 & ____this_rename_at_117_4 );
+inline int32_t _Func_lambda_thismodule_117_35Tickfunction_4cba99b90ac6a708 ( Context * __context__, _lambda_thismodule_117_35 & ____this_rename_at_117_5, TArray<int32_t> const  & __x_rename_at_117_6 );
+inline void _Func_lambda_thismodule_117_35Tickfinalizer_20c0cf0819a8cef4 ( Context * __context__, _lambda_thismodule_117_35 * ____this_rename_at_117_7 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickmap_anyTick4479995923280306007_5642e543b9d04ef3 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & __src_rename_at_43_8, Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) __blk_rename_at_43_9 );
+inline void _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5 ( Context * __context__, TArray<int32_t> & __a_rename_at_32_10, TArray<int32_t> & __b_rename_at_32_11 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickmapTick3767370688684665805_7dd7ef6681f58a23 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & __src_rename_at_76_12, Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) const  __blk_rename_at_76_13 );
+inline void finalize_935fd2f8295ecce9 ( Context * __context__, _lambda_thismodule_57_34 & ____this_rename_at_57_14 );
+inline TArray<int32_t> _FuncbuiltinTickmove_to_localTick14376033101315213529_a3eb4ebbfa51707 ( Context * __context__, TArray<int32_t> & __a_rename_at_1064_15 );
+inline bool _Func_lambda_thismodule_57_34Tickfunction_8e7015a5e889f99c ( Context * __context__, _lambda_thismodule_57_34 & ____this_rename_at_57_16, TArray<int32_t> & ___yield_57_rename_at_57_17 );
+inline void _Func_lambda_thismodule_57_34Tickfinalizer_37a60b4798f52ebf ( Context * __context__, _lambda_thismodule_57_34 * ____this_rename_at_57_18 );
+inline bool _FuncTickis_sameTick245538717971957847_5920cebe138ff292 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & __a_rename_at_56_19, Sequence DAS_COMMENT((TArray<int32_t>)) & __b_rename_at_56_20 );
+inline void finalize_da055a40908e26 ( Context * __context__, _lambda_thismodule_239_33 & ____this_rename_at_239_25 );
+inline bool _FuncTickis_sameTick245538717971957847_a9c0341708763739 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) & __a_rename_at_56_26, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) & __b_rename_at_56_27 );
+inline void finalize_322b586a61b59695 ( Context * __context__, _lambda_thismodule_239_31 & ____this_rename_at_239_32 );
+inline void finalize_4f7eb10f7e42945c ( Context * __context__, _lambda_thismodule_116_32 & ____this_rename_at_116_33 );
+inline bool _Func_lambda_thismodule_239_33Tickfunction_c893b561a33638e4 ( Context * __context__, _lambda_thismodule_239_33 & ____this_rename_at_239_34, TArray<int32_t> * & ___ryield239_rename_at_239_35 );
+inline void _Func_lambda_thismodule_239_33Tickfinalizer_a4e5d7e39be05c5d ( Context * __context__, _lambda_thismodule_239_33 * ____this_rename_at_239_36 );
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_fa51d566d7dfd53e ( Context * __context__, TArray<TArray<int32_t>> & __a_rename_at_1336_37 );
+inline bool _Func_lambda_thismodule_239_31Tickfunction_bfb87e4067b2a8d8 ( Context * __context__, _lambda_thismodule_239_31 & ____this_rename_at_239_39, TTuple<8,int32_t,float> * & ___ryield239_rename_at_239_40 );
+inline void _Func_lambda_thismodule_239_31Tickfinalizer_58d02024b348deca ( Context * __context__, _lambda_thismodule_239_31 * ____this_rename_at_239_41 );
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_81327841969947fa ( Context * __context__, TArray<TTuple<8,int32_t,float>> & __a_rename_at_1336_42 );
+inline TArray<int32_t> _Func_lambda_thismodule_116_32Tickfunction_fb95bbf9fac8f359 ( Context * __context__, _lambda_thismodule_116_32 & ____this_rename_at_116_44, TArray<int32_t> const  & __x_rename_at_116_45 );
+inline void _Func_lambda_thismodule_116_32Tickfinalizer_4f9418ced39b6d4a ( Context * __context__, _lambda_thismodule_116_32 * ____this_rename_at_116_46 );
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _FuncfunctionalTickmap_anyTick4479995923280306007_7911bf7d28600067 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & __src_rename_at_43_47, Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) __blk_rename_at_43_48 );
+inline void _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__, TArray<int32_t> & __a_rename_at_1142_49, TArray<int32_t> const  & __b_rename_at_1142_50 );
+inline int32_t _FuncTickfirstTick947304547137840980_5c6792106670b351 ( Context * __context__, TTuple<8,int32_t,float> const  & __x_rename_at_36_52 );
+inline TTuple<8,int32_t,float> _FuncfunctionalTickreduce_anyTick10888502122296883119_349cc66090f1ae3b ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) & __it_rename_at_88_53, Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  & __functor_rename_at_88_54 );
+inline void finalize_5cef76514cdcd502 ( Context * __context__, TTuple<8,int32_t,float> & ____this_rename_at_213_58 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _FuncbuiltinTickeachTick6002865651812066953_79ce88e42c3e3433 ( Context * __context__, TArray<TArray<int32_t>> const  & __a_rename_at_1427_59 );
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd ( Context * __context__, TArray<int32_t> & __a_rename_at_1336_61 );
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _FuncfunctionalTickmapTick3767370688684665805_afc82126cea94d6e ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & __src_rename_at_76_62, Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) const  __blk_rename_at_76_63 );
+inline bool _FuncfunctionalTicknotTick15126137237442268133_5718a646ccd351d7 ( Context * __context__, bool __x_rename_at_288_64 );
+inline void finalize_7980aaa0c8ca61d4 ( Context * __context__, _lambda_thismodule_21_30 & ____this_rename_at_21_65 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _FuncbuiltinTickeachTick6002865651812066953_e372b165824f649d ( Context * __context__, TArray<TTuple<8,int32_t,float>> const  & __a_rename_at_1427_66 );
+inline TTuple<8,int32_t,float> _FuncfunctionalTickreduceTick3841530652084879893_a9fc9323110bc9fc ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) & __it_rename_at_125_68, Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  & __blk_rename_at_125_69 );
+inline bool _FuncfunctionalTickanyTick3860067047720393563_f5b4a194f258ddd0 ( Context * __context__, Sequence DAS_COMMENT((bool)) & __it_rename_at_158_70 );
+inline bool _FuncfunctionalTickallTick13174627742298730649_9c3f2431cb8402f6 ( Context * __context__, Sequence DAS_COMMENT((bool)) & __it_rename_at_184_72 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _FuncfunctionalTickisliceTick565469751076799399_bdd25b8f8cc2dbf5 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & __src_rename_at_227_74, int32_t __start_rename_at_227_75, int32_t __stop_rename_at_227_76 );
+inline void finalize_cdfff6625092eae1 ( Context * __context__, _lambda_thismodule_211_25 & ____this_rename_at_211_77 );
+inline void finalize_3dcae5fa4b700dd5 ( Context * __context__, _lambda_thismodule_46_26 & ____this_rename_at_46_78 );
+inline void finalize_ce54b4b3dece547c ( Context * __context__, _lambda_thismodule_46_27 & ____this_rename_at_46_79 );
+inline void finalize_cb863a01181cc563 ( Context * __context__, _lambda_thismodule_46_28 & ____this_rename_at_46_80 );
+inline void finalize_eb39c4fa0e0aa9cb ( Context * __context__, _lambda_thismodule_46_29 & ____this_rename_at_46_81 );
+inline bool _Func_lambda_thismodule_21_30Tickfunction_124aecd4e54968e6 ( Context * __context__, _lambda_thismodule_21_30 & ____this_rename_at_21_82, TArray<int32_t> * & ___ryield21_rename_at_21_83 );
+inline void _Func_lambda_thismodule_21_30Tickfinalizer_f192f22a0f696612 ( Context * __context__, _lambda_thismodule_21_30 * ____this_rename_at_21_84 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _FuncbuiltinTickeach_refTick16137060296763333387_61841c1791c9b95f ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t> * &)) const  __lam_rename_at_1453_85 );
+inline Sequence DAS_COMMENT((bool)) _FuncbuiltinTickeachTick9663565701927713696_c6a9cdebae4e9e7f ( Context * __context__, Lambda DAS_COMMENT((bool,bool &)) const  __lam_rename_at_1443_87 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _FuncfunctionalTickisliceTick565469751076799399_f12d6c00813f9d8c ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) & __src_rename_at_227_89, int32_t __start_rename_at_227_90, int32_t __stop_rename_at_227_91 );
+inline void finalize_81b7faa9db9b97fa ( Context * __context__, _lambda_thismodule_211_24 & ____this_rename_at_211_92 );
+inline Sequence DAS_COMMENT((int32_t &)) _FuncbuiltinTickeachTick6002865651812066953_693fb4484d509206 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_1427_93 );
+inline void _FuncbuiltinTickpush_cloneTick2035469273396957942_3c23be799e74aa72 ( Context * __context__, TArray<TArray<int32_t>> & __Arr_rename_at_393_95, TArray<int32_t> & __value_rename_at_393_96 );
+inline bool _Func_lambda_thismodule_211_25Tickfunction_b51aa010f6a4cd23 ( Context * __context__, _lambda_thismodule_211_25 & ____this_rename_at_211_97, TArray<int32_t> * & ___ryield211_rename_at_211_98 );
+inline void _Func_lambda_thismodule_211_25Tickfinalizer_9448301fe12bf62 ( Context * __context__, _lambda_thismodule_211_25 * ____this_rename_at_211_99 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _FuncbuiltinTickeach_refTick16137060296763333387_7462031b9a3d3d2e ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float> * &)) const  __lam_rename_at_1453_100 );
+inline bool _Func_lambda_thismodule_46_26Tickfunction_55d29a7714c3b148 ( Context * __context__, _lambda_thismodule_46_26 & ____this_rename_at_46_102, int32_t & ___yield_46_rename_at_46_103 );
+inline void _Func_lambda_thismodule_46_26Tickfinalizer_3eae0ef5553264f8 ( Context * __context__, _lambda_thismodule_46_26 * ____this_rename_at_46_104 );
+inline bool _Func_lambda_thismodule_46_27Tickfunction_bb17341466c4aa51 ( Context * __context__, _lambda_thismodule_46_27 & ____this_rename_at_46_105, int32_t & ___yield_46_rename_at_46_106 );
+inline void _Func_lambda_thismodule_46_27Tickfinalizer_47b44357a235464e ( Context * __context__, _lambda_thismodule_46_27 * ____this_rename_at_46_107 );
+inline TTuple<8,int32_t,float> _FuncbuiltinTickcopy_to_localTick18007282088148548588_cf5b4d36c641ec89 ( Context * __context__, TTuple<8,int32_t,float> const  & __a_rename_at_1055_108 );
+inline bool _Func_lambda_thismodule_46_28Tickfunction_4b6a017341fe0abc ( Context * __context__, _lambda_thismodule_46_28 & ____this_rename_at_46_109, TTuple<8,int32_t,float> & ___yield_46_rename_at_46_110 );
+inline void _Func_lambda_thismodule_46_28Tickfinalizer_1e6b86880ccb6112 ( Context * __context__, _lambda_thismodule_46_28 * ____this_rename_at_46_111 );
+inline bool _Func_lambda_thismodule_46_29Tickfunction_c76a3c5f83d93d5e ( Context * __context__, _lambda_thismodule_46_29 & ____this_rename_at_46_112, bool & ___yield_46_rename_at_46_113 );
+inline void _Func_lambda_thismodule_46_29Tickfinalizer_ca4e9b0da58741b3 ( Context * __context__, _lambda_thismodule_46_29 * ____this_rename_at_46_114 );
+inline void _FuncTickverify_evenTick14539409462116012840_a41975d7eea83c28 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __iter_rename_at_30_115 );
+inline bool _FuncTickis_sameTick245538717971957847_90778dcd8fe04dee ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __a_rename_at_56_120, Sequence DAS_COMMENT((int32_t)) & __b_rename_at_56_121 );
+inline void finalize_62288b18c551cda5 ( Context * __context__, _lambda_thismodule_12_21 & ____this_rename_at_12_126 );
+inline void finalize_c1432cdb99d257fc ( Context * __context__, _lambda_thismodule_12_22 & ____this_rename_at_12_127 );
+inline void finalize_7e876d36e44179ae ( Context * __context__, _lambda_thismodule_115_23 & ____this_rename_at_115_128 );
+inline void _FuncbuiltinTickpush_cloneTick2035469273396957942_b74d0b46559deb03 ( Context * __context__, TArray<TTuple<8,int32_t,float>> & __Arr_rename_at_393_129, TTuple<8,int32_t,float> & __value_rename_at_393_130 );
+inline bool _Func_lambda_thismodule_211_24Tickfunction_1529e8e196031a1 ( Context * __context__, _lambda_thismodule_211_24 & ____this_rename_at_211_131, TTuple<8,int32_t,float> * & ___ryield211_rename_at_211_132 );
+inline void _Func_lambda_thismodule_211_24Tickfinalizer_438ffbc0f98e4f24 ( Context * __context__, _lambda_thismodule_211_24 * ____this_rename_at_211_133 );
+inline void finalize_42bcf1754d30f3e6 ( Context * __context__, _lambda_thismodule_197_20 & ____this_rename_at_197_134 );
+inline bool _Func_lambda_thismodule_12_21Tickfunction_dc6a1502d70a914b ( Context * __context__, _lambda_thismodule_12_21 & ____this_rename_at_12_135, int32_t & ___yield_12_rename_at_12_136 );
+inline void _Func_lambda_thismodule_12_21Tickfinalizer_b47553da6da1d917 ( Context * __context__, _lambda_thismodule_12_21 * ____this_rename_at_12_137 );
+inline bool _Func_lambda_thismodule_12_22Tickfunction_8e677566a24aefee ( Context * __context__, _lambda_thismodule_12_22 & ____this_rename_at_12_138, int32_t & ___yield_12_rename_at_12_139 );
+inline void _Func_lambda_thismodule_12_22Tickfinalizer_c78986e767b672d2 ( Context * __context__, _lambda_thismodule_12_22 * ____this_rename_at_12_140 );
+inline bool _Func_lambda_thismodule_115_23Tickfunction_e14f1bfe624fc6d6 ( Context * __context__, _lambda_thismodule_115_23 & ____this_rename_at_115_141, TArray<int32_t> const  & __x_rename_at_115_142 );
+inline void _Func_lambda_thismodule_115_23Tickfinalizer_dbec80ebd1dc3ee7 ( Context * __context__, _lambda_thismodule_115_23 * ____this_rename_at_115_143 );
+inline void finalize_b3040909745498b4 ( Context * __context__, _lambda_thismodule_230_19 & ____this_rename_at_230_144 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _FuncfunctionalTickfilter_anyTick8436123068441528563_ae7e887ff20f69cc ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & __src_rename_at_9_145, Lambda DAS_COMMENT((bool,TArray<int32_t> const )) __blk_rename_at_9_146 );
+inline void _FuncbuiltinTickpushTick10769833213962245646_b2287abd57a15f1f ( Context * __context__, TArray<int32_t> & __Arr_rename_at_193_147, int32_t __value_rename_at_193_148 );
+inline bool _Func_lambda_thismodule_197_20Tickfunction_eee30c808afe7a78 ( Context * __context__, _lambda_thismodule_197_20 & ____this_rename_at_197_149, int32_t & ___yield_197_rename_at_197_150 );
+inline void _Func_lambda_thismodule_197_20Tickfinalizer_25873a1f018a00f7 ( Context * __context__, _lambda_thismodule_197_20 * ____this_rename_at_197_151 );
+inline void finalize_89df3979aba5e810 ( Context * __context__, _lambda_thismodule_95_14 & ____this_rename_at_95_152 );
+inline int32_t _FuncfunctionalTickreduce_anyTick10888502122296883119_91f3953a535f4618 ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) & __it_rename_at_88_153, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  & __functor_rename_at_88_154 );
+inline void finalize_bad70fc7c4a20b23 ( Context * __context__, _lambda_thismodule_139_15 & ____this_rename_at_139_158 );
+inline void finalize_66d38afb2a354c1 ( Context * __context__, _lambda_thismodule_187_16 & ____this_rename_at_187_159 );
+inline void finalize_7c209bed83355de7 ( Context * __context__, _lambda_thismodule_196_17 & ____this_rename_at_196_160 );
+inline void finalize_598a8a4cb50aa870 ( Context * __context__, _lambda_thismodule_204_18 & ____this_rename_at_204_161 );
+inline void _FuncbuiltinTickpush_cloneTick2035469273396957942_c2961e1e4b6c33a6 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_393_162, int32_t __value_rename_at_393_163 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_68_164, int32_t __newSize_rename_at_68_165 );
+inline bool _Func_lambda_thismodule_230_19Tickfunction_b9e2ca9378874572 ( Context * __context__, _lambda_thismodule_230_19 & ____this_rename_at_230_166, int32_t & ___yield_230_rename_at_230_167 );
+inline void _Func_lambda_thismodule_230_19Tickfinalizer_f638c8ae7033c789 ( Context * __context__, _lambda_thismodule_230_19 * ____this_rename_at_230_168 );
+inline void _FuncTickverify_14Tick7691774253321735872_558fc829306e5cd4 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & __t_rename_at_65_169 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _FuncfunctionalTickfilterTick17052258911568430960_b5ac07160cdff423 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & __src_rename_at_32_174, Lambda DAS_COMMENT((bool,TArray<int32_t> const )) const  __blk_rename_at_32_175 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _FuncfunctionalTickcycleTick13989071893922639452_e88690305df5dba6 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & __src_rename_at_194_176 );
+inline void finalize_f644eb195de1df44 ( Context * __context__, _lambda_thismodule_80_10 & ____this_rename_at_80_177 );
+inline void finalize_f1103f2c3f9d49da ( Context * __context__, _lambda_thismodule_114_11 & ____this_rename_at_114_178 );
+inline void finalize_612f25fea13eacd7 ( Context * __context__, _lambda_thismodule_264_12 & ____this_rename_at_264_179 );
+inline void finalize_28116c91cb7e7e32 ( Context * __context__, _lambda_thismodule_267_13 & ____this_rename_at_267_180 );
+inline void _FuncTickverify_evenTick14539409462116012840_247cf6e92f558dd ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) & __iter_rename_at_30_181 );
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _FuncbuiltinTickeachTick9663565701927713696_f0f9ca53bb972a42 ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t>)) const  __lam_rename_at_1443_186 );
+inline bool _Func_lambda_thismodule_95_14Tickfunction_41f4c7be3e839885 ( Context * __context__, _lambda_thismodule_95_14 & ____this_rename_at_95_188, int32_t __x_rename_at_95_189 );
+inline void _Func_lambda_thismodule_95_14Tickfinalizer_221f3b5c59b2f23e ( Context * __context__, _lambda_thismodule_95_14 * ____this_rename_at_95_190 );
+inline int32_t _FuncfunctionalTickreduceTick3841530652084879893_b6f97e92cc2dae31 ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) & __it_rename_at_125_191, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  & __blk_rename_at_125_192 );
+inline int32_t _Func_lambda_thismodule_139_15Tickfunction_e5004b4a611d1a05 ( Context * __context__, _lambda_thismodule_139_15 & ____this_rename_at_139_193, int32_t __x_rename_at_139_194, int32_t __y_rename_at_139_195 );
+inline void _Func_lambda_thismodule_139_15Tickfinalizer_e90829968738666b ( Context * __context__, _lambda_thismodule_139_15 * ____this_rename_at_139_196 );
+inline bool _Func_lambda_thismodule_187_16Tickfunction_d1e0f62285a7694a ( Context * __context__, _lambda_thismodule_187_16 & ____this_rename_at_187_197, int32_t __x_rename_at_187_198 );
+inline void _Func_lambda_thismodule_187_16Tickfinalizer_c0e055b2452d95a3 ( Context * __context__, _lambda_thismodule_187_16 * ____this_rename_at_187_199 );
+inline bool _Func_lambda_thismodule_196_17Tickfunction_84aa853197614018 ( Context * __context__, _lambda_thismodule_196_17 & ____this_rename_at_196_200, int32_t __x_rename_at_196_201 );
+inline void _Func_lambda_thismodule_196_17Tickfinalizer_c5e37037ab3a54f8 ( Context * __context__, _lambda_thismodule_196_17 * ____this_rename_at_196_202 );
+inline bool _Func_lambda_thismodule_204_18Tickfunction_4718dbf6cf74bea9 ( Context * __context__, _lambda_thismodule_204_18 & ____this_rename_at_204_203, int32_t __x_rename_at_204_204 );
+inline void _Func_lambda_thismodule_204_18Tickfinalizer_123173ed11fd8cc9 ( Context * __context__, _lambda_thismodule_204_18 * ____this_rename_at_204_205 );
+inline TArray<int32_t> _FuncbuiltinTickto_arrayTick9505582033551971916_e5f10801382c0f4 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __it_rename_at_1477_206 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _FuncfunctionalTickcycleTick13989071893922639452_18378972141a1c5 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) & __src_rename_at_194_209 );
+inline void finalize_cb36ba2e25782d6b ( Context * __context__, _lambda_thismodule_265_3 & ____this_rename_at_265_210 );
+inline void finalize_62b17dfd9f1d0712 ( Context * __context__, _lambda_thismodule_74_4 & ____this_rename_at_74_211 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickfilter_anyTick8436123068441528563_cf9abcab74536fb8 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_9_212, Func DAS_COMMENT((bool,int32_t)) __blk_rename_at_9_213 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickfilter_anyTick8436123068441528563_da357379b896e3f5 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_9_214, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_9_215 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickmap_anyTick4479995923280306007_6024d756272a5506 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_43_216, Func DAS_COMMENT((int32_t,int32_t)) __blk_rename_at_43_217 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickmap_anyTick4479995923280306007_83291c8f47dbbb44 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_43_218, Lambda DAS_COMMENT((int32_t,int32_t)) __blk_rename_at_43_219 );
+inline int32_t _FuncfunctionalTickreduce_anyTick10888502122296883119_8b35df0f139e9bed ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __it_rename_at_88_220, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  & __functor_rename_at_88_221 );
+inline void finalize_a279035facdd537 ( Context * __context__, _lambda_thismodule_130_5 & ____this_rename_at_130_225 );
+inline int32_t _FuncfunctionalTickreduce_anyTick10888502122296883119_d6c8298b3db4c09d ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __it_rename_at_88_226, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  __functor_rename_at_88_227 );
+inline int32_t _FuncfunctionalTickreduce_anyTick10888502122296883119_616d986e179b8b90 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __it_rename_at_88_231, Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  __functor_rename_at_88_232 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _FuncfunctionalTickmap_anyTick4479995923280306007_c7dd7fda4ce435b2 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_43_236, Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) __blk_rename_at_43_237 );
+inline Sequence DAS_COMMENT((bool)) _FuncfunctionalTickmap_anyTick4479995923280306007_1ca21edec6aad716 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_43_238, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_43_239 );
+inline void finalize_b0b0293ec1ad9f13 ( Context * __context__, _lambda_thismodule_251_6 & ____this_rename_at_251_240 );
+inline void finalize_31cc77b2547050ca ( Context * __context__, _lambda_thismodule_256_7 & ____this_rename_at_256_241 );
+inline void finalize_6539699a4f0bba06 ( Context * __context__, _lambda_thismodule_259_8 & ____this_rename_at_259_242 );
+inline void finalize_fa5ef013837c31d7 ( Context * __context__, _lambda_thismodule_271_9 & ____this_rename_at_271_243 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickeachTick9663565701927713696_38bf4259f235eb1a ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_1443_244 );
+inline Sequence DAS_COMMENT((int32_t &)) _FuncbuiltinTickeach_refTick16137060296763333387_c02a41a483b3f169 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t const  * &)) const  __lam_rename_at_1453_246 );
+inline bool _Func_lambda_thismodule_80_10Tickfunction_3c937939c9fac98d ( Context * __context__, _lambda_thismodule_80_10 & ____this_rename_at_80_248, TArray<int32_t> & ___yield_80_rename_at_80_249 );
+inline void _Func_lambda_thismodule_80_10Tickfinalizer_305dc02b66553696 ( Context * __context__, _lambda_thismodule_80_10 * ____this_rename_at_80_250 );
+inline void _FuncbuiltinTickemplaceTick13923705686753630697_908411b5f172f3d6 ( Context * __context__, TArray<TArray<int32_t>> & __Arr_rename_at_301_251, TArray<int32_t> & __value_rename_at_301_252 );
+inline void _FuncTickverify_14Tick7691774253321735872_210d806253f397db ( Context * __context__, TArray<TArray<int32_t>> & __t_rename_at_65_253 );
+inline bool _Func_lambda_thismodule_114_11Tickfunction_6bd9593925568168 ( Context * __context__, _lambda_thismodule_114_11 & ____this_rename_at_114_258, TArray<int32_t> & ___yield_114_rename_at_114_259 );
+inline void _Func_lambda_thismodule_114_11Tickfinalizer_a5b4847c5ce5a138 ( Context * __context__, _lambda_thismodule_114_11 * ____this_rename_at_114_260 );
+inline TArray<int32_t> & _FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 ( Context * __context__, TArray<int32_t> & __a_rename_at_50_261 );
+inline bool _FuncfunctionalTickis_equalTick13663318146853733238_ab1cff754c041ab7 ( Context * __context__, int32_t __a_rename_at_278_262, int32_t __b_rename_at_278_263 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _FuncbuiltinTickeachTick9663565701927713696_403560d62bbc8525 ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float>)) const  __lam_rename_at_1443_264 );
+inline bool _Func_lambda_thismodule_264_12Tickfunction_54c8b26adfbe6824 ( Context * __context__, _lambda_thismodule_264_12 & ____this_rename_at_264_266, TArray<int32_t> & ___yield_264_rename_at_264_267 );
+inline void _Func_lambda_thismodule_264_12Tickfinalizer_70bc360bf5cc37dc ( Context * __context__, _lambda_thismodule_264_12 * ____this_rename_at_264_268 );
+inline bool _Func_lambda_thismodule_267_13Tickfunction_2a097cd137ff1ae1 ( Context * __context__, _lambda_thismodule_267_13 & ____this_rename_at_267_269, TArray<int32_t> & ___yield_267_rename_at_267_270 );
+inline void _Func_lambda_thismodule_267_13Tickfinalizer_59ec7061b5053592 ( Context * __context__, _lambda_thismodule_267_13 * ____this_rename_at_267_271 );
+inline void finalize_b86adca48494f93d ( Context * __context__, _lambda_thismodule_109_1 & ____this_rename_at_109_272 );
+inline void finalize_b0cb4b9f8708f3b3 ( Context * __context__, _lambda_thismodule_163_2 & ____this_rename_at_163_273 );
+inline bool _Func_lambda_thismodule_265_3Tickfunction_2781a4c515b28b11 ( Context * __context__, _lambda_thismodule_265_3 & ____this_rename_at_265_274, int32_t & ___yield_265_rename_at_265_275 );
+inline void _Func_lambda_thismodule_265_3Tickfinalizer_bb465553714d8a66 ( Context * __context__, _lambda_thismodule_265_3 * ____this_rename_at_265_276 );
+inline bool _Func_lambda_thismodule_74_4Tickfunction_a153f2b76711af8f ( Context * __context__, _lambda_thismodule_74_4 & ____this_rename_at_74_277, int32_t const  * & ___ryield74_rename_at_74_278 );
+inline void _Func_lambda_thismodule_74_4Tickfinalizer_afac0294c48ec518 ( Context * __context__, _lambda_thismodule_74_4 * ____this_rename_at_74_279 );
+inline void _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_177_280, int32_t __value_rename_at_177_281 );
+inline void _FuncTickverify_evenTick16438837766850132515_8c37383502cdd9d4 ( Context * __context__, TArray<int32_t> const  & __arr_rename_at_23_282 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickfilterTick2611906363669329552_b14e0f0747da1864 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_38_287, Func DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_38_288 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickfilterTick17052258911568430960_c5b51d79366e68ab ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_32_289, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_32_290 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickmapTick1994230664415641751_9824beb79d88ab9b ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_82_291, Func DAS_COMMENT((int32_t,int32_t)) const  __blk_rename_at_82_292 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickmapTick3767370688684665805_f8ebf27fc6d50619 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_76_293, Lambda DAS_COMMENT((int32_t,int32_t)) const  __blk_rename_at_76_294 );
+inline int32_t _FuncfunctionalTickreduceTick3841530652084879893_4e6a88b61e02101d ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __it_rename_at_125_295, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  & __blk_rename_at_125_296 );
+inline bool _Func_lambda_thismodule_130_5Tickfunction_3c6eacc4fad58ddb ( Context * __context__, _lambda_thismodule_130_5 & ____this_rename_at_130_297, int32_t const  * & ___ryield130_rename_at_130_298 );
+inline void _Func_lambda_thismodule_130_5Tickfinalizer_83528de467f2bb86 ( Context * __context__, _lambda_thismodule_130_5 * ____this_rename_at_130_299 );
+inline int32_t _FuncfunctionalTickreduceTick3815634954217254421_637b69df14cebf47 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __it_rename_at_111_300, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  __blk_rename_at_111_301 );
+inline int32_t _FuncfunctionalTickreduceTick12199344316191013487_ce2eb4d61b1b6a52 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __it_rename_at_118_302, Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  __blk_rename_at_118_303 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _FuncfunctionalTickmapTick3767370688684665805_210e299a5936eafc ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_76_304, Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) const  __blk_rename_at_76_305 );
+inline int32_t _FuncfunctionalTicksumTick17873460401295886850_17c4e2f4f54c1187 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __it_rename_at_132_306 );
+inline Sequence DAS_COMMENT((bool)) _FuncfunctionalTickmapTick3767370688684665805_91ba24b601ec1f6a ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_76_309, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_76_310 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickcycleTick13989071893922639452_52c9b4b9346a07f9 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_194_311 );
+inline bool _Func_lambda_thismodule_251_6Tickfunction_1f5cce243f6a7a42 ( Context * __context__, _lambda_thismodule_251_6 & ____this_rename_at_251_312, int32_t & ___yield_251_rename_at_251_313 );
+inline void _Func_lambda_thismodule_251_6Tickfinalizer_ed9e37bfaf4f898a ( Context * __context__, _lambda_thismodule_251_6 * ____this_rename_at_251_314 );
+inline bool _Func_lambda_thismodule_256_7Tickfunction_8da15827f11974f6 ( Context * __context__, _lambda_thismodule_256_7 & ____this_rename_at_256_315, TTuple<8,int32_t,float> & ___yield_256_rename_at_256_316 );
+inline void _Func_lambda_thismodule_256_7Tickfinalizer_d2f7d1de26ba32e1 ( Context * __context__, _lambda_thismodule_256_7 * ____this_rename_at_256_317 );
+inline bool _Func_lambda_thismodule_259_8Tickfunction_6259af6c65cab550 ( Context * __context__, _lambda_thismodule_259_8 & ____this_rename_at_259_318, TTuple<8,int32_t,float> & ___yield_259_rename_at_259_319 );
+inline void _Func_lambda_thismodule_259_8Tickfinalizer_f9e9eb2f3c5501a9 ( Context * __context__, _lambda_thismodule_259_8 * ____this_rename_at_259_320 );
+inline bool _Func_lambda_thismodule_271_9Tickfunction_9db63ad06beaec8f ( Context * __context__, _lambda_thismodule_271_9 & ____this_rename_at_271_321, int32_t const  * & ___ryield271_rename_at_271_322 );
+inline void _Func_lambda_thismodule_271_9Tickfinalizer_366fe232fcac2a26 ( Context * __context__, _lambda_thismodule_271_9 * ____this_rename_at_271_323 );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115 ( Context * __context__, TDim<int32_t,2> & __a_rename_at_1502_324 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 ( Context * __context__, range __rng_rename_at_1398_326 );
+inline int32_t _Func_lambda_thismodule_109_1Tickfunction_cbda5cc99cf33214 ( Context * __context__, _lambda_thismodule_109_1 & ____this_rename_at_109_328, int32_t __x_rename_at_109_329 );
+inline void _Func_lambda_thismodule_109_1Tickfinalizer_a9193e773e020d98 ( Context * __context__, _lambda_thismodule_109_1 * ____this_rename_at_109_330 );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b ( Context * __context__, TDim<int32_t,3> & __a_rename_at_1502_331 );
+inline TTuple<8,int32_t,float> _Func_lambda_thismodule_163_2Tickfunction_d1ac8639c9d7a0ca ( Context * __context__, _lambda_thismodule_163_2 & ____this_rename_at_163_333, int32_t __x_rename_at_163_334 );
+inline void _Func_lambda_thismodule_163_2Tickfinalizer_e24e528e5a88c81 ( Context * __context__, _lambda_thismodule_163_2 * ____this_rename_at_163_335 );
+inline bool _FuncfunctionalTickanyTick3153855942392455914_5e0e9c66abeffa8f ( Context * __context__, TDim<bool,2> const  & __it_rename_at_143_336 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickisliceTick565469751076799399_266369a698f370fe ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_227_338, int32_t __start_rename_at_227_339, int32_t __stop_rename_at_227_340 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickrepeatTick5582964371469216548_dfc9e5bf3c1c1ae1 ( Context * __context__, int32_t __value_rename_at_263_341, int32_t __count_rename_at_263_342 );
+inline bool is_even_28e79c60210e5b07 ( Context * __context__, int32_t __x_rename_at_10_343 );
+inline int32_t twice_cddb661caae60bf4 ( Context * __context__, int32_t __x_rename_at_14_344 );
+inline int32_t add_b9c39300f347f461 ( Context * __context__, int32_t __a_rename_at_18_345, int32_t __b_rename_at_18_346 );
+inline bool _FuncExclEqu_fd3ae9a2691a110b ( Context * __context__, TTuple<8,int32_t,float> const  & __a_rename_at_40_347, TTuple<8,int32_t,float> const  & __b_rename_at_40_348 );
+inline bool _FuncExclEqu_f90153e54231f783 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_44_349, TArray<int32_t> const  & __b_rename_at_44_350 );
+inline bool test_108d10aea454bc3b ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void finalize_5c3fa10faeab6f5b ( Context * __context__, _lambda_thismodule_46_36 &  ____this_rename_at_46_0 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_46_0._source_0_at_47_12),__context__);
+    _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_46_0.__w_rename_at_47_17));
+    memset((void*)&(____this_rename_at_46_0), 0, 88);
+}
+
+inline bool _Func_lambda_thismodule_46_36Tickfunction_b499ef7f7ef1a851 ( Context * __context__, _lambda_thismodule_46_36 &  ____this_rename_at_46_1, int32_t & ___yield_46_rename_at_46_2 )
+{
+    switch (____this_rename_at_46_1.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_46_1._loop_at_47_12,true);
+    das_move(____this_rename_at_46_1._source_0_at_47_12,____this_rename_at_46_1.src);
+    memset((void*)&(____this_rename_at_46_1.__w_rename_at_47_17), 0, 24);
+    das_copy(____this_rename_at_46_1._pvar_0_at_47_12,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_46_1.__w_rename_at_47_17)));
+    DAS_SETBOOLAND((____this_rename_at_46_1._loop_at_47_12),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_46_1._source_0_at_47_12),____this_rename_at_46_1._pvar_0_at_47_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_46_1._loop_at_47_12 )
+    {
+        goto label_4;
+    };
+    das_copy(___yield_46_rename_at_46_2,das_invoke_lambda<int32_t>::invoke<TArray<int32_t> &>(__context__,nullptr,____this_rename_at_46_1.blk,das_arg<TArray<int32_t>>::pass(____this_rename_at_46_1.__w_rename_at_47_17)));
+    das_copy(____this_rename_at_46_1.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_46_1._loop_at_47_12),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_46_1._source_0_at_47_12),____this_rename_at_46_1._pvar_0_at_47_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_46_1._source_0_at_47_12),____this_rename_at_46_1._pvar_0_at_47_12,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_46_36Tickfinalizer_84a9c3600660c442 ( Context * __context__, _lambda_thismodule_46_36 * ____this_rename_at_46_3 )
+{
+    finalize_5c3fa10faeab6f5b(__context__,das_arg<_lambda_thismodule_46_36>::pass(das_deref(__context__,____this_rename_at_46_3,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_46_36 *>::clear(__context__,____this_rename_at_46_3);
+}
+
+inline void finalize_e3ab08cedd375fa ( Context * __context__, _lambda_thismodule_117_35 &  ____this_rename_at_117_4 )
+{
+    memset((void*)&(____this_rename_at_117_4), 0, 16);
+}
+
+inline int32_t _Func_lambda_thismodule_117_35Tickfunction_4cba99b90ac6a708 ( Context * __context__, _lambda_thismodule_117_35 &  ____this_rename_at_117_5, TArray<int32_t> const  &  __x_rename_at_117_6 )
+{
+    return das_auto_cast<int32_t>::cast(__x_rename_at_117_6(0,__context__));
+}
+
+inline void _Func_lambda_thismodule_117_35Tickfinalizer_20c0cf0819a8cef4 ( Context * __context__, _lambda_thismodule_117_35 * ____this_rename_at_117_7 )
+{
+    finalize_e3ab08cedd375fa(__context__,das_arg<_lambda_thismodule_117_35>::pass(das_deref(__context__,____this_rename_at_117_7,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_117_35 *>::clear(__context__,____this_rename_at_117_7);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickmap_anyTick4479995923280306007_5642e543b9d04ef3 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  __src_rename_at_43_8, Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) __blk_rename_at_43_9 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_FuncbuiltinTickeachTick9663565701927713696_38bf4259f235eb1a(__context__,das_ascend<bool,_lambda_thismodule_46_36>::make(__context__,&__type_info__df552d11a0961593,(([&]() -> _lambda_thismodule_46_36 {
+        _lambda_thismodule_46_36 __mks_46;
+        das_zero(__mks_46);
+        das_copy((__mks_46.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_46_36`function XS<_lambda_thismodule_46_36> &i*/ 0x15c1c1ebf6ac41cb))));
+        das_copy((__mks_46.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_46_36`finalizer X1<S<_lambda_thismodule_46_36>>?*/ 0x485f54f80566e6f6))));
+        das_move((__mks_46.blk),(__blk_rename_at_43_9));
+        das_move((__mks_46.src),(__src_rename_at_43_8));
+        return __mks_46;
+    })()))));
+}
+
+inline void _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5 ( Context * __context__, TArray<int32_t> &  __a_rename_at_32_10, TArray<int32_t> &  __b_rename_at_32_11 )
+{
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<TArray<int32_t> &>::from(__a_rename_at_32_10),cast<char * const >::from(((char *) "object can't be moved to because it is locked"))));
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<TArray<int32_t> &>::from(__b_rename_at_32_11),cast<char * const >::from(((char *) "object can't be moved from because it is locked"))));
+    das_move(__a_rename_at_32_10,__b_rename_at_32_11);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickmapTick3767370688684665805_7dd7ef6681f58a23 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  __src_rename_at_76_12, Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) const  __blk_rename_at_76_13 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_FuncfunctionalTickmap_anyTick4479995923280306007_5642e543b9d04ef3(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__src_rename_at_76_12),__blk_rename_at_76_13));
+}
+
+inline void finalize_935fd2f8295ecce9 ( Context * __context__, _lambda_thismodule_57_34 &  ____this_rename_at_57_14 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_57_14._source_0_at_58_12),__context__);
+    memset((void*)&(____this_rename_at_57_14), 0, 72);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickmove_to_localTick14376033101315213529_a3eb4ebbfa51707 ( Context * __context__, TArray<int32_t> &  __a_rename_at_1064_15 )
+{
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__a_rename_at_1064_15);
+}
+
+inline bool _Func_lambda_thismodule_57_34Tickfunction_8e7015a5e889f99c ( Context * __context__, _lambda_thismodule_57_34 &  ____this_rename_at_57_16, TArray<int32_t> &  ___yield_57_rename_at_57_17 )
+{
+    TArray<int32_t> _temp_make_local_60_29_0; _temp_make_local_60_29_0;
+    switch (____this_rename_at_57_16.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_57_16._loop_at_58_12,true);
+    das_move(____this_rename_at_57_16._source_0_at_58_12,____this_rename_at_57_16.src);
+    memset((void*)&(____this_rename_at_57_16.__w_rename_at_58_17), 0, 8);
+    das_copy(____this_rename_at_57_16._pvar_0_at_58_12,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_57_16.__w_rename_at_58_17)));
+    DAS_SETBOOLAND((____this_rename_at_57_16._loop_at_58_12),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_57_16._source_0_at_58_12),____this_rename_at_57_16._pvar_0_at_58_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_57_16._loop_at_58_12 )
+    {
+        goto label_4;
+    };
+    _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5(__context__,das_arg<TArray<int32_t>>::pass(___yield_57_rename_at_57_17),das_arg<TArray<int32_t>>::pass((_temp_make_local_60_29_0 = (_FuncbuiltinTickmove_to_localTick14376033101315213529_a3eb4ebbfa51707(__context__,das_arg<TArray<int32_t>>::pass(das_invoke_lambda<TArray<int32_t>>::invoke_cmres<TArray<int32_t> &>(__context__,nullptr,____this_rename_at_57_16.blk,das_arg<TArray<int32_t>>::pass(das_deref(__context__,____this_rename_at_57_16.__w_rename_at_58_17,__FILE__,__LINE__)))))))));
+    das_copy(____this_rename_at_57_16.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_57_16._loop_at_58_12),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_57_16._source_0_at_58_12),____this_rename_at_57_16._pvar_0_at_58_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_57_16._source_0_at_58_12),____this_rename_at_57_16._pvar_0_at_58_12,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_57_34Tickfinalizer_37a60b4798f52ebf ( Context * __context__, _lambda_thismodule_57_34 * ____this_rename_at_57_18 )
+{
+    finalize_935fd2f8295ecce9(__context__,das_arg<_lambda_thismodule_57_34>::pass(das_deref(__context__,____this_rename_at_57_18,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_57_34 *>::clear(__context__,____this_rename_at_57_18);
+}
+
+inline bool _FuncTickis_sameTick245538717971957847_5920cebe138ff292 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) &  __a_rename_at_56_19, Sequence DAS_COMMENT((TArray<int32_t>)) &  __b_rename_at_56_20 )
+{
+    {
+        bool __need_loop_57 = true;
+        // x: array<int>&
+        das_iterator<Sequence DAS_COMMENT((TArray<int32_t>))> __x_iterator(__a_rename_at_56_19);
+        TArray<int32_t> * __x_rename_at_57_23;
+        __need_loop_57 = __x_iterator.first(__context__,(__x_rename_at_57_23)) && __need_loop_57;
+        // y: array<int>
+        das_iterator<Sequence DAS_COMMENT((TArray<int32_t>))> __y_iterator(__b_rename_at_56_20);
+        TArray<int32_t> __y_rename_at_57_24;
+        __need_loop_57 = __y_iterator.first(__context__,(__y_rename_at_57_24)) && __need_loop_57;
+        for ( ; __need_loop_57 ; __need_loop_57 = __x_iterator.next(__context__,(__x_rename_at_57_23)) && __y_iterator.next(__context__,(__y_rename_at_57_24)) )
+        {
+            if ( _FuncExclEqu_f90153e54231f783(__context__,das_arg<TArray<int32_t>>::pass((*__x_rename_at_57_23)),das_arg<TArray<int32_t>>::pass(__y_rename_at_57_24)) )
+            {
+                return das_auto_cast<bool>::cast(false);
+            };
+        }
+        __y_iterator.close(__context__,(__y_rename_at_57_24));
+        __x_iterator.close(__context__,(__x_rename_at_57_23));
+    };
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline void finalize_da055a40908e26 ( Context * __context__, _lambda_thismodule_239_33 &  ____this_rename_at_239_25 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_239_25._source_0_at_240_12),__context__);
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_239_25._source_1_at_240_12),__context__);
+    memset((void*)&(____this_rename_at_239_25), 0, 96);
+}
+
+inline bool _FuncTickis_sameTick245538717971957847_a9c0341708763739 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) &  __a_rename_at_56_26, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) &  __b_rename_at_56_27 )
+{
+    {
+        bool __need_loop_57 = true;
+        // x: tuple<int;float>&
+        das_iterator<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))> __x_iterator(__a_rename_at_56_26);
+        TTuple<8,int32_t,float> * __x_rename_at_57_30;
+        __need_loop_57 = __x_iterator.first(__context__,(__x_rename_at_57_30)) && __need_loop_57;
+        // y: tuple<int;float>
+        das_iterator<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))> __y_iterator(__b_rename_at_56_27);
+        TTuple<8,int32_t,float> __y_rename_at_57_31;
+        __need_loop_57 = __y_iterator.first(__context__,(__y_rename_at_57_31)) && __need_loop_57;
+        for ( ; __need_loop_57 ; __need_loop_57 = __x_iterator.next(__context__,(__x_rename_at_57_30)) && __y_iterator.next(__context__,(__y_rename_at_57_31)) )
+        {
+            if ( _FuncExclEqu_fd3ae9a2691a110b(__context__,das_arg<TTuple<8,int32_t,float>>::pass((*__x_rename_at_57_30)),das_arg<TTuple<8,int32_t,float>>::pass(__y_rename_at_57_31)) )
+            {
+                return das_auto_cast<bool>::cast(false);
+            };
+        }
+        __y_iterator.close(__context__,(__y_rename_at_57_31));
+        __x_iterator.close(__context__,(__x_rename_at_57_30));
+    };
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline void finalize_322b586a61b59695 ( Context * __context__, _lambda_thismodule_239_31 &  ____this_rename_at_239_32 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_239_32._source_0_at_240_12),__context__);
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_239_32._source_1_at_240_12),__context__);
+    memset((void*)&(____this_rename_at_239_32), 0, 96);
+}
+
+inline void finalize_4f7eb10f7e42945c ( Context * __context__, _lambda_thismodule_116_32 &  ____this_rename_at_116_33 )
+{
+    memset((void*)&(____this_rename_at_116_33), 0, 16);
+}
+
+inline bool _Func_lambda_thismodule_239_33Tickfunction_c893b561a33638e4 ( Context * __context__, _lambda_thismodule_239_33 &  ____this_rename_at_239_34, TArray<int32_t> * & ___ryield239_rename_at_239_35 )
+{
+    switch (____this_rename_at_239_34.__yield) {
+    case 0: goto label_0;
+    case 3: goto label_3;
+    case 1: goto label_1;
+    case 2: goto label_2;
+    case 4: goto label_4;
+    case 5: goto label_5;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_239_34._loop_at_240_12,true);
+    das_move(____this_rename_at_239_34._source_0_at_240_12,____this_rename_at_239_34.src);
+    memset((void*)&(____this_rename_at_239_34.__x_rename_at_240_17), 0, 8);
+    das_copy(____this_rename_at_239_34._pvar_0_at_240_12,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_239_34.__x_rename_at_240_17)));
+    DAS_SETBOOLAND((____this_rename_at_239_34._loop_at_240_12),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_239_34._source_0_at_240_12),____this_rename_at_239_34._pvar_0_at_240_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    das_move(____this_rename_at_239_34._source_1_at_240_12,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,mk_range(____this_rename_at_239_34.stop)));
+    memset((void*)&(____this_rename_at_239_34.__i_rename_at_240_20), 0, 4);
+    das_copy(____this_rename_at_239_34._pvar_1_at_240_12,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_239_34.__i_rename_at_240_20)));
+    DAS_SETBOOLAND((____this_rename_at_239_34._loop_at_240_12),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_239_34._source_1_at_240_12),____this_rename_at_239_34._pvar_1_at_240_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_3:;;
+    if ( !____this_rename_at_239_34._loop_at_240_12 )
+    {
+        goto label_5;
+    };
+    if ( !(____this_rename_at_239_34.__i_rename_at_240_20 >= ____this_rename_at_239_34.start) )
+    {
+        goto label_2;
+    };
+    das_copy(___ryield239_rename_at_239_35,das_ref(__context__,das_deref(__context__,____this_rename_at_239_34.__x_rename_at_240_17,__FILE__,__LINE__)));
+    das_copy(____this_rename_at_239_34.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_2:;;
+    label_4:;;
+    DAS_SETBOOLAND((____this_rename_at_239_34._loop_at_240_12),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_239_34._source_0_at_240_12),____this_rename_at_239_34._pvar_0_at_240_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    DAS_SETBOOLAND((____this_rename_at_239_34._loop_at_240_12),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_239_34._source_1_at_240_12),____this_rename_at_239_34._pvar_1_at_240_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_3;
+    label_5:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_239_34._source_0_at_240_12),____this_rename_at_239_34._pvar_0_at_240_12,__context__);
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_239_34._source_1_at_240_12),____this_rename_at_239_34._pvar_1_at_240_12,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_239_33Tickfinalizer_a4e5d7e39be05c5d ( Context * __context__, _lambda_thismodule_239_33 * ____this_rename_at_239_36 )
+{
+    finalize_da055a40908e26(__context__,das_arg<_lambda_thismodule_239_33>::pass(das_deref(__context__,____this_rename_at_239_36,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_239_33 *>::clear(__context__,____this_rename_at_239_36);
+}
+
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_fa51d566d7dfd53e ( Context * __context__, TArray<TArray<int32_t>> &  __a_rename_at_1336_37 )
+{
+    {
+        bool __need_loop_1338 = true;
+        // aV: array<int> aka TT&
+        das_iterator<TArray<TArray<int32_t>>> __aV_iterator(__a_rename_at_1336_37);
+        TArray<int32_t> * __aV_rename_at_1338_38;
+        __need_loop_1338 = __aV_iterator.first(__context__,(__aV_rename_at_1338_38)) && __need_loop_1338;
+        for ( ; __need_loop_1338 ; __need_loop_1338 = __aV_iterator.next(__context__,(__aV_rename_at_1338_38)) )
+        {
+            _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd(__context__,das_arg<TArray<int32_t>>::pass((*__aV_rename_at_1338_38)));
+        }
+        __aV_iterator.close(__context__,(__aV_rename_at_1338_38));
+    };
+    builtin_array_free(das_arg<TArray<TArray<int32_t>>>::pass(__a_rename_at_1336_37),24,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline bool _Func_lambda_thismodule_239_31Tickfunction_bfb87e4067b2a8d8 ( Context * __context__, _lambda_thismodule_239_31 &  ____this_rename_at_239_39, TTuple<8,int32_t,float> * & ___ryield239_rename_at_239_40 )
+{
+    switch (____this_rename_at_239_39.__yield) {
+    case 0: goto label_0;
+    case 3: goto label_3;
+    case 1: goto label_1;
+    case 2: goto label_2;
+    case 4: goto label_4;
+    case 5: goto label_5;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_239_39._loop_at_240_12,true);
+    das_move(____this_rename_at_239_39._source_0_at_240_12,____this_rename_at_239_39.src);
+    memset((void*)&(____this_rename_at_239_39.__x_rename_at_240_17), 0, 8);
+    das_copy(____this_rename_at_239_39._pvar_0_at_240_12,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_239_39.__x_rename_at_240_17)));
+    DAS_SETBOOLAND((____this_rename_at_239_39._loop_at_240_12),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_239_39._source_0_at_240_12),____this_rename_at_239_39._pvar_0_at_240_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    das_move(____this_rename_at_239_39._source_1_at_240_12,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,mk_range(____this_rename_at_239_39.stop)));
+    memset((void*)&(____this_rename_at_239_39.__i_rename_at_240_20), 0, 4);
+    das_copy(____this_rename_at_239_39._pvar_1_at_240_12,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_239_39.__i_rename_at_240_20)));
+    DAS_SETBOOLAND((____this_rename_at_239_39._loop_at_240_12),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_239_39._source_1_at_240_12),____this_rename_at_239_39._pvar_1_at_240_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_3:;;
+    if ( !____this_rename_at_239_39._loop_at_240_12 )
+    {
+        goto label_5;
+    };
+    if ( !(____this_rename_at_239_39.__i_rename_at_240_20 >= ____this_rename_at_239_39.start) )
+    {
+        goto label_2;
+    };
+    das_copy(___ryield239_rename_at_239_40,das_ref(__context__,das_deref(__context__,____this_rename_at_239_39.__x_rename_at_240_17,__FILE__,__LINE__)));
+    das_copy(____this_rename_at_239_39.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_2:;;
+    label_4:;;
+    DAS_SETBOOLAND((____this_rename_at_239_39._loop_at_240_12),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_239_39._source_0_at_240_12),____this_rename_at_239_39._pvar_0_at_240_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    DAS_SETBOOLAND((____this_rename_at_239_39._loop_at_240_12),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_239_39._source_1_at_240_12),____this_rename_at_239_39._pvar_1_at_240_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_3;
+    label_5:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_239_39._source_0_at_240_12),____this_rename_at_239_39._pvar_0_at_240_12,__context__);
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_239_39._source_1_at_240_12),____this_rename_at_239_39._pvar_1_at_240_12,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_239_31Tickfinalizer_58d02024b348deca ( Context * __context__, _lambda_thismodule_239_31 * ____this_rename_at_239_41 )
+{
+    finalize_322b586a61b59695(__context__,das_arg<_lambda_thismodule_239_31>::pass(das_deref(__context__,____this_rename_at_239_41,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_239_31 *>::clear(__context__,____this_rename_at_239_41);
+}
+
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_81327841969947fa ( Context * __context__, TArray<TTuple<8,int32_t,float>> &  __a_rename_at_1336_42 )
+{
+    {
+        bool __need_loop_1338 = true;
+        // aV: tuple<int;float> aka TT&
+        das_iterator<TArray<TTuple<8,int32_t,float>>> __aV_iterator(__a_rename_at_1336_42);
+        TTuple<8,int32_t,float> * __aV_rename_at_1338_43;
+        __need_loop_1338 = __aV_iterator.first(__context__,(__aV_rename_at_1338_43)) && __need_loop_1338;
+        for ( ; __need_loop_1338 ; __need_loop_1338 = __aV_iterator.next(__context__,(__aV_rename_at_1338_43)) )
+        {
+            finalize_5cef76514cdcd502(__context__,das_arg<TTuple<8,int32_t,float>>::pass((*__aV_rename_at_1338_43)));
+        }
+        __aV_iterator.close(__context__,(__aV_rename_at_1338_43));
+    };
+    builtin_array_free(das_arg<TArray<TTuple<8,int32_t,float>>>::pass(__a_rename_at_1336_42),8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline TArray<int32_t> _Func_lambda_thismodule_116_32Tickfunction_fb95bbf9fac8f359 ( Context * __context__, _lambda_thismodule_116_32 &  ____this_rename_at_116_44, TArray<int32_t> const  &  __x_rename_at_116_45 )
+{
+    TArray<int32_t> _temp_make_local_116_40_1; _temp_make_local_116_40_1;
+    TDim<int32_t,3> _temp_make_local_116_40_2; _temp_make_local_116_40_2;
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14(__context__,das_arg<TArray<int32_t>>::pass((_temp_make_local_116_40_1 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b(__context__,das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+        _temp_make_local_116_40_2(0,__context__) = __x_rename_at_116_45(0,__context__);
+        _temp_make_local_116_40_2(1,__context__) = __x_rename_at_116_45(0,__context__);
+        _temp_make_local_116_40_2(2,__context__) = __x_rename_at_116_45(0,__context__);
+        return _temp_make_local_116_40_2;
+    })()))))))));
+}
+
+inline void _Func_lambda_thismodule_116_32Tickfinalizer_4f9418ced39b6d4a ( Context * __context__, _lambda_thismodule_116_32 * ____this_rename_at_116_46 )
+{
+    finalize_4f7eb10f7e42945c(__context__,das_arg<_lambda_thismodule_116_32>::pass(das_deref(__context__,____this_rename_at_116_46,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_116_32 *>::clear(__context__,____this_rename_at_116_46);
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _FuncfunctionalTickmap_anyTick4479995923280306007_7911bf7d28600067 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) &  __src_rename_at_43_47, Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) __blk_rename_at_43_48 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t>))>::cast(_FuncbuiltinTickeachTick9663565701927713696_f0f9ca53bb972a42(__context__,das_ascend<bool,_lambda_thismodule_57_34>::make(__context__,&__type_info__c7ec48c6dd149d10,(([&]() -> _lambda_thismodule_57_34 {
+        _lambda_thismodule_57_34 __mks_57;
+        das_zero(__mks_57);
+        das_copy((__mks_57.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_57_34`function XS<_lambda_thismodule_57_34> 1<i>A*/ 0x7fcf5f0f5262c680))));
+        das_copy((__mks_57.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_57_34`finalizer X1<S<_lambda_thismodule_57_34>>?*/ 0x7816570d3bb982e2))));
+        das_move((__mks_57.blk),(__blk_rename_at_43_48));
+        das_move((__mks_57.src),(__src_rename_at_43_47));
+        return __mks_57;
+    })()))));
+}
+
+inline void _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__, TArray<int32_t> &  __a_rename_at_1142_49, TArray<int32_t> const  &  __b_rename_at_1142_50 )
+{
+    int32_t __ln_rename_at_1143_51 = ((int32_t)builtin_array_size(__b_rename_at_1142_50));
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_1142_49),__ln_rename_at_1143_51);
+    if ( __ln_rename_at_1143_51 == 0 )
+    {
+        return ;
+    } else {
+        das_memcpy(das_auto_cast<void * const >::cast(das_ref(__context__,__a_rename_at_1142_49(0,__context__))),das_auto_cast<void * const >::cast(das_ref(__context__,__b_rename_at_1142_50(0,__context__))),__ln_rename_at_1143_51 * 4);
+    };
+}
+
+inline int32_t _FuncTickfirstTick947304547137840980_5c6792106670b351 ( Context * __context__, TTuple<8,int32_t,float> const  &  __x_rename_at_36_52 )
+{
+    return das_auto_cast<int32_t>::cast(das_get_tuple_field<int32_t,0>::get(__x_rename_at_36_52));
+}
+
+inline TTuple<8,int32_t,float> _FuncfunctionalTickreduce_anyTick10888502122296883119_349cc66090f1ae3b ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) &  __it_rename_at_88_53, Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  &  __functor_rename_at_88_54 )
+{
+    TTuple<8,int32_t,float> __left_rename_at_90_55;das_zero(__left_rename_at_90_55);
+    bool __first_rename_at_91_56 = true;
+    {
+        bool __need_loop_92 = true;
+        // right: tuple<int;float> aka TT
+        das_iterator<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))> __right_iterator(__it_rename_at_88_53);
+        TTuple<8,int32_t,float> __right_rename_at_92_57;
+        __need_loop_92 = __right_iterator.first(__context__,(__right_rename_at_92_57)) && __need_loop_92;
+        for ( ; __need_loop_92 ; __need_loop_92 = __right_iterator.next(__context__,(__right_rename_at_92_57)) )
+        {
+            if ( __first_rename_at_91_56 )
+            {
+                das_copy(__first_rename_at_91_56,false);
+                das_copy(__left_rename_at_90_55,__right_rename_at_92_57);
+            } else {
+                das_move(__left_rename_at_90_55,_FuncbuiltinTickcopy_to_localTick18007282088148548588_cf5b4d36c641ec89(__context__,das_invoke<TTuple<8,int32_t,float>>::invoke_cmres<TTuple<8,int32_t,float> &,TTuple<8,int32_t,float> &>(__context__,nullptr,__functor_rename_at_88_54,das_arg<TTuple<8,int32_t,float>>::pass(__left_rename_at_90_55),das_arg<TTuple<8,int32_t,float>>::pass(__right_rename_at_92_57))));
+            };
+        }
+        __right_iterator.close(__context__,(__right_rename_at_92_57));
+    };
+    if ( __first_rename_at_91_56 )
+    {
+        builtin_throw(((char *) "can't reduce empty sequence"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    };
+    return das_auto_cast_ref<TTuple<8,int32_t,float>>::cast(__left_rename_at_90_55);
+}
+
+inline void finalize_5cef76514cdcd502 ( Context * __context__, TTuple<8,int32_t,float> &  ____this_rename_at_213_58 )
+{
+    memset((void*)&(____this_rename_at_213_58), 0, 8);
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _FuncbuiltinTickeachTick6002865651812066953_79ce88e42c3e3433 ( Context * __context__, TArray<TArray<int32_t>> const  &  __a_rename_at_1427_59 )
+{
+    Sequence DAS_COMMENT((TArray<int32_t> *)) __it_rename_at_1428_60;das_zero(__it_rename_at_1428_60);
+    builtin_make_good_array_iterator(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__it_rename_at_1428_60),__a_rename_at_1427_59,24,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t> &))>::cast(__it_rename_at_1428_60);
+}
+
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd ( Context * __context__, TArray<int32_t> &  __a_rename_at_1336_61 )
+{
+    builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_1336_61),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _FuncfunctionalTickmapTick3767370688684665805_afc82126cea94d6e ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) &  __src_rename_at_76_62, Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) const  __blk_rename_at_76_63 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t>))>::cast(_FuncfunctionalTickmap_anyTick4479995923280306007_7911bf7d28600067(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__src_rename_at_76_62),__blk_rename_at_76_63));
+}
+
+inline bool _FuncfunctionalTicknotTick15126137237442268133_5718a646ccd351d7 ( Context * __context__, bool __x_rename_at_288_64 )
+{
+    return das_auto_cast<bool>::cast(!__x_rename_at_288_64);
+}
+
+inline void finalize_7980aaa0c8ca61d4 ( Context * __context__, _lambda_thismodule_21_30 &  ____this_rename_at_21_65 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_21_65._source_0_at_22_12),__context__);
+    _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_21_65.__w_rename_at_22_17));
+    memset((void*)&(____this_rename_at_21_65), 0, 88);
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _FuncbuiltinTickeachTick6002865651812066953_e372b165824f649d ( Context * __context__, TArray<TTuple<8,int32_t,float>> const  &  __a_rename_at_1427_66 )
+{
+    Sequence DAS_COMMENT((TTuple<8,int32_t,float> *)) __it_rename_at_1428_67;das_zero(__it_rename_at_1428_67);
+    builtin_make_good_array_iterator(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(__it_rename_at_1428_67),__a_rename_at_1427_66,8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &))>::cast(__it_rename_at_1428_67);
+}
+
+inline TTuple<8,int32_t,float> _FuncfunctionalTickreduceTick3841530652084879893_a9fc9323110bc9fc ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) &  __it_rename_at_125_68, Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  &  __blk_rename_at_125_69 )
+{
+    return das_auto_cast_ref<TTuple<8,int32_t,float>>::cast(_FuncfunctionalTickreduce_anyTick10888502122296883119_349cc66090f1ae3b(__context__,das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(__it_rename_at_125_68),__blk_rename_at_125_69));
+}
+
+inline bool _FuncfunctionalTickanyTick3860067047720393563_f5b4a194f258ddd0 ( Context * __context__, Sequence DAS_COMMENT((bool)) &  __it_rename_at_158_70 )
+{
+    {
+        bool __need_loop_160 = true;
+        // x: bool aka TT
+        das_iterator<Sequence DAS_COMMENT((bool))> __x_iterator(__it_rename_at_158_70);
+        bool __x_rename_at_160_71;
+        __need_loop_160 = __x_iterator.first(__context__,(__x_rename_at_160_71)) && __need_loop_160;
+        for ( ; __need_loop_160 ; __need_loop_160 = __x_iterator.next(__context__,(__x_rename_at_160_71)) )
+        {
+            if ( __x_rename_at_160_71 )
+            {
+                return das_auto_cast<bool>::cast(true);
+            };
+        }
+        __x_iterator.close(__context__,(__x_rename_at_160_71));
+    };
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline bool _FuncfunctionalTickallTick13174627742298730649_9c3f2431cb8402f6 ( Context * __context__, Sequence DAS_COMMENT((bool)) &  __it_rename_at_184_72 )
+{
+    {
+        bool __need_loop_186 = true;
+        // x: bool aka TT
+        das_iterator<Sequence DAS_COMMENT((bool))> __x_iterator(__it_rename_at_184_72);
+        bool __x_rename_at_186_73;
+        __need_loop_186 = __x_iterator.first(__context__,(__x_rename_at_186_73)) && __need_loop_186;
+        for ( ; __need_loop_186 ; __need_loop_186 = __x_iterator.next(__context__,(__x_rename_at_186_73)) )
+        {
+            if ( !__x_rename_at_186_73 )
+            {
+                return das_auto_cast<bool>::cast(false);
+            };
+        }
+        __x_iterator.close(__context__,(__x_rename_at_186_73));
+    };
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _FuncfunctionalTickisliceTick565469751076799399_bdd25b8f8cc2dbf5 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) &  __src_rename_at_227_74, int32_t __start_rename_at_227_75, int32_t __stop_rename_at_227_76 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t> &))>::cast(_FuncbuiltinTickeach_refTick16137060296763333387_61841c1791c9b95f(__context__,das_ascend<bool,_lambda_thismodule_239_33>::make(__context__,&__type_info__a84050c932b560d7,(([&]() -> _lambda_thismodule_239_33 {
+        _lambda_thismodule_239_33 __mks_239;
+        das_zero(__mks_239);
+        das_copy((__mks_239.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_239_33`function XS<_lambda_thismodule_239_33> &1<1<i>A>?*/ 0x6ef2485796f62e32))));
+        das_copy((__mks_239.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_239_33`finalizer X1<S<_lambda_thismodule_239_33>>?*/ 0x981c88219e7d11bd))));
+        das_move((__mks_239.src),(__src_rename_at_227_74));
+        das_copy((__mks_239.start),(__start_rename_at_227_75));
+        das_copy((__mks_239.stop),(__stop_rename_at_227_76));
+        return __mks_239;
+    })()))));
+}
+
+inline void finalize_cdfff6625092eae1 ( Context * __context__, _lambda_thismodule_211_25 &  ____this_rename_at_211_77 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_211_77._source_0_at_213_12),__context__);
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_211_77.___source_0_at_218_16_rename_at_218_16),__context__);
+    _FuncbuiltinTickfinalizeTick13836114024949725080_fa51d566d7dfd53e(__context__,das_arg<TArray<TArray<int32_t>>>::pass(____this_rename_at_211_77.arr));
+    _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_211_77.__x_rename_at_213_17));
+    memset((void*)&(____this_rename_at_211_77), 0, 136);
+}
+
+inline void finalize_3dcae5fa4b700dd5 ( Context * __context__, _lambda_thismodule_46_26 &  ____this_rename_at_46_78 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_46_78._source_0_at_47_12),__context__);
+    memset((void*)&(____this_rename_at_46_78), 0, 72);
+}
+
+inline void finalize_ce54b4b3dece547c ( Context * __context__, _lambda_thismodule_46_27 &  ____this_rename_at_46_79 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_46_79._source_0_at_47_12),__context__);
+    memset((void*)&(____this_rename_at_46_79), 0, 72);
+}
+
+inline void finalize_cb863a01181cc563 ( Context * __context__, _lambda_thismodule_46_28 &  ____this_rename_at_46_80 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_46_80._source_0_at_47_12),__context__);
+    memset((void*)&(____this_rename_at_46_80), 0, 72);
+}
+
+inline void finalize_eb39c4fa0e0aa9cb ( Context * __context__, _lambda_thismodule_46_29 &  ____this_rename_at_46_81 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_46_81._source_0_at_47_12),__context__);
+    memset((void*)&(____this_rename_at_46_81), 0, 72);
+}
+
+inline bool _Func_lambda_thismodule_21_30Tickfunction_124aecd4e54968e6 ( Context * __context__, _lambda_thismodule_21_30 &  ____this_rename_at_21_82, TArray<int32_t> * & ___ryield21_rename_at_21_83 )
+{
+    switch (____this_rename_at_21_82.__yield) {
+    case 0: goto label_0;
+    case 3: goto label_3;
+    case 1: goto label_1;
+    case 2: goto label_2;
+    case 4: goto label_4;
+    case 5: goto label_5;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_21_82._loop_at_22_12,true);
+    das_move(____this_rename_at_21_82._source_0_at_22_12,____this_rename_at_21_82.src);
+    memset((void*)&(____this_rename_at_21_82.__w_rename_at_22_17), 0, 24);
+    das_copy(____this_rename_at_21_82._pvar_0_at_22_12,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_21_82.__w_rename_at_22_17)));
+    DAS_SETBOOLAND((____this_rename_at_21_82._loop_at_22_12),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_21_82._source_0_at_22_12),____this_rename_at_21_82._pvar_0_at_22_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_3:;;
+    if ( !____this_rename_at_21_82._loop_at_22_12 )
+    {
+        goto label_5;
+    };
+    if ( !das_invoke_lambda<bool>::invoke<TArray<int32_t> &>(__context__,nullptr,____this_rename_at_21_82.blk,das_arg<TArray<int32_t>>::pass(____this_rename_at_21_82.__w_rename_at_22_17)) )
+    {
+        goto label_2;
+    };
+    das_copy(___ryield21_rename_at_21_83,das_ref(__context__,____this_rename_at_21_82.__w_rename_at_22_17));
+    das_copy(____this_rename_at_21_82.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_2:;;
+    label_4:;;
+    DAS_SETBOOLAND((____this_rename_at_21_82._loop_at_22_12),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_21_82._source_0_at_22_12),____this_rename_at_21_82._pvar_0_at_22_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_3;
+    label_5:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_21_82._source_0_at_22_12),____this_rename_at_21_82._pvar_0_at_22_12,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_21_30Tickfinalizer_f192f22a0f696612 ( Context * __context__, _lambda_thismodule_21_30 * ____this_rename_at_21_84 )
+{
+    finalize_7980aaa0c8ca61d4(__context__,das_arg<_lambda_thismodule_21_30>::pass(das_deref(__context__,____this_rename_at_21_84,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_21_30 *>::clear(__context__,____this_rename_at_21_84);
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _FuncbuiltinTickeach_refTick16137060296763333387_61841c1791c9b95f ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t> * &)) const  __lam_rename_at_1453_85 )
+{
+    Sequence DAS_COMMENT((TArray<int32_t> *)) __it_rename_at_1454_86;das_zero(__it_rename_at_1454_86);
+    builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__it_rename_at_1454_86),__lam_rename_at_1453_85,8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t> &))>::cast(__it_rename_at_1454_86);
+}
+
+inline Sequence DAS_COMMENT((bool)) _FuncbuiltinTickeachTick9663565701927713696_c6a9cdebae4e9e7f ( Context * __context__, Lambda DAS_COMMENT((bool,bool &)) const  __lam_rename_at_1443_87 )
+{
+    Sequence DAS_COMMENT((bool)) __it_rename_at_1445_88;das_zero(__it_rename_at_1445_88);
+    builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((bool))>::pass(__it_rename_at_1445_88),__lam_rename_at_1443_87,1,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((bool))>::cast(__it_rename_at_1445_88);
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _FuncfunctionalTickisliceTick565469751076799399_f12d6c00813f9d8c ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) &  __src_rename_at_227_89, int32_t __start_rename_at_227_90, int32_t __stop_rename_at_227_91 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &))>::cast(_FuncbuiltinTickeach_refTick16137060296763333387_7462031b9a3d3d2e(__context__,das_ascend<bool,_lambda_thismodule_239_31>::make(__context__,&__type_info__a84052c932b5643d,(([&]() -> _lambda_thismodule_239_31 {
+        _lambda_thismodule_239_31 __mks_239;
+        das_zero(__mks_239);
+        das_copy((__mks_239.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_239_31`function XS<_lambda_thismodule_239_31> &1<0<i;f>U>?*/ 0x83b2a8e5ec28a75f))));
+        das_copy((__mks_239.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_239_31`finalizer X1<S<_lambda_thismodule_239_31>>?*/ 0x722ea100d4682c5b))));
+        das_move((__mks_239.src),(__src_rename_at_227_89));
+        das_copy((__mks_239.start),(__start_rename_at_227_90));
+        das_copy((__mks_239.stop),(__stop_rename_at_227_91));
+        return __mks_239;
+    })()))));
+}
+
+inline void finalize_81b7faa9db9b97fa ( Context * __context__, _lambda_thismodule_211_24 &  ____this_rename_at_211_92 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_211_92._source_0_at_213_12),__context__);
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_211_92.___source_0_at_218_16_rename_at_218_16),__context__);
+    _FuncbuiltinTickfinalizeTick13836114024949725080_81327841969947fa(__context__,das_arg<TArray<TTuple<8,int32_t,float>>>::pass(____this_rename_at_211_92.arr));
+    finalize_5cef76514cdcd502(__context__,das_arg<TTuple<8,int32_t,float>>::pass(____this_rename_at_211_92.__x_rename_at_213_17));
+    memset((void*)&(____this_rename_at_211_92), 0, 120);
+}
+
+inline Sequence DAS_COMMENT((int32_t &)) _FuncbuiltinTickeachTick6002865651812066953_693fb4484d509206 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_1427_93 )
+{
+    Sequence DAS_COMMENT((int32_t *)) __it_rename_at_1428_94;das_zero(__it_rename_at_1428_94);
+    builtin_make_good_array_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_1428_94),__a_rename_at_1427_93,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t &))>::cast(__it_rename_at_1428_94);
+}
+
+inline void _FuncbuiltinTickpush_cloneTick2035469273396957942_3c23be799e74aa72 ( Context * __context__, TArray<TArray<int32_t>> &  __Arr_rename_at_393_95, TArray<int32_t> &  __value_rename_at_393_96 )
+{
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_2,cast<TArray<TArray<int32_t>> &>::from(__Arr_rename_at_393_95),cast<char * const >::from(((char *) "array can't be pushed to because it contains locked elements"))));
+    _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62(__context__,das_arg<TArray<int32_t>>::pass(__Arr_rename_at_393_95(builtin_array_push_back_zero(das_arg<TArray<TArray<int32_t>>>::pass(__Arr_rename_at_393_95),24,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__)),das_arg<TArray<int32_t>>::pass(__value_rename_at_393_96));
+}
+
+inline bool _Func_lambda_thismodule_211_25Tickfunction_b51aa010f6a4cd23 ( Context * __context__, _lambda_thismodule_211_25 &  ____this_rename_at_211_97, TArray<int32_t> * & ___ryield211_rename_at_211_98 )
+{
+    switch (____this_rename_at_211_97.__yield) {
+    case 0: goto label_0;
+    case 8: goto label_8;
+    case 1: goto label_1;
+    case 9: goto label_9;
+    case 10: goto label_10;
+    case 6: goto label_6;
+    case 3: goto label_3;
+    case 2: goto label_2;
+    case 4: goto label_4;
+    case 5: goto label_5;
+    case 7: goto label_7;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    memset((void*)&(____this_rename_at_211_97.arr), 0, 24);
+    das_copy(____this_rename_at_211_97._loop_at_213_12,true);
+    das_move(____this_rename_at_211_97._source_0_at_213_12,____this_rename_at_211_97.src);
+    memset((void*)&(____this_rename_at_211_97.__x_rename_at_213_17), 0, 24);
+    das_copy(____this_rename_at_211_97._pvar_0_at_213_12,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_211_97.__x_rename_at_213_17)));
+    DAS_SETBOOLAND((____this_rename_at_211_97._loop_at_213_12),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_211_97._source_0_at_213_12),____this_rename_at_211_97._pvar_0_at_213_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_8:;;
+    if ( !____this_rename_at_211_97._loop_at_213_12 )
+    {
+        goto label_10;
+    };
+    das_copy(___ryield211_rename_at_211_98,das_ref(__context__,____this_rename_at_211_97.__x_rename_at_213_17));
+    das_copy(____this_rename_at_211_97.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    _FuncbuiltinTickpush_cloneTick2035469273396957942_3c23be799e74aa72(__context__,das_arg<TArray<TArray<int32_t>>>::pass(____this_rename_at_211_97.arr),das_arg<TArray<int32_t>>::pass(____this_rename_at_211_97.__x_rename_at_213_17));
+    label_9:;;
+    DAS_SETBOOLAND((____this_rename_at_211_97._loop_at_213_12),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_211_97._source_0_at_213_12),____this_rename_at_211_97._pvar_0_at_213_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_8;
+    label_10:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_211_97._source_0_at_213_12),____this_rename_at_211_97._pvar_0_at_213_12,__context__);
+    label_6:;;
+    das_copy(____this_rename_at_211_97.___loop_at_218_16_rename_at_218_16,true);
+    das_move(____this_rename_at_211_97.___source_0_at_218_16_rename_at_218_16,_FuncbuiltinTickeachTick6002865651812066953_79ce88e42c3e3433(__context__,das_arg<TArray<TArray<int32_t>>>::pass(____this_rename_at_211_97.arr)));
+    memset((void*)&(____this_rename_at_211_97.__x_rename_at_218_21), 0, 8);
+    das_copy(____this_rename_at_211_97.___pvar_0_at_218_16_rename_at_218_16,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_211_97.__x_rename_at_218_21)));
+    DAS_SETBOOLAND((____this_rename_at_211_97.___loop_at_218_16_rename_at_218_16),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_211_97.___source_0_at_218_16_rename_at_218_16),____this_rename_at_211_97.___pvar_0_at_218_16_rename_at_218_16,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_3:;;
+    if ( !____this_rename_at_211_97.___loop_at_218_16_rename_at_218_16 )
+    {
+        goto label_5;
+    };
+    das_copy(___ryield211_rename_at_211_98,das_ref(__context__,das_deref(__context__,____this_rename_at_211_97.__x_rename_at_218_21,__FILE__,__LINE__)));
+    das_copy(____this_rename_at_211_97.__yield,2);
+    return das_auto_cast<bool>::cast(true);
+    label_2:;;
+    label_4:;;
+    DAS_SETBOOLAND((____this_rename_at_211_97.___loop_at_218_16_rename_at_218_16),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_211_97.___source_0_at_218_16_rename_at_218_16),____this_rename_at_211_97.___pvar_0_at_218_16_rename_at_218_16,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_3;
+    label_5:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_211_97.___source_0_at_218_16_rename_at_218_16),____this_rename_at_211_97.___pvar_0_at_218_16_rename_at_218_16,__context__);
+    goto label_6;
+    label_7:;;
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_211_25Tickfinalizer_9448301fe12bf62 ( Context * __context__, _lambda_thismodule_211_25 * ____this_rename_at_211_99 )
+{
+    finalize_cdfff6625092eae1(__context__,das_arg<_lambda_thismodule_211_25>::pass(das_deref(__context__,____this_rename_at_211_99,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_211_25 *>::clear(__context__,____this_rename_at_211_99);
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _FuncbuiltinTickeach_refTick16137060296763333387_7462031b9a3d3d2e ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float> * &)) const  __lam_rename_at_1453_100 )
+{
+    Sequence DAS_COMMENT((TTuple<8,int32_t,float> *)) __it_rename_at_1454_101;das_zero(__it_rename_at_1454_101);
+    builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(__it_rename_at_1454_101),__lam_rename_at_1453_100,8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &))>::cast(__it_rename_at_1454_101);
+}
+
+inline bool _Func_lambda_thismodule_46_26Tickfunction_55d29a7714c3b148 ( Context * __context__, _lambda_thismodule_46_26 &  ____this_rename_at_46_102, int32_t & ___yield_46_rename_at_46_103 )
+{
+    switch (____this_rename_at_46_102.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_46_102._loop_at_47_12,true);
+    das_move(____this_rename_at_46_102._source_0_at_47_12,____this_rename_at_46_102.src);
+    memset((void*)&(____this_rename_at_46_102.__w_rename_at_47_17), 0, 4);
+    das_copy(____this_rename_at_46_102._pvar_0_at_47_12,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_46_102.__w_rename_at_47_17)));
+    DAS_SETBOOLAND((____this_rename_at_46_102._loop_at_47_12),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_46_102._source_0_at_47_12),____this_rename_at_46_102._pvar_0_at_47_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_46_102._loop_at_47_12 )
+    {
+        goto label_4;
+    };
+    das_copy(___yield_46_rename_at_46_103,das_invoke_function<int32_t>::invoke<int32_t>(__context__,nullptr,____this_rename_at_46_102.blk,____this_rename_at_46_102.__w_rename_at_47_17));
+    das_copy(____this_rename_at_46_102.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_46_102._loop_at_47_12),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_46_102._source_0_at_47_12),____this_rename_at_46_102._pvar_0_at_47_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_46_102._source_0_at_47_12),____this_rename_at_46_102._pvar_0_at_47_12,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_46_26Tickfinalizer_3eae0ef5553264f8 ( Context * __context__, _lambda_thismodule_46_26 * ____this_rename_at_46_104 )
+{
+    finalize_3dcae5fa4b700dd5(__context__,das_arg<_lambda_thismodule_46_26>::pass(das_deref(__context__,____this_rename_at_46_104,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_46_26 *>::clear(__context__,____this_rename_at_46_104);
+}
+
+inline bool _Func_lambda_thismodule_46_27Tickfunction_bb17341466c4aa51 ( Context * __context__, _lambda_thismodule_46_27 &  ____this_rename_at_46_105, int32_t & ___yield_46_rename_at_46_106 )
+{
+    switch (____this_rename_at_46_105.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_46_105._loop_at_47_12,true);
+    das_move(____this_rename_at_46_105._source_0_at_47_12,____this_rename_at_46_105.src);
+    memset((void*)&(____this_rename_at_46_105.__w_rename_at_47_17), 0, 4);
+    das_copy(____this_rename_at_46_105._pvar_0_at_47_12,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_46_105.__w_rename_at_47_17)));
+    DAS_SETBOOLAND((____this_rename_at_46_105._loop_at_47_12),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_46_105._source_0_at_47_12),____this_rename_at_46_105._pvar_0_at_47_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_46_105._loop_at_47_12 )
+    {
+        goto label_4;
+    };
+    das_copy(___yield_46_rename_at_46_106,das_invoke_lambda<int32_t>::invoke<int32_t>(__context__,nullptr,____this_rename_at_46_105.blk,____this_rename_at_46_105.__w_rename_at_47_17));
+    das_copy(____this_rename_at_46_105.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_46_105._loop_at_47_12),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_46_105._source_0_at_47_12),____this_rename_at_46_105._pvar_0_at_47_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_46_105._source_0_at_47_12),____this_rename_at_46_105._pvar_0_at_47_12,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_46_27Tickfinalizer_47b44357a235464e ( Context * __context__, _lambda_thismodule_46_27 * ____this_rename_at_46_107 )
+{
+    finalize_ce54b4b3dece547c(__context__,das_arg<_lambda_thismodule_46_27>::pass(das_deref(__context__,____this_rename_at_46_107,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_46_27 *>::clear(__context__,____this_rename_at_46_107);
+}
+
+inline TTuple<8,int32_t,float> _FuncbuiltinTickcopy_to_localTick18007282088148548588_cf5b4d36c641ec89 ( Context * __context__, TTuple<8,int32_t,float> const  &  __a_rename_at_1055_108 )
+{
+    return das_auto_cast_ref<TTuple<8,int32_t,float>>::cast(das_cast<TTuple<8,int32_t,float>>::cast(__a_rename_at_1055_108));
+}
+
+inline bool _Func_lambda_thismodule_46_28Tickfunction_4b6a017341fe0abc ( Context * __context__, _lambda_thismodule_46_28 &  ____this_rename_at_46_109, TTuple<8,int32_t,float> &  ___yield_46_rename_at_46_110 )
+{
+    switch (____this_rename_at_46_109.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_46_109._loop_at_47_12,true);
+    das_move(____this_rename_at_46_109._source_0_at_47_12,____this_rename_at_46_109.src);
+    memset((void*)&(____this_rename_at_46_109.__w_rename_at_47_17), 0, 4);
+    das_copy(____this_rename_at_46_109._pvar_0_at_47_12,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_46_109.__w_rename_at_47_17)));
+    DAS_SETBOOLAND((____this_rename_at_46_109._loop_at_47_12),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_46_109._source_0_at_47_12),____this_rename_at_46_109._pvar_0_at_47_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_46_109._loop_at_47_12 )
+    {
+        goto label_4;
+    };
+    das_copy(___yield_46_rename_at_46_110,_FuncbuiltinTickcopy_to_localTick18007282088148548588_cf5b4d36c641ec89(__context__,das_arg<TTuple<8,int32_t,float>>::pass(das_invoke_lambda<TTuple<8,int32_t,float>>::invoke_cmres<int32_t>(__context__,nullptr,____this_rename_at_46_109.blk,____this_rename_at_46_109.__w_rename_at_47_17))));
+    das_copy(____this_rename_at_46_109.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_46_109._loop_at_47_12),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_46_109._source_0_at_47_12),____this_rename_at_46_109._pvar_0_at_47_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_46_109._source_0_at_47_12),____this_rename_at_46_109._pvar_0_at_47_12,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_46_28Tickfinalizer_1e6b86880ccb6112 ( Context * __context__, _lambda_thismodule_46_28 * ____this_rename_at_46_111 )
+{
+    finalize_cb863a01181cc563(__context__,das_arg<_lambda_thismodule_46_28>::pass(das_deref(__context__,____this_rename_at_46_111,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_46_28 *>::clear(__context__,____this_rename_at_46_111);
+}
+
+inline bool _Func_lambda_thismodule_46_29Tickfunction_c76a3c5f83d93d5e ( Context * __context__, _lambda_thismodule_46_29 &  ____this_rename_at_46_112, bool & ___yield_46_rename_at_46_113 )
+{
+    switch (____this_rename_at_46_112.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_46_112._loop_at_47_12,true);
+    das_move(____this_rename_at_46_112._source_0_at_47_12,____this_rename_at_46_112.src);
+    memset((void*)&(____this_rename_at_46_112.__w_rename_at_47_17), 0, 4);
+    das_copy(____this_rename_at_46_112._pvar_0_at_47_12,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_46_112.__w_rename_at_47_17)));
+    DAS_SETBOOLAND((____this_rename_at_46_112._loop_at_47_12),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_46_112._source_0_at_47_12),____this_rename_at_46_112._pvar_0_at_47_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_46_112._loop_at_47_12 )
+    {
+        goto label_4;
+    };
+    das_copy(___yield_46_rename_at_46_113,das_invoke_lambda<bool>::invoke<int32_t>(__context__,nullptr,____this_rename_at_46_112.blk,____this_rename_at_46_112.__w_rename_at_47_17));
+    das_copy(____this_rename_at_46_112.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_46_112._loop_at_47_12),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_46_112._source_0_at_47_12),____this_rename_at_46_112._pvar_0_at_47_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_46_112._source_0_at_47_12),____this_rename_at_46_112._pvar_0_at_47_12,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_46_29Tickfinalizer_ca4e9b0da58741b3 ( Context * __context__, _lambda_thismodule_46_29 * ____this_rename_at_46_114 )
+{
+    finalize_eb39c4fa0e0aa9cb(__context__,das_arg<_lambda_thismodule_46_29>::pass(das_deref(__context__,____this_rename_at_46_114,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_46_29 *>::clear(__context__,____this_rename_at_46_114);
+}
+
+inline void _FuncTickverify_evenTick14539409462116012840_a41975d7eea83c28 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __iter_rename_at_30_115 )
+{
+    {
+        bool __need_loop_31 = true;
+        // x: int aka TT
+        das_iterator<Sequence DAS_COMMENT((int32_t))> __x_iterator(__iter_rename_at_30_115);
+        int32_t __x_rename_at_31_118;
+        __need_loop_31 = __x_iterator.first(__context__,(__x_rename_at_31_118)) && __need_loop_31;
+        // y: int const
+        das_iterator<range> __y_iterator(range(0,50));
+        int32_t __y_rename_at_31_119;
+        __need_loop_31 = __y_iterator.first(__context__,(__y_rename_at_31_119)) && __need_loop_31;
+        for ( ; __need_loop_31 ; __need_loop_31 = __x_iterator.next(__context__,(__x_rename_at_31_118)) && __y_iterator.next(__context__,(__y_rename_at_31_119)) )
+        {
+            DAS_ASSERT((__x_rename_at_31_118 == (__y_rename_at_31_119 * 2)));
+        }
+        __y_iterator.close(__context__,(__y_rename_at_31_119));
+        __x_iterator.close(__context__,(__x_rename_at_31_118));
+    };
+}
+
+inline bool _FuncTickis_sameTick245538717971957847_90778dcd8fe04dee ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __a_rename_at_56_120, Sequence DAS_COMMENT((int32_t)) &  __b_rename_at_56_121 )
+{
+    {
+        bool __need_loop_57 = true;
+        // x: int
+        das_iterator<Sequence DAS_COMMENT((int32_t))> __x_iterator(__a_rename_at_56_120);
+        int32_t __x_rename_at_57_124;
+        __need_loop_57 = __x_iterator.first(__context__,(__x_rename_at_57_124)) && __need_loop_57;
+        // y: int
+        das_iterator<Sequence DAS_COMMENT((int32_t))> __y_iterator(__b_rename_at_56_121);
+        int32_t __y_rename_at_57_125;
+        __need_loop_57 = __y_iterator.first(__context__,(__y_rename_at_57_125)) && __need_loop_57;
+        for ( ; __need_loop_57 ; __need_loop_57 = __x_iterator.next(__context__,(__x_rename_at_57_124)) && __y_iterator.next(__context__,(__y_rename_at_57_125)) )
+        {
+            if ( __x_rename_at_57_124 != __y_rename_at_57_125 )
+            {
+                return das_auto_cast<bool>::cast(false);
+            };
+        }
+        __y_iterator.close(__context__,(__y_rename_at_57_125));
+        __x_iterator.close(__context__,(__x_rename_at_57_124));
+    };
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline void finalize_62288b18c551cda5 ( Context * __context__, _lambda_thismodule_12_21 &  ____this_rename_at_12_126 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_12_126._source_0_at_13_12),__context__);
+    memset((void*)&(____this_rename_at_12_126), 0, 72);
+}
+
+inline void finalize_c1432cdb99d257fc ( Context * __context__, _lambda_thismodule_12_22 &  ____this_rename_at_12_127 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_12_127._source_0_at_13_12),__context__);
+    memset((void*)&(____this_rename_at_12_127), 0, 72);
+}
+
+inline void finalize_7e876d36e44179ae ( Context * __context__, _lambda_thismodule_115_23 &  ____this_rename_at_115_128 )
+{
+    memset((void*)&(____this_rename_at_115_128), 0, 16);
+}
+
+inline void _FuncbuiltinTickpush_cloneTick2035469273396957942_b74d0b46559deb03 ( Context * __context__, TArray<TTuple<8,int32_t,float>> &  __Arr_rename_at_393_129, TTuple<8,int32_t,float> &  __value_rename_at_393_130 )
+{
+    das_copy(__Arr_rename_at_393_129(builtin_array_push_back_zero(das_arg<TArray<TTuple<8,int32_t,float>>>::pass(__Arr_rename_at_393_129),8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_393_130);
+}
+
+inline bool _Func_lambda_thismodule_211_24Tickfunction_1529e8e196031a1 ( Context * __context__, _lambda_thismodule_211_24 &  ____this_rename_at_211_131, TTuple<8,int32_t,float> * & ___ryield211_rename_at_211_132 )
+{
+    switch (____this_rename_at_211_131.__yield) {
+    case 0: goto label_0;
+    case 8: goto label_8;
+    case 1: goto label_1;
+    case 9: goto label_9;
+    case 10: goto label_10;
+    case 6: goto label_6;
+    case 3: goto label_3;
+    case 2: goto label_2;
+    case 4: goto label_4;
+    case 5: goto label_5;
+    case 7: goto label_7;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    memset((void*)&(____this_rename_at_211_131.arr), 0, 24);
+    das_copy(____this_rename_at_211_131._loop_at_213_12,true);
+    das_move(____this_rename_at_211_131._source_0_at_213_12,____this_rename_at_211_131.src);
+    memset((void*)&(____this_rename_at_211_131.__x_rename_at_213_17), 0, 8);
+    das_copy(____this_rename_at_211_131._pvar_0_at_213_12,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_211_131.__x_rename_at_213_17)));
+    DAS_SETBOOLAND((____this_rename_at_211_131._loop_at_213_12),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_211_131._source_0_at_213_12),____this_rename_at_211_131._pvar_0_at_213_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_8:;;
+    if ( !____this_rename_at_211_131._loop_at_213_12 )
+    {
+        goto label_10;
+    };
+    das_copy(___ryield211_rename_at_211_132,das_ref(__context__,____this_rename_at_211_131.__x_rename_at_213_17));
+    das_copy(____this_rename_at_211_131.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    _FuncbuiltinTickpush_cloneTick2035469273396957942_b74d0b46559deb03(__context__,das_arg<TArray<TTuple<8,int32_t,float>>>::pass(____this_rename_at_211_131.arr),das_arg<TTuple<8,int32_t,float>>::pass(____this_rename_at_211_131.__x_rename_at_213_17));
+    label_9:;;
+    DAS_SETBOOLAND((____this_rename_at_211_131._loop_at_213_12),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_211_131._source_0_at_213_12),____this_rename_at_211_131._pvar_0_at_213_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_8;
+    label_10:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_211_131._source_0_at_213_12),____this_rename_at_211_131._pvar_0_at_213_12,__context__);
+    label_6:;;
+    das_copy(____this_rename_at_211_131.___loop_at_218_16_rename_at_218_16,true);
+    das_move(____this_rename_at_211_131.___source_0_at_218_16_rename_at_218_16,_FuncbuiltinTickeachTick6002865651812066953_e372b165824f649d(__context__,das_arg<TArray<TTuple<8,int32_t,float>>>::pass(____this_rename_at_211_131.arr)));
+    memset((void*)&(____this_rename_at_211_131.__x_rename_at_218_21), 0, 8);
+    das_copy(____this_rename_at_211_131.___pvar_0_at_218_16_rename_at_218_16,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_211_131.__x_rename_at_218_21)));
+    DAS_SETBOOLAND((____this_rename_at_211_131.___loop_at_218_16_rename_at_218_16),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_211_131.___source_0_at_218_16_rename_at_218_16),____this_rename_at_211_131.___pvar_0_at_218_16_rename_at_218_16,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_3:;;
+    if ( !____this_rename_at_211_131.___loop_at_218_16_rename_at_218_16 )
+    {
+        goto label_5;
+    };
+    das_copy(___ryield211_rename_at_211_132,das_ref(__context__,das_deref(__context__,____this_rename_at_211_131.__x_rename_at_218_21,__FILE__,__LINE__)));
+    das_copy(____this_rename_at_211_131.__yield,2);
+    return das_auto_cast<bool>::cast(true);
+    label_2:;;
+    label_4:;;
+    DAS_SETBOOLAND((____this_rename_at_211_131.___loop_at_218_16_rename_at_218_16),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_211_131.___source_0_at_218_16_rename_at_218_16),____this_rename_at_211_131.___pvar_0_at_218_16_rename_at_218_16,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_3;
+    label_5:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_211_131.___source_0_at_218_16_rename_at_218_16),____this_rename_at_211_131.___pvar_0_at_218_16_rename_at_218_16,__context__);
+    goto label_6;
+    label_7:;;
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_211_24Tickfinalizer_438ffbc0f98e4f24 ( Context * __context__, _lambda_thismodule_211_24 * ____this_rename_at_211_133 )
+{
+    finalize_81b7faa9db9b97fa(__context__,das_arg<_lambda_thismodule_211_24>::pass(das_deref(__context__,____this_rename_at_211_133,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_211_24 *>::clear(__context__,____this_rename_at_211_133);
+}
+
+inline void finalize_42bcf1754d30f3e6 ( Context * __context__, _lambda_thismodule_197_20 &  ____this_rename_at_197_134 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_197_134._source_0_at_199_12),__context__);
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_197_134.___source_0_at_204_16_rename_at_204_16),__context__);
+    _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_197_134.arr));
+    memset((void*)&(____this_rename_at_197_134), 0, 120);
+}
+
+inline bool _Func_lambda_thismodule_12_21Tickfunction_dc6a1502d70a914b ( Context * __context__, _lambda_thismodule_12_21 &  ____this_rename_at_12_135, int32_t & ___yield_12_rename_at_12_136 )
+{
+    switch (____this_rename_at_12_135.__yield) {
+    case 0: goto label_0;
+    case 3: goto label_3;
+    case 1: goto label_1;
+    case 2: goto label_2;
+    case 4: goto label_4;
+    case 5: goto label_5;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_12_135._loop_at_13_12,true);
+    das_move(____this_rename_at_12_135._source_0_at_13_12,____this_rename_at_12_135.src);
+    memset((void*)&(____this_rename_at_12_135.__w_rename_at_13_17), 0, 4);
+    das_copy(____this_rename_at_12_135._pvar_0_at_13_12,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_12_135.__w_rename_at_13_17)));
+    DAS_SETBOOLAND((____this_rename_at_12_135._loop_at_13_12),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_12_135._source_0_at_13_12),____this_rename_at_12_135._pvar_0_at_13_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_3:;;
+    if ( !____this_rename_at_12_135._loop_at_13_12 )
+    {
+        goto label_5;
+    };
+    if ( !das_invoke_function<bool>::invoke<int32_t>(__context__,nullptr,____this_rename_at_12_135.blk,____this_rename_at_12_135.__w_rename_at_13_17) )
+    {
+        goto label_2;
+    };
+    das_copy(___yield_12_rename_at_12_136,____this_rename_at_12_135.__w_rename_at_13_17);
+    das_copy(____this_rename_at_12_135.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_2:;;
+    label_4:;;
+    DAS_SETBOOLAND((____this_rename_at_12_135._loop_at_13_12),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_12_135._source_0_at_13_12),____this_rename_at_12_135._pvar_0_at_13_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_3;
+    label_5:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_12_135._source_0_at_13_12),____this_rename_at_12_135._pvar_0_at_13_12,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_12_21Tickfinalizer_b47553da6da1d917 ( Context * __context__, _lambda_thismodule_12_21 * ____this_rename_at_12_137 )
+{
+    finalize_62288b18c551cda5(__context__,das_arg<_lambda_thismodule_12_21>::pass(das_deref(__context__,____this_rename_at_12_137,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_12_21 *>::clear(__context__,____this_rename_at_12_137);
+}
+
+inline bool _Func_lambda_thismodule_12_22Tickfunction_8e677566a24aefee ( Context * __context__, _lambda_thismodule_12_22 &  ____this_rename_at_12_138, int32_t & ___yield_12_rename_at_12_139 )
+{
+    switch (____this_rename_at_12_138.__yield) {
+    case 0: goto label_0;
+    case 3: goto label_3;
+    case 1: goto label_1;
+    case 2: goto label_2;
+    case 4: goto label_4;
+    case 5: goto label_5;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_12_138._loop_at_13_12,true);
+    das_move(____this_rename_at_12_138._source_0_at_13_12,____this_rename_at_12_138.src);
+    memset((void*)&(____this_rename_at_12_138.__w_rename_at_13_17), 0, 4);
+    das_copy(____this_rename_at_12_138._pvar_0_at_13_12,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_12_138.__w_rename_at_13_17)));
+    DAS_SETBOOLAND((____this_rename_at_12_138._loop_at_13_12),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_12_138._source_0_at_13_12),____this_rename_at_12_138._pvar_0_at_13_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_3:;;
+    if ( !____this_rename_at_12_138._loop_at_13_12 )
+    {
+        goto label_5;
+    };
+    if ( !das_invoke_lambda<bool>::invoke<int32_t>(__context__,nullptr,____this_rename_at_12_138.blk,____this_rename_at_12_138.__w_rename_at_13_17) )
+    {
+        goto label_2;
+    };
+    das_copy(___yield_12_rename_at_12_139,____this_rename_at_12_138.__w_rename_at_13_17);
+    das_copy(____this_rename_at_12_138.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_2:;;
+    label_4:;;
+    DAS_SETBOOLAND((____this_rename_at_12_138._loop_at_13_12),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_12_138._source_0_at_13_12),____this_rename_at_12_138._pvar_0_at_13_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_3;
+    label_5:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_12_138._source_0_at_13_12),____this_rename_at_12_138._pvar_0_at_13_12,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_12_22Tickfinalizer_c78986e767b672d2 ( Context * __context__, _lambda_thismodule_12_22 * ____this_rename_at_12_140 )
+{
+    finalize_c1432cdb99d257fc(__context__,das_arg<_lambda_thismodule_12_22>::pass(das_deref(__context__,____this_rename_at_12_140,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_12_22 *>::clear(__context__,____this_rename_at_12_140);
+}
+
+inline bool _Func_lambda_thismodule_115_23Tickfunction_e14f1bfe624fc6d6 ( Context * __context__, _lambda_thismodule_115_23 &  ____this_rename_at_115_141, TArray<int32_t> const  &  __x_rename_at_115_142 )
+{
+    return das_auto_cast<bool>::cast((SimPolicy<int32_t>::Mod(__x_rename_at_115_142(0,__context__),2,*__context__,nullptr)) == 0);
+}
+
+inline void _Func_lambda_thismodule_115_23Tickfinalizer_dbec80ebd1dc3ee7 ( Context * __context__, _lambda_thismodule_115_23 * ____this_rename_at_115_143 )
+{
+    finalize_7e876d36e44179ae(__context__,das_arg<_lambda_thismodule_115_23>::pass(das_deref(__context__,____this_rename_at_115_143,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_115_23 *>::clear(__context__,____this_rename_at_115_143);
+}
+
+inline void finalize_b3040909745498b4 ( Context * __context__, _lambda_thismodule_230_19 &  ____this_rename_at_230_144 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_230_144._source_0_at_231_12),__context__);
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_230_144._source_1_at_231_12),__context__);
+    memset((void*)&(____this_rename_at_230_144), 0, 96);
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _FuncfunctionalTickfilter_anyTick8436123068441528563_ae7e887ff20f69cc ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  __src_rename_at_9_145, Lambda DAS_COMMENT((bool,TArray<int32_t> const )) __blk_rename_at_9_146 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t> &))>::cast(_FuncbuiltinTickeach_refTick16137060296763333387_61841c1791c9b95f(__context__,das_ascend<bool,_lambda_thismodule_21_30>::make(__context__,&__type_info__d8adf10f1316c01e,(([&]() -> _lambda_thismodule_21_30 {
+        _lambda_thismodule_21_30 __mks_21;
+        das_zero(__mks_21);
+        das_copy((__mks_21.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_21_30`function XS<_lambda_thismodule_21_30> &1<1<i>A>?*/ 0xc44019847bec1654))));
+        das_copy((__mks_21.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_21_30`finalizer X1<S<_lambda_thismodule_21_30>>?*/ 0x7e1800b9918c1272))));
+        das_move((__mks_21.blk),(__blk_rename_at_9_146));
+        das_move((__mks_21.src),(__src_rename_at_9_145));
+        return __mks_21;
+    })()))));
+}
+
+inline void _FuncbuiltinTickpushTick10769833213962245646_b2287abd57a15f1f ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_193_147, int32_t __value_rename_at_193_148 )
+{
+    das_copy(__Arr_rename_at_193_147(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_193_147),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_193_148);
+}
+
+inline bool _Func_lambda_thismodule_197_20Tickfunction_eee30c808afe7a78 ( Context * __context__, _lambda_thismodule_197_20 &  ____this_rename_at_197_149, int32_t & ___yield_197_rename_at_197_150 )
+{
+    switch (____this_rename_at_197_149.__yield) {
+    case 0: goto label_0;
+    case 8: goto label_8;
+    case 1: goto label_1;
+    case 9: goto label_9;
+    case 10: goto label_10;
+    case 6: goto label_6;
+    case 3: goto label_3;
+    case 2: goto label_2;
+    case 4: goto label_4;
+    case 5: goto label_5;
+    case 7: goto label_7;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    memset((void*)&(____this_rename_at_197_149.arr), 0, 24);
+    das_copy(____this_rename_at_197_149._loop_at_199_12,true);
+    das_move(____this_rename_at_197_149._source_0_at_199_12,____this_rename_at_197_149.src);
+    memset((void*)&(____this_rename_at_197_149.__x_rename_at_199_17), 0, 4);
+    das_copy(____this_rename_at_197_149._pvar_0_at_199_12,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_197_149.__x_rename_at_199_17)));
+    DAS_SETBOOLAND((____this_rename_at_197_149._loop_at_199_12),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_197_149._source_0_at_199_12),____this_rename_at_197_149._pvar_0_at_199_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_8:;;
+    if ( !____this_rename_at_197_149._loop_at_199_12 )
+    {
+        goto label_10;
+    };
+    das_copy(___yield_197_rename_at_197_150,____this_rename_at_197_149.__x_rename_at_199_17);
+    das_copy(____this_rename_at_197_149.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    _FuncbuiltinTickpushTick10769833213962245646_b2287abd57a15f1f(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_197_149.arr),____this_rename_at_197_149.__x_rename_at_199_17);
+    label_9:;;
+    DAS_SETBOOLAND((____this_rename_at_197_149._loop_at_199_12),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_197_149._source_0_at_199_12),____this_rename_at_197_149._pvar_0_at_199_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_8;
+    label_10:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_197_149._source_0_at_199_12),____this_rename_at_197_149._pvar_0_at_199_12,__context__);
+    label_6:;;
+    das_copy(____this_rename_at_197_149.___loop_at_204_16_rename_at_204_16,true);
+    das_move(____this_rename_at_197_149.___source_0_at_204_16_rename_at_204_16,_FuncbuiltinTickeachTick6002865651812066953_693fb4484d509206(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_197_149.arr)));
+    memset((void*)&(____this_rename_at_197_149.__x_rename_at_204_21), 0, 8);
+    das_copy(____this_rename_at_197_149.___pvar_0_at_204_16_rename_at_204_16,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_197_149.__x_rename_at_204_21)));
+    DAS_SETBOOLAND((____this_rename_at_197_149.___loop_at_204_16_rename_at_204_16),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_197_149.___source_0_at_204_16_rename_at_204_16),____this_rename_at_197_149.___pvar_0_at_204_16_rename_at_204_16,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_3:;;
+    if ( !____this_rename_at_197_149.___loop_at_204_16_rename_at_204_16 )
+    {
+        goto label_5;
+    };
+    das_copy(___yield_197_rename_at_197_150,das_deref(__context__,____this_rename_at_197_149.__x_rename_at_204_21,__FILE__,__LINE__));
+    das_copy(____this_rename_at_197_149.__yield,2);
+    return das_auto_cast<bool>::cast(true);
+    label_2:;;
+    label_4:;;
+    DAS_SETBOOLAND((____this_rename_at_197_149.___loop_at_204_16_rename_at_204_16),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_197_149.___source_0_at_204_16_rename_at_204_16),____this_rename_at_197_149.___pvar_0_at_204_16_rename_at_204_16,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_3;
+    label_5:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_197_149.___source_0_at_204_16_rename_at_204_16),____this_rename_at_197_149.___pvar_0_at_204_16_rename_at_204_16,__context__);
+    goto label_6;
+    label_7:;;
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_197_20Tickfinalizer_25873a1f018a00f7 ( Context * __context__, _lambda_thismodule_197_20 * ____this_rename_at_197_151 )
+{
+    finalize_42bcf1754d30f3e6(__context__,das_arg<_lambda_thismodule_197_20>::pass(das_deref(__context__,____this_rename_at_197_151,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_197_20 *>::clear(__context__,____this_rename_at_197_151);
+}
+
+inline void finalize_89df3979aba5e810 ( Context * __context__, _lambda_thismodule_95_14 &  ____this_rename_at_95_152 )
+{
+    memset((void*)&(____this_rename_at_95_152), 0, 16);
+}
+
+inline int32_t _FuncfunctionalTickreduce_anyTick10888502122296883119_91f3953a535f4618 ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) &  __it_rename_at_88_153, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  __functor_rename_at_88_154 )
+{
+    int32_t __left_rename_at_90_155 = 0;
+    bool __first_rename_at_91_156 = true;
+    {
+        bool __need_loop_92 = true;
+        // right: int aka TT const&
+        das_iterator<Sequence DAS_COMMENT((int32_t const ))> __right_iterator(__it_rename_at_88_153);
+        int32_t const  * __right_rename_at_92_157;
+        __need_loop_92 = __right_iterator.first(__context__,(__right_rename_at_92_157)) && __need_loop_92;
+        for ( ; __need_loop_92 ; __need_loop_92 = __right_iterator.next(__context__,(__right_rename_at_92_157)) )
+        {
+            if ( __first_rename_at_91_156 )
+            {
+                das_copy(__first_rename_at_91_156,false);
+                das_copy(__left_rename_at_90_155,(*__right_rename_at_92_157));
+            } else {
+                das_copy(__left_rename_at_90_155,das_invoke<int32_t>::invoke<int32_t,int32_t>(__context__,nullptr,__functor_rename_at_88_154,__left_rename_at_90_155,(*__right_rename_at_92_157)));
+            };
+        }
+        __right_iterator.close(__context__,(__right_rename_at_92_157));
+    };
+    if ( __first_rename_at_91_156 )
+    {
+        builtin_throw(((char *) "can't reduce empty sequence"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    };
+    return das_auto_cast<int32_t>::cast(__left_rename_at_90_155);
+}
+
+inline void finalize_bad70fc7c4a20b23 ( Context * __context__, _lambda_thismodule_139_15 &  ____this_rename_at_139_158 )
+{
+    memset((void*)&(____this_rename_at_139_158), 0, 16);
+}
+
+inline void finalize_66d38afb2a354c1 ( Context * __context__, _lambda_thismodule_187_16 &  ____this_rename_at_187_159 )
+{
+    memset((void*)&(____this_rename_at_187_159), 0, 16);
+}
+
+inline void finalize_7c209bed83355de7 ( Context * __context__, _lambda_thismodule_196_17 &  ____this_rename_at_196_160 )
+{
+    memset((void*)&(____this_rename_at_196_160), 0, 16);
+}
+
+inline void finalize_598a8a4cb50aa870 ( Context * __context__, _lambda_thismodule_204_18 &  ____this_rename_at_204_161 )
+{
+    memset((void*)&(____this_rename_at_204_161), 0, 16);
+}
+
+inline void _FuncbuiltinTickpush_cloneTick2035469273396957942_c2961e1e4b6c33a6 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_393_162, int32_t __value_rename_at_393_163 )
+{
+    das_copy(__Arr_rename_at_393_162(builtin_array_push_back_zero(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_393_162),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_393_163);
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_68_164, int32_t __newSize_rename_at_68_165 )
+{
+    builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_68_164),__newSize_rename_at_68_165,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline bool _Func_lambda_thismodule_230_19Tickfunction_b9e2ca9378874572 ( Context * __context__, _lambda_thismodule_230_19 &  ____this_rename_at_230_166, int32_t & ___yield_230_rename_at_230_167 )
+{
+    switch (____this_rename_at_230_166.__yield) {
+    case 0: goto label_0;
+    case 3: goto label_3;
+    case 1: goto label_1;
+    case 2: goto label_2;
+    case 4: goto label_4;
+    case 5: goto label_5;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_230_166._loop_at_231_12,true);
+    das_move(____this_rename_at_230_166._source_0_at_231_12,____this_rename_at_230_166.src);
+    memset((void*)&(____this_rename_at_230_166.__x_rename_at_231_17), 0, 4);
+    das_copy(____this_rename_at_230_166._pvar_0_at_231_12,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_230_166.__x_rename_at_231_17)));
+    DAS_SETBOOLAND((____this_rename_at_230_166._loop_at_231_12),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_230_166._source_0_at_231_12),____this_rename_at_230_166._pvar_0_at_231_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    das_move(____this_rename_at_230_166._source_1_at_231_12,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,mk_range(____this_rename_at_230_166.stop)));
+    memset((void*)&(____this_rename_at_230_166.__i_rename_at_231_20), 0, 4);
+    das_copy(____this_rename_at_230_166._pvar_1_at_231_12,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_230_166.__i_rename_at_231_20)));
+    DAS_SETBOOLAND((____this_rename_at_230_166._loop_at_231_12),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_230_166._source_1_at_231_12),____this_rename_at_230_166._pvar_1_at_231_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_3:;;
+    if ( !____this_rename_at_230_166._loop_at_231_12 )
+    {
+        goto label_5;
+    };
+    if ( !(____this_rename_at_230_166.__i_rename_at_231_20 >= ____this_rename_at_230_166.start) )
+    {
+        goto label_2;
+    };
+    das_copy(___yield_230_rename_at_230_167,____this_rename_at_230_166.__x_rename_at_231_17);
+    das_copy(____this_rename_at_230_166.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_2:;;
+    label_4:;;
+    DAS_SETBOOLAND((____this_rename_at_230_166._loop_at_231_12),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_230_166._source_0_at_231_12),____this_rename_at_230_166._pvar_0_at_231_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    DAS_SETBOOLAND((____this_rename_at_230_166._loop_at_231_12),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_230_166._source_1_at_231_12),____this_rename_at_230_166._pvar_1_at_231_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_3;
+    label_5:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_230_166._source_0_at_231_12),____this_rename_at_230_166._pvar_0_at_231_12,__context__);
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_230_166._source_1_at_231_12),____this_rename_at_230_166._pvar_1_at_231_12,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_230_19Tickfinalizer_f638c8ae7033c789 ( Context * __context__, _lambda_thismodule_230_19 * ____this_rename_at_230_168 )
+{
+    finalize_b3040909745498b4(__context__,das_arg<_lambda_thismodule_230_19>::pass(das_deref(__context__,____this_rename_at_230_168,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_230_19 *>::clear(__context__,____this_rename_at_230_168);
+}
+
+inline void _FuncTickverify_14Tick7691774253321735872_558fc829306e5cd4 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  __t_rename_at_65_169 )
+{
+    {
+        bool __need_loop_66 = true;
+        // x: int const
+        das_iterator<range> __x_iterator(range(1,4));
+        int32_t __x_rename_at_66_172;
+        __need_loop_66 = __x_iterator.first(__context__,(__x_rename_at_66_172)) && __need_loop_66;
+        // y: array<int>
+        das_iterator<Sequence DAS_COMMENT((TArray<int32_t>))> __y_iterator(__t_rename_at_65_169);
+        TArray<int32_t> __y_rename_at_66_173;
+        __need_loop_66 = __y_iterator.first(__context__,(__y_rename_at_66_173)) && __need_loop_66;
+        for ( ; __need_loop_66 ; __need_loop_66 = __x_iterator.next(__context__,(__x_rename_at_66_172)) && __y_iterator.next(__context__,(__y_rename_at_66_173)) )
+        {
+            DAS_ASSERT(((__y_rename_at_66_173(0,__context__) == __x_rename_at_66_172) && (__y_rename_at_66_173(1,__context__) == 2)));
+        }
+        __y_iterator.close(__context__,(__y_rename_at_66_173));
+        __x_iterator.close(__context__,(__x_rename_at_66_172));
+    };
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _FuncfunctionalTickfilterTick17052258911568430960_b5ac07160cdff423 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  __src_rename_at_32_174, Lambda DAS_COMMENT((bool,TArray<int32_t> const )) const  __blk_rename_at_32_175 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t> &))>::cast(_FuncfunctionalTickfilter_anyTick8436123068441528563_ae7e887ff20f69cc(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__src_rename_at_32_174),__blk_rename_at_32_175));
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _FuncfunctionalTickcycleTick13989071893922639452_e88690305df5dba6 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  __src_rename_at_194_176 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t> &))>::cast(_FuncbuiltinTickeach_refTick16137060296763333387_61841c1791c9b95f(__context__,das_ascend<bool,_lambda_thismodule_211_25>::make(__context__,&__type_info__adb468a23ca6055f,(([&]() -> _lambda_thismodule_211_25 {
+        _lambda_thismodule_211_25 __mks_211;
+        das_zero(__mks_211);
+        das_copy((__mks_211.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_211_25`function XS<_lambda_thismodule_211_25> &1<1<i>A>?*/ 0xeaa8e30454204d62))));
+        das_copy((__mks_211.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_211_25`finalizer X1<S<_lambda_thismodule_211_25>>?*/ 0xe5b9a949147c3126))));
+        das_move((__mks_211.src),(__src_rename_at_194_176));
+        return __mks_211;
+    })()))));
+}
+
+inline void finalize_f644eb195de1df44 ( Context * __context__, _lambda_thismodule_80_10 &  ____this_rename_at_80_177 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_80_177._source_0_at_80_29),__context__);
+    memset((void*)&(____this_rename_at_80_177), 0, 48);
+}
+
+inline void finalize_f1103f2c3f9d49da ( Context * __context__, _lambda_thismodule_114_11 &  ____this_rename_at_114_178 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_114_178._source_0_at_114_22),__context__);
+    memset((void*)&(____this_rename_at_114_178), 0, 48);
+}
+
+inline void finalize_612f25fea13eacd7 ( Context * __context__, _lambda_thismodule_264_12 &  ____this_rename_at_264_179 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_264_179._source_0_at_264_18),__context__);
+    memset((void*)&(____this_rename_at_264_179), 0, 48);
+}
+
+inline void finalize_28116c91cb7e7e32 ( Context * __context__, _lambda_thismodule_267_13 &  ____this_rename_at_267_180 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_267_180._source_0_at_267_26),__context__);
+    memset((void*)&(____this_rename_at_267_180), 0, 48);
+}
+
+inline void _FuncTickverify_evenTick14539409462116012840_247cf6e92f558dd ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) &  __iter_rename_at_30_181 )
+{
+    {
+        bool __need_loop_31 = true;
+        // x: int aka TT const&
+        das_iterator<Sequence DAS_COMMENT((int32_t const ))> __x_iterator(__iter_rename_at_30_181);
+        int32_t const  * __x_rename_at_31_184;
+        __need_loop_31 = __x_iterator.first(__context__,(__x_rename_at_31_184)) && __need_loop_31;
+        // y: int const
+        das_iterator<range> __y_iterator(range(0,50));
+        int32_t __y_rename_at_31_185;
+        __need_loop_31 = __y_iterator.first(__context__,(__y_rename_at_31_185)) && __need_loop_31;
+        for ( ; __need_loop_31 ; __need_loop_31 = __x_iterator.next(__context__,(__x_rename_at_31_184)) && __y_iterator.next(__context__,(__y_rename_at_31_185)) )
+        {
+            DAS_ASSERT(((*__x_rename_at_31_184) == (__y_rename_at_31_185 * 2)));
+        }
+        __y_iterator.close(__context__,(__y_rename_at_31_185));
+        __x_iterator.close(__context__,(__x_rename_at_31_184));
+    };
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _FuncbuiltinTickeachTick9663565701927713696_f0f9ca53bb972a42 ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t>)) const  __lam_rename_at_1443_186 )
+{
+    Sequence DAS_COMMENT((TArray<int32_t>)) __it_rename_at_1445_187;das_zero(__it_rename_at_1445_187);
+    builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__it_rename_at_1445_187),__lam_rename_at_1443_186,24,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t>))>::cast(__it_rename_at_1445_187);
+}
+
+inline bool _Func_lambda_thismodule_95_14Tickfunction_41f4c7be3e839885 ( Context * __context__, _lambda_thismodule_95_14 &  ____this_rename_at_95_188, int32_t __x_rename_at_95_189 )
+{
+    return das_auto_cast<bool>::cast((SimPolicy<int32_t>::Mod(__x_rename_at_95_189,2,*__context__,nullptr)) == 0);
+}
+
+inline void _Func_lambda_thismodule_95_14Tickfinalizer_221f3b5c59b2f23e ( Context * __context__, _lambda_thismodule_95_14 * ____this_rename_at_95_190 )
+{
+    finalize_89df3979aba5e810(__context__,das_arg<_lambda_thismodule_95_14>::pass(das_deref(__context__,____this_rename_at_95_190,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_95_14 *>::clear(__context__,____this_rename_at_95_190);
+}
+
+inline int32_t _FuncfunctionalTickreduceTick3841530652084879893_b6f97e92cc2dae31 ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) &  __it_rename_at_125_191, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  __blk_rename_at_125_192 )
+{
+    return das_auto_cast<int32_t>::cast(_FuncfunctionalTickreduce_anyTick10888502122296883119_91f3953a535f4618(__context__,das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_125_191),__blk_rename_at_125_192));
+}
+
+inline int32_t _Func_lambda_thismodule_139_15Tickfunction_e5004b4a611d1a05 ( Context * __context__, _lambda_thismodule_139_15 &  ____this_rename_at_139_193, int32_t __x_rename_at_139_194, int32_t __y_rename_at_139_195 )
+{
+    return das_auto_cast<int32_t>::cast(__x_rename_at_139_194 + __y_rename_at_139_195);
+}
+
+inline void _Func_lambda_thismodule_139_15Tickfinalizer_e90829968738666b ( Context * __context__, _lambda_thismodule_139_15 * ____this_rename_at_139_196 )
+{
+    finalize_bad70fc7c4a20b23(__context__,das_arg<_lambda_thismodule_139_15>::pass(das_deref(__context__,____this_rename_at_139_196,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_139_15 *>::clear(__context__,____this_rename_at_139_196);
+}
+
+inline bool _Func_lambda_thismodule_187_16Tickfunction_d1e0f62285a7694a ( Context * __context__, _lambda_thismodule_187_16 &  ____this_rename_at_187_197, int32_t __x_rename_at_187_198 )
+{
+    return das_auto_cast<bool>::cast(__x_rename_at_187_198 > 30);
+}
+
+inline void _Func_lambda_thismodule_187_16Tickfinalizer_c0e055b2452d95a3 ( Context * __context__, _lambda_thismodule_187_16 * ____this_rename_at_187_199 )
+{
+    finalize_66d38afb2a354c1(__context__,das_arg<_lambda_thismodule_187_16>::pass(das_deref(__context__,____this_rename_at_187_199,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_187_16 *>::clear(__context__,____this_rename_at_187_199);
+}
+
+inline bool _Func_lambda_thismodule_196_17Tickfunction_84aa853197614018 ( Context * __context__, _lambda_thismodule_196_17 &  ____this_rename_at_196_200, int32_t __x_rename_at_196_201 )
+{
+    return das_auto_cast<bool>::cast(__x_rename_at_196_201 < 100);
+}
+
+inline void _Func_lambda_thismodule_196_17Tickfinalizer_c5e37037ab3a54f8 ( Context * __context__, _lambda_thismodule_196_17 * ____this_rename_at_196_202 )
+{
+    finalize_7c209bed83355de7(__context__,das_arg<_lambda_thismodule_196_17>::pass(das_deref(__context__,____this_rename_at_196_202,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_196_17 *>::clear(__context__,____this_rename_at_196_202);
+}
+
+inline bool _Func_lambda_thismodule_204_18Tickfunction_4718dbf6cf74bea9 ( Context * __context__, _lambda_thismodule_204_18 &  ____this_rename_at_204_203, int32_t __x_rename_at_204_204 )
+{
+    return das_auto_cast<bool>::cast(__x_rename_at_204_204 > 0);
+}
+
+inline void _Func_lambda_thismodule_204_18Tickfinalizer_123173ed11fd8cc9 ( Context * __context__, _lambda_thismodule_204_18 * ____this_rename_at_204_205 )
+{
+    finalize_598a8a4cb50aa870(__context__,das_arg<_lambda_thismodule_204_18>::pass(das_deref(__context__,____this_rename_at_204_205,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_204_18 *>::clear(__context__,____this_rename_at_204_205);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_arrayTick9505582033551971916_e5f10801382c0f4 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __it_rename_at_1477_206 )
+{
+    TArray<int32_t> __arr_rename_at_1478_207;das_zero(__arr_rename_at_1478_207);
+    {
+        bool __need_loop_1482 = true;
+        // x: int aka TT
+        das_iterator<Sequence DAS_COMMENT((int32_t))> __x_iterator(__it_rename_at_1477_206);
+        int32_t __x_rename_at_1482_208;
+        __need_loop_1482 = __x_iterator.first(__context__,(__x_rename_at_1482_208)) && __need_loop_1482;
+        for ( ; __need_loop_1482 ; __need_loop_1482 = __x_iterator.next(__context__,(__x_rename_at_1482_208)) )
+        {
+            _FuncbuiltinTickpush_cloneTick2035469273396957942_c2961e1e4b6c33a6(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1478_207),__x_rename_at_1482_208);
+        }
+        __x_iterator.close(__context__,(__x_rename_at_1482_208));
+    };
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1478_207);
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _FuncfunctionalTickcycleTick13989071893922639452_18378972141a1c5 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) &  __src_rename_at_194_209 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &))>::cast(_FuncbuiltinTickeach_refTick16137060296763333387_7462031b9a3d3d2e(__context__,das_ascend<bool,_lambda_thismodule_211_24>::make(__context__,&__type_info__adb467a23ca603ac,(([&]() -> _lambda_thismodule_211_24 {
+        _lambda_thismodule_211_24 __mks_211;
+        das_zero(__mks_211);
+        das_copy((__mks_211.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_211_24`function XS<_lambda_thismodule_211_24> &1<0<i;f>U>?*/ 0x54b9463e6e36039))));
+        das_copy((__mks_211.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_211_24`finalizer X1<S<_lambda_thismodule_211_24>>?*/ 0x69928f7327f479cd))));
+        das_move((__mks_211.src),(__src_rename_at_194_209));
+        return __mks_211;
+    })()))));
+}
+
+inline void finalize_cb36ba2e25782d6b ( Context * __context__, _lambda_thismodule_265_3 &  ____this_rename_at_265_210 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_265_210._source_0_at_271_8),__context__);
+    memset((void*)&(____this_rename_at_265_210), 0, 56);
+}
+
+inline void finalize_62b17dfd9f1d0712 ( Context * __context__, _lambda_thismodule_74_4 &  ____this_rename_at_74_211 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_74_211._source_0_at_74_31),__context__);
+    memset((void*)&(____this_rename_at_74_211), 0, 48);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickfilter_anyTick8436123068441528563_cf9abcab74536fb8 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_9_212, Func DAS_COMMENT((bool,int32_t)) __blk_rename_at_9_213 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_FuncbuiltinTickeachTick9663565701927713696_38bf4259f235eb1a(__context__,das_ascend<bool,_lambda_thismodule_12_21>::make(__context__,&__type_info__f31ea558214348ca,(([&]() -> _lambda_thismodule_12_21 {
+        _lambda_thismodule_12_21 __mks_12;
+        das_zero(__mks_12);
+        das_copy((__mks_12.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_12_21`function XS<_lambda_thismodule_12_21> &i*/ 0xc5bbdafd39321c))));
+        das_copy((__mks_12.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_12_21`finalizer X1<S<_lambda_thismodule_12_21>>?*/ 0xf3aa6c85267db316))));
+        das_move((__mks_12.blk),(__blk_rename_at_9_213));
+        das_move((__mks_12.src),(__src_rename_at_9_212));
+        return __mks_12;
+    })()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickfilter_anyTick8436123068441528563_da357379b896e3f5 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_9_214, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_9_215 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_FuncbuiltinTickeachTick9663565701927713696_38bf4259f235eb1a(__context__,das_ascend<bool,_lambda_thismodule_12_22>::make(__context__,&__type_info__fd50a55829ecc3ca,(([&]() -> _lambda_thismodule_12_22 {
+        _lambda_thismodule_12_22 __mks_12;
+        das_zero(__mks_12);
+        das_copy((__mks_12.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_12_22`function XS<_lambda_thismodule_12_22> &i*/ 0x1f50001ec52770dd))));
+        das_copy((__mks_12.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_12_22`finalizer X1<S<_lambda_thismodule_12_22>>?*/ 0x8762b91b4b949b16))));
+        das_move((__mks_12.blk),(__blk_rename_at_9_215));
+        das_move((__mks_12.src),(__src_rename_at_9_214));
+        return __mks_12;
+    })()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickmap_anyTick4479995923280306007_6024d756272a5506 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_43_216, Func DAS_COMMENT((int32_t,int32_t)) __blk_rename_at_43_217 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_FuncbuiltinTickeachTick9663565701927713696_38bf4259f235eb1a(__context__,das_ascend<bool,_lambda_thismodule_46_26>::make(__context__,&__type_info__df51ab11a09302d6,(([&]() -> _lambda_thismodule_46_26 {
+        _lambda_thismodule_46_26 __mks_46;
+        das_zero(__mks_46);
+        das_copy((__mks_46.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_46_26`function XS<_lambda_thismodule_46_26> &i*/ 0x876c646d12212406))));
+        das_copy((__mks_46.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_46_26`finalizer X1<S<_lambda_thismodule_46_26>>?*/ 0x3bb7222d4a18bfd6))));
+        das_move((__mks_46.blk),(__blk_rename_at_43_217));
+        das_move((__mks_46.src),(__src_rename_at_43_216));
+        return __mks_46;
+    })()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickmap_anyTick4479995923280306007_83291c8f47dbbb44 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_43_218, Lambda DAS_COMMENT((int32_t,int32_t)) __blk_rename_at_43_219 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_FuncbuiltinTickeachTick9663565701927713696_38bf4259f235eb1a(__context__,das_ascend<bool,_lambda_thismodule_46_27>::make(__context__,&__type_info__dbebab119dafd9d6,(([&]() -> _lambda_thismodule_46_27 {
+        _lambda_thismodule_46_27 __mks_46;
+        das_zero(__mks_46);
+        das_copy((__mks_46.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_46_27`function XS<_lambda_thismodule_46_27> &i*/ 0x6b72822af85c2cb1))));
+        das_copy((__mks_46.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_46_27`finalizer X1<S<_lambda_thismodule_46_27>>?*/ 0x4a0c213804aa0fd6))));
+        das_move((__mks_46.blk),(__blk_rename_at_43_219));
+        das_move((__mks_46.src),(__src_rename_at_43_218));
+        return __mks_46;
+    })()))));
+}
+
+inline int32_t _FuncfunctionalTickreduce_anyTick10888502122296883119_8b35df0f139e9bed ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __it_rename_at_88_220, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  __functor_rename_at_88_221 )
+{
+    int32_t __left_rename_at_90_222 = 0;
+    bool __first_rename_at_91_223 = true;
+    {
+        bool __need_loop_92 = true;
+        // right: int aka TT
+        das_iterator<Sequence DAS_COMMENT((int32_t))> __right_iterator(__it_rename_at_88_220);
+        int32_t __right_rename_at_92_224;
+        __need_loop_92 = __right_iterator.first(__context__,(__right_rename_at_92_224)) && __need_loop_92;
+        for ( ; __need_loop_92 ; __need_loop_92 = __right_iterator.next(__context__,(__right_rename_at_92_224)) )
+        {
+            if ( __first_rename_at_91_223 )
+            {
+                das_copy(__first_rename_at_91_223,false);
+                das_copy(__left_rename_at_90_222,__right_rename_at_92_224);
+            } else {
+                das_copy(__left_rename_at_90_222,das_invoke<int32_t>::invoke<int32_t,int32_t>(__context__,nullptr,__functor_rename_at_88_221,__left_rename_at_90_222,__right_rename_at_92_224));
+            };
+        }
+        __right_iterator.close(__context__,(__right_rename_at_92_224));
+    };
+    if ( __first_rename_at_91_223 )
+    {
+        builtin_throw(((char *) "can't reduce empty sequence"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    };
+    return das_auto_cast<int32_t>::cast(__left_rename_at_90_222);
+}
+
+inline void finalize_a279035facdd537 ( Context * __context__, _lambda_thismodule_130_5 &  ____this_rename_at_130_225 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_130_225._source_0_at_130_22),__context__);
+    memset((void*)&(____this_rename_at_130_225), 0, 48);
+}
+
+inline int32_t _FuncfunctionalTickreduce_anyTick10888502122296883119_d6c8298b3db4c09d ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __it_rename_at_88_226, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  __functor_rename_at_88_227 )
+{
+    int32_t __left_rename_at_90_228 = 0;
+    bool __first_rename_at_91_229 = true;
+    {
+        bool __need_loop_92 = true;
+        // right: int aka TT
+        das_iterator<Sequence DAS_COMMENT((int32_t))> __right_iterator(__it_rename_at_88_226);
+        int32_t __right_rename_at_92_230;
+        __need_loop_92 = __right_iterator.first(__context__,(__right_rename_at_92_230)) && __need_loop_92;
+        for ( ; __need_loop_92 ; __need_loop_92 = __right_iterator.next(__context__,(__right_rename_at_92_230)) )
+        {
+            if ( __first_rename_at_91_229 )
+            {
+                das_copy(__first_rename_at_91_229,false);
+                das_copy(__left_rename_at_90_228,__right_rename_at_92_230);
+            } else {
+                das_copy(__left_rename_at_90_228,das_invoke_lambda<int32_t>::invoke<int32_t,int32_t>(__context__,nullptr,__functor_rename_at_88_227,__left_rename_at_90_228,__right_rename_at_92_230));
+            };
+        }
+        __right_iterator.close(__context__,(__right_rename_at_92_230));
+    };
+    if ( __first_rename_at_91_229 )
+    {
+        builtin_throw(((char *) "can't reduce empty sequence"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    };
+    return das_auto_cast<int32_t>::cast(__left_rename_at_90_228);
+}
+
+inline int32_t _FuncfunctionalTickreduce_anyTick10888502122296883119_616d986e179b8b90 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __it_rename_at_88_231, Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  __functor_rename_at_88_232 )
+{
+    int32_t __left_rename_at_90_233 = 0;
+    bool __first_rename_at_91_234 = true;
+    {
+        bool __need_loop_92 = true;
+        // right: int aka TT
+        das_iterator<Sequence DAS_COMMENT((int32_t))> __right_iterator(__it_rename_at_88_231);
+        int32_t __right_rename_at_92_235;
+        __need_loop_92 = __right_iterator.first(__context__,(__right_rename_at_92_235)) && __need_loop_92;
+        for ( ; __need_loop_92 ; __need_loop_92 = __right_iterator.next(__context__,(__right_rename_at_92_235)) )
+        {
+            if ( __first_rename_at_91_234 )
+            {
+                das_copy(__first_rename_at_91_234,false);
+                das_copy(__left_rename_at_90_233,__right_rename_at_92_235);
+            } else {
+                das_copy(__left_rename_at_90_233,das_invoke_function<int32_t>::invoke<int32_t,int32_t>(__context__,nullptr,__functor_rename_at_88_232,__left_rename_at_90_233,__right_rename_at_92_235));
+            };
+        }
+        __right_iterator.close(__context__,(__right_rename_at_92_235));
+    };
+    if ( __first_rename_at_91_234 )
+    {
+        builtin_throw(((char *) "can't reduce empty sequence"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    };
+    return das_auto_cast<int32_t>::cast(__left_rename_at_90_233);
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _FuncfunctionalTickmap_anyTick4479995923280306007_c7dd7fda4ce435b2 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_43_236, Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) __blk_rename_at_43_237 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::cast(_FuncbuiltinTickeachTick9663565701927713696_403560d62bbc8525(__context__,das_ascend<bool,_lambda_thismodule_46_28>::make(__context__,&__type_info__caedab118f400cd6,(([&]() -> _lambda_thismodule_46_28 {
+        _lambda_thismodule_46_28 __mks_46;
+        das_zero(__mks_46);
+        das_copy((__mks_46.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_46_28`function XS<_lambda_thismodule_46_28> 0<i;f>U*/ 0x6660c73b6335cb9a))));
+        das_copy((__mks_46.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_46_28`finalizer X1<S<_lambda_thismodule_46_28>>?*/ 0x9120aaac73a113d6))));
+        das_move((__mks_46.blk),(__blk_rename_at_43_237));
+        das_move((__mks_46.src),(__src_rename_at_43_236));
+        return __mks_46;
+    })()))));
+}
+
+inline Sequence DAS_COMMENT((bool)) _FuncfunctionalTickmap_anyTick4479995923280306007_1ca21edec6aad716 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_43_238, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_43_239 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((bool))>::cast(_FuncbuiltinTickeachTick9663565701927713696_c6a9cdebae4e9e7f(__context__,das_ascend<bool,_lambda_thismodule_46_29>::make(__context__,&__type_info__c787ab118c5ce3d6,(([&]() -> _lambda_thismodule_46_29 {
+        _lambda_thismodule_46_29 __mks_46;
+        das_zero(__mks_46);
+        das_copy((__mks_46.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_46_29`function XS<_lambda_thismodule_46_29> &b*/ 0x4d1bcb3d5e8a3d7a))));
+        das_copy((__mks_46.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_46_29`finalizer X1<S<_lambda_thismodule_46_29>>?*/ 0xc7c7edc683cdd3d6))));
+        das_move((__mks_46.blk),(__blk_rename_at_43_239));
+        das_move((__mks_46.src),(__src_rename_at_43_238));
+        return __mks_46;
+    })()))));
+}
+
+inline void finalize_b0b0293ec1ad9f13 ( Context * __context__, _lambda_thismodule_251_6 &  ____this_rename_at_251_240 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_251_240._source_0_at_251_26),__context__);
+    memset((void*)&(____this_rename_at_251_240), 0, 48);
+}
+
+inline void finalize_31cc77b2547050ca ( Context * __context__, _lambda_thismodule_256_7 &  ____this_rename_at_256_241 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_256_241._source_0_at_256_18),__context__);
+    memset((void*)&(____this_rename_at_256_241), 0, 48);
+}
+
+inline void finalize_6539699a4f0bba06 ( Context * __context__, _lambda_thismodule_259_8 &  ____this_rename_at_259_242 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_259_242._source_0_at_259_26),__context__);
+    memset((void*)&(____this_rename_at_259_242), 0, 48);
+}
+
+inline void finalize_fa5ef013837c31d7 ( Context * __context__, _lambda_thismodule_271_9 &  ____this_rename_at_271_243 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_271_243._source_0_at_271_25),__context__);
+    memset((void*)&(____this_rename_at_271_243), 0, 48);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickeachTick9663565701927713696_38bf4259f235eb1a ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_1443_244 )
+{
+    Sequence DAS_COMMENT((int32_t)) __it_rename_at_1445_245;das_zero(__it_rename_at_1445_245);
+    builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_1445_245),__lam_rename_at_1443_244,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_1445_245);
+}
+
+inline Sequence DAS_COMMENT((int32_t &)) _FuncbuiltinTickeach_refTick16137060296763333387_c02a41a483b3f169 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t const  * &)) const  __lam_rename_at_1453_246 )
+{
+    Sequence DAS_COMMENT((int32_t *)) __it_rename_at_1454_247;das_zero(__it_rename_at_1454_247);
+    builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_1454_247),__lam_rename_at_1453_246,8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t &))>::cast(__it_rename_at_1454_247);
+}
+
+inline bool _Func_lambda_thismodule_80_10Tickfunction_3c937939c9fac98d ( Context * __context__, _lambda_thismodule_80_10 &  ____this_rename_at_80_248, TArray<int32_t> &  ___yield_80_rename_at_80_249 )
+{
+    TDim<int32_t,2> _temp_make_local_80_52_3; _temp_make_local_80_52_3;
+    switch (____this_rename_at_80_248.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_80_248._loop_at_80_29,true);
+    das_move(____this_rename_at_80_248._source_0_at_80_29,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(1,4)));
+    memset((void*)&(____this_rename_at_80_248.__x_rename_at_80_33), 0, 4);
+    das_copy(____this_rename_at_80_248._pvar_0_at_80_29,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_80_248.__x_rename_at_80_33)));
+    DAS_SETBOOLAND((____this_rename_at_80_248._loop_at_80_29),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_80_248._source_0_at_80_29),____this_rename_at_80_248._pvar_0_at_80_29,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_80_248._loop_at_80_29 )
+    {
+        goto label_4;
+    };
+    das_move(___yield_80_rename_at_80_249,_FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+        _temp_make_local_80_52_3(0,__context__) = ____this_rename_at_80_248.__x_rename_at_80_33;
+        _temp_make_local_80_52_3(1,__context__) = 2;
+        return _temp_make_local_80_52_3;
+    })()))));
+    das_copy(____this_rename_at_80_248.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_80_248._loop_at_80_29),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_80_248._source_0_at_80_29),____this_rename_at_80_248._pvar_0_at_80_29,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_80_248._source_0_at_80_29),____this_rename_at_80_248._pvar_0_at_80_29,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_80_10Tickfinalizer_305dc02b66553696 ( Context * __context__, _lambda_thismodule_80_10 * ____this_rename_at_80_250 )
+{
+    finalize_f644eb195de1df44(__context__,das_arg<_lambda_thismodule_80_10>::pass(das_deref(__context__,____this_rename_at_80_250,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_80_10 *>::clear(__context__,____this_rename_at_80_250);
+}
+
+inline void _FuncbuiltinTickemplaceTick13923705686753630697_908411b5f172f3d6 ( Context * __context__, TArray<TArray<int32_t>> &  __Arr_rename_at_301_251, TArray<int32_t> &  __value_rename_at_301_252 )
+{
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_2,cast<TArray<TArray<int32_t>> &>::from(__Arr_rename_at_301_251),cast<char * const >::from(((char *) "array can't be emplaced to because it contains locked elements"))));
+    das_move(__Arr_rename_at_301_251(builtin_array_push_back(das_arg<TArray<TArray<int32_t>>>::pass(__Arr_rename_at_301_251),24,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_301_252);
+}
+
+inline void _FuncTickverify_14Tick7691774253321735872_210d806253f397db ( Context * __context__, TArray<TArray<int32_t>> &  __t_rename_at_65_253 )
+{
+    {
+        bool __need_loop_66 = true;
+        // x: int const
+        das_iterator<range> __x_iterator(range(1,4));
+        int32_t __x_rename_at_66_256;
+        __need_loop_66 = __x_iterator.first(__context__,(__x_rename_at_66_256)) && __need_loop_66;
+        // y: array<int>&
+        das_iterator<TArray<TArray<int32_t>>> __y_iterator(__t_rename_at_65_253);
+        TArray<int32_t> * __y_rename_at_66_257;
+        __need_loop_66 = __y_iterator.first(__context__,(__y_rename_at_66_257)) && __need_loop_66;
+        for ( ; __need_loop_66 ; __need_loop_66 = __x_iterator.next(__context__,(__x_rename_at_66_256)) && __y_iterator.next(__context__,(__y_rename_at_66_257)) )
+        {
+            DAS_ASSERT((((*__y_rename_at_66_257)(0,__context__) == __x_rename_at_66_256) && ((*__y_rename_at_66_257)(1,__context__) == 2)));
+        }
+        __y_iterator.close(__context__,(__y_rename_at_66_257));
+        __x_iterator.close(__context__,(__x_rename_at_66_256));
+    };
+}
+
+inline bool _Func_lambda_thismodule_114_11Tickfunction_6bd9593925568168 ( Context * __context__, _lambda_thismodule_114_11 &  ____this_rename_at_114_258, TArray<int32_t> &  ___yield_114_rename_at_114_259 )
+{
+    TDim<int32_t,2> _temp_make_local_114_44_4; _temp_make_local_114_44_4;
+    switch (____this_rename_at_114_258.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_114_258._loop_at_114_22,true);
+    das_move(____this_rename_at_114_258._source_0_at_114_22,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,100)));
+    memset((void*)&(____this_rename_at_114_258.__x_rename_at_114_26), 0, 4);
+    das_copy(____this_rename_at_114_258._pvar_0_at_114_22,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_114_258.__x_rename_at_114_26)));
+    DAS_SETBOOLAND((____this_rename_at_114_258._loop_at_114_22),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_114_258._source_0_at_114_22),____this_rename_at_114_258._pvar_0_at_114_22,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_114_258._loop_at_114_22 )
+    {
+        goto label_4;
+    };
+    das_move(___yield_114_rename_at_114_259,_FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+        _temp_make_local_114_44_4(0,__context__) = ____this_rename_at_114_258.__x_rename_at_114_26;
+        _temp_make_local_114_44_4(1,__context__) = 2;
+        return _temp_make_local_114_44_4;
+    })()))));
+    das_copy(____this_rename_at_114_258.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_114_258._loop_at_114_22),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_114_258._source_0_at_114_22),____this_rename_at_114_258._pvar_0_at_114_22,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_114_258._source_0_at_114_22),____this_rename_at_114_258._pvar_0_at_114_22,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_114_11Tickfinalizer_a5b4847c5ce5a138 ( Context * __context__, _lambda_thismodule_114_11 * ____this_rename_at_114_260 )
+{
+    finalize_f1103f2c3f9d49da(__context__,das_arg<_lambda_thismodule_114_11>::pass(das_deref(__context__,____this_rename_at_114_260,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_114_11 *>::clear(__context__,____this_rename_at_114_260);
+}
+
+inline TArray<int32_t> & _FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 ( Context * __context__, TArray<int32_t> &  __a_rename_at_50_261 )
+{
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_4,cast<TArray<int32_t> &>::from(__a_rename_at_50_261),cast<char * const >::from(((char *) "object can't be returned because it is locked"))));
+    return das_auto_cast_ref<TArray<int32_t> &>::cast(__a_rename_at_50_261);
+}
+
+inline bool _FuncfunctionalTickis_equalTick13663318146853733238_ab1cff754c041ab7 ( Context * __context__, int32_t __a_rename_at_278_262, int32_t __b_rename_at_278_263 )
+{
+    return das_auto_cast<bool>::cast(__a_rename_at_278_262 == __b_rename_at_278_263);
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _FuncbuiltinTickeachTick9663565701927713696_403560d62bbc8525 ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float>)) const  __lam_rename_at_1443_264 )
+{
+    Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) __it_rename_at_1445_265;das_zero(__it_rename_at_1445_265);
+    builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(__it_rename_at_1445_265),__lam_rename_at_1443_264,8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::cast(__it_rename_at_1445_265);
+}
+
+inline bool _Func_lambda_thismodule_264_12Tickfunction_54c8b26adfbe6824 ( Context * __context__, _lambda_thismodule_264_12 &  ____this_rename_at_264_266, TArray<int32_t> &  ___yield_264_rename_at_264_267 )
+{
+    TDim<int32_t,2> _temp_make_local_264_41_5; _temp_make_local_264_41_5;
+    switch (____this_rename_at_264_266.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_264_266._loop_at_264_18,true);
+    das_move(____this_rename_at_264_266._source_0_at_264_18,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(1,4)));
+    memset((void*)&(____this_rename_at_264_266.__x_rename_at_264_22), 0, 4);
+    das_copy(____this_rename_at_264_266._pvar_0_at_264_18,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_264_266.__x_rename_at_264_22)));
+    DAS_SETBOOLAND((____this_rename_at_264_266._loop_at_264_18),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_264_266._source_0_at_264_18),____this_rename_at_264_266._pvar_0_at_264_18,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_264_266._loop_at_264_18 )
+    {
+        goto label_4;
+    };
+    das_move(___yield_264_rename_at_264_267,_FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+        _temp_make_local_264_41_5(0,__context__) = ____this_rename_at_264_266.__x_rename_at_264_22;
+        _temp_make_local_264_41_5(1,__context__) = 2;
+        return _temp_make_local_264_41_5;
+    })()))));
+    das_copy(____this_rename_at_264_266.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_264_266._loop_at_264_18),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_264_266._source_0_at_264_18),____this_rename_at_264_266._pvar_0_at_264_18,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_264_266._source_0_at_264_18),____this_rename_at_264_266._pvar_0_at_264_18,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_264_12Tickfinalizer_70bc360bf5cc37dc ( Context * __context__, _lambda_thismodule_264_12 * ____this_rename_at_264_268 )
+{
+    finalize_612f25fea13eacd7(__context__,das_arg<_lambda_thismodule_264_12>::pass(das_deref(__context__,____this_rename_at_264_268,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_264_12 *>::clear(__context__,____this_rename_at_264_268);
+}
+
+inline bool _Func_lambda_thismodule_267_13Tickfunction_2a097cd137ff1ae1 ( Context * __context__, _lambda_thismodule_267_13 &  ____this_rename_at_267_269, TArray<int32_t> &  ___yield_267_rename_at_267_270 )
+{
+    TDim<int32_t,2> _temp_make_local_267_47_6; _temp_make_local_267_47_6;
+    switch (____this_rename_at_267_269.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_267_269._loop_at_267_26,true);
+    das_move(____this_rename_at_267_269._source_0_at_267_26,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,10)));
+    memset((void*)&(____this_rename_at_267_269.__x_rename_at_267_30), 0, 4);
+    das_copy(____this_rename_at_267_269._pvar_0_at_267_26,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_267_269.__x_rename_at_267_30)));
+    DAS_SETBOOLAND((____this_rename_at_267_269._loop_at_267_26),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_267_269._source_0_at_267_26),____this_rename_at_267_269._pvar_0_at_267_26,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_267_269._loop_at_267_26 )
+    {
+        goto label_4;
+    };
+    das_move(___yield_267_rename_at_267_270,_FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+        _temp_make_local_267_47_6(0,__context__) = ((SimPolicy<int32_t>::Mod(____this_rename_at_267_269.__x_rename_at_267_30,3,*__context__,nullptr)) + 1);
+        _temp_make_local_267_47_6(1,__context__) = 2;
+        return _temp_make_local_267_47_6;
+    })()))));
+    das_copy(____this_rename_at_267_269.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_267_269._loop_at_267_26),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_267_269._source_0_at_267_26),____this_rename_at_267_269._pvar_0_at_267_26,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_267_269._source_0_at_267_26),____this_rename_at_267_269._pvar_0_at_267_26,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_267_13Tickfinalizer_59ec7061b5053592 ( Context * __context__, _lambda_thismodule_267_13 * ____this_rename_at_267_271 )
+{
+    finalize_28116c91cb7e7e32(__context__,das_arg<_lambda_thismodule_267_13>::pass(das_deref(__context__,____this_rename_at_267_271,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_267_13 *>::clear(__context__,____this_rename_at_267_271);
+}
+
+inline void finalize_b86adca48494f93d ( Context * __context__, _lambda_thismodule_109_1 &  ____this_rename_at_109_272 )
+{
+    memset((void*)&(____this_rename_at_109_272), 0, 16);
+}
+
+inline void finalize_b0cb4b9f8708f3b3 ( Context * __context__, _lambda_thismodule_163_2 &  ____this_rename_at_163_273 )
+{
+    memset((void*)&(____this_rename_at_163_273), 0, 16);
+}
+
+inline bool _Func_lambda_thismodule_265_3Tickfunction_2781a4c515b28b11 ( Context * __context__, _lambda_thismodule_265_3 &  ____this_rename_at_265_274, int32_t & ___yield_265_rename_at_265_275 )
+{
+    switch (____this_rename_at_265_274.__yield) {
+    case 0: goto label_0;
+    case 1: goto label_1;
+    case 7: goto label_7;
+    case 2: goto label_2;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    case 8: goto label_8;
+    case 5: goto label_5;
+    case 6: goto label_6;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    if ( !(____this_rename_at_265_274.count == 0) )
+    {
+        goto label_3;
+    };
+    label_1:;;
+    das_copy(___yield_265_rename_at_265_275,____this_rename_at_265_274.value);
+    das_copy(____this_rename_at_265_274.__yield,7);
+    return das_auto_cast<bool>::cast(true);
+    label_7:;;
+    goto label_1;
+    label_2:;;
+    label_3:;;
+    das_copy(____this_rename_at_265_274._loop_at_271_8,true);
+    das_move(____this_rename_at_265_274._source_0_at_271_8,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,mk_range(____this_rename_at_265_274.count)));
+    memset((void*)&(____this_rename_at_265_274.__x_rename_at_271_13), 0, 4);
+    das_copy(____this_rename_at_265_274._pvar_0_at_271_8,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_265_274.__x_rename_at_271_13)));
+    DAS_SETBOOLAND((____this_rename_at_265_274._loop_at_271_8),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_265_274._source_0_at_271_8),____this_rename_at_265_274._pvar_0_at_271_8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_4:;;
+    if ( !____this_rename_at_265_274._loop_at_271_8 )
+    {
+        goto label_6;
+    };
+    das_copy(___yield_265_rename_at_265_275,____this_rename_at_265_274.value);
+    das_copy(____this_rename_at_265_274.__yield,8);
+    return das_auto_cast<bool>::cast(true);
+    label_8:;;
+    label_5:;;
+    DAS_SETBOOLAND((____this_rename_at_265_274._loop_at_271_8),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_265_274._source_0_at_271_8),____this_rename_at_265_274._pvar_0_at_271_8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_4;
+    label_6:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_265_274._source_0_at_271_8),____this_rename_at_265_274._pvar_0_at_271_8,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_265_3Tickfinalizer_bb465553714d8a66 ( Context * __context__, _lambda_thismodule_265_3 * ____this_rename_at_265_276 )
+{
+    finalize_cb36ba2e25782d6b(__context__,das_arg<_lambda_thismodule_265_3>::pass(das_deref(__context__,____this_rename_at_265_276,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_265_3 *>::clear(__context__,____this_rename_at_265_276);
+}
+
+inline bool _Func_lambda_thismodule_74_4Tickfunction_a153f2b76711af8f ( Context * __context__, _lambda_thismodule_74_4 &  ____this_rename_at_74_277, int32_t const  * & ___ryield74_rename_at_74_278 )
+{
+    switch (____this_rename_at_74_277.__yield) {
+    case 0: goto label_0;
+    case 3: goto label_3;
+    case 1: goto label_1;
+    case 2: goto label_2;
+    case 4: goto label_4;
+    case 5: goto label_5;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_74_277._loop_at_74_31,true);
+    das_move(____this_rename_at_74_277._source_0_at_74_31,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,100)));
+    memset((void*)&(____this_rename_at_74_277.__x_rename_at_74_35), 0, 4);
+    das_copy(____this_rename_at_74_277._pvar_0_at_74_31,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_74_277.__x_rename_at_74_35)));
+    DAS_SETBOOLAND((____this_rename_at_74_277._loop_at_74_31),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_74_277._source_0_at_74_31),____this_rename_at_74_277._pvar_0_at_74_31,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_3:;;
+    if ( !____this_rename_at_74_277._loop_at_74_31 )
+    {
+        goto label_5;
+    };
+    if ( !((SimPolicy<int32_t>::Mod(____this_rename_at_74_277.__x_rename_at_74_35,2,*__context__,nullptr)) == 0) )
+    {
+        goto label_2;
+    };
+    das_copy(___ryield74_rename_at_74_278,das_ref(__context__,____this_rename_at_74_277.__x_rename_at_74_35));
+    das_copy(____this_rename_at_74_277.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_2:;;
+    label_4:;;
+    DAS_SETBOOLAND((____this_rename_at_74_277._loop_at_74_31),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_74_277._source_0_at_74_31),____this_rename_at_74_277._pvar_0_at_74_31,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_3;
+    label_5:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_74_277._source_0_at_74_31),____this_rename_at_74_277._pvar_0_at_74_31,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_74_4Tickfinalizer_afac0294c48ec518 ( Context * __context__, _lambda_thismodule_74_4 * ____this_rename_at_74_279 )
+{
+    finalize_62b17dfd9f1d0712(__context__,das_arg<_lambda_thismodule_74_4>::pass(das_deref(__context__,____this_rename_at_74_279,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_74_4 *>::clear(__context__,____this_rename_at_74_279);
+}
+
+inline void _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_177_280, int32_t __value_rename_at_177_281 )
+{
+    das_copy(__Arr_rename_at_177_280(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_177_280),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_177_281);
+}
+
+inline void _FuncTickverify_evenTick16438837766850132515_8c37383502cdd9d4 ( Context * __context__, TArray<int32_t> const  &  __arr_rename_at_23_282 )
+{
+    {
+        bool __need_loop_24 = true;
+        // x: int const&
+        das_iterator<TArray<int32_t> const > __x_iterator(__arr_rename_at_23_282);
+        int32_t const  * __x_rename_at_24_285;
+        __need_loop_24 = __x_iterator.first(__context__,(__x_rename_at_24_285)) && __need_loop_24;
+        // y: int const
+        das_iterator<range> __y_iterator(range(0,50));
+        int32_t __y_rename_at_24_286;
+        __need_loop_24 = __y_iterator.first(__context__,(__y_rename_at_24_286)) && __need_loop_24;
+        for ( ; __need_loop_24 ; __need_loop_24 = __x_iterator.next(__context__,(__x_rename_at_24_285)) && __y_iterator.next(__context__,(__y_rename_at_24_286)) )
+        {
+            DAS_ASSERT(((*__x_rename_at_24_285) == (__y_rename_at_24_286 * 2)));
+        }
+        __y_iterator.close(__context__,(__y_rename_at_24_286));
+        __x_iterator.close(__context__,(__x_rename_at_24_285));
+    };
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickfilterTick2611906363669329552_b14e0f0747da1864 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_38_287, Func DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_38_288 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_FuncfunctionalTickfilter_anyTick8436123068441528563_cf9abcab74536fb8(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_38_287),__blk_rename_at_38_288));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickfilterTick17052258911568430960_c5b51d79366e68ab ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_32_289, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_32_290 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_FuncfunctionalTickfilter_anyTick8436123068441528563_da357379b896e3f5(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_32_289),__blk_rename_at_32_290));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickmapTick1994230664415641751_9824beb79d88ab9b ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_82_291, Func DAS_COMMENT((int32_t,int32_t)) const  __blk_rename_at_82_292 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_FuncfunctionalTickmap_anyTick4479995923280306007_6024d756272a5506(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_82_291),__blk_rename_at_82_292));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickmapTick3767370688684665805_f8ebf27fc6d50619 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_76_293, Lambda DAS_COMMENT((int32_t,int32_t)) const  __blk_rename_at_76_294 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_FuncfunctionalTickmap_anyTick4479995923280306007_83291c8f47dbbb44(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_76_293),__blk_rename_at_76_294));
+}
+
+inline int32_t _FuncfunctionalTickreduceTick3841530652084879893_4e6a88b61e02101d ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __it_rename_at_125_295, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  __blk_rename_at_125_296 )
+{
+    return das_auto_cast<int32_t>::cast(_FuncfunctionalTickreduce_anyTick10888502122296883119_8b35df0f139e9bed(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_125_295),__blk_rename_at_125_296));
+}
+
+inline bool _Func_lambda_thismodule_130_5Tickfunction_3c6eacc4fad58ddb ( Context * __context__, _lambda_thismodule_130_5 &  ____this_rename_at_130_297, int32_t const  * & ___ryield130_rename_at_130_298 )
+{
+    switch (____this_rename_at_130_297.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_130_297._loop_at_130_22,true);
+    das_move(____this_rename_at_130_297._source_0_at_130_22,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,10)));
+    memset((void*)&(____this_rename_at_130_297.__x_rename_at_130_26), 0, 4);
+    das_copy(____this_rename_at_130_297._pvar_0_at_130_22,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_130_297.__x_rename_at_130_26)));
+    DAS_SETBOOLAND((____this_rename_at_130_297._loop_at_130_22),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_130_297._source_0_at_130_22),____this_rename_at_130_297._pvar_0_at_130_22,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_130_297._loop_at_130_22 )
+    {
+        goto label_4;
+    };
+    das_copy(___ryield130_rename_at_130_298,das_ref(__context__,____this_rename_at_130_297.__x_rename_at_130_26));
+    das_copy(____this_rename_at_130_297.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_130_297._loop_at_130_22),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_130_297._source_0_at_130_22),____this_rename_at_130_297._pvar_0_at_130_22,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_130_297._source_0_at_130_22),____this_rename_at_130_297._pvar_0_at_130_22,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_130_5Tickfinalizer_83528de467f2bb86 ( Context * __context__, _lambda_thismodule_130_5 * ____this_rename_at_130_299 )
+{
+    finalize_a279035facdd537(__context__,das_arg<_lambda_thismodule_130_5>::pass(das_deref(__context__,____this_rename_at_130_299,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_130_5 *>::clear(__context__,____this_rename_at_130_299);
+}
+
+inline int32_t _FuncfunctionalTickreduceTick3815634954217254421_637b69df14cebf47 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __it_rename_at_111_300, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  __blk_rename_at_111_301 )
+{
+    return das_auto_cast<int32_t>::cast(_FuncfunctionalTickreduce_anyTick10888502122296883119_d6c8298b3db4c09d(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_111_300),__blk_rename_at_111_301));
+}
+
+inline int32_t _FuncfunctionalTickreduceTick12199344316191013487_ce2eb4d61b1b6a52 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __it_rename_at_118_302, Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  __blk_rename_at_118_303 )
+{
+    return das_auto_cast<int32_t>::cast(_FuncfunctionalTickreduce_anyTick10888502122296883119_616d986e179b8b90(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_118_302),__blk_rename_at_118_303));
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _FuncfunctionalTickmapTick3767370688684665805_210e299a5936eafc ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_76_304, Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) const  __blk_rename_at_76_305 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::cast(_FuncfunctionalTickmap_anyTick4479995923280306007_c7dd7fda4ce435b2(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_76_304),__blk_rename_at_76_305));
+}
+
+inline int32_t _FuncfunctionalTicksumTick17873460401295886850_17c4e2f4f54c1187 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __it_rename_at_132_306 )
+{
+    int32_t __temp_rename_at_135_307 = 0;
+    {
+        bool __need_loop_136 = true;
+        // x: int aka TT
+        das_iterator<Sequence DAS_COMMENT((int32_t))> __x_iterator(__it_rename_at_132_306);
+        int32_t __x_rename_at_136_308;
+        __need_loop_136 = __x_iterator.first(__context__,(__x_rename_at_136_308)) && __need_loop_136;
+        for ( ; __need_loop_136 ; __need_loop_136 = __x_iterator.next(__context__,(__x_rename_at_136_308)) )
+        {
+            __temp_rename_at_135_307 += __x_rename_at_136_308;
+        }
+        __x_iterator.close(__context__,(__x_rename_at_136_308));
+    };
+    return das_auto_cast<int32_t>::cast(__temp_rename_at_135_307);
+}
+
+inline Sequence DAS_COMMENT((bool)) _FuncfunctionalTickmapTick3767370688684665805_91ba24b601ec1f6a ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_76_309, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_76_310 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((bool))>::cast(_FuncfunctionalTickmap_anyTick4479995923280306007_1ca21edec6aad716(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_76_309),__blk_rename_at_76_310));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickcycleTick13989071893922639452_52c9b4b9346a07f9 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_194_311 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_FuncbuiltinTickeachTick9663565701927713696_38bf4259f235eb1a(__context__,das_ascend<bool,_lambda_thismodule_197_20>::make(__context__,&__type_info__f8e5c4a88db2f4a8,(([&]() -> _lambda_thismodule_197_20 {
+        _lambda_thismodule_197_20 __mks_197;
+        das_zero(__mks_197);
+        das_copy((__mks_197.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_197_20`function XS<_lambda_thismodule_197_20> &i*/ 0x74ecb644e6b7e6a))));
+        das_copy((__mks_197.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_197_20`finalizer X1<S<_lambda_thismodule_197_20>>?*/ 0x8d563ce68b9f6e86))));
+        das_move((__mks_197.src),(__src_rename_at_194_311));
+        return __mks_197;
+    })()))));
+}
+
+inline bool _Func_lambda_thismodule_251_6Tickfunction_1f5cce243f6a7a42 ( Context * __context__, _lambda_thismodule_251_6 &  ____this_rename_at_251_312, int32_t & ___yield_251_rename_at_251_313 )
+{
+    switch (____this_rename_at_251_312.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_251_312._loop_at_251_26,true);
+    das_move(____this_rename_at_251_312._source_0_at_251_26,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,10)));
+    memset((void*)&(____this_rename_at_251_312.__x_rename_at_251_30), 0, 4);
+    das_copy(____this_rename_at_251_312._pvar_0_at_251_26,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_251_312.__x_rename_at_251_30)));
+    DAS_SETBOOLAND((____this_rename_at_251_312._loop_at_251_26),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_251_312._source_0_at_251_26),____this_rename_at_251_312._pvar_0_at_251_26,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_251_312._loop_at_251_26 )
+    {
+        goto label_4;
+    };
+    das_copy(___yield_251_rename_at_251_313,(SimPolicy<int32_t>::Mod(____this_rename_at_251_312.__x_rename_at_251_30,3,*__context__,nullptr)) + 1);
+    das_copy(____this_rename_at_251_312.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_251_312._loop_at_251_26),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_251_312._source_0_at_251_26),____this_rename_at_251_312._pvar_0_at_251_26,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_251_312._source_0_at_251_26),____this_rename_at_251_312._pvar_0_at_251_26,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_251_6Tickfinalizer_ed9e37bfaf4f898a ( Context * __context__, _lambda_thismodule_251_6 * ____this_rename_at_251_314 )
+{
+    finalize_b0b0293ec1ad9f13(__context__,das_arg<_lambda_thismodule_251_6>::pass(das_deref(__context__,____this_rename_at_251_314,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_251_6 *>::clear(__context__,____this_rename_at_251_314);
+}
+
+inline bool _Func_lambda_thismodule_256_7Tickfunction_8da15827f11974f6 ( Context * __context__, _lambda_thismodule_256_7 &  ____this_rename_at_256_315, TTuple<8,int32_t,float> &  ___yield_256_rename_at_256_316 )
+{
+    switch (____this_rename_at_256_315.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_256_315._loop_at_256_18,true);
+    das_move(____this_rename_at_256_315._source_0_at_256_18,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(1,4)));
+    memset((void*)&(____this_rename_at_256_315.__x_rename_at_256_22), 0, 4);
+    das_copy(____this_rename_at_256_315._pvar_0_at_256_18,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_256_315.__x_rename_at_256_22)));
+    DAS_SETBOOLAND((____this_rename_at_256_315._loop_at_256_18),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_256_315._source_0_at_256_18),____this_rename_at_256_315._pvar_0_at_256_18,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_256_315._loop_at_256_18 )
+    {
+        goto label_4;
+    };
+    das_copy(___yield_256_rename_at_256_316,(([&]() -> TTuple<8,int32_t,float> {
+        TTuple<8,int32_t,float> __mkt_256;
+        das_get_tuple_field<int32_t,0>::get(__mkt_256) = ____this_rename_at_256_315.__x_rename_at_256_22;
+        das_get_tuple_field<float,4>::get(__mkt_256) = 2.500000e+00f;
+        return __mkt_256;
+    })()));
+    das_copy(____this_rename_at_256_315.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_256_315._loop_at_256_18),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_256_315._source_0_at_256_18),____this_rename_at_256_315._pvar_0_at_256_18,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_256_315._source_0_at_256_18),____this_rename_at_256_315._pvar_0_at_256_18,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_256_7Tickfinalizer_d2f7d1de26ba32e1 ( Context * __context__, _lambda_thismodule_256_7 * ____this_rename_at_256_317 )
+{
+    finalize_31cc77b2547050ca(__context__,das_arg<_lambda_thismodule_256_7>::pass(das_deref(__context__,____this_rename_at_256_317,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_256_7 *>::clear(__context__,____this_rename_at_256_317);
+}
+
+inline bool _Func_lambda_thismodule_259_8Tickfunction_6259af6c65cab550 ( Context * __context__, _lambda_thismodule_259_8 &  ____this_rename_at_259_318, TTuple<8,int32_t,float> &  ___yield_259_rename_at_259_319 )
+{
+    switch (____this_rename_at_259_318.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_259_318._loop_at_259_26,true);
+    das_move(____this_rename_at_259_318._source_0_at_259_26,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,10)));
+    memset((void*)&(____this_rename_at_259_318.__x_rename_at_259_30), 0, 4);
+    das_copy(____this_rename_at_259_318._pvar_0_at_259_26,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_259_318.__x_rename_at_259_30)));
+    DAS_SETBOOLAND((____this_rename_at_259_318._loop_at_259_26),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_259_318._source_0_at_259_26),____this_rename_at_259_318._pvar_0_at_259_26,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_259_318._loop_at_259_26 )
+    {
+        goto label_4;
+    };
+    das_copy(___yield_259_rename_at_259_319,(([&]() -> TTuple<8,int32_t,float> {
+        TTuple<8,int32_t,float> __mkt_259;
+        das_get_tuple_field<int32_t,0>::get(__mkt_259) = ((SimPolicy<int32_t>::Mod(____this_rename_at_259_318.__x_rename_at_259_30,3,*__context__,nullptr)) + 1);
+        das_get_tuple_field<float,4>::get(__mkt_259) = 2.500000e+00f;
+        return __mkt_259;
+    })()));
+    das_copy(____this_rename_at_259_318.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_259_318._loop_at_259_26),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_259_318._source_0_at_259_26),____this_rename_at_259_318._pvar_0_at_259_26,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_259_318._source_0_at_259_26),____this_rename_at_259_318._pvar_0_at_259_26,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_259_8Tickfinalizer_f9e9eb2f3c5501a9 ( Context * __context__, _lambda_thismodule_259_8 * ____this_rename_at_259_320 )
+{
+    finalize_6539699a4f0bba06(__context__,das_arg<_lambda_thismodule_259_8>::pass(das_deref(__context__,____this_rename_at_259_320,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_259_8 *>::clear(__context__,____this_rename_at_259_320);
+}
+
+inline bool _Func_lambda_thismodule_271_9Tickfunction_9db63ad06beaec8f ( Context * __context__, _lambda_thismodule_271_9 &  ____this_rename_at_271_321, int32_t const  * & ___ryield271_rename_at_271_322 )
+{
+    switch (____this_rename_at_271_321.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_271_321._loop_at_271_25,true);
+    das_move(____this_rename_at_271_321._source_0_at_271_25,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,10)));
+    memset((void*)&(____this_rename_at_271_321.__x_rename_at_271_29), 0, 4);
+    das_copy(____this_rename_at_271_321._pvar_0_at_271_25,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_271_321.__x_rename_at_271_29)));
+    DAS_SETBOOLAND((____this_rename_at_271_321._loop_at_271_25),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_271_321._source_0_at_271_25),____this_rename_at_271_321._pvar_0_at_271_25,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_271_321._loop_at_271_25 )
+    {
+        goto label_4;
+    };
+    das_copy(___ryield271_rename_at_271_322,das_ref(__context__,____this_rename_at_271_321.__x_rename_at_271_29));
+    das_copy(____this_rename_at_271_321.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_271_321._loop_at_271_25),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_271_321._source_0_at_271_25),____this_rename_at_271_321._pvar_0_at_271_25,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_271_321._source_0_at_271_25),____this_rename_at_271_321._pvar_0_at_271_25,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_271_9Tickfinalizer_366fe232fcac2a26 ( Context * __context__, _lambda_thismodule_271_9 * ____this_rename_at_271_323 )
+{
+    finalize_fa5ef013837c31d7(__context__,das_arg<_lambda_thismodule_271_9>::pass(das_deref(__context__,____this_rename_at_271_323,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_271_9 *>::clear(__context__,____this_rename_at_271_323);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115 ( Context * __context__, TDim<int32_t,2> &  __a_rename_at_1502_324 )
+{
+    TArray<int32_t> __arr_rename_at_1504_325;das_zero(__arr_rename_at_1504_325);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_325),2);
+    das_copy(das_cast<TDim<int32_t,2>>::cast(das_ref(__context__,__arr_rename_at_1504_325(0,__context__))),__a_rename_at_1502_324);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_325);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 ( Context * __context__, range __rng_rename_at_1398_326 )
+{
+    Sequence DAS_COMMENT((int32_t)) __it_rename_at_1399_327;das_zero(__it_rename_at_1399_327);
+    builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_1399_327),__rng_rename_at_1398_326,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_1399_327);
+}
+
+inline int32_t _Func_lambda_thismodule_109_1Tickfunction_cbda5cc99cf33214 ( Context * __context__, _lambda_thismodule_109_1 &  ____this_rename_at_109_328, int32_t __x_rename_at_109_329 )
+{
+    return das_auto_cast<int32_t>::cast(__x_rename_at_109_329 + __x_rename_at_109_329);
+}
+
+inline void _Func_lambda_thismodule_109_1Tickfinalizer_a9193e773e020d98 ( Context * __context__, _lambda_thismodule_109_1 * ____this_rename_at_109_330 )
+{
+    finalize_b86adca48494f93d(__context__,das_arg<_lambda_thismodule_109_1>::pass(das_deref(__context__,____this_rename_at_109_330,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_109_1 *>::clear(__context__,____this_rename_at_109_330);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b ( Context * __context__, TDim<int32_t,3> &  __a_rename_at_1502_331 )
+{
+    TArray<int32_t> __arr_rename_at_1504_332;das_zero(__arr_rename_at_1504_332);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_332),3);
+    das_copy(das_cast<TDim<int32_t,3>>::cast(das_ref(__context__,__arr_rename_at_1504_332(0,__context__))),__a_rename_at_1502_331);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_332);
+}
+
+inline TTuple<8,int32_t,float> _Func_lambda_thismodule_163_2Tickfunction_d1ac8639c9d7a0ca ( Context * __context__, _lambda_thismodule_163_2 &  ____this_rename_at_163_333, int32_t __x_rename_at_163_334 )
+{
+    return das_auto_cast_ref<TTuple<8,int32_t,float>>::cast((([&]() -> TTuple<8,int32_t,float> {
+        TTuple<8,int32_t,float> __mkt_163;
+        das_get_tuple_field<int32_t,0>::get(__mkt_163) = __x_rename_at_163_334;
+        das_get_tuple_field<float,4>::get(__mkt_163) = 1.500000e+00f;
+        return __mkt_163;
+    })()));
+}
+
+inline void _Func_lambda_thismodule_163_2Tickfinalizer_e24e528e5a88c81 ( Context * __context__, _lambda_thismodule_163_2 * ____this_rename_at_163_335 )
+{
+    finalize_b0cb4b9f8708f3b3(__context__,das_arg<_lambda_thismodule_163_2>::pass(das_deref(__context__,____this_rename_at_163_335,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_163_2 *>::clear(__context__,____this_rename_at_163_335);
+}
+
+inline bool _FuncfunctionalTickanyTick3153855942392455914_5e0e9c66abeffa8f ( Context * __context__, TDim<bool,2> const  &  __it_rename_at_143_336 )
+{
+    {
+        bool __need_loop_149 = true;
+        // x: bool const&
+        das_iterator<TDim<bool,2> const > __x_iterator(__it_rename_at_143_336);
+        bool const  * __x_rename_at_149_337;
+        __need_loop_149 = __x_iterator.first(__context__,(__x_rename_at_149_337)) && __need_loop_149;
+        for ( ; __need_loop_149 ; __need_loop_149 = __x_iterator.next(__context__,(__x_rename_at_149_337)) )
+        {
+            if ( (*__x_rename_at_149_337) )
+            {
+                return das_auto_cast<bool>::cast(true);
+            };
+        }
+        __x_iterator.close(__context__,(__x_rename_at_149_337));
+    };
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickisliceTick565469751076799399_266369a698f370fe ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_227_338, int32_t __start_rename_at_227_339, int32_t __stop_rename_at_227_340 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_FuncbuiltinTickeachTick9663565701927713696_38bf4259f235eb1a(__context__,das_ascend<bool,_lambda_thismodule_230_19>::make(__context__,&__type_info__2c234aa62187a9a5,(([&]() -> _lambda_thismodule_230_19 {
+        _lambda_thismodule_230_19 __mks_230;
+        das_zero(__mks_230);
+        das_copy((__mks_230.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_230_19`function XS<_lambda_thismodule_230_19> &i*/ 0xf335b810ccd5dbec))));
+        das_copy((__mks_230.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_230_19`finalizer X1<S<_lambda_thismodule_230_19>>?*/ 0x6898b536b6cb43c4))));
+        das_move((__mks_230.src),(__src_rename_at_227_338));
+        das_copy((__mks_230.start),(__start_rename_at_227_339));
+        das_copy((__mks_230.stop),(__stop_rename_at_227_340));
+        return __mks_230;
+    })()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncfunctionalTickrepeatTick5582964371469216548_dfc9e5bf3c1c1ae1 ( Context * __context__, int32_t __value_rename_at_263_341, int32_t __count_rename_at_263_342 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_FuncbuiltinTickeachTick9663565701927713696_38bf4259f235eb1a(__context__,das_ascend<bool,_lambda_thismodule_265_3>::make(__context__,&__type_info__b190788d814895cf,(([&]() -> _lambda_thismodule_265_3 {
+        _lambda_thismodule_265_3 __mks_265;
+        das_zero(__mks_265);
+        das_copy((__mks_265.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_265_3`function XS<_lambda_thismodule_265_3> &Xi*/ 0x8b7dde7d029cc07f))));
+        das_copy((__mks_265.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_265_3`finalizer X1<S<_lambda_thismodule_265_3>>?*/ 0x2227b9976246ba6))));
+        das_copy((__mks_265.count),(__count_rename_at_263_342));
+        das_copy((__mks_265.value),(__value_rename_at_263_341));
+        return __mks_265;
+    })()))));
+}
+
+inline bool is_even_28e79c60210e5b07 ( Context * __context__, int32_t __x_rename_at_10_343 )
+{
+    return das_auto_cast<bool>::cast((SimPolicy<int32_t>::Mod(__x_rename_at_10_343,2,*__context__,nullptr)) == 0);
+}
+
+inline int32_t twice_cddb661caae60bf4 ( Context * __context__, int32_t __x_rename_at_14_344 )
+{
+    return das_auto_cast<int32_t>::cast(__x_rename_at_14_344 + __x_rename_at_14_344);
+}
+
+inline int32_t add_b9c39300f347f461 ( Context * __context__, int32_t __a_rename_at_18_345, int32_t __b_rename_at_18_346 )
+{
+    return das_auto_cast<int32_t>::cast(__a_rename_at_18_345 + __b_rename_at_18_346);
+}
+
+inline bool _FuncExclEqu_fd3ae9a2691a110b ( Context * __context__, TTuple<8,int32_t,float> const  &  __a_rename_at_40_347, TTuple<8,int32_t,float> const  &  __b_rename_at_40_348 )
+{
+    return das_auto_cast<bool>::cast((das_get_tuple_field<int32_t,0>::get(__a_rename_at_40_347) != das_get_tuple_field<int32_t,0>::get(__b_rename_at_40_348)) || (das_get_tuple_field<float,4>::get(__a_rename_at_40_347) != das_get_tuple_field<float,4>::get(__b_rename_at_40_348)));
+}
+
+inline bool _FuncExclEqu_f90153e54231f783 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_44_349, TArray<int32_t> const  &  __b_rename_at_44_350 )
+{
+    if ( builtin_array_size(__a_rename_at_44_349) != builtin_array_size(__b_rename_at_44_350) )
+    {
+        return das_auto_cast<bool>::cast(true);
+    } else {
+        {
+            bool __need_loop_48 = true;
+            // x: int const&
+            das_iterator<TArray<int32_t> const > __x_iterator(__a_rename_at_44_349);
+            int32_t const  * __x_rename_at_48_353;
+            __need_loop_48 = __x_iterator.first(__context__,(__x_rename_at_48_353)) && __need_loop_48;
+            // y: int const&
+            das_iterator<TArray<int32_t> const > __y_iterator(__b_rename_at_44_350);
+            int32_t const  * __y_rename_at_48_354;
+            __need_loop_48 = __y_iterator.first(__context__,(__y_rename_at_48_354)) && __need_loop_48;
+            for ( ; __need_loop_48 ; __need_loop_48 = __x_iterator.next(__context__,(__x_rename_at_48_353)) && __y_iterator.next(__context__,(__y_rename_at_48_354)) )
+            {
+                if ( (*__x_rename_at_48_353) != (*__y_rename_at_48_354) )
+                {
+                    return das_auto_cast<bool>::cast(true);
+                };
+            }
+            __y_iterator.close(__context__,(__y_rename_at_48_354));
+            __x_iterator.close(__context__,(__x_rename_at_48_353));
+        };
+        return das_auto_cast<bool>::cast(false);
+    };
+}
+
+inline bool test_108d10aea454bc3b ( Context * __context__ ) { das_stack_prologue __prologue(__context__,224,"test " DAS_FILE_LINE);
+{
+    Sequence DAS_COMMENT((int32_t *)) _temp_make_local_74_31_7; _temp_make_local_74_31_7;
+    Sequence DAS_COMMENT((TArray<int32_t>)) _temp_make_local_80_29_8; _temp_make_local_80_29_8;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_88_12_9; _temp_make_local_88_12_9;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_87_12_10; _temp_make_local_87_12_10;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_95_12_11; _temp_make_local_95_12_11;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_94_12_12; _temp_make_local_94_12_12;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_102_12_13; _temp_make_local_102_12_13;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_101_12_14; _temp_make_local_101_12_14;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_109_12_15; _temp_make_local_109_12_15;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_108_12_16; _temp_make_local_108_12_16;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_117_12_17; _temp_make_local_117_12_17;
+    Sequence DAS_COMMENT((TArray<int32_t>)) _temp_make_local_116_12_18; _temp_make_local_116_12_18;
+    Sequence DAS_COMMENT((TArray<int32_t> *)) _temp_make_local_115_12_19; _temp_make_local_115_12_19;
+    Sequence DAS_COMMENT((TArray<int32_t>)) _temp_make_local_114_22_20; _temp_make_local_114_22_20;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_123_12_21; _temp_make_local_123_12_21;
+    Sequence DAS_COMMENT((int32_t *)) _temp_make_local_130_22_22; _temp_make_local_130_22_22;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_138_12_23; _temp_make_local_138_12_23;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_146_12_24; _temp_make_local_146_12_24;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_154_12_25; _temp_make_local_154_12_25;
+    TTuple<8,int32_t,float> _temp_make_local_164_12_26; _temp_make_local_164_12_26;
+    Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _temp_make_local_163_12_27; _temp_make_local_163_12_27;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_162_12_28; _temp_make_local_162_12_28;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_172_12_29; _temp_make_local_172_12_29;
+    TDim<bool,2> _temp_make_local_179_12_30; _temp_make_local_179_12_30;
+    Sequence DAS_COMMENT((bool)) _temp_make_local_187_12_31; _temp_make_local_187_12_31;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_186_12_32; _temp_make_local_186_12_32;
+    Sequence DAS_COMMENT((bool)) _temp_make_local_196_12_33; _temp_make_local_196_12_33;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_195_12_34; _temp_make_local_195_12_34;
+    Sequence DAS_COMMENT((bool)) _temp_make_local_204_12_35; _temp_make_local_204_12_35;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_203_12_36; _temp_make_local_203_12_36;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_215_12_37; _temp_make_local_215_12_37;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_214_12_38; _temp_make_local_214_12_38;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_223_12_39; _temp_make_local_223_12_39;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_222_12_40; _temp_make_local_222_12_40;
+    TArray<int32_t> _temp_make_local_232_12_41; _temp_make_local_232_12_41;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_231_12_42; _temp_make_local_231_12_42;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_230_12_43; _temp_make_local_230_12_43;
+    TArray<int32_t> _temp_make_local_240_12_44; _temp_make_local_240_12_44;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_239_12_45; _temp_make_local_239_12_45;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_250_8_46; _temp_make_local_250_8_46;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_249_8_47; _temp_make_local_249_8_47;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_248_8_48; _temp_make_local_248_8_48;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_251_26_49; _temp_make_local_251_26_49;
+    Sequence DAS_COMMENT((TTuple<8,int32_t,float> *)) _temp_make_local_258_8_50; _temp_make_local_258_8_50;
+    Sequence DAS_COMMENT((TTuple<8,int32_t,float> *)) _temp_make_local_257_8_51; _temp_make_local_257_8_51;
+    Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _temp_make_local_256_18_52; _temp_make_local_256_18_52;
+    Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _temp_make_local_259_26_53; _temp_make_local_259_26_53;
+    Sequence DAS_COMMENT((TArray<int32_t> *)) _temp_make_local_266_8_54; _temp_make_local_266_8_54;
+    Sequence DAS_COMMENT((TArray<int32_t> *)) _temp_make_local_265_8_55; _temp_make_local_265_8_55;
+    Sequence DAS_COMMENT((TArray<int32_t>)) _temp_make_local_264_18_56; _temp_make_local_264_18_56;
+    Sequence DAS_COMMENT((TArray<int32_t>)) _temp_make_local_267_26_57; _temp_make_local_267_26_57;
+    _FuncTickverify_evenTick14539409462116012840_247cf6e92f558dd(__context__,das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass((_temp_make_local_74_31_7 = (_FuncbuiltinTickeach_refTick16137060296763333387_c02a41a483b3f169(__context__,das_ascend<bool,_lambda_thismodule_74_4>::make(__context__,&__type_info__78bc10cdda8c1b0c,(([&]() -> _lambda_thismodule_74_4 {
+        _lambda_thismodule_74_4 __mks_74;
+        das_zero(__mks_74);
+        das_copy((__mks_74.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_74_4`function XS<_lambda_thismodule_74_4> &1<Ci>?*/ 0x96ce58db3ab9af8f))));
+        das_copy((__mks_74.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_74_4`finalizer X1<S<_lambda_thismodule_74_4>>?*/ 0xe39fcfc881ed7b3a))));
+        return __mks_74;
+    })())))))));
+    _FuncTickverify_evenTick16438837766850132515_8c37383502cdd9d4(__context__,das_arg<TArray<int32_t>>::pass(das_invoke<TArray<int32_t>>::invoke_cmres(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> TArray<int32_t>{
+        TArray<int32_t> ____acomp_77_22_rename_at_77_355;das_zero(____acomp_77_22_rename_at_77_355);
+        builtin_set_verify_array_locks(das_arg<TArray<int32_t>>::pass(____acomp_77_22_rename_at_77_355),false);
+        {
+            bool __need_loop_77 = true;
+            // x: int const
+            das_iterator<range> __x_iterator(range(0,100));
+            int32_t __x_rename_at_77_356;
+            __need_loop_77 = __x_iterator.first(__context__,(__x_rename_at_77_356)) && __need_loop_77;
+            for ( ; __need_loop_77 ; __need_loop_77 = __x_iterator.next(__context__,(__x_rename_at_77_356)) )
+            {
+                if ( (SimPolicy<int32_t>::Mod(__x_rename_at_77_356,2,*__context__,nullptr)) == 0 )
+                {
+                    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(____acomp_77_22_rename_at_77_355),__x_rename_at_77_356);
+                };
+            }
+            __x_iterator.close(__context__,(__x_rename_at_77_356));
+        };
+        builtin_set_verify_array_locks(das_arg<TArray<int32_t>>::pass(____acomp_77_22_rename_at_77_355),true);
+        return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(____acomp_77_22_rename_at_77_355);
+    })));
+    _FuncTickverify_14Tick7691774253321735872_558fc829306e5cd4(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_80_29_8 = (_FuncbuiltinTickeachTick9663565701927713696_f0f9ca53bb972a42(__context__,das_ascend<bool,_lambda_thismodule_80_10>::make(__context__,&__type_info__66c99d800e6bf82b,(([&]() -> _lambda_thismodule_80_10 {
+        _lambda_thismodule_80_10 __mks_80;
+        das_zero(__mks_80);
+        das_copy((__mks_80.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_80_10`function XS<_lambda_thismodule_80_10> 1<i>A*/ 0x29ac3eb20fd82690))));
+        das_copy((__mks_80.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_80_10`finalizer X1<S<_lambda_thismodule_80_10>>?*/ 0xbd2b8be6f318ad7a))));
+        return __mks_80;
+    })())))))));
+    _FuncTickverify_14Tick7691774253321735872_210d806253f397db(__context__,das_arg<TArray<TArray<int32_t>>>::pass(das_invoke<TArray<TArray<int32_t>>>::invoke_cmres(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> TArray<TArray<int32_t>>{
+        TArray<TArray<int32_t>> ____acomp_83_20_rename_at_83_357;das_zero(____acomp_83_20_rename_at_83_357);
+        builtin_set_verify_array_locks(das_arg<TArray<TArray<int32_t>>>::pass(____acomp_83_20_rename_at_83_357),false);
+        {
+            bool __need_loop_83 = true;
+            // x: int const
+            das_iterator<range> __x_iterator(range(1,4));
+            int32_t __x_rename_at_83_358;
+            __need_loop_83 = __x_iterator.first(__context__,(__x_rename_at_83_358)) && __need_loop_83;
+            for ( ; __need_loop_83 ; __need_loop_83 = __x_iterator.next(__context__,(__x_rename_at_83_358)) )
+            {
+                TArray<int32_t> _temp_make_local_83_44_58; _temp_make_local_83_44_58;
+                TDim<int32_t,2> _temp_make_local_83_44_59; _temp_make_local_83_44_59;
+                _FuncbuiltinTickemplaceTick13923705686753630697_908411b5f172f3d6(__context__,das_arg<TArray<TArray<int32_t>>>::pass(____acomp_83_20_rename_at_83_357),das_arg<TArray<int32_t>>::pass((_temp_make_local_83_44_58 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+                    _temp_make_local_83_44_59(0,__context__) = __x_rename_at_83_358;
+                    _temp_make_local_83_44_59(1,__context__) = 2;
+                    return _temp_make_local_83_44_59;
+                })())))))));
+            }
+            __x_iterator.close(__context__,(__x_rename_at_83_358));
+        };
+        builtin_set_verify_array_locks(das_arg<TArray<TArray<int32_t>>>::pass(____acomp_83_20_rename_at_83_357),true);
+        return /* <- */ das_auto_cast_move<TArray<TArray<int32_t>>>::cast(____acomp_83_20_rename_at_83_357);
+    })));
+    _FuncTickverify_evenTick14539409462116012840_a41975d7eea83c28(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_88_12_9 = (_FuncfunctionalTickfilterTick2611906363669329552_b14e0f0747da1864(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_87_12_10 = (_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,100))))),Func(__context__->fnByMangledName(/*is_even Ci*/ 0xcbc2e92a10f48b06)))))));
+    _FuncTickverify_evenTick14539409462116012840_a41975d7eea83c28(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_95_12_11 = (_FuncfunctionalTickfilterTick17052258911568430960_c5b51d79366e68ab(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_94_12_12 = (_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,100))))),das_ascend<bool,_lambda_thismodule_95_14>::make(__context__,&__type_info__f52118e4a20d2ff8,(([&]() -> _lambda_thismodule_95_14 {
+        _lambda_thismodule_95_14 __mks_95;
+        das_copy((__mks_95.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_95_14`function XS<_lambda_thismodule_95_14> Ci*/ 0xaad9c36fabe98e25))));
+        das_copy((__mks_95.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_95_14`finalizer X1<S<_lambda_thismodule_95_14>>?*/ 0xb25ed9e3626e8b2a))));
+        return __mks_95;
+    })())))))));
+    _FuncTickverify_evenTick14539409462116012840_a41975d7eea83c28(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_102_12_13 = (_FuncfunctionalTickmapTick1994230664415641751_9824beb79d88ab9b(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_101_12_14 = (_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,50))))),Func(__context__->fnByMangledName(/*twice Ci*/ 0x26df2bd703d4a406)))))));
+    _FuncTickverify_evenTick14539409462116012840_a41975d7eea83c28(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_109_12_15 = (_FuncfunctionalTickmapTick3767370688684665805_f8ebf27fc6d50619(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_108_12_16 = (_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,50))))),das_ascend<int32_t,_lambda_thismodule_109_1>::make(__context__,&__type_info__6e375377a4ff6e65,(([&]() -> _lambda_thismodule_109_1 {
+        _lambda_thismodule_109_1 __mks_109;
+        das_copy((__mks_109.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_109_1`function XS<_lambda_thismodule_109_1> Ci*/ 0x3d263c8320944e45))));
+        das_copy((__mks_109.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_109_1`finalizer X1<S<_lambda_thismodule_109_1>>?*/ 0xd1cefa87b3c0f2d6))));
+        return __mks_109;
+    })())))))));
+    _FuncTickverify_evenTick14539409462116012840_a41975d7eea83c28(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_117_12_17 = (_FuncfunctionalTickmapTick3767370688684665805_7dd7ef6681f58a23(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_116_12_18 = (_FuncfunctionalTickmapTick3767370688684665805_afc82126cea94d6e(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_115_12_19 = (_FuncfunctionalTickfilterTick17052258911568430960_b5ac07160cdff423(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_114_22_20 = (_FuncbuiltinTickeachTick9663565701927713696_f0f9ca53bb972a42(__context__,das_ascend<bool,_lambda_thismodule_114_11>::make(__context__,&__type_info__31756dae030a5593,(([&]() -> _lambda_thismodule_114_11 {
+        _lambda_thismodule_114_11 __mks_114;
+        das_zero(__mks_114);
+        das_copy((__mks_114.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_114_11`function XS<_lambda_thismodule_114_11> 1<i>A*/ 0xbfeb856c85fc30b7))));
+        das_copy((__mks_114.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_114_11`finalizer X1<S<_lambda_thismodule_114_11>>?*/ 0xbba8a2e0c7cc6493))));
+        return __mks_114;
+    })())))))),das_ascend<bool,_lambda_thismodule_115_23>::make(__context__,&__type_info__981e6fb1d8ca64f9,(([&]() -> _lambda_thismodule_115_23 {
+        _lambda_thismodule_115_23 __mks_115;
+        das_copy((__mks_115.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_115_23`function XS<_lambda_thismodule_115_23> C1<i>A*/ 0xcb72a8e837f54a2a))));
+        das_copy((__mks_115.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_115_23`finalizer X1<S<_lambda_thismodule_115_23>>?*/ 0xd08e1e96ef34ea89))));
+        return __mks_115;
+    })())))))),das_ascend<TArray<int32_t>,_lambda_thismodule_116_32>::make(__context__,&__type_info__ba36ea37fc51b46,(([&]() -> _lambda_thismodule_116_32 {
+        _lambda_thismodule_116_32 __mks_116;
+        das_copy((__mks_116.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_116_32`function XS<_lambda_thismodule_116_32> C1<i>A*/ 0x22471318ad5d7c5c))));
+        das_copy((__mks_116.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_116_32`finalizer X1<S<_lambda_thismodule_116_32>>?*/ 0x5ec784556503c1b2))));
+        return __mks_116;
+    })())))))),das_ascend<int32_t,_lambda_thismodule_117_35>::make(__context__,&__type_info__d4e71a8b28b315f,(([&]() -> _lambda_thismodule_117_35 {
+        _lambda_thismodule_117_35 __mks_117;
+        das_copy((__mks_117.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_117_35`function XS<_lambda_thismodule_117_35> C1<i>A*/ 0x92395b763477f362))));
+        das_copy((__mks_117.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_117_35`finalizer X1<S<_lambda_thismodule_117_35>>?*/ 0x8e4e16880637cee6))));
+        return __mks_117;
+    })())))))));
+    DAS_VERIFY((_FuncfunctionalTickis_equalTick13663318146853733238_ab1cff754c041ab7(__context__,_FuncfunctionalTickreduceTick3841530652084879893_4e6a88b61e02101d(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_123_12_21 = (_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,10))))),das_make_block<int32_t,int32_t,int32_t>(__context__,96,0,&__func_info__be0b8a50a2f41b6e,[&](int32_t const  __x_rename_at_124_359, int32_t const  __y_rename_at_124_360) -> int32_t{
+        return das_auto_cast<int32_t>::cast(__x_rename_at_124_359 + __y_rename_at_124_360);
+    })),45)));
+    DAS_VERIFY((_FuncfunctionalTickis_equalTick13663318146853733238_ab1cff754c041ab7(__context__,_FuncfunctionalTickreduceTick3841530652084879893_b6f97e92cc2dae31(__context__,das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass((_temp_make_local_130_22_22 = (_FuncbuiltinTickeach_refTick16137060296763333387_c02a41a483b3f169(__context__,das_ascend<bool,_lambda_thismodule_130_5>::make(__context__,&__type_info__a3654c9a72569ec0,(([&]() -> _lambda_thismodule_130_5 {
+        _lambda_thismodule_130_5 __mks_130;
+        das_zero(__mks_130);
+        das_copy((__mks_130.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_130_5`function XS<_lambda_thismodule_130_5> &1<Ci>?*/ 0x5851dc90b3b44a98))));
+        das_copy((__mks_130.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_130_5`finalizer X1<S<_lambda_thismodule_130_5>>?*/ 0x574cce9623c58a52))));
+        return __mks_130;
+    })())))))),das_make_block<int32_t,int32_t,int32_t>(__context__,96,0,&__func_info__be0b8a50a2f41b6e,[&](int32_t const  __x_rename_at_131_361, int32_t const  __y_rename_at_131_362) -> int32_t{
+        return das_auto_cast<int32_t>::cast(__x_rename_at_131_361 + __y_rename_at_131_362);
+    })),45)));
+    DAS_VERIFY((_FuncfunctionalTickis_equalTick13663318146853733238_ab1cff754c041ab7(__context__,_FuncfunctionalTickreduceTick3815634954217254421_637b69df14cebf47(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_138_12_23 = (_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,10))))),das_ascend<int32_t,_lambda_thismodule_139_15>::make(__context__,&__type_info__8d7a5777b8312c71,(([&]() -> _lambda_thismodule_139_15 {
+        _lambda_thismodule_139_15 __mks_139;
+        das_copy((__mks_139.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_139_15`function XS<_lambda_thismodule_139_15> Ci Ci*/ 0xfd01518a0d0d1985))));
+        das_copy((__mks_139.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_139_15`finalizer X1<S<_lambda_thismodule_139_15>>?*/ 0xf819d5d3f2c3b8))));
+        return __mks_139;
+    })()))),45)));
+    DAS_VERIFY((_FuncfunctionalTickis_equalTick13663318146853733238_ab1cff754c041ab7(__context__,_FuncfunctionalTickreduceTick12199344316191013487_ce2eb4d61b1b6a52(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_146_12_24 = (_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,10))))),Func(__context__->fnByMangledName(/*add Ci Ci*/ 0x6608022ce4d2504e))),45)));
+    DAS_VERIFY((_FuncfunctionalTickis_equalTick13663318146853733238_ab1cff754c041ab7(__context__,_FuncfunctionalTickreduceTick12199344316191013487_ce2eb4d61b1b6a52(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_154_12_25 = (_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(45,46))))),Func(__context__->fnByMangledName(/*add Ci Ci*/ 0x6608022ce4d2504e))),45)));
+    DAS_VERIFY((_FuncfunctionalTickis_equalTick13663318146853733238_ab1cff754c041ab7(__context__,_FuncTickfirstTick947304547137840980_5c6792106670b351(__context__,das_arg<TTuple<8,int32_t,float>>::pass((_temp_make_local_164_12_26 = (_FuncfunctionalTickreduceTick3841530652084879893_a9fc9323110bc9fc(__context__,das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass((_temp_make_local_163_12_27 = (_FuncfunctionalTickmapTick3767370688684665805_210e299a5936eafc(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_162_12_28 = (_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,10))))),das_ascend<TTuple<8,int32_t,float>,_lambda_thismodule_163_2>::make(__context__,&__type_info__bd968195635b17cf,(([&]() -> _lambda_thismodule_163_2 {
+        _lambda_thismodule_163_2 __mks_163;
+        das_copy((__mks_163.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_163_2`function XS<_lambda_thismodule_163_2> Ci*/ 0xd73f7f52f2941f48))));
+        das_copy((__mks_163.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_163_2`finalizer X1<S<_lambda_thismodule_163_2>>?*/ 0x980e07c0645297a6))));
+        return __mks_163;
+    })())))))),das_make_block_cmres<TTuple<8,int32_t,float>,TTuple<8,int32_t,float> const  &,TTuple<8,int32_t,float> const  &>(__context__,112,0,&__func_info__71d90d02ca1165b2,[&](TTuple<8,int32_t,float> const  & __x_rename_at_164_363, TTuple<8,int32_t,float> const  & __y_rename_at_164_364) -> TTuple<8,int32_t,float>{
+        return das_auto_cast_ref<TTuple<8,int32_t,float>>::cast((([&]() -> TTuple<8,int32_t,float> {
+            TTuple<8,int32_t,float> __mkt_164;
+            das_get_tuple_field<int32_t,0>::get(__mkt_164) = (das_get_tuple_field<int32_t,0>::get(__x_rename_at_164_363) + das_get_tuple_field<int32_t,0>::get(__y_rename_at_164_364));
+            das_get_tuple_field<float,4>::get(__mkt_164) = 2.000000e+00f;
+            return __mkt_164;
+        })()));
+    })))))),45)));
+    DAS_VERIFY((_FuncfunctionalTickis_equalTick13663318146853733238_ab1cff754c041ab7(__context__,_FuncfunctionalTicksumTick17873460401295886850_17c4e2f4f54c1187(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_172_12_29 = (_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,10)))))),45)));
+    DAS_VERIFY((_FuncfunctionalTickanyTick3153855942392455914_5e0e9c66abeffa8f(__context__,das_arg<TDim<bool,2>>::pass((([&]() -> TDim<bool,2>& {
+        _temp_make_local_179_12_30(0,__context__) = true;
+        _temp_make_local_179_12_30(1,__context__) = false;
+        return _temp_make_local_179_12_30;
+    })())))));
+    DAS_VERIFY((_FuncfunctionalTicknotTick15126137237442268133_5718a646ccd351d7(__context__,_FuncfunctionalTickanyTick3860067047720393563_f5b4a194f258ddd0(__context__,das_arg<Sequence DAS_COMMENT((bool))>::pass((_temp_make_local_187_12_31 = (_FuncfunctionalTickmapTick3767370688684665805_91ba24b601ec1f6a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_186_12_32 = (_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,10))))),das_ascend<bool,_lambda_thismodule_187_16>::make(__context__,&__type_info__e40293a87e6b0765,(([&]() -> _lambda_thismodule_187_16 {
+        _lambda_thismodule_187_16 __mks_187;
+        das_copy((__mks_187.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_187_16`function XS<_lambda_thismodule_187_16> Ci*/ 0xd56988a973eb48d4))));
+        das_copy((__mks_187.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_187_16`finalizer X1<S<_lambda_thismodule_187_16>>?*/ 0x793e9bdf291da0fa))));
+        return __mks_187;
+    })()))))))))));
+    DAS_VERIFY((_FuncfunctionalTickallTick13174627742298730649_9c3f2431cb8402f6(__context__,das_arg<Sequence DAS_COMMENT((bool))>::pass((_temp_make_local_196_12_33 = (_FuncfunctionalTickmapTick3767370688684665805_91ba24b601ec1f6a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_195_12_34 = (_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,10))))),das_ascend<bool,_lambda_thismodule_196_17>::make(__context__,&__type_info__df3ccba3465e748d,(([&]() -> _lambda_thismodule_196_17 {
+        _lambda_thismodule_196_17 __mks_196;
+        das_copy((__mks_196.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_196_17`function XS<_lambda_thismodule_196_17> Ci*/ 0xc2e675824c686694))));
+        das_copy((__mks_196.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_196_17`finalizer X1<S<_lambda_thismodule_196_17>>?*/ 0xf934147b200727af))));
+        return __mks_196;
+    })())))))))));
+    DAS_VERIFY((_FuncfunctionalTicknotTick15126137237442268133_5718a646ccd351d7(__context__,_FuncfunctionalTickallTick13174627742298730649_9c3f2431cb8402f6(__context__,das_arg<Sequence DAS_COMMENT((bool))>::pass((_temp_make_local_204_12_35 = (_FuncfunctionalTickmapTick3767370688684665805_91ba24b601ec1f6a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_203_12_36 = (_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,10))))),das_ascend<bool,_lambda_thismodule_204_18>::make(__context__,&__type_info__d3d64492cafa2233,(([&]() -> _lambda_thismodule_204_18 {
+        _lambda_thismodule_204_18 __mks_204;
+        das_copy((__mks_204.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_204_18`function XS<_lambda_thismodule_204_18> Ci*/ 0x6a65341ba8c2fbdc))));
+        das_copy((__mks_204.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_204_18`finalizer X1<S<_lambda_thismodule_204_18>>?*/ 0x6a2b9454f3911a12))));
+        return __mks_204;
+    })()))))))))));
+    DAS_VERIFY((_FuncfunctionalTickis_equalTick13663318146853733238_ab1cff754c041ab7(__context__,_FuncfunctionalTicksumTick17873460401295886850_17c4e2f4f54c1187(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_215_12_37 = (_FuncfunctionalTickisliceTick565469751076799399_266369a698f370fe(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_214_12_38 = (_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,10))))),1,4))))),6)));
+    DAS_VERIFY((_FuncfunctionalTickis_equalTick13663318146853733238_ab1cff754c041ab7(__context__,_FuncfunctionalTicksumTick17873460401295886850_17c4e2f4f54c1187(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_223_12_39 = (_FuncfunctionalTickisliceTick565469751076799399_266369a698f370fe(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_222_12_40 = (builtin_count(0,10,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))),0,10))))),450)));
+    DAS_VERIFY((_FuncfunctionalTickis_equalTick13663318146853733238_ab1cff754c041ab7(__context__,builtin_array_size(das_arg<TArray<int32_t>>::pass((_temp_make_local_232_12_41 = (_FuncbuiltinTickto_arrayTick9505582033551971916_e5f10801382c0f4(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_231_12_42 = (_FuncfunctionalTickisliceTick565469751076799399_266369a698f370fe(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_230_12_43 = (_FuncfunctionalTickrepeatTick5582964371469216548_dfc9e5bf3c1c1ae1(__context__,10,0)))),0,5))))))))),5)));
+    DAS_VERIFY((_FuncfunctionalTickis_equalTick13663318146853733238_ab1cff754c041ab7(__context__,builtin_array_size(das_arg<TArray<int32_t>>::pass((_temp_make_local_240_12_44 = (_FuncbuiltinTickto_arrayTick9505582033551971916_e5f10801382c0f4(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_239_12_45 = (_FuncfunctionalTickrepeatTick5582964371469216548_dfc9e5bf3c1c1ae1(__context__,10,6))))))))),6)));
+    DAS_VERIFY((_FuncTickis_sameTick245538717971957847_90778dcd8fe04dee(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_250_8_46 = (_FuncfunctionalTickisliceTick565469751076799399_266369a698f370fe(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_249_8_47 = (_FuncfunctionalTickcycleTick13989071893922639452_52c9b4b9346a07f9(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_248_8_48 = (_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(1,4))))))))),0,10)))),das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_251_26_49 = (_FuncbuiltinTickeachTick9663565701927713696_38bf4259f235eb1a(__context__,das_ascend<bool,_lambda_thismodule_251_6>::make(__context__,&__type_info__546ccda1211d29fe,(([&]() -> _lambda_thismodule_251_6 {
+        _lambda_thismodule_251_6 __mks_251;
+        das_zero(__mks_251);
+        das_copy((__mks_251.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_251_6`function XS<_lambda_thismodule_251_6> &i*/ 0xc511b42c956bc67a))));
+        das_copy((__mks_251.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_251_6`finalizer X1<S<_lambda_thismodule_251_6>>?*/ 0x9219c7d29650b8aa))));
+        return __mks_251;
+    })())))))))));
+    DAS_VERIFY((_FuncTickis_sameTick245538717971957847_a9c0341708763739(__context__,das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass((_temp_make_local_258_8_50 = (_FuncfunctionalTickisliceTick565469751076799399_f12d6c00813f9d8c(__context__,das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass((_temp_make_local_257_8_51 = (_FuncfunctionalTickcycleTick13989071893922639452_18378972141a1c5(__context__,das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass((_temp_make_local_256_18_52 = (_FuncbuiltinTickeachTick9663565701927713696_403560d62bbc8525(__context__,das_ascend<bool,_lambda_thismodule_256_7>::make(__context__,&__type_info__fad3cd88907a57fe,(([&]() -> _lambda_thismodule_256_7 {
+        _lambda_thismodule_256_7 __mks_256;
+        das_zero(__mks_256);
+        das_copy((__mks_256.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_256_7`function XS<_lambda_thismodule_256_7> 0<i;f>U*/ 0xff284efed68e4d94))));
+        das_copy((__mks_256.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_256_7`finalizer X1<S<_lambda_thismodule_256_7>>?*/ 0x975e4703ac7b18aa))));
+        return __mks_256;
+    })())))))))))),0,10)))),das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass((_temp_make_local_259_26_53 = (_FuncbuiltinTickeachTick9663565701927713696_403560d62bbc8525(__context__,das_ascend<bool,_lambda_thismodule_259_8>::make(__context__,&__type_info__8e28cdc92b2fb7fe,(([&]() -> _lambda_thismodule_259_8 {
+        _lambda_thismodule_259_8 __mks_259;
+        das_zero(__mks_259);
+        das_copy((__mks_259.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_259_8`function XS<_lambda_thismodule_259_8> 0<i;f>U*/ 0xb7e6876a4ad201fe))));
+        das_copy((__mks_259.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_259_8`finalizer X1<S<_lambda_thismodule_259_8>>?*/ 0x60f45c14af4bb8aa))));
+        return __mks_259;
+    })())))))))));
+    DAS_VERIFY((_FuncTickis_sameTick245538717971957847_5920cebe138ff292(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_266_8_54 = (_FuncfunctionalTickisliceTick565469751076799399_bdd25b8f8cc2dbf5(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_265_8_55 = (_FuncfunctionalTickcycleTick13989071893922639452_e88690305df5dba6(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_264_18_56 = (_FuncbuiltinTickeachTick9663565701927713696_f0f9ca53bb972a42(__context__,das_ascend<bool,_lambda_thismodule_264_12>::make(__context__,&__type_info__c78d7c92c5430d9b,(([&]() -> _lambda_thismodule_264_12 {
+        _lambda_thismodule_264_12 __mks_264;
+        das_zero(__mks_264);
+        das_copy((__mks_264.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_264_12`function XS<_lambda_thismodule_264_12> 1<i>A*/ 0x9098961bf689e9d7))));
+        das_copy((__mks_264.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_264_12`finalizer X1<S<_lambda_thismodule_264_12>>?*/ 0xe3bcf17eb17242e2))));
+        return __mks_264;
+    })())))))))))),0,10)))),das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_267_26_57 = (_FuncbuiltinTickeachTick9663565701927713696_f0f9ca53bb972a42(__context__,das_ascend<bool,_lambda_thismodule_267_13>::make(__context__,&__type_info__9e147b84c0be84e8,(([&]() -> _lambda_thismodule_267_13 {
+        _lambda_thismodule_267_13 __mks_267;
+        das_zero(__mks_267);
+        das_copy((__mks_267.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_267_13`function XS<_lambda_thismodule_267_13> 1<i>A*/ 0x72371ca1bc5f051d))));
+        das_copy((__mks_267.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_267_13`finalizer X1<S<_lambda_thismodule_267_13>>?*/ 0x7158d096a48ee06a))));
+        return __mks_267;
+    })())))))))));
+    Sequence DAS_COMMENT((int32_t *)) __iter_rename_at_271_365; das_zero(__iter_rename_at_271_365); das_move(__iter_rename_at_271_365, _FuncbuiltinTickeach_refTick16137060296763333387_c02a41a483b3f169(__context__,das_ascend<bool,_lambda_thismodule_271_9>::make(__context__,&__type_info__40351fa10b07fb94,(([&]() -> _lambda_thismodule_271_9 {
+        _lambda_thismodule_271_9 __mks_271;
+        das_zero(__mks_271);
+        das_copy((__mks_271.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_271_9`function XS<_lambda_thismodule_271_9> &1<Ci>?*/ 0x5b255ee543db3a50))));
+        das_copy((__mks_271.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_271_9`finalizer X1<S<_lambda_thismodule_271_9>>?*/ 0x7b297f9c52b9e20a))));
+        return __mks_271;
+    })()))));
+    int32_t __sum_rename_at_272_366 = 0;
+    {
+        bool __need_loop_273 = true;
+        // x: int const&
+        das_iterator<Sequence DAS_COMMENT((int32_t const ))> __x_iterator(__iter_rename_at_271_365);
+        int32_t const  * __x_rename_at_273_367;
+        __need_loop_273 = __x_iterator.first(__context__,(__x_rename_at_273_367)) && __need_loop_273;
+        for ( ; __need_loop_273 ; __need_loop_273 = __x_iterator.next(__context__,(__x_rename_at_273_367)) )
+        {
+            __sum_rename_at_272_366 += (*__x_rename_at_273_367);
+        }
+        __x_iterator.close(__context__,(__x_rename_at_273_367));
+    };
+    DAS_VERIFY((__sum_rename_at_272_366 == 45));
+    return das_auto_cast<bool>::cast(true);
+}}
+static vec4f __wrap_finalize_5c3fa10faeab6f5b ( Context * __context__ ) {
+    _lambda_thismodule_46_36 &  arg___this = cast_aot_arg<_lambda_thismodule_46_36 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_5c3fa10faeab6f5b(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_46_36Tickfunction_b499ef7f7ef1a851 ( Context * __context__ ) {
+    _lambda_thismodule_46_36 &  arg___this = cast_aot_arg<_lambda_thismodule_46_36 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg__yield_46 = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_46_36Tickfunction_b499ef7f7ef1a851(__context__, arg___this, arg__yield_46));
+}
+static vec4f __wrap__Func_lambda_thismodule_46_36Tickfinalizer_84a9c3600660c442 ( Context * __context__ ) {
+    _lambda_thismodule_46_36 * arg___this = cast_aot_arg<_lambda_thismodule_46_36 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_46_36Tickfinalizer_84a9c3600660c442(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_e3ab08cedd375fa ( Context * __context__ ) {
+    _lambda_thismodule_117_35 &  arg___this = cast_aot_arg<_lambda_thismodule_117_35 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_e3ab08cedd375fa(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_117_35Tickfunction_4cba99b90ac6a708 ( Context * __context__ ) {
+    _lambda_thismodule_117_35 &  arg___this = cast_aot_arg<_lambda_thismodule_117_35 & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> const  &  arg_x = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t>::from(_Func_lambda_thismodule_117_35Tickfunction_4cba99b90ac6a708(__context__, arg___this, arg_x));
+}
+static vec4f __wrap__Func_lambda_thismodule_117_35Tickfinalizer_20c0cf0819a8cef4 ( Context * __context__ ) {
+    _lambda_thismodule_117_35 * arg___this = cast_aot_arg<_lambda_thismodule_117_35 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_117_35Tickfinalizer_20c0cf0819a8cef4(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickmap_anyTick4479995923280306007_5642e543b9d04ef3 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((TArray<int32_t>)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((TArray<int32_t>)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) arg_blk = cast_aot_arg<Lambda DAS_COMMENT((int32_t,TArray<int32_t> const ))>::to(*__context__,__context__->abiArguments()[1]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncfunctionalTickmap_anyTick4479995923280306007_5642e543b9d04ef3(__context__, arg_src, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> &  arg_b = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickmapTick3767370688684665805_7dd7ef6681f58a23 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((TArray<int32_t>)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((TArray<int32_t>)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) const  arg_blk = cast_aot_arg<Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) const >::to(*__context__,__context__->abiArguments()[1]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncfunctionalTickmapTick3767370688684665805_7dd7ef6681f58a23(__context__, arg_src, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap_finalize_935fd2f8295ecce9 ( Context * __context__ ) {
+    _lambda_thismodule_57_34 &  arg___this = cast_aot_arg<_lambda_thismodule_57_34 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_935fd2f8295ecce9(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickmove_to_localTick14376033101315213529_a3eb4ebbfa51707 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickmove_to_localTick14376033101315213529_a3eb4ebbfa51707(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_57_34Tickfunction_8e7015a5e889f99c ( Context * __context__ ) {
+    _lambda_thismodule_57_34 &  arg___this = cast_aot_arg<_lambda_thismodule_57_34 & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> &  arg__yield_57 = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_57_34Tickfunction_8e7015a5e889f99c(__context__, arg___this, arg__yield_57));
+}
+static vec4f __wrap__Func_lambda_thismodule_57_34Tickfinalizer_37a60b4798f52ebf ( Context * __context__ ) {
+    _lambda_thismodule_57_34 * arg___this = cast_aot_arg<_lambda_thismodule_57_34 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_57_34Tickfinalizer_37a60b4798f52ebf(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickis_sameTick245538717971957847_5920cebe138ff292 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((TArray<int32_t> &)) &  arg_a = cast_aot_arg<Sequence DAS_COMMENT((TArray<int32_t> &)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Sequence DAS_COMMENT((TArray<int32_t>)) &  arg_b = cast_aot_arg<Sequence DAS_COMMENT((TArray<int32_t>)) & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_FuncTickis_sameTick245538717971957847_5920cebe138ff292(__context__, arg_a, arg_b));
+}
+static vec4f __wrap_finalize_da055a40908e26 ( Context * __context__ ) {
+    _lambda_thismodule_239_33 &  arg___this = cast_aot_arg<_lambda_thismodule_239_33 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_da055a40908e26(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickis_sameTick245538717971957847_a9c0341708763739 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) &  arg_a = cast_aot_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) &  arg_b = cast_aot_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_FuncTickis_sameTick245538717971957847_a9c0341708763739(__context__, arg_a, arg_b));
+}
+static vec4f __wrap_finalize_322b586a61b59695 ( Context * __context__ ) {
+    _lambda_thismodule_239_31 &  arg___this = cast_aot_arg<_lambda_thismodule_239_31 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_322b586a61b59695(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_4f7eb10f7e42945c ( Context * __context__ ) {
+    _lambda_thismodule_116_32 &  arg___this = cast_aot_arg<_lambda_thismodule_116_32 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_4f7eb10f7e42945c(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_239_33Tickfunction_c893b561a33638e4 ( Context * __context__ ) {
+    _lambda_thismodule_239_33 &  arg___this = cast_aot_arg<_lambda_thismodule_239_33 & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> * & arg__ryield239 = cast_aot_arg<TArray<int32_t> * &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_239_33Tickfunction_c893b561a33638e4(__context__, arg___this, arg__ryield239));
+}
+static vec4f __wrap__Func_lambda_thismodule_239_33Tickfinalizer_a4e5d7e39be05c5d ( Context * __context__ ) {
+    _lambda_thismodule_239_33 * arg___this = cast_aot_arg<_lambda_thismodule_239_33 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_239_33Tickfinalizer_a4e5d7e39be05c5d(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickfinalizeTick13836114024949725080_fa51d566d7dfd53e ( Context * __context__ ) {
+    TArray<TArray<int32_t>> &  arg_a = cast_aot_arg<TArray<TArray<int32_t>> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickfinalizeTick13836114024949725080_fa51d566d7dfd53e(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_239_31Tickfunction_bfb87e4067b2a8d8 ( Context * __context__ ) {
+    _lambda_thismodule_239_31 &  arg___this = cast_aot_arg<_lambda_thismodule_239_31 & >::to(*__context__,__context__->abiArguments()[0]);
+    TTuple<8,int32_t,float> * & arg__ryield239 = cast_aot_arg<TTuple<8,int32_t,float> * &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_239_31Tickfunction_bfb87e4067b2a8d8(__context__, arg___this, arg__ryield239));
+}
+static vec4f __wrap__Func_lambda_thismodule_239_31Tickfinalizer_58d02024b348deca ( Context * __context__ ) {
+    _lambda_thismodule_239_31 * arg___this = cast_aot_arg<_lambda_thismodule_239_31 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_239_31Tickfinalizer_58d02024b348deca(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickfinalizeTick13836114024949725080_81327841969947fa ( Context * __context__ ) {
+    TArray<TTuple<8,int32_t,float>> &  arg_a = cast_aot_arg<TArray<TTuple<8,int32_t,float>> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickfinalizeTick13836114024949725080_81327841969947fa(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_116_32Tickfunction_fb95bbf9fac8f359 ( Context * __context__ ) {
+    _lambda_thismodule_116_32 &  arg___this = cast_aot_arg<_lambda_thismodule_116_32 & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> const  &  arg_x = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _Func_lambda_thismodule_116_32Tickfunction_fb95bbf9fac8f359(__context__, arg___this, arg_x);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_116_32Tickfinalizer_4f9418ced39b6d4a ( Context * __context__ ) {
+    _lambda_thismodule_116_32 * arg___this = cast_aot_arg<_lambda_thismodule_116_32 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_116_32Tickfinalizer_4f9418ced39b6d4a(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickmap_anyTick4479995923280306007_7911bf7d28600067 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((TArray<int32_t> &)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((TArray<int32_t> &)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) arg_blk = cast_aot_arg<Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const ))>::to(*__context__,__context__->abiArguments()[1]);
+    *((Sequence DAS_COMMENT((TArray<int32_t>)) *) __context__->abiCMRES) = _FuncfunctionalTickmap_anyTick4479995923280306007_7911bf7d28600067(__context__, arg_src, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> const  &  arg_b = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickfirstTick947304547137840980_5c6792106670b351 ( Context * __context__ ) {
+    TTuple<8,int32_t,float> const  &  arg_x = cast_aot_arg<TTuple<8,int32_t,float> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(_FuncTickfirstTick947304547137840980_5c6792106670b351(__context__, arg_x));
+}
+static vec4f __wrap__FuncfunctionalTickreduce_anyTick10888502122296883119_349cc66090f1ae3b ( Context * __context__ ) {
+    Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) &  arg_it = cast_aot_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  &  arg_functor = cast_aot_arg<Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    *((TTuple<8,int32_t,float> *) __context__->abiCMRES) = _FuncfunctionalTickreduce_anyTick10888502122296883119_349cc66090f1ae3b(__context__, arg_it, arg_functor);
+    return v_zero();
+}
+static vec4f __wrap_finalize_5cef76514cdcd502 ( Context * __context__ ) {
+    TTuple<8,int32_t,float> &  arg___this = cast_aot_arg<TTuple<8,int32_t,float> & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_5cef76514cdcd502(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeachTick6002865651812066953_79ce88e42c3e3433 ( Context * __context__ ) {
+    TArray<TArray<int32_t>> const  &  arg_a = cast_aot_arg<TArray<TArray<int32_t>> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((TArray<int32_t> &)) *) __context__->abiCMRES) = _FuncbuiltinTickeachTick6002865651812066953_79ce88e42c3e3433(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickmapTick3767370688684665805_afc82126cea94d6e ( Context * __context__ ) {
+    Sequence DAS_COMMENT((TArray<int32_t> &)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((TArray<int32_t> &)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) const  arg_blk = cast_aot_arg<Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) const >::to(*__context__,__context__->abiArguments()[1]);
+    *((Sequence DAS_COMMENT((TArray<int32_t>)) *) __context__->abiCMRES) = _FuncfunctionalTickmapTick3767370688684665805_afc82126cea94d6e(__context__, arg_src, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTicknotTick15126137237442268133_5718a646ccd351d7 ( Context * __context__ ) {
+    bool arg_x = cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<bool>::from(_FuncfunctionalTicknotTick15126137237442268133_5718a646ccd351d7(__context__, arg_x));
+}
+static vec4f __wrap_finalize_7980aaa0c8ca61d4 ( Context * __context__ ) {
+    _lambda_thismodule_21_30 &  arg___this = cast_aot_arg<_lambda_thismodule_21_30 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_7980aaa0c8ca61d4(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeachTick6002865651812066953_e372b165824f649d ( Context * __context__ ) {
+    TArray<TTuple<8,int32_t,float>> const  &  arg_a = cast_aot_arg<TArray<TTuple<8,int32_t,float>> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) *) __context__->abiCMRES) = _FuncbuiltinTickeachTick6002865651812066953_e372b165824f649d(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickreduceTick3841530652084879893_a9fc9323110bc9fc ( Context * __context__ ) {
+    Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) &  arg_it = cast_aot_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    *((TTuple<8,int32_t,float> *) __context__->abiCMRES) = _FuncfunctionalTickreduceTick3841530652084879893_a9fc9323110bc9fc(__context__, arg_it, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickanyTick3860067047720393563_f5b4a194f258ddd0 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((bool)) &  arg_it = cast_aot_arg<Sequence DAS_COMMENT((bool)) & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<bool>::from(_FuncfunctionalTickanyTick3860067047720393563_f5b4a194f258ddd0(__context__, arg_it));
+}
+static vec4f __wrap__FuncfunctionalTickallTick13174627742298730649_9c3f2431cb8402f6 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((bool)) &  arg_it = cast_aot_arg<Sequence DAS_COMMENT((bool)) & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<bool>::from(_FuncfunctionalTickallTick13174627742298730649_9c3f2431cb8402f6(__context__, arg_it));
+}
+static vec4f __wrap__FuncfunctionalTickisliceTick565469751076799399_bdd25b8f8cc2dbf5 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((TArray<int32_t> &)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((TArray<int32_t> &)) & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_start = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_stop = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    *((Sequence DAS_COMMENT((TArray<int32_t> &)) *) __context__->abiCMRES) = _FuncfunctionalTickisliceTick565469751076799399_bdd25b8f8cc2dbf5(__context__, arg_src, arg_start, arg_stop);
+    return v_zero();
+}
+static vec4f __wrap_finalize_cdfff6625092eae1 ( Context * __context__ ) {
+    _lambda_thismodule_211_25 &  arg___this = cast_aot_arg<_lambda_thismodule_211_25 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_cdfff6625092eae1(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_3dcae5fa4b700dd5 ( Context * __context__ ) {
+    _lambda_thismodule_46_26 &  arg___this = cast_aot_arg<_lambda_thismodule_46_26 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_3dcae5fa4b700dd5(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_ce54b4b3dece547c ( Context * __context__ ) {
+    _lambda_thismodule_46_27 &  arg___this = cast_aot_arg<_lambda_thismodule_46_27 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_ce54b4b3dece547c(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_cb863a01181cc563 ( Context * __context__ ) {
+    _lambda_thismodule_46_28 &  arg___this = cast_aot_arg<_lambda_thismodule_46_28 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_cb863a01181cc563(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_eb39c4fa0e0aa9cb ( Context * __context__ ) {
+    _lambda_thismodule_46_29 &  arg___this = cast_aot_arg<_lambda_thismodule_46_29 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_eb39c4fa0e0aa9cb(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_21_30Tickfunction_124aecd4e54968e6 ( Context * __context__ ) {
+    _lambda_thismodule_21_30 &  arg___this = cast_aot_arg<_lambda_thismodule_21_30 & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> * & arg__ryield21 = cast_aot_arg<TArray<int32_t> * &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_21_30Tickfunction_124aecd4e54968e6(__context__, arg___this, arg__ryield21));
+}
+static vec4f __wrap__Func_lambda_thismodule_21_30Tickfinalizer_f192f22a0f696612 ( Context * __context__ ) {
+    _lambda_thismodule_21_30 * arg___this = cast_aot_arg<_lambda_thismodule_21_30 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_21_30Tickfinalizer_f192f22a0f696612(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeach_refTick16137060296763333387_61841c1791c9b95f ( Context * __context__ ) {
+    Lambda DAS_COMMENT((bool,TArray<int32_t> * &)) const  arg_lam = cast_aot_arg<Lambda DAS_COMMENT((bool,TArray<int32_t> * &)) const >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((TArray<int32_t> &)) *) __context__->abiCMRES) = _FuncbuiltinTickeach_refTick16137060296763333387_61841c1791c9b95f(__context__, arg_lam);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeachTick9663565701927713696_c6a9cdebae4e9e7f ( Context * __context__ ) {
+    Lambda DAS_COMMENT((bool,bool &)) const  arg_lam = cast_aot_arg<Lambda DAS_COMMENT((bool,bool &)) const >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((bool)) *) __context__->abiCMRES) = _FuncbuiltinTickeachTick9663565701927713696_c6a9cdebae4e9e7f(__context__, arg_lam);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickisliceTick565469751076799399_f12d6c00813f9d8c ( Context * __context__ ) {
+    Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_start = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_stop = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    *((Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) *) __context__->abiCMRES) = _FuncfunctionalTickisliceTick565469751076799399_f12d6c00813f9d8c(__context__, arg_src, arg_start, arg_stop);
+    return v_zero();
+}
+static vec4f __wrap_finalize_81b7faa9db9b97fa ( Context * __context__ ) {
+    _lambda_thismodule_211_24 &  arg___this = cast_aot_arg<_lambda_thismodule_211_24 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_81b7faa9db9b97fa(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeachTick6002865651812066953_693fb4484d509206 ( Context * __context__ ) {
+    TArray<int32_t> const  &  arg_a = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t &)) *) __context__->abiCMRES) = _FuncbuiltinTickeachTick6002865651812066953_693fb4484d509206(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpush_cloneTick2035469273396957942_3c23be799e74aa72 ( Context * __context__ ) {
+    TArray<TArray<int32_t>> &  arg_Arr = cast_aot_arg<TArray<TArray<int32_t>> & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> &  arg_value = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpush_cloneTick2035469273396957942_3c23be799e74aa72(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_211_25Tickfunction_b51aa010f6a4cd23 ( Context * __context__ ) {
+    _lambda_thismodule_211_25 &  arg___this = cast_aot_arg<_lambda_thismodule_211_25 & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> * & arg__ryield211 = cast_aot_arg<TArray<int32_t> * &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_211_25Tickfunction_b51aa010f6a4cd23(__context__, arg___this, arg__ryield211));
+}
+static vec4f __wrap__Func_lambda_thismodule_211_25Tickfinalizer_9448301fe12bf62 ( Context * __context__ ) {
+    _lambda_thismodule_211_25 * arg___this = cast_aot_arg<_lambda_thismodule_211_25 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_211_25Tickfinalizer_9448301fe12bf62(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeach_refTick16137060296763333387_7462031b9a3d3d2e ( Context * __context__ ) {
+    Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float> * &)) const  arg_lam = cast_aot_arg<Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float> * &)) const >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) *) __context__->abiCMRES) = _FuncbuiltinTickeach_refTick16137060296763333387_7462031b9a3d3d2e(__context__, arg_lam);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_46_26Tickfunction_55d29a7714c3b148 ( Context * __context__ ) {
+    _lambda_thismodule_46_26 &  arg___this = cast_aot_arg<_lambda_thismodule_46_26 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg__yield_46 = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_46_26Tickfunction_55d29a7714c3b148(__context__, arg___this, arg__yield_46));
+}
+static vec4f __wrap__Func_lambda_thismodule_46_26Tickfinalizer_3eae0ef5553264f8 ( Context * __context__ ) {
+    _lambda_thismodule_46_26 * arg___this = cast_aot_arg<_lambda_thismodule_46_26 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_46_26Tickfinalizer_3eae0ef5553264f8(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_46_27Tickfunction_bb17341466c4aa51 ( Context * __context__ ) {
+    _lambda_thismodule_46_27 &  arg___this = cast_aot_arg<_lambda_thismodule_46_27 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg__yield_46 = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_46_27Tickfunction_bb17341466c4aa51(__context__, arg___this, arg__yield_46));
+}
+static vec4f __wrap__Func_lambda_thismodule_46_27Tickfinalizer_47b44357a235464e ( Context * __context__ ) {
+    _lambda_thismodule_46_27 * arg___this = cast_aot_arg<_lambda_thismodule_46_27 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_46_27Tickfinalizer_47b44357a235464e(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickcopy_to_localTick18007282088148548588_cf5b4d36c641ec89 ( Context * __context__ ) {
+    TTuple<8,int32_t,float> const  &  arg_a = cast_aot_arg<TTuple<8,int32_t,float> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TTuple<8,int32_t,float> *) __context__->abiCMRES) = _FuncbuiltinTickcopy_to_localTick18007282088148548588_cf5b4d36c641ec89(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_46_28Tickfunction_4b6a017341fe0abc ( Context * __context__ ) {
+    _lambda_thismodule_46_28 &  arg___this = cast_aot_arg<_lambda_thismodule_46_28 & >::to(*__context__,__context__->abiArguments()[0]);
+    TTuple<8,int32_t,float> &  arg__yield_46 = cast_aot_arg<TTuple<8,int32_t,float> & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_46_28Tickfunction_4b6a017341fe0abc(__context__, arg___this, arg__yield_46));
+}
+static vec4f __wrap__Func_lambda_thismodule_46_28Tickfinalizer_1e6b86880ccb6112 ( Context * __context__ ) {
+    _lambda_thismodule_46_28 * arg___this = cast_aot_arg<_lambda_thismodule_46_28 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_46_28Tickfinalizer_1e6b86880ccb6112(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_46_29Tickfunction_c76a3c5f83d93d5e ( Context * __context__ ) {
+    _lambda_thismodule_46_29 &  arg___this = cast_aot_arg<_lambda_thismodule_46_29 & >::to(*__context__,__context__->abiArguments()[0]);
+    bool & arg__yield_46 = cast_aot_arg<bool &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_46_29Tickfunction_c76a3c5f83d93d5e(__context__, arg___this, arg__yield_46));
+}
+static vec4f __wrap__Func_lambda_thismodule_46_29Tickfinalizer_ca4e9b0da58741b3 ( Context * __context__ ) {
+    _lambda_thismodule_46_29 * arg___this = cast_aot_arg<_lambda_thismodule_46_29 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_46_29Tickfinalizer_ca4e9b0da58741b3(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickverify_evenTick14539409462116012840_a41975d7eea83c28 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_iter = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickverify_evenTick14539409462116012840_a41975d7eea83c28(__context__, arg_iter);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickis_sameTick245538717971957847_90778dcd8fe04dee ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_a = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Sequence DAS_COMMENT((int32_t)) &  arg_b = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_FuncTickis_sameTick245538717971957847_90778dcd8fe04dee(__context__, arg_a, arg_b));
+}
+static vec4f __wrap_finalize_62288b18c551cda5 ( Context * __context__ ) {
+    _lambda_thismodule_12_21 &  arg___this = cast_aot_arg<_lambda_thismodule_12_21 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_62288b18c551cda5(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_c1432cdb99d257fc ( Context * __context__ ) {
+    _lambda_thismodule_12_22 &  arg___this = cast_aot_arg<_lambda_thismodule_12_22 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_c1432cdb99d257fc(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_7e876d36e44179ae ( Context * __context__ ) {
+    _lambda_thismodule_115_23 &  arg___this = cast_aot_arg<_lambda_thismodule_115_23 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_7e876d36e44179ae(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpush_cloneTick2035469273396957942_b74d0b46559deb03 ( Context * __context__ ) {
+    TArray<TTuple<8,int32_t,float>> &  arg_Arr = cast_aot_arg<TArray<TTuple<8,int32_t,float>> & >::to(*__context__,__context__->abiArguments()[0]);
+    TTuple<8,int32_t,float> &  arg_value = cast_aot_arg<TTuple<8,int32_t,float> & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpush_cloneTick2035469273396957942_b74d0b46559deb03(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_211_24Tickfunction_1529e8e196031a1 ( Context * __context__ ) {
+    _lambda_thismodule_211_24 &  arg___this = cast_aot_arg<_lambda_thismodule_211_24 & >::to(*__context__,__context__->abiArguments()[0]);
+    TTuple<8,int32_t,float> * & arg__ryield211 = cast_aot_arg<TTuple<8,int32_t,float> * &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_211_24Tickfunction_1529e8e196031a1(__context__, arg___this, arg__ryield211));
+}
+static vec4f __wrap__Func_lambda_thismodule_211_24Tickfinalizer_438ffbc0f98e4f24 ( Context * __context__ ) {
+    _lambda_thismodule_211_24 * arg___this = cast_aot_arg<_lambda_thismodule_211_24 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_211_24Tickfinalizer_438ffbc0f98e4f24(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_42bcf1754d30f3e6 ( Context * __context__ ) {
+    _lambda_thismodule_197_20 &  arg___this = cast_aot_arg<_lambda_thismodule_197_20 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_42bcf1754d30f3e6(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_12_21Tickfunction_dc6a1502d70a914b ( Context * __context__ ) {
+    _lambda_thismodule_12_21 &  arg___this = cast_aot_arg<_lambda_thismodule_12_21 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg__yield_12 = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_12_21Tickfunction_dc6a1502d70a914b(__context__, arg___this, arg__yield_12));
+}
+static vec4f __wrap__Func_lambda_thismodule_12_21Tickfinalizer_b47553da6da1d917 ( Context * __context__ ) {
+    _lambda_thismodule_12_21 * arg___this = cast_aot_arg<_lambda_thismodule_12_21 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_12_21Tickfinalizer_b47553da6da1d917(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_12_22Tickfunction_8e677566a24aefee ( Context * __context__ ) {
+    _lambda_thismodule_12_22 &  arg___this = cast_aot_arg<_lambda_thismodule_12_22 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg__yield_12 = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_12_22Tickfunction_8e677566a24aefee(__context__, arg___this, arg__yield_12));
+}
+static vec4f __wrap__Func_lambda_thismodule_12_22Tickfinalizer_c78986e767b672d2 ( Context * __context__ ) {
+    _lambda_thismodule_12_22 * arg___this = cast_aot_arg<_lambda_thismodule_12_22 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_12_22Tickfinalizer_c78986e767b672d2(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_115_23Tickfunction_e14f1bfe624fc6d6 ( Context * __context__ ) {
+    _lambda_thismodule_115_23 &  arg___this = cast_aot_arg<_lambda_thismodule_115_23 & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> const  &  arg_x = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_115_23Tickfunction_e14f1bfe624fc6d6(__context__, arg___this, arg_x));
+}
+static vec4f __wrap__Func_lambda_thismodule_115_23Tickfinalizer_dbec80ebd1dc3ee7 ( Context * __context__ ) {
+    _lambda_thismodule_115_23 * arg___this = cast_aot_arg<_lambda_thismodule_115_23 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_115_23Tickfinalizer_dbec80ebd1dc3ee7(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_b3040909745498b4 ( Context * __context__ ) {
+    _lambda_thismodule_230_19 &  arg___this = cast_aot_arg<_lambda_thismodule_230_19 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_b3040909745498b4(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickfilter_anyTick8436123068441528563_ae7e887ff20f69cc ( Context * __context__ ) {
+    Sequence DAS_COMMENT((TArray<int32_t>)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((TArray<int32_t>)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Lambda DAS_COMMENT((bool,TArray<int32_t> const )) arg_blk = cast_aot_arg<Lambda DAS_COMMENT((bool,TArray<int32_t> const ))>::to(*__context__,__context__->abiArguments()[1]);
+    *((Sequence DAS_COMMENT((TArray<int32_t> &)) *) __context__->abiCMRES) = _FuncfunctionalTickfilter_anyTick8436123068441528563_ae7e887ff20f69cc(__context__, arg_src, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpushTick10769833213962245646_b2287abd57a15f1f ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_value = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick10769833213962245646_b2287abd57a15f1f(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_197_20Tickfunction_eee30c808afe7a78 ( Context * __context__ ) {
+    _lambda_thismodule_197_20 &  arg___this = cast_aot_arg<_lambda_thismodule_197_20 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg__yield_197 = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_197_20Tickfunction_eee30c808afe7a78(__context__, arg___this, arg__yield_197));
+}
+static vec4f __wrap__Func_lambda_thismodule_197_20Tickfinalizer_25873a1f018a00f7 ( Context * __context__ ) {
+    _lambda_thismodule_197_20 * arg___this = cast_aot_arg<_lambda_thismodule_197_20 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_197_20Tickfinalizer_25873a1f018a00f7(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_89df3979aba5e810 ( Context * __context__ ) {
+    _lambda_thismodule_95_14 &  arg___this = cast_aot_arg<_lambda_thismodule_95_14 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_89df3979aba5e810(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickreduce_anyTick10888502122296883119_91f3953a535f4618 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t const  &)) &  arg_it = cast_aot_arg<Sequence DAS_COMMENT((int32_t const  &)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  arg_functor = cast_aot_arg<Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t>::from(_FuncfunctionalTickreduce_anyTick10888502122296883119_91f3953a535f4618(__context__, arg_it, arg_functor));
+}
+static vec4f __wrap_finalize_bad70fc7c4a20b23 ( Context * __context__ ) {
+    _lambda_thismodule_139_15 &  arg___this = cast_aot_arg<_lambda_thismodule_139_15 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_bad70fc7c4a20b23(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_66d38afb2a354c1 ( Context * __context__ ) {
+    _lambda_thismodule_187_16 &  arg___this = cast_aot_arg<_lambda_thismodule_187_16 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_66d38afb2a354c1(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_7c209bed83355de7 ( Context * __context__ ) {
+    _lambda_thismodule_196_17 &  arg___this = cast_aot_arg<_lambda_thismodule_196_17 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_7c209bed83355de7(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_598a8a4cb50aa870 ( Context * __context__ ) {
+    _lambda_thismodule_204_18 &  arg___this = cast_aot_arg<_lambda_thismodule_204_18 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_598a8a4cb50aa870(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpush_cloneTick2035469273396957942_c2961e1e4b6c33a6 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_value = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpush_cloneTick2035469273396957942_c2961e1e4b6c33a6(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_230_19Tickfunction_b9e2ca9378874572 ( Context * __context__ ) {
+    _lambda_thismodule_230_19 &  arg___this = cast_aot_arg<_lambda_thismodule_230_19 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg__yield_230 = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_230_19Tickfunction_b9e2ca9378874572(__context__, arg___this, arg__yield_230));
+}
+static vec4f __wrap__Func_lambda_thismodule_230_19Tickfinalizer_f638c8ae7033c789 ( Context * __context__ ) {
+    _lambda_thismodule_230_19 * arg___this = cast_aot_arg<_lambda_thismodule_230_19 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_230_19Tickfinalizer_f638c8ae7033c789(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickverify_14Tick7691774253321735872_558fc829306e5cd4 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((TArray<int32_t>)) &  arg_t = cast_aot_arg<Sequence DAS_COMMENT((TArray<int32_t>)) & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickverify_14Tick7691774253321735872_558fc829306e5cd4(__context__, arg_t);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickfilterTick17052258911568430960_b5ac07160cdff423 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((TArray<int32_t>)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((TArray<int32_t>)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Lambda DAS_COMMENT((bool,TArray<int32_t> const )) const  arg_blk = cast_aot_arg<Lambda DAS_COMMENT((bool,TArray<int32_t> const )) const >::to(*__context__,__context__->abiArguments()[1]);
+    *((Sequence DAS_COMMENT((TArray<int32_t> &)) *) __context__->abiCMRES) = _FuncfunctionalTickfilterTick17052258911568430960_b5ac07160cdff423(__context__, arg_src, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickcycleTick13989071893922639452_e88690305df5dba6 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((TArray<int32_t>)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((TArray<int32_t>)) & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((TArray<int32_t> &)) *) __context__->abiCMRES) = _FuncfunctionalTickcycleTick13989071893922639452_e88690305df5dba6(__context__, arg_src);
+    return v_zero();
+}
+static vec4f __wrap_finalize_f644eb195de1df44 ( Context * __context__ ) {
+    _lambda_thismodule_80_10 &  arg___this = cast_aot_arg<_lambda_thismodule_80_10 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_f644eb195de1df44(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_f1103f2c3f9d49da ( Context * __context__ ) {
+    _lambda_thismodule_114_11 &  arg___this = cast_aot_arg<_lambda_thismodule_114_11 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_f1103f2c3f9d49da(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_612f25fea13eacd7 ( Context * __context__ ) {
+    _lambda_thismodule_264_12 &  arg___this = cast_aot_arg<_lambda_thismodule_264_12 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_612f25fea13eacd7(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_28116c91cb7e7e32 ( Context * __context__ ) {
+    _lambda_thismodule_267_13 &  arg___this = cast_aot_arg<_lambda_thismodule_267_13 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_28116c91cb7e7e32(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickverify_evenTick14539409462116012840_247cf6e92f558dd ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t const  &)) &  arg_iter = cast_aot_arg<Sequence DAS_COMMENT((int32_t const  &)) & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickverify_evenTick14539409462116012840_247cf6e92f558dd(__context__, arg_iter);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeachTick9663565701927713696_f0f9ca53bb972a42 ( Context * __context__ ) {
+    Lambda DAS_COMMENT((bool,TArray<int32_t>)) const  arg_lam = cast_aot_arg<Lambda DAS_COMMENT((bool,TArray<int32_t>)) const >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((TArray<int32_t>)) *) __context__->abiCMRES) = _FuncbuiltinTickeachTick9663565701927713696_f0f9ca53bb972a42(__context__, arg_lam);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_95_14Tickfunction_41f4c7be3e839885 ( Context * __context__ ) {
+    _lambda_thismodule_95_14 &  arg___this = cast_aot_arg<_lambda_thismodule_95_14 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_95_14Tickfunction_41f4c7be3e839885(__context__, arg___this, arg_x));
+}
+static vec4f __wrap__Func_lambda_thismodule_95_14Tickfinalizer_221f3b5c59b2f23e ( Context * __context__ ) {
+    _lambda_thismodule_95_14 * arg___this = cast_aot_arg<_lambda_thismodule_95_14 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_95_14Tickfinalizer_221f3b5c59b2f23e(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickreduceTick3841530652084879893_b6f97e92cc2dae31 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t const  &)) &  arg_it = cast_aot_arg<Sequence DAS_COMMENT((int32_t const  &)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t>::from(_FuncfunctionalTickreduceTick3841530652084879893_b6f97e92cc2dae31(__context__, arg_it, arg_blk));
+}
+static vec4f __wrap__Func_lambda_thismodule_139_15Tickfunction_e5004b4a611d1a05 ( Context * __context__ ) {
+    _lambda_thismodule_139_15 &  arg___this = cast_aot_arg<_lambda_thismodule_139_15 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_y = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    return cast<int32_t>::from(_Func_lambda_thismodule_139_15Tickfunction_e5004b4a611d1a05(__context__, arg___this, arg_x, arg_y));
+}
+static vec4f __wrap__Func_lambda_thismodule_139_15Tickfinalizer_e90829968738666b ( Context * __context__ ) {
+    _lambda_thismodule_139_15 * arg___this = cast_aot_arg<_lambda_thismodule_139_15 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_139_15Tickfinalizer_e90829968738666b(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_187_16Tickfunction_d1e0f62285a7694a ( Context * __context__ ) {
+    _lambda_thismodule_187_16 &  arg___this = cast_aot_arg<_lambda_thismodule_187_16 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_187_16Tickfunction_d1e0f62285a7694a(__context__, arg___this, arg_x));
+}
+static vec4f __wrap__Func_lambda_thismodule_187_16Tickfinalizer_c0e055b2452d95a3 ( Context * __context__ ) {
+    _lambda_thismodule_187_16 * arg___this = cast_aot_arg<_lambda_thismodule_187_16 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_187_16Tickfinalizer_c0e055b2452d95a3(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_196_17Tickfunction_84aa853197614018 ( Context * __context__ ) {
+    _lambda_thismodule_196_17 &  arg___this = cast_aot_arg<_lambda_thismodule_196_17 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_196_17Tickfunction_84aa853197614018(__context__, arg___this, arg_x));
+}
+static vec4f __wrap__Func_lambda_thismodule_196_17Tickfinalizer_c5e37037ab3a54f8 ( Context * __context__ ) {
+    _lambda_thismodule_196_17 * arg___this = cast_aot_arg<_lambda_thismodule_196_17 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_196_17Tickfinalizer_c5e37037ab3a54f8(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_204_18Tickfunction_4718dbf6cf74bea9 ( Context * __context__ ) {
+    _lambda_thismodule_204_18 &  arg___this = cast_aot_arg<_lambda_thismodule_204_18 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_204_18Tickfunction_4718dbf6cf74bea9(__context__, arg___this, arg_x));
+}
+static vec4f __wrap__Func_lambda_thismodule_204_18Tickfinalizer_123173ed11fd8cc9 ( Context * __context__ ) {
+    _lambda_thismodule_204_18 * arg___this = cast_aot_arg<_lambda_thismodule_204_18 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_204_18Tickfinalizer_123173ed11fd8cc9(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_arrayTick9505582033551971916_e5f10801382c0f4 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_it = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_arrayTick9505582033551971916_e5f10801382c0f4(__context__, arg_it);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickcycleTick13989071893922639452_18378972141a1c5 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) *) __context__->abiCMRES) = _FuncfunctionalTickcycleTick13989071893922639452_18378972141a1c5(__context__, arg_src);
+    return v_zero();
+}
+static vec4f __wrap_finalize_cb36ba2e25782d6b ( Context * __context__ ) {
+    _lambda_thismodule_265_3 &  arg___this = cast_aot_arg<_lambda_thismodule_265_3 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_cb36ba2e25782d6b(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_62b17dfd9f1d0712 ( Context * __context__ ) {
+    _lambda_thismodule_74_4 &  arg___this = cast_aot_arg<_lambda_thismodule_74_4 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_62b17dfd9f1d0712(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickfilter_anyTick8436123068441528563_cf9abcab74536fb8 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Func DAS_COMMENT((bool,int32_t)) arg_blk = cast_aot_arg<Func DAS_COMMENT((bool,int32_t))>::to(*__context__,__context__->abiArguments()[1]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncfunctionalTickfilter_anyTick8436123068441528563_cf9abcab74536fb8(__context__, arg_src, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickfilter_anyTick8436123068441528563_da357379b896e3f5 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Lambda DAS_COMMENT((bool,int32_t)) arg_blk = cast_aot_arg<Lambda DAS_COMMENT((bool,int32_t))>::to(*__context__,__context__->abiArguments()[1]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncfunctionalTickfilter_anyTick8436123068441528563_da357379b896e3f5(__context__, arg_src, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickmap_anyTick4479995923280306007_6024d756272a5506 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Func DAS_COMMENT((int32_t,int32_t)) arg_blk = cast_aot_arg<Func DAS_COMMENT((int32_t,int32_t))>::to(*__context__,__context__->abiArguments()[1]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncfunctionalTickmap_anyTick4479995923280306007_6024d756272a5506(__context__, arg_src, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickmap_anyTick4479995923280306007_83291c8f47dbbb44 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Lambda DAS_COMMENT((int32_t,int32_t)) arg_blk = cast_aot_arg<Lambda DAS_COMMENT((int32_t,int32_t))>::to(*__context__,__context__->abiArguments()[1]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncfunctionalTickmap_anyTick4479995923280306007_83291c8f47dbbb44(__context__, arg_src, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickreduce_anyTick10888502122296883119_8b35df0f139e9bed ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_it = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  arg_functor = cast_aot_arg<Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t>::from(_FuncfunctionalTickreduce_anyTick10888502122296883119_8b35df0f139e9bed(__context__, arg_it, arg_functor));
+}
+static vec4f __wrap_finalize_a279035facdd537 ( Context * __context__ ) {
+    _lambda_thismodule_130_5 &  arg___this = cast_aot_arg<_lambda_thismodule_130_5 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_a279035facdd537(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickreduce_anyTick10888502122296883119_d6c8298b3db4c09d ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_it = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  arg_functor = cast_aot_arg<Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t>::from(_FuncfunctionalTickreduce_anyTick10888502122296883119_d6c8298b3db4c09d(__context__, arg_it, arg_functor));
+}
+static vec4f __wrap__FuncfunctionalTickreduce_anyTick10888502122296883119_616d986e179b8b90 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_it = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  arg_functor = cast_aot_arg<Func DAS_COMMENT((int32_t,int32_t,int32_t)) const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t>::from(_FuncfunctionalTickreduce_anyTick10888502122296883119_616d986e179b8b90(__context__, arg_it, arg_functor));
+}
+static vec4f __wrap__FuncfunctionalTickmap_anyTick4479995923280306007_c7dd7fda4ce435b2 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) arg_blk = cast_aot_arg<Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t))>::to(*__context__,__context__->abiArguments()[1]);
+    *((Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) *) __context__->abiCMRES) = _FuncfunctionalTickmap_anyTick4479995923280306007_c7dd7fda4ce435b2(__context__, arg_src, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickmap_anyTick4479995923280306007_1ca21edec6aad716 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Lambda DAS_COMMENT((bool,int32_t)) arg_blk = cast_aot_arg<Lambda DAS_COMMENT((bool,int32_t))>::to(*__context__,__context__->abiArguments()[1]);
+    *((Sequence DAS_COMMENT((bool)) *) __context__->abiCMRES) = _FuncfunctionalTickmap_anyTick4479995923280306007_1ca21edec6aad716(__context__, arg_src, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap_finalize_b0b0293ec1ad9f13 ( Context * __context__ ) {
+    _lambda_thismodule_251_6 &  arg___this = cast_aot_arg<_lambda_thismodule_251_6 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_b0b0293ec1ad9f13(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_31cc77b2547050ca ( Context * __context__ ) {
+    _lambda_thismodule_256_7 &  arg___this = cast_aot_arg<_lambda_thismodule_256_7 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_31cc77b2547050ca(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_6539699a4f0bba06 ( Context * __context__ ) {
+    _lambda_thismodule_259_8 &  arg___this = cast_aot_arg<_lambda_thismodule_259_8 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_6539699a4f0bba06(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_fa5ef013837c31d7 ( Context * __context__ ) {
+    _lambda_thismodule_271_9 &  arg___this = cast_aot_arg<_lambda_thismodule_271_9 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_fa5ef013837c31d7(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeachTick9663565701927713696_38bf4259f235eb1a ( Context * __context__ ) {
+    Lambda DAS_COMMENT((bool,int32_t &)) const  arg_lam = cast_aot_arg<Lambda DAS_COMMENT((bool,int32_t &)) const >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncbuiltinTickeachTick9663565701927713696_38bf4259f235eb1a(__context__, arg_lam);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeach_refTick16137060296763333387_c02a41a483b3f169 ( Context * __context__ ) {
+    Lambda DAS_COMMENT((bool,int32_t const  * &)) const  arg_lam = cast_aot_arg<Lambda DAS_COMMENT((bool,int32_t const  * &)) const >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t &)) *) __context__->abiCMRES) = _FuncbuiltinTickeach_refTick16137060296763333387_c02a41a483b3f169(__context__, arg_lam);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_80_10Tickfunction_3c937939c9fac98d ( Context * __context__ ) {
+    _lambda_thismodule_80_10 &  arg___this = cast_aot_arg<_lambda_thismodule_80_10 & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> &  arg__yield_80 = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_80_10Tickfunction_3c937939c9fac98d(__context__, arg___this, arg__yield_80));
+}
+static vec4f __wrap__Func_lambda_thismodule_80_10Tickfinalizer_305dc02b66553696 ( Context * __context__ ) {
+    _lambda_thismodule_80_10 * arg___this = cast_aot_arg<_lambda_thismodule_80_10 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_80_10Tickfinalizer_305dc02b66553696(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickemplaceTick13923705686753630697_908411b5f172f3d6 ( Context * __context__ ) {
+    TArray<TArray<int32_t>> &  arg_Arr = cast_aot_arg<TArray<TArray<int32_t>> & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> &  arg_value = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickemplaceTick13923705686753630697_908411b5f172f3d6(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickverify_14Tick7691774253321735872_210d806253f397db ( Context * __context__ ) {
+    TArray<TArray<int32_t>> &  arg_t = cast_aot_arg<TArray<TArray<int32_t>> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickverify_14Tick7691774253321735872_210d806253f397db(__context__, arg_t);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_114_11Tickfunction_6bd9593925568168 ( Context * __context__ ) {
+    _lambda_thismodule_114_11 &  arg___this = cast_aot_arg<_lambda_thismodule_114_11 & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> &  arg__yield_114 = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_114_11Tickfunction_6bd9593925568168(__context__, arg___this, arg__yield_114));
+}
+static vec4f __wrap__Func_lambda_thismodule_114_11Tickfinalizer_a5b4847c5ce5a138 ( Context * __context__ ) {
+    _lambda_thismodule_114_11 * arg___this = cast_aot_arg<_lambda_thismodule_114_11 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_114_11Tickfinalizer_a5b4847c5ce5a138(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<TArray<int32_t> &>::from(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14(__context__, arg_a));
+}
+static vec4f __wrap__FuncfunctionalTickis_equalTick13663318146853733238_ab1cff754c041ab7 ( Context * __context__ ) {
+    int32_t arg_a = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_b = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_FuncfunctionalTickis_equalTick13663318146853733238_ab1cff754c041ab7(__context__, arg_a, arg_b));
+}
+static vec4f __wrap__FuncbuiltinTickeachTick9663565701927713696_403560d62bbc8525 ( Context * __context__ ) {
+    Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float>)) const  arg_lam = cast_aot_arg<Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float>)) const >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) *) __context__->abiCMRES) = _FuncbuiltinTickeachTick9663565701927713696_403560d62bbc8525(__context__, arg_lam);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_264_12Tickfunction_54c8b26adfbe6824 ( Context * __context__ ) {
+    _lambda_thismodule_264_12 &  arg___this = cast_aot_arg<_lambda_thismodule_264_12 & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> &  arg__yield_264 = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_264_12Tickfunction_54c8b26adfbe6824(__context__, arg___this, arg__yield_264));
+}
+static vec4f __wrap__Func_lambda_thismodule_264_12Tickfinalizer_70bc360bf5cc37dc ( Context * __context__ ) {
+    _lambda_thismodule_264_12 * arg___this = cast_aot_arg<_lambda_thismodule_264_12 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_264_12Tickfinalizer_70bc360bf5cc37dc(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_267_13Tickfunction_2a097cd137ff1ae1 ( Context * __context__ ) {
+    _lambda_thismodule_267_13 &  arg___this = cast_aot_arg<_lambda_thismodule_267_13 & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> &  arg__yield_267 = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_267_13Tickfunction_2a097cd137ff1ae1(__context__, arg___this, arg__yield_267));
+}
+static vec4f __wrap__Func_lambda_thismodule_267_13Tickfinalizer_59ec7061b5053592 ( Context * __context__ ) {
+    _lambda_thismodule_267_13 * arg___this = cast_aot_arg<_lambda_thismodule_267_13 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_267_13Tickfinalizer_59ec7061b5053592(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_b86adca48494f93d ( Context * __context__ ) {
+    _lambda_thismodule_109_1 &  arg___this = cast_aot_arg<_lambda_thismodule_109_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_b86adca48494f93d(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_b0cb4b9f8708f3b3 ( Context * __context__ ) {
+    _lambda_thismodule_163_2 &  arg___this = cast_aot_arg<_lambda_thismodule_163_2 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_b0cb4b9f8708f3b3(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_265_3Tickfunction_2781a4c515b28b11 ( Context * __context__ ) {
+    _lambda_thismodule_265_3 &  arg___this = cast_aot_arg<_lambda_thismodule_265_3 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg__yield_265 = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_265_3Tickfunction_2781a4c515b28b11(__context__, arg___this, arg__yield_265));
+}
+static vec4f __wrap__Func_lambda_thismodule_265_3Tickfinalizer_bb465553714d8a66 ( Context * __context__ ) {
+    _lambda_thismodule_265_3 * arg___this = cast_aot_arg<_lambda_thismodule_265_3 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_265_3Tickfinalizer_bb465553714d8a66(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_74_4Tickfunction_a153f2b76711af8f ( Context * __context__ ) {
+    _lambda_thismodule_74_4 &  arg___this = cast_aot_arg<_lambda_thismodule_74_4 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t const  * & arg__ryield74 = cast_aot_arg<int32_t const  * &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_74_4Tickfunction_a153f2b76711af8f(__context__, arg___this, arg__ryield74));
+}
+static vec4f __wrap__Func_lambda_thismodule_74_4Tickfinalizer_afac0294c48ec518 ( Context * __context__ ) {
+    _lambda_thismodule_74_4 * arg___this = cast_aot_arg<_lambda_thismodule_74_4 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_74_4Tickfinalizer_afac0294c48ec518(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_value = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickverify_evenTick16438837766850132515_8c37383502cdd9d4 ( Context * __context__ ) {
+    TArray<int32_t> const  &  arg_arr = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickverify_evenTick16438837766850132515_8c37383502cdd9d4(__context__, arg_arr);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickfilterTick2611906363669329552_b14e0f0747da1864 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Func DAS_COMMENT((bool,int32_t)) const  arg_blk = cast_aot_arg<Func DAS_COMMENT((bool,int32_t)) const >::to(*__context__,__context__->abiArguments()[1]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncfunctionalTickfilterTick2611906363669329552_b14e0f0747da1864(__context__, arg_src, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickfilterTick17052258911568430960_c5b51d79366e68ab ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Lambda DAS_COMMENT((bool,int32_t)) const  arg_blk = cast_aot_arg<Lambda DAS_COMMENT((bool,int32_t)) const >::to(*__context__,__context__->abiArguments()[1]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncfunctionalTickfilterTick17052258911568430960_c5b51d79366e68ab(__context__, arg_src, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickmapTick1994230664415641751_9824beb79d88ab9b ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Func DAS_COMMENT((int32_t,int32_t)) const  arg_blk = cast_aot_arg<Func DAS_COMMENT((int32_t,int32_t)) const >::to(*__context__,__context__->abiArguments()[1]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncfunctionalTickmapTick1994230664415641751_9824beb79d88ab9b(__context__, arg_src, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickmapTick3767370688684665805_f8ebf27fc6d50619 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Lambda DAS_COMMENT((int32_t,int32_t)) const  arg_blk = cast_aot_arg<Lambda DAS_COMMENT((int32_t,int32_t)) const >::to(*__context__,__context__->abiArguments()[1]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncfunctionalTickmapTick3767370688684665805_f8ebf27fc6d50619(__context__, arg_src, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickreduceTick3841530652084879893_4e6a88b61e02101d ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_it = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t>::from(_FuncfunctionalTickreduceTick3841530652084879893_4e6a88b61e02101d(__context__, arg_it, arg_blk));
+}
+static vec4f __wrap__Func_lambda_thismodule_130_5Tickfunction_3c6eacc4fad58ddb ( Context * __context__ ) {
+    _lambda_thismodule_130_5 &  arg___this = cast_aot_arg<_lambda_thismodule_130_5 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t const  * & arg__ryield130 = cast_aot_arg<int32_t const  * &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_130_5Tickfunction_3c6eacc4fad58ddb(__context__, arg___this, arg__ryield130));
+}
+static vec4f __wrap__Func_lambda_thismodule_130_5Tickfinalizer_83528de467f2bb86 ( Context * __context__ ) {
+    _lambda_thismodule_130_5 * arg___this = cast_aot_arg<_lambda_thismodule_130_5 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_130_5Tickfinalizer_83528de467f2bb86(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickreduceTick3815634954217254421_637b69df14cebf47 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_it = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  arg_blk = cast_aot_arg<Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t>::from(_FuncfunctionalTickreduceTick3815634954217254421_637b69df14cebf47(__context__, arg_it, arg_blk));
+}
+static vec4f __wrap__FuncfunctionalTickreduceTick12199344316191013487_ce2eb4d61b1b6a52 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_it = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  arg_blk = cast_aot_arg<Func DAS_COMMENT((int32_t,int32_t,int32_t)) const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t>::from(_FuncfunctionalTickreduceTick12199344316191013487_ce2eb4d61b1b6a52(__context__, arg_it, arg_blk));
+}
+static vec4f __wrap__FuncfunctionalTickmapTick3767370688684665805_210e299a5936eafc ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) const  arg_blk = cast_aot_arg<Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) const >::to(*__context__,__context__->abiArguments()[1]);
+    *((Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) *) __context__->abiCMRES) = _FuncfunctionalTickmapTick3767370688684665805_210e299a5936eafc(__context__, arg_src, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTicksumTick17873460401295886850_17c4e2f4f54c1187 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_it = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(_FuncfunctionalTicksumTick17873460401295886850_17c4e2f4f54c1187(__context__, arg_it));
+}
+static vec4f __wrap__FuncfunctionalTickmapTick3767370688684665805_91ba24b601ec1f6a ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    Lambda DAS_COMMENT((bool,int32_t)) const  arg_blk = cast_aot_arg<Lambda DAS_COMMENT((bool,int32_t)) const >::to(*__context__,__context__->abiArguments()[1]);
+    *((Sequence DAS_COMMENT((bool)) *) __context__->abiCMRES) = _FuncfunctionalTickmapTick3767370688684665805_91ba24b601ec1f6a(__context__, arg_src, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickcycleTick13989071893922639452_52c9b4b9346a07f9 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncfunctionalTickcycleTick13989071893922639452_52c9b4b9346a07f9(__context__, arg_src);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_251_6Tickfunction_1f5cce243f6a7a42 ( Context * __context__ ) {
+    _lambda_thismodule_251_6 &  arg___this = cast_aot_arg<_lambda_thismodule_251_6 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg__yield_251 = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_251_6Tickfunction_1f5cce243f6a7a42(__context__, arg___this, arg__yield_251));
+}
+static vec4f __wrap__Func_lambda_thismodule_251_6Tickfinalizer_ed9e37bfaf4f898a ( Context * __context__ ) {
+    _lambda_thismodule_251_6 * arg___this = cast_aot_arg<_lambda_thismodule_251_6 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_251_6Tickfinalizer_ed9e37bfaf4f898a(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_256_7Tickfunction_8da15827f11974f6 ( Context * __context__ ) {
+    _lambda_thismodule_256_7 &  arg___this = cast_aot_arg<_lambda_thismodule_256_7 & >::to(*__context__,__context__->abiArguments()[0]);
+    TTuple<8,int32_t,float> &  arg__yield_256 = cast_aot_arg<TTuple<8,int32_t,float> & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_256_7Tickfunction_8da15827f11974f6(__context__, arg___this, arg__yield_256));
+}
+static vec4f __wrap__Func_lambda_thismodule_256_7Tickfinalizer_d2f7d1de26ba32e1 ( Context * __context__ ) {
+    _lambda_thismodule_256_7 * arg___this = cast_aot_arg<_lambda_thismodule_256_7 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_256_7Tickfinalizer_d2f7d1de26ba32e1(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_259_8Tickfunction_6259af6c65cab550 ( Context * __context__ ) {
+    _lambda_thismodule_259_8 &  arg___this = cast_aot_arg<_lambda_thismodule_259_8 & >::to(*__context__,__context__->abiArguments()[0]);
+    TTuple<8,int32_t,float> &  arg__yield_259 = cast_aot_arg<TTuple<8,int32_t,float> & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_259_8Tickfunction_6259af6c65cab550(__context__, arg___this, arg__yield_259));
+}
+static vec4f __wrap__Func_lambda_thismodule_259_8Tickfinalizer_f9e9eb2f3c5501a9 ( Context * __context__ ) {
+    _lambda_thismodule_259_8 * arg___this = cast_aot_arg<_lambda_thismodule_259_8 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_259_8Tickfinalizer_f9e9eb2f3c5501a9(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_271_9Tickfunction_9db63ad06beaec8f ( Context * __context__ ) {
+    _lambda_thismodule_271_9 &  arg___this = cast_aot_arg<_lambda_thismodule_271_9 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t const  * & arg__ryield271 = cast_aot_arg<int32_t const  * &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_271_9Tickfunction_9db63ad06beaec8f(__context__, arg___this, arg__ryield271));
+}
+static vec4f __wrap__Func_lambda_thismodule_271_9Tickfinalizer_366fe232fcac2a26 ( Context * __context__ ) {
+    _lambda_thismodule_271_9 * arg___this = cast_aot_arg<_lambda_thismodule_271_9 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_271_9Tickfinalizer_366fe232fcac2a26(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115 ( Context * __context__ ) {
+    TDim<int32_t,2> &  arg_a = cast_aot_arg<TDim<int32_t,2> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 ( Context * __context__ ) {
+    range arg_rng = cast_aot_arg<range>::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__, arg_rng);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_109_1Tickfunction_cbda5cc99cf33214 ( Context * __context__ ) {
+    _lambda_thismodule_109_1 &  arg___this = cast_aot_arg<_lambda_thismodule_109_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t>::from(_Func_lambda_thismodule_109_1Tickfunction_cbda5cc99cf33214(__context__, arg___this, arg_x));
+}
+static vec4f __wrap__Func_lambda_thismodule_109_1Tickfinalizer_a9193e773e020d98 ( Context * __context__ ) {
+    _lambda_thismodule_109_1 * arg___this = cast_aot_arg<_lambda_thismodule_109_1 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_109_1Tickfinalizer_a9193e773e020d98(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b ( Context * __context__ ) {
+    TDim<int32_t,3> &  arg_a = cast_aot_arg<TDim<int32_t,3> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_163_2Tickfunction_d1ac8639c9d7a0ca ( Context * __context__ ) {
+    _lambda_thismodule_163_2 &  arg___this = cast_aot_arg<_lambda_thismodule_163_2 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    *((TTuple<8,int32_t,float> *) __context__->abiCMRES) = _Func_lambda_thismodule_163_2Tickfunction_d1ac8639c9d7a0ca(__context__, arg___this, arg_x);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_163_2Tickfinalizer_e24e528e5a88c81 ( Context * __context__ ) {
+    _lambda_thismodule_163_2 * arg___this = cast_aot_arg<_lambda_thismodule_163_2 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_163_2Tickfinalizer_e24e528e5a88c81(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickanyTick3153855942392455914_5e0e9c66abeffa8f ( Context * __context__ ) {
+    TDim<bool,2> const  &  arg_it = cast_aot_arg<TDim<bool,2> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<bool>::from(_FuncfunctionalTickanyTick3153855942392455914_5e0e9c66abeffa8f(__context__, arg_it));
+}
+static vec4f __wrap__FuncfunctionalTickisliceTick565469751076799399_266369a698f370fe ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_src = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_start = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_stop = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncfunctionalTickisliceTick565469751076799399_266369a698f370fe(__context__, arg_src, arg_start, arg_stop);
+    return v_zero();
+}
+static vec4f __wrap__FuncfunctionalTickrepeatTick5582964371469216548_dfc9e5bf3c1c1ae1 ( Context * __context__ ) {
+    int32_t arg_value = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_count = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncfunctionalTickrepeatTick5582964371469216548_dfc9e5bf3c1c1ae1(__context__, arg_value, arg_count);
+    return v_zero();
+}
+static vec4f __wrap_is_even_28e79c60210e5b07 ( Context * __context__ ) {
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<bool>::from(is_even_28e79c60210e5b07(__context__, arg_x));
+}
+static vec4f __wrap_twice_cddb661caae60bf4 ( Context * __context__ ) {
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(twice_cddb661caae60bf4(__context__, arg_x));
+}
+static vec4f __wrap_add_b9c39300f347f461 ( Context * __context__ ) {
+    int32_t arg_a = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_b = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t>::from(add_b9c39300f347f461(__context__, arg_a, arg_b));
+}
+static vec4f __wrap__FuncExclEqu_fd3ae9a2691a110b ( Context * __context__ ) {
+    TTuple<8,int32_t,float> const  &  arg_a = cast_aot_arg<TTuple<8,int32_t,float> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    TTuple<8,int32_t,float> const  &  arg_b = cast_aot_arg<TTuple<8,int32_t,float> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_FuncExclEqu_fd3ae9a2691a110b(__context__, arg_a, arg_b));
+}
+static vec4f __wrap__FuncExclEqu_f90153e54231f783 ( Context * __context__ ) {
+    TArray<int32_t> const  &  arg_a = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> const  &  arg_b = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_FuncExclEqu_f90153e54231f783(__context__, arg_a, arg_b));
+}
+static vec4f __wrap_test_108d10aea454bc3b ( Context * __context__ ) {
+    return cast<bool>::from(test_108d10aea454bc3b(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xa2628fd17d457506, false, (void*)&finalize_5c3fa10faeab6f5b, &__wrap_finalize_5c3fa10faeab6f5b },
+    { 0x8b5186a9542d1a4c, false, (void*)&_Func_lambda_thismodule_46_36Tickfunction_b499ef7f7ef1a851, &__wrap__Func_lambda_thismodule_46_36Tickfunction_b499ef7f7ef1a851 },
+    { 0x6c29f2117723f95a, false, (void*)&_Func_lambda_thismodule_46_36Tickfinalizer_84a9c3600660c442, &__wrap__Func_lambda_thismodule_46_36Tickfinalizer_84a9c3600660c442 },
+    { 0xce1cb516a6d207e1, false, (void*)&finalize_e3ab08cedd375fa, &__wrap_finalize_e3ab08cedd375fa },
+    { 0xca898e2cb801a4fc, false, (void*)&_Func_lambda_thismodule_117_35Tickfunction_4cba99b90ac6a708, &__wrap__Func_lambda_thismodule_117_35Tickfunction_4cba99b90ac6a708 },
+    { 0xecccaec37ff83b82, false, (void*)&_Func_lambda_thismodule_117_35Tickfinalizer_20c0cf0819a8cef4, &__wrap__Func_lambda_thismodule_117_35Tickfinalizer_20c0cf0819a8cef4 },
+    { 0xc1af0010a706762d, true, (void*)&_FuncfunctionalTickmap_anyTick4479995923280306007_5642e543b9d04ef3, &__wrap__FuncfunctionalTickmap_anyTick4479995923280306007_5642e543b9d04ef3 },
+    { 0x5e8700914eff1e69, false, (void*)&_FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5, &__wrap__FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5 },
+    { 0x6ce14cadddbfa1c9, true, (void*)&_FuncfunctionalTickmapTick3767370688684665805_7dd7ef6681f58a23, &__wrap__FuncfunctionalTickmapTick3767370688684665805_7dd7ef6681f58a23 },
+    { 0x2684aa87cfefc9eb, false, (void*)&finalize_935fd2f8295ecce9, &__wrap_finalize_935fd2f8295ecce9 },
+    { 0x2072036a1da9494, true, (void*)&_FuncbuiltinTickmove_to_localTick14376033101315213529_a3eb4ebbfa51707, &__wrap__FuncbuiltinTickmove_to_localTick14376033101315213529_a3eb4ebbfa51707 },
+    { 0xe13bd4f320f426fb, false, (void*)&_Func_lambda_thismodule_57_34Tickfunction_8e7015a5e889f99c, &__wrap__Func_lambda_thismodule_57_34Tickfunction_8e7015a5e889f99c },
+    { 0x34c66317f86d3bb5, false, (void*)&_Func_lambda_thismodule_57_34Tickfinalizer_37a60b4798f52ebf, &__wrap__Func_lambda_thismodule_57_34Tickfinalizer_37a60b4798f52ebf },
+    { 0xfb5e944b3bfafd51, false, (void*)&_FuncTickis_sameTick245538717971957847_5920cebe138ff292, &__wrap__FuncTickis_sameTick245538717971957847_5920cebe138ff292 },
+    { 0xb15cdce2598d4e95, false, (void*)&finalize_da055a40908e26, &__wrap_finalize_da055a40908e26 },
+    { 0xe859c1b0f16fbee6, false, (void*)&_FuncTickis_sameTick245538717971957847_a9c0341708763739, &__wrap__FuncTickis_sameTick245538717971957847_a9c0341708763739 },
+    { 0xfbf53b0f49090a45, false, (void*)&finalize_322b586a61b59695, &__wrap_finalize_322b586a61b59695 },
+    { 0x93e9d002e895e09e, false, (void*)&finalize_4f7eb10f7e42945c, &__wrap_finalize_4f7eb10f7e42945c },
+    { 0xbfb8262bb099094c, false, (void*)&_Func_lambda_thismodule_239_33Tickfunction_c893b561a33638e4, &__wrap__Func_lambda_thismodule_239_33Tickfunction_c893b561a33638e4 },
+    { 0xc12c1c0dad648bf6, false, (void*)&_Func_lambda_thismodule_239_33Tickfinalizer_a4e5d7e39be05c5d, &__wrap__Func_lambda_thismodule_239_33Tickfinalizer_a4e5d7e39be05c5d },
+    { 0x9eb30f01a2eb88b3, false, (void*)&_FuncbuiltinTickfinalizeTick13836114024949725080_fa51d566d7dfd53e, &__wrap__FuncbuiltinTickfinalizeTick13836114024949725080_fa51d566d7dfd53e },
+    { 0xb60bef81fddaf523, false, (void*)&_Func_lambda_thismodule_239_31Tickfunction_bfb87e4067b2a8d8, &__wrap__Func_lambda_thismodule_239_31Tickfunction_bfb87e4067b2a8d8 },
+    { 0x29a173b5650bc2b8, false, (void*)&_Func_lambda_thismodule_239_31Tickfinalizer_58d02024b348deca, &__wrap__Func_lambda_thismodule_239_31Tickfinalizer_58d02024b348deca },
+    { 0xcad6c5fc7035eff5, false, (void*)&_FuncbuiltinTickfinalizeTick13836114024949725080_81327841969947fa, &__wrap__FuncbuiltinTickfinalizeTick13836114024949725080_81327841969947fa },
+    { 0x43681333b097987d, true, (void*)&_Func_lambda_thismodule_116_32Tickfunction_fb95bbf9fac8f359, &__wrap__Func_lambda_thismodule_116_32Tickfunction_fb95bbf9fac8f359 },
+    { 0xb0b6e22691972c2a, false, (void*)&_Func_lambda_thismodule_116_32Tickfinalizer_4f9418ced39b6d4a, &__wrap__Func_lambda_thismodule_116_32Tickfinalizer_4f9418ced39b6d4a },
+    { 0x7fe54c463d8501d7, true, (void*)&_FuncfunctionalTickmap_anyTick4479995923280306007_7911bf7d28600067, &__wrap__FuncfunctionalTickmap_anyTick4479995923280306007_7911bf7d28600067 },
+    { 0xca1141a5df264c9, false, (void*)&_FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62, &__wrap__FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 },
+    { 0x5516287c825098dc, false, (void*)&_FuncTickfirstTick947304547137840980_5c6792106670b351, &__wrap__FuncTickfirstTick947304547137840980_5c6792106670b351 },
+    { 0xc9fdd82183767a1e, true, (void*)&_FuncfunctionalTickreduce_anyTick10888502122296883119_349cc66090f1ae3b, &__wrap__FuncfunctionalTickreduce_anyTick10888502122296883119_349cc66090f1ae3b },
+    { 0x7bd2bbdfc426831, false, (void*)&finalize_5cef76514cdcd502, &__wrap_finalize_5cef76514cdcd502 },
+    { 0x21ae31c20f743ad3, true, (void*)&_FuncbuiltinTickeachTick6002865651812066953_79ce88e42c3e3433, &__wrap__FuncbuiltinTickeachTick6002865651812066953_79ce88e42c3e3433 },
+    { 0x84908fa671ce3a30, false, (void*)&_FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd, &__wrap__FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd },
+    { 0x3917230f430099ac, true, (void*)&_FuncfunctionalTickmapTick3767370688684665805_afc82126cea94d6e, &__wrap__FuncfunctionalTickmapTick3767370688684665805_afc82126cea94d6e },
+    { 0x631a1fc3b9fa87eb, false, (void*)&_FuncfunctionalTicknotTick15126137237442268133_5718a646ccd351d7, &__wrap__FuncfunctionalTicknotTick15126137237442268133_5718a646ccd351d7 },
+    { 0x2ae0260ace436ebe, false, (void*)&finalize_7980aaa0c8ca61d4, &__wrap_finalize_7980aaa0c8ca61d4 },
+    { 0xf48e010d9d617c1d, true, (void*)&_FuncbuiltinTickeachTick6002865651812066953_e372b165824f649d, &__wrap__FuncbuiltinTickeachTick6002865651812066953_e372b165824f649d },
+    { 0xbd0ebb782451d9fc, true, (void*)&_FuncfunctionalTickreduceTick3841530652084879893_a9fc9323110bc9fc, &__wrap__FuncfunctionalTickreduceTick3841530652084879893_a9fc9323110bc9fc },
+    { 0xa4dca93257afa7e9, false, (void*)&_FuncfunctionalTickanyTick3860067047720393563_f5b4a194f258ddd0, &__wrap__FuncfunctionalTickanyTick3860067047720393563_f5b4a194f258ddd0 },
+    { 0x639cb5c6dcb32409, false, (void*)&_FuncfunctionalTickallTick13174627742298730649_9c3f2431cb8402f6, &__wrap__FuncfunctionalTickallTick13174627742298730649_9c3f2431cb8402f6 },
+    { 0x727d4646265b4cca, true, (void*)&_FuncfunctionalTickisliceTick565469751076799399_bdd25b8f8cc2dbf5, &__wrap__FuncfunctionalTickisliceTick565469751076799399_bdd25b8f8cc2dbf5 },
+    { 0x26ab4a0677bc22b0, false, (void*)&finalize_cdfff6625092eae1, &__wrap_finalize_cdfff6625092eae1 },
+    { 0x371847efa92092f9, false, (void*)&finalize_3dcae5fa4b700dd5, &__wrap_finalize_3dcae5fa4b700dd5 },
+    { 0x30f1e2416f1dbc4c, false, (void*)&finalize_ce54b4b3dece547c, &__wrap_finalize_ce54b4b3dece547c },
+    { 0x8be66325d3596dcb, false, (void*)&finalize_cb863a01181cc563, &__wrap_finalize_cb863a01181cc563 },
+    { 0x13bd0d887bb961d9, false, (void*)&finalize_eb39c4fa0e0aa9cb, &__wrap_finalize_eb39c4fa0e0aa9cb },
+    { 0x8b0b71de5a0c65f5, false, (void*)&_Func_lambda_thismodule_21_30Tickfunction_124aecd4e54968e6, &__wrap__Func_lambda_thismodule_21_30Tickfunction_124aecd4e54968e6 },
+    { 0x65b4d6cc198ce7ac, false, (void*)&_Func_lambda_thismodule_21_30Tickfinalizer_f192f22a0f696612, &__wrap__Func_lambda_thismodule_21_30Tickfinalizer_f192f22a0f696612 },
+    { 0x668e73fef663e2a0, true, (void*)&_FuncbuiltinTickeach_refTick16137060296763333387_61841c1791c9b95f, &__wrap__FuncbuiltinTickeach_refTick16137060296763333387_61841c1791c9b95f },
+    { 0xb06a3b5639be5b74, true, (void*)&_FuncbuiltinTickeachTick9663565701927713696_c6a9cdebae4e9e7f, &__wrap__FuncbuiltinTickeachTick9663565701927713696_c6a9cdebae4e9e7f },
+    { 0xabf4bf8e8df0666c, true, (void*)&_FuncfunctionalTickisliceTick565469751076799399_f12d6c00813f9d8c, &__wrap__FuncfunctionalTickisliceTick565469751076799399_f12d6c00813f9d8c },
+    { 0x2184e20f056eb99a, false, (void*)&finalize_81b7faa9db9b97fa, &__wrap_finalize_81b7faa9db9b97fa },
+    { 0xf0218ad1850a26cf, true, (void*)&_FuncbuiltinTickeachTick6002865651812066953_693fb4484d509206, &__wrap__FuncbuiltinTickeachTick6002865651812066953_693fb4484d509206 },
+    { 0x4d948042b13e8f61, false, (void*)&_FuncbuiltinTickpush_cloneTick2035469273396957942_3c23be799e74aa72, &__wrap__FuncbuiltinTickpush_cloneTick2035469273396957942_3c23be799e74aa72 },
+    { 0x6c524ca95fc1827f, false, (void*)&_Func_lambda_thismodule_211_25Tickfunction_b51aa010f6a4cd23, &__wrap__Func_lambda_thismodule_211_25Tickfunction_b51aa010f6a4cd23 },
+    { 0x37b786ec4f9022dd, false, (void*)&_Func_lambda_thismodule_211_25Tickfinalizer_9448301fe12bf62, &__wrap__Func_lambda_thismodule_211_25Tickfinalizer_9448301fe12bf62 },
+    { 0x935725174b1da768, true, (void*)&_FuncbuiltinTickeach_refTick16137060296763333387_7462031b9a3d3d2e, &__wrap__FuncbuiltinTickeach_refTick16137060296763333387_7462031b9a3d3d2e },
+    { 0x6a4ee06d9ec908d8, false, (void*)&_Func_lambda_thismodule_46_26Tickfunction_55d29a7714c3b148, &__wrap__Func_lambda_thismodule_46_26Tickfunction_55d29a7714c3b148 },
+    { 0x753ada246c8c439e, false, (void*)&_Func_lambda_thismodule_46_26Tickfinalizer_3eae0ef5553264f8, &__wrap__Func_lambda_thismodule_46_26Tickfinalizer_3eae0ef5553264f8 },
+    { 0xfb8df7b24f84624b, false, (void*)&_Func_lambda_thismodule_46_27Tickfunction_bb17341466c4aa51, &__wrap__Func_lambda_thismodule_46_27Tickfunction_bb17341466c4aa51 },
+    { 0x76ccfc9d96466ddc, false, (void*)&_Func_lambda_thismodule_46_27Tickfinalizer_47b44357a235464e, &__wrap__Func_lambda_thismodule_46_27Tickfinalizer_47b44357a235464e },
+    { 0x5467b1b687c3770, true, (void*)&_FuncbuiltinTickcopy_to_localTick18007282088148548588_cf5b4d36c641ec89, &__wrap__FuncbuiltinTickcopy_to_localTick18007282088148548588_cf5b4d36c641ec89 },
+    { 0xc4ac438efb4555d6, false, (void*)&_Func_lambda_thismodule_46_28Tickfunction_4b6a017341fe0abc, &__wrap__Func_lambda_thismodule_46_28Tickfunction_4b6a017341fe0abc },
+    { 0x81bb8c23737b333b, false, (void*)&_Func_lambda_thismodule_46_28Tickfinalizer_1e6b86880ccb6112, &__wrap__Func_lambda_thismodule_46_28Tickfinalizer_1e6b86880ccb6112 },
+    { 0x4fea759aefffd005, false, (void*)&_Func_lambda_thismodule_46_29Tickfunction_c76a3c5f83d93d5e, &__wrap__Func_lambda_thismodule_46_29Tickfunction_c76a3c5f83d93d5e },
+    { 0xc42b050930a1bc82, false, (void*)&_Func_lambda_thismodule_46_29Tickfinalizer_ca4e9b0da58741b3, &__wrap__Func_lambda_thismodule_46_29Tickfinalizer_ca4e9b0da58741b3 },
+    { 0x82a9fc941046b97e, false, (void*)&_FuncTickverify_evenTick14539409462116012840_a41975d7eea83c28, &__wrap__FuncTickverify_evenTick14539409462116012840_a41975d7eea83c28 },
+    { 0x5e511bc3668fa31d, false, (void*)&_FuncTickis_sameTick245538717971957847_90778dcd8fe04dee, &__wrap__FuncTickis_sameTick245538717971957847_90778dcd8fe04dee },
+    { 0xf7a4c2ee1f8b4baf, false, (void*)&finalize_62288b18c551cda5, &__wrap_finalize_62288b18c551cda5 },
+    { 0xde1fd214a59c2f79, false, (void*)&finalize_c1432cdb99d257fc, &__wrap_finalize_c1432cdb99d257fc },
+    { 0xddcb8f15c9a7e357, false, (void*)&finalize_7e876d36e44179ae, &__wrap_finalize_7e876d36e44179ae },
+    { 0x7a17259fad84471b, false, (void*)&_FuncbuiltinTickpush_cloneTick2035469273396957942_b74d0b46559deb03, &__wrap__FuncbuiltinTickpush_cloneTick2035469273396957942_b74d0b46559deb03 },
+    { 0x8de0de14f11ae5e7, false, (void*)&_Func_lambda_thismodule_211_24Tickfunction_1529e8e196031a1, &__wrap__Func_lambda_thismodule_211_24Tickfunction_1529e8e196031a1 },
+    { 0xa44edab11ef7b340, false, (void*)&_Func_lambda_thismodule_211_24Tickfinalizer_438ffbc0f98e4f24, &__wrap__Func_lambda_thismodule_211_24Tickfinalizer_438ffbc0f98e4f24 },
+    { 0xeeff000928ec8251, false, (void*)&finalize_42bcf1754d30f3e6, &__wrap_finalize_42bcf1754d30f3e6 },
+    { 0x71f9fa05bb34aece, false, (void*)&_Func_lambda_thismodule_12_21Tickfunction_dc6a1502d70a914b, &__wrap__Func_lambda_thismodule_12_21Tickfunction_dc6a1502d70a914b },
+    { 0xf7b34c1e0b43f54d, false, (void*)&_Func_lambda_thismodule_12_21Tickfinalizer_b47553da6da1d917, &__wrap__Func_lambda_thismodule_12_21Tickfinalizer_b47553da6da1d917 },
+    { 0xa62fbd471a769920, false, (void*)&_Func_lambda_thismodule_12_22Tickfunction_8e677566a24aefee, &__wrap__Func_lambda_thismodule_12_22Tickfunction_8e677566a24aefee },
+    { 0x866f77ba4db1b5c1, false, (void*)&_Func_lambda_thismodule_12_22Tickfinalizer_c78986e767b672d2, &__wrap__Func_lambda_thismodule_12_22Tickfinalizer_c78986e767b672d2 },
+    { 0xbb51c79e283c8363, false, (void*)&_Func_lambda_thismodule_115_23Tickfunction_e14f1bfe624fc6d6, &__wrap__Func_lambda_thismodule_115_23Tickfunction_e14f1bfe624fc6d6 },
+    { 0x231b91ea9985becb, false, (void*)&_Func_lambda_thismodule_115_23Tickfinalizer_dbec80ebd1dc3ee7, &__wrap__Func_lambda_thismodule_115_23Tickfinalizer_dbec80ebd1dc3ee7 },
+    { 0x48cd8558b848f81e, false, (void*)&finalize_b3040909745498b4, &__wrap_finalize_b3040909745498b4 },
+    { 0x4050e97d7de1720c, true, (void*)&_FuncfunctionalTickfilter_anyTick8436123068441528563_ae7e887ff20f69cc, &__wrap__FuncfunctionalTickfilter_anyTick8436123068441528563_ae7e887ff20f69cc },
+    { 0xc457d81f8e94b71b, false, (void*)&_FuncbuiltinTickpushTick10769833213962245646_b2287abd57a15f1f, &__wrap__FuncbuiltinTickpushTick10769833213962245646_b2287abd57a15f1f },
+    { 0x7ad4a713a91f2f68, false, (void*)&_Func_lambda_thismodule_197_20Tickfunction_eee30c808afe7a78, &__wrap__Func_lambda_thismodule_197_20Tickfunction_eee30c808afe7a78 },
+    { 0x110497567ca992ea, false, (void*)&_Func_lambda_thismodule_197_20Tickfinalizer_25873a1f018a00f7, &__wrap__Func_lambda_thismodule_197_20Tickfinalizer_25873a1f018a00f7 },
+    { 0x4b030b298bad8fac, false, (void*)&finalize_89df3979aba5e810, &__wrap_finalize_89df3979aba5e810 },
+    { 0xe0d049fc93b4f2e2, false, (void*)&_FuncfunctionalTickreduce_anyTick10888502122296883119_91f3953a535f4618, &__wrap__FuncfunctionalTickreduce_anyTick10888502122296883119_91f3953a535f4618 },
+    { 0x426d0426b077c73e, false, (void*)&finalize_bad70fc7c4a20b23, &__wrap_finalize_bad70fc7c4a20b23 },
+    { 0xbb7292f1bbb05070, false, (void*)&finalize_66d38afb2a354c1, &__wrap_finalize_66d38afb2a354c1 },
+    { 0xa140129e4d264748, false, (void*)&finalize_7c209bed83355de7, &__wrap_finalize_7c209bed83355de7 },
+    { 0x7e7fdbe1b8036f4b, false, (void*)&finalize_598a8a4cb50aa870, &__wrap_finalize_598a8a4cb50aa870 },
+    { 0x12c9d5f33cefbaca, false, (void*)&_FuncbuiltinTickpush_cloneTick2035469273396957942_c2961e1e4b6c33a6, &__wrap__FuncbuiltinTickpush_cloneTick2035469273396957942_c2961e1e4b6c33a6 },
+    { 0xa51a880d594e91fd, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c },
+    { 0xc06956f9ba358942, false, (void*)&_Func_lambda_thismodule_230_19Tickfunction_b9e2ca9378874572, &__wrap__Func_lambda_thismodule_230_19Tickfunction_b9e2ca9378874572 },
+    { 0xbf50d8e1a77c813e, false, (void*)&_Func_lambda_thismodule_230_19Tickfinalizer_f638c8ae7033c789, &__wrap__Func_lambda_thismodule_230_19Tickfinalizer_f638c8ae7033c789 },
+    { 0xe3030a956df1ca9d, false, (void*)&_FuncTickverify_14Tick7691774253321735872_558fc829306e5cd4, &__wrap__FuncTickverify_14Tick7691774253321735872_558fc829306e5cd4 },
+    { 0x138e68539d3d2bd2, true, (void*)&_FuncfunctionalTickfilterTick17052258911568430960_b5ac07160cdff423, &__wrap__FuncfunctionalTickfilterTick17052258911568430960_b5ac07160cdff423 },
+    { 0xfc44ef067560b079, true, (void*)&_FuncfunctionalTickcycleTick13989071893922639452_e88690305df5dba6, &__wrap__FuncfunctionalTickcycleTick13989071893922639452_e88690305df5dba6 },
+    { 0xc57ba623d18b122b, false, (void*)&finalize_f644eb195de1df44, &__wrap_finalize_f644eb195de1df44 },
+    { 0xf1df47f942ce5b90, false, (void*)&finalize_f1103f2c3f9d49da, &__wrap_finalize_f1103f2c3f9d49da },
+    { 0x40f5fe7f60170a56, false, (void*)&finalize_612f25fea13eacd7, &__wrap_finalize_612f25fea13eacd7 },
+    { 0xb652d8272809b827, false, (void*)&finalize_28116c91cb7e7e32, &__wrap_finalize_28116c91cb7e7e32 },
+    { 0x705f2841178693c9, false, (void*)&_FuncTickverify_evenTick14539409462116012840_247cf6e92f558dd, &__wrap__FuncTickverify_evenTick14539409462116012840_247cf6e92f558dd },
+    { 0x764bb0f1c0dbc34c, true, (void*)&_FuncbuiltinTickeachTick9663565701927713696_f0f9ca53bb972a42, &__wrap__FuncbuiltinTickeachTick9663565701927713696_f0f9ca53bb972a42 },
+    { 0xe1b821c5927b77d4, false, (void*)&_Func_lambda_thismodule_95_14Tickfunction_41f4c7be3e839885, &__wrap__Func_lambda_thismodule_95_14Tickfunction_41f4c7be3e839885 },
+    { 0xa2972eb00d86a875, false, (void*)&_Func_lambda_thismodule_95_14Tickfinalizer_221f3b5c59b2f23e, &__wrap__Func_lambda_thismodule_95_14Tickfinalizer_221f3b5c59b2f23e },
+    { 0xcf7201dd351584b0, false, (void*)&_FuncfunctionalTickreduceTick3841530652084879893_b6f97e92cc2dae31, &__wrap__FuncfunctionalTickreduceTick3841530652084879893_b6f97e92cc2dae31 },
+    { 0x216a6b2621a80df8, false, (void*)&_Func_lambda_thismodule_139_15Tickfunction_e5004b4a611d1a05, &__wrap__Func_lambda_thismodule_139_15Tickfunction_e5004b4a611d1a05 },
+    { 0x49cac722f09081b3, false, (void*)&_Func_lambda_thismodule_139_15Tickfinalizer_e90829968738666b, &__wrap__Func_lambda_thismodule_139_15Tickfinalizer_e90829968738666b },
+    { 0xd604583b404ddfaf, false, (void*)&_Func_lambda_thismodule_187_16Tickfunction_d1e0f62285a7694a, &__wrap__Func_lambda_thismodule_187_16Tickfunction_d1e0f62285a7694a },
+    { 0x33d119db524bacd, false, (void*)&_Func_lambda_thismodule_187_16Tickfinalizer_c0e055b2452d95a3, &__wrap__Func_lambda_thismodule_187_16Tickfinalizer_c0e055b2452d95a3 },
+    { 0x2cd344e7ba98f4cf, false, (void*)&_Func_lambda_thismodule_196_17Tickfunction_84aa853197614018, &__wrap__Func_lambda_thismodule_196_17Tickfunction_84aa853197614018 },
+    { 0x10812bdee4628ca6, false, (void*)&_Func_lambda_thismodule_196_17Tickfinalizer_c5e37037ab3a54f8, &__wrap__Func_lambda_thismodule_196_17Tickfinalizer_c5e37037ab3a54f8 },
+    { 0x9c6623e424c90bce, false, (void*)&_Func_lambda_thismodule_204_18Tickfunction_4718dbf6cf74bea9, &__wrap__Func_lambda_thismodule_204_18Tickfunction_4718dbf6cf74bea9 },
+    { 0xf1aee7b4e8e55d49, false, (void*)&_Func_lambda_thismodule_204_18Tickfinalizer_123173ed11fd8cc9, &__wrap__Func_lambda_thismodule_204_18Tickfinalizer_123173ed11fd8cc9 },
+    { 0x7c6b325463a8e099, true, (void*)&_FuncbuiltinTickto_arrayTick9505582033551971916_e5f10801382c0f4, &__wrap__FuncbuiltinTickto_arrayTick9505582033551971916_e5f10801382c0f4 },
+    { 0x27d9945fa87a014e, true, (void*)&_FuncfunctionalTickcycleTick13989071893922639452_18378972141a1c5, &__wrap__FuncfunctionalTickcycleTick13989071893922639452_18378972141a1c5 },
+    { 0xc046ef3bb210333f, false, (void*)&finalize_cb36ba2e25782d6b, &__wrap_finalize_cb36ba2e25782d6b },
+    { 0x4d59211b2fea8b53, false, (void*)&finalize_62b17dfd9f1d0712, &__wrap_finalize_62b17dfd9f1d0712 },
+    { 0x80562e6376a6b646, true, (void*)&_FuncfunctionalTickfilter_anyTick8436123068441528563_cf9abcab74536fb8, &__wrap__FuncfunctionalTickfilter_anyTick8436123068441528563_cf9abcab74536fb8 },
+    { 0x8c3ae9b44a9bd7b4, true, (void*)&_FuncfunctionalTickfilter_anyTick8436123068441528563_da357379b896e3f5, &__wrap__FuncfunctionalTickfilter_anyTick8436123068441528563_da357379b896e3f5 },
+    { 0x9b4c26c1f54a4092, true, (void*)&_FuncfunctionalTickmap_anyTick4479995923280306007_6024d756272a5506, &__wrap__FuncfunctionalTickmap_anyTick4479995923280306007_6024d756272a5506 },
+    { 0xffd08285b8a26045, true, (void*)&_FuncfunctionalTickmap_anyTick4479995923280306007_83291c8f47dbbb44, &__wrap__FuncfunctionalTickmap_anyTick4479995923280306007_83291c8f47dbbb44 },
+    { 0x5eedde6712d78d2c, false, (void*)&_FuncfunctionalTickreduce_anyTick10888502122296883119_8b35df0f139e9bed, &__wrap__FuncfunctionalTickreduce_anyTick10888502122296883119_8b35df0f139e9bed },
+    { 0x958b9cf19c617ce9, false, (void*)&finalize_a279035facdd537, &__wrap_finalize_a279035facdd537 },
+    { 0x86a53afb59a9bd09, false, (void*)&_FuncfunctionalTickreduce_anyTick10888502122296883119_d6c8298b3db4c09d, &__wrap__FuncfunctionalTickreduce_anyTick10888502122296883119_d6c8298b3db4c09d },
+    { 0xa88e439341880fb6, false, (void*)&_FuncfunctionalTickreduce_anyTick10888502122296883119_616d986e179b8b90, &__wrap__FuncfunctionalTickreduce_anyTick10888502122296883119_616d986e179b8b90 },
+    { 0x32f4fb82126647d3, true, (void*)&_FuncfunctionalTickmap_anyTick4479995923280306007_c7dd7fda4ce435b2, &__wrap__FuncfunctionalTickmap_anyTick4479995923280306007_c7dd7fda4ce435b2 },
+    { 0xfffacd05e35b5ccf, true, (void*)&_FuncfunctionalTickmap_anyTick4479995923280306007_1ca21edec6aad716, &__wrap__FuncfunctionalTickmap_anyTick4479995923280306007_1ca21edec6aad716 },
+    { 0xda113d2fe269e2e3, false, (void*)&finalize_b0b0293ec1ad9f13, &__wrap_finalize_b0b0293ec1ad9f13 },
+    { 0x2f3689616466dcf, false, (void*)&finalize_31cc77b2547050ca, &__wrap_finalize_31cc77b2547050ca },
+    { 0x6193a3a2e30450d5, false, (void*)&finalize_6539699a4f0bba06, &__wrap_finalize_6539699a4f0bba06 },
+    { 0xf2134835507606c6, false, (void*)&finalize_fa5ef013837c31d7, &__wrap_finalize_fa5ef013837c31d7 },
+    { 0x4fd4926bdbcd4edf, true, (void*)&_FuncbuiltinTickeachTick9663565701927713696_38bf4259f235eb1a, &__wrap__FuncbuiltinTickeachTick9663565701927713696_38bf4259f235eb1a },
+    { 0xa960c00e36ad4a2f, true, (void*)&_FuncbuiltinTickeach_refTick16137060296763333387_c02a41a483b3f169, &__wrap__FuncbuiltinTickeach_refTick16137060296763333387_c02a41a483b3f169 },
+    { 0xf42460511829cd, false, (void*)&_Func_lambda_thismodule_80_10Tickfunction_3c937939c9fac98d, &__wrap__Func_lambda_thismodule_80_10Tickfunction_3c937939c9fac98d },
+    { 0x132ff59f955ebee8, false, (void*)&_Func_lambda_thismodule_80_10Tickfinalizer_305dc02b66553696, &__wrap__Func_lambda_thismodule_80_10Tickfinalizer_305dc02b66553696 },
+    { 0x3a547a1a3993df, false, (void*)&_FuncbuiltinTickemplaceTick13923705686753630697_908411b5f172f3d6, &__wrap__FuncbuiltinTickemplaceTick13923705686753630697_908411b5f172f3d6 },
+    { 0x54422b2788d4c66d, false, (void*)&_FuncTickverify_14Tick7691774253321735872_210d806253f397db, &__wrap__FuncTickverify_14Tick7691774253321735872_210d806253f397db },
+    { 0x2b340bd4e500ee95, false, (void*)&_Func_lambda_thismodule_114_11Tickfunction_6bd9593925568168, &__wrap__Func_lambda_thismodule_114_11Tickfunction_6bd9593925568168 },
+    { 0x1c0f1b70dfc8d771, false, (void*)&_Func_lambda_thismodule_114_11Tickfinalizer_a5b4847c5ce5a138, &__wrap__Func_lambda_thismodule_114_11Tickfinalizer_a5b4847c5ce5a138 },
+    { 0x17892cd516a9a747, false, (void*)&_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14, &__wrap__FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 },
+    { 0xd18bc47eae27eb9b, false, (void*)&_FuncfunctionalTickis_equalTick13663318146853733238_ab1cff754c041ab7, &__wrap__FuncfunctionalTickis_equalTick13663318146853733238_ab1cff754c041ab7 },
+    { 0x27112c30ffe3a52c, true, (void*)&_FuncbuiltinTickeachTick9663565701927713696_403560d62bbc8525, &__wrap__FuncbuiltinTickeachTick9663565701927713696_403560d62bbc8525 },
+    { 0x3e6612c35800baa2, false, (void*)&_Func_lambda_thismodule_264_12Tickfunction_54c8b26adfbe6824, &__wrap__Func_lambda_thismodule_264_12Tickfunction_54c8b26adfbe6824 },
+    { 0xf3e3a21bbf5a16e6, false, (void*)&_Func_lambda_thismodule_264_12Tickfinalizer_70bc360bf5cc37dc, &__wrap__Func_lambda_thismodule_264_12Tickfinalizer_70bc360bf5cc37dc },
+    { 0xe01178b0f8441e6f, false, (void*)&_Func_lambda_thismodule_267_13Tickfunction_2a097cd137ff1ae1, &__wrap__Func_lambda_thismodule_267_13Tickfunction_2a097cd137ff1ae1 },
+    { 0xd9d9469c8f541793, false, (void*)&_Func_lambda_thismodule_267_13Tickfinalizer_59ec7061b5053592, &__wrap__Func_lambda_thismodule_267_13Tickfinalizer_59ec7061b5053592 },
+    { 0x40a4cf3268c399b, false, (void*)&finalize_b86adca48494f93d, &__wrap_finalize_b86adca48494f93d },
+    { 0xe4df678fad0d7e70, false, (void*)&finalize_b0cb4b9f8708f3b3, &__wrap_finalize_b0cb4b9f8708f3b3 },
+    { 0x55ab9acb6c2a6d3b, false, (void*)&_Func_lambda_thismodule_265_3Tickfunction_2781a4c515b28b11, &__wrap__Func_lambda_thismodule_265_3Tickfunction_2781a4c515b28b11 },
+    { 0xd5dc8e8385c24581, false, (void*)&_Func_lambda_thismodule_265_3Tickfinalizer_bb465553714d8a66, &__wrap__Func_lambda_thismodule_265_3Tickfinalizer_bb465553714d8a66 },
+    { 0x9c7e3bf7d34311ab, false, (void*)&_Func_lambda_thismodule_74_4Tickfunction_a153f2b76711af8f, &__wrap__Func_lambda_thismodule_74_4Tickfunction_a153f2b76711af8f },
+    { 0x2b460274d361a4a0, false, (void*)&_Func_lambda_thismodule_74_4Tickfinalizer_afac0294c48ec518, &__wrap__Func_lambda_thismodule_74_4Tickfinalizer_afac0294c48ec518 },
+    { 0xbf77bb210b0552bc, false, (void*)&_FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39, &__wrap__FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 },
+    { 0x3a140473ff1ae701, false, (void*)&_FuncTickverify_evenTick16438837766850132515_8c37383502cdd9d4, &__wrap__FuncTickverify_evenTick16438837766850132515_8c37383502cdd9d4 },
+    { 0xec6b17677a268d9c, true, (void*)&_FuncfunctionalTickfilterTick2611906363669329552_b14e0f0747da1864, &__wrap__FuncfunctionalTickfilterTick2611906363669329552_b14e0f0747da1864 },
+    { 0xd779c35682df430, true, (void*)&_FuncfunctionalTickfilterTick17052258911568430960_c5b51d79366e68ab, &__wrap__FuncfunctionalTickfilterTick17052258911568430960_c5b51d79366e68ab },
+    { 0x49ed4d07b6f15052, true, (void*)&_FuncfunctionalTickmapTick1994230664415641751_9824beb79d88ab9b, &__wrap__FuncfunctionalTickmapTick1994230664415641751_9824beb79d88ab9b },
+    { 0x7f053340d52be7cd, true, (void*)&_FuncfunctionalTickmapTick3767370688684665805_f8ebf27fc6d50619, &__wrap__FuncfunctionalTickmapTick3767370688684665805_f8ebf27fc6d50619 },
+    { 0x457de8de62aa2659, false, (void*)&_FuncfunctionalTickreduceTick3841530652084879893_4e6a88b61e02101d, &__wrap__FuncfunctionalTickreduceTick3841530652084879893_4e6a88b61e02101d },
+    { 0xa9b502c01eae863d, false, (void*)&_Func_lambda_thismodule_130_5Tickfunction_3c6eacc4fad58ddb, &__wrap__Func_lambda_thismodule_130_5Tickfunction_3c6eacc4fad58ddb },
+    { 0x7faecfa59446baa8, false, (void*)&_Func_lambda_thismodule_130_5Tickfinalizer_83528de467f2bb86, &__wrap__Func_lambda_thismodule_130_5Tickfinalizer_83528de467f2bb86 },
+    { 0xc8c1050f3d5af2b7, false, (void*)&_FuncfunctionalTickreduceTick3815634954217254421_637b69df14cebf47, &__wrap__FuncfunctionalTickreduceTick3815634954217254421_637b69df14cebf47 },
+    { 0x29722dcae3fcda8b, false, (void*)&_FuncfunctionalTickreduceTick12199344316191013487_ce2eb4d61b1b6a52, &__wrap__FuncfunctionalTickreduceTick12199344316191013487_ce2eb4d61b1b6a52 },
+    { 0x29aac0430bb8c1ed, true, (void*)&_FuncfunctionalTickmapTick3767370688684665805_210e299a5936eafc, &__wrap__FuncfunctionalTickmapTick3767370688684665805_210e299a5936eafc },
+    { 0xc5ca68cb81d941d3, false, (void*)&_FuncfunctionalTicksumTick17873460401295886850_17c4e2f4f54c1187, &__wrap__FuncfunctionalTicksumTick17873460401295886850_17c4e2f4f54c1187 },
+    { 0xab42c1ca1f1d09ac, true, (void*)&_FuncfunctionalTickmapTick3767370688684665805_91ba24b601ec1f6a, &__wrap__FuncfunctionalTickmapTick3767370688684665805_91ba24b601ec1f6a },
+    { 0xbbf55ed47b6584c, true, (void*)&_FuncfunctionalTickcycleTick13989071893922639452_52c9b4b9346a07f9, &__wrap__FuncfunctionalTickcycleTick13989071893922639452_52c9b4b9346a07f9 },
+    { 0xb72ba2d91441a6c4, false, (void*)&_Func_lambda_thismodule_251_6Tickfunction_1f5cce243f6a7a42, &__wrap__Func_lambda_thismodule_251_6Tickfunction_1f5cce243f6a7a42 },
+    { 0x4f807645615c9eca, false, (void*)&_Func_lambda_thismodule_251_6Tickfinalizer_ed9e37bfaf4f898a, &__wrap__Func_lambda_thismodule_251_6Tickfinalizer_ed9e37bfaf4f898a },
+    { 0x8c1b06afd488876f, false, (void*)&_Func_lambda_thismodule_256_7Tickfunction_8da15827f11974f6, &__wrap__Func_lambda_thismodule_256_7Tickfunction_8da15827f11974f6 },
+    { 0xd17e43758e75028f, false, (void*)&_Func_lambda_thismodule_256_7Tickfinalizer_d2f7d1de26ba32e1, &__wrap__Func_lambda_thismodule_256_7Tickfinalizer_d2f7d1de26ba32e1 },
+    { 0x48b55e4147b98978, false, (void*)&_Func_lambda_thismodule_259_8Tickfunction_6259af6c65cab550, &__wrap__Func_lambda_thismodule_259_8Tickfunction_6259af6c65cab550 },
+    { 0x6620102c09d5d1c1, false, (void*)&_Func_lambda_thismodule_259_8Tickfinalizer_f9e9eb2f3c5501a9, &__wrap__Func_lambda_thismodule_259_8Tickfinalizer_f9e9eb2f3c5501a9 },
+    { 0x3d93761de955cad7, false, (void*)&_Func_lambda_thismodule_271_9Tickfunction_9db63ad06beaec8f, &__wrap__Func_lambda_thismodule_271_9Tickfunction_9db63ad06beaec8f },
+    { 0x7daf2d4afcae2e5b, false, (void*)&_Func_lambda_thismodule_271_9Tickfinalizer_366fe232fcac2a26, &__wrap__Func_lambda_thismodule_271_9Tickfinalizer_366fe232fcac2a26 },
+    { 0x5c51cb37e0913516, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115 },
+    { 0xf426d9532c77b0a4, true, (void*)&_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015, &__wrap__FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 },
+    { 0xcdc2a70f65bea834, false, (void*)&_Func_lambda_thismodule_109_1Tickfunction_cbda5cc99cf33214, &__wrap__Func_lambda_thismodule_109_1Tickfunction_cbda5cc99cf33214 },
+    { 0x7f95ccb6bcbdbb3f, false, (void*)&_Func_lambda_thismodule_109_1Tickfinalizer_a9193e773e020d98, &__wrap__Func_lambda_thismodule_109_1Tickfinalizer_a9193e773e020d98 },
+    { 0x7964cdf0a208493a, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b },
+    { 0x9ac3c6a0d4ae0c29, true, (void*)&_Func_lambda_thismodule_163_2Tickfunction_d1ac8639c9d7a0ca, &__wrap__Func_lambda_thismodule_163_2Tickfunction_d1ac8639c9d7a0ca },
+    { 0x66050a289da64ce4, false, (void*)&_Func_lambda_thismodule_163_2Tickfinalizer_e24e528e5a88c81, &__wrap__Func_lambda_thismodule_163_2Tickfinalizer_e24e528e5a88c81 },
+    { 0x6a151eb313bca15c, false, (void*)&_FuncfunctionalTickanyTick3153855942392455914_5e0e9c66abeffa8f, &__wrap__FuncfunctionalTickanyTick3153855942392455914_5e0e9c66abeffa8f },
+    { 0x926013299f917a93, true, (void*)&_FuncfunctionalTickisliceTick565469751076799399_266369a698f370fe, &__wrap__FuncfunctionalTickisliceTick565469751076799399_266369a698f370fe },
+    { 0xf3fefa0436374a12, true, (void*)&_FuncfunctionalTickrepeatTick5582964371469216548_dfc9e5bf3c1c1ae1, &__wrap__FuncfunctionalTickrepeatTick5582964371469216548_dfc9e5bf3c1c1ae1 },
+    { 0xac32d4ff2b4cd65, false, (void*)&is_even_28e79c60210e5b07, &__wrap_is_even_28e79c60210e5b07 },
+    { 0xb511e5b80ed0e57d, false, (void*)&twice_cddb661caae60bf4, &__wrap_twice_cddb661caae60bf4 },
+    { 0x51c69626d1f7cde0, false, (void*)&add_b9c39300f347f461, &__wrap_add_b9c39300f347f461 },
+    { 0xcd306d822d5df1a6, false, (void*)&_FuncExclEqu_fd3ae9a2691a110b, &__wrap__FuncExclEqu_fd3ae9a2691a110b },
+    { 0x1b9c317ae245d3ca, false, (void*)&_FuncExclEqu_f90153e54231f783, &__wrap__FuncExclEqu_f90153e54231f783 },
+    { 0x6dd07d220dc93308, false, (void*)&test_108d10aea454bc3b, &__wrap_test_108d10aea454bc3b },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_7038883937045263231
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
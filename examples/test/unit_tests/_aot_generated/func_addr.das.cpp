@@ -0,0 +1,132 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_3479418471966434347 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline int32_t add_b9c39300f347f461 ( Context * __context__, int32_t __a_rename_at_2_0, int32_t __b_rename_at_2_1 );
+inline bool test_285ad09134ce8b3d ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t add_b9c39300f347f461 ( Context * __context__, int32_t __a_rename_at_2_0, int32_t __b_rename_at_2_1 )
+{
+    return das_auto_cast<int32_t>::cast(__a_rename_at_2_0 + __b_rename_at_2_1);
+}
+
+inline bool test_285ad09134ce8b3d ( Context * __context__ )
+{
+    Func DAS_COMMENT((int32_t,int32_t,int32_t)) __fn_rename_at_8_2 = ((Func DAS_COMMENT((int32_t,int32_t,int32_t)))Func(__context__->fnByMangledName(/*add Ci Ci*/ 0x6608022ce4d2504e)));
+    int32_t __t_rename_at_9_3 = ((int32_t)das_invoke_function<int32_t>::invoke<int32_t,int32_t>(__context__,nullptr,__fn_rename_at_8_2,1,2));
+    DAS_ASSERT((__t_rename_at_9_3 == 3));
+    DAS_ASSERT((__fn_rename_at_8_2 != nullptr));
+    DAS_ASSERT((__fn_rename_at_8_2 == Func(__context__->fnByMangledName(/*add Ci Ci*/ 0x6608022ce4d2504e))));
+    DAS_ASSERT((!(__fn_rename_at_8_2 == nullptr)));
+    DAS_ASSERT((!(__fn_rename_at_8_2 != Func(__context__->fnByMangledName(/*add Ci Ci*/ 0x6608022ce4d2504e)))));
+    Func DAS_COMMENT((void)) __qq_rename_at_15_4;das_zero(__qq_rename_at_15_4);
+    DAS_ASSERT((__qq_rename_at_15_4 == nullptr));
+    bool __failed_rename_at_17_5 = false;
+    das_try_recover(__context__, [&]()
+    {
+        Func DAS_COMMENT((int32_t,int32_t,int32_t)) __fn2_rename_at_19_6;das_zero(__fn2_rename_at_19_6);
+        int32_t __t2_rename_at_20_7 = ((int32_t)das_invoke_function<int32_t>::invoke<int32_t,int32_t>(__context__,nullptr,__fn2_rename_at_19_6,1,2));
+    }, [&]()
+    {
+        das_copy(__failed_rename_at_17_5,true);
+    });
+    DAS_ASSERTF((__failed_rename_at_17_5),(((char *) "has to fail, invoking null function")));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_add_b9c39300f347f461 ( Context * __context__ ) {
+    int32_t arg_a = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_b = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t>::from(add_b9c39300f347f461(__context__, arg_a, arg_b));
+}
+static vec4f __wrap_test_285ad09134ce8b3d ( Context * __context__ ) {
+    return cast<bool>::from(test_285ad09134ce8b3d(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x51c69626d1f7cde0, false, (void*)&add_b9c39300f347f461, &__wrap_add_b9c39300f347f461 },
+    { 0xbd45732d7792774d, false, (void*)&test_285ad09134ce8b3d, &__wrap_test_285ad09134ce8b3d },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_3479418471966434347
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
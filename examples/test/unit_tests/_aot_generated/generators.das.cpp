@@ -0,0 +1,2026 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_9684368476840233687 {
+
+namespace  { struct _lambda_thismodule_18_1; };
+namespace  { struct _lambda_thismodule_35_2; };
+namespace  { struct _lambda_thismodule_53_3; };
+namespace  { struct _lambda_thismodule_72_4; };
+namespace  { struct _lambda_thismodule_114_5; };
+namespace  { struct _lambda_thismodule_125_6; };
+namespace  { struct _lambda_thismodule_139_7; };
+namespace  { struct _lambda_thismodule_154_8; };
+namespace  { struct _lambda_thismodule_169_9; };
+namespace  { struct _lambda_thismodule_182_10; };
+namespace  { struct _lambda_thismodule_192_11; };
+namespace  { struct _lambda_thismodule_205_12; };
+namespace  { struct _lambda_thismodule_218_13; };
+namespace  { struct _lambda_thismodule_230_14; };
+namespace  {
+
+struct _lambda_thismodule_18_1 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_18_1,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_18_1 *)) __finalize;
+    int32_t __yield;
+};
+static_assert(sizeof(_lambda_thismodule_18_1)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_1,__yield)==16,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_35_2 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_35_2,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_35_2 *)) __finalize;
+    int32_t __yield;
+    int32_t t;
+};
+static_assert(sizeof(_lambda_thismodule_35_2)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_35_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_35_2,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_35_2,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_35_2,t)==20,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_53_3 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_53_3,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_53_3 *)) __finalize;
+    int32_t __yield;
+    int32_t t;
+    int32_t * T;
+};
+static_assert(sizeof(_lambda_thismodule_53_3)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_53_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_53_3,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_53_3,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_53_3,t)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_53_3,T)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_72_4 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_72_4,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_72_4 *)) __finalize;
+    int32_t __yield;
+    int32_t t;
+};
+static_assert(sizeof(_lambda_thismodule_72_4)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_4,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_4,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_4,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_72_4,t)==20,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_114_5 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_114_5,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_114_5 *)) __finalize;
+    int32_t __yield;
+    int32_t t;
+};
+static_assert(sizeof(_lambda_thismodule_114_5)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_5,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_5,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_5,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_5,t)==20,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_125_6 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_125_6,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_125_6 *)) __finalize;
+    int32_t __yield;
+    int32_t t;
+};
+static_assert(sizeof(_lambda_thismodule_125_6)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_6,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_6,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_6,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_6,t)==20,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_139_7 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_139_7,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_139_7 *)) __finalize;
+    int32_t __yield;
+    int32_t t;
+};
+static_assert(sizeof(_lambda_thismodule_139_7)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_7,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_7,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_7,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_7,t)==20,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_154_8 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_154_8,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_154_8 *)) __finalize;
+    int32_t __yield;
+    int32_t q;
+    int32_t __t_rename_at_157_16;
+};
+static_assert(sizeof(_lambda_thismodule_154_8)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_154_8,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_154_8,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_154_8,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_154_8,q)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_154_8,__t_rename_at_157_16)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_169_9 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_169_9,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_169_9 *)) __finalize;
+    int32_t __yield;
+    int32_t t;
+};
+static_assert(sizeof(_lambda_thismodule_169_9)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_169_9,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_169_9,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_169_9,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_169_9,t)==20,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_182_10 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_182_10,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_182_10 *)) __finalize;
+    int32_t __yield;
+    bool _loop_at_183_8;
+    int32_t __t_rename_at_183_13;
+    void * _pvar_0_at_183_8;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_183_8;
+};
+static_assert(sizeof(_lambda_thismodule_182_10)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_182_10,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_182_10,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_182_10,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_182_10,_loop_at_183_8)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_182_10,__t_rename_at_183_13)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_182_10,_pvar_0_at_183_8)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_182_10,_source_0_at_183_8)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_192_11 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_192_11,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_192_11 *)) __finalize;
+    int32_t __yield;
+    bool _loop_at_193_8;
+    int32_t __t_rename_at_193_13;
+    void * _pvar_0_at_193_8;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_193_8;
+};
+static_assert(sizeof(_lambda_thismodule_192_11)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_192_11,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_192_11,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_192_11,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_192_11,_loop_at_193_8)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_192_11,__t_rename_at_193_13)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_192_11,_pvar_0_at_193_8)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_192_11,_source_0_at_193_8)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_205_12 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_205_12,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_205_12 *)) __finalize;
+    int32_t __yield;
+    bool _loop_at_206_8;
+    int32_t __t_rename_at_206_13;
+    void * _pvar_0_at_206_8;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_206_8;
+};
+static_assert(sizeof(_lambda_thismodule_205_12)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_205_12,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_205_12,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_205_12,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_205_12,_loop_at_206_8)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_205_12,__t_rename_at_206_13)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_205_12,_pvar_0_at_206_8)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_205_12,_source_0_at_206_8)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_218_13 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_218_13,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_218_13 *)) __finalize;
+    int32_t __yield;
+    bool _loop_at_219_8;
+    int32_t __q_rename_at_219_13;
+    void * _pvar_0_at_219_8;
+    bool ___loop_at_220_12_rename_at_220_12;
+    int32_t __t_rename_at_220_17;
+    void * ___pvar_0_at_220_12_rename_at_220_12;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_219_8;
+    Sequence DAS_COMMENT((int32_t)) ___source_0_at_220_12_rename_at_220_12;
+};
+static_assert(sizeof(_lambda_thismodule_218_13)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_218_13,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_218_13,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_218_13,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_218_13,_loop_at_219_8)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_218_13,__q_rename_at_219_13)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_218_13,_pvar_0_at_219_8)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_218_13,___loop_at_220_12_rename_at_220_12)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_218_13,__t_rename_at_220_17)==44,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_218_13,___pvar_0_at_220_12_rename_at_220_12)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_218_13,_source_0_at_219_8)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_218_13,___source_0_at_220_12_rename_at_220_12)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_230_14 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_230_14,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_230_14 *)) __finalize;
+    int32_t __yield;
+    bool _loop_at_231_8;
+    int32_t __t_rename_at_231_13;
+    void * _pvar_0_at_231_8;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_231_8;
+};
+static_assert(sizeof(_lambda_thismodule_230_14)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_230_14,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_230_14,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_230_14,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_230_14,_loop_at_231_8)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_230_14,__t_rename_at_231_13)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_230_14,_pvar_0_at_231_8)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_230_14,_source_0_at_231_8)==40,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__972a1aa531f8f097;
+extern StructInfo __struct_info__9a961aa534e92ec0;
+extern StructInfo __struct_info__8c975aa528b0d5a9;
+extern StructInfo __struct_info__97181aa531e5e73b;
+extern StructInfo __struct_info__8ca11aa528ca1064;
+extern StructInfo __struct_info__be935cd1367a3e62;
+extern StructInfo __struct_info__cc5e04a6388697c4;
+extern StructInfo __struct_info__217844d18cf3ee5a;
+extern StructInfo __struct_info__8c9999e265cc7754;
+extern StructInfo __struct_info__c60fe1ac050b3bac;
+extern StructInfo __struct_info__4dc99ad45648c3c7;
+extern StructInfo __struct_info__ef03f59b1975595c;
+extern StructInfo __struct_info__c4dc86916c23516d;
+extern StructInfo __struct_info__c13205870604b511;
+extern TypeInfo __type_info__af8a9b4c8643c319;
+extern TypeInfo __type_info__4ef4b7b45798160c;
+extern TypeInfo __type_info__ecb9aeab21c6546f;
+extern TypeInfo __type_info__c749157bd33e62e;
+extern TypeInfo __type_info__df63f7a2a2c81210;
+extern TypeInfo __type_info__15bd917ba5189633;
+extern TypeInfo __type_info__bd1168e97eacde64;
+extern TypeInfo __type_info__ee960cf060176d5e;
+extern TypeInfo __type_info__44eee8ddab2ba33c;
+extern TypeInfo __type_info__25fbf3149da3026e;
+extern TypeInfo __type_info__d5a1095154ebdd26;
+extern TypeInfo __type_info__e8124d558f33cf6b;
+extern TypeInfo __type_info__df4e086122629f16;
+extern TypeInfo __type_info__ff14275eb7db0999;
+extern TypeInfo __type_info__35b6e344a3fdc46d;
+extern TypeInfo __type_info__af81fe4c86352052;
+extern TypeInfo __type_info__3ef37aae0e6ae1aa;
+extern TypeInfo __type_info__878125b1c81bc43b;
+extern TypeInfo __type_info__86b04c77b26e2dc0;
+extern TypeInfo __type_info__2883d6ae052ac7fe;
+extern TypeInfo __type_info__7d568177b6c0b8cf;
+extern TypeInfo __type_info__9bb78d8ffcbfe833;
+extern TypeInfo __type_info__4e6b15c42cd69a9f;
+extern TypeInfo __type_info__a618c59002d6765b;
+extern TypeInfo __type_info__c4ab4e8d8cd04631;
+extern TypeInfo __type_info__a6a566ce67dc55f9;
+extern TypeInfo __type_info__2c234da62187aebe;
+extern TypeInfo __type_info__711790b90dcab263;
+extern TypeInfo __type_info__ef8e17d6159e86d2;
+extern TypeInfo __type_info__78bc94cdda7ba862;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+TypeInfo * __type_info__35128185f3bc54f1_arg_types_var_10892547945559290007[2] = { &__type_info__3ef37aae0e6ae1aa, &__type_info__af8a9b4c8643c319 };
+const char * __type_info__35128185f3bc54f1_arg_names_var_10892547945559290007[2] = { "__this", "_yield_114" };
+VarInfo __struct_info__972a1aa531f8f097_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__35128185f3bc54f1_arg_types_var_10892547945559290007, __type_info__35128185f3bc54f1_arg_names_var_10892547945559290007, 2, 0, nullptr, 12, 8, UINT64_C(0x35128185f3bc54f1), "__lambda", 0, 0 };
+TypeInfo * __type_info__9b656df695971ae5_arg_types_var_10892547945559290007[1] = { &__type_info__4ef4b7b45798160c };
+const char * __type_info__9b656df695971ae5_arg_names_var_10892547945559290007[1] = { "__this" };
+VarInfo __struct_info__972a1aa531f8f097_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__9b656df695971ae5_arg_types_var_10892547945559290007, __type_info__9b656df695971ae5_arg_names_var_10892547945559290007, 1, 0, nullptr, 12, 8, UINT64_C(0x9b656df695971ae5), "__finalize", 8, 0 };
+VarInfo __struct_info__972a1aa531f8f097_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x50ff46c0f62f9b98), "__yield", 16, 0 };
+VarInfo __struct_info__972a1aa531f8f097_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x9d57e401548c7cd8), "t", 20, 0 };
+VarInfo * __struct_info__972a1aa531f8f097_fields[4] =  { &__struct_info__972a1aa531f8f097_field_0, &__struct_info__972a1aa531f8f097_field_1, &__struct_info__972a1aa531f8f097_field_2, &__struct_info__972a1aa531f8f097_field_3 };
+StructInfo __struct_info__972a1aa531f8f097 = {"_lambda_thismodule_114_5", "", 14, __struct_info__972a1aa531f8f097_fields, 4, 24, UINT64_C(0x0), nullptr, UINT64_C(0x972a1aa531f8f097), 4 };
+TypeInfo * __type_info__1e6479913fd74d46_arg_types_var_11139120025207123648[2] = { &__type_info__878125b1c81bc43b, &__type_info__af8a9b4c8643c319 };
+const char * __type_info__1e6479913fd74d46_arg_names_var_11139120025207123648[2] = { "__this", "_yield_125" };
+VarInfo __struct_info__9a961aa534e92ec0_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__1e6479913fd74d46_arg_types_var_11139120025207123648, __type_info__1e6479913fd74d46_arg_names_var_11139120025207123648, 2, 0, nullptr, 12, 8, UINT64_C(0x1e6479913fd74d46), "__lambda", 0, 0 };
+TypeInfo * __type_info__8a7b5cdd801ed6d0_arg_types_var_11139120025207123648[1] = { &__type_info__ecb9aeab21c6546f };
+VarInfo __struct_info__9a961aa534e92ec0_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__8a7b5cdd801ed6d0_arg_types_var_11139120025207123648, __type_info__9b656df695971ae5_arg_names_var_10892547945559290007, 1, 0, nullptr, 12, 8, UINT64_C(0x8a7b5cdd801ed6d0), "__finalize", 8, 0 };
+VarInfo __struct_info__9a961aa534e92ec0_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x33648a0aa41452e5), "__yield", 16, 0 };
+VarInfo __struct_info__9a961aa534e92ec0_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xa01fe8bd337705f), "t", 20, 0 };
+VarInfo * __struct_info__9a961aa534e92ec0_fields[4] =  { &__struct_info__9a961aa534e92ec0_field_0, &__struct_info__9a961aa534e92ec0_field_1, &__struct_info__9a961aa534e92ec0_field_2, &__struct_info__9a961aa534e92ec0_field_3 };
+StructInfo __struct_info__9a961aa534e92ec0 = {"_lambda_thismodule_125_6", "", 14, __struct_info__9a961aa534e92ec0_fields, 4, 24, UINT64_C(0x0), nullptr, UINT64_C(0x9a961aa534e92ec0), 4 };
+TypeInfo * __type_info__c89f947f99fbaf6b_arg_types_var_10130665552192001449[2] = { &__type_info__86b04c77b26e2dc0, &__type_info__af8a9b4c8643c319 };
+const char * __type_info__c89f947f99fbaf6b_arg_names_var_10130665552192001449[2] = { "__this", "_yield_139" };
+VarInfo __struct_info__8c975aa528b0d5a9_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__c89f947f99fbaf6b_arg_types_var_10130665552192001449, __type_info__c89f947f99fbaf6b_arg_names_var_10130665552192001449, 2, 0, nullptr, 12, 8, UINT64_C(0xc89f947f99fbaf6b), "__lambda", 0, 0 };
+TypeInfo * __type_info__78cc3c598a3ed6cf_arg_types_var_10130665552192001449[1] = { &__type_info__c749157bd33e62e };
+VarInfo __struct_info__8c975aa528b0d5a9_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__78cc3c598a3ed6cf_arg_types_var_10130665552192001449, __type_info__9b656df695971ae5_arg_names_var_10892547945559290007, 1, 0, nullptr, 12, 8, UINT64_C(0x78cc3c598a3ed6cf), "__finalize", 8, 0 };
+VarInfo __struct_info__8c975aa528b0d5a9_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xf0b98daaa8eb7c8a), "__yield", 16, 0 };
+VarInfo __struct_info__8c975aa528b0d5a9_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xf761598040497a1a), "t", 20, 0 };
+VarInfo * __struct_info__8c975aa528b0d5a9_fields[4] =  { &__struct_info__8c975aa528b0d5a9_field_0, &__struct_info__8c975aa528b0d5a9_field_1, &__struct_info__8c975aa528b0d5a9_field_2, &__struct_info__8c975aa528b0d5a9_field_3 };
+StructInfo __struct_info__8c975aa528b0d5a9 = {"_lambda_thismodule_139_7", "", 14, __struct_info__8c975aa528b0d5a9_fields, 4, 24, UINT64_C(0x0), nullptr, UINT64_C(0x8c975aa528b0d5a9), 4 };
+TypeInfo * __type_info__dde38c7c54c60015_arg_types_var_10887481395977250619[2] = { &__type_info__2883d6ae052ac7fe, &__type_info__af8a9b4c8643c319 };
+const char * __type_info__dde38c7c54c60015_arg_names_var_10887481395977250619[2] = { "__this", "_yield_154" };
+VarInfo __struct_info__97181aa531e5e73b_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__dde38c7c54c60015_arg_types_var_10887481395977250619, __type_info__dde38c7c54c60015_arg_names_var_10887481395977250619, 2, 0, nullptr, 12, 8, UINT64_C(0xdde38c7c54c60015), "__lambda", 0, 0 };
+TypeInfo * __type_info__176ba618f442f0f9_arg_types_var_10887481395977250619[1] = { &__type_info__df63f7a2a2c81210 };
+VarInfo __struct_info__97181aa531e5e73b_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__176ba618f442f0f9_arg_types_var_10887481395977250619, __type_info__9b656df695971ae5_arg_names_var_10892547945559290007, 1, 0, nullptr, 12, 8, UINT64_C(0x176ba618f442f0f9), "__finalize", 8, 0 };
+VarInfo __struct_info__97181aa531e5e73b_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xc9c42ec0ef4518cc), "__yield", 16, 0 };
+VarInfo __struct_info__97181aa531e5e73b_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x5262062f4ed453f4), "q", 20, 0 };
+VarInfo __struct_info__97181aa531e5e73b_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xd8b005aa8a15841b), "__t_rename_at_157_16", 24, 0 };
+VarInfo * __struct_info__97181aa531e5e73b_fields[5] =  { &__struct_info__97181aa531e5e73b_field_0, &__struct_info__97181aa531e5e73b_field_1, &__struct_info__97181aa531e5e73b_field_2, &__struct_info__97181aa531e5e73b_field_3, &__struct_info__97181aa531e5e73b_field_4 };
+StructInfo __struct_info__97181aa531e5e73b = {"_lambda_thismodule_154_8", "", 14, __struct_info__97181aa531e5e73b_fields, 5, 32, UINT64_C(0x0), nullptr, UINT64_C(0x97181aa531e5e73b), 5 };
+TypeInfo * __type_info__c474f766805a961a_arg_types_var_10133409933216583780[2] = { &__type_info__7d568177b6c0b8cf, &__type_info__af8a9b4c8643c319 };
+const char * __type_info__c474f766805a961a_arg_names_var_10133409933216583780[2] = { "__this", "_yield_169" };
+VarInfo __struct_info__8ca11aa528ca1064_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__c474f766805a961a_arg_types_var_10133409933216583780, __type_info__c474f766805a961a_arg_names_var_10133409933216583780, 2, 0, nullptr, 12, 8, UINT64_C(0xc474f766805a961a), "__lambda", 0, 0 };
+TypeInfo * __type_info__ccc7cccc591d1d94_arg_types_var_10133409933216583780[1] = { &__type_info__15bd917ba5189633 };
+VarInfo __struct_info__8ca11aa528ca1064_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__ccc7cccc591d1d94_arg_types_var_10133409933216583780, __type_info__9b656df695971ae5_arg_names_var_10892547945559290007, 1, 0, nullptr, 12, 8, UINT64_C(0xccc7cccc591d1d94), "__finalize", 8, 0 };
+VarInfo __struct_info__8ca11aa528ca1064_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x8e34f3338bcf5a99), "__yield", 16, 0 };
+VarInfo __struct_info__8ca11aa528ca1064_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x843e52589c05120b), "t", 20, 0 };
+VarInfo * __struct_info__8ca11aa528ca1064_fields[4] =  { &__struct_info__8ca11aa528ca1064_field_0, &__struct_info__8ca11aa528ca1064_field_1, &__struct_info__8ca11aa528ca1064_field_2, &__struct_info__8ca11aa528ca1064_field_3 };
+StructInfo __struct_info__8ca11aa528ca1064 = {"_lambda_thismodule_169_9", "", 14, __struct_info__8ca11aa528ca1064_fields, 4, 24, UINT64_C(0x0), nullptr, UINT64_C(0x8ca11aa528ca1064), 4 };
+TypeInfo * __type_info__b488e246115a3b97_arg_types_var_13732421742414675554[2] = { &__type_info__9bb78d8ffcbfe833, &__type_info__af8a9b4c8643c319 };
+const char * __type_info__b488e246115a3b97_arg_names_var_13732421742414675554[2] = { "__this", "_yield_182" };
+VarInfo __struct_info__be935cd1367a3e62_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__b488e246115a3b97_arg_types_var_13732421742414675554, __type_info__b488e246115a3b97_arg_names_var_13732421742414675554, 2, 0, nullptr, 12, 8, UINT64_C(0xb488e246115a3b97), "__lambda", 0, 0 };
+TypeInfo * __type_info__e0b88340ddc33bf8_arg_types_var_13732421742414675554[1] = { &__type_info__bd1168e97eacde64 };
+VarInfo __struct_info__be935cd1367a3e62_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__e0b88340ddc33bf8_arg_types_var_13732421742414675554, __type_info__9b656df695971ae5_arg_names_var_10892547945559290007, 1, 0, nullptr, 12, 8, UINT64_C(0xe0b88340ddc33bf8), "__finalize", 8, 0 };
+VarInfo __struct_info__be935cd1367a3e62_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xedc65d1f0f451b14), "__yield", 16, 0 };
+VarInfo __struct_info__be935cd1367a3e62_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xd9470cdc8bc5a090), "_loop_at_183_8", 20, 0 };
+VarInfo __struct_info__be935cd1367a3e62_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x7140a33159136475), "__t_rename_at_183_13", 24, 0 };
+VarInfo __struct_info__be935cd1367a3e62_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x32ff5c1b44431ef3), "_pvar_0_at_183_8", 32, 6 };
+VarInfo __struct_info__be935cd1367a3e62_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xfcbf0951b4ea57ef), "_source_0_at_183_8", 40, 7 };
+VarInfo * __struct_info__be935cd1367a3e62_fields[7] =  { &__struct_info__be935cd1367a3e62_field_0, &__struct_info__be935cd1367a3e62_field_1, &__struct_info__be935cd1367a3e62_field_2, &__struct_info__be935cd1367a3e62_field_3, &__struct_info__be935cd1367a3e62_field_4, &__struct_info__be935cd1367a3e62_field_5, &__struct_info__be935cd1367a3e62_field_6 };
+StructInfo __struct_info__be935cd1367a3e62 = {"_lambda_thismodule_182_10", "", 14, __struct_info__be935cd1367a3e62_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0xbe935cd1367a3e62), 5 };
+TypeInfo * __type_info__f8e3b5594410f795_arg_types_var_14726212943507527620[2] = { &__type_info__4e6b15c42cd69a9f, &__type_info__af8a9b4c8643c319 };
+const char * __type_info__f8e3b5594410f795_arg_names_var_14726212943507527620[2] = { "__this", "_yield_18" };
+VarInfo __struct_info__cc5e04a6388697c4_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__f8e3b5594410f795_arg_types_var_14726212943507527620, __type_info__f8e3b5594410f795_arg_names_var_14726212943507527620, 2, 0, nullptr, 12, 8, UINT64_C(0xf8e3b5594410f795), "__lambda", 0, 0 };
+TypeInfo * __type_info__ce27767641ed73ee_arg_types_var_14726212943507527620[1] = { &__type_info__ee960cf060176d5e };
+VarInfo __struct_info__cc5e04a6388697c4_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__ce27767641ed73ee_arg_types_var_14726212943507527620, __type_info__9b656df695971ae5_arg_names_var_10892547945559290007, 1, 0, nullptr, 12, 8, UINT64_C(0xce27767641ed73ee), "__finalize", 8, 0 };
+VarInfo __struct_info__cc5e04a6388697c4_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xfd48c88027892d82), "__yield", 16, 0 };
+VarInfo * __struct_info__cc5e04a6388697c4_fields[3] =  { &__struct_info__cc5e04a6388697c4_field_0, &__struct_info__cc5e04a6388697c4_field_1, &__struct_info__cc5e04a6388697c4_field_2 };
+StructInfo __struct_info__cc5e04a6388697c4 = {"_lambda_thismodule_18_1", "", 14, __struct_info__cc5e04a6388697c4_fields, 3, 24, UINT64_C(0x0), nullptr, UINT64_C(0xcc5e04a6388697c4), 3 };
+TypeInfo * __type_info__5e0a3aee28710d0f_arg_types_var_2411753267260550746[2] = { &__type_info__a618c59002d6765b, &__type_info__af8a9b4c8643c319 };
+const char * __type_info__5e0a3aee28710d0f_arg_names_var_2411753267260550746[2] = { "__this", "_yield_192" };
+VarInfo __struct_info__217844d18cf3ee5a_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__5e0a3aee28710d0f_arg_types_var_2411753267260550746, __type_info__5e0a3aee28710d0f_arg_names_var_2411753267260550746, 2, 0, nullptr, 12, 8, UINT64_C(0x5e0a3aee28710d0f), "__lambda", 0, 0 };
+TypeInfo * __type_info__a1d37449ad653f50_arg_types_var_2411753267260550746[1] = { &__type_info__44eee8ddab2ba33c };
+VarInfo __struct_info__217844d18cf3ee5a_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__a1d37449ad653f50_arg_types_var_2411753267260550746, __type_info__9b656df695971ae5_arg_names_var_10892547945559290007, 1, 0, nullptr, 12, 8, UINT64_C(0xa1d37449ad653f50), "__finalize", 8, 0 };
+VarInfo __struct_info__217844d18cf3ee5a_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xb2f89614636b717c), "__yield", 16, 0 };
+VarInfo __struct_info__217844d18cf3ee5a_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xeef174f505a1eb61), "_loop_at_193_8", 20, 0 };
+VarInfo __struct_info__217844d18cf3ee5a_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x1845d8ca1690b1dd), "__t_rename_at_193_13", 24, 0 };
+VarInfo __struct_info__217844d18cf3ee5a_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xc0a77cc78736c8d2), "_pvar_0_at_193_8", 32, 6 };
+VarInfo __struct_info__217844d18cf3ee5a_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xe3c4b9bc8e14970e), "_source_0_at_193_8", 40, 7 };
+VarInfo * __struct_info__217844d18cf3ee5a_fields[7] =  { &__struct_info__217844d18cf3ee5a_field_0, &__struct_info__217844d18cf3ee5a_field_1, &__struct_info__217844d18cf3ee5a_field_2, &__struct_info__217844d18cf3ee5a_field_3, &__struct_info__217844d18cf3ee5a_field_4, &__struct_info__217844d18cf3ee5a_field_5, &__struct_info__217844d18cf3ee5a_field_6 };
+StructInfo __struct_info__217844d18cf3ee5a = {"_lambda_thismodule_192_11", "", 14, __struct_info__217844d18cf3ee5a_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0x217844d18cf3ee5a), 5 };
+TypeInfo * __type_info__bacb9ee83b7342e5_arg_types_var_10131298034396198740[2] = { &__type_info__c4ab4e8d8cd04631, &__type_info__af8a9b4c8643c319 };
+const char * __type_info__bacb9ee83b7342e5_arg_names_var_10131298034396198740[2] = { "__this", "_yield_205" };
+VarInfo __struct_info__8c9999e265cc7754_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__bacb9ee83b7342e5_arg_types_var_10131298034396198740, __type_info__bacb9ee83b7342e5_arg_names_var_10131298034396198740, 2, 0, nullptr, 12, 8, UINT64_C(0xbacb9ee83b7342e5), "__lambda", 0, 0 };
+TypeInfo * __type_info__c39c093f57d331be_arg_types_var_10131298034396198740[1] = { &__type_info__25fbf3149da3026e };
+VarInfo __struct_info__8c9999e265cc7754_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__c39c093f57d331be_arg_types_var_10131298034396198740, __type_info__9b656df695971ae5_arg_names_var_10892547945559290007, 1, 0, nullptr, 12, 8, UINT64_C(0xc39c093f57d331be), "__finalize", 8, 0 };
+VarInfo __struct_info__8c9999e265cc7754_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x4f2d920f0dd3c572), "__yield", 16, 0 };
+VarInfo __struct_info__8c9999e265cc7754_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xb4fcdb80835f8f46), "_loop_at_206_8", 20, 0 };
+VarInfo __struct_info__8c9999e265cc7754_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x3c48fba5fa3c7fcb), "__t_rename_at_206_13", 24, 0 };
+VarInfo __struct_info__8c9999e265cc7754_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xe8c0ae33fc903be1), "_pvar_0_at_206_8", 32, 6 };
+VarInfo __struct_info__8c9999e265cc7754_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xd6e992512f6700c9), "_source_0_at_206_8", 40, 7 };
+VarInfo * __struct_info__8c9999e265cc7754_fields[7] =  { &__struct_info__8c9999e265cc7754_field_0, &__struct_info__8c9999e265cc7754_field_1, &__struct_info__8c9999e265cc7754_field_2, &__struct_info__8c9999e265cc7754_field_3, &__struct_info__8c9999e265cc7754_field_4, &__struct_info__8c9999e265cc7754_field_5, &__struct_info__8c9999e265cc7754_field_6 };
+StructInfo __struct_info__8c9999e265cc7754 = {"_lambda_thismodule_205_12", "", 14, __struct_info__8c9999e265cc7754_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0x8c9999e265cc7754), 5 };
+TypeInfo * __type_info__c3ca35cc349f891d_arg_types_var_14271873873095637932[2] = { &__type_info__a6a566ce67dc55f9, &__type_info__af8a9b4c8643c319 };
+const char * __type_info__c3ca35cc349f891d_arg_names_var_14271873873095637932[2] = { "__this", "_yield_218" };
+VarInfo __struct_info__c60fe1ac050b3bac_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__c3ca35cc349f891d_arg_types_var_14271873873095637932, __type_info__c3ca35cc349f891d_arg_names_var_14271873873095637932, 2, 0, nullptr, 12, 8, UINT64_C(0xc3ca35cc349f891d), "__lambda", 0, 0 };
+TypeInfo * __type_info__ae2dce5655a15c96_arg_types_var_14271873873095637932[1] = { &__type_info__d5a1095154ebdd26 };
+VarInfo __struct_info__c60fe1ac050b3bac_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__ae2dce5655a15c96_arg_types_var_14271873873095637932, __type_info__9b656df695971ae5_arg_names_var_10892547945559290007, 1, 0, nullptr, 12, 8, UINT64_C(0xae2dce5655a15c96), "__finalize", 8, 0 };
+VarInfo __struct_info__c60fe1ac050b3bac_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xe19968a52e6d87ba), "__yield", 16, 0 };
+VarInfo __struct_info__c60fe1ac050b3bac_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x6543a0f36477f807), "_loop_at_219_8", 20, 0 };
+VarInfo __struct_info__c60fe1ac050b3bac_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x7683a10d930b953f), "__q_rename_at_219_13", 24, 0 };
+VarInfo __struct_info__c60fe1ac050b3bac_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xd1b4ead18d47fb50), "_pvar_0_at_219_8", 32, 8 };
+VarInfo __struct_info__c60fe1ac050b3bac_field_6 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xed4dcae38026c944), "___loop_at_220_12_rename_at_220_12", 40, 0 };
+VarInfo __struct_info__c60fe1ac050b3bac_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x523a21cb7763eb69), "__t_rename_at_220_17", 44, 0 };
+VarInfo __struct_info__c60fe1ac050b3bac_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x88250bfc0988347), "___pvar_0_at_220_12_rename_at_220_12", 48, 9 };
+VarInfo __struct_info__c60fe1ac050b3bac_field_9 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x3605b1a2d33c45d8), "_source_0_at_219_8", 56, 10 };
+VarInfo __struct_info__c60fe1ac050b3bac_field_10 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x95993ebb9f7f4a09), "___source_0_at_220_12_rename_at_220_12", 64, 11 };
+VarInfo * __struct_info__c60fe1ac050b3bac_fields[11] =  { &__struct_info__c60fe1ac050b3bac_field_0, &__struct_info__c60fe1ac050b3bac_field_1, &__struct_info__c60fe1ac050b3bac_field_2, &__struct_info__c60fe1ac050b3bac_field_3, &__struct_info__c60fe1ac050b3bac_field_4, &__struct_info__c60fe1ac050b3bac_field_5, &__struct_info__c60fe1ac050b3bac_field_6, &__struct_info__c60fe1ac050b3bac_field_7, &__struct_info__c60fe1ac050b3bac_field_8, &__struct_info__c60fe1ac050b3bac_field_9, &__struct_info__c60fe1ac050b3bac_field_10 };
+StructInfo __struct_info__c60fe1ac050b3bac = {"_lambda_thismodule_218_13", "", 14, __struct_info__c60fe1ac050b3bac_fields, 11, 72, UINT64_C(0x0), nullptr, UINT64_C(0xc60fe1ac050b3bac), 5 };
+TypeInfo * __type_info__6aa6bc7394e1d7a0_arg_types_var_5605181448010646471[2] = { &__type_info__2c234da62187aebe, &__type_info__af8a9b4c8643c319 };
+const char * __type_info__6aa6bc7394e1d7a0_arg_names_var_5605181448010646471[2] = { "__this", "_yield_230" };
+VarInfo __struct_info__4dc99ad45648c3c7_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__6aa6bc7394e1d7a0_arg_types_var_5605181448010646471, __type_info__6aa6bc7394e1d7a0_arg_names_var_5605181448010646471, 2, 0, nullptr, 12, 8, UINT64_C(0x6aa6bc7394e1d7a0), "__lambda", 0, 0 };
+TypeInfo * __type_info__708f4d96a43f7821_arg_types_var_5605181448010646471[1] = { &__type_info__e8124d558f33cf6b };
+VarInfo __struct_info__4dc99ad45648c3c7_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__708f4d96a43f7821_arg_types_var_5605181448010646471, __type_info__9b656df695971ae5_arg_names_var_10892547945559290007, 1, 0, nullptr, 12, 8, UINT64_C(0x708f4d96a43f7821), "__finalize", 8, 0 };
+VarInfo __struct_info__4dc99ad45648c3c7_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x70ccd94cba938ffb), "__yield", 16, 0 };
+VarInfo __struct_info__4dc99ad45648c3c7_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x6c7201f463ecb566), "_loop_at_231_8", 20, 0 };
+VarInfo __struct_info__4dc99ad45648c3c7_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x67c1fd834339cc4d), "__t_rename_at_231_13", 24, 0 };
+VarInfo __struct_info__4dc99ad45648c3c7_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x165a67d2ccd40857), "_pvar_0_at_231_8", 32, 6 };
+VarInfo __struct_info__4dc99ad45648c3c7_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x4a2d245e47471c35), "_source_0_at_231_8", 40, 7 };
+VarInfo * __struct_info__4dc99ad45648c3c7_fields[7] =  { &__struct_info__4dc99ad45648c3c7_field_0, &__struct_info__4dc99ad45648c3c7_field_1, &__struct_info__4dc99ad45648c3c7_field_2, &__struct_info__4dc99ad45648c3c7_field_3, &__struct_info__4dc99ad45648c3c7_field_4, &__struct_info__4dc99ad45648c3c7_field_5, &__struct_info__4dc99ad45648c3c7_field_6 };
+StructInfo __struct_info__4dc99ad45648c3c7 = {"_lambda_thismodule_230_14", "", 14, __struct_info__4dc99ad45648c3c7_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0x4dc99ad45648c3c7), 5 };
+TypeInfo * __type_info__9e9c00871c5cba4d_arg_types_var_17222879446490765660[2] = { &__type_info__711790b90dcab263, &__type_info__af8a9b4c8643c319 };
+const char * __type_info__9e9c00871c5cba4d_arg_names_var_17222879446490765660[2] = { "__this", "_yield_35" };
+VarInfo __struct_info__ef03f59b1975595c_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__9e9c00871c5cba4d_arg_types_var_17222879446490765660, __type_info__9e9c00871c5cba4d_arg_names_var_17222879446490765660, 2, 0, nullptr, 12, 8, UINT64_C(0x9e9c00871c5cba4d), "__lambda", 0, 0 };
+TypeInfo * __type_info__10885e0c7170e986_arg_types_var_17222879446490765660[1] = { &__type_info__df4e086122629f16 };
+VarInfo __struct_info__ef03f59b1975595c_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__10885e0c7170e986_arg_types_var_17222879446490765660, __type_info__9b656df695971ae5_arg_names_var_10892547945559290007, 1, 0, nullptr, 12, 8, UINT64_C(0x10885e0c7170e986), "__finalize", 8, 0 };
+VarInfo __struct_info__ef03f59b1975595c_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xedf0d3ae8dc8530a), "__yield", 16, 0 };
+VarInfo __struct_info__ef03f59b1975595c_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x94e9b0ade15eb001), "t", 20, 0 };
+VarInfo * __struct_info__ef03f59b1975595c_fields[4] =  { &__struct_info__ef03f59b1975595c_field_0, &__struct_info__ef03f59b1975595c_field_1, &__struct_info__ef03f59b1975595c_field_2, &__struct_info__ef03f59b1975595c_field_3 };
+StructInfo __struct_info__ef03f59b1975595c = {"_lambda_thismodule_35_2", "", 14, __struct_info__ef03f59b1975595c_fields, 4, 24, UINT64_C(0x0), nullptr, UINT64_C(0xef03f59b1975595c), 4 };
+TypeInfo * __type_info__5dcbe51b54dc9e92_arg_types_var_14185360885452853613[2] = { &__type_info__ef8e17d6159e86d2, &__type_info__af8a9b4c8643c319 };
+const char * __type_info__5dcbe51b54dc9e92_arg_names_var_14185360885452853613[2] = { "__this", "_yield_53" };
+VarInfo __struct_info__c4dc86916c23516d_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__5dcbe51b54dc9e92_arg_types_var_14185360885452853613, __type_info__5dcbe51b54dc9e92_arg_names_var_14185360885452853613, 2, 0, nullptr, 12, 8, UINT64_C(0x5dcbe51b54dc9e92), "__lambda", 0, 0 };
+TypeInfo * __type_info__fa7c30ec6cd70103_arg_types_var_14185360885452853613[1] = { &__type_info__ff14275eb7db0999 };
+VarInfo __struct_info__c4dc86916c23516d_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__fa7c30ec6cd70103_arg_types_var_14185360885452853613, __type_info__9b656df695971ae5_arg_names_var_10892547945559290007, 1, 0, nullptr, 12, 8, UINT64_C(0xfa7c30ec6cd70103), "__finalize", 8, 0 };
+VarInfo __struct_info__c4dc86916c23516d_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x5b2cf242722854b5), "__yield", 16, 0 };
+VarInfo __struct_info__c4dc86916c23516d_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xf710343974fc3534), "t", 20, 0 };
+VarInfo __struct_info__c4dc86916c23516d_field_4 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xf710143974fbfed4), "T", 24, 5 };
+VarInfo * __struct_info__c4dc86916c23516d_fields[5] =  { &__struct_info__c4dc86916c23516d_field_0, &__struct_info__c4dc86916c23516d_field_1, &__struct_info__c4dc86916c23516d_field_2, &__struct_info__c4dc86916c23516d_field_3, &__struct_info__c4dc86916c23516d_field_4 };
+StructInfo __struct_info__c4dc86916c23516d = {"_lambda_thismodule_53_3", "", 14, __struct_info__c4dc86916c23516d_fields, 5, 32, UINT64_C(0x0), nullptr, UINT64_C(0xc4dc86916c23516d), 4 };
+TypeInfo * __type_info__8f721b426ce4fa6_arg_types_var_13921195475635320081[2] = { &__type_info__78bc94cdda7ba862, &__type_info__af8a9b4c8643c319 };
+const char * __type_info__8f721b426ce4fa6_arg_names_var_13921195475635320081[2] = { "__this", "_yield_72" };
+VarInfo __struct_info__c13205870604b511_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__8f721b426ce4fa6_arg_types_var_13921195475635320081, __type_info__8f721b426ce4fa6_arg_names_var_13921195475635320081, 2, 0, nullptr, 12, 8, UINT64_C(0x8f721b426ce4fa6), "__lambda", 0, 0 };
+TypeInfo * __type_info__99683aa069aea9cf_arg_types_var_13921195475635320081[1] = { &__type_info__35b6e344a3fdc46d };
+VarInfo __struct_info__c13205870604b511_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__99683aa069aea9cf_arg_types_var_13921195475635320081, __type_info__9b656df695971ae5_arg_names_var_10892547945559290007, 1, 0, nullptr, 12, 8, UINT64_C(0x99683aa069aea9cf), "__finalize", 8, 0 };
+VarInfo __struct_info__c13205870604b511_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xc19bf6db1ce72081), "__yield", 16, 0 };
+VarInfo __struct_info__c13205870604b511_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x5f767adb3c929398), "t", 20, 0 };
+VarInfo * __struct_info__c13205870604b511_fields[4] =  { &__struct_info__c13205870604b511_field_0, &__struct_info__c13205870604b511_field_1, &__struct_info__c13205870604b511_field_2, &__struct_info__c13205870604b511_field_3 };
+StructInfo __struct_info__c13205870604b511 = {"_lambda_thismodule_72_4", "", 14, __struct_info__c13205870604b511_fields, 4, 24, UINT64_C(0x0), nullptr, UINT64_C(0xc13205870604b511), 4 };
+TypeInfo __type_info__af8a9b4c8643c319 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 4, UINT64_C(0xaf8a9b4c8643c319) };
+TypeInfo __type_info__4ef4b7b45798160c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3ef37aae0e6ae1aa, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x4ef4b7b45798160c) };
+TypeInfo __type_info__ecb9aeab21c6546f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__878125b1c81bc43b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xecb9aeab21c6546f) };
+TypeInfo __type_info__c749157bd33e62e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__86b04c77b26e2dc0, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xc749157bd33e62e) };
+TypeInfo __type_info__df63f7a2a2c81210 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2883d6ae052ac7fe, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xdf63f7a2a2c81210) };
+TypeInfo __type_info__15bd917ba5189633 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7d568177b6c0b8cf, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x15bd917ba5189633) };
+TypeInfo __type_info__bd1168e97eacde64 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9bb78d8ffcbfe833, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xbd1168e97eacde64) };
+TypeInfo __type_info__ee960cf060176d5e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4e6b15c42cd69a9f, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xee960cf060176d5e) };
+TypeInfo __type_info__44eee8ddab2ba33c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a618c59002d6765b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x44eee8ddab2ba33c) };
+TypeInfo __type_info__25fbf3149da3026e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c4ab4e8d8cd04631, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x25fbf3149da3026e) };
+TypeInfo __type_info__d5a1095154ebdd26 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a6a566ce67dc55f9, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xd5a1095154ebdd26) };
+TypeInfo __type_info__e8124d558f33cf6b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2c234da62187aebe, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xe8124d558f33cf6b) };
+TypeInfo __type_info__df4e086122629f16 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__711790b90dcab263, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xdf4e086122629f16) };
+TypeInfo __type_info__ff14275eb7db0999 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ef8e17d6159e86d2, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xff14275eb7db0999) };
+TypeInfo __type_info__35b6e344a3fdc46d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__78bc94cdda7ba862, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x35b6e344a3fdc46d) };
+TypeInfo __type_info__af81fe4c86352052 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 1, UINT64_C(0xaf81fe4c86352052) };
+TypeInfo __type_info__3ef37aae0e6ae1aa = { Type::tStructure, &__struct_info__972a1aa531f8f097, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 24, UINT64_C(0x3ef37aae0e6ae1aa) };
+TypeInfo __type_info__878125b1c81bc43b = { Type::tStructure, &__struct_info__9a961aa534e92ec0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 24, UINT64_C(0x878125b1c81bc43b) };
+TypeInfo __type_info__86b04c77b26e2dc0 = { Type::tStructure, &__struct_info__8c975aa528b0d5a9, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 24, UINT64_C(0x86b04c77b26e2dc0) };
+TypeInfo __type_info__2883d6ae052ac7fe = { Type::tStructure, &__struct_info__97181aa531e5e73b, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 32, UINT64_C(0x2883d6ae052ac7fe) };
+TypeInfo __type_info__7d568177b6c0b8cf = { Type::tStructure, &__struct_info__8ca11aa528ca1064, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 24, UINT64_C(0x7d568177b6c0b8cf) };
+TypeInfo __type_info__9bb78d8ffcbfe833 = { Type::tStructure, &__struct_info__be935cd1367a3e62, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0x9bb78d8ffcbfe833) };
+TypeInfo __type_info__4e6b15c42cd69a9f = { Type::tStructure, &__struct_info__cc5e04a6388697c4, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 24, UINT64_C(0x4e6b15c42cd69a9f) };
+TypeInfo __type_info__a618c59002d6765b = { Type::tStructure, &__struct_info__217844d18cf3ee5a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0xa618c59002d6765b) };
+TypeInfo __type_info__c4ab4e8d8cd04631 = { Type::tStructure, &__struct_info__8c9999e265cc7754, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0xc4ab4e8d8cd04631) };
+TypeInfo __type_info__a6a566ce67dc55f9 = { Type::tStructure, &__struct_info__c60fe1ac050b3bac, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 72, UINT64_C(0xa6a566ce67dc55f9) };
+TypeInfo __type_info__2c234da62187aebe = { Type::tStructure, &__struct_info__4dc99ad45648c3c7, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0x2c234da62187aebe) };
+TypeInfo __type_info__711790b90dcab263 = { Type::tStructure, &__struct_info__ef03f59b1975595c, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 24, UINT64_C(0x711790b90dcab263) };
+TypeInfo __type_info__ef8e17d6159e86d2 = { Type::tStructure, &__struct_info__c4dc86916c23516d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 32, UINT64_C(0xef8e17d6159e86d2) };
+TypeInfo __type_info__78bc94cdda7ba862 = { Type::tStructure, &__struct_info__c13205870604b511, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 24, UINT64_C(0x78bc94cdda7ba862) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 ( Context * __context__, range __rng_rename_at_1398_0 );
+inline void finalize_23807cbeaf2d734f ( Context * __context__, _lambda_thismodule_18_1 & ____this_rename_at_18_2 );
+inline void finalize_4174be89bcf8dc58 ( Context * __context__, _lambda_thismodule_35_2 & ____this_rename_at_35_3 );
+inline void finalize_b36c5385f838dbe0 ( Context * __context__, _lambda_thismodule_53_3 & ____this_rename_at_53_4 );
+inline void finalize_fa956870919eb1a0 ( Context * __context__, _lambda_thismodule_72_4 & ____this_rename_at_72_5 );
+inline void finalize_c89df058cdbff3af ( Context * __context__, _lambda_thismodule_114_5 & ____this_rename_at_114_6 );
+inline void finalize_ce147f9a8f78b2c5 ( Context * __context__, _lambda_thismodule_125_6 & ____this_rename_at_125_7 );
+inline void finalize_e7d035560e04b267 ( Context * __context__, _lambda_thismodule_139_7 & ____this_rename_at_139_8 );
+inline void finalize_dfbaf278d0146157 ( Context * __context__, _lambda_thismodule_154_8 & ____this_rename_at_154_9 );
+inline void finalize_b20a33487d1b2fa8 ( Context * __context__, _lambda_thismodule_169_9 & ____this_rename_at_169_10 );
+inline void finalize_c77af243d2194d02 ( Context * __context__, _lambda_thismodule_182_10 & ____this_rename_at_182_11 );
+inline void finalize_b031a58c24501ea6 ( Context * __context__, _lambda_thismodule_192_11 & ____this_rename_at_192_12 );
+inline void finalize_854fde60d8156dc9 ( Context * __context__, _lambda_thismodule_205_12 & ____this_rename_at_205_13 );
+inline void finalize_cc067bb3d5c32e9b ( Context * __context__, _lambda_thismodule_218_13 & ____this_rename_at_218_14 );
+inline void finalize_60d805ae843389b2 ( Context * __context__, _lambda_thismodule_230_14 & ____this_rename_at_230_15 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickeachTick9663565701927713696_c091e829e5353c5d ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_1443_16 );
+inline bool _Func_lambda_thismodule_18_1Tickfunction_4cb32a58c5278517 ( Context * __context__, _lambda_thismodule_18_1 & ____this_rename_at_18_18, int32_t & ___yield_18_rename_at_18_19 );
+inline void _Func_lambda_thismodule_18_1Tickfinalizer_4b17d16fe590d56b ( Context * __context__, _lambda_thismodule_18_1 * ____this_rename_at_18_20 );
+inline bool _Func_lambda_thismodule_35_2Tickfunction_58b31a4cb7e74e03 ( Context * __context__, _lambda_thismodule_35_2 & ____this_rename_at_35_21, int32_t & ___yield_35_rename_at_35_22 );
+inline void _Func_lambda_thismodule_35_2Tickfinalizer_abe387b19b43b901 ( Context * __context__, _lambda_thismodule_35_2 * ____this_rename_at_35_23 );
+inline bool _Func_lambda_thismodule_53_3Tickfunction_3437f4d3c6c4be77 ( Context * __context__, _lambda_thismodule_53_3 & ____this_rename_at_53_24, int32_t & ___yield_53_rename_at_53_25 );
+inline void _Func_lambda_thismodule_53_3Tickfinalizer_d3df2cf3381bf14d ( Context * __context__, _lambda_thismodule_53_3 * ____this_rename_at_53_26 );
+inline bool _Func_lambda_thismodule_72_4Tickfunction_7539be5e5dd855a4 ( Context * __context__, _lambda_thismodule_72_4 & ____this_rename_at_72_27, int32_t & ___yield_72_rename_at_72_28 );
+inline void _Func_lambda_thismodule_72_4Tickfinalizer_a86e3e2557e528a ( Context * __context__, _lambda_thismodule_72_4 * ____this_rename_at_72_29 );
+inline bool _Func_lambda_thismodule_114_5Tickfunction_f810914d808715d4 ( Context * __context__, _lambda_thismodule_114_5 & ____this_rename_at_114_30, int32_t & ___yield_114_rename_at_114_31 );
+inline void _Func_lambda_thismodule_114_5Tickfinalizer_89423dad5d46110c ( Context * __context__, _lambda_thismodule_114_5 * ____this_rename_at_114_32 );
+inline bool _Func_lambda_thismodule_125_6Tickfunction_4027e263da479e7b ( Context * __context__, _lambda_thismodule_125_6 & ____this_rename_at_125_33, int32_t & ___yield_125_rename_at_125_34 );
+inline void _Func_lambda_thismodule_125_6Tickfinalizer_fdffc8dda2cd8bfd ( Context * __context__, _lambda_thismodule_125_6 * ____this_rename_at_125_35 );
+inline bool _Func_lambda_thismodule_139_7Tickfunction_2c9110595b0e1f9e ( Context * __context__, _lambda_thismodule_139_7 & ____this_rename_at_139_36, int32_t & ___yield_139_rename_at_139_37 );
+inline void _Func_lambda_thismodule_139_7Tickfinalizer_6b38a21a43762671 ( Context * __context__, _lambda_thismodule_139_7 * ____this_rename_at_139_38 );
+inline bool _Func_lambda_thismodule_154_8Tickfunction_7d03daad96022294 ( Context * __context__, _lambda_thismodule_154_8 & ____this_rename_at_154_39, int32_t & ___yield_154_rename_at_154_40 );
+inline void _Func_lambda_thismodule_154_8Tickfinalizer_de88ed2911ec7604 ( Context * __context__, _lambda_thismodule_154_8 * ____this_rename_at_154_41 );
+inline bool _Func_lambda_thismodule_169_9Tickfunction_bee3a1a64100a980 ( Context * __context__, _lambda_thismodule_169_9 & ____this_rename_at_169_42, int32_t & ___yield_169_rename_at_169_43 );
+inline void _Func_lambda_thismodule_169_9Tickfinalizer_bfa753b76ce69e30 ( Context * __context__, _lambda_thismodule_169_9 * ____this_rename_at_169_44 );
+inline bool _Func_lambda_thismodule_182_10Tickfunction_78ecaf31e018c13b ( Context * __context__, _lambda_thismodule_182_10 & ____this_rename_at_182_45, int32_t & ___yield_182_rename_at_182_46 );
+inline void _Func_lambda_thismodule_182_10Tickfinalizer_9df84e9703d0ba2d ( Context * __context__, _lambda_thismodule_182_10 * ____this_rename_at_182_47 );
+inline bool _Func_lambda_thismodule_192_11Tickfunction_2f0b774f487a3138 ( Context * __context__, _lambda_thismodule_192_11 & ____this_rename_at_192_48, int32_t & ___yield_192_rename_at_192_49 );
+inline void _Func_lambda_thismodule_192_11Tickfinalizer_bcfb2cde58f8a884 ( Context * __context__, _lambda_thismodule_192_11 * ____this_rename_at_192_50 );
+inline bool _Func_lambda_thismodule_205_12Tickfunction_519f3f41446d4097 ( Context * __context__, _lambda_thismodule_205_12 & ____this_rename_at_205_51, int32_t & ___yield_205_rename_at_205_52 );
+inline void _Func_lambda_thismodule_205_12Tickfinalizer_94ba58d07fae6869 ( Context * __context__, _lambda_thismodule_205_12 * ____this_rename_at_205_53 );
+inline bool _Func_lambda_thismodule_218_13Tickfunction_cd23094c5fd49a5c ( Context * __context__, _lambda_thismodule_218_13 & ____this_rename_at_218_54, int32_t & ___yield_218_rename_at_218_55 );
+inline void _Func_lambda_thismodule_218_13Tickfinalizer_a05585ec5e6066cd ( Context * __context__, _lambda_thismodule_218_13 * ____this_rename_at_218_56 );
+inline bool _Func_lambda_thismodule_230_14Tickfunction_6560c3b2d05dfc12 ( Context * __context__, _lambda_thismodule_230_14 & ____this_rename_at_230_57, int32_t & ___yield_230_rename_at_230_58 );
+inline void _Func_lambda_thismodule_230_14Tickfinalizer_23619701baa36c54 ( Context * __context__, _lambda_thismodule_230_14 * ____this_rename_at_230_59 );
+inline void checkIt_1c9204c1ee5241d7 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __gen_rename_at_3_60 );
+inline void test_yield_39f0c31f9832f2e9 ( Context * __context__ );
+inline void test_local_10bd68e4b553d14b ( Context * __context__ );
+inline void test_local_ref_17967676754257c9 ( Context * __context__ );
+inline void test_if_a14f70d082ff6c54 ( Context * __context__ );
+inline void test_while_70c3a7012b0d1604 ( Context * __context__ );
+inline void test_while_break_146e21bbf081db20 ( Context * __context__ );
+inline void test_while_continue_8bf6c0076928fcc7 ( Context * __context__ );
+inline void test_while_nested_dbf9b4eaab73834a ( Context * __context__ );
+inline void test_while_finally_7d0cb74129577f21 ( Context * __context__ );
+inline void test_for_c4a5441fe8bda34f ( Context * __context__ );
+inline void test_for_break_a8389572add3637f ( Context * __context__ );
+inline void test_for_continue_5ac3b1dc14c48cbe ( Context * __context__ );
+inline void test_for_nested_6c30bda4247e35e6 ( Context * __context__ );
+inline void test_for_finally_d7e3d2c3baee7838 ( Context * __context__ );
+inline bool test_9da455592865df24 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 ( Context * __context__, range __rng_rename_at_1398_0 )
+{
+    Sequence DAS_COMMENT((int32_t)) __it_rename_at_1399_1;das_zero(__it_rename_at_1399_1);
+    builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_1399_1),__rng_rename_at_1398_0,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_1399_1);
+}
+
+inline void finalize_23807cbeaf2d734f ( Context * __context__, _lambda_thismodule_18_1 &  ____this_rename_at_18_2 )
+{
+    memset((void*)&(____this_rename_at_18_2), 0, 24);
+}
+
+inline void finalize_4174be89bcf8dc58 ( Context * __context__, _lambda_thismodule_35_2 &  ____this_rename_at_35_3 )
+{
+    memset((void*)&(____this_rename_at_35_3), 0, 24);
+}
+
+inline void finalize_b36c5385f838dbe0 ( Context * __context__, _lambda_thismodule_53_3 &  ____this_rename_at_53_4 )
+{
+    memset((void*)&(____this_rename_at_53_4), 0, 32);
+}
+
+inline void finalize_fa956870919eb1a0 ( Context * __context__, _lambda_thismodule_72_4 &  ____this_rename_at_72_5 )
+{
+    memset((void*)&(____this_rename_at_72_5), 0, 24);
+}
+
+inline void finalize_c89df058cdbff3af ( Context * __context__, _lambda_thismodule_114_5 &  ____this_rename_at_114_6 )
+{
+    memset((void*)&(____this_rename_at_114_6), 0, 24);
+}
+
+inline void finalize_ce147f9a8f78b2c5 ( Context * __context__, _lambda_thismodule_125_6 &  ____this_rename_at_125_7 )
+{
+    memset((void*)&(____this_rename_at_125_7), 0, 24);
+}
+
+inline void finalize_e7d035560e04b267 ( Context * __context__, _lambda_thismodule_139_7 &  ____this_rename_at_139_8 )
+{
+    memset((void*)&(____this_rename_at_139_8), 0, 24);
+}
+
+inline void finalize_dfbaf278d0146157 ( Context * __context__, _lambda_thismodule_154_8 &  ____this_rename_at_154_9 )
+{
+    memset((void*)&(____this_rename_at_154_9), 0, 32);
+}
+
+inline void finalize_b20a33487d1b2fa8 ( Context * __context__, _lambda_thismodule_169_9 &  ____this_rename_at_169_10 )
+{
+    memset((void*)&(____this_rename_at_169_10), 0, 24);
+}
+
+inline void finalize_c77af243d2194d02 ( Context * __context__, _lambda_thismodule_182_10 &  ____this_rename_at_182_11 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_182_11._source_0_at_183_8),__context__);
+    memset((void*)&(____this_rename_at_182_11), 0, 48);
+}
+
+inline void finalize_b031a58c24501ea6 ( Context * __context__, _lambda_thismodule_192_11 &  ____this_rename_at_192_12 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_192_12._source_0_at_193_8),__context__);
+    memset((void*)&(____this_rename_at_192_12), 0, 48);
+}
+
+inline void finalize_854fde60d8156dc9 ( Context * __context__, _lambda_thismodule_205_12 &  ____this_rename_at_205_13 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_205_13._source_0_at_206_8),__context__);
+    memset((void*)&(____this_rename_at_205_13), 0, 48);
+}
+
+inline void finalize_cc067bb3d5c32e9b ( Context * __context__, _lambda_thismodule_218_13 &  ____this_rename_at_218_14 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_218_14._source_0_at_219_8),__context__);
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_218_14.___source_0_at_220_12_rename_at_220_12),__context__);
+    memset((void*)&(____this_rename_at_218_14), 0, 72);
+}
+
+inline void finalize_60d805ae843389b2 ( Context * __context__, _lambda_thismodule_230_14 &  ____this_rename_at_230_15 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_230_15._source_0_at_231_8),__context__);
+    memset((void*)&(____this_rename_at_230_15), 0, 48);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickeachTick9663565701927713696_c091e829e5353c5d ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_1443_16 )
+{
+    Sequence DAS_COMMENT((int32_t)) __it_rename_at_1445_17;das_zero(__it_rename_at_1445_17);
+    builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_1445_17),__lam_rename_at_1443_16,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_1445_17);
+}
+
+inline bool _Func_lambda_thismodule_18_1Tickfunction_4cb32a58c5278517 ( Context * __context__, _lambda_thismodule_18_1 &  ____this_rename_at_18_18, int32_t & ___yield_18_rename_at_18_19 )
+{
+    switch (____this_rename_at_18_18.__yield) {
+    case 0: goto label_0;
+    case 1: goto label_1;
+    case 2: goto label_2;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    case 5: goto label_5;
+    case 6: goto label_6;
+    case 7: goto label_7;
+    case 8: goto label_8;
+    case 9: goto label_9;
+    case 10: goto label_10;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(___yield_18_rename_at_18_19,0);
+    das_copy(____this_rename_at_18_18.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    das_copy(___yield_18_rename_at_18_19,1);
+    das_copy(____this_rename_at_18_18.__yield,2);
+    return das_auto_cast<bool>::cast(true);
+    label_2:;;
+    das_copy(___yield_18_rename_at_18_19,2);
+    das_copy(____this_rename_at_18_18.__yield,3);
+    return das_auto_cast<bool>::cast(true);
+    label_3:;;
+    das_copy(___yield_18_rename_at_18_19,3);
+    das_copy(____this_rename_at_18_18.__yield,4);
+    return das_auto_cast<bool>::cast(true);
+    label_4:;;
+    das_copy(___yield_18_rename_at_18_19,4);
+    das_copy(____this_rename_at_18_18.__yield,5);
+    return das_auto_cast<bool>::cast(true);
+    label_5:;;
+    das_copy(___yield_18_rename_at_18_19,5);
+    das_copy(____this_rename_at_18_18.__yield,6);
+    return das_auto_cast<bool>::cast(true);
+    label_6:;;
+    das_copy(___yield_18_rename_at_18_19,6);
+    das_copy(____this_rename_at_18_18.__yield,7);
+    return das_auto_cast<bool>::cast(true);
+    label_7:;;
+    das_copy(___yield_18_rename_at_18_19,7);
+    das_copy(____this_rename_at_18_18.__yield,8);
+    return das_auto_cast<bool>::cast(true);
+    label_8:;;
+    das_copy(___yield_18_rename_at_18_19,8);
+    das_copy(____this_rename_at_18_18.__yield,9);
+    return das_auto_cast<bool>::cast(true);
+    label_9:;;
+    das_copy(___yield_18_rename_at_18_19,9);
+    das_copy(____this_rename_at_18_18.__yield,10);
+    return das_auto_cast<bool>::cast(true);
+    label_10:;;
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_18_1Tickfinalizer_4b17d16fe590d56b ( Context * __context__, _lambda_thismodule_18_1 * ____this_rename_at_18_20 )
+{
+    finalize_23807cbeaf2d734f(__context__,das_arg<_lambda_thismodule_18_1>::pass(das_deref(__context__,____this_rename_at_18_20,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_18_1 *>::clear(__context__,____this_rename_at_18_20);
+}
+
+inline bool _Func_lambda_thismodule_35_2Tickfunction_58b31a4cb7e74e03 ( Context * __context__, _lambda_thismodule_35_2 &  ____this_rename_at_35_21, int32_t & ___yield_35_rename_at_35_22 )
+{
+    switch (____this_rename_at_35_21.__yield) {
+    case 0: goto label_0;
+    case 1: goto label_1;
+    case 2: goto label_2;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    case 5: goto label_5;
+    case 6: goto label_6;
+    case 7: goto label_7;
+    case 8: goto label_8;
+    case 9: goto label_9;
+    case 10: goto label_10;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_35_21.t,0);
+    das_copy(___yield_35_rename_at_35_22,____this_rename_at_35_21.t++);
+    das_copy(____this_rename_at_35_21.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    das_copy(___yield_35_rename_at_35_22,____this_rename_at_35_21.t++);
+    das_copy(____this_rename_at_35_21.__yield,2);
+    return das_auto_cast<bool>::cast(true);
+    label_2:;;
+    das_copy(___yield_35_rename_at_35_22,____this_rename_at_35_21.t++);
+    das_copy(____this_rename_at_35_21.__yield,3);
+    return das_auto_cast<bool>::cast(true);
+    label_3:;;
+    das_copy(___yield_35_rename_at_35_22,____this_rename_at_35_21.t++);
+    das_copy(____this_rename_at_35_21.__yield,4);
+    return das_auto_cast<bool>::cast(true);
+    label_4:;;
+    das_copy(___yield_35_rename_at_35_22,____this_rename_at_35_21.t++);
+    das_copy(____this_rename_at_35_21.__yield,5);
+    return das_auto_cast<bool>::cast(true);
+    label_5:;;
+    das_copy(___yield_35_rename_at_35_22,____this_rename_at_35_21.t++);
+    das_copy(____this_rename_at_35_21.__yield,6);
+    return das_auto_cast<bool>::cast(true);
+    label_6:;;
+    das_copy(___yield_35_rename_at_35_22,____this_rename_at_35_21.t++);
+    das_copy(____this_rename_at_35_21.__yield,7);
+    return das_auto_cast<bool>::cast(true);
+    label_7:;;
+    das_copy(___yield_35_rename_at_35_22,____this_rename_at_35_21.t++);
+    das_copy(____this_rename_at_35_21.__yield,8);
+    return das_auto_cast<bool>::cast(true);
+    label_8:;;
+    das_copy(___yield_35_rename_at_35_22,____this_rename_at_35_21.t++);
+    das_copy(____this_rename_at_35_21.__yield,9);
+    return das_auto_cast<bool>::cast(true);
+    label_9:;;
+    das_copy(___yield_35_rename_at_35_22,____this_rename_at_35_21.t++);
+    das_copy(____this_rename_at_35_21.__yield,10);
+    return das_auto_cast<bool>::cast(true);
+    label_10:;;
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_35_2Tickfinalizer_abe387b19b43b901 ( Context * __context__, _lambda_thismodule_35_2 * ____this_rename_at_35_23 )
+{
+    finalize_4174be89bcf8dc58(__context__,das_arg<_lambda_thismodule_35_2>::pass(das_deref(__context__,____this_rename_at_35_23,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_35_2 *>::clear(__context__,____this_rename_at_35_23);
+}
+
+inline bool _Func_lambda_thismodule_53_3Tickfunction_3437f4d3c6c4be77 ( Context * __context__, _lambda_thismodule_53_3 &  ____this_rename_at_53_24, int32_t & ___yield_53_rename_at_53_25 )
+{
+    switch (____this_rename_at_53_24.__yield) {
+    case 0: goto label_0;
+    case 1: goto label_1;
+    case 2: goto label_2;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    case 5: goto label_5;
+    case 6: goto label_6;
+    case 7: goto label_7;
+    case 8: goto label_8;
+    case 9: goto label_9;
+    case 10: goto label_10;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_53_24.t,0);
+    das_copy(____this_rename_at_53_24.T,das_ref(__context__,____this_rename_at_53_24.t));
+    das_copy(___yield_53_rename_at_53_25,____this_rename_at_53_24.t++);
+    das_copy(____this_rename_at_53_24.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    das_copy(___yield_53_rename_at_53_25,das_deref(__context__,____this_rename_at_53_24.T,__FILE__,__LINE__)++);
+    das_copy(____this_rename_at_53_24.__yield,2);
+    return das_auto_cast<bool>::cast(true);
+    label_2:;;
+    das_copy(___yield_53_rename_at_53_25,____this_rename_at_53_24.t++);
+    das_copy(____this_rename_at_53_24.__yield,3);
+    return das_auto_cast<bool>::cast(true);
+    label_3:;;
+    das_copy(___yield_53_rename_at_53_25,das_deref(__context__,____this_rename_at_53_24.T,__FILE__,__LINE__)++);
+    das_copy(____this_rename_at_53_24.__yield,4);
+    return das_auto_cast<bool>::cast(true);
+    label_4:;;
+    das_copy(___yield_53_rename_at_53_25,____this_rename_at_53_24.t++);
+    das_copy(____this_rename_at_53_24.__yield,5);
+    return das_auto_cast<bool>::cast(true);
+    label_5:;;
+    das_copy(___yield_53_rename_at_53_25,das_deref(__context__,____this_rename_at_53_24.T,__FILE__,__LINE__)++);
+    das_copy(____this_rename_at_53_24.__yield,6);
+    return das_auto_cast<bool>::cast(true);
+    label_6:;;
+    das_copy(___yield_53_rename_at_53_25,____this_rename_at_53_24.t++);
+    das_copy(____this_rename_at_53_24.__yield,7);
+    return das_auto_cast<bool>::cast(true);
+    label_7:;;
+    das_copy(___yield_53_rename_at_53_25,das_deref(__context__,____this_rename_at_53_24.T,__FILE__,__LINE__)++);
+    das_copy(____this_rename_at_53_24.__yield,8);
+    return das_auto_cast<bool>::cast(true);
+    label_8:;;
+    das_copy(___yield_53_rename_at_53_25,____this_rename_at_53_24.t++);
+    das_copy(____this_rename_at_53_24.__yield,9);
+    return das_auto_cast<bool>::cast(true);
+    label_9:;;
+    das_copy(___yield_53_rename_at_53_25,das_deref(__context__,____this_rename_at_53_24.T,__FILE__,__LINE__)++);
+    das_copy(____this_rename_at_53_24.__yield,10);
+    return das_auto_cast<bool>::cast(true);
+    label_10:;;
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_53_3Tickfinalizer_d3df2cf3381bf14d ( Context * __context__, _lambda_thismodule_53_3 * ____this_rename_at_53_26 )
+{
+    finalize_b36c5385f838dbe0(__context__,das_arg<_lambda_thismodule_53_3>::pass(das_deref(__context__,____this_rename_at_53_26,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_53_3 *>::clear(__context__,____this_rename_at_53_26);
+}
+
+inline bool _Func_lambda_thismodule_72_4Tickfunction_7539be5e5dd855a4 ( Context * __context__, _lambda_thismodule_72_4 &  ____this_rename_at_72_27, int32_t & ___yield_72_rename_at_72_28 )
+{
+    switch (____this_rename_at_72_27.__yield) {
+    case 0: goto label_0;
+    case 1: goto label_1;
+    case 2: goto label_2;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    case 6: goto label_6;
+    case 5: goto label_5;
+    case 7: goto label_7;
+    case 8: goto label_8;
+    case 10: goto label_10;
+    case 9: goto label_9;
+    case 11: goto label_11;
+    case 13: goto label_13;
+    case 12: goto label_12;
+    case 14: goto label_14;
+    case 15: goto label_15;
+    case 20: goto label_20;
+    case 16: goto label_16;
+    case 18: goto label_18;
+    case 17: goto label_17;
+    case 19: goto label_19;
+    case 21: goto label_21;
+    case 22: goto label_22;
+    case 23: goto label_23;
+    case 24: goto label_24;
+    case 25: goto label_25;
+    case 26: goto label_26;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_72_27.t,0);
+    das_copy(___yield_72_rename_at_72_28,____this_rename_at_72_27.t++);
+    das_copy(____this_rename_at_72_27.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    if ( !(____this_rename_at_72_27.t == 1) )
+    {
+        goto label_3;
+    };
+    das_copy(___yield_72_rename_at_72_28,____this_rename_at_72_27.t++);
+    das_copy(____this_rename_at_72_27.__yield,2);
+    return das_auto_cast<bool>::cast(true);
+    label_2:;;
+    label_3:;;
+    if ( !(____this_rename_at_72_27.t == 2) )
+    {
+        goto label_6;
+    };
+    das_copy(___yield_72_rename_at_72_28,____this_rename_at_72_27.t++);
+    das_copy(____this_rename_at_72_27.__yield,4);
+    return das_auto_cast<bool>::cast(true);
+    label_4:;;
+    goto label_7;
+    label_6:;;
+    das_copy(___yield_72_rename_at_72_28,13);
+    das_copy(____this_rename_at_72_27.__yield,5);
+    return das_auto_cast<bool>::cast(true);
+    label_5:;;
+    label_7:;;
+    if ( !(____this_rename_at_72_27.t == 3) )
+    {
+        goto label_13;
+    };
+    if ( !(____this_rename_at_72_27.t < 10) )
+    {
+        goto label_10;
+    };
+    das_copy(___yield_72_rename_at_72_28,____this_rename_at_72_27.t++);
+    das_copy(____this_rename_at_72_27.__yield,8);
+    return das_auto_cast<bool>::cast(true);
+    label_8:;;
+    goto label_11;
+    label_10:;;
+    das_copy(___yield_72_rename_at_72_28,13);
+    das_copy(____this_rename_at_72_27.__yield,9);
+    return das_auto_cast<bool>::cast(true);
+    label_9:;;
+    label_11:;;
+    goto label_14;
+    label_13:;;
+    das_copy(___yield_72_rename_at_72_28,12);
+    das_copy(____this_rename_at_72_27.__yield,12);
+    return das_auto_cast<bool>::cast(true);
+    label_12:;;
+    label_14:;;
+    if ( !(____this_rename_at_72_27.t == 13) )
+    {
+        goto label_20;
+    };
+    das_copy(___yield_72_rename_at_72_28,0);
+    das_copy(____this_rename_at_72_27.__yield,15);
+    return das_auto_cast<bool>::cast(true);
+    label_15:;;
+    goto label_21;
+    label_20:;;
+    if ( !(____this_rename_at_72_27.t == 4) )
+    {
+        goto label_18;
+    };
+    das_copy(___yield_72_rename_at_72_28,____this_rename_at_72_27.t++);
+    das_copy(____this_rename_at_72_27.__yield,16);
+    return das_auto_cast<bool>::cast(true);
+    label_16:;;
+    goto label_19;
+    label_18:;;
+    das_copy(___yield_72_rename_at_72_28,-1);
+    das_copy(____this_rename_at_72_27.__yield,17);
+    return das_auto_cast<bool>::cast(true);
+    label_17:;;
+    label_19:;;
+    label_21:;;
+    das_copy(___yield_72_rename_at_72_28,____this_rename_at_72_27.t++);
+    das_copy(____this_rename_at_72_27.__yield,22);
+    return das_auto_cast<bool>::cast(true);
+    label_22:;;
+    das_copy(___yield_72_rename_at_72_28,____this_rename_at_72_27.t++);
+    das_copy(____this_rename_at_72_27.__yield,23);
+    return das_auto_cast<bool>::cast(true);
+    label_23:;;
+    das_copy(___yield_72_rename_at_72_28,____this_rename_at_72_27.t++);
+    das_copy(____this_rename_at_72_27.__yield,24);
+    return das_auto_cast<bool>::cast(true);
+    label_24:;;
+    das_copy(___yield_72_rename_at_72_28,____this_rename_at_72_27.t++);
+    das_copy(____this_rename_at_72_27.__yield,25);
+    return das_auto_cast<bool>::cast(true);
+    label_25:;;
+    das_copy(___yield_72_rename_at_72_28,____this_rename_at_72_27.t++);
+    das_copy(____this_rename_at_72_27.__yield,26);
+    return das_auto_cast<bool>::cast(true);
+    label_26:;;
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_72_4Tickfinalizer_a86e3e2557e528a ( Context * __context__, _lambda_thismodule_72_4 * ____this_rename_at_72_29 )
+{
+    finalize_fa956870919eb1a0(__context__,das_arg<_lambda_thismodule_72_4>::pass(das_deref(__context__,____this_rename_at_72_29,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_72_4 *>::clear(__context__,____this_rename_at_72_29);
+}
+
+inline bool _Func_lambda_thismodule_114_5Tickfunction_f810914d808715d4 ( Context * __context__, _lambda_thismodule_114_5 &  ____this_rename_at_114_30, int32_t & ___yield_114_rename_at_114_31 )
+{
+    switch (____this_rename_at_114_30.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_114_30.t,0);
+    label_2:;;
+    if ( !(____this_rename_at_114_30.t < 10) )
+    {
+        goto label_3;
+    };
+    das_copy(___yield_114_rename_at_114_31,____this_rename_at_114_30.t++);
+    das_copy(____this_rename_at_114_30.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    goto label_2;
+    label_3:;;
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_114_5Tickfinalizer_89423dad5d46110c ( Context * __context__, _lambda_thismodule_114_5 * ____this_rename_at_114_32 )
+{
+    finalize_c89df058cdbff3af(__context__,das_arg<_lambda_thismodule_114_5>::pass(das_deref(__context__,____this_rename_at_114_32,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_114_5 *>::clear(__context__,____this_rename_at_114_32);
+}
+
+inline bool _Func_lambda_thismodule_125_6Tickfunction_4027e263da479e7b ( Context * __context__, _lambda_thismodule_125_6 &  ____this_rename_at_125_33, int32_t & ___yield_125_rename_at_125_34 )
+{
+    switch (____this_rename_at_125_33.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_125_33.t,0);
+    label_2:;;
+    if ( !(____this_rename_at_125_33.t < 100) )
+    {
+        goto label_3;
+    };
+    if ( ____this_rename_at_125_33.t == 10 )
+    {
+        goto label_3;
+    };
+    das_copy(___yield_125_rename_at_125_34,____this_rename_at_125_33.t++);
+    das_copy(____this_rename_at_125_33.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    goto label_2;
+    label_3:;;
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_125_6Tickfinalizer_fdffc8dda2cd8bfd ( Context * __context__, _lambda_thismodule_125_6 * ____this_rename_at_125_35 )
+{
+    finalize_ce147f9a8f78b2c5(__context__,das_arg<_lambda_thismodule_125_6>::pass(das_deref(__context__,____this_rename_at_125_35,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_125_6 *>::clear(__context__,____this_rename_at_125_35);
+}
+
+inline bool _Func_lambda_thismodule_139_7Tickfunction_2c9110595b0e1f9e ( Context * __context__, _lambda_thismodule_139_7 &  ____this_rename_at_139_36, int32_t & ___yield_139_rename_at_139_37 )
+{
+    switch (____this_rename_at_139_36.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_139_36.t,0);
+    label_2:;;
+    if ( !(____this_rename_at_139_36.t < 100) )
+    {
+        goto label_3;
+    };
+    if ( ____this_rename_at_139_36.t >= 10 )
+    {
+        ++____this_rename_at_139_36.t;
+        goto label_2;
+    };
+    das_copy(___yield_139_rename_at_139_37,____this_rename_at_139_36.t++);
+    das_copy(____this_rename_at_139_36.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    goto label_2;
+    label_3:;;
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_139_7Tickfinalizer_6b38a21a43762671 ( Context * __context__, _lambda_thismodule_139_7 * ____this_rename_at_139_38 )
+{
+    finalize_e7d035560e04b267(__context__,das_arg<_lambda_thismodule_139_7>::pass(das_deref(__context__,____this_rename_at_139_38,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_139_7 *>::clear(__context__,____this_rename_at_139_38);
+}
+
+inline bool _Func_lambda_thismodule_154_8Tickfunction_7d03daad96022294 ( Context * __context__, _lambda_thismodule_154_8 &  ____this_rename_at_154_39, int32_t & ___yield_154_rename_at_154_40 )
+{
+    switch (____this_rename_at_154_39.__yield) {
+    case 0: goto label_0;
+    case 4: goto label_4;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 5: goto label_5;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_154_39.q,0);
+    label_4:;;
+    if ( !(____this_rename_at_154_39.q < 2) )
+    {
+        goto label_5;
+    };
+    das_copy(____this_rename_at_154_39.__t_rename_at_157_16,0);
+    label_2:;;
+    if ( !(____this_rename_at_154_39.__t_rename_at_157_16 < 5) )
+    {
+        goto label_3;
+    };
+    das_copy(___yield_154_rename_at_154_40,(____this_rename_at_154_39.q * 5) + (____this_rename_at_154_39.__t_rename_at_157_16++));
+    das_copy(____this_rename_at_154_39.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    goto label_2;
+    label_3:;;
+    ++____this_rename_at_154_39.q;
+    goto label_4;
+    label_5:;;
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_154_8Tickfinalizer_de88ed2911ec7604 ( Context * __context__, _lambda_thismodule_154_8 * ____this_rename_at_154_41 )
+{
+    finalize_dfbaf278d0146157(__context__,das_arg<_lambda_thismodule_154_8>::pass(das_deref(__context__,____this_rename_at_154_41,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_154_8 *>::clear(__context__,____this_rename_at_154_41);
+}
+
+inline bool _Func_lambda_thismodule_169_9Tickfunction_bee3a1a64100a980 ( Context * __context__, _lambda_thismodule_169_9 &  ____this_rename_at_169_42, int32_t & ___yield_169_rename_at_169_43 )
+{
+    switch (____this_rename_at_169_42.__yield) {
+    case 0: goto label_0;
+    case 3: goto label_3;
+    case 1: goto label_1;
+    case 4: goto label_4;
+    case 2: goto label_2;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_169_42.t,0);
+    label_3:;;
+    if ( !(____this_rename_at_169_42.t < 9) )
+    {
+        goto label_4;
+    };
+    das_copy(___yield_169_rename_at_169_43,____this_rename_at_169_42.t++);
+    das_copy(____this_rename_at_169_42.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    goto label_3;
+    label_4:;;
+    das_copy(___yield_169_rename_at_169_43,9);
+    das_copy(____this_rename_at_169_42.__yield,2);
+    return das_auto_cast<bool>::cast(true);
+    label_2:;;
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_169_9Tickfinalizer_bfa753b76ce69e30 ( Context * __context__, _lambda_thismodule_169_9 * ____this_rename_at_169_44 )
+{
+    finalize_b20a33487d1b2fa8(__context__,das_arg<_lambda_thismodule_169_9>::pass(das_deref(__context__,____this_rename_at_169_44,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_169_9 *>::clear(__context__,____this_rename_at_169_44);
+}
+
+inline bool _Func_lambda_thismodule_182_10Tickfunction_78ecaf31e018c13b ( Context * __context__, _lambda_thismodule_182_10 &  ____this_rename_at_182_45, int32_t & ___yield_182_rename_at_182_46 )
+{
+    switch (____this_rename_at_182_45.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_182_45._loop_at_183_8,true);
+    das_move(____this_rename_at_182_45._source_0_at_183_8,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,10)));
+    memset((void*)&(____this_rename_at_182_45.__t_rename_at_183_13), 0, 4);
+    das_copy(____this_rename_at_182_45._pvar_0_at_183_8,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_182_45.__t_rename_at_183_13)));
+    DAS_SETBOOLAND((____this_rename_at_182_45._loop_at_183_8),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_182_45._source_0_at_183_8),____this_rename_at_182_45._pvar_0_at_183_8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_182_45._loop_at_183_8 )
+    {
+        goto label_4;
+    };
+    das_copy(___yield_182_rename_at_182_46,____this_rename_at_182_45.__t_rename_at_183_13);
+    das_copy(____this_rename_at_182_45.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_182_45._loop_at_183_8),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_182_45._source_0_at_183_8),____this_rename_at_182_45._pvar_0_at_183_8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_182_45._source_0_at_183_8),____this_rename_at_182_45._pvar_0_at_183_8,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_182_10Tickfinalizer_9df84e9703d0ba2d ( Context * __context__, _lambda_thismodule_182_10 * ____this_rename_at_182_47 )
+{
+    finalize_c77af243d2194d02(__context__,das_arg<_lambda_thismodule_182_10>::pass(das_deref(__context__,____this_rename_at_182_47,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_182_10 *>::clear(__context__,____this_rename_at_182_47);
+}
+
+inline bool _Func_lambda_thismodule_192_11Tickfunction_2f0b774f487a3138 ( Context * __context__, _lambda_thismodule_192_11 &  ____this_rename_at_192_48, int32_t & ___yield_192_rename_at_192_49 )
+{
+    switch (____this_rename_at_192_48.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_192_48._loop_at_193_8,true);
+    das_move(____this_rename_at_192_48._source_0_at_193_8,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,100)));
+    memset((void*)&(____this_rename_at_192_48.__t_rename_at_193_13), 0, 4);
+    das_copy(____this_rename_at_192_48._pvar_0_at_193_8,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_192_48.__t_rename_at_193_13)));
+    DAS_SETBOOLAND((____this_rename_at_192_48._loop_at_193_8),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_192_48._source_0_at_193_8),____this_rename_at_192_48._pvar_0_at_193_8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_192_48._loop_at_193_8 )
+    {
+        goto label_4;
+    };
+    if ( ____this_rename_at_192_48.__t_rename_at_193_13 == 10 )
+    {
+        goto label_4;
+    };
+    das_copy(___yield_192_rename_at_192_49,____this_rename_at_192_48.__t_rename_at_193_13);
+    das_copy(____this_rename_at_192_48.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_192_48._loop_at_193_8),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_192_48._source_0_at_193_8),____this_rename_at_192_48._pvar_0_at_193_8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_192_48._source_0_at_193_8),____this_rename_at_192_48._pvar_0_at_193_8,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_192_11Tickfinalizer_bcfb2cde58f8a884 ( Context * __context__, _lambda_thismodule_192_11 * ____this_rename_at_192_50 )
+{
+    finalize_b031a58c24501ea6(__context__,das_arg<_lambda_thismodule_192_11>::pass(das_deref(__context__,____this_rename_at_192_50,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_192_11 *>::clear(__context__,____this_rename_at_192_50);
+}
+
+inline bool _Func_lambda_thismodule_205_12Tickfunction_519f3f41446d4097 ( Context * __context__, _lambda_thismodule_205_12 &  ____this_rename_at_205_51, int32_t & ___yield_205_rename_at_205_52 )
+{
+    switch (____this_rename_at_205_51.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_205_51._loop_at_206_8,true);
+    das_move(____this_rename_at_205_51._source_0_at_206_8,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,100)));
+    memset((void*)&(____this_rename_at_205_51.__t_rename_at_206_13), 0, 4);
+    das_copy(____this_rename_at_205_51._pvar_0_at_206_8,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_205_51.__t_rename_at_206_13)));
+    DAS_SETBOOLAND((____this_rename_at_205_51._loop_at_206_8),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_205_51._source_0_at_206_8),____this_rename_at_205_51._pvar_0_at_206_8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_205_51._loop_at_206_8 )
+    {
+        goto label_4;
+    };
+    if ( ____this_rename_at_205_51.__t_rename_at_206_13 >= 10 )
+    {
+        goto label_3;
+    };
+    das_copy(___yield_205_rename_at_205_52,____this_rename_at_205_51.__t_rename_at_206_13);
+    das_copy(____this_rename_at_205_51.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_205_51._loop_at_206_8),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_205_51._source_0_at_206_8),____this_rename_at_205_51._pvar_0_at_206_8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_205_51._source_0_at_206_8),____this_rename_at_205_51._pvar_0_at_206_8,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_205_12Tickfinalizer_94ba58d07fae6869 ( Context * __context__, _lambda_thismodule_205_12 * ____this_rename_at_205_53 )
+{
+    finalize_854fde60d8156dc9(__context__,das_arg<_lambda_thismodule_205_12>::pass(das_deref(__context__,____this_rename_at_205_53,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_205_12 *>::clear(__context__,____this_rename_at_205_53);
+}
+
+inline bool _Func_lambda_thismodule_218_13Tickfunction_cd23094c5fd49a5c ( Context * __context__, _lambda_thismodule_218_13 &  ____this_rename_at_218_54, int32_t & ___yield_218_rename_at_218_55 )
+{
+    switch (____this_rename_at_218_54.__yield) {
+    case 0: goto label_0;
+    case 5: goto label_5;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    case 6: goto label_6;
+    case 7: goto label_7;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_218_54._loop_at_219_8,true);
+    das_move(____this_rename_at_218_54._source_0_at_219_8,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,2)));
+    memset((void*)&(____this_rename_at_218_54.__q_rename_at_219_13), 0, 4);
+    das_copy(____this_rename_at_218_54._pvar_0_at_219_8,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_218_54.__q_rename_at_219_13)));
+    DAS_SETBOOLAND((____this_rename_at_218_54._loop_at_219_8),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_218_54._source_0_at_219_8),____this_rename_at_218_54._pvar_0_at_219_8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_5:;;
+    if ( !____this_rename_at_218_54._loop_at_219_8 )
+    {
+        goto label_7;
+    };
+    das_copy(____this_rename_at_218_54.___loop_at_220_12_rename_at_220_12,true);
+    das_move(____this_rename_at_218_54.___source_0_at_220_12_rename_at_220_12,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,5)));
+    memset((void*)&(____this_rename_at_218_54.__t_rename_at_220_17), 0, 4);
+    das_copy(____this_rename_at_218_54.___pvar_0_at_220_12_rename_at_220_12,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_218_54.__t_rename_at_220_17)));
+    DAS_SETBOOLAND((____this_rename_at_218_54.___loop_at_220_12_rename_at_220_12),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_218_54.___source_0_at_220_12_rename_at_220_12),____this_rename_at_218_54.___pvar_0_at_220_12_rename_at_220_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_218_54.___loop_at_220_12_rename_at_220_12 )
+    {
+        goto label_4;
+    };
+    das_copy(___yield_218_rename_at_218_55,(____this_rename_at_218_54.__q_rename_at_219_13 * 5) + ____this_rename_at_218_54.__t_rename_at_220_17);
+    das_copy(____this_rename_at_218_54.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_218_54.___loop_at_220_12_rename_at_220_12),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_218_54.___source_0_at_220_12_rename_at_220_12),____this_rename_at_218_54.___pvar_0_at_220_12_rename_at_220_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_218_54.___source_0_at_220_12_rename_at_220_12),____this_rename_at_218_54.___pvar_0_at_220_12_rename_at_220_12,__context__);
+    label_6:;;
+    DAS_SETBOOLAND((____this_rename_at_218_54._loop_at_219_8),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_218_54._source_0_at_219_8),____this_rename_at_218_54._pvar_0_at_219_8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_5;
+    label_7:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_218_54._source_0_at_219_8),____this_rename_at_218_54._pvar_0_at_219_8,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_218_13Tickfinalizer_a05585ec5e6066cd ( Context * __context__, _lambda_thismodule_218_13 * ____this_rename_at_218_56 )
+{
+    finalize_cc067bb3d5c32e9b(__context__,das_arg<_lambda_thismodule_218_13>::pass(das_deref(__context__,____this_rename_at_218_56,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_218_13 *>::clear(__context__,____this_rename_at_218_56);
+}
+
+inline bool _Func_lambda_thismodule_230_14Tickfunction_6560c3b2d05dfc12 ( Context * __context__, _lambda_thismodule_230_14 &  ____this_rename_at_230_57, int32_t & ___yield_230_rename_at_230_58 )
+{
+    switch (____this_rename_at_230_57.__yield) {
+    case 0: goto label_0;
+    case 3: goto label_3;
+    case 1: goto label_1;
+    case 4: goto label_4;
+    case 5: goto label_5;
+    case 2: goto label_2;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_230_57._loop_at_231_8,true);
+    das_move(____this_rename_at_230_57._source_0_at_231_8,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,9)));
+    memset((void*)&(____this_rename_at_230_57.__t_rename_at_231_13), 0, 4);
+    das_copy(____this_rename_at_230_57._pvar_0_at_231_8,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_230_57.__t_rename_at_231_13)));
+    DAS_SETBOOLAND((____this_rename_at_230_57._loop_at_231_8),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_230_57._source_0_at_231_8),____this_rename_at_230_57._pvar_0_at_231_8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_3:;;
+    if ( !____this_rename_at_230_57._loop_at_231_8 )
+    {
+        goto label_5;
+    };
+    das_copy(___yield_230_rename_at_230_58,____this_rename_at_230_57.__t_rename_at_231_13);
+    das_copy(____this_rename_at_230_57.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_4:;;
+    DAS_SETBOOLAND((____this_rename_at_230_57._loop_at_231_8),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_230_57._source_0_at_231_8),____this_rename_at_230_57._pvar_0_at_231_8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_3;
+    label_5:;;
+    das_copy(___yield_230_rename_at_230_58,9);
+    das_copy(____this_rename_at_230_57.__yield,2);
+    return das_auto_cast<bool>::cast(true);
+    label_2:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_230_57._source_0_at_231_8),____this_rename_at_230_57._pvar_0_at_231_8,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_230_14Tickfinalizer_23619701baa36c54 ( Context * __context__, _lambda_thismodule_230_14 * ____this_rename_at_230_59 )
+{
+    finalize_60d805ae843389b2(__context__,das_arg<_lambda_thismodule_230_14>::pass(das_deref(__context__,____this_rename_at_230_59,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_230_14 *>::clear(__context__,____this_rename_at_230_59);
+}
+
+inline void checkIt_1c9204c1ee5241d7 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __gen_rename_at_3_60 )
+{
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_6_22_0; _temp_make_local_6_22_0;
+    int32_t __count_rename_at_5_61 = 0;
+    {
+        bool __need_loop_6 = true;
+        // x: int
+        das_iterator<Sequence DAS_COMMENT((int32_t))> __x_iterator(__gen_rename_at_3_60);
+        int32_t __x_rename_at_6_64;
+        __need_loop_6 = __x_iterator.first(__context__,(__x_rename_at_6_64)) && __need_loop_6;
+        // y: int
+        das_iterator_count DAS_COMMENT((_temp_make_local_6_22_0 = (builtin_count(0,1,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))) __y_iterator(0,1);
+        int32_t __y_rename_at_6_65;
+        __need_loop_6 = __y_iterator.first(__context__,(__y_rename_at_6_65)) && __need_loop_6;
+        for ( ; __need_loop_6 ; __need_loop_6 = __x_iterator.next(__context__,(__x_rename_at_6_64)) && __y_iterator.next(__context__,(__y_rename_at_6_65)) )
+        {
+            if ( __y_rename_at_6_65 >= 10 )
+            {
+                DAS_ASSERTF((false),(((char *) "output too long")));
+            };
+            DAS_ASSERTF((__x_rename_at_6_64 == __y_rename_at_6_65),(((char *) "value mismatch")));
+            ++__count_rename_at_5_61;
+        }
+        __y_iterator.close(__context__,(__y_rename_at_6_65));
+        __x_iterator.close(__context__,(__x_rename_at_6_64));
+    };
+    DAS_ASSERTF((__count_rename_at_5_61 == 10),(((char *) "output too short")));
+}
+
+inline void test_yield_39f0c31f9832f2e9 ( Context * __context__ )
+{
+    Sequence DAS_COMMENT((int32_t)) __gen_rename_at_18_66; das_zero(__gen_rename_at_18_66); das_move(__gen_rename_at_18_66, _FuncbuiltinTickeachTick9663565701927713696_c091e829e5353c5d(__context__,das_ascend<bool,_lambda_thismodule_18_1>::make(__context__,&__type_info__4e6b15c42cd69a9f,(([&]() -> _lambda_thismodule_18_1 {
+        _lambda_thismodule_18_1 __mks_18;
+        das_zero(__mks_18);
+        das_copy((__mks_18.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_18_1`function XS<_lambda_thismodule_18_1> &i*/ 0xed8b7a0c5f021a06))));
+        das_copy((__mks_18.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_18_1`finalizer X1<S<_lambda_thismodule_18_1>>?*/ 0xf67066fb0184c811))));
+        return __mks_18;
+    })()))));
+    checkIt_1c9204c1ee5241d7(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__gen_rename_at_18_66));
+}
+
+inline void test_local_10bd68e4b553d14b ( Context * __context__ )
+{
+    Sequence DAS_COMMENT((int32_t)) __gen_rename_at_35_67; das_zero(__gen_rename_at_35_67); das_move(__gen_rename_at_35_67, _FuncbuiltinTickeachTick9663565701927713696_c091e829e5353c5d(__context__,das_ascend<bool,_lambda_thismodule_35_2>::make(__context__,&__type_info__711790b90dcab263,(([&]() -> _lambda_thismodule_35_2 {
+        _lambda_thismodule_35_2 __mks_35;
+        das_zero(__mks_35);
+        das_copy((__mks_35.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_35_2`function XS<_lambda_thismodule_35_2> &i*/ 0xd35c64ddf6c2454e))));
+        das_copy((__mks_35.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_35_2`finalizer X1<S<_lambda_thismodule_35_2>>?*/ 0xd1876a4b7a1ffc6b))));
+        return __mks_35;
+    })()))));
+    checkIt_1c9204c1ee5241d7(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__gen_rename_at_35_67));
+}
+
+inline void test_local_ref_17967676754257c9 ( Context * __context__ )
+{
+    Sequence DAS_COMMENT((int32_t)) __gen_rename_at_53_68; das_zero(__gen_rename_at_53_68); das_move(__gen_rename_at_53_68, _FuncbuiltinTickeachTick9663565701927713696_c091e829e5353c5d(__context__,das_ascend<bool,_lambda_thismodule_53_3>::make(__context__,&__type_info__ef8e17d6159e86d2,(([&]() -> _lambda_thismodule_53_3 {
+        _lambda_thismodule_53_3 __mks_53;
+        das_zero(__mks_53);
+        das_copy((__mks_53.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_53_3`function XS<_lambda_thismodule_53_3> &i*/ 0x32362103a2e68eda))));
+        das_copy((__mks_53.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_53_3`finalizer X1<S<_lambda_thismodule_53_3>>?*/ 0x662085d5853d13da))));
+        return __mks_53;
+    })()))));
+    checkIt_1c9204c1ee5241d7(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__gen_rename_at_53_68));
+}
+
+inline void test_if_a14f70d082ff6c54 ( Context * __context__ )
+{
+    Sequence DAS_COMMENT((int32_t)) __gen_rename_at_72_69; das_zero(__gen_rename_at_72_69); das_move(__gen_rename_at_72_69, _FuncbuiltinTickeachTick9663565701927713696_c091e829e5353c5d(__context__,das_ascend<bool,_lambda_thismodule_72_4>::make(__context__,&__type_info__78bc94cdda7ba862,(([&]() -> _lambda_thismodule_72_4 {
+        _lambda_thismodule_72_4 __mks_72;
+        das_zero(__mks_72);
+        das_copy((__mks_72.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_72_4`function XS<_lambda_thismodule_72_4> &i*/ 0xd5fd46a8be3150a))));
+        das_copy((__mks_72.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_72_4`finalizer X1<S<_lambda_thismodule_72_4>>?*/ 0x4d67713b9c165284))));
+        return __mks_72;
+    })()))));
+    checkIt_1c9204c1ee5241d7(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__gen_rename_at_72_69));
+}
+
+inline void test_while_70c3a7012b0d1604 ( Context * __context__ )
+{
+    Sequence DAS_COMMENT((int32_t)) __gen_rename_at_114_70; das_zero(__gen_rename_at_114_70); das_move(__gen_rename_at_114_70, _FuncbuiltinTickeachTick9663565701927713696_c091e829e5353c5d(__context__,das_ascend<bool,_lambda_thismodule_114_5>::make(__context__,&__type_info__3ef37aae0e6ae1aa,(([&]() -> _lambda_thismodule_114_5 {
+        _lambda_thismodule_114_5 __mks_114;
+        das_zero(__mks_114);
+        das_copy((__mks_114.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_114_5`function XS<_lambda_thismodule_114_5> &i*/ 0xce15820ffcb2220b))));
+        das_copy((__mks_114.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_114_5`finalizer X1<S<_lambda_thismodule_114_5>>?*/ 0xf255a213311c1d02))));
+        return __mks_114;
+    })()))));
+    checkIt_1c9204c1ee5241d7(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__gen_rename_at_114_70));
+}
+
+inline void test_while_break_146e21bbf081db20 ( Context * __context__ )
+{
+    Sequence DAS_COMMENT((int32_t)) __gen_rename_at_125_71; das_zero(__gen_rename_at_125_71); das_move(__gen_rename_at_125_71, _FuncbuiltinTickeachTick9663565701927713696_c091e829e5353c5d(__context__,das_ascend<bool,_lambda_thismodule_125_6>::make(__context__,&__type_info__878125b1c81bc43b,(([&]() -> _lambda_thismodule_125_6 {
+        _lambda_thismodule_125_6 __mks_125;
+        das_zero(__mks_125);
+        das_copy((__mks_125.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_125_6`function XS<_lambda_thismodule_125_6> &i*/ 0x5b72095cfe48142))));
+        das_copy((__mks_125.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_125_6`finalizer X1<S<_lambda_thismodule_125_6>>?*/ 0x166939bc1efadb76))));
+        return __mks_125;
+    })()))));
+    checkIt_1c9204c1ee5241d7(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__gen_rename_at_125_71));
+}
+
+inline void test_while_continue_8bf6c0076928fcc7 ( Context * __context__ )
+{
+    Sequence DAS_COMMENT((int32_t)) __gen_rename_at_139_72; das_zero(__gen_rename_at_139_72); das_move(__gen_rename_at_139_72, _FuncbuiltinTickeachTick9663565701927713696_c091e829e5353c5d(__context__,das_ascend<bool,_lambda_thismodule_139_7>::make(__context__,&__type_info__86b04c77b26e2dc0,(([&]() -> _lambda_thismodule_139_7 {
+        _lambda_thismodule_139_7 __mks_139;
+        das_zero(__mks_139);
+        das_copy((__mks_139.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_139_7`function XS<_lambda_thismodule_139_7> &i*/ 0xbd27b2bf22965f66))));
+        das_copy((__mks_139.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_139_7`finalizer X1<S<_lambda_thismodule_139_7>>?*/ 0x81d0b56907aefc52))));
+        return __mks_139;
+    })()))));
+    checkIt_1c9204c1ee5241d7(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__gen_rename_at_139_72));
+}
+
+inline void test_while_nested_dbf9b4eaab73834a ( Context * __context__ )
+{
+    Sequence DAS_COMMENT((int32_t)) __gen_rename_at_154_73; das_zero(__gen_rename_at_154_73); das_move(__gen_rename_at_154_73, _FuncbuiltinTickeachTick9663565701927713696_c091e829e5353c5d(__context__,das_ascend<bool,_lambda_thismodule_154_8>::make(__context__,&__type_info__2883d6ae052ac7fe,(([&]() -> _lambda_thismodule_154_8 {
+        _lambda_thismodule_154_8 __mks_154;
+        das_zero(__mks_154);
+        das_copy((__mks_154.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_154_8`function XS<_lambda_thismodule_154_8> &i*/ 0x9c769bae16d07998))));
+        das_copy((__mks_154.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_154_8`finalizer X1<S<_lambda_thismodule_154_8>>?*/ 0x5778687820f3ecaa))));
+        return __mks_154;
+    })()))));
+    checkIt_1c9204c1ee5241d7(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__gen_rename_at_154_73));
+}
+
+inline void test_while_finally_7d0cb74129577f21 ( Context * __context__ )
+{
+    Sequence DAS_COMMENT((int32_t)) __gen_rename_at_169_74; das_zero(__gen_rename_at_169_74); das_move(__gen_rename_at_169_74, _FuncbuiltinTickeachTick9663565701927713696_c091e829e5353c5d(__context__,das_ascend<bool,_lambda_thismodule_169_9>::make(__context__,&__type_info__7d568177b6c0b8cf,(([&]() -> _lambda_thismodule_169_9 {
+        _lambda_thismodule_169_9 __mks_169;
+        das_zero(__mks_169);
+        das_copy((__mks_169.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_169_9`function XS<_lambda_thismodule_169_9> &i*/ 0xb91b52d50687debb))));
+        das_copy((__mks_169.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_169_9`finalizer X1<S<_lambda_thismodule_169_9>>?*/ 0x643bc85f046d9fa6))));
+        return __mks_169;
+    })()))));
+    checkIt_1c9204c1ee5241d7(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__gen_rename_at_169_74));
+}
+
+inline void test_for_c4a5441fe8bda34f ( Context * __context__ )
+{
+    Sequence DAS_COMMENT((int32_t)) __gen_rename_at_182_75; das_zero(__gen_rename_at_182_75); das_move(__gen_rename_at_182_75, _FuncbuiltinTickeachTick9663565701927713696_c091e829e5353c5d(__context__,das_ascend<bool,_lambda_thismodule_182_10>::make(__context__,&__type_info__9bb78d8ffcbfe833,(([&]() -> _lambda_thismodule_182_10 {
+        _lambda_thismodule_182_10 __mks_182;
+        das_zero(__mks_182);
+        das_copy((__mks_182.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_182_10`function XS<_lambda_thismodule_182_10> &i*/ 0x77c292ec4a86255c))));
+        das_copy((__mks_182.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_182_10`finalizer X1<S<_lambda_thismodule_182_10>>?*/ 0x20dca3ff47b003ad))));
+        return __mks_182;
+    })()))));
+    checkIt_1c9204c1ee5241d7(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__gen_rename_at_182_75));
+}
+
+inline void test_for_break_a8389572add3637f ( Context * __context__ )
+{
+    Sequence DAS_COMMENT((int32_t)) __gen_rename_at_192_76; das_zero(__gen_rename_at_192_76); das_move(__gen_rename_at_192_76, _FuncbuiltinTickeachTick9663565701927713696_c091e829e5353c5d(__context__,das_ascend<bool,_lambda_thismodule_192_11>::make(__context__,&__type_info__a618c59002d6765b,(([&]() -> _lambda_thismodule_192_11 {
+        _lambda_thismodule_192_11 __mks_192;
+        das_zero(__mks_192);
+        das_copy((__mks_192.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_192_11`function XS<_lambda_thismodule_192_11> &i*/ 0xf1719c53e996015c))));
+        das_copy((__mks_192.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_192_11`finalizer X1<S<_lambda_thismodule_192_11>>?*/ 0xb85830a0e09744f5))));
+        return __mks_192;
+    })()))));
+    checkIt_1c9204c1ee5241d7(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__gen_rename_at_192_76));
+}
+
+inline void test_for_continue_5ac3b1dc14c48cbe ( Context * __context__ )
+{
+    Sequence DAS_COMMENT((int32_t)) __gen_rename_at_205_77; das_zero(__gen_rename_at_205_77); das_move(__gen_rename_at_205_77, _FuncbuiltinTickeachTick9663565701927713696_c091e829e5353c5d(__context__,das_ascend<bool,_lambda_thismodule_205_12>::make(__context__,&__type_info__c4ab4e8d8cd04631,(([&]() -> _lambda_thismodule_205_12 {
+        _lambda_thismodule_205_12 __mks_205;
+        das_zero(__mks_205);
+        das_copy((__mks_205.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_205_12`function XS<_lambda_thismodule_205_12> &i*/ 0x4069862d9ca731b4))));
+        das_copy((__mks_205.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_205_12`finalizer X1<S<_lambda_thismodule_205_12>>?*/ 0x501f8b5c46d45759))));
+        return __mks_205;
+    })()))));
+    checkIt_1c9204c1ee5241d7(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__gen_rename_at_205_77));
+}
+
+inline void test_for_nested_6c30bda4247e35e6 ( Context * __context__ )
+{
+    Sequence DAS_COMMENT((int32_t)) __gen_rename_at_218_78; das_zero(__gen_rename_at_218_78); das_move(__gen_rename_at_218_78, _FuncbuiltinTickeachTick9663565701927713696_c091e829e5353c5d(__context__,das_ascend<bool,_lambda_thismodule_218_13>::make(__context__,&__type_info__a6a566ce67dc55f9,(([&]() -> _lambda_thismodule_218_13 {
+        _lambda_thismodule_218_13 __mks_218;
+        das_zero(__mks_218);
+        das_copy((__mks_218.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_218_13`function XS<_lambda_thismodule_218_13> &i*/ 0xd4e5a2c58f05dce4))));
+        das_copy((__mks_218.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_218_13`finalizer X1<S<_lambda_thismodule_218_13>>?*/ 0x8a3c37752447a428))));
+        return __mks_218;
+    })()))));
+    checkIt_1c9204c1ee5241d7(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__gen_rename_at_218_78));
+}
+
+inline void test_for_finally_d7e3d2c3baee7838 ( Context * __context__ )
+{
+    Sequence DAS_COMMENT((int32_t)) __gen_rename_at_230_79; das_zero(__gen_rename_at_230_79); das_move(__gen_rename_at_230_79, _FuncbuiltinTickeachTick9663565701927713696_c091e829e5353c5d(__context__,das_ascend<bool,_lambda_thismodule_230_14>::make(__context__,&__type_info__2c234da62187aebe,(([&]() -> _lambda_thismodule_230_14 {
+        _lambda_thismodule_230_14 __mks_230;
+        das_zero(__mks_230);
+        das_copy((__mks_230.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_230_14`function XS<_lambda_thismodule_230_14> &i*/ 0xc6a8babd3aa143a6))));
+        das_copy((__mks_230.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_230_14`finalizer X1<S<_lambda_thismodule_230_14>>?*/ 0xc2af7692077f3a4b))));
+        return __mks_230;
+    })()))));
+    checkIt_1c9204c1ee5241d7(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__gen_rename_at_230_79));
+}
+
+inline bool test_9da455592865df24 ( Context * __context__ )
+{
+    test_yield_39f0c31f9832f2e9(__context__);
+    test_local_10bd68e4b553d14b(__context__);
+    test_local_ref_17967676754257c9(__context__);
+    test_if_a14f70d082ff6c54(__context__);
+    test_while_70c3a7012b0d1604(__context__);
+    test_while_break_146e21bbf081db20(__context__);
+    test_while_continue_8bf6c0076928fcc7(__context__);
+    test_while_nested_dbf9b4eaab73834a(__context__);
+    test_while_finally_7d0cb74129577f21(__context__);
+    test_for_c4a5441fe8bda34f(__context__);
+    test_for_break_a8389572add3637f(__context__);
+    test_for_continue_5ac3b1dc14c48cbe(__context__);
+    test_for_nested_6c30bda4247e35e6(__context__);
+    test_for_finally_d7e3d2c3baee7838(__context__);
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 ( Context * __context__ ) {
+    range arg_rng = cast_aot_arg<range>::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__, arg_rng);
+    return v_zero();
+}
+static vec4f __wrap_finalize_23807cbeaf2d734f ( Context * __context__ ) {
+    _lambda_thismodule_18_1 &  arg___this = cast_aot_arg<_lambda_thismodule_18_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_23807cbeaf2d734f(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_4174be89bcf8dc58 ( Context * __context__ ) {
+    _lambda_thismodule_35_2 &  arg___this = cast_aot_arg<_lambda_thismodule_35_2 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_4174be89bcf8dc58(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_b36c5385f838dbe0 ( Context * __context__ ) {
+    _lambda_thismodule_53_3 &  arg___this = cast_aot_arg<_lambda_thismodule_53_3 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_b36c5385f838dbe0(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_fa956870919eb1a0 ( Context * __context__ ) {
+    _lambda_thismodule_72_4 &  arg___this = cast_aot_arg<_lambda_thismodule_72_4 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_fa956870919eb1a0(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_c89df058cdbff3af ( Context * __context__ ) {
+    _lambda_thismodule_114_5 &  arg___this = cast_aot_arg<_lambda_thismodule_114_5 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_c89df058cdbff3af(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_ce147f9a8f78b2c5 ( Context * __context__ ) {
+    _lambda_thismodule_125_6 &  arg___this = cast_aot_arg<_lambda_thismodule_125_6 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_ce147f9a8f78b2c5(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_e7d035560e04b267 ( Context * __context__ ) {
+    _lambda_thismodule_139_7 &  arg___this = cast_aot_arg<_lambda_thismodule_139_7 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_e7d035560e04b267(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_dfbaf278d0146157 ( Context * __context__ ) {
+    _lambda_thismodule_154_8 &  arg___this = cast_aot_arg<_lambda_thismodule_154_8 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_dfbaf278d0146157(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_b20a33487d1b2fa8 ( Context * __context__ ) {
+    _lambda_thismodule_169_9 &  arg___this = cast_aot_arg<_lambda_thismodule_169_9 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_b20a33487d1b2fa8(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_c77af243d2194d02 ( Context * __context__ ) {
+    _lambda_thismodule_182_10 &  arg___this = cast_aot_arg<_lambda_thismodule_182_10 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_c77af243d2194d02(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_b031a58c24501ea6 ( Context * __context__ ) {
+    _lambda_thismodule_192_11 &  arg___this = cast_aot_arg<_lambda_thismodule_192_11 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_b031a58c24501ea6(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_854fde60d8156dc9 ( Context * __context__ ) {
+    _lambda_thismodule_205_12 &  arg___this = cast_aot_arg<_lambda_thismodule_205_12 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_854fde60d8156dc9(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_cc067bb3d5c32e9b ( Context * __context__ ) {
+    _lambda_thismodule_218_13 &  arg___this = cast_aot_arg<_lambda_thismodule_218_13 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_cc067bb3d5c32e9b(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_60d805ae843389b2 ( Context * __context__ ) {
+    _lambda_thismodule_230_14 &  arg___this = cast_aot_arg<_lambda_thismodule_230_14 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_60d805ae843389b2(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeachTick9663565701927713696_c091e829e5353c5d ( Context * __context__ ) {
+    Lambda DAS_COMMENT((bool,int32_t &)) const  arg_lam = cast_aot_arg<Lambda DAS_COMMENT((bool,int32_t &)) const >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncbuiltinTickeachTick9663565701927713696_c091e829e5353c5d(__context__, arg_lam);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_18_1Tickfunction_4cb32a58c5278517 ( Context * __context__ ) {
+    _lambda_thismodule_18_1 &  arg___this = cast_aot_arg<_lambda_thismodule_18_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg__yield_18 = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_18_1Tickfunction_4cb32a58c5278517(__context__, arg___this, arg__yield_18));
+}
+static vec4f __wrap__Func_lambda_thismodule_18_1Tickfinalizer_4b17d16fe590d56b ( Context * __context__ ) {
+    _lambda_thismodule_18_1 * arg___this = cast_aot_arg<_lambda_thismodule_18_1 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_18_1Tickfinalizer_4b17d16fe590d56b(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_35_2Tickfunction_58b31a4cb7e74e03 ( Context * __context__ ) {
+    _lambda_thismodule_35_2 &  arg___this = cast_aot_arg<_lambda_thismodule_35_2 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg__yield_35 = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_35_2Tickfunction_58b31a4cb7e74e03(__context__, arg___this, arg__yield_35));
+}
+static vec4f __wrap__Func_lambda_thismodule_35_2Tickfinalizer_abe387b19b43b901 ( Context * __context__ ) {
+    _lambda_thismodule_35_2 * arg___this = cast_aot_arg<_lambda_thismodule_35_2 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_35_2Tickfinalizer_abe387b19b43b901(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_53_3Tickfunction_3437f4d3c6c4be77 ( Context * __context__ ) {
+    _lambda_thismodule_53_3 &  arg___this = cast_aot_arg<_lambda_thismodule_53_3 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg__yield_53 = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_53_3Tickfunction_3437f4d3c6c4be77(__context__, arg___this, arg__yield_53));
+}
+static vec4f __wrap__Func_lambda_thismodule_53_3Tickfinalizer_d3df2cf3381bf14d ( Context * __context__ ) {
+    _lambda_thismodule_53_3 * arg___this = cast_aot_arg<_lambda_thismodule_53_3 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_53_3Tickfinalizer_d3df2cf3381bf14d(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_72_4Tickfunction_7539be5e5dd855a4 ( Context * __context__ ) {
+    _lambda_thismodule_72_4 &  arg___this = cast_aot_arg<_lambda_thismodule_72_4 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg__yield_72 = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_72_4Tickfunction_7539be5e5dd855a4(__context__, arg___this, arg__yield_72));
+}
+static vec4f __wrap__Func_lambda_thismodule_72_4Tickfinalizer_a86e3e2557e528a ( Context * __context__ ) {
+    _lambda_thismodule_72_4 * arg___this = cast_aot_arg<_lambda_thismodule_72_4 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_72_4Tickfinalizer_a86e3e2557e528a(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_114_5Tickfunction_f810914d808715d4 ( Context * __context__ ) {
+    _lambda_thismodule_114_5 &  arg___this = cast_aot_arg<_lambda_thismodule_114_5 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg__yield_114 = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_114_5Tickfunction_f810914d808715d4(__context__, arg___this, arg__yield_114));
+}
+static vec4f __wrap__Func_lambda_thismodule_114_5Tickfinalizer_89423dad5d46110c ( Context * __context__ ) {
+    _lambda_thismodule_114_5 * arg___this = cast_aot_arg<_lambda_thismodule_114_5 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_114_5Tickfinalizer_89423dad5d46110c(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_125_6Tickfunction_4027e263da479e7b ( Context * __context__ ) {
+    _lambda_thismodule_125_6 &  arg___this = cast_aot_arg<_lambda_thismodule_125_6 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg__yield_125 = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_125_6Tickfunction_4027e263da479e7b(__context__, arg___this, arg__yield_125));
+}
+static vec4f __wrap__Func_lambda_thismodule_125_6Tickfinalizer_fdffc8dda2cd8bfd ( Context * __context__ ) {
+    _lambda_thismodule_125_6 * arg___this = cast_aot_arg<_lambda_thismodule_125_6 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_125_6Tickfinalizer_fdffc8dda2cd8bfd(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_139_7Tickfunction_2c9110595b0e1f9e ( Context * __context__ ) {
+    _lambda_thismodule_139_7 &  arg___this = cast_aot_arg<_lambda_thismodule_139_7 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg__yield_139 = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_139_7Tickfunction_2c9110595b0e1f9e(__context__, arg___this, arg__yield_139));
+}
+static vec4f __wrap__Func_lambda_thismodule_139_7Tickfinalizer_6b38a21a43762671 ( Context * __context__ ) {
+    _lambda_thismodule_139_7 * arg___this = cast_aot_arg<_lambda_thismodule_139_7 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_139_7Tickfinalizer_6b38a21a43762671(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_154_8Tickfunction_7d03daad96022294 ( Context * __context__ ) {
+    _lambda_thismodule_154_8 &  arg___this = cast_aot_arg<_lambda_thismodule_154_8 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg__yield_154 = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_154_8Tickfunction_7d03daad96022294(__context__, arg___this, arg__yield_154));
+}
+static vec4f __wrap__Func_lambda_thismodule_154_8Tickfinalizer_de88ed2911ec7604 ( Context * __context__ ) {
+    _lambda_thismodule_154_8 * arg___this = cast_aot_arg<_lambda_thismodule_154_8 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_154_8Tickfinalizer_de88ed2911ec7604(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_169_9Tickfunction_bee3a1a64100a980 ( Context * __context__ ) {
+    _lambda_thismodule_169_9 &  arg___this = cast_aot_arg<_lambda_thismodule_169_9 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg__yield_169 = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_169_9Tickfunction_bee3a1a64100a980(__context__, arg___this, arg__yield_169));
+}
+static vec4f __wrap__Func_lambda_thismodule_169_9Tickfinalizer_bfa753b76ce69e30 ( Context * __context__ ) {
+    _lambda_thismodule_169_9 * arg___this = cast_aot_arg<_lambda_thismodule_169_9 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_169_9Tickfinalizer_bfa753b76ce69e30(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_182_10Tickfunction_78ecaf31e018c13b ( Context * __context__ ) {
+    _lambda_thismodule_182_10 &  arg___this = cast_aot_arg<_lambda_thismodule_182_10 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg__yield_182 = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_182_10Tickfunction_78ecaf31e018c13b(__context__, arg___this, arg__yield_182));
+}
+static vec4f __wrap__Func_lambda_thismodule_182_10Tickfinalizer_9df84e9703d0ba2d ( Context * __context__ ) {
+    _lambda_thismodule_182_10 * arg___this = cast_aot_arg<_lambda_thismodule_182_10 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_182_10Tickfinalizer_9df84e9703d0ba2d(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_192_11Tickfunction_2f0b774f487a3138 ( Context * __context__ ) {
+    _lambda_thismodule_192_11 &  arg___this = cast_aot_arg<_lambda_thismodule_192_11 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg__yield_192 = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_192_11Tickfunction_2f0b774f487a3138(__context__, arg___this, arg__yield_192));
+}
+static vec4f __wrap__Func_lambda_thismodule_192_11Tickfinalizer_bcfb2cde58f8a884 ( Context * __context__ ) {
+    _lambda_thismodule_192_11 * arg___this = cast_aot_arg<_lambda_thismodule_192_11 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_192_11Tickfinalizer_bcfb2cde58f8a884(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_205_12Tickfunction_519f3f41446d4097 ( Context * __context__ ) {
+    _lambda_thismodule_205_12 &  arg___this = cast_aot_arg<_lambda_thismodule_205_12 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg__yield_205 = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_205_12Tickfunction_519f3f41446d4097(__context__, arg___this, arg__yield_205));
+}
+static vec4f __wrap__Func_lambda_thismodule_205_12Tickfinalizer_94ba58d07fae6869 ( Context * __context__ ) {
+    _lambda_thismodule_205_12 * arg___this = cast_aot_arg<_lambda_thismodule_205_12 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_205_12Tickfinalizer_94ba58d07fae6869(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_218_13Tickfunction_cd23094c5fd49a5c ( Context * __context__ ) {
+    _lambda_thismodule_218_13 &  arg___this = cast_aot_arg<_lambda_thismodule_218_13 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg__yield_218 = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_218_13Tickfunction_cd23094c5fd49a5c(__context__, arg___this, arg__yield_218));
+}
+static vec4f __wrap__Func_lambda_thismodule_218_13Tickfinalizer_a05585ec5e6066cd ( Context * __context__ ) {
+    _lambda_thismodule_218_13 * arg___this = cast_aot_arg<_lambda_thismodule_218_13 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_218_13Tickfinalizer_a05585ec5e6066cd(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_230_14Tickfunction_6560c3b2d05dfc12 ( Context * __context__ ) {
+    _lambda_thismodule_230_14 &  arg___this = cast_aot_arg<_lambda_thismodule_230_14 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg__yield_230 = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_230_14Tickfunction_6560c3b2d05dfc12(__context__, arg___this, arg__yield_230));
+}
+static vec4f __wrap__Func_lambda_thismodule_230_14Tickfinalizer_23619701baa36c54 ( Context * __context__ ) {
+    _lambda_thismodule_230_14 * arg___this = cast_aot_arg<_lambda_thismodule_230_14 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_230_14Tickfinalizer_23619701baa36c54(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_checkIt_1c9204c1ee5241d7 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_gen = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    checkIt_1c9204c1ee5241d7(__context__, arg_gen);
+    return v_zero();
+}
+static vec4f __wrap_test_yield_39f0c31f9832f2e9 ( Context * __context__ ) {
+    test_yield_39f0c31f9832f2e9(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_local_10bd68e4b553d14b ( Context * __context__ ) {
+    test_local_10bd68e4b553d14b(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_local_ref_17967676754257c9 ( Context * __context__ ) {
+    test_local_ref_17967676754257c9(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_if_a14f70d082ff6c54 ( Context * __context__ ) {
+    test_if_a14f70d082ff6c54(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_while_70c3a7012b0d1604 ( Context * __context__ ) {
+    test_while_70c3a7012b0d1604(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_while_break_146e21bbf081db20 ( Context * __context__ ) {
+    test_while_break_146e21bbf081db20(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_while_continue_8bf6c0076928fcc7 ( Context * __context__ ) {
+    test_while_continue_8bf6c0076928fcc7(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_while_nested_dbf9b4eaab73834a ( Context * __context__ ) {
+    test_while_nested_dbf9b4eaab73834a(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_while_finally_7d0cb74129577f21 ( Context * __context__ ) {
+    test_while_finally_7d0cb74129577f21(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_for_c4a5441fe8bda34f ( Context * __context__ ) {
+    test_for_c4a5441fe8bda34f(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_for_break_a8389572add3637f ( Context * __context__ ) {
+    test_for_break_a8389572add3637f(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_for_continue_5ac3b1dc14c48cbe ( Context * __context__ ) {
+    test_for_continue_5ac3b1dc14c48cbe(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_for_nested_6c30bda4247e35e6 ( Context * __context__ ) {
+    test_for_nested_6c30bda4247e35e6(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_for_finally_d7e3d2c3baee7838 ( Context * __context__ ) {
+    test_for_finally_d7e3d2c3baee7838(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_9da455592865df24 ( Context * __context__ ) {
+    return cast<bool>::from(test_9da455592865df24(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xf426d9532c77b0a4, true, (void*)&_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015, &__wrap__FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 },
+    { 0xe90ffc4402ceebd2, false, (void*)&finalize_23807cbeaf2d734f, &__wrap_finalize_23807cbeaf2d734f },
+    { 0x4bd6a1c5463c247c, false, (void*)&finalize_4174be89bcf8dc58, &__wrap_finalize_4174be89bcf8dc58 },
+    { 0x39752e0a6d5efe8f, false, (void*)&finalize_b36c5385f838dbe0, &__wrap_finalize_b36c5385f838dbe0 },
+    { 0x2fb1e25a49f3ba62, false, (void*)&finalize_fa956870919eb1a0, &__wrap_finalize_fa956870919eb1a0 },
+    { 0xcd9e4a0986bd1573, false, (void*)&finalize_c89df058cdbff3af, &__wrap_finalize_c89df058cdbff3af },
+    { 0xadd5ba0ad3a2e635, false, (void*)&finalize_ce147f9a8f78b2c5, &__wrap_finalize_ce147f9a8f78b2c5 },
+    { 0x5c80bd16f5ea474b, false, (void*)&finalize_e7d035560e04b267, &__wrap_finalize_e7d035560e04b267 },
+    { 0x4040bef2beab36f5, false, (void*)&finalize_dfbaf278d0146157, &__wrap_finalize_dfbaf278d0146157 },
+    { 0x76d39084a637074, false, (void*)&finalize_b20a33487d1b2fa8, &__wrap_finalize_b20a33487d1b2fa8 },
+    { 0x71f41b85e53d2c9b, false, (void*)&finalize_c77af243d2194d02, &__wrap_finalize_c77af243d2194d02 },
+    { 0xa7808567e5b55559, false, (void*)&finalize_b031a58c24501ea6, &__wrap_finalize_b031a58c24501ea6 },
+    { 0xbd04a5e933c71112, false, (void*)&finalize_854fde60d8156dc9, &__wrap_finalize_854fde60d8156dc9 },
+    { 0x85d7d08fd33b688a, false, (void*)&finalize_cc067bb3d5c32e9b, &__wrap_finalize_cc067bb3d5c32e9b },
+    { 0x5b6a567962e991ae, false, (void*)&finalize_60d805ae843389b2, &__wrap_finalize_60d805ae843389b2 },
+    { 0x7614b8dfa541d29f, true, (void*)&_FuncbuiltinTickeachTick9663565701927713696_c091e829e5353c5d, &__wrap__FuncbuiltinTickeachTick9663565701927713696_c091e829e5353c5d },
+    { 0x48082defa65807d0, false, (void*)&_Func_lambda_thismodule_18_1Tickfunction_4cb32a58c5278517, &__wrap__Func_lambda_thismodule_18_1Tickfunction_4cb32a58c5278517 },
+    { 0xb882d0d3a5ce5f7f, false, (void*)&_Func_lambda_thismodule_18_1Tickfinalizer_4b17d16fe590d56b, &__wrap__Func_lambda_thismodule_18_1Tickfinalizer_4b17d16fe590d56b },
+    { 0x9d1ee20ef2e33bce, false, (void*)&_Func_lambda_thismodule_35_2Tickfunction_58b31a4cb7e74e03, &__wrap__Func_lambda_thismodule_35_2Tickfunction_58b31a4cb7e74e03 },
+    { 0xd19a1cee149ac6c8, false, (void*)&_Func_lambda_thismodule_35_2Tickfinalizer_abe387b19b43b901, &__wrap__Func_lambda_thismodule_35_2Tickfinalizer_abe387b19b43b901 },
+    { 0x784ec4f3de400248, false, (void*)&_Func_lambda_thismodule_53_3Tickfunction_3437f4d3c6c4be77, &__wrap__Func_lambda_thismodule_53_3Tickfunction_3437f4d3c6c4be77 },
+    { 0xc49d35d4cef45cdd, false, (void*)&_Func_lambda_thismodule_53_3Tickfinalizer_d3df2cf3381bf14d, &__wrap__Func_lambda_thismodule_53_3Tickfinalizer_d3df2cf3381bf14d },
+    { 0x286b343ef429d95f, false, (void*)&_Func_lambda_thismodule_72_4Tickfunction_7539be5e5dd855a4, &__wrap__Func_lambda_thismodule_72_4Tickfunction_7539be5e5dd855a4 },
+    { 0x5e38bc510f773ddc, false, (void*)&_Func_lambda_thismodule_72_4Tickfinalizer_a86e3e2557e528a, &__wrap__Func_lambda_thismodule_72_4Tickfinalizer_a86e3e2557e528a },
+    { 0x25e6335122685979, false, (void*)&_Func_lambda_thismodule_114_5Tickfunction_f810914d808715d4, &__wrap__Func_lambda_thismodule_114_5Tickfunction_f810914d808715d4 },
+    { 0x8235e798d66cf5c2, false, (void*)&_Func_lambda_thismodule_114_5Tickfinalizer_89423dad5d46110c, &__wrap__Func_lambda_thismodule_114_5Tickfinalizer_89423dad5d46110c },
+    { 0x13ccc228920a570, false, (void*)&_Func_lambda_thismodule_125_6Tickfunction_4027e263da479e7b, &__wrap__Func_lambda_thismodule_125_6Tickfunction_4027e263da479e7b },
+    { 0x7cca67e8e601cb78, false, (void*)&_Func_lambda_thismodule_125_6Tickfinalizer_fdffc8dda2cd8bfd, &__wrap__Func_lambda_thismodule_125_6Tickfinalizer_fdffc8dda2cd8bfd },
+    { 0xe59e97889aa92c99, false, (void*)&_Func_lambda_thismodule_139_7Tickfunction_2c9110595b0e1f9e, &__wrap__Func_lambda_thismodule_139_7Tickfunction_2c9110595b0e1f9e },
+    { 0x1b94e3d90ea3ea21, false, (void*)&_Func_lambda_thismodule_139_7Tickfinalizer_6b38a21a43762671, &__wrap__Func_lambda_thismodule_139_7Tickfinalizer_6b38a21a43762671 },
+    { 0x74da56fbb6910501, false, (void*)&_Func_lambda_thismodule_154_8Tickfunction_7d03daad96022294, &__wrap__Func_lambda_thismodule_154_8Tickfunction_7d03daad96022294 },
+    { 0xa606530fe1fe093, false, (void*)&_Func_lambda_thismodule_154_8Tickfinalizer_de88ed2911ec7604, &__wrap__Func_lambda_thismodule_154_8Tickfinalizer_de88ed2911ec7604 },
+    { 0xa000be0baefffde2, false, (void*)&_Func_lambda_thismodule_169_9Tickfunction_bee3a1a64100a980, &__wrap__Func_lambda_thismodule_169_9Tickfunction_bee3a1a64100a980 },
+    { 0xa804779678d1911d, false, (void*)&_Func_lambda_thismodule_169_9Tickfinalizer_bfa753b76ce69e30, &__wrap__Func_lambda_thismodule_169_9Tickfinalizer_bfa753b76ce69e30 },
+    { 0xc4fb4761ccb83b37, false, (void*)&_Func_lambda_thismodule_182_10Tickfunction_78ecaf31e018c13b, &__wrap__Func_lambda_thismodule_182_10Tickfunction_78ecaf31e018c13b },
+    { 0x4308eca080e373a6, false, (void*)&_Func_lambda_thismodule_182_10Tickfinalizer_9df84e9703d0ba2d, &__wrap__Func_lambda_thismodule_182_10Tickfinalizer_9df84e9703d0ba2d },
+    { 0xc337c1bf0ad49660, false, (void*)&_Func_lambda_thismodule_192_11Tickfunction_2f0b774f487a3138, &__wrap__Func_lambda_thismodule_192_11Tickfunction_2f0b774f487a3138 },
+    { 0x595da5f85c47dddc, false, (void*)&_Func_lambda_thismodule_192_11Tickfinalizer_bcfb2cde58f8a884, &__wrap__Func_lambda_thismodule_192_11Tickfinalizer_bcfb2cde58f8a884 },
+    { 0x1c355f88dc6fd208, false, (void*)&_Func_lambda_thismodule_205_12Tickfunction_519f3f41446d4097, &__wrap__Func_lambda_thismodule_205_12Tickfunction_519f3f41446d4097 },
+    { 0x8123eb4dec3f14b8, false, (void*)&_Func_lambda_thismodule_205_12Tickfinalizer_94ba58d07fae6869, &__wrap__Func_lambda_thismodule_205_12Tickfinalizer_94ba58d07fae6869 },
+    { 0xde8c6b5831386d1, false, (void*)&_Func_lambda_thismodule_218_13Tickfunction_cd23094c5fd49a5c, &__wrap__Func_lambda_thismodule_218_13Tickfunction_cd23094c5fd49a5c },
+    { 0x2b38154c7a48023e, false, (void*)&_Func_lambda_thismodule_218_13Tickfinalizer_a05585ec5e6066cd, &__wrap__Func_lambda_thismodule_218_13Tickfinalizer_a05585ec5e6066cd },
+    { 0x551ed7135ba380bb, false, (void*)&_Func_lambda_thismodule_230_14Tickfunction_6560c3b2d05dfc12, &__wrap__Func_lambda_thismodule_230_14Tickfunction_6560c3b2d05dfc12 },
+    { 0x9d4f46e2cead85ea, false, (void*)&_Func_lambda_thismodule_230_14Tickfinalizer_23619701baa36c54, &__wrap__Func_lambda_thismodule_230_14Tickfinalizer_23619701baa36c54 },
+    { 0xa39d9bf524073520, false, (void*)&checkIt_1c9204c1ee5241d7, &__wrap_checkIt_1c9204c1ee5241d7 },
+    { 0x45215acb82eaec89, false, (void*)&test_yield_39f0c31f9832f2e9, &__wrap_test_yield_39f0c31f9832f2e9 },
+    { 0xa09cd1dfb224953f, false, (void*)&test_local_10bd68e4b553d14b, &__wrap_test_local_10bd68e4b553d14b },
+    { 0xbeedae4ee4d9266e, false, (void*)&test_local_ref_17967676754257c9, &__wrap_test_local_ref_17967676754257c9 },
+    { 0xc6125e1eaae162f0, false, (void*)&test_if_a14f70d082ff6c54, &__wrap_test_if_a14f70d082ff6c54 },
+    { 0x2b575a36026f1d42, false, (void*)&test_while_70c3a7012b0d1604, &__wrap_test_while_70c3a7012b0d1604 },
+    { 0xeded95145ebac44f, false, (void*)&test_while_break_146e21bbf081db20, &__wrap_test_while_break_146e21bbf081db20 },
+    { 0x69b42fa0268b8776, false, (void*)&test_while_continue_8bf6c0076928fcc7, &__wrap_test_while_continue_8bf6c0076928fcc7 },
+    { 0xe650638f1d6a4f90, false, (void*)&test_while_nested_dbf9b4eaab73834a, &__wrap_test_while_nested_dbf9b4eaab73834a },
+    { 0x7d3e3b5cebf008e6, false, (void*)&test_while_finally_7d0cb74129577f21, &__wrap_test_while_finally_7d0cb74129577f21 },
+    { 0x245a8adfbda1c6f3, false, (void*)&test_for_c4a5441fe8bda34f, &__wrap_test_for_c4a5441fe8bda34f },
+    { 0xe3ad9c1654efa7ec, false, (void*)&test_for_break_a8389572add3637f, &__wrap_test_for_break_a8389572add3637f },
+    { 0x9e4cb8ff07f29c3d, false, (void*)&test_for_continue_5ac3b1dc14c48cbe, &__wrap_test_for_continue_5ac3b1dc14c48cbe },
+    { 0x9cf6da6dac48d048, false, (void*)&test_for_nested_6c30bda4247e35e6, &__wrap_test_for_nested_6c30bda4247e35e6 },
+    { 0x722f2072193d0268, false, (void*)&test_for_finally_d7e3d2c3baee7838, &__wrap_test_for_finally_d7e3d2c3baee7838 },
+    { 0xcaa48a1753f13f98, false, (void*)&test_9da455592865df24, &__wrap_test_9da455592865df24 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_9684368476840233687
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,249 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_16373556124062245071 {
+
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__b8d4477a5991973e;
+extern TypeInfo __type_info__af63ee4c86020b22;
+
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__b8d4477a5991973e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63ee4c86020b22, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 24, UINT64_C(0xb8d4477a5991973e) };
+TypeInfo __type_info__af63ee4c86020b22 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0xaf63ee4c86020b22) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__b8d4477a5991973e, &__type_info__af90fe4c864e9d52 };
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009 ( Context * __context__, TArray<char *> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline TArray<char *> & _FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a5393f36ccdac4a8 ( Context * __context__, TArray<char *> & __a_rename_at_50_2 );
+inline TArray<char *> _FuncbuiltinTickcloneTick11959574996696666426_d0378ccaa3f928eb ( Context * __context__, TArray<char *> const  & __clone_src_rename_at_1073_3 );
+inline void _FuncbuiltinTickcloneTick3038771811667655495_9f2e131d440bca94 ( Context * __context__, TArray<char *> & __a_rename_at_1142_5, TArray<char *> const  & __b_rename_at_1142_6 );
+inline TArray<char *> _FuncbuiltinTickcloneTick6765341263807845353_bd2c9a912c6c67a5 ( Context * __context__, TArray<char *> & __clone_src_rename_at_1082_12 );
+inline TArray<char *> test_a_206647d353a583f6 ( Context * __context__ );
+inline TArray<char *> test_0_d71e8ed5b9b0cec2 ( Context * __context__ );
+inline bool test_b67965a0274f7c37 ( Context * __context__ );
+inline TArray<char *> _FuncbuiltinTickto_array_moveTick3185538323411982277_7bcf9746c1f1b7c6 ( Context * __context__, TDim<char *,1> & __a_rename_at_1502_14 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    TDim<char *,1> _temp_make_local_3_15_0;
+    das_global<TArray<char *>,0x8b7e1b5b3cf946e4>(__context__) = _FuncbuiltinTickto_array_moveTick3185538323411982277_7bcf9746c1f1b7c6(__context__,das_arg<TDim<char *,1>>::pass((([&]() -> TDim<char *,1>& {
+        _temp_make_local_3_15_0(0,__context__) = ((char *) "test");
+        return _temp_make_local_3_15_0;
+    })())));/*some_a*/
+    das_global<TArray<char *>,0x93f8d185a334ce05>(__context__) = test_a_206647d353a583f6(__context__);/*some_0*/
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009 ( Context * __context__, TArray<char *> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline TArray<char *> & _FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a5393f36ccdac4a8 ( Context * __context__, TArray<char *> &  __a_rename_at_50_2 )
+{
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<TArray<char *> &>::from(__a_rename_at_50_2),cast<char * const >::from(((char *) "object can't be returned because it is locked"))));
+    return das_auto_cast_ref<TArray<char *> &>::cast(__a_rename_at_50_2);
+}
+
+inline TArray<char *> _FuncbuiltinTickcloneTick11959574996696666426_d0378ccaa3f928eb ( Context * __context__, TArray<char *> const  &  __clone_src_rename_at_1073_3 )
+{
+    TArray<char *> __clone_dest_rename_at_1075_4;das_zero(__clone_dest_rename_at_1075_4);
+    _FuncbuiltinTickcloneTick3038771811667655495_9f2e131d440bca94(__context__,das_arg<TArray<char *>>::pass(__clone_dest_rename_at_1075_4),__clone_src_rename_at_1073_3);
+    return /* <- */ das_auto_cast_move<TArray<char *>>::cast(__clone_dest_rename_at_1075_4);
+}
+
+inline void _FuncbuiltinTickcloneTick3038771811667655495_9f2e131d440bca94 ( Context * __context__, TArray<char *> &  __a_rename_at_1142_5, TArray<char *> const  &  __b_rename_at_1142_6 )
+{
+    int32_t __ln_rename_at_1143_7 = ((int32_t)builtin_array_size(__b_rename_at_1142_6));
+    _FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009(__context__,das_arg<TArray<char *>>::pass(__a_rename_at_1142_5),__ln_rename_at_1143_7);
+    if ( __ln_rename_at_1143_7 == 0 )
+    {
+        return ;
+    } else {
+        {
+            bool __need_loop_1153 = true;
+            // aV: string aka TT&
+            das_iterator<TArray<char *>> __aV_iterator(__a_rename_at_1142_5);
+            char * * __aV_rename_at_1153_10;
+            __need_loop_1153 = __aV_iterator.first(__context__,(__aV_rename_at_1153_10)) && __need_loop_1153;
+            // bV: string aka TT const&
+            das_iterator<TArray<char *> const > __bV_iterator(__b_rename_at_1142_6);
+            char * const  * __bV_rename_at_1153_11;
+            __need_loop_1153 = __bV_iterator.first(__context__,(__bV_rename_at_1153_11)) && __need_loop_1153;
+            for ( ; __need_loop_1153 ; __need_loop_1153 = __aV_iterator.next(__context__,(__aV_rename_at_1153_10)) && __bV_iterator.next(__context__,(__bV_rename_at_1153_11)) )
+            {
+                das_copy((*__aV_rename_at_1153_10),(*__bV_rename_at_1153_11));
+            }
+            __bV_iterator.close(__context__,(__bV_rename_at_1153_11));
+            __aV_iterator.close(__context__,(__aV_rename_at_1153_10));
+        };
+    };
+}
+
+inline TArray<char *> _FuncbuiltinTickcloneTick6765341263807845353_bd2c9a912c6c67a5 ( Context * __context__, TArray<char *> &  __clone_src_rename_at_1082_12 )
+{
+    TArray<char *> __clone_dest_rename_at_1084_13;das_zero(__clone_dest_rename_at_1084_13);
+    _FuncbuiltinTickcloneTick3038771811667655495_9f2e131d440bca94(__context__,das_arg<TArray<char *>>::pass(__clone_dest_rename_at_1084_13),das_arg<TArray<char *>>::pass(__clone_src_rename_at_1082_12));
+    return /* <- */ das_auto_cast_move<TArray<char *>>::cast(__clone_dest_rename_at_1084_13);
+}
+
+inline TArray<char *> test_a_206647d353a583f6 ( Context * __context__ )
+{
+    TArray<char *> _temp_make_local_8_14_1; _temp_make_local_8_14_1;
+    DAS_ASSERT((builtin_array_size(das_arg<TArray<char *>>::pass(das_global<TArray<char *>,0x8b7e1b5b3cf946e4>(__context__) /*some_a*/)) == 1));
+    return /* <- */ das_auto_cast_move<TArray<char *>>::cast(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a5393f36ccdac4a8(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_8_14_1 = (_FuncbuiltinTickcloneTick6765341263807845353_bd2c9a912c6c67a5(__context__,das_arg<TArray<char *>>::pass(das_global<TArray<char *>,0x8b7e1b5b3cf946e4>(__context__) /*some_a*/)))))));
+}
+
+inline TArray<char *> test_0_d71e8ed5b9b0cec2 ( Context * __context__ )
+{
+    TArray<char *> _temp_make_local_16_14_2; _temp_make_local_16_14_2;
+    return /* <- */ das_auto_cast_move<TArray<char *>>::cast(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a5393f36ccdac4a8(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_16_14_2 = (_FuncbuiltinTickcloneTick11959574996696666426_d0378ccaa3f928eb(__context__,das_global<TArray<char *>,0x93f8d185a334ce05>(__context__) /*some_0*/))))));
+}
+
+inline bool test_b67965a0274f7c37 ( Context * __context__ )
+{
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline TArray<char *> _FuncbuiltinTickto_array_moveTick3185538323411982277_7bcf9746c1f1b7c6 ( Context * __context__, TDim<char *,1> &  __a_rename_at_1502_14 )
+{
+    TArray<char *> __arr_rename_at_1504_15;das_zero(__arr_rename_at_1504_15);
+    _FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_1504_15),1);
+    das_copy(das_cast<TDim<char *,1>>::cast(das_ref(__context__,__arr_rename_at_1504_15(0,__context__))),__a_rename_at_1502_14);
+    return /* <- */ das_auto_cast_move<TArray<char *>>::cast(__arr_rename_at_1504_15);
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009 ( Context * __context__ ) {
+    TArray<char *> &  arg_Arr = cast_aot_arg<TArray<char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a5393f36ccdac4a8 ( Context * __context__ ) {
+    TArray<char *> &  arg_a = cast_aot_arg<TArray<char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<TArray<char *> &>::from(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a5393f36ccdac4a8(__context__, arg_a));
+}
+static vec4f __wrap__FuncbuiltinTickcloneTick11959574996696666426_d0378ccaa3f928eb ( Context * __context__ ) {
+    TArray<char *> const  &  arg_clone_src = cast_aot_arg<TArray<char *> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<char *> *) __context__->abiCMRES) = _FuncbuiltinTickcloneTick11959574996696666426_d0378ccaa3f928eb(__context__, arg_clone_src);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickcloneTick3038771811667655495_9f2e131d440bca94 ( Context * __context__ ) {
+    TArray<char *> &  arg_a = cast_aot_arg<TArray<char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<char *> const  &  arg_b = cast_aot_arg<TArray<char *> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickcloneTick3038771811667655495_9f2e131d440bca94(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickcloneTick6765341263807845353_bd2c9a912c6c67a5 ( Context * __context__ ) {
+    TArray<char *> &  arg_clone_src = cast_aot_arg<TArray<char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<char *> *) __context__->abiCMRES) = _FuncbuiltinTickcloneTick6765341263807845353_bd2c9a912c6c67a5(__context__, arg_clone_src);
+    return v_zero();
+}
+static vec4f __wrap_test_a_206647d353a583f6 ( Context * __context__ ) {
+    *((TArray<char *> *) __context__->abiCMRES) = test_a_206647d353a583f6(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_0_d71e8ed5b9b0cec2 ( Context * __context__ ) {
+    *((TArray<char *> *) __context__->abiCMRES) = test_0_d71e8ed5b9b0cec2(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_b67965a0274f7c37 ( Context * __context__ ) {
+    return cast<bool>::from(test_b67965a0274f7c37(__context__));
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_7bcf9746c1f1b7c6 ( Context * __context__ ) {
+    TDim<char *,1> &  arg_a = cast_aot_arg<TDim<char *,1> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<char *> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_7bcf9746c1f1b7c6(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xedd3c4f89cba620e, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009 },
+    { 0xb2aa7c99cd110c66, false, (void*)&_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a5393f36ccdac4a8, &__wrap__FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a5393f36ccdac4a8 },
+    { 0xa1cc3f15d58a5bc4, true, (void*)&_FuncbuiltinTickcloneTick11959574996696666426_d0378ccaa3f928eb, &__wrap__FuncbuiltinTickcloneTick11959574996696666426_d0378ccaa3f928eb },
+    { 0xce28da71cae8751b, false, (void*)&_FuncbuiltinTickcloneTick3038771811667655495_9f2e131d440bca94, &__wrap__FuncbuiltinTickcloneTick3038771811667655495_9f2e131d440bca94 },
+    { 0x1b89422d37e38987, true, (void*)&_FuncbuiltinTickcloneTick6765341263807845353_bd2c9a912c6c67a5, &__wrap__FuncbuiltinTickcloneTick6765341263807845353_bd2c9a912c6c67a5 },
+    { 0x1bf690d8f9c38934, true, (void*)&test_a_206647d353a583f6, &__wrap_test_a_206647d353a583f6 },
+    { 0x886fc83ab3a2de0b, true, (void*)&test_0_d71e8ed5b9b0cec2, &__wrap_test_0_d71e8ed5b9b0cec2 },
+    { 0xa2406473ca14fc41, false, (void*)&test_b67965a0274f7c37, &__wrap_test_b67965a0274f7c37 },
+    { 0x28015747a7cfc085, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_7bcf9746c1f1b7c6, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_7bcf9746c1f1b7c6 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x5f37b8c1dc63a10e, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_16373556124062245071
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,284 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_17459335899258591676 {
+
+namespace  { struct Foo; };
+namespace  { struct TestObjectFooNative; };
+namespace  { struct TestObjectBarNative; };
+// unused enumeration GooEnum
+// unused enumeration OpCode
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+namespace  {
+
+struct Foo {
+    int32_t a;
+    int32_t b;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct TestObjectFooNative {
+    int32_t fooData;
+};
+static_assert(sizeof(TestObjectFooNative)==4,"structure size mismatch with DAS");
+static_assert(offsetof(TestObjectFooNative,fooData)==0,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct TestObjectBarNative {
+    TestObjectFooNative * fooPtr;
+    float barData;
+};
+static_assert(sizeof(TestObjectBarNative)==16,"structure size mismatch with DAS");
+static_assert(offsetof(TestObjectBarNative,fooPtr)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestObjectBarNative,barData)==8,"structure field offset mismatch with DAS");
+}
+extern TypeInfo __type_info__75672eeaf12b9a7a;
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__4e22b7494d9e38fe;
+
+TypeInfo __type_info__75672eeaf12b9a7a = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__4e22b7494d9e38fe, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x75672eeaf12b9a7a) };
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__4e22b7494d9e38fe = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~UnitTest::FancyClass"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 40, UINT64_C(0x4e22b7494d9e38fe) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {__type_info__4e22b7494d9e38fe, };
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[3] = { &__type_info__af90fe4c864e9d52, &__type_info__75672eeaf12b9a7a, &__type_info__af90fe4c864e9d52 };
+
+inline void test_native_ea544b1235b2f1e0 ( Context * __context__ );
+inline void test_handled_54a11759f3d0cf20 ( Context * __context__ );
+inline void test_fancy_container_52e8fe93973493c7 ( Context * __context__, TArray<FancyClass> & __a_rename_at_81_8 );
+inline void test_fancy_9db4fc01ed24b249 ( Context * __context__ );
+inline void test_nc_alias_429262dde81002a4 ( Context * __context__ );
+inline bool test_749c2552f9b67ce8 ( Context * __context__ );
+inline Foo Foo_78374295e080f2d0 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void test_native_ea544b1235b2f1e0 ( Context * __context__ )
+{
+    TestObjectFooNative * __a_rename_at_23_0 = 0;
+    TestObjectBarNative * __b_rename_at_24_1 = 0;
+    int32_t __idummy_rename_at_25_2 = 0;
+    float __fdummy_rename_at_26_3 = 0;
+    das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation<TestObjectFooNative,int32_t,&TestObjectFooNative::fooData>::get(__a_rename_at_23_0),__idummy_rename_at_25_2),1);
+    DAS_ASSERT((__idummy_rename_at_25_2 == 1));
+    das_copy(__a_rename_at_23_0,das_new<TestObjectFooNative>::make(__context__));
+    das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation<TestObjectFooNative,int32_t,&TestObjectFooNative::fooData>::get(__a_rename_at_23_0),__idummy_rename_at_25_2),2);
+    DAS_ASSERT(((__a_rename_at_23_0->fooData == 2) && (__idummy_rename_at_25_2 == 1)));
+    das_copy(das_null_coalescing<float &>::get(das_safe_navigation<TestObjectBarNative,float,&TestObjectBarNative::barData>::get(__b_rename_at_24_1),__fdummy_rename_at_26_3),1.000000e+00f);
+    DAS_ASSERT((__fdummy_rename_at_26_3 == 1.000000e+00f));
+    das_copy(__b_rename_at_24_1,das_new<TestObjectBarNative>::make(__context__));
+    das_copy(das_null_coalescing<float &>::get(das_safe_navigation<TestObjectBarNative,float,&TestObjectBarNative::barData>::get(__b_rename_at_24_1),__fdummy_rename_at_26_3),2.000000e+00f);
+    DAS_ASSERT(((__b_rename_at_24_1->barData == 2.000000e+00f) && (__fdummy_rename_at_26_3 == 1.000000e+00f)));
+    das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation<TestObjectFooNative,int32_t,&TestObjectFooNative::fooData>::get(das_safe_navigation_ptr<TestObjectBarNative,TestObjectFooNative *,&TestObjectBarNative::fooPtr>::get(__b_rename_at_24_1)),__idummy_rename_at_25_2),3);
+    DAS_ASSERT((__idummy_rename_at_25_2 == 3));
+    das_copy(__b_rename_at_24_1->fooPtr,__a_rename_at_23_0);
+    das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation<TestObjectFooNative,int32_t,&TestObjectFooNative::fooData>::get(das_safe_navigation_ptr<TestObjectBarNative,TestObjectFooNative *,&TestObjectBarNative::fooPtr>::get(__b_rename_at_24_1)),__idummy_rename_at_25_2),4);
+    DAS_ASSERT(((__b_rename_at_24_1->fooPtr->fooData == 4) && (__idummy_rename_at_25_2 == 3)));
+}
+
+inline void test_handled_54a11759f3d0cf20 ( Context * __context__ )
+{
+    TestObjectFoo * __a_rename_at_46_4 = 0;
+    TestObjectBar * __b_rename_at_47_5 = 0;
+    int32_t __idummy_rename_at_48_6 = 0;
+    float __fdummy_rename_at_49_7 = 0;
+    das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation_handle<TestObjectFoo,int32_t>::get(__a_rename_at_46_4,([&](const TestObjectFoo * __any) -> auto & {return __any->fooData /*fooData*/;})),__idummy_rename_at_48_6),1);
+    DAS_ASSERT((__idummy_rename_at_48_6 == 1));
+    das_copy(__a_rename_at_46_4,das_new_handle<TestObjectFoo,false>::make(__context__));
+    das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation_handle<TestObjectFoo,int32_t>::get(__a_rename_at_46_4,([&](const TestObjectFoo * __any) -> auto & {return __any->fooData /*fooData*/;})),__idummy_rename_at_48_6),2);
+    DAS_ASSERT(((__a_rename_at_46_4->fooData /*fooData*/ == 2) && (__idummy_rename_at_48_6 == 1)));
+    das_copy(das_null_coalescing<float &>::get(das_safe_navigation_handle<TestObjectBar,float>::get(__b_rename_at_47_5,([&](const TestObjectBar * __any) -> auto & {return __any->barData /*barData*/;})),__fdummy_rename_at_49_7),1.000000e+00f);
+    DAS_ASSERT((__fdummy_rename_at_49_7 == 1.000000e+00f));
+    das_copy(__b_rename_at_47_5,das_new_handle<TestObjectBar,false>::make(__context__));
+    das_copy(das_null_coalescing<float &>::get(das_safe_navigation_handle<TestObjectBar,float>::get(__b_rename_at_47_5,([&](const TestObjectBar * __any) -> auto & {return __any->barData /*barData*/;})),__fdummy_rename_at_49_7),2.000000e+00f);
+    DAS_ASSERT(((__b_rename_at_47_5->barData /*barData*/ == 2.000000e+00f) && (__fdummy_rename_at_49_7 == 1.000000e+00f)));
+    das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation_handle<TestObjectFoo,int32_t>::get(das_safe_navigation_handle_ptr<TestObjectBar,TestObjectFoo *>::get(__b_rename_at_47_5,([&](const TestObjectBar * __any) -> auto & {return __any->fooPtr /*fooPtr*/;})),([&](const TestObjectFoo * __any) -> auto & {return __any->fooData /*fooData*/;})),__idummy_rename_at_48_6),3);
+    DAS_ASSERT((__idummy_rename_at_48_6 == 3));
+    das_copy(__b_rename_at_47_5->fooPtr /*fooPtr*/,__a_rename_at_46_4);
+    das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation_handle<TestObjectFoo,int32_t>::get(das_safe_navigation_handle_ptr<TestObjectBar,TestObjectFoo *>::get(__b_rename_at_47_5,([&](const TestObjectBar * __any) -> auto & {return __any->fooPtr /*fooPtr*/;})),([&](const TestObjectFoo * __any) -> auto & {return __any->fooData /*fooData*/;})),__idummy_rename_at_48_6),4);
+    DAS_ASSERT(((__b_rename_at_47_5->fooPtr /*fooPtr*/->fooData /*fooData*/ == 4) && (__idummy_rename_at_48_6 == 3)));
+    das_copy(__a_rename_at_46_4->fooData /*fooData*/,7);
+    DAS_ASSERT((((das_deref(__context__,__a_rename_at_46_4,__FILE__,__LINE__)).propAdd13()) == 20));
+    DAS_ASSERT((((das_deref(__context__,__b_rename_at_47_5,__FILE__,__LINE__)).getFoo()).fooData /*fooData*/ == 7));
+    DAS_ASSERT((das_deref(__context__,((das_deref(__context__,__b_rename_at_47_5,__FILE__,__LINE__)).getFooPtr()),__FILE__,__LINE__).fooData /*fooData*/ == 7));
+    DAS_ASSERT((das_equ(das_arg<TestObjectFoo>::pass(das_deref(__context__,__a_rename_at_46_4,__FILE__,__LINE__)),das_arg<TestObjectFoo>::pass(das_deref(__context__,__b_rename_at_47_5->fooPtr /*fooPtr*/,__FILE__,__LINE__)))));
+    DAS_ASSERT((!(das_nequ(das_arg<TestObjectFoo>::pass(das_deref(__context__,__a_rename_at_46_4,__FILE__,__LINE__)),das_arg<TestObjectFoo>::pass(das_deref(__context__,__b_rename_at_47_5->fooPtr /*fooPtr*/,__FILE__,__LINE__))))));
+    das_call_member< DAS_BIND_MEMBER_FUN(TestObjectFoo::hitMe)>::invoke(das_arg<TestObjectFoo>::pass(das_deref(__context__,__a_rename_at_46_4,__FILE__,__LINE__)),1,2);
+    DAS_ASSERT((__a_rename_at_46_4->fooData /*fooData*/ == 3));
+    das_delete_handle<TestObjectFoo *>::clear(__context__,__a_rename_at_46_4);
+    das_delete_handle<TestObjectBar *>::clear(__context__,__b_rename_at_47_5);
+}
+
+inline void test_fancy_container_52e8fe93973493c7 ( Context * __context__, TArray<FancyClass> &  __a_rename_at_81_8 )
+{
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<3>(__tinfo_0, cast<char * const >::from(((char *) "a = ")), cast<TArray<FancyClass> &>::from(__a_rename_at_81_8), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void test_fancy_9db4fc01ed24b249 ( Context * __context__ )
+{
+    FancyClass __fc0_rename_at_86_9 = /*c-tor*/ FancyClass(/*end-c-tor*/);
+    DAS_ASSERT((__fc0_rename_at_86_9.value /*value*/ == 13));
+    FancyClass __fc_rename_at_88_10 = FancyClass(1,2);
+    DAS_ASSERT((__fc_rename_at_88_10.value /*value*/ == 3));
+    das_using<FancyClass>::use([&](FancyClass & __f_rename_at_90_11) DAS_AOT_INLINE_LAMBDA -> void{
+        DAS_ASSERT((__f_rename_at_90_11.value /*value*/ == 13));
+    });
+    das_using<FancyClass>::use(1,3,[&](FancyClass & __f_rename_at_93_12) DAS_AOT_INLINE_LAMBDA -> void{
+        DAS_ASSERT((__f_rename_at_93_12.value /*value*/ == 4));
+    });
+    deleteFancyClassDummy(das_arg<FancyClass>::pass(__fc0_rename_at_86_9));
+    deleteFancyClassDummy(das_arg<FancyClass>::pass(__fc_rename_at_88_10));
+}
+
+inline void test_nc_alias_429262dde81002a4 ( Context * __context__ )
+{
+    TestObjectFoo * __lookingAt_rename_at_102_13 = das_new_handle<TestObjectFoo,false>::make(__context__);
+    float3 __lookPos_rename_at_103_14 = das_alias<Point3>::from(das_alias<Point3>::from(das_null_coalescing<float3>::get((float3 *)__lookingAt_rename_at_102_13->lookAt /*lookAt*/,v_zero())));
+    DAS_ASSERT((SimPolicy<float3>::Equ(__lookPos_rename_at_103_14,v_zero(),*__context__,nullptr)));
+    das_delete_handle<TestObjectFoo *>::clear(__context__,__lookingAt_rename_at_102_13);
+}
+
+inline bool test_749c2552f9b67ce8 ( Context * __context__ )
+{
+    test_native_ea544b1235b2f1e0(__context__);
+    test_handled_54a11759f3d0cf20(__context__);
+    test_fancy_9db4fc01ed24b249(__context__);
+    test_nc_alias_429262dde81002a4(__context__);
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline Foo Foo_78374295e080f2d0 ( Context * __context__ )
+{
+    return /* <- */ das_auto_cast_move<Foo>::cast((([&]() -> Foo {
+        Foo __mks_7;
+        das_copy((__mks_7.a),(1));
+        das_copy((__mks_7.b),(15));
+        return __mks_7;
+    })()));
+}
+static vec4f __wrap_test_native_ea544b1235b2f1e0 ( Context * __context__ ) {
+    test_native_ea544b1235b2f1e0(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_handled_54a11759f3d0cf20 ( Context * __context__ ) {
+    test_handled_54a11759f3d0cf20(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_fancy_container_52e8fe93973493c7 ( Context * __context__ ) {
+    TArray<FancyClass> &  arg_a = cast_aot_arg<TArray<FancyClass> & >::to(*__context__,__context__->abiArguments()[0]);
+    test_fancy_container_52e8fe93973493c7(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap_test_fancy_9db4fc01ed24b249 ( Context * __context__ ) {
+    test_fancy_9db4fc01ed24b249(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_nc_alias_429262dde81002a4 ( Context * __context__ ) {
+    test_nc_alias_429262dde81002a4(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_749c2552f9b67ce8 ( Context * __context__ ) {
+    return cast<bool>::from(test_749c2552f9b67ce8(__context__));
+}
+static vec4f __wrap_Foo_78374295e080f2d0 ( Context * __context__ ) {
+    *((Foo *) __context__->abiCMRES) = Foo_78374295e080f2d0(__context__);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x9fffbffc8ce3ff77, false, (void*)&test_native_ea544b1235b2f1e0, &__wrap_test_native_ea544b1235b2f1e0 },
+    { 0x85d3404e19d29c33, false, (void*)&test_handled_54a11759f3d0cf20, &__wrap_test_handled_54a11759f3d0cf20 },
+    { 0x3b999c363d6670c0, false, (void*)&test_fancy_container_52e8fe93973493c7, &__wrap_test_fancy_container_52e8fe93973493c7 },
+    { 0x955ca2fd0ac2c8d5, false, (void*)&test_fancy_9db4fc01ed24b249, &__wrap_test_fancy_9db4fc01ed24b249 },
+    { 0x5e8a849aaafe1d8e, false, (void*)&test_nc_alias_429262dde81002a4, &__wrap_test_nc_alias_429262dde81002a4 },
+    { 0xbc514aee7e29f912, false, (void*)&test_749c2552f9b67ce8, &__wrap_test_749c2552f9b67ce8 },
+    { 0x5fac23396771d5fd, true, (void*)&Foo_78374295e080f2d0, &__wrap_Foo_78374295e080f2d0 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_17459335899258591676
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,217 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_1402941695345771981 {
+
+namespace  { struct A; };
+namespace  {
+
+struct A {
+    void * __rtti;
+    Func DAS_COMMENT((void,A)) __finalize;
+    Func DAS_COMMENT((void,A)) test;
+};
+static_assert(sizeof(A)==24,"structure size mismatch with DAS");
+static_assert(offsetof(A,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(A,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(A,test)==16,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__e622630797faee04;
+extern TypeInfo __type_info__fb840f07aa01bc59;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __struct_info__e622630797faee04_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xdb1e26ce5ebaa78e), "__rtti", 0, 3 };
+TypeInfo * __type_info__fccae31e985a652e_arg_types_var_16582925662197313028[1] = { &__type_info__fb840f07aa01bc59 };
+const char * __type_info__fccae31e985a652e_arg_names_var_16582925662197313028[1] = { "self" };
+VarInfo __struct_info__e622630797faee04_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__fccae31e985a652e_arg_types_var_16582925662197313028, __type_info__fccae31e985a652e_arg_names_var_16582925662197313028, 1, 0, nullptr, 12, 8, UINT64_C(0xfccae31e985a652e), "__finalize", 8, 0 };
+VarInfo __struct_info__e622630797faee04_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__fccae31e985a652e_arg_types_var_16582925662197313028, __type_info__fccae31e985a652e_arg_names_var_16582925662197313028, 1, 0, nullptr, 12, 8, UINT64_C(0x9a21b472c35361ae), "test", 16, 0 };
+VarInfo * __struct_info__e622630797faee04_fields[3] =  { &__struct_info__e622630797faee04_field_0, &__struct_info__e622630797faee04_field_1, &__struct_info__e622630797faee04_field_2 };
+StructInfo __struct_info__e622630797faee04 = {"A", "", 13, __struct_info__e622630797faee04_fields, 3, 24, UINT64_C(0xaf63fc4c860222ec), nullptr, UINT64_C(0xe622630797faee04), 0 };
+TypeInfo __type_info__fb840f07aa01bc59 = { Type::tStructure, &__struct_info__e622630797faee04, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 24, UINT64_C(0xfb840f07aa01bc59) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2fbc9134d37ed6ca ( Context * __context__, TArray<A *> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline TArray<A *> _FuncbuiltinTickto_array_moveTick3185538323411982277_d393a562185ad6bd ( Context * __context__, TDim<A *,2> & __a_rename_at_1502_2 );
+inline void finalize_c20a173d237f8b6a ( Context * __context__, A & ____this_rename_at_3_4 );
+inline void _FuncATicktest_e5c9e8197a02a92a ( Context * __context__, A & __self_rename_at_4_5 );
+inline void _FuncA_0x27___finalize_97b016f312c66e74 ( Context * __context__, A & __self_rename_at_3_6 );
+inline bool test_5e5a318e5f6df5c4 ( Context * __context__ );
+inline A A_f690c87ce6615ca7 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2fbc9134d37ed6ca ( Context * __context__, TArray<A *> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<A *>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline TArray<A *> _FuncbuiltinTickto_array_moveTick3185538323411982277_d393a562185ad6bd ( Context * __context__, TDim<A *,2> &  __a_rename_at_1502_2 )
+{
+    TArray<A *> __arr_rename_at_1504_3;das_zero(__arr_rename_at_1504_3);
+    _FuncbuiltinTickresizeTick4811697762258667383_2fbc9134d37ed6ca(__context__,das_arg<TArray<A *>>::pass(__arr_rename_at_1504_3),2);
+    das_copy(das_cast<TDim<A *,2>>::cast(das_ref(__context__,__arr_rename_at_1504_3(0,__context__))),__a_rename_at_1502_2);
+    return /* <- */ das_auto_cast_move<TArray<A *>>::cast(__arr_rename_at_1504_3);
+}
+
+inline void finalize_c20a173d237f8b6a ( Context * __context__, A &  ____this_rename_at_3_4 )
+{
+    memset((void*)&(____this_rename_at_3_4), 0, 24);
+}
+
+inline void _FuncATicktest_e5c9e8197a02a92a ( Context * __context__, A &  __self_rename_at_4_5 )
+{
+    builtin_print(((char *) "test\n"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncA_0x27___finalize_97b016f312c66e74 ( Context * __context__, A &  __self_rename_at_3_6 )
+{
+    finalize_c20a173d237f8b6a(__context__,das_arg<A>::pass(__self_rename_at_3_6));
+}
+
+inline bool test_5e5a318e5f6df5c4 ( Context * __context__ )
+{
+    TDim<A *,2> _temp_make_local_11_15_0; _temp_make_local_11_15_0;
+    TArray<A *> __arr_rename_at_11_7; das_zero(__arr_rename_at_11_7); das_move(__arr_rename_at_11_7, _FuncbuiltinTickto_array_moveTick3185538323411982277_d393a562185ad6bd(__context__,das_arg<TDim<A *,2>>::pass((([&]() -> TDim<A *,2>& {
+        _temp_make_local_11_15_0(0,__context__) = das_new<A>::make_and_init(__context__,[&]() { return A_f690c87ce6615ca7(__context__); });
+        _temp_make_local_11_15_0(1,__context__) = das_new<A>::make_and_init(__context__,[&]() { return A_f690c87ce6615ca7(__context__); });
+        return _temp_make_local_11_15_0;
+    })()))));
+    A * __a_rename_at_12_8 = __arr_rename_at_11_7(0,__context__);
+    das_invoke_method<void,16/*test*/>::invoke<A &>(__context__,nullptr,das_arg<A>::pass(das_cast<A>::cast(das_deref(__context__,__a_rename_at_12_8,__FILE__,__LINE__))));
+    A * __b_rename_at_14_9 = __arr_rename_at_11_7(0,__context__);
+    das_invoke_method<void,16/*test*/>::invoke<A &>(__context__,nullptr,das_arg<A>::pass(das_cast<A>::cast(das_deref(__context__,__b_rename_at_14_9,__FILE__,__LINE__))));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline A A_f690c87ce6615ca7 ( Context * __context__ )
+{
+    return /* <- */ das_auto_cast_move<A>::cast((([&]() -> A {
+        A __mks_3;
+        das_copy((__mks_3.__rtti),(((void *)(&__type_info__fb840f07aa01bc59))));
+        das_copy((__mks_3.__finalize),(Func(__context__->fnByMangledName(/*A'__finalize S<A>*/ 0x637fa5d74f647d67))));
+        das_copy((__mks_3.test),(Func(__context__->fnByMangledName(/*A`test S<A>*/ 0x396391cd33ddd479))));
+        return __mks_3;
+    })()));
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2fbc9134d37ed6ca ( Context * __context__ ) {
+    TArray<A *> &  arg_Arr = cast_aot_arg<TArray<A *> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2fbc9134d37ed6ca(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_d393a562185ad6bd ( Context * __context__ ) {
+    TDim<A *,2> &  arg_a = cast_aot_arg<TDim<A *,2> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<A *> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_d393a562185ad6bd(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap_finalize_c20a173d237f8b6a ( Context * __context__ ) {
+    A &  arg___this = cast_aot_arg<A & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_c20a173d237f8b6a(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncATicktest_e5c9e8197a02a92a ( Context * __context__ ) {
+    A &  arg_self = cast_aot_arg<A & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncATicktest_e5c9e8197a02a92a(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap__FuncA_0x27___finalize_97b016f312c66e74 ( Context * __context__ ) {
+    A &  arg_self = cast_aot_arg<A & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncA_0x27___finalize_97b016f312c66e74(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap_test_5e5a318e5f6df5c4 ( Context * __context__ ) {
+    return cast<bool>::from(test_5e5a318e5f6df5c4(__context__));
+}
+static vec4f __wrap_A_f690c87ce6615ca7 ( Context * __context__ ) {
+    *((A *) __context__->abiCMRES) = A_f690c87ce6615ca7(__context__);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x82e647c0e699ef39, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2fbc9134d37ed6ca, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2fbc9134d37ed6ca },
+    { 0xebdaed9be09ec799, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_d393a562185ad6bd, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_d393a562185ad6bd },
+    { 0x22ef442d4c36ee6, false, (void*)&finalize_c20a173d237f8b6a, &__wrap_finalize_c20a173d237f8b6a },
+    { 0xe0a077c8e096e3e5, false, (void*)&_FuncATicktest_e5c9e8197a02a92a, &__wrap__FuncATicktest_e5c9e8197a02a92a },
+    { 0xcfdfe7aec8edde93, false, (void*)&_FuncA_0x27___finalize_97b016f312c66e74, &__wrap__FuncA_0x27___finalize_97b016f312c66e74 },
+    { 0x3ac6d76bfdbc9a3d, false, (void*)&test_5e5a318e5f6df5c4, &__wrap_test_5e5a318e5f6df5c4 },
+    { 0xffc0fb8e4d6328e1, true, (void*)&A_f690c87ce6615ca7, &__wrap_A_f690c87ce6615ca7 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_1402941695345771981
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
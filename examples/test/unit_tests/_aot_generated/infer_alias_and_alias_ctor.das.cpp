@@ -0,0 +1,232 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_10485270419305857625 {
+
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __func_info__81a3ad1fac2686ee_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 317, 4, UINT64_C(0xddc168323a3f19ac), "obj", 0, 0 };
+VarInfo * __func_info__81a3ad1fac2686ee_fields[1] =  { &__func_info__81a3ad1fac2686ee_field_0 };
+FuncInfo __func_info__81a3ad1fac2686ee = {"invoke block<(obj:int const&):void> const", "", __func_info__81a3ad1fac2686ee_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x81a3ad1fac2686ee), 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline bool _FuncbuiltinTickgetTick13445059837844701140_1e08f5e9a07ea178 ( Context * __context__, TTable<char *,int32_t> const  & __Tab_rename_at_636_0, char * const  __at_rename_at_636_1, Block DAS_COMMENT((void,int32_t const  &)) const  & __blk_rename_at_636_2 );
+inline int32_t * _FuncTickfindObjectTick9853438200977880237_f60db626bb88e013 ( Context * __context__, TTable<char *,int32_t> const  & __objects_rename_at_13_4, char * const  __guid_rename_at_13_5 );
+inline TTable<char *,int32_t> _FuncbuiltinTickto_table_moveTick5858896087460481804_851cc220ee3e1eba ( Context * __context__, TDim<TTuple<16,char *,int32_t>,2> & __a_rename_at_1615_8 );
+inline void _FuncbuiltinTickpushTick14133213201864676143_88db00d1f28d5dff ( Context * __context__, TArray<float> & __Arr_rename_at_177_11, float __value_rename_at_177_12 );
+inline float _FuncTickjoinTick7905751472635573395_c8a43c707b9bb22d ( Context * __context__, TArray<float> const  & __a_rename_at_4_13 );
+inline bool test_8660bbf2a8ffb036 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool _FuncbuiltinTickgetTick13445059837844701140_1e08f5e9a07ea178 ( Context * __context__, TTable<char *,int32_t> const  &  __Tab_rename_at_636_0, char * const  __at_rename_at_636_1, Block DAS_COMMENT((void,int32_t const  &)) const  &  __blk_rename_at_636_2 )
+{
+    int32_t * __val_rename_at_637_3 = __builtin_table_find(__context__,__Tab_rename_at_636_0,__at_rename_at_636_1);
+    if ( __val_rename_at_637_3 != nullptr )
+    {
+        builtin_table_lock(__Tab_rename_at_636_0,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        das_invoke<void>::invoke<int32_t &>(__context__,nullptr,__blk_rename_at_636_2,das_deref(__context__,das_cast<int32_t *>::cast(__val_rename_at_637_3),__FILE__,__LINE__));
+        builtin_table_unlock(__Tab_rename_at_636_0,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        return das_auto_cast<bool>::cast(true);
+    } else {
+        return das_auto_cast<bool>::cast(false);
+    };
+}
+
+inline int32_t * _FuncTickfindObjectTick9853438200977880237_f60db626bb88e013 ( Context * __context__, TTable<char *,int32_t> const  &  __objects_rename_at_13_4, char * const  __guid_rename_at_13_5 ) { das_stack_prologue __prologue(__context__,112,"`findObject`9853438200977880237 " DAS_FILE_LINE);
+{
+    int32_t * __foundObj_rename_at_14_6 = 0;
+    _FuncbuiltinTickgetTick13445059837844701140_1e08f5e9a07ea178(__context__,__objects_rename_at_13_4,__guid_rename_at_13_5,das_make_block<void,int32_t const  &>(__context__,96,0,&__func_info__81a3ad1fac2686ee,[&](int32_t const  & __obj_rename_at_15_7) -> void{
+        das_copy(__foundObj_rename_at_14_6,das_cast<int32_t *>::cast(das_ref(__context__,__obj_rename_at_15_7)));
+    }));
+    return das_auto_cast<int32_t *>::cast(__foundObj_rename_at_14_6);
+}}
+
+inline TTable<char *,int32_t> _FuncbuiltinTickto_table_moveTick5858896087460481804_851cc220ee3e1eba ( Context * __context__, TDim<TTuple<16,char *,int32_t>,2> &  __a_rename_at_1615_8 )
+{
+    TTable<char *,int32_t> __tab_rename_at_1616_9;das_zero(__tab_rename_at_1616_9);
+    {
+        bool __need_loop_1618 = true;
+        // x: tuple<string aka keyT;int aka valT>&
+        das_iterator<TDim<TTuple<16,char *,int32_t>,2>> __x_iterator(__a_rename_at_1615_8);
+        TTuple<16,char *,int32_t> * __x_rename_at_1618_10;
+        __need_loop_1618 = __x_iterator.first(__context__,(__x_rename_at_1618_10)) && __need_loop_1618;
+        for ( ; __need_loop_1618 ; __need_loop_1618 = __x_iterator.next(__context__,(__x_rename_at_1618_10)) )
+        {
+            das_copy(__tab_rename_at_1616_9(das_get_tuple_field<char *,0>::get((*__x_rename_at_1618_10)),__context__),das_get_tuple_field<int32_t,8>::get((*__x_rename_at_1618_10)));
+        }
+        __x_iterator.close(__context__,(__x_rename_at_1618_10));
+    };
+    return /* <- */ das_auto_cast_move<TTable<char *,int32_t>>::cast(__tab_rename_at_1616_9);
+}
+
+inline void _FuncbuiltinTickpushTick14133213201864676143_88db00d1f28d5dff ( Context * __context__, TArray<float> &  __Arr_rename_at_177_11, float __value_rename_at_177_12 )
+{
+    das_copy(__Arr_rename_at_177_11(builtin_array_push_back(das_arg<TArray<float>>::pass(__Arr_rename_at_177_11),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_177_12);
+}
+
+inline float _FuncTickjoinTick7905751472635573395_c8a43c707b9bb22d ( Context * __context__, TArray<float> const  &  __a_rename_at_4_13 )
+{
+    float __t_rename_at_5_14 = 0.000000e+00f;
+    {
+        bool __need_loop_6 = true;
+        // x: float aka numt const&
+        das_iterator<TArray<float> const > __x_iterator(__a_rename_at_4_13);
+        float const  * __x_rename_at_6_15;
+        __need_loop_6 = __x_iterator.first(__context__,(__x_rename_at_6_15)) && __need_loop_6;
+        for ( ; __need_loop_6 ; __need_loop_6 = __x_iterator.next(__context__,(__x_rename_at_6_15)) )
+        {
+            __t_rename_at_5_14 += (*__x_rename_at_6_15);
+        }
+        __x_iterator.close(__context__,(__x_rename_at_6_15));
+    };
+    return das_auto_cast<float>::cast(__t_rename_at_5_14);
+}
+
+inline bool test_8660bbf2a8ffb036 ( Context * __context__ )
+{
+    TDim<TTuple<16,char *,int32_t>,2> _temp_make_local_31_15_0; _temp_make_local_31_15_0;
+    TArray<float> __a_rename_at_25_16;das_zero(__a_rename_at_25_16);
+    _FuncbuiltinTickpushTick14133213201864676143_88db00d1f28d5dff(__context__,das_arg<TArray<float>>::pass(__a_rename_at_25_16),1.000000e+00f);
+    _FuncbuiltinTickpushTick14133213201864676143_88db00d1f28d5dff(__context__,das_arg<TArray<float>>::pass(__a_rename_at_25_16),2.000000e+00f);
+    _FuncbuiltinTickpushTick14133213201864676143_88db00d1f28d5dff(__context__,das_arg<TArray<float>>::pass(__a_rename_at_25_16),3.000000e+00f);
+    float __t_rename_at_29_17 = ((float)_FuncTickjoinTick7905751472635573395_c8a43c707b9bb22d(__context__,das_arg<TArray<float>>::pass(__a_rename_at_25_16)));
+    DAS_ASSERT((__t_rename_at_29_17 == 6.000000e+00f));
+    TTable<char *,int32_t> __tab_rename_at_31_18_ConstRef; das_zero(__tab_rename_at_31_18_ConstRef); das_move(__tab_rename_at_31_18_ConstRef, ((TTable<char *,int32_t>)_FuncbuiltinTickto_table_moveTick5858896087460481804_851cc220ee3e1eba(__context__,das_arg<TDim<TTuple<16,char *,int32_t>,2>>::pass((([&]() -> TDim<TTuple<16,char *,int32_t>,2>& {
+        _temp_make_local_31_15_0(0,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+            TTuple<16,char *,int32_t> __mkt_31;
+            das_get_tuple_field<char *,0>::get(__mkt_31) = ((char *) "one");
+            das_get_tuple_field<int32_t,8>::get(__mkt_31) = 1;
+            return __mkt_31;
+        })());
+        _temp_make_local_31_15_0(1,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+            TTuple<16,char *,int32_t> __mkt_31;
+            das_get_tuple_field<char *,0>::get(__mkt_31) = ((char *) "two");
+            das_get_tuple_field<int32_t,8>::get(__mkt_31) = 2;
+            return __mkt_31;
+        })());
+        return _temp_make_local_31_15_0;
+    })())))));
+    TTable<char *,int32_t> const  & __tab_rename_at_31_18 = __tab_rename_at_31_18_ConstRef;
+;
+    DAS_VERIFY((das_null_coalescing<int32_t>::get(_FuncTickfindObjectTick9853438200977880237_f60db626bb88e013(__context__,__tab_rename_at_31_18,((char *) "one")),0) == 1));
+    DAS_VERIFY((das_null_coalescing<int32_t>::get(_FuncTickfindObjectTick9853438200977880237_f60db626bb88e013(__context__,__tab_rename_at_31_18,((char *) "two")),0) == 2));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncbuiltinTickgetTick13445059837844701140_1e08f5e9a07ea178 ( Context * __context__ ) {
+    TTable<char *,int32_t> const  &  arg_Tab = cast_aot_arg<TTable<char *,int32_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_at = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    Block DAS_COMMENT((void,int32_t const  &)) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((void,int32_t const  &)) const  & >::to(*__context__,__context__->abiArguments()[2]);
+    return cast<bool>::from(_FuncbuiltinTickgetTick13445059837844701140_1e08f5e9a07ea178(__context__, arg_Tab, arg_at, arg_blk));
+}
+static vec4f __wrap__FuncTickfindObjectTick9853438200977880237_f60db626bb88e013 ( Context * __context__ ) {
+    TTable<char *,int32_t> const  &  arg_objects = cast_aot_arg<TTable<char *,int32_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_guid = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t *>::from(_FuncTickfindObjectTick9853438200977880237_f60db626bb88e013(__context__, arg_objects, arg_guid));
+}
+static vec4f __wrap__FuncbuiltinTickto_table_moveTick5858896087460481804_851cc220ee3e1eba ( Context * __context__ ) {
+    TDim<TTuple<16,char *,int32_t>,2> &  arg_a = cast_aot_arg<TDim<TTuple<16,char *,int32_t>,2> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TTable<char *,int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_table_moveTick5858896087460481804_851cc220ee3e1eba(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpushTick14133213201864676143_88db00d1f28d5dff ( Context * __context__ ) {
+    TArray<float> &  arg_Arr = cast_aot_arg<TArray<float> & >::to(*__context__,__context__->abiArguments()[0]);
+    float arg_value = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick14133213201864676143_88db00d1f28d5dff(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickjoinTick7905751472635573395_c8a43c707b9bb22d ( Context * __context__ ) {
+    TArray<float> const  &  arg_a = cast_aot_arg<TArray<float> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<float>::from(_FuncTickjoinTick7905751472635573395_c8a43c707b9bb22d(__context__, arg_a));
+}
+static vec4f __wrap_test_8660bbf2a8ffb036 ( Context * __context__ ) {
+    return cast<bool>::from(test_8660bbf2a8ffb036(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xc9eb375a4ea5a73c, false, (void*)&_FuncbuiltinTickgetTick13445059837844701140_1e08f5e9a07ea178, &__wrap__FuncbuiltinTickgetTick13445059837844701140_1e08f5e9a07ea178 },
+    { 0x47cb6a85fdbe90a3, false, (void*)&_FuncTickfindObjectTick9853438200977880237_f60db626bb88e013, &__wrap__FuncTickfindObjectTick9853438200977880237_f60db626bb88e013 },
+    { 0xb14eb7f798510893, true, (void*)&_FuncbuiltinTickto_table_moveTick5858896087460481804_851cc220ee3e1eba, &__wrap__FuncbuiltinTickto_table_moveTick5858896087460481804_851cc220ee3e1eba },
+    { 0x26f608b1e86fe7c7, false, (void*)&_FuncbuiltinTickpushTick14133213201864676143_88db00d1f28d5dff, &__wrap__FuncbuiltinTickpushTick14133213201864676143_88db00d1f28d5dff },
+    { 0x7624136aee1129d7, false, (void*)&_FuncTickjoinTick7905751472635573395_c8a43c707b9bb22d, &__wrap__FuncTickjoinTick7905751472635573395_c8a43c707b9bb22d },
+    { 0xec3a0482d0037a5d, false, (void*)&test_8660bbf2a8ffb036, &__wrap_test_8660bbf2a8ffb036 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_10485270419305857625
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,144 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_15444438617900007096 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickpushTick14133213201864676143_88db00d1f28d5dff ( Context * __context__, TArray<float> & __Arr_rename_at_177_0, float __value_rename_at_177_1 );
+inline float _FuncTickfoldTick12265774025684951885_7e4724a9e7837910 ( Context * __context__, TArray<float> const  & __a_rename_at_4_2, float __from_rename_at_4_3 );
+inline bool test_78017e51a983932 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickpushTick14133213201864676143_88db00d1f28d5dff ( Context * __context__, TArray<float> &  __Arr_rename_at_177_0, float __value_rename_at_177_1 )
+{
+    das_copy(__Arr_rename_at_177_0(builtin_array_push_back(das_arg<TArray<float>>::pass(__Arr_rename_at_177_0),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_177_1);
+}
+
+inline float _FuncTickfoldTick12265774025684951885_7e4724a9e7837910 ( Context * __context__, TArray<float> const  &  __a_rename_at_4_2, float __from_rename_at_4_3 )
+{
+    {
+        bool __need_loop_5 = true;
+        // x: float aka numt const&
+        das_iterator<TArray<float> const > __x_iterator(__a_rename_at_4_2);
+        float const  * __x_rename_at_5_4;
+        __need_loop_5 = __x_iterator.first(__context__,(__x_rename_at_5_4)) && __need_loop_5;
+        for ( ; __need_loop_5 ; __need_loop_5 = __x_iterator.next(__context__,(__x_rename_at_5_4)) )
+        {
+            __from_rename_at_4_3 += (*__x_rename_at_5_4);
+        }
+        __x_iterator.close(__context__,(__x_rename_at_5_4));
+    };
+    return das_auto_cast<float>::cast(__from_rename_at_4_3);
+}
+
+inline bool test_78017e51a983932 ( Context * __context__ )
+{
+    TArray<float> __a_rename_at_13_5;das_zero(__a_rename_at_13_5);
+    _FuncbuiltinTickpushTick14133213201864676143_88db00d1f28d5dff(__context__,das_arg<TArray<float>>::pass(__a_rename_at_13_5),1.000000e+00f);
+    _FuncbuiltinTickpushTick14133213201864676143_88db00d1f28d5dff(__context__,das_arg<TArray<float>>::pass(__a_rename_at_13_5),2.000000e+00f);
+    _FuncbuiltinTickpushTick14133213201864676143_88db00d1f28d5dff(__context__,das_arg<TArray<float>>::pass(__a_rename_at_13_5),3.000000e+00f);
+    float __q_rename_at_17_6 = ((float)_FuncTickfoldTick12265774025684951885_7e4724a9e7837910(__context__,das_arg<TArray<float>>::pass(__a_rename_at_13_5),1.300000e+01f));
+    DAS_ASSERT((__q_rename_at_17_6 == 1.900000e+01f));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncbuiltinTickpushTick14133213201864676143_88db00d1f28d5dff ( Context * __context__ ) {
+    TArray<float> &  arg_Arr = cast_aot_arg<TArray<float> & >::to(*__context__,__context__->abiArguments()[0]);
+    float arg_value = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick14133213201864676143_88db00d1f28d5dff(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickfoldTick12265774025684951885_7e4724a9e7837910 ( Context * __context__ ) {
+    TArray<float> const  &  arg_a = cast_aot_arg<TArray<float> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    float arg_from = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<float>::from(_FuncTickfoldTick12265774025684951885_7e4724a9e7837910(__context__, arg_a, arg_from));
+}
+static vec4f __wrap_test_78017e51a983932 ( Context * __context__ ) {
+    return cast<bool>::from(test_78017e51a983932(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x26f608b1e86fe7c7, false, (void*)&_FuncbuiltinTickpushTick14133213201864676143_88db00d1f28d5dff, &__wrap__FuncbuiltinTickpushTick14133213201864676143_88db00d1f28d5dff },
+    { 0xb91502c2559c83de, false, (void*)&_FuncTickfoldTick12265774025684951885_7e4724a9e7837910, &__wrap__FuncTickfoldTick12265774025684951885_7e4724a9e7837910 },
+    { 0xa3e90d254bb42d77, false, (void*)&test_78017e51a983932, &__wrap_test_78017e51a983932 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_15444438617900007096
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
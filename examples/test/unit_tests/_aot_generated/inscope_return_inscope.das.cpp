@@ -0,0 +1,164 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_10921601177851298850 {
+
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+    int32_t a;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void finalize_76b6bf6d878aee2f ( Context * __context__, Foo & ____this_rename_at_2_0 );
+inline void finalize_8b711ce80f534915 ( Context * __context__, Foo * & ____this_rename_at_15_1 );
+inline void buggy_87b0f2b2866a3412 ( Context * __context__, bool __skip_rename_at_7_2 );
+inline bool test_cca5f7bbb142ba94 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void finalize_76b6bf6d878aee2f ( Context * __context__, Foo &  ____this_rename_at_2_0 )
+{
+    memset((void*)&(____this_rename_at_2_0), 0, 4);
+}
+
+inline void finalize_8b711ce80f534915 ( Context * __context__, Foo * & ____this_rename_at_15_1 )
+{
+    if ( ____this_rename_at_15_1 != nullptr )
+    {
+        finalize_76b6bf6d878aee2f(__context__,das_arg<Foo>::pass(das_deref(__context__,____this_rename_at_15_1,__FILE__,__LINE__)));
+        das_delete<Foo *>::clear(__context__,____this_rename_at_15_1);
+        das_copy(____this_rename_at_15_1,nullptr);
+    };
+}
+
+inline void buggy_87b0f2b2866a3412 ( Context * __context__, bool __skip_rename_at_7_2 )
+{
+    Foo * __a_rename_at_8_3; memset((void*)&__a_rename_at_8_3,0,sizeof(__a_rename_at_8_3));
+    Foo * __b_rename_at_12_4; memset((void*)&__b_rename_at_12_4,0,sizeof(__b_rename_at_12_4));
+    /* finally */ auto __finally_7= das_finally([&](){
+    finalize_8b711ce80f534915(__context__,__a_rename_at_8_3);
+    finalize_8b711ce80f534915(__context__,__b_rename_at_12_4);
+    /* end finally */ });
+    __a_rename_at_8_3 = das_new<Foo>::make(__context__);
+    if ( __skip_rename_at_7_2 )
+    {
+        return ;
+    } else {
+        __b_rename_at_12_4 = das_new<Foo>::make(__context__);
+    };
+}
+
+inline bool test_cca5f7bbb142ba94 ( Context * __context__ )
+{
+    buggy_87b0f2b2866a3412(__context__,true);
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_finalize_76b6bf6d878aee2f ( Context * __context__ ) {
+    Foo &  arg___this = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_76b6bf6d878aee2f(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_8b711ce80f534915 ( Context * __context__ ) {
+    Foo * & arg___this = cast_aot_arg<Foo * &>::to(*__context__,__context__->abiArguments()[0]);
+    finalize_8b711ce80f534915(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_buggy_87b0f2b2866a3412 ( Context * __context__ ) {
+    bool arg_skip = cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]);
+    buggy_87b0f2b2866a3412(__context__, arg_skip);
+    return v_zero();
+}
+static vec4f __wrap_test_cca5f7bbb142ba94 ( Context * __context__ ) {
+    return cast<bool>::from(test_cca5f7bbb142ba94(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xd79e2d3870bd5bde, false, (void*)&finalize_76b6bf6d878aee2f, &__wrap_finalize_76b6bf6d878aee2f },
+    { 0xc151077f7aeac16c, false, (void*)&finalize_8b711ce80f534915, &__wrap_finalize_8b711ce80f534915 },
+    { 0x910c22c7f58ca658, false, (void*)&buggy_87b0f2b2866a3412, &__wrap_buggy_87b0f2b2866a3412 },
+    { 0xe9bcb71379ac86f0, false, (void*)&test_cca5f7bbb142ba94, &__wrap_test_cca5f7bbb142ba94 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_10921601177851298850
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,207 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_4131318769524179231 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncTickcheck12Tick4614428784073700515_96c5a608b5cee774 ( Context * __context__, int32_t __a_rename_at_5_0, int32_t __b_rename_at_5_1, int8_t __c_rename_at_5_2 );
+inline void _FuncTickcheck12Tick4614428784073700515_9b6a01e0296fa6b5 ( Context * __context__, int32_t __a_rename_at_5_6, int32_t __b_rename_at_5_7, uint8_t __c_rename_at_5_8 );
+inline void _FuncTickcheck12Tick4614428784073700515_e53ee91b8401fa71 ( Context * __context__, int32_t __a_rename_at_5_12, int32_t __b_rename_at_5_13, int16_t __c_rename_at_5_14 );
+inline void _FuncTickcheck12Tick4614428784073700515_7d243a839b65a1df ( Context * __context__, int32_t __a_rename_at_5_18, int32_t __b_rename_at_5_19, uint16_t __c_rename_at_5_20 );
+inline bool test_a0ba808fc819998f ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncTickcheck12Tick4614428784073700515_96c5a608b5cee774 ( Context * __context__, int32_t __a_rename_at_5_0, int32_t __b_rename_at_5_1, int8_t __c_rename_at_5_2 )
+{
+    int8_t __A_rename_at_6_3 = ((int8_t)int8_t(__a_rename_at_5_0));
+    int8_t __B_rename_at_7_4 = ((int8_t)int8_t(__b_rename_at_5_1));
+    int8_t __A__rename_at_8_5 = ((int8_t)int8_t(__a_rename_at_5_0 + 1));
+    DAS_ASSERT((!(das_equ_val(__A_rename_at_6_3,__B_rename_at_7_4))));
+    DAS_ASSERT((das_equ_val(__A__rename_at_8_5,__B_rename_at_7_4)));
+    DAS_ASSERT((das_nequ_val(__A_rename_at_6_3,__B_rename_at_7_4)));
+    DAS_ASSERT((!(das_nequ_val(__A__rename_at_8_5,__B_rename_at_7_4))));
+    DAS_ASSERT((das_equ_val(__c_rename_at_5_2,0)));
+}
+
+inline void _FuncTickcheck12Tick4614428784073700515_9b6a01e0296fa6b5 ( Context * __context__, int32_t __a_rename_at_5_6, int32_t __b_rename_at_5_7, uint8_t __c_rename_at_5_8 )
+{
+    uint8_t __A_rename_at_6_9 = ((uint8_t)uint8_t(__a_rename_at_5_6));
+    uint8_t __B_rename_at_7_10 = ((uint8_t)uint8_t(__b_rename_at_5_7));
+    uint8_t __A__rename_at_8_11 = ((uint8_t)uint8_t(__a_rename_at_5_6 + 1));
+    DAS_ASSERT((!(das_equ_val(__A_rename_at_6_9,__B_rename_at_7_10))));
+    DAS_ASSERT((das_equ_val(__A__rename_at_8_11,__B_rename_at_7_10)));
+    DAS_ASSERT((das_nequ_val(__A_rename_at_6_9,__B_rename_at_7_10)));
+    DAS_ASSERT((!(das_nequ_val(__A__rename_at_8_11,__B_rename_at_7_10))));
+    DAS_ASSERT((das_equ_val(__c_rename_at_5_8,0x0)));
+}
+
+inline void _FuncTickcheck12Tick4614428784073700515_e53ee91b8401fa71 ( Context * __context__, int32_t __a_rename_at_5_12, int32_t __b_rename_at_5_13, int16_t __c_rename_at_5_14 )
+{
+    int16_t __A_rename_at_6_15 = ((int16_t)int16_t(__a_rename_at_5_12));
+    int16_t __B_rename_at_7_16 = ((int16_t)int16_t(__b_rename_at_5_13));
+    int16_t __A__rename_at_8_17 = ((int16_t)int16_t(__a_rename_at_5_12 + 1));
+    DAS_ASSERT((!(das_equ_val(__A_rename_at_6_15,__B_rename_at_7_16))));
+    DAS_ASSERT((das_equ_val(__A__rename_at_8_17,__B_rename_at_7_16)));
+    DAS_ASSERT((das_nequ_val(__A_rename_at_6_15,__B_rename_at_7_16)));
+    DAS_ASSERT((!(das_nequ_val(__A__rename_at_8_17,__B_rename_at_7_16))));
+    DAS_ASSERT((das_equ_val(__c_rename_at_5_14,0)));
+}
+
+inline void _FuncTickcheck12Tick4614428784073700515_7d243a839b65a1df ( Context * __context__, int32_t __a_rename_at_5_18, int32_t __b_rename_at_5_19, uint16_t __c_rename_at_5_20 )
+{
+    uint16_t __A_rename_at_6_21 = ((uint16_t)uint16_t(__a_rename_at_5_18));
+    uint16_t __B_rename_at_7_22 = ((uint16_t)uint16_t(__b_rename_at_5_19));
+    uint16_t __A__rename_at_8_23 = ((uint16_t)uint16_t(__a_rename_at_5_18 + 1));
+    DAS_ASSERT((!(das_equ_val(__A_rename_at_6_21,__B_rename_at_7_22))));
+    DAS_ASSERT((das_equ_val(__A__rename_at_8_23,__B_rename_at_7_22)));
+    DAS_ASSERT((das_nequ_val(__A_rename_at_6_21,__B_rename_at_7_22)));
+    DAS_ASSERT((!(das_nequ_val(__A__rename_at_8_23,__B_rename_at_7_22))));
+    DAS_ASSERT((das_equ_val(__c_rename_at_5_20,0x0)));
+}
+
+inline bool test_a0ba808fc819998f ( Context * __context__ )
+{
+    int32_t __i_rename_at_18_24 = 100500;
+    int64_t __li_rename_at_19_25 = INT64_C(100500100500100500);
+    uint32_t __u_rename_at_20_26 = 0xeu;
+    uint64_t __ul_rename_at_21_27 = UINT64_C(0x1650c4f16331594);
+    uint32_t __uh_rename_at_22_28 = 0x1au;
+    uint32_t __uhu_rename_at_23_29 = 0x12345678u;
+    uint64_t __uhl_rename_at_24_30 = UINT64_C(0x123456789abcdef);
+    uint64_t __uhlu_rename_at_25_31 = UINT64_C(0x123456789abcdef);
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    int32_t __ch_rename_at_34_32 = ((int32_t)97);
+    DAS_ASSERT((true));
+    _FuncTickcheck12Tick4614428784073700515_96c5a608b5cee774(__context__,1,2,0);
+    _FuncTickcheck12Tick4614428784073700515_9b6a01e0296fa6b5(__context__,1,2,0x0);
+    _FuncTickcheck12Tick4614428784073700515_e53ee91b8401fa71(__context__,1,2,0);
+    _FuncTickcheck12Tick4614428784073700515_7d243a839b65a1df(__context__,1,2,0x0);
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncTickcheck12Tick4614428784073700515_96c5a608b5cee774 ( Context * __context__ ) {
+    int32_t arg_a = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_b = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int8_t arg_c = cast_aot_arg<int8_t>::to(*__context__,__context__->abiArguments()[2]);
+    _FuncTickcheck12Tick4614428784073700515_96c5a608b5cee774(__context__, arg_a, arg_b, arg_c);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickcheck12Tick4614428784073700515_9b6a01e0296fa6b5 ( Context * __context__ ) {
+    int32_t arg_a = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_b = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    uint8_t arg_c = cast_aot_arg<uint8_t>::to(*__context__,__context__->abiArguments()[2]);
+    _FuncTickcheck12Tick4614428784073700515_9b6a01e0296fa6b5(__context__, arg_a, arg_b, arg_c);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickcheck12Tick4614428784073700515_e53ee91b8401fa71 ( Context * __context__ ) {
+    int32_t arg_a = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_b = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int16_t arg_c = cast_aot_arg<int16_t>::to(*__context__,__context__->abiArguments()[2]);
+    _FuncTickcheck12Tick4614428784073700515_e53ee91b8401fa71(__context__, arg_a, arg_b, arg_c);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickcheck12Tick4614428784073700515_7d243a839b65a1df ( Context * __context__ ) {
+    int32_t arg_a = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_b = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    uint16_t arg_c = cast_aot_arg<uint16_t>::to(*__context__,__context__->abiArguments()[2]);
+    _FuncTickcheck12Tick4614428784073700515_7d243a839b65a1df(__context__, arg_a, arg_b, arg_c);
+    return v_zero();
+}
+static vec4f __wrap_test_a0ba808fc819998f ( Context * __context__ ) {
+    return cast<bool>::from(test_a0ba808fc819998f(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xcdd6d6990dea8f40, false, (void*)&_FuncTickcheck12Tick4614428784073700515_96c5a608b5cee774, &__wrap__FuncTickcheck12Tick4614428784073700515_96c5a608b5cee774 },
+    { 0x36a98e50a97bce4d, false, (void*)&_FuncTickcheck12Tick4614428784073700515_9b6a01e0296fa6b5, &__wrap__FuncTickcheck12Tick4614428784073700515_9b6a01e0296fa6b5 },
+    { 0x615c52ff1dc1ecc7, false, (void*)&_FuncTickcheck12Tick4614428784073700515_e53ee91b8401fa71, &__wrap__FuncTickcheck12Tick4614428784073700515_e53ee91b8401fa71 },
+    { 0xef7ec19e3e239c97, false, (void*)&_FuncTickcheck12Tick4614428784073700515_7d243a839b65a1df, &__wrap__FuncTickcheck12Tick4614428784073700515_7d243a839b65a1df },
+    { 0x5edd147b48c56942, false, (void*)&test_a0ba808fc819998f, &__wrap_test_a0ba808fc819998f },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_4131318769524179231
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,763 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_10074710503354810106 {
+
+namespace  { struct Foo; };
+namespace  { struct _lambda_thismodule_94_1; };
+namespace  { struct _lambda_thismodule_97_2; };
+namespace  { struct _lambda_thismodule_100_3; };
+namespace  { struct _lambda_thismodule_103_4; };
+namespace  {
+
+struct Foo {
+    int32_t a;
+    int32_t b;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_94_1 {
+    Func DAS_COMMENT((Foo,_lambda_thismodule_94_1)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_94_1 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_94_1)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_94_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_94_1,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_97_2 {
+    Func DAS_COMMENT((Foo const ,_lambda_thismodule_97_2)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_97_2 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_97_2)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_97_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_97_2,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_100_3 {
+    Func DAS_COMMENT((Foo,_lambda_thismodule_100_3,int32_t)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_100_3 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_100_3)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_100_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_100_3,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_103_4 {
+    Func DAS_COMMENT((Foo const ,_lambda_thismodule_103_4,int32_t)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_103_4 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_103_4)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_103_4,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_103_4,__finalize)==8,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__411ed0e77075265a;
+extern StructInfo __struct_info__a4ac1aa53d5d4f6e;
+extern StructInfo __struct_info__ae971aa5458e256e;
+extern StructInfo __struct_info__49fcfc7eca3b9d18;
+extern StructInfo __struct_info__49f2ed7eca332f16;
+extern TypeInfo __type_info__5d28185c7d1ff18d;
+extern TypeInfo __type_info__a03b21680c78a98d;
+extern TypeInfo __type_info__b9315deecc307fa2;
+extern TypeInfo __type_info__c706e2eedf88e288;
+extern TypeInfo __type_info__32fb9d473a58cef3;
+extern TypeInfo __type_info__af8afe4c86446b52;
+extern TypeInfo __type_info__bc69a005531fe739;
+extern TypeInfo __type_info__44ac53994fb87f65;
+extern TypeInfo __type_info__e4d753957fcc5d65;
+extern TypeInfo __type_info__1db20dea29a617f3;
+extern TypeInfo __type_info__1db0a0ea299b0241;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __struct_info__411ed0e77075265a_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xbcd691bb60c7d14c), "a", 0, 0 };
+VarInfo __struct_info__411ed0e77075265a_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xbcd694bb60c7d665), "b", 4, 0 };
+VarInfo * __struct_info__411ed0e77075265a_fields[2] =  { &__struct_info__411ed0e77075265a_field_0, &__struct_info__411ed0e77075265a_field_1 };
+StructInfo __struct_info__411ed0e77075265a = {"Foo", "", 0, __struct_info__411ed0e77075265a_fields, 2, 8, UINT64_C(0x0), nullptr, UINT64_C(0x411ed0e77075265a), 2 };
+TypeInfo * __type_info__f6f6c8f59cadcaec_arg_types_var_11865888415215865710[2] = { &__type_info__44ac53994fb87f65, &__type_info__af8afe4c86446b52 };
+const char * __type_info__f6f6c8f59cadcaec_arg_names_var_11865888415215865710[2] = { "__this", "t" };
+VarInfo __struct_info__a4ac1aa53d5d4f6e_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__bc69a005531fe739, nullptr, (TypeInfo **)__type_info__f6f6c8f59cadcaec_arg_types_var_11865888415215865710, __type_info__f6f6c8f59cadcaec_arg_names_var_11865888415215865710, 2, 0, nullptr, 12, 8, UINT64_C(0xf6f6c8f59cadcaec), "__lambda", 0, 0 };
+TypeInfo * __type_info__f634dcc77c9d7886_arg_types_var_11865888415215865710[1] = { &__type_info__5d28185c7d1ff18d };
+const char * __type_info__f634dcc77c9d7886_arg_names_var_11865888415215865710[1] = { "__this" };
+VarInfo __struct_info__a4ac1aa53d5d4f6e_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__f634dcc77c9d7886_arg_types_var_11865888415215865710, __type_info__f634dcc77c9d7886_arg_names_var_11865888415215865710, 1, 0, nullptr, 12, 8, UINT64_C(0xf634dcc77c9d7886), "__finalize", 8, 0 };
+VarInfo * __struct_info__a4ac1aa53d5d4f6e_fields[2] =  { &__struct_info__a4ac1aa53d5d4f6e_field_0, &__struct_info__a4ac1aa53d5d4f6e_field_1 };
+StructInfo __struct_info__a4ac1aa53d5d4f6e = {"_lambda_thismodule_100_3", "", 14, __struct_info__a4ac1aa53d5d4f6e_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0xa4ac1aa53d5d4f6e), 2 };
+TypeInfo * __type_info__ea6088cab38338ec_arg_types_var_12580553381221639534[2] = { &__type_info__e4d753957fcc5d65, &__type_info__af8afe4c86446b52 };
+VarInfo __struct_info__ae971aa5458e256e_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__32fb9d473a58cef3, nullptr, (TypeInfo **)__type_info__ea6088cab38338ec_arg_types_var_12580553381221639534, __type_info__f6f6c8f59cadcaec_arg_names_var_11865888415215865710, 2, 0, nullptr, 12, 8, UINT64_C(0xea6088cab38338ec), "__lambda", 0, 0 };
+TypeInfo * __type_info__2383ffe509424686_arg_types_var_12580553381221639534[1] = { &__type_info__a03b21680c78a98d };
+VarInfo __struct_info__ae971aa5458e256e_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__2383ffe509424686_arg_types_var_12580553381221639534, __type_info__f634dcc77c9d7886_arg_names_var_11865888415215865710, 1, 0, nullptr, 12, 8, UINT64_C(0x2383ffe509424686), "__finalize", 8, 0 };
+VarInfo * __struct_info__ae971aa5458e256e_fields[2] =  { &__struct_info__ae971aa5458e256e_field_0, &__struct_info__ae971aa5458e256e_field_1 };
+StructInfo __struct_info__ae971aa5458e256e = {"_lambda_thismodule_103_4", "", 14, __struct_info__ae971aa5458e256e_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0xae971aa5458e256e), 2 };
+TypeInfo * __type_info__35cbced94bb39259_arg_types_var_5331413680388807960[1] = { &__type_info__1db20dea29a617f3 };
+VarInfo __struct_info__49fcfc7eca3b9d18_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__bc69a005531fe739, nullptr, (TypeInfo **)__type_info__35cbced94bb39259_arg_types_var_5331413680388807960, __type_info__f634dcc77c9d7886_arg_names_var_11865888415215865710, 1, 0, nullptr, 12, 8, UINT64_C(0x35cbced94bb39259), "__lambda", 0, 0 };
+TypeInfo * __type_info__ba3e6ad9682f37fa_arg_types_var_5331413680388807960[1] = { &__type_info__b9315deecc307fa2 };
+VarInfo __struct_info__49fcfc7eca3b9d18_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__ba3e6ad9682f37fa_arg_types_var_5331413680388807960, __type_info__f634dcc77c9d7886_arg_names_var_11865888415215865710, 1, 0, nullptr, 12, 8, UINT64_C(0xba3e6ad9682f37fa), "__finalize", 8, 0 };
+VarInfo * __struct_info__49fcfc7eca3b9d18_fields[2] =  { &__struct_info__49fcfc7eca3b9d18_field_0, &__struct_info__49fcfc7eca3b9d18_field_1 };
+StructInfo __struct_info__49fcfc7eca3b9d18 = {"_lambda_thismodule_94_1", "", 14, __struct_info__49fcfc7eca3b9d18_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0x49fcfc7eca3b9d18), 2 };
+TypeInfo * __type_info__6e4393edcc5117ab_arg_types_var_5328582437946732310[1] = { &__type_info__1db0a0ea299b0241 };
+VarInfo __struct_info__49f2ed7eca332f16_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__32fb9d473a58cef3, nullptr, (TypeInfo **)__type_info__6e4393edcc5117ab_arg_types_var_5328582437946732310, __type_info__f634dcc77c9d7886_arg_names_var_11865888415215865710, 1, 0, nullptr, 12, 8, UINT64_C(0x6e4393edcc5117ab), "__lambda", 0, 0 };
+TypeInfo * __type_info__dba2dab2dac9e564_arg_types_var_5328582437946732310[1] = { &__type_info__c706e2eedf88e288 };
+VarInfo __struct_info__49f2ed7eca332f16_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__dba2dab2dac9e564_arg_types_var_5328582437946732310, __type_info__f634dcc77c9d7886_arg_names_var_11865888415215865710, 1, 0, nullptr, 12, 8, UINT64_C(0xdba2dab2dac9e564), "__finalize", 8, 0 };
+VarInfo * __struct_info__49f2ed7eca332f16_fields[2] =  { &__struct_info__49f2ed7eca332f16_field_0, &__struct_info__49f2ed7eca332f16_field_1 };
+StructInfo __struct_info__49f2ed7eca332f16 = {"_lambda_thismodule_97_2", "", 14, __struct_info__49f2ed7eca332f16_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0x49f2ed7eca332f16), 2 };
+VarInfo __func_info__ffbf43cfb430533f_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x9c314d07594b6da0), "t", 0, 0 };
+VarInfo * __func_info__ffbf43cfb430533f_fields[1] =  { &__func_info__ffbf43cfb430533f_field_0 };
+FuncInfo __func_info__ffbf43cfb430533f = {"invoke block<(t:int const):Foo const> const", "", __func_info__ffbf43cfb430533f_fields, 1, 32, &__type_info__32fb9d473a58cef3, nullptr,0,UINT64_C(0xffbf43cfb430533f), 0x0 };
+VarInfo __func_info__13d3dea8e0db4c5f_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x9c314d07594b6da0), "t", 0, 0 };
+VarInfo * __func_info__13d3dea8e0db4c5f_fields[1] =  { &__func_info__13d3dea8e0db4c5f_field_0 };
+FuncInfo __func_info__13d3dea8e0db4c5f = {"invoke block<(t:int const):Foo> const", "", __func_info__13d3dea8e0db4c5f_fields, 1, 32, &__type_info__bc69a005531fe739, nullptr,0,UINT64_C(0x13d3dea8e0db4c5f), 0x0 };
+FuncInfo __func_info__43ad68a5355c0a3c = {"invoke block<Foo const> const", "", nullptr, 0, 32, &__type_info__32fb9d473a58cef3, nullptr,0,UINT64_C(0x43ad68a5355c0a3c), 0x0 };
+FuncInfo __func_info__640e07af7ebf39e0 = {"invoke block<Foo> const", "", nullptr, 0, 32, &__type_info__bc69a005531fe739, nullptr,0,UINT64_C(0x640e07af7ebf39e0), 0x0 };
+TypeInfo __type_info__5d28185c7d1ff18d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__44ac53994fb87f65, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x5d28185c7d1ff18d) };
+TypeInfo __type_info__a03b21680c78a98d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e4d753957fcc5d65, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xa03b21680c78a98d) };
+TypeInfo __type_info__b9315deecc307fa2 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1db20dea29a617f3, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xb9315deecc307fa2) };
+TypeInfo __type_info__c706e2eedf88e288 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1db0a0ea299b0241, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xc706e2eedf88e288) };
+TypeInfo __type_info__32fb9d473a58cef3 = { Type::tStructure, &__struct_info__411ed0e77075265a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 62, 8, UINT64_C(0x32fb9d473a58cef3) };
+TypeInfo __type_info__af8afe4c86446b52 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf8afe4c86446b52) };
+TypeInfo __type_info__bc69a005531fe739 = { Type::tStructure, &__struct_info__411ed0e77075265a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 8, UINT64_C(0xbc69a005531fe739) };
+TypeInfo __type_info__44ac53994fb87f65 = { Type::tStructure, &__struct_info__a4ac1aa53d5d4f6e, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 16, UINT64_C(0x44ac53994fb87f65) };
+TypeInfo __type_info__e4d753957fcc5d65 = { Type::tStructure, &__struct_info__ae971aa5458e256e, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 16, UINT64_C(0xe4d753957fcc5d65) };
+TypeInfo __type_info__1db20dea29a617f3 = { Type::tStructure, &__struct_info__49fcfc7eca3b9d18, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 16, UINT64_C(0x1db20dea29a617f3) };
+TypeInfo __type_info__1db0a0ea299b0241 = { Type::tStructure, &__struct_info__49f2ed7eca332f16, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 16, UINT64_C(0x1db0a0ea299b0241) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void finalize_cc228f31c0b93c0a ( Context * __context__, _lambda_thismodule_94_1 & ____this_rename_at_94_0 );
+inline void finalize_67b594d609029b53 ( Context * __context__, _lambda_thismodule_97_2 & ____this_rename_at_97_1 );
+inline void finalize_79f0edd21b6a6286 ( Context * __context__, _lambda_thismodule_100_3 & ____this_rename_at_100_2 );
+inline void finalize_f2bc1f2c42f646ac ( Context * __context__, _lambda_thismodule_103_4 & ____this_rename_at_103_3 );
+inline void _FuncTickcheckInvokeTick11427060603644158917_f901befaf0540ea8 ( Context * __context__, Lambda DAS_COMMENT((Foo)) const  __obj_rename_at_54_4 );
+inline void _FuncTickcheckInvokeTick11427060603644158917_25cf9c2b0849b5f1 ( Context * __context__, Lambda DAS_COMMENT((Foo const )) const  __obj_rename_at_54_5 );
+inline void _FuncTickcheckInvokeTick3547548094355124803_58df1f101d39352f ( Context * __context__, int32_t __arg_rename_at_59_6, Lambda DAS_COMMENT((Foo,int32_t)) const  __obj_rename_at_59_7 );
+inline void _FuncTickcheckInvokeTick3547548094355124803_493e574cb38c981 ( Context * __context__, int32_t __arg_rename_at_59_8, Lambda DAS_COMMENT((Foo const ,int32_t)) const  __obj_rename_at_59_9 );
+inline void _FuncTickcheckInvokeTick11427060603644158917_a1306ba38ab7c9c3 ( Context * __context__, Func DAS_COMMENT((Foo)) const  __obj_rename_at_54_10 );
+inline void _FuncTickcheckInvokeTick3547548094355124803_3b1b06d2245638b6 ( Context * __context__, int32_t __arg_rename_at_59_11, Func DAS_COMMENT((Foo,int32_t)) const  __obj_rename_at_59_12 );
+inline void _FuncTickcheckInvokeTick11427060603644158917_fe89399fdfe80cca ( Context * __context__, Func DAS_COMMENT((Foo const )) const  __obj_rename_at_54_13 );
+inline void _FuncTickcheckInvokeTick3547548094355124803_92c2d3c9e496db72 ( Context * __context__, int32_t __arg_rename_at_59_14, Func DAS_COMMENT((Foo const ,int32_t)) const  __obj_rename_at_59_15 );
+inline void _FuncTickcheckInvokeTick11427060603644158917_56a3d2e9deca7a0 ( Context * __context__, Block DAS_COMMENT((Foo)) const  & __obj_rename_at_54_16 );
+inline void _FuncTickcheckInvokeTick11427060603644158917_efed2c21aafca852 ( Context * __context__, Block DAS_COMMENT((Foo const )) const  & __obj_rename_at_54_17 );
+inline void _FuncTickcheckInvokeTick3547548094355124803_f70625fc035e0461 ( Context * __context__, int32_t __arg_rename_at_59_18, Block DAS_COMMENT((Foo,int32_t)) const  & __obj_rename_at_59_19 );
+inline void _FuncTickcheckInvokeTick3547548094355124803_ec79977a62c5933e ( Context * __context__, int32_t __arg_rename_at_59_20, Block DAS_COMMENT((Foo const ,int32_t)) const  & __obj_rename_at_59_21 );
+inline Foo _Func_lambda_thismodule_94_1Tickfunction_bcf5ac20997e019c ( Context * __context__, _lambda_thismodule_94_1 & ____this_rename_at_94_22 );
+inline void _Func_lambda_thismodule_94_1Tickfinalizer_d168f89c910059cf ( Context * __context__, _lambda_thismodule_94_1 * ____this_rename_at_94_23 );
+inline Foo _Func_lambda_thismodule_97_2Tickfunction_afaba1b2136c472a ( Context * __context__, _lambda_thismodule_97_2 & ____this_rename_at_97_24 );
+inline void _Func_lambda_thismodule_97_2Tickfinalizer_b376bb57a06d127b ( Context * __context__, _lambda_thismodule_97_2 * ____this_rename_at_97_25 );
+inline Foo _Func_lambda_thismodule_100_3Tickfunction_3dce507b53598e41 ( Context * __context__, _lambda_thismodule_100_3 & ____this_rename_at_100_26, int32_t __t_rename_at_100_27 );
+inline void _Func_lambda_thismodule_100_3Tickfinalizer_efaee297cbccbd3b ( Context * __context__, _lambda_thismodule_100_3 * ____this_rename_at_100_28 );
+inline Foo _Func_lambda_thismodule_103_4Tickfunction_708fd811e9588b94 ( Context * __context__, _lambda_thismodule_103_4 & ____this_rename_at_103_29, int32_t __t_rename_at_103_30 );
+inline void _Func_lambda_thismodule_103_4Tickfinalizer_4be51897ee527c5 ( Context * __context__, _lambda_thismodule_103_4 * ____this_rename_at_103_31 );
+inline Foo func_1db7cd5e42c81c9d ( Context * __context__ );
+inline Foo funcC_e5f8e69a4bf4633e ( Context * __context__ );
+inline Foo funcA_3a3a5b62506ab5a2 ( Context * __context__, int32_t __t_rename_at_20_32 );
+inline Foo funcAC_1652a02a3635f865 ( Context * __context__, int32_t __t_rename_at_24_33 );
+inline Foo hfunc_1db7cd5e42c81c9d ( Context * __context__ );
+inline Foo hfuncC_e5f8e69a4bf4633e ( Context * __context__ );
+inline Foo hfuncA_3a3a5b62506ab5a2 ( Context * __context__, int32_t __t_rename_at_39_34 );
+inline Foo hfuncAC_1652a02a3635f865 ( Context * __context__, int32_t __t_rename_at_44_35 );
+inline void check_34b6cea776fb58ea ( Context * __context__, Foo const  & __t_rename_at_49_36 );
+inline bool test_3af139ec57e5e873 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void finalize_cc228f31c0b93c0a ( Context * __context__, _lambda_thismodule_94_1 &  ____this_rename_at_94_0 )
+{
+    memset((void*)&(____this_rename_at_94_0), 0, 16);
+}
+
+inline void finalize_67b594d609029b53 ( Context * __context__, _lambda_thismodule_97_2 &  ____this_rename_at_97_1 )
+{
+    memset((void*)&(____this_rename_at_97_1), 0, 16);
+}
+
+inline void finalize_79f0edd21b6a6286 ( Context * __context__, _lambda_thismodule_100_3 &  ____this_rename_at_100_2 )
+{
+    memset((void*)&(____this_rename_at_100_2), 0, 16);
+}
+
+inline void finalize_f2bc1f2c42f646ac ( Context * __context__, _lambda_thismodule_103_4 &  ____this_rename_at_103_3 )
+{
+    memset((void*)&(____this_rename_at_103_3), 0, 16);
+}
+
+inline void _FuncTickcheckInvokeTick11427060603644158917_f901befaf0540ea8 ( Context * __context__, Lambda DAS_COMMENT((Foo)) const  __obj_rename_at_54_4 )
+{
+    check_34b6cea776fb58ea(__context__,das_arg<Foo>::pass(das_invoke_lambda<Foo>::invoke_cmres(__context__,nullptr,__obj_rename_at_54_4)));
+}
+
+inline void _FuncTickcheckInvokeTick11427060603644158917_25cf9c2b0849b5f1 ( Context * __context__, Lambda DAS_COMMENT((Foo const )) const  __obj_rename_at_54_5 )
+{
+    check_34b6cea776fb58ea(__context__,das_invoke_lambda<Foo>::invoke_cmres(__context__,nullptr,__obj_rename_at_54_5));
+}
+
+inline void _FuncTickcheckInvokeTick3547548094355124803_58df1f101d39352f ( Context * __context__, int32_t __arg_rename_at_59_6, Lambda DAS_COMMENT((Foo,int32_t)) const  __obj_rename_at_59_7 )
+{
+    check_34b6cea776fb58ea(__context__,das_arg<Foo>::pass(das_invoke_lambda<Foo>::invoke_cmres<int32_t>(__context__,nullptr,__obj_rename_at_59_7,__arg_rename_at_59_6)));
+}
+
+inline void _FuncTickcheckInvokeTick3547548094355124803_493e574cb38c981 ( Context * __context__, int32_t __arg_rename_at_59_8, Lambda DAS_COMMENT((Foo const ,int32_t)) const  __obj_rename_at_59_9 )
+{
+    check_34b6cea776fb58ea(__context__,das_invoke_lambda<Foo>::invoke_cmres<int32_t>(__context__,nullptr,__obj_rename_at_59_9,__arg_rename_at_59_8));
+}
+
+inline void _FuncTickcheckInvokeTick11427060603644158917_a1306ba38ab7c9c3 ( Context * __context__, Func DAS_COMMENT((Foo)) const  __obj_rename_at_54_10 )
+{
+    check_34b6cea776fb58ea(__context__,das_arg<Foo>::pass(das_invoke_function<Foo>::invoke_cmres(__context__,nullptr,__obj_rename_at_54_10)));
+}
+
+inline void _FuncTickcheckInvokeTick3547548094355124803_3b1b06d2245638b6 ( Context * __context__, int32_t __arg_rename_at_59_11, Func DAS_COMMENT((Foo,int32_t)) const  __obj_rename_at_59_12 )
+{
+    check_34b6cea776fb58ea(__context__,das_arg<Foo>::pass(das_invoke_function<Foo>::invoke_cmres<int32_t>(__context__,nullptr,__obj_rename_at_59_12,__arg_rename_at_59_11)));
+}
+
+inline void _FuncTickcheckInvokeTick11427060603644158917_fe89399fdfe80cca ( Context * __context__, Func DAS_COMMENT((Foo const )) const  __obj_rename_at_54_13 )
+{
+    check_34b6cea776fb58ea(__context__,das_invoke_function<Foo>::invoke_cmres(__context__,nullptr,__obj_rename_at_54_13));
+}
+
+inline void _FuncTickcheckInvokeTick3547548094355124803_92c2d3c9e496db72 ( Context * __context__, int32_t __arg_rename_at_59_14, Func DAS_COMMENT((Foo const ,int32_t)) const  __obj_rename_at_59_15 )
+{
+    check_34b6cea776fb58ea(__context__,das_invoke_function<Foo>::invoke_cmres<int32_t>(__context__,nullptr,__obj_rename_at_59_15,__arg_rename_at_59_14));
+}
+
+inline void _FuncTickcheckInvokeTick11427060603644158917_56a3d2e9deca7a0 ( Context * __context__, Block DAS_COMMENT((Foo)) const  &  __obj_rename_at_54_16 )
+{
+    check_34b6cea776fb58ea(__context__,das_arg<Foo>::pass(das_invoke<Foo>::invoke_cmres(__context__,nullptr,__obj_rename_at_54_16)));
+}
+
+inline void _FuncTickcheckInvokeTick11427060603644158917_efed2c21aafca852 ( Context * __context__, Block DAS_COMMENT((Foo const )) const  &  __obj_rename_at_54_17 )
+{
+    check_34b6cea776fb58ea(__context__,das_invoke<Foo>::invoke_cmres(__context__,nullptr,__obj_rename_at_54_17));
+}
+
+inline void _FuncTickcheckInvokeTick3547548094355124803_f70625fc035e0461 ( Context * __context__, int32_t __arg_rename_at_59_18, Block DAS_COMMENT((Foo,int32_t)) const  &  __obj_rename_at_59_19 )
+{
+    check_34b6cea776fb58ea(__context__,das_arg<Foo>::pass(das_invoke<Foo>::invoke_cmres<int32_t>(__context__,nullptr,__obj_rename_at_59_19,__arg_rename_at_59_18)));
+}
+
+inline void _FuncTickcheckInvokeTick3547548094355124803_ec79977a62c5933e ( Context * __context__, int32_t __arg_rename_at_59_20, Block DAS_COMMENT((Foo const ,int32_t)) const  &  __obj_rename_at_59_21 )
+{
+    check_34b6cea776fb58ea(__context__,das_invoke<Foo>::invoke_cmres<int32_t>(__context__,nullptr,__obj_rename_at_59_21,__arg_rename_at_59_20));
+}
+
+inline Foo _Func_lambda_thismodule_94_1Tickfunction_bcf5ac20997e019c ( Context * __context__, _lambda_thismodule_94_1 &  ____this_rename_at_94_22 )
+{
+    return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+        Foo __mks_95;
+        das_copy((__mks_95.a),(1));
+        das_copy((__mks_95.b),(2));
+        return __mks_95;
+    })()));
+}
+
+inline void _Func_lambda_thismodule_94_1Tickfinalizer_d168f89c910059cf ( Context * __context__, _lambda_thismodule_94_1 * ____this_rename_at_94_23 )
+{
+    finalize_cc228f31c0b93c0a(__context__,das_arg<_lambda_thismodule_94_1>::pass(das_deref(__context__,____this_rename_at_94_23,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_94_1 *>::clear(__context__,____this_rename_at_94_23);
+}
+
+inline Foo _Func_lambda_thismodule_97_2Tickfunction_afaba1b2136c472a ( Context * __context__, _lambda_thismodule_97_2 &  ____this_rename_at_97_24 )
+{
+    return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+        Foo __mks_98;
+        das_copy((__mks_98.a),(1));
+        das_copy((__mks_98.b),(2));
+        return __mks_98;
+    })()));
+}
+
+inline void _Func_lambda_thismodule_97_2Tickfinalizer_b376bb57a06d127b ( Context * __context__, _lambda_thismodule_97_2 * ____this_rename_at_97_25 )
+{
+    finalize_67b594d609029b53(__context__,das_arg<_lambda_thismodule_97_2>::pass(das_deref(__context__,____this_rename_at_97_25,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_97_2 *>::clear(__context__,____this_rename_at_97_25);
+}
+
+inline Foo _Func_lambda_thismodule_100_3Tickfunction_3dce507b53598e41 ( Context * __context__, _lambda_thismodule_100_3 &  ____this_rename_at_100_26, int32_t __t_rename_at_100_27 )
+{
+    return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+        Foo __mks_101;
+        das_copy((__mks_101.a),(__t_rename_at_100_27));
+        das_copy((__mks_101.b),((__t_rename_at_100_27 + 1)));
+        return __mks_101;
+    })()));
+}
+
+inline void _Func_lambda_thismodule_100_3Tickfinalizer_efaee297cbccbd3b ( Context * __context__, _lambda_thismodule_100_3 * ____this_rename_at_100_28 )
+{
+    finalize_79f0edd21b6a6286(__context__,das_arg<_lambda_thismodule_100_3>::pass(das_deref(__context__,____this_rename_at_100_28,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_100_3 *>::clear(__context__,____this_rename_at_100_28);
+}
+
+inline Foo _Func_lambda_thismodule_103_4Tickfunction_708fd811e9588b94 ( Context * __context__, _lambda_thismodule_103_4 &  ____this_rename_at_103_29, int32_t __t_rename_at_103_30 )
+{
+    return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+        Foo __mks_104;
+        das_copy((__mks_104.a),(__t_rename_at_103_30));
+        das_copy((__mks_104.b),((__t_rename_at_103_30 + 1)));
+        return __mks_104;
+    })()));
+}
+
+inline void _Func_lambda_thismodule_103_4Tickfinalizer_4be51897ee527c5 ( Context * __context__, _lambda_thismodule_103_4 * ____this_rename_at_103_31 )
+{
+    finalize_f2bc1f2c42f646ac(__context__,das_arg<_lambda_thismodule_103_4>::pass(das_deref(__context__,____this_rename_at_103_31,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_103_4 *>::clear(__context__,____this_rename_at_103_31);
+}
+
+inline Foo func_1db7cd5e42c81c9d ( Context * __context__ )
+{
+    return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+        Foo __mks_13;
+        das_copy((__mks_13.a),(1));
+        das_copy((__mks_13.b),(2));
+        return __mks_13;
+    })()));
+}
+
+inline Foo funcC_e5f8e69a4bf4633e ( Context * __context__ )
+{
+    return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+        Foo __mks_17;
+        das_copy((__mks_17.a),(1));
+        das_copy((__mks_17.b),(2));
+        return __mks_17;
+    })()));
+}
+
+inline Foo funcA_3a3a5b62506ab5a2 ( Context * __context__, int32_t __t_rename_at_20_32 )
+{
+    return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+        Foo __mks_21;
+        das_copy((__mks_21.a),(__t_rename_at_20_32));
+        das_copy((__mks_21.b),((__t_rename_at_20_32 + 1)));
+        return __mks_21;
+    })()));
+}
+
+inline Foo funcAC_1652a02a3635f865 ( Context * __context__, int32_t __t_rename_at_24_33 )
+{
+    return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+        Foo __mks_25;
+        das_copy((__mks_25.a),(__t_rename_at_24_33));
+        das_copy((__mks_25.b),((__t_rename_at_24_33 + 1)));
+        return __mks_25;
+    })()));
+}
+
+inline Foo hfunc_1db7cd5e42c81c9d ( Context * __context__ )
+{
+    return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+        Foo __mks_30;
+        das_copy((__mks_30.a),(1));
+        das_copy((__mks_30.b),(2));
+        return __mks_30;
+    })()));
+}
+
+inline Foo hfuncC_e5f8e69a4bf4633e ( Context * __context__ )
+{
+    return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+        Foo __mks_35;
+        das_copy((__mks_35.a),(1));
+        das_copy((__mks_35.b),(2));
+        return __mks_35;
+    })()));
+}
+
+inline Foo hfuncA_3a3a5b62506ab5a2 ( Context * __context__, int32_t __t_rename_at_39_34 )
+{
+    return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+        Foo __mks_40;
+        das_copy((__mks_40.a),(__t_rename_at_39_34));
+        das_copy((__mks_40.b),((__t_rename_at_39_34 + 1)));
+        return __mks_40;
+    })()));
+}
+
+inline Foo hfuncAC_1652a02a3635f865 ( Context * __context__, int32_t __t_rename_at_44_35 )
+{
+    return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+        Foo __mks_45;
+        das_copy((__mks_45.a),(__t_rename_at_44_35));
+        das_copy((__mks_45.b),((__t_rename_at_44_35 + 1)));
+        return __mks_45;
+    })()));
+}
+
+inline void check_34b6cea776fb58ea ( Context * __context__, Foo const  &  __t_rename_at_49_36 )
+{
+    DAS_ASSERT(((__t_rename_at_49_36.a == 1) && (__t_rename_at_49_36.b == 2)));
+}
+
+inline bool test_3af139ec57e5e873 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,112,"test " DAS_FILE_LINE);
+{
+    Foo _temp_make_local_66_10_0; _temp_make_local_66_10_0;
+    Foo _temp_make_local_67_10_1; _temp_make_local_67_10_1;
+    Foo _temp_make_local_68_10_2; _temp_make_local_68_10_2;
+    Foo _temp_make_local_69_10_3; _temp_make_local_69_10_3;
+    Foo _temp_make_local_71_10_4; _temp_make_local_71_10_4;
+    Foo _temp_make_local_72_10_5; _temp_make_local_72_10_5;
+    Foo _temp_make_local_73_10_6; _temp_make_local_73_10_6;
+    Foo _temp_make_local_74_10_7; _temp_make_local_74_10_7;
+    check_34b6cea776fb58ea(__context__,das_arg<Foo>::pass((_temp_make_local_66_10_0 = (func_1db7cd5e42c81c9d(__context__)))));
+    check_34b6cea776fb58ea(__context__,das_arg<Foo>::pass((_temp_make_local_67_10_1 = (funcA_3a3a5b62506ab5a2(__context__,1)))));
+    check_34b6cea776fb58ea(__context__,(_temp_make_local_68_10_2 = (funcC_e5f8e69a4bf4633e(__context__))));
+    check_34b6cea776fb58ea(__context__,(_temp_make_local_69_10_3 = (funcAC_1652a02a3635f865(__context__,1))));
+    check_34b6cea776fb58ea(__context__,das_arg<Foo>::pass((_temp_make_local_71_10_4 = (das_invoke_function<Foo>::invoke_cmres(__context__,nullptr,Func(__context__->fnByMangledName(/*hfunc*/ 0x783e0bbfcb8f8edf)))))));
+    check_34b6cea776fb58ea(__context__,das_arg<Foo>::pass((_temp_make_local_72_10_5 = (das_invoke_function<Foo>::invoke_cmres<int32_t>(__context__,nullptr,Func(__context__->fnByMangledName(/*hfuncA Ci*/ 0x6571fa22a7c9122c)),1)))));
+    check_34b6cea776fb58ea(__context__,(_temp_make_local_73_10_6 = (das_invoke_function<Foo>::invoke_cmres(__context__,nullptr,Func(__context__->fnByMangledName(/*hfuncC*/ 0x78010bbfcb27e7df))))));
+    check_34b6cea776fb58ea(__context__,(_temp_make_local_74_10_7 = (das_invoke_function<Foo>::invoke_cmres<int32_t>(__context__,nullptr,Func(__context__->fnByMangledName(/*hfuncAC Ci*/ 0xf454f42247fae2d5)),1))));
+    _FuncTickcheckInvokeTick11427060603644158917_a1306ba38ab7c9c3(__context__,Func(__context__->fnByMangledName(/*func*/ 0xb6475a08492106f5)));
+    _FuncTickcheckInvokeTick3547548094355124803_3b1b06d2245638b6(__context__,1,Func(__context__->fnByMangledName(/*funcA Ci*/ 0xd3c1d16e68ddec2d)));
+    _FuncTickcheckInvokeTick11427060603644158917_fe89399fdfe80cca(__context__,Func(__context__->fnByMangledName(/*funcC*/ 0xdc44b214431e6742)));
+    _FuncTickcheckInvokeTick3547548094355124803_92c2d3c9e496db72(__context__,1,Func(__context__->fnByMangledName(/*funcAC Ci*/ 0xbd0c4333e20a0d07)));
+    _FuncTickcheckInvokeTick11427060603644158917_56a3d2e9deca7a0(__context__,das_make_block_cmres<Foo>(__context__,80,0,&__func_info__640e07af7ebf39e0,[&]() -> Foo{
+        return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+            Foo __mks_82;
+            das_copy((__mks_82.a),(1));
+            das_copy((__mks_82.b),(2));
+            return __mks_82;
+        })()));
+    }));
+    _FuncTickcheckInvokeTick11427060603644158917_efed2c21aafca852(__context__,das_make_block_cmres<Foo>(__context__,80,0,&__func_info__43ad68a5355c0a3c,[&]() -> Foo{
+        return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+            Foo __mks_85;
+            das_copy((__mks_85.a),(1));
+            das_copy((__mks_85.b),(2));
+            return __mks_85;
+        })()));
+    }));
+    _FuncTickcheckInvokeTick3547548094355124803_f70625fc035e0461(__context__,1,das_make_block_cmres<Foo,int32_t>(__context__,80,0,&__func_info__13d3dea8e0db4c5f,[&](int32_t const  __t_rename_at_87_37) -> Foo{
+        return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+            Foo __mks_88;
+            das_copy((__mks_88.a),(__t_rename_at_87_37));
+            das_copy((__mks_88.b),((__t_rename_at_87_37 + 1)));
+            return __mks_88;
+        })()));
+    }));
+    _FuncTickcheckInvokeTick3547548094355124803_ec79977a62c5933e(__context__,1,das_make_block_cmres<Foo,int32_t>(__context__,80,0,&__func_info__ffbf43cfb430533f,[&](int32_t const  __t_rename_at_90_38) -> Foo{
+        return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+            Foo __mks_91;
+            das_copy((__mks_91.a),(__t_rename_at_90_38));
+            das_copy((__mks_91.b),((__t_rename_at_90_38 + 1)));
+            return __mks_91;
+        })()));
+    }));
+    _FuncTickcheckInvokeTick11427060603644158917_f901befaf0540ea8(__context__,das_ascend<Foo,_lambda_thismodule_94_1>::make(__context__,&__type_info__1db20dea29a617f3,(([&]() -> _lambda_thismodule_94_1 {
+        _lambda_thismodule_94_1 __mks_94;
+        das_copy((__mks_94.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_94_1`function XS<_lambda_thismodule_94_1>*/ 0x2678bc32bb2a8e29))));
+        das_copy((__mks_94.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_94_1`finalizer X1<S<_lambda_thismodule_94_1>>?*/ 0xa0dcc2304d221ed))));
+        return __mks_94;
+    })())));
+    _FuncTickcheckInvokeTick11427060603644158917_25cf9c2b0849b5f1(__context__,das_ascend<Foo,_lambda_thismodule_97_2>::make(__context__,&__type_info__1db0a0ea299b0241,(([&]() -> _lambda_thismodule_97_2 {
+        _lambda_thismodule_97_2 __mks_97;
+        das_copy((__mks_97.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_97_2`function XS<_lambda_thismodule_97_2>*/ 0x46297387503d31a1))));
+        das_copy((__mks_97.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_97_2`finalizer X1<S<_lambda_thismodule_97_2>>?*/ 0xd73371e7e180d227))));
+        return __mks_97;
+    })())));
+    _FuncTickcheckInvokeTick3547548094355124803_58df1f101d39352f(__context__,1,das_ascend<Foo,_lambda_thismodule_100_3>::make(__context__,&__type_info__44ac53994fb87f65,(([&]() -> _lambda_thismodule_100_3 {
+        _lambda_thismodule_100_3 __mks_100;
+        das_copy((__mks_100.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_100_3`function XS<_lambda_thismodule_100_3> Ci*/ 0xaaf54a26a8bda962))));
+        das_copy((__mks_100.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_100_3`finalizer X1<S<_lambda_thismodule_100_3>>?*/ 0xe340279b86e038d6))));
+        return __mks_100;
+    })())));
+    _FuncTickcheckInvokeTick3547548094355124803_493e574cb38c981(__context__,1,das_ascend<Foo,_lambda_thismodule_103_4>::make(__context__,&__type_info__e4d753957fcc5d65,(([&]() -> _lambda_thismodule_103_4 {
+        _lambda_thismodule_103_4 __mks_103;
+        das_copy((__mks_103.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_103_4`function XS<_lambda_thismodule_103_4> Ci*/ 0x1ce89d097cac0638))));
+        das_copy((__mks_103.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_103_4`finalizer X1<S<_lambda_thismodule_103_4>>?*/ 0x1f1b76e42be0b0d6))));
+        return __mks_103;
+    })())));
+    return das_auto_cast<bool>::cast(true);
+}}
+static vec4f __wrap_finalize_cc228f31c0b93c0a ( Context * __context__ ) {
+    _lambda_thismodule_94_1 &  arg___this = cast_aot_arg<_lambda_thismodule_94_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_cc228f31c0b93c0a(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_67b594d609029b53 ( Context * __context__ ) {
+    _lambda_thismodule_97_2 &  arg___this = cast_aot_arg<_lambda_thismodule_97_2 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_67b594d609029b53(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_79f0edd21b6a6286 ( Context * __context__ ) {
+    _lambda_thismodule_100_3 &  arg___this = cast_aot_arg<_lambda_thismodule_100_3 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_79f0edd21b6a6286(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_f2bc1f2c42f646ac ( Context * __context__ ) {
+    _lambda_thismodule_103_4 &  arg___this = cast_aot_arg<_lambda_thismodule_103_4 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_f2bc1f2c42f646ac(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickcheckInvokeTick11427060603644158917_f901befaf0540ea8 ( Context * __context__ ) {
+    Lambda DAS_COMMENT((Foo)) const  arg_obj = cast_aot_arg<Lambda DAS_COMMENT((Foo)) const >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickcheckInvokeTick11427060603644158917_f901befaf0540ea8(__context__, arg_obj);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickcheckInvokeTick11427060603644158917_25cf9c2b0849b5f1 ( Context * __context__ ) {
+    Lambda DAS_COMMENT((Foo const )) const  arg_obj = cast_aot_arg<Lambda DAS_COMMENT((Foo const )) const >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickcheckInvokeTick11427060603644158917_25cf9c2b0849b5f1(__context__, arg_obj);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickcheckInvokeTick3547548094355124803_58df1f101d39352f ( Context * __context__ ) {
+    int32_t arg_arg = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    Lambda DAS_COMMENT((Foo,int32_t)) const  arg_obj = cast_aot_arg<Lambda DAS_COMMENT((Foo,int32_t)) const >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTickcheckInvokeTick3547548094355124803_58df1f101d39352f(__context__, arg_arg, arg_obj);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickcheckInvokeTick3547548094355124803_493e574cb38c981 ( Context * __context__ ) {
+    int32_t arg_arg = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    Lambda DAS_COMMENT((Foo const ,int32_t)) const  arg_obj = cast_aot_arg<Lambda DAS_COMMENT((Foo const ,int32_t)) const >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTickcheckInvokeTick3547548094355124803_493e574cb38c981(__context__, arg_arg, arg_obj);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickcheckInvokeTick11427060603644158917_a1306ba38ab7c9c3 ( Context * __context__ ) {
+    Func DAS_COMMENT((Foo)) const  arg_obj = cast_aot_arg<Func DAS_COMMENT((Foo)) const >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickcheckInvokeTick11427060603644158917_a1306ba38ab7c9c3(__context__, arg_obj);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickcheckInvokeTick3547548094355124803_3b1b06d2245638b6 ( Context * __context__ ) {
+    int32_t arg_arg = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    Func DAS_COMMENT((Foo,int32_t)) const  arg_obj = cast_aot_arg<Func DAS_COMMENT((Foo,int32_t)) const >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTickcheckInvokeTick3547548094355124803_3b1b06d2245638b6(__context__, arg_arg, arg_obj);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickcheckInvokeTick11427060603644158917_fe89399fdfe80cca ( Context * __context__ ) {
+    Func DAS_COMMENT((Foo const )) const  arg_obj = cast_aot_arg<Func DAS_COMMENT((Foo const )) const >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickcheckInvokeTick11427060603644158917_fe89399fdfe80cca(__context__, arg_obj);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickcheckInvokeTick3547548094355124803_92c2d3c9e496db72 ( Context * __context__ ) {
+    int32_t arg_arg = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    Func DAS_COMMENT((Foo const ,int32_t)) const  arg_obj = cast_aot_arg<Func DAS_COMMENT((Foo const ,int32_t)) const >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTickcheckInvokeTick3547548094355124803_92c2d3c9e496db72(__context__, arg_arg, arg_obj);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickcheckInvokeTick11427060603644158917_56a3d2e9deca7a0 ( Context * __context__ ) {
+    Block DAS_COMMENT((Foo)) const  &  arg_obj = cast_aot_arg<Block DAS_COMMENT((Foo)) const  & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickcheckInvokeTick11427060603644158917_56a3d2e9deca7a0(__context__, arg_obj);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickcheckInvokeTick11427060603644158917_efed2c21aafca852 ( Context * __context__ ) {
+    Block DAS_COMMENT((Foo const )) const  &  arg_obj = cast_aot_arg<Block DAS_COMMENT((Foo const )) const  & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickcheckInvokeTick11427060603644158917_efed2c21aafca852(__context__, arg_obj);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickcheckInvokeTick3547548094355124803_f70625fc035e0461 ( Context * __context__ ) {
+    int32_t arg_arg = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((Foo,int32_t)) const  &  arg_obj = cast_aot_arg<Block DAS_COMMENT((Foo,int32_t)) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTickcheckInvokeTick3547548094355124803_f70625fc035e0461(__context__, arg_arg, arg_obj);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickcheckInvokeTick3547548094355124803_ec79977a62c5933e ( Context * __context__ ) {
+    int32_t arg_arg = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((Foo const ,int32_t)) const  &  arg_obj = cast_aot_arg<Block DAS_COMMENT((Foo const ,int32_t)) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTickcheckInvokeTick3547548094355124803_ec79977a62c5933e(__context__, arg_arg, arg_obj);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_94_1Tickfunction_bcf5ac20997e019c ( Context * __context__ ) {
+    _lambda_thismodule_94_1 &  arg___this = cast_aot_arg<_lambda_thismodule_94_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Foo *) __context__->abiCMRES) = _Func_lambda_thismodule_94_1Tickfunction_bcf5ac20997e019c(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_94_1Tickfinalizer_d168f89c910059cf ( Context * __context__ ) {
+    _lambda_thismodule_94_1 * arg___this = cast_aot_arg<_lambda_thismodule_94_1 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_94_1Tickfinalizer_d168f89c910059cf(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_97_2Tickfunction_afaba1b2136c472a ( Context * __context__ ) {
+    _lambda_thismodule_97_2 &  arg___this = cast_aot_arg<_lambda_thismodule_97_2 & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Foo *) __context__->abiCMRES) = _Func_lambda_thismodule_97_2Tickfunction_afaba1b2136c472a(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_97_2Tickfinalizer_b376bb57a06d127b ( Context * __context__ ) {
+    _lambda_thismodule_97_2 * arg___this = cast_aot_arg<_lambda_thismodule_97_2 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_97_2Tickfinalizer_b376bb57a06d127b(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_100_3Tickfunction_3dce507b53598e41 ( Context * __context__ ) {
+    _lambda_thismodule_100_3 &  arg___this = cast_aot_arg<_lambda_thismodule_100_3 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_t = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    *((Foo *) __context__->abiCMRES) = _Func_lambda_thismodule_100_3Tickfunction_3dce507b53598e41(__context__, arg___this, arg_t);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_100_3Tickfinalizer_efaee297cbccbd3b ( Context * __context__ ) {
+    _lambda_thismodule_100_3 * arg___this = cast_aot_arg<_lambda_thismodule_100_3 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_100_3Tickfinalizer_efaee297cbccbd3b(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_103_4Tickfunction_708fd811e9588b94 ( Context * __context__ ) {
+    _lambda_thismodule_103_4 &  arg___this = cast_aot_arg<_lambda_thismodule_103_4 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_t = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    *((Foo *) __context__->abiCMRES) = _Func_lambda_thismodule_103_4Tickfunction_708fd811e9588b94(__context__, arg___this, arg_t);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_103_4Tickfinalizer_4be51897ee527c5 ( Context * __context__ ) {
+    _lambda_thismodule_103_4 * arg___this = cast_aot_arg<_lambda_thismodule_103_4 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_103_4Tickfinalizer_4be51897ee527c5(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_func_1db7cd5e42c81c9d ( Context * __context__ ) {
+    *((Foo *) __context__->abiCMRES) = func_1db7cd5e42c81c9d(__context__);
+    return v_zero();
+}
+static vec4f __wrap_funcC_e5f8e69a4bf4633e ( Context * __context__ ) {
+    *((Foo *) __context__->abiCMRES) = funcC_e5f8e69a4bf4633e(__context__);
+    return v_zero();
+}
+static vec4f __wrap_funcA_3a3a5b62506ab5a2 ( Context * __context__ ) {
+    int32_t arg_t = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    *((Foo *) __context__->abiCMRES) = funcA_3a3a5b62506ab5a2(__context__, arg_t);
+    return v_zero();
+}
+static vec4f __wrap_funcAC_1652a02a3635f865 ( Context * __context__ ) {
+    int32_t arg_t = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    *((Foo *) __context__->abiCMRES) = funcAC_1652a02a3635f865(__context__, arg_t);
+    return v_zero();
+}
+static vec4f __wrap_hfunc_1db7cd5e42c81c9d ( Context * __context__ ) {
+    *((Foo *) __context__->abiCMRES) = hfunc_1db7cd5e42c81c9d(__context__);
+    return v_zero();
+}
+static vec4f __wrap_hfuncC_e5f8e69a4bf4633e ( Context * __context__ ) {
+    *((Foo *) __context__->abiCMRES) = hfuncC_e5f8e69a4bf4633e(__context__);
+    return v_zero();
+}
+static vec4f __wrap_hfuncA_3a3a5b62506ab5a2 ( Context * __context__ ) {
+    int32_t arg_t = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    *((Foo *) __context__->abiCMRES) = hfuncA_3a3a5b62506ab5a2(__context__, arg_t);
+    return v_zero();
+}
+static vec4f __wrap_hfuncAC_1652a02a3635f865 ( Context * __context__ ) {
+    int32_t arg_t = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    *((Foo *) __context__->abiCMRES) = hfuncAC_1652a02a3635f865(__context__, arg_t);
+    return v_zero();
+}
+static vec4f __wrap_check_34b6cea776fb58ea ( Context * __context__ ) {
+    Foo const  &  arg_t = cast_aot_arg<Foo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    check_34b6cea776fb58ea(__context__, arg_t);
+    return v_zero();
+}
+static vec4f __wrap_test_3af139ec57e5e873 ( Context * __context__ ) {
+    return cast<bool>::from(test_3af139ec57e5e873(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x843f206cc2d81b99, false, (void*)&finalize_cc228f31c0b93c0a, &__wrap_finalize_cc228f31c0b93c0a },
+    { 0x637669f1f44319b7, false, (void*)&finalize_67b594d609029b53, &__wrap_finalize_67b594d609029b53 },
+    { 0x7ecf78255a74355a, false, (void*)&finalize_79f0edd21b6a6286, &__wrap_finalize_79f0edd21b6a6286 },
+    { 0x9f57e4e4635d574f, false, (void*)&finalize_f2bc1f2c42f646ac, &__wrap_finalize_f2bc1f2c42f646ac },
+    { 0xae1073daaa997de7, false, (void*)&_FuncTickcheckInvokeTick11427060603644158917_f901befaf0540ea8, &__wrap__FuncTickcheckInvokeTick11427060603644158917_f901befaf0540ea8 },
+    { 0xa9f9f384f37e01b6, false, (void*)&_FuncTickcheckInvokeTick11427060603644158917_25cf9c2b0849b5f1, &__wrap__FuncTickcheckInvokeTick11427060603644158917_25cf9c2b0849b5f1 },
+    { 0x969413438e29d350, false, (void*)&_FuncTickcheckInvokeTick3547548094355124803_58df1f101d39352f, &__wrap__FuncTickcheckInvokeTick3547548094355124803_58df1f101d39352f },
+    { 0x9ba42d45b6959eb4, false, (void*)&_FuncTickcheckInvokeTick3547548094355124803_493e574cb38c981, &__wrap__FuncTickcheckInvokeTick3547548094355124803_493e574cb38c981 },
+    { 0xc5085011814ce760, false, (void*)&_FuncTickcheckInvokeTick11427060603644158917_a1306ba38ab7c9c3, &__wrap__FuncTickcheckInvokeTick11427060603644158917_a1306ba38ab7c9c3 },
+    { 0x40b664479c12eef0, false, (void*)&_FuncTickcheckInvokeTick3547548094355124803_3b1b06d2245638b6, &__wrap__FuncTickcheckInvokeTick3547548094355124803_3b1b06d2245638b6 },
+    { 0xb5bf6ce49039398c, false, (void*)&_FuncTickcheckInvokeTick11427060603644158917_fe89399fdfe80cca, &__wrap__FuncTickcheckInvokeTick11427060603644158917_fe89399fdfe80cca },
+    { 0x80160936c5968f5, false, (void*)&_FuncTickcheckInvokeTick3547548094355124803_92c2d3c9e496db72, &__wrap__FuncTickcheckInvokeTick3547548094355124803_92c2d3c9e496db72 },
+    { 0xc72d3fd122f54e82, false, (void*)&_FuncTickcheckInvokeTick11427060603644158917_56a3d2e9deca7a0, &__wrap__FuncTickcheckInvokeTick11427060603644158917_56a3d2e9deca7a0 },
+    { 0x3fcfafcc31109528, false, (void*)&_FuncTickcheckInvokeTick11427060603644158917_efed2c21aafca852, &__wrap__FuncTickcheckInvokeTick11427060603644158917_efed2c21aafca852 },
+    { 0x13afbdf76313bfdd, false, (void*)&_FuncTickcheckInvokeTick3547548094355124803_f70625fc035e0461, &__wrap__FuncTickcheckInvokeTick3547548094355124803_f70625fc035e0461 },
+    { 0x2a3c0de0870ec725, false, (void*)&_FuncTickcheckInvokeTick3547548094355124803_ec79977a62c5933e, &__wrap__FuncTickcheckInvokeTick3547548094355124803_ec79977a62c5933e },
+    { 0x749731f5c59bf920, true, (void*)&_Func_lambda_thismodule_94_1Tickfunction_bcf5ac20997e019c, &__wrap__Func_lambda_thismodule_94_1Tickfunction_bcf5ac20997e019c },
+    { 0x276f5d2b611b6d9b, false, (void*)&_Func_lambda_thismodule_94_1Tickfinalizer_d168f89c910059cf, &__wrap__Func_lambda_thismodule_94_1Tickfinalizer_d168f89c910059cf },
+    { 0xb885e7ed6bb8417a, true, (void*)&_Func_lambda_thismodule_97_2Tickfunction_afaba1b2136c472a, &__wrap__Func_lambda_thismodule_97_2Tickfunction_afaba1b2136c472a },
+    { 0x63d0599c9d67cf21, false, (void*)&_Func_lambda_thismodule_97_2Tickfinalizer_b376bb57a06d127b, &__wrap__Func_lambda_thismodule_97_2Tickfinalizer_b376bb57a06d127b },
+    { 0x239f1dee089853b3, true, (void*)&_Func_lambda_thismodule_100_3Tickfunction_3dce507b53598e41, &__wrap__Func_lambda_thismodule_100_3Tickfunction_3dce507b53598e41 },
+    { 0x82416a339b9c4ac6, false, (void*)&_Func_lambda_thismodule_100_3Tickfinalizer_efaee297cbccbd3b, &__wrap__Func_lambda_thismodule_100_3Tickfinalizer_efaee297cbccbd3b },
+    { 0x2ee9314adbf0274, true, (void*)&_Func_lambda_thismodule_103_4Tickfunction_708fd811e9588b94, &__wrap__Func_lambda_thismodule_103_4Tickfunction_708fd811e9588b94 },
+    { 0xf5628d7a3d1bae64, false, (void*)&_Func_lambda_thismodule_103_4Tickfinalizer_4be51897ee527c5, &__wrap__Func_lambda_thismodule_103_4Tickfinalizer_4be51897ee527c5 },
+    { 0x6b88282f55566b61, true, (void*)&func_1db7cd5e42c81c9d, &__wrap_func_1db7cd5e42c81c9d },
+    { 0xa9601673b0f8f692, true, (void*)&funcC_e5f8e69a4bf4633e, &__wrap_funcC_e5f8e69a4bf4633e },
+    { 0xabcb7be99dda60f, true, (void*)&funcA_3a3a5b62506ab5a2, &__wrap_funcA_3a3a5b62506ab5a2 },
+    { 0x248ff39691670e36, true, (void*)&funcAC_1652a02a3635f865, &__wrap_funcAC_1652a02a3635f865 },
+    { 0x6b88282f55566b61, true, (void*)&hfunc_1db7cd5e42c81c9d, &__wrap_hfunc_1db7cd5e42c81c9d },
+    { 0xa9601673b0f8f692, true, (void*)&hfuncC_e5f8e69a4bf4633e, &__wrap_hfuncC_e5f8e69a4bf4633e },
+    { 0xabcb7be99dda60f, true, (void*)&hfuncA_3a3a5b62506ab5a2, &__wrap_hfuncA_3a3a5b62506ab5a2 },
+    { 0x248ff39691670e36, true, (void*)&hfuncAC_1652a02a3635f865, &__wrap_hfuncAC_1652a02a3635f865 },
+    { 0xb9bcc95a09b32558, false, (void*)&check_34b6cea776fb58ea, &__wrap_check_34b6cea776fb58ea },
+    { 0xc7c3bac2b8eee1e1, false, (void*)&test_3af139ec57e5e873, &__wrap_test_3af139ec57e5e873 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_10074710503354810106
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,362 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_3583404528556698439 {
+
+// unused enumeration ConversionResult
+extern TypeInfo __type_info__fa593d0882a72913;
+extern TypeInfo __type_info__af8afe4c86446b52;
+extern TypeInfo __type_info__37d36026a6078a42;
+extern TypeInfo __type_info__86e65058575787a;
+
+TypeInfo __type_info__fa593d0882a72913 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16548, 8, UINT64_C(0xfa593d0882a72913) };
+TypeInfo __type_info__af8afe4c86446b52 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf8afe4c86446b52) };
+TypeInfo __type_info__37d36026a6078a42 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 288, UINT64_C(0x37d36026a6078a42) };
+TypeInfo __type_info__86e65058575787a = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x86e65058575787a) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {__type_info__37d36026a6078a42, };
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__37d36026a6078a42, &__type_info__fa593d0882a72913 };
+TypeInfo * __tinfo_1[2] = { &__type_info__37d36026a6078a42, &__type_info__86e65058575787a };
+TypeInfo * __tinfo_3[2] = { &__type_info__37d36026a6078a42, &__type_info__af8afe4c86446b52 };
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25 ( Context * __context__, TDim<int32_t,1> & __a_rename_at_1502_2 );
+inline char * _Funcstrings_boostTickjoinTick17792841289284275598_af973cf14d248168 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __it_rename_at_48_4, char * const  __separator_rename_at_48_5 );
+inline char * _Funcstrings_boostTickjoinTick16475640899284277631_e721772ad040fdc2 ( Context * __context__, TDim<int32_t,4> const  & __it_rename_at_23_10, char * const  __separator_rename_at_23_11 );
+inline char * _Funcstrings_boostTickjoinTick16475640899284277631_95627e90b433199b ( Context * __context__, TArray<int32_t> const  & __it_rename_at_23_16, char * const  __separator_rename_at_23_17 );
+inline void _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_177_22, int32_t __value_rename_at_177_23 );
+inline char * _Funcstrings_boostTickjoinTick16475640899284277631_383249bb14a8921c ( Context * __context__, range __it_rename_at_23_24, char * const  __separator_rename_at_23_25 );
+inline char * _Funcstrings_boostTickjoinTick16475640899284277631_12dad9e84dcaac1b ( Context * __context__, char * const  __it_rename_at_23_30, char * const  __separator_rename_at_23_31 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 ( Context * __context__, range __rng_rename_at_1398_36 );
+inline bool test_b2e7f9d0d886d7aa ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25 ( Context * __context__, TDim<int32_t,1> &  __a_rename_at_1502_2 )
+{
+    TArray<int32_t> __arr_rename_at_1504_3;das_zero(__arr_rename_at_1504_3);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_3),1);
+    das_copy(das_cast<TDim<int32_t,1>>::cast(das_ref(__context__,__arr_rename_at_1504_3(0,__context__))),__a_rename_at_1502_2);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_3);
+}
+
+inline char * _Funcstrings_boostTickjoinTick17792841289284275598_af973cf14d248168 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __it_rename_at_48_4, char * const  __separator_rename_at_48_5 )
+{
+    char * __st_rename_at_50_6 = ((char *)(char *)(((char * const )(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_50_7) DAS_AOT_INLINE_LAMBDA -> void{
+        bool __skip_first_rename_at_51_8 = true;
+        {
+            bool __need_loop_52 = true;
+            // elem: int aka TT
+            das_iterator<Sequence DAS_COMMENT((int32_t))> __elem_iterator(__it_rename_at_48_4);
+            int32_t __elem_rename_at_52_9;
+            __need_loop_52 = __elem_iterator.first(__context__,(__elem_rename_at_52_9)) && __need_loop_52;
+            for ( ; __need_loop_52 ; __need_loop_52 = __elem_iterator.next(__context__,(__elem_rename_at_52_9)) )
+            {
+                if ( __skip_first_rename_at_51_8 )
+                {
+                    das_copy(__skip_first_rename_at_51_8,false);
+                } else {
+                    das_call_interop<StringBuilderWriter &>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<StringBuilderWriter &>::from(__writer_rename_at_50_7),cast<char * const >::from(__separator_rename_at_48_5)));
+                };
+                das_call_interop<StringBuilderWriter &>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<StringBuilderWriter &>::from(__writer_rename_at_50_7),cast<int32_t>::from(__elem_rename_at_52_9)));
+            }
+            __elem_iterator.close(__context__,(__elem_rename_at_52_9));
+        };
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+    return das_auto_cast<char *>::cast(__st_rename_at_50_6);
+}
+
+inline char * _Funcstrings_boostTickjoinTick16475640899284277631_e721772ad040fdc2 ( Context * __context__, TDim<int32_t,4> const  &  __it_rename_at_23_10, char * const  __separator_rename_at_23_11 )
+{
+    char * __st_rename_at_29_12 = ((char *)(char *)(((char * const )(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_29_13) DAS_AOT_INLINE_LAMBDA -> void{
+        bool __skip_first_rename_at_30_14 = true;
+        {
+            bool __need_loop_31 = true;
+            // elem: int const&
+            das_iterator<TDim<int32_t,4> const > __elem_iterator(__it_rename_at_23_10);
+            int32_t const  * __elem_rename_at_31_15;
+            __need_loop_31 = __elem_iterator.first(__context__,(__elem_rename_at_31_15)) && __need_loop_31;
+            for ( ; __need_loop_31 ; __need_loop_31 = __elem_iterator.next(__context__,(__elem_rename_at_31_15)) )
+            {
+                if ( __skip_first_rename_at_30_14 )
+                {
+                    das_copy(__skip_first_rename_at_30_14,false);
+                } else {
+                    das_call_interop<StringBuilderWriter &>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<StringBuilderWriter &>::from(__writer_rename_at_29_13),cast<char * const >::from(__separator_rename_at_23_11)));
+                };
+                das_call_interop<StringBuilderWriter &>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_3,cast<StringBuilderWriter &>::from(__writer_rename_at_29_13),cast<int32_t>::from((*__elem_rename_at_31_15))));
+            }
+            __elem_iterator.close(__context__,(__elem_rename_at_31_15));
+        };
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+    return das_auto_cast<char *>::cast(__st_rename_at_29_12);
+}
+
+inline char * _Funcstrings_boostTickjoinTick16475640899284277631_95627e90b433199b ( Context * __context__, TArray<int32_t> const  &  __it_rename_at_23_16, char * const  __separator_rename_at_23_17 )
+{
+    char * __st_rename_at_29_18 = ((char *)(char *)(((char * const )(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_29_19) DAS_AOT_INLINE_LAMBDA -> void{
+        bool __skip_first_rename_at_30_20 = true;
+        {
+            bool __need_loop_31 = true;
+            // elem: int const&
+            das_iterator<TArray<int32_t> const > __elem_iterator(__it_rename_at_23_16);
+            int32_t const  * __elem_rename_at_31_21;
+            __need_loop_31 = __elem_iterator.first(__context__,(__elem_rename_at_31_21)) && __need_loop_31;
+            for ( ; __need_loop_31 ; __need_loop_31 = __elem_iterator.next(__context__,(__elem_rename_at_31_21)) )
+            {
+                if ( __skip_first_rename_at_30_20 )
+                {
+                    das_copy(__skip_first_rename_at_30_20,false);
+                } else {
+                    das_call_interop<StringBuilderWriter &>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<StringBuilderWriter &>::from(__writer_rename_at_29_19),cast<char * const >::from(__separator_rename_at_23_17)));
+                };
+                das_call_interop<StringBuilderWriter &>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_3,cast<StringBuilderWriter &>::from(__writer_rename_at_29_19),cast<int32_t>::from((*__elem_rename_at_31_21))));
+            }
+            __elem_iterator.close(__context__,(__elem_rename_at_31_21));
+        };
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+    return das_auto_cast<char *>::cast(__st_rename_at_29_18);
+}
+
+inline void _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_177_22, int32_t __value_rename_at_177_23 )
+{
+    das_copy(__Arr_rename_at_177_22(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_177_22),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_177_23);
+}
+
+inline char * _Funcstrings_boostTickjoinTick16475640899284277631_383249bb14a8921c ( Context * __context__, range __it_rename_at_23_24, char * const  __separator_rename_at_23_25 )
+{
+    char * __st_rename_at_29_26 = ((char *)(char *)(((char * const )(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_29_27) DAS_AOT_INLINE_LAMBDA -> void{
+        bool __skip_first_rename_at_30_28 = true;
+        {
+            bool __need_loop_31 = true;
+            // elem: int const
+            das_iterator<range> __elem_iterator(__it_rename_at_23_24);
+            int32_t __elem_rename_at_31_29;
+            __need_loop_31 = __elem_iterator.first(__context__,(__elem_rename_at_31_29)) && __need_loop_31;
+            for ( ; __need_loop_31 ; __need_loop_31 = __elem_iterator.next(__context__,(__elem_rename_at_31_29)) )
+            {
+                if ( __skip_first_rename_at_30_28 )
+                {
+                    das_copy(__skip_first_rename_at_30_28,false);
+                } else {
+                    das_call_interop<StringBuilderWriter &>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<StringBuilderWriter &>::from(__writer_rename_at_29_27),cast<char * const >::from(__separator_rename_at_23_25)));
+                };
+                das_call_interop<StringBuilderWriter &>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_3,cast<StringBuilderWriter &>::from(__writer_rename_at_29_27),cast<int32_t>::from(__elem_rename_at_31_29)));
+            }
+            __elem_iterator.close(__context__,(__elem_rename_at_31_29));
+        };
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+    return das_auto_cast<char *>::cast(__st_rename_at_29_26);
+}
+
+inline char * _Funcstrings_boostTickjoinTick16475640899284277631_12dad9e84dcaac1b ( Context * __context__, char * const  __it_rename_at_23_30, char * const  __separator_rename_at_23_31 )
+{
+    char * __st_rename_at_29_32 = ((char *)(char *)(((char * const )(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_29_33) DAS_AOT_INLINE_LAMBDA -> void{
+        bool __skip_first_rename_at_30_34 = true;
+        {
+            bool __need_loop_31 = true;
+            // elem: int const
+            das_iterator<char * const > __elem_iterator(__it_rename_at_23_30);
+            int32_t __elem_rename_at_31_35;
+            __need_loop_31 = __elem_iterator.first(__context__,(__elem_rename_at_31_35)) && __need_loop_31;
+            for ( ; __need_loop_31 ; __need_loop_31 = __elem_iterator.next(__context__,(__elem_rename_at_31_35)) )
+            {
+                if ( __skip_first_rename_at_30_34 )
+                {
+                    das_copy(__skip_first_rename_at_30_34,false);
+                } else {
+                    das_call_interop<StringBuilderWriter &>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<StringBuilderWriter &>::from(__writer_rename_at_29_33),cast<char * const >::from(__separator_rename_at_23_31)));
+                };
+                write_string_char(das_arg<StringBuilderWriter>::pass(__writer_rename_at_29_33),__elem_rename_at_31_35);
+            }
+            __elem_iterator.close(__context__,(__elem_rename_at_31_35));
+        };
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+    return das_auto_cast<char *>::cast(__st_rename_at_29_32);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 ( Context * __context__, range __rng_rename_at_1398_36 )
+{
+    Sequence DAS_COMMENT((int32_t)) __it_rename_at_1399_37;das_zero(__it_rename_at_1399_37);
+    builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_1399_37),__rng_rename_at_1398_36,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_1399_37);
+}
+
+inline bool test_b2e7f9d0d886d7aa ( Context * __context__ )
+{
+    TArray<int32_t> _temp_make_local_7_16_0; _temp_make_local_7_16_0;
+    TDim<int32_t,1> _temp_make_local_7_16_1; _temp_make_local_7_16_1;
+    TDim<int32_t,4> _temp_make_local_8_16_2; _temp_make_local_8_16_2;
+    DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boostTickjoinTick16475640899284277631_95627e90b433199b(__context__,das_arg<TArray<int32_t>>::pass((_temp_make_local_7_16_0 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25(__context__,das_arg<TDim<int32_t,1>>::pass((([&]() -> TDim<int32_t,1>& {
+        _temp_make_local_7_16_1(0,__context__) = 1;
+        return _temp_make_local_7_16_1;
+    })())))))),((char *) ","))),cast<char *>::from(((char *) "1")),*__context__,nullptr)));
+    DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boostTickjoinTick16475640899284277631_e721772ad040fdc2(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+        _temp_make_local_8_16_2(0,__context__) = 1;
+        _temp_make_local_8_16_2(1,__context__) = 2;
+        _temp_make_local_8_16_2(2,__context__) = 3;
+        _temp_make_local_8_16_2(3,__context__) = 4;
+        return _temp_make_local_8_16_2;
+    })())),((char *) ","))),cast<char *>::from(((char *) "1,2,3,4")),*__context__,nullptr)));
+    TArray<int32_t> __a_rename_at_10_38;das_zero(__a_rename_at_10_38);
+    DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boostTickjoinTick16475640899284277631_95627e90b433199b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_10_38),((char *) " "))),cast<char *>::from(nullptr),*__context__,nullptr)));
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_10_38),1);
+    DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boostTickjoinTick16475640899284277631_95627e90b433199b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_10_38),((char *) "."))),cast<char *>::from(((char *) "1")),*__context__,nullptr)));
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_10_38),2);
+    DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boostTickjoinTick16475640899284277631_95627e90b433199b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_10_38),((char *) "."))),cast<char *>::from(((char *) "1.2")),*__context__,nullptr)));
+    DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boostTickjoinTick16475640899284277631_383249bb14a8921c(__context__,range(1,4),((char *) "-"))),cast<char *>::from(((char *) "1-2-3")),*__context__,nullptr)));
+    DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boostTickjoinTick16475640899284277631_12dad9e84dcaac1b(__context__,((char *) "hello"),((char *) " "))),cast<char *>::from(((char *) "h e l l o")),*__context__,nullptr)));
+    Sequence DAS_COMMENT((int32_t)) __rit_rename_at_21_39; das_zero(__rit_rename_at_21_39); das_move(__rit_rename_at_21_39, _FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(1,4)));
+    DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boostTickjoinTick17792841289284275598_af973cf14d248168(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__rit_rename_at_21_39),((char *) "*"))),cast<char *>::from(((char *) "1*2*3")),*__context__,nullptr)));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25 ( Context * __context__ ) {
+    TDim<int32_t,1> &  arg_a = cast_aot_arg<TDim<int32_t,1> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__Funcstrings_boostTickjoinTick17792841289284275598_af973cf14d248168 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_it = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_separator = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<char *>::from(_Funcstrings_boostTickjoinTick17792841289284275598_af973cf14d248168(__context__, arg_it, arg_separator));
+}
+static vec4f __wrap__Funcstrings_boostTickjoinTick16475640899284277631_e721772ad040fdc2 ( Context * __context__ ) {
+    TDim<int32_t,4> const  &  arg_it = cast_aot_arg<TDim<int32_t,4> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_separator = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<char *>::from(_Funcstrings_boostTickjoinTick16475640899284277631_e721772ad040fdc2(__context__, arg_it, arg_separator));
+}
+static vec4f __wrap__Funcstrings_boostTickjoinTick16475640899284277631_95627e90b433199b ( Context * __context__ ) {
+    TArray<int32_t> const  &  arg_it = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_separator = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<char *>::from(_Funcstrings_boostTickjoinTick16475640899284277631_95627e90b433199b(__context__, arg_it, arg_separator));
+}
+static vec4f __wrap__FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_value = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__Funcstrings_boostTickjoinTick16475640899284277631_383249bb14a8921c ( Context * __context__ ) {
+    range arg_it = cast_aot_arg<range>::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_separator = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<char *>::from(_Funcstrings_boostTickjoinTick16475640899284277631_383249bb14a8921c(__context__, arg_it, arg_separator));
+}
+static vec4f __wrap__Funcstrings_boostTickjoinTick16475640899284277631_12dad9e84dcaac1b ( Context * __context__ ) {
+    char * const  arg_it = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_separator = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<char *>::from(_Funcstrings_boostTickjoinTick16475640899284277631_12dad9e84dcaac1b(__context__, arg_it, arg_separator));
+}
+static vec4f __wrap__FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 ( Context * __context__ ) {
+    range arg_rng = cast_aot_arg<range>::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__, arg_rng);
+    return v_zero();
+}
+static vec4f __wrap_test_b2e7f9d0d886d7aa ( Context * __context__ ) {
+    return cast<bool>::from(test_b2e7f9d0d886d7aa(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xa51a880d594e91fd, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c },
+    { 0x53b0d27e2411836, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25 },
+    { 0x10e0cb3d82f9d66f, false, (void*)&_Funcstrings_boostTickjoinTick17792841289284275598_af973cf14d248168, &__wrap__Funcstrings_boostTickjoinTick17792841289284275598_af973cf14d248168 },
+    { 0xd4ed2b145eff1a20, false, (void*)&_Funcstrings_boostTickjoinTick16475640899284277631_e721772ad040fdc2, &__wrap__Funcstrings_boostTickjoinTick16475640899284277631_e721772ad040fdc2 },
+    { 0x3c88b1c9ade68d50, false, (void*)&_Funcstrings_boostTickjoinTick16475640899284277631_95627e90b433199b, &__wrap__Funcstrings_boostTickjoinTick16475640899284277631_95627e90b433199b },
+    { 0xbf77bb210b0552bc, false, (void*)&_FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39, &__wrap__FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 },
+    { 0x16df3cfff68767a2, false, (void*)&_Funcstrings_boostTickjoinTick16475640899284277631_383249bb14a8921c, &__wrap__Funcstrings_boostTickjoinTick16475640899284277631_383249bb14a8921c },
+    { 0x9b5c7a9b23b4aabe, false, (void*)&_Funcstrings_boostTickjoinTick16475640899284277631_12dad9e84dcaac1b, &__wrap__Funcstrings_boostTickjoinTick16475640899284277631_12dad9e84dcaac1b },
+    { 0xf426d9532c77b0a4, true, (void*)&_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015, &__wrap__FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 },
+    { 0x24d456f6b993fb77, false, (void*)&test_b2e7f9d0d886d7aa, &__wrap_test_b2e7f9d0d886d7aa },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_3583404528556698439
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,341 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_12807241668006014268 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void basic_goto_9f9d73f5bad4c05b ( Context * __context__ );
+inline void nested_goto_57aa965c72bd29ba ( Context * __context__ );
+inline void for_goto_49ef51029db08287 ( Context * __context__ );
+inline void while_goto_df509d24ef61e4c1 ( Context * __context__ );
+inline void finally_goto_3e8dd774066e73d9 ( Context * __context__, bool __yes_rename_at_92_17 );
+inline int32_t gotoN_6c2205f55a0b94c9 ( Context * __context__, int32_t __n_rename_at_105_19 );
+inline void N_goto_95224112aa42bf4 ( Context * __context__ );
+inline bool test_5f8c78c291ccc971 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void basic_goto_9f9d73f5bad4c05b ( Context * __context__ )
+{
+    TDim<int32_t,10> __arr_rename_at_5_0;das_zero(__arr_rename_at_5_0);
+    int32_t __i_rename_at_6_1 = 0;
+    label_0:;;
+    das_copy(__arr_rename_at_5_0(__i_rename_at_6_1,__context__),__i_rename_at_6_1);
+    ++__i_rename_at_6_1;
+    if ( __i_rename_at_6_1 < 10 )
+    {
+        goto label_0;
+    };
+    {
+        bool __need_loop_15 = true;
+        // t: int const
+        das_iterator<range> __t_iterator(range(0,10));
+        int32_t __t_rename_at_15_2;
+        __need_loop_15 = __t_iterator.first(__context__,(__t_rename_at_15_2)) && __need_loop_15;
+        for ( ; __need_loop_15 ; __need_loop_15 = __t_iterator.next(__context__,(__t_rename_at_15_2)) )
+        {
+            DAS_ASSERT((__arr_rename_at_5_0(__t_rename_at_15_2,__context__) == __t_rename_at_15_2));
+        }
+        __t_iterator.close(__context__,(__t_rename_at_15_2));
+    };
+}
+
+inline void nested_goto_57aa965c72bd29ba ( Context * __context__ )
+{
+    bool __fail_rename_at_23_3 = false;
+    TDim<int32_t,10> __arr_rename_at_24_4;das_zero(__arr_rename_at_24_4);
+    int32_t __i_rename_at_25_5 = 0;
+    label_0:;;
+    das_copy(__arr_rename_at_24_4(__i_rename_at_25_5,__context__),__i_rename_at_25_5);
+    ++__i_rename_at_25_5;
+    if ( __i_rename_at_25_5 < 10 )
+    {
+        if ( __i_rename_at_25_5 < 10 )
+        {
+            goto label_0;
+        };
+        das_copy(__fail_rename_at_23_3,true);
+    };
+    {
+        bool __need_loop_36 = true;
+        // t: int const
+        das_iterator<range> __t_iterator(range(0,10));
+        int32_t __t_rename_at_36_6;
+        __need_loop_36 = __t_iterator.first(__context__,(__t_rename_at_36_6)) && __need_loop_36;
+        for ( ; __need_loop_36 ; __need_loop_36 = __t_iterator.next(__context__,(__t_rename_at_36_6)) )
+        {
+            DAS_ASSERT((__arr_rename_at_24_4(__t_rename_at_36_6,__context__) == __t_rename_at_36_6));
+        }
+        __t_iterator.close(__context__,(__t_rename_at_36_6));
+    };
+}
+
+inline void for_goto_49ef51029db08287 ( Context * __context__ )
+{
+    TDim<int32_t,10> __arr_rename_at_44_7;das_zero(__arr_rename_at_44_7);
+    {
+        bool __need_loop_45 = true;
+        // j: int const
+        das_iterator<range> __j_iterator(range(0,10));
+        int32_t __j_rename_at_45_8;
+        __need_loop_45 = __j_iterator.first(__context__,(__j_rename_at_45_8)) && __need_loop_45;
+        for ( ; __need_loop_45 ; __need_loop_45 = __j_iterator.next(__context__,(__j_rename_at_45_8)) )
+        {
+            int32_t __i_rename_at_46_9 = 0;
+            label_0:;;
+            das_copy(__arr_rename_at_44_7(__i_rename_at_46_9,__context__),__i_rename_at_46_9 + __j_rename_at_45_8);
+            ++__i_rename_at_46_9;
+            if ( __i_rename_at_46_9 < 10 )
+            {
+                goto label_0;
+            };
+            {
+                bool __need_loop_54 = true;
+                // t: int const
+                das_iterator<range> __t_iterator(range(0,10));
+                int32_t __t_rename_at_54_10;
+                __need_loop_54 = __t_iterator.first(__context__,(__t_rename_at_54_10)) && __need_loop_54;
+                for ( ; __need_loop_54 ; __need_loop_54 = __t_iterator.next(__context__,(__t_rename_at_54_10)) )
+                {
+                    DAS_ASSERT((__arr_rename_at_44_7(__t_rename_at_54_10,__context__) == (__t_rename_at_54_10 + __j_rename_at_45_8)));
+                }
+                __t_iterator.close(__context__,(__t_rename_at_54_10));
+            };
+        }
+        __j_iterator.close(__context__,(__j_rename_at_45_8));
+    };
+    {
+        bool __need_loop_59 = true;
+        // t: int const
+        das_iterator<range> __t_iterator(range(0,10));
+        int32_t __t_rename_at_59_11;
+        __need_loop_59 = __t_iterator.first(__context__,(__t_rename_at_59_11)) && __need_loop_59;
+        for ( ; __need_loop_59 ; __need_loop_59 = __t_iterator.next(__context__,(__t_rename_at_59_11)) )
+        {
+            DAS_ASSERT((__arr_rename_at_44_7(__t_rename_at_59_11,__context__) == (__t_rename_at_59_11 + 9)));
+        }
+        __t_iterator.close(__context__,(__t_rename_at_59_11));
+    };
+}
+
+inline void while_goto_df509d24ef61e4c1 ( Context * __context__ )
+{
+    TDim<int32_t,10> __arr_rename_at_68_12;das_zero(__arr_rename_at_68_12);
+    int32_t __j_rename_at_69_13 = 0;
+    while ( __j_rename_at_69_13 < 10 )
+    {
+        int32_t __i_rename_at_71_14 = 0;
+        label_0:;;
+        das_copy(__arr_rename_at_68_12(__i_rename_at_71_14,__context__),__i_rename_at_71_14 + __j_rename_at_69_13);
+        ++__i_rename_at_71_14;
+        if ( __i_rename_at_71_14 < 10 )
+        {
+            goto label_0;
+        };
+        {
+            bool __need_loop_79 = true;
+            // t: int const
+            das_iterator<range> __t_iterator(range(0,10));
+            int32_t __t_rename_at_79_15;
+            __need_loop_79 = __t_iterator.first(__context__,(__t_rename_at_79_15)) && __need_loop_79;
+            for ( ; __need_loop_79 ; __need_loop_79 = __t_iterator.next(__context__,(__t_rename_at_79_15)) )
+            {
+                DAS_ASSERT((__arr_rename_at_68_12(__t_rename_at_79_15,__context__) == (__t_rename_at_79_15 + __j_rename_at_69_13)));
+            }
+            __t_iterator.close(__context__,(__t_rename_at_79_15));
+        };
+        ++__j_rename_at_69_13;
+    };
+    {
+        bool __need_loop_85 = true;
+        // t: int const
+        das_iterator<range> __t_iterator(range(0,10));
+        int32_t __t_rename_at_85_16;
+        __need_loop_85 = __t_iterator.first(__context__,(__t_rename_at_85_16)) && __need_loop_85;
+        for ( ; __need_loop_85 ; __need_loop_85 = __t_iterator.next(__context__,(__t_rename_at_85_16)) )
+        {
+            DAS_ASSERT((__arr_rename_at_68_12(__t_rename_at_85_16,__context__) == (__t_rename_at_85_16 + 9)));
+        }
+        __t_iterator.close(__context__,(__t_rename_at_85_16));
+    };
+}
+
+inline void finally_goto_3e8dd774066e73d9 ( Context * __context__, bool __yes_rename_at_92_17 )
+{
+    bool __fail_rename_at_93_18 = true;
+    if ( __yes_rename_at_92_17 )
+    {
+        /* finally */ auto __finally_94= das_finally([&](){
+        das_copy(__fail_rename_at_93_18,false);
+        /* end finally */ });
+        das_copy(__fail_rename_at_93_18,true);
+        goto label_0;
+    };
+    label_0:;;
+    DAS_ASSERT((!__fail_rename_at_93_18));
+}
+
+inline int32_t gotoN_6c2205f55a0b94c9 ( Context * __context__, int32_t __n_rename_at_105_19 )
+{
+    int32_t __res_rename_at_106_20 = -1;
+    switch (__n_rename_at_105_19) {
+    case 0: goto label_0;
+    case 1: goto label_1;
+    case 2: goto label_2;
+    case 3: goto label_3;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(__res_rename_at_106_20,0);
+    goto label_3;
+    label_1:;;
+    das_copy(__res_rename_at_106_20,1);
+    goto label_3;
+    label_2:;;
+    das_copy(__res_rename_at_106_20,2);
+    goto label_3;
+    label_3:;;
+    return das_auto_cast<int32_t>::cast(__res_rename_at_106_20);
+}
+
+inline void N_goto_95224112aa42bf4 ( Context * __context__ )
+{
+    DAS_VERIFY((gotoN_6c2205f55a0b94c9(__context__,0) == 0));
+    DAS_VERIFY((gotoN_6c2205f55a0b94c9(__context__,1) == 1));
+    DAS_VERIFY((gotoN_6c2205f55a0b94c9(__context__,2) == 2));
+    DAS_VERIFY((gotoN_6c2205f55a0b94c9(__context__,3) == -1));
+}
+
+inline bool test_5f8c78c291ccc971 ( Context * __context__ )
+{
+    basic_goto_9f9d73f5bad4c05b(__context__);
+    nested_goto_57aa965c72bd29ba(__context__);
+    for_goto_49ef51029db08287(__context__);
+    while_goto_df509d24ef61e4c1(__context__);
+    finally_goto_3e8dd774066e73d9(__context__,true);
+    N_goto_95224112aa42bf4(__context__);
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_basic_goto_9f9d73f5bad4c05b ( Context * __context__ ) {
+    basic_goto_9f9d73f5bad4c05b(__context__);
+    return v_zero();
+}
+static vec4f __wrap_nested_goto_57aa965c72bd29ba ( Context * __context__ ) {
+    nested_goto_57aa965c72bd29ba(__context__);
+    return v_zero();
+}
+static vec4f __wrap_for_goto_49ef51029db08287 ( Context * __context__ ) {
+    for_goto_49ef51029db08287(__context__);
+    return v_zero();
+}
+static vec4f __wrap_while_goto_df509d24ef61e4c1 ( Context * __context__ ) {
+    while_goto_df509d24ef61e4c1(__context__);
+    return v_zero();
+}
+static vec4f __wrap_finally_goto_3e8dd774066e73d9 ( Context * __context__ ) {
+    bool arg_yes = cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]);
+    finally_goto_3e8dd774066e73d9(__context__, arg_yes);
+    return v_zero();
+}
+static vec4f __wrap_gotoN_6c2205f55a0b94c9 ( Context * __context__ ) {
+    int32_t arg_n = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(gotoN_6c2205f55a0b94c9(__context__, arg_n));
+}
+static vec4f __wrap_N_goto_95224112aa42bf4 ( Context * __context__ ) {
+    N_goto_95224112aa42bf4(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_5f8c78c291ccc971 ( Context * __context__ ) {
+    return cast<bool>::from(test_5f8c78c291ccc971(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x5abe5f53ad9cb685, false, (void*)&basic_goto_9f9d73f5bad4c05b, &__wrap_basic_goto_9f9d73f5bad4c05b },
+    { 0x41ad1e7b59b05e00, false, (void*)&nested_goto_57aa965c72bd29ba, &__wrap_nested_goto_57aa965c72bd29ba },
+    { 0x168391d653d55438, false, (void*)&for_goto_49ef51029db08287, &__wrap_for_goto_49ef51029db08287 },
+    { 0x1b47a41e95b5a33d, false, (void*)&while_goto_df509d24ef61e4c1, &__wrap_while_goto_df509d24ef61e4c1 },
+    { 0x283a6760a13a79e1, false, (void*)&finally_goto_3e8dd774066e73d9, &__wrap_finally_goto_3e8dd774066e73d9 },
+    { 0xa811c639a1d0186b, false, (void*)&gotoN_6c2205f55a0b94c9, &__wrap_gotoN_6c2205f55a0b94c9 },
+    { 0x333aac3439fcd269, false, (void*)&N_goto_95224112aa42bf4, &__wrap_N_goto_95224112aa42bf4 },
+    { 0x8114b73b7db7fcf7, false, (void*)&test_5f8c78c291ccc971, &__wrap_test_5f8c78c291ccc971 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_12807241668006014268
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
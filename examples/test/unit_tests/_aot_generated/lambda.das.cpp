@@ -0,0 +1,310 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_3893666508627823566 {
+
+namespace  { struct _lambda_thismodule_12_1; };
+namespace  { struct _lambda_thismodule_20_2; };
+namespace  {
+
+struct _lambda_thismodule_12_1 {
+    Func DAS_COMMENT((int32_t,_lambda_thismodule_12_1,int32_t)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_12_1 *)) __finalize;
+    int32_t a;
+};
+static_assert(sizeof(_lambda_thismodule_12_1)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_12_1,a)==16,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_20_2 {
+    Func DAS_COMMENT((int32_t,_lambda_thismodule_20_2,int32_t)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_20_2 *)) __finalize;
+    int32_t CNT;
+};
+static_assert(sizeof(_lambda_thismodule_20_2)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_20_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_20_2,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_20_2,CNT)==16,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__cc3c08a63869b82a;
+extern StructInfo __struct_info__176bf79f93ca64f5;
+extern TypeInfo __type_info__5fb6f2ef2614f58c;
+extern TypeInfo __type_info__37d5efc47f2d401;
+extern TypeInfo __type_info__af8afe4c86446b52;
+extern TypeInfo __type_info__4e6a91c42ce70d49;
+extern TypeInfo __type_info__99c0a6bd8894194a;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+TypeInfo * __type_info__a74e01e46850985f_arg_types_var_14716647192343984170[2] = { &__type_info__4e6a91c42ce70d49, &__type_info__af8afe4c86446b52 };
+const char * __type_info__a74e01e46850985f_arg_names_var_14716647192343984170[2] = { "__this", "b" };
+VarInfo __struct_info__cc3c08a63869b82a_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af8afe4c86446b52, nullptr, (TypeInfo **)__type_info__a74e01e46850985f_arg_types_var_14716647192343984170, __type_info__a74e01e46850985f_arg_names_var_14716647192343984170, 2, 0, nullptr, 12, 8, UINT64_C(0xa74e01e46850985f), "__lambda", 0, 0 };
+TypeInfo * __type_info__2b4174a4bb222660_arg_types_var_14716647192343984170[1] = { &__type_info__5fb6f2ef2614f58c };
+const char * __type_info__2b4174a4bb222660_arg_names_var_14716647192343984170[1] = { "__this" };
+VarInfo __struct_info__cc3c08a63869b82a_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__2b4174a4bb222660_arg_types_var_14716647192343984170, __type_info__2b4174a4bb222660_arg_names_var_14716647192343984170, 1, 0, nullptr, 12, 8, UINT64_C(0x2b4174a4bb222660), "__finalize", 8, 0 };
+VarInfo __struct_info__cc3c08a63869b82a_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x563d0c6afaedc01c), "a", 16, 0 };
+VarInfo * __struct_info__cc3c08a63869b82a_fields[3] =  { &__struct_info__cc3c08a63869b82a_field_0, &__struct_info__cc3c08a63869b82a_field_1, &__struct_info__cc3c08a63869b82a_field_2 };
+StructInfo __struct_info__cc3c08a63869b82a = {"_lambda_thismodule_12_1", "", 14, __struct_info__cc3c08a63869b82a_fields, 3, 24, UINT64_C(0x0), nullptr, UINT64_C(0xcc3c08a63869b82a), 3 };
+TypeInfo * __type_info__41b67cf372ea40da_arg_types_var_1687714750131758325[2] = { &__type_info__99c0a6bd8894194a, &__type_info__af8afe4c86446b52 };
+const char * __type_info__41b67cf372ea40da_arg_names_var_1687714750131758325[2] = { "__this", "extra" };
+VarInfo __struct_info__176bf79f93ca64f5_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, (TypeInfo **)__type_info__41b67cf372ea40da_arg_types_var_1687714750131758325, __type_info__41b67cf372ea40da_arg_names_var_1687714750131758325, 2, 0, nullptr, 12, 8, UINT64_C(0x41b67cf372ea40da), "__lambda", 0, 0 };
+TypeInfo * __type_info__64148849eb865aab_arg_types_var_1687714750131758325[1] = { &__type_info__37d5efc47f2d401 };
+VarInfo __struct_info__176bf79f93ca64f5_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__64148849eb865aab_arg_types_var_1687714750131758325, __type_info__2b4174a4bb222660_arg_names_var_14716647192343984170, 1, 0, nullptr, 12, 8, UINT64_C(0x64148849eb865aab), "__finalize", 8, 0 };
+VarInfo __struct_info__176bf79f93ca64f5_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x542a8a38e32cbd77), "CNT", 16, 0 };
+VarInfo * __struct_info__176bf79f93ca64f5_fields[3] =  { &__struct_info__176bf79f93ca64f5_field_0, &__struct_info__176bf79f93ca64f5_field_1, &__struct_info__176bf79f93ca64f5_field_2 };
+StructInfo __struct_info__176bf79f93ca64f5 = {"_lambda_thismodule_20_2", "", 14, __struct_info__176bf79f93ca64f5_fields, 3, 24, UINT64_C(0x0), nullptr, UINT64_C(0x176bf79f93ca64f5), 3 };
+TypeInfo __type_info__5fb6f2ef2614f58c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4e6a91c42ce70d49, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x5fb6f2ef2614f58c) };
+TypeInfo __type_info__37d5efc47f2d401 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__99c0a6bd8894194a, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x37d5efc47f2d401) };
+TypeInfo __type_info__af8afe4c86446b52 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf8afe4c86446b52) };
+TypeInfo __type_info__4e6a91c42ce70d49 = { Type::tStructure, &__struct_info__cc3c08a63869b82a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 24, UINT64_C(0x4e6a91c42ce70d49) };
+TypeInfo __type_info__99c0a6bd8894194a = { Type::tStructure, &__struct_info__176bf79f93ca64f5, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 24, UINT64_C(0x99c0a6bd8894194a) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void finalize_40a3051b2c93835a ( Context * __context__, _lambda_thismodule_12_1 & ____this_rename_at_12_0 );
+inline void finalize_156fe4037ccbeda2 ( Context * __context__, _lambda_thismodule_20_2 & ____this_rename_at_20_1 );
+inline int32_t _Func_lambda_thismodule_12_1Tickfunction_aa1cf5a28240fec6 ( Context * __context__, _lambda_thismodule_12_1 & ____this_rename_at_12_2, int32_t __b_rename_at_12_3 );
+inline void _Func_lambda_thismodule_12_1Tickfinalizer_d173b23cc94b9b4 ( Context * __context__, _lambda_thismodule_12_1 * ____this_rename_at_12_4 );
+inline int32_t _Func_lambda_thismodule_20_2Tickfunction_3f51c0869f82231e ( Context * __context__, _lambda_thismodule_20_2 & ____this_rename_at_20_5, int32_t __extra_rename_at_20_6 );
+inline void _Func_lambda_thismodule_20_2Tickfinalizer_b4db6dcbe30614a7 ( Context * __context__, _lambda_thismodule_20_2 * ____this_rename_at_20_7 );
+inline void onlyNull_c6c10cb4033f7ab ( Context * __context__, Lambda DAS_COMMENT((int32_t,int32_t)) const  __bar_rename_at_5_8 );
+inline Lambda DAS_COMMENT((int32_t,int32_t)) addX_977d082bc73e041 ( Context * __context__, int32_t __a_rename_at_11_9 );
+inline bool test_957afb9288086422 ( Context * __context__ );
+inline void delete_null_lambda_f38689dea6b39c6d ( Context * __context__ );
+inline void main_fa89e3765879cc15 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void finalize_40a3051b2c93835a ( Context * __context__, _lambda_thismodule_12_1 &  ____this_rename_at_12_0 )
+{
+    memset((void*)&(____this_rename_at_12_0), 0, 24);
+}
+
+inline void finalize_156fe4037ccbeda2 ( Context * __context__, _lambda_thismodule_20_2 &  ____this_rename_at_20_1 )
+{
+    memset((void*)&(____this_rename_at_20_1), 0, 24);
+}
+
+inline int32_t _Func_lambda_thismodule_12_1Tickfunction_aa1cf5a28240fec6 ( Context * __context__, _lambda_thismodule_12_1 &  ____this_rename_at_12_2, int32_t __b_rename_at_12_3 )
+{
+    return das_auto_cast<int32_t>::cast(____this_rename_at_12_2.a + __b_rename_at_12_3);
+}
+
+inline void _Func_lambda_thismodule_12_1Tickfinalizer_d173b23cc94b9b4 ( Context * __context__, _lambda_thismodule_12_1 * ____this_rename_at_12_4 )
+{
+    finalize_40a3051b2c93835a(__context__,das_arg<_lambda_thismodule_12_1>::pass(das_deref(__context__,____this_rename_at_12_4,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_12_1 *>::clear(__context__,____this_rename_at_12_4);
+}
+
+inline int32_t _Func_lambda_thismodule_20_2Tickfunction_3f51c0869f82231e ( Context * __context__, _lambda_thismodule_20_2 &  ____this_rename_at_20_5, int32_t __extra_rename_at_20_6 )
+{
+    return das_auto_cast<int32_t>::cast((____this_rename_at_20_5.CNT++) + __extra_rename_at_20_6);
+}
+
+inline void _Func_lambda_thismodule_20_2Tickfinalizer_b4db6dcbe30614a7 ( Context * __context__, _lambda_thismodule_20_2 * ____this_rename_at_20_7 )
+{
+    finalize_156fe4037ccbeda2(__context__,das_arg<_lambda_thismodule_20_2>::pass(das_deref(__context__,____this_rename_at_20_7,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_20_2 *>::clear(__context__,____this_rename_at_20_7);
+}
+
+inline void onlyNull_c6c10cb4033f7ab ( Context * __context__, Lambda DAS_COMMENT((int32_t,int32_t)) const  __bar_rename_at_5_8 )
+{
+    if ( __bar_rename_at_5_8 != nullptr )
+    {
+        DAS_ASSERTF((false),(((char *) "has to be null")));
+    };
+}
+
+inline Lambda DAS_COMMENT((int32_t,int32_t)) addX_977d082bc73e041 ( Context * __context__, int32_t __a_rename_at_11_9 )
+{
+    return das_auto_cast<Lambda DAS_COMMENT((int32_t,int32_t))>::cast(das_ascend<int32_t,_lambda_thismodule_12_1>::make(__context__,&__type_info__4e6a91c42ce70d49,(([&]() -> _lambda_thismodule_12_1 {
+        _lambda_thismodule_12_1 __mks_12;
+        das_copy((__mks_12.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_12_1`function XS<_lambda_thismodule_12_1> Ci*/ 0x94ae42cd195d3b4a))));
+        das_copy((__mks_12.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_12_1`finalizer X1<S<_lambda_thismodule_12_1>>?*/ 0xa7a295b94bbfc063))));
+        das_copy((__mks_12.a),(__a_rename_at_11_9));
+        return __mks_12;
+    })())));
+}
+
+inline bool test_957afb9288086422 ( Context * __context__ )
+{
+    int32_t __CNT_rename_at_19_10 = 0;
+    Lambda DAS_COMMENT((int32_t,int32_t)) __counter_rename_at_20_11; das_zero(__counter_rename_at_20_11); das_move(__counter_rename_at_20_11, ((Lambda DAS_COMMENT((int32_t,int32_t)))das_ascend<int32_t,_lambda_thismodule_20_2>::make(__context__,&__type_info__99c0a6bd8894194a,(([&]() -> _lambda_thismodule_20_2 {
+        _lambda_thismodule_20_2 __mks_20;
+        das_copy((__mks_20.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_20_2`function XS<_lambda_thismodule_20_2> Ci*/ 0x785a6f59e3fc335a))));
+        das_copy((__mks_20.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_20_2`finalizer X1<S<_lambda_thismodule_20_2>>?*/ 0x57993fcf73d3716d))));
+        das_copy((__mks_20.CNT),(__CNT_rename_at_19_10));
+        return __mks_20;
+    })()))));
+    int32_t __x_rename_at_23_12 = das_invoke_lambda<int32_t>::invoke<int32_t>(__context__,nullptr,__counter_rename_at_20_11,13);
+    das_copy(__CNT_rename_at_19_10,100500);
+    int32_t __y_rename_at_25_13 = ((int32_t)das_invoke_lambda<int32_t>::invoke<int32_t>(__context__,nullptr,__counter_rename_at_20_11,13));
+    DAS_ASSERT(((__x_rename_at_23_12 == 13) && (__y_rename_at_25_13 == 14)));
+    Lambda DAS_COMMENT((int32_t,int32_t)) __l_rename_at_27_14;das_zero(__l_rename_at_27_14);
+    onlyNull_c6c10cb4033f7ab(__context__,__l_rename_at_27_14);
+    Lambda DAS_COMMENT((int32_t,int32_t)) __t_rename_at_29_15; das_zero(__t_rename_at_29_15); das_move(__t_rename_at_29_15, ((Lambda DAS_COMMENT((int32_t,int32_t)))addX_977d082bc73e041(__context__,1)));
+    int32_t __q_rename_at_30_16 = ((int32_t)das_invoke_lambda<int32_t>::invoke<int32_t>(__context__,nullptr,__t_rename_at_29_15,2));
+    DAS_ASSERT((__q_rename_at_30_16 == 3));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline void delete_null_lambda_f38689dea6b39c6d ( Context * __context__ )
+{
+    Lambda DAS_COMMENT((void)) __lmb_rename_at_37_17; das_zero(__lmb_rename_at_37_17); das_move(__lmb_rename_at_37_17, (([&]() -> Lambda DAS_COMMENT((void)) {
+        Lambda DAS_COMMENT((void)) __mks_37;
+        das_zero(__mks_37);
+        return __mks_37;
+    })()));
+    das_delete<Lambda DAS_COMMENT((void))>::clear(__context__,__lmb_rename_at_37_17);
+}
+
+inline void main_fa89e3765879cc15 ( Context * __context__ )
+{
+    test_957afb9288086422(__context__);
+}
+static vec4f __wrap_finalize_40a3051b2c93835a ( Context * __context__ ) {
+    _lambda_thismodule_12_1 &  arg___this = cast_aot_arg<_lambda_thismodule_12_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_40a3051b2c93835a(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_156fe4037ccbeda2 ( Context * __context__ ) {
+    _lambda_thismodule_20_2 &  arg___this = cast_aot_arg<_lambda_thismodule_20_2 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_156fe4037ccbeda2(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_12_1Tickfunction_aa1cf5a28240fec6 ( Context * __context__ ) {
+    _lambda_thismodule_12_1 &  arg___this = cast_aot_arg<_lambda_thismodule_12_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_b = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t>::from(_Func_lambda_thismodule_12_1Tickfunction_aa1cf5a28240fec6(__context__, arg___this, arg_b));
+}
+static vec4f __wrap__Func_lambda_thismodule_12_1Tickfinalizer_d173b23cc94b9b4 ( Context * __context__ ) {
+    _lambda_thismodule_12_1 * arg___this = cast_aot_arg<_lambda_thismodule_12_1 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_12_1Tickfinalizer_d173b23cc94b9b4(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_20_2Tickfunction_3f51c0869f82231e ( Context * __context__ ) {
+    _lambda_thismodule_20_2 &  arg___this = cast_aot_arg<_lambda_thismodule_20_2 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_extra = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t>::from(_Func_lambda_thismodule_20_2Tickfunction_3f51c0869f82231e(__context__, arg___this, arg_extra));
+}
+static vec4f __wrap__Func_lambda_thismodule_20_2Tickfinalizer_b4db6dcbe30614a7 ( Context * __context__ ) {
+    _lambda_thismodule_20_2 * arg___this = cast_aot_arg<_lambda_thismodule_20_2 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_20_2Tickfinalizer_b4db6dcbe30614a7(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_onlyNull_c6c10cb4033f7ab ( Context * __context__ ) {
+    Lambda DAS_COMMENT((int32_t,int32_t)) const  arg_bar = cast_aot_arg<Lambda DAS_COMMENT((int32_t,int32_t)) const >::to(*__context__,__context__->abiArguments()[0]);
+    onlyNull_c6c10cb4033f7ab(__context__, arg_bar);
+    return v_zero();
+}
+static vec4f __wrap_addX_977d082bc73e041 ( Context * __context__ ) {
+    int32_t arg_a = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<Lambda DAS_COMMENT((int32_t,int32_t))>::from(addX_977d082bc73e041(__context__, arg_a));
+}
+static vec4f __wrap_test_957afb9288086422 ( Context * __context__ ) {
+    return cast<bool>::from(test_957afb9288086422(__context__));
+}
+static vec4f __wrap_delete_null_lambda_f38689dea6b39c6d ( Context * __context__ ) {
+    delete_null_lambda_f38689dea6b39c6d(__context__);
+    return v_zero();
+}
+static vec4f __wrap_main_fa89e3765879cc15 ( Context * __context__ ) {
+    main_fa89e3765879cc15(__context__);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xfa05fb141d0d414b, false, (void*)&finalize_40a3051b2c93835a, &__wrap_finalize_40a3051b2c93835a },
+    { 0xb5c27336ab973fd8, false, (void*)&finalize_156fe4037ccbeda2, &__wrap_finalize_156fe4037ccbeda2 },
+    { 0x1c2fae1d0343cf6e, false, (void*)&_Func_lambda_thismodule_12_1Tickfunction_aa1cf5a28240fec6, &__wrap__Func_lambda_thismodule_12_1Tickfunction_aa1cf5a28240fec6 },
+    { 0x4dfe27fcf1346c91, false, (void*)&_Func_lambda_thismodule_12_1Tickfinalizer_d173b23cc94b9b4, &__wrap__Func_lambda_thismodule_12_1Tickfinalizer_d173b23cc94b9b4 },
+    { 0x83d241c25e8369da, false, (void*)&_Func_lambda_thismodule_20_2Tickfunction_3f51c0869f82231e, &__wrap__Func_lambda_thismodule_20_2Tickfunction_3f51c0869f82231e },
+    { 0xd1f5b2cc3033a04a, false, (void*)&_Func_lambda_thismodule_20_2Tickfinalizer_b4db6dcbe30614a7, &__wrap__Func_lambda_thismodule_20_2Tickfinalizer_b4db6dcbe30614a7 },
+    { 0x74a73235ead12ea7, false, (void*)&onlyNull_c6c10cb4033f7ab, &__wrap_onlyNull_c6c10cb4033f7ab },
+    { 0xf0a87d7c20c1ba22, false, (void*)&addX_977d082bc73e041, &__wrap_addX_977d082bc73e041 },
+    { 0x6fc77f05c4a5aee7, false, (void*)&test_957afb9288086422, &__wrap_test_957afb9288086422 },
+    { 0x10dc80eca2579866, false, (void*)&delete_null_lambda_f38689dea6b39c6d, &__wrap_delete_null_lambda_f38689dea6b39c6d },
+    { 0x3f5cae486011220d, false, (void*)&main_fa89e3765879cc15, &__wrap_main_fa89e3765879cc15 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_3893666508627823566
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
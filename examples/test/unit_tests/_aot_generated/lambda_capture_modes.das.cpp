@@ -0,0 +1,408 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_11330617902327599893 {
+
+namespace  { struct Foo; };
+namespace  { struct _lambda_thismodule_19_1; };
+namespace  { struct _lambda_thismodule_38_2; };
+namespace  {
+
+struct Foo {
+    int32_t dummy;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,dummy)==0,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_19_1 {
+    Func DAS_COMMENT((void,_lambda_thismodule_19_1)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_19_1 *)) __finalize;
+    Foo C;
+    Foo * pA;
+    Foo * pB;
+};
+static_assert(sizeof(_lambda_thismodule_19_1)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_19_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_19_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_19_1,C)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_19_1,pA)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_19_1,pB)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_38_2 {
+    Func DAS_COMMENT((void,_lambda_thismodule_38_2)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_38_2 *)) __finalize;
+    TArray<int32_t> * a1;
+    TArray<int32_t> a2;
+    TArray<int32_t> a3;
+};
+static_assert(sizeof(_lambda_thismodule_38_2)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_38_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_38_2,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_38_2,a1)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_38_2,a2)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_38_2,a3)==48,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__411ed0e77075265a;
+extern StructInfo __struct_info__cc5a80a6388381a1;
+extern StructInfo __struct_info__ef30079b199ab2dd;
+extern TypeInfo __type_info__f33465f0668a76bd;
+extern TypeInfo __type_info__b9d61f60e283e549;
+extern TypeInfo __type_info__124e1c04d9af11ea;
+extern TypeInfo __type_info__bc69a005531fe739;
+extern TypeInfo __type_info__4e6a99c42cd2e4c2;
+extern TypeInfo __type_info__711916b90dad8652;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __struct_info__411ed0e77075265a_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x789e4123e0131059), "dummy", 0, 0 };
+VarInfo * __struct_info__411ed0e77075265a_fields[1] =  { &__struct_info__411ed0e77075265a_field_0 };
+StructInfo __struct_info__411ed0e77075265a = {"Foo", "", 0, __struct_info__411ed0e77075265a_fields, 1, 4, UINT64_C(0x0), nullptr, UINT64_C(0x411ed0e77075265a), 1 };
+TypeInfo * __type_info__64a05ce784b819b6_arg_types_var_14725223383042326945[1] = { &__type_info__4e6a99c42cd2e4c2 };
+const char * __type_info__64a05ce784b819b6_arg_names_var_14725223383042326945[1] = { "__this" };
+VarInfo __struct_info__cc5a80a6388381a1_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__64a05ce784b819b6_arg_types_var_14725223383042326945, __type_info__64a05ce784b819b6_arg_names_var_14725223383042326945, 1, 0, nullptr, 12, 8, UINT64_C(0x64a05ce784b819b6), "__lambda", 0, 0 };
+TypeInfo * __type_info__89af400430a1f2df_arg_types_var_14725223383042326945[1] = { &__type_info__f33465f0668a76bd };
+VarInfo __struct_info__cc5a80a6388381a1_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__89af400430a1f2df_arg_types_var_14725223383042326945, __type_info__64a05ce784b819b6_arg_names_var_14725223383042326945, 1, 0, nullptr, 12, 8, UINT64_C(0x89af400430a1f2df), "__finalize", 8, 0 };
+VarInfo __struct_info__cc5a80a6388381a1_field_2 =  { Type::tStructure, &__struct_info__411ed0e77075265a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 4, UINT64_C(0x574b9cb3d0d2a61d), "C", 16, 0 };
+VarInfo __struct_info__cc5a80a6388381a1_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bc69a005531fe739, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x578c89b3d140f8d4), "pA", 24, 4 };
+VarInfo __struct_info__cc5a80a6388381a1_field_4 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bc69a005531fe739, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x578d89b3d142abd4), "pB", 32, 5 };
+VarInfo * __struct_info__cc5a80a6388381a1_fields[5] =  { &__struct_info__cc5a80a6388381a1_field_0, &__struct_info__cc5a80a6388381a1_field_1, &__struct_info__cc5a80a6388381a1_field_2, &__struct_info__cc5a80a6388381a1_field_3, &__struct_info__cc5a80a6388381a1_field_4 };
+StructInfo __struct_info__cc5a80a6388381a1 = {"_lambda_thismodule_19_1", "", 14, __struct_info__cc5a80a6388381a1_fields, 5, 40, UINT64_C(0x0), nullptr, UINT64_C(0xcc5a80a6388381a1), 3 };
+TypeInfo * __type_info__6bac7267528cd802_arg_types_var_17235284136677782237[1] = { &__type_info__711916b90dad8652 };
+VarInfo __struct_info__ef30079b199ab2dd_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__6bac7267528cd802_arg_types_var_17235284136677782237, __type_info__64a05ce784b819b6_arg_names_var_14725223383042326945, 1, 0, nullptr, 12, 8, UINT64_C(0x6bac7267528cd802), "__lambda", 0, 0 };
+TypeInfo * __type_info__21ba90057aed3d73_arg_types_var_17235284136677782237[1] = { &__type_info__b9d61f60e283e549 };
+VarInfo __struct_info__ef30079b199ab2dd_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__21ba90057aed3d73_arg_types_var_17235284136677782237, __type_info__64a05ce784b819b6_arg_names_var_14725223383042326945, 1, 0, nullptr, 12, 8, UINT64_C(0x21ba90057aed3d73), "__finalize", 8, 0 };
+VarInfo __struct_info__ef30079b199ab2dd_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__124e1c04d9af11ea, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x5cd589f81b712c5b), "a1", 16, 3 };
+VarInfo __struct_info__ef30079b199ab2dd_field_3 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x5cd489f81b6f795b), "a2", 24, 4 };
+VarInfo __struct_info__ef30079b199ab2dd_field_4 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x5cd389f81b6dc65b), "a3", 48, 5 };
+VarInfo * __struct_info__ef30079b199ab2dd_fields[5] =  { &__struct_info__ef30079b199ab2dd_field_0, &__struct_info__ef30079b199ab2dd_field_1, &__struct_info__ef30079b199ab2dd_field_2, &__struct_info__ef30079b199ab2dd_field_3, &__struct_info__ef30079b199ab2dd_field_4 };
+StructInfo __struct_info__ef30079b199ab2dd = {"_lambda_thismodule_38_2", "", 30, __struct_info__ef30079b199ab2dd_fields, 5, 72, UINT64_C(0x0), nullptr, UINT64_C(0xef30079b199ab2dd), 2 };
+TypeInfo __type_info__f33465f0668a76bd = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4e6a99c42cd2e4c2, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xf33465f0668a76bd) };
+TypeInfo __type_info__b9d61f60e283e549 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__711916b90dad8652, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xb9d61f60e283e549) };
+TypeInfo __type_info__124e1c04d9af11ea = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x124e1c04d9af11ea) };
+TypeInfo __type_info__bc69a005531fe739 = { Type::tStructure, &__struct_info__411ed0e77075265a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 4, UINT64_C(0xbc69a005531fe739) };
+TypeInfo __type_info__4e6a99c42cd2e4c2 = { Type::tStructure, &__struct_info__cc5a80a6388381a1, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 40, UINT64_C(0x4e6a99c42cd2e4c2) };
+TypeInfo __type_info__711916b90dad8652 = { Type::tStructure, &__struct_info__ef30079b199ab2dd, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 72, UINT64_C(0x711916b90dad8652) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline void finalize_a971396682584aa6 ( Context * __context__, _lambda_thismodule_19_1 & ____this_rename_at_19_2 );
+inline void finalize_20b9c21db6c26d6e ( Context * __context__, _lambda_thismodule_38_2 & ____this_rename_at_38_3 );
+inline void _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__, TArray<int32_t> & __a_rename_at_1142_4, TArray<int32_t> const  & __b_rename_at_1142_5 );
+inline void _Func_lambda_thismodule_19_1Tickfunction_7c7e4b25968fdc20 ( Context * __context__, _lambda_thismodule_19_1 & ____this_rename_at_19_7 );
+inline void _Func_lambda_thismodule_19_1Tickfinalizer_9ca06bdbf341328a ( Context * __context__, _lambda_thismodule_19_1 * ____this_rename_at_19_8 );
+inline void _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_177_9, int32_t __value_rename_at_177_10 );
+inline void _Func_lambda_thismodule_38_2Tickfunction_d8a1aea5b1dba1d0 ( Context * __context__, _lambda_thismodule_38_2 & ____this_rename_at_38_11 );
+inline void _Func_lambda_thismodule_38_2Tickfinalizer_52f4493dcd8179f0 ( Context * __context__, _lambda_thismodule_38_2 * ____this_rename_at_38_12 );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115 ( Context * __context__, TDim<int32_t,2> & __a_rename_at_1502_13 );
+inline void finalize_645aee70e4de29a ( Context * __context__, Foo const  & __f_rename_at_10_15 );
+inline bool test_delete_2e5062f842dccf02 ( Context * __context__ );
+inline bool test_6e0cb386d05f24b5 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global<int32_t,0x12331cdae2df3d6f>(__context__) = 0;/*g_counter*/
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void finalize_a971396682584aa6 ( Context * __context__, _lambda_thismodule_19_1 &  ____this_rename_at_19_2 )
+{
+    finalize_645aee70e4de29a(__context__,das_arg<Foo>::pass(____this_rename_at_19_2.C));
+    memset((void*)&(____this_rename_at_19_2), 0, 40);
+}
+
+inline void finalize_20b9c21db6c26d6e ( Context * __context__, _lambda_thismodule_38_2 &  ____this_rename_at_38_3 )
+{
+    memset((void*)&(____this_rename_at_38_3), 0, 72);
+}
+
+inline void _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__, TArray<int32_t> &  __a_rename_at_1142_4, TArray<int32_t> const  &  __b_rename_at_1142_5 )
+{
+    int32_t __ln_rename_at_1143_6 = ((int32_t)builtin_array_size(__b_rename_at_1142_5));
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_1142_4),__ln_rename_at_1143_6);
+    if ( __ln_rename_at_1143_6 == 0 )
+    {
+        return ;
+    } else {
+        das_memcpy(das_auto_cast<void * const >::cast(das_ref(__context__,__a_rename_at_1142_4(0,__context__))),das_auto_cast<void * const >::cast(das_ref(__context__,__b_rename_at_1142_5(0,__context__))),__ln_rename_at_1143_6 * 4);
+    };
+}
+
+inline void _Func_lambda_thismodule_19_1Tickfunction_7c7e4b25968fdc20 ( Context * __context__, _lambda_thismodule_19_1 &  ____this_rename_at_19_7 )
+{
+    DAS_ASSERT((____this_rename_at_19_7.pA->dummy == 0));
+    DAS_ASSERT((____this_rename_at_19_7.pB->dummy == 0));
+    DAS_ASSERT((____this_rename_at_19_7.C.dummy == 0));
+}
+
+inline void _Func_lambda_thismodule_19_1Tickfinalizer_9ca06bdbf341328a ( Context * __context__, _lambda_thismodule_19_1 * ____this_rename_at_19_8 )
+{
+    finalize_a971396682584aa6(__context__,das_arg<_lambda_thismodule_19_1>::pass(das_deref(__context__,____this_rename_at_19_8,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_19_1 *>::clear(__context__,____this_rename_at_19_8);
+}
+
+inline void _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_177_9, int32_t __value_rename_at_177_10 )
+{
+    das_copy(__Arr_rename_at_177_9(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_177_9),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_177_10);
+}
+
+inline void _Func_lambda_thismodule_38_2Tickfunction_d8a1aea5b1dba1d0 ( Context * __context__, _lambda_thismodule_38_2 &  ____this_rename_at_38_11 )
+{
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(das_deref(__context__,____this_rename_at_38_11.a1,__FILE__,__LINE__)),1);
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_38_11.a2),1);
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_38_11.a3),1);
+}
+
+inline void _Func_lambda_thismodule_38_2Tickfinalizer_52f4493dcd8179f0 ( Context * __context__, _lambda_thismodule_38_2 * ____this_rename_at_38_12 )
+{
+    finalize_20b9c21db6c26d6e(__context__,das_arg<_lambda_thismodule_38_2>::pass(das_deref(__context__,____this_rename_at_38_12,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_38_2 *>::clear(__context__,____this_rename_at_38_12);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115 ( Context * __context__, TDim<int32_t,2> &  __a_rename_at_1502_13 )
+{
+    TArray<int32_t> __arr_rename_at_1504_14;das_zero(__arr_rename_at_1504_14);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_14),2);
+    das_copy(das_cast<TDim<int32_t,2>>::cast(das_ref(__context__,__arr_rename_at_1504_14(0,__context__))),__a_rename_at_1502_13);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_14);
+}
+
+inline void finalize_645aee70e4de29a ( Context * __context__, Foo const  &  __f_rename_at_10_15 )
+{
+    ++das_global<int32_t,0x12331cdae2df3d6f>(__context__) /*g_counter*/;
+}
+
+inline bool test_delete_2e5062f842dccf02 ( Context * __context__ )
+{
+    Foo * __pA_rename_at_16_16 = das_new<Foo>::make(__context__);
+    Foo * __pB_rename_at_17_17 = das_new<Foo>::make(__context__);
+    Foo __C_rename_at_18_18 = (([&]() -> Foo {
+        Foo __mks_18;
+        das_zero(__mks_18);
+        return __mks_18;
+    })());
+    Lambda DAS_COMMENT((void)) __lam_rename_at_19_19; das_zero(__lam_rename_at_19_19); das_move(__lam_rename_at_19_19, das_ascend<void,_lambda_thismodule_19_1>::make(__context__,&__type_info__4e6a99c42cd2e4c2,(([&]() -> _lambda_thismodule_19_1 {
+        _lambda_thismodule_19_1 __mks_19;
+        das_copy((__mks_19.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_19_1`function XS<_lambda_thismodule_19_1>*/ 0xd5ee48a8dffe5705))));
+        das_copy((__mks_19.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_19_1`finalizer X1<S<_lambda_thismodule_19_1>>?*/ 0xdcadb22ac04ff98a))));
+        das_copy((__mks_19.C),(__C_rename_at_18_18));
+        das_copy((__mks_19.pA),(__pA_rename_at_16_16));
+        das_move((__mks_19.pB),(__pB_rename_at_17_17));
+        return __mks_19;
+    })())));
+    DAS_ASSERT((__pB_rename_at_17_17 == nullptr));
+    das_invoke_lambda<void>::invoke(__context__,nullptr,__lam_rename_at_19_19);
+    das_delete<Lambda DAS_COMMENT((void))>::clear(__context__,__lam_rename_at_19_19);
+    DAS_ASSERT((das_global<int32_t,0x12331cdae2df3d6f>(__context__) /*g_counter*/ == 1));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline bool test_6e0cb386d05f24b5 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,224,"test " DAS_FILE_LINE);
+{
+    TDim<int32_t,2> _temp_make_local_34_14_0; _temp_make_local_34_14_0;
+    TDim<int32_t,2> _temp_make_local_35_14_1; _temp_make_local_35_14_1;
+    TDim<int32_t,2> _temp_make_local_36_14_2; _temp_make_local_36_14_2;
+    TArray<int32_t> __a1_rename_at_34_20; das_zero(__a1_rename_at_34_20); das_move(__a1_rename_at_34_20, _FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+        _temp_make_local_34_14_0(0,__context__) = 1;
+        _temp_make_local_34_14_0(1,__context__) = 2;
+        return _temp_make_local_34_14_0;
+    })()))));
+    TArray<int32_t> __a2_rename_at_35_21; das_zero(__a2_rename_at_35_21); das_move(__a2_rename_at_35_21, _FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+        _temp_make_local_35_14_1(0,__context__) = 1;
+        _temp_make_local_35_14_1(1,__context__) = 2;
+        return _temp_make_local_35_14_1;
+    })()))));
+    TArray<int32_t> __a3_rename_at_36_22; das_zero(__a3_rename_at_36_22); das_move(__a3_rename_at_36_22, _FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+        _temp_make_local_36_14_2(0,__context__) = 1;
+        _temp_make_local_36_14_2(1,__context__) = 2;
+        return _temp_make_local_36_14_2;
+    })()))));
+    Lambda DAS_COMMENT((void)) __lam_rename_at_38_23; das_zero(__lam_rename_at_38_23); das_move(__lam_rename_at_38_23, das_ascend<void,_lambda_thismodule_38_2>::make(__context__,&__type_info__711916b90dad8652,(([&]() -> _lambda_thismodule_38_2 {
+        _lambda_thismodule_38_2 __mks_38;
+        das_zero(__mks_38);
+        das_copy((__mks_38.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_38_2`function XS<_lambda_thismodule_38_2>*/ 0x3399d8654424d65d))));
+        das_copy((__mks_38.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_38_2`finalizer X1<S<_lambda_thismodule_38_2>>?*/ 0x25894fba50fdd0f4))));
+        das_copy((__mks_38.a1),(das_ref(__context__,__a1_rename_at_34_20)));
+        das_move((__mks_38.a2),(__a2_rename_at_35_21));
+        {
+            _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62(__context__,das_arg<TArray<int32_t>>::pass(__mks_38.a3),das_arg<TArray<int32_t>>::pass(__a3_rename_at_36_22));
+        }        return __mks_38;
+    })())));
+    das_invoke_lambda<void>::invoke(__context__,nullptr,__lam_rename_at_38_23);
+    DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a1_rename_at_34_20)) == 3));
+    DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a2_rename_at_35_21)) == 0));
+    DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a3_rename_at_36_22)) == 2));
+    test_delete_2e5062f842dccf02(__context__);
+    return das_auto_cast<bool>::cast(true);
+}}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap_finalize_a971396682584aa6 ( Context * __context__ ) {
+    _lambda_thismodule_19_1 &  arg___this = cast_aot_arg<_lambda_thismodule_19_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_a971396682584aa6(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_20b9c21db6c26d6e ( Context * __context__ ) {
+    _lambda_thismodule_38_2 &  arg___this = cast_aot_arg<_lambda_thismodule_38_2 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_20b9c21db6c26d6e(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> const  &  arg_b = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_19_1Tickfunction_7c7e4b25968fdc20 ( Context * __context__ ) {
+    _lambda_thismodule_19_1 &  arg___this = cast_aot_arg<_lambda_thismodule_19_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_19_1Tickfunction_7c7e4b25968fdc20(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_19_1Tickfinalizer_9ca06bdbf341328a ( Context * __context__ ) {
+    _lambda_thismodule_19_1 * arg___this = cast_aot_arg<_lambda_thismodule_19_1 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_19_1Tickfinalizer_9ca06bdbf341328a(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_value = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_38_2Tickfunction_d8a1aea5b1dba1d0 ( Context * __context__ ) {
+    _lambda_thismodule_38_2 &  arg___this = cast_aot_arg<_lambda_thismodule_38_2 & >::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_38_2Tickfunction_d8a1aea5b1dba1d0(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_38_2Tickfinalizer_52f4493dcd8179f0 ( Context * __context__ ) {
+    _lambda_thismodule_38_2 * arg___this = cast_aot_arg<_lambda_thismodule_38_2 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_38_2Tickfinalizer_52f4493dcd8179f0(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115 ( Context * __context__ ) {
+    TDim<int32_t,2> &  arg_a = cast_aot_arg<TDim<int32_t,2> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap_finalize_645aee70e4de29a ( Context * __context__ ) {
+    Foo const  &  arg_f = cast_aot_arg<Foo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_645aee70e4de29a(__context__, arg_f);
+    return v_zero();
+}
+static vec4f __wrap_test_delete_2e5062f842dccf02 ( Context * __context__ ) {
+    return cast<bool>::from(test_delete_2e5062f842dccf02(__context__));
+}
+static vec4f __wrap_test_6e0cb386d05f24b5 ( Context * __context__ ) {
+    return cast<bool>::from(test_6e0cb386d05f24b5(__context__));
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xa51a880d594e91fd, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c },
+    { 0x8b411a04721031cb, false, (void*)&finalize_a971396682584aa6, &__wrap_finalize_a971396682584aa6 },
+    { 0x3603d88c646891ec, false, (void*)&finalize_20b9c21db6c26d6e, &__wrap_finalize_20b9c21db6c26d6e },
+    { 0xca1141a5df264c9, false, (void*)&_FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62, &__wrap__FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 },
+    { 0x64f4516cab509562, false, (void*)&_Func_lambda_thismodule_19_1Tickfunction_7c7e4b25968fdc20, &__wrap__Func_lambda_thismodule_19_1Tickfunction_7c7e4b25968fdc20 },
+    { 0x107aed3803c316a, false, (void*)&_Func_lambda_thismodule_19_1Tickfinalizer_9ca06bdbf341328a, &__wrap__Func_lambda_thismodule_19_1Tickfinalizer_9ca06bdbf341328a },
+    { 0xbf77bb210b0552bc, false, (void*)&_FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39, &__wrap__FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 },
+    { 0x6c9fbd4f463a2bfd, false, (void*)&_Func_lambda_thismodule_38_2Tickfunction_d8a1aea5b1dba1d0, &__wrap__Func_lambda_thismodule_38_2Tickfunction_d8a1aea5b1dba1d0 },
+    { 0xfb27849d61ff78bc, false, (void*)&_Func_lambda_thismodule_38_2Tickfinalizer_52f4493dcd8179f0, &__wrap__Func_lambda_thismodule_38_2Tickfinalizer_52f4493dcd8179f0 },
+    { 0x5c51cb37e0913516, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115 },
+    { 0x520820ec09672a68, false, (void*)&finalize_645aee70e4de29a, &__wrap_finalize_645aee70e4de29a },
+    { 0xde65174541756044, false, (void*)&test_delete_2e5062f842dccf02, &__wrap_test_delete_2e5062f842dccf02 },
+    { 0xefb09b3a87a442e3, false, (void*)&test_6e0cb386d05f24b5, &__wrap_test_6e0cb386d05f24b5 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x8b3107f90459f85d, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_11330617902327599893
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,338 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_10656299769919816877 {
+
+namespace  { struct Foo; };
+namespace  { struct _lambda_thismodule_10_1; };
+namespace  { struct _lambda_thismodule_23_2; };
+namespace  {
+
+struct Foo {
+    int32_t value;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,value)==0,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_10_1 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_10_1,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_10_1 *)) __finalize;
+    int32_t count;
+};
+static_assert(sizeof(_lambda_thismodule_10_1)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_1,count)==16,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_23_2 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_23_2,Foo)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_23_2 *)) __finalize;
+    int32_t count;
+};
+static_assert(sizeof(_lambda_thismodule_23_2)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_23_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_23_2,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_23_2,count)==16,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__411ed0e77075265a;
+extern StructInfo __struct_info__cc42f4a6386fb4dc;
+extern StructInfo __struct_info__1761859f93c14eba;
+extern TypeInfo __type_info__af8a9b4c8643c319;
+extern TypeInfo __type_info__55fcc4ef18aa8196;
+extern TypeInfo __type_info__115361fc5af8515c;
+extern TypeInfo __type_info__bc69a005531fe739;
+extern TypeInfo __type_info__4e6ba5c42ceea897;
+extern TypeInfo __type_info__99c318bd888f9785;
+extern TypeInfo __type_info__af63df4c8601f1a5;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __struct_info__411ed0e77075265a_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaad03ec119831c8e), "value", 0, 0 };
+VarInfo * __struct_info__411ed0e77075265a_fields[1] =  { &__struct_info__411ed0e77075265a_field_0 };
+StructInfo __struct_info__411ed0e77075265a = {"Foo", "", 0, __struct_info__411ed0e77075265a_fields, 1, 4, UINT64_C(0x0), nullptr, UINT64_C(0x411ed0e77075265a), 1 };
+TypeInfo * __type_info__8ca28eb4deca5ecd_arg_types_var_14718595526948795612[2] = { &__type_info__4e6ba5c42ceea897, &__type_info__af8a9b4c8643c319 };
+const char * __type_info__8ca28eb4deca5ecd_arg_names_var_14718595526948795612[2] = { "__this", "a" };
+VarInfo __struct_info__cc42f4a6386fb4dc_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__8ca28eb4deca5ecd_arg_types_var_14718595526948795612, __type_info__8ca28eb4deca5ecd_arg_names_var_14718595526948795612, 2, 0, nullptr, 12, 8, UINT64_C(0x8ca28eb4deca5ecd), "__lambda", 0, 0 };
+TypeInfo * __type_info__5f7a79728aed4906_arg_types_var_14718595526948795612[1] = { &__type_info__55fcc4ef18aa8196 };
+const char * __type_info__5f7a79728aed4906_arg_names_var_14718595526948795612[1] = { "__this" };
+VarInfo __struct_info__cc42f4a6386fb4dc_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__5f7a79728aed4906_arg_types_var_14718595526948795612, __type_info__5f7a79728aed4906_arg_names_var_14718595526948795612, 1, 0, nullptr, 12, 8, UINT64_C(0x5f7a79728aed4906), "__finalize", 8, 0 };
+VarInfo __struct_info__cc42f4a6386fb4dc_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xf7d1f4d2f50b5f35), "count", 16, 0 };
+VarInfo * __struct_info__cc42f4a6386fb4dc_fields[3] =  { &__struct_info__cc42f4a6386fb4dc_field_0, &__struct_info__cc42f4a6386fb4dc_field_1, &__struct_info__cc42f4a6386fb4dc_field_2 };
+StructInfo __struct_info__cc42f4a6386fb4dc = {"_lambda_thismodule_10_1", "", 14, __struct_info__cc42f4a6386fb4dc_fields, 3, 24, UINT64_C(0x0), nullptr, UINT64_C(0xcc42f4a6386fb4dc), 3 };
+TypeInfo * __type_info__c72291fc475172f_arg_types_var_1684774656038489786[2] = { &__type_info__99c318bd888f9785, &__type_info__bc69a005531fe739 };
+VarInfo __struct_info__1761859f93c14eba_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__c72291fc475172f_arg_types_var_1684774656038489786, __type_info__8ca28eb4deca5ecd_arg_names_var_14718595526948795612, 2, 0, nullptr, 12, 8, UINT64_C(0xc72291fc475172f), "__lambda", 0, 0 };
+TypeInfo * __type_info__bf971653fe09ecf0_arg_types_var_1684774656038489786[1] = { &__type_info__115361fc5af8515c };
+VarInfo __struct_info__1761859f93c14eba_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__bf971653fe09ecf0_arg_types_var_1684774656038489786, __type_info__5f7a79728aed4906_arg_names_var_14718595526948795612, 1, 0, nullptr, 12, 8, UINT64_C(0xbf971653fe09ecf0), "__finalize", 8, 0 };
+VarInfo __struct_info__1761859f93c14eba_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x9ea9406ac898303), "count", 16, 0 };
+VarInfo * __struct_info__1761859f93c14eba_fields[3] =  { &__struct_info__1761859f93c14eba_field_0, &__struct_info__1761859f93c14eba_field_1, &__struct_info__1761859f93c14eba_field_2 };
+StructInfo __struct_info__1761859f93c14eba = {"_lambda_thismodule_23_2", "", 14, __struct_info__1761859f93c14eba_fields, 3, 24, UINT64_C(0x0), nullptr, UINT64_C(0x1761859f93c14eba), 3 };
+TypeInfo __type_info__af8a9b4c8643c319 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 4, UINT64_C(0xaf8a9b4c8643c319) };
+TypeInfo __type_info__55fcc4ef18aa8196 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4e6ba5c42ceea897, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x55fcc4ef18aa8196) };
+TypeInfo __type_info__115361fc5af8515c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__99c318bd888f9785, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x115361fc5af8515c) };
+TypeInfo __type_info__bc69a005531fe739 = { Type::tStructure, &__struct_info__411ed0e77075265a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 4, UINT64_C(0xbc69a005531fe739) };
+TypeInfo __type_info__4e6ba5c42ceea897 = { Type::tStructure, &__struct_info__cc42f4a6386fb4dc, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 24, UINT64_C(0x4e6ba5c42ceea897) };
+TypeInfo __type_info__99c318bd888f9785 = { Type::tStructure, &__struct_info__1761859f93c14eba, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 24, UINT64_C(0x99c318bd888f9785) };
+TypeInfo __type_info__af63df4c8601f1a5 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xaf63df4c8601f1a5) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void finalize_1dfcd764f6ad95a7 ( Context * __context__, _lambda_thismodule_10_1 & ____this_rename_at_10_0 );
+inline void finalize_89806a8b3a375c45 ( Context * __context__, _lambda_thismodule_23_2 & ____this_rename_at_23_1 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickeachTick9663565701927713696_d9e358224d9e2860 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_1443_2 );
+inline Sequence DAS_COMMENT((Foo)) _FuncbuiltinTickeachTick9663565701927713696_a7be346270773062 ( Context * __context__, Lambda DAS_COMMENT((bool,Foo)) const  __lam_rename_at_1443_4 );
+inline bool _Func_lambda_thismodule_10_1Tickfunction_c48d2c7c485ef1ef ( Context * __context__, _lambda_thismodule_10_1 & ____this_rename_at_10_6, int32_t & __a_rename_at_10_7 );
+inline void _Func_lambda_thismodule_10_1Tickfinalizer_64074f0315e729c ( Context * __context__, _lambda_thismodule_10_1 * ____this_rename_at_10_8 );
+inline bool _Func_lambda_thismodule_23_2Tickfunction_c653927cc8780726 ( Context * __context__, _lambda_thismodule_23_2 & ____this_rename_at_23_9, Foo & __a_rename_at_23_10 );
+inline void _Func_lambda_thismodule_23_2Tickfinalizer_16c09e8781060ebc ( Context * __context__, _lambda_thismodule_23_2 * ____this_rename_at_23_11 );
+inline bool test_967af429d12edfc8 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void finalize_1dfcd764f6ad95a7 ( Context * __context__, _lambda_thismodule_10_1 &  ____this_rename_at_10_0 )
+{
+    memset((void*)&(____this_rename_at_10_0), 0, 24);
+}
+
+inline void finalize_89806a8b3a375c45 ( Context * __context__, _lambda_thismodule_23_2 &  ____this_rename_at_23_1 )
+{
+    memset((void*)&(____this_rename_at_23_1), 0, 24);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickeachTick9663565701927713696_d9e358224d9e2860 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_1443_2 )
+{
+    Sequence DAS_COMMENT((int32_t)) __it_rename_at_1445_3;das_zero(__it_rename_at_1445_3);
+    builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_1445_3),__lam_rename_at_1443_2,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_1445_3);
+}
+
+inline Sequence DAS_COMMENT((Foo)) _FuncbuiltinTickeachTick9663565701927713696_a7be346270773062 ( Context * __context__, Lambda DAS_COMMENT((bool,Foo)) const  __lam_rename_at_1443_4 )
+{
+    Sequence DAS_COMMENT((Foo)) __it_rename_at_1445_5;das_zero(__it_rename_at_1445_5);
+    builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((Foo))>::pass(__it_rename_at_1445_5),__lam_rename_at_1443_4,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((Foo))>::cast(__it_rename_at_1445_5);
+}
+
+inline bool _Func_lambda_thismodule_10_1Tickfunction_c48d2c7c485ef1ef ( Context * __context__, _lambda_thismodule_10_1 &  ____this_rename_at_10_6, int32_t & __a_rename_at_10_7 )
+{
+    if ( ____this_rename_at_10_6.count < 10 )
+    {
+        das_copy(__a_rename_at_10_7,____this_rename_at_10_6.count++);
+        return das_auto_cast<bool>::cast(true);
+    } else {
+        return das_auto_cast<bool>::cast(false);
+    };
+}
+
+inline void _Func_lambda_thismodule_10_1Tickfinalizer_64074f0315e729c ( Context * __context__, _lambda_thismodule_10_1 * ____this_rename_at_10_8 )
+{
+    finalize_1dfcd764f6ad95a7(__context__,das_arg<_lambda_thismodule_10_1>::pass(das_deref(__context__,____this_rename_at_10_8,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_10_1 *>::clear(__context__,____this_rename_at_10_8);
+}
+
+inline bool _Func_lambda_thismodule_23_2Tickfunction_c653927cc8780726 ( Context * __context__, _lambda_thismodule_23_2 &  ____this_rename_at_23_9, Foo &  __a_rename_at_23_10 )
+{
+    if ( ____this_rename_at_23_9.count < 10 )
+    {
+        das_copy(__a_rename_at_23_10.value,____this_rename_at_23_9.count++);
+        return das_auto_cast<bool>::cast(true);
+    } else {
+        return das_auto_cast<bool>::cast(false);
+    };
+}
+
+inline void _Func_lambda_thismodule_23_2Tickfinalizer_16c09e8781060ebc ( Context * __context__, _lambda_thismodule_23_2 * ____this_rename_at_23_11 )
+{
+    finalize_89806a8b3a375c45(__context__,das_arg<_lambda_thismodule_23_2>::pass(das_deref(__context__,____this_rename_at_23_11,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_23_2 *>::clear(__context__,____this_rename_at_23_11);
+}
+
+inline bool test_967af429d12edfc8 ( Context * __context__ )
+{
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_19_18_0; _temp_make_local_19_18_0;
+    Sequence DAS_COMMENT((Foo)) _temp_make_local_31_18_1; _temp_make_local_31_18_1;
+    Lambda DAS_COMMENT((bool,int32_t &)) __lam_rename_at_10_12; das_zero(__lam_rename_at_10_12); das_move(__lam_rename_at_10_12, ((Lambda DAS_COMMENT((bool,int32_t &)))das_ascend<bool,_lambda_thismodule_10_1>::make(__context__,&__type_info__4e6ba5c42ceea897,(([&]() -> _lambda_thismodule_10_1 {
+        _lambda_thismodule_10_1 __mks_10;
+        das_copy((__mks_10.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_10_1`function XS<_lambda_thismodule_10_1> &i*/ 0xdc74e7bc5420b526))));
+        das_copy((__mks_10.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_10_1`finalizer X1<S<_lambda_thismodule_10_1>>?*/ 0xd0cfcf0ce6f78fc9))));
+        das_copy((__mks_10.count),(0));
+        return __mks_10;
+    })()))));
+    {
+        bool __need_loop_19 = true;
+        // x: int
+        das_iterator<Sequence DAS_COMMENT((int32_t))> __x_iterator((_temp_make_local_19_18_0 = (_FuncbuiltinTickeachTick9663565701927713696_d9e358224d9e2860(__context__,__lam_rename_at_10_12))));
+        int32_t __x_rename_at_19_15;
+        __need_loop_19 = __x_iterator.first(__context__,(__x_rename_at_19_15)) && __need_loop_19;
+        // tx: int const
+        das_iterator<range> __tx_iterator(range(0,10));
+        int32_t __tx_rename_at_19_16;
+        __need_loop_19 = __tx_iterator.first(__context__,(__tx_rename_at_19_16)) && __need_loop_19;
+        for ( ; __need_loop_19 ; __need_loop_19 = __x_iterator.next(__context__,(__x_rename_at_19_15)) && __tx_iterator.next(__context__,(__tx_rename_at_19_16)) )
+        {
+            DAS_ASSERT((__x_rename_at_19_15 == __tx_rename_at_19_16));
+        }
+        __tx_iterator.close(__context__,(__tx_rename_at_19_16));
+        __x_iterator.close(__context__,(__x_rename_at_19_15));
+    };
+    Lambda DAS_COMMENT((bool,Foo)) __lamF_rename_at_23_17; das_zero(__lamF_rename_at_23_17); das_move(__lamF_rename_at_23_17, ((Lambda DAS_COMMENT((bool,Foo)))das_ascend<bool,_lambda_thismodule_23_2>::make(__context__,&__type_info__99c318bd888f9785,(([&]() -> _lambda_thismodule_23_2 {
+        _lambda_thismodule_23_2 __mks_23;
+        das_copy((__mks_23.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_23_2`function XS<_lambda_thismodule_23_2> S<Foo>*/ 0x7527ec13d53d87b0))));
+        das_copy((__mks_23.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_23_2`finalizer X1<S<_lambda_thismodule_23_2>>?*/ 0xd5f8cab8d5ae07b0))));
+        das_copy((__mks_23.count),(0));
+        return __mks_23;
+    })()))));
+    {
+        bool __need_loop_31 = true;
+        // y: Foo
+        das_iterator<Sequence DAS_COMMENT((Foo))> __y_iterator((_temp_make_local_31_18_1 = (_FuncbuiltinTickeachTick9663565701927713696_a7be346270773062(__context__,__lamF_rename_at_23_17))));
+        Foo __y_rename_at_31_20;
+        __need_loop_31 = __y_iterator.first(__context__,(__y_rename_at_31_20)) && __need_loop_31;
+        // ty: int const
+        das_iterator<range> __ty_iterator(range(0,10));
+        int32_t __ty_rename_at_31_21;
+        __need_loop_31 = __ty_iterator.first(__context__,(__ty_rename_at_31_21)) && __need_loop_31;
+        for ( ; __need_loop_31 ; __need_loop_31 = __y_iterator.next(__context__,(__y_rename_at_31_20)) && __ty_iterator.next(__context__,(__ty_rename_at_31_21)) )
+        {
+            DAS_ASSERT((__y_rename_at_31_20.value == __ty_rename_at_31_21));
+        }
+        __ty_iterator.close(__context__,(__ty_rename_at_31_21));
+        __y_iterator.close(__context__,(__y_rename_at_31_20));
+    };
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_finalize_1dfcd764f6ad95a7 ( Context * __context__ ) {
+    _lambda_thismodule_10_1 &  arg___this = cast_aot_arg<_lambda_thismodule_10_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_1dfcd764f6ad95a7(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_89806a8b3a375c45 ( Context * __context__ ) {
+    _lambda_thismodule_23_2 &  arg___this = cast_aot_arg<_lambda_thismodule_23_2 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_89806a8b3a375c45(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeachTick9663565701927713696_d9e358224d9e2860 ( Context * __context__ ) {
+    Lambda DAS_COMMENT((bool,int32_t &)) const  arg_lam = cast_aot_arg<Lambda DAS_COMMENT((bool,int32_t &)) const >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncbuiltinTickeachTick9663565701927713696_d9e358224d9e2860(__context__, arg_lam);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeachTick9663565701927713696_a7be346270773062 ( Context * __context__ ) {
+    Lambda DAS_COMMENT((bool,Foo)) const  arg_lam = cast_aot_arg<Lambda DAS_COMMENT((bool,Foo)) const >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((Foo)) *) __context__->abiCMRES) = _FuncbuiltinTickeachTick9663565701927713696_a7be346270773062(__context__, arg_lam);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_10_1Tickfunction_c48d2c7c485ef1ef ( Context * __context__ ) {
+    _lambda_thismodule_10_1 &  arg___this = cast_aot_arg<_lambda_thismodule_10_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg_a = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_10_1Tickfunction_c48d2c7c485ef1ef(__context__, arg___this, arg_a));
+}
+static vec4f __wrap__Func_lambda_thismodule_10_1Tickfinalizer_64074f0315e729c ( Context * __context__ ) {
+    _lambda_thismodule_10_1 * arg___this = cast_aot_arg<_lambda_thismodule_10_1 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_10_1Tickfinalizer_64074f0315e729c(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_23_2Tickfunction_c653927cc8780726 ( Context * __context__ ) {
+    _lambda_thismodule_23_2 &  arg___this = cast_aot_arg<_lambda_thismodule_23_2 & >::to(*__context__,__context__->abiArguments()[0]);
+    Foo &  arg_a = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_23_2Tickfunction_c653927cc8780726(__context__, arg___this, arg_a));
+}
+static vec4f __wrap__Func_lambda_thismodule_23_2Tickfinalizer_16c09e8781060ebc ( Context * __context__ ) {
+    _lambda_thismodule_23_2 * arg___this = cast_aot_arg<_lambda_thismodule_23_2 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_23_2Tickfinalizer_16c09e8781060ebc(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_test_967af429d12edfc8 ( Context * __context__ ) {
+    return cast<bool>::from(test_967af429d12edfc8(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x47a1f9ed34149366, false, (void*)&finalize_1dfcd764f6ad95a7, &__wrap_finalize_1dfcd764f6ad95a7 },
+    { 0x803e4d8831b10945, false, (void*)&finalize_89806a8b3a375c45, &__wrap_finalize_89806a8b3a375c45 },
+    { 0xc243ed7d395172ce, true, (void*)&_FuncbuiltinTickeachTick9663565701927713696_d9e358224d9e2860, &__wrap__FuncbuiltinTickeachTick9663565701927713696_d9e358224d9e2860 },
+    { 0xd5294f3bc63afca8, true, (void*)&_FuncbuiltinTickeachTick9663565701927713696_a7be346270773062, &__wrap__FuncbuiltinTickeachTick9663565701927713696_a7be346270773062 },
+    { 0x72ccd16247a20b24, false, (void*)&_Func_lambda_thismodule_10_1Tickfunction_c48d2c7c485ef1ef, &__wrap__Func_lambda_thismodule_10_1Tickfunction_c48d2c7c485ef1ef },
+    { 0xe6fc493fba2f9c97, false, (void*)&_Func_lambda_thismodule_10_1Tickfinalizer_64074f0315e729c, &__wrap__Func_lambda_thismodule_10_1Tickfinalizer_64074f0315e729c },
+    { 0x859aee1388b17eb7, false, (void*)&_Func_lambda_thismodule_23_2Tickfunction_c653927cc8780726, &__wrap__Func_lambda_thismodule_23_2Tickfunction_c653927cc8780726 },
+    { 0x19fe4fb411239e30, false, (void*)&_Func_lambda_thismodule_23_2Tickfinalizer_16c09e8781060ebc, &__wrap__Func_lambda_thismodule_23_2Tickfinalizer_16c09e8781060ebc },
+    { 0xb2365c3963d69643, false, (void*)&test_967af429d12edfc8, &__wrap_test_967af429d12edfc8 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_10656299769919816877
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
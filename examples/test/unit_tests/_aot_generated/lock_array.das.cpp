@@ -0,0 +1,376 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_13675243999843571892 {
+
+// unused enumeration GooEnum
+// unused enumeration OpCode
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+extern TypeInfo __type_info__faddbd75a1c6e729;
+extern TypeInfo __type_info__67aa11731102856a;
+extern TypeInfo __type_info__86e65058575787a;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __func_info__5e4f385bd04ab869_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__faddbd75a1c6e729, nullptr, nullptr, nullptr, 0, 0, nullptr, 8300, 8, UINT64_C(0x71ada93c65441ed), "data", 0, 0 };
+VarInfo __func_info__5e4f385bd04ab869_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xf43af3b7a0b462e3), "size", 0, 0 };
+VarInfo * __func_info__5e4f385bd04ab869_fields[2] =  { &__func_info__5e4f385bd04ab869_field_0, &__func_info__5e4f385bd04ab869_field_1 };
+FuncInfo __func_info__5e4f385bd04ab869 = {"invoke block<(data:int aka TT const? const#;size:int const):void> const", "", __func_info__5e4f385bd04ab869_fields, 2, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x5e4f385bd04ab869), 0x0 };
+VarInfo __func_info__952eff0d65e63509_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__86e65058575787a, nullptr, nullptr, nullptr, 0, 0, nullptr, 41058, 24, UINT64_C(0x945cc801dfbe959c), "tarr", 0, 0 };
+VarInfo * __func_info__952eff0d65e63509_fields[1] =  { &__func_info__952eff0d65e63509_field_0 };
+FuncInfo __func_info__952eff0d65e63509 = {"invoke block<(tarr:array<int aka TT> const#):void> const", "", __func_info__952eff0d65e63509_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x952eff0d65e63509), 0x0 };
+VarInfo __func_info__ece151dbcce65d52_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__86e65058575787a, nullptr, nullptr, nullptr, 0, 0, nullptr, 8268, 8, UINT64_C(0xf3f0b0f03fcc965f), "data", 0, 0 };
+VarInfo __func_info__ece151dbcce65d52_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xf43af3b7a0b462e3), "size", 0, 0 };
+VarInfo * __func_info__ece151dbcce65d52_fields[2] =  { &__func_info__ece151dbcce65d52_field_0, &__func_info__ece151dbcce65d52_field_1 };
+FuncInfo __func_info__ece151dbcce65d52 = {"invoke block<(var data:int aka TT?#;size:int const):void> const", "", __func_info__ece151dbcce65d52_fields, 2, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xece151dbcce65d52), 0x0 };
+VarInfo __func_info__9086fa24860e60e5_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__67aa11731102856a, nullptr, nullptr, nullptr, 0, 0, nullptr, 41026, 24, UINT64_C(0x35876da23d38ea7a), "ftarr", 0, 0 };
+VarInfo * __func_info__9086fa24860e60e5_fields[1] =  { &__func_info__9086fa24860e60e5_field_0 };
+FuncInfo __func_info__9086fa24860e60e5 = {"invoke block<(var ftarr:array<UnitTest::TestObjectFoo aka TT>#):void> const", "", __func_info__9086fa24860e60e5_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x9086fa24860e60e5), 0x0 };
+VarInfo __func_info__5c9f3d63a66fb96b_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__86e65058575787a, nullptr, nullptr, nullptr, 0, 0, nullptr, 41026, 24, UINT64_C(0x5703bcc1062b3ee2), "tarr2", 0, 0 };
+VarInfo * __func_info__5c9f3d63a66fb96b_fields[1] =  { &__func_info__5c9f3d63a66fb96b_field_0 };
+FuncInfo __func_info__5c9f3d63a66fb96b = {"invoke block<(var tarr2:array<int aka TT>#):void> const", "", __func_info__5c9f3d63a66fb96b_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x5c9f3d63a66fb96b), 0x0 };
+TypeInfo __type_info__faddbd75a1c6e729 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xfaddbd75a1c6e729) };
+TypeInfo __type_info__67aa11731102856a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~UnitTest::TestObjectFoo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 56, UINT64_C(0x67aa11731102856a) };
+TypeInfo __type_info__86e65058575787a = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x86e65058575787a) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {__type_info__67aa11731102856a, };
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_177_0, int32_t __value_rename_at_177_1 );
+inline void _FuncbuiltinTicklockTick17406484233027870858_1719d44f11b120ad ( Context * __context__, TArray<int32_t> const  & __a_rename_at_1800_2, Block DAS_COMMENT((void,TArray<int32_t> const )) const  & __blk_rename_at_1800_3 );
+inline void _FuncbuiltinTicklock_dataTick13321741783688336016_40f7c380468cd136 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_1824_4, Block DAS_COMMENT((void,int32_t const  * const ,int32_t)) const  & __blk_rename_at_1824_5 );
+inline void _FuncbuiltinTicklock_dataTick16521723914664780332_d97099a5c88a19ef ( Context * __context__, TArray<int32_t> & __a_rename_at_1808_7, Block DAS_COMMENT((void,int32_t *,int32_t)) const  & __blk_rename_at_1808_8 );
+inline void _FuncbuiltinTicklockTick12896323001918315340_ae644b3e40a0be63 ( Context * __context__, TArray<int32_t> & __a_rename_at_1792_11, Block DAS_COMMENT((void,TArray<int32_t>)) const  & __blk_rename_at_1792_12 );
+inline void _FuncbuiltinTickpushTick10769833213962245646_e13f1471dee7c0e7 ( Context * __context__, TArray<TestObjectFoo> & __Arr_rename_at_193_13, TestObjectFoo & __value_rename_at_193_14 );
+inline void _FuncbuiltinTicklockTick12896323001918315340_c07edc633235a15b ( Context * __context__, TArray<TestObjectFoo> & __a_rename_at_1792_15, Block DAS_COMMENT((void,TArray<TestObjectFoo>)) const  & __blk_rename_at_1792_16 );
+inline bool test_4319a97b3bfe6429 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_177_0, int32_t __value_rename_at_177_1 )
+{
+    das_copy(__Arr_rename_at_177_0(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_177_0),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_177_1);
+}
+
+inline void _FuncbuiltinTicklockTick17406484233027870858_1719d44f11b120ad ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_1800_2, Block DAS_COMMENT((void,TArray<int32_t> const )) const  &  __blk_rename_at_1800_3 )
+{
+    builtin_array_lock(__a_rename_at_1800_2,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    das_invoke<void>::invoke<TArray<int32_t> const  &>(__context__,nullptr,__blk_rename_at_1800_3,das_cast<TArray<int32_t> const >::cast(__a_rename_at_1800_2));
+    builtin_array_unlock(__a_rename_at_1800_2,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTicklock_dataTick13321741783688336016_40f7c380468cd136 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_1824_4, Block DAS_COMMENT((void,int32_t const  * const ,int32_t)) const  &  __blk_rename_at_1824_5 )
+{
+    int32_t __len_rename_at_1825_6 = ((int32_t)builtin_array_size(__a_rename_at_1824_4));
+    if ( __len_rename_at_1825_6 != 0 )
+    {
+        builtin_array_lock(__a_rename_at_1824_4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        das_invoke<void>::invoke<int32_t const  *,int32_t>(__context__,nullptr,__blk_rename_at_1824_5,das_cast<int32_t const  *>::cast(das_ref(__context__,__a_rename_at_1824_4(0,__context__))),__len_rename_at_1825_6);
+        builtin_array_unlock(__a_rename_at_1824_4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    } else {
+        das_invoke<void>::invoke<int32_t const  *,int32_t>(__context__,nullptr,__blk_rename_at_1824_5,das_cast<int32_t const  *>::cast(nullptr),0);
+    };
+}
+
+inline void _FuncbuiltinTicklock_dataTick16521723914664780332_d97099a5c88a19ef ( Context * __context__, TArray<int32_t> &  __a_rename_at_1808_7, Block DAS_COMMENT((void,int32_t *,int32_t)) const  &  __blk_rename_at_1808_8 )
+{
+    int32_t __len_rename_at_1809_9 = ((int32_t)builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_1808_7)));
+    if ( __len_rename_at_1809_9 != 0 )
+    {
+        builtin_array_lock(das_arg<TArray<int32_t>>::pass(__a_rename_at_1808_7),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        das_invoke<void>::invoke<int32_t *,int32_t>(__context__,nullptr,__blk_rename_at_1808_8,das_cast<int32_t *>::cast(das_ref(__context__,__a_rename_at_1808_7(0,__context__))),__len_rename_at_1809_9);
+        builtin_array_unlock(das_arg<TArray<int32_t>>::pass(__a_rename_at_1808_7),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    } else {
+        int32_t * __nullT_rename_at_1817_10 = 0;
+        das_invoke<void>::invoke<int32_t *,int32_t>(__context__,nullptr,__blk_rename_at_1808_8,das_cast<int32_t *>::cast(__nullT_rename_at_1817_10),0);
+    };
+}
+
+inline void _FuncbuiltinTicklockTick12896323001918315340_ae644b3e40a0be63 ( Context * __context__, TArray<int32_t> &  __a_rename_at_1792_11, Block DAS_COMMENT((void,TArray<int32_t>)) const  &  __blk_rename_at_1792_12 )
+{
+    builtin_array_lock(das_arg<TArray<int32_t>>::pass(__a_rename_at_1792_11),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    das_invoke<void>::invoke<TArray<int32_t> &>(__context__,nullptr,__blk_rename_at_1792_12,das_arg<TArray<int32_t>>::pass(das_cast<TArray<int32_t>>::cast(__a_rename_at_1792_11)));
+    builtin_array_unlock(das_arg<TArray<int32_t>>::pass(__a_rename_at_1792_11),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickpushTick10769833213962245646_e13f1471dee7c0e7 ( Context * __context__, TArray<TestObjectFoo> &  __Arr_rename_at_193_13, TestObjectFoo &  __value_rename_at_193_14 )
+{
+    das_copy(__Arr_rename_at_193_13(builtin_array_push_back(das_arg<TArray<TestObjectFoo>>::pass(__Arr_rename_at_193_13),56,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_193_14);
+}
+
+inline void _FuncbuiltinTicklockTick12896323001918315340_c07edc633235a15b ( Context * __context__, TArray<TestObjectFoo> &  __a_rename_at_1792_15, Block DAS_COMMENT((void,TArray<TestObjectFoo>)) const  &  __blk_rename_at_1792_16 )
+{
+    builtin_array_lock(das_arg<TArray<TestObjectFoo>>::pass(__a_rename_at_1792_15),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    das_invoke<void>::invoke<TArray<TestObjectFoo> &>(__context__,nullptr,__blk_rename_at_1792_16,das_arg<TArray<TestObjectFoo>>::pass(das_cast<TArray<TestObjectFoo>>::cast(__a_rename_at_1792_15)));
+    builtin_array_unlock(das_arg<TArray<TestObjectFoo>>::pass(__a_rename_at_1792_15),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline bool test_4319a97b3bfe6429 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,208,"test " DAS_FILE_LINE);
+{
+    TestObjectFoo _temp_make_local_38_15_0; _temp_make_local_38_15_0;
+    TArray<int32_t> __arr_rename_at_7_17_ConstRef; das_zero(__arr_rename_at_7_17_ConstRef); das_move(__arr_rename_at_7_17_ConstRef, ((TArray<int32_t>)das_invoke<TArray<int32_t>>::invoke_cmres(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> TArray<int32_t>{
+        TArray<int32_t> ____acomp_7_16_rename_at_7_18;das_zero(____acomp_7_16_rename_at_7_18);
+        builtin_set_verify_array_locks(das_arg<TArray<int32_t>>::pass(____acomp_7_16_rename_at_7_18),false);
+        {
+            bool __need_loop_7 = true;
+            // x: int const
+            das_iterator<range> __x_iterator(range(0,10));
+            int32_t __x_rename_at_7_19;
+            __need_loop_7 = __x_iterator.first(__context__,(__x_rename_at_7_19)) && __need_loop_7;
+            for ( ; __need_loop_7 ; __need_loop_7 = __x_iterator.next(__context__,(__x_rename_at_7_19)) )
+            {
+                _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(____acomp_7_16_rename_at_7_18),__x_rename_at_7_19);
+            }
+            __x_iterator.close(__context__,(__x_rename_at_7_19));
+        };
+        builtin_set_verify_array_locks(das_arg<TArray<int32_t>>::pass(____acomp_7_16_rename_at_7_18),true);
+        return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(____acomp_7_16_rename_at_7_18);
+    })));
+    TArray<int32_t> const  & __arr_rename_at_7_17 = __arr_rename_at_7_17_ConstRef;
+;
+    _FuncbuiltinTicklockTick17406484233027870858_1719d44f11b120ad(__context__,__arr_rename_at_7_17,das_make_block<void,TArray<int32_t> const  &>(__context__,112,0,&__func_info__952eff0d65e63509,[&](TArray<int32_t> const  & __tarr_rename_at_8_20) -> void{
+        {
+            bool __need_loop_9 = true;
+            // a: int const&
+            das_iterator<TArray<int32_t> const > __a_iterator(__arr_rename_at_7_17);
+            int32_t const  * __a_rename_at_9_23;
+            __need_loop_9 = __a_iterator.first(__context__,(__a_rename_at_9_23)) && __need_loop_9;
+            // b: int aka TT const&#
+            das_iterator<TArray<int32_t> const > __b_iterator(__tarr_rename_at_8_20);
+            int32_t const  * __b_rename_at_9_24;
+            __need_loop_9 = __b_iterator.first(__context__,(__b_rename_at_9_24)) && __need_loop_9;
+            for ( ; __need_loop_9 ; __need_loop_9 = __a_iterator.next(__context__,(__a_rename_at_9_23)) && __b_iterator.next(__context__,(__b_rename_at_9_24)) )
+            {
+                DAS_ASSERT(((*__a_rename_at_9_23) == (*__b_rename_at_9_24)));
+            }
+            __b_iterator.close(__context__,(__b_rename_at_9_24));
+            __a_iterator.close(__context__,(__a_rename_at_9_23));
+        };
+    }));
+    _FuncbuiltinTicklock_dataTick13321741783688336016_40f7c380468cd136(__context__,__arr_rename_at_7_17,das_make_block<void,int32_t const  * const ,int32_t>(__context__,112,0,&__func_info__5e4f385bd04ab869,[&](int32_t const  * const  __data_rename_at_13_25, int32_t const  __size_rename_at_13_26) -> void{
+        {
+            bool __need_loop_14 = true;
+            // j: int const
+            das_iterator<range> __j_iterator(range(0,10));
+            int32_t __j_rename_at_14_27;
+            __need_loop_14 = __j_iterator.first(__context__,(__j_rename_at_14_27)) && __need_loop_14;
+            for ( ; __need_loop_14 ; __need_loop_14 = __j_iterator.next(__context__,(__j_rename_at_14_27)) )
+            {
+                DAS_ASSERT((das_index<int32_t const  * const >::at(__data_rename_at_13_25,__j_rename_at_14_27,__context__) == __j_rename_at_14_27));
+            }
+            __j_iterator.close(__context__,(__j_rename_at_14_27));
+        };
+    }));
+    TArray<int32_t> __arr2_rename_at_20_28; das_zero(__arr2_rename_at_20_28); das_move(__arr2_rename_at_20_28, das_invoke<TArray<int32_t>>::invoke_cmres(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> TArray<int32_t>{
+        TArray<int32_t> ____acomp_20_17_rename_at_20_29;das_zero(____acomp_20_17_rename_at_20_29);
+        builtin_set_verify_array_locks(das_arg<TArray<int32_t>>::pass(____acomp_20_17_rename_at_20_29),false);
+        {
+            bool __need_loop_20 = true;
+            // x: int const
+            das_iterator<range> __x_iterator(range(0,10));
+            int32_t __x_rename_at_20_30;
+            __need_loop_20 = __x_iterator.first(__context__,(__x_rename_at_20_30)) && __need_loop_20;
+            for ( ; __need_loop_20 ; __need_loop_20 = __x_iterator.next(__context__,(__x_rename_at_20_30)) )
+            {
+                _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(____acomp_20_17_rename_at_20_29),__x_rename_at_20_30);
+            }
+            __x_iterator.close(__context__,(__x_rename_at_20_30));
+        };
+        builtin_set_verify_array_locks(das_arg<TArray<int32_t>>::pass(____acomp_20_17_rename_at_20_29),true);
+        return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(____acomp_20_17_rename_at_20_29);
+    }));
+    _FuncbuiltinTicklock_dataTick16521723914664780332_d97099a5c88a19ef(__context__,das_arg<TArray<int32_t>>::pass(__arr2_rename_at_20_28),das_make_block<void,int32_t *,int32_t>(__context__,144,0,&__func_info__ece151dbcce65d52,[&](int32_t * __data_rename_at_21_31, int32_t const  __size_rename_at_21_32) -> void{
+        {
+            bool __need_loop_22 = true;
+            // j: int const
+            das_iterator<range> __j_iterator(range(0,10));
+            int32_t __j_rename_at_22_33;
+            __need_loop_22 = __j_iterator.first(__context__,(__j_rename_at_22_33)) && __need_loop_22;
+            for ( ; __need_loop_22 ; __need_loop_22 = __j_iterator.next(__context__,(__j_rename_at_22_33)) )
+            {
+                das_copy(das_index<int32_t *>::at(__data_rename_at_21_31,__j_rename_at_22_33,__context__),__j_rename_at_22_33 * 2);
+            }
+            __j_iterator.close(__context__,(__j_rename_at_22_33));
+        };
+    }));
+    {
+        bool __need_loop_28 = true;
+        // j: int const
+        das_iterator<range> __j_iterator(range(0,10));
+        int32_t __j_rename_at_28_34;
+        __need_loop_28 = __j_iterator.first(__context__,(__j_rename_at_28_34)) && __need_loop_28;
+        for ( ; __need_loop_28 ; __need_loop_28 = __j_iterator.next(__context__,(__j_rename_at_28_34)) )
+        {
+            DAS_ASSERT((__arr2_rename_at_20_28(__j_rename_at_28_34,__context__) == (__j_rename_at_28_34 * 2)));
+        }
+        __j_iterator.close(__context__,(__j_rename_at_28_34));
+    };
+    _FuncbuiltinTicklockTick12896323001918315340_ae644b3e40a0be63(__context__,das_arg<TArray<int32_t>>::pass(__arr2_rename_at_20_28),das_make_block<void,TArray<int32_t> &>(__context__,144,0,&__func_info__5c9f3d63a66fb96b,[&](TArray<int32_t> & __tarr2_rename_at_31_35) -> void{
+        {
+            bool __need_loop_32 = true;
+            // a: int&
+            das_iterator<TArray<int32_t>> __a_iterator(__arr2_rename_at_20_28);
+            int32_t * __a_rename_at_32_38;
+            __need_loop_32 = __a_iterator.first(__context__,(__a_rename_at_32_38)) && __need_loop_32;
+            // b: int aka TT&#
+            das_iterator<TArray<int32_t>> __b_iterator(__tarr2_rename_at_31_35);
+            int32_t * __b_rename_at_32_39;
+            __need_loop_32 = __b_iterator.first(__context__,(__b_rename_at_32_39)) && __need_loop_32;
+            for ( ; __need_loop_32 ; __need_loop_32 = __a_iterator.next(__context__,(__a_rename_at_32_38)) && __b_iterator.next(__context__,(__b_rename_at_32_39)) )
+            {
+                DAS_ASSERT(((*__a_rename_at_32_38) == (*__b_rename_at_32_39)));
+            }
+            __b_iterator.close(__context__,(__b_rename_at_32_39));
+            __a_iterator.close(__context__,(__a_rename_at_32_38));
+        };
+    }));
+    TArray<TestObjectFoo> __farr_rename_at_37_40;das_zero(__farr_rename_at_37_40);
+    _FuncbuiltinTickpushTick10769833213962245646_e13f1471dee7c0e7(__context__,das_arg<TArray<TestObjectFoo>>::pass(__farr_rename_at_37_40),das_arg<TestObjectFoo>::pass((([&]() -> TestObjectFoo& {
+        das_zero(_temp_make_local_38_15_0);
+        return _temp_make_local_38_15_0;
+    })())));
+    _FuncbuiltinTicklockTick12896323001918315340_c07edc633235a15b(__context__,das_arg<TArray<TestObjectFoo>>::pass(__farr_rename_at_37_40),das_make_block<void,TArray<TestObjectFoo> &>(__context__,176,0,&__func_info__9086fa24860e60e5,[&](TArray<TestObjectFoo> & __ftarr_rename_at_39_41) -> void{
+        TestObjectFoo * __q_rename_at_40_42 = das_ref(__context__,__ftarr_rename_at_39_41(0,__context__));
+        set_foo_data(__q_rename_at_40_42,1234);
+    }));
+    DAS_ASSERT((__farr_rename_at_37_40(0,__context__).fooData /*fooData*/ == 1234));
+    return das_auto_cast<bool>::cast(true);
+}}
+static vec4f __wrap__FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_value = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTicklockTick17406484233027870858_1719d44f11b120ad ( Context * __context__ ) {
+    TArray<int32_t> const  &  arg_a = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((void,TArray<int32_t> const )) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((void,TArray<int32_t> const )) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTicklockTick17406484233027870858_1719d44f11b120ad(__context__, arg_a, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTicklock_dataTick13321741783688336016_40f7c380468cd136 ( Context * __context__ ) {
+    TArray<int32_t> const  &  arg_a = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((void,int32_t const  * const ,int32_t)) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((void,int32_t const  * const ,int32_t)) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTicklock_dataTick13321741783688336016_40f7c380468cd136(__context__, arg_a, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTicklock_dataTick16521723914664780332_d97099a5c88a19ef ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((void,int32_t *,int32_t)) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((void,int32_t *,int32_t)) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTicklock_dataTick16521723914664780332_d97099a5c88a19ef(__context__, arg_a, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTicklockTick12896323001918315340_ae644b3e40a0be63 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((void,TArray<int32_t>)) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((void,TArray<int32_t>)) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTicklockTick12896323001918315340_ae644b3e40a0be63(__context__, arg_a, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpushTick10769833213962245646_e13f1471dee7c0e7 ( Context * __context__ ) {
+    TArray<TestObjectFoo> &  arg_Arr = cast_aot_arg<TArray<TestObjectFoo> & >::to(*__context__,__context__->abiArguments()[0]);
+    TestObjectFoo &  arg_value = cast_aot_arg<TestObjectFoo & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick10769833213962245646_e13f1471dee7c0e7(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTicklockTick12896323001918315340_c07edc633235a15b ( Context * __context__ ) {
+    TArray<TestObjectFoo> &  arg_a = cast_aot_arg<TArray<TestObjectFoo> & >::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((void,TArray<TestObjectFoo>)) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((void,TArray<TestObjectFoo>)) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTicklockTick12896323001918315340_c07edc633235a15b(__context__, arg_a, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap_test_4319a97b3bfe6429 ( Context * __context__ ) {
+    return cast<bool>::from(test_4319a97b3bfe6429(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xbf77bb210b0552bc, false, (void*)&_FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39, &__wrap__FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 },
+    { 0xe76a2c1798a4d516, false, (void*)&_FuncbuiltinTicklockTick17406484233027870858_1719d44f11b120ad, &__wrap__FuncbuiltinTicklockTick17406484233027870858_1719d44f11b120ad },
+    { 0xefacd5d9a90b2cbb, false, (void*)&_FuncbuiltinTicklock_dataTick13321741783688336016_40f7c380468cd136, &__wrap__FuncbuiltinTicklock_dataTick13321741783688336016_40f7c380468cd136 },
+    { 0x32d299311264cc75, false, (void*)&_FuncbuiltinTicklock_dataTick16521723914664780332_d97099a5c88a19ef, &__wrap__FuncbuiltinTicklock_dataTick16521723914664780332_d97099a5c88a19ef },
+    { 0x449a9ea27ad6a49, false, (void*)&_FuncbuiltinTicklockTick12896323001918315340_ae644b3e40a0be63, &__wrap__FuncbuiltinTicklockTick12896323001918315340_ae644b3e40a0be63 },
+    { 0x103970c65b521f6e, false, (void*)&_FuncbuiltinTickpushTick10769833213962245646_e13f1471dee7c0e7, &__wrap__FuncbuiltinTickpushTick10769833213962245646_e13f1471dee7c0e7 },
+    { 0xcd4c27e303500cd8, false, (void*)&_FuncbuiltinTicklockTick12896323001918315340_c07edc633235a15b, &__wrap__FuncbuiltinTicklockTick12896323001918315340_c07edc633235a15b },
+    { 0x789aa1d84ffe4077, false, (void*)&test_4319a97b3bfe6429, &__wrap_test_4319a97b3bfe6429 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_13675243999843571892
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,176 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_16091881439911503816 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline bool test_8045a25a422099e9 ( Context * __context__ );
+inline TTable<int32_t,char *> _FuncbuiltinTickto_table_moveTick5858896087460481804_5eb44beeb4d0d356 ( Context * __context__, TDim<TTuple<16,int32_t,char *>,3> & __a_rename_at_1615_4 );
+inline TTable<int32_t,char *> _FuncbuiltinTicklock_foreverTick9199869044948175136_f0b3990574843a25 ( Context * __context__, TTable<int32_t,char *> & __Tab_rename_at_1368_7 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    TTable<int32_t,char *> _temp_make_local_3_31_0;
+    TDim<TTuple<16,int32_t,char *>,3> _temp_make_local_3_31_1;
+    das_global<TTable<int32_t,char *>,0x5564687d02aa6846>(__context__) = _FuncbuiltinTicklock_foreverTick9199869044948175136_f0b3990574843a25(__context__,das_arg<TTable<int32_t,char *>>::pass((_temp_make_local_3_31_0 = (_FuncbuiltinTickto_table_moveTick5858896087460481804_5eb44beeb4d0d356(__context__,das_arg<TDim<TTuple<16,int32_t,char *>,3>>::pass((([&]() -> TDim<TTuple<16,int32_t,char *>,3>& {
+        _temp_make_local_3_31_1(0,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+            TTuple<16,int32_t,char *> __mkt_4;
+            das_get_tuple_field<int32_t,0>::get(__mkt_4) = 0;
+            das_get_tuple_field<char *,8>::get(__mkt_4) = ((char *) "zero");
+            return __mkt_4;
+        })());
+        _temp_make_local_3_31_1(1,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+            TTuple<16,int32_t,char *> __mkt_5;
+            das_get_tuple_field<int32_t,0>::get(__mkt_5) = 1;
+            das_get_tuple_field<char *,8>::get(__mkt_5) = ((char *) "one");
+            return __mkt_5;
+        })());
+        _temp_make_local_3_31_1(2,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+            TTuple<16,int32_t,char *> __mkt_6;
+            das_get_tuple_field<int32_t,0>::get(__mkt_6) = 2;
+            das_get_tuple_field<char *,8>::get(__mkt_6) = ((char *) "two");
+            return __mkt_6;
+        })());
+        return _temp_make_local_3_31_1;
+    })())))))));/*num_2_name*/
+}
+
+inline bool test_8045a25a422099e9 ( Context * __context__ )
+{
+    char * __n0_rename_at_12_0 = ((char *)(char *)(das_null_coalescing<char * const >::get(TTable<int32_t,char *>::safe_index(&(das_global<TTable<int32_t,char *>,0x5564687d02aa6846>(__context__) /*num_2_name*/),0,__context__),((char *) "0"))));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__n0_rename_at_12_0),cast<char *>::from(((char *) "zero")),*__context__,nullptr)));
+    char * __n1_rename_at_14_1 = ((char *)(char *)(das_null_coalescing<char * const >::get(TTable<int32_t,char *>::safe_index(&(das_global<TTable<int32_t,char *>,0x5564687d02aa6846>(__context__) /*num_2_name*/),1,__context__),((char *) "1"))));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__n1_rename_at_14_1),cast<char *>::from(((char *) "one")),*__context__,nullptr)));
+    char * __n2_rename_at_16_2 = ((char *)(char *)(das_null_coalescing<char * const >::get(TTable<int32_t,char *>::safe_index(&(das_global<TTable<int32_t,char *>,0x5564687d02aa6846>(__context__) /*num_2_name*/),2,__context__),((char *) "2"))));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__n2_rename_at_16_2),cast<char *>::from(((char *) "two")),*__context__,nullptr)));
+    char * __n3_rename_at_18_3 = ((char *)(char *)(das_null_coalescing<char * const >::get(TTable<int32_t,char *>::safe_index(&(das_global<TTable<int32_t,char *>,0x5564687d02aa6846>(__context__) /*num_2_name*/),3,__context__),((char *) "3"))));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__n3_rename_at_18_3),cast<char *>::from(((char *) "3")),*__context__,nullptr)));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline TTable<int32_t,char *> _FuncbuiltinTickto_table_moveTick5858896087460481804_5eb44beeb4d0d356 ( Context * __context__, TDim<TTuple<16,int32_t,char *>,3> &  __a_rename_at_1615_4 )
+{
+    TTable<int32_t,char *> __tab_rename_at_1616_5;das_zero(__tab_rename_at_1616_5);
+    {
+        bool __need_loop_1618 = true;
+        // x: tuple<int aka keyT;string aka valT>&
+        das_iterator<TDim<TTuple<16,int32_t,char *>,3>> __x_iterator(__a_rename_at_1615_4);
+        TTuple<16,int32_t,char *> * __x_rename_at_1618_6;
+        __need_loop_1618 = __x_iterator.first(__context__,(__x_rename_at_1618_6)) && __need_loop_1618;
+        for ( ; __need_loop_1618 ; __need_loop_1618 = __x_iterator.next(__context__,(__x_rename_at_1618_6)) )
+        {
+            das_copy(__tab_rename_at_1616_5(das_get_tuple_field<int32_t,0>::get((*__x_rename_at_1618_6)),__context__),das_get_tuple_field<char *,8>::get((*__x_rename_at_1618_6)));
+        }
+        __x_iterator.close(__context__,(__x_rename_at_1618_6));
+    };
+    return /* <- */ das_auto_cast_move<TTable<int32_t,char *>>::cast(__tab_rename_at_1616_5);
+}
+
+inline TTable<int32_t,char *> _FuncbuiltinTicklock_foreverTick9199869044948175136_f0b3990574843a25 ( Context * __context__, TTable<int32_t,char *> &  __Tab_rename_at_1368_7 )
+{
+    builtin_table_lock(das_arg<TTable<int32_t,char *>>::pass(__Tab_rename_at_1368_7),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<TTable<int32_t,char *>>::cast(das_cast<TTable<int32_t,char *>>::cast(__Tab_rename_at_1368_7));
+}
+static vec4f __wrap_test_8045a25a422099e9 ( Context * __context__ ) {
+    return cast<bool>::from(test_8045a25a422099e9(__context__));
+}
+static vec4f __wrap__FuncbuiltinTickto_table_moveTick5858896087460481804_5eb44beeb4d0d356 ( Context * __context__ ) {
+    TDim<TTuple<16,int32_t,char *>,3> &  arg_a = cast_aot_arg<TDim<TTuple<16,int32_t,char *>,3> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TTable<int32_t,char *> *) __context__->abiCMRES) = _FuncbuiltinTickto_table_moveTick5858896087460481804_5eb44beeb4d0d356(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTicklock_foreverTick9199869044948175136_f0b3990574843a25 ( Context * __context__ ) {
+    TTable<int32_t,char *> &  arg_Tab = cast_aot_arg<TTable<int32_t,char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TTable<int32_t,char *> *) __context__->abiCMRES) = _FuncbuiltinTicklock_foreverTick9199869044948175136_f0b3990574843a25(__context__, arg_Tab);
+    return v_zero();
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x75f46ca911394164, false, (void*)&test_8045a25a422099e9, &__wrap_test_8045a25a422099e9 },
+    { 0x504e01bf8d698074, true, (void*)&_FuncbuiltinTickto_table_moveTick5858896087460481804_5eb44beeb4d0d356, &__wrap__FuncbuiltinTickto_table_moveTick5858896087460481804_5eb44beeb4d0d356 },
+    { 0x3a89bffb0bb3b00b, true, (void*)&_FuncbuiltinTicklock_foreverTick9199869044948175136_f0b3990574843a25, &__wrap__FuncbuiltinTicklock_foreverTick9199869044948175136_f0b3990574843a25 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x5199a79ae7dc8713, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_16091881439911503816
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
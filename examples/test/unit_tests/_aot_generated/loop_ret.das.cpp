@@ -0,0 +1,185 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require random
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_13942102186226147179 {
+
+namespace random { struct _lambda_random_112_1; };
+// unused structure _lambda_random_112_1
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickpushTick10769833213962245646_8673ce513b72723c ( Context * __context__, TArray<TTuple<16,int32_t,float3>> & __Arr_rename_at_193_0, TTuple<16,int32_t,float3> & __value_rename_at_193_1 );
+inline int32_t _FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2 ( Context * __context__, int4 & __seed_rename_at_30_2 );
+inline void foo_6a770007a6a702e7 ( Context * __context__, TArray<TTuple<16,int32_t,float3>> & __attached_fires_rename_at_11_3 );
+inline bool test_9e7655869612cdb7 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global_zero<int4,0xf15f362fa38922b9>(__context__);/*seed*/
+}
+
+inline void _FuncbuiltinTickpushTick10769833213962245646_8673ce513b72723c ( Context * __context__, TArray<TTuple<16,int32_t,float3>> &  __Arr_rename_at_193_0, TTuple<16,int32_t,float3> &  __value_rename_at_193_1 )
+{
+    das_copy(__Arr_rename_at_193_0(builtin_array_push_back(das_arg<TArray<TTuple<16,int32_t,float3>>>::pass(__Arr_rename_at_193_0),16,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_193_1);
+}
+
+inline int32_t _FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2 ( Context * __context__, int4 & __seed_rename_at_30_2 )
+{
+    das_copy(das_swizzle_ref<int32_t,int4,0>::swizzle(__seed_rename_at_30_2) /*x*/,(v_extract_xi(v_cast_vec4i(__seed_rename_at_30_2)) /*x*/ * 214013) + 2531011);
+    return das_auto_cast<int32_t>::cast((SimPolicy<int32_t>::BinShr(v_extract_xi(v_cast_vec4i(__seed_rename_at_30_2)) /*x*/,16,*__context__,nullptr)) & 32767);
+}
+
+inline void foo_6a770007a6a702e7 ( Context * __context__, TArray<TTuple<16,int32_t,float3>> &  __attached_fires_rename_at_11_3 )
+{
+    TTuple<16,int32_t,float3> _temp_make_local_18_26_0; _temp_make_local_18_26_0;
+    int32_t __t_rename_at_12_4 = ((int32_t)(SimPolicy<int32_t>::Mod(_FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2(__context__,das_global<int4,0xf15f362fa38922b9>(__context__) /*seed*/),100,*__context__,nullptr)));
+    {
+        bool __need_loop_13 = true;
+        // x: tuple<int;float3> aka Foo&
+        das_iterator<TArray<TTuple<16,int32_t,float3>>> __x_iterator(__attached_fires_rename_at_11_3);
+        TTuple<16,int32_t,float3> * __x_rename_at_13_5;
+        __need_loop_13 = __x_iterator.first(__context__,(__x_rename_at_13_5)) && __need_loop_13;
+        for ( ; __need_loop_13 ; __need_loop_13 = __x_iterator.next(__context__,(__x_rename_at_13_5)) )
+        {
+            if ( das_get_tuple_field<int32_t,0>::get((*__x_rename_at_13_5)) == __t_rename_at_12_4 )
+            {
+                return ;
+            };
+        }
+        __x_iterator.close(__context__,(__x_rename_at_13_5));
+    };
+    _FuncbuiltinTickpushTick10769833213962245646_8673ce513b72723c(__context__,das_arg<TArray<TTuple<16,int32_t,float3>>>::pass(__attached_fires_rename_at_11_3),das_arg<TTuple<16,int32_t,float3>>::pass((([&]() -> TTuple<16,int32_t,float3>& {
+        das_get_tuple_field<int32_t,0>::get(_temp_make_local_18_26_0) = __t_rename_at_12_4;
+        das_get_tuple_field<float3,4>::get(_temp_make_local_18_26_0) = v_zero();
+        return _temp_make_local_18_26_0;
+    })())));
+}
+
+inline bool test_9e7655869612cdb7 ( Context * __context__ )
+{
+    TArray<TTuple<16,int32_t,float3>> __a_rename_at_23_6;das_zero(__a_rename_at_23_6);
+    {
+        bool __need_loop_24 = true;
+        // x: int const
+        das_iterator<range> __x_iterator(range(0,1000));
+        int32_t __x_rename_at_24_7;
+        __need_loop_24 = __x_iterator.first(__context__,(__x_rename_at_24_7)) && __need_loop_24;
+        for ( ; __need_loop_24 ; __need_loop_24 = __x_iterator.next(__context__,(__x_rename_at_24_7)) )
+        {
+            foo_6a770007a6a702e7(__context__,das_arg<TArray<TTuple<16,int32_t,float3>>>::pass(__a_rename_at_23_6));
+        }
+        __x_iterator.close(__context__,(__x_rename_at_24_7));
+    };
+    DAS_ASSERT((builtin_array_size(das_arg<TArray<TTuple<16,int32_t,float3>>>::pass(__a_rename_at_23_6)) == 100));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncbuiltinTickpushTick10769833213962245646_8673ce513b72723c ( Context * __context__ ) {
+    TArray<TTuple<16,int32_t,float3>> &  arg_Arr = cast_aot_arg<TArray<TTuple<16,int32_t,float3>> & >::to(*__context__,__context__->abiArguments()[0]);
+    TTuple<16,int32_t,float3> &  arg_value = cast_aot_arg<TTuple<16,int32_t,float3> & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick10769833213962245646_8673ce513b72723c(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2 ( Context * __context__ ) {
+    int4 & arg_seed = cast_aot_arg<int4 &>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(_FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2(__context__, arg_seed));
+}
+static vec4f __wrap_foo_6a770007a6a702e7 ( Context * __context__ ) {
+    TArray<TTuple<16,int32_t,float3>> &  arg_attached_fires = cast_aot_arg<TArray<TTuple<16,int32_t,float3>> & >::to(*__context__,__context__->abiArguments()[0]);
+    foo_6a770007a6a702e7(__context__, arg_attached_fires);
+    return v_zero();
+}
+static vec4f __wrap_test_9e7655869612cdb7 ( Context * __context__ ) {
+    return cast<bool>::from(test_9e7655869612cdb7(__context__));
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x7edf490910ef2983, false, (void*)&_FuncbuiltinTickpushTick10769833213962245646_8673ce513b72723c, &__wrap__FuncbuiltinTickpushTick10769833213962245646_8673ce513b72723c },
+    { 0xadb43fc11a384c17, false, (void*)&_FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2, &__wrap__FuncrandomTickrandom_intTick14311393484250307648_2a21e646943d41a2 },
+    { 0x2d47d4fcd88868d9, false, (void*)&foo_6a770007a6a702e7, &__wrap_foo_6a770007a6a702e7 },
+    { 0xaabf06f7d1036685, false, (void*)&test_9e7655869612cdb7, &__wrap_test_9e7655869612cdb7 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x63a64f9408255276, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_13942102186226147179
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,193 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_4931113870243191395 {
+
+namespace  { struct DefStruct; };
+namespace  {
+
+enum class DefEnum : int32_t {
+    foo = int32_t(0),
+    bar = int32_t(1),
+};
+}
+namespace  {
+
+struct DefStruct {
+    int32_t x;
+    float y;
+};
+static_assert(sizeof(DefStruct)==8,"structure size mismatch with DAS");
+static_assert(offsetof(DefStruct,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(DefStruct,y)==4,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_6bc215a1adb0d312 ( Context * __context__, TArray<DefStruct> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline TArray<DefStruct> _FuncbuiltinTickto_array_moveTick3185538323411982277_1a37cb09096f8200 ( Context * __context__, TDim<DefStruct,2> & __a_rename_at_1502_2 );
+inline bool test_ee7190fc6c69f2ac ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_6bc215a1adb0d312 ( Context * __context__, TArray<DefStruct> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<DefStruct>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline TArray<DefStruct> _FuncbuiltinTickto_array_moveTick3185538323411982277_1a37cb09096f8200 ( Context * __context__, TDim<DefStruct,2> &  __a_rename_at_1502_2 )
+{
+    TArray<DefStruct> __arr_rename_at_1504_3;das_zero(__arr_rename_at_1504_3);
+    _FuncbuiltinTickresizeTick4811697762258667383_6bc215a1adb0d312(__context__,das_arg<TArray<DefStruct>>::pass(__arr_rename_at_1504_3),2);
+    das_copy(das_cast<TDim<DefStruct,2>>::cast(das_ref(__context__,__arr_rename_at_1504_3(0,__context__))),__a_rename_at_1502_2);
+    return /* <- */ das_auto_cast_move<TArray<DefStruct>>::cast(__arr_rename_at_1504_3);
+}
+
+inline bool test_ee7190fc6c69f2ac ( Context * __context__ )
+{
+    TDim<DefStruct,2> _temp_make_local_28_25_0; _temp_make_local_28_25_0;
+    TTuple<8,int32_t,float> __t_tuple_rename_at_18_4_ConstRef = ((TTuple<8,int32_t,float>)(([&]() -> TTuple<8,int32_t,float> {
+        TTuple<8,int32_t,float> __mks_18;
+        das_zero(__mks_18);
+        return __mks_18;
+    })()));
+    TTuple<8,int32_t,float> const  & __t_tuple_rename_at_18_4 = __t_tuple_rename_at_18_4_ConstRef;
+;
+    DAS_ASSERT(((das_get_tuple_field<int32_t,0>::get(__t_tuple_rename_at_18_4) == 0) && (das_get_tuple_field<float,4>::get(__t_tuple_rename_at_18_4) == 0.000000e+00f)));
+    TVariant<8,4,int32_t,float> __t_variant_rename_at_20_5_ConstRef = ((TVariant<8,4,int32_t,float>)(([&]() -> TVariant<8,4,int32_t,float> {
+        TVariant<8,4,int32_t,float> __mkv_20;
+        das_zero(__mkv_20);
+        return __mkv_20;
+    })()));
+    TVariant<8,4,int32_t,float> const  & __t_variant_rename_at_20_5 = __t_variant_rename_at_20_5_ConstRef;
+;
+    DAS_ASSERT((das_get_variant_field<int32_t,4,0>::is(__t_variant_rename_at_20_5) && (das_get_variant_field<int32_t,4,0>::as(__t_variant_rename_at_20_5,__context__) == 0)));
+    DefStruct __t_struct_rename_at_22_6_ConstRef = ((DefStruct)(([&]() -> DefStruct {
+        DefStruct __mks_22;
+        das_zero(__mks_22);
+        return __mks_22;
+    })()));
+    DefStruct const  & __t_struct_rename_at_22_6 = __t_struct_rename_at_22_6_ConstRef;
+;
+    DAS_ASSERT(((__t_struct_rename_at_22_6.x == 0) && (__t_struct_rename_at_22_6.y == 0.000000e+00f)));
+    TArray<int32_t> __t_array_rename_at_26_7_ConstRef; das_zero(__t_array_rename_at_26_7_ConstRef); das_move(__t_array_rename_at_26_7_ConstRef, ((TArray<int32_t>)(([&]() -> TArray<int32_t> {
+        TArray<int32_t> __mks_26;
+        das_zero(__mks_26);
+        return __mks_26;
+    })())));
+    TArray<int32_t> const  & __t_array_rename_at_26_7 = __t_array_rename_at_26_7_ConstRef;
+;
+    DAS_ASSERT((builtin_array_size(__t_array_rename_at_26_7) == 0));
+    TArray<DefStruct> __t_array_struct_rename_at_28_8_ConstRef; das_zero(__t_array_struct_rename_at_28_8_ConstRef); das_move(__t_array_struct_rename_at_28_8_ConstRef, ((TArray<DefStruct>)_FuncbuiltinTickto_array_moveTick3185538323411982277_1a37cb09096f8200(__context__,das_arg<TDim<DefStruct,2>>::pass((([&]() -> TDim<DefStruct,2>& {
+        das_zero(_temp_make_local_28_25_0);
+        das_copy((_temp_make_local_28_25_0(0,__context__).x),(1));
+        das_copy((_temp_make_local_28_25_0(1,__context__).x),(2));
+        return _temp_make_local_28_25_0;
+    })())))));
+    TArray<DefStruct> const  & __t_array_struct_rename_at_28_8 = __t_array_struct_rename_at_28_8_ConstRef;
+;
+    DAS_ASSERT((builtin_array_size(__t_array_struct_rename_at_28_8) == 2));
+    DAS_ASSERT((__t_array_struct_rename_at_28_8(0,__context__).x == 1));
+    DAS_ASSERT((__t_array_struct_rename_at_28_8(1,__context__).x == 2));
+    DAS_ASSERT((__t_array_struct_rename_at_28_8(0,__context__).y == 0.000000e+00f));
+    DAS_ASSERT((__t_array_struct_rename_at_28_8(1,__context__).y == 0.000000e+00f));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_6bc215a1adb0d312 ( Context * __context__ ) {
+    TArray<DefStruct> &  arg_Arr = cast_aot_arg<TArray<DefStruct> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_6bc215a1adb0d312(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1a37cb09096f8200 ( Context * __context__ ) {
+    TDim<DefStruct,2> &  arg_a = cast_aot_arg<TDim<DefStruct,2> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<DefStruct> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_1a37cb09096f8200(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap_test_ee7190fc6c69f2ac ( Context * __context__ ) {
+    return cast<bool>::from(test_ee7190fc6c69f2ac(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x917d575c9c69eee8, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_6bc215a1adb0d312, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_6bc215a1adb0d312 },
+    { 0xf1bca0e120f7440, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_1a37cb09096f8200, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1a37cb09096f8200 },
+    { 0x5a3948926a7ce5e4, false, (void*)&test_ee7190fc6c69f2ac, &__wrap_test_ee7190fc6c69f2ac },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_4931113870243191395
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,195 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_7042563708794144596 {
+
+namespace  { struct OverFoo; };
+// unused enumeration GooEnum
+// unused enumeration OpCode
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+namespace  {
+
+struct OverFoo {
+    int32_t a;
+    TestObjectFoo foo;
+};
+static_assert(sizeof(OverFoo)==64,"structure size mismatch with DAS");
+static_assert(offsetof(OverFoo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(OverFoo,foo)==8,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline TestObjectFoo cmresTest_87db76d41e13c98b ( Context * __context__, int32_t __a_rename_at_4_0 );
+inline bool test_dc91b70086dc01cd ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global<TestObjectFoo,0xbb6e565c378f6c66>(__context__) = (([&]() -> TestObjectFoo {
+        TestObjectFoo __mks_12;
+        das_zero(__mks_12);
+        das_copy((__mks_12.fooData /*fooData*/),(6));
+        return __mks_12;
+    })());/*gstackref*/
+    das_global<TDim<TestObjectFoo,2>,0x691af51d2f37bf00>(__context__) = (([&]() -> TDim<TestObjectFoo,2> {
+        TDim<TestObjectFoo,2> __mks_13;
+        das_zero(__mks_13);
+        das_copy((__mks_13(0,__context__).fooData /*fooData*/),(1));
+        das_copy((__mks_13(1,__context__).fooData /*fooData*/),(2));
+        return __mks_13;
+    })());/*gstackrefa*/
+}
+
+inline TestObjectFoo cmresTest_87db76d41e13c98b ( Context * __context__, int32_t __a_rename_at_4_0 )
+{
+    return das_auto_cast_ref<TestObjectFoo>::cast((([&]() -> TestObjectFoo {
+        TestObjectFoo __mks_5;
+        das_zero(__mks_5);
+        das_copy((__mks_5.fooData /*fooData*/),(__a_rename_at_4_0));
+        return __mks_5;
+    })()));
+}
+
+inline bool test_dc91b70086dc01cd ( Context * __context__ )
+{
+    DAS_ASSERT((das_global<TestObjectFoo,0xbb6e565c378f6c66>(__context__) /*gstackref*/.fooData /*fooData*/ == 6));
+    DAS_ASSERT(((das_global<TDim<TestObjectFoo,2>,0x691af51d2f37bf00>(__context__) /*gstackrefa*/(0,__context__).fooData /*fooData*/ == 1) && (das_global<TDim<TestObjectFoo,2>,0x691af51d2f37bf00>(__context__) /*gstackrefa*/(1,__context__).fooData /*fooData*/ == 2)));
+    TestObjectFoo __local_t_rename_at_21_1_ConstRef = ((TestObjectFoo)(([&]() -> TestObjectFoo {
+        TestObjectFoo __mks_21;
+        das_zero(__mks_21);
+        das_copy((__mks_21.fooData /*fooData*/),(5));
+        return __mks_21;
+    })()));
+    TestObjectFoo const  & __local_t_rename_at_21_1 = __local_t_rename_at_21_1_ConstRef;
+;
+    DAS_ASSERT((__local_t_rename_at_21_1.fooData /*fooData*/ == 5));
+    TestObjectFoo __cmres_t_rename_at_24_2 = cmresTest_87db76d41e13c98b(__context__,13);
+    DAS_ASSERT((__cmres_t_rename_at_24_2.fooData /*fooData*/ == 13));
+    TDim<OverFoo,2> __mixed_rename_at_27_3 = (([&]() -> TDim<OverFoo,2> {
+        TDim<OverFoo,2> __mks_27;
+        das_zero(__mks_27);
+        das_copy((__mks_27(0,__context__).a),(1));
+        das_copy((__mks_27(0,__context__).foo),((([&]() -> TestObjectFoo {
+            TestObjectFoo __mks_27;
+            das_zero(__mks_27);
+            das_copy((__mks_27.fooData /*fooData*/),(1));
+            return __mks_27;
+        })())));
+        das_copy((__mks_27(1,__context__).a),(2));
+        das_copy((__mks_27(1,__context__).foo),((([&]() -> TestObjectFoo {
+            TestObjectFoo __mks_27;
+            das_zero(__mks_27);
+            das_copy((__mks_27.fooData /*fooData*/),(2));
+            return __mks_27;
+        })())));
+        return __mks_27;
+    })());
+    DAS_ASSERT(((__mixed_rename_at_27_3(0,__context__).foo.fooData /*fooData*/ == 1) && (__mixed_rename_at_27_3(1,__context__).foo.fooData /*fooData*/ == 2)));
+    TestObjectFoo * __ascend_t_rename_at_30_4; das_zero(__ascend_t_rename_at_30_4); das_move(__ascend_t_rename_at_30_4, das_ascend_handle<false,TestObjectFoo *>::make(__context__,nullptr,(([&](TestObjectFoo & __mks_30) {
+        das_copy((__mks_30.fooData /*fooData*/),(1));
+    }))));
+    DAS_ASSERT((__ascend_t_rename_at_30_4->fooData /*fooData*/ == 1));
+    das_delete_handle<TestObjectFoo *>::clear(__context__,__ascend_t_rename_at_30_4);
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_cmresTest_87db76d41e13c98b ( Context * __context__ ) {
+    int32_t arg_a = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    *((TestObjectFoo *) __context__->abiCMRES) = cmresTest_87db76d41e13c98b(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap_test_dc91b70086dc01cd ( Context * __context__ ) {
+    return cast<bool>::from(test_dc91b70086dc01cd(__context__));
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xde7af67ed775c91b, true, (void*)&cmresTest_87db76d41e13c98b, &__wrap_cmresTest_87db76d41e13c98b },
+    { 0xe73892faf1041e88, false, (void*)&test_dc91b70086dc01cd, &__wrap_test_dc91b70086dc01cd },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0xf7082fa44c7fdbbc, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_7042563708794144596
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
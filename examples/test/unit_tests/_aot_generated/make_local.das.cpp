@@ -0,0 +1,285 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_11266951393638234565 {
+
+namespace  { struct Bar; };
+namespace  { struct Foo; };
+namespace  {
+
+struct Bar {
+    int32_t x;
+    int32_t y;
+    int32_t z;
+    int32_t w;
+};
+static_assert(sizeof(Bar)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Bar,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Bar,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Bar,z)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Bar,w)==12,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Foo {
+    int32_t i;
+    float f;
+    char * s;
+};
+static_assert(sizeof(Foo)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,i)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,f)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,s)==8,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_4de20d7d2dd2b3a4 ( Context * __context__, TArray<Foo> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline TArray<Foo> _FuncbuiltinTickto_array_moveTick3185538323411982277_5a193d95b7015f2e ( Context * __context__, TDim<Foo,3> & __a_rename_at_1502_2 );
+inline bool test_3d436a40b7465c6c ( Context * __context__ );
+inline Bar Bar_42bca026c170e9ab ( Context * __context__ );
+inline Foo Foo_74d840a2dd4eb378 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global<Foo,0x661593eea299d861>(__context__) = (([&]() -> Foo {
+        Foo __mks_30 = Foo_74d840a2dd4eb378(__context__);
+        return __mks_30;
+    })());/*testFoo*/
+    das_global<Foo,0x10649e229de9b81f>(__context__) = (([&]() -> Foo {
+        Foo __mks_34 = Foo_74d840a2dd4eb378(__context__);
+        das_copy((__mks_34.i),(3));
+        das_copy((__mks_34.f),(4.000000e+00f));
+        das_copy((__mks_34.s),(((char *) "blah")));
+        return __mks_34;
+    })());/*jestFoo*/
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_4de20d7d2dd2b3a4 ( Context * __context__, TArray<Foo> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<Foo>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,16,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline TArray<Foo> _FuncbuiltinTickto_array_moveTick3185538323411982277_5a193d95b7015f2e ( Context * __context__, TDim<Foo,3> &  __a_rename_at_1502_2 )
+{
+    TArray<Foo> __arr_rename_at_1504_3;das_zero(__arr_rename_at_1504_3);
+    _FuncbuiltinTickresizeTick4811697762258667383_4de20d7d2dd2b3a4(__context__,das_arg<TArray<Foo>>::pass(__arr_rename_at_1504_3),3);
+    das_copy(das_cast<TDim<Foo,3>>::cast(das_ref(__context__,__arr_rename_at_1504_3(0,__context__))),__a_rename_at_1502_2);
+    return /* <- */ das_auto_cast_move<TArray<Foo>>::cast(__arr_rename_at_1504_3);
+}
+
+inline bool test_3d436a40b7465c6c ( Context * __context__ )
+{
+    TDim<Foo,3> _temp_make_local_50_14_0; _temp_make_local_50_14_0;
+    DAS_ASSERT((((das_global<Foo,0x661593eea299d861>(__context__) /*testFoo*/.i == 5) && (das_global<Foo,0x661593eea299d861>(__context__) /*testFoo*/.f == 6.000000e+00f)) && (SimPolicy<char *>::Equ(cast<char *>::from(das_global<Foo,0x661593eea299d861>(__context__) /*testFoo*/.s),cast<char *>::from(((char *) "hello")),*__context__,nullptr))));
+    DAS_ASSERT((((das_global<Foo,0x10649e229de9b81f>(__context__) /*jestFoo*/.i == 3) && (das_global<Foo,0x10649e229de9b81f>(__context__) /*jestFoo*/.f == 4.000000e+00f)) && (SimPolicy<char *>::Equ(cast<char *>::from(das_global<Foo,0x10649e229de9b81f>(__context__) /*jestFoo*/.s),cast<char *>::from(((char *) "blah")),*__context__,nullptr))));
+    Foo __t_rename_at_42_4_ConstRef = ((Foo)(([&]() -> Foo {
+        Foo __mks_42 = Foo_74d840a2dd4eb378(__context__);
+        return __mks_42;
+    })()));
+    Foo const  & __t_rename_at_42_4 = __t_rename_at_42_4_ConstRef;
+;
+    DAS_ASSERT((__t_rename_at_42_4.i == 5));
+    DAS_ASSERT((__t_rename_at_42_4.f == 6.000000e+00f));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__t_rename_at_42_4.s),cast<char *>::from(((char *) "hello")),*__context__,nullptr)));
+    Foo __q_rename_at_46_5_ConstRef = ((Foo)(([&]() -> Foo {
+        Foo __mks_46;
+        das_zero(__mks_46);
+        das_copy((__mks_46.i),(6));
+        das_copy((__mks_46.s),(((char *) "world")));
+        return __mks_46;
+    })()));
+    Foo const  & __q_rename_at_46_5 = __q_rename_at_46_5_ConstRef;
+;
+    DAS_ASSERT((__q_rename_at_46_5.i == 6));
+    DAS_ASSERT((__q_rename_at_46_5.f == 0.000000e+00f));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__q_rename_at_46_5.s),cast<char *>::from(((char *) "world")),*__context__,nullptr)));
+    TArray<Foo> __qq3_rename_at_50_6_ConstRef; das_zero(__qq3_rename_at_50_6_ConstRef); das_move(__qq3_rename_at_50_6_ConstRef, ((TArray<Foo>)_FuncbuiltinTickto_array_moveTick3185538323411982277_5a193d95b7015f2e(__context__,das_arg<TDim<Foo,3>>::pass((([&]() -> TDim<Foo,3>& {
+        das_zero(_temp_make_local_50_14_0);
+        _temp_make_local_50_14_0(0,__context__) = (([&]() -> Foo {
+            Foo __mks_50;
+            das_zero(__mks_50);
+            das_copy((__mks_50.i),(1));
+            return __mks_50;
+        })());
+        _temp_make_local_50_14_0(1,__context__) = (([&]() -> Foo {
+            Foo __mks_50;
+            das_zero(__mks_50);
+            das_copy((__mks_50.i),(2));
+            return __mks_50;
+        })());
+        _temp_make_local_50_14_0(2,__context__) = (([&]() -> Foo {
+            Foo __mks_50;
+            das_zero(__mks_50);
+            das_copy((__mks_50.i),(3));
+            return __mks_50;
+        })());
+        return _temp_make_local_50_14_0;
+    })())))));
+    TArray<Foo> const  & __qq3_rename_at_50_6 = __qq3_rename_at_50_6_ConstRef;
+;
+    DAS_ASSERT((((__qq3_rename_at_50_6(0,__context__).i == 1) && (__qq3_rename_at_50_6(1,__context__).i == 2)) && (__qq3_rename_at_50_6(2,__context__).i == 3)));
+    TDim<int32_t,4> __ar_rename_at_52_7_ConstRef = ((TDim<int32_t,4>)(([&]() -> TDim<int32_t,4> {
+        TDim<int32_t,4> __mka_52;
+        __mka_52(0,__context__) = 1;
+        __mka_52(1,__context__) = 2;
+        __mka_52(2,__context__) = 3;
+        __mka_52(3,__context__) = 4;
+        return __mka_52;
+    })()));
+    TDim<int32_t,4> const  & __ar_rename_at_52_7 = __ar_rename_at_52_7_ConstRef;
+;
+    DAS_ASSERT(((((__ar_rename_at_52_7(0,__context__) == 1) && (__ar_rename_at_52_7(1,__context__) == 2)) && (__ar_rename_at_52_7(2,__context__) == 3)) && (__ar_rename_at_52_7(3,__context__) == 4)));
+    TDim<Foo,2> __arf_rename_at_54_8_ConstRef = ((TDim<Foo,2>)(([&]() -> TDim<Foo,2> {
+        TDim<Foo,2> __mka_54;
+        das_zero(__mka_54);
+        __mka_54(0,__context__) = (([&]() -> Foo {
+            Foo __mks_54 = Foo_74d840a2dd4eb378(__context__);
+            return __mks_54;
+        })());
+        __mka_54(1,__context__) = (([&]() -> Foo {
+            Foo __mks_54 = Foo_74d840a2dd4eb378(__context__);
+            return __mks_54;
+        })());
+        return __mka_54;
+    })()));
+    TDim<Foo,2> const  & __arf_rename_at_54_8 = __arf_rename_at_54_8_ConstRef;
+;
+    DAS_ASSERT(((__arf_rename_at_54_8(0,__context__).i == 5) && (__arf_rename_at_54_8(1,__context__).i == 5)));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline Bar Bar_42bca026c170e9ab ( Context * __context__ )
+{
+    return /* <- */ das_auto_cast_move<Bar>::cast((([&]() -> Bar {
+        Bar __mks_5;
+        das_copy((__mks_5.x),(1));
+        das_copy((__mks_5.y),(2));
+        das_copy((__mks_5.z),(3));
+        das_copy((__mks_5.w),(4));
+        return __mks_5;
+    })()));
+}
+
+inline Foo Foo_74d840a2dd4eb378 ( Context * __context__ )
+{
+    return /* <- */ das_auto_cast_move<Foo>::cast((([&]() -> Foo {
+        Foo __mks_23;
+        das_copy((__mks_23.i),(5));
+        das_copy((__mks_23.f),(6.000000e+00f));
+        das_copy((__mks_23.s),(((char *) "hello")));
+        return __mks_23;
+    })()));
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_4de20d7d2dd2b3a4 ( Context * __context__ ) {
+    TArray<Foo> &  arg_Arr = cast_aot_arg<TArray<Foo> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_4de20d7d2dd2b3a4(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_5a193d95b7015f2e ( Context * __context__ ) {
+    TDim<Foo,3> &  arg_a = cast_aot_arg<TDim<Foo,3> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<Foo> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_5a193d95b7015f2e(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap_test_3d436a40b7465c6c ( Context * __context__ ) {
+    return cast<bool>::from(test_3d436a40b7465c6c(__context__));
+}
+static vec4f __wrap_Bar_42bca026c170e9ab ( Context * __context__ ) {
+    *((Bar *) __context__->abiCMRES) = Bar_42bca026c170e9ab(__context__);
+    return v_zero();
+}
+static vec4f __wrap_Foo_74d840a2dd4eb378 ( Context * __context__ ) {
+    *((Foo *) __context__->abiCMRES) = Foo_74d840a2dd4eb378(__context__);
+    return v_zero();
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x4f308838bcb52939, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_4de20d7d2dd2b3a4, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_4de20d7d2dd2b3a4 },
+    { 0x444392be1ea1463f, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_5a193d95b7015f2e, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_5a193d95b7015f2e },
+    { 0x21bf442cc7d4d124, false, (void*)&test_3d436a40b7465c6c, &__wrap_test_3d436a40b7465c6c },
+    { 0x4eeded02211942de, true, (void*)&Bar_42bca026c170e9ab, &__wrap_Bar_42bca026c170e9ab },
+    { 0x90eafc4fdc869d57, true, (void*)&Foo_74d840a2dd4eb378, &__wrap_Foo_74d840a2dd4eb378 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0xb3f0c16c4f07f191, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_11266951393638234565
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,329 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_1304661605865079465 {
+
+namespace  { struct Foo; };
+// unused enumeration ConversionResult
+namespace  {
+
+struct Foo {
+    TArray<int32_t> a;
+    char * b;
+};
+static_assert(sizeof(Foo)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==24,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__411ed0e77075265a;
+extern TypeInfo __type_info__ef1197b3cfb2a68;
+extern TypeInfo __type_info__fa593d0882a72913;
+extern TypeInfo __type_info__af8afe4c86446b52;
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__37d36026a6078a42;
+extern TypeInfo __type_info__68a96d839d45c546;
+extern TypeInfo __type_info__af63e44c8601fa24;
+
+VarInfo __struct_info__411ed0e77075265a_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xbcd691bb60c7d14c), "a", 0, 1 };
+VarInfo __struct_info__411ed0e77075265a_field_1 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0xbcd694bb60c7d665), "b", 24, 2 };
+VarInfo * __struct_info__411ed0e77075265a_fields[2] =  { &__struct_info__411ed0e77075265a_field_0, &__struct_info__411ed0e77075265a_field_1 };
+StructInfo __struct_info__411ed0e77075265a = {"Foo", "", 28, __struct_info__411ed0e77075265a_fields, 2, 32, UINT64_C(0x0), nullptr, UINT64_C(0x411ed0e77075265a), 0 };
+TypeInfo __type_info__ef1197b3cfb2a68 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__68a96d839d45c546, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 24, UINT64_C(0xef1197b3cfb2a68) };
+TypeInfo __type_info__fa593d0882a72913 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16548, 8, UINT64_C(0xfa593d0882a72913) };
+TypeInfo __type_info__af8afe4c86446b52 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf8afe4c86446b52) };
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__37d36026a6078a42 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 288, UINT64_C(0x37d36026a6078a42) };
+TypeInfo __type_info__68a96d839d45c546 = { Type::tStructure, &__struct_info__411ed0e77075265a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 32, UINT64_C(0x68a96d839d45c546) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {__type_info__37d36026a6078a42, };
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__ef1197b3cfb2a68, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_1[2] = { &__type_info__37d36026a6078a42, &__type_info__fa593d0882a72913 };
+TypeInfo * __tinfo_2[2] = { &__type_info__37d36026a6078a42, &__type_info__af8afe4c86446b52 };
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_90534f21feb0fff2 ( Context * __context__, TArray<Foo> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_68_2, int32_t __newSize_rename_at_68_3 );
+inline void _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__, TArray<int32_t> & __a_rename_at_1142_4, TArray<int32_t> const  & __b_rename_at_1142_5 );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18 ( Context * __context__, TDim<int32_t,4> & __a_rename_at_1502_7 );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b ( Context * __context__, TDim<int32_t,3> & __a_rename_at_1502_9 );
+inline TArray<Foo> _FuncbuiltinTickto_array_moveTick3185538323411982277_87ea6c7f1349f9a2 ( Context * __context__, TDim<Foo,2> & __a_rename_at_1502_11 );
+inline char * _Funcstrings_boostTickjoinTick16475640899284277631_95627e90b433199b ( Context * __context__, TArray<int32_t> const  & __it_rename_at_23_13, char * const  __separator_rename_at_23_14 );
+inline bool test_d069ee2c80680fa5 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_90534f21feb0fff2 ( Context * __context__, TArray<Foo> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<TArray<Foo> &>::from(__Arr_rename_at_68_0),cast<char * const >::from(((char *) "array can't be resized because it contains locked elements"))));
+    builtin_array_resize(das_arg<TArray<Foo>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,32,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_68_2, int32_t __newSize_rename_at_68_3 )
+{
+    builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_68_2),__newSize_rename_at_68_3,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__, TArray<int32_t> &  __a_rename_at_1142_4, TArray<int32_t> const  &  __b_rename_at_1142_5 )
+{
+    int32_t __ln_rename_at_1143_6 = ((int32_t)builtin_array_size(__b_rename_at_1142_5));
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_1142_4),__ln_rename_at_1143_6);
+    if ( __ln_rename_at_1143_6 == 0 )
+    {
+        return ;
+    } else {
+        das_memcpy(das_auto_cast<void * const >::cast(das_ref(__context__,__a_rename_at_1142_4(0,__context__))),das_auto_cast<void * const >::cast(das_ref(__context__,__b_rename_at_1142_5(0,__context__))),__ln_rename_at_1143_6 * 4);
+    };
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18 ( Context * __context__, TDim<int32_t,4> &  __a_rename_at_1502_7 )
+{
+    TArray<int32_t> __arr_rename_at_1504_8;das_zero(__arr_rename_at_1504_8);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_8),4);
+    das_copy(das_cast<TDim<int32_t,4>>::cast(das_ref(__context__,__arr_rename_at_1504_8(0,__context__))),__a_rename_at_1502_7);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_8);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b ( Context * __context__, TDim<int32_t,3> &  __a_rename_at_1502_9 )
+{
+    TArray<int32_t> __arr_rename_at_1504_10;das_zero(__arr_rename_at_1504_10);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_10),3);
+    das_copy(das_cast<TDim<int32_t,3>>::cast(das_ref(__context__,__arr_rename_at_1504_10(0,__context__))),__a_rename_at_1502_9);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_10);
+}
+
+inline TArray<Foo> _FuncbuiltinTickto_array_moveTick3185538323411982277_87ea6c7f1349f9a2 ( Context * __context__, TDim<Foo,2> &  __a_rename_at_1502_11 )
+{
+    TArray<Foo> __arr_rename_at_1504_12;das_zero(__arr_rename_at_1504_12);
+    _FuncbuiltinTickresizeTick4811697762258667383_90534f21feb0fff2(__context__,das_arg<TArray<Foo>>::pass(__arr_rename_at_1504_12),2);
+    das_move(das_cast<TDim<Foo,2>>::cast(das_ref(__context__,__arr_rename_at_1504_12(0,__context__))),__a_rename_at_1502_11);
+    return /* <- */ das_auto_cast_move<TArray<Foo>>::cast(__arr_rename_at_1504_12);
+}
+
+inline char * _Funcstrings_boostTickjoinTick16475640899284277631_95627e90b433199b ( Context * __context__, TArray<int32_t> const  &  __it_rename_at_23_13, char * const  __separator_rename_at_23_14 )
+{
+    char * __st_rename_at_29_15 = ((char *)(char *)(((char * const )(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_29_16) DAS_AOT_INLINE_LAMBDA -> void{
+        bool __skip_first_rename_at_30_17 = true;
+        {
+            bool __need_loop_31 = true;
+            // elem: int const&
+            das_iterator<TArray<int32_t> const > __elem_iterator(__it_rename_at_23_13);
+            int32_t const  * __elem_rename_at_31_18;
+            __need_loop_31 = __elem_iterator.first(__context__,(__elem_rename_at_31_18)) && __need_loop_31;
+            for ( ; __need_loop_31 ; __need_loop_31 = __elem_iterator.next(__context__,(__elem_rename_at_31_18)) )
+            {
+                if ( __skip_first_rename_at_30_17 )
+                {
+                    das_copy(__skip_first_rename_at_30_17,false);
+                } else {
+                    das_call_interop<StringBuilderWriter &>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<StringBuilderWriter &>::from(__writer_rename_at_29_16),cast<char * const >::from(__separator_rename_at_23_14)));
+                };
+                das_call_interop<StringBuilderWriter &>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_2,cast<StringBuilderWriter &>::from(__writer_rename_at_29_16),cast<int32_t>::from((*__elem_rename_at_31_18))));
+            }
+            __elem_iterator.close(__context__,(__elem_rename_at_31_18));
+        };
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+    return das_auto_cast<char *>::cast(__st_rename_at_29_15);
+}
+
+inline bool test_d069ee2c80680fa5 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,288,"test " DAS_FILE_LINE);
+{
+    TDim<int32_t,4> _temp_make_local_11_14_0; _temp_make_local_11_14_0;
+    TDim<int32_t,3> _temp_make_local_12_14_1; _temp_make_local_12_14_1;
+    TDim<Foo,2> _temp_make_local_14_15_2; _temp_make_local_14_15_2;
+    TArray<int32_t> __sa_rename_at_11_19_ConstRef; das_zero(__sa_rename_at_11_19_ConstRef); das_move(__sa_rename_at_11_19_ConstRef, ((TArray<int32_t>)_FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+        _temp_make_local_11_14_0(0,__context__) = 1;
+        _temp_make_local_11_14_0(1,__context__) = 2;
+        _temp_make_local_11_14_0(2,__context__) = 3;
+        _temp_make_local_11_14_0(3,__context__) = 4;
+        return _temp_make_local_11_14_0;
+    })())))));
+    TArray<int32_t> const  & __sa_rename_at_11_19 = __sa_rename_at_11_19_ConstRef;
+;
+    TArray<int32_t> __sb_rename_at_12_20_ConstRef; das_zero(__sb_rename_at_12_20_ConstRef); das_move(__sb_rename_at_12_20_ConstRef, ((TArray<int32_t>)_FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b(__context__,das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+        _temp_make_local_12_14_1(0,__context__) = 1;
+        _temp_make_local_12_14_1(1,__context__) = 2;
+        _temp_make_local_12_14_1(2,__context__) = 3;
+        return _temp_make_local_12_14_1;
+    })())))));
+    TArray<int32_t> const  & __sb_rename_at_12_20 = __sb_rename_at_12_20_ConstRef;
+;
+    Foo __fa_rename_at_13_21_ConstRef; das_zero(__fa_rename_at_13_21_ConstRef); das_move(__fa_rename_at_13_21_ConstRef, ((Foo)(([&]() -> Foo {
+        Foo __mks_13;
+        das_zero(__mks_13);
+        {
+            _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62(__context__,das_arg<TArray<int32_t>>::pass(__mks_13.a),__sa_rename_at_11_19);
+        }        return __mks_13;
+    })())));
+    Foo const  & __fa_rename_at_13_21 = __fa_rename_at_13_21_ConstRef;
+;
+    TArray<Foo> __fa2_rename_at_14_23_ConstRef; das_zero(__fa2_rename_at_14_23_ConstRef); das_move(__fa2_rename_at_14_23_ConstRef, ((TArray<Foo>)_FuncbuiltinTickto_array_moveTick3185538323411982277_87ea6c7f1349f9a2(__context__,das_arg<TDim<Foo,2>>::pass((([&]() -> TDim<Foo,2>& {
+        das_zero(_temp_make_local_14_15_2);
+        _temp_make_local_14_15_2(0,__context__) = (([&]() -> Foo {
+            Foo __mks_14;
+            das_zero(__mks_14);
+            {
+                _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62(__context__,das_arg<TArray<int32_t>>::pass(__mks_14.a),__sa_rename_at_11_19);
+            }            return __mks_14;
+        })());
+        _temp_make_local_14_15_2(1,__context__) = (([&]() -> Foo {
+            Foo __mks_14;
+            das_zero(__mks_14);
+            {
+                _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62(__context__,das_arg<TArray<int32_t>>::pass(__mks_14.a),__sb_rename_at_12_20);
+            }            return __mks_14;
+        })());
+        return _temp_make_local_14_15_2;
+    })())))));
+    TArray<Foo> const  & __fa2_rename_at_14_23 = __fa2_rename_at_14_23_ConstRef;
+;
+    DAS_ASSERT((builtin_array_size(__sa_rename_at_11_19) == 4));
+    DAS_ASSERT((builtin_array_size(__fa_rename_at_13_21.a) == 4));
+    DAS_ASSERT((builtin_array_size(__fa2_rename_at_14_23(0,__context__).a) == 4));
+    DAS_ASSERT((builtin_array_size(__fa2_rename_at_14_23(1,__context__).a) == 3));
+    Foo __faw_rename_at_19_26; das_zero(__faw_rename_at_19_26); das_move(__faw_rename_at_19_26, (([&]() -> Foo {
+        Foo __mks_19;
+        das_zero(__mks_19);
+        das_copy((__mks_19.b),(((char *) "a is ")));
+        {
+            _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62(__context__,das_arg<TArray<int32_t>>::pass(__mks_19.a),__sa_rename_at_11_19);
+        }        return __mks_19;
+    })()));
+    SimPolicy<char *>::SetAdd((char *)&(__faw_rename_at_19_26.b),cast<char *>::from(_Funcstrings_boostTickjoinTick16475640899284277631_95627e90b433199b(__context__,das_arg<TArray<int32_t>>::pass(__faw_rename_at_19_26.a),((char *) "-"))),*__context__,nullptr);
+    DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__faw_rename_at_19_26.a)) == 4));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__faw_rename_at_19_26.b),cast<char *>::from(((char *) "a is 1-2-3-4")),*__context__,nullptr)));
+    return das_auto_cast<bool>::cast(true);
+}}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_90534f21feb0fff2 ( Context * __context__ ) {
+    TArray<Foo> &  arg_Arr = cast_aot_arg<TArray<Foo> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_90534f21feb0fff2(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> const  &  arg_b = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18 ( Context * __context__ ) {
+    TDim<int32_t,4> &  arg_a = cast_aot_arg<TDim<int32_t,4> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b ( Context * __context__ ) {
+    TDim<int32_t,3> &  arg_a = cast_aot_arg<TDim<int32_t,3> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_87ea6c7f1349f9a2 ( Context * __context__ ) {
+    TDim<Foo,2> &  arg_a = cast_aot_arg<TDim<Foo,2> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<Foo> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_87ea6c7f1349f9a2(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__Funcstrings_boostTickjoinTick16475640899284277631_95627e90b433199b ( Context * __context__ ) {
+    TArray<int32_t> const  &  arg_it = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_separator = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<char *>::from(_Funcstrings_boostTickjoinTick16475640899284277631_95627e90b433199b(__context__, arg_it, arg_separator));
+}
+static vec4f __wrap_test_d069ee2c80680fa5 ( Context * __context__ ) {
+    return cast<bool>::from(test_d069ee2c80680fa5(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x9badd1ce03a41459, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_90534f21feb0fff2, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_90534f21feb0fff2 },
+    { 0xa51a880d594e91fd, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c },
+    { 0xca1141a5df264c9, false, (void*)&_FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62, &__wrap__FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 },
+    { 0x2832d7ef64a0974f, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18 },
+    { 0x7964cdf0a208493a, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b },
+    { 0x654b9d7e489773fd, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_87ea6c7f1349f9a2, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_87ea6c7f1349f9a2 },
+    { 0x3c88b1c9ade68d50, false, (void*)&_Funcstrings_boostTickjoinTick16475640899284277631_95627e90b433199b, &__wrap__Funcstrings_boostTickjoinTick16475640899284277631_95627e90b433199b },
+    { 0xa55a30d8daf3b8d6, false, (void*)&test_d069ee2c80680fa5, &__wrap_test_d069ee2c80680fa5 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_1304661605865079465
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
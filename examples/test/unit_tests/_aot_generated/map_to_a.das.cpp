@@ -0,0 +1,154 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_18023416910754722462 {
+
+extern TypeInfo __type_info__af63db4c8601ead9;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __func_info__fa6675435bc1e8a0_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63db4c8601ead9, nullptr, nullptr, nullptr, 0, 0, nullptr, 41026, 24, UINT64_C(0x179356786b0d8779), "foo", 0, 0 };
+VarInfo * __func_info__fa6675435bc1e8a0_fields[1] =  { &__func_info__fa6675435bc1e8a0_field_0 };
+FuncInfo __func_info__fa6675435bc1e8a0 = {"invoke block<(var foo:array<float># -const):void> const", "", __func_info__fa6675435bc1e8a0_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xfa6675435bc1e8a0), 0x0 };
+TypeInfo __type_info__af63db4c8601ead9 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63db4c8601ead9) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickmap_to_arrayTick3903263669889005510_e8df7c9965931065 ( Context * __context__, void * const  __data_rename_at_1951_0, int32_t __len_rename_at_1951_1, Block DAS_COMMENT((void,TArray<float>)) const  & __blk_rename_at_1951_2 );
+inline bool test_28c59058f755a751 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickmap_to_arrayTick3903263669889005510_e8df7c9965931065 ( Context * __context__, void * const  __data_rename_at_1951_0, int32_t __len_rename_at_1951_1, Block DAS_COMMENT((void,TArray<float>)) const  &  __blk_rename_at_1951_2 )
+{
+    DAS_ASSERTF((__data_rename_at_1951_0 != nullptr),(((char *) "expecting data")));
+    DAS_ASSERTF((__len_rename_at_1951_1 > 0),(((char *) "at least 1 element")));
+    int32_t __num_elem_rename_at_1955_3 = ((int32_t)(SimPolicy<int32_t>::Div(__len_rename_at_1951_1,4,*__context__,nullptr)));
+    builtin_temp_array(__data_rename_at_1951_0,__num_elem_rename_at_1955_3,__blk_rename_at_1951_2,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline bool test_28c59058f755a751 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,176,"test " DAS_FILE_LINE);
+{
+    TDim<uint32_t,10> __arr_rename_at_5_4;das_zero(__arr_rename_at_5_4);
+    void * __pdata_rename_at_6_5 = das_auto_cast<void *>::cast(das_ref(__context__,__arr_rename_at_5_4(0,__context__)));
+    _FuncbuiltinTickmap_to_arrayTick3903263669889005510_e8df7c9965931065(__context__,__pdata_rename_at_6_5,40,das_make_block<void,TArray<float> &>(__context__,144,0,&__func_info__fa6675435bc1e8a0,[&](TArray<float> & __foo_rename_at_8_6) -> void{
+        {
+            bool __need_loop_9 = true;
+            // x: int const
+            das_iterator<range> __x_iterator(range(0,10));
+            int32_t __x_rename_at_9_7;
+            __need_loop_9 = __x_iterator.first(__context__,(__x_rename_at_9_7)) && __need_loop_9;
+            for ( ; __need_loop_9 ; __need_loop_9 = __x_iterator.next(__context__,(__x_rename_at_9_7)) )
+            {
+                das_copy(__foo_rename_at_8_6(__x_rename_at_9_7,__context__),float(__x_rename_at_9_7));
+            }
+            __x_iterator.close(__context__,(__x_rename_at_9_7));
+        };
+    }));
+    {
+        bool __need_loop_13 = true;
+        // x: int const
+        das_iterator<range> __x_iterator(range(0,10));
+        int32_t __x_rename_at_13_8;
+        __need_loop_13 = __x_iterator.first(__context__,(__x_rename_at_13_8)) && __need_loop_13;
+        for ( ; __need_loop_13 ; __need_loop_13 = __x_iterator.next(__context__,(__x_rename_at_13_8)) )
+        {
+            float __t_rename_at_14_9 = ((float)das_cast<float>::cast(__arr_rename_at_5_4(__x_rename_at_13_8,__context__)));
+            DAS_ASSERT((float(__x_rename_at_13_8) == __t_rename_at_14_9));
+        }
+        __x_iterator.close(__context__,(__x_rename_at_13_8));
+    };
+    return das_auto_cast<bool>::cast(true);
+}}
+static vec4f __wrap__FuncbuiltinTickmap_to_arrayTick3903263669889005510_e8df7c9965931065 ( Context * __context__ ) {
+    void * const  arg_data = cast_aot_arg<void * const >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_len = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    Block DAS_COMMENT((void,TArray<float>)) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((void,TArray<float>)) const  & >::to(*__context__,__context__->abiArguments()[2]);
+    _FuncbuiltinTickmap_to_arrayTick3903263669889005510_e8df7c9965931065(__context__, arg_data, arg_len, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap_test_28c59058f755a751 ( Context * __context__ ) {
+    return cast<bool>::from(test_28c59058f755a751(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xaee63b9d3606b4dc, false, (void*)&_FuncbuiltinTickmap_to_arrayTick3903263669889005510_e8df7c9965931065, &__wrap__FuncbuiltinTickmap_to_arrayTick3903263669889005510_e8df7c9965931065 },
+    { 0x8e89b3dea7f473fd, false, (void*)&test_28c59058f755a751, &__wrap_test_28c59058f755a751 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_18023416910754722462
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
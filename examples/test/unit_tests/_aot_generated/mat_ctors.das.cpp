@@ -0,0 +1,311 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_6347830359012163160 {
+
+extern TypeInfo __type_info__f5da0ee6747dc8ab;
+
+TypeInfo __type_info__f5da0ee6747dc8ab = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~math::float4x4"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 286, 64, UINT64_C(0xf5da0ee6747dc8ab) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {__type_info__f5da0ee6747dc8ab, };
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__f5da0ee6747dc8ab };
+
+inline int32_t _FuncTickpassxTick6539838846118463397_5f4f115974bd8169 ( Context * __context__, int32_t __a_rename_at_72_0 );
+inline void _FuncTicktest_anyTick14292975069903405798_f218e7c17245a473 ( Context * __context__, float4x4 & __t_rename_at_76_1 );
+inline void _FuncTicktest_anyTick14292975069903405798_6de6e8c38dedb5ef ( Context * __context__, float3x4 & __t_rename_at_76_6 );
+inline void test_4x4_faf25b49368b2049 ( Context * __context__ );
+inline bool test_r2v_c01b6cf6be604467 ( Context * __context__ );
+inline bool test_a130ad4a70a4420d ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t _FuncTickpassxTick6539838846118463397_5f4f115974bd8169 ( Context * __context__, int32_t __a_rename_at_72_0 )
+{
+    return das_auto_cast<int32_t>::cast(__a_rename_at_72_0);
+}
+
+inline void _FuncTicktest_anyTick14292975069903405798_f218e7c17245a473 ( Context * __context__, float4x4 &  __t_rename_at_76_1 )
+{
+    float4x4_identity(das_arg<float4x4>::pass(__t_rename_at_76_1));
+    {
+        bool __need_loop_82 = true;
+        // r: int const
+        das_iterator<range> __r_iterator(range(0,4));
+        int32_t __r_rename_at_82_2;
+        __need_loop_82 = __r_iterator.first(__context__,(__r_rename_at_82_2)) && __need_loop_82;
+        for ( ; __need_loop_82 ; __need_loop_82 = __r_iterator.next(__context__,(__r_rename_at_82_2)) )
+        {
+            das_copy(das_index<float4x4>::at(__t_rename_at_76_1,__r_rename_at_82_2,__context__),v_splats(__r_rename_at_82_2));
+        }
+        __r_iterator.close(__context__,(__r_rename_at_82_2));
+    };
+    {
+        bool __need_loop_86 = true;
+        // y: int const
+        das_iterator<range> __y_iterator(range(0,4));
+        int32_t __y_rename_at_86_3;
+        __need_loop_86 = __y_iterator.first(__context__,(__y_rename_at_86_3)) && __need_loop_86;
+        for ( ; __need_loop_86 ; __need_loop_86 = __y_iterator.next(__context__,(__y_rename_at_86_3)) )
+        {
+            {
+                bool __need_loop_87 = true;
+                // x: int const
+                das_iterator<range> __x_iterator(range(0,4));
+                int32_t __x_rename_at_87_4;
+                __need_loop_87 = __x_iterator.first(__context__,(__x_rename_at_87_4)) && __need_loop_87;
+                for ( ; __need_loop_87 ; __need_loop_87 = __x_iterator.next(__context__,(__x_rename_at_87_4)) )
+                {
+                    das_copy(das_index<float4>::at(das_index<float4x4>::at(__t_rename_at_76_1,__y_rename_at_86_3,__context__),__x_rename_at_87_4,__context__),(__x_rename_at_87_4 == __y_rename_at_86_3) ? das_auto_cast<float>::cast(1.000000e+00f) : das_auto_cast<float>::cast(0.000000e+00f));
+                }
+                __x_iterator.close(__context__,(__x_rename_at_87_4));
+            };
+        }
+        __y_iterator.close(__context__,(__y_rename_at_86_3));
+    };
+    bool __ops_rename_at_92_5 = false;
+    das_try_recover(__context__, [&]()
+    {
+        das_copy(das_index<float4x4>::at(__t_rename_at_76_1,_FuncTickpassxTick6539838846118463397_5f4f115974bd8169(__context__,4),__context__),v_zero());
+    }, [&]()
+    {
+        das_copy(__ops_rename_at_92_5,true);
+    });
+    DAS_ASSERT((__ops_rename_at_92_5));
+}
+
+inline void _FuncTicktest_anyTick14292975069903405798_6de6e8c38dedb5ef ( Context * __context__, float3x4 &  __t_rename_at_76_6 )
+{
+    float3x4_identity(das_arg<float3x4>::pass(__t_rename_at_76_6));
+    {
+        bool __need_loop_82 = true;
+        // r: int const
+        das_iterator<range> __r_iterator(range(0,4));
+        int32_t __r_rename_at_82_7;
+        __need_loop_82 = __r_iterator.first(__context__,(__r_rename_at_82_7)) && __need_loop_82;
+        for ( ; __need_loop_82 ; __need_loop_82 = __r_iterator.next(__context__,(__r_rename_at_82_7)) )
+        {
+            das_copy(das_index<float3x4>::at(__t_rename_at_76_6,__r_rename_at_82_7,__context__),v_splats(__r_rename_at_82_7));
+        }
+        __r_iterator.close(__context__,(__r_rename_at_82_7));
+    };
+    {
+        bool __need_loop_86 = true;
+        // y: int const
+        das_iterator<range> __y_iterator(range(0,4));
+        int32_t __y_rename_at_86_8;
+        __need_loop_86 = __y_iterator.first(__context__,(__y_rename_at_86_8)) && __need_loop_86;
+        for ( ; __need_loop_86 ; __need_loop_86 = __y_iterator.next(__context__,(__y_rename_at_86_8)) )
+        {
+            {
+                bool __need_loop_87 = true;
+                // x: int const
+                das_iterator<range> __x_iterator(range(0,3));
+                int32_t __x_rename_at_87_9;
+                __need_loop_87 = __x_iterator.first(__context__,(__x_rename_at_87_9)) && __need_loop_87;
+                for ( ; __need_loop_87 ; __need_loop_87 = __x_iterator.next(__context__,(__x_rename_at_87_9)) )
+                {
+                    das_copy(das_index<float3>::at(das_index<float3x4>::at(__t_rename_at_76_6,__y_rename_at_86_8,__context__),__x_rename_at_87_9,__context__),(__x_rename_at_87_9 == __y_rename_at_86_8) ? das_auto_cast<float>::cast(1.000000e+00f) : das_auto_cast<float>::cast(0.000000e+00f));
+                }
+                __x_iterator.close(__context__,(__x_rename_at_87_9));
+            };
+        }
+        __y_iterator.close(__context__,(__y_rename_at_86_8));
+    };
+    bool __ops_rename_at_92_10 = false;
+    das_try_recover(__context__, [&]()
+    {
+        das_copy(das_index<float3x4>::at(__t_rename_at_76_6,_FuncTickpassxTick6539838846118463397_5f4f115974bd8169(__context__,4),__context__),v_zero());
+    }, [&]()
+    {
+        das_copy(__ops_rename_at_92_10,true);
+    });
+    DAS_ASSERT((__ops_rename_at_92_10));
+}
+
+inline void test_4x4_faf25b49368b2049 ( Context * __context__ )
+{
+    float4x4 __t_rename_at_41_11;das_zero(__t_rename_at_41_11);
+    das_copy(das_index<float4x4>::at(__t_rename_at_41_11,0,__context__),v_make_vec4f(1.000000e+00f,2.000000e+00f,3.000000e+00f,4.000000e+00f));
+    das_copy(das_index<float4x4>::at(__t_rename_at_41_11,1,__context__),v_make_vec4f(5.000000e+00f,6.000000e+00f,7.000000e+00f,8.000000e+00f));
+    das_copy(das_index<float4x4>::at(__t_rename_at_41_11,2,__context__),v_make_vec4f(9.000000e+00f,1.000000e+01f,1.100000e+01f,1.200000e+01f));
+    das_copy(das_index<float4x4>::at(__t_rename_at_41_11,3,__context__),v_make_vec4f(1.300000e+01f,1.400000e+01f,1.500000e+01f,1.600000e+01f));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<float4x4 &>::from(__t_rename_at_41_11)))),cast<char *>::from(((char *) "[[ 1,2,3,4; 5,6,7,8; 9,10,11,12; 13,14,15,16]]")),*__context__,nullptr)));
+    {
+        bool __need_loop_48 = true;
+        // y: int const
+        das_iterator<range> __y_iterator(range(0,4));
+        int32_t __y_rename_at_48_12;
+        __need_loop_48 = __y_iterator.first(__context__,(__y_rename_at_48_12)) && __need_loop_48;
+        for ( ; __need_loop_48 ; __need_loop_48 = __y_iterator.next(__context__,(__y_rename_at_48_12)) )
+        {
+            {
+                bool __need_loop_49 = true;
+                // x: int const
+                das_iterator<range> __x_iterator(range(0,4));
+                int32_t __x_rename_at_49_13;
+                __need_loop_49 = __x_iterator.first(__context__,(__x_rename_at_49_13)) && __need_loop_49;
+                for ( ; __need_loop_49 ; __need_loop_49 = __x_iterator.next(__context__,(__x_rename_at_49_13)) )
+                {
+                    das_copy(das_index<float4>::at(das_index<float4x4>::at(__t_rename_at_41_11,__y_rename_at_48_12,__context__),__x_rename_at_49_13,__context__),(__x_rename_at_49_13 == __y_rename_at_48_12) ? das_auto_cast<float>::cast(1.000000e+00f) : das_auto_cast<float>::cast(0.000000e+00f));
+                }
+                __x_iterator.close(__context__,(__x_rename_at_49_13));
+            };
+        }
+        __y_iterator.close(__context__,(__y_rename_at_48_12));
+    };
+    das_copy(__t_rename_at_41_11.m[0] /*x*/,v_make_vec4f(1.000000e+00f,2.000000e+00f,3.000000e+00f,4.000000e+00f));
+    das_copy(__t_rename_at_41_11.m[1] /*y*/,v_make_vec4f(5.000000e+00f,6.000000e+00f,7.000000e+00f,8.000000e+00f));
+    das_copy(__t_rename_at_41_11.m[2] /*z*/,v_make_vec4f(9.000000e+00f,1.000000e+01f,1.100000e+01f,1.200000e+01f));
+    das_copy(__t_rename_at_41_11.m[3] /*w*/,v_make_vec4f(1.300000e+01f,1.400000e+01f,1.500000e+01f,1.600000e+01f));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<float4x4 &>::from(__t_rename_at_41_11)))),cast<char *>::from(((char *) "[[ 1,2,3,4; 5,6,7,8; 9,10,11,12; 13,14,15,16]]")),*__context__,nullptr)));
+    float4x4_identity(das_arg<float4x4>::pass(__t_rename_at_41_11));
+    bool __ops_rename_at_62_14 = false;
+    das_try_recover(__context__, [&]()
+    {
+        das_copy(das_index<float4x4>::at(__t_rename_at_41_11,_FuncTickpassxTick6539838846118463397_5f4f115974bd8169(__context__,4),__context__),v_zero());
+    }, [&]()
+    {
+        das_copy(__ops_rename_at_62_14,true);
+    });
+    DAS_ASSERT((__ops_rename_at_62_14));
+}
+
+inline bool test_r2v_c01b6cf6be604467 ( Context * __context__ )
+{
+    float4x4 __m_rename_at_103_15;das_zero(__m_rename_at_103_15);
+    das_copy(das_index<float4x4>::at(__m_rename_at_103_15,0,__context__),v_make_vec4f(1.000000e+00f,2.000000e+00f,3.000000e+00f,4.000000e+00f));
+    das_copy(das_swizzle_ref<float,float4,1>::swizzle(das_index<float4x4>::at(__m_rename_at_103_15,1,__context__)) /*y*/,6.000000e+00f);
+    das_copy(das_index<float4x4>::at(__m_rename_at_103_15,2,__context__),v_make_vec4f(5.000000e+00f,6.000000e+00f,7.000000e+00f,8.000000e+00f));
+    das_copy(__m_rename_at_103_15.m[3] /*w*/,v_make_vec4f(9.000000e+00f,1.000000e+01f,1.100000e+01f,1.200000e+01f));
+    das_copy(das_swizzle_ref<float,float4,2>::swizzle(__m_rename_at_103_15.m[3] /*w*/) /*z*/,1.110000e+02f);
+    DAS_ASSERT((SimPolicy<float4>::Equ(das_index<float4x4>::at(__m_rename_at_103_15,0,__context__),v_make_vec4f(1.000000e+00f,2.000000e+00f,3.000000e+00f,4.000000e+00f),*__context__,nullptr)));
+    DAS_ASSERT((v_extract_y(das_index<float4x4>::at(__m_rename_at_103_15,1,__context__)) /*y*/ == 6.000000e+00f));
+    DAS_ASSERT((SimPolicy<float4>::Equ(das_index<float4x4>::at(__m_rename_at_103_15,1,__context__),v_make_vec4f(0.000000e+00f,6.000000e+00f,0.000000e+00f,0.000000e+00f),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<float4>::Equ(das_index<float4x4>::at(__m_rename_at_103_15,2,__context__),v_make_vec4f(5.000000e+00f,6.000000e+00f,7.000000e+00f,8.000000e+00f),*__context__,nullptr)));
+    DAS_ASSERT((v_extract_z(__m_rename_at_103_15.m[3] /*w*/) /*z*/ == 1.110000e+02f));
+    DAS_ASSERT((SimPolicy<float4>::Equ(__m_rename_at_103_15.m[3] /*w*/,v_make_vec4f(9.000000e+00f,1.000000e+01f,1.110000e+02f,1.200000e+01f),*__context__,nullptr)));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline bool test_a130ad4a70a4420d ( Context * __context__ )
+{
+    float4x4 _temp_make_local_122_13_0; _temp_make_local_122_13_0;
+    float3x4 _temp_make_local_123_13_1; _temp_make_local_123_13_1;
+    test_r2v_c01b6cf6be604467(__context__);
+    test_4x4_faf25b49368b2049(__context__);
+    _FuncTicktest_anyTick14292975069903405798_f218e7c17245a473(__context__,das_arg<float4x4>::pass((_temp_make_local_122_13_0 = (/*c-tor*/ float4x4(/*end-c-tor*/)))));
+    _FuncTicktest_anyTick14292975069903405798_6de6e8c38dedb5ef(__context__,das_arg<float3x4>::pass((_temp_make_local_123_13_1 = (/*c-tor*/ float3x4(/*end-c-tor*/)))));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncTickpassxTick6539838846118463397_5f4f115974bd8169 ( Context * __context__ ) {
+    int32_t arg_a = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(_FuncTickpassxTick6539838846118463397_5f4f115974bd8169(__context__, arg_a));
+}
+static vec4f __wrap__FuncTicktest_anyTick14292975069903405798_f218e7c17245a473 ( Context * __context__ ) {
+    float4x4 &  arg_t = cast_aot_arg<float4x4 & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_anyTick14292975069903405798_f218e7c17245a473(__context__, arg_t);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_anyTick14292975069903405798_6de6e8c38dedb5ef ( Context * __context__ ) {
+    float3x4 &  arg_t = cast_aot_arg<float3x4 & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_anyTick14292975069903405798_6de6e8c38dedb5ef(__context__, arg_t);
+    return v_zero();
+}
+static vec4f __wrap_test_4x4_faf25b49368b2049 ( Context * __context__ ) {
+    test_4x4_faf25b49368b2049(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_r2v_c01b6cf6be604467 ( Context * __context__ ) {
+    return cast<bool>::from(test_r2v_c01b6cf6be604467(__context__));
+}
+static vec4f __wrap_test_a130ad4a70a4420d ( Context * __context__ ) {
+    return cast<bool>::from(test_a130ad4a70a4420d(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xa3a53ae5d17970d1, false, (void*)&_FuncTickpassxTick6539838846118463397_5f4f115974bd8169, &__wrap__FuncTickpassxTick6539838846118463397_5f4f115974bd8169 },
+    { 0x85e8df65ef274539, false, (void*)&_FuncTicktest_anyTick14292975069903405798_f218e7c17245a473, &__wrap__FuncTicktest_anyTick14292975069903405798_f218e7c17245a473 },
+    { 0xcf839783df374977, false, (void*)&_FuncTicktest_anyTick14292975069903405798_6de6e8c38dedb5ef, &__wrap__FuncTicktest_anyTick14292975069903405798_6de6e8c38dedb5ef },
+    { 0x2f529fdc0593e397, false, (void*)&test_4x4_faf25b49368b2049, &__wrap_test_4x4_faf25b49368b2049 },
+    { 0xc217cea5ec3b41a3, false, (void*)&test_r2v_c01b6cf6be604467, &__wrap_test_r2v_c01b6cf6be604467 },
+    { 0xa6bf1247f33fd00a, false, (void*)&test_a130ad4a70a4420d, &__wrap_test_a130ad4a70a4420d },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_6347830359012163160
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
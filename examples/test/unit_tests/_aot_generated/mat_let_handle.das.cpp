@@ -0,0 +1,243 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_9212349863282490024 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void test_mat_9962bccafadd705e ( Context * __context__, float3x4 const  & __m_rename_at_5_0 );
+inline bool test_transpose_9eebe947bbd41b73 ( Context * __context__ );
+inline bool test_5ffd656a74f0008f ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void test_mat_9962bccafadd705e ( Context * __context__, float3x4 const  &  __m_rename_at_5_0 )
+{
+    float3x4 __t_rename_at_6_1 = __m_rename_at_5_0;
+    {
+        bool __need_loop_7 = true;
+        // x: int const
+        das_iterator<range> __x_iterator(range(0,3));
+        int32_t __x_rename_at_7_2;
+        __need_loop_7 = __x_iterator.first(__context__,(__x_rename_at_7_2)) && __need_loop_7;
+        for ( ; __need_loop_7 ; __need_loop_7 = __x_iterator.next(__context__,(__x_rename_at_7_2)) )
+        {
+            {
+                bool __need_loop_8 = true;
+                // y: int const
+                das_iterator<range> __y_iterator(range(0,4));
+                int32_t __y_rename_at_8_3;
+                __need_loop_8 = __y_iterator.first(__context__,(__y_rename_at_8_3)) && __need_loop_8;
+                for ( ; __need_loop_8 ; __need_loop_8 = __y_iterator.next(__context__,(__y_rename_at_8_3)) )
+                {
+                    DAS_ASSERT((das_index<float3>::at(das_index<float3x4>::at(__t_rename_at_6_1,__y_rename_at_8_3,__context__),__x_rename_at_7_2,__context__) == float((__y_rename_at_8_3 * 3) + __x_rename_at_7_2)));
+                    DAS_ASSERT((das_index<float3>::at(das_index<float3x4>::at(__t_rename_at_6_1,__y_rename_at_8_3,__context__),__x_rename_at_7_2,__context__) == das_index<float3 const >::at(das_index<float3x4 const >::at(__m_rename_at_5_0,__y_rename_at_8_3,__context__),__x_rename_at_7_2,__context__)));
+                }
+                __y_iterator.close(__context__,(__y_rename_at_8_3));
+            };
+        }
+        __x_iterator.close(__context__,(__x_rename_at_7_2));
+    };
+}
+
+inline bool test_transpose_9eebe947bbd41b73 ( Context * __context__ )
+{
+    float4x4 _temp_make_local_30_24_0; _temp_make_local_30_24_0;
+    float4x4 _temp_make_local_34_19_1; _temp_make_local_34_19_1;
+    float4x4 _temp_make_local_34_34_2; _temp_make_local_34_34_2;
+    float4x4 __a_rename_at_17_4;das_zero(__a_rename_at_17_4); float4x4 __b_rename_at_17_5;das_zero(__b_rename_at_17_5);
+    {
+        bool __need_loop_18 = true;
+        // x: int const
+        das_iterator<range> __x_iterator(range(0,4));
+        int32_t __x_rename_at_18_6;
+        __need_loop_18 = __x_iterator.first(__context__,(__x_rename_at_18_6)) && __need_loop_18;
+        for ( ; __need_loop_18 ; __need_loop_18 = __x_iterator.next(__context__,(__x_rename_at_18_6)) )
+        {
+            {
+                bool __need_loop_19 = true;
+                // y: int const
+                das_iterator<range> __y_iterator(range(0,4));
+                int32_t __y_rename_at_19_7;
+                __need_loop_19 = __y_iterator.first(__context__,(__y_rename_at_19_7)) && __need_loop_19;
+                for ( ; __need_loop_19 ; __need_loop_19 = __y_iterator.next(__context__,(__y_rename_at_19_7)) )
+                {
+                    das_copy(das_index<float4>::at(das_index<float4x4>::at(__a_rename_at_17_4,__x_rename_at_18_6,__context__),__y_rename_at_19_7,__context__),float((__x_rename_at_18_6 * 4) + __y_rename_at_19_7));
+                    das_copy(das_index<float4>::at(das_index<float4x4>::at(__b_rename_at_17_5,__x_rename_at_18_6,__context__),__y_rename_at_19_7,__context__),float(((__x_rename_at_18_6 + 1) * 4) + (__y_rename_at_19_7 + 1)));
+                }
+                __y_iterator.close(__context__,(__y_rename_at_19_7));
+            };
+        }
+        __x_iterator.close(__context__,(__x_rename_at_18_6));
+    };
+    float4x4 __ta_rename_at_24_8_ConstRef = ((float4x4)float4x4_transpose(das_arg<float4x4>::pass(__a_rename_at_17_4)));
+    float4x4 const  & __ta_rename_at_24_8 = __ta_rename_at_24_8_ConstRef;
+;
+    {
+        bool __need_loop_25 = true;
+        // x: int const
+        das_iterator<range> __x_iterator(range(0,4));
+        int32_t __x_rename_at_25_9;
+        __need_loop_25 = __x_iterator.first(__context__,(__x_rename_at_25_9)) && __need_loop_25;
+        for ( ; __need_loop_25 ; __need_loop_25 = __x_iterator.next(__context__,(__x_rename_at_25_9)) )
+        {
+            {
+                bool __need_loop_26 = true;
+                // y: int const
+                das_iterator<range> __y_iterator(range(0,4));
+                int32_t __y_rename_at_26_10;
+                __need_loop_26 = __y_iterator.first(__context__,(__y_rename_at_26_10)) && __need_loop_26;
+                for ( ; __need_loop_26 ; __need_loop_26 = __y_iterator.next(__context__,(__y_rename_at_26_10)) )
+                {
+                    DAS_ASSERT((das_index<float4 const >::at(das_index<float4x4 const >::at(__ta_rename_at_24_8,__y_rename_at_26_10,__context__),__x_rename_at_25_9,__context__) == float((__x_rename_at_25_9 * 4) + __y_rename_at_26_10)));
+                }
+                __y_iterator.close(__context__,(__y_rename_at_26_10));
+            };
+        }
+        __x_iterator.close(__context__,(__x_rename_at_25_9));
+    };
+    float4x4 __tta_rename_at_30_11_ConstRef = ((float4x4)float4x4_transpose(das_arg<float4x4>::pass((_temp_make_local_30_24_0 = (float4x4_transpose(das_arg<float4x4>::pass(__a_rename_at_17_4)))))));
+    float4x4 const  & __tta_rename_at_30_11 = __tta_rename_at_30_11_ConstRef;
+;
+    DAS_ASSERT((float4x4_equ(__tta_rename_at_30_11,das_arg<float4x4>::pass(__a_rename_at_17_4))));
+    float4x4 __tb_rename_at_32_12_ConstRef = ((float4x4)float4x4_transpose(das_arg<float4x4>::pass(__b_rename_at_17_5)));
+    float4x4 const  & __tb_rename_at_32_12 = __tb_rename_at_32_12_ConstRef;
+;
+    float4x4 __tatb_rename_at_33_13_ConstRef = ((float4x4)(float4x4_mul(__ta_rename_at_24_8,__tb_rename_at_32_12)));
+    float4x4 const  & __tatb_rename_at_33_13 = __tatb_rename_at_33_13_ConstRef;
+;
+    float4x4 __tatb_opt_rename_at_34_14_ConstRef = ((float4x4)(float4x4_mul(das_arg<float4x4>::pass((_temp_make_local_34_19_1 = (float4x4_transpose(das_arg<float4x4>::pass(__a_rename_at_17_4))))),das_arg<float4x4>::pass((_temp_make_local_34_34_2 = (float4x4_transpose(das_arg<float4x4>::pass(__b_rename_at_17_5))))))));
+    float4x4 const  & __tatb_opt_rename_at_34_14 = __tatb_opt_rename_at_34_14_ConstRef;
+;
+    DAS_ASSERT((float4x4_equ(__tatb_rename_at_33_13,__tatb_opt_rename_at_34_14)));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline bool test_5ffd656a74f0008f ( Context * __context__ )
+{
+    float3x4 __m_rename_at_41_15;das_zero(__m_rename_at_41_15);
+    {
+        bool __need_loop_42 = true;
+        // x: int const
+        das_iterator<range> __x_iterator(range(0,3));
+        int32_t __x_rename_at_42_16;
+        __need_loop_42 = __x_iterator.first(__context__,(__x_rename_at_42_16)) && __need_loop_42;
+        for ( ; __need_loop_42 ; __need_loop_42 = __x_iterator.next(__context__,(__x_rename_at_42_16)) )
+        {
+            {
+                bool __need_loop_43 = true;
+                // y: int const
+                das_iterator<range> __y_iterator(range(0,4));
+                int32_t __y_rename_at_43_17;
+                __need_loop_43 = __y_iterator.first(__context__,(__y_rename_at_43_17)) && __need_loop_43;
+                for ( ; __need_loop_43 ; __need_loop_43 = __y_iterator.next(__context__,(__y_rename_at_43_17)) )
+                {
+                    das_copy(das_index<float3>::at(das_index<float3x4>::at(__m_rename_at_41_15,__y_rename_at_43_17,__context__),__x_rename_at_42_16,__context__),float((__y_rename_at_43_17 * 3) + __x_rename_at_42_16));
+                }
+                __y_iterator.close(__context__,(__y_rename_at_43_17));
+            };
+        }
+        __x_iterator.close(__context__,(__x_rename_at_42_16));
+    };
+    test_mat_9962bccafadd705e(__context__,das_arg<float3x4>::pass(__m_rename_at_41_15));
+    test_transpose_9eebe947bbd41b73(__context__);
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_test_mat_9962bccafadd705e ( Context * __context__ ) {
+    float3x4 const  &  arg_m = cast_aot_arg<float3x4 const  & >::to(*__context__,__context__->abiArguments()[0]);
+    test_mat_9962bccafadd705e(__context__, arg_m);
+    return v_zero();
+}
+static vec4f __wrap_test_transpose_9eebe947bbd41b73 ( Context * __context__ ) {
+    return cast<bool>::from(test_transpose_9eebe947bbd41b73(__context__));
+}
+static vec4f __wrap_test_5ffd656a74f0008f ( Context * __context__ ) {
+    return cast<bool>::from(test_5ffd656a74f0008f(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x8b8bd225238ff4ad, false, (void*)&test_mat_9962bccafadd705e, &__wrap_test_mat_9962bccafadd705e },
+    { 0x73d6c6944fe4a212, false, (void*)&test_transpose_9eebe947bbd41b73, &__wrap_test_transpose_9eebe947bbd41b73 },
+    { 0xa3341a0e1d5d4930, false, (void*)&test_5ffd656a74f0008f, &__wrap_test_5ffd656a74f0008f },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_9212349863282490024
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,224 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14326836896349710459 {
+
+extern TypeInfo __type_info__af85fe4c863bec52;
+extern TypeInfo __type_info__af90fe4c864e9d52;
+
+TypeInfo __type_info__af85fe4c863bec52 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf85fe4c863bec52) };
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[5] = { &__type_info__af85fe4c863bec52, &__type_info__af90fe4c864e9d52, &__type_info__af85fe4c863bec52, &__type_info__af90fe4c864e9d52, &__type_info__af85fe4c863bec52 };
+
+inline int32_t rightPolicyCeili_37825e2cf1585f61 ( Context * __context__, float __a_rename_at_7_0 );
+inline bool test_9eb5c88ed9bda0b1 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t rightPolicyCeili_37825e2cf1585f61 ( Context * __context__, float __a_rename_at_7_0 )
+{
+    return das_auto_cast<int32_t>::cast(SimPolicy<float>::Ceili(__a_rename_at_7_0,*__context__,nullptr));
+}
+
+inline bool test_9eb5c88ed9bda0b1 ( Context * __context__ )
+{
+    DAS_ASSERT((true));
+    uint32_t __seed_rename_at_14_1 = 0x1u;
+    int32_t __position_rename_at_15_2 = ((int32_t)1);
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((uint_noise1D(__position_rename_at_15_2,__seed_rename_at_14_1) != __seed_rename_at_14_1));
+    DAS_ASSERT((uint_noise2D_int2(int2(100,100),__seed_rename_at_14_1) != __seed_rename_at_14_1));
+    DAS_ASSERT((uint_noise3D_int3(int3(100,100,100),__seed_rename_at_14_1) != __seed_rename_at_14_1));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_ASSERT((true));
+    DAS_VERIFY((rightPolicyCeili_37825e2cf1585f61(__context__,1.200000e+00f) == 2));
+    char * __mme_rename_at_118_3 = ((char *)(char *)(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_0, cast<float>::from(das_global<float,0xd6ccbe25678b1d7b>(__context__) /*FLT_MIN*/), cast<char * const >::from(((char *) " ")), cast<float>::from(das_global<float,0xffad5df5bf6af93>(__context__) /*FLT_MAX*/), cast<char * const >::from(((char *) " ")), cast<float>::from(das_global<float,0x68f5acc264cd8a13>(__context__) /*FLT_EPSILON*/)))));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__mme_rename_at_118_3),cast<char *>::from(((char *) "1.1754944e-38 3.4028235e+38 1.1920929e-07")),*__context__,nullptr)));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_rightPolicyCeili_37825e2cf1585f61 ( Context * __context__ ) {
+    float arg_a = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(rightPolicyCeili_37825e2cf1585f61(__context__, arg_a));
+}
+static vec4f __wrap_test_9eb5c88ed9bda0b1 ( Context * __context__ ) {
+    return cast<bool>::from(test_9eb5c88ed9bda0b1(__context__));
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x8ecece8330b95e19, false, (void*)&rightPolicyCeili_37825e2cf1585f61, &__wrap_rightPolicyCeili_37825e2cf1585f61 },
+    { 0x42afb964d336519, false, (void*)&test_9eb5c88ed9bda0b1, &__wrap_test_9eb5c88ed9bda0b1 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x61838b9047b731b9, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_14326836896349710459
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
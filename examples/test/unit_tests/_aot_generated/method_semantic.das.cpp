@@ -0,0 +1,182 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_7977068076674467034 {
+
+namespace  { struct Point; };
+namespace  {
+
+struct Point {
+    float x;
+    float y;
+    Func DAS_COMMENT((float,Point const )) magnitude;
+    Func DAS_COMMENT((float,Point const ,Point const )) dot;
+};
+static_assert(sizeof(Point)==24,"structure size mismatch with DAS");
+static_assert(offsetof(Point,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Point,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Point,magnitude)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Point,dot)==16,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline Point _FuncTickPointTick2497721602638034741_3cb04fb42e9191ba ( Context * __context__, float __X_rename_at_8_0, float __Y_rename_at_8_1 );
+inline float point_magnitude_d75d7e390b0ddae4 ( Context * __context__, Point const  & __that_rename_at_12_2 );
+inline float point_dot_46aeb68355715e13 ( Context * __context__, Point const  & __that_rename_at_16_3, Point const  & __p_rename_at_16_4 );
+inline bool test_9390848e5e0a2e4c ( Context * __context__ );
+inline Point Point_76d2aeb14c96a332 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Point _FuncTickPointTick2497721602638034741_3cb04fb42e9191ba ( Context * __context__, float __X_rename_at_8_0, float __Y_rename_at_8_1 )
+{
+    return das_auto_cast_ref<Point>::cast((([&]() -> Point {
+        Point __mks_9 = Point_76d2aeb14c96a332(__context__);
+        das_copy((__mks_9.x),(__X_rename_at_8_0));
+        das_copy((__mks_9.y),(__Y_rename_at_8_1));
+        return __mks_9;
+    })()));
+}
+
+inline float point_magnitude_d75d7e390b0ddae4 ( Context * __context__, Point const  &  __that_rename_at_12_2 )
+{
+    return das_auto_cast<float>::cast((__that_rename_at_12_2.x * __that_rename_at_12_2.x) + (__that_rename_at_12_2.y * __that_rename_at_12_2.y));
+}
+
+inline float point_dot_46aeb68355715e13 ( Context * __context__, Point const  &  __that_rename_at_16_3, Point const  &  __p_rename_at_16_4 )
+{
+    return das_auto_cast<float>::cast((__that_rename_at_16_3.x * __p_rename_at_16_4.x) + (__that_rename_at_16_3.y * __p_rename_at_16_4.y));
+}
+
+inline bool test_9390848e5e0a2e4c ( Context * __context__ )
+{
+    Point _temp_make_local_24_19_0; _temp_make_local_24_19_0;
+    Point __p_rename_at_22_5_ConstRef = ((Point)_FuncTickPointTick2497721602638034741_3cb04fb42e9191ba(__context__,2.000000e+00f,3.000000e+00f));
+    Point const  & __p_rename_at_22_5 = __p_rename_at_22_5_ConstRef;
+;
+    float __t_rename_at_23_6 = ((float)das_invoke_method<float,8/*magnitude*/>::invoke<Point const  &>(__context__,nullptr,das_cast<Point const >::cast(__p_rename_at_22_5)));
+    float __d_rename_at_24_7 = ((float)das_invoke_method<float,16/*dot*/>::invoke<Point const  &,Point &>(__context__,nullptr,das_cast<Point const >::cast(__p_rename_at_22_5),das_arg<Point>::pass((_temp_make_local_24_19_0 = (_FuncTickPointTick2497721602638034741_3cb04fb42e9191ba(__context__,1.000000e+00f,1.000000e+00f))))));
+    DAS_ASSERT(((__t_rename_at_23_6 == 1.300000e+01f) && (__d_rename_at_24_7 == 5.000000e+00f)));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline Point Point_76d2aeb14c96a332 ( Context * __context__ )
+{
+    return /* <- */ das_auto_cast_move<Point>::cast((([&]() -> Point {
+        Point __mks_2;
+        das_copy((__mks_2.x),(0.000000e+00f));
+        das_copy((__mks_2.y),(0.000000e+00f));
+        das_copy((__mks_2.magnitude),(Func(__context__->fnByMangledName(/*point_magnitude CS<Point>*/ 0x76986514bab1dc6d))));
+        das_copy((__mks_2.dot),(Func(__context__->fnByMangledName(/*point_dot CS<Point> CS<Point>*/ 0xa4acf859d355bce2))));
+        return __mks_2;
+    })()));
+}
+static vec4f __wrap__FuncTickPointTick2497721602638034741_3cb04fb42e9191ba ( Context * __context__ ) {
+    float arg_X = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[0]);
+    float arg_Y = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[1]);
+    *((Point *) __context__->abiCMRES) = _FuncTickPointTick2497721602638034741_3cb04fb42e9191ba(__context__, arg_X, arg_Y);
+    return v_zero();
+}
+static vec4f __wrap_point_magnitude_d75d7e390b0ddae4 ( Context * __context__ ) {
+    Point const  &  arg_that = cast_aot_arg<Point const  & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<float>::from(point_magnitude_d75d7e390b0ddae4(__context__, arg_that));
+}
+static vec4f __wrap_point_dot_46aeb68355715e13 ( Context * __context__ ) {
+    Point const  &  arg_that = cast_aot_arg<Point const  & >::to(*__context__,__context__->abiArguments()[0]);
+    Point const  &  arg_p = cast_aot_arg<Point const  & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<float>::from(point_dot_46aeb68355715e13(__context__, arg_that, arg_p));
+}
+static vec4f __wrap_test_9390848e5e0a2e4c ( Context * __context__ ) {
+    return cast<bool>::from(test_9390848e5e0a2e4c(__context__));
+}
+static vec4f __wrap_Point_76d2aeb14c96a332 ( Context * __context__ ) {
+    *((Point *) __context__->abiCMRES) = Point_76d2aeb14c96a332(__context__);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x94966cf45b35135d, true, (void*)&_FuncTickPointTick2497721602638034741_3cb04fb42e9191ba, &__wrap__FuncTickPointTick2497721602638034741_3cb04fb42e9191ba },
+    { 0xbf6a0dddeda7efeb, false, (void*)&point_magnitude_d75d7e390b0ddae4, &__wrap_point_magnitude_d75d7e390b0ddae4 },
+    { 0xa8c45f3e0907b37c, false, (void*)&point_dot_46aeb68355715e13, &__wrap_point_dot_46aeb68355715e13 },
+    { 0x4b48f13fc4158e72, false, (void*)&test_9390848e5e0a2e4c, &__wrap_test_9390848e5e0a2e4c },
+    { 0x1c6637d1b6b0a00a, true, (void*)&Point_76d2aeb14c96a332, &__wrap_Point_76d2aeb14c96a332 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_7977068076674467034
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,137 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_16248187862302363733 {
+
+// unused enumeration GooEnum
+// unused enumeration OpCode
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline TestObjectSmart * _FuncbuiltinTickget_ptrTick5807679485210906136_878966099d0412f3 ( Context * __context__, smart_ptr_raw<TestObjectSmart> __src_rename_at_1924_0 );
+inline smart_ptr_raw<TestObjectSmart> mks_811878be15f76069 ( Context * __context__ );
+inline bool test_98ade3643a221a99 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline TestObjectSmart * _FuncbuiltinTickget_ptrTick5807679485210906136_878966099d0412f3 ( Context * __context__, smart_ptr_raw<TestObjectSmart> __src_rename_at_1924_0 )
+{
+    return das_auto_cast<TestObjectSmart *>::cast(das_cast<TestObjectSmart *>::cast(__src_rename_at_1924_0));
+}
+
+inline smart_ptr_raw<TestObjectSmart> mks_811878be15f76069 ( Context * __context__ )
+{
+    return /* <- */ das_auto_cast_move<smart_ptr_raw<TestObjectSmart>>::cast(nullptr);
+}
+
+inline bool test_98ade3643a221a99 ( Context * __context__ )
+{
+    smart_ptr_raw<TestObjectSmart> __p_rename_at_14_1; memset((void*)&__p_rename_at_14_1,0,sizeof(__p_rename_at_14_1));
+    /* finally */ auto __finally_13= das_finally([&](){
+    das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__p_rename_at_14_1);
+    /* end finally */ });
+    __p_rename_at_14_1; das_zero(__p_rename_at_14_1); das_move(__p_rename_at_14_1, das_auto_cast<smart_ptr_raw<TestObjectSmart>>::cast(nullptr));
+    DAS_VERIFY((_FuncbuiltinTickget_ptrTick5807679485210906136_878966099d0412f3(__context__,__p_rename_at_14_1) == nullptr));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncbuiltinTickget_ptrTick5807679485210906136_878966099d0412f3 ( Context * __context__ ) {
+    smart_ptr_raw<TestObjectSmart> arg_src = cast_aot_arg<smart_ptr_raw<TestObjectSmart>>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<TestObjectSmart *>::from(_FuncbuiltinTickget_ptrTick5807679485210906136_878966099d0412f3(__context__, arg_src));
+}
+static vec4f __wrap_mks_811878be15f76069 ( Context * __context__ ) {
+    return cast<smart_ptr_raw<TestObjectSmart>>::from(mks_811878be15f76069(__context__));
+}
+static vec4f __wrap_test_98ade3643a221a99 ( Context * __context__ ) {
+    return cast<bool>::from(test_98ade3643a221a99(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x4772418d925e1940, false, (void*)&_FuncbuiltinTickget_ptrTick5807679485210906136_878966099d0412f3, &__wrap__FuncbuiltinTickget_ptrTick5807679485210906136_878966099d0412f3 },
+    { 0xf448a81b827bc1fc, false, (void*)&mks_811878be15f76069, &__wrap_mks_811878be15f76069 },
+    { 0xa3ef2c8c6cb540ba, false, (void*)&test_98ade3643a221a99, &__wrap_test_98ade3643a221a99 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_16248187862302363733
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,136 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require _module_a
+ // require _module_b
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_17582294006909124361 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline char * _Func_module_bTickfrom_b_get_3Tick18013725700946063786_a0f15f95fabaefab ( Context * __context__ );
+inline char * _Func_module_bTickfrom_b_get_4Tick18012318326061953706_bb0440fd88de0456 ( Context * __context__ );
+inline bool test_67ff775e090c0c91 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global<char *,0x5dacaa5145dccd41>(__context__) = ((char *) "local");/*global_1*/
+    das_global<char *,0x56bcaa513fd94f41>(__context__) = ((char *) "local");/*global_3*/
+}
+
+inline char * _Func_module_bTickfrom_b_get_3Tick18013725700946063786_a0f15f95fabaefab ( Context * __context__ )
+{
+    return das_auto_cast<char *>::cast(das_global<char *,0x74d76de2bfb08b3a>(__context__) /*global_3*/);
+}
+
+inline char * _Func_module_bTickfrom_b_get_4Tick18012318326061953706_bb0440fd88de0456 ( Context * __context__ )
+{
+    return das_auto_cast<char *>::cast(das_global<char *,0x7870de39920d2138>(__context__) /*global_4*/);
+}
+
+inline bool test_67ff775e090c0c91 ( Context * __context__ )
+{
+    DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(das_global<char *,0x5dacaa5145dccd41>(__context__) /*::global_1*/),cast<char *>::from(((char *) "local")),*__context__,nullptr)));
+    DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(das_global<char *,0x787ad63992156825>(__context__) /*_module_b::global_1*/),cast<char *>::from(((char *) "from_b")),*__context__,nullptr)));
+    DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Func_module_bTickfrom_b_get_3Tick18013725700946063786_a0f15f95fabaefab(__context__)),cast<char *>::from(((char *) "from_a")),*__context__,nullptr)));
+    DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Func_module_bTickfrom_b_get_4Tick18012318326061953706_bb0440fd88de0456(__context__)),cast<char *>::from(((char *) "from_b")),*__context__,nullptr)));
+    DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(das_global<char *,0x56bcaa513fd94f41>(__context__) /*global_3*/),cast<char *>::from(((char *) "local")),*__context__,nullptr)));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__Func_module_bTickfrom_b_get_3Tick18013725700946063786_a0f15f95fabaefab ( Context * __context__ ) {
+    return cast<char *>::from(_Func_module_bTickfrom_b_get_3Tick18013725700946063786_a0f15f95fabaefab(__context__));
+}
+static vec4f __wrap__Func_module_bTickfrom_b_get_4Tick18012318326061953706_bb0440fd88de0456 ( Context * __context__ ) {
+    return cast<char *>::from(_Func_module_bTickfrom_b_get_4Tick18012318326061953706_bb0440fd88de0456(__context__));
+}
+static vec4f __wrap_test_67ff775e090c0c91 ( Context * __context__ ) {
+    return cast<bool>::from(test_67ff775e090c0c91(__context__));
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x16acc9391b13d9fa, false, (void*)&_Func_module_bTickfrom_b_get_3Tick18013725700946063786_a0f15f95fabaefab, &__wrap__Func_module_bTickfrom_b_get_3Tick18013725700946063786_a0f15f95fabaefab },
+    { 0x74632c837337f16c, false, (void*)&_Func_module_bTickfrom_b_get_4Tick18012318326061953706_bb0440fd88de0456, &__wrap__Func_module_bTickfrom_b_get_4Tick18012318326061953706_bb0440fd88de0456 },
+    { 0x9452d640c4383d2a, false, (void*)&test_67ff775e090c0c91, &__wrap_test_67ff775e090c0c91 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x4ace12f420b64b78, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_17582294006909124361
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
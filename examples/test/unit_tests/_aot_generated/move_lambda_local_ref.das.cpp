@@ -0,0 +1,298 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_5870759032112329712 {
+
+namespace  { struct Foo; };
+namespace  { struct _lambda_thismodule_7_1; };
+namespace  {
+
+struct Foo {
+    Lambda DAS_COMMENT((TArray<int32_t>)) bar;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,bar)==0,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_7_1 {
+    Func DAS_COMMENT((TArray<int32_t>,_lambda_thismodule_7_1)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_7_1 *)) __finalize;
+    TArray<int32_t> arr;
+};
+static_assert(sizeof(_lambda_thismodule_7_1)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_7_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_7_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_7_1,arr)==16,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__d767ba743f3bd818;
+extern TypeInfo __type_info__cba73bb3d267bec7;
+extern TypeInfo __type_info__124e1c04d9af11ea;
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__dbeb1ccd55230ccd;
+extern TypeInfo __type_info__a3f0477a4765213e;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+TypeInfo * __type_info__b67afede98d6e20e_arg_types_var_15521579649195563032[1] = { &__type_info__dbeb1ccd55230ccd };
+const char * __type_info__b67afede98d6e20e_arg_names_var_15521579649195563032[1] = { "__this" };
+VarInfo __struct_info__d767ba743f3bd818_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__124e1c04d9af11ea, nullptr, (TypeInfo **)__type_info__b67afede98d6e20e_arg_types_var_15521579649195563032, __type_info__b67afede98d6e20e_arg_names_var_15521579649195563032, 1, 0, nullptr, 12, 8, UINT64_C(0xb67afede98d6e20e), "__lambda", 0, 0 };
+TypeInfo * __type_info__5217f5072ec363a8_arg_types_var_15521579649195563032[1] = { &__type_info__cba73bb3d267bec7 };
+VarInfo __struct_info__d767ba743f3bd818_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__5217f5072ec363a8_arg_types_var_15521579649195563032, __type_info__b67afede98d6e20e_arg_names_var_15521579649195563032, 1, 0, nullptr, 12, 8, UINT64_C(0x5217f5072ec363a8), "__finalize", 8, 0 };
+VarInfo __struct_info__d767ba743f3bd818_field_2 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xead4ebb2aa73771f), "arr", 16, 3 };
+VarInfo * __struct_info__d767ba743f3bd818_fields[3] =  { &__struct_info__d767ba743f3bd818_field_0, &__struct_info__d767ba743f3bd818_field_1, &__struct_info__d767ba743f3bd818_field_2 };
+StructInfo __struct_info__d767ba743f3bd818 = {"_lambda_thismodule_7_1", "", 30, __struct_info__d767ba743f3bd818_fields, 3, 40, UINT64_C(0x0), nullptr, UINT64_C(0xd767ba743f3bd818), 2 };
+TypeInfo __type_info__cba73bb3d267bec7 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__dbeb1ccd55230ccd, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xcba73bb3d267bec7) };
+TypeInfo __type_info__124e1c04d9af11ea = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x124e1c04d9af11ea) };
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__dbeb1ccd55230ccd = { Type::tStructure, &__struct_info__d767ba743f3bd818, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 40, UINT64_C(0xdbeb1ccd55230ccd) };
+TypeInfo __type_info__a3f0477a4765213e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xa3f0477a4765213e) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__a3f0477a4765213e, &__type_info__af90fe4c864e9d52 };
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline TArray<int32_t> & _FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 ( Context * __context__, TArray<int32_t> & __a_rename_at_50_2 );
+inline void finalize_132c841e4382c4a7 ( Context * __context__, _lambda_thismodule_7_1 & ____this_rename_at_7_3 );
+inline void _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__, TArray<int32_t> & __a_rename_at_1142_4, TArray<int32_t> const  & __b_rename_at_1142_5 );
+inline TArray<int32_t> _Func_lambda_thismodule_7_1Tickfunction_ee42a5afed3609c2 ( Context * __context__, _lambda_thismodule_7_1 & ____this_rename_at_7_7 );
+inline void _Func_lambda_thismodule_7_1Tickfinalizer_26f59f10a5819650 ( Context * __context__, _lambda_thismodule_7_1 * ____this_rename_at_7_8 );
+inline TArray<int32_t> _FuncbuiltinTickclone_to_moveTick17180087396728260876_845ea85675060ffa ( Context * __context__, TArray<int32_t> & __clone_src_rename_at_1118_9 );
+inline Lambda DAS_COMMENT((TArray<int32_t>)) Bar_6d7a01fa384609a ( Context * __context__, TArray<int32_t> & __arr_rename_at_6_11 );
+inline bool test_b9eb03e672d169fe ( Context * __context__ );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b ( Context * __context__, TDim<int32_t,3> & __a_rename_at_1502_13 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    TArray<int32_t> _temp_make_local_14_19_0;
+    TDim<int32_t,3> _temp_make_local_14_19_1;
+    das_global<Foo *,0x2112bf6e7aa9f75b>(__context__) = das_ascend<Foo,Foo>::make(__context__,nullptr,(([&]() -> Foo {
+        Foo __mks_13;
+        das_move((__mks_13.bar),(Bar_6d7a01fa384609a(__context__,das_arg<TArray<int32_t>>::pass((_temp_make_local_14_19_0 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b(__context__,das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+            _temp_make_local_14_19_1(0,__context__) = 1;
+            _temp_make_local_14_19_1(1,__context__) = 2;
+            _temp_make_local_14_19_1(2,__context__) = 3;
+            return _temp_make_local_14_19_1;
+        })())))))))));
+        return __mks_13;
+    })()));/*foo*/
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline TArray<int32_t> & _FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 ( Context * __context__, TArray<int32_t> &  __a_rename_at_50_2 )
+{
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<TArray<int32_t> &>::from(__a_rename_at_50_2),cast<char * const >::from(((char *) "object can't be returned because it is locked"))));
+    return das_auto_cast_ref<TArray<int32_t> &>::cast(__a_rename_at_50_2);
+}
+
+inline void finalize_132c841e4382c4a7 ( Context * __context__, _lambda_thismodule_7_1 &  ____this_rename_at_7_3 )
+{
+    memset((void*)&(____this_rename_at_7_3), 0, 40);
+}
+
+inline void _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__, TArray<int32_t> &  __a_rename_at_1142_4, TArray<int32_t> const  &  __b_rename_at_1142_5 )
+{
+    int32_t __ln_rename_at_1143_6 = ((int32_t)builtin_array_size(__b_rename_at_1142_5));
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_1142_4),__ln_rename_at_1143_6);
+    if ( __ln_rename_at_1143_6 == 0 )
+    {
+        return ;
+    } else {
+        das_memcpy(das_auto_cast<void * const >::cast(das_ref(__context__,__a_rename_at_1142_4(0,__context__))),das_auto_cast<void * const >::cast(das_ref(__context__,__b_rename_at_1142_5(0,__context__))),__ln_rename_at_1143_6 * 4);
+    };
+}
+
+inline TArray<int32_t> _Func_lambda_thismodule_7_1Tickfunction_ee42a5afed3609c2 ( Context * __context__, _lambda_thismodule_7_1 &  ____this_rename_at_7_7 )
+{
+    TArray<int32_t> _temp_make_local_8_18_2; _temp_make_local_8_18_2;
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14(__context__,das_arg<TArray<int32_t>>::pass((_temp_make_local_8_18_2 = (_FuncbuiltinTickclone_to_moveTick17180087396728260876_845ea85675060ffa(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_7_7.arr)))))));
+}
+
+inline void _Func_lambda_thismodule_7_1Tickfinalizer_26f59f10a5819650 ( Context * __context__, _lambda_thismodule_7_1 * ____this_rename_at_7_8 )
+{
+    finalize_132c841e4382c4a7(__context__,das_arg<_lambda_thismodule_7_1>::pass(das_deref(__context__,____this_rename_at_7_8,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_7_1 *>::clear(__context__,____this_rename_at_7_8);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickclone_to_moveTick17180087396728260876_845ea85675060ffa ( Context * __context__, TArray<int32_t> &  __clone_src_rename_at_1118_9 )
+{
+    TArray<int32_t> __clone_dest_rename_at_1120_10;das_zero(__clone_dest_rename_at_1120_10);
+    _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62(__context__,das_arg<TArray<int32_t>>::pass(__clone_dest_rename_at_1120_10),das_arg<TArray<int32_t>>::pass(__clone_src_rename_at_1118_9));
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__clone_dest_rename_at_1120_10);
+}
+
+inline Lambda DAS_COMMENT((TArray<int32_t>)) Bar_6d7a01fa384609a ( Context * __context__, TArray<int32_t> &  __arr_rename_at_6_11 )
+{
+    return das_auto_cast<Lambda DAS_COMMENT((TArray<int32_t>))>::cast(das_ascend<TArray<int32_t>,_lambda_thismodule_7_1>::make(__context__,&__type_info__dbeb1ccd55230ccd,(([&]() -> _lambda_thismodule_7_1 {
+        _lambda_thismodule_7_1 __mks_7;
+        das_copy((__mks_7.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_7_1`function XS<_lambda_thismodule_7_1>*/ 0xfee662c2aa797607))));
+        das_copy((__mks_7.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_7_1`finalizer X1<S<_lambda_thismodule_7_1>>?*/ 0x81f38f44cd733e50))));
+        das_move((__mks_7.arr),(__arr_rename_at_6_11));
+        return __mks_7;
+    })())));
+}
+
+inline bool test_b9eb03e672d169fe ( Context * __context__ )
+{
+    TArray<int32_t> __l_rename_at_20_12_ConstRef; das_zero(__l_rename_at_20_12_ConstRef); das_move(__l_rename_at_20_12_ConstRef, ((TArray<int32_t>)das_invoke_lambda<TArray<int32_t>>::invoke_cmres(__context__,nullptr,das_global<Foo *,0x2112bf6e7aa9f75b>(__context__) /*foo*/->bar)));
+    TArray<int32_t> const  & __l_rename_at_20_12 = __l_rename_at_20_12_ConstRef;
+;
+    DAS_ASSERT((((__l_rename_at_20_12(0,__context__) == 1) && (__l_rename_at_20_12(1,__context__) == 2)) && (__l_rename_at_20_12(2,__context__) == 3)));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b ( Context * __context__, TDim<int32_t,3> &  __a_rename_at_1502_13 )
+{
+    TArray<int32_t> __arr_rename_at_1504_14;das_zero(__arr_rename_at_1504_14);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_14),3);
+    das_copy(das_cast<TDim<int32_t,3>>::cast(das_ref(__context__,__arr_rename_at_1504_14(0,__context__))),__a_rename_at_1502_13);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_14);
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<TArray<int32_t> &>::from(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14(__context__, arg_a));
+}
+static vec4f __wrap_finalize_132c841e4382c4a7 ( Context * __context__ ) {
+    _lambda_thismodule_7_1 &  arg___this = cast_aot_arg<_lambda_thismodule_7_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_132c841e4382c4a7(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> const  &  arg_b = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_7_1Tickfunction_ee42a5afed3609c2 ( Context * __context__ ) {
+    _lambda_thismodule_7_1 &  arg___this = cast_aot_arg<_lambda_thismodule_7_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _Func_lambda_thismodule_7_1Tickfunction_ee42a5afed3609c2(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_7_1Tickfinalizer_26f59f10a5819650 ( Context * __context__ ) {
+    _lambda_thismodule_7_1 * arg___this = cast_aot_arg<_lambda_thismodule_7_1 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_7_1Tickfinalizer_26f59f10a5819650(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickclone_to_moveTick17180087396728260876_845ea85675060ffa ( Context * __context__ ) {
+    TArray<int32_t> &  arg_clone_src = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickclone_to_moveTick17180087396728260876_845ea85675060ffa(__context__, arg_clone_src);
+    return v_zero();
+}
+static vec4f __wrap_Bar_6d7a01fa384609a ( Context * __context__ ) {
+    TArray<int32_t> &  arg_arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<Lambda DAS_COMMENT((TArray<int32_t>))>::from(Bar_6d7a01fa384609a(__context__, arg_arr));
+}
+static vec4f __wrap_test_b9eb03e672d169fe ( Context * __context__ ) {
+    return cast<bool>::from(test_b9eb03e672d169fe(__context__));
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b ( Context * __context__ ) {
+    TDim<int32_t,3> &  arg_a = cast_aot_arg<TDim<int32_t,3> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xa51a880d594e91fd, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c },
+    { 0x17892cd516a9a747, false, (void*)&_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14, &__wrap__FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 },
+    { 0xd116d6b4fe1d415f, false, (void*)&finalize_132c841e4382c4a7, &__wrap_finalize_132c841e4382c4a7 },
+    { 0xca1141a5df264c9, false, (void*)&_FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62, &__wrap__FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 },
+    { 0x150ca7a45d8c4fa3, true, (void*)&_Func_lambda_thismodule_7_1Tickfunction_ee42a5afed3609c2, &__wrap__Func_lambda_thismodule_7_1Tickfunction_ee42a5afed3609c2 },
+    { 0x1bac3f9f634cd431, false, (void*)&_Func_lambda_thismodule_7_1Tickfinalizer_26f59f10a5819650, &__wrap__Func_lambda_thismodule_7_1Tickfinalizer_26f59f10a5819650 },
+    { 0xf9d06a336bb19150, true, (void*)&_FuncbuiltinTickclone_to_moveTick17180087396728260876_845ea85675060ffa, &__wrap__FuncbuiltinTickclone_to_moveTick17180087396728260876_845ea85675060ffa },
+    { 0x9dd8a133120e24ae, false, (void*)&Bar_6d7a01fa384609a, &__wrap_Bar_6d7a01fa384609a },
+    { 0xc72772286e82dc28, false, (void*)&test_b9eb03e672d169fe, &__wrap_test_b9eb03e672d169fe },
+    { 0x7964cdf0a208493a, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x9a54dd8fc2e55bb4, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_5870759032112329712
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,156 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_3641151976357680255 {
+
+namespace  { struct Foo; };
+// unused enumeration GooEnum
+// unused enumeration OpCode
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+namespace  {
+
+struct Foo {
+    int32_t x;
+    int32_t y;
+    int32_t z;
+    int32_t w;
+};
+static_assert(sizeof(Foo)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,z)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,w)==12,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__411ed0e77075265a;
+extern TypeInfo __type_info__72db460fd725872a;
+
+VarInfo __struct_info__411ed0e77075265a_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xbcd6aabb60c7fbc7), "x", 0, 0 };
+VarInfo __struct_info__411ed0e77075265a_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xbcd6a9bb60c7fa14), "y", 4, 0 };
+VarInfo __struct_info__411ed0e77075265a_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xbcd6acbb60c7ff2d), "z", 8, 0 };
+VarInfo __struct_info__411ed0e77075265a_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xbcd69fbb60c7e916), "w", 12, 0 };
+VarInfo * __struct_info__411ed0e77075265a_fields[4] =  { &__struct_info__411ed0e77075265a_field_0, &__struct_info__411ed0e77075265a_field_1, &__struct_info__411ed0e77075265a_field_2, &__struct_info__411ed0e77075265a_field_3 };
+StructInfo __struct_info__411ed0e77075265a = {"Foo", "", 0, __struct_info__411ed0e77075265a_fields, 4, 16, UINT64_C(0x945b59082c003622), nullptr, UINT64_C(0x411ed0e77075265a), 4 };
+TypeInfo __type_info__72db460fd725872a = { Type::tStructure, &__struct_info__411ed0e77075265a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 286, 16, UINT64_C(0x72db460fd725872a) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__72db460fd725872a };
+
+inline bool test_95c9c1c1b932a563 ( Context * __context__ );
+inline Foo Foo_e433d1a26e8354ba ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_95c9c1c1b932a563 ( Context * __context__ )
+{
+    Foo __f_rename_at_17_0;das_zero(__f_rename_at_17_0);
+    Foo * __q_rename_at_18_1 = ((Foo *)das_cast<Foo *>::cast(das_call_interop<void *>::call(&new_and_init,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<Foo &>::from(__f_rename_at_17_0)))));
+    DAS_ASSERT(((((__q_rename_at_18_1->x == 1) && (__q_rename_at_18_1->y == 2)) && (__q_rename_at_18_1->z == 3)) && (__q_rename_at_18_1->w == 4)));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline Foo Foo_e433d1a26e8354ba ( Context * __context__ )
+{
+    return /* <- */ das_auto_cast_move<Foo>::cast((([&]() -> Foo {
+        Foo __mks_8;
+        das_copy((__mks_8.x),(1));
+        das_copy((__mks_8.y),(2));
+        das_copy((__mks_8.z),(3));
+        das_copy((__mks_8.w),(4));
+        return __mks_8;
+    })()));
+}
+static vec4f __wrap_test_95c9c1c1b932a563 ( Context * __context__ ) {
+    return cast<bool>::from(test_95c9c1c1b932a563(__context__));
+}
+static vec4f __wrap_Foo_e433d1a26e8354ba ( Context * __context__ ) {
+    *((Foo *) __context__->abiCMRES) = Foo_e433d1a26e8354ba(__context__);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x9170207dbb2d9400, false, (void*)&test_95c9c1c1b932a563, &__wrap_test_95c9c1c1b932a563 },
+    { 0x37d2a217346c11cc, true, (void*)&Foo_e433d1a26e8354ba, &__wrap_Foo_e433d1a26e8354ba },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_3641151976357680255
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,527 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_1447191363162010985 {
+
+namespace  { struct SomethingSmall; };
+// unused enumeration ConversionResult
+// unused enumeration GooEnum
+// unused enumeration OpCode
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+namespace  {
+
+struct SomethingSmall {
+    int32_t a;
+    int32_t b;
+    int32_t c;
+};
+static_assert(sizeof(SomethingSmall)==12,"structure size mismatch with DAS");
+static_assert(offsetof(SomethingSmall,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SomethingSmall,b)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(SomethingSmall,c)==8,"structure field offset mismatch with DAS");
+}
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__af63e44c8601fa24;
+
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__af63e44c8601fa24 };
+TypeInfo * __tinfo_1[2] = { &__type_info__af63e44c8601fa24, &__type_info__af90fe4c864e9d52 };
+
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd ( Context * __context__, TArray<int32_t> & __a_rename_at_1336_0 );
+inline void finalize_40f4df43893b2bab ( Context * __context__, SomethingSmall & ____this_rename_at_10_1 );
+inline void _FuncbuiltinTickfinalize_dimTick15578010914474073673_ff86521d63270d42 ( Context * __context__, TDim<TArray<int32_t>,5> & __a_rename_at_1324_2 );
+inline void _FuncbuiltinTickfinalizeTick5454204887383796109_95380cba065ea7d3 ( Context * __context__, TTable<int32_t,int32_t> & __a_rename_at_1347_4 );
+inline void _FuncbuiltinTickfinalize_dimTick15578010914474073673_5c29b7140930c5f5 ( Context * __context__, TDim<SomethingSmall *,10> & __a_rename_at_1324_5 );
+inline void _FuncbuiltinTickfinalize_dimTick15578010914474073673_330070e49bdf72e0 ( Context * __context__, TDim<TestObjectFoo *,10> & __a_rename_at_1324_7 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_68_9, int32_t __newSize_rename_at_68_10 );
+inline void _FuncbuiltinTickinsertTick12964066441666329206_8708a1b09bfda92d ( Context * __context__, TTable<int32_t,int32_t> & __Tab_rename_at_869_11, int32_t __at_rename_at_869_12, int32_t __val_rename_at_869_13 );
+inline void finalize_4407bb154910c985 ( Context * __context__, SomethingSmall * & ____this_rename_at_47_14 );
+inline void _FuncTickda_inscopeTick1309412637957892563_8961d47fba582f27 ( Context * __context__, int32_t __x_rename_at_88_15 );
+inline void test_delete_array_c5bb3eb65d5b664f ( Context * __context__ );
+inline void test_delete_table_4ab9e97279b3a09b ( Context * __context__ );
+inline void test_delete_struct_748697bf7ec3b98e ( Context * __context__ );
+inline void test_delete_struct_array_95bc4db05009f5ca ( Context * __context__ );
+inline void test_delete_handle_8a3640a480c47bc9 ( Context * __context__ );
+inline void test_delete_handle_array_a61ddbc7357e6b5d ( Context * __context__ );
+inline void test_delete_struct_array_in_scope_d7c055df8aa5091 ( Context * __context__ );
+inline void test_delete_string_171143692d0e0e63 ( Context * __context__ );
+inline void test_delete_string_array_86610d36b1c472cc ( Context * __context__ );
+inline bool test_339398e0db4aef7b ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd ( Context * __context__, TArray<int32_t> &  __a_rename_at_1336_0 )
+{
+    builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_1336_0),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void finalize_40f4df43893b2bab ( Context * __context__, SomethingSmall &  ____this_rename_at_10_1 )
+{
+    memset((void*)&(____this_rename_at_10_1), 0, 12);
+}
+
+inline void _FuncbuiltinTickfinalize_dimTick15578010914474073673_ff86521d63270d42 ( Context * __context__, TDim<TArray<int32_t>,5> &  __a_rename_at_1324_2 )
+{
+    {
+        bool __need_loop_1326 = true;
+        // aV: array<int> aka TT&
+        das_iterator<TDim<TArray<int32_t>,5>> __aV_iterator(__a_rename_at_1324_2);
+        TArray<int32_t> * __aV_rename_at_1326_3;
+        __need_loop_1326 = __aV_iterator.first(__context__,(__aV_rename_at_1326_3)) && __need_loop_1326;
+        for ( ; __need_loop_1326 ; __need_loop_1326 = __aV_iterator.next(__context__,(__aV_rename_at_1326_3)) )
+        {
+            _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd(__context__,das_arg<TArray<int32_t>>::pass((*__aV_rename_at_1326_3)));
+        }
+        __aV_iterator.close(__context__,(__aV_rename_at_1326_3));
+    };
+}
+
+inline void _FuncbuiltinTickfinalizeTick5454204887383796109_95380cba065ea7d3 ( Context * __context__, TTable<int32_t,int32_t> &  __a_rename_at_1347_4 )
+{
+    builtin_table_free(das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_1347_4),4,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickfinalize_dimTick15578010914474073673_5c29b7140930c5f5 ( Context * __context__, TDim<SomethingSmall *,10> &  __a_rename_at_1324_5 )
+{
+    {
+        bool __need_loop_1326 = true;
+        // aV: SomethingSmall? aka TT&
+        das_iterator<TDim<SomethingSmall *,10>> __aV_iterator(__a_rename_at_1324_5);
+        SomethingSmall * * __aV_rename_at_1326_6;
+        __need_loop_1326 = __aV_iterator.first(__context__,(__aV_rename_at_1326_6)) && __need_loop_1326;
+        for ( ; __need_loop_1326 ; __need_loop_1326 = __aV_iterator.next(__context__,(__aV_rename_at_1326_6)) )
+        {
+            finalize_4407bb154910c985(__context__,(*__aV_rename_at_1326_6));
+        }
+        __aV_iterator.close(__context__,(__aV_rename_at_1326_6));
+    };
+}
+
+inline void _FuncbuiltinTickfinalize_dimTick15578010914474073673_330070e49bdf72e0 ( Context * __context__, TDim<TestObjectFoo *,10> &  __a_rename_at_1324_7 )
+{
+    {
+        bool __need_loop_1326 = true;
+        // aV: UnitTest::TestObjectFoo? aka TT&
+        das_iterator<TDim<TestObjectFoo *,10>> __aV_iterator(__a_rename_at_1324_7);
+        TestObjectFoo * * __aV_rename_at_1326_8;
+        __need_loop_1326 = __aV_iterator.first(__context__,(__aV_rename_at_1326_8)) && __need_loop_1326;
+        for ( ; __need_loop_1326 ; __need_loop_1326 = __aV_iterator.next(__context__,(__aV_rename_at_1326_8)) )
+        {
+            das_delete_handle<TestObjectFoo *>::clear(__context__,(*__aV_rename_at_1326_8));
+        }
+        __aV_iterator.close(__context__,(__aV_rename_at_1326_8));
+    };
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_68_9, int32_t __newSize_rename_at_68_10 )
+{
+    builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_68_9),__newSize_rename_at_68_10,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickinsertTick12964066441666329206_8708a1b09bfda92d ( Context * __context__, TTable<int32_t,int32_t> &  __Tab_rename_at_869_11, int32_t __at_rename_at_869_12, int32_t __val_rename_at_869_13 )
+{
+    das_copy(__Tab_rename_at_869_11(__at_rename_at_869_12,__context__),__val_rename_at_869_13);
+}
+
+inline void finalize_4407bb154910c985 ( Context * __context__, SomethingSmall * & ____this_rename_at_47_14 )
+{
+    if ( ____this_rename_at_47_14 != nullptr )
+    {
+        finalize_40f4df43893b2bab(__context__,das_arg<SomethingSmall>::pass(das_deref(__context__,____this_rename_at_47_14,__FILE__,__LINE__)));
+        das_delete<SomethingSmall *>::clear(__context__,____this_rename_at_47_14);
+        das_copy(____this_rename_at_47_14,nullptr);
+    };
+}
+
+inline void _FuncTickda_inscopeTick1309412637957892563_8961d47fba582f27 ( Context * __context__, int32_t __x_rename_at_88_15 )
+{
+    SomethingSmall * __b_rename_at_89_16; memset((void*)&__b_rename_at_89_16,0,sizeof(__b_rename_at_89_16));
+    TDim<SomethingSmall *,10> __a_rename_at_90_17; memset((void*)&__a_rename_at_90_17,0,sizeof(__a_rename_at_90_17));
+    /* finally */ auto __finally_88= das_finally([&](){
+    _FuncbuiltinTickfinalize_dimTick15578010914474073673_5c29b7140930c5f5(__context__,das_arg<TDim<SomethingSmall *,10>>::pass(__a_rename_at_90_17));
+    finalize_4407bb154910c985(__context__,__b_rename_at_89_16);
+    /* end finally */ });
+    __b_rename_at_89_16 = das_new<SomethingSmall>::make(__context__);
+    __a_rename_at_90_17 = das_new_dim<SomethingSmall,10>::make(__context__);
+    das_copy(__b_rename_at_89_16->a,__x_rename_at_88_15);
+    {
+        bool __need_loop_92 = true;
+        // pA: SomethingSmall?&
+        das_iterator<TDim<SomethingSmall *,10>> __pA_iterator(__a_rename_at_90_17);
+        SomethingSmall * * __pA_rename_at_92_18;
+        __need_loop_92 = __pA_iterator.first(__context__,(__pA_rename_at_92_18)) && __need_loop_92;
+        for ( ; __need_loop_92 ; __need_loop_92 = __pA_iterator.next(__context__,(__pA_rename_at_92_18)) )
+        {
+            das_copy((*__pA_rename_at_92_18)->a,__x_rename_at_88_15);
+        }
+        __pA_iterator.close(__context__,(__pA_rename_at_92_18));
+    };
+}
+
+inline void test_delete_array_c5bb3eb65d5b664f ( Context * __context__ )
+{
+    TDim<TArray<int32_t>,5> __a_rename_at_15_19;das_zero(__a_rename_at_15_19);
+    uint64_t __w0_rename_at_16_20 = ((uint64_t)heap_bytes_allocated(__context__));
+    {
+        bool __need_loop_17 = true;
+        // t: int const
+        das_iterator<range> __t_iterator(range(0,5));
+        int32_t __t_rename_at_17_21;
+        __need_loop_17 = __t_iterator.first(__context__,(__t_rename_at_17_21)) && __need_loop_17;
+        for ( ; __need_loop_17 ; __need_loop_17 = __t_iterator.next(__context__,(__t_rename_at_17_21)) )
+        {
+            _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_15_19(__t_rename_at_17_21,__context__)),10);
+        }
+        __t_iterator.close(__context__,(__t_rename_at_17_21));
+    };
+    uint64_t __w1_rename_at_20_22 = ((uint64_t)heap_bytes_allocated(__context__));
+    _FuncbuiltinTickfinalize_dimTick15578010914474073673_ff86521d63270d42(__context__,das_arg<TDim<TArray<int32_t>,5>>::pass(__a_rename_at_15_19));
+    uint64_t __w2_rename_at_22_23 = ((uint64_t)heap_bytes_allocated(__context__));
+    DAS_ASSERT(((__w1_rename_at_20_22 > __w0_rename_at_16_20) && (__w0_rename_at_16_20 == __w2_rename_at_22_23)));
+    {
+        bool __need_loop_24 = true;
+        // t: int const
+        das_iterator<range> __t_iterator(range(0,5));
+        int32_t __t_rename_at_24_24;
+        __need_loop_24 = __t_iterator.first(__context__,(__t_rename_at_24_24)) && __need_loop_24;
+        for ( ; __need_loop_24 ; __need_loop_24 = __t_iterator.next(__context__,(__t_rename_at_24_24)) )
+        {
+            DAS_ASSERT(((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_15_19(__t_rename_at_24_24,__context__))) == 0) && (builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__a_rename_at_15_19(__t_rename_at_24_24,__context__))) == 0)));
+        }
+        __t_iterator.close(__context__,(__t_rename_at_24_24));
+    };
+}
+
+inline void test_delete_table_4ab9e97279b3a09b ( Context * __context__ )
+{
+    TTable<int32_t,int32_t> __a_rename_at_30_25;das_zero(__a_rename_at_30_25);
+    uint64_t __w0_rename_at_31_26 = ((uint64_t)heap_bytes_allocated(__context__));
+    _FuncbuiltinTickinsertTick12964066441666329206_8708a1b09bfda92d(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_30_25),0,1);
+    _FuncbuiltinTickinsertTick12964066441666329206_8708a1b09bfda92d(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_30_25),1,2);
+    uint64_t __w1_rename_at_34_27 = ((uint64_t)heap_bytes_allocated(__context__));
+    _FuncbuiltinTickfinalizeTick5454204887383796109_95380cba065ea7d3(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_30_25));
+    uint64_t __w2_rename_at_36_28 = ((uint64_t)heap_bytes_allocated(__context__));
+    DAS_ASSERT(((__w1_rename_at_34_27 > __w0_rename_at_31_26) && (__w0_rename_at_31_26 == __w2_rename_at_36_28)));
+    DAS_ASSERT(((builtin_table_size(das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_30_25)) == 0) && (builtin_table_capacity(das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_30_25)) == 0)));
+}
+
+inline void test_delete_struct_748697bf7ec3b98e ( Context * __context__ )
+{
+    SomethingSmall * __a_rename_at_42_29 = 0;
+    uint64_t __w0_rename_at_43_30 = ((uint64_t)heap_bytes_allocated(__context__));
+    das_copy(__a_rename_at_42_29,das_new<SomethingSmall>::make(__context__));
+    uint64_t __w1_rename_at_45_31 = ((uint64_t)heap_bytes_allocated(__context__));
+    finalize_4407bb154910c985(__context__,__a_rename_at_42_29);
+    uint64_t __w2_rename_at_49_32 = ((uint64_t)heap_bytes_allocated(__context__));
+    DAS_ASSERT(((__w1_rename_at_45_31 > __w0_rename_at_43_30) && (__w0_rename_at_43_30 == __w2_rename_at_49_32)));
+    DAS_ASSERT((__a_rename_at_42_29 == nullptr));
+}
+
+inline void test_delete_struct_array_95bc4db05009f5ca ( Context * __context__ )
+{
+    uint64_t __w0_rename_at_55_33 = ((uint64_t)heap_bytes_allocated(__context__));
+    TDim<SomethingSmall *,10> __a_rename_at_56_34 = das_new_dim<SomethingSmall,10>::make(__context__);
+    uint64_t __w1_rename_at_57_35 = ((uint64_t)heap_bytes_allocated(__context__));
+    _FuncbuiltinTickfinalize_dimTick15578010914474073673_5c29b7140930c5f5(__context__,das_arg<TDim<SomethingSmall *,10>>::pass(__a_rename_at_56_34));
+    uint64_t __w2_rename_at_61_36 = ((uint64_t)heap_bytes_allocated(__context__));
+    DAS_ASSERT(((__w1_rename_at_57_35 > __w0_rename_at_55_33) && (__w0_rename_at_55_33 == __w2_rename_at_61_36)));
+    {
+        bool __need_loop_63 = true;
+        // pA: SomethingSmall?&
+        das_iterator<TDim<SomethingSmall *,10>> __pA_iterator(__a_rename_at_56_34);
+        SomethingSmall * * __pA_rename_at_63_37;
+        __need_loop_63 = __pA_iterator.first(__context__,(__pA_rename_at_63_37)) && __need_loop_63;
+        for ( ; __need_loop_63 ; __need_loop_63 = __pA_iterator.next(__context__,(__pA_rename_at_63_37)) )
+        {
+            DAS_ASSERT(((*__pA_rename_at_63_37) == nullptr));
+        }
+        __pA_iterator.close(__context__,(__pA_rename_at_63_37));
+    };
+}
+
+inline void test_delete_handle_8a3640a480c47bc9 ( Context * __context__ )
+{
+    TestObjectFoo * __a_rename_at_69_38 = 0;
+    das_copy(__a_rename_at_69_38,das_new_handle<TestObjectFoo,false>::make(__context__));
+    das_delete_handle<TestObjectFoo *>::clear(__context__,__a_rename_at_69_38);
+    DAS_ASSERT((__a_rename_at_69_38 == nullptr));
+}
+
+inline void test_delete_handle_array_a61ddbc7357e6b5d ( Context * __context__ )
+{
+    TDim<TestObjectFoo *,10> __a_rename_at_78_39 = das_new_dim_handle<TestObjectFoo,10,false>::make(__context__);
+    _FuncbuiltinTickfinalize_dimTick15578010914474073673_330070e49bdf72e0(__context__,das_arg<TDim<TestObjectFoo *,10>>::pass(__a_rename_at_78_39));
+    {
+        bool __need_loop_82 = true;
+        // pA: UnitTest::TestObjectFoo?&
+        das_iterator<TDim<TestObjectFoo *,10>> __pA_iterator(__a_rename_at_78_39);
+        TestObjectFoo * * __pA_rename_at_82_40;
+        __need_loop_82 = __pA_iterator.first(__context__,(__pA_rename_at_82_40)) && __need_loop_82;
+        for ( ; __need_loop_82 ; __need_loop_82 = __pA_iterator.next(__context__,(__pA_rename_at_82_40)) )
+        {
+            DAS_ASSERT(((*__pA_rename_at_82_40) == nullptr));
+        }
+        __pA_iterator.close(__context__,(__pA_rename_at_82_40));
+    };
+}
+
+inline void test_delete_struct_array_in_scope_d7c055df8aa5091 ( Context * __context__ )
+{
+    uint64_t __w0_rename_at_103_41 = ((uint64_t)heap_bytes_allocated(__context__));
+    _FuncTickda_inscopeTick1309412637957892563_8961d47fba582f27(__context__,2);
+    uint64_t __w1_rename_at_105_42 = ((uint64_t)heap_bytes_allocated(__context__));
+    DAS_ASSERT((__w0_rename_at_103_41 == __w1_rename_at_105_42));
+}
+
+inline void test_delete_string_171143692d0e0e63 ( Context * __context__ )
+{
+    uint64_t __w0_rename_at_111_43 = ((uint64_t)heap_bytes_allocated(__context__));
+    char * __a_rename_at_112_44 = (char *)(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<int32_t>::from(das_deref(__context__,getPtr(),__FILE__,__LINE__)))));
+    delete_string(__a_rename_at_112_44,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    uint64_t __w1_rename_at_117_45 = ((uint64_t)heap_bytes_allocated(__context__));
+    DAS_ASSERT((__w0_rename_at_111_43 == __w1_rename_at_117_45));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_112_44),cast<char *>::from(nullptr),*__context__,nullptr)));
+}
+
+inline void test_delete_string_array_86610d36b1c472cc ( Context * __context__ )
+{
+    uint64_t __w0_rename_at_124_46 = ((uint64_t)heap_bytes_allocated(__context__));
+    TDim<char *,3> __a_rename_at_125_47 = (([&]() -> TDim<char *,3> {
+        TDim<char *,3> __mka_125;
+        __mka_125(0,__context__) = das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_1, cast<int32_t>::from(das_deref(__context__,getPtr(),__FILE__,__LINE__)), cast<char * const >::from(((char *) "_1"))));
+        __mka_125(1,__context__) = das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_1, cast<int32_t>::from(das_deref(__context__,getPtr(),__FILE__,__LINE__)), cast<char * const >::from(((char *) "_2"))));
+        __mka_125(2,__context__) = das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_1, cast<int32_t>::from(das_deref(__context__,getPtr(),__FILE__,__LINE__)), cast<char * const >::from(((char *) "_3"))));
+        return __mka_125;
+    })());
+    {
+        bool __need_loop_126 = true;
+        // AA: string&
+        das_iterator<TDim<char *,3>> __AA_iterator(__a_rename_at_125_47);
+        char * * __AA_rename_at_126_48;
+        __need_loop_126 = __AA_iterator.first(__context__,(__AA_rename_at_126_48)) && __need_loop_126;
+        for ( ; __need_loop_126 ; __need_loop_126 = __AA_iterator.next(__context__,(__AA_rename_at_126_48)) )
+        {
+            delete_string((*__AA_rename_at_126_48),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        }
+        __AA_iterator.close(__context__,(__AA_rename_at_126_48));
+    };
+    uint64_t __w1_rename_at_131_49 = ((uint64_t)heap_bytes_allocated(__context__));
+    DAS_ASSERT((__w0_rename_at_124_46 == __w1_rename_at_131_49));
+}
+
+inline bool test_339398e0db4aef7b ( Context * __context__ )
+{
+    test_delete_struct_array_in_scope_d7c055df8aa5091(__context__);
+    test_delete_handle_8a3640a480c47bc9(__context__);
+    test_delete_handle_array_a61ddbc7357e6b5d(__context__);
+    test_delete_struct_748697bf7ec3b98e(__context__);
+    test_delete_struct_array_95bc4db05009f5ca(__context__);
+    test_delete_array_c5bb3eb65d5b664f(__context__);
+    test_delete_table_4ab9e97279b3a09b(__context__);
+    test_delete_string_171143692d0e0e63(__context__);
+    test_delete_string_array_86610d36b1c472cc(__context__);
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap_finalize_40f4df43893b2bab ( Context * __context__ ) {
+    SomethingSmall &  arg___this = cast_aot_arg<SomethingSmall & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_40f4df43893b2bab(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickfinalize_dimTick15578010914474073673_ff86521d63270d42 ( Context * __context__ ) {
+    TDim<TArray<int32_t>,5> &  arg_a = cast_aot_arg<TDim<TArray<int32_t>,5> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickfinalize_dimTick15578010914474073673_ff86521d63270d42(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickfinalizeTick5454204887383796109_95380cba065ea7d3 ( Context * __context__ ) {
+    TTable<int32_t,int32_t> &  arg_a = cast_aot_arg<TTable<int32_t,int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickfinalizeTick5454204887383796109_95380cba065ea7d3(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickfinalize_dimTick15578010914474073673_5c29b7140930c5f5 ( Context * __context__ ) {
+    TDim<SomethingSmall *,10> &  arg_a = cast_aot_arg<TDim<SomethingSmall *,10> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickfinalize_dimTick15578010914474073673_5c29b7140930c5f5(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickfinalize_dimTick15578010914474073673_330070e49bdf72e0 ( Context * __context__ ) {
+    TDim<TestObjectFoo *,10> &  arg_a = cast_aot_arg<TDim<TestObjectFoo *,10> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickfinalize_dimTick15578010914474073673_330070e49bdf72e0(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickinsertTick12964066441666329206_8708a1b09bfda92d ( Context * __context__ ) {
+    TTable<int32_t,int32_t> &  arg_Tab = cast_aot_arg<TTable<int32_t,int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_at = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_val = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    _FuncbuiltinTickinsertTick12964066441666329206_8708a1b09bfda92d(__context__, arg_Tab, arg_at, arg_val);
+    return v_zero();
+}
+static vec4f __wrap_finalize_4407bb154910c985 ( Context * __context__ ) {
+    SomethingSmall * & arg___this = cast_aot_arg<SomethingSmall * &>::to(*__context__,__context__->abiArguments()[0]);
+    finalize_4407bb154910c985(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickda_inscopeTick1309412637957892563_8961d47fba582f27 ( Context * __context__ ) {
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickda_inscopeTick1309412637957892563_8961d47fba582f27(__context__, arg_x);
+    return v_zero();
+}
+static vec4f __wrap_test_delete_array_c5bb3eb65d5b664f ( Context * __context__ ) {
+    test_delete_array_c5bb3eb65d5b664f(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_delete_table_4ab9e97279b3a09b ( Context * __context__ ) {
+    test_delete_table_4ab9e97279b3a09b(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_delete_struct_748697bf7ec3b98e ( Context * __context__ ) {
+    test_delete_struct_748697bf7ec3b98e(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_delete_struct_array_95bc4db05009f5ca ( Context * __context__ ) {
+    test_delete_struct_array_95bc4db05009f5ca(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_delete_handle_8a3640a480c47bc9 ( Context * __context__ ) {
+    test_delete_handle_8a3640a480c47bc9(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_delete_handle_array_a61ddbc7357e6b5d ( Context * __context__ ) {
+    test_delete_handle_array_a61ddbc7357e6b5d(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_delete_struct_array_in_scope_d7c055df8aa5091 ( Context * __context__ ) {
+    test_delete_struct_array_in_scope_d7c055df8aa5091(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_delete_string_171143692d0e0e63 ( Context * __context__ ) {
+    test_delete_string_171143692d0e0e63(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_delete_string_array_86610d36b1c472cc ( Context * __context__ ) {
+    test_delete_string_array_86610d36b1c472cc(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_339398e0db4aef7b ( Context * __context__ ) {
+    return cast<bool>::from(test_339398e0db4aef7b(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x84908fa671ce3a30, false, (void*)&_FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd, &__wrap__FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd },
+    { 0xca70a496e3fc7e68, false, (void*)&finalize_40f4df43893b2bab, &__wrap_finalize_40f4df43893b2bab },
+    { 0x234574549cc44422, false, (void*)&_FuncbuiltinTickfinalize_dimTick15578010914474073673_ff86521d63270d42, &__wrap__FuncbuiltinTickfinalize_dimTick15578010914474073673_ff86521d63270d42 },
+    { 0xf4fe2d8abea19ced, false, (void*)&_FuncbuiltinTickfinalizeTick5454204887383796109_95380cba065ea7d3, &__wrap__FuncbuiltinTickfinalizeTick5454204887383796109_95380cba065ea7d3 },
+    { 0xebc3569b5ccbafb4, false, (void*)&_FuncbuiltinTickfinalize_dimTick15578010914474073673_5c29b7140930c5f5, &__wrap__FuncbuiltinTickfinalize_dimTick15578010914474073673_5c29b7140930c5f5 },
+    { 0xe9bfbc42bf6c0e32, false, (void*)&_FuncbuiltinTickfinalize_dimTick15578010914474073673_330070e49bdf72e0, &__wrap__FuncbuiltinTickfinalize_dimTick15578010914474073673_330070e49bdf72e0 },
+    { 0xa51a880d594e91fd, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c },
+    { 0x55a19774d7650c5, false, (void*)&_FuncbuiltinTickinsertTick12964066441666329206_8708a1b09bfda92d, &__wrap__FuncbuiltinTickinsertTick12964066441666329206_8708a1b09bfda92d },
+    { 0xdcdab0965cb87049, false, (void*)&finalize_4407bb154910c985, &__wrap_finalize_4407bb154910c985 },
+    { 0x91ea3e7081392a54, false, (void*)&_FuncTickda_inscopeTick1309412637957892563_8961d47fba582f27, &__wrap__FuncTickda_inscopeTick1309412637957892563_8961d47fba582f27 },
+    { 0xc0bac64bd58c00be, false, (void*)&test_delete_array_c5bb3eb65d5b664f, &__wrap_test_delete_array_c5bb3eb65d5b664f },
+    { 0xc0adda41f8c212f7, false, (void*)&test_delete_table_4ab9e97279b3a09b, &__wrap_test_delete_table_4ab9e97279b3a09b },
+    { 0xf9dccc8d6b9f2ba6, false, (void*)&test_delete_struct_748697bf7ec3b98e, &__wrap_test_delete_struct_748697bf7ec3b98e },
+    { 0xcd3df7b2aabea78a, false, (void*)&test_delete_struct_array_95bc4db05009f5ca, &__wrap_test_delete_struct_array_95bc4db05009f5ca },
+    { 0x27c5c6266e33874f, false, (void*)&test_delete_handle_8a3640a480c47bc9, &__wrap_test_delete_handle_8a3640a480c47bc9 },
+    { 0xab3e4189ea3d1648, false, (void*)&test_delete_handle_array_a61ddbc7357e6b5d, &__wrap_test_delete_handle_array_a61ddbc7357e6b5d },
+    { 0x723aa5d812cbc649, false, (void*)&test_delete_struct_array_in_scope_d7c055df8aa5091, &__wrap_test_delete_struct_array_in_scope_d7c055df8aa5091 },
+    { 0x726e6ce0e9133051, false, (void*)&test_delete_string_171143692d0e0e63, &__wrap_test_delete_string_171143692d0e0e63 },
+    { 0x4c6be552fdd8feee, false, (void*)&test_delete_string_array_86610d36b1c472cc, &__wrap_test_delete_string_array_86610d36b1c472cc },
+    { 0xcf3c04a890cebdff, false, (void*)&test_339398e0db4aef7b, &__wrap_test_339398e0db4aef7b },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_1447191363162010985
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,225 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_6390743809649991141 {
+
+namespace  { struct Ball; };
+namespace  {
+
+struct Ball {
+    float3 center;
+    float radius;
+};
+static_assert(sizeof(Ball)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Ball,center)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Ball,radius)==12,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void finalize_7e3167b457073582 ( Context * __context__, Ball & ____this_rename_at_5_0 );
+inline void _FuncbuiltinTickfinalize_dimTick15578010914474073673_d28e978e29d8270a ( Context * __context__, TDim<Ball *,3> & __a_rename_at_1324_1 );
+inline void finalize_722d8f591c9d9e37 ( Context * __context__, Ball * & ____this_rename_at_32_3 );
+inline Ball Ball_c74349a65cdb7b3e ( Context * __context__, float3 __center_rename_at_10_4, float __radius_rename_at_10_5 );
+inline bool test_623b036290b9dfc9 ( Context * __context__ );
+inline Ball Ball_21d9f357f1916bb0 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void finalize_7e3167b457073582 ( Context * __context__, Ball &  ____this_rename_at_5_0 )
+{
+    memset((void*)&(____this_rename_at_5_0), 0, 16);
+}
+
+inline void _FuncbuiltinTickfinalize_dimTick15578010914474073673_d28e978e29d8270a ( Context * __context__, TDim<Ball *,3> &  __a_rename_at_1324_1 )
+{
+    {
+        bool __need_loop_1326 = true;
+        // aV: Ball? aka TT&
+        das_iterator<TDim<Ball *,3>> __aV_iterator(__a_rename_at_1324_1);
+        Ball * * __aV_rename_at_1326_2;
+        __need_loop_1326 = __aV_iterator.first(__context__,(__aV_rename_at_1326_2)) && __need_loop_1326;
+        for ( ; __need_loop_1326 ; __need_loop_1326 = __aV_iterator.next(__context__,(__aV_rename_at_1326_2)) )
+        {
+            finalize_722d8f591c9d9e37(__context__,(*__aV_rename_at_1326_2));
+        }
+        __aV_iterator.close(__context__,(__aV_rename_at_1326_2));
+    };
+}
+
+inline void finalize_722d8f591c9d9e37 ( Context * __context__, Ball * & ____this_rename_at_32_3 )
+{
+    if ( ____this_rename_at_32_3 != nullptr )
+    {
+        finalize_7e3167b457073582(__context__,das_arg<Ball>::pass(das_deref(__context__,____this_rename_at_32_3,__FILE__,__LINE__)));
+        das_delete<Ball *>::clear(__context__,____this_rename_at_32_3);
+        das_copy(____this_rename_at_32_3,nullptr);
+    };
+}
+
+inline Ball Ball_c74349a65cdb7b3e ( Context * __context__, float3 __center_rename_at_10_4, float __radius_rename_at_10_5 )
+{
+    Ball __b_rename_at_11_6;das_zero(__b_rename_at_11_6);
+    das_copy(__b_rename_at_11_6.center,__center_rename_at_10_4);
+    das_copy(__b_rename_at_11_6.radius,__radius_rename_at_10_5);
+    return das_auto_cast_ref<Ball>::cast(__b_rename_at_11_6);
+}
+
+inline bool test_623b036290b9dfc9 ( Context * __context__ )
+{
+    Ball * __b0_rename_at_19_7; memset((void*)&__b0_rename_at_19_7,0,sizeof(__b0_rename_at_19_7));
+    Ball * __b1_rename_at_21_8; memset((void*)&__b1_rename_at_21_8,0,sizeof(__b1_rename_at_21_8));
+    Ball * __b2_rename_at_23_9; memset((void*)&__b2_rename_at_23_9,0,sizeof(__b2_rename_at_23_9));
+    TDim<Ball *,3> __b3_rename_at_25_10; memset((void*)&__b3_rename_at_25_10,0,sizeof(__b3_rename_at_25_10));
+    /* finally */ auto __finally_18= das_finally([&](){
+    finalize_722d8f591c9d9e37(__context__,__b0_rename_at_19_7);
+    finalize_722d8f591c9d9e37(__context__,__b1_rename_at_21_8);
+    finalize_722d8f591c9d9e37(__context__,__b2_rename_at_23_9);
+    _FuncbuiltinTickfinalize_dimTick15578010914474073673_d28e978e29d8270a(__context__,das_arg<TDim<Ball *,3>>::pass(__b3_rename_at_25_10));
+    /* end finally */ });
+    __b0_rename_at_19_7 = das_new<Ball>::make(__context__);
+    DAS_ASSERT(((SimPolicy<float3>::Equ(__b0_rename_at_19_7->center,v_zero(),*__context__,nullptr)) && (__b0_rename_at_19_7->radius == 0.000000e+00f)));
+    __b1_rename_at_21_8 = das_new<Ball>::make_and_init(__context__,[&]() { return Ball_21d9f357f1916bb0(__context__); });
+    DAS_ASSERT(((SimPolicy<float3>::Equ(__b1_rename_at_21_8->center,v_make_vec4f(7.000000e+00f,8.000000e+00f,9.000000e+00f,0.f),*__context__,nullptr)) && (__b1_rename_at_21_8->radius == 1.234000e+00f)));
+    __b2_rename_at_23_9 = das_new<Ball>::make_and_init(__context__,[&]() { return Ball_c74349a65cdb7b3e(__context__,v_make_vec4f(1.000000e+00f,2.000000e+00f,3.000000e+00f,0.f),4.000000e+00f); });
+    DAS_ASSERT(((SimPolicy<float3>::Equ(__b2_rename_at_23_9->center,v_make_vec4f(1.000000e+00f,2.000000e+00f,3.000000e+00f,0.f),*__context__,nullptr)) && (__b2_rename_at_23_9->radius == 4.000000e+00f)));
+    __b3_rename_at_25_10 = das_new_dim<Ball,3>::make_and_init(__context__,[&]() { return Ball_c74349a65cdb7b3e(__context__,v_make_vec4f(3.000000e+00f,2.000000e+00f,1.000000e+00f,0.f),5.000000e-01f); });
+    {
+        bool __need_loop_26 = true;
+        // b: Ball?&
+        das_iterator<TDim<Ball *,3>> __b_iterator(__b3_rename_at_25_10);
+        Ball * * __b_rename_at_26_11;
+        __need_loop_26 = __b_iterator.first(__context__,(__b_rename_at_26_11)) && __need_loop_26;
+        for ( ; __need_loop_26 ; __need_loop_26 = __b_iterator.next(__context__,(__b_rename_at_26_11)) )
+        {
+            DAS_ASSERT(((SimPolicy<float3>::Equ((*__b_rename_at_26_11)->center,v_make_vec4f(3.000000e+00f,2.000000e+00f,1.000000e+00f,0.f),*__context__,nullptr)) && ((*__b_rename_at_26_11)->radius == 5.000000e-01f)));
+        }
+        __b_iterator.close(__context__,(__b_rename_at_26_11));
+    };
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline Ball Ball_21d9f357f1916bb0 ( Context * __context__ )
+{
+    return /* <- */ das_auto_cast_move<Ball>::cast((([&]() -> Ball {
+        Ball __mks_5;
+        das_copy((__mks_5.center),(v_make_vec4f(7.000000e+00f,8.000000e+00f,9.000000e+00f,0.f)));
+        das_copy((__mks_5.radius),(1.234000e+00f));
+        return __mks_5;
+    })()));
+}
+static vec4f __wrap_finalize_7e3167b457073582 ( Context * __context__ ) {
+    Ball &  arg___this = cast_aot_arg<Ball & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_7e3167b457073582(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickfinalize_dimTick15578010914474073673_d28e978e29d8270a ( Context * __context__ ) {
+    TDim<Ball *,3> &  arg_a = cast_aot_arg<TDim<Ball *,3> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickfinalize_dimTick15578010914474073673_d28e978e29d8270a(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap_finalize_722d8f591c9d9e37 ( Context * __context__ ) {
+    Ball * & arg___this = cast_aot_arg<Ball * &>::to(*__context__,__context__->abiArguments()[0]);
+    finalize_722d8f591c9d9e37(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_Ball_c74349a65cdb7b3e ( Context * __context__ ) {
+    float3 arg_center = cast_aot_arg<float3>::to(*__context__,__context__->abiArguments()[0]);
+    float arg_radius = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[1]);
+    *((Ball *) __context__->abiCMRES) = Ball_c74349a65cdb7b3e(__context__, arg_center, arg_radius);
+    return v_zero();
+}
+static vec4f __wrap_test_623b036290b9dfc9 ( Context * __context__ ) {
+    return cast<bool>::from(test_623b036290b9dfc9(__context__));
+}
+static vec4f __wrap_Ball_21d9f357f1916bb0 ( Context * __context__ ) {
+    *((Ball *) __context__->abiCMRES) = Ball_21d9f357f1916bb0(__context__);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x5a5155d2dd7c7609, false, (void*)&finalize_7e3167b457073582, &__wrap_finalize_7e3167b457073582 },
+    { 0xc3c6e808d7114b26, false, (void*)&_FuncbuiltinTickfinalize_dimTick15578010914474073673_d28e978e29d8270a, &__wrap__FuncbuiltinTickfinalize_dimTick15578010914474073673_d28e978e29d8270a },
+    { 0x165db29ecb6db71c, false, (void*)&finalize_722d8f591c9d9e37, &__wrap_finalize_722d8f591c9d9e37 },
+    { 0x179f3cd1a77e13d2, true, (void*)&Ball_c74349a65cdb7b3e, &__wrap_Ball_c74349a65cdb7b3e },
+    { 0xf9dc5a8b0b9acb25, false, (void*)&test_623b036290b9dfc9, &__wrap_test_623b036290b9dfc9 },
+    { 0xbeeb306ef3ba078d, true, (void*)&Ball_21d9f357f1916bb0, &__wrap_Ball_21d9f357f1916bb0 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_6390743809649991141
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,157 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_17508375240914123542 {
+
+namespace  { struct NullEvent; };
+// unused enumeration GooEnum
+// unused enumeration OpCode
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+namespace  {
+
+struct NullEvent {
+    uint64_t eventType;
+    uint16_t eventSize;
+    uint16_t eventFlags;
+};
+static_assert(sizeof(NullEvent)==16,"structure size mismatch with DAS");
+static_assert(offsetof(NullEvent,eventType)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(NullEvent,eventSize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(NullEvent,eventFlags)==10,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncTick_builtin_send_blobeventTick17273883841174184937_3e497d48ce1bd56c ( Context * __context__, int32_t __eid_rename_at_15_0, NullEvent const  & __evt_rename_at_15_1, char * const  __evt_name_rename_at_15_2 );
+inline void _FuncTicksendEventTick18244153492460886057_4f0c57c04e4b5549 ( Context * __context__, int32_t __eid_rename_at_24_3, NullEvent & __evt_rename_at_24_4 );
+inline bool test_8563dc4c6d00cdd5 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncTick_builtin_send_blobeventTick17273883841174184937_3e497d48ce1bd56c ( Context * __context__, int32_t __eid_rename_at_15_0, NullEvent const  &  __evt_rename_at_15_1, char * const  __evt_name_rename_at_15_2 )
+{
+}
+
+inline void _FuncTicksendEventTick18244153492460886057_4f0c57c04e4b5549 ( Context * __context__, int32_t __eid_rename_at_24_3, NullEvent &  __evt_rename_at_24_4 )
+{
+    das_copy(__evt_rename_at_24_4.eventType,UINT64_C(0x77b70789d0a91b57));
+    das_copy(__evt_rename_at_24_4.eventSize,0x10);
+    DAS_ASSERT((int32_t(__evt_rename_at_24_4.eventFlags) == 0));
+    _FuncTick_builtin_send_blobeventTick17273883841174184937_3e497d48ce1bd56c(__context__,__eid_rename_at_24_3,das_arg<NullEvent>::pass(__evt_rename_at_24_4),((char *) "NullEvent"));
+}
+
+inline bool test_8563dc4c6d00cdd5 ( Context * __context__ )
+{
+    NullEvent _temp_make_local_42_18_0; _temp_make_local_42_18_0;
+    _FuncTicksendEventTick18244153492460886057_4f0c57c04e4b5549(__context__,13,das_arg<NullEvent>::pass((([&]() -> NullEvent& {
+        das_zero(_temp_make_local_42_18_0);
+        return _temp_make_local_42_18_0;
+    })())));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncTick_builtin_send_blobeventTick17273883841174184937_3e497d48ce1bd56c ( Context * __context__ ) {
+    int32_t arg_eid = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    NullEvent const  &  arg_evt = cast_aot_arg<NullEvent const  & >::to(*__context__,__context__->abiArguments()[1]);
+    char * const  arg_evt_name = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[2]);
+    _FuncTick_builtin_send_blobeventTick17273883841174184937_3e497d48ce1bd56c(__context__, arg_eid, arg_evt, arg_evt_name);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicksendEventTick18244153492460886057_4f0c57c04e4b5549 ( Context * __context__ ) {
+    int32_t arg_eid = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    NullEvent &  arg_evt = cast_aot_arg<NullEvent & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTicksendEventTick18244153492460886057_4f0c57c04e4b5549(__context__, arg_eid, arg_evt);
+    return v_zero();
+}
+static vec4f __wrap_test_8563dc4c6d00cdd5 ( Context * __context__ ) {
+    return cast<bool>::from(test_8563dc4c6d00cdd5(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xf008c9d322b5ac3f, false, (void*)&_FuncTick_builtin_send_blobeventTick17273883841174184937_3e497d48ce1bd56c, &__wrap__FuncTick_builtin_send_blobeventTick17273883841174184937_3e497d48ce1bd56c },
+    { 0x684564eb48c175dc, false, (void*)&_FuncTicksendEventTick18244153492460886057_4f0c57c04e4b5549, &__wrap__FuncTicksendEventTick18244153492460886057_4f0c57c04e4b5549 },
+    { 0xb7da594125cd0281, false, (void*)&test_8563dc4c6d00cdd5, &__wrap_test_8563dc4c6d00cdd5 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_17508375240914123542
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
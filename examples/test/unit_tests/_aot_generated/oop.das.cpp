@@ -0,0 +1,652 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_13346685581829147949 {
+
+namespace  { struct Foo; };
+namespace  { struct Foo3D; };
+namespace  { struct Goo; };
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+namespace  {
+
+struct Foo {
+    void * __rtti;
+    Func DAS_COMMENT((void,Foo)) __finalize;
+    int32_t x;
+    int32_t y;
+    Func DAS_COMMENT((void,Foo,int32_t,int32_t)) set;
+    Func DAS_COMMENT((void,Foo)) ups;
+};
+static_assert(sizeof(Foo)==40,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,x)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,y)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,set)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,ups)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Foo3D {
+    void * __rtti;
+    Func DAS_COMMENT((void,Foo)) __finalize;
+    int32_t x;
+    int32_t y;
+    Func DAS_COMMENT((void,Foo,int32_t,int32_t)) set;
+    Func DAS_COMMENT((void,Foo)) ups;
+    int32_t z;
+};
+static_assert(sizeof(Foo3D)==48,"structure size mismatch with DAS");
+static_assert(offsetof(Foo3D,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,x)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,y)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,set)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,ups)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,z)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Goo {
+    void * __rtti;
+    Func DAS_COMMENT((void,Goo)) __finalize;
+    int32_t a;
+};
+static_assert(sizeof(Goo)==24,"structure size mismatch with DAS");
+static_assert(offsetof(Goo,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Goo,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Goo,a)==16,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__411ed0e77075265a;
+extern StructInfo __struct_info__b571174498fdf9fa;
+extern StructInfo __struct_info__411bd0e77072f083;
+extern TypeInfo __type_info__af8afe4c86446b52;
+extern TypeInfo __type_info__51d2660c48492e67;
+extern TypeInfo __type_info__bc69a005531fe739;
+extern TypeInfo __type_info__bc68c005531b8770;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __struct_info__411ed0e77075265a_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x65bf5856bcd0f340), "__rtti", 0, 6 };
+TypeInfo * __type_info__55b35704030b0750_arg_types_var_4692417554209384026[1] = { &__type_info__bc69a005531fe739 };
+const char * __type_info__55b35704030b0750_arg_names_var_4692417554209384026[1] = { "self" };
+VarInfo __struct_info__411ed0e77075265a_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__55b35704030b0750_arg_types_var_4692417554209384026, __type_info__55b35704030b0750_arg_names_var_4692417554209384026, 1, 0, nullptr, 12, 8, UINT64_C(0x55b35704030b0750), "__finalize", 8, 0 };
+VarInfo __struct_info__411ed0e77075265a_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xbcd6aabb60c7fbc7), "x", 16, 0 };
+VarInfo __struct_info__411ed0e77075265a_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xbcd6a9bb60c7fa14), "y", 20, 0 };
+TypeInfo * __type_info__4619cd65200076e2_arg_types_var_4692417554209384026[3] = { &__type_info__bc69a005531fe739, &__type_info__af8afe4c86446b52, &__type_info__af8afe4c86446b52 };
+const char * __type_info__4619cd65200076e2_arg_names_var_4692417554209384026[3] = { "self", "X", "Y" };
+VarInfo __struct_info__411ed0e77075265a_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__4619cd65200076e2_arg_types_var_4692417554209384026, __type_info__4619cd65200076e2_arg_names_var_4692417554209384026, 3, 0, nullptr, 12, 8, UINT64_C(0x4619cd65200076e2), "set", 24, 0 };
+VarInfo __struct_info__411ed0e77075265a_field_5 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__55b35704030b0750_arg_types_var_4692417554209384026, __type_info__55b35704030b0750_arg_names_var_4692417554209384026, 1, 0, nullptr, 12, 8, UINT64_C(0x7233c8654578da59), "ups", 32, 0 };
+VarInfo * __struct_info__411ed0e77075265a_fields[6] =  { &__struct_info__411ed0e77075265a_field_0, &__struct_info__411ed0e77075265a_field_1, &__struct_info__411ed0e77075265a_field_2, &__struct_info__411ed0e77075265a_field_3, &__struct_info__411ed0e77075265a_field_4, &__struct_info__411ed0e77075265a_field_5 };
+StructInfo __struct_info__411ed0e77075265a = {"Foo", "", 13, __struct_info__411ed0e77075265a_fields, 6, 40, UINT64_C(0x945b59082c003622), nullptr, UINT64_C(0x411ed0e77075265a), 0 };
+VarInfo __struct_info__b571174498fdf9fa_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xc282b83daaea8620), "__rtti", 0, 7 };
+VarInfo __struct_info__b571174498fdf9fa_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__55b35704030b0750_arg_types_var_4692417554209384026, __type_info__55b35704030b0750_arg_names_var_4692417554209384026, 1, 0, nullptr, 12, 8, UINT64_C(0x274bfcee14c9b30), "__finalize", 8, 0 };
+VarInfo __struct_info__b571174498fdf9fa_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xf36c242517e1b867), "x", 16, 0 };
+VarInfo __struct_info__b571174498fdf9fa_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xf36c232517e1b6b4), "y", 20, 0 };
+VarInfo __struct_info__b571174498fdf9fa_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__4619cd65200076e2_arg_types_var_4692417554209384026, __type_info__4619cd65200076e2_arg_names_var_4692417554209384026, 3, 0, nullptr, 12, 8, UINT64_C(0xbe707c08a0fecb02), "set", 24, 0 };
+VarInfo __struct_info__b571174498fdf9fa_field_5 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__55b35704030b0750_arg_types_var_4692417554209384026, __type_info__55b35704030b0750_arg_names_var_4692417554209384026, 1, 0, nullptr, 12, 8, UINT64_C(0xfeed7708d7c87179), "ups", 32, 0 };
+VarInfo __struct_info__b571174498fdf9fa_field_6 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xf36c262517e1bbcd), "z", 40, 0 };
+VarInfo * __struct_info__b571174498fdf9fa_fields[7] =  { &__struct_info__b571174498fdf9fa_field_0, &__struct_info__b571174498fdf9fa_field_1, &__struct_info__b571174498fdf9fa_field_2, &__struct_info__b571174498fdf9fa_field_3, &__struct_info__b571174498fdf9fa_field_4, &__struct_info__b571174498fdf9fa_field_5, &__struct_info__b571174498fdf9fa_field_6 };
+StructInfo __struct_info__b571174498fdf9fa = {"Foo3D", "", 13, __struct_info__b571174498fdf9fa_fields, 7, 48, UINT64_C(0xc4c0aee3579d9a52), nullptr, UINT64_C(0xb571174498fdf9fa), 0 };
+VarInfo __struct_info__411bd0e77072f083_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x8edc0e8a921ce965), "__rtti", 0, 3 };
+TypeInfo * __type_info__adeaadaa69c7ca15_arg_types_var_4691573129279107203[1] = { &__type_info__bc68c005531b8770 };
+VarInfo __struct_info__411bd0e77072f083_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__adeaadaa69c7ca15_arg_types_var_4691573129279107203, __type_info__55b35704030b0750_arg_names_var_4692417554209384026, 1, 0, nullptr, 12, 8, UINT64_C(0xadeaadaa69c7ca15), "__finalize", 8, 0 };
+VarInfo __struct_info__411bd0e77072f083_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xe78861dc42e11b0d), "a", 16, 0 };
+VarInfo * __struct_info__411bd0e77072f083_fields[3] =  { &__struct_info__411bd0e77072f083_field_0, &__struct_info__411bd0e77072f083_field_1, &__struct_info__411bd0e77072f083_field_2 };
+StructInfo __struct_info__411bd0e77072f083 = {"Goo", "", 13, __struct_info__411bd0e77072f083_fields, 3, 24, UINT64_C(0x945839082bfdc9eb), nullptr, UINT64_C(0x411bd0e77072f083), 0 };
+TypeInfo __type_info__af8afe4c86446b52 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf8afe4c86446b52) };
+TypeInfo __type_info__51d2660c48492e67 = { Type::tStructure, &__struct_info__b571174498fdf9fa, nullptr, nullptr, &__type_info__bc69a005531fe739, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 48, UINT64_C(0x51d2660c48492e67) };
+TypeInfo __type_info__bc69a005531fe739 = { Type::tStructure, &__struct_info__411ed0e77075265a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 40, UINT64_C(0xbc69a005531fe739) };
+TypeInfo __type_info__bc68c005531b8770 = { Type::tStructure, &__struct_info__411bd0e77072f083, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 24, UINT64_C(0xbc68c005531b8770) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline StructInfo const  * _FuncrttiTickclass_infoTick15801393167907430156_1fdd9bfc78e8114d ( Context * __context__, Goo const  & __cl_rename_at_116_0 );
+inline void finalize_ffab6cb1b785677a ( Context * __context__, Foo * & ____this_rename_at_90_1 );
+inline void finalize_ccb90db7bd0553fd ( Context * __context__, Goo & ____this_rename_at_104_3 );
+inline StructInfo const  * _FuncrttiTickclass_infoTick15801393167907430156_7d16feb53ccb9d56 ( Context * __context__, Foo const  & __cl_rename_at_116_4 );
+inline StructInfo const  * _FuncrttiTickclass_infoTick15801393167907430156_e602d5aff90ce73e ( Context * __context__, Foo3D const  & __cl_rename_at_116_5 );
+inline Foo Foo_221e787e9afe8b55 ( Context * __context__ );
+inline void _FuncFooTickFoo_cc72b50c73ca93fe ( Context * __context__, Foo & __self_rename_at_11_7 );
+inline Foo Foo_714ae2505769d0b9 ( Context * __context__, int32_t __T_rename_at_14_8 );
+inline void _FuncFooTickFoo_9a287f4d0aab9218 ( Context * __context__, Foo & __self_rename_at_14_10, int32_t __T_rename_at_14_11 );
+inline Foo Foo_9f4702063033e2f8 ( Context * __context__, int32_t __X_rename_at_17_12, int32_t __Y_rename_at_17_13 );
+inline void _FuncFooTickFoo_165d039ba2e08e93 ( Context * __context__, Foo & __self_rename_at_17_15, int32_t __X_rename_at_17_16, int32_t __Y_rename_at_17_17 );
+inline void _FuncFooTickset_5ef9c98bbd85608 ( Context * __context__, Foo & __self_rename_at_20_18, int32_t __X_rename_at_20_19, int32_t __Y_rename_at_20_20 );
+inline void _FuncFooTickups_23913dbd5f52e4f3 ( Context * __context__, Foo & __self_rename_at_24_21 );
+inline void finalize_98fa71cb3d5183c6 ( Context * __context__, Foo & __self_rename_at_28_22 );
+inline void _FuncFoo_0x27___finalize_3488abd04e4801d9 ( Context * __context__, Foo & __self_rename_at_9_23 );
+inline Foo3D Foo3D_1e9bb85e0f6dc4f2 ( Context * __context__ );
+inline void _FuncFoo3DTickFoo3D_306279211ab09f27 ( Context * __context__, Foo3D & __self_rename_at_35_25 );
+inline void _FuncFoo3DTickset_1c42d9488308510 ( Context * __context__, Foo3D & __self_rename_at_42_26, int32_t __X_rename_at_42_27, int32_t __Y_rename_at_42_28 );
+inline void _FuncFoo3DTickups_b6a74c4be4087cae ( Context * __context__, Foo3D & __self_rename_at_46_29 );
+inline void finalize_c53ccffc508c8a94 ( Context * __context__, Foo3D & __self_rename_at_51_30 );
+inline void _FuncFoo3D_0x27___finalize_569ec8bb127e6d0 ( Context * __context__, Foo3D & __self_rename_at_33_31 );
+inline void test_foo_fe235bd329b48adb ( Context * __context__ );
+inline void test_foo_ptr_a58aca9dfc6cdcec ( Context * __context__ );
+inline void _FuncGoo_0x27___finalize_8c2c078cc57885b8 ( Context * __context__, Goo & __self_rename_at_104_35 );
+inline void test_rtti_113eaccda0a51162 ( Context * __context__ );
+inline bool test_86426c2acab223fb ( Context * __context__ );
+inline Goo Goo_156f0495032c31db ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global<int32_t,0x4055993ab5a036da>(__context__) = 0;/*delFoo*/
+    das_global<int32_t,0x5fa752c2237b4055>(__context__) = 0;/*delFoo3D*/
+}
+
+inline StructInfo const  * _FuncrttiTickclass_infoTick15801393167907430156_1fdd9bfc78e8114d ( Context * __context__, Goo const  &  __cl_rename_at_116_0 )
+{
+    return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(((das_deref(__context__,das_cast<TypeInfo const  *>::cast(__cl_rename_at_116_0.__rtti),__FILE__,__LINE__)).getStructType())));
+}
+
+inline void finalize_ffab6cb1b785677a ( Context * __context__, Foo * & ____this_rename_at_90_1 )
+{
+    if ( ____this_rename_at_90_1 != nullptr )
+    {
+        int32_t ____size_rename_at_90_2 = ((int32_t)class_rtti_size(das_auto_cast<void * const >::cast(____this_rename_at_90_1)));
+        das_invoke_function<void>::invoke<Foo &>(__context__,nullptr,____this_rename_at_90_1->__finalize,das_arg<Foo>::pass(das_cast<Foo>::cast(das_deref(__context__,____this_rename_at_90_1,__FILE__,__LINE__))));
+        das_delete<Foo *>::clear(__context__,____this_rename_at_90_1,____size_rename_at_90_2);
+        das_copy(____this_rename_at_90_1,nullptr);
+    };
+}
+
+inline void finalize_ccb90db7bd0553fd ( Context * __context__, Goo &  ____this_rename_at_104_3 )
+{
+    memset((void*)&(____this_rename_at_104_3), 0, 24);
+}
+
+inline StructInfo const  * _FuncrttiTickclass_infoTick15801393167907430156_7d16feb53ccb9d56 ( Context * __context__, Foo const  &  __cl_rename_at_116_4 )
+{
+    return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(((das_deref(__context__,das_cast<TypeInfo const  *>::cast(__cl_rename_at_116_4.__rtti),__FILE__,__LINE__)).getStructType())));
+}
+
+inline StructInfo const  * _FuncrttiTickclass_infoTick15801393167907430156_e602d5aff90ce73e ( Context * __context__, Foo3D const  &  __cl_rename_at_116_5 )
+{
+    return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(((das_deref(__context__,das_cast<TypeInfo const  *>::cast(__cl_rename_at_116_5.__rtti),__FILE__,__LINE__)).getStructType())));
+}
+
+inline Foo Foo_221e787e9afe8b55 ( Context * __context__ )
+{
+    Foo __self_rename_at_11_6; das_zero(__self_rename_at_11_6); das_move(__self_rename_at_11_6, (([&]() -> Foo {
+        Foo __mks_11;
+        das_copy((__mks_11.__rtti),(((void *)(&__type_info__bc69a005531fe739))));
+        das_copy((__mks_11.__finalize),(Func(__context__->fnByMangledName(/*Foo'__finalize S<Foo>*/ 0xa576fb7af95b22e8))));
+        das_copy((__mks_11.x),(0));
+        das_copy((__mks_11.y),(0));
+        das_copy((__mks_11.set),(Func(__context__->fnByMangledName(/*Foo`set S<Foo> Ci Ci*/ 0xe2238294e35e26bf))));
+        das_copy((__mks_11.ups),(Func(__context__->fnByMangledName(/*Foo`ups S<Foo>*/ 0xbed2caeffbee9d20))));
+        return __mks_11;
+    })()));
+    _FuncFooTickFoo_cc72b50c73ca93fe(__context__,das_arg<Foo>::pass(__self_rename_at_11_6));
+    return /* <- */ das_auto_cast_move<Foo>::cast(__self_rename_at_11_6);
+}
+
+inline void _FuncFooTickFoo_cc72b50c73ca93fe ( Context * __context__, Foo &  __self_rename_at_11_7 )
+{
+    _FuncFooTickset_5ef9c98bbd85608(__context__,das_arg<Foo>::pass(__self_rename_at_11_7),1,1);
+}
+
+inline Foo Foo_714ae2505769d0b9 ( Context * __context__, int32_t __T_rename_at_14_8 )
+{
+    Foo __self_rename_at_14_9; das_zero(__self_rename_at_14_9); das_move(__self_rename_at_14_9, (([&]() -> Foo {
+        Foo __mks_14;
+        das_copy((__mks_14.__rtti),(((void *)(&__type_info__bc69a005531fe739))));
+        das_copy((__mks_14.__finalize),(Func(__context__->fnByMangledName(/*Foo'__finalize S<Foo>*/ 0xa576fb7af95b22e8))));
+        das_copy((__mks_14.x),(0));
+        das_copy((__mks_14.y),(0));
+        das_copy((__mks_14.set),(Func(__context__->fnByMangledName(/*Foo`set S<Foo> Ci Ci*/ 0xe2238294e35e26bf))));
+        das_copy((__mks_14.ups),(Func(__context__->fnByMangledName(/*Foo`ups S<Foo>*/ 0xbed2caeffbee9d20))));
+        return __mks_14;
+    })()));
+    _FuncFooTickFoo_9a287f4d0aab9218(__context__,das_arg<Foo>::pass(__self_rename_at_14_9),__T_rename_at_14_8);
+    return /* <- */ das_auto_cast_move<Foo>::cast(__self_rename_at_14_9);
+}
+
+inline void _FuncFooTickFoo_9a287f4d0aab9218 ( Context * __context__, Foo &  __self_rename_at_14_10, int32_t __T_rename_at_14_11 )
+{
+    das_invoke_method<void,24/*set*/>::invoke<Foo &,int32_t,int32_t>(__context__,nullptr,das_arg<Foo>::pass(__self_rename_at_14_10),__T_rename_at_14_11,__T_rename_at_14_11);
+}
+
+inline Foo Foo_9f4702063033e2f8 ( Context * __context__, int32_t __X_rename_at_17_12, int32_t __Y_rename_at_17_13 )
+{
+    Foo __self_rename_at_17_14; das_zero(__self_rename_at_17_14); das_move(__self_rename_at_17_14, (([&]() -> Foo {
+        Foo __mks_17;
+        das_copy((__mks_17.__rtti),(((void *)(&__type_info__bc69a005531fe739))));
+        das_copy((__mks_17.__finalize),(Func(__context__->fnByMangledName(/*Foo'__finalize S<Foo>*/ 0xa576fb7af95b22e8))));
+        das_copy((__mks_17.x),(0));
+        das_copy((__mks_17.y),(0));
+        das_copy((__mks_17.set),(Func(__context__->fnByMangledName(/*Foo`set S<Foo> Ci Ci*/ 0xe2238294e35e26bf))));
+        das_copy((__mks_17.ups),(Func(__context__->fnByMangledName(/*Foo`ups S<Foo>*/ 0xbed2caeffbee9d20))));
+        return __mks_17;
+    })()));
+    _FuncFooTickFoo_165d039ba2e08e93(__context__,das_arg<Foo>::pass(__self_rename_at_17_14),__X_rename_at_17_12,__Y_rename_at_17_13);
+    return /* <- */ das_auto_cast_move<Foo>::cast(__self_rename_at_17_14);
+}
+
+inline void _FuncFooTickFoo_165d039ba2e08e93 ( Context * __context__, Foo &  __self_rename_at_17_15, int32_t __X_rename_at_17_16, int32_t __Y_rename_at_17_17 )
+{
+    _FuncFooTickset_5ef9c98bbd85608(__context__,das_arg<Foo>::pass(__self_rename_at_17_15),__X_rename_at_17_16,__Y_rename_at_17_17);
+}
+
+inline void _FuncFooTickset_5ef9c98bbd85608 ( Context * __context__, Foo &  __self_rename_at_20_18, int32_t __X_rename_at_20_19, int32_t __Y_rename_at_20_20 )
+{
+    das_copy(__self_rename_at_20_18.x,__X_rename_at_20_19);
+    das_copy(__self_rename_at_20_18.y,__Y_rename_at_20_20);
+}
+
+inline void _FuncFooTickups_23913dbd5f52e4f3 ( Context * __context__, Foo &  __self_rename_at_24_21 )
+{
+    das_copy(__self_rename_at_24_21.x,-1);
+    das_copy(__self_rename_at_24_21.y,-1);
+}
+
+inline void finalize_98fa71cb3d5183c6 ( Context * __context__, Foo &  __self_rename_at_28_22 )
+{
+    ++das_global<int32_t,0x4055993ab5a036da>(__context__) /*delFoo*/;
+}
+
+inline void _FuncFoo_0x27___finalize_3488abd04e4801d9 ( Context * __context__, Foo &  __self_rename_at_9_23 )
+{
+    finalize_98fa71cb3d5183c6(__context__,das_arg<Foo>::pass(__self_rename_at_9_23));
+}
+
+inline Foo3D Foo3D_1e9bb85e0f6dc4f2 ( Context * __context__ )
+{
+    Foo3D __self_rename_at_35_24; das_zero(__self_rename_at_35_24); das_move(__self_rename_at_35_24, (([&]() -> Foo3D {
+        Foo3D __mks_35;
+        das_copy((__mks_35.__rtti),(((void *)(&__type_info__51d2660c48492e67))));
+        das_copy((__mks_35.__finalize),(das_cast<Func DAS_COMMENT((void,Foo))>::cast(Func(__context__->fnByMangledName(/*Foo3D'__finalize S<Foo3D>*/ 0xc29c1efd26dbdc53)))));
+        das_copy((__mks_35.x),(0));
+        das_copy((__mks_35.y),(0));
+        das_copy((__mks_35.set),(das_cast<Func DAS_COMMENT((void,Foo,int32_t,int32_t))>::cast(Func(__context__->fnByMangledName(/*Foo3D`set S<Foo3D> Ci Ci*/ 0xc2f6b03441a94ee5)))));
+        das_copy((__mks_35.ups),(das_cast<Func DAS_COMMENT((void,Foo))>::cast(Func(__context__->fnByMangledName(/*Foo3D`ups S<Foo3D>*/ 0x68d5860a110a46bc)))));
+        das_copy((__mks_35.z),(13));
+        return __mks_35;
+    })()));
+    _FuncFoo3DTickFoo3D_306279211ab09f27(__context__,das_arg<Foo3D>::pass(__self_rename_at_35_24));
+    return /* <- */ das_auto_cast_move<Foo3D>::cast(__self_rename_at_35_24);
+}
+
+inline void _FuncFoo3DTickFoo3D_306279211ab09f27 ( Context * __context__, Foo3D &  __self_rename_at_35_25 )
+{
+    DAS_ASSERT(((__self_rename_at_35_25.x == 0) && (__self_rename_at_35_25.y == 0)));
+    DAS_ASSERT((__self_rename_at_35_25.z == 13));
+    _FuncFooTickFoo_cc72b50c73ca93fe(__context__,das_reinterpret<Foo>::pass(das_arg<Foo3D>::pass(__self_rename_at_35_25)));
+    DAS_ASSERT(((__self_rename_at_35_25.x == 1) && (__self_rename_at_35_25.y == 1)));
+    das_copy(__self_rename_at_35_25.z,3);
+}
+
+inline void _FuncFoo3DTickset_1c42d9488308510 ( Context * __context__, Foo3D &  __self_rename_at_42_26, int32_t __X_rename_at_42_27, int32_t __Y_rename_at_42_28 )
+{
+    _FuncFooTickset_5ef9c98bbd85608(__context__,das_reinterpret<Foo>::pass(das_arg<Foo3D>::pass(__self_rename_at_42_26)),__X_rename_at_42_27,__Y_rename_at_42_28);
+    das_copy(__self_rename_at_42_26.z,0);
+}
+
+inline void _FuncFoo3DTickups_b6a74c4be4087cae ( Context * __context__, Foo3D &  __self_rename_at_46_29 )
+{
+    das_copy(__self_rename_at_46_29.x,-2);
+    das_copy(__self_rename_at_46_29.y,-2);
+    das_copy(__self_rename_at_46_29.z,-2);
+}
+
+inline void finalize_c53ccffc508c8a94 ( Context * __context__, Foo3D &  __self_rename_at_51_30 )
+{
+    finalize_98fa71cb3d5183c6(__context__,das_arg<Foo>::pass(das_cast<Foo>::cast(__self_rename_at_51_30)));
+    ++das_global<int32_t,0x5fa752c2237b4055>(__context__) /*delFoo3D*/;
+}
+
+inline void _FuncFoo3D_0x27___finalize_569ec8bb127e6d0 ( Context * __context__, Foo3D &  __self_rename_at_33_31 )
+{
+    finalize_c53ccffc508c8a94(__context__,das_arg<Foo3D>::pass(__self_rename_at_33_31));
+}
+
+inline void test_foo_fe235bd329b48adb ( Context * __context__ )
+{
+    Foo __f_rename_at_59_32 = Foo_221e787e9afe8b55(__context__);
+    DAS_ASSERT(((__f_rename_at_59_32.x == 1) && (__f_rename_at_59_32.y == 1)));
+    das_invoke_method<void,24/*set*/>::invoke<Foo &,int32_t,int32_t>(__context__,nullptr,das_arg<Foo>::pass(das_cast<Foo>::cast(__f_rename_at_59_32)),1,2);
+    DAS_ASSERT(((__f_rename_at_59_32.x == 1) && (__f_rename_at_59_32.y == 2)));
+    das_copy(__f_rename_at_59_32,Foo_9f4702063033e2f8(__context__,11,12));
+    DAS_ASSERT(((__f_rename_at_59_32.x == 11) && (__f_rename_at_59_32.y == 12)));
+    das_copy(__f_rename_at_59_32,Foo_714ae2505769d0b9(__context__,13));
+    DAS_ASSERT(((__f_rename_at_59_32.x == 13) && (__f_rename_at_59_32.y == 13)));
+    Foo3D __f3d_rename_at_67_33 = Foo3D_1e9bb85e0f6dc4f2(__context__);
+    DAS_ASSERT((((__f3d_rename_at_67_33.x == 1) && (__f3d_rename_at_67_33.y == 1)) && (__f3d_rename_at_67_33.z == 3)));
+    das_invoke_method<void,24/*set*/>::invoke<Foo &,int32_t,int32_t>(__context__,nullptr,das_arg<Foo>::pass(das_cast<Foo>::cast(__f3d_rename_at_67_33)),1,2);
+    DAS_ASSERT((((__f3d_rename_at_67_33.x == 1) && (__f3d_rename_at_67_33.y == 2)) && (__f3d_rename_at_67_33.z == 0)));
+    das_copy(__f3d_rename_at_67_33.z,13);
+    das_invoke_method<void,24/*set*/>::invoke<Foo &,int32_t,int32_t>(__context__,nullptr,das_arg<Foo>::pass(das_cast<Foo>::cast(__f3d_rename_at_67_33)),3,4);
+    DAS_ASSERT((((__f3d_rename_at_67_33.x == 3) && (__f3d_rename_at_67_33.y == 4)) && (__f3d_rename_at_67_33.z == 0)));
+    DAS_ASSERT(((das_global<int32_t,0x4055993ab5a036da>(__context__) /*delFoo*/ == 0) && (das_global<int32_t,0x5fa752c2237b4055>(__context__) /*delFoo3D*/ == 0)));
+    finalize_98fa71cb3d5183c6(__context__,das_arg<Foo>::pass(__f_rename_at_59_32));
+    DAS_ASSERT(((das_global<int32_t,0x4055993ab5a036da>(__context__) /*delFoo*/ == 1) && (das_global<int32_t,0x5fa752c2237b4055>(__context__) /*delFoo3D*/ == 0)));
+    finalize_c53ccffc508c8a94(__context__,das_arg<Foo3D>::pass(__f3d_rename_at_67_33));
+    DAS_ASSERT(((das_global<int32_t,0x4055993ab5a036da>(__context__) /*delFoo*/ == 2) && (das_global<int32_t,0x5fa752c2237b4055>(__context__) /*delFoo3D*/ == 1)));
+    das_copy(das_global<int32_t,0x4055993ab5a036da>(__context__) /*delFoo*/,0);
+    das_copy(das_global<int32_t,0x5fa752c2237b4055>(__context__) /*delFoo3D*/,0);
+}
+
+inline void test_foo_ptr_a58aca9dfc6cdcec ( Context * __context__ )
+{
+    Foo * __f_rename_at_85_34 = das_new<Foo>::make_and_init(__context__,[&]() { return Foo_221e787e9afe8b55(__context__); });
+    das_invoke_method<void,32/*ups*/>::invoke<Foo &>(__context__,nullptr,das_arg<Foo>::pass(das_cast<Foo>::cast(das_deref(__context__,__f_rename_at_85_34,__FILE__,__LINE__))));
+    DAS_ASSERT(((__f_rename_at_85_34->x == -1) && (__f_rename_at_85_34->y == -1)));
+    DAS_ASSERT(((das_global<int32_t,0x4055993ab5a036da>(__context__) /*delFoo*/ == 0) && (das_global<int32_t,0x5fa752c2237b4055>(__context__) /*delFoo3D*/ == 0)));
+    finalize_ffab6cb1b785677a(__context__,__f_rename_at_85_34);
+    DAS_ASSERT(((das_global<int32_t,0x4055993ab5a036da>(__context__) /*delFoo*/ == 1) && (das_global<int32_t,0x5fa752c2237b4055>(__context__) /*delFoo3D*/ == 0)));
+    das_copy(__f_rename_at_85_34,das_cast<Foo *>::cast(das_new<Foo3D>::make_and_init(__context__,[&]() { return Foo3D_1e9bb85e0f6dc4f2(__context__); })));
+    das_invoke_method<void,32/*ups*/>::invoke<Foo &>(__context__,nullptr,das_arg<Foo>::pass(das_cast<Foo>::cast(das_deref(__context__,__f_rename_at_85_34,__FILE__,__LINE__))));
+    DAS_ASSERT(((__f_rename_at_85_34->x == -2) && (__f_rename_at_85_34->y == -2)));
+    finalize_ffab6cb1b785677a(__context__,__f_rename_at_85_34);
+    DAS_ASSERT(((das_global<int32_t,0x4055993ab5a036da>(__context__) /*delFoo*/ == 2) && (das_global<int32_t,0x5fa752c2237b4055>(__context__) /*delFoo3D*/ == 1)));
+    das_copy(das_global<int32_t,0x4055993ab5a036da>(__context__) /*delFoo*/,0);
+    das_copy(das_global<int32_t,0x5fa752c2237b4055>(__context__) /*delFoo3D*/,0);
+}
+
+inline void _FuncGoo_0x27___finalize_8c2c078cc57885b8 ( Context * __context__, Goo &  __self_rename_at_104_35 )
+{
+    finalize_ccb90db7bd0553fd(__context__,das_arg<Goo>::pass(__self_rename_at_104_35));
+}
+
+inline void test_rtti_113eaccda0a51162 ( Context * __context__ )
+{
+    Goo __g_rename_at_110_36 = (([&]() -> Goo {
+        Goo __mks_110 = Goo_156f0495032c31db(__context__);
+        return __mks_110;
+    })());
+    Foo __f_rename_at_111_37 = Foo_221e787e9afe8b55(__context__);
+    Foo __f2_rename_at_112_38 = Foo_221e787e9afe8b55(__context__);
+    Foo3D __f3d_rename_at_113_39 = Foo3D_1e9bb85e0f6dc4f2(__context__);
+    Foo3D __f3d2_rename_at_114_40 = Foo3D_1e9bb85e0f6dc4f2(__context__);
+    DAS_ASSERT((__f_rename_at_111_37.__rtti != __g_rename_at_110_36.__rtti));
+    DAS_ASSERT((__f3d_rename_at_113_39.__rtti != __g_rename_at_110_36.__rtti));
+    DAS_ASSERT((__f_rename_at_111_37.__rtti == __f2_rename_at_112_38.__rtti));
+    DAS_ASSERT((__f3d_rename_at_113_39.__rtti == __f3d2_rename_at_114_40.__rtti));
+    DAS_ASSERT((__f_rename_at_111_37.__rtti != __f3d_rename_at_113_39.__rtti));
+    DAS_ASSERT((_FuncrttiTickclass_infoTick15801393167907430156_7d16feb53ccb9d56(__context__,das_arg<Foo>::pass(__f_rename_at_111_37)) != _FuncrttiTickclass_infoTick15801393167907430156_1fdd9bfc78e8114d(__context__,das_arg<Goo>::pass(__g_rename_at_110_36))));
+    DAS_ASSERT((_FuncrttiTickclass_infoTick15801393167907430156_e602d5aff90ce73e(__context__,das_arg<Foo3D>::pass(__f3d_rename_at_113_39)) != _FuncrttiTickclass_infoTick15801393167907430156_1fdd9bfc78e8114d(__context__,das_arg<Goo>::pass(__g_rename_at_110_36))));
+    DAS_ASSERT((_FuncrttiTickclass_infoTick15801393167907430156_7d16feb53ccb9d56(__context__,das_arg<Foo>::pass(__f_rename_at_111_37)) == _FuncrttiTickclass_infoTick15801393167907430156_7d16feb53ccb9d56(__context__,das_arg<Foo>::pass(__f2_rename_at_112_38))));
+    DAS_ASSERT((_FuncrttiTickclass_infoTick15801393167907430156_e602d5aff90ce73e(__context__,das_arg<Foo3D>::pass(__f3d_rename_at_113_39)) == _FuncrttiTickclass_infoTick15801393167907430156_e602d5aff90ce73e(__context__,das_arg<Foo3D>::pass(__f3d2_rename_at_114_40))));
+    DAS_ASSERT((_FuncrttiTickclass_infoTick15801393167907430156_7d16feb53ccb9d56(__context__,das_arg<Foo>::pass(__f_rename_at_111_37)) != _FuncrttiTickclass_infoTick15801393167907430156_e602d5aff90ce73e(__context__,das_arg<Foo3D>::pass(__f3d_rename_at_113_39))));
+    DAS_VERIFY((isCompatibleCast(_FuncrttiTickclass_infoTick15801393167907430156_7d16feb53ccb9d56(__context__,das_arg<Foo>::pass(__f_rename_at_111_37)),_FuncrttiTickclass_infoTick15801393167907430156_7d16feb53ccb9d56(__context__,das_arg<Foo>::pass(__f_rename_at_111_37)))));
+    DAS_VERIFY((isCompatibleCast(_FuncrttiTickclass_infoTick15801393167907430156_7d16feb53ccb9d56(__context__,das_arg<Foo>::pass(__f_rename_at_111_37)),_FuncrttiTickclass_infoTick15801393167907430156_e602d5aff90ce73e(__context__,das_arg<Foo3D>::pass(__f3d_rename_at_113_39)))));
+    DAS_VERIFY((!isCompatibleCast(_FuncrttiTickclass_infoTick15801393167907430156_e602d5aff90ce73e(__context__,das_arg<Foo3D>::pass(__f3d_rename_at_113_39)),_FuncrttiTickclass_infoTick15801393167907430156_7d16feb53ccb9d56(__context__,das_arg<Foo>::pass(__f_rename_at_111_37)))));
+    DAS_VERIFY((!isCompatibleCast(_FuncrttiTickclass_infoTick15801393167907430156_1fdd9bfc78e8114d(__context__,das_arg<Goo>::pass(__g_rename_at_110_36)),_FuncrttiTickclass_infoTick15801393167907430156_7d16feb53ccb9d56(__context__,das_arg<Foo>::pass(__f_rename_at_111_37)))));
+    DAS_VERIFY((!isCompatibleCast(_FuncrttiTickclass_infoTick15801393167907430156_7d16feb53ccb9d56(__context__,das_arg<Foo>::pass(__f_rename_at_111_37)),_FuncrttiTickclass_infoTick15801393167907430156_1fdd9bfc78e8114d(__context__,das_arg<Goo>::pass(__g_rename_at_110_36)))));
+    DAS_VERIFY((!isCompatibleCast(_FuncrttiTickclass_infoTick15801393167907430156_1fdd9bfc78e8114d(__context__,das_arg<Goo>::pass(__g_rename_at_110_36)),_FuncrttiTickclass_infoTick15801393167907430156_e602d5aff90ce73e(__context__,das_arg<Foo3D>::pass(__f3d_rename_at_113_39)))));
+    DAS_VERIFY((!isCompatibleCast(_FuncrttiTickclass_infoTick15801393167907430156_e602d5aff90ce73e(__context__,das_arg<Foo3D>::pass(__f3d_rename_at_113_39)),_FuncrttiTickclass_infoTick15801393167907430156_1fdd9bfc78e8114d(__context__,das_arg<Goo>::pass(__g_rename_at_110_36)))));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(_FuncrttiTickclass_infoTick15801393167907430156_7d16feb53ccb9d56(__context__,das_arg<Foo>::pass(__f_rename_at_111_37))->name /*name*/),cast<char *>::from(((char *) "Foo")),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(_FuncrttiTickclass_infoTick15801393167907430156_e602d5aff90ce73e(__context__,das_arg<Foo3D>::pass(__f3d_rename_at_113_39))->name /*name*/),cast<char *>::from(((char *) "Foo3D")),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(_FuncrttiTickclass_infoTick15801393167907430156_1fdd9bfc78e8114d(__context__,das_arg<Goo>::pass(__g_rename_at_110_36))->name /*name*/),cast<char *>::from(((char *) "Goo")),*__context__,nullptr)));
+}
+
+inline bool test_86426c2acab223fb ( Context * __context__ )
+{
+    test_foo_fe235bd329b48adb(__context__);
+    test_foo_ptr_a58aca9dfc6cdcec(__context__);
+    test_rtti_113eaccda0a51162(__context__);
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline Goo Goo_156f0495032c31db ( Context * __context__ )
+{
+    return /* <- */ das_auto_cast_move<Goo>::cast((([&]() -> Goo {
+        Goo __mks_104;
+        das_zero(__mks_104);
+        das_copy((__mks_104.__rtti),(((void *)(&__type_info__bc68c005531b8770))));
+        das_copy((__mks_104.__finalize),(Func(__context__->fnByMangledName(/*Goo'__finalize S<Goo>*/ 0x577be14689aedc5f))));
+        return __mks_104;
+    })()));
+}
+static vec4f __wrap__FuncrttiTickclass_infoTick15801393167907430156_1fdd9bfc78e8114d ( Context * __context__ ) {
+    Goo const  &  arg_cl = cast_aot_arg<Goo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<StructInfo const  *>::from(_FuncrttiTickclass_infoTick15801393167907430156_1fdd9bfc78e8114d(__context__, arg_cl));
+}
+static vec4f __wrap_finalize_ffab6cb1b785677a ( Context * __context__ ) {
+    Foo * & arg___this = cast_aot_arg<Foo * &>::to(*__context__,__context__->abiArguments()[0]);
+    finalize_ffab6cb1b785677a(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_ccb90db7bd0553fd ( Context * __context__ ) {
+    Goo &  arg___this = cast_aot_arg<Goo & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_ccb90db7bd0553fd(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncrttiTickclass_infoTick15801393167907430156_7d16feb53ccb9d56 ( Context * __context__ ) {
+    Foo const  &  arg_cl = cast_aot_arg<Foo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<StructInfo const  *>::from(_FuncrttiTickclass_infoTick15801393167907430156_7d16feb53ccb9d56(__context__, arg_cl));
+}
+static vec4f __wrap__FuncrttiTickclass_infoTick15801393167907430156_e602d5aff90ce73e ( Context * __context__ ) {
+    Foo3D const  &  arg_cl = cast_aot_arg<Foo3D const  & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<StructInfo const  *>::from(_FuncrttiTickclass_infoTick15801393167907430156_e602d5aff90ce73e(__context__, arg_cl));
+}
+static vec4f __wrap_Foo_221e787e9afe8b55 ( Context * __context__ ) {
+    *((Foo *) __context__->abiCMRES) = Foo_221e787e9afe8b55(__context__);
+    return v_zero();
+}
+static vec4f __wrap__FuncFooTickFoo_cc72b50c73ca93fe ( Context * __context__ ) {
+    Foo &  arg_self = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncFooTickFoo_cc72b50c73ca93fe(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap_Foo_714ae2505769d0b9 ( Context * __context__ ) {
+    int32_t arg_T = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    *((Foo *) __context__->abiCMRES) = Foo_714ae2505769d0b9(__context__, arg_T);
+    return v_zero();
+}
+static vec4f __wrap__FuncFooTickFoo_9a287f4d0aab9218 ( Context * __context__ ) {
+    Foo &  arg_self = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_T = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncFooTickFoo_9a287f4d0aab9218(__context__, arg_self, arg_T);
+    return v_zero();
+}
+static vec4f __wrap_Foo_9f4702063033e2f8 ( Context * __context__ ) {
+    int32_t arg_X = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_Y = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    *((Foo *) __context__->abiCMRES) = Foo_9f4702063033e2f8(__context__, arg_X, arg_Y);
+    return v_zero();
+}
+static vec4f __wrap__FuncFooTickFoo_165d039ba2e08e93 ( Context * __context__ ) {
+    Foo &  arg_self = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_X = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_Y = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    _FuncFooTickFoo_165d039ba2e08e93(__context__, arg_self, arg_X, arg_Y);
+    return v_zero();
+}
+static vec4f __wrap__FuncFooTickset_5ef9c98bbd85608 ( Context * __context__ ) {
+    Foo &  arg_self = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_X = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_Y = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    _FuncFooTickset_5ef9c98bbd85608(__context__, arg_self, arg_X, arg_Y);
+    return v_zero();
+}
+static vec4f __wrap__FuncFooTickups_23913dbd5f52e4f3 ( Context * __context__ ) {
+    Foo &  arg_self = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncFooTickups_23913dbd5f52e4f3(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap_finalize_98fa71cb3d5183c6 ( Context * __context__ ) {
+    Foo &  arg_self = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_98fa71cb3d5183c6(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap__FuncFoo_0x27___finalize_3488abd04e4801d9 ( Context * __context__ ) {
+    Foo &  arg_self = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncFoo_0x27___finalize_3488abd04e4801d9(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap_Foo3D_1e9bb85e0f6dc4f2 ( Context * __context__ ) {
+    *((Foo3D *) __context__->abiCMRES) = Foo3D_1e9bb85e0f6dc4f2(__context__);
+    return v_zero();
+}
+static vec4f __wrap__FuncFoo3DTickFoo3D_306279211ab09f27 ( Context * __context__ ) {
+    Foo3D &  arg_self = cast_aot_arg<Foo3D & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncFoo3DTickFoo3D_306279211ab09f27(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap__FuncFoo3DTickset_1c42d9488308510 ( Context * __context__ ) {
+    Foo3D &  arg_self = cast_aot_arg<Foo3D & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_X = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_Y = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    _FuncFoo3DTickset_1c42d9488308510(__context__, arg_self, arg_X, arg_Y);
+    return v_zero();
+}
+static vec4f __wrap__FuncFoo3DTickups_b6a74c4be4087cae ( Context * __context__ ) {
+    Foo3D &  arg_self = cast_aot_arg<Foo3D & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncFoo3DTickups_b6a74c4be4087cae(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap_finalize_c53ccffc508c8a94 ( Context * __context__ ) {
+    Foo3D &  arg_self = cast_aot_arg<Foo3D & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_c53ccffc508c8a94(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap__FuncFoo3D_0x27___finalize_569ec8bb127e6d0 ( Context * __context__ ) {
+    Foo3D &  arg_self = cast_aot_arg<Foo3D & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncFoo3D_0x27___finalize_569ec8bb127e6d0(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap_test_foo_fe235bd329b48adb ( Context * __context__ ) {
+    test_foo_fe235bd329b48adb(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_foo_ptr_a58aca9dfc6cdcec ( Context * __context__ ) {
+    test_foo_ptr_a58aca9dfc6cdcec(__context__);
+    return v_zero();
+}
+static vec4f __wrap__FuncGoo_0x27___finalize_8c2c078cc57885b8 ( Context * __context__ ) {
+    Goo &  arg_self = cast_aot_arg<Goo & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncGoo_0x27___finalize_8c2c078cc57885b8(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap_test_rtti_113eaccda0a51162 ( Context * __context__ ) {
+    test_rtti_113eaccda0a51162(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_86426c2acab223fb ( Context * __context__ ) {
+    return cast<bool>::from(test_86426c2acab223fb(__context__));
+}
+static vec4f __wrap_Goo_156f0495032c31db ( Context * __context__ ) {
+    *((Goo *) __context__->abiCMRES) = Goo_156f0495032c31db(__context__);
+    return v_zero();
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xd424bbb037163dfd, false, (void*)&_FuncrttiTickclass_infoTick15801393167907430156_1fdd9bfc78e8114d, &__wrap__FuncrttiTickclass_infoTick15801393167907430156_1fdd9bfc78e8114d },
+    { 0x3ac78f088b4f758c, false, (void*)&finalize_ffab6cb1b785677a, &__wrap_finalize_ffab6cb1b785677a },
+    { 0x676878c09fc40bd7, false, (void*)&finalize_ccb90db7bd0553fd, &__wrap_finalize_ccb90db7bd0553fd },
+    { 0x74e27d0fee5df50, false, (void*)&_FuncrttiTickclass_infoTick15801393167907430156_7d16feb53ccb9d56, &__wrap__FuncrttiTickclass_infoTick15801393167907430156_7d16feb53ccb9d56 },
+    { 0xa486568f502bba11, false, (void*)&_FuncrttiTickclass_infoTick15801393167907430156_e602d5aff90ce73e, &__wrap__FuncrttiTickclass_infoTick15801393167907430156_e602d5aff90ce73e },
+    { 0xb41206578a51370c, true, (void*)&Foo_221e787e9afe8b55, &__wrap_Foo_221e787e9afe8b55 },
+    { 0xd88c3516635e430b, false, (void*)&_FuncFooTickFoo_cc72b50c73ca93fe, &__wrap__FuncFooTickFoo_cc72b50c73ca93fe },
+    { 0xad6adc8893f19c17, true, (void*)&Foo_714ae2505769d0b9, &__wrap_Foo_714ae2505769d0b9 },
+    { 0xd73b24604088da82, false, (void*)&_FuncFooTickFoo_9a287f4d0aab9218, &__wrap__FuncFooTickFoo_9a287f4d0aab9218 },
+    { 0x72a1f2ebf9ef9ed, true, (void*)&Foo_9f4702063033e2f8, &__wrap_Foo_9f4702063033e2f8 },
+    { 0x2901423da6fe3bf, false, (void*)&_FuncFooTickFoo_165d039ba2e08e93, &__wrap__FuncFooTickFoo_165d039ba2e08e93 },
+    { 0xa310ed1b323ad517, false, (void*)&_FuncFooTickset_5ef9c98bbd85608, &__wrap__FuncFooTickset_5ef9c98bbd85608 },
+    { 0x7e3d83eae6fda143, false, (void*)&_FuncFooTickups_23913dbd5f52e4f3, &__wrap__FuncFooTickups_23913dbd5f52e4f3 },
+    { 0x1b8b8a4de129e453, false, (void*)&finalize_98fa71cb3d5183c6, &__wrap_finalize_98fa71cb3d5183c6 },
+    { 0x239cc3671e38bfec, false, (void*)&_FuncFoo_0x27___finalize_3488abd04e4801d9, &__wrap__FuncFoo_0x27___finalize_3488abd04e4801d9 },
+    { 0x36d18ca2f363dc6, true, (void*)&Foo3D_1e9bb85e0f6dc4f2, &__wrap_Foo3D_1e9bb85e0f6dc4f2 },
+    { 0x51a2110d156f79d0, false, (void*)&_FuncFoo3DTickFoo3D_306279211ab09f27, &__wrap__FuncFoo3DTickFoo3D_306279211ab09f27 },
+    { 0xb38954825a8ff2c5, false, (void*)&_FuncFoo3DTickset_1c42d9488308510, &__wrap__FuncFoo3DTickset_1c42d9488308510 },
+    { 0x59d7c9c11203d975, false, (void*)&_FuncFoo3DTickups_b6a74c4be4087cae, &__wrap__FuncFoo3DTickups_b6a74c4be4087cae },
+    { 0x3cb5b0fbacc444d0, false, (void*)&finalize_c53ccffc508c8a94, &__wrap_finalize_c53ccffc508c8a94 },
+    { 0xb549760cfa26d721, false, (void*)&_FuncFoo3D_0x27___finalize_569ec8bb127e6d0, &__wrap__FuncFoo3D_0x27___finalize_569ec8bb127e6d0 },
+    { 0x637a6fb1eaf193bb, false, (void*)&test_foo_fe235bd329b48adb, &__wrap_test_foo_fe235bd329b48adb },
+    { 0xff112fa1e7659d0a, false, (void*)&test_foo_ptr_a58aca9dfc6cdcec, &__wrap_test_foo_ptr_a58aca9dfc6cdcec },
+    { 0x6ee39f6bb42cca74, false, (void*)&_FuncGoo_0x27___finalize_8c2c078cc57885b8, &__wrap__FuncGoo_0x27___finalize_8c2c078cc57885b8 },
+    { 0xd9d61e35f8c25e1f, false, (void*)&test_rtti_113eaccda0a51162, &__wrap_test_rtti_113eaccda0a51162 },
+    { 0x80e30480da3703ed, false, (void*)&test_86426c2acab223fb, &__wrap_test_86426c2acab223fb },
+    { 0x5e46c4ee6518f86d, true, (void*)&Goo_156f0495032c31db, &__wrap_Goo_156f0495032c31db },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x87eedb57b3e5cdf4, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_13346685581829147949
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,187 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_5204965507864626401 {
+
+namespace  { struct iVec2; };
+namespace  {
+
+struct iVec2 {
+    int32_t x;
+    int32_t y;
+};
+static_assert(sizeof(iVec2)==8,"structure size mismatch with DAS");
+static_assert(offsetof(iVec2,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(iVec2,y)==4,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline iVec2 iVec2_fff9561be7aa0220 ( Context * __context__, int32_t __X_rename_at_8_0, int32_t __Y_rename_at_8_1 );
+inline iVec2 _FuncSub_c0393beb374d64e9 ( Context * __context__, iVec2 const  & __a_rename_at_12_2 );
+inline iVec2 _FuncAdd_8b35ced18940df81 ( Context * __context__, iVec2 const  & __a_rename_at_16_3, iVec2 const  & __b_rename_at_16_4 );
+inline bool _FuncEquEqu_e936a0de665481a6 ( Context * __context__, iVec2 const  & __a_rename_at_20_5, iVec2 const  & __b_rename_at_20_6 );
+inline bool test_86f2a226376f39ee ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline iVec2 iVec2_fff9561be7aa0220 ( Context * __context__, int32_t __X_rename_at_8_0, int32_t __Y_rename_at_8_1 )
+{
+    return das_auto_cast_ref<iVec2>::cast((([&]() -> iVec2 {
+        iVec2 __mks_9;
+        das_copy((__mks_9.x),(__X_rename_at_8_0));
+        das_copy((__mks_9.y),(__Y_rename_at_8_1));
+        return __mks_9;
+    })()));
+}
+
+inline iVec2 _FuncSub_c0393beb374d64e9 ( Context * __context__, iVec2 const  &  __a_rename_at_12_2 )
+{
+    return das_auto_cast_ref<iVec2>::cast((([&]() -> iVec2 {
+        iVec2 __mks_13;
+        das_copy((__mks_13.x),(-(__a_rename_at_12_2.x)));
+        das_copy((__mks_13.y),(-(__a_rename_at_12_2.y)));
+        return __mks_13;
+    })()));
+}
+
+inline iVec2 _FuncAdd_8b35ced18940df81 ( Context * __context__, iVec2 const  &  __a_rename_at_16_3, iVec2 const  &  __b_rename_at_16_4 )
+{
+    return das_auto_cast_ref<iVec2>::cast((([&]() -> iVec2 {
+        iVec2 __mks_17;
+        das_copy((__mks_17.x),((__a_rename_at_16_3.x + __b_rename_at_16_4.x)));
+        das_copy((__mks_17.y),((__a_rename_at_16_3.y + __b_rename_at_16_4.y)));
+        return __mks_17;
+    })()));
+}
+
+inline bool _FuncEquEqu_e936a0de665481a6 ( Context * __context__, iVec2 const  &  __a_rename_at_20_5, iVec2 const  &  __b_rename_at_20_6 )
+{
+    return das_auto_cast<bool>::cast((__a_rename_at_20_5.x == __b_rename_at_20_6.x) && (__a_rename_at_20_5.y == __b_rename_at_20_6.y));
+}
+
+inline bool test_86f2a226376f39ee ( Context * __context__ )
+{
+    iVec2 _temp_make_local_28_17_0; _temp_make_local_28_17_0;
+    iVec2 _temp_make_local_29_20_1; _temp_make_local_29_20_1;
+    iVec2 __a_rename_at_26_7_ConstRef = ((iVec2)iVec2_fff9561be7aa0220(__context__,4,5));
+    iVec2 const  & __a_rename_at_26_7 = __a_rename_at_26_7_ConstRef;
+;
+    iVec2 __b_rename_at_27_8_ConstRef = ((iVec2)iVec2_fff9561be7aa0220(__context__,6,7));
+    iVec2 const  & __b_rename_at_27_8 = __b_rename_at_27_8_ConstRef;
+;
+    DAS_ASSERT((_FuncEquEqu_e936a0de665481a6(__context__,das_arg<iVec2>::pass(_FuncSub_c0393beb374d64e9(__context__,__a_rename_at_26_7)),das_arg<iVec2>::pass((_temp_make_local_28_17_0 = (iVec2_fff9561be7aa0220(__context__,-4,-5)))))));
+    DAS_ASSERT((_FuncEquEqu_e936a0de665481a6(__context__,das_arg<iVec2>::pass((_FuncAdd_8b35ced18940df81(__context__,__a_rename_at_26_7,__b_rename_at_27_8))),das_arg<iVec2>::pass((_temp_make_local_29_20_1 = (iVec2_fff9561be7aa0220(__context__,10,12)))))));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_iVec2_fff9561be7aa0220 ( Context * __context__ ) {
+    int32_t arg_X = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_Y = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    *((iVec2 *) __context__->abiCMRES) = iVec2_fff9561be7aa0220(__context__, arg_X, arg_Y);
+    return v_zero();
+}
+static vec4f __wrap__FuncSub_c0393beb374d64e9 ( Context * __context__ ) {
+    iVec2 const  &  arg_a = cast_aot_arg<iVec2 const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((iVec2 *) __context__->abiCMRES) = _FuncSub_c0393beb374d64e9(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncAdd_8b35ced18940df81 ( Context * __context__ ) {
+    iVec2 const  &  arg_a = cast_aot_arg<iVec2 const  & >::to(*__context__,__context__->abiArguments()[0]);
+    iVec2 const  &  arg_b = cast_aot_arg<iVec2 const  & >::to(*__context__,__context__->abiArguments()[1]);
+    *((iVec2 *) __context__->abiCMRES) = _FuncAdd_8b35ced18940df81(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap__FuncEquEqu_e936a0de665481a6 ( Context * __context__ ) {
+    iVec2 const  &  arg_a = cast_aot_arg<iVec2 const  & >::to(*__context__,__context__->abiArguments()[0]);
+    iVec2 const  &  arg_b = cast_aot_arg<iVec2 const  & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_FuncEquEqu_e936a0de665481a6(__context__, arg_a, arg_b));
+}
+static vec4f __wrap_test_86f2a226376f39ee ( Context * __context__ ) {
+    return cast<bool>::from(test_86f2a226376f39ee(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x49e31d75718deede, true, (void*)&iVec2_fff9561be7aa0220, &__wrap_iVec2_fff9561be7aa0220 },
+    { 0xf502d2b1c2f75ca4, true, (void*)&_FuncSub_c0393beb374d64e9, &__wrap__FuncSub_c0393beb374d64e9 },
+    { 0x89a3788d3767698c, true, (void*)&_FuncAdd_8b35ced18940df81, &__wrap__FuncAdd_8b35ced18940df81 },
+    { 0xf7e9775b8eb569ba, false, (void*)&_FuncEquEqu_e936a0de665481a6, &__wrap__FuncEquEqu_e936a0de665481a6 },
+    { 0x47d8f9e654fc6ceb, false, (void*)&test_86f2a226376f39ee, &__wrap_test_86f2a226376f39ee },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_5204965507864626401
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
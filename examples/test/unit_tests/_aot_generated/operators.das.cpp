@@ -0,0 +1,140 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_2821858754343667550 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline int32_t charg_27e367a9f70c9765 ( Context * __context__, int32_t __t_rename_at_2_0 );
+inline void checkInc_2bdb6c30ab4cde14 ( Context * __context__, int32_t & __val_rename_at_7_1 );
+inline bool test_a128d7bc88e4ece3 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t charg_27e367a9f70c9765 ( Context * __context__, int32_t __t_rename_at_2_0 )
+{
+    ++__t_rename_at_2_0;
+    return das_auto_cast<int32_t>::cast(__t_rename_at_2_0);
+}
+
+inline void checkInc_2bdb6c30ab4cde14 ( Context * __context__, int32_t & __val_rename_at_7_1 )
+{
+    ++__val_rename_at_7_1;
+}
+
+inline bool test_a128d7bc88e4ece3 ( Context * __context__ )
+{
+    int32_t __y_rename_at_14_2 = 0;
+    das_copy(__y_rename_at_14_2,charg_27e367a9f70c9765(__context__,1));
+    DAS_ASSERT((true && (__y_rename_at_14_2 == 2)));
+    int32_t __a_rename_at_18_3 = 0; int32_t __b_rename_at_18_4 = 0; int32_t __c_rename_at_18_5 = 0;
+    das_copy(__a_rename_at_18_3,1);
+    DAS_ASSERT(((__a_rename_at_18_3 == 1) && (__b_rename_at_18_4 == 0)));
+    das_copy(__b_rename_at_18_4,2);
+    DAS_ASSERT(((__a_rename_at_18_3 == 1) && (__b_rename_at_18_4 == 2)));
+    __c_rename_at_18_5++;
+    DAS_ASSERT((__c_rename_at_18_5 == 1));
+    __c_rename_at_18_5++;
+    DAS_ASSERT((__c_rename_at_18_5 == 2));
+    int32_t __idx_rename_at_28_6 = 1;
+    checkInc_2bdb6c30ab4cde14(__context__,__idx_rename_at_28_6);
+    DAS_ASSERT((__idx_rename_at_28_6 == 2));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_charg_27e367a9f70c9765 ( Context * __context__ ) {
+    int32_t arg_t = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(charg_27e367a9f70c9765(__context__, arg_t));
+}
+static vec4f __wrap_checkInc_2bdb6c30ab4cde14 ( Context * __context__ ) {
+    int32_t & arg_val = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[0]);
+    checkInc_2bdb6c30ab4cde14(__context__, arg_val);
+    return v_zero();
+}
+static vec4f __wrap_test_a128d7bc88e4ece3 ( Context * __context__ ) {
+    return cast<bool>::from(test_a128d7bc88e4ece3(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xc6e14d112947cd95, false, (void*)&charg_27e367a9f70c9765, &__wrap_charg_27e367a9f70c9765 },
+    { 0xd33b4c08dcf70df1, false, (void*)&checkInc_2bdb6c30ab4cde14, &__wrap_checkInc_2bdb6c30ab4cde14 },
+    { 0xb12efc4bf6aaafe0, false, (void*)&test_a128d7bc88e4ece3, &__wrap_test_a128d7bc88e4ece3 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_2821858754343667550
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
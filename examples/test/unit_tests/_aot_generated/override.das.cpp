@@ -0,0 +1,234 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_16180138198928079192 {
+
+namespace  { struct Foo; };
+namespace  { struct Foo3D; };
+namespace  {
+
+struct Foo {
+    int32_t x;
+    int32_t y;
+    Func DAS_COMMENT((void,Foo,int32_t,int32_t)) set;
+    Func DAS_COMMENT((void,Foo,int32_t,int32_t)) set2;
+};
+static_assert(sizeof(Foo)==24,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,set)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,set2)==16,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Foo3D {
+    int32_t x;
+    int32_t y;
+    Func DAS_COMMENT((void,Foo,int32_t,int32_t)) set;
+    Func DAS_COMMENT((void,Foo,int32_t,int32_t)) set2;
+    int32_t z;
+};
+static_assert(sizeof(Foo3D)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Foo3D,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,set)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,set2)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,z)==24,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void Foo_setXY_1c3709d565172fd5 ( Context * __context__, Foo & __that_rename_at_8_0, int32_t __x_rename_at_8_1, int32_t __y_rename_at_8_2 );
+inline void Foo3D_setXY_564a7dcb94b2bf89 ( Context * __context__, Foo3D & __that_rename_at_19_3, int32_t __x_rename_at_19_4, int32_t __y_rename_at_19_5 );
+inline void Foo3D_setXY2_d16e492ba63dd3a8 ( Context * __context__, Foo & ___that_rename_at_25_6, int32_t __x_rename_at_25_7, int32_t __y_rename_at_25_8 );
+inline bool test_82af635e77b2e5a6 ( Context * __context__ );
+inline Foo Foo_ac5d2abc8f8a360f ( Context * __context__ );
+inline Foo3D Foo3D_43381e181026e8c1 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void Foo_setXY_1c3709d565172fd5 ( Context * __context__, Foo &  __that_rename_at_8_0, int32_t __x_rename_at_8_1, int32_t __y_rename_at_8_2 )
+{
+    das_copy(__that_rename_at_8_0.x,__x_rename_at_8_1);
+    das_copy(__that_rename_at_8_0.y,__y_rename_at_8_2);
+}
+
+inline void Foo3D_setXY_564a7dcb94b2bf89 ( Context * __context__, Foo3D &  __that_rename_at_19_3, int32_t __x_rename_at_19_4, int32_t __y_rename_at_19_5 )
+{
+    das_copy(__that_rename_at_19_3.x,__x_rename_at_19_4);
+    das_copy(__that_rename_at_19_3.y,__y_rename_at_19_5);
+    das_copy(__that_rename_at_19_3.z,0);
+}
+
+inline void Foo3D_setXY2_d16e492ba63dd3a8 ( Context * __context__, Foo &  ___that_rename_at_25_6, int32_t __x_rename_at_25_7, int32_t __y_rename_at_25_8 )
+{
+    Foo3D * __that_rename_at_27_9 = &(das_upcast<Foo3D &>::cast(___that_rename_at_25_6));
+    das_copy((*__that_rename_at_27_9).x,__x_rename_at_25_7);
+    das_copy((*__that_rename_at_27_9).y,__y_rename_at_25_8);
+    das_copy((*__that_rename_at_27_9).z,0);
+}
+
+inline bool test_82af635e77b2e5a6 ( Context * __context__ )
+{
+    Foo __f_rename_at_36_10 = (([&]() -> Foo {
+        Foo __mks_36 = Foo_ac5d2abc8f8a360f(__context__);
+        return __mks_36;
+    })());
+    das_invoke_method<void,8/*set*/>::invoke<Foo &,int32_t,int32_t>(__context__,nullptr,das_arg<Foo>::pass(das_cast<Foo>::cast(__f_rename_at_36_10)),1,2);
+    DAS_ASSERT(((__f_rename_at_36_10.x == 1) && (__f_rename_at_36_10.y == 2)));
+    Foo3D __f3d_rename_at_39_11 = (([&]() -> Foo3D {
+        Foo3D __mks_39 = Foo3D_43381e181026e8c1(__context__);
+        return __mks_39;
+    })());
+    DAS_ASSERT((((__f3d_rename_at_39_11.x == 0) && (__f3d_rename_at_39_11.y == 0)) && (__f3d_rename_at_39_11.z == 3)));
+    das_invoke_method<void,8/*set*/>::invoke<Foo &,int32_t,int32_t>(__context__,nullptr,das_arg<Foo>::pass(das_cast<Foo>::cast(__f3d_rename_at_39_11)),1,2);
+    DAS_ASSERT((((__f3d_rename_at_39_11.x == 1) && (__f3d_rename_at_39_11.y == 2)) && (__f3d_rename_at_39_11.z == 0)));
+    das_copy(__f3d_rename_at_39_11.z,13);
+    das_invoke_method<void,16/*set2*/>::invoke<Foo &,int32_t,int32_t>(__context__,nullptr,das_arg<Foo>::pass(das_cast<Foo>::cast(__f3d_rename_at_39_11)),3,4);
+    DAS_ASSERT((((__f3d_rename_at_39_11.x == 3) && (__f3d_rename_at_39_11.y == 4)) && (__f3d_rename_at_39_11.z == 0)));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline Foo Foo_ac5d2abc8f8a360f ( Context * __context__ )
+{
+    return /* <- */ das_auto_cast_move<Foo>::cast((([&]() -> Foo {
+        Foo __mks_2;
+        das_copy((__mks_2.x),(0));
+        das_copy((__mks_2.y),(0));
+        das_copy((__mks_2.set),(Func(__context__->fnByMangledName(/*Foo_setXY S<Foo> Ci Ci*/ 0xcfbf6b7e6c61328a))));
+        das_copy((__mks_2.set2),(Func(__context__->fnByMangledName(/*Foo_setXY S<Foo> Ci Ci*/ 0xcfbf6b7e6c61328a))));
+        return __mks_2;
+    })()));
+}
+
+inline Foo3D Foo3D_43381e181026e8c1 ( Context * __context__ )
+{
+    return /* <- */ das_auto_cast_move<Foo3D>::cast((([&]() -> Foo3D {
+        Foo3D __mks_13;
+        das_copy((__mks_13.x),(0));
+        das_copy((__mks_13.y),(0));
+        das_copy((__mks_13.set),(das_cast<Func DAS_COMMENT((void,Foo,int32_t,int32_t))>::cast(Func(__context__->fnByMangledName(/*Foo3D_setXY S<Foo3D> Ci Ci*/ 0xf1dbbe137295f8ea)))));
+        das_copy((__mks_13.set2),(Func(__context__->fnByMangledName(/*Foo3D_setXY2 S<Foo> Ci Ci*/ 0x73033f5736482579))));
+        das_copy((__mks_13.z),(3));
+        return __mks_13;
+    })()));
+}
+static vec4f __wrap_Foo_setXY_1c3709d565172fd5 ( Context * __context__ ) {
+    Foo &  arg_that = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_y = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    Foo_setXY_1c3709d565172fd5(__context__, arg_that, arg_x, arg_y);
+    return v_zero();
+}
+static vec4f __wrap_Foo3D_setXY_564a7dcb94b2bf89 ( Context * __context__ ) {
+    Foo3D &  arg_that = cast_aot_arg<Foo3D & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_y = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    Foo3D_setXY_564a7dcb94b2bf89(__context__, arg_that, arg_x, arg_y);
+    return v_zero();
+}
+static vec4f __wrap_Foo3D_setXY2_d16e492ba63dd3a8 ( Context * __context__ ) {
+    Foo &  arg__that = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_x = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_y = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    Foo3D_setXY2_d16e492ba63dd3a8(__context__, arg__that, arg_x, arg_y);
+    return v_zero();
+}
+static vec4f __wrap_test_82af635e77b2e5a6 ( Context * __context__ ) {
+    return cast<bool>::from(test_82af635e77b2e5a6(__context__));
+}
+static vec4f __wrap_Foo_ac5d2abc8f8a360f ( Context * __context__ ) {
+    *((Foo *) __context__->abiCMRES) = Foo_ac5d2abc8f8a360f(__context__);
+    return v_zero();
+}
+static vec4f __wrap_Foo3D_43381e181026e8c1 ( Context * __context__ ) {
+    *((Foo3D *) __context__->abiCMRES) = Foo3D_43381e181026e8c1(__context__);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xb0885fe36059226d, false, (void*)&Foo_setXY_1c3709d565172fd5, &__wrap_Foo_setXY_1c3709d565172fd5 },
+    { 0xcfcaff9e29096976, false, (void*)&Foo3D_setXY_564a7dcb94b2bf89, &__wrap_Foo3D_setXY_564a7dcb94b2bf89 },
+    { 0x63a533e6582b1688, false, (void*)&Foo3D_setXY2_d16e492ba63dd3a8, &__wrap_Foo3D_setXY2_d16e492ba63dd3a8 },
+    { 0x2bfbd2e911ee9d01, false, (void*)&test_82af635e77b2e5a6, &__wrap_test_82af635e77b2e5a6 },
+    { 0xaba3b0f6a3eaa400, true, (void*)&Foo_ac5d2abc8f8a360f, &__wrap_Foo_ac5d2abc8f8a360f },
+    { 0x9b044ea34cc0b5d5, true, (void*)&Foo3D_43381e181026e8c1, &__wrap_Foo3D_43381e181026e8c1 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_16180138198928079192
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,165 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_10602428467180906025 {
+
+// unused enumeration ConversionResult
+extern TypeInfo __type_info__af5be84c85f468f0;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __func_info__890aade30193cbf6_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af5be84c85f468f0, nullptr, nullptr, nullptr, 0, 0, nullptr, 41058, 24, UINT64_C(0x8d2b91edeeedb5), "foo", 0, 0 };
+VarInfo * __func_info__890aade30193cbf6_fields[1] =  { &__func_info__890aade30193cbf6_field_0 };
+FuncInfo __func_info__890aade30193cbf6 = {"invoke block<(foo:array<uint8> const#):void> const", "", __func_info__890aade30193cbf6_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x890aade30193cbf6), 0x0 };
+VarInfo __func_info__d3a73e94f786421c_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af5be84c85f468f0, nullptr, nullptr, nullptr, 0, 0, nullptr, 41026, 24, UINT64_C(0xa7eef25590954c7a), "foo", 0, 0 };
+VarInfo * __func_info__d3a73e94f786421c_fields[1] =  { &__func_info__d3a73e94f786421c_field_0 };
+FuncInfo __func_info__d3a73e94f786421c = {"invoke block<(var foo:array<uint8>#):void> const", "", __func_info__d3a73e94f786421c_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xd3a73e94f786421c), 0x0 };
+TypeInfo __type_info__af5be84c85f468f0 = { Type::tUInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xaf5be84c85f468f0) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline bool _Funcstrings_boostTickis_character_atTick2195995578588225520_96bd95db5082b8f5 ( Context * __context__, TArray<uint8_t> const  & __foo_rename_at_130_0, int32_t __idx_rename_at_130_1, int32_t __ch_rename_at_130_2 );
+inline bool test_34327dc1fbfd5ddd ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool _Funcstrings_boostTickis_character_atTick2195995578588225520_96bd95db5082b8f5 ( Context * __context__, TArray<uint8_t> const  &  __foo_rename_at_130_0, int32_t __idx_rename_at_130_1, int32_t __ch_rename_at_130_2 )
+{
+    return das_auto_cast<bool>::cast(int32_t(__foo_rename_at_130_0(__idx_rename_at_130_1,__context__)) == __ch_rename_at_130_2);
+}
+
+inline bool test_34327dc1fbfd5ddd ( Context * __context__ ) { das_stack_prologue __prologue(__context__,128,"test " DAS_FILE_LINE);
+{
+    builtin_string_peek(((char *) " a + b * ( c << d ) blah blah b"),das_make_block<void,TArray<uint8_t> const  &>(__context__,80,0,&__func_info__890aade30193cbf6,[&](TArray<uint8_t> const  & __foo_rename_at_7_3) -> void{
+        {
+            bool __need_loop_8 = true;
+            // x: int const
+            das_iterator<range> __x_iterator(mk_range(builtin_array_size(__foo_rename_at_7_3)));
+            int32_t __x_rename_at_8_4;
+            __need_loop_8 = __x_iterator.first(__context__,(__x_rename_at_8_4)) && __need_loop_8;
+            for ( ; __need_loop_8 ; __need_loop_8 = __x_iterator.next(__context__,(__x_rename_at_8_4)) )
+            {
+                if ( _Funcstrings_boostTickis_character_atTick2195995578588225520_96bd95db5082b8f5(__context__,__foo_rename_at_7_3,__x_rename_at_8_4,98) )
+                {
+                    DAS_ASSERT(((((__x_rename_at_8_4 == 5) || (__x_rename_at_8_4 == 20)) || (__x_rename_at_8_4 == 25)) || (__x_rename_at_8_4 == 30)));
+                };
+            }
+            __x_iterator.close(__context__,(__x_rename_at_8_4));
+        };
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    char * __new_sample_rename_at_14_5 = (char *)(((char * const )(builtin_string_peek_and_modify(((char *) " a + b * ( c << d ) blah blah b"),das_make_block<void,TArray<uint8_t> &>(__context__,96,0,&__func_info__d3a73e94f786421c,[&](TArray<uint8_t> & __foo_rename_at_14_6) -> void{
+        {
+            bool __need_loop_15 = true;
+            // x: int const
+            das_iterator<range> __x_iterator(mk_range(builtin_array_size(das_arg<TArray<uint8_t>>::pass(__foo_rename_at_14_6))));
+            int32_t __x_rename_at_15_7;
+            __need_loop_15 = __x_iterator.first(__context__,(__x_rename_at_15_7)) && __need_loop_15;
+            for ( ; __need_loop_15 ; __need_loop_15 = __x_iterator.next(__context__,(__x_rename_at_15_7)) )
+            {
+                if ( _Funcstrings_boostTickis_character_atTick2195995578588225520_96bd95db5082b8f5(__context__,das_arg<TArray<uint8_t>>::pass(__foo_rename_at_14_6),__x_rename_at_15_7,98) )
+                {
+                    das_copy(__foo_rename_at_14_6(__x_rename_at_15_7,__context__),0x42);
+                };
+            }
+            __x_iterator.close(__context__,(__x_rename_at_15_7));
+        };
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))))));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__new_sample_rename_at_14_5),cast<char *>::from(((char *) " a + B * ( c << d ) Blah Blah B")),*__context__,nullptr)));
+    return das_auto_cast<bool>::cast(true);
+}}
+static vec4f __wrap__Funcstrings_boostTickis_character_atTick2195995578588225520_96bd95db5082b8f5 ( Context * __context__ ) {
+    TArray<uint8_t> const  &  arg_foo = cast_aot_arg<TArray<uint8_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_idx = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_ch = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    return cast<bool>::from(_Funcstrings_boostTickis_character_atTick2195995578588225520_96bd95db5082b8f5(__context__, arg_foo, arg_idx, arg_ch));
+}
+static vec4f __wrap_test_34327dc1fbfd5ddd ( Context * __context__ ) {
+    return cast<bool>::from(test_34327dc1fbfd5ddd(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x1016b87985e6a7, false, (void*)&_Funcstrings_boostTickis_character_atTick2195995578588225520_96bd95db5082b8f5, &__wrap__Funcstrings_boostTickis_character_atTick2195995578588225520_96bd95db5082b8f5 },
+    { 0xe98e9655bc1ccad5, false, (void*)&test_34327dc1fbfd5ddd, &__wrap_test_34327dc1fbfd5ddd },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_10602428467180906025
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,242 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_3578262661819441012 {
+
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+    void * __rtti;
+    Func DAS_COMMENT((void,Foo)) __finalize;
+    int32_t count;
+    Func DAS_COMMENT((int32_t,Foo)) update;
+};
+static_assert(sizeof(Foo)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,count)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,update)==24,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__411ed0e77075265a;
+extern TypeInfo __type_info__af8afe4c86446b52;
+extern TypeInfo __type_info__bc69a005531fe739;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __struct_info__411ed0e77075265a_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x65bf5856bcd0f340), "__rtti", 0, 4 };
+TypeInfo * __type_info__55b35704030b0750_arg_types_var_4692417554209384026[1] = { &__type_info__bc69a005531fe739 };
+const char * __type_info__55b35704030b0750_arg_names_var_4692417554209384026[1] = { "self" };
+VarInfo __struct_info__411ed0e77075265a_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__55b35704030b0750_arg_types_var_4692417554209384026, __type_info__55b35704030b0750_arg_names_var_4692417554209384026, 1, 0, nullptr, 12, 8, UINT64_C(0x55b35704030b0750), "__finalize", 8, 0 };
+VarInfo __struct_info__411ed0e77075265a_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xcdf06a4f032e8a3), "count", 16, 0 };
+VarInfo __struct_info__411ed0e77075265a_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af8afe4c86446b52, nullptr, (TypeInfo **)__type_info__55b35704030b0750_arg_types_var_4692417554209384026, __type_info__55b35704030b0750_arg_names_var_4692417554209384026, 1, 0, nullptr, 12, 8, UINT64_C(0xf088af15663f6d58), "update", 24, 0 };
+VarInfo * __struct_info__411ed0e77075265a_fields[4] =  { &__struct_info__411ed0e77075265a_field_0, &__struct_info__411ed0e77075265a_field_1, &__struct_info__411ed0e77075265a_field_2, &__struct_info__411ed0e77075265a_field_3 };
+StructInfo __struct_info__411ed0e77075265a = {"Foo", "", 13, __struct_info__411ed0e77075265a_fields, 4, 32, UINT64_C(0x945b59082c003622), nullptr, UINT64_C(0x411ed0e77075265a), 0 };
+TypeInfo __type_info__af8afe4c86446b52 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf8afe4c86446b52) };
+TypeInfo __type_info__bc69a005531fe739 = { Type::tStructure, &__struct_info__411ed0e77075265a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 32, UINT64_C(0xbc69a005531fe739) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void finalize_d9ed5532bd3c39e6 ( Context * __context__, Foo & ____this_rename_at_3_0 );
+inline void finalize_484d294ba22479a6 ( Context * __context__, Foo * & ____this_rename_at_19_1 );
+inline Foo Foo_96535a5e1feb5bcc ( Context * __context__, int32_t __ic_rename_at_5_3 );
+inline void _FuncFooTickFoo_411ca4053f6b89dd ( Context * __context__, Foo & __self_rename_at_5_5, int32_t __ic_rename_at_5_6 );
+inline int32_t _FuncFooTickupdate_93eba18c954db6b6 ( Context * __context__, Foo & __self_rename_at_8_7 );
+inline void _FuncFoo_0x27___finalize_90046004d2150c32 ( Context * __context__, Foo & __self_rename_at_3_8 );
+inline bool test_c531f94ea4d90faa ( Context * __context__ );
+inline Foo Foo_26a8786faba21938 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void finalize_d9ed5532bd3c39e6 ( Context * __context__, Foo &  ____this_rename_at_3_0 )
+{
+    memset((void*)&(____this_rename_at_3_0), 0, 32);
+}
+
+inline void finalize_484d294ba22479a6 ( Context * __context__, Foo * & ____this_rename_at_19_1 )
+{
+    if ( ____this_rename_at_19_1 != nullptr )
+    {
+        int32_t ____size_rename_at_19_2 = ((int32_t)class_rtti_size(das_auto_cast<void * const >::cast(____this_rename_at_19_1)));
+        das_invoke_function<void>::invoke<Foo &>(__context__,nullptr,____this_rename_at_19_1->__finalize,das_arg<Foo>::pass(das_cast<Foo>::cast(das_deref(__context__,____this_rename_at_19_1,__FILE__,__LINE__))));
+        das_delete_persistent<Foo *>::clear(__context__,____this_rename_at_19_1,____size_rename_at_19_2);
+        das_copy(____this_rename_at_19_1,nullptr);
+    };
+}
+
+inline Foo Foo_96535a5e1feb5bcc ( Context * __context__, int32_t __ic_rename_at_5_3 )
+{
+    Foo __self_rename_at_5_4; das_zero(__self_rename_at_5_4); das_move(__self_rename_at_5_4, (([&]() -> Foo {
+        Foo __mks_5;
+        das_copy((__mks_5.__rtti),(((void *)(&__type_info__bc69a005531fe739))));
+        das_copy((__mks_5.__finalize),(Func(__context__->fnByMangledName(/*Foo'__finalize S<Foo>*/ 0xa576fb7af95b22e8))));
+        das_copy((__mks_5.count),(0));
+        das_copy((__mks_5.update),(Func(__context__->fnByMangledName(/*Foo`update S<Foo>*/ 0x633f96afda50cd04))));
+        return __mks_5;
+    })()));
+    _FuncFooTickFoo_411ca4053f6b89dd(__context__,das_arg<Foo>::pass(__self_rename_at_5_4),__ic_rename_at_5_3);
+    return /* <- */ das_auto_cast_move<Foo>::cast(__self_rename_at_5_4);
+}
+
+inline void _FuncFooTickFoo_411ca4053f6b89dd ( Context * __context__, Foo &  __self_rename_at_5_5, int32_t __ic_rename_at_5_6 )
+{
+    das_copy(__self_rename_at_5_5.count,__ic_rename_at_5_6);
+}
+
+inline int32_t _FuncFooTickupdate_93eba18c954db6b6 ( Context * __context__, Foo &  __self_rename_at_8_7 )
+{
+    return das_auto_cast<int32_t>::cast(__self_rename_at_8_7.count++);
+}
+
+inline void _FuncFoo_0x27___finalize_90046004d2150c32 ( Context * __context__, Foo &  __self_rename_at_3_8 )
+{
+    finalize_d9ed5532bd3c39e6(__context__,das_arg<Foo>::pass(__self_rename_at_3_8));
+}
+
+inline bool test_c531f94ea4d90faa ( Context * __context__ )
+{
+    Foo * __pFoo_rename_at_15_9 = das_new_persistent<Foo>::make_and_init(__context__,[&]() { return Foo_96535a5e1feb5bcc(__context__,13); });
+    int32_t __up1_rename_at_16_10 = ((int32_t)das_invoke_method<int32_t,24/*update*/>::invoke<Foo &>(__context__,nullptr,das_arg<Foo>::pass(das_cast<Foo>::cast(das_deref(__context__,__pFoo_rename_at_15_9,__FILE__,__LINE__)))));
+    int32_t __up2_rename_at_17_11 = ((int32_t)das_invoke_method<int32_t,24/*update*/>::invoke<Foo &>(__context__,nullptr,das_arg<Foo>::pass(das_cast<Foo>::cast(das_deref(__context__,__pFoo_rename_at_15_9,__FILE__,__LINE__)))));
+    finalize_484d294ba22479a6(__context__,__pFoo_rename_at_15_9);
+    DAS_ASSERT((__up1_rename_at_16_10 == 13));
+    DAS_ASSERT((__up2_rename_at_17_11 == 14));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline Foo Foo_26a8786faba21938 ( Context * __context__ )
+{
+    return /* <- */ das_auto_cast_move<Foo>::cast((([&]() -> Foo {
+        Foo __mks_3;
+        das_copy((__mks_3.__rtti),(((void *)(&__type_info__bc69a005531fe739))));
+        das_copy((__mks_3.__finalize),(Func(__context__->fnByMangledName(/*Foo'__finalize S<Foo>*/ 0xa576fb7af95b22e8))));
+        das_copy((__mks_3.count),(0));
+        das_copy((__mks_3.update),(Func(__context__->fnByMangledName(/*Foo`update S<Foo>*/ 0x633f96afda50cd04))));
+        return __mks_3;
+    })()));
+}
+static vec4f __wrap_finalize_d9ed5532bd3c39e6 ( Context * __context__ ) {
+    Foo &  arg___this = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_d9ed5532bd3c39e6(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_484d294ba22479a6 ( Context * __context__ ) {
+    Foo * & arg___this = cast_aot_arg<Foo * &>::to(*__context__,__context__->abiArguments()[0]);
+    finalize_484d294ba22479a6(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_Foo_96535a5e1feb5bcc ( Context * __context__ ) {
+    int32_t arg_ic = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    *((Foo *) __context__->abiCMRES) = Foo_96535a5e1feb5bcc(__context__, arg_ic);
+    return v_zero();
+}
+static vec4f __wrap__FuncFooTickFoo_411ca4053f6b89dd ( Context * __context__ ) {
+    Foo &  arg_self = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_ic = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncFooTickFoo_411ca4053f6b89dd(__context__, arg_self, arg_ic);
+    return v_zero();
+}
+static vec4f __wrap__FuncFooTickupdate_93eba18c954db6b6 ( Context * __context__ ) {
+    Foo &  arg_self = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t>::from(_FuncFooTickupdate_93eba18c954db6b6(__context__, arg_self));
+}
+static vec4f __wrap__FuncFoo_0x27___finalize_90046004d2150c32 ( Context * __context__ ) {
+    Foo &  arg_self = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncFoo_0x27___finalize_90046004d2150c32(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap_test_c531f94ea4d90faa ( Context * __context__ ) {
+    return cast<bool>::from(test_c531f94ea4d90faa(__context__));
+}
+static vec4f __wrap_Foo_26a8786faba21938 ( Context * __context__ ) {
+    *((Foo *) __context__->abiCMRES) = Foo_26a8786faba21938(__context__);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x782e66f49b8f74eb, false, (void*)&finalize_d9ed5532bd3c39e6, &__wrap_finalize_d9ed5532bd3c39e6 },
+    { 0x89f4cc8f4b7100, false, (void*)&finalize_484d294ba22479a6, &__wrap_finalize_484d294ba22479a6 },
+    { 0xaec33ce0ade9fa50, true, (void*)&Foo_96535a5e1feb5bcc, &__wrap_Foo_96535a5e1feb5bcc },
+    { 0x22048b5632abd326, false, (void*)&_FuncFooTickFoo_411ca4053f6b89dd, &__wrap__FuncFooTickFoo_411ca4053f6b89dd },
+    { 0xd438fc32f94d72f0, false, (void*)&_FuncFooTickupdate_93eba18c954db6b6, &__wrap__FuncFooTickupdate_93eba18c954db6b6 },
+    { 0x8e89c6683c394a06, false, (void*)&_FuncFoo_0x27___finalize_90046004d2150c32, &__wrap__FuncFoo_0x27___finalize_90046004d2150c32 },
+    { 0x5f3d782e510b16de, false, (void*)&test_c531f94ea4d90faa, &__wrap_test_c531f94ea4d90faa },
+    { 0x40ad559d29983ffc, true, (void*)&Foo_26a8786faba21938, &__wrap_Foo_26a8786faba21938 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_3578262661819441012
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
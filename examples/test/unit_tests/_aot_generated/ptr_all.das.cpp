@@ -0,0 +1,297 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_15088723007504144011 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncTicktest_signedTick5592047466636695339_d6d5d3666de61361 ( Context * __context__, int32_t __t_rename_at_3_0 );
+inline void _FuncTicktest_signedTick5592047466636695339_15a8b6c97c8afaa4 ( Context * __context__, int64_t __t_rename_at_3_8 );
+inline void _FuncTicktest_unsignedTick8666044346459394471_a804a1f650cfca3c ( Context * __context__, uint32_t __t_rename_at_32_16 );
+inline void _FuncTicktest_unsignedTick8666044346459394471_8078a693b5af2874 ( Context * __context__, uint64_t __t_rename_at_32_23 );
+inline bool test_ed404c10817f85b6 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncTicktest_signedTick5592047466636695339_d6d5d3666de61361 ( Context * __context__, int32_t __t_rename_at_3_0 )
+{
+    int32_t __zero_rename_at_5_1 = 0;
+    --__zero_rename_at_5_1;
+    ++__zero_rename_at_5_1;
+    int32_t __one_rename_at_6_2 = 1;
+    --__one_rename_at_6_2;
+    ++__one_rename_at_6_2;
+    int32_t __two_rename_at_7_3 = 2;
+    --__two_rename_at_7_3;
+    ++__two_rename_at_7_3;
+    int32_t __three_rename_at_8_4 = 3;
+    --__three_rename_at_8_4;
+    ++__three_rename_at_8_4;
+    int32_t __neg_one_rename_at_9_5 = -1;
+    --__neg_one_rename_at_9_5;
+    ++__neg_one_rename_at_9_5;
+    TDim<int32_t,4> __a_rename_at_11_6; das_zero(__a_rename_at_11_6); das_move(__a_rename_at_11_6, (([&]() -> TDim<int32_t,4> {
+        TDim<int32_t,4> __mka_11;
+        __mka_11(0,__context__) = 0;
+        __mka_11(1,__context__) = 1;
+        __mka_11(2,__context__) = 2;
+        __mka_11(3,__context__) = 3;
+        return __mka_11;
+    })()));
+    int32_t * __pA_rename_at_12_7 = das_ref(__context__,__a_rename_at_11_6(1,__context__));
+    DAS_ASSERT((das_deref(__context__,__pA_rename_at_12_7,__FILE__,__LINE__) == 1));
+    das_ptr_inc(__pA_rename_at_12_7,4);
+    DAS_ASSERT((das_deref(__context__,__pA_rename_at_12_7,__FILE__,__LINE__) == 2));
+    das_ptr_dec(__pA_rename_at_12_7,4);
+    DAS_ASSERT((das_deref(__context__,__pA_rename_at_12_7,__FILE__,__LINE__) == 1));
+    DAS_ASSERT((das_index<int32_t *>::at(__pA_rename_at_12_7,__zero_rename_at_5_1,__context__) == 1));
+    DAS_ASSERT((das_index<int32_t *>::at(__pA_rename_at_12_7,__one_rename_at_6_2,__context__) == 2));
+    DAS_ASSERT((das_index<int32_t *>::at(__pA_rename_at_12_7,__neg_one_rename_at_9_5,__context__) == 0));
+    das_ptr_set_add_int32(__pA_rename_at_12_7,__two_rename_at_7_3,4);
+    DAS_ASSERT((das_deref(__context__,__pA_rename_at_12_7,__FILE__,__LINE__) == 3));
+    das_ptr_set_sub_int32(__pA_rename_at_12_7,__three_rename_at_8_4,4);
+    DAS_ASSERT((das_deref(__context__,__pA_rename_at_12_7,__FILE__,__LINE__) == 0));
+    DAS_ASSERT((das_deref(__context__,das_ptr_add_int32(__pA_rename_at_12_7,__two_rename_at_7_3,4),__FILE__,__LINE__) == 2));
+    das_ptr_set_add_int32(__pA_rename_at_12_7,2,4);
+    DAS_ASSERT((das_deref(__context__,das_ptr_sub_int32(__pA_rename_at_12_7,__one_rename_at_6_2,4),__FILE__,__LINE__) == 1));
+}
+
+inline void _FuncTicktest_signedTick5592047466636695339_15a8b6c97c8afaa4 ( Context * __context__, int64_t __t_rename_at_3_8 )
+{
+    int64_t __zero_rename_at_5_9 = INT64_C(0);
+    --__zero_rename_at_5_9;
+    ++__zero_rename_at_5_9;
+    int64_t __one_rename_at_6_10 = INT64_C(1);
+    --__one_rename_at_6_10;
+    ++__one_rename_at_6_10;
+    int64_t __two_rename_at_7_11 = INT64_C(2);
+    --__two_rename_at_7_11;
+    ++__two_rename_at_7_11;
+    int64_t __three_rename_at_8_12 = INT64_C(3);
+    --__three_rename_at_8_12;
+    ++__three_rename_at_8_12;
+    int64_t __neg_one_rename_at_9_13 = INT64_C(-1);
+    --__neg_one_rename_at_9_13;
+    ++__neg_one_rename_at_9_13;
+    TDim<int32_t,4> __a_rename_at_11_14; das_zero(__a_rename_at_11_14); das_move(__a_rename_at_11_14, (([&]() -> TDim<int32_t,4> {
+        TDim<int32_t,4> __mka_11;
+        __mka_11(0,__context__) = 0;
+        __mka_11(1,__context__) = 1;
+        __mka_11(2,__context__) = 2;
+        __mka_11(3,__context__) = 3;
+        return __mka_11;
+    })()));
+    int32_t * __pA_rename_at_12_15 = das_ref(__context__,__a_rename_at_11_14(1,__context__));
+    DAS_ASSERT((das_deref(__context__,__pA_rename_at_12_15,__FILE__,__LINE__) == 1));
+    das_ptr_inc(__pA_rename_at_12_15,4);
+    DAS_ASSERT((das_deref(__context__,__pA_rename_at_12_15,__FILE__,__LINE__) == 2));
+    das_ptr_dec(__pA_rename_at_12_15,4);
+    DAS_ASSERT((das_deref(__context__,__pA_rename_at_12_15,__FILE__,__LINE__) == 1));
+    DAS_ASSERT((das_index<int32_t *>::at(__pA_rename_at_12_15,__zero_rename_at_5_9,__context__) == 1));
+    DAS_ASSERT((das_index<int32_t *>::at(__pA_rename_at_12_15,__one_rename_at_6_10,__context__) == 2));
+    DAS_ASSERT((das_index<int32_t *>::at(__pA_rename_at_12_15,__neg_one_rename_at_9_13,__context__) == 0));
+    das_ptr_set_add_int64(__pA_rename_at_12_15,__two_rename_at_7_11,4);
+    DAS_ASSERT((das_deref(__context__,__pA_rename_at_12_15,__FILE__,__LINE__) == 3));
+    das_ptr_set_sub_int64(__pA_rename_at_12_15,__three_rename_at_8_12,4);
+    DAS_ASSERT((das_deref(__context__,__pA_rename_at_12_15,__FILE__,__LINE__) == 0));
+    DAS_ASSERT((das_deref(__context__,das_ptr_add_int64(__pA_rename_at_12_15,__two_rename_at_7_11,4),__FILE__,__LINE__) == 2));
+    das_ptr_set_add_int32(__pA_rename_at_12_15,2,4);
+    DAS_ASSERT((das_deref(__context__,das_ptr_sub_int64(__pA_rename_at_12_15,__one_rename_at_6_10,4),__FILE__,__LINE__) == 1));
+}
+
+inline void _FuncTicktest_unsignedTick8666044346459394471_a804a1f650cfca3c ( Context * __context__, uint32_t __t_rename_at_32_16 )
+{
+    uint32_t __zero_rename_at_34_17 = 0x0u;
+    --__zero_rename_at_34_17;
+    ++__zero_rename_at_34_17;
+    uint32_t __one_rename_at_35_18 = 0x1u;
+    --__one_rename_at_35_18;
+    ++__one_rename_at_35_18;
+    uint32_t __two_rename_at_36_19 = 0x2u;
+    --__two_rename_at_36_19;
+    ++__two_rename_at_36_19;
+    uint32_t __three_rename_at_37_20 = 0x3u;
+    --__three_rename_at_37_20;
+    ++__three_rename_at_37_20;
+    TDim<int32_t,4> __a_rename_at_39_21; das_zero(__a_rename_at_39_21); das_move(__a_rename_at_39_21, (([&]() -> TDim<int32_t,4> {
+        TDim<int32_t,4> __mka_39;
+        __mka_39(0,__context__) = 0;
+        __mka_39(1,__context__) = 1;
+        __mka_39(2,__context__) = 2;
+        __mka_39(3,__context__) = 3;
+        return __mka_39;
+    })()));
+    int32_t * __pA_rename_at_40_22 = das_ref(__context__,__a_rename_at_39_21(1,__context__));
+    DAS_ASSERT((das_deref(__context__,__pA_rename_at_40_22,__FILE__,__LINE__) == 1));
+    das_ptr_inc(__pA_rename_at_40_22,4);
+    DAS_ASSERT((das_deref(__context__,__pA_rename_at_40_22,__FILE__,__LINE__) == 2));
+    das_ptr_dec(__pA_rename_at_40_22,4);
+    DAS_ASSERT((das_deref(__context__,__pA_rename_at_40_22,__FILE__,__LINE__) == 1));
+    DAS_ASSERT((das_index<int32_t *>::at(__pA_rename_at_40_22,__zero_rename_at_34_17,__context__) == 1));
+    DAS_ASSERT((das_index<int32_t *>::at(__pA_rename_at_40_22,__one_rename_at_35_18,__context__) == 2));
+    das_ptr_set_add_uint32(__pA_rename_at_40_22,__two_rename_at_36_19,4);
+    DAS_ASSERT((das_deref(__context__,__pA_rename_at_40_22,__FILE__,__LINE__) == 3));
+    das_ptr_set_sub_uint32(__pA_rename_at_40_22,__three_rename_at_37_20,4);
+    DAS_ASSERT((das_deref(__context__,__pA_rename_at_40_22,__FILE__,__LINE__) == 0));
+    DAS_ASSERT((das_deref(__context__,das_ptr_add_uint32(__pA_rename_at_40_22,__two_rename_at_36_19,4),__FILE__,__LINE__) == 2));
+    das_ptr_set_add_int32(__pA_rename_at_40_22,2,4);
+    DAS_ASSERT((das_deref(__context__,das_ptr_sub_uint32(__pA_rename_at_40_22,__one_rename_at_35_18,4),__FILE__,__LINE__) == 1));
+}
+
+inline void _FuncTicktest_unsignedTick8666044346459394471_8078a693b5af2874 ( Context * __context__, uint64_t __t_rename_at_32_23 )
+{
+    uint64_t __zero_rename_at_34_24 = UINT64_C(0x0);
+    --__zero_rename_at_34_24;
+    ++__zero_rename_at_34_24;
+    uint64_t __one_rename_at_35_25 = UINT64_C(0x1);
+    --__one_rename_at_35_25;
+    ++__one_rename_at_35_25;
+    uint64_t __two_rename_at_36_26 = UINT64_C(0x2);
+    --__two_rename_at_36_26;
+    ++__two_rename_at_36_26;
+    uint64_t __three_rename_at_37_27 = UINT64_C(0x3);
+    --__three_rename_at_37_27;
+    ++__three_rename_at_37_27;
+    TDim<int32_t,4> __a_rename_at_39_28; das_zero(__a_rename_at_39_28); das_move(__a_rename_at_39_28, (([&]() -> TDim<int32_t,4> {
+        TDim<int32_t,4> __mka_39;
+        __mka_39(0,__context__) = 0;
+        __mka_39(1,__context__) = 1;
+        __mka_39(2,__context__) = 2;
+        __mka_39(3,__context__) = 3;
+        return __mka_39;
+    })()));
+    int32_t * __pA_rename_at_40_29 = das_ref(__context__,__a_rename_at_39_28(1,__context__));
+    DAS_ASSERT((das_deref(__context__,__pA_rename_at_40_29,__FILE__,__LINE__) == 1));
+    das_ptr_inc(__pA_rename_at_40_29,4);
+    DAS_ASSERT((das_deref(__context__,__pA_rename_at_40_29,__FILE__,__LINE__) == 2));
+    das_ptr_dec(__pA_rename_at_40_29,4);
+    DAS_ASSERT((das_deref(__context__,__pA_rename_at_40_29,__FILE__,__LINE__) == 1));
+    DAS_ASSERT((das_index<int32_t *>::at(__pA_rename_at_40_29,__zero_rename_at_34_24,__context__) == 1));
+    DAS_ASSERT((das_index<int32_t *>::at(__pA_rename_at_40_29,__one_rename_at_35_25,__context__) == 2));
+    das_ptr_set_add_uint64(__pA_rename_at_40_29,__two_rename_at_36_26,4);
+    DAS_ASSERT((das_deref(__context__,__pA_rename_at_40_29,__FILE__,__LINE__) == 3));
+    das_ptr_set_sub_uint64(__pA_rename_at_40_29,__three_rename_at_37_27,4);
+    DAS_ASSERT((das_deref(__context__,__pA_rename_at_40_29,__FILE__,__LINE__) == 0));
+    DAS_ASSERT((das_deref(__context__,das_ptr_add_uint64(__pA_rename_at_40_29,__two_rename_at_36_26,4),__FILE__,__LINE__) == 2));
+    das_ptr_set_add_int32(__pA_rename_at_40_29,2,4);
+    DAS_ASSERT((das_deref(__context__,das_ptr_sub_uint64(__pA_rename_at_40_29,__one_rename_at_35_25,4),__FILE__,__LINE__) == 1));
+}
+
+inline bool test_ed404c10817f85b6 ( Context * __context__ )
+{
+    _FuncTicktest_signedTick5592047466636695339_d6d5d3666de61361(__context__,das_typedecl_value<int32_t>()());
+    _FuncTicktest_signedTick5592047466636695339_15a8b6c97c8afaa4(__context__,das_typedecl_value<int64_t>()());
+    _FuncTicktest_unsignedTick8666044346459394471_a804a1f650cfca3c(__context__,das_typedecl_value<uint32_t>()());
+    _FuncTicktest_unsignedTick8666044346459394471_8078a693b5af2874(__context__,das_typedecl_value<uint64_t>()());
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncTicktest_signedTick5592047466636695339_d6d5d3666de61361 ( Context * __context__ ) {
+    int32_t arg_t = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_signedTick5592047466636695339_d6d5d3666de61361(__context__, arg_t);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_signedTick5592047466636695339_15a8b6c97c8afaa4 ( Context * __context__ ) {
+    int64_t arg_t = cast_aot_arg<int64_t>::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_signedTick5592047466636695339_15a8b6c97c8afaa4(__context__, arg_t);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_unsignedTick8666044346459394471_a804a1f650cfca3c ( Context * __context__ ) {
+    uint32_t arg_t = cast_aot_arg<uint32_t>::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_unsignedTick8666044346459394471_a804a1f650cfca3c(__context__, arg_t);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_unsignedTick8666044346459394471_8078a693b5af2874 ( Context * __context__ ) {
+    uint64_t arg_t = cast_aot_arg<uint64_t>::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_unsignedTick8666044346459394471_8078a693b5af2874(__context__, arg_t);
+    return v_zero();
+}
+static vec4f __wrap_test_ed404c10817f85b6 ( Context * __context__ ) {
+    return cast<bool>::from(test_ed404c10817f85b6(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x6d83dfd6dfa5faf5, false, (void*)&_FuncTicktest_signedTick5592047466636695339_d6d5d3666de61361, &__wrap__FuncTicktest_signedTick5592047466636695339_d6d5d3666de61361 },
+    { 0x6421b9eb3800fc14, false, (void*)&_FuncTicktest_signedTick5592047466636695339_15a8b6c97c8afaa4, &__wrap__FuncTicktest_signedTick5592047466636695339_15a8b6c97c8afaa4 },
+    { 0xb0b61e87518d9891, false, (void*)&_FuncTicktest_unsignedTick8666044346459394471_a804a1f650cfca3c, &__wrap__FuncTicktest_unsignedTick8666044346459394471_a804a1f650cfca3c },
+    { 0xa1f51801db0aa99f, false, (void*)&_FuncTicktest_unsignedTick8666044346459394471_8078a693b5af2874, &__wrap__FuncTicktest_unsignedTick8666044346459394471_8078a693b5af2874 },
+    { 0x56c11665b46ca5d5, false, (void*)&test_ed404c10817f85b6, &__wrap_test_ed404c10817f85b6 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_15088723007504144011
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,129 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14873896896148309654 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void fn_with_default_null_ptr_f8c6f8bb1ff4773d ( Context * __context__, int32_t * __a_rename_at_2_0 );
+inline bool test_cafaed83fc1cbf5c ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void fn_with_default_null_ptr_f8c6f8bb1ff4773d ( Context * __context__, int32_t * __a_rename_at_2_0 )
+{
+    int32_t __b_rename_at_3_1 = 0;
+    das_copy(das_null_coalescing<int32_t &>::get(__a_rename_at_2_0,__b_rename_at_3_1),2);
+}
+
+inline bool test_cafaed83fc1cbf5c ( Context * __context__ )
+{
+    TDim<int32_t,5> __t_rename_at_9_2_ConstRef = ((TDim<int32_t,5>)(([&]() -> TDim<int32_t,5> {
+        TDim<int32_t,5> __mka_9;
+        __mka_9(0,__context__) = 1;
+        __mka_9(1,__context__) = 2;
+        __mka_9(2,__context__) = 3;
+        __mka_9(3,__context__) = 4;
+        __mka_9(4,__context__) = 5;
+        return __mka_9;
+    })()));
+    TDim<int32_t,5> const  & __t_rename_at_9_2 = __t_rename_at_9_2_ConstRef;
+;
+    int32_t const  * __pt_rename_at_11_3 = ((int32_t const  *)das_ref(__context__,__t_rename_at_9_2(0,__context__)));
+    DAS_ASSERT((das_deref(__context__,__pt_rename_at_11_3,__FILE__,__LINE__) == 1));
+    DAS_ASSERT((((((das_index<int32_t const  * const >::at(__pt_rename_at_11_3,0,__context__) == 1) && (das_index<int32_t const  * const >::at(__pt_rename_at_11_3,1,__context__) == 2)) && (das_index<int32_t const  * const >::at(__pt_rename_at_11_3,2,__context__) == 3)) && (das_index<int32_t const  * const >::at(__pt_rename_at_11_3,3,__context__) == 4)) && (das_index<int32_t const  * const >::at(__pt_rename_at_11_3,4,__context__) == 5)));
+    fn_with_default_null_ptr_f8c6f8bb1ff4773d(__context__,das_auto_cast<int32_t *>::cast(nullptr));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_fn_with_default_null_ptr_f8c6f8bb1ff4773d ( Context * __context__ ) {
+    int32_t * arg_a = cast_aot_arg<int32_t *>::to(*__context__,__context__->abiArguments()[0]);
+    fn_with_default_null_ptr_f8c6f8bb1ff4773d(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap_test_cafaed83fc1cbf5c ( Context * __context__ ) {
+    return cast<bool>::from(test_cafaed83fc1cbf5c(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xdfd90179fcc16ab6, false, (void*)&fn_with_default_null_ptr_f8c6f8bb1ff4773d, &__wrap_fn_with_default_null_ptr_f8c6f8bb1ff4773d },
+    { 0xda1128d120efd91d, false, (void*)&test_cafaed83fc1cbf5c, &__wrap_test_cafaed83fc1cbf5c },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_14873896896148309654
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
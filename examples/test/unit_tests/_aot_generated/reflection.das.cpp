@@ -0,0 +1,1882 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_16322209504553669909 {
+
+namespace  { struct _lambda_thismodule_67_1; };
+namespace  { struct _lambda_thismodule_93_2; };
+namespace  { struct _lambda_thismodule_67_3; };
+namespace  { struct _lambda_thismodule_93_4; };
+namespace  { struct _lambda_thismodule_50_5; };
+namespace  { struct _lambda_thismodule_50_6; };
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+#if 0 // external enum
+namespace rtti {
+
+enum class Type : int32_t {
+    none = int32_t(INT64_C(0)),
+    autoinfer = int32_t(INT64_C(1)),
+    alias = int32_t(INT64_C(2)),
+    option = int32_t(INT64_C(3)),
+    typeDecl = int32_t(INT64_C(4)),
+    typeMacro = int32_t(INT64_C(5)),
+    fakeContext = int32_t(INT64_C(6)),
+    fakeLineInfo = int32_t(INT64_C(7)),
+    anyArgument = int32_t(INT64_C(8)),
+    tVoid = int32_t(INT64_C(9)),
+    tBool = int32_t(INT64_C(10)),
+    tInt8 = int32_t(INT64_C(11)),
+    tUInt8 = int32_t(INT64_C(12)),
+    tInt16 = int32_t(INT64_C(13)),
+    tUInt16 = int32_t(INT64_C(14)),
+    tInt64 = int32_t(INT64_C(15)),
+    tUInt64 = int32_t(INT64_C(16)),
+    tInt = int32_t(INT64_C(17)),
+    tInt2 = int32_t(INT64_C(18)),
+    tInt3 = int32_t(INT64_C(19)),
+    tInt4 = int32_t(INT64_C(20)),
+    tUInt = int32_t(INT64_C(21)),
+    tUInt2 = int32_t(INT64_C(22)),
+    tUInt3 = int32_t(INT64_C(23)),
+    tUInt4 = int32_t(INT64_C(24)),
+    tFloat = int32_t(INT64_C(25)),
+    tFloat2 = int32_t(INT64_C(26)),
+    tFloat3 = int32_t(INT64_C(27)),
+    tFloat4 = int32_t(INT64_C(28)),
+    tDouble = int32_t(INT64_C(29)),
+    tRange = int32_t(INT64_C(30)),
+    tURange = int32_t(INT64_C(31)),
+    tRange64 = int32_t(INT64_C(32)),
+    tURange64 = int32_t(INT64_C(33)),
+    tString = int32_t(INT64_C(34)),
+    tStructure = int32_t(INT64_C(35)),
+    tHandle = int32_t(INT64_C(36)),
+    tEnumeration = int32_t(INT64_C(37)),
+    tEnumeration8 = int32_t(INT64_C(38)),
+    tEnumeration16 = int32_t(INT64_C(39)),
+    tEnumeration64 = int32_t(INT64_C(40)),
+    tBitfield = int32_t(INT64_C(41)),
+    tBitfield8 = int32_t(INT64_C(42)),
+    tBitfield16 = int32_t(INT64_C(43)),
+    tBitfield64 = int32_t(INT64_C(44)),
+    tPointer = int32_t(INT64_C(45)),
+    tFunction = int32_t(INT64_C(46)),
+    tLambda = int32_t(INT64_C(47)),
+    tIterator = int32_t(INT64_C(48)),
+    tArray = int32_t(INT64_C(49)),
+    tTable = int32_t(INT64_C(50)),
+    tBlock = int32_t(INT64_C(51)),
+    tTuple = int32_t(INT64_C(52)),
+    tVariant = int32_t(INT64_C(53)),
+};
+}
+#endif // external enum
+// unused enumeration ConversionResult
+namespace  {
+
+struct _lambda_thismodule_67_1 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_67_1,TypeInfo const  * &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_67_1 *)) __finalize;
+    int32_t __yield;
+    VarInfo const  * pinfo;
+    bool ___loop_at_69_16_rename_at_69_16;
+    int32_t __index_rename_at_69_21;
+    void * ___pvar_0_at_69_16_rename_at_69_16;
+    Sequence DAS_COMMENT((int32_t)) ___source_0_at_69_16_rename_at_69_16;
+};
+static_assert(sizeof(_lambda_thismodule_67_1)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_67_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_67_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_67_1,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_67_1,pinfo)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_67_1,___loop_at_69_16_rename_at_69_16)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_67_1,__index_rename_at_69_21)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_67_1,___pvar_0_at_69_16_rename_at_69_16)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_67_1,___source_0_at_69_16_rename_at_69_16)==48,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_93_2 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_93_2,char * &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_93_2 *)) __finalize;
+    int32_t __yield;
+    VarInfo const  * pinfo;
+    bool ___loop_at_95_16_rename_at_95_16;
+    int32_t __index_rename_at_95_21;
+    void * ___pvar_0_at_95_16_rename_at_95_16;
+    Sequence DAS_COMMENT((int32_t)) ___source_0_at_95_16_rename_at_95_16;
+};
+static_assert(sizeof(_lambda_thismodule_93_2)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_2,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_2,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_2,pinfo)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_2,___loop_at_95_16_rename_at_95_16)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_2,__index_rename_at_95_21)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_2,___pvar_0_at_95_16_rename_at_95_16)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_2,___source_0_at_95_16_rename_at_95_16)==48,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_67_3 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_67_3,TypeInfo const  * &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_67_3 *)) __finalize;
+    int32_t __yield;
+    TypeInfo const  * pinfo;
+    bool ___loop_at_69_16_rename_at_69_16;
+    int32_t __index_rename_at_69_21;
+    void * ___pvar_0_at_69_16_rename_at_69_16;
+    Sequence DAS_COMMENT((int32_t)) ___source_0_at_69_16_rename_at_69_16;
+};
+static_assert(sizeof(_lambda_thismodule_67_3)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_67_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_67_3,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_67_3,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_67_3,pinfo)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_67_3,___loop_at_69_16_rename_at_69_16)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_67_3,__index_rename_at_69_21)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_67_3,___pvar_0_at_69_16_rename_at_69_16)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_67_3,___source_0_at_69_16_rename_at_69_16)==48,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_93_4 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_93_4,char * &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_93_4 *)) __finalize;
+    int32_t __yield;
+    TypeInfo const  * pinfo;
+    bool ___loop_at_95_16_rename_at_95_16;
+    int32_t __index_rename_at_95_21;
+    void * ___pvar_0_at_95_16_rename_at_95_16;
+    Sequence DAS_COMMENT((int32_t)) ___source_0_at_95_16_rename_at_95_16;
+};
+static_assert(sizeof(_lambda_thismodule_93_4)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_4,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_4,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_4,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_4,pinfo)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_4,___loop_at_95_16_rename_at_95_16)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_4,__index_rename_at_95_21)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_4,___pvar_0_at_95_16_rename_at_95_16)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_4,___source_0_at_95_16_rename_at_95_16)==48,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_50_5 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_50_5,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_50_5 *)) __finalize;
+    int32_t __yield;
+    VarInfo const  * pinfo;
+    bool _loop_at_50_28;
+    int32_t __index_rename_at_50_32;
+    void * _pvar_0_at_50_28;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_50_28;
+};
+static_assert(sizeof(_lambda_thismodule_50_5)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_5,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_5,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_5,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_5,pinfo)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_5,_loop_at_50_28)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_5,__index_rename_at_50_32)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_5,_pvar_0_at_50_28)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_5,_source_0_at_50_28)==48,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_50_6 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_50_6,int32_t &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_50_6 *)) __finalize;
+    int32_t __yield;
+    TypeInfo const  * pinfo;
+    bool _loop_at_50_28;
+    int32_t __index_rename_at_50_32;
+    void * _pvar_0_at_50_28;
+    Sequence DAS_COMMENT((int32_t)) _source_0_at_50_28;
+};
+static_assert(sizeof(_lambda_thismodule_50_6)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_6,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_6,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_6,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_6,pinfo)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_6,_loop_at_50_28)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_6,__index_rename_at_50_32)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_6,_pvar_0_at_50_28)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_6,_source_0_at_50_28)==48,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__c4e6f0916c2c5a10;
+extern StructInfo __struct_info__c4e6f3916c2c5f29;
+extern StructInfo __struct_info__75f7ec8daa9b6c63;
+extern StructInfo __struct_info__75f7ee8daa9b6fc9;
+extern StructInfo __struct_info__4a00857eca3ebbba;
+extern StructInfo __struct_info__4a007f7eca3eb188;
+extern TypeInfo __type_info__72adf46c1b19c293;
+extern TypeInfo __type_info__3bdf8339ef37753;
+extern TypeInfo __type_info__af8a9b4c8643c319;
+extern TypeInfo __type_info__af909b4c864df519;
+extern TypeInfo __type_info__af63a74c8601927d;
+extern TypeInfo __type_info__f0bd205ea4116bba;
+extern TypeInfo __type_info__f13d225ea4e245a5;
+extern TypeInfo __type_info__11479ca5f5923d97;
+extern TypeInfo __type_info__11469ca5f58ac445;
+extern TypeInfo __type_info__c09306eecff7fa5c;
+extern TypeInfo __type_info__c09486eed00bd9d2;
+extern TypeInfo __type_info__3c61146b2bdfb90;
+extern TypeInfo __type_info__624d371c76b25aa4;
+extern TypeInfo __type_info__bc67beb4aa160fd4;
+extern TypeInfo __type_info__c3770d5f54a928b3;
+extern TypeInfo __type_info__fa593d0882a72913;
+extern TypeInfo __type_info__30c29219b94673ab;
+extern TypeInfo __type_info__af81fe4c86352052;
+extern TypeInfo __type_info__af8afe4c86446b52;
+extern TypeInfo __type_info__8d8d8008262e16ec;
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__8afce1a80940fc9e;
+extern TypeInfo __type_info__125855d9cd771ead;
+extern TypeInfo __type_info__37d36026a6078a42;
+extern TypeInfo __type_info__ef8fa1d615a9cdcb;
+extern TypeInfo __type_info__ef8fa2d615a9cf7e;
+extern TypeInfo __type_info__c7659dd19bb28c28;
+extern TypeInfo __type_info__c7659fd19bb28f8e;
+extern TypeInfo __type_info__1db218ea2991f485;
+extern TypeInfo __type_info__1db212ea2991ea53;
+extern TypeInfo __type_info__af63df4c8601f1a5;
+extern TypeInfo __type_info__af63d94c8601e773;
+extern TypeInfo __type_info__af63db4c8601ead9;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__d922fe078cefab30;
+extern TypeInfo __type_info__af63ee4c86020b22;
+extern TypeInfo __type_info__af63e84c860200f0;
+extern TypeInfo __type_info__d9307e078cfb0f0c;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+TypeInfo * __type_info__38ef6c2fde388e11_arg_types_var_14188292183453096464[2] = { &__type_info__ef8fa1d615a9cdcb, &__type_info__af8a9b4c8643c319 };
+const char * __type_info__38ef6c2fde388e11_arg_names_var_14188292183453096464[2] = { "__this", "_yield_50" };
+VarInfo __struct_info__c4e6f0916c2c5a10_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__38ef6c2fde388e11_arg_types_var_14188292183453096464, __type_info__38ef6c2fde388e11_arg_names_var_14188292183453096464, 2, 0, nullptr, 12, 8, UINT64_C(0x38ef6c2fde388e11), "__lambda", 0, 0 };
+TypeInfo * __type_info__f67991cdb0393cd2_arg_types_var_14188292183453096464[1] = { &__type_info__f0bd205ea4116bba };
+const char * __type_info__f67991cdb0393cd2_arg_names_var_14188292183453096464[1] = { "__this" };
+VarInfo __struct_info__c4e6f0916c2c5a10_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__f67991cdb0393cd2_arg_types_var_14188292183453096464, __type_info__f67991cdb0393cd2_arg_names_var_14188292183453096464, 1, 0, nullptr, 12, 8, UINT64_C(0xf67991cdb0393cd2), "__finalize", 8, 0 };
+VarInfo __struct_info__c4e6f0916c2c5a10_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x2fffb756a2bc9e46), "__yield", 16, 0 };
+VarInfo __struct_info__c4e6f0916c2c5a10_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c3770d5f54a928b3, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x6ed8533c0246e34e), "pinfo", 24, 6 };
+VarInfo __struct_info__c4e6f0916c2c5a10_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xc42c41ce55e64f69), "_loop_at_50_28", 32, 0 };
+VarInfo __struct_info__c4e6f0916c2c5a10_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x20ed3eda329cb78d), "__index_rename_at_50_32", 36, 0 };
+VarInfo __struct_info__c4e6f0916c2c5a10_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x41a4b3e159bd45b6), "_pvar_0_at_50_28", 40, 7 };
+VarInfo __struct_info__c4e6f0916c2c5a10_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xb119d0bb8c858c5e), "_source_0_at_50_28", 48, 8 };
+VarInfo * __struct_info__c4e6f0916c2c5a10_fields[8] =  { &__struct_info__c4e6f0916c2c5a10_field_0, &__struct_info__c4e6f0916c2c5a10_field_1, &__struct_info__c4e6f0916c2c5a10_field_2, &__struct_info__c4e6f0916c2c5a10_field_3, &__struct_info__c4e6f0916c2c5a10_field_4, &__struct_info__c4e6f0916c2c5a10_field_5, &__struct_info__c4e6f0916c2c5a10_field_6, &__struct_info__c4e6f0916c2c5a10_field_7 };
+StructInfo __struct_info__c4e6f0916c2c5a10 = {"_lambda_thismodule_50_5", "", 14, __struct_info__c4e6f0916c2c5a10_fields, 8, 56, UINT64_C(0x0), nullptr, UINT64_C(0xc4e6f0916c2c5a10), 3 };
+TypeInfo * __type_info__ebce60adaf8a0e9e_arg_types_var_14188295481987981097[2] = { &__type_info__ef8fa2d615a9cf7e, &__type_info__af8a9b4c8643c319 };
+VarInfo __struct_info__c4e6f3916c2c5f29_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__ebce60adaf8a0e9e_arg_types_var_14188295481987981097, __type_info__38ef6c2fde388e11_arg_names_var_14188292183453096464, 2, 0, nullptr, 12, 8, UINT64_C(0xebce60adaf8a0e9e), "__lambda", 0, 0 };
+TypeInfo * __type_info__f8a79d9e0bb824a7_arg_types_var_14188295481987981097[1] = { &__type_info__f13d225ea4e245a5 };
+VarInfo __struct_info__c4e6f3916c2c5f29_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__f8a79d9e0bb824a7_arg_types_var_14188295481987981097, __type_info__f67991cdb0393cd2_arg_names_var_14188292183453096464, 1, 0, nullptr, 12, 8, UINT64_C(0xf8a79d9e0bb824a7), "__finalize", 8, 0 };
+VarInfo __struct_info__c4e6f3916c2c5f29_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x14fb3586b7b1b909), "__yield", 16, 0 };
+VarInfo __struct_info__c4e6f3916c2c5f29_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bc67beb4aa160fd4, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x61f052f8c5cdbb), "pinfo", 24, 6 };
+VarInfo __struct_info__c4e6f3916c2c5f29_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x6bccfef56bcc73b0), "_loop_at_50_28", 32, 0 };
+VarInfo __struct_info__c4e6f3916c2c5f29_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xad0d03769953813e), "__index_rename_at_50_32", 36, 0 };
+VarInfo __struct_info__c4e6f3916c2c5f29_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x517a717e5be32b4d), "_pvar_0_at_50_28", 40, 7 };
+VarInfo __struct_info__c4e6f3916c2c5f29_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x7e5e93b5aa91b2cb), "_source_0_at_50_28", 48, 8 };
+VarInfo * __struct_info__c4e6f3916c2c5f29_fields[8] =  { &__struct_info__c4e6f3916c2c5f29_field_0, &__struct_info__c4e6f3916c2c5f29_field_1, &__struct_info__c4e6f3916c2c5f29_field_2, &__struct_info__c4e6f3916c2c5f29_field_3, &__struct_info__c4e6f3916c2c5f29_field_4, &__struct_info__c4e6f3916c2c5f29_field_5, &__struct_info__c4e6f3916c2c5f29_field_6, &__struct_info__c4e6f3916c2c5f29_field_7 };
+StructInfo __struct_info__c4e6f3916c2c5f29 = {"_lambda_thismodule_50_6", "", 14, __struct_info__c4e6f3916c2c5f29_fields, 8, 56, UINT64_C(0x0), nullptr, UINT64_C(0xc4e6f3916c2c5f29), 3 };
+TypeInfo * __type_info__cd6fb173402e5e8c_arg_types_var_8500522914881956963[2] = { &__type_info__c7659dd19bb28c28, &__type_info__72adf46c1b19c293 };
+const char * __type_info__cd6fb173402e5e8c_arg_names_var_8500522914881956963[2] = { "__this", "_ryield67" };
+VarInfo __struct_info__75f7ec8daa9b6c63_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__cd6fb173402e5e8c_arg_types_var_8500522914881956963, __type_info__cd6fb173402e5e8c_arg_names_var_8500522914881956963, 2, 0, nullptr, 12, 8, UINT64_C(0xcd6fb173402e5e8c), "__lambda", 0, 0 };
+TypeInfo * __type_info__3cc4b93f3e5620b5_arg_types_var_8500522914881956963[1] = { &__type_info__11479ca5f5923d97 };
+VarInfo __struct_info__75f7ec8daa9b6c63_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__3cc4b93f3e5620b5_arg_types_var_8500522914881956963, __type_info__f67991cdb0393cd2_arg_names_var_14188292183453096464, 1, 0, nullptr, 12, 8, UINT64_C(0x3cc4b93f3e5620b5), "__finalize", 8, 0 };
+VarInfo __struct_info__75f7ec8daa9b6c63_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x685a564cf778b7df), "__yield", 16, 0 };
+VarInfo __struct_info__75f7ec8daa9b6c63_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c3770d5f54a928b3, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xf8a68d9ec5695499), "pinfo", 24, 6 };
+VarInfo __struct_info__75f7ec8daa9b6c63_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x4341f22f4409fd69), "___loop_at_69_16_rename_at_69_16", 32, 0 };
+VarInfo __struct_info__75f7ec8daa9b6c63_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xbf59fd651a209b6c), "__index_rename_at_69_21", 36, 0 };
+VarInfo __struct_info__75f7ec8daa9b6c63_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xe25dd06ed902719e), "___pvar_0_at_69_16_rename_at_69_16", 40, 7 };
+VarInfo __struct_info__75f7ec8daa9b6c63_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xa1dae1f8e97a046), "___source_0_at_69_16_rename_at_69_16", 48, 8 };
+VarInfo * __struct_info__75f7ec8daa9b6c63_fields[8] =  { &__struct_info__75f7ec8daa9b6c63_field_0, &__struct_info__75f7ec8daa9b6c63_field_1, &__struct_info__75f7ec8daa9b6c63_field_2, &__struct_info__75f7ec8daa9b6c63_field_3, &__struct_info__75f7ec8daa9b6c63_field_4, &__struct_info__75f7ec8daa9b6c63_field_5, &__struct_info__75f7ec8daa9b6c63_field_6, &__struct_info__75f7ec8daa9b6c63_field_7 };
+StructInfo __struct_info__75f7ec8daa9b6c63 = {"_lambda_thismodule_67_1", "", 14, __struct_info__75f7ec8daa9b6c63_fields, 8, 56, UINT64_C(0x0), nullptr, UINT64_C(0x75f7ec8daa9b6c63), 3 };
+TypeInfo * __type_info__ebf29e09f155a07e_arg_types_var_8500525113905213385[2] = { &__type_info__c7659fd19bb28f8e, &__type_info__72adf46c1b19c293 };
+VarInfo __struct_info__75f7ee8daa9b6fc9_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__ebf29e09f155a07e_arg_types_var_8500525113905213385, __type_info__cd6fb173402e5e8c_arg_names_var_8500522914881956963, 2, 0, nullptr, 12, 8, UINT64_C(0xebf29e09f155a07e), "__lambda", 0, 0 };
+TypeInfo * __type_info__bc348e16ace25607_arg_types_var_8500525113905213385[1] = { &__type_info__11469ca5f58ac445 };
+VarInfo __struct_info__75f7ee8daa9b6fc9_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__bc348e16ace25607_arg_types_var_8500525113905213385, __type_info__f67991cdb0393cd2_arg_names_var_14188292183453096464, 1, 0, nullptr, 12, 8, UINT64_C(0xbc348e16ace25607), "__finalize", 8, 0 };
+VarInfo __struct_info__75f7ee8daa9b6fc9_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x5c6c7332e81e6ae9), "__yield", 16, 0 };
+VarInfo __struct_info__75f7ee8daa9b6fc9_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bc67beb4aa160fd4, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xe40dd2c8beb3325b), "pinfo", 24, 6 };
+VarInfo __struct_info__75f7ee8daa9b6fc9_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x881bbc6e33e351f7), "___loop_at_69_16_rename_at_69_16", 32, 0 };
+VarInfo __struct_info__75f7ee8daa9b6fc9_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xcf2c945e64d9e2fa), "__index_rename_at_69_21", 36, 0 };
+VarInfo __struct_info__75f7ee8daa9b6fc9_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x3e3b329a0869b0e4), "___pvar_0_at_69_16_rename_at_69_16", 40, 7 };
+VarInfo __struct_info__75f7ee8daa9b6fc9_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xed592348ed89cd98), "___source_0_at_69_16_rename_at_69_16", 48, 8 };
+VarInfo * __struct_info__75f7ee8daa9b6fc9_fields[8] =  { &__struct_info__75f7ee8daa9b6fc9_field_0, &__struct_info__75f7ee8daa9b6fc9_field_1, &__struct_info__75f7ee8daa9b6fc9_field_2, &__struct_info__75f7ee8daa9b6fc9_field_3, &__struct_info__75f7ee8daa9b6fc9_field_4, &__struct_info__75f7ee8daa9b6fc9_field_5, &__struct_info__75f7ee8daa9b6fc9_field_6, &__struct_info__75f7ee8daa9b6fc9_field_7 };
+StructInfo __struct_info__75f7ee8daa9b6fc9 = {"_lambda_thismodule_67_3", "", 14, __struct_info__75f7ee8daa9b6fc9_fields, 8, 56, UINT64_C(0x0), nullptr, UINT64_C(0x75f7ee8daa9b6fc9), 3 };
+TypeInfo * __type_info__6b0e61a9ba34ee2f_arg_types_var_5332408738412149690[2] = { &__type_info__1db218ea2991f485, &__type_info__af909b4c864df519 };
+const char * __type_info__6b0e61a9ba34ee2f_arg_names_var_5332408738412149690[2] = { "__this", "_yield_93" };
+VarInfo __struct_info__4a00857eca3ebbba_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__6b0e61a9ba34ee2f_arg_types_var_5332408738412149690, __type_info__6b0e61a9ba34ee2f_arg_names_var_5332408738412149690, 2, 0, nullptr, 12, 8, UINT64_C(0x6b0e61a9ba34ee2f), "__lambda", 0, 0 };
+TypeInfo * __type_info__e8419d32aca5cdf0_arg_types_var_5332408738412149690[1] = { &__type_info__c09306eecff7fa5c };
+VarInfo __struct_info__4a00857eca3ebbba_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__e8419d32aca5cdf0_arg_types_var_5332408738412149690, __type_info__f67991cdb0393cd2_arg_names_var_14188292183453096464, 1, 0, nullptr, 12, 8, UINT64_C(0xe8419d32aca5cdf0), "__finalize", 8, 0 };
+VarInfo __struct_info__4a00857eca3ebbba_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xf5fdbc82fd1a9d9c), "__yield", 16, 0 };
+VarInfo __struct_info__4a00857eca3ebbba_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c3770d5f54a928b3, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x9d59e79ecae57df4), "pinfo", 24, 6 };
+VarInfo __struct_info__4a00857eca3ebbba_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x81df750946ff0d76), "___loop_at_95_16_rename_at_95_16", 32, 0 };
+VarInfo __struct_info__4a00857eca3ebbba_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xf02a4c6aa6fd9a26), "__index_rename_at_95_21", 36, 0 };
+VarInfo __struct_info__4a00857eca3ebbba_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xe872b9eece66ee07), "___pvar_0_at_95_16_rename_at_95_16", 40, 7 };
+VarInfo __struct_info__4a00857eca3ebbba_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xf33f310dd3c6cc15), "___source_0_at_95_16_rename_at_95_16", 48, 8 };
+VarInfo * __struct_info__4a00857eca3ebbba_fields[8] =  { &__struct_info__4a00857eca3ebbba_field_0, &__struct_info__4a00857eca3ebbba_field_1, &__struct_info__4a00857eca3ebbba_field_2, &__struct_info__4a00857eca3ebbba_field_3, &__struct_info__4a00857eca3ebbba_field_4, &__struct_info__4a00857eca3ebbba_field_5, &__struct_info__4a00857eca3ebbba_field_6, &__struct_info__4a00857eca3ebbba_field_7 };
+StructInfo __struct_info__4a00857eca3ebbba = {"_lambda_thismodule_93_2", "", 14, __struct_info__4a00857eca3ebbba_fields, 8, 56, UINT64_C(0x0), nullptr, UINT64_C(0x4a00857eca3ebbba), 3 };
+TypeInfo * __type_info__fc25ea562391bdc9_arg_types_var_5332402141342380424[2] = { &__type_info__1db212ea2991ea53, &__type_info__af909b4c864df519 };
+VarInfo __struct_info__4a007f7eca3eb188_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__fc25ea562391bdc9_arg_types_var_5332402141342380424, __type_info__6b0e61a9ba34ee2f_arg_names_var_5332408738412149690, 2, 0, nullptr, 12, 8, UINT64_C(0xfc25ea562391bdc9), "__lambda", 0, 0 };
+TypeInfo * __type_info__7658f005d651186a_arg_types_var_5332402141342380424[1] = { &__type_info__c09486eed00bd9d2 };
+VarInfo __struct_info__4a007f7eca3eb188_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__7658f005d651186a_arg_types_var_5332402141342380424, __type_info__f67991cdb0393cd2_arg_names_var_14188292183453096464, 1, 0, nullptr, 12, 8, UINT64_C(0x7658f005d651186a), "__finalize", 8, 0 };
+VarInfo __struct_info__4a007f7eca3eb188_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xa023552ea2784fae), "__yield", 16, 0 };
+VarInfo __struct_info__4a007f7eca3eb188_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bc67beb4aa160fd4, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xe6c3da2430968ae6), "pinfo", 24, 6 };
+VarInfo __struct_info__4a007f7eca3eb188_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x521c41bedcb29e74), "___loop_at_95_16_rename_at_95_16", 32, 0 };
+VarInfo __struct_info__4a007f7eca3eb188_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xe3412bb6f20920d8), "__index_rename_at_95_21", 36, 0 };
+VarInfo __struct_info__4a007f7eca3eb188_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x1f53426d4eb05e9d), "___pvar_0_at_95_16_rename_at_95_16", 40, 7 };
+VarInfo __struct_info__4a007f7eca3eb188_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xf50ff92ed97ac43f), "___source_0_at_95_16_rename_at_95_16", 48, 8 };
+VarInfo * __struct_info__4a007f7eca3eb188_fields[8] =  { &__struct_info__4a007f7eca3eb188_field_0, &__struct_info__4a007f7eca3eb188_field_1, &__struct_info__4a007f7eca3eb188_field_2, &__struct_info__4a007f7eca3eb188_field_3, &__struct_info__4a007f7eca3eb188_field_4, &__struct_info__4a007f7eca3eb188_field_5, &__struct_info__4a007f7eca3eb188_field_6, &__struct_info__4a007f7eca3eb188_field_7 };
+StructInfo __struct_info__4a007f7eca3eb188 = {"_lambda_thismodule_93_4", "", 14, __struct_info__4a007f7eca3eb188_fields, 8, 56, UINT64_C(0x0), nullptr, UINT64_C(0x4a007f7eca3eb188), 3 };
+VarInfo __func_info__289d11b1aa3d7f8d_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::Annotation"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8226, 88, UINT64_C(0x5a795bf1eb444fc5), "ann", 0, 0 };
+VarInfo * __func_info__289d11b1aa3d7f8d_fields[1] =  { &__func_info__289d11b1aa3d7f8d_field_0 };
+FuncInfo __func_info__289d11b1aa3d7f8d = {"invoke block<(ann:rtti::Annotation const):void> const", "", __func_info__289d11b1aa3d7f8d_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x289d11b1aa3d7f8d), 0x0 };
+VarInfo __func_info__27f8a37dac8fb462_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::Annotation"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8226, 88, UINT64_C(0x5a795bf1eb444fc5), "ann", 0, 0 };
+VarInfo __func_info__27f8a37dac8fb462_field_1 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::AnnotationArguments"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8226, 24, UINT64_C(0x770b4921acaa8b94), "annArgs", 0, 0 };
+VarInfo * __func_info__27f8a37dac8fb462_fields[2] =  { &__func_info__27f8a37dac8fb462_field_0, &__func_info__27f8a37dac8fb462_field_1 };
+FuncInfo __func_info__27f8a37dac8fb462 = {"invoke block<(ann:rtti::Annotation const;annArgs:rtti::AnnotationArguments const):void> const", "", __func_info__27f8a37dac8fb462_fields, 2, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x27f8a37dac8fb462), 0x0 };
+VarInfo __func_info__ba7c83312bca764c_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::EnumInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24622, 40, UINT64_C(0xe4511bb581eee251), "einfo", 0, 0 };
+VarInfo * __func_info__ba7c83312bca764c_fields[1] =  { &__func_info__ba7c83312bca764c_field_0 };
+FuncInfo __func_info__ba7c83312bca764c = {"invoke block<(einfo:rtti::EnumInfo const):void> const", "", __func_info__ba7c83312bca764c_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xba7c83312bca764c), 0x0 };
+VarInfo __func_info__9a52762bd43811a2_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::FuncInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24622, 80, UINT64_C(0x94c77f646d9e846b), "finfo", 0, 0 };
+VarInfo * __func_info__9a52762bd43811a2_fields[1] =  { &__func_info__9a52762bd43811a2_field_0 };
+FuncInfo __func_info__9a52762bd43811a2 = {"invoke block<(finfo:rtti::FuncInfo const):void> const", "", __func_info__9a52762bd43811a2_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x9a52762bd43811a2), 0x0 };
+VarInfo __func_info__a50d0dc0315d3958_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::VarInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24614, 128, UINT64_C(0xb391983f92841426), "glob", 0, 0 };
+VarInfo * __func_info__a50d0dc0315d3958_fields[1] =  { &__func_info__a50d0dc0315d3958_field_0 };
+FuncInfo __func_info__a50d0dc0315d3958 = {"invoke block<(glob:rtti::VarInfo const):void> const", "", __func_info__a50d0dc0315d3958_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xa50d0dc0315d3958), 0x0 };
+VarInfo __func_info__87a8802b687c8666_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::StructInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24622, 64, UINT64_C(0x9f81e1ae0818cd59), "sinfo", 0, 0 };
+VarInfo * __func_info__87a8802b687c8666_fields[1] =  { &__func_info__87a8802b687c8666_field_0 };
+FuncInfo __func_info__87a8802b687c8666 = {"invoke block<(sinfo:rtti::StructInfo const):void> const", "", __func_info__87a8802b687c8666_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x87a8802b687c8666), 0x0 };
+VarInfo __func_info__4dedd3fc50b439aa_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8afce1a80940fc9e, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xc9a6e7cc498a17c9), "mod", 0, 0 };
+VarInfo * __func_info__4dedd3fc50b439aa_fields[1] =  { &__func_info__4dedd3fc50b439aa_field_0 };
+FuncInfo __func_info__4dedd3fc50b439aa = {"invoke block<(var mod:rtti::Module?):void> const", "", __func_info__4dedd3fc50b439aa_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x4dedd3fc50b439aa), 0x0 };
+VarInfo __func_info__60bf4ac802ed24bd_field_0 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0x2a896b18ac8c5dc), "name", 0, 0 };
+VarInfo __func_info__60bf4ac802ed24bd_field_1 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0x1b2f537dda20b669), "cppName", 0, 0 };
+VarInfo __func_info__60bf4ac802ed24bd_field_2 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::TypeInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24622, 80, UINT64_C(0xc6451da5eba73f8c), "xtype", 0, 0 };
+VarInfo __func_info__60bf4ac802ed24bd_field_3 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xc3630b856e2c8315), "offset", 0, 0 };
+VarInfo * __func_info__60bf4ac802ed24bd_fields[4] =  { &__func_info__60bf4ac802ed24bd_field_0, &__func_info__60bf4ac802ed24bd_field_1, &__func_info__60bf4ac802ed24bd_field_2, &__func_info__60bf4ac802ed24bd_field_3 };
+FuncInfo __func_info__60bf4ac802ed24bd = {"invoke block<(var name:string;var cppName:string;xtype:rtti::TypeInfo const;var offset:uint):void> const", "", __func_info__60bf4ac802ed24bd_fields, 4, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x60bf4ac802ed24bd), 0x0 };
+VarInfo __func_info__84ca4769de27c8d7_field_0 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x865026081ff8017a), "ok", 0, 0 };
+VarInfo __func_info__84ca4769de27c8d7_field_1 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__125855d9cd771ead, nullptr, nullptr, nullptr, 0, 0, nullptr, 11264, 8, UINT64_C(0x345f32329d9a3470), "prog", 0, 0 };
+VarInfo __func_info__84ca4769de27c8d7_field_2 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 32, UINT64_C(0x7382dad8f58fd41e), "errors", 0, 0 };
+VarInfo * __func_info__84ca4769de27c8d7_fields[3] =  { &__func_info__84ca4769de27c8d7_field_0, &__func_info__84ca4769de27c8d7_field_1, &__func_info__84ca4769de27c8d7_field_2 };
+FuncInfo __func_info__84ca4769de27c8d7 = {"invoke block<(var ok:bool;var prog:smart_ptr<rtti::Program>;errors:$::das_string const):void> const", "", __func_info__84ca4769de27c8d7_fields, 3, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x84ca4769de27c8d7), 0x0 };
+VarInfo __func_info__73ae6d84f337cfd5_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::VarInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24614, 128, UINT64_C(0x7569f6dd247be00a), "vinfo", 0, 0 };
+VarInfo * __func_info__73ae6d84f337cfd5_fields[1] =  { &__func_info__73ae6d84f337cfd5_field_0 };
+FuncInfo __func_info__73ae6d84f337cfd5 = {"invoke block<(vinfo:rtti::VarInfo const):void> const", "", __func_info__73ae6d84f337cfd5_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x73ae6d84f337cfd5), 0x0 };
+TypeInfo __type_info__72adf46c1b19c293 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bc67beb4aa160fd4, nullptr, nullptr, nullptr, 0, 0, nullptr, 24845, 8, UINT64_C(0x72adf46c1b19c293) };
+TypeInfo __type_info__3bdf8339ef37753 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::Context"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24834, 736, UINT64_C(0x3bdf8339ef37753) };
+TypeInfo __type_info__af8a9b4c8643c319 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 4, UINT64_C(0xaf8a9b4c8643c319) };
+TypeInfo __type_info__af909b4c864df519 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16645, 8, UINT64_C(0xaf909b4c864df519) };
+TypeInfo __type_info__af63a74c8601927d = { Type::anyArgument, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 16, UINT64_C(0xaf63a74c8601927d) };
+TypeInfo __type_info__f0bd205ea4116bba = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ef8fa1d615a9cdcb, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xf0bd205ea4116bba) };
+TypeInfo __type_info__f13d225ea4e245a5 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ef8fa2d615a9cf7e, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xf13d225ea4e245a5) };
+TypeInfo __type_info__11479ca5f5923d97 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c7659dd19bb28c28, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x11479ca5f5923d97) };
+TypeInfo __type_info__11469ca5f58ac445 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c7659fd19bb28f8e, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x11469ca5f58ac445) };
+TypeInfo __type_info__c09306eecff7fa5c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1db218ea2991f485, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xc09306eecff7fa5c) };
+TypeInfo __type_info__c09486eed00bd9d2 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1db212ea2991ea53, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xc09486eed00bd9d2) };
+TypeInfo __type_info__3c61146b2bdfb90 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 290, 32, UINT64_C(0x3c61146b2bdfb90) };
+TypeInfo __type_info__624d371c76b25aa4 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 32, UINT64_C(0x624d371c76b25aa4) };
+TypeInfo __type_info__bc67beb4aa160fd4 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::TypeInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24622, 80, UINT64_C(0xbc67beb4aa160fd4) };
+TypeInfo __type_info__c3770d5f54a928b3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::VarInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24614, 128, UINT64_C(0xc3770d5f54a928b3) };
+TypeInfo __type_info__fa593d0882a72913 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16548, 8, UINT64_C(0xfa593d0882a72913) };
+TypeInfo * __type_info__30c29219b94673ab_arg_types[9] = { &__type_info__af63df4c8601f1a5, &__type_info__af63e44c8601fa24, &__type_info__af63e84c860200f0, &__type_info__d922fe078cefab30, &__type_info__d9307e078cfb0f0c, &__type_info__af63db4c8601ead9, &__type_info__af63d94c8601e773, &__type_info__af63ee4c86020b22, &__type_info__af63a74c8601927d };
+const char * __type_info__30c29219b94673ab_arg_names[9] = { "tBool", "tInt", "tUInt", "tInt64", "tUInt64", "tFloat", "tDouble", "tString", "nothing" };
+TypeInfo __type_info__30c29219b94673ab = { Type::tVariant, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__30c29219b94673ab_arg_types, __type_info__30c29219b94673ab_arg_names, 9, 0, nullptr, 16422, 32, UINT64_C(0x30c29219b94673ab) };
+TypeInfo __type_info__af81fe4c86352052 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 1, UINT64_C(0xaf81fe4c86352052) };
+TypeInfo __type_info__af8afe4c86446b52 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf8afe4c86446b52) };
+TypeInfo __type_info__8d8d8008262e16ec = { Type::tInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 8, UINT64_C(0x8d8d8008262e16ec) };
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__8afce1a80940fc9e = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::Module"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 1272, UINT64_C(0x8afce1a80940fc9e) };
+TypeInfo __type_info__125855d9cd771ead = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::Program"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8194, 800, UINT64_C(0x125855d9cd771ead) };
+TypeInfo __type_info__37d36026a6078a42 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 288, UINT64_C(0x37d36026a6078a42) };
+TypeInfo __type_info__ef8fa1d615a9cdcb = { Type::tStructure, &__struct_info__c4e6f0916c2c5a10, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 56, UINT64_C(0xef8fa1d615a9cdcb) };
+TypeInfo __type_info__ef8fa2d615a9cf7e = { Type::tStructure, &__struct_info__c4e6f3916c2c5f29, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 56, UINT64_C(0xef8fa2d615a9cf7e) };
+TypeInfo __type_info__c7659dd19bb28c28 = { Type::tStructure, &__struct_info__75f7ec8daa9b6c63, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 56, UINT64_C(0xc7659dd19bb28c28) };
+TypeInfo __type_info__c7659fd19bb28f8e = { Type::tStructure, &__struct_info__75f7ee8daa9b6fc9, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 56, UINT64_C(0xc7659fd19bb28f8e) };
+TypeInfo __type_info__1db218ea2991f485 = { Type::tStructure, &__struct_info__4a00857eca3ebbba, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 56, UINT64_C(0x1db218ea2991f485) };
+TypeInfo __type_info__1db212ea2991ea53 = { Type::tStructure, &__struct_info__4a007f7eca3eb188, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 56, UINT64_C(0x1db212ea2991ea53) };
+TypeInfo __type_info__af63df4c8601f1a5 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xaf63df4c8601f1a5) };
+TypeInfo __type_info__af63d94c8601e773 = { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0xaf63d94c8601e773) };
+TypeInfo __type_info__af63db4c8601ead9 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63db4c8601ead9) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__d922fe078cefab30 = { Type::tInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0xd922fe078cefab30) };
+TypeInfo __type_info__af63ee4c86020b22 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0xaf63ee4c86020b22) };
+TypeInfo __type_info__af63e84c860200f0 = { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e84c860200f0) };
+TypeInfo __type_info__d9307e078cfb0f0c = { Type::tUInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0xd9307e078cfb0f0c) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {__type_info__3bdf8339ef37753, __type_info__3c61146b2bdfb90, __type_info__624d371c76b25aa4, __type_info__bc67beb4aa160fd4, __type_info__c3770d5f54a928b3, __type_info__8afce1a80940fc9e, __type_info__125855d9cd771ead, __type_info__37d36026a6078a42, };
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__37d36026a6078a42, &__type_info__fa593d0882a72913 };
+TypeInfo * __tinfo_1[2] = { &__type_info__37d36026a6078a42, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_2[2] = { &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_3[3] = { &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_4[5] = { &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_5[3] = { &__type_info__af63ee4c86020b22, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_7[1] = { &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_8[3] = { &__type_info__af90fe4c864e9d52, &__type_info__af63e44c8601fa24, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_16[3] = { &__type_info__af90fe4c864e9d52, &__type_info__30c29219b94673ab, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_17[2] = { &__type_info__af90fe4c864e9d52, &__type_info__30c29219b94673ab };
+TypeInfo * __tinfo_19[5] = { &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52, &__type_info__8d8d8008262e16ec, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_20[2] = { &__type_info__3c61146b2bdfb90, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_21[5] = { &__type_info__af90fe4c864e9d52, &__type_info__3c61146b2bdfb90, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_23[7] = { &__type_info__af90fe4c864e9d52, &__type_info__3c61146b2bdfb90, &__type_info__af90fe4c864e9d52, &__type_info__af8afe4c86446b52, &__type_info__af90fe4c864e9d52, &__type_info__3c61146b2bdfb90, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_24[9] = { &__type_info__af90fe4c864e9d52, &__type_info__af63ee4c86020b22, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52, &__type_info__af63ee4c86020b22, &__type_info__af90fe4c864e9d52, &__type_info__af63e84c860200f0, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_25[4] = { &__type_info__3c61146b2bdfb90, &__type_info__af90fe4c864e9d52, &__type_info__3c61146b2bdfb90, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_31[6] = { &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_32[2] = { &__type_info__3bdf8339ef37753, &__type_info__af8afe4c86446b52 };
+TypeInfo * __tinfo_34[3] = { &__type_info__af90fe4c864e9d52, &__type_info__624d371c76b25aa4, &__type_info__af90fe4c864e9d52 };
+
+inline void _FuncbuiltinTickpushTick14133213201864676143_a73bd8f330e36d49 ( Context * __context__, TArray<char *> & __Arr_rename_at_177_0, char * const  __value_rename_at_177_1 );
+inline void finalize_24a9e4d37242f86d ( Context * __context__, _lambda_thismodule_50_5 & ____this_rename_at_50_2 );
+inline void finalize_474bf13230c79c11 ( Context * __context__, _lambda_thismodule_50_6 & ____this_rename_at_50_3 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 ( Context * __context__, range __rng_rename_at_1398_4 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickeachTick9663565701927713696_7393507a6ace41b7 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_1443_6 );
+inline void finalize_b0e96085ac978dbe ( Context * __context__, _lambda_thismodule_67_1 & ____this_rename_at_67_8 );
+inline void finalize_c00ee8297bf81f30 ( Context * __context__, _lambda_thismodule_93_2 & ____this_rename_at_93_9 );
+inline void finalize_4308d56959d2974a ( Context * __context__, _lambda_thismodule_67_3 & ____this_rename_at_67_10 );
+inline void finalize_2889c4bd2cc3cc56 ( Context * __context__, _lambda_thismodule_93_4 & ____this_rename_at_93_11 );
+inline Sequence DAS_COMMENT((TypeInfo &)) _FuncbuiltinTickeach_refTick16137060296763333387_97926cd17e20a9cf ( Context * __context__, Lambda DAS_COMMENT((bool,TypeInfo const  * &)) const  __lam_rename_at_1453_12 );
+inline Sequence DAS_COMMENT((char *)) _FuncbuiltinTickeachTick9663565701927713696_9ed40335195dc880 ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const  __lam_rename_at_1443_14 );
+inline bool _Func_lambda_thismodule_50_5Tickfunction_9387aa396f2ce340 ( Context * __context__, _lambda_thismodule_50_5 & ____this_rename_at_50_16, int32_t & ___yield_50_rename_at_50_17 );
+inline void _Func_lambda_thismodule_50_5Tickfinalizer_448ec9a3da4f5bd4 ( Context * __context__, _lambda_thismodule_50_5 * ____this_rename_at_50_18 );
+inline bool _Func_lambda_thismodule_50_6Tickfunction_98c5af6733d80450 ( Context * __context__, _lambda_thismodule_50_6 & ____this_rename_at_50_19, int32_t & ___yield_50_rename_at_50_20 );
+inline void _Func_lambda_thismodule_50_6Tickfinalizer_4bb490b13e3b830e ( Context * __context__, _lambda_thismodule_50_6 * ____this_rename_at_50_21 );
+inline bool _Func_lambda_thismodule_67_1Tickfunction_60cdebc1037daf21 ( Context * __context__, _lambda_thismodule_67_1 & ____this_rename_at_67_22, TypeInfo const  * & ___ryield67_rename_at_67_23 );
+inline void _Func_lambda_thismodule_67_1Tickfinalizer_2333384c9e7a84fe ( Context * __context__, _lambda_thismodule_67_1 * ____this_rename_at_67_24 );
+inline bool _Func_lambda_thismodule_93_2Tickfunction_48533abf83fa4085 ( Context * __context__, _lambda_thismodule_93_2 & ____this_rename_at_93_25, char * & ___yield_93_rename_at_93_26 );
+inline void _Func_lambda_thismodule_93_2Tickfinalizer_fadadfe49ae3c6f7 ( Context * __context__, _lambda_thismodule_93_2 * ____this_rename_at_93_27 );
+inline bool _Func_lambda_thismodule_67_3Tickfunction_444313c2c3267ff9 ( Context * __context__, _lambda_thismodule_67_3 & ____this_rename_at_67_28, TypeInfo const  * & ___ryield67_rename_at_67_29 );
+inline void _Func_lambda_thismodule_67_3Tickfinalizer_46e0845b8d2ca858 ( Context * __context__, _lambda_thismodule_67_3 * ____this_rename_at_67_30 );
+inline bool _Func_lambda_thismodule_93_4Tickfunction_c2da0f8ffa53c373 ( Context * __context__, _lambda_thismodule_93_4 & ____this_rename_at_93_31, char * & ___yield_93_rename_at_93_32 );
+inline void _Func_lambda_thismodule_93_4Tickfinalizer_8e614aabf63ba8bb ( Context * __context__, _lambda_thismodule_93_4 * ____this_rename_at_93_33 );
+inline Sequence DAS_COMMENT((TypeInfo &)) _FuncrttiTickarg_types_anyTick14095493126742042784_46727123b7eb020 ( Context * __context__, VarInfo const  & __info_rename_at_64_34 );
+inline Sequence DAS_COMMENT((char *)) _FuncrttiTickarg_names_anyTick16736947398500939560_59d12d50161e6c5c ( Context * __context__, VarInfo const  & __info_rename_at_90_36 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncrttiTickeach_dim_anyTick7498205270436711739_f57ed49982e2205 ( Context * __context__, VarInfo const  & __info_rename_at_47_38 );
+inline Sequence DAS_COMMENT((TypeInfo &)) _FuncrttiTickarg_types_anyTick14095493126742042784_d19129ef1dd72fde ( Context * __context__, TypeInfo const  & __info_rename_at_64_40 );
+inline Sequence DAS_COMMENT((char *)) _FuncrttiTickarg_names_anyTick16736947398500939560_ce11c8607242954c ( Context * __context__, TypeInfo const  & __info_rename_at_90_42 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncrttiTickeach_dim_anyTick7498205270436711739_ef47b7c87b5ff133 ( Context * __context__, TypeInfo const  & __info_rename_at_47_44 );
+inline Sequence DAS_COMMENT((TypeInfo &)) _FuncrttiTickarg_typesTick12838796147057657442_12d525ee0ebcad6f ( Context * __context__, VarInfo const  & __info_rename_at_86_46 );
+inline Sequence DAS_COMMENT((char *)) _FuncrttiTickarg_namesTick10261815503893967754_51136ffe9c269120 ( Context * __context__, VarInfo const  & __info_rename_at_112_47 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncrttiTickeach_dimTick2048201193529012380_9982c62daca5a59 ( Context * __context__, VarInfo const  & __info_rename_at_60_48 );
+inline Sequence DAS_COMMENT((TypeInfo &)) _FuncrttiTickarg_typesTick414029999383747864_e4299aa10a7435d9 ( Context * __context__, TypeInfo const  & __info_rename_at_81_49 );
+inline Sequence DAS_COMMENT((char *)) _FuncrttiTickarg_namesTick10966414128355233648_c020dc6e26805aac ( Context * __context__, TypeInfo const  & __info_rename_at_107_50 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncrttiTickeach_dimTick11222294146698882243_d327336d30e56eff ( Context * __context__, TypeInfo const  & __info_rename_at_55_51 );
+inline void _FuncbuiltinTickpushTick10769833213962245646_a54a33ebec8df23f ( Context * __context__, TArray<char *> & __Arr_rename_at_193_52, char * __value_rename_at_193_53 );
+inline char * _Funcstrings_boostTickjoinTick16475640899284277631_2d62f8289a864db9 ( Context * __context__, TArray<char *> const  & __it_rename_at_23_54, char * const  __separator_rename_at_23_55 );
+inline void _FuncrttiTickstructure_for_each_annotationTick2951685515295779335_57c658524fb72fdf ( Context * __context__, StructInfo const  & __st_rename_at_11_60, Block DAS_COMMENT((void,Annotation const ,AnnotationArguments const )) const  & __subexpr_rename_at_11_61 );
+inline char * _FuncTickdescribeTypeTick15052164352617426930_82419b0ccc63e613 ( Context * __context__, VarInfo const  & __info_rename_at_43_62 );
+inline char * _FuncTickdescribeTypeTick15052164352617426930_46590ad9462dbddc ( Context * __context__, TypeInfo const  & __info_rename_at_43_75 );
+inline char * _FuncTickdescribeValueTick7225869591395707454_47e978031a7114d3 ( Context * __context__, TVariant<32,16,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> const  & __value_rename_at_116_88 );
+inline void _FuncTickdescribeEnumerationTick10167141312159626520_b377a2f9bd48705b ( Context * __context__, EnumInfo const  & __einfo_rename_at_142_89 );
+inline void _FuncTickdescribeStructureTick10827907688821779217_eda31ba1077a5e27 ( Context * __context__, StructInfo const  & __sinfo_rename_at_130_91 );
+inline void _FuncTickdescribeAnnotationTick9021868495512338670_9766e6316c523899 ( Context * __context__, Annotation const  & __ann_rename_at_149_98 );
+inline void _FuncTickdescribeFunctionTick10530476277455359167_8ef153d4d9b5ddbb ( Context * __context__, FuncInfo const  & __finfo_rename_at_104_105 );
+inline void _FuncTickdescribeVariableTick4438727553851220500_aab40c005a49d26f ( Context * __context__, VarInfo const  & __glob_rename_at_126_109, char * const  __extra_rename_at_126_110 );
+inline void _FuncTickdescribeModuleTick5893429008970995053_3a044fca9cc79c00 ( Context * __context__, Module * const  __mod_rename_at_168_111 );
+inline void _FuncrttiTickcontext_for_each_functionTick10212946581910492173_5f9871bbe9c4befd ( Context * __context__, Block DAS_COMMENT((void,FuncInfo const )) const  & __blk_rename_at_34_118 );
+inline void _FuncrttiTickcontext_for_each_variableTick13583238681075032270_aca7b2c0db620890 ( Context * __context__, Block DAS_COMMENT((void,VarInfo const )) const  & __blk_rename_at_41_120 );
+inline bool main_44ff410c9eff378b ( Context * __context__ );
+inline bool test_b67965a0274f7c37 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global<char *,0x8dd62d230cec4301>(__context__) = ((char *) "\nrequire math\nrequire UnitTest\n\nlet\n    one_two = 12\n\nenum TestEnum\n    foo\n    bar\n\n[checkRange (foo=5)]\nstruct TestStruct\n    a : int = 5\n    b : string = \"something\"\n    c : float[3][4]\n    d : array<int>\n    e : table<float; string>\n    f : TestStruct?\n    g : tuple<int; float; string>\n    h : variant<i : int; f : float>\n    fn : function<(a:int;b:float):string>\n    lm : lambda<(a:int;b:float):string>\n\n[export]\ndef bar ( blk : block<(a:int):float> )\n    pass\n\n[export]\ndef main\n    print(\"hello world!\n\")\n    return true\n");/*sample*/
+}
+
+inline void _FuncbuiltinTickpushTick14133213201864676143_a73bd8f330e36d49 ( Context * __context__, TArray<char *> &  __Arr_rename_at_177_0, char * const  __value_rename_at_177_1 )
+{
+    das_copy(__Arr_rename_at_177_0(builtin_array_push_back(das_arg<TArray<char *>>::pass(__Arr_rename_at_177_0),8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_177_1);
+}
+
+inline void finalize_24a9e4d37242f86d ( Context * __context__, _lambda_thismodule_50_5 &  ____this_rename_at_50_2 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_50_2._source_0_at_50_28),__context__);
+    memset((void*)&(____this_rename_at_50_2), 0, 56);
+}
+
+inline void finalize_474bf13230c79c11 ( Context * __context__, _lambda_thismodule_50_6 &  ____this_rename_at_50_3 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_50_3._source_0_at_50_28),__context__);
+    memset((void*)&(____this_rename_at_50_3), 0, 56);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 ( Context * __context__, range __rng_rename_at_1398_4 )
+{
+    Sequence DAS_COMMENT((int32_t)) __it_rename_at_1399_5;das_zero(__it_rename_at_1399_5);
+    builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_1399_5),__rng_rename_at_1398_4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_1399_5);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickeachTick9663565701927713696_7393507a6ace41b7 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_1443_6 )
+{
+    Sequence DAS_COMMENT((int32_t)) __it_rename_at_1445_7;das_zero(__it_rename_at_1445_7);
+    builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_1445_7),__lam_rename_at_1443_6,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_1445_7);
+}
+
+inline void finalize_b0e96085ac978dbe ( Context * __context__, _lambda_thismodule_67_1 &  ____this_rename_at_67_8 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_67_8.___source_0_at_69_16_rename_at_69_16),__context__);
+    memset((void*)&(____this_rename_at_67_8), 0, 56);
+}
+
+inline void finalize_c00ee8297bf81f30 ( Context * __context__, _lambda_thismodule_93_2 &  ____this_rename_at_93_9 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_93_9.___source_0_at_95_16_rename_at_95_16),__context__);
+    memset((void*)&(____this_rename_at_93_9), 0, 56);
+}
+
+inline void finalize_4308d56959d2974a ( Context * __context__, _lambda_thismodule_67_3 &  ____this_rename_at_67_10 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_67_10.___source_0_at_69_16_rename_at_69_16),__context__);
+    memset((void*)&(____this_rename_at_67_10), 0, 56);
+}
+
+inline void finalize_2889c4bd2cc3cc56 ( Context * __context__, _lambda_thismodule_93_4 &  ____this_rename_at_93_11 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_93_11.___source_0_at_95_16_rename_at_95_16),__context__);
+    memset((void*)&(____this_rename_at_93_11), 0, 56);
+}
+
+inline Sequence DAS_COMMENT((TypeInfo &)) _FuncbuiltinTickeach_refTick16137060296763333387_97926cd17e20a9cf ( Context * __context__, Lambda DAS_COMMENT((bool,TypeInfo const  * &)) const  __lam_rename_at_1453_12 )
+{
+    Sequence DAS_COMMENT((TypeInfo *)) __it_rename_at_1454_13;das_zero(__it_rename_at_1454_13);
+    builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TypeInfo const ))>::pass(__it_rename_at_1454_13),__lam_rename_at_1453_12,8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TypeInfo &))>::cast(__it_rename_at_1454_13);
+}
+
+inline Sequence DAS_COMMENT((char *)) _FuncbuiltinTickeachTick9663565701927713696_9ed40335195dc880 ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const  __lam_rename_at_1443_14 )
+{
+    Sequence DAS_COMMENT((char *)) __it_rename_at_1445_15;das_zero(__it_rename_at_1445_15);
+    builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((char *))>::pass(__it_rename_at_1445_15),__lam_rename_at_1443_14,8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char *))>::cast(__it_rename_at_1445_15);
+}
+
+inline bool _Func_lambda_thismodule_50_5Tickfunction_9387aa396f2ce340 ( Context * __context__, _lambda_thismodule_50_5 &  ____this_rename_at_50_16, int32_t & ___yield_50_rename_at_50_17 )
+{
+    switch (____this_rename_at_50_16.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_50_16._loop_at_50_28,true);
+    das_move(____this_rename_at_50_16._source_0_at_50_28,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,mk_range(int32_t(____this_rename_at_50_16.pinfo->dimSize /*dimSize*/))));
+    memset((void*)&(____this_rename_at_50_16.__index_rename_at_50_32), 0, 4);
+    das_copy(____this_rename_at_50_16._pvar_0_at_50_28,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_50_16.__index_rename_at_50_32)));
+    DAS_SETBOOLAND((____this_rename_at_50_16._loop_at_50_28),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_50_16._source_0_at_50_28),____this_rename_at_50_16._pvar_0_at_50_28,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_50_16._loop_at_50_28 )
+    {
+        goto label_4;
+    };
+    das_copy(___yield_50_rename_at_50_17,rtti_getDimVarInfo(das_deref(__context__,____this_rename_at_50_16.pinfo,__FILE__,__LINE__),____this_rename_at_50_16.__index_rename_at_50_32,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+    das_copy(____this_rename_at_50_16.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_50_16._loop_at_50_28),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_50_16._source_0_at_50_28),____this_rename_at_50_16._pvar_0_at_50_28,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_50_16._source_0_at_50_28),____this_rename_at_50_16._pvar_0_at_50_28,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_50_5Tickfinalizer_448ec9a3da4f5bd4 ( Context * __context__, _lambda_thismodule_50_5 * ____this_rename_at_50_18 )
+{
+    finalize_24a9e4d37242f86d(__context__,das_arg<_lambda_thismodule_50_5>::pass(das_deref(__context__,____this_rename_at_50_18,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_50_5 *>::clear(__context__,____this_rename_at_50_18);
+}
+
+inline bool _Func_lambda_thismodule_50_6Tickfunction_98c5af6733d80450 ( Context * __context__, _lambda_thismodule_50_6 &  ____this_rename_at_50_19, int32_t & ___yield_50_rename_at_50_20 )
+{
+    switch (____this_rename_at_50_19.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    das_copy(____this_rename_at_50_19._loop_at_50_28,true);
+    das_move(____this_rename_at_50_19._source_0_at_50_28,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,mk_range(int32_t(____this_rename_at_50_19.pinfo->dimSize /*dimSize*/))));
+    memset((void*)&(____this_rename_at_50_19.__index_rename_at_50_32), 0, 4);
+    das_copy(____this_rename_at_50_19._pvar_0_at_50_28,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_50_19.__index_rename_at_50_32)));
+    DAS_SETBOOLAND((____this_rename_at_50_19._loop_at_50_28),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_50_19._source_0_at_50_28),____this_rename_at_50_19._pvar_0_at_50_28,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_50_19._loop_at_50_28 )
+    {
+        goto label_4;
+    };
+    das_copy(___yield_50_rename_at_50_20,rtti_getDimTypeInfo(das_deref(__context__,____this_rename_at_50_19.pinfo,__FILE__,__LINE__),____this_rename_at_50_19.__index_rename_at_50_32,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+    das_copy(____this_rename_at_50_19.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_50_19._loop_at_50_28),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_50_19._source_0_at_50_28),____this_rename_at_50_19._pvar_0_at_50_28,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_50_19._source_0_at_50_28),____this_rename_at_50_19._pvar_0_at_50_28,__context__);
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_50_6Tickfinalizer_4bb490b13e3b830e ( Context * __context__, _lambda_thismodule_50_6 * ____this_rename_at_50_21 )
+{
+    finalize_474bf13230c79c11(__context__,das_arg<_lambda_thismodule_50_6>::pass(das_deref(__context__,____this_rename_at_50_21,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_50_6 *>::clear(__context__,____this_rename_at_50_21);
+}
+
+inline bool _Func_lambda_thismodule_67_1Tickfunction_60cdebc1037daf21 ( Context * __context__, _lambda_thismodule_67_1 &  ____this_rename_at_67_22, TypeInfo const  * & ___ryield67_rename_at_67_23 )
+{
+    switch (____this_rename_at_67_22.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    case 5: goto label_5;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    if ( !(____this_rename_at_67_22.pinfo->argTypes /*argTypes*/ != nullptr) )
+    {
+        goto label_5;
+    };
+    das_copy(____this_rename_at_67_22.___loop_at_69_16_rename_at_69_16,true);
+    das_move(____this_rename_at_67_22.___source_0_at_69_16_rename_at_69_16,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,mk_range(int32_t(____this_rename_at_67_22.pinfo->argCount /*argCount*/))));
+    memset((void*)&(____this_rename_at_67_22.__index_rename_at_69_21), 0, 4);
+    das_copy(____this_rename_at_67_22.___pvar_0_at_69_16_rename_at_69_16,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_67_22.__index_rename_at_69_21)));
+    DAS_SETBOOLAND((____this_rename_at_67_22.___loop_at_69_16_rename_at_69_16),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_67_22.___source_0_at_69_16_rename_at_69_16),____this_rename_at_67_22.___pvar_0_at_69_16_rename_at_69_16,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_67_22.___loop_at_69_16_rename_at_69_16 )
+    {
+        goto label_4;
+    };
+    das_copy(___ryield67_rename_at_67_23,das_ref(__context__,das_deref(__context__,das_index<TypeInfo * * const >::at(____this_rename_at_67_22.pinfo->argTypes /*argTypes*/,____this_rename_at_67_22.__index_rename_at_69_21,__context__),__FILE__,__LINE__)));
+    das_copy(____this_rename_at_67_22.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_67_22.___loop_at_69_16_rename_at_69_16),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_67_22.___source_0_at_69_16_rename_at_69_16),____this_rename_at_67_22.___pvar_0_at_69_16_rename_at_69_16,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_67_22.___source_0_at_69_16_rename_at_69_16),____this_rename_at_67_22.___pvar_0_at_69_16_rename_at_69_16,__context__);
+    label_5:;;
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_67_1Tickfinalizer_2333384c9e7a84fe ( Context * __context__, _lambda_thismodule_67_1 * ____this_rename_at_67_24 )
+{
+    finalize_b0e96085ac978dbe(__context__,das_arg<_lambda_thismodule_67_1>::pass(das_deref(__context__,____this_rename_at_67_24,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_67_1 *>::clear(__context__,____this_rename_at_67_24);
+}
+
+inline bool _Func_lambda_thismodule_93_2Tickfunction_48533abf83fa4085 ( Context * __context__, _lambda_thismodule_93_2 &  ____this_rename_at_93_25, char * & ___yield_93_rename_at_93_26 )
+{
+    switch (____this_rename_at_93_25.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    case 5: goto label_5;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    if ( !(____this_rename_at_93_25.pinfo->argNames /*argNames*/ != nullptr) )
+    {
+        goto label_5;
+    };
+    das_copy(____this_rename_at_93_25.___loop_at_95_16_rename_at_95_16,true);
+    das_move(____this_rename_at_93_25.___source_0_at_95_16_rename_at_95_16,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,mk_range(int32_t(____this_rename_at_93_25.pinfo->argCount /*argCount*/))));
+    memset((void*)&(____this_rename_at_93_25.__index_rename_at_95_21), 0, 4);
+    das_copy(____this_rename_at_93_25.___pvar_0_at_95_16_rename_at_95_16,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_93_25.__index_rename_at_95_21)));
+    DAS_SETBOOLAND((____this_rename_at_93_25.___loop_at_95_16_rename_at_95_16),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_93_25.___source_0_at_95_16_rename_at_95_16),____this_rename_at_93_25.___pvar_0_at_95_16_rename_at_95_16,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_93_25.___loop_at_95_16_rename_at_95_16 )
+    {
+        goto label_4;
+    };
+    das_copy(___yield_93_rename_at_93_26,das_index<char * const  * const >::at(____this_rename_at_93_25.pinfo->argNames /*argNames*/,____this_rename_at_93_25.__index_rename_at_95_21,__context__));
+    das_copy(____this_rename_at_93_25.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_93_25.___loop_at_95_16_rename_at_95_16),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_93_25.___source_0_at_95_16_rename_at_95_16),____this_rename_at_93_25.___pvar_0_at_95_16_rename_at_95_16,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_93_25.___source_0_at_95_16_rename_at_95_16),____this_rename_at_93_25.___pvar_0_at_95_16_rename_at_95_16,__context__);
+    label_5:;;
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_93_2Tickfinalizer_fadadfe49ae3c6f7 ( Context * __context__, _lambda_thismodule_93_2 * ____this_rename_at_93_27 )
+{
+    finalize_c00ee8297bf81f30(__context__,das_arg<_lambda_thismodule_93_2>::pass(das_deref(__context__,____this_rename_at_93_27,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_93_2 *>::clear(__context__,____this_rename_at_93_27);
+}
+
+inline bool _Func_lambda_thismodule_67_3Tickfunction_444313c2c3267ff9 ( Context * __context__, _lambda_thismodule_67_3 &  ____this_rename_at_67_28, TypeInfo const  * & ___ryield67_rename_at_67_29 )
+{
+    switch (____this_rename_at_67_28.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    case 5: goto label_5;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    if ( !(____this_rename_at_67_28.pinfo->argTypes /*argTypes*/ != nullptr) )
+    {
+        goto label_5;
+    };
+    das_copy(____this_rename_at_67_28.___loop_at_69_16_rename_at_69_16,true);
+    das_move(____this_rename_at_67_28.___source_0_at_69_16_rename_at_69_16,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,mk_range(int32_t(____this_rename_at_67_28.pinfo->argCount /*argCount*/))));
+    memset((void*)&(____this_rename_at_67_28.__index_rename_at_69_21), 0, 4);
+    das_copy(____this_rename_at_67_28.___pvar_0_at_69_16_rename_at_69_16,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_67_28.__index_rename_at_69_21)));
+    DAS_SETBOOLAND((____this_rename_at_67_28.___loop_at_69_16_rename_at_69_16),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_67_28.___source_0_at_69_16_rename_at_69_16),____this_rename_at_67_28.___pvar_0_at_69_16_rename_at_69_16,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_67_28.___loop_at_69_16_rename_at_69_16 )
+    {
+        goto label_4;
+    };
+    das_copy(___ryield67_rename_at_67_29,das_ref(__context__,das_deref(__context__,das_index<TypeInfo * * const >::at(____this_rename_at_67_28.pinfo->argTypes /*argTypes*/,____this_rename_at_67_28.__index_rename_at_69_21,__context__),__FILE__,__LINE__)));
+    das_copy(____this_rename_at_67_28.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_67_28.___loop_at_69_16_rename_at_69_16),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_67_28.___source_0_at_69_16_rename_at_69_16),____this_rename_at_67_28.___pvar_0_at_69_16_rename_at_69_16,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_67_28.___source_0_at_69_16_rename_at_69_16),____this_rename_at_67_28.___pvar_0_at_69_16_rename_at_69_16,__context__);
+    label_5:;;
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_67_3Tickfinalizer_46e0845b8d2ca858 ( Context * __context__, _lambda_thismodule_67_3 * ____this_rename_at_67_30 )
+{
+    finalize_4308d56959d2974a(__context__,das_arg<_lambda_thismodule_67_3>::pass(das_deref(__context__,____this_rename_at_67_30,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_67_3 *>::clear(__context__,____this_rename_at_67_30);
+}
+
+inline bool _Func_lambda_thismodule_93_4Tickfunction_c2da0f8ffa53c373 ( Context * __context__, _lambda_thismodule_93_4 &  ____this_rename_at_93_31, char * & ___yield_93_rename_at_93_32 )
+{
+    switch (____this_rename_at_93_31.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    case 5: goto label_5;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    if ( !(____this_rename_at_93_31.pinfo->argNames /*argNames*/ != nullptr) )
+    {
+        goto label_5;
+    };
+    das_copy(____this_rename_at_93_31.___loop_at_95_16_rename_at_95_16,true);
+    das_move(____this_rename_at_93_31.___source_0_at_95_16_rename_at_95_16,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,mk_range(int32_t(____this_rename_at_93_31.pinfo->argCount /*argCount*/))));
+    memset((void*)&(____this_rename_at_93_31.__index_rename_at_95_21), 0, 4);
+    das_copy(____this_rename_at_93_31.___pvar_0_at_95_16_rename_at_95_16,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_93_31.__index_rename_at_95_21)));
+    DAS_SETBOOLAND((____this_rename_at_93_31.___loop_at_95_16_rename_at_95_16),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_93_31.___source_0_at_95_16_rename_at_95_16),____this_rename_at_93_31.___pvar_0_at_95_16_rename_at_95_16,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_93_31.___loop_at_95_16_rename_at_95_16 )
+    {
+        goto label_4;
+    };
+    das_copy(___yield_93_rename_at_93_32,das_index<char * const  * const >::at(____this_rename_at_93_31.pinfo->argNames /*argNames*/,____this_rename_at_93_31.__index_rename_at_95_21,__context__));
+    das_copy(____this_rename_at_93_31.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_93_31.___loop_at_95_16_rename_at_95_16),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_93_31.___source_0_at_95_16_rename_at_95_16),____this_rename_at_93_31.___pvar_0_at_95_16_rename_at_95_16,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_93_31.___source_0_at_95_16_rename_at_95_16),____this_rename_at_93_31.___pvar_0_at_95_16_rename_at_95_16,__context__);
+    label_5:;;
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_93_4Tickfinalizer_8e614aabf63ba8bb ( Context * __context__, _lambda_thismodule_93_4 * ____this_rename_at_93_33 )
+{
+    finalize_2889c4bd2cc3cc56(__context__,das_arg<_lambda_thismodule_93_4>::pass(das_deref(__context__,____this_rename_at_93_33,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_93_4 *>::clear(__context__,____this_rename_at_93_33);
+}
+
+inline Sequence DAS_COMMENT((TypeInfo &)) _FuncrttiTickarg_types_anyTick14095493126742042784_46727123b7eb020 ( Context * __context__, VarInfo const  &  __info_rename_at_64_34 )
+{
+    VarInfo const  * __pinfo_rename_at_66_35 = ((VarInfo const  *)das_ref(__context__,__info_rename_at_64_34));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TypeInfo &))>::cast(_FuncbuiltinTickeach_refTick16137060296763333387_97926cd17e20a9cf(__context__,das_ascend<bool,_lambda_thismodule_67_1>::make(__context__,&__type_info__c7659dd19bb28c28,(([&]() -> _lambda_thismodule_67_1 {
+        _lambda_thismodule_67_1 __mks_67;
+        das_zero(__mks_67);
+        das_copy((__mks_67.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_67_1`function XS<_lambda_thismodule_67_1> &1<CH<rtti::TypeInfo>>?*/ 0x58f4be00ceddf59d))));
+        das_copy((__mks_67.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_67_1`finalizer X1<S<_lambda_thismodule_67_1>>?*/ 0xebdff9daa7e0d6df))));
+        das_copy((__mks_67.pinfo),(__pinfo_rename_at_66_35));
+        return __mks_67;
+    })()))));
+}
+
+inline Sequence DAS_COMMENT((char *)) _FuncrttiTickarg_names_anyTick16736947398500939560_59d12d50161e6c5c ( Context * __context__, VarInfo const  &  __info_rename_at_90_36 )
+{
+    VarInfo const  * __pinfo_rename_at_92_37 = ((VarInfo const  *)das_ref(__context__,__info_rename_at_90_36));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char *))>::cast(_FuncbuiltinTickeachTick9663565701927713696_9ed40335195dc880(__context__,das_ascend<bool,_lambda_thismodule_93_2>::make(__context__,&__type_info__1db218ea2991f485,(([&]() -> _lambda_thismodule_93_2 {
+        _lambda_thismodule_93_2 __mks_93;
+        das_zero(__mks_93);
+        das_copy((__mks_93.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_93_2`function XS<_lambda_thismodule_93_2> &s*/ 0x1fa797d3d2bd7568))));
+        das_copy((__mks_93.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_93_2`finalizer X1<S<_lambda_thismodule_93_2>>?*/ 0x4633ba9e9955e5cb))));
+        das_copy((__mks_93.pinfo),(__pinfo_rename_at_92_37));
+        return __mks_93;
+    })()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncrttiTickeach_dim_anyTick7498205270436711739_f57ed49982e2205 ( Context * __context__, VarInfo const  &  __info_rename_at_47_38 )
+{
+    VarInfo const  * __pinfo_rename_at_49_39 = ((VarInfo const  *)das_ref(__context__,__info_rename_at_47_38));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_FuncbuiltinTickeachTick9663565701927713696_7393507a6ace41b7(__context__,das_ascend<bool,_lambda_thismodule_50_5>::make(__context__,&__type_info__ef8fa1d615a9cdcb,(([&]() -> _lambda_thismodule_50_5 {
+        _lambda_thismodule_50_5 __mks_50;
+        das_zero(__mks_50);
+        das_copy((__mks_50.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_50_5`function XS<_lambda_thismodule_50_5> &i*/ 0x71f9a921ecc7962e))));
+        das_copy((__mks_50.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_50_5`finalizer X1<S<_lambda_thismodule_50_5>>?*/ 0x7a22e5cb3a53d7d1))));
+        das_copy((__mks_50.pinfo),(__pinfo_rename_at_49_39));
+        return __mks_50;
+    })()))));
+}
+
+inline Sequence DAS_COMMENT((TypeInfo &)) _FuncrttiTickarg_types_anyTick14095493126742042784_d19129ef1dd72fde ( Context * __context__, TypeInfo const  &  __info_rename_at_64_40 )
+{
+    TypeInfo const  * __pinfo_rename_at_66_41 = ((TypeInfo const  *)das_ref(__context__,__info_rename_at_64_40));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TypeInfo &))>::cast(_FuncbuiltinTickeach_refTick16137060296763333387_97926cd17e20a9cf(__context__,das_ascend<bool,_lambda_thismodule_67_3>::make(__context__,&__type_info__c7659fd19bb28f8e,(([&]() -> _lambda_thismodule_67_3 {
+        _lambda_thismodule_67_3 __mks_67;
+        das_zero(__mks_67);
+        das_copy((__mks_67.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_67_3`function XS<_lambda_thismodule_67_3> &1<CH<rtti::TypeInfo>>?*/ 0x6dddb30eaa778d51))));
+        das_copy((__mks_67.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_67_3`finalizer X1<S<_lambda_thismodule_67_3>>?*/ 0xe93e4446b7e188ad))));
+        das_copy((__mks_67.pinfo),(__pinfo_rename_at_66_41));
+        return __mks_67;
+    })()))));
+}
+
+inline Sequence DAS_COMMENT((char *)) _FuncrttiTickarg_names_anyTick16736947398500939560_ce11c8607242954c ( Context * __context__, TypeInfo const  &  __info_rename_at_90_42 )
+{
+    TypeInfo const  * __pinfo_rename_at_92_43 = ((TypeInfo const  *)das_ref(__context__,__info_rename_at_90_42));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char *))>::cast(_FuncbuiltinTickeachTick9663565701927713696_9ed40335195dc880(__context__,das_ascend<bool,_lambda_thismodule_93_4>::make(__context__,&__type_info__1db212ea2991ea53,(([&]() -> _lambda_thismodule_93_4 {
+        _lambda_thismodule_93_4 __mks_93;
+        das_zero(__mks_93);
+        das_copy((__mks_93.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_93_4`function XS<_lambda_thismodule_93_4> &s*/ 0x4555d4d1ee1fec44))));
+        das_copy((__mks_93.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_93_4`finalizer X1<S<_lambda_thismodule_93_4>>?*/ 0x76e65f6ca3ae013d))));
+        das_copy((__mks_93.pinfo),(__pinfo_rename_at_92_43));
+        return __mks_93;
+    })()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncrttiTickeach_dim_anyTick7498205270436711739_ef47b7c87b5ff133 ( Context * __context__, TypeInfo const  &  __info_rename_at_47_44 )
+{
+    TypeInfo const  * __pinfo_rename_at_49_45 = ((TypeInfo const  *)das_ref(__context__,__info_rename_at_47_44));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_FuncbuiltinTickeachTick9663565701927713696_7393507a6ace41b7(__context__,das_ascend<bool,_lambda_thismodule_50_6>::make(__context__,&__type_info__ef8fa2d615a9cf7e,(([&]() -> _lambda_thismodule_50_6 {
+        _lambda_thismodule_50_6 __mks_50;
+        das_zero(__mks_50);
+        das_copy((__mks_50.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_50_6`function XS<_lambda_thismodule_50_6> &i*/ 0x1221fa8750a507aa))));
+        das_copy((__mks_50.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_50_6`finalizer X1<S<_lambda_thismodule_50_6>>?*/ 0xe5702df7cd688f6e))));
+        das_copy((__mks_50.pinfo),(__pinfo_rename_at_49_45));
+        return __mks_50;
+    })()))));
+}
+
+inline Sequence DAS_COMMENT((TypeInfo &)) _FuncrttiTickarg_typesTick12838796147057657442_12d525ee0ebcad6f ( Context * __context__, VarInfo const  &  __info_rename_at_86_46 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TypeInfo &))>::cast(_FuncrttiTickarg_types_anyTick14095493126742042784_46727123b7eb020(__context__,__info_rename_at_86_46));
+}
+
+inline Sequence DAS_COMMENT((char *)) _FuncrttiTickarg_namesTick10261815503893967754_51136ffe9c269120 ( Context * __context__, VarInfo const  &  __info_rename_at_112_47 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char *))>::cast(_FuncrttiTickarg_names_anyTick16736947398500939560_59d12d50161e6c5c(__context__,__info_rename_at_112_47));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncrttiTickeach_dimTick2048201193529012380_9982c62daca5a59 ( Context * __context__, VarInfo const  &  __info_rename_at_60_48 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_FuncrttiTickeach_dim_anyTick7498205270436711739_f57ed49982e2205(__context__,__info_rename_at_60_48));
+}
+
+inline Sequence DAS_COMMENT((TypeInfo &)) _FuncrttiTickarg_typesTick414029999383747864_e4299aa10a7435d9 ( Context * __context__, TypeInfo const  &  __info_rename_at_81_49 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TypeInfo &))>::cast(_FuncrttiTickarg_types_anyTick14095493126742042784_d19129ef1dd72fde(__context__,__info_rename_at_81_49));
+}
+
+inline Sequence DAS_COMMENT((char *)) _FuncrttiTickarg_namesTick10966414128355233648_c020dc6e26805aac ( Context * __context__, TypeInfo const  &  __info_rename_at_107_50 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char *))>::cast(_FuncrttiTickarg_names_anyTick16736947398500939560_ce11c8607242954c(__context__,__info_rename_at_107_50));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncrttiTickeach_dimTick11222294146698882243_d327336d30e56eff ( Context * __context__, TypeInfo const  &  __info_rename_at_55_51 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_FuncrttiTickeach_dim_anyTick7498205270436711739_ef47b7c87b5ff133(__context__,__info_rename_at_55_51));
+}
+
+inline void _FuncbuiltinTickpushTick10769833213962245646_a54a33ebec8df23f ( Context * __context__, TArray<char *> &  __Arr_rename_at_193_52, char * __value_rename_at_193_53 )
+{
+    das_copy(__Arr_rename_at_193_52(builtin_array_push_back(das_arg<TArray<char *>>::pass(__Arr_rename_at_193_52),8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_193_53);
+}
+
+inline char * _Funcstrings_boostTickjoinTick16475640899284277631_2d62f8289a864db9 ( Context * __context__, TArray<char *> const  &  __it_rename_at_23_54, char * const  __separator_rename_at_23_55 )
+{
+    char * __st_rename_at_29_56 = ((char *)(char *)(((char * const )(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_29_57) DAS_AOT_INLINE_LAMBDA -> void{
+        bool __skip_first_rename_at_30_58 = true;
+        {
+            bool __need_loop_31 = true;
+            // elem: string const&
+            das_iterator<TArray<char *> const > __elem_iterator(__it_rename_at_23_54);
+            char * const  * __elem_rename_at_31_59;
+            __need_loop_31 = __elem_iterator.first(__context__,(__elem_rename_at_31_59)) && __need_loop_31;
+            for ( ; __need_loop_31 ; __need_loop_31 = __elem_iterator.next(__context__,(__elem_rename_at_31_59)) )
+            {
+                if ( __skip_first_rename_at_30_58 )
+                {
+                    das_copy(__skip_first_rename_at_30_58,false);
+                } else {
+                    das_call_interop<StringBuilderWriter &>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<StringBuilderWriter &>::from(__writer_rename_at_29_57),cast<char * const >::from(__separator_rename_at_23_55)));
+                };
+                das_call_interop<StringBuilderWriter &>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<StringBuilderWriter &>::from(__writer_rename_at_29_57),cast<char * const >::from((*__elem_rename_at_31_59))));
+            }
+            __elem_iterator.close(__context__,(__elem_rename_at_31_59));
+        };
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+    return das_auto_cast<char *>::cast(__st_rename_at_29_56);
+}
+
+inline void _FuncrttiTickstructure_for_each_annotationTick2951685515295779335_57c658524fb72fdf ( Context * __context__, StructInfo const  &  __st_rename_at_11_60, Block DAS_COMMENT((void,Annotation const ,AnnotationArguments const )) const  &  __subexpr_rename_at_11_61 )
+{
+    rtti_builtin_structure_for_each_annotation(__st_rename_at_11_60,__subexpr_rename_at_11_61,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline char * _FuncTickdescribeTypeTick15052164352617426930_82419b0ccc63e613 ( Context * __context__, VarInfo const  &  __info_rename_at_43_62 )
+{
+    char * __res_rename_at_44_63 = 0;
+    if ( __info_rename_at_43_62.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tHandle )
+    {
+        das_copy(__res_rename_at_44_63,((char * const )(to_das_string(das_arg<das::string>::pass(((__info_rename_at_43_62).getAnnotation())->name /*name*/),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))))));
+    } else if ( __info_rename_at_43_62.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tStructure )
+    {
+        das_copy(__res_rename_at_44_63,das_null_coalescing<char * const >::get(das_safe_navigation_handle<StructInfo,char * const >::get(((__info_rename_at_43_62).getStructType()),([&](const StructInfo * __any) -> auto & {return __any->name /*name*/;})),((char *) "structure")));
+    } else if ( (((__info_rename_at_43_62.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tEnumeration) || (__info_rename_at_43_62.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tEnumeration8)) || (__info_rename_at_43_62.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tEnumeration16)) || (__info_rename_at_43_62.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tEnumeration64) )
+    {
+        das_copy(__res_rename_at_44_63,das_null_coalescing<char * const >::get(das_safe_navigation_handle<EnumInfo,char * const >::get(((__info_rename_at_43_62).getEnumType()),([&](const EnumInfo * __any) -> auto & {return __any->name /*name*/;})),((char *) "enumeration")));
+    } else if ( __info_rename_at_43_62.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tPointer )
+    {
+        das_copy(__res_rename_at_44_63,(__info_rename_at_43_62.firstType /*firstType*/ != nullptr) ? das_auto_cast<char * const >::cast(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_2, cast<char * const >::from(_FuncTickdescribeTypeTick15052164352617426930_46590ad9462dbddc(__context__,das_deref(__context__,__info_rename_at_43_62.firstType /*firstType*/,__FILE__,__LINE__))), cast<char * const >::from(((char *) "?"))))) : das_auto_cast<char * const >::cast(((char *) "void?")));
+    } else if ( __info_rename_at_43_62.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tArray )
+    {
+        das_copy(__res_rename_at_44_63,(__info_rename_at_43_62.firstType /*firstType*/ != nullptr) ? das_auto_cast<char * const >::cast(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_3, cast<char * const >::from(((char *) "array<")), cast<char * const >::from(_FuncTickdescribeTypeTick15052164352617426930_46590ad9462dbddc(__context__,das_deref(__context__,__info_rename_at_43_62.firstType /*firstType*/,__FILE__,__LINE__))), cast<char * const >::from(((char *) ">"))))) : das_auto_cast<char * const >::cast(((char *) "array")));
+    } else if ( __info_rename_at_43_62.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tTable )
+    {
+        if ( (__info_rename_at_43_62.firstType /*firstType*/ != nullptr) && (__info_rename_at_43_62.secondType /*secondType*/ != nullptr) )
+        {
+            das_copy(__res_rename_at_44_63,das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_4, cast<char * const >::from(((char *) "table<")), cast<char * const >::from(_FuncTickdescribeTypeTick15052164352617426930_46590ad9462dbddc(__context__,das_deref(__context__,__info_rename_at_43_62.firstType /*firstType*/,__FILE__,__LINE__))), cast<char * const >::from(((char *) ";")), cast<char * const >::from(_FuncTickdescribeTypeTick15052164352617426930_46590ad9462dbddc(__context__,das_deref(__context__,__info_rename_at_43_62.secondType /*secondType*/,__FILE__,__LINE__))), cast<char * const >::from(((char *) ">")))));
+        } else {
+            das_copy(__res_rename_at_44_63,((char *) "table"));
+        };
+    } else if ( __info_rename_at_43_62.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tTuple )
+    {
+        if ( __info_rename_at_43_62.argTypes /*argTypes*/ != nullptr )
+        {
+            das_copy(__res_rename_at_44_63,cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(((char *) "tuple<")),cast<char *>::from(_Funcstrings_boostTickjoinTick16475640899284277631_2d62f8289a864db9(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> TArray<char *>{
+                Sequence DAS_COMMENT((TypeInfo *)) _temp_make_local_63_51_0; _temp_make_local_63_51_0;
+                TArray<char *> ____acomp_63_35_rename_at_63_64;das_zero(____acomp_63_35_rename_at_63_64);
+                builtin_set_verify_array_locks(das_arg<TArray<char *>>::pass(____acomp_63_35_rename_at_63_64),false);
+                {
+                    bool __need_loop_63 = true;
+                    // argtype: rtti::TypeInfo const&
+                    das_iterator<Sequence DAS_COMMENT((TypeInfo const ))> __argtype_iterator((_temp_make_local_63_51_0 = (_FuncrttiTickarg_typesTick12838796147057657442_12d525ee0ebcad6f(__context__,__info_rename_at_43_62))));
+                    TypeInfo const  * __argtype_rename_at_63_65;
+                    __need_loop_63 = __argtype_iterator.first(__context__,(__argtype_rename_at_63_65)) && __need_loop_63;
+                    for ( ; __need_loop_63 ; __need_loop_63 = __argtype_iterator.next(__context__,(__argtype_rename_at_63_65)) )
+                    {
+                        _FuncbuiltinTickpushTick14133213201864676143_a73bd8f330e36d49(__context__,das_arg<TArray<char *>>::pass(____acomp_63_35_rename_at_63_64),_FuncTickdescribeTypeTick15052164352617426930_46590ad9462dbddc(__context__,(*__argtype_rename_at_63_65)));
+                    }
+                    __argtype_iterator.close(__context__,(__argtype_rename_at_63_65));
+                };
+                builtin_set_verify_array_locks(das_arg<TArray<char *>>::pass(____acomp_63_35_rename_at_63_64),true);
+                return /* <- */ das_auto_cast_move<TArray<char *>>::cast(____acomp_63_35_rename_at_63_64);
+            })),((char *) ";"))),*__context__,nullptr)))),cast<char *>::from(((char *) ">")),*__context__,nullptr)));
+        } else {
+            SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_44_63),cast<char *>::from(((char *) "tuple")),*__context__,nullptr);
+        };
+    } else if ( __info_rename_at_43_62.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tVariant )
+    {
+        if ( (__info_rename_at_43_62.argTypes /*argTypes*/ != nullptr) && (__info_rename_at_43_62.argNames /*argNames*/ != nullptr) )
+        {
+            das_copy(__res_rename_at_44_63,cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(((char *) "variant<")),cast<char *>::from(_Funcstrings_boostTickjoinTick16475640899284277631_2d62f8289a864db9(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> TArray<char *>{
+                Sequence DAS_COMMENT((char *)) _temp_make_local_69_63_1; _temp_make_local_69_63_1;
+                Sequence DAS_COMMENT((TypeInfo *)) _temp_make_local_69_80_2; _temp_make_local_69_80_2;
+                TArray<char *> ____acomp_69_38_rename_at_69_66;das_zero(____acomp_69_38_rename_at_69_66);
+                builtin_set_verify_array_locks(das_arg<TArray<char *>>::pass(____acomp_69_38_rename_at_69_66),false);
+                {
+                    bool __need_loop_69 = true;
+                    // argname: string
+                    das_iterator<Sequence DAS_COMMENT((char *))> __argname_iterator((_temp_make_local_69_63_1 = (_FuncrttiTickarg_namesTick10261815503893967754_51136ffe9c269120(__context__,__info_rename_at_43_62))));
+                    char * __argname_rename_at_69_69;
+                    __need_loop_69 = __argname_iterator.first(__context__,(__argname_rename_at_69_69)) && __need_loop_69;
+                    // argtype: rtti::TypeInfo const&
+                    das_iterator<Sequence DAS_COMMENT((TypeInfo const ))> __argtype_iterator((_temp_make_local_69_80_2 = (_FuncrttiTickarg_typesTick12838796147057657442_12d525ee0ebcad6f(__context__,__info_rename_at_43_62))));
+                    TypeInfo const  * __argtype_rename_at_69_70;
+                    __need_loop_69 = __argtype_iterator.first(__context__,(__argtype_rename_at_69_70)) && __need_loop_69;
+                    for ( ; __need_loop_69 ; __need_loop_69 = __argname_iterator.next(__context__,(__argname_rename_at_69_69)) && __argtype_iterator.next(__context__,(__argtype_rename_at_69_70)) )
+                    {
+                        _FuncbuiltinTickpushTick10769833213962245646_a54a33ebec8df23f(__context__,das_arg<TArray<char *>>::pass(____acomp_69_38_rename_at_69_66),das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_5, cast<char *>::from(__argname_rename_at_69_69), cast<char * const >::from(((char *) ":")), cast<char * const >::from(_FuncTickdescribeTypeTick15052164352617426930_46590ad9462dbddc(__context__,(*__argtype_rename_at_69_70))))));
+                    }
+                    __argtype_iterator.close(__context__,(__argtype_rename_at_69_70));
+                    __argname_iterator.close(__context__,(__argname_rename_at_69_69));
+                };
+                builtin_set_verify_array_locks(das_arg<TArray<char *>>::pass(____acomp_69_38_rename_at_69_66),true);
+                return /* <- */ das_auto_cast_move<TArray<char *>>::cast(____acomp_69_38_rename_at_69_66);
+            })),((char *) ";"))),*__context__,nullptr)))),cast<char *>::from(((char *) ">")),*__context__,nullptr)));
+        } else {
+            SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_44_63),cast<char *>::from(((char *) "variant")),*__context__,nullptr);
+        };
+    } else if ( ((__info_rename_at_43_62.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tFunction) || (__info_rename_at_43_62.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tLambda)) || (__info_rename_at_43_62.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tBlock) )
+    {
+        das_copy(__res_rename_at_44_63,das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_2, cast<char * const >::from(((char * const )(rtti_get_das_type_name(__info_rename_at_43_62.type /*basicType*/,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))), cast<char * const >::from(((char *) "<")))));
+        if ( __info_rename_at_43_62.argTypes /*argTypes*/ != nullptr )
+        {
+            SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_44_63),cast<char *>::from((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(((char *) "(")),cast<char *>::from(_Funcstrings_boostTickjoinTick16475640899284277631_2d62f8289a864db9(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> TArray<char *>{
+                Sequence DAS_COMMENT((TypeInfo *)) _temp_make_local_76_47_3; _temp_make_local_76_47_3;
+                TArray<char *> ____acomp_76_31_rename_at_76_71;das_zero(____acomp_76_31_rename_at_76_71);
+                builtin_set_verify_array_locks(das_arg<TArray<char *>>::pass(____acomp_76_31_rename_at_76_71),false);
+                {
+                    bool __need_loop_76 = true;
+                    // argtype: rtti::TypeInfo const&
+                    das_iterator<Sequence DAS_COMMENT((TypeInfo const ))> __argtype_iterator((_temp_make_local_76_47_3 = (_FuncrttiTickarg_typesTick12838796147057657442_12d525ee0ebcad6f(__context__,__info_rename_at_43_62))));
+                    TypeInfo const  * __argtype_rename_at_76_72;
+                    __need_loop_76 = __argtype_iterator.first(__context__,(__argtype_rename_at_76_72)) && __need_loop_76;
+                    for ( ; __need_loop_76 ; __need_loop_76 = __argtype_iterator.next(__context__,(__argtype_rename_at_76_72)) )
+                    {
+                        _FuncbuiltinTickpushTick14133213201864676143_a73bd8f330e36d49(__context__,das_arg<TArray<char *>>::pass(____acomp_76_31_rename_at_76_71),_FuncTickdescribeTypeTick15052164352617426930_46590ad9462dbddc(__context__,(*__argtype_rename_at_76_72)));
+                    }
+                    __argtype_iterator.close(__context__,(__argtype_rename_at_76_72));
+                };
+                builtin_set_verify_array_locks(das_arg<TArray<char *>>::pass(____acomp_76_31_rename_at_76_71),true);
+                return /* <- */ das_auto_cast_move<TArray<char *>>::cast(____acomp_76_31_rename_at_76_71);
+            })),((char *) ";"))),*__context__,nullptr)))),cast<char *>::from(((char *) ")")),*__context__,nullptr)))),*__context__,nullptr);
+        };
+        if ( __info_rename_at_43_62.firstType /*firstType*/ != nullptr )
+        {
+            if ( __info_rename_at_43_62.argTypes /*argTypes*/ != nullptr )
+            {
+                SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_44_63),cast<char *>::from(((char *) ":")),*__context__,nullptr);
+            };
+            SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_44_63),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_7, cast<char * const >::from(_FuncTickdescribeTypeTick15052164352617426930_46590ad9462dbddc(__context__,das_deref(__context__,__info_rename_at_43_62.firstType /*firstType*/,__FILE__,__LINE__)))))),*__context__,nullptr);
+        };
+        SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_44_63),cast<char *>::from(((char *) ">")),*__context__,nullptr);
+    } else {
+        das_copy(__res_rename_at_44_63,((char * const )(rtti_get_das_type_name(__info_rename_at_43_62.type /*basicType*/,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))))));
+    };
+    SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_44_63),cast<char *>::from(_Funcstrings_boostTickjoinTick16475640899284277631_2d62f8289a864db9(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> TArray<char *>{
+        Sequence DAS_COMMENT((int32_t)) _temp_make_local_88_27_4; _temp_make_local_88_27_4;
+        TArray<char *> ____acomp_88_17_rename_at_88_73;das_zero(____acomp_88_17_rename_at_88_73);
+        builtin_set_verify_array_locks(das_arg<TArray<char *>>::pass(____acomp_88_17_rename_at_88_73),false);
+        {
+            bool __need_loop_88 = true;
+            // d: int
+            das_iterator<Sequence DAS_COMMENT((int32_t))> __d_iterator((_temp_make_local_88_27_4 = (_FuncrttiTickeach_dimTick2048201193529012380_9982c62daca5a59(__context__,__info_rename_at_43_62))));
+            int32_t __d_rename_at_88_74;
+            __need_loop_88 = __d_iterator.first(__context__,(__d_rename_at_88_74)) && __need_loop_88;
+            for ( ; __need_loop_88 ; __need_loop_88 = __d_iterator.next(__context__,(__d_rename_at_88_74)) )
+            {
+                _FuncbuiltinTickpushTick14133213201864676143_a73bd8f330e36d49(__context__,das_arg<TArray<char *>>::pass(____acomp_88_17_rename_at_88_73),(__d_rename_at_88_74 != -1) ? das_auto_cast<char * const >::cast(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_8, cast<char * const >::from(((char *) "[")), cast<int32_t>::from(__d_rename_at_88_74), cast<char * const >::from(((char *) "]"))))) : das_auto_cast<char * const >::cast(((char *) "[]")));
+            }
+            __d_iterator.close(__context__,(__d_rename_at_88_74));
+        };
+        builtin_set_verify_array_locks(das_arg<TArray<char *>>::pass(____acomp_88_17_rename_at_88_73),true);
+        return /* <- */ das_auto_cast_move<TArray<char *>>::cast(____acomp_88_17_rename_at_88_73);
+    })),nullptr)),*__context__,nullptr);
+    if ( ((__info_rename_at_43_62).isConst()) )
+    {
+        SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_44_63),cast<char *>::from(((char *) " const")),*__context__,nullptr);
+    };
+    if ( ((__info_rename_at_43_62).isRef()) )
+    {
+        SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_44_63),cast<char *>::from(((char *) " &")),*__context__,nullptr);
+    };
+    if ( ((__info_rename_at_43_62).isTemp()) )
+    {
+        SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_44_63),cast<char *>::from(((char *) "#")),*__context__,nullptr);
+    };
+    if ( ((__info_rename_at_43_62).isImplicit()) )
+    {
+        SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_44_63),cast<char *>::from(((char *) " implicit")),*__context__,nullptr);
+    };
+    return das_auto_cast<char *>::cast(__res_rename_at_44_63);
+}
+
+inline char * _FuncTickdescribeTypeTick15052164352617426930_46590ad9462dbddc ( Context * __context__, TypeInfo const  &  __info_rename_at_43_75 )
+{
+    char * __res_rename_at_44_76 = 0;
+    if ( __info_rename_at_43_75.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tHandle )
+    {
+        das_copy(__res_rename_at_44_76,((char * const )(to_das_string(das_arg<das::string>::pass(((__info_rename_at_43_75).getAnnotation())->name /*name*/),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))))));
+    } else if ( __info_rename_at_43_75.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tStructure )
+    {
+        das_copy(__res_rename_at_44_76,das_null_coalescing<char * const >::get(das_safe_navigation_handle<StructInfo,char * const >::get(((__info_rename_at_43_75).getStructType()),([&](const StructInfo * __any) -> auto & {return __any->name /*name*/;})),((char *) "structure")));
+    } else if ( (((__info_rename_at_43_75.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tEnumeration) || (__info_rename_at_43_75.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tEnumeration8)) || (__info_rename_at_43_75.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tEnumeration16)) || (__info_rename_at_43_75.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tEnumeration64) )
+    {
+        das_copy(__res_rename_at_44_76,das_null_coalescing<char * const >::get(das_safe_navigation_handle<EnumInfo,char * const >::get(((__info_rename_at_43_75).getEnumType()),([&](const EnumInfo * __any) -> auto & {return __any->name /*name*/;})),((char *) "enumeration")));
+    } else if ( __info_rename_at_43_75.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tPointer )
+    {
+        das_copy(__res_rename_at_44_76,(__info_rename_at_43_75.firstType /*firstType*/ != nullptr) ? das_auto_cast<char * const >::cast(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_2, cast<char * const >::from(_FuncTickdescribeTypeTick15052164352617426930_46590ad9462dbddc(__context__,das_deref(__context__,__info_rename_at_43_75.firstType /*firstType*/,__FILE__,__LINE__))), cast<char * const >::from(((char *) "?"))))) : das_auto_cast<char * const >::cast(((char *) "void?")));
+    } else if ( __info_rename_at_43_75.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tArray )
+    {
+        das_copy(__res_rename_at_44_76,(__info_rename_at_43_75.firstType /*firstType*/ != nullptr) ? das_auto_cast<char * const >::cast(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_3, cast<char * const >::from(((char *) "array<")), cast<char * const >::from(_FuncTickdescribeTypeTick15052164352617426930_46590ad9462dbddc(__context__,das_deref(__context__,__info_rename_at_43_75.firstType /*firstType*/,__FILE__,__LINE__))), cast<char * const >::from(((char *) ">"))))) : das_auto_cast<char * const >::cast(((char *) "array")));
+    } else if ( __info_rename_at_43_75.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tTable )
+    {
+        if ( (__info_rename_at_43_75.firstType /*firstType*/ != nullptr) && (__info_rename_at_43_75.secondType /*secondType*/ != nullptr) )
+        {
+            das_copy(__res_rename_at_44_76,das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_4, cast<char * const >::from(((char *) "table<")), cast<char * const >::from(_FuncTickdescribeTypeTick15052164352617426930_46590ad9462dbddc(__context__,das_deref(__context__,__info_rename_at_43_75.firstType /*firstType*/,__FILE__,__LINE__))), cast<char * const >::from(((char *) ";")), cast<char * const >::from(_FuncTickdescribeTypeTick15052164352617426930_46590ad9462dbddc(__context__,das_deref(__context__,__info_rename_at_43_75.secondType /*secondType*/,__FILE__,__LINE__))), cast<char * const >::from(((char *) ">")))));
+        } else {
+            das_copy(__res_rename_at_44_76,((char *) "table"));
+        };
+    } else if ( __info_rename_at_43_75.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tTuple )
+    {
+        if ( __info_rename_at_43_75.argTypes /*argTypes*/ != nullptr )
+        {
+            das_copy(__res_rename_at_44_76,cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(((char *) "tuple<")),cast<char *>::from(_Funcstrings_boostTickjoinTick16475640899284277631_2d62f8289a864db9(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> TArray<char *>{
+                Sequence DAS_COMMENT((TypeInfo *)) _temp_make_local_63_51_5; _temp_make_local_63_51_5;
+                TArray<char *> ____acomp_63_35_rename_at_63_77;das_zero(____acomp_63_35_rename_at_63_77);
+                builtin_set_verify_array_locks(das_arg<TArray<char *>>::pass(____acomp_63_35_rename_at_63_77),false);
+                {
+                    bool __need_loop_63 = true;
+                    // argtype: rtti::TypeInfo const&
+                    das_iterator<Sequence DAS_COMMENT((TypeInfo const ))> __argtype_iterator((_temp_make_local_63_51_5 = (_FuncrttiTickarg_typesTick414029999383747864_e4299aa10a7435d9(__context__,__info_rename_at_43_75))));
+                    TypeInfo const  * __argtype_rename_at_63_78;
+                    __need_loop_63 = __argtype_iterator.first(__context__,(__argtype_rename_at_63_78)) && __need_loop_63;
+                    for ( ; __need_loop_63 ; __need_loop_63 = __argtype_iterator.next(__context__,(__argtype_rename_at_63_78)) )
+                    {
+                        _FuncbuiltinTickpushTick14133213201864676143_a73bd8f330e36d49(__context__,das_arg<TArray<char *>>::pass(____acomp_63_35_rename_at_63_77),_FuncTickdescribeTypeTick15052164352617426930_46590ad9462dbddc(__context__,(*__argtype_rename_at_63_78)));
+                    }
+                    __argtype_iterator.close(__context__,(__argtype_rename_at_63_78));
+                };
+                builtin_set_verify_array_locks(das_arg<TArray<char *>>::pass(____acomp_63_35_rename_at_63_77),true);
+                return /* <- */ das_auto_cast_move<TArray<char *>>::cast(____acomp_63_35_rename_at_63_77);
+            })),((char *) ";"))),*__context__,nullptr)))),cast<char *>::from(((char *) ">")),*__context__,nullptr)));
+        } else {
+            SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_44_76),cast<char *>::from(((char *) "tuple")),*__context__,nullptr);
+        };
+    } else if ( __info_rename_at_43_75.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tVariant )
+    {
+        if ( (__info_rename_at_43_75.argTypes /*argTypes*/ != nullptr) && (__info_rename_at_43_75.argNames /*argNames*/ != nullptr) )
+        {
+            das_copy(__res_rename_at_44_76,cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(((char *) "variant<")),cast<char *>::from(_Funcstrings_boostTickjoinTick16475640899284277631_2d62f8289a864db9(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> TArray<char *>{
+                Sequence DAS_COMMENT((char *)) _temp_make_local_69_63_6; _temp_make_local_69_63_6;
+                Sequence DAS_COMMENT((TypeInfo *)) _temp_make_local_69_80_7; _temp_make_local_69_80_7;
+                TArray<char *> ____acomp_69_38_rename_at_69_79;das_zero(____acomp_69_38_rename_at_69_79);
+                builtin_set_verify_array_locks(das_arg<TArray<char *>>::pass(____acomp_69_38_rename_at_69_79),false);
+                {
+                    bool __need_loop_69 = true;
+                    // argname: string
+                    das_iterator<Sequence DAS_COMMENT((char *))> __argname_iterator((_temp_make_local_69_63_6 = (_FuncrttiTickarg_namesTick10966414128355233648_c020dc6e26805aac(__context__,__info_rename_at_43_75))));
+                    char * __argname_rename_at_69_82;
+                    __need_loop_69 = __argname_iterator.first(__context__,(__argname_rename_at_69_82)) && __need_loop_69;
+                    // argtype: rtti::TypeInfo const&
+                    das_iterator<Sequence DAS_COMMENT((TypeInfo const ))> __argtype_iterator((_temp_make_local_69_80_7 = (_FuncrttiTickarg_typesTick414029999383747864_e4299aa10a7435d9(__context__,__info_rename_at_43_75))));
+                    TypeInfo const  * __argtype_rename_at_69_83;
+                    __need_loop_69 = __argtype_iterator.first(__context__,(__argtype_rename_at_69_83)) && __need_loop_69;
+                    for ( ; __need_loop_69 ; __need_loop_69 = __argname_iterator.next(__context__,(__argname_rename_at_69_82)) && __argtype_iterator.next(__context__,(__argtype_rename_at_69_83)) )
+                    {
+                        _FuncbuiltinTickpushTick10769833213962245646_a54a33ebec8df23f(__context__,das_arg<TArray<char *>>::pass(____acomp_69_38_rename_at_69_79),das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_5, cast<char *>::from(__argname_rename_at_69_82), cast<char * const >::from(((char *) ":")), cast<char * const >::from(_FuncTickdescribeTypeTick15052164352617426930_46590ad9462dbddc(__context__,(*__argtype_rename_at_69_83))))));
+                    }
+                    __argtype_iterator.close(__context__,(__argtype_rename_at_69_83));
+                    __argname_iterator.close(__context__,(__argname_rename_at_69_82));
+                };
+                builtin_set_verify_array_locks(das_arg<TArray<char *>>::pass(____acomp_69_38_rename_at_69_79),true);
+                return /* <- */ das_auto_cast_move<TArray<char *>>::cast(____acomp_69_38_rename_at_69_79);
+            })),((char *) ";"))),*__context__,nullptr)))),cast<char *>::from(((char *) ">")),*__context__,nullptr)));
+        } else {
+            SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_44_76),cast<char *>::from(((char *) "variant")),*__context__,nullptr);
+        };
+    } else if ( ((__info_rename_at_43_75.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tFunction) || (__info_rename_at_43_75.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tLambda)) || (__info_rename_at_43_75.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tBlock) )
+    {
+        das_copy(__res_rename_at_44_76,das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_2, cast<char * const >::from(((char * const )(rtti_get_das_type_name(__info_rename_at_43_75.type /*basicType*/,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))), cast<char * const >::from(((char *) "<")))));
+        if ( __info_rename_at_43_75.argTypes /*argTypes*/ != nullptr )
+        {
+            SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_44_76),cast<char *>::from((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(((char *) "(")),cast<char *>::from(_Funcstrings_boostTickjoinTick16475640899284277631_2d62f8289a864db9(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> TArray<char *>{
+                Sequence DAS_COMMENT((TypeInfo *)) _temp_make_local_76_47_8; _temp_make_local_76_47_8;
+                TArray<char *> ____acomp_76_31_rename_at_76_84;das_zero(____acomp_76_31_rename_at_76_84);
+                builtin_set_verify_array_locks(das_arg<TArray<char *>>::pass(____acomp_76_31_rename_at_76_84),false);
+                {
+                    bool __need_loop_76 = true;
+                    // argtype: rtti::TypeInfo const&
+                    das_iterator<Sequence DAS_COMMENT((TypeInfo const ))> __argtype_iterator((_temp_make_local_76_47_8 = (_FuncrttiTickarg_typesTick414029999383747864_e4299aa10a7435d9(__context__,__info_rename_at_43_75))));
+                    TypeInfo const  * __argtype_rename_at_76_85;
+                    __need_loop_76 = __argtype_iterator.first(__context__,(__argtype_rename_at_76_85)) && __need_loop_76;
+                    for ( ; __need_loop_76 ; __need_loop_76 = __argtype_iterator.next(__context__,(__argtype_rename_at_76_85)) )
+                    {
+                        _FuncbuiltinTickpushTick14133213201864676143_a73bd8f330e36d49(__context__,das_arg<TArray<char *>>::pass(____acomp_76_31_rename_at_76_84),_FuncTickdescribeTypeTick15052164352617426930_46590ad9462dbddc(__context__,(*__argtype_rename_at_76_85)));
+                    }
+                    __argtype_iterator.close(__context__,(__argtype_rename_at_76_85));
+                };
+                builtin_set_verify_array_locks(das_arg<TArray<char *>>::pass(____acomp_76_31_rename_at_76_84),true);
+                return /* <- */ das_auto_cast_move<TArray<char *>>::cast(____acomp_76_31_rename_at_76_84);
+            })),((char *) ";"))),*__context__,nullptr)))),cast<char *>::from(((char *) ")")),*__context__,nullptr)))),*__context__,nullptr);
+        };
+        if ( __info_rename_at_43_75.firstType /*firstType*/ != nullptr )
+        {
+            if ( __info_rename_at_43_75.argTypes /*argTypes*/ != nullptr )
+            {
+                SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_44_76),cast<char *>::from(((char *) ":")),*__context__,nullptr);
+            };
+            SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_44_76),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_7, cast<char * const >::from(_FuncTickdescribeTypeTick15052164352617426930_46590ad9462dbddc(__context__,das_deref(__context__,__info_rename_at_43_75.firstType /*firstType*/,__FILE__,__LINE__)))))),*__context__,nullptr);
+        };
+        SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_44_76),cast<char *>::from(((char *) ">")),*__context__,nullptr);
+    } else {
+        das_copy(__res_rename_at_44_76,((char * const )(rtti_get_das_type_name(__info_rename_at_43_75.type /*basicType*/,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))))));
+    };
+    SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_44_76),cast<char *>::from(_Funcstrings_boostTickjoinTick16475640899284277631_2d62f8289a864db9(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> TArray<char *>{
+        Sequence DAS_COMMENT((int32_t)) _temp_make_local_88_27_9; _temp_make_local_88_27_9;
+        TArray<char *> ____acomp_88_17_rename_at_88_86;das_zero(____acomp_88_17_rename_at_88_86);
+        builtin_set_verify_array_locks(das_arg<TArray<char *>>::pass(____acomp_88_17_rename_at_88_86),false);
+        {
+            bool __need_loop_88 = true;
+            // d: int
+            das_iterator<Sequence DAS_COMMENT((int32_t))> __d_iterator((_temp_make_local_88_27_9 = (_FuncrttiTickeach_dimTick11222294146698882243_d327336d30e56eff(__context__,__info_rename_at_43_75))));
+            int32_t __d_rename_at_88_87;
+            __need_loop_88 = __d_iterator.first(__context__,(__d_rename_at_88_87)) && __need_loop_88;
+            for ( ; __need_loop_88 ; __need_loop_88 = __d_iterator.next(__context__,(__d_rename_at_88_87)) )
+            {
+                _FuncbuiltinTickpushTick14133213201864676143_a73bd8f330e36d49(__context__,das_arg<TArray<char *>>::pass(____acomp_88_17_rename_at_88_86),(__d_rename_at_88_87 != -1) ? das_auto_cast<char * const >::cast(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_8, cast<char * const >::from(((char *) "[")), cast<int32_t>::from(__d_rename_at_88_87), cast<char * const >::from(((char *) "]"))))) : das_auto_cast<char * const >::cast(((char *) "[]")));
+            }
+            __d_iterator.close(__context__,(__d_rename_at_88_87));
+        };
+        builtin_set_verify_array_locks(das_arg<TArray<char *>>::pass(____acomp_88_17_rename_at_88_86),true);
+        return /* <- */ das_auto_cast_move<TArray<char *>>::cast(____acomp_88_17_rename_at_88_86);
+    })),nullptr)),*__context__,nullptr);
+    if ( ((__info_rename_at_43_75).isConst()) )
+    {
+        SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_44_76),cast<char *>::from(((char *) " const")),*__context__,nullptr);
+    };
+    if ( ((__info_rename_at_43_75).isRef()) )
+    {
+        SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_44_76),cast<char *>::from(((char *) " &")),*__context__,nullptr);
+    };
+    if ( ((__info_rename_at_43_75).isTemp()) )
+    {
+        SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_44_76),cast<char *>::from(((char *) "#")),*__context__,nullptr);
+    };
+    if ( ((__info_rename_at_43_75).isImplicit()) )
+    {
+        SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_44_76),cast<char *>::from(((char *) " implicit")),*__context__,nullptr);
+    };
+    return das_auto_cast<char *>::cast(__res_rename_at_44_76);
+}
+
+inline char * _FuncTickdescribeValueTick7225869591395707454_47e978031a7114d3 ( Context * __context__, TVariant<32,16,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> const  &  __value_rename_at_116_88 )
+{
+    if ( das_get_variant_field<vec4f,16,8>::is(__value_rename_at_116_88) )
+    {
+        return das_auto_cast<char *>::cast(nullptr);
+    } else return das_auto_cast<char *>::cast(das_get_variant_field<char *,16,7>::is(__value_rename_at_116_88) ? das_auto_cast<char *>::cast(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_16, cast<char * const >::from(((char *) "=\"")), cast<TVariant<32,16,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> const  &>::from(__value_rename_at_116_88), cast<char * const >::from(((char *) "\""))))) : das_auto_cast<char *>::cast(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_17, cast<char * const >::from(((char *) "=")), cast<TVariant<32,16,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> const  &>::from(__value_rename_at_116_88)))));
+}
+
+inline void _FuncTickdescribeEnumerationTick10167141312159626520_b377a2f9bd48705b ( Context * __context__, EnumInfo const  &  __einfo_rename_at_142_89 )
+{
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<3>(__tinfo_3, cast<char * const >::from(((char *) "enum ")), cast<char * const >::from(((char * const )(__einfo_rename_at_142_89.name /*name*/))), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    {
+        bool __need_loop_144 = true;
+        // eitem: rtti::EnumValueInfo const&
+        das_iterator<EnumInfo const > __eitem_iterator(__einfo_rename_at_142_89);
+        EnumValueInfo const  * __eitem_rename_at_144_90;
+        __need_loop_144 = __eitem_iterator.first(__context__,(__eitem_rename_at_144_90)) && __need_loop_144;
+        for ( ; __need_loop_144 ; __need_loop_144 = __eitem_iterator.next(__context__,(__eitem_rename_at_144_90)) )
+        {
+            builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<5>(__tinfo_19, cast<char * const >::from(((char *) "\t")), cast<char * const >::from(((char * const )((*__eitem_rename_at_144_90).name /*name*/))), cast<char * const >::from(((char *) " = ")), cast<int64_t>::from((*__eitem_rename_at_144_90).value /*value*/), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        }
+        __eitem_iterator.close(__context__,(__eitem_rename_at_144_90));
+    };
+}
+
+inline void _FuncTickdescribeStructureTick10827907688821779217_eda31ba1077a5e27 ( Context * __context__, StructInfo const  &  __sinfo_rename_at_130_91 ) { das_stack_prologue __prologue(__context__,384,"`describeStructure`10827907688821779217 " DAS_FILE_LINE);
+{
+    _FuncrttiTickstructure_for_each_annotationTick2951685515295779335_57c658524fb72fdf(__context__,__sinfo_rename_at_130_91,das_make_block<void,Annotation const  &,AnnotationArguments const  &>(__context__,80,0,&__func_info__27f8a37dac8fb462,[&](Annotation const  & __ann_rename_at_132_92, AnnotationArguments const  & __annArgs_rename_at_132_93) -> void{
+        char * __argT_rename_at_133_94 = ((char *)(char *)(_Funcstrings_boostTickjoinTick16475640899284277631_2d62f8289a864db9(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> TArray<char *>{
+            TArray<char *> ____acomp_133_25_rename_at_133_95;das_zero(____acomp_133_25_rename_at_133_95);
+            builtin_set_verify_array_locks(das_arg<TArray<char *>>::pass(____acomp_133_25_rename_at_133_95),false);
+            {
+                bool __need_loop_133 = true;
+                // arg: rtti::AnnotationArgument const&
+                das_iterator<AnnotationArguments const > __arg_iterator(__annArgs_rename_at_132_93);
+                AnnotationArgument const  * __arg_rename_at_133_96;
+                __need_loop_133 = __arg_iterator.first(__context__,(__arg_rename_at_133_96)) && __need_loop_133;
+                for ( ; __need_loop_133 ; __need_loop_133 = __arg_iterator.next(__context__,(__arg_rename_at_133_96)) )
+                {
+                    TVariant<32,16,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> _temp_make_local_133_73_10; _temp_make_local_133_73_10;
+                    _FuncbuiltinTickpushTick10769833213962245646_a54a33ebec8df23f(__context__,das_arg<TArray<char *>>::pass(____acomp_133_25_rename_at_133_95),das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_20, cast<das::string const  &>::from((*__arg_rename_at_133_96).name /*name*/), cast<char * const >::from(_FuncTickdescribeValueTick7225869591395707454_47e978031a7114d3(__context__,das_arg<TVariant<32,16,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f>>::pass((_temp_make_local_133_73_10 = (rtti_builtin_argument_value((*__arg_rename_at_133_96),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))))))));
+                }
+                __arg_iterator.close(__context__,(__arg_rename_at_133_96));
+            };
+            builtin_set_verify_array_locks(das_arg<TArray<char *>>::pass(____acomp_133_25_rename_at_133_95),true);
+            return /* <- */ das_auto_cast_move<TArray<char *>>::cast(____acomp_133_25_rename_at_133_95);
+        })),((char *) ","))));
+        builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<5>(__tinfo_21, cast<char * const >::from(((char *) "[")), cast<das::string const  &>::from(__ann_rename_at_132_92.name /*name*/), cast<char * const >::from(((char *) "(")), cast<char * const >::from(__argT_rename_at_133_94), cast<char * const >::from(((char *) ")]\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    }));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<3>(__tinfo_3, cast<char * const >::from(((char *) "struct ")), cast<char * const >::from(((char * const )(__sinfo_rename_at_130_91.name /*name*/))), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    {
+        bool __need_loop_137 = true;
+        // sfield: rtti::VarInfo const&
+        das_iterator<StructInfo const > __sfield_iterator(__sinfo_rename_at_130_91);
+        VarInfo const  * __sfield_rename_at_137_97;
+        __need_loop_137 = __sfield_iterator.first(__context__,(__sfield_rename_at_137_97)) && __need_loop_137;
+        for ( ; __need_loop_137 ; __need_loop_137 = __sfield_iterator.next(__context__,(__sfield_rename_at_137_97)) )
+        {
+            _FuncTickdescribeVariableTick4438727553851220500_aab40c005a49d26f(__context__,(*__sfield_rename_at_137_97),((char *) "\t"));
+        }
+        __sfield_iterator.close(__context__,(__sfield_rename_at_137_97));
+    };
+}}
+
+inline void _FuncTickdescribeAnnotationTick9021868495512338670_9766e6316c523899 ( Context * __context__, Annotation const  &  __ann_rename_at_149_98 ) { das_stack_prologue __prologue(__context__,112,"`describeAnnotation`9021868495512338670 " DAS_FILE_LINE);
+{
+    if ( ((__ann_rename_at_149_98).rtti_isBasicStructureAnnotation()) )
+    {
+        BasicStructureAnnotation * __sann_rename_at_152_99 = ((BasicStructureAnnotation *)&(das_cast<BasicStructureAnnotation &>::cast(__ann_rename_at_149_98)));
+        builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<7>(__tinfo_23, cast<char * const >::from(((char *) "struct ")), cast<das::string const  &>::from((*__sann_rename_at_152_99).name /*name*/), cast<char * const >::from(((char *) " // ")), cast<int32_t>::from((((*__sann_rename_at_152_99)).fieldCount())), cast<char * const >::from(((char *) " ")), cast<das::string const  &>::from((*__sann_rename_at_152_99).cppName /*cppName*/), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        rtti_builtin_basic_struct_for_each_field((*__sann_rename_at_152_99),das_make_block<void,char *,char *,TypeInfo const  &,uint32_t>(__context__,96,0,&__func_info__60bf4ac802ed24bd,[&](char * __name_rename_at_154_100, char * __cppName_rename_at_154_101, TypeInfo const  & __xtype_rename_at_154_102, uint32_t __offset_rename_at_154_103) -> void{
+            builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<9>(__tinfo_24, cast<char * const >::from(((char *) "\t")), cast<char *>::from(__name_rename_at_154_100), cast<char * const >::from(((char *) ":")), cast<char * const >::from(_FuncTickdescribeTypeTick15052164352617426930_46590ad9462dbddc(__context__,__xtype_rename_at_154_102)), cast<char * const >::from(((char *) " // ")), cast<char *>::from(__cppName_rename_at_154_101), cast<char * const >::from(((char *) " at ")), cast<uint32_t>::from(__offset_rename_at_154_103), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    } else if ( ((__ann_rename_at_149_98).rtti_isHandledTypeAnnotation()) )
+    {
+        TypeAnnotation * __tann_rename_at_160_104 = ((TypeAnnotation *)&(das_cast<TypeAnnotation &>::cast(__ann_rename_at_149_98)));
+        builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<4>(__tinfo_25, cast<das::string const  &>::from((*__tann_rename_at_160_104).name /*name*/), cast<char * const >::from(((char *) " // ")), cast<das::string const  &>::from((*__tann_rename_at_160_104).cppName /*cppName*/), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    } else {
+        builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<2>(__tinfo_20, cast<das::string const  &>::from(__ann_rename_at_149_98.name /*name*/), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    };
+}}
+
+inline void _FuncTickdescribeFunctionTick10530476277455359167_8ef153d4d9b5ddbb ( Context * __context__, FuncInfo const  &  __finfo_rename_at_104_105 )
+{
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<3>(__tinfo_3, cast<char * const >::from(((char *) "def ")), cast<char * const >::from(((char * const )(__finfo_rename_at_104_105.name /*name*/))), cast<char * const >::from(((char *) " ")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    if ( __finfo_rename_at_104_105.count /*count*/ != 0x0u )
+    {
+        char * __argT_rename_at_107_106 = ((char *)(char *)(_Funcstrings_boostTickjoinTick16475640899284277631_2d62f8289a864db9(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> TArray<char *>{
+            TArray<char *> ____acomp_107_25_rename_at_107_107;das_zero(____acomp_107_25_rename_at_107_107);
+            builtin_set_verify_array_locks(das_arg<TArray<char *>>::pass(____acomp_107_25_rename_at_107_107),false);
+            {
+                bool __need_loop_107 = true;
+                // arg: rtti::VarInfo const&
+                das_iterator<FuncInfo const > __arg_iterator(__finfo_rename_at_104_105);
+                VarInfo const  * __arg_rename_at_107_108;
+                __need_loop_107 = __arg_iterator.first(__context__,(__arg_rename_at_107_108)) && __need_loop_107;
+                for ( ; __need_loop_107 ; __need_loop_107 = __arg_iterator.next(__context__,(__arg_rename_at_107_108)) )
+                {
+                    _FuncbuiltinTickpushTick10769833213962245646_a54a33ebec8df23f(__context__,das_arg<TArray<char *>>::pass(____acomp_107_25_rename_at_107_107),das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_3, cast<char * const >::from(((char * const )((*__arg_rename_at_107_108).name /*name*/))), cast<char * const >::from(((char *) ":")), cast<char * const >::from(_FuncTickdescribeTypeTick15052164352617426930_82419b0ccc63e613(__context__,(*__arg_rename_at_107_108))))));
+                }
+                __arg_iterator.close(__context__,(__arg_rename_at_107_108));
+            };
+            builtin_set_verify_array_locks(das_arg<TArray<char *>>::pass(____acomp_107_25_rename_at_107_107),true);
+            return /* <- */ das_auto_cast_move<TArray<char *>>::cast(____acomp_107_25_rename_at_107_107);
+        })),((char *) "; "))));
+        builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<3>(__tinfo_3, cast<char * const >::from(((char *) "( ")), cast<char * const >::from(__argT_rename_at_107_106), cast<char * const >::from(((char *) " ) ")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    };
+    if ( __finfo_rename_at_104_105.result /*result*/ != nullptr )
+    {
+        builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<2>(__tinfo_2, cast<char * const >::from(((char *) ": ")), cast<char * const >::from(_FuncTickdescribeTypeTick15052164352617426930_46590ad9462dbddc(__context__,das_deref(__context__,__finfo_rename_at_104_105.result /*result*/,__FILE__,__LINE__))))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    };
+    builtin_print(((char *) "\n"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncTickdescribeVariableTick4438727553851220500_aab40c005a49d26f ( Context * __context__, VarInfo const  &  __glob_rename_at_126_109, char * const  __extra_rename_at_126_110 )
+{
+    TVariant<32,16,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> _temp_make_local_127_67_11; _temp_make_local_127_67_11;
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<6>(__tinfo_31, cast<char * const >::from(__extra_rename_at_126_110), cast<char * const >::from(((char * const )(__glob_rename_at_126_109.name /*name*/))), cast<char * const >::from(((char *) " : ")), cast<char * const >::from(_FuncTickdescribeTypeTick15052164352617426930_82419b0ccc63e613(__context__,__glob_rename_at_126_109)), cast<char * const >::from(_FuncTickdescribeValueTick7225869591395707454_47e978031a7114d3(__context__,das_arg<TVariant<32,16,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f>>::pass((_temp_make_local_127_67_11 = (rtti_builtin_variable_value(__glob_rename_at_126_109)))))), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncTickdescribeModuleTick5893429008970995053_3a044fca9cc79c00 ( Context * __context__, Module * const  __mod_rename_at_168_111 ) { das_stack_prologue __prologue(__context__,96,"`describeModule`5893429008970995053 " DAS_FILE_LINE);
+{
+    rtti_builtin_module_for_each_enumeration(__mod_rename_at_168_111,das_make_block<void,EnumInfo const  &>(__context__,80,0,&__func_info__ba7c83312bca764c,[&](EnumInfo const  & __einfo_rename_at_169_112) -> void{
+        _FuncTickdescribeEnumerationTick10167141312159626520_b377a2f9bd48705b(__context__,__einfo_rename_at_169_112);
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    rtti_builtin_module_for_each_structure(__mod_rename_at_168_111,das_make_block<void,StructInfo const  &>(__context__,80,0,&__func_info__87a8802b687c8666,[&](StructInfo const  & __sinfo_rename_at_172_113) -> void{
+        _FuncTickdescribeStructureTick10827907688821779217_eda31ba1077a5e27(__context__,__sinfo_rename_at_172_113);
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    rtti_builtin_module_for_each_annotation(__mod_rename_at_168_111,das_make_block<void,Annotation const  &>(__context__,80,0,&__func_info__289d11b1aa3d7f8d,[&](Annotation const  & __ann_rename_at_175_114) -> void{
+        _FuncTickdescribeAnnotationTick9021868495512338670_9766e6316c523899(__context__,__ann_rename_at_175_114);
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    rtti_builtin_module_for_each_function(__mod_rename_at_168_111,das_make_block<void,FuncInfo const  &>(__context__,80,0,&__func_info__9a52762bd43811a2,[&](FuncInfo const  & __finfo_rename_at_178_115) -> void{
+        _FuncTickdescribeFunctionTick10530476277455359167_8ef153d4d9b5ddbb(__context__,__finfo_rename_at_178_115);
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    rtti_builtin_module_for_each_generic(__mod_rename_at_168_111,das_make_block<void,FuncInfo const  &>(__context__,80,0,&__func_info__9a52762bd43811a2,[&](FuncInfo const  & __finfo_rename_at_181_116) -> void{
+        _FuncTickdescribeFunctionTick10530476277455359167_8ef153d4d9b5ddbb(__context__,__finfo_rename_at_181_116);
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    rtti_builtin_module_for_each_global(__mod_rename_at_168_111,das_make_block<void,VarInfo const  &>(__context__,80,0,&__func_info__a50d0dc0315d3958,[&](VarInfo const  & __glob_rename_at_184_117) -> void{
+        _FuncTickdescribeVariableTick4438727553851220500_aab40c005a49d26f(__context__,__glob_rename_at_184_117,nullptr);
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}}
+
+inline void _FuncrttiTickcontext_for_each_functionTick10212946581910492173_5f9871bbe9c4befd ( Context * __context__, Block DAS_COMMENT((void,FuncInfo const )) const  &  __blk_rename_at_34_118 )
+{
+    {
+        bool __need_loop_35 = true;
+        // fni: int const
+        das_iterator<range> __fni_iterator(mk_range(rtti_contextTotalFunctions(das_arg<Context>::pass(thisContext(__context__)))));
+        int32_t __fni_rename_at_35_119;
+        __need_loop_35 = __fni_iterator.first(__context__,(__fni_rename_at_35_119)) && __need_loop_35;
+        for ( ; __need_loop_35 ; __need_loop_35 = __fni_iterator.next(__context__,(__fni_rename_at_35_119)) )
+        {
+            das_invoke<void>::invoke<FuncInfo const  &>(__context__,nullptr,__blk_rename_at_34_118,das_call_interop<FuncInfo const  &>::call(&rtti_contextFunctionInfo,__context__,SimNode_AotInterop<2>(__tinfo_32,cast<Context &>::from(thisContext(__context__)),cast<int32_t>::from(__fni_rename_at_35_119))));
+        }
+        __fni_iterator.close(__context__,(__fni_rename_at_35_119));
+    };
+}
+
+inline void _FuncrttiTickcontext_for_each_variableTick13583238681075032270_aca7b2c0db620890 ( Context * __context__, Block DAS_COMMENT((void,VarInfo const )) const  &  __blk_rename_at_41_120 )
+{
+    {
+        bool __need_loop_42 = true;
+        // vi: int const
+        das_iterator<range> __vi_iterator(mk_range(rtti_contextTotalVariables(das_arg<Context>::pass(thisContext(__context__)))));
+        int32_t __vi_rename_at_42_121;
+        __need_loop_42 = __vi_iterator.first(__context__,(__vi_rename_at_42_121)) && __need_loop_42;
+        for ( ; __need_loop_42 ; __need_loop_42 = __vi_iterator.next(__context__,(__vi_rename_at_42_121)) )
+        {
+            das_invoke<void>::invoke<VarInfo const  &>(__context__,nullptr,__blk_rename_at_41_120,das_call_interop<VarInfo const  &>::call(&rtti_contextVariableInfo,__context__,SimNode_AotInterop<2>(__tinfo_32,cast<Context &>::from(thisContext(__context__)),cast<int32_t>::from(__vi_rename_at_42_121))));
+        }
+        __vi_iterator.close(__context__,(__vi_rename_at_42_121));
+    };
+}
+
+inline bool main_44ff410c9eff378b ( Context * __context__ ) { das_stack_prologue __prologue(__context__,560,"main " DAS_FILE_LINE);
+{
+    CodeOfPolicies _temp_make_local_197_30_12; _temp_make_local_197_30_12;
+    rtti_builtin_program_for_each_registered_module(das_make_block<void,Module *>(__context__,80,0,&__func_info__4dedd3fc50b439aa,[&](Module * __mod_rename_at_192_122) -> void{
+        _FuncTickdescribeModuleTick5893429008970995053_3a044fca9cc79c00(__context__,__mod_rename_at_192_122);
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    _FuncTickdescribeModuleTick5893429008970995053_3a044fca9cc79c00(__context__,rtti_get_builtin_module(((char *) "$")));
+    rtti_builtin_compile(((char *) "sample"),das_global<char *,0x8dd62d230cec4301>(__context__) /*sample*/,das_arg<CodeOfPolicies>::pass((_temp_make_local_197_30_12 = (/*c-tor*/ CodeOfPolicies(/*end-c-tor*/)))),das_make_block<void,bool,smart_ptr_raw<Program>,das::string const  &>(__context__,464,0,&__func_info__84ca4769de27c8d7,[&](bool __ok_rename_at_197_123, smart_ptr_raw<Program> __prog_rename_at_197_124, das::string const  & __errors_rename_at_197_125) -> void{
+        if ( __ok_rename_at_197_123 )
+        {
+            builtin_print(((char *) "compiled\n"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+            Module * __thisMod_rename_at_200_126 = ((Module *)rtti_get_this_module(__prog_rename_at_197_124));
+            rtti_builtin_program_for_each_module(__prog_rename_at_197_124,das_make_block<void,Module *>(__context__,544,0,&__func_info__4dedd3fc50b439aa,[&](Module * __mod_rename_at_201_127) -> void{
+                if ( __mod_rename_at_201_127 == __thisMod_rename_at_200_126 )
+                {
+                    _FuncTickdescribeModuleTick5893429008970995053_3a044fca9cc79c00(__context__,__mod_rename_at_201_127);
+                };
+            }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        } else {
+            builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<3>(__tinfo_34, cast<char * const >::from(((char *) "failed to compile:\n")), cast<das::string const  &>::from(__errors_rename_at_197_125), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+            DAS_ASSERT((false));
+        };
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    _FuncrttiTickcontext_for_each_functionTick10212946581910492173_5f9871bbe9c4befd(__context__,das_make_block<void,FuncInfo const  &>(__context__,80,0,&__func_info__9a52762bd43811a2,[&](FuncInfo const  & __finfo_rename_at_212_128) -> void{
+        _FuncTickdescribeFunctionTick10530476277455359167_8ef153d4d9b5ddbb(__context__,__finfo_rename_at_212_128);
+    }));
+    _FuncrttiTickcontext_for_each_variableTick13583238681075032270_aca7b2c0db620890(__context__,das_make_block<void,VarInfo const  &>(__context__,80,0,&__func_info__73ae6d84f337cfd5,[&](VarInfo const  & __vinfo_rename_at_215_129) -> void{
+        _FuncTickdescribeVariableTick4438727553851220500_aab40c005a49d26f(__context__,__vinfo_rename_at_215_129,nullptr);
+    }));
+    return das_auto_cast<bool>::cast(true);
+}}
+
+inline bool test_b67965a0274f7c37 ( Context * __context__ )
+{
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncbuiltinTickpushTick14133213201864676143_a73bd8f330e36d49 ( Context * __context__ ) {
+    TArray<char *> &  arg_Arr = cast_aot_arg<TArray<char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_value = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick14133213201864676143_a73bd8f330e36d49(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap_finalize_24a9e4d37242f86d ( Context * __context__ ) {
+    _lambda_thismodule_50_5 &  arg___this = cast_aot_arg<_lambda_thismodule_50_5 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_24a9e4d37242f86d(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_474bf13230c79c11 ( Context * __context__ ) {
+    _lambda_thismodule_50_6 &  arg___this = cast_aot_arg<_lambda_thismodule_50_6 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_474bf13230c79c11(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 ( Context * __context__ ) {
+    range arg_rng = cast_aot_arg<range>::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__, arg_rng);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeachTick9663565701927713696_7393507a6ace41b7 ( Context * __context__ ) {
+    Lambda DAS_COMMENT((bool,int32_t &)) const  arg_lam = cast_aot_arg<Lambda DAS_COMMENT((bool,int32_t &)) const >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncbuiltinTickeachTick9663565701927713696_7393507a6ace41b7(__context__, arg_lam);
+    return v_zero();
+}
+static vec4f __wrap_finalize_b0e96085ac978dbe ( Context * __context__ ) {
+    _lambda_thismodule_67_1 &  arg___this = cast_aot_arg<_lambda_thismodule_67_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_b0e96085ac978dbe(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_c00ee8297bf81f30 ( Context * __context__ ) {
+    _lambda_thismodule_93_2 &  arg___this = cast_aot_arg<_lambda_thismodule_93_2 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_c00ee8297bf81f30(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_4308d56959d2974a ( Context * __context__ ) {
+    _lambda_thismodule_67_3 &  arg___this = cast_aot_arg<_lambda_thismodule_67_3 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_4308d56959d2974a(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_2889c4bd2cc3cc56 ( Context * __context__ ) {
+    _lambda_thismodule_93_4 &  arg___this = cast_aot_arg<_lambda_thismodule_93_4 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_2889c4bd2cc3cc56(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeach_refTick16137060296763333387_97926cd17e20a9cf ( Context * __context__ ) {
+    Lambda DAS_COMMENT((bool,TypeInfo const  * &)) const  arg_lam = cast_aot_arg<Lambda DAS_COMMENT((bool,TypeInfo const  * &)) const >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((TypeInfo &)) *) __context__->abiCMRES) = _FuncbuiltinTickeach_refTick16137060296763333387_97926cd17e20a9cf(__context__, arg_lam);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeachTick9663565701927713696_9ed40335195dc880 ( Context * __context__ ) {
+    Lambda DAS_COMMENT((bool,char * &)) const  arg_lam = cast_aot_arg<Lambda DAS_COMMENT((bool,char * &)) const >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((char *)) *) __context__->abiCMRES) = _FuncbuiltinTickeachTick9663565701927713696_9ed40335195dc880(__context__, arg_lam);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_50_5Tickfunction_9387aa396f2ce340 ( Context * __context__ ) {
+    _lambda_thismodule_50_5 &  arg___this = cast_aot_arg<_lambda_thismodule_50_5 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg__yield_50 = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_50_5Tickfunction_9387aa396f2ce340(__context__, arg___this, arg__yield_50));
+}
+static vec4f __wrap__Func_lambda_thismodule_50_5Tickfinalizer_448ec9a3da4f5bd4 ( Context * __context__ ) {
+    _lambda_thismodule_50_5 * arg___this = cast_aot_arg<_lambda_thismodule_50_5 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_50_5Tickfinalizer_448ec9a3da4f5bd4(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_50_6Tickfunction_98c5af6733d80450 ( Context * __context__ ) {
+    _lambda_thismodule_50_6 &  arg___this = cast_aot_arg<_lambda_thismodule_50_6 & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t & arg__yield_50 = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_50_6Tickfunction_98c5af6733d80450(__context__, arg___this, arg__yield_50));
+}
+static vec4f __wrap__Func_lambda_thismodule_50_6Tickfinalizer_4bb490b13e3b830e ( Context * __context__ ) {
+    _lambda_thismodule_50_6 * arg___this = cast_aot_arg<_lambda_thismodule_50_6 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_50_6Tickfinalizer_4bb490b13e3b830e(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_67_1Tickfunction_60cdebc1037daf21 ( Context * __context__ ) {
+    _lambda_thismodule_67_1 &  arg___this = cast_aot_arg<_lambda_thismodule_67_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    TypeInfo const  * & arg__ryield67 = cast_aot_arg<TypeInfo const  * &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_67_1Tickfunction_60cdebc1037daf21(__context__, arg___this, arg__ryield67));
+}
+static vec4f __wrap__Func_lambda_thismodule_67_1Tickfinalizer_2333384c9e7a84fe ( Context * __context__ ) {
+    _lambda_thismodule_67_1 * arg___this = cast_aot_arg<_lambda_thismodule_67_1 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_67_1Tickfinalizer_2333384c9e7a84fe(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_93_2Tickfunction_48533abf83fa4085 ( Context * __context__ ) {
+    _lambda_thismodule_93_2 &  arg___this = cast_aot_arg<_lambda_thismodule_93_2 & >::to(*__context__,__context__->abiArguments()[0]);
+    char * & arg__yield_93 = cast_aot_arg<char * &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_93_2Tickfunction_48533abf83fa4085(__context__, arg___this, arg__yield_93));
+}
+static vec4f __wrap__Func_lambda_thismodule_93_2Tickfinalizer_fadadfe49ae3c6f7 ( Context * __context__ ) {
+    _lambda_thismodule_93_2 * arg___this = cast_aot_arg<_lambda_thismodule_93_2 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_93_2Tickfinalizer_fadadfe49ae3c6f7(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_67_3Tickfunction_444313c2c3267ff9 ( Context * __context__ ) {
+    _lambda_thismodule_67_3 &  arg___this = cast_aot_arg<_lambda_thismodule_67_3 & >::to(*__context__,__context__->abiArguments()[0]);
+    TypeInfo const  * & arg__ryield67 = cast_aot_arg<TypeInfo const  * &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_67_3Tickfunction_444313c2c3267ff9(__context__, arg___this, arg__ryield67));
+}
+static vec4f __wrap__Func_lambda_thismodule_67_3Tickfinalizer_46e0845b8d2ca858 ( Context * __context__ ) {
+    _lambda_thismodule_67_3 * arg___this = cast_aot_arg<_lambda_thismodule_67_3 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_67_3Tickfinalizer_46e0845b8d2ca858(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_93_4Tickfunction_c2da0f8ffa53c373 ( Context * __context__ ) {
+    _lambda_thismodule_93_4 &  arg___this = cast_aot_arg<_lambda_thismodule_93_4 & >::to(*__context__,__context__->abiArguments()[0]);
+    char * & arg__yield_93 = cast_aot_arg<char * &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_93_4Tickfunction_c2da0f8ffa53c373(__context__, arg___this, arg__yield_93));
+}
+static vec4f __wrap__Func_lambda_thismodule_93_4Tickfinalizer_8e614aabf63ba8bb ( Context * __context__ ) {
+    _lambda_thismodule_93_4 * arg___this = cast_aot_arg<_lambda_thismodule_93_4 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_93_4Tickfinalizer_8e614aabf63ba8bb(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncrttiTickarg_types_anyTick14095493126742042784_46727123b7eb020 ( Context * __context__ ) {
+    VarInfo const  &  arg_info = cast_aot_arg<VarInfo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((TypeInfo &)) *) __context__->abiCMRES) = _FuncrttiTickarg_types_anyTick14095493126742042784_46727123b7eb020(__context__, arg_info);
+    return v_zero();
+}
+static vec4f __wrap__FuncrttiTickarg_names_anyTick16736947398500939560_59d12d50161e6c5c ( Context * __context__ ) {
+    VarInfo const  &  arg_info = cast_aot_arg<VarInfo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((char *)) *) __context__->abiCMRES) = _FuncrttiTickarg_names_anyTick16736947398500939560_59d12d50161e6c5c(__context__, arg_info);
+    return v_zero();
+}
+static vec4f __wrap__FuncrttiTickeach_dim_anyTick7498205270436711739_f57ed49982e2205 ( Context * __context__ ) {
+    VarInfo const  &  arg_info = cast_aot_arg<VarInfo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncrttiTickeach_dim_anyTick7498205270436711739_f57ed49982e2205(__context__, arg_info);
+    return v_zero();
+}
+static vec4f __wrap__FuncrttiTickarg_types_anyTick14095493126742042784_d19129ef1dd72fde ( Context * __context__ ) {
+    TypeInfo const  &  arg_info = cast_aot_arg<TypeInfo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((TypeInfo &)) *) __context__->abiCMRES) = _FuncrttiTickarg_types_anyTick14095493126742042784_d19129ef1dd72fde(__context__, arg_info);
+    return v_zero();
+}
+static vec4f __wrap__FuncrttiTickarg_names_anyTick16736947398500939560_ce11c8607242954c ( Context * __context__ ) {
+    TypeInfo const  &  arg_info = cast_aot_arg<TypeInfo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((char *)) *) __context__->abiCMRES) = _FuncrttiTickarg_names_anyTick16736947398500939560_ce11c8607242954c(__context__, arg_info);
+    return v_zero();
+}
+static vec4f __wrap__FuncrttiTickeach_dim_anyTick7498205270436711739_ef47b7c87b5ff133 ( Context * __context__ ) {
+    TypeInfo const  &  arg_info = cast_aot_arg<TypeInfo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncrttiTickeach_dim_anyTick7498205270436711739_ef47b7c87b5ff133(__context__, arg_info);
+    return v_zero();
+}
+static vec4f __wrap__FuncrttiTickarg_typesTick12838796147057657442_12d525ee0ebcad6f ( Context * __context__ ) {
+    VarInfo const  &  arg_info = cast_aot_arg<VarInfo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((TypeInfo &)) *) __context__->abiCMRES) = _FuncrttiTickarg_typesTick12838796147057657442_12d525ee0ebcad6f(__context__, arg_info);
+    return v_zero();
+}
+static vec4f __wrap__FuncrttiTickarg_namesTick10261815503893967754_51136ffe9c269120 ( Context * __context__ ) {
+    VarInfo const  &  arg_info = cast_aot_arg<VarInfo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((char *)) *) __context__->abiCMRES) = _FuncrttiTickarg_namesTick10261815503893967754_51136ffe9c269120(__context__, arg_info);
+    return v_zero();
+}
+static vec4f __wrap__FuncrttiTickeach_dimTick2048201193529012380_9982c62daca5a59 ( Context * __context__ ) {
+    VarInfo const  &  arg_info = cast_aot_arg<VarInfo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncrttiTickeach_dimTick2048201193529012380_9982c62daca5a59(__context__, arg_info);
+    return v_zero();
+}
+static vec4f __wrap__FuncrttiTickarg_typesTick414029999383747864_e4299aa10a7435d9 ( Context * __context__ ) {
+    TypeInfo const  &  arg_info = cast_aot_arg<TypeInfo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((TypeInfo &)) *) __context__->abiCMRES) = _FuncrttiTickarg_typesTick414029999383747864_e4299aa10a7435d9(__context__, arg_info);
+    return v_zero();
+}
+static vec4f __wrap__FuncrttiTickarg_namesTick10966414128355233648_c020dc6e26805aac ( Context * __context__ ) {
+    TypeInfo const  &  arg_info = cast_aot_arg<TypeInfo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((char *)) *) __context__->abiCMRES) = _FuncrttiTickarg_namesTick10966414128355233648_c020dc6e26805aac(__context__, arg_info);
+    return v_zero();
+}
+static vec4f __wrap__FuncrttiTickeach_dimTick11222294146698882243_d327336d30e56eff ( Context * __context__ ) {
+    TypeInfo const  &  arg_info = cast_aot_arg<TypeInfo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncrttiTickeach_dimTick11222294146698882243_d327336d30e56eff(__context__, arg_info);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpushTick10769833213962245646_a54a33ebec8df23f ( Context * __context__ ) {
+    TArray<char *> &  arg_Arr = cast_aot_arg<TArray<char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    char * arg_value = cast_aot_arg<char *>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick10769833213962245646_a54a33ebec8df23f(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__Funcstrings_boostTickjoinTick16475640899284277631_2d62f8289a864db9 ( Context * __context__ ) {
+    TArray<char *> const  &  arg_it = cast_aot_arg<TArray<char *> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_separator = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<char *>::from(_Funcstrings_boostTickjoinTick16475640899284277631_2d62f8289a864db9(__context__, arg_it, arg_separator));
+}
+static vec4f __wrap__FuncrttiTickstructure_for_each_annotationTick2951685515295779335_57c658524fb72fdf ( Context * __context__ ) {
+    StructInfo const  &  arg_st = cast_aot_arg<StructInfo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((void,Annotation const ,AnnotationArguments const )) const  &  arg_subexpr = cast_aot_arg<Block DAS_COMMENT((void,Annotation const ,AnnotationArguments const )) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncrttiTickstructure_for_each_annotationTick2951685515295779335_57c658524fb72fdf(__context__, arg_st, arg_subexpr);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickdescribeTypeTick15052164352617426930_82419b0ccc63e613 ( Context * __context__ ) {
+    VarInfo const  &  arg_info = cast_aot_arg<VarInfo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<char *>::from(_FuncTickdescribeTypeTick15052164352617426930_82419b0ccc63e613(__context__, arg_info));
+}
+static vec4f __wrap__FuncTickdescribeTypeTick15052164352617426930_46590ad9462dbddc ( Context * __context__ ) {
+    TypeInfo const  &  arg_info = cast_aot_arg<TypeInfo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<char *>::from(_FuncTickdescribeTypeTick15052164352617426930_46590ad9462dbddc(__context__, arg_info));
+}
+static vec4f __wrap__FuncTickdescribeValueTick7225869591395707454_47e978031a7114d3 ( Context * __context__ ) {
+    TVariant<32,16,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> const  &  arg_value = cast_aot_arg<TVariant<32,16,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<char *>::from(_FuncTickdescribeValueTick7225869591395707454_47e978031a7114d3(__context__, arg_value));
+}
+static vec4f __wrap__FuncTickdescribeEnumerationTick10167141312159626520_b377a2f9bd48705b ( Context * __context__ ) {
+    EnumInfo const  &  arg_einfo = cast_aot_arg<EnumInfo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickdescribeEnumerationTick10167141312159626520_b377a2f9bd48705b(__context__, arg_einfo);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickdescribeStructureTick10827907688821779217_eda31ba1077a5e27 ( Context * __context__ ) {
+    StructInfo const  &  arg_sinfo = cast_aot_arg<StructInfo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickdescribeStructureTick10827907688821779217_eda31ba1077a5e27(__context__, arg_sinfo);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickdescribeAnnotationTick9021868495512338670_9766e6316c523899 ( Context * __context__ ) {
+    Annotation const  &  arg_ann = cast_aot_arg<Annotation const  & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickdescribeAnnotationTick9021868495512338670_9766e6316c523899(__context__, arg_ann);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickdescribeFunctionTick10530476277455359167_8ef153d4d9b5ddbb ( Context * __context__ ) {
+    FuncInfo const  &  arg_finfo = cast_aot_arg<FuncInfo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickdescribeFunctionTick10530476277455359167_8ef153d4d9b5ddbb(__context__, arg_finfo);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickdescribeVariableTick4438727553851220500_aab40c005a49d26f ( Context * __context__ ) {
+    VarInfo const  &  arg_glob = cast_aot_arg<VarInfo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_extra = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTickdescribeVariableTick4438727553851220500_aab40c005a49d26f(__context__, arg_glob, arg_extra);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickdescribeModuleTick5893429008970995053_3a044fca9cc79c00 ( Context * __context__ ) {
+    Module * const  arg_mod = cast_aot_arg<Module * const >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickdescribeModuleTick5893429008970995053_3a044fca9cc79c00(__context__, arg_mod);
+    return v_zero();
+}
+static vec4f __wrap__FuncrttiTickcontext_for_each_functionTick10212946581910492173_5f9871bbe9c4befd ( Context * __context__ ) {
+    Block DAS_COMMENT((void,FuncInfo const )) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((void,FuncInfo const )) const  & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncrttiTickcontext_for_each_functionTick10212946581910492173_5f9871bbe9c4befd(__context__, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncrttiTickcontext_for_each_variableTick13583238681075032270_aca7b2c0db620890 ( Context * __context__ ) {
+    Block DAS_COMMENT((void,VarInfo const )) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((void,VarInfo const )) const  & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncrttiTickcontext_for_each_variableTick13583238681075032270_aca7b2c0db620890(__context__, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap_main_44ff410c9eff378b ( Context * __context__ ) {
+    return cast<bool>::from(main_44ff410c9eff378b(__context__));
+}
+static vec4f __wrap_test_b67965a0274f7c37 ( Context * __context__ ) {
+    return cast<bool>::from(test_b67965a0274f7c37(__context__));
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x4a9a547cf73d3b9c, false, (void*)&_FuncbuiltinTickpushTick14133213201864676143_a73bd8f330e36d49, &__wrap__FuncbuiltinTickpushTick14133213201864676143_a73bd8f330e36d49 },
+    { 0xbfbd9ed349d84414, false, (void*)&finalize_24a9e4d37242f86d, &__wrap_finalize_24a9e4d37242f86d },
+    { 0x34703657d30ab11a, false, (void*)&finalize_474bf13230c79c11, &__wrap_finalize_474bf13230c79c11 },
+    { 0xf426d9532c77b0a4, true, (void*)&_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015, &__wrap__FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 },
+    { 0xa5b460d13a7e1328, true, (void*)&_FuncbuiltinTickeachTick9663565701927713696_7393507a6ace41b7, &__wrap__FuncbuiltinTickeachTick9663565701927713696_7393507a6ace41b7 },
+    { 0x1f8ed6a7cb112fcc, false, (void*)&finalize_b0e96085ac978dbe, &__wrap_finalize_b0e96085ac978dbe },
+    { 0x5ae78715db430c7f, false, (void*)&finalize_c00ee8297bf81f30, &__wrap_finalize_c00ee8297bf81f30 },
+    { 0xe3a017d6f1aa8f36, false, (void*)&finalize_4308d56959d2974a, &__wrap_finalize_4308d56959d2974a },
+    { 0xc095c1cf1e786d8f, false, (void*)&finalize_2889c4bd2cc3cc56, &__wrap_finalize_2889c4bd2cc3cc56 },
+    { 0x5b9d90cf07c9aad1, true, (void*)&_FuncbuiltinTickeach_refTick16137060296763333387_97926cd17e20a9cf, &__wrap__FuncbuiltinTickeach_refTick16137060296763333387_97926cd17e20a9cf },
+    { 0xc8b9519c1e900d0c, true, (void*)&_FuncbuiltinTickeachTick9663565701927713696_9ed40335195dc880, &__wrap__FuncbuiltinTickeachTick9663565701927713696_9ed40335195dc880 },
+    { 0x7d7577cdfe458adf, false, (void*)&_Func_lambda_thismodule_50_5Tickfunction_9387aa396f2ce340, &__wrap__Func_lambda_thismodule_50_5Tickfunction_9387aa396f2ce340 },
+    { 0xf311a2d064f551bd, false, (void*)&_Func_lambda_thismodule_50_5Tickfinalizer_448ec9a3da4f5bd4, &__wrap__Func_lambda_thismodule_50_5Tickfinalizer_448ec9a3da4f5bd4 },
+    { 0x6329a11624337f2e, false, (void*)&_Func_lambda_thismodule_50_6Tickfunction_98c5af6733d80450, &__wrap__Func_lambda_thismodule_50_6Tickfunction_98c5af6733d80450 },
+    { 0x8cbb2e0a72c13a26, false, (void*)&_Func_lambda_thismodule_50_6Tickfinalizer_4bb490b13e3b830e, &__wrap__Func_lambda_thismodule_50_6Tickfinalizer_4bb490b13e3b830e },
+    { 0xd1802314932c9f74, false, (void*)&_Func_lambda_thismodule_67_1Tickfunction_60cdebc1037daf21, &__wrap__Func_lambda_thismodule_67_1Tickfunction_60cdebc1037daf21 },
+    { 0x96366cc2bf3987e, false, (void*)&_Func_lambda_thismodule_67_1Tickfinalizer_2333384c9e7a84fe, &__wrap__Func_lambda_thismodule_67_1Tickfinalizer_2333384c9e7a84fe },
+    { 0x19ef5326e63e739b, false, (void*)&_Func_lambda_thismodule_93_2Tickfunction_48533abf83fa4085, &__wrap__Func_lambda_thismodule_93_2Tickfunction_48533abf83fa4085 },
+    { 0x6afa43d2cc5cd8e9, false, (void*)&_Func_lambda_thismodule_93_2Tickfinalizer_fadadfe49ae3c6f7, &__wrap__Func_lambda_thismodule_93_2Tickfinalizer_fadadfe49ae3c6f7 },
+    { 0x5b0af4ee082f4c77, false, (void*)&_Func_lambda_thismodule_67_3Tickfunction_444313c2c3267ff9, &__wrap__Func_lambda_thismodule_67_3Tickfunction_444313c2c3267ff9 },
+    { 0x3269cc66dbcbb8d1, false, (void*)&_Func_lambda_thismodule_67_3Tickfinalizer_46e0845b8d2ca858, &__wrap__Func_lambda_thismodule_67_3Tickfinalizer_46e0845b8d2ca858 },
+    { 0xefa0f9b553ebb2f8, false, (void*)&_Func_lambda_thismodule_93_4Tickfunction_c2da0f8ffa53c373, &__wrap__Func_lambda_thismodule_93_4Tickfunction_c2da0f8ffa53c373 },
+    { 0x355fd70f4b676d49, false, (void*)&_Func_lambda_thismodule_93_4Tickfinalizer_8e614aabf63ba8bb, &__wrap__Func_lambda_thismodule_93_4Tickfinalizer_8e614aabf63ba8bb },
+    { 0xc869c39460b4639a, true, (void*)&_FuncrttiTickarg_types_anyTick14095493126742042784_46727123b7eb020, &__wrap__FuncrttiTickarg_types_anyTick14095493126742042784_46727123b7eb020 },
+    { 0xaa159a573342db7c, true, (void*)&_FuncrttiTickarg_names_anyTick16736947398500939560_59d12d50161e6c5c, &__wrap__FuncrttiTickarg_names_anyTick16736947398500939560_59d12d50161e6c5c },
+    { 0xd6482402554c7e11, true, (void*)&_FuncrttiTickeach_dim_anyTick7498205270436711739_f57ed49982e2205, &__wrap__FuncrttiTickeach_dim_anyTick7498205270436711739_f57ed49982e2205 },
+    { 0x248ff5d003534f5b, true, (void*)&_FuncrttiTickarg_types_anyTick14095493126742042784_d19129ef1dd72fde, &__wrap__FuncrttiTickarg_types_anyTick14095493126742042784_d19129ef1dd72fde },
+    { 0x68df2fd3bab8e01c, true, (void*)&_FuncrttiTickarg_names_anyTick16736947398500939560_ce11c8607242954c, &__wrap__FuncrttiTickarg_names_anyTick16736947398500939560_ce11c8607242954c },
+    { 0x86439632527daa2c, true, (void*)&_FuncrttiTickeach_dim_anyTick7498205270436711739_ef47b7c87b5ff133, &__wrap__FuncrttiTickeach_dim_anyTick7498205270436711739_ef47b7c87b5ff133 },
+    { 0xfc01fb03e3475059, true, (void*)&_FuncrttiTickarg_typesTick12838796147057657442_12d525ee0ebcad6f, &__wrap__FuncrttiTickarg_typesTick12838796147057657442_12d525ee0ebcad6f },
+    { 0xe0ef90565e5d8948, true, (void*)&_FuncrttiTickarg_namesTick10261815503893967754_51136ffe9c269120, &__wrap__FuncrttiTickarg_namesTick10261815503893967754_51136ffe9c269120 },
+    { 0xb7a70f8d64dc0d2b, true, (void*)&_FuncrttiTickeach_dimTick2048201193529012380_9982c62daca5a59, &__wrap__FuncrttiTickeach_dimTick2048201193529012380_9982c62daca5a59 },
+    { 0x525bd4d45c0e9c8c, true, (void*)&_FuncrttiTickarg_typesTick414029999383747864_e4299aa10a7435d9, &__wrap__FuncrttiTickarg_typesTick414029999383747864_e4299aa10a7435d9 },
+    { 0xf4a68ce8601f1534, true, (void*)&_FuncrttiTickarg_namesTick10966414128355233648_c020dc6e26805aac, &__wrap__FuncrttiTickarg_namesTick10966414128355233648_c020dc6e26805aac },
+    { 0x232ae6be092c2d4a, true, (void*)&_FuncrttiTickeach_dimTick11222294146698882243_d327336d30e56eff, &__wrap__FuncrttiTickeach_dimTick11222294146698882243_d327336d30e56eff },
+    { 0x468a9f289eaed4d0, false, (void*)&_FuncbuiltinTickpushTick10769833213962245646_a54a33ebec8df23f, &__wrap__FuncbuiltinTickpushTick10769833213962245646_a54a33ebec8df23f },
+    { 0x61c57fcc3ac50491, false, (void*)&_Funcstrings_boostTickjoinTick16475640899284277631_2d62f8289a864db9, &__wrap__Funcstrings_boostTickjoinTick16475640899284277631_2d62f8289a864db9 },
+    { 0xafd25c63c2887e5e, false, (void*)&_FuncrttiTickstructure_for_each_annotationTick2951685515295779335_57c658524fb72fdf, &__wrap__FuncrttiTickstructure_for_each_annotationTick2951685515295779335_57c658524fb72fdf },
+    { 0xc2cf39083c3f0051, false, (void*)&_FuncTickdescribeTypeTick15052164352617426930_82419b0ccc63e613, &__wrap__FuncTickdescribeTypeTick15052164352617426930_82419b0ccc63e613 },
+    { 0xb007c77894f7fd41, false, (void*)&_FuncTickdescribeTypeTick15052164352617426930_46590ad9462dbddc, &__wrap__FuncTickdescribeTypeTick15052164352617426930_46590ad9462dbddc },
+    { 0xd574a36eb08c886c, false, (void*)&_FuncTickdescribeValueTick7225869591395707454_47e978031a7114d3, &__wrap__FuncTickdescribeValueTick7225869591395707454_47e978031a7114d3 },
+    { 0x749886810e4c6f49, false, (void*)&_FuncTickdescribeEnumerationTick10167141312159626520_b377a2f9bd48705b, &__wrap__FuncTickdescribeEnumerationTick10167141312159626520_b377a2f9bd48705b },
+    { 0xd7a7f2e23c382d6a, false, (void*)&_FuncTickdescribeStructureTick10827907688821779217_eda31ba1077a5e27, &__wrap__FuncTickdescribeStructureTick10827907688821779217_eda31ba1077a5e27 },
+    { 0x95aa9ad9aae9156b, false, (void*)&_FuncTickdescribeAnnotationTick9021868495512338670_9766e6316c523899, &__wrap__FuncTickdescribeAnnotationTick9021868495512338670_9766e6316c523899 },
+    { 0x51e85a9c8a632025, false, (void*)&_FuncTickdescribeFunctionTick10530476277455359167_8ef153d4d9b5ddbb, &__wrap__FuncTickdescribeFunctionTick10530476277455359167_8ef153d4d9b5ddbb },
+    { 0x33446ea8531f1d89, false, (void*)&_FuncTickdescribeVariableTick4438727553851220500_aab40c005a49d26f, &__wrap__FuncTickdescribeVariableTick4438727553851220500_aab40c005a49d26f },
+    { 0x8cd27d10f7f44cdc, false, (void*)&_FuncTickdescribeModuleTick5893429008970995053_3a044fca9cc79c00, &__wrap__FuncTickdescribeModuleTick5893429008970995053_3a044fca9cc79c00 },
+    { 0xdd8c105afdc10975, false, (void*)&_FuncrttiTickcontext_for_each_functionTick10212946581910492173_5f9871bbe9c4befd, &__wrap__FuncrttiTickcontext_for_each_functionTick10212946581910492173_5f9871bbe9c4befd },
+    { 0xe28ab22b53473687, false, (void*)&_FuncrttiTickcontext_for_each_variableTick13583238681075032270_aca7b2c0db620890, &__wrap__FuncrttiTickcontext_for_each_variableTick13583238681075032270_aca7b2c0db620890 },
+    { 0xce5c25ae6cab0176, false, (void*)&main_44ff410c9eff378b, &__wrap_main_44ff410c9eff378b },
+    { 0xa2406473ca14fc41, false, (void*)&test_b67965a0274f7c37, &__wrap_test_b67965a0274f7c37 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0xbfacfcd820842ebe, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_16322209504553669909
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,158 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_17192542642806598777 {
+
+extern TypeInfo __type_info__af8a9b4c8643c319;
+
+FuncInfo __func_info__34a46643eb4e8daa = {"invoke block<int&> const", "", nullptr, 0, 32, &__type_info__af8a9b4c8643c319, nullptr,0,UINT64_C(0x34a46643eb4e8daa), 0x0 };
+TypeInfo __type_info__af8a9b4c8643c319 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 4, UINT64_C(0xaf8a9b4c8643c319) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline int32_t & _FuncTickret_safe_refTick4629063469370206084_a47363c1854392a6 ( Context * __context__, int32_t & __a_rename_at_17_0 );
+inline int32_t & ret_ref_ed93f6d8c27b1c67 ( Context * __context__ );
+inline void add2_7e6cf629ef4f5eff ( Context * __context__, Block DAS_COMMENT((int32_t &)) const  & __bl_rename_at_23_2 );
+inline bool test_5705e164084dcca1 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global<int32_t,0x5963ec2e98dcf355>(__context__) = 2;/*g_t*/
+}
+
+inline int32_t & _FuncTickret_safe_refTick4629063469370206084_a47363c1854392a6 ( Context * __context__, int32_t & __a_rename_at_17_0 )
+{
+    return das_auto_cast_ref<int32_t &>::cast(__a_rename_at_17_0);
+}
+
+inline int32_t & ret_ref_ed93f6d8c27b1c67 ( Context * __context__ )
+{
+    int32_t * __qq_rename_at_10_1 = &(das_global<int32_t,0x5963ec2e98dcf355>(__context__) /*g_t*/);
+    return das_auto_cast_ref<int32_t &>::cast((*__qq_rename_at_10_1));
+}
+
+inline void add2_7e6cf629ef4f5eff ( Context * __context__, Block DAS_COMMENT((int32_t &)) const  &  __bl_rename_at_23_2 )
+{
+    das_invoke<int32_t &>::invoke(__context__,nullptr,__bl_rename_at_23_2) += 2;
+}
+
+inline bool test_5705e164084dcca1 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,128,"test " DAS_FILE_LINE);
+{
+    int32_t __x_rename_at_30_3 = ret_ref_ed93f6d8c27b1c67(__context__);
+    int32_t * __xx_rename_at_31_4 = &(_FuncTickret_safe_refTick4629063469370206084_a47363c1854392a6(__context__,__x_rename_at_30_3));
+    DAS_ASSERT(((*__xx_rename_at_31_4) == 2));
+    int32_t * __z_rename_at_33_5 = &(ret_ref_ed93f6d8c27b1c67(__context__));
+    DAS_ASSERT(((__x_rename_at_30_3 == 2) && ((*__z_rename_at_33_5) == 2)));
+    das_copy(ret_ref_ed93f6d8c27b1c67(__context__),3);
+    DAS_ASSERT(((__x_rename_at_30_3 == 2) && ((*__z_rename_at_33_5) == 3)));
+    das_copy((*__xx_rename_at_31_4),4);
+    DAS_ASSERT((((__x_rename_at_30_3 == 4) && ((*__z_rename_at_33_5) == 3)) && ((*__xx_rename_at_31_4) == 4)));
+    add2_7e6cf629ef4f5eff(__context__,das_make_block<int32_t &>(__context__,0,0,&__func_info__34a46643eb4e8daa,[&]() -> int32_t &{
+        return das_auto_cast_ref<int32_t &>::cast(__x_rename_at_30_3);
+    }));
+    DAS_ASSERT((__x_rename_at_30_3 == 6));
+    return das_auto_cast<bool>::cast(true);
+}}
+static vec4f __wrap__FuncTickret_safe_refTick4629063469370206084_a47363c1854392a6 ( Context * __context__ ) {
+    int32_t & arg_a = cast_aot_arg<int32_t &>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int32_t &>::from(_FuncTickret_safe_refTick4629063469370206084_a47363c1854392a6(__context__, arg_a));
+}
+static vec4f __wrap_ret_ref_ed93f6d8c27b1c67 ( Context * __context__ ) {
+    return cast<int32_t &>::from(ret_ref_ed93f6d8c27b1c67(__context__));
+}
+static vec4f __wrap_add2_7e6cf629ef4f5eff ( Context * __context__ ) {
+    Block DAS_COMMENT((int32_t &)) const  &  arg_bl = cast_aot_arg<Block DAS_COMMENT((int32_t &)) const  & >::to(*__context__,__context__->abiArguments()[0]);
+    add2_7e6cf629ef4f5eff(__context__, arg_bl);
+    return v_zero();
+}
+static vec4f __wrap_test_5705e164084dcca1 ( Context * __context__ ) {
+    return cast<bool>::from(test_5705e164084dcca1(__context__));
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x6fea7933217f20f0, false, (void*)&_FuncTickret_safe_refTick4629063469370206084_a47363c1854392a6, &__wrap__FuncTickret_safe_refTick4629063469370206084_a47363c1854392a6 },
+    { 0x63bba60e2798dd3a, false, (void*)&ret_ref_ed93f6d8c27b1c67, &__wrap_ret_ref_ed93f6d8c27b1c67 },
+    { 0xc625653f1d8ecb56, false, (void*)&add2_7e6cf629ef4f5eff, &__wrap_add2_7e6cf629ef4f5eff },
+    { 0xc29a41e4ba6ae84a, false, (void*)&test_5705e164084dcca1, &__wrap_test_5705e164084dcca1 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x12730ec77d8ced7f, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_17192542642806598777
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
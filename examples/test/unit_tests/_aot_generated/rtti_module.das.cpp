@@ -0,0 +1,544 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_7772675775669451218 {
+
+namespace  { struct _lambda_thismodule_93_1; };
+namespace  { struct _lambda_thismodule_67_2; };
+// unused enumeration CompilationError
+#if 0 // external enum
+namespace rtti {
+
+enum class ConstMatters : int32_t {
+    no = int32_t(INT64_C(0)),
+    yes = int32_t(INT64_C(1)),
+};
+}
+#endif // external enum
+#if 0 // external enum
+namespace rtti {
+
+enum class RefMatters : int32_t {
+    no = int32_t(INT64_C(0)),
+    yes = int32_t(INT64_C(1)),
+};
+}
+#endif // external enum
+#if 0 // external enum
+namespace rtti {
+
+enum class TemporaryMatters : int32_t {
+    no = int32_t(INT64_C(0)),
+    yes = int32_t(INT64_C(1)),
+};
+}
+#endif // external enum
+// unused enumeration Type
+namespace  {
+
+struct _lambda_thismodule_93_1 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_93_1,char * &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_93_1 *)) __finalize;
+    int32_t __yield;
+    TypeInfo const  * pinfo;
+    bool ___loop_at_95_16_rename_at_95_16;
+    int32_t __index_rename_at_95_21;
+    void * ___pvar_0_at_95_16_rename_at_95_16;
+    Sequence DAS_COMMENT((int32_t)) ___source_0_at_95_16_rename_at_95_16;
+};
+static_assert(sizeof(_lambda_thismodule_93_1)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_1,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_1,pinfo)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_1,___loop_at_95_16_rename_at_95_16)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_1,__index_rename_at_95_21)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_1,___pvar_0_at_95_16_rename_at_95_16)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_1,___source_0_at_95_16_rename_at_95_16)==48,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_67_2 {
+    Func DAS_COMMENT((bool,_lambda_thismodule_67_2,TypeInfo const  * &)) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_67_2 *)) __finalize;
+    int32_t __yield;
+    TypeInfo const  * pinfo;
+    bool ___loop_at_69_16_rename_at_69_16;
+    int32_t __index_rename_at_69_21;
+    void * ___pvar_0_at_69_16_rename_at_69_16;
+    Sequence DAS_COMMENT((int32_t)) ___source_0_at_69_16_rename_at_69_16;
+};
+static_assert(sizeof(_lambda_thismodule_67_2)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_67_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_67_2,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_67_2,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_67_2,pinfo)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_67_2,___loop_at_69_16_rename_at_69_16)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_67_2,__index_rename_at_69_21)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_67_2,___pvar_0_at_69_16_rename_at_69_16)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_67_2,___source_0_at_69_16_rename_at_69_16)==48,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__75f7ed8daa9b6e16;
+extern StructInfo __struct_info__4a00847eca3eba07;
+extern TypeInfo __type_info__72adf46c1b19c293;
+extern TypeInfo __type_info__af909b4c864df519;
+extern TypeInfo __type_info__11471aa5f58e7d88;
+extern TypeInfo __type_info__c09388eecffbba6b;
+extern TypeInfo __type_info__bc67beb4aa160fd4;
+extern TypeInfo __type_info__3f5be9de29fade10;
+extern TypeInfo __type_info__af81fe4c86352052;
+extern TypeInfo __type_info__af85fe4c863bec52;
+extern TypeInfo __type_info__af8afe4c86446b52;
+extern TypeInfo __type_info__c765a0d19bb29141;
+extern TypeInfo __type_info__1db215ea2991ef6c;
+extern TypeInfo __type_info__af63db4c8601ead9;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+TypeInfo * __type_info__67588de5a2e954ab_arg_types_var_8500524014393585174[2] = { &__type_info__c765a0d19bb29141, &__type_info__72adf46c1b19c293 };
+const char * __type_info__67588de5a2e954ab_arg_names_var_8500524014393585174[2] = { "__this", "_ryield67" };
+VarInfo __struct_info__75f7ed8daa9b6e16_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__67588de5a2e954ab_arg_types_var_8500524014393585174, __type_info__67588de5a2e954ab_arg_names_var_8500524014393585174, 2, 0, nullptr, 12, 8, UINT64_C(0x67588de5a2e954ab), "__lambda", 0, 0 };
+TypeInfo * __type_info__de789adf07643c64_arg_types_var_8500524014393585174[1] = { &__type_info__11471aa5f58e7d88 };
+const char * __type_info__de789adf07643c64_arg_names_var_8500524014393585174[1] = { "__this" };
+VarInfo __struct_info__75f7ed8daa9b6e16_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__de789adf07643c64_arg_types_var_8500524014393585174, __type_info__de789adf07643c64_arg_names_var_8500524014393585174, 1, 0, nullptr, 12, 8, UINT64_C(0xde789adf07643c64), "__finalize", 8, 0 };
+VarInfo __struct_info__75f7ed8daa9b6e16_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x9f83910bd8ddc940), "__yield", 16, 0 };
+VarInfo __struct_info__75f7ed8daa9b6e16_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bc67beb4aa160fd4, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xcd1601a21fedaa18), "pinfo", 24, 6 };
+VarInfo __struct_info__75f7ed8daa9b6e16_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x89fa6b9d7554cf12), "___loop_at_69_16_rename_at_69_16", 32, 0 };
+VarInfo __struct_info__75f7ed8daa9b6e16_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x1489b5ead894a4af), "__index_rename_at_69_21", 36, 0 };
+VarInfo __struct_info__75f7ed8daa9b6e16_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x7305933ffc886303), "___pvar_0_at_69_16_rename_at_69_16", 40, 7 };
+VarInfo __struct_info__75f7ed8daa9b6e16_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xe913d22a5509d521), "___source_0_at_69_16_rename_at_69_16", 48, 8 };
+VarInfo * __struct_info__75f7ed8daa9b6e16_fields[8] =  { &__struct_info__75f7ed8daa9b6e16_field_0, &__struct_info__75f7ed8daa9b6e16_field_1, &__struct_info__75f7ed8daa9b6e16_field_2, &__struct_info__75f7ed8daa9b6e16_field_3, &__struct_info__75f7ed8daa9b6e16_field_4, &__struct_info__75f7ed8daa9b6e16_field_5, &__struct_info__75f7ed8daa9b6e16_field_6, &__struct_info__75f7ed8daa9b6e16_field_7 };
+StructInfo __struct_info__75f7ed8daa9b6e16 = {"_lambda_thismodule_67_2", "", 14, __struct_info__75f7ed8daa9b6e16_fields, 8, 56, UINT64_C(0x0), nullptr, UINT64_C(0x75f7ed8daa9b6e16), 3 };
+TypeInfo * __type_info__dd762e161d9a16e0_arg_types_var_5332407638900521479[2] = { &__type_info__1db215ea2991ef6c, &__type_info__af909b4c864df519 };
+const char * __type_info__dd762e161d9a16e0_arg_names_var_5332407638900521479[2] = { "__this", "_yield_93" };
+VarInfo __struct_info__4a00847eca3eba07_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af81fe4c86352052, nullptr, (TypeInfo **)__type_info__dd762e161d9a16e0_arg_types_var_5332407638900521479, __type_info__dd762e161d9a16e0_arg_names_var_5332407638900521479, 2, 0, nullptr, 12, 8, UINT64_C(0xdd762e161d9a16e0), "__lambda", 0, 0 };
+TypeInfo * __type_info__3790a8e48022a061_arg_types_var_5332407638900521479[1] = { &__type_info__c09388eecffbba6b };
+VarInfo __struct_info__4a00847eca3eba07_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__3790a8e48022a061_arg_types_var_5332407638900521479, __type_info__de789adf07643c64_arg_names_var_8500524014393585174, 1, 0, nullptr, 12, 8, UINT64_C(0x3790a8e48022a061), "__finalize", 8, 0 };
+VarInfo __struct_info__4a00847eca3eba07_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xc0234b3d23fda33b), "__yield", 16, 0 };
+VarInfo __struct_info__4a00847eca3eba07_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bc67beb4aa160fd4, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xf3ed10431305ca55), "pinfo", 24, 6 };
+VarInfo __struct_info__4a00847eca3eba07_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x2854fc5bcf3b4de5), "___loop_at_95_16_rename_at_95_16", 32, 0 };
+VarInfo __struct_info__4a00847eca3eba07_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x9ba84cdbe3dab089), "__index_rename_at_95_21", 36, 0 };
+VarInfo __struct_info__4a00847eca3eba07_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xa30d1f70f9618d5a), "___pvar_0_at_95_16_rename_at_95_16", 40, 7 };
+VarInfo __struct_info__4a00847eca3eba07_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x97632c8567330552), "___source_0_at_95_16_rename_at_95_16", 48, 8 };
+VarInfo * __struct_info__4a00847eca3eba07_fields[8] =  { &__struct_info__4a00847eca3eba07_field_0, &__struct_info__4a00847eca3eba07_field_1, &__struct_info__4a00847eca3eba07_field_2, &__struct_info__4a00847eca3eba07_field_3, &__struct_info__4a00847eca3eba07_field_4, &__struct_info__4a00847eca3eba07_field_5, &__struct_info__4a00847eca3eba07_field_6, &__struct_info__4a00847eca3eba07_field_7 };
+StructInfo __struct_info__4a00847eca3eba07 = {"_lambda_thismodule_93_1", "", 14, __struct_info__4a00847eca3eba07_fields, 8, 56, UINT64_C(0x0), nullptr, UINT64_C(0x4a00847eca3eba07), 3 };
+TypeInfo __type_info__72adf46c1b19c293 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bc67beb4aa160fd4, nullptr, nullptr, nullptr, 0, 0, nullptr, 24845, 8, UINT64_C(0x72adf46c1b19c293) };
+TypeInfo __type_info__af909b4c864df519 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16645, 8, UINT64_C(0xaf909b4c864df519) };
+TypeInfo __type_info__11471aa5f58e7d88 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c765a0d19bb29141, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x11471aa5f58e7d88) };
+TypeInfo __type_info__c09388eecffbba6b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1db215ea2991ef6c, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xc09388eecffbba6b) };
+TypeInfo __type_info__bc67beb4aa160fd4 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::TypeInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24622, 80, UINT64_C(0xbc67beb4aa160fd4) };
+TypeInfo * __type_info__3f5be9de29fade10_arg_types[2] = { &__type_info__af63e44c8601fa24, &__type_info__af63db4c8601ead9 };
+const char * __type_info__3f5be9de29fade10_arg_names[2] = { "i", "f" };
+TypeInfo __type_info__3f5be9de29fade10 = { Type::tVariant, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__3f5be9de29fade10_arg_types, __type_info__3f5be9de29fade10_arg_names, 2, 0, nullptr, 62, 8, UINT64_C(0x3f5be9de29fade10) };
+TypeInfo __type_info__af81fe4c86352052 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 1, UINT64_C(0xaf81fe4c86352052) };
+TypeInfo __type_info__af85fe4c863bec52 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf85fe4c863bec52) };
+TypeInfo __type_info__af8afe4c86446b52 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf8afe4c86446b52) };
+TypeInfo __type_info__c765a0d19bb29141 = { Type::tStructure, &__struct_info__75f7ed8daa9b6e16, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 56, UINT64_C(0xc765a0d19bb29141) };
+TypeInfo __type_info__1db215ea2991ef6c = { Type::tStructure, &__struct_info__4a00847eca3eba07, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 56, UINT64_C(0x1db215ea2991ef6c) };
+TypeInfo __type_info__af63db4c8601ead9 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63db4c8601ead9) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {__type_info__bc67beb4aa160fd4, };
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 ( Context * __context__, range __rng_rename_at_1398_0 );
+inline void finalize_63349735876529ca ( Context * __context__, _lambda_thismodule_93_1 & ____this_rename_at_93_2 );
+inline void finalize_6391f0c3cba8559a ( Context * __context__, _lambda_thismodule_67_2 & ____this_rename_at_67_3 );
+inline Sequence DAS_COMMENT((char *)) _FuncbuiltinTickeachTick9663565701927713696_9ed40335195dc880 ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const  __lam_rename_at_1443_4 );
+inline Sequence DAS_COMMENT((TypeInfo &)) _FuncbuiltinTickeach_refTick16137060296763333387_97926cd17e20a9cf ( Context * __context__, Lambda DAS_COMMENT((bool,TypeInfo const  * &)) const  __lam_rename_at_1453_6 );
+inline bool _Func_lambda_thismodule_93_1Tickfunction_433f18d6a8385b4b ( Context * __context__, _lambda_thismodule_93_1 & ____this_rename_at_93_8, char * & ___yield_93_rename_at_93_9 );
+inline void _Func_lambda_thismodule_93_1Tickfinalizer_2de1a8413a3d96bc ( Context * __context__, _lambda_thismodule_93_1 * ____this_rename_at_93_10 );
+inline bool _Func_lambda_thismodule_67_2Tickfunction_c9ee6bef8b02e8d1 ( Context * __context__, _lambda_thismodule_67_2 & ____this_rename_at_67_11, TypeInfo const  * & ___ryield67_rename_at_67_12 );
+inline void _Func_lambda_thismodule_67_2Tickfinalizer_5986713eee2be0c9 ( Context * __context__, _lambda_thismodule_67_2 * ____this_rename_at_67_13 );
+inline Sequence DAS_COMMENT((char *)) _FuncrttiTickarg_names_anyTick16736947398500939560_25677896d3b20a94 ( Context * __context__, TypeInfo const  & __info_rename_at_90_14 );
+inline Sequence DAS_COMMENT((TypeInfo &)) _FuncrttiTickarg_types_anyTick14095493126742042784_26eef316f6c70ee6 ( Context * __context__, TypeInfo const  & __info_rename_at_64_16 );
+inline bool _FuncrttiTickis_same_typeTick12422253018169499925_fdbe8e4829770782 ( Context * __context__, TypeInfo const  & __a_rename_at_16_18, TypeInfo const  & __b_rename_at_16_19, DAS_COMMENT(bound_enum) das::RefMatters __refMatters_rename_at_17_20, DAS_COMMENT(bound_enum) das::ConstMatters __constMatters_rename_at_18_21, DAS_COMMENT(bound_enum) das::TemporaryMatters __temporaryMatters_rename_at_19_22, bool __topLevel_rename_at_20_23 );
+inline Sequence DAS_COMMENT((char *)) _FuncrttiTickarg_namesTick10966414128355233648_c020dc6e26805aac ( Context * __context__, TypeInfo const  & __info_rename_at_107_24 );
+inline Sequence DAS_COMMENT((TypeInfo &)) _FuncrttiTickarg_typesTick414029999383747864_e4299aa10a7435d9 ( Context * __context__, TypeInfo const  & __info_rename_at_81_25 );
+inline bool test_c3237cf5310d5b2 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 ( Context * __context__, range __rng_rename_at_1398_0 )
+{
+    Sequence DAS_COMMENT((int32_t)) __it_rename_at_1399_1;das_zero(__it_rename_at_1399_1);
+    builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_1399_1),__rng_rename_at_1398_0,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_1399_1);
+}
+
+inline void finalize_63349735876529ca ( Context * __context__, _lambda_thismodule_93_1 &  ____this_rename_at_93_2 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_93_2.___source_0_at_95_16_rename_at_95_16),__context__);
+    memset((void*)&(____this_rename_at_93_2), 0, 56);
+}
+
+inline void finalize_6391f0c3cba8559a ( Context * __context__, _lambda_thismodule_67_2 &  ____this_rename_at_67_3 )
+{
+    builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_67_3.___source_0_at_69_16_rename_at_69_16),__context__);
+    memset((void*)&(____this_rename_at_67_3), 0, 56);
+}
+
+inline Sequence DAS_COMMENT((char *)) _FuncbuiltinTickeachTick9663565701927713696_9ed40335195dc880 ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const  __lam_rename_at_1443_4 )
+{
+    Sequence DAS_COMMENT((char *)) __it_rename_at_1445_5;das_zero(__it_rename_at_1445_5);
+    builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((char *))>::pass(__it_rename_at_1445_5),__lam_rename_at_1443_4,8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char *))>::cast(__it_rename_at_1445_5);
+}
+
+inline Sequence DAS_COMMENT((TypeInfo &)) _FuncbuiltinTickeach_refTick16137060296763333387_97926cd17e20a9cf ( Context * __context__, Lambda DAS_COMMENT((bool,TypeInfo const  * &)) const  __lam_rename_at_1453_6 )
+{
+    Sequence DAS_COMMENT((TypeInfo *)) __it_rename_at_1454_7;das_zero(__it_rename_at_1454_7);
+    builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TypeInfo const ))>::pass(__it_rename_at_1454_7),__lam_rename_at_1453_6,8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TypeInfo &))>::cast(__it_rename_at_1454_7);
+}
+
+inline bool _Func_lambda_thismodule_93_1Tickfunction_433f18d6a8385b4b ( Context * __context__, _lambda_thismodule_93_1 &  ____this_rename_at_93_8, char * & ___yield_93_rename_at_93_9 )
+{
+    switch (____this_rename_at_93_8.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    case 5: goto label_5;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    if ( !(____this_rename_at_93_8.pinfo->argNames /*argNames*/ != nullptr) )
+    {
+        goto label_5;
+    };
+    das_copy(____this_rename_at_93_8.___loop_at_95_16_rename_at_95_16,true);
+    das_move(____this_rename_at_93_8.___source_0_at_95_16_rename_at_95_16,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,mk_range(int32_t(____this_rename_at_93_8.pinfo->argCount /*argCount*/))));
+    memset((void*)&(____this_rename_at_93_8.__index_rename_at_95_21), 0, 4);
+    das_copy(____this_rename_at_93_8.___pvar_0_at_95_16_rename_at_95_16,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_93_8.__index_rename_at_95_21)));
+    DAS_SETBOOLAND((____this_rename_at_93_8.___loop_at_95_16_rename_at_95_16),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_93_8.___source_0_at_95_16_rename_at_95_16),____this_rename_at_93_8.___pvar_0_at_95_16_rename_at_95_16,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_93_8.___loop_at_95_16_rename_at_95_16 )
+    {
+        goto label_4;
+    };
+    das_copy(___yield_93_rename_at_93_9,das_index<char * const  * const >::at(____this_rename_at_93_8.pinfo->argNames /*argNames*/,____this_rename_at_93_8.__index_rename_at_95_21,__context__));
+    das_copy(____this_rename_at_93_8.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_93_8.___loop_at_95_16_rename_at_95_16),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_93_8.___source_0_at_95_16_rename_at_95_16),____this_rename_at_93_8.___pvar_0_at_95_16_rename_at_95_16,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_93_8.___source_0_at_95_16_rename_at_95_16),____this_rename_at_93_8.___pvar_0_at_95_16_rename_at_95_16,__context__);
+    label_5:;;
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_93_1Tickfinalizer_2de1a8413a3d96bc ( Context * __context__, _lambda_thismodule_93_1 * ____this_rename_at_93_10 )
+{
+    finalize_63349735876529ca(__context__,das_arg<_lambda_thismodule_93_1>::pass(das_deref(__context__,____this_rename_at_93_10,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_93_1 *>::clear(__context__,____this_rename_at_93_10);
+}
+
+inline bool _Func_lambda_thismodule_67_2Tickfunction_c9ee6bef8b02e8d1 ( Context * __context__, _lambda_thismodule_67_2 &  ____this_rename_at_67_11, TypeInfo const  * & ___ryield67_rename_at_67_12 )
+{
+    switch (____this_rename_at_67_11.__yield) {
+    case 0: goto label_0;
+    case 2: goto label_2;
+    case 1: goto label_1;
+    case 3: goto label_3;
+    case 4: goto label_4;
+    case 5: goto label_5;
+    default: __context__->throw_error("invalid label");
+    };
+    label_0:;;
+    if ( !(____this_rename_at_67_11.pinfo->argTypes /*argTypes*/ != nullptr) )
+    {
+        goto label_5;
+    };
+    das_copy(____this_rename_at_67_11.___loop_at_69_16_rename_at_69_16,true);
+    das_move(____this_rename_at_67_11.___source_0_at_69_16_rename_at_69_16,_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,mk_range(int32_t(____this_rename_at_67_11.pinfo->argCount /*argCount*/))));
+    memset((void*)&(____this_rename_at_67_11.__index_rename_at_69_21), 0, 4);
+    das_copy(____this_rename_at_67_11.___pvar_0_at_69_16_rename_at_69_16,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_67_11.__index_rename_at_69_21)));
+    DAS_SETBOOLAND((____this_rename_at_67_11.___loop_at_69_16_rename_at_69_16),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_67_11.___source_0_at_69_16_rename_at_69_16),____this_rename_at_67_11.___pvar_0_at_69_16_rename_at_69_16,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    label_2:;;
+    if ( !____this_rename_at_67_11.___loop_at_69_16_rename_at_69_16 )
+    {
+        goto label_4;
+    };
+    das_copy(___ryield67_rename_at_67_12,das_ref(__context__,das_deref(__context__,das_index<TypeInfo * * const >::at(____this_rename_at_67_11.pinfo->argTypes /*argTypes*/,____this_rename_at_67_11.__index_rename_at_69_21,__context__),__FILE__,__LINE__)));
+    das_copy(____this_rename_at_67_11.__yield,1);
+    return das_auto_cast<bool>::cast(true);
+    label_1:;;
+    label_3:;;
+    DAS_SETBOOLAND((____this_rename_at_67_11.___loop_at_69_16_rename_at_69_16),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_67_11.___source_0_at_69_16_rename_at_69_16),____this_rename_at_67_11.___pvar_0_at_69_16_rename_at_69_16,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))));
+    goto label_2;
+    label_4:;;
+    builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_67_11.___source_0_at_69_16_rename_at_69_16),____this_rename_at_67_11.___pvar_0_at_69_16_rename_at_69_16,__context__);
+    label_5:;;
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_67_2Tickfinalizer_5986713eee2be0c9 ( Context * __context__, _lambda_thismodule_67_2 * ____this_rename_at_67_13 )
+{
+    finalize_6391f0c3cba8559a(__context__,das_arg<_lambda_thismodule_67_2>::pass(das_deref(__context__,____this_rename_at_67_13,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_67_2 *>::clear(__context__,____this_rename_at_67_13);
+}
+
+inline Sequence DAS_COMMENT((char *)) _FuncrttiTickarg_names_anyTick16736947398500939560_25677896d3b20a94 ( Context * __context__, TypeInfo const  &  __info_rename_at_90_14 )
+{
+    TypeInfo const  * __pinfo_rename_at_92_15 = ((TypeInfo const  *)das_ref(__context__,__info_rename_at_90_14));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char *))>::cast(_FuncbuiltinTickeachTick9663565701927713696_9ed40335195dc880(__context__,das_ascend<bool,_lambda_thismodule_93_1>::make(__context__,&__type_info__1db215ea2991ef6c,(([&]() -> _lambda_thismodule_93_1 {
+        _lambda_thismodule_93_1 __mks_93;
+        das_zero(__mks_93);
+        das_copy((__mks_93.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_93_1`function XS<_lambda_thismodule_93_1> &s*/ 0xd8022660de8d6ea8))));
+        das_copy((__mks_93.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_93_1`finalizer X1<S<_lambda_thismodule_93_1>>?*/ 0xd83b72536633a3ec))));
+        das_copy((__mks_93.pinfo),(__pinfo_rename_at_92_15));
+        return __mks_93;
+    })()))));
+}
+
+inline Sequence DAS_COMMENT((TypeInfo &)) _FuncrttiTickarg_types_anyTick14095493126742042784_26eef316f6c70ee6 ( Context * __context__, TypeInfo const  &  __info_rename_at_64_16 )
+{
+    TypeInfo const  * __pinfo_rename_at_66_17 = ((TypeInfo const  *)das_ref(__context__,__info_rename_at_64_16));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TypeInfo &))>::cast(_FuncbuiltinTickeach_refTick16137060296763333387_97926cd17e20a9cf(__context__,das_ascend<bool,_lambda_thismodule_67_2>::make(__context__,&__type_info__c765a0d19bb29141,(([&]() -> _lambda_thismodule_67_2 {
+        _lambda_thismodule_67_2 __mks_67;
+        das_zero(__mks_67);
+        das_copy((__mks_67.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_67_2`function XS<_lambda_thismodule_67_2> &1<CH<rtti::TypeInfo>>?*/ 0x64ef2f38155a675))));
+        das_copy((__mks_67.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_67_2`finalizer X1<S<_lambda_thismodule_67_2>>?*/ 0x9afdf1385fb17190))));
+        das_copy((__mks_67.pinfo),(__pinfo_rename_at_66_17));
+        return __mks_67;
+    })()))));
+}
+
+inline bool _FuncrttiTickis_same_typeTick12422253018169499925_fdbe8e4829770782 ( Context * __context__, TypeInfo const  &  __a_rename_at_16_18, TypeInfo const  &  __b_rename_at_16_19, DAS_COMMENT(bound_enum) das::RefMatters __refMatters_rename_at_17_20, DAS_COMMENT(bound_enum) das::ConstMatters __constMatters_rename_at_18_21, DAS_COMMENT(bound_enum) das::TemporaryMatters __temporaryMatters_rename_at_19_22, bool __topLevel_rename_at_20_23 )
+{
+    return das_auto_cast<bool>::cast(isSameType(das_cast<TypeInfo const  *>::cast(__a_rename_at_16_18),das_cast<TypeInfo const  *>::cast(__b_rename_at_16_19),__refMatters_rename_at_17_20,__constMatters_rename_at_18_21,__temporaryMatters_rename_at_19_22,__topLevel_rename_at_20_23));
+}
+
+inline Sequence DAS_COMMENT((char *)) _FuncrttiTickarg_namesTick10966414128355233648_c020dc6e26805aac ( Context * __context__, TypeInfo const  &  __info_rename_at_107_24 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char *))>::cast(_FuncrttiTickarg_names_anyTick16736947398500939560_25677896d3b20a94(__context__,__info_rename_at_107_24));
+}
+
+inline Sequence DAS_COMMENT((TypeInfo &)) _FuncrttiTickarg_typesTick414029999383747864_e4299aa10a7435d9 ( Context * __context__, TypeInfo const  &  __info_rename_at_81_25 )
+{
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TypeInfo &))>::cast(_FuncrttiTickarg_types_anyTick14095493126742042784_26eef316f6c70ee6(__context__,__info_rename_at_81_25));
+}
+
+inline bool test_c3237cf5310d5b2 ( Context * __context__ )
+{
+    Sequence DAS_COMMENT((char *)) _temp_make_local_12_30_0; _temp_make_local_12_30_0;
+    Sequence DAS_COMMENT((TypeInfo *)) _temp_make_local_12_48_1; _temp_make_local_12_48_1;
+    DAS_VERIFY((_FuncrttiTickis_same_typeTick12422253018169499925_fdbe8e4829770782(__context__,(__type_info__af8afe4c86446b52),(__type_info__af8afe4c86446b52),DAS_COMMENT(bound_enum) das::RefMatters::yes,DAS_COMMENT(bound_enum) das::ConstMatters::yes,DAS_COMMENT(bound_enum) das::TemporaryMatters::yes,true)));
+    DAS_VERIFY((!_FuncrttiTickis_same_typeTick12422253018169499925_fdbe8e4829770782(__context__,(__type_info__af85fe4c863bec52),(__type_info__af8afe4c86446b52),DAS_COMMENT(bound_enum) das::RefMatters::yes,DAS_COMMENT(bound_enum) das::ConstMatters::yes,DAS_COMMENT(bound_enum) das::TemporaryMatters::yes,true)));
+    TVariant<8,4,int32_t,float> __v_rename_at_9_26_ConstRef;das_zero(__v_rename_at_9_26_ConstRef);
+    TVariant<8,4,int32_t,float> const  & __v_rename_at_9_26 = __v_rename_at_9_26_ConstRef;
+;
+    TypeInfo * __vinfo_rename_at_10_27 = ((TypeInfo *)&((__type_info__3f5be9de29fade10)));
+    DAS_ASSERT(((*__vinfo_rename_at_10_27).argCount /*argCount*/ == 0x2u));
+    {
+        bool __need_loop_12 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(0,2));
+        int32_t __i_rename_at_12_34;
+        __need_loop_12 = __i_iterator.first(__context__,(__i_rename_at_12_34)) && __need_loop_12;
+        // n: string
+        das_iterator<Sequence DAS_COMMENT((char *))> __n_iterator((_temp_make_local_12_30_0 = (_FuncrttiTickarg_namesTick10966414128355233648_c020dc6e26805aac(__context__,(*__vinfo_rename_at_10_27)))));
+        char * __n_rename_at_12_35;
+        __need_loop_12 = __n_iterator.first(__context__,(__n_rename_at_12_35)) && __need_loop_12;
+        // t: rtti::TypeInfo const&
+        das_iterator<Sequence DAS_COMMENT((TypeInfo const ))> __t_iterator((_temp_make_local_12_48_1 = (_FuncrttiTickarg_typesTick414029999383747864_e4299aa10a7435d9(__context__,(*__vinfo_rename_at_10_27)))));
+        TypeInfo const  * __t_rename_at_12_36;
+        __need_loop_12 = __t_iterator.first(__context__,(__t_rename_at_12_36)) && __need_loop_12;
+        for ( ; __need_loop_12 ; __need_loop_12 = __i_iterator.next(__context__,(__i_rename_at_12_34)) && __n_iterator.next(__context__,(__n_rename_at_12_35)) && __t_iterator.next(__context__,(__t_rename_at_12_36)) )
+        {
+            if ( __i_rename_at_12_34 == 0 )
+            {
+                DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__n_rename_at_12_35),cast<char *>::from(((char *) "i")),*__context__,nullptr)));
+                DAS_VERIFY((_FuncrttiTickis_same_typeTick12422253018169499925_fdbe8e4829770782(__context__,(__type_info__af8afe4c86446b52),(*__t_rename_at_12_36),DAS_COMMENT(bound_enum) das::RefMatters::no,DAS_COMMENT(bound_enum) das::ConstMatters::no,DAS_COMMENT(bound_enum) das::TemporaryMatters::yes,true)));
+            } else if ( __i_rename_at_12_34 == 1 )
+            {
+                DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__n_rename_at_12_35),cast<char *>::from(((char *) "f")),*__context__,nullptr)));
+                DAS_VERIFY((_FuncrttiTickis_same_typeTick12422253018169499925_fdbe8e4829770782(__context__,(__type_info__af85fe4c863bec52),(*__t_rename_at_12_36),DAS_COMMENT(bound_enum) das::RefMatters::no,DAS_COMMENT(bound_enum) das::ConstMatters::no,DAS_COMMENT(bound_enum) das::TemporaryMatters::yes,true)));
+            };
+        }
+        __t_iterator.close(__context__,(__t_rename_at_12_36));
+        __n_iterator.close(__context__,(__n_rename_at_12_35));
+        __i_iterator.close(__context__,(__i_rename_at_12_34));
+    };
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 ( Context * __context__ ) {
+    range arg_rng = cast_aot_arg<range>::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__, arg_rng);
+    return v_zero();
+}
+static vec4f __wrap_finalize_63349735876529ca ( Context * __context__ ) {
+    _lambda_thismodule_93_1 &  arg___this = cast_aot_arg<_lambda_thismodule_93_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_63349735876529ca(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_6391f0c3cba8559a ( Context * __context__ ) {
+    _lambda_thismodule_67_2 &  arg___this = cast_aot_arg<_lambda_thismodule_67_2 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_6391f0c3cba8559a(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeachTick9663565701927713696_9ed40335195dc880 ( Context * __context__ ) {
+    Lambda DAS_COMMENT((bool,char * &)) const  arg_lam = cast_aot_arg<Lambda DAS_COMMENT((bool,char * &)) const >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((char *)) *) __context__->abiCMRES) = _FuncbuiltinTickeachTick9663565701927713696_9ed40335195dc880(__context__, arg_lam);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeach_refTick16137060296763333387_97926cd17e20a9cf ( Context * __context__ ) {
+    Lambda DAS_COMMENT((bool,TypeInfo const  * &)) const  arg_lam = cast_aot_arg<Lambda DAS_COMMENT((bool,TypeInfo const  * &)) const >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((TypeInfo &)) *) __context__->abiCMRES) = _FuncbuiltinTickeach_refTick16137060296763333387_97926cd17e20a9cf(__context__, arg_lam);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_93_1Tickfunction_433f18d6a8385b4b ( Context * __context__ ) {
+    _lambda_thismodule_93_1 &  arg___this = cast_aot_arg<_lambda_thismodule_93_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    char * & arg__yield_93 = cast_aot_arg<char * &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_93_1Tickfunction_433f18d6a8385b4b(__context__, arg___this, arg__yield_93));
+}
+static vec4f __wrap__Func_lambda_thismodule_93_1Tickfinalizer_2de1a8413a3d96bc ( Context * __context__ ) {
+    _lambda_thismodule_93_1 * arg___this = cast_aot_arg<_lambda_thismodule_93_1 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_93_1Tickfinalizer_2de1a8413a3d96bc(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_67_2Tickfunction_c9ee6bef8b02e8d1 ( Context * __context__ ) {
+    _lambda_thismodule_67_2 &  arg___this = cast_aot_arg<_lambda_thismodule_67_2 & >::to(*__context__,__context__->abiArguments()[0]);
+    TypeInfo const  * & arg__ryield67 = cast_aot_arg<TypeInfo const  * &>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_Func_lambda_thismodule_67_2Tickfunction_c9ee6bef8b02e8d1(__context__, arg___this, arg__ryield67));
+}
+static vec4f __wrap__Func_lambda_thismodule_67_2Tickfinalizer_5986713eee2be0c9 ( Context * __context__ ) {
+    _lambda_thismodule_67_2 * arg___this = cast_aot_arg<_lambda_thismodule_67_2 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_67_2Tickfinalizer_5986713eee2be0c9(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncrttiTickarg_names_anyTick16736947398500939560_25677896d3b20a94 ( Context * __context__ ) {
+    TypeInfo const  &  arg_info = cast_aot_arg<TypeInfo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((char *)) *) __context__->abiCMRES) = _FuncrttiTickarg_names_anyTick16736947398500939560_25677896d3b20a94(__context__, arg_info);
+    return v_zero();
+}
+static vec4f __wrap__FuncrttiTickarg_types_anyTick14095493126742042784_26eef316f6c70ee6 ( Context * __context__ ) {
+    TypeInfo const  &  arg_info = cast_aot_arg<TypeInfo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((TypeInfo &)) *) __context__->abiCMRES) = _FuncrttiTickarg_types_anyTick14095493126742042784_26eef316f6c70ee6(__context__, arg_info);
+    return v_zero();
+}
+static vec4f __wrap__FuncrttiTickis_same_typeTick12422253018169499925_fdbe8e4829770782 ( Context * __context__ ) {
+    TypeInfo const  &  arg_a = cast_aot_arg<TypeInfo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    TypeInfo const  &  arg_b = cast_aot_arg<TypeInfo const  & >::to(*__context__,__context__->abiArguments()[1]);
+    DAS_COMMENT(bound_enum) das::RefMatters arg_refMatters = cast_aot_arg<DAS_COMMENT(bound_enum) das::RefMatters>::to(*__context__,__context__->abiArguments()[2]);
+    DAS_COMMENT(bound_enum) das::ConstMatters arg_constMatters = cast_aot_arg<DAS_COMMENT(bound_enum) das::ConstMatters>::to(*__context__,__context__->abiArguments()[3]);
+    DAS_COMMENT(bound_enum) das::TemporaryMatters arg_temporaryMatters = cast_aot_arg<DAS_COMMENT(bound_enum) das::TemporaryMatters>::to(*__context__,__context__->abiArguments()[4]);
+    bool arg_topLevel = cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[5]);
+    return cast<bool>::from(_FuncrttiTickis_same_typeTick12422253018169499925_fdbe8e4829770782(__context__, arg_a, arg_b, arg_refMatters, arg_constMatters, arg_temporaryMatters, arg_topLevel));
+}
+static vec4f __wrap__FuncrttiTickarg_namesTick10966414128355233648_c020dc6e26805aac ( Context * __context__ ) {
+    TypeInfo const  &  arg_info = cast_aot_arg<TypeInfo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((char *)) *) __context__->abiCMRES) = _FuncrttiTickarg_namesTick10966414128355233648_c020dc6e26805aac(__context__, arg_info);
+    return v_zero();
+}
+static vec4f __wrap__FuncrttiTickarg_typesTick414029999383747864_e4299aa10a7435d9 ( Context * __context__ ) {
+    TypeInfo const  &  arg_info = cast_aot_arg<TypeInfo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((TypeInfo &)) *) __context__->abiCMRES) = _FuncrttiTickarg_typesTick414029999383747864_e4299aa10a7435d9(__context__, arg_info);
+    return v_zero();
+}
+static vec4f __wrap_test_c3237cf5310d5b2 ( Context * __context__ ) {
+    return cast<bool>::from(test_c3237cf5310d5b2(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xf426d9532c77b0a4, true, (void*)&_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015, &__wrap__FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 },
+    { 0x24e3a83e4628d46e, false, (void*)&finalize_63349735876529ca, &__wrap_finalize_63349735876529ca },
+    { 0x4d386b9b69fa9f76, false, (void*)&finalize_6391f0c3cba8559a, &__wrap_finalize_6391f0c3cba8559a },
+    { 0xc8b9519c1e900d0c, true, (void*)&_FuncbuiltinTickeachTick9663565701927713696_9ed40335195dc880, &__wrap__FuncbuiltinTickeachTick9663565701927713696_9ed40335195dc880 },
+    { 0x5b9d90cf07c9aad1, true, (void*)&_FuncbuiltinTickeach_refTick16137060296763333387_97926cd17e20a9cf, &__wrap__FuncbuiltinTickeach_refTick16137060296763333387_97926cd17e20a9cf },
+    { 0xaa0363322d9b4278, false, (void*)&_Func_lambda_thismodule_93_1Tickfunction_433f18d6a8385b4b, &__wrap__Func_lambda_thismodule_93_1Tickfunction_433f18d6a8385b4b },
+    { 0xb0808b1e3472e478, false, (void*)&_Func_lambda_thismodule_93_1Tickfinalizer_2de1a8413a3d96bc, &__wrap__Func_lambda_thismodule_93_1Tickfinalizer_2de1a8413a3d96bc },
+    { 0xa361fd06b6c08d55, false, (void*)&_Func_lambda_thismodule_67_2Tickfunction_c9ee6bef8b02e8d1, &__wrap__Func_lambda_thismodule_67_2Tickfunction_c9ee6bef8b02e8d1 },
+    { 0xbe95a459ed0ec61e, false, (void*)&_Func_lambda_thismodule_67_2Tickfinalizer_5986713eee2be0c9, &__wrap__Func_lambda_thismodule_67_2Tickfinalizer_5986713eee2be0c9 },
+    { 0x412148488dede1e6, true, (void*)&_FuncrttiTickarg_names_anyTick16736947398500939560_25677896d3b20a94, &__wrap__FuncrttiTickarg_names_anyTick16736947398500939560_25677896d3b20a94 },
+    { 0x47785c3b7bba5e8d, true, (void*)&_FuncrttiTickarg_types_anyTick14095493126742042784_26eef316f6c70ee6, &__wrap__FuncrttiTickarg_types_anyTick14095493126742042784_26eef316f6c70ee6 },
+    { 0x693e116af4b4a5a0, false, (void*)&_FuncrttiTickis_same_typeTick12422253018169499925_fdbe8e4829770782, &__wrap__FuncrttiTickis_same_typeTick12422253018169499925_fdbe8e4829770782 },
+    { 0xfda7dcba9e29c623, true, (void*)&_FuncrttiTickarg_namesTick10966414128355233648_c020dc6e26805aac, &__wrap__FuncrttiTickarg_namesTick10966414128355233648_c020dc6e26805aac },
+    { 0x9bcc92c48640ba27, true, (void*)&_FuncrttiTickarg_typesTick414029999383747864_e4299aa10a7435d9, &__wrap__FuncrttiTickarg_typesTick414029999383747864_e4299aa10a7435d9 },
+    { 0x7a787bdeec162c24, false, (void*)&test_c3237cf5310d5b2, &__wrap_test_c3237cf5310d5b2 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_7772675775669451218
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,273 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_13138568848296921297 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline TArray<int32_t> * _FuncTicksafe_addrTick10332863857489077091_f26b4d1f14946efc ( Context * __context__, TArray<int32_t> & __a_rename_at_2_2 );
+inline void _FuncbuiltinTickinsertTick12964066441666329206_2882a6217bcc1a60 ( Context * __context__, TTable<char *,int32_t> & __Tab_rename_at_869_3, char * const  __at_rename_at_869_4, int32_t __val_rename_at_869_5 );
+inline int32_t _FuncbuiltinTickget_valueTick6803070933163225147_1fb948942e132956 ( Context * __context__, TTable<char *,int32_t> & __Tab_rename_at_755_6, char * const  __at_rename_at_755_7 );
+inline TTable<char *,int32_t> * _FuncTicksafe_addrTick10332863857489077091_20440f928d7b775f ( Context * __context__, TTable<char *,int32_t> & __a_rename_at_2_8 );
+inline void _FuncbuiltinTickclearTick13739625760977891612_4485c3c006df174e ( Context * __context__, TTable<char *,int32_t> & __t_rename_at_2083_9 );
+inline TDim<int32_t,2> * _FuncTicksafe_addrTick10332863857489077091_1fe2b433248cd954 ( Context * __context__, TDim<int32_t,2> & __a_rename_at_2_10 );
+inline int3 * _FuncTicksafe_addr_valTick3307776439783526649_c9ec9514cbcb8b42 ( Context * __context__, int3 & __a_rename_at_8_11 );
+inline bool test_bd3f25c7be420f51 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline TArray<int32_t> * _FuncTicksafe_addrTick10332863857489077091_f26b4d1f14946efc ( Context * __context__, TArray<int32_t> &  __a_rename_at_2_2 )
+{
+    return das_auto_cast<TArray<int32_t> *>::cast(das_ref(__context__,__a_rename_at_2_2));
+}
+
+inline void _FuncbuiltinTickinsertTick12964066441666329206_2882a6217bcc1a60 ( Context * __context__, TTable<char *,int32_t> &  __Tab_rename_at_869_3, char * const  __at_rename_at_869_4, int32_t __val_rename_at_869_5 )
+{
+    das_copy(__Tab_rename_at_869_3(__at_rename_at_869_4,__context__),__val_rename_at_869_5);
+}
+
+inline int32_t _FuncbuiltinTickget_valueTick6803070933163225147_1fb948942e132956 ( Context * __context__, TTable<char *,int32_t> &  __Tab_rename_at_755_6, char * const  __at_rename_at_755_7 )
+{
+    return das_auto_cast<int32_t>::cast(__Tab_rename_at_755_6(__at_rename_at_755_7,__context__));
+}
+
+inline TTable<char *,int32_t> * _FuncTicksafe_addrTick10332863857489077091_20440f928d7b775f ( Context * __context__, TTable<char *,int32_t> &  __a_rename_at_2_8 )
+{
+    return das_auto_cast<TTable<char *,int32_t> *>::cast(das_ref(__context__,__a_rename_at_2_8));
+}
+
+inline void _FuncbuiltinTickclearTick13739625760977891612_4485c3c006df174e ( Context * __context__, TTable<char *,int32_t> &  __t_rename_at_2083_9 )
+{
+    builtin_table_clear(das_arg<TTable<char *,int32_t>>::pass(__t_rename_at_2083_9),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline TDim<int32_t,2> * _FuncTicksafe_addrTick10332863857489077091_1fe2b433248cd954 ( Context * __context__, TDim<int32_t,2> &  __a_rename_at_2_10 )
+{
+    return das_auto_cast<TDim<int32_t,2> *>::cast(das_ref(__context__,__a_rename_at_2_10));
+}
+
+inline int3 * _FuncTicksafe_addr_valTick3307776439783526649_c9ec9514cbcb8b42 ( Context * __context__, int3 & __a_rename_at_8_11 )
+{
+    return das_auto_cast<int3 *>::cast(das_ref(__context__,__a_rename_at_8_11));
+}
+
+inline bool test_bd3f25c7be420f51 ( Context * __context__ )
+{
+    TArray<int32_t> __ar_rename_at_17_12;das_zero(__ar_rename_at_17_12);
+    int32_t __dummy_rename_at_18_13 = 0;
+    das_copy(das_null_coalescing<int32_t &>::get(TArray<int32_t>::safe_index(&(__ar_rename_at_17_12),0,__context__),__dummy_rename_at_18_13),1);
+    DAS_ASSERT((__dummy_rename_at_18_13 == 1));
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__ar_rename_at_17_12),1);
+    das_copy(das_null_coalescing<int32_t &>::get(TArray<int32_t>::safe_index(&(__ar_rename_at_17_12),0,__context__),__dummy_rename_at_18_13),2);
+    DAS_ASSERT(((builtin_array_size(das_arg<TArray<int32_t>>::pass(__ar_rename_at_17_12)) == 1) && (__ar_rename_at_17_12(0,__context__) == 2)));
+    DAS_ASSERT((__dummy_rename_at_18_13 == 1));
+    TArray<int32_t> * __par_rename_at_26_14 = _FuncTicksafe_addrTick10332863857489077091_f26b4d1f14946efc(__context__,das_arg<TArray<int32_t>>::pass(__ar_rename_at_17_12));
+    builtin_array_clear(das_arg<TArray<int32_t>>::pass(__ar_rename_at_17_12),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    das_copy(__dummy_rename_at_18_13,0);
+    das_copy(das_null_coalescing<int32_t &>::get(TArray<int32_t>::safe_index((__par_rename_at_26_14),0,__context__),__dummy_rename_at_18_13),1);
+    DAS_ASSERT((__dummy_rename_at_18_13 == 1));
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__ar_rename_at_17_12),1);
+    das_copy(das_null_coalescing<int32_t &>::get(TArray<int32_t>::safe_index((__par_rename_at_26_14),0,__context__),__dummy_rename_at_18_13),2);
+    DAS_ASSERT(((builtin_array_size(das_arg<TArray<int32_t>>::pass(__ar_rename_at_17_12)) == 1) && (__ar_rename_at_17_12(0,__context__) == 2)));
+    DAS_ASSERT((__dummy_rename_at_18_13 == 1));
+    das_copy(__par_rename_at_26_14,nullptr);
+    das_copy(das_null_coalescing<int32_t &>::get(TArray<int32_t>::safe_index((__par_rename_at_26_14),0,__context__),__dummy_rename_at_18_13),3);
+    DAS_ASSERT((__dummy_rename_at_18_13 == 3));
+    TTable<char *,int32_t> __ta_rename_at_39_15;das_zero(__ta_rename_at_39_15);
+    das_copy(__dummy_rename_at_18_13,0);
+    das_copy(das_null_coalescing<int32_t &>::get(TTable<char *,int32_t>::safe_index(&(__ta_rename_at_39_15),((char *) "one"),__context__),__dummy_rename_at_18_13),1);
+    DAS_ASSERT((__dummy_rename_at_18_13 == 1));
+    _FuncbuiltinTickinsertTick12964066441666329206_2882a6217bcc1a60(__context__,das_arg<TTable<char *,int32_t>>::pass(__ta_rename_at_39_15),((char *) "one"),0);
+    das_copy(das_null_coalescing<int32_t &>::get(TTable<char *,int32_t>::safe_index(&(__ta_rename_at_39_15),((char *) "one"),__context__),__dummy_rename_at_18_13),2);
+    DAS_VERIFY(((builtin_table_size(das_arg<TTable<char *,int32_t>>::pass(__ta_rename_at_39_15)) == 1) && (_FuncbuiltinTickget_valueTick6803070933163225147_1fb948942e132956(__context__,das_arg<TTable<char *,int32_t>>::pass(__ta_rename_at_39_15),((char *) "one")) == 2)));
+    DAS_ASSERT((__dummy_rename_at_18_13 == 1));
+    TTable<char *,int32_t> * __pta_rename_at_48_16 = _FuncTicksafe_addrTick10332863857489077091_20440f928d7b775f(__context__,das_arg<TTable<char *,int32_t>>::pass(__ta_rename_at_39_15));
+    _FuncbuiltinTickclearTick13739625760977891612_4485c3c006df174e(__context__,das_arg<TTable<char *,int32_t>>::pass(__ta_rename_at_39_15));
+    das_copy(__dummy_rename_at_18_13,0);
+    das_copy(das_null_coalescing<int32_t &>::get(TTable<char *,int32_t>::safe_index((__pta_rename_at_48_16),((char *) "one"),__context__),__dummy_rename_at_18_13),1);
+    DAS_ASSERT((__dummy_rename_at_18_13 == 1));
+    DAS_ASSERT((builtin_table_size(das_arg<TTable<char *,int32_t>>::pass(__ta_rename_at_39_15)) == 0));
+    _FuncbuiltinTickinsertTick12964066441666329206_2882a6217bcc1a60(__context__,das_arg<TTable<char *,int32_t>>::pass(__ta_rename_at_39_15),((char *) "one"),1);
+    das_copy(das_null_coalescing<int32_t &>::get(TTable<char *,int32_t>::safe_index((__pta_rename_at_48_16),((char *) "one"),__context__),__dummy_rename_at_18_13),2);
+    DAS_VERIFY(((builtin_table_size(das_arg<TTable<char *,int32_t>>::pass(__ta_rename_at_39_15)) == 1) && (_FuncbuiltinTickget_valueTick6803070933163225147_1fb948942e132956(__context__,das_arg<TTable<char *,int32_t>>::pass(__ta_rename_at_39_15),((char *) "one")) == 2)));
+    DAS_ASSERT((__dummy_rename_at_18_13 == 1));
+    das_copy(__pta_rename_at_48_16,nullptr);
+    das_copy(das_null_coalescing<int32_t &>::get(TTable<char *,int32_t>::safe_index((__pta_rename_at_48_16),((char *) "one"),__context__),__dummy_rename_at_18_13),3);
+    DAS_ASSERT((__dummy_rename_at_18_13 == 3));
+    TDim<int32_t,2> __di_rename_at_62_17;das_zero(__di_rename_at_62_17);
+    das_copy(__dummy_rename_at_18_13,0);
+    das_copy(das_null_coalescing<int32_t &>::get(TDim<int32_t,2>::safe_index(&(__di_rename_at_62_17),3,__context__),__dummy_rename_at_18_13),1);
+    DAS_ASSERT((__dummy_rename_at_18_13 == 1));
+    das_copy(das_null_coalescing<int32_t &>::get(TDim<int32_t,2>::safe_index(&(__di_rename_at_62_17),0,__context__),__dummy_rename_at_18_13),2);
+    DAS_ASSERT((__di_rename_at_62_17(0,__context__) == 2));
+    DAS_ASSERT((__dummy_rename_at_18_13 == 1));
+    TDim<int32_t,2> * __pdi_rename_at_70_18 = _FuncTicksafe_addrTick10332863857489077091_1fe2b433248cd954(__context__,das_arg<TDim<int32_t,2>>::pass(__di_rename_at_62_17));
+    das_copy(__dummy_rename_at_18_13,0);
+    das_copy(das_null_coalescing<int32_t &>::get(TDim<int32_t,2>::safe_index((__pdi_rename_at_70_18),3,__context__),__dummy_rename_at_18_13),1);
+    DAS_ASSERT((__dummy_rename_at_18_13 == 1));
+    das_copy(__di_rename_at_62_17(0,__context__),0);
+    das_copy(das_null_coalescing<int32_t &>::get(TDim<int32_t,2>::safe_index((__pdi_rename_at_70_18),0,__context__),__dummy_rename_at_18_13),2);
+    DAS_ASSERT((__di_rename_at_62_17(0,__context__) == 2));
+    DAS_ASSERT((__dummy_rename_at_18_13 == 1));
+    das_copy(__pdi_rename_at_70_18,nullptr);
+    das_copy(das_null_coalescing<int32_t &>::get(TDim<int32_t,2>::safe_index((__pdi_rename_at_70_18),0,__context__),__dummy_rename_at_18_13),3);
+    DAS_ASSERT((__dummy_rename_at_18_13 == 3));
+    int3 __vec_rename_at_82_19 = int3(1,2,3);
+    das_copy(__dummy_rename_at_18_13,0);
+    das_copy(das_null_coalescing<int32_t &>::get(das_index<int3>::safe_at(&(__vec_rename_at_82_19),3,__context__),__dummy_rename_at_18_13),1);
+    DAS_ASSERT((__dummy_rename_at_18_13 == 1));
+    das_copy(das_null_coalescing<int32_t &>::get(das_index<int3>::safe_at(&(__vec_rename_at_82_19),0,__context__),__dummy_rename_at_18_13),2);
+    DAS_ASSERT((das_index<int3>::at(__vec_rename_at_82_19,0,__context__) == 2));
+    DAS_ASSERT((__dummy_rename_at_18_13 == 1));
+    int3 * __pvec_rename_at_90_20 = _FuncTicksafe_addr_valTick3307776439783526649_c9ec9514cbcb8b42(__context__,__vec_rename_at_82_19);
+    das_copy(__dummy_rename_at_18_13,0);
+    das_copy(das_null_coalescing<int32_t &>::get(das_index<int3>::safe_at((__pvec_rename_at_90_20),3,__context__),__dummy_rename_at_18_13),1);
+    DAS_ASSERT((__dummy_rename_at_18_13 == 1));
+    das_copy(das_index<int3>::at(__vec_rename_at_82_19,0,__context__),0);
+    das_copy(das_null_coalescing<int32_t &>::get(das_index<int3>::safe_at((__pvec_rename_at_90_20),0,__context__),__dummy_rename_at_18_13),2);
+    DAS_ASSERT((das_index<int3>::at(__vec_rename_at_82_19,0,__context__) == 2));
+    DAS_ASSERT((__dummy_rename_at_18_13 == 1));
+    das_copy(__pvec_rename_at_90_20,nullptr);
+    das_copy(das_null_coalescing<int32_t &>::get(das_index<int3>::safe_at((__pvec_rename_at_90_20),0,__context__),__dummy_rename_at_18_13),3);
+    DAS_ASSERT((__dummy_rename_at_18_13 == 3));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicksafe_addrTick10332863857489077091_f26b4d1f14946efc ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<TArray<int32_t> *>::from(_FuncTicksafe_addrTick10332863857489077091_f26b4d1f14946efc(__context__, arg_a));
+}
+static vec4f __wrap__FuncbuiltinTickinsertTick12964066441666329206_2882a6217bcc1a60 ( Context * __context__ ) {
+    TTable<char *,int32_t> &  arg_Tab = cast_aot_arg<TTable<char *,int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_at = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_val = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    _FuncbuiltinTickinsertTick12964066441666329206_2882a6217bcc1a60(__context__, arg_Tab, arg_at, arg_val);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickget_valueTick6803070933163225147_1fb948942e132956 ( Context * __context__ ) {
+    TTable<char *,int32_t> &  arg_Tab = cast_aot_arg<TTable<char *,int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_at = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t>::from(_FuncbuiltinTickget_valueTick6803070933163225147_1fb948942e132956(__context__, arg_Tab, arg_at));
+}
+static vec4f __wrap__FuncTicksafe_addrTick10332863857489077091_20440f928d7b775f ( Context * __context__ ) {
+    TTable<char *,int32_t> &  arg_a = cast_aot_arg<TTable<char *,int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<TTable<char *,int32_t> *>::from(_FuncTicksafe_addrTick10332863857489077091_20440f928d7b775f(__context__, arg_a));
+}
+static vec4f __wrap__FuncbuiltinTickclearTick13739625760977891612_4485c3c006df174e ( Context * __context__ ) {
+    TTable<char *,int32_t> &  arg_t = cast_aot_arg<TTable<char *,int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickclearTick13739625760977891612_4485c3c006df174e(__context__, arg_t);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicksafe_addrTick10332863857489077091_1fe2b433248cd954 ( Context * __context__ ) {
+    TDim<int32_t,2> &  arg_a = cast_aot_arg<TDim<int32_t,2> & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<TDim<int32_t,2> *>::from(_FuncTicksafe_addrTick10332863857489077091_1fe2b433248cd954(__context__, arg_a));
+}
+static vec4f __wrap__FuncTicksafe_addr_valTick3307776439783526649_c9ec9514cbcb8b42 ( Context * __context__ ) {
+    int3 & arg_a = cast_aot_arg<int3 &>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int3 *>::from(_FuncTicksafe_addr_valTick3307776439783526649_c9ec9514cbcb8b42(__context__, arg_a));
+}
+static vec4f __wrap_test_bd3f25c7be420f51 ( Context * __context__ ) {
+    return cast<bool>::from(test_bd3f25c7be420f51(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xa51a880d594e91fd, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c },
+    { 0xf2b99c27aacd71d4, false, (void*)&_FuncTicksafe_addrTick10332863857489077091_f26b4d1f14946efc, &__wrap__FuncTicksafe_addrTick10332863857489077091_f26b4d1f14946efc },
+    { 0xfd925afa569cfe89, false, (void*)&_FuncbuiltinTickinsertTick12964066441666329206_2882a6217bcc1a60, &__wrap__FuncbuiltinTickinsertTick12964066441666329206_2882a6217bcc1a60 },
+    { 0xe57e9e246bc443e6, false, (void*)&_FuncbuiltinTickget_valueTick6803070933163225147_1fb948942e132956, &__wrap__FuncbuiltinTickget_valueTick6803070933163225147_1fb948942e132956 },
+    { 0xc5b4e19052aa3f12, false, (void*)&_FuncTicksafe_addrTick10332863857489077091_20440f928d7b775f, &__wrap__FuncTicksafe_addrTick10332863857489077091_20440f928d7b775f },
+    { 0x5206590b7bfea7a0, false, (void*)&_FuncbuiltinTickclearTick13739625760977891612_4485c3c006df174e, &__wrap__FuncbuiltinTickclearTick13739625760977891612_4485c3c006df174e },
+    { 0x1798811e8df5651b, false, (void*)&_FuncTicksafe_addrTick10332863857489077091_1fe2b433248cd954, &__wrap__FuncTicksafe_addrTick10332863857489077091_1fe2b433248cd954 },
+    { 0xf5d60bbcfd49468e, false, (void*)&_FuncTicksafe_addr_valTick3307776439783526649_c9ec9514cbcb8b42, &__wrap__FuncTicksafe_addr_valTick3307776439783526649_c9ec9514cbcb8b42 },
+    { 0x5fc8fd6ea9dfdafe, false, (void*)&test_bd3f25c7be420f51, &__wrap_test_bd3f25c7be420f51 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_13138568848296921297
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,547 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require raster
+#include "daScript/simulate/aot_builtin_raster.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_18276611618462022696 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_bfe79bb39aa617c ( Context * __context__, TDim<int32_t,10> & __a_rename_at_1502_0 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_68_2, int32_t __newSize_rename_at_68_3 );
+inline TArray<uint32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_7d3b107365e47705 ( Context * __context__, TDim<uint32_t,10> & __a_rename_at_1502_4 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_fe200b84d41b4211 ( Context * __context__, TArray<uint32_t> & __Arr_rename_at_68_6, int32_t __newSize_rename_at_68_7 );
+inline TArray<float> _FuncbuiltinTickto_array_moveTick3185538323411982277_51a3d02b5053d2d0 ( Context * __context__, TDim<float,10> & __a_rename_at_1502_8 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_e3c7d561173b49d9 ( Context * __context__, TArray<float> & __Arr_rename_at_68_10, int32_t __newSize_rename_at_68_11 );
+inline void test_gather_scatter_12691e448bc1539b ( Context * __context__ );
+inline void test_gather_d3b499a9ddcb9a61 ( Context * __context__ );
+inline void test_scatter_2589353a6628b906 ( Context * __context__ );
+inline void test_scatter_mask_dfc65dbb39a234ac ( Context * __context__ );
+inline void test_store_mask_253e9cfad113a3b8 ( Context * __context__ );
+inline void test_gather_scatter_mask_35240e2048796c2d ( Context * __context__ );
+inline void test_gather_store_mask_2b8e7fb33f67b7cb ( Context * __context__ );
+inline void test_gather_store_stride_f21633b69aa4422e ( Context * __context__ );
+inline bool test_369a30bf8722ddea ( Context * __context__ );
+inline void main_9599ef1e98490084 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_bfe79bb39aa617c ( Context * __context__, TDim<int32_t,10> &  __a_rename_at_1502_0 )
+{
+    TArray<int32_t> __arr_rename_at_1504_1;das_zero(__arr_rename_at_1504_1);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_1),10);
+    das_copy(das_cast<TDim<int32_t,10>>::cast(das_ref(__context__,__arr_rename_at_1504_1(0,__context__))),__a_rename_at_1502_0);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_1);
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_68_2, int32_t __newSize_rename_at_68_3 )
+{
+    builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_68_2),__newSize_rename_at_68_3,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline TArray<uint32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_7d3b107365e47705 ( Context * __context__, TDim<uint32_t,10> &  __a_rename_at_1502_4 )
+{
+    TArray<uint32_t> __arr_rename_at_1504_5;das_zero(__arr_rename_at_1504_5);
+    _FuncbuiltinTickresizeTick4811697762258667383_fe200b84d41b4211(__context__,das_arg<TArray<uint32_t>>::pass(__arr_rename_at_1504_5),10);
+    das_copy(das_cast<TDim<uint32_t,10>>::cast(das_ref(__context__,__arr_rename_at_1504_5(0,__context__))),__a_rename_at_1502_4);
+    return /* <- */ das_auto_cast_move<TArray<uint32_t>>::cast(__arr_rename_at_1504_5);
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_fe200b84d41b4211 ( Context * __context__, TArray<uint32_t> &  __Arr_rename_at_68_6, int32_t __newSize_rename_at_68_7 )
+{
+    builtin_array_resize(das_arg<TArray<uint32_t>>::pass(__Arr_rename_at_68_6),__newSize_rename_at_68_7,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline TArray<float> _FuncbuiltinTickto_array_moveTick3185538323411982277_51a3d02b5053d2d0 ( Context * __context__, TDim<float,10> &  __a_rename_at_1502_8 )
+{
+    TArray<float> __arr_rename_at_1504_9;das_zero(__arr_rename_at_1504_9);
+    _FuncbuiltinTickresizeTick4811697762258667383_e3c7d561173b49d9(__context__,das_arg<TArray<float>>::pass(__arr_rename_at_1504_9),10);
+    das_copy(das_cast<TDim<float,10>>::cast(das_ref(__context__,__arr_rename_at_1504_9(0,__context__))),__a_rename_at_1502_8);
+    return /* <- */ das_auto_cast_move<TArray<float>>::cast(__arr_rename_at_1504_9);
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_e3c7d561173b49d9 ( Context * __context__, TArray<float> &  __Arr_rename_at_68_10, int32_t __newSize_rename_at_68_11 )
+{
+    builtin_array_resize(das_arg<TArray<float>>::pass(__Arr_rename_at_68_10),__newSize_rename_at_68_11,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void test_gather_scatter_12691e448bc1539b ( Context * __context__ )
+{
+    TDim<int32_t,10> _temp_make_local_11_19_0; _temp_make_local_11_19_0;
+    TDim<uint32_t,10> _temp_make_local_16_20_1; _temp_make_local_16_20_1;
+    TDim<float,10> _temp_make_local_21_20_2; _temp_make_local_21_20_2;
+    TArray<int32_t> __arr_rename_at_11_12; das_zero(__arr_rename_at_11_12); das_move(__arr_rename_at_11_12, _FuncbuiltinTickto_array_moveTick3185538323411982277_bfe79bb39aa617c(__context__,das_arg<TDim<int32_t,10>>::pass((([&]() -> TDim<int32_t,10>& {
+        _temp_make_local_11_19_0(0,__context__) = 10;
+        _temp_make_local_11_19_0(1,__context__) = 11;
+        _temp_make_local_11_19_0(2,__context__) = 12;
+        _temp_make_local_11_19_0(3,__context__) = 13;
+        _temp_make_local_11_19_0(4,__context__) = 14;
+        _temp_make_local_11_19_0(5,__context__) = 15;
+        _temp_make_local_11_19_0(6,__context__) = 16;
+        _temp_make_local_11_19_0(7,__context__) = 17;
+        _temp_make_local_11_19_0(8,__context__) = 18;
+        _temp_make_local_11_19_0(9,__context__) = 19;
+        return _temp_make_local_11_19_0;
+    })()))));
+    TArray<int32_t> __rarr_rename_at_12_13;das_zero(__rarr_rename_at_12_13);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__rarr_rename_at_12_13),10);
+    v_gather_scatter(das_ref(__context__,__rarr_rename_at_12_13(0,__context__)),uint4(0,2,6,7),das_reinterpret<int32_t const  * const >::pass(das_ref(__context__,__arr_rename_at_11_12(0,__context__))),uint4(1,3,7,8));
+    DAS_ASSERT(((((__rarr_rename_at_12_13(0,__context__) == 11) && (__rarr_rename_at_12_13(2,__context__) == 13)) && (__rarr_rename_at_12_13(6,__context__) == 17)) && (__rarr_rename_at_12_13(7,__context__) == 18)));
+    TArray<uint32_t> __arru_rename_at_16_14; das_zero(__arru_rename_at_16_14); das_move(__arru_rename_at_16_14, _FuncbuiltinTickto_array_moveTick3185538323411982277_7d3b107365e47705(__context__,das_arg<TDim<uint32_t,10>>::pass((([&]() -> TDim<uint32_t,10>& {
+        _temp_make_local_16_20_1(0,__context__) = 0xau;
+        _temp_make_local_16_20_1(1,__context__) = 0xbu;
+        _temp_make_local_16_20_1(2,__context__) = 0xcu;
+        _temp_make_local_16_20_1(3,__context__) = 0xdu;
+        _temp_make_local_16_20_1(4,__context__) = 0xeu;
+        _temp_make_local_16_20_1(5,__context__) = 0xfu;
+        _temp_make_local_16_20_1(6,__context__) = 0x10u;
+        _temp_make_local_16_20_1(7,__context__) = 0x11u;
+        _temp_make_local_16_20_1(8,__context__) = 0x12u;
+        _temp_make_local_16_20_1(9,__context__) = 0x13u;
+        return _temp_make_local_16_20_1;
+    })()))));
+    TArray<uint32_t> __rarru_rename_at_17_15;das_zero(__rarru_rename_at_17_15);
+    _FuncbuiltinTickresizeTick4811697762258667383_fe200b84d41b4211(__context__,das_arg<TArray<uint32_t>>::pass(__rarru_rename_at_17_15),10);
+    v_gather_scatter(das_ref(__context__,__rarru_rename_at_17_15(0,__context__)),uint4(0,2,6,7),das_reinterpret<uint32_t const  * const >::pass(das_ref(__context__,__arru_rename_at_16_14(0,__context__))),uint4(1,3,7,8));
+    DAS_ASSERT(((((__rarru_rename_at_17_15(0,__context__) == 0xbu) && (__rarru_rename_at_17_15(2,__context__) == 0xdu)) && (__rarru_rename_at_17_15(6,__context__) == 0x11u)) && (__rarru_rename_at_17_15(7,__context__) == 0x12u)));
+    TArray<float> __arrf_rename_at_21_16; das_zero(__arrf_rename_at_21_16); das_move(__arrf_rename_at_21_16, _FuncbuiltinTickto_array_moveTick3185538323411982277_51a3d02b5053d2d0(__context__,das_arg<TDim<float,10>>::pass((([&]() -> TDim<float,10>& {
+        _temp_make_local_21_20_2(0,__context__) = 1.000000e+01f;
+        _temp_make_local_21_20_2(1,__context__) = 1.100000e+01f;
+        _temp_make_local_21_20_2(2,__context__) = 1.200000e+01f;
+        _temp_make_local_21_20_2(3,__context__) = 1.300000e+01f;
+        _temp_make_local_21_20_2(4,__context__) = 1.400000e+01f;
+        _temp_make_local_21_20_2(5,__context__) = 1.500000e+01f;
+        _temp_make_local_21_20_2(6,__context__) = 1.600000e+01f;
+        _temp_make_local_21_20_2(7,__context__) = 1.700000e+01f;
+        _temp_make_local_21_20_2(8,__context__) = 1.800000e+01f;
+        _temp_make_local_21_20_2(9,__context__) = 1.900000e+01f;
+        return _temp_make_local_21_20_2;
+    })()))));
+    TArray<float> __rarrf_rename_at_22_17;das_zero(__rarrf_rename_at_22_17);
+    _FuncbuiltinTickresizeTick4811697762258667383_e3c7d561173b49d9(__context__,das_arg<TArray<float>>::pass(__rarrf_rename_at_22_17),10);
+    v_gather_scatter(das_ref(__context__,__rarrf_rename_at_22_17(0,__context__)),uint4(0,2,6,7),das_reinterpret<float const  * const >::pass(das_ref(__context__,__arrf_rename_at_21_16(0,__context__))),uint4(1,3,7,8));
+    DAS_ASSERT(((((__rarrf_rename_at_22_17(0,__context__) == 1.100000e+01f) && (__rarrf_rename_at_22_17(2,__context__) == 1.300000e+01f)) && (__rarrf_rename_at_22_17(6,__context__) == 1.700000e+01f)) && (__rarrf_rename_at_22_17(7,__context__) == 1.800000e+01f)));
+}
+
+inline void test_gather_d3b499a9ddcb9a61 ( Context * __context__ )
+{
+    TDim<int32_t,10> _temp_make_local_33_19_3; _temp_make_local_33_19_3;
+    TDim<uint32_t,10> _temp_make_local_37_20_4; _temp_make_local_37_20_4;
+    TDim<float,10> _temp_make_local_41_20_5; _temp_make_local_41_20_5;
+    TArray<int32_t> __arr_rename_at_33_18; das_zero(__arr_rename_at_33_18); das_move(__arr_rename_at_33_18, _FuncbuiltinTickto_array_moveTick3185538323411982277_bfe79bb39aa617c(__context__,das_arg<TDim<int32_t,10>>::pass((([&]() -> TDim<int32_t,10>& {
+        _temp_make_local_33_19_3(0,__context__) = 10;
+        _temp_make_local_33_19_3(1,__context__) = 11;
+        _temp_make_local_33_19_3(2,__context__) = 12;
+        _temp_make_local_33_19_3(3,__context__) = 13;
+        _temp_make_local_33_19_3(4,__context__) = 14;
+        _temp_make_local_33_19_3(5,__context__) = 15;
+        _temp_make_local_33_19_3(6,__context__) = 16;
+        _temp_make_local_33_19_3(7,__context__) = 17;
+        _temp_make_local_33_19_3(8,__context__) = 18;
+        _temp_make_local_33_19_3(9,__context__) = 19;
+        return _temp_make_local_33_19_3;
+    })()))));
+    int4 __res_i4_rename_at_34_19 = ((int4)v_gather(das_reinterpret<int32_t const  * const >::pass(das_ref(__context__,__arr_rename_at_33_18(0,__context__))),uint4(1,3,7,8)));
+    DAS_ASSERT((SimPolicy<int4>::Equ(int4(11,13,17,18),__res_i4_rename_at_34_19,*__context__,nullptr)));
+    TArray<uint32_t> __arru_rename_at_37_20; das_zero(__arru_rename_at_37_20); das_move(__arru_rename_at_37_20, _FuncbuiltinTickto_array_moveTick3185538323411982277_7d3b107365e47705(__context__,das_arg<TDim<uint32_t,10>>::pass((([&]() -> TDim<uint32_t,10>& {
+        _temp_make_local_37_20_4(0,__context__) = 0xau;
+        _temp_make_local_37_20_4(1,__context__) = 0xbu;
+        _temp_make_local_37_20_4(2,__context__) = 0xcu;
+        _temp_make_local_37_20_4(3,__context__) = 0xdu;
+        _temp_make_local_37_20_4(4,__context__) = 0xeu;
+        _temp_make_local_37_20_4(5,__context__) = 0xfu;
+        _temp_make_local_37_20_4(6,__context__) = 0x10u;
+        _temp_make_local_37_20_4(7,__context__) = 0x11u;
+        _temp_make_local_37_20_4(8,__context__) = 0x12u;
+        _temp_make_local_37_20_4(9,__context__) = 0x13u;
+        return _temp_make_local_37_20_4;
+    })()))));
+    uint4 __res_u4_rename_at_38_21 = ((uint4)v_gather(das_reinterpret<uint32_t const  * const >::pass(das_ref(__context__,__arru_rename_at_37_20(0,__context__))),uint4(1,3,7,8)));
+    DAS_ASSERT((SimPolicy<uint4>::Equ(uint4(11,13,17,18),__res_u4_rename_at_38_21,*__context__,nullptr)));
+    TArray<float> __arrf_rename_at_41_22; das_zero(__arrf_rename_at_41_22); das_move(__arrf_rename_at_41_22, _FuncbuiltinTickto_array_moveTick3185538323411982277_51a3d02b5053d2d0(__context__,das_arg<TDim<float,10>>::pass((([&]() -> TDim<float,10>& {
+        _temp_make_local_41_20_5(0,__context__) = 1.000000e+01f;
+        _temp_make_local_41_20_5(1,__context__) = 1.100000e+01f;
+        _temp_make_local_41_20_5(2,__context__) = 1.200000e+01f;
+        _temp_make_local_41_20_5(3,__context__) = 1.300000e+01f;
+        _temp_make_local_41_20_5(4,__context__) = 1.400000e+01f;
+        _temp_make_local_41_20_5(5,__context__) = 1.500000e+01f;
+        _temp_make_local_41_20_5(6,__context__) = 1.600000e+01f;
+        _temp_make_local_41_20_5(7,__context__) = 1.700000e+01f;
+        _temp_make_local_41_20_5(8,__context__) = 1.800000e+01f;
+        _temp_make_local_41_20_5(9,__context__) = 1.900000e+01f;
+        return _temp_make_local_41_20_5;
+    })()))));
+    float4 __res_f4_rename_at_42_23 = ((float4)v_gather(das_reinterpret<float const  * const >::pass(das_ref(__context__,__arrf_rename_at_41_22(0,__context__))),uint4(1,3,7,8)));
+    DAS_ASSERT((SimPolicy<float4>::Equ(v_make_vec4f(1.100000e+01f,1.300000e+01f,1.700000e+01f,1.800000e+01f),__res_f4_rename_at_42_23,*__context__,nullptr)));
+}
+
+inline void test_scatter_2589353a6628b906 ( Context * __context__ )
+{
+    TArray<int32_t> __arr_rename_at_52_24;das_zero(__arr_rename_at_52_24);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_52_24),10);
+    v_scatter(das_ref(__context__,__arr_rename_at_52_24(0,__context__)),uint4(1,3,7,8),int4(11,13,17,18));
+    DAS_ASSERT(((((__arr_rename_at_52_24(1,__context__) == 11) && (__arr_rename_at_52_24(3,__context__) == 13)) && (__arr_rename_at_52_24(7,__context__) == 17)) && (__arr_rename_at_52_24(8,__context__) == 18)));
+    TArray<uint32_t> __arru_rename_at_56_25;das_zero(__arru_rename_at_56_25);
+    _FuncbuiltinTickresizeTick4811697762258667383_fe200b84d41b4211(__context__,das_arg<TArray<uint32_t>>::pass(__arru_rename_at_56_25),10);
+    v_scatter(das_ref(__context__,__arru_rename_at_56_25(0,__context__)),uint4(1,3,7,8),uint4(11,13,17,18));
+    DAS_ASSERT(((((__arru_rename_at_56_25(1,__context__) == 0xbu) && (__arru_rename_at_56_25(3,__context__) == 0xdu)) && (__arru_rename_at_56_25(7,__context__) == 0x11u)) && (__arru_rename_at_56_25(8,__context__) == 0x12u)));
+    TArray<float> __arrf_rename_at_60_26;das_zero(__arrf_rename_at_60_26);
+    _FuncbuiltinTickresizeTick4811697762258667383_e3c7d561173b49d9(__context__,das_arg<TArray<float>>::pass(__arrf_rename_at_60_26),10);
+    v_scatter(das_ref(__context__,__arrf_rename_at_60_26(0,__context__)),uint4(1,3,7,8),v_make_vec4f(1.100000e+01f,1.300000e+01f,1.700000e+01f,1.800000e+01f));
+    DAS_ASSERT(((((__arrf_rename_at_60_26(1,__context__) == 1.100000e+01f) && (__arrf_rename_at_60_26(3,__context__) == 1.300000e+01f)) && (__arrf_rename_at_60_26(7,__context__) == 1.700000e+01f)) && (__arrf_rename_at_60_26(8,__context__) == 1.800000e+01f)));
+}
+
+inline void test_scatter_mask_dfc65dbb39a234ac ( Context * __context__ )
+{
+    TArray<int32_t> __arr_rename_at_72_27;das_zero(__arr_rename_at_72_27);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_72_27),10);
+    v_scatter_mask(das_ref(__context__,__arr_rename_at_72_27(0,__context__)),uint4(1,3,7,8),int4(11,13,17,18),int4(1,13,2,3));
+    DAS_ASSERT(((((__arr_rename_at_72_27(1,__context__) == 11) && (__arr_rename_at_72_27(3,__context__) == 0)) && (__arr_rename_at_72_27(7,__context__) == 17)) && (__arr_rename_at_72_27(8,__context__) == 18)));
+    TArray<uint32_t> __arru_rename_at_76_28;das_zero(__arru_rename_at_76_28);
+    _FuncbuiltinTickresizeTick4811697762258667383_fe200b84d41b4211(__context__,das_arg<TArray<uint32_t>>::pass(__arru_rename_at_76_28),10);
+    v_scatter_mask(das_ref(__context__,__arru_rename_at_76_28(0,__context__)),uint4(1,3,7,8),uint4(11,13,17,18),uint4(1,3,17,3));
+    DAS_ASSERT(((((__arru_rename_at_76_28(1,__context__) == 0xbu) && (__arru_rename_at_76_28(3,__context__) == 0xdu)) && (__arru_rename_at_76_28(7,__context__) == 0x0u)) && (__arru_rename_at_76_28(8,__context__) == 0x12u)));
+    TArray<float> __arrf_rename_at_80_29;das_zero(__arrf_rename_at_80_29);
+    _FuncbuiltinTickresizeTick4811697762258667383_e3c7d561173b49d9(__context__,das_arg<TArray<float>>::pass(__arrf_rename_at_80_29),10);
+    v_scatter_mask(das_ref(__context__,__arrf_rename_at_80_29(0,__context__)),uint4(1,3,7,8),v_make_vec4f(1.100000e+01f,1.300000e+01f,1.700000e+01f,1.800000e+01f),v_make_vec4f(1.100000e+01f,1.000000e+00f,2.000000e+00f,1.800000e+01f));
+    DAS_ASSERT(((((__arrf_rename_at_80_29(1,__context__) == 0.000000e+00f) && (__arrf_rename_at_80_29(3,__context__) == 1.300000e+01f)) && (__arrf_rename_at_80_29(7,__context__) == 1.700000e+01f)) && (__arrf_rename_at_80_29(8,__context__) == 0.000000e+00f)));
+}
+
+inline void test_store_mask_253e9cfad113a3b8 ( Context * __context__ )
+{
+    int4 __res_rename_at_90_30 = int4(-1,-2,-3,-4);
+    v_store_mask(das_ref(__context__,__res_rename_at_90_30),int4(11,13,17,18),int4(1,13,2,3));
+    DAS_ASSERT((SimPolicy<int4>::Equ(int4(11,-2,17,18),__res_rename_at_90_30,*__context__,nullptr)));
+    uint4 __resu_rename_at_94_31 = uint4(1,2,3,4);
+    v_store_mask(das_ref(__context__,__resu_rename_at_94_31),uint4(11,13,17,18),uint4(1,3,17,3));
+    DAS_ASSERT((SimPolicy<uint4>::Equ(uint4(11,13,3,18),__resu_rename_at_94_31,*__context__,nullptr)));
+    float4 __resf_rename_at_98_32 = v_make_vec4f(1.000000e+00f,2.000000e+00f,3.000000e+00f,4.000000e+00f);
+    v_store_mask(das_ref(__context__,__resf_rename_at_98_32),v_make_vec4f(1.100000e+01f,1.300000e+01f,1.700000e+01f,1.800000e+01f),v_make_vec4f(1.100000e+01f,1.000000e+00f,2.000000e+00f,1.800000e+01f));
+    DAS_ASSERT((SimPolicy<float4>::Equ(v_make_vec4f(1.000000e+00f,1.300000e+01f,1.700000e+01f,4.000000e+00f),__resf_rename_at_98_32,*__context__,nullptr)));
+}
+
+inline void test_gather_scatter_mask_35240e2048796c2d ( Context * __context__ )
+{
+    TDim<int32_t,10> _temp_make_local_110_19_6; _temp_make_local_110_19_6;
+    TDim<uint32_t,10> _temp_make_local_115_20_7; _temp_make_local_115_20_7;
+    TDim<float,10> _temp_make_local_120_20_8; _temp_make_local_120_20_8;
+    TArray<int32_t> __arr_rename_at_110_33; das_zero(__arr_rename_at_110_33); das_move(__arr_rename_at_110_33, _FuncbuiltinTickto_array_moveTick3185538323411982277_bfe79bb39aa617c(__context__,das_arg<TDim<int32_t,10>>::pass((([&]() -> TDim<int32_t,10>& {
+        _temp_make_local_110_19_6(0,__context__) = 10;
+        _temp_make_local_110_19_6(1,__context__) = 11;
+        _temp_make_local_110_19_6(2,__context__) = 12;
+        _temp_make_local_110_19_6(3,__context__) = 13;
+        _temp_make_local_110_19_6(4,__context__) = 14;
+        _temp_make_local_110_19_6(5,__context__) = 15;
+        _temp_make_local_110_19_6(6,__context__) = 16;
+        _temp_make_local_110_19_6(7,__context__) = 17;
+        _temp_make_local_110_19_6(8,__context__) = 18;
+        _temp_make_local_110_19_6(9,__context__) = 19;
+        return _temp_make_local_110_19_6;
+    })()))));
+    TArray<int32_t> __rarr_rename_at_111_34;das_zero(__rarr_rename_at_111_34);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__rarr_rename_at_111_34),10);
+    v_gather_scatter_mask(das_ref(__context__,__rarr_rename_at_111_34(0,__context__)),uint4(0,2,6,7),das_reinterpret<int32_t const  * const >::pass(das_ref(__context__,__arr_rename_at_110_33(0,__context__))),uint4(1,3,7,8),int4(1,13,2,3));
+    DAS_ASSERT(((((__rarr_rename_at_111_34(0,__context__) == 11) && (__rarr_rename_at_111_34(2,__context__) == 0)) && (__rarr_rename_at_111_34(6,__context__) == 17)) && (__rarr_rename_at_111_34(7,__context__) == 18)));
+    TArray<uint32_t> __arru_rename_at_115_35; das_zero(__arru_rename_at_115_35); das_move(__arru_rename_at_115_35, _FuncbuiltinTickto_array_moveTick3185538323411982277_7d3b107365e47705(__context__,das_arg<TDim<uint32_t,10>>::pass((([&]() -> TDim<uint32_t,10>& {
+        _temp_make_local_115_20_7(0,__context__) = 0xau;
+        _temp_make_local_115_20_7(1,__context__) = 0xbu;
+        _temp_make_local_115_20_7(2,__context__) = 0xcu;
+        _temp_make_local_115_20_7(3,__context__) = 0xdu;
+        _temp_make_local_115_20_7(4,__context__) = 0xeu;
+        _temp_make_local_115_20_7(5,__context__) = 0xfu;
+        _temp_make_local_115_20_7(6,__context__) = 0x10u;
+        _temp_make_local_115_20_7(7,__context__) = 0x11u;
+        _temp_make_local_115_20_7(8,__context__) = 0x12u;
+        _temp_make_local_115_20_7(9,__context__) = 0x13u;
+        return _temp_make_local_115_20_7;
+    })()))));
+    TArray<uint32_t> __rarru_rename_at_116_36;das_zero(__rarru_rename_at_116_36);
+    _FuncbuiltinTickresizeTick4811697762258667383_fe200b84d41b4211(__context__,das_arg<TArray<uint32_t>>::pass(__rarru_rename_at_116_36),10);
+    v_gather_scatter_mask(das_ref(__context__,__rarru_rename_at_116_36(0,__context__)),uint4(0,2,6,7),das_reinterpret<uint32_t const  * const >::pass(das_ref(__context__,__arru_rename_at_115_35(0,__context__))),uint4(1,3,7,8),uint4(1,3,17,3));
+    DAS_ASSERT(((((__rarru_rename_at_116_36(0,__context__) == 0xbu) && (__rarru_rename_at_116_36(2,__context__) == 0xdu)) && (__rarru_rename_at_116_36(6,__context__) == 0x0u)) && (__rarru_rename_at_116_36(7,__context__) == 0x12u)));
+    TArray<float> __arrf_rename_at_120_37; das_zero(__arrf_rename_at_120_37); das_move(__arrf_rename_at_120_37, _FuncbuiltinTickto_array_moveTick3185538323411982277_51a3d02b5053d2d0(__context__,das_arg<TDim<float,10>>::pass((([&]() -> TDim<float,10>& {
+        _temp_make_local_120_20_8(0,__context__) = 1.000000e+01f;
+        _temp_make_local_120_20_8(1,__context__) = 1.100000e+01f;
+        _temp_make_local_120_20_8(2,__context__) = 1.200000e+01f;
+        _temp_make_local_120_20_8(3,__context__) = 1.300000e+01f;
+        _temp_make_local_120_20_8(4,__context__) = 1.400000e+01f;
+        _temp_make_local_120_20_8(5,__context__) = 1.500000e+01f;
+        _temp_make_local_120_20_8(6,__context__) = 1.600000e+01f;
+        _temp_make_local_120_20_8(7,__context__) = 1.700000e+01f;
+        _temp_make_local_120_20_8(8,__context__) = 1.800000e+01f;
+        _temp_make_local_120_20_8(9,__context__) = 1.900000e+01f;
+        return _temp_make_local_120_20_8;
+    })()))));
+    TArray<float> __rarrf_rename_at_121_38;das_zero(__rarrf_rename_at_121_38);
+    _FuncbuiltinTickresizeTick4811697762258667383_e3c7d561173b49d9(__context__,das_arg<TArray<float>>::pass(__rarrf_rename_at_121_38),10);
+    v_gather_scatter_mask(das_ref(__context__,__rarrf_rename_at_121_38(0,__context__)),uint4(0,2,6,7),das_reinterpret<float const  * const >::pass(das_ref(__context__,__arrf_rename_at_120_37(0,__context__))),uint4(1,3,7,8),v_make_vec4f(1.100000e+01f,1.000000e+00f,2.000000e+00f,1.800000e+01f));
+    DAS_ASSERT(((((__rarrf_rename_at_121_38(0,__context__) == 0.000000e+00f) && (__rarrf_rename_at_121_38(2,__context__) == 1.300000e+01f)) && (__rarrf_rename_at_121_38(6,__context__) == 1.700000e+01f)) && (__rarrf_rename_at_121_38(7,__context__) == 0.000000e+00f)));
+}
+
+inline void test_gather_store_mask_2b8e7fb33f67b7cb ( Context * __context__ )
+{
+    TDim<int32_t,10> _temp_make_local_132_19_9; _temp_make_local_132_19_9;
+    TDim<uint32_t,10> _temp_make_local_137_20_10; _temp_make_local_137_20_10;
+    TDim<float,10> _temp_make_local_142_20_11; _temp_make_local_142_20_11;
+    TArray<int32_t> __arr_rename_at_132_39; das_zero(__arr_rename_at_132_39); das_move(__arr_rename_at_132_39, _FuncbuiltinTickto_array_moveTick3185538323411982277_bfe79bb39aa617c(__context__,das_arg<TDim<int32_t,10>>::pass((([&]() -> TDim<int32_t,10>& {
+        _temp_make_local_132_19_9(0,__context__) = 10;
+        _temp_make_local_132_19_9(1,__context__) = 11;
+        _temp_make_local_132_19_9(2,__context__) = 12;
+        _temp_make_local_132_19_9(3,__context__) = 13;
+        _temp_make_local_132_19_9(4,__context__) = 14;
+        _temp_make_local_132_19_9(5,__context__) = 15;
+        _temp_make_local_132_19_9(6,__context__) = 16;
+        _temp_make_local_132_19_9(7,__context__) = 17;
+        _temp_make_local_132_19_9(8,__context__) = 18;
+        _temp_make_local_132_19_9(9,__context__) = 19;
+        return _temp_make_local_132_19_9;
+    })()))));
+    int4 __rres_rename_at_133_40 = int4(-1,-2,-3,-4);
+    v_gather_store_mask(das_ref(__context__,__rres_rename_at_133_40),das_reinterpret<int32_t const  * const >::pass(das_ref(__context__,__arr_rename_at_132_39(0,__context__))),uint4(1,3,7,8),int4(1,13,2,3));
+    DAS_ASSERT((SimPolicy<int4>::Equ(int4(11,-2,17,18),__rres_rename_at_133_40,*__context__,nullptr)));
+    TArray<uint32_t> __arru_rename_at_137_41; das_zero(__arru_rename_at_137_41); das_move(__arru_rename_at_137_41, _FuncbuiltinTickto_array_moveTick3185538323411982277_7d3b107365e47705(__context__,das_arg<TDim<uint32_t,10>>::pass((([&]() -> TDim<uint32_t,10>& {
+        _temp_make_local_137_20_10(0,__context__) = 0xau;
+        _temp_make_local_137_20_10(1,__context__) = 0xbu;
+        _temp_make_local_137_20_10(2,__context__) = 0xcu;
+        _temp_make_local_137_20_10(3,__context__) = 0xdu;
+        _temp_make_local_137_20_10(4,__context__) = 0xeu;
+        _temp_make_local_137_20_10(5,__context__) = 0xfu;
+        _temp_make_local_137_20_10(6,__context__) = 0x10u;
+        _temp_make_local_137_20_10(7,__context__) = 0x11u;
+        _temp_make_local_137_20_10(8,__context__) = 0x12u;
+        _temp_make_local_137_20_10(9,__context__) = 0x13u;
+        return _temp_make_local_137_20_10;
+    })()))));
+    uint4 __rresu_rename_at_138_42 = uint4(1,2,3,4);
+    v_gather_store_mask(das_ref(__context__,__rresu_rename_at_138_42),das_reinterpret<uint32_t const  * const >::pass(das_ref(__context__,__arru_rename_at_137_41(0,__context__))),uint4(1,3,7,8),uint4(1,3,17,3));
+    DAS_ASSERT((SimPolicy<uint4>::Equ(uint4(11,13,3,18),__rresu_rename_at_138_42,*__context__,nullptr)));
+    TArray<float> __arrf_rename_at_142_43; das_zero(__arrf_rename_at_142_43); das_move(__arrf_rename_at_142_43, _FuncbuiltinTickto_array_moveTick3185538323411982277_51a3d02b5053d2d0(__context__,das_arg<TDim<float,10>>::pass((([&]() -> TDim<float,10>& {
+        _temp_make_local_142_20_11(0,__context__) = 1.000000e+01f;
+        _temp_make_local_142_20_11(1,__context__) = 1.100000e+01f;
+        _temp_make_local_142_20_11(2,__context__) = 1.200000e+01f;
+        _temp_make_local_142_20_11(3,__context__) = 1.300000e+01f;
+        _temp_make_local_142_20_11(4,__context__) = 1.400000e+01f;
+        _temp_make_local_142_20_11(5,__context__) = 1.500000e+01f;
+        _temp_make_local_142_20_11(6,__context__) = 1.600000e+01f;
+        _temp_make_local_142_20_11(7,__context__) = 1.700000e+01f;
+        _temp_make_local_142_20_11(8,__context__) = 1.800000e+01f;
+        _temp_make_local_142_20_11(9,__context__) = 1.900000e+01f;
+        return _temp_make_local_142_20_11;
+    })()))));
+    float4 __rresf_rename_at_143_44 = v_make_vec4f(1.000000e+00f,2.000000e+00f,3.000000e+00f,4.000000e+00f);
+    v_gather_store_mask(das_ref(__context__,__rresf_rename_at_143_44),das_reinterpret<float const  * const >::pass(das_ref(__context__,__arrf_rename_at_142_43(0,__context__))),uint4(1,3,7,8),v_make_vec4f(1.100000e+01f,1.000000e+00f,2.000000e+00f,1.800000e+01f));
+    DAS_ASSERT((SimPolicy<float4>::Equ(v_make_vec4f(1.000000e+00f,1.300000e+01f,1.700000e+01f,4.000000e+00f),__rresf_rename_at_143_44,*__context__,nullptr)));
+}
+
+inline void test_gather_store_stride_f21633b69aa4422e ( Context * __context__ )
+{
+    TDim<int32_t,10> _temp_make_local_155_19_12; _temp_make_local_155_19_12;
+    TArray<int32_t> __arr_rename_at_155_45; das_zero(__arr_rename_at_155_45); das_move(__arr_rename_at_155_45, _FuncbuiltinTickto_array_moveTick3185538323411982277_bfe79bb39aa617c(__context__,das_arg<TDim<int32_t,10>>::pass((([&]() -> TDim<int32_t,10>& {
+        _temp_make_local_155_19_12(0,__context__) = 10;
+        _temp_make_local_155_19_12(1,__context__) = 11;
+        _temp_make_local_155_19_12(2,__context__) = 12;
+        _temp_make_local_155_19_12(3,__context__) = 13;
+        _temp_make_local_155_19_12(4,__context__) = 14;
+        _temp_make_local_155_19_12(5,__context__) = 15;
+        _temp_make_local_155_19_12(6,__context__) = 16;
+        _temp_make_local_155_19_12(7,__context__) = 17;
+        _temp_make_local_155_19_12(8,__context__) = 18;
+        _temp_make_local_155_19_12(9,__context__) = 19;
+        return _temp_make_local_155_19_12;
+    })()))));
+    TArray<int32_t> __rarr_rename_at_156_46;das_zero(__rarr_rename_at_156_46);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__rarr_rename_at_156_46),10);
+    v_gather_store_stride(das_ref(__context__,__rarr_rename_at_156_46(0,__context__)),2,das_reinterpret<int32_t const  * const >::pass(das_ref(__context__,__arr_rename_at_155_45(0,__context__))),uint4(1,3,7,8));
+    DAS_ASSERT(((((__rarr_rename_at_156_46(0,__context__) == 11) && (__rarr_rename_at_156_46(2,__context__) == 13)) && (__rarr_rename_at_156_46(4,__context__) == 17)) && (__rarr_rename_at_156_46(6,__context__) == 18)));
+}
+
+inline bool test_369a30bf8722ddea ( Context * __context__ )
+{
+    test_gather_d3b499a9ddcb9a61(__context__);
+    test_scatter_2589353a6628b906(__context__);
+    test_scatter_mask_dfc65dbb39a234ac(__context__);
+    test_store_mask_253e9cfad113a3b8(__context__);
+    test_gather_scatter_12691e448bc1539b(__context__);
+    test_gather_scatter_mask_35240e2048796c2d(__context__);
+    test_gather_store_mask_2b8e7fb33f67b7cb(__context__);
+    test_gather_store_stride_f21633b69aa4422e(__context__);
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline void main_9599ef1e98490084 ( Context * __context__ )
+{
+    test_369a30bf8722ddea(__context__);
+    builtin_print(((char *) "passed\n"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_bfe79bb39aa617c ( Context * __context__ ) {
+    TDim<int32_t,10> &  arg_a = cast_aot_arg<TDim<int32_t,10> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_bfe79bb39aa617c(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_7d3b107365e47705 ( Context * __context__ ) {
+    TDim<uint32_t,10> &  arg_a = cast_aot_arg<TDim<uint32_t,10> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<uint32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_7d3b107365e47705(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_fe200b84d41b4211 ( Context * __context__ ) {
+    TArray<uint32_t> &  arg_Arr = cast_aot_arg<TArray<uint32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_fe200b84d41b4211(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_51a3d02b5053d2d0 ( Context * __context__ ) {
+    TDim<float,10> &  arg_a = cast_aot_arg<TDim<float,10> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<float> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_51a3d02b5053d2d0(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_e3c7d561173b49d9 ( Context * __context__ ) {
+    TArray<float> &  arg_Arr = cast_aot_arg<TArray<float> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_e3c7d561173b49d9(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap_test_gather_scatter_12691e448bc1539b ( Context * __context__ ) {
+    test_gather_scatter_12691e448bc1539b(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_gather_d3b499a9ddcb9a61 ( Context * __context__ ) {
+    test_gather_d3b499a9ddcb9a61(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_scatter_2589353a6628b906 ( Context * __context__ ) {
+    test_scatter_2589353a6628b906(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_scatter_mask_dfc65dbb39a234ac ( Context * __context__ ) {
+    test_scatter_mask_dfc65dbb39a234ac(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_store_mask_253e9cfad113a3b8 ( Context * __context__ ) {
+    test_store_mask_253e9cfad113a3b8(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_gather_scatter_mask_35240e2048796c2d ( Context * __context__ ) {
+    test_gather_scatter_mask_35240e2048796c2d(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_gather_store_mask_2b8e7fb33f67b7cb ( Context * __context__ ) {
+    test_gather_store_mask_2b8e7fb33f67b7cb(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_gather_store_stride_f21633b69aa4422e ( Context * __context__ ) {
+    test_gather_store_stride_f21633b69aa4422e(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_369a30bf8722ddea ( Context * __context__ ) {
+    return cast<bool>::from(test_369a30bf8722ddea(__context__));
+}
+static vec4f __wrap_main_9599ef1e98490084 ( Context * __context__ ) {
+    main_9599ef1e98490084(__context__);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x4e5b4db41fe7abea, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_bfe79bb39aa617c, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_bfe79bb39aa617c },
+    { 0xa51a880d594e91fd, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c },
+    { 0x5df75b4a90587f62, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_7d3b107365e47705, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_7d3b107365e47705 },
+    { 0x3bfb11e15e05d98a, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_fe200b84d41b4211, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_fe200b84d41b4211 },
+    { 0xf3bf59c257e8ac85, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_51a3d02b5053d2d0, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_51a3d02b5053d2d0 },
+    { 0x3a0e82c86652347, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_e3c7d561173b49d9, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_e3c7d561173b49d9 },
+    { 0x31f0aca9380c2935, false, (void*)&test_gather_scatter_12691e448bc1539b, &__wrap_test_gather_scatter_12691e448bc1539b },
+    { 0x9e913acf6eafef86, false, (void*)&test_gather_d3b499a9ddcb9a61, &__wrap_test_gather_d3b499a9ddcb9a61 },
+    { 0x26d58253d17d7d93, false, (void*)&test_scatter_2589353a6628b906, &__wrap_test_scatter_2589353a6628b906 },
+    { 0x45a5d0c727fe6e10, false, (void*)&test_scatter_mask_dfc65dbb39a234ac, &__wrap_test_scatter_mask_dfc65dbb39a234ac },
+    { 0xbdd6334eb5dcc70d, false, (void*)&test_store_mask_253e9cfad113a3b8, &__wrap_test_store_mask_253e9cfad113a3b8 },
+    { 0xdfb3269fb95604bb, false, (void*)&test_gather_scatter_mask_35240e2048796c2d, &__wrap_test_gather_scatter_mask_35240e2048796c2d },
+    { 0xdfe15bdc85891e40, false, (void*)&test_gather_store_mask_2b8e7fb33f67b7cb, &__wrap_test_gather_store_mask_2b8e7fb33f67b7cb },
+    { 0xf6dfc3d4e13a09a2, false, (void*)&test_gather_store_stride_f21633b69aa4422e, &__wrap_test_gather_store_stride_f21633b69aa4422e },
+    { 0xfa46bc687b049403, false, (void*)&test_369a30bf8722ddea, &__wrap_test_369a30bf8722ddea },
+    { 0x20d488cfcd2e1dcb, false, (void*)&main_9599ef1e98490084, &__wrap_main_9599ef1e98490084 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_18276611618462022696
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,486 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_6558888116623468439 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickclearTick13739625760977891612_b913f05aec8fad97 ( Context * __context__, TTable<int32_t,void> & __t_rename_at_2083_0 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickkeysTick3875137551537175793_33ca22626dc7e81b ( Context * __context__, TTable<int32_t,void> const  & __a_rename_at_1275_1 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_68_3, int32_t __newSize_rename_at_68_4 );
+inline void _FuncbuiltinTickcloneTick9435759932231011550_ee366d7f255d762c ( Context * __context__, TTable<int32_t,void> & __a_rename_at_1159_5, TTable<int32_t,void> const  & __b_rename_at_1159_6 );
+inline TTable<int32_t,void> _FuncbuiltinTickclone_to_moveTick17180087396728260876_764d64f493297fbd ( Context * __context__, TTable<int32_t,void> & __clone_src_rename_at_1118_8 );
+inline TTable<int32_t,void> _FuncbuiltinTickto_table_moveTick3386430563931768014_b8e7916495b20880 ( Context * __context__, TDim<int32_t,4> const  & __a_rename_at_1577_10 );
+inline void _FuncbuiltinTickinsertTick10959621454228962049_51719e0c1c9dcb16 ( Context * __context__, TTable<int32_t,void> & __Tab_rename_at_811_13, int32_t __at_rename_at_811_14 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickkeysTick17388619793938508994_779929c46c1ffcc4 ( Context * __context__, TTable<int32_t,void> & __a_rename_at_1282_15 );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b ( Context * __context__, TDim<int32_t,3> & __a_rename_at_1502_17 );
+inline bool _FuncbuiltinTickeraseTick5639988512056021548_2c82ec759a285266 ( Context * __context__, TTable<int32_t,void> & __Tab_rename_at_804_19, int32_t __at_rename_at_804_20 );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115 ( Context * __context__, TDim<int32_t,2> & __a_rename_at_1502_21 );
+inline bool _FuncbuiltinTickkey_existsTick16808803843923989214_268daca8bf1e4baf ( Context * __context__, TTable<int32_t,void> const  & __Tab_rename_at_1040_23, int32_t __at_rename_at_1040_24 );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18 ( Context * __context__, TDim<int32_t,4> & __a_rename_at_1502_25 );
+inline TTable<int32_t,void> _FuncbuiltinTickto_tableTick16490927545536556746_b8e7916495b20880 ( Context * __context__, TDim<int32_t,4> const  & __a_rename_at_1568_27 );
+inline bool test_d99073a80fc1e46 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickclearTick13739625760977891612_b913f05aec8fad97 ( Context * __context__, TTable<int32_t,void> &  __t_rename_at_2083_0 )
+{
+    builtin_table_clear(das_arg<TTable<int32_t,void>>::pass(__t_rename_at_2083_0),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickkeysTick3875137551537175793_33ca22626dc7e81b ( Context * __context__, TTable<int32_t,void> const  &  __a_rename_at_1275_1 )
+{
+    Sequence DAS_COMMENT((int32_t)) __it_rename_at_1276_2;das_zero(__it_rename_at_1276_2);
+    builtin_table_keys(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_1276_2),__a_rename_at_1275_1,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_1276_2);
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_68_3, int32_t __newSize_rename_at_68_4 )
+{
+    builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_68_3),__newSize_rename_at_68_4,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickcloneTick9435759932231011550_ee366d7f255d762c ( Context * __context__, TTable<int32_t,void> &  __a_rename_at_1159_5, TTable<int32_t,void> const  &  __b_rename_at_1159_6 )
+{
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_1161_14_0; _temp_make_local_1161_14_0;
+    _FuncbuiltinTickclearTick13739625760977891612_b913f05aec8fad97(__context__,das_arg<TTable<int32_t,void>>::pass(__a_rename_at_1159_5));
+    {
+        bool __need_loop_1161 = true;
+        // k: int
+        das_iterator<Sequence DAS_COMMENT((int32_t))> __k_iterator((_temp_make_local_1161_14_0 = (_FuncbuiltinTickkeysTick3875137551537175793_33ca22626dc7e81b(__context__,__b_rename_at_1159_6))));
+        int32_t __k_rename_at_1161_7;
+        __need_loop_1161 = __k_iterator.first(__context__,(__k_rename_at_1161_7)) && __need_loop_1161;
+        for ( ; __need_loop_1161 ; __need_loop_1161 = __k_iterator.next(__context__,(__k_rename_at_1161_7)) )
+        {
+            __builtin_table_set_insert(__context__,__a_rename_at_1159_5,__k_rename_at_1161_7);
+        }
+        __k_iterator.close(__context__,(__k_rename_at_1161_7));
+    };
+}
+
+inline TTable<int32_t,void> _FuncbuiltinTickclone_to_moveTick17180087396728260876_764d64f493297fbd ( Context * __context__, TTable<int32_t,void> &  __clone_src_rename_at_1118_8 )
+{
+    TTable<int32_t,void> __clone_dest_rename_at_1120_9;das_zero(__clone_dest_rename_at_1120_9);
+    _FuncbuiltinTickcloneTick9435759932231011550_ee366d7f255d762c(__context__,das_arg<TTable<int32_t,void>>::pass(__clone_dest_rename_at_1120_9),das_arg<TTable<int32_t,void>>::pass(__clone_src_rename_at_1118_8));
+    return /* <- */ das_auto_cast_move<TTable<int32_t,void>>::cast(__clone_dest_rename_at_1120_9);
+}
+
+inline TTable<int32_t,void> _FuncbuiltinTickto_table_moveTick3386430563931768014_b8e7916495b20880 ( Context * __context__, TDim<int32_t,4> const  &  __a_rename_at_1577_10 )
+{
+    TTable<int32_t,void> __tab_rename_at_1578_11;das_zero(__tab_rename_at_1578_11);
+    {
+        bool __need_loop_1579 = true;
+        // at: int aka keyT const&
+        das_iterator<TDim<int32_t,4> const > __at_iterator(__a_rename_at_1577_10);
+        int32_t const  * __at_rename_at_1579_12;
+        __need_loop_1579 = __at_iterator.first(__context__,(__at_rename_at_1579_12)) && __need_loop_1579;
+        for ( ; __need_loop_1579 ; __need_loop_1579 = __at_iterator.next(__context__,(__at_rename_at_1579_12)) )
+        {
+            __builtin_table_set_insert(__context__,__tab_rename_at_1578_11,(*__at_rename_at_1579_12));
+        }
+        __at_iterator.close(__context__,(__at_rename_at_1579_12));
+    };
+    return /* <- */ das_auto_cast_move<TTable<int32_t,void>>::cast(__tab_rename_at_1578_11);
+}
+
+inline void _FuncbuiltinTickinsertTick10959621454228962049_51719e0c1c9dcb16 ( Context * __context__, TTable<int32_t,void> &  __Tab_rename_at_811_13, int32_t __at_rename_at_811_14 )
+{
+    __builtin_table_set_insert(__context__,__Tab_rename_at_811_13,__at_rename_at_811_14);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickkeysTick17388619793938508994_779929c46c1ffcc4 ( Context * __context__, TTable<int32_t,void> &  __a_rename_at_1282_15 )
+{
+    Sequence DAS_COMMENT((int32_t)) __it_rename_at_1283_16;das_zero(__it_rename_at_1283_16);
+    builtin_table_keys(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_1283_16),das_arg<TTable<int32_t,void>>::pass(__a_rename_at_1282_15),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_1283_16);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b ( Context * __context__, TDim<int32_t,3> &  __a_rename_at_1502_17 )
+{
+    TArray<int32_t> __arr_rename_at_1504_18;das_zero(__arr_rename_at_1504_18);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_18),3);
+    das_copy(das_cast<TDim<int32_t,3>>::cast(das_ref(__context__,__arr_rename_at_1504_18(0,__context__))),__a_rename_at_1502_17);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_18);
+}
+
+inline bool _FuncbuiltinTickeraseTick5639988512056021548_2c82ec759a285266 ( Context * __context__, TTable<int32_t,void> &  __Tab_rename_at_804_19, int32_t __at_rename_at_804_20 )
+{
+    return das_auto_cast<bool>::cast(__builtin_table_erase(__context__,__Tab_rename_at_804_19,__at_rename_at_804_20));
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115 ( Context * __context__, TDim<int32_t,2> &  __a_rename_at_1502_21 )
+{
+    TArray<int32_t> __arr_rename_at_1504_22;das_zero(__arr_rename_at_1504_22);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_22),2);
+    das_copy(das_cast<TDim<int32_t,2>>::cast(das_ref(__context__,__arr_rename_at_1504_22(0,__context__))),__a_rename_at_1502_21);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_22);
+}
+
+inline bool _FuncbuiltinTickkey_existsTick16808803843923989214_268daca8bf1e4baf ( Context * __context__, TTable<int32_t,void> const  &  __Tab_rename_at_1040_23, int32_t __at_rename_at_1040_24 )
+{
+    return das_auto_cast<bool>::cast(__builtin_table_key_exists(__context__,__Tab_rename_at_1040_23,__at_rename_at_1040_24));
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18 ( Context * __context__, TDim<int32_t,4> &  __a_rename_at_1502_25 )
+{
+    TArray<int32_t> __arr_rename_at_1504_26;das_zero(__arr_rename_at_1504_26);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_26),4);
+    das_copy(das_cast<TDim<int32_t,4>>::cast(das_ref(__context__,__arr_rename_at_1504_26(0,__context__))),__a_rename_at_1502_25);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_26);
+}
+
+inline TTable<int32_t,void> _FuncbuiltinTickto_tableTick16490927545536556746_b8e7916495b20880 ( Context * __context__, TDim<int32_t,4> const  &  __a_rename_at_1568_27 )
+{
+    TTable<int32_t,void> __tab_rename_at_1569_28;das_zero(__tab_rename_at_1569_28);
+    {
+        bool __need_loop_1570 = true;
+        // at: int aka keyT const&
+        das_iterator<TDim<int32_t,4> const > __at_iterator(__a_rename_at_1568_27);
+        int32_t const  * __at_rename_at_1570_29;
+        __need_loop_1570 = __at_iterator.first(__context__,(__at_rename_at_1570_29)) && __need_loop_1570;
+        for ( ; __need_loop_1570 ; __need_loop_1570 = __at_iterator.next(__context__,(__at_rename_at_1570_29)) )
+        {
+            __builtin_table_set_insert(__context__,__tab_rename_at_1569_28,(*__at_rename_at_1570_29));
+        }
+        __at_iterator.close(__context__,(__at_rename_at_1570_29));
+    };
+    return /* <- */ das_auto_cast_move<TTable<int32_t,void>>::cast(__tab_rename_at_1569_28);
+}
+
+inline bool test_d99073a80fc1e46 ( Context * __context__ )
+{
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_16_17_1; _temp_make_local_16_17_1;
+    TArray<int32_t> _temp_make_local_16_28_2; _temp_make_local_16_28_2;
+    TDim<int32_t,3> _temp_make_local_16_28_3; _temp_make_local_16_28_3;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_20_17_4; _temp_make_local_20_17_4;
+    TArray<int32_t> _temp_make_local_20_28_5; _temp_make_local_20_28_5;
+    TDim<int32_t,2> _temp_make_local_20_28_6; _temp_make_local_20_28_6;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_24_17_7; _temp_make_local_24_17_7;
+    TArray<int32_t> _temp_make_local_24_27_8; _temp_make_local_24_27_8;
+    TDim<int32_t,2> _temp_make_local_24_27_9; _temp_make_local_24_27_9;
+    TDim<int32_t,4> _temp_make_local_36_15_10; _temp_make_local_36_15_10;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_37_17_11; _temp_make_local_37_17_11;
+    TArray<int32_t> _temp_make_local_37_28_12; _temp_make_local_37_28_12;
+    TDim<int32_t,4> _temp_make_local_37_28_13; _temp_make_local_37_28_13;
+    TDim<int32_t,4> _temp_make_local_40_24_14; _temp_make_local_40_24_14;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_42_17_15; _temp_make_local_42_17_15;
+    TArray<int32_t> _temp_make_local_42_28_16; _temp_make_local_42_28_16;
+    TDim<int32_t,4> _temp_make_local_42_28_17; _temp_make_local_42_28_17;
+    TTable<int32_t,void> __tab_rename_at_4_30;das_zero(__tab_rename_at_4_30);
+    DAS_ASSERT((builtin_table_size(das_arg<TTable<int32_t,void>>::pass(__tab_rename_at_4_30)) == 0));
+    {
+        bool __need_loop_13 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(3,6));
+        int32_t __i_rename_at_13_31;
+        __need_loop_13 = __i_iterator.first(__context__,(__i_rename_at_13_31)) && __need_loop_13;
+        for ( ; __need_loop_13 ; __need_loop_13 = __i_iterator.next(__context__,(__i_rename_at_13_31)) )
+        {
+            _FuncbuiltinTickinsertTick10959621454228962049_51719e0c1c9dcb16(__context__,das_arg<TTable<int32_t,void>>::pass(__tab_rename_at_4_30),__i_rename_at_13_31);
+        }
+        __i_iterator.close(__context__,(__i_rename_at_13_31));
+    };
+    {
+        bool __need_loop_16 = true;
+        // k: int
+        das_iterator<Sequence DAS_COMMENT((int32_t))> __k_iterator((_temp_make_local_16_17_1 = (_FuncbuiltinTickkeysTick17388619793938508994_779929c46c1ffcc4(__context__,das_arg<TTable<int32_t,void>>::pass(__tab_rename_at_4_30)))));
+        int32_t __k_rename_at_16_34;
+        __need_loop_16 = __k_iterator.first(__context__,(__k_rename_at_16_34)) && __need_loop_16;
+        // i: int&
+        das_iterator<TArray<int32_t>> __i_iterator((_temp_make_local_16_28_2 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b(__context__,das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+            _temp_make_local_16_28_3(0,__context__) = 5;
+            _temp_make_local_16_28_3(1,__context__) = 4;
+            _temp_make_local_16_28_3(2,__context__) = 3;
+            return _temp_make_local_16_28_3;
+        })()))))));
+        int32_t * __i_rename_at_16_35;
+        __need_loop_16 = __i_iterator.first(__context__,(__i_rename_at_16_35)) && __need_loop_16;
+        for ( ; __need_loop_16 ; __need_loop_16 = __k_iterator.next(__context__,(__k_rename_at_16_34)) && __i_iterator.next(__context__,(__i_rename_at_16_35)) )
+        {
+            DAS_ASSERT((__k_rename_at_16_34 == (*__i_rename_at_16_35)));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_16_35));
+        __k_iterator.close(__context__,(__k_rename_at_16_34));
+    };
+    _FuncbuiltinTickeraseTick5639988512056021548_2c82ec759a285266(__context__,das_arg<TTable<int32_t,void>>::pass(__tab_rename_at_4_30),4);
+    {
+        bool __need_loop_20 = true;
+        // k: int
+        das_iterator<Sequence DAS_COMMENT((int32_t))> __k_iterator((_temp_make_local_20_17_4 = (_FuncbuiltinTickkeysTick17388619793938508994_779929c46c1ffcc4(__context__,das_arg<TTable<int32_t,void>>::pass(__tab_rename_at_4_30)))));
+        int32_t __k_rename_at_20_38;
+        __need_loop_20 = __k_iterator.first(__context__,(__k_rename_at_20_38)) && __need_loop_20;
+        // i: int&
+        das_iterator<TArray<int32_t>> __i_iterator((_temp_make_local_20_28_5 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+            _temp_make_local_20_28_6(0,__context__) = 5;
+            _temp_make_local_20_28_6(1,__context__) = 3;
+            return _temp_make_local_20_28_6;
+        })()))))));
+        int32_t * __i_rename_at_20_39;
+        __need_loop_20 = __i_iterator.first(__context__,(__i_rename_at_20_39)) && __need_loop_20;
+        for ( ; __need_loop_20 ; __need_loop_20 = __k_iterator.next(__context__,(__k_rename_at_20_38)) && __i_iterator.next(__context__,(__i_rename_at_20_39)) )
+        {
+            DAS_ASSERT((__k_rename_at_20_38 == (*__i_rename_at_20_39)));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_20_39));
+        __k_iterator.close(__context__,(__k_rename_at_20_38));
+    };
+    TTable<int32_t,void> __tc_rename_at_23_40; das_zero(__tc_rename_at_23_40); das_move(__tc_rename_at_23_40, _FuncbuiltinTickclone_to_moveTick17180087396728260876_764d64f493297fbd(__context__,das_arg<TTable<int32_t,void>>::pass(__tab_rename_at_4_30)));
+    {
+        bool __need_loop_24 = true;
+        // k: int
+        das_iterator<Sequence DAS_COMMENT((int32_t))> __k_iterator((_temp_make_local_24_17_7 = (_FuncbuiltinTickkeysTick17388619793938508994_779929c46c1ffcc4(__context__,das_arg<TTable<int32_t,void>>::pass(__tc_rename_at_23_40)))));
+        int32_t __k_rename_at_24_43;
+        __need_loop_24 = __k_iterator.first(__context__,(__k_rename_at_24_43)) && __need_loop_24;
+        // i: int&
+        das_iterator<TArray<int32_t>> __i_iterator((_temp_make_local_24_27_8 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+            _temp_make_local_24_27_9(0,__context__) = 5;
+            _temp_make_local_24_27_9(1,__context__) = 3;
+            return _temp_make_local_24_27_9;
+        })()))))));
+        int32_t * __i_rename_at_24_44;
+        __need_loop_24 = __i_iterator.first(__context__,(__i_rename_at_24_44)) && __need_loop_24;
+        for ( ; __need_loop_24 ; __need_loop_24 = __k_iterator.next(__context__,(__k_rename_at_24_43)) && __i_iterator.next(__context__,(__i_rename_at_24_44)) )
+        {
+            DAS_ASSERT((__k_rename_at_24_43 == (*__i_rename_at_24_44)));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_24_44));
+        __k_iterator.close(__context__,(__k_rename_at_24_43));
+    };
+    DAS_ASSERT((_FuncbuiltinTickkey_existsTick16808803843923989214_268daca8bf1e4baf(__context__,das_arg<TTable<int32_t,void>>::pass(__tc_rename_at_23_40),3)));
+    DAS_ASSERT((!_FuncbuiltinTickkey_existsTick16808803843923989214_268daca8bf1e4baf(__context__,das_arg<TTable<int32_t,void>>::pass(__tc_rename_at_23_40),4)));
+    TTable<int32_t,void> __ttt_rename_at_36_45; das_zero(__ttt_rename_at_36_45); das_move(__ttt_rename_at_36_45, _FuncbuiltinTickto_table_moveTick3386430563931768014_b8e7916495b20880(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+        _temp_make_local_36_15_10(0,__context__) = 1;
+        _temp_make_local_36_15_10(1,__context__) = 2;
+        _temp_make_local_36_15_10(2,__context__) = 3;
+        _temp_make_local_36_15_10(3,__context__) = 4;
+        return _temp_make_local_36_15_10;
+    })()))));
+    {
+        bool __need_loop_37 = true;
+        // k: int
+        das_iterator<Sequence DAS_COMMENT((int32_t))> __k_iterator((_temp_make_local_37_17_11 = (_FuncbuiltinTickkeysTick17388619793938508994_779929c46c1ffcc4(__context__,das_arg<TTable<int32_t,void>>::pass(__ttt_rename_at_36_45)))));
+        int32_t __k_rename_at_37_48;
+        __need_loop_37 = __k_iterator.first(__context__,(__k_rename_at_37_48)) && __need_loop_37;
+        // i: int&
+        das_iterator<TArray<int32_t>> __i_iterator((_temp_make_local_37_28_12 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+            _temp_make_local_37_28_13(0,__context__) = 4;
+            _temp_make_local_37_28_13(1,__context__) = 3;
+            _temp_make_local_37_28_13(2,__context__) = 2;
+            _temp_make_local_37_28_13(3,__context__) = 1;
+            return _temp_make_local_37_28_13;
+        })()))))));
+        int32_t * __i_rename_at_37_49;
+        __need_loop_37 = __i_iterator.first(__context__,(__i_rename_at_37_49)) && __need_loop_37;
+        for ( ; __need_loop_37 ; __need_loop_37 = __k_iterator.next(__context__,(__k_rename_at_37_48)) && __i_iterator.next(__context__,(__i_rename_at_37_49)) )
+        {
+            DAS_ASSERT((__k_rename_at_37_48 == (*__i_rename_at_37_49)));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_37_49));
+        __k_iterator.close(__context__,(__k_rename_at_37_48));
+    };
+    TTable<int32_t,void> __qqq_rename_at_40_50; das_zero(__qqq_rename_at_40_50); das_move(__qqq_rename_at_40_50, _FuncbuiltinTickto_tableTick16490927545536556746_b8e7916495b20880(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+        _temp_make_local_40_24_14(0,__context__) = 1;
+        _temp_make_local_40_24_14(1,__context__) = 2;
+        _temp_make_local_40_24_14(2,__context__) = 3;
+        _temp_make_local_40_24_14(3,__context__) = 4;
+        return _temp_make_local_40_24_14;
+    })()))));
+    builtin_print(((char *) "\n"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    {
+        bool __need_loop_42 = true;
+        // k: int
+        das_iterator<Sequence DAS_COMMENT((int32_t))> __k_iterator((_temp_make_local_42_17_15 = (_FuncbuiltinTickkeysTick17388619793938508994_779929c46c1ffcc4(__context__,das_arg<TTable<int32_t,void>>::pass(__qqq_rename_at_40_50)))));
+        int32_t __k_rename_at_42_53;
+        __need_loop_42 = __k_iterator.first(__context__,(__k_rename_at_42_53)) && __need_loop_42;
+        // i: int&
+        das_iterator<TArray<int32_t>> __i_iterator((_temp_make_local_42_28_16 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+            _temp_make_local_42_28_17(0,__context__) = 4;
+            _temp_make_local_42_28_17(1,__context__) = 3;
+            _temp_make_local_42_28_17(2,__context__) = 2;
+            _temp_make_local_42_28_17(3,__context__) = 1;
+            return _temp_make_local_42_28_17;
+        })()))))));
+        int32_t * __i_rename_at_42_54;
+        __need_loop_42 = __i_iterator.first(__context__,(__i_rename_at_42_54)) && __need_loop_42;
+        for ( ; __need_loop_42 ; __need_loop_42 = __k_iterator.next(__context__,(__k_rename_at_42_53)) && __i_iterator.next(__context__,(__i_rename_at_42_54)) )
+        {
+            DAS_ASSERT((__k_rename_at_42_53 == (*__i_rename_at_42_54)));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_42_54));
+        __k_iterator.close(__context__,(__k_rename_at_42_53));
+    };
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncbuiltinTickclearTick13739625760977891612_b913f05aec8fad97 ( Context * __context__ ) {
+    TTable<int32_t,void> &  arg_t = cast_aot_arg<TTable<int32_t,void> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickclearTick13739625760977891612_b913f05aec8fad97(__context__, arg_t);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickkeysTick3875137551537175793_33ca22626dc7e81b ( Context * __context__ ) {
+    TTable<int32_t,void> const  &  arg_a = cast_aot_arg<TTable<int32_t,void> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncbuiltinTickkeysTick3875137551537175793_33ca22626dc7e81b(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickcloneTick9435759932231011550_ee366d7f255d762c ( Context * __context__ ) {
+    TTable<int32_t,void> &  arg_a = cast_aot_arg<TTable<int32_t,void> & >::to(*__context__,__context__->abiArguments()[0]);
+    TTable<int32_t,void> const  &  arg_b = cast_aot_arg<TTable<int32_t,void> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickcloneTick9435759932231011550_ee366d7f255d762c(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickclone_to_moveTick17180087396728260876_764d64f493297fbd ( Context * __context__ ) {
+    TTable<int32_t,void> &  arg_clone_src = cast_aot_arg<TTable<int32_t,void> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TTable<int32_t,void> *) __context__->abiCMRES) = _FuncbuiltinTickclone_to_moveTick17180087396728260876_764d64f493297fbd(__context__, arg_clone_src);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_table_moveTick3386430563931768014_b8e7916495b20880 ( Context * __context__ ) {
+    TDim<int32_t,4> const  &  arg_a = cast_aot_arg<TDim<int32_t,4> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TTable<int32_t,void> *) __context__->abiCMRES) = _FuncbuiltinTickto_table_moveTick3386430563931768014_b8e7916495b20880(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickinsertTick10959621454228962049_51719e0c1c9dcb16 ( Context * __context__ ) {
+    TTable<int32_t,void> &  arg_Tab = cast_aot_arg<TTable<int32_t,void> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_at = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickinsertTick10959621454228962049_51719e0c1c9dcb16(__context__, arg_Tab, arg_at);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickkeysTick17388619793938508994_779929c46c1ffcc4 ( Context * __context__ ) {
+    TTable<int32_t,void> &  arg_a = cast_aot_arg<TTable<int32_t,void> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncbuiltinTickkeysTick17388619793938508994_779929c46c1ffcc4(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b ( Context * __context__ ) {
+    TDim<int32_t,3> &  arg_a = cast_aot_arg<TDim<int32_t,3> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeraseTick5639988512056021548_2c82ec759a285266 ( Context * __context__ ) {
+    TTable<int32_t,void> &  arg_Tab = cast_aot_arg<TTable<int32_t,void> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_at = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_FuncbuiltinTickeraseTick5639988512056021548_2c82ec759a285266(__context__, arg_Tab, arg_at));
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115 ( Context * __context__ ) {
+    TDim<int32_t,2> &  arg_a = cast_aot_arg<TDim<int32_t,2> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickkey_existsTick16808803843923989214_268daca8bf1e4baf ( Context * __context__ ) {
+    TTable<int32_t,void> const  &  arg_Tab = cast_aot_arg<TTable<int32_t,void> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_at = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_FuncbuiltinTickkey_existsTick16808803843923989214_268daca8bf1e4baf(__context__, arg_Tab, arg_at));
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18 ( Context * __context__ ) {
+    TDim<int32_t,4> &  arg_a = cast_aot_arg<TDim<int32_t,4> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_tableTick16490927545536556746_b8e7916495b20880 ( Context * __context__ ) {
+    TDim<int32_t,4> const  &  arg_a = cast_aot_arg<TDim<int32_t,4> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TTable<int32_t,void> *) __context__->abiCMRES) = _FuncbuiltinTickto_tableTick16490927545536556746_b8e7916495b20880(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap_test_d99073a80fc1e46 ( Context * __context__ ) {
+    return cast<bool>::from(test_d99073a80fc1e46(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xac22d6f59e327f2d, false, (void*)&_FuncbuiltinTickclearTick13739625760977891612_b913f05aec8fad97, &__wrap__FuncbuiltinTickclearTick13739625760977891612_b913f05aec8fad97 },
+    { 0x907d0b264597bb9a, true, (void*)&_FuncbuiltinTickkeysTick3875137551537175793_33ca22626dc7e81b, &__wrap__FuncbuiltinTickkeysTick3875137551537175793_33ca22626dc7e81b },
+    { 0xa51a880d594e91fd, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c },
+    { 0x44ce141d96d6ad50, false, (void*)&_FuncbuiltinTickcloneTick9435759932231011550_ee366d7f255d762c, &__wrap__FuncbuiltinTickcloneTick9435759932231011550_ee366d7f255d762c },
+    { 0x96b3378a2fafa225, true, (void*)&_FuncbuiltinTickclone_to_moveTick17180087396728260876_764d64f493297fbd, &__wrap__FuncbuiltinTickclone_to_moveTick17180087396728260876_764d64f493297fbd },
+    { 0x16013ca08e159d36, true, (void*)&_FuncbuiltinTickto_table_moveTick3386430563931768014_b8e7916495b20880, &__wrap__FuncbuiltinTickto_table_moveTick3386430563931768014_b8e7916495b20880 },
+    { 0x942d021d77d413f7, false, (void*)&_FuncbuiltinTickinsertTick10959621454228962049_51719e0c1c9dcb16, &__wrap__FuncbuiltinTickinsertTick10959621454228962049_51719e0c1c9dcb16 },
+    { 0xbdded0fa8a5c04ef, true, (void*)&_FuncbuiltinTickkeysTick17388619793938508994_779929c46c1ffcc4, &__wrap__FuncbuiltinTickkeysTick17388619793938508994_779929c46c1ffcc4 },
+    { 0x7964cdf0a208493a, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_6502344c30938e9b },
+    { 0x22292dfed79642df, false, (void*)&_FuncbuiltinTickeraseTick5639988512056021548_2c82ec759a285266, &__wrap__FuncbuiltinTickeraseTick5639988512056021548_2c82ec759a285266 },
+    { 0x5c51cb37e0913516, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115 },
+    { 0x7dfb42718b878190, false, (void*)&_FuncbuiltinTickkey_existsTick16808803843923989214_268daca8bf1e4baf, &__wrap__FuncbuiltinTickkey_existsTick16808803843923989214_268daca8bf1e4baf },
+    { 0x2832d7ef64a0974f, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18 },
+    { 0x16013ca08e159d36, true, (void*)&_FuncbuiltinTickto_tableTick16490927545536556746_b8e7916495b20880, &__wrap__FuncbuiltinTickto_tableTick16490927545536556746_b8e7916495b20880 },
+    { 0xfda71aa8f02be7a9, false, (void*)&test_d99073a80fc1e46, &__wrap_test_d99073a80fc1e46 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_6558888116623468439
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,119 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14198614986706979859 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline bool _FuncTickpanic_timeTick1654070860393457125_c1d2ca1b39ebbee4 ( Context * __context__, char * const  __msg_rename_at_2_0 );
+inline bool test_b946ac42ab06776f ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool _FuncTickpanic_timeTick1654070860393457125_c1d2ca1b39ebbee4 ( Context * __context__, char * const  __msg_rename_at_2_0 )
+{
+    builtin_throw(__msg_rename_at_2_0,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return das_auto_cast<bool>::cast(false);
+}
+
+inline bool test_b946ac42ab06776f ( Context * __context__ )
+{
+    bool __libertad_rename_at_9_1 = true;
+    das_copy(__libertad_rename_at_9_1,__libertad_rename_at_9_1 || _FuncTickpanic_timeTick1654070860393457125_c1d2ca1b39ebbee4(__context__,((char *) "do not panic")));
+    DAS_SETBOOLOR((__libertad_rename_at_9_1),(_FuncTickpanic_timeTick1654070860393457125_c1d2ca1b39ebbee4(__context__,((char *) "now panic"))));
+    das_copy(__libertad_rename_at_9_1,false);
+    das_copy(__libertad_rename_at_9_1,__libertad_rename_at_9_1 && _FuncTickpanic_timeTick1654070860393457125_c1d2ca1b39ebbee4(__context__,((char *) "do not panic")));
+    DAS_SETBOOLAND((__libertad_rename_at_9_1),(_FuncTickpanic_timeTick1654070860393457125_c1d2ca1b39ebbee4(__context__,((char *) "now panic"))));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncTickpanic_timeTick1654070860393457125_c1d2ca1b39ebbee4 ( Context * __context__ ) {
+    char * const  arg_msg = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<bool>::from(_FuncTickpanic_timeTick1654070860393457125_c1d2ca1b39ebbee4(__context__, arg_msg));
+}
+static vec4f __wrap_test_b946ac42ab06776f ( Context * __context__ ) {
+    return cast<bool>::from(test_b946ac42ab06776f(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x10cd25aba8f95f2e, false, (void*)&_FuncTickpanic_timeTick1654070860393457125_c1d2ca1b39ebbee4, &__wrap__FuncTickpanic_timeTick1654070860393457125_c1d2ca1b39ebbee4 },
+    { 0x6be6a7c1956f2067, false, (void*)&test_b946ac42ab06776f, &__wrap_test_b946ac42ab06776f },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_14198614986706979859
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
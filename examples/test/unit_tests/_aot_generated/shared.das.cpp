@@ -0,0 +1,177 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_12765968544899716894 {
+
+extern TypeInfo __type_info__740cc30e5071c426;
+extern TypeInfo __type_info__6cda9e1ff0fd7f00;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __func_info__71fa795817309377_field_0 =  { Type::tTable, nullptr, nullptr, nullptr, &__type_info__740cc30e5071c426, &__type_info__6cda9e1ff0fd7f00, nullptr, nullptr, 0, 0, nullptr, 57442, 48, UINT64_C(0x445060184d80ca09), "foo", 0, 0 };
+VarInfo * __func_info__71fa795817309377_fields[1] =  { &__func_info__71fa795817309377_field_0 };
+FuncInfo __func_info__71fa795817309377 = {"invoke block<(foo:table<string aka keyT;int aka valT> const#):void> const", "", __func_info__71fa795817309377_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x71fa795817309377), 0x0 };
+TypeInfo __type_info__740cc30e5071c426 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0x740cc30e5071c426) };
+TypeInfo __type_info__6cda9e1ff0fd7f00 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x6cda9e1ff0fd7f00) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTicklockTick5909155508623381068_e2c674139499995c ( Context * __context__, TTable<char *,int32_t> const  & __Tab_rename_at_1360_0, Block DAS_COMMENT((void,TTable<char *,int32_t> const )) const  & __blk_rename_at_1360_1 );
+inline bool test_e0993b63ed5741a5 ( Context * __context__ );
+inline TTable<char *,int32_t> _FuncbuiltinTickto_table_moveTick5858896087460481804_851cc220ee3e1eba ( Context * __context__, TDim<TTuple<16,char *,int32_t>,2> & __a_rename_at_1615_3 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    TDim<TTuple<16,char *,int32_t>,2> _temp_make_local_3_13_0;
+    if ( __init_shared ) das_shared<TTable<char *,int32_t>,0x38dc1facd853dd7a>(__context__) = _FuncbuiltinTickto_table_moveTick5858896087460481804_851cc220ee3e1eba(__context__,das_arg<TDim<TTuple<16,char *,int32_t>,2>>::pass((([&]() -> TDim<TTuple<16,char *,int32_t>,2>& {
+        _temp_make_local_3_13_0(0,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+            TTuple<16,char *,int32_t> __mkt_3;
+            das_get_tuple_field<char *,0>::get(__mkt_3) = ((char *) "one");
+            das_get_tuple_field<int32_t,8>::get(__mkt_3) = 1;
+            return __mkt_3;
+        })());
+        _temp_make_local_3_13_0(1,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+            TTuple<16,char *,int32_t> __mkt_3;
+            das_get_tuple_field<char *,0>::get(__mkt_3) = ((char *) "two");
+            das_get_tuple_field<int32_t,8>::get(__mkt_3) = 2;
+            return __mkt_3;
+        })());
+        return _temp_make_local_3_13_0;
+    })())));/*g_foo*/
+}
+
+inline void _FuncbuiltinTicklockTick5909155508623381068_e2c674139499995c ( Context * __context__, TTable<char *,int32_t> const  &  __Tab_rename_at_1360_0, Block DAS_COMMENT((void,TTable<char *,int32_t> const )) const  &  __blk_rename_at_1360_1 )
+{
+    builtin_table_lock(__Tab_rename_at_1360_0,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    das_invoke<void>::invoke<TTable<char *,int32_t> const  &>(__context__,nullptr,__blk_rename_at_1360_1,das_cast<TTable<char *,int32_t> const >::cast(__Tab_rename_at_1360_0));
+    builtin_table_unlock(__Tab_rename_at_1360_0,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline bool test_e0993b63ed5741a5 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,96,"test " DAS_FILE_LINE);
+{
+    _FuncbuiltinTicklockTick5909155508623381068_e2c674139499995c(__context__,das_shared<TTable<char *,int32_t>,0x38dc1facd853dd7a>(__context__) /*g_foo*/,das_make_block<void,TTable<char *,int32_t> const  &>(__context__,80,0,&__func_info__71fa795817309377,[&](TTable<char *,int32_t> const  & __foo_rename_at_8_2) -> void{
+        DAS_ASSERT((das_null_coalescing<int32_t>::get(TTable<char *,int32_t>::safe_index(&(__foo_rename_at_8_2),((char *) "one"),__context__),0) == 1));
+        DAS_ASSERT((das_null_coalescing<int32_t>::get(TTable<char *,int32_t>::safe_index(&(__foo_rename_at_8_2),((char *) "two"),__context__),0) == 2));
+        DAS_ASSERT((das_null_coalescing<int32_t>::get(TTable<char *,int32_t>::safe_index(&(__foo_rename_at_8_2),((char *) "three"),__context__),0) == 0));
+    }));
+    return das_auto_cast<bool>::cast(true);
+}}
+
+inline TTable<char *,int32_t> _FuncbuiltinTickto_table_moveTick5858896087460481804_851cc220ee3e1eba ( Context * __context__, TDim<TTuple<16,char *,int32_t>,2> &  __a_rename_at_1615_3 )
+{
+    TTable<char *,int32_t> __tab_rename_at_1616_4;das_zero(__tab_rename_at_1616_4);
+    {
+        bool __need_loop_1618 = true;
+        // x: tuple<string aka keyT;int aka valT>&
+        das_iterator<TDim<TTuple<16,char *,int32_t>,2>> __x_iterator(__a_rename_at_1615_3);
+        TTuple<16,char *,int32_t> * __x_rename_at_1618_5;
+        __need_loop_1618 = __x_iterator.first(__context__,(__x_rename_at_1618_5)) && __need_loop_1618;
+        for ( ; __need_loop_1618 ; __need_loop_1618 = __x_iterator.next(__context__,(__x_rename_at_1618_5)) )
+        {
+            das_copy(__tab_rename_at_1616_4(das_get_tuple_field<char *,0>::get((*__x_rename_at_1618_5)),__context__),das_get_tuple_field<int32_t,8>::get((*__x_rename_at_1618_5)));
+        }
+        __x_iterator.close(__context__,(__x_rename_at_1618_5));
+    };
+    return /* <- */ das_auto_cast_move<TTable<char *,int32_t>>::cast(__tab_rename_at_1616_4);
+}
+static vec4f __wrap__FuncbuiltinTicklockTick5909155508623381068_e2c674139499995c ( Context * __context__ ) {
+    TTable<char *,int32_t> const  &  arg_Tab = cast_aot_arg<TTable<char *,int32_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    Block DAS_COMMENT((void,TTable<char *,int32_t> const )) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((void,TTable<char *,int32_t> const )) const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTicklockTick5909155508623381068_e2c674139499995c(__context__, arg_Tab, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap_test_e0993b63ed5741a5 ( Context * __context__ ) {
+    return cast<bool>::from(test_e0993b63ed5741a5(__context__));
+}
+static vec4f __wrap__FuncbuiltinTickto_table_moveTick5858896087460481804_851cc220ee3e1eba ( Context * __context__ ) {
+    TDim<TTuple<16,char *,int32_t>,2> &  arg_a = cast_aot_arg<TDim<TTuple<16,char *,int32_t>,2> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TTable<char *,int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_table_moveTick5858896087460481804_851cc220ee3e1eba(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x36f9d862b08b13e9, false, (void*)&_FuncbuiltinTicklockTick5909155508623381068_e2c674139499995c, &__wrap__FuncbuiltinTicklockTick5909155508623381068_e2c674139499995c },
+    { 0x1d2407ff88d2dfc5, false, (void*)&test_e0993b63ed5741a5, &__wrap_test_e0993b63ed5741a5 },
+    { 0xb14eb7f798510893, true, (void*)&_FuncbuiltinTickto_table_moveTick5858896087460481804_851cc220ee3e1eba, &__wrap__FuncbuiltinTickto_table_moveTick5858896087460481804_851cc220ee3e1eba },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x9d02a7581ec59d26, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_12765968544899716894
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,449 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_2868872267801963971 {
+
+namespace  { struct A; };
+namespace  {
+
+struct A {
+    void * __rtti;
+    Func DAS_COMMENT((void,A)) __finalize;
+    int32_t x;
+};
+static_assert(sizeof(A)==24,"structure size mismatch with DAS");
+static_assert(offsetof(A,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(A,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(A,x)==16,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__e622630797faee04;
+extern TypeInfo __type_info__fb840f07aa01bc59;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __struct_info__e622630797faee04_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xdb1e26ce5ebaa78e), "__rtti", 0, 3 };
+TypeInfo * __type_info__fccae31e985a652e_arg_types_var_16582925662197313028[1] = { &__type_info__fb840f07aa01bc59 };
+const char * __type_info__fccae31e985a652e_arg_names_var_16582925662197313028[1] = { "self" };
+VarInfo __struct_info__e622630797faee04_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__fccae31e985a652e_arg_types_var_16582925662197313028, __type_info__fccae31e985a652e_arg_names_var_16582925662197313028, 1, 0, nullptr, 12, 8, UINT64_C(0xfccae31e985a652e), "__finalize", 8, 0 };
+VarInfo __struct_info__e622630797faee04_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x35b3cedb2fe2dc4d), "x", 16, 0 };
+VarInfo * __struct_info__e622630797faee04_fields[3] =  { &__struct_info__e622630797faee04_field_0, &__struct_info__e622630797faee04_field_1, &__struct_info__e622630797faee04_field_2 };
+StructInfo __struct_info__e622630797faee04 = {"A", "", 13, __struct_info__e622630797faee04_fields, 3, 24, UINT64_C(0xaf63fc4c860222ec), nullptr, UINT64_C(0xe622630797faee04), 0 };
+TypeInfo __type_info__fb840f07aa01bc59 = { Type::tStructure, &__struct_info__e622630797faee04, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 24, UINT64_C(0xfb840f07aa01bc59) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void finalize_2ba5c4cc8991431e ( Context * __context__, A & ____this_rename_at_84_0 );
+inline bool test_shl_scalar_2df1367338653123 ( Context * __context__ );
+inline bool test_rotational_shifts_e2ebbd701f0dda07 ( Context * __context__ );
+inline bool test_vector_shifts_24694ec38815c9b2 ( Context * __context__ );
+inline void _FuncA_0x27___finalize_407f80f509d88b83 ( Context * __context__, A & __self_rename_at_84_4 );
+inline A * _FuncLessLess_22116f87dbb48858 ( Context * __context__, A const  & __x_rename_at_86_5, int32_t __y_rename_at_86_6 );
+inline A * _FuncGreaterGreater_9cdc35204f1fbdc2 ( Context * __context__, A const  & __x_rename_at_87_7, int32_t __y_rename_at_87_8 );
+inline void _FuncLessLessEqu_6c3bcd8339d0bb2f ( Context * __context__, A & __x_rename_at_88_9, int32_t __y_rename_at_88_10 );
+inline void _FuncGreaterGreaterEqu_aab321b594f33f81 ( Context * __context__, A & __x_rename_at_89_11, int32_t __y_rename_at_89_12 );
+inline A * _FuncLessLess_422723f9f7c69d6 ( Context * __context__, A const  & __x_rename_at_91_13, A const  & __y_rename_at_91_14 );
+inline A * _FuncGreaterGreater_713bee7abe42aff0 ( Context * __context__, A const  & __x_rename_at_92_15, A const  & __y_rename_at_92_16 );
+inline void _FuncLessLessEqu_47a03ef7455eac5f ( Context * __context__, A & __x_rename_at_93_17, A const  & __y_rename_at_93_18 );
+inline void _FuncGreaterGreaterEqu_cec5e8a9a3f8631 ( Context * __context__, A & __x_rename_at_94_19, A const  & __y_rename_at_94_20 );
+inline bool test_all_A_shifts_4fef75c357b8a17f ( Context * __context__ );
+inline bool test_57db1402d5131c52 ( Context * __context__ );
+inline A A_b89f79d4888aeab1 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global<int32_t,0xd0e98de710feb862>(__context__) = 0;/*_0*/
+    das_global<int32_t,0xce118de70f0cd962>(__context__) = 1;/*_1*/
+    das_global<int32_t,0xc9ed8de70ae6d662>(__context__) = 2;/*_2*/
+    das_global<int32_t,0xc3118de705055462>(__context__) = 4;/*_4*/
+    das_global<int32_t,0xb6098de6fa6d6062>(__context__) = 8;/*_8*/
+    das_global<int32_t,0x16b74a933cdf7fa1>(__context__) = 30;/*_30*/
+    das_global<int32_t,0x16ba2e933ce185e4>(__context__) = 31;/*_31*/
+    das_global<int32_t,0x16b02e933cd9315f>(__context__) = 32;/*_32*/
+    das_global<int32_t,0x16b352933cdba462>(__context__) = 33;/*_33*/
+    das_global<int32_t,0x16a326933cce996b>(__context__) = 36;/*_36*/
+}
+
+inline void finalize_2ba5c4cc8991431e ( Context * __context__, A &  ____this_rename_at_84_0 )
+{
+    memset((void*)&(____this_rename_at_84_0), 0, 24);
+}
+
+inline bool test_shl_scalar_2df1367338653123 ( Context * __context__ )
+{
+    DAS_ASSERT(((SimPolicy<int32_t>::BinShl(1,das_global<int32_t,0xce118de70f0cd962>(__context__) /*_1*/,*__context__,nullptr)) == 2));
+    DAS_ASSERT(((SimPolicy<int32_t>::BinShl(1,das_global<int32_t,0x16ba2e933ce185e4>(__context__) /*_31*/,*__context__,nullptr)) == -2147483648));
+    DAS_ASSERT(((SimPolicy<uint32_t>::BinShl(0xffffffffu,uint32_t(das_global<int32_t,0xd0e98de710feb862>(__context__) /*_0*/),*__context__,nullptr)) == 0xffffffffu));
+    DAS_ASSERT(((SimPolicy<int32_t>::BinShl(1,das_global<int32_t,0x16b02e933cd9315f>(__context__) /*_32*/,*__context__,nullptr)) == 1));
+    DAS_ASSERT(((SimPolicy<uint32_t>::BinShl(0x1u,uint32_t(-das_global<int32_t,0xce118de70f0cd962>(__context__) /*_1*/),*__context__,nullptr)) == 0x80000000u));
+    DAS_ASSERT(((SimPolicy<int32_t>::BinShr(-8,das_global<int32_t,0xce118de70f0cd962>(__context__) /*_1*/,*__context__,nullptr)) == -das_global<int32_t,0xc3118de705055462>(__context__) /*_4*/));
+    DAS_ASSERT(((SimPolicy<int32_t>::BinShr(-8,das_global<int32_t,0x16ba2e933ce185e4>(__context__) /*_31*/,*__context__,nullptr)) == -das_global<int32_t,0xce118de70f0cd962>(__context__) /*_1*/));
+    DAS_ASSERT(((SimPolicy<int32_t>::BinShr(-8,das_global<int32_t,0x16b02e933cd9315f>(__context__) /*_32*/,*__context__,nullptr)) == -das_global<int32_t,0xb6098de6fa6d6062>(__context__) /*_8*/));
+    DAS_ASSERT(((SimPolicy<int32_t>::BinShr(-8,-das_global<int32_t,0xce118de70f0cd962>(__context__) /*_1*/,*__context__,nullptr)) == -das_global<int32_t,0xce118de70f0cd962>(__context__) /*_1*/));
+    DAS_ASSERT(((SimPolicy<uint32_t>::BinShr(0x80000000u,uint32_t(das_global<int32_t,0xce118de70f0cd962>(__context__) /*_1*/),*__context__,nullptr)) == 0x40000000u));
+    DAS_ASSERT(((SimPolicy<uint32_t>::BinShr(0x80000000u,uint32_t(das_global<int32_t,0x16ba2e933ce185e4>(__context__) /*_31*/),*__context__,nullptr)) == 0x1u));
+    DAS_ASSERT(((SimPolicy<uint32_t>::BinShr(0x80000000u,uint32_t(das_global<int32_t,0x16b02e933cd9315f>(__context__) /*_32*/),*__context__,nullptr)) == 0x80000000u));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline bool test_rotational_shifts_e2ebbd701f0dda07 ( Context * __context__ )
+{
+    DAS_ASSERT(((SimPolicy<uint32_t>::BinRotl(0x12345678u,uint32_t(das_global<int32_t,0xc3118de705055462>(__context__) /*_4*/),*__context__,nullptr)) == 0x23456781u));
+    DAS_ASSERT(((SimPolicy<uint32_t>::BinRotl(0x12345678u,uint32_t(das_global<int32_t,0x16a326933cce996b>(__context__) /*_36*/),*__context__,nullptr)) == 0x23456781u));
+    DAS_ASSERT(((SimPolicy<uint32_t>::BinRotl(0x12345678u,uint32_t(das_global<int32_t,0xd0e98de710feb862>(__context__) /*_0*/),*__context__,nullptr)) == 0x12345678u));
+    DAS_ASSERT(((SimPolicy<uint32_t>::BinRotr(0x12345678u,uint32_t(das_global<int32_t,0xd0e98de710feb862>(__context__) /*_0*/),*__context__,nullptr)) == 0x12345678u));
+    uint32_t __x1_rename_at_46_1 = 0x12345678u;
+    SimPolicy<uint32_t>::SetBinRotr(__x1_rename_at_46_1,uint32_t(das_global<int32_t,0xd0e98de710feb862>(__context__) /*_0*/),*__context__,nullptr);
+    DAS_ASSERT((__x1_rename_at_46_1 == 0x12345678u));
+    SimPolicy<uint32_t>::SetBinRotl(__x1_rename_at_46_1,uint32_t(das_global<int32_t,0xd0e98de710feb862>(__context__) /*_0*/),*__context__,nullptr);
+    DAS_ASSERT((__x1_rename_at_46_1 == 0x12345678u));
+    SimPolicy<uint32_t>::SetBinRotr(__x1_rename_at_46_1,uint32_t(das_global<int32_t,0xc3118de705055462>(__context__) /*_4*/),*__context__,nullptr);
+    DAS_ASSERT((__x1_rename_at_46_1 == 0x81234567u));
+    uint32_t __x2_rename_at_54_2 = 0x12345678u;
+    SimPolicy<uint32_t>::SetBinRotl(__x2_rename_at_54_2,uint32_t(das_global<int32_t,0x16a326933cce996b>(__context__) /*_36*/),*__context__,nullptr);
+    DAS_ASSERT((__x2_rename_at_54_2 == 0x23456781u));
+    uint32_t __x3_rename_at_57_3 = 0x12345678u;
+    SimPolicy<uint32_t>::SetBinRotl(__x3_rename_at_57_3,uint32_t(-das_global<int32_t,0xc3118de705055462>(__context__) /*_4*/),*__context__,nullptr);
+    DAS_ASSERT((__x3_rename_at_57_3 == 0x81234567u));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline bool test_vector_shifts_24694ec38815c9b2 ( Context * __context__ )
+{
+    DAS_ASSERT((SimPolicy<int2>::Equ((SimPolicy<int2>::BinShl(int2(-8,16),cast<int32_t>::from(das_global<int32_t,0xc9ed8de70ae6d662>(__context__) /*_2*/),*__context__,nullptr)),int2(-32,64),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<int2>::Equ((SimPolicy<int2>::BinShr(int2(-8,16),cast<int32_t>::from(-das_global<int32_t,0x16b74a933cdf7fa1>(__context__) /*_30*/),*__context__,nullptr)),int2(-2,4),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<int3>::Equ((SimPolicy<int3>::BinShr(int3(-1,2147483647,-2147483648),cast<int32_t>::from(-das_global<int32_t,0x16ba2e933ce185e4>(__context__) /*_31*/),*__context__,nullptr)),int3(-1,1073741823,-1073741824),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<uint4>::Equ((SimPolicy<uint4>::BinShr(uint4(2147483648,3221225472,3758096384,4026531840),cast<int32_t>::from(das_global<int32_t,0xc9ed8de70ae6d662>(__context__) /*_2*/),*__context__,nullptr)),uint4(536870912,805306368,939524096,1006632960),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<uint2>::Equ((SimPolicy<uint2>::BinShl(uint2(4294967295,305419896),cast<int32_t>::from(das_global<int32_t,0xd0e98de710feb862>(__context__) /*_0*/),*__context__,nullptr)),uint2(4294967295,305419896),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<uint2>::Equ((SimPolicy<uint2>::BinShr(uint2(4294967295,305419896),cast<int32_t>::from(das_global<int32_t,0x16b352933cdba462>(__context__) /*_33*/),*__context__,nullptr)),uint2(2147483647,152709948),*__context__,nullptr)));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline void _FuncA_0x27___finalize_407f80f509d88b83 ( Context * __context__, A &  __self_rename_at_84_4 )
+{
+    finalize_2ba5c4cc8991431e(__context__,das_arg<A>::pass(__self_rename_at_84_4));
+}
+
+inline A * _FuncLessLess_22116f87dbb48858 ( Context * __context__, A const  &  __x_rename_at_86_5, int32_t __y_rename_at_86_6 )
+{
+    return das_auto_cast<A *>::cast(das_ascend<A,A>::make(__context__,nullptr,(([&]() -> A {
+        A __mks_86 = A_b89f79d4888aeab1(__context__);
+        das_copy((__mks_86.x),((SimPolicy<int32_t>::BinShl(__x_rename_at_86_5.x,__y_rename_at_86_6,*__context__,nullptr))));
+        return __mks_86;
+    })())));
+}
+
+inline A * _FuncGreaterGreater_9cdc35204f1fbdc2 ( Context * __context__, A const  &  __x_rename_at_87_7, int32_t __y_rename_at_87_8 )
+{
+    return das_auto_cast<A *>::cast(das_ascend<A,A>::make(__context__,nullptr,(([&]() -> A {
+        A __mks_87 = A_b89f79d4888aeab1(__context__);
+        das_copy((__mks_87.x),((SimPolicy<int32_t>::BinShr(__x_rename_at_87_7.x,__y_rename_at_87_8,*__context__,nullptr))));
+        return __mks_87;
+    })())));
+}
+
+inline void _FuncLessLessEqu_6c3bcd8339d0bb2f ( Context * __context__, A &  __x_rename_at_88_9, int32_t __y_rename_at_88_10 )
+{
+    SimPolicy<int32_t>::SetBinShl(__x_rename_at_88_9.x,__y_rename_at_88_10,*__context__,nullptr);
+}
+
+inline void _FuncGreaterGreaterEqu_aab321b594f33f81 ( Context * __context__, A &  __x_rename_at_89_11, int32_t __y_rename_at_89_12 )
+{
+    SimPolicy<int32_t>::SetBinShr(__x_rename_at_89_11.x,__y_rename_at_89_12,*__context__,nullptr);
+}
+
+inline A * _FuncLessLess_422723f9f7c69d6 ( Context * __context__, A const  &  __x_rename_at_91_13, A const  &  __y_rename_at_91_14 )
+{
+    return das_auto_cast<A *>::cast(das_ascend<A,A>::make(__context__,nullptr,(([&]() -> A {
+        A __mks_91 = A_b89f79d4888aeab1(__context__);
+        das_copy((__mks_91.x),((SimPolicy<int32_t>::BinShl(__x_rename_at_91_13.x,__y_rename_at_91_14.x,*__context__,nullptr))));
+        return __mks_91;
+    })())));
+}
+
+inline A * _FuncGreaterGreater_713bee7abe42aff0 ( Context * __context__, A const  &  __x_rename_at_92_15, A const  &  __y_rename_at_92_16 )
+{
+    return das_auto_cast<A *>::cast(das_ascend<A,A>::make(__context__,nullptr,(([&]() -> A {
+        A __mks_92 = A_b89f79d4888aeab1(__context__);
+        das_copy((__mks_92.x),((SimPolicy<int32_t>::BinShr(__x_rename_at_92_15.x,__y_rename_at_92_16.x,*__context__,nullptr))));
+        return __mks_92;
+    })())));
+}
+
+inline void _FuncLessLessEqu_47a03ef7455eac5f ( Context * __context__, A &  __x_rename_at_93_17, A const  &  __y_rename_at_93_18 )
+{
+    SimPolicy<int32_t>::SetBinShl(__x_rename_at_93_17.x,__y_rename_at_93_18.x,*__context__,nullptr);
+}
+
+inline void _FuncGreaterGreaterEqu_cec5e8a9a3f8631 ( Context * __context__, A &  __x_rename_at_94_19, A const  &  __y_rename_at_94_20 )
+{
+    SimPolicy<int32_t>::SetBinShr(__x_rename_at_94_19.x,__y_rename_at_94_20.x,*__context__,nullptr);
+}
+
+inline bool test_all_A_shifts_4fef75c357b8a17f ( Context * __context__ )
+{
+    A * __a1_rename_at_97_21 = ((A *)das_ascend<A,A>::make(__context__,nullptr,(([&]() -> A {
+        A __mks_97 = A_b89f79d4888aeab1(__context__);
+        das_copy((__mks_97.x),(8));
+        return __mks_97;
+    })())));
+    A * __neg_a_rename_at_98_22 = ((A *)das_ascend<A,A>::make(__context__,nullptr,(([&]() -> A {
+        A __mks_98 = A_b89f79d4888aeab1(__context__);
+        das_copy((__mks_98.x),(-8));
+        return __mks_98;
+    })())));
+    DAS_ASSERT(((_FuncLessLess_22116f87dbb48858(__context__,das_deref(__context__,__a1_rename_at_97_21,__FILE__,__LINE__),das_global<int32_t,0xce118de70f0cd962>(__context__) /*_1*/))->x == 16));
+    DAS_ASSERT(((_FuncGreaterGreater_9cdc35204f1fbdc2(__context__,das_deref(__context__,__a1_rename_at_97_21,__FILE__,__LINE__),das_global<int32_t,0xce118de70f0cd962>(__context__) /*_1*/))->x == 4));
+    DAS_ASSERT(((_FuncGreaterGreater_9cdc35204f1fbdc2(__context__,das_deref(__context__,__neg_a_rename_at_98_22,__FILE__,__LINE__),das_global<int32_t,0xce118de70f0cd962>(__context__) /*_1*/))->x == -4));
+    DAS_ASSERT(((_FuncLessLess_22116f87dbb48858(__context__,das_deref(__context__,__a1_rename_at_97_21,__FILE__,__LINE__),das_global<int32_t,0x16b02e933cd9315f>(__context__) /*_32*/))->x == 8));
+    DAS_ASSERT(((_FuncGreaterGreater_9cdc35204f1fbdc2(__context__,das_deref(__context__,__a1_rename_at_97_21,__FILE__,__LINE__),das_global<int32_t,0x16b352933cdba462>(__context__) /*_33*/))->x == 4));
+    A * __a2_rename_at_108_23 = das_ascend<A,A>::make(__context__,nullptr,(([&]() -> A {
+        A __mks_108 = A_b89f79d4888aeab1(__context__);
+        das_copy((__mks_108.x),(8));
+        return __mks_108;
+    })()));
+    _FuncLessLessEqu_6c3bcd8339d0bb2f(__context__,das_arg<A>::pass(das_deref(__context__,__a2_rename_at_108_23,__FILE__,__LINE__)),das_global<int32_t,0xce118de70f0cd962>(__context__) /*_1*/);
+    DAS_ASSERT((__a2_rename_at_108_23->x == 16));
+    A * __a3_rename_at_112_24 = das_ascend<A,A>::make(__context__,nullptr,(([&]() -> A {
+        A __mks_112 = A_b89f79d4888aeab1(__context__);
+        das_copy((__mks_112.x),(16));
+        return __mks_112;
+    })()));
+    _FuncGreaterGreaterEqu_aab321b594f33f81(__context__,das_arg<A>::pass(das_deref(__context__,__a3_rename_at_112_24,__FILE__,__LINE__)),das_global<int32_t,0xc9ed8de70ae6d662>(__context__) /*_2*/);
+    DAS_ASSERT((__a3_rename_at_112_24->x == 4));
+    A * __a4_rename_at_116_25 = das_ascend<A,A>::make(__context__,nullptr,(([&]() -> A {
+        A __mks_116 = A_b89f79d4888aeab1(__context__);
+        das_copy((__mks_116.x),(1));
+        return __mks_116;
+    })()));
+    _FuncLessLessEqu_6c3bcd8339d0bb2f(__context__,das_arg<A>::pass(das_deref(__context__,__a4_rename_at_116_25,__FILE__,__LINE__)),das_global<int32_t,0x16ba2e933ce185e4>(__context__) /*_31*/);
+    DAS_ASSERT((__a4_rename_at_116_25->x == -2147483648));
+    _FuncLessLessEqu_6c3bcd8339d0bb2f(__context__,das_arg<A>::pass(das_deref(__context__,__a4_rename_at_116_25,__FILE__,__LINE__)),das_global<int32_t,0xce118de70f0cd962>(__context__) /*_1*/);
+    DAS_ASSERT((__a4_rename_at_116_25->x == 0));
+    A * __a5_rename_at_123_26 = ((A *)das_ascend<A,A>::make(__context__,nullptr,(([&]() -> A {
+        A __mks_123 = A_b89f79d4888aeab1(__context__);
+        das_copy((__mks_123.x),(8));
+        return __mks_123;
+    })())));
+    A * __shift_a_rename_at_124_27 = ((A *)das_ascend<A,A>::make(__context__,nullptr,(([&]() -> A {
+        A __mks_124 = A_b89f79d4888aeab1(__context__);
+        das_copy((__mks_124.x),(2));
+        return __mks_124;
+    })())));
+    A * __zero_a_rename_at_125_28 = ((A *)das_ascend<A,A>::make(__context__,nullptr,(([&]() -> A {
+        A __mks_125 = A_b89f79d4888aeab1(__context__);
+        das_copy((__mks_125.x),(0));
+        return __mks_125;
+    })())));
+    DAS_ASSERT(((_FuncLessLess_422723f9f7c69d6(__context__,das_deref(__context__,__a5_rename_at_123_26,__FILE__,__LINE__),das_deref(__context__,__shift_a_rename_at_124_27,__FILE__,__LINE__)))->x == 32));
+    DAS_ASSERT(((_FuncGreaterGreater_713bee7abe42aff0(__context__,das_deref(__context__,__a5_rename_at_123_26,__FILE__,__LINE__),das_deref(__context__,__shift_a_rename_at_124_27,__FILE__,__LINE__)))->x == 2));
+    DAS_ASSERT(((_FuncLessLess_422723f9f7c69d6(__context__,das_deref(__context__,__a5_rename_at_123_26,__FILE__,__LINE__),das_deref(__context__,__zero_a_rename_at_125_28,__FILE__,__LINE__)))->x == 8));
+    DAS_ASSERT(((_FuncGreaterGreater_713bee7abe42aff0(__context__,das_deref(__context__,__neg_a_rename_at_98_22,__FILE__,__LINE__),das_deref(__context__,__shift_a_rename_at_124_27,__FILE__,__LINE__)))->x == -2));
+    A * __a6_rename_at_134_29 = das_ascend<A,A>::make(__context__,nullptr,(([&]() -> A {
+        A __mks_134 = A_b89f79d4888aeab1(__context__);
+        das_copy((__mks_134.x),(16));
+        return __mks_134;
+    })()));
+    A * __shift_a2_rename_at_135_30 = ((A *)das_ascend<A,A>::make(__context__,nullptr,(([&]() -> A {
+        A __mks_135 = A_b89f79d4888aeab1(__context__);
+        das_copy((__mks_135.x),(3));
+        return __mks_135;
+    })())));
+    _FuncLessLessEqu_47a03ef7455eac5f(__context__,das_arg<A>::pass(das_deref(__context__,__a6_rename_at_134_29,__FILE__,__LINE__)),das_deref(__context__,__shift_a2_rename_at_135_30,__FILE__,__LINE__));
+    DAS_ASSERT((__a6_rename_at_134_29->x == 128));
+    _FuncGreaterGreaterEqu_cec5e8a9a3f8631(__context__,das_arg<A>::pass(das_deref(__context__,__a6_rename_at_134_29,__FILE__,__LINE__)),das_deref(__context__,__shift_a2_rename_at_135_30,__FILE__,__LINE__));
+    DAS_ASSERT((__a6_rename_at_134_29->x == 16));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline bool test_57db1402d5131c52 ( Context * __context__ )
+{
+    test_shl_scalar_2df1367338653123(__context__);
+    test_rotational_shifts_e2ebbd701f0dda07(__context__);
+    test_vector_shifts_24694ec38815c9b2(__context__);
+    test_all_A_shifts_4fef75c357b8a17f(__context__);
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline A A_b89f79d4888aeab1 ( Context * __context__ )
+{
+    return /* <- */ das_auto_cast_move<A>::cast((([&]() -> A {
+        A __mks_84;
+        das_zero(__mks_84);
+        das_copy((__mks_84.__rtti),(((void *)(&__type_info__fb840f07aa01bc59))));
+        das_copy((__mks_84.__finalize),(Func(__context__->fnByMangledName(/*A'__finalize S<A>*/ 0x637fa5d74f647d67))));
+        return __mks_84;
+    })()));
+}
+static vec4f __wrap_finalize_2ba5c4cc8991431e ( Context * __context__ ) {
+    A &  arg___this = cast_aot_arg<A & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_2ba5c4cc8991431e(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_test_shl_scalar_2df1367338653123 ( Context * __context__ ) {
+    return cast<bool>::from(test_shl_scalar_2df1367338653123(__context__));
+}
+static vec4f __wrap_test_rotational_shifts_e2ebbd701f0dda07 ( Context * __context__ ) {
+    return cast<bool>::from(test_rotational_shifts_e2ebbd701f0dda07(__context__));
+}
+static vec4f __wrap_test_vector_shifts_24694ec38815c9b2 ( Context * __context__ ) {
+    return cast<bool>::from(test_vector_shifts_24694ec38815c9b2(__context__));
+}
+static vec4f __wrap__FuncA_0x27___finalize_407f80f509d88b83 ( Context * __context__ ) {
+    A &  arg_self = cast_aot_arg<A & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncA_0x27___finalize_407f80f509d88b83(__context__, arg_self);
+    return v_zero();
+}
+static vec4f __wrap__FuncLessLess_22116f87dbb48858 ( Context * __context__ ) {
+    A const  &  arg_x = cast_aot_arg<A const  & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_y = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<A *>::from(_FuncLessLess_22116f87dbb48858(__context__, arg_x, arg_y));
+}
+static vec4f __wrap__FuncGreaterGreater_9cdc35204f1fbdc2 ( Context * __context__ ) {
+    A const  &  arg_x = cast_aot_arg<A const  & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_y = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<A *>::from(_FuncGreaterGreater_9cdc35204f1fbdc2(__context__, arg_x, arg_y));
+}
+static vec4f __wrap__FuncLessLessEqu_6c3bcd8339d0bb2f ( Context * __context__ ) {
+    A &  arg_x = cast_aot_arg<A & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_y = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncLessLessEqu_6c3bcd8339d0bb2f(__context__, arg_x, arg_y);
+    return v_zero();
+}
+static vec4f __wrap__FuncGreaterGreaterEqu_aab321b594f33f81 ( Context * __context__ ) {
+    A &  arg_x = cast_aot_arg<A & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_y = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncGreaterGreaterEqu_aab321b594f33f81(__context__, arg_x, arg_y);
+    return v_zero();
+}
+static vec4f __wrap__FuncLessLess_422723f9f7c69d6 ( Context * __context__ ) {
+    A const  &  arg_x = cast_aot_arg<A const  & >::to(*__context__,__context__->abiArguments()[0]);
+    A const  &  arg_y = cast_aot_arg<A const  & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<A *>::from(_FuncLessLess_422723f9f7c69d6(__context__, arg_x, arg_y));
+}
+static vec4f __wrap__FuncGreaterGreater_713bee7abe42aff0 ( Context * __context__ ) {
+    A const  &  arg_x = cast_aot_arg<A const  & >::to(*__context__,__context__->abiArguments()[0]);
+    A const  &  arg_y = cast_aot_arg<A const  & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<A *>::from(_FuncGreaterGreater_713bee7abe42aff0(__context__, arg_x, arg_y));
+}
+static vec4f __wrap__FuncLessLessEqu_47a03ef7455eac5f ( Context * __context__ ) {
+    A &  arg_x = cast_aot_arg<A & >::to(*__context__,__context__->abiArguments()[0]);
+    A const  &  arg_y = cast_aot_arg<A const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncLessLessEqu_47a03ef7455eac5f(__context__, arg_x, arg_y);
+    return v_zero();
+}
+static vec4f __wrap__FuncGreaterGreaterEqu_cec5e8a9a3f8631 ( Context * __context__ ) {
+    A &  arg_x = cast_aot_arg<A & >::to(*__context__,__context__->abiArguments()[0]);
+    A const  &  arg_y = cast_aot_arg<A const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncGreaterGreaterEqu_cec5e8a9a3f8631(__context__, arg_x, arg_y);
+    return v_zero();
+}
+static vec4f __wrap_test_all_A_shifts_4fef75c357b8a17f ( Context * __context__ ) {
+    return cast<bool>::from(test_all_A_shifts_4fef75c357b8a17f(__context__));
+}
+static vec4f __wrap_test_57db1402d5131c52 ( Context * __context__ ) {
+    return cast<bool>::from(test_57db1402d5131c52(__context__));
+}
+static vec4f __wrap_A_b89f79d4888aeab1 ( Context * __context__ ) {
+    *((A *) __context__->abiCMRES) = A_b89f79d4888aeab1(__context__);
+    return v_zero();
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x8e68c236fbdca1fa, false, (void*)&finalize_2ba5c4cc8991431e, &__wrap_finalize_2ba5c4cc8991431e },
+    { 0x1aabace131f672db, false, (void*)&test_shl_scalar_2df1367338653123, &__wrap_test_shl_scalar_2df1367338653123 },
+    { 0xebc6d2ef04e8876, false, (void*)&test_rotational_shifts_e2ebbd701f0dda07, &__wrap_test_rotational_shifts_e2ebbd701f0dda07 },
+    { 0xb559fb9586357ecd, false, (void*)&test_vector_shifts_24694ec38815c9b2, &__wrap_test_vector_shifts_24694ec38815c9b2 },
+    { 0x5ab9ec1657768b16, false, (void*)&_FuncA_0x27___finalize_407f80f509d88b83, &__wrap__FuncA_0x27___finalize_407f80f509d88b83 },
+    { 0x3514beee77a40136, false, (void*)&_FuncLessLess_22116f87dbb48858, &__wrap__FuncLessLess_22116f87dbb48858 },
+    { 0x378407dc883ed41f, false, (void*)&_FuncGreaterGreater_9cdc35204f1fbdc2, &__wrap__FuncGreaterGreater_9cdc35204f1fbdc2 },
+    { 0x33c229f2bdf72520, false, (void*)&_FuncLessLessEqu_6c3bcd8339d0bb2f, &__wrap__FuncLessLessEqu_6c3bcd8339d0bb2f },
+    { 0xe2ada04c4c6758d2, false, (void*)&_FuncGreaterGreaterEqu_aab321b594f33f81, &__wrap__FuncGreaterGreaterEqu_aab321b594f33f81 },
+    { 0x72792e7914cef5f, false, (void*)&_FuncLessLess_422723f9f7c69d6, &__wrap__FuncLessLess_422723f9f7c69d6 },
+    { 0x5adf87da465420d6, false, (void*)&_FuncGreaterGreater_713bee7abe42aff0, &__wrap__FuncGreaterGreater_713bee7abe42aff0 },
+    { 0x33dbfb3ec77c5a8c, false, (void*)&_FuncLessLessEqu_47a03ef7455eac5f, &__wrap__FuncLessLessEqu_47a03ef7455eac5f },
+    { 0xe5494170de36755d, false, (void*)&_FuncGreaterGreaterEqu_cec5e8a9a3f8631, &__wrap__FuncGreaterGreaterEqu_cec5e8a9a3f8631 },
+    { 0x6c6c265aab873a2b, false, (void*)&test_all_A_shifts_4fef75c357b8a17f, &__wrap_test_all_A_shifts_4fef75c357b8a17f },
+    { 0x4049e05b070ca7b5, false, (void*)&test_57db1402d5131c52, &__wrap_test_57db1402d5131c52 },
+    { 0xeb23ec3232022e70, true, (void*)&A_b89f79d4888aeab1, &__wrap_A_b89f79d4888aeab1 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0xee9a095e02959684, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_2868872267801963971
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,352 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_12881578682795524114 {
+
+// unused enumeration GooEnum
+// unused enumeration OpCode
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void clone_cf133071d3aa457e ( Context * __context__, smart_ptr_raw<TestObjectSmart> & __dest_rename_at_1121_0, smart_ptr_raw<TestObjectSmart> const  __src_rename_at_1121_1 );
+inline smart_ptr_raw<TestObjectSmart> _FuncbuiltinTickclone_to_moveTick17180087396728260876_58fc63f9a2e3abba ( Context * __context__, smart_ptr_raw<TestObjectSmart> __clone_src_rename_at_1118_2 );
+inline void clone_d854fe401eed4365 ( Context * __context__, smart_ptr_raw<TestObjectSmart> & __dest_rename_at_53_4, TestObjectSmart * const  __src_rename_at_53_5 );
+inline TestObjectSmart * _FuncbuiltinTickget_ptrTick5807679485210906136_878966099d0412f3 ( Context * __context__, smart_ptr_raw<TestObjectSmart> __src_rename_at_1924_6 );
+inline TestObjectSmart * _FuncbuiltinTickget_const_ptrTick4536782465177922409_4d82708912cf954d ( Context * __context__, smart_ptr_raw<TestObjectSmart> const  __src_rename_at_1930_7 );
+inline TestObjectSmart * inside_scope_test_519c427e03fabbf9 ( Context * __context__ );
+inline void scope_test_89d82aefd321f240 ( Context * __context__ );
+inline smart_ptr_raw<TestObjectSmart> inside_move_test_6993c6006a84f41c ( Context * __context__ );
+inline void move_test_a411ee1bee462c75 ( Context * __context__ );
+inline void ref_count_test_167c6e024631132b ( Context * __context__ );
+inline void access_test_10bcfed1cc0a6414 ( Context * __context__ );
+inline void fn_test_da72cba2a411c657 ( Context * __context__ );
+inline bool test_b9c4912e7d0b729d ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void clone_cf133071d3aa457e ( Context * __context__, smart_ptr_raw<TestObjectSmart> & __dest_rename_at_1121_0, smart_ptr_raw<TestObjectSmart> const  __src_rename_at_1121_1 )
+{
+    builtin_smart_ptr_clone(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_1121_0),das_auto_cast<smart_ptr_raw<void> const >::cast(__src_rename_at_1121_1),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline smart_ptr_raw<TestObjectSmart> _FuncbuiltinTickclone_to_moveTick17180087396728260876_58fc63f9a2e3abba ( Context * __context__, smart_ptr_raw<TestObjectSmart> __clone_src_rename_at_1118_2 )
+{
+    smart_ptr_raw<TestObjectSmart> __clone_dest_rename_at_1120_3;das_zero(__clone_dest_rename_at_1120_3);
+    clone_cf133071d3aa457e(__context__,__clone_dest_rename_at_1120_3,__clone_src_rename_at_1118_2);
+    return /* <- */ das_auto_cast_move<smart_ptr_raw<TestObjectSmart>>::cast(__clone_dest_rename_at_1120_3);
+}
+
+inline void clone_d854fe401eed4365 ( Context * __context__, smart_ptr_raw<TestObjectSmart> & __dest_rename_at_53_4, TestObjectSmart * const  __src_rename_at_53_5 )
+{
+    builtin_smart_ptr_clone_ptr(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_53_4),das_auto_cast<void * const >::cast(__src_rename_at_53_5),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline TestObjectSmart * _FuncbuiltinTickget_ptrTick5807679485210906136_878966099d0412f3 ( Context * __context__, smart_ptr_raw<TestObjectSmart> __src_rename_at_1924_6 )
+{
+    return das_auto_cast<TestObjectSmart *>::cast(das_cast<TestObjectSmart *>::cast(__src_rename_at_1924_6));
+}
+
+inline TestObjectSmart * _FuncbuiltinTickget_const_ptrTick4536782465177922409_4d82708912cf954d ( Context * __context__, smart_ptr_raw<TestObjectSmart> const  __src_rename_at_1930_7 )
+{
+    return das_auto_cast<TestObjectSmart *>::cast(das_cast<TestObjectSmart * const >::cast(__src_rename_at_1930_7));
+}
+
+inline TestObjectSmart * inside_scope_test_519c427e03fabbf9 ( Context * __context__ )
+{
+    smart_ptr_raw<TestObjectSmart> __sptr_rename_at_6_8; das_zero(__sptr_rename_at_6_8); das_move(__sptr_rename_at_6_8, das_new_handle<TestObjectSmart,true>::make(__context__));
+    DAS_VERIFY((getTotalTestObjectSmart() == 1));
+    return das_auto_cast<TestObjectSmart *>::cast(_FuncbuiltinTickget_ptrTick5807679485210906136_878966099d0412f3(__context__,__sptr_rename_at_6_8));
+}
+
+inline void scope_test_89d82aefd321f240 ( Context * __context__ )
+{
+    DAS_VERIFY((getTotalTestObjectSmart() == 0));
+    TestObjectSmart * __lostPtr_rename_at_14_9 = ((TestObjectSmart *)inside_scope_test_519c427e03fabbf9(__context__));
+    DAS_VERIFY((getTotalTestObjectSmart() == 1));
+    smart_ptr_raw<TestObjectSmart> __sptr_rename_at_17_10; das_zero(__sptr_rename_at_17_10); das_move(__sptr_rename_at_17_10, das_cast<smart_ptr_raw<TestObjectSmart>>::cast(__lostPtr_rename_at_14_9));
+    das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__sptr_rename_at_17_10);
+    DAS_VERIFY((getTotalTestObjectSmart() == 0));
+}
+
+inline smart_ptr_raw<TestObjectSmart> inside_move_test_6993c6006a84f41c ( Context * __context__ )
+{
+    smart_ptr_raw<TestObjectSmart> __t1_rename_at_25_11; memset((void*)&__t1_rename_at_25_11,0,sizeof(__t1_rename_at_25_11));
+    smart_ptr_raw<TestObjectSmart> __t2_rename_at_26_12; memset((void*)&__t2_rename_at_26_12,0,sizeof(__t2_rename_at_26_12));
+    /* finally */ auto __finally_23= das_finally([&](){
+    das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__t2_rename_at_26_12);
+    das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__t1_rename_at_25_11);
+    /* end finally */ });
+    DAS_VERIFY((getTotalTestObjectSmart() == 0));
+    __t1_rename_at_25_11; das_zero(__t1_rename_at_25_11); das_move(__t1_rename_at_25_11, das_new_handle<TestObjectSmart,true>::make(__context__));
+    __t2_rename_at_26_12; das_zero(__t2_rename_at_26_12); das_move(__t2_rename_at_26_12, __t1_rename_at_25_11);
+    DAS_ASSERT((builtin_smart_ptr_use_count(das_auto_cast<smart_ptr_raw<void> const >::cast(__t1_rename_at_25_11),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))) == 0x0u));
+    DAS_ASSERT((builtin_smart_ptr_use_count(das_auto_cast<smart_ptr_raw<void> const >::cast(__t2_rename_at_26_12),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))) == 0x1u));
+    DAS_VERIFY((getTotalTestObjectSmart() == 1));
+    return /* <- */ das_auto_cast_move<smart_ptr_raw<TestObjectSmart>>::cast(__t2_rename_at_26_12);
+}
+
+inline void move_test_a411ee1bee462c75 ( Context * __context__ )
+{
+    smart_ptr_raw<TestObjectSmart> __t_rename_at_36_13; memset((void*)&__t_rename_at_36_13,0,sizeof(__t_rename_at_36_13));
+    DAS_VERIFY((getTotalTestObjectSmart() == 0));
+    {
+        /* finally */ auto __finally_35= das_finally([&](){
+        das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__t_rename_at_36_13);
+        /* end finally */ });
+        __t_rename_at_36_13; das_zero(__t_rename_at_36_13); das_move(__t_rename_at_36_13, inside_move_test_6993c6006a84f41c(__context__));
+        DAS_VERIFY((getTotalTestObjectSmart() == 1));
+    };
+    DAS_VERIFY((getTotalTestObjectSmart() == 0));
+}
+
+inline void ref_count_test_167c6e024631132b ( Context * __context__ )
+{
+    smart_ptr_raw<TestObjectSmart> __sptr_rename_at_44_14; memset((void*)&__sptr_rename_at_44_14,0,sizeof(__sptr_rename_at_44_14));
+    TestObjectSmart * __ptr_rename_at_47_15; memset((void*)&__ptr_rename_at_47_15,0,sizeof(__ptr_rename_at_47_15));
+    TestObjectSmart * __pptr_rename_at_48_16; memset((void*)&__pptr_rename_at_48_16,0,sizeof(__pptr_rename_at_48_16));
+    smart_ptr_raw<TestObjectSmart> __qptr_rename_at_52_17; memset((void*)&__qptr_rename_at_52_17,0,sizeof(__qptr_rename_at_52_17));
+    smart_ptr_raw<TestObjectSmart> __fptr_rename_at_58_18; memset((void*)&__fptr_rename_at_58_18,0,sizeof(__fptr_rename_at_58_18));
+    /* finally */ auto __finally_42= das_finally([&](){
+    das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__fptr_rename_at_58_18);
+    das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__qptr_rename_at_52_17);
+    das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__sptr_rename_at_44_14);
+    /* end finally */ });
+    DAS_VERIFY((getTotalTestObjectSmart() == 0));
+    __sptr_rename_at_44_14; das_zero(__sptr_rename_at_44_14); das_move(__sptr_rename_at_44_14, das_new_handle<TestObjectSmart,true>::make(__context__));
+    DAS_VERIFY((getTotalTestObjectSmart() == 1));
+    DAS_ASSERT((builtin_smart_ptr_use_count(das_auto_cast<smart_ptr_raw<void> const >::cast(__sptr_rename_at_44_14),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))) == 0x1u));
+    __ptr_rename_at_47_15 = _FuncbuiltinTickget_ptrTick5807679485210906136_878966099d0412f3(__context__,__sptr_rename_at_44_14);
+    __pptr_rename_at_48_16 = 0;
+    das_copy(__pptr_rename_at_48_16,_FuncbuiltinTickget_ptrTick5807679485210906136_878966099d0412f3(__context__,__sptr_rename_at_44_14));
+    DAS_ASSERT((equ_sptr_ptr(das_auto_cast<smart_ptr_raw<void> const >::cast(__sptr_rename_at_44_14),das_auto_cast<void * const >::cast(__ptr_rename_at_47_15))));
+    DAS_ASSERT((_FuncbuiltinTickget_const_ptrTick4536782465177922409_4d82708912cf954d(__context__,__sptr_rename_at_44_14) == __ptr_rename_at_47_15));
+    das_zero(__qptr_rename_at_52_17);
+    clone_d854fe401eed4365(__context__,__qptr_rename_at_52_17,_FuncbuiltinTickget_ptrTick5807679485210906136_878966099d0412f3(__context__,__sptr_rename_at_44_14));
+    DAS_ASSERT((builtin_smart_ptr_use_count(das_auto_cast<smart_ptr_raw<void> const >::cast(__sptr_rename_at_44_14),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))) == 0x2u));
+    DAS_ASSERT((equ_sptr_ptr(das_auto_cast<smart_ptr_raw<void> const >::cast(__qptr_rename_at_52_17),das_auto_cast<void * const >::cast(__ptr_rename_at_47_15))));
+    DAS_ASSERT((_FuncbuiltinTickget_const_ptrTick4536782465177922409_4d82708912cf954d(__context__,__qptr_rename_at_52_17) == __ptr_rename_at_47_15));
+    DAS_ASSERT((equ_sptr_sptr(das_auto_cast<smart_ptr_raw<void> const >::cast(__qptr_rename_at_52_17),das_auto_cast<smart_ptr_raw<void> const >::cast(__sptr_rename_at_44_14))));
+    __fptr_rename_at_58_18; das_zero(__fptr_rename_at_58_18); das_move(__fptr_rename_at_58_18, _FuncbuiltinTickclone_to_moveTick17180087396728260876_58fc63f9a2e3abba(__context__,__qptr_rename_at_52_17));
+    DAS_ASSERT((builtin_smart_ptr_use_count(das_auto_cast<smart_ptr_raw<void> const >::cast(__sptr_rename_at_44_14),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))) == 0x3u));
+    DAS_ASSERT((nequ_sptr_ptr(das_auto_cast<smart_ptr_raw<void> const >::cast(__fptr_rename_at_58_18),das_auto_cast<void * const >::cast(nullptr))));
+    DAS_ASSERT((equ_ptr_sptr(das_auto_cast<void * const >::cast(_FuncbuiltinTickget_const_ptrTick4536782465177922409_4d82708912cf954d(__context__,__fptr_rename_at_58_18)),das_auto_cast<smart_ptr_raw<void> const >::cast(__sptr_rename_at_44_14))));
+    DAS_ASSERT((equ_sptr_sptr(das_auto_cast<smart_ptr_raw<void> const >::cast(__fptr_rename_at_58_18),das_auto_cast<smart_ptr_raw<void> const >::cast(__qptr_rename_at_52_17))));
+    DAS_ASSERT((equ_sptr_sptr(das_auto_cast<smart_ptr_raw<void> const >::cast(__fptr_rename_at_58_18),das_auto_cast<smart_ptr_raw<void> const >::cast(__sptr_rename_at_44_14))));
+    DAS_ASSERT((builtin_smart_ptr_use_count(das_auto_cast<smart_ptr_raw<void> const >::cast(__sptr_rename_at_44_14),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))) == 0x3u));
+    DAS_VERIFY((getTotalTestObjectSmart() == 1));
+    das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__sptr_rename_at_44_14);
+    DAS_VERIFY((getTotalTestObjectSmart() == 1));
+    DAS_ASSERT((builtin_smart_ptr_use_count(das_auto_cast<smart_ptr_raw<void> const >::cast(__sptr_rename_at_44_14),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))) == 0x0u));
+    DAS_ASSERT((builtin_smart_ptr_use_count(das_auto_cast<smart_ptr_raw<void> const >::cast(__qptr_rename_at_52_17),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))) == 0x2u));
+    das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__qptr_rename_at_52_17);
+    DAS_VERIFY((getTotalTestObjectSmart() == 1));
+    DAS_ASSERT((builtin_smart_ptr_use_count(das_auto_cast<smart_ptr_raw<void> const >::cast(__qptr_rename_at_52_17),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))) == 0x0u));
+    DAS_ASSERT((builtin_smart_ptr_use_count(das_auto_cast<smart_ptr_raw<void> const >::cast(__fptr_rename_at_58_18),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))) == 0x1u));
+    das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__fptr_rename_at_58_18);
+    DAS_VERIFY((getTotalTestObjectSmart() == 0));
+    DAS_ASSERT((builtin_smart_ptr_use_count(das_auto_cast<smart_ptr_raw<void> const >::cast(__fptr_rename_at_58_18),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))) == 0x0u));
+}
+
+inline void access_test_10bcfed1cc0a6414 ( Context * __context__ )
+{
+    smart_ptr_raw<TestObjectSmart> __ptr_rename_at_87_19; memset((void*)&__ptr_rename_at_87_19,0,sizeof(__ptr_rename_at_87_19));
+    int32_t __t_rename_at_89_20; memset((void*)&__t_rename_at_89_20,0,sizeof(__t_rename_at_89_20));
+    /* finally */ auto __finally_85= das_finally([&](){
+    das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__ptr_rename_at_87_19);
+    /* end finally */ });
+    DAS_VERIFY((getTotalTestObjectSmart() == 0));
+    __ptr_rename_at_87_19; das_zero(__ptr_rename_at_87_19); das_move(__ptr_rename_at_87_19, das_new_handle<TestObjectSmart,true>::make(__context__));
+    DAS_ASSERT((__ptr_rename_at_87_19->fooData /*fooData*/ == 1234));
+    __t_rename_at_89_20 = das_null_coalescing<int32_t>::get(das_safe_navigation_handle<TestObjectSmart,int32_t>::get(__ptr_rename_at_87_19,([&](const TestObjectSmart * __any) -> auto & {return __any->fooData /*fooData*/;})),1);
+    DAS_ASSERT((__t_rename_at_89_20 == 1234));
+    das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation_handle<TestObjectSmart,int32_t>::get(__ptr_rename_at_87_19,([&](const TestObjectSmart * __any) -> auto & {return __any->fooData /*fooData*/;})),__t_rename_at_89_20),13);
+    DAS_ASSERT((__ptr_rename_at_87_19->fooData /*fooData*/ == 13));
+    das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__ptr_rename_at_87_19);
+    das_copy(__t_rename_at_89_20,das_null_coalescing<int32_t>::get(das_safe_navigation_handle<TestObjectSmart,int32_t>::get(__ptr_rename_at_87_19,([&](const TestObjectSmart * __any) -> auto & {return __any->fooData /*fooData*/;})),2));
+    DAS_ASSERT((__t_rename_at_89_20 == 2));
+    das_move(__ptr_rename_at_87_19,das_new_handle<TestObjectSmart,true>::make(__context__));
+    das_move(__ptr_rename_at_87_19->first /*first*/,das_new_handle<TestObjectSmart,true>::make(__context__));
+    DAS_ASSERT((__ptr_rename_at_87_19->first /*first*/->fooData /*fooData*/ == 1234));
+    DAS_ASSERT((das_null_coalescing<int32_t>::get(das_safe_navigation_handle<TestObjectSmart,int32_t>::get(das_safe_navigation_handle_ptr<TestObjectSmart,smart_ptr_raw<TestObjectSmart>>::get(__ptr_rename_at_87_19,([&](const TestObjectSmart * __any) -> auto & {return __any->first /*first*/;})),([&](const TestObjectSmart * __any) -> auto & {return __any->fooData /*fooData*/;})),13) == 1234));
+    das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__ptr_rename_at_87_19->first /*first*/);
+    das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__ptr_rename_at_87_19);
+    DAS_VERIFY((getTotalTestObjectSmart() == 0));
+}
+
+inline void fn_test_da72cba2a411c657 ( Context * __context__ )
+{
+    smart_ptr_raw<TestObjectSmart> __ptr_rename_at_113_21; memset((void*)&__ptr_rename_at_113_21,0,sizeof(__ptr_rename_at_113_21));
+    /* finally */ auto __finally_111= das_finally([&](){
+    das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__ptr_rename_at_113_21);
+    /* end finally */ });
+    DAS_VERIFY((getTotalTestObjectSmart() == 0));
+    __ptr_rename_at_113_21; das_zero(__ptr_rename_at_113_21); das_move(__ptr_rename_at_113_21, makeTestObjectSmart());
+    DAS_ASSERT((countTestObjectSmart(__ptr_rename_at_113_21) == 0x1u));
+    DAS_VERIFY((getTotalTestObjectSmart() == 1));
+    das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__ptr_rename_at_113_21);
+    DAS_VERIFY((getTotalTestObjectSmart() == 0));
+}
+
+inline bool test_b9c4912e7d0b729d ( Context * __context__ )
+{
+    ref_count_test_167c6e024631132b(__context__);
+    move_test_a411ee1bee462c75(__context__);
+    scope_test_89d82aefd321f240(__context__);
+    access_test_10bcfed1cc0a6414(__context__);
+    fn_test_da72cba2a411c657(__context__);
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_clone_cf133071d3aa457e ( Context * __context__ ) {
+    smart_ptr_raw<TestObjectSmart> & arg_dest = cast_aot_arg<smart_ptr_raw<TestObjectSmart> &>::to(*__context__,__context__->abiArguments()[0]);
+    smart_ptr_raw<TestObjectSmart> const  arg_src = cast_aot_arg<smart_ptr_raw<TestObjectSmart> const >::to(*__context__,__context__->abiArguments()[1]);
+    clone_cf133071d3aa457e(__context__, arg_dest, arg_src);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickclone_to_moveTick17180087396728260876_58fc63f9a2e3abba ( Context * __context__ ) {
+    smart_ptr_raw<TestObjectSmart> arg_clone_src = cast_aot_arg<smart_ptr_raw<TestObjectSmart>>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<smart_ptr_raw<TestObjectSmart>>::from(_FuncbuiltinTickclone_to_moveTick17180087396728260876_58fc63f9a2e3abba(__context__, arg_clone_src));
+}
+static vec4f __wrap_clone_d854fe401eed4365 ( Context * __context__ ) {
+    smart_ptr_raw<TestObjectSmart> & arg_dest = cast_aot_arg<smart_ptr_raw<TestObjectSmart> &>::to(*__context__,__context__->abiArguments()[0]);
+    TestObjectSmart * const  arg_src = cast_aot_arg<TestObjectSmart * const >::to(*__context__,__context__->abiArguments()[1]);
+    clone_d854fe401eed4365(__context__, arg_dest, arg_src);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickget_ptrTick5807679485210906136_878966099d0412f3 ( Context * __context__ ) {
+    smart_ptr_raw<TestObjectSmart> arg_src = cast_aot_arg<smart_ptr_raw<TestObjectSmart>>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<TestObjectSmart *>::from(_FuncbuiltinTickget_ptrTick5807679485210906136_878966099d0412f3(__context__, arg_src));
+}
+static vec4f __wrap__FuncbuiltinTickget_const_ptrTick4536782465177922409_4d82708912cf954d ( Context * __context__ ) {
+    smart_ptr_raw<TestObjectSmart> const  arg_src = cast_aot_arg<smart_ptr_raw<TestObjectSmart> const >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<TestObjectSmart *>::from(_FuncbuiltinTickget_const_ptrTick4536782465177922409_4d82708912cf954d(__context__, arg_src));
+}
+static vec4f __wrap_inside_scope_test_519c427e03fabbf9 ( Context * __context__ ) {
+    return cast<TestObjectSmart *>::from(inside_scope_test_519c427e03fabbf9(__context__));
+}
+static vec4f __wrap_scope_test_89d82aefd321f240 ( Context * __context__ ) {
+    scope_test_89d82aefd321f240(__context__);
+    return v_zero();
+}
+static vec4f __wrap_inside_move_test_6993c6006a84f41c ( Context * __context__ ) {
+    return cast<smart_ptr_raw<TestObjectSmart>>::from(inside_move_test_6993c6006a84f41c(__context__));
+}
+static vec4f __wrap_move_test_a411ee1bee462c75 ( Context * __context__ ) {
+    move_test_a411ee1bee462c75(__context__);
+    return v_zero();
+}
+static vec4f __wrap_ref_count_test_167c6e024631132b ( Context * __context__ ) {
+    ref_count_test_167c6e024631132b(__context__);
+    return v_zero();
+}
+static vec4f __wrap_access_test_10bcfed1cc0a6414 ( Context * __context__ ) {
+    access_test_10bcfed1cc0a6414(__context__);
+    return v_zero();
+}
+static vec4f __wrap_fn_test_da72cba2a411c657 ( Context * __context__ ) {
+    fn_test_da72cba2a411c657(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_b9c4912e7d0b729d ( Context * __context__ ) {
+    return cast<bool>::from(test_b9c4912e7d0b729d(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x2cb2bdc436153aa0, false, (void*)&clone_cf133071d3aa457e, &__wrap_clone_cf133071d3aa457e },
+    { 0x4728be3438a8c9c9, false, (void*)&_FuncbuiltinTickclone_to_moveTick17180087396728260876_58fc63f9a2e3abba, &__wrap__FuncbuiltinTickclone_to_moveTick17180087396728260876_58fc63f9a2e3abba },
+    { 0x1b31e551391cf948, false, (void*)&clone_d854fe401eed4365, &__wrap_clone_d854fe401eed4365 },
+    { 0x4772418d925e1940, false, (void*)&_FuncbuiltinTickget_ptrTick5807679485210906136_878966099d0412f3, &__wrap__FuncbuiltinTickget_ptrTick5807679485210906136_878966099d0412f3 },
+    { 0xc94910b6cd2b11b6, false, (void*)&_FuncbuiltinTickget_const_ptrTick4536782465177922409_4d82708912cf954d, &__wrap__FuncbuiltinTickget_const_ptrTick4536782465177922409_4d82708912cf954d },
+    { 0xbbe48c267c0dcb8c, false, (void*)&inside_scope_test_519c427e03fabbf9, &__wrap_inside_scope_test_519c427e03fabbf9 },
+    { 0x37f111fac6afa45, false, (void*)&scope_test_89d82aefd321f240, &__wrap_scope_test_89d82aefd321f240 },
+    { 0x3c24198dfec7bd5f, false, (void*)&inside_move_test_6993c6006a84f41c, &__wrap_inside_move_test_6993c6006a84f41c },
+    { 0x9dc9e8af9213a998, false, (void*)&move_test_a411ee1bee462c75, &__wrap_move_test_a411ee1bee462c75 },
+    { 0x4f465a43742bbaa1, false, (void*)&ref_count_test_167c6e024631132b, &__wrap_ref_count_test_167c6e024631132b },
+    { 0x3e1ae7a21ca6646, false, (void*)&access_test_10bcfed1cc0a6414, &__wrap_access_test_10bcfed1cc0a6414 },
+    { 0xeba41d2544c7e1aa, false, (void*)&fn_test_da72cba2a411c657, &__wrap_fn_test_da72cba2a411c657 },
+    { 0x83179483a2cb7608, false, (void*)&test_b9c4912e7d0b729d, &__wrap_test_b9c4912e7d0b729d },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_12881578682795524114
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,1410 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_2878707024329268861 {
+
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+    int32_t x;
+    int32_t y;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,y)==4,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_a52a306418c09be9 ( Context * __context__, TArray<Foo> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_68_2, int32_t __newSize_rename_at_68_3 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_fe200b84d41b4211 ( Context * __context__, TArray<uint32_t> & __Arr_rename_at_68_4, int32_t __newSize_rename_at_68_5 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_9cee684a9afdf22a ( Context * __context__, TArray<int64_t> & __Arr_rename_at_68_6, int32_t __newSize_rename_at_68_7 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_5e7dacd12cf28329 ( Context * __context__, TArray<uint64_t> & __Arr_rename_at_68_8, int32_t __newSize_rename_at_68_9 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_e3c7d561173b49d9 ( Context * __context__, TArray<float> & __Arr_rename_at_68_10, int32_t __newSize_rename_at_68_11 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2ebf1e4f1ba4dc01 ( Context * __context__, TArray<double> & __Arr_rename_at_68_12, int32_t __newSize_rename_at_68_13 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009 ( Context * __context__, TArray<char *> & __Arr_rename_at_68_14, int32_t __newSize_rename_at_68_15 );
+inline void _FuncbuiltinTicksortTick14088969635007481283_efe19cb88d1f917a ( Context * __context__, TArray<Foo> & __a_rename_at_1677_16 );
+inline void _FuncbuiltinTicksortTick14088969635007481283_fd6ac0e411144b9 ( Context * __context__, TArray<int32_t> & __a_rename_at_1677_19 );
+inline void _FuncbuiltinTicksortTick14088969635007481283_11bf20031eb498a2 ( Context * __context__, TArray<uint32_t> & __a_rename_at_1677_20 );
+inline void _FuncbuiltinTicksortTick14088969635007481283_b558576975fcdb2f ( Context * __context__, TArray<int64_t> & __a_rename_at_1677_21 );
+inline void _FuncbuiltinTicksortTick14088969635007481283_3142a640bd8b73a2 ( Context * __context__, TArray<uint64_t> & __a_rename_at_1677_22 );
+inline void _FuncbuiltinTicksortTick14088969635007481283_b131f13803ba6fda ( Context * __context__, TArray<float> & __a_rename_at_1677_23 );
+inline void _FuncbuiltinTicksortTick14088969635007481283_1e8d6def1ddc124a ( Context * __context__, TArray<double> & __a_rename_at_1677_24 );
+inline void _FuncbuiltinTicksortTick14088969635007481283_8c68d010851e6432 ( Context * __context__, TArray<char *> & __a_rename_at_1677_25 );
+inline void _FuncTicktest_sortTick14882388544287305087_3b76931a16654431 ( Context * __context__, TArray<Foo> & __arr_rename_at_2_26 );
+inline void _FuncbuiltinTicksortTick71647573575886987_299c8d677e877ae2 ( Context * __context__, TDim<int32_t,4> & __a_rename_at_1648_32 );
+inline void _FuncbuiltinTicksortTick71647573575886987_c4f76281e283da54 ( Context * __context__, TDim<uint32_t,4> & __a_rename_at_1648_33 );
+inline void _FuncbuiltinTicksortTick71647573575886987_70390692b0074add ( Context * __context__, TDim<int64_t,4> & __a_rename_at_1648_34 );
+inline void _FuncbuiltinTicksortTick71647573575886987_f4f63ea13b0a8b50 ( Context * __context__, TDim<uint64_t,4> & __a_rename_at_1648_35 );
+inline void _FuncbuiltinTicksortTick71647573575886987_d66ebefc2dda47c ( Context * __context__, TDim<float,4> & __a_rename_at_1648_36 );
+inline void _FuncbuiltinTicksortTick71647573575886987_db7cbee77eb91161 ( Context * __context__, TDim<double,4> & __a_rename_at_1648_37 );
+inline void _FuncbuiltinTicksortTick71647573575886987_eaf601c6431550b4 ( Context * __context__, TDim<char *,4> & __a_rename_at_1648_38 );
+inline void _FuncTicktest_sortTick14882388544287305087_7af9efc971e9806e ( Context * __context__, TArray<int32_t> & __arr_rename_at_2_39 );
+inline void _FuncTicktest_sortTick14882388544287305087_d7a346f80b1aad16 ( Context * __context__, TArray<uint32_t> & __arr_rename_at_2_45 );
+inline void _FuncTicktest_sortTick14882388544287305087_cd56f7bd6056d604 ( Context * __context__, TArray<int64_t> & __arr_rename_at_2_51 );
+inline void _FuncTicktest_sortTick14882388544287305087_7dd751594edd4e5e ( Context * __context__, TArray<uint64_t> & __arr_rename_at_2_57 );
+inline void _FuncTicktest_sortTick14882388544287305087_a3ae96aa481b8279 ( Context * __context__, TArray<float> & __arr_rename_at_2_63 );
+inline void _FuncTicktest_sortTick14882388544287305087_e4ec06953c3e8538 ( Context * __context__, TArray<double> & __arr_rename_at_2_69 );
+inline void _FuncTicktest_sortTick14882388544287305087_f37c08a7182c5491 ( Context * __context__, TArray<char *> & __arr_rename_at_2_75 );
+inline TArray<Foo> _FuncbuiltinTickto_array_moveTick3185538323411982277_30001f9d1745e610 ( Context * __context__, TDim<Foo,4> & __a_rename_at_1502_81 );
+inline void _FuncbuiltinTickpushTick14133213201864676143_61c98bc08ecd13d6 ( Context * __context__, TArray<float2> & __Arr_rename_at_177_83, float2 __value_rename_at_177_84 );
+inline void _FuncTicktest_sort_compTick14790097101432932268_691a3401464da1b8 ( Context * __context__, TArray<float2> & __arr_rename_at_14_85 );
+inline void _FuncTicktest_sortTick14882388544287305087_2dd6259fe5cba16 ( Context * __context__, TDim<int32_t,4> & __arr_rename_at_2_90 );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18 ( Context * __context__, TDim<int32_t,4> & __a_rename_at_1502_95 );
+inline void _FuncTicktest_sortTick14882388544287305087_3b7d432ec644929d ( Context * __context__, TDim<uint32_t,4> & __arr_rename_at_2_97 );
+inline TArray<uint32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_7ade2ac99f7a944f ( Context * __context__, TDim<uint32_t,4> & __a_rename_at_1502_102 );
+inline void _FuncTicktest_sortTick14882388544287305087_906aaf2fcb98d109 ( Context * __context__, TDim<int64_t,4> & __arr_rename_at_2_104 );
+inline TArray<int64_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_4bdd39108bb81bb1 ( Context * __context__, TDim<int64_t,4> & __a_rename_at_1502_109 );
+inline void _FuncTicktest_sortTick14882388544287305087_b7e56a417eeac2b1 ( Context * __context__, TDim<uint64_t,4> & __arr_rename_at_2_111 );
+inline TArray<uint64_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_a734db502d6a5a7a ( Context * __context__, TDim<uint64_t,4> & __a_rename_at_1502_116 );
+inline void _FuncTicktest_sortTick14882388544287305087_b7abdee641b4c258 ( Context * __context__, TDim<float,4> & __arr_rename_at_2_118 );
+inline TArray<float> _FuncbuiltinTickto_array_moveTick3185538323411982277_e275dfafa0fc87f8 ( Context * __context__, TDim<float,4> & __a_rename_at_1502_123 );
+inline void _FuncTicktest_sortTick14882388544287305087_c21a48225ffe2376 ( Context * __context__, TDim<double,4> & __arr_rename_at_2_125 );
+inline TArray<double> _FuncbuiltinTickto_array_moveTick3185538323411982277_1bec3c8b815fe304 ( Context * __context__, TDim<double,4> & __a_rename_at_1502_130 );
+inline void _FuncTicktest_sortTick14882388544287305087_c2c9f768e3d98b72 ( Context * __context__, TDim<char *,4> & __arr_rename_at_2_132 );
+inline TArray<char *> _FuncbuiltinTickto_array_moveTick3185538323411982277_d862e40791f6bc49 ( Context * __context__, TDim<char *,4> & __a_rename_at_1502_137 );
+inline bool _FuncLess_57166e1ce4637f88 ( Context * __context__, Foo const  & __a_rename_at_28_139, Foo const  & __b_rename_at_28_140 );
+inline void test_vector_sort_608c89507a554eda ( Context * __context__ );
+inline bool test_a8dc9cc8d40b618d ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_a52a306418c09be9 ( Context * __context__, TArray<Foo> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<Foo>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_68_2, int32_t __newSize_rename_at_68_3 )
+{
+    builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_68_2),__newSize_rename_at_68_3,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_fe200b84d41b4211 ( Context * __context__, TArray<uint32_t> &  __Arr_rename_at_68_4, int32_t __newSize_rename_at_68_5 )
+{
+    builtin_array_resize(das_arg<TArray<uint32_t>>::pass(__Arr_rename_at_68_4),__newSize_rename_at_68_5,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_9cee684a9afdf22a ( Context * __context__, TArray<int64_t> &  __Arr_rename_at_68_6, int32_t __newSize_rename_at_68_7 )
+{
+    builtin_array_resize(das_arg<TArray<int64_t>>::pass(__Arr_rename_at_68_6),__newSize_rename_at_68_7,8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_5e7dacd12cf28329 ( Context * __context__, TArray<uint64_t> &  __Arr_rename_at_68_8, int32_t __newSize_rename_at_68_9 )
+{
+    builtin_array_resize(das_arg<TArray<uint64_t>>::pass(__Arr_rename_at_68_8),__newSize_rename_at_68_9,8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_e3c7d561173b49d9 ( Context * __context__, TArray<float> &  __Arr_rename_at_68_10, int32_t __newSize_rename_at_68_11 )
+{
+    builtin_array_resize(das_arg<TArray<float>>::pass(__Arr_rename_at_68_10),__newSize_rename_at_68_11,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2ebf1e4f1ba4dc01 ( Context * __context__, TArray<double> &  __Arr_rename_at_68_12, int32_t __newSize_rename_at_68_13 )
+{
+    builtin_array_resize(das_arg<TArray<double>>::pass(__Arr_rename_at_68_12),__newSize_rename_at_68_13,8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009 ( Context * __context__, TArray<char *> &  __Arr_rename_at_68_14, int32_t __newSize_rename_at_68_15 )
+{
+    builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_68_14),__newSize_rename_at_68_15,8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTicksortTick14088969635007481283_efe19cb88d1f917a ( Context * __context__, TArray<Foo> &  __a_rename_at_1677_16 )
+{
+    if ( builtin_array_size(das_arg<TArray<Foo>>::pass(__a_rename_at_1677_16)) <= 1 )
+    {
+        return ;
+    } else {
+        builtin_sort_array_any_cblock_T(das_arg<TArray<Foo>>::pass(__a_rename_at_1677_16),8,builtin_array_size(das_arg<TArray<Foo>>::pass(__a_rename_at_1677_16)),[&](Foo const  & __x_rename_at_1698_17, Foo const  & __y_rename_at_1698_18) DAS_AOT_INLINE_LAMBDA -> bool{
+            return das_auto_cast<bool>::cast(_FuncLess_57166e1ce4637f88(__context__,__x_rename_at_1698_17,__y_rename_at_1698_18));
+        },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    };
+}
+
+inline void _FuncbuiltinTicksortTick14088969635007481283_fd6ac0e411144b9 ( Context * __context__, TArray<int32_t> &  __a_rename_at_1677_19 )
+{
+    if ( builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_1677_19)) <= 1 )
+    {
+        return ;
+    } else {
+        builtin_array_lock(das_arg<TArray<int32_t>>::pass(__a_rename_at_1677_19),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        builtin_sort<int32_t>(das_ref(__context__,__a_rename_at_1677_19(0,__context__)),builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_1677_19)));
+        builtin_array_unlock(das_arg<TArray<int32_t>>::pass(__a_rename_at_1677_19),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    };
+}
+
+inline void _FuncbuiltinTicksortTick14088969635007481283_11bf20031eb498a2 ( Context * __context__, TArray<uint32_t> &  __a_rename_at_1677_20 )
+{
+    if ( builtin_array_size(das_arg<TArray<uint32_t>>::pass(__a_rename_at_1677_20)) <= 1 )
+    {
+        return ;
+    } else {
+        builtin_array_lock(das_arg<TArray<uint32_t>>::pass(__a_rename_at_1677_20),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        builtin_sort<uint32_t>(das_ref(__context__,__a_rename_at_1677_20(0,__context__)),builtin_array_size(das_arg<TArray<uint32_t>>::pass(__a_rename_at_1677_20)));
+        builtin_array_unlock(das_arg<TArray<uint32_t>>::pass(__a_rename_at_1677_20),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    };
+}
+
+inline void _FuncbuiltinTicksortTick14088969635007481283_b558576975fcdb2f ( Context * __context__, TArray<int64_t> &  __a_rename_at_1677_21 )
+{
+    if ( builtin_array_size(das_arg<TArray<int64_t>>::pass(__a_rename_at_1677_21)) <= 1 )
+    {
+        return ;
+    } else {
+        builtin_array_lock(das_arg<TArray<int64_t>>::pass(__a_rename_at_1677_21),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        builtin_sort<int64_t>(das_ref(__context__,__a_rename_at_1677_21(0,__context__)),builtin_array_size(das_arg<TArray<int64_t>>::pass(__a_rename_at_1677_21)));
+        builtin_array_unlock(das_arg<TArray<int64_t>>::pass(__a_rename_at_1677_21),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    };
+}
+
+inline void _FuncbuiltinTicksortTick14088969635007481283_3142a640bd8b73a2 ( Context * __context__, TArray<uint64_t> &  __a_rename_at_1677_22 )
+{
+    if ( builtin_array_size(das_arg<TArray<uint64_t>>::pass(__a_rename_at_1677_22)) <= 1 )
+    {
+        return ;
+    } else {
+        builtin_array_lock(das_arg<TArray<uint64_t>>::pass(__a_rename_at_1677_22),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        builtin_sort<uint64_t>(das_ref(__context__,__a_rename_at_1677_22(0,__context__)),builtin_array_size(das_arg<TArray<uint64_t>>::pass(__a_rename_at_1677_22)));
+        builtin_array_unlock(das_arg<TArray<uint64_t>>::pass(__a_rename_at_1677_22),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    };
+}
+
+inline void _FuncbuiltinTicksortTick14088969635007481283_b131f13803ba6fda ( Context * __context__, TArray<float> &  __a_rename_at_1677_23 )
+{
+    if ( builtin_array_size(das_arg<TArray<float>>::pass(__a_rename_at_1677_23)) <= 1 )
+    {
+        return ;
+    } else {
+        builtin_array_lock(das_arg<TArray<float>>::pass(__a_rename_at_1677_23),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        builtin_sort<float>(das_ref(__context__,__a_rename_at_1677_23(0,__context__)),builtin_array_size(das_arg<TArray<float>>::pass(__a_rename_at_1677_23)));
+        builtin_array_unlock(das_arg<TArray<float>>::pass(__a_rename_at_1677_23),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    };
+}
+
+inline void _FuncbuiltinTicksortTick14088969635007481283_1e8d6def1ddc124a ( Context * __context__, TArray<double> &  __a_rename_at_1677_24 )
+{
+    if ( builtin_array_size(das_arg<TArray<double>>::pass(__a_rename_at_1677_24)) <= 1 )
+    {
+        return ;
+    } else {
+        builtin_array_lock(das_arg<TArray<double>>::pass(__a_rename_at_1677_24),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        builtin_sort<double>(das_ref(__context__,__a_rename_at_1677_24(0,__context__)),builtin_array_size(das_arg<TArray<double>>::pass(__a_rename_at_1677_24)));
+        builtin_array_unlock(das_arg<TArray<double>>::pass(__a_rename_at_1677_24),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    };
+}
+
+inline void _FuncbuiltinTicksortTick14088969635007481283_8c68d010851e6432 ( Context * __context__, TArray<char *> &  __a_rename_at_1677_25 )
+{
+    if ( builtin_array_size(das_arg<TArray<char *>>::pass(__a_rename_at_1677_25)) <= 1 )
+    {
+        return ;
+    } else {
+        builtin_array_lock(das_arg<TArray<char *>>::pass(__a_rename_at_1677_25),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        builtin_sort_string(das_auto_cast<void * const >::cast(das_ref(__context__,__a_rename_at_1677_25(0,__context__))),builtin_array_size(das_arg<TArray<char *>>::pass(__a_rename_at_1677_25)));
+        builtin_array_unlock(das_arg<TArray<char *>>::pass(__a_rename_at_1677_25),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    };
+}
+
+inline void _FuncTicktest_sortTick14882388544287305087_3b76931a16654431 ( Context * __context__, TArray<Foo> &  __arr_rename_at_2_26 )
+{
+    _FuncbuiltinTicksortTick14088969635007481283_efe19cb88d1f917a(__context__,das_arg<TArray<Foo>>::pass(__arr_rename_at_2_26));
+    int32_t __len_rename_at_4_27 = ((int32_t)builtin_array_size(das_arg<TArray<Foo>>::pass(__arr_rename_at_2_26)));
+    {
+        bool __need_loop_5 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,__len_rename_at_4_27));
+        int32_t __i_rename_at_5_28;
+        __need_loop_5 = __i_iterator.first(__context__,(__i_rename_at_5_28)) && __need_loop_5;
+        for ( ; __need_loop_5 ; __need_loop_5 = __i_iterator.next(__context__,(__i_rename_at_5_28)) )
+        {
+            DAS_ASSERT((_FuncLess_57166e1ce4637f88(__context__,das_arg<Foo>::pass(__arr_rename_at_2_26((__i_rename_at_5_28 - 1),__context__)),das_arg<Foo>::pass(__arr_rename_at_2_26(__i_rename_at_5_28,__context__)))));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_5_28));
+    };
+    builtin_sort_array_any_cblock_T(das_arg<TArray<Foo>>::pass(__arr_rename_at_2_26),8,0,[&](Foo const  & __a_rename_at_8_29, Foo const  & __b_rename_at_8_30) DAS_AOT_INLINE_LAMBDA -> bool{
+        return das_auto_cast<bool>::cast(!(_FuncLess_57166e1ce4637f88(__context__,__a_rename_at_8_29,__b_rename_at_8_30)));
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    {
+        bool __need_loop_9 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,__len_rename_at_4_27));
+        int32_t __i_rename_at_9_31;
+        __need_loop_9 = __i_iterator.first(__context__,(__i_rename_at_9_31)) && __need_loop_9;
+        for ( ; __need_loop_9 ; __need_loop_9 = __i_iterator.next(__context__,(__i_rename_at_9_31)) )
+        {
+            DAS_ASSERT((!(_FuncLess_57166e1ce4637f88(__context__,das_arg<Foo>::pass(__arr_rename_at_2_26((__i_rename_at_9_31 - 1),__context__)),das_arg<Foo>::pass(__arr_rename_at_2_26(__i_rename_at_9_31,__context__))))));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_9_31));
+    };
+}
+
+inline void _FuncbuiltinTicksortTick71647573575886987_299c8d677e877ae2 ( Context * __context__, TDim<int32_t,4> &  __a_rename_at_1648_32 )
+{
+    builtin_sort<int32_t>(das_ref(__context__,__a_rename_at_1648_32(0,__context__)),4);
+}
+
+inline void _FuncbuiltinTicksortTick71647573575886987_c4f76281e283da54 ( Context * __context__, TDim<uint32_t,4> &  __a_rename_at_1648_33 )
+{
+    builtin_sort<uint32_t>(das_ref(__context__,__a_rename_at_1648_33(0,__context__)),4);
+}
+
+inline void _FuncbuiltinTicksortTick71647573575886987_70390692b0074add ( Context * __context__, TDim<int64_t,4> &  __a_rename_at_1648_34 )
+{
+    builtin_sort<int64_t>(das_ref(__context__,__a_rename_at_1648_34(0,__context__)),4);
+}
+
+inline void _FuncbuiltinTicksortTick71647573575886987_f4f63ea13b0a8b50 ( Context * __context__, TDim<uint64_t,4> &  __a_rename_at_1648_35 )
+{
+    builtin_sort<uint64_t>(das_ref(__context__,__a_rename_at_1648_35(0,__context__)),4);
+}
+
+inline void _FuncbuiltinTicksortTick71647573575886987_d66ebefc2dda47c ( Context * __context__, TDim<float,4> &  __a_rename_at_1648_36 )
+{
+    builtin_sort<float>(das_ref(__context__,__a_rename_at_1648_36(0,__context__)),4);
+}
+
+inline void _FuncbuiltinTicksortTick71647573575886987_db7cbee77eb91161 ( Context * __context__, TDim<double,4> &  __a_rename_at_1648_37 )
+{
+    builtin_sort<double>(das_ref(__context__,__a_rename_at_1648_37(0,__context__)),4);
+}
+
+inline void _FuncbuiltinTicksortTick71647573575886987_eaf601c6431550b4 ( Context * __context__, TDim<char *,4> &  __a_rename_at_1648_38 )
+{
+    builtin_sort_string(das_auto_cast<void * const >::cast(das_ref(__context__,__a_rename_at_1648_38(0,__context__))),4);
+}
+
+inline void _FuncTicktest_sortTick14882388544287305087_7af9efc971e9806e ( Context * __context__, TArray<int32_t> &  __arr_rename_at_2_39 )
+{
+    _FuncbuiltinTicksortTick14088969635007481283_fd6ac0e411144b9(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_2_39));
+    int32_t __len_rename_at_4_40 = ((int32_t)builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_2_39)));
+    {
+        bool __need_loop_5 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,__len_rename_at_4_40));
+        int32_t __i_rename_at_5_41;
+        __need_loop_5 = __i_iterator.first(__context__,(__i_rename_at_5_41)) && __need_loop_5;
+        for ( ; __need_loop_5 ; __need_loop_5 = __i_iterator.next(__context__,(__i_rename_at_5_41)) )
+        {
+            DAS_ASSERT((__arr_rename_at_2_39((__i_rename_at_5_41 - 1),__context__) < __arr_rename_at_2_39(__i_rename_at_5_41,__context__)));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_5_41));
+    };
+    builtin_sort_array_any_ref_cblock_T(das_arg<TArray<int32_t>>::pass(__arr_rename_at_2_39),4,0,[&](int32_t const  __a_rename_at_8_42, int32_t const  __b_rename_at_8_43) DAS_AOT_INLINE_LAMBDA -> bool{
+        return das_auto_cast<bool>::cast(!(__a_rename_at_8_42 < __b_rename_at_8_43));
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    {
+        bool __need_loop_9 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,__len_rename_at_4_40));
+        int32_t __i_rename_at_9_44;
+        __need_loop_9 = __i_iterator.first(__context__,(__i_rename_at_9_44)) && __need_loop_9;
+        for ( ; __need_loop_9 ; __need_loop_9 = __i_iterator.next(__context__,(__i_rename_at_9_44)) )
+        {
+            DAS_ASSERT((!(__arr_rename_at_2_39((__i_rename_at_9_44 - 1),__context__) < __arr_rename_at_2_39(__i_rename_at_9_44,__context__))));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_9_44));
+    };
+}
+
+inline void _FuncTicktest_sortTick14882388544287305087_d7a346f80b1aad16 ( Context * __context__, TArray<uint32_t> &  __arr_rename_at_2_45 )
+{
+    _FuncbuiltinTicksortTick14088969635007481283_11bf20031eb498a2(__context__,das_arg<TArray<uint32_t>>::pass(__arr_rename_at_2_45));
+    int32_t __len_rename_at_4_46 = ((int32_t)builtin_array_size(das_arg<TArray<uint32_t>>::pass(__arr_rename_at_2_45)));
+    {
+        bool __need_loop_5 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,__len_rename_at_4_46));
+        int32_t __i_rename_at_5_47;
+        __need_loop_5 = __i_iterator.first(__context__,(__i_rename_at_5_47)) && __need_loop_5;
+        for ( ; __need_loop_5 ; __need_loop_5 = __i_iterator.next(__context__,(__i_rename_at_5_47)) )
+        {
+            DAS_ASSERT((__arr_rename_at_2_45((__i_rename_at_5_47 - 1),__context__) < __arr_rename_at_2_45(__i_rename_at_5_47,__context__)));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_5_47));
+    };
+    builtin_sort_array_any_ref_cblock_T(das_arg<TArray<uint32_t>>::pass(__arr_rename_at_2_45),4,0,[&](uint32_t const  __a_rename_at_8_48, uint32_t const  __b_rename_at_8_49) DAS_AOT_INLINE_LAMBDA -> bool{
+        return das_auto_cast<bool>::cast(!(__a_rename_at_8_48 < __b_rename_at_8_49));
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    {
+        bool __need_loop_9 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,__len_rename_at_4_46));
+        int32_t __i_rename_at_9_50;
+        __need_loop_9 = __i_iterator.first(__context__,(__i_rename_at_9_50)) && __need_loop_9;
+        for ( ; __need_loop_9 ; __need_loop_9 = __i_iterator.next(__context__,(__i_rename_at_9_50)) )
+        {
+            DAS_ASSERT((!(__arr_rename_at_2_45((__i_rename_at_9_50 - 1),__context__) < __arr_rename_at_2_45(__i_rename_at_9_50,__context__))));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_9_50));
+    };
+}
+
+inline void _FuncTicktest_sortTick14882388544287305087_cd56f7bd6056d604 ( Context * __context__, TArray<int64_t> &  __arr_rename_at_2_51 )
+{
+    _FuncbuiltinTicksortTick14088969635007481283_b558576975fcdb2f(__context__,das_arg<TArray<int64_t>>::pass(__arr_rename_at_2_51));
+    int32_t __len_rename_at_4_52 = ((int32_t)builtin_array_size(das_arg<TArray<int64_t>>::pass(__arr_rename_at_2_51)));
+    {
+        bool __need_loop_5 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,__len_rename_at_4_52));
+        int32_t __i_rename_at_5_53;
+        __need_loop_5 = __i_iterator.first(__context__,(__i_rename_at_5_53)) && __need_loop_5;
+        for ( ; __need_loop_5 ; __need_loop_5 = __i_iterator.next(__context__,(__i_rename_at_5_53)) )
+        {
+            DAS_ASSERT((__arr_rename_at_2_51((__i_rename_at_5_53 - 1),__context__) < __arr_rename_at_2_51(__i_rename_at_5_53,__context__)));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_5_53));
+    };
+    builtin_sort_array_any_ref_cblock_T(das_arg<TArray<int64_t>>::pass(__arr_rename_at_2_51),8,0,[&](int64_t const  __a_rename_at_8_54, int64_t const  __b_rename_at_8_55) DAS_AOT_INLINE_LAMBDA -> bool{
+        return das_auto_cast<bool>::cast(!(__a_rename_at_8_54 < __b_rename_at_8_55));
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    {
+        bool __need_loop_9 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,__len_rename_at_4_52));
+        int32_t __i_rename_at_9_56;
+        __need_loop_9 = __i_iterator.first(__context__,(__i_rename_at_9_56)) && __need_loop_9;
+        for ( ; __need_loop_9 ; __need_loop_9 = __i_iterator.next(__context__,(__i_rename_at_9_56)) )
+        {
+            DAS_ASSERT((!(__arr_rename_at_2_51((__i_rename_at_9_56 - 1),__context__) < __arr_rename_at_2_51(__i_rename_at_9_56,__context__))));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_9_56));
+    };
+}
+
+inline void _FuncTicktest_sortTick14882388544287305087_7dd751594edd4e5e ( Context * __context__, TArray<uint64_t> &  __arr_rename_at_2_57 )
+{
+    _FuncbuiltinTicksortTick14088969635007481283_3142a640bd8b73a2(__context__,das_arg<TArray<uint64_t>>::pass(__arr_rename_at_2_57));
+    int32_t __len_rename_at_4_58 = ((int32_t)builtin_array_size(das_arg<TArray<uint64_t>>::pass(__arr_rename_at_2_57)));
+    {
+        bool __need_loop_5 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,__len_rename_at_4_58));
+        int32_t __i_rename_at_5_59;
+        __need_loop_5 = __i_iterator.first(__context__,(__i_rename_at_5_59)) && __need_loop_5;
+        for ( ; __need_loop_5 ; __need_loop_5 = __i_iterator.next(__context__,(__i_rename_at_5_59)) )
+        {
+            DAS_ASSERT((__arr_rename_at_2_57((__i_rename_at_5_59 - 1),__context__) < __arr_rename_at_2_57(__i_rename_at_5_59,__context__)));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_5_59));
+    };
+    builtin_sort_array_any_ref_cblock_T(das_arg<TArray<uint64_t>>::pass(__arr_rename_at_2_57),8,0,[&](uint64_t const  __a_rename_at_8_60, uint64_t const  __b_rename_at_8_61) DAS_AOT_INLINE_LAMBDA -> bool{
+        return das_auto_cast<bool>::cast(!(__a_rename_at_8_60 < __b_rename_at_8_61));
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    {
+        bool __need_loop_9 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,__len_rename_at_4_58));
+        int32_t __i_rename_at_9_62;
+        __need_loop_9 = __i_iterator.first(__context__,(__i_rename_at_9_62)) && __need_loop_9;
+        for ( ; __need_loop_9 ; __need_loop_9 = __i_iterator.next(__context__,(__i_rename_at_9_62)) )
+        {
+            DAS_ASSERT((!(__arr_rename_at_2_57((__i_rename_at_9_62 - 1),__context__) < __arr_rename_at_2_57(__i_rename_at_9_62,__context__))));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_9_62));
+    };
+}
+
+inline void _FuncTicktest_sortTick14882388544287305087_a3ae96aa481b8279 ( Context * __context__, TArray<float> &  __arr_rename_at_2_63 )
+{
+    _FuncbuiltinTicksortTick14088969635007481283_b131f13803ba6fda(__context__,das_arg<TArray<float>>::pass(__arr_rename_at_2_63));
+    int32_t __len_rename_at_4_64 = ((int32_t)builtin_array_size(das_arg<TArray<float>>::pass(__arr_rename_at_2_63)));
+    {
+        bool __need_loop_5 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,__len_rename_at_4_64));
+        int32_t __i_rename_at_5_65;
+        __need_loop_5 = __i_iterator.first(__context__,(__i_rename_at_5_65)) && __need_loop_5;
+        for ( ; __need_loop_5 ; __need_loop_5 = __i_iterator.next(__context__,(__i_rename_at_5_65)) )
+        {
+            DAS_ASSERT((__arr_rename_at_2_63((__i_rename_at_5_65 - 1),__context__) < __arr_rename_at_2_63(__i_rename_at_5_65,__context__)));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_5_65));
+    };
+    builtin_sort_array_any_ref_cblock_T(das_arg<TArray<float>>::pass(__arr_rename_at_2_63),4,0,[&](float const  __a_rename_at_8_66, float const  __b_rename_at_8_67) DAS_AOT_INLINE_LAMBDA -> bool{
+        return das_auto_cast<bool>::cast(!(__a_rename_at_8_66 < __b_rename_at_8_67));
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    {
+        bool __need_loop_9 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,__len_rename_at_4_64));
+        int32_t __i_rename_at_9_68;
+        __need_loop_9 = __i_iterator.first(__context__,(__i_rename_at_9_68)) && __need_loop_9;
+        for ( ; __need_loop_9 ; __need_loop_9 = __i_iterator.next(__context__,(__i_rename_at_9_68)) )
+        {
+            DAS_ASSERT((!(__arr_rename_at_2_63((__i_rename_at_9_68 - 1),__context__) < __arr_rename_at_2_63(__i_rename_at_9_68,__context__))));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_9_68));
+    };
+}
+
+inline void _FuncTicktest_sortTick14882388544287305087_e4ec06953c3e8538 ( Context * __context__, TArray<double> &  __arr_rename_at_2_69 )
+{
+    _FuncbuiltinTicksortTick14088969635007481283_1e8d6def1ddc124a(__context__,das_arg<TArray<double>>::pass(__arr_rename_at_2_69));
+    int32_t __len_rename_at_4_70 = ((int32_t)builtin_array_size(das_arg<TArray<double>>::pass(__arr_rename_at_2_69)));
+    {
+        bool __need_loop_5 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,__len_rename_at_4_70));
+        int32_t __i_rename_at_5_71;
+        __need_loop_5 = __i_iterator.first(__context__,(__i_rename_at_5_71)) && __need_loop_5;
+        for ( ; __need_loop_5 ; __need_loop_5 = __i_iterator.next(__context__,(__i_rename_at_5_71)) )
+        {
+            DAS_ASSERT((__arr_rename_at_2_69((__i_rename_at_5_71 - 1),__context__) < __arr_rename_at_2_69(__i_rename_at_5_71,__context__)));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_5_71));
+    };
+    builtin_sort_array_any_ref_cblock_T(das_arg<TArray<double>>::pass(__arr_rename_at_2_69),8,0,[&](double const  __a_rename_at_8_72, double const  __b_rename_at_8_73) DAS_AOT_INLINE_LAMBDA -> bool{
+        return das_auto_cast<bool>::cast(!(__a_rename_at_8_72 < __b_rename_at_8_73));
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    {
+        bool __need_loop_9 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,__len_rename_at_4_70));
+        int32_t __i_rename_at_9_74;
+        __need_loop_9 = __i_iterator.first(__context__,(__i_rename_at_9_74)) && __need_loop_9;
+        for ( ; __need_loop_9 ; __need_loop_9 = __i_iterator.next(__context__,(__i_rename_at_9_74)) )
+        {
+            DAS_ASSERT((!(__arr_rename_at_2_69((__i_rename_at_9_74 - 1),__context__) < __arr_rename_at_2_69(__i_rename_at_9_74,__context__))));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_9_74));
+    };
+}
+
+inline void _FuncTicktest_sortTick14882388544287305087_f37c08a7182c5491 ( Context * __context__, TArray<char *> &  __arr_rename_at_2_75 )
+{
+    _FuncbuiltinTicksortTick14088969635007481283_8c68d010851e6432(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_2_75));
+    int32_t __len_rename_at_4_76 = ((int32_t)builtin_array_size(das_arg<TArray<char *>>::pass(__arr_rename_at_2_75)));
+    {
+        bool __need_loop_5 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,__len_rename_at_4_76));
+        int32_t __i_rename_at_5_77;
+        __need_loop_5 = __i_iterator.first(__context__,(__i_rename_at_5_77)) && __need_loop_5;
+        for ( ; __need_loop_5 ; __need_loop_5 = __i_iterator.next(__context__,(__i_rename_at_5_77)) )
+        {
+            DAS_ASSERT((SimPolicy<char *>::Less(cast<char *>::from(__arr_rename_at_2_75((__i_rename_at_5_77 - 1),__context__)),cast<char *>::from(__arr_rename_at_2_75(__i_rename_at_5_77,__context__)),*__context__,nullptr)));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_5_77));
+    };
+    builtin_sort_array_any_ref_cblock_T(das_arg<TArray<char *>>::pass(__arr_rename_at_2_75),8,0,[&](char * const  __a_rename_at_8_78, char * const  __b_rename_at_8_79) DAS_AOT_INLINE_LAMBDA -> bool{
+        return das_auto_cast<bool>::cast(!(SimPolicy<char *>::Less(cast<char *>::from(__a_rename_at_8_78),cast<char *>::from(__b_rename_at_8_79),*__context__,nullptr)));
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    {
+        bool __need_loop_9 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,__len_rename_at_4_76));
+        int32_t __i_rename_at_9_80;
+        __need_loop_9 = __i_iterator.first(__context__,(__i_rename_at_9_80)) && __need_loop_9;
+        for ( ; __need_loop_9 ; __need_loop_9 = __i_iterator.next(__context__,(__i_rename_at_9_80)) )
+        {
+            DAS_ASSERT((!(SimPolicy<char *>::Less(cast<char *>::from(__arr_rename_at_2_75((__i_rename_at_9_80 - 1),__context__)),cast<char *>::from(__arr_rename_at_2_75(__i_rename_at_9_80,__context__)),*__context__,nullptr))));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_9_80));
+    };
+}
+
+inline TArray<Foo> _FuncbuiltinTickto_array_moveTick3185538323411982277_30001f9d1745e610 ( Context * __context__, TDim<Foo,4> &  __a_rename_at_1502_81 )
+{
+    TArray<Foo> __arr_rename_at_1504_82;das_zero(__arr_rename_at_1504_82);
+    _FuncbuiltinTickresizeTick4811697762258667383_a52a306418c09be9(__context__,das_arg<TArray<Foo>>::pass(__arr_rename_at_1504_82),4);
+    das_copy(das_cast<TDim<Foo,4>>::cast(das_ref(__context__,__arr_rename_at_1504_82(0,__context__))),__a_rename_at_1502_81);
+    return /* <- */ das_auto_cast_move<TArray<Foo>>::cast(__arr_rename_at_1504_82);
+}
+
+inline void _FuncbuiltinTickpushTick14133213201864676143_61c98bc08ecd13d6 ( Context * __context__, TArray<float2> &  __Arr_rename_at_177_83, float2 __value_rename_at_177_84 )
+{
+    das_copy(__Arr_rename_at_177_83(builtin_array_push_back(das_arg<TArray<float2>>::pass(__Arr_rename_at_177_83),8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_177_84);
+}
+
+inline void _FuncTicktest_sort_compTick14790097101432932268_691a3401464da1b8 ( Context * __context__, TArray<float2> &  __arr_rename_at_14_85 )
+{
+    int32_t __len_rename_at_15_86 = ((int32_t)builtin_array_size(das_arg<TArray<float2>>::pass(__arr_rename_at_14_85)));
+    builtin_sort_array_any_ref_cblock_T(das_arg<TArray<float2>>::pass(__arr_rename_at_14_85),8,0,[&](float2 __a_rename_at_16_87, float2 __b_rename_at_16_88) DAS_AOT_INLINE_LAMBDA -> bool{
+        return das_auto_cast<bool>::cast(v_extract_x(__a_rename_at_16_87) /*x*/ < v_extract_x(__b_rename_at_16_88) /*x*/);
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    {
+        bool __need_loop_19 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,__len_rename_at_15_86));
+        int32_t __i_rename_at_19_89;
+        __need_loop_19 = __i_iterator.first(__context__,(__i_rename_at_19_89)) && __need_loop_19;
+        for ( ; __need_loop_19 ; __need_loop_19 = __i_iterator.next(__context__,(__i_rename_at_19_89)) )
+        {
+            DAS_ASSERT((v_extract_x(__arr_rename_at_14_85((__i_rename_at_19_89 - 1),__context__)) /*x*/ < v_extract_x(__arr_rename_at_14_85(__i_rename_at_19_89,__context__)) /*x*/));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_19_89));
+    };
+}
+
+inline void _FuncTicktest_sortTick14882388544287305087_2dd6259fe5cba16 ( Context * __context__, TDim<int32_t,4> &  __arr_rename_at_2_90 )
+{
+    _FuncbuiltinTicksortTick71647573575886987_299c8d677e877ae2(__context__,das_arg<TDim<int32_t,4>>::pass(__arr_rename_at_2_90));
+    {
+        bool __need_loop_5 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,4));
+        int32_t __i_rename_at_5_91;
+        __need_loop_5 = __i_iterator.first(__context__,(__i_rename_at_5_91)) && __need_loop_5;
+        for ( ; __need_loop_5 ; __need_loop_5 = __i_iterator.next(__context__,(__i_rename_at_5_91)) )
+        {
+            DAS_ASSERT((__arr_rename_at_2_90((__i_rename_at_5_91 - 1),__context__) < __arr_rename_at_2_90(__i_rename_at_5_91,__context__)));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_5_91));
+    };
+    builtin_sort_dim_any_ref_cblock_T(das_arg<TDim<int32_t,4>>::pass(__arr_rename_at_2_90),4,4,[&](int32_t const  __a_rename_at_8_92, int32_t const  __b_rename_at_8_93) DAS_AOT_INLINE_LAMBDA -> bool{
+        return das_auto_cast<bool>::cast(!(__a_rename_at_8_92 < __b_rename_at_8_93));
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    {
+        bool __need_loop_9 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,4));
+        int32_t __i_rename_at_9_94;
+        __need_loop_9 = __i_iterator.first(__context__,(__i_rename_at_9_94)) && __need_loop_9;
+        for ( ; __need_loop_9 ; __need_loop_9 = __i_iterator.next(__context__,(__i_rename_at_9_94)) )
+        {
+            DAS_ASSERT((!(__arr_rename_at_2_90((__i_rename_at_9_94 - 1),__context__) < __arr_rename_at_2_90(__i_rename_at_9_94,__context__))));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_9_94));
+    };
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18 ( Context * __context__, TDim<int32_t,4> &  __a_rename_at_1502_95 )
+{
+    TArray<int32_t> __arr_rename_at_1504_96;das_zero(__arr_rename_at_1504_96);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_96),4);
+    das_copy(das_cast<TDim<int32_t,4>>::cast(das_ref(__context__,__arr_rename_at_1504_96(0,__context__))),__a_rename_at_1502_95);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_96);
+}
+
+inline void _FuncTicktest_sortTick14882388544287305087_3b7d432ec644929d ( Context * __context__, TDim<uint32_t,4> &  __arr_rename_at_2_97 )
+{
+    _FuncbuiltinTicksortTick71647573575886987_c4f76281e283da54(__context__,das_arg<TDim<uint32_t,4>>::pass(__arr_rename_at_2_97));
+    {
+        bool __need_loop_5 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,4));
+        int32_t __i_rename_at_5_98;
+        __need_loop_5 = __i_iterator.first(__context__,(__i_rename_at_5_98)) && __need_loop_5;
+        for ( ; __need_loop_5 ; __need_loop_5 = __i_iterator.next(__context__,(__i_rename_at_5_98)) )
+        {
+            DAS_ASSERT((__arr_rename_at_2_97((__i_rename_at_5_98 - 1),__context__) < __arr_rename_at_2_97(__i_rename_at_5_98,__context__)));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_5_98));
+    };
+    builtin_sort_dim_any_ref_cblock_T(das_arg<TDim<uint32_t,4>>::pass(__arr_rename_at_2_97),4,4,[&](uint32_t const  __a_rename_at_8_99, uint32_t const  __b_rename_at_8_100) DAS_AOT_INLINE_LAMBDA -> bool{
+        return das_auto_cast<bool>::cast(!(__a_rename_at_8_99 < __b_rename_at_8_100));
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    {
+        bool __need_loop_9 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,4));
+        int32_t __i_rename_at_9_101;
+        __need_loop_9 = __i_iterator.first(__context__,(__i_rename_at_9_101)) && __need_loop_9;
+        for ( ; __need_loop_9 ; __need_loop_9 = __i_iterator.next(__context__,(__i_rename_at_9_101)) )
+        {
+            DAS_ASSERT((!(__arr_rename_at_2_97((__i_rename_at_9_101 - 1),__context__) < __arr_rename_at_2_97(__i_rename_at_9_101,__context__))));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_9_101));
+    };
+}
+
+inline TArray<uint32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_7ade2ac99f7a944f ( Context * __context__, TDim<uint32_t,4> &  __a_rename_at_1502_102 )
+{
+    TArray<uint32_t> __arr_rename_at_1504_103;das_zero(__arr_rename_at_1504_103);
+    _FuncbuiltinTickresizeTick4811697762258667383_fe200b84d41b4211(__context__,das_arg<TArray<uint32_t>>::pass(__arr_rename_at_1504_103),4);
+    das_copy(das_cast<TDim<uint32_t,4>>::cast(das_ref(__context__,__arr_rename_at_1504_103(0,__context__))),__a_rename_at_1502_102);
+    return /* <- */ das_auto_cast_move<TArray<uint32_t>>::cast(__arr_rename_at_1504_103);
+}
+
+inline void _FuncTicktest_sortTick14882388544287305087_906aaf2fcb98d109 ( Context * __context__, TDim<int64_t,4> &  __arr_rename_at_2_104 )
+{
+    _FuncbuiltinTicksortTick71647573575886987_70390692b0074add(__context__,das_arg<TDim<int64_t,4>>::pass(__arr_rename_at_2_104));
+    {
+        bool __need_loop_5 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,4));
+        int32_t __i_rename_at_5_105;
+        __need_loop_5 = __i_iterator.first(__context__,(__i_rename_at_5_105)) && __need_loop_5;
+        for ( ; __need_loop_5 ; __need_loop_5 = __i_iterator.next(__context__,(__i_rename_at_5_105)) )
+        {
+            DAS_ASSERT((__arr_rename_at_2_104((__i_rename_at_5_105 - 1),__context__) < __arr_rename_at_2_104(__i_rename_at_5_105,__context__)));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_5_105));
+    };
+    builtin_sort_dim_any_ref_cblock_T(das_arg<TDim<int64_t,4>>::pass(__arr_rename_at_2_104),8,4,[&](int64_t const  __a_rename_at_8_106, int64_t const  __b_rename_at_8_107) DAS_AOT_INLINE_LAMBDA -> bool{
+        return das_auto_cast<bool>::cast(!(__a_rename_at_8_106 < __b_rename_at_8_107));
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    {
+        bool __need_loop_9 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,4));
+        int32_t __i_rename_at_9_108;
+        __need_loop_9 = __i_iterator.first(__context__,(__i_rename_at_9_108)) && __need_loop_9;
+        for ( ; __need_loop_9 ; __need_loop_9 = __i_iterator.next(__context__,(__i_rename_at_9_108)) )
+        {
+            DAS_ASSERT((!(__arr_rename_at_2_104((__i_rename_at_9_108 - 1),__context__) < __arr_rename_at_2_104(__i_rename_at_9_108,__context__))));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_9_108));
+    };
+}
+
+inline TArray<int64_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_4bdd39108bb81bb1 ( Context * __context__, TDim<int64_t,4> &  __a_rename_at_1502_109 )
+{
+    TArray<int64_t> __arr_rename_at_1504_110;das_zero(__arr_rename_at_1504_110);
+    _FuncbuiltinTickresizeTick4811697762258667383_9cee684a9afdf22a(__context__,das_arg<TArray<int64_t>>::pass(__arr_rename_at_1504_110),4);
+    das_copy(das_cast<TDim<int64_t,4>>::cast(das_ref(__context__,__arr_rename_at_1504_110(0,__context__))),__a_rename_at_1502_109);
+    return /* <- */ das_auto_cast_move<TArray<int64_t>>::cast(__arr_rename_at_1504_110);
+}
+
+inline void _FuncTicktest_sortTick14882388544287305087_b7e56a417eeac2b1 ( Context * __context__, TDim<uint64_t,4> &  __arr_rename_at_2_111 )
+{
+    _FuncbuiltinTicksortTick71647573575886987_f4f63ea13b0a8b50(__context__,das_arg<TDim<uint64_t,4>>::pass(__arr_rename_at_2_111));
+    {
+        bool __need_loop_5 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,4));
+        int32_t __i_rename_at_5_112;
+        __need_loop_5 = __i_iterator.first(__context__,(__i_rename_at_5_112)) && __need_loop_5;
+        for ( ; __need_loop_5 ; __need_loop_5 = __i_iterator.next(__context__,(__i_rename_at_5_112)) )
+        {
+            DAS_ASSERT((__arr_rename_at_2_111((__i_rename_at_5_112 - 1),__context__) < __arr_rename_at_2_111(__i_rename_at_5_112,__context__)));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_5_112));
+    };
+    builtin_sort_dim_any_ref_cblock_T(das_arg<TDim<uint64_t,4>>::pass(__arr_rename_at_2_111),8,4,[&](uint64_t const  __a_rename_at_8_113, uint64_t const  __b_rename_at_8_114) DAS_AOT_INLINE_LAMBDA -> bool{
+        return das_auto_cast<bool>::cast(!(__a_rename_at_8_113 < __b_rename_at_8_114));
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    {
+        bool __need_loop_9 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,4));
+        int32_t __i_rename_at_9_115;
+        __need_loop_9 = __i_iterator.first(__context__,(__i_rename_at_9_115)) && __need_loop_9;
+        for ( ; __need_loop_9 ; __need_loop_9 = __i_iterator.next(__context__,(__i_rename_at_9_115)) )
+        {
+            DAS_ASSERT((!(__arr_rename_at_2_111((__i_rename_at_9_115 - 1),__context__) < __arr_rename_at_2_111(__i_rename_at_9_115,__context__))));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_9_115));
+    };
+}
+
+inline TArray<uint64_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_a734db502d6a5a7a ( Context * __context__, TDim<uint64_t,4> &  __a_rename_at_1502_116 )
+{
+    TArray<uint64_t> __arr_rename_at_1504_117;das_zero(__arr_rename_at_1504_117);
+    _FuncbuiltinTickresizeTick4811697762258667383_5e7dacd12cf28329(__context__,das_arg<TArray<uint64_t>>::pass(__arr_rename_at_1504_117),4);
+    das_copy(das_cast<TDim<uint64_t,4>>::cast(das_ref(__context__,__arr_rename_at_1504_117(0,__context__))),__a_rename_at_1502_116);
+    return /* <- */ das_auto_cast_move<TArray<uint64_t>>::cast(__arr_rename_at_1504_117);
+}
+
+inline void _FuncTicktest_sortTick14882388544287305087_b7abdee641b4c258 ( Context * __context__, TDim<float,4> &  __arr_rename_at_2_118 )
+{
+    _FuncbuiltinTicksortTick71647573575886987_d66ebefc2dda47c(__context__,das_arg<TDim<float,4>>::pass(__arr_rename_at_2_118));
+    {
+        bool __need_loop_5 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,4));
+        int32_t __i_rename_at_5_119;
+        __need_loop_5 = __i_iterator.first(__context__,(__i_rename_at_5_119)) && __need_loop_5;
+        for ( ; __need_loop_5 ; __need_loop_5 = __i_iterator.next(__context__,(__i_rename_at_5_119)) )
+        {
+            DAS_ASSERT((__arr_rename_at_2_118((__i_rename_at_5_119 - 1),__context__) < __arr_rename_at_2_118(__i_rename_at_5_119,__context__)));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_5_119));
+    };
+    builtin_sort_dim_any_ref_cblock_T(das_arg<TDim<float,4>>::pass(__arr_rename_at_2_118),4,4,[&](float const  __a_rename_at_8_120, float const  __b_rename_at_8_121) DAS_AOT_INLINE_LAMBDA -> bool{
+        return das_auto_cast<bool>::cast(!(__a_rename_at_8_120 < __b_rename_at_8_121));
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    {
+        bool __need_loop_9 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,4));
+        int32_t __i_rename_at_9_122;
+        __need_loop_9 = __i_iterator.first(__context__,(__i_rename_at_9_122)) && __need_loop_9;
+        for ( ; __need_loop_9 ; __need_loop_9 = __i_iterator.next(__context__,(__i_rename_at_9_122)) )
+        {
+            DAS_ASSERT((!(__arr_rename_at_2_118((__i_rename_at_9_122 - 1),__context__) < __arr_rename_at_2_118(__i_rename_at_9_122,__context__))));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_9_122));
+    };
+}
+
+inline TArray<float> _FuncbuiltinTickto_array_moveTick3185538323411982277_e275dfafa0fc87f8 ( Context * __context__, TDim<float,4> &  __a_rename_at_1502_123 )
+{
+    TArray<float> __arr_rename_at_1504_124;das_zero(__arr_rename_at_1504_124);
+    _FuncbuiltinTickresizeTick4811697762258667383_e3c7d561173b49d9(__context__,das_arg<TArray<float>>::pass(__arr_rename_at_1504_124),4);
+    das_copy(das_cast<TDim<float,4>>::cast(das_ref(__context__,__arr_rename_at_1504_124(0,__context__))),__a_rename_at_1502_123);
+    return /* <- */ das_auto_cast_move<TArray<float>>::cast(__arr_rename_at_1504_124);
+}
+
+inline void _FuncTicktest_sortTick14882388544287305087_c21a48225ffe2376 ( Context * __context__, TDim<double,4> &  __arr_rename_at_2_125 )
+{
+    _FuncbuiltinTicksortTick71647573575886987_db7cbee77eb91161(__context__,das_arg<TDim<double,4>>::pass(__arr_rename_at_2_125));
+    {
+        bool __need_loop_5 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,4));
+        int32_t __i_rename_at_5_126;
+        __need_loop_5 = __i_iterator.first(__context__,(__i_rename_at_5_126)) && __need_loop_5;
+        for ( ; __need_loop_5 ; __need_loop_5 = __i_iterator.next(__context__,(__i_rename_at_5_126)) )
+        {
+            DAS_ASSERT((__arr_rename_at_2_125((__i_rename_at_5_126 - 1),__context__) < __arr_rename_at_2_125(__i_rename_at_5_126,__context__)));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_5_126));
+    };
+    builtin_sort_dim_any_ref_cblock_T(das_arg<TDim<double,4>>::pass(__arr_rename_at_2_125),8,4,[&](double const  __a_rename_at_8_127, double const  __b_rename_at_8_128) DAS_AOT_INLINE_LAMBDA -> bool{
+        return das_auto_cast<bool>::cast(!(__a_rename_at_8_127 < __b_rename_at_8_128));
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    {
+        bool __need_loop_9 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,4));
+        int32_t __i_rename_at_9_129;
+        __need_loop_9 = __i_iterator.first(__context__,(__i_rename_at_9_129)) && __need_loop_9;
+        for ( ; __need_loop_9 ; __need_loop_9 = __i_iterator.next(__context__,(__i_rename_at_9_129)) )
+        {
+            DAS_ASSERT((!(__arr_rename_at_2_125((__i_rename_at_9_129 - 1),__context__) < __arr_rename_at_2_125(__i_rename_at_9_129,__context__))));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_9_129));
+    };
+}
+
+inline TArray<double> _FuncbuiltinTickto_array_moveTick3185538323411982277_1bec3c8b815fe304 ( Context * __context__, TDim<double,4> &  __a_rename_at_1502_130 )
+{
+    TArray<double> __arr_rename_at_1504_131;das_zero(__arr_rename_at_1504_131);
+    _FuncbuiltinTickresizeTick4811697762258667383_2ebf1e4f1ba4dc01(__context__,das_arg<TArray<double>>::pass(__arr_rename_at_1504_131),4);
+    das_copy(das_cast<TDim<double,4>>::cast(das_ref(__context__,__arr_rename_at_1504_131(0,__context__))),__a_rename_at_1502_130);
+    return /* <- */ das_auto_cast_move<TArray<double>>::cast(__arr_rename_at_1504_131);
+}
+
+inline void _FuncTicktest_sortTick14882388544287305087_c2c9f768e3d98b72 ( Context * __context__, TDim<char *,4> &  __arr_rename_at_2_132 )
+{
+    _FuncbuiltinTicksortTick71647573575886987_eaf601c6431550b4(__context__,das_arg<TDim<char *,4>>::pass(__arr_rename_at_2_132));
+    {
+        bool __need_loop_5 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,4));
+        int32_t __i_rename_at_5_133;
+        __need_loop_5 = __i_iterator.first(__context__,(__i_rename_at_5_133)) && __need_loop_5;
+        for ( ; __need_loop_5 ; __need_loop_5 = __i_iterator.next(__context__,(__i_rename_at_5_133)) )
+        {
+            DAS_ASSERT((SimPolicy<char *>::Less(cast<char *>::from(__arr_rename_at_2_132((__i_rename_at_5_133 - 1),__context__)),cast<char *>::from(__arr_rename_at_2_132(__i_rename_at_5_133,__context__)),*__context__,nullptr)));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_5_133));
+    };
+    builtin_sort_dim_any_ref_cblock_T(das_arg<TDim<char *,4>>::pass(__arr_rename_at_2_132),8,4,[&](char * const  __a_rename_at_8_134, char * const  __b_rename_at_8_135) DAS_AOT_INLINE_LAMBDA -> bool{
+        return das_auto_cast<bool>::cast(!(SimPolicy<char *>::Less(cast<char *>::from(__a_rename_at_8_134),cast<char *>::from(__b_rename_at_8_135),*__context__,nullptr)));
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    {
+        bool __need_loop_9 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,4));
+        int32_t __i_rename_at_9_136;
+        __need_loop_9 = __i_iterator.first(__context__,(__i_rename_at_9_136)) && __need_loop_9;
+        for ( ; __need_loop_9 ; __need_loop_9 = __i_iterator.next(__context__,(__i_rename_at_9_136)) )
+        {
+            DAS_ASSERT((!(SimPolicy<char *>::Less(cast<char *>::from(__arr_rename_at_2_132((__i_rename_at_9_136 - 1),__context__)),cast<char *>::from(__arr_rename_at_2_132(__i_rename_at_9_136,__context__)),*__context__,nullptr))));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_9_136));
+    };
+}
+
+inline TArray<char *> _FuncbuiltinTickto_array_moveTick3185538323411982277_d862e40791f6bc49 ( Context * __context__, TDim<char *,4> &  __a_rename_at_1502_137 )
+{
+    TArray<char *> __arr_rename_at_1504_138;das_zero(__arr_rename_at_1504_138);
+    _FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_1504_138),4);
+    das_copy(das_cast<TDim<char *,4>>::cast(das_ref(__context__,__arr_rename_at_1504_138(0,__context__))),__a_rename_at_1502_137);
+    return /* <- */ das_auto_cast_move<TArray<char *>>::cast(__arr_rename_at_1504_138);
+}
+
+inline bool _FuncLess_57166e1ce4637f88 ( Context * __context__, Foo const  &  __a_rename_at_28_139, Foo const  &  __b_rename_at_28_140 )
+{
+    return das_auto_cast<bool>::cast((__a_rename_at_28_139.x + __a_rename_at_28_139.y) < (__b_rename_at_28_140.x + __b_rename_at_28_140.y));
+}
+
+inline void test_vector_sort_608c89507a554eda ( Context * __context__ )
+{
+    TArray<float2> __arr_rename_at_33_141;das_zero(__arr_rename_at_33_141);
+    _FuncbuiltinTickpushTick14133213201864676143_61c98bc08ecd13d6(__context__,das_arg<TArray<float2>>::pass(__arr_rename_at_33_141),v_make_vec4f(4.000000e+00f,0.000000e+00f,0.f,0.f));
+    _FuncbuiltinTickpushTick14133213201864676143_61c98bc08ecd13d6(__context__,das_arg<TArray<float2>>::pass(__arr_rename_at_33_141),v_make_vec4f(3.000000e+00f,1.000000e+00f,0.f,0.f));
+    _FuncbuiltinTickpushTick14133213201864676143_61c98bc08ecd13d6(__context__,das_arg<TArray<float2>>::pass(__arr_rename_at_33_141),v_make_vec4f(5.000000e+00f,2.000000e+00f,0.f,0.f));
+    _FuncTicktest_sort_compTick14790097101432932268_691a3401464da1b8(__context__,das_arg<TArray<float2>>::pass(__arr_rename_at_33_141));
+}
+
+inline bool test_a8dc9cc8d40b618d ( Context * __context__ )
+{
+    TDim<int32_t,4> _temp_make_local_43_14_0; _temp_make_local_43_14_0;
+    TArray<int32_t> _temp_make_local_44_14_1; _temp_make_local_44_14_1;
+    TDim<int32_t,4> _temp_make_local_44_14_2; _temp_make_local_44_14_2;
+    TDim<uint32_t,4> _temp_make_local_45_14_3; _temp_make_local_45_14_3;
+    TArray<uint32_t> _temp_make_local_46_14_4; _temp_make_local_46_14_4;
+    TDim<uint32_t,4> _temp_make_local_46_14_5; _temp_make_local_46_14_5;
+    TDim<int64_t,4> _temp_make_local_47_14_6; _temp_make_local_47_14_6;
+    TArray<int64_t> _temp_make_local_48_14_7; _temp_make_local_48_14_7;
+    TDim<int64_t,4> _temp_make_local_48_14_8; _temp_make_local_48_14_8;
+    TDim<uint64_t,4> _temp_make_local_49_14_9; _temp_make_local_49_14_9;
+    TArray<uint64_t> _temp_make_local_50_14_10; _temp_make_local_50_14_10;
+    TDim<uint64_t,4> _temp_make_local_50_14_11; _temp_make_local_50_14_11;
+    TDim<float,4> _temp_make_local_51_14_12; _temp_make_local_51_14_12;
+    TArray<float> _temp_make_local_52_14_13; _temp_make_local_52_14_13;
+    TDim<float,4> _temp_make_local_52_14_14; _temp_make_local_52_14_14;
+    TDim<double,4> _temp_make_local_53_14_15; _temp_make_local_53_14_15;
+    TArray<double> _temp_make_local_54_14_16; _temp_make_local_54_14_16;
+    TDim<double,4> _temp_make_local_54_14_17; _temp_make_local_54_14_17;
+    TDim<char *,4> _temp_make_local_56_14_18; _temp_make_local_56_14_18;
+    TArray<char *> _temp_make_local_57_14_19; _temp_make_local_57_14_19;
+    TDim<char *,4> _temp_make_local_57_14_20; _temp_make_local_57_14_20;
+    TArray<Foo> _temp_make_local_59_14_21; _temp_make_local_59_14_21;
+    TDim<Foo,4> _temp_make_local_59_14_22; _temp_make_local_59_14_22;
+    TArray<Foo> _temp_make_local_60_14_23; _temp_make_local_60_14_23;
+    TDim<Foo,4> _temp_make_local_60_14_24; _temp_make_local_60_14_24;
+    _FuncTicktest_sortTick14882388544287305087_2dd6259fe5cba16(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+        _temp_make_local_43_14_0(0,__context__) = 3;
+        _temp_make_local_43_14_0(1,__context__) = 2;
+        _temp_make_local_43_14_0(2,__context__) = 4;
+        _temp_make_local_43_14_0(3,__context__) = 1;
+        return _temp_make_local_43_14_0;
+    })())));
+    _FuncTicktest_sortTick14882388544287305087_7af9efc971e9806e(__context__,das_arg<TArray<int32_t>>::pass((_temp_make_local_44_14_1 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+        _temp_make_local_44_14_2(0,__context__) = 3;
+        _temp_make_local_44_14_2(1,__context__) = 2;
+        _temp_make_local_44_14_2(2,__context__) = 4;
+        _temp_make_local_44_14_2(3,__context__) = 1;
+        return _temp_make_local_44_14_2;
+    })())))))));
+    _FuncTicktest_sortTick14882388544287305087_3b7d432ec644929d(__context__,das_arg<TDim<uint32_t,4>>::pass((([&]() -> TDim<uint32_t,4>& {
+        _temp_make_local_45_14_3(0,__context__) = 0x3u;
+        _temp_make_local_45_14_3(1,__context__) = 0x2u;
+        _temp_make_local_45_14_3(2,__context__) = 0x4u;
+        _temp_make_local_45_14_3(3,__context__) = 0x1u;
+        return _temp_make_local_45_14_3;
+    })())));
+    _FuncTicktest_sortTick14882388544287305087_d7a346f80b1aad16(__context__,das_arg<TArray<uint32_t>>::pass((_temp_make_local_46_14_4 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_7ade2ac99f7a944f(__context__,das_arg<TDim<uint32_t,4>>::pass((([&]() -> TDim<uint32_t,4>& {
+        _temp_make_local_46_14_5(0,__context__) = 0x3u;
+        _temp_make_local_46_14_5(1,__context__) = 0x2u;
+        _temp_make_local_46_14_5(2,__context__) = 0x4u;
+        _temp_make_local_46_14_5(3,__context__) = 0x1u;
+        return _temp_make_local_46_14_5;
+    })())))))));
+    _FuncTicktest_sortTick14882388544287305087_906aaf2fcb98d109(__context__,das_arg<TDim<int64_t,4>>::pass((([&]() -> TDim<int64_t,4>& {
+        _temp_make_local_47_14_6(0,__context__) = INT64_C(3);
+        _temp_make_local_47_14_6(1,__context__) = INT64_C(2);
+        _temp_make_local_47_14_6(2,__context__) = INT64_C(4);
+        _temp_make_local_47_14_6(3,__context__) = INT64_C(1);
+        return _temp_make_local_47_14_6;
+    })())));
+    _FuncTicktest_sortTick14882388544287305087_cd56f7bd6056d604(__context__,das_arg<TArray<int64_t>>::pass((_temp_make_local_48_14_7 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_4bdd39108bb81bb1(__context__,das_arg<TDim<int64_t,4>>::pass((([&]() -> TDim<int64_t,4>& {
+        _temp_make_local_48_14_8(0,__context__) = INT64_C(3);
+        _temp_make_local_48_14_8(1,__context__) = INT64_C(2);
+        _temp_make_local_48_14_8(2,__context__) = INT64_C(4);
+        _temp_make_local_48_14_8(3,__context__) = INT64_C(1);
+        return _temp_make_local_48_14_8;
+    })())))))));
+    _FuncTicktest_sortTick14882388544287305087_b7e56a417eeac2b1(__context__,das_arg<TDim<uint64_t,4>>::pass((([&]() -> TDim<uint64_t,4>& {
+        _temp_make_local_49_14_9(0,__context__) = UINT64_C(0x3);
+        _temp_make_local_49_14_9(1,__context__) = UINT64_C(0x2);
+        _temp_make_local_49_14_9(2,__context__) = UINT64_C(0x4);
+        _temp_make_local_49_14_9(3,__context__) = UINT64_C(0x1);
+        return _temp_make_local_49_14_9;
+    })())));
+    _FuncTicktest_sortTick14882388544287305087_7dd751594edd4e5e(__context__,das_arg<TArray<uint64_t>>::pass((_temp_make_local_50_14_10 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_a734db502d6a5a7a(__context__,das_arg<TDim<uint64_t,4>>::pass((([&]() -> TDim<uint64_t,4>& {
+        _temp_make_local_50_14_11(0,__context__) = UINT64_C(0x3);
+        _temp_make_local_50_14_11(1,__context__) = UINT64_C(0x2);
+        _temp_make_local_50_14_11(2,__context__) = UINT64_C(0x4);
+        _temp_make_local_50_14_11(3,__context__) = UINT64_C(0x1);
+        return _temp_make_local_50_14_11;
+    })())))))));
+    _FuncTicktest_sortTick14882388544287305087_b7abdee641b4c258(__context__,das_arg<TDim<float,4>>::pass((([&]() -> TDim<float,4>& {
+        _temp_make_local_51_14_12(0,__context__) = 3.000000e+00f;
+        _temp_make_local_51_14_12(1,__context__) = 2.000000e+00f;
+        _temp_make_local_51_14_12(2,__context__) = 4.000000e+00f;
+        _temp_make_local_51_14_12(3,__context__) = 1.000000e+00f;
+        return _temp_make_local_51_14_12;
+    })())));
+    _FuncTicktest_sortTick14882388544287305087_a3ae96aa481b8279(__context__,das_arg<TArray<float>>::pass((_temp_make_local_52_14_13 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_e275dfafa0fc87f8(__context__,das_arg<TDim<float,4>>::pass((([&]() -> TDim<float,4>& {
+        _temp_make_local_52_14_14(0,__context__) = 3.000000e+00f;
+        _temp_make_local_52_14_14(1,__context__) = 2.000000e+00f;
+        _temp_make_local_52_14_14(2,__context__) = 4.000000e+00f;
+        _temp_make_local_52_14_14(3,__context__) = 1.000000e+00f;
+        return _temp_make_local_52_14_14;
+    })())))))));
+    _FuncTicktest_sortTick14882388544287305087_c21a48225ffe2376(__context__,das_arg<TDim<double,4>>::pass((([&]() -> TDim<double,4>& {
+        _temp_make_local_53_14_15(0,__context__) = 3.000000e+00;
+        _temp_make_local_53_14_15(1,__context__) = 2.000000e+00;
+        _temp_make_local_53_14_15(2,__context__) = 4.000000e+00;
+        _temp_make_local_53_14_15(3,__context__) = 1.000000e+00;
+        return _temp_make_local_53_14_15;
+    })())));
+    _FuncTicktest_sortTick14882388544287305087_e4ec06953c3e8538(__context__,das_arg<TArray<double>>::pass((_temp_make_local_54_14_16 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_1bec3c8b815fe304(__context__,das_arg<TDim<double,4>>::pass((([&]() -> TDim<double,4>& {
+        _temp_make_local_54_14_17(0,__context__) = 3.000000e+00;
+        _temp_make_local_54_14_17(1,__context__) = 2.000000e+00;
+        _temp_make_local_54_14_17(2,__context__) = 4.000000e+00;
+        _temp_make_local_54_14_17(3,__context__) = 1.000000e+00;
+        return _temp_make_local_54_14_17;
+    })())))))));
+    _FuncTicktest_sortTick14882388544287305087_c2c9f768e3d98b72(__context__,das_arg<TDim<char *,4>>::pass((([&]() -> TDim<char *,4>& {
+        _temp_make_local_56_14_18(0,__context__) = ((char *) "3.0lf");
+        _temp_make_local_56_14_18(1,__context__) = ((char *) "2.0lf");
+        _temp_make_local_56_14_18(2,__context__) = ((char *) "4.0lf");
+        _temp_make_local_56_14_18(3,__context__) = ((char *) "1.0lf");
+        return _temp_make_local_56_14_18;
+    })())));
+    _FuncTicktest_sortTick14882388544287305087_f37c08a7182c5491(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_57_14_19 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_d862e40791f6bc49(__context__,das_arg<TDim<char *,4>>::pass((([&]() -> TDim<char *,4>& {
+        _temp_make_local_57_14_20(0,__context__) = ((char *) "3.0lf");
+        _temp_make_local_57_14_20(1,__context__) = ((char *) "2.0lf");
+        _temp_make_local_57_14_20(2,__context__) = ((char *) "4.0lf");
+        _temp_make_local_57_14_20(3,__context__) = ((char *) "1.0lf");
+        return _temp_make_local_57_14_20;
+    })())))))));
+    _FuncTicktest_sortTick14882388544287305087_3b76931a16654431(__context__,das_arg<TArray<Foo>>::pass((_temp_make_local_59_14_21 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_30001f9d1745e610(__context__,das_arg<TDim<Foo,4>>::pass((([&]() -> TDim<Foo,4>& {
+        _temp_make_local_59_14_22(0,__context__) = (([&]() -> Foo {
+            Foo __mks_59;
+            das_copy((__mks_59.x),(1));
+            das_copy((__mks_59.y),(2));
+            return __mks_59;
+        })());
+        _temp_make_local_59_14_22(1,__context__) = (([&]() -> Foo {
+            Foo __mks_59;
+            das_copy((__mks_59.x),(1));
+            das_copy((__mks_59.y),(1));
+            return __mks_59;
+        })());
+        _temp_make_local_59_14_22(2,__context__) = (([&]() -> Foo {
+            Foo __mks_59;
+            das_copy((__mks_59.x),(2));
+            das_copy((__mks_59.y),(2));
+            return __mks_59;
+        })());
+        _temp_make_local_59_14_22(3,__context__) = (([&]() -> Foo {
+            Foo __mks_59;
+            das_copy((__mks_59.x),(0));
+            das_copy((__mks_59.y),(1));
+            return __mks_59;
+        })());
+        return _temp_make_local_59_14_22;
+    })())))))));
+    _FuncTicktest_sortTick14882388544287305087_3b76931a16654431(__context__,das_arg<TArray<Foo>>::pass((_temp_make_local_60_14_23 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_30001f9d1745e610(__context__,das_arg<TDim<Foo,4>>::pass((([&]() -> TDim<Foo,4>& {
+        _temp_make_local_60_14_24(0,__context__) = (([&]() -> Foo {
+            Foo __mks_60;
+            das_copy((__mks_60.x),(1));
+            das_copy((__mks_60.y),(2));
+            return __mks_60;
+        })());
+        _temp_make_local_60_14_24(1,__context__) = (([&]() -> Foo {
+            Foo __mks_60;
+            das_copy((__mks_60.x),(1));
+            das_copy((__mks_60.y),(1));
+            return __mks_60;
+        })());
+        _temp_make_local_60_14_24(2,__context__) = (([&]() -> Foo {
+            Foo __mks_60;
+            das_copy((__mks_60.x),(2));
+            das_copy((__mks_60.y),(2));
+            return __mks_60;
+        })());
+        _temp_make_local_60_14_24(3,__context__) = (([&]() -> Foo {
+            Foo __mks_60;
+            das_copy((__mks_60.x),(0));
+            das_copy((__mks_60.y),(1));
+            return __mks_60;
+        })());
+        return _temp_make_local_60_14_24;
+    })())))))));
+    test_vector_sort_608c89507a554eda(__context__);
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_a52a306418c09be9 ( Context * __context__ ) {
+    TArray<Foo> &  arg_Arr = cast_aot_arg<TArray<Foo> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_a52a306418c09be9(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_fe200b84d41b4211 ( Context * __context__ ) {
+    TArray<uint32_t> &  arg_Arr = cast_aot_arg<TArray<uint32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_fe200b84d41b4211(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_9cee684a9afdf22a ( Context * __context__ ) {
+    TArray<int64_t> &  arg_Arr = cast_aot_arg<TArray<int64_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_9cee684a9afdf22a(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_5e7dacd12cf28329 ( Context * __context__ ) {
+    TArray<uint64_t> &  arg_Arr = cast_aot_arg<TArray<uint64_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_5e7dacd12cf28329(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_e3c7d561173b49d9 ( Context * __context__ ) {
+    TArray<float> &  arg_Arr = cast_aot_arg<TArray<float> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_e3c7d561173b49d9(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2ebf1e4f1ba4dc01 ( Context * __context__ ) {
+    TArray<double> &  arg_Arr = cast_aot_arg<TArray<double> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2ebf1e4f1ba4dc01(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009 ( Context * __context__ ) {
+    TArray<char *> &  arg_Arr = cast_aot_arg<TArray<char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTicksortTick14088969635007481283_efe19cb88d1f917a ( Context * __context__ ) {
+    TArray<Foo> &  arg_a = cast_aot_arg<TArray<Foo> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTicksortTick14088969635007481283_efe19cb88d1f917a(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTicksortTick14088969635007481283_fd6ac0e411144b9 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTicksortTick14088969635007481283_fd6ac0e411144b9(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTicksortTick14088969635007481283_11bf20031eb498a2 ( Context * __context__ ) {
+    TArray<uint32_t> &  arg_a = cast_aot_arg<TArray<uint32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTicksortTick14088969635007481283_11bf20031eb498a2(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTicksortTick14088969635007481283_b558576975fcdb2f ( Context * __context__ ) {
+    TArray<int64_t> &  arg_a = cast_aot_arg<TArray<int64_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTicksortTick14088969635007481283_b558576975fcdb2f(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTicksortTick14088969635007481283_3142a640bd8b73a2 ( Context * __context__ ) {
+    TArray<uint64_t> &  arg_a = cast_aot_arg<TArray<uint64_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTicksortTick14088969635007481283_3142a640bd8b73a2(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTicksortTick14088969635007481283_b131f13803ba6fda ( Context * __context__ ) {
+    TArray<float> &  arg_a = cast_aot_arg<TArray<float> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTicksortTick14088969635007481283_b131f13803ba6fda(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTicksortTick14088969635007481283_1e8d6def1ddc124a ( Context * __context__ ) {
+    TArray<double> &  arg_a = cast_aot_arg<TArray<double> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTicksortTick14088969635007481283_1e8d6def1ddc124a(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTicksortTick14088969635007481283_8c68d010851e6432 ( Context * __context__ ) {
+    TArray<char *> &  arg_a = cast_aot_arg<TArray<char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTicksortTick14088969635007481283_8c68d010851e6432(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_sortTick14882388544287305087_3b76931a16654431 ( Context * __context__ ) {
+    TArray<Foo> &  arg_arr = cast_aot_arg<TArray<Foo> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_sortTick14882388544287305087_3b76931a16654431(__context__, arg_arr);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTicksortTick71647573575886987_299c8d677e877ae2 ( Context * __context__ ) {
+    TDim<int32_t,4> &  arg_a = cast_aot_arg<TDim<int32_t,4> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTicksortTick71647573575886987_299c8d677e877ae2(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTicksortTick71647573575886987_c4f76281e283da54 ( Context * __context__ ) {
+    TDim<uint32_t,4> &  arg_a = cast_aot_arg<TDim<uint32_t,4> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTicksortTick71647573575886987_c4f76281e283da54(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTicksortTick71647573575886987_70390692b0074add ( Context * __context__ ) {
+    TDim<int64_t,4> &  arg_a = cast_aot_arg<TDim<int64_t,4> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTicksortTick71647573575886987_70390692b0074add(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTicksortTick71647573575886987_f4f63ea13b0a8b50 ( Context * __context__ ) {
+    TDim<uint64_t,4> &  arg_a = cast_aot_arg<TDim<uint64_t,4> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTicksortTick71647573575886987_f4f63ea13b0a8b50(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTicksortTick71647573575886987_d66ebefc2dda47c ( Context * __context__ ) {
+    TDim<float,4> &  arg_a = cast_aot_arg<TDim<float,4> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTicksortTick71647573575886987_d66ebefc2dda47c(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTicksortTick71647573575886987_db7cbee77eb91161 ( Context * __context__ ) {
+    TDim<double,4> &  arg_a = cast_aot_arg<TDim<double,4> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTicksortTick71647573575886987_db7cbee77eb91161(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTicksortTick71647573575886987_eaf601c6431550b4 ( Context * __context__ ) {
+    TDim<char *,4> &  arg_a = cast_aot_arg<TDim<char *,4> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTicksortTick71647573575886987_eaf601c6431550b4(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_sortTick14882388544287305087_7af9efc971e9806e ( Context * __context__ ) {
+    TArray<int32_t> &  arg_arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_sortTick14882388544287305087_7af9efc971e9806e(__context__, arg_arr);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_sortTick14882388544287305087_d7a346f80b1aad16 ( Context * __context__ ) {
+    TArray<uint32_t> &  arg_arr = cast_aot_arg<TArray<uint32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_sortTick14882388544287305087_d7a346f80b1aad16(__context__, arg_arr);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_sortTick14882388544287305087_cd56f7bd6056d604 ( Context * __context__ ) {
+    TArray<int64_t> &  arg_arr = cast_aot_arg<TArray<int64_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_sortTick14882388544287305087_cd56f7bd6056d604(__context__, arg_arr);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_sortTick14882388544287305087_7dd751594edd4e5e ( Context * __context__ ) {
+    TArray<uint64_t> &  arg_arr = cast_aot_arg<TArray<uint64_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_sortTick14882388544287305087_7dd751594edd4e5e(__context__, arg_arr);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_sortTick14882388544287305087_a3ae96aa481b8279 ( Context * __context__ ) {
+    TArray<float> &  arg_arr = cast_aot_arg<TArray<float> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_sortTick14882388544287305087_a3ae96aa481b8279(__context__, arg_arr);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_sortTick14882388544287305087_e4ec06953c3e8538 ( Context * __context__ ) {
+    TArray<double> &  arg_arr = cast_aot_arg<TArray<double> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_sortTick14882388544287305087_e4ec06953c3e8538(__context__, arg_arr);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_sortTick14882388544287305087_f37c08a7182c5491 ( Context * __context__ ) {
+    TArray<char *> &  arg_arr = cast_aot_arg<TArray<char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_sortTick14882388544287305087_f37c08a7182c5491(__context__, arg_arr);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_30001f9d1745e610 ( Context * __context__ ) {
+    TDim<Foo,4> &  arg_a = cast_aot_arg<TDim<Foo,4> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<Foo> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_30001f9d1745e610(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpushTick14133213201864676143_61c98bc08ecd13d6 ( Context * __context__ ) {
+    TArray<float2> &  arg_Arr = cast_aot_arg<TArray<float2> & >::to(*__context__,__context__->abiArguments()[0]);
+    float2 arg_value = cast_aot_arg<float2>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick14133213201864676143_61c98bc08ecd13d6(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_sort_compTick14790097101432932268_691a3401464da1b8 ( Context * __context__ ) {
+    TArray<float2> &  arg_arr = cast_aot_arg<TArray<float2> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_sort_compTick14790097101432932268_691a3401464da1b8(__context__, arg_arr);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_sortTick14882388544287305087_2dd6259fe5cba16 ( Context * __context__ ) {
+    TDim<int32_t,4> &  arg_arr = cast_aot_arg<TDim<int32_t,4> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_sortTick14882388544287305087_2dd6259fe5cba16(__context__, arg_arr);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18 ( Context * __context__ ) {
+    TDim<int32_t,4> &  arg_a = cast_aot_arg<TDim<int32_t,4> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_sortTick14882388544287305087_3b7d432ec644929d ( Context * __context__ ) {
+    TDim<uint32_t,4> &  arg_arr = cast_aot_arg<TDim<uint32_t,4> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_sortTick14882388544287305087_3b7d432ec644929d(__context__, arg_arr);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_7ade2ac99f7a944f ( Context * __context__ ) {
+    TDim<uint32_t,4> &  arg_a = cast_aot_arg<TDim<uint32_t,4> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<uint32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_7ade2ac99f7a944f(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_sortTick14882388544287305087_906aaf2fcb98d109 ( Context * __context__ ) {
+    TDim<int64_t,4> &  arg_arr = cast_aot_arg<TDim<int64_t,4> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_sortTick14882388544287305087_906aaf2fcb98d109(__context__, arg_arr);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_4bdd39108bb81bb1 ( Context * __context__ ) {
+    TDim<int64_t,4> &  arg_a = cast_aot_arg<TDim<int64_t,4> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int64_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_4bdd39108bb81bb1(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_sortTick14882388544287305087_b7e56a417eeac2b1 ( Context * __context__ ) {
+    TDim<uint64_t,4> &  arg_arr = cast_aot_arg<TDim<uint64_t,4> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_sortTick14882388544287305087_b7e56a417eeac2b1(__context__, arg_arr);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_a734db502d6a5a7a ( Context * __context__ ) {
+    TDim<uint64_t,4> &  arg_a = cast_aot_arg<TDim<uint64_t,4> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<uint64_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_a734db502d6a5a7a(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_sortTick14882388544287305087_b7abdee641b4c258 ( Context * __context__ ) {
+    TDim<float,4> &  arg_arr = cast_aot_arg<TDim<float,4> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_sortTick14882388544287305087_b7abdee641b4c258(__context__, arg_arr);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_e275dfafa0fc87f8 ( Context * __context__ ) {
+    TDim<float,4> &  arg_a = cast_aot_arg<TDim<float,4> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<float> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_e275dfafa0fc87f8(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_sortTick14882388544287305087_c21a48225ffe2376 ( Context * __context__ ) {
+    TDim<double,4> &  arg_arr = cast_aot_arg<TDim<double,4> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_sortTick14882388544287305087_c21a48225ffe2376(__context__, arg_arr);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1bec3c8b815fe304 ( Context * __context__ ) {
+    TDim<double,4> &  arg_a = cast_aot_arg<TDim<double,4> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<double> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_1bec3c8b815fe304(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_sortTick14882388544287305087_c2c9f768e3d98b72 ( Context * __context__ ) {
+    TDim<char *,4> &  arg_arr = cast_aot_arg<TDim<char *,4> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_sortTick14882388544287305087_c2c9f768e3d98b72(__context__, arg_arr);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_d862e40791f6bc49 ( Context * __context__ ) {
+    TDim<char *,4> &  arg_a = cast_aot_arg<TDim<char *,4> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<char *> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_d862e40791f6bc49(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncLess_57166e1ce4637f88 ( Context * __context__ ) {
+    Foo const  &  arg_a = cast_aot_arg<Foo const  & >::to(*__context__,__context__->abiArguments()[0]);
+    Foo const  &  arg_b = cast_aot_arg<Foo const  & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_FuncLess_57166e1ce4637f88(__context__, arg_a, arg_b));
+}
+static vec4f __wrap_test_vector_sort_608c89507a554eda ( Context * __context__ ) {
+    test_vector_sort_608c89507a554eda(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_a8dc9cc8d40b618d ( Context * __context__ ) {
+    return cast<bool>::from(test_a8dc9cc8d40b618d(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x902e006224988da8, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_a52a306418c09be9, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_a52a306418c09be9 },
+    { 0xa51a880d594e91fd, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c },
+    { 0x3bfb11e15e05d98a, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_fe200b84d41b4211, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_fe200b84d41b4211 },
+    { 0x53417828251e8615, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_9cee684a9afdf22a, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_9cee684a9afdf22a },
+    { 0x3ab8b3298f60fa49, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_5e7dacd12cf28329, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_5e7dacd12cf28329 },
+    { 0x3a0e82c86652347, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_e3c7d561173b49d9, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_e3c7d561173b49d9 },
+    { 0xe2447c9b54b48fc9, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2ebf1e4f1ba4dc01, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2ebf1e4f1ba4dc01 },
+    { 0xedd3c4f89cba620e, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_e56c873843c4f009 },
+    { 0x79cda8637a8b48b, false, (void*)&_FuncbuiltinTicksortTick14088969635007481283_efe19cb88d1f917a, &__wrap__FuncbuiltinTicksortTick14088969635007481283_efe19cb88d1f917a },
+    { 0xa007c0ac9becf6f2, false, (void*)&_FuncbuiltinTicksortTick14088969635007481283_fd6ac0e411144b9, &__wrap__FuncbuiltinTicksortTick14088969635007481283_fd6ac0e411144b9 },
+    { 0x26ca8b8c7373f, false, (void*)&_FuncbuiltinTicksortTick14088969635007481283_11bf20031eb498a2, &__wrap__FuncbuiltinTicksortTick14088969635007481283_11bf20031eb498a2 },
+    { 0x93c12a379adbf36, false, (void*)&_FuncbuiltinTicksortTick14088969635007481283_b558576975fcdb2f, &__wrap__FuncbuiltinTicksortTick14088969635007481283_b558576975fcdb2f },
+    { 0x35a80832df8c6b0c, false, (void*)&_FuncbuiltinTicksortTick14088969635007481283_3142a640bd8b73a2, &__wrap__FuncbuiltinTicksortTick14088969635007481283_3142a640bd8b73a2 },
+    { 0x57968a2dd738405, false, (void*)&_FuncbuiltinTicksortTick14088969635007481283_b131f13803ba6fda, &__wrap__FuncbuiltinTicksortTick14088969635007481283_b131f13803ba6fda },
+    { 0x6b963538f9c50ef6, false, (void*)&_FuncbuiltinTicksortTick14088969635007481283_1e8d6def1ddc124a, &__wrap__FuncbuiltinTicksortTick14088969635007481283_1e8d6def1ddc124a },
+    { 0x4faa32c476c582ef, false, (void*)&_FuncbuiltinTicksortTick14088969635007481283_8c68d010851e6432, &__wrap__FuncbuiltinTicksortTick14088969635007481283_8c68d010851e6432 },
+    { 0xce3c9a89c161caaf, false, (void*)&_FuncTicktest_sortTick14882388544287305087_3b76931a16654431, &__wrap__FuncTicktest_sortTick14882388544287305087_3b76931a16654431 },
+    { 0xf824bebf475ac0eb, false, (void*)&_FuncbuiltinTicksortTick71647573575886987_299c8d677e877ae2, &__wrap__FuncbuiltinTicksortTick71647573575886987_299c8d677e877ae2 },
+    { 0xd16ad3b89ed4d150, false, (void*)&_FuncbuiltinTicksortTick71647573575886987_c4f76281e283da54, &__wrap__FuncbuiltinTicksortTick71647573575886987_c4f76281e283da54 },
+    { 0xe3a71d838c412795, false, (void*)&_FuncbuiltinTicksortTick71647573575886987_70390692b0074add, &__wrap__FuncbuiltinTicksortTick71647573575886987_70390692b0074add },
+    { 0xa76db3c92b470b9e, false, (void*)&_FuncbuiltinTicksortTick71647573575886987_f4f63ea13b0a8b50, &__wrap__FuncbuiltinTicksortTick71647573575886987_f4f63ea13b0a8b50 },
+    { 0x7106836733d11295, false, (void*)&_FuncbuiltinTicksortTick71647573575886987_d66ebefc2dda47c, &__wrap__FuncbuiltinTicksortTick71647573575886987_d66ebefc2dda47c },
+    { 0xa68253d3fca05c0a, false, (void*)&_FuncbuiltinTicksortTick71647573575886987_db7cbee77eb91161, &__wrap__FuncbuiltinTicksortTick71647573575886987_db7cbee77eb91161 },
+    { 0xf68337a7c081713, false, (void*)&_FuncbuiltinTicksortTick71647573575886987_eaf601c6431550b4, &__wrap__FuncbuiltinTicksortTick71647573575886987_eaf601c6431550b4 },
+    { 0x698384b6c1923638, false, (void*)&_FuncTicktest_sortTick14882388544287305087_7af9efc971e9806e, &__wrap__FuncTicktest_sortTick14882388544287305087_7af9efc971e9806e },
+    { 0x4dbc410745ec23b1, false, (void*)&_FuncTicktest_sortTick14882388544287305087_d7a346f80b1aad16, &__wrap__FuncTicktest_sortTick14882388544287305087_d7a346f80b1aad16 },
+    { 0x5797e8bd04326280, false, (void*)&_FuncTicktest_sortTick14882388544287305087_cd56f7bd6056d604, &__wrap__FuncTicktest_sortTick14882388544287305087_cd56f7bd6056d604 },
+    { 0xd857a2b5cb677ae9, false, (void*)&_FuncTicktest_sortTick14882388544287305087_7dd751594edd4e5e, &__wrap__FuncTicktest_sortTick14882388544287305087_7dd751594edd4e5e },
+    { 0x6d8128afcdc1a0d9, false, (void*)&_FuncTicktest_sortTick14882388544287305087_a3ae96aa481b8279, &__wrap__FuncTicktest_sortTick14882388544287305087_a3ae96aa481b8279 },
+    { 0xc905ce9ccb8ba1ac, false, (void*)&_FuncTicktest_sortTick14882388544287305087_e4ec06953c3e8538, &__wrap__FuncTicktest_sortTick14882388544287305087_e4ec06953c3e8538 },
+    { 0xcea874130a2fb883, false, (void*)&_FuncTicktest_sortTick14882388544287305087_f37c08a7182c5491, &__wrap__FuncTicktest_sortTick14882388544287305087_f37c08a7182c5491 },
+    { 0x7719b18235d73140, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_30001f9d1745e610, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_30001f9d1745e610 },
+    { 0x36d084b24d0b1cb6, false, (void*)&_FuncbuiltinTickpushTick14133213201864676143_61c98bc08ecd13d6, &__wrap__FuncbuiltinTickpushTick14133213201864676143_61c98bc08ecd13d6 },
+    { 0xe29fe60db36dcaa7, false, (void*)&_FuncTicktest_sort_compTick14790097101432932268_691a3401464da1b8, &__wrap__FuncTicktest_sort_compTick14790097101432932268_691a3401464da1b8 },
+    { 0x4c6c84e9bef159cb, false, (void*)&_FuncTicktest_sortTick14882388544287305087_2dd6259fe5cba16, &__wrap__FuncTicktest_sortTick14882388544287305087_2dd6259fe5cba16 },
+    { 0x2832d7ef64a0974f, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_eae92911b505ca18 },
+    { 0x7e4ea278fc5b3fdb, false, (void*)&_FuncTicktest_sortTick14882388544287305087_3b7d432ec644929d, &__wrap__FuncTicktest_sortTick14882388544287305087_3b7d432ec644929d },
+    { 0xe30efe74801dce23, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_7ade2ac99f7a944f, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_7ade2ac99f7a944f },
+    { 0xecf23f48f0e7d710, false, (void*)&_FuncTicktest_sortTick14882388544287305087_906aaf2fcb98d109, &__wrap__FuncTicktest_sortTick14882388544287305087_906aaf2fcb98d109 },
+    { 0xa693416301ae0801, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_4bdd39108bb81bb1, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_4bdd39108bb81bb1 },
+    { 0x1dd1c07c1dc8840d, false, (void*)&_FuncTicktest_sortTick14882388544287305087_b7e56a417eeac2b1, &__wrap__FuncTicktest_sortTick14882388544287305087_b7e56a417eeac2b1 },
+    { 0x6844f9b57ee82915, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_a734db502d6a5a7a, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_a734db502d6a5a7a },
+    { 0xcace2d98e535ee77, false, (void*)&_FuncTicktest_sortTick14882388544287305087_b7abdee641b4c258, &__wrap__FuncTicktest_sortTick14882388544287305087_b7abdee641b4c258 },
+    { 0x58b8bb8f66ff438d, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_e275dfafa0fc87f8, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_e275dfafa0fc87f8 },
+    { 0x3a4079bf3575bb5b, false, (void*)&_FuncTicktest_sortTick14882388544287305087_c21a48225ffe2376, &__wrap__FuncTicktest_sortTick14882388544287305087_c21a48225ffe2376 },
+    { 0x4c39f95f4dc40d7f, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_1bec3c8b815fe304, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1bec3c8b815fe304 },
+    { 0x55ac7c358d1c017f, false, (void*)&_FuncTicktest_sortTick14882388544287305087_c2c9f768e3d98b72, &__wrap__FuncTicktest_sortTick14882388544287305087_c2c9f768e3d98b72 },
+    { 0xf6c18d20e0bc4c68, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_d862e40791f6bc49, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_d862e40791f6bc49 },
+    { 0xdafb06b8b3ef20df, false, (void*)&_FuncLess_57166e1ce4637f88, &__wrap__FuncLess_57166e1ce4637f88 },
+    { 0xa3f200a3930748ec, false, (void*)&test_vector_sort_608c89507a554eda, &__wrap_test_vector_sort_608c89507a554eda },
+    { 0x596320ad706a51d4, false, (void*)&test_a8dc9cc8d40b618d, &__wrap_test_a8dc9cc8d40b618d },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_2878707024329268861
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
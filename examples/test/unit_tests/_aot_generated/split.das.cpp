@@ -0,0 +1,323 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_15654602539862504849 {
+
+// unused enumeration ConversionResult
+extern TypeInfo __type_info__af63ee4c86020b22;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __func_info__f2f69f5d310b5930_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63ee4c86020b22, nullptr, nullptr, nullptr, 0, 0, nullptr, 57442, 24, UINT64_C(0xfafeb124b14db33c), "a", 0, 0 };
+VarInfo * __func_info__f2f69f5d310b5930_fields[1] =  { &__func_info__f2f69f5d310b5930_field_0 };
+FuncInfo __func_info__f2f69f5d310b5930 = {"invoke block<(a:array<string> const#):void> const", "", __func_info__f2f69f5d310b5930_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xf2f69f5d310b5930), 0x0 };
+TypeInfo __type_info__af63ee4c86020b22 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0xaf63ee4c86020b22) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncTickexpect0Tick990285501993021160_9ee413c9b905d847 ( Context * __context__, TArray<char *> const  & __a_rename_at_5_0 );
+inline void _FuncTickexpect1Tick990461423853724145_bc48cf50bc8fd69 ( Context * __context__, TArray<char *> const  & __a_rename_at_11_1 );
+inline void _FuncTickexpect2Tick1016972848232580102_f90a794306fb8de4 ( Context * __context__, TArray<char *> const  & __a_rename_at_17_2 );
+inline void _FuncTickexpect3Tick1016999236511846391_41e61a79dfe328f8 ( Context * __context__, TArray<char *> const  & __a_rename_at_24_3 );
+inline void _FuncTickexpect3oTick6200555402900698412_ba86f2ab91c1de36 ( Context * __context__, TArray<char *> const  & __a_rename_at_32_4 );
+inline void _Funcstrings_boostTicksplitTick23764143628732925_36203bbb5946035 ( Context * __context__, char * const  __text_rename_at_99_5, char * const  __delim_rename_at_99_6, Block DAS_COMMENT((void,TArray<char *> const )) const  & __blk_rename_at_99_7 );
+inline void _FuncTickexpect0Tick990285501993021160_9086ef85dee70686 ( Context * __context__, TArray<char *> const  & __a_rename_at_5_8 );
+inline void _FuncTickexpect1Tick990461423853724145_cca85135ab4100fe ( Context * __context__, TArray<char *> const  & __a_rename_at_11_9 );
+inline void _FuncTickexpect2Tick1016972848232580102_f4d5cae459cd611f ( Context * __context__, TArray<char *> const  & __a_rename_at_17_10 );
+inline void _FuncTickexpect3Tick1016999236511846391_d467ec2e16e0b29f ( Context * __context__, TArray<char *> const  & __a_rename_at_24_11 );
+inline void _FuncTickexpect3oTick6200555402900698412_90522cf3bfb7b61d ( Context * __context__, TArray<char *> const  & __a_rename_at_32_12 );
+inline bool test_996e2fb5a738d7ab ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncTickexpect0Tick990285501993021160_9ee413c9b905d847 ( Context * __context__, TArray<char *> const  &  __a_rename_at_5_0 )
+{
+    DAS_ASSERT((builtin_array_size(__a_rename_at_5_0) == 1));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_5_0(0,__context__)),cast<char *>::from(nullptr),*__context__,nullptr)));
+}
+
+inline void _FuncTickexpect1Tick990461423853724145_bc48cf50bc8fd69 ( Context * __context__, TArray<char *> const  &  __a_rename_at_11_1 )
+{
+    DAS_ASSERT((builtin_array_size(__a_rename_at_11_1) == 1));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_11_1(0,__context__)),cast<char *>::from(((char *) "one")),*__context__,nullptr)));
+}
+
+inline void _FuncTickexpect2Tick1016972848232580102_f90a794306fb8de4 ( Context * __context__, TArray<char *> const  &  __a_rename_at_17_2 )
+{
+    DAS_ASSERT((builtin_array_size(__a_rename_at_17_2) == 2));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_17_2(0,__context__)),cast<char *>::from(((char *) "one")),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_17_2(1,__context__)),cast<char *>::from(((char *) "two")),*__context__,nullptr)));
+}
+
+inline void _FuncTickexpect3Tick1016999236511846391_41e61a79dfe328f8 ( Context * __context__, TArray<char *> const  &  __a_rename_at_24_3 )
+{
+    DAS_ASSERT((builtin_array_size(__a_rename_at_24_3) == 3));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_24_3(0,__context__)),cast<char *>::from(((char *) "one")),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_24_3(1,__context__)),cast<char *>::from(((char *) "two")),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_24_3(2,__context__)),cast<char *>::from(((char *) "three")),*__context__,nullptr)));
+}
+
+inline void _FuncTickexpect3oTick6200555402900698412_ba86f2ab91c1de36 ( Context * __context__, TArray<char *> const  &  __a_rename_at_32_4 )
+{
+    DAS_ASSERT((builtin_array_size(__a_rename_at_32_4) == 3));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_32_4(0,__context__)),cast<char *>::from(((char *) "o")),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_32_4(1,__context__)),cast<char *>::from(((char *) "n")),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_32_4(2,__context__)),cast<char *>::from(((char *) "e")),*__context__,nullptr)));
+}
+
+inline void _Funcstrings_boostTicksplitTick23764143628732925_36203bbb5946035 ( Context * __context__, char * const  __text_rename_at_99_5, char * const  __delim_rename_at_99_6, Block DAS_COMMENT((void,TArray<char *> const )) const  &  __blk_rename_at_99_7 )
+{
+    builtin_string_split(__text_rename_at_99_5,__delim_rename_at_99_6,__blk_rename_at_99_7,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncTickexpect0Tick990285501993021160_9086ef85dee70686 ( Context * __context__, TArray<char *> const  &  __a_rename_at_5_8 )
+{
+    DAS_ASSERT((builtin_array_size(__a_rename_at_5_8) == 1));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_5_8(0,__context__)),cast<char *>::from(nullptr),*__context__,nullptr)));
+}
+
+inline void _FuncTickexpect1Tick990461423853724145_cca85135ab4100fe ( Context * __context__, TArray<char *> const  &  __a_rename_at_11_9 )
+{
+    DAS_ASSERT((builtin_array_size(__a_rename_at_11_9) == 1));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_11_9(0,__context__)),cast<char *>::from(((char *) "one")),*__context__,nullptr)));
+}
+
+inline void _FuncTickexpect2Tick1016972848232580102_f4d5cae459cd611f ( Context * __context__, TArray<char *> const  &  __a_rename_at_17_10 )
+{
+    DAS_ASSERT((builtin_array_size(__a_rename_at_17_10) == 2));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_17_10(0,__context__)),cast<char *>::from(((char *) "one")),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_17_10(1,__context__)),cast<char *>::from(((char *) "two")),*__context__,nullptr)));
+}
+
+inline void _FuncTickexpect3Tick1016999236511846391_d467ec2e16e0b29f ( Context * __context__, TArray<char *> const  &  __a_rename_at_24_11 )
+{
+    DAS_ASSERT((builtin_array_size(__a_rename_at_24_11) == 3));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_24_11(0,__context__)),cast<char *>::from(((char *) "one")),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_24_11(1,__context__)),cast<char *>::from(((char *) "two")),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_24_11(2,__context__)),cast<char *>::from(((char *) "three")),*__context__,nullptr)));
+}
+
+inline void _FuncTickexpect3oTick6200555402900698412_90522cf3bfb7b61d ( Context * __context__, TArray<char *> const  &  __a_rename_at_32_12 )
+{
+    DAS_ASSERT((builtin_array_size(__a_rename_at_32_12) == 3));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_32_12(0,__context__)),cast<char *>::from(((char *) "o")),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_32_12(1,__context__)),cast<char *>::from(((char *) "n")),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_32_12(2,__context__)),cast<char *>::from(((char *) "e")),*__context__,nullptr)));
+}
+
+inline bool test_996e2fb5a738d7ab ( Context * __context__ ) { das_stack_prologue __prologue(__context__,224,"test " DAS_FILE_LINE);
+{
+    TArray<char *> _temp_make_local_56_12_0; _temp_make_local_56_12_0;
+    TArray<char *> _temp_make_local_57_12_1; _temp_make_local_57_12_1;
+    TArray<char *> _temp_make_local_58_12_2; _temp_make_local_58_12_2;
+    TArray<char *> _temp_make_local_59_12_3; _temp_make_local_59_12_3;
+    TArray<char *> _temp_make_local_60_12_4; _temp_make_local_60_12_4;
+    TArray<char *> _temp_make_local_61_13_5; _temp_make_local_61_13_5;
+    _Funcstrings_boostTicksplitTick23764143628732925_36203bbb5946035(__context__,nullptr,nullptr,das_make_block<void,TArray<char *> const  &>(__context__,80,0,&__func_info__f2f69f5d310b5930,[&](TArray<char *> const  & __a_rename_at_41_13) -> void{
+        _FuncTickexpect0Tick990285501993021160_9ee413c9b905d847(__context__,__a_rename_at_41_13);
+    }));
+    _Funcstrings_boostTicksplitTick23764143628732925_36203bbb5946035(__context__,((char *) "one"),((char *) ","),das_make_block<void,TArray<char *> const  &>(__context__,80,0,&__func_info__f2f69f5d310b5930,[&](TArray<char *> const  & __a_rename_at_44_14) -> void{
+        _FuncTickexpect1Tick990461423853724145_bc48cf50bc8fd69(__context__,__a_rename_at_44_14);
+    }));
+    _Funcstrings_boostTicksplitTick23764143628732925_36203bbb5946035(__context__,((char *) "one,two"),((char *) ","),das_make_block<void,TArray<char *> const  &>(__context__,80,0,&__func_info__f2f69f5d310b5930,[&](TArray<char *> const  & __a_rename_at_47_15) -> void{
+        _FuncTickexpect2Tick1016972848232580102_f90a794306fb8de4(__context__,__a_rename_at_47_15);
+    }));
+    _Funcstrings_boostTicksplitTick23764143628732925_36203bbb5946035(__context__,((char *) "one, two, three"),((char *) ", "),das_make_block<void,TArray<char *> const  &>(__context__,80,0,&__func_info__f2f69f5d310b5930,[&](TArray<char *> const  & __a_rename_at_50_16) -> void{
+        _FuncTickexpect3Tick1016999236511846391_41e61a79dfe328f8(__context__,__a_rename_at_50_16);
+    }));
+    _Funcstrings_boostTicksplitTick23764143628732925_36203bbb5946035(__context__,((char *) "one"),nullptr,das_make_block<void,TArray<char *> const  &>(__context__,80,0,&__func_info__f2f69f5d310b5930,[&](TArray<char *> const  & __a_rename_at_53_17) -> void{
+        _FuncTickexpect3oTick6200555402900698412_ba86f2ab91c1de36(__context__,__a_rename_at_53_17);
+    }));
+    _FuncTickexpect0Tick990285501993021160_9086ef85dee70686(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_56_12_0 = (das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@strings_boost::split CIs CIs*/ 0x427078f3f7fe6bb)),nullptr,nullptr)))));
+    _FuncTickexpect0Tick990285501993021160_9086ef85dee70686(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_57_12_1 = (das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@strings_boost::split CIs CIs*/ 0x427078f3f7fe6bb)),nullptr,((char *) "."))))));
+    _FuncTickexpect1Tick990461423853724145_cca85135ab4100fe(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_58_12_2 = (das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@strings_boost::split CIs CIs*/ 0x427078f3f7fe6bb)),((char *) "one"),((char *) ","))))));
+    _FuncTickexpect2Tick1016972848232580102_f4d5cae459cd611f(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_59_12_3 = (das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@strings_boost::split CIs CIs*/ 0x427078f3f7fe6bb)),((char *) "one,two"),((char *) ","))))));
+    _FuncTickexpect3Tick1016999236511846391_d467ec2e16e0b29f(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_60_12_4 = (das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@strings_boost::split CIs CIs*/ 0x427078f3f7fe6bb)),((char *) "one-->two-->three"),((char *) "-->"))))));
+    _FuncTickexpect3oTick6200555402900698412_90522cf3bfb7b61d(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_61_13_5 = (das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@strings_boost::split CIs CIs*/ 0x427078f3f7fe6bb)),((char *) "one"),nullptr)))));
+    TArray<char *> __es_rename_at_64_18_ConstRef; das_zero(__es_rename_at_64_18_ConstRef); das_move(__es_rename_at_64_18_ConstRef, ((TArray<char *>)das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@strings_boost::split CIs CIs*/ 0x427078f3f7fe6bb)),nullptr,((char *) "/"))));
+    TArray<char *> const  & __es_rename_at_64_18 = __es_rename_at_64_18_ConstRef;
+;
+    DAS_ASSERT((builtin_array_size(__es_rename_at_64_18) == 1));
+    TArray<char *> __ese_rename_at_66_19_ConstRef; das_zero(__ese_rename_at_66_19_ConstRef); das_move(__ese_rename_at_66_19_ConstRef, ((TArray<char *>)das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@strings_boost::split CIs CIs*/ 0x427078f3f7fe6bb)),nullptr,nullptr)));
+    TArray<char *> const  & __ese_rename_at_66_19 = __ese_rename_at_66_19_ConstRef;
+;
+    DAS_ASSERT((builtin_array_size(__ese_rename_at_66_19) == 1));
+    TArray<char *> __e0_rename_at_69_20_ConstRef; das_zero(__e0_rename_at_69_20_ConstRef); das_move(__e0_rename_at_69_20_ConstRef, ((TArray<char *>)das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@strings_boost::split CIs CIs*/ 0x427078f3f7fe6bb)),((char *) "/"),((char *) "/"))));
+    TArray<char *> const  & __e0_rename_at_69_20 = __e0_rename_at_69_20_ConstRef;
+;
+    DAS_ASSERT((builtin_array_size(__e0_rename_at_69_20) == 2));
+    DAS_ASSERT(((SimPolicy<char *>::Equ(cast<char *>::from(__e0_rename_at_69_20(0,__context__)),cast<char *>::from(nullptr),*__context__,nullptr)) && (SimPolicy<char *>::Equ(cast<char *>::from(__e0_rename_at_69_20(1,__context__)),cast<char *>::from(nullptr),*__context__,nullptr))));
+    TArray<char *> __e1_rename_at_73_21_ConstRef; das_zero(__e1_rename_at_73_21_ConstRef); das_move(__e1_rename_at_73_21_ConstRef, ((TArray<char *>)das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@strings_boost::split CIs CIs*/ 0x427078f3f7fe6bb)),((char *) "/1"),((char *) "/"))));
+    TArray<char *> const  & __e1_rename_at_73_21 = __e1_rename_at_73_21_ConstRef;
+;
+    DAS_ASSERT((builtin_array_size(__e1_rename_at_73_21) == 2));
+    DAS_ASSERT(((SimPolicy<char *>::Equ(cast<char *>::from(__e1_rename_at_73_21(0,__context__)),cast<char *>::from(nullptr),*__context__,nullptr)) && (SimPolicy<char *>::Equ(cast<char *>::from(__e1_rename_at_73_21(1,__context__)),cast<char *>::from(((char *) "1")),*__context__,nullptr))));
+    TArray<char *> __e2_rename_at_77_22_ConstRef; das_zero(__e2_rename_at_77_22_ConstRef); das_move(__e2_rename_at_77_22_ConstRef, ((TArray<char *>)das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@strings_boost::split CIs CIs*/ 0x427078f3f7fe6bb)),((char *) "1/"),((char *) "/"))));
+    TArray<char *> const  & __e2_rename_at_77_22 = __e2_rename_at_77_22_ConstRef;
+;
+    DAS_ASSERT((builtin_array_size(__e2_rename_at_77_22) == 2));
+    DAS_ASSERT(((SimPolicy<char *>::Equ(cast<char *>::from(__e2_rename_at_77_22(0,__context__)),cast<char *>::from(((char *) "1")),*__context__,nullptr)) && (SimPolicy<char *>::Equ(cast<char *>::from(__e2_rename_at_77_22(1,__context__)),cast<char *>::from(nullptr),*__context__,nullptr))));
+    TArray<char *> __e3_rename_at_81_23_ConstRef; das_zero(__e3_rename_at_81_23_ConstRef); das_move(__e3_rename_at_81_23_ConstRef, ((TArray<char *>)das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@strings_boost::split CIs CIs*/ 0x427078f3f7fe6bb)),((char *) "1/2/3"),((char *) "/"))));
+    TArray<char *> const  & __e3_rename_at_81_23 = __e3_rename_at_81_23_ConstRef;
+;
+    DAS_ASSERT((builtin_array_size(__e3_rename_at_81_23) == 3));
+    DAS_ASSERT((((SimPolicy<char *>::Equ(cast<char *>::from(__e3_rename_at_81_23(0,__context__)),cast<char *>::from(((char *) "1")),*__context__,nullptr)) && (SimPolicy<char *>::Equ(cast<char *>::from(__e3_rename_at_81_23(1,__context__)),cast<char *>::from(((char *) "2")),*__context__,nullptr))) && (SimPolicy<char *>::Equ(cast<char *>::from(__e3_rename_at_81_23(2,__context__)),cast<char *>::from(((char *) "3")),*__context__,nullptr))));
+    return das_auto_cast<bool>::cast(true);
+}}
+static vec4f __wrap__FuncTickexpect0Tick990285501993021160_9ee413c9b905d847 ( Context * __context__ ) {
+    TArray<char *> const  &  arg_a = cast_aot_arg<TArray<char *> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickexpect0Tick990285501993021160_9ee413c9b905d847(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickexpect1Tick990461423853724145_bc48cf50bc8fd69 ( Context * __context__ ) {
+    TArray<char *> const  &  arg_a = cast_aot_arg<TArray<char *> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickexpect1Tick990461423853724145_bc48cf50bc8fd69(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickexpect2Tick1016972848232580102_f90a794306fb8de4 ( Context * __context__ ) {
+    TArray<char *> const  &  arg_a = cast_aot_arg<TArray<char *> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickexpect2Tick1016972848232580102_f90a794306fb8de4(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickexpect3Tick1016999236511846391_41e61a79dfe328f8 ( Context * __context__ ) {
+    TArray<char *> const  &  arg_a = cast_aot_arg<TArray<char *> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickexpect3Tick1016999236511846391_41e61a79dfe328f8(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickexpect3oTick6200555402900698412_ba86f2ab91c1de36 ( Context * __context__ ) {
+    TArray<char *> const  &  arg_a = cast_aot_arg<TArray<char *> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickexpect3oTick6200555402900698412_ba86f2ab91c1de36(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__Funcstrings_boostTicksplitTick23764143628732925_36203bbb5946035 ( Context * __context__ ) {
+    char * const  arg_text = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_delim = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    Block DAS_COMMENT((void,TArray<char *> const )) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((void,TArray<char *> const )) const  & >::to(*__context__,__context__->abiArguments()[2]);
+    _Funcstrings_boostTicksplitTick23764143628732925_36203bbb5946035(__context__, arg_text, arg_delim, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickexpect0Tick990285501993021160_9086ef85dee70686 ( Context * __context__ ) {
+    TArray<char *> const  &  arg_a = cast_aot_arg<TArray<char *> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickexpect0Tick990285501993021160_9086ef85dee70686(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickexpect1Tick990461423853724145_cca85135ab4100fe ( Context * __context__ ) {
+    TArray<char *> const  &  arg_a = cast_aot_arg<TArray<char *> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickexpect1Tick990461423853724145_cca85135ab4100fe(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickexpect2Tick1016972848232580102_f4d5cae459cd611f ( Context * __context__ ) {
+    TArray<char *> const  &  arg_a = cast_aot_arg<TArray<char *> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickexpect2Tick1016972848232580102_f4d5cae459cd611f(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickexpect3Tick1016999236511846391_d467ec2e16e0b29f ( Context * __context__ ) {
+    TArray<char *> const  &  arg_a = cast_aot_arg<TArray<char *> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickexpect3Tick1016999236511846391_d467ec2e16e0b29f(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncTickexpect3oTick6200555402900698412_90522cf3bfb7b61d ( Context * __context__ ) {
+    TArray<char *> const  &  arg_a = cast_aot_arg<TArray<char *> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTickexpect3oTick6200555402900698412_90522cf3bfb7b61d(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap_test_996e2fb5a738d7ab ( Context * __context__ ) {
+    return cast<bool>::from(test_996e2fb5a738d7ab(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xb9e976431c2e42a6, false, (void*)&_FuncTickexpect0Tick990285501993021160_9ee413c9b905d847, &__wrap__FuncTickexpect0Tick990285501993021160_9ee413c9b905d847 },
+    { 0x62062dcfbf51b042, false, (void*)&_FuncTickexpect1Tick990461423853724145_bc48cf50bc8fd69, &__wrap__FuncTickexpect1Tick990461423853724145_bc48cf50bc8fd69 },
+    { 0x44a83a8c0829d947, false, (void*)&_FuncTickexpect2Tick1016972848232580102_f90a794306fb8de4, &__wrap__FuncTickexpect2Tick1016972848232580102_f90a794306fb8de4 },
+    { 0xd4a6454a08ee0704, false, (void*)&_FuncTickexpect3Tick1016999236511846391_41e61a79dfe328f8, &__wrap__FuncTickexpect3Tick1016999236511846391_41e61a79dfe328f8 },
+    { 0x267982e30406dfe0, false, (void*)&_FuncTickexpect3oTick6200555402900698412_ba86f2ab91c1de36, &__wrap__FuncTickexpect3oTick6200555402900698412_ba86f2ab91c1de36 },
+    { 0x644a14a1fdebfbb9, false, (void*)&_Funcstrings_boostTicksplitTick23764143628732925_36203bbb5946035, &__wrap__Funcstrings_boostTicksplitTick23764143628732925_36203bbb5946035 },
+    { 0xd40a3025b186390c, false, (void*)&_FuncTickexpect0Tick990285501993021160_9086ef85dee70686, &__wrap__FuncTickexpect0Tick990285501993021160_9086ef85dee70686 },
+    { 0x4f07df99232ab160, false, (void*)&_FuncTickexpect1Tick990461423853724145_cca85135ab4100fe, &__wrap__FuncTickexpect1Tick990461423853724145_cca85135ab4100fe },
+    { 0xd373dfa115a295d4, false, (void*)&_FuncTickexpect2Tick1016972848232580102_f4d5cae459cd611f, &__wrap__FuncTickexpect2Tick1016972848232580102_f4d5cae459cd611f },
+    { 0xef9692b4b525f982, false, (void*)&_FuncTickexpect3Tick1016999236511846391_d467ec2e16e0b29f, &__wrap__FuncTickexpect3Tick1016999236511846391_d467ec2e16e0b29f },
+    { 0x303543d4ff23cbfa, false, (void*)&_FuncTickexpect3oTick6200555402900698412_90522cf3bfb7b61d, &__wrap__FuncTickexpect3oTick6200555402900698412_90522cf3bfb7b61d },
+    { 0xc2950d5ccad55e8, false, (void*)&test_996e2fb5a738d7ab, &__wrap_test_996e2fb5a738d7ab },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_15654602539862504849
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
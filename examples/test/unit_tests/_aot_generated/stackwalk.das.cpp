@@ -0,0 +1,124 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_2545327161242018844 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline bool fnBottom_7b3bb3e89ad454e6 ( Context * __context__ );
+inline bool fnTop_2789fb589490fb83 ( Context * __context__ );
+inline bool test_56bf01097dd1fbbb ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool fnBottom_7b3bb3e89ad454e6 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,32,"fnBottom " DAS_FILE_LINE);
+{
+    builtin_stackwalk(true,true,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return das_auto_cast<bool>::cast(true);
+}}
+
+inline bool fnTop_2789fb589490fb83 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,32,"fnTop " DAS_FILE_LINE);
+{
+    das_invoke_function<bool>::invoke(__context__,nullptr,Func(__context__->fnByMangledName(/*fnMid*/ 0x25e29ae69da3f2c8)));
+    return das_auto_cast<bool>::cast(true);
+}}
+
+inline bool test_56bf01097dd1fbbb ( Context * __context__ ) { das_stack_prologue __prologue(__context__,32,"test " DAS_FILE_LINE);
+{
+    fnTop_2789fb589490fb83(__context__);
+    return das_auto_cast<bool>::cast(true);
+}}
+static vec4f __wrap_fnBottom_7b3bb3e89ad454e6 ( Context * __context__ ) {
+    return cast<bool>::from(fnBottom_7b3bb3e89ad454e6(__context__));
+}
+static vec4f __wrap_fnTop_2789fb589490fb83 ( Context * __context__ ) {
+    return cast<bool>::from(fnTop_2789fb589490fb83(__context__));
+}
+static vec4f __wrap_test_56bf01097dd1fbbb ( Context * __context__ ) {
+    return cast<bool>::from(test_56bf01097dd1fbbb(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xb4f3dcc8ba260986, false, (void*)&fnBottom_7b3bb3e89ad454e6, &__wrap_fnBottom_7b3bb3e89ad454e6 },
+    { 0xe2757c63a141dc83, false, (void*)&fnTop_2789fb589490fb83, &__wrap_fnTop_2789fb589490fb83 },
+    { 0xdbe5827b80c3e485, false, (void*)&test_56bf01097dd1fbbb, &__wrap_test_56bf01097dd1fbbb },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_2545327161242018844
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
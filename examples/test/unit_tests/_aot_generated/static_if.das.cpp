@@ -0,0 +1,153 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_4445903089790350250 {
+
+namespace  { struct Foo; };
+namespace  { struct Bar; };
+namespace  {
+
+struct Foo {
+    int32_t a;
+    int32_t b;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Bar {
+    int32_t c;
+    int32_t d;
+};
+static_assert(sizeof(Bar)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Bar,c)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Bar,d)==4,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncTicksetATick5429944323213571823_6c3bdc9e5a4e5430 ( Context * __context__, Foo & __obj_rename_at_13_0, int32_t __val_rename_at_13_1 );
+inline void _FuncTicksetATick5429944323213571823_f68babd8889d858a ( Context * __context__, Bar & __obj_rename_at_13_2, int32_t __val_rename_at_13_3 );
+inline bool test_f7b0f8a9f9d62a8 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncTicksetATick5429944323213571823_6c3bdc9e5a4e5430 ( Context * __context__, Foo &  __obj_rename_at_13_0, int32_t __val_rename_at_13_1 )
+{
+    das_copy(__obj_rename_at_13_0.a,__val_rename_at_13_1);
+}
+
+inline void _FuncTicksetATick5429944323213571823_f68babd8889d858a ( Context * __context__, Bar &  __obj_rename_at_13_2, int32_t __val_rename_at_13_3 )
+{
+}
+
+inline bool test_f7b0f8a9f9d62a8 ( Context * __context__ )
+{
+    Foo __f_rename_at_27_4;das_zero(__f_rename_at_27_4);
+    Bar __b_rename_at_28_5;das_zero(__b_rename_at_28_5);
+    _FuncTicksetATick5429944323213571823_6c3bdc9e5a4e5430(__context__,das_arg<Foo>::pass(__f_rename_at_27_4),1);
+    _FuncTicksetATick5429944323213571823_f68babd8889d858a(__context__,das_arg<Bar>::pass(__b_rename_at_28_5),2);
+    DAS_ASSERT((__f_rename_at_27_4.a == 1));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncTicksetATick5429944323213571823_6c3bdc9e5a4e5430 ( Context * __context__ ) {
+    Foo &  arg_obj = cast_aot_arg<Foo & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_val = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTicksetATick5429944323213571823_6c3bdc9e5a4e5430(__context__, arg_obj, arg_val);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicksetATick5429944323213571823_f68babd8889d858a ( Context * __context__ ) {
+    Bar &  arg_obj = cast_aot_arg<Bar & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_val = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTicksetATick5429944323213571823_f68babd8889d858a(__context__, arg_obj, arg_val);
+    return v_zero();
+}
+static vec4f __wrap_test_f7b0f8a9f9d62a8 ( Context * __context__ ) {
+    return cast<bool>::from(test_f7b0f8a9f9d62a8(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x96812595605f12c2, false, (void*)&_FuncTicksetATick5429944323213571823_6c3bdc9e5a4e5430, &__wrap__FuncTicksetATick5429944323213571823_6c3bdc9e5a4e5430 },
+    { 0x4784aa543f6f57a0, false, (void*)&_FuncTicksetATick5429944323213571823_f68babd8889d858a, &__wrap__FuncTicksetATick5429944323213571823_f68babd8889d858a },
+    { 0xc2bb08ff12ba7a60, false, (void*)&test_f7b0f8a9f9d62a8, &__wrap_test_f7b0f8a9f9d62a8 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_4445903089790350250
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,260 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_844308519851812044 {
+
+// unused enumeration ConversionResult
+extern TypeInfo __type_info__af87fe4c863f5252;
+extern TypeInfo __type_info__af85fe4c863bec52;
+extern TypeInfo __type_info__af8afe4c86446b52;
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__af96fe4c8658cf52;
+extern TypeInfo __type_info__37d36026a6078a42;
+
+TypeInfo __type_info__af87fe4c863f5252 = { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 8, UINT64_C(0xaf87fe4c863f5252) };
+TypeInfo __type_info__af85fe4c863bec52 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf85fe4c863bec52) };
+TypeInfo __type_info__af8afe4c86446b52 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf8afe4c86446b52) };
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__af96fe4c8658cf52 = { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf96fe4c8658cf52) };
+TypeInfo __type_info__37d36026a6078a42 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 288, UINT64_C(0x37d36026a6078a42) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {__type_info__37d36026a6078a42, };
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__37d36026a6078a42, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_1[2] = { &__type_info__37d36026a6078a42, &__type_info__af8afe4c86446b52 };
+
+inline void failUint_46e2ea53626d979b ( Context * __context__, char * const  __val_rename_at_8_0 );
+inline void failInt_ce942157f6902c44 ( Context * __context__, char * const  __val_rename_at_15_1 );
+inline void failFloat_c359c934ee6ed88d ( Context * __context__, char * const  __val_rename_at_23_2 );
+inline void failDouble_b3e4af053e7c631a ( Context * __context__, char * const  __val_rename_at_30_3 );
+inline void failAll_dbe5f404b4f135f5 ( Context * __context__, char * const  __val_rename_at_37_4 );
+inline bool test_85b2b5ce68bf552a ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void failUint_46e2ea53626d979b ( Context * __context__, char * const  __val_rename_at_8_0 )
+{
+    das_try_recover(__context__, [&]()
+    {
+        das_debug(__context__,&__type_info__af96fe4c8658cf52,__FILE__,__LINE__,cast<uint32_t>::from(string_to_uint(__val_rename_at_8_0,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))),(((char *) "=")));
+        DAS_ASSERTF((false),(((char *) "can't convert non uint string without exception")));
+    }, [&]()
+    {
+    });
+}
+
+inline void failInt_ce942157f6902c44 ( Context * __context__, char * const  __val_rename_at_15_1 )
+{
+    das_try_recover(__context__, [&]()
+    {
+        das_debug(__context__,&__type_info__af8afe4c86446b52,__FILE__,__LINE__,cast<int32_t>::from(string_to_int(__val_rename_at_15_1,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))),(((char *) "=")));
+        DAS_ASSERTF((false),(((char *) "can't convert non int string without exception")));
+    }, [&]()
+    {
+    });
+}
+
+inline void failFloat_c359c934ee6ed88d ( Context * __context__, char * const  __val_rename_at_23_2 )
+{
+    das_try_recover(__context__, [&]()
+    {
+        das_debug(__context__,&__type_info__af85fe4c863bec52,__FILE__,__LINE__,cast<float>::from(string_to_float(__val_rename_at_23_2,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))),(((char *) "=")));
+        DAS_ASSERTF((false),(((char *) "can't convert non float string without exception")));
+    }, [&]()
+    {
+    });
+}
+
+inline void failDouble_b3e4af053e7c631a ( Context * __context__, char * const  __val_rename_at_30_3 )
+{
+    das_try_recover(__context__, [&]()
+    {
+        das_debug(__context__,&__type_info__af87fe4c863f5252,__FILE__,__LINE__,cast<double>::from(string_to_double(__val_rename_at_30_3,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))),(((char *) "=")));
+        DAS_ASSERTF((false),(((char *) "can't convert non double string without exception")));
+    }, [&]()
+    {
+    });
+}
+
+inline void failAll_dbe5f404b4f135f5 ( Context * __context__, char * const  __val_rename_at_37_4 )
+{
+    failUint_46e2ea53626d979b(__context__,__val_rename_at_37_4);
+    failInt_ce942157f6902c44(__context__,__val_rename_at_37_4);
+    failFloat_c359c934ee6ed88d(__context__,__val_rename_at_37_4);
+    failDouble_b3e4af053e7c631a(__context__,__val_rename_at_37_4);
+}
+
+inline bool test_85b2b5ce68bf552a ( Context * __context__ )
+{
+    failAll_dbe5f404b4f135f5(__context__,nullptr);
+    failAll_dbe5f404b4f135f5(__context__,((char *) "abc"));
+    bool __failed_rename_at_111_5 = false;
+    das_try_recover(__context__, [&]()
+    {
+        char * __t_rename_at_113_6 = 0;
+        das_copy(__t_rename_at_113_6,((char *) "blah"));
+        char * __x_rename_at_115_7 = (char *)(((char * const )(fmt_i32(__t_rename_at_113_6,13,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))))));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__x_rename_at_115_7),cast<char *>::from(((char *) "13")),*__context__,nullptr)));
+    }, [&]()
+    {
+        das_copy(__failed_rename_at_111_5,true);
+    });
+    DAS_ASSERT((__failed_rename_at_111_5));
+    char * __st_rename_at_122_8 = ((char *)(char *)(((char * const )(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_122_9) DAS_AOT_INLINE_LAMBDA -> void{
+        das_call_interop<StringBuilderWriter &>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<StringBuilderWriter &>::from(__writer_rename_at_122_9),cast<char * const >::from(((char *) "255 hex is "))));
+        format_and_write<int32_t>(das_arg<StringBuilderWriter>::pass(__writer_rename_at_122_9),((char *) "%2x"),255);
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__st_rename_at_122_8),cast<char *>::from(((char *) "255 hex is ff")),*__context__,nullptr)));
+    int32_t __count_rename_at_128_10 = 0;
+    int32_t __index_rename_at_129_11 = 0;
+    {
+        bool __need_loop_130 = true;
+        // ch: int const
+        das_iterator<char * const > __ch_iterator(__st_rename_at_122_8);
+        int32_t __ch_rename_at_130_12;
+        __need_loop_130 = __ch_iterator.first(__context__,(__ch_rename_at_130_12)) && __need_loop_130;
+        for ( ; __need_loop_130 ; __need_loop_130 = __ch_iterator.next(__context__,(__ch_rename_at_130_12)) )
+        {
+            if ( __ch_rename_at_130_12 == 53 )
+            {
+                ++__count_rename_at_128_10;
+            };
+            int32_t __chAt_rename_at_134_13 = ((int32_t)get_character_at(__st_rename_at_122_8,__index_rename_at_129_11,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+            DAS_ASSERT((__ch_rename_at_130_12 == __chAt_rename_at_134_13));
+            ++__index_rename_at_129_11;
+        }
+        __ch_iterator.close(__context__,(__ch_rename_at_130_12));
+    };
+    DAS_ASSERT((__count_rename_at_128_10 == 2));
+    char * __zzs_rename_at_140_14 = (char *)(((char * const )(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_140_15) DAS_AOT_INLINE_LAMBDA -> void{
+        {
+            bool __need_loop_141 = true;
+            // zzx: int const
+            das_iterator<range> __zzx_iterator(range(0,100500));
+            int32_t __zzx_rename_at_141_16;
+            __need_loop_141 = __zzx_iterator.first(__context__,(__zzx_rename_at_141_16)) && __need_loop_141;
+            for ( ; __need_loop_141 ; __need_loop_141 = __zzx_iterator.next(__context__,(__zzx_rename_at_141_16)) )
+            {
+                das_call_interop<StringBuilderWriter &>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<StringBuilderWriter &>::from(__writer_rename_at_140_15),cast<int32_t>::from(__zzx_rename_at_141_16)));
+            }
+            __zzx_iterator.close(__context__,(__zzx_rename_at_141_16));
+        };
+    },__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))))));
+    delete_string(__zzs_rename_at_140_14,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_failUint_46e2ea53626d979b ( Context * __context__ ) {
+    char * const  arg_val = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    failUint_46e2ea53626d979b(__context__, arg_val);
+    return v_zero();
+}
+static vec4f __wrap_failInt_ce942157f6902c44 ( Context * __context__ ) {
+    char * const  arg_val = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    failInt_ce942157f6902c44(__context__, arg_val);
+    return v_zero();
+}
+static vec4f __wrap_failFloat_c359c934ee6ed88d ( Context * __context__ ) {
+    char * const  arg_val = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    failFloat_c359c934ee6ed88d(__context__, arg_val);
+    return v_zero();
+}
+static vec4f __wrap_failDouble_b3e4af053e7c631a ( Context * __context__ ) {
+    char * const  arg_val = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    failDouble_b3e4af053e7c631a(__context__, arg_val);
+    return v_zero();
+}
+static vec4f __wrap_failAll_dbe5f404b4f135f5 ( Context * __context__ ) {
+    char * const  arg_val = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[0]);
+    failAll_dbe5f404b4f135f5(__context__, arg_val);
+    return v_zero();
+}
+static vec4f __wrap_test_85b2b5ce68bf552a ( Context * __context__ ) {
+    return cast<bool>::from(test_85b2b5ce68bf552a(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x77a9e686481e5080, false, (void*)&failUint_46e2ea53626d979b, &__wrap_failUint_46e2ea53626d979b },
+    { 0xe510a56d060ed280, false, (void*)&failInt_ce942157f6902c44, &__wrap_failInt_ce942157f6902c44 },
+    { 0x71647ebbf826bb8e, false, (void*)&failFloat_c359c934ee6ed88d, &__wrap_failFloat_c359c934ee6ed88d },
+    { 0x89b4987ac2a2314f, false, (void*)&failDouble_b3e4af053e7c631a, &__wrap_failDouble_b3e4af053e7c631a },
+    { 0x348466b96793ac23, false, (void*)&failAll_dbe5f404b4f135f5, &__wrap_failAll_dbe5f404b4f135f5 },
+    { 0xe2f6d68b38f56490, false, (void*)&test_85b2b5ce68bf552a, &__wrap_test_85b2b5ce68bf552a },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_844308519851812044
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,243 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_3768237096778698689 {
+
+namespace  { struct Dummy; };
+namespace  { struct Ball; };
+namespace  { struct Balls; };
+namespace  { struct L3; };
+namespace  { struct L2; };
+namespace  { struct L1; };
+namespace  {
+
+struct Dummy {
+};
+}
+namespace  {
+
+struct Ball {
+    float3 position;
+    float radius;
+};
+static_assert(sizeof(Ball)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Ball,position)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Ball,radius)==12,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Balls {
+    Ball a;
+    Ball b;
+};
+static_assert(sizeof(Balls)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Balls,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Balls,b)==16,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct L3 {
+    int32_t a;
+};
+static_assert(sizeof(L3)==4,"structure size mismatch with DAS");
+static_assert(offsetof(L3,a)==0,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct L2 {
+    L3 * l3;
+};
+static_assert(sizeof(L2)==8,"structure size mismatch with DAS");
+static_assert(offsetof(L2,l3)==0,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct L1 {
+    L2 * l2;
+};
+static_assert(sizeof(L1)==8,"structure size mismatch with DAS");
+static_assert(offsetof(L1,l2)==0,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void set_default_ball_e16a563223d03513 ( Context * __context__, Ball & __b_rename_at_23_0 );
+inline Ball * make_default_ball_472df3945c882c98 ( Context * __context__ );
+inline void test_ref_ptr_8d7b3f502c057259 ( Context * __context__, Ball * & __a_rename_at_39_2, Ball * __b_rename_at_39_3 );
+inline Ball * test_ret_ptr_bab3a7fbf5536b2c ( Context * __context__, Ball * __a_rename_at_44_4 );
+inline bool test_a387c8f96bc9ca83 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global<L1 *,0xe19c17f6a8b99f12>(__context__) = nullptr;/*glob*/
+}
+
+inline void set_default_ball_e16a563223d03513 ( Context * __context__, Ball &  __b_rename_at_23_0 )
+{
+    das_copy(__b_rename_at_23_0.position,v_make_vec4f(1.000000e+00f,2.000000e+00f,3.000000e+00f,0.f));
+    das_copy(__b_rename_at_23_0.radius,5.000000e+00f);
+}
+
+inline Ball * make_default_ball_472df3945c882c98 ( Context * __context__ )
+{
+    Ball * __b_rename_at_29_1 = das_new<Ball>::make(__context__);
+    set_default_ball_e16a563223d03513(__context__,das_arg<Ball>::pass(das_deref(__context__,__b_rename_at_29_1,__FILE__,__LINE__)));
+    return das_auto_cast<Ball *>::cast(__b_rename_at_29_1);
+}
+
+inline void test_ref_ptr_8d7b3f502c057259 ( Context * __context__, Ball * & __a_rename_at_39_2, Ball * __b_rename_at_39_3 )
+{
+    das_copy(__a_rename_at_39_2,__b_rename_at_39_3);
+    DAS_ASSERT((__a_rename_at_39_2 == __b_rename_at_39_3));
+}
+
+inline Ball * test_ret_ptr_bab3a7fbf5536b2c ( Context * __context__, Ball * __a_rename_at_44_4 )
+{
+    return das_auto_cast<Ball *>::cast(__a_rename_at_44_4);
+}
+
+inline bool test_a387c8f96bc9ca83 ( Context * __context__ )
+{
+    Ball * __b_rename_at_68_5 = das_new<Ball>::make(__context__);
+    das_copy(__b_rename_at_68_5->position,v_make_vec4f(1.000000e+00f,2.000000e+00f,3.000000e+00f,0.f));
+    das_copy(__b_rename_at_68_5->radius,5.000000e+00f);
+    Ball __xb_rename_at_73_6;das_zero(__xb_rename_at_73_6); Ball __qb_rename_at_73_7;das_zero(__qb_rename_at_73_7);
+    Ball * __qc_rename_at_74_8 = __b_rename_at_68_5;
+    Ball * __qd_rename_at_75_9 = das_new<Ball>::make(__context__);
+    das_copy(__qb_rename_at_73_7,das_deref(__context__,__qc_rename_at_74_8,__FILE__,__LINE__));
+    das_copy(__qc_rename_at_74_8,nullptr);
+    DAS_ASSERT((__qc_rename_at_74_8 == nullptr));
+    DAS_ASSERT((__qd_rename_at_75_9 != nullptr));
+    test_ref_ptr_8d7b3f502c057259(__context__,__qc_rename_at_74_8,__qd_rename_at_75_9);
+    DAS_ASSERT((__qc_rename_at_74_8 == __qd_rename_at_75_9));
+    das_copy(__qd_rename_at_75_9,test_ret_ptr_bab3a7fbf5536b2c(__context__,das_auto_cast<Ball *>::cast(nullptr)));
+    DAS_ASSERT((__qd_rename_at_75_9 == nullptr));
+    DAS_ASSERT((__qd_rename_at_75_9 != __qc_rename_at_74_8));
+    das_copy(__xb_rename_at_73_6,__qb_rename_at_73_7);
+    Ball * __b_rename_at_92_10 = ((Ball *)make_default_ball_472df3945c882c98(__context__));
+    int32_t __dummy_rename_at_96_11 = 0;
+    das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation<L3,int32_t,&L3::a>::get(das_safe_navigation_ptr<L2,L3 *,&L2::l3>::get(das_safe_navigation_ptr<L1,L2 *,&L1::l2>::get(das_global<L1 *,0xe19c17f6a8b99f12>(__context__) /*glob*/))),__dummy_rename_at_96_11),1);
+    DAS_ASSERT((__dummy_rename_at_96_11 == 1));
+    das_copy(das_global<L1 *,0xe19c17f6a8b99f12>(__context__) /*glob*/,das_new<L1>::make(__context__));
+    das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation<L3,int32_t,&L3::a>::get(das_safe_navigation_ptr<L2,L3 *,&L2::l3>::get(das_safe_navigation_ptr<L1,L2 *,&L1::l2>::get(das_global<L1 *,0xe19c17f6a8b99f12>(__context__) /*glob*/))),__dummy_rename_at_96_11),2);
+    DAS_ASSERT((__dummy_rename_at_96_11 == 2));
+    das_copy(das_global<L1 *,0xe19c17f6a8b99f12>(__context__) /*glob*/->l2,das_new<L2>::make(__context__));
+    das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation<L3,int32_t,&L3::a>::get(das_safe_navigation_ptr<L2,L3 *,&L2::l3>::get(das_safe_navigation_ptr<L1,L2 *,&L1::l2>::get(das_global<L1 *,0xe19c17f6a8b99f12>(__context__) /*glob*/))),__dummy_rename_at_96_11),3);
+    DAS_ASSERT((__dummy_rename_at_96_11 == 3));
+    das_copy(das_global<L1 *,0xe19c17f6a8b99f12>(__context__) /*glob*/->l2->l3,das_new<L3>::make(__context__));
+    das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation<L3,int32_t,&L3::a>::get(das_safe_navigation_ptr<L2,L3 *,&L2::l3>::get(das_safe_navigation_ptr<L1,L2 *,&L1::l2>::get(das_global<L1 *,0xe19c17f6a8b99f12>(__context__) /*glob*/))),__dummy_rename_at_96_11),4);
+    DAS_ASSERT((__dummy_rename_at_96_11 == 3));
+    DAS_ASSERT((das_null_coalescing<int32_t>::get(das_safe_navigation<L3,int32_t,&L3::a>::get(das_safe_navigation_ptr<L2,L3 *,&L2::l3>::get(das_safe_navigation_ptr<L1,L2 *,&L1::l2>::get(das_global<L1 *,0xe19c17f6a8b99f12>(__context__) /*glob*/))),5) == 4));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_set_default_ball_e16a563223d03513 ( Context * __context__ ) {
+    Ball &  arg_b = cast_aot_arg<Ball & >::to(*__context__,__context__->abiArguments()[0]);
+    set_default_ball_e16a563223d03513(__context__, arg_b);
+    return v_zero();
+}
+static vec4f __wrap_make_default_ball_472df3945c882c98 ( Context * __context__ ) {
+    return cast<Ball *>::from(make_default_ball_472df3945c882c98(__context__));
+}
+static vec4f __wrap_test_ref_ptr_8d7b3f502c057259 ( Context * __context__ ) {
+    Ball * & arg_a = cast_aot_arg<Ball * &>::to(*__context__,__context__->abiArguments()[0]);
+    Ball * arg_b = cast_aot_arg<Ball *>::to(*__context__,__context__->abiArguments()[1]);
+    test_ref_ptr_8d7b3f502c057259(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap_test_ret_ptr_bab3a7fbf5536b2c ( Context * __context__ ) {
+    Ball * arg_a = cast_aot_arg<Ball *>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<Ball *>::from(test_ret_ptr_bab3a7fbf5536b2c(__context__, arg_a));
+}
+static vec4f __wrap_test_a387c8f96bc9ca83 ( Context * __context__ ) {
+    return cast<bool>::from(test_a387c8f96bc9ca83(__context__));
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xdb648b2b603821f2, false, (void*)&set_default_ball_e16a563223d03513, &__wrap_set_default_ball_e16a563223d03513 },
+    { 0xdd78596bb373b74c, false, (void*)&make_default_ball_472df3945c882c98, &__wrap_make_default_ball_472df3945c882c98 },
+    { 0x91ce97efe5491dad, false, (void*)&test_ref_ptr_8d7b3f502c057259, &__wrap_test_ref_ptr_8d7b3f502c057259 },
+    { 0x12bae6a30c55312, false, (void*)&test_ret_ptr_bab3a7fbf5536b2c, &__wrap_test_ret_ptr_bab3a7fbf5536b2c },
+    { 0x865be59b46d4ce28, false, (void*)&test_a387c8f96bc9ca83, &__wrap_test_a387c8f96bc9ca83 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0xa754d21f4f79e779, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_3768237096778698689
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
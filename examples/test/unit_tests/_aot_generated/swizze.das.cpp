@@ -0,0 +1,182 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_6091784630920202320 {
+
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+    bool t;
+    int3 v;
+};
+static_assert(sizeof(Foo)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,t)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,v)==4,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline int3 funV_a60685e1c7101d96 ( Context * __context__, int3 __v_rename_at_11_0 );
+inline bool test_d62583f3570ca2b1 ( Context * __context__ );
+inline Foo Foo_c386260f656f1c4b ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int3 funV_a60685e1c7101d96 ( Context * __context__, int3 __v_rename_at_11_0 )
+{
+    return das_auto_cast<int3>::cast(__v_rename_at_11_0);
+}
+
+inline bool test_d62583f3570ca2b1 ( Context * __context__ )
+{
+    int3 __v_rename_at_18_1 = int3(1,2,3);
+    DAS_ASSERT((SimPolicy<int3>::Equ(__v_rename_at_18_1,int3(1,2,3),*__context__,nullptr)));
+    DAS_ASSERT((((v_extract_xi(v_cast_vec4i(__v_rename_at_18_1)) /*x*/ == 1) && (v_extract_yi(v_cast_vec4i(__v_rename_at_18_1)) /*y*/ == 2)) && (v_extract_zi(v_cast_vec4i(__v_rename_at_18_1)) /*z*/ == 3)));
+    DAS_ASSERT((((SimPolicy<int2>::Equ(das_swizzle_seq<int2,int3,0>::swizzle(__v_rename_at_18_1) /*xy*/,int2(1,2),*__context__,nullptr)) && (SimPolicy<int2>::Equ(das_swizzle_seq<int2,int3,1>::swizzle(__v_rename_at_18_1) /*yz*/,int2(2,3),*__context__,nullptr))) && (SimPolicy<int2>::Equ(das_swizzle<int2,int3,2,0>::swizzle(__v_rename_at_18_1) /*zx*/,int2(3,1),*__context__,nullptr))));
+    DAS_ASSERT((((SimPolicy<int2>::Equ(das_swizzle<int2,int3,1,0>::swizzle(__v_rename_at_18_1) /*yx*/,int2(2,1),*__context__,nullptr)) && (SimPolicy<int2>::Equ(das_swizzle<int2,int3,2,1>::swizzle(__v_rename_at_18_1) /*zy*/,int2(3,2),*__context__,nullptr))) && (SimPolicy<int2>::Equ(das_swizzle<int2,int3,0,2>::swizzle(__v_rename_at_18_1) /*xz*/,int2(1,3),*__context__,nullptr))));
+    DAS_ASSERT((SimPolicy<int3>::Equ(funV_a60685e1c7101d96(__context__,__v_rename_at_18_1),int3(1,2,3),*__context__,nullptr)));
+    DAS_ASSERT((((v_extract_xi(v_cast_vec4i(funV_a60685e1c7101d96(__context__,__v_rename_at_18_1))) /*x*/ == 1) && (v_extract_yi(v_cast_vec4i(funV_a60685e1c7101d96(__context__,__v_rename_at_18_1))) /*y*/ == 2)) && (v_extract_zi(v_cast_vec4i(funV_a60685e1c7101d96(__context__,__v_rename_at_18_1))) /*z*/ == 3)));
+    das_copy(das_swizzle_ref<int32_t,int3,0>::swizzle(__v_rename_at_18_1) /*x*/,11);
+    DAS_ASSERT((SimPolicy<int3>::Equ(__v_rename_at_18_1,int3(11,2,3),*__context__,nullptr)));
+    das_copy(das_swizzle_ref<int32_t,int3,1>::swizzle(__v_rename_at_18_1) /*y*/,22);
+    DAS_ASSERT((SimPolicy<int3>::Equ(__v_rename_at_18_1,int3(11,22,3),*__context__,nullptr)));
+    das_copy(das_swizzle_ref<int32_t,int3,2>::swizzle(__v_rename_at_18_1) /*z*/,33);
+    DAS_ASSERT((SimPolicy<int3>::Equ(__v_rename_at_18_1,int3(11,22,33),*__context__,nullptr)));
+    DAS_ASSERT((((v_extract_xi(v_cast_vec4i(__v_rename_at_18_1)) /*x*/ == 11) && (v_extract_yi(v_cast_vec4i(__v_rename_at_18_1)) /*y*/ == 22)) && (v_extract_zi(v_cast_vec4i(__v_rename_at_18_1)) /*z*/ == 33)));
+    das_copy(das_swizzle_ref<int2,int3,0>::swizzle(__v_rename_at_18_1) /*xy*/,int2(1,2));
+    DAS_ASSERT((((v_extract_xi(v_cast_vec4i(__v_rename_at_18_1)) /*x*/ == 1) && (v_extract_yi(v_cast_vec4i(__v_rename_at_18_1)) /*y*/ == 2)) && (v_extract_zi(v_cast_vec4i(__v_rename_at_18_1)) /*z*/ == 33)));
+    das_copy(das_swizzle_ref<int2,int3,1>::swizzle(__v_rename_at_18_1) /*yz*/,int2(2,3));
+    DAS_ASSERT((((v_extract_xi(v_cast_vec4i(__v_rename_at_18_1)) /*x*/ == 1) && (v_extract_yi(v_cast_vec4i(__v_rename_at_18_1)) /*y*/ == 2)) && (v_extract_zi(v_cast_vec4i(__v_rename_at_18_1)) /*z*/ == 3)));
+    das_copy(__v_rename_at_18_1,int3(11,22,33));
+    DAS_ASSERT((SimPolicy<int3>::Equ(das_swizzle_seq<int3,int3,0>::swizzle(__v_rename_at_18_1) /*xyz*/,int3(11,22,33),*__context__,nullptr)));
+    Foo __fv_rename_at_39_2 = (([&]() -> Foo {
+        Foo __mks_39 = Foo_c386260f656f1c4b(__context__);
+        return __mks_39;
+    })());
+    DAS_ASSERT((SimPolicy<int3>::Equ(__fv_rename_at_39_2.v,int3(1,2,3),*__context__,nullptr)));
+    DAS_ASSERT((((v_extract_xi(v_cast_vec4i(__fv_rename_at_39_2.v)) /*x*/ == 1) && (v_extract_yi(v_cast_vec4i(__fv_rename_at_39_2.v)) /*y*/ == 2)) && (v_extract_zi(v_cast_vec4i(__fv_rename_at_39_2.v)) /*z*/ == 3)));
+    DAS_ASSERT((((SimPolicy<int2>::Equ(das_swizzle_seq<int2,int3,0>::swizzle(__fv_rename_at_39_2.v) /*xy*/,int2(1,2),*__context__,nullptr)) && (SimPolicy<int2>::Equ(das_swizzle_seq<int2,int3,1>::swizzle(__fv_rename_at_39_2.v) /*yz*/,int2(2,3),*__context__,nullptr))) && (SimPolicy<int2>::Equ(das_swizzle<int2,int3,2,0>::swizzle(__fv_rename_at_39_2.v) /*zx*/,int2(3,1),*__context__,nullptr))));
+    DAS_ASSERT((((SimPolicy<int2>::Equ(das_swizzle<int2,int3,1,0>::swizzle(__fv_rename_at_39_2.v) /*yx*/,int2(2,1),*__context__,nullptr)) && (SimPolicy<int2>::Equ(das_swizzle<int2,int3,2,1>::swizzle(__fv_rename_at_39_2.v) /*zy*/,int2(3,2),*__context__,nullptr))) && (SimPolicy<int2>::Equ(das_swizzle<int2,int3,0,2>::swizzle(__fv_rename_at_39_2.v) /*xz*/,int2(1,3),*__context__,nullptr))));
+    DAS_ASSERT((SimPolicy<int3>::Equ(funV_a60685e1c7101d96(__context__,__fv_rename_at_39_2.v),int3(1,2,3),*__context__,nullptr)));
+    DAS_ASSERT((((v_extract_xi(v_cast_vec4i(funV_a60685e1c7101d96(__context__,__fv_rename_at_39_2.v))) /*x*/ == 1) && (v_extract_yi(v_cast_vec4i(funV_a60685e1c7101d96(__context__,__fv_rename_at_39_2.v))) /*y*/ == 2)) && (v_extract_zi(v_cast_vec4i(funV_a60685e1c7101d96(__context__,__fv_rename_at_39_2.v))) /*z*/ == 3)));
+    das_copy(das_swizzle_ref<int32_t,int3,0>::swizzle(__fv_rename_at_39_2.v) /*x*/,11);
+    DAS_ASSERT((SimPolicy<int3>::Equ(__fv_rename_at_39_2.v,int3(11,2,3),*__context__,nullptr)));
+    das_copy(das_swizzle_ref<int32_t,int3,1>::swizzle(__fv_rename_at_39_2.v) /*y*/,22);
+    DAS_ASSERT((SimPolicy<int3>::Equ(__fv_rename_at_39_2.v,int3(11,22,3),*__context__,nullptr)));
+    das_copy(das_swizzle_ref<int32_t,int3,2>::swizzle(__fv_rename_at_39_2.v) /*z*/,33);
+    DAS_ASSERT((SimPolicy<int3>::Equ(__fv_rename_at_39_2.v,int3(11,22,33),*__context__,nullptr)));
+    DAS_ASSERT((((v_extract_xi(v_cast_vec4i(__fv_rename_at_39_2.v)) /*x*/ == 11) && (v_extract_yi(v_cast_vec4i(__fv_rename_at_39_2.v)) /*y*/ == 22)) && (v_extract_zi(v_cast_vec4i(__fv_rename_at_39_2.v)) /*z*/ == 33)));
+    das_copy(das_swizzle_ref<int2,int3,0>::swizzle(__fv_rename_at_39_2.v) /*xy*/,int2(1,2));
+    DAS_ASSERT((((v_extract_xi(v_cast_vec4i(__fv_rename_at_39_2.v)) /*x*/ == 1) && (v_extract_yi(v_cast_vec4i(__fv_rename_at_39_2.v)) /*y*/ == 2)) && (v_extract_zi(v_cast_vec4i(__fv_rename_at_39_2.v)) /*z*/ == 33)));
+    das_copy(das_swizzle_ref<int2,int3,1>::swizzle(__fv_rename_at_39_2.v) /*yz*/,int2(2,3));
+    DAS_ASSERT((((v_extract_xi(v_cast_vec4i(__fv_rename_at_39_2.v)) /*x*/ == 1) && (v_extract_yi(v_cast_vec4i(__fv_rename_at_39_2.v)) /*y*/ == 2)) && (v_extract_zi(v_cast_vec4i(__fv_rename_at_39_2.v)) /*z*/ == 3)));
+    das_copy(__fv_rename_at_39_2.v,int3(11,22,33));
+    DAS_ASSERT((SimPolicy<int3>::Equ(das_swizzle_seq<int3,int3,0>::swizzle(__fv_rename_at_39_2.v) /*xyz*/,int3(11,22,33),*__context__,nullptr)));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline Foo Foo_c386260f656f1c4b ( Context * __context__ )
+{
+    return /* <- */ das_auto_cast_move<Foo>::cast((([&]() -> Foo {
+        Foo __mks_6;
+        das_zero(__mks_6);
+        das_copy((__mks_6.v),(int3(1,2,3)));
+        return __mks_6;
+    })()));
+}
+static vec4f __wrap_funV_a60685e1c7101d96 ( Context * __context__ ) {
+    int3 arg_v = cast_aot_arg<int3>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<int3>::from(funV_a60685e1c7101d96(__context__, arg_v));
+}
+static vec4f __wrap_test_d62583f3570ca2b1 ( Context * __context__ ) {
+    return cast<bool>::from(test_d62583f3570ca2b1(__context__));
+}
+static vec4f __wrap_Foo_c386260f656f1c4b ( Context * __context__ ) {
+    *((Foo *) __context__->abiCMRES) = Foo_c386260f656f1c4b(__context__);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xa7c459bf5d2468de, false, (void*)&funV_a60685e1c7101d96, &__wrap_funV_a60685e1c7101d96 },
+    { 0xe2d142e244d9d3de, false, (void*)&test_d62583f3570ca2b1, &__wrap_test_d62583f3570ca2b1 },
+    { 0x65cc2a008b4d103, true, (void*)&Foo_c386260f656f1c4b, &__wrap_Foo_c386260f656f1c4b },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_6091784630920202320
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
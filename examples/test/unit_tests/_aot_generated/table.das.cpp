@@ -0,0 +1,1166 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_750805067777521187 {
+
+namespace  { struct TestStruct; };
+namespace  { struct TableContainer; };
+namespace  {
+
+struct TestStruct {
+    char * test;
+};
+static_assert(sizeof(TestStruct)==8,"structure size mismatch with DAS");
+static_assert(offsetof(TestStruct,test)==0,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct TableContainer {
+    TTable<char *,TestStruct> t;
+};
+static_assert(sizeof(TableContainer)==48,"structure size mismatch with DAS");
+static_assert(offsetof(TableContainer,t)==0,"structure field offset mismatch with DAS");
+}
+extern TypeInfo __type_info__af8afe4c86446b52;
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af63ee4c86020b22;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __func_info__684afc35d2507966_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 317, 4, UINT64_C(0x87ea6a4a279e80f4), "num", 0, 0 };
+VarInfo * __func_info__684afc35d2507966_fields[1] =  { &__func_info__684afc35d2507966_field_0 };
+FuncInfo __func_info__684afc35d2507966 = {"invoke block<(num:int const&):void> const", "", __func_info__684afc35d2507966_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x684afc35d2507966), 0x0 };
+VarInfo __func_info__96c0c74709b58fd8_field_0 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16677, 8, UINT64_C(0xe1d0b6d3ff5a0cc5), "val", 0, 0 };
+VarInfo * __func_info__96c0c74709b58fd8_fields[1] =  { &__func_info__96c0c74709b58fd8_field_0 };
+FuncInfo __func_info__96c0c74709b58fd8 = {"invoke block<(val:string const&):string const> const", "", __func_info__96c0c74709b58fd8_fields, 1, 32, &__type_info__af90fe4c864e9d52, nullptr,0,UINT64_C(0x96c0c74709b58fd8), 0x0 };
+VarInfo __func_info__a58c92ace20cedf7_field_0 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16677, 8, UINT64_C(0xe1d0b6d3ff5a0cc5), "val", 0, 0 };
+VarInfo * __func_info__a58c92ace20cedf7_fields[1] =  { &__func_info__a58c92ace20cedf7_field_0 };
+FuncInfo __func_info__a58c92ace20cedf7 = {"invoke block<(val:string const&):string> const", "", __func_info__a58c92ace20cedf7_fields, 1, 32, &__type_info__af63ee4c86020b22, nullptr,0,UINT64_C(0xa58c92ace20cedf7), 0x0 };
+VarInfo __func_info__576e3cb427cfad47_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 4, UINT64_C(0x77be9513004cdf76), "num", 0, 0 };
+VarInfo * __func_info__576e3cb427cfad47_fields[1] =  { &__func_info__576e3cb427cfad47_field_0 };
+FuncInfo __func_info__576e3cb427cfad47 = {"invoke block<(var num:int&):void> const", "", __func_info__576e3cb427cfad47_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x576e3cb427cfad47), 0x0 };
+VarInfo __func_info__4c623eeeb7eb7579_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 4, UINT64_C(0xaf75e0d3b0b010b5), "pVal", 0, 0 };
+VarInfo * __func_info__4c623eeeb7eb7579_fields[1] =  { &__func_info__4c623eeeb7eb7579_field_0 };
+FuncInfo __func_info__4c623eeeb7eb7579 = {"invoke block<(var pVal:int&):void> const", "", __func_info__4c623eeeb7eb7579_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x4c623eeeb7eb7579), 0x0 };
+VarInfo __func_info__fad5963896307a5e_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 4, UINT64_C(0xf1f503752947387a), "pValue", 0, 0 };
+VarInfo * __func_info__fad5963896307a5e_fields[1] =  { &__func_info__fad5963896307a5e_field_0 };
+FuncInfo __func_info__fad5963896307a5e = {"invoke block<(var pValue:int&):void> const", "", __func_info__fad5963896307a5e_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xfad5963896307a5e), 0x0 };
+VarInfo __func_info__bf1bfac15d80e026_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 4, UINT64_C(0x9c30f207594ad2ff), "t", 0, 0 };
+VarInfo * __func_info__bf1bfac15d80e026_fields[1] =  { &__func_info__bf1bfac15d80e026_field_0 };
+FuncInfo __func_info__bf1bfac15d80e026 = {"invoke block<(var t:int&):void> const", "", __func_info__bf1bfac15d80e026_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xbf1bfac15d80e026), 0x0 };
+VarInfo __func_info__c6d2220a06d5d8ed_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x10aaf808422702c8), "val", 0, 0 };
+VarInfo * __func_info__c6d2220a06d5d8ed_fields[1] =  { &__func_info__c6d2220a06d5d8ed_field_0 };
+FuncInfo __func_info__c6d2220a06d5d8ed = {"invoke block<(var val:array<int>):void> const", "", __func_info__c6d2220a06d5d8ed_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xc6d2220a06d5d8ed), 0x0 };
+VarInfo __func_info__5f59ad38d8b49003_field_0 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16645, 8, UINT64_C(0x81b1eeb109811f5b), "val", 0, 0 };
+VarInfo * __func_info__5f59ad38d8b49003_fields[1] =  { &__func_info__5f59ad38d8b49003_field_0 };
+FuncInfo __func_info__5f59ad38d8b49003 = {"invoke block<(var val:string&):void> const", "", __func_info__5f59ad38d8b49003_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x5f59ad38d8b49003), 0x0 };
+TypeInfo __type_info__af8afe4c86446b52 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf8afe4c86446b52) };
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__af63ee4c86020b22 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0xaf63ee4c86020b22) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__af90fe4c864e9d52, &__type_info__af8afe4c86446b52 };
+TypeInfo * __tinfo_3[3] = { &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_4[2] = { &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52 };
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline bool _FuncbuiltinTickgetTick13445059837844701140_1e08f5e9a07ea178 ( Context * __context__, TTable<char *,int32_t> const  & __Tab_rename_at_636_2, char * const  __at_rename_at_636_3, Block DAS_COMMENT((void,int32_t const  &)) const  & __blk_rename_at_636_4 );
+inline bool _FuncbuiltinTickkey_existsTick16808803843923989214_2b81a30a1fa16757 ( Context * __context__, TTable<range,void> const  & __Tab_rename_at_1040_6, range __at_rename_at_1040_7 );
+inline void _FuncbuiltinTickget_with_defaultTick6209824659559181658_443604db1c66613 ( Context * __context__, TTable<int32_t,char *> & __Tab_rename_at_998_8, int32_t __at_rename_at_998_9, Block DAS_COMMENT((void,char * &)) const  & __blk_rename_at_998_10 );
+inline void _FuncbuiltinTickmodifyTick6564733278045083810_1a800d555c0e8fed ( Context * __context__, TTable<int32_t,char *> & __Tab_rename_at_1016_12, int32_t __at_rename_at_1016_13, Block DAS_COMMENT((char *,char * const  &)) const  & __blk_rename_at_1016_14 );
+inline bool _FuncbuiltinTickkey_existsTick16808803843923989214_4caa670b00c7a51d ( Context * __context__, TTable<int32_t,TArray<int32_t>> const  & __Tab_rename_at_1040_16, int32_t __at_rename_at_1040_17 );
+inline void _FuncbuiltinTickemplaceTick10052523023165887793_b75fd3feb1e265c2 ( Context * __context__, TTable<int32_t,TArray<int32_t>> & __Tab_rename_at_904_18, int32_t __at_rename_at_904_19, TArray<int32_t> & __val_rename_at_904_20 );
+inline TTable<char *,int32_t> _FuncbuiltinTickto_table_moveTick5858896087460481804_851cc220ee3e1eba ( Context * __context__, TDim<TTuple<16,char *,int32_t>,2> & __a_rename_at_1615_21 );
+inline TTable<range,void> _FuncbuiltinTickto_table_moveTick5765297898159484544_6260ad27110f991b ( Context * __context__, range __a_rename_at_1595_24 );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25 ( Context * __context__, TDim<int32_t,1> & __a_rename_at_1502_26 );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115 ( Context * __context__, TDim<int32_t,2> & __a_rename_at_1502_28 );
+inline TTable<int32_t,char *> _FuncbuiltinTickto_table_moveTick5858896087460481804_5eb44beeb4d0d356 ( Context * __context__, TDim<TTuple<16,int32_t,char *>,3> & __a_rename_at_1615_30 );
+inline bool _FuncbuiltinTickeraseTick5639988512056021548_36c2058c3870e227 ( Context * __context__, TTable<char *,int32_t> & __Tab_rename_at_804_33, char * const  __at_rename_at_804_34 );
+inline void _FuncbuiltinTickinsertTick4246857231018487965_187667225c528ca6 ( Context * __context__, TTable<char *,int32_t> & __Tab_rename_at_860_35, char * const  __at_rename_at_860_36, int32_t __val_rename_at_860_37 );
+inline int32_t _FuncbuiltinTickget_valueTick6803070933163225147_1fb948942e132956 ( Context * __context__, TTable<char *,int32_t> & __Tab_rename_at_755_38, char * const  __at_rename_at_755_39 );
+inline bool _FuncbuiltinTickgetTick8447005936052527643_6e6ef22c066af7b8 ( Context * __context__, TTable<char *,int32_t> & __Tab_rename_at_664_40, char * const  __at_rename_at_664_41, Block DAS_COMMENT((void,int32_t &)) const  & __blk_rename_at_664_42 );
+inline Sequence DAS_COMMENT((char *)) _FuncbuiltinTickkeysTick17388619793938508994_e3f2e1930896ee39 ( Context * __context__, TTable<char *,int32_t> & __a_rename_at_1282_44 );
+inline Sequence DAS_COMMENT((int32_t &)) _FuncbuiltinTickvaluesTick1351216622833168869_6b57e9137f2764bb ( Context * __context__, TTable<char *,int32_t> & __a_rename_at_1304_46 );
+inline bool _FuncbuiltinTickkey_existsTick16808803843923989214_7b10704e57c28a36 ( Context * __context__, TTable<bool,int32_t> const  & __Tab_rename_at_1040_48, bool __at_rename_at_1040_49 );
+inline void _FuncbuiltinTickinsertTick12964066441666329206_1d77a2f338972bad ( Context * __context__, TTable<bool,int32_t> & __Tab_rename_at_869_50, bool __at_rename_at_869_51, int32_t __val_rename_at_869_52 );
+inline bool _FuncbuiltinTickkey_existsTick16808803843923989214_caeace491c7b2b48 ( Context * __context__, TTable<int32_t,int32_t> const  & __Tab_rename_at_1040_53, int32_t __at_rename_at_1040_54 );
+inline void _FuncbuiltinTickinsertTick12964066441666329206_8708a1b09bfda92d ( Context * __context__, TTable<int32_t,int32_t> & __Tab_rename_at_869_55, int32_t __at_rename_at_869_56, int32_t __val_rename_at_869_57 );
+inline bool _FuncbuiltinTickeraseTick5639988512056021548_f34d0c388c7b1686 ( Context * __context__, TTable<int32_t,int32_t> & __Tab_rename_at_804_58, int32_t __at_rename_at_804_59 );
+inline bool _FuncbuiltinTickkey_existsTick16808803843923989214_8d6aa4fe1fff2b7e ( Context * __context__, TTable<char *,int32_t> const  & __Tab_rename_at_1040_60, char * const  __at_rename_at_1040_61 );
+inline void _FuncbuiltinTickinsertTick12964066441666329206_2882a6217bcc1a60 ( Context * __context__, TTable<char *,int32_t> & __Tab_rename_at_869_62, char * const  __at_rename_at_869_63, int32_t __val_rename_at_869_64 );
+inline TestStruct _FuncbuiltinTickget_valueTick6803070933163225147_6ad3f567ba2ea7fe ( Context * __context__, TTable<char *,TestStruct> & __Tab_rename_at_755_65, char * const  __at_rename_at_755_66 );
+inline void _FuncbuiltinTickpushTick10769833213962245646_a54a33ebec8df23f ( Context * __context__, TArray<char *> & __Arr_rename_at_193_67, char * __value_rename_at_193_68 );
+inline void _FuncbuiltinTickemplaceTick10052523023165887793_ac53920b83b2d4e7 ( Context * __context__, TTable<char *,TestStruct> & __Tab_rename_at_904_69, char * const  __at_rename_at_904_70, TestStruct & __val_rename_at_904_71 );
+inline void _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_177_72, int32_t __value_rename_at_177_73 );
+inline bool _FuncbuiltinTickeraseTick5639988512056021548_2767e79a7e9ede7 ( Context * __context__, TTable<char *,TestStruct> & __Tab_rename_at_804_74, char * const  __at_rename_at_804_75 );
+inline void _FuncbuiltinTickinsert_defaultTick7331679198661816033_97d138b5cffcc5c3 ( Context * __context__, TTable<char *,int32_t> & __tab_rename_at_976_76, char * const  __key_rename_at_976_77, int32_t __value_rename_at_976_78 );
+inline void _FuncbuiltinTickinsert_defaultTick17230753450391567662_8786afcc411080 ( Context * __context__, TTable<char *,int32_t> & __tab_rename_at_983_79, char * const  __key_rename_at_983_80 );
+inline void _FuncbuiltinTickemplace_defaultTick9884809586623040093_f1d353d036e2061f ( Context * __context__, TTable<int32_t,TArray<int32_t>> & __tab_rename_at_991_81, int32_t __key_rename_at_991_82 );
+inline bool _FuncbuiltinTickgetTick8447005936052527643_1302cd468b5f4a91 ( Context * __context__, TTable<int32_t,TArray<int32_t>> & __Tab_rename_at_664_83, int32_t __at_rename_at_664_84, Block DAS_COMMENT((void,TArray<int32_t>)) const  & __blk_rename_at_664_85 );
+inline bool test_find_825a547b773baf64 ( Context * __context__ );
+inline bool test_d52304620726c89f ( Context * __context__ );
+inline bool test_lock_panic_edf9391a0a6e0f2b ( Context * __context__ );
+inline bool check_4cc7ac2c5e523aa7 ( Context * __context__, TableContainer & __t_rename_at_205_116, TArray<int32_t> const  & __deletedEntries_rename_at_205_117 );
+inline void test_erase_collision_fe3179fbfa7989f1 ( Context * __context__ );
+inline bool test_insert_default_8774c68251d0303c ( Context * __context__ );
+inline bool test_get_with_default_22dd09a002096416 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline bool _FuncbuiltinTickgetTick13445059837844701140_1e08f5e9a07ea178 ( Context * __context__, TTable<char *,int32_t> const  &  __Tab_rename_at_636_2, char * const  __at_rename_at_636_3, Block DAS_COMMENT((void,int32_t const  &)) const  &  __blk_rename_at_636_4 )
+{
+    int32_t * __val_rename_at_637_5 = __builtin_table_find(__context__,__Tab_rename_at_636_2,__at_rename_at_636_3);
+    if ( __val_rename_at_637_5 != nullptr )
+    {
+        builtin_table_lock(__Tab_rename_at_636_2,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        das_invoke<void>::invoke<int32_t &>(__context__,nullptr,__blk_rename_at_636_4,das_deref(__context__,das_cast<int32_t *>::cast(__val_rename_at_637_5),__FILE__,__LINE__));
+        builtin_table_unlock(__Tab_rename_at_636_2,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        return das_auto_cast<bool>::cast(true);
+    } else {
+        return das_auto_cast<bool>::cast(false);
+    };
+}
+
+inline bool _FuncbuiltinTickkey_existsTick16808803843923989214_2b81a30a1fa16757 ( Context * __context__, TTable<range,void> const  &  __Tab_rename_at_1040_6, range __at_rename_at_1040_7 )
+{
+    return das_auto_cast<bool>::cast(__builtin_table_key_exists(__context__,__Tab_rename_at_1040_6,__at_rename_at_1040_7));
+}
+
+inline void _FuncbuiltinTickget_with_defaultTick6209824659559181658_443604db1c66613 ( Context * __context__, TTable<int32_t,char *> &  __Tab_rename_at_998_8, int32_t __at_rename_at_998_9, Block DAS_COMMENT((void,char * &)) const  &  __blk_rename_at_998_10 )
+{
+    char * * __pval_rename_at_1001_11 = TTable<int32_t,char *>::safe_index(&(__Tab_rename_at_998_8),__at_rename_at_998_9,__context__);
+    if ( __pval_rename_at_1001_11 == nullptr )
+    {
+        das_copy(__pval_rename_at_1001_11,das_ref(__context__,__Tab_rename_at_998_8(__at_rename_at_998_9,__context__)));
+        das_copy(das_deref(__context__,__pval_rename_at_1001_11,__FILE__,__LINE__),nullptr);
+    };
+    builtin_table_lock(das_arg<TTable<int32_t,char *>>::pass(__Tab_rename_at_998_8),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    das_invoke<void>::invoke<char * &>(__context__,nullptr,__blk_rename_at_998_10,das_deref(__context__,__pval_rename_at_1001_11,__FILE__,__LINE__));
+    builtin_table_unlock(das_arg<TTable<int32_t,char *>>::pass(__Tab_rename_at_998_8),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickmodifyTick6564733278045083810_1a800d555c0e8fed ( Context * __context__, TTable<int32_t,char *> &  __Tab_rename_at_1016_12, int32_t __at_rename_at_1016_13, Block DAS_COMMENT((char *,char * const  &)) const  &  __blk_rename_at_1016_14 )
+{
+    char * * __pval_rename_at_1020_15 = TTable<int32_t,char *>::safe_index(&(__Tab_rename_at_1016_12),__at_rename_at_1016_13,__context__);
+    if ( __pval_rename_at_1020_15 == nullptr )
+    {
+        das_copy(__pval_rename_at_1020_15,das_ref(__context__,__Tab_rename_at_1016_12(__at_rename_at_1016_13,__context__)));
+        das_copy(das_deref(__context__,__pval_rename_at_1020_15,__FILE__,__LINE__),nullptr);
+    };
+    builtin_table_lock(das_arg<TTable<int32_t,char *>>::pass(__Tab_rename_at_1016_12),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    das_copy(das_deref(__context__,__pval_rename_at_1020_15,__FILE__,__LINE__),das_invoke<char *>::invoke<char * &>(__context__,nullptr,__blk_rename_at_1016_14,das_deref(__context__,__pval_rename_at_1020_15,__FILE__,__LINE__)));
+    builtin_table_unlock(das_arg<TTable<int32_t,char *>>::pass(__Tab_rename_at_1016_12),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline bool _FuncbuiltinTickkey_existsTick16808803843923989214_4caa670b00c7a51d ( Context * __context__, TTable<int32_t,TArray<int32_t>> const  &  __Tab_rename_at_1040_16, int32_t __at_rename_at_1040_17 )
+{
+    return das_auto_cast<bool>::cast(__builtin_table_key_exists(__context__,__Tab_rename_at_1040_16,__at_rename_at_1040_17));
+}
+
+inline void _FuncbuiltinTickemplaceTick10052523023165887793_b75fd3feb1e265c2 ( Context * __context__, TTable<int32_t,TArray<int32_t>> &  __Tab_rename_at_904_18, int32_t __at_rename_at_904_19, TArray<int32_t> &  __val_rename_at_904_20 )
+{
+    das_move(__Tab_rename_at_904_18(__at_rename_at_904_19,__context__),__val_rename_at_904_20);
+}
+
+inline TTable<char *,int32_t> _FuncbuiltinTickto_table_moveTick5858896087460481804_851cc220ee3e1eba ( Context * __context__, TDim<TTuple<16,char *,int32_t>,2> &  __a_rename_at_1615_21 )
+{
+    TTable<char *,int32_t> __tab_rename_at_1616_22;das_zero(__tab_rename_at_1616_22);
+    {
+        bool __need_loop_1618 = true;
+        // x: tuple<string aka keyT;int aka valT>&
+        das_iterator<TDim<TTuple<16,char *,int32_t>,2>> __x_iterator(__a_rename_at_1615_21);
+        TTuple<16,char *,int32_t> * __x_rename_at_1618_23;
+        __need_loop_1618 = __x_iterator.first(__context__,(__x_rename_at_1618_23)) && __need_loop_1618;
+        for ( ; __need_loop_1618 ; __need_loop_1618 = __x_iterator.next(__context__,(__x_rename_at_1618_23)) )
+        {
+            das_copy(__tab_rename_at_1616_22(das_get_tuple_field<char *,0>::get((*__x_rename_at_1618_23)),__context__),das_get_tuple_field<int32_t,8>::get((*__x_rename_at_1618_23)));
+        }
+        __x_iterator.close(__context__,(__x_rename_at_1618_23));
+    };
+    return /* <- */ das_auto_cast_move<TTable<char *,int32_t>>::cast(__tab_rename_at_1616_22);
+}
+
+inline TTable<range,void> _FuncbuiltinTickto_table_moveTick5765297898159484544_6260ad27110f991b ( Context * __context__, range __a_rename_at_1595_24 )
+{
+    TTable<range,void> __tab_rename_at_1596_25;das_zero(__tab_rename_at_1596_25);
+    __builtin_table_set_insert(__context__,__tab_rename_at_1596_25,__a_rename_at_1595_24);
+    return /* <- */ das_auto_cast_move<TTable<range,void>>::cast(__tab_rename_at_1596_25);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25 ( Context * __context__, TDim<int32_t,1> &  __a_rename_at_1502_26 )
+{
+    TArray<int32_t> __arr_rename_at_1504_27;das_zero(__arr_rename_at_1504_27);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_27),1);
+    das_copy(das_cast<TDim<int32_t,1>>::cast(das_ref(__context__,__arr_rename_at_1504_27(0,__context__))),__a_rename_at_1502_26);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_27);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115 ( Context * __context__, TDim<int32_t,2> &  __a_rename_at_1502_28 )
+{
+    TArray<int32_t> __arr_rename_at_1504_29;das_zero(__arr_rename_at_1504_29);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_29),2);
+    das_copy(das_cast<TDim<int32_t,2>>::cast(das_ref(__context__,__arr_rename_at_1504_29(0,__context__))),__a_rename_at_1502_28);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_29);
+}
+
+inline TTable<int32_t,char *> _FuncbuiltinTickto_table_moveTick5858896087460481804_5eb44beeb4d0d356 ( Context * __context__, TDim<TTuple<16,int32_t,char *>,3> &  __a_rename_at_1615_30 )
+{
+    TTable<int32_t,char *> __tab_rename_at_1616_31;das_zero(__tab_rename_at_1616_31);
+    {
+        bool __need_loop_1618 = true;
+        // x: tuple<int aka keyT;string aka valT>&
+        das_iterator<TDim<TTuple<16,int32_t,char *>,3>> __x_iterator(__a_rename_at_1615_30);
+        TTuple<16,int32_t,char *> * __x_rename_at_1618_32;
+        __need_loop_1618 = __x_iterator.first(__context__,(__x_rename_at_1618_32)) && __need_loop_1618;
+        for ( ; __need_loop_1618 ; __need_loop_1618 = __x_iterator.next(__context__,(__x_rename_at_1618_32)) )
+        {
+            das_copy(__tab_rename_at_1616_31(das_get_tuple_field<int32_t,0>::get((*__x_rename_at_1618_32)),__context__),das_get_tuple_field<char *,8>::get((*__x_rename_at_1618_32)));
+        }
+        __x_iterator.close(__context__,(__x_rename_at_1618_32));
+    };
+    return /* <- */ das_auto_cast_move<TTable<int32_t,char *>>::cast(__tab_rename_at_1616_31);
+}
+
+inline bool _FuncbuiltinTickeraseTick5639988512056021548_36c2058c3870e227 ( Context * __context__, TTable<char *,int32_t> &  __Tab_rename_at_804_33, char * const  __at_rename_at_804_34 )
+{
+    return das_auto_cast<bool>::cast(__builtin_table_erase(__context__,__Tab_rename_at_804_33,__at_rename_at_804_34));
+}
+
+inline void _FuncbuiltinTickinsertTick4246857231018487965_187667225c528ca6 ( Context * __context__, TTable<char *,int32_t> &  __Tab_rename_at_860_35, char * const  __at_rename_at_860_36, int32_t __val_rename_at_860_37 )
+{
+    das_copy(__Tab_rename_at_860_35(__at_rename_at_860_36,__context__),__val_rename_at_860_37);
+}
+
+inline int32_t _FuncbuiltinTickget_valueTick6803070933163225147_1fb948942e132956 ( Context * __context__, TTable<char *,int32_t> &  __Tab_rename_at_755_38, char * const  __at_rename_at_755_39 )
+{
+    return das_auto_cast<int32_t>::cast(__Tab_rename_at_755_38(__at_rename_at_755_39,__context__));
+}
+
+inline bool _FuncbuiltinTickgetTick8447005936052527643_6e6ef22c066af7b8 ( Context * __context__, TTable<char *,int32_t> &  __Tab_rename_at_664_40, char * const  __at_rename_at_664_41, Block DAS_COMMENT((void,int32_t &)) const  &  __blk_rename_at_664_42 )
+{
+    int32_t * __val_rename_at_665_43 = __builtin_table_find(__context__,__Tab_rename_at_664_40,__at_rename_at_664_41);
+    if ( __val_rename_at_665_43 != nullptr )
+    {
+        builtin_table_lock(das_arg<TTable<char *,int32_t>>::pass(__Tab_rename_at_664_40),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        das_invoke<void>::invoke<int32_t &>(__context__,nullptr,__blk_rename_at_664_42,das_deref(__context__,das_cast<int32_t *>::cast(__val_rename_at_665_43),__FILE__,__LINE__));
+        builtin_table_unlock(das_arg<TTable<char *,int32_t>>::pass(__Tab_rename_at_664_40),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        return das_auto_cast<bool>::cast(true);
+    } else {
+        return das_auto_cast<bool>::cast(false);
+    };
+}
+
+inline Sequence DAS_COMMENT((char *)) _FuncbuiltinTickkeysTick17388619793938508994_e3f2e1930896ee39 ( Context * __context__, TTable<char *,int32_t> &  __a_rename_at_1282_44 )
+{
+    Sequence DAS_COMMENT((char *)) __it_rename_at_1283_45;das_zero(__it_rename_at_1283_45);
+    builtin_table_keys(das_arg<Sequence DAS_COMMENT((char *))>::pass(__it_rename_at_1283_45),das_arg<TTable<char *,int32_t>>::pass(__a_rename_at_1282_44),8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char *))>::cast(__it_rename_at_1283_45);
+}
+
+inline Sequence DAS_COMMENT((int32_t &)) _FuncbuiltinTickvaluesTick1351216622833168869_6b57e9137f2764bb ( Context * __context__, TTable<char *,int32_t> &  __a_rename_at_1304_46 )
+{
+    Sequence DAS_COMMENT((int32_t *)) __it_rename_at_1305_47;das_zero(__it_rename_at_1305_47);
+    builtin_table_values(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_1305_47),das_arg<TTable<char *,int32_t>>::pass(__a_rename_at_1304_46),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t &))>::cast(__it_rename_at_1305_47);
+}
+
+inline bool _FuncbuiltinTickkey_existsTick16808803843923989214_7b10704e57c28a36 ( Context * __context__, TTable<bool,int32_t> const  &  __Tab_rename_at_1040_48, bool __at_rename_at_1040_49 )
+{
+    return das_auto_cast<bool>::cast(__builtin_table_key_exists(__context__,__Tab_rename_at_1040_48,__at_rename_at_1040_49));
+}
+
+inline void _FuncbuiltinTickinsertTick12964066441666329206_1d77a2f338972bad ( Context * __context__, TTable<bool,int32_t> &  __Tab_rename_at_869_50, bool __at_rename_at_869_51, int32_t __val_rename_at_869_52 )
+{
+    das_copy(__Tab_rename_at_869_50(__at_rename_at_869_51,__context__),__val_rename_at_869_52);
+}
+
+inline bool _FuncbuiltinTickkey_existsTick16808803843923989214_caeace491c7b2b48 ( Context * __context__, TTable<int32_t,int32_t> const  &  __Tab_rename_at_1040_53, int32_t __at_rename_at_1040_54 )
+{
+    return das_auto_cast<bool>::cast(__builtin_table_key_exists(__context__,__Tab_rename_at_1040_53,__at_rename_at_1040_54));
+}
+
+inline void _FuncbuiltinTickinsertTick12964066441666329206_8708a1b09bfda92d ( Context * __context__, TTable<int32_t,int32_t> &  __Tab_rename_at_869_55, int32_t __at_rename_at_869_56, int32_t __val_rename_at_869_57 )
+{
+    das_copy(__Tab_rename_at_869_55(__at_rename_at_869_56,__context__),__val_rename_at_869_57);
+}
+
+inline bool _FuncbuiltinTickeraseTick5639988512056021548_f34d0c388c7b1686 ( Context * __context__, TTable<int32_t,int32_t> &  __Tab_rename_at_804_58, int32_t __at_rename_at_804_59 )
+{
+    return das_auto_cast<bool>::cast(__builtin_table_erase(__context__,__Tab_rename_at_804_58,__at_rename_at_804_59));
+}
+
+inline bool _FuncbuiltinTickkey_existsTick16808803843923989214_8d6aa4fe1fff2b7e ( Context * __context__, TTable<char *,int32_t> const  &  __Tab_rename_at_1040_60, char * const  __at_rename_at_1040_61 )
+{
+    return das_auto_cast<bool>::cast(__builtin_table_key_exists(__context__,__Tab_rename_at_1040_60,__at_rename_at_1040_61));
+}
+
+inline void _FuncbuiltinTickinsertTick12964066441666329206_2882a6217bcc1a60 ( Context * __context__, TTable<char *,int32_t> &  __Tab_rename_at_869_62, char * const  __at_rename_at_869_63, int32_t __val_rename_at_869_64 )
+{
+    das_copy(__Tab_rename_at_869_62(__at_rename_at_869_63,__context__),__val_rename_at_869_64);
+}
+
+inline TestStruct _FuncbuiltinTickget_valueTick6803070933163225147_6ad3f567ba2ea7fe ( Context * __context__, TTable<char *,TestStruct> &  __Tab_rename_at_755_65, char * const  __at_rename_at_755_66 )
+{
+    return das_auto_cast_ref<TestStruct>::cast(__Tab_rename_at_755_65(__at_rename_at_755_66,__context__));
+}
+
+inline void _FuncbuiltinTickpushTick10769833213962245646_a54a33ebec8df23f ( Context * __context__, TArray<char *> &  __Arr_rename_at_193_67, char * __value_rename_at_193_68 )
+{
+    das_copy(__Arr_rename_at_193_67(builtin_array_push_back(das_arg<TArray<char *>>::pass(__Arr_rename_at_193_67),8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_193_68);
+}
+
+inline void _FuncbuiltinTickemplaceTick10052523023165887793_ac53920b83b2d4e7 ( Context * __context__, TTable<char *,TestStruct> &  __Tab_rename_at_904_69, char * const  __at_rename_at_904_70, TestStruct &  __val_rename_at_904_71 )
+{
+    das_move(__Tab_rename_at_904_69(__at_rename_at_904_70,__context__),__val_rename_at_904_71);
+}
+
+inline void _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_177_72, int32_t __value_rename_at_177_73 )
+{
+    das_copy(__Arr_rename_at_177_72(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_177_72),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_177_73);
+}
+
+inline bool _FuncbuiltinTickeraseTick5639988512056021548_2767e79a7e9ede7 ( Context * __context__, TTable<char *,TestStruct> &  __Tab_rename_at_804_74, char * const  __at_rename_at_804_75 )
+{
+    return das_auto_cast<bool>::cast(__builtin_table_erase(__context__,__Tab_rename_at_804_74,__at_rename_at_804_75));
+}
+
+inline void _FuncbuiltinTickinsert_defaultTick7331679198661816033_97d138b5cffcc5c3 ( Context * __context__, TTable<char *,int32_t> &  __tab_rename_at_976_76, char * const  __key_rename_at_976_77, int32_t __value_rename_at_976_78 )
+{
+    if ( !_FuncbuiltinTickkey_existsTick16808803843923989214_8d6aa4fe1fff2b7e(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_976_76),__key_rename_at_976_77) )
+    {
+        _FuncbuiltinTickinsertTick12964066441666329206_2882a6217bcc1a60(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_976_76),__key_rename_at_976_77,__value_rename_at_976_78);
+    };
+}
+
+inline void _FuncbuiltinTickinsert_defaultTick17230753450391567662_8786afcc411080 ( Context * __context__, TTable<char *,int32_t> &  __tab_rename_at_983_79, char * const  __key_rename_at_983_80 )
+{
+    if ( !_FuncbuiltinTickkey_existsTick16808803843923989214_8d6aa4fe1fff2b7e(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_983_79),__key_rename_at_983_80) )
+    {
+        _FuncbuiltinTickinsertTick4246857231018487965_187667225c528ca6(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_983_79),__key_rename_at_983_80,0);
+    };
+}
+
+inline void _FuncbuiltinTickemplace_defaultTick9884809586623040093_f1d353d036e2061f ( Context * __context__, TTable<int32_t,TArray<int32_t>> &  __tab_rename_at_991_81, int32_t __key_rename_at_991_82 )
+{
+    if ( !_FuncbuiltinTickkey_existsTick16808803843923989214_4caa670b00c7a51d(__context__,das_arg<TTable<int32_t,TArray<int32_t>>>::pass(__tab_rename_at_991_81),__key_rename_at_991_82) )
+    {
+        TArray<int32_t> _temp_make_local_994_26_0; _temp_make_local_994_26_0;
+        _FuncbuiltinTickemplaceTick10052523023165887793_b75fd3feb1e265c2(__context__,das_arg<TTable<int32_t,TArray<int32_t>>>::pass(__tab_rename_at_991_81),__key_rename_at_991_82,das_arg<TArray<int32_t>>::pass((([&]() -> TArray<int32_t>& {
+            das_zero(_temp_make_local_994_26_0);
+            return _temp_make_local_994_26_0;
+        })())));
+    };
+}
+
+inline bool _FuncbuiltinTickgetTick8447005936052527643_1302cd468b5f4a91 ( Context * __context__, TTable<int32_t,TArray<int32_t>> &  __Tab_rename_at_664_83, int32_t __at_rename_at_664_84, Block DAS_COMMENT((void,TArray<int32_t>)) const  &  __blk_rename_at_664_85 )
+{
+    TArray<int32_t> * __val_rename_at_665_86 = __builtin_table_find(__context__,__Tab_rename_at_664_83,__at_rename_at_664_84);
+    if ( __val_rename_at_665_86 != nullptr )
+    {
+        builtin_table_lock(das_arg<TTable<int32_t,TArray<int32_t>>>::pass(__Tab_rename_at_664_83),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        das_invoke<void>::invoke<TArray<int32_t> &>(__context__,nullptr,__blk_rename_at_664_85,das_arg<TArray<int32_t>>::pass(das_deref(__context__,das_cast<TArray<int32_t> *>::cast(__val_rename_at_665_86),__FILE__,__LINE__)));
+        builtin_table_unlock(das_arg<TTable<int32_t,TArray<int32_t>>>::pass(__Tab_rename_at_664_83),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        return das_auto_cast<bool>::cast(true);
+    } else {
+        return das_auto_cast<bool>::cast(false);
+    };
+}
+
+inline bool test_find_825a547b773baf64 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,192,"test_find " DAS_FILE_LINE);
+{
+    TDim<TTuple<16,char *,int32_t>,2> _temp_make_local_3_21_1; _temp_make_local_3_21_1;
+    TDim<TTuple<16,char *,int32_t>,2> _temp_make_local_8_15_2; _temp_make_local_8_15_2;
+    TTable<char *,int32_t> __const_tab_rename_at_3_87_ConstRef; das_zero(__const_tab_rename_at_3_87_ConstRef); das_move(__const_tab_rename_at_3_87_ConstRef, ((TTable<char *,int32_t>)_FuncbuiltinTickto_table_moveTick5858896087460481804_851cc220ee3e1eba(__context__,das_arg<TDim<TTuple<16,char *,int32_t>,2>>::pass((([&]() -> TDim<TTuple<16,char *,int32_t>,2>& {
+        _temp_make_local_3_21_1(0,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+            TTuple<16,char *,int32_t> __mkt_3;
+            das_get_tuple_field<char *,0>::get(__mkt_3) = ((char *) "one");
+            das_get_tuple_field<int32_t,8>::get(__mkt_3) = 1;
+            return __mkt_3;
+        })());
+        _temp_make_local_3_21_1(1,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+            TTuple<16,char *,int32_t> __mkt_3;
+            das_get_tuple_field<char *,0>::get(__mkt_3) = ((char *) "two");
+            das_get_tuple_field<int32_t,8>::get(__mkt_3) = 2;
+            return __mkt_3;
+        })());
+        return _temp_make_local_3_21_1;
+    })())))));
+    TTable<char *,int32_t> const  & __const_tab_rename_at_3_87 = __const_tab_rename_at_3_87_ConstRef;
+;
+    _FuncbuiltinTickgetTick13445059837844701140_1e08f5e9a07ea178(__context__,__const_tab_rename_at_3_87,((char *) "one"),das_make_block<void,int32_t const  &>(__context__,128,0,&__func_info__684afc35d2507966,[&](int32_t const  & __num_rename_at_4_88) -> void{
+        DAS_ASSERT((__num_rename_at_4_88 == 1));
+    }));
+    DAS_ASSERT((das_null_coalescing<int32_t>::get(TTable<char *,int32_t>::safe_index(&(__const_tab_rename_at_3_87),((char *) "one"),__context__),100500) == 1));
+    TTable<char *,int32_t> __tab_rename_at_8_89; das_zero(__tab_rename_at_8_89); das_move(__tab_rename_at_8_89, _FuncbuiltinTickto_table_moveTick5858896087460481804_851cc220ee3e1eba(__context__,das_arg<TDim<TTuple<16,char *,int32_t>,2>>::pass((([&]() -> TDim<TTuple<16,char *,int32_t>,2>& {
+        _temp_make_local_8_15_2(0,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+            TTuple<16,char *,int32_t> __mkt_8;
+            das_get_tuple_field<char *,0>::get(__mkt_8) = ((char *) "one");
+            das_get_tuple_field<int32_t,8>::get(__mkt_8) = 1;
+            return __mkt_8;
+        })());
+        _temp_make_local_8_15_2(1,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+            TTuple<16,char *,int32_t> __mkt_8;
+            das_get_tuple_field<char *,0>::get(__mkt_8) = ((char *) "two");
+            das_get_tuple_field<int32_t,8>::get(__mkt_8) = 2;
+            return __mkt_8;
+        })());
+        return _temp_make_local_8_15_2;
+    })()))));
+    _FuncbuiltinTickgetTick8447005936052527643_6e6ef22c066af7b8(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_8_89),((char *) "one"),das_make_block<void,int32_t &>(__context__,176,0,&__func_info__576e3cb427cfad47,[&](int32_t & __num_rename_at_9_90) -> void{
+        das_copy(__num_rename_at_9_90,3);
+    }));
+    DAS_ASSERT((das_null_coalescing<int32_t>::get(TTable<char *,int32_t>::safe_index(&(__tab_rename_at_8_89),((char *) "one"),__context__),100500) == 3));
+    _FuncbuiltinTickgetTick8447005936052527643_6e6ef22c066af7b8(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_8_89),((char *) "one"),das_make_block<void,int32_t &>(__context__,176,0,&__func_info__576e3cb427cfad47,[&](int32_t & __num_rename_at_13_91) -> void{
+        DAS_ASSERT((__num_rename_at_13_91 == 3));
+        das_copy(__num_rename_at_13_91,4);
+    }));
+    DAS_ASSERT((das_null_coalescing<int32_t>::get(TTable<char *,int32_t>::safe_index(&(__tab_rename_at_8_89),((char *) "one"),__context__),100500) == 4));
+    _FuncbuiltinTickgetTick8447005936052527643_6e6ef22c066af7b8(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_8_89),((char *) "one"),das_make_block<void,int32_t &>(__context__,176,0,&__func_info__576e3cb427cfad47,[&](int32_t & __num_rename_at_18_92) -> void{
+        DAS_ASSERT((__num_rename_at_18_92 == 4));
+        das_copy(__num_rename_at_18_92,5);
+    }));
+    DAS_ASSERT((das_null_coalescing<int32_t>::get(TTable<char *,int32_t>::safe_index(&(__tab_rename_at_8_89),((char *) "one"),__context__),100500) == 5));
+    int32_t __dummy_rename_at_24_93 = 0;
+    das_copy(das_null_coalescing<int32_t &>::get(TTable<char *,int32_t>::safe_index(&(__tab_rename_at_8_89),((char *) "one"),__context__),__dummy_rename_at_24_93),1);
+    DAS_ASSERT((das_null_coalescing<int32_t>::get(TTable<char *,int32_t>::safe_index(&(__tab_rename_at_8_89),((char *) "one"),__context__),100500) == 1));
+    DAS_ASSERT((__dummy_rename_at_24_93 == 0));
+    return das_auto_cast<bool>::cast(true);
+}}
+
+inline bool test_d52304620726c89f ( Context * __context__ ) { das_stack_prologue __prologue(__context__,352,"test " DAS_FILE_LINE);
+{
+    Sequence DAS_COMMENT((char *)) _temp_make_local_114_17_3; _temp_make_local_114_17_3;
+    Sequence DAS_COMMENT((int32_t *)) _temp_make_local_114_28_4; _temp_make_local_114_28_4;
+    test_find_825a547b773baf64(__context__);
+    TTable<char *,int32_t> __tab_rename_at_36_94;das_zero(__tab_rename_at_36_94);
+    int32_t __i_rename_at_37_95 = 0; int32_t __del_rename_at_37_96 = 0;
+    DAS_VERIFY((!_FuncbuiltinTickeraseTick5639988512056021548_36c2058c3870e227(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36_94),((char *) "0"))));
+    das_copy(__i_rename_at_37_95,0);
+    while ( __i_rename_at_37_95 != 32 )
+    {
+        _FuncbuiltinTickinsertTick4246857231018487965_187667225c528ca6(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36_94),((char * const )(das_lexical_cast_int_i32(__i_rename_at_37_95,false,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))))),__i_rename_at_37_95);
+        ++__i_rename_at_37_95;
+    };
+    DAS_ASSERT((builtin_table_size(das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36_94)) == 32));
+    das_copy(__i_rename_at_37_95,0);
+    while ( __i_rename_at_37_95 != 32 )
+    {
+        DAS_VERIFY((_FuncbuiltinTickget_valueTick6803070933163225147_1fb948942e132956(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36_94),((char * const )(das_lexical_cast_int_i32(__i_rename_at_37_95,false,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))) == __i_rename_at_37_95));
+        ++__i_rename_at_37_95;
+    };
+    DAS_ASSERT((builtin_table_size(das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36_94)) == 32));
+    das_copy(__i_rename_at_37_95,0);
+    das_copy(__del_rename_at_37_96,0);
+    while ( __i_rename_at_37_95 < 32 )
+    {
+        DAS_VERIFY((_FuncbuiltinTickeraseTick5639988512056021548_36c2058c3870e227(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36_94),((char * const )(das_lexical_cast_int_i32(__i_rename_at_37_95,false,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))))))));
+        DAS_VERIFY((!_FuncbuiltinTickeraseTick5639988512056021548_36c2058c3870e227(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36_94),((char * const )(das_lexical_cast_int_i32(__i_rename_at_37_95,false,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))))))));
+        ++__del_rename_at_37_96;
+        __i_rename_at_37_95 += 7;
+    };
+    DAS_ASSERT((builtin_table_size(das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36_94)) == (32 - __del_rename_at_37_96)));
+    das_copy(__i_rename_at_37_95,0);
+    while ( __i_rename_at_37_95 < 32 )
+    {
+        bool __found_rename_at_67_97 = ((bool)_FuncbuiltinTickgetTick8447005936052527643_6e6ef22c066af7b8(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36_94),((char * const )(das_lexical_cast_int_i32(__i_rename_at_37_95,false,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))))),das_make_block<void,int32_t &>(__context__,176,0,&__func_info__fad5963896307a5e,[&](int32_t & __pValue_rename_at_67_98) -> void{
+            DAS_ASSERT((__pValue_rename_at_67_98 == __i_rename_at_37_95));
+        })));
+        DAS_ASSERT((!__found_rename_at_67_97 == ((SimPolicy<int32_t>::Mod(__i_rename_at_37_95,7,*__context__,nullptr)) == 0)));
+        ++__i_rename_at_37_95;
+    };
+    while ( __i_rename_at_37_95 < 32 )
+    {
+        int32_t * __pValue_rename_at_74_99 = ((int32_t *)TTable<char *,int32_t>::safe_index(&(__tab_rename_at_36_94),((char * const )(das_lexical_cast_int_i32(__i_rename_at_37_95,false,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))))),__context__));
+        if ( __pValue_rename_at_74_99 != nullptr )
+        {
+            DAS_ASSERT((das_deref(__context__,__pValue_rename_at_74_99,__FILE__,__LINE__) == __i_rename_at_37_95));
+        } else {
+            DAS_ASSERT(((SimPolicy<int32_t>::Mod(__i_rename_at_37_95,7,*__context__,nullptr)) == 0));
+        };
+        ++__i_rename_at_37_95;
+    };
+    int32_t __j_rename_at_83_100 = 0; int32_t __k_rename_at_83_101 = 0;
+    das_copy(__i_rename_at_37_95,0);
+    while ( __i_rename_at_37_95 < 32 )
+    {
+        _FuncbuiltinTickgetTick8447005936052527643_6e6ef22c066af7b8(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36_94),((char * const )(das_lexical_cast_int_i32(__i_rename_at_37_95,false,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))))),das_make_block<void,int32_t &>(__context__,192,0,&__func_info__4c623eeeb7eb7579,[&](int32_t & __pVal_rename_at_86_102) -> void{
+            __j_rename_at_83_100 += __pVal_rename_at_86_102;
+        }));
+        if ( (SimPolicy<int32_t>::Mod(__i_rename_at_37_95,7,*__context__,nullptr)) != 0 )
+        {
+            __k_rename_at_83_101 += __i_rename_at_37_95;
+        } else {
+            DAS_ASSERT(((SimPolicy<int32_t>::Mod(__i_rename_at_37_95,7,*__context__,nullptr)) == 0));
+        };
+        ++__i_rename_at_37_95;
+    };
+    DAS_ASSERT((__j_rename_at_83_100 == __k_rename_at_83_101));
+    das_copy(__i_rename_at_37_95,0);
+    while ( __i_rename_at_37_95 < 32 )
+    {
+        _FuncbuiltinTickinsertTick4246857231018487965_187667225c528ca6(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36_94),((char * const )(das_lexical_cast_int_i32(__i_rename_at_37_95,false,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))))),__i_rename_at_37_95);
+        __i_rename_at_37_95 += 7;
+    };
+    DAS_ASSERT((builtin_table_size(das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36_94)) == 32));
+    das_copy(__i_rename_at_37_95,0);
+    while ( __i_rename_at_37_95 != 32 )
+    {
+        DAS_VERIFY((_FuncbuiltinTickget_valueTick6803070933163225147_1fb948942e132956(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36_94),((char * const )(das_lexical_cast_int_i32(__i_rename_at_37_95,false,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))) == __i_rename_at_37_95));
+        ++__i_rename_at_37_95;
+    };
+    DAS_ASSERT((builtin_table_size(das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36_94)) == 32));
+    int32_t __cnt_rename_at_113_103 = 0;
+    {
+        bool __need_loop_114 = true;
+        // k: string
+        das_iterator<Sequence DAS_COMMENT((char *))> __k_iterator((_temp_make_local_114_17_3 = (_FuncbuiltinTickkeysTick17388619793938508994_e3f2e1930896ee39(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36_94)))));
+        char * __k_rename_at_114_106;
+        __need_loop_114 = __k_iterator.first(__context__,(__k_rename_at_114_106)) && __need_loop_114;
+        // v: int&
+        das_iterator<Sequence DAS_COMMENT((int32_t))> __v_iterator((_temp_make_local_114_28_4 = (_FuncbuiltinTickvaluesTick1351216622833168869_6b57e9137f2764bb(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36_94)))));
+        int32_t * __v_rename_at_114_107;
+        __need_loop_114 = __v_iterator.first(__context__,(__v_rename_at_114_107)) && __need_loop_114;
+        for ( ; __need_loop_114 ; __need_loop_114 = __k_iterator.next(__context__,(__k_rename_at_114_106)) && __v_iterator.next(__context__,(__v_rename_at_114_107)) )
+        {
+            DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__k_rename_at_114_106),cast<char *>::from(((char * const )(das_lexical_cast_int_i32((*__v_rename_at_114_107),false,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))),*__context__,nullptr)));
+            ++__cnt_rename_at_113_103;
+        }
+        __v_iterator.close(__context__,(__v_rename_at_114_107));
+        __k_iterator.close(__context__,(__k_rename_at_114_106));
+    };
+    DAS_ASSERT((__cnt_rename_at_113_103 == 32));
+    DAS_VERIFY((_FuncbuiltinTickeraseTick5639988512056021548_36c2058c3870e227(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36_94),((char *) "1"))));
+    DAS_VERIFY((!_FuncbuiltinTickeraseTick5639988512056021548_36c2058c3870e227(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36_94),((char *) "-1"))));
+    TTable<bool,int32_t> __tab_bool_rename_at_125_108;das_zero(__tab_bool_rename_at_125_108);
+    DAS_ASSERT((!_FuncbuiltinTickkey_existsTick16808803843923989214_7b10704e57c28a36(__context__,das_arg<TTable<bool,int32_t>>::pass(__tab_bool_rename_at_125_108),false)));
+    DAS_ASSERT((!_FuncbuiltinTickkey_existsTick16808803843923989214_7b10704e57c28a36(__context__,das_arg<TTable<bool,int32_t>>::pass(__tab_bool_rename_at_125_108),true)));
+    _FuncbuiltinTickinsertTick12964066441666329206_1d77a2f338972bad(__context__,das_arg<TTable<bool,int32_t>>::pass(__tab_bool_rename_at_125_108),true,0);
+    DAS_ASSERT((_FuncbuiltinTickkey_existsTick16808803843923989214_7b10704e57c28a36(__context__,das_arg<TTable<bool,int32_t>>::pass(__tab_bool_rename_at_125_108),true)));
+    _FuncbuiltinTickinsertTick12964066441666329206_1d77a2f338972bad(__context__,das_arg<TTable<bool,int32_t>>::pass(__tab_bool_rename_at_125_108),false,-1);
+    DAS_ASSERT((_FuncbuiltinTickkey_existsTick16808803843923989214_7b10704e57c28a36(__context__,das_arg<TTable<bool,int32_t>>::pass(__tab_bool_rename_at_125_108),false)));
+    TTable<range,void> __tab_rng_rename_at_133_109; das_zero(__tab_rng_rename_at_133_109); das_move(__tab_rng_rename_at_133_109, _FuncbuiltinTickto_table_moveTick5765297898159484544_6260ad27110f991b(__context__,range(0,5)));
+    DAS_ASSERT((_FuncbuiltinTickkey_existsTick16808803843923989214_2b81a30a1fa16757(__context__,das_arg<TTable<range,void>>::pass(__tab_rng_rename_at_133_109),range(0,5))));
+    TTable<int32_t,int32_t> __tab_int_rename_at_136_110;das_zero(__tab_int_rename_at_136_110);
+    DAS_ASSERT((!_FuncbuiltinTickkey_existsTick16808803843923989214_caeace491c7b2b48(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_int_rename_at_136_110),-1)));
+    _FuncbuiltinTickinsertTick12964066441666329206_8708a1b09bfda92d(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_int_rename_at_136_110),-1,-1);
+    DAS_ASSERT((_FuncbuiltinTickkey_existsTick16808803843923989214_caeace491c7b2b48(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_int_rename_at_136_110),-1)));
+    _FuncbuiltinTickeraseTick5639988512056021548_f34d0c388c7b1686(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_int_rename_at_136_110),-1);
+    DAS_ASSERT((!_FuncbuiltinTickkey_existsTick16808803843923989214_caeace491c7b2b48(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_int_rename_at_136_110),-1)));
+    TTable<char *,int32_t> __tab_string_rename_at_143_111;das_zero(__tab_string_rename_at_143_111);
+    DAS_ASSERT((!_FuncbuiltinTickkey_existsTick16808803843923989214_8d6aa4fe1fff2b7e(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_143_111),((char *) "---"))));
+    _FuncbuiltinTickinsertTick12964066441666329206_2882a6217bcc1a60(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_143_111),((char *) "---"),-1);
+    DAS_ASSERT((_FuncbuiltinTickkey_existsTick16808803843923989214_8d6aa4fe1fff2b7e(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_143_111),((char *) "---"))));
+    _FuncbuiltinTickeraseTick5639988512056021548_36c2058c3870e227(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_143_111),((char *) "---"));
+    DAS_ASSERT((!_FuncbuiltinTickkey_existsTick16808803843923989214_8d6aa4fe1fff2b7e(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_143_111),((char *) "---"))));
+    DAS_ASSERT((!_FuncbuiltinTickkey_existsTick16808803843923989214_8d6aa4fe1fff2b7e(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_143_111),((char *) " "))));
+    _FuncbuiltinTickinsertTick12964066441666329206_2882a6217bcc1a60(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_143_111),((char *) " "),-1);
+    DAS_ASSERT((_FuncbuiltinTickkey_existsTick16808803843923989214_8d6aa4fe1fff2b7e(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_143_111),((char *) " "))));
+    _FuncbuiltinTickeraseTick5639988512056021548_36c2058c3870e227(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_143_111),((char *) " "));
+    DAS_ASSERT((!_FuncbuiltinTickkey_existsTick16808803843923989214_8d6aa4fe1fff2b7e(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_143_111),((char *) " "))));
+    _FuncbuiltinTickinsertTick12964066441666329206_2882a6217bcc1a60(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_143_111),nullptr,-2);
+    DAS_ASSERT((_FuncbuiltinTickkey_existsTick16808803843923989214_8d6aa4fe1fff2b7e(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_143_111),nullptr)));
+    DAS_VERIFY((_FuncbuiltinTickget_valueTick6803070933163225147_1fb948942e132956(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_143_111),nullptr) == -2));
+    _FuncbuiltinTickeraseTick5639988512056021548_36c2058c3870e227(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_143_111),nullptr);
+    DAS_ASSERT((!_FuncbuiltinTickkey_existsTick16808803843923989214_8d6aa4fe1fff2b7e(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_143_111),nullptr)));
+    test_erase_collision_fe3179fbfa7989f1(__context__);
+    test_lock_panic_edf9391a0a6e0f2b(__context__);
+    test_insert_default_8774c68251d0303c(__context__);
+    test_get_with_default_22dd09a002096416(__context__);
+    return das_auto_cast<bool>::cast(true);
+}}
+
+inline bool test_lock_panic_edf9391a0a6e0f2b ( Context * __context__ ) { das_stack_prologue __prologue(__context__,160,"test_lock_panic " DAS_FILE_LINE);
+{
+    TDim<TTuple<16,char *,int32_t>,2> _temp_make_local_170_15_5; _temp_make_local_170_15_5;
+    TTable<char *,int32_t> __tab_rename_at_170_112; das_zero(__tab_rename_at_170_112); das_move(__tab_rename_at_170_112, _FuncbuiltinTickto_table_moveTick5858896087460481804_851cc220ee3e1eba(__context__,das_arg<TDim<TTuple<16,char *,int32_t>,2>>::pass((([&]() -> TDim<TTuple<16,char *,int32_t>,2>& {
+        _temp_make_local_170_15_5(0,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+            TTuple<16,char *,int32_t> __mkt_170;
+            das_get_tuple_field<char *,0>::get(__mkt_170) = ((char *) "one");
+            das_get_tuple_field<int32_t,8>::get(__mkt_170) = 1;
+            return __mkt_170;
+        })());
+        _temp_make_local_170_15_5(1,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+            TTuple<16,char *,int32_t> __mkt_170;
+            das_get_tuple_field<char *,0>::get(__mkt_170) = ((char *) "two");
+            das_get_tuple_field<int32_t,8>::get(__mkt_170) = 2;
+            return __mkt_170;
+        })());
+        return _temp_make_local_170_15_5;
+    })()))));
+    bool __failed_rename_at_171_113 = false;
+    das_try_recover(__context__, [&]()
+    {
+        _FuncbuiltinTickgetTick8447005936052527643_6e6ef22c066af7b8(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_170_112),((char *) "one"),das_make_block<void,int32_t &>(__context__,144,0,&__func_info__bf1bfac15d80e026,[&](int32_t & __t_rename_at_173_114) -> void{
+            _FuncbuiltinTickinsertTick12964066441666329206_2882a6217bcc1a60(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_170_112),((char *) "three"),3);
+        }));
+    }, [&]()
+    {
+        das_copy(__failed_rename_at_171_113,true);
+    });
+    DAS_ASSERT((__failed_rename_at_171_113));
+    DAS_ASSERT((!_FuncbuiltinTickkey_existsTick16808803843923989214_8d6aa4fe1fff2b7e(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_170_112),((char *) "three"))));
+    das_copy(__failed_rename_at_171_113,false);
+    das_try_recover(__context__, [&]()
+    {
+        _FuncbuiltinTickgetTick8447005936052527643_6e6ef22c066af7b8(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_170_112),((char *) "three"),das_make_block<void,int32_t &>(__context__,144,0,&__func_info__bf1bfac15d80e026,[&](int32_t & __t_rename_at_183_115) -> void{
+            _FuncbuiltinTickeraseTick5639988512056021548_36c2058c3870e227(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_170_112),((char *) "three"));
+        }));
+    }, [&]()
+    {
+        das_copy(__failed_rename_at_171_113,true);
+    });
+    DAS_ASSERT((!__failed_rename_at_171_113));
+    return das_auto_cast<bool>::cast(true);
+}}
+
+inline bool check_4cc7ac2c5e523aa7 ( Context * __context__, TableContainer &  __t_rename_at_205_116, TArray<int32_t> const  &  __deletedEntries_rename_at_205_117 )
+{
+    {
+        bool __need_loop_206 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,100));
+        int32_t __i_rename_at_206_118;
+        __need_loop_206 = __i_iterator.first(__context__,(__i_rename_at_206_118)) && __need_loop_206;
+        for ( ; __need_loop_206 ; __need_loop_206 = __i_iterator.next(__context__,(__i_rename_at_206_118)) )
+        {
+            bool __deleted_rename_at_207_119 = 0;
+            {
+                bool __need_loop_208 = true;
+                // x: int const&
+                das_iterator<TArray<int32_t> const > __x_iterator(__deletedEntries_rename_at_205_117);
+                int32_t const  * __x_rename_at_208_120;
+                __need_loop_208 = __x_iterator.first(__context__,(__x_rename_at_208_120)) && __need_loop_208;
+                for ( ; __need_loop_208 ; __need_loop_208 = __x_iterator.next(__context__,(__x_rename_at_208_120)) )
+                {
+                    if ( (*__x_rename_at_208_120) == __i_rename_at_206_118 )
+                    {
+                        das_copy(__deleted_rename_at_207_119,true);
+                        break;
+                    };
+                }
+                __x_iterator.close(__context__,(__x_rename_at_208_120));
+            };
+            if ( __deleted_rename_at_207_119 )
+            {
+                continue;
+            } else {
+                TestStruct _temp_make_local_218_19_6; _temp_make_local_218_19_6;
+                char * __n_rename_at_217_121 = ((char *)(char *)(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<char * const >::from(((char *) "name_")), cast<int32_t>::from(__i_rename_at_206_118)))));
+                if ( SimPolicy<char *>::NotEqu(cast<char *>::from((_temp_make_local_218_19_6 = (_FuncbuiltinTickget_valueTick6803070933163225147_6ad3f567ba2ea7fe(__context__,das_arg<TTable<char *,TestStruct>>::pass(__t_rename_at_205_116.t),__n_rename_at_217_121))).test),cast<char *>::from(__n_rename_at_217_121),*__context__,nullptr) )
+                {
+                    return das_auto_cast<bool>::cast(false);
+                };
+            };
+        }
+        __i_iterator.close(__context__,(__i_rename_at_206_118));
+    };
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline void test_erase_collision_fe3179fbfa7989f1 ( Context * __context__ )
+{
+    TableContainer __t_rename_at_227_122;das_zero(__t_rename_at_227_122);
+    TArray<char *> __names_rename_at_228_123;das_zero(__names_rename_at_228_123);
+    {
+        bool __need_loop_229 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,100));
+        int32_t __i_rename_at_229_124;
+        __need_loop_229 = __i_iterator.first(__context__,(__i_rename_at_229_124)) && __need_loop_229;
+        for ( ; __need_loop_229 ; __need_loop_229 = __i_iterator.next(__context__,(__i_rename_at_229_124)) )
+        {
+            _FuncbuiltinTickpushTick10769833213962245646_a54a33ebec8df23f(__context__,das_arg<TArray<char *>>::pass(__names_rename_at_228_123),das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<char * const >::from(((char *) "name_")), cast<int32_t>::from(__i_rename_at_229_124))));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_229_124));
+    };
+    {
+        bool __need_loop_232 = true;
+        // n: string&
+        das_iterator<TArray<char *>> __n_iterator(__names_rename_at_228_123);
+        char * * __n_rename_at_232_125;
+        __need_loop_232 = __n_iterator.first(__context__,(__n_rename_at_232_125)) && __need_loop_232;
+        for ( ; __need_loop_232 ; __need_loop_232 = __n_iterator.next(__context__,(__n_rename_at_232_125)) )
+        {
+            TestStruct _temp_make_local_233_26_7; _temp_make_local_233_26_7;
+            _FuncbuiltinTickemplaceTick10052523023165887793_ac53920b83b2d4e7(__context__,das_arg<TTable<char *,TestStruct>>::pass(__t_rename_at_227_122.t),(*__n_rename_at_232_125),das_arg<TestStruct>::pass((([&]() -> TestStruct& {
+                das_copy((_temp_make_local_233_26_7.test),((*__n_rename_at_232_125)));
+                return _temp_make_local_233_26_7;
+            })())));
+        }
+        __n_iterator.close(__context__,(__n_rename_at_232_125));
+    };
+    TArray<int32_t> __deletedEntries_rename_at_235_126;das_zero(__deletedEntries_rename_at_235_126);
+    DAS_VERIFY((check_4cc7ac2c5e523aa7(__context__,das_arg<TableContainer>::pass(__t_rename_at_227_122),das_arg<TArray<int32_t>>::pass(__deletedEntries_rename_at_235_126))));
+    {
+        bool __need_loop_237 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(1,100));
+        int32_t __i_rename_at_237_127;
+        __need_loop_237 = __i_iterator.first(__context__,(__i_rename_at_237_127)) && __need_loop_237;
+        for ( ; __need_loop_237 ; __need_loop_237 = __i_iterator.next(__context__,(__i_rename_at_237_127)) )
+        {
+            char * __x_rename_at_238_128 = ((char *)(char *)(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<char * const >::from(((char *) "name_")), cast<int32_t>::from(__i_rename_at_237_127)))));
+            _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(__deletedEntries_rename_at_235_126),__i_rename_at_237_127);
+            _FuncbuiltinTickeraseTick5639988512056021548_2767e79a7e9ede7(__context__,das_arg<TTable<char *,TestStruct>>::pass(__t_rename_at_227_122.t),__x_rename_at_238_128);
+            DAS_VERIFY((check_4cc7ac2c5e523aa7(__context__,das_arg<TableContainer>::pass(__t_rename_at_227_122),das_arg<TArray<int32_t>>::pass(__deletedEntries_rename_at_235_126))));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_237_127));
+    };
+}
+
+inline bool test_insert_default_8774c68251d0303c ( Context * __context__ ) { das_stack_prologue __prologue(__context__,224,"test_insert_default " DAS_FILE_LINE);
+{
+    TArray<int32_t> _temp_make_local_258_19_8; _temp_make_local_258_19_8;
+    TDim<int32_t,1> _temp_make_local_258_19_9; _temp_make_local_258_19_9;
+    TArray<int32_t> _temp_make_local_259_19_10; _temp_make_local_259_19_10;
+    TDim<int32_t,2> _temp_make_local_259_19_11; _temp_make_local_259_19_11;
+    TTable<char *,int32_t> __t_rename_at_247_129;das_zero(__t_rename_at_247_129);
+    _FuncbuiltinTickinsert_defaultTick7331679198661816033_97d138b5cffcc5c3(__context__,das_arg<TTable<char *,int32_t>>::pass(__t_rename_at_247_129),((char *) "one"),1);
+    DAS_ASSERT((das_null_coalescing<int32_t>::get(TTable<char *,int32_t>::safe_index(&(__t_rename_at_247_129),((char *) "one"),__context__),100500) == 1));
+    _FuncbuiltinTickinsert_defaultTick7331679198661816033_97d138b5cffcc5c3(__context__,das_arg<TTable<char *,int32_t>>::pass(__t_rename_at_247_129),((char *) "one"),2);
+    DAS_ASSERT((das_null_coalescing<int32_t>::get(TTable<char *,int32_t>::safe_index(&(__t_rename_at_247_129),((char *) "one"),__context__),100500) == 1));
+    DAS_ASSERT((!_FuncbuiltinTickkey_existsTick16808803843923989214_8d6aa4fe1fff2b7e(__context__,das_arg<TTable<char *,int32_t>>::pass(__t_rename_at_247_129),((char *) "zero"))));
+    _FuncbuiltinTickinsert_defaultTick17230753450391567662_8786afcc411080(__context__,das_arg<TTable<char *,int32_t>>::pass(__t_rename_at_247_129),((char *) "zero"));
+    DAS_ASSERT((das_null_coalescing<int32_t>::get(TTable<char *,int32_t>::safe_index(&(__t_rename_at_247_129),((char *) "zero"),__context__),100500) == 0));
+    TTable<int32_t,TArray<int32_t>> __map_rename_at_257_130;das_zero(__map_rename_at_257_130);
+    _FuncbuiltinTickemplaceTick10052523023165887793_b75fd3feb1e265c2(__context__,das_arg<TTable<int32_t,TArray<int32_t>>>::pass(__map_rename_at_257_130),1,das_arg<TArray<int32_t>>::pass((_temp_make_local_258_19_8 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25(__context__,das_arg<TDim<int32_t,1>>::pass((([&]() -> TDim<int32_t,1>& {
+        _temp_make_local_258_19_9(0,__context__) = 1;
+        return _temp_make_local_258_19_9;
+    })())))))));
+    _FuncbuiltinTickemplaceTick10052523023165887793_b75fd3feb1e265c2(__context__,das_arg<TTable<int32_t,TArray<int32_t>>>::pass(__map_rename_at_257_130),2,das_arg<TArray<int32_t>>::pass((_temp_make_local_259_19_10 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+        _temp_make_local_259_19_11(0,__context__) = 2;
+        _temp_make_local_259_19_11(1,__context__) = 2;
+        return _temp_make_local_259_19_11;
+    })())))))));
+    _FuncbuiltinTickemplace_defaultTick9884809586623040093_f1d353d036e2061f(__context__,das_arg<TTable<int32_t,TArray<int32_t>>>::pass(__map_rename_at_257_130),1);
+    _FuncbuiltinTickemplace_defaultTick9884809586623040093_f1d353d036e2061f(__context__,das_arg<TTable<int32_t,TArray<int32_t>>>::pass(__map_rename_at_257_130),2);
+    _FuncbuiltinTickemplace_defaultTick9884809586623040093_f1d353d036e2061f(__context__,das_arg<TTable<int32_t,TArray<int32_t>>>::pass(__map_rename_at_257_130),0);
+    _FuncbuiltinTickemplace_defaultTick9884809586623040093_f1d353d036e2061f(__context__,das_arg<TTable<int32_t,TArray<int32_t>>>::pass(__map_rename_at_257_130),3);
+    DAS_VERIFY((builtin_table_size(das_arg<TTable<int32_t,TArray<int32_t>>>::pass(__map_rename_at_257_130)) == 4));
+    {
+        bool __need_loop_265 = true;
+        // i: int const
+        das_iterator<range> __i_iterator(range(0,4));
+        int32_t __i_rename_at_265_131;
+        __need_loop_265 = __i_iterator.first(__context__,(__i_rename_at_265_131)) && __need_loop_265;
+        for ( ; __need_loop_265 ; __need_loop_265 = __i_iterator.next(__context__,(__i_rename_at_265_131)) )
+        {
+            bool __found_rename_at_266_132 = ((bool)_FuncbuiltinTickgetTick8447005936052527643_1302cd468b5f4a91(__context__,das_arg<TTable<int32_t,TArray<int32_t>>>::pass(__map_rename_at_257_130),__i_rename_at_265_131,das_make_block<void,TArray<int32_t> &>(__context__,208,0,&__func_info__c6d2220a06d5d8ed,[&](TArray<int32_t> & __val_rename_at_266_133) -> void{
+                if ( (__i_rename_at_265_131 == 0) || (__i_rename_at_265_131 == 3) )
+                {
+                    DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__val_rename_at_266_133)) == 0));
+                } else if ( __i_rename_at_265_131 == 1 )
+                {
+                    DAS_ASSERT(((builtin_array_size(das_arg<TArray<int32_t>>::pass(__val_rename_at_266_133)) == 1) && (__val_rename_at_266_133(0,__context__) == 1)));
+                } else if ( __i_rename_at_265_131 == 2 )
+                {
+                    DAS_ASSERT((((builtin_array_size(das_arg<TArray<int32_t>>::pass(__val_rename_at_266_133)) == 2) && (__val_rename_at_266_133(0,__context__) == 2)) && (__val_rename_at_266_133(1,__context__) == 2)));
+                };
+            })));
+            DAS_VERIFY((__found_rename_at_266_132));
+        }
+        __i_iterator.close(__context__,(__i_rename_at_265_131));
+    };
+    return das_auto_cast<bool>::cast(true);
+}}
+
+inline bool test_get_with_default_22dd09a002096416 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,144,"test_get_with_default " DAS_FILE_LINE);
+{
+    TDim<TTuple<16,int32_t,char *>,3> _temp_make_local_283_15_12; _temp_make_local_283_15_12;
+    TTable<int32_t,char *> __tab_rename_at_283_134; das_zero(__tab_rename_at_283_134); das_move(__tab_rename_at_283_134, _FuncbuiltinTickto_table_moveTick5858896087460481804_5eb44beeb4d0d356(__context__,das_arg<TDim<TTuple<16,int32_t,char *>,3>>::pass((([&]() -> TDim<TTuple<16,int32_t,char *>,3>& {
+        _temp_make_local_283_15_12(0,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+            TTuple<16,int32_t,char *> __mkt_283;
+            das_get_tuple_field<int32_t,0>::get(__mkt_283) = 1;
+            das_get_tuple_field<char *,8>::get(__mkt_283) = ((char *) "1");
+            return __mkt_283;
+        })());
+        _temp_make_local_283_15_12(1,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+            TTuple<16,int32_t,char *> __mkt_283;
+            das_get_tuple_field<int32_t,0>::get(__mkt_283) = 2;
+            das_get_tuple_field<char *,8>::get(__mkt_283) = ((char *) "2");
+            return __mkt_283;
+        })());
+        _temp_make_local_283_15_12(2,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+            TTuple<16,int32_t,char *> __mkt_283;
+            das_get_tuple_field<int32_t,0>::get(__mkt_283) = 3;
+            das_get_tuple_field<char *,8>::get(__mkt_283) = ((char *) "3");
+            return __mkt_283;
+        })());
+        return _temp_make_local_283_15_12;
+    })()))));
+    _FuncbuiltinTickget_with_defaultTick6209824659559181658_443604db1c66613(__context__,das_arg<TTable<int32_t,char *>>::pass(__tab_rename_at_283_134),2,das_make_block<void,char * &>(__context__,128,0,&__func_info__5f59ad38d8b49003,[&](char * & __val_rename_at_285_135) -> void{
+        DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(__val_rename_at_285_135),cast<char *>::from(((char *) "2")),*__context__,nullptr)));
+    }));
+    _FuncbuiltinTickget_with_defaultTick6209824659559181658_443604db1c66613(__context__,das_arg<TTable<int32_t,char *>>::pass(__tab_rename_at_283_134),1,das_make_block<void,char * &>(__context__,128,0,&__func_info__5f59ad38d8b49003,[&](char * & __val_rename_at_288_136) -> void{
+        DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(__val_rename_at_288_136),cast<char *>::from(((char *) "1")),*__context__,nullptr)));
+        SimPolicy<char *>::SetAdd((char *)&(__val_rename_at_288_136),cast<char *>::from(((char *) " modified")),*__context__,nullptr);
+    }));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_null_coalescing<char * const >::get(TTable<int32_t,char *>::safe_index(&(__tab_rename_at_283_134),1,__context__),nullptr)),cast<char *>::from(((char *) "1 modified")),*__context__,nullptr)));
+    _FuncbuiltinTickget_with_defaultTick6209824659559181658_443604db1c66613(__context__,das_arg<TTable<int32_t,char *>>::pass(__tab_rename_at_283_134),4,das_make_block<void,char * &>(__context__,128,0,&__func_info__5f59ad38d8b49003,[&](char * & __val_rename_at_295_137) -> void{
+        DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(__val_rename_at_295_137),cast<char *>::from(nullptr),*__context__,nullptr)));
+        SimPolicy<char *>::SetAdd((char *)&(__val_rename_at_295_137),cast<char *>::from(((char *) "four")),*__context__,nullptr);
+    }));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_null_coalescing<char * const >::get(TTable<int32_t,char *>::safe_index(&(__tab_rename_at_283_134),4,__context__),nullptr)),cast<char *>::from(((char *) "four")),*__context__,nullptr)));
+    _FuncbuiltinTickmodifyTick6564733278045083810_1a800d555c0e8fed(__context__,das_arg<TTable<int32_t,char *>>::pass(__tab_rename_at_283_134),2,das_make_block<char *,char * const  &>(__context__,128,0,&__func_info__a58c92ace20cedf7,[&](char * const  & __val_rename_at_301_138) -> char *{
+        return das_auto_cast<char *>::cast(cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(__val_rename_at_301_138),cast<char *>::from(((char *) " modified")),*__context__,nullptr)));
+    }));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_null_coalescing<char * const >::get(TTable<int32_t,char *>::safe_index(&(__tab_rename_at_283_134),2,__context__),nullptr)),cast<char *>::from(((char *) "2 modified")),*__context__,nullptr)));
+    _FuncbuiltinTickmodifyTick6564733278045083810_1a800d555c0e8fed(__context__,das_arg<TTable<int32_t,char *>>::pass(__tab_rename_at_283_134),4,das_make_block<char *,char * const  &>(__context__,128,0,&__func_info__96c0c74709b58fd8,[&](char * const  & __val_rename_at_304_139) -> char *{
+        return das_auto_cast<char *>::cast(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_3, cast<char * const >::from(((char *) "'")), cast<char * const >::from(__val_rename_at_304_139), cast<char * const >::from(((char *) "'")))));
+    }));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_null_coalescing<char * const >::get(TTable<int32_t,char *>::safe_index(&(__tab_rename_at_283_134),4,__context__),nullptr)),cast<char *>::from(((char *) "'four'")),*__context__,nullptr)));
+    _FuncbuiltinTickmodifyTick6564733278045083810_1a800d555c0e8fed(__context__,das_arg<TTable<int32_t,char *>>::pass(__tab_rename_at_283_134),5,das_make_block<char *,char * const  &>(__context__,128,0,&__func_info__96c0c74709b58fd8,[&](char * const  & __val_rename_at_308_140) -> char *{
+        return das_auto_cast<char *>::cast(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_4, cast<char * const >::from(__val_rename_at_308_140), cast<char * const >::from(((char *) "five")))));
+    }));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_null_coalescing<char * const >::get(TTable<int32_t,char *>::safe_index(&(__tab_rename_at_283_134),5,__context__),nullptr)),cast<char *>::from(((char *) "five")),*__context__,nullptr)));
+    return das_auto_cast<bool>::cast(true);
+}}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickgetTick13445059837844701140_1e08f5e9a07ea178 ( Context * __context__ ) {
+    TTable<char *,int32_t> const  &  arg_Tab = cast_aot_arg<TTable<char *,int32_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_at = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    Block DAS_COMMENT((void,int32_t const  &)) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((void,int32_t const  &)) const  & >::to(*__context__,__context__->abiArguments()[2]);
+    return cast<bool>::from(_FuncbuiltinTickgetTick13445059837844701140_1e08f5e9a07ea178(__context__, arg_Tab, arg_at, arg_blk));
+}
+static vec4f __wrap__FuncbuiltinTickkey_existsTick16808803843923989214_2b81a30a1fa16757 ( Context * __context__ ) {
+    TTable<range,void> const  &  arg_Tab = cast_aot_arg<TTable<range,void> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    range arg_at = cast_aot_arg<range>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_FuncbuiltinTickkey_existsTick16808803843923989214_2b81a30a1fa16757(__context__, arg_Tab, arg_at));
+}
+static vec4f __wrap__FuncbuiltinTickget_with_defaultTick6209824659559181658_443604db1c66613 ( Context * __context__ ) {
+    TTable<int32_t,char *> &  arg_Tab = cast_aot_arg<TTable<int32_t,char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_at = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    Block DAS_COMMENT((void,char * &)) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((void,char * &)) const  & >::to(*__context__,__context__->abiArguments()[2]);
+    _FuncbuiltinTickget_with_defaultTick6209824659559181658_443604db1c66613(__context__, arg_Tab, arg_at, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickmodifyTick6564733278045083810_1a800d555c0e8fed ( Context * __context__ ) {
+    TTable<int32_t,char *> &  arg_Tab = cast_aot_arg<TTable<int32_t,char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_at = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    Block DAS_COMMENT((char *,char * const  &)) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((char *,char * const  &)) const  & >::to(*__context__,__context__->abiArguments()[2]);
+    _FuncbuiltinTickmodifyTick6564733278045083810_1a800d555c0e8fed(__context__, arg_Tab, arg_at, arg_blk);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickkey_existsTick16808803843923989214_4caa670b00c7a51d ( Context * __context__ ) {
+    TTable<int32_t,TArray<int32_t>> const  &  arg_Tab = cast_aot_arg<TTable<int32_t,TArray<int32_t>> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_at = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_FuncbuiltinTickkey_existsTick16808803843923989214_4caa670b00c7a51d(__context__, arg_Tab, arg_at));
+}
+static vec4f __wrap__FuncbuiltinTickemplaceTick10052523023165887793_b75fd3feb1e265c2 ( Context * __context__ ) {
+    TTable<int32_t,TArray<int32_t>> &  arg_Tab = cast_aot_arg<TTable<int32_t,TArray<int32_t>> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_at = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    TArray<int32_t> &  arg_val = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[2]);
+    _FuncbuiltinTickemplaceTick10052523023165887793_b75fd3feb1e265c2(__context__, arg_Tab, arg_at, arg_val);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_table_moveTick5858896087460481804_851cc220ee3e1eba ( Context * __context__ ) {
+    TDim<TTuple<16,char *,int32_t>,2> &  arg_a = cast_aot_arg<TDim<TTuple<16,char *,int32_t>,2> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TTable<char *,int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_table_moveTick5858896087460481804_851cc220ee3e1eba(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_table_moveTick5765297898159484544_6260ad27110f991b ( Context * __context__ ) {
+    range arg_a = cast_aot_arg<range>::to(*__context__,__context__->abiArguments()[0]);
+    *((TTable<range,void> *) __context__->abiCMRES) = _FuncbuiltinTickto_table_moveTick5765297898159484544_6260ad27110f991b(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25 ( Context * __context__ ) {
+    TDim<int32_t,1> &  arg_a = cast_aot_arg<TDim<int32_t,1> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115 ( Context * __context__ ) {
+    TDim<int32_t,2> &  arg_a = cast_aot_arg<TDim<int32_t,2> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_table_moveTick5858896087460481804_5eb44beeb4d0d356 ( Context * __context__ ) {
+    TDim<TTuple<16,int32_t,char *>,3> &  arg_a = cast_aot_arg<TDim<TTuple<16,int32_t,char *>,3> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TTable<int32_t,char *> *) __context__->abiCMRES) = _FuncbuiltinTickto_table_moveTick5858896087460481804_5eb44beeb4d0d356(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeraseTick5639988512056021548_36c2058c3870e227 ( Context * __context__ ) {
+    TTable<char *,int32_t> &  arg_Tab = cast_aot_arg<TTable<char *,int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_at = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_FuncbuiltinTickeraseTick5639988512056021548_36c2058c3870e227(__context__, arg_Tab, arg_at));
+}
+static vec4f __wrap__FuncbuiltinTickinsertTick4246857231018487965_187667225c528ca6 ( Context * __context__ ) {
+    TTable<char *,int32_t> &  arg_Tab = cast_aot_arg<TTable<char *,int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_at = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_val = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    _FuncbuiltinTickinsertTick4246857231018487965_187667225c528ca6(__context__, arg_Tab, arg_at, arg_val);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickget_valueTick6803070933163225147_1fb948942e132956 ( Context * __context__ ) {
+    TTable<char *,int32_t> &  arg_Tab = cast_aot_arg<TTable<char *,int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_at = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<int32_t>::from(_FuncbuiltinTickget_valueTick6803070933163225147_1fb948942e132956(__context__, arg_Tab, arg_at));
+}
+static vec4f __wrap__FuncbuiltinTickgetTick8447005936052527643_6e6ef22c066af7b8 ( Context * __context__ ) {
+    TTable<char *,int32_t> &  arg_Tab = cast_aot_arg<TTable<char *,int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_at = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    Block DAS_COMMENT((void,int32_t &)) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((void,int32_t &)) const  & >::to(*__context__,__context__->abiArguments()[2]);
+    return cast<bool>::from(_FuncbuiltinTickgetTick8447005936052527643_6e6ef22c066af7b8(__context__, arg_Tab, arg_at, arg_blk));
+}
+static vec4f __wrap__FuncbuiltinTickkeysTick17388619793938508994_e3f2e1930896ee39 ( Context * __context__ ) {
+    TTable<char *,int32_t> &  arg_a = cast_aot_arg<TTable<char *,int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((char *)) *) __context__->abiCMRES) = _FuncbuiltinTickkeysTick17388619793938508994_e3f2e1930896ee39(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickvaluesTick1351216622833168869_6b57e9137f2764bb ( Context * __context__ ) {
+    TTable<char *,int32_t> &  arg_a = cast_aot_arg<TTable<char *,int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t &)) *) __context__->abiCMRES) = _FuncbuiltinTickvaluesTick1351216622833168869_6b57e9137f2764bb(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickkey_existsTick16808803843923989214_7b10704e57c28a36 ( Context * __context__ ) {
+    TTable<bool,int32_t> const  &  arg_Tab = cast_aot_arg<TTable<bool,int32_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    bool arg_at = cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_FuncbuiltinTickkey_existsTick16808803843923989214_7b10704e57c28a36(__context__, arg_Tab, arg_at));
+}
+static vec4f __wrap__FuncbuiltinTickinsertTick12964066441666329206_1d77a2f338972bad ( Context * __context__ ) {
+    TTable<bool,int32_t> &  arg_Tab = cast_aot_arg<TTable<bool,int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    bool arg_at = cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_val = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    _FuncbuiltinTickinsertTick12964066441666329206_1d77a2f338972bad(__context__, arg_Tab, arg_at, arg_val);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickkey_existsTick16808803843923989214_caeace491c7b2b48 ( Context * __context__ ) {
+    TTable<int32_t,int32_t> const  &  arg_Tab = cast_aot_arg<TTable<int32_t,int32_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_at = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_FuncbuiltinTickkey_existsTick16808803843923989214_caeace491c7b2b48(__context__, arg_Tab, arg_at));
+}
+static vec4f __wrap__FuncbuiltinTickinsertTick12964066441666329206_8708a1b09bfda92d ( Context * __context__ ) {
+    TTable<int32_t,int32_t> &  arg_Tab = cast_aot_arg<TTable<int32_t,int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_at = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_val = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    _FuncbuiltinTickinsertTick12964066441666329206_8708a1b09bfda92d(__context__, arg_Tab, arg_at, arg_val);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeraseTick5639988512056021548_f34d0c388c7b1686 ( Context * __context__ ) {
+    TTable<int32_t,int32_t> &  arg_Tab = cast_aot_arg<TTable<int32_t,int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_at = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_FuncbuiltinTickeraseTick5639988512056021548_f34d0c388c7b1686(__context__, arg_Tab, arg_at));
+}
+static vec4f __wrap__FuncbuiltinTickkey_existsTick16808803843923989214_8d6aa4fe1fff2b7e ( Context * __context__ ) {
+    TTable<char *,int32_t> const  &  arg_Tab = cast_aot_arg<TTable<char *,int32_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_at = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_FuncbuiltinTickkey_existsTick16808803843923989214_8d6aa4fe1fff2b7e(__context__, arg_Tab, arg_at));
+}
+static vec4f __wrap__FuncbuiltinTickinsertTick12964066441666329206_2882a6217bcc1a60 ( Context * __context__ ) {
+    TTable<char *,int32_t> &  arg_Tab = cast_aot_arg<TTable<char *,int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_at = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_val = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    _FuncbuiltinTickinsertTick12964066441666329206_2882a6217bcc1a60(__context__, arg_Tab, arg_at, arg_val);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickget_valueTick6803070933163225147_6ad3f567ba2ea7fe ( Context * __context__ ) {
+    TTable<char *,TestStruct> &  arg_Tab = cast_aot_arg<TTable<char *,TestStruct> & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_at = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    *((TestStruct *) __context__->abiCMRES) = _FuncbuiltinTickget_valueTick6803070933163225147_6ad3f567ba2ea7fe(__context__, arg_Tab, arg_at);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpushTick10769833213962245646_a54a33ebec8df23f ( Context * __context__ ) {
+    TArray<char *> &  arg_Arr = cast_aot_arg<TArray<char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    char * arg_value = cast_aot_arg<char *>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick10769833213962245646_a54a33ebec8df23f(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickemplaceTick10052523023165887793_ac53920b83b2d4e7 ( Context * __context__ ) {
+    TTable<char *,TestStruct> &  arg_Tab = cast_aot_arg<TTable<char *,TestStruct> & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_at = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    TestStruct &  arg_val = cast_aot_arg<TestStruct & >::to(*__context__,__context__->abiArguments()[2]);
+    _FuncbuiltinTickemplaceTick10052523023165887793_ac53920b83b2d4e7(__context__, arg_Tab, arg_at, arg_val);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_value = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeraseTick5639988512056021548_2767e79a7e9ede7 ( Context * __context__ ) {
+    TTable<char *,TestStruct> &  arg_Tab = cast_aot_arg<TTable<char *,TestStruct> & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_at = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_FuncbuiltinTickeraseTick5639988512056021548_2767e79a7e9ede7(__context__, arg_Tab, arg_at));
+}
+static vec4f __wrap__FuncbuiltinTickinsert_defaultTick7331679198661816033_97d138b5cffcc5c3 ( Context * __context__ ) {
+    TTable<char *,int32_t> &  arg_tab = cast_aot_arg<TTable<char *,int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_key = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_value = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    _FuncbuiltinTickinsert_defaultTick7331679198661816033_97d138b5cffcc5c3(__context__, arg_tab, arg_key, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickinsert_defaultTick17230753450391567662_8786afcc411080 ( Context * __context__ ) {
+    TTable<char *,int32_t> &  arg_tab = cast_aot_arg<TTable<char *,int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_key = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickinsert_defaultTick17230753450391567662_8786afcc411080(__context__, arg_tab, arg_key);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickemplace_defaultTick9884809586623040093_f1d353d036e2061f ( Context * __context__ ) {
+    TTable<int32_t,TArray<int32_t>> &  arg_tab = cast_aot_arg<TTable<int32_t,TArray<int32_t>> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_key = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickemplace_defaultTick9884809586623040093_f1d353d036e2061f(__context__, arg_tab, arg_key);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickgetTick8447005936052527643_1302cd468b5f4a91 ( Context * __context__ ) {
+    TTable<int32_t,TArray<int32_t>> &  arg_Tab = cast_aot_arg<TTable<int32_t,TArray<int32_t>> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_at = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    Block DAS_COMMENT((void,TArray<int32_t>)) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((void,TArray<int32_t>)) const  & >::to(*__context__,__context__->abiArguments()[2]);
+    return cast<bool>::from(_FuncbuiltinTickgetTick8447005936052527643_1302cd468b5f4a91(__context__, arg_Tab, arg_at, arg_blk));
+}
+static vec4f __wrap_test_find_825a547b773baf64 ( Context * __context__ ) {
+    return cast<bool>::from(test_find_825a547b773baf64(__context__));
+}
+static vec4f __wrap_test_d52304620726c89f ( Context * __context__ ) {
+    return cast<bool>::from(test_d52304620726c89f(__context__));
+}
+static vec4f __wrap_test_lock_panic_edf9391a0a6e0f2b ( Context * __context__ ) {
+    return cast<bool>::from(test_lock_panic_edf9391a0a6e0f2b(__context__));
+}
+static vec4f __wrap_check_4cc7ac2c5e523aa7 ( Context * __context__ ) {
+    TableContainer &  arg_t = cast_aot_arg<TableContainer & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> const  &  arg_deletedEntries = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(check_4cc7ac2c5e523aa7(__context__, arg_t, arg_deletedEntries));
+}
+static vec4f __wrap_test_erase_collision_fe3179fbfa7989f1 ( Context * __context__ ) {
+    test_erase_collision_fe3179fbfa7989f1(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_insert_default_8774c68251d0303c ( Context * __context__ ) {
+    return cast<bool>::from(test_insert_default_8774c68251d0303c(__context__));
+}
+static vec4f __wrap_test_get_with_default_22dd09a002096416 ( Context * __context__ ) {
+    return cast<bool>::from(test_get_with_default_22dd09a002096416(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xa51a880d594e91fd, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c },
+    { 0xc9eb375a4ea5a73c, false, (void*)&_FuncbuiltinTickgetTick13445059837844701140_1e08f5e9a07ea178, &__wrap__FuncbuiltinTickgetTick13445059837844701140_1e08f5e9a07ea178 },
+    { 0x5539aac273c6ec33, false, (void*)&_FuncbuiltinTickkey_existsTick16808803843923989214_2b81a30a1fa16757, &__wrap__FuncbuiltinTickkey_existsTick16808803843923989214_2b81a30a1fa16757 },
+    { 0xb0283ac1761d799a, false, (void*)&_FuncbuiltinTickget_with_defaultTick6209824659559181658_443604db1c66613, &__wrap__FuncbuiltinTickget_with_defaultTick6209824659559181658_443604db1c66613 },
+    { 0x1d363948612d997b, false, (void*)&_FuncbuiltinTickmodifyTick6564733278045083810_1a800d555c0e8fed, &__wrap__FuncbuiltinTickmodifyTick6564733278045083810_1a800d555c0e8fed },
+    { 0xf56f7632f2d8f4fa, false, (void*)&_FuncbuiltinTickkey_existsTick16808803843923989214_4caa670b00c7a51d, &__wrap__FuncbuiltinTickkey_existsTick16808803843923989214_4caa670b00c7a51d },
+    { 0xedd0185e5b8582e2, false, (void*)&_FuncbuiltinTickemplaceTick10052523023165887793_b75fd3feb1e265c2, &__wrap__FuncbuiltinTickemplaceTick10052523023165887793_b75fd3feb1e265c2 },
+    { 0xb14eb7f798510893, true, (void*)&_FuncbuiltinTickto_table_moveTick5858896087460481804_851cc220ee3e1eba, &__wrap__FuncbuiltinTickto_table_moveTick5858896087460481804_851cc220ee3e1eba },
+    { 0xb73815e049704af5, true, (void*)&_FuncbuiltinTickto_table_moveTick5765297898159484544_6260ad27110f991b, &__wrap__FuncbuiltinTickto_table_moveTick5765297898159484544_6260ad27110f991b },
+    { 0x53b0d27e2411836, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25 },
+    { 0x5c51cb37e0913516, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115 },
+    { 0x504e01bf8d698074, true, (void*)&_FuncbuiltinTickto_table_moveTick5858896087460481804_5eb44beeb4d0d356, &__wrap__FuncbuiltinTickto_table_moveTick5858896087460481804_5eb44beeb4d0d356 },
+    { 0x7c14af0ccd03ea0e, false, (void*)&_FuncbuiltinTickeraseTick5639988512056021548_36c2058c3870e227, &__wrap__FuncbuiltinTickeraseTick5639988512056021548_36c2058c3870e227 },
+    { 0x671984caf21d53a3, false, (void*)&_FuncbuiltinTickinsertTick4246857231018487965_187667225c528ca6, &__wrap__FuncbuiltinTickinsertTick4246857231018487965_187667225c528ca6 },
+    { 0xe57e9e246bc443e6, false, (void*)&_FuncbuiltinTickget_valueTick6803070933163225147_1fb948942e132956, &__wrap__FuncbuiltinTickget_valueTick6803070933163225147_1fb948942e132956 },
+    { 0x3862c095b683f431, false, (void*)&_FuncbuiltinTickgetTick8447005936052527643_6e6ef22c066af7b8, &__wrap__FuncbuiltinTickgetTick8447005936052527643_6e6ef22c066af7b8 },
+    { 0xc90643c9e2b09067, true, (void*)&_FuncbuiltinTickkeysTick17388619793938508994_e3f2e1930896ee39, &__wrap__FuncbuiltinTickkeysTick17388619793938508994_e3f2e1930896ee39 },
+    { 0x2fbd6cde94672700, true, (void*)&_FuncbuiltinTickvaluesTick1351216622833168869_6b57e9137f2764bb, &__wrap__FuncbuiltinTickvaluesTick1351216622833168869_6b57e9137f2764bb },
+    { 0x45173d342703cc1d, false, (void*)&_FuncbuiltinTickkey_existsTick16808803843923989214_7b10704e57c28a36, &__wrap__FuncbuiltinTickkey_existsTick16808803843923989214_7b10704e57c28a36 },
+    { 0xaa317a8706a3c758, false, (void*)&_FuncbuiltinTickinsertTick12964066441666329206_1d77a2f338972bad, &__wrap__FuncbuiltinTickinsertTick12964066441666329206_1d77a2f338972bad },
+    { 0x7a38b2d4ec4acbca, false, (void*)&_FuncbuiltinTickkey_existsTick16808803843923989214_caeace491c7b2b48, &__wrap__FuncbuiltinTickkey_existsTick16808803843923989214_caeace491c7b2b48 },
+    { 0x55a19774d7650c5, false, (void*)&_FuncbuiltinTickinsertTick12964066441666329206_8708a1b09bfda92d, &__wrap__FuncbuiltinTickinsertTick12964066441666329206_8708a1b09bfda92d },
+    { 0xc5c6f28c2c26d076, false, (void*)&_FuncbuiltinTickeraseTick5639988512056021548_f34d0c388c7b1686, &__wrap__FuncbuiltinTickeraseTick5639988512056021548_f34d0c388c7b1686 },
+    { 0x4341c462e0e8bbda, false, (void*)&_FuncbuiltinTickkey_existsTick16808803843923989214_8d6aa4fe1fff2b7e, &__wrap__FuncbuiltinTickkey_existsTick16808803843923989214_8d6aa4fe1fff2b7e },
+    { 0xfd925afa569cfe89, false, (void*)&_FuncbuiltinTickinsertTick12964066441666329206_2882a6217bcc1a60, &__wrap__FuncbuiltinTickinsertTick12964066441666329206_2882a6217bcc1a60 },
+    { 0xa0f73fc5d969ac25, true, (void*)&_FuncbuiltinTickget_valueTick6803070933163225147_6ad3f567ba2ea7fe, &__wrap__FuncbuiltinTickget_valueTick6803070933163225147_6ad3f567ba2ea7fe },
+    { 0x468a9f289eaed4d0, false, (void*)&_FuncbuiltinTickpushTick10769833213962245646_a54a33ebec8df23f, &__wrap__FuncbuiltinTickpushTick10769833213962245646_a54a33ebec8df23f },
+    { 0xb74accaf743edea5, false, (void*)&_FuncbuiltinTickemplaceTick10052523023165887793_ac53920b83b2d4e7, &__wrap__FuncbuiltinTickemplaceTick10052523023165887793_ac53920b83b2d4e7 },
+    { 0xbf77bb210b0552bc, false, (void*)&_FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39, &__wrap__FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 },
+    { 0x14d37d07ef9dfe79, false, (void*)&_FuncbuiltinTickeraseTick5639988512056021548_2767e79a7e9ede7, &__wrap__FuncbuiltinTickeraseTick5639988512056021548_2767e79a7e9ede7 },
+    { 0xb0ea8362a5766075, false, (void*)&_FuncbuiltinTickinsert_defaultTick7331679198661816033_97d138b5cffcc5c3, &__wrap__FuncbuiltinTickinsert_defaultTick7331679198661816033_97d138b5cffcc5c3 },
+    { 0x356ce6f2a61d59af, false, (void*)&_FuncbuiltinTickinsert_defaultTick17230753450391567662_8786afcc411080, &__wrap__FuncbuiltinTickinsert_defaultTick17230753450391567662_8786afcc411080 },
+    { 0xaec2f813a88e81b5, false, (void*)&_FuncbuiltinTickemplace_defaultTick9884809586623040093_f1d353d036e2061f, &__wrap__FuncbuiltinTickemplace_defaultTick9884809586623040093_f1d353d036e2061f },
+    { 0x44b1394837bd4e24, false, (void*)&_FuncbuiltinTickgetTick8447005936052527643_1302cd468b5f4a91, &__wrap__FuncbuiltinTickgetTick8447005936052527643_1302cd468b5f4a91 },
+    { 0xe5d360f002b143a5, false, (void*)&test_find_825a547b773baf64, &__wrap_test_find_825a547b773baf64 },
+    { 0xe1ec46c0cb90a401, false, (void*)&test_d52304620726c89f, &__wrap_test_d52304620726c89f },
+    { 0x555826e8d889e3eb, false, (void*)&test_lock_panic_edf9391a0a6e0f2b, &__wrap_test_lock_panic_edf9391a0a6e0f2b },
+    { 0x416638665aa2254c, false, (void*)&check_4cc7ac2c5e523aa7, &__wrap_check_4cc7ac2c5e523aa7 },
+    { 0x5f5d5d5ef94dd7ed, false, (void*)&test_erase_collision_fe3179fbfa7989f1, &__wrap_test_erase_collision_fe3179fbfa7989f1 },
+    { 0x87b9f6b6c857ee5c, false, (void*)&test_insert_default_8774c68251d0303c, &__wrap_test_insert_default_8774c68251d0303c },
+    { 0x8b3e49af322c6bea, false, (void*)&test_get_with_default_22dd09a002096416, &__wrap_test_get_with_default_22dd09a002096416 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_750805067777521187
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
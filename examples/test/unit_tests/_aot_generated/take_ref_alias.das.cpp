@@ -0,0 +1,160 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14795775976390363385 {
+
+// unused enumeration GooEnum
+// unused enumeration OpCode
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline float _FuncTicksquareTick18289915281348774211_5cc235d81eae21d ( Context * __context__, float __x_rename_at_5_0 );
+inline float3 find_best_squad_pos_53f538ae3db06c8f ( Context * __context__, float3 __wish_pos_rename_at_10_1, float3x4 const  & __leader_tm_rename_at_10_2, float3 __agent_pos_rename_at_10_3, float3 __offset_rename_at_11_4, int32_t __num_iter_rename_at_11_5, float __leader_min_dist_rename_at_11_6 );
+inline bool test_75d324cae7562790 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline float _FuncTicksquareTick18289915281348774211_5cc235d81eae21d ( Context * __context__, float __x_rename_at_5_0 )
+{
+    return das_auto_cast<float>::cast(__x_rename_at_5_0 * __x_rename_at_5_0);
+}
+
+inline float3 find_best_squad_pos_53f538ae3db06c8f ( Context * __context__, float3 __wish_pos_rename_at_10_1, float3x4 const  &  __leader_tm_rename_at_10_2, float3 __agent_pos_rename_at_10_3, float3 __offset_rename_at_11_4, int32_t __num_iter_rename_at_11_5, float __leader_min_dist_rename_at_11_6 )
+{
+    float3 __wishPosition_rename_at_12_7 = __wish_pos_rename_at_10_1;
+    {
+        bool __need_loop_13 = true;
+        // iter: int const
+        das_iterator<range> __iter_iterator(mk_range(__num_iter_rename_at_11_5));
+        int32_t __iter_rename_at_13_8;
+        __need_loop_13 = __iter_iterator.first(__context__,(__iter_rename_at_13_8)) && __need_loop_13;
+        for ( ; __need_loop_13 ; __need_loop_13 = __iter_iterator.next(__context__,(__iter_rename_at_13_8)) )
+        {
+            project_to_nearest_navmesh_point(das_alias<Point3>::to(__wishPosition_rename_at_12_7),5.000000e-01f);
+            if ( lengthSq3(SimPolicy<float3>::Sub(__wishPosition_rename_at_12_7,das_index<float3x4 const >::at(__leader_tm_rename_at_10_2,3,__context__),*__context__,nullptr)) < _FuncTicksquareTick18289915281348774211_5cc235d81eae21d(__context__,__leader_min_dist_rename_at_11_6) )
+            {
+                das_copy(__wishPosition_rename_at_12_7,float3x4_mul_vec3p(__leader_tm_rename_at_10_2,(SimPolicy<float3>::Mul(v_splats(SimPolicy<int32_t>::BinShl(1,(__iter_rename_at_13_8 + 1),*__context__,nullptr)),__offset_rename_at_11_4,*__context__,nullptr))));
+            } else {
+                break;
+            };
+        }
+        __iter_iterator.close(__context__,(__iter_rename_at_13_8));
+    };
+    project_to_nearest_navmesh_point(das_alias<Point3>::to(__wishPosition_rename_at_12_7),5.000000e-01f);
+    return das_auto_cast<float3>::cast(__wishPosition_rename_at_12_7);
+}
+
+inline bool test_75d324cae7562790 ( Context * __context__ )
+{
+    float3 __pos_rename_at_27_9 = v_make_vec4f(1.000000e+00f,2.000000e+00f,3.000000e+00f,0.f);
+    project_to_nearest_navmesh_point(das_alias<Point3>::to(__pos_rename_at_27_9),1.000000e+00f);
+    DAS_ASSERT((SimPolicy<float3>::Equ(__pos_rename_at_27_9,v_make_vec4f(2.000000e+00f,3.000000e+00f,4.000000e+00f,0.f),*__context__,nullptr)));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncTicksquareTick18289915281348774211_5cc235d81eae21d ( Context * __context__ ) {
+    float arg_x = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[0]);
+    return cast<float>::from(_FuncTicksquareTick18289915281348774211_5cc235d81eae21d(__context__, arg_x));
+}
+static vec4f __wrap_find_best_squad_pos_53f538ae3db06c8f ( Context * __context__ ) {
+    float3 arg_wish_pos = cast_aot_arg<float3>::to(*__context__,__context__->abiArguments()[0]);
+    float3x4 const  &  arg_leader_tm = cast_aot_arg<float3x4 const  & >::to(*__context__,__context__->abiArguments()[1]);
+    float3 arg_agent_pos = cast_aot_arg<float3>::to(*__context__,__context__->abiArguments()[2]);
+    float3 arg_offset = cast_aot_arg<float3>::to(*__context__,__context__->abiArguments()[3]);
+    int32_t arg_num_iter = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[4]);
+    float arg_leader_min_dist = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[5]);
+    return cast<float3>::from(find_best_squad_pos_53f538ae3db06c8f(__context__, arg_wish_pos, arg_leader_tm, arg_agent_pos, arg_offset, arg_num_iter, arg_leader_min_dist));
+}
+static vec4f __wrap_test_75d324cae7562790 ( Context * __context__ ) {
+    return cast<bool>::from(test_75d324cae7562790(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x3af18713554f07f2, false, (void*)&_FuncTicksquareTick18289915281348774211_5cc235d81eae21d, &__wrap__FuncTicksquareTick18289915281348774211_5cc235d81eae21d },
+    { 0xe349b1bf6f43195c, false, (void*)&find_best_squad_pos_53f538ae3db06c8f, &__wrap_find_best_squad_pos_53f538ae3db06c8f },
+    { 0x4018bf2eb885eaa5, false, (void*)&test_75d324cae7562790, &__wrap_test_75d324cae7562790 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_14795775976390363385
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
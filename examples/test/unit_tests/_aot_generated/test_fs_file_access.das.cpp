@@ -0,0 +1,146 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_11498072362944720809 {
+
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+extern TypeInfo __type_info__624d371c76b25aa4;
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__125855d9cd771ead;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __func_info__fe02a5da011a6cb4_field_0 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x865026081ff8017a), "ok", 0, 0 };
+VarInfo __func_info__fe02a5da011a6cb4_field_1 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__125855d9cd771ead, nullptr, nullptr, nullptr, 0, 0, nullptr, 11264, 8, UINT64_C(0x601b19a6ca455003), "program", 0, 0 };
+VarInfo __func_info__fe02a5da011a6cb4_field_2 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 32, UINT64_C(0xe632c403d42f243a), "issues", 0, 0 };
+VarInfo * __func_info__fe02a5da011a6cb4_fields[3] =  { &__func_info__fe02a5da011a6cb4_field_0, &__func_info__fe02a5da011a6cb4_field_1, &__func_info__fe02a5da011a6cb4_field_2 };
+FuncInfo __func_info__fe02a5da011a6cb4 = {"invoke block<(var ok:bool;var program:smart_ptr<rtti::Program>;issues:$::das_string const):void> const", "", __func_info__fe02a5da011a6cb4_fields, 3, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xfe02a5da011a6cb4), 0x0 };
+TypeInfo __type_info__624d371c76b25aa4 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 32, UINT64_C(0x624d371c76b25aa4) };
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__125855d9cd771ead = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~rtti::Program"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8194, 800, UINT64_C(0x125855d9cd771ead) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {__type_info__624d371c76b25aa4, __type_info__125855d9cd771ead, };
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_2[3] = { &__type_info__af90fe4c864e9d52, &__type_info__624d371c76b25aa4, &__type_info__af90fe4c864e9d52 };
+
+inline bool test_be3c0a239eb8f4c7 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_be3c0a239eb8f4c7 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,256,"test " DAS_FILE_LINE);
+{
+    char * __appfile_rename_at_6_0; memset((void*)&__appfile_rename_at_6_0,0,sizeof(__appfile_rename_at_6_0));
+    smart_ptr_raw<FileAccess> __access_rename_at_7_1; memset((void*)&__access_rename_at_7_1,0,sizeof(__access_rename_at_7_1));
+    /* finally */ auto __finally_5= das_finally([&](){
+    das_delete_handle<smart_ptr_raw<FileAccess>>::clear(__context__,__access_rename_at_7_1);
+    /* end finally */ });
+    __appfile_rename_at_6_0 = ((char *)(char *)(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<char * const >::from(((char * const )(builtin_das_root(__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))), cast<char * const >::from(((char *) "/examples/test/hidden_test/_hidden_test.das"))))));
+    __access_rename_at_7_1; das_zero(__access_rename_at_7_1); das_move(__access_rename_at_7_1, makeFileAccess(nullptr,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+    rtti_add_file_access_root(__access_rename_at_7_1,((char *) "hidden"),das_string_builder_temp(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<char * const >::from(((char * const )(builtin_das_root(__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))), cast<char * const >::from(((char *) "/examples/test/hidden_module")))));
+    das_using<ModuleGroup>::use([&](ModuleGroup & __mg_rename_at_9_2) DAS_AOT_INLINE_LAMBDA -> void{
+        das_using<CodeOfPolicies>::use([&](CodeOfPolicies & __cop_rename_at_10_3) DAS_AOT_INLINE_LAMBDA -> void{
+            rtti_builtin_compile_file(__appfile_rename_at_6_0,__access_rename_at_7_1,das_ref(__context__,__mg_rename_at_9_2),das_arg<CodeOfPolicies>::pass(__cop_rename_at_10_3),das_make_block<void,bool,smart_ptr_raw<Program>,das::string const  &>(__context__,240,0,&__func_info__fe02a5da011a6cb4,[&](bool __ok_rename_at_11_4, smart_ptr_raw<Program> __program_rename_at_11_5, das::string const  & __issues_rename_at_11_6) -> void{
+                if ( __ok_rename_at_11_4 )
+                {
+                    builtin_print(((char *) "ok"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+                } else {
+                    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<3>(__tinfo_2, cast<char * const >::from(((char *) "failed to compile\n")), cast<das::string const  &>::from(__issues_rename_at_11_6), cast<char * const >::from(((char *) "n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+                    DAS_ASSERT((false));
+                };
+            }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        });
+    });
+    return das_auto_cast<bool>::cast(true);
+}}
+static vec4f __wrap_test_be3c0a239eb8f4c7 ( Context * __context__ ) {
+    return cast<bool>::from(test_be3c0a239eb8f4c7(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x3e08caf6d20abcd0, false, (void*)&test_be3c0a239eb8f4c7, &__wrap_test_be3c0a239eb8f4c7 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_11498072362944720809
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
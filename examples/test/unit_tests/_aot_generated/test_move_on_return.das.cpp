@@ -0,0 +1,259 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_17976959917591139385 {
+
+namespace  { struct Pipeline; };
+namespace  {
+
+struct Pipeline {
+    int32_t a;
+};
+static_assert(sizeof(Pipeline)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Pipeline,a)==0,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__4db79a0b5ec891cf;
+extern TypeInfo __type_info__35fc8862693e7324;
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__c5eca92d423f3bc6;
+extern TypeInfo __type_info__2facf802ddb7c12c;
+
+VarInfo __struct_info__4db79a0b5ec891cf_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x892174dc26f30850), "a", 0, 0 };
+VarInfo * __struct_info__4db79a0b5ec891cf_fields[1] =  { &__struct_info__4db79a0b5ec891cf_field_0 };
+StructInfo __struct_info__4db79a0b5ec891cf = {"Pipeline", "", 0, __struct_info__4db79a0b5ec891cf_fields, 1, 4, UINT64_C(0x0), nullptr, UINT64_C(0x4db79a0b5ec891cf), 1 };
+TypeInfo __type_info__35fc8862693e7324 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c5eca92d423f3bc6, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x35fc8862693e7324) };
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__c5eca92d423f3bc6 = { Type::tStructure, &__struct_info__4db79a0b5ec891cf, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 4, UINT64_C(0xc5eca92d423f3bc6) };
+TypeInfo __type_info__2facf802ddb7c12c = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__35fc8862693e7324, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x2facf802ddb7c12c) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__2facf802ddb7c12c, &__type_info__af90fe4c864e9d52 };
+
+inline void finalize_b8d060da30d27f84 ( Context * __context__, Pipeline * & ____this_rename_at_1340_0 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_b63b2a77fc214a2a ( Context * __context__, TArray<Pipeline *> & __Arr_rename_at_68_1, int32_t __newSize_rename_at_68_2 );
+inline TArray<Pipeline *> & _FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_f0c2097a682bca5d ( Context * __context__, TArray<Pipeline *> & __a_rename_at_50_3 );
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_6730fcedbf20e58c ( Context * __context__, TArray<Pipeline *> & __a_rename_at_1336_4 );
+inline TArray<Pipeline *> _FuncbuiltinTickto_array_moveTick3185538323411982277_6024d42bf6a7ab04 ( Context * __context__, TDim<Pipeline *,2> & __a_rename_at_1502_6 );
+inline void finalize_c80ac98e70d235ed ( Context * __context__, Pipeline & __p_rename_at_6_8 );
+inline TArray<Pipeline *> create_graphics_pipelines_b7d7eee9abe9f76d ( Context * __context__ );
+inline Pipeline * fooBar_98df52251d581615 ( Context * __context__ );
+inline bool test_574f99b22859e20e ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void finalize_b8d060da30d27f84 ( Context * __context__, Pipeline * & ____this_rename_at_1340_0 )
+{
+    if ( ____this_rename_at_1340_0 != nullptr )
+    {
+        finalize_c80ac98e70d235ed(__context__,das_arg<Pipeline>::pass(das_deref(__context__,____this_rename_at_1340_0,__FILE__,__LINE__)));
+        das_delete<Pipeline *>::clear(__context__,____this_rename_at_1340_0);
+        das_copy(____this_rename_at_1340_0,nullptr);
+    };
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_b63b2a77fc214a2a ( Context * __context__, TArray<Pipeline *> &  __Arr_rename_at_68_1, int32_t __newSize_rename_at_68_2 )
+{
+    builtin_array_resize(das_arg<TArray<Pipeline *>>::pass(__Arr_rename_at_68_1),__newSize_rename_at_68_2,8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline TArray<Pipeline *> & _FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_f0c2097a682bca5d ( Context * __context__, TArray<Pipeline *> &  __a_rename_at_50_3 )
+{
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<TArray<Pipeline *> &>::from(__a_rename_at_50_3),cast<char * const >::from(((char *) "object can't be returned because it is locked"))));
+    return das_auto_cast_ref<TArray<Pipeline *> &>::cast(__a_rename_at_50_3);
+}
+
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_6730fcedbf20e58c ( Context * __context__, TArray<Pipeline *> &  __a_rename_at_1336_4 )
+{
+    {
+        bool __need_loop_1338 = true;
+        // aV: Pipeline? aka TT&
+        das_iterator<TArray<Pipeline *>> __aV_iterator(__a_rename_at_1336_4);
+        Pipeline * * __aV_rename_at_1338_5;
+        __need_loop_1338 = __aV_iterator.first(__context__,(__aV_rename_at_1338_5)) && __need_loop_1338;
+        for ( ; __need_loop_1338 ; __need_loop_1338 = __aV_iterator.next(__context__,(__aV_rename_at_1338_5)) )
+        {
+            finalize_b8d060da30d27f84(__context__,(*__aV_rename_at_1338_5));
+        }
+        __aV_iterator.close(__context__,(__aV_rename_at_1338_5));
+    };
+    builtin_array_free(das_arg<TArray<Pipeline *>>::pass(__a_rename_at_1336_4),8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline TArray<Pipeline *> _FuncbuiltinTickto_array_moveTick3185538323411982277_6024d42bf6a7ab04 ( Context * __context__, TDim<Pipeline *,2> &  __a_rename_at_1502_6 )
+{
+    TArray<Pipeline *> __arr_rename_at_1504_7;das_zero(__arr_rename_at_1504_7);
+    _FuncbuiltinTickresizeTick4811697762258667383_b63b2a77fc214a2a(__context__,das_arg<TArray<Pipeline *>>::pass(__arr_rename_at_1504_7),2);
+    das_copy(das_cast<TDim<Pipeline *,2>>::cast(das_ref(__context__,__arr_rename_at_1504_7(0,__context__))),__a_rename_at_1502_6);
+    return /* <- */ das_auto_cast_move<TArray<Pipeline *>>::cast(__arr_rename_at_1504_7);
+}
+
+inline void finalize_c80ac98e70d235ed ( Context * __context__, Pipeline &  __p_rename_at_6_8 )
+{
+    DAS_ASSERT((__p_rename_at_6_8.a == 2));
+    das_copy(__p_rename_at_6_8.a,0);
+}
+
+inline TArray<Pipeline *> create_graphics_pipelines_b7d7eee9abe9f76d ( Context * __context__ )
+{
+    TArray<Pipeline *> _temp_make_local_12_14_0; _temp_make_local_12_14_0;
+    TDim<Pipeline *,2> _temp_make_local_12_14_1; _temp_make_local_12_14_1;
+    return /* <- */ das_auto_cast_move<TArray<Pipeline *>>::cast(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_f0c2097a682bca5d(__context__,das_arg<TArray<Pipeline *>>::pass((_temp_make_local_12_14_0 = (_FuncbuiltinTickto_array_moveTick3185538323411982277_6024d42bf6a7ab04(__context__,das_arg<TDim<Pipeline *,2>>::pass((([&]() -> TDim<Pipeline *,2>& {
+        _temp_make_local_12_14_1(0,__context__) = das_ascend<Pipeline,Pipeline>::make(__context__,nullptr,(([&]() -> Pipeline {
+            Pipeline __mks_12;
+            das_copy((__mks_12.a),(1));
+            return __mks_12;
+        })()));
+        _temp_make_local_12_14_1(1,__context__) = das_ascend<Pipeline,Pipeline>::make(__context__,nullptr,(([&]() -> Pipeline {
+            Pipeline __mks_12;
+            das_copy((__mks_12.a),(2));
+            return __mks_12;
+        })()));
+        return _temp_make_local_12_14_1;
+    })()))))))));
+}
+
+inline Pipeline * fooBar_98df52251d581615 ( Context * __context__ )
+{
+    TArray<Pipeline *> __pipelines_rename_at_16_9; memset((void*)&__pipelines_rename_at_16_9,0,sizeof(__pipelines_rename_at_16_9));
+    /* finally */ auto __finally_15= das_finally([&](){
+    _FuncbuiltinTickfinalizeTick13836114024949725080_6730fcedbf20e58c(__context__,das_arg<TArray<Pipeline *>>::pass(__pipelines_rename_at_16_9));
+    /* end finally */ });
+    __pipelines_rename_at_16_9; das_zero(__pipelines_rename_at_16_9); das_move(__pipelines_rename_at_16_9, create_graphics_pipelines_b7d7eee9abe9f76d(__context__));
+    return /* <- */ das_auto_cast_move<Pipeline *>::cast(__pipelines_rename_at_16_9(0,__context__));
+}
+
+inline bool test_574f99b22859e20e ( Context * __context__ )
+{
+    Pipeline * __x_rename_at_26_10 = fooBar_98df52251d581615(__context__);
+    DAS_ASSERT((__x_rename_at_26_10->a == 1));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_finalize_b8d060da30d27f84 ( Context * __context__ ) {
+    Pipeline * & arg___this = cast_aot_arg<Pipeline * &>::to(*__context__,__context__->abiArguments()[0]);
+    finalize_b8d060da30d27f84(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_b63b2a77fc214a2a ( Context * __context__ ) {
+    TArray<Pipeline *> &  arg_Arr = cast_aot_arg<TArray<Pipeline *> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_b63b2a77fc214a2a(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_f0c2097a682bca5d ( Context * __context__ ) {
+    TArray<Pipeline *> &  arg_a = cast_aot_arg<TArray<Pipeline *> & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<TArray<Pipeline *> &>::from(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_f0c2097a682bca5d(__context__, arg_a));
+}
+static vec4f __wrap__FuncbuiltinTickfinalizeTick13836114024949725080_6730fcedbf20e58c ( Context * __context__ ) {
+    TArray<Pipeline *> &  arg_a = cast_aot_arg<TArray<Pipeline *> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickfinalizeTick13836114024949725080_6730fcedbf20e58c(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_6024d42bf6a7ab04 ( Context * __context__ ) {
+    TDim<Pipeline *,2> &  arg_a = cast_aot_arg<TDim<Pipeline *,2> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<Pipeline *> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_6024d42bf6a7ab04(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap_finalize_c80ac98e70d235ed ( Context * __context__ ) {
+    Pipeline &  arg_p = cast_aot_arg<Pipeline & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_c80ac98e70d235ed(__context__, arg_p);
+    return v_zero();
+}
+static vec4f __wrap_create_graphics_pipelines_b7d7eee9abe9f76d ( Context * __context__ ) {
+    *((TArray<Pipeline *> *) __context__->abiCMRES) = create_graphics_pipelines_b7d7eee9abe9f76d(__context__);
+    return v_zero();
+}
+static vec4f __wrap_fooBar_98df52251d581615 ( Context * __context__ ) {
+    return cast<Pipeline *>::from(fooBar_98df52251d581615(__context__));
+}
+static vec4f __wrap_test_574f99b22859e20e ( Context * __context__ ) {
+    return cast<bool>::from(test_574f99b22859e20e(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x88fe52bd0cb475a6, false, (void*)&finalize_b8d060da30d27f84, &__wrap_finalize_b8d060da30d27f84 },
+    { 0x772ebd465ef57263, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_b63b2a77fc214a2a, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_b63b2a77fc214a2a },
+    { 0x8eddf9d620cc981e, false, (void*)&_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_f0c2097a682bca5d, &__wrap__FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_f0c2097a682bca5d },
+    { 0xcbc1bd57707a24b7, false, (void*)&_FuncbuiltinTickfinalizeTick13836114024949725080_6730fcedbf20e58c, &__wrap__FuncbuiltinTickfinalizeTick13836114024949725080_6730fcedbf20e58c },
+    { 0x57030cb20e8a5846, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_6024d42bf6a7ab04, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_6024d42bf6a7ab04 },
+    { 0x36508ae20b1e446, false, (void*)&finalize_c80ac98e70d235ed, &__wrap_finalize_c80ac98e70d235ed },
+    { 0xa3af1196e1b8325a, true, (void*)&create_graphics_pipelines_b7d7eee9abe9f76d, &__wrap_create_graphics_pipelines_b7d7eee9abe9f76d },
+    { 0x7df4d0bae276686b, false, (void*)&fooBar_98df52251d581615, &__wrap_fooBar_98df52251d581615 },
+    { 0x6bbd7c43894f366b, false, (void*)&test_574f99b22859e20e, &__wrap_test_574f99b22859e20e },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_17976959917591139385
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,295 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_8843250157743283985 {
+
+// unused enumeration GooEnum
+// unused enumeration OpCode
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __func_info__5f59ad38d8b49003_field_0 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16645, 8, UINT64_C(0x81b1eeb109811f5b), "val", 0, 0 };
+VarInfo * __func_info__5f59ad38d8b49003_fields[1] =  { &__func_info__5f59ad38d8b49003_field_0 };
+FuncInfo __func_info__5f59ad38d8b49003 = {"invoke block<(var val:string&):void> const", "", __func_info__5f59ad38d8b49003_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x5f59ad38d8b49003), 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickinsertTick12964066441666329206_b4d81b6ae0b06e78 ( Context * __context__, TTable<EntityId,char *> & __Tab_rename_at_869_0, EntityId const  __at_rename_at_869_1, char * const  __val_rename_at_869_2 );
+inline bool _FuncbuiltinTickeraseTick5639988512056021548_e59ca9a43750a942 ( Context * __context__, TTable<EntityId,char *> & __Tab_rename_at_804_3, EntityId const  __at_rename_at_804_4 );
+inline bool _FuncbuiltinTickgetTick8447005936052527643_bd45c3f8f88e52c7 ( Context * __context__, TTable<EntityId,char *> & __Tab_rename_at_664_5, EntityId const  __at_rename_at_664_6, Block DAS_COMMENT((void,char * &)) const  & __blk_rename_at_664_7 );
+inline bool _FuncbuiltinTickkey_existsTick16808803843923989214_78879b9ccdbc3c5f ( Context * __context__, TTable<EntityId,char *> const  & __Tab_rename_at_1040_9, EntityId const  __at_rename_at_1040_10 );
+inline Sequence DAS_COMMENT((EntityId)) _FuncbuiltinTickkeysTick17388619793938508994_a4aed0d17bcc8ab2 ( Context * __context__, TTable<EntityId,char *> & __a_rename_at_1282_11 );
+inline Sequence DAS_COMMENT((char * &)) _FuncbuiltinTickvaluesTick1351216622833168869_95fbec040fae1268 ( Context * __context__, TTable<EntityId,char *> & __a_rename_at_1304_13 );
+inline void _FuncbuiltinTickinsertTick10959621454228962049_f2e34d309691f2a3 ( Context * __context__, TTable<EntityId,void> & __Tab_rename_at_811_15, EntityId const  __at_rename_at_811_16 );
+inline bool _FuncbuiltinTickkey_existsTick16808803843923989214_88e690bbf541606e ( Context * __context__, TTable<EntityId,void> const  & __Tab_rename_at_1040_17, EntityId const  __at_rename_at_1040_18 );
+inline bool test_788223b0eef05686 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickinsertTick12964066441666329206_b4d81b6ae0b06e78 ( Context * __context__, TTable<EntityId,char *> &  __Tab_rename_at_869_0, EntityId const  __at_rename_at_869_1, char * const  __val_rename_at_869_2 )
+{
+    das_copy(__Tab_rename_at_869_0(__at_rename_at_869_1,__context__),__val_rename_at_869_2);
+}
+
+inline bool _FuncbuiltinTickeraseTick5639988512056021548_e59ca9a43750a942 ( Context * __context__, TTable<EntityId,char *> &  __Tab_rename_at_804_3, EntityId const  __at_rename_at_804_4 )
+{
+    return das_auto_cast<bool>::cast(__builtin_table_erase(__context__,__Tab_rename_at_804_3,__at_rename_at_804_4));
+}
+
+inline bool _FuncbuiltinTickgetTick8447005936052527643_bd45c3f8f88e52c7 ( Context * __context__, TTable<EntityId,char *> &  __Tab_rename_at_664_5, EntityId const  __at_rename_at_664_6, Block DAS_COMMENT((void,char * &)) const  &  __blk_rename_at_664_7 )
+{
+    char * * __val_rename_at_665_8 = __builtin_table_find(__context__,__Tab_rename_at_664_5,__at_rename_at_664_6);
+    if ( __val_rename_at_665_8 != nullptr )
+    {
+        builtin_table_lock(das_arg<TTable<EntityId,char *>>::pass(__Tab_rename_at_664_5),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        das_invoke<void>::invoke<char * &>(__context__,nullptr,__blk_rename_at_664_7,das_deref(__context__,das_cast<char * *>::cast(__val_rename_at_665_8),__FILE__,__LINE__));
+        builtin_table_unlock(das_arg<TTable<EntityId,char *>>::pass(__Tab_rename_at_664_5),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+        return das_auto_cast<bool>::cast(true);
+    } else {
+        return das_auto_cast<bool>::cast(false);
+    };
+}
+
+inline bool _FuncbuiltinTickkey_existsTick16808803843923989214_78879b9ccdbc3c5f ( Context * __context__, TTable<EntityId,char *> const  &  __Tab_rename_at_1040_9, EntityId const  __at_rename_at_1040_10 )
+{
+    return das_auto_cast<bool>::cast(__builtin_table_key_exists(__context__,__Tab_rename_at_1040_9,__at_rename_at_1040_10));
+}
+
+inline Sequence DAS_COMMENT((EntityId)) _FuncbuiltinTickkeysTick17388619793938508994_a4aed0d17bcc8ab2 ( Context * __context__, TTable<EntityId,char *> &  __a_rename_at_1282_11 )
+{
+    Sequence DAS_COMMENT((EntityId)) __it_rename_at_1283_12;das_zero(__it_rename_at_1283_12);
+    builtin_table_keys(das_arg<Sequence DAS_COMMENT((EntityId))>::pass(__it_rename_at_1283_12),das_arg<TTable<EntityId,char *>>::pass(__a_rename_at_1282_11),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((EntityId))>::cast(__it_rename_at_1283_12);
+}
+
+inline Sequence DAS_COMMENT((char * &)) _FuncbuiltinTickvaluesTick1351216622833168869_95fbec040fae1268 ( Context * __context__, TTable<EntityId,char *> &  __a_rename_at_1304_13 )
+{
+    Sequence DAS_COMMENT((char * *)) __it_rename_at_1305_14;das_zero(__it_rename_at_1305_14);
+    builtin_table_values(das_arg<Sequence DAS_COMMENT((char *))>::pass(__it_rename_at_1305_14),das_arg<TTable<EntityId,char *>>::pass(__a_rename_at_1304_13),8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((char * &))>::cast(__it_rename_at_1305_14);
+}
+
+inline void _FuncbuiltinTickinsertTick10959621454228962049_f2e34d309691f2a3 ( Context * __context__, TTable<EntityId,void> &  __Tab_rename_at_811_15, EntityId const  __at_rename_at_811_16 )
+{
+    __builtin_table_set_insert(__context__,__Tab_rename_at_811_15,__at_rename_at_811_16);
+}
+
+inline bool _FuncbuiltinTickkey_existsTick16808803843923989214_88e690bbf541606e ( Context * __context__, TTable<EntityId,void> const  &  __Tab_rename_at_1040_17, EntityId const  __at_rename_at_1040_18 )
+{
+    return das_auto_cast<bool>::cast(__builtin_table_key_exists(__context__,__Tab_rename_at_1040_17,__at_rename_at_1040_18));
+}
+
+inline bool test_788223b0eef05686 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,224,"test " DAS_FILE_LINE);
+{
+    Sequence DAS_COMMENT((EntityId)) _temp_make_local_40_17_0; _temp_make_local_40_17_0;
+    Sequence DAS_COMMENT((char * *)) _temp_make_local_40_28_1; _temp_make_local_40_28_1;
+    TTable<EntityId,char *> __tab_rename_at_6_19;das_zero(__tab_rename_at_6_19);
+    _FuncbuiltinTickinsertTick12964066441666329206_b4d81b6ae0b06e78(__context__,das_arg<TTable<EntityId,char *>>::pass(__tab_rename_at_6_19),intToEid(1),((char *) "hello"));
+    _FuncbuiltinTickinsertTick12964066441666329206_b4d81b6ae0b06e78(__context__,das_arg<TTable<EntityId,char *>>::pass(__tab_rename_at_6_19),intToEid(2),((char *) "world"));
+    _FuncbuiltinTickinsertTick12964066441666329206_b4d81b6ae0b06e78(__context__,das_arg<TTable<EntityId,char *>>::pass(__tab_rename_at_6_19),intToEid(3),((char *) "!"));
+    DAS_ASSERT((builtin_table_size(das_arg<TTable<EntityId,char *>>::pass(__tab_rename_at_6_19)) == 3));
+    _FuncbuiltinTickeraseTick5639988512056021548_e59ca9a43750a942(__context__,das_arg<TTable<EntityId,char *>>::pass(__tab_rename_at_6_19),intToEid(3));
+    DAS_ASSERT((builtin_table_size(das_arg<TTable<EntityId,char *>>::pass(__tab_rename_at_6_19)) == 2));
+    bool __found_rename_at_14_20 = _FuncbuiltinTickgetTick8447005936052527643_bd45c3f8f88e52c7(__context__,das_arg<TTable<EntityId,char *>>::pass(__tab_rename_at_6_19),intToEid(2),das_make_block<void,char * &>(__context__,144,0,&__func_info__5f59ad38d8b49003,[&](char * & __val_rename_at_14_21) -> void{
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__val_rename_at_14_21),cast<char *>::from(((char *) "world")),*__context__,nullptr)));
+    }));
+    DAS_ASSERT((__found_rename_at_14_20));
+    das_copy(__found_rename_at_14_20,_FuncbuiltinTickgetTick8447005936052527643_bd45c3f8f88e52c7(__context__,das_arg<TTable<EntityId,char *>>::pass(__tab_rename_at_6_19),intToEid(1),das_make_block<void,char * &>(__context__,144,0,&__func_info__5f59ad38d8b49003,[&](char * & __val_rename_at_19_22) -> void{
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__val_rename_at_19_22),cast<char *>::from(((char *) "hello")),*__context__,nullptr)));
+    })));
+    DAS_ASSERT((__found_rename_at_14_20));
+    if ( _FuncbuiltinTickkey_existsTick16808803843923989214_78879b9ccdbc3c5f(__context__,das_arg<TTable<EntityId,char *>>::pass(__tab_rename_at_6_19),intToEid(1)) )
+    {
+    } else {
+        DAS_ASSERT((false));
+    };
+    if ( _FuncbuiltinTickkey_existsTick16808803843923989214_78879b9ccdbc3c5f(__context__,das_arg<TTable<EntityId,char *>>::pass(__tab_rename_at_6_19),intToEid(3)) )
+    {
+        DAS_ASSERT((false));
+    };
+    char * __t_rename_at_33_23 = ((char *)(char *)(das_null_coalescing<char * const >::get(TTable<EntityId,char *>::safe_index(&(__tab_rename_at_6_19),intToEid(1),__context__),((char *) "goodbye"))));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__t_rename_at_33_23),cast<char *>::from(((char *) "hello")),*__context__,nullptr)));
+    TTable<EntityId,char *> * __ptab_rename_at_35_24 = das_ref(__context__,__tab_rename_at_6_19);
+    char * __q_rename_at_36_25 = ((char *)(char *)(das_null_coalescing<char * const >::get(TTable<EntityId,char *>::safe_index((__ptab_rename_at_35_24),intToEid(2),__context__),((char *) "goodbye"))));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__q_rename_at_36_25),cast<char *>::from(((char *) "world")),*__context__,nullptr)));
+    int32_t __count_rename_at_39_26 = 0;
+    {
+        bool __need_loop_40 = true;
+        // k: UnitTest::EntityId
+        das_iterator<Sequence DAS_COMMENT((EntityId))> __k_iterator((_temp_make_local_40_17_0 = (_FuncbuiltinTickkeysTick17388619793938508994_a4aed0d17bcc8ab2(__context__,das_arg<TTable<EntityId,char *>>::pass(__tab_rename_at_6_19)))));
+        EntityId __k_rename_at_40_29;
+        __need_loop_40 = __k_iterator.first(__context__,(__k_rename_at_40_29)) && __need_loop_40;
+        // v: string&
+        das_iterator<Sequence DAS_COMMENT((char *))> __v_iterator((_temp_make_local_40_28_1 = (_FuncbuiltinTickvaluesTick1351216622833168869_95fbec040fae1268(__context__,das_arg<TTable<EntityId,char *>>::pass(__tab_rename_at_6_19)))));
+        char * * __v_rename_at_40_30;
+        __need_loop_40 = __v_iterator.first(__context__,(__v_rename_at_40_30)) && __need_loop_40;
+        for ( ; __need_loop_40 ; __need_loop_40 = __k_iterator.next(__context__,(__k_rename_at_40_29)) && __v_iterator.next(__context__,(__v_rename_at_40_30)) )
+        {
+            if ( eidToInt(__k_rename_at_40_29) == 1 )
+            {
+                DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from((*__v_rename_at_40_30)),cast<char *>::from(((char *) "hello")),*__context__,nullptr)));
+            };
+            if ( eidToInt(__k_rename_at_40_29) == 2 )
+            {
+                DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from((*__v_rename_at_40_30)),cast<char *>::from(((char *) "world")),*__context__,nullptr)));
+            };
+            ++__count_rename_at_39_26;
+        }
+        __v_iterator.close(__context__,(__v_rename_at_40_30));
+        __k_iterator.close(__context__,(__k_rename_at_40_29));
+    };
+    DAS_ASSERT((__count_rename_at_39_26 == 2));
+    TTable<EntityId,void> __set_rename_at_51_31;das_zero(__set_rename_at_51_31);
+    _FuncbuiltinTickinsertTick10959621454228962049_f2e34d309691f2a3(__context__,das_arg<TTable<EntityId,void>>::pass(__set_rename_at_51_31),intToEid(1));
+    _FuncbuiltinTickinsertTick10959621454228962049_f2e34d309691f2a3(__context__,das_arg<TTable<EntityId,void>>::pass(__set_rename_at_51_31),intToEid(2));
+    _FuncbuiltinTickinsertTick10959621454228962049_f2e34d309691f2a3(__context__,das_arg<TTable<EntityId,void>>::pass(__set_rename_at_51_31),intToEid(3));
+    DAS_ASSERT((builtin_table_size(das_arg<TTable<EntityId,void>>::pass(__set_rename_at_51_31)) == 3));
+    if ( _FuncbuiltinTickkey_existsTick16808803843923989214_88e690bbf541606e(__context__,das_arg<TTable<EntityId,void>>::pass(__set_rename_at_51_31),intToEid(4)) )
+    {
+        DAS_ASSERT((false));
+    };
+    return das_auto_cast<bool>::cast(true);
+}}
+static vec4f __wrap__FuncbuiltinTickinsertTick12964066441666329206_b4d81b6ae0b06e78 ( Context * __context__ ) {
+    TTable<EntityId,char *> &  arg_Tab = cast_aot_arg<TTable<EntityId,char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    EntityId const  arg_at = cast_aot_arg<EntityId const >::to(*__context__,__context__->abiArguments()[1]);
+    char * const  arg_val = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[2]);
+    _FuncbuiltinTickinsertTick12964066441666329206_b4d81b6ae0b06e78(__context__, arg_Tab, arg_at, arg_val);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeraseTick5639988512056021548_e59ca9a43750a942 ( Context * __context__ ) {
+    TTable<EntityId,char *> &  arg_Tab = cast_aot_arg<TTable<EntityId,char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    EntityId const  arg_at = cast_aot_arg<EntityId const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_FuncbuiltinTickeraseTick5639988512056021548_e59ca9a43750a942(__context__, arg_Tab, arg_at));
+}
+static vec4f __wrap__FuncbuiltinTickgetTick8447005936052527643_bd45c3f8f88e52c7 ( Context * __context__ ) {
+    TTable<EntityId,char *> &  arg_Tab = cast_aot_arg<TTable<EntityId,char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    EntityId const  arg_at = cast_aot_arg<EntityId const >::to(*__context__,__context__->abiArguments()[1]);
+    Block DAS_COMMENT((void,char * &)) const  &  arg_blk = cast_aot_arg<Block DAS_COMMENT((void,char * &)) const  & >::to(*__context__,__context__->abiArguments()[2]);
+    return cast<bool>::from(_FuncbuiltinTickgetTick8447005936052527643_bd45c3f8f88e52c7(__context__, arg_Tab, arg_at, arg_blk));
+}
+static vec4f __wrap__FuncbuiltinTickkey_existsTick16808803843923989214_78879b9ccdbc3c5f ( Context * __context__ ) {
+    TTable<EntityId,char *> const  &  arg_Tab = cast_aot_arg<TTable<EntityId,char *> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    EntityId const  arg_at = cast_aot_arg<EntityId const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_FuncbuiltinTickkey_existsTick16808803843923989214_78879b9ccdbc3c5f(__context__, arg_Tab, arg_at));
+}
+static vec4f __wrap__FuncbuiltinTickkeysTick17388619793938508994_a4aed0d17bcc8ab2 ( Context * __context__ ) {
+    TTable<EntityId,char *> &  arg_a = cast_aot_arg<TTable<EntityId,char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((EntityId)) *) __context__->abiCMRES) = _FuncbuiltinTickkeysTick17388619793938508994_a4aed0d17bcc8ab2(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickvaluesTick1351216622833168869_95fbec040fae1268 ( Context * __context__ ) {
+    TTable<EntityId,char *> &  arg_a = cast_aot_arg<TTable<EntityId,char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((char * &)) *) __context__->abiCMRES) = _FuncbuiltinTickvaluesTick1351216622833168869_95fbec040fae1268(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickinsertTick10959621454228962049_f2e34d309691f2a3 ( Context * __context__ ) {
+    TTable<EntityId,void> &  arg_Tab = cast_aot_arg<TTable<EntityId,void> & >::to(*__context__,__context__->abiArguments()[0]);
+    EntityId const  arg_at = cast_aot_arg<EntityId const >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickinsertTick10959621454228962049_f2e34d309691f2a3(__context__, arg_Tab, arg_at);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickkey_existsTick16808803843923989214_88e690bbf541606e ( Context * __context__ ) {
+    TTable<EntityId,void> const  &  arg_Tab = cast_aot_arg<TTable<EntityId,void> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    EntityId const  arg_at = cast_aot_arg<EntityId const >::to(*__context__,__context__->abiArguments()[1]);
+    return cast<bool>::from(_FuncbuiltinTickkey_existsTick16808803843923989214_88e690bbf541606e(__context__, arg_Tab, arg_at));
+}
+static vec4f __wrap_test_788223b0eef05686 ( Context * __context__ ) {
+    return cast<bool>::from(test_788223b0eef05686(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x31542a11b6669bcc, false, (void*)&_FuncbuiltinTickinsertTick12964066441666329206_b4d81b6ae0b06e78, &__wrap__FuncbuiltinTickinsertTick12964066441666329206_b4d81b6ae0b06e78 },
+    { 0xd5919a054abef416, false, (void*)&_FuncbuiltinTickeraseTick5639988512056021548_e59ca9a43750a942, &__wrap__FuncbuiltinTickeraseTick5639988512056021548_e59ca9a43750a942 },
+    { 0x9daeb568bb21dd1e, false, (void*)&_FuncbuiltinTickgetTick8447005936052527643_bd45c3f8f88e52c7, &__wrap__FuncbuiltinTickgetTick8447005936052527643_bd45c3f8f88e52c7 },
+    { 0x1056b58b9b84d8db, false, (void*)&_FuncbuiltinTickkey_existsTick16808803843923989214_78879b9ccdbc3c5f, &__wrap__FuncbuiltinTickkey_existsTick16808803843923989214_78879b9ccdbc3c5f },
+    { 0xd9fe9e605c8aa73e, true, (void*)&_FuncbuiltinTickkeysTick17388619793938508994_a4aed0d17bcc8ab2, &__wrap__FuncbuiltinTickkeysTick17388619793938508994_a4aed0d17bcc8ab2 },
+    { 0x156bdedeb97c42a4, true, (void*)&_FuncbuiltinTickvaluesTick1351216622833168869_95fbec040fae1268, &__wrap__FuncbuiltinTickvaluesTick1351216622833168869_95fbec040fae1268 },
+    { 0xc1988cddd67d0dda, false, (void*)&_FuncbuiltinTickinsertTick10959621454228962049_f2e34d309691f2a3, &__wrap__FuncbuiltinTickinsertTick10959621454228962049_f2e34d309691f2a3 },
+    { 0x85ed9d212d151f2c, false, (void*)&_FuncbuiltinTickkey_existsTick16808803843923989214_88e690bbf541606e, &__wrap__FuncbuiltinTickkey_existsTick16808803843923989214_88e690bbf541606e },
+    { 0x8146a849904cae66, false, (void*)&test_788223b0eef05686, &__wrap_test_788223b0eef05686 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_8843250157743283985
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
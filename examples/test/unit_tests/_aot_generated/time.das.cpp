@@ -0,0 +1,151 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_15918773214408889124 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline das::Time testClockArg_21380ed391f8ae4b ( Context * __context__, das::Time const  __c_rename_at_2_0 );
+inline bool test_32522d8a536c5c1b ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline das::Time testClockArg_21380ed391f8ae4b ( Context * __context__, das::Time const  __c_rename_at_2_0 )
+{
+    das::Time __d_rename_at_3_1 = ((das::Time)__c_rename_at_2_0);
+    return das_auto_cast<das::Time>::cast(__d_rename_at_3_1);
+}
+
+inline bool test_32522d8a536c5c1b ( Context * __context__ )
+{
+    das::Time __a1_rename_at_9_2;das_zero(__a1_rename_at_9_2); das::Time __a2_rename_at_9_3;das_zero(__a2_rename_at_9_3);
+    double __dt_rename_at_10_4 = 0;
+    das_copy(__a1_rename_at_9_2,/*c-tor*/ builtin_clock(/*end-c-tor*/));
+    {
+        bool __need_loop_12 = true;
+        // z: int const
+        das_iterator<range> __z_iterator(range(0,3));
+        int32_t __z_rename_at_12_5;
+        __need_loop_12 = __z_iterator.first(__context__,(__z_rename_at_12_5)) && __need_loop_12;
+        for ( ; __need_loop_12 ; __need_loop_12 = __z_iterator.next(__context__,(__z_rename_at_12_5)) )
+        {
+            TDim<int32_t,3> __a_rename_at_13_6;das_zero(__a_rename_at_13_6); TDim<int32_t,3> __b_rename_at_13_7;das_zero(__b_rename_at_13_7);
+            {
+                bool __need_loop_14 = true;
+                // x: int& -const
+                das_iterator<TDim<int32_t,3>> __x_iterator(__a_rename_at_13_6);
+                int32_t * __x_rename_at_14_10;
+                __need_loop_14 = __x_iterator.first(__context__,(__x_rename_at_14_10)) && __need_loop_14;
+                // y: int& -const
+                das_iterator<TDim<int32_t,3>> __y_iterator(__b_rename_at_13_7);
+                int32_t * __y_rename_at_14_11;
+                __need_loop_14 = __y_iterator.first(__context__,(__y_rename_at_14_11)) && __need_loop_14;
+                for ( ; __need_loop_14 ; __need_loop_14 = __x_iterator.next(__context__,(__x_rename_at_14_10)) && __y_iterator.next(__context__,(__y_rename_at_14_11)) )
+                {
+                    (*__x_rename_at_14_10) += (*__y_rename_at_14_11);
+                }
+                __y_iterator.close(__context__,(__y_rename_at_14_11));
+                __x_iterator.close(__context__,(__x_rename_at_14_10));
+            };
+        }
+        __z_iterator.close(__context__,(__z_rename_at_12_5));
+    };
+    das_copy(__a2_rename_at_9_3,/*c-tor*/ builtin_clock(/*end-c-tor*/));
+    DAS_ASSERT((time_ltequal(__a1_rename_at_9_2,__a2_rename_at_9_3)));
+    das::Time __a3_rename_at_20_12 = ((das::Time)testClockArg_21380ed391f8ae4b(__context__,__a2_rename_at_9_3));
+    DAS_ASSERT((time_equal(__a2_rename_at_9_3,__a3_rename_at_20_12)));
+    das_copy(__dt_rename_at_10_4,time_sub(__a2_rename_at_9_3,__a1_rename_at_9_2));
+    DAS_ASSERT((__dt_rename_at_10_4 <= 1.000000e+00));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_testClockArg_21380ed391f8ae4b ( Context * __context__ ) {
+    das::Time const  arg_c = cast_aot_arg<das::Time const >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<das::Time>::from(testClockArg_21380ed391f8ae4b(__context__, arg_c));
+}
+static vec4f __wrap_test_32522d8a536c5c1b ( Context * __context__ ) {
+    return cast<bool>::from(test_32522d8a536c5c1b(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x519a9de688a35830, false, (void*)&testClockArg_21380ed391f8ae4b, &__wrap_testClockArg_21380ed391f8ae4b },
+    { 0xfdcc308fafe20f61, false, (void*)&test_32522d8a536c5c1b, &__wrap_test_32522d8a536c5c1b },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_15918773214408889124
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
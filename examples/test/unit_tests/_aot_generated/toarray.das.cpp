@@ -0,0 +1,414 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_13998850794906917948 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickpush_cloneTick2035469273396957942_c2961e1e4b6c33a6 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_393_0, int32_t __value_rename_at_393_1 );
+inline void _FuncbuiltinTickpush_cloneTick15769051505004837089_fbc6eb3d74235894 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_377_2, int32_t __value_rename_at_377_3 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_68_4, int32_t __newSize_rename_at_68_5 );
+inline TArray<int32_t> _FuncbuiltinTickto_arrayTick9505582033551971916_e5f10801382c0f4 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __it_rename_at_1477_6 );
+inline TArray<int32_t> _FuncbuiltinTickto_arrayTick9505582033551971916_3e47e0efb400d30c ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) & __it_rename_at_1477_9 );
+inline Sequence DAS_COMMENT((int32_t &)) _FuncbuiltinTickeachTick6002865651812066953_693fb4484d509206 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_1427_12 );
+inline TArray<int32_t> _FuncbuiltinTickto_arrayTick15900163316339394530_7003211093dc6a1 ( Context * __context__, TDim<int32_t,4> const  & __a_rename_at_1492_14 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 ( Context * __context__, range __rng_rename_at_1398_16 );
+inline Sequence DAS_COMMENT((int32_t &)) _FuncbuiltinTickeachTick16936997283509359710_154ba5827554400a ( Context * __context__, TDim<int32_t,4> const  & __a_rename_at_1417_18 );
+inline bool test_6358f3fe0aa30016 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickpush_cloneTick2035469273396957942_c2961e1e4b6c33a6 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_393_0, int32_t __value_rename_at_393_1 )
+{
+    das_copy(__Arr_rename_at_393_0(builtin_array_push_back_zero(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_393_0),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_393_1);
+}
+
+inline void _FuncbuiltinTickpush_cloneTick15769051505004837089_fbc6eb3d74235894 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_377_2, int32_t __value_rename_at_377_3 )
+{
+    das_copy(__Arr_rename_at_377_2(builtin_array_push_back_zero(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_377_2),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_377_3);
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_68_4, int32_t __newSize_rename_at_68_5 )
+{
+    builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_68_4),__newSize_rename_at_68_5,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_arrayTick9505582033551971916_e5f10801382c0f4 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __it_rename_at_1477_6 )
+{
+    TArray<int32_t> __arr_rename_at_1478_7;das_zero(__arr_rename_at_1478_7);
+    {
+        bool __need_loop_1482 = true;
+        // x: int aka TT
+        das_iterator<Sequence DAS_COMMENT((int32_t))> __x_iterator(__it_rename_at_1477_6);
+        int32_t __x_rename_at_1482_8;
+        __need_loop_1482 = __x_iterator.first(__context__,(__x_rename_at_1482_8)) && __need_loop_1482;
+        for ( ; __need_loop_1482 ; __need_loop_1482 = __x_iterator.next(__context__,(__x_rename_at_1482_8)) )
+        {
+            _FuncbuiltinTickpush_cloneTick2035469273396957942_c2961e1e4b6c33a6(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1478_7),__x_rename_at_1482_8);
+        }
+        __x_iterator.close(__context__,(__x_rename_at_1482_8));
+    };
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1478_7);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_arrayTick9505582033551971916_3e47e0efb400d30c ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) &  __it_rename_at_1477_9 )
+{
+    TArray<int32_t> __arr_rename_at_1478_10;das_zero(__arr_rename_at_1478_10);
+    {
+        bool __need_loop_1482 = true;
+        // x: int aka TT const&
+        das_iterator<Sequence DAS_COMMENT((int32_t const ))> __x_iterator(__it_rename_at_1477_9);
+        int32_t const  * __x_rename_at_1482_11;
+        __need_loop_1482 = __x_iterator.first(__context__,(__x_rename_at_1482_11)) && __need_loop_1482;
+        for ( ; __need_loop_1482 ; __need_loop_1482 = __x_iterator.next(__context__,(__x_rename_at_1482_11)) )
+        {
+            _FuncbuiltinTickpush_cloneTick15769051505004837089_fbc6eb3d74235894(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1478_10),(*__x_rename_at_1482_11));
+        }
+        __x_iterator.close(__context__,(__x_rename_at_1482_11));
+    };
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1478_10);
+}
+
+inline Sequence DAS_COMMENT((int32_t &)) _FuncbuiltinTickeachTick6002865651812066953_693fb4484d509206 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_1427_12 )
+{
+    Sequence DAS_COMMENT((int32_t *)) __it_rename_at_1428_13;das_zero(__it_rename_at_1428_13);
+    builtin_make_good_array_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_1428_13),__a_rename_at_1427_12,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t &))>::cast(__it_rename_at_1428_13);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_arrayTick15900163316339394530_7003211093dc6a1 ( Context * __context__, TDim<int32_t,4> const  &  __a_rename_at_1492_14 )
+{
+    TArray<int32_t> __arr_rename_at_1493_15;das_zero(__arr_rename_at_1493_15);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1493_15),4);
+    das_copy(das_cast<TDim<int32_t,4>>::cast(das_ref(__context__,__arr_rename_at_1493_15(0,__context__))),__a_rename_at_1492_14);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1493_15);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 ( Context * __context__, range __rng_rename_at_1398_16 )
+{
+    Sequence DAS_COMMENT((int32_t)) __it_rename_at_1399_17;das_zero(__it_rename_at_1399_17);
+    builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_1399_17),__rng_rename_at_1398_16,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_1399_17);
+}
+
+inline Sequence DAS_COMMENT((int32_t &)) _FuncbuiltinTickeachTick16936997283509359710_154ba5827554400a ( Context * __context__, TDim<int32_t,4> const  &  __a_rename_at_1417_18 )
+{
+    void * __parr_rename_at_1419_19 = das_cast<void *>::cast(das_ref(__context__,__a_rename_at_1417_18(0,__context__)));
+    Sequence DAS_COMMENT((int32_t *)) __it_rename_at_1420_20;das_zero(__it_rename_at_1420_20);
+    builtin_make_fixed_array_iterator(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_1420_20),__parr_rename_at_1419_19,4,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t &))>::cast(__it_rename_at_1420_20);
+}
+
+inline bool test_6358f3fe0aa30016 ( Context * __context__ )
+{
+    TDim<int32_t,4> _temp_make_local_6_22_0; _temp_make_local_6_22_0;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_11_27_1; _temp_make_local_11_27_1;
+    TArray<int32_t> _temp_make_local_14_27_2; _temp_make_local_14_27_2;
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_14_36_3; _temp_make_local_14_36_3;
+    Sequence DAS_COMMENT((int32_t *)) _temp_make_local_19_24_4; _temp_make_local_19_24_4;
+    TArray<int32_t> _temp_make_local_23_20_5; _temp_make_local_23_20_5;
+    TArray<int32_t> _temp_make_local_27_24_6; _temp_make_local_27_24_6;
+    Sequence DAS_COMMENT((int32_t *)) _temp_make_local_27_33_7; _temp_make_local_27_33_7;
+    Sequence DAS_COMMENT((int32_t *)) _temp_make_local_33_24_8; _temp_make_local_33_24_8;
+    TArray<int32_t> _temp_make_local_38_24_9; _temp_make_local_38_24_9;
+    Sequence DAS_COMMENT((int32_t *)) _temp_make_local_38_33_10; _temp_make_local_38_33_10;
+    TDim<int32_t,4> __d_rename_at_5_21_ConstRef = ((TDim<int32_t,4>)(([&]() -> TDim<int32_t,4> {
+        TDim<int32_t,4> __mka_5;
+        __mka_5(0,__context__) = 1;
+        __mka_5(1,__context__) = 2;
+        __mka_5(2,__context__) = 3;
+        __mka_5(3,__context__) = 4;
+        return __mka_5;
+    })()));
+    TDim<int32_t,4> const  & __d_rename_at_5_21 = __d_rename_at_5_21_ConstRef;
+;
+    TArray<int32_t> __a_rename_at_6_22_ConstRef; das_zero(__a_rename_at_6_22_ConstRef); das_move(__a_rename_at_6_22_ConstRef, ((TArray<int32_t>)_FuncbuiltinTickto_arrayTick15900163316339394530_7003211093dc6a1(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+        _temp_make_local_6_22_0(0,__context__) = 1;
+        _temp_make_local_6_22_0(1,__context__) = 2;
+        _temp_make_local_6_22_0(2,__context__) = 3;
+        _temp_make_local_6_22_0(3,__context__) = 4;
+        return _temp_make_local_6_22_0;
+    })())))));
+    TArray<int32_t> const  & __a_rename_at_6_22 = __a_rename_at_6_22_ConstRef;
+;
+    {
+        bool __need_loop_7 = true;
+        // x: int const&
+        das_iterator<TDim<int32_t,4> const > __x_iterator(__d_rename_at_5_21);
+        int32_t const  * __x_rename_at_7_25;
+        __need_loop_7 = __x_iterator.first(__context__,(__x_rename_at_7_25)) && __need_loop_7;
+        // y: int const&
+        das_iterator<TArray<int32_t> const > __y_iterator(__a_rename_at_6_22);
+        int32_t const  * __y_rename_at_7_26;
+        __need_loop_7 = __y_iterator.first(__context__,(__y_rename_at_7_26)) && __need_loop_7;
+        for ( ; __need_loop_7 ; __need_loop_7 = __x_iterator.next(__context__,(__x_rename_at_7_25)) && __y_iterator.next(__context__,(__y_rename_at_7_26)) )
+        {
+            DAS_ASSERT(((*__x_rename_at_7_25) == (*__y_rename_at_7_26)));
+        }
+        __y_iterator.close(__context__,(__y_rename_at_7_26));
+        __x_iterator.close(__context__,(__x_rename_at_7_25));
+    };
+    {
+        bool __need_loop_11 = true;
+        // x: int const
+        das_iterator<range> __x_iterator(range(0,5));
+        int32_t __x_rename_at_11_29;
+        __need_loop_11 = __x_iterator.first(__context__,(__x_rename_at_11_29)) && __need_loop_11;
+        // y: int
+        das_iterator<Sequence DAS_COMMENT((int32_t))> __y_iterator((_temp_make_local_11_27_1 = (_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,5)))));
+        int32_t __y_rename_at_11_30;
+        __need_loop_11 = __y_iterator.first(__context__,(__y_rename_at_11_30)) && __need_loop_11;
+        for ( ; __need_loop_11 ; __need_loop_11 = __x_iterator.next(__context__,(__x_rename_at_11_29)) && __y_iterator.next(__context__,(__y_rename_at_11_30)) )
+        {
+            DAS_ASSERT((__x_rename_at_11_29 == __y_rename_at_11_30));
+        }
+        __y_iterator.close(__context__,(__y_rename_at_11_30));
+        __x_iterator.close(__context__,(__x_rename_at_11_29));
+    };
+    {
+        bool __need_loop_14 = true;
+        // x: int const
+        das_iterator<range> __x_iterator(range(0,5));
+        int32_t __x_rename_at_14_33;
+        __need_loop_14 = __x_iterator.first(__context__,(__x_rename_at_14_33)) && __need_loop_14;
+        // y: int&
+        das_iterator<TArray<int32_t>> __y_iterator((_temp_make_local_14_27_2 = (_FuncbuiltinTickto_arrayTick9505582033551971916_e5f10801382c0f4(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_14_36_3 = (_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__,range(0,5)))))))));
+        int32_t * __y_rename_at_14_34;
+        __need_loop_14 = __y_iterator.first(__context__,(__y_rename_at_14_34)) && __need_loop_14;
+        for ( ; __need_loop_14 ; __need_loop_14 = __x_iterator.next(__context__,(__x_rename_at_14_33)) && __y_iterator.next(__context__,(__y_rename_at_14_34)) )
+        {
+            DAS_ASSERT((__x_rename_at_14_33 == (*__y_rename_at_14_34)));
+        }
+        __y_iterator.close(__context__,(__y_rename_at_14_34));
+        __x_iterator.close(__context__,(__x_rename_at_14_33));
+    };
+    {
+        bool __need_loop_19 = true;
+        // x: int const&
+        das_iterator<TDim<int32_t,4> const > __x_iterator(__d_rename_at_5_21);
+        int32_t const  * __x_rename_at_19_37;
+        __need_loop_19 = __x_iterator.first(__context__,(__x_rename_at_19_37)) && __need_loop_19;
+        // y: int const&
+        das_iterator<Sequence DAS_COMMENT((int32_t const ))> __y_iterator((_temp_make_local_19_24_4 = (_FuncbuiltinTickeachTick16936997283509359710_154ba5827554400a(__context__,__d_rename_at_5_21))));
+        int32_t const  * __y_rename_at_19_38;
+        __need_loop_19 = __y_iterator.first(__context__,(__y_rename_at_19_38)) && __need_loop_19;
+        for ( ; __need_loop_19 ; __need_loop_19 = __x_iterator.next(__context__,(__x_rename_at_19_37)) && __y_iterator.next(__context__,(__y_rename_at_19_38)) )
+        {
+            DAS_ASSERT(((*__x_rename_at_19_37) == (*__y_rename_at_19_38)));
+        }
+        __y_iterator.close(__context__,(__y_rename_at_19_38));
+        __x_iterator.close(__context__,(__x_rename_at_19_37));
+    };
+    {
+        bool __need_loop_23 = true;
+        // x: int const&
+        das_iterator<TDim<int32_t,4> const > __x_iterator(__d_rename_at_5_21);
+        int32_t const  * __x_rename_at_23_41;
+        __need_loop_23 = __x_iterator.first(__context__,(__x_rename_at_23_41)) && __need_loop_23;
+        // y: int&
+        das_iterator<TArray<int32_t>> __y_iterator((_temp_make_local_23_20_5 = (_FuncbuiltinTickto_arrayTick15900163316339394530_7003211093dc6a1(__context__,__d_rename_at_5_21))));
+        int32_t * __y_rename_at_23_42;
+        __need_loop_23 = __y_iterator.first(__context__,(__y_rename_at_23_42)) && __need_loop_23;
+        for ( ; __need_loop_23 ; __need_loop_23 = __x_iterator.next(__context__,(__x_rename_at_23_41)) && __y_iterator.next(__context__,(__y_rename_at_23_42)) )
+        {
+            DAS_ASSERT(((*__x_rename_at_23_41) == (*__y_rename_at_23_42)));
+        }
+        __y_iterator.close(__context__,(__y_rename_at_23_42));
+        __x_iterator.close(__context__,(__x_rename_at_23_41));
+    };
+    {
+        bool __need_loop_27 = true;
+        // x: int const&
+        das_iterator<TDim<int32_t,4> const > __x_iterator(__d_rename_at_5_21);
+        int32_t const  * __x_rename_at_27_45;
+        __need_loop_27 = __x_iterator.first(__context__,(__x_rename_at_27_45)) && __need_loop_27;
+        // y: int&
+        das_iterator<TArray<int32_t>> __y_iterator((_temp_make_local_27_24_6 = (_FuncbuiltinTickto_arrayTick9505582033551971916_3e47e0efb400d30c(__context__,das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass((_temp_make_local_27_33_7 = (_FuncbuiltinTickeachTick16936997283509359710_154ba5827554400a(__context__,__d_rename_at_5_21))))))));
+        int32_t * __y_rename_at_27_46;
+        __need_loop_27 = __y_iterator.first(__context__,(__y_rename_at_27_46)) && __need_loop_27;
+        for ( ; __need_loop_27 ; __need_loop_27 = __x_iterator.next(__context__,(__x_rename_at_27_45)) && __y_iterator.next(__context__,(__y_rename_at_27_46)) )
+        {
+            DAS_ASSERT(((*__x_rename_at_27_45) == (*__y_rename_at_27_46)));
+        }
+        __y_iterator.close(__context__,(__y_rename_at_27_46));
+        __x_iterator.close(__context__,(__x_rename_at_27_45));
+    };
+    {
+        bool __need_loop_33 = true;
+        // x: int const&
+        das_iterator<TArray<int32_t> const > __x_iterator(__a_rename_at_6_22);
+        int32_t const  * __x_rename_at_33_49;
+        __need_loop_33 = __x_iterator.first(__context__,(__x_rename_at_33_49)) && __need_loop_33;
+        // y: int&
+        das_iterator<Sequence DAS_COMMENT((int32_t))> __y_iterator((_temp_make_local_33_24_8 = (_FuncbuiltinTickeachTick6002865651812066953_693fb4484d509206(__context__,__a_rename_at_6_22))));
+        int32_t * __y_rename_at_33_50;
+        __need_loop_33 = __y_iterator.first(__context__,(__y_rename_at_33_50)) && __need_loop_33;
+        for ( ; __need_loop_33 ; __need_loop_33 = __x_iterator.next(__context__,(__x_rename_at_33_49)) && __y_iterator.next(__context__,(__y_rename_at_33_50)) )
+        {
+            DAS_ASSERT(((*__x_rename_at_33_49) == (*__y_rename_at_33_50)));
+        }
+        __y_iterator.close(__context__,(__y_rename_at_33_50));
+        __x_iterator.close(__context__,(__x_rename_at_33_49));
+    };
+    {
+        bool __need_loop_38 = true;
+        // x: int const&
+        das_iterator<TArray<int32_t> const > __x_iterator(__a_rename_at_6_22);
+        int32_t const  * __x_rename_at_38_53;
+        __need_loop_38 = __x_iterator.first(__context__,(__x_rename_at_38_53)) && __need_loop_38;
+        // y: int&
+        das_iterator<TArray<int32_t>> __y_iterator((_temp_make_local_38_24_9 = (_FuncbuiltinTickto_arrayTick9505582033551971916_3e47e0efb400d30c(__context__,das_reinterpret<Sequence DAS_COMMENT((int32_t const ))>::pass(das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_38_33_10 = (_FuncbuiltinTickeachTick6002865651812066953_693fb4484d509206(__context__,__a_rename_at_6_22)))))))));
+        int32_t * __y_rename_at_38_54;
+        __need_loop_38 = __y_iterator.first(__context__,(__y_rename_at_38_54)) && __need_loop_38;
+        for ( ; __need_loop_38 ; __need_loop_38 = __x_iterator.next(__context__,(__x_rename_at_38_53)) && __y_iterator.next(__context__,(__y_rename_at_38_54)) )
+        {
+            DAS_ASSERT(((*__x_rename_at_38_53) == (*__y_rename_at_38_54)));
+        }
+        __y_iterator.close(__context__,(__y_rename_at_38_54));
+        __x_iterator.close(__context__,(__x_rename_at_38_53));
+    };
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncbuiltinTickpush_cloneTick2035469273396957942_c2961e1e4b6c33a6 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_value = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpush_cloneTick2035469273396957942_c2961e1e4b6c33a6(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpush_cloneTick15769051505004837089_fbc6eb3d74235894 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_value = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpush_cloneTick15769051505004837089_fbc6eb3d74235894(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_arrayTick9505582033551971916_e5f10801382c0f4 ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t)) &  arg_it = cast_aot_arg<Sequence DAS_COMMENT((int32_t)) & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_arrayTick9505582033551971916_e5f10801382c0f4(__context__, arg_it);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_arrayTick9505582033551971916_3e47e0efb400d30c ( Context * __context__ ) {
+    Sequence DAS_COMMENT((int32_t const  &)) &  arg_it = cast_aot_arg<Sequence DAS_COMMENT((int32_t const  &)) & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_arrayTick9505582033551971916_3e47e0efb400d30c(__context__, arg_it);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeachTick6002865651812066953_693fb4484d509206 ( Context * __context__ ) {
+    TArray<int32_t> const  &  arg_a = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t &)) *) __context__->abiCMRES) = _FuncbuiltinTickeachTick6002865651812066953_693fb4484d509206(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_arrayTick15900163316339394530_7003211093dc6a1 ( Context * __context__ ) {
+    TDim<int32_t,4> const  &  arg_a = cast_aot_arg<TDim<int32_t,4> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_arrayTick15900163316339394530_7003211093dc6a1(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 ( Context * __context__ ) {
+    range arg_rng = cast_aot_arg<range>::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015(__context__, arg_rng);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickeachTick16936997283509359710_154ba5827554400a ( Context * __context__ ) {
+    TDim<int32_t,4> const  &  arg_a = cast_aot_arg<TDim<int32_t,4> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t &)) *) __context__->abiCMRES) = _FuncbuiltinTickeachTick16936997283509359710_154ba5827554400a(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap_test_6358f3fe0aa30016 ( Context * __context__ ) {
+    return cast<bool>::from(test_6358f3fe0aa30016(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x12c9d5f33cefbaca, false, (void*)&_FuncbuiltinTickpush_cloneTick2035469273396957942_c2961e1e4b6c33a6, &__wrap__FuncbuiltinTickpush_cloneTick2035469273396957942_c2961e1e4b6c33a6 },
+    { 0x6b29c34f9fce6571, false, (void*)&_FuncbuiltinTickpush_cloneTick15769051505004837089_fbc6eb3d74235894, &__wrap__FuncbuiltinTickpush_cloneTick15769051505004837089_fbc6eb3d74235894 },
+    { 0xa51a880d594e91fd, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c },
+    { 0x7c6b325463a8e099, true, (void*)&_FuncbuiltinTickto_arrayTick9505582033551971916_e5f10801382c0f4, &__wrap__FuncbuiltinTickto_arrayTick9505582033551971916_e5f10801382c0f4 },
+    { 0x7626586bad2ebbe2, true, (void*)&_FuncbuiltinTickto_arrayTick9505582033551971916_3e47e0efb400d30c, &__wrap__FuncbuiltinTickto_arrayTick9505582033551971916_3e47e0efb400d30c },
+    { 0xf0218ad1850a26cf, true, (void*)&_FuncbuiltinTickeachTick6002865651812066953_693fb4484d509206, &__wrap__FuncbuiltinTickeachTick6002865651812066953_693fb4484d509206 },
+    { 0x7ba7f0522bde668b, true, (void*)&_FuncbuiltinTickto_arrayTick15900163316339394530_7003211093dc6a1, &__wrap__FuncbuiltinTickto_arrayTick15900163316339394530_7003211093dc6a1 },
+    { 0xf426d9532c77b0a4, true, (void*)&_FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015, &__wrap__FuncbuiltinTickeachTick4044333107478717573_6f02beb659b38015 },
+    { 0xaf5edfc6cfa970cc, true, (void*)&_FuncbuiltinTickeachTick16936997283509359710_154ba5827554400a, &__wrap__FuncbuiltinTickeachTick16936997283509359710_154ba5827554400a },
+    { 0x6ebf3337221703b7, false, (void*)&test_6358f3fe0aa30016, &__wrap_test_6358f3fe0aa30016 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_13998850794906917948
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,196 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_16840777879575480876 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline char * _FuncbuiltinTickget_valueTick6803070933163225147_8f406ded258e5ea4 ( Context * __context__, TTable<int32_t,char *> & __Tab_rename_at_755_0, int32_t __at_rename_at_755_1 );
+inline TTable<int32_t,char *> _FuncbuiltinTickto_tableTick6550960242117856823_29fe2e0318b5f240 ( Context * __context__, TDim<TTuple<16,int32_t,char *>,3> const  & __a_rename_at_1559_2 );
+inline bool test_9c3e6a14a4ffab9e ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline char * _FuncbuiltinTickget_valueTick6803070933163225147_8f406ded258e5ea4 ( Context * __context__, TTable<int32_t,char *> &  __Tab_rename_at_755_0, int32_t __at_rename_at_755_1 )
+{
+    return das_auto_cast<char *>::cast(__Tab_rename_at_755_0(__at_rename_at_755_1,__context__));
+}
+
+inline TTable<int32_t,char *> _FuncbuiltinTickto_tableTick6550960242117856823_29fe2e0318b5f240 ( Context * __context__, TDim<TTuple<16,int32_t,char *>,3> const  &  __a_rename_at_1559_2 )
+{
+    TTable<int32_t,char *> __tab_rename_at_1560_3;das_zero(__tab_rename_at_1560_3);
+    {
+        bool __need_loop_1561 = true;
+        // x: tuple<int aka keyT;string aka valT> const&
+        das_iterator<TDim<TTuple<16,int32_t,char *>,3> const > __x_iterator(__a_rename_at_1559_2);
+        TTuple<16,int32_t,char *> const  * __x_rename_at_1561_4;
+        __need_loop_1561 = __x_iterator.first(__context__,(__x_rename_at_1561_4)) && __need_loop_1561;
+        for ( ; __need_loop_1561 ; __need_loop_1561 = __x_iterator.next(__context__,(__x_rename_at_1561_4)) )
+        {
+            das_copy(__tab_rename_at_1560_3(das_get_tuple_field<int32_t,0>::get((*__x_rename_at_1561_4)),__context__),das_get_tuple_field<char *,8>::get((*__x_rename_at_1561_4)));
+        }
+        __x_iterator.close(__context__,(__x_rename_at_1561_4));
+    };
+    return /* <- */ das_auto_cast_move<TTable<int32_t,char *>>::cast(__tab_rename_at_1560_3);
+}
+
+inline bool test_9c3e6a14a4ffab9e ( Context * __context__ )
+{
+    TDim<TTuple<16,int32_t,char *>,3> _temp_make_local_5_22_0; _temp_make_local_5_22_0;
+    TDim<TTuple<16,int32_t,char *>,3> __a_rename_at_4_5_ConstRef = ((TDim<TTuple<16,int32_t,char *>,3>)(([&]() -> TDim<TTuple<16,int32_t,char *>,3> {
+        TDim<TTuple<16,int32_t,char *>,3> __mka_4;
+        __mka_4(0,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+            TTuple<16,int32_t,char *> __mkt_4;
+            das_get_tuple_field<int32_t,0>::get(__mkt_4) = 1;
+            das_get_tuple_field<char *,8>::get(__mkt_4) = ((char *) "one");
+            return __mkt_4;
+        })());
+        __mka_4(1,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+            TTuple<16,int32_t,char *> __mkt_4;
+            das_get_tuple_field<int32_t,0>::get(__mkt_4) = 2;
+            das_get_tuple_field<char *,8>::get(__mkt_4) = ((char *) "two");
+            return __mkt_4;
+        })());
+        __mka_4(2,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+            TTuple<16,int32_t,char *> __mkt_4;
+            das_get_tuple_field<int32_t,0>::get(__mkt_4) = 3;
+            das_get_tuple_field<char *,8>::get(__mkt_4) = ((char *) "three");
+            return __mkt_4;
+        })());
+        return __mka_4;
+    })()));
+    TDim<TTuple<16,int32_t,char *>,3> const  & __a_rename_at_4_5 = __a_rename_at_4_5_ConstRef;
+;
+    TTable<int32_t,char *> __b_rename_at_5_6; das_zero(__b_rename_at_5_6); das_move(__b_rename_at_5_6, _FuncbuiltinTickto_tableTick6550960242117856823_29fe2e0318b5f240(__context__,das_arg<TDim<TTuple<16,int32_t,char *>,3>>::pass((([&]() -> TDim<TTuple<16,int32_t,char *>,3>& {
+        _temp_make_local_5_22_0(0,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+            TTuple<16,int32_t,char *> __mkt_5;
+            das_get_tuple_field<int32_t,0>::get(__mkt_5) = 1;
+            das_get_tuple_field<char *,8>::get(__mkt_5) = ((char *) "one");
+            return __mkt_5;
+        })());
+        _temp_make_local_5_22_0(1,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+            TTuple<16,int32_t,char *> __mkt_5;
+            das_get_tuple_field<int32_t,0>::get(__mkt_5) = 2;
+            das_get_tuple_field<char *,8>::get(__mkt_5) = ((char *) "two");
+            return __mkt_5;
+        })());
+        _temp_make_local_5_22_0(2,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+            TTuple<16,int32_t,char *> __mkt_5;
+            das_get_tuple_field<int32_t,0>::get(__mkt_5) = 3;
+            das_get_tuple_field<char *,8>::get(__mkt_5) = ((char *) "three");
+            return __mkt_5;
+        })());
+        return _temp_make_local_5_22_0;
+    })()))));
+    {
+        bool __need_loop_6 = true;
+        // t: tuple<int;string> const&
+        das_iterator<TDim<TTuple<16,int32_t,char *>,3> const > __t_iterator(__a_rename_at_4_5);
+        TTuple<16,int32_t,char *> const  * __t_rename_at_6_7;
+        __need_loop_6 = __t_iterator.first(__context__,(__t_rename_at_6_7)) && __need_loop_6;
+        for ( ; __need_loop_6 ; __need_loop_6 = __t_iterator.next(__context__,(__t_rename_at_6_7)) )
+        {
+            DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_FuncbuiltinTickget_valueTick6803070933163225147_8f406ded258e5ea4(__context__,das_arg<TTable<int32_t,char *>>::pass(__b_rename_at_5_6),das_get_tuple_field<int32_t,0>::get((*__t_rename_at_6_7)))),cast<char *>::from(das_get_tuple_field<char *,8>::get((*__t_rename_at_6_7))),*__context__,nullptr)));
+        }
+        __t_iterator.close(__context__,(__t_rename_at_6_7));
+    };
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncbuiltinTickget_valueTick6803070933163225147_8f406ded258e5ea4 ( Context * __context__ ) {
+    TTable<int32_t,char *> &  arg_Tab = cast_aot_arg<TTable<int32_t,char *> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_at = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    return cast<char *>::from(_FuncbuiltinTickget_valueTick6803070933163225147_8f406ded258e5ea4(__context__, arg_Tab, arg_at));
+}
+static vec4f __wrap__FuncbuiltinTickto_tableTick6550960242117856823_29fe2e0318b5f240 ( Context * __context__ ) {
+    TDim<TTuple<16,int32_t,char *>,3> const  &  arg_a = cast_aot_arg<TDim<TTuple<16,int32_t,char *>,3> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TTable<int32_t,char *> *) __context__->abiCMRES) = _FuncbuiltinTickto_tableTick6550960242117856823_29fe2e0318b5f240(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap_test_9c3e6a14a4ffab9e ( Context * __context__ ) {
+    return cast<bool>::from(test_9c3e6a14a4ffab9e(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x990c2356a9700b34, false, (void*)&_FuncbuiltinTickget_valueTick6803070933163225147_8f406ded258e5ea4, &__wrap__FuncbuiltinTickget_valueTick6803070933163225147_8f406ded258e5ea4 },
+    { 0x75c3cd2ca57dae2e, true, (void*)&_FuncbuiltinTickto_tableTick6550960242117856823_29fe2e0318b5f240, &__wrap__FuncbuiltinTickto_tableTick6550960242117856823_29fe2e0318b5f240 },
+    { 0xc4f6c0096db0a124, false, (void*)&test_9c3e6a14a4ffab9e, &__wrap_test_9c3e6a14a4ffab9e },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_16840777879575480876
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,2076 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+#include "daScript/ast/ast_generate.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings_boost
+ // require ast_boost
+ // require math_bits
+ // require testing
+ // require testing_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_15901767823422641606 {
+
+namespace  { struct AAA; };
+namespace  { struct _lambda_thismodule_117_1; };
+namespace  { struct _lambda_thismodule_120_2; };
+namespace  { struct _lambda_thismodule_122_3; };
+namespace  { struct _lambda_thismodule_125_4; };
+namespace  { struct _lambda_thismodule_132_5; };
+namespace  { struct _lambda_thismodule_122_6; };
+namespace  { struct _lambda_thismodule_125_7; };
+namespace ast { struct AstFunctionAnnotation; };
+namespace ast { struct AstBlockAnnotation; };
+namespace ast { struct AstStructureAnnotation; };
+namespace ast { struct AstPassMacro; };
+namespace ast { struct AstVariantMacro; };
+namespace ast { struct AstForLoopMacro; };
+namespace ast { struct AstCaptureMacro; };
+namespace ast { struct AstTypeMacro; };
+namespace ast { struct AstSimulateMacro; };
+namespace ast { struct AstReaderMacro; };
+namespace ast { struct AstCommentReader; };
+namespace ast { struct AstCallMacro; };
+namespace ast { struct AstTypeInfoMacro; };
+namespace ast { struct AstEnumerationAnnotation; };
+namespace ast { struct AstVisitor; };
+namespace ast_boost { struct MacroMacro; };
+namespace ast_boost { struct TagFunctionAnnotation; };
+namespace ast_boost { struct TagStructureAnnotation; };
+namespace ast_boost { struct SetupAnyAnnotation; };
+namespace ast_boost { struct SetupFunctionAnnotation; };
+namespace ast_boost { struct SetupBlockAnnotation; };
+namespace ast_boost { struct SetupStructureAnnotation; };
+namespace ast_boost { struct SetupEnumerationAnnotation; };
+namespace ast_boost { struct SetupContractAnnotation; };
+namespace ast_boost { struct SetupReaderMacro; };
+namespace ast_boost { struct SetupCommentReader; };
+namespace ast_boost { struct SetupVariantMacro; };
+namespace ast_boost { struct SetupForLoopMacro; };
+namespace ast_boost { struct SetupCaptureMacro; };
+namespace ast_boost { struct SetupTypeMacro; };
+namespace ast_boost { struct SetupSimulateMacro; };
+namespace ast_boost { struct SetupCallMacro; };
+namespace ast_boost { struct SetupTypeInfoMacro; };
+namespace ast_boost { struct SetupInferMacro; };
+namespace ast_boost { struct SetupDirtyInferMacro; };
+namespace ast_boost { struct SetupLintMacro; };
+namespace ast_boost { struct SetupGlobalLintMacro; };
+namespace ast_boost { struct SetupOptimizationMacro; };
+namespace ast_boost { struct TagFunctionMacro; };
+namespace ast_boost { struct BetterRttiVisitor; };
+namespace testing { struct T; };
+namespace testing_boost { struct TestFunctionAnnotation; };
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+#if 0 // external enum
+namespace rtti {
+
+enum class Type : int32_t {
+    none = int32_t(INT64_C(0)),
+    autoinfer = int32_t(INT64_C(1)),
+    alias = int32_t(INT64_C(2)),
+    option = int32_t(INT64_C(3)),
+    typeDecl = int32_t(INT64_C(4)),
+    typeMacro = int32_t(INT64_C(5)),
+    fakeContext = int32_t(INT64_C(6)),
+    fakeLineInfo = int32_t(INT64_C(7)),
+    anyArgument = int32_t(INT64_C(8)),
+    tVoid = int32_t(INT64_C(9)),
+    tBool = int32_t(INT64_C(10)),
+    tInt8 = int32_t(INT64_C(11)),
+    tUInt8 = int32_t(INT64_C(12)),
+    tInt16 = int32_t(INT64_C(13)),
+    tUInt16 = int32_t(INT64_C(14)),
+    tInt64 = int32_t(INT64_C(15)),
+    tUInt64 = int32_t(INT64_C(16)),
+    tInt = int32_t(INT64_C(17)),
+    tInt2 = int32_t(INT64_C(18)),
+    tInt3 = int32_t(INT64_C(19)),
+    tInt4 = int32_t(INT64_C(20)),
+    tUInt = int32_t(INT64_C(21)),
+    tUInt2 = int32_t(INT64_C(22)),
+    tUInt3 = int32_t(INT64_C(23)),
+    tUInt4 = int32_t(INT64_C(24)),
+    tFloat = int32_t(INT64_C(25)),
+    tFloat2 = int32_t(INT64_C(26)),
+    tFloat3 = int32_t(INT64_C(27)),
+    tFloat4 = int32_t(INT64_C(28)),
+    tDouble = int32_t(INT64_C(29)),
+    tRange = int32_t(INT64_C(30)),
+    tURange = int32_t(INT64_C(31)),
+    tRange64 = int32_t(INT64_C(32)),
+    tURange64 = int32_t(INT64_C(33)),
+    tString = int32_t(INT64_C(34)),
+    tStructure = int32_t(INT64_C(35)),
+    tHandle = int32_t(INT64_C(36)),
+    tEnumeration = int32_t(INT64_C(37)),
+    tEnumeration8 = int32_t(INT64_C(38)),
+    tEnumeration16 = int32_t(INT64_C(39)),
+    tEnumeration64 = int32_t(INT64_C(40)),
+    tBitfield = int32_t(INT64_C(41)),
+    tBitfield8 = int32_t(INT64_C(42)),
+    tBitfield16 = int32_t(INT64_C(43)),
+    tBitfield64 = int32_t(INT64_C(44)),
+    tPointer = int32_t(INT64_C(45)),
+    tFunction = int32_t(INT64_C(46)),
+    tLambda = int32_t(INT64_C(47)),
+    tIterator = int32_t(INT64_C(48)),
+    tArray = int32_t(INT64_C(49)),
+    tTable = int32_t(INT64_C(50)),
+    tBlock = int32_t(INT64_C(51)),
+    tTuple = int32_t(INT64_C(52)),
+    tVariant = int32_t(INT64_C(53)),
+};
+}
+#endif // external enum
+// unused enumeration ConversionResult
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+namespace ast {
+
+struct AstFunctionAnnotation {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(AstFunctionAnnotation)==112,"structure size mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+// unused structure AstBlockAnnotation
+namespace ast {
+
+struct AstStructureAnnotation {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+};
+static_assert(sizeof(AstStructureAnnotation)==72,"structure size mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,aotSuffix)==64,"structure field offset mismatch with DAS");
+}
+// unused structure AstPassMacro
+namespace ast {
+
+struct AstVariantMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstVariantMacro)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+};
+static_assert(sizeof(AstVariantMacro)==40,"structure size mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,visitExprIsVariant)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,visitExprAsVariant)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,visitExprSafeAsVariant)==32,"structure field offset mismatch with DAS");
+}
+// unused structure AstForLoopMacro
+// unused structure AstCaptureMacro
+// unused structure AstTypeMacro
+// unused structure AstSimulateMacro
+// unused structure AstReaderMacro
+// unused structure AstCommentReader
+// unused structure AstCallMacro
+// unused structure AstTypeInfoMacro
+// unused structure AstEnumerationAnnotation
+// unused structure AstVisitor
+namespace ast_boost {
+
+struct MacroMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(MacroMacro)==112,"structure size mismatch with DAS");
+static_assert(offsetof(MacroMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct TagFunctionAnnotation {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(TagFunctionAnnotation)==112,"structure size mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct TagStructureAnnotation {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+};
+static_assert(sizeof(TagStructureAnnotation)==72,"structure size mismatch with DAS");
+static_assert(offsetof(TagStructureAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagStructureAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagStructureAnnotation,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagStructureAnnotation,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagStructureAnnotation,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagStructureAnnotation,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagStructureAnnotation,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagStructureAnnotation,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagStructureAnnotation,aotSuffix)==64,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupAnyAnnotation {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupAnyAnnotation)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupFunctionAnnotation {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupFunctionAnnotation)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotation,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotation,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotation,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotation,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotation,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotation,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotation,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotation,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotation,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotation,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupBlockAnnotation {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupBlockAnnotation)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupBlockAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupBlockAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupBlockAnnotation,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupBlockAnnotation,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupBlockAnnotation,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupBlockAnnotation,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupBlockAnnotation,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupBlockAnnotation,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupBlockAnnotation,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupBlockAnnotation,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupBlockAnnotation,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupBlockAnnotation,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupStructureAnnotation {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupStructureAnnotation)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupStructureAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureAnnotation,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureAnnotation,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureAnnotation,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureAnnotation,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureAnnotation,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureAnnotation,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureAnnotation,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureAnnotation,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureAnnotation,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureAnnotation,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupEnumerationAnnotation {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupEnumerationAnnotation)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupEnumerationAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupEnumerationAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupEnumerationAnnotation,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupEnumerationAnnotation,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupEnumerationAnnotation,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupEnumerationAnnotation,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupEnumerationAnnotation,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupEnumerationAnnotation,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupEnumerationAnnotation,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupEnumerationAnnotation,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupEnumerationAnnotation,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupEnumerationAnnotation,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupContractAnnotation {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupContractAnnotation)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupContractAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupContractAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupContractAnnotation,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupContractAnnotation,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupContractAnnotation,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupContractAnnotation,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupContractAnnotation,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupContractAnnotation,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupContractAnnotation,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupContractAnnotation,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupContractAnnotation,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupContractAnnotation,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupReaderMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupReaderMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupCommentReader {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupCommentReader)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupCommentReader,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCommentReader,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCommentReader,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCommentReader,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCommentReader,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCommentReader,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCommentReader,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCommentReader,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCommentReader,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCommentReader,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCommentReader,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCommentReader,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupVariantMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupVariantMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupForLoopMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupForLoopMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupForLoopMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupForLoopMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupForLoopMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupForLoopMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupForLoopMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupForLoopMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupForLoopMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupForLoopMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupForLoopMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupForLoopMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupForLoopMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupForLoopMacro,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupCaptureMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupCaptureMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupCaptureMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCaptureMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCaptureMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCaptureMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCaptureMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCaptureMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCaptureMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCaptureMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCaptureMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCaptureMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCaptureMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCaptureMacro,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupTypeMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupTypeMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupTypeMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeMacro,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupSimulateMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupSimulateMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupSimulateMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupSimulateMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupSimulateMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupSimulateMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupSimulateMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupSimulateMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupSimulateMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupSimulateMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupSimulateMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupSimulateMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupSimulateMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupSimulateMacro,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupCallMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupCallMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupTypeInfoMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupTypeInfoMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupTypeInfoMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeInfoMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeInfoMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeInfoMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeInfoMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeInfoMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeInfoMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeInfoMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeInfoMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeInfoMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeInfoMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupTypeInfoMacro,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupInferMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupInferMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupDirtyInferMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupDirtyInferMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupDirtyInferMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupDirtyInferMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupDirtyInferMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupDirtyInferMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupDirtyInferMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupDirtyInferMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupDirtyInferMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupDirtyInferMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupDirtyInferMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupDirtyInferMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupDirtyInferMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupDirtyInferMacro,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupLintMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupLintMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupLintMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupLintMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupLintMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupLintMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupLintMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupLintMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupLintMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupLintMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupLintMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupLintMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupLintMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupLintMacro,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupGlobalLintMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupGlobalLintMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupGlobalLintMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupGlobalLintMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupGlobalLintMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupGlobalLintMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupGlobalLintMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupGlobalLintMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupGlobalLintMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupGlobalLintMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupGlobalLintMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupGlobalLintMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupGlobalLintMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupGlobalLintMacro,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupOptimizationMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupOptimizationMacro)==96,"structure size mismatch with DAS");
+static_assert(offsetof(SetupOptimizationMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupOptimizationMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupOptimizationMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupOptimizationMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupOptimizationMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupOptimizationMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupOptimizationMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupOptimizationMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupOptimizationMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupOptimizationMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupOptimizationMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupOptimizationMacro,setup_call)==88,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct TagFunctionMacro {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotPrefix;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotBody;
+    Func DAS_COMMENT((void,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,AnnotationArgumentList const ,StringBuilderWriter)) aotSuffix;
+    char * annotation_function_call;
+    char * name;
+    Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+    char * tag;
+};
+static_assert(sizeof(TagFunctionMacro)==104,"structure size mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,finish)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,patch)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,complete)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,aotPrefix)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,aotBody)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,aotSuffix)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,annotation_function_call)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,name)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,setup_call)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,tag)==96,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct BetterRttiVisitor {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstVariantMacro)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+};
+static_assert(sizeof(BetterRttiVisitor)==40,"structure size mismatch with DAS");
+static_assert(offsetof(BetterRttiVisitor,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(BetterRttiVisitor,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(BetterRttiVisitor,visitExprIsVariant)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(BetterRttiVisitor,visitExprAsVariant)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(BetterRttiVisitor,visitExprSafeAsVariant)==32,"structure field offset mismatch with DAS");
+}
+namespace testing {
+
+struct T {
+    void * __rtti;
+    Func DAS_COMMENT((void,testing::T)) __finalize;
+    char * name;
+    int64_t startTick;
+    bool verbose;
+    Lambda DAS_COMMENT((void,char * const ,LineInfo const )) onLog;
+    Lambda DAS_COMMENT((void,bool)) onFail;
+    Lambda DAS_COMMENT((void)) onSkipNow;
+    Lambda DAS_COMMENT((void,char * const ,TVariant<16,8,Lambda DAS_COMMENT((void,testing::T * const )),Func DAS_COMMENT((void,testing::T * const ))> const )) onRun;
+    bool failed;
+    bool skipped;
+    Func DAS_COMMENT((void,testing::T const )) failNow;
+    Func DAS_COMMENT((void,testing::T const )) fail;
+    Func DAS_COMMENT((void,testing::T const ,char * const )) error;
+    Func DAS_COMMENT((void,testing::T const ,char * const ,LineInfo const )) errorAt;
+    Func DAS_COMMENT((void,testing::T const ,char * const )) fatal;
+    Func DAS_COMMENT((void,testing::T const ,char * const ,LineInfo const )) fatalAt;
+    Func DAS_COMMENT((void,testing::T const ,char * const )) log;
+    Func DAS_COMMENT((void,testing::T const ,char * const ,LineInfo const )) logAt;
+    Func DAS_COMMENT((void,testing::T const )) skipNow;
+    Func DAS_COMMENT((void,testing::T const ,char * const )) skip;
+    Func DAS_COMMENT((void,testing::T const ,char * const ,LineInfo const )) skipAt;
+    Func DAS_COMMENT((int32_t,testing::T const )) getTimeUsec;
+    Func DAS_COMMENT((double,testing::T const )) getTimeSec;
+};
+static_assert(sizeof(T)==184,"structure size mismatch with DAS");
+static_assert(offsetof(T,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(T,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(T,name)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(T,startTick)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(T,verbose)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(T,onLog)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(T,onFail)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(T,onSkipNow)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(T,onRun)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(T,failed)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(T,skipped)==73,"structure field offset mismatch with DAS");
+static_assert(offsetof(T,failNow)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(T,fail)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(T,error)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(T,errorAt)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(T,fatal)==112,"structure field offset mismatch with DAS");
+static_assert(offsetof(T,fatalAt)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(T,log)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(T,logAt)==136,"structure field offset mismatch with DAS");
+static_assert(offsetof(T,skipNow)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(T,skip)==152,"structure field offset mismatch with DAS");
+static_assert(offsetof(T,skipAt)==160,"structure field offset mismatch with DAS");
+static_assert(offsetof(T,getTimeUsec)==168,"structure field offset mismatch with DAS");
+static_assert(offsetof(T,getTimeSec)==176,"structure field offset mismatch with DAS");
+}
+namespace testing_boost {
+
+struct TestFunctionAnnotation {
+    void * __rtti;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+    Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) verifyCall;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) generic_apply;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string,bool &)) patch;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) fixup;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) lint;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,smart_ptr_raw<Context>)) complete;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,das::vector<smart_ptr<TypeDecl>>,AnnotationDeclaration const ,das::string)) isCompatible;
+    Func DAS_COMMENT((bool,ast::AstFunctionAnnotation)) isSpecialized;
+    Func DAS_COMMENT((void,ast::AstFunctionAnnotation,smart_ptr_raw<Function> const ,AnnotationDeclaration const ,das::string)) appendToMangledName;
+};
+static_assert(sizeof(TestFunctionAnnotation)==112,"structure size mismatch with DAS");
+static_assert(offsetof(TestFunctionAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFunctionAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFunctionAnnotation,transform)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFunctionAnnotation,verifyCall)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFunctionAnnotation,apply)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFunctionAnnotation,generic_apply)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFunctionAnnotation,finish)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFunctionAnnotation,patch)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFunctionAnnotation,fixup)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFunctionAnnotation,lint)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFunctionAnnotation,complete)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFunctionAnnotation,isCompatible)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFunctionAnnotation,isSpecialized)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(TestFunctionAnnotation,appendToMangledName)==104,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct AAA {
+    int32_t x;
+    int32_t y;
+};
+static_assert(sizeof(AAA)==8,"structure size mismatch with DAS");
+static_assert(offsetof(AAA,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AAA,y)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_117_1 {
+    Func DAS_COMMENT((void,_lambda_thismodule_117_1,char * const )) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_117_1 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_117_1)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_117_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_117_1,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_120_2 {
+    Func DAS_COMMENT((void,_lambda_thismodule_120_2,char * const )) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_120_2 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_120_2)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_120_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_120_2,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_122_3 {
+    Func DAS_COMMENT((void,_lambda_thismodule_122_3,char * const )) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_122_3 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_122_3)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_122_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_122_3,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_125_4 {
+    Func DAS_COMMENT((void,_lambda_thismodule_125_4,char * const )) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_125_4 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_125_4)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_4,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_4,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_132_5 {
+    Func DAS_COMMENT((void,_lambda_thismodule_132_5,char * const )) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_132_5 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_132_5)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_5,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_5,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_122_6 {
+    Func DAS_COMMENT((void,_lambda_thismodule_122_6,char * const )) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_122_6 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_122_6)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_122_6,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_122_6,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_125_7 {
+    Func DAS_COMMENT((void,_lambda_thismodule_125_7,char * const )) __lambda;
+    Func DAS_COMMENT((void,_lambda_thismodule_125_7 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_125_7)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_7,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_125_7,__finalize)==8,"structure field offset mismatch with DAS");
+}
+extern StructInfo __struct_info__dd768ae7f549f63f;
+extern StructInfo __struct_info__a11e1aa53a391197;
+extern StructInfo __struct_info__a4a41aa53d557dc0;
+extern StructInfo __struct_info__ab2b1aa542a690c0;
+extern StructInfo __struct_info__ab281aa542a177c0;
+extern StructInfo __struct_info__9a941aa534e5c8c0;
+extern StructInfo __struct_info__9a971aa534eae1c0;
+extern StructInfo __struct_info__ab255aa5429faea9;
+extern TypeInfo __type_info__bfad913ed5c8e239;
+extern TypeInfo __type_info__bebd5aafe79f4df9;
+extern TypeInfo __type_info__993385c558408d53;
+extern TypeInfo __type_info__af58c614628a8a8c;
+extern TypeInfo __type_info__298d5cb81cde3275;
+extern TypeInfo __type_info__2d16be159ed1790c;
+extern TypeInfo __type_info__2c29d8468e7a7d6f;
+extern TypeInfo __type_info__4ad0e7d28be4f26f;
+extern TypeInfo __type_info__a421e7e0b949436f;
+extern TypeInfo __type_info__f067aeb587e7fe6f;
+extern TypeInfo __type_info__a4aeaea76610516f;
+extern TypeInfo __type_info__864067a9015d8d2e;
+extern TypeInfo __type_info__c4049fd5eadc3cf8;
+extern TypeInfo __type_info__af8afe4c86446b52;
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__e1a16428d5e48bbf;
+extern TypeInfo __type_info__14e9a2059e7223c8;
+extern TypeInfo __type_info__14547aa8b8b420aa;
+extern TypeInfo __type_info__998a259a6c6b153b;
+extern TypeInfo __type_info__cfa22590375f243b;
+extern TypeInfo __type_info__d9d4259040089f3b;
+extern TypeInfo __type_info__8e4d25b1cde2163b;
+extern TypeInfo __type_info__841b25b1c5389b3b;
+extern TypeInfo __type_info__e3af4c9045f428c0;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __struct_info__dd768ae7f549f63f_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x312d704d337b3a26), "x", 0, 0 };
+VarInfo __struct_info__dd768ae7f549f63f_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x312d714d337b3bd9), "y", 4, 0 };
+VarInfo * __struct_info__dd768ae7f549f63f_fields[2] =  { &__struct_info__dd768ae7f549f63f_field_0, &__struct_info__dd768ae7f549f63f_field_1 };
+StructInfo __struct_info__dd768ae7f549f63f = {"AAA", "", 0, __struct_info__dd768ae7f549f63f_fields, 2, 8, UINT64_C(0xdf2263086b8802f7), nullptr, UINT64_C(0xdd768ae7f549f63f), 2 };
+TypeInfo * __type_info__82f46844ebba43f1_arg_types_var_11609746186356461975[2] = { &__type_info__14547aa8b8b420aa, &__type_info__af90fe4c864e9d52 };
+const char * __type_info__82f46844ebba43f1_arg_names_var_11609746186356461975[2] = { "__this", "a" };
+VarInfo __struct_info__a11e1aa53a391197_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__82f46844ebba43f1_arg_types_var_11609746186356461975, __type_info__82f46844ebba43f1_arg_names_var_11609746186356461975, 2, 0, nullptr, 12, 8, UINT64_C(0x82f46844ebba43f1), "__lambda", 0, 0 };
+TypeInfo * __type_info__28da529759019de5_arg_types_var_11609746186356461975[1] = { &__type_info__2d16be159ed1790c };
+const char * __type_info__28da529759019de5_arg_names_var_11609746186356461975[1] = { "__this" };
+VarInfo __struct_info__a11e1aa53a391197_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__28da529759019de5_arg_types_var_11609746186356461975, __type_info__28da529759019de5_arg_names_var_11609746186356461975, 1, 0, nullptr, 12, 8, UINT64_C(0x28da529759019de5), "__finalize", 8, 0 };
+VarInfo * __struct_info__a11e1aa53a391197_fields[2] =  { &__struct_info__a11e1aa53a391197_field_0, &__struct_info__a11e1aa53a391197_field_1 };
+StructInfo __struct_info__a11e1aa53a391197 = {"_lambda_thismodule_117_1", "", 14, __struct_info__a11e1aa53a391197_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0xa11e1aa53a391197), 2 };
+TypeInfo * __type_info__52688ba3c5966e46_arg_types_var_11863636615401668032[2] = { &__type_info__998a259a6c6b153b, &__type_info__af90fe4c864e9d52 };
+VarInfo __struct_info__a4a41aa53d557dc0_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__52688ba3c5966e46_arg_types_var_11863636615401668032, __type_info__82f46844ebba43f1_arg_names_var_11609746186356461975, 2, 0, nullptr, 12, 8, UINT64_C(0x52688ba3c5966e46), "__lambda", 0, 0 };
+TypeInfo * __type_info__6f6a59bf51537d0_arg_types_var_11863636615401668032[1] = { &__type_info__2c29d8468e7a7d6f };
+VarInfo __struct_info__a4a41aa53d557dc0_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__6f6a59bf51537d0_arg_types_var_11863636615401668032, __type_info__28da529759019de5_arg_names_var_11609746186356461975, 1, 0, nullptr, 12, 8, UINT64_C(0x6f6a59bf51537d0), "__finalize", 8, 0 };
+VarInfo * __struct_info__a4a41aa53d557dc0_fields[2] =  { &__struct_info__a4a41aa53d557dc0_field_0, &__struct_info__a4a41aa53d557dc0_field_1 };
+StructInfo __struct_info__a4a41aa53d557dc0 = {"_lambda_thismodule_120_2", "", 14, __struct_info__a4a41aa53d557dc0_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0xa4a41aa53d557dc0), 2 };
+TypeInfo * __type_info__7db981d41c168f46_arg_types_var_12333981301574373568[2] = { &__type_info__cfa22590375f243b, &__type_info__af90fe4c864e9d52 };
+VarInfo __struct_info__ab2b1aa542a690c0_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__7db981d41c168f46_arg_types_var_12333981301574373568, __type_info__82f46844ebba43f1_arg_names_var_11609746186356461975, 2, 0, nullptr, 12, 8, UINT64_C(0x7db981d41c168f46), "__lambda", 0, 0 };
+TypeInfo * __type_info__f00a535982d478d0_arg_types_var_12333981301574373568[1] = { &__type_info__4ad0e7d28be4f26f };
+VarInfo __struct_info__ab2b1aa542a690c0_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__f00a535982d478d0_arg_types_var_12333981301574373568, __type_info__28da529759019de5_arg_names_var_11609746186356461975, 1, 0, nullptr, 12, 8, UINT64_C(0xf00a535982d478d0), "__finalize", 8, 0 };
+VarInfo * __struct_info__ab2b1aa542a690c0_fields[2] =  { &__struct_info__ab2b1aa542a690c0_field_0, &__struct_info__ab2b1aa542a690c0_field_1 };
+StructInfo __struct_info__ab2b1aa542a690c0 = {"_lambda_thismodule_122_3", "", 14, __struct_info__ab2b1aa542a690c0_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0xab2b1aa542a690c0), 2 };
+TypeInfo * __type_info__21d76430f5c19046_arg_types_var_12333136876643907520[2] = { &__type_info__d9d4259040089f3b, &__type_info__af90fe4c864e9d52 };
+VarInfo __struct_info__ab281aa542a177c0_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__21d76430f5c19046_arg_types_var_12333136876643907520, __type_info__82f46844ebba43f1_arg_names_var_11609746186356461975, 2, 0, nullptr, 12, 8, UINT64_C(0x21d76430f5c19046), "__lambda", 0, 0 };
+TypeInfo * __type_info__7ff2c7db6566a9d0_arg_types_var_12333136876643907520[1] = { &__type_info__a421e7e0b949436f };
+VarInfo __struct_info__ab281aa542a177c0_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__7ff2c7db6566a9d0_arg_types_var_12333136876643907520, __type_info__28da529759019de5_arg_names_var_11609746186356461975, 1, 0, nullptr, 12, 8, UINT64_C(0x7ff2c7db6566a9d0), "__finalize", 8, 0 };
+VarInfo * __struct_info__ab281aa542a177c0_fields[2] =  { &__struct_info__ab281aa542a177c0_field_0, &__struct_info__ab281aa542a177c0_field_1 };
+StructInfo __struct_info__ab281aa542a177c0 = {"_lambda_thismodule_122_6", "", 14, __struct_info__ab281aa542a177c0_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0xab281aa542a177c0), 2 };
+TypeInfo * __type_info__1a5a622ec6e33746_arg_types_var_11138557075253479616[2] = { &__type_info__8e4d25b1cde2163b, &__type_info__af90fe4c864e9d52 };
+VarInfo __struct_info__9a941aa534e5c8c0_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__1a5a622ec6e33746_arg_types_var_11138557075253479616, __type_info__82f46844ebba43f1_arg_names_var_11609746186356461975, 2, 0, nullptr, 12, 8, UINT64_C(0x1a5a622ec6e33746), "__lambda", 0, 0 };
+TypeInfo * __type_info__5b2efa3571f200d0_arg_types_var_11138557075253479616[1] = { &__type_info__f067aeb587e7fe6f };
+VarInfo __struct_info__9a941aa534e5c8c0_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__5b2efa3571f200d0_arg_types_var_11138557075253479616, __type_info__28da529759019de5_arg_names_var_11609746186356461975, 1, 0, nullptr, 12, 8, UINT64_C(0x5b2efa3571f200d0), "__finalize", 8, 0 };
+VarInfo * __struct_info__9a941aa534e5c8c0_fields[2] =  { &__struct_info__9a941aa534e5c8c0_field_0, &__struct_info__9a941aa534e5c8c0_field_1 };
+StructInfo __struct_info__9a941aa534e5c8c0 = {"_lambda_thismodule_125_4", "", 14, __struct_info__9a941aa534e5c8c0_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0x9a941aa534e5c8c0), 2 };
+TypeInfo * __type_info__ac734e1a9a8f9a46_arg_types_var_11139401500183945664[2] = { &__type_info__841b25b1c5389b3b, &__type_info__af90fe4c864e9d52 };
+VarInfo __struct_info__9a971aa534eae1c0_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__ac734e1a9a8f9a46_arg_types_var_11139401500183945664, __type_info__82f46844ebba43f1_arg_names_var_11609746186356461975, 2, 0, nullptr, 12, 8, UINT64_C(0xac734e1a9a8f9a46), "__lambda", 0, 0 };
+TypeInfo * __type_info__8003e925d8f68bd0_arg_types_var_11139401500183945664[1] = { &__type_info__a4aeaea76610516f };
+VarInfo __struct_info__9a971aa534eae1c0_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__8003e925d8f68bd0_arg_types_var_11139401500183945664, __type_info__28da529759019de5_arg_names_var_11609746186356461975, 1, 0, nullptr, 12, 8, UINT64_C(0x8003e925d8f68bd0), "__finalize", 8, 0 };
+VarInfo * __struct_info__9a971aa534eae1c0_fields[2] =  { &__struct_info__9a971aa534eae1c0_field_0, &__struct_info__9a971aa534eae1c0_field_1 };
+StructInfo __struct_info__9a971aa534eae1c0 = {"_lambda_thismodule_125_7", "", 14, __struct_info__9a971aa534eae1c0_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0x9a971aa534eae1c0), 2 };
+TypeInfo * __type_info__3046ee672755de6b_arg_types_var_12332362820457836201[2] = { &__type_info__e3af4c9045f428c0, &__type_info__af90fe4c864e9d52 };
+VarInfo __struct_info__ab255aa5429faea9_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__3046ee672755de6b_arg_types_var_12332362820457836201, __type_info__82f46844ebba43f1_arg_names_var_11609746186356461975, 2, 0, nullptr, 12, 8, UINT64_C(0x3046ee672755de6b), "__lambda", 0, 0 };
+TypeInfo * __type_info__e106d543b8c34dcf_arg_types_var_12332362820457836201[1] = { &__type_info__864067a9015d8d2e };
+VarInfo __struct_info__ab255aa5429faea9_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__e106d543b8c34dcf_arg_types_var_12332362820457836201, __type_info__28da529759019de5_arg_names_var_11609746186356461975, 1, 0, nullptr, 12, 8, UINT64_C(0xe106d543b8c34dcf), "__finalize", 8, 0 };
+VarInfo * __struct_info__ab255aa5429faea9_fields[2] =  { &__struct_info__ab255aa5429faea9_field_0, &__struct_info__ab255aa5429faea9_field_1 };
+StructInfo __struct_info__ab255aa5429faea9 = {"_lambda_thismodule_132_5", "", 14, __struct_info__ab255aa5429faea9_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0xab255aa5429faea9), 2 };
+TypeInfo __type_info__bfad913ed5c8e239 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__14e9a2059e7223c8, nullptr, nullptr, nullptr, 0, 0, nullptr, 41218, 24, UINT64_C(0xbfad913ed5c8e239) };
+TypeInfo __type_info__bebd5aafe79f4df9 = { Type::tTable, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, &__type_info__af63e44c8601fa24, nullptr, nullptr, 0, 0, nullptr, 41218, 48, UINT64_C(0xbebd5aafe79f4df9) };
+TypeInfo __type_info__993385c558408d53 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 41218, 24, UINT64_C(0x993385c558408d53) };
+TypeInfo __type_info__af58c614628a8a8c = { Type::tStructure, &__struct_info__dd768ae7f549f63f, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 286, 8, UINT64_C(0xaf58c614628a8a8c) };
+uint32_t __type_info__298d5cb81cde3275_dim[1] = { 3 };
+TypeInfo __type_info__298d5cb81cde3275 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 1, __type_info__298d5cb81cde3275_dim, 286, 12, UINT64_C(0x298d5cb81cde3275) };
+TypeInfo __type_info__2d16be159ed1790c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__14547aa8b8b420aa, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x2d16be159ed1790c) };
+TypeInfo __type_info__2c29d8468e7a7d6f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__998a259a6c6b153b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x2c29d8468e7a7d6f) };
+TypeInfo __type_info__4ad0e7d28be4f26f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__cfa22590375f243b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x4ad0e7d28be4f26f) };
+TypeInfo __type_info__a421e7e0b949436f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d9d4259040089f3b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xa421e7e0b949436f) };
+TypeInfo __type_info__f067aeb587e7fe6f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8e4d25b1cde2163b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xf067aeb587e7fe6f) };
+TypeInfo __type_info__a4aeaea76610516f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__841b25b1c5389b3b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xa4aeaea76610516f) };
+TypeInfo __type_info__864067a9015d8d2e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e3af4c9045f428c0, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x864067a9015d8d2e) };
+TypeInfo __type_info__c4049fd5eadc3cf8 = { Type::tTable, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, &__type_info__e1a16428d5e48bbf, nullptr, nullptr, 0, 0, nullptr, 57634, 48, UINT64_C(0xc4049fd5eadc3cf8) };
+TypeInfo __type_info__af8afe4c86446b52 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xaf8afe4c86446b52) };
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo * __type_info__e1a16428d5e48bbf_arg_types[1] = { &__type_info__af90fe4c864e9d52 };
+const char * __type_info__e1a16428d5e48bbf_arg_names[1] = { "a" };
+TypeInfo __type_info__e1a16428d5e48bbf = { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__e1a16428d5e48bbf_arg_types, __type_info__e1a16428d5e48bbf_arg_names, 1, 0, nullptr, 24576, 8, UINT64_C(0xe1a16428d5e48bbf) };
+TypeInfo __type_info__14e9a2059e7223c8 = { Type::tStructure, &__struct_info__dd768ae7f549f63f, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 8, UINT64_C(0x14e9a2059e7223c8) };
+TypeInfo __type_info__14547aa8b8b420aa = { Type::tStructure, &__struct_info__a11e1aa53a391197, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 16, UINT64_C(0x14547aa8b8b420aa) };
+TypeInfo __type_info__998a259a6c6b153b = { Type::tStructure, &__struct_info__a4a41aa53d557dc0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 16, UINT64_C(0x998a259a6c6b153b) };
+TypeInfo __type_info__cfa22590375f243b = { Type::tStructure, &__struct_info__ab2b1aa542a690c0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 16, UINT64_C(0xcfa22590375f243b) };
+TypeInfo __type_info__d9d4259040089f3b = { Type::tStructure, &__struct_info__ab281aa542a177c0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 16, UINT64_C(0xd9d4259040089f3b) };
+TypeInfo __type_info__8e4d25b1cde2163b = { Type::tStructure, &__struct_info__9a941aa534e5c8c0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 16, UINT64_C(0x8e4d25b1cde2163b) };
+TypeInfo __type_info__841b25b1c5389b3b = { Type::tStructure, &__struct_info__9a971aa534eae1c0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 16, UINT64_C(0x841b25b1c5389b3b) };
+TypeInfo __type_info__e3af4c9045f428c0 = { Type::tStructure, &__struct_info__ab255aa5429faea9, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24590, 16, UINT64_C(0xe3af4c9045f428c0) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__298d5cb81cde3275, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_3[2] = { &__type_info__993385c558408d53, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_6[2] = { &__type_info__af8afe4c86446b52, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_7[2] = { &__type_info__bfad913ed5c8e239, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_11[2] = { &__type_info__af58c614628a8a8c, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_15[2] = { &__type_info__bebd5aafe79f4df9, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_16[2] = { &__type_info__c4049fd5eadc3cf8, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_19[2] = { &__type_info__e1a16428d5e48bbf, &__type_info__af90fe4c864e9d52 };
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_31c92aa9b7d5c23 ( Context * __context__, TArray<AAA> & __Arr_rename_at_68_2, int32_t __newSize_rename_at_68_3 );
+inline void finalize_2845d8c623782b62 ( Context * __context__, _lambda_thismodule_122_6 & ____this_rename_at_122_4 );
+inline void finalize_725c076d4247a0c4 ( Context * __context__, _lambda_thismodule_125_7 & ____this_rename_at_125_5 );
+inline void _Func_lambda_thismodule_122_6Tickfunction_c29619788ec92f9a ( Context * __context__, _lambda_thismodule_122_6 & ____this_rename_at_122_6, char * const  __a_rename_at_122_7 );
+inline void _Func_lambda_thismodule_122_6Tickfinalizer_17d4f93f1713d08a ( Context * __context__, _lambda_thismodule_122_6 * ____this_rename_at_122_9 );
+inline void _Func_lambda_thismodule_125_7Tickfunction_74d78ce3485657a7 ( Context * __context__, _lambda_thismodule_125_7 & ____this_rename_at_125_10, char * const  __a_rename_at_125_11 );
+inline void _Func_lambda_thismodule_125_7Tickfinalizer_4ba26625e6bd7079 ( Context * __context__, _lambda_thismodule_125_7 * ____this_rename_at_125_13 );
+inline void finalize_a7c72984b8da787e ( Context * __context__, _lambda_thismodule_117_1 & ____this_rename_at_117_14 );
+inline void finalize_2cb5cb3ae2f49b9c ( Context * __context__, _lambda_thismodule_120_2 & ____this_rename_at_120_15 );
+inline void finalize_1b16d39290c2e720 ( Context * __context__, _lambda_thismodule_122_3 & ____this_rename_at_122_16 );
+inline void finalize_75dd5e83200f623 ( Context * __context__, _lambda_thismodule_125_4 & ____this_rename_at_125_17 );
+inline void finalize_34edf3725151503f ( Context * __context__, _lambda_thismodule_132_5 & ____this_rename_at_132_18 );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115 ( Context * __context__, TDim<int32_t,2> & __a_rename_at_1502_19 );
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25 ( Context * __context__, TDim<int32_t,1> & __a_rename_at_1502_21 );
+inline TArray<AAA> _FuncbuiltinTickto_array_moveTick3185538323411982277_3557f5d8868c815a ( Context * __context__, TDim<AAA,2> & __a_rename_at_1502_23 );
+inline TTable<int32_t,int32_t> _FuncbuiltinTickto_table_moveTick5858896087460481804_3f61d9e89af53f34 ( Context * __context__, TDim<TTuple<8,int32_t,int32_t>,2> & __a_rename_at_1615_25 );
+inline TTable<int32_t,Lambda DAS_COMMENT((void,char * const ))> _FuncbuiltinTickto_table_moveTick3493479898590698300_c1c7949ebc2f23fd ( Context * __context__, TTuple<16,int32_t,Lambda DAS_COMMENT((void,char * const ))> & __a_rename_at_1602_28 );
+inline void _Func_lambda_thismodule_117_1Tickfunction_45cfbeaa986ffbe8 ( Context * __context__, _lambda_thismodule_117_1 & ____this_rename_at_117_30, char * const  __a_rename_at_117_31 );
+inline void _Func_lambda_thismodule_117_1Tickfinalizer_f38c92b003ca1953 ( Context * __context__, _lambda_thismodule_117_1 * ____this_rename_at_117_32 );
+inline void _Func_lambda_thismodule_120_2Tickfunction_b36e5775936ddc9e ( Context * __context__, _lambda_thismodule_120_2 & ____this_rename_at_120_33, char * const  __a_rename_at_120_34 );
+inline void _Func_lambda_thismodule_120_2Tickfinalizer_572414511821ce8f ( Context * __context__, _lambda_thismodule_120_2 * ____this_rename_at_120_35 );
+inline void _Func_lambda_thismodule_122_3Tickfunction_1364c86dba9d9e42 ( Context * __context__, _lambda_thismodule_122_3 & ____this_rename_at_122_36, char * const  __a_rename_at_122_37 );
+inline void _Func_lambda_thismodule_122_3Tickfinalizer_b3273d3fbf889dfc ( Context * __context__, _lambda_thismodule_122_3 * ____this_rename_at_122_38 );
+inline void _Func_lambda_thismodule_125_4Tickfunction_f16a0cf59d76838d ( Context * __context__, _lambda_thismodule_125_4 & ____this_rename_at_125_39, char * const  __a_rename_at_125_40 );
+inline void _Func_lambda_thismodule_125_4Tickfinalizer_b2cebfdb6f5f8e6c ( Context * __context__, _lambda_thismodule_125_4 * ____this_rename_at_125_41 );
+inline void _Func_lambda_thismodule_132_5Tickfunction_620819da6453359 ( Context * __context__, _lambda_thismodule_132_5 & ____this_rename_at_132_42, char * const  __a_rename_at_132_43 );
+inline void _Func_lambda_thismodule_132_5Tickfinalizer_e2a31117b15a5229 ( Context * __context__, _lambda_thismodule_132_5 * ____this_rename_at_132_44 );
+inline void test_int_array_8f0fd30c7b48b477 ( Context * __context__ );
+inline void test_structure_init_57d2d7f0b26d0aba ( Context * __context__ );
+inline void test_table_init_9fe45597092ab347 ( Context * __context__ );
+inline void test_blocks_3e8325da4b9a6290 ( Context * __context__ );
+inline void test_mixed_blocks_21593d576a75751d ( Context * __context__ );
+inline void test_string_interpolation_505e64bd947ccd6f ( Context * __context__ );
+inline bool test_fb64e3c7e3f6f098 ( Context * __context__ );
+inline AAA AAA_74d9951fb0a8f4f3 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_31c92aa9b7d5c23 ( Context * __context__, TArray<AAA> &  __Arr_rename_at_68_2, int32_t __newSize_rename_at_68_3 )
+{
+    builtin_array_resize(das_arg<TArray<AAA>>::pass(__Arr_rename_at_68_2),__newSize_rename_at_68_3,8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void finalize_2845d8c623782b62 ( Context * __context__, _lambda_thismodule_122_6 &  ____this_rename_at_122_4 )
+{
+    memset((void*)&(____this_rename_at_122_4), 0, 16);
+}
+
+inline void finalize_725c076d4247a0c4 ( Context * __context__, _lambda_thismodule_125_7 &  ____this_rename_at_125_5 )
+{
+    memset((void*)&(____this_rename_at_125_5), 0, 16);
+}
+
+inline void _Func_lambda_thismodule_122_6Tickfunction_c29619788ec92f9a ( Context * __context__, _lambda_thismodule_122_6 &  ____this_rename_at_122_6, char * const  __a_rename_at_122_7 )
+{
+    TTuple<16,int32_t,Lambda DAS_COMMENT((void,char * const ))> _temp_make_local_122_51_0; _temp_make_local_122_51_0;
+    TTable<int32_t,Lambda DAS_COMMENT((void,char * const ))> __a3_rename_at_122_8_ConstRef; das_zero(__a3_rename_at_122_8_ConstRef); das_move(__a3_rename_at_122_8_ConstRef, ((TTable<int32_t,Lambda DAS_COMMENT((void,char * const ))>)_FuncbuiltinTickto_table_moveTick3493479898590698300_c1c7949ebc2f23fd(__context__,das_arg<TTuple<16,int32_t,Lambda DAS_COMMENT((void,char * const ))>>::pass((([&]() -> TTuple<16,int32_t,Lambda DAS_COMMENT((void,char * const ))>& {
+        das_get_tuple_field<int32_t,0>::get(_temp_make_local_122_51_0) = 1;
+        das_get_tuple_field<Lambda DAS_COMMENT((void,char * const )),8>::get(_temp_make_local_122_51_0) = das_ascend<void,_lambda_thismodule_122_3>::make(__context__,&__type_info__cfa22590375f243b,(([&]() -> _lambda_thismodule_122_3 {
+            _lambda_thismodule_122_3 __mks_122;
+            das_copy((__mks_122.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_122_3`function XS<_lambda_thismodule_122_3> Cs*/ 0x97c4d2bc32034494))));
+            das_copy((__mks_122.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_122_3`finalizer X1<S<_lambda_thismodule_122_3>>?*/ 0x165481658279b576))));
+            return __mks_122;
+        })()));
+        return _temp_make_local_122_51_0;
+    })())))));
+    TTable<int32_t,Lambda DAS_COMMENT((void,char * const ))> const  & __a3_rename_at_122_8 = __a3_rename_at_122_8_ConstRef;
+;
+}
+
+inline void _Func_lambda_thismodule_122_6Tickfinalizer_17d4f93f1713d08a ( Context * __context__, _lambda_thismodule_122_6 * ____this_rename_at_122_9 )
+{
+    finalize_2845d8c623782b62(__context__,das_arg<_lambda_thismodule_122_6>::pass(das_deref(__context__,____this_rename_at_122_9,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_122_6 *>::clear(__context__,____this_rename_at_122_9);
+}
+
+inline void _Func_lambda_thismodule_125_7Tickfunction_74d78ce3485657a7 ( Context * __context__, _lambda_thismodule_125_7 &  ____this_rename_at_125_10, char * const  __a_rename_at_125_11 )
+{
+    TTuple<16,int32_t,Lambda DAS_COMMENT((void,char * const ))> _temp_make_local_125_51_1; _temp_make_local_125_51_1;
+    TTable<int32_t,Lambda DAS_COMMENT((void,char * const ))> __a3_rename_at_125_12_ConstRef; das_zero(__a3_rename_at_125_12_ConstRef); das_move(__a3_rename_at_125_12_ConstRef, ((TTable<int32_t,Lambda DAS_COMMENT((void,char * const ))>)_FuncbuiltinTickto_table_moveTick3493479898590698300_c1c7949ebc2f23fd(__context__,das_arg<TTuple<16,int32_t,Lambda DAS_COMMENT((void,char * const ))>>::pass((([&]() -> TTuple<16,int32_t,Lambda DAS_COMMENT((void,char * const ))>& {
+        das_get_tuple_field<int32_t,0>::get(_temp_make_local_125_51_1) = 1;
+        das_get_tuple_field<Lambda DAS_COMMENT((void,char * const )),8>::get(_temp_make_local_125_51_1) = das_ascend<void,_lambda_thismodule_125_4>::make(__context__,&__type_info__8e4d25b1cde2163b,(([&]() -> _lambda_thismodule_125_4 {
+            _lambda_thismodule_125_4 __mks_125;
+            das_copy((__mks_125.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_125_4`function XS<_lambda_thismodule_125_4> Cs*/ 0x23794ec39bcd289a))));
+            das_copy((__mks_125.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_125_4`finalizer X1<S<_lambda_thismodule_125_4>>?*/ 0xf826492905308376))));
+            return __mks_125;
+        })()));
+        return _temp_make_local_125_51_1;
+    })())))));
+    TTable<int32_t,Lambda DAS_COMMENT((void,char * const ))> const  & __a3_rename_at_125_12 = __a3_rename_at_125_12_ConstRef;
+;
+}
+
+inline void _Func_lambda_thismodule_125_7Tickfinalizer_4ba26625e6bd7079 ( Context * __context__, _lambda_thismodule_125_7 * ____this_rename_at_125_13 )
+{
+    finalize_725c076d4247a0c4(__context__,das_arg<_lambda_thismodule_125_7>::pass(das_deref(__context__,____this_rename_at_125_13,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_125_7 *>::clear(__context__,____this_rename_at_125_13);
+}
+
+inline void finalize_a7c72984b8da787e ( Context * __context__, _lambda_thismodule_117_1 &  ____this_rename_at_117_14 )
+{
+    memset((void*)&(____this_rename_at_117_14), 0, 16);
+}
+
+inline void finalize_2cb5cb3ae2f49b9c ( Context * __context__, _lambda_thismodule_120_2 &  ____this_rename_at_120_15 )
+{
+    memset((void*)&(____this_rename_at_120_15), 0, 16);
+}
+
+inline void finalize_1b16d39290c2e720 ( Context * __context__, _lambda_thismodule_122_3 &  ____this_rename_at_122_16 )
+{
+    memset((void*)&(____this_rename_at_122_16), 0, 16);
+}
+
+inline void finalize_75dd5e83200f623 ( Context * __context__, _lambda_thismodule_125_4 &  ____this_rename_at_125_17 )
+{
+    memset((void*)&(____this_rename_at_125_17), 0, 16);
+}
+
+inline void finalize_34edf3725151503f ( Context * __context__, _lambda_thismodule_132_5 &  ____this_rename_at_132_18 )
+{
+    memset((void*)&(____this_rename_at_132_18), 0, 16);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115 ( Context * __context__, TDim<int32_t,2> &  __a_rename_at_1502_19 )
+{
+    TArray<int32_t> __arr_rename_at_1504_20;das_zero(__arr_rename_at_1504_20);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_20),2);
+    das_copy(das_cast<TDim<int32_t,2>>::cast(das_ref(__context__,__arr_rename_at_1504_20(0,__context__))),__a_rename_at_1502_19);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_20);
+}
+
+inline TArray<int32_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25 ( Context * __context__, TDim<int32_t,1> &  __a_rename_at_1502_21 )
+{
+    TArray<int32_t> __arr_rename_at_1504_22;das_zero(__arr_rename_at_1504_22);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1504_22),1);
+    das_copy(das_cast<TDim<int32_t,1>>::cast(das_ref(__context__,__arr_rename_at_1504_22(0,__context__))),__a_rename_at_1502_21);
+    return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_1504_22);
+}
+
+inline TArray<AAA> _FuncbuiltinTickto_array_moveTick3185538323411982277_3557f5d8868c815a ( Context * __context__, TDim<AAA,2> &  __a_rename_at_1502_23 )
+{
+    TArray<AAA> __arr_rename_at_1504_24;das_zero(__arr_rename_at_1504_24);
+    _FuncbuiltinTickresizeTick4811697762258667383_31c92aa9b7d5c23(__context__,das_arg<TArray<AAA>>::pass(__arr_rename_at_1504_24),2);
+    das_copy(das_cast<TDim<AAA,2>>::cast(das_ref(__context__,__arr_rename_at_1504_24(0,__context__))),__a_rename_at_1502_23);
+    return /* <- */ das_auto_cast_move<TArray<AAA>>::cast(__arr_rename_at_1504_24);
+}
+
+inline TTable<int32_t,int32_t> _FuncbuiltinTickto_table_moveTick5858896087460481804_3f61d9e89af53f34 ( Context * __context__, TDim<TTuple<8,int32_t,int32_t>,2> &  __a_rename_at_1615_25 )
+{
+    TTable<int32_t,int32_t> __tab_rename_at_1616_26;das_zero(__tab_rename_at_1616_26);
+    {
+        bool __need_loop_1618 = true;
+        // x: tuple<int aka keyT;int aka valT>&
+        das_iterator<TDim<TTuple<8,int32_t,int32_t>,2>> __x_iterator(__a_rename_at_1615_25);
+        TTuple<8,int32_t,int32_t> * __x_rename_at_1618_27;
+        __need_loop_1618 = __x_iterator.first(__context__,(__x_rename_at_1618_27)) && __need_loop_1618;
+        for ( ; __need_loop_1618 ; __need_loop_1618 = __x_iterator.next(__context__,(__x_rename_at_1618_27)) )
+        {
+            das_copy(__tab_rename_at_1616_26(das_get_tuple_field<int32_t,0>::get((*__x_rename_at_1618_27)),__context__),das_get_tuple_field<int32_t,4>::get((*__x_rename_at_1618_27)));
+        }
+        __x_iterator.close(__context__,(__x_rename_at_1618_27));
+    };
+    return /* <- */ das_auto_cast_move<TTable<int32_t,int32_t>>::cast(__tab_rename_at_1616_26);
+}
+
+inline TTable<int32_t,Lambda DAS_COMMENT((void,char * const ))> _FuncbuiltinTickto_table_moveTick3493479898590698300_c1c7949ebc2f23fd ( Context * __context__, TTuple<16,int32_t,Lambda DAS_COMMENT((void,char * const ))> &  __a_rename_at_1602_28 )
+{
+    TTable<int32_t,Lambda DAS_COMMENT((void,char * const ))> __tab_rename_at_1603_29;das_zero(__tab_rename_at_1603_29);
+    das_move(__tab_rename_at_1603_29(das_get_tuple_field<int32_t,0>::get(__a_rename_at_1602_28),__context__),das_get_tuple_field<Lambda DAS_COMMENT((void,char * const )),8>::get(__a_rename_at_1602_28));
+    return /* <- */ das_auto_cast_move<TTable<int32_t,Lambda DAS_COMMENT((void,char * const ))>>::cast(__tab_rename_at_1603_29);
+}
+
+inline void _Func_lambda_thismodule_117_1Tickfunction_45cfbeaa986ffbe8 ( Context * __context__, _lambda_thismodule_117_1 &  ____this_rename_at_117_30, char * const  __a_rename_at_117_31 )
+{
+    builtin_print(__a_rename_at_117_31,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Func_lambda_thismodule_117_1Tickfinalizer_f38c92b003ca1953 ( Context * __context__, _lambda_thismodule_117_1 * ____this_rename_at_117_32 )
+{
+    finalize_a7c72984b8da787e(__context__,das_arg<_lambda_thismodule_117_1>::pass(das_deref(__context__,____this_rename_at_117_32,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_117_1 *>::clear(__context__,____this_rename_at_117_32);
+}
+
+inline void _Func_lambda_thismodule_120_2Tickfunction_b36e5775936ddc9e ( Context * __context__, _lambda_thismodule_120_2 &  ____this_rename_at_120_33, char * const  __a_rename_at_120_34 )
+{
+    builtin_print(__a_rename_at_120_34,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Func_lambda_thismodule_120_2Tickfinalizer_572414511821ce8f ( Context * __context__, _lambda_thismodule_120_2 * ____this_rename_at_120_35 )
+{
+    finalize_2cb5cb3ae2f49b9c(__context__,das_arg<_lambda_thismodule_120_2>::pass(das_deref(__context__,____this_rename_at_120_35,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_120_2 *>::clear(__context__,____this_rename_at_120_35);
+}
+
+inline void _Func_lambda_thismodule_122_3Tickfunction_1364c86dba9d9e42 ( Context * __context__, _lambda_thismodule_122_3 &  ____this_rename_at_122_36, char * const  __a_rename_at_122_37 )
+{
+    builtin_print(__a_rename_at_122_37,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Func_lambda_thismodule_122_3Tickfinalizer_b3273d3fbf889dfc ( Context * __context__, _lambda_thismodule_122_3 * ____this_rename_at_122_38 )
+{
+    finalize_1b16d39290c2e720(__context__,das_arg<_lambda_thismodule_122_3>::pass(das_deref(__context__,____this_rename_at_122_38,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_122_3 *>::clear(__context__,____this_rename_at_122_38);
+}
+
+inline void _Func_lambda_thismodule_125_4Tickfunction_f16a0cf59d76838d ( Context * __context__, _lambda_thismodule_125_4 &  ____this_rename_at_125_39, char * const  __a_rename_at_125_40 )
+{
+    builtin_print(__a_rename_at_125_40,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Func_lambda_thismodule_125_4Tickfinalizer_b2cebfdb6f5f8e6c ( Context * __context__, _lambda_thismodule_125_4 * ____this_rename_at_125_41 )
+{
+    finalize_75dd5e83200f623(__context__,das_arg<_lambda_thismodule_125_4>::pass(das_deref(__context__,____this_rename_at_125_41,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_125_4 *>::clear(__context__,____this_rename_at_125_41);
+}
+
+inline void _Func_lambda_thismodule_132_5Tickfunction_620819da6453359 ( Context * __context__, _lambda_thismodule_132_5 &  ____this_rename_at_132_42, char * const  __a_rename_at_132_43 )
+{
+    builtin_print(__a_rename_at_132_43,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Func_lambda_thismodule_132_5Tickfinalizer_e2a31117b15a5229 ( Context * __context__, _lambda_thismodule_132_5 * ____this_rename_at_132_44 )
+{
+    finalize_34edf3725151503f(__context__,das_arg<_lambda_thismodule_132_5>::pass(das_deref(__context__,____this_rename_at_132_44,__FILE__,__LINE__)));
+    das_delete_lambda_struct<_lambda_thismodule_132_5 *>::clear(__context__,____this_rename_at_132_44);
+}
+
+inline void test_int_array_8f0fd30c7b48b477 ( Context * __context__ )
+{
+    TDim<int32_t,2> _temp_make_local_21_14_2; _temp_make_local_21_14_2;
+    TDim<int32_t,1> _temp_make_local_24_14_3; _temp_make_local_24_14_3;
+    TDim<int32_t,1> _temp_make_local_27_14_4; _temp_make_local_27_14_4;
+    TDim<int32_t,3> __i0_rename_at_12_45; das_zero(__i0_rename_at_12_45); das_move(__i0_rename_at_12_45, (([&]() -> TDim<int32_t,3> {
+        TDim<int32_t,3> __mka_12;
+        __mka_12(0,__context__) = 1;
+        __mka_12(1,__context__) = 2;
+        __mka_12(2,__context__) = 1;
+        return __mka_12;
+    })()));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<TDim<int32_t,3> &>::from(__i0_rename_at_12_45), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    TDim<int32_t,3> __i1_rename_at_15_46; das_zero(__i1_rename_at_15_46); das_move(__i1_rename_at_15_46, (([&]() -> TDim<int32_t,3> {
+        TDim<int32_t,3> __mka_15;
+        __mka_15(0,__context__) = 1;
+        __mka_15(1,__context__) = 2;
+        __mka_15(2,__context__) = 1;
+        return __mka_15;
+    })()));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<TDim<int32_t,3> &>::from(__i1_rename_at_15_46), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    TDim<int32_t,3> __i2_rename_at_18_47; das_zero(__i2_rename_at_18_47); das_move(__i2_rename_at_18_47, (([&]() -> TDim<int32_t,3> {
+        TDim<int32_t,3> __mka_18;
+        __mka_18(0,__context__) = 1;
+        __mka_18(1,__context__) = 2;
+        __mka_18(2,__context__) = 1;
+        return __mka_18;
+    })()));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<TDim<int32_t,3> &>::from(__i2_rename_at_18_47), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    TArray<int32_t> __i3_rename_at_21_48; das_zero(__i3_rename_at_21_48); das_move(__i3_rename_at_21_48, _FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+        _temp_make_local_21_14_2(0,__context__) = 1;
+        _temp_make_local_21_14_2(1,__context__) = 2;
+        return _temp_make_local_21_14_2;
+    })()))));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<2>(__tinfo_3, cast<TArray<int32_t> &>::from(__i3_rename_at_21_48), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    TArray<int32_t> __i4_rename_at_24_49; das_zero(__i4_rename_at_24_49); das_move(__i4_rename_at_24_49, _FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25(__context__,das_arg<TDim<int32_t,1>>::pass((([&]() -> TDim<int32_t,1>& {
+        _temp_make_local_24_14_3(0,__context__) = 1;
+        return _temp_make_local_24_14_3;
+    })()))));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<2>(__tinfo_3, cast<TArray<int32_t> &>::from(__i4_rename_at_24_49), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    TArray<int32_t> __i5_rename_at_27_50; das_zero(__i5_rename_at_27_50); das_move(__i5_rename_at_27_50, _FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25(__context__,das_arg<TDim<int32_t,1>>::pass((([&]() -> TDim<int32_t,1>& {
+        _temp_make_local_27_14_4(0,__context__) = 1;
+        return _temp_make_local_27_14_4;
+    })()))));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<2>(__tinfo_3, cast<TArray<int32_t> &>::from(__i5_rename_at_27_50), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    int32_t __x_rename_at_30_51 = ((int32_t)__i0_rename_at_12_45(__i1_rename_at_15_46(__i2_rename_at_18_47(0,__context__),__context__),__context__));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<2>(__tinfo_6, cast<int32_t>::from(__x_rename_at_30_51), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void test_structure_init_57d2d7f0b26d0aba ( Context * __context__ )
+{
+    TDim<AAA,2> _temp_make_local_36_13_5; _temp_make_local_36_13_5;
+    TDim<AAA,2> _temp_make_local_43_13_6; _temp_make_local_43_13_6;
+    TDim<AAA,2> _temp_make_local_50_14_7; _temp_make_local_50_14_7;
+    TDim<AAA,2> _temp_make_local_56_14_8; _temp_make_local_56_14_8;
+    TDim<AAA,2> _temp_make_local_74_13_9; _temp_make_local_74_13_9;
+    TDim<AAA,2> _temp_make_local_80_13_10; _temp_make_local_80_13_10;
+    TArray<AAA> __a_rename_at_36_52; das_zero(__a_rename_at_36_52); das_move(__a_rename_at_36_52, _FuncbuiltinTickto_array_moveTick3185538323411982277_3557f5d8868c815a(__context__,das_arg<TDim<AAA,2>>::pass((([&]() -> TDim<AAA,2>& {
+        _temp_make_local_36_13_5(0,__context__) = (([&]() -> AAA {
+            AAA __mks_37 = AAA_74d9951fb0a8f4f3(__context__);
+            das_copy((__mks_37.x),(1));
+            das_copy((__mks_37.y),(2));
+            return __mks_37;
+        })());
+        _temp_make_local_36_13_5(1,__context__) = (([&]() -> AAA {
+            AAA __mks_38 = AAA_74d9951fb0a8f4f3(__context__);
+            das_copy((__mks_38.x),(3));
+            das_copy((__mks_38.y),(4));
+            return __mks_38;
+        })());
+        return _temp_make_local_36_13_5;
+    })()))));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<2>(__tinfo_7, cast<TArray<AAA> &>::from(__a_rename_at_36_52), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    TArray<AAA> __b_rename_at_43_53; das_zero(__b_rename_at_43_53); das_move(__b_rename_at_43_53, _FuncbuiltinTickto_array_moveTick3185538323411982277_3557f5d8868c815a(__context__,das_arg<TDim<AAA,2>>::pass((([&]() -> TDim<AAA,2>& {
+        _temp_make_local_43_13_6(0,__context__) = (([&]() -> AAA {
+            AAA __mks_44 = AAA_74d9951fb0a8f4f3(__context__);
+            das_copy((__mks_44.x),(1));
+            das_copy((__mks_44.y),(2));
+            return __mks_44;
+        })());
+        _temp_make_local_43_13_6(1,__context__) = (([&]() -> AAA {
+            AAA __mks_45 = AAA_74d9951fb0a8f4f3(__context__);
+            das_copy((__mks_45.x),(3));
+            das_copy((__mks_45.y),(4));
+            return __mks_45;
+        })());
+        return _temp_make_local_43_13_6;
+    })()))));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<2>(__tinfo_7, cast<TArray<AAA> &>::from(__b_rename_at_43_53), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    TArray<AAA> __ad_rename_at_50_54; das_zero(__ad_rename_at_50_54); das_move(__ad_rename_at_50_54, _FuncbuiltinTickto_array_moveTick3185538323411982277_3557f5d8868c815a(__context__,das_arg<TDim<AAA,2>>::pass((([&]() -> TDim<AAA,2>& {
+        _temp_make_local_50_14_7(0,__context__) = (([&]() -> AAA {
+            AAA __mks_50 = AAA_74d9951fb0a8f4f3(__context__);
+            das_copy((__mks_50.x),(1));
+            das_copy((__mks_50.y),(2));
+            return __mks_50;
+        })());
+        _temp_make_local_50_14_7(1,__context__) = (([&]() -> AAA {
+            AAA __mks_51 = AAA_74d9951fb0a8f4f3(__context__);
+            das_copy((__mks_51.x),(3));
+            das_copy((__mks_51.y),(4));
+            return __mks_51;
+        })());
+        return _temp_make_local_50_14_7;
+    })()))));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<2>(__tinfo_7, cast<TArray<AAA> &>::from(__ad_rename_at_50_54), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    TArray<AAA> __bd_rename_at_56_55; das_zero(__bd_rename_at_56_55); das_move(__bd_rename_at_56_55, _FuncbuiltinTickto_array_moveTick3185538323411982277_3557f5d8868c815a(__context__,das_arg<TDim<AAA,2>>::pass((([&]() -> TDim<AAA,2>& {
+        _temp_make_local_56_14_8(0,__context__) = (([&]() -> AAA {
+            AAA __mks_56 = AAA_74d9951fb0a8f4f3(__context__);
+            das_copy((__mks_56.x),(1));
+            das_copy((__mks_56.y),(2));
+            return __mks_56;
+        })());
+        _temp_make_local_56_14_8(1,__context__) = (([&]() -> AAA {
+            AAA __mks_57 = AAA_74d9951fb0a8f4f3(__context__);
+            das_copy((__mks_57.x),(3));
+            das_copy((__mks_57.y),(4));
+            return __mks_57;
+        })());
+        return _temp_make_local_56_14_8;
+    })()))));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<2>(__tinfo_7, cast<TArray<AAA> &>::from(__bd_rename_at_56_55), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    AAA __c_rename_at_62_56; das_zero(__c_rename_at_62_56); das_move(__c_rename_at_62_56, (([&]() -> AAA {
+        AAA __mks_62 = AAA_74d9951fb0a8f4f3(__context__);
+        das_copy((__mks_62.x),(1));
+        das_copy((__mks_62.y),(2));
+        return __mks_62;
+    })()));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<2>(__tinfo_11, cast<AAA &>::from(__c_rename_at_62_56), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    AAA __d_rename_at_68_57; das_zero(__d_rename_at_68_57); das_move(__d_rename_at_68_57, (([&]() -> AAA {
+        AAA __mks_68 = AAA_74d9951fb0a8f4f3(__context__);
+        das_copy((__mks_68.x),(1));
+        das_copy((__mks_68.y),(2));
+        return __mks_68;
+    })()));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<2>(__tinfo_11, cast<AAA &>::from(__d_rename_at_68_57), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    TArray<AAA> __e_rename_at_74_58; das_zero(__e_rename_at_74_58); das_move(__e_rename_at_74_58, _FuncbuiltinTickto_array_moveTick3185538323411982277_3557f5d8868c815a(__context__,das_arg<TDim<AAA,2>>::pass((([&]() -> TDim<AAA,2>& {
+        _temp_make_local_74_13_9(0,__context__) = (([&]() -> AAA {
+            AAA __mks_74 = AAA_74d9951fb0a8f4f3(__context__);
+            das_copy((__mks_74.x),(111));
+            das_copy((__mks_74.y),(222));
+            return __mks_74;
+        })());
+        _temp_make_local_74_13_9(1,__context__) = (([&]() -> AAA {
+            AAA __mks_74 = AAA_74d9951fb0a8f4f3(__context__);
+            das_copy((__mks_74.x),(333));
+            das_copy((__mks_74.y),(444));
+            return __mks_74;
+        })());
+        return _temp_make_local_74_13_9;
+    })()))));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<2>(__tinfo_7, cast<TArray<AAA> &>::from(__e_rename_at_74_58), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    DAS_ASSERT((__e_rename_at_74_58(1,__context__).y == 444));
+    TArray<AAA> __f_rename_at_80_59; das_zero(__f_rename_at_80_59); das_move(__f_rename_at_80_59, _FuncbuiltinTickto_array_moveTick3185538323411982277_3557f5d8868c815a(__context__,das_arg<TDim<AAA,2>>::pass((([&]() -> TDim<AAA,2>& {
+        _temp_make_local_80_13_10(0,__context__) = (([&]() -> AAA {
+            AAA __mks_80 = AAA_74d9951fb0a8f4f3(__context__);
+            das_copy((__mks_80.x),(111));
+            das_copy((__mks_80.y),(222));
+            return __mks_80;
+        })());
+        _temp_make_local_80_13_10(1,__context__) = (([&]() -> AAA {
+            AAA __mks_82 = AAA_74d9951fb0a8f4f3(__context__);
+            das_copy((__mks_82.x),(333));
+            das_copy((__mks_82.y),(444));
+            return __mks_82;
+        })());
+        return _temp_make_local_80_13_10;
+    })()))));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<2>(__tinfo_7, cast<TArray<AAA> &>::from(__f_rename_at_80_59), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    DAS_ASSERT((__f_rename_at_80_59(1,__context__).y == 444));
+}
+
+inline void test_table_init_9fe45597092ab347 ( Context * __context__ )
+{
+    TDim<TTuple<8,int32_t,int32_t>,2> _temp_make_local_91_14_11; _temp_make_local_91_14_11;
+    TTable<int32_t,int32_t> __t0_rename_at_91_60; das_zero(__t0_rename_at_91_60); das_move(__t0_rename_at_91_60, _FuncbuiltinTickto_table_moveTick5858896087460481804_3f61d9e89af53f34(__context__,das_arg<TDim<TTuple<8,int32_t,int32_t>,2>>::pass((([&]() -> TDim<TTuple<8,int32_t,int32_t>,2>& {
+        _temp_make_local_91_14_11(0,__context__) = (([&]() -> TTuple<8,int32_t,int32_t> {
+            TTuple<8,int32_t,int32_t> __mkt_92;
+            das_get_tuple_field<int32_t,0>::get(__mkt_92) = 1;
+            das_get_tuple_field<int32_t,4>::get(__mkt_92) = 111;
+            return __mkt_92;
+        })());
+        _temp_make_local_91_14_11(1,__context__) = (([&]() -> TTuple<8,int32_t,int32_t> {
+            TTuple<8,int32_t,int32_t> __mkt_93;
+            das_get_tuple_field<int32_t,0>::get(__mkt_93) = 2;
+            das_get_tuple_field<int32_t,4>::get(__mkt_93) = 222;
+            return __mkt_93;
+        })());
+        return _temp_make_local_91_14_11;
+    })()))));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<2>(__tinfo_15, cast<TTable<int32_t,int32_t> &>::from(__t0_rename_at_91_60), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void test_blocks_3e8325da4b9a6290 ( Context * __context__ )
+{
+    builtin_print(((char *) "12\n"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    builtin_print(((char *) "12\n"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    builtin_print(((char *) "12\n"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void test_mixed_blocks_21593d576a75751d ( Context * __context__ )
+{
+    TTuple<16,int32_t,Lambda DAS_COMMENT((void,char * const ))> _temp_make_local_117_18_12; _temp_make_local_117_18_12;
+    TTuple<16,int32_t,Lambda DAS_COMMENT((void,char * const ))> _temp_make_local_120_29_13; _temp_make_local_120_29_13;
+    TTuple<16,int32_t,Lambda DAS_COMMENT((void,char * const ))> _temp_make_local_122_18_14; _temp_make_local_122_18_14;
+    TTuple<16,int32_t,Lambda DAS_COMMENT((void,char * const ))> _temp_make_local_125_18_15; _temp_make_local_125_18_15;
+    TTable<int32_t,Lambda DAS_COMMENT((void,char * const ))> __a0_rename_at_117_61_ConstRef; das_zero(__a0_rename_at_117_61_ConstRef); das_move(__a0_rename_at_117_61_ConstRef, ((TTable<int32_t,Lambda DAS_COMMENT((void,char * const ))>)_FuncbuiltinTickto_table_moveTick3493479898590698300_c1c7949ebc2f23fd(__context__,das_arg<TTuple<16,int32_t,Lambda DAS_COMMENT((void,char * const ))>>::pass((([&]() -> TTuple<16,int32_t,Lambda DAS_COMMENT((void,char * const ))>& {
+        das_get_tuple_field<int32_t,0>::get(_temp_make_local_117_18_12) = 1;
+        das_get_tuple_field<Lambda DAS_COMMENT((void,char * const )),8>::get(_temp_make_local_117_18_12) = das_ascend<void,_lambda_thismodule_117_1>::make(__context__,&__type_info__14547aa8b8b420aa,(([&]() -> _lambda_thismodule_117_1 {
+            _lambda_thismodule_117_1 __mks_117;
+            das_copy((__mks_117.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_117_1`function XS<_lambda_thismodule_117_1> Cs*/ 0xe79ef437cc295cd2))));
+            das_copy((__mks_117.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_117_1`finalizer X1<S<_lambda_thismodule_117_1>>?*/ 0x9787b728c3c7fd02))));
+            return __mks_117;
+        })()));
+        return _temp_make_local_117_18_12;
+    })())))));
+    TTable<int32_t,Lambda DAS_COMMENT((void,char * const ))> const  & __a0_rename_at_117_61 = __a0_rename_at_117_61_ConstRef;
+;
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<2>(__tinfo_16, cast<TTable<int32_t,Lambda DAS_COMMENT((void,char * const ))> const  &>::from(__a0_rename_at_117_61), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    TTable<int32_t,Lambda DAS_COMMENT((void,char * const ))> __a1_rename_at_120_62_ConstRef; das_zero(__a1_rename_at_120_62_ConstRef); das_move(__a1_rename_at_120_62_ConstRef, ((TTable<int32_t,Lambda DAS_COMMENT((void,char * const ))>)_FuncbuiltinTickto_table_moveTick3493479898590698300_c1c7949ebc2f23fd(__context__,das_arg<TTuple<16,int32_t,Lambda DAS_COMMENT((void,char * const ))>>::pass((([&]() -> TTuple<16,int32_t,Lambda DAS_COMMENT((void,char * const ))>& {
+        das_get_tuple_field<int32_t,0>::get(_temp_make_local_120_29_13) = 1;
+        das_get_tuple_field<Lambda DAS_COMMENT((void,char * const )),8>::get(_temp_make_local_120_29_13) = das_ascend<void,_lambda_thismodule_120_2>::make(__context__,&__type_info__998a259a6c6b153b,(([&]() -> _lambda_thismodule_120_2 {
+            _lambda_thismodule_120_2 __mks_120;
+            das_copy((__mks_120.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_120_2`function XS<_lambda_thismodule_120_2> Cs*/ 0xbebe5a170928f6b1))));
+            das_copy((__mks_120.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_120_2`finalizer X1<S<_lambda_thismodule_120_2>>?*/ 0x48c36dc5304ef176))));
+            return __mks_120;
+        })()));
+        return _temp_make_local_120_29_13;
+    })())))));
+    TTable<int32_t,Lambda DAS_COMMENT((void,char * const ))> const  & __a1_rename_at_120_62 = __a1_rename_at_120_62_ConstRef;
+;
+    TTable<int32_t,Lambda DAS_COMMENT((void,char * const ))> __a2_rename_at_122_63_ConstRef; das_zero(__a2_rename_at_122_63_ConstRef); das_move(__a2_rename_at_122_63_ConstRef, ((TTable<int32_t,Lambda DAS_COMMENT((void,char * const ))>)_FuncbuiltinTickto_table_moveTick3493479898590698300_c1c7949ebc2f23fd(__context__,das_arg<TTuple<16,int32_t,Lambda DAS_COMMENT((void,char * const ))>>::pass((([&]() -> TTuple<16,int32_t,Lambda DAS_COMMENT((void,char * const ))>& {
+        das_get_tuple_field<int32_t,0>::get(_temp_make_local_122_18_14) = 1;
+        das_get_tuple_field<Lambda DAS_COMMENT((void,char * const )),8>::get(_temp_make_local_122_18_14) = das_ascend<void,_lambda_thismodule_122_6>::make(__context__,&__type_info__d9d4259040089f3b,(([&]() -> _lambda_thismodule_122_6 {
+            _lambda_thismodule_122_6 __mks_122;
+            das_copy((__mks_122.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_122_6`function XS<_lambda_thismodule_122_6> Cs*/ 0x373abf8281785523))));
+            das_copy((__mks_122.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_122_6`finalizer X1<S<_lambda_thismodule_122_6>>?*/ 0xd9d2dc4553d56976))));
+            return __mks_122;
+        })()));
+        return _temp_make_local_122_18_14;
+    })())))));
+    TTable<int32_t,Lambda DAS_COMMENT((void,char * const ))> const  & __a2_rename_at_122_63 = __a2_rename_at_122_63_ConstRef;
+;
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<2>(__tinfo_16, cast<TTable<int32_t,Lambda DAS_COMMENT((void,char * const ))> const  &>::from(__a2_rename_at_122_63), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    TTable<int32_t,Lambda DAS_COMMENT((void,char * const ))> __a3_rename_at_125_64_ConstRef; das_zero(__a3_rename_at_125_64_ConstRef); das_move(__a3_rename_at_125_64_ConstRef, ((TTable<int32_t,Lambda DAS_COMMENT((void,char * const ))>)_FuncbuiltinTickto_table_moveTick3493479898590698300_c1c7949ebc2f23fd(__context__,das_arg<TTuple<16,int32_t,Lambda DAS_COMMENT((void,char * const ))>>::pass((([&]() -> TTuple<16,int32_t,Lambda DAS_COMMENT((void,char * const ))>& {
+        das_get_tuple_field<int32_t,0>::get(_temp_make_local_125_18_15) = 1;
+        das_get_tuple_field<Lambda DAS_COMMENT((void,char * const )),8>::get(_temp_make_local_125_18_15) = das_ascend<void,_lambda_thismodule_125_7>::make(__context__,&__type_info__841b25b1c5389b3b,(([&]() -> _lambda_thismodule_125_7 {
+            _lambda_thismodule_125_7 __mks_125;
+            das_copy((__mks_125.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_125_7`function XS<_lambda_thismodule_125_7> Cs*/ 0xda3dd59a9a7001bf))));
+            das_copy((__mks_125.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_125_7`finalizer X1<S<_lambda_thismodule_125_7>>?*/ 0xbb4accae5cc68f76))));
+            return __mks_125;
+        })()));
+        return _temp_make_local_125_18_15;
+    })())))));
+    TTable<int32_t,Lambda DAS_COMMENT((void,char * const ))> const  & __a3_rename_at_125_64 = __a3_rename_at_125_64_ConstRef;
+;
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<2>(__tinfo_16, cast<TTable<int32_t,Lambda DAS_COMMENT((void,char * const ))> const  &>::from(__a2_rename_at_122_63), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void test_string_interpolation_505e64bd947ccd6f ( Context * __context__ )
+{
+    builtin_print(((char *) "1\n"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<2>(__tinfo_19, cast<Lambda DAS_COMMENT((void,char * const ))>::from(das_ascend<void,_lambda_thismodule_132_5>::make(__context__,&__type_info__e3af4c9045f428c0,(([&]() -> _lambda_thismodule_132_5 {
+        _lambda_thismodule_132_5 __mks_132;
+        das_copy((__mks_132.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_132_5`function XS<_lambda_thismodule_132_5> Cs*/ 0xccbb0e901c09b059))));
+        das_copy((__mks_132.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_132_5`finalizer X1<S<_lambda_thismodule_132_5>>?*/ 0xeda5f76f2a03de52))));
+        return __mks_132;
+    })()))), cast<char * const >::from(((char *) "\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline bool test_fb64e3c7e3f6f098 ( Context * __context__ )
+{
+    test_int_array_8f0fd30c7b48b477(__context__);
+    test_structure_init_57d2d7f0b26d0aba(__context__);
+    test_table_init_9fe45597092ab347(__context__);
+    test_blocks_3e8325da4b9a6290(__context__);
+    test_mixed_blocks_21593d576a75751d(__context__);
+    test_string_interpolation_505e64bd947ccd6f(__context__);
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline AAA AAA_74d9951fb0a8f4f3 ( Context * __context__ )
+{
+    return /* <- */ das_auto_cast_move<AAA>::cast((([&]() -> AAA {
+        AAA __mks_5;
+        das_copy((__mks_5.x),(1));
+        das_copy((__mks_5.y),(1));
+        return __mks_5;
+    })()));
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_31c92aa9b7d5c23 ( Context * __context__ ) {
+    TArray<AAA> &  arg_Arr = cast_aot_arg<TArray<AAA> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_31c92aa9b7d5c23(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap_finalize_2845d8c623782b62 ( Context * __context__ ) {
+    _lambda_thismodule_122_6 &  arg___this = cast_aot_arg<_lambda_thismodule_122_6 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_2845d8c623782b62(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_725c076d4247a0c4 ( Context * __context__ ) {
+    _lambda_thismodule_125_7 &  arg___this = cast_aot_arg<_lambda_thismodule_125_7 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_725c076d4247a0c4(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_122_6Tickfunction_c29619788ec92f9a ( Context * __context__ ) {
+    _lambda_thismodule_122_6 &  arg___this = cast_aot_arg<_lambda_thismodule_122_6 & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_a = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    _Func_lambda_thismodule_122_6Tickfunction_c29619788ec92f9a(__context__, arg___this, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_122_6Tickfinalizer_17d4f93f1713d08a ( Context * __context__ ) {
+    _lambda_thismodule_122_6 * arg___this = cast_aot_arg<_lambda_thismodule_122_6 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_122_6Tickfinalizer_17d4f93f1713d08a(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_125_7Tickfunction_74d78ce3485657a7 ( Context * __context__ ) {
+    _lambda_thismodule_125_7 &  arg___this = cast_aot_arg<_lambda_thismodule_125_7 & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_a = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    _Func_lambda_thismodule_125_7Tickfunction_74d78ce3485657a7(__context__, arg___this, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_125_7Tickfinalizer_4ba26625e6bd7079 ( Context * __context__ ) {
+    _lambda_thismodule_125_7 * arg___this = cast_aot_arg<_lambda_thismodule_125_7 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_125_7Tickfinalizer_4ba26625e6bd7079(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_a7c72984b8da787e ( Context * __context__ ) {
+    _lambda_thismodule_117_1 &  arg___this = cast_aot_arg<_lambda_thismodule_117_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_a7c72984b8da787e(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_2cb5cb3ae2f49b9c ( Context * __context__ ) {
+    _lambda_thismodule_120_2 &  arg___this = cast_aot_arg<_lambda_thismodule_120_2 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_2cb5cb3ae2f49b9c(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_1b16d39290c2e720 ( Context * __context__ ) {
+    _lambda_thismodule_122_3 &  arg___this = cast_aot_arg<_lambda_thismodule_122_3 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_1b16d39290c2e720(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_75dd5e83200f623 ( Context * __context__ ) {
+    _lambda_thismodule_125_4 &  arg___this = cast_aot_arg<_lambda_thismodule_125_4 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_75dd5e83200f623(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_34edf3725151503f ( Context * __context__ ) {
+    _lambda_thismodule_132_5 &  arg___this = cast_aot_arg<_lambda_thismodule_132_5 & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_34edf3725151503f(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115 ( Context * __context__ ) {
+    TDim<int32_t,2> &  arg_a = cast_aot_arg<TDim<int32_t,2> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25 ( Context * __context__ ) {
+    TDim<int32_t,1> &  arg_a = cast_aot_arg<TDim<int32_t,1> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_3557f5d8868c815a ( Context * __context__ ) {
+    TDim<AAA,2> &  arg_a = cast_aot_arg<TDim<AAA,2> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<AAA> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_3557f5d8868c815a(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_table_moveTick5858896087460481804_3f61d9e89af53f34 ( Context * __context__ ) {
+    TDim<TTuple<8,int32_t,int32_t>,2> &  arg_a = cast_aot_arg<TDim<TTuple<8,int32_t,int32_t>,2> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TTable<int32_t,int32_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_table_moveTick5858896087460481804_3f61d9e89af53f34(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_table_moveTick3493479898590698300_c1c7949ebc2f23fd ( Context * __context__ ) {
+    TTuple<16,int32_t,Lambda DAS_COMMENT((void,char * const ))> &  arg_a = cast_aot_arg<TTuple<16,int32_t,Lambda DAS_COMMENT((void,char * const ))> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TTable<int32_t,Lambda DAS_COMMENT((void,char * const ))> *) __context__->abiCMRES) = _FuncbuiltinTickto_table_moveTick3493479898590698300_c1c7949ebc2f23fd(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_117_1Tickfunction_45cfbeaa986ffbe8 ( Context * __context__ ) {
+    _lambda_thismodule_117_1 &  arg___this = cast_aot_arg<_lambda_thismodule_117_1 & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_a = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    _Func_lambda_thismodule_117_1Tickfunction_45cfbeaa986ffbe8(__context__, arg___this, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_117_1Tickfinalizer_f38c92b003ca1953 ( Context * __context__ ) {
+    _lambda_thismodule_117_1 * arg___this = cast_aot_arg<_lambda_thismodule_117_1 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_117_1Tickfinalizer_f38c92b003ca1953(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_120_2Tickfunction_b36e5775936ddc9e ( Context * __context__ ) {
+    _lambda_thismodule_120_2 &  arg___this = cast_aot_arg<_lambda_thismodule_120_2 & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_a = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    _Func_lambda_thismodule_120_2Tickfunction_b36e5775936ddc9e(__context__, arg___this, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_120_2Tickfinalizer_572414511821ce8f ( Context * __context__ ) {
+    _lambda_thismodule_120_2 * arg___this = cast_aot_arg<_lambda_thismodule_120_2 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_120_2Tickfinalizer_572414511821ce8f(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_122_3Tickfunction_1364c86dba9d9e42 ( Context * __context__ ) {
+    _lambda_thismodule_122_3 &  arg___this = cast_aot_arg<_lambda_thismodule_122_3 & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_a = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    _Func_lambda_thismodule_122_3Tickfunction_1364c86dba9d9e42(__context__, arg___this, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_122_3Tickfinalizer_b3273d3fbf889dfc ( Context * __context__ ) {
+    _lambda_thismodule_122_3 * arg___this = cast_aot_arg<_lambda_thismodule_122_3 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_122_3Tickfinalizer_b3273d3fbf889dfc(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_125_4Tickfunction_f16a0cf59d76838d ( Context * __context__ ) {
+    _lambda_thismodule_125_4 &  arg___this = cast_aot_arg<_lambda_thismodule_125_4 & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_a = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    _Func_lambda_thismodule_125_4Tickfunction_f16a0cf59d76838d(__context__, arg___this, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_125_4Tickfinalizer_b2cebfdb6f5f8e6c ( Context * __context__ ) {
+    _lambda_thismodule_125_4 * arg___this = cast_aot_arg<_lambda_thismodule_125_4 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_125_4Tickfinalizer_b2cebfdb6f5f8e6c(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_132_5Tickfunction_620819da6453359 ( Context * __context__ ) {
+    _lambda_thismodule_132_5 &  arg___this = cast_aot_arg<_lambda_thismodule_132_5 & >::to(*__context__,__context__->abiArguments()[0]);
+    char * const  arg_a = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[1]);
+    _Func_lambda_thismodule_132_5Tickfunction_620819da6453359(__context__, arg___this, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__Func_lambda_thismodule_132_5Tickfinalizer_e2a31117b15a5229 ( Context * __context__ ) {
+    _lambda_thismodule_132_5 * arg___this = cast_aot_arg<_lambda_thismodule_132_5 *>::to(*__context__,__context__->abiArguments()[0]);
+    _Func_lambda_thismodule_132_5Tickfinalizer_e2a31117b15a5229(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_test_int_array_8f0fd30c7b48b477 ( Context * __context__ ) {
+    test_int_array_8f0fd30c7b48b477(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_structure_init_57d2d7f0b26d0aba ( Context * __context__ ) {
+    test_structure_init_57d2d7f0b26d0aba(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_table_init_9fe45597092ab347 ( Context * __context__ ) {
+    test_table_init_9fe45597092ab347(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_blocks_3e8325da4b9a6290 ( Context * __context__ ) {
+    test_blocks_3e8325da4b9a6290(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_mixed_blocks_21593d576a75751d ( Context * __context__ ) {
+    test_mixed_blocks_21593d576a75751d(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_string_interpolation_505e64bd947ccd6f ( Context * __context__ ) {
+    test_string_interpolation_505e64bd947ccd6f(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_fb64e3c7e3f6f098 ( Context * __context__ ) {
+    return cast<bool>::from(test_fb64e3c7e3f6f098(__context__));
+}
+static vec4f __wrap_AAA_74d9951fb0a8f4f3 ( Context * __context__ ) {
+    *((AAA *) __context__->abiCMRES) = AAA_74d9951fb0a8f4f3(__context__);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xa51a880d594e91fd, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c },
+    { 0xecb9ba6c8bc10ddf, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_31c92aa9b7d5c23, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_31c92aa9b7d5c23 },
+    { 0x8007fde54398cf2b, false, (void*)&finalize_2845d8c623782b62, &__wrap_finalize_2845d8c623782b62 },
+    { 0x3cd09666e1d4fefb, false, (void*)&finalize_725c076d4247a0c4, &__wrap_finalize_725c076d4247a0c4 },
+    { 0xee858e2843c8518a, false, (void*)&_Func_lambda_thismodule_122_6Tickfunction_c29619788ec92f9a, &__wrap__Func_lambda_thismodule_122_6Tickfunction_c29619788ec92f9a },
+    { 0xe3fd086596d7a248, false, (void*)&_Func_lambda_thismodule_122_6Tickfinalizer_17d4f93f1713d08a, &__wrap__Func_lambda_thismodule_122_6Tickfinalizer_17d4f93f1713d08a },
+    { 0xe3dba0ceb5061a78, false, (void*)&_Func_lambda_thismodule_125_7Tickfunction_74d78ce3485657a7, &__wrap__Func_lambda_thismodule_125_7Tickfunction_74d78ce3485657a7 },
+    { 0x22f2e30d2d4a2667, false, (void*)&_Func_lambda_thismodule_125_7Tickfinalizer_4ba26625e6bd7079, &__wrap__Func_lambda_thismodule_125_7Tickfinalizer_4ba26625e6bd7079 },
+    { 0xae46ef039b44dd6e, false, (void*)&finalize_a7c72984b8da787e, &__wrap_finalize_a7c72984b8da787e },
+    { 0xcf9d6cea413c94b4, false, (void*)&finalize_2cb5cb3ae2f49b9c, &__wrap_finalize_2cb5cb3ae2f49b9c },
+    { 0xf4736c0f37828dc4, false, (void*)&finalize_1b16d39290c2e720, &__wrap_finalize_1b16d39290c2e720 },
+    { 0xe0ebe4b70a8ad54e, false, (void*)&finalize_75dd5e83200f623, &__wrap_finalize_75dd5e83200f623 },
+    { 0xd6bc7e6445d6c966, false, (void*)&finalize_34edf3725151503f, &__wrap_finalize_34edf3725151503f },
+    { 0x5c51cb37e0913516, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_c2c4c03ce5e8d115 },
+    { 0x53b0d27e2411836, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_52b98a49974c1e25 },
+    { 0x8e783de76b0a5fd2, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_3557f5d8868c815a, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_3557f5d8868c815a },
+    { 0x8b7f15559c57ee78, true, (void*)&_FuncbuiltinTickto_table_moveTick5858896087460481804_3f61d9e89af53f34, &__wrap__FuncbuiltinTickto_table_moveTick5858896087460481804_3f61d9e89af53f34 },
+    { 0xb612043839338dfc, true, (void*)&_FuncbuiltinTickto_table_moveTick3493479898590698300_c1c7949ebc2f23fd, &__wrap__FuncbuiltinTickto_table_moveTick3493479898590698300_c1c7949ebc2f23fd },
+    { 0xc977b07cabc5346c, false, (void*)&_Func_lambda_thismodule_117_1Tickfunction_45cfbeaa986ffbe8, &__wrap__Func_lambda_thismodule_117_1Tickfunction_45cfbeaa986ffbe8 },
+    { 0x91cba87d8bace5e2, false, (void*)&_Func_lambda_thismodule_117_1Tickfinalizer_f38c92b003ca1953, &__wrap__Func_lambda_thismodule_117_1Tickfinalizer_f38c92b003ca1953 },
+    { 0xecd83de7a37352ac, false, (void*)&_Func_lambda_thismodule_120_2Tickfunction_b36e5775936ddc9e, &__wrap__Func_lambda_thismodule_120_2Tickfunction_b36e5775936ddc9e },
+    { 0x2463b06b1311971a, false, (void*)&_Func_lambda_thismodule_120_2Tickfinalizer_572414511821ce8f, &__wrap__Func_lambda_thismodule_120_2Tickfinalizer_572414511821ce8f },
+    { 0x99c823e885229b67, false, (void*)&_Func_lambda_thismodule_122_3Tickfunction_1364c86dba9d9e42, &__wrap__Func_lambda_thismodule_122_3Tickfunction_1364c86dba9d9e42 },
+    { 0xf5ad94dee67700e9, false, (void*)&_Func_lambda_thismodule_122_3Tickfinalizer_b3273d3fbf889dfc, &__wrap__Func_lambda_thismodule_122_3Tickfinalizer_b3273d3fbf889dfc },
+    { 0x8efa223ca7ed2fb4, false, (void*)&_Func_lambda_thismodule_125_4Tickfunction_f16a0cf59d76838d, &__wrap__Func_lambda_thismodule_125_4Tickfunction_f16a0cf59d76838d },
+    { 0xf7cca62b0d7b50d8, false, (void*)&_Func_lambda_thismodule_125_4Tickfinalizer_b2cebfdb6f5f8e6c, &__wrap__Func_lambda_thismodule_125_4Tickfinalizer_b2cebfdb6f5f8e6c },
+    { 0xcbb206a12349dcd0, false, (void*)&_Func_lambda_thismodule_132_5Tickfunction_620819da6453359, &__wrap__Func_lambda_thismodule_132_5Tickfunction_620819da6453359 },
+    { 0x2af2fd4850e364bf, false, (void*)&_Func_lambda_thismodule_132_5Tickfinalizer_e2a31117b15a5229, &__wrap__Func_lambda_thismodule_132_5Tickfinalizer_e2a31117b15a5229 },
+    { 0xf39314cd369398d0, false, (void*)&test_int_array_8f0fd30c7b48b477, &__wrap_test_int_array_8f0fd30c7b48b477 },
+    { 0x9a9db540935cba2b, false, (void*)&test_structure_init_57d2d7f0b26d0aba, &__wrap_test_structure_init_57d2d7f0b26d0aba },
+    { 0xfb44dee114240564, false, (void*)&test_table_init_9fe45597092ab347, &__wrap_test_table_init_9fe45597092ab347 },
+    { 0x6d25813dda52c694, false, (void*)&test_blocks_3e8325da4b9a6290, &__wrap_test_blocks_3e8325da4b9a6290 },
+    { 0x1bbd90042132de62, false, (void*)&test_mixed_blocks_21593d576a75751d, &__wrap_test_mixed_blocks_21593d576a75751d },
+    { 0x474db6a5795f5e97, false, (void*)&test_string_interpolation_505e64bd947ccd6f, &__wrap_test_string_interpolation_505e64bd947ccd6f },
+    { 0x59000c445356252d, false, (void*)&test_fb64e3c7e3f6f098, &__wrap_test_fb64e3c7e3f6f098 },
+    { 0x43093def22db16da, true, (void*)&AAA_74d9951fb0a8f4f3, &__wrap_AAA_74d9951fb0a8f4f3 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_15901767823422641606
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,454 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_13732552751705923159 {
+
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__bcb97beea857e3e;
+extern TypeInfo __type_info__c4e7914a3746eb3e;
+extern TypeInfo __type_info__a3f0477a4765213e;
+extern TypeInfo __type_info__af63e44c8601fa24;
+
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__bcb97beea857e3e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xbcb97beea857e3e) };
+TypeInfo __type_info__c4e7914a3746eb3e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xc4e7914a3746eb3e) };
+TypeInfo __type_info__a3f0477a4765213e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xa3f0477a4765213e) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__a3f0477a4765213e, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_1[2] = { &__type_info__bcb97beea857e3e, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_2[2] = { &__type_info__c4e7914a3746eb3e, &__type_info__af90fe4c864e9d52 };
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline void _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__, TArray<int32_t> & __a_rename_at_1142_2, TArray<int32_t> const  & __b_rename_at_1142_3 );
+inline TArray<int32_t> & _FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 ( Context * __context__, TArray<int32_t> & __a_rename_at_50_5 );
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd ( Context * __context__, TArray<int32_t> & __a_rename_at_1336_6 );
+inline void _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5 ( Context * __context__, TArray<int32_t> & __a_rename_at_32_7, TArray<int32_t> & __b_rename_at_32_8 );
+inline TTuple<32,int32_t,float,TArray<int32_t>> _FuncbuiltinTickclone_to_moveTick17180087396728260876_914057db79c17b24 ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> & __clone_src_rename_at_1118_9 );
+inline void finalize_5cef76514cdcd502 ( Context * __context__, TTuple<8,int32_t,float> & ____this_rename_at_62_11 );
+inline void _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_177_12, int32_t __value_rename_at_177_13 );
+inline void finalize_6d0d9c0a8099bbf5 ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> & ____this_rename_at_22_14 );
+inline void finalize_b1b8502f42be49c9 ( Context * __context__, TTuple<8,int32_t,float> * & ____this_rename_at_62_15 );
+inline bool testI_a8a1dbfd965b4720 ( Context * __context__, TTuple<8,int32_t,float> const  & __arg_rename_at_4_16 );
+inline bool testF_cf6e8af974a6cacc ( Context * __context__, TTuple<8,int32_t,float> const  & __arg_rename_at_8_17 );
+inline bool testFinalizeAndClone_4527c70f2ccef257 ( Context * __context__ );
+inline bool test_20ee399cf53e5285 ( Context * __context__ );
+inline void clone_947b9332035ab028 ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> & __dest_rename_at_1121_34, TTuple<32,int32_t,float,TArray<int32_t>> const  & __src_rename_at_1121_35 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__, TArray<int32_t> &  __a_rename_at_1142_2, TArray<int32_t> const  &  __b_rename_at_1142_3 )
+{
+    int32_t __ln_rename_at_1143_4 = ((int32_t)builtin_array_size(__b_rename_at_1142_3));
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_1142_2),__ln_rename_at_1143_4);
+    if ( __ln_rename_at_1143_4 == 0 )
+    {
+        return ;
+    } else {
+        das_memcpy(das_auto_cast<void * const >::cast(das_ref(__context__,__a_rename_at_1142_2(0,__context__))),das_auto_cast<void * const >::cast(das_ref(__context__,__b_rename_at_1142_3(0,__context__))),__ln_rename_at_1143_4 * 4);
+    };
+}
+
+inline TArray<int32_t> & _FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 ( Context * __context__, TArray<int32_t> &  __a_rename_at_50_5 )
+{
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<TArray<int32_t> &>::from(__a_rename_at_50_5),cast<char * const >::from(((char *) "object can't be returned because it is locked"))));
+    return das_auto_cast_ref<TArray<int32_t> &>::cast(__a_rename_at_50_5);
+}
+
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd ( Context * __context__, TArray<int32_t> &  __a_rename_at_1336_6 )
+{
+    builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_1336_6),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5 ( Context * __context__, TArray<int32_t> &  __a_rename_at_32_7, TArray<int32_t> &  __b_rename_at_32_8 )
+{
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<TArray<int32_t> &>::from(__a_rename_at_32_7),cast<char * const >::from(((char *) "object can't be moved to because it is locked"))));
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_2,cast<TArray<int32_t> &>::from(__b_rename_at_32_8),cast<char * const >::from(((char *) "object can't be moved from because it is locked"))));
+    das_move(__a_rename_at_32_7,__b_rename_at_32_8);
+}
+
+inline TTuple<32,int32_t,float,TArray<int32_t>> _FuncbuiltinTickclone_to_moveTick17180087396728260876_914057db79c17b24 ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> &  __clone_src_rename_at_1118_9 )
+{
+    TTuple<32,int32_t,float,TArray<int32_t>> __clone_dest_rename_at_1120_10;das_zero(__clone_dest_rename_at_1120_10);
+    clone_947b9332035ab028(__context__,das_arg<TTuple<32,int32_t,float,TArray<int32_t>>>::pass(__clone_dest_rename_at_1120_10),das_arg<TTuple<32,int32_t,float,TArray<int32_t>>>::pass(__clone_src_rename_at_1118_9));
+    return /* <- */ das_auto_cast_move<TTuple<32,int32_t,float,TArray<int32_t>>>::cast(__clone_dest_rename_at_1120_10);
+}
+
+inline void finalize_5cef76514cdcd502 ( Context * __context__, TTuple<8,int32_t,float> &  ____this_rename_at_62_11 )
+{
+    memset((void*)&(____this_rename_at_62_11), 0, 8);
+}
+
+inline void _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_177_12, int32_t __value_rename_at_177_13 )
+{
+    das_copy(__Arr_rename_at_177_12(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_177_12),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_177_13);
+}
+
+inline void finalize_6d0d9c0a8099bbf5 ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> &  ____this_rename_at_22_14 )
+{
+    _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd(__context__,das_arg<TArray<int32_t>>::pass(das_get_tuple_field<TArray<int32_t>,8>::get(____this_rename_at_22_14)));
+    memset((void*)&(____this_rename_at_22_14), 0, 32);
+}
+
+inline void finalize_b1b8502f42be49c9 ( Context * __context__, TTuple<8,int32_t,float> * & ____this_rename_at_62_15 )
+{
+    if ( ____this_rename_at_62_15 != nullptr )
+    {
+        finalize_5cef76514cdcd502(__context__,das_arg<TTuple<8,int32_t,float>>::pass(das_deref(__context__,____this_rename_at_62_15,__FILE__,__LINE__)));
+        das_delete<TTuple<8,int32_t,float> *>::clear(__context__,____this_rename_at_62_15);
+        das_copy(____this_rename_at_62_15,nullptr);
+    };
+}
+
+inline bool testI_a8a1dbfd965b4720 ( Context * __context__, TTuple<8,int32_t,float> const  &  __arg_rename_at_4_16 )
+{
+    return das_auto_cast<bool>::cast(das_get_tuple_field<int32_t,0>::get(__arg_rename_at_4_16) == 1);
+}
+
+inline bool testF_cf6e8af974a6cacc ( Context * __context__, TTuple<8,int32_t,float> const  &  __arg_rename_at_8_17 )
+{
+    return das_auto_cast<bool>::cast(das_get_tuple_field<float,4>::get(__arg_rename_at_8_17) == 3.140000e+00f);
+}
+
+inline bool testFinalizeAndClone_4527c70f2ccef257 ( Context * __context__ )
+{
+    TTuple<32,int32_t,float,TArray<int32_t>> __x_rename_at_13_18;das_zero(__x_rename_at_13_18);
+    das_copy(das_get_tuple_field<int32_t,0>::get(__x_rename_at_13_18),1);
+    das_copy(das_get_tuple_field<float,4>::get(__x_rename_at_13_18),2.000000e+00f);
+    _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5(__context__,das_arg<TArray<int32_t>>::pass(das_get_tuple_field<TArray<int32_t>,8>::get(__x_rename_at_13_18)),das_arg<TArray<int32_t>>::pass(das_invoke<TArray<int32_t>>::invoke_cmres(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> TArray<int32_t>{
+        TArray<int32_t> ____acomp_16_13_rename_at_16_19;das_zero(____acomp_16_13_rename_at_16_19);
+        builtin_set_verify_array_locks(das_arg<TArray<int32_t>>::pass(____acomp_16_13_rename_at_16_19),false);
+        {
+            bool __need_loop_16 = true;
+            // xx: int const
+            das_iterator<range> __xx_iterator(range(0,10));
+            int32_t __xx_rename_at_16_20;
+            __need_loop_16 = __xx_iterator.first(__context__,(__xx_rename_at_16_20)) && __need_loop_16;
+            for ( ; __need_loop_16 ; __need_loop_16 = __xx_iterator.next(__context__,(__xx_rename_at_16_20)) )
+            {
+                _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(____acomp_16_13_rename_at_16_19),__xx_rename_at_16_20);
+            }
+            __xx_iterator.close(__context__,(__xx_rename_at_16_20));
+        };
+        builtin_set_verify_array_locks(das_arg<TArray<int32_t>>::pass(____acomp_16_13_rename_at_16_19),true);
+        return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14(__context__,das_arg<TArray<int32_t>>::pass(____acomp_16_13_rename_at_16_19)));
+    })));
+    TTuple<32,int32_t,float,TArray<int32_t>> __y_rename_at_17_21; das_zero(__y_rename_at_17_21); das_move(__y_rename_at_17_21, _FuncbuiltinTickclone_to_moveTick17180087396728260876_914057db79c17b24(__context__,das_arg<TTuple<32,int32_t,float,TArray<int32_t>>>::pass(__x_rename_at_13_18)));
+    DAS_ASSERT(((das_get_tuple_field<int32_t,0>::get(__y_rename_at_17_21) == 1) && (das_get_tuple_field<float,4>::get(__y_rename_at_17_21) == 2.000000e+00f)));
+    {
+        bool __need_loop_19 = true;
+        // t: int const
+        das_iterator<range> __t_iterator(range(0,10));
+        int32_t __t_rename_at_19_22;
+        __need_loop_19 = __t_iterator.first(__context__,(__t_rename_at_19_22)) && __need_loop_19;
+        for ( ; __need_loop_19 ; __need_loop_19 = __t_iterator.next(__context__,(__t_rename_at_19_22)) )
+        {
+            DAS_ASSERT((das_get_tuple_field<TArray<int32_t>,8>::get(__y_rename_at_17_21)(__t_rename_at_19_22,__context__) == __t_rename_at_19_22));
+        }
+        __t_iterator.close(__context__,(__t_rename_at_19_22));
+    };
+    finalize_6d0d9c0a8099bbf5(__context__,das_arg<TTuple<32,int32_t,float,TArray<int32_t>>>::pass(__x_rename_at_13_18));
+    DAS_ASSERT((((das_get_tuple_field<int32_t,0>::get(__x_rename_at_13_18) == 0) && (das_get_tuple_field<float,4>::get(__x_rename_at_13_18) == 0.000000e+00f)) && (builtin_array_size(das_arg<TArray<int32_t>>::pass(das_get_tuple_field<TArray<int32_t>,8>::get(__x_rename_at_13_18))) == 0)));
+    DAS_ASSERT(((das_get_tuple_field<int32_t,0>::get(__y_rename_at_17_21) == 1) && (das_get_tuple_field<float,4>::get(__y_rename_at_17_21) == 2.000000e+00f)));
+    {
+        bool __need_loop_25 = true;
+        // t: int const
+        das_iterator<range> __t_iterator(range(0,10));
+        int32_t __t_rename_at_25_23;
+        __need_loop_25 = __t_iterator.first(__context__,(__t_rename_at_25_23)) && __need_loop_25;
+        for ( ; __need_loop_25 ; __need_loop_25 = __t_iterator.next(__context__,(__t_rename_at_25_23)) )
+        {
+            DAS_ASSERT((das_get_tuple_field<TArray<int32_t>,8>::get(__y_rename_at_17_21)(__t_rename_at_25_23,__context__) == __t_rename_at_25_23));
+        }
+        __t_iterator.close(__context__,(__t_rename_at_25_23));
+    };
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline bool test_20ee399cf53e5285 ( Context * __context__ )
+{
+    TTuple<8,int32_t,float> __ttt_rename_at_33_24_ConstRef = ((TTuple<8,int32_t,float>)(([&]() -> TTuple<8,int32_t,float> {
+        TTuple<8,int32_t,float> __mkt_33;
+        das_get_tuple_field<int32_t,0>::get(__mkt_33) = 1;
+        das_get_tuple_field<float,4>::get(__mkt_33) = 3.140000e+00f;
+        return __mkt_33;
+    })()));
+    TTuple<8,int32_t,float> const  & __ttt_rename_at_33_24 = __ttt_rename_at_33_24_ConstRef;
+;
+    DAS_ASSERT((testI_a8a1dbfd965b4720(__context__,__ttt_rename_at_33_24)));
+    DAS_ASSERT((testF_cf6e8af974a6cacc(__context__,__ttt_rename_at_33_24)));
+    DAS_ASSERT((das_get_tuple_field<int32_t,0>::get(__ttt_rename_at_33_24) == 1));
+    DAS_ASSERT((das_get_tuple_field<float,4>::get(__ttt_rename_at_33_24) == 3.140000e+00f));
+    TTuple<16,int32_t,float,char *> __t_rename_at_38_25;das_zero(__t_rename_at_38_25);
+    das_copy(das_get_tuple_field<int32_t,0>::get(__t_rename_at_38_25),1);
+    das_copy(das_get_tuple_field<float,4>::get(__t_rename_at_38_25),2.000000e+00f);
+    das_copy(das_get_tuple_field<char *,8>::get(__t_rename_at_38_25),((char *) "3"));
+    TTuple<16,int32_t,float,char *> __q_rename_at_43_26 = __t_rename_at_38_25;
+    DAS_ASSERT((das_get_tuple_field<int32_t,0>::get(__q_rename_at_43_26) == 1));
+    DAS_ASSERT((das_get_tuple_field<float,4>::get(__q_rename_at_43_26) == 2.000000e+00f));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_get_tuple_field<char *,8>::get(__q_rename_at_43_26)),cast<char *>::from(((char *) "3")),*__context__,nullptr)));
+    TTuple<16,int32_t,float,char *> * __pq_rename_at_48_27 = das_ref(__context__,__q_rename_at_43_26);
+    DAS_ASSERT((das_get_tuple_field_ptr<int32_t,0>::get(__pq_rename_at_48_27) == 1));
+    DAS_ASSERT((das_get_tuple_field_ptr<float,4>::get(__pq_rename_at_48_27) == 2.000000e+00f));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_get_tuple_field_ptr<char *,8>::get(__pq_rename_at_48_27)),cast<char *>::from(((char *) "3")),*__context__,nullptr)));
+    DAS_ASSERT((das_null_coalescing<int32_t>::get(das_safe_navigation_tuple<int32_t, 0>::get(__pq_rename_at_48_27),0) == 1));
+    DAS_ASSERT((das_null_coalescing<float>::get(das_safe_navigation_tuple<float, 4>::get(__pq_rename_at_48_27),0.000000e+00f) == 2.000000e+00f));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_null_coalescing<char * const >::get(das_safe_navigation_tuple<char *, 8>::get(__pq_rename_at_48_27),((char *) "nothing"))),cast<char *>::from(((char *) "3")),*__context__,nullptr)));
+    TTuple<8,int32_t,float> * __qq_rename_at_56_28 = das_new<TTuple<8,int32_t,float>>::make(__context__);
+    das_copy(das_get_tuple_field_ptr<int32_t,0>::get(__qq_rename_at_56_28),1);
+    das_copy(das_get_tuple_field_ptr<float,4>::get(__qq_rename_at_56_28),2.000000e+00f);
+    DAS_ASSERT((das_null_coalescing<int32_t>::get(das_safe_navigation_tuple<int32_t, 0>::get(__qq_rename_at_56_28),0) == 1));
+    DAS_ASSERT((das_null_coalescing<float>::get(das_safe_navigation_tuple<float, 4>::get(__qq_rename_at_56_28),0.000000e+00f) == 2.000000e+00f));
+    finalize_b1b8502f42be49c9(__context__,__qq_rename_at_56_28);
+    TTuple<8,int32_t,float> __mkt_rename_at_65_29_ConstRef = ((TTuple<8,int32_t,float>)(([&]() -> TTuple<8,int32_t,float> {
+        TTuple<8,int32_t,float> __mkt_65;
+        das_get_tuple_field<int32_t,0>::get(__mkt_65) = 1;
+        das_get_tuple_field<float,4>::get(__mkt_65) = 2.000000e+00f;
+        return __mkt_65;
+    })()));
+    TTuple<8,int32_t,float> const  & __mkt_rename_at_65_29 = __mkt_rename_at_65_29_ConstRef;
+;
+    DAS_ASSERT(((das_get_tuple_field<int32_t,0>::get(__mkt_rename_at_65_29) == 1) && (das_get_tuple_field<float,4>::get(__mkt_rename_at_65_29) == 2.000000e+00f)));
+    TDim<TTuple<8,int32_t,float>,2> __mkta_rename_at_67_30_ConstRef = ((TDim<TTuple<8,int32_t,float>,2>)(([&]() -> TDim<TTuple<8,int32_t,float>,2> {
+        TDim<TTuple<8,int32_t,float>,2> __mka_67;
+        __mka_67(0,__context__) = (([&]() -> TTuple<8,int32_t,float> {
+            TTuple<8,int32_t,float> __mkt_67;
+            das_get_tuple_field<int32_t,0>::get(__mkt_67) = 1;
+            das_get_tuple_field<float,4>::get(__mkt_67) = 2.000000e+00f;
+            return __mkt_67;
+        })());
+        __mka_67(1,__context__) = (([&]() -> TTuple<8,int32_t,float> {
+            TTuple<8,int32_t,float> __mkt_67;
+            das_get_tuple_field<int32_t,0>::get(__mkt_67) = 3;
+            das_get_tuple_field<float,4>::get(__mkt_67) = 4.000000e+00f;
+            return __mkt_67;
+        })());
+        return __mka_67;
+    })()));
+    TDim<TTuple<8,int32_t,float>,2> const  & __mkta_rename_at_67_30 = __mkta_rename_at_67_30_ConstRef;
+;
+    DAS_ASSERT(((das_get_tuple_field<int32_t,0>::get(__mkta_rename_at_67_30(0,__context__)) == 1) && (das_get_tuple_field<float,4>::get(__mkta_rename_at_67_30(0,__context__)) == 2.000000e+00f)));
+    DAS_ASSERT(((das_get_tuple_field<int32_t,0>::get(__mkta_rename_at_67_30(1,__context__)) == 3) && (das_get_tuple_field<float,4>::get(__mkta_rename_at_67_30(1,__context__)) == 4.000000e+00f)));
+    TDim<int32_t,4> __ti_rename_at_71_31_ConstRef = ((TDim<int32_t,4>)(([&]() -> TDim<int32_t,4> {
+        TDim<int32_t,4> __mka_71;
+        __mka_71(0,__context__) = 1;
+        __mka_71(1,__context__) = 2;
+        __mka_71(2,__context__) = 3;
+        __mka_71(3,__context__) = 4;
+        return __mka_71;
+    })()));
+    TDim<int32_t,4> const  & __ti_rename_at_71_31 = __ti_rename_at_71_31_ConstRef;
+;
+    DAS_ASSERT(((((__ti_rename_at_71_31(0,__context__) == 1) && (__ti_rename_at_71_31(1,__context__) == 2)) && (__ti_rename_at_71_31(2,__context__) == 3)) && (__ti_rename_at_71_31(3,__context__) == 4)));
+    TDim<TTuple<8,int32_t,int32_t>,2> __tt_rename_at_74_32_ConstRef = ((TDim<TTuple<8,int32_t,int32_t>,2>)(([&]() -> TDim<TTuple<8,int32_t,int32_t>,2> {
+        TDim<TTuple<8,int32_t,int32_t>,2> __mka_74;
+        __mka_74(0,__context__) = (([&]() -> TTuple<8,int32_t,int32_t> {
+            TTuple<8,int32_t,int32_t> __mkt_74;
+            das_get_tuple_field<int32_t,0>::get(__mkt_74) = 1;
+            das_get_tuple_field<int32_t,4>::get(__mkt_74) = 2;
+            return __mkt_74;
+        })());
+        __mka_74(1,__context__) = (([&]() -> TTuple<8,int32_t,int32_t> {
+            TTuple<8,int32_t,int32_t> __mkt_74;
+            das_get_tuple_field<int32_t,0>::get(__mkt_74) = 3;
+            das_get_tuple_field<int32_t,4>::get(__mkt_74) = 4;
+            return __mkt_74;
+        })());
+        return __mka_74;
+    })()));
+    TDim<TTuple<8,int32_t,int32_t>,2> const  & __tt_rename_at_74_32 = __tt_rename_at_74_32_ConstRef;
+;
+    DAS_ASSERT(((((das_get_tuple_field<int32_t,0>::get(__tt_rename_at_74_32(0,__context__)) == 1) && (das_get_tuple_field<int32_t,4>::get(__tt_rename_at_74_32(0,__context__)) == 2)) && (das_get_tuple_field<int32_t,0>::get(__tt_rename_at_74_32(1,__context__)) == 3)) && (das_get_tuple_field<int32_t,4>::get(__tt_rename_at_74_32(1,__context__)) == 4)));
+    TTuple<8,int32_t,float> __tq_rename_at_77_33_ConstRef = ((TTuple<8,int32_t,float>)(([&]() -> TTuple<8,int32_t,float> {
+        TTuple<8,int32_t,float> __mkt_77;
+        das_get_tuple_field<int32_t,0>::get(__mkt_77) = 1;
+        das_get_tuple_field<float,4>::get(__mkt_77) = 2.000000e+00f;
+        return __mkt_77;
+    })()));
+    TTuple<8,int32_t,float> const  & __tq_rename_at_77_33 = __tq_rename_at_77_33_ConstRef;
+;
+    DAS_ASSERT(((das_get_tuple_field<int32_t,0>::get(__tq_rename_at_77_33) == 1) && (das_get_tuple_field<float,4>::get(__tq_rename_at_77_33) == 2.000000e+00f)));
+    testFinalizeAndClone_4527c70f2ccef257(__context__);
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline void clone_947b9332035ab028 ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> &  __dest_rename_at_1121_34, TTuple<32,int32_t,float,TArray<int32_t>> const  &  __src_rename_at_1121_35 )
+{
+    das_copy(das_get_tuple_field<int32_t,0>::get(__dest_rename_at_1121_34),das_get_tuple_field<int32_t,0>::get(__src_rename_at_1121_35));
+    das_copy(das_get_tuple_field<float,4>::get(__dest_rename_at_1121_34),das_get_tuple_field<float,4>::get(__src_rename_at_1121_35));
+    _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62(__context__,das_arg<TArray<int32_t>>::pass(das_get_tuple_field<TArray<int32_t>,8>::get(__dest_rename_at_1121_34)),das_get_tuple_field<TArray<int32_t>,8>::get(__src_rename_at_1121_35));
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> const  &  arg_b = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<TArray<int32_t> &>::from(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14(__context__, arg_a));
+}
+static vec4f __wrap__FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> &  arg_b = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickclone_to_moveTick17180087396728260876_914057db79c17b24 ( Context * __context__ ) {
+    TTuple<32,int32_t,float,TArray<int32_t>> &  arg_clone_src = cast_aot_arg<TTuple<32,int32_t,float,TArray<int32_t>> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TTuple<32,int32_t,float,TArray<int32_t>> *) __context__->abiCMRES) = _FuncbuiltinTickclone_to_moveTick17180087396728260876_914057db79c17b24(__context__, arg_clone_src);
+    return v_zero();
+}
+static vec4f __wrap_finalize_5cef76514cdcd502 ( Context * __context__ ) {
+    TTuple<8,int32_t,float> &  arg___this = cast_aot_arg<TTuple<8,int32_t,float> & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_5cef76514cdcd502(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_value = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap_finalize_6d0d9c0a8099bbf5 ( Context * __context__ ) {
+    TTuple<32,int32_t,float,TArray<int32_t>> &  arg___this = cast_aot_arg<TTuple<32,int32_t,float,TArray<int32_t>> & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_6d0d9c0a8099bbf5(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_finalize_b1b8502f42be49c9 ( Context * __context__ ) {
+    TTuple<8,int32_t,float> * & arg___this = cast_aot_arg<TTuple<8,int32_t,float> * &>::to(*__context__,__context__->abiArguments()[0]);
+    finalize_b1b8502f42be49c9(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_testI_a8a1dbfd965b4720 ( Context * __context__ ) {
+    TTuple<8,int32_t,float> const  &  arg_arg = cast_aot_arg<TTuple<8,int32_t,float> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<bool>::from(testI_a8a1dbfd965b4720(__context__, arg_arg));
+}
+static vec4f __wrap_testF_cf6e8af974a6cacc ( Context * __context__ ) {
+    TTuple<8,int32_t,float> const  &  arg_arg = cast_aot_arg<TTuple<8,int32_t,float> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<bool>::from(testF_cf6e8af974a6cacc(__context__, arg_arg));
+}
+static vec4f __wrap_testFinalizeAndClone_4527c70f2ccef257 ( Context * __context__ ) {
+    return cast<bool>::from(testFinalizeAndClone_4527c70f2ccef257(__context__));
+}
+static vec4f __wrap_test_20ee399cf53e5285 ( Context * __context__ ) {
+    return cast<bool>::from(test_20ee399cf53e5285(__context__));
+}
+static vec4f __wrap_clone_947b9332035ab028 ( Context * __context__ ) {
+    TTuple<32,int32_t,float,TArray<int32_t>> &  arg_dest = cast_aot_arg<TTuple<32,int32_t,float,TArray<int32_t>> & >::to(*__context__,__context__->abiArguments()[0]);
+    TTuple<32,int32_t,float,TArray<int32_t>> const  &  arg_src = cast_aot_arg<TTuple<32,int32_t,float,TArray<int32_t>> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    clone_947b9332035ab028(__context__, arg_dest, arg_src);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xa51a880d594e91fd, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c },
+    { 0xca1141a5df264c9, false, (void*)&_FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62, &__wrap__FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 },
+    { 0x17892cd516a9a747, false, (void*)&_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14, &__wrap__FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 },
+    { 0x84908fa671ce3a30, false, (void*)&_FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd, &__wrap__FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd },
+    { 0x5e8700914eff1e69, false, (void*)&_FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5, &__wrap__FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5 },
+    { 0x245bd9860892db45, true, (void*)&_FuncbuiltinTickclone_to_moveTick17180087396728260876_914057db79c17b24, &__wrap__FuncbuiltinTickclone_to_moveTick17180087396728260876_914057db79c17b24 },
+    { 0x7bd2bbdfc426831, false, (void*)&finalize_5cef76514cdcd502, &__wrap_finalize_5cef76514cdcd502 },
+    { 0xbf77bb210b0552bc, false, (void*)&_FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39, &__wrap__FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 },
+    { 0xc7d1b2a3b3c6c63a, false, (void*)&finalize_6d0d9c0a8099bbf5, &__wrap_finalize_6d0d9c0a8099bbf5 },
+    { 0xc3ff893eaca11078, false, (void*)&finalize_b1b8502f42be49c9, &__wrap_finalize_b1b8502f42be49c9 },
+    { 0x564bc37f8a79a297, false, (void*)&testI_a8a1dbfd965b4720, &__wrap_testI_a8a1dbfd965b4720 },
+    { 0x495b9e89f3740823, false, (void*)&testF_cf6e8af974a6cacc, &__wrap_testF_cf6e8af974a6cacc },
+    { 0xda281817ac2515cb, false, (void*)&testFinalizeAndClone_4527c70f2ccef257, &__wrap_testFinalizeAndClone_4527c70f2ccef257 },
+    { 0xd3dce4e70c6769c1, false, (void*)&test_20ee399cf53e5285, &__wrap_test_20ee399cf53e5285 },
+    { 0x392cea5b726c92c1, false, (void*)&clone_947b9332035ab028, &__wrap_clone_947b9332035ab028 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_13732552751705923159
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,249 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14785240291817917167 {
+
+// unused enumeration GooEnum
+// unused enumeration OpCode
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+extern TypeInfo __type_info__7c9b7d0817d2a8d3;
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__95e3ead066a9cdf7;
+extern TypeInfo __type_info__af51db4c85e354d9;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __func_info__7bc3a8db960bc86f_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~UnitTest::Point3Array"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 24, UINT64_C(0xbb355944ab3f2267), "arr", 0, 0 };
+VarInfo * __func_info__7bc3a8db960bc86f_fields[1] =  { &__func_info__7bc3a8db960bc86f_field_0 };
+FuncInfo __func_info__7bc3a8db960bc86f = {"invoke block<(arr:UnitTest::Point3Array const):void> const", "", __func_info__7bc3a8db960bc86f_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x7bc3a8db960bc86f), 0x0 };
+VarInfo __func_info__47c76a3c9040321b_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e3ead066a9cdf7, nullptr, nullptr, nullptr, 0, 0, nullptr, 41058, 24, UINT64_C(0xb8ca919735df27ab), "tfoo", 0, 0 };
+VarInfo * __func_info__47c76a3c9040321b_fields[1] =  { &__func_info__47c76a3c9040321b_field_0 };
+FuncInfo __func_info__47c76a3c9040321b = {"invoke block<(tfoo:array<float3 aka Point3> const#):void> const", "", __func_info__47c76a3c9040321b_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x47c76a3c9040321b), 0x0 };
+TypeInfo __type_info__7c9b7d0817d2a8d3 = { Type::tFloat3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 12, UINT64_C(0x7c9b7d0817d2a8d3) };
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__95e3ead066a9cdf7 = { Type::tFloat3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 12, UINT64_C(0x95e3ead066a9cdf7) };
+TypeInfo __type_info__af51db4c85e354d9 = { Type::tFloat2, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0xaf51db4c85e354d9) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__af90fe4c864e9d52, &__type_info__7c9b7d0817d2a8d3 };
+TypeInfo * __tinfo_1[1] = { &__type_info__af51db4c85e354d9 };
+
+inline void _FuncbuiltinTickpushTick14133213201864676143_5b23a1929ba4a4a0 ( Context * __context__, TArray<float3> & __Arr_rename_at_177_0, float3 __value_rename_at_177_1 );
+inline void take3_ed566e5dc8372e7f ( Context * __context__, float3 __t_rename_at_7_2 );
+inline void indexFail_1244e3ec2d0d8c73 ( Context * __context__, Point3Array const  & __arr_rename_at_12_3 );
+inline void swizzleFail_3e10f8005c3fdc3c ( Context * __context__, Point3Array const  & __battleAreaPoints_rename_at_19_5 );
+inline void arrayAliasFail_57c43a0085de0194 ( Context * __context__ );
+inline bool test_c3b7af8cc3a78eee ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickpushTick14133213201864676143_5b23a1929ba4a4a0 ( Context * __context__, TArray<float3> &  __Arr_rename_at_177_0, float3 __value_rename_at_177_1 )
+{
+    das_copy(__Arr_rename_at_177_0(builtin_array_push_back(das_arg<TArray<float3>>::pass(__Arr_rename_at_177_0),12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_177_1);
+}
+
+inline void take3_ed566e5dc8372e7f ( Context * __context__, float3 __t_rename_at_7_2 )
+{
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<char * const >::from(((char *) "t=")), cast<float3>::from(__t_rename_at_7_2))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void indexFail_1244e3ec2d0d8c73 ( Context * __context__, Point3Array const  &  __arr_rename_at_12_3 )
+{
+    take3_ed566e5dc8372e7f(__context__,das_alias<Point3>::from(das_index<Point3Array const >::at(__arr_rename_at_12_3,0,__context__)));
+    float3 * __t_rename_at_14_4 = ((float3 *)&(das_alias<Point3>::from(das_index<Point3Array const >::at(__arr_rename_at_12_3,1,__context__))));
+    take3_ed566e5dc8372e7f(__context__,(*__t_rename_at_14_4));
+}
+
+inline void swizzleFail_3e10f8005c3fdc3c ( Context * __context__, Point3Array const  &  __battleAreaPoints_rename_at_19_5 )
+{
+    float2 __pointStart_rename_at_20_6 = v_zero();
+    das_copy(das_swizzle_ref<float,float2,0>::swizzle(__pointStart_rename_at_20_6) /*x*/,das_swizzle_ref<float const ,float3 const ,0>::swizzle(das_alias<Point3>::from(das_alias<Point3>::from(das_index<Point3Array const >::at(__battleAreaPoints_rename_at_19_5,0,__context__)))) /*x*/);
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<1>(__tinfo_1, cast<float2>::from(__pointStart_rename_at_20_6))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void arrayAliasFail_57c43a0085de0194 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,160,"arrayAliasFail " DAS_FILE_LINE);
+{
+    TArray<float3> __foo_rename_at_27_7;das_zero(__foo_rename_at_27_7);
+    _FuncbuiltinTickpushTick14133213201864676143_5b23a1929ba4a4a0(__context__,das_arg<TArray<float3>>::pass(__foo_rename_at_27_7),v_make_vec4f(1.000000e+00f,2.000000e+00f,3.000000e+00f,0.f));
+    _FuncbuiltinTickpushTick14133213201864676143_5b23a1929ba4a4a0(__context__,das_arg<TArray<float3>>::pass(__foo_rename_at_27_7),v_make_vec4f(2.000000e+00f,3.000000e+00f,4.000000e+00f,0.f));
+    _FuncbuiltinTickpushTick14133213201864676143_5b23a1929ba4a4a0(__context__,das_arg<TArray<float3>>::pass(__foo_rename_at_27_7),v_make_vec4f(3.000000e+00f,4.000000e+00f,5.000000e+00f,0.f));
+    tempArrayAliasExample(das_reinterpret<TArray<Point3> const >::pass(das_arg<TArray<float3>>::pass(__foo_rename_at_27_7)),das_reinterpret<Block DAS_COMMENT((void,TArray<Point3> const )) const >::pass(das_make_block<void,TArray<float3> const  &>(__context__,112,0,&__func_info__47c76a3c9040321b,[&](TArray<float3> const  & __tfoo_rename_at_31_8) -> void{
+        float3 __f_rename_at_32_9 = v_zero();
+        {
+            bool __need_loop_33 = true;
+            // it: float3 aka Point3 const&#
+            das_iterator<TArray<float3> const > __it_iterator(__tfoo_rename_at_31_8);
+            float3 const  * __it_rename_at_33_10;
+            __need_loop_33 = __it_iterator.first(__context__,(__it_rename_at_33_10)) && __need_loop_33;
+            for ( ; __need_loop_33 ; __need_loop_33 = __it_iterator.next(__context__,(__it_rename_at_33_10)) )
+            {
+                SimPolicy<float3>::SetAdd((char *)&(__f_rename_at_32_9),das_alias<Point3>::from((*__it_rename_at_33_10)),*__context__,nullptr);
+            }
+            __it_iterator.close(__context__,(__it_rename_at_33_10));
+        };
+        DAS_ASSERT((SimPolicy<float3>::Equ(__f_rename_at_32_9,v_make_vec4f(6.000000e+00f,9.000000e+00f,1.200000e+01f,0.f),*__context__,nullptr)));
+    })),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}}
+
+inline bool test_c3b7af8cc3a78eee ( Context * __context__ ) { das_stack_prologue __prologue(__context__,320,"test " DAS_FILE_LINE);
+{
+    float3 __a_rename_at_42_11 = das_alias<Point3>::from(das_alias<Point3>::from(getSamplePoint3()));
+    DAS_VERIFY((SimPolicy<float3>::Equ(das_alias<Point3>::from(doubleSamplePoint3(das_alias<Point3>::to(__a_rename_at_42_11))),v_make_vec4f(0.000000e+00f,2.000000e+00f,4.000000e+00f,0.f),*__context__,nullptr)));
+    TestObjectFoo __foo_rename_at_46_12;das_zero(__foo_rename_at_46_12);
+    das_copy(das_alias<Point3>::from(__foo_rename_at_46_12.hit /*hit*/),das_alias<Point3>::from(getSamplePoint3()));
+    DAS_ASSERT((((v_extract_x(das_alias<Point3>::from(das_alias<Point3>::from(__foo_rename_at_46_12.hit /*hit*/))) /*x*/ == 0.000000e+00f) && (v_extract_y(das_alias<Point3>::from(das_alias<Point3>::from(__foo_rename_at_46_12.hit /*hit*/))) /*y*/ == 1.000000e+00f)) && (v_extract_z(das_alias<Point3>::from(das_alias<Point3>::from(__foo_rename_at_46_12.hit /*hit*/))) /*z*/ == 2.000000e+00f)));
+    float3 __qq_rename_at_50_13 = das_alias<Point3>::from(das_alias<Point3>::from(__foo_rename_at_46_12.hit /*hit*/));
+    DAS_ASSERT((((v_extract_x(__qq_rename_at_50_13) /*x*/ == 0.000000e+00f) && (v_extract_y(__qq_rename_at_50_13) /*y*/ == 1.000000e+00f)) && (v_extract_z(__qq_rename_at_50_13) /*z*/ == 2.000000e+00f)));
+    float3 __qq1_rename_at_52_14 = das_alias<Point3>::from(das_alias<Point3>::from(getSamplePoint3()));
+    DAS_ASSERT((((v_extract_x(__qq1_rename_at_52_14) /*x*/ == 0.000000e+00f) && (v_extract_y(__qq1_rename_at_52_14) /*y*/ == 1.000000e+00f)) && (v_extract_z(__qq1_rename_at_52_14) /*z*/ == 2.000000e+00f)));
+    float3 __qq2_rename_at_54_15 = ((float3)das_alias<Point3>::from(das_alias<Point3>::from(((__foo_rename_at_46_12).hitPos()))));
+    DAS_ASSERT((((v_extract_x(__qq2_rename_at_54_15) /*x*/ == 0.000000e+00f) && (v_extract_y(__qq2_rename_at_54_15) /*y*/ == 1.000000e+00f)) && (v_extract_z(__qq2_rename_at_54_15) /*z*/ == 2.000000e+00f)));
+    float3 __qq3_rename_at_56_16 = das_alias<Point3>::from(das_alias<Point3>::from(((__foo_rename_at_46_12).hitPos())));
+    DAS_ASSERT((((v_extract_x(__qq3_rename_at_56_16) /*x*/ == 0.000000e+00f) && (v_extract_y(__qq3_rename_at_56_16) /*y*/ == 1.000000e+00f)) && (v_extract_z(__qq3_rename_at_56_16) /*z*/ == 2.000000e+00f)));
+    float3 __qq4_rename_at_58_17 = ((float3)(SimPolicy<float3>::Mul(das_alias<Point3>::from(((__foo_rename_at_46_12).hitPosRef())),v_splats(1.000000e+00f),*__context__,nullptr)));
+    DAS_ASSERT((((v_extract_x(__qq4_rename_at_58_17) /*x*/ == 0.000000e+00f) && (v_extract_y(__qq4_rename_at_58_17) /*y*/ == 1.000000e+00f)) && (v_extract_z(__qq4_rename_at_58_17) /*z*/ == 2.000000e+00f)));
+    float3 __hitDir_rename_at_60_18 = safe_normalize3(SimPolicy<float3>::Unm(das_alias<Point3>::from(doubleSamplePoint3(das_alias<Point3>::to(das_alias<Point3>::from(__foo_rename_at_46_12.hit /*hit*/)))),*__context__,nullptr));
+    float3 __nhd_rename_at_61_19 = ((float3)v_make_vec4f(-0.000000e+00f,-4.472136e-01f,-8.944272e-01f,0.f));
+    DAS_ASSERT((((v_extract_x(__hitDir_rename_at_60_18) /*x*/ == v_extract_x(__nhd_rename_at_61_19) /*x*/) && (v_extract_y(__hitDir_rename_at_60_18) /*y*/ == v_extract_y(__nhd_rename_at_61_19) /*y*/)) && (v_extract_z(__hitDir_rename_at_60_18) /*z*/ == v_extract_z(__nhd_rename_at_61_19) /*z*/)));
+    das_copy(__hitDir_rename_at_60_18,safe_normalize3(SimPolicy<float3>::Unm(das_alias<Point3>::from(__foo_rename_at_46_12.hit /*hit*/),*__context__,nullptr)));
+    float3 __nhdh_rename_at_64_20 = ((float3)v_make_vec4f(-0.000000e+00f,-4.472136e-01f,-8.944272e-01f,0.f));
+    DAS_ASSERT((((v_extract_x(__hitDir_rename_at_60_18) /*x*/ == v_extract_x(__nhdh_rename_at_64_20) /*x*/) && (v_extract_y(__hitDir_rename_at_60_18) /*y*/ == v_extract_y(__nhdh_rename_at_64_20) /*y*/)) && (v_extract_z(__hitDir_rename_at_60_18) /*z*/ == v_extract_z(__nhdh_rename_at_64_20) /*z*/)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(((char * const )(((__foo_rename_at_46_12).getWordFoo())))),cast<char *>::from(((char *) "foo")),*__context__,nullptr)));
+    testPoint3Array(das_make_block<void,Point3Array const  &>(__context__,288,0,&__func_info__7bc3a8db960bc86f,[&](Point3Array const  & __arr_rename_at_68_21) -> void{
+        DAS_ASSERT((das_vector_length(__arr_rename_at_68_21) == 10));
+        {
+            bool __need_loop_70 = true;
+            // p: float3 aka Point3 const&
+            das_iterator<Point3Array const > __p_iterator(__arr_rename_at_68_21);
+            float3 const  * __p_rename_at_70_22;
+            __need_loop_70 = __p_iterator.first(__context__,(__p_rename_at_70_22)) && __need_loop_70;
+            for ( ; __need_loop_70 ; __need_loop_70 = __p_iterator.next(__context__,(__p_rename_at_70_22)) )
+            {
+                DAS_ASSERT((((v_extract_x(das_alias<Point3>::from(das_alias<Point3>::from((*__p_rename_at_70_22)))) /*x*/ == 1.000000e+00f) && (v_extract_y(das_alias<Point3>::from(das_alias<Point3>::from((*__p_rename_at_70_22)))) /*y*/ == 2.000000e+00f)) && (v_extract_z(das_alias<Point3>::from(das_alias<Point3>::from((*__p_rename_at_70_22)))) /*z*/ == 3.000000e+00f)));
+            }
+            __p_iterator.close(__context__,(__p_rename_at_70_22));
+        };
+    }),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    arrayAliasFail_57c43a0085de0194(__context__);
+    return das_auto_cast<bool>::cast(true);
+}}
+static vec4f __wrap__FuncbuiltinTickpushTick14133213201864676143_5b23a1929ba4a4a0 ( Context * __context__ ) {
+    TArray<float3> &  arg_Arr = cast_aot_arg<TArray<float3> & >::to(*__context__,__context__->abiArguments()[0]);
+    float3 arg_value = cast_aot_arg<float3>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick14133213201864676143_5b23a1929ba4a4a0(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap_take3_ed566e5dc8372e7f ( Context * __context__ ) {
+    float3 arg_t = cast_aot_arg<float3>::to(*__context__,__context__->abiArguments()[0]);
+    take3_ed566e5dc8372e7f(__context__, arg_t);
+    return v_zero();
+}
+static vec4f __wrap_indexFail_1244e3ec2d0d8c73 ( Context * __context__ ) {
+    Point3Array const  &  arg_arr = cast_aot_arg<Point3Array const  & >::to(*__context__,__context__->abiArguments()[0]);
+    indexFail_1244e3ec2d0d8c73(__context__, arg_arr);
+    return v_zero();
+}
+static vec4f __wrap_swizzleFail_3e10f8005c3fdc3c ( Context * __context__ ) {
+    Point3Array const  &  arg_battleAreaPoints = cast_aot_arg<Point3Array const  & >::to(*__context__,__context__->abiArguments()[0]);
+    swizzleFail_3e10f8005c3fdc3c(__context__, arg_battleAreaPoints);
+    return v_zero();
+}
+static vec4f __wrap_arrayAliasFail_57c43a0085de0194 ( Context * __context__ ) {
+    arrayAliasFail_57c43a0085de0194(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_c3b7af8cc3a78eee ( Context * __context__ ) {
+    return cast<bool>::from(test_c3b7af8cc3a78eee(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xcb6bd6175c7c7fe0, false, (void*)&_FuncbuiltinTickpushTick14133213201864676143_5b23a1929ba4a4a0, &__wrap__FuncbuiltinTickpushTick14133213201864676143_5b23a1929ba4a4a0 },
+    { 0xfc2c3d78b6018af2, false, (void*)&take3_ed566e5dc8372e7f, &__wrap_take3_ed566e5dc8372e7f },
+    { 0x6ff24fbee9f2a3d5, false, (void*)&indexFail_1244e3ec2d0d8c73, &__wrap_indexFail_1244e3ec2d0d8c73 },
+    { 0x806b2033a3105c2b, false, (void*)&swizzleFail_3e10f8005c3fdc3c, &__wrap_swizzleFail_3e10f8005c3fdc3c },
+    { 0x9872552486a521b1, false, (void*)&arrayAliasFail_57c43a0085de0194, &__wrap_arrayAliasFail_57c43a0085de0194 },
+    { 0x34bccb6d971b0caa, false, (void*)&test_c3b7af8cc3a78eee, &__wrap_test_c3b7af8cc3a78eee },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_14785240291817917167
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
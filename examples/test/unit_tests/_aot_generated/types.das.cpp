@@ -0,0 +1,194 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_13736898207927428772 {
+
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __func_info__b682abbdb056b624_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x5f0627622c8d97a3), "b_var_i", 0, 0 };
+VarInfo __func_info__b682abbdb056b624_field_1 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x5f0306622c8b29b9), "b_var_f", 0, 0 };
+VarInfo __func_info__b682abbdb056b624_field_2 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0x5f2819622caa663f), "b_var_s", 0, 0 };
+VarInfo * __func_info__b682abbdb056b624_fields[3] =  { &__func_info__b682abbdb056b624_field_0, &__func_info__b682abbdb056b624_field_1, &__func_info__b682abbdb056b624_field_2 };
+FuncInfo __func_info__b682abbdb056b624 = {"invoke block<(var b_var_i:int -const;var b_var_f:float -const;var b_var_s:string -const):void> const", "", __func_info__b682abbdb056b624_fields, 3, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xb682abbdb056b624), 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void test_global_var_5f38a1014622c565 ( Context * __context__ );
+inline void test_arg_5b549c5ad4ee0319 ( Context * __context__, int32_t __a_var_i_rename_at_37_0, float __a_var_f_rename_at_37_1, char * __a_var_s_rename_at_37_2 );
+inline void test_block_invoke_e818b0dda779d8ee ( Context * __context__, Block DAS_COMMENT((void,int32_t,float,char *)) const  & __b_rename_at_49_3 );
+inline void test_block_var_5c3b69cfd7b40cf8 ( Context * __context__ );
+inline bool test_c59958b1ded6e0c7 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+    das_global<int32_t,0x8675e8c979eb8694>(__context__) = 1;/*g_var_i*/
+    das_global<float,0x8679cdc979ef418a>(__context__) = 3.140000e+00f;/*g_var_f*/
+    das_global<char *,0x8653d2c979ce7acc>(__context__) = ((char *) "blah");/*g_var_s*/
+}
+
+inline void test_global_var_5f38a1014622c565 ( Context * __context__ )
+{
+    DAS_ASSERT((das_global<int32_t,0x8675e8c979eb8694>(__context__) /*g_var_i*/ == 1));
+    das_copy(das_global<int32_t,0x8675e8c979eb8694>(__context__) /*g_var_i*/,das_global<int32_t,0x8675e8c979eb8694>(__context__) /*g_var_i*/ + 1);
+    DAS_ASSERT((das_global<int32_t,0x8675e8c979eb8694>(__context__) /*g_var_i*/ == 2));
+    DAS_ASSERT((das_global<float,0x8679cdc979ef418a>(__context__) /*g_var_f*/ == 3.140000e+00f));
+    das_copy(das_global<float,0x8679cdc979ef418a>(__context__) /*g_var_f*/,das_global<float,0x8679cdc979ef418a>(__context__) /*g_var_f*/ * 2.000000e+00f);
+    DAS_ASSERT((das_global<float,0x8679cdc979ef418a>(__context__) /*g_var_f*/ == 6.280000e+00f));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_global<char *,0x8653d2c979ce7acc>(__context__) /*g_var_s*/),cast<char *>::from(((char *) "blah")),*__context__,nullptr)));
+    SimPolicy<char *>::SetAdd((char *)&(das_global<char *,0x8653d2c979ce7acc>(__context__) /*g_var_s*/),cast<char *>::from(((char *) "_blah")),*__context__,nullptr);
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_global<char *,0x8653d2c979ce7acc>(__context__) /*g_var_s*/),cast<char *>::from(((char *) "blah_blah")),*__context__,nullptr)));
+}
+
+inline void test_arg_5b549c5ad4ee0319 ( Context * __context__, int32_t __a_var_i_rename_at_37_0, float __a_var_f_rename_at_37_1, char * __a_var_s_rename_at_37_2 )
+{
+    DAS_ASSERT((__a_var_i_rename_at_37_0 == 1));
+    das_copy(__a_var_i_rename_at_37_0,__a_var_i_rename_at_37_0 + 1);
+    DAS_ASSERT((__a_var_i_rename_at_37_0 == 2));
+    DAS_ASSERT((__a_var_f_rename_at_37_1 == 3.140000e+00f));
+    das_copy(__a_var_f_rename_at_37_1,__a_var_f_rename_at_37_1 * 2.000000e+00f);
+    DAS_ASSERT((__a_var_f_rename_at_37_1 == 6.280000e+00f));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_var_s_rename_at_37_2),cast<char *>::from(((char *) "blah")),*__context__,nullptr)));
+    SimPolicy<char *>::SetAdd((char *)&(__a_var_s_rename_at_37_2),cast<char *>::from(((char *) "_blah")),*__context__,nullptr);
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_var_s_rename_at_37_2),cast<char *>::from(((char *) "blah_blah")),*__context__,nullptr)));
+}
+
+inline void test_block_invoke_e818b0dda779d8ee ( Context * __context__, Block DAS_COMMENT((void,int32_t,float,char *)) const  &  __b_rename_at_49_3 )
+{
+    das_invoke<void>::invoke<int32_t,float,char * const >(__context__,nullptr,__b_rename_at_49_3,1,3.140000e+00f,((char *) "blah"));
+}
+
+inline void test_block_var_5c3b69cfd7b40cf8 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,96,"test_block_var " DAS_FILE_LINE);
+{
+    test_block_invoke_e818b0dda779d8ee(__context__,das_make_block<void,int32_t,float,char *>(__context__,80,0,&__func_info__b682abbdb056b624,[&](int32_t __b_var_i_rename_at_54_4, float __b_var_f_rename_at_54_5, char * __b_var_s_rename_at_54_6) -> void{
+        DAS_ASSERT((__b_var_i_rename_at_54_4 == 1));
+        das_copy(__b_var_i_rename_at_54_4,__b_var_i_rename_at_54_4 + 1);
+        DAS_ASSERT((__b_var_i_rename_at_54_4 == 2));
+        DAS_ASSERT((__b_var_f_rename_at_54_5 == 3.140000e+00f));
+        das_copy(__b_var_f_rename_at_54_5,__b_var_f_rename_at_54_5 * 2.000000e+00f);
+        DAS_ASSERT((__b_var_f_rename_at_54_5 == 6.280000e+00f));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__b_var_s_rename_at_54_6),cast<char *>::from(((char *) "blah")),*__context__,nullptr)));
+        SimPolicy<char *>::SetAdd((char *)&(__b_var_s_rename_at_54_6),cast<char *>::from(((char *) "_blah")),*__context__,nullptr);
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__b_var_s_rename_at_54_6),cast<char *>::from(((char *) "blah_blah")),*__context__,nullptr)));
+    }));
+}}
+
+inline bool test_c59958b1ded6e0c7 ( Context * __context__ )
+{
+    test_global_var_5f38a1014622c565(__context__);
+    test_arg_5b549c5ad4ee0319(__context__,1,3.140000e+00f,((char *) "blah"));
+    test_block_var_5c3b69cfd7b40cf8(__context__);
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_test_global_var_5f38a1014622c565 ( Context * __context__ ) {
+    test_global_var_5f38a1014622c565(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_arg_5b549c5ad4ee0319 ( Context * __context__ ) {
+    int32_t arg_a_var_i = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    float arg_a_var_f = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[1]);
+    char * arg_a_var_s = cast_aot_arg<char *>::to(*__context__,__context__->abiArguments()[2]);
+    test_arg_5b549c5ad4ee0319(__context__, arg_a_var_i, arg_a_var_f, arg_a_var_s);
+    return v_zero();
+}
+static vec4f __wrap_test_block_invoke_e818b0dda779d8ee ( Context * __context__ ) {
+    Block DAS_COMMENT((void,int32_t,float,char *)) const  &  arg_b = cast_aot_arg<Block DAS_COMMENT((void,int32_t,float,char *)) const  & >::to(*__context__,__context__->abiArguments()[0]);
+    test_block_invoke_e818b0dda779d8ee(__context__, arg_b);
+    return v_zero();
+}
+static vec4f __wrap_test_block_var_5c3b69cfd7b40cf8 ( Context * __context__ ) {
+    test_block_var_5c3b69cfd7b40cf8(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_c59958b1ded6e0c7 ( Context * __context__ ) {
+    return cast<bool>::from(test_c59958b1ded6e0c7(__context__));
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x67136616ed4be2ae, false, (void*)&test_global_var_5f38a1014622c565, &__wrap_test_global_var_5f38a1014622c565 },
+    { 0x3a05ddaf7be463a1, false, (void*)&test_arg_5b549c5ad4ee0319, &__wrap_test_arg_5b549c5ad4ee0319 },
+    { 0xa974398751f83d72, false, (void*)&test_block_invoke_e818b0dda779d8ee, &__wrap_test_block_invoke_e818b0dda779d8ee },
+    { 0x825da6e8f46b51df, false, (void*)&test_block_var_5c3b69cfd7b40cf8, &__wrap_test_block_var_5c3b69cfd7b40cf8 },
+    { 0xdeca414596d7c0ef, false, (void*)&test_c59958b1ded6e0c7, &__wrap_test_c59958b1ded6e0c7 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0xacb2f4bc3f8dfc13, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_13736898207927428772
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,11 @@
+// unity build batch 0
+#include "_a.das.cpp"
+#include "_apply_macro.das.cpp"
+#include "_array_reader.das.cpp"
+#include "_b.das.cpp"
+#include "_c.das.cpp"
+#include "_enum_total.das.cpp"
+#include "_hint_macros.das.cpp"
+#include "_include_mod.das.cpp"
+#include "_moduleEnum.das.cpp"
+#include "_module_a.das.cpp"
@@ -0,0 +1,11 @@
+// unity build batch 10
+#include "local_reference.das.cpp"
+#include "lock_array.das.cpp"
+#include "lock_forever.das.cpp"
+#include "loop_ret.das.cpp"
+#include "make_default.das.cpp"
+#include "make_handle.das.cpp"
+#include "make_local.das.cpp"
+#include "make_struct_with_clone.das.cpp"
+#include "map_to_a.das.cpp"
+#include "mat_crash.das.cpp"
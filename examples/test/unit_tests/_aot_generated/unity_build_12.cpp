@@ -0,0 +1,11 @@
+// unity build batch 12
+#include "new_and_init.das.cpp"
+#include "new_delete.das.cpp"
+#include "new_with_init.das.cpp"
+#include "null_struct_init.das.cpp"
+#include "oop.das.cpp"
+#include "operator_overload.das.cpp"
+#include "operators.das.cpp"
+#include "override.das.cpp"
+#include "pack_and_unpack.das.cpp"
+#include "partial_specialization.das.cpp"
@@ -0,0 +1,11 @@
+// unity build batch 14
+#include "saddr.das.cpp"
+#include "safe_index.das.cpp"
+#include "scatter_gather.das.cpp"
+#include "set_table.das.cpp"
+#include "setand_and_setor_bool.das.cpp"
+#include "shared.das.cpp"
+#include "shifts.das.cpp"
+#include "smart_ptr.das.cpp"
+#include "sort.das.cpp"
+#include "sorted_array_test.das.cpp"
@@ -0,0 +1,11 @@
+// unity build batch 15
+#include "split.das.cpp"
+#include "split_by_chars.das.cpp"
+#include "stackwalk.das.cpp"
+#include "static_if.das.cpp"
+#include "stdvec_r2v.das.cpp"
+#include "storage_types.das.cpp"
+#include "string.das.cpp"
+#include "string_builder.das.cpp"
+#include "struct.das.cpp"
+#include "swizze.das.cpp"
@@ -0,0 +1,11 @@
+// unity build batch 16
+#include "table.das.cpp"
+#include "take_ref_alias.das.cpp"
+#include "test_bool_if.das.cpp"
+#include "test_fs_file_access.das.cpp"
+#include "test_job_que.das.cpp"
+#include "test_move_on_return.das.cpp"
+#include "test_template.das.cpp"
+#include "test_value_table_key.das.cpp"
+#include "time.das.cpp"
+#include "toarray.das.cpp"
@@ -0,0 +1,11 @@
+// unity build batch 17
+#include "totable.das.cpp"
+#include "trailing_delimiters.das.cpp"
+#include "try-catch.das.cpp"
+#include "tuple.das.cpp"
+#include "typeAlias.das.cpp"
+#include "typeinfo.das.cpp"
+#include "typename.das.cpp"
+#include "types.das.cpp"
+#include "unused_arguments.das.cpp"
+#include "utf8.das.cpp"
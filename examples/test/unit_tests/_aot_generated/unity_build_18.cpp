@@ -0,0 +1,8 @@
+// unity build batch 18
+#include "variant.das.cpp"
+#include "variant_align.das.cpp"
+#include "vec_ctors.das.cpp"
+#include "vec_index.das.cpp"
+#include "vec_ops.das.cpp"
+#include "vec_swizzle.das.cpp"
+#include "with.das.cpp"
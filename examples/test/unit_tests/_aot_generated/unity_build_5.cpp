@@ -0,0 +1,11 @@
+// unity build batch 5
+#include "cpp_layout.das.cpp"
+#include "ctor.das.cpp"
+#include "ctor_aot.das.cpp"
+#include "das_string.das.cpp"
+#include "deref_ptr_fun.das.cpp"
+#include "dim.das.cpp"
+#include "div_by_zero.das.cpp"
+#include "dummy.das.cpp"
+#include "dynamic_array.das.cpp"
+#include "each_std_vector.das.cpp"
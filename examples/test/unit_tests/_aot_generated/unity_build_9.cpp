@@ -0,0 +1,11 @@
+// unity build batch 9
+#include "int2_crash.das.cpp"
+#include "int_types.das.cpp"
+#include "invoke_cmres.das.cpp"
+#include "jit_abi.das.cpp"
+#include "join.das.cpp"
+#include "label.das.cpp"
+#include "lambda.das.cpp"
+#include "lambda_capture_modes.das.cpp"
+#include "lambda_to_iter.das.cpp"
+#include "line_info.das.cpp"
@@ -0,0 +1,116 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14785059544731339193 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline int32_t _FuncTickhahaTick10296400080183469442_b6210143313358f8 ( Context * __context__, int32_t __a_rename_at_3_0, float __b_rename_at_3_1, char * const  __c_rename_at_3_2 );
+inline bool test_3f6a1153891c8a1f ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t _FuncTickhahaTick10296400080183469442_b6210143313358f8 ( Context * __context__, int32_t __a_rename_at_3_0, float __b_rename_at_3_1, char * const  __c_rename_at_3_2 )
+{
+    return das_auto_cast<int32_t>::cast(__a_rename_at_3_0 * 2);
+}
+
+inline bool test_3f6a1153891c8a1f ( Context * __context__ )
+{
+    int32_t __t_rename_at_9_3 = ((int32_t)_FuncTickhahaTick10296400080183469442_b6210143313358f8(__context__,1,2.000000e+00f,((char *) "blah")));
+    DAS_ASSERT((__t_rename_at_9_3 == 2));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncTickhahaTick10296400080183469442_b6210143313358f8 ( Context * __context__ ) {
+    int32_t arg_a = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    float arg_b = cast_aot_arg<float>::to(*__context__,__context__->abiArguments()[1]);
+    char * const  arg_c = cast_aot_arg<char * const >::to(*__context__,__context__->abiArguments()[2]);
+    return cast<int32_t>::from(_FuncTickhahaTick10296400080183469442_b6210143313358f8(__context__, arg_a, arg_b, arg_c));
+}
+static vec4f __wrap_test_3f6a1153891c8a1f ( Context * __context__ ) {
+    return cast<bool>::from(test_3f6a1153891c8a1f(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x9d7728aecf6d0a89, false, (void*)&_FuncTickhahaTick10296400080183469442_b6210143313358f8, &__wrap__FuncTickhahaTick10296400080183469442_b6210143313358f8 },
+    { 0x5986750235a9ea71, false, (void*)&test_3f6a1153891c8a1f, &__wrap_test_3f6a1153891c8a1f },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_14785059544731339193
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,173 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+ // require utf8_utils
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_7009968312953072590 {
+
+// unused enumeration ConversionResult
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__, TArray<uint8_t> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline TArray<uint8_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__, TDim<uint8_t,3> & __a_rename_at_1502_2 );
+inline bool test_b2be5cfe4eeb3e66 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__, TArray<uint8_t> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<uint8_t>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,1,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline TArray<uint8_t> _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__, TDim<uint8_t,3> &  __a_rename_at_1502_2 )
+{
+    TArray<uint8_t> __arr_rename_at_1504_3;das_zero(__arr_rename_at_1504_3);
+    _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111(__context__,das_arg<TArray<uint8_t>>::pass(__arr_rename_at_1504_3),3);
+    das_copy(das_cast<TDim<uint8_t,3>>::cast(das_ref(__context__,__arr_rename_at_1504_3(0,__context__))),__a_rename_at_1502_2);
+    return /* <- */ das_auto_cast_move<TArray<uint8_t>>::cast(__arr_rename_at_1504_3);
+}
+
+inline bool test_b2be5cfe4eeb3e66 ( Context * __context__ )
+{
+    TArray<uint8_t> _temp_make_local_24_20_0; _temp_make_local_24_20_0;
+    TDim<uint8_t,3> _temp_make_local_35_23_1; _temp_make_local_35_23_1;
+    TArray<uint8_t> __arr_rename_at_11_4_ConstRef; das_zero(__arr_rename_at_11_4_ConstRef); das_move(__arr_rename_at_11_4_ConstRef, ((TArray<uint8_t>)das_invoke_function<TArray<uint8_t>>::invoke_cmres<uint32_t>(__context__,nullptr,Func(__context__->fnByMangledName(/*@utf8_utils::utf8_encode Cu*/ 0xae7be789d7396c3f)),0x42eu)));
+    TArray<uint8_t> const  & __arr_rename_at_11_4 = __arr_rename_at_11_4_ConstRef;
+;
+    DAS_ASSERT((das_equ_val(__arr_rename_at_11_4(0,__context__),0xd0)));
+    DAS_ASSERT((das_equ_val(__arr_rename_at_11_4(1,__context__),0xae)));
+    TArray<uint32_t> __codepoints1_rename_at_15_5_ConstRef; das_zero(__codepoints1_rename_at_15_5_ConstRef); das_move(__codepoints1_rename_at_15_5_ConstRef, ((TArray<uint32_t>)das_invoke_function<TArray<uint32_t>>::invoke_cmres<char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@utf8_utils::utf8_decode Cs*/ 0xda70a772757a0416)),((char *) "_xcd 1 \n\t~A"))));
+    TArray<uint32_t> const  & __codepoints1_rename_at_15_5 = __codepoints1_rename_at_15_5_ConstRef;
+;
+    DAS_ASSERT((builtin_array_size(__codepoints1_rename_at_15_5) == 11));
+    DAS_ASSERT((__codepoints1_rename_at_15_5(10,__context__) == 0x41u));
+    TArray<uint32_t> __codepoints2_rename_at_19_6; das_zero(__codepoints2_rename_at_19_6); das_move(__codepoints2_rename_at_19_6, das_invoke_function<TArray<uint32_t>>::invoke_cmres<char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@utf8_utils::utf8_decode Cs*/ 0xda70a772757a0416)),((char *) "Юникод \n\t~A")));
+    DAS_ASSERT((builtin_array_size(das_arg<TArray<uint32_t>>::pass(__codepoints2_rename_at_19_6)) == 11));
+    DAS_ASSERT((__codepoints2_rename_at_19_6(10,__context__) == 0x41u));
+    DAS_ASSERT((__codepoints2_rename_at_19_6(1,__context__) == 0x43du));
+    char * __s3_rename_at_24_7 = ((char *)(char *)(((char * const )(builtin_string_from_array(das_arg<TArray<uint8_t>>::pass((_temp_make_local_24_20_0 = (das_invoke_function<TArray<uint8_t>>::invoke_cmres<TArray<uint32_t> const  &>(__context__,nullptr,Func(__context__->fnByMangledName(/*@utf8_utils::utf8_encode CI1<u>A*/ 0x4115110af51d4c81)),das_arg<TArray<uint32_t>>::pass(__codepoints2_rename_at_19_6))))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__s3_rename_at_24_7),cast<char *>::from(((char *) "Юникод \n\t~A")),*__context__,nullptr)));
+    das_invoke_function<void>::invoke<TArray<uint32_t> &,char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@utf8_utils::utf8_decode 1<u>A Cs*/ 0xb3d7f12ee1cffeb6)),das_arg<TArray<uint32_t>>::pass(__codepoints2_rename_at_19_6),((char *) "Юникод \n\t~A"));
+    DAS_ASSERT((__codepoints2_rename_at_19_6(21,__context__) == 0x41u));
+    DAS_VERIFY((das_invoke_function<bool>::invoke<char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@utf8_utils::is_utf8_string_valid Cs*/ 0x32854a18ed87764e)),((char *) "_xcd 1 \n\t~A"))));
+    DAS_VERIFY((das_invoke_function<bool>::invoke<char * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@utf8_utils::is_utf8_string_valid Cs*/ 0x32854a18ed87764e)),nullptr)));
+    TArray<uint8_t> __invalidStr_rename_at_35_8_ConstRef; das_zero(__invalidStr_rename_at_35_8_ConstRef); das_move(__invalidStr_rename_at_35_8_ConstRef, ((TArray<uint8_t>)_FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4(__context__,das_arg<TDim<uint8_t,3>>::pass((([&]() -> TDim<uint8_t,3>& {
+        _temp_make_local_35_23_1(0,__context__) = 0x1f;
+        _temp_make_local_35_23_1(1,__context__) = 0xff;
+        _temp_make_local_35_23_1(2,__context__) = 0xff;
+        return _temp_make_local_35_23_1;
+    })())))));
+    TArray<uint8_t> const  & __invalidStr_rename_at_35_8 = __invalidStr_rename_at_35_8_ConstRef;
+;
+    DAS_VERIFY((!das_invoke_function<bool>::invoke<TArray<uint8_t> const  &>(__context__,nullptr,Func(__context__->fnByMangledName(/*@utf8_utils::is_utf8_string_valid CI1<u8>A*/ 0x33817f617efda2e2)),__invalidStr_rename_at_35_8)));
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 ( Context * __context__ ) {
+    TArray<uint8_t> &  arg_Arr = cast_aot_arg<TArray<uint8_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 ( Context * __context__ ) {
+    TDim<uint8_t,3> &  arg_a = cast_aot_arg<TDim<uint8_t,3> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<uint8_t> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap_test_b2be5cfe4eeb3e66 ( Context * __context__ ) {
+    return cast<bool>::from(test_b2be5cfe4eeb3e66(__context__));
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x43319db4719733d6, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_bdb96b229e3c3111 },
+    { 0x60b407c06982729e, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_1da454fea53788d4 },
+    { 0x7281ef6d1e2212ba, false, (void*)&test_b2be5cfe4eeb3e66, &__wrap_test_b2be5cfe4eeb3e66 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x6ca34163b1890ae, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_7009968312953072590
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
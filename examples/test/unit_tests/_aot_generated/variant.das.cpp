@@ -0,0 +1,542 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_6943714441384312876 {
+
+namespace  { struct Foo; };
+// unused enumeration GooEnum
+// unused enumeration OpCode
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+namespace  {
+
+struct Foo {
+    TVariant<8,4,uint32_t,float> * t;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,t)==0,"structure field offset mismatch with DAS");
+}
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__bcb97beea857e3e;
+extern TypeInfo __type_info__c4e7914a3746eb3e;
+extern TypeInfo __type_info__a3f0477a4765213e;
+extern TypeInfo __type_info__af63e44c8601fa24;
+
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__bcb97beea857e3e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xbcb97beea857e3e) };
+TypeInfo __type_info__c4e7914a3746eb3e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xc4e7914a3746eb3e) };
+TypeInfo __type_info__a3f0477a4765213e = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xa3f0477a4765213e) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__a3f0477a4765213e, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_1[2] = { &__type_info__bcb97beea857e3e, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_2[2] = { &__type_info__c4e7914a3746eb3e, &__type_info__af90fe4c864e9d52 };
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_f05dd6444235a256 ( Context * __context__, TArray<TVariant<8,4,uint32_t,float>> & __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 );
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_68_2, int32_t __newSize_rename_at_68_3 );
+inline void _FuncbuiltinTickclearTick13739625760977891612_243ead22ad1f8cc7 ( Context * __context__, TTable<int32_t,int32_t> & __t_rename_at_2083_4 );
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickkeysTick3875137551537175793_c0952ed921f174be ( Context * __context__, TTable<int32_t,int32_t> const  & __a_rename_at_1275_5 );
+inline Sequence DAS_COMMENT((int32_t &)) _FuncbuiltinTickvaluesTick1935193042646774172_457cc1cb2942a1fc ( Context * __context__, TTable<int32_t,int32_t> const  & __a_rename_at_1297_7 );
+inline void _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__, TArray<int32_t> & __a_rename_at_1142_9, TArray<int32_t> const  & __b_rename_at_1142_10 );
+inline void _FuncbuiltinTickcloneTick3639321672465200741_fd981e34e5b76c3c ( Context * __context__, TTable<int32_t,int32_t> & __a_rename_at_1174_12, TTable<int32_t,int32_t> const  & __b_rename_at_1174_13 );
+inline TArray<TVariant<8,4,uint32_t,float>> _FuncbuiltinTickto_array_moveTick3185538323411982277_c43c8422dba306ed ( Context * __context__, TDim<TVariant<8,4,uint32_t,float>,2> & __a_rename_at_1502_18 );
+inline TArray<int32_t> & _FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 ( Context * __context__, TArray<int32_t> & __a_rename_at_50_20 );
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd ( Context * __context__, TArray<int32_t> & __a_rename_at_1336_21 );
+inline void _FuncbuiltinTickfinalizeTick5454204887383796109_95380cba065ea7d3 ( Context * __context__, TTable<int32_t,int32_t> & __a_rename_at_1347_22 );
+inline void _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5 ( Context * __context__, TArray<int32_t> & __a_rename_at_32_23, TArray<int32_t> & __b_rename_at_32_24 );
+inline TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> _FuncbuiltinTickclone_to_moveTick17180087396728260876_660449fd5f8ef554 ( Context * __context__, TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> & __clone_src_rename_at_1118_25 );
+inline void _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_177_27, int32_t __value_rename_at_177_28 );
+inline void finalize_93289e36ea24365b ( Context * __context__, TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> & ____this_rename_at_132_29 );
+inline void test_ifs_ac2c423fa771882e ( Context * __context__ );
+inline bool test_short_notation_3f15008aa414cc58 ( Context * __context__ );
+inline bool test_c7d647f84ed3351d ( Context * __context__ );
+inline void clone_3e1a6f84f25845a9 ( Context * __context__, TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> & __dest_rename_at_1121_44, TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> const  & __src_rename_at_1121_45 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_f05dd6444235a256 ( Context * __context__, TArray<TVariant<8,4,uint32_t,float>> &  __Arr_rename_at_68_0, int32_t __newSize_rename_at_68_1 )
+{
+    builtin_array_resize(das_arg<TArray<TVariant<8,4,uint32_t,float>>>::pass(__Arr_rename_at_68_0),__newSize_rename_at_68_1,8,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_68_2, int32_t __newSize_rename_at_68_3 )
+{
+    builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_68_2),__newSize_rename_at_68_3,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickclearTick13739625760977891612_243ead22ad1f8cc7 ( Context * __context__, TTable<int32_t,int32_t> &  __t_rename_at_2083_4 )
+{
+    builtin_table_clear(das_arg<TTable<int32_t,int32_t>>::pass(__t_rename_at_2083_4),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _FuncbuiltinTickkeysTick3875137551537175793_c0952ed921f174be ( Context * __context__, TTable<int32_t,int32_t> const  &  __a_rename_at_1275_5 )
+{
+    Sequence DAS_COMMENT((int32_t)) __it_rename_at_1276_6;das_zero(__it_rename_at_1276_6);
+    builtin_table_keys(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_1276_6),__a_rename_at_1275_5,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_1276_6);
+}
+
+inline Sequence DAS_COMMENT((int32_t &)) _FuncbuiltinTickvaluesTick1935193042646774172_457cc1cb2942a1fc ( Context * __context__, TTable<int32_t,int32_t> const  &  __a_rename_at_1297_7 )
+{
+    Sequence DAS_COMMENT((int32_t *)) __it_rename_at_1298_8;das_zero(__it_rename_at_1298_8);
+    builtin_table_values(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_1298_8),__a_rename_at_1297_7,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t &))>::cast(__it_rename_at_1298_8);
+}
+
+inline void _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__, TArray<int32_t> &  __a_rename_at_1142_9, TArray<int32_t> const  &  __b_rename_at_1142_10 )
+{
+    int32_t __ln_rename_at_1143_11 = ((int32_t)builtin_array_size(__b_rename_at_1142_10));
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_1142_9),__ln_rename_at_1143_11);
+    if ( __ln_rename_at_1143_11 == 0 )
+    {
+        return ;
+    } else {
+        das_memcpy(das_auto_cast<void * const >::cast(das_ref(__context__,__a_rename_at_1142_9(0,__context__))),das_auto_cast<void * const >::cast(das_ref(__context__,__b_rename_at_1142_10(0,__context__))),__ln_rename_at_1143_11 * 4);
+    };
+}
+
+inline void _FuncbuiltinTickcloneTick3639321672465200741_fd981e34e5b76c3c ( Context * __context__, TTable<int32_t,int32_t> &  __a_rename_at_1174_12, TTable<int32_t,int32_t> const  &  __b_rename_at_1174_13 )
+{
+    Sequence DAS_COMMENT((int32_t)) _temp_make_local_1176_17_0; _temp_make_local_1176_17_0;
+    Sequence DAS_COMMENT((int32_t *)) _temp_make_local_1176_26_1; _temp_make_local_1176_26_1;
+    _FuncbuiltinTickclearTick13739625760977891612_243ead22ad1f8cc7(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_1174_12));
+    {
+        bool __need_loop_1176 = true;
+        // k: int
+        das_iterator<Sequence DAS_COMMENT((int32_t))> __k_iterator((_temp_make_local_1176_17_0 = (_FuncbuiltinTickkeysTick3875137551537175793_c0952ed921f174be(__context__,__b_rename_at_1174_13))));
+        int32_t __k_rename_at_1176_16;
+        __need_loop_1176 = __k_iterator.first(__context__,(__k_rename_at_1176_16)) && __need_loop_1176;
+        // v: int const&
+        das_iterator<Sequence DAS_COMMENT((int32_t const ))> __v_iterator((_temp_make_local_1176_26_1 = (_FuncbuiltinTickvaluesTick1935193042646774172_457cc1cb2942a1fc(__context__,__b_rename_at_1174_13))));
+        int32_t const  * __v_rename_at_1176_17;
+        __need_loop_1176 = __v_iterator.first(__context__,(__v_rename_at_1176_17)) && __need_loop_1176;
+        for ( ; __need_loop_1176 ; __need_loop_1176 = __k_iterator.next(__context__,(__k_rename_at_1176_16)) && __v_iterator.next(__context__,(__v_rename_at_1176_17)) )
+        {
+            das_copy(__a_rename_at_1174_12(__k_rename_at_1176_16,__context__),(*__v_rename_at_1176_17));
+        }
+        __v_iterator.close(__context__,(__v_rename_at_1176_17));
+        __k_iterator.close(__context__,(__k_rename_at_1176_16));
+    };
+}
+
+inline TArray<TVariant<8,4,uint32_t,float>> _FuncbuiltinTickto_array_moveTick3185538323411982277_c43c8422dba306ed ( Context * __context__, TDim<TVariant<8,4,uint32_t,float>,2> &  __a_rename_at_1502_18 )
+{
+    TArray<TVariant<8,4,uint32_t,float>> __arr_rename_at_1504_19;das_zero(__arr_rename_at_1504_19);
+    _FuncbuiltinTickresizeTick4811697762258667383_f05dd6444235a256(__context__,das_arg<TArray<TVariant<8,4,uint32_t,float>>>::pass(__arr_rename_at_1504_19),2);
+    das_copy(das_cast<TDim<TVariant<8,4,uint32_t,float>,2>>::cast(das_ref(__context__,__arr_rename_at_1504_19(0,__context__))),__a_rename_at_1502_18);
+    return /* <- */ das_auto_cast_move<TArray<TVariant<8,4,uint32_t,float>>>::cast(__arr_rename_at_1504_19);
+}
+
+inline TArray<int32_t> & _FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 ( Context * __context__, TArray<int32_t> &  __a_rename_at_50_20 )
+{
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<TArray<int32_t> &>::from(__a_rename_at_50_20),cast<char * const >::from(((char *) "object can't be returned because it is locked"))));
+    return das_auto_cast_ref<TArray<int32_t> &>::cast(__a_rename_at_50_20);
+}
+
+inline void _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd ( Context * __context__, TArray<int32_t> &  __a_rename_at_1336_21 )
+{
+    builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_1336_21),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTickfinalizeTick5454204887383796109_95380cba065ea7d3 ( Context * __context__, TTable<int32_t,int32_t> &  __a_rename_at_1347_22 )
+{
+    builtin_table_free(das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_1347_22),4,4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5 ( Context * __context__, TArray<int32_t> &  __a_rename_at_32_23, TArray<int32_t> &  __b_rename_at_32_24 )
+{
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<TArray<int32_t> &>::from(__a_rename_at_32_23),cast<char * const >::from(((char *) "object can't be moved to because it is locked"))));
+    das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<2>(__tinfo_2,cast<TArray<int32_t> &>::from(__b_rename_at_32_24),cast<char * const >::from(((char *) "object can't be moved from because it is locked"))));
+    das_move(__a_rename_at_32_23,__b_rename_at_32_24);
+}
+
+inline TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> _FuncbuiltinTickclone_to_moveTick17180087396728260876_660449fd5f8ef554 ( Context * __context__, TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> &  __clone_src_rename_at_1118_25 )
+{
+    TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> __clone_dest_rename_at_1120_26;das_zero(__clone_dest_rename_at_1120_26);
+    clone_3e1a6f84f25845a9(__context__,das_arg<TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::pass(__clone_dest_rename_at_1120_26),das_arg<TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::pass(__clone_src_rename_at_1118_25));
+    return /* <- */ das_auto_cast_move<TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::cast(__clone_dest_rename_at_1120_26);
+}
+
+inline void _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_177_27, int32_t __value_rename_at_177_28 )
+{
+    das_copy(__Arr_rename_at_177_27(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_177_27),4,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))),__context__),__value_rename_at_177_28);
+}
+
+inline void finalize_93289e36ea24365b ( Context * __context__, TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> &  ____this_rename_at_132_29 )
+{
+    if ( das_get_variant_field<TArray<int32_t>,8,1>::is(____this_rename_at_132_29) )
+    {
+        _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd(__context__,das_arg<TArray<int32_t>>::pass(das_get_variant_field<TArray<int32_t>,8,1>::get(____this_rename_at_132_29)));
+    } else if ( das_get_variant_field<TTable<int32_t,int32_t>,8,3>::is(____this_rename_at_132_29) )
+    {
+        _FuncbuiltinTickfinalizeTick5454204887383796109_95380cba065ea7d3(__context__,das_arg<TTable<int32_t,int32_t>>::pass(das_get_variant_field<TTable<int32_t,int32_t>,8,3>::get(____this_rename_at_132_29)));
+    };
+    memset((void*)&(____this_rename_at_132_29), 0, 56);
+}
+
+inline void test_ifs_ac2c423fa771882e ( Context * __context__ )
+{
+    TVariant<16,8,int32_t,float,char *> __i_rename_at_18_30_ConstRef = ((TVariant<16,8,int32_t,float,char *>)das_alias<SampleVariant>::from(das_alias<SampleVariant>::from(makeSampleI())));
+    TVariant<16,8,int32_t,float,char *> const  & __i_rename_at_18_30 = __i_rename_at_18_30_ConstRef;
+;
+    DAS_ASSERT((das_get_variant_field<int32_t,8,0>::is(__i_rename_at_18_30)));
+    DAS_ASSERT((das_get_variant_field<int32_t,8,0>::as(__i_rename_at_18_30,__context__) == 1));
+    TVariant<16,8,int32_t,float,char *> __f_rename_at_21_31_ConstRef = ((TVariant<16,8,int32_t,float,char *>)das_alias<SampleVariant>::from(das_alias<SampleVariant>::from(makeSampleF())));
+    TVariant<16,8,int32_t,float,char *> const  & __f_rename_at_21_31 = __f_rename_at_21_31_ConstRef;
+;
+    DAS_ASSERT((das_get_variant_field<float,8,1>::is(__f_rename_at_21_31)));
+    DAS_ASSERT((das_get_variant_field<float,8,1>::as(__f_rename_at_21_31,__context__) == 2.000000e+00f));
+    TVariant<16,8,int32_t,float,char *> __s_rename_at_24_32_ConstRef = ((TVariant<16,8,int32_t,float,char *>)das_alias<SampleVariant>::from(das_alias<SampleVariant>::from(makeSampleS())));
+    TVariant<16,8,int32_t,float,char *> const  & __s_rename_at_24_32 = __s_rename_at_24_32_ConstRef;
+;
+    DAS_ASSERT((das_get_variant_field<char *,8,2>::is(__s_rename_at_24_32)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_get_variant_field<char *,8,2>::as(__s_rename_at_24_32,__context__)),cast<char *>::from(((char *) "3")),*__context__,nullptr)));
+}
+
+inline bool test_short_notation_3f15008aa414cc58 ( Context * __context__ )
+{
+    TVariant<16,8,int32_t,char *> __e_rename_at_37_33_ConstRef = ((TVariant<16,8,int32_t,char *>)(([&]() -> TVariant<16,8,int32_t,char *> {
+        TVariant<16,8,int32_t,char *> __mkv_37;
+        das_get_variant_field<int32_t,8,0>::set(__mkv_37) = 1;
+        return __mkv_37;
+    })()));
+    TVariant<16,8,int32_t,char *> const  & __e_rename_at_37_33 = __e_rename_at_37_33_ConstRef;
+;
+    DAS_ASSERT((das_get_variant_field<int32_t,8,0>::is(__e_rename_at_37_33)));
+    DAS_ASSERT((das_get_variant_field<int32_t,8,0>::as(__e_rename_at_37_33,__context__) == 1));
+    TDim<TVariant<16,8,int32_t,char *>,2> __ee_rename_at_40_34_ConstRef = ((TDim<TVariant<16,8,int32_t,char *>,2>)(([&]() -> TDim<TVariant<16,8,int32_t,char *>,2> {
+        TDim<TVariant<16,8,int32_t,char *>,2> __mkv_40;
+        das_get_variant_field<int32_t,8,0>::set(__mkv_40(0,__context__)) = 1;
+        das_get_variant_field<char *,8,1>::set(__mkv_40(1,__context__)) = ((char *) "2");
+        return __mkv_40;
+    })()));
+    TDim<TVariant<16,8,int32_t,char *>,2> const  & __ee_rename_at_40_34 = __ee_rename_at_40_34_ConstRef;
+;
+    DAS_ASSERT((das_get_variant_field<int32_t,8,0>::is(__ee_rename_at_40_34(0,__context__)) && (das_get_variant_field<int32_t,8,0>::as(__ee_rename_at_40_34(0,__context__),__context__) == 1)));
+    DAS_ASSERT((das_get_variant_field<char *,8,1>::is(__ee_rename_at_40_34(1,__context__)) && (SimPolicy<char *>::Equ(cast<char *>::from(das_get_variant_field<char *,8,1>::as(__ee_rename_at_40_34(1,__context__),__context__)),cast<char *>::from(((char *) "2")),*__context__,nullptr))));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline bool test_c7d647f84ed3351d ( Context * __context__ )
+{
+    TDim<TVariant<8,4,uint32_t,float>,2> _temp_make_local_104_13_2; _temp_make_local_104_13_2;
+    TVariant<8,4,uint32_t,float> __t_rename_at_51_35;das_zero(__t_rename_at_51_35);
+    das_copy(das_get_variant_field<float,4,1>::get(__t_rename_at_51_35),1.000000e+00f);
+    DAS_ASSERT((das_get_variant_field<uint32_t,4,0>::get(__t_rename_at_51_35) == 0x3f800000u));
+    DAS_ASSERT((variant_index(das_arg<TVariant<8,4,uint32_t,float>>::pass(__t_rename_at_51_35)) == 0));
+    DAS_ASSERT((das_get_variant_field<uint32_t,4,0>::is(__t_rename_at_51_35)));
+    DAS_ASSERT((das_get_variant_field<uint32_t,4,0>::as(__t_rename_at_51_35,__context__) == 0x3f800000u));
+    set_variant_index(das_arg<TVariant<8,4,uint32_t,float>>::pass(__t_rename_at_51_35),1);
+    DAS_ASSERT((das_get_variant_field<float,4,1>::as(__t_rename_at_51_35,__context__) == 1.000000e+00f));
+    DAS_ASSERT((das_null_coalescing<float>::get(das_get_variant_field<float,4,1>::safe_as(__t_rename_at_51_35),2.000000e+00f) == 1.000000e+00f));
+    DAS_ASSERT((das_null_coalescing<uint32_t>::get(das_get_variant_field<uint32_t,4,0>::safe_as(__t_rename_at_51_35),0x1u) == 0x1u));
+    das_copy(das_get_variant_field<float,4,1>::as(__t_rename_at_51_35,__context__),2.000000e+00f);
+    set_variant_index(das_arg<TVariant<8,4,uint32_t,float>>::pass(__t_rename_at_51_35),0);
+    DAS_ASSERT((das_get_variant_field<uint32_t,4,0>::as(__t_rename_at_51_35,__context__) == 0x40000000u));
+    das_copy(das_get_variant_field<uint32_t,4,0>::as(__t_rename_at_51_35,__context__),0x3f800000u);
+    set_variant_index(das_arg<TVariant<8,4,uint32_t,float>>::pass(__t_rename_at_51_35),1);
+    DAS_ASSERT((das_get_variant_field<float,4,1>::as(__t_rename_at_51_35,__context__) == 1.000000e+00f));
+    bool __paniced_rename_at_89_36 = false;
+    das_try_recover(__context__, [&]()
+    {
+        das_copy(das_get_variant_field<uint32_t,4,0>::as(__t_rename_at_51_35,__context__),0x40000000u);
+    }, [&]()
+    {
+        das_copy(__paniced_rename_at_89_36,true);
+    });
+    DAS_ASSERT((__paniced_rename_at_89_36));
+    DAS_ASSERT((das_get_variant_field<float,4,1>::get(__t_rename_at_51_35) == 1.000000e+00f));
+    das_copy(__t_rename_at_51_35,(([&]() -> TVariant<8,4,uint32_t,float> {
+        TVariant<8,4,uint32_t,float> __mkv_100;
+        das_get_variant_field<uint32_t,4,0>::set(__mkv_100) = 0x40000000u;
+        return __mkv_100;
+    })()));
+    DAS_ASSERT((das_get_variant_field<uint32_t,4,0>::as(__t_rename_at_51_35,__context__) == 0x40000000u));
+    das_copy(__t_rename_at_51_35,(([&]() -> TVariant<8,4,uint32_t,float> {
+        TVariant<8,4,uint32_t,float> __mkv_102;
+        das_get_variant_field<float,4,1>::set(__mkv_102) = 1.000000e+00f;
+        return __mkv_102;
+    })()));
+    TArray<TVariant<8,4,uint32_t,float>> __t2_rename_at_104_37; das_zero(__t2_rename_at_104_37); das_move(__t2_rename_at_104_37, _FuncbuiltinTickto_array_moveTick3185538323411982277_c43c8422dba306ed(__context__,das_arg<TDim<TVariant<8,4,uint32_t,float>,2>>::pass((([&]() -> TDim<TVariant<8,4,uint32_t,float>,2>& {
+        das_get_variant_field<uint32_t,4,0>::set(_temp_make_local_104_13_2(0,__context__)) = 0x1u;
+        das_get_variant_field<float,4,1>::set(_temp_make_local_104_13_2(1,__context__)) = 2.000000e+00f;
+        return _temp_make_local_104_13_2;
+    })()))));
+    DAS_ASSERT((builtin_array_size(das_arg<TArray<TVariant<8,4,uint32_t,float>>>::pass(__t2_rename_at_104_37)) == 2));
+    DAS_ASSERT((das_get_variant_field<uint32_t,4,0>::is(__t2_rename_at_104_37(0,__context__)) && (das_get_variant_field<uint32_t,4,0>::as(__t2_rename_at_104_37(0,__context__),__context__) == 0x1u)));
+    DAS_ASSERT((das_get_variant_field<float,4,1>::is(__t2_rename_at_104_37(1,__context__)) && (das_get_variant_field<float,4,1>::as(__t2_rename_at_104_37(1,__context__),__context__) == 2.000000e+00f)));
+    TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> __x_rename_at_122_38;das_zero(__x_rename_at_122_38);
+    set_variant_index(das_arg<TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::pass(__x_rename_at_122_38),1);
+    _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5(__context__,das_arg<TArray<int32_t>>::pass(das_get_variant_field<TArray<int32_t>,8,1>::get(__x_rename_at_122_38)),das_arg<TArray<int32_t>>::pass(das_invoke<TArray<int32_t>>::invoke_cmres(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> TArray<int32_t>{
+        TArray<int32_t> ____acomp_125_16_rename_at_125_39;das_zero(____acomp_125_16_rename_at_125_39);
+        builtin_set_verify_array_locks(das_arg<TArray<int32_t>>::pass(____acomp_125_16_rename_at_125_39),false);
+        {
+            bool __need_loop_125 = true;
+            // tt: int const
+            das_iterator<range> __tt_iterator(range(0,10));
+            int32_t __tt_rename_at_125_40;
+            __need_loop_125 = __tt_iterator.first(__context__,(__tt_rename_at_125_40)) && __need_loop_125;
+            for ( ; __need_loop_125 ; __need_loop_125 = __tt_iterator.next(__context__,(__tt_rename_at_125_40)) )
+            {
+                _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__,das_arg<TArray<int32_t>>::pass(____acomp_125_16_rename_at_125_39),__tt_rename_at_125_40);
+            }
+            __tt_iterator.close(__context__,(__tt_rename_at_125_40));
+        };
+        builtin_set_verify_array_locks(das_arg<TArray<int32_t>>::pass(____acomp_125_16_rename_at_125_39),true);
+        return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14(__context__,das_arg<TArray<int32_t>>::pass(____acomp_125_16_rename_at_125_39)));
+    })));
+    TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> __y_rename_at_127_41; das_zero(__y_rename_at_127_41); das_move(__y_rename_at_127_41, _FuncbuiltinTickclone_to_moveTick17180087396728260876_660449fd5f8ef554(__context__,das_arg<TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::pass(__x_rename_at_122_38)));
+    DAS_ASSERT((das_get_variant_field<TArray<int32_t>,8,1>::is(__y_rename_at_127_41)));
+    {
+        bool __need_loop_129 = true;
+        // tt: int const
+        das_iterator<range> __tt_iterator(range(0,10));
+        int32_t __tt_rename_at_129_42;
+        __need_loop_129 = __tt_iterator.first(__context__,(__tt_rename_at_129_42)) && __need_loop_129;
+        for ( ; __need_loop_129 ; __need_loop_129 = __tt_iterator.next(__context__,(__tt_rename_at_129_42)) )
+        {
+            DAS_ASSERT((das_get_variant_field<TArray<int32_t>,8,1>::as(__y_rename_at_127_41,__context__)(__tt_rename_at_129_42,__context__) == __tt_rename_at_129_42));
+        }
+        __tt_iterator.close(__context__,(__tt_rename_at_129_42));
+    };
+    finalize_93289e36ea24365b(__context__,das_arg<TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::pass(__x_rename_at_122_38));
+    DAS_ASSERT((das_get_variant_field<int32_t,8,0>::is(__x_rename_at_122_38)));
+    DAS_ASSERT((das_get_variant_field<TArray<int32_t>,8,1>::is(__y_rename_at_127_41)));
+    {
+        bool __need_loop_135 = true;
+        // tt: int const
+        das_iterator<range> __tt_iterator(range(0,10));
+        int32_t __tt_rename_at_135_43;
+        __need_loop_135 = __tt_iterator.first(__context__,(__tt_rename_at_135_43)) && __need_loop_135;
+        for ( ; __need_loop_135 ; __need_loop_135 = __tt_iterator.next(__context__,(__tt_rename_at_135_43)) )
+        {
+            DAS_ASSERT((das_get_variant_field<TArray<int32_t>,8,1>::as(__y_rename_at_127_41,__context__)(__tt_rename_at_135_43,__context__) == __tt_rename_at_135_43));
+        }
+        __tt_iterator.close(__context__,(__tt_rename_at_135_43));
+    };
+    test_ifs_ac2c423fa771882e(__context__);
+    test_short_notation_3f15008aa414cc58(__context__);
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline void clone_3e1a6f84f25845a9 ( Context * __context__, TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> &  __dest_rename_at_1121_44, TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> const  &  __src_rename_at_1121_45 )
+{
+    if ( das_get_variant_field<int32_t,8,0>::is(__src_rename_at_1121_45) )
+    {
+        set_variant_index(das_arg<TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::pass(__dest_rename_at_1121_44),0);
+        das_copy(das_get_variant_field<int32_t,8,0>::get(__dest_rename_at_1121_44),das_get_variant_field<int32_t,8,0>::get(__src_rename_at_1121_45));
+    } else if ( das_get_variant_field<TArray<int32_t>,8,1>::is(__src_rename_at_1121_45) )
+    {
+        set_variant_index(das_arg<TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::pass(__dest_rename_at_1121_44),1);
+        _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62(__context__,das_arg<TArray<int32_t>>::pass(das_get_variant_field<TArray<int32_t>,8,1>::get(__dest_rename_at_1121_44)),das_get_variant_field<TArray<int32_t>,8,1>::get(__src_rename_at_1121_45));
+    } else if ( das_get_variant_field<float,8,2>::is(__src_rename_at_1121_45) )
+    {
+        set_variant_index(das_arg<TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::pass(__dest_rename_at_1121_44),2);
+        das_copy(das_get_variant_field<float,8,2>::get(__dest_rename_at_1121_44),das_get_variant_field<float,8,2>::get(__src_rename_at_1121_45));
+    } else if ( das_get_variant_field<TTable<int32_t,int32_t>,8,3>::is(__src_rename_at_1121_45) )
+    {
+        set_variant_index(das_arg<TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::pass(__dest_rename_at_1121_44),3);
+        _FuncbuiltinTickcloneTick3639321672465200741_fd981e34e5b76c3c(__context__,das_arg<TTable<int32_t,int32_t>>::pass(das_get_variant_field<TTable<int32_t,int32_t>,8,3>::get(__dest_rename_at_1121_44)),das_get_variant_field<TTable<int32_t,int32_t>,8,3>::get(__src_rename_at_1121_45));
+    };
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_f05dd6444235a256 ( Context * __context__ ) {
+    TArray<TVariant<8,4,uint32_t,float>> &  arg_Arr = cast_aot_arg<TArray<TVariant<8,4,uint32_t,float>> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_f05dd6444235a256(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_newSize = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c(__context__, arg_Arr, arg_newSize);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickclearTick13739625760977891612_243ead22ad1f8cc7 ( Context * __context__ ) {
+    TTable<int32_t,int32_t> &  arg_t = cast_aot_arg<TTable<int32_t,int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickclearTick13739625760977891612_243ead22ad1f8cc7(__context__, arg_t);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickkeysTick3875137551537175793_c0952ed921f174be ( Context * __context__ ) {
+    TTable<int32_t,int32_t> const  &  arg_a = cast_aot_arg<TTable<int32_t,int32_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t)) *) __context__->abiCMRES) = _FuncbuiltinTickkeysTick3875137551537175793_c0952ed921f174be(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickvaluesTick1935193042646774172_457cc1cb2942a1fc ( Context * __context__ ) {
+    TTable<int32_t,int32_t> const  &  arg_a = cast_aot_arg<TTable<int32_t,int32_t> const  & >::to(*__context__,__context__->abiArguments()[0]);
+    *((Sequence DAS_COMMENT((int32_t &)) *) __context__->abiCMRES) = _FuncbuiltinTickvaluesTick1935193042646774172_457cc1cb2942a1fc(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> const  &  arg_b = cast_aot_arg<TArray<int32_t> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickcloneTick3639321672465200741_fd981e34e5b76c3c ( Context * __context__ ) {
+    TTable<int32_t,int32_t> &  arg_a = cast_aot_arg<TTable<int32_t,int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    TTable<int32_t,int32_t> const  &  arg_b = cast_aot_arg<TTable<int32_t,int32_t> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickcloneTick3639321672465200741_fd981e34e5b76c3c(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_c43c8422dba306ed ( Context * __context__ ) {
+    TDim<TVariant<8,4,uint32_t,float>,2> &  arg_a = cast_aot_arg<TDim<TVariant<8,4,uint32_t,float>,2> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TArray<TVariant<8,4,uint32_t,float>> *) __context__->abiCMRES) = _FuncbuiltinTickto_array_moveTick3185538323411982277_c43c8422dba306ed(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    return cast<TArray<int32_t> &>::from(_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14(__context__, arg_a));
+}
+static vec4f __wrap__FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickfinalizeTick5454204887383796109_95380cba065ea7d3 ( Context * __context__ ) {
+    TTable<int32_t,int32_t> &  arg_a = cast_aot_arg<TTable<int32_t,int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    _FuncbuiltinTickfinalizeTick5454204887383796109_95380cba065ea7d3(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_a = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    TArray<int32_t> &  arg_b = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5(__context__, arg_a, arg_b);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickclone_to_moveTick17180087396728260876_660449fd5f8ef554 ( Context * __context__ ) {
+    TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> &  arg_clone_src = cast_aot_arg<TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> & >::to(*__context__,__context__->abiArguments()[0]);
+    *((TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> *) __context__->abiCMRES) = _FuncbuiltinTickclone_to_moveTick17180087396728260876_660449fd5f8ef554(__context__, arg_clone_src);
+    return v_zero();
+}
+static vec4f __wrap__FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 ( Context * __context__ ) {
+    TArray<int32_t> &  arg_Arr = cast_aot_arg<TArray<int32_t> & >::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_value = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39(__context__, arg_Arr, arg_value);
+    return v_zero();
+}
+static vec4f __wrap_finalize_93289e36ea24365b ( Context * __context__ ) {
+    TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> &  arg___this = cast_aot_arg<TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> & >::to(*__context__,__context__->abiArguments()[0]);
+    finalize_93289e36ea24365b(__context__, arg___this);
+    return v_zero();
+}
+static vec4f __wrap_test_ifs_ac2c423fa771882e ( Context * __context__ ) {
+    test_ifs_ac2c423fa771882e(__context__);
+    return v_zero();
+}
+static vec4f __wrap_test_short_notation_3f15008aa414cc58 ( Context * __context__ ) {
+    return cast<bool>::from(test_short_notation_3f15008aa414cc58(__context__));
+}
+static vec4f __wrap_test_c7d647f84ed3351d ( Context * __context__ ) {
+    return cast<bool>::from(test_c7d647f84ed3351d(__context__));
+}
+static vec4f __wrap_clone_3e1a6f84f25845a9 ( Context * __context__ ) {
+    TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> &  arg_dest = cast_aot_arg<TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> & >::to(*__context__,__context__->abiArguments()[0]);
+    TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> const  &  arg_src = cast_aot_arg<TVariant<56,8,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> const  & >::to(*__context__,__context__->abiArguments()[1]);
+    clone_3e1a6f84f25845a9(__context__, arg_dest, arg_src);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x71fffe12383d622a, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_f05dd6444235a256, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_f05dd6444235a256 },
+    { 0xa51a880d594e91fd, false, (void*)&_FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c, &__wrap__FuncbuiltinTickresizeTick4811697762258667383_2acb50e8203df3c },
+    { 0xe2d393f70356a563, false, (void*)&_FuncbuiltinTickclearTick13739625760977891612_243ead22ad1f8cc7, &__wrap__FuncbuiltinTickclearTick13739625760977891612_243ead22ad1f8cc7 },
+    { 0xf33d6f9fcaf1efc1, true, (void*)&_FuncbuiltinTickkeysTick3875137551537175793_c0952ed921f174be, &__wrap__FuncbuiltinTickkeysTick3875137551537175793_c0952ed921f174be },
+    { 0x7eddb90e720a0f2e, true, (void*)&_FuncbuiltinTickvaluesTick1935193042646774172_457cc1cb2942a1fc, &__wrap__FuncbuiltinTickvaluesTick1935193042646774172_457cc1cb2942a1fc },
+    { 0xca1141a5df264c9, false, (void*)&_FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62, &__wrap__FuncbuiltinTickcloneTick3038771811667655495_c5e2718347b74a62 },
+    { 0xbbd8b16cc01c1fef, false, (void*)&_FuncbuiltinTickcloneTick3639321672465200741_fd981e34e5b76c3c, &__wrap__FuncbuiltinTickcloneTick3639321672465200741_fd981e34e5b76c3c },
+    { 0xc6883a08f92c315b, true, (void*)&_FuncbuiltinTickto_array_moveTick3185538323411982277_c43c8422dba306ed, &__wrap__FuncbuiltinTickto_array_moveTick3185538323411982277_c43c8422dba306ed },
+    { 0x17892cd516a9a747, false, (void*)&_FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14, &__wrap__FuncbuiltinTick_return_with_lockcheckTick2939372000839727345_a64d694b89d3de14 },
+    { 0x84908fa671ce3a30, false, (void*)&_FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd, &__wrap__FuncbuiltinTickfinalizeTick13836114024949725080_3ad9824da09a5cdd },
+    { 0xf4fe2d8abea19ced, false, (void*)&_FuncbuiltinTickfinalizeTick5454204887383796109_95380cba065ea7d3, &__wrap__FuncbuiltinTickfinalizeTick5454204887383796109_95380cba065ea7d3 },
+    { 0x5e8700914eff1e69, false, (void*)&_FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5, &__wrap__FuncbuiltinTick_move_with_lockcheckTick3467971516570048129_86b27159b6c83eb5 },
+    { 0x8a61791607d96114, true, (void*)&_FuncbuiltinTickclone_to_moveTick17180087396728260876_660449fd5f8ef554, &__wrap__FuncbuiltinTickclone_to_moveTick17180087396728260876_660449fd5f8ef554 },
+    { 0xbf77bb210b0552bc, false, (void*)&_FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39, &__wrap__FuncbuiltinTickpushTick14133213201864676143_22eb7ae85be5bb39 },
+    { 0x1a665e71591a0fd5, false, (void*)&finalize_93289e36ea24365b, &__wrap_finalize_93289e36ea24365b },
+    { 0x607a10c8c37c2066, false, (void*)&test_ifs_ac2c423fa771882e, &__wrap_test_ifs_ac2c423fa771882e },
+    { 0xa9d62763ed96d901, false, (void*)&test_short_notation_3f15008aa414cc58, &__wrap_test_short_notation_3f15008aa414cc58 },
+    { 0x7d10a7b2bf125db0, false, (void*)&test_c7d647f84ed3351d, &__wrap_test_c7d647f84ed3351d },
+    { 0x560cbebbe18380f2, false, (void*)&clone_3e1a6f84f25845a9, &__wrap_clone_3e1a6f84f25845a9 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_6943714441384312876
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,127 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_948819972822380974 {
+
+namespace  { struct ResUid; };
+namespace  { struct VirtualAttachmentRequest; };
+namespace  {
+
+struct ResUid {
+    uint32_t nameId;
+    bool history;
+};
+static_assert(sizeof(ResUid)==8,"structure size mismatch with DAS");
+static_assert(offsetof(ResUid,nameId)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(ResUid,history)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct VirtualAttachmentRequest {
+    TVariant<16,8,ResUid,char *> resource;
+    uint16_t mipLevel;
+    uint16_t layer;
+};
+static_assert(sizeof(VirtualAttachmentRequest)==24,"structure size mismatch with DAS");
+static_assert(offsetof(VirtualAttachmentRequest,resource)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(VirtualAttachmentRequest,mipLevel)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(VirtualAttachmentRequest,layer)==18,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline bool test_521529698ada7cd6 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_521529698ada7cd6 ( Context * __context__ )
+{
+    int32_t __t_rename_at_22_0 = 24;
+    das_copy(__t_rename_at_22_0,__t_rename_at_22_0);
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap_test_521529698ada7cd6 ( Context * __context__ ) {
+    return cast<bool>::from(test_521529698ada7cd6(__context__));
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x51e44994aab9ee2e, false, (void*)&test_521529698ada7cd6, &__wrap_test_521529698ada7cd6 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_948819972822380974
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,631 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_15523388574692753988 {
+
+extern TypeInfo __type_info__7c9b7c0817d2a720;
+extern TypeInfo __type_info__7c9b7d0817d2a8d3;
+extern TypeInfo __type_info__7c9b820817d2b152;
+extern TypeInfo __type_info__8d997c0826427420;
+extern TypeInfo __type_info__8d997d08264275d3;
+extern TypeInfo __type_info__8d99820826427e52;
+extern TypeInfo __type_info__af91fe4c86505052;
+extern TypeInfo __type_info__a57780083a9a95ec;
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__b6617c0848e86020;
+extern TypeInfo __type_info__b6617d0848e861d3;
+extern TypeInfo __type_info__b661820848e86a52;
+extern TypeInfo __type_info__af99fe4c865de852;
+extern TypeInfo __type_info__c0878008517d7dec;
+
+TypeInfo __type_info__7c9b7c0817d2a720 = { Type::tFloat2, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 8, UINT64_C(0x7c9b7c0817d2a720) };
+TypeInfo __type_info__7c9b7d0817d2a8d3 = { Type::tFloat3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 12, UINT64_C(0x7c9b7d0817d2a8d3) };
+TypeInfo __type_info__7c9b820817d2b152 = { Type::tFloat4, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 16, UINT64_C(0x7c9b820817d2b152) };
+TypeInfo __type_info__8d997c0826427420 = { Type::tInt2, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 8, UINT64_C(0x8d997c0826427420) };
+TypeInfo __type_info__8d997d08264275d3 = { Type::tInt3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 12, UINT64_C(0x8d997d08264275d3) };
+TypeInfo __type_info__8d99820826427e52 = { Type::tInt4, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 16, UINT64_C(0x8d99820826427e52) };
+TypeInfo __type_info__af91fe4c86505052 = { Type::tRange, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 8, UINT64_C(0xaf91fe4c86505052) };
+TypeInfo __type_info__a57780083a9a95ec = { Type::tRange64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 16, UINT64_C(0xa57780083a9a95ec) };
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__b6617c0848e86020 = { Type::tUInt2, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 8, UINT64_C(0xb6617c0848e86020) };
+TypeInfo __type_info__b6617d0848e861d3 = { Type::tUInt3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 12, UINT64_C(0xb6617d0848e861d3) };
+TypeInfo __type_info__b661820848e86a52 = { Type::tUInt4, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 16, UINT64_C(0xb661820848e86a52) };
+TypeInfo __type_info__af99fe4c865de852 = { Type::tURange, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 8, UINT64_C(0xaf99fe4c865de852) };
+TypeInfo __type_info__c0878008517d7dec = { Type::tURange64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 16, UINT64_C(0xc0878008517d7dec) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__7c9b7c0817d2a720 };
+TypeInfo * __tinfo_1[3] = { &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_26[1] = { &__type_info__7c9b7d0817d2a8d3 };
+TypeInfo * __tinfo_27[5] = { &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_44[1] = { &__type_info__7c9b820817d2b152 };
+TypeInfo * __tinfo_45[7] = { &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52, &__type_info__af90fe4c864e9d52 };
+TypeInfo * __tinfo_62[1] = { &__type_info__8d997c0826427420 };
+TypeInfo * __tinfo_88[1] = { &__type_info__8d997d08264275d3 };
+TypeInfo * __tinfo_106[1] = { &__type_info__8d99820826427e52 };
+TypeInfo * __tinfo_124[1] = { &__type_info__b6617c0848e86020 };
+TypeInfo * __tinfo_150[1] = { &__type_info__b6617d0848e861d3 };
+TypeInfo * __tinfo_168[1] = { &__type_info__b661820848e86a52 };
+TypeInfo * __tinfo_186[1] = { &__type_info__af91fe4c86505052 };
+TypeInfo * __tinfo_212[1] = { &__type_info__af99fe4c865de852 };
+TypeInfo * __tinfo_238[1] = { &__type_info__a57780083a9a95ec };
+TypeInfo * __tinfo_264[1] = { &__type_info__c0878008517d7dec };
+
+inline void _FuncTicktest_vec2Tick6631211983072526941_a87fae97462a6553 ( Context * __context__, float2 __a_rename_at_7_0, bool __isRange_rename_at_7_1 );
+inline void _FuncTicktest_vec3Tick5989916972369972664_4a329cf6ed2dc39e ( Context * __context__, float3 __a_rename_at_35_11 );
+inline void _FuncTicktest_vec4Tick13606476616288825436_64fc7352e52007f8 ( Context * __context__, float4 __a_rename_at_56_21 );
+inline void _FuncTicktest_vec2Tick6631211983072526941_625f9b2b218a22cd ( Context * __context__, int2 __a_rename_at_7_31, bool __isRange_rename_at_7_32 );
+inline void _FuncTicktest_vec3Tick5989916972369972664_cd4fa3afbcea4bd6 ( Context * __context__, int3 __a_rename_at_35_42 );
+inline void _FuncTicktest_vec4Tick13606476616288825436_77fa0c7b88146a8c ( Context * __context__, int4 __a_rename_at_56_52 );
+inline void _FuncTicktest_vec2Tick6631211983072526941_f02aba5be8263a85 ( Context * __context__, uint2 __a_rename_at_7_62, bool __isRange_rename_at_7_63 );
+inline void _FuncTicktest_vec3Tick5989916972369972664_2c598d42fc4c35a4 ( Context * __context__, uint3 __a_rename_at_35_73 );
+inline void _FuncTicktest_vec4Tick13606476616288825436_3b8f718aa5c808ad ( Context * __context__, uint4 __a_rename_at_56_83 );
+inline void _FuncTicktest_vec2Tick6631211983072526941_4d25503719ec2710 ( Context * __context__, range __a_rename_at_7_93, bool __isRange_rename_at_7_94 );
+inline void _FuncTicktest_vec2Tick6631211983072526941_5863237df0e59326 ( Context * __context__, urange __a_rename_at_7_104, bool __isRange_rename_at_7_105 );
+inline void _FuncTicktest_vec2Tick6631211983072526941_b3300fe2241c6de8 ( Context * __context__, range64 __a_rename_at_7_115, bool __isRange_rename_at_7_116 );
+inline void _FuncTicktest_vec2Tick6631211983072526941_1495bbc4fccac9e8 ( Context * __context__, urange64 __a_rename_at_7_126, bool __isRange_rename_at_7_127 );
+inline void test_cvt_8915f57bd32973fc ( Context * __context__, int32_t __a_rename_at_78_137, int32_t __b_rename_at_78_138, int32_t __c_rename_at_78_139, int32_t __d_rename_at_78_140 );
+inline bool test_7786a87807fc31d6 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _FuncTicktest_vec2Tick6631211983072526941_a87fae97462a6553 ( Context * __context__, float2 __a_rename_at_7_0, bool __isRange_rename_at_7_1 )
+{
+    float2 __f2_0_rename_at_8_2 = ((float2)v_zero());
+    float2 __f2_x_rename_at_9_3 = ((float2)v_make_vec4f(1.000000e+00f,2.000000e+00f,0.f,0.f));
+    float2 __f2_y_rename_at_10_4 = ((float2)v_make_vec4f(1.000000e+00f,2.000000e+00f,0.f,0.f));
+    float2 __f2_z_rename_at_11_5 = ((float2)v_make_vec4f(1.000000e+00f,2.000000e+00f,0.f,0.f));
+    float2 __f2_w_rename_at_12_6 = ((float2)v_make_vec4f(1.000000e+00f,2.000000e+00f,0.f,0.f));
+    float2 __f2_xx_rename_at_13_7 = ((float2)v_splats(1.000000e+00f));
+    float2 __f2_yy_rename_at_14_8 = ((float2)v_splats(1.000000e+00f));
+    float2 __f2_zz_rename_at_15_9 = ((float2)v_splats(1.000000e+00f));
+    float2 __f2_ww_rename_at_16_10 = ((float2)v_splats(1.000000e+00f));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<float2>::from(__f2_0_rename_at_8_2)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<float2>::from(__f2_x_rename_at_9_3)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<float2>::from(__f2_y_rename_at_10_4)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<float2>::from(__f2_z_rename_at_11_5)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<float2>::from(__f2_w_rename_at_12_6)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    if ( __isRange_rename_at_7_1 )
+    {
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<float2>::from(__f2_xx_rename_at_13_7)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<float2>::from(__f2_yy_rename_at_14_8)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<float2>::from(__f2_zz_rename_at_15_9)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<float2>::from(__f2_ww_rename_at_16_10)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    } else {
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<float2>::from(__f2_xx_rename_at_13_7)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<float2>::from(__f2_yy_rename_at_14_8)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<float2>::from(__f2_zz_rename_at_15_9)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<float2>::from(__f2_ww_rename_at_16_10)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    };
+}
+
+inline void _FuncTicktest_vec3Tick5989916972369972664_4a329cf6ed2dc39e ( Context * __context__, float3 __a_rename_at_35_11 )
+{
+    float3 __f3_0_rename_at_36_12 = ((float3)v_zero());
+    float3 __f3_x_rename_at_37_13 = ((float3)v_make_vec4f(1.000000e+00f,2.000000e+00f,3.000000e+00f,0.f));
+    float3 __f3_y_rename_at_38_14 = ((float3)v_make_vec4f(1.000000e+00f,2.000000e+00f,3.000000e+00f,0.f));
+    float3 __f3_z_rename_at_39_15 = ((float3)v_make_vec4f(1.000000e+00f,2.000000e+00f,3.000000e+00f,0.f));
+    float3 __f3_w_rename_at_40_16 = ((float3)v_make_vec4f(1.000000e+00f,2.000000e+00f,3.000000e+00f,0.f));
+    float3 __f3_xx_rename_at_41_17 = ((float3)v_splats(1.000000e+00f));
+    float3 __f3_yy_rename_at_42_18 = ((float3)v_splats(1.000000e+00f));
+    float3 __f3_zz_rename_at_43_19 = ((float3)v_splats(1.000000e+00f));
+    float3 __f3_ww_rename_at_44_20 = ((float3)v_splats(1.000000e+00f));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_26, cast<float3>::from(__f3_0_rename_at_36_12)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_26, cast<float3>::from(__f3_x_rename_at_37_13)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_26, cast<float3>::from(__f3_y_rename_at_38_14)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_26, cast<float3>::from(__f3_z_rename_at_39_15)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_26, cast<float3>::from(__f3_w_rename_at_40_16)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_26, cast<float3>::from(__f3_xx_rename_at_41_17)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_26, cast<float3>::from(__f3_yy_rename_at_42_18)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_26, cast<float3>::from(__f3_zz_rename_at_43_19)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_26, cast<float3>::from(__f3_ww_rename_at_44_20)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+}
+
+inline void _FuncTicktest_vec4Tick13606476616288825436_64fc7352e52007f8 ( Context * __context__, float4 __a_rename_at_56_21 )
+{
+    float4 __f4_0_rename_at_57_22 = ((float4)v_zero());
+    float4 __f4_x_rename_at_58_23 = ((float4)v_make_vec4f(1.000000e+00f,2.000000e+00f,3.000000e+00f,4.000000e+00f));
+    float4 __f4_y_rename_at_59_24 = ((float4)v_make_vec4f(1.000000e+00f,2.000000e+00f,3.000000e+00f,4.000000e+00f));
+    float4 __f4_z_rename_at_60_25 = ((float4)v_make_vec4f(1.000000e+00f,2.000000e+00f,3.000000e+00f,4.000000e+00f));
+    float4 __f4_w_rename_at_61_26 = ((float4)v_make_vec4f(1.000000e+00f,2.000000e+00f,3.000000e+00f,4.000000e+00f));
+    float4 __f4_xx_rename_at_62_27 = ((float4)v_splats(1.000000e+00f));
+    float4 __f4_yy_rename_at_63_28 = ((float4)v_splats(1.000000e+00f));
+    float4 __f4_zz_rename_at_64_29 = ((float4)v_splats(1.000000e+00f));
+    float4 __f4_ww_rename_at_65_30 = ((float4)v_splats(1.000000e+00f));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_44, cast<float4>::from(__f4_0_rename_at_57_22)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_44, cast<float4>::from(__f4_x_rename_at_58_23)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "4"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_44, cast<float4>::from(__f4_y_rename_at_59_24)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "4"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_44, cast<float4>::from(__f4_z_rename_at_60_25)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "4"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_44, cast<float4>::from(__f4_w_rename_at_61_26)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "4"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_44, cast<float4>::from(__f4_xx_rename_at_62_27)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_44, cast<float4>::from(__f4_yy_rename_at_63_28)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_44, cast<float4>::from(__f4_zz_rename_at_64_29)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_44, cast<float4>::from(__f4_ww_rename_at_65_30)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+}
+
+inline void _FuncTicktest_vec2Tick6631211983072526941_625f9b2b218a22cd ( Context * __context__, int2 __a_rename_at_7_31, bool __isRange_rename_at_7_32 )
+{
+    int2 __f2_0_rename_at_8_33 = ((int2)int2(0,0));
+    int2 __f2_x_rename_at_9_34 = ((int2)int2(1,2));
+    int2 __f2_y_rename_at_10_35 = ((int2)int2(1,2));
+    int2 __f2_z_rename_at_11_36 = ((int2)int2(1,2));
+    int2 __f2_w_rename_at_12_37 = ((int2)int2(1,2));
+    int2 __f2_xx_rename_at_13_38 = ((int2)int2(1,1));
+    int2 __f2_yy_rename_at_14_39 = ((int2)int2(1,1));
+    int2 __f2_zz_rename_at_15_40 = ((int2)int2(1,1));
+    int2 __f2_ww_rename_at_16_41 = ((int2)int2(1,1));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_62, cast<int2>::from(__f2_0_rename_at_8_33)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_62, cast<int2>::from(__f2_x_rename_at_9_34)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_62, cast<int2>::from(__f2_y_rename_at_10_35)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_62, cast<int2>::from(__f2_z_rename_at_11_36)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_62, cast<int2>::from(__f2_w_rename_at_12_37)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    if ( __isRange_rename_at_7_32 )
+    {
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_62, cast<int2>::from(__f2_xx_rename_at_13_38)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_62, cast<int2>::from(__f2_yy_rename_at_14_39)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_62, cast<int2>::from(__f2_zz_rename_at_15_40)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_62, cast<int2>::from(__f2_ww_rename_at_16_41)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    } else {
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_62, cast<int2>::from(__f2_xx_rename_at_13_38)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_62, cast<int2>::from(__f2_yy_rename_at_14_39)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_62, cast<int2>::from(__f2_zz_rename_at_15_40)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_62, cast<int2>::from(__f2_ww_rename_at_16_41)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    };
+}
+
+inline void _FuncTicktest_vec3Tick5989916972369972664_cd4fa3afbcea4bd6 ( Context * __context__, int3 __a_rename_at_35_42 )
+{
+    int3 __f3_0_rename_at_36_43 = ((int3)int3(0,0,0));
+    int3 __f3_x_rename_at_37_44 = ((int3)int3(1,2,3));
+    int3 __f3_y_rename_at_38_45 = ((int3)int3(1,2,3));
+    int3 __f3_z_rename_at_39_46 = ((int3)int3(1,2,3));
+    int3 __f3_w_rename_at_40_47 = ((int3)int3(1,2,3));
+    int3 __f3_xx_rename_at_41_48 = ((int3)int3(1,1,1));
+    int3 __f3_yy_rename_at_42_49 = ((int3)int3(1,1,1));
+    int3 __f3_zz_rename_at_43_50 = ((int3)int3(1,1,1));
+    int3 __f3_ww_rename_at_44_51 = ((int3)int3(1,1,1));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_88, cast<int3>::from(__f3_0_rename_at_36_43)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_88, cast<int3>::from(__f3_x_rename_at_37_44)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_88, cast<int3>::from(__f3_y_rename_at_38_45)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_88, cast<int3>::from(__f3_z_rename_at_39_46)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_88, cast<int3>::from(__f3_w_rename_at_40_47)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_88, cast<int3>::from(__f3_xx_rename_at_41_48)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_88, cast<int3>::from(__f3_yy_rename_at_42_49)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_88, cast<int3>::from(__f3_zz_rename_at_43_50)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_88, cast<int3>::from(__f3_ww_rename_at_44_51)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+}
+
+inline void _FuncTicktest_vec4Tick13606476616288825436_77fa0c7b88146a8c ( Context * __context__, int4 __a_rename_at_56_52 )
+{
+    int4 __f4_0_rename_at_57_53 = ((int4)int4(0,0,0,0));
+    int4 __f4_x_rename_at_58_54 = ((int4)int4(1,2,3,4));
+    int4 __f4_y_rename_at_59_55 = ((int4)int4(1,2,3,4));
+    int4 __f4_z_rename_at_60_56 = ((int4)int4(1,2,3,4));
+    int4 __f4_w_rename_at_61_57 = ((int4)int4(1,2,3,4));
+    int4 __f4_xx_rename_at_62_58 = ((int4)int4(1,1,1,1));
+    int4 __f4_yy_rename_at_63_59 = ((int4)int4(1,1,1,1));
+    int4 __f4_zz_rename_at_64_60 = ((int4)int4(1,1,1,1));
+    int4 __f4_ww_rename_at_65_61 = ((int4)int4(1,1,1,1));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_106, cast<int4>::from(__f4_0_rename_at_57_53)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_106, cast<int4>::from(__f4_x_rename_at_58_54)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "4"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_106, cast<int4>::from(__f4_y_rename_at_59_55)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "4"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_106, cast<int4>::from(__f4_z_rename_at_60_56)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "4"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_106, cast<int4>::from(__f4_w_rename_at_61_57)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "4"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_106, cast<int4>::from(__f4_xx_rename_at_62_58)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_106, cast<int4>::from(__f4_yy_rename_at_63_59)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_106, cast<int4>::from(__f4_zz_rename_at_64_60)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_106, cast<int4>::from(__f4_ww_rename_at_65_61)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+}
+
+inline void _FuncTicktest_vec2Tick6631211983072526941_f02aba5be8263a85 ( Context * __context__, uint2 __a_rename_at_7_62, bool __isRange_rename_at_7_63 )
+{
+    uint2 __f2_0_rename_at_8_64 = ((uint2)uint2(0,0));
+    uint2 __f2_x_rename_at_9_65 = ((uint2)uint2(1,2));
+    uint2 __f2_y_rename_at_10_66 = ((uint2)uint2(1,2));
+    uint2 __f2_z_rename_at_11_67 = ((uint2)uint2(1,2));
+    uint2 __f2_w_rename_at_12_68 = ((uint2)uint2(1,2));
+    uint2 __f2_xx_rename_at_13_69 = ((uint2)uint2(1,1));
+    uint2 __f2_yy_rename_at_14_70 = ((uint2)uint2(1,1));
+    uint2 __f2_zz_rename_at_15_71 = ((uint2)uint2(1,1));
+    uint2 __f2_ww_rename_at_16_72 = ((uint2)uint2(1,1));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_124, cast<uint2>::from(__f2_0_rename_at_8_64)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_124, cast<uint2>::from(__f2_x_rename_at_9_65)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_124, cast<uint2>::from(__f2_y_rename_at_10_66)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_124, cast<uint2>::from(__f2_z_rename_at_11_67)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_124, cast<uint2>::from(__f2_w_rename_at_12_68)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    if ( __isRange_rename_at_7_63 )
+    {
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_124, cast<uint2>::from(__f2_xx_rename_at_13_69)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_124, cast<uint2>::from(__f2_yy_rename_at_14_70)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_124, cast<uint2>::from(__f2_zz_rename_at_15_71)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_124, cast<uint2>::from(__f2_ww_rename_at_16_72)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    } else {
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_124, cast<uint2>::from(__f2_xx_rename_at_13_69)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_124, cast<uint2>::from(__f2_yy_rename_at_14_70)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_124, cast<uint2>::from(__f2_zz_rename_at_15_71)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_124, cast<uint2>::from(__f2_ww_rename_at_16_72)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    };
+}
+
+inline void _FuncTicktest_vec3Tick5989916972369972664_2c598d42fc4c35a4 ( Context * __context__, uint3 __a_rename_at_35_73 )
+{
+    uint3 __f3_0_rename_at_36_74 = ((uint3)uint3(0,0,0));
+    uint3 __f3_x_rename_at_37_75 = ((uint3)uint3(1,2,3));
+    uint3 __f3_y_rename_at_38_76 = ((uint3)uint3(1,2,3));
+    uint3 __f3_z_rename_at_39_77 = ((uint3)uint3(1,2,3));
+    uint3 __f3_w_rename_at_40_78 = ((uint3)uint3(1,2,3));
+    uint3 __f3_xx_rename_at_41_79 = ((uint3)uint3(1,1,1));
+    uint3 __f3_yy_rename_at_42_80 = ((uint3)uint3(1,1,1));
+    uint3 __f3_zz_rename_at_43_81 = ((uint3)uint3(1,1,1));
+    uint3 __f3_ww_rename_at_44_82 = ((uint3)uint3(1,1,1));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_150, cast<uint3>::from(__f3_0_rename_at_36_74)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_150, cast<uint3>::from(__f3_x_rename_at_37_75)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_150, cast<uint3>::from(__f3_y_rename_at_38_76)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_150, cast<uint3>::from(__f3_z_rename_at_39_77)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_150, cast<uint3>::from(__f3_w_rename_at_40_78)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_150, cast<uint3>::from(__f3_xx_rename_at_41_79)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_150, cast<uint3>::from(__f3_yy_rename_at_42_80)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_150, cast<uint3>::from(__f3_zz_rename_at_43_81)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_150, cast<uint3>::from(__f3_ww_rename_at_44_82)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_27, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+}
+
+inline void _FuncTicktest_vec4Tick13606476616288825436_3b8f718aa5c808ad ( Context * __context__, uint4 __a_rename_at_56_83 )
+{
+    uint4 __f4_0_rename_at_57_84 = ((uint4)uint4(0,0,0,0));
+    uint4 __f4_x_rename_at_58_85 = ((uint4)uint4(1,2,3,4));
+    uint4 __f4_y_rename_at_59_86 = ((uint4)uint4(1,2,3,4));
+    uint4 __f4_z_rename_at_60_87 = ((uint4)uint4(1,2,3,4));
+    uint4 __f4_w_rename_at_61_88 = ((uint4)uint4(1,2,3,4));
+    uint4 __f4_xx_rename_at_62_89 = ((uint4)uint4(1,1,1,1));
+    uint4 __f4_yy_rename_at_63_90 = ((uint4)uint4(1,1,1,1));
+    uint4 __f4_zz_rename_at_64_91 = ((uint4)uint4(1,1,1,1));
+    uint4 __f4_ww_rename_at_65_92 = ((uint4)uint4(1,1,1,1));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_168, cast<uint4>::from(__f4_0_rename_at_57_84)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_168, cast<uint4>::from(__f4_x_rename_at_58_85)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "4"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_168, cast<uint4>::from(__f4_y_rename_at_59_86)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "4"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_168, cast<uint4>::from(__f4_z_rename_at_60_87)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "4"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_168, cast<uint4>::from(__f4_w_rename_at_61_88)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "3")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "4"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_168, cast<uint4>::from(__f4_xx_rename_at_62_89)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_168, cast<uint4>::from(__f4_yy_rename_at_63_90)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_168, cast<uint4>::from(__f4_zz_rename_at_64_91)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_168, cast<uint4>::from(__f4_ww_rename_at_65_92)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_45, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+}
+
+inline void _FuncTicktest_vec2Tick6631211983072526941_4d25503719ec2710 ( Context * __context__, range __a_rename_at_7_93, bool __isRange_rename_at_7_94 )
+{
+    range __f2_0_rename_at_8_95 = ((range)range(0,0));
+    range __f2_x_rename_at_9_96 = ((range)range(1,2));
+    range __f2_y_rename_at_10_97 = ((range)range(1,2));
+    range __f2_z_rename_at_11_98 = ((range)range(1,2));
+    range __f2_w_rename_at_12_99 = ((range)range(1,2));
+    range __f2_xx_rename_at_13_100 = ((range)range(0,1));
+    range __f2_yy_rename_at_14_101 = ((range)range(0,1));
+    range __f2_zz_rename_at_15_102 = ((range)range(0,1));
+    range __f2_ww_rename_at_16_103 = ((range)range(0,1));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_186, cast<range>::from(__f2_0_rename_at_8_95)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_186, cast<range>::from(__f2_x_rename_at_9_96)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_186, cast<range>::from(__f2_y_rename_at_10_97)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_186, cast<range>::from(__f2_z_rename_at_11_98)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_186, cast<range>::from(__f2_w_rename_at_12_99)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    if ( __isRange_rename_at_7_94 )
+    {
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_186, cast<range>::from(__f2_xx_rename_at_13_100)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_186, cast<range>::from(__f2_yy_rename_at_14_101)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_186, cast<range>::from(__f2_zz_rename_at_15_102)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_186, cast<range>::from(__f2_ww_rename_at_16_103)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    } else {
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_186, cast<range>::from(__f2_xx_rename_at_13_100)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_186, cast<range>::from(__f2_yy_rename_at_14_101)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_186, cast<range>::from(__f2_zz_rename_at_15_102)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_186, cast<range>::from(__f2_ww_rename_at_16_103)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    };
+}
+
+inline void _FuncTicktest_vec2Tick6631211983072526941_5863237df0e59326 ( Context * __context__, urange __a_rename_at_7_104, bool __isRange_rename_at_7_105 )
+{
+    urange __f2_0_rename_at_8_106 = ((urange)urange(0,0));
+    urange __f2_x_rename_at_9_107 = ((urange)urange(1,2));
+    urange __f2_y_rename_at_10_108 = ((urange)urange(1,2));
+    urange __f2_z_rename_at_11_109 = ((urange)urange(1,2));
+    urange __f2_w_rename_at_12_110 = ((urange)urange(1,2));
+    urange __f2_xx_rename_at_13_111 = ((urange)urange(0,1));
+    urange __f2_yy_rename_at_14_112 = ((urange)urange(0,1));
+    urange __f2_zz_rename_at_15_113 = ((urange)urange(0,1));
+    urange __f2_ww_rename_at_16_114 = ((urange)urange(0,1));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_212, cast<urange>::from(__f2_0_rename_at_8_106)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_212, cast<urange>::from(__f2_x_rename_at_9_107)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_212, cast<urange>::from(__f2_y_rename_at_10_108)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_212, cast<urange>::from(__f2_z_rename_at_11_109)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_212, cast<urange>::from(__f2_w_rename_at_12_110)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    if ( __isRange_rename_at_7_105 )
+    {
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_212, cast<urange>::from(__f2_xx_rename_at_13_111)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_212, cast<urange>::from(__f2_yy_rename_at_14_112)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_212, cast<urange>::from(__f2_zz_rename_at_15_113)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_212, cast<urange>::from(__f2_ww_rename_at_16_114)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    } else {
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_212, cast<urange>::from(__f2_xx_rename_at_13_111)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_212, cast<urange>::from(__f2_yy_rename_at_14_112)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_212, cast<urange>::from(__f2_zz_rename_at_15_113)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_212, cast<urange>::from(__f2_ww_rename_at_16_114)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    };
+}
+
+inline void _FuncTicktest_vec2Tick6631211983072526941_b3300fe2241c6de8 ( Context * __context__, range64 __a_rename_at_7_115, bool __isRange_rename_at_7_116 )
+{
+    range64 __f2_0_rename_at_8_117 = ((range64)range64(0,0));
+    range64 __f2_x_rename_at_9_118 = ((range64)range64(1,2));
+    range64 __f2_y_rename_at_10_119 = ((range64)range64(1,2));
+    range64 __f2_z_rename_at_11_120 = ((range64)range64(1,2));
+    range64 __f2_w_rename_at_12_121 = ((range64)range64(1,2));
+    range64 __f2_xx_rename_at_13_122 = ((range64)range64(0,1));
+    range64 __f2_yy_rename_at_14_123 = ((range64)range64(0,1));
+    range64 __f2_zz_rename_at_15_124 = ((range64)range64(0,1));
+    range64 __f2_ww_rename_at_16_125 = ((range64)range64(0,1));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_238, cast<range64>::from(__f2_0_rename_at_8_117)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_238, cast<range64>::from(__f2_x_rename_at_9_118)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_238, cast<range64>::from(__f2_y_rename_at_10_119)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_238, cast<range64>::from(__f2_z_rename_at_11_120)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_238, cast<range64>::from(__f2_w_rename_at_12_121)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    if ( __isRange_rename_at_7_116 )
+    {
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_238, cast<range64>::from(__f2_xx_rename_at_13_122)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_238, cast<range64>::from(__f2_yy_rename_at_14_123)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_238, cast<range64>::from(__f2_zz_rename_at_15_124)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_238, cast<range64>::from(__f2_ww_rename_at_16_125)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    } else {
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_238, cast<range64>::from(__f2_xx_rename_at_13_122)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_238, cast<range64>::from(__f2_yy_rename_at_14_123)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_238, cast<range64>::from(__f2_zz_rename_at_15_124)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_238, cast<range64>::from(__f2_ww_rename_at_16_125)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    };
+}
+
+inline void _FuncTicktest_vec2Tick6631211983072526941_1495bbc4fccac9e8 ( Context * __context__, urange64 __a_rename_at_7_126, bool __isRange_rename_at_7_127 )
+{
+    urange64 __f2_0_rename_at_8_128 = ((urange64)urange64(0,0));
+    urange64 __f2_x_rename_at_9_129 = ((urange64)urange64(1,2));
+    urange64 __f2_y_rename_at_10_130 = ((urange64)urange64(1,2));
+    urange64 __f2_z_rename_at_11_131 = ((urange64)urange64(1,2));
+    urange64 __f2_w_rename_at_12_132 = ((urange64)urange64(1,2));
+    urange64 __f2_xx_rename_at_13_133 = ((urange64)urange64(0,1));
+    urange64 __f2_yy_rename_at_14_134 = ((urange64)urange64(0,1));
+    urange64 __f2_zz_rename_at_15_135 = ((urange64)urange64(0,1));
+    urange64 __f2_ww_rename_at_16_136 = ((urange64)urange64(0,1));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_264, cast<urange64>::from(__f2_0_rename_at_8_128)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "0"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_264, cast<urange64>::from(__f2_x_rename_at_9_129)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_264, cast<urange64>::from(__f2_y_rename_at_10_130)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_264, cast<urange64>::from(__f2_z_rename_at_11_131)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_264, cast<urange64>::from(__f2_w_rename_at_12_132)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "2"))))),*__context__,nullptr)));
+    if ( __isRange_rename_at_7_127 )
+    {
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_264, cast<urange64>::from(__f2_xx_rename_at_13_133)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_264, cast<urange64>::from(__f2_yy_rename_at_14_134)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_264, cast<urange64>::from(__f2_zz_rename_at_15_135)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_264, cast<urange64>::from(__f2_ww_rename_at_16_136)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "0")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    } else {
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_264, cast<urange64>::from(__f2_xx_rename_at_13_133)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_264, cast<urange64>::from(__f2_yy_rename_at_14_134)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_264, cast<urange64>::from(__f2_zz_rename_at_15_135)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+        DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_264, cast<urange64>::from(__f2_ww_rename_at_16_136)))),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "1")), cast<char * const >::from(das_global<char *,0xd3cd7130c7d2872b>(__context__) /*VEC_SEP*/), cast<char * const >::from(((char *) "1"))))),*__context__,nullptr)));
+    };
+}
+
+inline void test_cvt_8915f57bd32973fc ( Context * __context__, int32_t __a_rename_at_78_137, int32_t __b_rename_at_78_138, int32_t __c_rename_at_78_139, int32_t __d_rename_at_78_140 )
+{
+    DAS_ASSERT((SimPolicy<float2>::Equ(cvt_ifloat2(int2(__a_rename_at_78_137,__b_rename_at_78_138)),float2(__a_rename_at_78_137,__b_rename_at_78_138),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<float3>::Equ(cvt_ifloat3(int3(__a_rename_at_78_137,__b_rename_at_78_138,__c_rename_at_78_139)),float3(__a_rename_at_78_137,__b_rename_at_78_138,__c_rename_at_78_139),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<float4>::Equ(cvt_ifloat4(int4(__a_rename_at_78_137,__b_rename_at_78_138,__c_rename_at_78_139,__d_rename_at_78_140)),float4(__a_rename_at_78_137,__b_rename_at_78_138,__c_rename_at_78_139,__d_rename_at_78_140),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<float2>::Equ(cvt_ufloat2(uint2(__a_rename_at_78_137,__b_rename_at_78_138)),float2(__a_rename_at_78_137,__b_rename_at_78_138),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<float3>::Equ(cvt_ufloat3(uint3(__a_rename_at_78_137,__b_rename_at_78_138,__c_rename_at_78_139)),float3(__a_rename_at_78_137,__b_rename_at_78_138,__c_rename_at_78_139),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<float4>::Equ(cvt_ufloat4(uint4(__a_rename_at_78_137,__b_rename_at_78_138,__c_rename_at_78_139,__d_rename_at_78_140)),float4(__a_rename_at_78_137,__b_rename_at_78_138,__c_rename_at_78_139,__d_rename_at_78_140),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<int2>::Equ(cvt_int2(float2(__a_rename_at_78_137,__b_rename_at_78_138)),int2(__a_rename_at_78_137,__b_rename_at_78_138),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<int3>::Equ(cvt_int3(float3(__a_rename_at_78_137,__b_rename_at_78_138,__c_rename_at_78_139)),int3(__a_rename_at_78_137,__b_rename_at_78_138,__c_rename_at_78_139),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<int4>::Equ(cvt_int4(float4(__a_rename_at_78_137,__b_rename_at_78_138,__c_rename_at_78_139,__d_rename_at_78_140)),int4(__a_rename_at_78_137,__b_rename_at_78_138,__c_rename_at_78_139,__d_rename_at_78_140),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<uint2>::Equ(cvt_uint2(float2(__a_rename_at_78_137,__b_rename_at_78_138)),uint2(__a_rename_at_78_137,__b_rename_at_78_138),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<uint3>::Equ(cvt_uint3(float3(__a_rename_at_78_137,__b_rename_at_78_138,__c_rename_at_78_139)),uint3(__a_rename_at_78_137,__b_rename_at_78_138,__c_rename_at_78_139),*__context__,nullptr)));
+    DAS_ASSERT((SimPolicy<uint4>::Equ(cvt_uint4(float4(__a_rename_at_78_137,__b_rename_at_78_138,__c_rename_at_78_139,__d_rename_at_78_140)),uint4(__a_rename_at_78_137,__b_rename_at_78_138,__c_rename_at_78_139,__d_rename_at_78_140),*__context__,nullptr)));
+}
+
+inline bool test_7786a87807fc31d6 ( Context * __context__ )
+{
+    _FuncTicktest_vec2Tick6631211983072526941_a87fae97462a6553(__context__,v_zero(),false);
+    _FuncTicktest_vec3Tick5989916972369972664_4a329cf6ed2dc39e(__context__,v_zero());
+    _FuncTicktest_vec4Tick13606476616288825436_64fc7352e52007f8(__context__,v_zero());
+    _FuncTicktest_vec2Tick6631211983072526941_625f9b2b218a22cd(__context__,int2(0,0),false);
+    _FuncTicktest_vec3Tick5989916972369972664_cd4fa3afbcea4bd6(__context__,int3(0,0,0));
+    _FuncTicktest_vec4Tick13606476616288825436_77fa0c7b88146a8c(__context__,int4(0,0,0,0));
+    _FuncTicktest_vec2Tick6631211983072526941_f02aba5be8263a85(__context__,uint2(0,0),false);
+    _FuncTicktest_vec3Tick5989916972369972664_2c598d42fc4c35a4(__context__,uint3(0,0,0));
+    _FuncTicktest_vec4Tick13606476616288825436_3b8f718aa5c808ad(__context__,uint4(0,0,0,0));
+    _FuncTicktest_vec2Tick6631211983072526941_4d25503719ec2710(__context__,range(0,0),true);
+    _FuncTicktest_vec2Tick6631211983072526941_5863237df0e59326(__context__,urange(0,0),true);
+    _FuncTicktest_vec2Tick6631211983072526941_b3300fe2241c6de8(__context__,range64(0,0),true);
+    _FuncTicktest_vec2Tick6631211983072526941_1495bbc4fccac9e8(__context__,urange64(0,0),true);
+    test_cvt_8915f57bd32973fc(__context__,1,2,3,4);
+    return das_auto_cast<bool>::cast(true);
+}
+static vec4f __wrap__FuncTicktest_vec2Tick6631211983072526941_a87fae97462a6553 ( Context * __context__ ) {
+    float2 arg_a = cast_aot_arg<float2>::to(*__context__,__context__->abiArguments()[0]);
+    bool arg_isRange = cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTicktest_vec2Tick6631211983072526941_a87fae97462a6553(__context__, arg_a, arg_isRange);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_vec3Tick5989916972369972664_4a329cf6ed2dc39e ( Context * __context__ ) {
+    float3 arg_a = cast_aot_arg<float3>::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_vec3Tick5989916972369972664_4a329cf6ed2dc39e(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_vec4Tick13606476616288825436_64fc7352e52007f8 ( Context * __context__ ) {
+    float4 arg_a = cast_aot_arg<float4>::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_vec4Tick13606476616288825436_64fc7352e52007f8(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_vec2Tick6631211983072526941_625f9b2b218a22cd ( Context * __context__ ) {
+    int2 arg_a = cast_aot_arg<int2>::to(*__context__,__context__->abiArguments()[0]);
+    bool arg_isRange = cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTicktest_vec2Tick6631211983072526941_625f9b2b218a22cd(__context__, arg_a, arg_isRange);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_vec3Tick5989916972369972664_cd4fa3afbcea4bd6 ( Context * __context__ ) {
+    int3 arg_a = cast_aot_arg<int3>::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_vec3Tick5989916972369972664_cd4fa3afbcea4bd6(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_vec4Tick13606476616288825436_77fa0c7b88146a8c ( Context * __context__ ) {
+    int4 arg_a = cast_aot_arg<int4>::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_vec4Tick13606476616288825436_77fa0c7b88146a8c(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_vec2Tick6631211983072526941_f02aba5be8263a85 ( Context * __context__ ) {
+    uint2 arg_a = cast_aot_arg<uint2>::to(*__context__,__context__->abiArguments()[0]);
+    bool arg_isRange = cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTicktest_vec2Tick6631211983072526941_f02aba5be8263a85(__context__, arg_a, arg_isRange);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_vec3Tick5989916972369972664_2c598d42fc4c35a4 ( Context * __context__ ) {
+    uint3 arg_a = cast_aot_arg<uint3>::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_vec3Tick5989916972369972664_2c598d42fc4c35a4(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_vec4Tick13606476616288825436_3b8f718aa5c808ad ( Context * __context__ ) {
+    uint4 arg_a = cast_aot_arg<uint4>::to(*__context__,__context__->abiArguments()[0]);
+    _FuncTicktest_vec4Tick13606476616288825436_3b8f718aa5c808ad(__context__, arg_a);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_vec2Tick6631211983072526941_4d25503719ec2710 ( Context * __context__ ) {
+    range arg_a = cast_aot_arg<range>::to(*__context__,__context__->abiArguments()[0]);
+    bool arg_isRange = cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTicktest_vec2Tick6631211983072526941_4d25503719ec2710(__context__, arg_a, arg_isRange);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_vec2Tick6631211983072526941_5863237df0e59326 ( Context * __context__ ) {
+    urange arg_a = cast_aot_arg<urange>::to(*__context__,__context__->abiArguments()[0]);
+    bool arg_isRange = cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTicktest_vec2Tick6631211983072526941_5863237df0e59326(__context__, arg_a, arg_isRange);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_vec2Tick6631211983072526941_b3300fe2241c6de8 ( Context * __context__ ) {
+    range64 arg_a = cast_aot_arg<range64>::to(*__context__,__context__->abiArguments()[0]);
+    bool arg_isRange = cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTicktest_vec2Tick6631211983072526941_b3300fe2241c6de8(__context__, arg_a, arg_isRange);
+    return v_zero();
+}
+static vec4f __wrap__FuncTicktest_vec2Tick6631211983072526941_1495bbc4fccac9e8 ( Context * __context__ ) {
+    urange64 arg_a = cast_aot_arg<urange64>::to(*__context__,__context__->abiArguments()[0]);
+    bool arg_isRange = cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[1]);
+    _FuncTicktest_vec2Tick6631211983072526941_1495bbc4fccac9e8(__context__, arg_a, arg_isRange);
+    return v_zero();
+}
+static vec4f __wrap_test_cvt_8915f57bd32973fc ( Context * __context__ ) {
+    int32_t arg_a = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[0]);
+    int32_t arg_b = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[1]);
+    int32_t arg_c = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[2]);
+    int32_t arg_d = cast_aot_arg<int32_t>::to(*__context__,__context__->abiArguments()[3]);
+    test_cvt_8915f57bd32973fc(__context__, arg_a, arg_b, arg_c, arg_d);
+    return v_zero();
+}
+static vec4f __wrap_test_7786a87807fc31d6 ( Context * __context__ ) {
+    return cast<bool>::from(test_7786a87807fc31d6(__context__));
+}
+static vec4f __wrap___init_script ( Context * __context__ ) {
+    __init_script(__context__, cast_aot_arg<bool>::to(*__context__,__context__->abiArguments()[0]));
+    return v_zero();
+};
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0x3a415e83ad496f8e, false, (void*)&_FuncTicktest_vec2Tick6631211983072526941_a87fae97462a6553, &__wrap__FuncTicktest_vec2Tick6631211983072526941_a87fae97462a6553 },
+    { 0x39242b434147995e, false, (void*)&_FuncTicktest_vec3Tick5989916972369972664_4a329cf6ed2dc39e, &__wrap__FuncTicktest_vec3Tick5989916972369972664_4a329cf6ed2dc39e },
+    { 0x659f5988fb677d5a, false, (void*)&_FuncTicktest_vec4Tick13606476616288825436_64fc7352e52007f8, &__wrap__FuncTicktest_vec4Tick13606476616288825436_64fc7352e52007f8 },
+    { 0x7118ed484166ca29, false, (void*)&_FuncTicktest_vec2Tick6631211983072526941_625f9b2b218a22cd, &__wrap__FuncTicktest_vec2Tick6631211983072526941_625f9b2b218a22cd },
+    { 0xefad351857d17a76, false, (void*)&_FuncTicktest_vec3Tick5989916972369972664_cd4fa3afbcea4bd6, &__wrap__FuncTicktest_vec3Tick5989916972369972664_cd4fa3afbcea4bd6 },
+    { 0xe112198817f53a34, false, (void*)&_FuncTicktest_vec4Tick13606476616288825436_77fa0c7b88146a8c, &__wrap__FuncTicktest_vec4Tick13606476616288825436_77fa0c7b88146a8c },
+    { 0x14b62acb78738e9b, false, (void*)&_FuncTicktest_vec2Tick6631211983072526941_f02aba5be8263a85, &__wrap__FuncTicktest_vec2Tick6631211983072526941_f02aba5be8263a85 },
+    { 0x8a87e14d29f9ad52, false, (void*)&_FuncTicktest_vec3Tick5989916972369972664_2c598d42fc4c35a4, &__wrap__FuncTicktest_vec3Tick5989916972369972664_2c598d42fc4c35a4 },
+    { 0xe27c87e834284c77, false, (void*)&_FuncTicktest_vec4Tick13606476616288825436_3b8f718aa5c808ad, &__wrap__FuncTicktest_vec4Tick13606476616288825436_3b8f718aa5c808ad },
+    { 0x29040aa5e2654dc9, false, (void*)&_FuncTicktest_vec2Tick6631211983072526941_4d25503719ec2710, &__wrap__FuncTicktest_vec2Tick6631211983072526941_4d25503719ec2710 },
+    { 0xee6ec44d18ae098f, false, (void*)&_FuncTicktest_vec2Tick6631211983072526941_5863237df0e59326, &__wrap__FuncTicktest_vec2Tick6631211983072526941_5863237df0e59326 },
+    { 0x316f2ae9282cdfdb, false, (void*)&_FuncTicktest_vec2Tick6631211983072526941_b3300fe2241c6de8, &__wrap__FuncTicktest_vec2Tick6631211983072526941_b3300fe2241c6de8 },
+    { 0x4df1d9dc852a95e7, false, (void*)&_FuncTicktest_vec2Tick6631211983072526941_1495bbc4fccac9e8, &__wrap__FuncTicktest_vec2Tick6631211983072526941_1495bbc4fccac9e8 },
+    { 0xd9362c064a957508, false, (void*)&test_cvt_8915f57bd32973fc, &__wrap_test_cvt_8915f57bd32973fc },
+    { 0x884e4903b8c17ec4, false, (void*)&test_7786a87807fc31d6, &__wrap_test_7786a87807fc31d6 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    // [[ init script ]]
+    aotLib.emplace(0x24b29f369de4168b, AotFactory(false, (void*)&__init_script, &__wrap___init_script));
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_15523388574692753988
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
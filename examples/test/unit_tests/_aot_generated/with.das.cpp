@@ -0,0 +1,135 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_11551739586110266291 {
+
+namespace  { struct Point; };
+namespace  {
+
+struct Point {
+    int32_t x;
+    int32_t y;
+};
+static_assert(sizeof(Point)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Point,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Point,y)==4,"structure field offset mismatch with DAS");
+}
+
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+
+inline bool test_63bc26f2ae598439 ( Context * __context__ );
+inline Point Point_897584ee4f5221ef ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_63bc26f2ae598439 ( Context * __context__ )
+{
+    Point __p_rename_at_8_0 = (([&]() -> Point {
+        Point __mks_8 = Point_897584ee4f5221ef(__context__);
+        return __mks_8;
+    })());
+    das_copy(__p_rename_at_8_0.x,1);
+    das_copy(__p_rename_at_8_0.y,2);
+    DAS_ASSERT(((__p_rename_at_8_0.x == 1) && (__p_rename_at_8_0.y == 2)));
+    return das_auto_cast<bool>::cast(true);
+}
+
+inline Point Point_897584ee4f5221ef ( Context * __context__ )
+{
+    return /* <- */ das_auto_cast_move<Point>::cast((([&]() -> Point {
+        Point __mks_2;
+        das_copy((__mks_2.x),(0));
+        das_copy((__mks_2.y),(0));
+        return __mks_2;
+    })()));
+}
+static vec4f __wrap_test_63bc26f2ae598439 ( Context * __context__ ) {
+    return cast<bool>::from(test_63bc26f2ae598439(__context__));
+}
+static vec4f __wrap_Point_897584ee4f5221ef ( Context * __context__ ) {
+    *((Point *) __context__->abiCMRES) = Point_897584ee4f5221ef(__context__);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xd7c58e75fac59f4d, false, (void*)&test_63bc26f2ae598439, &__wrap_test_63bc26f2ae598439 },
+    { 0x55416d2fc70cb94e, true, (void*)&Point_897584ee4f5221ef, &__wrap_Point_897584ee4f5221ef },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_11551739586110266291
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,125 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require tutorial_02
+#include "tutorial02aot.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_11506090560177393602 {
+
+extern TypeInfo __type_info__af8afe4c86446b52;
+extern TypeInfo __type_info__af90fe4c864e9d52;
+
+TypeInfo __type_info__af8afe4c86446b52 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, TypeSize<int32_t>::size, UINT64_C(0xaf8afe4c86446b52) };
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, TypeSize<char *>::size, UINT64_C(0xaf90fe4c864e9d52) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[3] = { &__type_info__af90fe4c864e9d52, &__type_info__af8afe4c86446b52, &__type_info__af90fe4c864e9d52 };
+
+inline void test_c5cc8c33fb30ea36 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void test_c5cc8c33fb30ea36 ( Context * __context__ )
+{
+    builtin_print(((char *) "this tutorial utilizes basic builin module with constant and function\n"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    builtin_print(((char *) "sq2 = 1.4142135 // expecting sqrt(2), 1.41421\n"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    builtin_print(((char *) "a   = 2   // expecting var a initialized with 2\n"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    builtin_print(((char *) "xma = 3 // expecting 3\n"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    bool __isTps_rename_at_15_0 = false;
+    das_copy(__isTps_rename_at_15_0,true);
+    int32_t __offset_rename_at_17_1 = ((int32_t)das_invoke<int32_t>::invoke(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> int32_t{
+        return das_auto_cast<int32_t>::cast(__isTps_rename_at_15_0 ? das_auto_cast<int32_t>::cast(1) : das_auto_cast<int32_t>::cast(2));
+    }));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<3>(__tinfo_0, cast<char * const >::from(((char *) "offset = ")), cast<int32_t>::from(__offset_rename_at_17_1), cast<char * const >::from(((char *) " // expecting 2.0\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    int32_t __offset2_rename_at_25_2 = ((int32_t)das_invoke<int32_t>::invoke<int32_t>(__context__,nullptr,[&](int32_t const  __aa_rename_at_25_3) DAS_AOT_INLINE_LAMBDA -> int32_t{
+        return das_auto_cast<int32_t>::cast(__aa_rename_at_25_3 + 1);
+    },13));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<3>(__tinfo_0, cast<char * const >::from(((char *) "offset2 = ")), cast<int32_t>::from(__offset2_rename_at_25_2), cast<char * const >::from(((char *) " // expecting 14\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    das_invoke<void>::invoke(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> void{
+        builtin_print(((char *) "this is an anonymous invoke\n"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    });
+}
+static vec4f __wrap_test_c5cc8c33fb30ea36 ( Context * __context__ ) {
+    test_c5cc8c33fb30ea36(__context__);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xd197b7add5f31be7, false, (void*)&test_c5cc8c33fb30ea36, &__wrap_test_c5cc8c33fb30ea36 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+} // namespace _anon_11506090560177393602
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,187 @@
+#include "daScript/simulate/standalone_ctx_utils.h"
+ // require builtin
+#include "daScript/simulate/bin_serializer.h"
+#include "daScript/simulate/runtime_profile.h"
+ // require tutorial_02
+#include "tutorial02aot.h"
+#include "tutorial02.das.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__EDG__)
+#pragma diag_suppress 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_11506090560177393602 {
+
+extern TypeInfo __type_info__af8afe4c86446b52;
+extern TypeInfo __type_info__af90fe4c864e9d52;
+extern TypeInfo __type_info__af63eb4c86020609;
+
+VarInfo __func_info__2bfe5b9dc7861093_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, TypeSize<int32_t>::size, UINT64_C(0x490aa0b1d8076277), "aa", 0, 0 };
+VarInfo * __func_info__2bfe5b9dc7861093_fields[1] =  { &__func_info__2bfe5b9dc7861093_field_0 };
+FuncInfo __func_info__2bfe5b9dc7861093 = {"invoke block<(aa:int const):int const> const", "", __func_info__2bfe5b9dc7861093_fields, 1, 32, &__type_info__af8afe4c86446b52, nullptr,0,UINT64_C(0x2bfe5b9dc7861093), 0x0 };
+FuncInfo __func_info__d427bf00e15116d5 = {"invoke block<int const> const", "", nullptr, 0, 32, &__type_info__af8afe4c86446b52, nullptr,0,UINT64_C(0xd427bf00e15116d5), 0x0 };
+FuncInfo __func_info__955909f57bd61177 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x955909f57bd61177), 0x0 };
+FuncInfo __func_info__7f4e3d0819c1de70 = {"test", "", nullptr, 0, 144, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x7f4e3d0819c1de70), 0x0 };
+TypeInfo __type_info__af8afe4c86446b52 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, TypeSize<int32_t>::size, UINT64_C(0xaf8afe4c86446b52) };
+TypeInfo __type_info__af90fe4c864e9d52 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, TypeSize<char *>::size, UINT64_C(0xaf90fe4c864e9d52) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, TypeSize<void>::size, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+    vector<TypeInfo> annotations = {};
+    for (auto& ann : annotations) {
+        ann.resolveAnnotation();
+    }
+}
+
+TypeInfo * __tinfo_0[3] = { &__type_info__af90fe4c864e9d52, &__type_info__af8afe4c86446b52, &__type_info__af90fe4c864e9d52 };
+
+inline void test_c5cc8c33fb30ea36 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void test_c5cc8c33fb30ea36 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,144,"test " DAS_FILE_LINE);
+{
+    builtin_print(((char *) "this tutorial utilizes basic builin module with constant and function\n"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    builtin_print(((char *) "sq2 = 1.4142135 // expecting sqrt(2), 1.41421\n"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    builtin_print(((char *) "a   = 2   // expecting var a initialized with 2\n"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    builtin_print(((char *) "xma = 3 // expecting 3\n"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    bool __isTps_rename_at_15_0 = false;
+    das_copy(__isTps_rename_at_15_0,true);
+    int32_t __offset_rename_at_17_1 = ((int32_t)das_invoke<int32_t>::invoke(__context__,nullptr,das_make_block<int32_t>(__context__,0,0,&__func_info__d427bf00e15116d5,[&]() -> int32_t{
+        return das_auto_cast<int32_t>::cast(__isTps_rename_at_15_0 ? das_auto_cast<int32_t>::cast(1) : das_auto_cast<int32_t>::cast(2));
+    })));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<3>(__tinfo_0, cast<char * const >::from(((char *) "offset = ")), cast<int32_t>::from(__offset_rename_at_17_1), cast<char * const >::from(((char *) " // expecting 2.0\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    int32_t __offset2_rename_at_25_2 = ((int32_t)das_invoke<int32_t>::invoke<int32_t>(__context__,nullptr,das_make_block<int32_t,int32_t>(__context__,128,0,&__func_info__2bfe5b9dc7861093,[&](int32_t const  __aa_rename_at_25_3) -> int32_t{
+        return das_auto_cast<int32_t>::cast(__aa_rename_at_25_3 + 1);
+    }),13));
+    builtin_print(das_string_builder_temp(__context__,SimNode_AotInterop<3>(__tinfo_0, cast<char * const >::from(((char *) "offset2 = ")), cast<int32_t>::from(__offset2_rename_at_25_2), cast<char * const >::from(((char *) " // expecting 14\n")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    das_invoke<void>::invoke(__context__,nullptr,das_make_block<void>(__context__,0,0,&__func_info__955909f57bd61177,[&]() -> void{
+        builtin_print(((char *) "this is an anonymous invoke\n"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+    }));
+}}
+} // namespace _anon_11506090560177393602
+using namespace _anon_11506090560177393602;
+namespace tutorial02 {
+static vec4f __wrap_test_c5cc8c33fb30ea36 ( Context * __context__ ) {
+    test_c5cc8c33fb30ea36(__context__);
+    return v_zero();
+}
+
+#pragma optimize("", off)
+struct AotFunction { uint64_t hash; bool is_cmres; void * fn; vec4f (*wrappedFn)(Context*); };
+static AotFunction functions[] = {
+    { 0xd197b7add5f31be7, false, (void*)&test_c5cc8c33fb30ea36, &__wrap_test_c5cc8c33fb30ea36 },
+};
+#pragma optimize("", on)
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+    for (const auto &[hash, cmres, fn1, fn2] : functions) {
+        aotLib.emplace(hash, AotFactory(cmres, fn1, fn2));
+    }
+    resolveTypeInfoAnnotations();
+}
+
+static AotListBase impl(registerAotFunctions);
+auto Standalone::test ( ) -> void {
+    return test_c5cc8c33fb30ea36(this);
+}
+
+Standalone::Standalone() {
+    auto & context = *this;
+    CodeOfPolicies policies;    policies.debugger = false /*policies.debugger*/;
+    policies.persistent_heap = false;
+    policies.heap_size_hint = 65536;
+    policies.string_heap_size_hint = 65536;
+    context.setup(0/*totalVariables*/, 292 /*globalStringHeapSize*/, policies, {});
+     // start totalVariables
+     // end totalVariables
+
+    context.allocateGlobalsAndShared();
+    context.totalVariables = 0/*totalVariables*/;
+    context.functions = (SimFunction *) context.code->allocate( 1/*totalFunctions*/*sizeof(SimFunction) );
+    context.totalFunctions = 1/*totalFunctions*/;
+    bool anyPInvoke = false;
+    if ( anyPInvoke || false/*(policies.threadlock_context || policies.debugger)*/ ) {
+        context.contextMutex = new recursive_mutex;
+    }
+    context.tabMnLookup = make_shared<das_hash_map<uint64_t,SimFunction *>>();
+    context.tabMnLookup->clear();
+     // start totalFunctions
+    struct FunctionStorage { int idx; FunctionInfo funcInfo; FuncInfo* debugInfo; };
+    FunctionStorage usedFunctions[] = {
+        {0, FunctionInfo("test", "test", 0x7f4e3d0819c1de70, 0xd197b7add5f31be7, 144, false, false, false, false, false, false), &__func_info__7f4e3d0819c1de70},
+    };
+    // end totalFunctions
+    vector<pair<uint64_t, SimFunction*>> id_to_funcs;
+    for (const auto& [index, func_info, debug_info]: usedFunctions) {
+        InitAotFunction(context, &context.functions[index], func_info);
+        context.functions[index].debugInfo = debug_info;
+        (*context.tabMnLookup)[func_info.mnh] = context.functions + index;
+        id_to_funcs.emplace_back(func_info.aotHash, &context.functions[index]);
+        anyPInvoke |= func_info.pinvoke;
+    }
+    context.tabGMnLookup = make_shared<das_hash_map<uint64_t,uint32_t>>();
+    context.tabGMnLookup->clear();
+    for ( int i=0, is=context.totalVariables; i!=is; ++i ) {
+        auto mnh = context.globalVariables[i].mangledNameHash;
+        (*context.tabGMnLookup)[mnh] = context.globalVariables[i].offset;
+    }
+    context.tabAdLookup = make_shared<das_hash_map<uint64_t,uint64_t>>();
+    FillFunction(context, getGlobalAotLibrary(), id_to_funcs);
+    context.runInitScript();
+}
+#ifdef STANDALONE_CONTEXT_TESTS
+static Context * registerStandaloneTest ( ) {
+    auto ctx = new StandaloneContext();
+    return ctx;
+}
+StandaloneContextNode node(registerStandaloneTest);
+#endif
+} // namespace tutorial02
+} // namespace das
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__EDG__)
+#pragma diag_default 826
+#elif defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
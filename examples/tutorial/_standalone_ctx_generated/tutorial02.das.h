@@ -0,0 +1,17 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+namespace das {
+namespace tutorial02 {
+
+
+class Standalone : public Context {
+public:
+    Standalone();
+    auto test ( ) -> void;
+};
+} // namespace tutorial02
+} // namespace das
@@ -975,6 +975,7 @@ namespace das
                 bool    lateShutdown : 1;
                 bool    hasTryRecover : 1;           // has try { } recover { }
                 bool    hasUnsafe : 1;               // has unsafe { }
+                bool    lazyBody : 1;                // body is still in the serialized image, see Program::materializeFunction
             };
             uint32_t moreFlags = 0;
         };
@@ -1524,6 +1525,12 @@ namespace das
         /*option*/ bool scoped_stack_allocator = true;             // reuse stack memory after variables out of scope
         /*option*/ bool force_inscope_pod = false;                 // force in-scope for POD-like types
         /*option*/ bool log_inscope_pod = false;                   // log in-scope for POD-like types
+        /*option*/ bool inline_functions = false;                  // inline small non-recursive functions into their callers during optimization
+        /*option*/ int32_t inline_max_cost = 12;                   // maximum number of nodes in the body of the function, which can be inlined
+        /*option*/ bool loop_invariant_motion = false;             // hoist loop invariant values out of for and while loops
+        /*option*/ bool common_subexpressions = false;             // replace repeated array and field reference chains in a statement with the temporary reference
+        /*option*/ bool bounds_check_elimination = false;          // skip bounds checks on array and dim indexing, which is proven to be in range
+        /*option*/ bool bytecode = false;                          // evaluate function bodies with the register bytecode interpreter, where possible
     // debugger
         //  when enabled
         //      1. disables [fastcall]
@@ -1630,8 +1637,13 @@ namespace das
         bool optimizationConstFolding();
         bool optimizationBlockFolding();
         bool optimizationCondFolding();
+        bool optimizationInline();
+        bool optimizationLoopInvariants( int32_t & hoisted );
+        bool optimizationCommonSubexpressions( int32_t & eliminated );
+        bool optimizationBoundsChecks( int32_t & eliminated );
         bool optimizationUnused(TextWriter & logs);
         void fusion ( Context & context, TextWriter & logs );
+        void bytecode ( Context & context, TextWriter & logs );
         void buildAccessFlags(TextWriter & logs);
         bool verifyAndFoldContracts();
         void optimize(TextWriter & logs, ModuleGroup & libGroup);
@@ -1676,6 +1688,8 @@ namespace das
         void makeMacroModule( TextWriter & logs );
         vector<ReaderMacroPtr> getReaderMacro ( const string & markup ) const;
         void serialize ( AstSerializer & ser );
+        bool materializeFunction ( Function * func );
+        void materializeFunctions ();
     protected:
         // this is no longer the way to link AOT
         //  set CodeOfPolicies::aot instead
@@ -1724,6 +1738,7 @@ namespace das
                 bool    promoteToBuiltin : 1;
                 bool    isDependency : 1;
                 bool    macroException : 1;
+                bool    skipInitScript : 1;     // simulate does not run the init script, the caller runs it in parts, see Context::runInitScript
             };
             uint32_t    flags = 0;
         };
@@ -1732,6 +1747,7 @@ namespace das
         CodeOfPolicies              policies;
         vector<tuple<Module *,string,string,bool,LineInfo>> allRequireDecl;
         das_hash_map<uint64_t,TypeDecl *> astTypeInfo;
+        shared_ptr<AstSerializer>   lazyImage;      // image with the function bodies, which are not loaded yet
     };
 
     // module parsing routines
@@ -1757,6 +1773,20 @@ namespace das
     DAS_API ProgramPtr compileDaScriptSerialize ( const string & fileName, const FileAccessPtr & access,
         TextWriter & logs, ModuleGroup & libGroup, CodeOfPolicies policies = CodeOfPolicies() );
 
+    // same as compileDaScript, but the compiled program is kept in the cache folder, keyed by the hash of
+    // all the source files it was compiled from and the policies. next time it's deserialized instead
+    DAS_API ProgramPtr compileDaScriptCached ( const string & fileName, const FileAccessPtr & access,
+        TextWriter & logs, ModuleGroup & libGroup, const string & cacheDir, CodeOfPolicies policies = CodeOfPolicies() );
+
+    struct CompileCacheStats {
+        uint64_t    hits = 0;
+        uint64_t    misses = 0;             // nothing in the cache for this file and policies
+        uint64_t    invalidations = 0;      // sources changed, or the cached image no longer loads
+        uint64_t    stores = 0;
+    };
+    DAS_API CompileCacheStats getCompileCacheStats();
+    DAS_API void resetCompileCacheStats();
+
     // collect script prerequisits
     DAS_API bool getPrerequisits ( const string & fileName,
                           const FileAccessPtr & access,
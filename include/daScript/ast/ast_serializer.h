@@ -16,31 +16,40 @@ namespace das {
     struct SerializationStorage {
         vector<uint8_t> buffer;
         size_t bufferPos = 0;
+        const uint8_t * mappedData = nullptr;   // read-only view of the data, used instead of the buffer when set
+        size_t mappedSize = 0;
+        __forceinline const uint8_t * readData() const { return mappedData ? mappedData : buffer.data(); }
+        __forceinline size_t readSize() const { return mappedData ? mappedSize : buffer.size(); }
         template<typename T>
         __forceinline bool read ( T & data ) {
-            if ( bufferPos + sizeof(T) < buffer.size() ) {
-                data = *(T*)(buffer.data() + bufferPos);
+            if ( bufferPos + sizeof(T) < readSize() ) {
+                data = *(T*)(readData() + bufferPos);
                 bufferPos += sizeof(T);
                 return true;
             }
             return readOverflow(&data, sizeof(T));
         }
         __forceinline bool read ( vec4f & data ) {
-            if ( bufferPos + sizeof(vec4f) < buffer.size() ) {
-                data = v_ldu((const float*)(buffer.data() + bufferPos));
+            if ( bufferPos + sizeof(vec4f) < readSize() ) {
+                data = v_ldu((const float*)(readData() + bufferPos));
                 bufferPos += sizeof(vec4f);
                 return true;
             }
             return readOverflow(&data, sizeof(vec4f));
         }
         __forceinline bool read ( void * data, size_t size ) {
-            if ( bufferPos + size < buffer.size() ) {
-                memcpy(data, buffer.data() + bufferPos, size);
+            if ( bufferPos + size < readSize() ) {
+                memcpy(data, readData() + bufferPos, size);
                 bufferPos += size;
                 return true;
             }
             return readOverflow(data, size);
         }
+        __forceinline bool skip ( size_t size ) {
+            if ( bufferPos + size > readSize() ) return false;
+            bufferPos += size;
+            return true;
+        }
         virtual bool readOverflow ( void * data, size_t size ) = 0;
         virtual void write ( const void * data, size_t size ) = 0;
         virtual size_t writingSize() const = 0;
@@ -52,8 +61,8 @@ namespace das {
             return buffer.size();
         }
         virtual bool readOverflow ( void * data, size_t size ) override {
-            if ( bufferPos + size > buffer.size() ) return false;
-            memcpy(data, buffer.data() + bufferPos, size);
+            if ( bufferPos + size > readSize() ) return false;
+            memcpy(data, readData() + bufferPos, size);
             bufferPos += size;
             return true;
         }
@@ -64,6 +73,33 @@ namespace das {
         }
     };
 
+    // read-only storage over a memory mapped file, pages are only brought in when they are read
+    struct DAS_API SerializationStorageMapped : SerializationStorageVector {
+        SerializationStorageMapped() = default;
+        SerializationStorageMapped ( const SerializationStorageMapped & ) = delete;
+        SerializationStorageMapped & operator = ( const SerializationStorageMapped & ) = delete;
+        virtual ~SerializationStorageMapped();
+        bool open ( const string & fileName );
+        void close();
+        virtual void write ( const void *, size_t ) override {
+            DAS_ASSERTF(0, "mapped serialization storage is read-only");
+        }
+    protected:
+        void * mapping = nullptr;
+        size_t mappingSize = 0;
+#if defined(_MSC_VER)
+        void * fileHandle = nullptr;
+        void * mappingHandle = nullptr;
+#endif
+    };
+
+    // objects, which are written in full inside of the lazily loaded function body
+    // the rest of the image never refers to them, so they are written again if they show up after the body
+    struct AstSerializerLazyScope {
+        das_hash_set<uint64_t>              seen;
+        das_hash_map<FileInfo*,uint64_t>    fileInfos;
+    };
+
     struct DAS_API AstSerializer {
         ~AstSerializer ();
         AstSerializer ( SerializationStorage * storage, bool isWriting );
@@ -117,6 +153,17 @@ namespace das {
     // tracking for shared modules
         das_hash_set<Module *>                      writingReadyModules;
         bool                                        ignoreEmptyExternal = false;
+    // lazily loaded function bodies
+        bool                                        lazyFunctionBodies = false; // writing: unused functions of library modules go to skippable sections, reading: sections stay in the storage
+        bool                                        lazyFunctions = false;      // functions of the current module can be lazy
+        Module *                                    lazyMainModule = nullptr;
+        AstSerializerLazyScope *                    lazyScope = nullptr;
+        vector<smart_ptr<ptr_ref_count>>            lazySkipped;                // copies of the objects which were already loaded, kept until patched
+        das_hash_map<Function *, pair<uint64_t,uint64_t>> lazyBodies;           // offset and size of the body section
+        unique_ptr<SerializationStorage>            ownStorage;                 // keeps the storage of the lazy image alive
+        void serializeLazyBody ( Function * func );
+        void readLazyBody ( Function * func );
+        bool materializeFunctionBody ( Function * func );
         void tag   ( const char * name, uint32_t hash );
 #if DAS_SERIALIZE_DTAG
         __forceinline void dtag ( const char * name, uint32_t hash ) { tag(name,hash); }
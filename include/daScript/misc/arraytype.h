@@ -171,12 +171,24 @@ namespace das
 
     typedef uint32_t TableHashKey;
 
+    // table memory is data[capacity], keys[capacity], hashes[capacity], followed by one control byte per slot
+    // control bytes are probed TABLE_CTRL_GROUP at a time, and the first TABLE_CTRL_GROUP of them are mirrored past the end,
+    // so that the group which starts anywhere in the table can be loaded without wrapping
+    #define TABLE_CTRL_GROUP    16
+    #define TABLE_CTRL_EMPTY    0x80    // high bit set means empty or killed, otherwise low 7 bits of the hash
+    #define TABLE_CTRL_KILLED   0xfe
+
     struct Table : Array {
         char *      keys;
         TableHashKey *  hashes;
         uint32_t    tombstones;
+        __forceinline uint8_t * ctrl() const { return (uint8_t *)(hashes + capacity); }
     };
 
+    __forceinline uint64_t table_mem_size ( uint32_t capacity, uint64_t keyAndValueSize ) {
+        return capacity ? uint64_t(capacity) * (keyAndValueSize + sizeof(TableHashKey) + 1) + TABLE_CTRL_GROUP : 0;
+    }
+
     DAS_API void table_clear ( Context & context, Table & arr, LineInfo * at );
     DAS_API void table_lock ( Context & context, Table & arr, LineInfo * at );
     DAS_API void table_unlock ( Context & context, Table & arr, LineInfo * at );
@@ -51,9 +51,9 @@ namespace das {
         uint32_t            mMagic = uint32_t(STATUS_MAGIC);
     };
 
-    class JobQue {
+    class DAS_API JobQue {
     public:
-        JobQue();
+        JobQue ( int threadCount = 0 );     // 0 - one worker per hardware thread
         JobQue ( const JobQue & ) = delete;
         JobQue ( JobQue && ) = delete;
         JobQue & operator = ( const JobQue & ) = delete;
@@ -63,6 +63,8 @@ namespace das {
         bool areJobsPending(JobCategory category);
         int getNumberOfQueuedJobs();
         int getTotalHwJobs();
+        uint64_t getTotalSteals() const { return mSteals; }
+        bool isWorkerThread() const;
         void push(Job && job, JobCategory category, JobPriority priority);
         void parallel_for ( JobStatus & status, int from, int to, const JobChunk & chunk, JobCategory category, JobPriority priority, int chunk_count = -1, int step = 1 );
         void parallel_for ( int from, int to, const JobChunk & chunk, JobCategory category, JobPriority priority, int chunk_count = -1, int step = 1 );
@@ -83,29 +85,47 @@ namespace das {
             JobPriority        priority = JobPriority::Inactive;
             JobCategory        category = 0;
         };
+        // every worker owns its queue. queue is sorted by priority (highest first, FIFO within same priority)
+        // owner and thieves both take from the front. worker takes from the queue with the highest front priority,
+        // so high priority jobs in the other queues are not starved by the low priority jobs in its own
+        struct WorkerQueue {
+            enum { EMPTY_PRIORITY = INT32_MIN };
+            mutex               mMutex;
+            deque<JobEntry>     mJobs;
+            atomic<int>         mSize{0};       // for the lock-free peek by thieves
+            atomic<int32_t>     mTopPriority{EMPTY_PRIORITY};  // priority of the front job, for the same peek
+            atomic<JobPriority> currentPriority{JobPriority::Inactive};
+            atomic<JobCategory> currentCategory{0};
+        };
         struct ThreadEntry {
             ThreadEntry( unique_ptr<thread> && thread) {
                 threadPointer = das::move(thread);
             };
             unique_ptr<thread>  threadPointer;
-            JobPriority         currentPriority = JobPriority::Inactive;
-            JobCategory         currentCategory = 0;
         };
     protected:
         void join();
         void job(int threadIndex);
-        void submit(Job && job, JobCategory category, JobPriority priority);
+        bool tryPop(int threadIndex, Job & job);
+        bool tryTake(WorkerQueue & que, int threadIndex, Job & job);
+        int  pickQueue();
+        void submit(int queueIndex, Job && job, JobCategory category, JobPriority priority);
+        void wakeUp(int count);
     protected:
         condition_variable mCond;
+        mutex mSleepMutex;
         int mSleepMs;
         atomic<bool>    mShutdown{false};
         atomic<int>     mThreadCount{0};
         static thread::id mTheMainThread;
-        mutex mFifoMutex;
     protected:
-        deque<JobEntry> mFifo;
+        vector<unique_ptr<WorkerQueue>> mQueues;
         vector<ThreadEntry> mThreads;
-        atomic<int> mJobsRunning{0};
+        atomic<int> mJobsQueued{0};         // jobs sitting in worker queues
+        atomic<int> mJobsPending{0};        // queued + running, job is done when its counted out
+        atomic<int> mSleeping{0};
+        atomic<uint32_t> mNextQueue{0};
+        atomic<uint64_t> mSteals{0};
     protected:
         mutex mEvalMainThreadMutex;
         vector<Job> mEvalMainThread;
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <atomic>
+
+#include "daScript/misc/callable.h"
+
 namespace das {
 
 #if DAS_TRACK_ALLOCATIONS
@@ -19,19 +23,39 @@ namespace das {
 
     struct LineInfo;
 
+    // decks in the free list mode are made of whole pages of this size, aligned to it,
+    // so that the page of the pointer tells which deck it belongs to. every size class in use reserves at least one page
+    #define DAS_DECK_PAGE_SHIFT 16
+    #define DAS_DECK_PAGE_SIZE  (1u<<DAS_DECK_PAGE_SHIFT)
+
+    // page aligned memory for the free list decks. huge pages are only a hint, and only on linux
+    DAS_API char * das_deck_alloc ( uint32_t bytes, bool hugePages );
+    DAS_API void das_deck_free ( char * ptr, uint32_t bytes );
+
     struct Deck {
-        Deck( uint32_t ne, uint32_t es, Deck * n ) {
-            total = (ne+31) & ~31;
+        Deck( uint32_t ne, uint32_t es, Deck * n, bool fl = false, bool hugePages = false ) {
             size = es;
+            freeListMode = fl;
+            if ( freeListMode ) {
+                mappedBytes = uint32_t((uint64_t(ne) * es + DAS_DECK_PAGE_SIZE - 1) & ~uint64_t(DAS_DECK_PAGE_SIZE - 1));
+                total = (mappedBytes / size) & ~31;
+                data = das_deck_alloc(mappedBytes, hugePages);
+            } else {
+                total = (ne+31) & ~31;
+                data = (char*) das_aligned_alloc16(total * size);
+            }
             totalBytes = total * size;
-            data = (char*) das_aligned_alloc16(totalBytes);
             bits = (uint32_t*) das_aligned_alloc16(total / 32 * 4);
             gc_bits = nullptr;
             reset();    // this reset before next
             next = n;
         }
         ~Deck ( ) {
-            das_aligned_free16(data);
+            if ( freeListMode ) {
+                das_deck_free(data, mappedBytes);
+            } else {
+                das_aligned_free16(data);
+            }
             das_aligned_free16(bits);
             if ( next ) delete next;
         }
@@ -39,28 +63,65 @@ namespace das {
             memset ( bits, 0, total / 32 * 4);
             look = 0;
             allocated = 0;
+            freeList = nullptr;
+            bump = 0;
             if ( next ) next->reset();
         }
         void beforeGC() {
+            allocateGcBits();
+            if ( next ) next->beforeGC();
+        }
+        void allocateGcBits() {
             auto total_bytes = total / 32 * 4;
             if ( total_bytes ) {
-                gc_bits = (uint32_t*) das_aligned_alloc16(total_bytes);
-                memset ( gc_bits, 0, total_bytes);
+                gc_bits = new atomic<uint32_t>[total / 32]();
             } else {
                 gc_bits = nullptr;
             }
             look = 0;
             gc_allocated = 0;
-            if ( next ) next->beforeGC();
+        }
+        void cancelGC() {
+            if ( gc_bits ) {
+                delete [] gc_bits;
+                gc_bits = nullptr;
+            }
+            gc_allocated = 0;
+            if ( next ) next->cancelGC();
         }
         void afterGC() {
             auto total_bytes = total / 32 * 4;
             if ( total_bytes ) {
-                memcpy ( bits, gc_bits, total_bytes );
-                das_aligned_free16 ( gc_bits );
+                for ( uint32_t i=0, is=total/32; i!=is; ++i ) {
+                    bits[i] = gc_bits[i].load(memory_order_relaxed);
+                }
+                delete [] gc_bits;
                 gc_bits = nullptr;
             }
-            allocated = gc_allocated;
+            allocated = gc_allocated.load(memory_order_relaxed);
+            if ( freeListMode ) rebuildFreeList();
+        }
+        // collected slots are only cleared in the bits, so the list is threaded again after the sweep.
+        // lowest addresses end up at the head, and the untouched tail goes back to the bump pointer
+        void rebuildFreeList() {
+            uint32_t top = 0;
+            for ( uint32_t i=bump; i!=0; --i ) {
+                uint32_t idx = i - 1;
+                if ( bits[idx>>5] & (1u<<(idx&31)) ) {
+                    top = i;
+                    break;
+                }
+            }
+            bump = top;
+            freeList = nullptr;
+            for ( uint32_t i=top; i!=0; --i ) {
+                uint32_t idx = i - 1;
+                if ( !(bits[idx>>5] & (1u<<(idx&31))) ) {
+                    char * slot = data + idx * size;
+                    *(char **)slot = freeList;
+                    freeList = slot;
+                }
+            }
         }
         __forceinline bool isOwnPtr ( char * ptr ) const {
             return (ptr>=data) && (ptr<data+totalBytes);
@@ -74,7 +135,26 @@ namespace das {
             uint32_t b = bits[i];
             return ((b & (1u<<j))!=0);
         }
+        // free list mode, O(1). the bits are still kept, they are what GC and validation look at
+        __forceinline char * allocateFromList ( ) {
+            uint32_t idx;
+            char * res;
+            if ( freeList ) {
+                res = freeList;
+                freeList = *(char **)res;
+                idx = uint32_t((res - data) / size);
+            } else if ( bump < total ) {
+                idx = bump ++;
+                res = data + idx * size;
+            } else {
+                return nullptr;
+            }
+            bits[idx >> 5] |= 1u << (idx & 31);
+            allocated ++;
+            return res;
+        }
         __forceinline char * allocate ( ) {
+            if ( freeListMode ) return allocateFromList();
             if ( allocated == total ) return nullptr;
             uint32_t maxt = total / 32;
             for ( uint32_t t=0; t!=maxt; ++t ) {
@@ -105,6 +185,10 @@ namespace das {
             bits[i] = b ^ (1u<<j);
             look = i;
             allocated --;
+            if ( freeListMode ) {
+                *(char **)ptr = freeList;
+                freeList = ptr;
+            }
         }
         __forceinline bool mark ( char * ptr ) {
             ptrdiff_t idx = (ptr - data) / size;
@@ -112,34 +196,77 @@ namespace das {
             uint32_t uidx = uint32_t(idx);
             uint32_t i = uidx >> 5;
             uint32_t j = uidx & 31;
-            uint32_t b = gc_bits[i];
+            uint32_t b = gc_bits[i].load(memory_order_relaxed);
             if ( !(b & (1u<<j)) ) {
-                gc_bits[i] = b | (1u<<j);
-                gc_allocated ++;
+                gc_bits[i].store(b | (1u<<j), memory_order_relaxed);
+                gc_allocated.store(gc_allocated.load(memory_order_relaxed) + 1, memory_order_relaxed);
                 return true;
             }
             return false;
         }
+        __forceinline void unmark ( char * ptr ) {
+            uint32_t uidx = uint32_t((ptr - data) / size);
+            uint32_t i = uidx >> 5;
+            uint32_t bit = 1u << (uidx & 31);
+            uint32_t b = gc_bits[i].load(memory_order_relaxed);
+            if ( b & bit ) {
+                gc_bits[i].store(b & ~bit, memory_order_relaxed);
+                gc_allocated.store(gc_allocated.load(memory_order_relaxed) - 1, memory_order_relaxed);
+            }
+        }
+        __forceinline bool markAtomic ( char * ptr ) {
+            ptrdiff_t idx = (ptr - data) / size;
+            DAS_ASSERT ( idx>=0 && idx<ptrdiff_t(total) );
+            uint32_t uidx = uint32_t(idx);
+            uint32_t i = uidx >> 5;
+            uint32_t bit = 1u << (uidx & 31);
+            if ( gc_bits[i].load(memory_order_relaxed) & bit ) return false;  // cheap check, most of the marks are repeats
+            if ( gc_bits[i].fetch_or(bit, memory_order_relaxed) & bit ) return false;
+            gc_allocated.fetch_add(1, memory_order_relaxed);
+            return true;
+        }
         char *      data = nullptr;
         uint32_t *  bits = nullptr;
-        uint32_t *  gc_bits = nullptr;
+        atomic<uint32_t> *  gc_bits = nullptr;     // atomic, so that the parallel mark can share it (plain loads and stores otherwise)
         uint32_t    total = 0;
         uint32_t    size = 0;
         uint32_t    totalBytes = 0;
         uint32_t    look = 0;
         uint32_t    allocated = 0;
-        uint32_t    gc_allocated = 0;
+        atomic<uint32_t>    gc_allocated{0};
+        char *      freeList = nullptr;     // free list mode only, next slot is stored in the slot itself
+        uint32_t    bump = 0;               // free list mode only, slots past it were never handed out
+        uint32_t    mappedBytes = 0;        // free list mode only, whole pages
+        bool        freeListMode = false;
         Deck *      next = nullptr;
     };
 
+    // per size class counters, kept by every shoe
+    struct HeapSizeClassStats {
+        int32_t     size;                   // slot size in bytes
+        int32_t     decks;
+        uint64_t    live;                   // slots in use
+        uint64_t    capacity;               // slots in all decks
+        uint64_t    peak;                   // most slots in use at once
+        uint64_t    allocations;
+        uint64_t    frees;
+    };
+
 #define DAS_MAX_SHOE_ALLOCATION     256
 #define DAS_MAX_SHOE_CUNKS          (DAS_MAX_SHOE_ALLOCATION>>4)
 
     struct Shoe {
+        struct Counters {
+            uint64_t    live = 0;
+            uint64_t    peak = 0;
+            uint64_t    allocations = 0;
+            uint64_t    frees = 0;
+        };
         Shoe () {
             lastChunk = nullptr;
             for ( int i=0; i!= DAS_MAX_SHOE_CUNKS; ++i ) {
                 chunks[i] = nullptr;
+                hot[i] = nullptr;
             }
         }
         ~Shoe() {
@@ -151,20 +278,77 @@ namespace das {
             for ( int i=0; i!= DAS_MAX_SHOE_CUNKS; ++i ) {
                 if ( chunks[i] ) delete chunks[i];
                 chunks[i] = nullptr;
+                hot[i] = nullptr;
+                counters[i].live = 0;
             }
+            pageMap.clear();
+            lastChunk = nullptr;
         }
         void reset() {
             // TODO: modify watermarks
             for ( int i=0; i!= DAS_MAX_SHOE_CUNKS; ++i ) {
                 if ( chunks[i] ) chunks[i]->reset();
+                counters[i].live = 0;
             }
         }
+        bool empty() const {
+            for ( int i=0; i!= DAS_MAX_SHOE_CUNKS; ++i ) {
+                if ( chunks[i] ) return false;
+            }
+            return true;
+        }
+        // new deck goes in front of its size class. in the free list mode every page of it is registered
+        void addDeck ( uint32_t si, Deck * deck ) {
+            chunks[si] = deck;
+            if ( freeListMode ) {
+                uint64_t page = uint64_t(intptr_t(deck->data)) >> DAS_DECK_PAGE_SHIFT;
+                for ( uint32_t i=0, is=deck->mappedBytes>>DAS_DECK_PAGE_SHIFT; i!=is; ++i ) {
+                    pageMap[page+i] = deck;
+                }
+                hot[si] = deck;
+            }
+        }
+        __forceinline Deck * findDeck ( char * ptr, uint32_t size ) const {
+            auto it = pageMap.find(uint64_t(intptr_t(ptr)) >> DAS_DECK_PAGE_SHIFT);
+            if ( it==pageMap.end() ) return nullptr;
+            Deck * ch = it->second;
+            return (ch->size==size && ch->isOwnPtr(ptr)) ? ch : nullptr;
+        }
+        __forceinline void countAllocation ( uint32_t si ) {
+            auto & cnt = counters[si];
+            cnt.allocations ++;
+            cnt.live ++;
+            if ( cnt.live > cnt.peak ) cnt.peak = cnt.live;
+        }
+        __forceinline void countFree ( uint32_t si ) {
+            counters[si].frees ++;
+            counters[si].live --;
+        }
         char * allocate ( uint32_t size ) {
             size = (size + 15) & ~15;
             DAS_ASSERT(size && size<=DAS_MAX_SHOE_ALLOCATION);
             uint32_t si = (size >> 4) - 1;
+            if ( freeListMode ) {
+                Deck * hch = hot[si];
+                if ( hch ) {
+                    if ( char * res = hch->allocateFromList() ) {
+                        countAllocation(si);
+                        return res;
+                    }
+                }
+                for ( auto ch = chunks[si]; ch; ch=ch->next ) {
+                    if ( ch==hch ) continue;
+                    if ( char * res = ch->allocateFromList() ) {
+                        hot[si] = ch;
+                        countAllocation(si);
+                        return res;
+                    }
+                }
+                return nullptr;
+            }
             for ( auto ch = chunks[si]; ch; ch=ch->next ) {
                 if ( char * res = ch->allocate() ) {
+                    countAllocation(si);
                     return res;
                 }
             }
@@ -174,9 +358,20 @@ namespace das {
             size = (size + 15) & ~15;
             DAS_ASSERT(size && size<=DAS_MAX_SHOE_ALLOCATION);
             uint32_t si = (size >> 4) - 1;
+            if ( freeListMode ) {
+                if ( Deck * ch = findDeck(ptr, size) ) {
+                    ch->free(ptr);
+                    hot[si] = ch;       // whatever was just freed is the next thing to allocate
+                    countFree(si);
+                    return;
+                }
+                DAS_FATAL_ERROR("deleting %p %i, which is not a chunk pointer (or chunk size mismatch)\n", (void *)ptr, size);
+                return;
+            }
             for ( auto ch = chunks[si]; ch; ch=ch->next ) {
                 if ( ch->isOwnPtr(ptr) ) {
                     ch->free(ptr);
+                    countFree(si);
                     return;
                 }
             }
@@ -185,6 +380,10 @@ namespace das {
         bool mark ( char * ptr, uint32_t size ) {
             size = (size + 15) & ~15;
             DAS_ASSERT(size && size<=DAS_MAX_SHOE_ALLOCATION);
+            if ( freeListMode ) {
+                Deck * ch = findDeck(ptr, size);
+                return ch ? ch->mark(ptr) : false;
+            }
             if ( lastChunk && lastChunk->isOwnPtr(ptr) ) {
                 return lastChunk->mark(ptr);
             }
@@ -197,13 +396,55 @@ namespace das {
             }
             return false;
         }
+        // same as mark, but safe to call from multiple threads at once. lastChunk is only read, never updated
+        bool markAtomic ( char * ptr, uint32_t size ) {
+            size = (size + 15) & ~15;
+            DAS_ASSERT(size && size<=DAS_MAX_SHOE_ALLOCATION);
+            if ( freeListMode ) {
+                Deck * ch = findDeck(ptr, size);
+                return ch ? ch->markAtomic(ptr) : false;
+            }
+            auto lch = lastChunk;
+            if ( lch && lch->isOwnPtr(ptr) ) {
+                return lch->markAtomic(ptr);
+            }
+            uint32_t si = (size >> 4) - 1;
+            for ( auto ch = chunks[si]; ch; ch=ch->next ) {
+                if ( ch != lch && ch->isOwnPtr(ptr) ) {
+                    return ch->markAtomic(ptr);
+                }
+            }
+            return false;
+        }
         void beforeGC() {
             for ( int i=0; i!=DAS_MAX_SHOE_CUNKS; ++i ) {
                 if ( chunks[i] ) chunks[i]->beforeGC();
             }
         }
+        void cancelGC() {
+            for ( int i=0; i!=DAS_MAX_SHOE_CUNKS; ++i ) {
+                if ( chunks[i] ) chunks[i]->cancelGC();
+            }
+        }
+        void unmark ( char * ptr, uint32_t size ) {
+            size = (size + 15) & ~15;
+            if ( freeListMode ) {
+                if ( Deck * ch = findDeck(ptr, size) ) ch->unmark(ptr);
+                return;
+            }
+            uint32_t si = (size >> 4) - 1;
+            for ( auto ch = chunks[si]; ch; ch=ch->next ) {
+                if ( ch->isOwnPtr(ptr) ) {
+                    ch->unmark(ptr);
+                    return;
+                }
+            }
+        }
         bool isOwnPtr ( char * ptr, uint32_t size ) const {
             DAS_ASSERT(size && size<=DAS_MAX_SHOE_ALLOCATION);
+            if ( freeListMode ) {
+                return findDeck(ptr, (size + 15) & ~15) != nullptr;
+            }
             if ( lastChunk && lastChunk->isOwnPtr(ptr) ) {
                 return true;
             }
@@ -218,6 +459,10 @@ namespace das {
         }
         bool isAllocatedPtr ( char * ptr, uint32_t size ) const {
             DAS_ASSERT(size && size<=DAS_MAX_SHOE_ALLOCATION);
+            if ( freeListMode ) {
+                Deck * ch = findDeck(ptr, (size + 15) & ~15);
+                return ch ? ch->isAllocatedPtr(ptr) : false;
+            }
             if ( lastChunk && lastChunk->isOwnPtr(ptr) ) {
                 return lastChunk->isAllocatedPtr(ptr);
             }
@@ -266,8 +511,27 @@ namespace das {
             getStats(d, p, b, t);
             return t;
         }
+        void getSizeClassStats ( uint32_t si, HeapSizeClassStats & st ) const {
+            DAS_ASSERT(si < DAS_MAX_SHOE_CUNKS);
+            st.size = int32_t((si+1)<<4);
+            st.decks = 0;
+            st.capacity = 0;
+            for ( auto ch = chunks[si]; ch; ch=ch->next ) {
+                st.decks ++;
+                st.capacity += ch->total;
+            }
+            st.live = counters[si].live;
+            st.peak = counters[si].peak;
+            st.allocations = counters[si].allocations;
+            st.frees = counters[si].frees;
+        }
         Deck *  chunks[DAS_MAX_SHOE_CUNKS];
         mutable Deck *  lastChunk;
+        // free list mode
+        bool            freeListMode = false;
+        Deck *          hot[DAS_MAX_SHOE_CUNKS];     // deck which had the last free, or the last successful allocation
+        das_hash_map<uint64_t,Deck *> pageMap;       // DAS_DECK_PAGE_SIZE page -> deck
+        Counters        counters[DAS_MAX_SHOE_CUNKS];
     };
 
     typedef function<int(int)> CustomGrowFunction;
@@ -286,6 +550,8 @@ namespace das {
         char * allocate ( uint32_t size );
         bool free ( char * ptr, uint32_t size );
         char * reallocate ( char * ptr, uint32_t size, uint32_t nsize );
+        // small allocations go through per size class free lists. only before anything is allocated
+        bool setFreeListMode ( bool freeLists, bool hugePages );
         __forceinline int depth() const { return shoe.depth(); }
 #if !DAS_TRACK_ALLOCATIONS
         __forceinline bool isOwnPtr( char * ptr, uint32_t size ) const {
@@ -306,6 +572,14 @@ namespace das {
             return (bigStuff.find(ptr)!=bigStuff.end());
         }
 #endif
+        bool markAtomic ( char * ptr, uint32_t size );
+        // incremental collection. while the mark is in progress, frees are deferred so that
+        // memory which is still queued for marking stays valid, and new decks get their own gc bits
+        void beforeGC();
+        void cancelGC();
+        void setDeferFree ( bool defer );
+        void flushDeferredFree ( bool unmark );
+        void forEachChunk ( const callable<void(char *,uint64_t)> & fn ) const;
         uint32_t bytesAllocated() const { return totalAllocated; }
         uint32_t maxBytesAllocated() const { return maxAllocated; }
         uint64_t totalAlignedMemoryAllocated() const;
@@ -316,6 +590,10 @@ namespace das {
         uint32_t                initialSize = 0;
         Shoe                    shoe;
         das_hash_map<void *,uint32_t> bigStuff;  // note: can't use char *, some stl implementations try hashing it as string
+        vector<pair<char *,uint32_t>>   deferredFree;
+        bool                    gcActive = false;
+        bool                    deferFree = false;
+        bool                    hugePages = false;
 #if DAS_SANITIZER
         das_hash_map<void *,uint32_t> deletedBigStuff;
 #endif
@@ -33,4 +33,76 @@ namespace das {
         socket_t server_fd = 0;
         socket_t client_fd = 0;
     };
-}
\ No newline at end of file
+
+    struct NetBuffer {
+        const char *    data;
+        uint32_t        size;
+    };
+
+    // many connections over one event loop (epoll on linux, poll elsewhere)
+    // connections are identified by positive ids, both accepted and outgoing ones
+    // tick does all the socket io first, then dispatches callbacks - one onData per connection per tick
+    // errors and logs which happen during the io are reported from the dispatch as well
+    class MultiServer : public ptr_ref_count {
+    public:
+        MultiServer ();
+        virtual ~MultiServer();
+        bool init ( int port = 9000, int backlog = 64 );
+        int32_t connect ( const char * host, int port );
+        int32_t get_port() const;
+        bool is_open() const;
+        int32_t connections() const;
+        bool is_connected ( int32_t conn ) const;
+        int32_t tick ( int32_t timeoutMs = 0 );
+        bool send_msg ( int32_t conn, const char * data, uint32_t size );
+        bool send_msgv ( int32_t conn, const NetBuffer * parts, uint32_t count );
+        uint64_t pending ( int32_t conn ) const;
+        void close ( int32_t conn );
+    protected:
+        virtual void onConnect ( int32_t conn );
+        virtual void onDisconnect ( int32_t conn );
+        virtual void onData ( int32_t conn, char * buf, int size );
+        virtual void onError ( const char * msg, int code );
+        virtual void onLog ( const char * msg );
+    protected:
+        struct Connection {
+            socket_t        fd = 0;
+            int32_t         id = 0;
+            bool            connected = false;  // onConnect was dispatched
+            bool            connecting = false; // outgoing connect is in progress, sends are queued
+            bool            closing = false;
+            bool            broken = false;     // socket failed or hung up, queued data can't be delivered
+            bool            wantWrite = false;
+            vector<char>    inbox;
+            vector<char>    outbox;
+            uint32_t        outboxOffset = 0;
+        };
+        Connection * find ( int32_t conn ) const;
+        int32_t addConnection ( socket_t fd, bool connecting = false );
+        void acceptAll();
+        void readAll ( Connection * con );
+        void writable ( Connection * con );
+        void hangup ( Connection * con );
+        bool flush ( Connection * con );
+        void queue ( Connection * con, const char * data, uint32_t size );
+        void watchWrite ( Connection * con, bool write );
+        void fail ( Connection * con, const char * msg, int code );
+        void error ( const char * msg, int code );
+        void log ( const char * msg );
+        void dispatch();
+    protected:
+        socket_t                            server_fd = 0;
+        int                                 poll_fd = -1;
+        int32_t                             lastId = 0;
+        das_hash_map<int32_t,Connection *>  conns;
+        vector<int32_t>                     order;      // ids in the order they were added
+        vector<char>                        batch;
+        struct Deferred {
+            string  msg;
+            int     code = 0;
+            bool    isError = false;
+        };
+        vector<Deferred>                    deferred;   // errors and logs of the io, reported from the dispatch
+        bool                                inIo = false;
+    };
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+namespace das {
+
+    // Tracks which pages of registered memory regions were written to, between start() and stop().
+    // Pages are write-protected on start, and the first write to each page is caught by the access violation handler,
+    // which records the page as dirty and lifts the protection. Only whole pages inside a region are watched,
+    // anything else (including memory outside of all regions) is always reported as dirty.
+    // System calls which write directly into watched pages (read, recv into a watched buffer) fail with EFAULT
+    // instead of faulting, so watched memory should not be handed to the OS while the watch is active.
+    class DAS_API PageWriteWatch {
+    public:
+        PageWriteWatch() = default;
+        PageWriteWatch ( const PageWriteWatch & ) = delete;
+        PageWriteWatch & operator = ( const PageWriteWatch & ) = delete;
+        ~PageWriteWatch();
+        static bool isSupported();
+        void addRegion ( char * ptr, uint64_t size );   // only before start
+        bool start();                                   // false if nothing is watched, then everything is dirty
+        void stop();
+        bool isActive() const { return active; }
+        bool isDirty ( const char * ptr, uint64_t size ) const;
+        uint64_t dirtyPages() const;
+        uint64_t watchedPages() const;
+    public:
+        bool onWriteFault ( const void * addr );        // called from the fault handler
+    protected:
+        struct Region {
+            uintptr_t   first;      // page aligned
+            uintptr_t   last;       // page aligned, exclusive
+            uint8_t *   dirty;      // one byte per page, written from the fault handler
+        };
+        vector<Region>  regions;    // sorted by first, immutable while active
+        vector<uint8_t> dirtyStorage;
+        int32_t         slot = -1;
+        bool            active = false;
+        bool            started = false;
+    };
+}
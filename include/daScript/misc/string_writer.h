@@ -104,6 +104,46 @@ namespace das {
         int32_t capacity = DAS_STRING_BUILDER_BUFFER_SIZE;
     };
 
+    #ifndef DAS_STRING_CHUNK_SIZE
+    #define DAS_STRING_CHUNK_SIZE   65536
+    #endif
+
+    // text is kept in the list of chunks, which never move. chunks start small and double up to DAS_STRING_CHUNK_SIZE
+    class DAS_API ChunkedTextWriter : public StringWriter {
+    public:
+        ChunkedTextWriter() {}
+        ChunkedTextWriter(const ChunkedTextWriter&) = delete;
+        ChunkedTextWriter(ChunkedTextWriter&&) = delete;
+        ChunkedTextWriter& operator=(const ChunkedTextWriter&) = delete;
+        ChunkedTextWriter& operator=(ChunkedTextWriter&&) = delete;
+
+        virtual ~ChunkedTextWriter();
+        virtual string str() const override;
+        virtual uint64_t tellp() const override;
+        virtual void output() override;
+        bool empty() const { return total == 0; }
+        void clear();
+        void copyTo ( char * dest ) const;
+        template <typename TT>
+        void forEachChunk ( TT && fn ) const {
+            for ( auto & ch : chunks ) {
+                if ( ch.size ) fn(ch.data, ch.size);
+            }
+        }
+    protected:
+        virtual void append(const char * s, int l)  override;
+        virtual char * allocate (int l) override;
+        void newChunk ( uint32_t minCapacity );
+    protected:
+        struct Chunk {
+            char *      data;
+            uint32_t    size;
+            uint32_t    capacity;
+        };
+        vector<Chunk>   chunks;
+        uint64_t        total = 0;
+    };
+
     class DAS_API TextPrinter : public TextWriter {
     public:
         TextPrinter() {}
@@ -48,7 +48,13 @@ namespace das {
     DAS_API void string_heap_report ( Context * context, LineInfoArg * info );
     DAS_API bool is_intern_strings ( Context * context );
     DAS_API void heap_collect ( bool stringHeap, bool validate, Context * context, LineInfoArg * info );
+    DAS_API bool collect_heap_step ( int32_t budgetUs, bool sheap, Context * context, LineInfoArg * info );
+    DAS_API void cancel_collect_heap_step ( Context * context );
+    DAS_API bool is_collecting_heap ( Context * context );
+    DAS_API GcPauseReport heap_collect_report ( Context * context );
+    DAS_API void set_gc_mark_workers ( int32_t workers, Context * context );
     DAS_API void heap_report ( Context * context, LineInfoArg * info );
+    DAS_API HeapSizeClassStats heap_size_class_stats ( int32_t sizeClass, Context * context, LineInfoArg * at );
     DAS_API void memory_report ( bool errorsOnly, Context * context, LineInfoArg * info );
     DAS_API void builtin_table_lock ( const Table & arr, Context * context, LineInfoArg * at );
     DAS_API void builtin_table_unlock ( const Table & arr, Context * context, LineInfoArg * at );
@@ -103,6 +109,18 @@ namespace das {
         if ( length>1 ) sort ( data, data + length );
     }
 
+    // numeric arrays go to the radix sort
+    template <> DAS_API void builtin_sort<int32_t> ( int32_t * data, int32_t length );
+    template <> DAS_API void builtin_sort<uint32_t> ( uint32_t * data, int32_t length );
+    template <> DAS_API void builtin_sort<int64_t> ( int64_t * data, int32_t length );
+    template <> DAS_API void builtin_sort<uint64_t> ( uint64_t * data, int32_t length );
+    template <> DAS_API void builtin_sort<float> ( float * data, int32_t length );
+    template <> DAS_API void builtin_sort<double> ( double * data, int32_t length );
+
+    template <typename KT>
+    void builtin_sort_order ( const KT * keys, int32_t * order, int32_t length );
+    DAS_API void builtin_sort_order_string ( void * keys, int32_t * order, int32_t length );
+    DAS_API void builtin_sort_permute ( void * data, int32_t stride, const int32_t * order, int32_t length );
     DAS_API void builtin_sort_string ( void * data, int32_t length );
     DAS_API void builtin_sort_any_cblock ( void * anyData, int32_t elementSize, int32_t length, const Block & cmp, Context * context, LineInfoArg * lineinfo );
     DAS_API void builtin_sort_any_ref_cblock ( void * anyData, int32_t elementSize, int32_t length, const Block & cmp, Context * context, LineInfoArg * lineinfo );
@@ -65,6 +65,7 @@ namespace das {
     DAS_API bool builtin_stat ( const char * filename, FStat & fs );
     DAS_API void builtin_dir ( const char * path, const Block & fblk, Context * context, LineInfoArg * at );
     DAS_API bool builtin_mkdir ( const char * path );
+    DAS_API bool builtin_rmdir ( const char * path );   // directory has to be empty
     DAS_API bool builtin_chdir ( const char * path );
     DAS_API char * builtin_getcwd ( Context * context, LineInfoArg * at );
     DAS_API const FILE * builtin_stdin();
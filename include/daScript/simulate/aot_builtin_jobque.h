@@ -5,6 +5,7 @@
 #include "aot.h"
 
 #include <queue>
+#include <shared_mutex>
 
 namespace das {
 
@@ -48,41 +49,122 @@ namespace das {
         TT get () { return value.load(); }
         void set ( TT v ) { value.store(v); }
     public:
-        atomic<TT>  value;
+        atomic<TT>  value{0};
     };
 
     typedef AtomicTT<int32_t> AtomicInt;
     typedef AtomicTT<int64_t> AtomicInt64;
 
+    // bounded multi-producer multi-consumer ring of features (D. Vyukov's sequence-per-cell queue)
+    // push and pop are lock-free among themselves, both fail instead of waiting when the ring is full or empty
+    // cells are rounded up to a power of two, but no more than the requested capacity is ever stored
+    class DAS_API FeatureRing {
+    public:
+        FeatureRing ( uint32_t cap );
+        bool tryPush ( Feature & f );   // f is moved only on success
+        bool tryPop ( Feature & f );
+        uint32_t capacity() const { return limit; }
+        uint32_t approxSize() const {
+            auto cnt = count.load(memory_order_relaxed);
+            return cnt > 0 ? uint32_t(cnt) : 0u;
+        }
+        // peek, verify and gc walk, pushes and pops wait until it is done
+        template <typename TT>
+        void for_each ( TT && tt ) {
+            unique_lock<shared_mutex> guard(walkLock);
+            for ( size_t pos = dequeuePos.load(), end = enqueuePos.load(); pos != end; ++pos ) {
+                auto & cell = cells[pos & mask];
+                if ( cell.sequence.load(memory_order_acquire) == pos + 1 ) {
+                    tt(cell.data);
+                }
+            }
+        }
+    protected:
+        struct Cell {
+            atomic<size_t>  sequence{0};
+            Feature         data;
+        };
+        unique_ptr<Cell[]>          cells;
+        size_t                      mask = 0;
+        uint32_t                    limit = 0;
+        shared_mutex                walkLock;
+        alignas(64) atomic<int32_t> count{0};       // reserved by push before the cell is taken, released by pop
+        alignas(64) atomic<size_t>  enqueuePos{0};
+        alignas(64) atomic<size_t>  dequeuePos{0};
+    };
+
     class DAS_API Channel : public JobStatus {
     public:
         Channel( Context * ctx ) : owner(ctx) {}
         Channel( Context * ctx, int count) : owner(ctx) { mRemaining = count; }
+        Channel( Context * ctx, int count, uint32_t capacity ) : owner(ctx), ring(make_unique<FeatureRing>(capacity)) { mRemaining = count; }
         virtual ~Channel();
         void push ( void * data, TypeInfo * ti, Context * context );
+        bool tryPush ( void * data, TypeInfo * ti, Context * context );
         void pushBatch ( void ** data, int count, TypeInfo * ti, Context * context );
         void pop ( const TBlock<void,void *> & blk, Context * context, LineInfoArg * at );
+        int popBatch ( int maxCount, const TBlock<void,void *> & blk, Context * context, LineInfoArg * at );
         bool isEmpty() const;
+        bool isBounded() const { return ring != nullptr; }
         int total() const;
+        int capacity() const { return ring ? int(ring->capacity()) : 0; }
         Context * getOwner() { return owner; }
+    protected:
+        void pushRing ( Feature & f );
+        bool popRing ( Feature & f );
+        void wakeRingWaiters();
     public:
         template <typename TT>
         void for_each_item ( TT && tt ) {
             lock_guard<mutex> guard(mCompleteMutex);
+            if ( ring ) {
+                ring->for_each([&](Feature & f) {
+                    tt(f.data, f.type, f.from ? f.from.get() : owner);
+                });
+                return;
+            }
             for ( auto & f : pipe ) {
                 tt(f.data, f.type, f.from ? f.from.get() : owner);
             }
         }
         template <typename TT>
         void gather ( TT && tt ) {
+            if ( ring ) {
+                Feature f;
+                while ( ring->tryPop(f) ) {
+                    tt(f.data, f.type, f.from ? f.from.get() : owner);
+                }
+                wakeRingWaiters();
+                return;
+            }
             lock_guard<mutex> guard(mCompleteMutex);
             for ( auto & f : pipe ) {
                 tt(f.data, f.type, f.from ? f.from.get() : owner);
             }
             pipe.clear();
         }
+        // returns false if features of other contexts did not fit back into the bounded ring (and were dropped)
         template <typename TT>
-        void gatherEx ( Context * ctx, TT && tt ) {
+        bool gatherEx ( Context * ctx, TT && tt ) {
+            if ( ring ) {
+                // features of other contexts go back at the end of the ring, producers may have taken their place
+                vector<Feature> others;
+                Feature f;
+                for ( uint32_t i=0, is=ring->approxSize(); i!=is && ring->tryPop(f); ++i ) {
+                    auto itOwner = f.from ? f.from.get() : owner;
+                    if ( itOwner == ctx ) {
+                        tt(f.data, f.type, itOwner);
+                    } else {
+                        others.emplace_back(das::move(f));
+                    }
+                }
+                bool fits = true;
+                for ( auto & o : others ) {
+                    if ( !ring->tryPush(o) ) fits = false;
+                }
+                wakeRingWaiters();
+                return fits;
+            }
             lock_guard<mutex> guard(mCompleteMutex);
             for ( auto f = pipe.begin(); f != pipe.end(); ) {
                 auto itOwner = f->from ? f->from.get() : owner;
@@ -93,9 +175,31 @@ namespace das {
                     ++f;
                 }
             }
+            return true;
         }
+        // returns false if some features did not fit into the bounded target channel (and were dropped)
         template <typename TT>
-        void gather_and_forward ( Channel * that, TT && tt ) {
+        bool gather_and_forward ( Channel * that, TT && tt ) {
+            if ( ring || that->ring ) {
+                vector<Feature> items;
+                if ( ring ) {
+                    Feature f;
+                    while ( ring->tryPop(f) ) items.emplace_back(das::move(f));
+                    wakeRingWaiters();
+                } else {
+                    lock_guard<mutex> guard(mCompleteMutex);
+                    for ( auto & f : pipe ) items.emplace_back(das::move(f));
+                    pipe.clear();
+                }
+                for ( auto & f : items ) {
+                    tt(f.data, f.type, f.from ? f.from.get() : owner);
+                }
+                bool fits = true;
+                for ( auto & f : items ) {
+                    if ( !that->tryForward(f) ) fits = false;
+                }
+                return fits;
+            }
             lock_guard<mutex> guard(mCompleteMutex);
             for ( auto & f : pipe ) {
                 tt(f.data, f.type, f.from ? f.from.get() : owner);
@@ -106,19 +210,56 @@ namespace das {
             }
             pipe.clear();
             that->mCond.notify_all();  // notify_one??
+            return true;
         }
+        bool tryForward ( Feature & f );
     protected:
         uint32_t            mSleepMs = 1;
         deque<Feature>      pipe;
         Feature             tail;
         Context *           owner = nullptr;
+        unique_ptr<FeatureRing> ring;       // bounded channel, pipe is not used
+        atomic<int>         mRingWaiters{0};
+    };
+
+    // idle job clones of one parent context. new_job_invoke takes clones from here instead of cloning for every job.
+    // clone is returned once the job is done and nothing else holds it (i.e. no channel feature points into its heap),
+    // its heaps are reset and globals are restored either from the snapshot or by re-running the init script
+    class DAS_API JobContextPool {
+    public:
+        JobContextPool ( Context * ctx );
+        ~JobContextPool();
+        shared_ptr<Context> acquire ( Context * parent );
+        void release ( shared_ptr<Context> && ctx );
+        void setCapacity ( uint32_t cap );
+        uint64_t getHits() const { return hits; }
+        uint64_t getMisses() const { return misses; }
+        uint64_t getDiscarded() const { return discarded; }
+        uint32_t size() const;
+    protected:
+        bool recycle ( Context * ctx );
+    protected:
+        mutable mutex               mMutex;
+        vector<shared_ptr<Context>> idle;
+        vector<char>                globalsSnapshot;    // snapshot fields are guarded by mMutex
+        bool                        snapshotChecked = false;
+        bool                        useSnapshot = false;
+        bool                        canReuse = true;
+        uint32_t                    capacity = 0;
+        atomic<uint64_t>            hits{0};
+        atomic<uint64_t>            misses{0};
+        atomic<uint64_t>            discarded{0};
     };
 
     DAS_API bool is_job_que_shutting_down();
+    DAS_API shared_ptr<JobQue> getActiveJobQue();
     DAS_API void new_job_invoke ( Lambda lambda, Func fn, int32_t lambdaSize, Context * context, LineInfoArg * lineinfo );
+    DAS_API void new_job_invoke_priority ( Lambda lambda, Func fn, int32_t lambdaSize, JobPriority priority, Context * context, LineInfoArg * lineinfo );
     DAS_API void new_thread_invoke ( Lambda lambda, Func fn, int32_t lambdaSize, Context * context, LineInfoArg * lineinfo );
     DAS_API void withJobQue ( const TBlock<void> & block, Context * context, LineInfoArg * lineInfo );
+    DAS_API void withJobQueThreads ( int32_t threads, const TBlock<void> & block, Context * context, LineInfoArg * lineInfo );
     DAS_API int getTotalHwJobs( Context * context, LineInfoArg * at );
+    DAS_API uint64_t getTotalJobSteals( Context * context, LineInfoArg * at );
     DAS_API int getTotalHwThreads ();
     DAS_API void withJobStatus ( int32_t total, const TBlock<void,JobStatus *> & block, Context * context, LineInfoArg * lineInfo );
     DAS_API void jobStatusAddRef ( JobStatus * status, Context * context, LineInfoArg * at );
@@ -130,17 +271,25 @@ namespace das {
     DAS_API void notifyAndReleaseJob ( JobStatus * & status, Context * context, LineInfoArg * at );
     DAS_API vec4f channelPush ( Context & context, SimNode_CallBase * call, vec4f * args );
     DAS_API vec4f channelPushBatch ( Context & context, SimNode_CallBase * call, vec4f * args );
+    DAS_API vec4f channelTryPush ( Context & context, SimNode_CallBase * call, vec4f * args );
     DAS_API void channelPop ( Channel * ch, const TBlock<void,void*> & blk, Context * context, LineInfoArg * at );
+    DAS_API int32_t channelPopBatch ( Channel * ch, int32_t maxCount, const TBlock<void,void*> & blk, Context * context, LineInfoArg * at );
     DAS_API int jobAppend ( JobStatus * ch, int size, Context * context, LineInfoArg * at );
     DAS_API void withChannel ( const TBlock<void,Channel *> & blk, Context * context, LineInfoArg * lineinfo );
     DAS_API void withChannelEx ( int32_t count, const TBlock<void,Channel *> & blk, Context * context, LineInfoArg * lineinfo );
+    DAS_API void withBoundedChannel ( int32_t count, int32_t capacity, const TBlock<void,Channel *> & blk, Context * context, LineInfoArg * lineinfo );
     DAS_API Channel* channelCreate( Context * context, LineInfoArg * at);
+    DAS_API Channel* channelCreateBounded( int32_t capacity, Context * context, LineInfoArg * at);
     DAS_API void channelRemove(Channel * & ch, Context * context, LineInfoArg * at);
     DAS_API void channelGather ( Channel * ch, const TBlock<void,void *> & blk, Context * context, LineInfoArg * at );
     DAS_API void channelGatherEx ( Channel * ch, const TBlock<void,void *,const TypeInfo *,Context &> & blk, Context * context, LineInfoArg * at );
     DAS_API void channelGatherAndForward ( Channel * ch, Channel * toCh, const TBlock<void,void *> & blk, Context * context, LineInfoArg * at );
     DAS_API void channelPeek ( Channel * ch, const TBlock<void,void *> & blk, Context * context, LineInfoArg * at );
     DAS_API void channelVerify ( Channel * ch, Context * context, LineInfoArg * at );
+    DAS_API uint64_t jobContextPoolHits ( Context * context );
+    DAS_API uint64_t jobContextPoolMisses ( Context * context );
+    DAS_API void jobContextPoolSetCapacity ( int32_t capacity, Context * context, LineInfoArg * at );
+    DAS_API void jobQueParallelFor ( int32_t from, int32_t to, int32_t chunkCount, TFunc<void,int32_t,int32_t,void *> fn, void * data, Context * context, LineInfoArg * at );
     DAS_API LockBox * lockBoxCreate( Context *, LineInfoArg * );
     DAS_API void lockBoxRemove( LockBox * & ch, Context * context, LineInfoArg * at );
     DAS_API void withLockBox ( const TBlock<void,LockBox *> & blk, Context * context, LineInfoArg * at );
@@ -4,6 +4,8 @@
 #include "daScript/simulate/debug_info.h"
 
 namespace das {
+    template <typename TT> struct TArray;
+
     bool makeServer ( const void * pClass, const StructInfo * info, Context * context );
     bool server_init ( smart_ptr_raw<Server> server, int port, Context * ctx, LineInfoArg * at );
     bool server_is_open ( smart_ptr_raw<Server> server, Context * context, LineInfoArg * at );
@@ -11,4 +13,17 @@ namespace das {
     bool server_send ( smart_ptr_raw<Server> server, uint8_t * data, int32_t size, Context * context, LineInfoArg * at );
     void server_tick ( smart_ptr_raw<Server> server, Context * context, LineInfoArg * at );
     void server_restore ( smart_ptr_raw<Server> server, const void * pClass, const StructInfo * info, Context * context, LineInfoArg * at );
+    bool makeMultiServer ( const void * pClass, const StructInfo * info, Context * context );
+    bool multi_server_init ( smart_ptr_raw<MultiServer> server, int32_t port, Context * context, LineInfoArg * at );
+    int32_t multi_server_connect ( smart_ptr_raw<MultiServer> server, const char * host, int32_t port, Context * context, LineInfoArg * at );
+    int32_t multi_server_port ( smart_ptr_raw<MultiServer> server, Context * context, LineInfoArg * at );
+    bool multi_server_is_open ( smart_ptr_raw<MultiServer> server, Context * context, LineInfoArg * at );
+    int32_t multi_server_connections ( smart_ptr_raw<MultiServer> server, Context * context, LineInfoArg * at );
+    bool multi_server_is_connected ( smart_ptr_raw<MultiServer> server, int32_t conn, Context * context, LineInfoArg * at );
+    int32_t multi_server_tick ( smart_ptr_raw<MultiServer> server, int32_t timeout, Context * context, LineInfoArg * at );
+    bool multi_server_send ( smart_ptr_raw<MultiServer> server, int32_t conn, uint8_t * data, int32_t size, Context * context, LineInfoArg * at );
+    bool multi_server_send_parts ( smart_ptr_raw<MultiServer> server, int32_t conn, const TArray<char *> & parts, Context * context, LineInfoArg * at );
+    uint64_t multi_server_pending ( smart_ptr_raw<MultiServer> server, int32_t conn, Context * context, LineInfoArg * at );
+    void multi_server_close ( smart_ptr_raw<MultiServer> server, int32_t conn, Context * context, LineInfoArg * at );
+    void multi_server_restore ( smart_ptr_raw<MultiServer> server, const void * pClass, const StructInfo * info, Context * context, LineInfoArg * at );
 }
@@ -88,6 +88,8 @@ namespace das {
     DAS_API vec4f rtti_contextFunctionInfo ( Context & context, SimNode_CallBase *, vec4f * );
     DAS_API vec4f rtti_contextVariableInfo ( Context & context, SimNode_CallBase *, vec4f * );
     DAS_API int32_t rtti_contextTotalFunctions(Context & context);
+    DAS_API void rtti_contextSaveInitSnapshot ( Context & ctx, const TBlock<void,bool,TTemporary<TArray<uint8_t>>,const string> & block, Context * context, LineInfoArg * at );
+    DAS_API bool rtti_contextRestoreInitSnapshot ( Context & ctx, const TArray<uint8_t> & image, Context * context, LineInfoArg * at );
     DAS_API int32_t rtti_contextTotalVariables(Context & context);
 
     __forceinline Context  & thisContext ( Context * context ) { return *context; }
@@ -111,6 +113,8 @@ namespace das {
             const TBlock<void,bool,smart_ptr<Program>,const string> & block, Context * context, LineInfoArg * at );
     DAS_API void rtti_builtin_compile_file(char * modName, smart_ptr<FileAccess> access, ModuleGroup* module_group, const CodeOfPolicies & cop,
         const TBlock<void, bool, smart_ptr<Program>, const string> & block, Context * context, LineInfoArg * lineinfo);
+    DAS_API void rtti_builtin_compile_file_cached(char * modName, smart_ptr<FileAccess> access, ModuleGroup* module_group, const CodeOfPolicies & cop,
+        char * cacheDir, const TBlock<void, bool, smart_ptr<Program>, const string> & block, Context * context, LineInfoArg * lineinfo);
 
     DAS_API void rtti_builtin_simulate ( const smart_ptr<Program> & program,
         const TBlock<void,bool,smart_ptr_raw<Context>,string> & block, Context * context, LineInfoArg * lineinfo );
@@ -121,6 +125,7 @@ namespace das {
     DAS_API void rtti_builtin_module_for_each_dependency ( Module * module, const TBlock<void,Module *,bool> & block, Context * context, LineInfoArg * at );
 
     DAS_API Module * rtti_get_this_module(smart_ptr_raw<Program> prog);
+    DAS_API void rtti_materialize_functions(smart_ptr_raw<Program> prog);
     DAS_API Module * rtti_get_builtin_module(const char * name);
 
     DAS_API void rtti_builtin_module_for_each_enumeration(Module * module, const TBlock<void, const EnumInfo> & block, Context * context, LineInfoArg * lineinfo);
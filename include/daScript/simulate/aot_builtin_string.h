@@ -4,6 +4,7 @@
 #include "daScript/misc/arraytype.h"
 #include "daScript/simulate/aot.h"
 #include "daScript/simulate/simulate.h"
+#include "daScript/simulate/json_native.h"
 #include <inttypes.h>
 
 namespace das {
@@ -85,6 +86,14 @@ namespace das {
     DAS_API StringBuilderWriter & write_string_char(StringBuilderWriter & writer, int32_t ch);
     DAS_API StringBuilderWriter & write_string_chars(StringBuilderWriter & writer, int32_t ch, int32_t count);
     DAS_API StringBuilderWriter & write_escape_string ( StringBuilderWriter & writer, char * str );
+    DAS_API void builtin_with_string_builder ( const TBlock<void,StringBuilder> & block, Context * context, LineInfoArg * at );
+    DAS_API vec4f builtin_string_builder_write ( Context & context, SimNode_CallBase * call, vec4f * args );
+    DAS_API StringBuilder & string_builder_write_char ( StringBuilder & sb, int32_t ch );
+    DAS_API StringBuilder & string_builder_write_chars ( StringBuilder & sb, int32_t ch, int32_t count );
+    DAS_API int32_t string_builder_length ( const StringBuilder & sb );
+    DAS_API void string_builder_clear ( StringBuilder & sb );
+    DAS_API char * string_builder_to_string ( const StringBuilder & sb, Context * context, LineInfoArg * at );
+    DAS_API void string_builder_peek_chunks ( const StringBuilder & sb, const TBlock<void,TTemporary<TArray<uint8_t> const>> & block, Context * context, LineInfoArg * at );
     DAS_API void builtin_string_split_by_char ( const char * str, const char * delim, const Block & sblk, Context * context, LineInfoArg * lineinfo );
     DAS_API void builtin_string_split ( const char * str, const char * delim, const Block & sblk, Context * context, LineInfoArg * lineinfo );
     DAS_API char * builtin_string_from_array ( const TArray<uint8_t> & bytes, Context * context, LineInfoArg * at );
@@ -13,6 +13,12 @@ namespace das {
         StringBuilderWriter() { }
     };
 
+    // string builder, which script code keeps across calls. text is appended to chunks, and is copied once when finalized
+    class StringBuilder : public ChunkedTextWriter {
+    public:
+        StringBuilder() { }
+    };
+
     template <typename Writer>
     struct DebugDataWalker : DataWalker {
         using loop_point = pair<void *,uint64_t>;
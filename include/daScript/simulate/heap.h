@@ -136,6 +136,13 @@ namespace das {
         virtual void report() = 0;
         virtual bool mark() = 0;
         virtual bool mark ( char * ptr, uint32_t size ) = 0;
+        virtual bool canMarkAtomic() const { return false; }
+        virtual bool markAtomic ( char *, uint32_t ) { DAS_ASSERT(0 && "not supported"); return false; }
+        virtual bool beginIncrementalMark() { return false; }      // like mark(), but frees are deferred until the end
+        virtual void endIncrementalMark ( bool /*cancel*/ ) { }     // sweep follows, unless canceled
+        virtual void forEachChunk ( const callable<void(char *,uint64_t)> & ) { }
+        virtual bool setFreeListMode ( bool /*freeLists*/, bool /*hugePages*/ ) { return false; }   // only before the first allocation
+        virtual bool getSizeClassStats ( int32_t, HeapSizeClassStats & ) const { return false; }
         virtual void sweep() = 0;
         virtual bool isOwnPtr ( char * ptr, uint32_t size ) = 0;
         virtual bool isValidPtr ( char * ptr, uint32_t size ) = 0;  // only if isOwnPtr
@@ -255,6 +262,13 @@ namespace das {
         virtual void report() override;
         virtual bool mark() override;
         virtual bool mark ( char * ptr, uint32_t size ) override;
+        virtual bool canMarkAtomic() const override { return true; }
+        virtual bool markAtomic ( char * ptr, uint32_t size ) override { return model.markAtomic(ptr,size); }
+        virtual bool beginIncrementalMark() override;
+        virtual void endIncrementalMark ( bool cancel ) override;
+        virtual void forEachChunk ( const callable<void(char *,uint64_t)> & fn ) override { model.forEachChunk(fn); }
+        virtual bool setFreeListMode ( bool freeLists, bool hugePages ) override { return model.setFreeListMode(freeLists,hugePages); }
+        virtual bool getSizeClassStats ( int32_t si, HeapSizeClassStats & stats ) const override;
         virtual bool isOwnPtr ( char * ptr, uint32_t size ) override;
         virtual bool isValidPtr ( char * ptr, uint32_t size ) override;
         virtual void setInitialSize ( uint32_t size ) override;
@@ -334,6 +348,11 @@ namespace das {
         virtual void report() override;
         virtual bool mark() override;
         virtual bool mark ( char * ptr, uint32_t size ) override;
+        virtual bool canMarkAtomic() const override { return true; }
+        virtual bool markAtomic ( char * ptr, uint32_t size ) override { return model.markAtomic(ptr,size); }
+        virtual bool beginIncrementalMark() override;
+        virtual void endIncrementalMark ( bool cancel ) override;
+        virtual void forEachChunk ( const callable<void(char *,uint64_t)> & fn ) override { model.forEachChunk(fn); }
         virtual void sweep() override;
         virtual bool isOwnPtr ( char * ptr, uint32_t size ) override;
         virtual bool isValidPtr ( char * ptr, uint32_t size ) override;
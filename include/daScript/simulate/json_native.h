@@ -0,0 +1,70 @@
+#pragma once
+
+#include "daScript/simulate/simulate.h"
+
+namespace das {
+
+    class StringBuilderWriter;
+    template <typename TT> struct TArray;
+
+    // mirrors JsonValue (struct with the JsValue variant) from daslib/json.das
+    struct JsonValueNative {
+        enum : int32_t {     // same order as JsValue in daslib/json.das, which static_asserts it
+            tObject
+        ,   tArray
+        ,   tString
+        ,   tNumber
+        ,   tLongInt
+        ,   tBool
+        ,   tNull
+        };
+        int32_t     index;
+        union {
+            Table   _object;        // table<string; JsonValue?>
+            Array   _array;         // array<JsonValue?>
+            char *  _string;
+            double  _number;
+            int64_t _longint;
+            bool    _bool;
+            void *  _null;
+        };
+    };
+
+    // JSON tokenizer over the contiguous text. Whitespace and string bodies are scanned 16 bytes at a time.
+    // Errors are reported at line:row, the same way daslib/json.das did.
+    class DAS_API JsonScanner {
+    public:
+        JsonScanner ( const char * text, uint32_t length ) : begin(text), cur(text), end(text + length) {}
+        void skipWhiteSpace();
+        bool eof() const { return cur>=end; }
+        char peek() const { return cur<end ? *cur : 0; }
+        void advance() { cur ++; }
+        bool expect ( char ch );                        // skips white space, sets error if something else is there
+        bool parseString ( string & str );              // at the opening quote, unescaped into str
+        bool skipString();
+        bool parseNumber ( bool & isInteger, int64_t & ival, double & dval );
+        bool parseName ( const char * & name, uint32_t & length );
+        bool skipValue ( int depth = 0 );
+        void setError ( const string & message );       // appends " at line:row" of the current position
+        void describeAt ( string & text ) const;
+        const char * position() const { return cur; }
+    public:
+        string  error;
+        int32_t maxDepth = 512;
+    protected:
+        const char * begin;
+        const char * cur;
+        const char * end;
+    };
+
+    // parse JSON into the JsonValue tree, all nodes, tables and strings are allocated on the context heap
+    DAS_API void * builtin_json_parse ( const char * text, int32_t jsonValueSize, bool allowDuplicateKeys, char * & error, Context * context, LineInfoArg * at );
+    DAS_API void * builtin_json_parse_bytes ( const TArray<uint8_t> & text, int32_t jsonValueSize, bool allowDuplicateKeys, char * & error, Context * context, LineInfoArg * at );
+    // tokens for the lexer in daslib/json.das, (kind,string,int,number,line,row) per token. stops after the error token
+    DAS_API void builtin_json_tokenize ( const char * text, const TBlock<void,int32_t,const char *,int64_t,double,int32_t,int32_t> & block, Context * context, LineInfoArg * at );
+    DAS_API void builtin_json_tokenize_bytes ( const TArray<uint8_t> & text, const TBlock<void,int32_t,const char *,int64_t,double,int32_t,int32_t> & block, Context * context, LineInfoArg * at );
+    // read JSON straight into the value, pointed by the second argument. returns error, or null
+    DAS_API vec4f builtin_json_read_into ( Context & context, SimNode_CallBase * call, vec4f * args );
+    // write JsonValue tree, same format as daslib/json.das write_json
+    DAS_API void builtin_json_write ( StringBuilderWriter & writer, const void * jsv, int32_t jsonValueSize, bool noTrailingZeros, bool noEmptyArrays, Context * context, LineInfoArg * at );
+}
@@ -51,6 +51,47 @@ namespace das
 #undef EVAL_NODE
     };
 
+    // AT (INDEX), index is proven to be in range at compile time
+    struct SimNode_ArrayAtUnchecked : SimNode_ArrayAt {
+        DAS_PTR_NODE;
+        SimNode_ArrayAtUnchecked ( const LineInfo & at, SimNode * ll, SimNode * rr, uint32_t sz, uint32_t o)
+            : SimNode_ArrayAt(at,ll,rr,sz,o) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override;
+        __forceinline char * compute ( Context & context ) {
+            DAS_PROFILE_NODE
+            Array * pA = (Array *) l->evalPtr(context);
+            auto idx = uint32_t(r->evalInt(context));
+            return pA->data + idx*stride + offset;
+        }
+    };
+
+    template <typename TT>
+    struct SimNode_ArrayAtUncheckedR2V : SimNode_ArrayAtUnchecked {
+        SimNode_ArrayAtUncheckedR2V ( const LineInfo & at, SimNode * rv, SimNode * idx, uint32_t strd, uint32_t o )
+            : SimNode_ArrayAtUnchecked(at,rv,idx,strd,o) {}
+        SimNode * visit ( SimVisitor & vis ) override {
+            V_BEGIN();
+            V_OP_TT(ArrayAtUncheckedR2V);
+            V_SUB(l);
+            V_SUB(r);
+            V_ARG(stride);
+            V_ARG(offset);
+            V_END();
+        }
+        DAS_EVAL_ABI virtual vec4f eval ( Context & context ) override {
+            DAS_PROFILE_NODE
+            TT * pR = (TT *) compute(context);
+            return cast<TT>::from(*pR);
+        }
+#define EVAL_NODE(TYPE,CTYPE)                                       \
+        virtual CTYPE eval##TYPE ( Context & context ) override {   \
+            DAS_PROFILE_NODE \
+            return *(CTYPE *)compute(context);                      \
+        }
+        DAS_EVAL_NODE
+#undef EVAL_NODE
+    };
+
     // AT (INDEX)
     struct SimNode_SafeArrayAt : SimNode_ArrayAt {
         DAS_PTR_NODE;
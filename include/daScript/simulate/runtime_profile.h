@@ -6,5 +6,13 @@ namespace das
 {
     // profile(count,category,block) -> float time in sec
     DAS_API float builtin_profile ( int32_t count, const char * category, const Block & block, Context * context, LineInfoArg * at );
-}
 
+    // sampling profiler of the calling context
+    DAS_API bool builtin_sampling_profiler_start ( int32_t intervalUs, Context * context, LineInfoArg * at );
+    DAS_API void builtin_sampling_profiler_stop ( Context * context );
+    DAS_API void builtin_sampling_profiler_reset ( Context * context );
+    DAS_API int64_t builtin_sampling_profiler_samples ( Context * context );
+    DAS_API int64_t builtin_sampling_profiler_dropped ( Context * context );
+    DAS_API char * builtin_sampling_profiler_collapsed ( Context * context, LineInfoArg * at );
+    DAS_API char * builtin_sampling_profiler_chrome_trace ( Context * context, LineInfoArg * at );
+}
@@ -44,6 +44,67 @@ namespace das
         }
     };
 
+    // control byte group of the table, see Table for the layout
+    // match functions return the bit mask, with TABLE_GROUP_LANE_SHIFT bits per control byte
+    struct TableGroup {
+#if _TARGET_SIMD_SSE
+        enum { laneShift = 0 };
+        __m128i ctrl;
+        __forceinline TableGroup ( const uint8_t * pos ) : ctrl(_mm_loadu_si128((const __m128i *)pos)) {}
+        __forceinline uint64_t match ( uint8_t tag ) const {
+            return uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(char(tag)))));
+        }
+        __forceinline uint64_t matchEmpty ( ) const {
+            return match(TABLE_CTRL_EMPTY);
+        }
+        __forceinline uint64_t matchEmptyOrKilled ( ) const {
+            return uint32_t(_mm_movemask_epi8(ctrl));
+        }
+#elif _TARGET_SIMD_NEON
+        enum { laneShift = 2 };
+        uint8x16_t ctrl;
+        __forceinline TableGroup ( const uint8_t * pos ) : ctrl(vld1q_u8(pos)) {}
+        static __forceinline uint64_t toMask ( uint8x16_t eq ) {
+            // narrowing shift packs each byte into a nibble, we keep the top bit of every nibble
+            uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(eq), 4);
+            return vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & UINT64_C(0x8888888888888888);
+        }
+        __forceinline uint64_t match ( uint8_t tag ) const {
+            return toMask(vceqq_u8(ctrl, vdupq_n_u8(tag)));
+        }
+        __forceinline uint64_t matchEmpty ( ) const {
+            return match(TABLE_CTRL_EMPTY);
+        }
+        __forceinline uint64_t matchEmptyOrKilled ( ) const {
+            return toMask(vcltq_s8(vreinterpretq_s8_u8(ctrl), vdupq_n_s8(0)));
+        }
+#else
+        enum { laneShift = 0 };
+        const uint8_t * ctrl;
+        __forceinline TableGroup ( const uint8_t * pos ) : ctrl(pos) {}
+        __forceinline uint64_t match ( uint8_t tag ) const {
+            uint64_t res = 0;
+            for ( uint32_t i=0; i!=TABLE_CTRL_GROUP; ++i ) {
+                if ( ctrl[i]==tag ) res |= uint64_t(1) << i;
+            }
+            return res;
+        }
+        __forceinline uint64_t matchEmpty ( ) const {
+            return match(TABLE_CTRL_EMPTY);
+        }
+        __forceinline uint64_t matchEmptyOrKilled ( ) const {
+            uint64_t res = 0;
+            for ( uint32_t i=0; i!=TABLE_CTRL_GROUP; ++i ) {
+                if ( ctrl[i] & 0x80 ) res |= uint64_t(1) << i;
+            }
+            return res;
+        }
+#endif
+        static __forceinline uint32_t lane ( uint64_t mask ) {
+            return uint32_t(das_ctz64(mask)) >> laneShift;
+        }
+    };
+
     template <typename KeyType>
     class TableHash {
         Context *   context = nullptr;
@@ -62,77 +123,99 @@ namespace das
             else return hash;
         }
 
+        static __forceinline uint8_t hashKeyToCtrl ( TableHashKey hashKey ) {
+            return uint8_t(hashKey >> (sizeof(TableHashKey)*8 - 7));
+        }
+
+        // tables are kept at most 7/8 full (including tombstones), so that every probe sequence ends in an empty slot
+        static __forceinline uint32_t maxLoad ( uint32_t capacity ) {
+            return capacity - capacity/8;
+        }
+
+        static __forceinline void setCtrl ( Table & tab, uint32_t index, uint8_t c ) {
+            auto pCtrl = tab.ctrl();
+            pCtrl[index] = c;
+            for ( uint32_t mirror = index; mirror < TABLE_CTRL_GROUP; mirror += tab.capacity ) {
+                pCtrl[tab.capacity + mirror] = c;
+            }
+        }
+
         __forceinline int find ( const Table & tab, KeyType key, uint64_t hash ) const {
             DAS_ASSERT(hash>1);
             if ( tab.capacity==0 ) return -1;
             uint32_t mask = tab.capacity - 1;
-            uint32_t index = uint32_t(hash) & mask;
+            auto hashKey = hashToHashKey(TableHashKey(hash));
+            uint32_t index = uint32_t(hashKey) & mask;
             auto pKeys = (const KeyType *) tab.keys;
             auto pHashes = tab.hashes;
-            auto hashKey = hashToHashKey(TableHashKey(hash));
-            while ( true ) {
-                auto kh = pHashes[index];
-                if ( kh==HASH_EMPTY64 ) {
+            auto pCtrl = tab.ctrl();
+            auto tag = hashKeyToCtrl(hashKey);
+            for ( uint32_t step = TABLE_CTRL_GROUP; ; step += TABLE_CTRL_GROUP ) {
+                TableGroup group(pCtrl + index);
+                for ( uint64_t m = group.match(tag); m; m &= m - 1 ) {
+                    uint32_t i = (index + TableGroup::lane(m)) & mask;
+                    if ( pHashes[i]==hashKey && KeyCompare<KeyType>()(pKeys[i],key) ) {
+                        return (int) i;
+                    }
+                }
+                if ( group.matchEmpty() ) {
                     return -1;
-                } else if ( kh==hashKey && KeyCompare<KeyType>()(pKeys[index],key) ) {
-                    return (int) index;
                 }
-                index = (index + 1) & mask;
+                index = (index + step) & mask;
             }
         }
 
         __forceinline int reserve ( Table & tab, KeyType key, uint64_t hash, LineInfo * at = nullptr ) {
             DAS_ASSERT(hash>1);
-            if ( tab.size >= (tab.capacity/2) ) grow(tab, at);
-            else if ( (tab.capacity-tab.size)/2 < tab.tombstones ) rehash(tab, at);
+            if ( tab.size + tab.tombstones >= maxLoad(tab.capacity) ) {
+                // mostly tombstones - rehash in place, so that there is at least quarter of the table free afterwards
+                if ( tab.size >= tab.capacity/8*5 ) grow(tab, at);
+                else rehash(tab, at);
+            }
             uint32_t mask = tab.capacity - 1;
-            uint32_t index = uint32_t(hash) & mask;
+            auto hashKey = hashToHashKey(TableHashKey(hash));
+            uint32_t index = uint32_t(hashKey) & mask;
             uint32_t insertI = -1u;
             auto pKeys = (KeyType *) tab.keys;
             auto pHashes = tab.hashes;
-            auto hashKey = hashToHashKey(TableHashKey(hash));
-            while ( true ) {
-                auto kh = pHashes[index];
-                if (kh == HASH_EMPTY64 ) {
-                    if ( tab.isLocked() ) context->throw_error_at(at, "can't insert into locked table");
-                    if ( insertI != -1u ) {
-                        index = insertI;
-                        tab.tombstones--;
+            auto pCtrl = tab.ctrl();
+            auto tag = hashKeyToCtrl(hashKey);
+            for ( uint32_t step = TABLE_CTRL_GROUP; ; step += TABLE_CTRL_GROUP ) {
+                TableGroup group(pCtrl + index);
+                for ( uint64_t m = group.match(tag); m; m &= m - 1 ) {
+                    uint32_t i = (index + TableGroup::lane(m)) & mask;
+                    if ( pHashes[i]==hashKey && KeyCompare<KeyType>()(pKeys[i],key) ) {
+                        return (int) i;
                     }
-                    pHashes[index] = hashKey;
-                    pKeys[index] = key;
+                }
+                if ( insertI==-1u ) {
+                    if ( auto avail = group.matchEmptyOrKilled() ) {
+                        insertI = (index + TableGroup::lane(avail)) & mask;
+                    }
+                }
+                if ( group.matchEmpty() ) {
+                    if ( tab.isLocked() ) context->throw_error_at(at, "can't insert into locked table");
+                    if ( pCtrl[insertI]==TABLE_CTRL_KILLED ) tab.tombstones--;
+                    setCtrl(tab, insertI, tag);
+                    pHashes[insertI] = hashKey;
+                    pKeys[insertI] = key;
                     tab.size++;
-                    return (int)index;
-                } else if (kh == HASH_KILLED64) {
-                    if ( insertI == -1u ) insertI = index;
-                } else if (kh == hashKey && KeyCompare<KeyType>()(pKeys[index], key)) {
-                    return (int)index;
+                    return (int)insertI;
                 }
-                index = (index + 1) & mask;
+                index = (index + step) & mask;
             }
         }
 
         __forceinline int erase ( Table & tab, KeyType key, uint64_t hash ) {
-            DAS_ASSERT(hash>1);
-            if ( tab.capacity==0 ) return -1;
-            uint32_t mask = tab.capacity - 1;
-            uint32_t index = uint32_t(hash) & mask;
-            auto pKeys = (const KeyType *) tab.keys;
-            auto pHashes = tab.hashes;
-            auto hashKey = hashToHashKey(TableHashKey(hash));
-            while ( true ) {
-                auto kh = pHashes[index];
-                if ( kh==HASH_EMPTY64 ) {
-                    return -1;
-                } else if ( kh==hashKey && KeyCompare<KeyType>()(pKeys[index],key) ) {
-                    tab.size--;
-                    tab.tombstones++;
-                    pHashes[index] = HASH_KILLED64;
-                    memset(tab.data + index*valueTypeSize, 0, valueTypeSize);
-                    return (int) index;
-                }
-                index = (index + 1) & mask;
+            int index = find(tab, key, hash);
+            if ( index!=-1 ) {
+                tab.size--;
+                tab.tombstones++;
+                tab.hashes[index] = HASH_KILLED64;
+                setCtrl(tab, uint32_t(index), TABLE_CTRL_KILLED);
+                memset(tab.data + index*valueTypeSize, 0, valueTypeSize);
             }
+            return index;
         }
 
         bool grow ( Table & tab, LineInfo * at ) {
@@ -145,11 +228,11 @@ namespace das
         }
 
         bool reserve(Table & tab, uint32_t size, LineInfo * at ) {
-            if (size <= tab.capacity)
+            if (size < maxLoad(tab.capacity))
               return true;
 
             uint32_t newCapacity = das::max(uint32_t(minCapacity), tab.capacity*2);
-            while (newCapacity < size)
+            while (size >= maxLoad(newCapacity))
             {
               newCapacity *= 2;
             }
@@ -158,25 +241,24 @@ namespace das
         }
 
     private:
-        __forceinline int insertNew ( Table & tab, uint64_t hash ) const {
+        __forceinline uint32_t insertNew ( Table & tab, uint64_t hash ) const {
             // TODO: take key under account and be less aggressive?
             DAS_ASSERT(hash>1);
             uint32_t mask = tab.capacity - 1;
             uint32_t index = uint32_t(hash) & mask;
-            auto pHashes = tab.hashes;
-            while ( true ) {
-                auto kh = pHashes[index];
-                if ( kh==HASH_EMPTY64 ) {
-                    return (int) index;
+            auto pCtrl = tab.ctrl();
+            for ( uint32_t step = TABLE_CTRL_GROUP; ; step += TABLE_CTRL_GROUP ) {
+                if ( auto empty = TableGroup(pCtrl + index).matchEmpty() ) {
+                    return (index + TableGroup::lane(empty)) & mask;
                 }
-                index = (index + 1) & mask;
+                index = (index + step) & mask;
             }
         }
 
         bool reserveInternal(Table & tab, uint32_t newCapacity, LineInfo * at) {
             DAS_VERIFYF((newCapacity & (newCapacity) - 1) == 0, "newCapacity must be power of 2, and not %i", int(newCapacity));
             Table newTab;
-            uint64_t memSize64 = uint64_t(newCapacity) * (uint64_t(valueTypeSize) + uint64_t(sizeof(KeyType)) + uint64_t(sizeof(TableHashKey)));
+            uint64_t memSize64 = table_mem_size(newCapacity, uint64_t(valueTypeSize) + uint64_t(sizeof(KeyType)));
             if ( memSize64>=0xffffffff ) {
                 context->throw_error_ex("can't grow table, out of index space [capacity=%i]", newCapacity);
                 return false;
@@ -195,6 +277,7 @@ namespace das
             if ( valueTypeSize ) memset(newTab.data, 0, size_t(newCapacity)*size_t(valueTypeSize));
             auto pHashes = newTab.hashes;
             memset(pHashes, 0, newCapacity * sizeof(TableHashKey));
+            memset(newTab.ctrl(), TABLE_CTRL_EMPTY, newCapacity + TABLE_CTRL_GROUP);
             if ( tab.size ) {
                 auto pKeys = (KeyType *) newTab.keys;
                 auto pOldValues = tab.data;
@@ -204,7 +287,8 @@ namespace das
                 for ( uint32_t i=0, is=tab.capacity; i!=is; ++i ) {
                     auto hash = pOldHashes[i];
                     if ( hash>HASH_KILLED64 ) {
-                        int index = insertNew(newTab, hash);
+                        uint32_t index = insertNew(newTab, hash);
+                        setCtrl(newTab, index, hashKeyToCtrl(hash));
                         pHashes[index] = hash;
                         pKeys[index] = pOldKeys[i];
                         memcpy ( pValues + index*valueTypeSize, pOldValues + i*valueTypeSize, valueTypeSize );
@@ -212,7 +296,7 @@ namespace das
                 }
             }
             if (tab.capacity && !context->verySafeContext) {
-                uint32_t oldSize = tab.capacity*(valueTypeSize + sizeof(KeyType) + sizeof(TableHashKey));
+                uint32_t oldSize = uint32_t(table_mem_size(tab.capacity, valueTypeSize + sizeof(KeyType)));
                 context->free(tab.data, oldSize, at);
             }
             swap ( newTab, tab );
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "daScript/simulate/simulate.h"
+
+#include <atomic>
+#include <thread>
+
+namespace das
+{
+    // Sampling profiler. Timer thread periodically walks the Prologue chain of the context stack, while the context keeps running.
+    // The walk races with the running code, so every frame is validated (stack bounds, stack size, FuncInfo is one of the context functions),
+    // and samples which fail validation are dropped. Interpreted functions are reported by name.
+    // AOT functions show up only with a stack prologue (options aot_prologue), and JIT functions only when they push one (ones with blocks).
+    // Names of AOT and JIT frames are read out of process memory safely on Linux, elsewhere they are reported as [aot] and [jit].
+    class DAS_API SamplingProfiler {
+    public:
+        SamplingProfiler ( Context * ctx );
+        SamplingProfiler ( const SamplingProfiler & ) = delete;
+        SamplingProfiler & operator = ( const SamplingProfiler & ) = delete;
+        ~SamplingProfiler();
+        bool start ( int32_t intervalUs );
+        void stop();
+        void reset();
+        bool isRunning() const { return running; }
+        uint64_t totalSamples() const;
+        uint64_t droppedSamples() const;
+        void sampleNow();                               // one sample, from any thread
+        void writeCollapsed ( TextWriter & tw );        // flamegraph.pl / speedscope collapsed stacks, root first
+        void writeChromeTrace ( TextWriter & tw );      // chrome://tracing, perfetto
+    protected:
+        struct Frame {
+            FuncInfo *      info;
+            const char *    fileName;
+            LineInfo *      line;
+            bool            jit;
+        };
+        struct Sample {
+            uint64_t        timeUs;
+            uint32_t        first;      // in sampleFrames, innermost first
+            uint32_t        count;
+        };
+        void run();
+        bool walkStack ( vector<uint32_t> & frameIds );
+        uint32_t internFrame ( FuncInfo * info, const char * fileName, LineInfo * line, bool jit );
+        bool isJitFileName ( const char * fileName );
+        string frameName ( uint32_t frameId ) const;
+    protected:
+        Context *                       context = nullptr;
+        int32_t                         intervalUs = 1000;
+        int64_t                         startTicks = 0;
+        atomic<bool>                    running{false};
+        thread                          sampler;
+        mutex                           lock;
+        das_hash_set<FuncInfo *>        knownFunctions;
+        das_hash_map<uint64_t,uint32_t> frameIndex;
+        vector<Frame>                   frames;
+        vector<uint32_t>                sampleFrames;
+        vector<Sample>                  samples;
+        das_hash_map<const char *,bool> jitFileNames;   // prologue file name -> it's the JIT one
+        atomic<uint64_t>                sampleCount{0}; // read without the lock
+        atomic<uint64_t>                dropped{0};
+    };
+}
@@ -158,6 +158,9 @@ namespace das
         };
     };
 
+    // Prologue::fileName of the frames pushed by jit_prologue, there functionLine is the LineInfo of the function
+    DAS_API extern const char * const JIT_PROLOGUE_FILE_NAME;
+
     struct BlockArguments {
         vec4f *     arguments;
         char *      copyOrMoveResult;
@@ -305,9 +308,25 @@ namespace das
 
     typedef shared_ptr<Context> ContextPtr;
 
+    // timing of the last collectHeap or collectHeapStep, in microseconds per phase
+    struct GcPauseReport {
+        int32_t     workers;            // threads which took part in the parallel mark, 0 means it ran on the calling thread
+        int32_t     roots;              // roots, globals, arguments and live locals which were scanned
+        int32_t     prepareUs;          // clearing mark bits
+        int32_t     scanUs;             // collecting roots from gc roots, globals and stack
+        int32_t     markUs;
+        int32_t     sweepUs;
+        int32_t     totalUs;
+        int32_t     steps;              // collect_heap_step calls it took, reported when the incremental cycle completes
+        int32_t     rescanned;          // objects walked again at the end of the incremental cycle
+    };
+
     // todo: Move this structs to separate file
     struct CodeOfPolicies;
     struct AnnotationArgumentList;
+    class JobContextPool;
+    class GcIncremental;
+    class SamplingProfiler;
 
     class DAS_API Context : public ptr_ref_count, public enable_shared_from_this<Context> {
         template <typename TT> friend struct SimNode_GetGlobalR2V;
@@ -444,6 +463,7 @@ namespace das
 
         __forceinline void restartHeaps() {
             DAS_ASSERTF(insideContext==0,"can't reset heaps in locked context");
+            if ( gcIncremental ) cancelCollectHeapStep();
             heap->reset();
             stringHeap->reset();
             stringDisposeQue = nullptr;
@@ -516,11 +536,15 @@ namespace das
 
         SimFunction * findFunction ( const char * name ) const;
         SimFunction * findFunction ( const char * name, bool & isUnique ) const;
+        shared_ptr<das_hash_map<uint64_t,int32_t>> getNameLookup () const;     // built on the first use, safe to call from any thread
         vector<SimFunction *> findFunctions ( const char * name ) const;
         int findVariable ( const char * name ) const;
         void stackWalk ( const LineInfo * at, bool showArguments, bool showLocalVariables );
         string getStackWalk ( const LineInfo * at, bool showArguments, bool showLocalVariables, bool showOutOfScope = false, bool stackTopOnly = false );
-        void runInitScript ();
+        void runInitScript ( bool globalInitializers = true, bool runInitFunctions = true );
+        void runInitScriptAndReport ( bool globalInitializers = true, bool runInitFunctions = true );    // runs init script on own or temporary stack, sets failed
+        bool saveInitSnapshot ( vector<uint8_t> & image, string & error );                   // globals, as the global initializers left them
+        bool restoreInitSnapshot ( const uint8_t * image, size_t size, string & error );     // instead of running the global initializers
         bool runShutdownScript ();
 
         virtual void to_out ( const LineInfo * at, int level, const char * message );   // output to stdout or equivalent
@@ -734,6 +758,10 @@ namespace das
         void relocateCode( bool pwh = false );
         void announceCreation();
         void collectHeap(LineInfo * at, bool stringHeap, bool validate);
+        bool collectHeapStep(LineInfo * at, int32_t budgetUs, bool stringHeap);    // true when the cycle is complete
+        void cancelCollectHeapStep();
+        __forceinline bool isCollectingHeap() const { return gcIncremental!=nullptr; }
+        void collectHeapRoots(LineInfo * at, bool globalRoots, bool stackRoots, const callable<void(char *,TypeInfo *)> & fn);
         void reportAnyHeap(LineInfo * at, bool sth, bool rgh, bool rghOnly, bool errorsOnly);
         void instrumentFunction ( SimFunction * , bool isInstrumenting, uint64_t userData, bool threadLocal );
         void instrumentContextNode ( const Block & blk, bool isInstrumenting, Context * context, LineInfo * line );
@@ -814,6 +842,10 @@ namespace das
         bool                            showArgumentsOnException = false;
         bool                            instrumentAllocations = false;
         bool                            gcEnabled = false;
+        bool                            gcPageWatch = false;        // incremental gc write-protects heap pages to find what changed
+        int32_t                         gcMarkWorkers = 0;          // >1 splits gc mark phase into chunks for the job que workers
+        GcPauseReport                   gcReport {};
+        GcIncremental *                 gcIncremental = nullptr;    // incremental collection in progress
         bool                            failed = false;
         bool                            verySafeContext = false;    // when true, array and table reserves don't free memory
     public:
@@ -854,6 +886,10 @@ namespace das
         shared_ptr<das_hash_map<uint64_t,SimFunction *>> tabMnLookup;
         shared_ptr<das_hash_map<uint64_t,uint32_t>> tabGMnLookup;
         shared_ptr<das_hash_map<uint64_t,uint64_t>> tabAdLookup;
+        // function name hash -> index in functions, or one of the NAME_LOOKUP_ codes when it takes a scan
+        // only accessed with std::atomic_load and std::atomic_store, see getNameLookup
+        mutable shared_ptr<das_hash_map<uint64_t,int32_t>> tabNameLookup;
+        enum { NAME_LOOKUP_NOT_UNIQUE = -1, NAME_LOOKUP_COLLISION = -2 };
     public:
         class Program * thisProgram = nullptr;
         class DebugInfoHelper * thisHelper = nullptr;
@@ -863,6 +899,8 @@ namespace das
         uint32_t gotoLabel = 0;
     public:
         recursive_mutex * contextMutex = nullptr;
+        shared_ptr<JobContextPool> jobContextPool;  // idle job clones of this context, see new_job_invoke
+        shared_ptr<SamplingProfiler> samplingProfiler;
     protected:
         das_hash_map<void *, TypeInfo *> gcRoots;
     public:
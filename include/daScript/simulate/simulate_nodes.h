@@ -1434,6 +1434,31 @@ SIM_NODE_AT_VECTOR(Float, float)
     struct SimNode_InvokeFnByNameAny : SimNode_CallBase {
         SimNode_InvokeFnByNameAny(const LineInfo& at, const char * msg) : SimNode_CallBase(at,msg) {}
         virtual SimNode* visit(SimVisitor& vis) override;
+        // monomorphic inline cache. only functions, which passed all the checks, get cached
+        // clones share the code and the function table, so one pointer is enough to tell if the entry belongs to the context
+        __forceinline SimFunction * lookup ( Context & context, const char * funcName ) {
+            if (!funcName) context.throw_error_at(debugInfo,"invoke null function. name is empty%s", errorMessage);
+            auto simFunc = cachedFunc.load(memory_order_relaxed);
+            auto functions = context.getFunction(0);
+            if ( simFunc && simFunc>=functions && simFunc<functions+context.getTotalFunctions()
+                    && (simFunc->name==funcName || strcmp(simFunc->name,funcName)==0) ) {
+                return simFunc;
+            }
+            return lookupSlow(context, funcName);
+        }
+        SimFunction * lookupSlow ( Context & context, const char * funcName ) {
+            bool unique = false;
+            SimFunction * simFunc = context.findFunction(funcName, unique);
+            if (!simFunc) context.throw_error_at(debugInfo,"invoke null function. function %s not found%s", funcName, errorMessage);
+            if (!unique) context.throw_error_at(debugInfo,"invoke non-unique function %s%s", funcName, errorMessage);
+            if ( simFunc->cmres ) context.throw_error_at(debugInfo,"can't dynamically invoke function %s, which returns by reference%s", funcName, errorMessage);
+            if ( simFunc->unsafe ) context.throw_error_at(debugInfo,"can't dynamically invoke unsafe function%s%s", funcName, errorMessage);
+            cachedFunc.store(simFunc, memory_order_relaxed);
+            return simFunc;
+        }
+        // the node is shared by the clones, which run on other threads. the entry is checked before it's used,
+        // so a stale one only costs the slow lookup
+        atomic<SimFunction *> cachedFunc { nullptr };
     };
 
     template <int argCount>
@@ -1443,14 +1468,7 @@ SIM_NODE_AT_VECTOR(Float, float)
             DAS_PROFILE_NODE
             vec4f argValues[argCount ? argCount : 1];
             EvalBlock<argCount>::eval(context, arguments, argValues);
-            bool unique = false;
-            auto funcName = cast<char *>::to(argValues[0]);
-            if (!funcName) context.throw_error_at(debugInfo,"invoke null function. name is empty%s", errorMessage);
-            SimFunction * simFunc = context.findFunction(funcName, unique);
-            if (!simFunc) context.throw_error_at(debugInfo,"invoke null function. function %s not found%s", funcName, errorMessage);
-            if (!unique) context.throw_error_at(debugInfo,"invoke non-unique function %s%s", funcName, errorMessage);
-            if ( simFunc->cmres ) context.throw_error_at(debugInfo,"can't dynamically invoke function %s, which returns by reference%s", funcName, errorMessage);
-            if ( simFunc->unsafe ) context.throw_error_at(debugInfo,"can't dynamically invoke unsafe function%s%s", funcName, errorMessage);
+            SimFunction * simFunc = lookup(context, cast<char *>::to(argValues[0]));
             if ( argCount>1 ) {
                 return context.call(simFunc, argValues + 1, &debugInfo);
             } else {
@@ -1462,14 +1480,7 @@ SIM_NODE_AT_VECTOR(Float, float)
             DAS_PROFILE_NODE                                                                    \
             vec4f argValues[argCount ? argCount : 1];                                           \
             EvalBlock<argCount>::eval(context, arguments, argValues);                           \
-            bool unique = false; \
-            auto funcName = cast<char *>::to(argValues[0]);                                     \
-            if (!funcName) context.throw_error_at(debugInfo,"invoke null function. name is empty%s", errorMessage); \
-            SimFunction * simFunc = context.findFunction(funcName, unique);                     \
-            if (!simFunc) context.throw_error_at(debugInfo,"invoke null function. function %s not found%s", funcName, errorMessage); \
-            if (!unique) context.throw_error_at(debugInfo,"invoke non-unique function %s%s", funcName, errorMessage); \
-            if ( simFunc->cmres ) context.throw_error_at(debugInfo,"can't dynamically invoke function %s, which returns by reference%s", funcName, errorMessage); \
-            if ( simFunc->unsafe ) context.throw_error_at(debugInfo,"can't dynamically invoke unsafe function%s%s", funcName, errorMessage); \
+            SimFunction * simFunc = lookup(context, cast<char *>::to(argValues[0]));            \
             if ( argCount>1 ) {                                                                 \
                 return cast<CTYPE>::to(context.call(simFunc, argValues + 1, &debugInfo));       \
             } else {                                                                            \
@@ -1487,14 +1498,7 @@ SIM_NODE_AT_VECTOR(Float, float)
             DAS_PROFILE_NODE
             vec4f argValues[DAS_MAX_FUNCTION_ARGUMENTS];
             evalArgs(context, argValues);
-            bool unique = false;
-            auto funcName = cast<char *>::to(argValues[0]);
-            if (!funcName) context.throw_error_at(debugInfo,"invoke null function. name is empty%s", errorMessage);
-            SimFunction * simFunc = context.findFunction(funcName, unique);
-            if (!simFunc) context.throw_error_at(debugInfo,"invoke null function. function %s not found%s", funcName, errorMessage);
-            if (!unique) context.throw_error_at(debugInfo,"invoke non-unique function %s%s", funcName, errorMessage);
-            if ( simFunc->cmres ) context.throw_error_at(debugInfo,"can't dynamically invoke function %s, which returns by reference%s", funcName, errorMessage);
-            if ( simFunc->unsafe ) context.throw_error_at(debugInfo,"can't dynamically invoke unsafe function%s%s", funcName, errorMessage);
+            SimFunction * simFunc = lookup(context, cast<char *>::to(argValues[0]));
             return context.call(simFunc, argValues + 1, &debugInfo);
         }
 #define EVAL_NODE(TYPE,CTYPE) \
@@ -1502,14 +1506,7 @@ SIM_NODE_AT_VECTOR(Float, float)
             DAS_PROFILE_NODE \
             vec4f argValues[DAS_MAX_FUNCTION_ARGUMENTS]; \
             evalArgs(context, argValues); \
-            bool unique = false; \
-            auto funcName = cast<char *>::to(argValues[0]); \
-            if (!funcName) context.throw_error_at(debugInfo,"invoke null function. name is empty%s", errorMessage); \
-            SimFunction * simFunc = context.findFunction(funcName, unique); \
-            if (!simFunc) context.throw_error_at(debugInfo,"invoke null function. function %s not found%s", funcName, errorMessage); \
-            if (!unique) context.throw_error_at(debugInfo,"invoke non-unique function %s%s", funcName, errorMessage); \
-            if ( simFunc->cmres ) context.throw_error_at(debugInfo,"can't dynamically invoke function %s, which returns by reference%s", funcName, errorMessage); \
-            if ( simFunc->unsafe ) context.throw_error_at(debugInfo,"can't dynamically invoke unsafe function%s%s", funcName, errorMessage); \
+            SimFunction * simFunc = lookup(context, cast<char *>::to(argValues[0])); \
             return cast<CTYPE>::to(context.call(simFunc, argValues + 1, &debugInfo)); \
         }
         DAS_EVAL_NODE
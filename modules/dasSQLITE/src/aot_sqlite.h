@@ -10,4 +10,7 @@ namespace das {
             Context * context, LineInfoArg * at );
     int sqlite3_bind_blob_ ( sqlite3_stmt * stmt, int index, void * data, int size );
     int sqlite3_bind_text_ ( sqlite3_stmt * stmt, int index, const char * data );
+    vec4f sqlite3_fetch_rows_native ( Context & context, SimNode_CallBase * call, vec4f * args );
+    vec4f sqlite3_fetch_columns_native ( Context & context, SimNode_CallBase * call, vec4f * args );
+    vec4f sqlite3_insert_rows_native ( Context & context, SimNode_CallBase * call, vec4f * args );
 }
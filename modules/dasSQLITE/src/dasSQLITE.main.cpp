@@ -69,6 +69,236 @@ int sqlite3_bind_text_ ( sqlite3_stmt * stmt, int index, const char * data ) {
     return sqlite3_bind_text(stmt, index, data, -1, SQLITE_TRANSIENT);
 }
 
+// batch row io. fields of the script struct are matched to the columns (or parameters) by name
+
+static bool sqlite_scalar_type ( TypeInfo * ti ) {
+    if ( ti->dimSize || ti->flags & TypeInfo::flag_ref ) return false;
+    switch ( ti->type ) {
+        case Type::tBool:
+        case Type::tInt8:   case Type::tUInt8:
+        case Type::tInt16:  case Type::tUInt16:
+        case Type::tInt:    case Type::tUInt:
+        case Type::tInt64:  case Type::tUInt64:
+        case Type::tFloat:  case Type::tDouble:
+        case Type::tString:
+            return true;
+        case Type::tArray:  // blob
+            return ti->firstType && ti->firstType->type==Type::tUInt8 && !ti->firstType->dimSize;
+        default:
+            return false;
+    }
+}
+
+static void sqlite_read_value ( sqlite3_stmt * stmt, int col, char * dst, TypeInfo * ti, Context * context, LineInfo * at ) {
+    switch ( ti->type ) {
+        case Type::tBool:   *(bool *)dst = sqlite3_column_int(stmt, col)!=0; break;
+        case Type::tInt8:   *(int8_t *)dst = int8_t(sqlite3_column_int(stmt, col)); break;
+        case Type::tUInt8:  *(uint8_t *)dst = uint8_t(sqlite3_column_int(stmt, col)); break;
+        case Type::tInt16:  *(int16_t *)dst = int16_t(sqlite3_column_int(stmt, col)); break;
+        case Type::tUInt16: *(uint16_t *)dst = uint16_t(sqlite3_column_int(stmt, col)); break;
+        case Type::tInt:    *(int32_t *)dst = sqlite3_column_int(stmt, col); break;
+        case Type::tUInt:   *(uint32_t *)dst = uint32_t(sqlite3_column_int64(stmt, col)); break;
+        case Type::tInt64:  *(int64_t *)dst = sqlite3_column_int64(stmt, col); break;
+        case Type::tUInt64: *(uint64_t *)dst = uint64_t(sqlite3_column_int64(stmt, col)); break;
+        case Type::tFloat:  *(float *)dst = float(sqlite3_column_double(stmt, col)); break;
+        case Type::tDouble: *(double *)dst = sqlite3_column_double(stmt, col); break;
+        case Type::tString: {
+            auto text = (const char *) sqlite3_column_text(stmt, col);
+            int bytes = sqlite3_column_bytes(stmt, col);
+            *(char **)dst = (text && bytes) ? context->allocateString(text, uint32_t(bytes), at) : nullptr;
+            break;
+        }
+        case Type::tArray: {
+            auto blob = (const char *) sqlite3_column_blob(stmt, col);
+            int bytes = sqlite3_column_bytes(stmt, col);
+            auto & arr = *(Array *)dst;
+            array_resize(*context, arr, uint32_t(blob ? bytes : 0), 1, false, at);
+            if ( blob && bytes ) memcpy(arr.data, blob, size_t(bytes));
+            break;
+        }
+        default:
+            DAS_ASSERTF(0, "unsupported column type");
+    }
+}
+
+static int sqlite_bind_value ( sqlite3_stmt * stmt, int index, const char * src, TypeInfo * ti ) {
+    switch ( ti->type ) {
+        case Type::tBool:   return sqlite3_bind_int(stmt, index, *(const bool *)src ? 1 : 0);
+        case Type::tInt8:   return sqlite3_bind_int(stmt, index, *(const int8_t *)src);
+        case Type::tUInt8:  return sqlite3_bind_int(stmt, index, *(const uint8_t *)src);
+        case Type::tInt16:  return sqlite3_bind_int(stmt, index, *(const int16_t *)src);
+        case Type::tUInt16: return sqlite3_bind_int(stmt, index, *(const uint16_t *)src);
+        case Type::tInt:    return sqlite3_bind_int(stmt, index, *(const int32_t *)src);
+        case Type::tUInt:   return sqlite3_bind_int64(stmt, index, *(const uint32_t *)src);
+        case Type::tInt64:  return sqlite3_bind_int64(stmt, index, *(const int64_t *)src);
+        case Type::tUInt64: return sqlite3_bind_int64(stmt, index, int64_t(*(const uint64_t *)src));
+        case Type::tFloat:  return sqlite3_bind_double(stmt, index, *(const float *)src);
+        case Type::tDouble: return sqlite3_bind_double(stmt, index, *(const double *)src);
+        case Type::tString: {
+            auto text = *(const char **)src;
+            // the row outlives the step, so sqlite does not need a copy
+            return text ? sqlite3_bind_text(stmt, index, text, -1, SQLITE_STATIC) : sqlite3_bind_null(stmt, index);
+        }
+        case Type::tArray: {
+            auto & arr = *(const Array *)src;
+            return sqlite3_bind_blob(stmt, index, arr.data, int(arr.size), SQLITE_STATIC);
+        }
+        default:
+            DAS_ASSERTF(0, "unsupported parameter type");
+            return SQLITE_MISUSE;
+    }
+}
+
+// identifiers go in double quotes, quotes inside of them are doubled
+static void sqlite_append_identifier ( string & sql, const char * name ) {
+    sql += '"';
+    for ( auto ch = name; *ch; ++ch ) {
+        if ( *ch=='"' ) sql += '"';
+        sql += *ch;
+    }
+    sql += '"';
+}
+
+static TypeInfo * sqlite_array_of_structs ( SimNode_CallBase * call, int arg, Context & context ) {
+    auto ti = call->types[arg];
+    if ( !ti || ti->type!=Type::tPointer || !ti->firstType || ti->firstType->type!=Type::tArray
+            || !ti->firstType->firstType || ti->firstType->firstType->type!=Type::tStructure
+            || ti->firstType->firstType->dimSize ) {
+        context.throw_error_at(call->debugInfo, "expecting pointer to array of structures");
+    }
+    return ti->firstType->firstType;
+}
+
+// struct initializer, if its in the context. otherwise rows start zeroed
+static SimFunction * sqlite_struct_init ( StructInfo * si, Context & context ) {
+    if ( !si->init_mnh ) return nullptr;
+    auto fn = context.fnByMangledName(si->init_mnh);
+    return ( fn && fn->debugInfo && fn->debugInfo->count==0 ) ? fn : nullptr;
+}
+
+vec4f sqlite3_fetch_rows_native ( Context & context, SimNode_CallBase * call, vec4f * args ) {
+    auto stmt = cast<sqlite3_stmt *>::to(args[0]);
+    auto & rows = *cast<Array *>::to(args[1]);
+    auto eti = sqlite_array_of_structs(call, 1, context);
+    auto si = eti->structType;
+    if ( !stmt ) context.throw_error_at(call->debugInfo, "null statement");
+    vector<pair<int,VarInfo *>> binding;
+    int columns = sqlite3_column_count(stmt);
+    for ( int col=0; col!=columns; ++col ) {
+        auto name = sqlite3_column_name(stmt, col);
+        for ( uint32_t i=0; i!=si->count; ++i ) {
+            auto vi = si->fields[i];
+            if ( vi->name && name && strcmp(vi->name, name)==0 ) {
+                if ( !sqlite_scalar_type(vi) ) {
+                    context.throw_error_at(call->debugInfo, "field %s.%s can't hold a column", si->name, vi->name);
+                }
+                binding.emplace_back(col, vi);
+                break;
+            }
+        }
+    }
+    auto init = sqlite_struct_init(si, context);
+    uint32_t stride = eti->size;
+    int rc;
+    while ( (rc = sqlite3_step(stmt))==SQLITE_ROW ) {
+        uint32_t index = rows.size;
+        array_resize(context, rows, index + 1, stride, true, &call->debugInfo);
+        char * row = rows.data + size_t(index) * stride;
+        if ( init ) context.callWithCopyOnReturn(init, nullptr, row, &call->debugInfo);
+        for ( auto & b : binding ) {
+            if ( sqlite3_column_type(stmt, b.first)==SQLITE_NULL && b.second->type!=Type::tString ) continue;
+            sqlite_read_value(stmt, b.first, row + b.second->offset, b.second, &context, &call->debugInfo);
+        }
+    }
+    return cast<int32_t>::from(rc);
+}
+
+vec4f sqlite3_fetch_columns_native ( Context & context, SimNode_CallBase * call, vec4f * args ) {
+    auto stmt = cast<sqlite3_stmt *>::to(args[0]);
+    auto cols = cast<char *>::to(args[1]);
+    auto ti = call->types[1];
+    if ( !ti || ti->type!=Type::tPointer || !ti->firstType || ti->firstType->type!=Type::tStructure ) {
+        context.throw_error_at(call->debugInfo, "expecting pointer to structure of arrays");
+    }
+    if ( !stmt ) context.throw_error_at(call->debugInfo, "null statement");
+    auto si = ti->firstType->structType;
+    vector<pair<int,VarInfo *>> binding;
+    int columns = sqlite3_column_count(stmt);
+    for ( int col=0; col!=columns; ++col ) {
+        auto name = sqlite3_column_name(stmt, col);
+        for ( uint32_t i=0; i!=si->count; ++i ) {
+            auto vi = si->fields[i];
+            if ( vi->name && name && strcmp(vi->name, name)==0 ) {
+                if ( vi->type!=Type::tArray || vi->dimSize || !vi->firstType || !sqlite_scalar_type(vi->firstType) ) {
+                    context.throw_error_at(call->debugInfo, "field %s.%s is not an array, which can hold a column", si->name, vi->name);
+                }
+                binding.emplace_back(col, vi);
+                break;
+            }
+        }
+    }
+    int rc;
+    while ( (rc = sqlite3_step(stmt))==SQLITE_ROW ) {
+        for ( auto & b : binding ) {
+            auto & arr = *(Array *)(cols + b.second->offset);
+            auto eti = b.second->firstType;
+            uint32_t index = arr.size;
+            array_resize(context, arr, index + 1, eti->size, true, &call->debugInfo);
+            if ( sqlite3_column_type(stmt, b.first)==SQLITE_NULL ) continue;
+            sqlite_read_value(stmt, b.first, arr.data + size_t(index) * eti->size, eti, &context, &call->debugInfo);
+        }
+    }
+    return cast<int32_t>::from(rc);
+}
+
+vec4f sqlite3_insert_rows_native ( Context & context, SimNode_CallBase * call, vec4f * args ) {
+    auto db = cast<sqlite3 *>::to(args[0]);
+    auto table = cast<const char *>::to(args[1]);
+    auto & rows = *cast<Array *>::to(args[2]);
+    auto eti = sqlite_array_of_structs(call, 2, context);
+    auto si = eti->structType;
+    if ( !db ) context.throw_error_at(call->debugInfo, "null database");
+    if ( !table ) context.throw_error_at(call->debugInfo, "expecting table name");
+    vector<VarInfo *> fields;
+    string sql = "INSERT INTO ";
+    sqlite_append_identifier(sql, table);
+    sql += " (";
+    for ( uint32_t i=0; i!=si->count; ++i ) {
+        auto vi = si->fields[i];
+        if ( !vi->name || !sqlite_scalar_type(vi) ) continue;
+        if ( !fields.empty() ) sql += ",";
+        sqlite_append_identifier(sql, vi->name);
+        fields.push_back(vi);
+    }
+    if ( fields.empty() ) context.throw_error_at(call->debugInfo, "%s has no fields, which can be stored in a column", si->name);
+    sql += ") VALUES (";
+    for ( size_t i=0; i!=fields.size(); ++i ) sql += i ? ",?" : "?";
+    sql += ")";
+    // one transaction for all rows, unless the caller is already in one
+    bool ownTransaction = sqlite3_get_autocommit(db)!=0;
+    if ( ownTransaction ) {
+        int rc = sqlite3_exec(db, "BEGIN", nullptr, nullptr, nullptr);
+        if ( rc!=SQLITE_OK ) return cast<int32_t>::from(rc);
+    }
+    sqlite3_stmt * stmt = nullptr;
+    int rc = sqlite3_prepare_v2(db, sql.c_str(), -1, &stmt, nullptr);
+    uint32_t stride = eti->size;
+    for ( uint32_t r=0; rc==SQLITE_OK && r!=rows.size; ++r ) {
+        const char * row = rows.data + size_t(r) * stride;
+        for ( size_t f=0; rc==SQLITE_OK && f!=fields.size(); ++f ) {
+            rc = sqlite_bind_value(stmt, int(f + 1), row + fields[f]->offset, fields[f]);
+        }
+        if ( rc!=SQLITE_OK ) break;
+        rc = sqlite3_step(stmt);
+        if ( rc==SQLITE_DONE ) rc = sqlite3_reset(stmt);
+    }
+    sqlite3_finalize(stmt);
+    if ( ownTransaction ) {
+        sqlite3_exec(db, rc==SQLITE_OK ? "COMMIT" : "ROLLBACK", nullptr, nullptr, nullptr);
+    }
+    return cast<int32_t>::from(rc);
+}
+
 void Module_dasSQLITE::initMain() {
 
     addExtern<DAS_BIND_FUN(sqlite3_exec)>(*this,lib,"sqlite3_exec",
@@ -84,6 +314,16 @@ void Module_dasSQLITE::initMain() {
         SideEffects::worstDefault, "sqlite3_bind_text_")
             ->args({"stmt","index","data"});
 
+    addInterop<sqlite3_fetch_rows_native,int32_t,sqlite3_stmt *,vec4f>(*this,lib,"sqlite3_fetch_rows_native",
+        SideEffects::worstDefault, "sqlite3_fetch_rows_native")
+            ->args({"stmt","rows"})->unsafeOperation = true;
+    addInterop<sqlite3_fetch_columns_native,int32_t,sqlite3_stmt *,vec4f>(*this,lib,"sqlite3_fetch_columns_native",
+        SideEffects::worstDefault, "sqlite3_fetch_columns_native")
+            ->args({"stmt","columns"})->unsafeOperation = true;
+    addInterop<sqlite3_insert_rows_native,int32_t,sqlite3 *,const char *,vec4f>(*this,lib,"sqlite3_insert_rows_native",
+        SideEffects::worstDefault, "sqlite3_insert_rows_native")
+            ->args({"db","table","rows"})->unsafeOperation = true;
+
     for ( auto & pfn : this->functions.each() ) {
         // ok, lets fix up everything returning uint8? into returning string# and make it unsafe operation
         if ( pfn->result->isPointer() && pfn->result->firstType &&
@@ -3312,6 +3312,7 @@ namespace das {
         bool logPass = options.getBoolOption("log_optimization_passes",false);
         bool log = logOpt || logPass;
         bool any, last;
+        int32_t hoisted = 0, eliminated = 0, unchecked = 0;
         if (log) {
             logs << *this << "\n";
         }
@@ -3320,6 +3321,8 @@ namespace das {
             any = false;
             last = optimizationRefFolding();    if ( failed() ) break;  any |= last;
             if ( log ) logs << "REF FOLDING: " << (last ? "optimized" : "nothing") << "\n"; if ( logPass ) logs << *this;
+            last = optimizationInline();        if ( failed() ) break;  any |= last;
+            if ( log ) logs << "INLINE: " << (last ? "optimized" : "nothing") << "\n"; if ( logPass ) logs << *this;
             last = optimizationUnused(logs);    if ( failed() ) break;  any |= last;
             if ( log ) logs << "REMOVE UNUSED:" << (last ? "optimized" : "nothing") << "\n"; if ( logPass ) logs << *this;
             last = optimizationConstFolding();  if ( failed() ) break;  any |= last;
@@ -3331,6 +3334,13 @@ namespace das {
             // this is here again for a reason
             last = optimizationUnused(logs);    if ( failed() ) break;  any |= last;
             if ( log ) logs << "REMOVE UNUSED:" << (last ? "optimized" : "nothing") << "\n"; if ( logPass ) logs << *this;
+            // these two need access flags, which are built by remove unused
+            last = optimizationLoopInvariants(hoisted); if ( failed() ) break;  any |= last;
+            if ( log ) logs << "LOOP INVARIANTS:" << (last ? "optimized" : "nothing") << ", " << hoisted << " hoisted\n"; if ( logPass ) logs << *this;
+            last = optimizationCommonSubexpressions(eliminated); if ( failed() ) break;  any |= last;
+            if ( log ) logs << "COMMON SUBEXPRESSIONS:" << (last ? "optimized" : "nothing") << ", " << eliminated << " eliminated\n"; if ( logPass ) logs << *this;
+            last = optimizationBoundsChecks(unchecked); if ( failed() ) break;  any |= last;
+            if ( log ) logs << "BOUNDS CHECKS:" << (last ? "optimized" : "nothing") << ", " << unchecked << " eliminated\n"; if ( logPass ) logs << *this;
             // now, user macros
             last = false;
             auto modMacro = [&](Module * mod) -> bool {    // we run all macros for each module
@@ -2173,7 +2173,7 @@ namespace das {
         virtual void preVisitAtIndex ( ExprAt * expr, Expression * index ) override {
             Visitor::preVisitAtIndex(expr, index);
             if ( expr->subexpr->type->dim.size() || expr->subexpr->type->isGoodArrayType() || expr->subexpr->type->isGoodTableType() ) {
-                if ( expr->subexpr->type->isNativeDim ) {
+                if ( expr->subexpr->type->isNativeDim || expr->no_bounds_check ) {
                     ss << "[";
                 } else {
                     ss << "(";
@@ -2184,7 +2184,7 @@ namespace das {
 
         }
         virtual ExpressionPtr visit ( ExprAt * expr ) override {
-            if ( expr->subexpr->type->isNativeDim ) {
+            if ( expr->subexpr->type->isNativeDim || expr->no_bounds_check ) {
                 ss << "]";
             } else {
                 ss << ",__context__)";
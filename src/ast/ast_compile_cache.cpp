@@ -0,0 +1,265 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_serializer.h"
+#include "daScript/misc/anyhash.h"
+
+#include <sys/stat.h>
+#if defined(_MSC_VER)
+#include <direct.h>
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+/*
+    content addressed cache of compiled programs
+
+    <cache>/<file and policies hash>.manifest
+        hash of the sources, then the names of all the files the program was compiled from, one per line
+    <cache>/<sources hash>.das_image
+        the serializer version, then the program, as written by Program::serialize. images of any other version
+        are rejected when they are loaded. the image is memory mapped, and bodies of the library
+        functions which the program does not call stay there until Program::materializeFunction asks for them
+
+    the sources hash covers the text of every file in the manifest, the policies, the serializer version and
+    the cumulative hashes of the builtin modules. if any of it changes the image is dropped, and the program
+    is compiled again
+*/
+
+namespace das {
+
+    static atomic<uint64_t> g_cacheHits { 0 };
+    static atomic<uint64_t> g_cacheMisses { 0 };
+    static atomic<uint64_t> g_cacheInvalidations { 0 };
+    static atomic<uint64_t> g_cacheStores { 0 };
+
+    CompileCacheStats getCompileCacheStats() {
+        CompileCacheStats stats;
+        stats.hits = g_cacheHits;
+        stats.misses = g_cacheMisses;
+        stats.invalidations = g_cacheInvalidations;
+        stats.stores = g_cacheStores;
+        return stats;
+    }
+
+    void resetCompileCacheStats() {
+        g_cacheHits = 0;
+        g_cacheMisses = 0;
+        g_cacheInvalidations = 0;
+        g_cacheStores = 0;
+    }
+
+    static string cacheHashName ( uint64_t hash ) {
+        char buf[32];
+        snprintf(buf, sizeof(buf), "%016llx", (unsigned long long) hash);
+        return buf;
+    }
+
+    static bool cacheReadFile ( const string & fileName, vector<uint8_t> & data ) {
+        FILE * f = fopen(fileName.c_str(), "rb");
+        if ( !f ) return false;
+        fseek(f, 0, SEEK_END);
+        long size = ftell(f);
+        fseek(f, 0, SEEK_SET);
+        bool ok = size >= 0;
+        if ( ok ) {
+            data.resize(size_t(size));
+            ok = size==0 || fread(data.data(), 1, size_t(size), f)==size_t(size);
+        }
+        fclose(f);
+        return ok;
+    }
+
+    static atomic<uint32_t> g_cacheTempIndex { 0 };
+
+    static uint32_t cacheProcessId() {
+#if defined(_MSC_VER)
+        return uint32_t(_getpid());
+#else
+        return uint32_t(getpid());
+#endif
+    }
+
+    // written next to the target and renamed, so that other processes never see half of the file.
+    // temp name is unique per process and per write, so that concurrent writers of the same image don't share it
+    static bool cacheWriteFile ( const string & fileName, const void * data, size_t size ) {
+        char suffix[48];
+        snprintf(suffix, sizeof(suffix), ".%u.%u.tmp", cacheProcessId(), uint32_t(g_cacheTempIndex++));
+        string tempName = fileName + suffix;
+        FILE * f = fopen(tempName.c_str(), "wb");
+        if ( !f ) return false;
+        bool ok = size==0 || fwrite(data, 1, size, f)==size;
+        ok = (fclose(f)==0) && ok;
+        if ( ok ) {
+#if defined(_MSC_VER)
+            remove(fileName.c_str());
+#endif
+            ok = rename(tempName.c_str(), fileName.c_str())==0;
+        }
+        if ( !ok ) remove(tempName.c_str());
+        return ok;
+    }
+
+    static void cacheMakeDir ( const string & dir ) {
+#if defined(_MSC_VER)
+        _mkdir(dir.c_str());
+#else
+        mkdir(dir.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+#endif
+    }
+
+    // policies, serializer version, and builtin modules, which the image refers to by name
+    static uint64_t cacheEnvironmentHash ( CodeOfPolicies policies ) {
+        auto storage = make_unique<SerializationStorageVector>();
+        AstSerializer ser ( storage.get(), true );
+        ser << policies;
+        uint32_t version = ser.getVersion();
+        storage->write(&version, sizeof(version));
+        Module::foreach([&](Module * mod) -> bool {
+            if ( mod->builtIn && !mod->promoted ) {
+                storage->write(mod->name.c_str(), mod->name.size());
+                storage->write(&mod->cumulativeHash, sizeof(mod->cumulativeHash));
+            }
+            return true;
+        });
+        return hash_block64(storage->buffer.data(), storage->buffer.size());
+    }
+
+    static bool cacheSourcesHash ( const FileAccessPtr & access, const vector<string> & files, uint64_t envHash, uint64_t & hash ) {
+        vector<uint64_t> parts;
+        parts.reserve(files.size()*2 + 1);
+        parts.push_back(envHash);
+        for ( auto & name : files ) {
+            auto fi = access->getFileInfo(name);
+            if ( !fi ) return false;
+            const char * src = nullptr;
+            uint32_t len = 0;
+            fi->getSourceAndLength(src, len);
+            if ( !src ) return false;
+            parts.push_back(hash_block64((const uint8_t *) name.c_str(), name.size()));
+            parts.push_back(hash_block64((const uint8_t *) src, len));
+        }
+        hash = hash_block64((const uint8_t *) parts.data(), parts.size()*sizeof(uint64_t));
+        return true;
+    }
+
+    static bool cacheParseManifest ( const vector<uint8_t> & data, uint64_t & hash, vector<string> & files ) {
+        string text(data.begin(), data.end());
+        size_t pos = 0;
+        bool first = true;
+        while ( pos < text.size() ) {
+            auto eol = text.find('\n', pos);
+            if ( eol==string::npos ) eol = text.size();
+            string line = text.substr(pos, eol - pos);
+            pos = eol + 1;
+            if ( first ) {
+                char * end = nullptr;
+                hash = strtoull(line.c_str(), &end, 16);
+                if ( !end || *end ) return false;
+                first = false;
+            } else if ( !line.empty() ) {
+                files.push_back(line);
+            }
+        }
+        return !first && !files.empty();
+    }
+
+    static ProgramPtr cacheLoadImage ( const string & imageName, ModuleGroup & libGroup ) {
+        auto storage = make_unique<SerializationStorageMapped>();
+        if ( !storage->open(imageName) ) return nullptr;
+        auto program = make_smart<Program>();
+        auto deser = make_shared<AstSerializer>(storage.get(), false);
+        uint32_t version = 0;
+        if ( !storage->read(version) || version!=deser->getVersion() ) return nullptr;
+        deser->lazyFunctionBodies = true;
+        deser->ownStorage = das::move(storage);
+        if ( !deser->serializeScript(program) || program->failed() ) {
+            program->thisModule.release();  // serializer owns whatever it managed to create, and deletes it
+            return nullptr;
+        }
+        deser->moduleLibrary = nullptr;
+        if ( !deser->lazyBodies.empty() ) {
+            program->lazyImage = deser;
+        }
+        // required modules go to the group, the same way compileDaScript leaves them
+        program->library.foreach([&](Module * pm) -> bool {
+            if ( !pm->builtIn && pm!=program->thisModule.get() && !libGroup.findModule(pm->name) ) {
+                libGroup.addModule(pm);
+            }
+            return true;
+        }, "*");
+        program->thisModuleGroup = &libGroup;
+        return program;
+    }
+
+    static bool cacheStoreImage ( const string & cacheDir, const string & manifestName, ProgramPtr program,
+                                  const FileAccessPtr & access, uint64_t envHash ) {
+        auto files = access->getLoadedFileNames();
+        uint64_t hash = 0;
+        if ( files.empty() || !cacheSourcesHash(access, files, envHash, hash) ) return false;
+        auto storage = make_unique<SerializationStorageVector>();
+        {
+            AstSerializer ser ( storage.get(), true );
+            uint32_t version = ser.getVersion();
+            storage->write(&version, sizeof(version));
+            ser.lazyFunctionBodies = true;
+            try {
+                program->serialize(ser);
+            } catch ( const std::runtime_error & r ) {
+                LOG(LogLevel::warning) << "das: compile cache: " << r.what() << "\n";
+                return false;
+            }
+            ser.moduleLibrary = nullptr;
+        }
+        cacheMakeDir(cacheDir);
+        if ( !cacheWriteFile(cacheDir + "/" + cacheHashName(hash) + ".das_image", storage->buffer.data(), storage->buffer.size()) ) {
+            return false;
+        }
+        TextWriter manifest;
+        manifest << cacheHashName(hash) << "\n";
+        for ( auto & name : files ) {
+            manifest << name << "\n";
+        }
+        auto text = manifest.str();
+        return cacheWriteFile(manifestName, text.c_str(), text.size());
+    }
+
+    ProgramPtr compileDaScriptCached ( const string & fileName, const FileAccessPtr & access, TextWriter & logs,
+                                       ModuleGroup & libGroup, const string & cacheDir, CodeOfPolicies policies ) {
+        if ( cacheDir.empty() ) {
+            return compileDaScript(fileName, access, logs, libGroup, policies);
+        }
+        uint64_t envHash = cacheEnvironmentHash(policies);
+        uint64_t keys[2] = { hash_block64((const uint8_t *) fileName.c_str(), fileName.size()), envHash };
+        string manifestName = cacheDir + "/" + cacheHashName(hash_block64((const uint8_t *) keys, sizeof(keys))) + ".manifest";
+        bool invalidated = false;
+        vector<uint8_t> manifest;
+        if ( cacheReadFile(manifestName, manifest) ) {
+            uint64_t savedHash = 0, hash = 0;
+            vector<string> files;
+            if ( cacheParseManifest(manifest, savedHash, files) ) {
+                string imageName = cacheDir + "/" + cacheHashName(savedHash) + ".das_image";
+                if ( cacheSourcesHash(access, files, envHash, hash) && hash==savedHash ) {
+                    if ( auto program = cacheLoadImage(imageName, libGroup) ) {
+                        g_cacheHits ++;
+                        return program;
+                    }
+                }
+                remove(imageName.c_str());
+            }
+            remove(manifestName.c_str());
+            invalidated = true;
+        }
+        if ( invalidated ) {
+            g_cacheInvalidations ++;
+        } else {
+            g_cacheMisses ++;
+        }
+        auto program = compileDaScript(fileName, access, logs, libGroup, policies);
+        if ( !program->failed() && cacheStoreImage(cacheDir, manifestName, program, access, envHash) ) {
+            g_cacheStores ++;
+        }
+        return program;
+    }
+}
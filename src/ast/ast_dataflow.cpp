@@ -0,0 +1,804 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_visitor.h"
+
+namespace das {
+
+    // this runs after optimizationUnused, so the write flags on ExprVar etc are up to date
+
+    static bool isPureBuiltin ( Function * fn ) {
+        return fn && fn->builtIn && fn->sideEffectFlags==0 && !fn->unsafeOperation && !fn->unsafeDeref;
+    }
+
+    // integer division and modulo can throw, so they are never moved to where they would not be evaluated
+    static bool canThrow ( ExprOp2 * op2 ) {
+        return (op2->op=="/" || op2->op=="%") && op2->type && !op2->type->isFloatOrDouble();
+    }
+
+    static bool hasWork ( Expression * expr ) {
+        if ( expr->rtti_isOp1() || expr->rtti_isOp2() || expr->rtti_isOp3() || expr->rtti_isCall() ) {
+            return true;
+        } else if ( expr->rtti_isR2V() ) {
+            return hasWork(static_cast<ExprRef2Value *>(expr)->subexpr.get());
+        } else if ( expr->rtti_isField() ) {
+            return hasWork(static_cast<ExprField *>(expr)->value.get());
+        } else if ( expr->rtti_isSwizzle() ) {
+            return hasWork(static_cast<ExprSwizzle *>(expr)->value.get());
+        }
+        return false;
+    }
+
+    // what the loop declares and what it writes to
+    class LoopScan : public Visitor {
+    public:
+        das_hash_set<Variable *>    declared;
+        das_hash_set<Variable *>    written;
+        bool                        hasJumps = false;
+    protected:
+        virtual void preVisitLet ( ExprLet * let, const VariablePtr & var, bool last ) override {
+            Visitor::preVisitLet(let, var, last);
+            declared.insert(var.get());
+        }
+        virtual void preVisitFor ( ExprFor * expr, const VariablePtr & var, bool last ) override {
+            Visitor::preVisitFor(expr, var, last);
+            declared.insert(var.get());
+        }
+        virtual void preVisit ( ExprVar * expr ) override {
+            Visitor::preVisit(expr);
+            if ( expr->write ) written.insert(expr->variable.get());
+        }
+        // side effects of recursive functions may not be known yet, so we assume they write to every argument they can
+        virtual void preVisit ( ExprCall * expr ) override {
+            Visitor::preVisit(expr);
+            if ( !expr->func || expr->func->builtIn ) return;
+            for ( size_t ai=0, ais=min(expr->arguments.size(), expr->func->arguments.size()); ai!=ais; ++ai ) {
+                if ( expr->func->arguments[ai]->type->canWrite() ) {
+                    if ( auto root = getRootVariable(expr->arguments[ai].get()) ) written.insert(root);
+                }
+            }
+        }
+        static Variable * getRootVariable ( Expression * expr ) {
+            if ( expr->rtti_isVar() ) return static_cast<ExprVar *>(expr)->variable.get();
+            if ( expr->rtti_isR2V() ) return getRootVariable(static_cast<ExprRef2Value *>(expr)->subexpr.get());
+            if ( expr->rtti_isField() ) return getRootVariable(static_cast<ExprField *>(expr)->value.get());
+            if ( expr->rtti_isSwizzle() ) return getRootVariable(static_cast<ExprSwizzle *>(expr)->value.get());
+            if ( expr->rtti_isAt() ) return getRootVariable(static_cast<ExprAt *>(expr)->subexpr.get());
+            return nullptr;
+        }
+        virtual void preVisit ( ExprLabel * expr ) override {
+            Visitor::preVisit(expr);
+            hasJumps = true;
+        }
+        virtual void preVisit ( ExprGoto * expr ) override {
+            Visitor::preVisit(expr);
+            hasJumps = true;
+        }
+    };
+
+    // references to local variables can only be taken via addr(), or local reference variables
+    // if function has either, we don't know what the loop modifies
+    // blocks capture locals by reference, so whatever they write can change during any loop which invokes them
+    class LocalAliasScan : public Visitor {
+    public:
+        bool                        aliased = false;
+        das_hash_set<Variable *>    closureWritten;
+    protected:
+        virtual void preVisit ( ExprMakeBlock * expr ) override {
+            Visitor::preVisit(expr);
+            LoopScan scan;
+            expr->block->visit(scan);
+            closureWritten.insert(scan.written.begin(), scan.written.end());
+        }
+        virtual void preVisit ( ExprRef2Ptr * expr ) override {
+            Visitor::preVisit(expr);
+            aliased = true;
+        }
+        virtual void preVisitLet ( ExprLet * let, const VariablePtr & var, bool last ) override {
+            Visitor::preVisitLet(let, var, last);
+            if ( var->type->ref && !var->generated ) aliased = true;
+        }
+    };
+
+    // marks expressions, which evaluate to the same value on every iteration of the loop
+    //  invariant   - every node which only depends on constants and on variables the loop does not modify
+    //  inner       - invariant nodes, which are part of the larger invariant node
+    class LoopInvariantMarker : public Visitor {
+    public:
+        LoopInvariantMarker ( const LoopScan & s ) : scan(s) {}
+        das_hash_set<Expression *>  invariant;
+        das_hash_set<Expression *>  inner;
+    protected:
+        const LoopScan & scan;
+    protected:
+        bool isInvariant ( Expression * expr ) const {
+            return expr->rtti_isConstant() || invariant.find(expr)!=invariant.end();
+        }
+        void markInner ( Expression * expr ) {
+            if ( !expr->rtti_isConstant() ) inner.insert(expr);
+        }
+        virtual ExpressionPtr visit ( ExprVar * expr ) override {
+            auto var = expr->variable.get();
+            bool readOnly = scan.written.find(var)==scan.written.end() && scan.declared.find(var)==scan.declared.end();
+            if ( readOnly && !expr->block && !var->type->ref ) {
+                if ( expr->local ) {
+                    invariant.insert(expr);
+                } else if ( expr->argument && var->type->isWorkhorseType() ) {
+                    // other arguments, i.e. arrays and tables, are passed by reference, and can alias a global or another argument,
+                    // which the loop resizes. proving that would need a whole program alias analysis, so length(arg) is not hoisted
+                    invariant.insert(expr);
+                }
+            }
+            return Visitor::visit(expr);
+        }
+        virtual ExpressionPtr visit ( ExprRef2Value * expr ) override {
+            if ( isInvariant(expr->subexpr.get()) ) {
+                invariant.insert(expr);
+                markInner(expr->subexpr.get());
+            }
+            return Visitor::visit(expr);
+        }
+        virtual ExpressionPtr visit ( ExprField * expr ) override {
+            if ( !expr->annotation && !expr->value->type->isPointer() && isInvariant(expr->value.get()) ) {
+                invariant.insert(expr);
+                markInner(expr->value.get());
+            }
+            return Visitor::visit(expr);
+        }
+        virtual ExpressionPtr visit ( ExprSwizzle * expr ) override {
+            if ( isInvariant(expr->value.get()) ) {
+                invariant.insert(expr);
+                markInner(expr->value.get());
+            }
+            return Visitor::visit(expr);
+        }
+        virtual ExpressionPtr visit ( ExprOp1 * expr ) override {
+            if ( isPureBuiltin(expr->func) && isInvariant(expr->subexpr.get()) ) {
+                invariant.insert(expr);
+                markInner(expr->subexpr.get());
+            }
+            return Visitor::visit(expr);
+        }
+        virtual ExpressionPtr visit ( ExprOp2 * expr ) override {
+            if ( isPureBuiltin(expr->func) && !canThrow(expr) && isInvariant(expr->left.get()) && isInvariant(expr->right.get()) ) {
+                invariant.insert(expr);
+                markInner(expr->left.get());
+                markInner(expr->right.get());
+            }
+            return Visitor::visit(expr);
+        }
+        virtual ExpressionPtr visit ( ExprOp3 * expr ) override {
+            if ( (!expr->func || isPureBuiltin(expr->func))
+                    && isInvariant(expr->subexpr.get()) && isInvariant(expr->left.get()) && isInvariant(expr->right.get()) ) {
+                invariant.insert(expr);
+                markInner(expr->subexpr.get());
+                markInner(expr->left.get());
+                markInner(expr->right.get());
+            }
+            return Visitor::visit(expr);
+        }
+        virtual ExpressionPtr visit ( ExprCall * expr ) override {
+            if ( isPureBuiltin(expr->func) && expr->type->isWorkhorseType() ) {
+                bool all = true;
+                for ( auto & arg : expr->arguments ) {   // string conversions can throw
+                    if ( arg->type->isString() || !isInvariant(arg.get()) ) { all = false; break; }
+                }
+                if ( all ) {
+                    invariant.insert(expr);
+                    for ( auto & arg : expr->arguments ) markInner(arg.get());
+                }
+            }
+            return Visitor::visit(expr);
+        }
+    };
+
+    // replaces topmost invariant values with the temporary variables
+    class LoopInvariantHoist : public Visitor {
+    public:
+        LoopInvariantHoist ( const LoopInvariantMarker & m, int32_t & c ) : marker(m), counter(c) {}
+        vector<VariablePtr> hoisted;
+    protected:
+        const LoopInvariantMarker & marker;
+        int32_t & counter;
+    protected:
+        ExpressionPtr hoist ( Expression * expr ) {
+            if ( marker.invariant.find(expr)==marker.invariant.end() ) return expr;
+            if ( marker.inner.find(expr)!=marker.inner.end() ) return expr;
+            if ( !expr->type || expr->type->isRef() || !expr->type->isWorkhorseType() || expr->type->isString() ) return expr;
+            if ( expr->constexpression || !hasWork(expr) ) return expr;
+            auto var = make_smart<Variable>();
+            var->name = "__licm_" + to_string(counter++);
+            var->at = expr->at;
+            var->type = make_smart<TypeDecl>(*expr->type);
+            var->type->ref = false;
+            var->type->constant = true;
+            var->init = expr;
+            var->generated = true;
+            hoisted.push_back(var);
+            auto evar = make_smart<ExprVar>(expr->at, var->name);
+            evar->variable = var;
+            evar->local = true;
+            evar->r2v = true;
+            evar->type = make_smart<TypeDecl>(*var->type);
+            return evar;
+        }
+        virtual ExpressionPtr visit ( ExprRef2Value * expr ) override { return hoist(expr); }
+        virtual ExpressionPtr visit ( ExprField * expr ) override { return hoist(expr); }
+        virtual ExpressionPtr visit ( ExprSwizzle * expr ) override { return hoist(expr); }
+        virtual ExpressionPtr visit ( ExprOp1 * expr ) override { return hoist(expr); }
+        virtual ExpressionPtr visit ( ExprOp2 * expr ) override { return hoist(expr); }
+        virtual ExpressionPtr visit ( ExprOp3 * expr ) override { return hoist(expr); }
+        virtual ExpressionPtr visit ( ExprCall * expr ) override { return hoist(expr); }
+    };
+
+    // counts generated temporaries, so that names are unique within the function
+    class GeneratedNameScan : public Visitor {
+    public:
+        GeneratedNameScan ( const char * p ) : prefix(p) {}
+        int32_t next = 0;
+    protected:
+        const char * prefix;
+        virtual void preVisitLet ( ExprLet * let, const VariablePtr & var, bool last ) override {
+            Visitor::preVisitLet(let, var, last);
+            if ( var->generated && var->name.compare(0, strlen(prefix), prefix)==0 ) {
+                next = max(next, atoi(var->name.c_str() + strlen(prefix)) + 1);
+            }
+        }
+    };
+
+    static smart_ptr<ExprLet> makeGeneratedLet ( const VariablePtr & var, const LineInfo & visibility ) {
+        auto let = make_smart<ExprLet>();
+        let->at = var->at;
+        let->atInit = var->init->at;
+        let->visibility = visibility;
+        let->variables.push_back(var);
+        return let;
+    }
+
+    // loop invariant code motion
+    //  for ( i in range(n) ) { a[i] = a[i] * (scale * 2.0) + float(n) }
+    //      ->
+    //  let __licm_0 = scale * 2.0
+    //  let __licm_1 = float(n)
+    //  for ( i in range(n) ) { a[i] = a[i] * __licm_0 + __licm_1 }
+    // only values of workhorse types, which are computed by pure builtin functions
+    // from constants and the variables the loop does not modify, are hoisted
+    // values, which depend on array and table arguments (i.e. length(arg)) are not, since the argument can alias
+    class LoopInvariantMotion : public PassVisitor {
+    public:
+        int32_t total = 0;
+    protected:
+        Function *  func = nullptr;
+        bool        aliased = false;
+        int32_t     counter = 0;
+        das_hash_set<Variable *>    closureWritten;
+    protected:
+        virtual void preVisit ( Function * f ) override {
+            Visitor::preVisit(f);
+            func = f;
+            if ( !f->body ) return;
+            LocalAliasScan als;
+            f->body->visit(als);
+            aliased = als.aliased || f->hasUnsafe || f->generator;
+            closureWritten = das::move(als.closureWritten);
+            GeneratedNameScan gns("__licm_");
+            f->body->visit(gns);
+            counter = gns.next;
+        }
+        virtual FunctionPtr visit ( Function * f ) override {
+            func = nullptr;
+            return Visitor::visit(f);
+        }
+        bool hoistLoop ( Expression * loop, vector<VariablePtr> & hoisted ) {
+            LoopScan scan;
+            scan.written = closureWritten;
+            ExpressionPtr * cond = nullptr;
+            ExpressionPtr * body = nullptr;
+            if ( loop->rtti_isFor() ) {
+                auto efor = static_cast<ExprFor *>(loop);
+                for ( auto & it : efor->iteratorVariables ) scan.declared.insert(it.get());
+                body = &efor->body;
+            } else {
+                auto ewhile = static_cast<ExprWhile *>(loop);
+                ewhile->cond->visit(scan);
+                cond = &ewhile->cond;
+                body = &ewhile->body;
+            }
+            (*body)->visit(scan);
+            if ( scan.hasJumps ) return false;
+            LoopInvariantMarker marker(scan);
+            if ( cond ) (*cond)->visit(marker);
+            (*body)->visit(marker);
+            if ( marker.invariant.empty() ) return false;
+            LoopInvariantHoist hoist(marker, counter);
+            if ( cond ) *cond = (*cond)->visit(hoist);
+            *body = (*body)->visit(hoist);
+            for ( auto & var : hoist.hoisted ) hoisted.push_back(var);
+            return !hoist.hoisted.empty();
+        }
+        virtual ExpressionPtr visit ( ExprBlock * block ) override {
+            if ( func && !aliased ) {
+                for ( size_t i=0; i!=block->list.size(); ++i ) {
+                    auto loop = block->list[i].get();
+                    if ( !loop->rtti_isFor() && !loop->rtti_isWhile() ) continue;
+                    vector<VariablePtr> hoisted;
+                    if ( hoistLoop(loop, hoisted) ) {
+                        for ( auto & var : hoisted ) {
+                            block->list.insert(block->list.begin() + i, makeGeneratedLet(var, loop->at));
+                            i ++;
+                        }
+                        total += int32_t(hoisted.size());
+                        reportFolding();
+                    }
+                }
+            }
+            return Visitor::visit(block);
+        }
+    };
+
+    // local common subexpression elimination
+    //  a[i].pos.x = a[i].pos.x + a[i].pos.y * a[i].pos.z
+    //      ->
+    //  let __cse_0 & = a[i].pos
+    //  __cse_0.x = __cse_0.x + __cse_0.y * __cse_0.z
+    // only within one statement, which has no side effects other than the final assignment,
+    // so that nothing in between can resize the array the reference points to
+    class CommonSubexpressions : public PassVisitor {
+    public:
+        int32_t total = 0;
+    protected:
+        Function *  func = nullptr;
+        int32_t     counter = 0;
+    protected:
+        virtual void preVisit ( Function * f ) override {
+            Visitor::preVisit(f);
+            func = f;
+            if ( !f->body ) return;
+            GeneratedNameScan gns("__cse_");
+            f->body->visit(gns);
+            counter = gns.next;
+        }
+        virtual FunctionPtr visit ( Function * f ) override {
+            func = nullptr;
+            return Visitor::visit(f);
+        }
+        static bool isIndexable ( const TypeDeclPtr & type ) {
+            return type && (type->isGoodArrayType() || type->dim.size());
+        }
+        // everything in the statement is pure, i.e. no calls or operators which can modify anything
+        static bool isPure ( Expression * expr ) {
+            if ( expr->rtti_isConstant() ) {
+                return true;
+            } else if ( expr->rtti_isVar() ) {
+                return true;
+            } else if ( expr->rtti_isR2V() ) {
+                return isPure(static_cast<ExprRef2Value *>(expr)->subexpr.get());
+            } else if ( expr->rtti_isField() ) {
+                auto efield = static_cast<ExprField *>(expr);
+                return !efield->annotation && isPure(efield->value.get());
+            } else if ( expr->rtti_isSwizzle() ) {
+                return isPure(static_cast<ExprSwizzle *>(expr)->value.get());
+            } else if ( expr->rtti_isAt() ) {
+                auto eat = static_cast<ExprAt *>(expr);
+                return isIndexable(eat->subexpr->type) && isPure(eat->subexpr.get()) && isPure(eat->index.get());
+            } else if ( expr->rtti_isOp1() ) {
+                auto op1 = static_cast<ExprOp1 *>(expr);
+                return isPureBuiltin(op1->func) && isPure(op1->subexpr.get());
+            } else if ( expr->rtti_isOp2() ) {
+                auto op2 = static_cast<ExprOp2 *>(expr);
+                return isPureBuiltin(op2->func) && isPure(op2->left.get()) && isPure(op2->right.get());
+            } else if ( expr->rtti_isOp3() ) {
+                auto op3 = static_cast<ExprOp3 *>(expr);
+                return (!op3->func || isPureBuiltin(op3->func))
+                    && isPure(op3->subexpr.get()) && isPure(op3->left.get()) && isPure(op3->right.get());
+            } else if ( expr->rtti_isCall() ) {
+                auto call = static_cast<ExprCall *>(expr);
+                if ( !isPureBuiltin(call->func) ) return false;
+                for ( auto & arg : call->arguments ) {
+                    if ( !isPure(arg.get()) ) return false;
+                }
+                return true;
+            }
+            return false;
+        }
+        static bool isChain ( Expression * expr ) {
+            if ( expr->rtti_isAt() ) {
+                return true;
+            } else if ( expr->rtti_isField() ) {
+                auto efield = static_cast<ExprField *>(expr);
+                return !efield->value->type->isPointer() && isChain(efield->value.get());
+            }
+            return false;
+        }
+        // collects reference chains, which are always evaluated (i.e. not under && || or ?:)
+        static void collect ( ExpressionPtr & slot, vector<ExpressionPtr *> & chains ) {
+            auto expr = slot.get();
+            if ( isChain(expr) ) chains.push_back(&slot);
+            if ( expr->rtti_isR2V() ) {
+                collect(static_cast<ExprRef2Value *>(expr)->subexpr, chains);
+            } else if ( expr->rtti_isField() ) {
+                collect(static_cast<ExprField *>(expr)->value, chains);
+            } else if ( expr->rtti_isSwizzle() ) {
+                collect(static_cast<ExprSwizzle *>(expr)->value, chains);
+            } else if ( expr->rtti_isAt() ) {
+                collect(static_cast<ExprAt *>(expr)->subexpr, chains);
+                collect(static_cast<ExprAt *>(expr)->index, chains);
+            } else if ( expr->rtti_isOp1() ) {
+                collect(static_cast<ExprOp1 *>(expr)->subexpr, chains);
+            } else if ( expr->rtti_isOp2() ) {
+                auto op2 = static_cast<ExprOp2 *>(expr);
+                collect(op2->left, chains);
+                if ( op2->op!="&&" && op2->op!="||" ) collect(op2->right, chains);
+            } else if ( expr->rtti_isOp3() ) {
+                collect(static_cast<ExprOp3 *>(expr)->subexpr, chains);
+            } else if ( expr->rtti_isCall() ) {
+                for ( auto & arg : static_cast<ExprCall *>(expr)->arguments ) collect(arg, chains);
+            }
+        }
+        static int32_t size ( Expression * expr ) {
+            if ( expr->rtti_isR2V() ) {
+                return size(static_cast<ExprRef2Value *>(expr)->subexpr.get()) + 1;
+            } else if ( expr->rtti_isField() ) {
+                return size(static_cast<ExprField *>(expr)->value.get()) + 1;
+            } else if ( expr->rtti_isSwizzle() ) {
+                return size(static_cast<ExprSwizzle *>(expr)->value.get()) + 1;
+            } else if ( expr->rtti_isAt() ) {
+                return size(static_cast<ExprAt *>(expr)->subexpr.get()) + size(static_cast<ExprAt *>(expr)->index.get()) + 1;
+            } else if ( expr->rtti_isOp1() ) {
+                return size(static_cast<ExprOp1 *>(expr)->subexpr.get()) + 1;
+            } else if ( expr->rtti_isOp2() ) {
+                return size(static_cast<ExprOp2 *>(expr)->left.get()) + size(static_cast<ExprOp2 *>(expr)->right.get()) + 1;
+            } else if ( expr->rtti_isOp3() ) {
+                auto op3 = static_cast<ExprOp3 *>(expr);
+                return size(op3->subexpr.get()) + size(op3->left.get()) + size(op3->right.get()) + 1;
+            } else if ( expr->rtti_isCall() ) {
+                int32_t total = 1;
+                for ( auto & arg : static_cast<ExprCall *>(expr)->arguments ) total += size(arg.get());
+                return total;
+            }
+            return 1;
+        }
+        // structural equality. top level r2v flags are ignored, since we replace with the reference anyway
+        static bool same ( Expression * a, Expression * b, bool top ) {
+            if ( strcmp(a->__rtti, b->__rtti)!=0 ) return false;
+            if ( a->rtti_isConstant() ) {
+                auto ca = static_cast<ExprConst *>(a);
+                auto cb = static_cast<ExprConst *>(b);
+                if ( ca->baseType!=cb->baseType ) return false;
+                if ( ca->baseType==Type::tString ) {
+                    return static_cast<ExprConstString *>(a)->text==static_cast<ExprConstString *>(b)->text;
+                }
+                return memcmp(&ca->value, &cb->value, sizeof(vec4f))==0;
+            } else if ( a->rtti_isVar() ) {
+                auto va = static_cast<ExprVar *>(a);
+                auto vb = static_cast<ExprVar *>(b);
+                return va->variable==vb->variable && va->r2v==vb->r2v;
+            } else if ( a->rtti_isR2V() ) {
+                return same(static_cast<ExprRef2Value *>(a)->subexpr.get(), static_cast<ExprRef2Value *>(b)->subexpr.get(), false);
+            } else if ( a->rtti_isField() ) {
+                auto fa = static_cast<ExprField *>(a);
+                auto fb = static_cast<ExprField *>(b);
+                if ( fa->name!=fb->name || fa->fieldIndex!=fb->fieldIndex ) return false;
+                if ( !top && fa->r2v!=fb->r2v ) return false;
+                return same(fa->value.get(), fb->value.get(), false);
+            } else if ( a->rtti_isSwizzle() ) {
+                auto sa = static_cast<ExprSwizzle *>(a);
+                auto sb = static_cast<ExprSwizzle *>(b);
+                return sa->mask==sb->mask && sa->r2v==sb->r2v && same(sa->value.get(), sb->value.get(), false);
+            } else if ( a->rtti_isAt() ) {
+                auto aa = static_cast<ExprAt *>(a);
+                auto ab = static_cast<ExprAt *>(b);
+                if ( !top && aa->r2v!=ab->r2v ) return false;
+                return same(aa->subexpr.get(), ab->subexpr.get(), false) && same(aa->index.get(), ab->index.get(), false);
+            } else if ( a->rtti_isOp1() ) {
+                auto oa = static_cast<ExprOp1 *>(a);
+                auto ob = static_cast<ExprOp1 *>(b);
+                return oa->func==ob->func && same(oa->subexpr.get(), ob->subexpr.get(), false);
+            } else if ( a->rtti_isOp2() ) {
+                auto oa = static_cast<ExprOp2 *>(a);
+                auto ob = static_cast<ExprOp2 *>(b);
+                return oa->func==ob->func && same(oa->left.get(), ob->left.get(), false) && same(oa->right.get(), ob->right.get(), false);
+            } else if ( a->rtti_isOp3() ) {
+                auto oa = static_cast<ExprOp3 *>(a);
+                auto ob = static_cast<ExprOp3 *>(b);
+                return oa->func==ob->func && same(oa->subexpr.get(), ob->subexpr.get(), false)
+                    && same(oa->left.get(), ob->left.get(), false) && same(oa->right.get(), ob->right.get(), false);
+            } else if ( a->rtti_isCall() ) {
+                auto ca = static_cast<ExprCall *>(a);
+                auto cb = static_cast<ExprCall *>(b);
+                if ( ca->func!=cb->func || ca->arguments.size()!=cb->arguments.size() ) return false;
+                for ( size_t i=0, is=ca->arguments.size(); i!=is; ++i ) {
+                    if ( !same(ca->arguments[i].get(), cb->arguments[i].get(), false) ) return false;
+                }
+                return true;
+            }
+            return false;
+        }
+        static bool isChainR2V ( Expression * expr ) {
+            return expr->rtti_isAt() ? static_cast<ExprAt *>(expr)->r2v : static_cast<ExprField *>(expr)->r2v;
+        }
+        // statement roots, in which every reference chain is evaluated before anything is modified
+        static bool getRoots ( Expression * stat, vector<ExpressionPtr *> & roots ) {
+            if ( stat->rtti_isCopy() ) {
+                auto cp = static_cast<ExprCopy *>(stat);
+                roots.push_back(&cp->left);
+                roots.push_back(&cp->right);
+            } else if ( stat->rtti_isLet() ) {
+                auto let = static_cast<ExprLet *>(stat);
+                for ( auto & var : let->variables ) {
+                    if ( var->type->ref || var->init_via_move || !var->init ) return false;
+                    roots.push_back(&var->init);
+                }
+            } else if ( stat->rtti_isOp2() && !stat->rtti_isClone() && !stat->rtti_isSequence() ) {
+                auto op2 = static_cast<ExprOp2 *>(stat);
+                if ( !op2->func || !op2->func->builtIn || op2->func->unsafeOperation ) return false;   // this also rules out <-
+                if ( op2->func->sideEffectFlags & ~uint32_t(SideEffects::modifyArgument) ) return false;
+                roots.push_back(&op2->left);
+                roots.push_back(&op2->right);
+            } else {
+                return false;
+            }
+            for ( auto root : roots ) {
+                if ( !isPure(root->get()) ) return false;
+            }
+            return true;
+        }
+        smart_ptr<ExprLet> eliminate ( Expression * stat ) {
+            vector<ExpressionPtr *> roots;
+            if ( !getRoots(stat, roots) ) return nullptr;
+            vector<ExpressionPtr *> chains;
+            for ( auto root : roots ) collect(*root, chains);
+            if ( chains.size()<2 ) return nullptr;
+            // largest chain, which is repeated
+            vector<ExpressionPtr *> best;
+            int32_t bestSize = 0;
+            for ( size_t i=0, is=chains.size(); i!=is; ++i ) {
+                auto ci = chains[i]->get();
+                auto sz = size(ci);
+                if ( sz<=bestSize ) continue;
+                vector<ExpressionPtr *> group = { chains[i] };
+                for ( size_t j=i+1; j!=is; ++j ) {
+                    if ( same(ci, chains[j]->get(), true) ) group.push_back(chains[j]);
+                }
+                if ( group.size()>=2 ) {
+                    best = das::move(group);
+                    bestSize = sz;
+                }
+            }
+            if ( best.empty() ) return nullptr;
+            // first occurrence becomes the reference
+            vector<bool> wasR2V;
+            for ( auto slot : best ) wasR2V.push_back(isChainR2V(slot->get()));
+            auto init = *best[0];
+            if ( wasR2V[0] ) {
+                if ( init->rtti_isAt() ) static_cast<ExprAt *>(init.get())->r2v = false;
+                else static_cast<ExprField *>(init.get())->r2v = false;
+                init->type = make_smart<TypeDecl>(*init->type);
+                init->type->ref = true;
+            }
+            auto var = make_smart<Variable>();
+            var->name = "__cse_" + to_string(counter++);
+            var->at = init->at;
+            var->type = make_smart<TypeDecl>(*init->type);
+            var->type->ref = true;
+            var->init = init;
+            var->generated = true;
+            for ( size_t i=0, is=best.size(); i!=is; ++i ) {
+                auto old = best[i]->get();
+                auto evar = make_smart<ExprVar>(old->at, var->name);
+                evar->variable = var;
+                evar->local = true;
+                if ( wasR2V[i] ) {
+                    evar->r2v = true;
+                    evar->type = make_smart<TypeDecl>(*var->type);
+                    evar->type->ref = false;
+                } else {
+                    evar->type = make_smart<TypeDecl>(*var->type);
+                }
+                *best[i] = evar;
+            }
+            return makeGeneratedLet(var, stat->at);
+        }
+        virtual ExpressionPtr visit ( ExprBlock * block ) override {
+            if ( func && !func->generator ) {
+                for ( size_t i=0; i!=block->list.size(); ++i ) {
+                    if ( auto let = eliminate(block->list[i].get()) ) {
+                        block->list.insert(block->list.begin() + i, let);
+                        i ++;
+                        total ++;
+                        reportFolding();
+                    }
+                }
+            }
+            return Visitor::visit(block);
+        }
+    };
+
+    // variables, which the loop writes to other than via an element, i.e. push, resize, clear, <-, delete etc
+    class ArrayResizeScan : public Visitor {
+    public:
+        das_hash_set<Variable *>    resized;
+    protected:
+        das_hash_set<Expression *>  elements;
+    protected:
+        virtual void preVisit ( ExprAt * expr ) override {
+            Visitor::preVisit(expr);
+            elements.insert(expr->subexpr.get());
+        }
+        virtual void preVisit ( ExprVar * expr ) override {
+            Visitor::preVisit(expr);
+            if ( expr->write && elements.find(expr)==elements.end() ) resized.insert(expr->variable.get());
+        }
+    };
+
+    // marks indexing, which is proven to be in range, with no_bounds_check
+    //  for ( i in range(length(a)) ) { a[i] }                  - a is local array, which the loop does not resize
+    // arguments and references are not eliminated, since they can alias a global or other array, which the loop resizes
+    //  for ( i in range(4) ) { d[i] }                          - d is int[4], or larger
+    // simulation then emits unchecked array nodes, and AOT emits raw indexing
+    class BoundsCheckElimination : public PassVisitor {
+    public:
+        int32_t total = 0;
+    protected:
+        struct IndexRange {
+            Variable *  iterator = nullptr;
+            Variable *  array = nullptr;        // i in [0,length(array))
+            bool        localArray = false;     // array is a local value, i.e. not an argument or a reference
+            int32_t     size = -1;              // i in [0,size)
+        };
+        Function *                  func = nullptr;
+        bool                        aliased = false;
+        das_hash_set<Variable *>    closureWritten;
+        vector<IndexRange>          ranges;
+        vector<size_t>              loopRanges;
+    protected:
+        virtual void preVisit ( Function * f ) override {
+            Visitor::preVisit(f);
+            func = f;
+            ranges.clear();
+            loopRanges.clear();
+            if ( !f->body ) return;
+            LocalAliasScan als;
+            f->body->visit(als);
+            aliased = als.aliased || f->hasUnsafe;
+            closureWritten = das::move(als.closureWritten);
+        }
+        virtual FunctionPtr visit ( Function * f ) override {
+            func = nullptr;
+            return Visitor::visit(f);
+        }
+        static bool isRangeCall ( Expression * expr, size_t nargs ) {
+            if ( !expr->rtti_isCall() ) return false;
+            auto call = static_cast<ExprCall *>(expr);
+            if ( !call->func || !call->func->builtIn || call->func->name!="range" || call->arguments.size()!=nargs ) return false;
+            for ( auto & arg : call->arguments ) {
+                if ( !arg->type->isSimpleType(Type::tInt) ) return false;
+            }
+            return true;
+        }
+        static ExprVar * getLengthOf ( Expression * expr ) {
+            if ( !expr->rtti_isCall() ) return nullptr;
+            auto call = static_cast<ExprCall *>(expr);
+            if ( !call->func || !call->func->builtIn || call->func->name!="length" || call->arguments.size()!=1 ) return nullptr;
+            auto arg = call->arguments[0].get();
+            if ( !arg->rtti_isVar() || !arg->type->isGoodArrayType() ) return nullptr;
+            auto evar = static_cast<ExprVar *>(arg);
+            if ( !evar->local && !evar->argument && !evar->block ) return nullptr;    // globals can be resized by anything
+            return evar;
+        }
+        bool getRange ( Expression * source, IndexRange & range ) const {
+            // range(4) is already folded into a constant by the time we get here
+            if ( source->rtti_isConstant() && static_cast<ExprConst *>(source)->baseType==Type::tRange ) {
+                auto value = static_cast<ExprConstRange *>(source)->getValue();
+                if ( value.from<0 ) return false;
+                range.size = value.to;
+                return true;
+            }
+            Expression * upper = nullptr;
+            if ( isRangeCall(source, 1) ) {
+                upper = static_cast<ExprCall *>(source)->arguments[0].get();
+            } else if ( isRangeCall(source, 2) ) {
+                auto lower = static_cast<ExprCall *>(source)->arguments[0].get();
+                if ( !lower->rtti_isConstant() || static_cast<ExprConstInt *>(lower)->getValue()<0 ) return false;
+                upper = static_cast<ExprCall *>(source)->arguments[1].get();
+            } else {
+                return false;
+            }
+            if ( upper->rtti_isConstant() ) {
+                range.size = static_cast<ExprConstInt *>(upper)->getValue();
+                return true;
+            } else if ( auto arr = getLengthOf(upper) ) {
+                range.array = arr->variable.get();
+                range.localArray = arr->local && !arr->variable->type->ref;
+                return true;
+            }
+            return false;
+        }
+        virtual void preVisit ( ExprFor * expr ) override {
+            Visitor::preVisit(expr);
+            loopRanges.push_back(ranges.size());
+            if ( !func ) return;
+            vector<IndexRange> found;
+            for ( size_t i=0, is=expr->sources.size(); i!=is; ++i ) {
+                IndexRange range;
+                if ( i<expr->iteratorsTupleExpansion.size() && expr->iteratorsTupleExpansion[i] ) continue;
+                if ( i<expr->iteratorVariables.size() && getRange(expr->sources[i].get(), range) ) {
+                    range.iterator = expr->iteratorVariables[i].get();
+                    found.push_back(range);
+                }
+            }
+            if ( found.empty() || !expr->body ) return;
+            ArrayResizeScan scan;
+            expr->body->visit(scan);
+            for ( auto & range : found ) {
+                if ( range.array ) {
+                    if ( !range.localArray || aliased || scan.resized.count(range.array) || closureWritten.count(range.array) ) continue;
+                }
+                ranges.push_back(range);
+            }
+        }
+        virtual ExpressionPtr visit ( ExprFor * expr ) override {
+            ranges.resize(loopRanges.back());
+            loopRanges.pop_back();
+            return Visitor::visit(expr);
+        }
+        static Variable * getIndexVariable ( Expression * index ) {
+            if ( index->rtti_isR2V() ) index = static_cast<ExprRef2Value *>(index)->subexpr.get();
+            return index->rtti_isVar() ? static_cast<ExprVar *>(index)->variable.get() : nullptr;
+        }
+        bool isInRange ( ExprAt * expr ) const {
+            auto stype = expr->subexpr->type.get();
+            auto ivar = getIndexVariable(expr->index.get());
+            if ( !ivar ) return false;
+            if ( stype->isGoodArrayType() ) {
+                if ( !expr->subexpr->rtti_isVar() ) return false;
+                auto avar = static_cast<ExprVar *>(expr->subexpr.get())->variable.get();
+                for ( auto & range : ranges ) {
+                    if ( range.iterator==ivar && range.array==avar ) return true;
+                }
+            } else if ( stype->dim.size() && !stype->isVectorType() ) {
+                for ( auto & range : ranges ) {
+                    if ( range.iterator==ivar && range.size>=0 && uint32_t(range.size)<=uint32_t(stype->dim[0]) ) return true;
+                }
+            }
+            return false;
+        }
+        virtual void preVisit ( ExprAt * expr ) override {
+            Visitor::preVisit(expr);
+            if ( !expr->no_bounds_check && !ranges.empty() && isInRange(expr) ) {
+                expr->no_bounds_check = true;
+                total ++;
+                reportFolding();
+            }
+        }
+    };
+
+    // program
+
+    bool Program::optimizationLoopInvariants ( int32_t & hoisted ) {
+        hoisted = 0;
+        if ( !options.getBoolOption("loop_invariant_motion", policies.loop_invariant_motion) ) return false;
+        LoopInvariantMotion context;
+        visit(context);
+        hoisted = context.total;
+        return context.didAnything();
+    }
+
+    bool Program::optimizationCommonSubexpressions ( int32_t & eliminated ) {
+        eliminated = 0;
+        if ( !options.getBoolOption("common_subexpressions", policies.common_subexpressions) ) return false;
+        CommonSubexpressions context;
+        visit(context);
+        eliminated = context.total;
+        return context.didAnything();
+    }
+
+    bool Program::optimizationBoundsChecks ( int32_t & eliminated ) {
+        eliminated = 0;
+        if ( !options.getBoolOption("bounds_check_elimination", policies.bounds_check_elimination) ) return false;
+        BoundsCheckElimination context;
+        visit(context);
+        eliminated = context.total;
+        return context.didAnything();
+    }
+}
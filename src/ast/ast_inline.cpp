@@ -0,0 +1,329 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_visitor.h"
+
+namespace das {
+
+    // this inlines calls to small leaf functions, i.e.
+    //  def mad ( a, b : float; c : float ) { return a * b + c; }
+    //  let t = mad(x, 2.0, y)      ->      let t = x * 2.0 + y
+    // only functions which consist of a single 'return expr' are considered, where expr
+    // is made of constants, arguments, fields, swizzles, indexing and calls to pure builtin functions.
+    // such functions can't be recursive, and inlining them never introduces new calls to non-builtin functions,
+    // so repeating the pass inlines bottom-up until nothing is left.
+    // arguments of the call site must be constants or local variables (or arguments),
+    // so that nothing is evaluated more than once or out of order.
+    // inlined nodes keep their line information, so runtime errors point to the inlined function.
+    class InlineFolding : public PassVisitor {
+    public:
+        InlineFolding ( int32_t mc ) : maxCost(mc) {}
+    protected:
+        int32_t                         maxCost = 0;
+        Function *                      func = nullptr;
+        das_hash_map<Function *,Expression *> candidates;   // inlined expression, or nullptr if function can't be inlined
+    protected:
+        virtual void preVisit ( Function * f ) override {
+            Visitor::preVisit(f);
+            func = f;
+        }
+        virtual FunctionPtr visit ( Function * f ) override {
+            func = nullptr;
+            return Visitor::visit(f);
+        }
+        static bool isPureBuiltin ( Function * fn ) {
+            return fn && fn->builtIn && fn->sideEffectFlags==0 && !fn->unsafeOperation && !fn->unsafeDeref;
+        }
+        // returns number of nodes in the expression, or -1 if expression can't be inlined
+        int32_t cost ( Expression * expr, Function * fn ) const {
+            if ( !expr || !expr->type ) return -1;
+            if ( expr->rtti_isConstant() ) {
+                return 1;
+            } else if ( expr->rtti_isVar() ) {
+                auto evar = static_cast<ExprVar *>(expr);
+                if ( !evar->argument || evar->block ) return -1;        // no globals, no block arguments
+                if ( evar->write || evar->underClone ) return -1;
+                if ( evar->argumentIndex<0 || evar->argumentIndex>=int32_t(fn->arguments.size()) ) return -1;
+                if ( fn->arguments[evar->argumentIndex].get()!=evar->variable.get() ) return -1;
+                return 1;
+            } else if ( expr->rtti_isR2V() ) {
+                auto sub = cost(static_cast<ExprRef2Value *>(expr)->subexpr.get(), fn);
+                return sub<0 ? -1 : sub + 1;
+            } else if ( expr->rtti_isField() ) {
+                auto efield = static_cast<ExprField *>(expr);
+                if ( efield->write || efield->underClone ) return -1;
+                auto sub = cost(efield->value.get(), fn);
+                return sub<0 ? -1 : sub + 1;
+            } else if ( expr->rtti_isSwizzle() ) {
+                auto eswz = static_cast<ExprSwizzle *>(expr);
+                if ( eswz->write ) return -1;
+                auto sub = cost(eswz->value.get(), fn);
+                return sub<0 ? -1 : sub + 1;
+            } else if ( expr->rtti_isAt() ) {
+                auto eat = static_cast<ExprAt *>(expr);
+                if ( eat->write ) return -1;
+                // only the kinds of indexing, which never modify the container
+                const auto & st = eat->subexpr->type;
+                if ( !st || !(st->isGoodArrayType() || st->dim.size() || st->isVectorType()) ) return -1;
+                auto sub = cost(eat->subexpr.get(), fn);
+                auto idx = cost(eat->index.get(), fn);
+                return (sub<0 || idx<0) ? -1 : sub + idx + 1;
+            } else if ( expr->rtti_isOp1() ) {
+                auto op1 = static_cast<ExprOp1 *>(expr);
+                if ( !isPureBuiltin(op1->func) ) return -1;
+                auto sub = cost(op1->subexpr.get(), fn);
+                return sub<0 ? -1 : sub + 1;
+            } else if ( expr->rtti_isOp2() ) {
+                auto op2 = static_cast<ExprOp2 *>(expr);
+                if ( !isPureBuiltin(op2->func) ) return -1;             // this also rules out =, <-, :=
+                auto left = cost(op2->left.get(), fn);
+                auto right = cost(op2->right.get(), fn);
+                return (left<0 || right<0) ? -1 : left + right + 1;
+            } else if ( expr->rtti_isOp3() ) {
+                auto op3 = static_cast<ExprOp3 *>(expr);
+                if ( op3->func && !isPureBuiltin(op3->func) ) return -1;
+                auto sub = cost(op3->subexpr.get(), fn);
+                auto left = cost(op3->left.get(), fn);
+                auto right = cost(op3->right.get(), fn);
+                return (sub<0 || left<0 || right<0) ? -1 : sub + left + right + 1;
+            } else if ( expr->rtti_isCall() ) {
+                auto call = static_cast<ExprCall *>(expr);
+                if ( !isPureBuiltin(call->func) ) return -1;
+                int32_t total = 1;
+                for ( auto & arg : call->arguments ) {
+                    auto sub = cost(arg.get(), fn);
+                    if ( sub<0 ) return -1;
+                    total += sub;
+                }
+                return total;
+            }
+            return -1;
+        }
+        Expression * getInlineExpression ( Function * fn ) {
+            auto it = candidates.find(fn);
+            if ( it!=candidates.end() ) return it->second;
+            Expression * res = nullptr;
+            if ( canInline(fn) ) {
+                auto ret = static_cast<ExprReturn *>(static_cast<ExprBlock *>(fn->body.get())->list[0].get());
+                auto c = cost(ret->subexpr.get(), fn);
+                if ( c>=0 && c<=maxCost ) res = ret->subexpr.get();
+            }
+            candidates[fn] = res;
+            return res;
+        }
+        bool canInline ( Function * fn ) const {
+            if ( fn->builtIn || fn->isTemplate || fn->stub || fn->lazyBody || !fn->body ) return false;
+            if ( !fn->annotations.empty() ) return false;           // [unsafe_operation], [no_aot], [hybrid], [jit], macros, etc
+            if ( fn->unsafeOperation || fn->unsafeDeref || fn->hasUnsafe || fn->unsafeOutsideOfFor ) return false;
+            if ( fn->noAot || fn->aotHybrid || fn->requestJit || fn->jitOnly || fn->pinvoke ) return false;
+            if ( fn->generator || fn->lambda || fn->hasMakeBlock || fn->hasStringBuilder || fn->hasTryRecover ) return false;
+            if ( fn->copyOnReturn || fn->moveOnReturn || fn->sideEffectFlags ) return false;
+            if ( !fn->result || fn->result->isRef() || !fn->result->isWorkhorseType() ) return false;
+            if ( !fn->body->rtti_isBlock() ) return false;
+            auto blk = static_cast<ExprBlock *>(fn->body.get());
+            if ( blk->list.size()!=1 || !blk->finalList.empty() || !blk->annotations.empty() || blk->isClosure ) return false;
+            if ( !blk->list[0]->rtti_isReturn() ) return false;
+            auto ret = static_cast<ExprReturn *>(blk->list[0].get());
+            if ( !ret->subexpr || ret->moveSemantics || ret->returnReference || ret->returnInBlock ) return false;
+            return true;
+        }
+        // call site argument is either a constant, or a local variable, or an argument of the caller
+        static Expression * getCallArgument ( Expression * arg ) {
+            if ( arg->rtti_isR2V() ) arg = static_cast<ExprRef2Value *>(arg)->subexpr.get();
+            if ( arg->rtti_isConstant() ) return arg;
+            if ( arg->rtti_isVar() ) {
+                auto evar = static_cast<ExprVar *>(arg);
+                if ( evar->isGlobalVariable() || !evar->variable ) return nullptr;
+                return arg;
+            }
+            return nullptr;
+        }
+        // constant can only replace argument, which is read by value
+        bool argumentIsOnlyReadByValue ( Expression * expr, int32_t index, bool underR2V ) const {
+            if ( expr->rtti_isConstant() ) {
+                return true;
+            } else if ( expr->rtti_isVar() ) {
+                auto evar = static_cast<ExprVar *>(expr);
+                return evar->argumentIndex!=index || underR2V || evar->r2v;
+            } else if ( expr->rtti_isR2V() ) {
+                return argumentIsOnlyReadByValue(static_cast<ExprRef2Value *>(expr)->subexpr.get(), index, true);
+            } else if ( expr->rtti_isField() ) {
+                return argumentIsOnlyReadByValue(static_cast<ExprField *>(expr)->value.get(), index, false);
+            } else if ( expr->rtti_isSwizzle() ) {
+                return argumentIsOnlyReadByValue(static_cast<ExprSwizzle *>(expr)->value.get(), index, false);
+            } else if ( expr->rtti_isAt() ) {
+                auto eat = static_cast<ExprAt *>(expr);
+                return argumentIsOnlyReadByValue(eat->subexpr.get(), index, false)
+                    && argumentIsOnlyReadByValue(eat->index.get(), index, false);
+            } else if ( expr->rtti_isOp1() ) {
+                return argumentIsOnlyReadByValue(static_cast<ExprOp1 *>(expr)->subexpr.get(), index, false);
+            } else if ( expr->rtti_isOp2() ) {
+                auto op2 = static_cast<ExprOp2 *>(expr);
+                return argumentIsOnlyReadByValue(op2->left.get(), index, false)
+                    && argumentIsOnlyReadByValue(op2->right.get(), index, false);
+            } else if ( expr->rtti_isOp3() ) {
+                auto op3 = static_cast<ExprOp3 *>(expr);
+                return argumentIsOnlyReadByValue(op3->subexpr.get(), index, false)
+                    && argumentIsOnlyReadByValue(op3->left.get(), index, false)
+                    && argumentIsOnlyReadByValue(op3->right.get(), index, false);
+            } else if ( expr->rtti_isCall() ) {
+                for ( auto & arg : static_cast<ExprCall *>(expr)->arguments ) {
+                    if ( !argumentIsOnlyReadByValue(arg.get(), index, false) ) return false;
+                }
+                return true;
+            }
+            return false;
+        }
+        // regular clone does not copy flags, which are set after the inference (by ref folding, etc)
+        // we walk both trees and restore them
+        static void restoreFlags ( Expression * from, Expression * to ) {
+            if ( from->rtti_isVar() ) {
+                static_cast<ExprVar *>(to)->varFlags = static_cast<ExprVar *>(from)->varFlags;
+            } else if ( from->rtti_isR2V() ) {
+                restoreFlags(static_cast<ExprRef2Value *>(from)->subexpr.get(), static_cast<ExprRef2Value *>(to)->subexpr.get());
+            } else if ( from->rtti_isField() ) {
+                auto ffrom = static_cast<ExprField *>(from);
+                auto fto = static_cast<ExprField *>(to);
+                fto->fieldFlags = ffrom->fieldFlags;
+                fto->derefFlags = ffrom->derefFlags;
+                fto->annotation = ffrom->annotation;
+                restoreFlags(ffrom->value.get(), fto->value.get());
+            } else if ( from->rtti_isSwizzle() ) {
+                auto sfrom = static_cast<ExprSwizzle *>(from);
+                auto sto = static_cast<ExprSwizzle *>(to);
+                sto->fields = sfrom->fields;
+                sto->fieldFlags = sfrom->fieldFlags;
+                restoreFlags(sfrom->value.get(), sto->value.get());
+            } else if ( from->rtti_isAt() ) {
+                auto afrom = static_cast<ExprAt *>(from);
+                auto ato = static_cast<ExprAt *>(to);
+                ato->atFlags = afrom->atFlags;
+                restoreFlags(afrom->subexpr.get(), ato->subexpr.get());
+                restoreFlags(afrom->index.get(), ato->index.get());
+            } else if ( from->rtti_isOp1() ) {
+                auto ofrom = static_cast<ExprOp1 *>(from);
+                auto oto = static_cast<ExprOp1 *>(to);
+                oto->callFlags = ofrom->callFlags;
+                restoreFlags(ofrom->subexpr.get(), oto->subexpr.get());
+            } else if ( from->rtti_isOp2() ) {
+                auto ofrom = static_cast<ExprOp2 *>(from);
+                auto oto = static_cast<ExprOp2 *>(to);
+                oto->callFlags = ofrom->callFlags;
+                restoreFlags(ofrom->left.get(), oto->left.get());
+                restoreFlags(ofrom->right.get(), oto->right.get());
+            } else if ( from->rtti_isOp3() ) {
+                auto ofrom = static_cast<ExprOp3 *>(from);
+                auto oto = static_cast<ExprOp3 *>(to);
+                oto->callFlags = ofrom->callFlags;
+                oto->func = ofrom->func;
+                restoreFlags(ofrom->subexpr.get(), oto->subexpr.get());
+                restoreFlags(ofrom->left.get(), oto->left.get());
+                restoreFlags(ofrom->right.get(), oto->right.get());
+            } else if ( from->rtti_isCall() ) {
+                auto cfrom = static_cast<ExprCall *>(from);
+                auto cto = static_cast<ExprCall *>(to);
+                cto->callFlags = cfrom->callFlags;
+                cto->doesNotNeedSp = cfrom->doesNotNeedSp;
+                cto->cmresAlias = cfrom->cmresAlias;
+                cto->notDiscarded = cfrom->notDiscarded;
+                for ( size_t i=0, is=cfrom->arguments.size(); i!=is; ++i ) {
+                    restoreFlags(cfrom->arguments[i].get(), cto->arguments[i].get());
+                }
+            }
+        }
+        // replaces arguments of the inlined function with the call site arguments
+        static ExpressionPtr substitute ( const ExpressionPtr & expr, const vector<Expression *> & args ) {
+            if ( expr->rtti_isVar() ) {
+                auto evar = static_pointer_cast<ExprVar>(expr);
+                auto arg = args[evar->argumentIndex];
+                if ( arg->rtti_isConstant() ) {
+                    auto cexpr = arg->clone();
+                    cexpr->at = evar->at;
+                    return cexpr;
+                }
+                auto avar = static_cast<ExprVar *>(arg);
+                auto nvar = static_pointer_cast<ExprVar>(avar->clone());
+                nvar->varFlags = avar->varFlags;
+                nvar->r2v = evar->r2v;
+                nvar->r2cr = evar->r2cr;
+                nvar->write = false;
+                nvar->underClone = false;
+                nvar->at = evar->at;
+                nvar->type = make_smart<TypeDecl>(*evar->type);
+                return nvar;
+            } else if ( expr->rtti_isR2V() ) {
+                auto r2v = static_pointer_cast<ExprRef2Value>(expr);
+                if ( r2v->subexpr->rtti_isVar() && args[static_cast<ExprVar *>(r2v->subexpr.get())->argumentIndex]->rtti_isConstant() ) {
+                    auto cexpr = substitute(r2v->subexpr, args);
+                    cexpr->type = make_smart<TypeDecl>(*r2v->type);
+                    return cexpr;
+                }
+                r2v->subexpr = substitute(r2v->subexpr, args);
+            } else if ( expr->rtti_isField() ) {
+                auto efield = static_pointer_cast<ExprField>(expr);
+                efield->value = substitute(efield->value, args);
+            } else if ( expr->rtti_isSwizzle() ) {
+                auto eswz = static_pointer_cast<ExprSwizzle>(expr);
+                eswz->value = substitute(eswz->value, args);
+            } else if ( expr->rtti_isAt() ) {
+                auto eat = static_pointer_cast<ExprAt>(expr);
+                eat->subexpr = substitute(eat->subexpr, args);
+                eat->index = substitute(eat->index, args);
+            } else if ( expr->rtti_isOp1() ) {
+                auto op1 = static_pointer_cast<ExprOp1>(expr);
+                op1->subexpr = substitute(op1->subexpr, args);
+            } else if ( expr->rtti_isOp2() ) {
+                auto op2 = static_pointer_cast<ExprOp2>(expr);
+                op2->left = substitute(op2->left, args);
+                op2->right = substitute(op2->right, args);
+            } else if ( expr->rtti_isOp3() ) {
+                auto op3 = static_pointer_cast<ExprOp3>(expr);
+                op3->subexpr = substitute(op3->subexpr, args);
+                op3->left = substitute(op3->left, args);
+                op3->right = substitute(op3->right, args);
+            } else if ( expr->rtti_isCall() ) {
+                auto call = static_pointer_cast<ExprCall>(expr);
+                for ( auto & arg : call->arguments ) {
+                    arg = substitute(arg, args);
+                }
+            }
+            return expr;
+        }
+        virtual ExpressionPtr visit ( ExprCall * call ) override {
+            auto fn = call->func;
+            if ( !func || !fn || fn==func || fn->builtIn ) return Visitor::visit(call);
+            if ( call->arguments.size()!=fn->arguments.size() ) return Visitor::visit(call);
+            auto inl = getInlineExpression(fn);
+            if ( !inl || !call->type ) return Visitor::visit(call);
+            if ( !inl->type->isSameType(*call->type, RefMatters::no, ConstMatters::no, TemporaryMatters::no) ) return Visitor::visit(call);
+            vector<Expression *> args;
+            args.reserve(call->arguments.size());
+            for ( size_t i=0, is=call->arguments.size(); i!=is; ++i ) {
+                auto arg = getCallArgument(call->arguments[i].get());
+                if ( !arg ) return Visitor::visit(call);
+                if ( arg->rtti_isConstant() ) {
+                    if ( !arg->type || !arg->type->isSameType(*fn->arguments[i]->type, RefMatters::no, ConstMatters::no, TemporaryMatters::no) ) {
+                        return Visitor::visit(call);
+                    }
+                    if ( !argumentIsOnlyReadByValue(inl, int32_t(i), false) ) return Visitor::visit(call);
+                }
+                args.push_back(arg);
+            }
+            auto res = inl->clone();
+            restoreFlags(inl, res.get());
+            res = substitute(res, args);
+            res->type = make_smart<TypeDecl>(*call->type);
+            reportFolding();
+            return res;
+        }
+    };
+
+    bool Program::optimizationInline() {
+        if ( !options.getBoolOption("inline_functions", policies.inline_functions) ) return false;
+        if ( policies.debugger || policies.profiler ) return false;     // we want to see every call
+        InlineFolding context(options.getIntOption("inline_max_cost", policies.inline_max_cost));
+        visit(context);
+        return context.didAnything();
+    }
+}
+
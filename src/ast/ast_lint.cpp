@@ -938,6 +938,10 @@ namespace das {
         "heap_size_limit",              Type::tInt,
         "string_heap_size_limit",       Type::tInt,
         "gc",                           Type::tBool,
+        "gc_mark_workers",              Type::tInt,
+        "gc_page_watch",                Type::tBool,
+        "heap_free_lists",              Type::tBool,    // every size class in use reserves at least one 64KB deck
+        "heap_huge_pages",              Type::tBool,
     // aot
         "no_aot",                       Type::tBool,
         "aot_prologue",                 Type::tBool,
@@ -1053,6 +1057,16 @@ namespace das {
                     LineInfo(), CompilationError::invalid_option);
             }
         }
+        if ( options.getBoolOption("gc_page_watch", false) ) {
+            // read or recv into a write-protected heap page fails with EFAULT, instead of going through the fault handler
+            for ( auto modName : { "fio", "network" } ) {
+                if ( library.findModule(modName) ) {
+                    error("option 'gc_page_watch' can't be used together with module '" + string(modName) + "'",
+                        "system calls which write into watched heap pages fail instead of faulting", "",
+                        LineInfo(), CompilationError::invalid_option);
+                }
+            }
+        }
         set<Module *> lints;
         Module::foreach([&](Module * mod) -> bool {
             DAS_ASSERT ( mod!=thisModule.get() );
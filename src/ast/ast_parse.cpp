@@ -258,6 +258,10 @@ namespace das {
 
     string getDasRoot ( void );
 
+    // file name -> names of the modules it requires directly. only collected when compileDaScript asks for it
+    typedef das_hash_map<string,vector<string>> ModuleRequireEdges;
+    static DAS_THREAD_LOCAL(ModuleRequireEdges *) tlsRequireEdges;
+
     bool getPrerequisits ( const string & fileName,
                           const FileAccessPtr & access,
                           string &modName,
@@ -365,6 +369,7 @@ namespace das {
                                 *log << string(tab,'\t') << "from " << fileName << " require " << mod
                                     << " - ok, new module " << info.moduleName << " at " << info.fileName << "\n";
                             }
+                            if ( *tlsRequireEdges ) (**tlsRequireEdges)[fileName].push_back(info.moduleName);
                             req.push_back(info);
                         } else {
                             if ( !access->isSameFileName(it_r->fileName, info.fileName) ) {
@@ -400,6 +405,7 @@ namespace das {
                                 if ( log ) {
                                     *log << string(tab,'\t') << "from " << fileName << " require " << mod << " - already required\n";
                                 }
+                                if ( *tlsRequireEdges ) (**tlsRequireEdges)[fileName].push_back(it_r->moduleName);
                             }
                         }
                     } else {
@@ -1040,6 +1046,87 @@ namespace das {
         return hash_blockz64(reinterpret_cast<const uint8_t *>(relPath.c_str()));
     }
 
+    struct RequireEdgesGuard {
+        RequireEdgesGuard ( ModuleRequireEdges * edges ) { saved = *tlsRequireEdges; *tlsRequireEdges = edges; }
+        ~RequireEdgesGuard () { *tlsRequireEdges = saved; }
+        ModuleRequireEdges * saved;
+    };
+
+    // compile time of one required module, and where it sits in the require graph
+    struct ModuleCompileTime {
+        string          moduleName;
+        int32_t         wave = 0;       // longest chain of required modules below this one
+        int64_t         parse = 0;
+        int64_t         infer = 0;
+        int64_t         optimize = 0;
+        int64_t         macroMods = 0;
+        int64_t         total = 0;
+        int64_t         path = 0;       // slowest chain of requirements, ending with this module
+        vector<int32_t> deps;
+    };
+
+    // req is in dependency order, requirements first. modules of the same wave do not require each other
+    static void scheduleModules ( const vector<ModuleInfo> & req, const ModuleRequireEdges & edges, vector<ModuleCompileTime> & times ) {
+        das_hash_map<string,int32_t> index;
+        times.resize(req.size());
+        for ( int32_t i=0, is=int32_t(req.size()); i!=is; ++i ) {
+            index[req[i].moduleName] = i;
+            times[i].moduleName = req[i].moduleName;
+        }
+        for ( int32_t i=0, is=int32_t(req.size()); i!=is; ++i ) {
+            auto it = edges.find(req[i].fileName);
+            if ( it==edges.end() ) continue;
+            auto & mt = times[i];
+            for ( auto & dep : it->second ) {
+                auto itd = index.find(dep);
+                if ( itd!=index.end() && itd->second<i && find(mt.deps.begin(),mt.deps.end(),itd->second)==mt.deps.end() ) {
+                    mt.deps.push_back(itd->second);
+                    mt.wave = das::max(mt.wave, times[itd->second].wave + 1);
+                }
+            }
+        }
+    }
+
+    // waves and the critical path are only known when require edges were recorded, otherwise it's just the list.
+    // modules are compiled one after another, the critical path is an estimate of what compiling each wave
+    // in parallel could get down to. nothing here runs in parallel
+    static void reportModuleTimes ( TextWriter & logs, vector<ModuleCompileTime> & times, int64_t mainT, bool withWaves ) {
+        if ( times.empty() ) return;
+        if ( !withWaves ) {
+            logs << "\tmodules  " << int32_t(times.size()) << "\n";
+            for ( auto & mt : times ) {
+                if ( !mt.total ) continue;
+                logs << "\t\t" << mt.moduleName << " " << (mt.total / 1000000.) << "\n";
+            }
+            return;
+        }
+        vector<int32_t> perWave;
+        int64_t sumT = 0, criticalT = 0;
+        for ( auto & mt : times ) {
+            mt.path = mt.total;
+            for ( auto dep : mt.deps ) {
+                mt.path = das::max(mt.path, times[dep].path + mt.total);
+            }
+            criticalT = das::max(criticalT, mt.path);
+            sumT += mt.total;
+            if ( mt.wave>=int32_t(perWave.size()) ) perWave.resize(mt.wave+1, 0);
+            perWave[mt.wave] ++;
+        }
+        int32_t widest = 0;
+        for ( auto w : perWave ) widest = das::max(widest, w);
+        logs << "\tmodules  " << int32_t(times.size()) << " in " << int32_t(perWave.size()) << " waves, widest " << widest << "\n"
+             << "\t\tsequential    " << ((sumT + mainT) / 1000000.) << "\n"
+             << "\t\tcritical path " << ((criticalT + mainT) / 1000000.) << "\n";
+        for ( auto & mt : times ) {
+            if ( !mt.total ) continue;      // shared, or already in the group
+            logs << "\t\t[" << mt.wave << "] " << mt.moduleName << " " << (mt.total / 1000000.)
+                 << " (parse " << (mt.parse / 1000000.)
+                 << ", infer " << (mt.infer / 1000000.)
+                 << ", optimize " << (mt.optimize / 1000000.)
+                 << ", macro mods " << (mt.macroMods / 1000000.) << ")\n";
+        }
+    }
+
     ProgramPtr compileDaScript ( const string & fileName,
                                 const FileAccessPtr & access,
                                 TextWriter & logs,
@@ -1060,6 +1147,11 @@ namespace das {
         das_set<string> dependencies;
         das_hash_map<string, NamelessModuleReq> namelessReq;
         vector<NamelessMismatch> namelessMismatches;
+        // require graph is only recorded for the compile time report. it is known before the main file is parsed,
+        // so the report of 'options log_total_compile_time' in the file itself comes without the waves
+        bool logWaves = policies.log_total_compile_time;
+        ModuleRequireEdges requireEdges;
+        RequireEdgesGuard edgesGuard(logWaves ? &requireEdges : nullptr);
         uint64_t preqT = 0;
         string modName;
         if ( getPrerequisits(fileName, access, modName, req, missing, circular, notAllowed, chain,
@@ -1095,11 +1187,22 @@ namespace das {
                     return res;
                 }
             }
-            for ( auto & mod : req ) {
+            vector<ModuleCompileTime> moduleTimes;
+            scheduleModules(req, requireEdges, moduleTimes);
+            for ( size_t mi=0, mis=req.size(); mi!=mis; ++mi ) {
+                auto & mod = req[mi];
                 if ( libGroup.findModule(mod.moduleName) ) {
                     continue;
                 }
+                auto & mt = moduleTimes[mi];
+                auto timeMod = ref_time_ticks();
+                auto parse0 = *totParse, infer0 = *totInfer, opt0 = *totOpt, macro0 = *totM;
                 auto program = parseDaScript(mod.fileName, mod.moduleName, access, logs, libGroup, true, true, policies);
+                mt.total = get_time_usec(timeMod);
+                mt.parse = *totParse - parse0;
+                mt.infer = *totInfer - infer0;
+                mt.optimize = *totOpt - opt0;
+                mt.macroMods = *totM - macro0;
                 policies.threadlock_context |= program->options.getBoolOption("threadlock_context",false);
                 if ( program->failed() ) {
                     return program;
@@ -1123,7 +1226,9 @@ namespace das {
             }
             auto & serializer_read = daScriptEnvironment::getBound()->serializer_read;
             if ( serializer_read && !policies.serialize_main_module ) serializer_read->seenNewModule = true;
+            auto timeMain = ref_time_ticks();
             auto res = parseDaScript(fileName, modName, access, logs, libGroup, exportAll, false, policies);
+            int64_t mainT = get_time_usec(timeMain);
             // wirteback all parsed modules from serializer_write
             if ( daScriptEnvironment::getBound()->serializer_write != nullptr
                 && (!daScriptEnvironment::getBound()->serializer_read || daScriptEnvironment::getBound()->serializer_read->failed) ) {
@@ -1185,6 +1290,7 @@ namespace das {
                      << "\tmacro    " << (ref_time_delta_to_usec(daScriptEnvironment::getBound()->macroTimeTicks)  / 1000000.) << "\n"
                      << "\tmacro mods " << (*totM     / 1000000.) << "\n"
                 ;
+                reportModuleTimes(logs, moduleTimes, mainT, logWaves);
             }
             return res;
         } else {
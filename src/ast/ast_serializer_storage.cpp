@@ -0,0 +1,105 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/ast/ast_serializer.h"
+
+#if defined(_MSC_VER) && !defined(_GAMING_XBOX) && !defined(_DURANGO)
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+    #define DAS_SERIALIZE_MAP_WINDOWS   1
+#elif (defined(__linux__) || defined(__APPLE__)) && !defined(__EMSCRIPTEN__)
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #define DAS_SERIALIZE_MAP_POSIX     1
+#endif
+
+namespace das {
+
+    SerializationStorageMapped::~SerializationStorageMapped() {
+        close();
+    }
+
+    bool SerializationStorageMapped::open ( const string & fileName ) {
+        close();
+#if DAS_SERIALIZE_MAP_WINDOWS
+        HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if ( file==INVALID_HANDLE_VALUE ) return false;
+        LARGE_INTEGER size;
+        if ( !GetFileSizeEx(file, &size) || size.QuadPart==0 ) {
+            CloseHandle(file);
+            return false;
+        }
+        HANDLE map = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if ( !map ) {
+            CloseHandle(file);
+            return false;
+        }
+        void * view = MapViewOfFile(map, FILE_MAP_READ, 0, 0, 0);
+        if ( !view ) {
+            CloseHandle(map);
+            CloseHandle(file);
+            return false;
+        }
+        fileHandle = file;
+        mappingHandle = map;
+        mapping = view;
+        mappingSize = size_t(size.QuadPart);
+#elif DAS_SERIALIZE_MAP_POSIX
+        int fd = ::open(fileName.c_str(), O_RDONLY);
+        if ( fd<0 ) return false;
+        struct stat st;
+        if ( fstat(fd, &st)!=0 || st.st_size==0 ) {
+            ::close(fd);
+            return false;
+        }
+        void * view = mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);    // the mapping keeps the file
+        if ( view==MAP_FAILED ) return false;
+        mapping = view;
+        mappingSize = size_t(st.st_size);
+#else
+        // no mapping on this platform, the file is read as a whole
+        FILE * f = fopen(fileName.c_str(), "rb");
+        if ( !f ) return false;
+        fseek(f, 0, SEEK_END);
+        long size = ftell(f);
+        fseek(f, 0, SEEK_SET);
+        bool ok = size > 0;
+        if ( ok ) {
+            buffer.resize(size_t(size));
+            ok = fread(buffer.data(), 1, size_t(size), f)==size_t(size);
+        }
+        fclose(f);
+        if ( !ok ) {
+            buffer.clear();
+            return false;
+        }
+        bufferPos = 0;
+        return true;
+#endif
+        mappedData = (const uint8_t *) mapping;
+        mappedSize = mappingSize;
+        bufferPos = 0;
+        return true;
+    }
+
+    void SerializationStorageMapped::close() {
+        if ( mapping ) {
+#if DAS_SERIALIZE_MAP_WINDOWS
+            UnmapViewOfFile(mapping);
+            CloseHandle((HANDLE)mappingHandle);
+            CloseHandle((HANDLE)fileHandle);
+            mappingHandle = fileHandle = nullptr;
+#elif DAS_SERIALIZE_MAP_POSIX
+            munmap(mapping, mappingSize);
+#endif
+        }
+        mapping = nullptr;
+        mappingSize = 0;
+        mappedData = nullptr;
+        mappedSize = 0;
+        buffer.clear();
+        bufferPos = 0;
+    }
+}
@@ -1593,7 +1593,13 @@ namespace das
             auto prv = subexpr->simulate(context);
             auto pidx = index->simulate(context);
             uint32_t stride = subexpr->type->firstType->getSizeOf();
-            if ( r2vType->baseType!=Type::none ) {
+            if ( no_bounds_check ) {
+                if ( r2vType->baseType!=Type::none ) {
+                    return context.code->makeValueNode<SimNode_ArrayAtUncheckedR2V>(r2vType->getR2VType(), at, prv, pidx, stride, extraOffset);
+                } else {
+                    return context.code->makeNode<SimNode_ArrayAtUnchecked>(at, prv, pidx, stride, extraOffset);
+                }
+            } else if ( r2vType->baseType!=Type::none ) {
                 return context.code->makeValueNode<SimNode_ArrayAtR2V>(r2vType->getR2VType(), at, prv, pidx, stride, extraOffset);
             } else {
                 return context.code->makeNode<SimNode_ArrayAt>(at, prv, pidx, stride, extraOffset);
@@ -3082,6 +3088,8 @@ namespace das
             }
             context.tabMnLookup->insert({mnh, context.functions + fn->index});
         }
+        std::atomic_store(&context.tabNameLookup, shared_ptr<das_hash_map<uint64_t,int32_t>>());
+        context.getNameLookup();
         if ( options.getBoolOption("log_mn_hash",false) ) {
             logs
                 << "totalFunctions: " << context.totalFunctions << "\n"
@@ -3179,6 +3187,8 @@ namespace das
         context.breakOnException |= policies.debugger;
         context.persistent = options.getBoolOption("persistent_heap", policies.persistent_heap);
         context.gcEnabled = options.getBoolOption("gc", false);
+        context.gcMarkWorkers = options.getIntOption("gc_mark_workers", 0);
+        context.gcPageWatch = options.getBoolOption("gc_page_watch", false);
         if ( context.persistent ) {
             context.heap = make_smart<PersistentHeapAllocator>();
             context.stringHeap = make_smart<PersistentStringAllocator>();
@@ -3186,6 +3196,9 @@ namespace das
             context.heap = make_smart<LinearHeapAllocator>();
             context.stringHeap = make_smart<LinearStringAllocator>();
         }
+        if ( options.getBoolOption("heap_free_lists", false) ) {
+            context.heap->setFreeListMode(true, options.getBoolOption("heap_huge_pages", false));
+        }
         context.heap->setInitialSize ( options.getIntOption("heap_size_hint", policies.heap_size_hint) );
         context.heap->setLimit ( options.getUInt64OptionEx("heap_size_limit", "max_heap_allocated", policies.max_heap_allocated) );
         context.stringHeap->setInitialSize ( options.getIntOption("string_heap_size_hint", policies.string_heap_size_hint) );
@@ -3356,6 +3369,9 @@ namespace das
         }
         context.failed = false;
         bool aot_hint = policies.aot && !folding && !thisModule->isModule;
+        if ( !folding ) {
+            bytecode(context, logs);
+        }
 #if DAS_FUSION
         if ( !folding ) {               // note: only run fusion when not folding
             fusion(context, logs);
@@ -3480,7 +3496,7 @@ namespace das
         // lockchecking
         context.skipLockChecks = options.getBoolOption("skip_lock_checks",false);
         // run init script and restart
-        if ( !folding ) {
+        if ( !folding && !skipInitScript ) {
             auto time1 = ref_time_ticks();
             bool initScriptSuccess;
             if ( context.stack.size() && context.stack.size()>globalInitStackSize ) {
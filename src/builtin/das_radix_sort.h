@@ -0,0 +1,117 @@
+#pragma once
+
+namespace das
+{
+
+// LSD radix sort, 8 bits per pass. keys are mapped to unsigned integers, which sort in the same order
+// signed integers flip the sign bit, floating point numbers flip the sign bit of positive ones and all bits of negative ones
+
+template <typename TT> struct RadixKey;
+
+template <> struct RadixKey<int32_t> {
+    typedef uint32_t KeyType;
+    static __forceinline uint32_t key ( int32_t x ) { return uint32_t(x) ^ 0x80000000u; }
+};
+
+template <> struct RadixKey<uint32_t> {
+    typedef uint32_t KeyType;
+    static __forceinline uint32_t key ( uint32_t x ) { return x; }
+};
+
+template <> struct RadixKey<int64_t> {
+    typedef uint64_t KeyType;
+    static __forceinline uint64_t key ( int64_t x ) { return uint64_t(x) ^ 0x8000000000000000ull; }
+};
+
+template <> struct RadixKey<uint64_t> {
+    typedef uint64_t KeyType;
+    static __forceinline uint64_t key ( uint64_t x ) { return x; }
+};
+
+template <> struct RadixKey<float> {
+    typedef uint32_t KeyType;
+    static __forceinline uint32_t key ( float x ) {
+        uint32_t bits; memcpy(&bits, &x, sizeof(bits));
+        return bits ^ ((bits & 0x80000000u) ? 0xffffffffu : 0x80000000u);
+    }
+};
+
+template <> struct RadixKey<double> {
+    typedef uint64_t KeyType;
+    static __forceinline uint64_t key ( double x ) {
+        uint64_t bits; memcpy(&bits, &x, sizeof(bits));
+        return bits ^ ((bits & 0x8000000000000000ull) ? 0xffffffffffffffffull : 0x8000000000000000ull);
+    }
+};
+
+// sorts data, temp has to be of the same length. result ends up in data. sort is stable
+template <typename TT, typename KeyFn>
+void das_radix_sort ( TT * data, TT * temp, int32_t length, KeyFn && keyOf ) {
+    typedef decltype(keyOf(*data)) KeyType;
+    const int passes = int(sizeof(KeyType));
+    uint32_t counts[sizeof(KeyType)][256];
+    memset(counts, 0, sizeof(counts));
+    for ( int32_t i=0; i!=length; ++i ) {
+        KeyType k = keyOf(data[i]);
+        for ( int p=0; p!=passes; ++p ) {
+            counts[p][(k >> (p*8)) & 0xff] ++;
+        }
+    }
+    TT * src = data;
+    TT * dst = temp;
+    for ( int p=0; p!=passes; ++p ) {
+        auto & cnt = counts[p];
+        if ( cnt[(keyOf(src[0]) >> (p*8)) & 0xff]==uint32_t(length) ) continue;   // every key has the same digit
+        uint32_t offset = 0;
+        for ( int d=0; d!=256; ++d ) {
+            uint32_t c = cnt[d];
+            cnt[d] = offset;
+            offset += c;
+        }
+        for ( int32_t i=0; i!=length; ++i ) {
+            dst[cnt[(keyOf(src[i]) >> (p*8)) & 0xff]++] = src[i];
+        }
+        swap(src, dst);
+    }
+    if ( src!=data ) {
+        memcpy(data, src, size_t(length)*sizeof(TT));
+    }
+}
+
+template <typename TT>
+void das_radix_sort ( TT * data, TT * temp, int32_t length ) {
+    das_radix_sort(data, temp, length, [](const TT & x) { return RadixKey<TT>::key(x); });
+}
+
+// chunks are sorted by sortChunk on the job que, then merged pairwise, one round at a time
+template <typename TT, typename SortChunk, typename Less>
+void das_parallel_merge_sort ( JobQue & jq, TT * data, TT * temp, int32_t length, int32_t chunks, SortChunk && sortChunk, Less && less ) {
+    vector<int32_t> bounds(chunks + 1);
+    for ( int32_t i=0; i<=chunks; ++i ) {
+        bounds[i] = int32_t(int64_t(length) * i / chunks);
+    }
+    jq.parallel_for(0, chunks, [&]( int i0, int i1 ) {
+        for ( int i=i0; i<i1 && i<chunks; ++i ) {
+            sortChunk(data + bounds[i], temp + bounds[i], bounds[i+1] - bounds[i]);
+        }
+    }, 0, JobPriority::Default, chunks);
+    TT * src = data;
+    TT * dst = temp;
+    for ( int32_t width=1; width<chunks; width*=2 ) {
+        int32_t pairs = (chunks + width*2 - 1) / (width*2);
+        jq.parallel_for(0, pairs, [&]( int i0, int i1 ) {
+            for ( int i=i0; i<i1 && i<pairs; ++i ) {
+                int32_t lo = bounds[i*width*2];
+                int32_t mid = bounds[min(i*width*2 + width, chunks)];
+                int32_t hi = bounds[min(i*width*2 + width*2, chunks)];
+                merge(src + lo, src + mid, src + mid, src + hi, dst + lo, less);
+            }
+        }, 0, JobPriority::Default, pairs);
+        swap(src, dst);
+    }
+    if ( src!=data ) {
+        memcpy(data, src, size_t(length)*sizeof(TT));
+    }
+}
+
+}
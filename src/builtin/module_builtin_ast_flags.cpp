@@ -65,7 +65,7 @@ namespace das {
     TypeDeclPtr makeExprAtFlags() {
         auto ft = make_smart<TypeDecl>(Type::tBitfield);
         ft->alias = "ExprAtFlags";
-        ft->argNames = { "r2v", "r2cr", "write", "no_promotion" };
+        ft->argNames = { "r2v", "r2cr", "write", "no_promotion", "no_bounds_check" };
         return ft;
     }
 
@@ -202,7 +202,7 @@ namespace das {
             "addressTaken", "propertyFunction", "pinvoke", "jitOnly", "isStaticClassMethod", "requestNoJit",
             "jitContextAndLineInfo", "nodiscard", "captureString", "callCaptureString", "hasStringBuilder",
             "recursive", "isTemplate", "unsafeWhenNotCloneArray", "stub", "lateShutdown", "hasTryRecover",
-            "hasUnsafe"
+            "hasUnsafe", "lazyBody"
         };
         return ft;
     }
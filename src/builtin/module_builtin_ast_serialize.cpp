@@ -121,6 +121,7 @@ namespace das {
             *field = struct_.front()->findFieldRef(fieldname);
         }
         fieldRefs.clear();
+        lazySkipped.clear();
     }
 
     void AstSerializer::write ( const void * data, size_t size ) {
@@ -578,6 +579,31 @@ namespace das {
         }
         uint64_t id = intptr_t(type.get());
         *this << id;
+        if ( lazyScope ) {
+            auto it = smartTypeDeclMap.find(id);
+            bool known = it != smartTypeDeclMap.end() && it->second;
+            if ( writing ) {
+                bool full = !known && lazyScope->seen.insert(id).second;
+                *this << full;
+                if ( full ) type->serialize(*this);
+            } else {
+                bool full = false; *this << full;
+                if ( full && !known ) {
+                    type = make_smart<TypeDecl>();
+                    smartTypeDeclMap[id] = type;
+                    type->serialize(*this);
+                } else if ( full ) {
+                    auto copy = make_smart<TypeDecl>();
+                    lazySkipped.push_back(copy);
+                    copy->serialize(*this);
+                    type = smartTypeDeclMap[id];
+                } else {
+                    SERIALIZER_VERIFYF(known, "type is not found");
+                    type = it->second;
+                }
+            }
+            return *this;
+        }
         if ( writing ) {
             if ( smartTypeDeclMap[id] == nullptr ) {
                 smartTypeDeclMap[id] = type;
@@ -717,7 +743,19 @@ namespace das {
             if ( !writing ) { info = nullptr; }
             return *this;
         }
-        if ( writing ) {
+        if ( writing && lazyScope ) {
+            auto it = writingFileInfoMap.find(info);
+            if ( it != writingFileInfoMap.end() && it->second ) {
+                *this << it->second;
+            } else if ( auto lit = lazyScope->fileInfos.find(info); lit != lazyScope->fileInfos.end() ) {
+                *this << lit->second;
+            } else {
+                uint64_t curOffset = buffer->writingSize() + sizeof(curOffset);
+                *this << curOffset;
+                lazyScope->fileInfos[info] = curOffset;
+                info->serialize(*this);
+            }
+        } else if ( writing ) {
             if ( writingFileInfoMap[info] == 0 ) {
                 uint64_t curOffset = buffer->writingSize() + sizeof(curOffset);
                 *this << curOffset;
@@ -826,6 +864,31 @@ namespace das {
             if ( !writing ) obj = nullptr;
             return;
         }
+        if ( lazyScope ) {
+            auto it = objMap.find(id);
+            bool known = it != objMap.end();
+            if ( writing ) {
+                bool full = !known && lazyScope->seen.insert(id).second;
+                *this << full;
+                if ( full ) obj->serialize(*this);
+            } else {
+                bool full = false; *this << full;
+                if ( full && !known ) {
+                    obj = make_smart<T>();
+                    objMap[id] = obj;
+                    obj->serialize(*this);
+                } else if ( full ) {
+                    auto copy = make_smart<T>();
+                    lazySkipped.push_back(copy);
+                    copy->serialize(*this);
+                    obj = objMap[id];
+                } else {
+                    SERIALIZER_VERIFYF(known, "object is not found");
+                    obj = it->second;
+                }
+            }
+            return;
+        }
         if ( writing ) {
             if ( objMap.find(id) == objMap.end() ) {
                 objMap[id] = obj;
@@ -1229,7 +1292,7 @@ namespace das {
         ser << arguments;
         ser.ignoreEmptyExternal = false;
         ser << result;
-        ser << body;
+        ser.serializeLazyBody(this);
         ser << classParent;
         //ser << fromGeneric;
         ser << index         << totalStackSize  << totalGenLabel;
@@ -1237,6 +1300,108 @@ namespace das {
         ser << hash          << aotHash;  // do not serialize inferStack
         ser << resultAliases << argumentAliases << resultAliasesGlobals;
         ser << flags         << moreFlags       << sideEffectFlags;
+        if ( !ser.writing ) {
+            lazyBody = ser.lazyBodies.find(this) != ser.lazyBodies.end();
+        }
+    }
+
+    // lazy bodies go to a section of their own, which can be skipped when reading
+    struct SerializationStorageSection : SerializationStorageVector {
+        size_t base = 0;
+        virtual size_t writingSize() const override {
+            return base + buffer.size();
+        }
+    };
+
+    void AstSerializer::serializeLazyBody ( Function * func ) {
+        if ( writing ) {
+            bool lazy = lazyFunctions && !lazyScope && func->body && !func->used && func->annotations.empty();
+            *this << lazy;
+            if ( !lazy ) {
+                *this << func->body;
+                return;
+            }
+            auto outer = buffer;
+            SerializationStorageSection section;
+            section.base = outer->writingSize() + sizeof(uint64_t);
+            AstSerializerLazyScope scope;
+            buffer = &section;
+            lazyScope = &scope;
+            try {
+                *this << func->body;
+            } catch ( ... ) {
+                buffer = outer;
+                lazyScope = nullptr;
+                throw;
+            }
+            buffer = outer;
+            lazyScope = nullptr;
+            uint64_t size = section.buffer.size();
+            *this << size;
+            write(section.buffer.data(), size);
+        } else {
+            bool lazy = false;
+            *this << lazy;
+            if ( !lazy ) {
+                *this << func->body;
+                return;
+            }
+            uint64_t size = 0;
+            *this << size;
+            if ( lazyFunctionBodies ) {
+                lazyBodies[func] = make_pair(uint64_t(buffer->bufferPos), size);
+                SERIALIZER_VERIFYF(buffer->skip(size), "ast serializer read overflow");
+            } else {
+                auto offset = buffer->bufferPos;
+                readLazyBody(func);
+                SERIALIZER_VERIFYF(buffer->bufferPos == offset + size, "unexpected size of the function body");
+            }
+        }
+    }
+
+    void AstSerializer::readLazyBody ( Function * func ) {
+        AstSerializerLazyScope scope;
+        lazyScope = &scope;
+        try {
+            *this << func->body;
+        } catch ( ... ) {
+            lazyScope = nullptr;
+            throw;
+        }
+        lazyScope = nullptr;
+    }
+
+    bool AstSerializer::materializeFunctionBody ( Function * func ) {
+        auto it = lazyBodies.find(func);
+        if ( it == lazyBodies.end() ) return false;
+        auto offset = it->second.first;
+        auto size = it->second.second;
+        lazyBodies.erase(it);
+        auto savedPos = buffer->bufferPos;
+        auto savedModule = thisModule;
+        buffer->bufferPos = size_t(offset);
+        thisModule = func->module;
+        bool ok = true;
+        try {
+            readLazyBody(func);
+            SERIALIZER_VERIFYF(buffer->bufferPos == offset + size, "unexpected size of the function body");
+            patch();
+            func->lazyBody = false;
+        } catch ( const std::runtime_error & r ) {
+            LOG(LogLevel::error) << "das: serialize: " << r.what() << "\n";
+            blockRefs.clear();
+            functionRefs.clear();
+            variableRefs.clear();
+            structureRefs.clear();
+            enumerationRefs.clear();
+            fieldRefs.clear();
+            lazySkipped.clear();
+            func->body = nullptr;
+            ok = false;
+        }
+        buffer->bufferPos = savedPos;
+        thisModule = savedModule;
+        return ok;
     }
 
 // Expressions
@@ -2068,7 +2233,10 @@ namespace das {
         ser << typeFunctions;
         serializeGlobals(ser, globals); // globals require insertion in the same order
         serializeStructures(ser, structures);
+        // bodies of library functions, which are not called, can be loaded later
+        ser.lazyFunctions = ser.writing && ser.lazyFunctionBodies && !builtIn && !macroContext && this != ser.lazyMainModule;
         serializeFunctions(ser, functions);
+        ser.lazyFunctions = false;
         if ( ser.failed ) return;
         serializeFunctions(ser, generics);
         if ( ser.failed ) return;
@@ -2219,6 +2387,12 @@ namespace das {
               << value.scoped_stack_allocator
               << value.force_inscope_pod
               << value.log_inscope_pod
+              << value.inline_functions
+              << value.inline_max_cost
+              << value.loop_invariant_motion
+              << value.common_subexpressions
+              << value.bounds_check_elimination
+              << value.bytecode
               << value.debugger
               << value.debug_module
               << value.profiler
@@ -2326,7 +2500,7 @@ namespace das {
     }
 
     uint32_t AstSerializer::getVersion () {
-        static constexpr uint32_t currentVersion = 73;
+        static constexpr uint32_t currentVersion = 78;
         return currentVersion;
     }
 
@@ -2354,7 +2528,9 @@ namespace das {
 
     // serialize library
         if ( ser.writing ) {
+            materializeFunctions();
             ser.moduleLibrary = &library;
+            ser.lazyMainModule = thisModule.get();
             TopSort ts(library.modules);
             auto modules = ts.getDependecyOrdered();
 
@@ -2453,9 +2629,37 @@ namespace das {
 
     // for the last module, mark symbols manually
         markExecutableSymbolUse();
+    // functions which are going to run need their bodies right away, the rest stays in the image
+        vector<Function *> usedLazy;
+        for ( auto & it : ser.lazyBodies ) {
+            if ( it.first->used ) usedLazy.push_back(it.first);
+        }
+        for ( auto func : usedLazy ) {
+            SERIALIZER_VERIFYF(ser.materializeFunctionBody(func), "failed to load function '%s'", func->name.c_str());
+        }
         removeUnusedSymbols();
         TextWriter logs;
         allocateStack(logs,true,false);
     }
 
+    bool Program::materializeFunction ( Function * func ) {
+        if ( !func->lazyBody ) return true;
+        if ( !lazyImage ) return false;
+        lazyImage->moduleLibrary = &library;
+        bool ok = lazyImage->materializeFunctionBody(func);
+        lazyImage->moduleLibrary = nullptr;
+        return ok;
+    }
+
+    void Program::materializeFunctions () {
+        if ( !lazyImage ) return;
+        vector<Function *> pending;
+        for ( auto & it : lazyImage->lazyBodies ) {
+            pending.push_back(it.first);
+        }
+        for ( auto func : pending ) {
+            materializeFunction(func);
+        }
+    }
+
 }
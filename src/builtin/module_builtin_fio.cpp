@@ -149,6 +149,7 @@ namespace das {
     bool builtin_stat ( const char * filename, FStat & fs ) GENERATE_IO_STUB_RET
     bool builtin_chdir ( const char * path ) GENERATE_IO_STUB_RET
     bool builtin_mkdir ( const char * path ) GENERATE_IO_STUB_RET
+    bool builtin_rmdir ( const char * path ) GENERATE_IO_STUB_RET
     void builtin_exit ( int32_t ec ) GENERATE_IO_STUB
     bool builtin_remove_file ( const char * path ) GENERATE_IO_STUB_RET
     bool builtin_rename_file ( const char * old_path, const char * new_path ) GENERATE_IO_STUB_RET
@@ -496,6 +497,18 @@ namespace das {
         }
     }
 
+    bool builtin_rmdir ( const char * path ) {
+        if ( path ) {
+#if defined(_MSC_VER)
+            return _rmdir(path) == 0;
+#else
+            return rmdir(path) == 0;
+#endif
+        } else {
+            return false;
+        }
+    }
+
     void builtin_exit ( int32_t ec ) {
         exit(ec);
     }
@@ -680,6 +693,9 @@ namespace das {
             addExtern<DAS_BIND_FUN(builtin_mkdir)>(*this, lib, "mkdir",
                 SideEffects::modifyExternal, "builtin_mkdir")
                     ->arg("path");
+            addExtern<DAS_BIND_FUN(builtin_rmdir)>(*this, lib, "rmdir",
+                SideEffects::modifyExternal, "builtin_rmdir")
+                    ->arg("path");
             addExtern<DAS_BIND_FUN(builtin_chdir)>(*this, lib, "chdir",
                 SideEffects::modifyExternal, "builtin_chdir")
                     ->arg("path");
@@ -4,6 +4,7 @@
 #include "daScript/simulate/aot_builtin_jobque.h"
 #include "daScript/ast/ast.h"
 #include "daScript/ast/ast_handle.h"
+#include "daScript/simulate/bind_enum.h"
 
 #include "daScript/misc/job_que.h"
 #include "module_builtin_rtti.h"
@@ -15,6 +16,8 @@ MAKE_TYPE_FACTORY(LockBox, LockBox)
 MAKE_TYPE_FACTORY(Atomic32, AtomicTT<int32_t>)
 MAKE_TYPE_FACTORY(Atomic64, AtomicTT<int64_t>)
 
+DAS_BASE_BIND_ENUM(das::JobPriority, JobPriority, Minimum, Low, Medium, High, Maximum)
+
 namespace das {
 
     template <typename TT>
@@ -65,15 +68,147 @@ namespace das {
         DAS_ASSERT(mRef==0);
     }
 
+    FeatureRing::FeatureRing ( uint32_t cap ) {
+        uint32_t size = 2;
+        while ( size < cap ) size <<= 1;
+        mask = size - 1;
+        limit = cap;
+        cells.reset(new Cell[size]);
+        for ( uint32_t i=0; i!=size; ++i ) {
+            cells[i].sequence.store(i, memory_order_relaxed);
+        }
+    }
+
+    bool FeatureRing::tryPush ( Feature & f ) {
+        shared_lock<shared_mutex> guard(walkLock);
+        if ( count.fetch_add(1, memory_order_relaxed) >= int32_t(limit) ) {
+            count.fetch_sub(1, memory_order_relaxed);
+            return false;   // requested capacity is reached, even if there are free cells
+        }
+        Cell * cell;
+        size_t pos = enqueuePos.load(memory_order_relaxed);
+        for ( ;; ) {
+            cell = &cells[pos & mask];
+            size_t seq = cell->sequence.load(memory_order_acquire);
+            intptr_t dif = intptr_t(seq) - intptr_t(pos);
+            if ( dif==0 ) {
+                if ( enqueuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed) ) break;
+            } else if ( dif < 0 ) {
+                count.fetch_sub(1, memory_order_relaxed);
+                return false;   // full
+            } else {
+                pos = enqueuePos.load(memory_order_relaxed);
+            }
+        }
+        cell->data = das::move(f);
+        cell->sequence.store(pos + 1, memory_order_release);
+        return true;
+    }
+
+    bool FeatureRing::tryPop ( Feature & f ) {
+        shared_lock<shared_mutex> guard(walkLock);
+        Cell * cell;
+        size_t pos = dequeuePos.load(memory_order_relaxed);
+        for ( ;; ) {
+            cell = &cells[pos & mask];
+            size_t seq = cell->sequence.load(memory_order_acquire);
+            intptr_t dif = intptr_t(seq) - intptr_t(pos + 1);
+            if ( dif==0 ) {
+                if ( dequeuePos.compare_exchange_weak(pos, pos + 1, memory_order_relaxed) ) break;
+            } else if ( dif < 0 ) {
+                return false;   // empty
+            } else {
+                pos = dequeuePos.load(memory_order_relaxed);
+            }
+        }
+        f = das::move(cell->data);
+        cell->data.clear();
+        cell->sequence.store(pos + mask + 1, memory_order_release);
+        count.fetch_sub(1, memory_order_relaxed);
+        return true;
+    }
+
+    void Channel::wakeRingWaiters() {
+        // waiters sleep on mCond, we only take the lock when someone is there
+        if ( mRingWaiters ) {
+            lock_guard<mutex> guard(mCompleteMutex);
+            mCond.notify_all();
+        }
+    }
+
+    void Channel::pushRing ( Feature & f ) {
+        while ( !ring->tryPush(f) ) {
+            unique_lock<mutex> uguard(mCompleteMutex);
+            mRingWaiters++;
+            mCond.wait_for(uguard, chrono::milliseconds(mSleepMs), [&]() {
+                return ring->approxSize() < ring->capacity();
+            });
+            mRingWaiters--;
+        }
+    }
+
+    bool Channel::popRing ( Feature & f ) {
+        for ( ;; ) {
+            if ( ring->tryPop(f) ) return true;
+            unique_lock<mutex> uguard(mCompleteMutex);
+            if ( mRemaining==0 ) {
+                uguard.unlock();
+                return ring->tryPop(f);
+            }
+            mRingWaiters++;
+            mCond.wait_for(uguard, chrono::milliseconds(mSleepMs), [&]() {
+                return ring->approxSize()!=0 || mRemaining==0;
+            });
+            mRingWaiters--;
+        }
+    }
+
+    bool Channel::tryForward ( Feature & f ) {
+        if ( ring ) {
+            if ( !ring->tryPush(f) ) return false;
+            wakeRingWaiters();
+        } else {
+            lock_guard<mutex> guard(mCompleteMutex);
+            pipe.emplace_back(das::move(f));
+            mCond.notify_all();
+        }
+        return true;
+    }
+
+    bool Channel::tryPush ( void * data, TypeInfo * ti, Context * context ) {
+        if ( !ring ) {
+            push(data, ti, context);
+            return true;
+        }
+        Feature f(data, ti, context!=owner ? context : nullptr);
+        if ( !ring->tryPush(f) ) return false;
+        wakeRingWaiters();
+        return true;
+    }
+
     void Channel::push ( void * data, TypeInfo * ti, Context * context ) {
+        if ( ring ) {
+            Feature f(data, ti, context!=owner ? context : nullptr);
+            pushRing(f);
+            wakeRingWaiters();
+            return;
+        }
         lock_guard<mutex> guard(mCompleteMutex);
         pipe.emplace_back(data, ti, context!=owner ? context : nullptr);
         mCond.notify_all();  // notify_one??
     }
 
     void Channel::pushBatch ( void ** data, int count, TypeInfo * ti, Context * context ) {
-        lock_guard<mutex> guard(mCompleteMutex);
         auto pushCtx = context!=owner ? context : nullptr;
+        if ( ring ) {
+            for ( int i=0; i!=count; ++i ) {
+                Feature f(data[i], ti, pushCtx);
+                pushRing(f);
+                wakeRingWaiters();
+            }
+            return;
+        }
+        lock_guard<mutex> guard(mCompleteMutex);
         for ( int i=0; i!=count; ++i ) {
             pipe.emplace_back(data[i], ti, pushCtx);
         }
@@ -81,6 +216,14 @@ namespace das {
     }
 
     void Channel::pop ( const TBlock<void,void *> & blk, Context * context, LineInfoArg * at ) {
+        if ( ring ) {
+            // local feature keeps the source context alive while the block runs, no lock is held
+            Feature f;
+            popRing(f);
+            wakeRingWaiters();
+            das_invoke<void>::invoke<void *>(context, at, blk, f.data);
+            return;
+        }
         while ( true ) {
             unique_lock<mutex> uguard(mCompleteMutex);
             if ( !mCond.wait_for(uguard, chrono::milliseconds(mSleepMs), [&]() {
@@ -102,7 +245,40 @@ namespace das {
         das_invoke<void>::invoke<void *>(context, at, blk, tail.data);
     }
 
+    int Channel::popBatch ( int maxCount, const TBlock<void,void *> & blk, Context * context, LineInfoArg * at ) {
+        // waits for the first item like pop does, then takes whatever else is there (up to maxCount) without waiting
+        vector<Feature> items;
+        if ( ring ) {
+            Feature f;
+            if ( popRing(f) ) {
+                items.emplace_back(das::move(f));
+                while ( int(items.size()) < maxCount && ring->tryPop(f) ) {
+                    items.emplace_back(das::move(f));
+                }
+                wakeRingWaiters();
+            }
+        } else {
+            unique_lock<mutex> uguard(mCompleteMutex);
+            while ( mRemaining>0 && pipe.empty() ) {
+                if ( !mCond.wait_for(uguard, chrono::milliseconds(mSleepMs), [&]() { return !((mRemaining>0) && pipe.empty()); }) ) {
+                    uguard.unlock();
+                    this_thread::yield();
+                    uguard.lock();
+                }
+            }
+            while ( int(items.size()) < maxCount && !pipe.empty() ) {
+                items.emplace_back(das::move(pipe.front()));
+                pipe.pop_front();
+            }
+        }
+        for ( auto & f : items ) {
+            das_invoke<void>::invoke<void *>(context, at, blk, f.data);
+        }
+        return int(items.size());
+    }
+
     bool Channel::isEmpty() const {
+        if ( ring ) return ring->approxSize()==0;
         lock_guard<mutex> guard(mCompleteMutex);
         return pipe.empty();
     }
@@ -113,6 +289,7 @@ namespace das {
     }
 
     int32_t Channel::total() const {
+        if ( ring ) return int32_t(ring->approxSize());
         lock_guard<mutex> guard(mCompleteMutex);
         return (int32_t) pipe.size();
     }
@@ -132,16 +309,18 @@ namespace das {
 
     void channelGatherEx ( Channel * ch, const TBlock<void,void *,const TypeInfo *, Context &> & blk, Context * context, LineInfoArg * at ) {
         if ( !ch ) context->throw_error_at(at, "channelGather: channel is null");
-        ch->gatherEx(context, [&](void * data, TypeInfo * tinfo, Context * ctx) {
+        bool fits = ch->gatherEx(context, [&](void * data, TypeInfo * tinfo, Context * ctx) {
             das_invoke<void>::invoke<void *,const TypeInfo *,Context &>(context, at, blk, data, tinfo, *ctx);
         });
+        if ( !fits ) context->throw_error_at(at, "channelGatherEx: bounded channel is full, features of other contexts are lost");
     }
 
     void channelGatherAndForward ( Channel * ch, Channel * toCh, const TBlock<void,void *> & blk, Context * context, LineInfoArg * at ) {
         if ( !ch ) context->throw_error_at(at, "channelGather: channel is null");
-        ch->gather_and_forward(toCh, [&](void * data, TypeInfo *, Context *) {
+        bool fits = ch->gather_and_forward(toCh, [&](void * data, TypeInfo *, Context *) {
             das_invoke<void>::invoke<void *>(context, at, blk, data);
         });
+        if ( !fits ) context->throw_error_at(at, "channelGatherAndForward: bounded target channel is full, features are lost");
     }
 
     void channelPeek ( Channel * ch, const TBlock<void,void *> & blk, Context * context, LineInfoArg * at ) {
@@ -189,11 +368,25 @@ namespace das {
         return v_zero();
     }
 
+    vec4f channelTryPush ( Context & context, SimNode_CallBase * call, vec4f * args ) {
+        auto ch = cast<Channel *>::to(args[0]);
+        if ( !ch ) context.throw_error_at(call->debugInfo, "channelTryPush: channel is null");
+        void * data = cast<void *>::to(args[1]);
+        TypeInfo * ti = call->types[1];
+        return cast<bool>::from(ch->tryPush(data, ti, &context));
+    }
+
     void channelPop ( Channel * ch, const TBlock<void,void*> & blk, Context * context, LineInfoArg * at ) {
         if ( !ch ) context->throw_error_at(at, "channelPop: channel is null");
         ch->pop(blk,context,at);
     }
 
+    int32_t channelPopBatch ( Channel * ch, int32_t maxCount, const TBlock<void,void*> & blk, Context * context, LineInfoArg * at ) {
+        if ( !ch ) context->throw_error_at(at, "channelPopBatch: channel is null");
+        if ( maxCount<=0 ) context->throw_error_at(at, "channelPopBatch: maxCount must be positive");
+        return ch->popBatch(maxCount,blk,context,at);
+    }
+
     int jobAppend ( JobStatus * ch, int size, Context * context, LineInfoArg * at ) {
         if ( !ch ) context->throw_error_at(at, "jobAppend: job is null");
         return ch->append(size);
@@ -210,12 +403,26 @@ namespace das {
         das_invoke<void>::invoke<Channel *>(context, at, blk, &ch);
     }
 
+    void withBoundedChannel ( int32_t count, int32_t capacity, const TBlock<void,Channel *> & blk, Context * context, LineInfoArg * at ) {
+        if ( capacity<=0 ) context->throw_error_at(at, "bounded channel capacity must be positive");
+        Channel ch(context,count,uint32_t(capacity));
+        AddReleaseGuard<Channel> guard(&ch, context, at);
+        das_invoke<void>::invoke<Channel *>(context, at, blk, &ch);
+    }
+
     Channel * channelCreate( Context * context, LineInfoArg * ) {
         Channel * ch = new Channel(context);
         ch->addRef();
         return ch;
     }
 
+    Channel * channelCreateBounded( int32_t capacity, Context * context, LineInfoArg * at ) {
+        if ( capacity<=0 ) context->throw_error_at(at, "bounded channel capacity must be positive");
+        Channel * ch = new Channel(context,0,uint32_t(capacity));
+        ch->addRef();
+        return ch;
+    }
+
     void channelRemove( Channel * & ch, Context * context, LineInfoArg * at ) {
         if (!ch->isValid()) context->throw_error_at(at, "channel is invalid (already deleted?)");
         if (ch->releaseRef()) context->throw_error_at(at, "channel beeing deleted while being used");
@@ -229,6 +436,8 @@ namespace das {
             addProperty<DAS_BIND_MANAGED_PROP(isReady)>("isReady");
             addProperty<DAS_BIND_MANAGED_PROP(size)>("size");
             addProperty<DAS_BIND_MANAGED_PROP(total)>("total");
+            addProperty<DAS_BIND_MANAGED_PROP(isBounded)>("isBounded");
+            addProperty<DAS_BIND_MANAGED_PROP(capacity)>("capacity");
         }
         virtual int32_t getGcFlags(das_set<Structure *> &, das_set<Annotation *> &) const override {
             return TypeDecl::gcFlag_heap | TypeDecl::gcFlag_stringHeap;
@@ -344,10 +553,119 @@ das::Context* get_clone_context( das::Context * ctx, uint32_t category );//link
 
 namespace das {
 
+    JobContextPool::JobContextPool ( Context * ctx ) {
+        capacity = uint32_t(JobQue::get_num_threads()) * 2;
+        // finalizers run once per clone, we can't recycle contexts which have them
+        for ( int i=0, is=ctx->getTotalFunctions(); i!=is; ++i ) {
+            auto fn = ctx->getFunction(i);
+            if ( fn && fn->debugInfo && (fn->debugInfo->flags & FuncInfo::flag_shutdown) ) {
+                canReuse = false;
+                break;
+            }
+        }
+    }
+
+    JobContextPool::~JobContextPool() {
+        lock_guard<mutex> guard(mMutex);
+        idle.clear();
+    }
+
+    uint32_t JobContextPool::size() const {
+        lock_guard<mutex> guard(mMutex);
+        return uint32_t(idle.size());
+    }
+
+    void JobContextPool::setCapacity ( uint32_t cap ) {
+        lock_guard<mutex> guard(mMutex);
+        capacity = cap;
+        if ( idle.size() > capacity ) {
+            discarded += idle.size() - capacity;
+            idle.resize(capacity);
+        }
+    }
+
+    static bool rawPodGlobals ( Context * ctx ) {
+        auto gbegin = ctx->globals, gend = ctx->globals + ctx->getGlobalSize();
+        for ( int i=0, is=ctx->getTotalVariables(); i!=is; ++i ) {
+            auto pv = (char *) ctx->getVariable(i);
+            if ( pv<gbegin || pv>=gend ) continue;      // shared globals are not in the clone
+            auto vi = ctx->getVariableInfo(i);
+            if ( !vi || !vi->isRawPod() || vi->type==Type::tIterator ) return false;
+        }
+        return true;
+    }
+
+    shared_ptr<Context> JobContextPool::acquire ( Context * parent ) {
+        {
+            lock_guard<mutex> guard(mMutex);
+            if ( !idle.empty() ) {
+                auto ctx = das::move(idle.back());
+                idle.pop_back();
+                hits ++;
+                return ctx;
+            }
+        }
+        misses ++;
+        shared_ptr<Context> ctx;
+        ctx.reset(get_clone_context(parent, uint32_t(ContextCategory::job_clone)));
+        if ( ctx->failed ) return ctx;
+        // parallel_for acquires from the worker threads, so the snapshot is taken under the lock
+        lock_guard<mutex> guard(mMutex);
+        if ( !snapshotChecked ) {
+            // globals can be copied back only if they are plain data, and init script did not touch the heaps
+            // everything else (strings, pointers, containers, lambdas, iterators) re-runs the init script
+            snapshotChecked = true;
+            if ( ctx->heap->bytesAllocated()==0 && ctx->stringHeap->bytesAllocated()==0 && rawPodGlobals(ctx.get()) ) {
+                auto gsize = ctx->getGlobalSize();
+                globalsSnapshot.resize(gsize);
+                if ( gsize ) memcpy(globalsSnapshot.data(), ctx->globals, gsize);
+                useSnapshot = true;
+            }
+        }
+        return ctx;
+    }
+
+    bool JobContextPool::recycle ( Context * ctx ) {
+        if ( ctx->failed || ctx->insideContext ) return false;
+        ctx->restart();
+        ctx->restartHeaps();
+        bool snapshot = false;
+        {
+            lock_guard<mutex> guard(mMutex);
+            if ( useSnapshot ) {
+                if ( !globalsSnapshot.empty() ) memcpy(ctx->globals, globalsSnapshot.data(), globalsSnapshot.size());
+                snapshot = true;
+            }
+        }
+        if ( !snapshot ) {
+            ctx->runInitScriptAndReport();
+            ctx->restart();
+        }
+        return !ctx->failed;
+    }
+
+    void JobContextPool::release ( shared_ptr<Context> && ctx ) {
+        // anyone else holding the clone (channel, lock box) may still point into its heap
+        if ( !canReuse || ctx.use_count()!=1 || size()>=capacity || !recycle(ctx.get()) ) {
+            discarded ++;
+            ctx.reset();
+            return;
+        }
+        lock_guard<mutex> guard(mMutex);
+        idle.emplace_back(das::move(ctx));
+    }
+
     void new_job_invoke ( Lambda lambda, Func fn, int32_t lambdaSize, Context * context, LineInfoArg * lineinfo ) {
+        new_job_invoke_priority(lambda, fn, lambdaSize, JobPriority::Default, context, lineinfo);
+    }
+
+    void new_job_invoke_priority ( Lambda lambda, Func fn, int32_t lambdaSize, JobPriority priority, Context * context, LineInfoArg * lineinfo ) {
         if ( !g_jobQue ) context->throw_error_at(lineinfo, "need to be in 'with_job_que' block");
-        shared_ptr<Context> forkContext;
-        forkContext.reset(get_clone_context(context, uint32_t(ContextCategory::job_clone)));
+        if ( !context->jobContextPool ) {
+            context->jobContextPool = make_shared<JobContextPool>(context);
+        }
+        weak_ptr<JobContextPool> pool = context->jobContextPool;
+        shared_ptr<Context> forkContext = context->jobContextPool->acquire(context);
         auto ptr = forkContext->allocate(lambdaSize + 16,lineinfo);
         forkContext->heap->mark_comment(ptr, "new [[ ]] in new_job");
         memset ( ptr, 0, lambdaSize + 16 );
@@ -360,7 +678,71 @@ namespace das {
             Lambda flambda(ptr);
             das_invoke_lambda<void>::invoke(forkContext.get(), lineinfo, flambda);
             das_delete<Lambda>::clear(forkContext.get(), flambda);
-        }, 0, JobPriority::Default);
+            if ( auto pp = pool.lock() ) {
+                pp->release(das::move(forkContext));
+            }
+        }, 0, priority);
+    }
+
+    uint64_t jobContextPoolHits ( Context * context ) {
+        return context->jobContextPool ? context->jobContextPool->getHits() : 0;
+    }
+
+    uint64_t jobContextPoolMisses ( Context * context ) {
+        return context->jobContextPool ? context->jobContextPool->getMisses() : 0;
+    }
+
+    void jobContextPoolSetCapacity ( int32_t capacity, Context * context, LineInfoArg * at ) {
+        if ( capacity < 0 ) context->throw_error_at(at, "job context pool capacity can't be negative");
+        if ( !context->jobContextPool ) {
+            context->jobContextPool = make_shared<JobContextPool>(context);
+        }
+        context->jobContextPool->setCapacity(uint32_t(capacity));
+    }
+
+    // chunks of [from,to) go to the job que, one of them stays on the calling thread and runs on the calling context.
+    // the rest run on the pooled clones of the calling context, so 'fn' only sees what 'data' points to and the shared globals
+    void jobQueParallelFor ( int32_t from, int32_t to, int32_t chunkCount, TFunc<void,int32_t,int32_t,void *> fn, void * data,
+            Context * context, LineInfoArg * at ) {
+        if ( !fn ) context->throw_error_at(at, "parallel_for expecting function");
+        if ( from >= to ) return;
+        if ( !g_jobQue ) {
+            das_invoke_function<void>::invoke(context, at, fn, from, to, data);
+            return;
+        }
+        if ( !context->jobContextPool ) {
+            context->jobContextPool = make_shared<JobContextPool>(context);
+        }
+        auto pool = context->jobContextPool;
+        auto callerThread = this_thread::get_id();
+        auto bound = daScriptEnvironment::getBound();
+        mutex errorLock;
+        string error;
+        g_jobQue->parallel_for(from, to, [&]( int i0, int i1 ) {
+            i1 = min(i1, to);
+            if ( i0 >= i1 ) return;
+            if ( this_thread::get_id()==callerThread ) {
+                if ( !context->runWithCatch([&]() {
+                    das_invoke_function<void>::invoke(context, at, fn, i0, i1, data);
+                }) ) {
+                    lock_guard<mutex> guard(errorLock);
+                    if ( error.empty() ) error = context->getException() ? context->getException() : "exception";
+                }
+                return;
+            }
+            daScriptEnvironment::setBound(bound);
+            auto forkContext = pool->acquire(context);
+            if ( !forkContext->runWithCatch([&]() {
+                das_invoke_function<void>::invoke(forkContext.get(), at, fn, i0, i1, data);
+            }) ) {
+                lock_guard<mutex> guard(errorLock);
+                if ( error.empty() ) error = forkContext->getException() ? forkContext->getException() : "exception";
+            }
+            pool->release(das::move(forkContext));
+        }, 0, JobPriority::Default, chunkCount>0 ? chunkCount : -1);
+        if ( !error.empty() ) {
+            context->throw_error_at(at, "parallel_for failed, %s", error.c_str());
+        }
     }
 
     static atomic<int32_t> g_jobQueAvailable{0};
@@ -422,10 +804,28 @@ namespace das {
         }).detach();
     }
 
+    shared_ptr<JobQue> getActiveJobQue() {
+        lock_guard<mutex> guard(g_jobQueMutex);
+        return g_jobQue;
+    }
+
     void withJobQue ( const TBlock<void> & block, Context * context, LineInfoArg * lineInfo ) {
-        if ( !g_jobQue ) {
+        withJobQueThreads(0, block, context, lineInfo);
+    }
+
+    void withJobQueThreads ( int32_t threads, const TBlock<void> & block, Context * context, LineInfoArg * lineInfo ) {
+        if ( threads < 0 ) context->throw_error_at(lineInfo, "with_job_que: thread count can't be negative");
+        int running = 0;
+        {
             lock_guard<mutex> guard(g_jobQueMutex);
-            g_jobQue = make_shared<JobQue>();
+            if ( !g_jobQue ) {
+                g_jobQue = make_shared<JobQue>(threads);
+            } else {
+                running = g_jobQue->getTotalHwJobs();
+            }
+        }
+        if ( threads && running && running!=threads ) {
+            context->throw_error_at(lineInfo, "with_job_que: job que is already running with %i threads", running);
         }
         {
             shared_ptr<JobQue> jq = g_jobQue;
@@ -490,6 +890,11 @@ namespace das {
         return g_jobQue->getTotalHwJobs();
     }
 
+    uint64_t getTotalJobSteals( Context * context, LineInfoArg * at ) {
+        if ( !g_jobQue ) context->throw_error_at(at, "need to be in 'with_job_que' block");
+        return g_jobQue->getTotalSteals();
+    }
+
     int getTotalHwThreads () {
         return JobQue::get_num_threads();
     }
@@ -502,6 +907,7 @@ namespace das {
             // libs
             ModuleLibrary lib(this);
             lib.addBuiltInModule();
+            addEnumeration(make_smart<EnumerationJobPriority>());
             // types
             addAnnotation(make_smart<JobStatusAnnotation>(lib));
             auto cha = make_smart<ChannelAnnotation>(lib);
@@ -586,9 +992,15 @@ namespace das {
             addInterop<channelPushBatch,void,Channel *,vec4f>(*this, lib,  "_builtin_channel_push_batch",
                 SideEffects::modifyArgumentAndExternal, "channelPushBatch")
                     ->args({"channel","data"});
+            addInterop<channelTryPush,bool,Channel *,vec4f>(*this, lib,  "_builtin_channel_try_push",
+                SideEffects::modifyArgumentAndExternal, "channelTryPush")
+                    ->args({"channel","data"});
             addExtern<DAS_BIND_FUN(channelPop)>(*this, lib,  "_builtin_channel_pop",
                 SideEffects::modifyArgumentAndExternal, "channelPop")
                     ->args({"channel","block","context","line"});
+            addExtern<DAS_BIND_FUN(channelPopBatch)>(*this, lib,  "_builtin_channel_pop_batch",
+                SideEffects::modifyArgumentAndExternal, "channelPopBatch")
+                    ->args({"channel","maxCount","block","context","line"});
             addExtern<DAS_BIND_FUN(channelGather)>(*this, lib,  "_builtin_channel_gather",
                 SideEffects::modifyArgumentAndExternal, "channelGather")
                     ->args({"channel","block","context","line"});
@@ -613,9 +1025,15 @@ namespace das {
             addExtern<DAS_BIND_FUN(withChannelEx)>(*this, lib,  "with_channel",
                 SideEffects::invoke, "withChannelEx")
                     ->args({"count","block","context","line"});
+            addExtern<DAS_BIND_FUN(withBoundedChannel)>(*this, lib,  "with_bounded_channel",
+                SideEffects::invoke, "withBoundedChannel")
+                    ->args({"count","capacity","block","context","line"});
             addExtern<DAS_BIND_FUN(channelCreate)>(*this, lib, "channel_create",
                 SideEffects::invoke, "channelCreate")
                     ->args({ "context","line" })->unsafeOperation = true;
+            addExtern<DAS_BIND_FUN(channelCreateBounded)>(*this, lib, "channel_create_bounded",
+                SideEffects::invoke, "channelCreateBounded")
+                    ->args({ "capacity","context","line" })->unsafeOperation = true;
             addExtern<DAS_BIND_FUN(channelRemove)>(*this, lib, "channel_remove",
                 SideEffects::invoke, "channelRemove")
                     ->args({ "channel", "context","line" })->unsafeOperation = true;
@@ -648,12 +1066,33 @@ namespace das {
             addExtern<DAS_BIND_FUN(new_job_invoke)>(*this, lib,  "new_job_invoke",
                 SideEffects::modifyExternal, "new_job_invoke")
                     ->args({"lambda","function","lambdaSize","context","line"});
+            addExtern<DAS_BIND_FUN(new_job_invoke_priority)>(*this, lib,  "new_job_invoke",
+                SideEffects::modifyExternal, "new_job_invoke_priority")
+                    ->args({"lambda","function","lambdaSize","priority","context","line"});
+            addExtern<DAS_BIND_FUN(jobContextPoolHits)>(*this, lib,  "get_job_context_pool_hits",
+                SideEffects::accessExternal, "jobContextPoolHits")
+                    ->args({"context"});
+            addExtern<DAS_BIND_FUN(jobContextPoolMisses)>(*this, lib,  "get_job_context_pool_misses",
+                SideEffects::accessExternal, "jobContextPoolMisses")
+                    ->args({"context"});
+            addExtern<DAS_BIND_FUN(jobContextPoolSetCapacity)>(*this, lib,  "set_job_context_pool_capacity",
+                SideEffects::modifyExternal, "jobContextPoolSetCapacity")
+                    ->args({"capacity","context","line"});
+            addExtern<DAS_BIND_FUN(jobQueParallelFor)>(*this, lib,  "parallel_for",
+                SideEffects::modifyExternal, "jobQueParallelFor")
+                    ->args({"from","to","chunk_count","function","data","context","line"});
             addExtern<DAS_BIND_FUN(withJobQue)>(*this, lib,  "with_job_que",
                 SideEffects::modifyExternal, "withJobQue")
                     ->args({"block","context","line"});
+            addExtern<DAS_BIND_FUN(withJobQueThreads)>(*this, lib,  "with_job_que",
+                SideEffects::modifyExternal, "withJobQueThreads")
+                    ->args({"threads","block","context","line"});
             addExtern<DAS_BIND_FUN(getTotalHwJobs)>(*this, lib,  "get_total_hw_jobs",
                 SideEffects::accessExternal, "getTotalHwJobs")
                     ->args({"context","line"});
+            addExtern<DAS_BIND_FUN(getTotalJobSteals)>(*this, lib,  "get_total_job_steals",
+                SideEffects::accessExternal, "getTotalJobSteals")
+                    ->args({"context","line"});
             addExtern<DAS_BIND_FUN(getTotalHwThreads)>(*this, lib,  "get_total_hw_threads",
                 SideEffects::accessExternal, "getTotalHwThreads");
             addExtern<DAS_BIND_FUN(new_thread_invoke)>(*this, lib,  "new_thread_invoke",
@@ -9,6 +9,7 @@
 #include <atomic>
 
 MAKE_TYPE_FACTORY(NetworkServer,Server)
+MAKE_TYPE_FACTORY(NetworkMultiServer,MultiServer)
 
 namespace das {
 
@@ -78,12 +79,83 @@ namespace das {
         Context *   context;
     };
 
+    class MultiServerAdapter : public MultiServer {
+    public:
+        MultiServerAdapter(char * pClass, const StructInfo * info, Context * ctx ) {
+            update(pClass,info,ctx);
+            if ( !g_moduleNetworkTotalServers++ )
+                Server::startup();
+        }
+        virtual ~MultiServerAdapter() {
+            if ( !--g_moduleNetworkTotalServers )
+                Server::shutdown();
+        }
+        void update ( char * pClass, const StructInfo * info, Context * ctx ) {
+            context = ctx;
+            classPtr = pClass;
+            pServer = (void **) adapt_field("_server",pClass,info);
+            if ( pServer ) *pServer = this;
+            fnOnConnect = adapt("onConnect",pClass,info);
+            fnOnDisconnect = adapt("onDisconnect",pClass,info);
+            fnOnData = adapt("onData",pClass,info);
+            fnOnError = adapt("onError",pClass,info);
+            fnOnLog = adapt("onLog",pClass,info);
+        }
+        virtual void onConnect ( int32_t conn ) override {
+            if ( fnOnConnect ) {
+                return das_invoke_function<void>::invoke<void *,int32_t>
+                    (context,nullptr,fnOnConnect,classPtr,conn);
+            }
+        }
+        virtual void onDisconnect ( int32_t conn ) override {
+            if ( fnOnDisconnect ) {
+                return das_invoke_function<void>::invoke<void *,int32_t>
+                    (context,nullptr,fnOnDisconnect,classPtr,conn);
+            }
+        }
+        virtual void onData ( int32_t conn, char * buf, int size ) override {
+            if ( fnOnData ) {
+                return das_invoke_function<void>::invoke<void *,int32_t,char *,int32_t>
+                    (context,nullptr,fnOnData,classPtr,conn,buf,size);
+            }
+        }
+        virtual void onError ( const char * msg, int code ) override {
+            if ( fnOnError ) {
+                return das_invoke_function<void>::invoke<void *,const char *,int32_t>
+                    (context,nullptr,fnOnError,classPtr,msg,code);
+            }
+        }
+        virtual void onLog ( const char * msg ) override {
+            if ( fnOnLog ) {
+                return das_invoke_function<void>::invoke<void *,const char *>
+                    (context,nullptr,fnOnLog,classPtr,msg);
+            }
+        }
+        bool isValid() const { return pServer != nullptr; }
+    protected:
+        void ** pServer = nullptr;
+        Func    fnOnConnect;
+        Func    fnOnDisconnect;
+        Func    fnOnData;
+        Func    fnOnError;
+        Func    fnOnLog;
+    protected:
+        void *      classPtr;
+        Context *   context;
+    };
+
     struct ServerAnnotation : ManagedStructureAnnotation<Server> {
         ServerAnnotation(ModuleLibrary & ml)
             : ManagedStructureAnnotation ("NetworkServer", ml, "Server") {
         }
     };
 
+    struct MultiServerAnnotation : ManagedStructureAnnotation<MultiServer> {
+        MultiServerAnnotation(ModuleLibrary & ml)
+            : ManagedStructureAnnotation ("NetworkMultiServer", ml, "MultiServer") {
+        }
+    };
+
     #include "network.das.inc"
 
     bool makeServer ( const void * pClass, const StructInfo * info, Context * context ) {
@@ -124,6 +196,82 @@ namespace das {
         adapter->update((char *)pClass,info,context);
     }
 
+    bool makeMultiServer ( const void * pClass, const StructInfo * info, Context * context ) {
+        auto server = make_smart<MultiServerAdapter>((char *)pClass,info,context);
+        if ( !server->isValid() ) return false;
+        server.orphan();
+        return true;
+    }
+
+    bool multi_server_init ( smart_ptr_raw<MultiServer> server, int32_t port, Context * context, LineInfoArg * at ) {
+        if ( !server ) context->throw_error_at(at, "null server");
+        return server->init(port);
+    }
+
+    int32_t multi_server_connect ( smart_ptr_raw<MultiServer> server, const char * host, int32_t port, Context * context, LineInfoArg * at ) {
+        if ( !server ) context->throw_error_at(at, "null server");
+        return server->connect(host, port);
+    }
+
+    int32_t multi_server_port ( smart_ptr_raw<MultiServer> server, Context * context, LineInfoArg * at ) {
+        if ( !server ) context->throw_error_at(at, "null server");
+        return server->get_port();
+    }
+
+    bool multi_server_is_open ( smart_ptr_raw<MultiServer> server, Context * context, LineInfoArg * at ) {
+        if ( !server ) context->throw_error_at(at, "null server");
+        return server->is_open();
+    }
+
+    int32_t multi_server_connections ( smart_ptr_raw<MultiServer> server, Context * context, LineInfoArg * at ) {
+        if ( !server ) context->throw_error_at(at, "null server");
+        return server->connections();
+    }
+
+    bool multi_server_is_connected ( smart_ptr_raw<MultiServer> server, int32_t conn, Context * context, LineInfoArg * at ) {
+        if ( !server ) context->throw_error_at(at, "null server");
+        return server->is_connected(conn);
+    }
+
+    int32_t multi_server_tick ( smart_ptr_raw<MultiServer> server, int32_t timeout, Context * context, LineInfoArg * at ) {
+        if ( !server ) context->throw_error_at(at, "null server");
+        return server->tick(timeout);
+    }
+
+    bool multi_server_send ( smart_ptr_raw<MultiServer> server, int32_t conn, uint8_t * data, int32_t size, Context * context, LineInfoArg * at ) {
+        if ( !server ) context->throw_error_at(at, "null server");
+        if ( size<0 ) context->throw_error_at(at, "negative size %i", size);
+        return server->send_msg(conn, (const char *)data, uint32_t(size));
+    }
+
+    bool multi_server_send_parts ( smart_ptr_raw<MultiServer> server, int32_t conn, const TArray<char *> & parts, Context * context, LineInfoArg * at ) {
+        if ( !server ) context->throw_error_at(at, "null server");
+        vector<NetBuffer> buffers;
+        buffers.reserve(parts.size);
+        for ( uint32_t i=0; i!=parts.size; ++i ) {
+            if ( auto str = parts[i] ) {
+                buffers.push_back({ str, stringLength(*context, str) });
+            }
+        }
+        return server->send_msgv(conn, buffers.data(), uint32_t(buffers.size()));
+    }
+
+    uint64_t multi_server_pending ( smart_ptr_raw<MultiServer> server, int32_t conn, Context * context, LineInfoArg * at ) {
+        if ( !server ) context->throw_error_at(at, "null server");
+        return server->pending(conn);
+    }
+
+    void multi_server_close ( smart_ptr_raw<MultiServer> server, int32_t conn, Context * context, LineInfoArg * at ) {
+        if ( !server ) context->throw_error_at(at, "null server");
+        server->close(conn);
+    }
+
+    void multi_server_restore ( smart_ptr_raw<MultiServer> server, const void * pClass, const StructInfo * info, Context * context, LineInfoArg * at ) {
+        if ( !server ) context->throw_error_at(at, "null server");
+        auto adapter = (MultiServerAdapter *) server.get();
+        adapter->update((char *)pClass,info,context);
+    }
+
     class Module_Network : public Module {
     public:
         Module_Network() : Module("network") {
@@ -154,6 +302,47 @@ namespace das {
             addExtern<DAS_BIND_FUN(server_restore)>(*this, lib,  "server_restore",
                 SideEffects::modifyArgumentAndExternal, "server_restore")
                     ->args({"server","class","info","context","at"});
+            // multi-connection server
+            addAnnotation(make_smart<MultiServerAnnotation>(lib));
+            addExtern<DAS_BIND_FUN(makeMultiServer)>(*this, lib,  "make_multi_server",
+                SideEffects::modifyArgumentAndExternal, "makeMultiServer")
+                    ->args({"class","info","context"});
+            addExtern<DAS_BIND_FUN(multi_server_init)>(*this, lib,  "multi_server_init",
+                SideEffects::modifyArgumentAndExternal, "multi_server_init")
+                    ->args({"server","port","context","at"});
+            addExtern<DAS_BIND_FUN(multi_server_connect)>(*this, lib,  "multi_server_connect",
+                SideEffects::modifyArgumentAndExternal, "multi_server_connect")
+                    ->args({"server","host","port","context","at"});
+            addExtern<DAS_BIND_FUN(multi_server_port)>(*this, lib,  "multi_server_port",
+                SideEffects::modifyArgumentAndExternal, "multi_server_port")
+                    ->args({"server","context","at"});
+            addExtern<DAS_BIND_FUN(multi_server_is_open)>(*this, lib,  "multi_server_is_open",
+                SideEffects::modifyArgumentAndExternal, "multi_server_is_open")
+                    ->args({"server","context","at"});
+            addExtern<DAS_BIND_FUN(multi_server_connections)>(*this, lib,  "multi_server_connections",
+                SideEffects::modifyArgumentAndExternal, "multi_server_connections")
+                    ->args({"server","context","at"});
+            addExtern<DAS_BIND_FUN(multi_server_is_connected)>(*this, lib,  "multi_server_is_connected",
+                SideEffects::modifyArgumentAndExternal, "multi_server_is_connected")
+                    ->args({"server","conn","context","at"});
+            addExtern<DAS_BIND_FUN(multi_server_tick)>(*this, lib,  "multi_server_tick",
+                SideEffects::modifyArgumentAndExternal, "multi_server_tick")
+                    ->args({"server","timeout","context","at"});
+            addExtern<DAS_BIND_FUN(multi_server_send)>(*this, lib,  "multi_server_send",
+                SideEffects::modifyArgumentAndExternal, "multi_server_send")
+                    ->args({"server","conn","data","size","context","at"});
+            addExtern<DAS_BIND_FUN(multi_server_send_parts)>(*this, lib,  "multi_server_send",
+                SideEffects::modifyArgumentAndExternal, "multi_server_send_parts")
+                    ->args({"server","conn","parts","context","at"});
+            addExtern<DAS_BIND_FUN(multi_server_pending)>(*this, lib,  "multi_server_pending",
+                SideEffects::modifyArgumentAndExternal, "multi_server_pending")
+                    ->args({"server","conn","context","at"});
+            addExtern<DAS_BIND_FUN(multi_server_close)>(*this, lib,  "multi_server_close",
+                SideEffects::modifyArgumentAndExternal, "multi_server_close")
+                    ->args({"server","conn","context","at"});
+            addExtern<DAS_BIND_FUN(multi_server_restore)>(*this, lib,  "multi_server_restore",
+                SideEffects::modifyArgumentAndExternal, "multi_server_restore")
+                    ->args({"server","class","info","context","at"});
             // add builtin module
             compileBuiltinModule("network.das",network_das,sizeof(network_das));
         }
@@ -37,6 +37,7 @@ IMPLEMENT_EXTERNAL_TYPE_FACTORY(FileAccess,FileAccess)
 IMPLEMENT_EXTERNAL_TYPE_FACTORY(Context,Context)
 IMPLEMENT_EXTERNAL_TYPE_FACTORY(SimFunction,SimFunction)
 IMPLEMENT_EXTERNAL_TYPE_FACTORY(CodeOfPolicies,CodeOfPolicies)
+IMPLEMENT_EXTERNAL_TYPE_FACTORY(CompileCacheStats,CompileCacheStats)
 IMPLEMENT_EXTERNAL_TYPE_FACTORY(recursive_mutex,das::recursive_mutex)
 
 DAS_BASE_BIND_ENUM(das::CompilationError, CompilationError,
@@ -710,6 +711,19 @@ namespace das {
         return debugInfoIterator<FuncInfo,VarInfo>((FuncInfo *)&st, context, at);
     }
 
+    struct CompileCacheStatsAnnotation : ManagedStructureAnnotation<CompileCacheStats> {
+        CompileCacheStatsAnnotation(ModuleLibrary & ml)
+            : ManagedStructureAnnotation ("CompileCacheStats", ml, "das::CompileCacheStats") {
+            addField<DAS_BIND_MANAGED_FIELD(hits)>("hits");
+            addField<DAS_BIND_MANAGED_FIELD(misses)>("misses");
+            addField<DAS_BIND_MANAGED_FIELD(invalidations)>("invalidations");
+            addField<DAS_BIND_MANAGED_FIELD(stores)>("stores");
+        }
+        virtual bool canMove() const override { return true; }
+        virtual bool canCopy() const override { return true; }
+        virtual bool isLocal() const override { return true; }
+    };
+
     struct CodeOfPoliciesAnnotation : ManagedStructureAnnotation<CodeOfPolicies,false,false> {
         CodeOfPoliciesAnnotation(ModuleLibrary & ml) : ManagedStructureAnnotation ("CodeOfPolicies", ml) {
         // aot
@@ -781,6 +795,12 @@ namespace das {
             addField<DAS_BIND_MANAGED_FIELD(scoped_stack_allocator)>("scoped_stack_allocator");
             addField<DAS_BIND_MANAGED_FIELD(force_inscope_pod)>("force_inscope_pod");
             addField<DAS_BIND_MANAGED_FIELD(log_inscope_pod)>("log_inscope_pod");
+            addField<DAS_BIND_MANAGED_FIELD(inline_functions)>("inline_functions");
+            addField<DAS_BIND_MANAGED_FIELD(inline_max_cost)>("inline_max_cost");
+            addField<DAS_BIND_MANAGED_FIELD(loop_invariant_motion)>("loop_invariant_motion");
+            addField<DAS_BIND_MANAGED_FIELD(common_subexpressions)>("common_subexpressions");
+            addField<DAS_BIND_MANAGED_FIELD(bounds_check_elimination)>("bounds_check_elimination");
+            addField<DAS_BIND_MANAGED_FIELD(bytecode)>("bytecode");
         // debugger
             addField<DAS_BIND_MANAGED_FIELD(debugger)>("debugger");
             addField<DAS_BIND_MANAGED_FIELD(debug_infer_flag)>("debug_infer_flag");
@@ -859,6 +879,29 @@ namespace das {
         return context.getTotalVariables();
     }
 
+    void rtti_contextSaveInitSnapshot ( Context & ctx, const TBlock<void,bool,TTemporary<TArray<uint8_t>>,const string> & block, Context * context, LineInfoArg * at ) {
+        vector<uint8_t> image;
+        string error;
+        bool ok = ctx.saveInitSnapshot(image, error);
+        Array arr;
+        arr.data = (char *) image.data();
+        arr.capacity = arr.size = uint32_t(image.size());
+        arr.lock = 1;
+        arr.flags = 0;
+        vec4f args[3] = {
+            cast<bool>::from(ok),
+            cast<Array *>::from(&arr),
+            cast<string *>::from(&error)
+        };
+        context->invoke(block, args, nullptr, at);
+    }
+
+    bool rtti_contextRestoreInitSnapshot ( Context & ctx, const TArray<uint8_t> & image, Context * context, LineInfoArg * at ) {
+        if ( &ctx==context ) context->throw_error_at(at, "can't restore the snapshot of the calling context");
+        string error;
+        return ctx.restoreInitSnapshot((const uint8_t *) image.data, image.size, error);
+    }
+
     vec4f rtti_contextFunctionInfo ( Context & context, SimNode_CallBase * call, vec4f * args ) {
         Context * ctx = cast<Context *>::to(args[0]);
         int32_t tf = ctx->getTotalFunctions();
@@ -943,6 +986,10 @@ namespace das {
         return program->thisModule.get();
     }
 
+    void rtti_materialize_functions ( smart_ptr_raw<Program> program ) {
+        program->materializeFunctions();
+    }
+
     Module * rtti_get_builtin_module ( const char * name ) {
         return Module::require(name);
     }
@@ -1145,11 +1192,11 @@ namespace das {
 
 #if !DAS_NO_FILEIO
 
-    void rtti_builtin_compile_file ( char * modName, smart_ptr<FileAccess> access, ModuleGroup* module_group, const CodeOfPolicies & cop,
-            const TBlock<void,bool,smart_ptr<Program>,const string> & block, Context * context, LineInfoArg * at ) {
+    static void rtti_compile_file_impl ( char * modName, smart_ptr<FileAccess> access, ModuleGroup* module_group, const CodeOfPolicies & cop,
+            const string & cacheDir, const TBlock<void,bool,smart_ptr<Program>,const string> & block, Context * context, LineInfoArg * at ) {
         TextWriter issues;
         if ( !access ) access = make_smart<FsFileAccess>();
-        auto program = compileDaScript(modName, access, issues, *module_group, cop);
+        auto program = compileDaScriptCached(modName, access, issues, *module_group, cacheDir, cop);
         if ( program ) {
             if (program->failed()) {
                 for (auto & err : program->errors) {
@@ -1178,6 +1225,17 @@ namespace das {
         }
     }
 
+    void rtti_builtin_compile_file ( char * modName, smart_ptr<FileAccess> access, ModuleGroup* module_group, const CodeOfPolicies & cop,
+            const TBlock<void,bool,smart_ptr<Program>,const string> & block, Context * context, LineInfoArg * at ) {
+        rtti_compile_file_impl(modName, access, module_group, cop, "", block, context, at);
+    }
+
+    void rtti_builtin_compile_file_cached ( char * modName, smart_ptr<FileAccess> access, ModuleGroup* module_group, const CodeOfPolicies & cop,
+            char * cacheDir, const TBlock<void,bool,smart_ptr<Program>,const string> & block, Context * context, LineInfoArg * at ) {
+        if ( !cacheDir ) context->throw_error_at(at, "expecting compile cache folder");
+        rtti_compile_file_impl(modName, access, module_group, cop, cacheDir, block, context, at);
+    }
+
     smart_ptr<FileAccess> makeFileAccess( char * pak, Context *, LineInfoArg * ) {
         return get_file_access(pak);
     }
@@ -1201,6 +1259,11 @@ namespace das {
         context->throw_error_at(at, "not supported with DAS_NO_FILEIO");
     }
 
+    void rtti_builtin_compile_file_cached ( char *, smart_ptr<FileAccess>, ModuleGroup*, const CodeOfPolicies &,
+            char *, const TBlock<void,bool,smart_ptr<Program>,const string> &, Context * context, LineInfoArg * at ) {
+        context->throw_error_at(at, "not supported with DAS_NO_FILEIO");
+    }
+
     bool introduceFile ( smart_ptr_raw<FileAccess>, char *, char *, Context * context, LineInfoArg * at ) {
         context->throw_error_at(at, "not supported with DAS_NO_FILEIO");
         return false;
@@ -1441,6 +1504,7 @@ namespace das {
             addAlias(makeAnnotationDeclarationFlags());
             // CodeOfPolicies
             addAnnotation(make_smart<CodeOfPoliciesAnnotation>(lib));
+            addAnnotation(make_smart<CompileCacheStatsAnnotation>(lib));
             addCtorAndUsing<CodeOfPolicies>(*this,lib,"CodeOfPolicies","CodeOfPolicies");
             // enums
             addEnumeration(make_smart<EnumerationCompilationError>());
@@ -1508,6 +1572,12 @@ namespace das {
             addExtern<DAS_BIND_FUN(rtti_contextTotalVariables)>(*this, lib, "get_total_variables",
                 SideEffects::modifyExternal, "rtti_contextTotalVariables")
                     ->arg("context");
+            addExtern<DAS_BIND_FUN(rtti_contextSaveInitSnapshot)>(*this, lib, "save_init_snapshot",
+                SideEffects::modifyExternal, "rtti_contextSaveInitSnapshot")
+                    ->args({"context","block","ctx","at"});
+            addExtern<DAS_BIND_FUN(rtti_contextRestoreInitSnapshot)>(*this, lib, "restore_init_snapshot",
+                SideEffects::modifyExternal, "rtti_contextRestoreInitSnapshot")
+                    ->args({"context","image","ctx","at"});
             addInterop<rtti_contextFunctionInfo,const FuncInfo &,vec4f,int32_t>(*this, lib, "get_function_info",
                 SideEffects::modifyExternal, "rtti_contextFunctionInfo")
                     ->args({"context","index"});
@@ -1517,6 +1587,9 @@ namespace das {
             addExtern<DAS_BIND_FUN(rtti_get_this_module)>(*this, lib, "get_this_module",
                 SideEffects::modifyExternal, "rtti_get_this_module")
                     ->arg("program");
+            addExtern<DAS_BIND_FUN(rtti_materialize_functions)>(*this, lib, "materialize_functions",
+                SideEffects::modifyExternal, "rtti_materialize_functions")
+                    ->arg("program");
             addExtern<DAS_BIND_FUN(rtti_get_builtin_module)>(*this, lib, "get_module",
                 SideEffects::modifyExternal, "rtti_get_builtin_module")
                     ->arg("name");
@@ -1529,6 +1602,13 @@ namespace das {
             addExtern<DAS_BIND_FUN(rtti_builtin_compile_file)>(*this, lib, "compile_file",
                 SideEffects::modifyExternal, "rtti_builtin_compile_file")
                     ->args({"module_name","fileAccess","moduleGroup","codeOfPolicies","block","context","line"});
+            addExtern<DAS_BIND_FUN(rtti_builtin_compile_file_cached)>(*this, lib, "compile_file_cached",
+                SideEffects::modifyExternal, "rtti_builtin_compile_file_cached")
+                    ->args({"module_name","fileAccess","moduleGroup","codeOfPolicies","cacheDir","block","context","line"});
+            addExtern<DAS_BIND_FUN(getCompileCacheStats),SimNode_ExtFuncCallAndCopyOrMove>(*this, lib, "get_compile_cache_stats",
+                SideEffects::accessExternal, "getCompileCacheStats");
+            addExtern<DAS_BIND_FUN(resetCompileCacheStats)>(*this, lib, "reset_compile_cache_stats",
+                SideEffects::modifyExternal, "resetCompileCacheStats");
             addExtern<DAS_BIND_FUN(builtin_expected_errors)>(*this, lib, "for_each_expected_error",
                 SideEffects::modifyExternal, "builtin_expected_errors")
                     ->args({"program","block","context","line"});
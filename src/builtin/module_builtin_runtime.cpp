@@ -21,6 +21,8 @@
 #include "../parser/parser_impl.h"
 
 MAKE_TYPE_FACTORY(HashBuilder, HashBuilder)
+MAKE_TYPE_FACTORY(GcPauseReport, das::GcPauseReport)
+MAKE_TYPE_FACTORY(HeapSizeClassStats, das::HeapSizeClassStats)
 
 namespace das
 {
@@ -841,6 +843,34 @@ namespace das
         }
     };
 
+    struct GcPauseReportAnnotation : ManagedStructureAnnotation <GcPauseReport> {
+        GcPauseReportAnnotation(ModuleLibrary & ml)
+            : ManagedStructureAnnotation ("GcPauseReport", ml, "das::GcPauseReport") {
+            addField<DAS_BIND_MANAGED_FIELD(workers)>("workers");
+            addField<DAS_BIND_MANAGED_FIELD(roots)>("roots");
+            addField<DAS_BIND_MANAGED_FIELD(prepareUs)>("prepareUs");
+            addField<DAS_BIND_MANAGED_FIELD(scanUs)>("scanUs");
+            addField<DAS_BIND_MANAGED_FIELD(markUs)>("markUs");
+            addField<DAS_BIND_MANAGED_FIELD(sweepUs)>("sweepUs");
+            addField<DAS_BIND_MANAGED_FIELD(totalUs)>("totalUs");
+            addField<DAS_BIND_MANAGED_FIELD(steps)>("steps");
+            addField<DAS_BIND_MANAGED_FIELD(rescanned)>("rescanned");
+        }
+    };
+
+    struct HeapSizeClassStatsAnnotation : ManagedStructureAnnotation <HeapSizeClassStats> {
+        HeapSizeClassStatsAnnotation(ModuleLibrary & ml)
+            : ManagedStructureAnnotation ("HeapSizeClassStats", ml, "das::HeapSizeClassStats") {
+            addField<DAS_BIND_MANAGED_FIELD(size)>("size");
+            addField<DAS_BIND_MANAGED_FIELD(decks)>("decks");
+            addField<DAS_BIND_MANAGED_FIELD(live)>("live");
+            addField<DAS_BIND_MANAGED_FIELD(capacity)>("capacity");
+            addField<DAS_BIND_MANAGED_FIELD(peak)>("peak");
+            addField<DAS_BIND_MANAGED_FIELD(allocations)>("allocations");
+            addField<DAS_BIND_MANAGED_FIELD(frees)>("frees");
+        }
+    };
+
     vec4f _builtin_hash ( Context & context, SimNode_CallBase * call, vec4f * args ) {
         auto uhash = hash_value(context, args[0], call->types[0]);
         return cast<uint64_t>::from(uhash);
@@ -902,11 +932,46 @@ namespace das
         context->collectHeap(info, sheap, validate);
     }
 
+    bool collect_heap_step ( int32_t budgetUs, bool sheap, Context * context, LineInfoArg * info ) {
+        if ( !context->persistent ) {
+            context->throw_error_at(info, "heap collection is not allowed in this context, needs 'options persistent'");
+        }
+        if ( !context->gcEnabled ) {
+            context->throw_error_at(info, "heap collection is not allowed in this context, needs 'options gc'");
+        }
+        return context->collectHeapStep(info, budgetUs, sheap);
+    }
+
+    void cancel_collect_heap_step ( Context * context ) {
+        context->cancelCollectHeapStep();
+    }
+
+    bool is_collecting_heap ( Context * context ) {
+        return context->isCollectingHeap();
+    }
+
+    GcPauseReport heap_collect_report ( Context * context ) {
+        return context->gcReport;
+    }
+
+    void set_gc_mark_workers ( int32_t workers, Context * context ) {
+        context->gcMarkWorkers = workers;
+    }
+
     void heap_report ( Context * context, LineInfoArg * info ) {
         context->heap->report();
         context->reportAnyHeap(info, false, true, false, false);
     }
 
+    HeapSizeClassStats heap_size_class_stats ( int32_t sizeClass, Context * context, LineInfoArg * at ) {
+        HeapSizeClassStats stats {};
+        if ( sizeClass<0 || sizeClass>=DAS_MAX_SHOE_CUNKS ) {
+            context->throw_error_at(at, "size class %i is out of range 0..%i", sizeClass, DAS_MAX_SHOE_CUNKS-1);
+        }
+        context->heap->getSizeClassStats(sizeClass, stats);
+        return stats;
+    }
+
     void memory_report ( bool errOnly, Context * context, LineInfoArg * info ) {
         /*
         context->stringHeap->report();
@@ -1158,7 +1223,7 @@ namespace das
     void builtin_table_free ( Table & tab, int szk, int szv, Context * __context__, LineInfoArg * at ) {
         if ( tab.data ) {
             if ( !tab.lock || tab.hopeless ) {
-                uint32_t oldSize = tab.capacity*(szk+szv+sizeof(TableHashKey));
+                uint32_t oldSize = uint32_t(table_mem_size(tab.capacity, szk+szv));
                 __context__->free(tab.data, oldSize, at);
             } else {
                 __context__->throw_error_at(at, "can't delete locked table");
@@ -1685,6 +1750,8 @@ namespace das
         addAnnotation(make_smart<IsDimAnnotation>());
         addAnnotation(make_smart<IsRefTypeAnnotation>());
         addAnnotation(make_smart<HashBuilderAnnotation>(lib));
+        addAnnotation(make_smart<GcPauseReportAnnotation>(lib));
+        addAnnotation(make_smart<HeapSizeClassStatsAnnotation>(lib));
         addAnnotation(make_smart<TypeFunctionFunctionAnnotation>());
         // and call macro
         {
@@ -1844,12 +1911,33 @@ namespace das
         hcol->unsafeOperation = true;
         hcol->arguments[0]->init = make_smart<ExprConstBool>(true);
         hcol->arguments[1]->init = make_smart<ExprConstBool>(false);
+        auto hstep = addExtern<DAS_BIND_FUN(collect_heap_step)>(*this, lib, "collect_heap_step",
+                SideEffects::modifyExternal, "collect_heap_step")
+                    ->args({"budget_us","string_heap","context","at"});
+        hstep->unsafeOperation = true;
+        hstep->arguments[1]->init = make_smart<ExprConstBool>(true);
+        addExtern<DAS_BIND_FUN(cancel_collect_heap_step)>(*this, lib, "cancel_collect_heap_step",
+            SideEffects::modifyExternal, "cancel_collect_heap_step")
+                ->arg("context");
+        addExtern<DAS_BIND_FUN(is_collecting_heap)>(*this, lib, "is_collecting_heap",
+            SideEffects::accessExternal, "is_collecting_heap")
+                ->arg("context");
+        addExtern<DAS_BIND_FUN(heap_collect_report),SimNode_ExtFuncCallAndCopyOrMove>(*this, lib, "heap_collect_report",
+            SideEffects::accessExternal, "heap_collect_report")
+                ->arg("context");
+        addExtern<DAS_BIND_FUN(set_gc_mark_workers)>(*this, lib, "set_gc_mark_workers",
+            SideEffects::modifyExternal, "set_gc_mark_workers")
+                ->args({"workers","context"});
         addExtern<DAS_BIND_FUN(string_heap_report)>(*this, lib, "string_heap_report",
             SideEffects::modifyExternal, "string_heap_report")
                 ->args({"context","line"});
         addExtern<DAS_BIND_FUN(heap_report)>(*this, lib, "heap_report",
             SideEffects::modifyExternal, "heap_report")
                 ->args({"context","line"});
+        addExtern<DAS_BIND_FUN(heap_size_class_stats),SimNode_ExtFuncCallAndCopyOrMove>(*this, lib, "heap_size_class_stats",
+            SideEffects::accessExternal, "heap_size_class_stats")
+                ->args({"size_class","context","at"});
+        addConstant<int>(*this, "HEAP_SIZE_CLASSES", DAS_MAX_SHOE_CUNKS);
         addExtern<DAS_BIND_FUN(memory_report)>(*this, lib, "memory_report",
             SideEffects::modifyExternal, "memory_report")
                 ->args({"errorsOnly","context","lineinfo"});
@@ -2051,6 +2139,30 @@ namespace das
         addExtern<DAS_BIND_FUN(builtin_profile)>(*this,lib,"profile",
             SideEffects::modifyExternal, "builtin_profile")
                 ->args({"count","category","block","context","line"});
+        // sampling profiler. only frames with a stack prologue are seen, so AOT functions need 'options aot_prologue',
+        // and JIT functions show up only when they push one (ones with blocks). otherwise time goes to the interpreted caller
+        auto spstart = addExtern<DAS_BIND_FUN(builtin_sampling_profiler_start)>(*this, lib, "sampling_profiler_start",
+            SideEffects::modifyExternal, "builtin_sampling_profiler_start")
+                ->args({"interval_us","context","at"});
+        spstart->arguments[0]->init = make_smart<ExprConstInt>(1000);
+        addExtern<DAS_BIND_FUN(builtin_sampling_profiler_stop)>(*this, lib, "sampling_profiler_stop",
+            SideEffects::modifyExternal, "builtin_sampling_profiler_stop")
+                ->arg("context");
+        addExtern<DAS_BIND_FUN(builtin_sampling_profiler_reset)>(*this, lib, "sampling_profiler_reset",
+            SideEffects::modifyExternal, "builtin_sampling_profiler_reset")
+                ->arg("context");
+        addExtern<DAS_BIND_FUN(builtin_sampling_profiler_samples)>(*this, lib, "sampling_profiler_samples",
+            SideEffects::accessExternal, "builtin_sampling_profiler_samples")
+                ->arg("context");
+        addExtern<DAS_BIND_FUN(builtin_sampling_profiler_dropped)>(*this, lib, "sampling_profiler_dropped",
+            SideEffects::accessExternal, "builtin_sampling_profiler_dropped")
+                ->arg("context");
+        addExtern<DAS_BIND_FUN(builtin_sampling_profiler_collapsed)>(*this, lib, "sampling_profiler_collapsed",
+            SideEffects::accessExternal, "builtin_sampling_profiler_collapsed")
+                ->args({"context","at"});
+        addExtern<DAS_BIND_FUN(builtin_sampling_profiler_chrome_trace)>(*this, lib, "sampling_profiler_chrome_trace",
+            SideEffects::accessExternal, "builtin_sampling_profiler_chrome_trace")
+                ->args({"context","at"});
         // das string binding
         addExtern<DAS_BIND_FUN(to_das_string)>(*this, lib, "string",
             SideEffects::none, "to_das_string")
@@ -5,7 +5,20 @@
 #include "daScript/ast/ast_interop.h"
 #include "daScript/simulate/aot_builtin.h"
 #include "daScript/simulate/sim_policy.h"
+#include "daScript/simulate/aot_builtin_jobque.h"
+#include "daScript/misc/job_que.h"
 #include "das_qsort_r.h"
+#include "das_radix_sort.h"
+
+// below that std::sort wins over the radix sort
+#ifndef DAS_RADIX_SORT_THRESHOLD
+#define DAS_RADIX_SORT_THRESHOLD    256
+#endif
+
+// above that the sort is split between the jobs, if there is an active job que
+#ifndef DAS_PARALLEL_SORT_THRESHOLD
+#define DAS_PARALLEL_SORT_THRESHOLD 65536
+#endif
 
 namespace das
 {
@@ -81,12 +94,122 @@ namespace das
         array_unlock(*context,arr,at);
     }
 
+    // sort started from the job itself does not go parallel, it would wait for the jobs behind it
+    static shared_ptr<JobQue> sortJobQue ( int32_t length, int32_t & chunks ) {
+        chunks = 1;
+        if ( length < DAS_PARALLEL_SORT_THRESHOLD ) return nullptr;
+        auto jq = getActiveJobQue();
+        if ( !jq || jq->isWorkerThread() ) return nullptr;
+        while ( chunks < jq->getTotalHwJobs() && length / (chunks*2) >= DAS_PARALLEL_SORT_THRESHOLD/4 ) {
+            chunks *= 2;
+        }
+        return chunks > 1 ? jq : nullptr;
+    }
+
+    template <typename TT>
+    static void builtin_sort_numeric ( TT * data, int32_t length ) {
+        if ( length<=1 ) return;
+        if ( length < DAS_RADIX_SORT_THRESHOLD ) {
+            sort ( data, data + length );
+            return;
+        }
+        vector<TT> temp(length);
+        int32_t chunks = 1;
+        if ( auto jq = sortJobQue(length, chunks) ) {
+            das_parallel_merge_sort(*jq, data, temp.data(), length, chunks, [](TT * d, TT * t, int32_t n) {
+                das_radix_sort(d, t, n);
+            }, [](TT a, TT b) { return a < b; });
+        } else {
+            das_radix_sort(data, temp.data(), length);
+        }
+    }
+
+    template <> void builtin_sort<int32_t> ( int32_t * data, int32_t length ) { builtin_sort_numeric(data, length); }
+    template <> void builtin_sort<uint32_t> ( uint32_t * data, int32_t length ) { builtin_sort_numeric(data, length); }
+    template <> void builtin_sort<int64_t> ( int64_t * data, int32_t length ) { builtin_sort_numeric(data, length); }
+    template <> void builtin_sort<uint64_t> ( uint64_t * data, int32_t length ) { builtin_sort_numeric(data, length); }
+    template <> void builtin_sort<float> ( float * data, int32_t length ) { builtin_sort_numeric(data, length); }
+    template <> void builtin_sort<double> ( double * data, int32_t length ) { builtin_sort_numeric(data, length); }
+
     void builtin_sort_string ( void * data, int32_t length ) {
         if ( length<=1 ) return;
         const char ** pdata = (const char **) data;
-        sort ( pdata, pdata + length, [&](const char * a, const char * b){
+        auto less = [](const char * a, const char * b) {
             return strcmp(to_rts(a), to_rts(b))<0;
-        });
+        };
+        int32_t chunks = 1;
+        if ( auto jq = sortJobQue(length, chunks) ) {
+            vector<const char *> temp(length);
+            das_parallel_merge_sort(*jq, pdata, temp.data(), length, chunks, [&](const char ** d, const char **, int32_t n) {
+                sort ( d, d + n, less );
+            }, less);
+        } else {
+            sort ( pdata, pdata + length, less );
+        }
+    }
+
+    // sort_by. keys are extracted once, then the order is sorted by the keys, then the elements are moved to their places
+
+    template <typename KT>
+    void builtin_sort_order ( const KT * keys, int32_t * order, int32_t length ) {
+        typedef typename RadixKey<KT>::KeyType KeyType;
+        struct KeyIndex {
+            KeyType     key;
+            int32_t     index;
+        };
+        vector<KeyIndex> items(length), temp(length);
+        for ( int32_t i=0; i!=length; ++i ) {
+            items[i].key = RadixKey<KT>::key(keys[i]);
+            items[i].index = i;
+        }
+        auto keyOf = [](const KeyIndex & ki) { return ki.key; };
+        int32_t chunks = 1;
+        if ( auto jq = sortJobQue(length, chunks) ) {
+            das_parallel_merge_sort(*jq, items.data(), temp.data(), length, chunks, [&](KeyIndex * d, KeyIndex * t, int32_t n) {
+                das_radix_sort(d, t, n, keyOf);
+            }, [](const KeyIndex & a, const KeyIndex & b) { return a.key < b.key; });
+        } else {
+            das_radix_sort(items.data(), temp.data(), length, keyOf);
+        }
+        for ( int32_t i=0; i!=length; ++i ) {
+            order[i] = items[i].index;
+        }
+    }
+
+    template DAS_API void builtin_sort_order<int32_t> ( const int32_t *, int32_t *, int32_t );
+    template DAS_API void builtin_sort_order<uint32_t> ( const uint32_t *, int32_t *, int32_t );
+    template DAS_API void builtin_sort_order<int64_t> ( const int64_t *, int32_t *, int32_t );
+    template DAS_API void builtin_sort_order<uint64_t> ( const uint64_t *, int32_t *, int32_t );
+    template DAS_API void builtin_sort_order<float> ( const float *, int32_t *, int32_t );
+    template DAS_API void builtin_sort_order<double> ( const double *, int32_t *, int32_t );
+
+    void builtin_sort_order_string ( void * keys, int32_t * order, int32_t length ) {
+        const char ** pkeys = (const char **) keys;
+        for ( int32_t i=0; i!=length; ++i ) {
+            order[i] = i;
+        }
+        auto less = [&](int32_t a, int32_t b) {
+            return strcmp(to_rts(pkeys[a]), to_rts(pkeys[b]))<0;
+        };
+        int32_t chunks = 1;
+        if ( auto jq = sortJobQue(length, chunks) ) {
+            vector<int32_t> temp(length);
+            das_parallel_merge_sort(*jq, order, temp.data(), length, chunks, [&](int32_t * d, int32_t *, int32_t n) {
+                stable_sort ( d, d + n, less );
+            }, less);
+        } else {
+            stable_sort ( order, order + length, less );
+        }
+    }
+
+    void builtin_sort_permute ( void * data, int32_t stride, const int32_t * order, int32_t length ) {
+        if ( length<=1 ) return;
+        auto pdata = (uint8_t *) data;
+        vector<uint8_t> temp(size_t(stride) * size_t(length));
+        for ( int32_t i=0; i!=length; ++i ) {
+            memcpy(temp.data() + size_t(i)*stride, pdata + size_t(order[i])*stride, stride);
+        }
+        memcpy(pdata, temp.data(), temp.size());
     }
 
 #define xstr(a) str(a)
@@ -96,6 +219,9 @@ namespace das
     addExtern<DAS_BIND_FUN(builtin_sort<CTYPE>)>(*this, lib, "__builtin_sort", \
         SideEffects::modifyArgumentAndExternal, "builtin_sort<" xstr(CTYPE) ">") \
             ->args({"data","length"}); \
+    addExtern<DAS_BIND_FUN(builtin_sort_order<CTYPE>)>(*this, lib, "__builtin_sort_order", \
+        SideEffects::modifyArgumentAndExternal, "builtin_sort_order<" xstr(CTYPE) ">") \
+            ->args({"keys","order","length"}); \
     addExtern<DAS_BIND_FUN(builtin_sort_cblock<CTYPE>)>(*this, lib, "__builtin_sort_cblock", \
         SideEffects::modifyArgumentAndExternal, "builtin_sort_cblock<" xstr(CTYPE) ">") \
             ->args({"array","stride","length","block","context","line"}); \
@@ -209,6 +335,13 @@ namespace das
         addExtern<DAS_BIND_FUN(builtin_sort_string)>(*this, lib, "__builtin_sort_string",
             SideEffects::modifyArgumentAndExternal, "builtin_sort_string")
                 ->args({"data","length"});
+        addExtern<DAS_BIND_FUN(builtin_sort_order_string)>(*this, lib, "__builtin_sort_order_string",
+            SideEffects::modifyArgumentAndExternal, "builtin_sort_order_string")
+                ->args({"keys","order","length"});
+        // permutation
+        addExtern<DAS_BIND_FUN(builtin_sort_permute)>(*this, lib, "__builtin_sort_permute",
+            SideEffects::modifyArgumentAndExternal, "builtin_sort_permute")
+                ->args({"data","stride","order","length"});
         addExtern<DAS_BIND_FUN(builtin_sort_cblock<char *>)>(*this, lib, "__builtin_sort_cblock",
             SideEffects::modifyArgumentAndExternal, "builtin_sort_cblock<char *>")
                 ->args({"array","stride","length","block","context","line"});
@@ -19,6 +19,7 @@
 #endif
 
 MAKE_TYPE_FACTORY(StringBuilderWriter, StringBuilderWriter)
+MAKE_TYPE_FACTORY(StringBuilder, StringBuilder)
 
 DAS_BASE_BIND_ENUM(das::ConversionResult, ConversionResult, ok, invalid_argument, out_of_range)
 
@@ -31,6 +32,12 @@ namespace das
         }
     };
 
+    struct StringBuilderAnnotation : ManagedStructureAnnotation <StringBuilder,true,true> {
+        StringBuilderAnnotation(ModuleLibrary & ml)
+            : ManagedStructureAnnotation ("StringBuilder", ml) {
+        }
+    };
+
     int32_t get_character_at ( const char * str, int32_t index, Context * context, LineInfoArg * at ) {
         const uint32_t strLen = stringLengthSafe ( *context, str );
         if ( uint32_t(index)>=strLen ) {
@@ -411,6 +418,65 @@ namespace das
         return writer;
     }
 
+    void builtin_with_string_builder ( const TBlock<void,StringBuilder> & block, Context * context, LineInfoArg * at ) {
+        StringBuilder sb;
+        vec4f args[1];
+        args[0] = cast<StringBuilder *>::from(&sb);
+        context->invoke(block, args, nullptr, at);
+    }
+
+    vec4f builtin_string_builder_write ( Context &, SimNode_CallBase * call, vec4f * args ) {
+        StringBuilder * sb = cast<StringBuilder *>::to(args[0]);
+        DebugDataWalker<StringBuilder> walker(*sb, PrintFlags::string_builder);
+        walker.walk(args[1], call->types[1]);
+        return cast<StringBuilder *>::from(sb);
+    }
+
+    StringBuilder & string_builder_write_char ( StringBuilder & sb, int32_t ch ) {
+        char c = char(ch);
+        sb.writeStr(&c, 1);
+        return sb;
+    }
+
+    StringBuilder & string_builder_write_chars ( StringBuilder & sb, int32_t ch, int32_t count ) {
+        if ( count>0 ) sb.writeChars(char(ch), count);
+        return sb;
+    }
+
+    int32_t string_builder_length ( const StringBuilder & sb ) {
+        return int32_t(sb.tellp());
+    }
+
+    void string_builder_clear ( StringBuilder & sb ) {
+        sb.clear();
+    }
+
+    // the only copy of the text, the heap string is allocated once
+    char * string_builder_to_string ( const StringBuilder & sb, Context * context, LineInfoArg * at ) {
+        uint64_t length = sb.tellp();
+        if ( length > INT32_MAX ) {
+            context->throw_error_at(at, "string is too long (%" PRIu64 " characters)", length);
+            return nullptr;
+        }
+        if ( !length ) return nullptr;
+        char * res = context->allocateString(nullptr, uint32_t(length), at);
+        sb.copyTo(res);
+        return res;
+    }
+
+    void string_builder_peek_chunks ( const StringBuilder & sb, const TBlock<void,TTemporary<TArray<uint8_t> const>> & block, Context * context, LineInfoArg * at ) {
+        sb.forEachChunk([&]( const char * data, uint32_t size ) {
+            Array arr;
+            arr.data = (char *) data;
+            arr.capacity = arr.size = size;
+            arr.lock = 1;
+            arr.flags = 0;
+            vec4f args[1];
+            args[0] = cast<Array *>::from(&arr);
+            context->invoke(block, args, nullptr, at);
+        });
+    }
+
     char * to_string_char ( int ch, Context * context, LineInfoArg * at ) {
         auto st = context->allocateString(nullptr, 1, at);
         *st = char(ch);
@@ -831,6 +897,7 @@ namespace das
             // string builder writer
             addEnumeration(make_smart<EnumerationConversionResult>());
             addAnnotation(make_smart<StringBuilderWriterAnnotation>(lib));
+            addAnnotation(make_smart<StringBuilderAnnotation>(lib));
             addExtern<DAS_BIND_FUN(delete_string)>(*this, lib, "delete_string",
                 SideEffects::modifyArgumentAndExternal,"delete_string")->args({"str","context","lineinfo"})->unsafeOperation = true;
             addExtern<DAS_BIND_FUN(builtin_build_string)>(*this, lib, "build_string",
@@ -849,6 +916,42 @@ namespace das
                 SideEffects::modifyExternal, "write_string_chars")->args({"writer","ch","count"});
             addExtern<DAS_BIND_FUN(write_escape_string),SimNode_ExtFuncCallRef>(*this, lib, "write_escape_string",
                 SideEffects::modifyExternal, "write_escape_string")->args({"writer","str"});
+            // chunked string builder
+            addExtern<DAS_BIND_FUN(builtin_with_string_builder)>(*this, lib, "with_string_builder",
+                SideEffects::modifyExternal, "builtin_with_string_builder")->args({"block","context","lineinfo"});
+            addInterop<builtin_string_builder_write,StringBuilder &,StringBuilder,vec4f> (*this, lib, "write",
+                SideEffects::modifyExternal, "builtin_string_builder_write")->args({"builder","anything"});
+            addExtern<DAS_BIND_FUN(string_builder_write_char),SimNode_ExtFuncCallRef>(*this, lib, "write_char",
+                SideEffects::modifyExternal, "string_builder_write_char")->args({"builder","ch"});
+            addExtern<DAS_BIND_FUN(string_builder_write_chars),SimNode_ExtFuncCallRef>(*this, lib, "write_chars",
+                SideEffects::modifyExternal, "string_builder_write_chars")->args({"builder","ch","count"});
+            addExtern<DAS_BIND_FUN(string_builder_length)>(*this, lib, "length",
+                SideEffects::accessExternal, "string_builder_length")->args({"builder"});
+            addExtern<DAS_BIND_FUN(string_builder_clear)>(*this, lib, "clear",
+                SideEffects::modifyArgument, "string_builder_clear")->args({"builder"});
+            addExtern<DAS_BIND_FUN(string_builder_to_string)>(*this, lib, "to_string",
+                SideEffects::accessExternal, "string_builder_to_string")->args({"builder","context","lineinfo"});
+            addExtern<DAS_BIND_FUN(string_builder_peek_chunks)>(*this, lib, "peek_chunks",
+                SideEffects::modifyExternal, "string_builder_peek_chunks")->args({"builder","block","context","lineinfo"});
+            // json
+            addExtern<DAS_BIND_FUN(builtin_json_parse)>(*this, lib, "json_parse_native",
+                SideEffects::modifyArgumentAndExternal, "builtin_json_parse")
+                    ->args({"text","json_value_size","allow_duplicate_keys","error","context","at"})->unsafeOperation = true;
+            addExtern<DAS_BIND_FUN(builtin_json_parse_bytes)>(*this, lib, "json_parse_native",
+                SideEffects::modifyArgumentAndExternal, "builtin_json_parse_bytes")
+                    ->args({"text","json_value_size","allow_duplicate_keys","error","context","at"})->unsafeOperation = true;
+            addExtern<DAS_BIND_FUN(builtin_json_tokenize)>(*this, lib, "json_tokenize_native",
+                SideEffects::invoke, "builtin_json_tokenize")
+                    ->args({"text","block","context","at"});
+            addExtern<DAS_BIND_FUN(builtin_json_tokenize_bytes)>(*this, lib, "json_tokenize_native",
+                SideEffects::invoke, "builtin_json_tokenize_bytes")
+                    ->args({"text","block","context","at"});
+            addInterop<builtin_json_read_into,char *,const char *,vec4f>(*this, lib, "json_read_into_native",
+                SideEffects::modifyArgumentAndExternal, "builtin_json_read_into")
+                    ->args({"text","value"})->unsafeOperation = true;
+            addExtern<DAS_BIND_FUN(builtin_json_write)>(*this, lib, "json_write_native",
+                SideEffects::modifyExternal, "builtin_json_write")
+                    ->args({"writer","value","json_value_size","no_trailing_zeros","no_empty_arrays","context","at"})->unsafeOperation = true;
             // fmt
             addExtern<DAS_BIND_FUN(fmt_and_write_i8),SimNode_ExtFuncCallRef> (*this, lib, "fmt",
                 SideEffects::modifyExternal, "fmt_and_write_i8")->args({"writer","format","value","context","lineinfo"});
@@ -181,7 +181,7 @@ extern "C" {
 #if DAS_ENABLE_STACK_WALK
         Prologue * pp = (Prologue *)context->stack.sp();
         pp->info = nullptr;
-        pp->fileName = "`jit`";
+        pp->fileName = JIT_PROLOGUE_FILE_NAME;
         pp->functionLine = (LineInfo *) funcLineInfo;
         pp->stackSize = stackSize;
 #endif
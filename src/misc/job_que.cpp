@@ -22,18 +22,27 @@ namespace das {
 
 #endif
 
-    JobQue::JobQue()
+    // worker thread which is currently running, so that jobs pushed from the job itself go to its own queue
+    static DAS_THREAD_LOCAL(JobQue *) g_workerQue;
+    static DAS_THREAD_LOCAL(int) g_workerIndex;
+
+    JobQue::JobQue ( int threadCount )
         : mSleepMs(1)
         , mShutdown(false)
-        , mThreadCount( 0 )
-        , mJobsRunning(0) {
-        mThreadCount = get_num_threads();
+        , mThreadCount( 0 ) {
+        mThreadCount = threadCount > 0 ? threadCount : get_num_threads();
         SetCurrentThreadPriority(JobPriority::High);
+        for (int j = 0, js = mThreadCount; j < js; j++) {
+            mQueues.emplace_back(make_unique<WorkerQueue>());
+        }
         for (int j = 0, js = mThreadCount; j < js; j++) {
             mThreads.emplace_back(make_unique<thread>([this, j]() {
                 string thread_name = "JobQue_Job_" + to_string(j);
                 SetCurrentThreadName(thread_name);
+                *g_workerQue = this;
+                *g_workerIndex = j;
                 job(j);
+                *g_workerQue = nullptr;
             }));
         }
     }
@@ -69,6 +78,10 @@ namespace das {
 
     void JobQue::join() {
         mShutdown = true;
+        {
+            lock_guard<mutex> lock(mSleepMutex);
+            mCond.notify_all();
+        }
         while ( mThreadCount ) {
             this_thread::yield();
         }
@@ -76,11 +89,12 @@ namespace das {
             th.threadPointer->join();
         }
         mThreads.clear();
+        mQueues.clear();
     }
 
     bool JobQue::isEmpty ( bool includingMainThreadJobs ) {
-        lock_guard<mutex> lock(mFifoMutex);
-        bool queue_is_empty = (mJobsRunning == 0) && (mFifo.size() == 0);
+        // pending count covers both queued and running jobs, it only drops after the job is done
+        bool queue_is_empty = mJobsPending == 0;
         if ( includingMainThreadJobs ) {
             lock_guard<mutex> mainThreadLock(mEvalMainThreadMutex);
             return queue_is_empty && mEvalMainThread.empty();
@@ -89,63 +103,134 @@ namespace das {
     }
 
     bool JobQue::areJobsPending(JobCategory category) {
-        lock_guard<mutex> lock(mFifoMutex);
-        if (find_if(mFifo.begin(), mFifo.end(), [=](const JobEntry& jobEntry) {
-                return jobEntry.category == category; }) != mFifo.end()) {
-            return true;
+        // queues first, then running state. job is marked as running before its removed from the queue
+        for ( auto & que : mQueues ) {
+            lock_guard<mutex> lock(que->mMutex);
+            if (find_if(que->mJobs.begin(), que->mJobs.end(), [=](const JobEntry& jobEntry) {
+                    return jobEntry.category == category; }) != que->mJobs.end()) {
+                return true;
+            }
         }
-        if (find_if(mThreads.begin(), mThreads.end(), [=](const ThreadEntry& threadEntry) {
-                return threadEntry.currentPriority != JobPriority::Inactive && threadEntry.currentCategory == category; }) != mThreads.end()) {
-            return true;
+        for ( auto & que : mQueues ) {
+            if ( que->currentPriority != JobPriority::Inactive && que->currentCategory == category ) {
+                return true;
+            }
         }
         return false;
     }
 
+    bool JobQue::isWorkerThread() const {
+        return *g_workerQue == this;
+    }
+
     int JobQue::getTotalHwJobs() {
         return mThreadCount;
     }
 
     int JobQue::getNumberOfQueuedJobs() {
-        lock_guard<mutex> lock(mFifoMutex);
-        return int(mFifo.size());
+        return mJobsQueued;
     }
 
-    void JobQue::submit(Job && job, JobCategory category, JobPriority priority) {
-        auto  it = lower_bound(mFifo.begin(), mFifo.end(), priority, [](const JobEntry& lhs, JobPriority priority) {
+    int JobQue::pickQueue() {
+        if ( *g_workerQue == this ) {
+            return *g_workerIndex;
+        }
+        return int(mNextQueue++ % uint32_t(mQueues.size()));
+    }
+
+    void JobQue::submit(int queueIndex, Job && job, JobCategory category, JobPriority priority) {
+        // called with the queue locked
+        auto & jobs = mQueues[queueIndex]->mJobs;
+        auto  it = lower_bound(jobs.begin(), jobs.end(), priority, [](const JobEntry& lhs, JobPriority priority) {
             return lhs.priority >= priority; });
-        mFifo.emplace(it, das::move(job), category, priority);
+        jobs.emplace(it, das::move(job), category, priority);
+        mQueues[queueIndex]->mTopPriority = int32_t(jobs.front().priority);
+        mQueues[queueIndex]->mSize++;
+        mJobsPending++;
+        mJobsQueued++;
+    }
+
+    void JobQue::wakeUp(int count) {
+        // sleeper increments mSleeping before it checks mJobsQueued, we increment mJobsQueued before we check mSleeping
+        if ( mSleeping ) {
+            lock_guard<mutex> lock(mSleepMutex);
+            if ( count==1 ) {
+                mCond.notify_one();
+            } else {
+                mCond.notify_all();
+            }
+        }
     }
 
     void JobQue::push(Job && job, JobCategory category, JobPriority priority) {
-        lock_guard<mutex> lock(mFifoMutex);
-        submit(das::move(job), category, priority);
-        mCond.notify_one();
+        int qi = pickQueue();
+        {
+            lock_guard<mutex> lock(mQueues[qi]->mMutex);
+            submit(qi, das::move(job), category, priority);
+        }
+        wakeUp(1);
+    }
+
+    bool JobQue::tryTake(WorkerQueue & que, int threadIndex, Job & job) {
+        lock_guard<mutex> lock(que.mMutex);
+        if ( que.mJobs.empty() ) return false;
+        auto & entry = que.mJobs.front();
+        job = das::move(entry.function);
+        // running state is published before the victim queue is unlocked, so areJobsPending never misses the job
+        auto & self = *mQueues[threadIndex];
+        self.currentCategory = entry.category;
+        self.currentPriority = entry.priority;
+        que.mJobs.pop_front();
+        que.mTopPriority = que.mJobs.empty() ? int32_t(WorkerQueue::EMPTY_PRIORITY) : int32_t(que.mJobs.front().priority);
+        que.mSize--;
+        mJobsQueued--;
+        return true;
+    }
+
+    bool JobQue::tryPop(int threadIndex, Job & job) {
+        int nq = int(mQueues.size());
+        // highest priority first, own queue wins the ties. the peek is racy, and if the pick is gone we fall back to the scan
+        int best = threadIndex;
+        int32_t bestPriority = mQueues[threadIndex]->mTopPriority;
+        for ( int i = 1; i < nq; ++i ) {
+            int victim = (threadIndex + i) % nq;
+            int32_t priority = mQueues[victim]->mTopPriority;
+            if ( priority > bestPriority ) {
+                best = victim;
+                bestPriority = priority;
+            }
+        }
+        if ( best!=threadIndex && tryTake(*mQueues[best], threadIndex, job) ) {
+            mSteals++;
+            return true;
+        }
+        if ( tryTake(*mQueues[threadIndex], threadIndex, job) ) return true;
+        for ( int i = 1; i < nq; ++i ) {
+            int victim = (threadIndex + i) % nq;
+            if ( mQueues[victim]->mSize == 0 ) continue;    // racy peek, we recheck under the lock
+            if ( tryTake(*mQueues[victim], threadIndex, job) ) {
+                mSteals++;
+                return true;
+            }
+        }
+        return false;
     }
 
     void JobQue::job(int threadIndex) {
+        auto & self = *mQueues[threadIndex];
         while (!mShutdown) {
             Job job;
-            {
-                unique_lock<mutex> lock(mFifoMutex);
-                if ( mCond.wait_for(lock, chrono::milliseconds(mSleepMs), [&]() { return mFifo.size() != 0; }) ) {
-                    DAS_ASSERTF(mFifo.size() > 0, "There must be at least one job available");
-                    job = das::move(mFifo.front().function);
-                    mThreads[threadIndex].currentPriority = mFifo.front().priority;
-                    mThreads[threadIndex].currentCategory = mFifo.front().category;
-                    mFifo.pop_front();
-                    mJobsRunning++;
-                } else {
-                    this_thread::yield();
-                    continue;
-                }
+            if ( !tryPop(threadIndex, job) ) {
+                unique_lock<mutex> lock(mSleepMutex);
+                mSleeping++;
+                mCond.wait_for(lock, chrono::milliseconds(mSleepMs), [&]() { return mJobsQueued != 0 || mShutdown; });
+                mSleeping--;
+                continue;
             }
-            SetCurrentThreadPriority(mThreads[threadIndex].currentPriority);
+            SetCurrentThreadPriority(self.currentPriority);
             job();
-            {
-                unique_lock<mutex> lock(mFifoMutex);
-                mThreads[threadIndex].currentPriority = JobPriority::Inactive;
-                mJobsRunning--;
-            }
+            self.currentPriority = JobPriority::Inactive;
+            mJobsPending--;
         }
         mThreadCount--;
     }
@@ -163,18 +248,22 @@ namespace das {
         int onMainThread = max ( (numChunks + mThreadCount)  / (mThreadCount+1), 1 );
         int onThreads  = numChunks - onMainThread;
         status.Clear(onThreads);
-        {
-            lock_guard<mutex> lock(mFifoMutex);
-            for (int ch = 0; ch < onThreads; ++ch) {
+        // chunks are dealt round-robin, one lock per worker queue
+        int nq = int(mQueues.size());
+        int first = pickQueue();
+        for ( int q = 0; q < nq && q < onThreads; ++q ) {
+            int qi = (first + q) % nq;
+            lock_guard<mutex> lock(mQueues[qi]->mMutex);
+            for (int ch = q; ch < onThreads; ch += nq) {
                 int i0 = from + ch * step;
                 int i1 = i0 + step;
-                submit([=,&status](){
+                submit(qi, [=,&status](){
                     chunk(i0, i1);
                     status.Notify();
                 }, category, priority);
             }
-            mCond.notify_all();
         }
+        wakeUp(onThreads);
         chunk(from + onThreads * step, to);
     }
 
@@ -199,20 +288,25 @@ namespace das {
         mutex producerFifoMutex;
         condition_variable condition;
         {
-            lock_guard<mutex> lock(mFifoMutex);
-            for (int ch = 0; ch < numChunks; ++ch) {
-                int i0 = from + ch * step;
-                int i1 = min(i0 + step, to);
-                submit([=, &chunk, &producerFifoJobs, &producerFifoMutex, &condition]() {
-                    chunk(i0, i1);
-                    {
-                        lock_guard<mutex> producerFifoLock(producerFifoMutex);
-                        producerFifoJobs.push_back(([=]() { consume(i0, i1); }));
-                        condition.notify_one();
-                    }
-                }, category, priority);
+            int nq = int(mQueues.size());
+            int first = pickQueue();
+            for ( int q = 0; q < nq && q < numChunks; ++q ) {
+                int qi = (first + q) % nq;
+                lock_guard<mutex> lock(mQueues[qi]->mMutex);
+                for (int ch = q; ch < numChunks; ch += nq) {
+                    int i0 = from + ch * step;
+                    int i1 = min(i0 + step, to);
+                    submit(qi, [=, &chunk, &producerFifoJobs, &producerFifoMutex, &condition]() {
+                        chunk(i0, i1);
+                        {
+                            lock_guard<mutex> producerFifoLock(producerFifoMutex);
+                            producerFifoJobs.push_back(([=]() { consume(i0, i1); }));
+                            condition.notify_one();
+                        }
+                    }, category, priority);
+                }
             }
-            mCond.notify_all();
+            wakeUp(numChunks);
         }
         {
             int chunksRemaining = numChunks;
@@ -3,6 +3,12 @@
 #include "daScript/misc/memory_model.h"
 #include "daScript/misc/debug_break.h"
 
+#include <mutex>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
 namespace das {
 
 #if DAS_TRACK_ALLOCATIONS
@@ -58,6 +64,41 @@ namespace das {
 
 #endif
 
+    #define DAS_HUGE_PAGE_SIZE  (2u*1024u*1024u)
+
+    char * das_deck_alloc ( uint32_t bytes, bool hugePages ) {
+        DAS_ASSERT(bytes && (bytes & (DAS_DECK_PAGE_SIZE-1))==0);
+#if defined(__linux__)
+        if ( hugePages && bytes>=DAS_HUGE_PAGE_SIZE ) {
+            void * mem = nullptr;
+            if ( posix_memalign(&mem, DAS_HUGE_PAGE_SIZE, bytes)==0 ) {
+                madvise(mem, bytes, MADV_HUGEPAGE);     // transparent huge pages, ignored when not available
+                return (char *) mem;
+            }
+        }
+#else
+        (void) hugePages;
+#endif
+#if defined(_MSC_VER)
+        return (char *) _aligned_malloc(bytes, DAS_DECK_PAGE_SIZE);
+#else
+        void * mem = nullptr;
+        if ( posix_memalign(&mem, DAS_DECK_PAGE_SIZE, bytes) ) {
+            DAS_ASSERTF(0, "posix_memalign returned nullptr");
+            return nullptr;
+        }
+        return (char *) mem;
+#endif
+    }
+
+    void das_deck_free ( char * ptr, uint32_t ) {
+#if defined(_MSC_VER)
+        _aligned_free(ptr);
+#else
+        ::free(ptr);
+#endif
+    }
+
     MemoryModel::MemoryModel () {
         alignMask = 15;
         totalAllocated = 0;
@@ -80,6 +121,13 @@ namespace das {
 #endif
     }
 
+    bool MemoryModel::setFreeListMode ( bool freeLists, bool huge ) {
+        if ( !shoe.empty() ) return false;
+        shoe.freeListMode = freeLists;
+        hugePages = huge;
+        return true;
+    }
+
     void MemoryModel::setInitialSize ( uint32_t size ) {
         initialSize = size;
     }
@@ -126,14 +174,85 @@ namespace das {
             DAS_ASSERT(size && size<=DAS_MAX_SHOE_ALLOCATION);
             uint32_t si = (size >> 4) - 1;
             uint32_t total = grow(si);
-            shoe.chunks[si] = new Deck(total, size, shoe.chunks[si]);
+            shoe.addDeck(si, new Deck(total, size, shoe.chunks[si], shoe.freeListMode, hugePages));
+            if ( gcActive ) shoe.chunks[si]->allocateGcBits();
+            shoe.countAllocation(si);
             return shoe.chunks[si]->allocate();
         }
 #endif
     }
 
+    // big allocations are few, so parallel mark simply serializes on them
+    static mutex g_bigStuffMarkLock;
+
+    bool MemoryModel::markAtomic ( char * ptr, uint32_t size ) {
+        size = (size + alignMask) & ~alignMask;
+#if !DAS_TRACK_ALLOCATIONS
+        if ( size <= DAS_MAX_SHOE_ALLOCATION ) {
+            return shoe.markAtomic(ptr, size);
+        }
+#endif
+        auto it = bigStuff.find(ptr);   // no allocations during the mark phase, so lookup is safe
+        if ( it != bigStuff.end() ) {
+            lock_guard<mutex> guard(g_bigStuffMarkLock);
+            if ( it->second & DAS_PAGE_GC_MASK ) return false;
+            it->second |= DAS_PAGE_GC_MASK;
+            return true;
+        }
+        return false;
+    }
+
+    void MemoryModel::beforeGC() {
+        shoe.beforeGC();
+        gcActive = true;
+    }
+
+    void MemoryModel::cancelGC() {
+        shoe.cancelGC();
+        for ( auto & it : bigStuff ) {
+            it.second &= ~DAS_PAGE_GC_MASK;
+        }
+        gcActive = false;
+    }
+
+    void MemoryModel::setDeferFree ( bool defer ) {
+        deferFree = defer;
+    }
+
+    void MemoryModel::flushDeferredFree ( bool unmark ) {
+        DAS_ASSERT(!deferFree);
+        for ( auto & df : deferredFree ) {
+            auto size = (df.second + alignMask) & ~alignMask;
+            if ( unmark ) {
+#if !DAS_TRACK_ALLOCATIONS
+                if ( size <= DAS_MAX_SHOE_ALLOCATION ) {
+                    shoe.unmark(df.first, size);
+                } else
+#endif
+                {
+                    auto it = bigStuff.find(df.first);
+                    if ( it != bigStuff.end() ) it->second &= ~DAS_PAGE_GC_MASK;
+                }
+            }
+            free(df.first, df.second);
+        }
+        deferredFree.clear();
+    }
+
+    void MemoryModel::forEachChunk ( const callable<void(char *,uint64_t)> & fn ) const {
+        for ( uint32_t si=0; si!=DAS_MAX_SHOE_CUNKS; ++si ) {
+            for ( auto ch=shoe.chunks[si]; ch; ch=ch->next ) {
+                fn(ch->data, ch->totalBytes);
+            }
+        }
+    }
+
     bool MemoryModel::free ( char * ptr, uint32_t size ) {
         if ( !size ) return true;
+        if ( deferFree ) {
+            deferredFree.emplace_back(ptr, size);
+            return true;
+        }
         size = (size + alignMask) & ~alignMask;
 
 #if DAS_SANITIZER
@@ -197,6 +316,9 @@ namespace das {
     }
 
     void MemoryModel::reset() {
+        if ( gcActive ) cancelGC();
+        deferFree = false;
+        deferredFree.clear();
         for ( auto & itb : bigStuff ) {
 #if DAS_SANITIZER
             memset(itb.first, 0xcd, itb.second);
@@ -241,11 +363,14 @@ namespace das {
     }
 
     void MemoryModel::sweep() {
+        gcActive = false;
         totalAllocated = 0;
 #if !DAS_TRACK_ALLOCATIONS
         for ( uint32_t si=0; si!=DAS_MAX_SHOE_CUNKS; ++si ) {   // we re-track all small allocations
+            shoe.counters[si].live = 0;
             for ( auto ch=shoe.chunks[si]; ch; ch=ch->next ) {
                 ch->afterGC();
+                shoe.counters[si].live += ch->allocated;
                 uint32_t utotal = ch->total / 32;
                 for ( uint32_t i=0; i!=utotal; ++i ) {
                     uint32_t b = ch->bits[i];
@@ -20,17 +20,26 @@
 #endif
 
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <netdb.h>
+#include <poll.h>
 #include <unistd.h>
 #include <errno.h>
 #include <fcntl.h>
 
-#define closesocket close
+#define closesocket ::close   // global one, MultiServer::close would hide it
 
 #ifdef __APPLE__
 #include <sys/errno.h>
 #endif
 
+#ifdef __linux__
+#include <sys/epoll.h>
+#define DAS_NETWORK_EPOLL   1
+#endif
+
 #endif
 
 namespace das {
@@ -209,4 +218,540 @@ namespace das {
     bool Server::is_connected() const {
         return client_fd > 0;
     }
+
+    // multi-connection server
+
+#ifdef _WIN32
+    static int socket_error() { return WSAGetLastError(); }
+    static bool would_block ( int err ) { return err==0 || err==WSAEWOULDBLOCK; }
+    static bool connect_in_progress ( int err ) { return err==WSAEWOULDBLOCK; }
+    #define DAS_SEND_FLAGS  0
+#else
+    static int socket_error() { return errno; }
+    static bool would_block ( int err ) { return err==0 || err==EAGAIN || err==EWOULDBLOCK || err==EINTR; }
+    static bool connect_in_progress ( int err ) { return err==EINPROGRESS || err==EINTR; }
+    #ifdef MSG_NOSIGNAL
+        #define DAS_SEND_FLAGS  MSG_NOSIGNAL
+    #else
+        #define DAS_SEND_FLAGS  0
+    #endif
+#endif
+
+    #define DAS_NETWORK_RECV_CHUNK  65536
+    #define DAS_NETWORK_MAX_PARTS   64
+    #define DAS_NETWORK_MAX_EVENTS  256
+
+#ifndef DAS_NETWORK_MAX_INBOX
+    #define DAS_NETWORK_MAX_INBOX   (4*1024*1024)   // read per connection per tick, the rest waits in the socket
+#endif
+
+    MultiServer::MultiServer() {
+    }
+
+    MultiServer::~MultiServer() {
+        for ( auto id : order ) {
+            if ( auto con = find(id) ) {
+                closesocket(con->fd);
+                delete con;
+            }
+        }
+        if ( server_fd ) {
+            closesocket(server_fd);
+        }
+#if DAS_NETWORK_EPOLL
+        if ( poll_fd!=-1 ) {
+            ::close(poll_fd);
+        }
+#endif
+    }
+
+    bool MultiServer::init ( int port, int backlog ) {
+        if ( server_fd ) {
+            onError("already initialized", -1);
+            return false;
+        }
+#if DAS_NETWORK_EPOLL
+        if ( poll_fd==-1 ) {
+            poll_fd = epoll_create1(0);
+            if ( poll_fd==-1 ) {
+                onError("can't epoll_create", socket_error());
+                return false;
+            }
+        }
+#endif
+        socket_t fd = socket(AF_INET, SOCK_STREAM, 0);
+        if ( invalid_socket(fd) ) {
+            onError("can't socket", socket_error());
+            return false;
+        }
+        int val = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, (const char *)&val, sizeof(val));
+        struct sockaddr_in address;
+        memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = INADDR_ANY;
+        address.sin_port = htons(uint16_t(port));
+        if ( ::bind(fd, (struct sockaddr *)&address, sizeof(address))<0 ) {
+            onError("can't bind", socket_error());
+            closesocket(fd);
+            return false;
+        }
+        if ( listen(fd, backlog)<0 ) {
+            onError("can't listen", socket_error());
+            closesocket(fd);
+            return false;
+        }
+        if ( !set_socket_blocking(fd,false) ) {
+            onError("can't set nbio", socket_error());
+            closesocket(fd);
+            return false;
+        }
+#if DAS_NETWORK_EPOLL
+        struct epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.u64 = 0;    // listener
+        if ( epoll_ctl(poll_fd, EPOLL_CTL_ADD, fd, &ev)!=0 ) {
+            onError("can't epoll_ctl", socket_error());
+            closesocket(fd);
+            return false;
+        }
+#endif
+        server_fd = fd;
+        return true;
+    }
+
+    int32_t MultiServer::get_port() const {
+        if ( !server_fd ) return 0;
+        struct sockaddr_in address;
+        socklen_t addrlen = sizeof(address);
+        if ( getsockname(server_fd, (struct sockaddr *)&address, &addrlen)!=0 ) return 0;
+        return ntohs(address.sin_port);
+    }
+
+    bool MultiServer::is_open() const {
+        return server_fd != 0;
+    }
+
+    int32_t MultiServer::connections() const {
+        return int32_t(conns.size());
+    }
+
+    bool MultiServer::is_connected ( int32_t conn ) const {
+        auto con = find(conn);
+        return con && !con->closing && !con->connecting;
+    }
+
+    uint64_t MultiServer::pending ( int32_t conn ) const {
+        auto con = find(conn);
+        return con ? uint64_t(con->outbox.size() - con->outboxOffset) : 0;
+    }
+
+    MultiServer::Connection * MultiServer::find ( int32_t conn ) const {
+        auto it = conns.find(conn);
+        return it!=conns.end() ? it->second : nullptr;
+    }
+
+    int32_t MultiServer::addConnection ( socket_t fd, bool connecting ) {
+#if DAS_NETWORK_EPOLL
+        if ( poll_fd==-1 ) {
+            poll_fd = epoll_create1(0);
+            if ( poll_fd==-1 ) {
+                error("can't epoll_create", socket_error());
+                closesocket(fd);
+                return 0;
+            }
+        }
+#endif
+        if ( !set_socket_blocking(fd,false) ) {
+            error("can't set client nbio", socket_error());
+            closesocket(fd);
+            return 0;
+        }
+        int val = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, (const char *)&val, sizeof(val));
+        auto con = new Connection();
+        con->fd = fd;
+        con->id = ++lastId;
+        if ( lastId==INT32_MAX ) lastId = 0;
+        con->connecting = connecting;
+        con->wantWrite = connecting;    // connect completes when the socket becomes writable
+#if DAS_NETWORK_EPOLL
+        struct epoll_event ev;
+        ev.events = EPOLLIN | EPOLLRDHUP | (connecting ? EPOLLOUT : 0);
+        ev.data.u64 = uint64_t(con->id);
+        if ( epoll_ctl(poll_fd, EPOLL_CTL_ADD, fd, &ev)!=0 ) {
+            error("can't epoll_ctl", socket_error());
+            closesocket(fd);
+            delete con;
+            return 0;
+        }
+#endif
+        conns[con->id] = con;
+        order.push_back(con->id);
+        return con->id;
+    }
+
+    int32_t MultiServer::connect ( const char * host, int port ) {
+        struct addrinfo hints;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+        struct addrinfo * res = nullptr;
+        char service[16];
+        snprintf(service, sizeof(service), "%i", port);
+        int err = getaddrinfo(host ? host : "127.0.0.1", service, &hints, &res);
+        if ( err!=0 || !res ) {
+            error("can't resolve host", err);
+            return 0;
+        }
+        socket_t fd = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+        if ( invalid_socket(fd) ) {
+            error("can't socket", socket_error());
+            freeaddrinfo(res);
+            return 0;
+        }
+        if ( !set_socket_blocking(fd,false) ) {
+            error("can't set client nbio", socket_error());
+            closesocket(fd);
+            freeaddrinfo(res);
+            return 0;
+        }
+        // non-blocking connect, tick finishes it once the socket is writable. until then sends are queued
+        bool connecting = false;
+        if ( ::connect(fd, res->ai_addr, socklen_t(res->ai_addrlen))!=0 ) {
+            int cerr = socket_error();
+            if ( !connect_in_progress(cerr) ) {
+                error("can't connect", cerr);
+                closesocket(fd);
+                freeaddrinfo(res);
+                return 0;
+            }
+            connecting = true;
+        }
+        freeaddrinfo(res);
+        return addConnection(fd, connecting);
+    }
+
+    void MultiServer::acceptAll() {
+        for ( ;; ) {
+            struct sockaddr_in address;
+            socklen_t addrlen = sizeof(address);
+            socket_t fd = accept(server_fd, (struct sockaddr *)&address, &addrlen);
+            if ( invalid_socket(fd) ) {
+                int err = socket_error();
+                if ( !would_block(err) ) error("can't accept", err);
+                return;
+            }
+            if ( addConnection(fd) ) {
+                log("connection accepted");
+            }
+        }
+    }
+
+    // reads up to DAS_NETWORK_MAX_INBOX per tick. whatever is left stays in the socket, and tcp flow control
+    // slows the sender down until the script catches up
+    void MultiServer::readAll ( Connection * con ) {
+        while ( con->inbox.size() < DAS_NETWORK_MAX_INBOX ) {
+            size_t at = con->inbox.size();
+            con->inbox.resize(at + DAS_NETWORK_RECV_CHUNK);
+            int res = int(recv(con->fd, con->inbox.data() + at, DAS_NETWORK_RECV_CHUNK, 0));
+            if ( res>0 ) {
+                con->inbox.resize(at + res);
+                if ( res<DAS_NETWORK_RECV_CHUNK ) return;
+            } else {
+                con->inbox.resize(at);
+                if ( res==0 ) {
+                    log("connection closed");
+                    con->closing = true;
+                } else {
+                    int err = socket_error();
+                    if ( !would_block(err) ) fail(con, "connection closed on error", err);
+                }
+                return;
+            }
+        }
+    }
+
+    void MultiServer::watchWrite ( Connection * con, bool write ) {
+        if ( con->wantWrite==write ) return;
+        con->wantWrite = write;
+#if DAS_NETWORK_EPOLL
+        struct epoll_event ev;
+        ev.events = EPOLLIN | EPOLLRDHUP | (write ? EPOLLOUT : 0);
+        ev.data.u64 = uint64_t(con->id);
+        epoll_ctl(poll_fd, EPOLL_CTL_MOD, con->fd, &ev);
+#endif
+    }
+
+    void MultiServer::fail ( Connection * con, const char * msg, int code ) {
+        if ( con->broken ) return;
+        error(msg, code);
+        con->broken = true;
+        con->closing = true;
+    }
+
+    void MultiServer::hangup ( Connection * con ) {
+        if ( con->connecting ) {
+            writable(con);      // failed connect, reported with its error
+            return;
+        }
+        con->broken = true;
+        con->closing = true;
+    }
+
+    // finishes the outgoing connect, then sends what is queued
+    void MultiServer::writable ( Connection * con ) {
+        if ( con->connecting ) {
+            int err = 0;
+            socklen_t len = sizeof(err);
+            if ( getsockopt(con->fd, SOL_SOCKET, SO_ERROR, (char *)&err, &len)!=0 ) err = socket_error();
+            if ( err!=0 ) {
+                fail(con, "can't connect", err);
+                return;
+            }
+            con->connecting = false;
+        }
+        flush(con);
+    }
+
+    void MultiServer::error ( const char * msg, int code ) {
+        if ( inIo ) {
+            deferred.push_back(Deferred{msg, code, true});
+        } else {
+            onError(msg, code);
+        }
+    }
+
+    void MultiServer::log ( const char * msg ) {
+        if ( inIo ) {
+            deferred.push_back(Deferred{msg, 0, false});
+        } else {
+            onLog(msg);
+        }
+    }
+
+    // sends what is queued, returns false if the connection failed
+    bool MultiServer::flush ( Connection * con ) {
+        while ( con->outboxOffset < con->outbox.size() ) {
+            size_t left = con->outbox.size() - con->outboxOffset;
+            int res = int(send(con->fd, con->outbox.data() + con->outboxOffset, int(left), DAS_SEND_FLAGS));
+            if ( res>0 ) {
+                con->outboxOffset += uint32_t(res);
+            } else {
+                int err = socket_error();
+                if ( !would_block(err) ) {
+                    fail(con, "can't send", err);
+                    return false;
+                }
+                watchWrite(con, true);
+                return true;
+            }
+        }
+        con->outbox.clear();
+        con->outboxOffset = 0;
+        watchWrite(con, false);
+        return true;
+    }
+
+    void MultiServer::queue ( Connection * con, const char * data, uint32_t size ) {
+        con->outbox.insert(con->outbox.end(), data, data + size);
+        watchWrite(con, true);
+    }
+
+    bool MultiServer::send_msg ( int32_t conn, const char * data, uint32_t size ) {
+        NetBuffer part = { data, size };
+        return send_msgv(conn, &part, 1);
+    }
+
+    // gathers the parts into as few system calls as possible, whatever does not fit into the socket is queued
+    bool MultiServer::send_msgv ( int32_t conn, const NetBuffer * parts, uint32_t count ) {
+        auto con = find(conn);
+        if ( !con || con->closing ) {
+            error("can't send, not connected", -1);
+            return false;
+        }
+        uint32_t first = 0;
+        uint32_t offset = 0;    // already sent bytes of parts[first]
+        if ( con->outbox.empty() && !con->connecting ) {
+            while ( first < count ) {
+                uint32_t n = 0;
+#ifdef _WIN32
+                WSABUF iov[DAS_NETWORK_MAX_PARTS];
+                for ( uint32_t i=first; i<count && n<DAS_NETWORK_MAX_PARTS; ++i, ++n ) {
+                    iov[n].buf = (char *) parts[i].data + (i==first ? offset : 0);
+                    iov[n].len = parts[i].size - (i==first ? offset : 0);
+                }
+                DWORD sent = 0;
+                int res = WSASend(con->fd, iov, n, &sent, 0, nullptr, nullptr)==0 ? int(sent) : -1;
+#else
+                struct iovec iov[DAS_NETWORK_MAX_PARTS];
+                for ( uint32_t i=first; i<count && n<DAS_NETWORK_MAX_PARTS; ++i, ++n ) {
+                    iov[n].iov_base = (void *)(parts[i].data + (i==first ? offset : 0));
+                    iov[n].iov_len = parts[i].size - (i==first ? offset : 0);
+                }
+                struct msghdr msg;
+                memset(&msg, 0, sizeof(msg));
+                msg.msg_iov = iov;
+                msg.msg_iovlen = n;
+                int res = int(sendmsg(con->fd, &msg, DAS_SEND_FLAGS));
+#endif
+                if ( res<0 ) {
+                    int err = socket_error();
+                    if ( !would_block(err) ) {
+                        fail(con, "can't send", err);
+                        return false;
+                    }
+                    break;
+                }
+                uint32_t sent = uint32_t(res);
+                while ( first<count && sent>=parts[first].size-offset ) {
+                    sent -= parts[first].size - offset;
+                    offset = 0;
+                    first ++;
+                }
+                offset += sent;
+                if ( res==0 && n ) break;
+            }
+        }
+        for ( ; first < count; ++first, offset=0 ) {
+            queue(con, parts[first].data + offset, parts[first].size - offset);
+        }
+        return true;
+    }
+
+    void MultiServer::close ( int32_t conn ) {
+        if ( auto con = find(conn) ) {
+            con->closing = true;
+        }
+    }
+
+    int32_t MultiServer::tick ( int32_t timeoutMs ) {
+        int32_t total = 0;
+        inIo = true;
+#if DAS_NETWORK_EPOLL
+        if ( poll_fd!=-1 ) {
+            struct epoll_event events[DAS_NETWORK_MAX_EVENTS];
+            int n = epoll_wait(poll_fd, events, DAS_NETWORK_MAX_EVENTS, timeoutMs);
+            for ( int i=0; i<n; ++i ) {
+                auto & ev = events[i];
+                if ( ev.data.u64==0 ) {
+                    acceptAll();
+                    continue;
+                }
+                auto con = find(int32_t(ev.data.u64));
+                if ( !con ) continue;
+                if ( ev.events & EPOLLIN ) readAll(con);
+                if ( (ev.events & EPOLLOUT) && !con->broken ) writable(con);
+                if ( ev.events & (EPOLLERR|EPOLLHUP) ) hangup(con);
+                else if ( ev.events & EPOLLRDHUP ) con->closing = true;     // what is queued can still go out
+            }
+            total = n>0 ? n : 0;
+        }
+#else
+        vector<struct pollfd> fds;
+        fds.reserve(order.size() + 1);
+        if ( server_fd ) fds.push_back({ server_fd, POLLIN, 0 });
+        for ( auto id : order ) {
+            if ( auto con = find(id) ) {
+                fds.push_back({ con->fd, short(POLLIN | (con->wantWrite ? POLLOUT : 0)), 0 });
+            }
+        }
+        if ( !fds.empty() ) {
+#ifdef _WIN32
+            int n = WSAPoll(fds.data(), ULONG(fds.size()), timeoutMs);
+#else
+            int n = poll(fds.data(), nfds_t(fds.size()), timeoutMs);
+#endif
+            if ( n>0 ) {
+                size_t i = 0;
+                if ( server_fd ) {
+                    if ( fds[i].revents & POLLIN ) acceptAll();
+                    i ++;
+                }
+                for ( auto id : order ) {
+                    auto con = find(id);
+                    if ( !con ) continue;
+                    auto revents = fds[i++].revents;
+                    if ( revents & POLLIN ) readAll(con);
+                    if ( (revents & POLLOUT) && !con->broken ) writable(con);
+                    if ( revents & (POLLERR|POLLHUP) ) hangup(con);
+                    if ( i==fds.size() ) break;
+                }
+                total = n;
+            }
+        }
+#endif
+        inIo = false;
+        dispatch();
+        return total;
+    }
+
+    // callbacks go after all the io is done, they are free to send or close anything
+    void MultiServer::dispatch() {
+        if ( !deferred.empty() ) {
+            auto events = das::move(deferred);
+            deferred.clear();
+            for ( auto & ev : events ) {
+                if ( ev.isError ) {
+                    onError(ev.msg.c_str(), ev.code);
+                } else {
+                    onLog(ev.msg.c_str());
+                }
+            }
+        }
+        auto ids = order;
+        for ( auto id : ids ) {
+            auto con = find(id);
+            if ( !con || con->connecting ) continue;
+            if ( !con->connected && !con->broken ) {
+                con->connected = true;
+                onConnect(id);
+            }
+            if ( !con->inbox.empty() ) {
+                batch.clear();
+                swap(batch, con->inbox);
+                batch.push_back(0);
+                onData(id, batch.data(), int(batch.size() - 1));
+            }
+        }
+        for ( auto id : ids ) {
+            auto con = find(id);
+            if ( !con || !con->closing ) continue;
+            if ( con->inbox.empty() ) {
+                if ( con->connecting && !con->broken ) {
+                    continue;       // closed before the connect finished, queued data goes out once it does
+                }
+                if ( !con->broken && con->outboxOffset < con->outbox.size() ) {
+                    flush(con);     // closed from script, deliver what is queued
+                    if ( !con->broken && con->outboxOffset < con->outbox.size() ) {
+                        continue;   // the socket is full, the connection stays until the rest goes out
+                    }
+                }
+                conns.erase(id);
+                order.erase(std::remove(order.begin(), order.end(), id), order.end());
+                if ( con->connected ) onDisconnect(id);
+#if DAS_NETWORK_EPOLL
+                epoll_ctl(poll_fd, EPOLL_CTL_DEL, con->fd, nullptr);
+#endif
+                closesocket(con->fd);
+                delete con;
+            }
+        }
+    }
+
+    void MultiServer::onConnect ( int32_t ) {
+    }
+
+    void MultiServer::onDisconnect ( int32_t ) {
+    }
+
+    void MultiServer::onData ( int32_t, char *, int ) {
+    }
+
+    void MultiServer::onError ( const char *, int ) {
+    }
+
+    void MultiServer::onLog ( const char * ) {
+    }
 }
+
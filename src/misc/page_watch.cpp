@@ -0,0 +1,261 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/misc/page_watch.h"
+
+#include <atomic>
+#include <thread>
+
+#if defined(_MSC_VER) && !defined(_GAMING_XBOX) && !defined(_DURANGO)
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+    #define DAS_PAGE_WATCH_WINDOWS  1
+#elif (defined(__linux__) || defined(__APPLE__)) && !defined(__EMSCRIPTEN__)
+    #include <signal.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #define DAS_PAGE_WATCH_POSIX    1
+#endif
+
+namespace das {
+
+#if DAS_PAGE_WATCH_WINDOWS || DAS_PAGE_WATCH_POSIX
+
+    #define DAS_MAX_PAGE_WATCHES    64
+
+    static atomic<PageWriteWatch *> g_pageWatches[DAS_MAX_PAGE_WATCHES];
+    static atomic<int>              g_pageFaultsInFlight{0};
+    static mutex                    g_pageWatchMutex;
+    static bool                     g_pageWatchHandlerInstalled = false;
+
+    static uintptr_t pageSize() {
+        static uintptr_t ps = 0;
+        if ( !ps ) {
+#if DAS_PAGE_WATCH_WINDOWS
+            SYSTEM_INFO si;
+            GetSystemInfo(&si);
+            ps = uintptr_t(si.dwPageSize);
+#else
+            ps = uintptr_t(sysconf(_SC_PAGESIZE));
+#endif
+        }
+        return ps;
+    }
+
+    static bool protectPages ( uintptr_t from, uintptr_t to, bool readOnly ) {
+#if DAS_PAGE_WATCH_WINDOWS
+        DWORD oldProtect = 0;
+        return VirtualProtect((void *)from, SIZE_T(to-from), readOnly ? PAGE_READONLY : PAGE_READWRITE, &oldProtect)!=0;
+#else
+        return mprotect((void *)from, size_t(to-from), readOnly ? PROT_READ : (PROT_READ|PROT_WRITE))==0;
+#endif
+    }
+
+    static bool onAnyPageWatchFault ( const void * addr ) {
+        g_pageFaultsInFlight ++;
+        bool handled = false;
+        for ( int i=0; i!=DAS_MAX_PAGE_WATCHES && !handled; ++i ) {
+            if ( auto watch = g_pageWatches[i].load() ) {
+                handled = watch->onWriteFault(addr);
+            }
+        }
+        g_pageFaultsInFlight --;
+        return handled;
+    }
+
+#if DAS_PAGE_WATCH_WINDOWS
+
+    static LONG NTAPI pageWatchVEH ( struct _EXCEPTION_POINTERS * ExceptionInfo ) {
+        auto rec = ExceptionInfo->ExceptionRecord;
+        if ( rec->ExceptionCode==EXCEPTION_ACCESS_VIOLATION && rec->NumberParameters>=2 && rec->ExceptionInformation[0]==1 ) {
+            if ( onAnyPageWatchFault((const void *)rec->ExceptionInformation[1]) ) {
+                return EXCEPTION_CONTINUE_EXECUTION;
+            }
+        }
+        return EXCEPTION_CONTINUE_SEARCH;
+    }
+
+    static bool installPageWatchHandler() {
+        return AddVectoredExceptionHandler(1, pageWatchVEH)!=nullptr;
+    }
+
+#else
+
+    static struct sigaction g_prevSegv;
+    static struct sigaction g_prevBus;
+
+    static void pageWatchSignalHandler ( int sig, siginfo_t * info, void * ucontext ) {
+        if ( onAnyPageWatchFault(info->si_addr) ) return;
+        // not ours, pass it to whoever was there before
+        struct sigaction & prev = sig==SIGSEGV ? g_prevSegv : g_prevBus;
+        if ( prev.sa_flags & SA_SIGINFO ) {
+            if ( prev.sa_sigaction ) {
+                prev.sa_sigaction(sig, info, ucontext);
+                return;
+            }
+        } else if ( prev.sa_handler!=SIG_DFL && prev.sa_handler!=SIG_IGN ) {
+            prev.sa_handler(sig);
+            return;
+        }
+        // default action, the faulting instruction will run again and terminate the process
+        sigaction(sig, &prev, nullptr);
+    }
+
+    static bool installPageWatchHandler() {
+        struct sigaction act;
+        memset(&act, 0, sizeof(act));
+        act.sa_sigaction = pageWatchSignalHandler;
+        act.sa_flags = SA_SIGINFO | SA_ONSTACK | SA_NODEFER;
+        sigemptyset(&act.sa_mask);
+        if ( sigaction(SIGSEGV, &act, &g_prevSegv)!=0 ) return false;
+        if ( sigaction(SIGBUS, &act, &g_prevBus)!=0 ) return false;    // macOS reports protection faults as SIGBUS
+        return true;
+    }
+
+#endif
+
+    bool PageWriteWatch::isSupported() {
+        return true;
+    }
+
+    PageWriteWatch::~PageWriteWatch() {
+        stop();
+    }
+
+    void PageWriteWatch::addRegion ( char * ptr, uint64_t size ) {
+        DAS_ASSERT(!started && "can't add regions to the started page watch");
+        auto ps = pageSize();
+        uintptr_t first = (uintptr_t(ptr) + ps - 1) & ~(ps - 1);
+        uintptr_t last = (uintptr_t(ptr) + uintptr_t(size)) & ~(ps - 1);
+        if ( first < last ) {
+            regions.push_back({first, last, nullptr});
+        }
+    }
+
+    bool PageWriteWatch::start() {
+        DAS_ASSERT(!started && "page watch can only be started once");
+        started = true;
+        if ( regions.empty() ) return false;
+        {
+            lock_guard<mutex> lock(g_pageWatchMutex);
+            if ( !g_pageWatchHandlerInstalled ) {
+                if ( !installPageWatchHandler() ) return false;
+                g_pageWatchHandlerInstalled = true;
+            }
+        }
+        auto ps = pageSize();
+        sort(regions.begin(), regions.end(), [](const Region & a, const Region & b) {
+            return a.first < b.first;
+        });
+        size_t totalPages = 0;
+        for ( auto & r : regions ) totalPages += (r.last - r.first) / ps;
+        dirtyStorage.resize(totalPages, 0);
+        size_t offset = 0;
+        for ( auto & r : regions ) {
+            r.dirty = dirtyStorage.data() + offset;
+            offset += (r.last - r.first) / ps;
+        }
+        for ( int i=0; i!=DAS_MAX_PAGE_WATCHES; ++i ) {
+            PageWriteWatch * expected = nullptr;
+            if ( g_pageWatches[i].compare_exchange_strong(expected, this) ) {
+                slot = i;
+                break;
+            }
+        }
+        if ( slot==-1 ) {   // too many watches at once
+            memset(dirtyStorage.data(), 1, dirtyStorage.size());
+            return false;
+        }
+        active = true;
+        for ( auto & r : regions ) {
+            if ( !protectPages(r.first, r.last, true) ) {
+                memset(r.dirty, 1, (r.last - r.first) / ps);
+            }
+        }
+        return true;
+    }
+
+    void PageWriteWatch::stop() {
+        if ( !active ) return;
+        for ( auto & r : regions ) {
+            protectPages(r.first, r.last, false);
+        }
+        g_pageWatches[slot].store(nullptr);
+        slot = -1;
+        while ( g_pageFaultsInFlight.load() ) {
+            this_thread::yield();
+        }
+        active = false;
+    }
+
+    bool PageWriteWatch::onWriteFault ( const void * addr ) {
+        uintptr_t a = uintptr_t(addr);
+        auto it = upper_bound(regions.begin(), regions.end(), a, [](uintptr_t x, const Region & r) {
+            return x < r.first;
+        });
+        if ( it==regions.begin() ) return false;
+        -- it;
+        if ( a >= it->last ) return false;
+        auto ps = pageSize();
+        uintptr_t page = (a - it->first) / ps;
+        it->dirty[page] = 1;
+        protectPages(it->first + page*ps, it->first + (page+1)*ps, false);
+        return true;
+    }
+
+    bool PageWriteWatch::isDirty ( const char * ptr, uint64_t size ) const {
+        if ( !started || regions.empty() || dirtyStorage.empty() ) return true;
+        uintptr_t a = uintptr_t(ptr);
+        auto it = upper_bound(regions.begin(), regions.end(), a, [](uintptr_t x, const Region & r) {
+            return x < r.first;
+        });
+        if ( it==regions.begin() ) return true;
+        -- it;
+        uintptr_t b = a + uintptr_t(size);
+        if ( b > it->last ) return true;
+        auto ps = pageSize();
+        for ( uintptr_t page = (a - it->first) / ps, lastPage = (b - 1 - it->first) / ps; page <= lastPage; ++page ) {
+            if ( it->dirty[page] ) return true;
+        }
+        return false;
+    }
+
+#else
+
+    bool PageWriteWatch::isSupported() {
+        return false;
+    }
+
+    PageWriteWatch::~PageWriteWatch() {
+    }
+
+    void PageWriteWatch::addRegion ( char *, uint64_t ) {
+    }
+
+    bool PageWriteWatch::start() {
+        started = true;
+        return false;
+    }
+
+    void PageWriteWatch::stop() {
+    }
+
+    bool PageWriteWatch::onWriteFault ( const void * ) {
+        return false;
+    }
+
+    bool PageWriteWatch::isDirty ( const char *, uint64_t ) const {
+        return true;
+    }
+
+#endif
+
+    uint64_t PageWriteWatch::dirtyPages() const {
+        uint64_t count = 0;
+        for ( auto d : dirtyStorage ) count += d;
+        return count;
+    }
+
+    uint64_t PageWriteWatch::watchedPages() const {
+        return dirtyStorage.size();
+    }
+}
@@ -181,6 +181,82 @@ namespace das {
         }
     }
 
+    // chunked text writer
+
+    ChunkedTextWriter::~ChunkedTextWriter() {
+        for ( auto & ch : chunks ) {
+            das_aligned_free16(ch.data);
+        }
+    }
+
+    string ChunkedTextWriter::str() const {
+        string res;
+        res.resize(size_t(total));
+        copyTo(&res[0]);
+        return res;
+    }
+
+    uint64_t ChunkedTextWriter::tellp() const {
+        return total;
+    }
+
+    void ChunkedTextWriter::output() {
+        // nothing to do
+    }
+
+    // first chunk stays, so that the builder which is reused does not allocate again
+    void ChunkedTextWriter::clear() {
+        for ( size_t i=1; i<chunks.size(); ++i ) {
+            das_aligned_free16(chunks[i].data);
+        }
+        if ( chunks.size() ) {
+            chunks.resize(1);
+            chunks[0].size = 0;
+        }
+        total = 0;
+    }
+
+    void ChunkedTextWriter::copyTo ( char * dest ) const {
+        for ( auto & ch : chunks ) {
+            memcpy(dest, ch.data, ch.size);
+            dest += ch.size;
+        }
+    }
+
+    void ChunkedTextWriter::newChunk ( uint32_t minCapacity ) {
+        uint32_t capacity = chunks.empty() ? DAS_STRING_BUILDER_BUFFER_SIZE : min(chunks.back().capacity * 2, uint32_t(DAS_STRING_CHUNK_SIZE));
+        if ( capacity < minCapacity ) capacity = minCapacity;
+        chunks.push_back({(char *) das_aligned_alloc16(capacity), 0, capacity});
+    }
+
+    void ChunkedTextWriter::append(const char * s, int l) {
+        uint32_t left = uint32_t(l);
+        while ( left ) {
+            if ( chunks.empty() || chunks.back().size==chunks.back().capacity ) {
+                newChunk(0);
+            }
+            auto & ch = chunks.back();
+            uint32_t n = min(left, ch.capacity - ch.size);
+            memcpy(ch.data + ch.size, s, n);
+            ch.size += n;
+            s += n;
+            left -= n;
+        }
+        total += uint32_t(l);
+    }
+
+    // has to be contiguous, so the tail of the last chunk may stay unused
+    char * ChunkedTextWriter::allocate (int l) {
+        if ( chunks.empty() || chunks.back().capacity - chunks.back().size < uint32_t(l) ) {
+            newChunk(uint32_t(l));
+        }
+        auto & ch = chunks.back();
+        char * res = ch.data + ch.size;
+        ch.size += uint32_t(l);
+        total += uint32_t(l);
+        return res;
+    }
+
     // TextPrinter
 
     void TextPrinter::output() {
@@ -1934,7 +1934,7 @@ return DAS_DEF;
 case 38:
 YY_RULE_SETUP
 #line 270 "ds2_lexer.lpp"
-return DAS_DEF;
+{ yylval_param->s = new string(yytext); return NAME; }
 	YY_BREAK
 case 39:
 YY_RULE_SETUP
@@ -0,0 +1,595 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/runtime_table.h"
+#include "daScript/simulate/debug_print.h"
+
+/*
+    snapshot of the context state, as the global initializers left it
+
+    the code of the context is rebuilt by simulate (and the program itself comes from the compile cache),
+    but evaluating the global initializers is skipped - the values of the globals are restored from the image
+    instead. [init] functions still run after the restore, see Context::runInitScript ( false, true )
+
+    header
+    per variable
+        mangled name hash, type hash, shared flag, size of the value in bytes, value
+    value is written by its TypeInfo
+        plain data (no pointers of any kind)    raw bytes
+        string                                  length+1 (0 for null), then the characters
+        array                                   size, then the elements
+        table                                   capacity, size, tombstones, hashes and control bytes, then key and value of the every occupied slot
+        pointer                                 tag (null, seen before, heap object, into globals, into shared), then the object
+        function                                mangled name hash
+        structure, tuple, variant, dim          field by field
+    lambdas, iterators, blocks and smart pointers can't be restored, unless they are null
+*/
+
+namespace das {
+
+    #define DAS_CONTEXT_SNAPSHOT_MAGIC      0x504e5344u     // 'DSNP'
+    #define DAS_CONTEXT_SNAPSHOT_VERSION    2
+
+    struct ContextSnapshotHeader {
+        uint32_t    magic;
+        uint32_t    version;
+        uint64_t    initHash;
+        uint64_t    globalsSize;
+        uint64_t    sharedSize;
+        uint32_t    totalVariables;
+        uint32_t    pointerSize;
+    };
+
+    enum class SnapshotPtr : uint8_t {
+        null
+    ,   seen
+    ,   heap
+    ,   globals
+    ,   shared
+    };
+
+    static bool isClassWithRtti ( StructInfo * si ) {
+        return (si->flags & StructInfo::flag_class) && si->count && si->fields[0]->name && strcmp(si->fields[0]->name,"__rtti")==0;
+    }
+
+    // plain data is copied byte by byte
+    class SnapshotTypes {
+    public:
+        bool isPlain ( TypeInfo * ti ) {
+            auto it = plain.find(ti);
+            if ( it!=plain.end() ) return it->second;
+            plain[ti] = false;  // recursive types are not plain anyway
+            bool res = computePlain(ti);
+            plain[ti] = res;
+            return res;
+        }
+    protected:
+        bool computePlain ( TypeInfo * ti ) {
+            switch ( ti->type ) {
+                case Type::tString:
+                case Type::tPointer:
+                case Type::tArray:
+                case Type::tTable:
+                case Type::tFunction:
+                case Type::tLambda:
+                case Type::tIterator:
+                case Type::tBlock:
+                case Type::tVoid:
+                case Type::anyArgument:
+                case Type::autoinfer:
+                case Type::alias:
+                case Type::option:
+                case Type::typeDecl:
+                case Type::typeMacro:
+                case Type::fakeContext:
+                case Type::fakeLineInfo:
+                case Type::none:
+                    return false;
+                case Type::tHandle:
+                    return ti->isRawPod();
+                case Type::tStructure:
+                    if ( isClassWithRtti(ti->structType) ) return false;
+                    for ( uint32_t i=0, is=ti->structType->count; i!=is; ++i ) {
+                        if ( !isPlain(ti->structType->fields[i]) ) return false;
+                    }
+                    return true;
+                case Type::tTuple:
+                case Type::tVariant:
+                    for ( uint32_t i=0, is=ti->argCount; i!=is; ++i ) {
+                        if ( !isPlain(ti->argTypes[i]) ) return false;
+                    }
+                    return true;
+                default:
+                    return true;
+            }
+        }
+        das_hash_map<TypeInfo *,bool>   plain;
+    };
+
+    class SnapshotWriter : public SnapshotTypes {
+    public:
+        SnapshotWriter ( Context & ctx, vector<uint8_t> & img, uint64_t gsize, uint64_t ssize )
+            : context(&ctx), image(img), globalsSize(gsize), sharedSize(ssize) {}
+        void write ( const void * data, size_t size ) {
+            auto bytes = (const uint8_t *) data;
+            image.insert(image.end(), bytes, bytes + size);
+        }
+        template <typename TT>
+        void put ( TT value ) {
+            write(&value, sizeof(TT));
+        }
+        bool fail ( const string & message ) {
+            if ( error.empty() ) error = message;
+            return false;
+        }
+        bool value ( char * pv, TypeInfo * ti ) {
+            if ( isPlain(ti) ) {
+                write(pv, ti->size);
+                return true;
+            }
+            if ( ti->dimSize ) {
+                TypeInfo eti = *ti;
+                uint32_t count = ti->dim[0];
+                eti.size = count ? ti->size / count : ti->size;
+                eti.dimSize --;
+                eti.dim = ti->dim + 1;
+                for ( uint32_t i=0; i!=count; ++i ) {
+                    if ( !value(pv + size_t(i) * eti.size, &eti) ) return false;
+                }
+                return true;
+            }
+            switch ( ti->type ) {
+                case Type::tString: {
+                    auto str = *(char **)pv;
+                    uint32_t len = str ? uint32_t(strlen(str)) : 0;
+                    put<uint32_t>(str ? len + 1 : 0);
+                    if ( len ) write(str, len);
+                    return true;
+                }
+                case Type::tArray: {
+                    auto & arr = *(Array *)pv;
+                    put<uint32_t>(arr.size);
+                    auto eti = ti->firstType;
+                    for ( uint32_t i=0; i!=arr.size; ++i ) {
+                        if ( !value(arr.data + size_t(i) * eti->size, eti) ) return false;
+                    }
+                    return true;
+                }
+                case Type::tTable:      return table(*(Table *)pv, ti);
+                case Type::tPointer:    return pointer(*(char **)pv, ti);
+                case Type::tFunction: {
+                    auto fn = ((Func *)pv)->PTR;
+                    put<uint64_t>(fn ? fn->mangledNameHash : 0);
+                    return true;
+                }
+                case Type::tLambda:
+                case Type::tIterator:
+                case Type::tBlock:
+                    if ( *(void **)pv ) return fail("can't snapshot " + debug_type(ti));
+                    return true;
+                case Type::tStructure:  return structure(pv, ti->structType);
+                case Type::tTuple:
+                    for ( uint32_t i=0, is=ti->argCount; i!=is; ++i ) {
+                        if ( !value(pv + getTupleFieldOffset(ti, i), ti->argTypes[i]) ) return false;
+                    }
+                    return true;
+                case Type::tVariant: {
+                    auto index = *(int32_t *)pv;
+                    put<int32_t>(index);
+                    if ( uint32_t(index)>=ti->argCount ) return fail("invalid variant index in " + debug_type(ti));
+                    return value(pv + getVariantFieldOffset(ti, index), ti->argTypes[index]);
+                }
+                default:
+                    return fail("can't snapshot " + debug_type(ti));
+            }
+        }
+        bool structure ( char * ps, StructInfo * si ) {
+            uint32_t first = 0;
+            if ( isClassWithRtti(si) ) {
+                auto rtti = *(TypeInfo **)(ps + si->fields[0]->offset);
+                put<uint64_t>(rtti ? rtti->hash : 0);
+                first = 1;
+            }
+            for ( uint32_t i=first, is=si->count; i!=is; ++i ) {
+                auto vi = si->fields[i];
+                if ( !value(ps + vi->offset, vi) ) return false;
+            }
+            return true;
+        }
+        bool table ( Table & tab, TypeInfo * ti ) {
+            put<uint32_t>(tab.capacity);
+            put<uint32_t>(tab.size);
+            put<uint32_t>(tab.tombstones);
+            if ( !tab.capacity ) return true;
+            auto kti = ti->firstType;
+            auto vti = ti->secondType;
+            if ( kti->type==Type::tPointer ) return fail("can't snapshot " + debug_type(ti) + ", keys are hashed by address");
+            uint32_t valueSize = vti ? vti->size : 0;
+            write(tab.hashes, tab.capacity * sizeof(TableHashKey));
+            write(tab.ctrl(), tab.capacity + TABLE_CTRL_GROUP);
+            for ( uint32_t i=0; i!=tab.capacity; ++i ) {
+                if ( tab.hashes[i]>HASH_KILLED64 ) {
+                    if ( !value(tab.keys + size_t(i) * kti->size, kti) ) return false;
+                    if ( valueSize && !value(tab.data + size_t(i) * valueSize, vti) ) return false;
+                }
+            }
+            return true;
+        }
+        bool pointer ( char * ptr, TypeInfo * ti ) {
+            if ( !ptr ) {
+                put(SnapshotPtr::null);
+                return true;
+            }
+            if ( ti->isSmartPtr() ) return fail("can't snapshot " + debug_type(ti));
+            auto it = seen.find(ptr);
+            if ( it!=seen.end() ) {
+                put(SnapshotPtr::seen);
+                put<uint32_t>(it->second);
+                return true;
+            }
+            if ( ptr>=context->globals && ptr<context->globals+globalsSize ) {
+                put(SnapshotPtr::globals);
+                put<uint64_t>(ptr - context->globals);
+                return true;
+            }
+            if ( context->isSharedPtr(ptr) ) {
+                put(SnapshotPtr::shared);
+                put<uint64_t>(ptr - context->shared);
+                return true;
+            }
+            TypeInfo * pti = ti->firstType;
+            if ( !pti || pti->type==Type::tVoid ) return fail("can't snapshot " + debug_type(ti));
+            uint64_t dynamicType = 0;
+            if ( pti->type==Type::tStructure && isClassWithRtti(pti->structType) ) {
+                if ( auto rtti = *(TypeInfo **)ptr ) {
+                    pti = rtti;
+                    dynamicType = rtti->hash;
+                }
+            }
+            if ( !context->heap->isOwnPtr(ptr, pti->size) ) {
+                return fail("can't snapshot " + debug_type(ti) + ", it points outside of the context heap");
+            }
+            put(SnapshotPtr::heap);
+            put<uint64_t>(dynamicType);
+            seen[ptr] = uint32_t(seen.size());
+            return value(ptr, pti);
+        }
+    public:
+        string  error;
+    protected:
+        Context *                       context;
+        vector<uint8_t> &               image;
+        uint64_t                        globalsSize;
+        uint64_t                        sharedSize;
+        das_hash_map<char *,uint32_t>   seen;
+    };
+
+    class SnapshotReader : public SnapshotTypes {
+    public:
+        SnapshotReader ( Context & ctx, const uint8_t * img, size_t size, uint64_t gsize, uint64_t ssize )
+            : context(&ctx), data(img), dataSize(size), globalsSize(gsize), sharedSize(ssize) {}
+        bool read ( void * dst, size_t size ) {
+            if ( size > dataSize - pos ) return fail("snapshot is truncated");
+            memcpy(dst, data + pos, size);
+            pos += size;
+            return true;
+        }
+        template <typename TT>
+        bool get ( TT & value ) {
+            return read(&value, sizeof(TT));
+        }
+        bool fail ( const string & message ) {
+            if ( error.empty() ) error = message;
+            return false;
+        }
+        bool value ( char * pv, TypeInfo * ti ) {
+            if ( isPlain(ti) ) {
+                return read(pv, ti->size);
+            }
+            if ( ti->dimSize ) {
+                TypeInfo eti = *ti;
+                uint32_t count = ti->dim[0];
+                eti.size = count ? ti->size / count : ti->size;
+                eti.dimSize --;
+                eti.dim = ti->dim + 1;
+                for ( uint32_t i=0; i!=count; ++i ) {
+                    if ( !value(pv + size_t(i) * eti.size, &eti) ) return false;
+                }
+                return true;
+            }
+            switch ( ti->type ) {
+                case Type::tString: {
+                    uint32_t len = 0;
+                    if ( !get(len) ) return false;
+                    if ( len==0 ) {
+                        *(char **)pv = nullptr;
+                    } else {
+                        len --;
+                        if ( len > dataSize - pos ) return fail("snapshot is truncated");
+                        *(char **)pv = context->allocateString((const char *)(data + pos), len, nullptr);
+                        pos += len;
+                    }
+                    return true;
+                }
+                case Type::tArray: {
+                    auto & arr = *(Array *)pv;
+                    uint32_t size = 0;
+                    if ( !get(size) ) return false;
+                    memset(&arr, 0, sizeof(Array));
+                    auto eti = ti->firstType;
+                    if ( size ) {
+                        if ( size > dataSize - pos ) return fail("snapshot is truncated");
+                        array_resize(*context, arr, size, eti->size, true, nullptr);
+                        for ( uint32_t i=0; i!=size; ++i ) {
+                            if ( !value(arr.data + size_t(i) * eti->size, eti) ) return false;
+                        }
+                    }
+                    arr.shared = markShared;
+                    return true;
+                }
+                case Type::tTable:      return table(*(Table *)pv, ti);
+                case Type::tPointer:    return pointer(*(char **)pv, ti);
+                case Type::tFunction: {
+                    uint64_t mnh = 0;
+                    if ( !get(mnh) ) return false;
+                    auto fn = context->fnByMangledName(mnh);
+                    if ( mnh && !fn ) return fail("function is missing in " + debug_type(ti));
+                    ((Func *)pv)->PTR = fn;
+                    return true;
+                }
+                case Type::tLambda:
+                case Type::tIterator:
+                case Type::tBlock:
+                    *(void **)pv = nullptr;
+                    return true;
+                case Type::tStructure:  return structure(pv, ti->structType);
+                case Type::tTuple:
+                    for ( uint32_t i=0, is=ti->argCount; i!=is; ++i ) {
+                        if ( !value(pv + getTupleFieldOffset(ti, i), ti->argTypes[i]) ) return false;
+                    }
+                    return true;
+                case Type::tVariant: {
+                    int32_t index = 0;
+                    if ( !get(index) ) return false;
+                    if ( uint32_t(index)>=ti->argCount ) return fail("invalid variant index in " + debug_type(ti));
+                    *(int32_t *)pv = index;
+                    return value(pv + getVariantFieldOffset(ti, index), ti->argTypes[index]);
+                }
+                default:
+                    return fail("can't restore " + debug_type(ti));
+            }
+        }
+        bool structure ( char * ps, StructInfo * si ) {
+            uint32_t first = 0;
+            if ( isClassWithRtti(si) ) {
+                uint64_t hash = 0;
+                if ( !get(hash) ) return false;
+                TypeInfo * rtti = nullptr;
+                if ( hash && !(rtti = findClassType(hash)) ) return fail(string("class type is missing for ") + si->name);
+                *(TypeInfo **)(ps + si->fields[0]->offset) = rtti;
+                first = 1;
+            }
+            for ( uint32_t i=first, is=si->count; i!=is; ++i ) {
+                auto vi = si->fields[i];
+                if ( !value(ps + vi->offset, vi) ) return false;
+            }
+            return true;
+        }
+        bool table ( Table & tab, TypeInfo * ti ) {
+            uint32_t capacity = 0, size = 0, tombstones = 0;
+            if ( !get(capacity) || !get(size) || !get(tombstones) ) return false;
+            memset(&tab, 0, sizeof(Table));
+            if ( !capacity ) return true;
+            if ( (capacity & (capacity - 1)) || size > capacity ) return fail("invalid table in the snapshot");
+            auto kti = ti->firstType;
+            auto vti = ti->secondType;
+            uint32_t keySize = kti->size;
+            uint32_t valueSize = vti ? vti->size : 0;
+            uint64_t memSize64 = table_mem_size(capacity, uint64_t(keySize) + uint64_t(valueSize));
+            if ( memSize64>=0xffffffff ) return fail("invalid table in the snapshot");
+            uint32_t memSize = uint32_t(memSize64);
+            tab.data = context->allocate(memSize, nullptr);
+            if ( !tab.data ) context->throw_out_of_memory(false, memSize, nullptr);
+            context->heap->mark_comment(tab.data, "table");
+            tab.keys = tab.data + size_t(capacity) * valueSize;
+            tab.hashes = (TableHashKey *)(tab.keys + size_t(capacity) * keySize);
+            tab.capacity = capacity;
+            tab.size = size;
+            tab.tombstones = tombstones;
+            memset(tab.data, 0, size_t(capacity) * (keySize + valueSize));
+            if ( !read(tab.hashes, capacity * sizeof(TableHashKey)) ) return false;
+            if ( !read(tab.ctrl(), capacity + TABLE_CTRL_GROUP) ) return false;
+            for ( uint32_t i=0; i!=capacity; ++i ) {
+                if ( tab.hashes[i]>HASH_KILLED64 ) {
+                    if ( !value(tab.keys + size_t(i) * keySize, kti) ) return false;
+                    if ( valueSize && !value(tab.data + size_t(i) * valueSize, vti) ) return false;
+                }
+            }
+            tab.shared = markShared;
+            return true;
+        }
+        bool pointer ( char * & ptr, TypeInfo * ti ) {
+            SnapshotPtr tag;
+            if ( !get(tag) ) return false;
+            switch ( tag ) {
+                case SnapshotPtr::null:
+                    ptr = nullptr;
+                    return true;
+                case SnapshotPtr::seen: {
+                    uint32_t index = 0;
+                    if ( !get(index) ) return false;
+                    if ( index>=seen.size() ) return fail("invalid pointer in the snapshot");
+                    ptr = seen[index];
+                    return true;
+                }
+                case SnapshotPtr::globals:
+                case SnapshotPtr::shared: {
+                    uint64_t offset = 0;
+                    if ( !get(offset) ) return false;
+                    bool inShared = tag==SnapshotPtr::shared;
+                    if ( offset>=(inShared ? sharedSize : globalsSize) ) return fail("invalid pointer in the snapshot");
+                    ptr = (inShared ? context->shared : context->globals) + offset;
+                    return true;
+                }
+                case SnapshotPtr::heap: {
+                    uint64_t dynamicType = 0;
+                    if ( !get(dynamicType) ) return false;
+                    TypeInfo * pti = ti->firstType;
+                    if ( !pti ) return fail("can't restore " + debug_type(ti));
+                    if ( dynamicType ) {
+                        pti = findClassType(dynamicType);
+                        if ( !pti ) return fail("class type is missing for " + debug_type(ti));
+                    }
+                    uint32_t bytes = pti->size;
+                    char * np = context->allocate(bytes, nullptr);
+                    if ( !np ) context->throw_out_of_memory(false, bytes, nullptr);
+                    context->heap->mark_comment(np, "new");
+                    memset(np, 0, bytes);
+                    seen.push_back(np);
+                    ptr = np;
+                    return value(np, pti);
+                }
+                default:
+                    return fail("invalid pointer in the snapshot");
+            }
+        }
+        // classes are found by their type hash, among the types the context knows about
+        TypeInfo * findClassType ( uint64_t hash ) {
+            if ( !classTypesCollected ) {
+                classTypesCollected = true;
+                for ( int i=0, is=context->getTotalVariables(); i!=is; ++i ) {
+                    collectTypes(context->getVariableInfo(i));
+                }
+                for ( int i=0, is=context->getTotalFunctions(); i!=is; ++i ) {
+                    auto fi = context->getFunction(i)->debugInfo;
+                    if ( !fi ) continue;
+                    for ( uint32_t a=0; a!=fi->count; ++a ) collectTypes(fi->fields[a]);
+                    collectTypes(fi->result);
+                    for ( uint32_t l=0; l!=fi->localCount; ++l ) collectTypes(fi->locals[l]);
+                }
+                visited.clear();
+            }
+            auto it = classTypes.find(hash);
+            return it!=classTypes.end() ? it->second : nullptr;
+        }
+        void collectTypes ( TypeInfo * ti ) {
+            if ( !ti || !visited.insert(ti).second ) return;
+            if ( ti->type==Type::tStructure && ti->structType ) {
+                if ( ti->structType->flags & StructInfo::flag_class ) classTypes[ti->hash] = ti;
+                for ( uint32_t i=0, is=ti->structType->count; i!=is; ++i ) collectTypes(ti->structType->fields[i]);
+            }
+            collectTypes(ti->firstType);
+            collectTypes(ti->secondType);
+            for ( uint32_t i=0, is=ti->argTypes ? ti->argCount : 0; i!=is; ++i ) collectTypes(ti->argTypes[i]);
+        }
+    public:
+        string  error;
+        size_t  pos = 0;
+        bool    markShared = false;
+    protected:
+        Context *                       context;
+        const uint8_t *                 data;
+        size_t                          dataSize;
+        uint64_t                        globalsSize;
+        uint64_t                        sharedSize;
+        vector<char *>                  seen;
+        bool                            classTypesCollected = false;
+        das_hash_map<uint64_t,TypeInfo *> classTypes;
+        das_set<TypeInfo *>             visited;
+    };
+
+    bool Context::saveInitSnapshot ( vector<uint8_t> & image, string & error ) {
+        image.clear();
+        if ( !globalsOwner ) {
+            error = "context does not own its globals";
+            return false;
+        }
+        ContextSnapshotHeader header;
+        header.magic = DAS_CONTEXT_SNAPSHOT_MAGIC;
+        header.version = DAS_CONTEXT_SNAPSHOT_VERSION;
+        header.initHash = getInitSemanticHash();
+        header.globalsSize = globalsSize;
+        header.sharedSize = sharedSize;
+        header.totalVariables = uint32_t(totalVariables);
+        header.pointerSize = uint32_t(sizeof(void *));
+        SnapshotWriter writer(*this, image, globalsSize, sharedSize);
+        writer.write(&header, sizeof(header));
+        for ( int i=0, is=totalVariables; i!=is; ++i ) {
+            auto & pv = globalVariables[i];
+            writer.put<uint64_t>(pv.mangledNameHash);
+            writer.put<uint64_t>(pv.debugInfo->hash);
+            writer.put<uint32_t>(pv.shared ? 1 : 0);
+            size_t sizeAt = image.size();
+            writer.put<uint64_t>(0);
+            if ( !pv.shared || sharedOwner ) {
+                if ( !writer.value((pv.shared ? shared : globals) + pv.offset, pv.debugInfo) ) {
+                    error = string(pv.name) + ": " + writer.error;
+                    image.clear();
+                    return false;
+                }
+            }
+            uint64_t valueSize = image.size() - sizeAt - sizeof(uint64_t);
+            memcpy(image.data() + sizeAt, &valueSize, sizeof(uint64_t));
+        }
+        return true;
+    }
+
+    bool Context::restoreInitSnapshot ( const uint8_t * image, size_t size, string & error ) {
+        DAS_ASSERTF(insideContext==0,"can't restore snapshot on the locked context");
+        ContextSnapshotHeader header;
+        if ( !image || size<sizeof(header) ) {
+            error = "snapshot is truncated";
+            return false;
+        }
+        memcpy(&header, image, sizeof(header));
+        if ( header.magic!=DAS_CONTEXT_SNAPSHOT_MAGIC || header.version!=DAS_CONTEXT_SNAPSHOT_VERSION || header.pointerSize!=sizeof(void *) ) {
+            error = "not a snapshot, or snapshot of the different version";
+            return false;
+        }
+        if ( header.initHash!=getInitSemanticHash() || header.globalsSize!=globalsSize || header.sharedSize!=sharedSize
+                || header.totalVariables!=uint32_t(totalVariables) ) {
+            error = "snapshot is of the different program";
+            return false;
+        }
+        if ( !globalsOwner ) {
+            error = "context does not own its globals";
+            return false;
+        }
+        SnapshotReader reader(*this, image, size, globalsSize, sharedSize);
+        reader.pos = sizeof(header);
+        if ( globals ) memset(globals, 0, globalsSize);
+        if ( shared && sharedOwner ) memset(shared, 0, sharedSize);
+        for ( int i=0, is=totalVariables; i!=is; ++i ) {
+            auto & pv = globalVariables[i];
+            uint64_t mnh = 0, typeHash = 0, valueSize = 0;
+            uint32_t isShared = 0;
+            if ( !reader.get(mnh) || !reader.get(typeHash) || !reader.get(isShared) || !reader.get(valueSize) ) {
+                error = reader.error;
+                return false;
+            }
+            if ( mnh!=pv.mangledNameHash || typeHash!=pv.debugInfo->hash || bool(isShared)!=bool(pv.shared) ) {
+                error = string(pv.name) + ": snapshot is of the different program";
+                return false;
+            }
+            if ( valueSize > size - reader.pos ) {
+                error = "snapshot is truncated";
+                return false;
+            }
+            if ( pv.shared && !sharedOwner ) {
+                reader.pos += valueSize;    // shared globals are already there
+                continue;
+            }
+            size_t valueAt = reader.pos;
+            reader.markShared = pv.shared;
+            if ( !reader.value((pv.shared ? shared : globals) + pv.offset, pv.debugInfo) ) {
+                error = string(pv.name) + ": " + reader.error;
+                return false;
+            }
+            if ( reader.pos - valueAt != valueSize ) {
+                error = string(pv.name) + ": snapshot is corrupted";
+                return false;
+            }
+        }
+        return true;
+    }
+}
@@ -850,4 +850,14 @@ namespace das
             fp.second->freeSourceData();
         }
     }
+
+    vector<string> FileAccess::getLoadedFileNames() const {
+        vector<string> names;
+        names.reserve(files.size());
+        for ( auto & fp : files ) {
+            names.push_back(fp.first);
+        }
+        sort(names.begin(), names.end());
+        return names;
+    }
 }
@@ -53,10 +53,22 @@ namespace das {
     PersistentHeapAllocator::PersistentHeapAllocator() {}
 
     bool PersistentHeapAllocator::mark() {
-        model.shoe.beforeGC();
+        model.beforeGC();
         return true;
     }
 
+    bool PersistentHeapAllocator::beginIncrementalMark() {
+        model.beforeGC();
+        model.setDeferFree(true);
+        return true;
+    }
+
+    void PersistentHeapAllocator::endIncrementalMark ( bool cancel ) {
+        model.setDeferFree(false);
+        if ( cancel ) model.cancelGC();
+        model.flushDeferredFree(!cancel);
+    }
+
     bool PersistentHeapAllocator::mark ( char * ptr, uint32_t len ) {
         auto size = (len + 15) & ~15; // model.alignMask
 #if !DAS_TRACK_ALLOCATIONS
@@ -78,7 +90,11 @@ namespace das {
     void PersistentHeapAllocator::report() {
         LOG tout(LogLevel::debug);
         for ( uint32_t si=0; si!=DAS_MAX_SHOE_CUNKS; ++si ) {
-            if ( model.shoe.chunks[si] ) tout << "decks of size " << int((si+1)<<4) << "\n";
+            if ( model.shoe.chunks[si] ) {
+                auto & cnt = model.shoe.counters[si];
+                tout << "decks of size " << int((si+1)<<4) << (model.shoe.freeListMode ? " (free lists)" : "")
+                    << ", " << cnt.allocations << " allocations, " << cnt.frees << " frees, peak " << cnt.peak << "\n";
+            }
             for ( auto ch=model.shoe.chunks[si]; ch; ch=ch->next ) {
                 tout << HEX << "\t" << "[" << uint64_t(ch->data) << ".." << (uint64_t(ch->data)+(ch->size*ch->total)) << ")\n" << DEC;
                 tout << "\t" << ch->allocated << " of " << ch->total << ", " << (ch->allocated*ch->size) << " of " << ch->totalBytes << " bytes\n";
@@ -154,6 +170,12 @@ namespace das {
             return nullptr;
         }
     }
+    bool PersistentHeapAllocator::getSizeClassStats ( int32_t si, HeapSizeClassStats & stats ) const {
+        if ( si<0 || si>=DAS_MAX_SHOE_CUNKS ) return false;
+        model.shoe.getSizeClassStats(uint32_t(si), stats);
+        return true;
+    }
+
     int PersistentHeapAllocator::depth() const { return model.depth(); }
     uint64_t PersistentHeapAllocator::bytesAllocated() const { return model.bytesAllocated(); }
     uint64_t PersistentHeapAllocator::totalAlignedMemoryAllocated() const { return model.totalAlignedMemoryAllocated(); }
@@ -378,10 +400,22 @@ namespace das {
     }
 
     bool PersistentStringAllocator::mark() {
-        model.shoe.beforeGC();
+        model.beforeGC();
         return true;
     }
 
+    bool PersistentStringAllocator::beginIncrementalMark() {
+        model.beforeGC();
+        model.setDeferFree(true);
+        return true;
+    }
+
+    void PersistentStringAllocator::endIncrementalMark ( bool cancel ) {
+        model.setDeferFree(false);
+        if ( cancel ) model.cancelGC();
+        model.flushDeferredFree(!cancel);
+    }
+
     void PersistentStringAllocator::sweep() {
         model.sweep();
         if ( needIntern ) {
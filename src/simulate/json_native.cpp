@@ -0,0 +1,1378 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/json_native.h"
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/runtime_table.h"
+#include "daScript/simulate/hash.h"
+#include "daScript/simulate/debug_print.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/ast/ast.h"
+
+#include "misc/include_fmt.h"
+#include <fast_float/fast_float.h>
+
+namespace das {
+
+    static __forceinline bool is_white_space ( char ch ) {
+        return ch==' ' || ch=='\n' || ch=='\r' || ch=='\t';
+    }
+
+    static __forceinline bool is_number ( char ch ) {
+        return ch>='0' && ch<='9';
+    }
+
+    static __forceinline bool is_alpha ( char ch ) {
+        return (ch>='a' && ch<='z') || (ch>='A' && ch<='Z');
+    }
+
+    static __forceinline int hex_digit ( char ch ) {
+        if ( ch>='0' && ch<='9' ) return ch - '0';
+        if ( ch>='a' && ch<='f' ) return ch - 'a' + 10;
+        if ( ch>='A' && ch<='F' ) return ch - 'A' + 10;
+        return -1;
+    }
+
+    // 16 bytes of the input at a time. mask has laneShift bits per byte, same as TableGroup
+    struct JsonChunk {
+#if _TARGET_SIMD_SSE
+        enum { laneShift = 0 };
+        __m128i data;
+        __forceinline JsonChunk ( const char * pos ) : data(_mm_loadu_si128((const __m128i *)pos)) {}
+        __forceinline __m128i eq ( char ch ) const { return _mm_cmpeq_epi8(data, _mm_set1_epi8(ch)); }
+        __forceinline uint64_t notWhiteSpace() const {
+            auto ws = _mm_or_si128(_mm_or_si128(eq(' '), eq('\n')), _mm_or_si128(eq('\r'), eq('\t')));
+            return uint32_t(_mm_movemask_epi8(ws)) ^ 0xffffu;
+        }
+        __forceinline uint64_t quoteOrEscape() const {
+            return uint32_t(_mm_movemask_epi8(_mm_or_si128(eq('"'), eq('\\'))));
+        }
+#elif _TARGET_SIMD_NEON
+        enum { laneShift = 2 };
+        uint8x16_t data;
+        __forceinline JsonChunk ( const char * pos ) : data(vld1q_u8((const uint8_t *)pos)) {}
+        __forceinline uint8x16_t eq ( char ch ) const { return vceqq_u8(data, vdupq_n_u8(uint8_t(ch))); }
+        static __forceinline uint64_t toMask ( uint8x16_t eq ) {
+            uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(eq), 4);
+            return vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & UINT64_C(0x8888888888888888);
+        }
+        __forceinline uint64_t notWhiteSpace() const {
+            auto ws = vorrq_u8(vorrq_u8(eq(' '), eq('\n')), vorrq_u8(eq('\r'), eq('\t')));
+            return toMask(vmvnq_u8(ws));
+        }
+        __forceinline uint64_t quoteOrEscape() const {
+            return toMask(vorrq_u8(eq('"'), eq('\\')));
+        }
+#else
+        enum { laneShift = 0 };
+        const char * data;
+        __forceinline JsonChunk ( const char * pos ) : data(pos) {}
+        __forceinline uint64_t notWhiteSpace() const {
+            uint64_t res = 0;
+            for ( uint32_t i=0; i!=16; ++i ) {
+                if ( !is_white_space(data[i]) ) res |= uint64_t(1) << i;
+            }
+            return res;
+        }
+        __forceinline uint64_t quoteOrEscape() const {
+            uint64_t res = 0;
+            for ( uint32_t i=0; i!=16; ++i ) {
+                if ( data[i]=='"' || data[i]=='\\' ) res |= uint64_t(1) << i;
+            }
+            return res;
+        }
+#endif
+        static __forceinline uint32_t lane ( uint64_t mask ) {
+            return uint32_t(das_ctz64(mask)) >> laneShift;
+        }
+    };
+
+    static void append_utf8 ( string & str, uint32_t cp ) {
+        if ( cp < 0x80 ) {
+            str += char(cp);
+        } else if ( cp < 0x800 ) {
+            str += char(0xc0 | (cp >> 6));
+            str += char(0x80 | (cp & 0x3f));
+        } else if ( cp < 0x10000 ) {
+            str += char(0xe0 | (cp >> 12));
+            str += char(0x80 | ((cp >> 6) & 0x3f));
+            str += char(0x80 | (cp & 0x3f));
+        } else {
+            str += char(0xf0 | (cp >> 18));
+            str += char(0x80 | ((cp >> 12) & 0x3f));
+            str += char(0x80 | ((cp >> 6) & 0x3f));
+            str += char(0x80 | (cp & 0x3f));
+        }
+    }
+
+    void JsonScanner::skipWhiteSpace() {
+        // compact json mostly has nothing to skip
+        if ( cur<end && !is_white_space(*cur) ) return;
+        while ( cur + 16 <= end ) {
+            if ( auto m = JsonChunk(cur).notWhiteSpace() ) {
+                cur += JsonChunk::lane(m);
+                return;
+            }
+            cur += 16;
+        }
+        while ( cur<end && is_white_space(*cur) ) cur++;
+    }
+
+    void JsonScanner::describeAt ( string & text ) const {
+        int32_t line = 1;
+        const char * lineStart = begin;
+        for ( const char * ch = begin; ch < cur; ++ch ) {
+            if ( *ch=='\n' ) {
+                line ++;
+                lineStart = ch + 1;
+            }
+        }
+        text += " at ";
+        text += to_string(line);
+        text += ":";
+        text += to_string(int32_t(cur - lineStart));
+    }
+
+    void JsonScanner::setError ( const string & message ) {
+        if ( !error.empty() ) return;   // first error wins
+        error = message;
+        describeAt(error);
+    }
+
+    bool JsonScanner::expect ( char ch ) {
+        skipWhiteSpace();
+        if ( eof() ) {
+            if ( error.empty() ) error = "unexpected eos";
+            return false;
+        }
+        if ( *cur!=ch ) {
+            setError(string("unexpected `") + *cur + "`, expecting `" + ch + "`");
+            return false;
+        }
+        cur ++;
+        return true;
+    }
+
+    bool JsonScanner::parseString ( string & str ) {
+        DAS_ASSERT(*cur=='"');
+        cur ++;
+        str.clear();
+        for ( ;; ) {
+            const char * run = cur;
+            for ( ;; ) {
+                if ( cur + 16 <= end ) {
+                    if ( auto m = JsonChunk(cur).quoteOrEscape() ) {
+                        cur += JsonChunk::lane(m);
+                        break;
+                    }
+                    cur += 16;
+                } else {
+                    while ( cur<end && *cur!='"' && *cur!='\\' ) cur++;
+                    break;
+                }
+            }
+            str.append(run, cur - run);
+            if ( cur>=end ) {
+                setError("string exceeds text");
+                return false;
+            }
+            if ( *cur++=='"' ) return true;
+            // escape sequence
+            if ( cur>=end ) {
+                setError("string escape sequence exceeds text");
+                return false;
+            }
+            char ch = *cur++;
+            switch ( ch ) {
+                case 'b':   str += '\b'; break;
+                case 'f':   str += '\f'; break;
+                case 'n':   str += '\n'; break;
+                case 'r':   str += '\r'; break;
+                case 't':   str += '\t'; break;
+                case 'u': {
+                    uint32_t cp = 0;
+                    for ( int i=0; i!=4; ++i ) {
+                        int d = cur<end ? hex_digit(*cur) : -1;
+                        if ( d<0 ) {
+                            setError("invalid unicode escape sequence");
+                            return false;
+                        }
+                        cp = (cp << 4) | uint32_t(d);
+                        cur ++;
+                    }
+                    // surrogate pair
+                    if ( cp>=0xd800 && cp<0xdc00 && cur + 6 <= end && cur[0]=='\\' && cur[1]=='u' ) {
+                        uint32_t lo = 0;
+                        bool ok = true;
+                        for ( int i=0; i!=4 && ok; ++i ) {
+                            int d = hex_digit(cur[2+i]);
+                            ok = d>=0;
+                            lo = (lo << 4) | uint32_t(d);
+                        }
+                        if ( ok && lo>=0xdc00 && lo<0xe000 ) {
+                            cp = 0x10000 + ((cp - 0xd800) << 10) + (lo - 0xdc00);
+                            cur += 6;
+                        }
+                    }
+                    // lone surrogate is not a character, it can't be encoded as utf8. replacement character instead
+                    if ( cp>=0xd800 && cp<0xe000 ) cp = 0xfffd;
+                    append_utf8(str, cp);
+                    break;
+                }
+                default:    str += ch; break;   // \" \\ \/ and everything else is the character itself
+            }
+        }
+    }
+
+    bool JsonScanner::skipString() {
+        DAS_ASSERT(*cur=='"');
+        cur ++;
+        for ( ;; ) {
+            if ( cur + 16 <= end ) {
+                if ( auto m = JsonChunk(cur).quoteOrEscape() ) {
+                    cur += JsonChunk::lane(m);
+                } else {
+                    cur += 16;
+                    continue;
+                }
+            } else {
+                while ( cur<end && *cur!='"' && *cur!='\\' ) cur++;
+            }
+            if ( cur>=end ) {
+                setError("string exceeds text");
+                return false;
+            }
+            if ( *cur++=='"' ) return true;
+            if ( cur>=end ) {
+                setError("string escape sequence exceeds text");
+                return false;
+            }
+            cur ++;
+        }
+    }
+
+    bool JsonScanner::parseNumber ( bool & isInteger, int64_t & ival, double & dval ) {
+        const char * numBegin = cur;
+        bool isNegative = *cur=='-';
+        if ( *cur=='-' || *cur=='+' ) cur++;
+        const char * digits = cur;
+        bool anyNumbers = false;
+        while ( cur<end && is_number(*cur) ) cur++;
+        anyNumbers = cur!=digits;
+        isInteger = true;
+        if ( cur<end && *cur=='.' ) {
+            isInteger = false;
+            const char * frac = ++cur;
+            while ( cur<end && is_number(*cur) ) cur++;
+            anyNumbers |= cur!=frac;
+        }
+        if ( cur<end && (*cur=='e' || *cur=='E') ) {
+            isInteger = false;
+            cur ++;
+            if ( cur<end && (*cur=='+' || *cur=='-') ) cur++;
+            const char * expo = cur;
+            while ( cur<end && is_number(*cur) ) cur++;
+            anyNumbers &= cur!=expo;
+        }
+        if ( !anyNumbers ) {
+            const char * tail = cur;
+            cur = numBegin;
+            setError("invalid number " + string(numBegin, tail - numBegin));
+            cur = tail;
+            return false;
+        }
+        if ( isInteger ) {
+            // we can have big unsigned numbers, which overflow int64 but fit in uint64
+            if ( isNegative ) {
+                auto res = fast_float::from_chars(numBegin, cur, ival);
+                if ( res.ec==std::errc() && res.ptr==cur ) return true;
+            } else {
+                uint64_t uval = 0;
+                auto res = fast_float::from_chars(digits, cur, uval);
+                if ( res.ec==std::errc() && res.ptr==cur ) {
+                    ival = int64_t(uval);
+                    return true;
+                }
+            }
+            isInteger = false;  // does not fit, goes to double
+        }
+        auto res = fast_float::from_chars(isNegative ? numBegin : digits, cur, dval);
+        if ( res.ec!=std::errc() || res.ptr!=cur ) {
+            const char * tail = cur;
+            cur = numBegin;
+            setError("invalid number " + string(numBegin, tail - numBegin));
+            cur = tail;
+            return false;
+        }
+        return true;
+    }
+
+    bool JsonScanner::parseName ( const char * & name, uint32_t & length ) {
+        name = cur;
+        while ( cur<end && is_alpha(*cur) ) cur++;
+        length = uint32_t(cur - name);
+        return length!=0;
+    }
+
+    bool JsonScanner::skipValue ( int depth ) {
+        skipWhiteSpace();
+        if ( eof() ) {
+            if ( error.empty() ) error = "unexpected eos";
+            return false;
+        }
+        if ( depth > maxDepth ) {
+            setError("json nesting is too deep");
+            return false;
+        }
+        char ch = *cur;
+        if ( ch=='[' || ch=='{' ) {
+            char close = ch=='[' ? ']' : '}';
+            cur ++;
+            skipWhiteSpace();
+            if ( peek()==close ) {
+                cur ++;
+                return true;
+            }
+            for ( ;; ) {
+                if ( ch=='{' ) {
+                    skipWhiteSpace();
+                    if ( peek()!='"' ) {
+                        setError("expecting string key");
+                        return false;
+                    }
+                    if ( !skipString() || !expect(':') ) return false;
+                }
+                if ( !skipValue(depth + 1) ) return false;
+                skipWhiteSpace();
+                if ( peek()==close ) {
+                    cur ++;
+                    return true;
+                } else if ( peek()!=',' ) {
+                    setError(string("expecting `,` or `") + close + "`");
+                    return false;
+                }
+                cur ++;
+            }
+        } else if ( ch=='"' ) {
+            return skipString();
+        } else if ( ch=='+' || ch=='-' || is_number(ch) ) {
+            bool isInteger; int64_t ival; double dval;
+            return parseNumber(isInteger, ival, dval);
+        } else if ( is_alpha(ch) ) {
+            const char * name; uint32_t length;
+            parseName(name, length);
+            if ( (length==4 && memcmp(name,"true",4)==0) || (length==5 && memcmp(name,"false",5)==0)
+                    || (length==4 && memcmp(name,"null",4)==0) ) {
+                return true;
+            }
+            setError("invalid name " + string(name, length));
+            return false;
+        } else {
+            setError(string("invalid character `") + ch + "` aka ASCII " + to_string(int(uint8_t(ch))));
+            return false;
+        }
+    }
+
+    // builds JsonValue tree on the context heap, same as what daslib/json.das used to build with `new`
+    class JsonTreeBuilder : public JsonScanner {
+    public:
+        JsonTreeBuilder ( const char * text, uint32_t length, Context * ctx, LineInfoArg * lat, bool dup )
+            : JsonScanner(text, length), context(ctx), at(lat), allowDuplicateKeys(dup) {}
+        JsonValueNative * parseValue ( int depth );
+    protected:
+        JsonValueNative * newValue ( int32_t index ) {
+            auto bytes = uint32_t(sizeof(JsonValueNative));
+            char * ptr = context->allocate(bytes, at);
+            if ( !ptr ) context->throw_out_of_memory(false, bytes, at);
+            context->heap->mark_comment(ptr, "new");
+            context->heap->mark_location(ptr, at);
+            memset(ptr, 0, bytes);
+            auto res = (JsonValueNative *) ptr;
+            res->index = index;
+            return res;
+        }
+        char * newString ( const string & str ) {
+            return str.empty() ? nullptr : context->allocateString(str, at);
+        }
+        JsonValueNative * parseArray ( int depth );
+        JsonValueNative * parseObject ( int depth );
+    protected:
+        Context *       context;
+        LineInfoArg *   at;
+        bool            allowDuplicateKeys;
+        string          scratch;
+        vector<vector<JsonValueNative *>> elements;    // per depth, so that arrays are allocated once
+    };
+
+    JsonValueNative * JsonTreeBuilder::parseArray ( int depth ) {
+        cur ++;
+        skipWhiteSpace();
+        if ( peek()==']' ) {
+            cur ++;
+            return newValue(JsonValueNative::tArray);
+        }
+        if ( elements.size() <= size_t(depth) ) elements.resize(depth + 1);
+        elements[depth].clear();
+        for ( ;; ) {
+            auto value = parseValue(depth + 1);
+            if ( !value ) return nullptr;
+            elements[depth].push_back(value);
+            skipWhiteSpace();
+            if ( eof() ) {
+                if ( error.empty() ) error = "unexpected eos";
+                return nullptr;
+            }
+            char sep = *cur;
+            if ( sep==']' ) {
+                cur ++;
+                break;
+            } else if ( sep!=',' ) {
+                setError(string("unexpected array separator symbol `") + sep + "` aka ASCII " + to_string(int(uint8_t(sep))));
+                return nullptr;
+            }
+            cur ++;
+        }
+        auto & elem = elements[depth];
+        auto res = newValue(JsonValueNative::tArray);
+        array_resize(*context, res->_array, uint32_t(elem.size()), uint32_t(sizeof(void *)), false, at);
+        memcpy(res->_array.data, elem.data(), elem.size() * sizeof(void *));
+        return res;
+    }
+
+    JsonValueNative * JsonTreeBuilder::parseObject ( int depth ) {
+        cur ++;
+        auto res = newValue(JsonValueNative::tObject);
+        skipWhiteSpace();
+        if ( peek()=='}' ) {
+            cur ++;
+            return res;
+        }
+        TableHash<char *> thh(context, uint32_t(sizeof(void *)));
+        for ( ;; ) {
+            skipWhiteSpace();
+            if ( eof() ) {
+                if ( error.empty() ) error = "unexpected eos";
+                return nullptr;
+            }
+            if ( *cur!='"' ) {
+                setError(string("unexpected `") + *cur + "`, expecting string key");
+                return nullptr;
+            }
+            if ( !parseString(scratch) ) return nullptr;
+            char * key = newString(scratch);
+            if ( !expect(':') ) return nullptr;
+            auto value = parseValue(depth + 1);
+            if ( !value ) return nullptr;
+            auto & tab = res->_object;
+            auto oldSize = tab.size;
+            auto index = thh.reserve(tab, key, hash_function(*context, key), at);
+            if ( tab.size==oldSize && !allowDuplicateKeys ) {
+                setError("duplicate key " + scratch);
+                return nullptr;
+            }
+            ((JsonValueNative **)tab.data)[index] = value;
+            skipWhiteSpace();
+            if ( eof() ) {
+                if ( error.empty() ) error = "unexpected eos";
+                return nullptr;
+            }
+            char sep = *cur;
+            if ( sep=='}' ) {
+                cur ++;
+                return res;
+            } else if ( sep!=',' ) {
+                setError(string("unexpected object separator symbol `") + sep + "` aka ASCII " + to_string(int(uint8_t(sep))));
+                return nullptr;
+            }
+            cur ++;
+        }
+    }
+
+    JsonValueNative * JsonTreeBuilder::parseValue ( int depth ) {
+        skipWhiteSpace();
+        if ( eof() ) {
+            if ( error.empty() ) error = "unexpected eos";
+            return nullptr;
+        }
+        if ( depth > maxDepth ) {
+            setError("json nesting is too deep");
+            return nullptr;
+        }
+        char ch = *cur;
+        if ( ch=='[' ) {
+            return parseArray(depth);
+        } else if ( ch=='{' ) {
+            return parseObject(depth);
+        } else if ( ch=='"' ) {
+            if ( !parseString(scratch) ) return nullptr;
+            auto res = newValue(JsonValueNative::tString);
+            res->_string = newString(scratch);
+            return res;
+        } else if ( ch=='+' || ch=='-' || is_number(ch) ) {
+            bool isInteger = false;
+            int64_t ival = 0;
+            double dval = 0.;
+            if ( !parseNumber(isInteger, ival, dval) ) return nullptr;
+            if ( isInteger ) {
+                auto res = newValue(JsonValueNative::tLongInt);
+                res->_longint = ival;
+                return res;
+            } else {
+                auto res = newValue(JsonValueNative::tNumber);
+                res->_number = dval;
+                return res;
+            }
+        } else if ( is_alpha(ch) ) {
+            const char * name; uint32_t length;
+            parseName(name, length);
+            if ( length==4 && memcmp(name,"true",4)==0 ) {
+                auto res = newValue(JsonValueNative::tBool);
+                res->_bool = true;
+                return res;
+            } else if ( length==5 && memcmp(name,"false",5)==0 ) {
+                return newValue(JsonValueNative::tBool);
+            } else if ( length==4 && memcmp(name,"null",4)==0 ) {
+                return newValue(JsonValueNative::tNull);
+            }
+            setError("invalid name " + string(name, length));
+            return nullptr;
+        } else {
+            setError(string("invalid character `") + ch + "` aka ASCII " + to_string(int(uint8_t(ch))));
+            return nullptr;
+        }
+    }
+
+    static void verifyJsonValueSize ( int32_t jsonValueSize, Context * context, LineInfoArg * at ) {
+        if ( jsonValueSize!=int32_t(sizeof(JsonValueNative)) ) {
+            context->throw_error_at(at, "JsonValue layout mismatch, expecting %i bytes, got %i",
+                int32_t(sizeof(JsonValueNative)), jsonValueSize);
+        }
+    }
+
+    static void * json_parse ( const char * text, uint32_t length, int32_t jsonValueSize, bool allowDuplicateKeys, char * & error, Context * context, LineInfoArg * at ) {
+        verifyJsonValueSize(jsonValueSize, context, at);
+        error = nullptr;
+        JsonTreeBuilder builder(text, length, context, at, allowDuplicateKeys);
+        builder.skipWhiteSpace();
+        if ( builder.eof() ) return nullptr;    // nothing to parse is not an error
+        auto res = builder.parseValue(0);
+        if ( !res ) {
+            // partially built tree is garbage, heap collection takes care of it
+            error = context->allocateString(builder.error, at);
+            return nullptr;
+        }
+        return res;
+    }
+
+    void * builtin_json_parse ( const char * text, int32_t jsonValueSize, bool allowDuplicateKeys, char * & error, Context * context, LineInfoArg * at ) {
+        return json_parse(text, stringLengthSafe(*context, text), jsonValueSize, allowDuplicateKeys, error, context, at);
+    }
+
+    void * builtin_json_parse_bytes ( const TArray<uint8_t> & text, int32_t jsonValueSize, bool allowDuplicateKeys, char * & error, Context * context, LineInfoArg * at ) {
+        return json_parse((const char *) text.data, text.size, jsonValueSize, allowDuplicateKeys, error, context, at);
+    }
+
+    // token stream for the lexer in daslib/json.das. kind is the index of the Token variant there
+    enum JsonTokenKind : int32_t { tkString, tkNumber, tkLongInt, tkBool, tkNull, tkSymbol, tkError };
+
+    static void json_tokenize ( const char * text, uint32_t length, const TBlock<void,int32_t,const char *,int64_t,double,int32_t,int32_t> & block,
+            Context * context, LineInfoArg * at ) {
+        JsonScanner scan(text, length);
+        string scratch;
+        int32_t line = 1;
+        const char * lineStart = text;
+        const char * counted = text;
+        auto emit = [&]( int32_t kind, const char * str, int64_t ival, double dval, const char * pos ) {
+            for ( ; counted < pos; ++counted ) {
+                if ( *counted=='\n' ) {
+                    line ++;
+                    lineStart = counted + 1;
+                }
+            }
+            vec4f args[6];
+            args[0] = cast<int32_t>::from(kind);
+            args[1] = cast<char *>::from(str ? context->allocateString(str, uint32_t(strlen(str)), at) : nullptr);
+            args[2] = cast<int64_t>::from(ival);
+            args[3] = cast<double>::from(dval);
+            args[4] = cast<int32_t>::from(line);
+            args[5] = cast<int32_t>::from(int32_t(pos - lineStart));
+            context->invoke(block, args, nullptr, at);
+        };
+        for ( ;; ) {
+            scan.skipWhiteSpace();
+            if ( scan.eof() ) return;
+            const char * pos = scan.position();
+            char ch = scan.peek();
+            if ( ch=='[' || ch==']' || ch=='{' || ch=='}' || ch==':' || ch==',' ) {
+                scan.advance();
+                emit(tkSymbol, nullptr, ch, 0., pos);
+            } else if ( ch=='"' ) {
+                if ( !scan.parseString(scratch) ) break;
+                emit(tkString, scratch.c_str(), 0, 0., pos);
+            } else if ( ch=='+' || ch=='-' || is_number(ch) ) {
+                bool isInteger = false;
+                int64_t ival = 0;
+                double dval = 0.;
+                if ( !scan.parseNumber(isInteger, ival, dval) ) break;
+                if ( isInteger ) {
+                    emit(tkLongInt, nullptr, ival, 0., pos);
+                } else {
+                    emit(tkNumber, nullptr, 0, dval, pos);
+                }
+            } else if ( is_alpha(ch) ) {
+                const char * name; uint32_t nameLength;
+                scan.parseName(name, nameLength);
+                if ( nameLength==4 && memcmp(name,"true",4)==0 ) {
+                    emit(tkBool, nullptr, 1, 0., pos);
+                } else if ( nameLength==5 && memcmp(name,"false",5)==0 ) {
+                    emit(tkBool, nullptr, 0, 0., pos);
+                } else if ( nameLength==4 && memcmp(name,"null",4)==0 ) {
+                    emit(tkNull, nullptr, 0, 0., pos);
+                } else {
+                    scan.setError("invalid name " + string(name, nameLength));
+                    break;
+                }
+            } else {
+                scan.setError(string("invalid character `") + ch + "` aka ASCII " + to_string(int(uint8_t(ch))));
+                break;
+            }
+        }
+        // stream ends with the error token, the same way the das lexer did
+        emit(tkError, scan.error.c_str(), 0, 0., scan.position());
+    }
+
+    void builtin_json_tokenize ( const char * text, const TBlock<void,int32_t,const char *,int64_t,double,int32_t,int32_t> & block, Context * context, LineInfoArg * at ) {
+        json_tokenize(text, stringLengthSafe(*context, text), block, context, at);
+    }
+
+    void builtin_json_tokenize_bytes ( const TArray<uint8_t> & text, const TBlock<void,int32_t,const char *,int64_t,double,int32_t,int32_t> & block, Context * context, LineInfoArg * at ) {
+        json_tokenize((const char *) text.data, text.size, block, context, at);
+    }
+
+    // same output as escapeString(str,false), only without the temporary string
+    static void write_json_escaped ( TextWriter & writer, const char * str ) {
+        if ( !str ) return;
+        const char * run = str;
+        for ( ; *str; ++str ) {
+            auto ch = uint8_t(*str);
+            if ( ch>0x1f && ch!='"' && ch!='\\' ) continue;
+            if ( str!=run ) writer.writeStr(run, str - run);
+            run = str + 1;
+            switch ( ch ) {
+                case '\"':  writer.writeStr("\\\"", 2); break;
+                case '\\':  writer.writeStr("\\\\", 2); break;
+                case '\b':  writer.writeStr("\\b", 2);  break;
+                case '\v':  writer.writeStr("\\v", 2);  break;
+                case '\f':  writer.writeStr("\\f", 2);  break;
+                case '\n':  writer.writeStr("\\n", 2);  break;
+                case '\r':  writer.writeStr("\\r", 2);  break;
+                case '\t':  writer.writeStr("\\t", 2);  break;
+                default: {
+                    const char tohex[] = "0123456789abcdef";
+                    char buf[6] = { '\\', 'u', '0', '0', tohex[ch>>4], tohex[ch&15] };
+                    writer.writeStr(buf, 6);
+                    break;
+                }
+            }
+        }
+        if ( str!=run ) writer.writeStr(run, str - run);
+    }
+
+    struct JsonTreeWriter {
+        TextWriter &    writer;
+        bool            noTrailingZeros;
+        bool            noEmptyArrays;
+        Context *       context;
+        LineInfoArg *   at;
+        void write ( const JsonValueNative * jsv, int32_t depth ) {
+            if ( !jsv ) {
+                writer.writeStr("null", 4);
+                return;
+            }
+            switch ( jsv->index ) {
+            case JsonValueNative::tString:
+                writer.writeChars('"', 1);
+                write_json_escaped(writer, jsv->_string);
+                writer.writeChars('"', 1);
+                break;
+            case JsonValueNative::tNumber:
+                if ( noTrailingZeros ) {
+                    auto text = fmt::format(FMT_STRING("{:.17f}"), jsv->_number);
+                    while ( !text.empty() && text.back()=='0' ) text.pop_back();
+                    while ( !text.empty() && text.back()=='.' ) text.pop_back();
+                    writer << text;
+                } else {
+                    writer << jsv->_number;
+                }
+                break;
+            case JsonValueNative::tLongInt:
+                writer << jsv->_longint;
+                break;
+            case JsonValueNative::tArray: {
+                const auto & arr = jsv->_array;
+                if ( arr.size==0 ) {
+                    writer.writeStr("[]", 2);
+                    break;
+                }
+                writer.writeStr("[\n", 2);
+                auto elements = (JsonValueNative **) arr.data;
+                for ( uint32_t i=0; i!=arr.size; ++i ) {
+                    if ( i ) writer.writeStr(",\n", 2);
+                    writer.writeChars('\t', depth + 1);
+                    write(elements[i], depth + 1);
+                }
+                writer.writeChars('\n', 1);
+                writer.writeChars('\t', depth);
+                writer.writeChars(']', 1);
+                break;
+            }
+            case JsonValueNative::tObject: {
+                const auto & tab = jsv->_object;
+                if ( tab.size==0 ) {
+                    writer.writeStr("{}", 2);
+                    break;
+                }
+                writer.writeStr("{\n", 2);
+                auto keys = (char **) tab.keys;
+                auto values = (JsonValueNative **) tab.data;
+                bool first = true;
+                for ( uint32_t i=0; i!=tab.capacity; ++i ) {
+                    if ( tab.hashes[i]<=HASH_KILLED64 ) continue;
+                    auto value = values[i];
+                    if ( noEmptyArrays && value && value->index==JsonValueNative::tArray && value->_array.size==0 ) continue;
+                    if ( !first ) writer.writeStr(",\n", 2);
+                    first = false;
+                    writer.writeChars('\t', depth + 1);
+                    writer.writeChars('"', 1);
+                    write_json_escaped(writer, keys[i]);
+                    writer.writeStr("\" : ", 4);
+                    write(value, depth + 1);
+                }
+                writer.writeChars('\n', 1);
+                writer.writeChars('\t', depth);
+                writer.writeChars('}', 1);
+                break;
+            }
+            case JsonValueNative::tBool:
+                if ( jsv->_bool ) writer.writeStr("true", 4);
+                else writer.writeStr("false", 5);
+                break;
+            case JsonValueNative::tNull:
+                writer.writeStr("null", 4);
+                break;
+            default:
+                context->throw_error_at(at, "unexpected JsonValue variant %i", jsv->index);
+            }
+        }
+    };
+
+    // reads JSON straight into the data described by TypeInfo, without the JsonValue tree. format is the one of sprint_json
+    class JsonStructReader : public JsonScanner {
+    public:
+        JsonStructReader ( const char * text, uint32_t length, Context * ctx, LineInfo * lat )
+            : JsonScanner(text, length), context(ctx), at(lat) {}
+        bool read ( char * dst, TypeInfo * ti, int depth );
+    protected:
+        struct StructFields {
+            das_hash_map<string,int32_t>    byName;
+            vector<string>                  names;      // json names, i.e. with the 'rename' applied
+            vector<bool>                    embed;
+            vector<bool>                    skip;
+        };
+        bool mismatch ( TypeInfo * ti ) {
+            if ( eof() ) {
+                if ( error.empty() ) error = "unexpected eos";
+            } else {
+                setError("expecting " + debug_type(ti) + ", got `" + *cur + "`");
+            }
+            return false;
+        }
+        bool separator ( char close ) {
+            skipWhiteSpace();
+            if ( eof() ) {
+                if ( error.empty() ) error = "unexpected eos";
+                return false;
+            }
+            if ( *cur==',' || *cur==close ) return true;
+            setError(string("expecting `,` or `") + close + "`");
+            return false;
+        }
+        bool objectKey() {
+            skipWhiteSpace();
+            if ( peek()!='"' ) {
+                if ( eof() ) {
+                    if ( error.empty() ) error = "unexpected eos";
+                } else {
+                    setError(string("unexpected `") + *cur + "`, expecting string key");
+                }
+                return false;
+            }
+            return parseString(scratch) && expect(':');
+        }
+        bool openContainer ( char open, char close, TypeInfo * ti, bool & empty ) {
+            if ( peek()!=open ) return mismatch(ti);
+            cur ++;
+            skipWhiteSpace();
+            empty = peek()==close;
+            if ( empty ) cur ++;
+            return true;
+        }
+        bool readNumber ( Type type, bool & isInteger, int64_t & ival, double & dval );
+        void writeNumber ( char * dst, Type type, bool isInteger, int64_t ival, double dval );
+        bool readScalar ( char * dst, Type type );
+        bool readEnum ( char * dst, TypeInfo * ti );
+        bool readVector ( char * dst, TypeInfo * ti );
+        bool readStruct ( char * ps, StructInfo * si, TypeInfo * ti, int depth );
+        bool readTuple ( char * ps, TypeInfo * ti, int depth );
+        bool readVariant ( char * ps, TypeInfo * ti, int depth );
+        bool readArray ( Array & arr, TypeInfo * ti, int depth );
+        bool readDim ( char * pa, TypeInfo * ti, int depth );
+        bool readTable ( Table & tab, TypeInfo * ti, int depth );
+        bool readPointer ( char * & ptr, TypeInfo * ti, int depth );
+        bool initValue ( char * dst, TypeInfo * ti );
+        const StructFields & structFields ( StructInfo * si );
+        char * internKey ( const string & key );
+        template <typename KeyType>
+        int reserveKey ( Table & tab, uint32_t valueSize, KeyType key ) {
+            TableHash<KeyType> thh(context, valueSize);
+            return thh.reserve(tab, key, hash_function(*context, key), at);
+        }
+    protected:
+        Context *       context;
+        LineInfo *      at;
+        string          scratch;
+        das_hash_map<StructInfo *,unique_ptr<StructFields>> fieldsCache;   // flat map moves values, readStruct holds on to the reference
+        das_hash_map<string,char *>             internedKeys;   // same keys of the different tables share the string
+    };
+
+    static bool vectorShape ( Type type, Type & comp, int & count ) {
+        switch ( type ) {
+            case Type::tInt2:       comp = Type::tInt;      count = 2; return true;
+            case Type::tInt3:       comp = Type::tInt;      count = 3; return true;
+            case Type::tInt4:       comp = Type::tInt;      count = 4; return true;
+            case Type::tUInt2:      comp = Type::tUInt;     count = 2; return true;
+            case Type::tUInt3:      comp = Type::tUInt;     count = 3; return true;
+            case Type::tUInt4:      comp = Type::tUInt;     count = 4; return true;
+            case Type::tFloat2:     comp = Type::tFloat;    count = 2; return true;
+            case Type::tFloat3:     comp = Type::tFloat;    count = 3; return true;
+            case Type::tFloat4:     comp = Type::tFloat;    count = 4; return true;
+            case Type::tRange:      comp = Type::tInt;      count = 2; return true;
+            case Type::tURange:     comp = Type::tUInt;     count = 2; return true;
+            case Type::tRange64:    comp = Type::tInt64;    count = 2; return true;
+            case Type::tURange64:   comp = Type::tUInt64;   count = 2; return true;
+            default:                return false;
+        }
+    }
+
+    bool JsonStructReader::readNumber ( Type type, bool & isInteger, int64_t & ival, double & dval ) {
+        char ch = peek();
+        if ( ch=='+' || ch=='-' || is_number(ch) ) return parseNumber(isInteger, ival, dval);
+        if ( ch=='"' && (type==Type::tInt64 || type==Type::tUInt64) ) {
+            // 64-bit integers can come as strings, so that they survive javascript
+            const char * from = cur;
+            if ( !parseString(scratch) ) return false;
+            const char * first = scratch.c_str();
+            const char * last = first + scratch.size();
+            isInteger = true;
+            fast_float::from_chars_result res;
+            if ( type==Type::tInt64 ) {
+                res = fast_float::from_chars(first, last, ival);
+            } else {
+                uint64_t uval = 0;
+                res = fast_float::from_chars(first, last, uval);
+                ival = int64_t(uval);
+            }
+            if ( res.ec==std::errc() && res.ptr==last ) return true;
+            cur = from;
+            setError("invalid number " + scratch);
+            return false;
+        }
+        if ( eof() ) {
+            if ( error.empty() ) error = "unexpected eos";
+        } else {
+            setError(string("expecting number, got `") + ch + "`");
+        }
+        return false;
+    }
+
+    void JsonStructReader::writeNumber ( char * dst, Type type, bool isInteger, int64_t ival, double dval ) {
+        int64_t iv = isInteger ? ival : int64_t(dval);
+        double dv = isInteger ? double(ival) : dval;
+        switch ( type ) {
+            case Type::tInt8:
+            case Type::tEnumeration8:   *(int8_t *)dst = int8_t(iv); break;
+            case Type::tUInt8:
+            case Type::tBitfield8:      *(uint8_t *)dst = uint8_t(iv); break;
+            case Type::tInt16:
+            case Type::tEnumeration16:  *(int16_t *)dst = int16_t(iv); break;
+            case Type::tUInt16:
+            case Type::tBitfield16:     *(uint16_t *)dst = uint16_t(iv); break;
+            case Type::tInt:
+            case Type::tEnumeration:    *(int32_t *)dst = int32_t(iv); break;
+            case Type::tUInt:
+            case Type::tBitfield:       *(uint32_t *)dst = uint32_t(iv); break;
+            case Type::tInt64:
+            case Type::tEnumeration64:  *(int64_t *)dst = iv; break;
+            case Type::tUInt64:
+            case Type::tBitfield64:     *(uint64_t *)dst = uint64_t(iv); break;
+            case Type::tFloat:          *(float *)dst = float(dv); break;
+            case Type::tDouble:         *(double *)dst = dv; break;
+            default:                    DAS_ASSERTF(0, "not a number type"); break;
+        }
+    }
+
+    bool JsonStructReader::readScalar ( char * dst, Type type ) {
+        bool isInteger = false;
+        int64_t ival = 0;
+        double dval = 0.;
+        if ( !readNumber(type, isInteger, ival, dval) ) return false;
+        writeNumber(dst, type, isInteger, ival, dval);
+        return true;
+    }
+
+    bool JsonStructReader::readEnum ( char * dst, TypeInfo * ti ) {
+        if ( peek()!='"' ) return readScalar(dst, ti->type);
+        const char * from = cur;
+        if ( !parseString(scratch) ) return false;
+        if ( auto info = ti->enumType ) {
+            for ( uint32_t i=0; i!=info->count; ++i ) {
+                auto field = info->fields[i];
+                if ( field->name && scratch==field->name ) {
+                    writeNumber(dst, ti->type, true, field->value, 0.);
+                    return true;
+                }
+            }
+        }
+        cur = from;
+        setError("not a valid enumeration " + scratch + " in " + debug_type(ti));
+        return false;
+    }
+
+    bool JsonStructReader::readVector ( char * dst, TypeInfo * ti ) {
+        Type comp; int count;
+        vectorShape(ti->type, comp, count);
+        uint32_t compSize = getTypeBaseSize(comp);
+        bool empty = false;
+        if ( peek()=='{' ) {
+            // JV writes vectors as {"x":..,"y":..}
+            if ( !openContainer('{', '}', ti, empty) ) return false;
+            if ( empty ) return true;
+            for ( ;; ) {
+                if ( !objectKey() ) return false;
+                int index = -1;
+                if ( scratch.size()==1 ) {
+                    switch ( scratch[0] ) {
+                        case 'x':   index = 0; break;
+                        case 'y':   index = 1; break;
+                        case 'z':   index = 2; break;
+                        case 'w':   index = 3; break;
+                    }
+                }
+                skipWhiteSpace();
+                if ( index>=0 && index<count ) {
+                    if ( !readScalar(dst + index*compSize, comp) ) return false;
+                } else if ( !skipValue() ) {
+                    return false;
+                }
+                if ( !separator('}') ) return false;
+                if ( *cur++=='}' ) return true;
+            }
+        }
+        if ( !openContainer('[', ']', ti, empty) ) return false;
+        int index = 0;
+        if ( !empty ) {
+            for ( ;; ) {
+                if ( index==count ) {
+                    setError("too many elements for " + debug_type(ti));
+                    return false;
+                }
+                skipWhiteSpace();
+                if ( !readScalar(dst + index*compSize, comp) ) return false;
+                index ++;
+                if ( !separator(']') ) return false;
+                if ( *cur++==']' ) break;
+            }
+        }
+        if ( index!=count ) {
+            setError("not enough elements for " + debug_type(ti));
+            return false;
+        }
+        return true;
+    }
+
+    const JsonStructReader::StructFields & JsonStructReader::structFields ( StructInfo * si ) {
+        auto it = fieldsCache.find(si);
+        if ( it!=fieldsCache.end() ) return *it->second;
+        auto & psf = fieldsCache[si];
+        psf = make_unique<StructFields>();
+        auto & sf = *psf;
+        sf.names.resize(si->count);
+        sf.embed.resize(si->count, false);
+        sf.skip.resize(si->count, false);
+        for ( uint32_t i=0; i!=si->count; ++i ) {
+            VarInfo * vi = si->fields[i];
+            string name = vi->name ? vi->name : "";
+            if ( vi->annotation_arguments ) {
+                auto aa = (AnnotationArguments *) vi->annotation_arguments;
+                for ( auto & arg : *aa ) {
+                    if ( arg.name=="rename" && arg.type==Type::tString ) {
+                        name = arg.sValue;
+                    } else if ( arg.name=="embed" && arg.type==Type::tBool ) {
+                        sf.embed[i] = arg.bValue;
+                    }
+                }
+            }
+            if ( (si->flags & StructInfo::flag_class) && (name=="__rtti" || name=="__finalize") ) {
+                sf.skip[i] = true;
+                continue;
+            }
+            sf.names[i] = name;
+            sf.byName[name] = int32_t(i);
+        }
+        return sf;
+    }
+
+    char * JsonStructReader::internKey ( const string & key ) {
+        if ( key.empty() ) return nullptr;
+        auto it = internedKeys.find(key);
+        if ( it!=internedKeys.end() ) return it->second;
+        auto str = context->allocateString(key, at);
+        internedKeys[key] = str;
+        return str;
+    }
+
+    bool JsonStructReader::initValue ( char * dst, TypeInfo * ti ) {
+        if ( ti->type!=Type::tStructure || ti->dimSize ) return true;
+        auto si = ti->structType;
+        // run the default initializer, if its in the context. otherwise zero is all we have
+        if ( si->init_mnh ) {
+            auto fn = context->fnByMangledName(si->init_mnh);
+            if ( fn && fn->debugInfo && fn->debugInfo->count==0 ) {
+                context->callWithCopyOnReturn(fn, nullptr, dst, at);
+                return true;
+            }
+        }
+        if ( si->flags & StructInfo::flag_class ) {
+            setError(string("can't make ") + si->name + ", class initializer is not in the context");
+            return false;
+        }
+        return true;
+    }
+
+    bool JsonStructReader::readStruct ( char * ps, StructInfo * si, TypeInfo * ti, int depth ) {
+        bool empty = false;
+        if ( !openContainer('{', '}', ti, empty) ) return false;
+        if ( empty ) return true;
+        if ( si->flags & StructInfo::flag_class ) {
+            auto rtti = *(TypeInfo **) ps;
+            if ( rtti && rtti->structType ) si = rtti->structType;
+        }
+        const auto & sf = structFields(si);
+        uint32_t expected = 0;
+        for ( ;; ) {
+            if ( !objectKey() ) return false;
+            int32_t index = -1;
+            // fields mostly come in the declaration order, and then there is nothing to look up
+            if ( expected<si->count && !sf.skip[expected] && sf.names[expected]==scratch ) {
+                index = int32_t(expected);
+            } else {
+                auto it = sf.byName.find(scratch);
+                if ( it!=sf.byName.end() ) index = it->second;
+            }
+            skipWhiteSpace();
+            if ( index==-1 ) {
+                if ( !skipValue(depth + 1) ) return false;
+            } else {
+                VarInfo * vi = si->fields[index];
+                char * pf = ps + vi->offset;
+                if ( sf.embed[index] && vi->type==Type::tString && !vi->dimSize ) {
+                    const char * from = cur;
+                    if ( !skipValue(depth + 1) ) return false;
+                    *(char **)pf = context->allocateString(from, uint32_t(cur - from), at);
+                } else if ( !read(pf, vi, depth + 1) ) {
+                    return false;
+                }
+                expected = uint32_t(index) + 1;
+            }
+            if ( !separator('}') ) return false;
+            if ( *cur++=='}' ) return true;
+        }
+    }
+
+    bool JsonStructReader::readTuple ( char * ps, TypeInfo * ti, int depth ) {
+        bool empty = false;
+        if ( !openContainer('{', '}', ti, empty) ) return false;
+        if ( empty ) return true;
+        for ( ;; ) {
+            if ( !objectKey() ) return false;
+            // sprint_json writes tuple entries as "_0", "_1", etc
+            int32_t index = -1;
+            for ( uint32_t i=0; i!=ti->argCount && index==-1; ++i ) {
+                if ( ti->argNames && ti->argNames[i] && scratch==ti->argNames[i] ) index = int32_t(i);
+            }
+            if ( index==-1 && scratch.size()>1 && scratch[0]=='_' ) {
+                int32_t ival = -1;
+                auto res = fast_float::from_chars(scratch.c_str() + 1, scratch.c_str() + scratch.size(), ival);
+                if ( res.ec==std::errc() && res.ptr==scratch.c_str() + scratch.size() && uint32_t(ival)<ti->argCount ) index = ival;
+            }
+            skipWhiteSpace();
+            if ( index==-1 ) {
+                if ( !skipValue(depth + 1) ) return false;
+            } else if ( !read(ps + getTupleFieldOffset(ti, index), ti->argTypes[index], depth + 1) ) {
+                return false;
+            }
+            if ( !separator('}') ) return false;
+            if ( *cur++=='}' ) return true;
+        }
+    }
+
+    bool JsonStructReader::readVariant ( char * ps, TypeInfo * ti, int depth ) {
+        bool empty = false;
+        if ( !openContainer('{', '}', ti, empty) ) return false;
+        if ( empty ) return true;
+        auto & variantIndex = *(int32_t *)ps;
+        auto switchTo = [&]( int32_t index ) {
+            if ( variantIndex==index ) return;
+            variantIndex = index;
+            int offset = getVariantFieldOffset(ti, index);
+            memset(ps + offset, 0, ti->size - offset);
+        };
+        for ( ;; ) {
+            if ( !objectKey() ) return false;
+            skipWhiteSpace();
+            if ( scratch=="$variant" ) {
+                // this is how JV writes variants
+                int32_t index = 0;
+                if ( !readScalar((char *)&index, Type::tInt) ) return false;
+                if ( uint32_t(index)>=ti->argCount ) {
+                    setError("invalid variant index " + to_string(index) + " for " + debug_type(ti));
+                    return false;
+                }
+                switchTo(index);
+            } else {
+                int32_t index = -1;
+                for ( uint32_t i=0; i!=ti->argCount && index==-1; ++i ) {
+                    if ( ti->argNames && ti->argNames[i] && scratch==ti->argNames[i] ) index = int32_t(i);
+                }
+                if ( index==-1 ) {
+                    if ( !skipValue(depth + 1) ) return false;
+                } else {
+                    switchTo(index);
+                    if ( !read(ps + getVariantFieldOffset(ti, index), ti->argTypes[index], depth + 1) ) return false;
+                }
+            }
+            if ( !separator('}') ) return false;
+            if ( *cur++=='}' ) return true;
+        }
+    }
+
+    bool JsonStructReader::readArray ( Array & arr, TypeInfo * ti, int depth ) {
+        bool empty = false;
+        if ( !openContainer('[', ']', ti, empty) ) return false;
+        array_clear(*context, arr, at);
+        if ( empty ) return true;
+        TypeInfo * eti = ti->firstType;
+        uint32_t stride = eti->size;
+        for ( ;; ) {
+            uint32_t index = arr.size;
+            array_resize(*context, arr, index + 1, stride, true, at);
+            char * pe = arr.data + size_t(index) * stride;
+            if ( !initValue(pe, eti) ) return false;
+            if ( !read(pe, eti, depth + 1) ) return false;
+            if ( !separator(']') ) return false;
+            if ( *cur++==']' ) return true;
+        }
+    }
+
+    bool JsonStructReader::readDim ( char * pa, TypeInfo * ti, int depth ) {
+        bool empty = false;
+        if ( !openContainer('[', ']', ti, empty) ) return false;
+        if ( empty ) return true;
+        TypeInfo eti = *ti;
+        uint32_t count = ti->dim[0];
+        eti.size = count ? ti->size / count : ti->size;
+        eti.dimSize --;
+        eti.dim = ti->dim + 1;
+        for ( uint32_t index=0; ; ++index ) {
+            if ( index==count ) {
+                setError("too many elements for " + debug_type(ti));
+                return false;
+            }
+            if ( !read(pa + size_t(index) * eti.size, &eti, depth + 1) ) return false;
+            if ( !separator(']') ) return false;
+            if ( *cur++==']' ) return true;
+        }
+    }
+
+    bool JsonStructReader::readTable ( Table & tab, TypeInfo * ti, int depth ) {
+        bool empty = false;
+        if ( !openContainer('{', '}', ti, empty) ) return false;
+        table_clear(*context, tab, at);
+        if ( empty ) return true;
+        TypeInfo * kti = ti->firstType;
+        TypeInfo * vti = ti->secondType;
+        uint32_t valueSize = vti ? vti->size : 0;
+        for ( ;; ) {
+            const char * keyAt = cur;
+            if ( !objectKey() ) return false;
+            auto oldSize = tab.size;
+            int index = -1;
+            if ( kti->type==Type::tString ) {
+                index = reserveKey<char *>(tab, valueSize, internKey(scratch));
+            } else {
+                // sprint_json writes other keys in quotes
+                const char * first = scratch.c_str();
+                const char * last = first + scratch.size();
+                fast_float::from_chars_result res;
+                switch ( kti->type ) {
+                    case Type::tInt:    { int32_t key = 0;  res = fast_float::from_chars(first, last, key); if ( res.ec==std::errc() ) index = reserveKey<int32_t>(tab, valueSize, key); break; }
+                    case Type::tUInt:   { uint32_t key = 0; res = fast_float::from_chars(first, last, key); if ( res.ec==std::errc() ) index = reserveKey<uint32_t>(tab, valueSize, key); break; }
+                    case Type::tInt64:  { int64_t key = 0;  res = fast_float::from_chars(first, last, key); if ( res.ec==std::errc() ) index = reserveKey<int64_t>(tab, valueSize, key); break; }
+                    case Type::tUInt64: { uint64_t key = 0; res = fast_float::from_chars(first, last, key); if ( res.ec==std::errc() ) index = reserveKey<uint64_t>(tab, valueSize, key); break; }
+                    default:
+                        cur = keyAt;
+                        setError("unsupported table key type " + debug_type(kti));
+                        return false;
+                }
+                if ( index==-1 || res.ptr!=last ) {
+                    cur = keyAt;
+                    setError("invalid table key " + scratch);
+                    return false;
+                }
+            }
+            skipWhiteSpace();
+            if ( valueSize ) {
+                char * pv = tab.data + size_t(index) * valueSize;
+                if ( tab.size!=oldSize && !initValue(pv, vti) ) return false;
+                if ( !read(pv, vti, depth + 1) ) return false;
+            } else if ( !skipValue(depth + 1) ) {
+                return false;
+            }
+            if ( !separator('}') ) return false;
+            if ( *cur++=='}' ) return true;
+        }
+    }
+
+    bool JsonStructReader::readPointer ( char * & ptr, TypeInfo * ti, int depth ) {
+        TypeInfo * pti = ti->firstType;
+        if ( ti->isSmartPtr() || !pti || pti->type==Type::tVoid ) {
+            setError("can't read " + debug_type(ti) + " from json");
+            return false;
+        }
+        if ( !ptr ) {
+            uint32_t bytes = pti->size;
+            char * np = context->allocate(bytes, at);
+            if ( !np ) context->throw_out_of_memory(false, bytes, at);
+            context->heap->mark_comment(np, "new");
+            context->heap->mark_location(np, at);
+            memset(np, 0, bytes);
+            // the object is only handed out once it's read, on failure the pointer stays null
+            if ( !initValue(np, pti) || !read(np, pti, depth + 1) ) {
+                context->free(np, bytes, at);
+                return false;
+            }
+            ptr = np;
+            return true;
+        }
+        return read(ptr, pti, depth + 1);
+    }
+
+    bool JsonStructReader::read ( char * dst, TypeInfo * ti, int depth ) {
+        skipWhiteSpace();
+        if ( eof() ) {
+            if ( error.empty() ) error = "unexpected eos";
+            return false;
+        }
+        if ( depth > maxDepth ) {
+            setError("json nesting is too deep");
+            return false;
+        }
+        // null resets pointers and strings, everything else keeps its value
+        if ( *cur=='n' && end - cur >= 4 && memcmp(cur, "null", 4)==0 ) {
+            cur += 4;
+            if ( !ti->dimSize && (ti->type==Type::tPointer || ti->type==Type::tString) ) *(void **)dst = nullptr;
+            return true;
+        }
+        if ( ti->dimSize ) return readDim(dst, ti, depth);
+        switch ( ti->type ) {
+            case Type::tBool: {
+                const char * name; uint32_t length;
+                parseName(name, length);
+                if ( length==4 && memcmp(name,"true",4)==0 ) {
+                    *(bool *)dst = true;
+                } else if ( length==5 && memcmp(name,"false",5)==0 ) {
+                    *(bool *)dst = false;
+                } else {
+                    cur = name;
+                    return mismatch(ti);
+                }
+                return true;
+            }
+            case Type::tInt8:
+            case Type::tUInt8:
+            case Type::tInt16:
+            case Type::tUInt16:
+            case Type::tInt:
+            case Type::tUInt:
+            case Type::tInt64:
+            case Type::tUInt64:
+            case Type::tBitfield:
+            case Type::tBitfield8:
+            case Type::tBitfield16:
+            case Type::tBitfield64:
+            case Type::tFloat:
+            case Type::tDouble:
+                return readScalar(dst, ti->type);
+            case Type::tEnumeration:
+            case Type::tEnumeration8:
+            case Type::tEnumeration16:
+            case Type::tEnumeration64:
+                return readEnum(dst, ti);
+            case Type::tString:
+                if ( peek()!='"' ) return mismatch(ti);
+                if ( !parseString(scratch) ) return false;
+                *(char **)dst = scratch.empty() ? nullptr : context->allocateString(scratch, at);
+                return true;
+            case Type::tInt2:
+            case Type::tInt3:
+            case Type::tInt4:
+            case Type::tUInt2:
+            case Type::tUInt3:
+            case Type::tUInt4:
+            case Type::tFloat2:
+            case Type::tFloat3:
+            case Type::tFloat4:
+            case Type::tRange:
+            case Type::tURange:
+            case Type::tRange64:
+            case Type::tURange64:
+                return readVector(dst, ti);
+            case Type::tArray:      return readArray(*(Array *)dst, ti, depth);
+            case Type::tTable:      return readTable(*(Table *)dst, ti, depth);
+            case Type::tStructure:  return readStruct(dst, ti->structType, ti, depth);
+            case Type::tTuple:      return readTuple(dst, ti, depth);
+            case Type::tVariant:    return readVariant(dst, ti, depth);
+            case Type::tPointer:    return readPointer(*(char **)dst, ti, depth);
+            default:
+                setError("can't read " + debug_type(ti) + " from json");
+                return false;
+        }
+    }
+
+    vec4f builtin_json_read_into ( Context & context, SimNode_CallBase * call, vec4f * args ) {
+        auto text = cast<const char *>::to(args[0]);
+        auto dst = cast<char *>::to(args[1]);
+        auto ti = call->types[1];
+        if ( !dst || !ti || ti->type!=Type::tPointer || !ti->firstType ) {
+            context.throw_error_at(call->debugInfo, "expecting pointer to the value to read json into");
+        }
+        JsonStructReader reader(text, stringLengthSafe(context, text), &context, &call->debugInfo);
+        if ( reader.read(dst, ti->firstType, 0) ) return cast<char *>::from(nullptr);
+        return cast<char *>::from(context.allocateString(reader.error, &call->debugInfo));
+    }
+
+    void builtin_json_write ( StringBuilderWriter & writer, const void * jsv, int32_t jsonValueSize, bool noTrailingZeros, bool noEmptyArrays, Context * context, LineInfoArg * at ) {
+        verifyJsonValueSize(jsonValueSize, context, at);
+        JsonTreeWriter tw = { writer, noTrailingZeros, noEmptyArrays, context, at };
+        tw.write((const JsonValueNative *) jsv, 0);
+    }
+}
@@ -58,6 +58,7 @@ namespace das
         if ( arr.isLocked() ) context.throw_error_at(at, "can't clear locked table");
         if ( arr.data ) {
             memset(arr.hashes, 0, arr.capacity*sizeof(TableHashKey));
+            memset(arr.ctrl(), TABLE_CTRL_EMPTY, arr.capacity + TABLE_CTRL_GROUP);
             memset(arr.data, 0, arr.keys - arr.data);
         }
         arr.size = 0;
@@ -183,7 +184,7 @@ namespace das
         for ( uint32_t i=0, is=total; i!=is; ++i, pTable-- ) {
             if ( pTable->data ) {
                 if ( !pTable->isLocked() ) {
-                    uint32_t oldSize = pTable->capacity*(vts_add_kts + sizeof(TableHashKey));
+                    uint32_t oldSize = uint32_t(table_mem_size(pTable->capacity, vts_add_kts));
                     context.free(pTable->data, oldSize, &debugInfo);
                 } else {
                     context.throw_error_at(debugInfo, "deleting locked table%s", errorMessage);
@@ -0,0 +1,308 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/sampling_profiler.h"
+#include "daScript/simulate/runtime_profile.h"
+#include "daScript/simulate/runtime_string.h"
+#include "daScript/misc/performance_time.h"
+
+#include <chrono>
+
+#if defined(__linux__)
+    #include <sys/uio.h>
+    #include <unistd.h>
+#endif
+
+namespace das
+{
+    // memory of AOT and JIT frames is only looked at, when it's already stale, so read it without faulting
+    static bool safeRead ( void * dst, const void * src, size_t size ) {
+#if defined(__linux__)
+        struct iovec local = { dst, size };
+        struct iovec remote = { const_cast<void *>(src), size };
+        return process_vm_readv(getpid(), &local, 1, &remote, 1, 0) == ssize_t(size);
+#else
+        return false;
+#endif
+    }
+
+    static string safeReadString ( const char * src, size_t maxLength ) {
+        string res;
+        char buf[64];
+        while ( res.size() < maxLength ) {
+            if ( !safeRead(buf, src + res.size(), sizeof(buf)) ) {
+                // possibly near the end of the mapping, byte by byte
+                if ( !safeRead(buf, src + res.size(), 1) ) return "";
+                if ( !buf[0] ) return res;
+                res += buf[0];
+                continue;
+            }
+            for ( auto ch : buf ) {
+                if ( !ch ) return res;
+                res += ch;
+            }
+        }
+        return res;
+    }
+
+    SamplingProfiler::SamplingProfiler ( Context * ctx ) : context(ctx) {
+        for ( int i=0, is=context->getTotalFunctions(); i!=is; ++i ) {
+            if ( auto fn = context->getFunction(i) ) {
+                if ( fn->debugInfo ) knownFunctions.insert(fn->debugInfo);
+            }
+        }
+    }
+
+    SamplingProfiler::~SamplingProfiler() {
+        stop();
+    }
+
+    bool SamplingProfiler::start ( int32_t us ) {
+        if ( running ) return false;
+        intervalUs = das::max(us, 50);
+        if ( samples.empty() ) startTicks = ref_time_ticks();
+        running = true;
+        sampler = thread([this](){ run(); });
+        return true;
+    }
+
+    void SamplingProfiler::stop() {
+        if ( !running ) return;
+        running = false;
+        if ( sampler.joinable() ) sampler.join();
+    }
+
+    void SamplingProfiler::reset() {
+        lock_guard<mutex> guard(lock);
+        frameIndex.clear();
+        frames.clear();
+        sampleFrames.clear();
+        samples.clear();
+        jitFileNames.clear();
+        sampleCount = 0;
+        dropped = 0;
+        startTicks = ref_time_ticks();
+    }
+
+    uint64_t SamplingProfiler::totalSamples() const {
+        return sampleCount.load(memory_order_relaxed);
+    }
+
+    uint64_t SamplingProfiler::droppedSamples() const {
+        return dropped.load(memory_order_relaxed);
+    }
+
+    void SamplingProfiler::run() {
+        auto next = chrono::steady_clock::now();
+        while ( running ) {
+            next += chrono::microseconds(intervalUs);
+            sampleNow();
+            auto now = chrono::steady_clock::now();
+            if ( next < now ) next = now;   // we are late, don't try to catch up
+            this_thread::sleep_until(next);
+        }
+    }
+
+    void SamplingProfiler::sampleNow() {
+        vector<uint32_t> frameIds;
+        lock_guard<mutex> guard(lock);
+        uint64_t timeUs = uint64_t(get_time_usec(startTicks));
+        if ( !walkStack(frameIds) ) {
+            dropped ++;
+            return;
+        }
+        uint32_t first = uint32_t(sampleFrames.size());
+        sampleFrames.insert(sampleFrames.end(), frameIds.begin(), frameIds.end());
+        samples.push_back({timeUs, first, uint32_t(frameIds.size())});
+        sampleCount ++;
+    }
+
+    // JIT code lives in its own module, which may carry its own copy of the name, so the name is compared and not the pointer
+    bool SamplingProfiler::isJitFileName ( const char * fileName ) {
+        if ( fileName==JIT_PROLOGUE_FILE_NAME ) return true;
+        auto it = jitFileNames.find(fileName);
+        if ( it != jitFileNames.end() ) return it->second;
+        auto len = strlen(JIT_PROLOGUE_FILE_NAME);
+        bool isJit = safeReadString(fileName, len + 1) == JIT_PROLOGUE_FILE_NAME;
+        jitFileNames[fileName] = isJit;
+        return isJit;
+    }
+
+    uint32_t SamplingProfiler::internFrame ( FuncInfo * info, const char * fileName, LineInfo * line, bool jit ) {
+        uint64_t key = info ? uint64_t(intptr_t(info))
+            : (uint64_t(intptr_t(fileName)) * UINT64_C(0x9E3779B97F4A7C15)) ^ uint64_t(intptr_t(line));
+        auto it = frameIndex.find(key);
+        if ( it != frameIndex.end() ) return it->second;
+        uint32_t id = uint32_t(frames.size());
+        frames.push_back({info, fileName, line, jit});
+        frameIndex[key] = id;
+        return id;
+    }
+
+    // same walk as dapiStackWalk, only the stack is someone else's and can change under us
+    bool SamplingProfiler::walkStack ( vector<uint32_t> & frameIds ) {
+    #if DAS_ENABLE_STACK_WALK
+        auto & stack = context->stack;
+        char * bottom = stack.bottom();
+        char * top = stack.top();
+        if ( !bottom ) return false;
+        char * sp = stack.ap();
+        while ( sp < top ) {
+            if ( sp < bottom || (intptr_t(sp) & (alignof(Prologue)-1)) ) return false;
+            Prologue * pp = (Prologue *) sp;
+            FuncInfo * info = pp->info;
+            const char * fileName = nullptr;
+            LineInfo * line = nullptr;
+            bool jit = false;
+            uint32_t incr = 0;
+            intptr_t iblock = intptr_t(pp->block);
+            if ( iblock & 1 ) {
+                // block invoke, which is always just the prologue. block itself may live on the native stack (AOT), so we don't look at it
+                incr = uint32_t(sizeof(Prologue));
+                sp += incr;
+                continue;
+            } else if ( info ) {
+                if ( knownFunctions.find(info)==knownFunctions.end() ) return false;
+                incr = info->stackSize;
+            } else {
+                fileName = pp->fileName;
+                jit = isJitFileName(fileName);
+                if ( jit ) line = pp->functionLine;
+                incr = uint32_t(pp->stackSize);
+            }
+            if ( incr < sizeof(Prologue) || incr >= stack.size() ) return false;
+            frameIds.push_back(internFrame(info, fileName, line, jit));
+            sp += incr;
+        }
+        return sp==top;
+    #else
+        return false;
+    #endif
+    }
+
+    string SamplingProfiler::frameName ( uint32_t frameId ) const {
+        const auto & fr = frames[frameId];
+        if ( fr.info ) {
+            return fr.info->name;
+        } else if ( fr.jit ) {
+            LineInfo li;
+            if ( fr.line && safeRead(&li, fr.line, sizeof(LineInfo)) ) {
+                return "[jit] line " + to_string(li.line);
+            }
+            return "[jit]";
+        } else {
+            // aot prologue is "function_name file:line"
+            auto name = safeReadString(fr.fileName, 256);
+            auto space = name.find(' ');
+            if ( space != string::npos ) name.resize(space);
+            return name.empty() ? string("[aot]") : "[aot] " + name;
+        }
+    }
+
+    void SamplingProfiler::writeCollapsed ( TextWriter & tw ) {
+        lock_guard<mutex> guard(lock);
+        vector<string> names(frames.size());
+        for ( uint32_t i=0, is=uint32_t(frames.size()); i!=is; ++i ) {
+            names[i] = frameName(i);
+            // ';' separates frames, and the last ' ' separates the count
+            for ( auto & ch : names[i] ) {
+                if ( ch==';' || ch==' ' ) ch = '_';
+            }
+        }
+        map<string,uint64_t> stacks;   // sorted, so that output is stable
+        string key;
+        for ( const auto & smp : samples ) {
+            if ( !smp.count ) continue;
+            key.clear();
+            for ( uint32_t i=smp.count; i!=0; --i ) {
+                if ( !key.empty() ) key += ';';
+                key += names[sampleFrames[smp.first + i - 1]];
+            }
+            stacks[key] ++;
+        }
+        for ( const auto & st : stacks ) {
+            tw << st.first << " " << st.second << "\n";
+        }
+    }
+
+    void SamplingProfiler::writeChromeTrace ( TextWriter & tw ) {
+        lock_guard<mutex> guard(lock);
+        vector<string> names(frames.size());
+        for ( uint32_t i=0, is=uint32_t(frames.size()); i!=is; ++i ) {
+            names[i] = escapeString(frameName(i), false);
+        }
+        // consecutive samples with the same frame at the same depth make one duration event
+        tw << "{\"traceEvents\":[\n";
+        tw << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"" << escapeString(context->name, false) << "\"}}";
+        vector<uint32_t> open;      // root first
+        auto closeTo = [&]( size_t depth, uint64_t ts ) {
+            while ( open.size() > depth ) {
+                tw << ",\n{\"name\":\"" << names[open.back()] << "\",\"ph\":\"E\",\"pid\":1,\"tid\":1,\"ts\":" << ts << "}";
+                open.pop_back();
+            }
+        };
+        uint64_t lastTs = 0;
+        for ( const auto & smp : samples ) {
+            size_t common = 0;
+            while ( common < open.size() && common < smp.count
+                    && open[common]==sampleFrames[smp.first + smp.count - 1 - common] ) {
+                common ++;
+            }
+            closeTo(common, smp.timeUs);
+            for ( uint32_t depth=uint32_t(common); depth < smp.count; ++depth ) {
+                uint32_t fid = sampleFrames[smp.first + smp.count - 1 - depth];
+                tw << ",\n{\"name\":\"" << names[fid] << "\",\"ph\":\"B\",\"pid\":1,\"tid\":1,\"ts\":" << smp.timeUs << "}";
+                open.push_back(fid);
+            }
+            lastTs = smp.timeUs;
+        }
+        closeTo(0, lastTs + uint64_t(intervalUs));
+        tw << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    }
+
+    // script interface
+
+    static SamplingProfiler * contextProfiler ( Context * context ) {
+        return context->samplingProfiler.get();
+    }
+
+    bool builtin_sampling_profiler_start ( int32_t intervalUs, Context * context, LineInfoArg * ) {
+        if ( !context->samplingProfiler ) {
+            context->samplingProfiler = make_shared<SamplingProfiler>(context);
+        }
+        return context->samplingProfiler->start(intervalUs);
+    }
+
+    void builtin_sampling_profiler_stop ( Context * context ) {
+        if ( auto prof = contextProfiler(context) ) prof->stop();
+    }
+
+    void builtin_sampling_profiler_reset ( Context * context ) {
+        if ( auto prof = contextProfiler(context) ) prof->reset();
+    }
+
+    int64_t builtin_sampling_profiler_samples ( Context * context ) {
+        auto prof = contextProfiler(context);
+        return prof ? int64_t(prof->totalSamples()) : 0;
+    }
+
+    int64_t builtin_sampling_profiler_dropped ( Context * context ) {
+        auto prof = contextProfiler(context);
+        return prof ? int64_t(prof->droppedSamples()) : 0;
+    }
+
+    char * builtin_sampling_profiler_collapsed ( Context * context, LineInfoArg * at ) {
+        auto prof = contextProfiler(context);
+        if ( !prof ) return nullptr;
+        TextWriter tw;
+        prof->writeCollapsed(tw);
+        return context->allocateString(tw.str(), at);
+    }
+
+    char * builtin_sampling_profiler_chrome_trace ( Context * context, LineInfoArg * at ) {
+        auto prof = contextProfiler(context);
+        if ( !prof ) return nullptr;
+        TextWriter tw;
+        prof->writeChromeTrace(tw);
+        return context->allocateString(tw.str(), at);
+    }
+}
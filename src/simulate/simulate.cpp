@@ -16,6 +16,8 @@
 namespace das
 {
 
+    DAS_API const char * const JIT_PROLOGUE_FILE_NAME = "`jit`";
+
     GcRootLambda::GcRootLambda( const Lambda & that, Context * _context ) : Lambda(that.capture) {
         context = _context;
         context->addGcRoot( (void *)capture, nullptr );
@@ -988,6 +990,8 @@ namespace das
         verySafeContext = options.getBoolOption("very_safe_context",policies.very_safe_context);
         breakOnException |= policies.debugger;
         gcEnabled = options.getBoolOption("gc", false);
+        gcMarkWorkers = options.getIntOption("gc_mark_workers", 0);
+        gcPageWatch = options.getBoolOption("gc_page_watch", false);
         persistent = options.getBoolOption("persistent_heap", policies.persistent_heap);
         if ( persistent ) {
             heap = make_smart<PersistentHeapAllocator>();
@@ -996,6 +1000,9 @@ namespace das
             heap = make_smart<LinearHeapAllocator>();
             stringHeap = make_smart<LinearStringAllocator>();
         }
+        if ( options.getBoolOption("heap_free_lists", false) ) {
+            heap->setFreeListMode(true, options.getBoolOption("heap_huge_pages", false));
+        }
         heap->setInitialSize ( options.getIntOption("heap_size_hint", policies.heap_size_hint) );
         heap->setLimit ( options.getUInt64OptionEx("heap_size_limit", "max_heap_allocated", policies.max_heap_allocated) );
         stringHeap->setInitialSize ( options.getIntOption("string_heap_size_hint", policies.string_heap_size_hint) );
@@ -1011,6 +1018,7 @@ namespace das
     }
 
     void Context::strip() {
+        cancelCollectHeapStep();
         stringHeap.reset();
         heap.reset();
         stack.strip();
@@ -1141,6 +1149,7 @@ namespace das
         tabMnLookup = ctx.tabMnLookup;
         tabGMnLookup = ctx.tabGMnLookup;
         tabAdLookup = ctx.tabAdLookup;
+        tabNameLookup = std::atomic_load(&ctx.tabNameLookup);
         // lockcheck
         skipLockChecks = ctx.skipLockChecks;
     }
@@ -1191,6 +1200,8 @@ namespace das
         verySafeContext = ctx.verySafeContext;
         persistent = ctx.persistent;
         gcEnabled = ctx.gcEnabled;
+        gcMarkWorkers = ctx.gcMarkWorkers;
+        gcPageWatch = ctx.gcPageWatch;
         code = ctx.code;
         constStringHeap = ctx.constStringHeap;
         debugInfo = ctx.debugInfo;
@@ -1234,6 +1245,7 @@ namespace das
         tabMnLookup = ctx.tabMnLookup;
         tabGMnLookup = ctx.tabGMnLookup;
         tabAdLookup = ctx.tabAdLookup;
+        tabNameLookup = std::atomic_load(&ctx.tabNameLookup);
         // lockcheck
         skipLockChecks = ctx.skipLockChecks;
         // threadlock_context
@@ -1243,25 +1255,29 @@ namespace das
         // now, make it good to go
         restart();
         if ( !failed ) {
-            if ( stack.size() > globalInitStackSize ) {
-                failed |= !runWithCatch([&]() {
-                    runInitScript();
-                });
-            } else {
-                auto ssz = max ( int(stack.size()), 16384 ) + globalInitStackSize;
-                StackAllocator init_stack(ssz);
-                SharedStackGuard init_guard(*this, init_stack);
-                failed |= !runWithCatch([&]() {
-                    runInitScript();
-                });
-            }
-            if ( failed ) {
-                to_err(&exceptionAt, last_exception);
-            }
+            runInitScriptAndReport();
         }
         restart();
     }
 
+    void Context::runInitScriptAndReport ( bool globalInitializers, bool runInitFunctions ) {
+        if ( stack.size() > globalInitStackSize ) {
+            failed |= !runWithCatch([&]() {
+                runInitScript(globalInitializers, runInitFunctions);
+            });
+        } else {
+            auto ssz = max ( int(stack.size()), 16384 ) + globalInitStackSize;
+            StackAllocator init_stack(ssz);
+            SharedStackGuard init_guard(*this, init_stack);
+            failed |= !runWithCatch([&]() {
+                runInitScript(globalInitializers, runInitFunctions);
+            });
+        }
+        if ( failed ) {
+            to_err(&exceptionAt, last_exception);
+        }
+    }
+
     void Context::addGcRoot ( void * ptr, TypeInfo * type ) {
         gcRoots[ptr] = type;
     }
@@ -1271,6 +1287,11 @@ namespace das
     }
 
     Context::~Context() {
+        // sampling thread reads our stack
+        samplingProfiler.reset();
+        // pooled job clones share our globals layout and code, they go first
+        jobContextPool.reset();
+        cancelCollectHeapStep();
         if ( !failed ) {
             on_debug_agent_mutex([&](){
                 // unregister
@@ -1405,52 +1426,55 @@ namespace das
         }
     };
 
-    void Context::runInitScript ( ) {
+    void Context::runInitScript ( bool globalInitializers, bool runInitFunctions ) {
         DAS_ASSERTF(insideContext==0,"can't run init script on the locked context");
-        char * EP, *SP;
-        if(!stack.push(globalInitStackSize,EP,SP)) {
-            throw_error("stack overflow in the initialization script");
-            return;
-        }
-        vec4f args[2] = {
-            cast<void *>::from(this),
-            cast<bool>::from(sharedOwner)   // only init shared if we are the owner
-        };
-        abiArg = args;
-        abiCMRES = nullptr;
-        if ( aotInitScript ) {
-            aotInitScript->eval(*this);
-        } else {
+        if ( globalInitializers ) {
+            char * EP, *SP;
+            if(!stack.push(globalInitStackSize,EP,SP)) {
+                throw_error("stack overflow in the initialization script");
+                return;
+            }
+            vec4f args[2] = {
+                cast<void *>::from(this),
+                cast<bool>::from(sharedOwner)   // only init shared if we are the owner
+            };
+            abiArg = args;
+            abiCMRES = nullptr;
+            if ( aotInitScript ) {
+                aotInitScript->eval(*this);
+            } else {
 #if DAS_ENABLE_STACK_WALK
-            FuncInfo finfo;
-            memset(&finfo, 0, sizeof(finfo));
-            finfo.name = (char *) "Context::runInitScript";
-            // TODO: init arguments?
+                FuncInfo finfo;
+                memset(&finfo, 0, sizeof(finfo));
+                finfo.name = (char *) "Context::runInitScript";
+                // TODO: init arguments?
 #endif
-            for ( int i=0, is=totalVariables; i!=is && !stopFlags; ++i ) {
-                auto & pv = globalVariables[i];
-                if ( pv.init ) {
-                    if ( sharedOwner || !pv.shared ) {
+                for ( int i=0, is=totalVariables; i!=is && !stopFlags; ++i ) {
+                    auto & pv = globalVariables[i];
+                    if ( pv.init ) {
+                        if ( sharedOwner || !pv.shared ) {
 #if DAS_ENABLE_STACK_WALK
-                        finfo.stackSize = globalInitStackSize;
-                        Prologue * pp = (Prologue *)stack.sp();
-                        pp->info = &finfo;
-                        pp->arguments = nullptr;    // TODO: args
-                        pp->cmres = nullptr;
-                        pp->line = &pv.init->debugInfo;
+                            finfo.stackSize = globalInitStackSize;
+                            Prologue * pp = (Prologue *)stack.sp();
+                            pp->info = &finfo;
+                            pp->arguments = nullptr;    // TODO: args
+                            pp->cmres = nullptr;
+                            pp->line = &pv.init->debugInfo;
 #endif
-                        pv.init->eval(*this);
+                            pv.init->eval(*this);
 #if DAS_ENABLE_STACK_WALK
-                        pp->info = nullptr;
+                            pp->info = nullptr;
 #endif
+                        }
+                    } else {
+                        memset ( globals + pv.offset, 0, pv.size );
                     }
-                } else {
-                    memset ( globals + pv.offset, 0, pv.size );
                 }
             }
+            abiArg = nullptr;
+            stack.pop(EP,SP);
         }
-        abiArg = nullptr;
-        stack.pop(EP,SP);
+        if ( !runInitFunctions ) return;
         // run init functions
         for ( int j=0, js=totalInitFunctions; j!=js && !stopFlags; ++j ) {
             auto & pf = initFunctions[j];
@@ -1508,7 +1532,42 @@ namespace das
         return res;
     }
 
+    // lookups by name can come from other threads (debug agents, invoke_in_context), and clones share the table.
+    // whoever builds it first publishes it, concurrent builders drop theirs
+    shared_ptr<das_hash_map<uint64_t,int32_t>> Context::getNameLookup () const {
+        auto lookup = std::atomic_load(&tabNameLookup);
+        if ( lookup ) return lookup;
+        auto built = make_shared<das_hash_map<uint64_t,int32_t>>();
+        if ( tabMnLookup ) {
+            built->reserve(tabMnLookup->size());
+            for ( auto & kv : *tabMnLookup ) {
+                auto fn = kv.second;
+                if ( fn==nullptr || !fn->name ) continue;
+                auto hash = hash_blockz64((const uint8_t *)fn->name);
+                int32_t index = ( fn>=functions && fn<functions+totalFunctions ) ? int32_t(fn - functions) : NAME_LOOKUP_COLLISION;
+                auto it = built->find(hash);
+                if ( it==built->end() ) {
+                    built->insert({hash, index});
+                } else if ( it->second>=0 && strcmp(functions[it->second].name, fn->name)==0 ) {
+                    it->second = NAME_LOOKUP_NOT_UNIQUE;
+                } else {
+                    it->second = NAME_LOOKUP_COLLISION;     // could be a different name with the same hash, scan tells
+                }
+            }
+        }
+        shared_ptr<das_hash_map<uint64_t,int32_t>> expected;
+        if ( std::atomic_compare_exchange_strong(&tabNameLookup, &expected, built) ) return built;
+        return expected;
+    }
+
     SimFunction * Context::findFunction ( const char * fnname ) const {
+        auto lookup = getNameLookup();
+        auto it = lookup->find(hash_blockz64((const uint8_t *)fnname));
+        if ( it==lookup->end() ) return nullptr;
+        if ( it->second>=0 ) {
+            auto fn = functions + it->second;
+            return strcmp(fn->name, fnname)==0 ? fn : nullptr;
+        }
         for ( auto & kv : *tabMnLookup ) {
             auto fn = kv.second;
             if ( fn!=nullptr && strcmp(fn->name, fnname)==0 ) {
@@ -1519,6 +1578,17 @@ namespace das
     }
 
     SimFunction * Context::findFunction ( const char * fnname, bool & isUnique ) const {
+        auto lookup = getNameLookup();
+        auto it = lookup->find(hash_blockz64((const uint8_t *)fnname));
+        if ( it==lookup->end() ) {
+            isUnique = false;
+            return nullptr;
+        }
+        if ( it->second>=0 ) {
+            auto fn = functions + it->second;
+            isUnique = strcmp(fn->name, fnname)==0;
+            return isUnique ? fn : nullptr;
+        }
         int candidates = 0;
         SimFunction * found = nullptr;
         for ( auto & kv : *tabMnLookup ) {
@@ -0,0 +1,747 @@
+#include "daScript/misc/platform.h"
+
+#ifdef _MSC_VER
+#pragma warning(disable:4505)
+#endif
+
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/simulate_fusion.h"
+#include "daScript/simulate/sim_policy.h"
+#include "daScript/simulate/simulate_visit_op.h"
+#include "daScript/simulate/runtime_range.h"
+
+// register bytecode
+//  function body, which is a tree of SimNodes, is translated into the linear sequence of 16 byte instructions
+//  operating on the small register file. locals stay in the stack frame, arguments stay in the argument array
+//  nodes, which bytecode does not know about, are evaluated in place via the 'eval' instructions
+//  such nodes are still visible to the SimVisitor, so fusion, relocation, and printing work as usual
+
+#ifndef DAS_BYTECODE_COMPUTED_GOTO
+#if defined(__GNUC__) || defined(__clang__)
+#define DAS_BYTECODE_COMPUTED_GOTO  1
+#else
+#define DAS_BYTECODE_COMPUTED_GOTO  0
+#endif
+#endif
+
+#ifndef DAS_BYTECODE_MAX_REGISTERS
+#define DAS_BYTECODE_MAX_REGISTERS  32
+#endif
+
+namespace das {
+
+    #define DAS_BC_NUMERIC(X,CALL)  X(CALL##I) X(CALL##U) X(CALL##F)
+    #define DAS_BC_SET(X,CALL)      DAS_BC_NUMERIC(X,Set##CALL##LocLoc) DAS_BC_NUMERIC(X,Set##CALL##LocConst)
+
+    #define DAS_BYTECODE_OPCODES(X) \
+        X(Exit) X(Eval) X(EvalI) X(EvalU) X(EvalF) X(EvalB) X(EvalRange) \
+        X(Const) X(LoadLocal4) X(LoadLocal1) X(LoadArg4) X(LoadArg1) X(StoreLocal4) X(StoreLocal1) \
+        X(CopyLocal4) X(CopyLocal1) \
+        X(Jmp) X(JmpF) X(JmpT) X(Not) X(ForBegin) X(ForNext) \
+        DAS_BC_NUMERIC(X,Unm) DAS_BC_NUMERIC(X,CvtI) DAS_BC_NUMERIC(X,CvtU) DAS_BC_NUMERIC(X,CvtF) \
+        X(RetI) X(RetU) X(RetF) X(RetB) X(RetNothing) \
+        DAS_BC_NUMERIC(X,Inc) DAS_BC_NUMERIC(X,Dec) \
+        DAS_BC_NUMERIC(X,Add) DAS_BC_NUMERIC(X,Sub) DAS_BC_NUMERIC(X,Mul) DAS_BC_NUMERIC(X,Div) DAS_BC_NUMERIC(X,Mod) \
+        DAS_BC_NUMERIC(X,Equ) DAS_BC_NUMERIC(X,NotEqu) DAS_BC_NUMERIC(X,Less) DAS_BC_NUMERIC(X,LessEqu) \
+        DAS_BC_NUMERIC(X,Gt) DAS_BC_NUMERIC(X,GtEqu) \
+        DAS_BC_NUMERIC(X,AddConst) DAS_BC_NUMERIC(X,SubConst) DAS_BC_NUMERIC(X,MulConst) DAS_BC_NUMERIC(X,DivConst) DAS_BC_NUMERIC(X,ModConst) \
+        DAS_BC_NUMERIC(X,EquConst) DAS_BC_NUMERIC(X,NotEquConst) DAS_BC_NUMERIC(X,LessConst) DAS_BC_NUMERIC(X,LessEquConst) \
+        DAS_BC_NUMERIC(X,GtConst) DAS_BC_NUMERIC(X,GtEquConst) \
+        DAS_BC_SET(X,Add) DAS_BC_SET(X,Sub) DAS_BC_SET(X,Mul) DAS_BC_SET(X,Div) DAS_BC_SET(X,Mod)
+
+    enum BcOp : uint16_t {
+#define BC_ENUM(name)   bc_##name,
+        DAS_BYTECODE_OPCODES(BC_ENUM)
+#undef BC_ENUM
+        bc_total
+    };
+
+    static const char * g_bcOpNames[] = {
+#define BC_NAME(name)   #name,
+        DAS_BYTECODE_OPCODES(BC_NAME)
+#undef BC_NAME
+    };
+
+    // order matches the DAS_BC_NUMERIC, DAS_BC_SET, and typed Eval\Ret groups
+    enum BcType : int32_t { bcInt, bcUInt, bcFloat, bcBool, bcNone };
+
+    static const char * g_bcArithmetic[] = { "Add", "Sub", "Mul", "Div", "Mod" };
+    static const char * g_bcComparison[] = { "Equ", "NotEqu", "Less", "LessEqu", "Gt", "GtEqu" };
+
+    #define BC_NO_TARGET    0xffffu
+
+    struct BcInstr {
+        uint16_t    op;
+        uint16_t    a, b, c;        // registers, or break and continue targets of the 'eval' statement
+        union {
+            struct {
+                uint32_t    x;      // stack offset, argument index, jump target, or line index
+                uint32_t    y;      // second jump target, source stack offset, or 32 bit constant
+            };
+            uint64_t    imm;
+            SimNode *   node;
+        };
+    };
+    static_assert(sizeof(BcInstr)==16, "bytecode instruction is expected to be 16 bytes");
+
+    union BcReg {
+        int32_t     i;
+        uint32_t    u;
+        float       f;
+        bool        b;
+        uint64_t    raw;
+        struct {
+            int32_t from;
+            int32_t to;
+        }           rng;
+    };
+
+    struct SimNode_Bytecode : SimNode {
+        SimNode_Bytecode ( const LineInfo & at ) : SimNode(at) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override;
+        virtual SimNode * copyNode ( Context & context, NodeAllocator * code ) override;
+        DAS_EVAL_ABI virtual vec4f eval ( Context & context ) override;
+        static bool hasNode ( uint16_t op ) {
+            return op>=bc_Eval && op<=bc_EvalRange;
+        }
+        BcInstr *   instructions = nullptr;
+        LineInfo *  lines = nullptr;
+        uint32_t    total = 0;
+        uint32_t    totalLines = 0;
+        uint32_t    registers = 0;
+    };
+
+    SimNode * SimNode_Bytecode::visit ( SimVisitor & vis ) {
+        V_BEGIN_CR();
+        V_OP(Bytecode);
+        V_ARG(total);
+        V_ARG(registers);
+        for ( uint32_t i=0, is=total; i!=is; ++i ) {
+            auto & ins = instructions[i];
+            if ( hasNode(ins.op) ) {
+                ins.node = vis.sub(ins.node, g_bcOpNames[ins.op]);
+            }
+        }
+        V_END();
+    }
+
+    SimNode * SimNode_Bytecode::copyNode ( Context & context, NodeAllocator * code ) {
+        SimNode_Bytecode * that = (SimNode_Bytecode *) SimNode::copyNode(context, code);
+        that->instructions = (BcInstr *) code->allocate(total*sizeof(BcInstr));
+        memcpy ( that->instructions, instructions, total*sizeof(BcInstr) );
+        if ( totalLines ) {
+            that->lines = (LineInfo *) code->allocate(totalLines*sizeof(LineInfo));
+            memcpy ( that->lines, lines, totalLines*sizeof(LineInfo) );
+        }
+        return that;
+    }
+
+#if DAS_BYTECODE_COMPUTED_GOTO && defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+
+    vec4f SimNode_Bytecode::eval ( Context & context ) {
+        DAS_PROFILE_NODE
+        BcReg regs[DAS_BYTECODE_MAX_REGISTERS];
+        char * sp = context.stack.sp();         // frame does not move while the function is running
+        vec4f * args = context.abiArguments();
+        const BcInstr * code = instructions;
+        const BcInstr * ip = code;
+#if DAS_BYTECODE_COMPUTED_GOTO
+        static const void * dispatch[] = {
+#define BC_ADDRESS(name)    &&bc_label_##name,
+            DAS_BYTECODE_OPCODES(BC_ADDRESS)
+#undef BC_ADDRESS
+        };
+#define BC_CASE(name)       bc_label_##name:
+#define BC_DISPATCH()       goto *dispatch[ip->op]
+        BC_DISPATCH();
+#else
+#define BC_CASE(name)       case bc_##name:
+#define BC_DISPATCH()       continue
+        for ( ;; ) switch ( ip->op ) {
+#endif
+        BC_CASE(Exit)
+            return v_zero();
+        BC_CASE(Eval)
+            ip->node->eval(context);
+            if ( context.stopFlags ) {
+                // same as DAS_PROCESS_LOOP_FLAGS for the closest loop, everything else leaves the function
+                if ( (context.stopFlags & EvalFlags::stopForContinue) && ip->c!=BC_NO_TARGET ) {
+                    context.stopFlags &= ~EvalFlags::stopForContinue;
+                    ip = code + ip->c;
+                    BC_DISPATCH();
+                }
+                if ( (context.stopFlags & EvalFlags::stopForBreak) && ip->b!=BC_NO_TARGET ) {
+                    context.stopFlags &= ~EvalFlags::stopForBreak;
+                    if ( !context.stopFlags ) {
+                        ip = code + ip->b;
+                        BC_DISPATCH();
+                    }
+                }
+                return v_zero();
+            }
+            ++ip; BC_DISPATCH();
+        BC_CASE(EvalI)
+            regs[ip->a].i = ip->node->evalInt(context);
+            ++ip; BC_DISPATCH();
+        BC_CASE(EvalU)
+            regs[ip->a].u = ip->node->evalUInt(context);
+            ++ip; BC_DISPATCH();
+        BC_CASE(EvalF)
+            regs[ip->a].f = ip->node->evalFloat(context);
+            ++ip; BC_DISPATCH();
+        BC_CASE(EvalB)
+            regs[ip->a].b = ip->node->evalBool(context);
+            ++ip; BC_DISPATCH();
+        BC_CASE(EvalRange) {
+                range r = cast<range>::to(ip->node->eval(context));
+                regs[ip->a].rng.from = r.from;
+                regs[ip->a].rng.to = r.to;
+            }
+            ++ip; BC_DISPATCH();
+        BC_CASE(Const)
+            regs[ip->a].raw = ip->imm;
+            ++ip; BC_DISPATCH();
+        BC_CASE(LoadLocal4)
+            regs[ip->a].u = *(uint32_t *)(sp + ip->x);
+            ++ip; BC_DISPATCH();
+        BC_CASE(LoadLocal1)
+            regs[ip->a].b = *(bool *)(sp + ip->x);
+            ++ip; BC_DISPATCH();
+        BC_CASE(LoadArg4)
+            regs[ip->a].u = *(uint32_t *)(args + ip->x);
+            ++ip; BC_DISPATCH();
+        BC_CASE(LoadArg1)
+            regs[ip->a].b = *(bool *)(args + ip->x);
+            ++ip; BC_DISPATCH();
+        BC_CASE(StoreLocal4)
+            *(uint32_t *)(sp + ip->x) = regs[ip->a].u;
+            ++ip; BC_DISPATCH();
+        BC_CASE(StoreLocal1)
+            *(bool *)(sp + ip->x) = regs[ip->a].b;
+            ++ip; BC_DISPATCH();
+        BC_CASE(CopyLocal4)
+            *(uint32_t *)(sp + ip->x) = *(uint32_t *)(sp + ip->y);
+            ++ip; BC_DISPATCH();
+        BC_CASE(CopyLocal1)
+            *(bool *)(sp + ip->x) = *(bool *)(sp + ip->y);
+            ++ip; BC_DISPATCH();
+        BC_CASE(Jmp)
+            ip = code + ip->x;
+            BC_DISPATCH();
+        BC_CASE(JmpF)
+            ip = regs[ip->a].b ? ip + 1 : code + ip->x;
+            BC_DISPATCH();
+        BC_CASE(JmpT)
+            ip = regs[ip->a].b ? code + ip->x : ip + 1;
+            BC_DISPATCH();
+        BC_CASE(Not)
+            regs[ip->a].b = !regs[ip->b].b;
+            ++ip; BC_DISPATCH();
+#define BC_CVT(SUFFIX,FIELD,CTYPE) \
+        BC_CASE(Cvt##SUFFIX##I) regs[ip->a].i = int32_t(regs[ip->b].FIELD);  ++ip; BC_DISPATCH(); \
+        BC_CASE(Cvt##SUFFIX##U) regs[ip->a].u = uint32_t(regs[ip->b].FIELD); ++ip; BC_DISPATCH(); \
+        BC_CASE(Cvt##SUFFIX##F) regs[ip->a].f = float(regs[ip->b].FIELD);    ++ip; BC_DISPATCH();
+        BC_CVT(I,i,int32_t)
+        BC_CVT(U,u,uint32_t)
+        BC_CVT(F,f,float)
+#undef BC_CVT
+        BC_CASE(UnmI)
+            regs[ip->a].i = SimPolicy<int32_t>::Unm(regs[ip->b].i, context, nullptr);
+            ++ip; BC_DISPATCH();
+        BC_CASE(UnmU)
+            regs[ip->a].u = SimPolicy<uint32_t>::Unm(regs[ip->b].u, context, nullptr);
+            ++ip; BC_DISPATCH();
+        BC_CASE(UnmF)
+            regs[ip->a].f = SimPolicy<float>::Unm(regs[ip->b].f, context, nullptr);
+            ++ip; BC_DISPATCH();
+        BC_CASE(ForBegin) {
+                auto & rr = regs[ip->a].rng;
+                if ( rr.from >= rr.to ) {
+                    ip = code + ip->y;
+                } else {
+                    *(int32_t *)(sp + ip->x) = rr.from;
+                    ++ip;
+                }
+            }
+            BC_DISPATCH();
+        BC_CASE(ForNext) {
+                auto & rr = regs[ip->a].rng;
+                if ( ++rr.from != rr.to ) {
+                    *(int32_t *)(sp + ip->x) = rr.from;
+                    ip = code + ip->y;
+                } else {
+                    ++ip;
+                }
+            }
+            BC_DISPATCH();
+        BC_CASE(RetI)
+            context.abiResult() = cast<int32_t>::from(regs[ip->a].i);
+            context.stopFlags |= EvalFlags::stopForReturn;
+            return v_zero();
+        BC_CASE(RetU)
+            context.abiResult() = cast<uint32_t>::from(regs[ip->a].u);
+            context.stopFlags |= EvalFlags::stopForReturn;
+            return v_zero();
+        BC_CASE(RetF)
+            context.abiResult() = cast<float>::from(regs[ip->a].f);
+            context.stopFlags |= EvalFlags::stopForReturn;
+            return v_zero();
+        BC_CASE(RetB)
+            context.abiResult() = cast<bool>::from(regs[ip->a].b);
+            context.stopFlags |= EvalFlags::stopForReturn;
+            return v_zero();
+        BC_CASE(RetNothing)
+            context.stopFlags |= EvalFlags::stopForReturn;
+            return v_zero();
+#define BC_OP1_LOCAL(CALL,SUFFIX,CTYPE) \
+        BC_CASE(CALL##SUFFIX) \
+            SimPolicy<CTYPE>::CALL(*(CTYPE *)(sp + ip->x), context, nullptr); \
+            ++ip; BC_DISPATCH();
+#define BC_OP2(CALL,SUFFIX,CTYPE,FIELD,RCTYPE,RFIELD,AT) \
+        BC_CASE(CALL##SUFFIX) \
+            regs[ip->a].RFIELD = RCTYPE(SimPolicy<CTYPE>::CALL(regs[ip->b].FIELD, regs[ip->c].FIELD, context, AT)); \
+            ++ip; BC_DISPATCH(); \
+        BC_CASE(CALL##Const##SUFFIX) \
+            regs[ip->a].RFIELD = RCTYPE(SimPolicy<CTYPE>::CALL(regs[ip->b].FIELD, *(const CTYPE *)&ip->y, context, AT)); \
+            ++ip; BC_DISPATCH();
+#define BC_SET_OP(CALL,SUFFIX,CTYPE,AT) \
+        BC_CASE(Set##CALL##LocLoc##SUFFIX) \
+            SimPolicy<CTYPE>::Set##CALL(*(CTYPE *)(sp + ip->x), *(CTYPE *)(sp + ip->y), context, AT); \
+            ++ip; BC_DISPATCH(); \
+        BC_CASE(Set##CALL##LocConst##SUFFIX) \
+            SimPolicy<CTYPE>::Set##CALL(*(CTYPE *)(sp + ip->x), *(const CTYPE *)&ip->y, context, AT); \
+            ++ip; BC_DISPATCH();
+#define BC_SET_NUMERIC(CALL,AT) \
+        BC_SET_OP(CALL,I,int32_t,AT) \
+        BC_SET_OP(CALL,U,uint32_t,AT) \
+        BC_SET_OP(CALL,F,float,nullptr)
+#define BC_OP2_NUMERIC(CALL,AT) \
+        BC_OP2(CALL,I,int32_t,i,int32_t,i,AT) \
+        BC_OP2(CALL,U,uint32_t,u,uint32_t,u,AT) \
+        BC_OP2(CALL,F,float,f,float,f,nullptr)
+#define BC_OP2_COMPARE(CALL) \
+        BC_OP2(CALL,I,int32_t,i,bool,b,nullptr) \
+        BC_OP2(CALL,U,uint32_t,u,bool,b,nullptr) \
+        BC_OP2(CALL,F,float,f,bool,b,nullptr)
+        BC_OP1_LOCAL(Inc,I,int32_t)
+        BC_OP1_LOCAL(Inc,U,uint32_t)
+        BC_OP1_LOCAL(Inc,F,float)
+        BC_OP1_LOCAL(Dec,I,int32_t)
+        BC_OP1_LOCAL(Dec,U,uint32_t)
+        BC_OP1_LOCAL(Dec,F,float)
+        BC_OP2_NUMERIC(Add,nullptr)
+        BC_OP2_NUMERIC(Sub,nullptr)
+        BC_OP2_NUMERIC(Mul,nullptr)
+        BC_OP2_NUMERIC(Div,lines + ip->x)
+        BC_OP2_NUMERIC(Mod,lines + ip->x)
+        BC_OP2_COMPARE(Equ)
+        BC_OP2_COMPARE(NotEqu)
+        BC_OP2_COMPARE(Less)
+        BC_OP2_COMPARE(LessEqu)
+        BC_OP2_COMPARE(Gt)
+        BC_OP2_COMPARE(GtEqu)
+        BC_SET_NUMERIC(Add,nullptr)
+        BC_SET_NUMERIC(Sub,nullptr)
+        BC_SET_NUMERIC(Mul,nullptr)
+        BC_SET_NUMERIC(Div,lines + ip->a)
+        BC_SET_NUMERIC(Mod,lines + ip->a)
+#undef BC_SET_NUMERIC
+#undef BC_SET_OP
+#undef BC_OP2_COMPARE
+#undef BC_OP2_NUMERIC
+#undef BC_OP2
+#undef BC_OP1_LOCAL
+#if !DAS_BYTECODE_COMPUTED_GOTO
+        default:
+            DAS_ASSERTF(0, "unsupported bytecode instruction %i", int(ip->op));
+            return v_zero();
+        }
+#endif
+#undef BC_DISPATCH
+#undef BC_CASE
+    }
+
+#if DAS_BYTECODE_COMPUTED_GOTO && defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+    struct SimNodeNameCollector : SimVisitor {
+        virtual void preVisit ( SimNode * node ) override {
+            SimVisitor::preVisit(node);
+            thisNode = node;
+        }
+        virtual void op ( const char * name, uint32_t typeSize, const string & typeName ) override {
+            SimNodeInfo ni;
+            ni.name = name;
+            ni.typeName = typeName;
+            ni.typeSize = typeSize;
+            info[thisNode] = ni;
+        }
+        SimNodeInfoLookup   info;
+        SimNode * thisNode = nullptr;
+    };
+
+    struct BytecodeBuilder {
+        BytecodeBuilder ( const SimNodeInfoLookup & ni ) : info(ni) {}
+        struct Loop {
+            vector<uint32_t>    breaks;
+            vector<uint32_t>    continues;
+            vector<uint32_t>    evals;
+        };
+        // translate function body, or return nullptr if there is nothing to gain
+        SimNode * build ( Context & context, SimNode * root ) {
+            auto ni = lookup(root);
+            if ( !ni || ni->name!="Block" ) return nullptr;
+            auto blk = (SimNode_Block *) root;
+            if ( blk->totalFinal || blk->totalLabels ) return nullptr;
+            for ( uint32_t i=0, is=blk->total; i!=is; ++i ) {
+                statement(blk->list[i], 0);
+            }
+            emit(bc_Exit);
+            if ( failed || !native ) return nullptr;
+            auto bc = context.code->makeNode<SimNode_Bytecode>(root->debugInfo);
+            bc->total = uint32_t(code.size());
+            bc->instructions = (BcInstr *) context.code->allocate(bc->total*sizeof(BcInstr));
+            memcpy ( bc->instructions, code.data(), bc->total*sizeof(BcInstr) );
+            bc->totalLines = uint32_t(lines.size());
+            if ( bc->totalLines ) {
+                bc->lines = (LineInfo *) context.code->allocate(bc->totalLines*sizeof(LineInfo));
+                memcpy ( bc->lines, lines.data(), bc->totalLines*sizeof(LineInfo) );
+            }
+            bc->registers = maxReg + 1;
+            return bc;
+        }
+    protected:
+        const SimNodeInfo * lookup ( SimNode * node ) const {
+            auto it = info.find(node);
+            return it!=info.end() ? &it->second : nullptr;
+        }
+        static BcType typeOf ( const string & typeName ) {
+            if ( typeName=="int" ) return bcInt;
+            else if ( typeName=="uint" ) return bcUInt;
+            else if ( typeName=="float" ) return bcFloat;
+            else if ( typeName=="bool" ) return bcBool;
+            else return bcNone;
+        }
+        template <size_t N>
+        static int32_t indexOf ( const char * (&names)[N], const string & name ) {
+            for ( size_t i=0; i!=N; ++i ) {
+                if ( name==names[i] ) return int32_t(i);
+            }
+            return -1;
+        }
+        static BcType castTo ( const string & name ) {
+            return name.compare(0,8,"Cast_to_")==0 ? typeOf(name.substr(8)) : bcNone;
+        }
+        static bool isNumeric ( BcType t ) {
+            return t==bcInt || t==bcUInt || t==bcFloat;
+        }
+        bool isLocal ( SimNode * node ) const {
+            auto ni = lookup(node);
+            return ni && ni->name=="GetLocal";
+        }
+        static uint32_t localOffset ( SimNode * node ) {
+            return ((SimNode_GetLocal *)node)->subexpr.stackTop;
+        }
+        uint32_t here() const {
+            return uint32_t(code.size());
+        }
+        uint32_t emit ( uint16_t op, uint32_t a=0, uint32_t b=0, uint32_t c=0 ) {
+            BcInstr ins;
+            ins.op = op;
+            ins.a = uint16_t(a);
+            ins.b = uint16_t(b);
+            ins.c = uint16_t(c);
+            ins.imm = 0;
+            code.push_back(ins);
+            if ( !SimNode_Bytecode::hasNode(op) && op!=bc_Exit ) native ++;
+            return uint32_t(code.size()-1);
+        }
+        uint32_t line ( SimNode * node ) {
+            lines.push_back(node->debugInfo);
+            return uint32_t(lines.size()-1);
+        }
+        void reg ( uint32_t r ) {
+            if ( r>=DAS_BYTECODE_MAX_REGISTERS ) {
+                failed = true;
+            } else {
+                maxReg = das::max(maxReg, r);
+            }
+        }
+        // type of the expression, if bytecode can evaluate it into the register
+        BcType inferType ( SimNode * node ) const {
+            auto ni = lookup(node);
+            if ( !ni ) return bcNone;
+            auto nt = typeOf(ni->typeName);
+            if ( ni->name=="GetLocalR2V" ) {
+                return nt;
+            } else if ( ni->name=="BoolAnd" || ni->name=="BoolOr" || ni->name=="BoolNot" ) {
+                return bcBool;
+            } else if ( !node->rtti_node_isCallBase() && isNumeric(nt) && indexOf(g_bcArithmetic,ni->name)!=-1 ) {
+                return nt;
+            } else if ( !node->rtti_node_isCallBase() && isNumeric(nt) && indexOf(g_bcComparison,ni->name)!=-1 ) {
+                return bcBool;
+            } else if ( ni->name=="Unm" && isNumeric(nt) && !node->rtti_node_isCallBase() ) {
+                return nt;
+            } else if ( isNumeric(nt) && isNumeric(castTo(ni->name)) ) {
+                return castTo(ni->name);
+            } else if ( ni->name=="IfThenElse" ) {
+                auto ite = (SimNode_IfThenElse *) node;
+                auto tt = inferType(ite->if_true);
+                return tt==inferType(ite->if_false) ? tt : bcNone;
+            }
+            return bcNone;
+        }
+        // evaluate expression of the known type into the register
+        void expression ( SimNode * node, BcType type, uint32_t r ) {
+            reg(r);
+            auto ni = lookup(node);
+            if ( ni ) {
+                const auto & name = ni->name;
+                auto nt = typeOf(ni->typeName);
+                if ( name=="ConstValue" ) {
+                    code[emit(bc_Const, r)].imm = ((SimNode_ConstValue *)node)->subexpr.valueU64;
+                    return;
+                } else if ( name=="GetLocalR2V" && nt==type ) {
+                    code[emit(type==bcBool ? bc_LoadLocal1 : bc_LoadLocal4, r)].x = localOffset(node);
+                    return;
+                } else if ( name=="GetArgument" ) {
+                    code[emit(type==bcBool ? bc_LoadArg1 : bc_LoadArg4, r)].x = uint32_t(((SimNode_GetArgument *)node)->subexpr.index);
+                    return;
+                }
+                bool builtinOp = !node->rtti_node_isCallBase() && isNumeric(nt);
+                auto arith = builtinOp ? indexOf(g_bcArithmetic, name) : -1;
+                auto cmp = builtinOp ? indexOf(g_bcComparison, name) : -1;
+                if ( (arith!=-1 && nt==type) || (cmp!=-1 && type==bcBool) ) {
+                    auto op2 = (SimNode_Op2 *) node;
+                    auto rni = lookup(op2->r);
+                    bool rightConst = rni && rni->name=="ConstValue";   // 32 bit constant goes into y
+                    expression(op2->l, nt, r);
+                    if ( !rightConst ) expression(op2->r, nt, r+1);
+                    uint16_t op = arith!=-1 ? uint16_t((rightConst ? bc_AddConstI : bc_AddI) + arith*3 + nt)
+                                            : uint16_t((rightConst ? bc_EquConstI : bc_EquI) + cmp*3 + nt);
+                    auto at = emit(op, r, r, r+1);
+                    if ( arith==3 || arith==4 ) code[at].x = line(node);
+                    if ( rightConst ) code[at].y = ((SimNode_ConstValue *)op2->r)->subexpr.valueU;
+                    return;
+                } else if ( builtinOp && name=="Unm" && nt==type ) {
+                    expression(((SimNode_Op1 *)node)->x, nt, r);
+                    emit(uint16_t(bc_UnmI + nt), r, r);
+                    return;
+                } else if ( type==bcBool && (name=="BoolAnd" || name=="BoolOr") ) {
+                    auto op2 = (SimNode_Op2 *) node;
+                    expression(op2->l, bcBool, r);
+                    auto jmp = emit(name=="BoolAnd" ? bc_JmpF : bc_JmpT, r);
+                    expression(op2->r, bcBool, r);
+                    code[jmp].x = here();
+                    return;
+                } else if ( isNumeric(nt) && castTo(name)==type ) {
+                    // SimNode_Cast, typeName is the type it casts from
+                    expression(((SimNode_CallBase *)node)->arguments[0], nt, r);
+                    emit(uint16_t(bc_CvtII + nt*3 + type), r, r);
+                    return;
+                } else if ( type==bcBool && name=="BoolNot" && nt==bcBool && !node->rtti_node_isCallBase() ) {
+                    expression(((SimNode_Op1 *)node)->x, bcBool, r);
+                    emit(bc_Not, r, r);
+                    return;
+                } else if ( name=="IfThenElse" ) {
+                    auto ite = (SimNode_IfThenElse *) node;
+                    expression(ite->cond, bcBool, r);
+                    auto jf = emit(bc_JmpF, r);
+                    expression(ite->if_true, type, r);
+                    auto jend = emit(bc_Jmp);
+                    code[jf].x = here();
+                    expression(ite->if_false, type, r);
+                    code[jend].x = here();
+                    return;
+                }
+            }
+            code[emit(uint16_t(bc_EvalI + type), r)].node = node;
+        }
+        // evaluate statement, the way SimNode_Block would
+        void statement ( SimNode * node, uint32_t r ) {
+            auto ni = lookup(node);
+            if ( ni ) {
+                const auto & name = ni->name;
+                auto nt = typeOf(ni->typeName);
+                if ( name=="Block" || name=="Let" ) {
+                    auto blk = (SimNode_Block *) node;
+                    if ( !blk->totalFinal && !blk->totalLabels ) {
+                        for ( uint32_t i=0, is=blk->total; i!=is; ++i ) {
+                            statement(blk->list[i], r);
+                        }
+                        return;
+                    }
+                } else if ( name=="Set" && nt!=bcNone && isLocal(((SimNode_Set<int32_t> *)node)->l) ) {
+                    auto set = (SimNode_Set<int32_t> *) node;
+                    expression(set->r, nt, r);
+                    code[emit(nt==bcBool ? bc_StoreLocal1 : bc_StoreLocal4, r)].x = localOffset(set->l);
+                    return;
+                } else if ( name=="CopyRefValue" && isLocal(((SimNode_CopyRefValue *)node)->l) && isLocal(((SimNode_CopyRefValue *)node)->r) ) {
+                    // let t = local, of the 4 or 1 byte type
+                    auto copy = (SimNode_CopyRefValue *) node;
+                    if ( copy->size==4 || copy->size==1 ) {
+                        auto at = emit(copy->size==4 ? bc_CopyLocal4 : bc_CopyLocal1);
+                        code[at].x = localOffset(copy->l);
+                        code[at].y = localOffset(copy->r);
+                        return;
+                    }
+                } else if ( name.size()>3 && name.compare(0,3,"Set")==0 && isNumeric(nt) && !node->rtti_node_isCallBase()
+                        && indexOf(g_bcArithmetic,name.substr(3))!=-1 && isLocal(((SimNode_Op2 *)node)->l) ) {
+                    // local op= value, right side is evaluated before the left side is read
+                    auto op2 = (SimNode_Op2 *) node;
+                    auto arith = indexOf(g_bcArithmetic, name.substr(3));
+                    auto ofs = localOffset(op2->l);
+                    auto rni = lookup(op2->r);
+                    bool rightLocal = rni && rni->name=="GetLocalR2V" && typeOf(rni->typeName)==nt;
+                    if ( rightLocal || (rni && rni->name=="ConstValue") ) {
+                        // single instruction, 32 bit constant or source offset is in y
+                        auto at = emit(uint16_t(bc_SetAddLocLocI + arith*6 + (rightLocal ? 0 : 3) + nt));
+                        code[at].x = ofs;
+                        code[at].y = rightLocal ? localOffset(op2->r) : ((SimNode_ConstValue *)op2->r)->subexpr.valueU;
+                        if ( arith==3 || arith==4 ) {
+                            auto li = line(node);
+                            if ( li>=BC_NO_TARGET ) failed = true;
+                            code[at].a = uint16_t(li);
+                        }
+                        return;
+                    }
+                    expression(op2->r, nt, r+1);
+                    code[emit(bc_LoadLocal4, r)].x = ofs;
+                    auto op = uint16_t(bc_AddI + arith*3 + nt);
+                    auto at = emit(op, r, r, r+1);
+                    if ( op>=bc_DivI && op<=bc_ModF ) code[at].x = line(node);
+                    code[emit(bc_StoreLocal4, r)].x = ofs;
+                    return;
+                } else if ( (name=="Inc" || name=="IncPost" || name=="Dec" || name=="DecPost") && isNumeric(nt)
+                        && !node->rtti_node_isCallBase() && isLocal(((SimNode_Op1 *)node)->x) ) {
+                    auto op = uint16_t((name[0]=='I' ? bc_IncI : bc_DecI) + nt);
+                    code[emit(op)].x = localOffset(((SimNode_Op1 *)node)->x);
+                    return;
+                } else if ( name=="IfThen" || name=="IfThenElse" ) {
+                    auto ite = (SimNode_IfTheElseAny *) node;
+                    expression(ite->cond, bcBool, r);
+                    auto jf = emit(bc_JmpF, r);
+                    statement(ite->if_true, r);
+                    if ( ite->if_false ) {
+                        auto jend = emit(bc_Jmp);
+                        code[jf].x = here();
+                        statement(ite->if_false, r);
+                        code[jend].x = here();
+                    } else {
+                        code[jf].x = here();
+                    }
+                    return;
+                } else if ( name=="While" ) {
+                    auto wh = (SimNode_While *) node;
+                    if ( !wh->totalFinal && !wh->totalLabels ) {
+                        loops.emplace_back();
+                        auto top = here();
+                        expression(wh->cond, bcBool, r);
+                        auto jf = emit(bc_JmpF, r);
+                        for ( uint32_t i=0, is=wh->total; i!=is; ++i ) {
+                            statement(wh->list[i], r);
+                        }
+                        code[emit(bc_Jmp)].x = top;
+                        code[jf].x = here();
+                        closeLoop(here(), top);
+                        return;
+                    }
+                } else if ( (name=="ForRange" || name=="ForRangeNF" || name=="ForRange1" || name=="ForRangeNF1") && nt==bcInt ) {
+                    auto fr = (SimNode_ForBase *) node;
+                    if ( !fr->totalFinal && !fr->totalLabels && fr->totalSources==1 ) {
+                        reg(r);
+                        code[emit(bc_EvalRange, r)].node = fr->sources[0];
+                        auto begin = emit(bc_ForBegin, r);
+                        code[begin].x = fr->stackTop[0];
+                        loops.emplace_back();
+                        auto body = here();
+                        for ( uint32_t i=0, is=fr->total; i!=is; ++i ) {
+                            statement(fr->list[i], r+1);
+                        }
+                        auto next = emit(bc_ForNext, r);
+                        code[next].x = fr->stackTop[0];
+                        code[next].y = body;
+                        code[begin].y = here();
+                        closeLoop(here(), next);
+                        return;
+                    }
+                } else if ( name=="Return" ) {
+                    auto ret = (SimNode_Return *) node;
+                    if ( !ret->subexpr ) {
+                        emit(bc_RetNothing);
+                        return;
+                    }
+                    auto rt = inferType(ret->subexpr);
+                    if ( rt!=bcNone ) {
+                        expression(ret->subexpr, rt, r);
+                        emit(uint16_t(bc_RetI + rt), r);
+                        return;
+                    }
+                } else if ( name=="ReturnNothing" ) {
+                    emit(bc_RetNothing);
+                    return;
+                } else if ( (name=="Break" || name=="Continue") && !loops.empty() ) {
+                    auto jmp = emit(bc_Jmp);
+                    if ( name=="Break" ) {
+                        loops.back().breaks.push_back(jmp);
+                    } else {
+                        loops.back().continues.push_back(jmp);
+                    }
+                    return;
+                }
+            }
+            auto at = emit(bc_Eval, 0, BC_NO_TARGET, BC_NO_TARGET);
+            code[at].node = node;
+            if ( !loops.empty() ) {
+                loops.back().evals.push_back(at);
+            }
+        }
+        void closeLoop ( uint32_t breakTo, uint32_t continueTo ) {
+            auto & loop = loops.back();
+            for ( auto at : loop.breaks ) code[at].x = breakTo;
+            for ( auto at : loop.continues ) code[at].x = continueTo;
+            if ( breakTo>=BC_NO_TARGET ) {
+                failed = !loop.evals.empty();   // eval targets are 16 bit
+            } else {
+                for ( auto at : loop.evals ) {
+                    code[at].b = uint16_t(breakTo);
+                    code[at].c = uint16_t(continueTo);
+                }
+            }
+            loops.pop_back();
+        }
+    public:
+        const SimNodeInfoLookup &   info;
+        vector<BcInstr>             code;
+        vector<LineInfo>            lines;
+        vector<Loop>                loops;
+        uint32_t                    maxReg = 0;
+        uint32_t                    native = 0;
+        bool                        failed = false;
+    };
+
+    void Program::bytecode ( Context & context, TextWriter & logs ) {
+        if ( !options.getBoolOption("bytecode", policies.bytecode) ) return;
+        if ( getDebugger() || getProfiler() ) return;   // debug and profile nodes single-step the tree
+        bool logIt = options.getBoolOption("log_optimization", false);
+        int32_t translated = 0;
+        for ( int i=0, is=context.totalFunctions; i!=is; ++i ) {
+            SimFunction * fn = context.getFunction(i);
+            if ( fn->fastcall || !fn->code ) continue;
+            SimNodeNameCollector collector;
+            fn->code->visit(collector);
+            BytecodeBuilder builder(collector.info);
+            if ( auto bc = builder.build(context, fn->code) ) {
+                fn->code = bc;
+                translated ++;
+            }
+        }
+        if ( logIt ) {
+            logs << "BYTECODE " << translated << " functions\n";
+        }
+    }
+}
@@ -147,10 +147,119 @@ namespace das {
 
     IMPLEMENT_ANY_SETOP(__forceinline, ArrayAt, Ptr, StringPtr, StringPtr);
 
+/* ArrayAtUncheckedR2V SCALAR */
+
+#undef IMPLEMENT_OP2_SET_NODE_ANY
+#define IMPLEMENT_OP2_SET_NODE_ANY(INLINE,OPNAME,TYPE,CTYPE,COMPUTEL) \
+    struct SimNode_##OPNAME##_##COMPUTEL##_Any : SimNode_Op2ArrayAt { \
+        INLINE auto compute ( Context & context ) { \
+            DAS_PROFILE_NODE \
+            auto pl = (Array *) l.compute##COMPUTEL(context); \
+            auto rr = uint32_t(r.subexpr->evalInt(context)); \
+            return *((CTYPE *)(pl->data + rr*stride + offset)); \
+        } \
+        DAS_NODE(TYPE,CTYPE); \
+    };
+
+#undef IMPLEMENT_OP2_SET_NODE
+#define IMPLEMENT_OP2_SET_NODE(INLINE,OPNAME,TYPE,CTYPE,COMPUTEL,COMPUTER) \
+    struct SimNode_##OPNAME##_##COMPUTEL##_##COMPUTER : SimNode_Op2ArrayAt { \
+        INLINE auto compute ( Context & context ) { \
+            DAS_PROFILE_NODE \
+            auto pl = (Array *) l.compute##COMPUTEL(context); \
+            auto rr = *((uint32_t *)r.compute##COMPUTER(context)); \
+            return *((CTYPE *)(pl->data + rr*stride + offset)); \
+        } \
+        DAS_NODE(TYPE,CTYPE); \
+    };
+
+#undef IMPLEMENT_OP2_SET_SETUP_NODE
+#define IMPLEMENT_OP2_SET_SETUP_NODE(result,node) \
+    auto rn = (SimNode_Op2ArrayAt *)result; \
+    auto sn = (SimNode_ArrayAt *)node; \
+    rn->stride = sn->stride; \
+    rn->offset = sn->offset;
+
+#include "daScript/simulate/simulate_fusion_op2_set_impl.h"
+#include "daScript/simulate/simulate_fusion_op2_set_perm.h"
+
+    IMPLEMENT_SETOP_SCALAR(ArrayAtUncheckedR2V);
+
+/* ArrayAtUncheckedR2V VECTOR */
+
+#undef IMPLEMENT_OP2_SET_NODE_ANY
+#define IMPLEMENT_OP2_SET_NODE_ANY(INLINE,OPNAME,TYPE,CTYPE,COMPUTEL) \
+    struct SimNode_##OPNAME##_##COMPUTEL##_Any : SimNode_Op2ArrayAt { \
+         DAS_EVAL_ABI virtual vec4f eval ( Context & context ) override { \
+            DAS_PROFILE_NODE \
+            auto pl = (Array *) l.compute##COMPUTEL(context); \
+            auto rr = uint32_t(r.subexpr->evalInt(context)); \
+            return v_ldu((const float *)(pl->data + rr*stride + offset)); \
+        } \
+    };
+
+#undef IMPLEMENT_OP2_SET_NODE
+#define IMPLEMENT_OP2_SET_NODE(INLINE,OPNAME,TYPE,CTYPE,COMPUTEL,COMPUTER) \
+    struct SimNode_##OPNAME##_##COMPUTEL##_##COMPUTER : SimNode_Op2ArrayAt { \
+         DAS_EVAL_ABI virtual vec4f eval ( Context & context ) override { \
+            DAS_PROFILE_NODE \
+            auto pl = (Array *) l.compute##COMPUTEL(context); \
+            auto rr = *((uint32_t *)r.compute##COMPUTER(context)); \
+            return v_ldu((const float *)(pl->data + rr*stride + offset)); \
+        } \
+    };
+
+#include "daScript/simulate/simulate_fusion_op2_set_impl.h"
+#include "daScript/simulate/simulate_fusion_op2_set_perm.h"
+
+    IMPLEMENT_SETOP_NUMERIC_VEC(ArrayAtUncheckedR2V);
+
+/* ArrayAtUnchecked */
+
+#undef IMPLEMENT_OP2_SET_NODE_ANY
+#define IMPLEMENT_OP2_SET_NODE_ANY(INLINE,OPNAME,TYPE,CTYPE,COMPUTEL) \
+    struct SimNode_##OPNAME##_##COMPUTEL##_Any : SimNode_Op2ArrayAt { \
+        INLINE auto compute ( Context & context ) { \
+            DAS_PROFILE_NODE \
+            auto pl = (Array *) l.compute##COMPUTEL(context); \
+            auto rr = uint32_t(r.subexpr->evalInt(context)); \
+            return pl->data + rr*stride + offset; \
+        } \
+        DAS_PTR_NODE; \
+    };
+
+#undef IMPLEMENT_OP2_SET_NODE
+#define IMPLEMENT_OP2_SET_NODE(INLINE,OPNAME,TYPE,CTYPE,COMPUTEL,COMPUTER) \
+    struct SimNode_##OPNAME##_##COMPUTEL##_##COMPUTER : SimNode_Op2ArrayAt { \
+        INLINE auto compute ( Context & context ) { \
+            DAS_PROFILE_NODE \
+            auto pl = (Array *) l.compute##COMPUTEL(context); \
+            auto rr = *((uint32_t *)r.compute##COMPUTER(context)); \
+            return pl->data + rr*stride + offset; \
+        } \
+        DAS_PTR_NODE; \
+    };
+
+#undef IMPLEMENT_OP2_SET_SETUP_NODE
+#define IMPLEMENT_OP2_SET_SETUP_NODE(result,node) \
+    auto rn = (SimNode_Op2ArrayAt *)result; \
+    auto sn = (SimNode_ArrayAt *)node; \
+    rn->stride = sn->stride; \
+    rn->offset = sn->offset; \
+    rn->baseType = Type::none;
+
+#include "daScript/simulate/simulate_fusion_op2_set_impl.h"
+#include "daScript/simulate/simulate_fusion_op2_set_perm.h"
+
+    IMPLEMENT_ANY_SETOP(__forceinline, ArrayAtUnchecked, Ptr, StringPtr, StringPtr);
+
     void createFusionEngine_at_array() {
         REGISTER_SETOP_SCALAR(ArrayAtR2V);
         REGISTER_SETOP_NUMERIC_VEC(ArrayAtR2V);
         (*getFusionEngine())["ArrayAt"].emplace_back(new FusionPoint_Set_ArrayAt_StringPtr());
+        REGISTER_SETOP_SCALAR(ArrayAtUncheckedR2V);
+        REGISTER_SETOP_NUMERIC_VEC(ArrayAtUncheckedR2V);
+        (*getFusionEngine())["ArrayAtUnchecked"].emplace_back(new FusionPoint_Set_ArrayAtUnchecked_StringPtr());
     }
 }
 
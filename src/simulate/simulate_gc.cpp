@@ -4,6 +4,9 @@
 #include "daScript/simulate/simulate.h"
 #include "daScript/simulate/data_walker.h"
 #include "daScript/simulate/debug_print.h"
+#include "daScript/misc/job_que.h"
+#include "daScript/misc/performance_time.h"
+#include "daScript/misc/page_watch.h"
 
 namespace das
 {
@@ -391,8 +394,8 @@ namespace das
             popRange();
         }
         virtual void beforeTable ( Table * PT, TypeInfo * ti ) override {
-            auto tsize = (ti->firstType->size + ti->secondType->size + sizeof(TableHashKey)) * PT->capacity;
-            DAS_ASSERT(tsize==(getTypeSize(ti->firstType)+getTypeSize(ti->secondType)+sizeof(TableHashKey))*PT->capacity);
+            auto tsize = table_mem_size(PT->capacity, ti->firstType->size + ti->secondType->size);
+            DAS_ASSERT(tsize==table_mem_size(PT->capacity, getTypeSize(ti->firstType)+getTypeSize(ti->secondType)));
             char * pa = PT->data;
             PtrRange rdata(pa, tsize);
             if ( reportHeap && tsize && markRange(rdata) ) {
@@ -722,12 +725,21 @@ namespace das
         }
     }
 
+    struct GcGray {
+        char *          ps;
+        StructInfo *    si;
+        PtrRange        range;
+    };
+
     struct GcMarkAnyHeap final : BaseGcDataWalker {
         vector<PtrRange>    ptrRangeStack;
         PtrRange            currentRange;
         das_set<char *>     failed;
         bool                markStringHeap = true;
         bool                validate = false;
+        bool                atomicMark = false;     // parallel mark, several walkers share the heap
+        vector<GcGray> *    gray = nullptr;         // incremental mark, pointers to structures are queued instead of walked
+        vector<PtrRange> *  ranges = nullptr;       // incremental mark, heap memory read while walking the current object
         void prepare() {
             currentRange.clear();
             gcFlags = TypeInfo::flag_heapGC;
@@ -751,13 +763,34 @@ namespace das
                             failed.insert(r.from);
                         }
                     }
+                } else if ( atomicMark ) {
+                    result = context->heap->markAtomic(r.from, ssize);
                 } else {
                     result = context->heap->mark(r.from, ssize);
                 }
                 currentRange = r;
+                if ( ranges ) ranges->push_back(r);
             }
             return result;
         }
+        void walkStructFields ( char * ps, StructInfo * si ) {
+            if ( canVisitStructure_(ps, si) ) {
+                beforeStructure_(ps, si);
+                for ( uint32_t i=si->firstGcField, is=si->count; i!=is; ) {
+                    VarInfo * vi = si->fields[i];
+                    char * pf = ps + vi->offset;
+                    walk(pf, vi);
+                    i = vi->nextGcField;
+                }
+                afterStructure_(ps, si);
+            }
+        }
+        void walkGray ( const GcGray & g ) {
+            prepare();
+            currentRange = g.range;
+            if ( ranges ) ranges->push_back(g.range);
+            walkStructFields(g.ps, g.si);
+        }
         void popRange() {
             currentRange = ptrRangeStack.back();
             ptrRangeStack.pop_back();
@@ -787,7 +820,7 @@ namespace das
             popRange();
         }
         virtual void beforeTable ( Table * PT, TypeInfo * ti ) override {
-            PtrRange rdata(PT->data, (ti->firstType->size+ti->secondType->size+sizeof(TableHashKey))*size_t(PT->capacity));
+            PtrRange rdata(PT->data, size_t(table_mem_size(PT->capacity, ti->firstType->size+ti->secondType->size)));
             markAndPushRange(rdata);
         }
         virtual void afterTable ( Table *, TypeInfo * ) override {
@@ -850,6 +883,8 @@ namespace das
                         failed.insert(st);
                     }
                 }
+            } else if ( atomicMark ) {
+                context->stringHeap->markAtomic(st, len);
             } else {
                 context->stringHeap->mark(st, len);
             }
@@ -904,21 +939,23 @@ namespace das
                                     si = (*(TypeInfo **) ps)->structType;
                                     tsize = si->size;
                                 }
-                                if (markAndPushRange(PtrRange(ps, tsize))) {
-                                    // walk_struct(*(char**)pa, info->firstType->structType);
-                                    ps = *(char**)pa;
-                                    if ( canVisitStructure_(ps, si) ) {
-                                        beforeStructure_(ps, si);
-                                        for ( uint32_t i=si->firstGcField, is=si->count; i!=is; ) {
-                                            VarInfo * vi = si->fields[i];
-                                            char * pf = ps + vi->offset;
-                                            walk(pf, vi);
-                                            i = vi->nextGcField;
+                                if ( gray ) {
+                                    PtrRange range(ps, tsize);
+                                    if ( !currentRange.contains(range) ) {
+                                        auto rangeMark = ranges ? ranges->size() : 0;
+                                        if ( markAndPushRange(range) ) {
+                                            gray->push_back({*(char**)pa, si, range});
                                         }
-                                        afterStructure_(ps, si);
+                                        if ( ranges ) ranges->resize(rangeMark);   // this one is read when the queued object is walked
+                                        popRange();
+                                    }
+                                } else {
+                                    if (markAndPushRange(PtrRange(ps, tsize))) {
+                                        // walk_struct(*(char**)pa, info->firstType->structType);
+                                        walkStructFields(*(char**)pa, si);
                                     }
+                                    popRange();
                                 }
-                                popRange();
                             } else {
                                 beforePtr(pa, info);
                                 walk(*(char**)pa, info->firstType);
@@ -961,44 +998,57 @@ namespace das
         Context * ctx = nullptr;
     };
 
-    void Context::collectHeap ( LineInfo * at, bool sheap, bool validate ) {
-        GcGuard guard(this);
-        // clean up, so that all small allocations are marked as 'free'
-        stringDisposeQue = nullptr;
-        if ( sheap && !stringHeap->mark() ) return;
-        if ( !heap->mark() ) return;
-        // now
-        GcMarkAnyHeap walker;
-        walker.markStringHeap = sheap;
-        walker.context = this;
-        walker.validate = validate;
-        // mark GC roots
-        foreach_gc_root([&](void * _pa, TypeInfo * ti) {
-            char * pa = (char *) _pa;
-            walker.prepare();
-            if ( ti ) {
-                walker.walk(pa, ti);
-            } else {
-                Lambda lmb(pa);
-                walker.walk((char *)&lmb, &lambda_type_info);
+    struct GcRoot {
+        char *      pa;
+        TypeInfo *  ti;     // nullptr for lambda gc roots
+    };
+
+    static void gcMarkRoot ( GcMarkAnyHeap & walker, const GcRoot & r ) {
+        walker.prepare();
+        if ( r.ti ) {
+            walker.walk(r.pa, r.ti);
+        } else {
+            Lambda lmb(r.pa);
+            walker.walk((char *)&lmb, &lambda_type_info);
+        }
+    }
+
+    static void gcMarkRoots ( GcMarkAnyHeap & walker, const GcRoot * roots, int count ) {
+        for ( int i=0; i!=count; ++i ) {
+            gcMarkRoot(walker, roots[i]);
+        }
+    }
+
+    static mutex g_gcJobQueMutex;
+    static unique_ptr<JobQue> g_gcJobQue;
+
+    static JobQue * getGcJobQue() {
+        lock_guard<mutex> lock(g_gcJobQueMutex);
+        if ( !g_gcJobQue ) g_gcJobQue = make_unique<JobQue>();
+        return g_gcJobQue.get();
+    }
+
+    void Context::collectHeapRoots ( LineInfo * at, bool globalRoots, bool stackRoots, const callable<void(char *,TypeInfo *)> & fn ) {
+        if ( stackRoots ) {
+            foreach_gc_root([&](void * _pa, TypeInfo * ti) {
+                fn((char *)_pa, ti);
+            });
+        }
+        if ( globalRoots ) {
+            if ( sharedOwner ) {
+                for ( int i=0, is=totalVariables; i!=is; ++i ) {
+                    auto & pv = globalVariables[i];
+                    if ( !pv.shared ) continue;
+                    fn(shared + pv.offset, pv.debugInfo);
+                }
             }
-        });
-        // mark globals
-        if ( sharedOwner ) {
             for ( int i=0, is=totalVariables; i!=is; ++i ) {
                 auto & pv = globalVariables[i];
-                if ( !pv.shared ) continue;
-                walker.prepare();
-                walker.walk(shared + pv.offset, pv.debugInfo);
+                if ( pv.shared ) continue;
+                fn(globals + pv.offset, pv.debugInfo);
             }
         }
-        for ( int i=0, is=totalVariables; i!=is; ++i ) {
-            auto & pv = globalVariables[i];
-            if ( pv.shared ) continue;
-            walker.prepare();
-            walker.walk(globals + pv.offset, pv.debugInfo);
-        }
-        // mark stack
+        if ( !stackRoots ) return;
         char * sp = stack.ap();
         const LineInfo * lineAt = at;
         while (  sp < stack.top() ) {
@@ -1018,8 +1068,12 @@ namespace das
             }
             if ( info ) {
                 for ( uint32_t i=0, is=info->count; i!=is; ++i ) {
-                    walker.prepare();
-                    walker.walk(pp->arguments[i], info->fields[i]);
+                    auto ti = info->fields[i];
+                    if ( ti->flags & TypeInfo::flag_refType ) {
+                        fn(cast<char *>::to(pp->arguments[i]), ti);
+                    } else {
+                        fn((char *)(pp->arguments + i), ti);
+                    }
                 }
                 if ( info->locals && lineAt ) {
                     for ( uint32_t i=0, is=info->localCount; i!=is; ++i ) {
@@ -1033,8 +1087,7 @@ namespace das
                             addr = SP + lv->stackTop;
                         }
                         if ( addr ) {
-                            walker.prepare();
-                            walker.walk(addr, lv);
+                            fn(addr, lv);
                         }
                     }
                 }
@@ -1042,15 +1095,73 @@ namespace das
             lineAt = info ? pp->line : nullptr;
             sp += info ? info->stackSize : pp->stackSize;
         }
+    }
+
+    void Context::collectHeap ( LineInfo * at, bool sheap, bool validate ) {
+        if ( gcIncremental ) cancelCollectHeapStep();
+        GcGuard guard(this);
+        auto tStart = ref_time_ticks();
+        gcReport = GcPauseReport();
+        // clean up, so that all small allocations are marked as 'free'
+        stringDisposeQue = nullptr;
+        if ( sheap && !stringHeap->mark() ) return;
+        if ( !heap->mark() ) return;
+        gcReport.prepareUs = get_time_usec(tStart);
+        // collect roots
+        auto tScan = ref_time_ticks();
+        vector<GcRoot> roots;
+        roots.reserve(totalVariables + 64);
+        collectHeapRoots(at, true, true, [&](char * pa, TypeInfo * ti) {
+            roots.push_back({pa, ti});
+        });
+        gcReport.roots = int32_t(roots.size());
+        gcReport.scanUs = get_time_usec(tScan);
+        // mark
+        auto tMark = ref_time_ticks();
+        das_set<char *> failed;
+        int numRoots = int(roots.size());
+        int workers = das::min(gcMarkWorkers, numRoots);
+        // validation relies on the allocator's chunk cache, so it always runs on the calling thread
+        bool parallel = workers>1 && !validate && heap->canMarkAtomic() && (!sheap || stringHeap->canMarkAtomic());
+        if ( parallel ) {
+            // gc_mark_workers only sets the number of chunks, the job que decides how many threads pick them up
+            mutex threadsMutex;
+            vector<thread::id> threads;
+            // more chunks than workers, so that one heavy root does not leave everyone else idle
+            getGcJobQue()->parallel_for(0, numRoots, [&](int from, int to) {
+                {
+                    lock_guard<mutex> lock(threadsMutex);
+                    auto tid = this_thread::get_id();
+                    if ( find(threads.begin(), threads.end(), tid)==threads.end() ) threads.push_back(tid);
+                }
+                GcMarkAnyHeap walker;
+                walker.markStringHeap = sheap;
+                walker.context = this;
+                walker.atomicMark = true;
+                gcMarkRoots(walker, roots.data() + from, to - from);
+            }, 0, JobPriority::High, das::min(numRoots, workers * 4));
+            gcReport.workers = int32_t(threads.size());
+        } else {
+            GcMarkAnyHeap walker;
+            walker.markStringHeap = sheap;
+            walker.context = this;
+            walker.validate = validate;
+            gcMarkRoots(walker, roots.data(), numRoots);
+            swap(failed, walker.failed);
+        }
+        gcReport.markUs = get_time_usec(tMark);
         // sweep
+        auto tSweep = ref_time_ticks();
         if ( sheap ) stringHeap->sweep();
-        // report errors
         heap->sweep();
-        if ( !walker.failed.empty() ) {
+        gcReport.sweepUs = get_time_usec(tSweep);
+        gcReport.totalUs = get_time_usec(tStart);
+        // report errors
+        if ( !failed.empty() ) {
             reportAnyHeap(at, sheap, true, true, true);
             TextWriter tw;
             tw << "GC failed on the following dangling pointers:" << HEX;
-            for ( auto f : walker.failed ) {
+            for ( auto f : failed ) {
                 tw << " " << uint64_t(f);
             }
             auto etext = allocateString(tw.str(),at);
@@ -1058,6 +1169,148 @@ namespace das
         }
     }
 
+    // Incremental collection. Marking is spread over several collectHeapStep calls, and the program runs in between.
+    // Objects are marked through a queue of pointers to structures, rather than recursively, so that each step can stop
+    // after its budget. Every walked object remembers which heap ranges it read. When marking is done the last step
+    // re-walks the roots and the walked objects, and then sweeps. With 'options gc_page_watch' heap pages are write
+    // protected for the duration of the cycle, and only objects which were read from pages written to since (or from
+    // memory which is not watched) are walked again. The watch is a process-wide fault handler, and system calls which
+    // write into protected pages fail instead of faulting, so it is opt-in and not allowed together with fio or network.
+    // Frees are deferred while the cycle is in progress, so queued and walked objects stay valid memory.
+    struct GcBlack {
+        GcGray      obj;
+        uint32_t    rangeFrom;
+        uint32_t    rangeTo;
+    };
+
+    class GcIncremental {
+    public:
+        vector<GcRoot>      globals;    // globals are walked over the course of the cycle, stack and gc roots right away
+        uint32_t            nextGlobal = 0;
+        vector<GcGray>      gray;
+        vector<GcBlack>     black;
+        vector<PtrRange>    ranges;
+        PageWriteWatch      watch;
+        bool                sheap = true;
+        int32_t             steps = 0;
+    };
+
+    bool Context::collectHeapStep ( LineInfo * at, int32_t budgetUs, bool sheap ) {
+        GcGuard guard(this);
+        auto tStart = ref_time_ticks();
+        gcReport = GcPauseReport();
+        if ( !gcIncremental ) {
+            stringDisposeQue = nullptr;
+            // heaps which can't defer frees get the whole collection in one step
+            if ( sheap && !stringHeap->beginIncrementalMark() ) {
+                collectHeap(at, sheap, false);
+                return true;
+            }
+            if ( !heap->beginIncrementalMark() ) {
+                if ( sheap ) stringHeap->endIncrementalMark(true);
+                collectHeap(at, sheap, false);
+                return true;
+            }
+            gcIncremental = new GcIncremental();
+            gcIncremental->sheap = sheap;
+            // without the page watch nothing is known to be clean, so the last step walks every black object again
+            if ( gcPageWatch ) {
+                heap->forEachChunk([&](char * data, uint64_t size) {
+                    gcIncremental->watch.addRegion(data, size);
+                });
+                gcIncremental->watch.start();
+            }
+            gcReport.prepareUs = get_time_usec(tStart);
+            // stack and gc roots are only valid right now
+            auto tScan = ref_time_ticks();
+            GcMarkAnyHeap walker;
+            walker.markStringHeap = sheap;
+            walker.context = this;
+            walker.gray = &gcIncremental->gray;
+            collectHeapRoots(at, false, true, [&](char * pa, TypeInfo * ti) {
+                gcMarkRoot(walker, {pa, ti});
+                gcReport.roots ++;
+            });
+            collectHeapRoots(at, true, false, [&](char * pa, TypeInfo * ti) {
+                gcIncremental->globals.push_back({pa, ti});
+            });
+            gcReport.roots += int32_t(gcIncremental->globals.size());
+            gcReport.scanUs = get_time_usec(tScan);
+        }
+        auto inc = gcIncremental;
+        inc->steps ++;
+        auto tMark = ref_time_ticks();
+        GcMarkAnyHeap walker;
+        walker.markStringHeap = inc->sheap;
+        walker.context = this;
+        walker.gray = &inc->gray;
+        for ( uint32_t count=1; ; ++count ) {
+            if ( !inc->gray.empty() ) {
+                auto g = inc->gray.back();
+                inc->gray.pop_back();
+                auto rangeFrom = uint32_t(inc->ranges.size());
+                walker.ranges = &inc->ranges;
+                walker.walkGray(g);
+                inc->black.push_back({g, rangeFrom, uint32_t(inc->ranges.size())});
+            } else if ( inc->nextGlobal < inc->globals.size() ) {
+                walker.ranges = nullptr;    // roots are walked again at the end of the cycle
+                gcMarkRoot(walker, inc->globals[inc->nextGlobal++]);
+            } else {
+                break;
+            }
+            if ( (count & 63)==0 && get_time_usec(tStart)>=budgetUs ) {
+                gcReport.markUs = get_time_usec(tMark);
+                gcReport.totalUs = get_time_usec(tStart);
+                return false;
+            }
+        }
+        // the rest is not incremental
+        inc->watch.stop();
+        walker.ranges = nullptr;
+        auto tScan = ref_time_ticks();
+        collectHeapRoots(at, true, true, [&](char * pa, TypeInfo * ti) {
+            gcMarkRoot(walker, {pa, ti});
+            gcReport.roots ++;
+        });
+        gcReport.scanUs += get_time_usec(tScan);
+        for ( auto & b : inc->black ) {
+            for ( uint32_t i=b.rangeFrom; i!=b.rangeTo; ++i ) {
+                auto & r = inc->ranges[i];
+                if ( inc->watch.isDirty(r.from, r.to - r.from) ) {
+                    walker.walkGray(b.obj);
+                    gcReport.rescanned ++;
+                    break;
+                }
+            }
+        }
+        while ( !inc->gray.empty() ) {
+            auto g = inc->gray.back();
+            inc->gray.pop_back();
+            walker.walkGray(g);
+        }
+        gcReport.markUs = get_time_usec(tMark);
+        gcReport.steps = inc->steps;
+        auto tSweep = ref_time_ticks();
+        heap->endIncrementalMark(false);
+        if ( inc->sheap ) stringHeap->endIncrementalMark(false);
+        if ( inc->sheap ) stringHeap->sweep();
+        heap->sweep();
+        gcReport.sweepUs = get_time_usec(tSweep);
+        delete gcIncremental;
+        gcIncremental = nullptr;
+        gcReport.totalUs = get_time_usec(tStart);
+        return true;
+    }
+
+    void Context::cancelCollectHeapStep() {
+        if ( !gcIncremental ) return;
+        gcIncremental->watch.stop();
+        heap->endIncrementalMark(true);
+        if ( gcIncremental->sheap ) stringHeap->endIncrementalMark(true);
+        delete gcIncremental;
+        gcIncremental = nullptr;
+    }
+
     // this one frees data from under arrays and tables only
     struct  GcPod : public DataWalker {
         enum {
@@ -1099,7 +1352,7 @@ namespace das
         virtual void afterTable ( Table * pa, TypeInfo * ti ) override {
             if ( pa->data ) {
                 if ( !pa->lock || pa->hopeless ) {
-                    uint32_t oldSize = pa->capacity*(ti->firstType->size+ti->secondType->size+sizeof(TableHashKey));
+                    uint32_t oldSize = uint32_t(table_mem_size(pa->capacity, ti->firstType->size+ti->secondType->size));
                     __context__->free(pa->data, oldSize, __at__);
                 } else {
                     __context__->throw_error_at(__at__, "can't delete locked table");
@@ -1039,6 +1039,16 @@ namespace das {
         V_END();
     }
 
+    SimNode * SimNode_ArrayAtUnchecked::visit ( SimVisitor & vis ) {
+        V_BEGIN();
+        V_OP(ArrayAtUnchecked);
+        V_SUB(l);
+        V_SUB(r);
+        V_ARG(stride);
+        V_ARG(offset);
+        V_END();
+    }
+
     SimNode * SimNode_SafeArrayAt::visit ( SimVisitor & vis ) {
         V_BEGIN();
         V_OP(SafeArrayAt);
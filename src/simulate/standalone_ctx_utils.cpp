@@ -53,5 +53,6 @@ namespace das {
                 DAS_ASSERT(false);
             }
         }
+        std::atomic_store(&ctx.tabNameLookup, shared_ptr<das_hash_map<uint64_t,int32_t>>());  // rebuilt on the next lookup by name
     }
 }
@@ -26,6 +26,9 @@ static bool jitEnabled = false;
 static bool isAotLib = false;
 static bool version2syntax = true;
 static bool gen2MakeSyntax = false;
+static string compileCacheDir;
+static bool compileCacheStats = false;
+static string contextSnapshotFile;
 
 static CodeOfPolicies getPolicies() {
     CodeOfPolicies policies;
@@ -276,6 +279,72 @@ int das_aot_main ( int argc, char * argv[] ) {
     return compiled ? 0 : -1;
 }
 
+// [init] functions which reach outside of the context can't be trusted to run on top of the restored globals
+static Function * initFunctionWithSideEffects ( ProgramPtr program ) {
+    const uint32_t localWrites = uint32_t(SideEffects::modifyArgument) | uint32_t(SideEffects::accessGlobal);
+    Function * found = nullptr;
+    program->library.foreach([&](Module * mod) -> bool {
+        mod->functions.foreach([&](auto fn) {
+            if ( !found && fn->init && fn->used && (fn->sideEffectFlags & ~localWrites) ) {
+                found = fn.get();
+            }
+        });
+        return found==nullptr;
+    }, "*");
+    return found;
+}
+
+// globals are restored from the snapshot instead of running the global initializers, [init] functions still run.
+// if there is no snapshot, or it is of the different program, global initializers run, and the snapshot is written again
+static ContextPtr SimulateWithSnapshot ( ProgramPtr program, TextWriter & tw ) {
+    if ( auto fn = initFunctionWithSideEffects(program) ) {
+        tw << "context snapshot: [init] function " << fn->name << " has side effects, running init script\n";
+        return SimulateWithErrReport(program, tw);
+    }
+    vector<uint8_t> image;
+    bool haveImage = false;
+    if ( FILE * f = fopen(contextSnapshotFile.c_str(), "rb") ) {
+        fseek(f, 0, SEEK_END);
+        long size = ftell(f);
+        fseek(f, 0, SEEK_SET);
+        if ( size > 0 ) {
+            image.resize(size_t(size));
+            haveImage = fread(image.data(), 1, size_t(size), f)==size_t(size);
+        }
+        fclose(f);
+    }
+    program->skipInitScript = true;
+    auto pctx = SimulateWithErrReport(program, tw);
+    program->skipInitScript = false;
+    if ( !pctx ) return nullptr;
+    string error;
+    bool restored = false;
+    if ( haveImage ) {
+        restored = pctx->restoreInitSnapshot(image.data(), image.size(), error);
+        if ( !restored ) tw << "context snapshot: " << error << ", running global initializers\n";
+    }
+    if ( !restored ) {
+        pctx->runInitScriptAndReport(true, false);
+        if ( pctx->failed ) {
+            tw << "failed to simulate\n";
+            return nullptr;
+        }
+        if ( !pctx->saveInitSnapshot(image, error) ) {
+            tw << "context snapshot: " << error << "\n";
+        } else if ( FILE * f = fopen(contextSnapshotFile.c_str(), "wb") ) {
+            fwrite(image.data(), 1, image.size(), f);
+            fclose(f);
+        }
+    }
+    pctx->runInitScriptAndReport(false, true);
+    if ( pctx->failed ) {
+        tw << "failed to simulate\n";
+        return nullptr;
+    }
+    pctx->restart();
+    return pctx;
+}
+
 bool compile_and_run ( const string & fn, const string & mainFnName, bool outputProgramCode, bool dryRun, const char * introFile = nullptr ) {
     auto access = get_file_access((char*)(projectFile.empty() ? nullptr : projectFile.c_str()));
     if ( introFile ) {
@@ -301,7 +370,7 @@ bool compile_and_run ( const string & fn, const string & mainFnName, bool output
     policies.version_2_syntax = version2syntax;
     policies.gen2_make_syntax = gen2MakeSyntax;
     policies.scoped_stack_allocator = scopedStackAllocator;
-    if ( auto program = compileDaScript(fn,access,tout,dummyGroup,policies) ) {
+    if ( auto program = compileDaScriptCached(fn,access,tout,dummyGroup,compileCacheDir,policies) ) {
         if ( program->failed() ) {
             for ( auto & err : program->errors ) {
                 tout << reportError(err.at, err.what, err.extra, err.fixme, err.cerr );
@@ -312,7 +381,7 @@ bool compile_and_run ( const string & fn, const string & mainFnName, bool output
         } else {
             if ( outputProgramCode )
                 tout << *program << "\n";
-            auto pctx = SimulateWithErrReport(program, tout);
+            auto pctx = contextSnapshotFile.empty() ? SimulateWithErrReport(program, tout) : SimulateWithSnapshot(program, tout);
             if ( !pctx ) {
                 success = false;
             } else if ( program->thisModule->isModule ) {
@@ -376,6 +445,9 @@ void print_help() {
         << "    -pause      pause after errors and pause again before exiting program\n"
         << "    -dry-run    compile and simulate script without execution\n"
         << "    -dasroot    set path to dascript root folder (with daslib)\n"
+        << "    -compile-cache <dir> reuse compiled programs from the cache folder (or DASLANG_COMPILE_CACHE)\n"
+        << "    -compile-cache-stats print compile cache hits and misses\n"
+        << "    -context-snapshot <file> restore globals from the snapshot instead of running the global initializers\n"
 #if DAS_SMART_PTR_ID
         << "    -track-smart-ptr <id> track smart pointer with id\n"
 #endif
@@ -457,6 +529,24 @@ int MAIN_FUNC_NAME ( int argc, char * argv[] ) {
                 }
                 setDasRoot(argv[i+1]);
                 i += 1;
+            } else if ( cmd=="compile-cache" ) {
+                if ( i+1 >= argc ) {
+                    printf("compile-cache requires argument\n");
+                    print_help();
+                    return -1;
+                }
+                compileCacheDir = argv[i+1];
+                i += 1;
+            } else if ( cmd=="compile-cache-stats" ) {
+                compileCacheStats = true;
+            } else if ( cmd=="context-snapshot" ) {
+                if ( i+1 >= argc ) {
+                    printf("context-snapshot requires argument\n");
+                    print_help();
+                    return -1;
+                }
+                contextSnapshotFile = argv[i+1];
+                i += 1;
             } else if ( cmd=="v2syntax" ) {
                 version2syntax = true;
             } else if ( cmd=="v1syntax" ) {
@@ -567,6 +657,11 @@ int MAIN_FUNC_NAME ( int argc, char * argv[] ) {
         print_help();
         return -1;
     }
+    if ( compileCacheDir.empty() ) {
+        if ( auto cacheEnv = getenv("DASLANG_COMPILE_CACHE") ) {
+            compileCacheDir = cacheEnv;
+        }
+    }
     // register modules
     if (!Module::require("$")) {
         NEED_MODULE(Module_BuiltIn);
@@ -612,6 +707,11 @@ int MAIN_FUNC_NAME ( int argc, char * argv[] ) {
             failedFiles++;
         }
     }
+    if ( compileCacheStats ) {
+        auto stats = getCompileCacheStats();
+        tout << "compile cache: " << stats.hits << " hits, " << stats.misses << " misses, "
+            << stats.invalidations << " invalidations, " << stats.stores << " stores\n";
+    }
     // and done
     if ( pauseAfterDone ) getchar();
     Module::Shutdown();